@@ -0,0 +1,22 @@
+#include "../../bench.h"
+#include "../../../simde/arm/neon/add.h"
+
+SIMDE_BENCH_BINARY(vadd_s8, simde_int8x8_t, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(vadd_u16, simde_uint16x4_t, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(vadd_f32, simde_float32x2_t, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_BINARY(vaddq_s8, simde_int8x16_t, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(vaddq_s32, simde_int32x4_t, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(vaddq_u64, simde_uint64x2_t, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(vaddq_f32, simde_float32x4_t, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_BINARY(vaddq_f64, simde_float64x2_t, SIMDE_BENCH_INIT_F64)
+
+SIMDE_BENCH_LIST_BEGIN
+  SIMDE_BENCH_LIST_ENTRY(vadd_s8)
+  SIMDE_BENCH_LIST_ENTRY(vadd_u16)
+  SIMDE_BENCH_LIST_ENTRY(vadd_f32)
+  SIMDE_BENCH_LIST_ENTRY(vaddq_s8)
+  SIMDE_BENCH_LIST_ENTRY(vaddq_s32)
+  SIMDE_BENCH_LIST_ENTRY(vaddq_u64)
+  SIMDE_BENCH_LIST_ENTRY(vaddq_f32)
+  SIMDE_BENCH_LIST_ENTRY(vaddq_f64)
+SIMDE_BENCH_LIST_END
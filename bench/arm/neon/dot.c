@@ -0,0 +1,38 @@
+#include "../../bench.h"
+#include "../../../simde/arm/neon/dot.h"
+#include "../../../simde/arm/neon/usdot.h"
+#include "../../../simde/arm/neon/mmlaq.h"
+
+/* The accumulator and the byte operands have different types, so
+ * these can't go through SIMDE_BENCH_TERNARY. */
+#define SIMDE_BENCH_DOT_(name, RT, AT, BT) \
+  static void simde_bench_tp_##name (size_t iterations) { \
+    static RT acc[SIMDE_BENCH_BATCH]; \
+    static AT a[SIMDE_BENCH_BATCH]; \
+    static BT b[SIMDE_BENCH_BATCH]; \
+    RT r[SIMDE_BENCH_BATCH]; \
+    simde_bench_fill(acc, sizeof(acc), SIMDE_BENCH_INIT_INT); \
+    simde_bench_fill(a, sizeof(a), SIMDE_BENCH_INIT_INT); \
+    simde_bench_fill(b, sizeof(b), SIMDE_BENCH_INIT_INT); \
+    for (size_t i = 0 ; i < iterations ; i += SIMDE_BENCH_BATCH) { \
+      for (size_t j = 0 ; j < SIMDE_BENCH_BATCH ; j++) \
+        r[j] = simde_##name(acc[j], a[j], b[j]); \
+      SIMDE_BENCH_ESCAPE(r); \
+    } \
+  }
+
+SIMDE_BENCH_DOT_(vdotq_s32, simde_int32x4_t, simde_int8x16_t, simde_int8x16_t)
+SIMDE_BENCH_DOT_(vdotq_u32, simde_uint32x4_t, simde_uint8x16_t, simde_uint8x16_t)
+SIMDE_BENCH_DOT_(vdot_s32, simde_int32x2_t, simde_int8x8_t, simde_int8x8_t)
+SIMDE_BENCH_DOT_(vusdotq_s32, simde_int32x4_t, simde_uint8x16_t, simde_int8x16_t)
+SIMDE_BENCH_DOT_(vmmlaq_s32, simde_int32x4_t, simde_int8x16_t, simde_int8x16_t)
+SIMDE_BENCH_DOT_(vusmmlaq_s32, simde_int32x4_t, simde_uint8x16_t, simde_int8x16_t)
+
+SIMDE_BENCH_LIST_BEGIN
+  SIMDE_BENCH_LIST_ENTRY_TP(vdotq_s32)
+  SIMDE_BENCH_LIST_ENTRY_TP(vdotq_u32)
+  SIMDE_BENCH_LIST_ENTRY_TP(vdot_s32)
+  SIMDE_BENCH_LIST_ENTRY_TP(vusdotq_s32)
+  SIMDE_BENCH_LIST_ENTRY_TP(vmmlaq_s32)
+  SIMDE_BENCH_LIST_ENTRY_TP(vusmmlaq_s32)
+SIMDE_BENCH_LIST_END
@@ -0,0 +1,64 @@
+#include "../../bench.h"
+#include "../../../simde/arm/neon/ld3.h"
+#include "../../../simde/arm/neon/ld4.h"
+#include "../../../simde/arm/neon/st3.h"
+#include "../../../simde/arm/neon/st4.h"
+
+/* One "op" is one structured load or store, so the bytes moved per
+ * op is N * sizeof(vector): 48 for vld3q/vst3q, 64 for vld4q/vst4q,
+ * 24 for vld3 and 32 for vld4.  Dividing by the cycles per op gives
+ * the de-interleave/interleave bandwidth in bytes/cycle. */
+
+#define SIMDE_BENCH_LD_(name, ET, VT, N) \
+  static void simde_bench_tp_##name (size_t iterations) { \
+    static ET src[SIMDE_BENCH_BATCH][(sizeof(VT##_t) / sizeof(ET)) * N]; \
+    VT##x##N##_t r[SIMDE_BENCH_BATCH]; \
+    simde_bench_fill(src, sizeof(src), SIMDE_BENCH_INIT_INT); \
+    for (size_t i = 0 ; i < iterations ; i += SIMDE_BENCH_BATCH) { \
+      for (size_t j = 0 ; j < SIMDE_BENCH_BATCH ; j++) \
+        r[j] = simde_##name(src[j]); \
+      SIMDE_BENCH_ESCAPE(r); \
+    } \
+  }
+
+#define SIMDE_BENCH_ST_(name, ET, VT, N) \
+  static void simde_bench_tp_##name (size_t iterations) { \
+    static VT##x##N##_t a[SIMDE_BENCH_BATCH]; \
+    static ET r[SIMDE_BENCH_BATCH][(sizeof(VT##_t) / sizeof(ET)) * N]; \
+    simde_bench_fill(a, sizeof(a), SIMDE_BENCH_INIT_INT); \
+    for (size_t i = 0 ; i < iterations ; i += SIMDE_BENCH_BATCH) { \
+      for (size_t j = 0 ; j < SIMDE_BENCH_BATCH ; j++) \
+        simde_##name(r[j], a[j]); \
+      SIMDE_BENCH_ESCAPE(r); \
+    } \
+  }
+
+SIMDE_BENCH_LD_(vld3_u8, uint8_t, simde_uint8x8, 3)
+SIMDE_BENCH_LD_(vld3q_u8, uint8_t, simde_uint8x16, 3)
+SIMDE_BENCH_LD_(vld3q_u16, uint16_t, simde_uint16x8, 3)
+SIMDE_BENCH_LD_(vld3q_f32, simde_float32_t, simde_float32x4, 3)
+SIMDE_BENCH_LD_(vld4_u8, uint8_t, simde_uint8x8, 4)
+SIMDE_BENCH_LD_(vld4q_u8, uint8_t, simde_uint8x16, 4)
+SIMDE_BENCH_LD_(vld4q_u16, uint16_t, simde_uint16x8, 4)
+SIMDE_BENCH_LD_(vld4q_f32, simde_float32_t, simde_float32x4, 4)
+SIMDE_BENCH_ST_(vst3q_u8, uint8_t, simde_uint8x16, 3)
+SIMDE_BENCH_ST_(vst3q_u16, uint16_t, simde_uint16x8, 3)
+SIMDE_BENCH_ST_(vst3q_f32, simde_float32_t, simde_float32x4, 3)
+SIMDE_BENCH_ST_(vst4q_u8, uint8_t, simde_uint8x16, 4)
+SIMDE_BENCH_ST_(vst4q_f32, simde_float32_t, simde_float32x4, 4)
+
+SIMDE_BENCH_LIST_BEGIN
+  SIMDE_BENCH_LIST_ENTRY_TP(vld3_u8)
+  SIMDE_BENCH_LIST_ENTRY_TP(vld3q_u8)
+  SIMDE_BENCH_LIST_ENTRY_TP(vld3q_u16)
+  SIMDE_BENCH_LIST_ENTRY_TP(vld3q_f32)
+  SIMDE_BENCH_LIST_ENTRY_TP(vld4_u8)
+  SIMDE_BENCH_LIST_ENTRY_TP(vld4q_u8)
+  SIMDE_BENCH_LIST_ENTRY_TP(vld4q_u16)
+  SIMDE_BENCH_LIST_ENTRY_TP(vld4q_f32)
+  SIMDE_BENCH_LIST_ENTRY_TP(vst3q_u8)
+  SIMDE_BENCH_LIST_ENTRY_TP(vst3q_u16)
+  SIMDE_BENCH_LIST_ENTRY_TP(vst3q_f32)
+  SIMDE_BENCH_LIST_ENTRY_TP(vst4q_u8)
+  SIMDE_BENCH_LIST_ENTRY_TP(vst4q_f32)
+SIMDE_BENCH_LIST_END
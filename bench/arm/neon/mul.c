@@ -0,0 +1,20 @@
+#include "../../bench.h"
+#include "../../../simde/arm/neon/mul.h"
+
+SIMDE_BENCH_BINARY(vmul_s16, simde_int16x4_t, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(vmul_u8, simde_uint8x8_t, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(vmulq_s8, simde_int8x16_t, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(vmulq_s16, simde_int16x8_t, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(vmulq_s32, simde_int32x4_t, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(vmulq_f32, simde_float32x4_t, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_BINARY(vmulq_f64, simde_float64x2_t, SIMDE_BENCH_INIT_F64)
+
+SIMDE_BENCH_LIST_BEGIN
+  SIMDE_BENCH_LIST_ENTRY(vmul_s16)
+  SIMDE_BENCH_LIST_ENTRY(vmul_u8)
+  SIMDE_BENCH_LIST_ENTRY(vmulq_s8)
+  SIMDE_BENCH_LIST_ENTRY(vmulq_s16)
+  SIMDE_BENCH_LIST_ENTRY(vmulq_s32)
+  SIMDE_BENCH_LIST_ENTRY(vmulq_f32)
+  SIMDE_BENCH_LIST_ENTRY(vmulq_f64)
+SIMDE_BENCH_LIST_END
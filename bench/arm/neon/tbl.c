@@ -0,0 +1,55 @@
+#include "../../bench.h"
+#include "../../../simde/arm/neon/tbl.h"
+#include "../../../simde/arm/neon/qtbl.h"
+#include "../../../simde/arm/neon/qtbx.h"
+
+SIMDE_BENCH_BINARY(vtbl1_u8, simde_uint8x8_t, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(vqtbl1q_u8, simde_uint8x16_t, SIMDE_BENCH_INIT_INT)
+
+/* Multi-register lookups the way base64/UTF-8 code uses them: one
+ * table for the whole batch, a different index vector per call.  One
+ * "op" is one lookup. */
+#define SIMDE_BENCH_QTBL_(name, TT) \
+  static void simde_bench_tp_##name (size_t iterations) { \
+    static TT t; \
+    static simde_uint8x16_t idx[SIMDE_BENCH_BATCH]; \
+    simde_uint8x16_t r[SIMDE_BENCH_BATCH]; \
+    simde_bench_fill(&t, sizeof(t), SIMDE_BENCH_INIT_INT); \
+    simde_bench_fill(idx, sizeof(idx), SIMDE_BENCH_INIT_INT); \
+    for (size_t i = 0 ; i < iterations ; i += SIMDE_BENCH_BATCH) { \
+      for (size_t j = 0 ; j < SIMDE_BENCH_BATCH ; j++) \
+        r[j] = simde_##name(t, idx[j]); \
+      SIMDE_BENCH_ESCAPE(r); \
+    } \
+  }
+
+#define SIMDE_BENCH_QTBX_(name, TT) \
+  static void simde_bench_tp_##name (size_t iterations) { \
+    static TT t; \
+    static simde_uint8x16_t a[SIMDE_BENCH_BATCH], idx[SIMDE_BENCH_BATCH]; \
+    simde_uint8x16_t r[SIMDE_BENCH_BATCH]; \
+    simde_bench_fill(&t, sizeof(t), SIMDE_BENCH_INIT_INT); \
+    simde_bench_fill(a, sizeof(a), SIMDE_BENCH_INIT_INT); \
+    simde_bench_fill(idx, sizeof(idx), SIMDE_BENCH_INIT_INT); \
+    for (size_t i = 0 ; i < iterations ; i += SIMDE_BENCH_BATCH) { \
+      for (size_t j = 0 ; j < SIMDE_BENCH_BATCH ; j++) \
+        r[j] = simde_##name(a[j], t, idx[j]); \
+      SIMDE_BENCH_ESCAPE(r); \
+    } \
+  }
+
+SIMDE_BENCH_QTBL_(vqtbl2q_u8, simde_uint8x16x2_t)
+SIMDE_BENCH_QTBL_(vqtbl3q_u8, simde_uint8x16x3_t)
+SIMDE_BENCH_QTBL_(vqtbl4q_u8, simde_uint8x16x4_t)
+SIMDE_BENCH_QTBX_(vqtbx2q_u8, simde_uint8x16x2_t)
+SIMDE_BENCH_QTBX_(vqtbx4q_u8, simde_uint8x16x4_t)
+
+SIMDE_BENCH_LIST_BEGIN
+  SIMDE_BENCH_LIST_ENTRY(vtbl1_u8)
+  SIMDE_BENCH_LIST_ENTRY(vqtbl1q_u8)
+  SIMDE_BENCH_LIST_ENTRY_TP(vqtbl2q_u8)
+  SIMDE_BENCH_LIST_ENTRY_TP(vqtbl3q_u8)
+  SIMDE_BENCH_LIST_ENTRY_TP(vqtbl4q_u8)
+  SIMDE_BENCH_LIST_ENTRY_TP(vqtbx2q_u8)
+  SIMDE_BENCH_LIST_ENTRY_TP(vqtbx4q_u8)
+SIMDE_BENCH_LIST_END
@@ -0,0 +1,383 @@
+#if !defined(SIMDE_BENCH_H)
+#define SIMDE_BENCH_H
+
+/* Microbenchmark harness.
+ *
+ * Each file under bench/ mirrors a file under test/ and registers a
+ * list of functions to time.  Every entry is measured two ways:
+ *
+ *  - throughput: the function is applied to a batch of independent
+ *    inputs, so the CPU is free to overlap consecutive calls;
+ *  - latency: the output of each call is fed back in as the first
+ *    argument of the next one, so calls are serialized.
+ *
+ * (Entries whose output can't be fed back in only report throughput.)
+ *
+ * The result is written to stdout as CSV:
+ *
+ *   function,backend,mode,ns_per_op,cycles_per_op
+ *
+ * "backend" is whatever SIMDE_BENCH_BACKEND was defined to when
+ * compiling; the build system compiles each file several times (native,
+ * forced portable via SIMDE_NO_NATIVE, and any other ISA level the host
+ * can run) so results can simply be concatenated and compared.  Cycle
+ * counts come from the time-stamp counter on x86 (i.e., reference
+ * cycles, not core cycles) and are reported as "nan" elsewhere.
+ *
+ * Any command line arguments are treated as substrings; if present,
+ * only functions whose name contains one of them are run.  The
+ * SIMDE_BENCH_MIN_TIME_MS environment variable controls how long each
+ * measurement runs (default 20 ms). */
+
+#if !defined(_POSIX_C_SOURCE) && !defined(_WIN32)
+  #define _POSIX_C_SOURCE 199309L
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../simde/hedley.h"
+#include "../simde/simde-common.h"
+
+#if defined(_WIN32)
+  #include <windows.h>
+#endif
+
+#if defined(SIMDE_ARCH_X86) || defined(SIMDE_ARCH_AMD64)
+  #if defined(_MSC_VER)
+    #include <intrin.h>
+    #define SIMDE_BENCH_HAVE_TSC_
+  #elif defined(__GNUC__) || defined(__clang__)
+    #include <x86intrin.h>
+    #define SIMDE_BENCH_HAVE_TSC_
+  #endif
+#endif
+
+#if !defined(SIMDE_BENCH_BACKEND)
+  #if defined(SIMDE_NO_NATIVE)
+    #define SIMDE_BENCH_BACKEND emul
+  #else
+    #define SIMDE_BENCH_BACKEND native
+  #endif
+#endif
+
+HEDLEY_DIAGNOSTIC_PUSH
+HEDLEY_DIAGNOSTIC_DISABLE_UNUSED_FUNCTION
+
+/* Keep the compiler from optimizing away work whose result we never
+ * look at. */
+#if defined(__GNUC__) || defined(__clang__)
+  #define SIMDE_BENCH_ESCAPE(ptr) __asm__ __volatile__("" : : "g" (ptr) : "memory")
+#else
+  static void* volatile simde_bench_escape_sink_;
+  #define SIMDE_BENCH_ESCAPE(ptr) (simde_bench_escape_sink_ = HEDLEY_REINTERPRET_CAST(void*, (ptr)))
+#endif
+
+/* Number of independent inputs used for throughput measurements.
+ * Large enough to hide latency, small enough to stay in L1. */
+#define SIMDE_BENCH_BATCH 32
+
+typedef enum {
+  SIMDE_BENCH_INIT_INT,
+  SIMDE_BENCH_INIT_F16,
+  SIMDE_BENCH_INIT_F32,
+  SIMDE_BENCH_INIT_F64
+} SimdeBenchInit;
+
+typedef struct {
+  const char* name;
+  void (* throughput)(size_t iterations);
+  void (* latency)(size_t iterations);
+} SimdeBenchEntry;
+
+static uint32_t simde_bench_rand_state_ = UINT32_C(0x9e3779b9);
+
+static uint32_t
+simde_bench_rand_u32 (void) {
+  /* xorshift32; we only need something cheap and deterministic. */
+  uint32_t x = simde_bench_rand_state_;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  simde_bench_rand_state_ = x;
+  return x;
+}
+
+/* Fill a buffer with inputs.  Floating-point lanes are kept close to
+ * 1.0 so that latency chains (x = f(x, y) over millions of calls)
+ * don't drift into subnormals, infinities or NaNs, which would
+ * measure the slow paths of the FPU instead of the function. */
+static void
+simde_bench_fill (void* buf, size_t size, SimdeBenchInit init) {
+  uint8_t* p = HEDLEY_REINTERPRET_CAST(uint8_t*, buf);
+
+  switch (init) {
+    case SIMDE_BENCH_INIT_F32:
+      for (size_t i = 0 ; i + sizeof(simde_float32) <= size ; i += sizeof(simde_float32)) {
+        simde_float32 v = SIMDE_FLOAT32_C(0.999) + (HEDLEY_STATIC_CAST(simde_float32, simde_bench_rand_u32() >> 8) * SIMDE_FLOAT32_C(0.002) / SIMDE_FLOAT32_C(16777216.0));
+        simde_memcpy(p + i, &v, sizeof(v));
+      }
+      break;
+    case SIMDE_BENCH_INIT_F64:
+      for (size_t i = 0 ; i + sizeof(simde_float64) <= size ; i += sizeof(simde_float64)) {
+        simde_float64 v = SIMDE_FLOAT64_C(0.999) + (HEDLEY_STATIC_CAST(simde_float64, simde_bench_rand_u32()) * SIMDE_FLOAT64_C(0.002) / SIMDE_FLOAT64_C(4294967296.0));
+        simde_memcpy(p + i, &v, sizeof(v));
+      }
+      break;
+    case SIMDE_BENCH_INIT_F16:
+      /* 0x3bf0 - 0x3c0f: roughly [0.996, 1.008] */
+      for (size_t i = 0 ; i + sizeof(uint16_t) <= size ; i += sizeof(uint16_t)) {
+        uint16_t v = HEDLEY_STATIC_CAST(uint16_t, 0x3bf0 + (simde_bench_rand_u32() & 0x1f));
+        simde_memcpy(p + i, &v, sizeof(v));
+      }
+      break;
+    case SIMDE_BENCH_INIT_INT:
+    default:
+      for (size_t i = 0 ; i < size ; i++) {
+        p[i] = HEDLEY_STATIC_CAST(uint8_t, simde_bench_rand_u32() >> 24);
+      }
+      break;
+  }
+}
+
+static uint64_t
+simde_bench_now_ns (void) {
+  #if defined(_WIN32)
+    LARGE_INTEGER freq, now;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&now);
+    return HEDLEY_STATIC_CAST(uint64_t, (HEDLEY_STATIC_CAST(double, now.QuadPart) * 1e9) / HEDLEY_STATIC_CAST(double, freq.QuadPart));
+  #elif defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (HEDLEY_STATIC_CAST(uint64_t, ts.tv_sec) * UINT64_C(1000000000)) + HEDLEY_STATIC_CAST(uint64_t, ts.tv_nsec);
+  #else
+    return HEDLEY_STATIC_CAST(uint64_t, (HEDLEY_STATIC_CAST(double, clock()) * 1e9) / CLOCKS_PER_SEC);
+  #endif
+}
+
+static uint64_t
+simde_bench_now_cycles (void) {
+  #if defined(SIMDE_BENCH_HAVE_TSC_)
+    return HEDLEY_STATIC_CAST(uint64_t, __rdtsc());
+  #else
+    return 0;
+  #endif
+}
+
+/* Run fn with increasing iteration counts until a single run takes at
+ * least min_ns, then report the best of a few runs at that count. */
+static void
+simde_bench_measure_ (void (* fn)(size_t iterations), uint64_t min_ns, double* ns_per_op, double* cycles_per_op) {
+  size_t iterations = SIMDE_BENCH_BATCH * 8;
+  uint64_t elapsed;
+
+  for (;;) {
+    uint64_t start = simde_bench_now_ns();
+    fn(iterations);
+    elapsed = simde_bench_now_ns() - start;
+    if (elapsed >= min_ns || iterations >= (SIZE_MAX / 4))
+      break;
+    iterations *= (elapsed < (min_ns / 16)) ? 8 : 2;
+  }
+
+  *ns_per_op = HEDLEY_STATIC_CAST(double, elapsed) / HEDLEY_STATIC_CAST(double, iterations);
+  *cycles_per_op = 0.0;
+  for (int rep = 0 ; rep < 3 ; rep++) {
+    uint64_t start_ns = simde_bench_now_ns();
+    uint64_t start_cycles = simde_bench_now_cycles();
+    fn(iterations);
+    uint64_t cycles = simde_bench_now_cycles() - start_cycles;
+    uint64_t ns = simde_bench_now_ns() - start_ns;
+
+    double n = HEDLEY_STATIC_CAST(double, ns) / HEDLEY_STATIC_CAST(double, iterations);
+    if (n < *ns_per_op)
+      *ns_per_op = n;
+    double c = HEDLEY_STATIC_CAST(double, cycles) / HEDLEY_STATIC_CAST(double, iterations);
+    if (rep == 0 || c < *cycles_per_op)
+      *cycles_per_op = c;
+  }
+}
+
+static int
+simde_bench_selected_ (const char* name, int argc, char* argv[]) {
+  if (argc < 2)
+    return 1;
+  for (int i = 1 ; i < argc ; i++) {
+    if (strstr(name, argv[i]) != NULL)
+      return 1;
+  }
+  return 0;
+}
+
+static void
+simde_bench_print_ (const char* name, const char* mode, double ns_per_op, double cycles_per_op) {
+  #if defined(SIMDE_BENCH_HAVE_TSC_)
+    fprintf(stdout, "%s,%s,%s,%.3f,%.2f\n", name, HEDLEY_STRINGIFY(SIMDE_BENCH_BACKEND), mode, ns_per_op, cycles_per_op);
+  #else
+    (void) cycles_per_op;
+    fprintf(stdout, "%s,%s,%s,%.3f,nan\n", name, HEDLEY_STRINGIFY(SIMDE_BENCH_BACKEND), mode, ns_per_op);
+  #endif
+}
+
+static int
+simde_bench_run (const SimdeBenchEntry* entries, size_t n_entries, int argc, char* argv[]) {
+  uint64_t min_ns = UINT64_C(20000000);
+  const char* min_time = getenv("SIMDE_BENCH_MIN_TIME_MS");
+  if (min_time != NULL && atoi(min_time) > 0)
+    min_ns = HEDLEY_STATIC_CAST(uint64_t, atoi(min_time)) * UINT64_C(1000000);
+
+  fprintf(stdout, "function,backend,mode,ns_per_op,cycles_per_op\n");
+  for (size_t i = 0 ; i < n_entries ; i++) {
+    double ns, cycles;
+
+    if (!simde_bench_selected_(entries[i].name, argc, argv))
+      continue;
+
+    if (entries[i].throughput != NULL) {
+      simde_bench_measure_(entries[i].throughput, min_ns, &ns, &cycles);
+      simde_bench_print_(entries[i].name, "throughput", ns, cycles);
+    }
+    if (entries[i].latency != NULL) {
+      simde_bench_measure_(entries[i].latency, min_ns, &ns, &cycles);
+      simde_bench_print_(entries[i].name, "latency", ns, cycles);
+    }
+    fflush(stdout);
+  }
+
+  return EXIT_SUCCESS;
+}
+
+/* Generators for the common shapes.  T is the vector type, init says
+ * how to fill the inputs.  The generated functions are named
+ * simde_bench_tp_<name> and simde_bench_lat_<name>. */
+
+#define SIMDE_BENCH_INPUTS_(T, n_inputs, init) \
+  static T inputs[n_inputs][SIMDE_BENCH_BATCH]; \
+  static int initialized = 0; \
+  if (HEDLEY_UNLIKELY(!initialized)) { \
+    simde_bench_fill(inputs, sizeof(inputs), init); \
+    initialized = 1; \
+  }
+
+#define SIMDE_BENCH_UNARY(name, T, init) \
+  static void simde_bench_tp_##name (size_t iterations) { \
+    SIMDE_BENCH_INPUTS_(T, 1, init) \
+    T r[SIMDE_BENCH_BATCH]; \
+    for (size_t i = 0 ; i < iterations ; i += SIMDE_BENCH_BATCH) { \
+      for (size_t j = 0 ; j < SIMDE_BENCH_BATCH ; j++) \
+        r[j] = simde_##name(inputs[0][j]); \
+      SIMDE_BENCH_ESCAPE(r); \
+    } \
+  } \
+  static void simde_bench_lat_##name (size_t iterations) { \
+    SIMDE_BENCH_INPUTS_(T, 1, init) \
+    T x = inputs[0][0]; \
+    for (size_t i = 0 ; i < iterations ; i++) \
+      x = simde_##name(x); \
+    SIMDE_BENCH_ESCAPE(&x); \
+  }
+
+#define SIMDE_BENCH_BINARY(name, T, init) \
+  static void simde_bench_tp_##name (size_t iterations) { \
+    SIMDE_BENCH_INPUTS_(T, 2, init) \
+    T r[SIMDE_BENCH_BATCH]; \
+    for (size_t i = 0 ; i < iterations ; i += SIMDE_BENCH_BATCH) { \
+      for (size_t j = 0 ; j < SIMDE_BENCH_BATCH ; j++) \
+        r[j] = simde_##name(inputs[0][j], inputs[1][j]); \
+      SIMDE_BENCH_ESCAPE(r); \
+    } \
+  } \
+  static void simde_bench_lat_##name (size_t iterations) { \
+    SIMDE_BENCH_INPUTS_(T, 2, init) \
+    T x = inputs[0][0]; \
+    for (size_t i = 0 ; i < iterations ; i++) \
+      x = simde_##name(x, inputs[1][i % SIMDE_BENCH_BATCH]); \
+    SIMDE_BENCH_ESCAPE(&x); \
+  }
+
+#define SIMDE_BENCH_TERNARY(name, T, init) \
+  static void simde_bench_tp_##name (size_t iterations) { \
+    SIMDE_BENCH_INPUTS_(T, 3, init) \
+    T r[SIMDE_BENCH_BATCH]; \
+    for (size_t i = 0 ; i < iterations ; i += SIMDE_BENCH_BATCH) { \
+      for (size_t j = 0 ; j < SIMDE_BENCH_BATCH ; j++) \
+        r[j] = simde_##name(inputs[0][j], inputs[1][j], inputs[2][j]); \
+      SIMDE_BENCH_ESCAPE(r); \
+    } \
+  } \
+  static void simde_bench_lat_##name (size_t iterations) { \
+    SIMDE_BENCH_INPUTS_(T, 3, init) \
+    T x = inputs[0][0]; \
+    for (size_t i = 0 ; i < iterations ; i++) \
+      x = simde_##name(x, inputs[1][i % SIMDE_BENCH_BATCH], inputs[2][i % SIMDE_BENCH_BATCH]); \
+    SIMDE_BENCH_ESCAPE(&x); \
+  }
+
+/* Functions taking a compile-time constant as their last argument. */
+#define SIMDE_BENCH_UNARY_IMM(name, T, init, imm) \
+  static void simde_bench_tp_##name (size_t iterations) { \
+    SIMDE_BENCH_INPUTS_(T, 1, init) \
+    T r[SIMDE_BENCH_BATCH]; \
+    for (size_t i = 0 ; i < iterations ; i += SIMDE_BENCH_BATCH) { \
+      for (size_t j = 0 ; j < SIMDE_BENCH_BATCH ; j++) \
+        r[j] = simde_##name(inputs[0][j], imm); \
+      SIMDE_BENCH_ESCAPE(r); \
+    } \
+  } \
+  static void simde_bench_lat_##name (size_t iterations) { \
+    SIMDE_BENCH_INPUTS_(T, 1, init) \
+    T x = inputs[0][0]; \
+    for (size_t i = 0 ; i < iterations ; i++) \
+      x = simde_##name(x, imm); \
+    SIMDE_BENCH_ESCAPE(&x); \
+  }
+
+#define SIMDE_BENCH_BINARY_IMM(name, T, init, imm) \
+  static void simde_bench_tp_##name (size_t iterations) { \
+    SIMDE_BENCH_INPUTS_(T, 2, init) \
+    T r[SIMDE_BENCH_BATCH]; \
+    for (size_t i = 0 ; i < iterations ; i += SIMDE_BENCH_BATCH) { \
+      for (size_t j = 0 ; j < SIMDE_BENCH_BATCH ; j++) \
+        r[j] = simde_##name(inputs[0][j], inputs[1][j], imm); \
+      SIMDE_BENCH_ESCAPE(r); \
+    } \
+  } \
+  static void simde_bench_lat_##name (size_t iterations) { \
+    SIMDE_BENCH_INPUTS_(T, 2, init) \
+    T x = inputs[0][0]; \
+    for (size_t i = 0 ; i < iterations ; i++) \
+      x = simde_##name(x, inputs[1][i % SIMDE_BENCH_BATCH], imm); \
+    SIMDE_BENCH_ESCAPE(&x); \
+  }
+
+/* Functions whose result can't be fed back in (e.g., vector -> int);
+ * only throughput is measured. */
+#define SIMDE_BENCH_REDUCE(name, RT, T, init) \
+  static void simde_bench_tp_##name (size_t iterations) { \
+    SIMDE_BENCH_INPUTS_(T, 1, init) \
+    RT r[SIMDE_BENCH_BATCH]; \
+    for (size_t i = 0 ; i < iterations ; i += SIMDE_BENCH_BATCH) { \
+      for (size_t j = 0 ; j < SIMDE_BENCH_BATCH ; j++) \
+        r[j] = simde_##name(inputs[0][j]); \
+      SIMDE_BENCH_ESCAPE(r); \
+    } \
+  }
+
+#define SIMDE_BENCH_LIST_BEGIN \
+  static const SimdeBenchEntry simde_bench_entries[] = {
+#define SIMDE_BENCH_LIST_ENTRY(name) \
+    { #name, simde_bench_tp_##name, simde_bench_lat_##name },
+#define SIMDE_BENCH_LIST_ENTRY_TP(name) \
+    { #name, simde_bench_tp_##name, NULL },
+#define SIMDE_BENCH_LIST_END \
+  }; \
+  int main(int argc, char* argv[]) { \
+    return simde_bench_run(simde_bench_entries, sizeof(simde_bench_entries) / sizeof(simde_bench_entries[0]), argc, argv); \
+  }
+
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_BENCH_H) */
@@ -0,0 +1,18 @@
+#include "../../bench.h"
+#include "../../../simde/wasm/simd128.h"
+
+SIMDE_BENCH_BINARY(wasm_i8x16_add, simde_v128_t, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(wasm_i16x8_add, simde_v128_t, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(wasm_i32x4_add, simde_v128_t, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(wasm_i64x2_add, simde_v128_t, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(wasm_f32x4_add, simde_v128_t, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_BINARY(wasm_f64x2_add, simde_v128_t, SIMDE_BENCH_INIT_F64)
+
+SIMDE_BENCH_LIST_BEGIN
+  SIMDE_BENCH_LIST_ENTRY(wasm_i8x16_add)
+  SIMDE_BENCH_LIST_ENTRY(wasm_i16x8_add)
+  SIMDE_BENCH_LIST_ENTRY(wasm_i32x4_add)
+  SIMDE_BENCH_LIST_ENTRY(wasm_i64x2_add)
+  SIMDE_BENCH_LIST_ENTRY(wasm_f32x4_add)
+  SIMDE_BENCH_LIST_ENTRY(wasm_f64x2_add)
+SIMDE_BENCH_LIST_END
@@ -0,0 +1,8 @@
+#include "../../bench.h"
+#include "../../../simde/wasm/simd128.h"
+
+SIMDE_BENCH_BINARY(wasm_i8x16_swizzle, simde_v128_t, SIMDE_BENCH_INIT_INT)
+
+SIMDE_BENCH_LIST_BEGIN
+  SIMDE_BENCH_LIST_ENTRY(wasm_i8x16_swizzle)
+SIMDE_BENCH_LIST_END
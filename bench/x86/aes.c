@@ -0,0 +1,30 @@
+#include "../bench.h"
+#include "../../simde/x86/aes.h"
+
+SIMDE_BENCH_BINARY(mm_aesenc_si128, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm_aesenclast_si128, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm_aesdec_si128, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm_aesdeclast_si128, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_UNARY(mm_aesimc_si128, simde__m128i, SIMDE_BENCH_INIT_INT)
+
+/* Full AES-128 over a CTR-style batch of eight blocks; one "op" is one
+ * block. */
+static void simde_bench_tp_x_aes_encrypt_blocks (size_t iterations) {
+  static simde__m128i k[11];
+  simde__m128i b[8];
+  simde_bench_fill(k, sizeof(k), SIMDE_BENCH_INIT_INT);
+  simde_bench_fill(b, sizeof(b), SIMDE_BENCH_INIT_INT);
+  for (size_t i = 0 ; i < iterations ; i += 8) {
+    simde_x_aes_encrypt_blocks(b, 8, k, 10);
+    SIMDE_BENCH_ESCAPE(b);
+  }
+}
+
+SIMDE_BENCH_LIST_BEGIN
+  SIMDE_BENCH_LIST_ENTRY(mm_aesenc_si128)
+  SIMDE_BENCH_LIST_ENTRY(mm_aesenclast_si128)
+  SIMDE_BENCH_LIST_ENTRY(mm_aesdec_si128)
+  SIMDE_BENCH_LIST_ENTRY(mm_aesdeclast_si128)
+  SIMDE_BENCH_LIST_ENTRY(mm_aesimc_si128)
+  SIMDE_BENCH_LIST_ENTRY_TP(x_aes_encrypt_blocks)
+SIMDE_BENCH_LIST_END
@@ -0,0 +1,100 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+  #define _GNU_SOURCE
+#endif
+
+#include "../bench.h"
+#include "../../simde/x86/amx.h"
+
+#if defined(SIMDE_X86_AMX_TILE_NATIVE) && defined(__linux__)
+  #include <unistd.h>
+  #include <sys/syscall.h>
+#endif
+
+/* One "op" is a full 16x16 (x 64 bytes of K) tile product, i.e.
+ * 16384 int8 MACs or 8192 bf16 MACs, with C, A and B loaded and C
+ * stored back, as a GEMM inner loop would. */
+
+static int32_t simde_bench_amx_c_[16][16];
+static uint8_t simde_bench_amx_a_[16][64], simde_bench_amx_b_[16][64];
+
+static void
+simde_bench_amx_setup_ (void) {
+  uint8_t config[64] = { 0 };
+
+  #if defined(SIMDE_X86_AMX_TILE_NATIVE) && defined(__linux__)
+    syscall(SYS_arch_prctl, 0x1023, 18);
+  #endif
+
+  config[0] = 1;
+  for (size_t i = 0 ; i < 3 ; i++) {
+    config[16 + (2 * i)] = 64;
+    config[48 + i] = 16;
+  }
+  simde_tile_loadconfig(config);
+  simde_bench_fill(simde_bench_amx_c_, sizeof(simde_bench_amx_c_), SIMDE_BENCH_INIT_INT);
+  simde_bench_fill(simde_bench_amx_a_, sizeof(simde_bench_amx_a_), SIMDE_BENCH_INIT_INT);
+  simde_bench_fill(simde_bench_amx_b_, sizeof(simde_bench_amx_b_), SIMDE_BENCH_INIT_INT);
+}
+
+/* Random bytes make terrible bf16 inputs (lots of denormals, which
+ * AMX flushes but the emulation doesn't), so for bf16 use values in
+ * [1, 2) and start C from 0. */
+static void
+simde_bench_amx_setup_bf16_ (void) {
+  simde_bench_amx_setup_();
+  simde_memset(simde_bench_amx_c_, 0, sizeof(simde_bench_amx_c_));
+  for (size_t i = 0 ; i < 16 ; i++) {
+    for (size_t j = 0 ; j < 64 ; j += 2) {
+      uint16_t a = HEDLEY_STATIC_CAST(uint16_t, 0x3f80 | (simde_bench_rand_u32() & 0x7f));
+      uint16_t b = HEDLEY_STATIC_CAST(uint16_t, 0x3f80 | (simde_bench_rand_u32() & 0x7f));
+      simde_memcpy(&(simde_bench_amx_a_[i][j]), &a, sizeof(a));
+      simde_memcpy(&(simde_bench_amx_b_[i][j]), &b, sizeof(b));
+    }
+  }
+}
+
+#define SIMDE_BENCH_AMX_(name, setup) \
+  static void simde_bench_tp_tile_##name (size_t iterations) { \
+    setup(); \
+    for (size_t i = 0 ; i < iterations ; i++) { \
+      simde_tile_loadd(0, simde_bench_amx_c_, 64); \
+      simde_tile_loadd(1, simde_bench_amx_a_, 64); \
+      simde_tile_loadd(2, simde_bench_amx_b_, 64); \
+      simde_tile_##name(0, 1, 2); \
+      simde_tile_stored(0, simde_bench_amx_c_, 64); \
+      SIMDE_BENCH_ESCAPE(simde_bench_amx_c_); \
+    } \
+    simde_tile_release(); \
+  }
+
+SIMDE_BENCH_AMX_(dpbssd, simde_bench_amx_setup_)
+SIMDE_BENCH_AMX_(dpbuud, simde_bench_amx_setup_)
+SIMDE_BENCH_AMX_(dpbf16ps, simde_bench_amx_setup_bf16_)
+
+/* The straightforward triple loop, for comparison. */
+static void
+simde_bench_tp_tile_dpbssd_loop (size_t iterations) {
+  simde_bench_amx_setup_();
+  simde_tile_release();
+  for (size_t i = 0 ; i < iterations ; i++) {
+    for (size_t m = 0 ; m < 16 ; m++) {
+      for (size_t k = 0 ; k < 16 ; k++) {
+        for (size_t n = 0 ; n < 16 ; n++) {
+          int32_t sum = 0;
+          for (size_t q = 0 ; q < 4 ; q++) {
+            sum += HEDLEY_STATIC_CAST(int8_t, simde_bench_amx_a_[m][(k * 4) + q]) * HEDLEY_STATIC_CAST(int8_t, simde_bench_amx_b_[k][(n * 4) + q]);
+          }
+          simde_bench_amx_c_[m][n] = HEDLEY_STATIC_CAST(int32_t, HEDLEY_STATIC_CAST(uint32_t, simde_bench_amx_c_[m][n]) + HEDLEY_STATIC_CAST(uint32_t, sum));
+        }
+      }
+    }
+    SIMDE_BENCH_ESCAPE(simde_bench_amx_c_);
+  }
+}
+
+SIMDE_BENCH_LIST_BEGIN
+  SIMDE_BENCH_LIST_ENTRY_TP(tile_dpbssd)
+  SIMDE_BENCH_LIST_ENTRY_TP(tile_dpbuud)
+  SIMDE_BENCH_LIST_ENTRY_TP(tile_dpbf16ps)
+  SIMDE_BENCH_LIST_ENTRY_TP(tile_dpbssd_loop)
+SIMDE_BENCH_LIST_END
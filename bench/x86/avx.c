@@ -0,0 +1,36 @@
+#include "../bench.h"
+#include "../../simde/x86/avx.h"
+
+SIMDE_BENCH_BINARY(mm256_add_ps, simde__m256, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_BINARY(mm256_mul_ps, simde__m256, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_BINARY(mm256_div_ps, simde__m256, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_BINARY(mm256_hadd_ps, simde__m256, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_BINARY(mm256_max_ps, simde__m256, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_BINARY_IMM(mm256_cmp_ps, simde__m256, SIMDE_BENCH_INIT_F32, SIMDE_CMP_LT_OQ)
+SIMDE_BENCH_BINARY_IMM(mm256_dp_ps, simde__m256, SIMDE_BENCH_INIT_F32, 0xff)
+SIMDE_BENCH_TERNARY(mm256_blendv_ps, simde__m256, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_UNARY(mm256_sqrt_ps, simde__m256, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_UNARY_IMM(mm256_permute_ps, simde__m256, SIMDE_BENCH_INIT_F32, SIMDE_MM_SHUFFLE(0, 1, 2, 3))
+SIMDE_BENCH_UNARY_IMM(mm256_round_ps, simde__m256, SIMDE_BENCH_INIT_F32, SIMDE_MM_FROUND_TO_NEAREST_INT)
+SIMDE_BENCH_BINARY(mm256_add_pd, simde__m256d, SIMDE_BENCH_INIT_F64)
+SIMDE_BENCH_BINARY(mm256_mul_pd, simde__m256d, SIMDE_BENCH_INIT_F64)
+SIMDE_BENCH_UNARY(mm256_sqrt_pd, simde__m256d, SIMDE_BENCH_INIT_F64)
+SIMDE_BENCH_REDUCE(mm256_movemask_ps, int, simde__m256, SIMDE_BENCH_INIT_F32)
+
+SIMDE_BENCH_LIST_BEGIN
+  SIMDE_BENCH_LIST_ENTRY(mm256_add_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm256_mul_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm256_div_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm256_hadd_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm256_max_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm256_cmp_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm256_dp_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm256_blendv_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm256_sqrt_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm256_permute_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm256_round_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm256_add_pd)
+  SIMDE_BENCH_LIST_ENTRY(mm256_mul_pd)
+  SIMDE_BENCH_LIST_ENTRY(mm256_sqrt_pd)
+  SIMDE_BENCH_LIST_ENTRY_TP(mm256_movemask_ps)
+SIMDE_BENCH_LIST_END
@@ -0,0 +1,42 @@
+#include "../bench.h"
+#include "../../simde/x86/avx2.h"
+
+SIMDE_BENCH_BINARY(mm256_add_epi8, simde__m256i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm256_add_epi32, simde__m256i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm256_cmpgt_epi8, simde__m256i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm256_madd_epi16, simde__m256i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm256_maddubs_epi16, simde__m256i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm256_mullo_epi32, simde__m256i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm256_mul_epu32, simde__m256i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm256_packs_epi32, simde__m256i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm256_permutevar8x32_epi32, simde__m256i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm256_sad_epu8, simde__m256i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm256_shuffle_epi8, simde__m256i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm256_srlv_epi32, simde__m256i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm256_unpacklo_epi8, simde__m256i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_TERNARY(mm256_blendv_epi8, simde__m256i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_UNARY(mm256_abs_epi16, simde__m256i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_UNARY_IMM(mm256_permute4x64_epi64, simde__m256i, SIMDE_BENCH_INIT_INT, SIMDE_MM_SHUFFLE(0, 1, 2, 3))
+SIMDE_BENCH_UNARY_IMM(mm256_slli_epi32, simde__m256i, SIMDE_BENCH_INIT_INT, 3)
+SIMDE_BENCH_REDUCE(mm256_movemask_epi8, int32_t, simde__m256i, SIMDE_BENCH_INIT_INT)
+
+SIMDE_BENCH_LIST_BEGIN
+  SIMDE_BENCH_LIST_ENTRY(mm256_add_epi8)
+  SIMDE_BENCH_LIST_ENTRY(mm256_add_epi32)
+  SIMDE_BENCH_LIST_ENTRY(mm256_cmpgt_epi8)
+  SIMDE_BENCH_LIST_ENTRY(mm256_madd_epi16)
+  SIMDE_BENCH_LIST_ENTRY(mm256_maddubs_epi16)
+  SIMDE_BENCH_LIST_ENTRY(mm256_mullo_epi32)
+  SIMDE_BENCH_LIST_ENTRY(mm256_mul_epu32)
+  SIMDE_BENCH_LIST_ENTRY(mm256_packs_epi32)
+  SIMDE_BENCH_LIST_ENTRY(mm256_permutevar8x32_epi32)
+  SIMDE_BENCH_LIST_ENTRY(mm256_sad_epu8)
+  SIMDE_BENCH_LIST_ENTRY(mm256_shuffle_epi8)
+  SIMDE_BENCH_LIST_ENTRY(mm256_srlv_epi32)
+  SIMDE_BENCH_LIST_ENTRY(mm256_unpacklo_epi8)
+  SIMDE_BENCH_LIST_ENTRY(mm256_blendv_epi8)
+  SIMDE_BENCH_LIST_ENTRY(mm256_abs_epi16)
+  SIMDE_BENCH_LIST_ENTRY(mm256_permute4x64_epi64)
+  SIMDE_BENCH_LIST_ENTRY(mm256_slli_epi32)
+  SIMDE_BENCH_LIST_ENTRY_TP(mm256_movemask_epi8)
+SIMDE_BENCH_LIST_END
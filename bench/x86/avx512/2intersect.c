@@ -0,0 +1,82 @@
+#include "../../bench.h"
+#include "../../../simde/x86/avx512/2intersect.h"
+
+/* None of the implementations branch on the data, so random inputs
+ * (which almost never match) are as good as any.  One "op" is one
+ * call; both masks are kept. */
+#define SIMDE_BENCH_2INTERSECT_(name, T, MT) \
+  static void simde_bench_tp_##name (size_t iterations) { \
+    SIMDE_BENCH_INPUTS_(T, 2, SIMDE_BENCH_INIT_INT) \
+    MT r[2][SIMDE_BENCH_BATCH]; \
+    for (size_t i = 0 ; i < iterations ; i += SIMDE_BENCH_BATCH) { \
+      for (size_t j = 0 ; j < SIMDE_BENCH_BATCH ; j++) \
+        simde_##name(inputs[0][j], inputs[1][j], &(r[0][j]), &(r[1][j])); \
+      SIMDE_BENCH_ESCAPE(r); \
+    } \
+  }
+
+/* The all-pairs loop the portable implementation used before, for
+ * comparison. */
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_mm512_2intersect_epi32_loop (simde__m512i a, simde__m512i b, simde__mmask16 *k1, simde__mmask16 *k2) {
+  simde__m512i_private
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b);
+  simde__mmask16
+    k1_ = 0,
+    k2_ = 0;
+
+  for (size_t i = 0 ; i < sizeof(a_.i32) / sizeof(a_.i32[0]) ; i++) {
+    SIMDE_VECTORIZE
+    for (size_t j = 0 ; j < sizeof(b_.i32) / sizeof(b_.i32[0]) ; j++) {
+      const int32_t m = a_.i32[i] == b_.i32[j];
+      k1_ |= m << i;
+      k2_ |= m << j;
+    }
+  }
+
+  *k1 = k1_;
+  *k2 = k2_;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_mm256_2intersect_epi64_loop (simde__m256i a, simde__m256i b, simde__mmask8 *k1, simde__mmask8 *k2) {
+  simde__m256i_private
+    a_ = simde__m256i_to_private(a),
+    b_ = simde__m256i_to_private(b);
+  simde__mmask8
+    k1_ = 0,
+    k2_ = 0;
+
+  for (size_t i = 0 ; i < sizeof(a_.i64) / sizeof(a_.i64[0]) ; i++) {
+    SIMDE_VECTORIZE
+    for (size_t j = 0 ; j < sizeof(b_.i64) / sizeof(b_.i64[0]) ; j++) {
+      const int32_t m = a_.i64[i] == b_.i64[j];
+      k1_ |= m << i;
+      k2_ |= m << j;
+    }
+  }
+
+  *k1 = k1_;
+  *k2 = k2_;
+}
+
+SIMDE_BENCH_2INTERSECT_(mm_2intersect_epi32, simde__m128i, simde__mmask8)
+SIMDE_BENCH_2INTERSECT_(mm256_2intersect_epi32, simde__m256i, simde__mmask8)
+SIMDE_BENCH_2INTERSECT_(mm256_2intersect_epi64, simde__m256i, simde__mmask8)
+SIMDE_BENCH_2INTERSECT_(mm512_2intersect_epi32, simde__m512i, simde__mmask16)
+SIMDE_BENCH_2INTERSECT_(mm512_2intersect_epi64, simde__m512i, simde__mmask8)
+SIMDE_BENCH_2INTERSECT_(x_mm256_2intersect_epi64_loop, simde__m256i, simde__mmask8)
+SIMDE_BENCH_2INTERSECT_(x_mm512_2intersect_epi32_loop, simde__m512i, simde__mmask16)
+
+SIMDE_BENCH_LIST_BEGIN
+  SIMDE_BENCH_LIST_ENTRY_TP(mm_2intersect_epi32)
+  SIMDE_BENCH_LIST_ENTRY_TP(mm256_2intersect_epi32)
+  SIMDE_BENCH_LIST_ENTRY_TP(mm256_2intersect_epi64)
+  SIMDE_BENCH_LIST_ENTRY_TP(mm512_2intersect_epi32)
+  SIMDE_BENCH_LIST_ENTRY_TP(mm512_2intersect_epi64)
+  SIMDE_BENCH_LIST_ENTRY_TP(x_mm256_2intersect_epi64_loop)
+  SIMDE_BENCH_LIST_ENTRY_TP(x_mm512_2intersect_epi32_loop)
+SIMDE_BENCH_LIST_END
@@ -0,0 +1,16 @@
+#include "../../bench.h"
+#include "../../../simde/x86/avx512/add.h"
+
+SIMDE_BENCH_BINARY(mm512_add_epi8, simde__m512i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm512_add_epi32, simde__m512i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm512_add_epi64, simde__m512i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm512_add_ps, simde__m512, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_BINARY(mm512_add_pd, simde__m512d, SIMDE_BENCH_INIT_F64)
+
+SIMDE_BENCH_LIST_BEGIN
+  SIMDE_BENCH_LIST_ENTRY(mm512_add_epi8)
+  SIMDE_BENCH_LIST_ENTRY(mm512_add_epi32)
+  SIMDE_BENCH_LIST_ENTRY(mm512_add_epi64)
+  SIMDE_BENCH_LIST_ENTRY(mm512_add_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm512_add_pd)
+SIMDE_BENCH_LIST_END
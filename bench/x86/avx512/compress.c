@@ -0,0 +1,117 @@
+#include "../../bench.h"
+#include "../../../simde/x86/avx512/compress.h"
+
+/* Every call gets a different random mask (from a table much longer
+ * than a batch), so a branchy implementation can't have its pattern
+ * learned by the branch predictor.  One "op" is one call. */
+#define SIMDE_BENCH_COMPRESS_MASKS_ 4096
+
+#define SIMDE_BENCH_COMPRESS_(name, T, MT, init) \
+  static void simde_bench_tp_##name (size_t iterations) { \
+    static T src[SIMDE_BENCH_BATCH], a[SIMDE_BENCH_BATCH]; \
+    static MT k[SIMDE_BENCH_COMPRESS_MASKS_]; \
+    T r[SIMDE_BENCH_BATCH]; \
+    simde_bench_fill(src, sizeof(src), init); \
+    simde_bench_fill(a, sizeof(a), init); \
+    simde_bench_fill(k, sizeof(k), SIMDE_BENCH_INIT_INT); \
+    for (size_t i = 0 ; i < iterations ; i += SIMDE_BENCH_BATCH) { \
+      for (size_t j = 0 ; j < SIMDE_BENCH_BATCH ; j++) \
+        r[j] = simde_##name(src[j], k[(i + j) % SIMDE_BENCH_COMPRESS_MASKS_], a[j]); \
+      SIMDE_BENCH_ESCAPE(r); \
+    } \
+  }
+
+#define SIMDE_BENCH_COMPRESSSTOREU_(name, T, MT, init) \
+  static void simde_bench_tp_##name (size_t iterations) { \
+    static T a[SIMDE_BENCH_BATCH]; \
+    static MT k[SIMDE_BENCH_COMPRESS_MASKS_]; \
+    T r[SIMDE_BENCH_BATCH]; \
+    simde_bench_fill(a, sizeof(a), init); \
+    simde_bench_fill(k, sizeof(k), SIMDE_BENCH_INIT_INT); \
+    for (size_t i = 0 ; i < iterations ; i += SIMDE_BENCH_BATCH) { \
+      for (size_t j = 0 ; j < SIMDE_BENCH_BATCH ; j++) \
+        simde_##name(&(r[j]), k[(i + j) % SIMDE_BENCH_COMPRESS_MASKS_], a[j]); \
+      SIMDE_BENCH_ESCAPE(r); \
+    } \
+  }
+
+/* The element-at-a-time loops the portable implementations used
+ * before, for comparison. */
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_x_mm256_mask_compress_ps_loop (simde__m256 src, simde__mmask8 k, simde__m256 a) {
+  simde__m256_private
+    a_ = simde__m256_to_private(a),
+    src_ = simde__m256_to_private(src);
+  size_t ri = 0;
+
+  for (size_t i = 0 ; i < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; i++) {
+    if ((k >> i) & 1) {
+      a_.f32[ri++] = a_.f32[i];
+    }
+  }
+
+  for ( ; ri < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; ri++) {
+    a_.f32[ri] = src_.f32[ri];
+  }
+
+  return simde__m256_from_private(a_);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_x_mm512_mask_compress_epi32_loop (simde__m512i src, simde__mmask16 k, simde__m512i a) {
+  simde__m512i_private
+    a_ = simde__m512i_to_private(a),
+    src_ = simde__m512i_to_private(src);
+  size_t ri = 0;
+
+  for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
+    if ((k >> i) & 1) {
+      a_.i32[ri++] = a_.i32[i];
+    }
+  }
+
+  for ( ; ri < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; ri++) {
+    a_.i32[ri] = src_.i32[ri];
+  }
+
+  return simde__m512i_from_private(a_);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_mm512_mask_compressstoreu_epi32_loop (void* base_addr, simde__mmask16 k, simde__m512i a) {
+  simde__m512i_private a_ = simde__m512i_to_private(a);
+  size_t ri = 0;
+
+  for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
+    if ((k >> i) & 1) {
+      a_.i32[ri++] = a_.i32[i];
+    }
+  }
+
+  simde_memcpy(base_addr, &a_, ri * sizeof(a_.i32[0]));
+}
+
+SIMDE_BENCH_COMPRESS_(mm256_mask_compress_ps, simde__m256, simde__mmask8, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_COMPRESS_(mm256_mask_compress_epi64, simde__m256i, simde__mmask8, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_COMPRESS_(mm512_mask_compress_epi32, simde__m512i, simde__mmask16, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_COMPRESS_(mm512_mask_compress_pd, simde__m512d, simde__mmask8, SIMDE_BENCH_INIT_F64)
+SIMDE_BENCH_COMPRESSSTOREU_(mm256_mask_compressstoreu_ps, simde__m256, simde__mmask8, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_COMPRESSSTOREU_(mm512_mask_compressstoreu_epi32, simde__m512i, simde__mmask16, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_COMPRESS_(x_mm256_mask_compress_ps_loop, simde__m256, simde__mmask8, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_COMPRESS_(x_mm512_mask_compress_epi32_loop, simde__m512i, simde__mmask16, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_COMPRESSSTOREU_(x_mm512_mask_compressstoreu_epi32_loop, simde__m512i, simde__mmask16, SIMDE_BENCH_INIT_INT)
+
+SIMDE_BENCH_LIST_BEGIN
+  SIMDE_BENCH_LIST_ENTRY_TP(mm256_mask_compress_ps)
+  SIMDE_BENCH_LIST_ENTRY_TP(mm256_mask_compress_epi64)
+  SIMDE_BENCH_LIST_ENTRY_TP(mm512_mask_compress_epi32)
+  SIMDE_BENCH_LIST_ENTRY_TP(mm512_mask_compress_pd)
+  SIMDE_BENCH_LIST_ENTRY_TP(mm256_mask_compressstoreu_ps)
+  SIMDE_BENCH_LIST_ENTRY_TP(mm512_mask_compressstoreu_epi32)
+  SIMDE_BENCH_LIST_ENTRY_TP(x_mm256_mask_compress_ps_loop)
+  SIMDE_BENCH_LIST_ENTRY_TP(x_mm512_mask_compress_epi32_loop)
+  SIMDE_BENCH_LIST_ENTRY_TP(x_mm512_mask_compressstoreu_epi32_loop)
+SIMDE_BENCH_LIST_END
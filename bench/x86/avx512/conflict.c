@@ -0,0 +1,77 @@
+#include "../../bench.h"
+#include "../../../simde/x86/avx512/conflict.h"
+
+/* The broadcast-and-compare loops the portable implementations used
+ * before, for comparison. */
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_x_mm256_conflict_epi32_loop (simde__m256i a) {
+  simde__m256i_private
+    r_ = simde__m256i_to_private(simde_mm256_setzero_si256()),
+    a_ = simde__m256i_to_private(a);
+
+  for (size_t i = 1 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+    r_.i32[i] =
+        simde_mm256_movemask_ps(
+          simde_mm256_castsi256_ps(
+            simde_mm256_cmpeq_epi32(simde_mm256_set1_epi32(a_.i32[i]), a)
+          )
+        ) & ((1 << i) - 1);
+  }
+
+  return simde__m256i_from_private(r_);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_x_mm512_conflict_epi32_loop (simde__m512i a) {
+  simde__m512i_private
+    r_ = simde__m512i_to_private(simde_mm512_setzero_si512()),
+    a_ = simde__m512i_to_private(a);
+
+  for (size_t i = 1 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+    r_.i32[i] =
+      HEDLEY_STATIC_CAST(
+        int32_t,
+        simde_mm512_cmpeq_epi32_mask(simde_mm512_set1_epi32(a_.i32[i]), a)
+      ) & ((1 << i) - 1);
+  }
+
+  return simde__m512i_from_private(r_);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_x_mm512_conflict_epi64_loop (simde__m512i a) {
+  simde__m512i_private
+    r_ = simde__m512i_to_private(simde_mm512_setzero_si512()),
+    a_ = simde__m512i_to_private(a);
+
+  for (size_t i = 1 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+    r_.i64[i] =
+      HEDLEY_STATIC_CAST(
+        int64_t,
+        simde_mm512_cmpeq_epi64_mask(simde_mm512_set1_epi64(a_.i64[i]), a)
+      ) & ((1 << i) - 1);
+  }
+
+  return simde__m512i_from_private(r_);
+}
+
+SIMDE_BENCH_UNARY(mm_conflict_epi32, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_UNARY(mm256_conflict_epi32, simde__m256i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_UNARY(mm512_conflict_epi32, simde__m512i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_UNARY(mm512_conflict_epi64, simde__m512i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_UNARY(x_mm256_conflict_epi32_loop, simde__m256i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_UNARY(x_mm512_conflict_epi32_loop, simde__m512i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_UNARY(x_mm512_conflict_epi64_loop, simde__m512i, SIMDE_BENCH_INIT_INT)
+
+SIMDE_BENCH_LIST_BEGIN
+  SIMDE_BENCH_LIST_ENTRY(mm_conflict_epi32)
+  SIMDE_BENCH_LIST_ENTRY(mm256_conflict_epi32)
+  SIMDE_BENCH_LIST_ENTRY(mm512_conflict_epi32)
+  SIMDE_BENCH_LIST_ENTRY(mm512_conflict_epi64)
+  SIMDE_BENCH_LIST_ENTRY(x_mm256_conflict_epi32_loop)
+  SIMDE_BENCH_LIST_ENTRY(x_mm512_conflict_epi32_loop)
+  SIMDE_BENCH_LIST_ENTRY(x_mm512_conflict_epi64_loop)
+SIMDE_BENCH_LIST_END
@@ -0,0 +1,55 @@
+#include "../../bench.h"
+#include "../../../simde/x86/avx512/madd52.h"
+
+SIMDE_BENCH_TERNARY(mm_madd52lo_epu64, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_TERNARY(mm256_madd52lo_epu64, simde__m256i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_TERNARY(mm512_madd52lo_epu64, simde__m512i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_TERNARY(mm512_madd52hi_epu64, simde__m512i, SIMDE_BENCH_INIT_INT)
+
+#if defined(SIMDE_HAVE_INT128_)
+/* The same eight lanes of madd52lo + madd52hi done with scalar 128-bit
+ * multiplies, i.e., what a bignum library does without IFMA.  One "op"
+ * is eight lanes, so it compares directly with mm512_madd52{lo,hi}. */
+static void simde_bench_tp_x_madd52_scalar (size_t iterations) {
+  static uint64_t inputs[3][SIMDE_BENCH_BATCH][8];
+  uint64_t lo[SIMDE_BENCH_BATCH][8], hi[SIMDE_BENCH_BATCH][8];
+  simde_bench_fill(inputs, sizeof(inputs), SIMDE_BENCH_INIT_INT);
+  for (size_t i = 0 ; i < iterations ; i += SIMDE_BENCH_BATCH) {
+    for (size_t j = 0 ; j < SIMDE_BENCH_BATCH ; j++) {
+      for (size_t l = 0 ; l < 8 ; l++) {
+        const simde_uint128 p =
+          HEDLEY_STATIC_CAST(simde_uint128, inputs[1][j][l] & UINT64_C(0xFFFFFFFFFFFFF)) *
+          HEDLEY_STATIC_CAST(simde_uint128, inputs[2][j][l] & UINT64_C(0xFFFFFFFFFFFFF));
+        lo[j][l] = inputs[0][j][l] + (HEDLEY_STATIC_CAST(uint64_t, p) & UINT64_C(0xFFFFFFFFFFFFF));
+        hi[j][l] = inputs[0][j][l] + HEDLEY_STATIC_CAST(uint64_t, p >> 52);
+      }
+    }
+    SIMDE_BENCH_ESCAPE(lo);
+    SIMDE_BENCH_ESCAPE(hi);
+  }
+}
+
+static void simde_bench_tp_x_madd52_vector (size_t iterations) {
+  SIMDE_BENCH_INPUTS_(simde__m512i, 3, SIMDE_BENCH_INIT_INT)
+  simde__m512i lo[SIMDE_BENCH_BATCH], hi[SIMDE_BENCH_BATCH];
+  for (size_t i = 0 ; i < iterations ; i += SIMDE_BENCH_BATCH) {
+    for (size_t j = 0 ; j < SIMDE_BENCH_BATCH ; j++) {
+      lo[j] = simde_mm512_madd52lo_epu64(inputs[0][j], inputs[1][j], inputs[2][j]);
+      hi[j] = simde_mm512_madd52hi_epu64(inputs[0][j], inputs[1][j], inputs[2][j]);
+    }
+    SIMDE_BENCH_ESCAPE(lo);
+    SIMDE_BENCH_ESCAPE(hi);
+  }
+}
+#endif
+
+SIMDE_BENCH_LIST_BEGIN
+  SIMDE_BENCH_LIST_ENTRY(mm_madd52lo_epu64)
+  SIMDE_BENCH_LIST_ENTRY(mm256_madd52lo_epu64)
+  SIMDE_BENCH_LIST_ENTRY(mm512_madd52lo_epu64)
+  SIMDE_BENCH_LIST_ENTRY(mm512_madd52hi_epu64)
+  #if defined(SIMDE_HAVE_INT128_)
+  SIMDE_BENCH_LIST_ENTRY_TP(x_madd52_scalar)
+  SIMDE_BENCH_LIST_ENTRY_TP(x_madd52_vector)
+  #endif
+SIMDE_BENCH_LIST_END
@@ -0,0 +1,14 @@
+#include "../../bench.h"
+#include "../../../simde/x86/avx512/permutexvar.h"
+
+SIMDE_BENCH_BINARY(mm512_permutexvar_epi8, simde__m512i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm512_permutexvar_epi16, simde__m512i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm512_permutexvar_epi32, simde__m512i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm512_permutexvar_epi64, simde__m512i, SIMDE_BENCH_INIT_INT)
+
+SIMDE_BENCH_LIST_BEGIN
+  SIMDE_BENCH_LIST_ENTRY(mm512_permutexvar_epi8)
+  SIMDE_BENCH_LIST_ENTRY(mm512_permutexvar_epi16)
+  SIMDE_BENCH_LIST_ENTRY(mm512_permutexvar_epi32)
+  SIMDE_BENCH_LIST_ENTRY(mm512_permutexvar_epi64)
+SIMDE_BENCH_LIST_END
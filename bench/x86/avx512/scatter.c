@@ -0,0 +1,38 @@
+#include "../../bench.h"
+#include "../../../simde/x86/avx512/scatter.h"
+#include "../../../simde/x86/avx512/and.h"
+#include "../../../simde/x86/avx512/set1.h"
+
+/* Scatter SIMDE_BENCH_BATCH vectors into a 4 KiB table; the indices
+ * are random, so lanes regularly collide.  One "op" is one scatter. */
+#define SIMDE_BENCH_SCATTER_(name, IT, DT, init, mask_indices, scale) \
+  static void simde_bench_tp_##name (size_t iterations) { \
+    static IT vindex[SIMDE_BENCH_BATCH]; \
+    static DT a[SIMDE_BENCH_BATCH]; \
+    static uint8_t table[4096 + 64]; \
+    simde_bench_fill(vindex, sizeof(vindex), SIMDE_BENCH_INIT_INT); \
+    simde_bench_fill(a, sizeof(a), init); \
+    for (size_t j = 0 ; j < SIMDE_BENCH_BATCH ; j++) \
+      vindex[j] = mask_indices(vindex[j]); \
+    for (size_t i = 0 ; i < iterations ; i += SIMDE_BENCH_BATCH) { \
+      for (size_t j = 0 ; j < SIMDE_BENCH_BATCH ; j++) \
+        simde_##name(table, vindex[j], a[j], scale); \
+      SIMDE_BENCH_ESCAPE(table); \
+    } \
+  }
+
+#define SIMDE_BENCH_SCATTER_IDX32_(v) simde_mm512_and_si512(v, simde_mm512_set1_epi32(1023))
+#define SIMDE_BENCH_SCATTER_IDX64_(v) simde_mm512_and_si512(v, simde_mm512_set1_epi64(511))
+#define SIMDE_BENCH_SCATTER_IDX32_256_(v) simde_mm256_and_si256(v, simde_mm256_set1_epi32(511))
+
+SIMDE_BENCH_SCATTER_(mm512_i32scatter_epi32, simde__m512i, simde__m512i, SIMDE_BENCH_INIT_INT, SIMDE_BENCH_SCATTER_IDX32_, 4)
+SIMDE_BENCH_SCATTER_(mm512_i32scatter_ps, simde__m512i, simde__m512, SIMDE_BENCH_INIT_F32, SIMDE_BENCH_SCATTER_IDX32_, 4)
+SIMDE_BENCH_SCATTER_(mm512_i32scatter_pd, simde__m256i, simde__m512d, SIMDE_BENCH_INIT_F64, SIMDE_BENCH_SCATTER_IDX32_256_, 8)
+SIMDE_BENCH_SCATTER_(mm512_i64scatter_epi64, simde__m512i, simde__m512i, SIMDE_BENCH_INIT_INT, SIMDE_BENCH_SCATTER_IDX64_, 8)
+
+SIMDE_BENCH_LIST_BEGIN
+  SIMDE_BENCH_LIST_ENTRY_TP(mm512_i32scatter_epi32)
+  SIMDE_BENCH_LIST_ENTRY_TP(mm512_i32scatter_ps)
+  SIMDE_BENCH_LIST_ENTRY_TP(mm512_i32scatter_pd)
+  SIMDE_BENCH_LIST_ENTRY_TP(mm512_i64scatter_epi64)
+SIMDE_BENCH_LIST_END
@@ -0,0 +1,16 @@
+#include "../bench.h"
+#include "../../simde/x86/fma.h"
+
+SIMDE_BENCH_TERNARY(mm_fmadd_ps, simde__m128, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_TERNARY(mm_fmadd_pd, simde__m128d, SIMDE_BENCH_INIT_F64)
+SIMDE_BENCH_TERNARY(mm256_fmadd_ps, simde__m256, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_TERNARY(mm256_fmadd_pd, simde__m256d, SIMDE_BENCH_INIT_F64)
+SIMDE_BENCH_TERNARY(mm256_fnmadd_ps, simde__m256, SIMDE_BENCH_INIT_F32)
+
+SIMDE_BENCH_LIST_BEGIN
+  SIMDE_BENCH_LIST_ENTRY(mm_fmadd_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm_fmadd_pd)
+  SIMDE_BENCH_LIST_ENTRY(mm256_fmadd_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm256_fmadd_pd)
+  SIMDE_BENCH_LIST_ENTRY(mm256_fnmadd_ps)
+SIMDE_BENCH_LIST_END
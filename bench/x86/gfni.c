@@ -0,0 +1,50 @@
+#include "../bench.h"
+#include "../../simde/x86/gfni.h"
+#include "../../simde/x86/avx512/loadu.h"
+#include "../../simde/x86/avx512/storeu.h"
+
+SIMDE_BENCH_BINARY_IMM(mm_gf2p8affine_epi64_epi8, simde__m128i, SIMDE_BENCH_INIT_INT, 0x63)
+SIMDE_BENCH_BINARY_IMM(mm256_gf2p8affine_epi64_epi8, simde__m256i, SIMDE_BENCH_INIT_INT, 0x63)
+SIMDE_BENCH_BINARY_IMM(mm512_gf2p8affine_epi64_epi8, simde__m512i, SIMDE_BENCH_INIT_INT, 0x63)
+SIMDE_BENCH_BINARY_IMM(mm_gf2p8affineinv_epi64_epi8, simde__m128i, SIMDE_BENCH_INIT_INT, 0x63)
+SIMDE_BENCH_BINARY_IMM(mm512_gf2p8affineinv_epi64_epi8, simde__m512i, SIMDE_BENCH_INIT_INT, 0x63)
+SIMDE_BENCH_BINARY(mm_gf2p8mul_epi8, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm512_gf2p8mul_epi8, simde__m512i, SIMDE_BENCH_INIT_INT)
+
+/* The erasure-coding pattern: one constant matrix (i.e., multiplication
+ * by one GF(2^8) coefficient) applied to a whole buffer.  One "op" is a
+ * 4 KiB block, so bytes/cycle is 4096 / cycles_per_op. */
+#define SIMDE_BENCH_GF2P8AFFINE_BUFFER_(prefix, T, bytes, loadu, storeu) \
+  static void simde_bench_tp_##prefix##_gf2p8affine_epi64_epi8_4k (size_t iterations) { \
+    static uint8_t buf[4096]; \
+    uint64_t matrix; \
+    simde_bench_fill(buf, sizeof(buf), SIMDE_BENCH_INIT_INT); \
+    simde_bench_fill(&matrix, sizeof(matrix), SIMDE_BENCH_INIT_INT); \
+    const T A = simde_##prefix##_set1_epi64x(HEDLEY_STATIC_CAST(int64_t, matrix)); \
+    for (size_t i = 0 ; i < iterations ; i++) { \
+      for (size_t j = 0 ; j < sizeof(buf) ; j += bytes) { \
+        T x = simde_##loadu(HEDLEY_REINTERPRET_CAST(const void*, &(buf[j]))); \
+        simde_##storeu(HEDLEY_REINTERPRET_CAST(void*, &(buf[j])), simde_##prefix##_gf2p8affine_epi64_epi8(x, A, 0)); \
+      } \
+      SIMDE_BENCH_ESCAPE(buf); \
+    } \
+  }
+
+#define simde_mm512_set1_epi64x simde_mm512_set1_epi64
+SIMDE_BENCH_GF2P8AFFINE_BUFFER_(mm, simde__m128i, 16, mm_loadu_si128, mm_storeu_si128)
+SIMDE_BENCH_GF2P8AFFINE_BUFFER_(mm256, simde__m256i, 32, mm256_loadu_si256, mm256_storeu_si256)
+SIMDE_BENCH_GF2P8AFFINE_BUFFER_(mm512, simde__m512i, 64, mm512_loadu_si512, mm512_storeu_si512)
+#undef simde_mm512_set1_epi64x
+
+SIMDE_BENCH_LIST_BEGIN
+  SIMDE_BENCH_LIST_ENTRY(mm_gf2p8affine_epi64_epi8)
+  SIMDE_BENCH_LIST_ENTRY(mm256_gf2p8affine_epi64_epi8)
+  SIMDE_BENCH_LIST_ENTRY(mm512_gf2p8affine_epi64_epi8)
+  SIMDE_BENCH_LIST_ENTRY(mm_gf2p8affineinv_epi64_epi8)
+  SIMDE_BENCH_LIST_ENTRY(mm512_gf2p8affineinv_epi64_epi8)
+  SIMDE_BENCH_LIST_ENTRY(mm_gf2p8mul_epi8)
+  SIMDE_BENCH_LIST_ENTRY(mm512_gf2p8mul_epi8)
+  SIMDE_BENCH_LIST_ENTRY_TP(mm_gf2p8affine_epi64_epi8_4k)
+  SIMDE_BENCH_LIST_ENTRY_TP(mm256_gf2p8affine_epi64_epi8_4k)
+  SIMDE_BENCH_LIST_ENTRY_TP(mm512_gf2p8affine_epi64_epi8_4k)
+SIMDE_BENCH_LIST_END
@@ -0,0 +1,32 @@
+#include "../bench.h"
+#include "../../simde/x86/sse.h"
+
+SIMDE_BENCH_BINARY(mm_add_ps, simde__m128, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_BINARY(mm_mul_ps, simde__m128, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_BINARY(mm_div_ps, simde__m128, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_BINARY(mm_min_ps, simde__m128, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_BINARY(mm_max_ps, simde__m128, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_BINARY(mm_cmplt_ps, simde__m128, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_BINARY(mm_and_ps, simde__m128, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_BINARY(mm_unpacklo_ps, simde__m128, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_BINARY_IMM(mm_shuffle_ps, simde__m128, SIMDE_BENCH_INIT_F32, SIMDE_MM_SHUFFLE(0, 1, 2, 3))
+SIMDE_BENCH_UNARY(mm_sqrt_ps, simde__m128, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_UNARY(mm_rcp_ps, simde__m128, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_UNARY(mm_rsqrt_ps, simde__m128, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_REDUCE(mm_movemask_ps, int, simde__m128, SIMDE_BENCH_INIT_F32)
+
+SIMDE_BENCH_LIST_BEGIN
+  SIMDE_BENCH_LIST_ENTRY(mm_add_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm_mul_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm_div_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm_min_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm_max_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm_cmplt_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm_and_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm_unpacklo_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm_shuffle_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm_sqrt_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm_rcp_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm_rsqrt_ps)
+  SIMDE_BENCH_LIST_ENTRY_TP(mm_movemask_ps)
+SIMDE_BENCH_LIST_END
@@ -0,0 +1,68 @@
+#include "../bench.h"
+#include "../../simde/x86/sse2.h"
+
+SIMDE_BENCH_BINARY(mm_add_epi8, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm_add_epi16, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm_add_epi32, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm_add_epi64, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm_adds_epi16, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm_avg_epu8, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm_cmpeq_epi8, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm_cmpgt_epi32, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm_madd_epi16, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm_max_epi16, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm_min_epu8, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm_mul_epu32, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm_mulhi_epi16, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm_mullo_epi16, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm_packs_epi32, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm_packus_epi16, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm_sad_epu8, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm_sub_epi32, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm_unpacklo_epi8, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm_xor_si128, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_UNARY_IMM(mm_shuffle_epi32, simde__m128i, SIMDE_BENCH_INIT_INT, SIMDE_MM_SHUFFLE(0, 1, 2, 3))
+SIMDE_BENCH_UNARY_IMM(mm_slli_epi32, simde__m128i, SIMDE_BENCH_INIT_INT, 3)
+SIMDE_BENCH_UNARY_IMM(mm_srai_epi16, simde__m128i, SIMDE_BENCH_INIT_INT, 3)
+SIMDE_BENCH_UNARY_IMM(mm_srli_si128, simde__m128i, SIMDE_BENCH_INIT_INT, 3)
+SIMDE_BENCH_REDUCE(mm_movemask_epi8, int, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_REDUCE(mm_cvtepi32_ps, simde__m128, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_REDUCE(mm_cvtps_epi32, simde__m128i, simde__m128, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_BINARY(mm_add_pd, simde__m128d, SIMDE_BENCH_INIT_F64)
+SIMDE_BENCH_BINARY(mm_mul_pd, simde__m128d, SIMDE_BENCH_INIT_F64)
+SIMDE_BENCH_BINARY(mm_div_pd, simde__m128d, SIMDE_BENCH_INIT_F64)
+SIMDE_BENCH_UNARY(mm_sqrt_pd, simde__m128d, SIMDE_BENCH_INIT_F64)
+
+SIMDE_BENCH_LIST_BEGIN
+  SIMDE_BENCH_LIST_ENTRY(mm_add_epi8)
+  SIMDE_BENCH_LIST_ENTRY(mm_add_epi16)
+  SIMDE_BENCH_LIST_ENTRY(mm_add_epi32)
+  SIMDE_BENCH_LIST_ENTRY(mm_add_epi64)
+  SIMDE_BENCH_LIST_ENTRY(mm_adds_epi16)
+  SIMDE_BENCH_LIST_ENTRY(mm_avg_epu8)
+  SIMDE_BENCH_LIST_ENTRY(mm_cmpeq_epi8)
+  SIMDE_BENCH_LIST_ENTRY(mm_cmpgt_epi32)
+  SIMDE_BENCH_LIST_ENTRY(mm_madd_epi16)
+  SIMDE_BENCH_LIST_ENTRY(mm_max_epi16)
+  SIMDE_BENCH_LIST_ENTRY(mm_min_epu8)
+  SIMDE_BENCH_LIST_ENTRY(mm_mul_epu32)
+  SIMDE_BENCH_LIST_ENTRY(mm_mulhi_epi16)
+  SIMDE_BENCH_LIST_ENTRY(mm_mullo_epi16)
+  SIMDE_BENCH_LIST_ENTRY(mm_packs_epi32)
+  SIMDE_BENCH_LIST_ENTRY(mm_packus_epi16)
+  SIMDE_BENCH_LIST_ENTRY(mm_sad_epu8)
+  SIMDE_BENCH_LIST_ENTRY(mm_sub_epi32)
+  SIMDE_BENCH_LIST_ENTRY(mm_unpacklo_epi8)
+  SIMDE_BENCH_LIST_ENTRY(mm_xor_si128)
+  SIMDE_BENCH_LIST_ENTRY(mm_shuffle_epi32)
+  SIMDE_BENCH_LIST_ENTRY(mm_slli_epi32)
+  SIMDE_BENCH_LIST_ENTRY(mm_srai_epi16)
+  SIMDE_BENCH_LIST_ENTRY(mm_srli_si128)
+  SIMDE_BENCH_LIST_ENTRY_TP(mm_movemask_epi8)
+  SIMDE_BENCH_LIST_ENTRY_TP(mm_cvtepi32_ps)
+  SIMDE_BENCH_LIST_ENTRY_TP(mm_cvtps_epi32)
+  SIMDE_BENCH_LIST_ENTRY(mm_add_pd)
+  SIMDE_BENCH_LIST_ENTRY(mm_mul_pd)
+  SIMDE_BENCH_LIST_ENTRY(mm_div_pd)
+  SIMDE_BENCH_LIST_ENTRY(mm_sqrt_pd)
+SIMDE_BENCH_LIST_END
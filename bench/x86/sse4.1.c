@@ -0,0 +1,26 @@
+#include "../bench.h"
+#include "../../simde/x86/sse4.1.h"
+
+SIMDE_BENCH_TERNARY(mm_blendv_epi8, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_TERNARY(mm_blendv_ps, simde__m128, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_BINARY(mm_mullo_epi32, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm_min_epi32, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm_max_epu32, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm_packus_epi32, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY_IMM(mm_dp_ps, simde__m128, SIMDE_BENCH_INIT_F32, 0xff)
+SIMDE_BENCH_UNARY(mm_cvtepu8_epi16, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_UNARY(mm_floor_ps, simde__m128, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_UNARY_IMM(mm_round_ps, simde__m128, SIMDE_BENCH_INIT_F32, SIMDE_MM_FROUND_TO_NEAREST_INT)
+
+SIMDE_BENCH_LIST_BEGIN
+  SIMDE_BENCH_LIST_ENTRY(mm_blendv_epi8)
+  SIMDE_BENCH_LIST_ENTRY(mm_blendv_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm_mullo_epi32)
+  SIMDE_BENCH_LIST_ENTRY(mm_min_epi32)
+  SIMDE_BENCH_LIST_ENTRY(mm_max_epu32)
+  SIMDE_BENCH_LIST_ENTRY(mm_packus_epi32)
+  SIMDE_BENCH_LIST_ENTRY(mm_dp_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm_cvtepu8_epi16)
+  SIMDE_BENCH_LIST_ENTRY(mm_floor_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm_round_ps)
+SIMDE_BENCH_LIST_END
@@ -0,0 +1,70 @@
+#include "../bench.h"
+#include "../../simde/x86/sse4.2.h"
+
+SIMDE_BENCH_BINARY(mm_cmpgt_epi64, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY_IMM(mm_cmpistrm, simde__m128i, SIMDE_BENCH_INIT_INT,
+  SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_UNIT_MASK)
+
+/* Delimiter scan over a 4 KiB block with cmpistri, the way a tokenizer
+ * would use it; one "op" is the whole block. */
+static void simde_bench_tp_x_cmpistri_scan (size_t iterations) {
+  static uint8_t buf[4096];
+  const simde__m128i delims = simde_mm_setr_epi8(',', ';', ':', '"', '{', '}', '[', ']', 0, 0, 0, 0, 0, 0, 0, 0);
+  int found = 0;
+  simde_bench_fill(buf, sizeof(buf), SIMDE_BENCH_INIT_INT);
+  for (size_t i = 0 ; i < iterations ; i++) {
+    for (size_t off = 0 ; off < sizeof(buf) ; off += 16) {
+      simde__m128i b = simde_mm_loadu_si128(&(buf[off]));
+      found += simde_mm_cmpistri(delims, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY);
+    }
+    SIMDE_BENCH_ESCAPE(&found);
+  }
+}
+
+/* The CRC functions are scalar; latency is the interesting number
+ * since each call depends on the previous CRC. */
+#define SIMDE_BENCH_CRC32_(width) \
+  static void simde_bench_tp_mm_crc32_u##width (size_t iterations) { \
+    static uint##width##_t v[SIMDE_BENCH_BATCH]; \
+    uint32_t r[SIMDE_BENCH_BATCH]; \
+    simde_bench_fill(v, sizeof(v), SIMDE_BENCH_INIT_INT); \
+    for (size_t i = 0 ; i < iterations ; i += SIMDE_BENCH_BATCH) { \
+      for (size_t j = 0 ; j < SIMDE_BENCH_BATCH ; j++) \
+        r[j] = HEDLEY_STATIC_CAST(uint32_t, simde_mm_crc32_u##width(HEDLEY_STATIC_CAST(uint32_t, j), v[j])); \
+      SIMDE_BENCH_ESCAPE(r); \
+    } \
+  } \
+  static void simde_bench_lat_mm_crc32_u##width (size_t iterations) { \
+    static uint##width##_t v[SIMDE_BENCH_BATCH]; \
+    uint32_t crc = 0; \
+    simde_bench_fill(v, sizeof(v), SIMDE_BENCH_INIT_INT); \
+    for (size_t i = 0 ; i < iterations ; i++) \
+      crc = HEDLEY_STATIC_CAST(uint32_t, simde_mm_crc32_u##width(crc, v[i % SIMDE_BENCH_BATCH])); \
+    SIMDE_BENCH_ESCAPE(&crc); \
+  }
+
+SIMDE_BENCH_CRC32_(8)
+SIMDE_BENCH_CRC32_(16)
+SIMDE_BENCH_CRC32_(32)
+SIMDE_BENCH_CRC32_(64)
+
+/* Whole-buffer CRC-32C; one "op" is a 4 KiB block. */
+static void simde_bench_tp_x_crc32c_buffer (size_t iterations) {
+  static uint8_t buf[4096];
+  uint32_t crc = ~UINT32_C(0);
+  simde_bench_fill(buf, sizeof(buf), SIMDE_BENCH_INIT_INT);
+  for (size_t i = 0 ; i < iterations ; i++)
+    crc = simde_x_crc32c_buffer(crc, buf, sizeof(buf));
+  SIMDE_BENCH_ESCAPE(&crc);
+}
+
+SIMDE_BENCH_LIST_BEGIN
+  SIMDE_BENCH_LIST_ENTRY(mm_cmpgt_epi64)
+  SIMDE_BENCH_LIST_ENTRY(mm_cmpistrm)
+  SIMDE_BENCH_LIST_ENTRY_TP(x_cmpistri_scan)
+  SIMDE_BENCH_LIST_ENTRY(mm_crc32_u8)
+  SIMDE_BENCH_LIST_ENTRY(mm_crc32_u16)
+  SIMDE_BENCH_LIST_ENTRY(mm_crc32_u32)
+  SIMDE_BENCH_LIST_ENTRY(mm_crc32_u64)
+  SIMDE_BENCH_LIST_ENTRY_TP(x_crc32c_buffer)
+SIMDE_BENCH_LIST_END
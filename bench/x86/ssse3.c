@@ -0,0 +1,20 @@
+#include "../bench.h"
+#include "../../simde/x86/ssse3.h"
+
+SIMDE_BENCH_BINARY(mm_shuffle_epi8, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm_hadd_epi16, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm_maddubs_epi16, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm_mulhrs_epi16, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY(mm_sign_epi16, simde__m128i, SIMDE_BENCH_INIT_INT)
+SIMDE_BENCH_BINARY_IMM(mm_alignr_epi8, simde__m128i, SIMDE_BENCH_INIT_INT, 5)
+SIMDE_BENCH_UNARY(mm_abs_epi8, simde__m128i, SIMDE_BENCH_INIT_INT)
+
+SIMDE_BENCH_LIST_BEGIN
+  SIMDE_BENCH_LIST_ENTRY(mm_shuffle_epi8)
+  SIMDE_BENCH_LIST_ENTRY(mm_hadd_epi16)
+  SIMDE_BENCH_LIST_ENTRY(mm_maddubs_epi16)
+  SIMDE_BENCH_LIST_ENTRY(mm_mulhrs_epi16)
+  SIMDE_BENCH_LIST_ENTRY(mm_sign_epi16)
+  SIMDE_BENCH_LIST_ENTRY(mm_alignr_epi8)
+  SIMDE_BENCH_LIST_ENTRY(mm_abs_epi8)
+SIMDE_BENCH_LIST_END
@@ -0,0 +1,38 @@
+#include "../bench.h"
+#include "../../simde/x86/svml.h"
+
+SIMDE_BENCH_UNARY(mm_exp_ps, simde__m128, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_UNARY(mm_log_ps, simde__m128, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_UNARY(mm_sin_ps, simde__m128, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_UNARY(mm_cos_ps, simde__m128, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_UNARY(mm_tan_ps, simde__m128, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_UNARY(mm_cbrt_ps, simde__m128, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_UNARY(mm_erf_ps, simde__m128, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_BINARY(mm_pow_ps, simde__m128, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_UNARY(mm256_exp_ps, simde__m256, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_UNARY(mm256_log_ps, simde__m256, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_UNARY(mm256_sin_ps, simde__m256, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_UNARY(mm512_exp_ps, simde__m512, SIMDE_BENCH_INIT_F32)
+SIMDE_BENCH_UNARY(mm512_log_pd, simde__m512d, SIMDE_BENCH_INIT_F64)
+SIMDE_BENCH_UNARY(mm_exp_pd, simde__m128d, SIMDE_BENCH_INIT_F64)
+SIMDE_BENCH_UNARY(mm_log_pd, simde__m128d, SIMDE_BENCH_INIT_F64)
+SIMDE_BENCH_UNARY(mm_sin_pd, simde__m128d, SIMDE_BENCH_INIT_F64)
+
+SIMDE_BENCH_LIST_BEGIN
+  SIMDE_BENCH_LIST_ENTRY(mm_exp_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm_log_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm_sin_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm_cos_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm_tan_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm_cbrt_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm_erf_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm_pow_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm256_exp_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm256_log_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm256_sin_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm512_exp_ps)
+  SIMDE_BENCH_LIST_ENTRY(mm512_log_pd)
+  SIMDE_BENCH_LIST_ENTRY(mm_exp_pd)
+  SIMDE_BENCH_LIST_ENTRY(mm_log_pd)
+  SIMDE_BENCH_LIST_ENTRY(mm_sin_pd)
+SIMDE_BENCH_LIST_END
@@ -49,6 +49,9 @@
 #include "neon/aes.h"
 #include "neon/and.h"
 #include "neon/bcax.h"
+#include "neon/bfdot.h"
+#include "neon/bfmlal.h"
+#include "neon/bfmmla.h"
 #include "neon/bic.h"
 #include "neon/bsl.h"
 #include "neon/cadd_rot270.h"
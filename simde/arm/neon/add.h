@@ -111,6 +111,8 @@ simde_float32x2_t
 simde_vadd_f32(simde_float32x2_t a, simde_float32x2_t b) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vadd_f32(a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_float32x2_from_m128(_mm_add_ps(simde_float32x2_to_m128(a), simde_float32x2_to_m128(b)));
   #else
     simde_float32x2_private
       r_,
@@ -141,6 +143,8 @@ simde_float64x1_t
 simde_vadd_f64(simde_float64x1_t a, simde_float64x1_t b) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     return vadd_f64(a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_float64x1_from_m128d(_mm_add_sd(simde_float64x1_to_m128d(a), simde_float64x1_to_m128d(b)));
   #else
     simde_float64x1_private
       r_,
@@ -171,6 +175,8 @@ simde_int8x8_t
 simde_vadd_s8(simde_int8x8_t a, simde_int8x8_t b) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vadd_s8(a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_int8x8_from_m128i(_mm_add_epi8(simde_int8x8_to_m128i(a), simde_int8x8_to_m128i(b)));
   #else
     simde_int8x8_private
       r_,
@@ -181,8 +187,6 @@ simde_vadd_s8(simde_int8x8_t a, simde_int8x8_t b) {
       r_.sv64 = __riscv_vadd_vv_i8m1(a_.sv64, b_.sv64, 8);
     #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
       r_.values = a_.values + b_.values;
-    #elif defined(SIMDE_X86_MMX_NATIVE)
-      r_.m64 = _mm_add_pi8(a_.m64, b_.m64);
     #else
       SIMDE_VECTORIZE
       for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
@@ -203,6 +207,8 @@ simde_int16x4_t
 simde_vadd_s16(simde_int16x4_t a, simde_int16x4_t b) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vadd_s16(a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_int16x4_from_m128i(_mm_add_epi16(simde_int16x4_to_m128i(a), simde_int16x4_to_m128i(b)));
   #else
     simde_int16x4_private
       r_,
@@ -213,8 +219,6 @@ simde_vadd_s16(simde_int16x4_t a, simde_int16x4_t b) {
       r_.sv64 = __riscv_vadd_vv_i16m1(a_.sv64, b_.sv64, 4);
     #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
       r_.values = a_.values + b_.values;
-    #elif defined(SIMDE_X86_MMX_NATIVE)
-      r_.m64 = _mm_add_pi16(a_.m64, b_.m64);
     #else
       SIMDE_VECTORIZE
       for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
@@ -235,6 +239,8 @@ simde_int32x2_t
 simde_vadd_s32(simde_int32x2_t a, simde_int32x2_t b) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vadd_s32(a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_int32x2_from_m128i(_mm_add_epi32(simde_int32x2_to_m128i(a), simde_int32x2_to_m128i(b)));
   #else
     simde_int32x2_private
       r_,
@@ -245,8 +251,6 @@ simde_vadd_s32(simde_int32x2_t a, simde_int32x2_t b) {
       r_.sv64 = __riscv_vadd_vv_i32m1(a_.sv64, b_.sv64, 2);
     #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
       r_.values = a_.values + b_.values;
-    #elif defined(SIMDE_X86_MMX_NATIVE)
-      r_.m64 = _mm_add_pi32(a_.m64, b_.m64);
     #else
       SIMDE_VECTORIZE
       for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
@@ -267,6 +271,8 @@ simde_int64x1_t
 simde_vadd_s64(simde_int64x1_t a, simde_int64x1_t b) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vadd_s64(a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_int64x1_from_m128i(_mm_add_epi64(simde_int64x1_to_m128i(a), simde_int64x1_to_m128i(b)));
   #else
     simde_int64x1_private
       r_,
@@ -297,6 +303,8 @@ simde_uint8x8_t
 simde_vadd_u8(simde_uint8x8_t a, simde_uint8x8_t b) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vadd_u8(a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_uint8x8_from_m128i(_mm_add_epi8(simde_uint8x8_to_m128i(a), simde_uint8x8_to_m128i(b)));
   #else
     simde_uint8x8_private
       r_,
@@ -327,6 +335,8 @@ simde_uint16x4_t
 simde_vadd_u16(simde_uint16x4_t a, simde_uint16x4_t b) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vadd_u16(a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_uint16x4_from_m128i(_mm_add_epi16(simde_uint16x4_to_m128i(a), simde_uint16x4_to_m128i(b)));
   #else
     simde_uint16x4_private
       r_,
@@ -358,6 +368,8 @@ simde_uint32x2_t
 simde_vadd_u32(simde_uint32x2_t a, simde_uint32x2_t b) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vadd_u32(a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_uint32x2_from_m128i(_mm_add_epi32(simde_uint32x2_to_m128i(a), simde_uint32x2_to_m128i(b)));
   #else
     simde_uint32x2_private
       r_,
@@ -388,6 +400,8 @@ simde_uint64x1_t
 simde_vadd_u64(simde_uint64x1_t a, simde_uint64x1_t b) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vadd_u64(a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_uint64x1_from_m128i(_mm_add_epi64(simde_uint64x1_to_m128i(a), simde_uint64x1_to_m128i(b)));
   #else
     simde_uint64x1_private
       r_,
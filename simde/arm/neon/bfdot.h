@@ -0,0 +1,219 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* BF16 dot products: each 32-bit lane of the result accumulates the
+ * products of the two bf16 elements in the same lane of a and b.
+ *
+ * Products of two bf16 values are exact in binary32, so the portable
+ * version only needs to widen (a shift or a mask of each 32-bit lane)
+ * and then multiply-add.  It sums the pair before adding it to the
+ * accumulator, like BFDOT, but rounds to nearest-even and keeps
+ * denormals, where BFDOT may round to odd and flush them; results can
+ * differ in the last bit.  On x86 with AVX512_BF16 this is VDPBF16PS,
+ * which adds the odd product first and flushes denormals. */
+
+#if !defined(SIMDE_ARM_NEON_BFDOT_H)
+#define SIMDE_ARM_NEON_BFDOT_H
+
+#include "types.h"
+#include "add.h"
+#include "and.h"
+#include "dup_n.h"
+#include "fma.h"
+#include "mul.h"
+#include "reinterpret.h"
+#include "shl_n.h"
+
+#if defined(SIMDE_X86_AVX512BF16_NATIVE)
+  #include "../../x86/avx512/cast.h"
+  #include "../../x86/avx512/dpbf16.h"
+#endif
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* The bottom (even) and top (odd) bf16 element of each 32-bit lane,
+ * widened to binary32. */
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x2_t
+simde_x_vbfb_f32(simde_bfloat16x4_t a) {
+  return simde_vreinterpret_f32_u32(simde_vshl_n_u32(simde_vreinterpret_u32_bf16(a), 16));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x2_t
+simde_x_vbft_f32(simde_bfloat16x4_t a) {
+  return simde_vreinterpret_f32_u32(simde_vand_u32(simde_vreinterpret_u32_bf16(a), simde_vdup_n_u32(UINT32_C(0xFFFF0000))));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x4_t
+simde_x_vbfbq_f32(simde_bfloat16x8_t a) {
+  return simde_vreinterpretq_f32_u32(simde_vshlq_n_u32(simde_vreinterpretq_u32_bf16(a), 16));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x4_t
+simde_x_vbftq_f32(simde_bfloat16x8_t a) {
+  return simde_vreinterpretq_f32_u32(simde_vandq_u32(simde_vreinterpretq_u32_bf16(a), simde_vdupq_n_u32(UINT32_C(0xFFFF0000))));
+}
+
+#if defined(SIMDE_X86_AVX512BF16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  SIMDE_FUNCTION_ATTRIBUTES
+  __m128
+  simde_x_vbfdot_x86_(__m128 r, __m128i a, __m128i b) {
+    return simde_mm_dpbf16_ps(r, simde_x_mm_castsi128_pbh(a), simde_x_mm_castsi128_pbh(b));
+  }
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x2_t
+simde_vbfdot_f32(simde_float32x2_t r, simde_bfloat16x4_t a, simde_bfloat16x4_t b) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARM_NEON_BF16)
+    return vbfdot_f32(r, a, b);
+  #elif defined(SIMDE_X86_AVX512BF16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return simde_float32x2_from_m128(simde_x_vbfdot_x86_(simde_float32x2_to_m128(r), simde_bfloat16x4_to_m128i(a), simde_bfloat16x4_to_m128i(b)));
+  #else
+    return
+      simde_vadd_f32(
+        r,
+        simde_vfma_f32(
+          simde_vmul_f32(simde_x_vbfb_f32(a), simde_x_vbfb_f32(b)),
+          simde_x_vbft_f32(a), simde_x_vbft_f32(b)
+        )
+      );
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vbfdot_f32
+  #define vbfdot_f32(r, a, b) simde_vbfdot_f32((r), (a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x4_t
+simde_vbfdotq_f32(simde_float32x4_t r, simde_bfloat16x8_t a, simde_bfloat16x8_t b) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARM_NEON_BF16)
+    return vbfdotq_f32(r, a, b);
+  #elif defined(SIMDE_X86_AVX512BF16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return simde_float32x4_from_m128(simde_x_vbfdot_x86_(simde_float32x4_to_m128(r), simde_bfloat16x8_to_m128i(a), simde_bfloat16x8_to_m128i(b)));
+  #else
+    return
+      simde_vaddq_f32(
+        r,
+        simde_vfmaq_f32(
+          simde_vmulq_f32(simde_x_vbfbq_f32(a), simde_x_vbfbq_f32(b)),
+          simde_x_vbftq_f32(a), simde_x_vbftq_f32(b)
+        )
+      );
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vbfdotq_f32
+  #define vbfdotq_f32(r, a, b) simde_vbfdotq_f32((r), (a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x2_t
+simde_vbfdot_lane_f32(simde_float32x2_t r, simde_bfloat16x4_t a, simde_bfloat16x4_t b, const int lane)
+    SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 1) {
+  simde_float32x2_t result;
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARM_NEON_BF16)
+    SIMDE_CONSTIFY_2_(vbfdot_lane_f32, result, (HEDLEY_UNREACHABLE(), result), lane, r, a, b);
+  #else
+    simde_bfloat16x4_private b_ = simde_bfloat16x4_to_private(b);
+    uint32_t b_lane;
+    simde_memcpy(&b_lane, &(b_.values[lane * 2]), sizeof(b_lane));
+    result = simde_vbfdot_f32(r, a, simde_vreinterpret_bf16_u32(simde_vdup_n_u32(b_lane)));
+  #endif
+  return result;
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vbfdot_lane_f32
+  #define vbfdot_lane_f32(r, a, b, lane) simde_vbfdot_lane_f32((r), (a), (b), (lane))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x4_t
+simde_vbfdotq_lane_f32(simde_float32x4_t r, simde_bfloat16x8_t a, simde_bfloat16x4_t b, const int lane)
+    SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 1) {
+  simde_float32x4_t result;
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARM_NEON_BF16)
+    SIMDE_CONSTIFY_2_(vbfdotq_lane_f32, result, (HEDLEY_UNREACHABLE(), result), lane, r, a, b);
+  #else
+    simde_bfloat16x4_private b_ = simde_bfloat16x4_to_private(b);
+    uint32_t b_lane;
+    simde_memcpy(&b_lane, &(b_.values[lane * 2]), sizeof(b_lane));
+    result = simde_vbfdotq_f32(r, a, simde_vreinterpretq_bf16_u32(simde_vdupq_n_u32(b_lane)));
+  #endif
+  return result;
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vbfdotq_lane_f32
+  #define vbfdotq_lane_f32(r, a, b, lane) simde_vbfdotq_lane_f32((r), (a), (b), (lane))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x2_t
+simde_vbfdot_laneq_f32(simde_float32x2_t r, simde_bfloat16x4_t a, simde_bfloat16x8_t b, const int lane)
+    SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 3) {
+  simde_float32x2_t result;
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARM_NEON_BF16)
+    SIMDE_CONSTIFY_4_(vbfdot_laneq_f32, result, (HEDLEY_UNREACHABLE(), result), lane, r, a, b);
+  #else
+    simde_bfloat16x8_private b_ = simde_bfloat16x8_to_private(b);
+    uint32_t b_lane;
+    simde_memcpy(&b_lane, &(b_.values[lane * 2]), sizeof(b_lane));
+    result = simde_vbfdot_f32(r, a, simde_vreinterpret_bf16_u32(simde_vdup_n_u32(b_lane)));
+  #endif
+  return result;
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vbfdot_laneq_f32
+  #define vbfdot_laneq_f32(r, a, b, lane) simde_vbfdot_laneq_f32((r), (a), (b), (lane))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x4_t
+simde_vbfdotq_laneq_f32(simde_float32x4_t r, simde_bfloat16x8_t a, simde_bfloat16x8_t b, const int lane)
+    SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 3) {
+  simde_float32x4_t result;
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARM_NEON_BF16)
+    SIMDE_CONSTIFY_4_(vbfdotq_laneq_f32, result, (HEDLEY_UNREACHABLE(), result), lane, r, a, b);
+  #else
+    simde_bfloat16x8_private b_ = simde_bfloat16x8_to_private(b);
+    uint32_t b_lane;
+    simde_memcpy(&b_lane, &(b_.values[lane * 2]), sizeof(b_lane));
+    result = simde_vbfdotq_f32(r, a, simde_vreinterpretq_bf16_u32(simde_vdupq_n_u32(b_lane)));
+  #endif
+  return result;
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vbfdotq_laneq_f32
+  #define vbfdotq_laneq_f32(r, a, b, lane) simde_vbfdotq_laneq_f32((r), (a), (b), (lane))
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_ARM_NEON_BFDOT_H) */
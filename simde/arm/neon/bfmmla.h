@@ -0,0 +1,80 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* BF16 matrix multiply-accumulate: r is a row-major 2x2 matrix, a is
+ * 2x4 and b is 4x2 stored column-major, so each result element is a
+ * four-term dot product of a row of a and a column of b.  Like BFMMLA
+ * that is done as two BFDOT steps, one for each pair of bf16 elements
+ * (see bfdot.h for the rounding caveats). */
+
+#if !defined(SIMDE_ARM_NEON_BFMMLA_H)
+#define SIMDE_ARM_NEON_BFMMLA_H
+
+#include "types.h"
+#include "bfdot.h"
+#include "reinterpret.h"
+#include "trn1.h"
+#include "trn2.h"
+#include "uzp1.h"
+#include "uzp2.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x4_t
+simde_vbfmmlaq_f32(simde_float32x4_t r, simde_bfloat16x8_t a, simde_bfloat16x8_t b) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARM_NEON_BF16)
+    return vbfmmlaq_f32(r, a, b);
+  #elif defined(SIMDE_X86_AVX512BF16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    const __m128i
+      a_ = simde_bfloat16x8_to_m128i(a),
+      b_ = simde_bfloat16x8_to_m128i(b);
+    __m128 r_ = simde_float32x4_to_m128(r);
+
+    r_ = simde_x_vbfdot_x86_(r_, _mm_shuffle_epi32(a_, _MM_SHUFFLE(2, 2, 0, 0)), _mm_shuffle_epi32(b_, _MM_SHUFFLE(2, 0, 2, 0)));
+    r_ = simde_x_vbfdot_x86_(r_, _mm_shuffle_epi32(a_, _MM_SHUFFLE(3, 3, 1, 1)), _mm_shuffle_epi32(b_, _MM_SHUFFLE(3, 1, 3, 1)));
+    return simde_float32x4_from_m128(r_);
+  #else
+    /* Lanes 0 and 1 of a are its first row and lanes 2 and 3 the
+     * second, likewise for the columns of b; spread them so that lane
+     * i * 2 + j pairs row i with column j. */
+    const simde_uint32x4_t
+      a_ = simde_vreinterpretq_u32_bf16(a),
+      b_ = simde_vreinterpretq_u32_bf16(b);
+
+    r = simde_vbfdotq_f32(r, simde_vreinterpretq_bf16_u32(simde_vtrn1q_u32(a_, a_)), simde_vreinterpretq_bf16_u32(simde_vuzp1q_u32(b_, b_)));
+    r = simde_vbfdotq_f32(r, simde_vreinterpretq_bf16_u32(simde_vtrn2q_u32(a_, a_)), simde_vreinterpretq_bf16_u32(simde_vuzp2q_u32(b_, b_)));
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vbfmmlaq_f32
+  #define vbfmmlaq_f32(r, a, b) simde_vbfmmlaq_f32((r), (a), (b))
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_ARM_NEON_BFMMLA_H) */
@@ -28,11 +28,14 @@
 #define SIMDE_ARM_NEON_CRC32_H
 
 #include "types.h"
+#include "../../simde-crc32.h"
 
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
 SIMDE_BEGIN_DECLS_
 
+/* No longer used by the functions below (see simde-crc32.h), but kept
+ * for code which calls them directly. */
 SIMDE_FUNCTION_ATTRIBUTES
 uint64_t simde_crc32_reverseBits(uint64_t num, int num_of_bits)
 {
@@ -58,19 +61,7 @@ simde___crc32b(uint32_t a, uint8_t b) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_ACLE)
     return __crc32b(a, b);
   #else
-    uint32_t r_acc = HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(a, 32));
-    uint32_t r_val = HEDLEY_STATIC_CAST(uint32_t, (simde_crc32_reverseBits(b, 8) << 24));
-    uint32_t head = r_acc ^ r_val;
-    uint32_t tail = 0;
-    const uint32_t poly = 0x04C11DB7;
-    for(int i = 31; i >= 24; --i) {
-      if ((head>>i) & 1) {
-        head = simde_crc32_eor_mask(head, poly >> (32-i), (1u << (i)) - 1);
-        tail = simde_crc32_eor_mask(tail, poly << i, 0xFFFFFFFF);
-      }
-    }
-    uint32_t result = ((head & 0x00FFFFFF) << 8) | ((tail & 0xFF000000) >> 24);
-    return HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(result, 32));
+    return simde_x_crc32_u8(a, b);
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
@@ -84,19 +75,7 @@ simde___crc32h(uint32_t a, uint16_t b) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_ACLE)
     return __crc32h(a, b);
   #else
-    uint32_t r_acc = HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(a, 32));
-    uint32_t r_val = HEDLEY_STATIC_CAST(uint32_t, (simde_crc32_reverseBits(b, 16) << 16));
-    uint32_t head = r_acc ^ r_val;
-    uint32_t tail = 0;
-    const uint32_t poly = 0x04C11DB7;
-    for(int i = 31; i >= 16; --i) {
-      if ((head>>i) & 1) {
-        head = simde_crc32_eor_mask(head, poly >> (32-i), (1u << (i)) - 1);
-        tail = simde_crc32_eor_mask(tail, poly << i, 0xFFFFFFFF);
-      }
-    }
-    uint32_t result = ((head & 0x0000FFFF) << 16) | ((tail & 0xFFFF0000) >> 16);
-    return HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(result, 32));
+    return simde_x_crc32_u16(a, b);
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
@@ -110,18 +89,7 @@ simde___crc32w(uint32_t a, uint32_t b) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_ACLE)
     return __crc32w(a, b);
   #else
-    uint32_t r_acc = HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(a, 32));
-    uint32_t r_val = HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(b, 32));
-    uint32_t head = r_acc ^ r_val;
-    uint32_t tail = 0;
-    const uint32_t poly = 0x04C11DB7;
-    for(int i = 31; i >= 0; --i) {
-      if ((head>>i) & 1) {
-        head = simde_crc32_eor_mask(head, poly >> (32-i), (1u << (i)) - 1);
-        tail = simde_crc32_eor_mask(tail, poly << i, 0xFFFFFFFF);
-      }
-    }
-    return HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(tail, 32));
+    return simde_x_crc32_u32(a, b);
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
@@ -135,28 +103,7 @@ simde___crc32d(uint32_t a, uint64_t b) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_ACLE)
     return __crc32d(a, b);
   #else
-    uint32_t r_acc = HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(a, 32));
-    uint64_t r_val = simde_crc32_reverseBits(b, 64);
-    uint32_t val_head = HEDLEY_STATIC_CAST(uint32_t, r_val >> 32);
-    uint32_t val_mid = HEDLEY_STATIC_CAST(uint32_t, r_val & 0x00000000FFFFFFFF);
-    uint32_t head = r_acc ^ val_head;
-    uint32_t mid = 0u ^ val_mid;
-    uint32_t tail = 0u;
-    const uint32_t poly = 0x04C11DB7;
-    for(int i = 31; i >= 0; --i) {
-      if ((head>>i) & 1) {
-        head = simde_crc32_eor_mask(head, poly >> (32-i), (1u << (i)) - 1);
-        mid = simde_crc32_eor_mask(mid, poly << i, 0xFFFFFFFF);
-        tail = simde_crc32_eor_mask(tail, 0x0, 0xFFFFFFFF);
-      }
-    }
-    for(int i = 31; i >= 0; --i) {
-      if ((mid>>i) & 1) {
-        mid = simde_crc32_eor_mask(mid, poly >> (32-i), (1u << (i)) - 1);
-        tail = simde_crc32_eor_mask(tail, poly << i, 0xFFFFFFFF);
-      }
-    }
-    return HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(tail, 32));
+    return simde_x_crc32_u64(a, b);
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
@@ -170,19 +117,7 @@ simde___crc32cb(uint32_t a, uint8_t b) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_ACLE)
     return __crc32cb(a, b);
   #else
-    uint32_t r_acc = HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(a, 32));
-    uint32_t r_val = HEDLEY_STATIC_CAST(uint32_t, (simde_crc32_reverseBits(b, 8) << 24));
-    uint32_t head = r_acc ^ r_val;
-    uint32_t tail = 0;
-    const uint32_t poly = 0x1EDC6F41;
-    for(int i = 31; i >= 24; --i) {
-      if ((head>>i) & 1) {
-        head = simde_crc32_eor_mask(head, poly >> (32-i), (1u << (i)) - 1);
-        tail = simde_crc32_eor_mask(tail, poly << i, 0xFFFFFFFF);
-      }
-    }
-    uint32_t result = ((head & 0x00FFFFFF) << 8) | ((tail & 0xFF000000) >> 24);
-    return HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(result, 32));
+    return simde_x_crc32c_u8(a, b);
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
@@ -196,19 +131,7 @@ simde___crc32ch(uint32_t a, uint16_t b) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_ACLE)
     return __crc32ch(a, b);
   #else
-    uint32_t r_acc = HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(a, 32));
-    uint32_t r_val = HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(b, 16) << 16);
-    uint32_t head = r_acc ^ r_val;
-    uint32_t tail = 0;
-    const uint32_t poly = 0x1EDC6F41;
-    for(int i = 31; i >= 16; --i) {
-      if ((head>>i) & 1) {
-        head = simde_crc32_eor_mask(head, poly >> (32-i), (1u << (i)) - 1);
-        tail = simde_crc32_eor_mask(tail, poly << i, 0xFFFFFFFF);
-      }
-    }
-    uint32_t result = ((head & 0x0000FFFF) << 16) | ((tail & 0xFFFF0000) >> 16);
-    return HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(result, 32));
+    return simde_x_crc32c_u16(a, b);
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
@@ -222,18 +145,7 @@ simde___crc32cw(uint32_t a, uint32_t b) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_ACLE)
     return __crc32cw(a, b);
   #else
-    uint32_t r_acc = HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(a, 32));
-    uint32_t r_val = HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(b, 32));
-    uint32_t head = r_acc ^ r_val;
-    uint32_t tail = 0;
-    const uint32_t poly = 0x1EDC6F41;
-    for(int i = 31; i >= 0; --i) {
-      if ((head>>i) & 1) {
-        head = simde_crc32_eor_mask(head, poly >> (32-i), (1u << (i)) - 1);
-        tail = simde_crc32_eor_mask(tail, poly << i, 0xFFFFFFFF);
-      }
-    }
-    return HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(tail, 32));
+    return simde_x_crc32c_u32(a, b);
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
@@ -247,28 +159,7 @@ simde___crc32cd(uint32_t a, uint64_t b) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_ACLE)
     return __crc32cd(a, b);
   #else
-    uint32_t r_acc = HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(a, 32));
-    uint64_t r_val = simde_crc32_reverseBits(b, 64);
-    uint32_t val_head = HEDLEY_STATIC_CAST(uint32_t, r_val >> 32);
-    uint32_t val_mid = HEDLEY_STATIC_CAST(uint32_t, r_val & 0x00000000FFFFFFFF);
-    uint32_t head = r_acc ^ val_head;
-    uint32_t mid = 0u ^ val_mid;
-    uint32_t tail = 0u;
-    const uint32_t poly = 0x1EDC6F41;
-    for(int i = 31; i >= 0; --i) {
-      if ((head>>i) & 1) {
-        head = simde_crc32_eor_mask(head, poly >> (32-i), (1u << (i)) - 1);
-        mid = simde_crc32_eor_mask(mid, poly << i, 0xFFFFFFFF);
-        tail = simde_crc32_eor_mask(tail, 0x0, 0xFFFFFFFF);
-      }
-    }
-    for(int i = 31; i >= 0; --i) {
-      if ((mid>>i) & 1) {
-        mid = simde_crc32_eor_mask(mid, poly >> (32-i), (1u << (i)) - 1);
-        tail = simde_crc32_eor_mask(tail, poly << i, 0xFFFFFFFF);
-      }
-    }
-    return HEDLEY_STATIC_CAST(uint32_t, simde_crc32_reverseBits(tail, 32));
+    return simde_x_crc32c_u64(a, b);
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
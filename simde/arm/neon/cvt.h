@@ -2190,6 +2190,221 @@ simde_vcvtx_high_f32_f64(simde_float32x2_t r, simde_float64x2_t a) {
   #define vcvtx_high_f32_f64(r, a) simde_vcvtx_high_f32_f64((r), (a))
 #endif
 
+/* bfloat16 is just the upper half of a binary32, so widening is a
+ * 16-bit shift.  Narrowing rounds to nearest-even and quiets NaNs, like
+ * simde_bfloat16_from_float32 (and BFCVTN with the default FPCR); note
+ * that x86's VCVTNEPS2BF16 would flush denormals, so it isn't used. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x4_private
+simde_x_vcvt_f32_bf16_private_(simde_bfloat16x4_private a_) {
+  simde_float32x4_private r_;
+
+  #if defined(SIMDE_CONVERT_VECTOR_) && defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+    uint16_t a16 SIMDE_VECTOR(8);
+    uint32_t r32 SIMDE_VECTOR(16);
+    simde_memcpy(&a16, &a_, sizeof(a16));
+    SIMDE_CONVERT_VECTOR_(r32, a16);
+    r32 <<= 16;
+    simde_memcpy(&r_, &r32, sizeof(r_));
+  #else
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_bfloat16_to_float32(a_.values[i]);
+    }
+  #endif
+
+  return r_;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_bfloat16x4_private
+simde_x_vcvt_bf16_f32_private_(simde_float32x4_private a_) {
+  simde_bfloat16x4_private r_;
+
+  #if defined(SIMDE_CONVERT_VECTOR_) && defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+    uint32_t u SIMDE_VECTOR(16), nan SIMDE_VECTOR(16);
+    uint16_t r16 SIMDE_VECTOR(8);
+    simde_memcpy(&u, &a_, sizeof(u));
+    nan = HEDLEY_REINTERPRET_CAST(__typeof__(nan), (u & UINT32_C(0x7FFFFFFF)) > UINT32_C(0x7F800000));
+    u = (nan & (u | UINT32_C(0x00400000))) | (~nan & (u + UINT32_C(0x7FFF) + ((u >> 16) & 1)));
+    u >>= 16;
+    SIMDE_CONVERT_VECTOR_(r16, u);
+    simde_memcpy(&r_, &r16, sizeof(r_));
+  #else
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_bfloat16_from_float32(a_.values[i]);
+    }
+  #endif
+
+  return r_;
+}
+
+#if defined(SIMDE_X86_SSE2_NATIVE)
+  /* Rounded bf16 bits, sign-extended in each 32-bit lane so that
+   * _mm_packs_epi32 can narrow them without saturating. */
+  SIMDE_FUNCTION_ATTRIBUTES
+  __m128i
+  simde_x_vcvt_bf16_f32_x86_(__m128 a) {
+    const __m128i u = _mm_castps_si128(a);
+    const __m128i nan = _mm_castps_si128(_mm_cmpunord_ps(a, a));
+    const __m128i quiet = _mm_or_si128(u, _mm_set1_epi32(0x00400000));
+    __m128i r =
+      _mm_add_epi32(
+        u,
+        _mm_add_epi32(_mm_set1_epi32(0x7FFF), _mm_and_si128(_mm_srli_epi32(u, 16), _mm_set1_epi32(1)))
+      );
+
+    #if defined(SIMDE_X86_SSE4_1_NATIVE)
+      r = _mm_blendv_epi8(r, quiet, nan);
+    #else
+      r = _mm_or_si128(_mm_andnot_si128(nan, r), _mm_and_si128(nan, quiet));
+    #endif
+
+    return _mm_srai_epi32(r, 16);
+  }
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_bfloat16_t
+simde_vcvth_bf16_f32(simde_float32_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARM_NEON_BF16)
+    return vcvth_bf16_f32(a);
+  #else
+    return simde_bfloat16_from_float32(a);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvth_bf16_f32
+  #define vcvth_bf16_f32(a) simde_vcvth_bf16_f32((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32_t
+simde_vcvtah_f32_bf16(simde_bfloat16_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARM_NEON_BF16)
+    return vcvtah_f32_bf16(a);
+  #else
+    return simde_bfloat16_to_float32(a);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtah_f32_bf16
+  #define vcvtah_f32_bf16(a) simde_vcvtah_f32_bf16((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x4_t
+simde_vcvt_f32_bf16(simde_bfloat16x4_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARM_NEON_BF16)
+    return vcvt_f32_bf16(a);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_float32x4_from_m128(_mm_castsi128_ps(_mm_unpacklo_epi16(_mm_setzero_si128(), simde_bfloat16x4_to_m128i(a))));
+  #else
+    return simde_float32x4_from_private(simde_x_vcvt_f32_bf16_private_(simde_bfloat16x4_to_private(a)));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvt_f32_bf16
+  #define vcvt_f32_bf16(a) simde_vcvt_f32_bf16((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x4_t
+simde_vcvtq_low_f32_bf16(simde_bfloat16x8_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARM_NEON_BF16)
+    return vcvtq_low_f32_bf16(a);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_float32x4_from_m128(_mm_castsi128_ps(_mm_unpacklo_epi16(_mm_setzero_si128(), simde_bfloat16x8_to_m128i(a))));
+  #else
+    simde_bfloat16x8_private a_ = simde_bfloat16x8_to_private(a);
+    simde_bfloat16x4_private lo_;
+    simde_memcpy(&lo_, &(a_.values[0]), sizeof(lo_));
+    return simde_float32x4_from_private(simde_x_vcvt_f32_bf16_private_(lo_));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtq_low_f32_bf16
+  #define vcvtq_low_f32_bf16(a) simde_vcvtq_low_f32_bf16((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x4_t
+simde_vcvtq_high_f32_bf16(simde_bfloat16x8_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARM_NEON_BF16)
+    return vcvtq_high_f32_bf16(a);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_float32x4_from_m128(_mm_castsi128_ps(_mm_unpackhi_epi16(_mm_setzero_si128(), simde_bfloat16x8_to_m128i(a))));
+  #else
+    simde_bfloat16x8_private a_ = simde_bfloat16x8_to_private(a);
+    simde_bfloat16x4_private hi_;
+    simde_memcpy(&hi_, &(a_.values[4]), sizeof(hi_));
+    return simde_float32x4_from_private(simde_x_vcvt_f32_bf16_private_(hi_));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtq_high_f32_bf16
+  #define vcvtq_high_f32_bf16(a) simde_vcvtq_high_f32_bf16((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_bfloat16x4_t
+simde_vcvt_bf16_f32(simde_float32x4_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARM_NEON_BF16)
+    return vcvt_bf16_f32(a);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    const __m128i r = simde_x_vcvt_bf16_f32_x86_(simde_float32x4_to_m128(a));
+    return simde_bfloat16x4_from_m128i(_mm_packs_epi32(r, r));
+  #else
+    return simde_bfloat16x4_from_private(simde_x_vcvt_bf16_f32_private_(simde_float32x4_to_private(a)));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvt_bf16_f32
+  #define vcvt_bf16_f32(a) simde_vcvt_bf16_f32((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_bfloat16x8_t
+simde_vcvtq_low_bf16_f32(simde_float32x4_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARM_NEON_BF16)
+    return vcvtq_low_bf16_f32(a);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_bfloat16x8_from_m128i(_mm_packs_epi32(simde_x_vcvt_bf16_f32_x86_(simde_float32x4_to_m128(a)), _mm_setzero_si128()));
+  #else
+    simde_bfloat16x8_private r_;
+    simde_bfloat16x4_private lo_ = simde_x_vcvt_bf16_f32_private_(simde_float32x4_to_private(a));
+    simde_memset(&r_, 0, sizeof(r_));
+    simde_memcpy(&(r_.values[0]), &lo_, sizeof(lo_));
+    return simde_bfloat16x8_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtq_low_bf16_f32
+  #define vcvtq_low_bf16_f32(a) simde_vcvtq_low_bf16_f32((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_bfloat16x8_t
+simde_vcvtq_high_bf16_f32(simde_bfloat16x8_t inactive, simde_float32x4_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARM_NEON_BF16)
+    return vcvtq_high_bf16_f32(inactive, a);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    const __m128i r = simde_x_vcvt_bf16_f32_x86_(simde_float32x4_to_m128(a));
+    return simde_bfloat16x8_from_m128i(_mm_unpacklo_epi64(simde_bfloat16x8_to_m128i(inactive), _mm_packs_epi32(r, r)));
+  #else
+    simde_bfloat16x8_private r_ = simde_bfloat16x8_to_private(inactive);
+    simde_bfloat16x4_private hi_ = simde_x_vcvt_bf16_f32_private_(simde_float32x4_to_private(a));
+    simde_memcpy(&(r_.values[4]), &hi_, sizeof(hi_));
+    return simde_bfloat16x8_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtq_high_bf16_f32
+  #define vcvtq_high_bf16_f32(inactive, a) simde_vcvtq_high_bf16_f32((inactive), (a))
+#endif
+
 
 SIMDE_END_DECLS_
 HEDLEY_DIAGNOSTIC_POP
@@ -44,6 +44,65 @@ HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
 SIMDE_BEGIN_DECLS_
 
+#if defined(SIMDE_X86_AVX512VNNI_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define SIMDE_ARM_NEON_DOT_X86_DPBUSD_(r, a, b) _mm_dpbusd_epi32((r), (a), (b))
+#elif defined(SIMDE_X86_AVXVNNI_NATIVE)
+  #define SIMDE_ARM_NEON_DOT_X86_DPBUSD_(r, a, b) _mm_dpbusd_avx_epi32((r), (a), (b))
+#endif
+
+#if defined(SIMDE_X86_SSE2_NATIVE)
+/* Adds the dot product of each group of four bytes of a and b to the
+ * matching 32-bit lane of r; a_signed and b_signed say how the bytes
+ * are read, and are constant once this is inlined.
+ *
+ * VPDPBUSD only does unsigned * signed, so the other combinations are
+ * rebiased: a signed a is (a ^ 0x80) - 128 and an unsigned b is
+ * (b ^ 0x80) + 128, and the 128 * sum() term is one more VPDPBUSD
+ * against a constant.  Without VNNI, PMADDUBSW would saturate, so
+ * each operand is split into its even and odd bytes widened to 16
+ * bits and PMADDWD does the (exact) pairwise sums. */
+SIMDE_FUNCTION_ATTRIBUTES
+__m128i
+simde_x_vdot_x86_(__m128i r, __m128i a, __m128i b, const int a_signed, const int b_signed) {
+  #if defined(SIMDE_ARM_NEON_DOT_X86_DPBUSD_)
+    const __m128i bias = _mm_set1_epi8(HEDLEY_STATIC_CAST(char, 0x80));
+
+    if (a_signed && b_signed)
+      return _mm_sub_epi32(SIMDE_ARM_NEON_DOT_X86_DPBUSD_(r, _mm_xor_si128(a, bias), b), SIMDE_ARM_NEON_DOT_X86_DPBUSD_(_mm_setzero_si128(), bias, b));
+    else if (a_signed)
+      return SIMDE_ARM_NEON_DOT_X86_DPBUSD_(r, b, a);
+    else if (b_signed)
+      return SIMDE_ARM_NEON_DOT_X86_DPBUSD_(r, a, b);
+    else
+      return _mm_add_epi32(SIMDE_ARM_NEON_DOT_X86_DPBUSD_(r, a, _mm_xor_si128(b, bias)), _mm_slli_epi32(SIMDE_ARM_NEON_DOT_X86_DPBUSD_(_mm_setzero_si128(), a, _mm_set1_epi8(64)), 1));
+  #else
+    const __m128i lo = _mm_set1_epi16(0x00FF);
+    __m128i ae, ao, be, bo;
+
+    if (a_signed) {
+      ae = _mm_srai_epi16(_mm_slli_epi16(a, 8), 8);
+      ao = _mm_srai_epi16(a, 8);
+    } else {
+      ae = _mm_and_si128(a, lo);
+      ao = _mm_srli_epi16(a, 8);
+    }
+
+    if (b_signed) {
+      be = _mm_srai_epi16(_mm_slli_epi16(b, 8), 8);
+      bo = _mm_srai_epi16(b, 8);
+    } else {
+      be = _mm_and_si128(b, lo);
+      bo = _mm_srli_epi16(b, 8);
+    }
+
+    return _mm_add_epi32(r, _mm_add_epi32(_mm_madd_epi16(ae, be), _mm_madd_epi16(ao, bo)));
+  #endif
+}
+#endif
+#if defined(SIMDE_ARM_NEON_DOT_X86_DPBUSD_)
+  #undef SIMDE_ARM_NEON_DOT_X86_DPBUSD_
+#endif
+
 SIMDE_FUNCTION_ATTRIBUTES
 simde_int32x2_t
 simde_vdot_s32(simde_int32x2_t r, simde_int8x8_t a, simde_int8x8_t b) {
@@ -51,6 +110,8 @@ simde_vdot_s32(simde_int32x2_t r, simde_int8x8_t a, simde_int8x8_t b) {
     return vdot_s32(r, a, b);
   #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return simde_vadd_s32(r, simde_vmovn_s64(simde_vpaddlq_s32(simde_vpaddlq_s16(simde_vmull_s8(a, b)))));
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_int32x2_from_m128i(simde_x_vdot_x86_(simde_int32x2_to_m128i(r), simde_int8x8_to_m128i(a), simde_int8x8_to_m128i(b), 1, 1));
   #else
     simde_int32x2_private r_;
     simde_int8x8_private
@@ -96,6 +157,8 @@ simde_vdot_u32(simde_uint32x2_t r, simde_uint8x8_t a, simde_uint8x8_t b) {
     return vdot_u32(r, a, b);
   #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return simde_vadd_u32(r, simde_vmovn_u64(simde_vpaddlq_u32(simde_vpaddlq_u16(simde_vmull_u8(a, b)))));
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_uint32x2_from_m128i(simde_x_vdot_x86_(simde_uint32x2_to_m128i(r), simde_uint8x8_to_m128i(a), simde_uint8x8_to_m128i(b), 0, 0));
   #else
     simde_uint32x2_private r_;
     simde_uint8x8_private
@@ -144,6 +207,8 @@ simde_vdotq_s32(simde_int32x4_t r, simde_int8x16_t a, simde_int8x16_t b) {
     return simde_vaddq_s32(r,
                            simde_vcombine_s32(simde_vmovn_s64(simde_vpaddlq_s32(simde_vpaddlq_s16(simde_vmull_s8(simde_vget_low_s8(a), simde_vget_low_s8(b))))),
                                                               simde_vmovn_s64(simde_vpaddlq_s32(simde_vpaddlq_s16(simde_vmull_s8(simde_vget_high_s8(a), simde_vget_high_s8(b)))))));
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_int32x4_from_m128i(simde_x_vdot_x86_(simde_int32x4_to_m128i(r), simde_int8x16_to_m128i(a), simde_int8x16_to_m128i(b), 1, 1));
   #else
     simde_int32x4_private r_;
     simde_int8x16_private
@@ -193,6 +258,8 @@ simde_vdotq_u32(simde_uint32x4_t r, simde_uint8x16_t a, simde_uint8x16_t b) {
     return simde_vaddq_u32(r,
                            simde_vcombine_u32(simde_vmovn_u64(simde_vpaddlq_u32(simde_vpaddlq_u16(simde_vmull_u8(simde_vget_low_u8(a), simde_vget_low_u8(b))))),
                                               simde_vmovn_u64(simde_vpaddlq_u32(simde_vpaddlq_u16(simde_vmull_u8(simde_vget_high_u8(a), simde_vget_high_u8(b)))))));
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_uint32x4_from_m128i(simde_x_vdot_x86_(simde_uint32x4_to_m128i(r), simde_uint8x16_to_m128i(a), simde_uint8x16_to_m128i(b), 0, 0));
   #else
     simde_uint32x4_private r_;
     simde_uint8x16_private
@@ -32,6 +32,7 @@
 #include "types.h"
 
 #include "add.h"
+#include "dot.h"
 #include "dup_lane.h"
 #include "paddl.h"
 #include "movn.h"
@@ -65,6 +66,12 @@ simde_vdot_lane_s32(simde_int32x2_t r, simde_int8x8_t a, simde_int8x8_t b, const
           )
         )
       );
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int8x8_private b_ = simde_int8x8_to_private(b);
+    int32_t b_lane_;
+    simde_memcpy(&b_lane_, &(b_.values[lane * 4]), sizeof(b_lane_));
+    const __m128i b_lane = _mm_set1_epi32(b_lane_);
+    result = simde_int32x2_from_m128i(simde_x_vdot_x86_(simde_int32x2_to_m128i(r), simde_int8x8_to_m128i(a), b_lane, 1, 1));
   #else
     simde_int32x2_private r_ = simde_int32x2_to_private(r);
     simde_int8x8_private
@@ -129,6 +136,12 @@ simde_vdot_lane_u32(simde_uint32x2_t r, simde_uint8x8_t a, simde_uint8x8_t b, co
           )
         )
       );
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_uint8x8_private b_ = simde_uint8x8_to_private(b);
+    int32_t b_lane_;
+    simde_memcpy(&b_lane_, &(b_.values[lane * 4]), sizeof(b_lane_));
+    const __m128i b_lane = _mm_set1_epi32(b_lane_);
+    result = simde_uint32x2_from_m128i(simde_x_vdot_x86_(simde_uint32x2_to_m128i(r), simde_uint8x8_to_m128i(a), b_lane, 0, 0));
   #else
     simde_uint32x2_private r_ = simde_uint32x2_to_private(r);
     simde_uint8x8_private
@@ -192,6 +205,12 @@ simde_vdot_laneq_s32(simde_int32x2_t r, simde_int8x8_t a, simde_int8x16_t b, con
           )
         )
       );
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int8x16_private b_ = simde_int8x16_to_private(b);
+    int32_t b_lane_;
+    simde_memcpy(&b_lane_, &(b_.values[lane * 4]), sizeof(b_lane_));
+    const __m128i b_lane = _mm_set1_epi32(b_lane_);
+    result = simde_int32x2_from_m128i(simde_x_vdot_x86_(simde_int32x2_to_m128i(r), simde_int8x8_to_m128i(a), b_lane, 1, 1));
   #else
     simde_int32x2_private r_ = simde_int32x2_to_private(r);
     simde_int8x8_private a_ = simde_int8x8_to_private(a);
@@ -254,6 +273,12 @@ simde_vdot_laneq_u32(simde_uint32x2_t r, simde_uint8x8_t a, simde_uint8x16_t b,
           )
         )
       );
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_uint8x16_private b_ = simde_uint8x16_to_private(b);
+    int32_t b_lane_;
+    simde_memcpy(&b_lane_, &(b_.values[lane * 4]), sizeof(b_lane_));
+    const __m128i b_lane = _mm_set1_epi32(b_lane_);
+    result = simde_uint32x2_from_m128i(simde_x_vdot_x86_(simde_uint32x2_to_m128i(r), simde_uint8x8_to_m128i(a), b_lane, 0, 0));
   #else
     simde_uint32x2_private r_ = simde_uint32x2_to_private(r);
     simde_uint8x8_private a_ = simde_uint8x8_to_private(a);
@@ -328,6 +353,12 @@ simde_vdotq_laneq_u32(simde_uint32x4_t r, simde_uint8x16_t a, simde_uint8x16_t b
           )
         )
       );
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_uint8x16_private b_ = simde_uint8x16_to_private(b);
+    int32_t b_lane_;
+    simde_memcpy(&b_lane_, &(b_.values[lane * 4]), sizeof(b_lane_));
+    const __m128i b_lane = _mm_set1_epi32(b_lane_);
+    result = simde_uint32x4_from_m128i(simde_x_vdot_x86_(simde_uint32x4_to_m128i(r), simde_uint8x16_to_m128i(a), b_lane, 0, 0));
   #else
     simde_uint32x4_private r_ = simde_uint32x4_to_private(r);
     simde_uint8x16_private
@@ -406,6 +437,12 @@ simde_vdotq_laneq_s32(simde_int32x4_t r, simde_int8x16_t a, simde_int8x16_t b, c
           )
         )
       );
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int8x16_private b_ = simde_int8x16_to_private(b);
+    int32_t b_lane_;
+    simde_memcpy(&b_lane_, &(b_.values[lane * 4]), sizeof(b_lane_));
+    const __m128i b_lane = _mm_set1_epi32(b_lane_);
+    result = simde_int32x4_from_m128i(simde_x_vdot_x86_(simde_int32x4_to_m128i(r), simde_int8x16_to_m128i(a), b_lane, 1, 1));
   #else
     simde_int32x4_private r_ = simde_int32x4_to_private(r);
     simde_int8x16_private
@@ -488,6 +525,12 @@ simde_vdotq_lane_u32(simde_uint32x4_t r, simde_uint8x16_t a, simde_uint8x8_t b,
           )
         )
       );
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_uint8x8_private b_ = simde_uint8x8_to_private(b);
+    int32_t b_lane_;
+    simde_memcpy(&b_lane_, &(b_.values[lane * 4]), sizeof(b_lane_));
+    const __m128i b_lane = _mm_set1_epi32(b_lane_);
+    result = simde_uint32x4_from_m128i(simde_x_vdot_x86_(simde_uint32x4_to_m128i(r), simde_uint8x16_to_m128i(a), b_lane, 0, 0));
   #else
     simde_uint32x4_private r_ = simde_uint32x4_to_private(r);
     simde_uint8x16_private a_ = simde_uint8x16_to_private(a);
@@ -564,6 +607,12 @@ simde_vdotq_lane_s32(simde_int32x4_t r, simde_int8x16_t a, simde_int8x8_t b, con
           )
         )
       );
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int8x8_private b_ = simde_int8x8_to_private(b);
+    int32_t b_lane_;
+    simde_memcpy(&b_lane_, &(b_.values[lane * 4]), sizeof(b_lane_));
+    const __m128i b_lane = _mm_set1_epi32(b_lane_);
+    result = simde_int32x4_from_m128i(simde_x_vdot_x86_(simde_int32x4_to_m128i(r), simde_int8x16_to_m128i(a), b_lane, 1, 1));
   #else
     simde_int32x4_private r_ = simde_int32x4_to_private(r);
     simde_int8x16_private a_ = simde_int8x16_to_private(a);
@@ -40,6 +40,125 @@ SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
 #endif
 SIMDE_BEGIN_DECLS_
 
+#if defined(SIMDE_X86_SSSE3_NATIVE)
+/* De-interleave 3-element structures of 1- or 2-byte elements: every
+ * output gathers its bytes from each 16-byte chunk of the input with
+ * one PSHUFB (lanes that live in another chunk have the high bit set
+ * in the mask, so they come out as zero) and the partial results are
+ * ORed together.  The 64-bit loads only have 24 bytes, so they pass
+ * chunks == 2 and ignore the upper half of each result. */
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_vld3_x86_epi8_(__m128i r[3], __m128i a, __m128i b, __m128i c, const size_t size, const int chunks) {
+  __m128i m[3][3];
+
+  if (size == 1) {
+    m[0][0] = _mm_setr_epi8( 0,  3,  6,  9, 12, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    m[0][1] = _mm_setr_epi8(-1, -1, -1, -1, -1, -1,  2,  5,  8, 11, 14, -1, -1, -1, -1, -1);
+    m[0][2] = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  1,  4,  7, 10, 13);
+    m[1][0] = _mm_setr_epi8( 1,  4,  7, 10, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    m[1][1] = _mm_setr_epi8(-1, -1, -1, -1, -1,  0,  3,  6,  9, 12, 15, -1, -1, -1, -1, -1);
+    m[1][2] = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  2,  5,  8, 11, 14);
+    m[2][0] = _mm_setr_epi8( 2,  5,  8, 11, 14, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    m[2][1] = _mm_setr_epi8(-1, -1, -1, -1, -1,  1,  4,  7, 10, 13, -1, -1, -1, -1, -1, -1);
+    m[2][2] = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  0,  3,  6,  9, 12, 15);
+  } else {
+    m[0][0] = _mm_setr_epi8( 0,  1,  6,  7, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    m[0][1] = _mm_setr_epi8(-1, -1, -1, -1, -1, -1,  2,  3,  8,  9, 14, 15, -1, -1, -1, -1);
+    m[0][2] = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  4,  5, 10, 11);
+    m[1][0] = _mm_setr_epi8( 2,  3,  8,  9, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    m[1][1] = _mm_setr_epi8(-1, -1, -1, -1, -1, -1,  4,  5, 10, 11, -1, -1, -1, -1, -1, -1);
+    m[1][2] = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  0,  1,  6,  7, 12, 13);
+    m[2][0] = _mm_setr_epi8( 4,  5, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    m[2][1] = _mm_setr_epi8(-1, -1, -1, -1,  0,  1,  6,  7, 12, 13, -1, -1, -1, -1, -1, -1);
+    m[2][2] = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  2,  3,  8,  9, 14, 15);
+  }
+
+  for (size_t k = 0 ; k < 3 ; k++) {
+    r[k] = _mm_or_si128(_mm_shuffle_epi8(a, m[k][0]), _mm_shuffle_epi8(b, m[k][1]));
+    if (chunks > 2)
+      r[k] = _mm_or_si128(r[k], _mm_shuffle_epi8(c, m[k][2]));
+  }
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_vld3q_x86_epi8_(__m128i r[3], const void* ptr, const size_t size) {
+  #if defined(SIMDE_X86_AVX512VBMI_NATIVE) && defined(SIMDE_X86_AVX512BW_NATIVE)
+    if (size == 1) {
+      /* All 48 bytes fit in one register, so a single VPERMB can put
+       * each output in its own 128-bit lane. */
+      static const SIMDE_ALIGN_TO_64 uint8_t idx[64] = {
+         0,  3,  6,  9, 12, 15, 18, 21, 24, 27, 30, 33, 36, 39, 42, 45,
+         1,  4,  7, 10, 13, 16, 19, 22, 25, 28, 31, 34, 37, 40, 43, 46,
+         2,  5,  8, 11, 14, 17, 20, 23, 26, 29, 32, 35, 38, 41, 44, 47,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+      };
+      __m512i v = _mm512_permutexvar_epi8(_mm512_load_si512(HEDLEY_REINTERPRET_CAST(const void*, idx)), _mm512_maskz_loadu_epi8(UINT64_C(0xffffffffffff), ptr));
+      r[0] = _mm512_castsi512_si128(v);
+      r[1] = _mm512_extracti32x4_epi32(v, 1);
+      r[2] = _mm512_extracti32x4_epi32(v, 2);
+      return;
+    }
+  #endif
+  #if defined(SIMDE_X86_AVX512BW_NATIVE)
+    if (size == 2) {
+      static const SIMDE_ALIGN_TO_64 uint16_t idx[32] = {
+         0,  3,  6,  9, 12, 15, 18, 21,  1,  4,  7, 10, 13, 16, 19, 22,
+         2,  5,  8, 11, 14, 17, 20, 23,  0,  0,  0,  0,  0,  0,  0,  0
+      };
+      __m512i v = _mm512_permutexvar_epi16(_mm512_load_si512(HEDLEY_REINTERPRET_CAST(const void*, idx)), _mm512_maskz_loadu_epi16(UINT32_C(0xffffff), ptr));
+      r[0] = _mm512_castsi512_si128(v);
+      r[1] = _mm512_extracti32x4_epi32(v, 1);
+      r[2] = _mm512_extracti32x4_epi32(v, 2);
+      return;
+    }
+  #endif
+
+  const __m128i* p = HEDLEY_REINTERPRET_CAST(const __m128i*, ptr);
+  simde_x_vld3_x86_epi8_(r, _mm_loadu_si128(p), _mm_loadu_si128(p + 1), _mm_loadu_si128(p + 2), size, 3);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_vld3_x86_epi8_half_(__m128i r[3], const void* ptr, const size_t size) {
+  const __m128i* p = HEDLEY_REINTERPRET_CAST(const __m128i*, ptr);
+  simde_x_vld3_x86_epi8_(r, _mm_loadu_si128(p), _mm_loadl_epi64(p + 1), _mm_setzero_si128(), size, 2);
+}
+#endif
+
+#if defined(SIMDE_X86_SSE2_NATIVE)
+/* 4- and 8-byte elements only need whole-lane shuffles. */
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_vld3q_x86_ps_(__m128 r[3], const void* ptr) {
+  const float* p = HEDLEY_REINTERPRET_CAST(const float*, ptr);
+  __m128
+    a = _mm_loadu_ps(p),
+    b = _mm_loadu_ps(p + 4),
+    c = _mm_loadu_ps(p + 8);
+
+  /* a = x0 y0 z0 x1, b = y1 z1 x2 y2, c = z2 x3 y3 z3 */
+  r[0] = _mm_shuffle_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 0, 0)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+  r[1] = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+  r[2] = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_vld3q_x86_pd_(__m128d r[3], const void* ptr) {
+  const double* p = HEDLEY_REINTERPRET_CAST(const double*, ptr);
+  __m128d
+    a = _mm_loadu_pd(p),
+    b = _mm_loadu_pd(p + 2),
+    c = _mm_loadu_pd(p + 4);
+
+  r[0] = _mm_shuffle_pd(a, b, 2);
+  r[1] = _mm_shuffle_pd(a, c, 1);
+  r[2] = _mm_shuffle_pd(b, c, 2);
+}
+#endif
+
 #if !defined(SIMDE_BUG_INTEL_857088)
 
 SIMDE_FUNCTION_ATTRIBUTES
@@ -146,6 +265,15 @@ simde_int8x8x3_t
 simde_vld3_s8(int8_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld3_s8(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    __m128i r_[3];
+    simde_x_vld3_x86_epi8_half_(r_, ptr, sizeof(ptr[0]));
+    simde_int8x8x3_t r = { {
+      simde_int8x8_from_m128i(r_[0]),
+      simde_int8x8_from_m128i(r_[1]),
+      simde_int8x8_from_m128i(r_[2])
+    } };
+    return r;
   #else
     simde_int8x8_private r_[3];
     #if defined(SIMDE_RISCV_V_NATIVE)
@@ -179,6 +307,15 @@ simde_int16x4x3_t
 simde_vld3_s16(int16_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld3_s16(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    __m128i r_[3];
+    simde_x_vld3_x86_epi8_half_(r_, ptr, sizeof(ptr[0]));
+    simde_int16x4x3_t r = { {
+      simde_int16x4_from_m128i(r_[0]),
+      simde_int16x4_from_m128i(r_[1]),
+      simde_int16x4_from_m128i(r_[2])
+    } };
+    return r;
   #else
     simde_int16x4_private r_[3];
     #if defined(SIMDE_RISCV_V_NATIVE)
@@ -278,6 +415,15 @@ simde_uint8x8x3_t
 simde_vld3_u8(uint8_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld3_u8(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    __m128i r_[3];
+    simde_x_vld3_x86_epi8_half_(r_, ptr, sizeof(ptr[0]));
+    simde_uint8x8x3_t r = { {
+      simde_uint8x8_from_m128i(r_[0]),
+      simde_uint8x8_from_m128i(r_[1]),
+      simde_uint8x8_from_m128i(r_[2])
+    } };
+    return r;
   #else
     simde_uint8x8_private r_[3];
     #if defined(SIMDE_RISCV_V_NATIVE)
@@ -311,6 +457,15 @@ simde_uint16x4x3_t
 simde_vld3_u16(uint16_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld3_u16(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    __m128i r_[3];
+    simde_x_vld3_x86_epi8_half_(r_, ptr, sizeof(ptr[0]));
+    simde_uint16x4x3_t r = { {
+      simde_uint16x4_from_m128i(r_[0]),
+      simde_uint16x4_from_m128i(r_[1]),
+      simde_uint16x4_from_m128i(r_[2])
+    } };
+    return r;
   #else
     simde_uint16x4_private r_[3];
     #if defined(SIMDE_RISCV_V_NATIVE)
@@ -443,6 +598,15 @@ simde_float32x4x3_t
 simde_vld3q_f32(simde_float32 const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld3q_f32(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    __m128 r_[3];
+    simde_x_vld3q_x86_ps_(r_, ptr);
+    simde_float32x4x3_t r = { {
+      simde_float32x4_from_m128(r_[0]),
+      simde_float32x4_from_m128(r_[1]),
+      simde_float32x4_from_m128(r_[2])
+    } };
+    return r;
   #elif defined(SIMDE_RISCV_V_NATIVE)
     simde_float32x4_private r_[3];
     vfloat32m1x3_t dest = __riscv_vlseg3e32_v_f32m1x3(&ptr[0], 4);
@@ -483,6 +647,15 @@ simde_float64x2x3_t
 simde_vld3q_f64(simde_float64 const *ptr) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     return vld3q_f64(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    __m128d r_[3];
+    simde_x_vld3q_x86_pd_(r_, ptr);
+    simde_float64x2x3_t r = { {
+      simde_float64x2_from_m128d(r_[0]),
+      simde_float64x2_from_m128d(r_[1]),
+      simde_float64x2_from_m128d(r_[2])
+    } };
+    return r;
   #elif defined(SIMDE_RISCV_V_NATIVE)
     simde_float64x2_private r_[3];
     vfloat64m1x3_t dest = __riscv_vlseg3e64_v_f64m1x3(&ptr[0], 2);
@@ -523,6 +696,15 @@ simde_int8x16x3_t
 simde_vld3q_s8(int8_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld3q_s8(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    __m128i r_[3];
+    simde_x_vld3q_x86_epi8_(r_, ptr, sizeof(ptr[0]));
+    simde_int8x16x3_t r = { {
+      simde_int8x16_from_m128i(r_[0]),
+      simde_int8x16_from_m128i(r_[1]),
+      simde_int8x16_from_m128i(r_[2])
+    } };
+    return r;
   #elif defined(SIMDE_RISCV_V_NATIVE)
     simde_int8x16_private r_[3];
     vint8m1x3_t dest = __riscv_vlseg3e8_v_i8m1x3(&ptr[0], 16);
@@ -563,6 +745,15 @@ simde_int16x8x3_t
 simde_vld3q_s16(int16_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld3q_s16(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    __m128i r_[3];
+    simde_x_vld3q_x86_epi8_(r_, ptr, sizeof(ptr[0]));
+    simde_int16x8x3_t r = { {
+      simde_int16x8_from_m128i(r_[0]),
+      simde_int16x8_from_m128i(r_[1]),
+      simde_int16x8_from_m128i(r_[2])
+    } };
+    return r;
   #elif defined(SIMDE_RISCV_V_NATIVE)
     simde_int16x8_private r_[3];
     vint16m1x3_t dest = __riscv_vlseg3e16_v_i16m1x3(&ptr[0], 8);
@@ -603,6 +794,15 @@ simde_int32x4x3_t
 simde_vld3q_s32(int32_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld3q_s32(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    __m128 r_[3];
+    simde_x_vld3q_x86_ps_(r_, ptr);
+    simde_int32x4x3_t r = { {
+      simde_int32x4_from_m128i(_mm_castps_si128(r_[0])),
+      simde_int32x4_from_m128i(_mm_castps_si128(r_[1])),
+      simde_int32x4_from_m128i(_mm_castps_si128(r_[2]))
+    } };
+    return r;
   #elif defined(SIMDE_RISCV_V_NATIVE)
     simde_int32x4_private r_[3];
     vint32m1x3_t dest = __riscv_vlseg3e32_v_i32m1x3(&ptr[0], 4);
@@ -643,6 +843,15 @@ simde_int64x2x3_t
 simde_vld3q_s64(int64_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     return vld3q_s64(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    __m128d r_[3];
+    simde_x_vld3q_x86_pd_(r_, ptr);
+    simde_int64x2x3_t r = { {
+      simde_int64x2_from_m128i(_mm_castpd_si128(r_[0])),
+      simde_int64x2_from_m128i(_mm_castpd_si128(r_[1])),
+      simde_int64x2_from_m128i(_mm_castpd_si128(r_[2]))
+    } };
+    return r;
   #elif defined(SIMDE_RISCV_V_NATIVE)
     simde_int64x2_private r_[3];
     vint64m1x3_t dest = __riscv_vlseg3e64_v_i64m1x3(&ptr[0], 2);
@@ -684,6 +893,15 @@ simde_uint8x16x3_t
 simde_vld3q_u8(uint8_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld3q_u8(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    __m128i r_[3];
+    simde_x_vld3q_x86_epi8_(r_, ptr, sizeof(ptr[0]));
+    simde_uint8x16x3_t r = { {
+      simde_uint8x16_from_m128i(r_[0]),
+      simde_uint8x16_from_m128i(r_[1]),
+      simde_uint8x16_from_m128i(r_[2])
+    } };
+    return r;
   #elif defined(SIMDE_RISCV_V_NATIVE)
     simde_uint8x16_private r_[3];
     vuint8m1x3_t dest = __riscv_vlseg3e8_v_u8m1x3(&ptr[0], 16);
@@ -724,6 +942,15 @@ simde_uint16x8x3_t
 simde_vld3q_u16(uint16_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld3q_u16(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    __m128i r_[3];
+    simde_x_vld3q_x86_epi8_(r_, ptr, sizeof(ptr[0]));
+    simde_uint16x8x3_t r = { {
+      simde_uint16x8_from_m128i(r_[0]),
+      simde_uint16x8_from_m128i(r_[1]),
+      simde_uint16x8_from_m128i(r_[2])
+    } };
+    return r;
   #elif defined(SIMDE_RISCV_V_NATIVE)
     simde_uint16x8_private r_[3];
     vuint16m1x3_t dest = __riscv_vlseg3e16_v_u16m1x3(&ptr[0], 8);
@@ -764,6 +991,15 @@ simde_uint32x4x3_t
 simde_vld3q_u32(uint32_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld3q_u32(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    __m128 r_[3];
+    simde_x_vld3q_x86_ps_(r_, ptr);
+    simde_uint32x4x3_t r = { {
+      simde_uint32x4_from_m128i(_mm_castps_si128(r_[0])),
+      simde_uint32x4_from_m128i(_mm_castps_si128(r_[1])),
+      simde_uint32x4_from_m128i(_mm_castps_si128(r_[2]))
+    } };
+    return r;
   #elif defined(SIMDE_RISCV_V_NATIVE)
     simde_uint32x4_private r_[3];
     vuint32m1x3_t dest = __riscv_vlseg3e32_v_u32m1x3(&ptr[0], 4);
@@ -804,6 +1040,15 @@ simde_uint64x2x3_t
 simde_vld3q_u64(uint64_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     return vld3q_u64(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    __m128d r_[3];
+    simde_x_vld3q_x86_pd_(r_, ptr);
+    simde_uint64x2x3_t r = { {
+      simde_uint64x2_from_m128i(_mm_castpd_si128(r_[0])),
+      simde_uint64x2_from_m128i(_mm_castpd_si128(r_[1])),
+      simde_uint64x2_from_m128i(_mm_castpd_si128(r_[2]))
+    } };
+    return r;
   #elif defined(SIMDE_RISCV_V_NATIVE)
     simde_uint64x2_private r_[3];
     vuint64m1x3_t dest = __riscv_vlseg3e64_v_u64m1x3(&ptr[0], 2);
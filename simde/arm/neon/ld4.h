@@ -39,6 +39,138 @@ SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
 #endif
 SIMDE_BEGIN_DECLS_
 
+#if defined(SIMDE_X86_SSE2_NATIVE)
+/* Transpose a 4x4 matrix of 32-bit lanes.  This is vld4q for 32-bit
+ * elements, and the last step for 8- and 16-bit elements once each
+ * chunk has been shuffled so every 32-bit lane holds one member. */
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_vld4q_x86_transpose_epi32_(__m128i r[4], __m128i a, __m128i b, __m128i c, __m128i d) {
+  __m128i
+    t0 = _mm_unpacklo_epi32(a, b),
+    t1 = _mm_unpacklo_epi32(c, d),
+    t2 = _mm_unpackhi_epi32(a, b),
+    t3 = _mm_unpackhi_epi32(c, d);
+
+  r[0] = _mm_unpacklo_epi64(t0, t1);
+  r[1] = _mm_unpackhi_epi64(t0, t1);
+  r[2] = _mm_unpacklo_epi64(t2, t3);
+  r[3] = _mm_unpackhi_epi64(t2, t3);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_vld4q_x86_epi32_(__m128i r[4], const void* ptr) {
+  const __m128i* p = HEDLEY_REINTERPRET_CAST(const __m128i*, ptr);
+  simde_x_vld4q_x86_transpose_epi32_(r, _mm_loadu_si128(p), _mm_loadu_si128(p + 1), _mm_loadu_si128(p + 2), _mm_loadu_si128(p + 3));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_vld4q_x86_epi64_(__m128i r[4], const void* ptr) {
+  const __m128i* p = HEDLEY_REINTERPRET_CAST(const __m128i*, ptr);
+  __m128i
+    a = _mm_loadu_si128(p),
+    b = _mm_loadu_si128(p + 1),
+    c = _mm_loadu_si128(p + 2),
+    d = _mm_loadu_si128(p + 3);
+
+  r[0] = _mm_unpacklo_epi64(a, c);
+  r[1] = _mm_unpackhi_epi64(a, c);
+  r[2] = _mm_unpacklo_epi64(b, d);
+  r[3] = _mm_unpackhi_epi64(b, d);
+}
+#endif
+
+#if defined(SIMDE_X86_SSSE3_NATIVE)
+/* Moves member k of every structure in a 16-byte chunk of 1- or
+ * 2-byte elements into 32-bit lane k. */
+SIMDE_FUNCTION_ATTRIBUTES
+__m128i
+simde_x_vld4_x86_epi8_mask_(const size_t size) {
+  return (size == 1) ?
+    _mm_setr_epi8(0, 4,  8, 12, 1, 5,  9, 13, 2, 6, 10, 14, 3, 7, 11, 15) :
+    _mm_setr_epi8(0, 1,  8,  9, 2, 3, 10, 11, 4, 5, 12, 13, 6, 7, 14, 15);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_vld4q_x86_epi8_(__m128i r[4], const void* ptr, const size_t size) {
+  #if defined(SIMDE_X86_AVX512VBMI_NATIVE)
+    if (size == 1) {
+      static const SIMDE_ALIGN_TO_64 uint8_t idx[64] = {
+         0,  4,  8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60,
+         1,  5,  9, 13, 17, 21, 25, 29, 33, 37, 41, 45, 49, 53, 57, 61,
+         2,  6, 10, 14, 18, 22, 26, 30, 34, 38, 42, 46, 50, 54, 58, 62,
+         3,  7, 11, 15, 19, 23, 27, 31, 35, 39, 43, 47, 51, 55, 59, 63
+      };
+      __m512i v = _mm512_permutexvar_epi8(_mm512_load_si512(HEDLEY_REINTERPRET_CAST(const void*, idx)), _mm512_loadu_si512(ptr));
+      r[0] = _mm512_castsi512_si128(v);
+      r[1] = _mm512_extracti32x4_epi32(v, 1);
+      r[2] = _mm512_extracti32x4_epi32(v, 2);
+      r[3] = _mm512_extracti32x4_epi32(v, 3);
+      return;
+    }
+  #endif
+  #if defined(SIMDE_X86_AVX512BW_NATIVE)
+    if (size == 2) {
+      static const SIMDE_ALIGN_TO_64 uint16_t idx[32] = {
+         0,  4,  8, 12, 16, 20, 24, 28,  1,  5,  9, 13, 17, 21, 25, 29,
+         2,  6, 10, 14, 18, 22, 26, 30,  3,  7, 11, 15, 19, 23, 27, 31
+      };
+      __m512i v = _mm512_permutexvar_epi16(_mm512_load_si512(HEDLEY_REINTERPRET_CAST(const void*, idx)), _mm512_loadu_si512(ptr));
+      r[0] = _mm512_castsi512_si128(v);
+      r[1] = _mm512_extracti32x4_epi32(v, 1);
+      r[2] = _mm512_extracti32x4_epi32(v, 2);
+      r[3] = _mm512_extracti32x4_epi32(v, 3);
+      return;
+    }
+  #endif
+
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    /* Two chunks per register; the in-lane unpacks leave the lanes
+     * in a 0 2 1 3 order, which one VPERMD per register fixes. */
+    const __m256i* p = HEDLEY_REINTERPRET_CAST(const __m256i*, ptr);
+    const __m256i m = _mm256_broadcastsi128_si256(simde_x_vld4_x86_epi8_mask_(size));
+    const __m256i idx = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    __m256i
+      ab = _mm256_shuffle_epi8(_mm256_loadu_si256(p), m),
+      cd = _mm256_shuffle_epi8(_mm256_loadu_si256(p + 1), m);
+    __m256i
+      lo = _mm256_permutevar8x32_epi32(_mm256_unpacklo_epi32(ab, cd), idx),
+      hi = _mm256_permutevar8x32_epi32(_mm256_unpackhi_epi32(ab, cd), idx);
+
+    r[0] = _mm256_castsi256_si128(lo);
+    r[1] = _mm256_extracti128_si256(lo, 1);
+    r[2] = _mm256_castsi256_si128(hi);
+    r[3] = _mm256_extracti128_si256(hi, 1);
+  #else
+    const __m128i* p = HEDLEY_REINTERPRET_CAST(const __m128i*, ptr);
+    const __m128i m = simde_x_vld4_x86_epi8_mask_(size);
+    simde_x_vld4q_x86_transpose_epi32_(r,
+      _mm_shuffle_epi8(_mm_loadu_si128(p    ), m),
+      _mm_shuffle_epi8(_mm_loadu_si128(p + 1), m),
+      _mm_shuffle_epi8(_mm_loadu_si128(p + 2), m),
+      _mm_shuffle_epi8(_mm_loadu_si128(p + 3), m));
+  #endif
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_vld4_x86_epi8_half_(__m128i r[4], const void* ptr, const size_t size) {
+  const __m128i* p = HEDLEY_REINTERPRET_CAST(const __m128i*, ptr);
+  const __m128i m = simde_x_vld4_x86_epi8_mask_(size);
+  __m128i
+    a = _mm_shuffle_epi8(_mm_loadu_si128(p    ), m),
+    b = _mm_shuffle_epi8(_mm_loadu_si128(p + 1), m);
+
+  r[0] = _mm_unpacklo_epi32(a, b);
+  r[1] = _mm_unpackhi_epi64(r[0], r[0]);
+  r[2] = _mm_unpackhi_epi32(a, b);
+  r[3] = _mm_unpackhi_epi64(r[2], r[2]);
+}
+#endif
+
 #if !defined(SIMDE_BUG_INTEL_857088)
 
 SIMDE_FUNCTION_ATTRIBUTES
@@ -130,6 +262,16 @@ simde_int8x8x4_t
 simde_vld4_s8(int8_t const ptr[HEDLEY_ARRAY_PARAM(32)]) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld4_s8(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    __m128i r_[4];
+    simde_x_vld4_x86_epi8_half_(r_, ptr, sizeof(ptr[0]));
+    simde_int8x8x4_t r = { {
+      simde_int8x8_from_m128i(r_[0]),
+      simde_int8x8_from_m128i(r_[1]),
+      simde_int8x8_from_m128i(r_[2]),
+      simde_int8x8_from_m128i(r_[3])
+    } };
+    return r;
   #else
     simde_int8x8_private a_[4];
     #if defined(SIMDE_RISCV_V_NATIVE)
@@ -158,6 +300,16 @@ simde_int16x4x4_t
 simde_vld4_s16(int16_t const ptr[HEDLEY_ARRAY_PARAM(16)]) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld4_s16(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    __m128i r_[4];
+    simde_x_vld4_x86_epi8_half_(r_, ptr, sizeof(ptr[0]));
+    simde_int16x4x4_t r = { {
+      simde_int16x4_from_m128i(r_[0]),
+      simde_int16x4_from_m128i(r_[1]),
+      simde_int16x4_from_m128i(r_[2]),
+      simde_int16x4_from_m128i(r_[3])
+    } };
+    return r;
   #else
     simde_int16x4_private a_[4];
     #if defined(SIMDE_RISCV_V_NATIVE)
@@ -242,6 +394,16 @@ simde_uint8x8x4_t
 simde_vld4_u8(uint8_t const ptr[HEDLEY_ARRAY_PARAM(32)]) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld4_u8(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    __m128i r_[4];
+    simde_x_vld4_x86_epi8_half_(r_, ptr, sizeof(ptr[0]));
+    simde_uint8x8x4_t r = { {
+      simde_uint8x8_from_m128i(r_[0]),
+      simde_uint8x8_from_m128i(r_[1]),
+      simde_uint8x8_from_m128i(r_[2]),
+      simde_uint8x8_from_m128i(r_[3])
+    } };
+    return r;
   #else
     simde_uint8x8_private a_[4];
     #if defined(SIMDE_RISCV_V_NATIVE)
@@ -270,6 +432,16 @@ simde_uint16x4x4_t
 simde_vld4_u16(uint16_t const ptr[HEDLEY_ARRAY_PARAM(16)]) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld4_u16(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    __m128i r_[4];
+    simde_x_vld4_x86_epi8_half_(r_, ptr, sizeof(ptr[0]));
+    simde_uint16x4x4_t r = { {
+      simde_uint16x4_from_m128i(r_[0]),
+      simde_uint16x4_from_m128i(r_[1]),
+      simde_uint16x4_from_m128i(r_[2]),
+      simde_uint16x4_from_m128i(r_[3])
+    } };
+    return r;
   #else
     simde_uint16x4_private a_[4];
     #if defined(SIMDE_RISCV_V_NATIVE)
@@ -382,6 +554,16 @@ simde_float32x4x4_t
 simde_vld4q_f32(simde_float32 const ptr[HEDLEY_ARRAY_PARAM(16)]) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld4q_f32(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    __m128i r_[4];
+    simde_x_vld4q_x86_epi32_(r_, ptr);
+    simde_float32x4x4_t r = { {
+      simde_float32x4_from_m128(_mm_castsi128_ps(r_[0])),
+      simde_float32x4_from_m128(_mm_castsi128_ps(r_[1])),
+      simde_float32x4_from_m128(_mm_castsi128_ps(r_[2])),
+      simde_float32x4_from_m128(_mm_castsi128_ps(r_[3]))
+    } };
+    return r;
   #else
     simde_float32x4_private a_[4];
     #if defined(SIMDE_RISCV_V_NATIVE)
@@ -410,6 +592,16 @@ simde_float64x2x4_t
 simde_vld4q_f64(simde_float64 const ptr[HEDLEY_ARRAY_PARAM(8)]) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     return vld4q_f64(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    __m128i r_[4];
+    simde_x_vld4q_x86_epi64_(r_, ptr);
+    simde_float64x2x4_t r = { {
+      simde_float64x2_from_m128d(_mm_castsi128_pd(r_[0])),
+      simde_float64x2_from_m128d(_mm_castsi128_pd(r_[1])),
+      simde_float64x2_from_m128d(_mm_castsi128_pd(r_[2])),
+      simde_float64x2_from_m128d(_mm_castsi128_pd(r_[3]))
+    } };
+    return r;
   #else
     simde_float64x2_private a_[4];
     #if defined(SIMDE_RISCV_V_NATIVE)
@@ -438,6 +630,16 @@ simde_int8x16x4_t
 simde_vld4q_s8(int8_t const ptr[HEDLEY_ARRAY_PARAM(64)]) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld4q_s8(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    __m128i r_[4];
+    simde_x_vld4q_x86_epi8_(r_, ptr, sizeof(ptr[0]));
+    simde_int8x16x4_t r = { {
+      simde_int8x16_from_m128i(r_[0]),
+      simde_int8x16_from_m128i(r_[1]),
+      simde_int8x16_from_m128i(r_[2]),
+      simde_int8x16_from_m128i(r_[3])
+    } };
+    return r;
   #else
     simde_int8x16_private a_[4];
     #if defined(SIMDE_RISCV_V_NATIVE)
@@ -466,6 +668,16 @@ simde_int16x8x4_t
 simde_vld4q_s16(int16_t const ptr[HEDLEY_ARRAY_PARAM(32)]) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld4q_s16(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    __m128i r_[4];
+    simde_x_vld4q_x86_epi8_(r_, ptr, sizeof(ptr[0]));
+    simde_int16x8x4_t r = { {
+      simde_int16x8_from_m128i(r_[0]),
+      simde_int16x8_from_m128i(r_[1]),
+      simde_int16x8_from_m128i(r_[2]),
+      simde_int16x8_from_m128i(r_[3])
+    } };
+    return r;
   #else
     simde_int16x8_private a_[4];
     #if defined(SIMDE_RISCV_V_NATIVE)
@@ -494,6 +706,16 @@ simde_int32x4x4_t
 simde_vld4q_s32(int32_t const ptr[HEDLEY_ARRAY_PARAM(16)]) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld4q_s32(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    __m128i r_[4];
+    simde_x_vld4q_x86_epi32_(r_, ptr);
+    simde_int32x4x4_t r = { {
+      simde_int32x4_from_m128i(r_[0]),
+      simde_int32x4_from_m128i(r_[1]),
+      simde_int32x4_from_m128i(r_[2]),
+      simde_int32x4_from_m128i(r_[3])
+    } };
+    return r;
   #else
     simde_int32x4_private a_[4];
     #if defined(SIMDE_RISCV_V_NATIVE)
@@ -522,6 +744,16 @@ simde_int64x2x4_t
 simde_vld4q_s64(int64_t const ptr[HEDLEY_ARRAY_PARAM(8)]) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     return vld4q_s64(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    __m128i r_[4];
+    simde_x_vld4q_x86_epi64_(r_, ptr);
+    simde_int64x2x4_t r = { {
+      simde_int64x2_from_m128i(r_[0]),
+      simde_int64x2_from_m128i(r_[1]),
+      simde_int64x2_from_m128i(r_[2]),
+      simde_int64x2_from_m128i(r_[3])
+    } };
+    return r;
   #else
     simde_int64x2_private a_[4];
     #if defined(SIMDE_RISCV_V_NATIVE)
@@ -549,6 +781,16 @@ simde_uint8x16x4_t
 simde_vld4q_u8(uint8_t const ptr[HEDLEY_ARRAY_PARAM(64)]) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld4q_u8(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    __m128i r_[4];
+    simde_x_vld4q_x86_epi8_(r_, ptr, sizeof(ptr[0]));
+    simde_uint8x16x4_t r = { {
+      simde_uint8x16_from_m128i(r_[0]),
+      simde_uint8x16_from_m128i(r_[1]),
+      simde_uint8x16_from_m128i(r_[2]),
+      simde_uint8x16_from_m128i(r_[3])
+    } };
+    return r;
   #elif defined(SIMDE_WASM_SIMD128_NATIVE)
     // Let a, b, c, d be the 4 uint8x16 to return, they are laid out in memory:
     // [a0, b0, c0, d0, a1, b1, c1, d1, a2, b2, c2, d2, a3, b3, c3, d3,
@@ -622,6 +864,16 @@ simde_uint16x8x4_t
 simde_vld4q_u16(uint16_t const ptr[HEDLEY_ARRAY_PARAM(32)]) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld4q_u16(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    __m128i r_[4];
+    simde_x_vld4q_x86_epi8_(r_, ptr, sizeof(ptr[0]));
+    simde_uint16x8x4_t r = { {
+      simde_uint16x8_from_m128i(r_[0]),
+      simde_uint16x8_from_m128i(r_[1]),
+      simde_uint16x8_from_m128i(r_[2]),
+      simde_uint16x8_from_m128i(r_[3])
+    } };
+    return r;
   #else
     simde_uint16x8_private a_[4];
     #if defined(SIMDE_RISCV_V_NATIVE)
@@ -650,6 +902,16 @@ simde_uint32x4x4_t
 simde_vld4q_u32(uint32_t const ptr[HEDLEY_ARRAY_PARAM(16)]) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld4q_u32(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    __m128i r_[4];
+    simde_x_vld4q_x86_epi32_(r_, ptr);
+    simde_uint32x4x4_t r = { {
+      simde_uint32x4_from_m128i(r_[0]),
+      simde_uint32x4_from_m128i(r_[1]),
+      simde_uint32x4_from_m128i(r_[2]),
+      simde_uint32x4_from_m128i(r_[3])
+    } };
+    return r;
   #else
     simde_uint32x4_private a_[4];
     #if defined(SIMDE_RISCV_V_NATIVE)
@@ -678,6 +940,16 @@ simde_uint64x2x4_t
 simde_vld4q_u64(uint64_t const ptr[HEDLEY_ARRAY_PARAM(8)]) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     return vld4q_u64(ptr);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    __m128i r_[4];
+    simde_x_vld4q_x86_epi64_(r_, ptr);
+    simde_uint64x2x4_t r = { {
+      simde_uint64x2_from_m128i(r_[0]),
+      simde_uint64x2_from_m128i(r_[1]),
+      simde_uint64x2_from_m128i(r_[2]),
+      simde_uint64x2_from_m128i(r_[3])
+    } };
+    return r;
   #else
     simde_uint64x2_private a_[4];
     #if defined(SIMDE_RISCV_V_NATIVE)
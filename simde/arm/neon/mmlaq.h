@@ -31,6 +31,7 @@
 #include "types.h"
 #include "cgt.h"
 #include "bsl.h"
+#include "dot.h"
 
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
@@ -42,6 +43,16 @@ simde_vmmlaq_s32(simde_int32x4_t r, simde_int8x16_t a, simde_int8x16_t b) {
   // I8MM is optional feature. src: https://patchwork.ffmpeg.org/project/ffmpeg/patch/20230530123043.52940-2-martin@martin.st/
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_MATMUL_INT8)
     return vmmlaq_s32(r, a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    /* r is a 2x2 matrix and a and b are two 8-byte rows each, so every
+     * lane of r is two 4-byte dot products: first the low halves of
+     * the rows, then the high halves. */
+    const __m128i
+      a_ = simde_int8x16_to_m128i(a),
+      b_ = simde_int8x16_to_m128i(b);
+    __m128i r_ = simde_x_vdot_x86_(simde_int32x4_to_m128i(r), _mm_shuffle_epi32(a_, _MM_SHUFFLE(2, 2, 0, 0)), _mm_shuffle_epi32(b_, _MM_SHUFFLE(2, 0, 2, 0)), 1, 1);
+    r_ = simde_x_vdot_x86_(r_, _mm_shuffle_epi32(a_, _MM_SHUFFLE(3, 3, 1, 1)), _mm_shuffle_epi32(b_, _MM_SHUFFLE(3, 1, 3, 1)), 1, 1);
+    return simde_int32x4_from_m128i(r_);
   #else
     simde_int8x16_private
       a_ = simde_int8x16_to_private(a),
@@ -125,6 +136,13 @@ simde_uint32x4_t
 simde_vmmlaq_u32(simde_uint32x4_t r, simde_uint8x16_t a, simde_uint8x16_t b) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_MATMUL_INT8)
     return vmmlaq_u32(r, a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    const __m128i
+      a_ = simde_uint8x16_to_m128i(a),
+      b_ = simde_uint8x16_to_m128i(b);
+    __m128i r_ = simde_x_vdot_x86_(simde_uint32x4_to_m128i(r), _mm_shuffle_epi32(a_, _MM_SHUFFLE(2, 2, 0, 0)), _mm_shuffle_epi32(b_, _MM_SHUFFLE(2, 0, 2, 0)), 0, 0);
+    r_ = simde_x_vdot_x86_(r_, _mm_shuffle_epi32(a_, _MM_SHUFFLE(3, 3, 1, 1)), _mm_shuffle_epi32(b_, _MM_SHUFFLE(3, 1, 3, 1)), 0, 0);
+    return simde_uint32x4_from_m128i(r_);
   #else
     simde_uint8x16_private
       a_ = simde_uint8x16_to_private(a),
@@ -209,6 +227,13 @@ simde_int32x4_t
 simde_vusmmlaq_s32(simde_int32x4_t r, simde_uint8x16_t a, simde_int8x16_t b) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_MATMUL_INT8)
     return vusmmlaq_s32(r, a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    const __m128i
+      a_ = simde_uint8x16_to_m128i(a),
+      b_ = simde_int8x16_to_m128i(b);
+    __m128i r_ = simde_x_vdot_x86_(simde_int32x4_to_m128i(r), _mm_shuffle_epi32(a_, _MM_SHUFFLE(2, 2, 0, 0)), _mm_shuffle_epi32(b_, _MM_SHUFFLE(2, 0, 2, 0)), 0, 1);
+    r_ = simde_x_vdot_x86_(r_, _mm_shuffle_epi32(a_, _MM_SHUFFLE(3, 3, 1, 1)), _mm_shuffle_epi32(b_, _MM_SHUFFLE(3, 1, 3, 1)), 0, 1);
+    return simde_int32x4_from_m128i(r_);
   #else
     simde_uint8x16_private
       a_ = simde_uint8x16_to_private(a);
@@ -86,6 +86,8 @@ simde_float32x2_t
 simde_vmul_f32(simde_float32x2_t a, simde_float32x2_t b) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vmul_f32(a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_float32x2_from_m128(_mm_mul_ps(simde_float32x2_to_m128(a), simde_float32x2_to_m128(b)));
   #else
     simde_float32x2_private
       r_,
@@ -116,6 +118,8 @@ simde_float64x1_t
 simde_vmul_f64(simde_float64x1_t a, simde_float64x1_t b) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     return vmul_f64(a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_float64x1_from_m128d(_mm_mul_sd(simde_float64x1_to_m128d(a), simde_float64x1_to_m128d(b)));
   #else
     simde_float64x1_private
       r_,
@@ -146,6 +150,15 @@ simde_int8x8_t
 simde_vmul_s8(simde_int8x8_t a, simde_int8x8_t b) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vmul_s8(a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    /* Duplicating each byte into a 16-bit lane doesn't change the low
+     * byte of the product. */
+    __m128i
+      a128 = simde_int8x8_to_m128i(a),
+      b128 = simde_int8x8_to_m128i(b);
+    __m128i r128 = _mm_mullo_epi16(_mm_unpacklo_epi8(a128, a128), _mm_unpacklo_epi8(b128, b128));
+    r128 = _mm_and_si128(r128, _mm_set1_epi16(0x00ff));
+    return simde_int8x8_from_m128i(_mm_packus_epi16(r128, r128));
   #else
     simde_int8x8_private
       r_,
@@ -176,15 +189,15 @@ simde_int16x4_t
 simde_vmul_s16(simde_int16x4_t a, simde_int16x4_t b) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vmul_s16(a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_int16x4_from_m128i(_mm_mullo_epi16(simde_int16x4_to_m128i(a), simde_int16x4_to_m128i(b)));
   #else
     simde_int16x4_private
       r_,
       a_ = simde_int16x4_to_private(a),
       b_ = simde_int16x4_to_private(b);
 
-    #if defined(SIMDE_X86_MMX_NATIVE)
-      r_.m64 = _m_pmullw(a_.m64, b_.m64);
-    #elif defined(SIMDE_RISCV_V_NATIVE)
+    #if defined(SIMDE_RISCV_V_NATIVE)
       r_.sv64 = __riscv_vmul_vv_i16m1(a_.sv64, b_.sv64, 4);
     #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS) && !defined(SIMDE_BUG_GCC_100762)
       r_.values = a_.values * b_.values;
@@ -208,6 +221,14 @@ simde_int32x2_t
 simde_vmul_s32(simde_int32x2_t a, simde_int32x2_t b) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vmul_s32(a, b);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    return simde_int32x2_from_m128i(_mm_mullo_epi32(simde_int32x2_to_m128i(a), simde_int32x2_to_m128i(b)));
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    __m128i
+      a128 = simde_int32x2_to_m128i(a),
+      b128 = simde_int32x2_to_m128i(b);
+    __m128i r128 = _mm_mul_epu32(_mm_unpacklo_epi32(a128, a128), _mm_unpacklo_epi32(b128, b128));
+    return simde_int32x2_from_m128i(_mm_shuffle_epi32(r128, _MM_SHUFFLE(2, 0, 2, 0)));
   #else
     simde_int32x2_private
       r_,
@@ -260,6 +281,13 @@ simde_uint8x8_t
 simde_vmul_u8(simde_uint8x8_t a, simde_uint8x8_t b) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vmul_u8(a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    __m128i
+      a128 = simde_uint8x8_to_m128i(a),
+      b128 = simde_uint8x8_to_m128i(b);
+    __m128i r128 = _mm_mullo_epi16(_mm_unpacklo_epi8(a128, a128), _mm_unpacklo_epi8(b128, b128));
+    r128 = _mm_and_si128(r128, _mm_set1_epi16(0x00ff));
+    return simde_uint8x8_from_m128i(_mm_packus_epi16(r128, r128));
   #else
     simde_uint8x8_private
       r_,
@@ -290,6 +318,8 @@ simde_uint16x4_t
 simde_vmul_u16(simde_uint16x4_t a, simde_uint16x4_t b) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vmul_u16(a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_uint16x4_from_m128i(_mm_mullo_epi16(simde_uint16x4_to_m128i(a), simde_uint16x4_to_m128i(b)));
   #else
     simde_uint16x4_private
       r_,
@@ -320,6 +350,14 @@ simde_uint32x2_t
 simde_vmul_u32(simde_uint32x2_t a, simde_uint32x2_t b) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vmul_u32(a, b);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    return simde_uint32x2_from_m128i(_mm_mullo_epi32(simde_uint32x2_to_m128i(a), simde_uint32x2_to_m128i(b)));
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    __m128i
+      a128 = simde_uint32x2_to_m128i(a),
+      b128 = simde_uint32x2_to_m128i(b);
+    __m128i r128 = _mm_mul_epu32(_mm_unpacklo_epi32(a128, a128), _mm_unpacklo_epi32(b128, b128));
+    return simde_uint32x2_from_m128i(_mm_shuffle_epi32(r128, _MM_SHUFFLE(2, 0, 2, 0)));
   #else
     simde_uint32x2_private
       r_,
@@ -36,6 +36,46 @@ HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
 SIMDE_BEGIN_DECLS_
 
+#if defined(SIMDE_X86_AVX2_NATIVE)
+/* Looks idx up in the table formed by the n registers in t (16 * n
+ * bytes); lanes with an out-of-range index are zero.  With VBMI the
+ * whole table fits in one register, so this is a single VPERMI2B (n
+ * == 2) or a masked VPERMB.  Otherwise every pair of registers is
+ * one 256-bit PSHUFB against the broadcast index. */
+SIMDE_FUNCTION_ATTRIBUTES
+__m128i
+simde_x_vqtbl_x86_(const __m128i t[], const int n, __m128i idx) {
+  #if defined(SIMDE_X86_AVX512VBMI_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512BW_NATIVE)
+    const __mmask16 in_range = _mm_cmplt_epu8_mask(idx, _mm_set1_epi8(HEDLEY_STATIC_CAST(char, 16 * n)));
+
+    if (n == 2)
+      return _mm_maskz_permutex2var_epi8(in_range, t[0], idx, t[1]);
+
+    __m512i table = _mm512_inserti32x4(_mm512_inserti32x4(_mm512_castsi128_si512(t[0]), t[1], 1), t[2], 2);
+    if (n > 3)
+      table = _mm512_inserti32x4(table, t[3], 3);
+    return _mm512_castsi512_si128(_mm512_maskz_permutexvar_epi8(in_range, _mm512_castsi128_si512(idx), table));
+  #else
+    /* Rebase the index for each 16-byte chunk, then saturate it so
+     * anything outside the chunk has its high bit set and PSHUFB
+     * zeroes it; the chunks can then just be ORed together. */
+    const __m256i idx256 = _mm256_broadcastsi128_si256(idx);
+    const __m256i bias = _mm256_set1_epi8(0x70);
+    const __m256i t01 = _mm256_inserti128_si256(_mm256_castsi128_si256(t[0]), t[1], 1);
+    const __m256i off01 = _mm256_inserti128_si256(_mm256_setzero_si256(), _mm_set1_epi8(16), 1);
+    __m256i r = _mm256_shuffle_epi8(t01, _mm256_adds_epu8(_mm256_sub_epi8(idx256, off01), bias));
+
+    if (n > 2) {
+      const __m256i t23 = _mm256_inserti128_si256(_mm256_castsi128_si256(t[2]), t[n - 1], 1);
+      const __m256i off23 = _mm256_inserti128_si256(_mm256_set1_epi8(32), _mm_set1_epi8(HEDLEY_STATIC_CAST(char, 16 * (n - 1))), 1);
+      r = _mm256_or_si256(r, _mm256_shuffle_epi8(t23, _mm256_adds_epu8(_mm256_sub_epi8(idx256, off23), bias)));
+    }
+
+    return _mm_or_si128(_mm256_castsi256_si128(r), _mm256_extracti128_si256(r, 1));
+  #endif
+}
+#endif
+
 SIMDE_FUNCTION_ATTRIBUTES
 simde_uint8x8_t
 simde_vqtbl1_u8(simde_uint8x16_t t, simde_uint8x8_t idx) {
@@ -99,6 +139,9 @@ simde_vqtbl2_u8(simde_uint8x16x2_t t, simde_uint8x8_t idx) {
     uint8x8x4_t split;
     simde_memcpy(&split, &t, sizeof(split));
     return vtbl4_u8(split, idx);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    const __m128i t_[2] = { simde_uint8x16_to_m128i(t.val[0]), simde_uint8x16_to_m128i(t.val[1]) };
+    return simde_uint8x8_from_m128i(simde_x_vqtbl_x86_(t_, 2, simde_uint8x8_to_m128i(idx)));
   #else
     simde_uint8x16_private t_[2] = { simde_uint8x16_to_private(t.val[0]), simde_uint8x16_to_private(t.val[1]) };
     simde_uint8x8_private
@@ -165,6 +208,9 @@ simde_vqtbl3_u8(simde_uint8x16x3_t t, simde_uint8x8_t idx) {
     uint8x8_t lo = vtbl4_u8(split_lo, idx);
     uint8x8_t hi = vtbl2_u8(split_hi, idx_hi);
     return vorr_u8(lo, hi);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    const __m128i t_[3] = { simde_uint8x16_to_m128i(t.val[0]), simde_uint8x16_to_m128i(t.val[1]), simde_uint8x16_to_m128i(t.val[2]) };
+    return simde_uint8x8_from_m128i(simde_x_vqtbl_x86_(t_, 3, simde_uint8x8_to_m128i(idx)));
   #else
     simde_uint8x16_private t_[3] = { simde_uint8x16_to_private(t.val[0]), simde_uint8x16_to_private(t.val[1]),
                                      simde_uint8x16_to_private(t.val[2]) };
@@ -236,6 +282,9 @@ simde_vqtbl4_u8(simde_uint8x16x4_t t, simde_uint8x8_t idx) {
     uint8x8_t lo = vtbl4_u8(split_lo, idx);
     uint8x8_t hi = vtbl4_u8(split_hi, idx_hi);
     return vorr_u8(lo, hi);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    const __m128i t_[4] = { simde_uint8x16_to_m128i(t.val[0]), simde_uint8x16_to_m128i(t.val[1]), simde_uint8x16_to_m128i(t.val[2]), simde_uint8x16_to_m128i(t.val[3]) };
+    return simde_uint8x8_from_m128i(simde_x_vqtbl_x86_(t_, 4, simde_uint8x8_to_m128i(idx)));
   #else
     simde_uint8x16_private t_[4] = { simde_uint8x16_to_private(t.val[0]), simde_uint8x16_to_private(t.val[1]),
                                      simde_uint8x16_to_private(t.val[2]), simde_uint8x16_to_private(t.val[3]) };
@@ -369,6 +418,9 @@ simde_vqtbl2q_u8(simde_uint8x16x2_t t, simde_uint8x16_t idx) {
     uint8x8_t lo = vtbl4_u8(split, vget_low_u8(idx));
     uint8x8_t hi = vtbl4_u8(split, vget_high_u8(idx));
     return vcombine_u8(lo, hi);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    const __m128i t_[2] = { simde_uint8x16_to_m128i(t.val[0]), simde_uint8x16_to_m128i(t.val[1]) };
+    return simde_uint8x16_from_m128i(simde_x_vqtbl_x86_(t_, 2, simde_uint8x16_to_m128i(idx)));
   #elif defined(SIMDE_POWER_ALTIVEC_P6_NATIVE)
     return vec_and(vec_perm(t.val[0], t.val[1], idx),
                   vec_cmplt(idx, vec_splats(HEDLEY_STATIC_CAST(unsigned char, 32))));
@@ -441,6 +493,9 @@ simde_vqtbl3q_u8(simde_uint8x16x3_t t, simde_uint8x16_t idx) {
     uint8x8_t lo = vtbx4_u8(hi_lo, split_lo, vget_low_u8(idx));
     uint8x8_t hi = vtbx4_u8(hi_hi, split_lo, vget_high_u8(idx));
     return vcombine_u8(lo, hi);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    const __m128i t_[3] = { simde_uint8x16_to_m128i(t.val[0]), simde_uint8x16_to_m128i(t.val[1]), simde_uint8x16_to_m128i(t.val[2]) };
+    return simde_uint8x16_from_m128i(simde_x_vqtbl_x86_(t_, 3, simde_uint8x16_to_m128i(idx)));
   #elif defined(SIMDE_POWER_ALTIVEC_P6_NATIVE)
     SIMDE_POWER_ALTIVEC_VECTOR(unsigned char) r_01 = vec_perm(t.val[0], t.val[1], idx);
     SIMDE_POWER_ALTIVEC_VECTOR(unsigned char) r_2  = vec_perm(t.val[2], t.val[2], idx);
@@ -521,6 +576,9 @@ simde_vqtbl4q_u8(simde_uint8x16x4_t t, simde_uint8x16_t idx) {
     uint8x8_t lo = vtbx4_u8(lo_lo, split_hi, vget_low_u8(idx_hi));
     uint8x8_t hi = vtbx4_u8(lo_hi, split_hi, vget_high_u8(idx_hi));
     return vcombine_u8(lo, hi);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    const __m128i t_[4] = { simde_uint8x16_to_m128i(t.val[0]), simde_uint8x16_to_m128i(t.val[1]), simde_uint8x16_to_m128i(t.val[2]), simde_uint8x16_to_m128i(t.val[3]) };
+    return simde_uint8x16_from_m128i(simde_x_vqtbl_x86_(t_, 4, simde_uint8x16_to_m128i(idx)));
   #elif defined(SIMDE_POWER_ALTIVEC_P6_NATIVE)
     SIMDE_POWER_ALTIVEC_VECTOR(unsigned char) r_01 = vec_perm(t.val[0], t.val[1], idx);
     SIMDE_POWER_ALTIVEC_VECTOR(unsigned char) r_23 = vec_perm(t.val[2], t.val[3], idx);
@@ -29,6 +29,7 @@
 #if !defined(SIMDE_ARM_NEON_QTBX_H)
 #define SIMDE_ARM_NEON_QTBX_H
 
+#include "qtbl.h"
 #include "reinterpret.h"
 #include "types.h"
 
@@ -36,6 +37,29 @@ HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
 SIMDE_BEGIN_DECLS_
 
+#if defined(SIMDE_X86_AVX2_NATIVE)
+/* simde_x_vqtbl_x86_, but lanes with an out-of-range index come from
+ * a instead of being zeroed. */
+SIMDE_FUNCTION_ATTRIBUTES
+__m128i
+simde_x_vqtbx_x86_(__m128i a, const __m128i t[], const int n, __m128i idx) {
+  #if defined(SIMDE_X86_AVX512VBMI_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512BW_NATIVE)
+    const __mmask16 in_range = _mm_cmplt_epu8_mask(idx, _mm_set1_epi8(HEDLEY_STATIC_CAST(char, 16 * n)));
+
+    if (n == 2)
+      return _mm_mask_mov_epi8(a, in_range, _mm_permutex2var_epi8(t[0], idx, t[1]));
+
+    __m512i table = _mm512_inserti32x4(_mm512_inserti32x4(_mm512_castsi128_si512(t[0]), t[1], 1), t[2], 2);
+    if (n > 3)
+      table = _mm512_inserti32x4(table, t[3], 3);
+    return _mm512_castsi512_si128(_mm512_mask_permutexvar_epi8(_mm512_castsi128_si512(a), in_range, _mm512_castsi128_si512(idx), table));
+  #else
+    const __m128i marked = _mm_or_si128(idx, _mm_cmpgt_epi8(idx, _mm_set1_epi8(HEDLEY_STATIC_CAST(char, 16 * n - 1))));
+    return _mm_blendv_epi8(simde_x_vqtbl_x86_(t, n, idx), a, marked);
+  #endif
+}
+#endif
+
 SIMDE_FUNCTION_ATTRIBUTES
 simde_uint8x8_t
 simde_vqtbx1_u8(simde_uint8x8_t a, simde_uint8x16_t t, simde_uint8x8_t idx) {
@@ -102,6 +126,9 @@ simde_vqtbx2_u8(simde_uint8x8_t a, simde_uint8x16x2_t t, simde_uint8x8_t idx) {
     uint8x8x4_t split;
     simde_memcpy(&split, &t, sizeof(split));
     return vtbx4_u8(a, split, idx);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    const __m128i t_[2] = { simde_uint8x16_to_m128i(t.val[0]), simde_uint8x16_to_m128i(t.val[1]) };
+    return simde_uint8x8_from_m128i(simde_x_vqtbx_x86_(simde_uint8x8_to_m128i(a), t_, 2, simde_uint8x8_to_m128i(idx)));
   #else
     simde_uint8x16_private t_[2] = { simde_uint8x16_to_private(t.val[0]), simde_uint8x16_to_private(t.val[1]) };
     simde_uint8x8_private
@@ -170,6 +197,9 @@ simde_vqtbx3_u8(simde_uint8x8_t a, simde_uint8x16x3_t t, simde_uint8x8_t idx) {
     simde_memcpy(&split_hi, &t.val[2], sizeof(split_hi));
     uint8x8_t hi = vtbx2_u8(a, split_hi, idx_hi);
     return vtbx4_u8(hi, split_lo, idx);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    const __m128i t_[3] = { simde_uint8x16_to_m128i(t.val[0]), simde_uint8x16_to_m128i(t.val[1]), simde_uint8x16_to_m128i(t.val[2]) };
+    return simde_uint8x8_from_m128i(simde_x_vqtbx_x86_(simde_uint8x8_to_m128i(a), t_, 3, simde_uint8x8_to_m128i(idx)));
   #else
     simde_uint8x16_private t_[3] = { simde_uint8x16_to_private(t.val[0]), simde_uint8x16_to_private(t.val[1]), simde_uint8x16_to_private(t.val[2]) };
     simde_uint8x8_private
@@ -242,6 +272,9 @@ simde_vqtbx4_u8(simde_uint8x8_t a, simde_uint8x16x4_t t, simde_uint8x8_t idx) {
     simde_memcpy(&split_hi, &t.val[2], sizeof(split_hi));
     uint8x8_t lo = vtbx4_u8(a, split_lo, idx);
     return vtbx4_u8(lo, split_hi, idx_hi);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    const __m128i t_[4] = { simde_uint8x16_to_m128i(t.val[0]), simde_uint8x16_to_m128i(t.val[1]), simde_uint8x16_to_m128i(t.val[2]), simde_uint8x16_to_m128i(t.val[3]) };
+    return simde_uint8x8_from_m128i(simde_x_vqtbx_x86_(simde_uint8x8_to_m128i(a), t_, 4, simde_uint8x8_to_m128i(idx)));
   #else
     simde_uint8x16_private t_[4] = { simde_uint8x16_to_private(t.val[0]), simde_uint8x16_to_private(t.val[1]), simde_uint8x16_to_private(t.val[2]), simde_uint8x16_to_private(t.val[3]) };
     simde_uint8x8_private
@@ -382,6 +415,9 @@ simde_vqtbx2q_u8(simde_uint8x16_t a, simde_uint8x16x2_t t, simde_uint8x16_t idx)
     uint8x8_t lo = vtbx4_u8(vget_low_u8(a), split, vget_low_u8(idx));
     uint8x8_t hi = vtbx4_u8(vget_high_u8(a), split, vget_high_u8(idx));
     return vcombine_u8(lo, hi);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    const __m128i t_[2] = { simde_uint8x16_to_m128i(t.val[0]), simde_uint8x16_to_m128i(t.val[1]) };
+    return simde_uint8x16_from_m128i(simde_x_vqtbx_x86_(simde_uint8x16_to_m128i(a), t_, 2, simde_uint8x16_to_m128i(idx)));
   #elif defined(SIMDE_POWER_ALTIVEC_P6_NATIVE)
     return vec_sel(a, vec_perm(t.val[0], t.val[1], idx),
                    vec_cmplt(idx, vec_splats(HEDLEY_STATIC_CAST(unsigned char, 32))));
@@ -458,6 +494,9 @@ simde_vqtbx3q_u8(simde_uint8x16_t a, simde_uint8x16x3_t t, simde_uint8x16_t idx)
     uint8x8_t lo_lo = vtbx4_u8(hi_lo, split_lo, vget_low_u8(idx));
     uint8x8_t lo_hi = vtbx4_u8(hi_hi, split_lo, vget_high_u8(idx));
     return vcombine_u8(lo_lo, lo_hi);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    const __m128i t_[3] = { simde_uint8x16_to_m128i(t.val[0]), simde_uint8x16_to_m128i(t.val[1]), simde_uint8x16_to_m128i(t.val[2]) };
+    return simde_uint8x16_from_m128i(simde_x_vqtbx_x86_(simde_uint8x16_to_m128i(a), t_, 3, simde_uint8x16_to_m128i(idx)));
   #elif defined(SIMDE_POWER_ALTIVEC_P6_NATIVE)
     SIMDE_POWER_ALTIVEC_VECTOR(unsigned char) r_01 = vec_perm(t.val[0], t.val[1], idx);
     SIMDE_POWER_ALTIVEC_VECTOR(unsigned char) r_2  = vec_perm(t.val[2], t.val[2], idx);
@@ -542,6 +581,9 @@ simde_vqtbx4q_u8(simde_uint8x16_t a, simde_uint8x16x4_t t, simde_uint8x16_t idx)
     uint8x8_t lo = vtbx4_u8(lo_lo, split_hi, vget_low_u8(idx_hi));
     uint8x8_t hi = vtbx4_u8(lo_hi, split_hi, vget_high_u8(idx_hi));
     return vcombine_u8(lo, hi);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    const __m128i t_[4] = { simde_uint8x16_to_m128i(t.val[0]), simde_uint8x16_to_m128i(t.val[1]), simde_uint8x16_to_m128i(t.val[2]), simde_uint8x16_to_m128i(t.val[3]) };
+    return simde_uint8x16_from_m128i(simde_x_vqtbx_x86_(simde_uint8x16_to_m128i(a), t_, 4, simde_uint8x16_to_m128i(idx)));
   #elif defined(SIMDE_POWER_ALTIVEC_P6_NATIVE)
     SIMDE_POWER_ALTIVEC_VECTOR(unsigned char) r_01 = vec_perm(t.val[0], t.val[1], idx);
     SIMDE_POWER_ALTIVEC_VECTOR(unsigned char) r_23 = vec_perm(t.val[2], t.val[3], idx);
@@ -54,6 +54,18 @@ simde_uint32x4_t
 simde_vsha1cq_u32(simde_uint32x4_t hash_abcd, uint32_t hash_e, simde_uint32x4_t wk) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_SHA2)
     return vsha1cq_u32(hash_abcd, hash_e, wk);
+  #elif defined(SIMDE_X86_SHA_NATIVE)
+    simde_uint32x4_private
+      r_,
+      x_ = simde_uint32x4_to_private(hash_abcd),
+      w_ = simde_uint32x4_to_private(wk);
+    /* sha1rnds4 keeps A in the top lane and adds the round constant
+     * itself, so reverse the lanes, take K back out of wk, and fold E
+     * into the first word. */
+    w_.m128i = _mm_sub_epi32(w_.m128i, _mm_set_epi32(HEDLEY_STATIC_CAST(int, UINT32_C(0x5A827999)), HEDLEY_STATIC_CAST(int, UINT32_C(0x5A827999)), HEDLEY_STATIC_CAST(int, UINT32_C(0x5A827999)), HEDLEY_STATIC_CAST(int, UINT32_C(0x5A827999) - hash_e)));
+    r_.m128i = _mm_sha1rnds4_epu32(_mm_shuffle_epi32(x_.m128i, 0x1b), _mm_shuffle_epi32(w_.m128i, 0x1b), 0);
+    r_.m128i = _mm_shuffle_epi32(r_.m128i, 0x1b);
+    return simde_uint32x4_from_private(r_);
   #else
     simde_uint32x4_private
       x_ = simde_uint32x4_to_private(hash_abcd),
@@ -84,6 +96,15 @@ simde_uint32x4_t
 simde_vsha1mq_u32(simde_uint32x4_t hash_abcd, uint32_t hash_e, simde_uint32x4_t wk) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_SHA2)
     return vsha1mq_u32(hash_abcd, hash_e, wk);
+  #elif defined(SIMDE_X86_SHA_NATIVE)
+    simde_uint32x4_private
+      r_,
+      x_ = simde_uint32x4_to_private(hash_abcd),
+      w_ = simde_uint32x4_to_private(wk);
+    w_.m128i = _mm_sub_epi32(w_.m128i, _mm_set_epi32(HEDLEY_STATIC_CAST(int, UINT32_C(0x8F1BBCDC)), HEDLEY_STATIC_CAST(int, UINT32_C(0x8F1BBCDC)), HEDLEY_STATIC_CAST(int, UINT32_C(0x8F1BBCDC)), HEDLEY_STATIC_CAST(int, UINT32_C(0x8F1BBCDC) - hash_e)));
+    r_.m128i = _mm_sha1rnds4_epu32(_mm_shuffle_epi32(x_.m128i, 0x1b), _mm_shuffle_epi32(w_.m128i, 0x1b), 2);
+    r_.m128i = _mm_shuffle_epi32(r_.m128i, 0x1b);
+    return simde_uint32x4_from_private(r_);
   #else
     simde_uint32x4_private
       x_ = simde_uint32x4_to_private(hash_abcd),
@@ -114,6 +135,15 @@ simde_uint32x4_t
 simde_vsha1pq_u32(simde_uint32x4_t hash_abcd, uint32_t hash_e, simde_uint32x4_t wk) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_SHA2)
     return vsha1pq_u32(hash_abcd, hash_e, wk);
+  #elif defined(SIMDE_X86_SHA_NATIVE)
+    simde_uint32x4_private
+      r_,
+      x_ = simde_uint32x4_to_private(hash_abcd),
+      w_ = simde_uint32x4_to_private(wk);
+    w_.m128i = _mm_sub_epi32(w_.m128i, _mm_set_epi32(HEDLEY_STATIC_CAST(int, UINT32_C(0x6ED9EBA1)), HEDLEY_STATIC_CAST(int, UINT32_C(0x6ED9EBA1)), HEDLEY_STATIC_CAST(int, UINT32_C(0x6ED9EBA1)), HEDLEY_STATIC_CAST(int, UINT32_C(0x6ED9EBA1) - hash_e)));
+    r_.m128i = _mm_sha1rnds4_epu32(_mm_shuffle_epi32(x_.m128i, 0x1b), _mm_shuffle_epi32(w_.m128i, 0x1b), 1);
+    r_.m128i = _mm_shuffle_epi32(r_.m128i, 0x1b);
+    return simde_uint32x4_from_private(r_);
   #else
     simde_uint32x4_private
       x_ = simde_uint32x4_to_private(hash_abcd),
@@ -144,6 +174,15 @@ simde_uint32x4_t
 simde_vsha1su0q_u32(simde_uint32x4_t w0_3, simde_uint32x4_t w4_7, simde_uint32x4_t w8_11) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_SHA2)
     return vsha1su0q_u32(w0_3, w4_7, w8_11);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_uint32x4_private
+      r_,
+      x_ = simde_uint32x4_to_private(w0_3),
+      y_ = simde_uint32x4_to_private(w4_7),
+      z_ = simde_uint32x4_to_private(w8_11);
+    r_.m128i = _mm_castpd_si128(_mm_shuffle_pd(_mm_castsi128_pd(x_.m128i), _mm_castsi128_pd(y_.m128i), 1));
+    r_.m128i = _mm_xor_si128(r_.m128i, _mm_xor_si128(x_.m128i, z_.m128i));
+    return simde_uint32x4_from_private(r_);
   #else
     simde_uint32x4_private
       r_,
@@ -171,6 +210,14 @@ simde_uint32x4_t
 simde_vsha1su1q_u32(simde_uint32x4_t tw0_3, simde_uint32x4_t tw12_15) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_SHA2)
     return vsha1su1q_u32(tw0_3, tw12_15);
+  #elif defined(SIMDE_X86_SHA_NATIVE)
+    simde_uint32x4_private
+      r_,
+      x_ = simde_uint32x4_to_private(tw0_3),
+      y_ = simde_uint32x4_to_private(tw12_15);
+    r_.m128i = _mm_sha1msg2_epu32(_mm_shuffle_epi32(x_.m128i, 0x1b), _mm_shuffle_epi32(y_.m128i, 0x1b));
+    r_.m128i = _mm_shuffle_epi32(r_.m128i, 0x1b);
+    return simde_uint32x4_from_private(r_);
   #else
     simde_uint32x4_private
       r_,
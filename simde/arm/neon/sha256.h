@@ -56,29 +56,45 @@ static uint32_t simde_SHAhashSIGMA1(uint32_t x) {
 
 static simde_uint32x4_t
 x_simde_sha256hash(simde_uint32x4_t x, simde_uint32x4_t y, simde_uint32x4_t w, int part1) {
-  uint32_t chs, maj, t;
   simde_uint32x4_private
     x_ = simde_uint32x4_to_private(x),
     y_ = simde_uint32x4_to_private(y),
     w_ = simde_uint32x4_to_private(w);
 
-  for(int i = 0; i < 4; ++i) {
-    chs = simde_SHAchoose(y_.values[0], y_.values[1], y_.values[2]);
-    maj = simde_SHAmajority(x_.values[0], x_.values[1], x_.values[2]);
-    t = y_.values[3] + simde_SHAhashSIGMA1(y_.values[0]) + chs + w_.values[i];
-    x_.values[3] = t + x_.values[3];
-    y_.values[3] = t + simde_SHAhashSIGMA0(x_.values[0]) + maj;
-    uint32_t tmp = y_.values[3];
-    y_.values[3] = 0x0 | y_.values[2];
-    y_.values[2] = 0x0 | y_.values[1];
-    y_.values[1] = 0x0 | y_.values[0];
-    y_.values[0] = 0x0 | x_.values[3];
-    x_.values[3] = 0x0 | x_.values[2];
-    x_.values[2] = 0x0 | x_.values[1];
-    x_.values[1] = 0x0 | x_.values[0];
-    x_.values[0] = tmp | 0x0;
-  }
-  return (part1 == 1) ? simde_uint32x4_from_private(x_) : simde_uint32x4_from_private(y_);
+  #if defined(SIMDE_X86_SHA_NATIVE)
+    /* sha256rnds2 wants the state as {F, E, B, A} and {H, G, D, C} and
+     * does two rounds per call.  After the second call the first state
+     * register holds the new ABEF and the second one, which is the ABEF
+     * from two rounds back, is exactly the new CDGH. */
+    __m128i abef = _mm_shuffle_epi32(_mm_unpacklo_epi64(y_.m128i, x_.m128i), 0xb1);
+    __m128i cdgh = _mm_shuffle_epi32(_mm_unpackhi_epi64(y_.m128i, x_.m128i), 0xb1);
+    cdgh = _mm_sha256rnds2_epu32(cdgh, abef, w_.m128i);
+    abef = _mm_sha256rnds2_epu32(abef, cdgh, _mm_shuffle_epi32(w_.m128i, 0x0e));
+    abef = _mm_shuffle_epi32(abef, 0xb1);
+    cdgh = _mm_shuffle_epi32(cdgh, 0xb1);
+    x_.m128i = _mm_unpackhi_epi64(abef, cdgh);
+    y_.m128i = _mm_unpacklo_epi64(abef, cdgh);
+    return (part1 == 1) ? simde_uint32x4_from_private(x_) : simde_uint32x4_from_private(y_);
+  #else
+    uint32_t chs, maj, t;
+    for(int i = 0; i < 4; ++i) {
+      chs = simde_SHAchoose(y_.values[0], y_.values[1], y_.values[2]);
+      maj = simde_SHAmajority(x_.values[0], x_.values[1], x_.values[2]);
+      t = y_.values[3] + simde_SHAhashSIGMA1(y_.values[0]) + chs + w_.values[i];
+      x_.values[3] = t + x_.values[3];
+      y_.values[3] = t + simde_SHAhashSIGMA0(x_.values[0]) + maj;
+      uint32_t tmp = y_.values[3];
+      y_.values[3] = 0x0 | y_.values[2];
+      y_.values[2] = 0x0 | y_.values[1];
+      y_.values[1] = 0x0 | y_.values[0];
+      y_.values[0] = 0x0 | x_.values[3];
+      x_.values[3] = 0x0 | x_.values[2];
+      x_.values[2] = 0x0 | x_.values[1];
+      x_.values[1] = 0x0 | x_.values[0];
+      x_.values[0] = tmp | 0x0;
+    }
+    return (part1 == 1) ? simde_uint32x4_from_private(x_) : simde_uint32x4_from_private(y_);
+  #endif
 }
 
 SIMDE_FUNCTION_ATTRIBUTES
@@ -114,6 +130,13 @@ simde_uint32x4_t
 simde_vsha256su0q_u32(simde_uint32x4_t w0_3, simde_uint32x4_t w4_7) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_SHA2)
     return vsha256su0q_u32(w0_3, w4_7);
+  #elif defined(SIMDE_X86_SHA_NATIVE)
+    simde_uint32x4_private
+      r_,
+      x_ = simde_uint32x4_to_private(w0_3),
+      y_ = simde_uint32x4_to_private(w4_7);
+    r_.m128i = _mm_sha256msg1_epu32(x_.m128i, y_.m128i);
+    return simde_uint32x4_from_private(r_);
   #else
     simde_uint32x4_private
       r_,
@@ -144,6 +167,16 @@ simde_uint32x4_t
 simde_vsha256su1q_u32(simde_uint32x4_t tw0_3, simde_uint32x4_t w8_11, simde_uint32x4_t w12_15) {
   #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_SHA2)
     return vsha256su1q_u32(tw0_3, w8_11, w12_15);
+  #elif defined(SIMDE_X86_SHA_NATIVE)
+    /* sha256msg2 only does the sigma1 half; add W[t-7] first. */
+    simde_uint32x4_private
+      r_,
+      x_ = simde_uint32x4_to_private(tw0_3),
+      y_ = simde_uint32x4_to_private(w8_11),
+      z_ = simde_uint32x4_to_private(w12_15);
+    r_.m128i = _mm_or_si128(_mm_srli_si128(y_.m128i, 4), _mm_slli_si128(z_.m128i, 12));
+    r_.m128i = _mm_sha256msg2_epu32(_mm_add_epi32(x_.m128i, r_.m128i), z_.m128i);
+    return simde_uint32x4_from_private(r_);
   #else
     simde_uint32x4_private
       r_,
@@ -38,6 +38,19 @@ SIMDE_BEGIN_DECLS_
 #define LSR(operand, shift) ((operand) >> (shift))
 #define LSL(operand, shift) ((operand) << (shift))
 
+#if defined(SIMDE_X86_SSE2_NATIVE)
+  /* Message-schedule sigma functions on both 64-bit lanes at once. */
+  #if defined(SIMDE_X86_AVX512VL_NATIVE)
+    #define SIMDE_VSHA512_ROR64_X86_(v, n) _mm_ror_epi64((v), (n))
+  #else
+    #define SIMDE_VSHA512_ROR64_X86_(v, n) _mm_or_si128(_mm_srli_epi64((v), (n)), _mm_slli_epi64((v), 64 - (n)))
+  #endif
+  #define SIMDE_VSHA512_SIG0_X86_(v) \
+    _mm_xor_si128(_mm_xor_si128(SIMDE_VSHA512_ROR64_X86_((v), 1), SIMDE_VSHA512_ROR64_X86_((v), 8)), _mm_srli_epi64((v), 7))
+  #define SIMDE_VSHA512_SIG1_X86_(v) \
+    _mm_xor_si128(_mm_xor_si128(SIMDE_VSHA512_ROR64_X86_((v), 19), SIMDE_VSHA512_ROR64_X86_((v), 61)), _mm_srli_epi64((v), 6))
+#endif
+
 SIMDE_FUNCTION_ATTRIBUTES
 simde_uint64x2_t
 simde_vsha512hq_u64(simde_uint64x2_t w, simde_uint64x2_t x, simde_uint64x2_t y) {
@@ -98,6 +111,14 @@ simde_uint64x2_t
 simde_vsha512su0q_u64(simde_uint64x2_t w, simde_uint64x2_t x) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(__ARM_FEATURE_SHA512)
     return vsha512su0q_u64(w, x);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_uint64x2_private
+      r_,
+      w_ = simde_uint64x2_to_private(w),
+      x_ = simde_uint64x2_to_private(x);
+    r_.m128i = _mm_castpd_si128(_mm_shuffle_pd(_mm_castsi128_pd(w_.m128i), _mm_castsi128_pd(x_.m128i), 1));
+    r_.m128i = _mm_add_epi64(w_.m128i, SIMDE_VSHA512_SIG0_X86_(r_.m128i));
+    return simde_uint64x2_from_private(r_);
   #else
     simde_uint64x2_private
       r_,
@@ -122,6 +143,14 @@ simde_uint64x2_t
 simde_vsha512su1q_u64(simde_uint64x2_t w, simde_uint64x2_t x, simde_uint64x2_t y) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(__ARM_FEATURE_SHA512)
     return vsha512su1q_u64(w, x, y);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_uint64x2_private
+      r_,
+      w_ = simde_uint64x2_to_private(w),
+      x_ = simde_uint64x2_to_private(x),
+      y_ = simde_uint64x2_to_private(y);
+    r_.m128i = _mm_add_epi64(_mm_add_epi64(w_.m128i, y_.m128i), SIMDE_VSHA512_SIG1_X86_(x_.m128i));
+    return simde_uint64x2_from_private(r_);
   #else
     simde_uint64x2_private
       r_,
@@ -142,6 +171,9 @@ simde_vsha512su1q_u64(simde_uint64x2_t w, simde_uint64x2_t x, simde_uint64x2_t y
   #define vsha512su1q_u64(w, x, y) simde_vsha512su1q_u64((w), (x), (y))
 #endif
 
+#undef SIMDE_VSHA512_ROR64_X86_
+#undef SIMDE_VSHA512_SIG0_X86_
+#undef SIMDE_VSHA512_SIG1_X86_
 #undef ROR64
 #undef ROL64
 #undef LSR
@@ -37,6 +37,114 @@ HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
 SIMDE_BEGIN_DECLS_
 
+#if defined(SIMDE_X86_SSSE3_NATIVE)
+/* Interleave 3-element structures of 1- or 2-byte elements: each
+ * 16-byte output chunk is the OR of one PSHUFB of every input (lanes
+ * owned by another input have the high bit set in the mask, so they
+ * come out as zero).  The 64-bit stores only write 24 bytes, so they
+ * pass chunks == 2 and store half of the second chunk. */
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_vst3_x86_epi8_(__m128i r[3], __m128i x, __m128i y, __m128i z, const size_t size, const int chunks) {
+  __m128i m[3][3];
+
+  if (size == 1) {
+    m[0][0] = _mm_setr_epi8( 0, -1, -1,  1, -1, -1,  2, -1, -1,  3, -1, -1,  4, -1, -1,  5);
+    m[0][1] = _mm_setr_epi8(-1,  0, -1, -1,  1, -1, -1,  2, -1, -1,  3, -1, -1,  4, -1, -1);
+    m[0][2] = _mm_setr_epi8(-1, -1,  0, -1, -1,  1, -1, -1,  2, -1, -1,  3, -1, -1,  4, -1);
+    m[1][0] = _mm_setr_epi8(-1, -1,  6, -1, -1,  7, -1, -1,  8, -1, -1,  9, -1, -1, 10, -1);
+    m[1][1] = _mm_setr_epi8( 5, -1, -1,  6, -1, -1,  7, -1, -1,  8, -1, -1,  9, -1, -1, 10);
+    m[1][2] = _mm_setr_epi8(-1,  5, -1, -1,  6, -1, -1,  7, -1, -1,  8, -1, -1,  9, -1, -1);
+    m[2][0] = _mm_setr_epi8(-1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1, -1);
+    m[2][1] = _mm_setr_epi8(-1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1);
+    m[2][2] = _mm_setr_epi8(10, -1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15);
+  } else {
+    m[0][0] = _mm_setr_epi8( 0,  1, -1, -1, -1, -1,  2,  3, -1, -1, -1, -1,  4,  5, -1, -1);
+    m[0][1] = _mm_setr_epi8(-1, -1,  0,  1, -1, -1, -1, -1,  2,  3, -1, -1, -1, -1,  4,  5);
+    m[0][2] = _mm_setr_epi8(-1, -1, -1, -1,  0,  1, -1, -1, -1, -1,  2,  3, -1, -1, -1, -1);
+    m[1][0] = _mm_setr_epi8(-1, -1,  6,  7, -1, -1, -1, -1,  8,  9, -1, -1, -1, -1, 10, 11);
+    m[1][1] = _mm_setr_epi8(-1, -1, -1, -1,  6,  7, -1, -1, -1, -1,  8,  9, -1, -1, -1, -1);
+    m[1][2] = _mm_setr_epi8( 4,  5, -1, -1, -1, -1,  6,  7, -1, -1, -1, -1,  8,  9, -1, -1);
+    m[2][0] = _mm_setr_epi8(-1, -1, -1, -1, 12, 13, -1, -1, -1, -1, 14, 15, -1, -1, -1, -1);
+    m[2][1] = _mm_setr_epi8(10, 11, -1, -1, -1, -1, 12, 13, -1, -1, -1, -1, 14, 15, -1, -1);
+    m[2][2] = _mm_setr_epi8(-1, -1, 10, 11, -1, -1, -1, -1, 12, 13, -1, -1, -1, -1, 14, 15);
+  }
+
+  for (int o = 0 ; o < chunks ; o++) {
+    r[o] = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(x, m[o][0]), _mm_shuffle_epi8(y, m[o][1])), _mm_shuffle_epi8(z, m[o][2]));
+  }
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_vst3q_x86_epi8_(void* ptr, __m128i x, __m128i y, __m128i z, const size_t size) {
+  #if defined(SIMDE_X86_AVX512VBMI_NATIVE) && defined(SIMDE_X86_AVX512BW_NATIVE)
+    if (size == 1) {
+      static const SIMDE_ALIGN_TO_64 uint8_t idx[64] = {
+         0, 16, 32,  1, 17, 33,  2, 18, 34,  3, 19, 35,  4, 20, 36,  5,
+        21, 37,  6, 22, 38,  7, 23, 39,  8, 24, 40,  9, 25, 41, 10, 26,
+        42, 11, 27, 43, 12, 28, 44, 13, 29, 45, 14, 30, 46, 15, 31, 47,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+      };
+      __m512i v = _mm512_inserti32x4(_mm512_inserti32x4(_mm512_castsi128_si512(x), y, 1), z, 2);
+      _mm512_mask_storeu_epi8(ptr, UINT64_C(0xffffffffffff), _mm512_permutexvar_epi8(_mm512_load_si512(HEDLEY_REINTERPRET_CAST(const void*, idx)), v));
+      return;
+    }
+  #endif
+  #if defined(SIMDE_X86_AVX512BW_NATIVE)
+    if (size == 2) {
+      static const SIMDE_ALIGN_TO_64 uint16_t idx[32] = {
+         0,  8, 16,  1,  9, 17,  2, 10, 18,  3, 11, 19,  4, 12, 20,  5,
+        13, 21,  6, 14, 22,  7, 15, 23,  0,  0,  0,  0,  0,  0,  0,  0
+      };
+      __m512i v = _mm512_inserti32x4(_mm512_inserti32x4(_mm512_castsi128_si512(x), y, 1), z, 2);
+      _mm512_mask_storeu_epi16(ptr, UINT32_C(0xffffff), _mm512_permutexvar_epi16(_mm512_load_si512(HEDLEY_REINTERPRET_CAST(const void*, idx)), v));
+      return;
+    }
+  #endif
+
+  __m128i* p = HEDLEY_REINTERPRET_CAST(__m128i*, ptr);
+  __m128i r[3];
+  simde_x_vst3_x86_epi8_(r, x, y, z, size, 3);
+  _mm_storeu_si128(p    , r[0]);
+  _mm_storeu_si128(p + 1, r[1]);
+  _mm_storeu_si128(p + 2, r[2]);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_vst3_x86_epi8_half_(void* ptr, __m128i x, __m128i y, __m128i z, const size_t size) {
+  __m128i* p = HEDLEY_REINTERPRET_CAST(__m128i*, ptr);
+  __m128i r[3];
+  simde_x_vst3_x86_epi8_(r, x, y, z, size, 2);
+  _mm_storeu_si128(p, r[0]);
+  _mm_storel_epi64(p + 1, r[1]);
+}
+#endif
+
+#if defined(SIMDE_X86_SSE2_NATIVE)
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_vst3q_x86_ps_(void* ptr, __m128 x, __m128 y, __m128 z) {
+  float* p = HEDLEY_REINTERPRET_CAST(float*, ptr);
+
+  /* x0 y0 z0 x1, y1 z1 x2 y2, z2 x3 y3 z3 */
+  _mm_storeu_ps(p    , _mm_shuffle_ps(_mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0)));
+  _mm_storeu_ps(p + 4, _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0)));
+  _mm_storeu_ps(p + 8, _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_vst3q_x86_pd_(void* ptr, __m128d x, __m128d y, __m128d z) {
+  double* p = HEDLEY_REINTERPRET_CAST(double*, ptr);
+
+  _mm_storeu_pd(p    , _mm_unpacklo_pd(x, y));
+  _mm_storeu_pd(p + 2, _mm_shuffle_pd(z, x, 2));
+  _mm_storeu_pd(p + 4, _mm_unpackhi_pd(y, z));
+}
+#endif
+
 #if !defined(SIMDE_BUG_INTEL_857088)
 
 SIMDE_FUNCTION_ATTRIBUTES
@@ -136,6 +244,12 @@ void
 simde_vst3_s8(int8_t ptr[HEDLEY_ARRAY_PARAM(24)], simde_int8x8x3_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst3_s8(ptr, val);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_x_vst3_x86_epi8_half_(ptr,
+      simde_int8x8_to_m128i(val.val[0]),
+      simde_int8x8_to_m128i(val.val[1]),
+      simde_int8x8_to_m128i(val.val[2]),
+      sizeof(ptr[0]));
   #else
     simde_int8x8_private a_[3] = { simde_int8x8_to_private(val.val[0]),
                                    simde_int8x8_to_private(val.val[1]),
@@ -183,6 +297,12 @@ void
 simde_vst3_s16(int16_t ptr[HEDLEY_ARRAY_PARAM(12)], simde_int16x4x3_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst3_s16(ptr, val);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_x_vst3_x86_epi8_half_(ptr,
+      simde_int16x4_to_m128i(val.val[0]),
+      simde_int16x4_to_m128i(val.val[1]),
+      simde_int16x4_to_m128i(val.val[2]),
+      sizeof(ptr[0]));
   #else
     simde_int16x4_private a_[3] = { simde_int16x4_to_private(val.val[0]),
                                     simde_int16x4_to_private(val.val[1]),
@@ -293,6 +413,12 @@ void
 simde_vst3_u8(uint8_t ptr[HEDLEY_ARRAY_PARAM(24)], simde_uint8x8x3_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst3_u8(ptr, val);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_x_vst3_x86_epi8_half_(ptr,
+      simde_uint8x8_to_m128i(val.val[0]),
+      simde_uint8x8_to_m128i(val.val[1]),
+      simde_uint8x8_to_m128i(val.val[2]),
+      sizeof(ptr[0]));
   #else
     simde_uint8x8_private a_[3] = { simde_uint8x8_to_private(val.val[0]),
                                     simde_uint8x8_to_private(val.val[1]),
@@ -340,6 +466,12 @@ void
 simde_vst3_u16(uint16_t ptr[HEDLEY_ARRAY_PARAM(12)], simde_uint16x4x3_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst3_u16(ptr, val);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_x_vst3_x86_epi8_half_(ptr,
+      simde_uint16x4_to_m128i(val.val[0]),
+      simde_uint16x4_to_m128i(val.val[1]),
+      simde_uint16x4_to_m128i(val.val[2]),
+      sizeof(ptr[0]));
   #else
     simde_uint16x4_private a_[3] = { simde_uint16x4_to_private(val.val[0]),
                                      simde_uint16x4_to_private(val.val[1]),
@@ -479,6 +611,11 @@ void
 simde_vst3q_f32(simde_float32_t ptr[HEDLEY_ARRAY_PARAM(12)], simde_float32x4x3_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst3q_f32(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_x_vst3q_x86_ps_(ptr,
+      simde_float32x4_to_m128(val.val[0]),
+      simde_float32x4_to_m128(val.val[1]),
+      simde_float32x4_to_m128(val.val[2]));
   #else
     simde_float32x4_private a_[3] = { simde_float32x4_to_private(val.val[0]),
                                       simde_float32x4_to_private(val.val[1]),
@@ -526,6 +663,11 @@ void
 simde_vst3q_f64(simde_float64_t ptr[HEDLEY_ARRAY_PARAM(6)], simde_float64x2x3_t val) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     vst3q_f64(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_x_vst3q_x86_pd_(ptr,
+      simde_float64x2_to_m128d(val.val[0]),
+      simde_float64x2_to_m128d(val.val[1]),
+      simde_float64x2_to_m128d(val.val[2]));
   #else
     simde_float64x2_private a[3] = { simde_float64x2_to_private(val.val[0]),
                                       simde_float64x2_to_private(val.val[1]),
@@ -562,6 +704,12 @@ void
 simde_vst3q_s8(int8_t ptr[HEDLEY_ARRAY_PARAM(48)], simde_int8x16x3_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst3q_s8(ptr, val);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_x_vst3q_x86_epi8_(ptr,
+      simde_int8x16_to_m128i(val.val[0]),
+      simde_int8x16_to_m128i(val.val[1]),
+      simde_int8x16_to_m128i(val.val[2]),
+      sizeof(ptr[0]));
   #else
     simde_int8x16_private a_[3] = { simde_int8x16_to_private(val.val[0]),
                                     simde_int8x16_to_private(val.val[1]),
@@ -614,6 +762,12 @@ void
 simde_vst3q_s16(int16_t ptr[HEDLEY_ARRAY_PARAM(24)], simde_int16x8x3_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst3q_s16(ptr, val);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_x_vst3q_x86_epi8_(ptr,
+      simde_int16x8_to_m128i(val.val[0]),
+      simde_int16x8_to_m128i(val.val[1]),
+      simde_int16x8_to_m128i(val.val[2]),
+      sizeof(ptr[0]));
   #else
     simde_int16x8_private a_[3] = { simde_int16x8_to_private(val.val[0]),
                                     simde_int16x8_to_private(val.val[1]),
@@ -661,6 +815,11 @@ void
 simde_vst3q_s32(int32_t ptr[HEDLEY_ARRAY_PARAM(12)], simde_int32x4x3_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst3q_s32(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_x_vst3q_x86_ps_(ptr,
+      _mm_castsi128_ps(simde_int32x4_to_m128i(val.val[0])),
+      _mm_castsi128_ps(simde_int32x4_to_m128i(val.val[1])),
+      _mm_castsi128_ps(simde_int32x4_to_m128i(val.val[2])));
   #else
     simde_int32x4_private a_[3] = { simde_int32x4_to_private(val.val[0]),
                                     simde_int32x4_to_private(val.val[1]),
@@ -708,6 +867,11 @@ void
 simde_vst3q_s64(int64_t ptr[HEDLEY_ARRAY_PARAM(6)], simde_int64x2x3_t val) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     vst3q_s64(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_x_vst3q_x86_pd_(ptr,
+      _mm_castsi128_pd(simde_int64x2_to_m128i(val.val[0])),
+      _mm_castsi128_pd(simde_int64x2_to_m128i(val.val[1])),
+      _mm_castsi128_pd(simde_int64x2_to_m128i(val.val[2])));
   #else
     simde_int64x2_private a[3] = { simde_int64x2_to_private(val.val[0]),
                                     simde_int64x2_to_private(val.val[1]),
@@ -745,6 +909,12 @@ void
 simde_vst3q_u8(uint8_t ptr[HEDLEY_ARRAY_PARAM(48)], simde_uint8x16x3_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst3q_u8(ptr, val);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_x_vst3q_x86_epi8_(ptr,
+      simde_uint8x16_to_m128i(val.val[0]),
+      simde_uint8x16_to_m128i(val.val[1]),
+      simde_uint8x16_to_m128i(val.val[2]),
+      sizeof(ptr[0]));
   #else
     simde_uint8x16_private a_[3] = {simde_uint8x16_to_private(val.val[0]),
                                     simde_uint8x16_to_private(val.val[1]),
@@ -828,6 +998,12 @@ void
 simde_vst3q_u16(uint16_t ptr[HEDLEY_ARRAY_PARAM(24)], simde_uint16x8x3_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst3q_u16(ptr, val);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_x_vst3q_x86_epi8_(ptr,
+      simde_uint16x8_to_m128i(val.val[0]),
+      simde_uint16x8_to_m128i(val.val[1]),
+      simde_uint16x8_to_m128i(val.val[2]),
+      sizeof(ptr[0]));
   #else
     simde_uint16x8_private a_[3] = { simde_uint16x8_to_private(val.val[0]),
                                      simde_uint16x8_to_private(val.val[1]),
@@ -876,6 +1052,11 @@ void
 simde_vst3q_u32(uint32_t ptr[HEDLEY_ARRAY_PARAM(12)], simde_uint32x4x3_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst3q_u32(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_x_vst3q_x86_ps_(ptr,
+      _mm_castsi128_ps(simde_uint32x4_to_m128i(val.val[0])),
+      _mm_castsi128_ps(simde_uint32x4_to_m128i(val.val[1])),
+      _mm_castsi128_ps(simde_uint32x4_to_m128i(val.val[2])));
   #else
     simde_uint32x4_private a_[3] = { simde_uint32x4_to_private(val.val[0]),
                                      simde_uint32x4_to_private(val.val[1]),
@@ -924,6 +1105,11 @@ void
 simde_vst3q_u64(uint64_t ptr[HEDLEY_ARRAY_PARAM(6)], simde_uint64x2x3_t val) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     vst3q_u64(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_x_vst3q_x86_pd_(ptr,
+      _mm_castsi128_pd(simde_uint64x2_to_m128i(val.val[0])),
+      _mm_castsi128_pd(simde_uint64x2_to_m128i(val.val[1])),
+      _mm_castsi128_pd(simde_uint64x2_to_m128i(val.val[2])));
   #else
     simde_uint64x2_private a[3] = { simde_uint64x2_to_private(val.val[0]),
                                      simde_uint64x2_to_private(val.val[1]),
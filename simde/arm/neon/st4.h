@@ -36,6 +36,68 @@ HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
 SIMDE_BEGIN_DECLS_
 
+#if defined(SIMDE_X86_SSE2_NATIVE)
+/* Interleaving four vectors is two rounds of unpacks: pairs of
+ * elements first, then pairs of pairs.  The 64-bit stores only need
+ * the low halves, so they pass chunks == 2. */
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_vst4_x86_(void* ptr, __m128i x, __m128i y, __m128i z, __m128i w, const size_t size, const int chunks) {
+  __m128i* p = HEDLEY_REINTERPRET_CAST(__m128i*, ptr);
+  __m128i t0, t1, t2, t3;
+
+  switch (size) {
+    case 1:
+      t0 = _mm_unpacklo_epi8(x, y);
+      t1 = _mm_unpacklo_epi8(z, w);
+      t2 = _mm_unpackhi_epi8(x, y);
+      t3 = _mm_unpackhi_epi8(z, w);
+      _mm_storeu_si128(p    , _mm_unpacklo_epi16(t0, t1));
+      _mm_storeu_si128(p + 1, _mm_unpackhi_epi16(t0, t1));
+      if (chunks > 2) {
+        _mm_storeu_si128(p + 2, _mm_unpacklo_epi16(t2, t3));
+        _mm_storeu_si128(p + 3, _mm_unpackhi_epi16(t2, t3));
+      }
+      break;
+    case 2:
+      t0 = _mm_unpacklo_epi16(x, y);
+      t1 = _mm_unpacklo_epi16(z, w);
+      t2 = _mm_unpackhi_epi16(x, y);
+      t3 = _mm_unpackhi_epi16(z, w);
+      _mm_storeu_si128(p    , _mm_unpacklo_epi32(t0, t1));
+      _mm_storeu_si128(p + 1, _mm_unpackhi_epi32(t0, t1));
+      if (chunks > 2) {
+        _mm_storeu_si128(p + 2, _mm_unpacklo_epi32(t2, t3));
+        _mm_storeu_si128(p + 3, _mm_unpackhi_epi32(t2, t3));
+      }
+      break;
+    default:
+      t0 = _mm_unpacklo_epi32(x, y);
+      t1 = _mm_unpacklo_epi32(z, w);
+      t2 = _mm_unpackhi_epi32(x, y);
+      t3 = _mm_unpackhi_epi32(z, w);
+      _mm_storeu_si128(p    , _mm_unpacklo_epi64(t0, t1));
+      _mm_storeu_si128(p + 1, _mm_unpackhi_epi64(t0, t1));
+      if (chunks > 2) {
+        _mm_storeu_si128(p + 2, _mm_unpacklo_epi64(t2, t3));
+        _mm_storeu_si128(p + 3, _mm_unpackhi_epi64(t2, t3));
+      }
+      break;
+  }
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_vst4q_x86_epi64_(void* ptr, __m128i x, __m128i y, __m128i z, __m128i w) {
+  __m128i* p = HEDLEY_REINTERPRET_CAST(__m128i*, ptr);
+
+  _mm_storeu_si128(p    , _mm_unpacklo_epi64(x, y));
+  _mm_storeu_si128(p + 1, _mm_unpacklo_epi64(z, w));
+  _mm_storeu_si128(p + 2, _mm_unpackhi_epi64(x, y));
+  _mm_storeu_si128(p + 3, _mm_unpackhi_epi64(z, w));
+}
+#endif
+
 #if !defined(SIMDE_BUG_INTEL_857088)
 
 SIMDE_FUNCTION_ATTRIBUTES
@@ -72,6 +134,14 @@ void
 simde_vst4_f32(simde_float32_t *ptr, simde_float32x2x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst4_f32(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_x_vst4_x86_(ptr,
+      _mm_castps_si128(simde_float32x2_to_m128(val.val[0])),
+      _mm_castps_si128(simde_float32x2_to_m128(val.val[1])),
+      _mm_castps_si128(simde_float32x2_to_m128(val.val[2])),
+      _mm_castps_si128(simde_float32x2_to_m128(val.val[3])),
+      sizeof(ptr[0]),
+      2);
   #else
     simde_float32x2_private a_[4] = { simde_float32x2_to_private(val.val[0]), simde_float32x2_to_private(val.val[1]),
                                       simde_float32x2_to_private(val.val[2]), simde_float32x2_to_private(val.val[3]) };
@@ -130,6 +200,14 @@ void
 simde_vst4_s8(int8_t *ptr, simde_int8x8x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst4_s8(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_x_vst4_x86_(ptr,
+      simde_int8x8_to_m128i(val.val[0]),
+      simde_int8x8_to_m128i(val.val[1]),
+      simde_int8x8_to_m128i(val.val[2]),
+      simde_int8x8_to_m128i(val.val[3]),
+      sizeof(ptr[0]),
+      2);
   #else
     simde_int8x8_private a_[4] = { simde_int8x8_to_private(val.val[0]), simde_int8x8_to_private(val.val[1]),
                                    simde_int8x8_to_private(val.val[2]), simde_int8x8_to_private(val.val[3]) };
@@ -159,6 +237,14 @@ void
 simde_vst4_s16(int16_t *ptr, simde_int16x4x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst4_s16(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_x_vst4_x86_(ptr,
+      simde_int16x4_to_m128i(val.val[0]),
+      simde_int16x4_to_m128i(val.val[1]),
+      simde_int16x4_to_m128i(val.val[2]),
+      simde_int16x4_to_m128i(val.val[3]),
+      sizeof(ptr[0]),
+      2);
   #else
     simde_int16x4_private a_[4] = { simde_int16x4_to_private(val.val[0]), simde_int16x4_to_private(val.val[1]),
                                     simde_int16x4_to_private(val.val[2]), simde_int16x4_to_private(val.val[3]) };
@@ -188,6 +274,14 @@ void
 simde_vst4_s32(int32_t *ptr, simde_int32x2x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst4_s32(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_x_vst4_x86_(ptr,
+      simde_int32x2_to_m128i(val.val[0]),
+      simde_int32x2_to_m128i(val.val[1]),
+      simde_int32x2_to_m128i(val.val[2]),
+      simde_int32x2_to_m128i(val.val[3]),
+      sizeof(ptr[0]),
+      2);
   #else
     simde_int32x2_private a_[4] = { simde_int32x2_to_private(val.val[0]), simde_int32x2_to_private(val.val[1]),
                                     simde_int32x2_to_private(val.val[2]), simde_int32x2_to_private(val.val[3]) };
@@ -246,6 +340,14 @@ void
 simde_vst4_u8(uint8_t *ptr, simde_uint8x8x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst4_u8(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_x_vst4_x86_(ptr,
+      simde_uint8x8_to_m128i(val.val[0]),
+      simde_uint8x8_to_m128i(val.val[1]),
+      simde_uint8x8_to_m128i(val.val[2]),
+      simde_uint8x8_to_m128i(val.val[3]),
+      sizeof(ptr[0]),
+      2);
   #else
     simde_uint8x8_private a_[4] = { simde_uint8x8_to_private(val.val[0]), simde_uint8x8_to_private(val.val[1]),
                                     simde_uint8x8_to_private(val.val[2]), simde_uint8x8_to_private(val.val[3]) };
@@ -275,6 +377,14 @@ void
 simde_vst4_u16(uint16_t *ptr, simde_uint16x4x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst4_u16(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_x_vst4_x86_(ptr,
+      simde_uint16x4_to_m128i(val.val[0]),
+      simde_uint16x4_to_m128i(val.val[1]),
+      simde_uint16x4_to_m128i(val.val[2]),
+      simde_uint16x4_to_m128i(val.val[3]),
+      sizeof(ptr[0]),
+      2);
   #else
     simde_uint16x4_private a_[4] = { simde_uint16x4_to_private(val.val[0]), simde_uint16x4_to_private(val.val[1]),
                                      simde_uint16x4_to_private(val.val[2]), simde_uint16x4_to_private(val.val[3]) };
@@ -304,6 +414,14 @@ void
 simde_vst4_u32(uint32_t *ptr, simde_uint32x2x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst4_u32(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_x_vst4_x86_(ptr,
+      simde_uint32x2_to_m128i(val.val[0]),
+      simde_uint32x2_to_m128i(val.val[1]),
+      simde_uint32x2_to_m128i(val.val[2]),
+      simde_uint32x2_to_m128i(val.val[3]),
+      sizeof(ptr[0]),
+      2);
   #else
     simde_uint32x2_private a_[4] = { simde_uint32x2_to_private(val.val[0]), simde_uint32x2_to_private(val.val[1]),
                                      simde_uint32x2_to_private(val.val[2]), simde_uint32x2_to_private(val.val[3]) };
@@ -391,6 +509,14 @@ void
 simde_vst4q_f32(simde_float32_t *ptr, simde_float32x4x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst4q_f32(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_x_vst4_x86_(ptr,
+      _mm_castps_si128(simde_float32x4_to_m128(val.val[0])),
+      _mm_castps_si128(simde_float32x4_to_m128(val.val[1])),
+      _mm_castps_si128(simde_float32x4_to_m128(val.val[2])),
+      _mm_castps_si128(simde_float32x4_to_m128(val.val[3])),
+      sizeof(ptr[0]),
+      4);
   #else
     simde_float32x4_private a_[4] = { simde_float32x4_to_private(val.val[0]), simde_float32x4_to_private(val.val[1]),
                                       simde_float32x4_to_private(val.val[2]), simde_float32x4_to_private(val.val[3]) };
@@ -420,6 +546,12 @@ void
 simde_vst4q_f64(simde_float64_t *ptr, simde_float64x2x4_t val) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     vst4q_f64(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_x_vst4q_x86_epi64_(ptr,
+      _mm_castpd_si128(simde_float64x2_to_m128d(val.val[0])),
+      _mm_castpd_si128(simde_float64x2_to_m128d(val.val[1])),
+      _mm_castpd_si128(simde_float64x2_to_m128d(val.val[2])),
+      _mm_castpd_si128(simde_float64x2_to_m128d(val.val[3])));
   #else
     simde_float64x2_private a_[4] = { simde_float64x2_to_private(val.val[0]), simde_float64x2_to_private(val.val[1]),
                                       simde_float64x2_to_private(val.val[2]), simde_float64x2_to_private(val.val[3]) };
@@ -449,6 +581,14 @@ void
 simde_vst4q_s8(int8_t *ptr, simde_int8x16x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst4q_s8(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_x_vst4_x86_(ptr,
+      simde_int8x16_to_m128i(val.val[0]),
+      simde_int8x16_to_m128i(val.val[1]),
+      simde_int8x16_to_m128i(val.val[2]),
+      simde_int8x16_to_m128i(val.val[3]),
+      sizeof(ptr[0]),
+      4);
   #else
     simde_int8x16_private a_[4] = { simde_int8x16_to_private(val.val[0]), simde_int8x16_to_private(val.val[1]),
                                     simde_int8x16_to_private(val.val[2]), simde_int8x16_to_private(val.val[3]) };
@@ -478,6 +618,14 @@ void
 simde_vst4q_s16(int16_t *ptr, simde_int16x8x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst4q_s16(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_x_vst4_x86_(ptr,
+      simde_int16x8_to_m128i(val.val[0]),
+      simde_int16x8_to_m128i(val.val[1]),
+      simde_int16x8_to_m128i(val.val[2]),
+      simde_int16x8_to_m128i(val.val[3]),
+      sizeof(ptr[0]),
+      4);
   #else
     simde_int16x8_private a_[4] = { simde_int16x8_to_private(val.val[0]), simde_int16x8_to_private(val.val[1]),
                                     simde_int16x8_to_private(val.val[2]), simde_int16x8_to_private(val.val[3]) };
@@ -507,6 +655,14 @@ void
 simde_vst4q_s32(int32_t *ptr, simde_int32x4x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst4q_s32(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_x_vst4_x86_(ptr,
+      simde_int32x4_to_m128i(val.val[0]),
+      simde_int32x4_to_m128i(val.val[1]),
+      simde_int32x4_to_m128i(val.val[2]),
+      simde_int32x4_to_m128i(val.val[3]),
+      sizeof(ptr[0]),
+      4);
   #else
     simde_int32x4_private a_[4] = { simde_int32x4_to_private(val.val[0]), simde_int32x4_to_private(val.val[1]),
                                     simde_int32x4_to_private(val.val[2]), simde_int32x4_to_private(val.val[3]) };
@@ -536,6 +692,12 @@ void
 simde_vst4q_s64(int64_t *ptr, simde_int64x2x4_t val) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     vst4q_s64(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_x_vst4q_x86_epi64_(ptr,
+      simde_int64x2_to_m128i(val.val[0]),
+      simde_int64x2_to_m128i(val.val[1]),
+      simde_int64x2_to_m128i(val.val[2]),
+      simde_int64x2_to_m128i(val.val[3]));
   #else
     simde_int64x2_private a_[4] = { simde_int64x2_to_private(val.val[0]), simde_int64x2_to_private(val.val[1]),
                                     simde_int64x2_to_private(val.val[2]), simde_int64x2_to_private(val.val[3]) };
@@ -566,6 +728,14 @@ void
 simde_vst4q_u8(uint8_t *ptr, simde_uint8x16x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst4q_u8(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_x_vst4_x86_(ptr,
+      simde_uint8x16_to_m128i(val.val[0]),
+      simde_uint8x16_to_m128i(val.val[1]),
+      simde_uint8x16_to_m128i(val.val[2]),
+      simde_uint8x16_to_m128i(val.val[3]),
+      sizeof(ptr[0]),
+      4);
   #else
     simde_uint8x16_private a_[4] = { simde_uint8x16_to_private(val.val[0]), simde_uint8x16_to_private(val.val[1]),
                                      simde_uint8x16_to_private(val.val[2]), simde_uint8x16_to_private(val.val[3]) };
@@ -595,6 +765,14 @@ void
 simde_vst4q_u16(uint16_t *ptr, simde_uint16x8x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst4q_u16(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_x_vst4_x86_(ptr,
+      simde_uint16x8_to_m128i(val.val[0]),
+      simde_uint16x8_to_m128i(val.val[1]),
+      simde_uint16x8_to_m128i(val.val[2]),
+      simde_uint16x8_to_m128i(val.val[3]),
+      sizeof(ptr[0]),
+      4);
   #else
     simde_uint16x8_private a_[4] = { simde_uint16x8_to_private(val.val[0]), simde_uint16x8_to_private(val.val[1]),
                                      simde_uint16x8_to_private(val.val[2]), simde_uint16x8_to_private(val.val[3]) };
@@ -624,6 +802,14 @@ void
 simde_vst4q_u32(uint32_t *ptr, simde_uint32x4x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst4q_u32(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_x_vst4_x86_(ptr,
+      simde_uint32x4_to_m128i(val.val[0]),
+      simde_uint32x4_to_m128i(val.val[1]),
+      simde_uint32x4_to_m128i(val.val[2]),
+      simde_uint32x4_to_m128i(val.val[3]),
+      sizeof(ptr[0]),
+      4);
   #else
     simde_uint32x4_private a_[4] = { simde_uint32x4_to_private(val.val[0]), simde_uint32x4_to_private(val.val[1]),
                                      simde_uint32x4_to_private(val.val[2]), simde_uint32x4_to_private(val.val[3]) };
@@ -653,6 +839,12 @@ void
 simde_vst4q_u64(uint64_t *ptr, simde_uint64x2x4_t val) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     vst4q_u64(ptr, val);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_x_vst4q_x86_epi64_(ptr,
+      simde_uint64x2_to_m128i(val.val[0]),
+      simde_uint64x2_to_m128i(val.val[1]),
+      simde_uint64x2_to_m128i(val.val[2]),
+      simde_uint64x2_to_m128i(val.val[3]));
   #else
     simde_uint64x2_private a_[4] = { simde_uint64x2_to_private(val.val[0]), simde_uint64x2_to_private(val.val[1]),
                                      simde_uint64x2_to_private(val.val[2]), simde_uint64x2_to_private(val.val[3]) };
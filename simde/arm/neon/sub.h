@@ -111,6 +111,8 @@ simde_float32x2_t
 simde_vsub_f32(simde_float32x2_t a, simde_float32x2_t b) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vsub_f32(a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_float32x2_from_m128(_mm_sub_ps(simde_float32x2_to_m128(a), simde_float32x2_to_m128(b)));
   #else
     simde_float32x2_private
       r_,
@@ -141,6 +143,8 @@ simde_float64x1_t
 simde_vsub_f64(simde_float64x1_t a, simde_float64x1_t b) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     return vsub_f64(a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_float64x1_from_m128d(_mm_sub_sd(simde_float64x1_to_m128d(a), simde_float64x1_to_m128d(b)));
   #else
     simde_float64x1_private
       r_,
@@ -171,15 +175,15 @@ simde_int8x8_t
 simde_vsub_s8(simde_int8x8_t a, simde_int8x8_t b) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vsub_s8(a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_int8x8_from_m128i(_mm_sub_epi8(simde_int8x8_to_m128i(a), simde_int8x8_to_m128i(b)));
   #else
     simde_int8x8_private
       r_,
       a_ = simde_int8x8_to_private(a),
       b_ = simde_int8x8_to_private(b);
 
-    #if defined(SIMDE_X86_MMX_NATIVE)
-      r_.m64 = _mm_sub_pi8(a_.m64, b_.m64);
-    #elif defined(SIMDE_RISCV_V_NATIVE)
+    #if defined(SIMDE_RISCV_V_NATIVE)
       r_.sv64 = __riscv_vsub_vv_i8m1(a_.sv64, b_.sv64, 8);
     #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
       r_.values = a_.values - b_.values;
@@ -203,15 +207,15 @@ simde_int16x4_t
 simde_vsub_s16(simde_int16x4_t a, simde_int16x4_t b) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vsub_s16(a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_int16x4_from_m128i(_mm_sub_epi16(simde_int16x4_to_m128i(a), simde_int16x4_to_m128i(b)));
   #else
     simde_int16x4_private
       r_,
       a_ = simde_int16x4_to_private(a),
       b_ = simde_int16x4_to_private(b);
 
-    #if defined(SIMDE_X86_MMX_NATIVE)
-      r_.m64 = _mm_sub_pi16(a_.m64, b_.m64);
-    #elif defined(SIMDE_RISCV_V_NATIVE)
+    #if defined(SIMDE_RISCV_V_NATIVE)
       r_.sv64 = __riscv_vsub_vv_i16m1(a_.sv64, b_.sv64, 4);
     #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
       r_.values = a_.values - b_.values;
@@ -235,15 +239,15 @@ simde_int32x2_t
 simde_vsub_s32(simde_int32x2_t a, simde_int32x2_t b) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vsub_s32(a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_int32x2_from_m128i(_mm_sub_epi32(simde_int32x2_to_m128i(a), simde_int32x2_to_m128i(b)));
   #else
     simde_int32x2_private
       r_,
       a_ = simde_int32x2_to_private(a),
       b_ = simde_int32x2_to_private(b);
 
-    #if defined(SIMDE_X86_MMX_NATIVE)
-      r_.m64 = _mm_sub_pi32(a_.m64, b_.m64);
-    #elif defined(SIMDE_RISCV_V_NATIVE)
+    #if defined(SIMDE_RISCV_V_NATIVE)
       r_.sv64 = __riscv_vsub_vv_i32m1(a_.sv64, b_.sv64, 2);
     #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
       r_.values = a_.values - b_.values;
@@ -267,6 +271,8 @@ simde_int64x1_t
 simde_vsub_s64(simde_int64x1_t a, simde_int64x1_t b) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vsub_s64(a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_int64x1_from_m128i(_mm_sub_epi64(simde_int64x1_to_m128i(a), simde_int64x1_to_m128i(b)));
   #else
     simde_int64x1_private
       r_,
@@ -297,6 +303,8 @@ simde_uint8x8_t
 simde_vsub_u8(simde_uint8x8_t a, simde_uint8x8_t b) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vsub_u8(a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_uint8x8_from_m128i(_mm_sub_epi8(simde_uint8x8_to_m128i(a), simde_uint8x8_to_m128i(b)));
   #else
     simde_uint8x8_private
       r_,
@@ -305,8 +313,6 @@ simde_vsub_u8(simde_uint8x8_t a, simde_uint8x8_t b) {
 
     #if defined(SIMDE_RISCV_V_NATIVE)
       r_.sv64 = __riscv_vsub_vv_u8m1(a_.sv64, b_.sv64, 8);
-    #elif defined(SIMDE_X86_MMX_NATIVE)
-      r_.m64 = _mm_sub_pi8(a_.m64, b_.m64);
     #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
       r_.values = a_.values - b_.values;
     #else
@@ -329,15 +335,15 @@ simde_uint16x4_t
 simde_vsub_u16(simde_uint16x4_t a, simde_uint16x4_t b) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vsub_u16(a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_uint16x4_from_m128i(_mm_sub_epi16(simde_uint16x4_to_m128i(a), simde_uint16x4_to_m128i(b)));
   #else
     simde_uint16x4_private
       r_,
       a_ = simde_uint16x4_to_private(a),
       b_ = simde_uint16x4_to_private(b);
 
-    #if defined(SIMDE_X86_MMX_NATIVE)
-      r_.m64 = _mm_sub_pi16(a_.m64, b_.m64);
-    #elif defined(SIMDE_RISCV_V_NATIVE)
+    #if defined(SIMDE_RISCV_V_NATIVE)
       r_.sv64 = __riscv_vsub_vv_u16m1(a_.sv64, b_.sv64, 4);
     #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
       r_.values = a_.values - b_.values;
@@ -361,15 +367,15 @@ simde_uint32x2_t
 simde_vsub_u32(simde_uint32x2_t a, simde_uint32x2_t b) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vsub_u32(a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_uint32x2_from_m128i(_mm_sub_epi32(simde_uint32x2_to_m128i(a), simde_uint32x2_to_m128i(b)));
   #else
     simde_uint32x2_private
       r_,
       a_ = simde_uint32x2_to_private(a),
       b_ = simde_uint32x2_to_private(b);
 
-    #if defined(SIMDE_X86_MMX_NATIVE)
-      r_.m64 = _mm_sub_pi32(a_.m64, b_.m64);
-    #elif defined(SIMDE_RISCV_V_NATIVE)
+    #if defined(SIMDE_RISCV_V_NATIVE)
       r_.sv64 = __riscv_vsub_vv_u32m1(a_.sv64, b_.sv64, 2);
     #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
       r_.values = a_.values - b_.values;
@@ -393,6 +399,8 @@ simde_uint64x1_t
 simde_vsub_u64(simde_uint64x1_t a, simde_uint64x1_t b) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vsub_u64(a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_uint64x1_from_m128i(_mm_sub_epi64(simde_uint64x1_to_m128i(a), simde_uint64x1_to_m128i(b)));
   #else
     simde_uint64x1_private
       r_,
@@ -42,6 +42,12 @@ simde_uint8x8_t
 simde_vtbl1_u8(simde_uint8x8_t a, simde_uint8x8_t b) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vtbl1_u8(a, b);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    __m128i
+      a128 = simde_uint8x8_to_m128i(a),
+      b128 = simde_uint8x8_to_m128i(b);
+    b128 = _mm_or_si128(b128, _mm_cmpgt_epi8(b128, _mm_set1_epi8(7)));
+    return simde_uint8x8_from_m128i(_mm_shuffle_epi8(a128, b128));
   #elif defined(SIMDE_WASM_SIMD128_NATIVE)
     simde_uint8x16_private
       r_,
@@ -58,9 +64,7 @@ simde_vtbl1_u8(simde_uint8x8_t a, simde_uint8x8_t b) {
       a_ = simde_uint8x8_to_private(a),
       b_ = simde_uint8x8_to_private(b);
 
-    #if defined(SIMDE_X86_SSSE3_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
-      r_.m64 = _mm_shuffle_pi8(a_.m64, _mm_or_si64(b_.m64, _mm_cmpgt_pi8(b_.m64, _mm_set1_pi8(7))));
-    #elif defined(SIMDE_RISCV_V_NATIVE)
+    #if defined(SIMDE_RISCV_V_NATIVE)
       vbool8_t mask = __riscv_vmsgeu_vx_u8m1_b8 (b_.sv64, 8, 8);
       r_.sv64 = __riscv_vrgather_vv_u8m1(a_.sv64 , b_.sv64 , 8);
       r_.sv64 = __riscv_vmerge_vxm_u8m1(r_.sv64, 0, mask, 8);
@@ -100,18 +104,19 @@ simde_uint8x8_t
 simde_vtbl2_u8(simde_uint8x8x2_t a, simde_uint8x8_t b) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vtbl2_u8(a, b);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    __m128i
+      a128 = _mm_unpacklo_epi64(simde_uint8x8_to_m128i(a.val[0]), simde_uint8x8_to_m128i(a.val[1])),
+      b128 = simde_uint8x8_to_m128i(b);
+    b128 = _mm_or_si128(b128, _mm_cmpgt_epi8(b128, _mm_set1_epi8(15)));
+    return simde_uint8x8_from_m128i(_mm_shuffle_epi8(a128, b128));
   #else
     simde_uint8x8_private
       r_,
       a_[2] = { simde_uint8x8_to_private(a.val[0]), simde_uint8x8_to_private(a.val[1]) },
       b_ = simde_uint8x8_to_private(b);
 
-    #if defined(SIMDE_X86_SSSE3_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
-      __m128i a128 = _mm_set_epi64(a_[1].m64, a_[0].m64);
-      __m128i b128 = _mm_set1_epi64(b_.m64);
-      __m128i r128 = _mm_shuffle_epi8(a128, _mm_or_si128(b128, _mm_cmpgt_epi8(b128, _mm_set1_epi8(15))));
-      r_.m64 = _mm_movepi64_pi64(r128);
-    #elif defined(SIMDE_RISCV_V_NATIVE)
+    #if defined(SIMDE_RISCV_V_NATIVE)
       vuint8m1_t t_combine = __riscv_vslideup_vx_u8m1(a_[0].sv64 , a_[1].sv64 , 8 , 16);
       vbool8_t mask = __riscv_vmsgeu_vx_u8m1_b8 (b_.sv64 , 16 , 8);
       vuint8m1_t r_tmp = __riscv_vrgather_vv_u8m1(t_combine , b_.sv64 , 8);
@@ -152,20 +157,19 @@ simde_uint8x8_t
 simde_vtbl3_u8(simde_uint8x8x3_t a, simde_uint8x8_t b) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vtbl3_u8(a, b);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    __m128i b128 = simde_uint8x8_to_m128i(b);
+    b128 = _mm_or_si128(b128, _mm_cmpgt_epi8(b128, _mm_set1_epi8(23)));
+    __m128i r128_01 = _mm_shuffle_epi8(_mm_unpacklo_epi64(simde_uint8x8_to_m128i(a.val[0]), simde_uint8x8_to_m128i(a.val[1])), b128);
+    __m128i r128_2  = _mm_shuffle_epi8(simde_uint8x8_to_m128i(a.val[2]), b128);
+    return simde_uint8x8_from_m128i(_mm_blendv_epi8(r128_01, r128_2, _mm_slli_epi32(b128, 3)));
   #else
     simde_uint8x8_private
       r_,
       a_[3] = { simde_uint8x8_to_private(a.val[0]), simde_uint8x8_to_private(a.val[1]), simde_uint8x8_to_private(a.val[2]) },
       b_ = simde_uint8x8_to_private(b);
 
-    #if defined(SIMDE_X86_SSE4_1_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
-      __m128i b128 = _mm_set1_epi64(b_.m64);
-      b128 = _mm_or_si128(b128, _mm_cmpgt_epi8(b128, _mm_set1_epi8(23)));
-      __m128i r128_01 = _mm_shuffle_epi8(_mm_set_epi64(a_[1].m64, a_[0].m64), b128);
-      __m128i r128_2  = _mm_shuffle_epi8(_mm_set1_epi64(a_[2].m64), b128);
-      __m128i r128 = _mm_blendv_epi8(r128_01, r128_2, _mm_slli_epi32(b128, 3));
-      r_.m64 = _mm_movepi64_pi64(r128);
-    #elif defined(SIMDE_RISCV_V_NATIVE)
+    #if defined(SIMDE_RISCV_V_NATIVE)
       vuint8m2_t t1 = __riscv_vlmul_ext_v_u8m1_u8m2 (a_[0].sv64);
       vuint8m2_t t2 = __riscv_vlmul_ext_v_u8m1_u8m2 (a_[1].sv64);
       vuint8m2_t t3 = __riscv_vlmul_ext_v_u8m1_u8m2 (a_[2].sv64);
@@ -211,20 +215,19 @@ simde_uint8x8_t
 simde_vtbl4_u8(simde_uint8x8x4_t a, simde_uint8x8_t b) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vtbl4_u8(a, b);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    __m128i b128 = simde_uint8x8_to_m128i(b);
+    b128 = _mm_or_si128(b128, _mm_cmpgt_epi8(b128, _mm_set1_epi8(31)));
+    __m128i r128_01 = _mm_shuffle_epi8(_mm_unpacklo_epi64(simde_uint8x8_to_m128i(a.val[0]), simde_uint8x8_to_m128i(a.val[1])), b128);
+    __m128i r128_23 = _mm_shuffle_epi8(_mm_unpacklo_epi64(simde_uint8x8_to_m128i(a.val[2]), simde_uint8x8_to_m128i(a.val[3])), b128);
+    return simde_uint8x8_from_m128i(_mm_blendv_epi8(r128_01, r128_23, _mm_slli_epi32(b128, 3)));
   #else
     simde_uint8x8_private
       r_,
       a_[4] = { simde_uint8x8_to_private(a.val[0]), simde_uint8x8_to_private(a.val[1]), simde_uint8x8_to_private(a.val[2]), simde_uint8x8_to_private(a.val[3]) },
       b_ = simde_uint8x8_to_private(b);
 
-    #if defined(SIMDE_X86_SSE4_1_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
-      __m128i b128 = _mm_set1_epi64(b_.m64);
-      b128 = _mm_or_si128(b128, _mm_cmpgt_epi8(b128, _mm_set1_epi8(31)));
-      __m128i r128_01 = _mm_shuffle_epi8(_mm_set_epi64(a_[1].m64, a_[0].m64), b128);
-      __m128i r128_23 = _mm_shuffle_epi8(_mm_set_epi64(a_[3].m64, a_[2].m64), b128);
-      __m128i r128 = _mm_blendv_epi8(r128_01, r128_23, _mm_slli_epi32(b128, 3));
-      r_.m64 = _mm_movepi64_pi64(r128);
-    #elif defined(SIMDE_RISCV_V_NATIVE)
+    #if defined(SIMDE_RISCV_V_NATIVE)
       vuint8m2_t t1 = __riscv_vlmul_ext_v_u8m1_u8m2 (a_[0].sv64);
       vuint8m2_t t2 = __riscv_vlmul_ext_v_u8m1_u8m2 (a_[1].sv64);
       vuint8m2_t t3 = __riscv_vlmul_ext_v_u8m1_u8m2 (a_[2].sv64);
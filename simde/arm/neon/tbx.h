@@ -41,6 +41,14 @@ simde_uint8x8_t
 simde_vtbx1_u8(simde_uint8x8_t a, simde_uint8x8_t b, simde_uint8x8_t c) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vtbx1_u8(a, b, c);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    __m128i
+      a128 = simde_uint8x8_to_m128i(a),
+      b128 = simde_uint8x8_to_m128i(b),
+      c128 = simde_uint8x8_to_m128i(c);
+    c128 = _mm_or_si128(c128, _mm_cmpgt_epi8(c128, _mm_set1_epi8(7)));
+    __m128i r128 = _mm_shuffle_epi8(b128, c128);
+    return simde_uint8x8_from_m128i(_mm_blendv_epi8(r128, a128, c128));
   #else
     simde_uint8x8_private
       r_,
@@ -48,15 +56,7 @@ simde_vtbx1_u8(simde_uint8x8_t a, simde_uint8x8_t b, simde_uint8x8_t c) {
       b_ = simde_uint8x8_to_private(b),
       c_ = simde_uint8x8_to_private(c);
 
-    #if defined(SIMDE_X86_SSE4_1_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
-      __m128i a128 = _mm_set1_epi64(a_.m64);
-      __m128i b128 = _mm_set1_epi64(b_.m64);
-      __m128i c128 = _mm_set1_epi64(c_.m64);
-      c128 = _mm_or_si128(c128, _mm_cmpgt_epi8(c128, _mm_set1_epi8(7)));
-      __m128i r128 = _mm_shuffle_epi8(b128, c128);
-      r128 =  _mm_blendv_epi8(r128, a128, c128);
-      r_.m64 = _mm_movepi64_pi64(r128);
-    #elif defined(SIMDE_RISCV_V_NATIVE)
+    #if defined(SIMDE_RISCV_V_NATIVE)
       vbool8_t mask = __riscv_vmsgeu_vx_u8m1_b8 (c_.sv64, 8, 16);
       r_.sv64 = __riscv_vrgather_vv_u8m1(b_.sv64 , c_.sv64 , 8);
       r_.sv64 = __riscv_vmerge_vvm_u8m1(r_.sv64, a_.sv64, mask, 8);
@@ -96,6 +96,14 @@ simde_uint8x8_t
 simde_vtbx2_u8(simde_uint8x8_t a, simde_uint8x8x2_t b, simde_uint8x8_t c) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vtbx2_u8(a, b, c);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    __m128i
+      a128 = simde_uint8x8_to_m128i(a),
+      b128 = _mm_unpacklo_epi64(simde_uint8x8_to_m128i(b.val[0]), simde_uint8x8_to_m128i(b.val[1])),
+      c128 = simde_uint8x8_to_m128i(c);
+    c128 = _mm_or_si128(c128, _mm_cmpgt_epi8(c128, _mm_set1_epi8(15)));
+    __m128i r128 = _mm_shuffle_epi8(b128, c128);
+    return simde_uint8x8_from_m128i(_mm_blendv_epi8(r128, a128, c128));
   #else
     simde_uint8x8_private
       r_,
@@ -103,15 +111,7 @@ simde_vtbx2_u8(simde_uint8x8_t a, simde_uint8x8x2_t b, simde_uint8x8_t c) {
       b_[2] = { simde_uint8x8_to_private(b.val[0]), simde_uint8x8_to_private(b.val[1]) },
       c_ = simde_uint8x8_to_private(c);
 
-    #if defined(SIMDE_X86_SSE4_1_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
-      __m128i a128 = _mm_set1_epi64(a_.m64);
-      __m128i b128 = _mm_set_epi64(b_[1].m64, b_[0].m64);
-      __m128i c128 = _mm_set1_epi64(c_.m64);
-      c128 = _mm_or_si128(c128, _mm_cmpgt_epi8(c128, _mm_set1_epi8(15)));
-      __m128i r128 = _mm_shuffle_epi8(b128, c128);
-      r128 =  _mm_blendv_epi8(r128, a128, c128);
-      r_.m64 = _mm_movepi64_pi64(r128);
-    #elif defined(SIMDE_RISCV_V_NATIVE)
+    #if defined(SIMDE_RISCV_V_NATIVE)
       vuint8m1_t t_combine = __riscv_vslideup_vx_u8m1(b_[0].sv64 , b_[1].sv64 , 8 , 16);
       vbool8_t mask = __riscv_vmsgeu_vx_u8m1_b8 (c_.sv64 , 16 , 8);
       vuint8m1_t r_tmp = __riscv_vrgather_vv_u8m1(t_combine , c_.sv64 , 8);
@@ -154,6 +154,15 @@ simde_uint8x8_t
 simde_vtbx3_u8(simde_uint8x8_t a, simde_uint8x8x3_t b, simde_uint8x8_t c) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vtbx3_u8(a, b, c);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    __m128i
+      a128 = simde_uint8x8_to_m128i(a),
+      c128 = simde_uint8x8_to_m128i(c);
+    c128 = _mm_or_si128(c128, _mm_cmpgt_epi8(c128, _mm_set1_epi8(23)));
+    __m128i r128_01 = _mm_shuffle_epi8(_mm_unpacklo_epi64(simde_uint8x8_to_m128i(b.val[0]), simde_uint8x8_to_m128i(b.val[1])), c128);
+    __m128i r128_2  = _mm_shuffle_epi8(simde_uint8x8_to_m128i(b.val[2]), c128);
+    __m128i r128 = _mm_blendv_epi8(r128_01, r128_2, _mm_slli_epi32(c128, 3));
+    return simde_uint8x8_from_m128i(_mm_blendv_epi8(r128, a128, c128));
   #else
     simde_uint8x8_private
       r_,
@@ -161,16 +170,7 @@ simde_vtbx3_u8(simde_uint8x8_t a, simde_uint8x8x3_t b, simde_uint8x8_t c) {
       b_[3] = { simde_uint8x8_to_private(b.val[0]), simde_uint8x8_to_private(b.val[1]), simde_uint8x8_to_private(b.val[2]) },
       c_ = simde_uint8x8_to_private(c);
 
-    #if defined(SIMDE_X86_SSE4_1_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
-      __m128i a128 = _mm_set1_epi64(a_.m64);
-      __m128i c128 = _mm_set1_epi64(c_.m64);
-      c128 = _mm_or_si128(c128, _mm_cmpgt_epi8(c128, _mm_set1_epi8(23)));
-      __m128i r128_01 = _mm_shuffle_epi8(_mm_set_epi64(b_[1].m64, b_[0].m64), c128);
-      __m128i r128_2  = _mm_shuffle_epi8(_mm_set1_epi64(b_[2].m64), c128);
-      __m128i r128 = _mm_blendv_epi8(r128_01, r128_2, _mm_slli_epi32(c128, 3));
-      r128 =  _mm_blendv_epi8(r128, a128, c128);
-      r_.m64 = _mm_movepi64_pi64(r128);
-    #elif defined(SIMDE_RISCV_V_NATIVE)
+    #if defined(SIMDE_RISCV_V_NATIVE)
       vuint8m2_t t1 = __riscv_vlmul_ext_v_u8m1_u8m2 (b_[0].sv64);
       vuint8m2_t t2 = __riscv_vlmul_ext_v_u8m1_u8m2 (b_[1].sv64);
       vuint8m2_t t3 = __riscv_vlmul_ext_v_u8m1_u8m2 (b_[2].sv64);
@@ -219,6 +219,15 @@ simde_uint8x8_t
 simde_vtbx4_u8(simde_uint8x8_t a, simde_uint8x8x4_t b, simde_uint8x8_t c) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vtbx4_u8(a, b, c);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    __m128i
+      a128 = simde_uint8x8_to_m128i(a),
+      c128 = simde_uint8x8_to_m128i(c);
+    c128 = _mm_or_si128(c128, _mm_cmpgt_epi8(c128, _mm_set1_epi8(31)));
+    __m128i r128_01 = _mm_shuffle_epi8(_mm_unpacklo_epi64(simde_uint8x8_to_m128i(b.val[0]), simde_uint8x8_to_m128i(b.val[1])), c128);
+    __m128i r128_23 = _mm_shuffle_epi8(_mm_unpacklo_epi64(simde_uint8x8_to_m128i(b.val[2]), simde_uint8x8_to_m128i(b.val[3])), c128);
+    __m128i r128 = _mm_blendv_epi8(r128_01, r128_23, _mm_slli_epi32(c128, 3));
+    return simde_uint8x8_from_m128i(_mm_blendv_epi8(r128, a128, c128));
   #else
     simde_uint8x8_private
       r_,
@@ -226,16 +235,7 @@ simde_vtbx4_u8(simde_uint8x8_t a, simde_uint8x8x4_t b, simde_uint8x8_t c) {
       b_[4] = { simde_uint8x8_to_private(b.val[0]), simde_uint8x8_to_private(b.val[1]), simde_uint8x8_to_private(b.val[2]), simde_uint8x8_to_private(b.val[3]) },
       c_ = simde_uint8x8_to_private(c);
 
-    #if defined(SIMDE_X86_SSE4_1_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
-      __m128i a128 = _mm_set1_epi64(a_.m64);
-      __m128i c128 = _mm_set1_epi64(c_.m64);
-      c128 = _mm_or_si128(c128, _mm_cmpgt_epi8(c128, _mm_set1_epi8(31)));
-      __m128i r128_01 = _mm_shuffle_epi8(_mm_set_epi64(b_[1].m64, b_[0].m64), c128);
-      __m128i r128_23 = _mm_shuffle_epi8(_mm_set_epi64(b_[3].m64, b_[2].m64), c128);
-      __m128i r128 = _mm_blendv_epi8(r128_01, r128_23,  _mm_slli_epi32(c128, 3));
-      r128 =  _mm_blendv_epi8(r128, a128, c128);
-      r_.m64 = _mm_movepi64_pi64(r128);
-    #elif defined(SIMDE_RISCV_V_NATIVE)
+    #if defined(SIMDE_RISCV_V_NATIVE)
       vuint8m2_t t1 = __riscv_vlmul_ext_v_u8m1_u8m2 (b_[0].sv64);
       vuint8m2_t t2 = __riscv_vlmul_ext_v_u8m1_u8m2 (b_[1].sv64);
       vuint8m2_t t3 = __riscv_vlmul_ext_v_u8m1_u8m2 (b_[2].sv64);
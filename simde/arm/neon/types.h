@@ -30,6 +30,7 @@
 
 #include "../../simde-common.h"
 #include "../../simde-f16.h"
+#include "../../simde-bf16.h"
 
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
@@ -469,6 +470,14 @@ typedef union {
   #endif
 } simde_poly64x2_private;
 
+typedef union {
+  simde_bfloat16 values[4];
+} simde_bfloat16x4_private;
+
+typedef union {
+  simde_bfloat16 values[8];
+} simde_bfloat16x8_private;
+
 #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
   typedef     float32_t     simde_float32_t;
   typedef       poly8_t       simde_poly8_t;
@@ -849,6 +858,16 @@ typedef union {
   #define SIMDE_ARM_NEON_NEED_PORTABLE_F64X2XN
 #endif
 
+#if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARM_NEON_BF16)
+  typedef   bfloat16_t   simde_bfloat16_t;
+  typedef bfloat16x4_t simde_bfloat16x4_t;
+  typedef bfloat16x8_t simde_bfloat16x8_t;
+#else
+  typedef      simde_bfloat16      simde_bfloat16_t;
+  typedef simde_bfloat16x4_private simde_bfloat16x4_t;
+  typedef simde_bfloat16x8_private simde_bfloat16x8_t;
+#endif
+
 #if defined(SIMDE_ARM_NEON_NEED_PORTABLE_POLY)
   typedef   simde_poly8    simde_poly8_t;
   typedef  simde_poly16   simde_poly16_t;
@@ -1330,6 +1349,9 @@ typedef union {
   typedef simde_poly64x2x3_t  poly64x2x3_t;
   typedef simde_poly64x1x4_t  poly64x1x4_t;
   typedef simde_poly64x2x4_t  poly64x2x4_t;
+  typedef   simde_bfloat16_t    bfloat16_t;
+  typedef simde_bfloat16x4_t  bfloat16x4_t;
+  typedef simde_bfloat16x8_t  bfloat16x8_t;
 #endif
 #if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
   typedef   simde_float64_t     float64_t;
@@ -1381,6 +1403,7 @@ typedef union {
   SIMDE_DEFINE_CONVERSION_FUNCTION_(simde_uint32x4_to_m128i,              __m128i,  simde_uint32x4_t)
   SIMDE_DEFINE_CONVERSION_FUNCTION_(simde_uint64x2_to_m128i,              __m128i,  simde_uint64x2_t)
   SIMDE_DEFINE_CONVERSION_FUNCTION_(simde_float64x2_to_m128d,             __m128d, simde_float64x2_t)
+  SIMDE_DEFINE_CONVERSION_FUNCTION_(simde_bfloat16x8_to_m128i,            __m128i, simde_bfloat16x8_t)
   SIMDE_DEFINE_CONVERSION_FUNCTION_(simde_int8x16_from_m128i,     simde_int8x16_t,           __m128i)
   SIMDE_DEFINE_CONVERSION_FUNCTION_(simde_int16x8_from_m128i,     simde_int16x8_t,           __m128i)
   SIMDE_DEFINE_CONVERSION_FUNCTION_(simde_int32x4_from_m128i,     simde_int32x4_t,           __m128i)
@@ -1390,6 +1413,42 @@ typedef union {
   SIMDE_DEFINE_CONVERSION_FUNCTION_(simde_uint32x4_from_m128i,   simde_uint32x4_t,           __m128i)
   SIMDE_DEFINE_CONVERSION_FUNCTION_(simde_uint64x2_from_m128i,   simde_uint64x2_t,           __m128i)
   SIMDE_DEFINE_CONVERSION_FUNCTION_(simde_float64x2_from_m128d, simde_float64x2_t,           __m128d)
+  SIMDE_DEFINE_CONVERSION_FUNCTION_(simde_bfloat16x8_from_m128i, simde_bfloat16x8_t,          __m128i)
+#endif
+
+#if defined(SIMDE_X86_SSE2_NATIVE)
+  /* The 64-bit types keep their 8-byte layout, but the x86 code paths
+   * operate on them in the low half of an XMM register instead of as
+   * __m64.  That avoids MMX entirely (no x87 aliasing or EMMS, and it
+   * works on MSVC x64, which has no MMX), and lets SSE2+ instructions
+   * be used.  The upper half is zero on the way in and ignored on the
+   * way out. */
+  #define SIMDE_ARM_NEON_TYPE_DEFINE_LOW_CONVERSIONS_(T, VT, VN, to_vt, from_vt) \
+    SIMDE_FUNCTION_ATTRIBUTES \
+    VT \
+    simde_##T##_to_##VN(simde_##T##_t v) { \
+      return to_vt(_mm_loadl_epi64(HEDLEY_REINTERPRET_CAST(const __m128i*, &v))); \
+    } \
+    \
+    SIMDE_FUNCTION_ATTRIBUTES \
+    simde_##T##_t \
+    simde_##T##_from_##VN(VT v) { \
+      simde_##T##_t r; \
+      _mm_storel_epi64(HEDLEY_REINTERPRET_CAST(__m128i*, &r), from_vt(v)); \
+      return r; \
+    }
+
+  SIMDE_ARM_NEON_TYPE_DEFINE_LOW_CONVERSIONS_(int8x8,    __m128i, m128i, ,                )
+  SIMDE_ARM_NEON_TYPE_DEFINE_LOW_CONVERSIONS_(int16x4,   __m128i, m128i, ,                )
+  SIMDE_ARM_NEON_TYPE_DEFINE_LOW_CONVERSIONS_(int32x2,   __m128i, m128i, ,                )
+  SIMDE_ARM_NEON_TYPE_DEFINE_LOW_CONVERSIONS_(int64x1,   __m128i, m128i, ,                )
+  SIMDE_ARM_NEON_TYPE_DEFINE_LOW_CONVERSIONS_(uint8x8,   __m128i, m128i, ,                )
+  SIMDE_ARM_NEON_TYPE_DEFINE_LOW_CONVERSIONS_(uint16x4,  __m128i, m128i, ,                )
+  SIMDE_ARM_NEON_TYPE_DEFINE_LOW_CONVERSIONS_(uint32x2,  __m128i, m128i, ,                )
+  SIMDE_ARM_NEON_TYPE_DEFINE_LOW_CONVERSIONS_(uint64x1,  __m128i, m128i, ,                )
+  SIMDE_ARM_NEON_TYPE_DEFINE_LOW_CONVERSIONS_(float32x2, __m128,  m128,  _mm_castsi128_ps, _mm_castps_si128)
+  SIMDE_ARM_NEON_TYPE_DEFINE_LOW_CONVERSIONS_(float64x1, __m128d, m128d, _mm_castsi128_pd, _mm_castpd_si128)
+  SIMDE_ARM_NEON_TYPE_DEFINE_LOW_CONVERSIONS_(bfloat16x4, __m128i, m128i, ,                )
 #endif
 
 #if defined(SIMDE_WASM_SIMD128_NATIVE)
@@ -1431,6 +1490,7 @@ SIMDE_ARM_NEON_TYPE_DEFINE_CONVERSIONS_(uint64x1)
 SIMDE_ARM_NEON_TYPE_DEFINE_CONVERSIONS_(float16x4)
 SIMDE_ARM_NEON_TYPE_DEFINE_CONVERSIONS_(float32x2)
 SIMDE_ARM_NEON_TYPE_DEFINE_CONVERSIONS_(float64x1)
+SIMDE_ARM_NEON_TYPE_DEFINE_CONVERSIONS_(bfloat16x4)
 SIMDE_ARM_NEON_TYPE_DEFINE_CONVERSIONS_(poly8x8)
 SIMDE_ARM_NEON_TYPE_DEFINE_CONVERSIONS_(poly16x4)
 SIMDE_ARM_NEON_TYPE_DEFINE_CONVERSIONS_(poly64x1)
@@ -1448,6 +1508,7 @@ SIMDE_ARM_NEON_TYPE_DEFINE_CONVERSIONS_(poly64x2)
 SIMDE_ARM_NEON_TYPE_DEFINE_CONVERSIONS_(float16x8)
 SIMDE_ARM_NEON_TYPE_DEFINE_CONVERSIONS_(float32x4)
 SIMDE_ARM_NEON_TYPE_DEFINE_CONVERSIONS_(float64x2)
+SIMDE_ARM_NEON_TYPE_DEFINE_CONVERSIONS_(bfloat16x8)
 
 SIMDE_END_DECLS_
 HEDLEY_DIAGNOSTIC_POP
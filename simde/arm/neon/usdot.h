@@ -31,6 +31,7 @@
 #include "types.h"
 
 #include "add.h"
+#include "dot.h"
 
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
@@ -72,6 +73,8 @@ simde_vusdot_s32(simde_int32x2_t r, simde_uint8x8_t a, simde_int8x8_t b) {
       1, 2);
 
     return simde_int32x2_from_private(r_);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_int32x2_from_m128i(simde_x_vdot_x86_(simde_int32x2_to_m128i(r), simde_uint8x8_to_m128i(a), simde_int8x8_to_m128i(b), 0, 1));
   #else
     simde_int32x2_private r_;
     simde_uint8x8_private a_ = simde_uint8x8_to_private(a);
@@ -144,6 +147,8 @@ simde_vusdotq_s32(simde_int32x4_t r, simde_uint8x16_t a, simde_int8x16_t b) {
     r_.sv128 = __riscv_vslideup_vx_i32m1(r1, __riscv_vadd_vx_i32m1(rst3, r_.values[3], 2), 3, 4);
 
     return simde_int32x4_from_private(r_);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return simde_int32x4_from_m128i(simde_x_vdot_x86_(simde_int32x4_to_m128i(r), simde_uint8x16_to_m128i(a), simde_int8x16_to_m128i(b), 0, 1));
   #else
     simde_int32x4_private r_;
     simde_uint8x16_private a_ = simde_uint8x16_to_private(a);
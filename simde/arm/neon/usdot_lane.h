@@ -28,6 +28,7 @@
 #define SIMDE_ARM_NEON_USDOT_LANE_H
 
 #include "types.h"
+#include "dot.h"
 
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
@@ -38,22 +39,30 @@ simde_int32x2_t
 simde_vusdot_lane_s32(simde_int32x2_t r, simde_uint8x8_t a, simde_int8x8_t b, const int lane)
     SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 1) {
   simde_int32x2_t result;
-  simde_int32x2_private r_ = simde_int32x2_to_private(r);
-  simde_uint8x8_private a_ = simde_uint8x8_to_private(a);
-  simde_int8x8_private b_ = simde_int8x8_to_private(b);
-
-  for (int i = 0 ; i < 2 ; i++) {
-    int32_t acc = 0;
-    SIMDE_VECTORIZE_REDUCTION(+:acc)
-    for (int j = 0 ; j < 4 ; j++) {
-      const int idx_b = j + (lane << 2);
-      const int idx_a = j + (i << 2);
-      acc += HEDLEY_STATIC_CAST(int32_t, a_.values[idx_a]) * HEDLEY_STATIC_CAST(int32_t, b_.values[idx_b]);
+  #if defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int8x8_private b_ = simde_int8x8_to_private(b);
+    int32_t b_lane_;
+    simde_memcpy(&b_lane_, &(b_.values[lane * 4]), sizeof(b_lane_));
+    const __m128i b_lane = _mm_set1_epi32(b_lane_);
+    result = simde_int32x2_from_m128i(simde_x_vdot_x86_(simde_int32x2_to_m128i(r), simde_uint8x8_to_m128i(a), b_lane, 0, 1));
+  #else
+    simde_int32x2_private r_ = simde_int32x2_to_private(r);
+    simde_uint8x8_private a_ = simde_uint8x8_to_private(a);
+    simde_int8x8_private b_ = simde_int8x8_to_private(b);
+
+    for (int i = 0 ; i < 2 ; i++) {
+      int32_t acc = 0;
+      SIMDE_VECTORIZE_REDUCTION(+:acc)
+      for (int j = 0 ; j < 4 ; j++) {
+        const int idx_b = j + (lane << 2);
+        const int idx_a = j + (i << 2);
+        acc += HEDLEY_STATIC_CAST(int32_t, a_.values[idx_a]) * HEDLEY_STATIC_CAST(int32_t, b_.values[idx_b]);
+      }
+      r_.values[i] += acc;
     }
-    r_.values[i] += acc;
-  }
 
-  result = simde_int32x2_from_private(r_);
+    result = simde_int32x2_from_private(r_);
+  #endif
 
   return result;
 }
@@ -70,22 +79,30 @@ simde_int32x2_t
 simde_vusdot_laneq_s32(simde_int32x2_t r, simde_uint8x8_t a, simde_int8x16_t b, const int lane)
     SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 3) {
   simde_int32x2_t result;
-  simde_int32x2_private r_ = simde_int32x2_to_private(r);
-  simde_uint8x8_private a_ = simde_uint8x8_to_private(a);
-  simde_int8x16_private b_ = simde_int8x16_to_private(b);
-
-  for (int i = 0 ; i < 2 ; i++) {
-    int32_t acc = 0;
-    SIMDE_VECTORIZE_REDUCTION(+:acc)
-    for (int j = 0 ; j < 4 ; j++) {
-      const int idx_b = j + (lane << 2);
-      const int idx_a = j + (i << 2);
-      acc += HEDLEY_STATIC_CAST(int32_t, a_.values[idx_a]) * HEDLEY_STATIC_CAST(int32_t, b_.values[idx_b]);
+  #if defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int8x16_private b_ = simde_int8x16_to_private(b);
+    int32_t b_lane_;
+    simde_memcpy(&b_lane_, &(b_.values[lane * 4]), sizeof(b_lane_));
+    const __m128i b_lane = _mm_set1_epi32(b_lane_);
+    result = simde_int32x2_from_m128i(simde_x_vdot_x86_(simde_int32x2_to_m128i(r), simde_uint8x8_to_m128i(a), b_lane, 0, 1));
+  #else
+    simde_int32x2_private r_ = simde_int32x2_to_private(r);
+    simde_uint8x8_private a_ = simde_uint8x8_to_private(a);
+    simde_int8x16_private b_ = simde_int8x16_to_private(b);
+
+    for (int i = 0 ; i < 2 ; i++) {
+      int32_t acc = 0;
+      SIMDE_VECTORIZE_REDUCTION(+:acc)
+      for (int j = 0 ; j < 4 ; j++) {
+        const int idx_b = j + (lane << 2);
+        const int idx_a = j + (i << 2);
+        acc += HEDLEY_STATIC_CAST(int32_t, a_.values[idx_a]) * HEDLEY_STATIC_CAST(int32_t, b_.values[idx_b]);
+      }
+      r_.values[i] += acc;
     }
-    r_.values[i] += acc;
-  }
 
-  result = simde_int32x2_from_private(r_);
+    result = simde_int32x2_from_private(r_);
+  #endif
 
   return result;
 }
@@ -102,22 +119,31 @@ simde_int32x4_t
 simde_vusdotq_laneq_s32(simde_int32x4_t r, simde_uint8x16_t a, simde_int8x16_t b, const int lane)
     SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 3) {
   simde_int32x4_t result;
-  simde_int32x4_private r_ = simde_int32x4_to_private(r);
-  simde_uint8x16_private a_ = simde_uint8x16_to_private(a);
-  simde_int8x16_private b_ = simde_int8x16_to_private(b);
-
-  for(int i = 0 ; i < 4 ; i++) {
-    int32_t acc = 0;
-    SIMDE_VECTORIZE_REDUCTION(+:acc)
-    for(int j = 0 ; j < 4 ; j++) {
-      const int idx_b = j + (lane << 2);
-      const int idx_a = j + (i << 2);
-      acc += HEDLEY_STATIC_CAST(int32_t, a_.values[idx_a]) * HEDLEY_STATIC_CAST(int32_t, b_.values[idx_b]);
+  #if defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int8x16_private b_ = simde_int8x16_to_private(b);
+    int32_t b_lane_;
+    simde_memcpy(&b_lane_, &(b_.values[lane * 4]), sizeof(b_lane_));
+    const __m128i b_lane = _mm_set1_epi32(b_lane_);
+    result = simde_int32x4_from_m128i(simde_x_vdot_x86_(simde_int32x4_to_m128i(r), simde_uint8x16_to_m128i(a), b_lane, 0, 1));
+  #else
+    simde_int32x4_private r_ = simde_int32x4_to_private(r);
+    simde_uint8x16_private a_ = simde_uint8x16_to_private(a);
+    simde_int8x16_private b_ = simde_int8x16_to_private(b);
+
+    for(int i = 0 ; i < 4 ; i++) {
+      int32_t acc = 0;
+      SIMDE_VECTORIZE_REDUCTION(+:acc)
+      for(int j = 0 ; j < 4 ; j++) {
+        const int idx_b = j + (lane << 2);
+        const int idx_a = j + (i << 2);
+        acc += HEDLEY_STATIC_CAST(int32_t, a_.values[idx_a]) * HEDLEY_STATIC_CAST(int32_t, b_.values[idx_b]);
+      }
+      r_.values[i] += acc;
     }
-    r_.values[i] += acc;
-  }
 
-  result = simde_int32x4_from_private(r_);
+    result = simde_int32x4_from_private(r_);
+  #endif
+
   return result;
 }
 #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(__ARM_FEATURE_MATMUL_INT8)
@@ -133,22 +159,31 @@ simde_int32x4_t
 simde_vusdotq_lane_s32(simde_int32x4_t r, simde_uint8x16_t a, simde_int8x8_t b, const int lane)
     SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 1) {
   simde_int32x4_t result;
-  simde_int32x4_private r_ = simde_int32x4_to_private(r);
-  simde_uint8x16_private a_ = simde_uint8x16_to_private(a);
-  simde_int8x8_private b_ = simde_int8x8_to_private(b);
-
-  for(int i = 0 ; i < 4 ; i++) {
-    int32_t acc = 0;
-    SIMDE_VECTORIZE_REDUCTION(+:acc)
-    for(int j = 0 ; j < 4 ; j++) {
-      const int idx_b = j + (lane << 2);
-      const int idx_a = j + (i << 2);
-      acc += HEDLEY_STATIC_CAST(int32_t, a_.values[idx_a]) * HEDLEY_STATIC_CAST(int32_t, b_.values[idx_b]);
+  #if defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int8x8_private b_ = simde_int8x8_to_private(b);
+    int32_t b_lane_;
+    simde_memcpy(&b_lane_, &(b_.values[lane * 4]), sizeof(b_lane_));
+    const __m128i b_lane = _mm_set1_epi32(b_lane_);
+    result = simde_int32x4_from_m128i(simde_x_vdot_x86_(simde_int32x4_to_m128i(r), simde_uint8x16_to_m128i(a), b_lane, 0, 1));
+  #else
+    simde_int32x4_private r_ = simde_int32x4_to_private(r);
+    simde_uint8x16_private a_ = simde_uint8x16_to_private(a);
+    simde_int8x8_private b_ = simde_int8x8_to_private(b);
+
+    for(int i = 0 ; i < 4 ; i++) {
+      int32_t acc = 0;
+      SIMDE_VECTORIZE_REDUCTION(+:acc)
+      for(int j = 0 ; j < 4 ; j++) {
+        const int idx_b = j + (lane << 2);
+        const int idx_a = j + (i << 2);
+        acc += HEDLEY_STATIC_CAST(int32_t, a_.values[idx_a]) * HEDLEY_STATIC_CAST(int32_t, b_.values[idx_b]);
+      }
+      r_.values[i] += acc;
     }
-    r_.values[i] += acc;
-  }
 
-  result = simde_int32x4_from_private(r_);
+    result = simde_int32x4_from_private(r_);
+  #endif
+
   return result;
 }
 #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_MATMUL_INT8)
@@ -312,6 +312,27 @@
 #  if defined(__AVX512VNNI__)
 #    define SIMDE_ARCH_X86_AVX512VNNI 1
 #  endif
+#  if defined(__AVX512IFMA__)
+#    define SIMDE_ARCH_X86_AVX512IFMA 1
+#  endif
+#  if defined(__AVXVNNI__)
+#    define SIMDE_ARCH_X86_AVXVNNI 1
+#  endif
+#  if defined(__AVXIFMA__)
+#    define SIMDE_ARCH_X86_AVXIFMA 1
+#  endif
+#  if defined(__AVXNECONVERT__)
+#    define SIMDE_ARCH_X86_AVXNECONVERT 1
+#  endif
+#  if defined(__AMX_TILE__)
+#    define SIMDE_ARCH_X86_AMX_TILE 1
+#  endif
+#  if defined(__AMX_INT8__)
+#    define SIMDE_ARCH_X86_AMX_INT8 1
+#  endif
+#  if defined(__AMX_BF16__)
+#    define SIMDE_ARCH_X86_AMX_BF16 1
+#  endif
 #  if defined(__AVX5124VNNIW__)
 #    define SIMDE_ARCH_X86_AVX5124VNNIW 1
 #  endif
@@ -351,6 +372,12 @@
 #  if defined(__AES__)
 #    define SIMDE_ARCH_X86_AES 1
 #  endif
+#  if defined(__VAES__)
+#    define SIMDE_ARCH_X86_VAES 1
+#  endif
+#  if defined(__SHA__)
+#    define SIMDE_ARCH_X86_SHA 1
+#  endif
 #endif
 
 /* Itanium
@@ -624,6 +651,11 @@
 #  define SIMDE_ARCH_ARM_NEON_FP16
 #endif
 
+/* Availability of bfloat16 arithmetic intrinsics */
+#if defined(__ARM_FEATURE_BF16_VECTOR_ARITHMETIC)
+#  define SIMDE_ARCH_ARM_NEON_BF16
+#endif
+
 /* LoongArch
    <https://en.wikipedia.org/wiki/Loongson#LoongArch> */
 #if defined(__loongarch32)
@@ -0,0 +1,97 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "hedley.h"
+#include "simde-common.h"
+#include "simde-detect-clang.h"
+
+#if !defined(SIMDE_BFLOAT16_H)
+#define SIMDE_BFLOAT16_H
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* Portable version; the value is just the upper 16 bits of the
+ * corresponding binary32. */
+#define SIMDE_BFLOAT16_API_PORTABLE 1
+/* __bf16, when the compiler supports it as an arithmetic type (it
+ * defines the __BFLT16_* macros in that case). */
+#define SIMDE_BFLOAT16_API_BF16 2
+
+#if !defined(SIMDE_BFLOAT16_API)
+  #if defined(__BFLT16_MAX__) && (HEDLEY_GCC_VERSION_CHECK(13,0,0) || SIMDE_DETECT_CLANG_VERSION_CHECK(17,0,0))
+    #define SIMDE_BFLOAT16_API SIMDE_BFLOAT16_API_BF16
+  #else
+    #define SIMDE_BFLOAT16_API SIMDE_BFLOAT16_API_PORTABLE
+  #endif
+#endif
+
+#if SIMDE_BFLOAT16_API == SIMDE_BFLOAT16_API_BF16
+  typedef __bf16 simde_bfloat16;
+  #define SIMDE_BFLOAT16_IS_SCALAR 1
+#elif SIMDE_BFLOAT16_API == SIMDE_BFLOAT16_API_PORTABLE
+  typedef struct { uint16_t value; } simde_bfloat16;
+#else
+  #error No bfloat16 API.
+#endif
+
+SIMDE_DEFINE_CONVERSION_FUNCTION_(simde_bfloat16_as_uint16,       uint16_t, simde_bfloat16)
+SIMDE_DEFINE_CONVERSION_FUNCTION_(simde_uint16_as_bfloat16, simde_bfloat16,       uint16_t)
+
+/* Conversion from binary32 rounds to nearest-even and quiets NaNs,
+ * like a C cast to __bf16.  Note that this is *not* what the x86
+ * VCVTNEPS2BF16 instruction does: it also flushes denormal inputs to
+ * zero. */
+static HEDLEY_ALWAYS_INLINE HEDLEY_CONST
+simde_bfloat16
+simde_bfloat16_from_float32 (simde_float32 value) {
+  #if SIMDE_BFLOAT16_API == SIMDE_BFLOAT16_API_BF16
+    return HEDLEY_STATIC_CAST(simde_bfloat16, value);
+  #else
+    uint32_t f32u = simde_float32_as_uint32(value);
+
+    if ((f32u & UINT32_C(0x7FFFFFFF)) > UINT32_C(0x7F800000))
+      return simde_uint16_as_bfloat16(HEDLEY_STATIC_CAST(uint16_t, (f32u >> 16) | UINT32_C(0x0040)));
+
+    f32u += UINT32_C(0x7FFF) + ((f32u >> 16) & 1);
+    return simde_uint16_as_bfloat16(HEDLEY_STATIC_CAST(uint16_t, f32u >> 16));
+  #endif
+}
+
+static HEDLEY_ALWAYS_INLINE HEDLEY_CONST
+simde_float32
+simde_bfloat16_to_float32 (simde_bfloat16 value) {
+  #if SIMDE_BFLOAT16_API == SIMDE_BFLOAT16_API_BF16
+    return HEDLEY_STATIC_CAST(simde_float32, value);
+  #else
+    return simde_uint32_as_float32(HEDLEY_STATIC_CAST(uint32_t, simde_bfloat16_as_uint16(value)) << 16);
+  #endif
+}
+
+#define SIMDE_BFLOAT16_VALUE(value) simde_bfloat16_from_float32(SIMDE_FLOAT32_C(value))
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_BFLOAT16_H) */
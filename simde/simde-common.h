@@ -543,6 +543,23 @@ HEDLEY_DIAGNOSTIC_POP
 #  endif
 #endif
 
+/* On x86 the builtin is a libgcc call unless POPCNT is enabled, which
+ * is slower than doing it inline. */
+#if \
+    (HEDLEY_HAS_BUILTIN(__builtin_popcountll) || HEDLEY_GCC_VERSION_CHECK(3,4,0)) && \
+    ((!defined(SIMDE_ARCH_X86) && !defined(SIMDE_ARCH_AMD64)) || defined(__POPCNT__))
+  #define simde_popcount64(v) HEDLEY_STATIC_CAST(unsigned int, __builtin_popcountll(v))
+#else
+  SIMDE_FUNCTION_ATTRIBUTES
+  unsigned int
+  simde_popcount64(uint64_t v) {
+    v = v - ((v >> 1) & UINT64_C(0x5555555555555555));
+    v = (v & UINT64_C(0x3333333333333333)) + ((v >> 2) & UINT64_C(0x3333333333333333));
+    v = (v + (v >> 4)) & UINT64_C(0x0F0F0F0F0F0F0F0F);
+    return HEDLEY_STATIC_CAST(unsigned int, (v * UINT64_C(0x0101010101010101)) >> 56);
+  }
+#endif
+
 /* TODO: we should at least make an attempt to detect the correct
    types for simde_float32/float64 instead of just assuming float and
    double. */
@@ -0,0 +1,373 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Runtime dispatch.
+ *
+ * SIMDe chooses between native and portable implementations while
+ * preprocessing (see simde-features.h), so a single translation unit
+ * can only ever target one ISA level.  What we can do is let you
+ * compile the same kernel several times, once per target level, and
+ * pick the best copy at runtime:
+ *
+ *   // kernel.c, built with -march=x86-64, -march=x86-64-v3 and
+ *   // -march=x86-64-v4 (three objects)
+ *   #include "simde/x86/avx512.h"
+ *   #include "simde/simde-dispatch.h"
+ *   void SIMDE_DISPATCH_NAME(my_kernel) (float* x, size_t n) { ... }
+ *
+ *   // dispatch.c, built once for the baseline
+ *   #include "simde/simde-dispatch.h"
+ *   typedef void my_kernel_fn (float* x, size_t n);
+ *   SIMDE_DISPATCH_DEFINE(my_kernel_fn, my_kernel)
+ *   ...
+ *   SIMDE_DISPATCH(my_kernel)(x, n);
+ *
+ * SIMDE_DISPATCH_NAME appends a suffix for the level the current
+ * translation unit was compiled for (_portable, _x86_64_v1 through
+ * _x86_64_v4).  SIMDE_DISPATCH_DEFINE declares every variant and
+ * defines a resolver which probes the CPU (cpuid + xgetbv on x86), picks
+ * the highest level both the CPU and the build provide, and caches the
+ * result so every call after the first is a single indirect call.
+ *
+ * The levels above the one dispatch.c is built for are declared weak
+ * where the toolchain supports it, so you only need to build the levels
+ * you care about plus the one you use as a baseline; the baseline
+ * itself is always required.  Without weak symbols (e.g., MSVC) every
+ * level above the baseline must be linked in.
+ *
+ * All of this is opt-in: unless SIMDE_ENABLE_RUNTIME_DISPATCH is
+ * defined, SIMDE_DISPATCH(name) is just a direct call to the variant
+ * matching the current translation unit, and SIMDE_DISPATCH_DEFINE
+ * expands to nothing.
+ *
+ * For code which only relies on SIMDe's portable implementations
+ * (i.e., built with SIMDE_NO_NATIVE or where no native implementation
+ * exists) there is also SIMDE_DISPATCH_TARGET_CLONES, which asks the
+ * compiler to emit one clone per x86-64 level and select between them
+ * with an ifunc resolver; the vector extensions SIMDe uses internally
+ * are then lowered to the widest registers available. */
+
+#if !defined(SIMDE_DISPATCH_H)
+#define SIMDE_DISPATCH_H
+
+#include "hedley.h"
+#include "simde-common.h"
+
+#if defined(SIMDE_ARCH_X86) || defined(SIMDE_ARCH_AMD64)
+  #if defined(_MSC_VER)
+    #include <intrin.h>
+  #elif defined(__GNUC__) || defined(__clang__)
+    #include <cpuid.h>
+  #endif
+#endif
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* These mirror the x86-64 micro-architecture levels from the psABI:
+ *   v1: SSE, SSE2
+ *   v2: SSE3, SSSE3, SSE4.1, SSE4.2, POPCNT
+ *   v3: AVX, AVX2, FMA, F16C, BMI1, BMI2, LZCNT, MOVBE
+ *   v4: AVX-512F, AVX-512BW, AVX-512CD, AVX-512DQ, AVX-512VL */
+#define SIMDE_DISPATCH_LEVEL_PORTABLE  0
+#define SIMDE_DISPATCH_LEVEL_X86_64_V1 1
+#define SIMDE_DISPATCH_LEVEL_X86_64_V2 2
+#define SIMDE_DISPATCH_LEVEL_X86_64_V3 3
+#define SIMDE_DISPATCH_LEVEL_X86_64_V4 4
+
+#if !defined(SIMDE_DISPATCH_COMPILED_LEVEL)
+  #if \
+      defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512BW_NATIVE) && \
+      defined(SIMDE_X86_AVX512CD_NATIVE) && defined(SIMDE_X86_AVX512DQ_NATIVE) && \
+      defined(SIMDE_X86_AVX512VL_NATIVE)
+    #define SIMDE_DISPATCH_COMPILED_LEVEL SIMDE_DISPATCH_LEVEL_X86_64_V4
+  #elif defined(SIMDE_X86_AVX2_NATIVE) && defined(SIMDE_X86_FMA_NATIVE) && defined(SIMDE_X86_F16C_NATIVE)
+    #define SIMDE_DISPATCH_COMPILED_LEVEL SIMDE_DISPATCH_LEVEL_X86_64_V3
+  #elif defined(SIMDE_X86_SSE4_2_NATIVE)
+    #define SIMDE_DISPATCH_COMPILED_LEVEL SIMDE_DISPATCH_LEVEL_X86_64_V2
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    #define SIMDE_DISPATCH_COMPILED_LEVEL SIMDE_DISPATCH_LEVEL_X86_64_V1
+  #else
+    #define SIMDE_DISPATCH_COMPILED_LEVEL SIMDE_DISPATCH_LEVEL_PORTABLE
+  #endif
+#endif
+
+#if SIMDE_DISPATCH_COMPILED_LEVEL == SIMDE_DISPATCH_LEVEL_X86_64_V4
+  #define SIMDE_DISPATCH_SUFFIX _x86_64_v4
+#elif SIMDE_DISPATCH_COMPILED_LEVEL == SIMDE_DISPATCH_LEVEL_X86_64_V3
+  #define SIMDE_DISPATCH_SUFFIX _x86_64_v3
+#elif SIMDE_DISPATCH_COMPILED_LEVEL == SIMDE_DISPATCH_LEVEL_X86_64_V2
+  #define SIMDE_DISPATCH_SUFFIX _x86_64_v2
+#elif SIMDE_DISPATCH_COMPILED_LEVEL == SIMDE_DISPATCH_LEVEL_X86_64_V1
+  #define SIMDE_DISPATCH_SUFFIX _x86_64_v1
+#else
+  #define SIMDE_DISPATCH_SUFFIX _portable
+#endif
+
+#define SIMDE_DISPATCH_NAME(name) HEDLEY_CONCAT(name, SIMDE_DISPATCH_SUFFIX)
+
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_x_dispatch_probe_cpu_level_ (void) {
+  #if (defined(SIMDE_ARCH_X86) || defined(SIMDE_ARCH_AMD64)) && (defined(_MSC_VER) || defined(__GNUC__) || defined(__clang__))
+    uint32_t leaf1_ecx, leaf1_edx, leaf7_ebx, ext1_ecx, max_leaf, max_ext_leaf;
+    uint64_t xcr0 = 0;
+    int level = SIMDE_DISPATCH_LEVEL_PORTABLE;
+
+    #if defined(_MSC_VER)
+      int regs[4];
+      __cpuid(regs, 0);
+      max_leaf = HEDLEY_STATIC_CAST(uint32_t, regs[0]);
+      __cpuid(regs, 1);
+      leaf1_ecx = HEDLEY_STATIC_CAST(uint32_t, regs[2]);
+      leaf1_edx = HEDLEY_STATIC_CAST(uint32_t, regs[3]);
+      if (max_leaf >= 7) {
+        __cpuidex(regs, 7, 0);
+        leaf7_ebx = HEDLEY_STATIC_CAST(uint32_t, regs[1]);
+      } else {
+        leaf7_ebx = 0;
+      }
+      __cpuid(regs, HEDLEY_STATIC_CAST(int, 0x80000000));
+      max_ext_leaf = HEDLEY_STATIC_CAST(uint32_t, regs[0]);
+      if (max_ext_leaf >= UINT32_C(0x80000001)) {
+        __cpuid(regs, HEDLEY_STATIC_CAST(int, 0x80000001));
+        ext1_ecx = HEDLEY_STATIC_CAST(uint32_t, regs[2]);
+      } else {
+        ext1_ecx = 0;
+      }
+      if (leaf1_ecx & (UINT32_C(1) << 27))
+        xcr0 = HEDLEY_STATIC_CAST(uint64_t, _xgetbv(0));
+    #else
+      unsigned int eax, ebx, ecx, edx;
+      max_leaf = HEDLEY_STATIC_CAST(uint32_t, __get_cpuid_max(0, NULL));
+      if (max_leaf < 1)
+        return SIMDE_DISPATCH_LEVEL_PORTABLE;
+      __cpuid(1, eax, ebx, ecx, edx);
+      leaf1_ecx = ecx;
+      leaf1_edx = edx;
+      if (max_leaf >= 7) {
+        __cpuid_count(7, 0, eax, ebx, ecx, edx);
+        leaf7_ebx = ebx;
+      } else {
+        leaf7_ebx = 0;
+      }
+      max_ext_leaf = HEDLEY_STATIC_CAST(uint32_t, __get_cpuid_max(0x80000000, NULL));
+      if (max_ext_leaf >= UINT32_C(0x80000001)) {
+        __cpuid(0x80000001, eax, ebx, ecx, edx);
+        ext1_ecx = ecx;
+      } else {
+        ext1_ecx = 0;
+      }
+      if (leaf1_ecx & (UINT32_C(1) << 27)) {
+        /* Encoded so we don't need -mxsave just for this. */
+        __asm__ __volatile__(".byte 0x0f, 0x01, 0xd0" : "=a" (eax), "=d" (edx) : "c" (0));
+        xcr0 = (HEDLEY_STATIC_CAST(uint64_t, edx) << 32) | eax;
+      }
+    #endif
+
+    /* SSE2 */
+    if (!(leaf1_edx & (UINT32_C(1) << 26)))
+      return level;
+    level = SIMDE_DISPATCH_LEVEL_X86_64_V1;
+
+    /* SSE3, SSSE3, SSE4.1, SSE4.2, POPCNT */
+    {
+      const uint32_t v2_ecx =
+        (UINT32_C(1) <<  0) | (UINT32_C(1) <<  9) | (UINT32_C(1) << 19) |
+        (UINT32_C(1) << 20) | (UINT32_C(1) << 23);
+      if ((leaf1_ecx & v2_ecx) != v2_ecx)
+        return level;
+    }
+    level = SIMDE_DISPATCH_LEVEL_X86_64_V2;
+
+    /* FMA, MOVBE, OSXSAVE, AVX, F16C; AVX2, BMI1, BMI2; LZCNT; and the OS
+     * has to save the XMM and YMM state. */
+    {
+      const uint32_t v3_ecx =
+        (UINT32_C(1) << 12) | (UINT32_C(1) << 22) | (UINT32_C(1) << 27) |
+        (UINT32_C(1) << 28) | (UINT32_C(1) << 29);
+      const uint32_t v3_ebx =
+        (UINT32_C(1) <<  3) | (UINT32_C(1) <<  5) | (UINT32_C(1) <<  8);
+      if (
+          ((leaf1_ecx & v3_ecx) != v3_ecx) ||
+          ((leaf7_ebx & v3_ebx) != v3_ebx) ||
+          !(ext1_ecx & (UINT32_C(1) << 5)) ||
+          ((xcr0 & UINT64_C(0x06)) != UINT64_C(0x06)))
+        return level;
+    }
+    level = SIMDE_DISPATCH_LEVEL_X86_64_V3;
+
+    /* AVX-512 F, DQ, CD, BW, VL, plus opmask and ZMM state. */
+    {
+      const uint32_t v4_ebx =
+        (UINT32_C(1) << 16) | (UINT32_C(1) << 17) | (UINT32_C(1) << 28) |
+        (UINT32_C(1) << 30) | (UINT32_C(1) << 31);
+      if (((leaf7_ebx & v4_ebx) != v4_ebx) || ((xcr0 & UINT64_C(0xe6)) != UINT64_C(0xe6)))
+        return level;
+    }
+    level = SIMDE_DISPATCH_LEVEL_X86_64_V4;
+
+    return level;
+  #else
+    /* No runtime probe; the best we can do is trust the compiler. */
+    return SIMDE_DISPATCH_COMPILED_LEVEL;
+  #endif
+}
+
+/* Highest level supported by the running CPU.  The probe only runs
+ * once per translation unit; after that the cached value is used.
+ * Defining SIMDE_DISPATCH_MAX_LEVEL caps the result, which is mostly
+ * useful for testing the lower levels on a newer machine. */
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_x_dispatch_cpu_level (void) {
+  static volatile int cached_level = -1;
+  int level = cached_level;
+
+  if (HEDLEY_UNLIKELY(level < 0)) {
+    level = simde_x_dispatch_probe_cpu_level_();
+    #if defined(SIMDE_DISPATCH_MAX_LEVEL)
+      if (level > SIMDE_DISPATCH_MAX_LEVEL)
+        level = SIMDE_DISPATCH_MAX_LEVEL;
+    #endif
+    cached_level = level;
+  }
+
+  return level;
+}
+
+#if !defined(SIMDE_DISPATCH_WEAK_) && !defined(_WIN32) && !defined(__CYGWIN__)
+  #if HEDLEY_HAS_ATTRIBUTE(weak) || HEDLEY_GCC_VERSION_CHECK(3,1,0) || HEDLEY_INTEL_VERSION_CHECK(13,0,0)
+    #define SIMDE_DISPATCH_WEAK_ __attribute__((__weak__))
+  #endif
+#endif
+#if defined(SIMDE_DISPATCH_WEAK_)
+  #define SIMDE_DISPATCH_VARIANT_PRESENT_(fn) ((fn) != NULL)
+#else
+  #define SIMDE_DISPATCH_WEAK_
+  #define SIMDE_DISPATCH_VARIANT_PRESENT_(fn) (1)
+#endif
+
+#if defined(SIMDE_ENABLE_RUNTIME_DISPATCH) && (defined(SIMDE_ARCH_X86) || defined(SIMDE_ARCH_AMD64))
+  /* Only the levels above the one this translation unit is compiled
+   * for are optional, so only those are weak and only those end up in
+   * the resolver's table.  The compiled-level variant is what we fall
+   * back on; leaving it out has to be a link error, not a NULL call. */
+  #if SIMDE_DISPATCH_COMPILED_LEVEL < SIMDE_DISPATCH_LEVEL_X86_64_V1
+    #define SIMDE_DISPATCH_WEAK_X86_64_V1_ SIMDE_DISPATCH_WEAK_
+    #define SIMDE_DISPATCH_VARIANT_X86_64_V1_(name) (&HEDLEY_CONCAT(name, _x86_64_v1))
+  #else
+    #define SIMDE_DISPATCH_WEAK_X86_64_V1_
+    #define SIMDE_DISPATCH_VARIANT_X86_64_V1_(name) NULL
+  #endif
+  #if SIMDE_DISPATCH_COMPILED_LEVEL < SIMDE_DISPATCH_LEVEL_X86_64_V2
+    #define SIMDE_DISPATCH_WEAK_X86_64_V2_ SIMDE_DISPATCH_WEAK_
+    #define SIMDE_DISPATCH_VARIANT_X86_64_V2_(name) (&HEDLEY_CONCAT(name, _x86_64_v2))
+  #else
+    #define SIMDE_DISPATCH_WEAK_X86_64_V2_
+    #define SIMDE_DISPATCH_VARIANT_X86_64_V2_(name) NULL
+  #endif
+  #if SIMDE_DISPATCH_COMPILED_LEVEL < SIMDE_DISPATCH_LEVEL_X86_64_V3
+    #define SIMDE_DISPATCH_WEAK_X86_64_V3_ SIMDE_DISPATCH_WEAK_
+    #define SIMDE_DISPATCH_VARIANT_X86_64_V3_(name) (&HEDLEY_CONCAT(name, _x86_64_v3))
+  #else
+    #define SIMDE_DISPATCH_WEAK_X86_64_V3_
+    #define SIMDE_DISPATCH_VARIANT_X86_64_V3_(name) NULL
+  #endif
+  #if SIMDE_DISPATCH_COMPILED_LEVEL < SIMDE_DISPATCH_LEVEL_X86_64_V4
+    #define SIMDE_DISPATCH_WEAK_X86_64_V4_ SIMDE_DISPATCH_WEAK_
+    #define SIMDE_DISPATCH_VARIANT_X86_64_V4_(name) (&HEDLEY_CONCAT(name, _x86_64_v4))
+  #else
+    #define SIMDE_DISPATCH_WEAK_X86_64_V4_
+    #define SIMDE_DISPATCH_VARIANT_X86_64_V4_(name) NULL
+  #endif
+
+  #define SIMDE_DISPATCH_DEFINE(fn_type, name) \
+    HEDLEY_C_DECL SIMDE_DISPATCH_WEAK_X86_64_V4_ fn_type HEDLEY_CONCAT(name, _x86_64_v4); \
+    HEDLEY_C_DECL SIMDE_DISPATCH_WEAK_X86_64_V3_ fn_type HEDLEY_CONCAT(name, _x86_64_v3); \
+    HEDLEY_C_DECL SIMDE_DISPATCH_WEAK_X86_64_V2_ fn_type HEDLEY_CONCAT(name, _x86_64_v2); \
+    HEDLEY_C_DECL SIMDE_DISPATCH_WEAK_X86_64_V1_ fn_type HEDLEY_CONCAT(name, _x86_64_v1); \
+    HEDLEY_C_DECL fn_type HEDLEY_CONCAT(name, _portable); \
+    static fn_type* \
+    HEDLEY_CONCAT(simde_dispatch_resolve_, name) (void) { \
+      int level = simde_x_dispatch_cpu_level(); \
+      fn_type* const variants[] = { \
+        NULL, \
+        SIMDE_DISPATCH_VARIANT_X86_64_V1_(name), \
+        SIMDE_DISPATCH_VARIANT_X86_64_V2_(name), \
+        SIMDE_DISPATCH_VARIANT_X86_64_V3_(name), \
+        SIMDE_DISPATCH_VARIANT_X86_64_V4_(name) \
+      }; \
+      if (level > SIMDE_DISPATCH_LEVEL_X86_64_V4) \
+        level = SIMDE_DISPATCH_LEVEL_X86_64_V4; \
+      for (int i = level ; i > SIMDE_DISPATCH_COMPILED_LEVEL ; i--) { \
+        if (SIMDE_DISPATCH_VARIANT_PRESENT_(variants[i])) \
+          return variants[i]; \
+      } \
+      return &SIMDE_DISPATCH_NAME(name); \
+    } \
+    static SIMDE_FUNCTION_POSSIBLY_UNUSED_ fn_type* \
+    HEDLEY_CONCAT(simde_dispatch_get_, name) (void) { \
+      static fn_type* volatile cached = NULL; \
+      fn_type* fn = cached; \
+      if (HEDLEY_UNLIKELY(fn == NULL)) { \
+        fn = HEDLEY_CONCAT(simde_dispatch_resolve_, name)(); \
+        cached = fn; \
+      } \
+      return fn; \
+    }
+
+  #define SIMDE_DISPATCH(name) (HEDLEY_CONCAT(simde_dispatch_get_, name)())
+#elif defined(SIMDE_ENABLE_RUNTIME_DISPATCH)
+  /* Nothing to choose between (yet) on other architectures. */
+  #define SIMDE_DISPATCH_DEFINE(fn_type, name) \
+    HEDLEY_C_DECL fn_type SIMDE_DISPATCH_NAME(name); \
+    static SIMDE_FUNCTION_POSSIBLY_UNUSED_ fn_type* \
+    HEDLEY_CONCAT(simde_dispatch_get_, name) (void) { \
+      return &SIMDE_DISPATCH_NAME(name); \
+    }
+
+  #define SIMDE_DISPATCH(name) (HEDLEY_CONCAT(simde_dispatch_get_, name)())
+#else
+  #define SIMDE_DISPATCH_DEFINE(fn_type, name)
+  #define SIMDE_DISPATCH(name) SIMDE_DISPATCH_NAME(name)
+#endif
+
+/* Compiler-generated clones; see the comment at the top of the file
+ * for when this is (and isn't) useful. */
+#if \
+    defined(SIMDE_ENABLE_RUNTIME_DISPATCH) && \
+    defined(SIMDE_ARCH_AMD64) && defined(__ELF__) && \
+    (HEDLEY_GCC_VERSION_CHECK(12,0,0) || SIMDE_DETECT_CLANG_VERSION_CHECK(14,0,0)) && \
+    !defined(SIMDE_X86_AVX_NATIVE)
+  #define SIMDE_DISPATCH_TARGET_CLONES \
+    __attribute__((__target_clones__("arch=x86-64-v4", "arch=x86-64-v3", "arch=x86-64-v2", "default")))
+#else
+  #define SIMDE_DISPATCH_TARGET_CLONES
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_DISPATCH_H) */
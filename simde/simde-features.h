@@ -94,6 +94,15 @@
   #define SIMDE_X86_AVX512F_NATIVE
 #endif
 
+#if !defined(SIMDE_X86_AVX512IFMA_NATIVE) && !defined(SIMDE_X86_AVX512IFMA_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+  #if defined(SIMDE_ARCH_X86_AVX512IFMA)
+    #define SIMDE_X86_AVX512IFMA_NATIVE
+  #endif
+#endif
+#if defined(SIMDE_X86_AVX512IFMA_NATIVE) && !defined(SIMDE_X86_AVX512F_NATIVE)
+  #define SIMDE_X86_AVX512F_NATIVE
+#endif
+
 #if !defined(SIMDE_X86_AVX5124VNNIW_NATIVE) && !defined(SIMDE_X86_AVX5124VNNIW_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
   #if defined(SIMDE_ARCH_X86_AVX5124VNNIW)
     #define SIMDE_X86_AVX5124VNNIW_NATIVE
@@ -175,6 +184,57 @@
   #define SIMDE_X86_AVX_NATIVE
 #endif
 
+#if !defined(SIMDE_X86_AVXVNNI_NATIVE) && !defined(SIMDE_X86_AVXVNNI_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+  #if defined(SIMDE_ARCH_X86_AVXVNNI)
+    #define SIMDE_X86_AVXVNNI_NATIVE
+  #endif
+#endif
+#if defined(SIMDE_X86_AVXVNNI_NATIVE) && !defined(SIMDE_X86_AVX2_NATIVE)
+  #define SIMDE_X86_AVX2_NATIVE
+#endif
+
+#if !defined(SIMDE_X86_AVXIFMA_NATIVE) && !defined(SIMDE_X86_AVXIFMA_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+  #if defined(SIMDE_ARCH_X86_AVXIFMA)
+    #define SIMDE_X86_AVXIFMA_NATIVE
+  #endif
+#endif
+#if defined(SIMDE_X86_AVXIFMA_NATIVE) && !defined(SIMDE_X86_AVX2_NATIVE)
+  #define SIMDE_X86_AVX2_NATIVE
+#endif
+
+#if !defined(SIMDE_X86_AVXNECONVERT_NATIVE) && !defined(SIMDE_X86_AVXNECONVERT_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+  #if defined(SIMDE_ARCH_X86_AVXNECONVERT)
+    #define SIMDE_X86_AVXNECONVERT_NATIVE
+  #endif
+#endif
+#if defined(SIMDE_X86_AVXNECONVERT_NATIVE) && !defined(SIMDE_X86_AVX2_NATIVE)
+  #define SIMDE_X86_AVX2_NATIVE
+#endif
+
+#if !defined(SIMDE_X86_AMX_TILE_NATIVE) && !defined(SIMDE_X86_AMX_TILE_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+  #if defined(SIMDE_ARCH_X86_AMX_TILE)
+    #define SIMDE_X86_AMX_TILE_NATIVE
+  #endif
+#endif
+#if !defined(SIMDE_X86_AMX_INT8_NATIVE) && !defined(SIMDE_X86_AMX_INT8_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+  #if defined(SIMDE_ARCH_X86_AMX_INT8)
+    #define SIMDE_X86_AMX_INT8_NATIVE
+  #endif
+#endif
+#if !defined(SIMDE_X86_AMX_BF16_NATIVE) && !defined(SIMDE_X86_AMX_BF16_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+  #if defined(SIMDE_ARCH_X86_AMX_BF16)
+    #define SIMDE_X86_AMX_BF16_NATIVE
+  #endif
+#endif
+/* The emulated tile instructions operate on emulated tile registers, so
+ * we can't mix native and emulated AMX; use it natively only if all of
+ * the extensions we implement are available. */
+#if !(defined(SIMDE_X86_AMX_TILE_NATIVE) && defined(SIMDE_X86_AMX_INT8_NATIVE) && defined(SIMDE_X86_AMX_BF16_NATIVE))
+  #undef SIMDE_X86_AMX_TILE_NATIVE
+  #undef SIMDE_X86_AMX_INT8_NATIVE
+  #undef SIMDE_X86_AMX_BF16_NATIVE
+#endif
+
 #if !defined(SIMDE_X86_AVX2_NATIVE) && !defined(SIMDE_X86_AVX2_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
   #if defined(SIMDE_ARCH_X86_AVX2)
     #define SIMDE_X86_AVX2_NATIVE
@@ -247,6 +307,21 @@
   #define SIMDE_X86_SSE2_NATIVE
 #endif
 
+#if !defined(SIMDE_X86_VAES_NATIVE) && !defined(SIMDE_X86_VAES_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+  #if defined(SIMDE_ARCH_X86_VAES)
+    #define SIMDE_X86_VAES_NATIVE
+  #endif
+#endif
+
+#if !defined(SIMDE_X86_SHA_NATIVE) && !defined(SIMDE_X86_SHA_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+  #if defined(SIMDE_ARCH_X86_SHA)
+    #define SIMDE_X86_SHA_NATIVE
+  #endif
+#endif
+#if defined(SIMDE_X86_SHA_NATIVE) && !defined(SIMDE_X86_SSE2_NATIVE)
+  #define SIMDE_X86_SSE2_NATIVE
+#endif
+
 #if !defined(SIMDE_X86_SSE2_NATIVE) && !defined(SIMDE_X86_SSE2_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
   #if defined(SIMDE_ARCH_X86_SSE2)
     #define SIMDE_X86_SSE2_NATIVE
@@ -334,6 +409,14 @@
   #include <wmmintrin.h>
 #endif
 
+#if defined(SIMDE_X86_SHA_NATIVE)
+  #include <immintrin.h>
+#endif
+
+#if defined(SIMDE_X86_AMX_TILE_NATIVE)
+  #include <immintrin.h>
+#endif
+
 #if defined(HEDLEY_MSVC_VERSION)
   #pragma warning(pop)
 #endif
@@ -640,6 +723,24 @@
   #if !defined(SIMDE_X86_AVX512VNNI_NATIVE)
     #define SIMDE_X86_AVX512VNNI_ENABLE_NATIVE_ALIASES
   #endif
+  #if !defined(SIMDE_X86_AVX512IFMA_NATIVE)
+    #define SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES
+  #endif
+  #if !defined(SIMDE_X86_AVXIFMA_NATIVE)
+    #define SIMDE_X86_AVXIFMA_ENABLE_NATIVE_ALIASES
+  #endif
+  #if !defined(SIMDE_X86_AVXNECONVERT_NATIVE)
+    #define SIMDE_X86_AVXNECONVERT_ENABLE_NATIVE_ALIASES
+  #endif
+  #if !defined(SIMDE_X86_AMX_TILE_NATIVE)
+    #define SIMDE_X86_AMX_TILE_ENABLE_NATIVE_ALIASES
+  #endif
+  #if !defined(SIMDE_X86_AMX_INT8_NATIVE)
+    #define SIMDE_X86_AMX_INT8_ENABLE_NATIVE_ALIASES
+  #endif
+  #if !defined(SIMDE_X86_AMX_BF16_NATIVE)
+    #define SIMDE_X86_AMX_BF16_ENABLE_NATIVE_ALIASES
+  #endif
   #if !defined(SIMDE_X86_AVX5124VNNIW_NATIVE)
     #define SIMDE_X86_AVX5124VNNIW_ENABLE_NATIVE_ALIASES
   #endif
@@ -679,6 +780,12 @@
   #if !defined(SIMDE_X86_AES_NATIVE)
     #define SIMDE_X86_AES_ENABLE_NATIVE_ALIASES
   #endif
+  #if !defined(SIMDE_X86_VAES_NATIVE)
+    #define SIMDE_X86_VAES_ENABLE_NATIVE_ALIASES
+  #endif
+  #if !defined(SIMDE_X86_SHA_NATIVE)
+    #define SIMDE_X86_SHA_ENABLE_NATIVE_ALIASES
+  #endif
   #if !defined(SIMDE_X86_SVML_NATIVE)
     #define SIMDE_X86_SVML_ENABLE_NATIVE_ALIASES
   #endif
@@ -737,6 +844,10 @@
   #define SIMDE_ARM_NEON_FP16
 #endif
 
+#if defined(SIMDE_ARCH_ARM_NEON_BF16)
+  #define SIMDE_ARM_NEON_BF16
+#endif
+
 #if !defined(SIMDE_LOONGARCH_LASX_NATIVE) && !defined(SIMDE_LOONGARCH_LASX_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
   #if defined(SIMDE_ARCH_LOONGARCH_LASX)
     #define SIMDE_LOONGARCH_LASX_NATIVE
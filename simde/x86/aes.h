@@ -26,286 +26,446 @@
 #define SIMDE_X86_AES_H
 
 /*
- * Advanced Encryption Standard
- * @author Dani Huertas
- * @email huertas.dani@gmail.com
+ * Advanced Encryption Standard, FIPS PUB 197.
  *
- * Based on the document FIPS PUB 197
- */
-
-#include "sse2.h"
-
-/*
- * Multiplication in GF(2^8)
- * http://en.wikipedia.org/wiki/Finite_field_arithmetic
- * Irreducible polynomial m(x) = x8 + x4 + x3 + x + 1
+ * Without AES-NI (or the ARMv8 crypto extension) the rounds are
+ * computed without any data-dependent memory accesses or branches, so
+ * they don't leak the key through cache timing:
  *
- * NOTE: This function can be easily replaced with a look up table for a speed
- *       boost, at the expense of an increase in memory size.
-
-SIMDE_FUNCTION_ATTRIBUTES
-uint8_t gmult(uint8_t a, uint8_t b) {
-  uint8_t p = 0, i = 0, hbs = 0;
-
-  for (i = 0; i < 8; i++) {
-    if (b & 1) {
-      p ^= a;
-    }
+ *  - Single blocks use the vector-permute approach described by Mike
+ *    Hamburg in "Accelerating AES with Vector Permute Instructions"
+ *    (CHES 2009).  The S-box is computed in GF((2^4)^2): each byte is
+ *    split into nibbles, moved to the tower basis, inverted using 4-bit
+ *    lookups and moved back, where every lookup is a
+ *    simde_mm_shuffle_epi8 (pshufb, vqtbl1q_u8, wasm_i8x16_swizzle,
+ *    vec_perm, ...).  ShiftRows and the column rotations in MixColumns
+ *    are shuffles as well.
+ *
+ *  - simde_x_aes_encrypt_blocks / simde_x_aes_decrypt_blocks run the
+ *    whole cipher over eight blocks at a time in bitsliced form
+ *    (register q[b] holds bit b of every byte of all eight blocks), with
+ *    the S-box evaluated by the 113-gate circuit from Boyar and Peralta.
+ *    This is meant for CTR/GCM style callers which have several
+ *    independent blocks in flight.
+ */
 
-    hbs = a & 0x80;
-    a <<= 1;
-    if (hbs) a ^= 0x1b; // 0000 0001 0001 1011
-    b >>= 1;
+#include "ssse3.h"
+#include "avx512/types.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+#if !defined(SIMDE_X86_AES_NATIVE) && !(defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARCH_ARM_CRYPTO))
+
+/* GF(2^8) is represented as GF(2^4)[y] / (y^2 + 2y + 2), with GF(2^4)
+ * = GF(2)[t] / (t^4 + t + 1); a byte holds i * y + k as (i << 4) | k.
+ * The inverse is obtained from
+ *   j  = i ^ k
+ *   io = 1 / (1/i ^ a/k) ^ j
+ *   jo = 1 / (1/j ^ a/k) ^ i
+ * (a = 2) and the output tables map (io, jo) back to the AES basis,
+ * applying the affine part of the S-box on the way for encryption. */
+static const union {
+  uint8_t      u8[14 * 16];
+  simde__m128i m128i[14];
+} simde_x_aes_vperm_lut = {
+  {
+    /* 1/x in GF(2^4), with 1/0 = 0x80 so pshufb yields 0 */
+    0x80, 0x01, 0x09, 0x0e, 0x0d, 0x0b, 0x07, 0x06, 0x0f, 0x02, 0x0c, 0x05, 0x0a, 0x04, 0x03, 0x08,
+    /* a/x */
+    0x80, 0x02, 0x01, 0x0f, 0x09, 0x05, 0x0e, 0x0c, 0x0d, 0x04, 0x0b, 0x0a, 0x07, 0x08, 0x06, 0x03,
+    /* AES basis -> tower basis, low nibble */
+    0x00, 0x01, 0x1c, 0x1d, 0x2d, 0x2c, 0x31, 0x30, 0x27, 0x26, 0x3b, 0x3a, 0x0a, 0x0b, 0x16, 0x17,
+    /* AES basis -> tower basis, high nibble */
+    0x00, 0x86, 0xfd, 0x7b, 0x8e, 0x08, 0x73, 0xf5, 0x77, 0xf1, 0x8a, 0x0c, 0xf9, 0x7f, 0x04, 0x82,
+    /* tower -> AES basis with the S-box affine matrix, io */
+    0x00, 0xcb, 0xd7, 0xb0, 0x21, 0x8d, 0x67, 0xac, 0x7b, 0x5a, 0xea, 0x3d, 0x46, 0xf6, 0x91, 0x1c,
+    /* ... jo */
+    0x00, 0x9f, 0x61, 0x16, 0xc2, 0x2a, 0x77, 0xe8, 0x89, 0x4b, 0x5d, 0x3c, 0xb5, 0xa3, 0xd4, 0xfe,
+    /* inverse affine transform -> tower basis, low nibble */
+    0x2c, 0x99, 0xf0, 0x45, 0xf7, 0x42, 0x2b, 0x9e, 0x38, 0x8d, 0xe4, 0x51, 0xe3, 0x56, 0x3f, 0x8a,
+    /* inverse affine transform -> tower basis, high nibble */
+    0x00, 0xa7, 0xa8, 0x0f, 0xed, 0x4a, 0x45, 0xe2, 0xd1, 0x76, 0x79, 0xde, 0x3c, 0x9b, 0x94, 0x33,
+    /* tower -> AES basis, io */
+    0x00, 0x3b, 0xe4, 0xc8, 0x03, 0x14, 0x2c, 0x17, 0xf3, 0xf0, 0x38, 0xdc, 0x2f, 0xe7, 0xcb, 0xdf,
+    /* ... jo */
+    0x00, 0x24, 0x91, 0x19, 0x23, 0x8f, 0x88, 0xac, 0x3d, 0x1e, 0x07, 0x96, 0xab, 0xb2, 0x3a, 0xb5,
+    /* ShiftRows */
+    0x00, 0x05, 0x0a, 0x0f, 0x04, 0x09, 0x0e, 0x03, 0x08, 0x0d, 0x02, 0x07, 0x0c, 0x01, 0x06, 0x0b,
+    /* InvShiftRows */
+    0x00, 0x0d, 0x0a, 0x07, 0x04, 0x01, 0x0e, 0x0b, 0x08, 0x05, 0x02, 0x0f, 0x0c, 0x09, 0x06, 0x03,
+    /* rotate each column by one byte */
+    0x01, 0x02, 0x03, 0x00, 0x05, 0x06, 0x07, 0x04, 0x09, 0x0a, 0x0b, 0x08, 0x0d, 0x0e, 0x0f, 0x0c,
+    /* rotate each column by two bytes */
+    0x02, 0x03, 0x00, 0x01, 0x06, 0x07, 0x04, 0x05, 0x0a, 0x0b, 0x08, 0x09, 0x0e, 0x0f, 0x0c, 0x0d
   }
+};
+
+#define SIMDE_X_AES_VPERM_INV_           0
+#define SIMDE_X_AES_VPERM_INVA_          1
+#define SIMDE_X_AES_VPERM_ENC_           2
+#define SIMDE_X_AES_VPERM_DEC_           6
+#define SIMDE_X_AES_VPERM_SHIFT_ROWS_   10
+#define SIMDE_X_AES_VPERM_INV_SHIFT_ROWS_ 11
+#define SIMDE_X_AES_VPERM_ROT1_         12
+#define SIMDE_X_AES_VPERM_ROT2_         13
+
+/* Below this many blocks the single-block code is faster.  With a
+ * native byte shuffle the vperm code is already quick so the bitsliced
+ * path only pays off with a (nearly) full batch; when the shuffle is
+ * emulated it wins much sooner. */
+#if \
+    defined(SIMDE_X86_SSSE3_NATIVE) || \
+    defined(SIMDE_ARM_NEON_A32V7_NATIVE) || \
+    defined(SIMDE_POWER_ALTIVEC_P6_NATIVE) || \
+    defined(SIMDE_WASM_SIMD128_NATIVE) || \
+    defined(SIMDE_LOONGARCH_LSX_NATIVE)
+  #define SIMDE_X_AES_BITSLICE_MIN_BLOCKS_ 7
+#else
+  #define SIMDE_X_AES_BITSLICE_MIN_BLOCKS_ 3
+#endif
 
-  return (uint8_t)p;
+/* SubBytes (tables == SIMDE_X_AES_VPERM_ENC_, without the 0x63
+ * constant) or InvSubBytes (tables == SIMDE_X_AES_VPERM_DEC_). */
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_aes_vperm_sub_bytes(simde__m128i x, int tables) {
+  const simde__m128i* lut = simde_x_aes_vperm_lut.m128i;
+  const simde__m128i* t = lut + tables;
+  const simde__m128i mask = simde_mm_set1_epi8(0x0f);
+  simde__m128i i, j, k, ak, iak, jak, io, jo;
+
+  k = simde_mm_and_si128(x, mask);
+  i = simde_mm_and_si128(simde_mm_srli_epi16(x, 4), mask);
+  x = simde_mm_xor_si128(simde_mm_shuffle_epi8(t[0], k), simde_mm_shuffle_epi8(t[1], i));
+
+  k = simde_mm_and_si128(x, mask);
+  i = simde_mm_and_si128(simde_mm_srli_epi16(x, 4), mask);
+  j = simde_mm_xor_si128(i, k);
+
+  ak  = simde_mm_shuffle_epi8(lut[SIMDE_X_AES_VPERM_INVA_], k);
+  iak = simde_mm_xor_si128(simde_mm_shuffle_epi8(lut[SIMDE_X_AES_VPERM_INV_], i), ak);
+  jak = simde_mm_xor_si128(simde_mm_shuffle_epi8(lut[SIMDE_X_AES_VPERM_INV_], j), ak);
+  io  = simde_mm_xor_si128(simde_mm_shuffle_epi8(lut[SIMDE_X_AES_VPERM_INV_], iak), j);
+  jo  = simde_mm_xor_si128(simde_mm_shuffle_epi8(lut[SIMDE_X_AES_VPERM_INV_], jak), i);
+
+  return simde_mm_xor_si128(simde_mm_shuffle_epi8(t[2], io), simde_mm_shuffle_epi8(t[3], jo));
 }
- */
-
-#if !(defined(SIMDE_ARM_NEON_A32V7_NATIVE) && defined(SIMDE_ARCH_ARM_CRYPTO))
 
-#include "../simde-aes.h"
-
-/*
- * Transformation in the Cipher and Inverse Cipher in which a Round
- * Key is added to the State using an XOR operation. The length of a
- * Round Key equals the size of the State (i.e., for Nb = 4, the Round
- * Key length equals 128 bits/16 bytes).
- */
+/* Multiply every byte by x (i.e., {02}). */
 SIMDE_FUNCTION_ATTRIBUTES
-void simde_x_aes_add_round_key(uint8_t *state, simde__m128i_private w, uint8_t r) {
-
-  int Nb = simde_x_aes_Nb;
-  uint8_t c;
-
-  for (c = 0; c < Nb; c++) {
-    state[Nb*0+c] = state[Nb*0+c]^w.u8[4*Nb*r+4*c+0];
-    state[Nb*1+c] = state[Nb*1+c]^w.u8[4*Nb*r+4*c+1];
-    state[Nb*2+c] = state[Nb*2+c]^w.u8[4*Nb*r+4*c+2];
-    state[Nb*3+c] = state[Nb*3+c]^w.u8[4*Nb*r+4*c+3];
-  }
+simde__m128i
+simde_x_aes_vperm_xtime(simde__m128i x) {
+  return
+    simde_mm_xor_si128(
+      simde_mm_add_epi8(x, x),
+      simde_mm_and_si128(simde_mm_cmplt_epi8(x, simde_mm_setzero_si128()), simde_mm_set1_epi8(0x1b)));
 }
 
-/*
- * Transformation in the Cipher that takes all of the columns of the
- * State and mixes their data (independently of one another) to
- * produce new columns.
- */
+/* 2a[r] ^ 3a[r+1] ^ a[r+2] ^ a[r+3]
+ *   == xtime(a[r] ^ a[r+1]) ^ a[r+1] ^ (a[r+2] ^ a[r+3]) */
 SIMDE_FUNCTION_ATTRIBUTES
-void simde_x_aes_mix_columns(uint8_t *state) {
-
-  int Nb = simde_x_aes_Nb;
-  // uint8_t k[] = {0x02, 0x01, 0x01, 0x03}; // a(x) = {02} + {01}x + {01}x2 + {03}x3
-  uint8_t i, j, col[4], res[4];
-
-  for (j = 0; j < Nb; j++) {
-    for (i = 0; i < 4; i++) {
-      col[i] = state[Nb*i+j];
-    }
-
-    //coef_mult(k, col, res);
-    simde_x_aes_coef_mult_lookup(0, col, res);
-
-    for (i = 0; i < 4; i++) {
-      state[Nb*i+j] = res[i];
-    }
-  }
+simde__m128i
+simde_x_aes_vperm_mix_columns(simde__m128i x) {
+  const simde__m128i r1 = simde_mm_shuffle_epi8(x, simde_x_aes_vperm_lut.m128i[SIMDE_X_AES_VPERM_ROT1_]);
+  const simde__m128i t = simde_mm_xor_si128(x, r1);
+
+  return
+    simde_mm_xor_si128(
+      simde_mm_xor_si128(simde_x_aes_vperm_xtime(t), r1),
+      simde_mm_shuffle_epi8(t, simde_x_aes_vperm_lut.m128i[SIMDE_X_AES_VPERM_ROT2_]));
 }
 
-/*
- * Transformation in the Inverse Cipher that is the inverse of
- * MixColumns().
- */
+/* InvMixColumns(a) == MixColumns(a ^ {04}(a ^ rot2(a))) */
 SIMDE_FUNCTION_ATTRIBUTES
-void simde_x_aes_inv_mix_columns(uint8_t *state) {
-
-  int Nb = simde_x_aes_Nb;
-  // uint8_t k[] = {0x0e, 0x09, 0x0d, 0x0b}; // a(x) = {0e} + {09}x + {0d}x2 + {0b}x3
-  uint8_t i, j, col[4], res[4];
-
-  for (j = 0; j < Nb; j++) {
-    for (i = 0; i < 4; i++) {
-      col[i] = state[Nb*i+j];
-    }
-
-    //coef_mult(k, col, res);
-    simde_x_aes_coef_mult_lookup(4, col, res);
-
-    for (i = 0; i < 4; i++) {
-      state[Nb*i+j] = res[i];
-    }
-  }
+simde__m128i
+simde_x_aes_vperm_inv_mix_columns(simde__m128i x) {
+  simde__m128i t = simde_mm_xor_si128(x, simde_mm_shuffle_epi8(x, simde_x_aes_vperm_lut.m128i[SIMDE_X_AES_VPERM_ROT2_]));
+  t = simde_x_aes_vperm_xtime(simde_x_aes_vperm_xtime(t));
+  return simde_x_aes_vperm_mix_columns(simde_mm_xor_si128(x, t));
 }
 
-/*
- * Transformation in the Cipher that processes the State by cyclically
- * shifting the last three rows of the State by different offsets.
- */
+/* Bitsliced representation: bit (8 * i + n) of q[b] is bit b of byte
+ * i of block n.  Converting in either direction is the same 8x8 bit
+ * transposition within every byte position. */
 SIMDE_FUNCTION_ATTRIBUTES
-void simde_x_aes_shift_rows(uint8_t *state) {
-
-  int Nb = simde_x_aes_Nb;
-  uint8_t i, k, s, tmp;
-
-  for (i = 1; i < 4; i++) {
-    // shift(1,4)=1; shift(2,4)=2; shift(3,4)=3
-    // shift(r, 4) = r;
-    s = 0;
-    while (s < i) {
-      tmp = state[Nb*i+0];
-
-      for (k = 1; k < Nb; k++) {
-        state[Nb*i+k-1] = state[Nb*i+k];
-      }
-
-      state[Nb*i+Nb-1] = tmp;
-      s++;
-    }
-  }
+void
+simde_x_aes_bitslice_transpose(simde__m128i q[8]) {
+  #define SIMDE_X_AES_SWAPMOVE_(a, b, mask, n) \
+    do { \
+      const simde__m128i t_ = simde_mm_and_si128(simde_mm_xor_si128(simde_mm_srli_epi64(q[a], n), q[b]), mask); \
+      q[b] = simde_mm_xor_si128(q[b], t_); \
+      q[a] = simde_mm_xor_si128(q[a], simde_mm_slli_epi64(t_, n)); \
+    } while (0)
+
+  const simde__m128i m1 = simde_mm_set1_epi8(0x55);
+  const simde__m128i m2 = simde_mm_set1_epi8(0x33);
+  const simde__m128i m4 = simde_mm_set1_epi8(0x0f);
+
+  SIMDE_X_AES_SWAPMOVE_(0, 1, m1, 1);
+  SIMDE_X_AES_SWAPMOVE_(2, 3, m1, 1);
+  SIMDE_X_AES_SWAPMOVE_(4, 5, m1, 1);
+  SIMDE_X_AES_SWAPMOVE_(6, 7, m1, 1);
+
+  SIMDE_X_AES_SWAPMOVE_(0, 2, m2, 2);
+  SIMDE_X_AES_SWAPMOVE_(1, 3, m2, 2);
+  SIMDE_X_AES_SWAPMOVE_(4, 6, m2, 2);
+  SIMDE_X_AES_SWAPMOVE_(5, 7, m2, 2);
+
+  SIMDE_X_AES_SWAPMOVE_(0, 4, m4, 4);
+  SIMDE_X_AES_SWAPMOVE_(1, 5, m4, 4);
+  SIMDE_X_AES_SWAPMOVE_(2, 6, m4, 4);
+  SIMDE_X_AES_SWAPMOVE_(3, 7, m4, 4);
+
+  #undef SIMDE_X_AES_SWAPMOVE_
 }
 
-/*
- * Transformation in the Inverse Cipher that is the inverse of
- * ShiftRows().
- */
+/* Joan Boyar and Rene Peralta, "A depth-16 circuit for the AES S-box"
+ * (2011); 32 AND and 83 XOR/XNOR gates. */
 SIMDE_FUNCTION_ATTRIBUTES
-void simde_x_aes_inv_shift_rows(uint8_t *state) {
-
-  uint8_t Nb = simde_x_aes_Nb;
-  uint8_t i, k, s, tmp;
-
-  for (i = 1; i < 4; i++) {
-    s = 0;
-    while (s < i) {
-      tmp = state[Nb*i+Nb-1];
-
-      for (k = Nb-1; k > 0; k--) {
-        state[Nb*i+k] = state[Nb*i+k-1];
-      }
-
-      state[Nb*i+0] = tmp;
-      s++;
-    }
-  }
+void
+simde_x_aes_bitslice_sub_bytes(simde__m128i q[8]) {
+  const simde__m128i
+    x0 = q[7], x1 = q[6], x2 = q[5], x3 = q[4],
+    x4 = q[3], x5 = q[2], x6 = q[1], x7 = q[0];
+
+  simde__m128i y14 = simde_mm_xor_si128(x3, x5);
+  simde__m128i y13 = simde_mm_xor_si128(x0, x6);
+  simde__m128i y9 = simde_mm_xor_si128(x0, x3);
+  simde__m128i y8 = simde_mm_xor_si128(x0, x5);
+  simde__m128i t0 = simde_mm_xor_si128(x1, x2);
+  simde__m128i y1 = simde_mm_xor_si128(t0, x7);
+  simde__m128i y4 = simde_mm_xor_si128(y1, x3);
+  simde__m128i y12 = simde_mm_xor_si128(y13, y14);
+  simde__m128i y2 = simde_mm_xor_si128(y1, x0);
+  simde__m128i y5 = simde_mm_xor_si128(y1, x6);
+  simde__m128i y3 = simde_mm_xor_si128(y5, y8);
+  simde__m128i t1 = simde_mm_xor_si128(x4, y12);
+  simde__m128i y15 = simde_mm_xor_si128(t1, x5);
+  simde__m128i y20 = simde_mm_xor_si128(t1, x1);
+  simde__m128i y6 = simde_mm_xor_si128(y15, x7);
+  simde__m128i y10 = simde_mm_xor_si128(y15, t0);
+  simde__m128i y11 = simde_mm_xor_si128(y20, y9);
+  simde__m128i y7 = simde_mm_xor_si128(x7, y11);
+  simde__m128i y17 = simde_mm_xor_si128(y10, y11);
+  simde__m128i y19 = simde_mm_xor_si128(y10, y8);
+  simde__m128i y16 = simde_mm_xor_si128(t0, y11);
+  simde__m128i y21 = simde_mm_xor_si128(y13, y16);
+  simde__m128i y18 = simde_mm_xor_si128(x0, y16);
+  simde__m128i t2 = simde_mm_and_si128(y12, y15);
+  simde__m128i t3 = simde_mm_and_si128(y3, y6);
+  simde__m128i t4 = simde_mm_xor_si128(t3, t2);
+  simde__m128i t5 = simde_mm_and_si128(y4, x7);
+  simde__m128i t6 = simde_mm_xor_si128(t5, t2);
+  simde__m128i t7 = simde_mm_and_si128(y13, y16);
+  simde__m128i t8 = simde_mm_and_si128(y5, y1);
+  simde__m128i t9 = simde_mm_xor_si128(t8, t7);
+  simde__m128i t10 = simde_mm_and_si128(y2, y7);
+  simde__m128i t11 = simde_mm_xor_si128(t10, t7);
+  simde__m128i t12 = simde_mm_and_si128(y9, y11);
+  simde__m128i t13 = simde_mm_and_si128(y14, y17);
+  simde__m128i t14 = simde_mm_xor_si128(t13, t12);
+  simde__m128i t15 = simde_mm_and_si128(y8, y10);
+  simde__m128i t16 = simde_mm_xor_si128(t15, t12);
+  simde__m128i t17 = simde_mm_xor_si128(t4, t14);
+  simde__m128i t18 = simde_mm_xor_si128(t6, t16);
+  simde__m128i t19 = simde_mm_xor_si128(t9, t14);
+  simde__m128i t20 = simde_mm_xor_si128(t11, t16);
+  simde__m128i t21 = simde_mm_xor_si128(t17, y20);
+  simde__m128i t22 = simde_mm_xor_si128(t18, y19);
+  simde__m128i t23 = simde_mm_xor_si128(t19, y21);
+  simde__m128i t24 = simde_mm_xor_si128(t20, y18);
+  simde__m128i t25 = simde_mm_xor_si128(t21, t22);
+  simde__m128i t26 = simde_mm_and_si128(t21, t23);
+  simde__m128i t27 = simde_mm_xor_si128(t24, t26);
+  simde__m128i t28 = simde_mm_and_si128(t25, t27);
+  simde__m128i t29 = simde_mm_xor_si128(t28, t22);
+  simde__m128i t30 = simde_mm_xor_si128(t23, t24);
+  simde__m128i t31 = simde_mm_xor_si128(t22, t26);
+  simde__m128i t32 = simde_mm_and_si128(t31, t30);
+  simde__m128i t33 = simde_mm_xor_si128(t32, t24);
+  simde__m128i t34 = simde_mm_xor_si128(t23, t33);
+  simde__m128i t35 = simde_mm_xor_si128(t27, t33);
+  simde__m128i t36 = simde_mm_and_si128(t24, t35);
+  simde__m128i t37 = simde_mm_xor_si128(t36, t34);
+  simde__m128i t38 = simde_mm_xor_si128(t27, t36);
+  simde__m128i t39 = simde_mm_and_si128(t29, t38);
+  simde__m128i t40 = simde_mm_xor_si128(t25, t39);
+  simde__m128i t41 = simde_mm_xor_si128(t40, t37);
+  simde__m128i t42 = simde_mm_xor_si128(t29, t33);
+  simde__m128i t43 = simde_mm_xor_si128(t29, t40);
+  simde__m128i t44 = simde_mm_xor_si128(t33, t37);
+  simde__m128i t45 = simde_mm_xor_si128(t42, t41);
+  simde__m128i z0 = simde_mm_and_si128(t44, y15);
+  simde__m128i z1 = simde_mm_and_si128(t37, y6);
+  simde__m128i z2 = simde_mm_and_si128(t33, x7);
+  simde__m128i z3 = simde_mm_and_si128(t43, y16);
+  simde__m128i z4 = simde_mm_and_si128(t40, y1);
+  simde__m128i z5 = simde_mm_and_si128(t29, y7);
+  simde__m128i z6 = simde_mm_and_si128(t42, y11);
+  simde__m128i z7 = simde_mm_and_si128(t45, y17);
+  simde__m128i z8 = simde_mm_and_si128(t41, y10);
+  simde__m128i z9 = simde_mm_and_si128(t44, y12);
+  simde__m128i z10 = simde_mm_and_si128(t37, y3);
+  simde__m128i z11 = simde_mm_and_si128(t33, y4);
+  simde__m128i z12 = simde_mm_and_si128(t43, y13);
+  simde__m128i z13 = simde_mm_and_si128(t40, y5);
+  simde__m128i z14 = simde_mm_and_si128(t29, y2);
+  simde__m128i z15 = simde_mm_and_si128(t42, y9);
+  simde__m128i z16 = simde_mm_and_si128(t45, y14);
+  simde__m128i z17 = simde_mm_and_si128(t41, y8);
+  simde__m128i t46 = simde_mm_xor_si128(z15, z16);
+  simde__m128i t47 = simde_mm_xor_si128(z10, z11);
+  simde__m128i t48 = simde_mm_xor_si128(z5, z13);
+  simde__m128i t49 = simde_mm_xor_si128(z9, z10);
+  simde__m128i t50 = simde_mm_xor_si128(z2, z12);
+  simde__m128i t51 = simde_mm_xor_si128(z2, z5);
+  simde__m128i t52 = simde_mm_xor_si128(z7, z8);
+  simde__m128i t53 = simde_mm_xor_si128(z0, z3);
+  simde__m128i t54 = simde_mm_xor_si128(z6, z7);
+  simde__m128i t55 = simde_mm_xor_si128(z16, z17);
+  simde__m128i t56 = simde_mm_xor_si128(z12, t48);
+  simde__m128i t57 = simde_mm_xor_si128(t50, t53);
+  simde__m128i t58 = simde_mm_xor_si128(z4, t46);
+  simde__m128i t59 = simde_mm_xor_si128(z3, t54);
+  simde__m128i t60 = simde_mm_xor_si128(t46, t57);
+  simde__m128i t61 = simde_mm_xor_si128(z14, t57);
+  simde__m128i t62 = simde_mm_xor_si128(t52, t58);
+  simde__m128i t63 = simde_mm_xor_si128(t49, t58);
+  simde__m128i t64 = simde_mm_xor_si128(z4, t59);
+  simde__m128i t65 = simde_mm_xor_si128(t61, t62);
+  simde__m128i t66 = simde_mm_xor_si128(z1, t63);
+  simde__m128i s0 = simde_mm_xor_si128(t59, t63);
+  simde__m128i s6 = simde_mm_xor_si128(t56, simde_x_mm_not_si128(t62));
+  simde__m128i s7 = simde_mm_xor_si128(t48, simde_x_mm_not_si128(t60));
+  simde__m128i t67 = simde_mm_xor_si128(t64, t65);
+  simde__m128i s3 = simde_mm_xor_si128(t53, t66);
+  simde__m128i s4 = simde_mm_xor_si128(t51, t66);
+  simde__m128i s5 = simde_mm_xor_si128(t47, t65);
+  simde__m128i s1 = simde_mm_xor_si128(t64, simde_x_mm_not_si128(s3));
+  simde__m128i s2 = simde_mm_xor_si128(t55, simde_x_mm_not_si128(t67));
+  q[7] = s0; q[6] = s1; q[5] = s2; q[4] = s3;
+  q[3] = s4; q[2] = s5; q[1] = s6; q[0] = s7;
 }
 
-/*
- * Transformation in the Cipher that processes the State using a non
- * linear byte substitution table (S-box) that operates on each of the
- * State bytes independently.
- */
+/* InvSubBytes(x) == A^-1(SubBytes(A^-1(x))), where A is the affine
+ * transformation of the S-box. */
 SIMDE_FUNCTION_ATTRIBUTES
-void simde_x_aes_sub_bytes(uint8_t *state) {
-
-  int Nb = simde_x_aes_Nb;
-  uint8_t i, j;
-
-  for (i = 0; i < 4; i++) {
-    for (j = 0; j < Nb; j++) {
-      // s_box row: yyyy ----
-      // s_box col: ---- xxxx
-      // s_box[16*(yyyy) + xxxx] == s_box[yyyyxxxx]
-      state[Nb*i+j] = simde_x_aes_s_box[state[Nb*i+j]];
-    }
-  }
+void
+simde_x_aes_bitslice_inv_affine(simde__m128i q[8]) {
+  simde__m128i t[8];
+
+  for (int b = 0 ; b < 8 ; b++)
+    t[b] = simde_mm_xor_si128(simde_mm_xor_si128(q[(b + 2) & 7], q[(b + 5) & 7]), q[(b + 7) & 7]);
+
+  q[0] = simde_x_mm_not_si128(t[0]);
+  q[1] = t[1];
+  q[2] = simde_x_mm_not_si128(t[2]);
+  for (int b = 3 ; b < 8 ; b++)
+    q[b] = t[b];
 }
 
-/*
- * Transformation in the Inverse Cipher that is the inverse of
- * SubBytes().
- */
 SIMDE_FUNCTION_ATTRIBUTES
-void simde_x_aes_inv_sub_bytes(uint8_t *state) {
-
-  int Nb = simde_x_aes_Nb;
-  uint8_t i, j;
-
-  for (i = 0; i < 4; i++) {
-    for (j = 0; j < Nb; j++) {
-      state[Nb*i+j] = simde_x_aes_inv_s_box[state[Nb*i+j]];
-    }
-  }
+void
+simde_x_aes_bitslice_shuffle(simde__m128i q[8], int shuffle) {
+  for (int b = 0 ; b < 8 ; b++)
+    q[b] = simde_mm_shuffle_epi8(q[b], simde_x_aes_vperm_lut.m128i[shuffle]);
 }
 
-/*
- * Performs the AES cipher operation
- */
+/* Spread each bit of round_key across a whole byte so it can be
+ * xored straight into the bitsliced state: shift bit b up to the sign
+ * bit of its byte (anything shifted in from the byte below stays
+ * under it) and compare against zero. */
 SIMDE_FUNCTION_ATTRIBUTES
-void simde_x_aes_enc(simde__m128i_private in, simde__m128i_private *out, simde__m128i_private w, int is_last) {
-
-  int Nb = simde_x_aes_Nb;
-  uint8_t state[4*simde_x_aes_Nb];
-  uint8_t r = 0, i, j;
-
-  for (i = 0; i < 4; i++) {
-    for (j = 0; j < Nb; j++) {
-      state[Nb*i+j] = in.u8[i+4*j];
-    }
-  }
-
-  simde_x_aes_sub_bytes(state);
-  simde_x_aes_shift_rows(state);
-
-  if (!is_last)
-    simde_x_aes_mix_columns(state);
-
-  simde_x_aes_add_round_key(state, w, r);
-
-  for (i = 0; i < 4; i++) {
-    for (j = 0; j < Nb; j++) {
-      out->u8[i+4*j] = state[Nb*i+j];
-    }
-  }
+void
+simde_x_aes_bitslice_expand_key(simde__m128i k[8], simde__m128i round_key) {
+  const simde__m128i zero = simde_mm_setzero_si128();
+
+  k[7] = simde_mm_cmplt_epi8(round_key, zero);
+  k[6] = simde_mm_cmplt_epi8(simde_mm_slli_epi16(round_key, 1), zero);
+  k[5] = simde_mm_cmplt_epi8(simde_mm_slli_epi16(round_key, 2), zero);
+  k[4] = simde_mm_cmplt_epi8(simde_mm_slli_epi16(round_key, 3), zero);
+  k[3] = simde_mm_cmplt_epi8(simde_mm_slli_epi16(round_key, 4), zero);
+  k[2] = simde_mm_cmplt_epi8(simde_mm_slli_epi16(round_key, 5), zero);
+  k[1] = simde_mm_cmplt_epi8(simde_mm_slli_epi16(round_key, 6), zero);
+  k[0] = simde_mm_cmplt_epi8(simde_mm_slli_epi16(round_key, 7), zero);
 }
 
-/*
- * Performs the AES inverse cipher operation
- */
 SIMDE_FUNCTION_ATTRIBUTES
-void simde_x_aes_dec(simde__m128i_private in, simde__m128i_private *out, simde__m128i_private w, int is_last) {
+void
+simde_x_aes_bitslice_add_round_key(simde__m128i q[8], const simde__m128i k[8]) {
+  for (int b = 0 ; b < 8 ; b++)
+    q[b] = simde_mm_xor_si128(q[b], k[b]);
+}
 
-  int Nb = simde_x_aes_Nb;
-  uint8_t state[4*simde_x_aes_Nb];
-  uint8_t r = 0, i, j;
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_aes_bitslice_xtime(simde__m128i q[8]) {
+  const simde__m128i hi = q[7];
+
+  q[7] = q[6];
+  q[6] = q[5];
+  q[5] = q[4];
+  q[4] = simde_mm_xor_si128(q[3], hi);
+  q[3] = simde_mm_xor_si128(q[2], hi);
+  q[2] = q[1];
+  q[1] = simde_mm_xor_si128(q[0], hi);
+  q[0] = hi;
+}
 
-  for (i = 0; i < 4; i++) {
-    for (j = 0; j < Nb; j++) {
-      state[Nb*i+j] = in.u8[i+4*j];
-    }
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_aes_bitslice_mix_columns(simde__m128i q[8]) {
+  simde__m128i r1[8], t[8];
+
+  for (int b = 0 ; b < 8 ; b++) {
+    r1[b] = simde_mm_shuffle_epi8(q[b], simde_x_aes_vperm_lut.m128i[SIMDE_X_AES_VPERM_ROT1_]);
+    t[b] = simde_mm_xor_si128(q[b], r1[b]);
+    q[b] = simde_mm_xor_si128(r1[b], simde_mm_shuffle_epi8(t[b], simde_x_aes_vperm_lut.m128i[SIMDE_X_AES_VPERM_ROT2_]));
   }
 
-  simde_x_aes_inv_shift_rows(state);
-  simde_x_aes_inv_sub_bytes(state);
-
-  if (!is_last)
-    simde_x_aes_inv_mix_columns(state);
-
-  simde_x_aes_add_round_key(state, w, r);
+  simde_x_aes_bitslice_xtime(t);
+  for (int b = 0 ; b < 8 ; b++)
+    q[b] = simde_mm_xor_si128(q[b], t[b]);
+}
 
-  for (i = 0; i < 4; i++) {
-    for (j = 0; j < Nb; j++) {
-      out->u8[i+4*j] = state[Nb*i+j];
-    }
-  }
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_aes_bitslice_inv_mix_columns(simde__m128i q[8]) {
+  simde__m128i t[8];
+
+  for (int b = 0 ; b < 8 ; b++)
+    t[b] = simde_mm_xor_si128(q[b], simde_mm_shuffle_epi8(q[b], simde_x_aes_vperm_lut.m128i[SIMDE_X_AES_VPERM_ROT2_]));
+  simde_x_aes_bitslice_xtime(t);
+  simde_x_aes_bitslice_xtime(t);
+  for (int b = 0 ; b < 8 ; b++)
+    q[b] = simde_mm_xor_si128(q[b], t[b]);
+
+  simde_x_aes_bitslice_mix_columns(q);
 }
-#endif // if !(defined(SIMDE_ARM_NEON_A32V7_NATIVE) && defined(SIMDE_ARCH_ARM_CRYPTO))
+
+#endif /* !defined(SIMDE_X86_AES_NATIVE) && !(defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARCH_ARM_CRYPTO)) */
 
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m128i simde_mm_aesenc_si128(simde__m128i a, simde__m128i round_key) {
   #if defined(SIMDE_X86_AES_NATIVE)
     return _mm_aesenc_si128(a, round_key);
-  #else
+  #elif defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARCH_ARM_CRYPTO)
     simde__m128i_private result_;
     simde__m128i_private a_ = simde__m128i_to_private(a);
     simde__m128i_private round_key_ = simde__m128i_to_private(round_key);
-    #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARCH_ARM_CRYPTO)
-      result_.neon_u8 = veorq_u8(
-        vaesmcq_u8(vaeseq_u8(a_.neon_u8, vdupq_n_u8(0))),
-        round_key_.neon_u8);
-    #else
-      simde_x_aes_enc(a_, &result_, round_key_, 0);
-    #endif
+    result_.neon_u8 = veorq_u8(
+      vaesmcq_u8(vaeseq_u8(a_.neon_u8, vdupq_n_u8(0))),
+      round_key_.neon_u8);
     return simde__m128i_from_private(result_);
+  #else
+    simde__m128i r = simde_mm_shuffle_epi8(a, simde_x_aes_vperm_lut.m128i[SIMDE_X_AES_VPERM_SHIFT_ROWS_]);
+    r = simde_x_aes_vperm_sub_bytes(r, SIMDE_X_AES_VPERM_ENC_);
+    r = simde_x_aes_vperm_mix_columns(r);
+    /* MixColumns maps a column of 0x63s to itself, so the S-box
+     * constant can be added here. */
+    return simde_mm_xor_si128(r, simde_mm_xor_si128(round_key, simde_mm_set1_epi8(0x63)));
   #endif
 }
 #if defined(SIMDE_X86_AES_ENABLE_NATIVE_ALIASES)
@@ -316,18 +476,19 @@ SIMDE_FUNCTION_ATTRIBUTES
 simde__m128i simde_mm_aesdec_si128(simde__m128i a, simde__m128i round_key) {
   #if defined(SIMDE_X86_AES_NATIVE)
     return _mm_aesdec_si128(a, round_key);
-  #else
+  #elif defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARCH_ARM_CRYPTO)
     simde__m128i_private result_;
     simde__m128i_private a_ = simde__m128i_to_private(a);
     simde__m128i_private round_key_ = simde__m128i_to_private(round_key);
-    #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARCH_ARM_CRYPTO)
-      result_.neon_u8 = veorq_u8(
-        vaesimcq_u8(vaesdq_u8(a_.neon_u8, vdupq_n_u8(0))),
-        round_key_.neon_u8);
-    #else
-      simde_x_aes_dec(a_, &result_, round_key_, 0);
-    #endif
+    result_.neon_u8 = veorq_u8(
+      vaesimcq_u8(vaesdq_u8(a_.neon_u8, vdupq_n_u8(0))),
+      round_key_.neon_u8);
     return simde__m128i_from_private(result_);
+  #else
+    simde__m128i r = simde_mm_shuffle_epi8(a, simde_x_aes_vperm_lut.m128i[SIMDE_X_AES_VPERM_INV_SHIFT_ROWS_]);
+    r = simde_x_aes_vperm_sub_bytes(r, SIMDE_X_AES_VPERM_DEC_);
+    r = simde_x_aes_vperm_inv_mix_columns(r);
+    return simde_mm_xor_si128(r, round_key);
   #endif
 }
 #if defined(SIMDE_X86_AES_ENABLE_NATIVE_ALIASES)
@@ -338,17 +499,17 @@ SIMDE_FUNCTION_ATTRIBUTES
 simde__m128i simde_mm_aesenclast_si128(simde__m128i a, simde__m128i round_key) {
   #if defined(SIMDE_X86_AES_NATIVE)
     return _mm_aesenclast_si128(a, round_key);
-  #else
+  #elif defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARCH_ARM_CRYPTO)
     simde__m128i_private result_;
     simde__m128i_private a_ = simde__m128i_to_private(a);
     simde__m128i_private round_key_ = simde__m128i_to_private(round_key);
-    #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARCH_ARM_CRYPTO)
-      result_.neon_u8 = vaeseq_u8(a_.neon_u8, vdupq_n_u8(0));
-      result_.neon_i32 = veorq_s32(result_.neon_i32, round_key_.neon_i32); // _mm_xor_si128
-    #else
-      simde_x_aes_enc(a_, &result_, round_key_, 1);
-    #endif
+    result_.neon_u8 = vaeseq_u8(a_.neon_u8, vdupq_n_u8(0));
+    result_.neon_i32 = veorq_s32(result_.neon_i32, round_key_.neon_i32); // _mm_xor_si128
     return simde__m128i_from_private(result_);
+  #else
+    simde__m128i r = simde_mm_shuffle_epi8(a, simde_x_aes_vperm_lut.m128i[SIMDE_X_AES_VPERM_SHIFT_ROWS_]);
+    r = simde_x_aes_vperm_sub_bytes(r, SIMDE_X_AES_VPERM_ENC_);
+    return simde_mm_xor_si128(r, simde_mm_xor_si128(round_key, simde_mm_set1_epi8(0x63)));
   #endif
 }
 #if defined(SIMDE_X86_AES_ENABLE_NATIVE_ALIASES)
@@ -359,18 +520,18 @@ SIMDE_FUNCTION_ATTRIBUTES
 simde__m128i simde_mm_aesdeclast_si128(simde__m128i a, simde__m128i round_key) {
   #if defined(SIMDE_X86_AES_NATIVE)
     return _mm_aesdeclast_si128(a, round_key);
-  #else
+  #elif defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARCH_ARM_CRYPTO)
     simde__m128i_private result_;
     simde__m128i_private a_ = simde__m128i_to_private(a);
     simde__m128i_private round_key_ = simde__m128i_to_private(round_key);
-    #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARCH_ARM_CRYPTO)
-      result_.neon_u8 = veorq_u8(
-        vaesdq_u8(a_.neon_u8, vdupq_n_u8(0)),
-        round_key_.neon_u8);
-    #else
-      simde_x_aes_dec(a_, &result_, round_key_, 1);
-    #endif
+    result_.neon_u8 = veorq_u8(
+      vaesdq_u8(a_.neon_u8, vdupq_n_u8(0)),
+      round_key_.neon_u8);
     return simde__m128i_from_private(result_);
+  #else
+    simde__m128i r = simde_mm_shuffle_epi8(a, simde_x_aes_vperm_lut.m128i[SIMDE_X_AES_VPERM_INV_SHIFT_ROWS_]);
+    r = simde_x_aes_vperm_sub_bytes(r, SIMDE_X_AES_VPERM_DEC_);
+    return simde_mm_xor_si128(r, round_key);
   #endif
 }
 #if defined(SIMDE_X86_AES_ENABLE_NATIVE_ALIASES)
@@ -381,37 +542,337 @@ SIMDE_FUNCTION_ATTRIBUTES
 simde__m128i simde_mm_aesimc_si128(simde__m128i a) {
   #if defined(SIMDE_X86_AES_NATIVE)
     return _mm_aesimc_si128(a);
-  #else
-    simde__m128i_private result_ = simde__m128i_to_private(simde_mm_setzero_si128());
+  #elif defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARCH_ARM_CRYPTO)
+    simde__m128i_private result_;
     simde__m128i_private a_ = simde__m128i_to_private(a);
+    result_.neon_u8 = vaesimcq_u8(a_.neon_u8);
+    return simde__m128i_from_private(result_);
+  #else
+    return simde_x_aes_vperm_inv_mix_columns(a);
+  #endif
+}
+#if defined(SIMDE_X86_AES_ENABLE_NATIVE_ALIASES)
+  #define _mm_aesimc_si128(a) simde_mm_aesimc_si128(a)
+#endif
 
-    #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARCH_ARM_CRYPTO)
-      result_.neon_u8 = vaesimcq_u8(a_.neon_u8);
-    #else
-      int Nb = simde_x_aes_Nb;
-      // uint8_t k[] = {0x0e, 0x09, 0x0d, 0x0b}; // a(x) = {0e} + {09}x + {0d}x2 + {0b}x3
-      uint8_t i, j, col[4], res[4];
+/* VAES: the same rounds applied independently to each 128-bit lane.
+ * Without VAES every lane goes through the corresponding _mm_aes*
+ * function (AES-NI, the ARMv8 crypto extension, or the vperm code
+ * above); the lanes don't depend on each other so they still overlap. */
 
-      for (j = 0; j < Nb; j++) {
-        for (i = 0; i < 4; i++) {
-          col[i] = a_.u8[Nb*j+i];
-        }
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_aesenc_epi128(simde__m256i a, simde__m256i round_key) {
+  #if defined(SIMDE_X86_VAES_NATIVE) && defined(SIMDE_X86_AVX_NATIVE)
+    return _mm256_aesenc_epi128(a, round_key);
+  #else
+    simde__m256i_private
+      r_,
+      a_ = simde__m256i_to_private(a),
+      round_key_ = simde__m256i_to_private(round_key);
 
-        //coef_mult(k, col, res);
-        simde_x_aes_coef_mult_lookup(4, col, res);
+    for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+      r_.m128i[i] = simde_mm_aesenc_si128(a_.m128i[i], round_key_.m128i[i]);
+    }
 
-        for (i = 0; i < 4; i++) {
-          result_.u8[Nb*j+i] = res[i];
-        }
-      }
-    #endif
-    return simde__m128i_from_private(result_);
+    return simde__m256i_from_private(r_);
   #endif
 }
-#if defined(SIMDE_X86_AES_ENABLE_NATIVE_ALIASES)
-  #define _mm_aesimc_si128(a) simde_mm_aesimc_si128(a)
+#if defined(SIMDE_X86_VAES_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_aesenc_epi128
+  #define _mm256_aesenc_epi128(a, b) simde_mm256_aesenc_epi128(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_aesdec_epi128(simde__m256i a, simde__m256i round_key) {
+  #if defined(SIMDE_X86_VAES_NATIVE) && defined(SIMDE_X86_AVX_NATIVE)
+    return _mm256_aesdec_epi128(a, round_key);
+  #else
+    simde__m256i_private
+      r_,
+      a_ = simde__m256i_to_private(a),
+      round_key_ = simde__m256i_to_private(round_key);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+      r_.m128i[i] = simde_mm_aesdec_si128(a_.m128i[i], round_key_.m128i[i]);
+    }
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_VAES_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_aesdec_epi128
+  #define _mm256_aesdec_epi128(a, b) simde_mm256_aesdec_epi128(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_aesenclast_epi128(simde__m256i a, simde__m256i round_key) {
+  #if defined(SIMDE_X86_VAES_NATIVE) && defined(SIMDE_X86_AVX_NATIVE)
+    return _mm256_aesenclast_epi128(a, round_key);
+  #else
+    simde__m256i_private
+      r_,
+      a_ = simde__m256i_to_private(a),
+      round_key_ = simde__m256i_to_private(round_key);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+      r_.m128i[i] = simde_mm_aesenclast_si128(a_.m128i[i], round_key_.m128i[i]);
+    }
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_VAES_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_aesenclast_epi128
+  #define _mm256_aesenclast_epi128(a, b) simde_mm256_aesenclast_epi128(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_aesdeclast_epi128(simde__m256i a, simde__m256i round_key) {
+  #if defined(SIMDE_X86_VAES_NATIVE) && defined(SIMDE_X86_AVX_NATIVE)
+    return _mm256_aesdeclast_epi128(a, round_key);
+  #else
+    simde__m256i_private
+      r_,
+      a_ = simde__m256i_to_private(a),
+      round_key_ = simde__m256i_to_private(round_key);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+      r_.m128i[i] = simde_mm_aesdeclast_si128(a_.m128i[i], round_key_.m128i[i]);
+    }
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_VAES_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_aesdeclast_epi128
+  #define _mm256_aesdeclast_epi128(a, b) simde_mm256_aesdeclast_epi128(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_aesenc_epi128(simde__m512i a, simde__m512i round_key) {
+  #if defined(SIMDE_X86_VAES_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_aesenc_epi128(a, round_key);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      round_key_ = simde__m512i_to_private(round_key);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+      r_.m256i[i] = simde_mm256_aesenc_epi128(a_.m256i[i], round_key_.m256i[i]);
+    }
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_VAES_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_aesenc_epi128
+  #define _mm512_aesenc_epi128(a, b) simde_mm512_aesenc_epi128(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_aesdec_epi128(simde__m512i a, simde__m512i round_key) {
+  #if defined(SIMDE_X86_VAES_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_aesdec_epi128(a, round_key);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      round_key_ = simde__m512i_to_private(round_key);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+      r_.m256i[i] = simde_mm256_aesdec_epi128(a_.m256i[i], round_key_.m256i[i]);
+    }
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_VAES_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_aesdec_epi128
+  #define _mm512_aesdec_epi128(a, b) simde_mm512_aesdec_epi128(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_aesenclast_epi128(simde__m512i a, simde__m512i round_key) {
+  #if defined(SIMDE_X86_VAES_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_aesenclast_epi128(a, round_key);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      round_key_ = simde__m512i_to_private(round_key);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+      r_.m256i[i] = simde_mm256_aesenclast_epi128(a_.m256i[i], round_key_.m256i[i]);
+    }
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_VAES_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_aesenclast_epi128
+  #define _mm512_aesenclast_epi128(a, b) simde_mm512_aesenclast_epi128(a, b)
 #endif
 
-#undef simde_x_aes_Nb
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_aesdeclast_epi128(simde__m512i a, simde__m512i round_key) {
+  #if defined(SIMDE_X86_VAES_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_aesdeclast_epi128(a, round_key);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      round_key_ = simde__m512i_to_private(round_key);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+      r_.m256i[i] = simde_mm256_aesdeclast_epi128(a_.m256i[i], round_key_.m256i[i]);
+    }
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_VAES_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_aesdeclast_epi128
+  #define _mm512_aesdeclast_epi128(a, b) simde_mm512_aesdeclast_epi128(a, b)
+#endif
+
+/* Encrypt n independent blocks in place with an expanded key
+ * (round_keys[0] through round_keys[rounds], as used with AES-NI:
+ * rounds is 10, 12 or 14).  Equivalent to
+ *
+ *   b = _mm_xor_si128(b, round_keys[0]);
+ *   for (int r = 1 ; r < rounds ; r++)
+ *     b = _mm_aesenc_si128(b, round_keys[r]);
+ *   b = _mm_aesenclast_si128(b, round_keys[rounds]);
+ *
+ * for each block. */
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_aes_encrypt_blocks(simde__m128i* blocks, size_t n, const simde__m128i* round_keys, int rounds)
+    SIMDE_REQUIRE_RANGE(rounds, 10, 14)
+    HEDLEY_REQUIRE_MSG((rounds & 1) == 0, "`rounds' must be 10, 12 or 14") {
+  #if defined(SIMDE_X86_AES_NATIVE) || (defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARCH_ARM_CRYPTO))
+    for (size_t i = 0 ; i < n ; i++) {
+      simde__m128i b = simde_mm_xor_si128(blocks[i], round_keys[0]);
+      for (int r = 1 ; r < rounds ; r++)
+        b = simde_mm_aesenc_si128(b, round_keys[r]);
+      blocks[i] = simde_mm_aesenclast_si128(b, round_keys[rounds]);
+    }
+  #else
+    /* k only has room for the 15 round keys of AES-256; any other
+     * round count is left to the single-block loop below. */
+    simde__m128i k[15][8];
+    const int bitslice = (rounds == 10) || (rounds == 12) || (rounds == 14);
+    if (bitslice && n >= SIMDE_X_AES_BITSLICE_MIN_BLOCKS_) {
+      for (int r = 0 ; r <= rounds ; r++)
+        simde_x_aes_bitslice_expand_key(k[r], round_keys[r]);
+    }
+
+    for ( ; bitslice && n >= SIMDE_X_AES_BITSLICE_MIN_BLOCKS_ ; ) {
+      const size_t c = (n < 8) ? n : 8;
+      simde__m128i q[8];
+
+      for (size_t i = 0 ; i < 8 ; i++)
+        q[i] = (i < c) ? blocks[i] : simde_mm_setzero_si128();
+      simde_x_aes_bitslice_transpose(q);
+
+      simde_x_aes_bitslice_add_round_key(q, k[0]);
+      for (int r = 1 ; r <= rounds ; r++) {
+        simde_x_aes_bitslice_sub_bytes(q);
+        simde_x_aes_bitslice_shuffle(q, SIMDE_X_AES_VPERM_SHIFT_ROWS_);
+        if (r != rounds)
+          simde_x_aes_bitslice_mix_columns(q);
+        simde_x_aes_bitslice_add_round_key(q, k[r]);
+      }
+
+      simde_x_aes_bitslice_transpose(q);
+      for (size_t i = 0 ; i < c ; i++)
+        blocks[i] = q[i];
+
+      blocks += c;
+      n -= c;
+    }
+
+    for (size_t i = 0 ; i < n ; i++) {
+      simde__m128i b = simde_mm_xor_si128(blocks[i], round_keys[0]);
+      for (int r = 1 ; r < rounds ; r++)
+        b = simde_mm_aesenc_si128(b, round_keys[r]);
+      blocks[i] = simde_mm_aesenclast_si128(b, round_keys[rounds]);
+    }
+  #endif
+}
+
+/* The inverse of simde_x_aes_encrypt_blocks using the equivalent
+ * inverse cipher, i.e., round_keys is the decryption key schedule
+ * (the encryption keys in reverse order, with _mm_aesimc_si128 applied
+ * to all but the first and last) and each block goes through
+ * _mm_aesdec_si128 / _mm_aesdeclast_si128. */
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_aes_decrypt_blocks(simde__m128i* blocks, size_t n, const simde__m128i* round_keys, int rounds)
+    SIMDE_REQUIRE_RANGE(rounds, 10, 14)
+    HEDLEY_REQUIRE_MSG((rounds & 1) == 0, "`rounds' must be 10, 12 or 14") {
+  #if defined(SIMDE_X86_AES_NATIVE) || (defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARCH_ARM_CRYPTO))
+    for (size_t i = 0 ; i < n ; i++) {
+      simde__m128i b = simde_mm_xor_si128(blocks[i], round_keys[0]);
+      for (int r = 1 ; r < rounds ; r++)
+        b = simde_mm_aesdec_si128(b, round_keys[r]);
+      blocks[i] = simde_mm_aesdeclast_si128(b, round_keys[rounds]);
+    }
+  #else
+    simde__m128i k[15][8];
+    const int bitslice = (rounds == 10) || (rounds == 12) || (rounds == 14);
+    if (bitslice && n >= SIMDE_X_AES_BITSLICE_MIN_BLOCKS_) {
+      for (int r = 0 ; r <= rounds ; r++)
+        simde_x_aes_bitslice_expand_key(k[r], round_keys[r]);
+    }
+
+    for ( ; bitslice && n >= SIMDE_X_AES_BITSLICE_MIN_BLOCKS_ ; ) {
+      const size_t c = (n < 8) ? n : 8;
+      simde__m128i q[8];
+
+      for (size_t i = 0 ; i < 8 ; i++)
+        q[i] = (i < c) ? blocks[i] : simde_mm_setzero_si128();
+      simde_x_aes_bitslice_transpose(q);
+
+      simde_x_aes_bitslice_add_round_key(q, k[0]);
+      for (int r = 1 ; r <= rounds ; r++) {
+        simde_x_aes_bitslice_inv_affine(q);
+        simde_x_aes_bitslice_sub_bytes(q);
+        simde_x_aes_bitslice_inv_affine(q);
+        simde_x_aes_bitslice_shuffle(q, SIMDE_X_AES_VPERM_INV_SHIFT_ROWS_);
+        if (r != rounds)
+          simde_x_aes_bitslice_inv_mix_columns(q);
+        simde_x_aes_bitslice_add_round_key(q, k[r]);
+      }
+
+      simde_x_aes_bitslice_transpose(q);
+      for (size_t i = 0 ; i < c ; i++)
+        blocks[i] = q[i];
+
+      blocks += c;
+      n -= c;
+    }
+
+    for (size_t i = 0 ; i < n ; i++) {
+      simde__m128i b = simde_mm_xor_si128(blocks[i], round_keys[0]);
+      for (int r = 1 ; r < rounds ; r++)
+        b = simde_mm_aesdec_si128(b, round_keys[r]);
+      blocks[i] = simde_mm_aesdeclast_si128(b, round_keys[rounds]);
+    }
+  #endif
+}
+
+SIMDE_END_DECLS_
+
+HEDLEY_DIAGNOSTIC_POP
 
 #endif /* !defined(SIMDE_X86_AES_H) */
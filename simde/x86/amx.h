@@ -0,0 +1,468 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* AMX: tile configuration, tile loads/stores and the AMX-INT8 /
+ * AMX-BF16 tile dot products.
+ *
+ * When emulated, the eight tile registers (palette 1: up to 16 rows of
+ * 64 bytes each) live in a per-thread buffer, so each tile row is
+ * exactly one simde__m512i.  That buffer has internal linkage like the
+ * rest of SIMDe, so tiles configured and loaded in one translation unit
+ * aren't visible from another.
+ *
+ * The dot products are a small GEMM micro-kernel: B is packed once per
+ * call, then C is processed four rows at a time, keeping those rows in
+ * registers for the whole K loop and broadcasting one dword of A per
+ * row and step, which feeds straight into the (emulated or native)
+ * VPDPBUSD/VDPBF16PS.  A tile is at most 1 KiB, so everything else
+ * already fits in L1.
+ *
+ * Unlike the hardware, invalid configurations are clamped to the
+ * palette 1 limits instead of faulting, and TDPBF16PS doesn't flush
+ * denormals; it rounds exactly like simde_mm512_dpbf16_ps. */
+
+#if !defined(SIMDE_X86_AMX_H)
+#define SIMDE_X86_AMX_H
+
+#include "avx512/types.h"
+#include "avx512/add.h"
+#include "avx512/cast.h"
+#include "avx512/dpbf16.h"
+#include "avx512/dpbusd.h"
+#include "avx512/loadu.h"
+#include "avx512/mov.h"
+#include "avx512/set1.h"
+#include "avx512/setzero.h"
+#include "avx512/storeu.h"
+#include "avx512/sub.h"
+#include "avx512/xor.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+#if !defined(SIMDE_X86_AMX_TILE_NATIVE)
+
+#define SIMDE_X86_AMX_TILES_ 8
+#define SIMDE_X86_AMX_ROWS_ 16
+#define SIMDE_X86_AMX_COLSB_ 64
+
+#if defined(__cplusplus) && (__cplusplus >= 201103L)
+  #define SIMDE_X86_AMX_THREAD_LOCAL_ thread_local
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_THREADS__)
+  #define SIMDE_X86_AMX_THREAD_LOCAL_ _Thread_local
+#elif defined(HEDLEY_MSVC_VERSION)
+  #define SIMDE_X86_AMX_THREAD_LOCAL_ __declspec(thread)
+#elif defined(HEDLEY_GNUC_VERSION)
+  #define SIMDE_X86_AMX_THREAD_LOCAL_ __thread
+#else
+  #define SIMDE_X86_AMX_THREAD_LOCAL_
+#endif
+
+typedef struct {
+  simde__m512i_private tile[SIMDE_X86_AMX_TILES_][SIMDE_X86_AMX_ROWS_];
+  uint16_t colsb[SIMDE_X86_AMX_TILES_];
+  uint8_t rows[SIMDE_X86_AMX_TILES_];
+  uint8_t palette_id;
+  uint8_t start_row;
+} simde_x_amx_tile_state_;
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_x_amx_tile_state_*
+simde_x_amx_state_ (void) {
+  static SIMDE_X86_AMX_THREAD_LOCAL_ simde_x_amx_tile_state_ state;
+  return &state;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_amx_zero_tile_ (simde_x_amx_tile_state_* state, int tile) {
+  for (size_t i = 0 ; i < SIMDE_X86_AMX_ROWS_ ; i++) {
+    state->tile[tile][i] = simde__m512i_to_private(simde_mm512_setzero_si512());
+  }
+}
+
+/* Mask of the dword lanes that are inside a row of colsb bytes. */
+SIMDE_FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_x_amx_lane_mask_ (uint16_t colsb) {
+  return HEDLEY_STATIC_CAST(simde__mmask16, (UINT32_C(1) << (colsb / 4)) - 1);
+}
+
+#endif /* !defined(SIMDE_X86_AMX_TILE_NATIVE) */
+
+/* GCC implements the AMX memory intrinsics as inline asm which doesn't
+ * tell the compiler about most of the memory involved: ldtilecfg and
+ * sttilecfg only claim the first 8 bytes of the configuration, and
+ * tileloadd claims none at all.  Without a barrier, stores to a
+ * configuration or to tile data may be dropped or sunk below the load
+ * (and the result of sttilecfg never re-read). */
+#if defined(SIMDE_X86_AMX_TILE_NATIVE) && defined(HEDLEY_GCC_VERSION)
+  #define SIMDE_X86_AMX_MEMORY_BARRIER_(ptr) __asm__ __volatile__("" : : "r" (ptr) : "memory")
+#elif defined(SIMDE_X86_AMX_TILE_NATIVE)
+  #define SIMDE_X86_AMX_MEMORY_BARRIER_(ptr) ((void) (ptr))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_tile_loadconfig (const void* mem_addr) {
+  #if defined(SIMDE_X86_AMX_TILE_NATIVE)
+    SIMDE_X86_AMX_MEMORY_BARRIER_(mem_addr);
+    _tile_loadconfig(mem_addr);
+  #else
+    const uint8_t* config = HEDLEY_REINTERPRET_CAST(const uint8_t*, mem_addr);
+    simde_x_amx_tile_state_* state = simde_x_amx_state_();
+
+    for (int i = 0 ; i < SIMDE_X86_AMX_TILES_ ; i++) {
+      simde_x_amx_zero_tile_(state, i);
+    }
+
+    /* Palette 0 puts AMX back into its initial (unconfigured) state. */
+    state->palette_id = config[0];
+    state->start_row = (config[0] == 0) ? 0 : config[1];
+    for (size_t i = 0 ; i < SIMDE_X86_AMX_TILES_ ; i++) {
+      uint16_t colsb = HEDLEY_STATIC_CAST(uint16_t, config[16 + (2 * i)] | (config[17 + (2 * i)] << 8));
+      uint8_t rows = config[48 + i];
+
+      state->colsb[i] = (config[0] == 0) ? 0 : ((colsb > SIMDE_X86_AMX_COLSB_) ? SIMDE_X86_AMX_COLSB_ : colsb);
+      state->rows[i]  = (config[0] == 0) ? 0 : ((rows  > SIMDE_X86_AMX_ROWS_ ) ? SIMDE_X86_AMX_ROWS_  : rows );
+    }
+  #endif
+}
+#if defined(SIMDE_X86_AMX_TILE_ENABLE_NATIVE_ALIASES)
+  #undef _tile_loadconfig
+  #define _tile_loadconfig(mem_addr) simde_tile_loadconfig(mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_tile_storeconfig (void* mem_addr) {
+  #if defined(SIMDE_X86_AMX_TILE_NATIVE)
+    _tile_storeconfig(mem_addr);
+    SIMDE_X86_AMX_MEMORY_BARRIER_(mem_addr);
+  #else
+    uint8_t* config = HEDLEY_REINTERPRET_CAST(uint8_t*, mem_addr);
+    const simde_x_amx_tile_state_* state = simde_x_amx_state_();
+
+    simde_memset(config, 0, 64);
+    config[0] = state->palette_id;
+    config[1] = state->start_row;
+    for (size_t i = 0 ; i < SIMDE_X86_AMX_TILES_ ; i++) {
+      config[16 + (2 * i)] = HEDLEY_STATIC_CAST(uint8_t, state->colsb[i]);
+      config[17 + (2 * i)] = HEDLEY_STATIC_CAST(uint8_t, state->colsb[i] >> 8);
+      config[48 + i] = state->rows[i];
+    }
+  #endif
+}
+#if defined(SIMDE_X86_AMX_TILE_ENABLE_NATIVE_ALIASES)
+  #undef _tile_storeconfig
+  #define _tile_storeconfig(mem_addr) simde_tile_storeconfig(mem_addr)
+#endif
+
+#if defined(SIMDE_X86_AMX_TILE_NATIVE)
+  #define simde_tile_release() _tile_release()
+#else
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_tile_release (void) {
+  simde_x_amx_tile_state_* state = simde_x_amx_state_();
+
+  for (int i = 0 ; i < SIMDE_X86_AMX_TILES_ ; i++) {
+    simde_x_amx_zero_tile_(state, i);
+    state->colsb[i] = 0;
+    state->rows[i] = 0;
+  }
+  state->palette_id = 0;
+  state->start_row = 0;
+}
+#endif
+#if defined(SIMDE_X86_AMX_TILE_ENABLE_NATIVE_ALIASES)
+  #undef _tile_release
+  #define _tile_release() simde_tile_release()
+#endif
+
+#if defined(SIMDE_X86_AMX_TILE_NATIVE)
+  #define simde_tile_zero(tile) _tile_zero(tile)
+#else
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_tile_zero (int tile)
+    SIMDE_REQUIRE_CONSTANT_RANGE(tile, 0, 7) {
+  simde_x_amx_zero_tile_(simde_x_amx_state_(), tile);
+}
+#endif
+#if defined(SIMDE_X86_AMX_TILE_ENABLE_NATIVE_ALIASES)
+  #undef _tile_zero
+  #define _tile_zero(tile) simde_tile_zero(tile)
+#endif
+
+#if defined(SIMDE_X86_AMX_TILE_NATIVE)
+  #define simde_tile_loadd(dst, base, stride) do { \
+      const void* simde_tile_loadd_base_ = (base); \
+      SIMDE_X86_AMX_MEMORY_BARRIER_(simde_tile_loadd_base_); \
+      _tile_loadd(dst, simde_tile_loadd_base_, stride); \
+    } while (0)
+#else
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_tile_loadd (int dst, const void* base, size_t stride)
+    SIMDE_REQUIRE_CONSTANT_RANGE(dst, 0, 7) {
+  simde_x_amx_tile_state_* state = simde_x_amx_state_();
+  const uint8_t* src = HEDLEY_REINTERPRET_CAST(const uint8_t*, base);
+  const uint16_t colsb = state->colsb[dst];
+
+  simde_x_amx_zero_tile_(state, dst);
+  for (size_t i = 0 ; i < state->rows[dst] ; i++) {
+    if (colsb == SIMDE_X86_AMX_COLSB_) {
+      state->tile[dst][i] = simde__m512i_to_private(simde_mm512_loadu_si512(src + (i * stride)));
+    } else {
+      simde_memcpy(&(state->tile[dst][i]), src + (i * stride), colsb);
+    }
+  }
+}
+#endif
+#if defined(SIMDE_X86_AMX_TILE_ENABLE_NATIVE_ALIASES)
+  #undef _tile_loadd
+  #define _tile_loadd(dst, base, stride) simde_tile_loadd(dst, base, HEDLEY_STATIC_CAST(size_t, stride))
+#endif
+
+#if defined(SIMDE_X86_AMX_TILE_NATIVE)
+  #define simde_tile_stream_loadd(dst, base, stride) do { \
+      const void* simde_tile_stream_loadd_base_ = (base); \
+      SIMDE_X86_AMX_MEMORY_BARRIER_(simde_tile_stream_loadd_base_); \
+      _tile_stream_loadd(dst, simde_tile_stream_loadd_base_, stride); \
+    } while (0)
+#else
+  #define simde_tile_stream_loadd(dst, base, stride) simde_tile_loadd(dst, base, stride)
+#endif
+#if defined(SIMDE_X86_AMX_TILE_ENABLE_NATIVE_ALIASES)
+  #undef _tile_stream_loadd
+  #define _tile_stream_loadd(dst, base, stride) simde_tile_stream_loadd(dst, base, HEDLEY_STATIC_CAST(size_t, stride))
+#endif
+
+#if defined(SIMDE_X86_AMX_TILE_NATIVE)
+  #define simde_tile_stored(src, base, stride) _tile_stored(src, base, stride)
+#else
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_tile_stored (int src, void* base, size_t stride)
+    SIMDE_REQUIRE_CONSTANT_RANGE(src, 0, 7) {
+  const simde_x_amx_tile_state_* state = simde_x_amx_state_();
+  uint8_t* dst = HEDLEY_REINTERPRET_CAST(uint8_t*, base);
+  const uint16_t colsb = state->colsb[src];
+
+  for (size_t i = 0 ; i < state->rows[src] ; i++) {
+    if (colsb == SIMDE_X86_AMX_COLSB_) {
+      simde_mm512_storeu_si512(dst + (i * stride), simde__m512i_from_private(state->tile[src][i]));
+    } else {
+      simde_memcpy(dst + (i * stride), &(state->tile[src][i]), colsb);
+    }
+  }
+}
+#endif
+#if defined(SIMDE_X86_AMX_TILE_ENABLE_NATIVE_ALIASES)
+  #undef _tile_stored
+  #define _tile_stored(src, base, stride) simde_tile_stored(src, base, HEDLEY_STATIC_CAST(size_t, stride))
+#endif
+
+#if !defined(SIMDE_X86_AMX_TILE_NATIVE)
+/* C[m] += sum over k of dot4(A[m].dword[k], B[k]) for `n` consecutive
+ * rows of C starting at m, with those rows kept in registers.  The
+ * caller passes a constant n so the row loops unroll.
+ *
+ * VPDPBUSD multiplies unsigned bytes of its first source by signed
+ * bytes of its second, so the other combinations are mapped onto it by
+ * flipping the top bit of an operand (x ^ 0x80 == x +/- 128):
+ *
+ *   a signed:    a * b = (a ^ 0x80) * b - 128 * b
+ *   b unsigned:  a * b = a * (b ^ 0x80) + 128 * a
+ *
+ * All of this wraps just like the instructions, so it's exact.  B is
+ * already flipped by the caller, the column term (128 * sum(b)) is in
+ * col_bias, and the row term (128 * sum(a)) is computed here. */
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_tile_dpb_rows_ (
+    simde_x_amx_tile_state_* state, int dst, int src1, size_t m, size_t n,
+    const simde__m512i b[SIMDE_X86_AMX_ROWS_], size_t k_dwords,
+    simde__m512i col_bias, int a_signed, int b_signed) {
+  const int32_t a_flip = a_signed ? ~INT32_C(0x7F7F7F7F) : INT32_C(0);
+  const simde__mmask16 lanes = simde_x_amx_lane_mask_(state->colsb[dst]);
+  simde__m512i acc[4];
+
+  for (size_t r = 0 ; r < n ; r++) {
+    int32_t row_bias = 0;
+    if (!b_signed) {
+      for (size_t k = 0 ; k < (k_dwords * 4) ; k++) {
+        row_bias += a_signed ? HEDLEY_STATIC_CAST(int32_t, state->tile[src1][m + r].i8[k]) : HEDLEY_STATIC_CAST(int32_t, state->tile[src1][m + r].u8[k]);
+      }
+      row_bias = HEDLEY_STATIC_CAST(int32_t, HEDLEY_STATIC_CAST(uint32_t, row_bias) << 7);
+    }
+    acc[r] =
+      simde_mm512_sub_epi32(
+        simde_mm512_add_epi32(simde__m512i_from_private(state->tile[dst][m + r]), simde_mm512_set1_epi32(row_bias)),
+        col_bias);
+  }
+
+  for (size_t k = 0 ; k < k_dwords ; k++) {
+    for (size_t r = 0 ; r < n ; r++) {
+      acc[r] = simde_mm512_dpbusd_epi32(acc[r], simde_mm512_set1_epi32(state->tile[src1][m + r].i32[k] ^ a_flip), b[k]);
+    }
+  }
+
+  for (size_t r = 0 ; r < n ; r++) {
+    state->tile[dst][m + r] = simde__m512i_to_private(simde_mm512_maskz_mov_epi32(lanes, acc[r]));
+  }
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_tile_dpb_ (int dst, int src1, int src2, int a_signed, int b_signed) {
+  simde_x_amx_tile_state_* state = simde_x_amx_state_();
+  const size_t m_rows = state->rows[dst];
+  const size_t k_dwords = state->colsb[src1] / 4;
+  const simde__m512i flip = simde_mm512_set1_epi32(~INT32_C(0x7F7F7F7F));
+  simde__m512i b[SIMDE_X86_AMX_ROWS_];
+  simde__m512i col_bias = simde_mm512_setzero_si512();
+  size_t m = 0;
+
+  for (size_t k = 0 ; k < k_dwords ; k++) {
+    b[k] = simde__m512i_from_private(state->tile[src2][k]);
+    if (!b_signed)
+      b[k] = simde_mm512_xor_si512(b[k], flip);
+    if (a_signed)
+      col_bias = simde_mm512_dpbusd_epi32(col_bias, flip, b[k]);
+  }
+
+  for ( ; (m + 4) <= m_rows ; m += 4)
+    simde_x_tile_dpb_rows_(state, dst, src1, m, 4, b, k_dwords, col_bias, a_signed, b_signed);
+  for ( ; m < m_rows ; m++)
+    simde_x_tile_dpb_rows_(state, dst, src1, m, 1, b, k_dwords, col_bias, a_signed, b_signed);
+  for ( ; m < SIMDE_X86_AMX_ROWS_ ; m++)
+    state->tile[dst][m] = simde__m512i_to_private(simde_mm512_setzero_si512());
+}
+#endif
+
+#if defined(SIMDE_X86_AMX_INT8_NATIVE)
+  #define simde_tile_dpbssd(dst, src1, src2) _tile_dpbssd(dst, src1, src2)
+#else
+  #define simde_tile_dpbssd(dst, src1, src2) simde_x_tile_dpb_(dst, src1, src2, 1, 1)
+#endif
+#if defined(SIMDE_X86_AMX_INT8_ENABLE_NATIVE_ALIASES)
+  #undef _tile_dpbssd
+  #define _tile_dpbssd(dst, src1, src2) simde_tile_dpbssd(dst, src1, src2)
+#endif
+
+#if defined(SIMDE_X86_AMX_INT8_NATIVE)
+  #define simde_tile_dpbsud(dst, src1, src2) _tile_dpbsud(dst, src1, src2)
+#else
+  #define simde_tile_dpbsud(dst, src1, src2) simde_x_tile_dpb_(dst, src1, src2, 1, 0)
+#endif
+#if defined(SIMDE_X86_AMX_INT8_ENABLE_NATIVE_ALIASES)
+  #undef _tile_dpbsud
+  #define _tile_dpbsud(dst, src1, src2) simde_tile_dpbsud(dst, src1, src2)
+#endif
+
+#if defined(SIMDE_X86_AMX_INT8_NATIVE)
+  #define simde_tile_dpbusd(dst, src1, src2) _tile_dpbusd(dst, src1, src2)
+#else
+  #define simde_tile_dpbusd(dst, src1, src2) simde_x_tile_dpb_(dst, src1, src2, 0, 1)
+#endif
+#if defined(SIMDE_X86_AMX_INT8_ENABLE_NATIVE_ALIASES)
+  #undef _tile_dpbusd
+  #define _tile_dpbusd(dst, src1, src2) simde_tile_dpbusd(dst, src1, src2)
+#endif
+
+#if defined(SIMDE_X86_AMX_INT8_NATIVE)
+  #define simde_tile_dpbuud(dst, src1, src2) _tile_dpbuud(dst, src1, src2)
+#else
+  #define simde_tile_dpbuud(dst, src1, src2) simde_x_tile_dpb_(dst, src1, src2, 0, 0)
+#endif
+#if defined(SIMDE_X86_AMX_INT8_ENABLE_NATIVE_ALIASES)
+  #undef _tile_dpbuud
+  #define _tile_dpbuud(dst, src1, src2) simde_tile_dpbuud(dst, src1, src2)
+#endif
+
+#if !defined(SIMDE_X86_AMX_TILE_NATIVE)
+/* Same blocking as simde_x_tile_dpb_rows_, with pairs of bf16 instead
+ * of quads of bytes. */
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_tile_dpbf16ps_rows_ (
+    simde_x_amx_tile_state_* state, int dst, int src1, size_t m, size_t n,
+    const simde__m512bh b[SIMDE_X86_AMX_ROWS_], size_t k_dwords) {
+  const simde__mmask16 lanes = simde_x_amx_lane_mask_(state->colsb[dst]);
+  simde__m512 acc[4];
+
+  for (size_t r = 0 ; r < n ; r++) {
+    acc[r] = simde_mm512_castsi512_ps(simde__m512i_from_private(state->tile[dst][m + r]));
+  }
+
+  for (size_t k = 0 ; k < k_dwords ; k++) {
+    for (size_t r = 0 ; r < n ; r++) {
+      acc[r] = simde_mm512_dpbf16_ps(acc[r], simde_x_mm512_castsi512_pbh(simde_mm512_set1_epi32(state->tile[src1][m + r].i32[k])), b[k]);
+    }
+  }
+
+  for (size_t r = 0 ; r < n ; r++) {
+    state->tile[dst][m + r] = simde__m512i_to_private(simde_mm512_castps_si512(simde_mm512_maskz_mov_ps(lanes, acc[r])));
+  }
+}
+#endif
+
+#if defined(SIMDE_X86_AMX_BF16_NATIVE)
+  #define simde_tile_dpbf16ps(dst, src1, src2) _tile_dpbf16ps(dst, src1, src2)
+#else
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_tile_dpbf16ps (int dst, int src1, int src2)
+    SIMDE_REQUIRE_CONSTANT_RANGE(dst, 0, 7)
+    SIMDE_REQUIRE_CONSTANT_RANGE(src1, 0, 7)
+    SIMDE_REQUIRE_CONSTANT_RANGE(src2, 0, 7) {
+  simde_x_amx_tile_state_* state = simde_x_amx_state_();
+  const size_t m_rows = state->rows[dst];
+  const size_t k_dwords = state->colsb[src1] / 4;
+  simde__m512bh b[SIMDE_X86_AMX_ROWS_];
+  size_t m = 0;
+
+  for (size_t k = 0 ; k < k_dwords ; k++) {
+    b[k] = simde_x_mm512_castsi512_pbh(simde__m512i_from_private(state->tile[src2][k]));
+  }
+
+  for ( ; (m + 4) <= m_rows ; m += 4)
+    simde_x_tile_dpbf16ps_rows_(state, dst, src1, m, 4, b, k_dwords);
+  for ( ; m < m_rows ; m++)
+    simde_x_tile_dpbf16ps_rows_(state, dst, src1, m, 1, b, k_dwords);
+  for ( ; m < SIMDE_X86_AMX_ROWS_ ; m++)
+    state->tile[dst][m] = simde__m512i_to_private(simde_mm512_setzero_si512());
+}
+#endif
+#if defined(SIMDE_X86_AMX_BF16_ENABLE_NATIVE_ALIASES)
+  #undef _tile_dpbf16ps
+  #define _tile_dpbf16ps(dst, src1, src2) simde_tile_dpbf16ps(dst, src1, src2)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AMX_H) */
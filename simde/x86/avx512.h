@@ -65,6 +65,7 @@
 #include "avx512/dpwssds.h"
 #include "avx512/expand.h"
 #include "avx512/extract.h"
+#include "avx512/fcmul.h"
 #include "avx512/fixupimm.h"
 #include "avx512/fixupimm_round.h"
 #include "avx512/flushsubnormal.h"
@@ -74,6 +75,8 @@
 #include "avx512/fnmsub.h"
 #include "avx512/fpclass.h"
 #include "avx512/gather.h"
+#include "avx512/getexp.h"
+#include "avx512/getmant.h"
 #include "avx512/insert.h"
 #include "avx512/kand.h"
 #include "avx512/kshift.h"
@@ -83,6 +86,7 @@
 #include "avx512/loadu.h"
 #include "avx512/lzcnt.h"
 #include "avx512/madd.h"
+#include "avx512/madd52.h"
 #include "avx512/maddubs.h"
 #include "avx512/max.h"
 #include "avx512/min.h"
@@ -115,6 +119,7 @@
 #include "avx512/roundscale_round.h"
 #include "avx512/sad.h"
 #include "avx512/scalef.h"
+#include "avx512/scatter.h"
 #include "avx512/set.h"
 #include "avx512/set1.h"
 #include "avx512/set4.h"
@@ -29,36 +29,127 @@
 #define SIMDE_X86_AVX512_2INTERSECT_H
 
 #include "types.h"
+#include "../avx2.h"
 
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
 SIMDE_BEGIN_DECLS_
 
+/* The fallbacks compare a with every rotation of b.  After comparing
+ * with b rotated by s lanes, lane i of the result is about lane i of a
+ * and lane i + s of b.  The matches for a can simply be ORed together;
+ * the ones for b are accumulated in b's rotated order and rotated along
+ * with it, so after a full turn they are back in place. */
+
 SIMDE_FUNCTION_ATTRIBUTES
 void
-simde_mm_2intersect_epi32(simde__m128i a, simde__m128i b, simde__mmask8 *k1, simde__mmask8 *k2) {
-  simde__m128i_private
-    a_ = simde__m128i_to_private(a),
-    b_ = simde__m128i_to_private(b);
-  simde__mmask8
-    k1_ = 0,
-    k2_ = 0;
-
-  for (size_t i = 0 ; i < sizeof(a_.i32) / sizeof(a_.i32[0]) ; i++) {
-    #if defined(SIMDE_ENABLE_OPENMP)
-      #pragma omp simd reduction(|:k1_) reduction(|:k2_)
-    #else
-      SIMDE_VECTORIZE
-    #endif
-    for (size_t j = 0 ; j < sizeof(b_.i32) / sizeof(b_.i32[0]) ; j++) {
-      const int32_t m = a_.i32[i] == b_.i32[j];
-      k1_ |= m << i;
-      k2_ |= m << j;
-    }
+simde_x_mm_2intersect_epi32_ (simde__m128i a, simde__m128i b, simde__m128i* ka, simde__m128i* kb) {
+  simde__m128i
+    ra = simde_mm_setzero_si128(),
+    rb = simde_mm_setzero_si128();
+
+  for (int s = 0 ; s < 4 ; s++) {
+    const simde__m128i m = simde_mm_cmpeq_epi32(a, b);
+    ra = simde_mm_or_si128(ra, m);
+    rb = simde_mm_shuffle_epi32(simde_mm_or_si128(rb, m), SIMDE_MM_SHUFFLE(0, 3, 2, 1));
+    b = simde_mm_shuffle_epi32(b, SIMDE_MM_SHUFFLE(0, 3, 2, 1));
   }
 
-  *k1 = k1_;
-  *k2 = k2_;
+  *ka = simde_mm_or_si128(*ka, ra);
+  *kb = simde_mm_or_si128(*kb, rb);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_mm_2intersect_epi64_ (simde__m128i a, simde__m128i b, simde__m128i* ka, simde__m128i* kb) {
+  const simde__m128i
+    m0 = simde_mm_cmpeq_epi64(a, b),
+    m1 = simde_mm_cmpeq_epi64(a, simde_mm_shuffle_epi32(b, SIMDE_MM_SHUFFLE(1, 0, 3, 2)));
+
+  *ka = simde_mm_or_si128(*ka, simde_mm_or_si128(m0, m1));
+  *kb = simde_mm_or_si128(*kb, simde_mm_or_si128(m0, simde_mm_shuffle_epi32(m1, SIMDE_MM_SHUFFLE(1, 0, 3, 2))));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_mm256_2intersect_epi32_ (simde__m256i a, simde__m256i b, simde__m256i* ka, simde__m256i* kb) {
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    const simde__m256i rot = simde_mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 0);
+    simde__m256i
+      ra = simde_mm256_setzero_si256(),
+      rb = simde_mm256_setzero_si256();
+
+    for (int s = 0 ; s < 8 ; s++) {
+      const simde__m256i m = simde_mm256_cmpeq_epi32(a, b);
+      ra = simde_mm256_or_si256(ra, m);
+      rb = simde_mm256_permutevar8x32_epi32(simde_mm256_or_si256(rb, m), rot);
+      b = simde_mm256_permutevar8x32_epi32(b, rot);
+    }
+
+    *ka = simde_mm256_or_si256(*ka, ra);
+    *kb = simde_mm256_or_si256(*kb, rb);
+  #else
+    simde__m256i_private
+      a_ = simde__m256i_to_private(a),
+      b_ = simde__m256i_to_private(b),
+      ka_ = simde__m256i_to_private(*ka),
+      kb_ = simde__m256i_to_private(*kb);
+
+    simde_x_mm_2intersect_epi32_(a_.m128i[0], b_.m128i[0], &(ka_.m128i[0]), &(kb_.m128i[0]));
+    simde_x_mm_2intersect_epi32_(a_.m128i[0], b_.m128i[1], &(ka_.m128i[0]), &(kb_.m128i[1]));
+    simde_x_mm_2intersect_epi32_(a_.m128i[1], b_.m128i[0], &(ka_.m128i[1]), &(kb_.m128i[0]));
+    simde_x_mm_2intersect_epi32_(a_.m128i[1], b_.m128i[1], &(ka_.m128i[1]), &(kb_.m128i[1]));
+
+    *ka = simde__m256i_from_private(ka_);
+    *kb = simde__m256i_from_private(kb_);
+  #endif
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_mm256_2intersect_epi64_ (simde__m256i a, simde__m256i b, simde__m256i* ka, simde__m256i* kb) {
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    simde__m256i
+      ra = simde_mm256_setzero_si256(),
+      rb = simde_mm256_setzero_si256();
+
+    for (int s = 0 ; s < 4 ; s++) {
+      const simde__m256i m = simde_mm256_cmpeq_epi64(a, b);
+      ra = simde_mm256_or_si256(ra, m);
+      rb = simde_mm256_permute4x64_epi64(simde_mm256_or_si256(rb, m), SIMDE_MM_SHUFFLE(0, 3, 2, 1));
+      b = simde_mm256_permute4x64_epi64(b, SIMDE_MM_SHUFFLE(0, 3, 2, 1));
+    }
+
+    *ka = simde_mm256_or_si256(*ka, ra);
+    *kb = simde_mm256_or_si256(*kb, rb);
+  #else
+    simde__m256i_private
+      a_ = simde__m256i_to_private(a),
+      b_ = simde__m256i_to_private(b),
+      ka_ = simde__m256i_to_private(*ka),
+      kb_ = simde__m256i_to_private(*kb);
+
+    simde_x_mm_2intersect_epi64_(a_.m128i[0], b_.m128i[0], &(ka_.m128i[0]), &(kb_.m128i[0]));
+    simde_x_mm_2intersect_epi64_(a_.m128i[0], b_.m128i[1], &(ka_.m128i[0]), &(kb_.m128i[1]));
+    simde_x_mm_2intersect_epi64_(a_.m128i[1], b_.m128i[0], &(ka_.m128i[1]), &(kb_.m128i[0]));
+    simde_x_mm_2intersect_epi64_(a_.m128i[1], b_.m128i[1], &(ka_.m128i[1]), &(kb_.m128i[1]));
+
+    *ka = simde__m256i_from_private(ka_);
+    *kb = simde__m256i_from_private(kb_);
+  #endif
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_2intersect_epi32(simde__m128i a, simde__m128i b, simde__mmask8 *k1, simde__mmask8 *k2) {
+  simde__m128i
+    ka = simde_mm_setzero_si128(),
+    kb = simde_mm_setzero_si128();
+
+  simde_x_mm_2intersect_epi32_(a, b, &ka, &kb);
+
+  *k1 = HEDLEY_STATIC_CAST(simde__mmask8, simde_mm_movemask_ps(simde_mm_castsi128_ps(ka)));
+  *k2 = HEDLEY_STATIC_CAST(simde__mmask8, simde_mm_movemask_ps(simde_mm_castsi128_ps(kb)));
 }
 #if defined(SIMDE_X86_AVX512VP2INTERSECT_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
   #define simde_mm_2intersect_epi32(a, b, k1, k2) _mm_2intersect_epi32(a, b, k1, k2)
@@ -74,28 +165,14 @@ simde_mm_2intersect_epi64(simde__m128i a, simde__m128i b, simde__mmask8 *k1, sim
   #if defined(SIMDE_X86_AVX512VP2INTERSECT_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
     _mm_2intersect_epi64(a, b, k1, k2);
   #else
-    simde__m128i_private
-      a_ = simde__m128i_to_private(a),
-      b_ = simde__m128i_to_private(b);
-    simde__mmask8
-      k1_ = 0,
-      k2_ = 0;
+    simde__m128i
+      ka = simde_mm_setzero_si128(),
+      kb = simde_mm_setzero_si128();
 
-    for (size_t i = 0 ; i < sizeof(a_.i64) / sizeof(a_.i64[0]) ; i++) {
-      #if defined(SIMDE_ENABLE_OPENMP)
-        #pragma omp simd reduction(|:k1_) reduction(|:k2_)
-      #else
-        SIMDE_VECTORIZE
-      #endif
-      for (size_t j = 0 ; j < sizeof(b_.i64) / sizeof(b_.i64[0]) ; j++) {
-        const int32_t m = a_.i64[i] == b_.i64[j];
-        k1_ |= m << i;
-        k2_ |= m << j;
-      }
-    }
+    simde_x_mm_2intersect_epi64_(a, b, &ka, &kb);
 
-    *k1 = k1_;
-    *k2 = k2_;
+    *k1 = HEDLEY_STATIC_CAST(simde__mmask8, simde_mm_movemask_pd(simde_mm_castsi128_pd(ka)));
+    *k2 = HEDLEY_STATIC_CAST(simde__mmask8, simde_mm_movemask_pd(simde_mm_castsi128_pd(kb)));
   #endif
 }
 #if defined(SIMDE_X86_AVX512VP2INTERSECT_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
@@ -109,28 +186,14 @@ simde_mm256_2intersect_epi32(simde__m256i a, simde__m256i b, simde__mmask8 *k1,
   #if defined(SIMDE_X86_AVX512VP2INTERSECT_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
     _mm256_2intersect_epi32(a, b, k1, k2);
   #else
-    simde__m256i_private
-      a_ = simde__m256i_to_private(a),
-      b_ = simde__m256i_to_private(b);
-    simde__mmask8
-      k1_ = 0,
-      k2_ = 0;
+    simde__m256i
+      ka = simde_mm256_setzero_si256(),
+      kb = simde_mm256_setzero_si256();
 
-    for (size_t i = 0 ; i < sizeof(a_.i32) / sizeof(a_.i32[0]) ; i++) {
-      #if defined(SIMDE_ENABLE_OPENMP)
-        #pragma omp simd reduction(|:k1_) reduction(|:k2_)
-      #else
-        SIMDE_VECTORIZE
-      #endif
-      for (size_t j = 0 ; j < sizeof(b_.i32) / sizeof(b_.i32[0]) ; j++) {
-        const int32_t m = a_.i32[i] == b_.i32[j];
-        k1_ |= m << i;
-        k2_ |= m << j;
-      }
-    }
+    simde_x_mm256_2intersect_epi32_(a, b, &ka, &kb);
 
-    *k1 = k1_;
-    *k2 = k2_;
+    *k1 = HEDLEY_STATIC_CAST(simde__mmask8, simde_mm256_movemask_ps(simde_mm256_castsi256_ps(ka)));
+    *k2 = HEDLEY_STATIC_CAST(simde__mmask8, simde_mm256_movemask_ps(simde_mm256_castsi256_ps(kb)));
   #endif
 }
 #if defined(SIMDE_X86_AVX512VP2INTERSECT_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
@@ -144,28 +207,14 @@ simde_mm256_2intersect_epi64(simde__m256i a, simde__m256i b, simde__mmask8 *k1,
   #if defined(SIMDE_X86_AVX512VP2INTERSECT_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
     _mm256_2intersect_epi64(a, b, k1, k2);
   #else
-    simde__m256i_private
-      a_ = simde__m256i_to_private(a),
-      b_ = simde__m256i_to_private(b);
-    simde__mmask8
-      k1_ = 0,
-      k2_ = 0;
+    simde__m256i
+      ka = simde_mm256_setzero_si256(),
+      kb = simde_mm256_setzero_si256();
 
-    for (size_t i = 0 ; i < sizeof(a_.i64) / sizeof(a_.i64[0]) ; i++) {
-      #if defined(SIMDE_ENABLE_OPENMP)
-        #pragma omp simd reduction(|:k1_) reduction(|:k2_)
-      #else
-        SIMDE_VECTORIZE
-      #endif
-      for (size_t j = 0 ; j < sizeof(b_.i64) / sizeof(b_.i64[0]) ; j++) {
-        const int32_t m = a_.i64[i] == b_.i64[j];
-        k1_ |= m << i;
-        k2_ |= m << j;
-      }
-    }
+    simde_x_mm256_2intersect_epi64_(a, b, &ka, &kb);
 
-    *k1 = k1_;
-    *k2 = k2_;
+    *k1 = HEDLEY_STATIC_CAST(simde__mmask8, simde_mm256_movemask_pd(simde_mm256_castsi256_pd(ka)));
+    *k2 = HEDLEY_STATIC_CAST(simde__mmask8, simde_mm256_movemask_pd(simde_mm256_castsi256_pd(kb)));
   #endif
 }
 #if defined(SIMDE_X86_AVX512VP2INTERSECT_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
@@ -178,29 +227,38 @@ void
 simde_mm512_2intersect_epi32(simde__m512i a, simde__m512i b, simde__mmask16 *k1, simde__mmask16 *k2) {
   #if defined(SIMDE_X86_AVX512VP2INTERSECT_NATIVE)
     _mm512_2intersect_epi32(a, b, k1, k2);
+  #elif defined(SIMDE_X86_AVX512F_NATIVE)
+    uint32_t
+      k1_ = 0,
+      k2_ = 0;
+
+    for (int s = 0 ; s < 16 ; s++) {
+      const uint32_t m = _mm512_cmpeq_epi32_mask(a, b);
+      k1_ |= m;
+      k2_ |= (m << s) | (m >> (16 - s));
+      b = _mm512_alignr_epi32(b, b, 1);
+    }
+
+    *k1 = HEDLEY_STATIC_CAST(simde__mmask16, k1_);
+    *k2 = HEDLEY_STATIC_CAST(simde__mmask16, k2_);
   #else
     simde__m512i_private
       a_ = simde__m512i_to_private(a),
       b_ = simde__m512i_to_private(b);
-    simde__mmask16
-      k1_ = 0,
-      k2_ = 0;
+    simde__m256i ka[2], kb[2];
 
-    for (size_t i = 0 ; i < sizeof(a_.i32) / sizeof(a_.i32[0]) ; i++) {
-      #if defined(SIMDE_ENABLE_OPENMP)
-        #pragma omp simd reduction(|:k1_) reduction(|:k2_)
-      #else
-        SIMDE_VECTORIZE
-      #endif
-      for (size_t j = 0 ; j < sizeof(b_.i32) / sizeof(b_.i32[0]) ; j++) {
-        const int32_t m = a_.i32[i] == b_.i32[j];
-        k1_ |= m << i;
-        k2_ |= m << j;
-      }
-    }
+    ka[0] = ka[1] = kb[0] = kb[1] = simde_mm256_setzero_si256();
+    simde_x_mm256_2intersect_epi32_(a_.m256i[0], b_.m256i[0], &(ka[0]), &(kb[0]));
+    simde_x_mm256_2intersect_epi32_(a_.m256i[0], b_.m256i[1], &(ka[0]), &(kb[1]));
+    simde_x_mm256_2intersect_epi32_(a_.m256i[1], b_.m256i[0], &(ka[1]), &(kb[0]));
+    simde_x_mm256_2intersect_epi32_(a_.m256i[1], b_.m256i[1], &(ka[1]), &(kb[1]));
 
-    *k1 = k1_;
-    *k2 = k2_;
+    *k1 = HEDLEY_STATIC_CAST(simde__mmask16,
+      simde_mm256_movemask_ps(simde_mm256_castsi256_ps(ka[0])) |
+      (simde_mm256_movemask_ps(simde_mm256_castsi256_ps(ka[1])) << 8));
+    *k2 = HEDLEY_STATIC_CAST(simde__mmask16,
+      simde_mm256_movemask_ps(simde_mm256_castsi256_ps(kb[0])) |
+      (simde_mm256_movemask_ps(simde_mm256_castsi256_ps(kb[1])) << 8));
   #endif
 }
 #if defined(SIMDE_X86_AVX512VP2INTERSECT_ENABLE_NATIVE_ALIASES)
@@ -213,29 +271,38 @@ void
 simde_mm512_2intersect_epi64(simde__m512i a, simde__m512i b, simde__mmask8 *k1, simde__mmask8 *k2) {
   #if defined(SIMDE_X86_AVX512VP2INTERSECT_NATIVE)
     _mm512_2intersect_epi64(a, b, k1, k2);
+  #elif defined(SIMDE_X86_AVX512F_NATIVE)
+    uint32_t
+      k1_ = 0,
+      k2_ = 0;
+
+    for (int s = 0 ; s < 8 ; s++) {
+      const uint32_t m = _mm512_cmpeq_epi64_mask(a, b);
+      k1_ |= m;
+      k2_ |= (m << s) | (m >> (8 - s));
+      b = _mm512_alignr_epi64(b, b, 1);
+    }
+
+    *k1 = HEDLEY_STATIC_CAST(simde__mmask8, k1_);
+    *k2 = HEDLEY_STATIC_CAST(simde__mmask8, k2_);
   #else
     simde__m512i_private
       a_ = simde__m512i_to_private(a),
       b_ = simde__m512i_to_private(b);
-    simde__mmask8
-      k1_ = 0,
-      k2_ = 0;
+    simde__m256i ka[2], kb[2];
 
-    for (size_t i = 0 ; i < sizeof(a_.i64) / sizeof(a_.i64[0]) ; i++) {
-      #if defined(SIMDE_ENABLE_OPENMP)
-        #pragma omp simd reduction(|:k1_) reduction(|:k2_)
-      #else
-        SIMDE_VECTORIZE
-      #endif
-      for (size_t j = 0 ; j < sizeof(b_.i64) / sizeof(b_.i64[0]) ; j++) {
-        const int32_t m = a_.i64[i] == b_.i64[j];
-        k1_ |= m << i;
-        k2_ |= m << j;
-      }
-    }
+    ka[0] = ka[1] = kb[0] = kb[1] = simde_mm256_setzero_si256();
+    simde_x_mm256_2intersect_epi64_(a_.m256i[0], b_.m256i[0], &(ka[0]), &(kb[0]));
+    simde_x_mm256_2intersect_epi64_(a_.m256i[0], b_.m256i[1], &(ka[0]), &(kb[1]));
+    simde_x_mm256_2intersect_epi64_(a_.m256i[1], b_.m256i[0], &(ka[1]), &(kb[0]));
+    simde_x_mm256_2intersect_epi64_(a_.m256i[1], b_.m256i[1], &(ka[1]), &(kb[1]));
 
-    *k1 = k1_;
-    *k2 = k2_;
+    *k1 = HEDLEY_STATIC_CAST(simde__mmask8,
+      simde_mm256_movemask_pd(simde_mm256_castsi256_pd(ka[0])) |
+      (simde_mm256_movemask_pd(simde_mm256_castsi256_pd(ka[1])) << 4));
+    *k2 = HEDLEY_STATIC_CAST(simde__mmask8,
+      simde_mm256_movemask_pd(simde_mm256_castsi256_pd(kb[0])) |
+      (simde_mm256_movemask_pd(simde_mm256_castsi256_pd(kb[1])) << 4));
   #endif
 }
 #if defined(SIMDE_X86_AVX512VP2INTERSECT_ENABLE_NATIVE_ALIASES)
@@ -100,6 +100,70 @@ simde_mm512_castps_si512 (simde__m512 a) {
   #define _mm512_castps_si512(a) simde_mm512_castps_si512(a)
 #endif
 
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_castph_si128 (simde__m128h a) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE)
+    return _mm_castph_si128(a);
+  #else
+    simde__m128i r;
+    simde_memcpy(&r, &a, sizeof(r));
+    return r;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES)
+  #undef _mm_castph_si128
+  #define _mm_castph_si128(a) simde_mm_castph_si128(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128h
+simde_mm_castsi128_ph (simde__m128i a) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE)
+    return _mm_castsi128_ph(a);
+  #else
+    simde__m128h r;
+    simde_memcpy(&r, &a, sizeof(r));
+    return r;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES)
+  #undef _mm_castsi128_ph
+  #define _mm_castsi128_ph(a) simde_mm_castsi128_ph(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_castph_si256 (simde__m256h a) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE)
+    return _mm256_castph_si256(a);
+  #else
+    simde__m256i r;
+    simde_memcpy(&r, &a, sizeof(r));
+    return r;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_castph_si256
+  #define _mm256_castph_si256(a) simde_mm256_castph_si256(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256h
+simde_mm256_castsi256_ph (simde__m256i a) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE)
+    return _mm256_castsi256_ph(a);
+  #else
+    simde__m256h r;
+    simde_memcpy(&r, &a, sizeof(r));
+    return r;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_castsi256_ph
+  #define _mm256_castsi256_ph(a) simde_mm256_castsi256_ph(a)
+#endif
+
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m512i
 simde_mm512_castph_si512 (simde__m512h a) {
@@ -133,6 +197,54 @@ simde_mm512_castsi512_ph (simde__m512i a) {
   #define _mm512_castsi512_ph(a) simde_mm512_castsi512_ph(a)
 #endif
 
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128bh
+simde_x_mm_castsi128_pbh (simde__m128i a) {
+  simde__m128bh r;
+  simde_memcpy(&r, &a, sizeof(r));
+  return r;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_mm_castpbh_si128 (simde__m128bh a) {
+  simde__m128i r;
+  simde_memcpy(&r, &a, sizeof(r));
+  return r;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256bh
+simde_x_mm256_castsi256_pbh (simde__m256i a) {
+  simde__m256bh r;
+  simde_memcpy(&r, &a, sizeof(r));
+  return r;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_x_mm256_castpbh_si256 (simde__m256bh a) {
+  simde__m256i r;
+  simde_memcpy(&r, &a, sizeof(r));
+  return r;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512bh
+simde_x_mm512_castsi512_pbh (simde__m512i a) {
+  simde__m512bh r;
+  simde_memcpy(&r, &a, sizeof(r));
+  return r;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_x_mm512_castpbh_si512 (simde__m512bh a) {
+  simde__m512i r;
+  simde_memcpy(&r, &a, sizeof(r));
+  return r;
+}
+
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m512
 simde_mm512_castsi512_ps (simde__m512i a) {
@@ -33,6 +33,7 @@
 #include "mov_mask.h"
 #include "setzero.h"
 #include "setone.h"
+#include "cvt.h"
 
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
@@ -965,6 +966,20 @@ simde_mm512_cmp_ph_mask (simde__m512h a, simde__m512h b, const int imm8)
   #define _mm512_cmp_ph_mask(a, b, imm8) simde_mm512_cmp_ph_mask((a), (b), (imm8))
 #endif
 
+#if defined(SIMDE_X86_AVX512FP16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_cmp_ph_mask(a, b, imm8) _mm_cmp_ph_mask((a), (b), (imm8))
+  #define simde_mm256_cmp_ph_mask(a, b, imm8) _mm256_cmp_ph_mask((a), (b), (imm8))
+#else
+  #define simde_mm_cmp_ph_mask(a, b, imm8) simde_mm256_cmp_ps_mask(simde_mm256_cvtxph_ps(a), simde_mm256_cvtxph_ps(b), (imm8))
+  #define simde_mm256_cmp_ph_mask(a, b, imm8) simde_mm512_cmp_ps_mask(simde_mm512_cvtxph_ps(a), simde_mm512_cvtxph_ps(b), (imm8))
+#endif
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cmp_ph_mask
+  #define _mm_cmp_ph_mask(a, b, imm8) simde_mm_cmp_ph_mask((a), (b), (imm8))
+  #undef _mm256_cmp_ph_mask
+  #define _mm256_cmp_ph_mask(a, b, imm8) simde_mm256_cmp_ph_mask((a), (b), (imm8))
+#endif
+
 SIMDE_HUGE_FUNCTION_ATTRIBUTES
 simde__mmask32
 simde_mm512_cmp_epi16_mask (simde__m512i a, simde__m512i b, const int imm8)
@@ -2,187 +2,488 @@
 #define SIMDE_X86_AVX512_COMPRESS_H
 
 #include "types.h"
+#include "mov.h"
+#include "load.h"
+#include "cast.h"
+#include "../avx2.h"
 
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
 SIMDE_BEGIN_DECLS_
 
-SIMDE_FUNCTION_ATTRIBUTES
-simde__m256d
-simde_mm256_mask_compress_pd (simde__m256d src, simde__mmask8 k, simde__m256d a) {
-  #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
-    return _mm256_mask_compress_pd(src, k, a);
-  #else
-    simde__m256d_private
-      a_ = simde__m256d_to_private(a),
-      src_ = simde__m256d_to_private(src);
-    size_t ri = 0;
+/* The fallbacks work on groups of eight elements (or fewer):
+ * simde_x_compress_idx8 maps the mask for a group to the indices of
+ * the selected elements packed at the bottom, with 0xff in the
+ * remaining slots.  Widened to pshufb indices, 0xff zeroes the lane;
+ * sign-extended to permutevar8x32 indices it becomes -1, which we use
+ * as a blendv selector.  Groups are then concatenated at offsets given
+ * by the popcount of the mask of the preceding groups; within 256 bits
+ * that is done with two more shuffles, across 256-bit halves through
+ * memory. */
+
+static const union {
+  uint8_t  u8[256][8];
+  uint64_t u64[256];
+} simde_x_compress_idx8 = {
+  {
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x02, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x02, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x02, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0x03, 0xff, 0xff, 0xff, 0xff },
+    { 0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x02, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x02, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x02, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0x04, 0xff, 0xff, 0xff, 0xff },
+    { 0x03, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x03, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x03, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x03, 0x04, 0xff, 0xff, 0xff, 0xff },
+    { 0x02, 0x03, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x02, 0x03, 0x04, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x02, 0x03, 0x04, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0xff, 0xff, 0xff },
+    { 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x02, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x02, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x02, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0x05, 0xff, 0xff, 0xff, 0xff },
+    { 0x03, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x03, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x03, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x03, 0x05, 0xff, 0xff, 0xff, 0xff },
+    { 0x02, 0x03, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x02, 0x03, 0x05, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x02, 0x03, 0x05, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0x03, 0x05, 0xff, 0xff, 0xff },
+    { 0x04, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x04, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x04, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x04, 0x05, 0xff, 0xff, 0xff, 0xff },
+    { 0x02, 0x04, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x02, 0x04, 0x05, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x02, 0x04, 0x05, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0x04, 0x05, 0xff, 0xff, 0xff },
+    { 0x03, 0x04, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x03, 0x04, 0x05, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x03, 0x04, 0x05, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x03, 0x04, 0x05, 0xff, 0xff, 0xff },
+    { 0x02, 0x03, 0x04, 0x05, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x02, 0x03, 0x04, 0x05, 0xff, 0xff, 0xff },
+    { 0x01, 0x02, 0x03, 0x04, 0x05, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0xff, 0xff },
+    { 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x02, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x02, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x02, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0x06, 0xff, 0xff, 0xff, 0xff },
+    { 0x03, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x03, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x03, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x03, 0x06, 0xff, 0xff, 0xff, 0xff },
+    { 0x02, 0x03, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x02, 0x03, 0x06, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x02, 0x03, 0x06, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0x03, 0x06, 0xff, 0xff, 0xff },
+    { 0x04, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x04, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x04, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x04, 0x06, 0xff, 0xff, 0xff, 0xff },
+    { 0x02, 0x04, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x02, 0x04, 0x06, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x02, 0x04, 0x06, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0x04, 0x06, 0xff, 0xff, 0xff },
+    { 0x03, 0x04, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x03, 0x04, 0x06, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x03, 0x04, 0x06, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x03, 0x04, 0x06, 0xff, 0xff, 0xff },
+    { 0x02, 0x03, 0x04, 0x06, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x02, 0x03, 0x04, 0x06, 0xff, 0xff, 0xff },
+    { 0x01, 0x02, 0x03, 0x04, 0x06, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0xff, 0xff },
+    { 0x05, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x05, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x05, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x05, 0x06, 0xff, 0xff, 0xff, 0xff },
+    { 0x02, 0x05, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x02, 0x05, 0x06, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x02, 0x05, 0x06, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0x05, 0x06, 0xff, 0xff, 0xff },
+    { 0x03, 0x05, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x03, 0x05, 0x06, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x03, 0x05, 0x06, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x03, 0x05, 0x06, 0xff, 0xff, 0xff },
+    { 0x02, 0x03, 0x05, 0x06, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x02, 0x03, 0x05, 0x06, 0xff, 0xff, 0xff },
+    { 0x01, 0x02, 0x03, 0x05, 0x06, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0x03, 0x05, 0x06, 0xff, 0xff },
+    { 0x04, 0x05, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x04, 0x05, 0x06, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x04, 0x05, 0x06, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x04, 0x05, 0x06, 0xff, 0xff, 0xff },
+    { 0x02, 0x04, 0x05, 0x06, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x02, 0x04, 0x05, 0x06, 0xff, 0xff, 0xff },
+    { 0x01, 0x02, 0x04, 0x05, 0x06, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0xff, 0xff },
+    { 0x03, 0x04, 0x05, 0x06, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x03, 0x04, 0x05, 0x06, 0xff, 0xff, 0xff },
+    { 0x01, 0x03, 0x04, 0x05, 0x06, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x03, 0x04, 0x05, 0x06, 0xff, 0xff },
+    { 0x02, 0x03, 0x04, 0x05, 0x06, 0xff, 0xff, 0xff },
+    { 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0xff, 0xff },
+    { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0xff },
+    { 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x02, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x02, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x02, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0x07, 0xff, 0xff, 0xff, 0xff },
+    { 0x03, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x03, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x03, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x03, 0x07, 0xff, 0xff, 0xff, 0xff },
+    { 0x02, 0x03, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x02, 0x03, 0x07, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x02, 0x03, 0x07, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0x03, 0x07, 0xff, 0xff, 0xff },
+    { 0x04, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x04, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x04, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x04, 0x07, 0xff, 0xff, 0xff, 0xff },
+    { 0x02, 0x04, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x02, 0x04, 0x07, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x02, 0x04, 0x07, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0x04, 0x07, 0xff, 0xff, 0xff },
+    { 0x03, 0x04, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x03, 0x04, 0x07, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x03, 0x04, 0x07, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x03, 0x04, 0x07, 0xff, 0xff, 0xff },
+    { 0x02, 0x03, 0x04, 0x07, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x02, 0x03, 0x04, 0x07, 0xff, 0xff, 0xff },
+    { 0x01, 0x02, 0x03, 0x04, 0x07, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x07, 0xff, 0xff },
+    { 0x05, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x05, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x05, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x05, 0x07, 0xff, 0xff, 0xff, 0xff },
+    { 0x02, 0x05, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x02, 0x05, 0x07, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x02, 0x05, 0x07, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0x05, 0x07, 0xff, 0xff, 0xff },
+    { 0x03, 0x05, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x03, 0x05, 0x07, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x03, 0x05, 0x07, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x03, 0x05, 0x07, 0xff, 0xff, 0xff },
+    { 0x02, 0x03, 0x05, 0x07, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x02, 0x03, 0x05, 0x07, 0xff, 0xff, 0xff },
+    { 0x01, 0x02, 0x03, 0x05, 0x07, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0x03, 0x05, 0x07, 0xff, 0xff },
+    { 0x04, 0x05, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x04, 0x05, 0x07, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x04, 0x05, 0x07, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x04, 0x05, 0x07, 0xff, 0xff, 0xff },
+    { 0x02, 0x04, 0x05, 0x07, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x02, 0x04, 0x05, 0x07, 0xff, 0xff, 0xff },
+    { 0x01, 0x02, 0x04, 0x05, 0x07, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0x04, 0x05, 0x07, 0xff, 0xff },
+    { 0x03, 0x04, 0x05, 0x07, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x03, 0x04, 0x05, 0x07, 0xff, 0xff, 0xff },
+    { 0x01, 0x03, 0x04, 0x05, 0x07, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x03, 0x04, 0x05, 0x07, 0xff, 0xff },
+    { 0x02, 0x03, 0x04, 0x05, 0x07, 0xff, 0xff, 0xff },
+    { 0x00, 0x02, 0x03, 0x04, 0x05, 0x07, 0xff, 0xff },
+    { 0x01, 0x02, 0x03, 0x04, 0x05, 0x07, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x07, 0xff },
+    { 0x06, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff },
+    { 0x02, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x02, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x02, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0x06, 0x07, 0xff, 0xff, 0xff },
+    { 0x03, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x03, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x03, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x03, 0x06, 0x07, 0xff, 0xff, 0xff },
+    { 0x02, 0x03, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x02, 0x03, 0x06, 0x07, 0xff, 0xff, 0xff },
+    { 0x01, 0x02, 0x03, 0x06, 0x07, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0x03, 0x06, 0x07, 0xff, 0xff },
+    { 0x04, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x04, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x04, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x04, 0x06, 0x07, 0xff, 0xff, 0xff },
+    { 0x02, 0x04, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x02, 0x04, 0x06, 0x07, 0xff, 0xff, 0xff },
+    { 0x01, 0x02, 0x04, 0x06, 0x07, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0x04, 0x06, 0x07, 0xff, 0xff },
+    { 0x03, 0x04, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x03, 0x04, 0x06, 0x07, 0xff, 0xff, 0xff },
+    { 0x01, 0x03, 0x04, 0x06, 0x07, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x03, 0x04, 0x06, 0x07, 0xff, 0xff },
+    { 0x02, 0x03, 0x04, 0x06, 0x07, 0xff, 0xff, 0xff },
+    { 0x00, 0x02, 0x03, 0x04, 0x06, 0x07, 0xff, 0xff },
+    { 0x01, 0x02, 0x03, 0x04, 0x06, 0x07, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x07, 0xff },
+    { 0x05, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff },
+    { 0x01, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff },
+    { 0x02, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x02, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff },
+    { 0x01, 0x02, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0x05, 0x06, 0x07, 0xff, 0xff },
+    { 0x03, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x03, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff },
+    { 0x01, 0x03, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x03, 0x05, 0x06, 0x07, 0xff, 0xff },
+    { 0x02, 0x03, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff },
+    { 0x00, 0x02, 0x03, 0x05, 0x06, 0x07, 0xff, 0xff },
+    { 0x01, 0x02, 0x03, 0x05, 0x06, 0x07, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0x03, 0x05, 0x06, 0x07, 0xff },
+    { 0x04, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x04, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff },
+    { 0x01, 0x04, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x04, 0x05, 0x06, 0x07, 0xff, 0xff },
+    { 0x02, 0x04, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff },
+    { 0x00, 0x02, 0x04, 0x05, 0x06, 0x07, 0xff, 0xff },
+    { 0x01, 0x02, 0x04, 0x05, 0x06, 0x07, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x07, 0xff },
+    { 0x03, 0x04, 0x05, 0x06, 0x07, 0xff, 0xff, 0xff },
+    { 0x00, 0x03, 0x04, 0x05, 0x06, 0x07, 0xff, 0xff },
+    { 0x01, 0x03, 0x04, 0x05, 0x06, 0x07, 0xff, 0xff },
+    { 0x00, 0x01, 0x03, 0x04, 0x05, 0x06, 0x07, 0xff },
+    { 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0xff, 0xff },
+    { 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0xff },
+    { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0xff },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07 }
+  }
+};
 
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
-      if ((k >> i) & 1) {
-        a_.f64[ri++] = a_.f64[i];
-      }
-    }
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_mm_compress_epi8_idx (uint16_t k) {
+  /* Shift the indices for the upper group up past the elements selected
+   * from the lower one; the numeric values are little-endian. */
+  const uint64_t
+    lo = simde_endian_bswap64_le(simde_x_compress_idx8.u64[k & 0xff]),
+    hi = simde_endian_bswap64_le(simde_x_compress_idx8.u64[k >> 8]) | UINT64_C(0x0808080808080808);
+  const unsigned int s = simde_popcount64(k & 0xff) * 8;
+  simde__m128i_private r_;
+
+  if (s == 0) {
+    r_.u64[0] = hi;
+    r_.u64[1] = ~UINT64_C(0);
+  } else if (s == 64) {
+    r_.u64[0] = lo;
+    r_.u64[1] = hi;
+  } else {
+    r_.u64[0] = (lo & ((UINT64_C(1) << s) - 1)) | (hi << s);
+    r_.u64[1] = (hi >> (64 - s)) | (~UINT64_C(0) << s);
+  }
+
+  r_.u64[0] = simde_endian_bswap64_le(r_.u64[0]);
+  r_.u64[1] = simde_endian_bswap64_le(r_.u64[1]);
+
+  return simde__m128i_from_private(r_);
+}
 
-    for ( ; ri < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; ri++) {
-      a_.f64[ri] = src_.f64[ri];
-    }
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_mm_compress_epi16_idx (uint8_t k) {
+  /* Element index i becomes byte indices 2i and 2i + 1; 0xff stays
+   * negative. */
+  simde__m128i r = simde_mm_loadl_epi64(HEDLEY_REINTERPRET_CAST(const simde__m128i*, simde_x_compress_idx8.u8[k]));
+  r = simde_mm_unpacklo_epi8(r, r);
+  r = simde_mm_add_epi8(r, r);
+  return simde_mm_add_epi8(r, simde_mm_setr_epi8(0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1));
+}
 
-    return simde__m256d_from_private(a_);
-  #endif
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_mm_compress_epi32_idx (uint8_t k) {
+  /* k < 16; element index i becomes byte indices 4i to 4i + 3. */
+  simde__m128i r = simde_mm_loadl_epi64(HEDLEY_REINTERPRET_CAST(const simde__m128i*, simde_x_compress_idx8.u8[k]));
+  r = simde_mm_unpacklo_epi8(r, r);
+  r = simde_mm_unpacklo_epi16(r, r);
+  r = simde_mm_add_epi8(r, r);
+  r = simde_mm_add_epi8(r, r);
+  return simde_mm_add_epi8(r, simde_mm_setr_epi8(0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3));
 }
-#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
-  #undef _mm256_mask_compress_pd
-  #define _mm256_mask_compress_pd(src, k, a) simde_mm256_mask_compress_pd(src, k, a)
-#endif
 
 SIMDE_FUNCTION_ATTRIBUTES
-void
-simde_mm256_mask_compressstoreu_pd (void* base_addr, simde__mmask8 k, simde__m256d a) {
-  #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE) && !defined(__znver4__)
-    _mm256_mask_compressstoreu_pd(base_addr, k, a);
-  #elif defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE) && defined(__znver4__)
-    simde__mmask8 store_mask = _pext_u32(-1, k);
-    _mm256_mask_storeu_pd(base_addr, store_mask, _mm256_maskz_compress_pd(k, a));
-  #else
-    simde__m256d_private
-      a_ = simde__m256d_to_private(a);
-    size_t ri = 0;
+simde__m128i
+simde_x_mm_compress_epi64_idx (uint8_t k) {
+  /* k < 4; element index i becomes byte indices 8i to 8i + 7. */
+  simde__m128i r = simde_mm_loadl_epi64(HEDLEY_REINTERPRET_CAST(const simde__m128i*, simde_x_compress_idx8.u8[k]));
+  r = simde_mm_unpacklo_epi8(r, r);
+  r = simde_mm_unpacklo_epi16(r, r);
+  r = simde_mm_unpacklo_epi32(r, r);
+  r = simde_mm_add_epi8(r, r);
+  r = simde_mm_add_epi8(r, r);
+  r = simde_mm_add_epi8(r, r);
+  return simde_mm_add_epi8(r, simde_mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7));
+}
 
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
-      if ((k >> i) & 1) {
-        a_.f64[ri++] = a_.f64[i];
-      }
-    }
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_x_mm256_compress_epi32_perm (simde__mmask8 k) {
+  return simde_mm256_cvtepi8_epi32(simde_mm_loadl_epi64(HEDLEY_REINTERPRET_CAST(const simde__m128i*, simde_x_compress_idx8.u8[k])));
+}
 
-    simde_memcpy(base_addr, &a_, ri * sizeof(a_.f64[0]));
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_x_mm256_compress_epi64_perm (simde__mmask8 k) {
+  /* Element index i becomes 32-bit indices 2i and 2i + 1, and -1
+   * becomes -2 and -1. */
+  simde__m128i t = simde_mm_loadl_epi64(HEDLEY_REINTERPRET_CAST(const simde__m128i*, simde_x_compress_idx8.u8[k & 15]));
+  simde__m256i r = simde_mm256_cvtepi8_epi32(simde_mm_unpacklo_epi8(t, t));
+  r = simde_mm256_add_epi32(r, r);
+  return simde_mm256_add_epi32(r, simde_mm256_setr_epi32(0, 1, 0, 1, 0, 1, 0, 1));
+}
 
-    return;
-  #endif
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_x_mm256_compress_join (simde__m128i a, simde__m128i b, unsigned int n) {
+  /* The first n bytes of a followed by b; both are zero past the
+   * compressed elements.  Out-of-range indices end up with the high bit
+   * set so the shuffles zero them. */
+  const simde__m128i
+    iota = simde_mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+    shift = simde_mm_set1_epi8(HEDLEY_STATIC_CAST(int8_t, n));
+  simde__m256i_private r_;
+
+  r_.m128i[0] = simde_mm_or_si128(a, simde_mm_shuffle_epi8(b, simde_mm_sub_epi8(iota, shift)));
+  r_.m128i[1] = simde_mm_shuffle_epi8(b, simde_mm_sub_epi8(simde_mm_add_epi8(iota, simde_mm_set1_epi8(-128)), shift));
+
+  return simde__m256i_from_private(r_);
 }
-#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
-  #undef _mm256_mask_compressstoreu_pd
-  #define _mm256_mask_compressstoreu_pd(base_addr, k, a) simde_mm256_mask_compressstoreu_pd(base_addr, k, a)
-#endif
 
 SIMDE_FUNCTION_ATTRIBUTES
-simde__m256d
-simde_mm256_maskz_compress_pd (simde__mmask8 k, simde__m256d a) {
-  #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
-    return _mm256_maskz_compress_pd(k, a);
-  #else
-    simde__m256d_private
-      a_ = simde__m256d_to_private(a);
-    size_t ri = 0;
+simde__m512i
+simde_x_mm512_compress_join (simde__m256i a, simde__m256i b, unsigned int n) {
+  SIMDE_ALIGN_TO_64 uint8_t buf[sizeof(simde__m512i)];
 
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
-      if ((k >> i) & 1) {
-        a_.f64[ri++] = a_.f64[i];
-      }
-    }
+  simde_memcpy(&buf[0], &a, sizeof(a));
+  simde_memset(&buf[sizeof(a)], 0, sizeof(a));
+  simde_memcpy(&buf[n], &b, sizeof(b));
 
-    for ( ; ri < (sizeof(a_.f64) / sizeof(a_.f64[0])); ri++) {
-      a_.f64[ri] = SIMDE_FLOAT64_C(0.0);
-    }
+  return simde_mm512_load_si512(buf);
+}
 
-    return simde__m256d_from_private(a_);
-  #endif
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_mm_compress_blend (simde__m128i src, simde__m128i a, int n) {
+  /* The first n bytes of a followed by the rest of src, for the mask
+   * variants.  a must be zero past the first n bytes; n may be outside
+   * of [0, 16] when called for part of a wider vector. */
+  const simde__m128i keep = simde_mm_cmpgt_epi8(simde_mm_set1_epi8(HEDLEY_STATIC_CAST(int8_t, n)), simde_mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+  return simde_mm_or_si128(a, simde_mm_andnot_si128(keep, src));
 }
-#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
-  #undef _mm256_maskz_compress_pd
-  #define _mm256_maskz_compress_pd(k, a) simde_mm256_maskz_compress_pd(k, a)
-#endif
 
 SIMDE_FUNCTION_ATTRIBUTES
-simde__m256
-simde_mm256_mask_compress_ps (simde__m256 src, simde__mmask8 k, simde__m256 a) {
-  #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
-    return _mm256_mask_compress_ps(src, k, a);
+simde__m256i
+simde_x_mm256_compress_blend (simde__m256i src, simde__m256i a, int n) {
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    const simde__m256i keep =
+      simde_mm256_cmpgt_epi8(
+        simde_mm256_set1_epi8(HEDLEY_STATIC_CAST(int8_t, n)),
+        simde_mm256_setr_epi8( 0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15,
+                              16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31));
+    return simde_mm256_or_si256(a, simde_mm256_andnot_si256(keep, src));
   #else
-    simde__m256_private
-      a_ = simde__m256_to_private(a),
-      src_ = simde__m256_to_private(src);
-    size_t ri = 0;
-
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; i++) {
-      if ((k >> i) & 1) {
-        a_.f32[ri++] = a_.f32[i];
-      }
-    }
+    simde__m256i_private
+      src_ = simde__m256i_to_private(src),
+      a_ = simde__m256i_to_private(a),
+      r_;
 
-    for ( ; ri < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; ri++) {
-      a_.f32[ri] = src_.f32[ri];
-    }
+    r_.m128i[0] = simde_x_mm_compress_blend(src_.m128i[0], a_.m128i[0], n);
+    r_.m128i[1] = simde_x_mm_compress_blend(src_.m128i[1], a_.m128i[1], n - 16);
 
-    return simde__m256_from_private(a_);
+    return simde__m256i_from_private(r_);
   #endif
 }
-#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
-  #undef _mm256_mask_compress_ps
-  #define _mm256_mask_compress_ps(src, k, a) simde_mm256_mask_compress_ps(src, k, a)
-#endif
 
 SIMDE_FUNCTION_ATTRIBUTES
-void
-simde_mm256_mask_compressstoreu_ps (void* base_addr, simde__mmask8 k, simde__m256 a) {
-  #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE) && !defined(__znver4__)
-    _mm256_mask_compressstoreu_ps(base_addr, k, a);
-  #elif defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE) && defined(__znver4__)
-    simde__mmask8 store_mask = _pext_u32(-1, k);
-    _mm256_mask_storeu_ps(base_addr, store_mask, _mm256_maskz_compress_ps(k, a));
-  #else
-    simde__m256_private
-      a_ = simde__m256_to_private(a);
-    size_t ri = 0;
-
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; i++) {
-      if ((k >> i) & 1) {
-        a_.f32[ri++] = a_.f32[i];
-      }
-    }
+simde__m512i
+simde_x_mm512_compress_blend (simde__m512i src, simde__m512i a, int n) {
+  simde__m512i_private
+    src_ = simde__m512i_to_private(src),
+    a_ = simde__m512i_to_private(a),
+    r_;
 
-    simde_memcpy(base_addr, &a_, ri * sizeof(a_.f32[0]));
+  r_.m256i[0] = simde_x_mm256_compress_blend(src_.m256i[0], a_.m256i[0], n);
+  r_.m256i[1] = simde_x_mm256_compress_blend(src_.m256i[1], a_.m256i[1], n - 32);
 
-    return;
-  #endif
+  return simde__m512i_from_private(r_);
 }
-#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
-  #undef _mm256_mask_compressstoreu_ps
-  #define _mm256_mask_compressstoreu_ps(base_addr, k, a) simde_mm256_mask_compressstoreu_ps(base_addr, k, a)
-#endif
 
 SIMDE_FUNCTION_ATTRIBUTES
-simde__m256
-simde_mm256_maskz_compress_ps (simde__mmask8 k, simde__m256 a) {
+simde__m256i
+simde_mm256_maskz_compress_epi32 (simde__mmask8 k, simde__m256i a) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
-    return _mm256_maskz_compress_ps(k, a);
+    return _mm256_maskz_compress_epi32(k, a);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    const simde__m256i idx = simde_x_mm256_compress_epi32_perm(k);
+    return simde_mm256_blendv_epi8(simde_mm256_permutevar8x32_epi32(a, idx), simde_mm256_setzero_si256(), idx);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE) || defined(SIMDE_ARM_NEON_A32V7_NATIVE) || defined(SIMDE_POWER_ALTIVEC_P6_NATIVE) || defined(SIMDE_WASM_SIMD128_NATIVE)
+    simde__m256i_private a_ = simde__m256i_to_private(a);
+
+    return
+      simde_x_mm256_compress_join(
+        simde_mm_shuffle_epi8(a_.m128i[0], simde_x_mm_compress_epi32_idx(HEDLEY_STATIC_CAST(uint8_t, k & 15))),
+        simde_mm_shuffle_epi8(a_.m128i[1], simde_x_mm_compress_epi32_idx(HEDLEY_STATIC_CAST(uint8_t, (k >> 4) & 15))),
+        simde_popcount64(k & 15) * 4
+      );
   #else
-    simde__m256_private
-      a_ = simde__m256_to_private(a);
+    /* Store every element but only advance past the selected ones, so
+     * there is no data-dependent branch; the slot after the last selected
+     * element may hold a rejected one and is cleared at the end. */
+    simde__m256i_private
+      a_ = simde__m256i_to_private(a),
+      r_;
+    int32_t t[(sizeof(a_.i32) / sizeof(a_.i32[0])) + 1] = { 0, };
     size_t ri = 0;
 
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; i++) {
-      if ((k >> i) & 1) {
-        a_.f32[ri++] = a_.f32[i];
-      }
+    for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
+      t[ri] = a_.i32[i];
+      ri += HEDLEY_STATIC_CAST(size_t, (k >> i) & 1);
     }
+    t[ri] = 0;
 
-    for ( ; ri < (sizeof(a_.f32) / sizeof(a_.f32[0])); ri++) {
-      a_.f32[ri] = SIMDE_FLOAT32_C(0.0);
-    }
+    simde_memcpy(&r_, t, sizeof(r_));
 
-    return simde__m256_from_private(a_);
+    return simde__m256i_from_private(r_);
   #endif
 }
 #if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
-  #undef _mm256_maskz_compress_ps
-  #define _mm256_maskz_compress_ps(k, a) simde_mm256_maskz_compress_ps(k, a)
+  #undef _mm256_maskz_compress_epi32
+  #define _mm256_maskz_compress_epi32(k, a) simde_mm256_maskz_compress_epi32(k, a)
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
@@ -190,24 +491,12 @@ simde__m256i
 simde_mm256_mask_compress_epi32 (simde__m256i src, simde__mmask8 k, simde__m256i a) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return _mm256_mask_compress_epi32(src, k, a);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    const simde__m256i idx = simde_x_mm256_compress_epi32_perm(k);
+    return simde_mm256_blendv_epi8(simde_mm256_permutevar8x32_epi32(a, idx), src, idx);
   #else
-    simde__m256i_private
-      a_ = simde__m256i_to_private(a),
-      src_ = simde__m256i_to_private(src);
-    size_t ri = 0;
-
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
-      if ((k >> i) & 1) {
-        a_.i32[ri++] = a_.i32[i];
-      }
-    }
-
-    for ( ; ri < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; ri++) {
-      a_.i32[ri] = src_.i32[ri];
-    }
-
-    return simde__m256i_from_private(a_);
+    const unsigned int n = simde_popcount64(k);
+    return simde_x_mm256_compress_blend(src, simde_mm256_maskz_compress_epi32(k, a), HEDLEY_STATIC_CAST(int, n * 4));
   #endif
 }
 #if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
@@ -224,20 +513,8 @@ simde_mm256_mask_compressstoreu_epi32 (void* base_addr, simde__mmask8 k, simde__
     simde__mmask8 store_mask = _pext_u32(-1, k);
     _mm256_mask_storeu_epi32(base_addr, store_mask, _mm256_maskz_compress_epi32(k, a));
   #else
-    simde__m256i_private
-      a_ = simde__m256i_to_private(a);
-    size_t ri = 0;
-
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
-      if ((k >> i) & 1) {
-        a_.i32[ri++] = a_.i32[i];
-      }
-    }
-
-    simde_memcpy(base_addr, &a_, ri * sizeof(a_.i32[0]));
-
-    return;
+    simde__m256i r = simde_mm256_maskz_compress_epi32(k, a);
+    simde_memcpy(base_addr, &r, simde_popcount64(k) * sizeof(int32_t));
   #endif
 }
 #if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
@@ -247,31 +524,45 @@ simde_mm256_mask_compressstoreu_epi32 (void* base_addr, simde__mmask8 k, simde__
 
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m256i
-simde_mm256_maskz_compress_epi32 (simde__mmask8 k, simde__m256i a) {
+simde_mm256_maskz_compress_epi64 (simde__mmask8 k, simde__m256i a) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
-    return _mm256_maskz_compress_epi32(k, a);
+    return _mm256_maskz_compress_epi64(k, a);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    const simde__m256i idx = simde_x_mm256_compress_epi64_perm(k);
+    return simde_mm256_blendv_epi8(simde_mm256_permutevar8x32_epi32(a, idx), simde_mm256_setzero_si256(), idx);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE) || defined(SIMDE_ARM_NEON_A32V7_NATIVE) || defined(SIMDE_POWER_ALTIVEC_P6_NATIVE) || defined(SIMDE_WASM_SIMD128_NATIVE)
+    simde__m256i_private a_ = simde__m256i_to_private(a);
+
+    return
+      simde_x_mm256_compress_join(
+        simde_mm_shuffle_epi8(a_.m128i[0], simde_x_mm_compress_epi64_idx(HEDLEY_STATIC_CAST(uint8_t, k & 3))),
+        simde_mm_shuffle_epi8(a_.m128i[1], simde_x_mm_compress_epi64_idx(HEDLEY_STATIC_CAST(uint8_t, (k >> 2) & 3))),
+        simde_popcount64(k & 3) * 8
+      );
   #else
+    /* Store every element but only advance past the selected ones, so
+     * there is no data-dependent branch; the slot after the last selected
+     * element may hold a rejected one and is cleared at the end. */
     simde__m256i_private
-      a_ = simde__m256i_to_private(a);
+      a_ = simde__m256i_to_private(a),
+      r_;
+    int64_t t[(sizeof(a_.i64) / sizeof(a_.i64[0])) + 1] = { 0, };
     size_t ri = 0;
 
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
-      if ((k >> i) & 1) {
-        a_.i32[ri++] = a_.i32[i];
-      }
+    for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
+      t[ri] = a_.i64[i];
+      ri += HEDLEY_STATIC_CAST(size_t, (k >> i) & 1);
     }
+    t[ri] = 0;
 
-    for ( ; ri < (sizeof(a_.i32) / sizeof(a_.i32[0])); ri++) {
-      a_.f32[ri] = INT32_C(0);
-    }
+    simde_memcpy(&r_, t, sizeof(r_));
 
-    return simde__m256i_from_private(a_);
+    return simde__m256i_from_private(r_);
   #endif
 }
 #if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
-  #undef _mm256_maskz_compress_epi32
-  #define _mm256_maskz_compress_epi32(k, a) simde_mm256_maskz_compress_epi32(k, a)
+  #undef _mm256_maskz_compress_epi64
+  #define _mm256_maskz_compress_epi64(k, a) simde_mm256_maskz_compress_epi64(k, a)
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
@@ -279,24 +570,12 @@ simde__m256i
 simde_mm256_mask_compress_epi64 (simde__m256i src, simde__mmask8 k, simde__m256i a) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return _mm256_mask_compress_epi64(src, k, a);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    const simde__m256i idx = simde_x_mm256_compress_epi64_perm(k);
+    return simde_mm256_blendv_epi8(simde_mm256_permutevar8x32_epi32(a, idx), src, idx);
   #else
-    simde__m256i_private
-      a_ = simde__m256i_to_private(a),
-      src_ = simde__m256i_to_private(src);
-    size_t ri = 0;
-
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
-      if ((k >> i) & 1) {
-        a_.i64[ri++] = a_.i64[i];
-      }
-    }
-
-    for ( ; ri < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; ri++) {
-      a_.i64[ri] = src_.i64[ri];
-    }
-
-    return simde__m256i_from_private(a_);
+    const unsigned int n = simde_popcount64(k & 15);
+    return simde_x_mm256_compress_blend(src, simde_mm256_maskz_compress_epi64(k, a), HEDLEY_STATIC_CAST(int, n * 8));
   #endif
 }
 #if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
@@ -313,20 +592,8 @@ simde_mm256_mask_compressstoreu_epi64 (void* base_addr, simde__mmask8 k, simde__
     simde__mmask8 store_mask = _pext_u32(-1, k);
     _mm256_mask_storeu_epi64(base_addr, store_mask, _mm256_maskz_compress_epi64(k, a));
   #else
-    simde__m256i_private
-      a_ = simde__m256i_to_private(a);
-    size_t ri = 0;
-
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
-      if ((k >> i) & 1) {
-        a_.i64[ri++] = a_.i64[i];
-      }
-    }
-
-    simde_memcpy(base_addr, &a_, ri * sizeof(a_.i64[0]));
-
-    return;
+    simde__m256i r = simde_mm256_maskz_compress_epi64(k, a);
+    simde_memcpy(base_addr, &r, simde_popcount64(k & 15) * sizeof(int64_t));
   #endif
 }
 #if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
@@ -335,210 +602,114 @@ simde_mm256_mask_compressstoreu_epi64 (void* base_addr, simde__mmask8 k, simde__
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
-simde__m256i
-simde_mm256_maskz_compress_epi64 (simde__mmask8 k, simde__m256i a) {
+simde__m256
+simde_mm256_maskz_compress_ps (simde__mmask8 k, simde__m256 a) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
-    return _mm256_maskz_compress_epi64(k, a);
+    return _mm256_maskz_compress_ps(k, a);
   #else
-    simde__m256i_private
-      a_ = simde__m256i_to_private(a);
-    size_t ri = 0;
-
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
-      if ((k >> i) & 1) {
-        a_.i64[ri++] = a_.i64[i];
-      }
-    }
-
-    for ( ; ri < (sizeof(a_.i64) / sizeof(a_.i64[0])); ri++) {
-      a_.i64[ri] = INT64_C(0);
-    }
-
-    return simde__m256i_from_private(a_);
+    return simde_mm256_castsi256_ps(simde_mm256_maskz_compress_epi32(k, simde_mm256_castps_si256(a)));
   #endif
 }
 #if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
-  #undef _mm256_maskz_compress_epi64
-  #define _mm256_maskz_compress_epi64(k, a) simde_mm256_maskz_compress_epi64(k, a)
+  #undef _mm256_maskz_compress_ps
+  #define _mm256_maskz_compress_ps(k, a) simde_mm256_maskz_compress_ps(k, a)
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
-simde__m512d
-simde_mm512_mask_compress_pd (simde__m512d src, simde__mmask8 k, simde__m512d a) {
+simde__m256
+simde_mm256_mask_compress_ps (simde__m256 src, simde__mmask8 k, simde__m256 a) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
-    return _mm512_mask_compress_pd(src, k, a);
+    return _mm256_mask_compress_ps(src, k, a);
   #else
-    simde__m512d_private
-      a_ = simde__m512d_to_private(a),
-      src_ = simde__m512d_to_private(src);
-    size_t ri = 0;
-
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
-      if ((k >> i) & 1) {
-        a_.f64[ri++] = a_.f64[i];
-      }
-    }
-
-    for ( ; ri < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; ri++) {
-      a_.f64[ri] = src_.f64[ri];
-    }
-
-    return simde__m512d_from_private(a_);
+    return simde_mm256_castsi256_ps(simde_mm256_mask_compress_epi32(simde_mm256_castps_si256(src), k, simde_mm256_castps_si256(a)));
   #endif
 }
 #if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
-  #undef _mm512_mask_compress_pd
-  #define _mm512_mask_compress_pd(src, k, a) simde_mm512_mask_compress_pd(src, k, a)
+  #undef _mm256_mask_compress_ps
+  #define _mm256_mask_compress_ps(src, k, a) simde_mm256_mask_compress_ps(src, k, a)
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
 void
-simde_mm512_mask_compressstoreu_pd (void* base_addr, simde__mmask8 k, simde__m512d a) {
+simde_mm256_mask_compressstoreu_ps (void* base_addr, simde__mmask8 k, simde__m256 a) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE) && !defined(__znver4__)
-    _mm512_mask_compressstoreu_pd(base_addr, k, a);
+    _mm256_mask_compressstoreu_ps(base_addr, k, a);
   #elif defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE) && defined(__znver4__)
     simde__mmask8 store_mask = _pext_u32(-1, k);
-    _mm512_mask_storeu_pd(base_addr, store_mask, _mm512_maskz_compress_pd(k, a));
+    _mm256_mask_storeu_ps(base_addr, store_mask, _mm256_maskz_compress_ps(k, a));
   #else
-    simde__m512d_private
-      a_ = simde__m512d_to_private(a);
-    size_t ri = 0;
-
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
-      if ((k >> i) & 1) {
-        a_.f64[ri++] = a_.f64[i];
-      }
-    }
-
-    simde_memcpy(base_addr, &a_, ri * sizeof(a_.f64[0]));
-
-    return;
+    simde_mm256_mask_compressstoreu_epi32(base_addr, k, simde_mm256_castps_si256(a));
   #endif
 }
 #if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
-  #undef _mm512_mask_compressstoreu_pd
-  #define _mm512_mask_compressstoreu_pd(base_addr, k, a) simde_mm512_mask_compressstoreu_pd(base_addr, k, a)
+  #undef _mm256_mask_compressstoreu_ps
+  #define _mm256_mask_compressstoreu_ps(base_addr, k, a) simde_mm256_mask_compressstoreu_ps(base_addr, k, a)
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
-simde__m512d
-simde_mm512_maskz_compress_pd (simde__mmask8 k, simde__m512d a) {
+simde__m256d
+simde_mm256_maskz_compress_pd (simde__mmask8 k, simde__m256d a) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
-    return _mm512_maskz_compress_pd(k, a);
+    return _mm256_maskz_compress_pd(k, a);
   #else
-    simde__m512d_private
-      a_ = simde__m512d_to_private(a);
-    size_t ri = 0;
-
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
-      if ((k >> i) & 1) {
-        a_.f64[ri++] = a_.f64[i];
-      }
-    }
-
-    for ( ; ri < (sizeof(a_.f64) / sizeof(a_.f64[0])); ri++) {
-      a_.f64[ri] = SIMDE_FLOAT64_C(0.0);
-    }
-
-    return simde__m512d_from_private(a_);
+    return simde_mm256_castsi256_pd(simde_mm256_maskz_compress_epi64(k, simde_mm256_castpd_si256(a)));
   #endif
 }
 #if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
-  #undef _mm512_maskz_compress_pd
-  #define _mm512_maskz_compress_pd(k, a) simde_mm512_maskz_compress_pd(k, a)
+  #undef _mm256_maskz_compress_pd
+  #define _mm256_maskz_compress_pd(k, a) simde_mm256_maskz_compress_pd(k, a)
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
-simde__m512
-simde_mm512_mask_compress_ps (simde__m512 src, simde__mmask16 k, simde__m512 a) {
+simde__m256d
+simde_mm256_mask_compress_pd (simde__m256d src, simde__mmask8 k, simde__m256d a) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
-    return _mm512_mask_compress_ps(src, k, a);
+    return _mm256_mask_compress_pd(src, k, a);
   #else
-    simde__m512_private
-      a_ = simde__m512_to_private(a),
-      src_ = simde__m512_to_private(src);
-    size_t ri = 0;
-
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; i++) {
-      if ((k >> i) & 1) {
-        a_.f32[ri++] = a_.f32[i];
-      }
-    }
-
-    for ( ; ri < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; ri++) {
-      a_.f32[ri] = src_.f32[ri];
-    }
-
-    return simde__m512_from_private(a_);
+    return simde_mm256_castsi256_pd(simde_mm256_mask_compress_epi64(simde_mm256_castpd_si256(src), k, simde_mm256_castpd_si256(a)));
   #endif
 }
 #if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
-  #undef _mm512_mask_compress_ps
-  #define _mm512_mask_compress_ps(src, k, a) simde_mm512_mask_compress_ps(src, k, a)
+  #undef _mm256_mask_compress_pd
+  #define _mm256_mask_compress_pd(src, k, a) simde_mm256_mask_compress_pd(src, k, a)
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
 void
-simde_mm512_mask_compressstoreu_ps (void* base_addr, simde__mmask16 k, simde__m512 a) {
+simde_mm256_mask_compressstoreu_pd (void* base_addr, simde__mmask8 k, simde__m256d a) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE) && !defined(__znver4__)
-    _mm512_mask_compressstoreu_ps(base_addr, k, a);
+    _mm256_mask_compressstoreu_pd(base_addr, k, a);
   #elif defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE) && defined(__znver4__)
-    simde__mmask16 store_mask = _pext_u32(-1, k);
-    _mm512_mask_storeu_ps(base_addr, store_mask, _mm512_maskz_compress_ps(k, a));
+    simde__mmask8 store_mask = _pext_u32(-1, k);
+    _mm256_mask_storeu_pd(base_addr, store_mask, _mm256_maskz_compress_pd(k, a));
   #else
-    simde__m512_private
-      a_ = simde__m512_to_private(a);
-    size_t ri = 0;
-
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; i++) {
-      if ((k >> i) & 1) {
-        a_.f32[ri++] = a_.f32[i];
-      }
-    }
-
-    simde_memcpy(base_addr, &a_, ri * sizeof(a_.f32[0]));
-
-    return;
+    simde_mm256_mask_compressstoreu_epi64(base_addr, k, simde_mm256_castpd_si256(a));
   #endif
 }
 #if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
-  #undef _mm512_mask_compressstoreu_ps
-  #define _mm512_mask_compressstoreu_ps(base_addr, k, a) simde_mm512_mask_compressstoreu_ps(base_addr, k, a)
+  #undef _mm256_mask_compressstoreu_pd
+  #define _mm256_mask_compressstoreu_pd(base_addr, k, a) simde_mm256_mask_compressstoreu_pd(base_addr, k, a)
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
-simde__m512
-simde_mm512_maskz_compress_ps (simde__mmask16 k, simde__m512 a) {
+simde__m512i
+simde_mm512_maskz_compress_epi32 (simde__mmask16 k, simde__m512i a) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
-    return _mm512_maskz_compress_ps(k, a);
+    return _mm512_maskz_compress_epi32(k, a);
   #else
-    simde__m512_private
-      a_ = simde__m512_to_private(a);
-    size_t ri = 0;
-
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; i++) {
-      if ((k >> i) & 1) {
-        a_.f32[ri++] = a_.f32[i];
-      }
-    }
-
-    for ( ; ri < (sizeof(a_.f32) / sizeof(a_.f32[0])); ri++) {
-      a_.f32[ri] = SIMDE_FLOAT32_C(0.0);
-    }
-
-    return simde__m512_from_private(a_);
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+
+    return
+      simde_x_mm512_compress_join(
+        simde_mm256_maskz_compress_epi32(HEDLEY_STATIC_CAST(simde__mmask8, k & 255), a_.m256i[0]),
+        simde_mm256_maskz_compress_epi32(HEDLEY_STATIC_CAST(simde__mmask8, k >> 8), a_.m256i[1]),
+        simde_popcount64(k & 255) * 4
+      );
   #endif
 }
 #if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
-  #undef _mm512_maskz_compress_ps
-  #define _mm512_maskz_compress_ps(k, a) simde_mm512_maskz_compress_ps(k, a)
+  #undef _mm512_maskz_compress_epi32
+  #define _mm512_maskz_compress_epi32(k, a) simde_mm512_maskz_compress_epi32(k, a)
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
@@ -547,23 +718,8 @@ simde_mm512_mask_compress_epi32 (simde__m512i src, simde__mmask16 k, simde__m512
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return _mm512_mask_compress_epi32(src, k, a);
   #else
-    simde__m512i_private
-      a_ = simde__m512i_to_private(a),
-      src_ = simde__m512i_to_private(src);
-    size_t ri = 0;
-
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
-      if ((k >> i) & 1) {
-        a_.i32[ri++] = a_.i32[i];
-      }
-    }
-
-    for ( ; ri < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; ri++) {
-      a_.i32[ri] = src_.i32[ri];
-    }
-
-    return simde__m512i_from_private(a_);
+    const unsigned int n = simde_popcount64(k);
+    return simde_x_mm512_compress_blend(src, simde_mm512_maskz_compress_epi32(k, a), HEDLEY_STATIC_CAST(int, n * 4));
   #endif
 }
 #if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
@@ -571,36 +727,6 @@ simde_mm512_mask_compress_epi32 (simde__m512i src, simde__mmask16 k, simde__m512
   #define _mm512_mask_compress_epi32(src, k, a) simde_mm512_mask_compress_epi32(src, k, a)
 #endif
 
-SIMDE_FUNCTION_ATTRIBUTES
-void
-simde_mm512_mask_compressstoreu_epi16 (void* base_addr, simde__mmask32 k, simde__m512i a) {
-  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && !defined(__znver4__)
-    _mm512_mask_compressstoreu_epi16(base_addr, k, a);
-  #elif defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(__znver4__)
-    simde__mmask32 store_mask = _pext_u32(-1, k);
-    _mm512_mask_storeu_epi16(base_addr, store_mask, _mm512_maskz_compress_epi16(k, a));
-  #else
-    simde__m512i_private
-      a_ = simde__m512i_to_private(a);
-    size_t ri = 0;
-
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(a_.i16) / sizeof(a_.i16[0])) ; i++) {
-      if ((k >> i) & 1) {
-        a_.i16[ri++] = a_.i16[i];
-      }
-    }
-
-    simde_memcpy(base_addr, &a_, ri * sizeof(a_.i16[0]));
-
-    return;
-  #endif
-}
-#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
-  #undef _mm512_mask_compressstoreu_epi16
-  #define _mm512_mask_compressstoreu_epi16(base_addr, k, a) simde_mm512_mask_compressstoreu_epi16(base_addr, k, a)
-#endif
-
 SIMDE_FUNCTION_ATTRIBUTES
 void
 simde_mm512_mask_compressstoreu_epi32 (void* base_addr, simde__mmask16 k, simde__m512i a) {
@@ -610,20 +736,12 @@ simde_mm512_mask_compressstoreu_epi32 (void* base_addr, simde__mmask16 k, simde_
     simde__mmask16 store_mask = _pext_u32(-1, k);
     _mm512_mask_storeu_epi32(base_addr, store_mask, _mm512_maskz_compress_epi32(k, a));
   #else
-    simde__m512i_private
-      a_ = simde__m512i_to_private(a);
-    size_t ri = 0;
+    simde__m512i_private a_ = simde__m512i_to_private(a);
 
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
-      if ((k >> i) & 1) {
-        a_.i32[ri++] = a_.i32[i];
-      }
-    }
-
-    simde_memcpy(base_addr, &a_, ri * sizeof(a_.i32[0]));
-
-    return;
+    simde_mm256_mask_compressstoreu_epi32(base_addr, HEDLEY_STATIC_CAST(simde__mmask8, k & 255), a_.m256i[0]);
+    simde_mm256_mask_compressstoreu_epi32(
+      HEDLEY_REINTERPRET_CAST(int32_t*, base_addr) + simde_popcount64(k & 255),
+      HEDLEY_STATIC_CAST(simde__mmask8, k >> 8), a_.m256i[1]);
   #endif
 }
 #if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
@@ -633,31 +751,23 @@ simde_mm512_mask_compressstoreu_epi32 (void* base_addr, simde__mmask16 k, simde_
 
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m512i
-simde_mm512_maskz_compress_epi32 (simde__mmask16 k, simde__m512i a) {
+simde_mm512_maskz_compress_epi64 (simde__mmask8 k, simde__m512i a) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
-    return _mm512_maskz_compress_epi32(k, a);
+    return _mm512_maskz_compress_epi64(k, a);
   #else
-    simde__m512i_private
-      a_ = simde__m512i_to_private(a);
-    size_t ri = 0;
-
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
-      if ((k >> i) & 1) {
-        a_.i32[ri++] = a_.i32[i];
-      }
-    }
-
-    for ( ; ri < (sizeof(a_.i32) / sizeof(a_.i32[0])); ri++) {
-      a_.f32[ri] = INT32_C(0);
-    }
-
-    return simde__m512i_from_private(a_);
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+
+    return
+      simde_x_mm512_compress_join(
+        simde_mm256_maskz_compress_epi64(HEDLEY_STATIC_CAST(simde__mmask8, k & 15), a_.m256i[0]),
+        simde_mm256_maskz_compress_epi64(HEDLEY_STATIC_CAST(simde__mmask8, k >> 4), a_.m256i[1]),
+        simde_popcount64(k & 15) * 8
+      );
   #endif
 }
 #if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
-  #undef _mm512_maskz_compress_epi32
-  #define _mm512_maskz_compress_epi32(k, a) simde_mm512_maskz_compress_epi32(k, a)
+  #undef _mm512_maskz_compress_epi64
+  #define _mm512_maskz_compress_epi64(k, a) simde_mm512_maskz_compress_epi64(k, a)
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
@@ -666,23 +776,8 @@ simde_mm512_mask_compress_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return _mm512_mask_compress_epi64(src, k, a);
   #else
-    simde__m512i_private
-      a_ = simde__m512i_to_private(a),
-      src_ = simde__m512i_to_private(src);
-    size_t ri = 0;
-
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
-      if ((k >> i) & 1) {
-        a_.i64[ri++] = a_.i64[i];
-      }
-    }
-
-    for ( ; ri < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; ri++) {
-      a_.i64[ri] = src_.i64[ri];
-    }
-
-    return simde__m512i_from_private(a_);
+    const unsigned int n = simde_popcount64(k);
+    return simde_x_mm512_compress_blend(src, simde_mm512_maskz_compress_epi64(k, a), HEDLEY_STATIC_CAST(int, n * 8));
   #endif
 }
 #if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
@@ -699,20 +794,12 @@ simde_mm512_mask_compressstoreu_epi64 (void* base_addr, simde__mmask8 k, simde__
     simde__mmask8 store_mask = _pext_u32(-1, k);
     _mm512_mask_storeu_epi64(base_addr, store_mask, _mm512_maskz_compress_epi64(k, a));
   #else
-    simde__m512i_private
-      a_ = simde__m512i_to_private(a);
-    size_t ri = 0;
-
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
-      if ((k >> i) & 1) {
-        a_.i64[ri++] = a_.i64[i];
-      }
-    }
-
-    simde_memcpy(base_addr, &a_, ri * sizeof(a_.i64[0]));
+    simde__m512i_private a_ = simde__m512i_to_private(a);
 
-    return;
+    simde_mm256_mask_compressstoreu_epi64(base_addr, HEDLEY_STATIC_CAST(simde__mmask8, k & 15), a_.m256i[0]);
+    simde_mm256_mask_compressstoreu_epi64(
+      HEDLEY_REINTERPRET_CAST(int64_t*, base_addr) + simde_popcount64(k & 15),
+      HEDLEY_STATIC_CAST(simde__mmask8, k >> 4), a_.m256i[1]);
   #endif
 }
 #if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
@@ -721,32 +808,403 @@ simde_mm512_mask_compressstoreu_epi64 (void* base_addr, simde__mmask8 k, simde__
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
-simde__m512i
-simde_mm512_maskz_compress_epi64 (simde__mmask8 k, simde__m512i a) {
+simde__m512
+simde_mm512_maskz_compress_ps (simde__mmask16 k, simde__m512 a) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
-    return _mm512_maskz_compress_epi64(k, a);
+    return _mm512_maskz_compress_ps(k, a);
   #else
-    simde__m512i_private
-      a_ = simde__m512i_to_private(a);
-    size_t ri = 0;
+    return simde_mm512_castsi512_ps(simde_mm512_maskz_compress_epi32(k, simde_mm512_castps_si512(a)));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_compress_ps
+  #define _mm512_maskz_compress_ps(k, a) simde_mm512_maskz_compress_ps(k, a)
+#endif
 
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
-      if ((k >> i) & 1) {
-        a_.i64[ri++] = a_.i64[i];
-      }
-    }
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_compress_ps (simde__m512 src, simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_compress_ps(src, k, a);
+  #else
+    return simde_mm512_castsi512_ps(simde_mm512_mask_compress_epi32(simde_mm512_castps_si512(src), k, simde_mm512_castps_si512(a)));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_compress_ps
+  #define _mm512_mask_compress_ps(src, k, a) simde_mm512_mask_compress_ps(src, k, a)
+#endif
 
-    for ( ; ri < (sizeof(a_.i64) / sizeof(a_.i64[0])); ri++) {
-      a_.i64[ri] = INT64_C(0);
-    }
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_compressstoreu_ps (void* base_addr, simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE) && !defined(__znver4__)
+    _mm512_mask_compressstoreu_ps(base_addr, k, a);
+  #elif defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE) && defined(__znver4__)
+    simde__mmask16 store_mask = _pext_u32(-1, k);
+    _mm512_mask_storeu_ps(base_addr, store_mask, _mm512_maskz_compress_ps(k, a));
+  #else
+    simde_mm512_mask_compressstoreu_epi32(base_addr, k, simde_mm512_castps_si512(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_compressstoreu_ps
+  #define _mm512_mask_compressstoreu_ps(base_addr, k, a) simde_mm512_mask_compressstoreu_ps(base_addr, k, a)
+#endif
 
-    return simde__m512i_from_private(a_);
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_compress_pd (simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_maskz_compress_pd(k, a);
+  #else
+    return simde_mm512_castsi512_pd(simde_mm512_maskz_compress_epi64(k, simde_mm512_castpd_si512(a)));
   #endif
 }
 #if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
-  #undef _mm512_maskz_compress_epi64
-  #define _mm512_maskz_compress_epi64(k, a) simde_mm512_maskz_compress_epi64(k, a)
+  #undef _mm512_maskz_compress_pd
+  #define _mm512_maskz_compress_pd(k, a) simde_mm512_maskz_compress_pd(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_compress_pd (simde__m512d src, simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_compress_pd(src, k, a);
+  #else
+    return simde_mm512_castsi512_pd(simde_mm512_mask_compress_epi64(simde_mm512_castpd_si512(src), k, simde_mm512_castpd_si512(a)));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_compress_pd
+  #define _mm512_mask_compress_pd(src, k, a) simde_mm512_mask_compress_pd(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_compressstoreu_pd (void* base_addr, simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE) && !defined(__znver4__)
+    _mm512_mask_compressstoreu_pd(base_addr, k, a);
+  #elif defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512F_NATIVE) && defined(__znver4__)
+    simde__mmask8 store_mask = _pext_u32(-1, k);
+    _mm512_mask_storeu_pd(base_addr, store_mask, _mm512_maskz_compress_pd(k, a));
+  #else
+    simde_mm512_mask_compressstoreu_epi64(base_addr, k, simde_mm512_castpd_si512(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_compressstoreu_pd
+  #define _mm512_mask_compressstoreu_pd(base_addr, k, a) simde_mm512_mask_compressstoreu_pd(base_addr, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_compress_epi8 (simde__mmask16 k, simde__m128i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_compress_epi8(k, a);
+  #else
+    return simde_mm_shuffle_epi8(a, simde_x_mm_compress_epi8_idx(k));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_compress_epi8
+  #define _mm_maskz_compress_epi8(k, a) simde_mm_maskz_compress_epi8(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_compress_epi8 (simde__m128i src, simde__mmask16 k, simde__m128i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_compress_epi8(src, k, a);
+  #else
+    const unsigned int n = simde_popcount64(k);
+    return simde_x_mm_compress_blend(src, simde_mm_maskz_compress_epi8(k, a), HEDLEY_STATIC_CAST(int, n));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_compress_epi8
+  #define _mm_mask_compress_epi8(src, k, a) simde_mm_mask_compress_epi8(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_mask_compressstoreu_epi8 (void* base_addr, simde__mmask16 k, simde__m128i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) && !defined(__znver4__)
+    _mm_mask_compressstoreu_epi8(base_addr, k, a);
+  #elif defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) && defined(__znver4__)
+    simde__mmask16 store_mask = _pext_u32(-1, k);
+    _mm_mask_storeu_epi8(base_addr, store_mask, _mm_maskz_compress_epi8(k, a));
+  #else
+    simde__m128i r = simde_mm_maskz_compress_epi8(k, a);
+    simde_memcpy(base_addr, &r, simde_popcount64(k));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_compressstoreu_epi8
+  #define _mm_mask_compressstoreu_epi8(base_addr, k, a) simde_mm_mask_compressstoreu_epi8(base_addr, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_compress_epi16 (simde__mmask8 k, simde__m128i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_compress_epi16(k, a);
+  #else
+    return simde_mm_shuffle_epi8(a, simde_x_mm_compress_epi16_idx(k));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_compress_epi16
+  #define _mm_maskz_compress_epi16(k, a) simde_mm_maskz_compress_epi16(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_compress_epi16 (simde__m128i src, simde__mmask8 k, simde__m128i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_compress_epi16(src, k, a);
+  #else
+    const unsigned int n = simde_popcount64(k);
+    return simde_x_mm_compress_blend(src, simde_mm_maskz_compress_epi16(k, a), HEDLEY_STATIC_CAST(int, n * 2));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_compress_epi16
+  #define _mm_mask_compress_epi16(src, k, a) simde_mm_mask_compress_epi16(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_mask_compressstoreu_epi16 (void* base_addr, simde__mmask8 k, simde__m128i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) && !defined(__znver4__)
+    _mm_mask_compressstoreu_epi16(base_addr, k, a);
+  #elif defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) && defined(__znver4__)
+    simde__mmask8 store_mask = _pext_u32(-1, k);
+    _mm_mask_storeu_epi16(base_addr, store_mask, _mm_maskz_compress_epi16(k, a));
+  #else
+    simde__m128i r = simde_mm_maskz_compress_epi16(k, a);
+    simde_memcpy(base_addr, &r, simde_popcount64(k) * sizeof(int16_t));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_compressstoreu_epi16
+  #define _mm_mask_compressstoreu_epi16(base_addr, k, a) simde_mm_mask_compressstoreu_epi16(base_addr, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_compress_epi8 (simde__mmask32 k, simde__m256i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_compress_epi8(k, a);
+  #else
+    simde__m256i_private a_ = simde__m256i_to_private(a);
+
+    return
+      simde_x_mm256_compress_join(
+        simde_mm_maskz_compress_epi8(HEDLEY_STATIC_CAST(simde__mmask16, k      ), a_.m128i[0]),
+        simde_mm_maskz_compress_epi8(HEDLEY_STATIC_CAST(simde__mmask16, k >> 16), a_.m128i[1]),
+        simde_popcount64(k & 0xffff)
+      );
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_compress_epi8
+  #define _mm256_maskz_compress_epi8(k, a) simde_mm256_maskz_compress_epi8(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_compress_epi8 (simde__m256i src, simde__mmask32 k, simde__m256i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_compress_epi8(src, k, a);
+  #else
+    const unsigned int n = simde_popcount64(k);
+    return simde_x_mm256_compress_blend(src, simde_mm256_maskz_compress_epi8(k, a), HEDLEY_STATIC_CAST(int, n));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_compress_epi8
+  #define _mm256_mask_compress_epi8(src, k, a) simde_mm256_mask_compress_epi8(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_mask_compressstoreu_epi8 (void* base_addr, simde__mmask32 k, simde__m256i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) && !defined(__znver4__)
+    _mm256_mask_compressstoreu_epi8(base_addr, k, a);
+  #elif defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) && defined(__znver4__)
+    simde__mmask32 store_mask = _pext_u32(-1, k);
+    _mm256_mask_storeu_epi8(base_addr, store_mask, _mm256_maskz_compress_epi8(k, a));
+  #else
+    simde__m256i r = simde_mm256_maskz_compress_epi8(k, a);
+    simde_memcpy(base_addr, &r, simde_popcount64(k));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_compressstoreu_epi8
+  #define _mm256_mask_compressstoreu_epi8(base_addr, k, a) simde_mm256_mask_compressstoreu_epi8(base_addr, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_compress_epi16 (simde__mmask16 k, simde__m256i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_compress_epi16(k, a);
+  #else
+    simde__m256i_private a_ = simde__m256i_to_private(a);
+
+    return
+      simde_x_mm256_compress_join(
+        simde_mm_maskz_compress_epi16(HEDLEY_STATIC_CAST(simde__mmask8, k     ), a_.m128i[0]),
+        simde_mm_maskz_compress_epi16(HEDLEY_STATIC_CAST(simde__mmask8, k >> 8), a_.m128i[1]),
+        simde_popcount64(k & 0xff) * 2
+      );
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_compress_epi16
+  #define _mm256_maskz_compress_epi16(k, a) simde_mm256_maskz_compress_epi16(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_compress_epi16 (simde__m256i src, simde__mmask16 k, simde__m256i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_compress_epi16(src, k, a);
+  #else
+    const unsigned int n = simde_popcount64(k);
+    return simde_x_mm256_compress_blend(src, simde_mm256_maskz_compress_epi16(k, a), HEDLEY_STATIC_CAST(int, n * 2));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_compress_epi16
+  #define _mm256_mask_compress_epi16(src, k, a) simde_mm256_mask_compress_epi16(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_mask_compressstoreu_epi16 (void* base_addr, simde__mmask16 k, simde__m256i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) && !defined(__znver4__)
+    _mm256_mask_compressstoreu_epi16(base_addr, k, a);
+  #elif defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) && defined(__znver4__)
+    simde__mmask16 store_mask = _pext_u32(-1, k);
+    _mm256_mask_storeu_epi16(base_addr, store_mask, _mm256_maskz_compress_epi16(k, a));
+  #else
+    simde__m256i r = simde_mm256_maskz_compress_epi16(k, a);
+    simde_memcpy(base_addr, &r, simde_popcount64(k) * sizeof(int16_t));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_compressstoreu_epi16
+  #define _mm256_mask_compressstoreu_epi16(base_addr, k, a) simde_mm256_mask_compressstoreu_epi16(base_addr, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_compress_epi8 (simde__mmask64 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_maskz_compress_epi8(k, a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+
+    return
+      simde_x_mm512_compress_join(
+        simde_mm256_maskz_compress_epi8(HEDLEY_STATIC_CAST(simde__mmask32, k      ), a_.m256i[0]),
+        simde_mm256_maskz_compress_epi8(HEDLEY_STATIC_CAST(simde__mmask32, k >> 32), a_.m256i[1]),
+        simde_popcount64(k & UINT64_C(0xffffffff))
+      );
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_compress_epi8
+  #define _mm512_maskz_compress_epi8(k, a) simde_mm512_maskz_compress_epi8(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_compress_epi8 (simde__m512i src, simde__mmask64 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_mask_compress_epi8(src, k, a);
+  #else
+    const unsigned int n = simde_popcount64(k);
+    return simde_x_mm512_compress_blend(src, simde_mm512_maskz_compress_epi8(k, a), HEDLEY_STATIC_CAST(int, n));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_compress_epi8
+  #define _mm512_mask_compress_epi8(src, k, a) simde_mm512_mask_compress_epi8(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_compressstoreu_epi8 (void* base_addr, simde__mmask64 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && !defined(__znver4__)
+    _mm512_mask_compressstoreu_epi8(base_addr, k, a);
+  #elif defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(__znver4__)
+    simde__mmask64 store_mask = _pext_u64(-1, k);
+    _mm512_mask_storeu_epi8(base_addr, store_mask, _mm512_maskz_compress_epi8(k, a));
+  #else
+    simde__m512i r = simde_mm512_maskz_compress_epi8(k, a);
+    simde_memcpy(base_addr, &r, simde_popcount64(k));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_compressstoreu_epi8
+  #define _mm512_mask_compressstoreu_epi8(base_addr, k, a) simde_mm512_mask_compressstoreu_epi8(base_addr, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_compress_epi16 (simde__mmask32 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_maskz_compress_epi16(k, a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+
+    return
+      simde_x_mm512_compress_join(
+        simde_mm256_maskz_compress_epi16(HEDLEY_STATIC_CAST(simde__mmask16, k      ), a_.m256i[0]),
+        simde_mm256_maskz_compress_epi16(HEDLEY_STATIC_CAST(simde__mmask16, k >> 16), a_.m256i[1]),
+        simde_popcount64(k & 0xffff) * 2
+      );
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_compress_epi16
+  #define _mm512_maskz_compress_epi16(k, a) simde_mm512_maskz_compress_epi16(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_compress_epi16 (simde__m512i src, simde__mmask32 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_mask_compress_epi16(src, k, a);
+  #else
+    const unsigned int n = simde_popcount64(k);
+    return simde_x_mm512_compress_blend(src, simde_mm512_maskz_compress_epi16(k, a), HEDLEY_STATIC_CAST(int, n * 2));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_compress_epi16
+  #define _mm512_mask_compress_epi16(src, k, a) simde_mm512_mask_compress_epi16(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_compressstoreu_epi16 (void* base_addr, simde__mmask32 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && !defined(__znver4__)
+    _mm512_mask_compressstoreu_epi16(base_addr, k, a);
+  #elif defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(__znver4__)
+    simde__mmask32 store_mask = _pext_u32(-1, k);
+    _mm512_mask_storeu_epi16(base_addr, store_mask, _mm512_maskz_compress_epi16(k, a));
+  #else
+    simde__m512i r = simde_mm512_maskz_compress_epi16(k, a);
+    simde_memcpy(base_addr, &r, simde_popcount64(k) * sizeof(int16_t));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_compressstoreu_epi16
+  #define _mm512_mask_compressstoreu_epi16(base_addr, k, a) simde_mm512_mask_compressstoreu_epi16(base_addr, k, a)
 #endif
 
 SIMDE_END_DECLS_
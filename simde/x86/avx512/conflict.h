@@ -6,31 +6,136 @@
 #include "mov.h"
 #include "cmpeq.h"
 #include "set1.h"
+#include "../avx2.h"
 
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
 SIMDE_BEGIN_DECLS_
 
+/* The fallbacks compare a with successive rotations of itself instead
+ * of broadcasting each lane.  When a is rotated by s lanes, lane i is
+ * compared with lane i - s.  The bit for that lane is (1 << i) >> s,
+ * which is 0 for lanes that wrapped around (i < s), so they need no
+ * separate mask.  Wider vectors are split in half: the upper half also
+ * conflicts with every lane of the lower half, which is what the
+ * simde_x_*_conflict_cross_* functions compute. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_mm_conflict_cross_epi32 (simde__m128i a, simde__m128i b) {
+  /* For each lane of a, a bit for every lane of b which is equal. */
+  simde__m128i
+    r = simde_mm_setzero_si128(),
+    bit = simde_mm_setr_epi32(1, 2, 4, 8);
+
+  for (int s = 0 ; s < 4 ; s++) {
+    r = simde_mm_or_si128(r, simde_mm_and_si128(simde_mm_cmpeq_epi32(a, b), bit));
+    b = simde_mm_shuffle_epi32(b, SIMDE_MM_SHUFFLE(2, 1, 0, 3));
+    bit = simde_mm_shuffle_epi32(bit, SIMDE_MM_SHUFFLE(2, 1, 0, 3));
+  }
+
+  return r;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_x_mm256_conflict_cross_epi32 (simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    const simde__m256i rot = simde_mm256_setr_epi32(7, 0, 1, 2, 3, 4, 5, 6);
+    simde__m256i
+      r = simde_mm256_setzero_si256(),
+      bit = simde_mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+
+    for (int s = 0 ; s < 8 ; s++) {
+      r = simde_mm256_or_si256(r, simde_mm256_and_si256(simde_mm256_cmpeq_epi32(a, b), bit));
+      b = simde_mm256_permutevar8x32_epi32(b, rot);
+      bit = simde_mm256_permutevar8x32_epi32(bit, rot);
+    }
+
+    return r;
+  #else
+    simde__m256i_private
+      a_ = simde__m256i_to_private(a),
+      b_ = simde__m256i_to_private(b),
+      r_;
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+      r_.m128i[i] =
+        simde_mm_or_si128(
+          simde_x_mm_conflict_cross_epi32(a_.m128i[i], b_.m128i[0]),
+          simde_mm_slli_epi32(simde_x_mm_conflict_cross_epi32(a_.m128i[i], b_.m128i[1]), 4)
+        );
+    }
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_mm_conflict_cross_epi64 (simde__m128i a, simde__m128i b) {
+  const simde__m128i bs = simde_mm_shuffle_epi32(b, SIMDE_MM_SHUFFLE(1, 0, 3, 2));
+
+  return
+    simde_mm_or_si128(
+      simde_mm_and_si128(simde_mm_cmpeq_epi64(a, b ), simde_mm_set_epi64x(2, 1)),
+      simde_mm_and_si128(simde_mm_cmpeq_epi64(a, bs), simde_mm_set_epi64x(1, 2))
+    );
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_x_mm256_conflict_cross_epi64 (simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_X86_AVX2_NATIVE)
+    simde__m256i
+      r = simde_mm256_setzero_si256(),
+      bit = simde_mm256_setr_epi64x(1, 2, 4, 8);
+
+    for (int s = 0 ; s < 4 ; s++) {
+      r = simde_mm256_or_si256(r, simde_mm256_and_si256(simde_mm256_cmpeq_epi64(a, b), bit));
+      b = simde_mm256_permute4x64_epi64(b, SIMDE_MM_SHUFFLE(2, 1, 0, 3));
+      bit = simde_mm256_permute4x64_epi64(bit, SIMDE_MM_SHUFFLE(2, 1, 0, 3));
+    }
+
+    return r;
+  #else
+    simde__m256i_private
+      a_ = simde__m256i_to_private(a),
+      b_ = simde__m256i_to_private(b),
+      r_;
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+      r_.m128i[i] =
+        simde_mm_or_si128(
+          simde_x_mm_conflict_cross_epi64(a_.m128i[i], b_.m128i[0]),
+          simde_mm_slli_epi64(simde_x_mm_conflict_cross_epi64(a_.m128i[i], b_.m128i[1]), 2)
+        );
+    }
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m128i
 simde_mm_conflict_epi32 (simde__m128i a) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512CD_NATIVE)
     return _mm_conflict_epi32(a);
   #else
-    simde__m128i_private
-      r_ = simde__m128i_to_private(simde_mm_setzero_si128()),
-      a_ = simde__m128i_to_private(a);
-
-    for (size_t i = 1 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
-      r_.i32[i] =
-          simde_mm_movemask_ps(
-            simde_mm_castsi128_ps(
-              simde_mm_cmpeq_epi32(simde_mm_set1_epi32(a_.i32[i]), a)
-            )
-          ) & ((1 << i) - 1);
+    simde__m128i
+      r = simde_mm_setzero_si128(),
+      b = a,
+      bit = simde_mm_setr_epi32(1, 2, 4, 8);
+
+    for (int s = 1 ; s < 4 ; s++) {
+      b = simde_mm_shuffle_epi32(b, SIMDE_MM_SHUFFLE(2, 1, 0, 3));
+      bit = simde_mm_srli_epi32(bit, 1);
+      r = simde_mm_or_si128(r, simde_mm_and_si128(simde_mm_cmpeq_epi32(a, b), bit));
     }
 
-    return simde__m128i_from_private(r_);
+    return r;
   #endif
 }
 #if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512CD_ENABLE_NATIVE_ALIASES)
@@ -71,19 +176,31 @@ simde__m256i
 simde_mm256_conflict_epi32 (simde__m256i a) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512CD_NATIVE)
     return _mm256_conflict_epi32(a);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    const simde__m256i rot = simde_mm256_setr_epi32(7, 0, 1, 2, 3, 4, 5, 6);
+    simde__m256i
+      r = simde_mm256_setzero_si256(),
+      b = a,
+      bit = simde_mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+
+    for (int s = 1 ; s < 8 ; s++) {
+      b = simde_mm256_permutevar8x32_epi32(b, rot);
+      bit = simde_mm256_srli_epi32(bit, 1);
+      r = simde_mm256_or_si256(r, simde_mm256_and_si256(simde_mm256_cmpeq_epi32(a, b), bit));
+    }
+
+    return r;
   #else
     simde__m256i_private
-      r_ = simde__m256i_to_private(simde_mm256_setzero_si256()),
+      r_,
       a_ = simde__m256i_to_private(a);
 
-    for (size_t i = 1 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
-      r_.i32[i] =
-          simde_mm256_movemask_ps(
-            simde_mm256_castsi256_ps(
-              simde_mm256_cmpeq_epi32(simde_mm256_set1_epi32(a_.i32[i]), a)
-            )
-          ) & ((1 << i) - 1);
-    }
+    r_.m128i[0] = simde_mm_conflict_epi32(a_.m128i[0]);
+    r_.m128i[1] =
+      simde_mm_or_si128(
+        simde_mm_slli_epi32(simde_mm_conflict_epi32(a_.m128i[1]), 4),
+        simde_x_mm_conflict_cross_epi32(a_.m128i[1], a_.m128i[0])
+      );
 
     return simde__m256i_from_private(r_);
   #endif
@@ -128,16 +245,15 @@ simde_mm512_conflict_epi32 (simde__m512i a) {
     return _mm512_conflict_epi32(a);
   #else
     simde__m512i_private
-      r_ = simde__m512i_to_private(simde_mm512_setzero_si512()),
+      r_,
       a_ = simde__m512i_to_private(a);
 
-    for (size_t i = 1 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
-      r_.i32[i] =
-        HEDLEY_STATIC_CAST(
-          int32_t,
-          simde_mm512_cmpeq_epi32_mask(simde_mm512_set1_epi32(a_.i32[i]), a)
-        ) & ((1 << i) - 1);
-    }
+    r_.m256i[0] = simde_mm256_conflict_epi32(a_.m256i[0]);
+    r_.m256i[1] =
+      simde_mm256_or_si256(
+        simde_mm256_slli_epi32(simde_mm256_conflict_epi32(a_.m256i[1]), 8),
+        simde_x_mm256_conflict_cross_epi32(a_.m256i[1], a_.m256i[0])
+      );
 
     return simde__m512i_from_private(r_);
   #endif
@@ -181,23 +297,11 @@ simde_mm_conflict_epi64 (simde__m128i a) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512CD_NATIVE)
     return _mm_conflict_epi64(a);
   #else
-    simde__m128i_private
-      r_ = simde__m128i_to_private(simde_mm_setzero_si128()),
-      a_ = simde__m128i_to_private(a);
-
-    for (size_t i = 1 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
-      r_.i64[i] =
-        HEDLEY_STATIC_CAST(
-          int64_t,
-          simde_mm_movemask_pd(
-            simde_mm_castsi128_pd(
-              simde_mm_cmpeq_epi64(simde_mm_set1_epi64x(a_.i64[i]), a)
-            )
-          )
-        ) & ((1 << i) - 1);
-    }
-
-    return simde__m128i_from_private(r_);
+    return
+      simde_mm_and_si128(
+        simde_mm_cmpeq_epi64(a, simde_mm_shuffle_epi32(a, SIMDE_MM_SHUFFLE(1, 0, 3, 2))),
+        simde_mm_set_epi64x(1, 0)
+      );
   #endif
 }
 #if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512CD_ENABLE_NATIVE_ALIASES)
@@ -238,22 +342,30 @@ simde__m256i
 simde_mm256_conflict_epi64 (simde__m256i a) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512CD_NATIVE)
     return _mm256_conflict_epi64(a);
+  #elif defined(SIMDE_X86_AVX2_NATIVE)
+    simde__m256i
+      r = simde_mm256_setzero_si256(),
+      b = a,
+      bit = simde_mm256_setr_epi64x(1, 2, 4, 8);
+
+    for (int s = 1 ; s < 4 ; s++) {
+      b = simde_mm256_permute4x64_epi64(b, SIMDE_MM_SHUFFLE(2, 1, 0, 3));
+      bit = simde_mm256_srli_epi64(bit, 1);
+      r = simde_mm256_or_si256(r, simde_mm256_and_si256(simde_mm256_cmpeq_epi64(a, b), bit));
+    }
+
+    return r;
   #else
     simde__m256i_private
-      r_ = simde__m256i_to_private(simde_mm256_setzero_si256()),
+      r_,
       a_ = simde__m256i_to_private(a);
 
-    for (size_t i = 1 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
-      r_.i64[i] =
-        HEDLEY_STATIC_CAST(
-          int64_t,
-          simde_mm256_movemask_pd(
-            simde_mm256_castsi256_pd(
-              simde_mm256_cmpeq_epi64(simde_mm256_set1_epi64x(a_.i64[i]), a)
-            )
-          )
-        ) & ((1 << i) - 1);
-    }
+    r_.m128i[0] = simde_mm_conflict_epi64(a_.m128i[0]);
+    r_.m128i[1] =
+      simde_mm_or_si128(
+        simde_mm_slli_epi64(simde_mm_conflict_epi64(a_.m128i[1]), 2),
+        simde_x_mm_conflict_cross_epi64(a_.m128i[1], a_.m128i[0])
+      );
 
     return simde__m256i_from_private(r_);
   #endif
@@ -298,16 +410,15 @@ simde_mm512_conflict_epi64 (simde__m512i a) {
     return _mm512_conflict_epi64(a);
   #else
     simde__m512i_private
-      r_ = simde__m512i_to_private(simde_mm512_setzero_si512()),
+      r_,
       a_ = simde__m512i_to_private(a);
 
-    for (size_t i = 1 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
-      r_.i64[i] =
-        HEDLEY_STATIC_CAST(
-          int64_t,
-          simde_mm512_cmpeq_epi64_mask(simde_mm512_set1_epi64(a_.i64[i]), a)
-        ) & ((1 << i) - 1);
-    }
+    r_.m256i[0] = simde_mm256_conflict_epi64(a_.m256i[0]);
+    r_.m256i[1] =
+      simde_mm256_or_si256(
+        simde_mm256_slli_epi64(simde_mm256_conflict_epi64(a_.m256i[1]), 4),
+        simde_x_mm256_conflict_cross_epi64(a_.m256i[1], a_.m256i[0])
+      );
 
     return simde__m512i_from_private(r_);
   #endif
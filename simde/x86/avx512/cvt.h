@@ -32,7 +32,12 @@
 
 #include "types.h"
 #include "mov.h"
+#include "cast.h"
+#include "slli.h"
+#include "extract.h"
+#include "../f16c.h"
 #include "../../simde-f16.h"
+#include "../../simde-bf16.h"
 
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
@@ -396,6 +401,728 @@ simde_mm512_cvtps_epi32(simde__m512 a) {
   #define _mm512_cvtps_epi32(a) simde_mm512_cvtps_epi32(a)
 #endif
 
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm512_cvtps_ph(simde__m512 a, const int imm8) {
+  simde__m512_private a_ = simde__m512_to_private(a);
+  simde__m256i_private r_;
+
+  HEDLEY_STATIC_CAST(void, imm8);
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; i++) {
+    r_.u16[i] = simde_float16_as_uint16(simde_float16_from_float32(a_.f32[i]));
+  }
+
+  return simde__m256i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_cvtps_ph(a, imm8) _mm512_cvtps_ph(a, imm8)
+#elif defined(SIMDE_X86_F16C_NATIVE)
+  #define simde_mm512_cvtps_ph(a, imm8) \
+    simde_mm256_setr_m128i( \
+      _mm256_cvtps_ph(simde_mm512_castps512_ps256(a), imm8), \
+      _mm256_cvtps_ph(simde_mm512_extractf32x8_ps(a, 1), imm8))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_cvtps_ph
+  #define _mm512_cvtps_ph(a, imm8) simde_mm512_cvtps_ph(a, imm8)
+#endif
+
+/* AVX512-FP16 conversions between binary16 and binary32.  Without
+ * native FP16 support these are the F16C conversions (which is what
+ * the other _ph emulations are built on: widen to binary32, compute,
+ * then narrow back with a single rounding). */
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_cvtxph_ps (simde__m128h a) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_cvtxph_ps(a);
+  #else
+    return simde_mm_cvtph_ps(simde_mm_castph_si128(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cvtxph_ps
+  #define _mm_cvtxph_ps(a) simde_mm_cvtxph_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_cvtxph_ps (simde__m128h a) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_cvtxph_ps(a);
+  #else
+    return simde_mm256_cvtph_ps(simde_mm_castph_si128(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_cvtxph_ps
+  #define _mm256_cvtxph_ps(a) simde_mm256_cvtxph_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_cvtxph_ps (simde__m256h a) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE)
+    return _mm512_cvtxph_ps(a);
+  #else
+    return simde_mm512_cvtph_ps(simde_mm256_castph_si256(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_cvtxph_ps
+  #define _mm512_cvtxph_ps(a) simde_mm512_cvtxph_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128h
+simde_mm_cvtxps_ph (simde__m128 a) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_cvtxps_ph(a);
+  #else
+    return simde_mm_castsi128_ph(simde_mm_cvtps_ph(a, SIMDE_MM_FROUND_CUR_DIRECTION));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cvtxps_ph
+  #define _mm_cvtxps_ph(a) simde_mm_cvtxps_ph(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128h
+simde_mm256_cvtxps_ph (simde__m256 a) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_cvtxps_ph(a);
+  #else
+    return simde_mm_castsi128_ph(simde_mm256_cvtps_ph(a, SIMDE_MM_FROUND_CUR_DIRECTION));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_cvtxps_ph
+  #define _mm256_cvtxps_ph(a) simde_mm256_cvtxps_ph(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256h
+simde_mm512_cvtxps_ph (simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE)
+    return _mm512_cvtxps_ph(a);
+  #else
+    return simde_mm256_castsi256_ph(simde_mm512_cvtps_ph(a, SIMDE_MM_FROUND_CUR_DIRECTION));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_cvtxps_ph
+  #define _mm512_cvtxps_ph(a) simde_mm512_cvtxps_ph(a)
+#endif
+
+/* binary16 -> int16 goes through int32; every finite binary16 fits,
+ * but values above INT16_MAX (and Inf/NaN, which are already INT32_MIN)
+ * have to become the integer indefinite value 0x8000 rather than being
+ * saturated, so the sign bit of INT16_MAX - x is ORed in before packing. */
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_x_mm256_cvtph_epi16_indefinite_ (simde__m256i x) {
+  return simde_mm256_or_si256(x, simde_mm256_and_si256(simde_mm256_sub_epi32(simde_mm256_set1_epi32(INT16_MAX), x), simde_mm256_set1_epi32(INT32_MIN)));
+}
+
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_cvtph_epi16 (simde__m128h a) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_cvtph_epi16(a);
+  #else
+    simde__m256i_private x_ = simde__m256i_to_private(simde_x_mm256_cvtph_epi16_indefinite_(simde_mm256_cvtps_epi32(simde_mm256_cvtxph_ps(a))));
+
+    return simde_mm_packs_epi32(x_.m128i[0], x_.m128i[1]);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cvtph_epi16
+  #define _mm_cvtph_epi16(a) simde_mm_cvtph_epi16(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_cvtph_epi16 (simde__m256h a) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_cvtph_epi16(a);
+  #elif defined(SIMDE_X86_AVX512F_NATIVE)
+    __m512i x = _mm512_cvtps_epi32(simde_mm512_cvtxph_ps(a));
+    x = _mm512_mask_mov_epi32(x, _mm512_cmpgt_epi32_mask(x, _mm512_set1_epi32(INT16_MAX)), _mm512_set1_epi32(INT32_MIN));
+    return _mm512_cvtsepi32_epi16(x);
+  #else
+    simde__m512i_private x_ = simde__m512i_to_private(simde_mm512_cvtps_epi32(simde_mm512_cvtxph_ps(a)));
+
+    return simde_mm256_permute4x64_epi64(
+      simde_mm256_packs_epi32(
+        simde_x_mm256_cvtph_epi16_indefinite_(x_.m256i[0]),
+        simde_x_mm256_cvtph_epi16_indefinite_(x_.m256i[1])
+      ),
+      SIMDE_MM_SHUFFLE(3, 1, 2, 0)
+    );
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_cvtph_epi16
+  #define _mm256_cvtph_epi16(a) simde_mm256_cvtph_epi16(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_cvtph_epi16 (simde__m512h a) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE)
+    return _mm512_cvtph_epi16(a);
+  #else
+    simde__m512h_private a_ = simde__m512h_to_private(a);
+    simde__m512i_private r_;
+
+    for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+      r_.m256i[i] = simde_mm256_cvtph_epi16(a_.m256h[i]);
+    }
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_cvtph_epi16
+  #define _mm512_cvtph_epi16(a) simde_mm512_cvtph_epi16(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128h
+simde_mm_cvtepi16_ph (simde__m128i a) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_cvtepi16_ph(a);
+  #else
+    return simde_mm256_cvtxps_ph(simde_mm256_cvtepi32_ps(simde_mm256_cvtepi16_epi32(a)));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cvtepi16_ph
+  #define _mm_cvtepi16_ph(a) simde_mm_cvtepi16_ph(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256h
+simde_mm256_cvtepi16_ph (simde__m256i a) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_cvtepi16_ph(a);
+  #else
+    return simde_mm512_cvtxps_ph(simde_mm512_cvtepi32_ps(simde_mm512_cvtepi16_epi32(a)));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_cvtepi16_ph
+  #define _mm256_cvtepi16_ph(a) simde_mm256_cvtepi16_ph(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512h
+simde_mm512_cvtepi16_ph (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE)
+    return _mm512_cvtepi16_ph(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    simde__m512h_private r_;
+
+    for (size_t i = 0 ; i < (sizeof(r_.m256h) / sizeof(r_.m256h[0])) ; i++) {
+      r_.m256h[i] = simde_mm256_cvtepi16_ph(a_.m256i[i]);
+    }
+
+    return simde__m512h_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_cvtepi16_ph
+  #define _mm512_cvtepi16_ph(a) simde_mm512_cvtepi16_ph(a)
+#endif
+
+/* BF16 conversions.  VCVTNEPS2BF16 rounds to nearest-even, treats
+ * denormal inputs as zero and turns NaNs into quiet NaNs; the rounding
+ * is done with integer ops on the binary32 bits (add 0x7FFF plus the
+ * LSB of the result, then take the upper half) so it vectorizes on
+ * everything, and narrowing is a pack. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_mm_cvtneps_pbh_epi32 (simde__m128 a) {
+  /* Returns the bfloat16 sign-extended to 32 bits, ready for packs. */
+  const simde__m128i
+    x = simde_mm_castps_si128(a),
+    nan = simde_mm_cmpgt_epi32(simde_mm_and_si128(x, simde_mm_set1_epi32(INT32_C(0x7FFFFFFF))), simde_mm_set1_epi32(INT32_C(0x7F800000))),
+    daz = simde_mm_cmpeq_epi32(simde_mm_and_si128(x, simde_mm_set1_epi32(INT32_C(0x7F800000))), simde_mm_setzero_si128()),
+    y = simde_mm_andnot_si128(simde_mm_srli_epi32(daz, 1), x),
+    r = simde_mm_add_epi32(y, simde_mm_add_epi32(simde_mm_set1_epi32(INT32_C(0x7FFF)), simde_mm_and_si128(simde_mm_srli_epi32(y, 16), simde_mm_set1_epi32(1))));
+
+  return simde_mm_srai_epi32(
+    simde_mm_or_si128(
+      simde_mm_andnot_si128(nan, r),
+      simde_mm_and_si128(nan, simde_mm_or_si128(x, simde_mm_set1_epi32(INT32_C(0x00400000))))
+    ),
+    16
+  );
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_mm256_cvtneps_pbh_epi16 (simde__m256 a) {
+  simde__m256_private a_ = simde__m256_to_private(a);
+
+  return simde_mm_packs_epi32(simde_x_mm_cvtneps_pbh_epi32(a_.m128[0]), simde_x_mm_cvtneps_pbh_epi32(a_.m128[1]));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_x_mm512_cvtneps_pbh_epi16 (simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    const __m512i x = _mm512_castps_si512(a);
+    const __mmask16
+      nan = _mm512_cmpgt_epi32_mask(_mm512_and_si512(x, _mm512_set1_epi32(INT32_C(0x7FFFFFFF))), _mm512_set1_epi32(INT32_C(0x7F800000))),
+      daz = _mm512_testn_epi32_mask(x, _mm512_set1_epi32(INT32_C(0x7F800000)));
+    __m512i y = _mm512_mask_and_epi32(x, daz, x, _mm512_set1_epi32(~INT32_C(0x7FFFFFFF)));
+    y = _mm512_add_epi32(y, _mm512_add_epi32(_mm512_set1_epi32(INT32_C(0x7FFF)), _mm512_and_si512(_mm512_srli_epi32(y, 16), _mm512_set1_epi32(1))));
+    y = _mm512_mask_or_epi32(y, nan, x, _mm512_set1_epi32(INT32_C(0x00400000)));
+    return _mm512_cvtepi32_epi16(_mm512_srli_epi32(y, 16));
+  #else
+    simde__m512_private a_ = simde__m512_to_private(a);
+    simde__m256i_private r_;
+
+    r_.m128i[0] = simde_mm_packs_epi32(simde_x_mm_cvtneps_pbh_epi32(a_.m128[0]), simde_x_mm_cvtneps_pbh_epi32(a_.m128[1]));
+    r_.m128i[1] = simde_mm_packs_epi32(simde_x_mm_cvtneps_pbh_epi32(a_.m128[2]), simde_x_mm_cvtneps_pbh_epi32(a_.m128[3]));
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128bh
+simde_mm_cvtne2ps_pbh (simde__m128 a, simde__m128 b) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_cvtne2ps_pbh(a, b);
+  #else
+    return simde_x_mm_castsi128_pbh(simde_mm_packs_epi32(simde_x_mm_cvtneps_pbh_epi32(b), simde_x_mm_cvtneps_pbh_epi32(a)));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cvtne2ps_pbh
+  #define _mm_cvtne2ps_pbh(a, b) simde_mm_cvtne2ps_pbh(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128bh
+simde_mm_mask_cvtne2ps_pbh (simde__m128bh src, simde__mmask8 k, simde__m128 a, simde__m128 b) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_cvtne2ps_pbh(src, k, a, b);
+  #else
+    return simde_x_mm_castsi128_pbh(simde_mm_mask_mov_epi16(simde_x_mm_castpbh_si128(src), k, simde_x_mm_castpbh_si128(simde_mm_cvtne2ps_pbh(a, b))));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_cvtne2ps_pbh
+  #define _mm_mask_cvtne2ps_pbh(src, k, a, b) simde_mm_mask_cvtne2ps_pbh(src, k, a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128bh
+simde_mm_maskz_cvtne2ps_pbh (simde__mmask8 k, simde__m128 a, simde__m128 b) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_cvtne2ps_pbh(k, a, b);
+  #else
+    return simde_x_mm_castsi128_pbh(simde_mm_maskz_mov_epi16(k, simde_x_mm_castpbh_si128(simde_mm_cvtne2ps_pbh(a, b))));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_cvtne2ps_pbh
+  #define _mm_maskz_cvtne2ps_pbh(k, a, b) simde_mm_maskz_cvtne2ps_pbh(k, a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256bh
+simde_mm256_cvtne2ps_pbh (simde__m256 a, simde__m256 b) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_cvtne2ps_pbh(a, b);
+  #else
+    simde__m256i_private r_;
+
+    r_.m128i[0] = simde_x_mm256_cvtneps_pbh_epi16(b);
+    r_.m128i[1] = simde_x_mm256_cvtneps_pbh_epi16(a);
+
+    return simde_x_mm256_castsi256_pbh(simde__m256i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_cvtne2ps_pbh
+  #define _mm256_cvtne2ps_pbh(a, b) simde_mm256_cvtne2ps_pbh(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256bh
+simde_mm256_mask_cvtne2ps_pbh (simde__m256bh src, simde__mmask16 k, simde__m256 a, simde__m256 b) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_cvtne2ps_pbh(src, k, a, b);
+  #else
+    return simde_x_mm256_castsi256_pbh(simde_mm256_mask_mov_epi16(simde_x_mm256_castpbh_si256(src), k, simde_x_mm256_castpbh_si256(simde_mm256_cvtne2ps_pbh(a, b))));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_cvtne2ps_pbh
+  #define _mm256_mask_cvtne2ps_pbh(src, k, a, b) simde_mm256_mask_cvtne2ps_pbh(src, k, a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256bh
+simde_mm256_maskz_cvtne2ps_pbh (simde__mmask16 k, simde__m256 a, simde__m256 b) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_cvtne2ps_pbh(k, a, b);
+  #else
+    return simde_x_mm256_castsi256_pbh(simde_mm256_maskz_mov_epi16(k, simde_x_mm256_castpbh_si256(simde_mm256_cvtne2ps_pbh(a, b))));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_cvtne2ps_pbh
+  #define _mm256_maskz_cvtne2ps_pbh(k, a, b) simde_mm256_maskz_cvtne2ps_pbh(k, a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512bh
+simde_mm512_cvtne2ps_pbh (simde__m512 a, simde__m512 b) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE)
+    return _mm512_cvtne2ps_pbh(a, b);
+  #else
+    simde__m512i_private r_;
+
+    r_.m256i[0] = simde_x_mm512_cvtneps_pbh_epi16(b);
+    r_.m256i[1] = simde_x_mm512_cvtneps_pbh_epi16(a);
+
+    return simde_x_mm512_castsi512_pbh(simde__m512i_from_private(r_));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_cvtne2ps_pbh
+  #define _mm512_cvtne2ps_pbh(a, b) simde_mm512_cvtne2ps_pbh(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512bh
+simde_mm512_mask_cvtne2ps_pbh (simde__m512bh src, simde__mmask32 k, simde__m512 a, simde__m512 b) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE)
+    return _mm512_mask_cvtne2ps_pbh(src, k, a, b);
+  #else
+    return simde_x_mm512_castsi512_pbh(simde_mm512_mask_mov_epi16(simde_x_mm512_castpbh_si512(src), k, simde_x_mm512_castpbh_si512(simde_mm512_cvtne2ps_pbh(a, b))));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_cvtne2ps_pbh
+  #define _mm512_mask_cvtne2ps_pbh(src, k, a, b) simde_mm512_mask_cvtne2ps_pbh(src, k, a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512bh
+simde_mm512_maskz_cvtne2ps_pbh (simde__mmask32 k, simde__m512 a, simde__m512 b) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE)
+    return _mm512_maskz_cvtne2ps_pbh(k, a, b);
+  #else
+    return simde_x_mm512_castsi512_pbh(simde_mm512_maskz_mov_epi16(k, simde_x_mm512_castpbh_si512(simde_mm512_cvtne2ps_pbh(a, b))));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_cvtne2ps_pbh
+  #define _mm512_maskz_cvtne2ps_pbh(k, a, b) simde_mm512_maskz_cvtne2ps_pbh(k, a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128bh
+simde_mm_cvtneps_pbh (simde__m128 a) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_cvtneps_pbh(a);
+  #else
+    return simde_x_mm_castsi128_pbh(simde_mm_packs_epi32(simde_x_mm_cvtneps_pbh_epi32(a), simde_mm_setzero_si128()));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cvtneps_pbh
+  #define _mm_cvtneps_pbh(a) simde_mm_cvtneps_pbh(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128bh
+simde_mm_mask_cvtneps_pbh (simde__m128bh src, simde__mmask8 k, simde__m128 a) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_cvtneps_pbh(src, k, a);
+  #else
+    /* Only the low four elements are written; the upper half is zeroed. */
+    return simde_x_mm_castsi128_pbh(simde_mm_move_epi64(simde_mm_mask_mov_epi16(simde_x_mm_castpbh_si128(src), k, simde_x_mm_castpbh_si128(simde_mm_cvtneps_pbh(a)))));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_cvtneps_pbh
+  #define _mm_mask_cvtneps_pbh(src, k, a) simde_mm_mask_cvtneps_pbh(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128bh
+simde_mm_maskz_cvtneps_pbh (simde__mmask8 k, simde__m128 a) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_cvtneps_pbh(k, a);
+  #else
+    return simde_x_mm_castsi128_pbh(simde_mm_maskz_mov_epi16(k, simde_x_mm_castpbh_si128(simde_mm_cvtneps_pbh(a))));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_cvtneps_pbh
+  #define _mm_maskz_cvtneps_pbh(k, a) simde_mm_maskz_cvtneps_pbh(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128bh
+simde_mm256_cvtneps_pbh (simde__m256 a) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_cvtneps_pbh(a);
+  #else
+    return simde_x_mm_castsi128_pbh(simde_x_mm256_cvtneps_pbh_epi16(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_cvtneps_pbh
+  #define _mm256_cvtneps_pbh(a) simde_mm256_cvtneps_pbh(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128bh
+simde_mm256_mask_cvtneps_pbh (simde__m128bh src, simde__mmask8 k, simde__m256 a) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_cvtneps_pbh(src, k, a);
+  #else
+    return simde_x_mm_castsi128_pbh(simde_mm_mask_mov_epi16(simde_x_mm_castpbh_si128(src), k, simde_x_mm256_cvtneps_pbh_epi16(a)));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_cvtneps_pbh
+  #define _mm256_mask_cvtneps_pbh(src, k, a) simde_mm256_mask_cvtneps_pbh(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128bh
+simde_mm256_maskz_cvtneps_pbh (simde__mmask8 k, simde__m256 a) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_cvtneps_pbh(k, a);
+  #else
+    return simde_x_mm_castsi128_pbh(simde_mm_maskz_mov_epi16(k, simde_x_mm256_cvtneps_pbh_epi16(a)));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_cvtneps_pbh
+  #define _mm256_maskz_cvtneps_pbh(k, a) simde_mm256_maskz_cvtneps_pbh(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256bh
+simde_mm512_cvtneps_pbh (simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE)
+    return _mm512_cvtneps_pbh(a);
+  #else
+    return simde_x_mm256_castsi256_pbh(simde_x_mm512_cvtneps_pbh_epi16(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_cvtneps_pbh
+  #define _mm512_cvtneps_pbh(a) simde_mm512_cvtneps_pbh(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256bh
+simde_mm512_mask_cvtneps_pbh (simde__m256bh src, simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE)
+    return _mm512_mask_cvtneps_pbh(src, k, a);
+  #else
+    return simde_x_mm256_castsi256_pbh(simde_mm256_mask_mov_epi16(simde_x_mm256_castpbh_si256(src), k, simde_x_mm512_cvtneps_pbh_epi16(a)));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_cvtneps_pbh
+  #define _mm512_mask_cvtneps_pbh(src, k, a) simde_mm512_mask_cvtneps_pbh(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256bh
+simde_mm512_maskz_cvtneps_pbh (simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE)
+    return _mm512_maskz_cvtneps_pbh(k, a);
+  #else
+    return simde_x_mm256_castsi256_pbh(simde_mm256_maskz_mov_epi16(k, simde_x_mm512_cvtneps_pbh_epi16(a)));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_cvtneps_pbh
+  #define _mm512_maskz_cvtneps_pbh(k, a) simde_mm512_maskz_cvtneps_pbh(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_bfloat16
+simde_mm_cvtness_sbh (simde_float32 a) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return simde_uint16_as_bfloat16(HEDLEY_STATIC_CAST(uint16_t, _mm_extract_epi16(simde_x_mm_castpbh_si128(_mm_cvtneps_pbh(_mm_set_ss(a))), 0)));
+  #else
+    uint32_t x = simde_float32_as_uint32(a);
+
+    if ((x & UINT32_C(0x7FFFFFFF)) > UINT32_C(0x7F800000))
+      return simde_uint16_as_bfloat16(HEDLEY_STATIC_CAST(uint16_t, (x >> 16) | UINT32_C(0x0040)));
+
+    if ((x & UINT32_C(0x7F800000)) == 0)
+      x &= UINT32_C(0x80000000);
+    x += UINT32_C(0x7FFF) + ((x >> 16) & 1);
+
+    return simde_uint16_as_bfloat16(HEDLEY_STATIC_CAST(uint16_t, x >> 16));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cvtness_sbh
+  #define _mm_cvtness_sbh(a) simde_mm_cvtness_sbh(a)
+#endif
+
+/* Widening is exact: the bfloat16 just becomes the upper half of the
+ * binary32. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm_cvtsbh_ss (simde_bfloat16 a) {
+  return simde_uint32_as_float32(HEDLEY_STATIC_CAST(uint32_t, simde_bfloat16_as_uint16(a)) << 16);
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cvtsbh_ss
+  #define _mm_cvtsbh_ss(a) simde_mm_cvtsbh_ss(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_cvtpbh_ps (simde__m128bh a) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_cvtpbh_ps(a);
+  #else
+    return simde_mm_castsi128_ps(simde_mm_unpacklo_epi16(simde_mm_setzero_si128(), simde_x_mm_castpbh_si128(a)));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cvtpbh_ps
+  #define _mm_cvtpbh_ps(a) simde_mm_cvtpbh_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_mask_cvtpbh_ps (simde__m128 src, simde__mmask8 k, simde__m128bh a) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_cvtpbh_ps(src, k, a);
+  #else
+    return simde_mm_mask_mov_ps(src, k, simde_mm_cvtpbh_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_cvtpbh_ps
+  #define _mm_mask_cvtpbh_ps(src, k, a) simde_mm_mask_cvtpbh_ps(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_maskz_cvtpbh_ps (simde__mmask8 k, simde__m128bh a) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_cvtpbh_ps(k, a);
+  #else
+    return simde_mm_maskz_mov_ps(k, simde_mm_cvtpbh_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_cvtpbh_ps
+  #define _mm_maskz_cvtpbh_ps(k, a) simde_mm_maskz_cvtpbh_ps(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_cvtpbh_ps (simde__m128bh a) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_cvtpbh_ps(a);
+  #else
+    return simde_mm256_castsi256_ps(simde_mm256_slli_epi32(simde_mm256_cvtepu16_epi32(simde_x_mm_castpbh_si128(a)), 16));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_cvtpbh_ps
+  #define _mm256_cvtpbh_ps(a) simde_mm256_cvtpbh_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_mask_cvtpbh_ps (simde__m256 src, simde__mmask8 k, simde__m128bh a) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_cvtpbh_ps(src, k, a);
+  #else
+    return simde_mm256_mask_mov_ps(src, k, simde_mm256_cvtpbh_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_cvtpbh_ps
+  #define _mm256_mask_cvtpbh_ps(src, k, a) simde_mm256_mask_cvtpbh_ps(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_maskz_cvtpbh_ps (simde__mmask8 k, simde__m128bh a) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_cvtpbh_ps(k, a);
+  #else
+    return simde_mm256_maskz_mov_ps(k, simde_mm256_cvtpbh_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_cvtpbh_ps
+  #define _mm256_maskz_cvtpbh_ps(k, a) simde_mm256_maskz_cvtpbh_ps(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_cvtpbh_ps (simde__m256bh a) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE)
+    return _mm512_cvtpbh_ps(a);
+  #else
+    return simde_mm512_castsi512_ps(simde_mm512_slli_epi32(simde_mm512_cvtepu16_epi32(simde_x_mm256_castpbh_si256(a)), 16));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_cvtpbh_ps
+  #define _mm512_cvtpbh_ps(a) simde_mm512_cvtpbh_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_cvtpbh_ps (simde__m512 src, simde__mmask16 k, simde__m256bh a) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE)
+    return _mm512_mask_cvtpbh_ps(src, k, a);
+  #else
+    return simde_mm512_mask_mov_ps(src, k, simde_mm512_cvtpbh_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_cvtpbh_ps
+  #define _mm512_mask_cvtpbh_ps(src, k, a) simde_mm512_mask_cvtpbh_ps(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_cvtpbh_ps (simde__mmask16 k, simde__m256bh a) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE)
+    return _mm512_maskz_cvtpbh_ps(k, a);
+  #else
+    return simde_mm512_maskz_mov_ps(k, simde_mm512_cvtpbh_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_cvtpbh_ps
+  #define _mm512_maskz_cvtpbh_ps(k, a) simde_mm512_maskz_cvtpbh_ps(k, a)
+#endif
+
 SIMDE_END_DECLS_
 HEDLEY_DIAGNOSTIC_POP
 
@@ -20,7 +20,18 @@ simde_mm_dpbf16_ps (simde__m128 src, simde__m128bh a, simde__m128bh b) {
       a_ = simde__m128bh_to_private(a),
       b_ = simde__m128bh_to_private(b);
 
-    #if ! ( defined(SIMDE_ARCH_X86) && defined(HEDLEY_GCC_VERSION) ) && defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR) && defined(SIMDE_CONVERT_VECTOR_) && defined(SIMDE_SHUFFLE_VECTOR_)
+    #if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      /* Widening bf16 to binary32 is just a shift, so both halves of
+       * each 32-bit lane can be widened in place.  Products of two bf16
+       * values are exact in binary32; the odd pair is accumulated first,
+       * like VDPBF16PS does. */
+      src_.f32 +=
+        HEDLEY_REINTERPRET_CAST(__typeof__(src_.f32), (a_.u32 >> 16) << 16) *
+        HEDLEY_REINTERPRET_CAST(__typeof__(src_.f32), (b_.u32 >> 16) << 16);
+      src_.f32 +=
+        HEDLEY_REINTERPRET_CAST(__typeof__(src_.f32), a_.u32 << 16) *
+        HEDLEY_REINTERPRET_CAST(__typeof__(src_.f32), b_.u32 << 16);
+    #elif ! ( defined(SIMDE_ARCH_X86) && defined(HEDLEY_GCC_VERSION) ) && defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR) && defined(SIMDE_CONVERT_VECTOR_) && defined(SIMDE_SHUFFLE_VECTOR_)
       uint32_t x1 SIMDE_VECTOR(32);
       uint32_t x2 SIMDE_VECTOR(32);
       simde__m128_private
@@ -109,7 +120,14 @@ simde_mm256_dpbf16_ps (simde__m256 src, simde__m256bh a, simde__m256bh b) {
       a_ = simde__m256bh_to_private(a),
       b_ = simde__m256bh_to_private(b);
 
-    #if ! ( defined(SIMDE_ARCH_X86) && defined(HEDLEY_GCC_VERSION) ) && defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR) && defined(SIMDE_CONVERT_VECTOR_) && defined(SIMDE_SHUFFLE_VECTOR_)
+    #if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      src_.f32 +=
+        HEDLEY_REINTERPRET_CAST(__typeof__(src_.f32), (a_.u32 >> 16) << 16) *
+        HEDLEY_REINTERPRET_CAST(__typeof__(src_.f32), (b_.u32 >> 16) << 16);
+      src_.f32 +=
+        HEDLEY_REINTERPRET_CAST(__typeof__(src_.f32), a_.u32 << 16) *
+        HEDLEY_REINTERPRET_CAST(__typeof__(src_.f32), b_.u32 << 16);
+    #elif ! ( defined(SIMDE_ARCH_X86) && defined(HEDLEY_GCC_VERSION) ) && defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR) && defined(SIMDE_CONVERT_VECTOR_) && defined(SIMDE_SHUFFLE_VECTOR_)
       uint32_t x1 SIMDE_VECTOR(64);
       uint32_t x2 SIMDE_VECTOR(64);
       simde__m256_private
@@ -198,7 +216,14 @@ simde_mm512_dpbf16_ps (simde__m512 src, simde__m512bh a, simde__m512bh b) {
       a_ = simde__m512bh_to_private(a),
       b_ = simde__m512bh_to_private(b);
 
-    #if ! ( defined(SIMDE_ARCH_X86) && defined(HEDLEY_GCC_VERSION) ) && defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR) && defined(SIMDE_CONVERT_VECTOR_) && defined(SIMDE_SHUFFLE_VECTOR_)
+    #if defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      src_.f32 +=
+        HEDLEY_REINTERPRET_CAST(__typeof__(src_.f32), (a_.u32 >> 16) << 16) *
+        HEDLEY_REINTERPRET_CAST(__typeof__(src_.f32), (b_.u32 >> 16) << 16);
+      src_.f32 +=
+        HEDLEY_REINTERPRET_CAST(__typeof__(src_.f32), a_.u32 << 16) *
+        HEDLEY_REINTERPRET_CAST(__typeof__(src_.f32), b_.u32 << 16);
+    #elif ! ( defined(SIMDE_ARCH_X86) && defined(HEDLEY_GCC_VERSION) ) && defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR) && defined(SIMDE_CONVERT_VECTOR_) && defined(SIMDE_SHUFFLE_VECTOR_)
       uint32_t x1 SIMDE_VECTOR(128);
       uint32_t x2 SIMDE_VECTOR(128);
       simde__m512_private
@@ -13,12 +13,25 @@ simde__m128i
 simde_mm_dpbusd_epi32(simde__m128i src, simde__m128i a, simde__m128i b) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512VNNI_NATIVE)
     return _mm_dpbusd_epi32(src, a, b);
+  #elif defined(SIMDE_X86_AVXVNNI_NATIVE)
+    return _mm_dpbusd_avx_epi32(src, a, b);
   #else
     simde__m128i_private
       src_ = simde__m128i_to_private(src),
       a_ = simde__m128i_to_private(a),
       b_ = simde__m128i_to_private(b);
-    #if defined(SIMDE_SHUFFLE_VECTOR_) && defined(SIMDE_CONVERT_VECTOR_)
+    #if defined(SIMDE_X86_SSE2_NATIVE)
+      /* Split each operand into its even and odd bytes, zero- or
+       * sign-extended to 16 bits, and let PMADDWD do the pairwise
+       * sums; the products and the pair sums can't overflow. */
+      const __m128i lo = _mm_set1_epi16(0x00FF);
+      __m128i
+        ae = _mm_and_si128(a_.n, lo),
+        ao = _mm_srli_epi16(a_.n, 8),
+        be = _mm_srai_epi16(_mm_slli_epi16(b_.n, 8), 8),
+        bo = _mm_srai_epi16(b_.n, 8);
+      src_.n = _mm_add_epi32(src_.n, _mm_add_epi32(_mm_madd_epi16(ae, be), _mm_madd_epi16(ao, bo)));
+    #elif defined(SIMDE_SHUFFLE_VECTOR_) && defined(SIMDE_CONVERT_VECTOR_)
       uint32_t x1_ SIMDE_VECTOR(64);
       int32_t  x2_ SIMDE_VECTOR(64);
       simde__m128i_private
@@ -103,13 +116,23 @@ simde__m256i
 simde_mm256_dpbusd_epi32(simde__m256i src, simde__m256i a, simde__m256i b) {
   #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512VNNI_NATIVE)
     return _mm256_dpbusd_epi32(src, a, b);
+  #elif defined(SIMDE_X86_AVXVNNI_NATIVE)
+    return _mm256_dpbusd_avx_epi32(src, a, b);
   #else
     simde__m256i_private
       src_ = simde__m256i_to_private(src),
       a_ = simde__m256i_to_private(a),
       b_ = simde__m256i_to_private(b);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+    #if defined(SIMDE_X86_AVX2_NATIVE)
+      const __m256i lo = _mm256_set1_epi16(0x00FF);
+      __m256i
+        ae = _mm256_and_si256(a_.n, lo),
+        ao = _mm256_srli_epi16(a_.n, 8),
+        be = _mm256_srai_epi16(_mm256_slli_epi16(b_.n, 8), 8),
+        bo = _mm256_srai_epi16(b_.n, 8);
+      src_.n = _mm256_add_epi32(src_.n, _mm256_add_epi32(_mm256_madd_epi16(ae, be), _mm256_madd_epi16(ao, bo)));
+    #elif SIMDE_NATURAL_VECTOR_SIZE_LE(128)
       src_.m128i[0] = simde_mm_dpbusd_epi32(src_.m128i[0], a_.m128i[0], b_.m128i[0]);
       src_.m128i[1] = simde_mm_dpbusd_epi32(src_.m128i[1], a_.m128i[1], b_.m128i[1]);
     #elif defined(SIMDE_SHUFFLE_VECTOR_) && defined(SIMDE_CONVERT_VECTOR_)
@@ -203,7 +226,15 @@ simde_mm512_dpbusd_epi32(simde__m512i src, simde__m512i a, simde__m512i b) {
       a_ = simde__m512i_to_private(a),
       b_ = simde__m512i_to_private(b);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+    #if defined(SIMDE_X86_AVX512BW_NATIVE)
+      const __m512i lo = _mm512_set1_epi16(0x00FF);
+      __m512i
+        ae = _mm512_and_si512(a_.n, lo),
+        ao = _mm512_srli_epi16(a_.n, 8),
+        be = _mm512_srai_epi16(_mm512_slli_epi16(b_.n, 8), 8),
+        bo = _mm512_srai_epi16(b_.n, 8);
+      src_.n = _mm512_add_epi32(src_.n, _mm512_add_epi32(_mm512_madd_epi16(ae, be), _mm512_madd_epi16(ao, bo)));
+    #elif SIMDE_NATURAL_VECTOR_SIZE_LE(256)
       src_.m256i[0] = simde_mm256_dpbusd_epi32(src_.m256i[0], a_.m256i[0], b_.m256i[0]);
       src_.m256i[1] = simde_mm256_dpbusd_epi32(src_.m256i[1], a_.m256i[1], b_.m256i[1]);
     #elif defined(SIMDE_SHUFFLE_VECTOR_) && defined(SIMDE_CONVERT_VECTOR_)
@@ -31,6 +31,8 @@
 #include "types.h"
 #include "mov.h"
 #include "mov_mask.h"
+#include "setzero.h"
+#include "../ssse3.h"
 
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
@@ -91,6 +93,692 @@ simde_mm256_maskz_expand_epi32(simde__mmask8 k, simde__m256i a) {
   #define _mm256_maskz_expand_epi32(k, a) simde_mm256_maskz_expand_epi32((k), (a))
 #endif
 
+/* Byte and word expand (AVX512_VBMI2).
+ *
+ * The fallbacks use simde_x_expand_idx8, which maps the mask for a
+ * group of eight elements to the rank of each selected element (0xff,
+ * which makes pshufb zero the slot, for the others).  Each 128-bit lane
+ * of the result is a single shuffle of the 16 bytes of a which start at
+ * the popcount of the mask for the preceding lanes, so the source can
+ * just be read at that offset. */
+
+static const union {
+  uint8_t  u8[256][8];
+  uint64_t u64[256];
+} simde_x_expand_idx8 = {
+  {
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0x00, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0xff, 0x01, 0x02, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0x00, 0x01, 0x02, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0x03, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff },
+    { 0x00, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff },
+    { 0xff, 0x00, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff },
+    { 0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0xff, 0xff },
+    { 0x00, 0xff, 0x01, 0xff, 0x02, 0xff, 0xff, 0xff },
+    { 0xff, 0x00, 0x01, 0xff, 0x02, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0xff, 0x03, 0xff, 0xff, 0xff },
+    { 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0xff },
+    { 0x00, 0xff, 0xff, 0x01, 0x02, 0xff, 0xff, 0xff },
+    { 0xff, 0x00, 0xff, 0x01, 0x02, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0xff, 0x02, 0x03, 0xff, 0xff, 0xff },
+    { 0xff, 0xff, 0x00, 0x01, 0x02, 0xff, 0xff, 0xff },
+    { 0x00, 0xff, 0x01, 0x02, 0x03, 0xff, 0xff, 0xff },
+    { 0xff, 0x00, 0x01, 0x02, 0x03, 0xff, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0xff, 0xff, 0xff },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff },
+    { 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff },
+    { 0xff, 0x00, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff },
+    { 0x00, 0x01, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff },
+    { 0xff, 0xff, 0x00, 0xff, 0xff, 0x01, 0xff, 0xff },
+    { 0x00, 0xff, 0x01, 0xff, 0xff, 0x02, 0xff, 0xff },
+    { 0xff, 0x00, 0x01, 0xff, 0xff, 0x02, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0xff, 0xff, 0x03, 0xff, 0xff },
+    { 0xff, 0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0xff },
+    { 0x00, 0xff, 0xff, 0x01, 0xff, 0x02, 0xff, 0xff },
+    { 0xff, 0x00, 0xff, 0x01, 0xff, 0x02, 0xff, 0xff },
+    { 0x00, 0x01, 0xff, 0x02, 0xff, 0x03, 0xff, 0xff },
+    { 0xff, 0xff, 0x00, 0x01, 0xff, 0x02, 0xff, 0xff },
+    { 0x00, 0xff, 0x01, 0x02, 0xff, 0x03, 0xff, 0xff },
+    { 0xff, 0x00, 0x01, 0x02, 0xff, 0x03, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0x03, 0xff, 0x04, 0xff, 0xff },
+    { 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff },
+    { 0x00, 0xff, 0xff, 0xff, 0x01, 0x02, 0xff, 0xff },
+    { 0xff, 0x00, 0xff, 0xff, 0x01, 0x02, 0xff, 0xff },
+    { 0x00, 0x01, 0xff, 0xff, 0x02, 0x03, 0xff, 0xff },
+    { 0xff, 0xff, 0x00, 0xff, 0x01, 0x02, 0xff, 0xff },
+    { 0x00, 0xff, 0x01, 0xff, 0x02, 0x03, 0xff, 0xff },
+    { 0xff, 0x00, 0x01, 0xff, 0x02, 0x03, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0xff, 0x03, 0x04, 0xff, 0xff },
+    { 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0xff, 0xff },
+    { 0x00, 0xff, 0xff, 0x01, 0x02, 0x03, 0xff, 0xff },
+    { 0xff, 0x00, 0xff, 0x01, 0x02, 0x03, 0xff, 0xff },
+    { 0x00, 0x01, 0xff, 0x02, 0x03, 0x04, 0xff, 0xff },
+    { 0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0xff, 0xff },
+    { 0x00, 0xff, 0x01, 0x02, 0x03, 0x04, 0xff, 0xff },
+    { 0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0xff, 0xff },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0xff, 0xff },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff },
+    { 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff },
+    { 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff },
+    { 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff },
+    { 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x01, 0xff },
+    { 0x00, 0xff, 0x01, 0xff, 0xff, 0xff, 0x02, 0xff },
+    { 0xff, 0x00, 0x01, 0xff, 0xff, 0xff, 0x02, 0xff },
+    { 0x00, 0x01, 0x02, 0xff, 0xff, 0xff, 0x03, 0xff },
+    { 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x01, 0xff },
+    { 0x00, 0xff, 0xff, 0x01, 0xff, 0xff, 0x02, 0xff },
+    { 0xff, 0x00, 0xff, 0x01, 0xff, 0xff, 0x02, 0xff },
+    { 0x00, 0x01, 0xff, 0x02, 0xff, 0xff, 0x03, 0xff },
+    { 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0x02, 0xff },
+    { 0x00, 0xff, 0x01, 0x02, 0xff, 0xff, 0x03, 0xff },
+    { 0xff, 0x00, 0x01, 0x02, 0xff, 0xff, 0x03, 0xff },
+    { 0x00, 0x01, 0x02, 0x03, 0xff, 0xff, 0x04, 0xff },
+    { 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x01, 0xff },
+    { 0x00, 0xff, 0xff, 0xff, 0x01, 0xff, 0x02, 0xff },
+    { 0xff, 0x00, 0xff, 0xff, 0x01, 0xff, 0x02, 0xff },
+    { 0x00, 0x01, 0xff, 0xff, 0x02, 0xff, 0x03, 0xff },
+    { 0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0x02, 0xff },
+    { 0x00, 0xff, 0x01, 0xff, 0x02, 0xff, 0x03, 0xff },
+    { 0xff, 0x00, 0x01, 0xff, 0x02, 0xff, 0x03, 0xff },
+    { 0x00, 0x01, 0x02, 0xff, 0x03, 0xff, 0x04, 0xff },
+    { 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0x02, 0xff },
+    { 0x00, 0xff, 0xff, 0x01, 0x02, 0xff, 0x03, 0xff },
+    { 0xff, 0x00, 0xff, 0x01, 0x02, 0xff, 0x03, 0xff },
+    { 0x00, 0x01, 0xff, 0x02, 0x03, 0xff, 0x04, 0xff },
+    { 0xff, 0xff, 0x00, 0x01, 0x02, 0xff, 0x03, 0xff },
+    { 0x00, 0xff, 0x01, 0x02, 0x03, 0xff, 0x04, 0xff },
+    { 0xff, 0x00, 0x01, 0x02, 0x03, 0xff, 0x04, 0xff },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0xff, 0x05, 0xff },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0xff },
+    { 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x02, 0xff },
+    { 0xff, 0x00, 0xff, 0xff, 0xff, 0x01, 0x02, 0xff },
+    { 0x00, 0x01, 0xff, 0xff, 0xff, 0x02, 0x03, 0xff },
+    { 0xff, 0xff, 0x00, 0xff, 0xff, 0x01, 0x02, 0xff },
+    { 0x00, 0xff, 0x01, 0xff, 0xff, 0x02, 0x03, 0xff },
+    { 0xff, 0x00, 0x01, 0xff, 0xff, 0x02, 0x03, 0xff },
+    { 0x00, 0x01, 0x02, 0xff, 0xff, 0x03, 0x04, 0xff },
+    { 0xff, 0xff, 0xff, 0x00, 0xff, 0x01, 0x02, 0xff },
+    { 0x00, 0xff, 0xff, 0x01, 0xff, 0x02, 0x03, 0xff },
+    { 0xff, 0x00, 0xff, 0x01, 0xff, 0x02, 0x03, 0xff },
+    { 0x00, 0x01, 0xff, 0x02, 0xff, 0x03, 0x04, 0xff },
+    { 0xff, 0xff, 0x00, 0x01, 0xff, 0x02, 0x03, 0xff },
+    { 0x00, 0xff, 0x01, 0x02, 0xff, 0x03, 0x04, 0xff },
+    { 0xff, 0x00, 0x01, 0x02, 0xff, 0x03, 0x04, 0xff },
+    { 0x00, 0x01, 0x02, 0x03, 0xff, 0x04, 0x05, 0xff },
+    { 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0xff },
+    { 0x00, 0xff, 0xff, 0xff, 0x01, 0x02, 0x03, 0xff },
+    { 0xff, 0x00, 0xff, 0xff, 0x01, 0x02, 0x03, 0xff },
+    { 0x00, 0x01, 0xff, 0xff, 0x02, 0x03, 0x04, 0xff },
+    { 0xff, 0xff, 0x00, 0xff, 0x01, 0x02, 0x03, 0xff },
+    { 0x00, 0xff, 0x01, 0xff, 0x02, 0x03, 0x04, 0xff },
+    { 0xff, 0x00, 0x01, 0xff, 0x02, 0x03, 0x04, 0xff },
+    { 0x00, 0x01, 0x02, 0xff, 0x03, 0x04, 0x05, 0xff },
+    { 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0xff },
+    { 0x00, 0xff, 0xff, 0x01, 0x02, 0x03, 0x04, 0xff },
+    { 0xff, 0x00, 0xff, 0x01, 0x02, 0x03, 0x04, 0xff },
+    { 0x00, 0x01, 0xff, 0x02, 0x03, 0x04, 0x05, 0xff },
+    { 0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0xff },
+    { 0x00, 0xff, 0x01, 0x02, 0x03, 0x04, 0x05, 0xff },
+    { 0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0xff },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0xff },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00 },
+    { 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01 },
+    { 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01 },
+    { 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02 },
+    { 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01 },
+    { 0x00, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0x02 },
+    { 0xff, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0x02 },
+    { 0x00, 0x01, 0x02, 0xff, 0xff, 0xff, 0xff, 0x03 },
+    { 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x01 },
+    { 0x00, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x02 },
+    { 0xff, 0x00, 0xff, 0x01, 0xff, 0xff, 0xff, 0x02 },
+    { 0x00, 0x01, 0xff, 0x02, 0xff, 0xff, 0xff, 0x03 },
+    { 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0xff, 0x02 },
+    { 0x00, 0xff, 0x01, 0x02, 0xff, 0xff, 0xff, 0x03 },
+    { 0xff, 0x00, 0x01, 0x02, 0xff, 0xff, 0xff, 0x03 },
+    { 0x00, 0x01, 0x02, 0x03, 0xff, 0xff, 0xff, 0x04 },
+    { 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x01 },
+    { 0x00, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0x02 },
+    { 0xff, 0x00, 0xff, 0xff, 0x01, 0xff, 0xff, 0x02 },
+    { 0x00, 0x01, 0xff, 0xff, 0x02, 0xff, 0xff, 0x03 },
+    { 0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0xff, 0x02 },
+    { 0x00, 0xff, 0x01, 0xff, 0x02, 0xff, 0xff, 0x03 },
+    { 0xff, 0x00, 0x01, 0xff, 0x02, 0xff, 0xff, 0x03 },
+    { 0x00, 0x01, 0x02, 0xff, 0x03, 0xff, 0xff, 0x04 },
+    { 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0x02 },
+    { 0x00, 0xff, 0xff, 0x01, 0x02, 0xff, 0xff, 0x03 },
+    { 0xff, 0x00, 0xff, 0x01, 0x02, 0xff, 0xff, 0x03 },
+    { 0x00, 0x01, 0xff, 0x02, 0x03, 0xff, 0xff, 0x04 },
+    { 0xff, 0xff, 0x00, 0x01, 0x02, 0xff, 0xff, 0x03 },
+    { 0x00, 0xff, 0x01, 0x02, 0x03, 0xff, 0xff, 0x04 },
+    { 0xff, 0x00, 0x01, 0x02, 0x03, 0xff, 0xff, 0x04 },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0xff, 0xff, 0x05 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x01 },
+    { 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0x02 },
+    { 0xff, 0x00, 0xff, 0xff, 0xff, 0x01, 0xff, 0x02 },
+    { 0x00, 0x01, 0xff, 0xff, 0xff, 0x02, 0xff, 0x03 },
+    { 0xff, 0xff, 0x00, 0xff, 0xff, 0x01, 0xff, 0x02 },
+    { 0x00, 0xff, 0x01, 0xff, 0xff, 0x02, 0xff, 0x03 },
+    { 0xff, 0x00, 0x01, 0xff, 0xff, 0x02, 0xff, 0x03 },
+    { 0x00, 0x01, 0x02, 0xff, 0xff, 0x03, 0xff, 0x04 },
+    { 0xff, 0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0x02 },
+    { 0x00, 0xff, 0xff, 0x01, 0xff, 0x02, 0xff, 0x03 },
+    { 0xff, 0x00, 0xff, 0x01, 0xff, 0x02, 0xff, 0x03 },
+    { 0x00, 0x01, 0xff, 0x02, 0xff, 0x03, 0xff, 0x04 },
+    { 0xff, 0xff, 0x00, 0x01, 0xff, 0x02, 0xff, 0x03 },
+    { 0x00, 0xff, 0x01, 0x02, 0xff, 0x03, 0xff, 0x04 },
+    { 0xff, 0x00, 0x01, 0x02, 0xff, 0x03, 0xff, 0x04 },
+    { 0x00, 0x01, 0x02, 0x03, 0xff, 0x04, 0xff, 0x05 },
+    { 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0x02 },
+    { 0x00, 0xff, 0xff, 0xff, 0x01, 0x02, 0xff, 0x03 },
+    { 0xff, 0x00, 0xff, 0xff, 0x01, 0x02, 0xff, 0x03 },
+    { 0x00, 0x01, 0xff, 0xff, 0x02, 0x03, 0xff, 0x04 },
+    { 0xff, 0xff, 0x00, 0xff, 0x01, 0x02, 0xff, 0x03 },
+    { 0x00, 0xff, 0x01, 0xff, 0x02, 0x03, 0xff, 0x04 },
+    { 0xff, 0x00, 0x01, 0xff, 0x02, 0x03, 0xff, 0x04 },
+    { 0x00, 0x01, 0x02, 0xff, 0x03, 0x04, 0xff, 0x05 },
+    { 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0xff, 0x03 },
+    { 0x00, 0xff, 0xff, 0x01, 0x02, 0x03, 0xff, 0x04 },
+    { 0xff, 0x00, 0xff, 0x01, 0x02, 0x03, 0xff, 0x04 },
+    { 0x00, 0x01, 0xff, 0x02, 0x03, 0x04, 0xff, 0x05 },
+    { 0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0xff, 0x04 },
+    { 0x00, 0xff, 0x01, 0x02, 0x03, 0x04, 0xff, 0x05 },
+    { 0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0xff, 0x05 },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0xff, 0x06 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01 },
+    { 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x02 },
+    { 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x02 },
+    { 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0x02, 0x03 },
+    { 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x01, 0x02 },
+    { 0x00, 0xff, 0x01, 0xff, 0xff, 0xff, 0x02, 0x03 },
+    { 0xff, 0x00, 0x01, 0xff, 0xff, 0xff, 0x02, 0x03 },
+    { 0x00, 0x01, 0x02, 0xff, 0xff, 0xff, 0x03, 0x04 },
+    { 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x01, 0x02 },
+    { 0x00, 0xff, 0xff, 0x01, 0xff, 0xff, 0x02, 0x03 },
+    { 0xff, 0x00, 0xff, 0x01, 0xff, 0xff, 0x02, 0x03 },
+    { 0x00, 0x01, 0xff, 0x02, 0xff, 0xff, 0x03, 0x04 },
+    { 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0x02, 0x03 },
+    { 0x00, 0xff, 0x01, 0x02, 0xff, 0xff, 0x03, 0x04 },
+    { 0xff, 0x00, 0x01, 0x02, 0xff, 0xff, 0x03, 0x04 },
+    { 0x00, 0x01, 0x02, 0x03, 0xff, 0xff, 0x04, 0x05 },
+    { 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x01, 0x02 },
+    { 0x00, 0xff, 0xff, 0xff, 0x01, 0xff, 0x02, 0x03 },
+    { 0xff, 0x00, 0xff, 0xff, 0x01, 0xff, 0x02, 0x03 },
+    { 0x00, 0x01, 0xff, 0xff, 0x02, 0xff, 0x03, 0x04 },
+    { 0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0x02, 0x03 },
+    { 0x00, 0xff, 0x01, 0xff, 0x02, 0xff, 0x03, 0x04 },
+    { 0xff, 0x00, 0x01, 0xff, 0x02, 0xff, 0x03, 0x04 },
+    { 0x00, 0x01, 0x02, 0xff, 0x03, 0xff, 0x04, 0x05 },
+    { 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0x02, 0x03 },
+    { 0x00, 0xff, 0xff, 0x01, 0x02, 0xff, 0x03, 0x04 },
+    { 0xff, 0x00, 0xff, 0x01, 0x02, 0xff, 0x03, 0x04 },
+    { 0x00, 0x01, 0xff, 0x02, 0x03, 0xff, 0x04, 0x05 },
+    { 0xff, 0xff, 0x00, 0x01, 0x02, 0xff, 0x03, 0x04 },
+    { 0x00, 0xff, 0x01, 0x02, 0x03, 0xff, 0x04, 0x05 },
+    { 0xff, 0x00, 0x01, 0x02, 0x03, 0xff, 0x04, 0x05 },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0xff, 0x05, 0x06 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02 },
+    { 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x02, 0x03 },
+    { 0xff, 0x00, 0xff, 0xff, 0xff, 0x01, 0x02, 0x03 },
+    { 0x00, 0x01, 0xff, 0xff, 0xff, 0x02, 0x03, 0x04 },
+    { 0xff, 0xff, 0x00, 0xff, 0xff, 0x01, 0x02, 0x03 },
+    { 0x00, 0xff, 0x01, 0xff, 0xff, 0x02, 0x03, 0x04 },
+    { 0xff, 0x00, 0x01, 0xff, 0xff, 0x02, 0x03, 0x04 },
+    { 0x00, 0x01, 0x02, 0xff, 0xff, 0x03, 0x04, 0x05 },
+    { 0xff, 0xff, 0xff, 0x00, 0xff, 0x01, 0x02, 0x03 },
+    { 0x00, 0xff, 0xff, 0x01, 0xff, 0x02, 0x03, 0x04 },
+    { 0xff, 0x00, 0xff, 0x01, 0xff, 0x02, 0x03, 0x04 },
+    { 0x00, 0x01, 0xff, 0x02, 0xff, 0x03, 0x04, 0x05 },
+    { 0xff, 0xff, 0x00, 0x01, 0xff, 0x02, 0x03, 0x04 },
+    { 0x00, 0xff, 0x01, 0x02, 0xff, 0x03, 0x04, 0x05 },
+    { 0xff, 0x00, 0x01, 0x02, 0xff, 0x03, 0x04, 0x05 },
+    { 0x00, 0x01, 0x02, 0x03, 0xff, 0x04, 0x05, 0x06 },
+    { 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x03 },
+    { 0x00, 0xff, 0xff, 0xff, 0x01, 0x02, 0x03, 0x04 },
+    { 0xff, 0x00, 0xff, 0xff, 0x01, 0x02, 0x03, 0x04 },
+    { 0x00, 0x01, 0xff, 0xff, 0x02, 0x03, 0x04, 0x05 },
+    { 0xff, 0xff, 0x00, 0xff, 0x01, 0x02, 0x03, 0x04 },
+    { 0x00, 0xff, 0x01, 0xff, 0x02, 0x03, 0x04, 0x05 },
+    { 0xff, 0x00, 0x01, 0xff, 0x02, 0x03, 0x04, 0x05 },
+    { 0x00, 0x01, 0x02, 0xff, 0x03, 0x04, 0x05, 0x06 },
+    { 0xff, 0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0x04 },
+    { 0x00, 0xff, 0xff, 0x01, 0x02, 0x03, 0x04, 0x05 },
+    { 0xff, 0x00, 0xff, 0x01, 0x02, 0x03, 0x04, 0x05 },
+    { 0x00, 0x01, 0xff, 0x02, 0x03, 0x04, 0x05, 0x06 },
+    { 0xff, 0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05 },
+    { 0x00, 0xff, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06 },
+    { 0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06 },
+    { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07 }
+  }
+};
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_mm_expand_epi8_idx (uint16_t k) {
+  simde__m128i_private r_;
+
+  r_.u64[0] = simde_x_expand_idx8.u64[k & 0xff];
+  r_.u64[1] = simde_x_expand_idx8.u64[k >> 8];
+
+  /* The upper group starts after the elements used by the lower one;
+   * the saturating add keeps 0xff as it is. */
+  return simde_mm_adds_epu8(
+    simde__m128i_from_private(r_),
+    simde_mm_set_epi64x(HEDLEY_STATIC_CAST(int64_t, simde_popcount64(k & 0xff) * UINT64_C(0x0101010101010101)), 0)
+  );
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_mm_expand_epi16_idx (uint8_t k) {
+  simde__m128i r = simde_mm_loadl_epi64(HEDLEY_REINTERPRET_CAST(const simde__m128i*, simde_x_expand_idx8.u8[k]));
+  r = simde_mm_unpacklo_epi8(r, r);
+  r = simde_mm_add_epi8(r, r);
+  return simde_mm_add_epi8(r, simde_mm_setr_epi8(0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_expand_epi8 (simde__mmask16 k, simde__m128i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_expand_epi8(k, a);
+  #else
+    return simde_mm_shuffle_epi8(a, simde_x_mm_expand_epi8_idx(k));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_expand_epi8
+  #define _mm_maskz_expand_epi8(k, a) simde_mm_maskz_expand_epi8(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_expand_epi8 (simde__m128i src, simde__mmask16 k, simde__m128i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_expand_epi8(src, k, a);
+  #else
+    return simde_mm_mask_mov_epi8(src, k, simde_mm_maskz_expand_epi8(k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_expand_epi8
+  #define _mm_mask_expand_epi8(src, k, a) simde_mm_mask_expand_epi8(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_expandloadu_epi8 (simde__mmask16 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_expandloadu_epi8(k, mem_addr);
+  #else
+    simde__m128i a = simde_mm_setzero_si128();
+    simde_memcpy(&a, mem_addr, simde_popcount64(k));
+    return simde_mm_maskz_expand_epi8(k, a);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_expandloadu_epi8
+  #define _mm_maskz_expandloadu_epi8(k, mem_addr) simde_mm_maskz_expandloadu_epi8(k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_expandloadu_epi8 (simde__m128i src, simde__mmask16 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_expandloadu_epi8(src, k, mem_addr);
+  #else
+    return simde_mm_mask_mov_epi8(src, k, simde_mm_maskz_expandloadu_epi8(k, mem_addr));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_expandloadu_epi8
+  #define _mm_mask_expandloadu_epi8(src, k, mem_addr) simde_mm_mask_expandloadu_epi8(src, k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_expand_epi16 (simde__mmask8 k, simde__m128i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_expand_epi16(k, a);
+  #else
+    return simde_mm_shuffle_epi8(a, simde_x_mm_expand_epi16_idx(k));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_expand_epi16
+  #define _mm_maskz_expand_epi16(k, a) simde_mm_maskz_expand_epi16(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_expand_epi16 (simde__m128i src, simde__mmask8 k, simde__m128i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_expand_epi16(src, k, a);
+  #else
+    return simde_mm_mask_mov_epi16(src, k, simde_mm_maskz_expand_epi16(k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_expand_epi16
+  #define _mm_mask_expand_epi16(src, k, a) simde_mm_mask_expand_epi16(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_expandloadu_epi16 (simde__mmask8 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_expandloadu_epi16(k, mem_addr);
+  #else
+    simde__m128i a = simde_mm_setzero_si128();
+    simde_memcpy(&a, mem_addr, simde_popcount64(k) * sizeof(int16_t));
+    return simde_mm_maskz_expand_epi16(k, a);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_expandloadu_epi16
+  #define _mm_maskz_expandloadu_epi16(k, mem_addr) simde_mm_maskz_expandloadu_epi16(k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_expandloadu_epi16 (simde__m128i src, simde__mmask8 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_expandloadu_epi16(src, k, mem_addr);
+  #else
+    return simde_mm_mask_mov_epi16(src, k, simde_mm_maskz_expandloadu_epi16(k, mem_addr));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_expandloadu_epi16
+  #define _mm_mask_expandloadu_epi16(src, k, mem_addr) simde_mm_mask_expandloadu_epi16(src, k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_expand_epi8 (simde__mmask32 k, simde__m256i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_expand_epi8(k, a);
+  #else
+    simde__m256i_private
+      a_ = simde__m256i_to_private(a),
+      r_;
+
+    r_.m128i[0] = simde_mm_maskz_expand_epi8(HEDLEY_STATIC_CAST(simde__mmask16, k      ), a_.m128i[0]);
+    r_.m128i[1] = simde_mm_maskz_expand_epi8(HEDLEY_STATIC_CAST(simde__mmask16, k >> 16), simde_mm_loadu_si128(&(a_.u8[simde_popcount64(k & 0xffff)])));
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_expand_epi8
+  #define _mm256_maskz_expand_epi8(k, a) simde_mm256_maskz_expand_epi8(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_expand_epi8 (simde__m256i src, simde__mmask32 k, simde__m256i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_expand_epi8(src, k, a);
+  #else
+    return simde_mm256_mask_mov_epi8(src, k, simde_mm256_maskz_expand_epi8(k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_expand_epi8
+  #define _mm256_mask_expand_epi8(src, k, a) simde_mm256_mask_expand_epi8(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_expandloadu_epi8 (simde__mmask32 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_expandloadu_epi8(k, mem_addr);
+  #else
+    simde__m256i a = simde_mm256_setzero_si256();
+    simde_memcpy(&a, mem_addr, simde_popcount64(k));
+    return simde_mm256_maskz_expand_epi8(k, a);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_expandloadu_epi8
+  #define _mm256_maskz_expandloadu_epi8(k, mem_addr) simde_mm256_maskz_expandloadu_epi8(k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_expandloadu_epi8 (simde__m256i src, simde__mmask32 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_expandloadu_epi8(src, k, mem_addr);
+  #else
+    return simde_mm256_mask_mov_epi8(src, k, simde_mm256_maskz_expandloadu_epi8(k, mem_addr));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_expandloadu_epi8
+  #define _mm256_mask_expandloadu_epi8(src, k, mem_addr) simde_mm256_mask_expandloadu_epi8(src, k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_expand_epi16 (simde__mmask16 k, simde__m256i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_expand_epi16(k, a);
+  #else
+    simde__m256i_private
+      a_ = simde__m256i_to_private(a),
+      r_;
+
+    r_.m128i[0] = simde_mm_maskz_expand_epi16(HEDLEY_STATIC_CAST(simde__mmask8, k     ), a_.m128i[0]);
+    r_.m128i[1] = simde_mm_maskz_expand_epi16(HEDLEY_STATIC_CAST(simde__mmask8, k >> 8), simde_mm_loadu_si128(&(a_.u16[simde_popcount64(k & 0xff)])));
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_expand_epi16
+  #define _mm256_maskz_expand_epi16(k, a) simde_mm256_maskz_expand_epi16(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_expand_epi16 (simde__m256i src, simde__mmask16 k, simde__m256i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_expand_epi16(src, k, a);
+  #else
+    return simde_mm256_mask_mov_epi16(src, k, simde_mm256_maskz_expand_epi16(k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_expand_epi16
+  #define _mm256_mask_expand_epi16(src, k, a) simde_mm256_mask_expand_epi16(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_expandloadu_epi16 (simde__mmask16 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_expandloadu_epi16(k, mem_addr);
+  #else
+    simde__m256i a = simde_mm256_setzero_si256();
+    simde_memcpy(&a, mem_addr, simde_popcount64(k) * sizeof(int16_t));
+    return simde_mm256_maskz_expand_epi16(k, a);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_expandloadu_epi16
+  #define _mm256_maskz_expandloadu_epi16(k, mem_addr) simde_mm256_maskz_expandloadu_epi16(k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_expandloadu_epi16 (simde__m256i src, simde__mmask16 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_expandloadu_epi16(src, k, mem_addr);
+  #else
+    return simde_mm256_mask_mov_epi16(src, k, simde_mm256_maskz_expandloadu_epi16(k, mem_addr));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_expandloadu_epi16
+  #define _mm256_mask_expandloadu_epi16(src, k, mem_addr) simde_mm256_mask_expandloadu_epi16(src, k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_expand_epi8 (simde__mmask64 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_maskz_expand_epi8(k, a);
+  #else
+    simde__m512i_private
+      a_ = simde__m512i_to_private(a),
+      r_;
+    const unsigned int
+      n1 =      simde_popcount64(k & UINT64_C(0x000000000000ffff)),
+      n2 = n1 + simde_popcount64(k & UINT64_C(0x00000000ffff0000)),
+      n3 = n2 + simde_popcount64(k & UINT64_C(0x0000ffff00000000));
+
+    r_.m128i[0] = simde_mm_maskz_expand_epi8(HEDLEY_STATIC_CAST(simde__mmask16, k      ), a_.m128i[0]);
+    r_.m128i[1] = simde_mm_maskz_expand_epi8(HEDLEY_STATIC_CAST(simde__mmask16, k >> 16), simde_mm_loadu_si128(&(a_.u8[n1])));
+    r_.m128i[2] = simde_mm_maskz_expand_epi8(HEDLEY_STATIC_CAST(simde__mmask16, k >> 32), simde_mm_loadu_si128(&(a_.u8[n2])));
+    r_.m128i[3] = simde_mm_maskz_expand_epi8(HEDLEY_STATIC_CAST(simde__mmask16, k >> 48), simde_mm_loadu_si128(&(a_.u8[n3])));
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_expand_epi8
+  #define _mm512_maskz_expand_epi8(k, a) simde_mm512_maskz_expand_epi8(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_expand_epi8 (simde__m512i src, simde__mmask64 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_mask_expand_epi8(src, k, a);
+  #else
+    return simde_mm512_mask_mov_epi8(src, k, simde_mm512_maskz_expand_epi8(k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_expand_epi8
+  #define _mm512_mask_expand_epi8(src, k, a) simde_mm512_mask_expand_epi8(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_expandloadu_epi8 (simde__mmask64 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_maskz_expandloadu_epi8(k, mem_addr);
+  #else
+    simde__m512i a = simde_mm512_setzero_si512();
+    simde_memcpy(&a, mem_addr, simde_popcount64(k));
+    return simde_mm512_maskz_expand_epi8(k, a);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_expandloadu_epi8
+  #define _mm512_maskz_expandloadu_epi8(k, mem_addr) simde_mm512_maskz_expandloadu_epi8(k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_expandloadu_epi8 (simde__m512i src, simde__mmask64 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_mask_expandloadu_epi8(src, k, mem_addr);
+  #else
+    return simde_mm512_mask_mov_epi8(src, k, simde_mm512_maskz_expandloadu_epi8(k, mem_addr));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_expandloadu_epi8
+  #define _mm512_mask_expandloadu_epi8(src, k, mem_addr) simde_mm512_mask_expandloadu_epi8(src, k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_expand_epi16 (simde__mmask32 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_maskz_expand_epi16(k, a);
+  #else
+    simde__m512i_private
+      a_ = simde__m512i_to_private(a),
+      r_;
+    const unsigned int
+      n1 =      simde_popcount64(k & UINT32_C(0x000000ff)),
+      n2 = n1 + simde_popcount64(k & UINT32_C(0x0000ff00)),
+      n3 = n2 + simde_popcount64(k & UINT32_C(0x00ff0000));
+
+    r_.m128i[0] = simde_mm_maskz_expand_epi16(HEDLEY_STATIC_CAST(simde__mmask8, k      ), a_.m128i[0]);
+    r_.m128i[1] = simde_mm_maskz_expand_epi16(HEDLEY_STATIC_CAST(simde__mmask8, k >>  8), simde_mm_loadu_si128(&(a_.u16[n1])));
+    r_.m128i[2] = simde_mm_maskz_expand_epi16(HEDLEY_STATIC_CAST(simde__mmask8, k >> 16), simde_mm_loadu_si128(&(a_.u16[n2])));
+    r_.m128i[3] = simde_mm_maskz_expand_epi16(HEDLEY_STATIC_CAST(simde__mmask8, k >> 24), simde_mm_loadu_si128(&(a_.u16[n3])));
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_expand_epi16
+  #define _mm512_maskz_expand_epi16(k, a) simde_mm512_maskz_expand_epi16(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_expand_epi16 (simde__m512i src, simde__mmask32 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_mask_expand_epi16(src, k, a);
+  #else
+    return simde_mm512_mask_mov_epi16(src, k, simde_mm512_maskz_expand_epi16(k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_expand_epi16
+  #define _mm512_mask_expand_epi16(src, k, a) simde_mm512_mask_expand_epi16(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_expandloadu_epi16 (simde__mmask32 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_maskz_expandloadu_epi16(k, mem_addr);
+  #else
+    simde__m512i a = simde_mm512_setzero_si512();
+    simde_memcpy(&a, mem_addr, simde_popcount64(k) * sizeof(int16_t));
+    return simde_mm512_maskz_expand_epi16(k, a);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_expandloadu_epi16
+  #define _mm512_maskz_expandloadu_epi16(k, mem_addr) simde_mm512_maskz_expandloadu_epi16(k, mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_expandloadu_epi16 (simde__m512i src, simde__mmask32 k, void const* mem_addr) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_mask_expandloadu_epi16(src, k, mem_addr);
+  #else
+    return simde_mm512_mask_mov_epi16(src, k, simde_mm512_maskz_expandloadu_epi16(k, mem_addr));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_expandloadu_epi16
+  #define _mm512_mask_expandloadu_epi16(src, k, mem_addr) simde_mm512_mask_expandloadu_epi16(src, k, mem_addr)
+#endif
+
 SIMDE_END_DECLS_
 HEDLEY_DIAGNOSTIC_POP
 
@@ -0,0 +1,187 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE_X86_AVX512_FCMUL_H)
+#define SIMDE_X86_AVX512_FCMUL_H
+
+#include "types.h"
+#include "cvt.h"
+#include "fmadd.h"
+#include "mul.h"
+#include "set1.h"
+#include "shuffle.h"
+#include "xor.h"
+#include "../fma.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* Complex multiplication of binary16 pairs (real part in the even
+ * lane, imaginary part in the odd one).  The emulation widens to
+ * binary32, where each product is exact, so the only roundings are the
+ * one of the sum and the final narrowing. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128h
+simde_mm_fmul_pch (simde__m128h a, simde__m128h b) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_fmul_pch(a, b);
+  #else
+    const simde__m256
+      x = simde_mm256_cvtxph_ps(a),
+      y = simde_mm256_cvtxph_ps(b);
+
+    return simde_mm256_cvtxps_ph(
+      simde_mm256_fmaddsub_ps(
+        x, simde_mm256_moveldup_ps(y),
+        simde_mm256_mul_ps(simde_mm256_permute_ps(x, SIMDE_MM_SHUFFLE(2, 3, 0, 1)), simde_mm256_movehdup_ps(y))
+      )
+    );
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_fmul_pch
+  #define _mm_fmul_pch(a, b) simde_mm_fmul_pch(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128h
+simde_mm_fcmul_pch (simde__m128h a, simde__m128h b) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_fcmul_pch(a, b);
+  #else
+    const simde__m256
+      x = simde_mm256_cvtxph_ps(a),
+      y = simde_mm256_cvtxph_ps(b);
+
+    return simde_mm256_cvtxps_ph(
+      simde_mm256_fmsubadd_ps(
+        x, simde_mm256_moveldup_ps(y),
+        simde_mm256_mul_ps(simde_mm256_permute_ps(x, SIMDE_MM_SHUFFLE(2, 3, 0, 1)), simde_mm256_movehdup_ps(y))
+      )
+    );
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_fcmul_pch
+  #define _mm_fcmul_pch(a, b) simde_mm_fcmul_pch(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256h
+simde_x_mm256_fmul_pch_ (simde__m256h a, simde__m256h b, int64_t sign) {
+  /* sign picks which half of each product of the swapped operands is
+   * negated before the final FMA: the real one for a * b, the
+   * imaginary one for a * conj(b). */
+  const simde__m512
+    x = simde_mm512_cvtxph_ps(a),
+    y = simde_mm512_cvtxph_ps(b),
+    t = simde_mm512_mul_ps(simde_mm512_shuffle_ps(x, x, SIMDE_MM_SHUFFLE(2, 3, 0, 1)), simde_mm512_shuffle_ps(y, y, SIMDE_MM_SHUFFLE(3, 3, 1, 1)));
+
+  return simde_mm512_cvtxps_ph(
+    simde_mm512_fmadd_ps(
+      x, simde_mm512_shuffle_ps(y, y, SIMDE_MM_SHUFFLE(2, 2, 0, 0)),
+      simde_mm512_castsi512_ps(simde_mm512_xor_si512(simde_mm512_castps_si512(t), simde_mm512_set1_epi64(sign)))
+    )
+  );
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256h
+simde_mm256_fmul_pch (simde__m256h a, simde__m256h b) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_fmul_pch(a, b);
+  #else
+    return simde_x_mm256_fmul_pch_(a, b, INT64_C(0x80000000));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_fmul_pch
+  #define _mm256_fmul_pch(a, b) simde_mm256_fmul_pch(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256h
+simde_mm256_fcmul_pch (simde__m256h a, simde__m256h b) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_fcmul_pch(a, b);
+  #else
+    return simde_x_mm256_fmul_pch_(a, b, INT64_MIN);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_fcmul_pch
+  #define _mm256_fcmul_pch(a, b) simde_mm256_fcmul_pch(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512h
+simde_mm512_fmul_pch (simde__m512h a, simde__m512h b) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE)
+    return _mm512_fmul_pch(a, b);
+  #else
+    simde__m512h_private
+      r_,
+      a_ = simde__m512h_to_private(a),
+      b_ = simde__m512h_to_private(b);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m256h) / sizeof(r_.m256h[0])) ; i++) {
+      r_.m256h[i] = simde_mm256_fmul_pch(a_.m256h[i], b_.m256h[i]);
+    }
+
+    return simde__m512h_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_fmul_pch
+  #define _mm512_fmul_pch(a, b) simde_mm512_fmul_pch(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512h
+simde_mm512_fcmul_pch (simde__m512h a, simde__m512h b) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE)
+    return _mm512_fcmul_pch(a, b);
+  #else
+    simde__m512h_private
+      r_,
+      a_ = simde__m512h_to_private(a),
+      b_ = simde__m512h_to_private(b);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m256h) / sizeof(r_.m256h[0])) ; i++) {
+      r_.m256h[i] = simde_mm256_fcmul_pch(a_.m256h[i], b_.m256h[i]);
+    }
+
+    return simde__m512h_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_fcmul_pch
+  #define _mm512_fcmul_pch(a, b) simde_mm512_fcmul_pch(a, b)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_FCMUL_H) */
@@ -31,6 +31,7 @@
 #include "types.h"
 #include "mov.h"
 #include "../fma.h"
+#include "cvt.h"
 
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
@@ -130,6 +131,184 @@ simde_mm512_fmadd_pd (simde__m512d a, simde__m512d b, simde__m512d c) {
   #define _mm512_fmadd_pd(a, b, c) simde_mm512_fmadd_pd(a, b, c)
 #endif
 
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128h
+simde_mm_fmadd_ph (simde__m128h a, simde__m128h b, simde__m128h c) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_fmadd_ph(a, b, c);
+  #else
+    return simde_mm256_cvtxps_ph(simde_mm256_fmadd_ps(simde_mm256_cvtxph_ps(a), simde_mm256_cvtxph_ps(b), simde_mm256_cvtxph_ps(c)));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_fmadd_ph
+  #define _mm_fmadd_ph(a, b, c) simde_mm_fmadd_ph(a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128h
+simde_mm_mask_fmadd_ph (simde__m128h a, simde__mmask8 k, simde__m128h b, simde__m128h c) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_fmadd_ph(a, k, b, c);
+  #else
+    return simde_x_mm_mask_mov_ph(a, k, simde_mm_fmadd_ph(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_fmadd_ph
+  #define _mm_mask_fmadd_ph(a, k, b, c) simde_mm_mask_fmadd_ph(a, k, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128h
+simde_mm_mask3_fmadd_ph (simde__m128h a, simde__m128h b, simde__m128h c, simde__mmask8 k) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask3_fmadd_ph(a, b, c, k);
+  #else
+    return simde_x_mm_mask_mov_ph(c, k, simde_mm_fmadd_ph(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask3_fmadd_ph
+  #define _mm_mask3_fmadd_ph(a, b, c, k) simde_mm_mask3_fmadd_ph(a, b, c, k)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128h
+simde_mm_maskz_fmadd_ph (simde__mmask8 k, simde__m128h a, simde__m128h b, simde__m128h c) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_fmadd_ph(k, a, b, c);
+  #else
+    return simde_x_mm_maskz_mov_ph(k, simde_mm_fmadd_ph(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_fmadd_ph
+  #define _mm_maskz_fmadd_ph(k, a, b, c) simde_mm_maskz_fmadd_ph(k, a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256h
+simde_mm256_fmadd_ph (simde__m256h a, simde__m256h b, simde__m256h c) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_fmadd_ph(a, b, c);
+  #else
+    return simde_mm512_cvtxps_ph(simde_mm512_fmadd_ps(simde_mm512_cvtxph_ps(a), simde_mm512_cvtxph_ps(b), simde_mm512_cvtxph_ps(c)));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_fmadd_ph
+  #define _mm256_fmadd_ph(a, b, c) simde_mm256_fmadd_ph(a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256h
+simde_mm256_mask_fmadd_ph (simde__m256h a, simde__mmask16 k, simde__m256h b, simde__m256h c) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_fmadd_ph(a, k, b, c);
+  #else
+    return simde_x_mm256_mask_mov_ph(a, k, simde_mm256_fmadd_ph(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_fmadd_ph
+  #define _mm256_mask_fmadd_ph(a, k, b, c) simde_mm256_mask_fmadd_ph(a, k, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256h
+simde_mm256_mask3_fmadd_ph (simde__m256h a, simde__m256h b, simde__m256h c, simde__mmask16 k) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask3_fmadd_ph(a, b, c, k);
+  #else
+    return simde_x_mm256_mask_mov_ph(c, k, simde_mm256_fmadd_ph(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask3_fmadd_ph
+  #define _mm256_mask3_fmadd_ph(a, b, c, k) simde_mm256_mask3_fmadd_ph(a, b, c, k)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256h
+simde_mm256_maskz_fmadd_ph (simde__mmask16 k, simde__m256h a, simde__m256h b, simde__m256h c) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_fmadd_ph(k, a, b, c);
+  #else
+    return simde_x_mm256_maskz_mov_ph(k, simde_mm256_fmadd_ph(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_fmadd_ph
+  #define _mm256_maskz_fmadd_ph(k, a, b, c) simde_mm256_maskz_fmadd_ph(k, a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512h
+simde_mm512_fmadd_ph (simde__m512h a, simde__m512h b, simde__m512h c) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE)
+    return _mm512_fmadd_ph(a, b, c);
+  #else
+    simde__m512h_private
+      r_,
+      a_ = simde__m512h_to_private(a),
+      b_ = simde__m512h_to_private(b),
+      c_ = simde__m512h_to_private(c);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m256h) / sizeof(r_.m256h[0])) ; i++) {
+      r_.m256h[i] = simde_mm256_fmadd_ph(a_.m256h[i], b_.m256h[i], c_.m256h[i]);
+    }
+
+    return simde__m512h_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_fmadd_ph
+  #define _mm512_fmadd_ph(a, b, c) simde_mm512_fmadd_ph(a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512h
+simde_mm512_mask_fmadd_ph (simde__m512h a, simde__mmask32 k, simde__m512h b, simde__m512h c) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE)
+    return _mm512_mask_fmadd_ph(a, k, b, c);
+  #else
+    return simde_x_mm512_mask_mov_ph(a, k, simde_mm512_fmadd_ph(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_fmadd_ph
+  #define _mm512_mask_fmadd_ph(a, k, b, c) simde_mm512_mask_fmadd_ph(a, k, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512h
+simde_mm512_mask3_fmadd_ph (simde__m512h a, simde__m512h b, simde__m512h c, simde__mmask32 k) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE)
+    return _mm512_mask3_fmadd_ph(a, b, c, k);
+  #else
+    return simde_x_mm512_mask_mov_ph(c, k, simde_mm512_fmadd_ph(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask3_fmadd_ph
+  #define _mm512_mask3_fmadd_ph(a, b, c, k) simde_mm512_mask3_fmadd_ph(a, b, c, k)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512h
+simde_mm512_maskz_fmadd_ph (simde__mmask32 k, simde__m512h a, simde__m512h b, simde__m512h c) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE)
+    return _mm512_maskz_fmadd_ph(k, a, b, c);
+  #else
+    return simde_x_mm512_maskz_mov_ph(k, simde_mm512_fmadd_ph(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_fmadd_ph
+  #define _mm512_maskz_fmadd_ph(k, a, b, c) simde_mm512_maskz_fmadd_ph(k, a, b, c)
+#endif
+
 SIMDE_END_DECLS_
 HEDLEY_DIAGNOSTIC_POP
 
@@ -0,0 +1,607 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE_X86_AVX512_GETEXP_H)
+#define SIMDE_X86_AVX512_GETEXP_H
+
+#include "types.h"
+#include "mov.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* The fallbacks only use integer operations on the bit patterns plus
+ * one exact subtraction, so they never raise floating-point exceptions
+ * and the _round variants can simply ignore `sae'.
+ *
+ * Denormals are normalized without a count-leading-zeros: OR-ing the
+ * mantissa into the bit pattern of 1.0 and subtracting 1.0 yields the
+ * mantissa times 2^-23 (2^-52 for doubles), exactly and as a normal
+ * number, so its exponent and mantissa fields are the denormal's
+ * normalized ones with a constant exponent offset.  Exponents are turned
+ * into floating-point values with the 2^23 / 2^52 magic-number trick,
+ * which needs no int-to-float conversion instructions. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_x_getexp_normalize_f32_ (int32_t abs_) {
+  /* Denormals: m * 2^-149 is normalized by computing m * 2^-23 exactly as
+   * (1.m - 1.0); its exponent is then 126 too large, which the callers
+   * account for. */
+  if (abs_ < INT32_C(0x00800000)) {
+    int32_t t_ = (abs_ & INT32_C(0x007FFFFF)) | INT32_C(0x3F800000);
+    simde_float32 t;
+    simde_memcpy(&t, &t_, sizeof(t));
+    t -= SIMDE_FLOAT32_C(1.0);
+    simde_memcpy(&abs_, &t, sizeof(abs_));
+  }
+  return abs_;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_x_getexp_f32_ (simde_float32 a) {
+  int32_t a_, abs_;
+  simde_float32 r;
+  simde_memcpy(&a_, &a, sizeof(a_));
+  abs_ = a_ & INT32_C(0x7FFFFFFF);
+
+  if (abs_ > INT32_C(0x7F800000)) {
+    a_ |= INT32_C(0x00400000);
+    simde_memcpy(&r, &a_, sizeof(r));
+  } else if (abs_ == INT32_C(0x7F800000)) {
+    r = SIMDE_MATH_INFINITYF;
+  } else if (abs_ == 0) {
+    r = -SIMDE_MATH_INFINITYF;
+  } else {
+    const int32_t n = simde_x_getexp_normalize_f32_(abs_);
+    r = HEDLEY_STATIC_CAST(simde_float32, (n >> 23) - ((abs_ < INT32_C(0x00800000)) ? INT32_C(253) : INT32_C(127)));
+  }
+
+  return r;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_x_getexp_normalize_f64_ (int64_t abs_) {
+  /* Denormals: m * 2^-1074 is normalized by computing m * 2^-52 exactly as
+   * (1.m - 1.0); its exponent is then 1022 too large, which the callers
+   * account for. */
+  if (abs_ < INT64_C(0x0010000000000000)) {
+    int64_t t_ = (abs_ & INT64_C(0x000FFFFFFFFFFFFF)) | INT64_C(0x3FF0000000000000);
+    simde_float64 t;
+    simde_memcpy(&t, &t_, sizeof(t));
+    t -= SIMDE_FLOAT64_C(1.0);
+    simde_memcpy(&abs_, &t, sizeof(abs_));
+  }
+  return abs_;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64
+simde_x_getexp_f64_ (simde_float64 a) {
+  int64_t a_, abs_;
+  simde_float64 r;
+  simde_memcpy(&a_, &a, sizeof(a_));
+  abs_ = a_ & INT64_C(0x7FFFFFFFFFFFFFFF);
+
+  if (abs_ > INT64_C(0x7FF0000000000000)) {
+    a_ |= INT64_C(0x0008000000000000);
+    simde_memcpy(&r, &a_, sizeof(r));
+  } else if (abs_ == INT64_C(0x7FF0000000000000)) {
+    r = SIMDE_MATH_INFINITY;
+  } else if (abs_ == 0) {
+    r = -SIMDE_MATH_INFINITY;
+  } else {
+    const int64_t n = simde_x_getexp_normalize_f64_(abs_);
+    r = HEDLEY_STATIC_CAST(simde_float64, (n >> 52) - ((abs_ < INT64_C(0x0010000000000000)) ? INT64_C(2045) : INT64_C(1023)));
+  }
+
+  return r;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_getexp_ps (simde__m128 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_getexp_ps(a);
+  #else
+    simde__m128_private
+      r_,
+      t_,
+      a_ = simde__m128_to_private(a);
+
+    #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      const __typeof__(a_.i32) abs_ = a_.i32 & INT32_C(0x7FFFFFFF);
+      const __typeof__(a_.i32) den = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i32), abs_ < INT32_C(0x00800000));
+      const __typeof__(a_.i32) zero = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i32), abs_ == 0);
+      const __typeof__(a_.i32) special = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i32), abs_ >= INT32_C(0x7F800000));
+      const __typeof__(a_.i32) nan = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i32), abs_ > INT32_C(0x7F800000));
+
+      t_.i32 = (abs_ & INT32_C(0x007FFFFF)) | INT32_C(0x3F800000);
+      t_.f32 = t_.f32 - SIMDE_FLOAT32_C(1.0);
+      t_.i32 = (t_.i32 & den) | (abs_ & ~den);
+      t_.i32 = ((t_.i32 >> 23) + (~den & INT32_C(126))) | INT32_C(0x4B000000);
+      r_.f32 = t_.f32 - SIMDE_FLOAT32_C(8388861.0);
+
+      r_.i32 = (r_.i32 & ~(zero | special)) | (-INT32_C(0x00800000) & zero) | ((abs_ | (nan & INT32_C(0x00400000))) & special);
+      r_.i32 |= a_.i32 & nan & ~INT32_C(0x7FFFFFFF);
+    #else
+      (void) t_;
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = simde_x_getexp_f32_(a_.f32[i]);
+      }
+    #endif
+
+    return simde__m128_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_getexp_ps
+  #define _mm_getexp_ps(a) simde_mm_getexp_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_mask_getexp_ps (simde__m128 src, simde__mmask8 k, simde__m128 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_getexp_ps(src, k, a);
+  #else
+    return simde_mm_mask_mov_ps(src, k, simde_mm_getexp_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_getexp_ps
+  #define _mm_mask_getexp_ps(src, k, a) simde_mm_mask_getexp_ps(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_maskz_getexp_ps (simde__mmask8 k, simde__m128 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_getexp_ps(k, a);
+  #else
+    return simde_mm_maskz_mov_ps(k, simde_mm_getexp_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_getexp_ps
+  #define _mm_maskz_getexp_ps(k, a) simde_mm_maskz_getexp_ps(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_getexp_ps (simde__m256 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_getexp_ps(a);
+  #else
+    simde__m256_private
+      r_,
+      t_,
+      a_ = simde__m256_to_private(a);
+
+    #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      const __typeof__(a_.i32) abs_ = a_.i32 & INT32_C(0x7FFFFFFF);
+      const __typeof__(a_.i32) den = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i32), abs_ < INT32_C(0x00800000));
+      const __typeof__(a_.i32) zero = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i32), abs_ == 0);
+      const __typeof__(a_.i32) special = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i32), abs_ >= INT32_C(0x7F800000));
+      const __typeof__(a_.i32) nan = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i32), abs_ > INT32_C(0x7F800000));
+
+      t_.i32 = (abs_ & INT32_C(0x007FFFFF)) | INT32_C(0x3F800000);
+      t_.f32 = t_.f32 - SIMDE_FLOAT32_C(1.0);
+      t_.i32 = (t_.i32 & den) | (abs_ & ~den);
+      t_.i32 = ((t_.i32 >> 23) + (~den & INT32_C(126))) | INT32_C(0x4B000000);
+      r_.f32 = t_.f32 - SIMDE_FLOAT32_C(8388861.0);
+
+      r_.i32 = (r_.i32 & ~(zero | special)) | (-INT32_C(0x00800000) & zero) | ((abs_ | (nan & INT32_C(0x00400000))) & special);
+      r_.i32 |= a_.i32 & nan & ~INT32_C(0x7FFFFFFF);
+    #else
+      (void) t_;
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = simde_x_getexp_f32_(a_.f32[i]);
+      }
+    #endif
+
+    return simde__m256_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_getexp_ps
+  #define _mm256_getexp_ps(a) simde_mm256_getexp_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_mask_getexp_ps (simde__m256 src, simde__mmask8 k, simde__m256 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_getexp_ps(src, k, a);
+  #else
+    return simde_mm256_mask_mov_ps(src, k, simde_mm256_getexp_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_getexp_ps
+  #define _mm256_mask_getexp_ps(src, k, a) simde_mm256_mask_getexp_ps(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_maskz_getexp_ps (simde__mmask8 k, simde__m256 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_getexp_ps(k, a);
+  #else
+    return simde_mm256_maskz_mov_ps(k, simde_mm256_getexp_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_getexp_ps
+  #define _mm256_maskz_getexp_ps(k, a) simde_mm256_maskz_getexp_ps(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_getexp_ps (simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_getexp_ps(a);
+  #else
+    simde__m512_private
+      r_,
+      t_,
+      a_ = simde__m512_to_private(a);
+
+    #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      const __typeof__(a_.i32) abs_ = a_.i32 & INT32_C(0x7FFFFFFF);
+      const __typeof__(a_.i32) den = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i32), abs_ < INT32_C(0x00800000));
+      const __typeof__(a_.i32) zero = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i32), abs_ == 0);
+      const __typeof__(a_.i32) special = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i32), abs_ >= INT32_C(0x7F800000));
+      const __typeof__(a_.i32) nan = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i32), abs_ > INT32_C(0x7F800000));
+
+      t_.i32 = (abs_ & INT32_C(0x007FFFFF)) | INT32_C(0x3F800000);
+      t_.f32 = t_.f32 - SIMDE_FLOAT32_C(1.0);
+      t_.i32 = (t_.i32 & den) | (abs_ & ~den);
+      t_.i32 = ((t_.i32 >> 23) + (~den & INT32_C(126))) | INT32_C(0x4B000000);
+      r_.f32 = t_.f32 - SIMDE_FLOAT32_C(8388861.0);
+
+      r_.i32 = (r_.i32 & ~(zero | special)) | (-INT32_C(0x00800000) & zero) | ((abs_ | (nan & INT32_C(0x00400000))) & special);
+      r_.i32 |= a_.i32 & nan & ~INT32_C(0x7FFFFFFF);
+    #else
+      (void) t_;
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = simde_x_getexp_f32_(a_.f32[i]);
+      }
+    #endif
+
+    return simde__m512_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_getexp_ps
+  #define _mm512_getexp_ps(a) simde_mm512_getexp_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_getexp_ps (simde__m512 src, simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_getexp_ps(src, k, a);
+  #else
+    return simde_mm512_mask_mov_ps(src, k, simde_mm512_getexp_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_getexp_ps
+  #define _mm512_mask_getexp_ps(src, k, a) simde_mm512_mask_getexp_ps(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_getexp_ps (simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_maskz_getexp_ps(k, a);
+  #else
+    return simde_mm512_maskz_mov_ps(k, simde_mm512_getexp_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_getexp_ps
+  #define _mm512_maskz_getexp_ps(k, a) simde_mm512_maskz_getexp_ps(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_getexp_pd (simde__m128d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_getexp_pd(a);
+  #else
+    simde__m128d_private
+      r_,
+      t_,
+      a_ = simde__m128d_to_private(a);
+
+    #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      const __typeof__(a_.i64) abs_ = a_.i64 & INT64_C(0x7FFFFFFFFFFFFFFF);
+      const __typeof__(a_.i64) den = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i64), abs_ < INT64_C(0x0010000000000000));
+      const __typeof__(a_.i64) zero = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i64), abs_ == 0);
+      const __typeof__(a_.i64) special = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i64), abs_ >= INT64_C(0x7FF0000000000000));
+      const __typeof__(a_.i64) nan = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i64), abs_ > INT64_C(0x7FF0000000000000));
+
+      t_.i64 = (abs_ & INT64_C(0x000FFFFFFFFFFFFF)) | INT64_C(0x3FF0000000000000);
+      t_.f64 = t_.f64 - SIMDE_FLOAT64_C(1.0);
+      t_.i64 = (t_.i64 & den) | (abs_ & ~den);
+      t_.i64 = ((t_.i64 >> 52) + (~den & INT64_C(1022))) | INT64_C(0x4330000000000000);
+      r_.f64 = t_.f64 - SIMDE_FLOAT64_C(4503599627372541.0);
+
+      r_.i64 = (r_.i64 & ~(zero | special)) | (-INT64_C(0x0010000000000000) & zero) | ((abs_ | (nan & INT64_C(0x0008000000000000))) & special);
+      r_.i64 |= a_.i64 & nan & ~INT64_C(0x7FFFFFFFFFFFFFFF);
+    #else
+      (void) t_;
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = simde_x_getexp_f64_(a_.f64[i]);
+      }
+    #endif
+
+    return simde__m128d_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_getexp_pd
+  #define _mm_getexp_pd(a) simde_mm_getexp_pd(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_mask_getexp_pd (simde__m128d src, simde__mmask8 k, simde__m128d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_getexp_pd(src, k, a);
+  #else
+    return simde_mm_mask_mov_pd(src, k, simde_mm_getexp_pd(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_getexp_pd
+  #define _mm_mask_getexp_pd(src, k, a) simde_mm_mask_getexp_pd(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_maskz_getexp_pd (simde__mmask8 k, simde__m128d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_getexp_pd(k, a);
+  #else
+    return simde_mm_maskz_mov_pd(k, simde_mm_getexp_pd(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_getexp_pd
+  #define _mm_maskz_getexp_pd(k, a) simde_mm_maskz_getexp_pd(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_getexp_pd (simde__m256d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_getexp_pd(a);
+  #else
+    simde__m256d_private
+      r_,
+      t_,
+      a_ = simde__m256d_to_private(a);
+
+    #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      const __typeof__(a_.i64) abs_ = a_.i64 & INT64_C(0x7FFFFFFFFFFFFFFF);
+      const __typeof__(a_.i64) den = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i64), abs_ < INT64_C(0x0010000000000000));
+      const __typeof__(a_.i64) zero = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i64), abs_ == 0);
+      const __typeof__(a_.i64) special = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i64), abs_ >= INT64_C(0x7FF0000000000000));
+      const __typeof__(a_.i64) nan = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i64), abs_ > INT64_C(0x7FF0000000000000));
+
+      t_.i64 = (abs_ & INT64_C(0x000FFFFFFFFFFFFF)) | INT64_C(0x3FF0000000000000);
+      t_.f64 = t_.f64 - SIMDE_FLOAT64_C(1.0);
+      t_.i64 = (t_.i64 & den) | (abs_ & ~den);
+      t_.i64 = ((t_.i64 >> 52) + (~den & INT64_C(1022))) | INT64_C(0x4330000000000000);
+      r_.f64 = t_.f64 - SIMDE_FLOAT64_C(4503599627372541.0);
+
+      r_.i64 = (r_.i64 & ~(zero | special)) | (-INT64_C(0x0010000000000000) & zero) | ((abs_ | (nan & INT64_C(0x0008000000000000))) & special);
+      r_.i64 |= a_.i64 & nan & ~INT64_C(0x7FFFFFFFFFFFFFFF);
+    #else
+      (void) t_;
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = simde_x_getexp_f64_(a_.f64[i]);
+      }
+    #endif
+
+    return simde__m256d_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_getexp_pd
+  #define _mm256_getexp_pd(a) simde_mm256_getexp_pd(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_mask_getexp_pd (simde__m256d src, simde__mmask8 k, simde__m256d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_getexp_pd(src, k, a);
+  #else
+    return simde_mm256_mask_mov_pd(src, k, simde_mm256_getexp_pd(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_getexp_pd
+  #define _mm256_mask_getexp_pd(src, k, a) simde_mm256_mask_getexp_pd(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_maskz_getexp_pd (simde__mmask8 k, simde__m256d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_getexp_pd(k, a);
+  #else
+    return simde_mm256_maskz_mov_pd(k, simde_mm256_getexp_pd(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_getexp_pd
+  #define _mm256_maskz_getexp_pd(k, a) simde_mm256_maskz_getexp_pd(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_getexp_pd (simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_getexp_pd(a);
+  #else
+    simde__m512d_private
+      r_,
+      t_,
+      a_ = simde__m512d_to_private(a);
+
+    #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      const __typeof__(a_.i64) abs_ = a_.i64 & INT64_C(0x7FFFFFFFFFFFFFFF);
+      const __typeof__(a_.i64) den = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i64), abs_ < INT64_C(0x0010000000000000));
+      const __typeof__(a_.i64) zero = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i64), abs_ == 0);
+      const __typeof__(a_.i64) special = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i64), abs_ >= INT64_C(0x7FF0000000000000));
+      const __typeof__(a_.i64) nan = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i64), abs_ > INT64_C(0x7FF0000000000000));
+
+      t_.i64 = (abs_ & INT64_C(0x000FFFFFFFFFFFFF)) | INT64_C(0x3FF0000000000000);
+      t_.f64 = t_.f64 - SIMDE_FLOAT64_C(1.0);
+      t_.i64 = (t_.i64 & den) | (abs_ & ~den);
+      t_.i64 = ((t_.i64 >> 52) + (~den & INT64_C(1022))) | INT64_C(0x4330000000000000);
+      r_.f64 = t_.f64 - SIMDE_FLOAT64_C(4503599627372541.0);
+
+      r_.i64 = (r_.i64 & ~(zero | special)) | (-INT64_C(0x0010000000000000) & zero) | ((abs_ | (nan & INT64_C(0x0008000000000000))) & special);
+      r_.i64 |= a_.i64 & nan & ~INT64_C(0x7FFFFFFFFFFFFFFF);
+    #else
+      (void) t_;
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = simde_x_getexp_f64_(a_.f64[i]);
+      }
+    #endif
+
+    return simde__m512d_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_getexp_pd
+  #define _mm512_getexp_pd(a) simde_mm512_getexp_pd(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_getexp_pd (simde__m512d src, simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_getexp_pd(src, k, a);
+  #else
+    return simde_mm512_mask_mov_pd(src, k, simde_mm512_getexp_pd(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_getexp_pd
+  #define _mm512_mask_getexp_pd(src, k, a) simde_mm512_mask_getexp_pd(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_getexp_pd (simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_maskz_getexp_pd(k, a);
+  #else
+    return simde_mm512_maskz_mov_pd(k, simde_mm512_getexp_pd(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_getexp_pd
+  #define _mm512_maskz_getexp_pd(k, a) simde_mm512_maskz_getexp_pd(k, a)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_getexp_round_ps(a, sae) _mm512_getexp_round_ps(a, sae)
+#else
+  #define simde_mm512_getexp_round_ps(a, sae) simde_mm512_getexp_ps(a)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_getexp_round_ps
+  #define _mm512_getexp_round_ps(a, sae) simde_mm512_getexp_round_ps(a, sae)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_getexp_round_ps(src, k, a, sae) _mm512_mask_getexp_round_ps(src, k, a, sae)
+#else
+  #define simde_mm512_mask_getexp_round_ps(src, k, a, sae) simde_mm512_mask_getexp_ps(src, k, a)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_getexp_round_ps
+  #define _mm512_mask_getexp_round_ps(src, k, a, sae) simde_mm512_mask_getexp_round_ps(src, k, a, sae)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_maskz_getexp_round_ps(k, a, sae) _mm512_maskz_getexp_round_ps(k, a, sae)
+#else
+  #define simde_mm512_maskz_getexp_round_ps(k, a, sae) simde_mm512_maskz_getexp_ps(k, a)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_getexp_round_ps
+  #define _mm512_maskz_getexp_round_ps(k, a, sae) simde_mm512_maskz_getexp_round_ps(k, a, sae)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_getexp_round_pd(a, sae) _mm512_getexp_round_pd(a, sae)
+#else
+  #define simde_mm512_getexp_round_pd(a, sae) simde_mm512_getexp_pd(a)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_getexp_round_pd
+  #define _mm512_getexp_round_pd(a, sae) simde_mm512_getexp_round_pd(a, sae)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_getexp_round_pd(src, k, a, sae) _mm512_mask_getexp_round_pd(src, k, a, sae)
+#else
+  #define simde_mm512_mask_getexp_round_pd(src, k, a, sae) simde_mm512_mask_getexp_pd(src, k, a)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_getexp_round_pd
+  #define _mm512_mask_getexp_round_pd(src, k, a, sae) simde_mm512_mask_getexp_round_pd(src, k, a, sae)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_maskz_getexp_round_pd(k, a, sae) _mm512_maskz_getexp_round_pd(k, a, sae)
+#else
+  #define simde_mm512_maskz_getexp_round_pd(k, a, sae) simde_mm512_maskz_getexp_pd(k, a)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_getexp_round_pd
+  #define _mm512_maskz_getexp_round_pd(k, a, sae) simde_mm512_maskz_getexp_round_pd(k, a, sae)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_GETEXP_H) */
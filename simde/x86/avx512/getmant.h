@@ -0,0 +1,612 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE_X86_AVX512_GETMANT_H)
+#define SIMDE_X86_AVX512_GETMANT_H
+
+#include "types.h"
+#include "mov.h"
+#include "getexp.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* See getexp.h for how denormals are normalized. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_x_getmant_f32_ (simde_float32 a, int interv, int sc) {
+  int32_t a_, abs_, r_;
+  simde_float32 r;
+  simde_memcpy(&a_, &a, sizeof(a_));
+  abs_ = a_ & INT32_C(0x7FFFFFFF);
+
+  if (abs_ > INT32_C(0x7F800000)) {
+    r_ = a_ | INT32_C(0x00400000);
+  } else if ((sc == SIMDE_MM_MANT_SIGN_nan) && (a_ < 0) && (abs_ != 0)) {
+    r_ = -INT32_C(0x00400000);
+  } else {
+    if ((abs_ == 0) || (abs_ == INT32_C(0x7F800000))) {
+      r_ = INT32_C(0x3F800000);
+    } else {
+      const int32_t n = simde_x_getexp_normalize_f32_(abs_);
+      r_ = n & INT32_C(0x007FFFFF);
+      switch (interv) {
+        case SIMDE_MM_MANT_NORM_1_2:     r_ |= INT32_C(0x3F800000); break;
+        case SIMDE_MM_MANT_NORM_p5_2:    r_ |= INT32_C(0x3F000000) | ((n >> 23) & 1) << 23; break;
+        case SIMDE_MM_MANT_NORM_p5_1:    r_ |= INT32_C(0x3F000000); break;
+        case SIMDE_MM_MANT_NORM_p75_1p5: r_ |= INT32_C(0x3F800000) - ((r_ >> 22) << 23); break;
+        default: break;
+      }
+    }
+    if (!(sc & SIMDE_MM_MANT_SIGN_zero))
+      r_ |= a_ & ~INT32_C(0x7FFFFFFF);
+  }
+
+  simde_memcpy(&r, &r_, sizeof(r));
+  return r;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64
+simde_x_getmant_f64_ (simde_float64 a, int interv, int sc) {
+  int64_t a_, abs_, r_;
+  simde_float64 r;
+  simde_memcpy(&a_, &a, sizeof(a_));
+  abs_ = a_ & INT64_C(0x7FFFFFFFFFFFFFFF);
+
+  if (abs_ > INT64_C(0x7FF0000000000000)) {
+    r_ = a_ | INT64_C(0x0008000000000000);
+  } else if ((sc == SIMDE_MM_MANT_SIGN_nan) && (a_ < 0) && (abs_ != 0)) {
+    r_ = -INT64_C(0x0008000000000000);
+  } else {
+    if ((abs_ == 0) || (abs_ == INT64_C(0x7FF0000000000000))) {
+      r_ = INT64_C(0x3FF0000000000000);
+    } else {
+      const int64_t n = simde_x_getexp_normalize_f64_(abs_);
+      r_ = n & INT64_C(0x000FFFFFFFFFFFFF);
+      switch (interv) {
+        case SIMDE_MM_MANT_NORM_1_2:     r_ |= INT64_C(0x3FF0000000000000); break;
+        case SIMDE_MM_MANT_NORM_p5_2:    r_ |= INT64_C(0x3FE0000000000000) | ((n >> 52) & 1) << 52; break;
+        case SIMDE_MM_MANT_NORM_p5_1:    r_ |= INT64_C(0x3FE0000000000000); break;
+        case SIMDE_MM_MANT_NORM_p75_1p5: r_ |= INT64_C(0x3FF0000000000000) - ((r_ >> 51) << 52); break;
+        default: break;
+      }
+    }
+    if (!(sc & SIMDE_MM_MANT_SIGN_zero))
+      r_ |= a_ & ~INT64_C(0x7FFFFFFFFFFFFFFF);
+  }
+
+  simde_memcpy(&r, &r_, sizeof(r));
+  return r;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_getmant_ps (simde__m128 a, int interv, int sc)
+    SIMDE_REQUIRE_CONSTANT_RANGE(interv, 0, 3)
+    SIMDE_REQUIRE_CONSTANT_RANGE(sc, 0, 2) {
+  simde__m128_private
+    r_,
+    t_,
+    a_ = simde__m128_to_private(a);
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+    const __typeof__(a_.i32) abs_ = a_.i32 & INT32_C(0x7FFFFFFF);
+    const __typeof__(a_.i32) den = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i32), abs_ < INT32_C(0x00800000));
+    const __typeof__(a_.i32) one = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i32), (abs_ == 0) | (abs_ == INT32_C(0x7F800000)));
+    const __typeof__(a_.i32) nan = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i32), abs_ > INT32_C(0x7F800000));
+
+    t_.i32 = (abs_ & INT32_C(0x007FFFFF)) | INT32_C(0x3F800000);
+    t_.f32 = t_.f32 - SIMDE_FLOAT32_C(1.0);
+    t_.i32 = (t_.i32 & den) | (abs_ & ~den);
+    r_.i32 = t_.i32 & INT32_C(0x007FFFFF);
+    switch (interv) {
+      case SIMDE_MM_MANT_NORM_1_2:     r_.i32 |= INT32_C(0x3F800000); break;
+      case SIMDE_MM_MANT_NORM_p5_2:    r_.i32 |= INT32_C(0x3F000000) | ((t_.i32 >> 23) & 1) << 23; break;
+      case SIMDE_MM_MANT_NORM_p5_1:    r_.i32 |= INT32_C(0x3F000000); break;
+      case SIMDE_MM_MANT_NORM_p75_1p5: r_.i32 |= INT32_C(0x3F800000) - ((r_.i32 >> 22) << 23); break;
+      default: break;
+    }
+    r_.i32 = (r_.i32 & ~one) | (INT32_C(0x3F800000) & one);
+
+    if (!(sc & SIMDE_MM_MANT_SIGN_zero))
+      r_.i32 |= a_.i32 & ~INT32_C(0x7FFFFFFF);
+    if (sc == SIMDE_MM_MANT_SIGN_nan) {
+      const __typeof__(a_.i32) neg = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i32), (a_.i32 < 0) & (abs_ != 0));
+      r_.i32 = (r_.i32 & ~neg) | (-INT32_C(0x00400000) & neg);
+    }
+    r_.i32 = (r_.i32 & ~nan) | ((a_.i32 | INT32_C(0x00400000)) & nan);
+  #else
+    (void) t_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+      r_.f32[i] = simde_x_getmant_f32_(a_.f32[i], interv, sc);
+    }
+  #endif
+
+  return simde__m128_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_getmant_ps(a, interv, sc) _mm_getmant_ps((a), HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_getmant_ps
+  #define _mm_getmant_ps(a, interv, sc) simde_mm_getmant_ps(a, interv, sc)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_getmant_ps(src, k, a, interv, sc) _mm_mask_getmant_ps((src), (k), (a), HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#else
+  #define simde_mm_mask_getmant_ps(src, k, a, interv, sc) simde_mm_mask_mov_ps((src), (k), simde_mm_getmant_ps((a), (interv), (sc)))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_getmant_ps
+  #define _mm_mask_getmant_ps(src, k, a, interv, sc) simde_mm_mask_getmant_ps(src, k, a, interv, sc)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_maskz_getmant_ps(k, a, interv, sc) _mm_maskz_getmant_ps((k), (a), HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#else
+  #define simde_mm_maskz_getmant_ps(k, a, interv, sc) simde_mm_maskz_mov_ps((k), simde_mm_getmant_ps((a), (interv), (sc)))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_getmant_ps
+  #define _mm_maskz_getmant_ps(k, a, interv, sc) simde_mm_maskz_getmant_ps(k, a, interv, sc)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_getmant_ps (simde__m256 a, int interv, int sc)
+    SIMDE_REQUIRE_CONSTANT_RANGE(interv, 0, 3)
+    SIMDE_REQUIRE_CONSTANT_RANGE(sc, 0, 2) {
+  simde__m256_private
+    r_,
+    t_,
+    a_ = simde__m256_to_private(a);
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+    const __typeof__(a_.i32) abs_ = a_.i32 & INT32_C(0x7FFFFFFF);
+    const __typeof__(a_.i32) den = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i32), abs_ < INT32_C(0x00800000));
+    const __typeof__(a_.i32) one = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i32), (abs_ == 0) | (abs_ == INT32_C(0x7F800000)));
+    const __typeof__(a_.i32) nan = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i32), abs_ > INT32_C(0x7F800000));
+
+    t_.i32 = (abs_ & INT32_C(0x007FFFFF)) | INT32_C(0x3F800000);
+    t_.f32 = t_.f32 - SIMDE_FLOAT32_C(1.0);
+    t_.i32 = (t_.i32 & den) | (abs_ & ~den);
+    r_.i32 = t_.i32 & INT32_C(0x007FFFFF);
+    switch (interv) {
+      case SIMDE_MM_MANT_NORM_1_2:     r_.i32 |= INT32_C(0x3F800000); break;
+      case SIMDE_MM_MANT_NORM_p5_2:    r_.i32 |= INT32_C(0x3F000000) | ((t_.i32 >> 23) & 1) << 23; break;
+      case SIMDE_MM_MANT_NORM_p5_1:    r_.i32 |= INT32_C(0x3F000000); break;
+      case SIMDE_MM_MANT_NORM_p75_1p5: r_.i32 |= INT32_C(0x3F800000) - ((r_.i32 >> 22) << 23); break;
+      default: break;
+    }
+    r_.i32 = (r_.i32 & ~one) | (INT32_C(0x3F800000) & one);
+
+    if (!(sc & SIMDE_MM_MANT_SIGN_zero))
+      r_.i32 |= a_.i32 & ~INT32_C(0x7FFFFFFF);
+    if (sc == SIMDE_MM_MANT_SIGN_nan) {
+      const __typeof__(a_.i32) neg = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i32), (a_.i32 < 0) & (abs_ != 0));
+      r_.i32 = (r_.i32 & ~neg) | (-INT32_C(0x00400000) & neg);
+    }
+    r_.i32 = (r_.i32 & ~nan) | ((a_.i32 | INT32_C(0x00400000)) & nan);
+  #else
+    (void) t_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+      r_.f32[i] = simde_x_getmant_f32_(a_.f32[i], interv, sc);
+    }
+  #endif
+
+  return simde__m256_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_getmant_ps(a, interv, sc) _mm256_getmant_ps((a), HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_getmant_ps
+  #define _mm256_getmant_ps(a, interv, sc) simde_mm256_getmant_ps(a, interv, sc)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_getmant_ps(src, k, a, interv, sc) _mm256_mask_getmant_ps((src), (k), (a), HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#else
+  #define simde_mm256_mask_getmant_ps(src, k, a, interv, sc) simde_mm256_mask_mov_ps((src), (k), simde_mm256_getmant_ps((a), (interv), (sc)))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_getmant_ps
+  #define _mm256_mask_getmant_ps(src, k, a, interv, sc) simde_mm256_mask_getmant_ps(src, k, a, interv, sc)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_maskz_getmant_ps(k, a, interv, sc) _mm256_maskz_getmant_ps((k), (a), HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#else
+  #define simde_mm256_maskz_getmant_ps(k, a, interv, sc) simde_mm256_maskz_mov_ps((k), simde_mm256_getmant_ps((a), (interv), (sc)))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_getmant_ps
+  #define _mm256_maskz_getmant_ps(k, a, interv, sc) simde_mm256_maskz_getmant_ps(k, a, interv, sc)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_getmant_ps (simde__m512 a, int interv, int sc)
+    SIMDE_REQUIRE_CONSTANT_RANGE(interv, 0, 3)
+    SIMDE_REQUIRE_CONSTANT_RANGE(sc, 0, 2) {
+  simde__m512_private
+    r_,
+    t_,
+    a_ = simde__m512_to_private(a);
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+    const __typeof__(a_.i32) abs_ = a_.i32 & INT32_C(0x7FFFFFFF);
+    const __typeof__(a_.i32) den = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i32), abs_ < INT32_C(0x00800000));
+    const __typeof__(a_.i32) one = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i32), (abs_ == 0) | (abs_ == INT32_C(0x7F800000)));
+    const __typeof__(a_.i32) nan = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i32), abs_ > INT32_C(0x7F800000));
+
+    t_.i32 = (abs_ & INT32_C(0x007FFFFF)) | INT32_C(0x3F800000);
+    t_.f32 = t_.f32 - SIMDE_FLOAT32_C(1.0);
+    t_.i32 = (t_.i32 & den) | (abs_ & ~den);
+    r_.i32 = t_.i32 & INT32_C(0x007FFFFF);
+    switch (interv) {
+      case SIMDE_MM_MANT_NORM_1_2:     r_.i32 |= INT32_C(0x3F800000); break;
+      case SIMDE_MM_MANT_NORM_p5_2:    r_.i32 |= INT32_C(0x3F000000) | ((t_.i32 >> 23) & 1) << 23; break;
+      case SIMDE_MM_MANT_NORM_p5_1:    r_.i32 |= INT32_C(0x3F000000); break;
+      case SIMDE_MM_MANT_NORM_p75_1p5: r_.i32 |= INT32_C(0x3F800000) - ((r_.i32 >> 22) << 23); break;
+      default: break;
+    }
+    r_.i32 = (r_.i32 & ~one) | (INT32_C(0x3F800000) & one);
+
+    if (!(sc & SIMDE_MM_MANT_SIGN_zero))
+      r_.i32 |= a_.i32 & ~INT32_C(0x7FFFFFFF);
+    if (sc == SIMDE_MM_MANT_SIGN_nan) {
+      const __typeof__(a_.i32) neg = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i32), (a_.i32 < 0) & (abs_ != 0));
+      r_.i32 = (r_.i32 & ~neg) | (-INT32_C(0x00400000) & neg);
+    }
+    r_.i32 = (r_.i32 & ~nan) | ((a_.i32 | INT32_C(0x00400000)) & nan);
+  #else
+    (void) t_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+      r_.f32[i] = simde_x_getmant_f32_(a_.f32[i], interv, sc);
+    }
+  #endif
+
+  return simde__m512_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_getmant_ps(a, interv, sc) _mm512_getmant_ps((a), HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_getmant_ps
+  #define _mm512_getmant_ps(a, interv, sc) simde_mm512_getmant_ps(a, interv, sc)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_getmant_ps(src, k, a, interv, sc) _mm512_mask_getmant_ps((src), (k), (a), HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#else
+  #define simde_mm512_mask_getmant_ps(src, k, a, interv, sc) simde_mm512_mask_mov_ps((src), (k), simde_mm512_getmant_ps((a), (interv), (sc)))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_getmant_ps
+  #define _mm512_mask_getmant_ps(src, k, a, interv, sc) simde_mm512_mask_getmant_ps(src, k, a, interv, sc)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_maskz_getmant_ps(k, a, interv, sc) _mm512_maskz_getmant_ps((k), (a), HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#else
+  #define simde_mm512_maskz_getmant_ps(k, a, interv, sc) simde_mm512_maskz_mov_ps((k), simde_mm512_getmant_ps((a), (interv), (sc)))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_getmant_ps
+  #define _mm512_maskz_getmant_ps(k, a, interv, sc) simde_mm512_maskz_getmant_ps(k, a, interv, sc)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_getmant_pd (simde__m128d a, int interv, int sc)
+    SIMDE_REQUIRE_CONSTANT_RANGE(interv, 0, 3)
+    SIMDE_REQUIRE_CONSTANT_RANGE(sc, 0, 2) {
+  simde__m128d_private
+    r_,
+    t_,
+    a_ = simde__m128d_to_private(a);
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+    const __typeof__(a_.i64) abs_ = a_.i64 & INT64_C(0x7FFFFFFFFFFFFFFF);
+    const __typeof__(a_.i64) den = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i64), abs_ < INT64_C(0x0010000000000000));
+    const __typeof__(a_.i64) one = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i64), (abs_ == 0) | (abs_ == INT64_C(0x7FF0000000000000)));
+    const __typeof__(a_.i64) nan = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i64), abs_ > INT64_C(0x7FF0000000000000));
+
+    t_.i64 = (abs_ & INT64_C(0x000FFFFFFFFFFFFF)) | INT64_C(0x3FF0000000000000);
+    t_.f64 = t_.f64 - SIMDE_FLOAT64_C(1.0);
+    t_.i64 = (t_.i64 & den) | (abs_ & ~den);
+    r_.i64 = t_.i64 & INT64_C(0x000FFFFFFFFFFFFF);
+    switch (interv) {
+      case SIMDE_MM_MANT_NORM_1_2:     r_.i64 |= INT64_C(0x3FF0000000000000); break;
+      case SIMDE_MM_MANT_NORM_p5_2:    r_.i64 |= INT64_C(0x3FE0000000000000) | ((t_.i64 >> 52) & 1) << 52; break;
+      case SIMDE_MM_MANT_NORM_p5_1:    r_.i64 |= INT64_C(0x3FE0000000000000); break;
+      case SIMDE_MM_MANT_NORM_p75_1p5: r_.i64 |= INT64_C(0x3FF0000000000000) - ((r_.i64 >> 51) << 52); break;
+      default: break;
+    }
+    r_.i64 = (r_.i64 & ~one) | (INT64_C(0x3FF0000000000000) & one);
+
+    if (!(sc & SIMDE_MM_MANT_SIGN_zero))
+      r_.i64 |= a_.i64 & ~INT64_C(0x7FFFFFFFFFFFFFFF);
+    if (sc == SIMDE_MM_MANT_SIGN_nan) {
+      const __typeof__(a_.i64) neg = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i64), (a_.i64 < 0) & (abs_ != 0));
+      r_.i64 = (r_.i64 & ~neg) | (-INT64_C(0x0008000000000000) & neg);
+    }
+    r_.i64 = (r_.i64 & ~nan) | ((a_.i64 | INT64_C(0x0008000000000000)) & nan);
+  #else
+    (void) t_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+      r_.f64[i] = simde_x_getmant_f64_(a_.f64[i], interv, sc);
+    }
+  #endif
+
+  return simde__m128d_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_getmant_pd(a, interv, sc) _mm_getmant_pd((a), HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_getmant_pd
+  #define _mm_getmant_pd(a, interv, sc) simde_mm_getmant_pd(a, interv, sc)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_getmant_pd(src, k, a, interv, sc) _mm_mask_getmant_pd((src), (k), (a), HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#else
+  #define simde_mm_mask_getmant_pd(src, k, a, interv, sc) simde_mm_mask_mov_pd((src), (k), simde_mm_getmant_pd((a), (interv), (sc)))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_getmant_pd
+  #define _mm_mask_getmant_pd(src, k, a, interv, sc) simde_mm_mask_getmant_pd(src, k, a, interv, sc)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_maskz_getmant_pd(k, a, interv, sc) _mm_maskz_getmant_pd((k), (a), HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#else
+  #define simde_mm_maskz_getmant_pd(k, a, interv, sc) simde_mm_maskz_mov_pd((k), simde_mm_getmant_pd((a), (interv), (sc)))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_getmant_pd
+  #define _mm_maskz_getmant_pd(k, a, interv, sc) simde_mm_maskz_getmant_pd(k, a, interv, sc)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_getmant_pd (simde__m256d a, int interv, int sc)
+    SIMDE_REQUIRE_CONSTANT_RANGE(interv, 0, 3)
+    SIMDE_REQUIRE_CONSTANT_RANGE(sc, 0, 2) {
+  simde__m256d_private
+    r_,
+    t_,
+    a_ = simde__m256d_to_private(a);
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+    const __typeof__(a_.i64) abs_ = a_.i64 & INT64_C(0x7FFFFFFFFFFFFFFF);
+    const __typeof__(a_.i64) den = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i64), abs_ < INT64_C(0x0010000000000000));
+    const __typeof__(a_.i64) one = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i64), (abs_ == 0) | (abs_ == INT64_C(0x7FF0000000000000)));
+    const __typeof__(a_.i64) nan = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i64), abs_ > INT64_C(0x7FF0000000000000));
+
+    t_.i64 = (abs_ & INT64_C(0x000FFFFFFFFFFFFF)) | INT64_C(0x3FF0000000000000);
+    t_.f64 = t_.f64 - SIMDE_FLOAT64_C(1.0);
+    t_.i64 = (t_.i64 & den) | (abs_ & ~den);
+    r_.i64 = t_.i64 & INT64_C(0x000FFFFFFFFFFFFF);
+    switch (interv) {
+      case SIMDE_MM_MANT_NORM_1_2:     r_.i64 |= INT64_C(0x3FF0000000000000); break;
+      case SIMDE_MM_MANT_NORM_p5_2:    r_.i64 |= INT64_C(0x3FE0000000000000) | ((t_.i64 >> 52) & 1) << 52; break;
+      case SIMDE_MM_MANT_NORM_p5_1:    r_.i64 |= INT64_C(0x3FE0000000000000); break;
+      case SIMDE_MM_MANT_NORM_p75_1p5: r_.i64 |= INT64_C(0x3FF0000000000000) - ((r_.i64 >> 51) << 52); break;
+      default: break;
+    }
+    r_.i64 = (r_.i64 & ~one) | (INT64_C(0x3FF0000000000000) & one);
+
+    if (!(sc & SIMDE_MM_MANT_SIGN_zero))
+      r_.i64 |= a_.i64 & ~INT64_C(0x7FFFFFFFFFFFFFFF);
+    if (sc == SIMDE_MM_MANT_SIGN_nan) {
+      const __typeof__(a_.i64) neg = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i64), (a_.i64 < 0) & (abs_ != 0));
+      r_.i64 = (r_.i64 & ~neg) | (-INT64_C(0x0008000000000000) & neg);
+    }
+    r_.i64 = (r_.i64 & ~nan) | ((a_.i64 | INT64_C(0x0008000000000000)) & nan);
+  #else
+    (void) t_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+      r_.f64[i] = simde_x_getmant_f64_(a_.f64[i], interv, sc);
+    }
+  #endif
+
+  return simde__m256d_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_getmant_pd(a, interv, sc) _mm256_getmant_pd((a), HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_getmant_pd
+  #define _mm256_getmant_pd(a, interv, sc) simde_mm256_getmant_pd(a, interv, sc)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_getmant_pd(src, k, a, interv, sc) _mm256_mask_getmant_pd((src), (k), (a), HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#else
+  #define simde_mm256_mask_getmant_pd(src, k, a, interv, sc) simde_mm256_mask_mov_pd((src), (k), simde_mm256_getmant_pd((a), (interv), (sc)))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_getmant_pd
+  #define _mm256_mask_getmant_pd(src, k, a, interv, sc) simde_mm256_mask_getmant_pd(src, k, a, interv, sc)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_maskz_getmant_pd(k, a, interv, sc) _mm256_maskz_getmant_pd((k), (a), HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#else
+  #define simde_mm256_maskz_getmant_pd(k, a, interv, sc) simde_mm256_maskz_mov_pd((k), simde_mm256_getmant_pd((a), (interv), (sc)))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_getmant_pd
+  #define _mm256_maskz_getmant_pd(k, a, interv, sc) simde_mm256_maskz_getmant_pd(k, a, interv, sc)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_getmant_pd (simde__m512d a, int interv, int sc)
+    SIMDE_REQUIRE_CONSTANT_RANGE(interv, 0, 3)
+    SIMDE_REQUIRE_CONSTANT_RANGE(sc, 0, 2) {
+  simde__m512d_private
+    r_,
+    t_,
+    a_ = simde__m512d_to_private(a);
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+    const __typeof__(a_.i64) abs_ = a_.i64 & INT64_C(0x7FFFFFFFFFFFFFFF);
+    const __typeof__(a_.i64) den = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i64), abs_ < INT64_C(0x0010000000000000));
+    const __typeof__(a_.i64) one = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i64), (abs_ == 0) | (abs_ == INT64_C(0x7FF0000000000000)));
+    const __typeof__(a_.i64) nan = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i64), abs_ > INT64_C(0x7FF0000000000000));
+
+    t_.i64 = (abs_ & INT64_C(0x000FFFFFFFFFFFFF)) | INT64_C(0x3FF0000000000000);
+    t_.f64 = t_.f64 - SIMDE_FLOAT64_C(1.0);
+    t_.i64 = (t_.i64 & den) | (abs_ & ~den);
+    r_.i64 = t_.i64 & INT64_C(0x000FFFFFFFFFFFFF);
+    switch (interv) {
+      case SIMDE_MM_MANT_NORM_1_2:     r_.i64 |= INT64_C(0x3FF0000000000000); break;
+      case SIMDE_MM_MANT_NORM_p5_2:    r_.i64 |= INT64_C(0x3FE0000000000000) | ((t_.i64 >> 52) & 1) << 52; break;
+      case SIMDE_MM_MANT_NORM_p5_1:    r_.i64 |= INT64_C(0x3FE0000000000000); break;
+      case SIMDE_MM_MANT_NORM_p75_1p5: r_.i64 |= INT64_C(0x3FF0000000000000) - ((r_.i64 >> 51) << 52); break;
+      default: break;
+    }
+    r_.i64 = (r_.i64 & ~one) | (INT64_C(0x3FF0000000000000) & one);
+
+    if (!(sc & SIMDE_MM_MANT_SIGN_zero))
+      r_.i64 |= a_.i64 & ~INT64_C(0x7FFFFFFFFFFFFFFF);
+    if (sc == SIMDE_MM_MANT_SIGN_nan) {
+      const __typeof__(a_.i64) neg = HEDLEY_REINTERPRET_CAST(__typeof__(a_.i64), (a_.i64 < 0) & (abs_ != 0));
+      r_.i64 = (r_.i64 & ~neg) | (-INT64_C(0x0008000000000000) & neg);
+    }
+    r_.i64 = (r_.i64 & ~nan) | ((a_.i64 | INT64_C(0x0008000000000000)) & nan);
+  #else
+    (void) t_;
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+      r_.f64[i] = simde_x_getmant_f64_(a_.f64[i], interv, sc);
+    }
+  #endif
+
+  return simde__m512d_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_getmant_pd(a, interv, sc) _mm512_getmant_pd((a), HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_getmant_pd
+  #define _mm512_getmant_pd(a, interv, sc) simde_mm512_getmant_pd(a, interv, sc)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_getmant_pd(src, k, a, interv, sc) _mm512_mask_getmant_pd((src), (k), (a), HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#else
+  #define simde_mm512_mask_getmant_pd(src, k, a, interv, sc) simde_mm512_mask_mov_pd((src), (k), simde_mm512_getmant_pd((a), (interv), (sc)))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_getmant_pd
+  #define _mm512_mask_getmant_pd(src, k, a, interv, sc) simde_mm512_mask_getmant_pd(src, k, a, interv, sc)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_maskz_getmant_pd(k, a, interv, sc) _mm512_maskz_getmant_pd((k), (a), HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#else
+  #define simde_mm512_maskz_getmant_pd(k, a, interv, sc) simde_mm512_maskz_mov_pd((k), simde_mm512_getmant_pd((a), (interv), (sc)))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_getmant_pd
+  #define _mm512_maskz_getmant_pd(k, a, interv, sc) simde_mm512_maskz_getmant_pd(k, a, interv, sc)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_getmant_round_ps(a, interv, sc, sae) _mm512_getmant_round_ps(a, HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc), sae)
+#else
+  #define simde_mm512_getmant_round_ps(a, interv, sc, sae) simde_mm512_getmant_ps(a, interv, sc)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_getmant_round_ps
+  #define _mm512_getmant_round_ps(a, interv, sc, sae) simde_mm512_getmant_round_ps(a, interv, sc, sae)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_getmant_round_ps(src, k, a, interv, sc, sae) _mm512_mask_getmant_round_ps(src, k, a, HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc), sae)
+#else
+  #define simde_mm512_mask_getmant_round_ps(src, k, a, interv, sc, sae) simde_mm512_mask_getmant_ps(src, k, a, interv, sc)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_getmant_round_ps
+  #define _mm512_mask_getmant_round_ps(src, k, a, interv, sc, sae) simde_mm512_mask_getmant_round_ps(src, k, a, interv, sc, sae)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_maskz_getmant_round_ps(k, a, interv, sc, sae) _mm512_maskz_getmant_round_ps(k, a, HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc), sae)
+#else
+  #define simde_mm512_maskz_getmant_round_ps(k, a, interv, sc, sae) simde_mm512_maskz_getmant_ps(k, a, interv, sc)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_getmant_round_ps
+  #define _mm512_maskz_getmant_round_ps(k, a, interv, sc, sae) simde_mm512_maskz_getmant_round_ps(k, a, interv, sc, sae)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_getmant_round_pd(a, interv, sc, sae) _mm512_getmant_round_pd(a, HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc), sae)
+#else
+  #define simde_mm512_getmant_round_pd(a, interv, sc, sae) simde_mm512_getmant_pd(a, interv, sc)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_getmant_round_pd
+  #define _mm512_getmant_round_pd(a, interv, sc, sae) simde_mm512_getmant_round_pd(a, interv, sc, sae)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_getmant_round_pd(src, k, a, interv, sc, sae) _mm512_mask_getmant_round_pd(src, k, a, HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc), sae)
+#else
+  #define simde_mm512_mask_getmant_round_pd(src, k, a, interv, sc, sae) simde_mm512_mask_getmant_pd(src, k, a, interv, sc)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_getmant_round_pd
+  #define _mm512_mask_getmant_round_pd(src, k, a, interv, sc, sae) simde_mm512_mask_getmant_round_pd(src, k, a, interv, sc, sae)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_maskz_getmant_round_pd(k, a, interv, sc, sae) _mm512_maskz_getmant_round_pd(k, a, HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc), sae)
+#else
+  #define simde_mm512_maskz_getmant_round_pd(k, a, interv, sc, sae) simde_mm512_maskz_getmant_pd(k, a, interv, sc)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_getmant_round_pd
+  #define _mm512_maskz_getmant_round_pd(k, a, interv, sc, sae) simde_mm512_maskz_getmant_round_pd(k, a, interv, sc, sae)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_GETMANT_H) */
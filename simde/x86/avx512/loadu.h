@@ -73,6 +73,38 @@ simde_mm512_loadu_pd (void const * mem_addr) {
   #define _mm512_loadu_pd(a) simde_mm512_loadu_pd(a)
 #endif
 
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128h
+simde_mm_loadu_ph (void const * mem_addr) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE)
+    return _mm_loadu_ph(mem_addr);
+  #else
+    simde__m128h r;
+    simde_memcpy(&r, mem_addr, sizeof(r));
+    return r;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES)
+  #undef _mm_loadu_ph
+  #define _mm_loadu_ph(a) simde_mm_loadu_ph(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256h
+simde_mm256_loadu_ph (void const * mem_addr) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE)
+    return _mm256_loadu_ph(mem_addr);
+  #else
+    simde__m256h r;
+    simde_memcpy(&r, mem_addr, sizeof(r));
+    return r;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_loadu_ph
+  #define _mm256_loadu_ph(a) simde_mm256_loadu_ph(a)
+#endif
+
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m512h
 simde_mm512_loadu_ph (void const * mem_addr) {
@@ -0,0 +1,617 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE_X86_AVX512_MADD52_H)
+#define SIMDE_X86_AVX512_MADD52_H
+
+#include "types.h"
+#include "mov.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* madd52lo/madd52hi multiply the low 52 bits of each 64-bit lane of b
+ * and c and add the low/high 52 bits of the 104-bit product to a.
+ *
+ * The portable versions split the 52-bit operands into a 32-bit low
+ * half and a 20-bit high half so every partial product is a single
+ * 32x32->64 multiply (pmuludq on x86, vmull_u32 on NEON):
+ *
+ *   b * c = p0 + (p1 << 32) + (p2 << 64)
+ *   p0 = bl * cl, p1 = bl * ch + bh * cl (< 2^53), p2 = bh * ch
+ *
+ * The low half is just (p0 + (p1 << 32)) mod 2^52.  For the high half,
+ * u = (p0 >> 32) + p1 can't overflow and the low 32 bits of p0 can't
+ * carry into bit 52, so it is (u >> 20) + (p2 << 12). */
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_madd52lo_epu64 (simde__m128i a, simde__m128i b, simde__m128i c) {
+  #if defined(SIMDE_X86_AVX512IFMA_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_madd52lo_epu64(a, b, c);
+  #elif defined(SIMDE_X86_AVXIFMA_NATIVE)
+    return _mm_madd52lo_avx_epu64(a, b, c);
+  #else
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      b_ = simde__m128i_to_private(b),
+      c_ = simde__m128i_to_private(c);
+
+    #if defined(SIMDE_X86_SSE2_NATIVE)
+      const __m128i
+        bh = _mm_and_si128(_mm_srli_epi64(b_.n, 32), _mm_set1_epi64x(INT64_C(0xFFFFF))),
+        ch = _mm_and_si128(_mm_srli_epi64(c_.n, 32), _mm_set1_epi64x(INT64_C(0xFFFFF))),
+        p0 = _mm_mul_epu32(b_.n, c_.n),
+        p1 = _mm_add_epi64(_mm_mul_epu32(b_.n, ch), _mm_mul_epu32(bh, c_.n));
+      r_.n = _mm_add_epi64(a_.n, _mm_and_si128(_mm_add_epi64(p0, _mm_slli_epi64(p1, 32)), _mm_set1_epi64x(INT64_C(0x000FFFFFFFFFFFFF))));
+    #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      const uint32x2_t
+        bl = vmovn_u64(b_.neon_u64),
+        cl = vmovn_u64(c_.neon_u64),
+        bh = vand_u32(vshrn_n_u64(b_.neon_u64, 32), vdup_n_u32(UINT32_C(0xFFFFF))),
+        ch = vand_u32(vshrn_n_u64(c_.neon_u64, 32), vdup_n_u32(UINT32_C(0xFFFFF)));
+      const uint64x2_t
+        p0 = vmull_u32(bl, cl),
+        p1 = vmlal_u32(vmull_u32(bl, ch), bh, cl);
+      r_.neon_u64 = vaddq_u64(a_.neon_u64, vandq_u64(vaddq_u64(p0, vshlq_n_u64(p1, 32)), vdupq_n_u64(UINT64_C(0x000FFFFFFFFFFFFF))));
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      const __typeof__(b_.u64)
+        bl = b_.u64 & UINT32_MAX,
+        cl = c_.u64 & UINT32_MAX,
+        bh = (b_.u64 >> 32) & UINT64_C(0xFFFFF),
+        ch = (c_.u64 >> 32) & UINT64_C(0xFFFFF),
+        p0 = bl * cl,
+        p1 = (bl * ch) + (bh * cl);
+      r_.u64 = a_.u64 + ((p0 + (p1 << 32)) & UINT64_C(0x000FFFFFFFFFFFFF));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+        const uint64_t
+          bl = b_.u64[i] & UINT32_MAX,
+          cl = c_.u64[i] & UINT32_MAX,
+          bh = (b_.u64[i] >> 32) & UINT64_C(0xFFFFF),
+          ch = (c_.u64[i] >> 32) & UINT64_C(0xFFFFF),
+          p0 = bl * cl,
+          p1 = (bl * ch) + (bh * cl);
+        r_.u64[i] = a_.u64[i] + ((p0 + (p1 << 32)) & UINT64_C(0x000FFFFFFFFFFFFF));
+      }
+    #endif
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_madd52lo_epu64
+  #define _mm_madd52lo_epu64(a, b, c) simde_mm_madd52lo_epu64(a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_madd52lo_epu64 (simde__m128i a, simde__mmask8 k, simde__m128i b, simde__m128i c) {
+  #if defined(SIMDE_X86_AVX512IFMA_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_madd52lo_epu64(a, k, b, c);
+  #else
+    return simde_mm_mask_mov_epi64(a, k, simde_mm_madd52lo_epu64(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_madd52lo_epu64
+  #define _mm_mask_madd52lo_epu64(a, k, b, c) simde_mm_mask_madd52lo_epu64(a, k, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_madd52lo_epu64 (simde__mmask8 k, simde__m128i a, simde__m128i b, simde__m128i c) {
+  #if defined(SIMDE_X86_AVX512IFMA_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_madd52lo_epu64(k, a, b, c);
+  #else
+    return simde_mm_maskz_mov_epi64(k, simde_mm_madd52lo_epu64(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_madd52lo_epu64
+  #define _mm_maskz_madd52lo_epu64(k, a, b, c) simde_mm_maskz_madd52lo_epu64(k, a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_madd52lo_epu64 (simde__m256i a, simde__m256i b, simde__m256i c) {
+  #if defined(SIMDE_X86_AVX512IFMA_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_madd52lo_epu64(a, b, c);
+  #elif defined(SIMDE_X86_AVXIFMA_NATIVE)
+    return _mm256_madd52lo_avx_epu64(a, b, c);
+  #else
+    simde__m256i_private
+      r_,
+      a_ = simde__m256i_to_private(a),
+      b_ = simde__m256i_to_private(b),
+      c_ = simde__m256i_to_private(c);
+
+    #if defined(SIMDE_X86_AVX2_NATIVE)
+      const __m256i
+        bh = _mm256_and_si256(_mm256_srli_epi64(b_.n, 32), _mm256_set1_epi64x(INT64_C(0xFFFFF))),
+        ch = _mm256_and_si256(_mm256_srli_epi64(c_.n, 32), _mm256_set1_epi64x(INT64_C(0xFFFFF))),
+        p0 = _mm256_mul_epu32(b_.n, c_.n),
+        p1 = _mm256_add_epi64(_mm256_mul_epu32(b_.n, ch), _mm256_mul_epu32(bh, c_.n));
+      r_.n = _mm256_add_epi64(a_.n, _mm256_and_si256(_mm256_add_epi64(p0, _mm256_slli_epi64(p1, 32)), _mm256_set1_epi64x(INT64_C(0x000FFFFFFFFFFFFF))));
+    #elif SIMDE_NATURAL_INT_VECTOR_SIZE_LE(128) || defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      r_.m128i[0] = simde_mm_madd52lo_epu64(a_.m128i[0], b_.m128i[0], c_.m128i[0]);
+      r_.m128i[1] = simde_mm_madd52lo_epu64(a_.m128i[1], b_.m128i[1], c_.m128i[1]);
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      const __typeof__(b_.u64)
+        bl = b_.u64 & UINT32_MAX,
+        cl = c_.u64 & UINT32_MAX,
+        bh = (b_.u64 >> 32) & UINT64_C(0xFFFFF),
+        ch = (c_.u64 >> 32) & UINT64_C(0xFFFFF),
+        p0 = bl * cl,
+        p1 = (bl * ch) + (bh * cl);
+      r_.u64 = a_.u64 + ((p0 + (p1 << 32)) & UINT64_C(0x000FFFFFFFFFFFFF));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+        const uint64_t
+          bl = b_.u64[i] & UINT32_MAX,
+          cl = c_.u64[i] & UINT32_MAX,
+          bh = (b_.u64[i] >> 32) & UINT64_C(0xFFFFF),
+          ch = (c_.u64[i] >> 32) & UINT64_C(0xFFFFF),
+          p0 = bl * cl,
+          p1 = (bl * ch) + (bh * cl);
+        r_.u64[i] = a_.u64[i] + ((p0 + (p1 << 32)) & UINT64_C(0x000FFFFFFFFFFFFF));
+      }
+    #endif
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_madd52lo_epu64
+  #define _mm256_madd52lo_epu64(a, b, c) simde_mm256_madd52lo_epu64(a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_madd52lo_epu64 (simde__m256i a, simde__mmask8 k, simde__m256i b, simde__m256i c) {
+  #if defined(SIMDE_X86_AVX512IFMA_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_madd52lo_epu64(a, k, b, c);
+  #else
+    return simde_mm256_mask_mov_epi64(a, k, simde_mm256_madd52lo_epu64(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_madd52lo_epu64
+  #define _mm256_mask_madd52lo_epu64(a, k, b, c) simde_mm256_mask_madd52lo_epu64(a, k, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_madd52lo_epu64 (simde__mmask8 k, simde__m256i a, simde__m256i b, simde__m256i c) {
+  #if defined(SIMDE_X86_AVX512IFMA_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_madd52lo_epu64(k, a, b, c);
+  #else
+    return simde_mm256_maskz_mov_epi64(k, simde_mm256_madd52lo_epu64(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_madd52lo_epu64
+  #define _mm256_maskz_madd52lo_epu64(k, a, b, c) simde_mm256_maskz_madd52lo_epu64(k, a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_madd52lo_epu64 (simde__m512i a, simde__m512i b, simde__m512i c) {
+  #if defined(SIMDE_X86_AVX512IFMA_NATIVE)
+    return _mm512_madd52lo_epu64(a, b, c);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b),
+      c_ = simde__m512i_to_private(c);
+
+    #if defined(SIMDE_X86_AVX512F_NATIVE)
+      const __m512i
+        bh = _mm512_and_si512(_mm512_srli_epi64(b_.n, 32), _mm512_set1_epi64(INT64_C(0xFFFFF))),
+        ch = _mm512_and_si512(_mm512_srli_epi64(c_.n, 32), _mm512_set1_epi64(INT64_C(0xFFFFF))),
+        p0 = _mm512_mul_epu32(b_.n, c_.n),
+        p1 = _mm512_add_epi64(_mm512_mul_epu32(b_.n, ch), _mm512_mul_epu32(bh, c_.n));
+      r_.n = _mm512_add_epi64(a_.n, _mm512_and_si512(_mm512_add_epi64(p0, _mm512_slli_epi64(p1, 32)), _mm512_set1_epi64(INT64_C(0x000FFFFFFFFFFFFF))));
+    #elif SIMDE_NATURAL_INT_VECTOR_SIZE_LE(256) || defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      r_.m256i[0] = simde_mm256_madd52lo_epu64(a_.m256i[0], b_.m256i[0], c_.m256i[0]);
+      r_.m256i[1] = simde_mm256_madd52lo_epu64(a_.m256i[1], b_.m256i[1], c_.m256i[1]);
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      const __typeof__(b_.u64)
+        bl = b_.u64 & UINT32_MAX,
+        cl = c_.u64 & UINT32_MAX,
+        bh = (b_.u64 >> 32) & UINT64_C(0xFFFFF),
+        ch = (c_.u64 >> 32) & UINT64_C(0xFFFFF),
+        p0 = bl * cl,
+        p1 = (bl * ch) + (bh * cl);
+      r_.u64 = a_.u64 + ((p0 + (p1 << 32)) & UINT64_C(0x000FFFFFFFFFFFFF));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+        const uint64_t
+          bl = b_.u64[i] & UINT32_MAX,
+          cl = c_.u64[i] & UINT32_MAX,
+          bh = (b_.u64[i] >> 32) & UINT64_C(0xFFFFF),
+          ch = (c_.u64[i] >> 32) & UINT64_C(0xFFFFF),
+          p0 = bl * cl,
+          p1 = (bl * ch) + (bh * cl);
+        r_.u64[i] = a_.u64[i] + ((p0 + (p1 << 32)) & UINT64_C(0x000FFFFFFFFFFFFF));
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_madd52lo_epu64
+  #define _mm512_madd52lo_epu64(a, b, c) simde_mm512_madd52lo_epu64(a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_madd52lo_epu64 (simde__m512i a, simde__mmask8 k, simde__m512i b, simde__m512i c) {
+  #if defined(SIMDE_X86_AVX512IFMA_NATIVE)
+    return _mm512_mask_madd52lo_epu64(a, k, b, c);
+  #else
+    return simde_mm512_mask_mov_epi64(a, k, simde_mm512_madd52lo_epu64(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_madd52lo_epu64
+  #define _mm512_mask_madd52lo_epu64(a, k, b, c) simde_mm512_mask_madd52lo_epu64(a, k, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_madd52lo_epu64 (simde__mmask8 k, simde__m512i a, simde__m512i b, simde__m512i c) {
+  #if defined(SIMDE_X86_AVX512IFMA_NATIVE)
+    return _mm512_maskz_madd52lo_epu64(k, a, b, c);
+  #else
+    return simde_mm512_maskz_mov_epi64(k, simde_mm512_madd52lo_epu64(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_madd52lo_epu64
+  #define _mm512_maskz_madd52lo_epu64(k, a, b, c) simde_mm512_maskz_madd52lo_epu64(k, a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_madd52hi_epu64 (simde__m128i a, simde__m128i b, simde__m128i c) {
+  #if defined(SIMDE_X86_AVX512IFMA_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_madd52hi_epu64(a, b, c);
+  #elif defined(SIMDE_X86_AVXIFMA_NATIVE)
+    return _mm_madd52hi_avx_epu64(a, b, c);
+  #else
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      b_ = simde__m128i_to_private(b),
+      c_ = simde__m128i_to_private(c);
+
+    #if defined(SIMDE_X86_SSE2_NATIVE)
+      const __m128i
+        bh = _mm_and_si128(_mm_srli_epi64(b_.n, 32), _mm_set1_epi64x(INT64_C(0xFFFFF))),
+        ch = _mm_and_si128(_mm_srli_epi64(c_.n, 32), _mm_set1_epi64x(INT64_C(0xFFFFF))),
+        p0 = _mm_mul_epu32(b_.n, c_.n),
+        p1 = _mm_add_epi64(_mm_mul_epu32(b_.n, ch), _mm_mul_epu32(bh, c_.n));
+      r_.n = _mm_add_epi64(a_.n, _mm_add_epi64(_mm_srli_epi64(_mm_add_epi64(_mm_srli_epi64(p0, 32), p1), 20), _mm_slli_epi64(_mm_mul_epu32(bh, ch), 12)));
+    #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      const uint32x2_t
+        bl = vmovn_u64(b_.neon_u64),
+        cl = vmovn_u64(c_.neon_u64),
+        bh = vand_u32(vshrn_n_u64(b_.neon_u64, 32), vdup_n_u32(UINT32_C(0xFFFFF))),
+        ch = vand_u32(vshrn_n_u64(c_.neon_u64, 32), vdup_n_u32(UINT32_C(0xFFFFF)));
+      const uint64x2_t
+        p0 = vmull_u32(bl, cl),
+        p1 = vmlal_u32(vmull_u32(bl, ch), bh, cl);
+      r_.neon_u64 = vsraq_n_u64(vaddq_u64(a_.neon_u64, vshlq_n_u64(vmull_u32(bh, ch), 12)), vsraq_n_u64(p1, p0, 32), 20);
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      const __typeof__(b_.u64)
+        bl = b_.u64 & UINT32_MAX,
+        cl = c_.u64 & UINT32_MAX,
+        bh = (b_.u64 >> 32) & UINT64_C(0xFFFFF),
+        ch = (c_.u64 >> 32) & UINT64_C(0xFFFFF),
+        p0 = bl * cl,
+        p1 = (bl * ch) + (bh * cl);
+      r_.u64 = a_.u64 + (((p0 >> 32) + p1) >> 20) + ((bh * ch) << 12);
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+        const uint64_t
+          bl = b_.u64[i] & UINT32_MAX,
+          cl = c_.u64[i] & UINT32_MAX,
+          bh = (b_.u64[i] >> 32) & UINT64_C(0xFFFFF),
+          ch = (c_.u64[i] >> 32) & UINT64_C(0xFFFFF),
+          p0 = bl * cl,
+          p1 = (bl * ch) + (bh * cl);
+        r_.u64[i] = a_.u64[i] + (((p0 >> 32) + p1) >> 20) + ((bh * ch) << 12);
+      }
+    #endif
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_madd52hi_epu64
+  #define _mm_madd52hi_epu64(a, b, c) simde_mm_madd52hi_epu64(a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_madd52hi_epu64 (simde__m128i a, simde__mmask8 k, simde__m128i b, simde__m128i c) {
+  #if defined(SIMDE_X86_AVX512IFMA_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_madd52hi_epu64(a, k, b, c);
+  #else
+    return simde_mm_mask_mov_epi64(a, k, simde_mm_madd52hi_epu64(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_madd52hi_epu64
+  #define _mm_mask_madd52hi_epu64(a, k, b, c) simde_mm_mask_madd52hi_epu64(a, k, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_madd52hi_epu64 (simde__mmask8 k, simde__m128i a, simde__m128i b, simde__m128i c) {
+  #if defined(SIMDE_X86_AVX512IFMA_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_madd52hi_epu64(k, a, b, c);
+  #else
+    return simde_mm_maskz_mov_epi64(k, simde_mm_madd52hi_epu64(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_madd52hi_epu64
+  #define _mm_maskz_madd52hi_epu64(k, a, b, c) simde_mm_maskz_madd52hi_epu64(k, a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_madd52hi_epu64 (simde__m256i a, simde__m256i b, simde__m256i c) {
+  #if defined(SIMDE_X86_AVX512IFMA_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_madd52hi_epu64(a, b, c);
+  #elif defined(SIMDE_X86_AVXIFMA_NATIVE)
+    return _mm256_madd52hi_avx_epu64(a, b, c);
+  #else
+    simde__m256i_private
+      r_,
+      a_ = simde__m256i_to_private(a),
+      b_ = simde__m256i_to_private(b),
+      c_ = simde__m256i_to_private(c);
+
+    #if defined(SIMDE_X86_AVX2_NATIVE)
+      const __m256i
+        bh = _mm256_and_si256(_mm256_srli_epi64(b_.n, 32), _mm256_set1_epi64x(INT64_C(0xFFFFF))),
+        ch = _mm256_and_si256(_mm256_srli_epi64(c_.n, 32), _mm256_set1_epi64x(INT64_C(0xFFFFF))),
+        p0 = _mm256_mul_epu32(b_.n, c_.n),
+        p1 = _mm256_add_epi64(_mm256_mul_epu32(b_.n, ch), _mm256_mul_epu32(bh, c_.n));
+      r_.n = _mm256_add_epi64(a_.n, _mm256_add_epi64(_mm256_srli_epi64(_mm256_add_epi64(_mm256_srli_epi64(p0, 32), p1), 20), _mm256_slli_epi64(_mm256_mul_epu32(bh, ch), 12)));
+    #elif SIMDE_NATURAL_INT_VECTOR_SIZE_LE(128) || defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      r_.m128i[0] = simde_mm_madd52hi_epu64(a_.m128i[0], b_.m128i[0], c_.m128i[0]);
+      r_.m128i[1] = simde_mm_madd52hi_epu64(a_.m128i[1], b_.m128i[1], c_.m128i[1]);
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      const __typeof__(b_.u64)
+        bl = b_.u64 & UINT32_MAX,
+        cl = c_.u64 & UINT32_MAX,
+        bh = (b_.u64 >> 32) & UINT64_C(0xFFFFF),
+        ch = (c_.u64 >> 32) & UINT64_C(0xFFFFF),
+        p0 = bl * cl,
+        p1 = (bl * ch) + (bh * cl);
+      r_.u64 = a_.u64 + (((p0 >> 32) + p1) >> 20) + ((bh * ch) << 12);
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+        const uint64_t
+          bl = b_.u64[i] & UINT32_MAX,
+          cl = c_.u64[i] & UINT32_MAX,
+          bh = (b_.u64[i] >> 32) & UINT64_C(0xFFFFF),
+          ch = (c_.u64[i] >> 32) & UINT64_C(0xFFFFF),
+          p0 = bl * cl,
+          p1 = (bl * ch) + (bh * cl);
+        r_.u64[i] = a_.u64[i] + (((p0 >> 32) + p1) >> 20) + ((bh * ch) << 12);
+      }
+    #endif
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_madd52hi_epu64
+  #define _mm256_madd52hi_epu64(a, b, c) simde_mm256_madd52hi_epu64(a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_madd52hi_epu64 (simde__m256i a, simde__mmask8 k, simde__m256i b, simde__m256i c) {
+  #if defined(SIMDE_X86_AVX512IFMA_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_madd52hi_epu64(a, k, b, c);
+  #else
+    return simde_mm256_mask_mov_epi64(a, k, simde_mm256_madd52hi_epu64(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_madd52hi_epu64
+  #define _mm256_mask_madd52hi_epu64(a, k, b, c) simde_mm256_mask_madd52hi_epu64(a, k, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_madd52hi_epu64 (simde__mmask8 k, simde__m256i a, simde__m256i b, simde__m256i c) {
+  #if defined(SIMDE_X86_AVX512IFMA_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_madd52hi_epu64(k, a, b, c);
+  #else
+    return simde_mm256_maskz_mov_epi64(k, simde_mm256_madd52hi_epu64(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_madd52hi_epu64
+  #define _mm256_maskz_madd52hi_epu64(k, a, b, c) simde_mm256_maskz_madd52hi_epu64(k, a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_madd52hi_epu64 (simde__m512i a, simde__m512i b, simde__m512i c) {
+  #if defined(SIMDE_X86_AVX512IFMA_NATIVE)
+    return _mm512_madd52hi_epu64(a, b, c);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b),
+      c_ = simde__m512i_to_private(c);
+
+    #if defined(SIMDE_X86_AVX512F_NATIVE)
+      const __m512i
+        bh = _mm512_and_si512(_mm512_srli_epi64(b_.n, 32), _mm512_set1_epi64(INT64_C(0xFFFFF))),
+        ch = _mm512_and_si512(_mm512_srli_epi64(c_.n, 32), _mm512_set1_epi64(INT64_C(0xFFFFF))),
+        p0 = _mm512_mul_epu32(b_.n, c_.n),
+        p1 = _mm512_add_epi64(_mm512_mul_epu32(b_.n, ch), _mm512_mul_epu32(bh, c_.n));
+      r_.n = _mm512_add_epi64(a_.n, _mm512_add_epi64(_mm512_srli_epi64(_mm512_add_epi64(_mm512_srli_epi64(p0, 32), p1), 20), _mm512_slli_epi64(_mm512_mul_epu32(bh, ch), 12)));
+    #elif SIMDE_NATURAL_INT_VECTOR_SIZE_LE(256) || defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      r_.m256i[0] = simde_mm256_madd52hi_epu64(a_.m256i[0], b_.m256i[0], c_.m256i[0]);
+      r_.m256i[1] = simde_mm256_madd52hi_epu64(a_.m256i[1], b_.m256i[1], c_.m256i[1]);
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      const __typeof__(b_.u64)
+        bl = b_.u64 & UINT32_MAX,
+        cl = c_.u64 & UINT32_MAX,
+        bh = (b_.u64 >> 32) & UINT64_C(0xFFFFF),
+        ch = (c_.u64 >> 32) & UINT64_C(0xFFFFF),
+        p0 = bl * cl,
+        p1 = (bl * ch) + (bh * cl);
+      r_.u64 = a_.u64 + (((p0 >> 32) + p1) >> 20) + ((bh * ch) << 12);
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+        const uint64_t
+          bl = b_.u64[i] & UINT32_MAX,
+          cl = c_.u64[i] & UINT32_MAX,
+          bh = (b_.u64[i] >> 32) & UINT64_C(0xFFFFF),
+          ch = (c_.u64[i] >> 32) & UINT64_C(0xFFFFF),
+          p0 = bl * cl,
+          p1 = (bl * ch) + (bh * cl);
+        r_.u64[i] = a_.u64[i] + (((p0 >> 32) + p1) >> 20) + ((bh * ch) << 12);
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_madd52hi_epu64
+  #define _mm512_madd52hi_epu64(a, b, c) simde_mm512_madd52hi_epu64(a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_madd52hi_epu64 (simde__m512i a, simde__mmask8 k, simde__m512i b, simde__m512i c) {
+  #if defined(SIMDE_X86_AVX512IFMA_NATIVE)
+    return _mm512_mask_madd52hi_epu64(a, k, b, c);
+  #else
+    return simde_mm512_mask_mov_epi64(a, k, simde_mm512_madd52hi_epu64(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_madd52hi_epu64
+  #define _mm512_mask_madd52hi_epu64(a, k, b, c) simde_mm512_mask_madd52hi_epu64(a, k, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_madd52hi_epu64 (simde__mmask8 k, simde__m512i a, simde__m512i b, simde__m512i c) {
+  #if defined(SIMDE_X86_AVX512IFMA_NATIVE)
+    return _mm512_maskz_madd52hi_epu64(k, a, b, c);
+  #else
+    return simde_mm512_maskz_mov_epi64(k, simde_mm512_madd52hi_epu64(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_madd52hi_epu64
+  #define _mm512_maskz_madd52hi_epu64(k, a, b, c) simde_mm512_maskz_madd52hi_epu64(k, a, b, c)
+#endif
+
+/* AVX-IFMA: the same operations with a VEX encoding and no masking. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_madd52lo_avx_epu64 (simde__m128i a, simde__m128i b, simde__m128i c) {
+  #if defined(SIMDE_X86_AVXIFMA_NATIVE)
+    return _mm_madd52lo_avx_epu64(a, b, c);
+  #else
+    return simde_mm_madd52lo_epu64(a, b, c);
+  #endif
+}
+#if defined(SIMDE_X86_AVXIFMA_ENABLE_NATIVE_ALIASES)
+  #undef _mm_madd52lo_avx_epu64
+  #define _mm_madd52lo_avx_epu64(a, b, c) simde_mm_madd52lo_avx_epu64(a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_madd52lo_avx_epu64 (simde__m256i a, simde__m256i b, simde__m256i c) {
+  #if defined(SIMDE_X86_AVXIFMA_NATIVE)
+    return _mm256_madd52lo_avx_epu64(a, b, c);
+  #else
+    return simde_mm256_madd52lo_epu64(a, b, c);
+  #endif
+}
+#if defined(SIMDE_X86_AVXIFMA_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_madd52lo_avx_epu64
+  #define _mm256_madd52lo_avx_epu64(a, b, c) simde_mm256_madd52lo_avx_epu64(a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_madd52hi_avx_epu64 (simde__m128i a, simde__m128i b, simde__m128i c) {
+  #if defined(SIMDE_X86_AVXIFMA_NATIVE)
+    return _mm_madd52hi_avx_epu64(a, b, c);
+  #else
+    return simde_mm_madd52hi_epu64(a, b, c);
+  #endif
+}
+#if defined(SIMDE_X86_AVXIFMA_ENABLE_NATIVE_ALIASES)
+  #undef _mm_madd52hi_avx_epu64
+  #define _mm_madd52hi_avx_epu64(a, b, c) simde_mm_madd52hi_avx_epu64(a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_madd52hi_avx_epu64 (simde__m256i a, simde__m256i b, simde__m256i c) {
+  #if defined(SIMDE_X86_AVXIFMA_NATIVE)
+    return _mm256_madd52hi_avx_epu64(a, b, c);
+  #else
+    return simde_mm256_madd52hi_epu64(a, b, c);
+  #endif
+}
+#if defined(SIMDE_X86_AVXIFMA_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_madd52hi_avx_epu64
+  #define _mm256_madd52hi_avx_epu64(a, b, c) simde_mm256_madd52hi_avx_epu64(a, b, c)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_MADD52_H) */
@@ -451,6 +451,18 @@ simde_mm512_mask_mov_ps (simde__m512 src, simde__mmask16 k, simde__m512 a) {
   #define _mm512_mask_mov_ps(src, k, a) simde_mm512_mask_mov_ps(src, k, a)
 #endif
 
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128h
+simde_x_mm_mask_mov_ph (simde__m128h src, simde__mmask8 k, simde__m128h a) {
+  return simde_mm_castsi128_ph(simde_mm_mask_mov_epi16(simde_mm_castph_si128(src), k, simde_mm_castph_si128(a)));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256h
+simde_x_mm256_mask_mov_ph (simde__m256h src, simde__mmask16 k, simde__m256h a) {
+  return simde_mm256_castsi256_ph(simde_mm256_mask_mov_epi16(simde_mm256_castph_si256(src), k, simde_mm256_castph_si256(a)));
+}
+
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m512h
 simde_x_mm512_mask_mov_ph (simde__m512h src, simde__mmask32 k, simde__m512h a) {
@@ -859,6 +871,24 @@ simde_mm512_maskz_mov_ps (simde__mmask16 k, simde__m512 a) {
   #define _mm512_maskz_mov_ps(k, a) simde_mm512_maskz_mov_ps(k, a)
 #endif
 
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128h
+simde_x_mm_maskz_mov_ph (simde__mmask8 k, simde__m128h a) {
+  return simde_mm_castsi128_ph(simde_mm_maskz_mov_epi16(k, simde_mm_castph_si128(a)));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256h
+simde_x_mm256_maskz_mov_ph (simde__mmask16 k, simde__m256h a) {
+  return simde_mm256_castsi256_ph(simde_mm256_maskz_mov_epi16(k, simde_mm256_castph_si256(a)));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512h
+simde_x_mm512_maskz_mov_ph (simde__mmask32 k, simde__m512h a) {
+  return simde_mm512_castsi512_ph(simde_mm512_maskz_mov_epi16(k, simde_mm512_castph_si512(a)));
+}
+
 SIMDE_END_DECLS_
 HEDLEY_DIAGNOSTIC_POP
 
@@ -31,6 +31,7 @@
 
 #include "types.h"
 #include "mov.h"
+#include "cvt.h"
 
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
@@ -273,6 +274,141 @@ simde_mm512_maskz_mul_epu32(simde__mmask8 k, simde__m512i a, simde__m512i b) {
   #define _mm512_maskz_mul_epu32(k, a, b) simde_mm512_maskz_mul_epu32(k, a, b)
 #endif
 
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128h
+simde_mm_mul_ph (simde__m128h a, simde__m128h b) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mul_ph(a, b);
+  #else
+    return simde_mm256_cvtxps_ph(simde_mm256_mul_ps(simde_mm256_cvtxph_ps(a), simde_mm256_cvtxph_ps(b)));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mul_ph
+  #define _mm_mul_ph(a, b) simde_mm_mul_ph(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128h
+simde_mm_mask_mul_ph (simde__m128h src, simde__mmask8 k, simde__m128h a, simde__m128h b) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_mul_ph(src, k, a, b);
+  #else
+    return simde_x_mm_mask_mov_ph(src, k, simde_mm_mul_ph(a, b));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_mul_ph
+  #define _mm_mask_mul_ph(src, k, a, b) simde_mm_mask_mul_ph(src, k, a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128h
+simde_mm_maskz_mul_ph (simde__mmask8 k, simde__m128h a, simde__m128h b) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_mul_ph(k, a, b);
+  #else
+    return simde_x_mm_maskz_mov_ph(k, simde_mm_mul_ph(a, b));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_mul_ph
+  #define _mm_maskz_mul_ph(k, a, b) simde_mm_maskz_mul_ph(k, a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256h
+simde_mm256_mul_ph (simde__m256h a, simde__m256h b) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mul_ph(a, b);
+  #else
+    return simde_mm512_cvtxps_ph(simde_mm512_mul_ps(simde_mm512_cvtxph_ps(a), simde_mm512_cvtxph_ps(b)));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mul_ph
+  #define _mm256_mul_ph(a, b) simde_mm256_mul_ph(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256h
+simde_mm256_mask_mul_ph (simde__m256h src, simde__mmask16 k, simde__m256h a, simde__m256h b) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_mul_ph(src, k, a, b);
+  #else
+    return simde_x_mm256_mask_mov_ph(src, k, simde_mm256_mul_ph(a, b));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_mul_ph
+  #define _mm256_mask_mul_ph(src, k, a, b) simde_mm256_mask_mul_ph(src, k, a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256h
+simde_mm256_maskz_mul_ph (simde__mmask16 k, simde__m256h a, simde__m256h b) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_mul_ph(k, a, b);
+  #else
+    return simde_x_mm256_maskz_mov_ph(k, simde_mm256_mul_ph(a, b));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_mul_ph
+  #define _mm256_maskz_mul_ph(k, a, b) simde_mm256_maskz_mul_ph(k, a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512h
+simde_mm512_mul_ph (simde__m512h a, simde__m512h b) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE)
+    return _mm512_mul_ph(a, b);
+  #else
+    simde__m512h_private
+      r_,
+      a_ = simde__m512h_to_private(a),
+      b_ = simde__m512h_to_private(b);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m256h) / sizeof(r_.m256h[0])) ; i++) {
+      r_.m256h[i] = simde_mm256_mul_ph(a_.m256h[i], b_.m256h[i]);
+    }
+
+    return simde__m512h_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mul_ph
+  #define _mm512_mul_ph(a, b) simde_mm512_mul_ph(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512h
+simde_mm512_mask_mul_ph (simde__m512h src, simde__mmask32 k, simde__m512h a, simde__m512h b) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE)
+    return _mm512_mask_mul_ph(src, k, a, b);
+  #else
+    return simde_x_mm512_mask_mov_ph(src, k, simde_mm512_mul_ph(a, b));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_mul_ph
+  #define _mm512_mask_mul_ph(src, k, a, b) simde_mm512_mask_mul_ph(src, k, a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512h
+simde_mm512_maskz_mul_ph (simde__mmask32 k, simde__m512h a, simde__m512h b) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE)
+    return _mm512_maskz_mul_ph(k, a, b);
+  #else
+    return simde_x_mm512_maskz_mov_ph(k, simde_mm512_mul_ph(a, b));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_mul_ph
+  #define _mm512_maskz_mul_ph(k, a, b) simde_mm512_maskz_mul_ph(k, a, b)
+#endif
+
 SIMDE_END_DECLS_
 HEDLEY_DIAGNOSTIC_POP
 
@@ -0,0 +1,785 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE_X86_AVX512_SCATTER_H)
+#define SIMDE_X86_AVX512_SCATTER_H
+
+#include "types.h"
+#include "../avx2.h"
+#include "cast.h"
+#include "extract.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* Every scatter below is split into 128-bit pieces which are stored
+ * one lane at a time, lowest lane first.  That order is what the ISA
+ * specifies when two lanes hit the same address (the highest lane's
+ * value is what ends up in memory), so duplicate indices need no
+ * special handling.  Indices and values are read with lane extracts
+ * (pextrd/pextrq, vgetq_lane, ...) rather than by spilling the whole
+ * vector to a private array first. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_scatter_store_i32_(uint8_t* addr, int64_t vindex, int32_t scale, int32_t v) {
+  simde_memcpy(addr + HEDLEY_STATIC_CAST(ptrdiff_t, vindex * scale), &v, sizeof(v));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_scatter_store_i64_(uint8_t* addr, int64_t vindex, int32_t scale, int64_t v) {
+  simde_memcpy(addr + HEDLEY_STATIC_CAST(ptrdiff_t, vindex * scale), &v, sizeof(v));
+}
+
+/* Four 32-bit indices, four 32-bit values. */
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_mm_i32scatter_32_(uint8_t* addr, simde__m128i vindex, simde__m128i a, simde__mmask8 k, const int32_t scale) {
+  if (k & 1) simde_x_scatter_store_i32_(addr, simde_mm_cvtsi128_si32(vindex),    scale, simde_mm_cvtsi128_si32(a));
+  if (k & 2) simde_x_scatter_store_i32_(addr, simde_mm_extract_epi32(vindex, 1), scale, simde_mm_extract_epi32(a, 1));
+  if (k & 4) simde_x_scatter_store_i32_(addr, simde_mm_extract_epi32(vindex, 2), scale, simde_mm_extract_epi32(a, 2));
+  if (k & 8) simde_x_scatter_store_i32_(addr, simde_mm_extract_epi32(vindex, 3), scale, simde_mm_extract_epi32(a, 3));
+}
+
+/* Four 32-bit indices, four 64-bit values split across a_lo and a_hi. */
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_mm_i32scatter_64_(uint8_t* addr, simde__m128i vindex, simde__m128i a_lo, simde__m128i a_hi, simde__mmask8 k, const int32_t scale) {
+  if (k & 1) simde_x_scatter_store_i64_(addr, simde_mm_cvtsi128_si32(vindex),    scale, simde_mm_cvtsi128_si64(a_lo));
+  if (k & 2) simde_x_scatter_store_i64_(addr, simde_mm_extract_epi32(vindex, 1), scale, simde_mm_extract_epi64(a_lo, 1));
+  if (k & 4) simde_x_scatter_store_i64_(addr, simde_mm_extract_epi32(vindex, 2), scale, simde_mm_cvtsi128_si64(a_hi));
+  if (k & 8) simde_x_scatter_store_i64_(addr, simde_mm_extract_epi32(vindex, 3), scale, simde_mm_extract_epi64(a_hi, 1));
+}
+
+/* Four 64-bit indices split across vindex_lo and vindex_hi, four 32-bit values. */
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_mm_i64scatter_32_(uint8_t* addr, simde__m128i vindex_lo, simde__m128i vindex_hi, simde__m128i a, simde__mmask8 k, const int32_t scale) {
+  if (k & 1) simde_x_scatter_store_i32_(addr, simde_mm_cvtsi128_si64(vindex_lo),    scale, simde_mm_cvtsi128_si32(a));
+  if (k & 2) simde_x_scatter_store_i32_(addr, simde_mm_extract_epi64(vindex_lo, 1), scale, simde_mm_extract_epi32(a, 1));
+  if (k & 4) simde_x_scatter_store_i32_(addr, simde_mm_cvtsi128_si64(vindex_hi),    scale, simde_mm_extract_epi32(a, 2));
+  if (k & 8) simde_x_scatter_store_i32_(addr, simde_mm_extract_epi64(vindex_hi, 1), scale, simde_mm_extract_epi32(a, 3));
+}
+
+/* Two 64-bit indices, two 64-bit values. */
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_mm_i64scatter_64_(uint8_t* addr, simde__m128i vindex, simde__m128i a, simde__mmask8 k, const int32_t scale) {
+  if (k & 1) simde_x_scatter_store_i64_(addr, simde_mm_cvtsi128_si64(vindex),    scale, simde_mm_cvtsi128_si64(a));
+  if (k & 2) simde_x_scatter_store_i64_(addr, simde_mm_extract_epi64(vindex, 1), scale, simde_mm_extract_epi64(a, 1));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_mask_i32scatter_epi32(void* base_addr, simde__mmask8 k, simde__m128i vindex, simde__m128i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  simde_x_mm_i32scatter_32_(addr, vindex, a, k, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_i32scatter_epi32(base_addr, k, vindex, a, scale) _mm_mask_i32scatter_epi32((base_addr), (k), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_i32scatter_epi32
+  #define _mm_mask_i32scatter_epi32(base_addr, k, vindex, a, scale) simde_mm_mask_i32scatter_epi32((base_addr), (k), (vindex), (a), (scale))
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_i32scatter_epi32(base_addr, vindex, a, scale) _mm_i32scatter_epi32((base_addr), (vindex), (a), (scale))
+#else
+  #define simde_mm_i32scatter_epi32(base_addr, vindex, a, scale) simde_mm_mask_i32scatter_epi32((base_addr), HEDLEY_STATIC_CAST(simde__mmask8, ~0), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_i32scatter_epi32
+  #define _mm_i32scatter_epi32(base_addr, vindex, a, scale) simde_mm_i32scatter_epi32((base_addr), (vindex), (a), (scale))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_mask_i32scatter_epi64(void* base_addr, simde__mmask8 k, simde__m128i vindex, simde__m128i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  simde_x_mm_i32scatter_64_(addr, vindex, a, a, HEDLEY_STATIC_CAST(simde__mmask8, k & 3), scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_i32scatter_epi64(base_addr, k, vindex, a, scale) _mm_mask_i32scatter_epi64((base_addr), (k), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_i32scatter_epi64
+  #define _mm_mask_i32scatter_epi64(base_addr, k, vindex, a, scale) simde_mm_mask_i32scatter_epi64((base_addr), (k), (vindex), (a), (scale))
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_i32scatter_epi64(base_addr, vindex, a, scale) _mm_i32scatter_epi64((base_addr), (vindex), (a), (scale))
+#else
+  #define simde_mm_i32scatter_epi64(base_addr, vindex, a, scale) simde_mm_mask_i32scatter_epi64((base_addr), HEDLEY_STATIC_CAST(simde__mmask8, ~0), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_i32scatter_epi64
+  #define _mm_i32scatter_epi64(base_addr, vindex, a, scale) simde_mm_i32scatter_epi64((base_addr), (vindex), (a), (scale))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_mask_i32scatter_pd(void* base_addr, simde__mmask8 k, simde__m128i vindex, simde__m128d a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  simde__m128i a_ = simde_mm_castpd_si128(a);
+  simde_x_mm_i32scatter_64_(addr, vindex, a_, a_, HEDLEY_STATIC_CAST(simde__mmask8, k & 3), scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_i32scatter_pd(base_addr, k, vindex, a, scale) _mm_mask_i32scatter_pd((base_addr), (k), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_i32scatter_pd
+  #define _mm_mask_i32scatter_pd(base_addr, k, vindex, a, scale) simde_mm_mask_i32scatter_pd((base_addr), (k), (vindex), (a), (scale))
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_i32scatter_pd(base_addr, vindex, a, scale) _mm_i32scatter_pd((base_addr), (vindex), (a), (scale))
+#else
+  #define simde_mm_i32scatter_pd(base_addr, vindex, a, scale) simde_mm_mask_i32scatter_pd((base_addr), HEDLEY_STATIC_CAST(simde__mmask8, ~0), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_i32scatter_pd
+  #define _mm_i32scatter_pd(base_addr, vindex, a, scale) simde_mm_i32scatter_pd((base_addr), (vindex), (a), (scale))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_mask_i32scatter_ps(void* base_addr, simde__mmask8 k, simde__m128i vindex, simde__m128 a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  simde__m128i a_ = simde_mm_castps_si128(a);
+  simde_x_mm_i32scatter_32_(addr, vindex, a_, k, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_i32scatter_ps(base_addr, k, vindex, a, scale) _mm_mask_i32scatter_ps((base_addr), (k), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_i32scatter_ps
+  #define _mm_mask_i32scatter_ps(base_addr, k, vindex, a, scale) simde_mm_mask_i32scatter_ps((base_addr), (k), (vindex), (a), (scale))
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_i32scatter_ps(base_addr, vindex, a, scale) _mm_i32scatter_ps((base_addr), (vindex), (a), (scale))
+#else
+  #define simde_mm_i32scatter_ps(base_addr, vindex, a, scale) simde_mm_mask_i32scatter_ps((base_addr), HEDLEY_STATIC_CAST(simde__mmask8, ~0), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_i32scatter_ps
+  #define _mm_i32scatter_ps(base_addr, vindex, a, scale) simde_mm_i32scatter_ps((base_addr), (vindex), (a), (scale))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_mask_i64scatter_epi32(void* base_addr, simde__mmask8 k, simde__m128i vindex, simde__m128i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  simde_x_mm_i64scatter_32_(addr, vindex, vindex, a, HEDLEY_STATIC_CAST(simde__mmask8, k & 3), scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_i64scatter_epi32(base_addr, k, vindex, a, scale) _mm_mask_i64scatter_epi32((base_addr), (k), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_i64scatter_epi32
+  #define _mm_mask_i64scatter_epi32(base_addr, k, vindex, a, scale) simde_mm_mask_i64scatter_epi32((base_addr), (k), (vindex), (a), (scale))
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_i64scatter_epi32(base_addr, vindex, a, scale) _mm_i64scatter_epi32((base_addr), (vindex), (a), (scale))
+#else
+  #define simde_mm_i64scatter_epi32(base_addr, vindex, a, scale) simde_mm_mask_i64scatter_epi32((base_addr), HEDLEY_STATIC_CAST(simde__mmask8, ~0), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_i64scatter_epi32
+  #define _mm_i64scatter_epi32(base_addr, vindex, a, scale) simde_mm_i64scatter_epi32((base_addr), (vindex), (a), (scale))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_mask_i64scatter_epi64(void* base_addr, simde__mmask8 k, simde__m128i vindex, simde__m128i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  simde_x_mm_i64scatter_64_(addr, vindex, a, k, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_i64scatter_epi64(base_addr, k, vindex, a, scale) _mm_mask_i64scatter_epi64((base_addr), (k), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_i64scatter_epi64
+  #define _mm_mask_i64scatter_epi64(base_addr, k, vindex, a, scale) simde_mm_mask_i64scatter_epi64((base_addr), (k), (vindex), (a), (scale))
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_i64scatter_epi64(base_addr, vindex, a, scale) _mm_i64scatter_epi64((base_addr), (vindex), (a), (scale))
+#else
+  #define simde_mm_i64scatter_epi64(base_addr, vindex, a, scale) simde_mm_mask_i64scatter_epi64((base_addr), HEDLEY_STATIC_CAST(simde__mmask8, ~0), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_i64scatter_epi64
+  #define _mm_i64scatter_epi64(base_addr, vindex, a, scale) simde_mm_i64scatter_epi64((base_addr), (vindex), (a), (scale))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_mask_i64scatter_pd(void* base_addr, simde__mmask8 k, simde__m128i vindex, simde__m128d a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  simde__m128i a_ = simde_mm_castpd_si128(a);
+  simde_x_mm_i64scatter_64_(addr, vindex, a_, k, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_i64scatter_pd(base_addr, k, vindex, a, scale) _mm_mask_i64scatter_pd((base_addr), (k), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_i64scatter_pd
+  #define _mm_mask_i64scatter_pd(base_addr, k, vindex, a, scale) simde_mm_mask_i64scatter_pd((base_addr), (k), (vindex), (a), (scale))
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_i64scatter_pd(base_addr, vindex, a, scale) _mm_i64scatter_pd((base_addr), (vindex), (a), (scale))
+#else
+  #define simde_mm_i64scatter_pd(base_addr, vindex, a, scale) simde_mm_mask_i64scatter_pd((base_addr), HEDLEY_STATIC_CAST(simde__mmask8, ~0), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_i64scatter_pd
+  #define _mm_i64scatter_pd(base_addr, vindex, a, scale) simde_mm_i64scatter_pd((base_addr), (vindex), (a), (scale))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_mask_i64scatter_ps(void* base_addr, simde__mmask8 k, simde__m128i vindex, simde__m128 a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  simde__m128i a_ = simde_mm_castps_si128(a);
+  simde_x_mm_i64scatter_32_(addr, vindex, vindex, a_, HEDLEY_STATIC_CAST(simde__mmask8, k & 3), scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_i64scatter_ps(base_addr, k, vindex, a, scale) _mm_mask_i64scatter_ps((base_addr), (k), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_i64scatter_ps
+  #define _mm_mask_i64scatter_ps(base_addr, k, vindex, a, scale) simde_mm_mask_i64scatter_ps((base_addr), (k), (vindex), (a), (scale))
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_i64scatter_ps(base_addr, vindex, a, scale) _mm_i64scatter_ps((base_addr), (vindex), (a), (scale))
+#else
+  #define simde_mm_i64scatter_ps(base_addr, vindex, a, scale) simde_mm_mask_i64scatter_ps((base_addr), HEDLEY_STATIC_CAST(simde__mmask8, ~0), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_i64scatter_ps
+  #define _mm_i64scatter_ps(base_addr, vindex, a, scale) simde_mm_i64scatter_ps((base_addr), (vindex), (a), (scale))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_mask_i32scatter_epi32(void* base_addr, simde__mmask8 k, simde__m256i vindex, simde__m256i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  simde_x_mm_i32scatter_32_(addr, simde_mm256_castsi256_si128(vindex), simde_mm256_castsi256_si128(a), k, scale);
+  simde_x_mm_i32scatter_32_(addr, simde_mm256_extracti128_si256(vindex, 1), simde_mm256_extracti128_si256(a, 1), HEDLEY_STATIC_CAST(simde__mmask8, k >> 4), scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_i32scatter_epi32(base_addr, k, vindex, a, scale) _mm256_mask_i32scatter_epi32((base_addr), (k), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_i32scatter_epi32
+  #define _mm256_mask_i32scatter_epi32(base_addr, k, vindex, a, scale) simde_mm256_mask_i32scatter_epi32((base_addr), (k), (vindex), (a), (scale))
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_i32scatter_epi32(base_addr, vindex, a, scale) _mm256_i32scatter_epi32((base_addr), (vindex), (a), (scale))
+#else
+  #define simde_mm256_i32scatter_epi32(base_addr, vindex, a, scale) simde_mm256_mask_i32scatter_epi32((base_addr), HEDLEY_STATIC_CAST(simde__mmask8, ~0), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_i32scatter_epi32
+  #define _mm256_i32scatter_epi32(base_addr, vindex, a, scale) simde_mm256_i32scatter_epi32((base_addr), (vindex), (a), (scale))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_mask_i32scatter_epi64(void* base_addr, simde__mmask8 k, simde__m128i vindex, simde__m256i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  simde_x_mm_i32scatter_64_(addr, vindex, simde_mm256_castsi256_si128(a), simde_mm256_extracti128_si256(a, 1), k, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_i32scatter_epi64(base_addr, k, vindex, a, scale) _mm256_mask_i32scatter_epi64((base_addr), (k), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_i32scatter_epi64
+  #define _mm256_mask_i32scatter_epi64(base_addr, k, vindex, a, scale) simde_mm256_mask_i32scatter_epi64((base_addr), (k), (vindex), (a), (scale))
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_i32scatter_epi64(base_addr, vindex, a, scale) _mm256_i32scatter_epi64((base_addr), (vindex), (a), (scale))
+#else
+  #define simde_mm256_i32scatter_epi64(base_addr, vindex, a, scale) simde_mm256_mask_i32scatter_epi64((base_addr), HEDLEY_STATIC_CAST(simde__mmask8, ~0), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_i32scatter_epi64
+  #define _mm256_i32scatter_epi64(base_addr, vindex, a, scale) simde_mm256_i32scatter_epi64((base_addr), (vindex), (a), (scale))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_mask_i32scatter_pd(void* base_addr, simde__mmask8 k, simde__m128i vindex, simde__m256d a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  simde__m256i a_ = simde_mm256_castpd_si256(a);
+  simde_x_mm_i32scatter_64_(addr, vindex, simde_mm256_castsi256_si128(a_), simde_mm256_extracti128_si256(a_, 1), k, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_i32scatter_pd(base_addr, k, vindex, a, scale) _mm256_mask_i32scatter_pd((base_addr), (k), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_i32scatter_pd
+  #define _mm256_mask_i32scatter_pd(base_addr, k, vindex, a, scale) simde_mm256_mask_i32scatter_pd((base_addr), (k), (vindex), (a), (scale))
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_i32scatter_pd(base_addr, vindex, a, scale) _mm256_i32scatter_pd((base_addr), (vindex), (a), (scale))
+#else
+  #define simde_mm256_i32scatter_pd(base_addr, vindex, a, scale) simde_mm256_mask_i32scatter_pd((base_addr), HEDLEY_STATIC_CAST(simde__mmask8, ~0), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_i32scatter_pd
+  #define _mm256_i32scatter_pd(base_addr, vindex, a, scale) simde_mm256_i32scatter_pd((base_addr), (vindex), (a), (scale))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_mask_i32scatter_ps(void* base_addr, simde__mmask8 k, simde__m256i vindex, simde__m256 a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  simde__m256i a_ = simde_mm256_castps_si256(a);
+  simde_x_mm_i32scatter_32_(addr, simde_mm256_castsi256_si128(vindex), simde_mm256_castsi256_si128(a_), k, scale);
+  simde_x_mm_i32scatter_32_(addr, simde_mm256_extracti128_si256(vindex, 1), simde_mm256_extracti128_si256(a_, 1), HEDLEY_STATIC_CAST(simde__mmask8, k >> 4), scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_i32scatter_ps(base_addr, k, vindex, a, scale) _mm256_mask_i32scatter_ps((base_addr), (k), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_i32scatter_ps
+  #define _mm256_mask_i32scatter_ps(base_addr, k, vindex, a, scale) simde_mm256_mask_i32scatter_ps((base_addr), (k), (vindex), (a), (scale))
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_i32scatter_ps(base_addr, vindex, a, scale) _mm256_i32scatter_ps((base_addr), (vindex), (a), (scale))
+#else
+  #define simde_mm256_i32scatter_ps(base_addr, vindex, a, scale) simde_mm256_mask_i32scatter_ps((base_addr), HEDLEY_STATIC_CAST(simde__mmask8, ~0), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_i32scatter_ps
+  #define _mm256_i32scatter_ps(base_addr, vindex, a, scale) simde_mm256_i32scatter_ps((base_addr), (vindex), (a), (scale))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_mask_i64scatter_epi32(void* base_addr, simde__mmask8 k, simde__m256i vindex, simde__m128i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  simde_x_mm_i64scatter_32_(addr, simde_mm256_castsi256_si128(vindex), simde_mm256_extracti128_si256(vindex, 1), a, k, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_i64scatter_epi32(base_addr, k, vindex, a, scale) _mm256_mask_i64scatter_epi32((base_addr), (k), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_i64scatter_epi32
+  #define _mm256_mask_i64scatter_epi32(base_addr, k, vindex, a, scale) simde_mm256_mask_i64scatter_epi32((base_addr), (k), (vindex), (a), (scale))
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_i64scatter_epi32(base_addr, vindex, a, scale) _mm256_i64scatter_epi32((base_addr), (vindex), (a), (scale))
+#else
+  #define simde_mm256_i64scatter_epi32(base_addr, vindex, a, scale) simde_mm256_mask_i64scatter_epi32((base_addr), HEDLEY_STATIC_CAST(simde__mmask8, ~0), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_i64scatter_epi32
+  #define _mm256_i64scatter_epi32(base_addr, vindex, a, scale) simde_mm256_i64scatter_epi32((base_addr), (vindex), (a), (scale))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_mask_i64scatter_epi64(void* base_addr, simde__mmask8 k, simde__m256i vindex, simde__m256i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  simde_x_mm_i64scatter_64_(addr, simde_mm256_castsi256_si128(vindex), simde_mm256_castsi256_si128(a), k, scale);
+  simde_x_mm_i64scatter_64_(addr, simde_mm256_extracti128_si256(vindex, 1), simde_mm256_extracti128_si256(a, 1), HEDLEY_STATIC_CAST(simde__mmask8, k >> 2), scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_i64scatter_epi64(base_addr, k, vindex, a, scale) _mm256_mask_i64scatter_epi64((base_addr), (k), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_i64scatter_epi64
+  #define _mm256_mask_i64scatter_epi64(base_addr, k, vindex, a, scale) simde_mm256_mask_i64scatter_epi64((base_addr), (k), (vindex), (a), (scale))
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_i64scatter_epi64(base_addr, vindex, a, scale) _mm256_i64scatter_epi64((base_addr), (vindex), (a), (scale))
+#else
+  #define simde_mm256_i64scatter_epi64(base_addr, vindex, a, scale) simde_mm256_mask_i64scatter_epi64((base_addr), HEDLEY_STATIC_CAST(simde__mmask8, ~0), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_i64scatter_epi64
+  #define _mm256_i64scatter_epi64(base_addr, vindex, a, scale) simde_mm256_i64scatter_epi64((base_addr), (vindex), (a), (scale))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_mask_i64scatter_pd(void* base_addr, simde__mmask8 k, simde__m256i vindex, simde__m256d a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  simde__m256i a_ = simde_mm256_castpd_si256(a);
+  simde_x_mm_i64scatter_64_(addr, simde_mm256_castsi256_si128(vindex), simde_mm256_castsi256_si128(a_), k, scale);
+  simde_x_mm_i64scatter_64_(addr, simde_mm256_extracti128_si256(vindex, 1), simde_mm256_extracti128_si256(a_, 1), HEDLEY_STATIC_CAST(simde__mmask8, k >> 2), scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_i64scatter_pd(base_addr, k, vindex, a, scale) _mm256_mask_i64scatter_pd((base_addr), (k), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_i64scatter_pd
+  #define _mm256_mask_i64scatter_pd(base_addr, k, vindex, a, scale) simde_mm256_mask_i64scatter_pd((base_addr), (k), (vindex), (a), (scale))
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_i64scatter_pd(base_addr, vindex, a, scale) _mm256_i64scatter_pd((base_addr), (vindex), (a), (scale))
+#else
+  #define simde_mm256_i64scatter_pd(base_addr, vindex, a, scale) simde_mm256_mask_i64scatter_pd((base_addr), HEDLEY_STATIC_CAST(simde__mmask8, ~0), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_i64scatter_pd
+  #define _mm256_i64scatter_pd(base_addr, vindex, a, scale) simde_mm256_i64scatter_pd((base_addr), (vindex), (a), (scale))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_mask_i64scatter_ps(void* base_addr, simde__mmask8 k, simde__m256i vindex, simde__m128 a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  simde__m128i a_ = simde_mm_castps_si128(a);
+  simde_x_mm_i64scatter_32_(addr, simde_mm256_castsi256_si128(vindex), simde_mm256_extracti128_si256(vindex, 1), a_, k, scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_i64scatter_ps(base_addr, k, vindex, a, scale) _mm256_mask_i64scatter_ps((base_addr), (k), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_i64scatter_ps
+  #define _mm256_mask_i64scatter_ps(base_addr, k, vindex, a, scale) simde_mm256_mask_i64scatter_ps((base_addr), (k), (vindex), (a), (scale))
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_i64scatter_ps(base_addr, vindex, a, scale) _mm256_i64scatter_ps((base_addr), (vindex), (a), (scale))
+#else
+  #define simde_mm256_i64scatter_ps(base_addr, vindex, a, scale) simde_mm256_mask_i64scatter_ps((base_addr), HEDLEY_STATIC_CAST(simde__mmask8, ~0), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_i64scatter_ps
+  #define _mm256_i64scatter_ps(base_addr, vindex, a, scale) simde_mm256_i64scatter_ps((base_addr), (vindex), (a), (scale))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_i32scatter_epi32(void* base_addr, simde__mmask16 k, simde__m512i vindex, simde__m512i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  const simde__m256i
+    vindex_lo = simde_mm512_castsi512_si256(vindex),
+    vindex_hi = simde_mm512_extracti64x4_epi64(vindex, 1),
+    a_lo = simde_mm512_castsi512_si256(a),
+    a_hi = simde_mm512_extracti64x4_epi64(a, 1);
+  simde_x_mm_i32scatter_32_(addr, simde_mm256_castsi256_si128(vindex_lo), simde_mm256_castsi256_si128(a_lo), HEDLEY_STATIC_CAST(simde__mmask8, k >> 0), scale);
+  simde_x_mm_i32scatter_32_(addr, simde_mm256_extracti128_si256(vindex_lo, 1), simde_mm256_extracti128_si256(a_lo, 1), HEDLEY_STATIC_CAST(simde__mmask8, k >> 4), scale);
+  simde_x_mm_i32scatter_32_(addr, simde_mm256_castsi256_si128(vindex_hi), simde_mm256_castsi256_si128(a_hi), HEDLEY_STATIC_CAST(simde__mmask8, k >> 8), scale);
+  simde_x_mm_i32scatter_32_(addr, simde_mm256_extracti128_si256(vindex_hi, 1), simde_mm256_extracti128_si256(a_hi, 1), HEDLEY_STATIC_CAST(simde__mmask8, k >> 12), scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i32scatter_epi32(base_addr, k, vindex, a, scale) _mm512_mask_i32scatter_epi32((base_addr), (k), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i32scatter_epi32
+  #define _mm512_mask_i32scatter_epi32(base_addr, k, vindex, a, scale) simde_mm512_mask_i32scatter_epi32((base_addr), (k), (vindex), (a), (scale))
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i32scatter_epi32(base_addr, vindex, a, scale) _mm512_i32scatter_epi32((base_addr), (vindex), (a), (scale))
+#else
+  #define simde_mm512_i32scatter_epi32(base_addr, vindex, a, scale) simde_mm512_mask_i32scatter_epi32((base_addr), HEDLEY_STATIC_CAST(simde__mmask16, ~0), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i32scatter_epi32
+  #define _mm512_i32scatter_epi32(base_addr, vindex, a, scale) simde_mm512_i32scatter_epi32((base_addr), (vindex), (a), (scale))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_i32scatter_epi64(void* base_addr, simde__mmask8 k, simde__m256i vindex, simde__m512i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  const simde__m256i
+    a_lo = simde_mm512_castsi512_si256(a),
+    a_hi = simde_mm512_extracti64x4_epi64(a, 1);
+  simde_x_mm_i32scatter_64_(addr, simde_mm256_castsi256_si128(vindex), simde_mm256_castsi256_si128(a_lo), simde_mm256_extracti128_si256(a_lo, 1), k, scale);
+  simde_x_mm_i32scatter_64_(addr, simde_mm256_extracti128_si256(vindex, 1), simde_mm256_castsi256_si128(a_hi), simde_mm256_extracti128_si256(a_hi, 1), HEDLEY_STATIC_CAST(simde__mmask8, k >> 4), scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i32scatter_epi64(base_addr, k, vindex, a, scale) _mm512_mask_i32scatter_epi64((base_addr), (k), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i32scatter_epi64
+  #define _mm512_mask_i32scatter_epi64(base_addr, k, vindex, a, scale) simde_mm512_mask_i32scatter_epi64((base_addr), (k), (vindex), (a), (scale))
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i32scatter_epi64(base_addr, vindex, a, scale) _mm512_i32scatter_epi64((base_addr), (vindex), (a), (scale))
+#else
+  #define simde_mm512_i32scatter_epi64(base_addr, vindex, a, scale) simde_mm512_mask_i32scatter_epi64((base_addr), HEDLEY_STATIC_CAST(simde__mmask8, ~0), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i32scatter_epi64
+  #define _mm512_i32scatter_epi64(base_addr, vindex, a, scale) simde_mm512_i32scatter_epi64((base_addr), (vindex), (a), (scale))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_i32scatter_pd(void* base_addr, simde__mmask8 k, simde__m256i vindex, simde__m512d a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  simde__m512i a_ = simde_mm512_castpd_si512(a);
+  const simde__m256i
+    a_lo = simde_mm512_castsi512_si256(a_),
+    a_hi = simde_mm512_extracti64x4_epi64(a_, 1);
+  simde_x_mm_i32scatter_64_(addr, simde_mm256_castsi256_si128(vindex), simde_mm256_castsi256_si128(a_lo), simde_mm256_extracti128_si256(a_lo, 1), k, scale);
+  simde_x_mm_i32scatter_64_(addr, simde_mm256_extracti128_si256(vindex, 1), simde_mm256_castsi256_si128(a_hi), simde_mm256_extracti128_si256(a_hi, 1), HEDLEY_STATIC_CAST(simde__mmask8, k >> 4), scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i32scatter_pd(base_addr, k, vindex, a, scale) _mm512_mask_i32scatter_pd((base_addr), (k), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i32scatter_pd
+  #define _mm512_mask_i32scatter_pd(base_addr, k, vindex, a, scale) simde_mm512_mask_i32scatter_pd((base_addr), (k), (vindex), (a), (scale))
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i32scatter_pd(base_addr, vindex, a, scale) _mm512_i32scatter_pd((base_addr), (vindex), (a), (scale))
+#else
+  #define simde_mm512_i32scatter_pd(base_addr, vindex, a, scale) simde_mm512_mask_i32scatter_pd((base_addr), HEDLEY_STATIC_CAST(simde__mmask8, ~0), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i32scatter_pd
+  #define _mm512_i32scatter_pd(base_addr, vindex, a, scale) simde_mm512_i32scatter_pd((base_addr), (vindex), (a), (scale))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_i32scatter_ps(void* base_addr, simde__mmask16 k, simde__m512i vindex, simde__m512 a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  simde__m512i a_ = simde_mm512_castps_si512(a);
+  const simde__m256i
+    vindex_lo = simde_mm512_castsi512_si256(vindex),
+    vindex_hi = simde_mm512_extracti64x4_epi64(vindex, 1),
+    a_lo = simde_mm512_castsi512_si256(a_),
+    a_hi = simde_mm512_extracti64x4_epi64(a_, 1);
+  simde_x_mm_i32scatter_32_(addr, simde_mm256_castsi256_si128(vindex_lo), simde_mm256_castsi256_si128(a_lo), HEDLEY_STATIC_CAST(simde__mmask8, k >> 0), scale);
+  simde_x_mm_i32scatter_32_(addr, simde_mm256_extracti128_si256(vindex_lo, 1), simde_mm256_extracti128_si256(a_lo, 1), HEDLEY_STATIC_CAST(simde__mmask8, k >> 4), scale);
+  simde_x_mm_i32scatter_32_(addr, simde_mm256_castsi256_si128(vindex_hi), simde_mm256_castsi256_si128(a_hi), HEDLEY_STATIC_CAST(simde__mmask8, k >> 8), scale);
+  simde_x_mm_i32scatter_32_(addr, simde_mm256_extracti128_si256(vindex_hi, 1), simde_mm256_extracti128_si256(a_hi, 1), HEDLEY_STATIC_CAST(simde__mmask8, k >> 12), scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i32scatter_ps(base_addr, k, vindex, a, scale) _mm512_mask_i32scatter_ps((base_addr), (k), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i32scatter_ps
+  #define _mm512_mask_i32scatter_ps(base_addr, k, vindex, a, scale) simde_mm512_mask_i32scatter_ps((base_addr), (k), (vindex), (a), (scale))
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i32scatter_ps(base_addr, vindex, a, scale) _mm512_i32scatter_ps((base_addr), (vindex), (a), (scale))
+#else
+  #define simde_mm512_i32scatter_ps(base_addr, vindex, a, scale) simde_mm512_mask_i32scatter_ps((base_addr), HEDLEY_STATIC_CAST(simde__mmask16, ~0), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i32scatter_ps
+  #define _mm512_i32scatter_ps(base_addr, vindex, a, scale) simde_mm512_i32scatter_ps((base_addr), (vindex), (a), (scale))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_i64scatter_epi32(void* base_addr, simde__mmask8 k, simde__m512i vindex, simde__m256i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  const simde__m256i
+    vindex_lo = simde_mm512_castsi512_si256(vindex),
+    vindex_hi = simde_mm512_extracti64x4_epi64(vindex, 1);
+  simde_x_mm_i64scatter_32_(addr, simde_mm256_castsi256_si128(vindex_lo), simde_mm256_extracti128_si256(vindex_lo, 1), simde_mm256_castsi256_si128(a), k, scale);
+  simde_x_mm_i64scatter_32_(addr, simde_mm256_castsi256_si128(vindex_hi), simde_mm256_extracti128_si256(vindex_hi, 1), simde_mm256_extracti128_si256(a, 1), HEDLEY_STATIC_CAST(simde__mmask8, k >> 4), scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i64scatter_epi32(base_addr, k, vindex, a, scale) _mm512_mask_i64scatter_epi32((base_addr), (k), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i64scatter_epi32
+  #define _mm512_mask_i64scatter_epi32(base_addr, k, vindex, a, scale) simde_mm512_mask_i64scatter_epi32((base_addr), (k), (vindex), (a), (scale))
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i64scatter_epi32(base_addr, vindex, a, scale) _mm512_i64scatter_epi32((base_addr), (vindex), (a), (scale))
+#else
+  #define simde_mm512_i64scatter_epi32(base_addr, vindex, a, scale) simde_mm512_mask_i64scatter_epi32((base_addr), HEDLEY_STATIC_CAST(simde__mmask8, ~0), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i64scatter_epi32
+  #define _mm512_i64scatter_epi32(base_addr, vindex, a, scale) simde_mm512_i64scatter_epi32((base_addr), (vindex), (a), (scale))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_i64scatter_epi64(void* base_addr, simde__mmask8 k, simde__m512i vindex, simde__m512i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  const simde__m256i
+    vindex_lo = simde_mm512_castsi512_si256(vindex),
+    vindex_hi = simde_mm512_extracti64x4_epi64(vindex, 1),
+    a_lo = simde_mm512_castsi512_si256(a),
+    a_hi = simde_mm512_extracti64x4_epi64(a, 1);
+  simde_x_mm_i64scatter_64_(addr, simde_mm256_castsi256_si128(vindex_lo), simde_mm256_castsi256_si128(a_lo), k, scale);
+  simde_x_mm_i64scatter_64_(addr, simde_mm256_extracti128_si256(vindex_lo, 1), simde_mm256_extracti128_si256(a_lo, 1), HEDLEY_STATIC_CAST(simde__mmask8, k >> 2), scale);
+  simde_x_mm_i64scatter_64_(addr, simde_mm256_castsi256_si128(vindex_hi), simde_mm256_castsi256_si128(a_hi), HEDLEY_STATIC_CAST(simde__mmask8, k >> 4), scale);
+  simde_x_mm_i64scatter_64_(addr, simde_mm256_extracti128_si256(vindex_hi, 1), simde_mm256_extracti128_si256(a_hi, 1), HEDLEY_STATIC_CAST(simde__mmask8, k >> 6), scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i64scatter_epi64(base_addr, k, vindex, a, scale) _mm512_mask_i64scatter_epi64((base_addr), (k), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i64scatter_epi64
+  #define _mm512_mask_i64scatter_epi64(base_addr, k, vindex, a, scale) simde_mm512_mask_i64scatter_epi64((base_addr), (k), (vindex), (a), (scale))
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i64scatter_epi64(base_addr, vindex, a, scale) _mm512_i64scatter_epi64((base_addr), (vindex), (a), (scale))
+#else
+  #define simde_mm512_i64scatter_epi64(base_addr, vindex, a, scale) simde_mm512_mask_i64scatter_epi64((base_addr), HEDLEY_STATIC_CAST(simde__mmask8, ~0), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i64scatter_epi64
+  #define _mm512_i64scatter_epi64(base_addr, vindex, a, scale) simde_mm512_i64scatter_epi64((base_addr), (vindex), (a), (scale))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_i64scatter_pd(void* base_addr, simde__mmask8 k, simde__m512i vindex, simde__m512d a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  simde__m512i a_ = simde_mm512_castpd_si512(a);
+  const simde__m256i
+    vindex_lo = simde_mm512_castsi512_si256(vindex),
+    vindex_hi = simde_mm512_extracti64x4_epi64(vindex, 1),
+    a_lo = simde_mm512_castsi512_si256(a_),
+    a_hi = simde_mm512_extracti64x4_epi64(a_, 1);
+  simde_x_mm_i64scatter_64_(addr, simde_mm256_castsi256_si128(vindex_lo), simde_mm256_castsi256_si128(a_lo), k, scale);
+  simde_x_mm_i64scatter_64_(addr, simde_mm256_extracti128_si256(vindex_lo, 1), simde_mm256_extracti128_si256(a_lo, 1), HEDLEY_STATIC_CAST(simde__mmask8, k >> 2), scale);
+  simde_x_mm_i64scatter_64_(addr, simde_mm256_castsi256_si128(vindex_hi), simde_mm256_castsi256_si128(a_hi), HEDLEY_STATIC_CAST(simde__mmask8, k >> 4), scale);
+  simde_x_mm_i64scatter_64_(addr, simde_mm256_extracti128_si256(vindex_hi, 1), simde_mm256_extracti128_si256(a_hi, 1), HEDLEY_STATIC_CAST(simde__mmask8, k >> 6), scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i64scatter_pd(base_addr, k, vindex, a, scale) _mm512_mask_i64scatter_pd((base_addr), (k), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i64scatter_pd
+  #define _mm512_mask_i64scatter_pd(base_addr, k, vindex, a, scale) simde_mm512_mask_i64scatter_pd((base_addr), (k), (vindex), (a), (scale))
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i64scatter_pd(base_addr, vindex, a, scale) _mm512_i64scatter_pd((base_addr), (vindex), (a), (scale))
+#else
+  #define simde_mm512_i64scatter_pd(base_addr, vindex, a, scale) simde_mm512_mask_i64scatter_pd((base_addr), HEDLEY_STATIC_CAST(simde__mmask8, ~0), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i64scatter_pd
+  #define _mm512_i64scatter_pd(base_addr, vindex, a, scale) simde_mm512_i64scatter_pd((base_addr), (vindex), (a), (scale))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_i64scatter_ps(void* base_addr, simde__mmask8 k, simde__m512i vindex, simde__m256 a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  simde__m256i a_ = simde_mm256_castps_si256(a);
+  const simde__m256i
+    vindex_lo = simde_mm512_castsi512_si256(vindex),
+    vindex_hi = simde_mm512_extracti64x4_epi64(vindex, 1);
+  simde_x_mm_i64scatter_32_(addr, simde_mm256_castsi256_si128(vindex_lo), simde_mm256_extracti128_si256(vindex_lo, 1), simde_mm256_castsi256_si128(a_), k, scale);
+  simde_x_mm_i64scatter_32_(addr, simde_mm256_castsi256_si128(vindex_hi), simde_mm256_extracti128_si256(vindex_hi, 1), simde_mm256_extracti128_si256(a_, 1), HEDLEY_STATIC_CAST(simde__mmask8, k >> 4), scale);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i64scatter_ps(base_addr, k, vindex, a, scale) _mm512_mask_i64scatter_ps((base_addr), (k), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i64scatter_ps
+  #define _mm512_mask_i64scatter_ps(base_addr, k, vindex, a, scale) simde_mm512_mask_i64scatter_ps((base_addr), (k), (vindex), (a), (scale))
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i64scatter_ps(base_addr, vindex, a, scale) _mm512_i64scatter_ps((base_addr), (vindex), (a), (scale))
+#else
+  #define simde_mm512_i64scatter_ps(base_addr, vindex, a, scale) simde_mm512_mask_i64scatter_ps((base_addr), HEDLEY_STATIC_CAST(simde__mmask8, ~0), (vindex), (a), (scale))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i64scatter_ps
+  #define _mm512_i64scatter_ps(base_addr, vindex, a, scale) simde_mm512_i64scatter_ps((base_addr), (vindex), (a), (scale))
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_SCATTER_H) */
@@ -84,6 +84,34 @@ simde_mm512_setzero_pd(void) {
   #define _mm512_setzero_pd() simde_mm512_setzero_pd()
 #endif
 
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128h
+simde_mm_setzero_ph(void) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE)
+    return _mm_setzero_ph();
+  #else
+    return simde_mm_castsi128_ph(simde_mm_setzero_si128());
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES)
+  #undef _mm_setzero_ph
+  #define _mm_setzero_ph() simde_mm_setzero_ph()
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256h
+simde_mm256_setzero_ph(void) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE)
+    return _mm256_setzero_ph();
+  #else
+    return simde_mm256_castsi256_ph(simde_mm256_setzero_si256());
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_setzero_ph
+  #define _mm256_setzero_ph() simde_mm256_setzero_ph()
+#endif
+
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m512h
 simde_mm512_setzero_ph(void) {
@@ -95,6 +95,34 @@ simde_mm512_storeu_pd (void * mem_addr, simde__m512d a) {
   #define _mm512_storeu_pd(mem_addr, a) simde_mm512_storeu_pd(mem_addr, a)
 #endif
 
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_storeu_ph (void * mem_addr, simde__m128h a) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE)
+    _mm_storeu_ph(mem_addr, a);
+  #else
+    simde_memcpy(mem_addr, &a, sizeof(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES)
+  #undef _mm_storeu_ph
+  #define _mm_storeu_ph(mem_addr, a) simde_mm_storeu_ph(mem_addr, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_storeu_ph (void * mem_addr, simde__m256h a) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE)
+    _mm256_storeu_ph(mem_addr, a);
+  #else
+    simde_memcpy(mem_addr, &a, sizeof(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_storeu_ph
+  #define _mm256_storeu_ph(mem_addr, a) simde_mm256_storeu_ph(mem_addr, a)
+#endif
+
 SIMDE_FUNCTION_ATTRIBUTES
 void
 simde_mm512_storeu_ph (void * mem_addr, simde__m512h a) {
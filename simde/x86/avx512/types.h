@@ -28,6 +28,7 @@
 #define SIMDE_X86_AVX512_TYPES_H
 #include "../avx.h"
 #include "../../simde-f16.h"
+#include "../../simde-bf16.h"
 
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
@@ -178,7 +179,7 @@ typedef union {
     SIMDE_ALIGN_TO_32 simde__m128_private m128_private[2];
     SIMDE_ALIGN_TO_32 simde__m128         m128[2];
 
-  #if defined(SIMDE_X86_BF16_NATIVE)
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE)
     SIMDE_ALIGN_TO_32 __m256bh         n;
   #elif defined(SIMDE_POWER_ALTIVEC_P6_NATIVE)
     SIMDE_ALIGN_TO_16 SIMDE_POWER_ALTIVEC_VECTOR(unsigned char)      altivec_u8[2];
@@ -376,6 +377,96 @@ typedef union {
   #endif
 } simde__m512d_private;
 
+typedef union {
+  #if defined(SIMDE_VECTOR_SUBSCRIPT)
+    SIMDE_ALIGN_TO_16 int8_t          i8 SIMDE_VECTOR(16) SIMDE_MAY_ALIAS;
+    SIMDE_ALIGN_TO_16 int16_t        i16 SIMDE_VECTOR(16) SIMDE_MAY_ALIAS;
+    SIMDE_ALIGN_TO_16 int32_t        i32 SIMDE_VECTOR(16) SIMDE_MAY_ALIAS;
+    SIMDE_ALIGN_TO_16 int64_t        i64 SIMDE_VECTOR(16) SIMDE_MAY_ALIAS;
+    SIMDE_ALIGN_TO_16 uint8_t         u8 SIMDE_VECTOR(16) SIMDE_MAY_ALIAS;
+    SIMDE_ALIGN_TO_16 uint16_t       u16 SIMDE_VECTOR(16) SIMDE_MAY_ALIAS;
+    SIMDE_ALIGN_TO_16 uint32_t       u32 SIMDE_VECTOR(16) SIMDE_MAY_ALIAS;
+    SIMDE_ALIGN_TO_16 uint64_t       u64 SIMDE_VECTOR(16) SIMDE_MAY_ALIAS;
+    #if defined(SIMDE_FLOAT16_VECTOR)
+      SIMDE_ALIGN_TO_16 simde_float16  f16 SIMDE_VECTOR(16) SIMDE_MAY_ALIAS;
+    #else
+      SIMDE_ALIGN_TO_16 simde_float16  f16[8];
+    #endif
+    SIMDE_ALIGN_TO_16 simde_float32  f32 SIMDE_VECTOR(16) SIMDE_MAY_ALIAS;
+    SIMDE_ALIGN_TO_16 simde_float64  f64 SIMDE_VECTOR(16) SIMDE_MAY_ALIAS;
+  #else
+    SIMDE_ALIGN_TO_16 int8_t          i8[16];
+    SIMDE_ALIGN_TO_16 int16_t        i16[8];
+    SIMDE_ALIGN_TO_16 int32_t        i32[4];
+    SIMDE_ALIGN_TO_16 int64_t        i64[2];
+    SIMDE_ALIGN_TO_16 uint8_t         u8[16];
+    SIMDE_ALIGN_TO_16 uint16_t       u16[8];
+    SIMDE_ALIGN_TO_16 uint32_t       u32[4];
+    SIMDE_ALIGN_TO_16 uint64_t       u64[2];
+    SIMDE_ALIGN_TO_16 simde_float16  f16[8];
+    SIMDE_ALIGN_TO_16 simde_float32  f32[4];
+    SIMDE_ALIGN_TO_16 simde_float64  f64[2];
+  #endif
+
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE)
+    SIMDE_ALIGN_TO_16 __m128h          n;
+  #endif
+} simde__m128h_private;
+
+#if defined(SIMDE_X86_AVX512FP16_NATIVE)
+  typedef __m128h simde__m128h;
+#elif defined(SIMDE_VECTOR_SUBSCRIPT) && defined(SIMDE_FLOAT16_VECTOR)
+  typedef simde_float16 simde__m128h SIMDE_ALIGN_TO_16 SIMDE_VECTOR(16) SIMDE_MAY_ALIAS;
+#else
+  typedef simde__m128h_private simde__m128h;
+#endif
+
+typedef union {
+  #if defined(SIMDE_VECTOR_SUBSCRIPT)
+    SIMDE_ALIGN_TO_32 int8_t          i8 SIMDE_VECTOR(32) SIMDE_MAY_ALIAS;
+    SIMDE_ALIGN_TO_32 int16_t        i16 SIMDE_VECTOR(32) SIMDE_MAY_ALIAS;
+    SIMDE_ALIGN_TO_32 int32_t        i32 SIMDE_VECTOR(32) SIMDE_MAY_ALIAS;
+    SIMDE_ALIGN_TO_32 int64_t        i64 SIMDE_VECTOR(32) SIMDE_MAY_ALIAS;
+    SIMDE_ALIGN_TO_32 uint8_t         u8 SIMDE_VECTOR(32) SIMDE_MAY_ALIAS;
+    SIMDE_ALIGN_TO_32 uint16_t       u16 SIMDE_VECTOR(32) SIMDE_MAY_ALIAS;
+    SIMDE_ALIGN_TO_32 uint32_t       u32 SIMDE_VECTOR(32) SIMDE_MAY_ALIAS;
+    SIMDE_ALIGN_TO_32 uint64_t       u64 SIMDE_VECTOR(32) SIMDE_MAY_ALIAS;
+    #if defined(SIMDE_FLOAT16_VECTOR)
+      SIMDE_ALIGN_TO_32 simde_float16  f16 SIMDE_VECTOR(32) SIMDE_MAY_ALIAS;
+    #else
+      SIMDE_ALIGN_TO_32 simde_float16  f16[16];
+    #endif
+    SIMDE_ALIGN_TO_32 simde_float32  f32 SIMDE_VECTOR(32) SIMDE_MAY_ALIAS;
+    SIMDE_ALIGN_TO_32 simde_float64  f64 SIMDE_VECTOR(32) SIMDE_MAY_ALIAS;
+  #else
+    SIMDE_ALIGN_TO_32 int8_t          i8[32];
+    SIMDE_ALIGN_TO_32 int16_t        i16[16];
+    SIMDE_ALIGN_TO_32 int32_t        i32[8];
+    SIMDE_ALIGN_TO_32 int64_t        i64[4];
+    SIMDE_ALIGN_TO_32 uint8_t         u8[32];
+    SIMDE_ALIGN_TO_32 uint16_t       u16[16];
+    SIMDE_ALIGN_TO_32 uint32_t       u32[8];
+    SIMDE_ALIGN_TO_32 uint64_t       u64[4];
+    SIMDE_ALIGN_TO_32 simde_float16  f16[16];
+    SIMDE_ALIGN_TO_32 simde_float32  f32[8];
+    SIMDE_ALIGN_TO_32 simde_float64  f64[4];
+  #endif
+
+    SIMDE_ALIGN_TO_32 simde__m128h      m128h[2];
+
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE)
+    SIMDE_ALIGN_TO_32 __m256h          n;
+  #endif
+} simde__m256h_private;
+
+#if defined(SIMDE_X86_AVX512FP16_NATIVE)
+  typedef __m256h simde__m256h;
+#elif defined(SIMDE_VECTOR_SUBSCRIPT) && defined(SIMDE_FLOAT16_VECTOR)
+  typedef simde_float16 simde__m256h SIMDE_ALIGN_TO_32 SIMDE_VECTOR(32) SIMDE_MAY_ALIAS;
+#else
+  typedef simde__m256h_private simde__m256h;
+#endif
+
 typedef union {
   #if defined(SIMDE_VECTOR_SUBSCRIPT)
     SIMDE_AVX512_ALIGN int8_t          i8 SIMDE_VECTOR(64) SIMDE_MAY_ALIAS;
@@ -423,6 +514,7 @@ typedef union {
     SIMDE_AVX512_ALIGN simde__m128d         m128d[4];
     SIMDE_AVX512_ALIGN simde__m256d_private m256d_private[2];
     SIMDE_AVX512_ALIGN simde__m256d         m256d[2];
+    SIMDE_AVX512_ALIGN simde__m256h         m256h[2];
 
   #if defined(SIMDE_X86_AVX512FP16_NATIVE)
     SIMDE_AVX512_ALIGN __m512h        n;
@@ -643,12 +735,12 @@ typedef uint64_t simde__mmask64;
 
 #if !defined(SIMDE_X86_AVX512FP16_NATIVE) && defined(SIMDE_ENABLE_NATIVE_ALIASES)
   #if !defined(HEDLEY_INTEL_VERSION)
-    //typedef simde__m128h __m128h;
-    //typedef simde__m256h __m256h;
+    typedef simde__m128h __m128h;
+    typedef simde__m256h __m256h;
     typedef simde__m512h __m512h;
   #else
-    //#define __m128h simde__m128h
-    //#define __m256h simde__m256h
+    #define __m128h simde__m128h
+    #define __m256h simde__m256h
     #define __m512h simde__m512h
   #endif
 #endif
@@ -665,6 +757,10 @@ HEDLEY_STATIC_ASSERT(64 == sizeof(simde__m512i), "simde__m512i size incorrect");
 HEDLEY_STATIC_ASSERT(64 == sizeof(simde__m512i_private), "simde__m512i_private size incorrect");
 HEDLEY_STATIC_ASSERT(64 == sizeof(simde__m512d), "simde__m512d size incorrect");
 HEDLEY_STATIC_ASSERT(64 == sizeof(simde__m512d_private), "simde__m512d_private size incorrect");
+HEDLEY_STATIC_ASSERT(16 == sizeof(simde__m128h), "simde__m128h size incorrect");
+HEDLEY_STATIC_ASSERT(16 == sizeof(simde__m128h_private), "simde__m128h_private size incorrect");
+HEDLEY_STATIC_ASSERT(32 == sizeof(simde__m256h), "simde__m256h size incorrect");
+HEDLEY_STATIC_ASSERT(32 == sizeof(simde__m256h_private), "simde__m256h_private size incorrect");
 HEDLEY_STATIC_ASSERT(64 == sizeof(simde__m512h), "simde__m512h size incorrect");
 HEDLEY_STATIC_ASSERT(64 == sizeof(simde__m512h_private), "simde__m512h_private size incorrect");
 #if defined(SIMDE_CHECK_ALIGNMENT) && defined(SIMDE_ALIGN_OF)
@@ -703,6 +799,23 @@ HEDLEY_STATIC_ASSERT(SIMDE_ALIGN_OF(simde__m512h_private) == 32, "simde__m512h_p
 #define _MM_CMPINT_TRUE SIMDE_CMPINT_TRUE
 #endif
 
+#define SIMDE_MM_MANT_NORM_1_2      0
+#define SIMDE_MM_MANT_NORM_p5_2     1
+#define SIMDE_MM_MANT_NORM_p5_1     2
+#define SIMDE_MM_MANT_NORM_p75_1p5  3
+#define SIMDE_MM_MANT_SIGN_src      0
+#define SIMDE_MM_MANT_SIGN_zero     1
+#define SIMDE_MM_MANT_SIGN_nan      2
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+#define _MM_MANT_NORM_1_2 SIMDE_MM_MANT_NORM_1_2
+#define _MM_MANT_NORM_p5_2 SIMDE_MM_MANT_NORM_p5_2
+#define _MM_MANT_NORM_p5_1 SIMDE_MM_MANT_NORM_p5_1
+#define _MM_MANT_NORM_p75_1p5 SIMDE_MM_MANT_NORM_p75_1p5
+#define _MM_MANT_SIGN_src SIMDE_MM_MANT_SIGN_src
+#define _MM_MANT_SIGN_zero SIMDE_MM_MANT_SIGN_zero
+#define _MM_MANT_SIGN_nan SIMDE_MM_MANT_SIGN_nan
+#endif
+
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m128bh
 simde__m128bh_from_private(simde__m128bh_private v) {
@@ -799,6 +912,38 @@ simde__m512d_to_private(simde__m512d v) {
   return r;
 }
 
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128h
+simde__m128h_from_private(simde__m128h_private v) {
+  simde__m128h r;
+  simde_memcpy(&r, &v, sizeof(r));
+  return r;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128h_private
+simde__m128h_to_private(simde__m128h v) {
+  simde__m128h_private r;
+  simde_memcpy(&r, &v, sizeof(r));
+  return r;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256h
+simde__m256h_from_private(simde__m256h_private v) {
+  simde__m256h r;
+  simde_memcpy(&r, &v, sizeof(r));
+  return r;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256h_private
+simde__m256h_to_private(simde__m256h v) {
+  simde__m256h_private r;
+  simde_memcpy(&r, &v, sizeof(r));
+  return r;
+}
+
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m512h
 simde__m512h_from_private(simde__m512h_private v) {
@@ -0,0 +1,157 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* AVX-NE-CONVERT: VEX-encoded BF16 loads and conversions.
+ *
+ * Widening a bfloat16 to binary32 is exact (it just becomes the upper
+ * half of the float), so the even/odd loads are a shift or a mask of
+ * the 32-bit lanes.  The narrowing conversion is the same as the
+ * AVX512_BF16 one.  The FP16 forms (_mm*_cvtneeph_ps, _mm*_cvtneoph_ps,
+ * _mm*_bcstnesh_ps) are not implemented yet since we don't have a
+ * __m128h type. */
+
+#if !defined(SIMDE_X86_AVXNECONVERT_H)
+#define SIMDE_X86_AVXNECONVERT_H
+
+#include "avx512/cvt.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_bcstnebf16_ps (const simde_bfloat16* a) {
+  #if defined(SIMDE_X86_AVXNECONVERT_NATIVE)
+    return _mm_bcstnebf16_ps(HEDLEY_REINTERPRET_CAST(const __bf16*, a));
+  #else
+    return simde_mm_castsi128_ps(simde_mm_set1_epi32(HEDLEY_STATIC_CAST(int32_t, HEDLEY_STATIC_CAST(uint32_t, simde_bfloat16_as_uint16(*a)) << 16)));
+  #endif
+}
+#if defined(SIMDE_X86_AVXNECONVERT_ENABLE_NATIVE_ALIASES)
+  #undef _mm_bcstnebf16_ps
+  #define _mm_bcstnebf16_ps(a) simde_mm_bcstnebf16_ps(HEDLEY_REINTERPRET_CAST(const simde_bfloat16*, a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_bcstnebf16_ps (const simde_bfloat16* a) {
+  #if defined(SIMDE_X86_AVXNECONVERT_NATIVE)
+    return _mm256_bcstnebf16_ps(HEDLEY_REINTERPRET_CAST(const __bf16*, a));
+  #else
+    return simde_mm256_castsi256_ps(simde_mm256_set1_epi32(HEDLEY_STATIC_CAST(int32_t, HEDLEY_STATIC_CAST(uint32_t, simde_bfloat16_as_uint16(*a)) << 16)));
+  #endif
+}
+#if defined(SIMDE_X86_AVXNECONVERT_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_bcstnebf16_ps
+  #define _mm256_bcstnebf16_ps(a) simde_mm256_bcstnebf16_ps(HEDLEY_REINTERPRET_CAST(const simde_bfloat16*, a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_cvtneebf16_ps (const simde__m128bh* a) {
+  #if defined(SIMDE_X86_AVXNECONVERT_NATIVE)
+    return _mm_cvtneebf16_ps(a);
+  #else
+    return simde_mm_castsi128_ps(simde_mm_slli_epi32(simde_x_mm_castpbh_si128(*a), 16));
+  #endif
+}
+#if defined(SIMDE_X86_AVXNECONVERT_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cvtneebf16_ps
+  #define _mm_cvtneebf16_ps(a) simde_mm_cvtneebf16_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_cvtneebf16_ps (const simde__m256bh* a) {
+  #if defined(SIMDE_X86_AVXNECONVERT_NATIVE)
+    return _mm256_cvtneebf16_ps(a);
+  #else
+    return simde_mm256_castsi256_ps(simde_mm256_slli_epi32(simde_x_mm256_castpbh_si256(*a), 16));
+  #endif
+}
+#if defined(SIMDE_X86_AVXNECONVERT_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_cvtneebf16_ps
+  #define _mm256_cvtneebf16_ps(a) simde_mm256_cvtneebf16_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_cvtneobf16_ps (const simde__m128bh* a) {
+  #if defined(SIMDE_X86_AVXNECONVERT_NATIVE)
+    return _mm_cvtneobf16_ps(a);
+  #else
+    return simde_mm_castsi128_ps(simde_mm_and_si128(simde_x_mm_castpbh_si128(*a), simde_mm_set1_epi32(~INT32_C(0xFFFF))));
+  #endif
+}
+#if defined(SIMDE_X86_AVXNECONVERT_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cvtneobf16_ps
+  #define _mm_cvtneobf16_ps(a) simde_mm_cvtneobf16_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_cvtneobf16_ps (const simde__m256bh* a) {
+  #if defined(SIMDE_X86_AVXNECONVERT_NATIVE)
+    return _mm256_cvtneobf16_ps(a);
+  #else
+    return simde_mm256_castsi256_ps(simde_mm256_and_si256(simde_x_mm256_castpbh_si256(*a), simde_mm256_set1_epi32(~INT32_C(0xFFFF))));
+  #endif
+}
+#if defined(SIMDE_X86_AVXNECONVERT_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_cvtneobf16_ps
+  #define _mm256_cvtneobf16_ps(a) simde_mm256_cvtneobf16_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128bh
+simde_mm_cvtneps_avx_pbh (simde__m128 a) {
+  #if defined(SIMDE_X86_AVXNECONVERT_NATIVE)
+    return _mm_cvtneps_avx_pbh(a);
+  #else
+    return simde_mm_cvtneps_pbh(a);
+  #endif
+}
+#if defined(SIMDE_X86_AVXNECONVERT_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cvtneps_avx_pbh
+  #define _mm_cvtneps_avx_pbh(a) simde_mm_cvtneps_avx_pbh(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128bh
+simde_mm256_cvtneps_avx_pbh (simde__m256 a) {
+  #if defined(SIMDE_X86_AVXNECONVERT_NATIVE)
+    return _mm256_cvtneps_avx_pbh(a);
+  #else
+    return simde_mm256_cvtneps_pbh(a);
+  #endif
+}
+#if defined(SIMDE_X86_AVXNECONVERT_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_cvtneps_avx_pbh
+  #define _mm256_cvtneps_avx_pbh(a) simde_mm256_cvtneps_avx_pbh(a)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVXNECONVERT_H) */
@@ -28,6 +28,7 @@
 
 #include "avx512/add.h"
 #include "avx512/and.h"
+#include "avx512/blend.h"
 #include "avx512/broadcast.h"
 #include "avx512/cmpeq.h"
 #include "avx512/cmpge.h"
@@ -43,6 +44,7 @@
 #include "avx512/set1.h"
 #include "avx512/setzero.h"
 #include "avx512/shuffle.h"
+#include "avx512/slli.h"
 #include "avx512/srli.h"
 #include "avx512/test.h"
 #include "avx512/xor.h"
@@ -85,31 +87,61 @@ static const union {
   }
 };
 
+/* The 8x8 bit-matrix product of a byte with a constant matrix is linear,
+ * so it can be split into two 16-entry lookups, one for each nibble of
+ * the byte, which map directly onto pshufb/vqtbl1q_u8.  Building the
+ * tables only depends on A: after transposing each matrix so that byte j
+ * holds the image of bit j, we form the four partial sums over bits
+ * {0,1}, {2,3}, {4,5} and {6,7} of each matrix (rows 0-3 below) and then
+ * combine two of those per nibble value (rows 4-7).  When A is
+ * loop-invariant, as it usually is, the compiler can hoist all of this
+ * out of the caller's loop and the remaining work is two shuffles per
+ * matrix. */
+
+static const union {
+  uint8_t      u8[8][16];
+  simde__m128i m128i[8];
+} simde_x_gf2p8matrix_nibble_idx = {
+  {
+    { 0x80, 0x00, 0x01, 0x01, 0x80, 0x02, 0x03, 0x03, 0x80, 0x04, 0x05, 0x05, 0x80, 0x06, 0x07, 0x07 },
+    { 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x06 },
+    { 0x80, 0x08, 0x09, 0x09, 0x80, 0x0a, 0x0b, 0x0b, 0x80, 0x0c, 0x0d, 0x0d, 0x80, 0x0e, 0x0f, 0x0f },
+    { 0x80, 0x80, 0x80, 0x08, 0x80, 0x80, 0x80, 0x0a, 0x80, 0x80, 0x80, 0x0c, 0x80, 0x80, 0x80, 0x0e },
+    { 0x00, 0x01, 0x02, 0x03, 0x00, 0x01, 0x02, 0x03, 0x00, 0x01, 0x02, 0x03, 0x00, 0x01, 0x02, 0x03 },
+    { 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07, 0x07 },
+    { 0x08, 0x09, 0x0a, 0x0b, 0x08, 0x09, 0x0a, 0x0b, 0x08, 0x09, 0x0a, 0x0b, 0x08, 0x09, 0x0a, 0x0b },
+    { 0x0c, 0x0c, 0x0c, 0x0c, 0x0d, 0x0d, 0x0d, 0x0d, 0x0e, 0x0e, 0x0e, 0x0e, 0x0f, 0x0f, 0x0f, 0x0f }
+  }
+};
+
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m128i
 simde_x_mm_gf2p8matrix_multiply_epi64_epi8 (simde__m128i x, simde__m128i A) {
   #if defined(SIMDE_X86_SSSE3_NATIVE)
-    const __m128i byte_select = _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1);
-    const __m128i zero = _mm_setzero_si128();
-    __m128i r, a, p, X;
-
-    a = _mm_shuffle_epi8(A, _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8));
-    X = x;
-    r = zero;
-
-    #if !defined(__INTEL_COMPILER)
-      SIMDE_VECTORIZE
-    #endif
-    for (int i = 0 ; i < 8 ; i++) {
-      p = _mm_insert_epi16(zero, _mm_movemask_epi8(a), 0);
-      p = _mm_shuffle_epi8(p, byte_select);
-      p = _mm_and_si128(p, _mm_cmpgt_epi8(zero, X));
-      r = _mm_xor_si128(r, p);
-      a = _mm_add_epi8(a, a);
-      X = _mm_add_epi8(X, X);
-    }
-
-    return r;
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    __m128i c, t, w0, w1, tl0, th0, tl1, th1, lo, hi, r0, r1;
+
+    c = _mm_shuffle_epi8(A, _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8));
+    t = _mm_and_si128(_mm_xor_si128(c, _mm_srli_epi64(c,  7)), _mm_set1_epi64x(INT64_C(0x00AA00AA00AA00AA)));
+    c = _mm_xor_si128(c, _mm_xor_si128(t, _mm_slli_epi64(t,  7)));
+    t = _mm_and_si128(_mm_xor_si128(c, _mm_srli_epi64(c, 14)), _mm_set1_epi64x(INT64_C(0x0000CCCC0000CCCC)));
+    c = _mm_xor_si128(c, _mm_xor_si128(t, _mm_slli_epi64(t, 14)));
+    t = _mm_and_si128(_mm_xor_si128(c, _mm_srli_epi64(c, 28)), _mm_set1_epi64x(INT64_C(0x00000000F0F0F0F0)));
+    c = _mm_xor_si128(c, _mm_xor_si128(t, _mm_slli_epi64(t, 28)));
+
+    w0  = _mm_xor_si128(_mm_shuffle_epi8(c, simde_x_gf2p8matrix_nibble_idx.m128i[0]), _mm_shuffle_epi8(c, simde_x_gf2p8matrix_nibble_idx.m128i[1]));
+    w1  = _mm_xor_si128(_mm_shuffle_epi8(c, simde_x_gf2p8matrix_nibble_idx.m128i[2]), _mm_shuffle_epi8(c, simde_x_gf2p8matrix_nibble_idx.m128i[3]));
+    tl0 = _mm_xor_si128(_mm_shuffle_epi8(w0, simde_x_gf2p8matrix_nibble_idx.m128i[4]), _mm_shuffle_epi8(w0, simde_x_gf2p8matrix_nibble_idx.m128i[5]));
+    th0 = _mm_xor_si128(_mm_shuffle_epi8(w0, simde_x_gf2p8matrix_nibble_idx.m128i[6]), _mm_shuffle_epi8(w0, simde_x_gf2p8matrix_nibble_idx.m128i[7]));
+    tl1 = _mm_xor_si128(_mm_shuffle_epi8(w1, simde_x_gf2p8matrix_nibble_idx.m128i[4]), _mm_shuffle_epi8(w1, simde_x_gf2p8matrix_nibble_idx.m128i[5]));
+    th1 = _mm_xor_si128(_mm_shuffle_epi8(w1, simde_x_gf2p8matrix_nibble_idx.m128i[6]), _mm_shuffle_epi8(w1, simde_x_gf2p8matrix_nibble_idx.m128i[7]));
+
+    lo = _mm_and_si128(x, nibble);
+    hi = _mm_and_si128(_mm_srli_epi16(x, 4), nibble);
+    r0 = _mm_xor_si128(_mm_shuffle_epi8(tl0, lo), _mm_shuffle_epi8(th0, hi));
+    r1 = _mm_xor_si128(_mm_shuffle_epi8(tl1, lo), _mm_shuffle_epi8(th1, hi));
+
+    return _mm_castpd_si128(_mm_move_sd(_mm_castsi128_pd(r1), _mm_castsi128_pd(r0)));
   #elif defined(SIMDE_X86_SSE2_NATIVE)
     const __m128i zero = _mm_setzero_si128();
     __m128i r, a, p, X;
@@ -133,33 +165,32 @@ simde_x_mm_gf2p8matrix_multiply_epi64_epi8 (simde__m128i x, simde__m128i A) {
 
     return _mm_packus_epi16(_mm_srli_epi16(_mm_slli_epi16(r, 8), 8), _mm_srli_epi16(r, 8));
   #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
-    static const uint8_t byte_interleave[16] = {0, 8, 1, 9, 2, 10, 3, 11, 4, 12, 5, 13, 6, 14, 7, 15};
-    static const uint8_t byte_deinterleave[16] = {0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15};
-    static const uint8_t mask_d[16] = {128, 128, 64, 64, 32, 32, 16, 16, 8, 8, 4, 4, 2, 2, 1, 1};
-    const int8x16_t mask = vreinterpretq_s8_u8(vld1q_u8(mask_d));
-    int8x16_t r, a, t, X;
-
-    t = simde__m128i_to_neon_i8(A);
-    a = vqtbl1q_s8(t, vld1q_u8(byte_interleave));
-    t = simde__m128i_to_neon_i8(x);
-    X = vqtbl1q_s8(t, vld1q_u8(byte_interleave));
-    r = vdupq_n_s8(0);
-
-    #if !defined(__INTEL_COMPILER)
-      SIMDE_VECTORIZE
-    #endif
-    for (int i = 0 ; i < 8 ; i++) {
-      t = vshrq_n_s8(a, 7);
-      t = vandq_s8(t, mask);
-      t = vreinterpretq_s8_u16(vdupq_n_u16(vaddvq_u16(vreinterpretq_u16_s8(t))));
-      t = vandq_s8(t, vshrq_n_s8(X, 7));
-      r = veorq_s8(r, t);
-      a = vshlq_n_s8(a, 1);
-      X = vshlq_n_s8(X, 1);
-    }
-
-    r = vqtbl1q_s8(r, vld1q_u8(byte_deinterleave));
-    return simde__m128i_from_neon_i8(r);
+    uint64x2_t c, t;
+    uint8x16_t cb, w0, w1, tl0, th0, tl1, th1, lo, hi, r0, r1, X;
+
+    c = vreinterpretq_u64_u8(vrev64q_u8(simde__m128i_to_neon_u8(A)));
+    t = vandq_u64(veorq_u64(c, vshrq_n_u64(c,  7)), vdupq_n_u64(UINT64_C(0x00AA00AA00AA00AA)));
+    c = veorq_u64(c, veorq_u64(t, vshlq_n_u64(t,  7)));
+    t = vandq_u64(veorq_u64(c, vshrq_n_u64(c, 14)), vdupq_n_u64(UINT64_C(0x0000CCCC0000CCCC)));
+    c = veorq_u64(c, veorq_u64(t, vshlq_n_u64(t, 14)));
+    t = vandq_u64(veorq_u64(c, vshrq_n_u64(c, 28)), vdupq_n_u64(UINT64_C(0x00000000F0F0F0F0)));
+    c = veorq_u64(c, veorq_u64(t, vshlq_n_u64(t, 28)));
+    cb = vreinterpretq_u8_u64(c);
+
+    w0  = veorq_u8(vqtbl1q_u8(cb, vld1q_u8(simde_x_gf2p8matrix_nibble_idx.u8[0])), vqtbl1q_u8(cb, vld1q_u8(simde_x_gf2p8matrix_nibble_idx.u8[1])));
+    w1  = veorq_u8(vqtbl1q_u8(cb, vld1q_u8(simde_x_gf2p8matrix_nibble_idx.u8[2])), vqtbl1q_u8(cb, vld1q_u8(simde_x_gf2p8matrix_nibble_idx.u8[3])));
+    tl0 = veorq_u8(vqtbl1q_u8(w0, vld1q_u8(simde_x_gf2p8matrix_nibble_idx.u8[4])), vqtbl1q_u8(w0, vld1q_u8(simde_x_gf2p8matrix_nibble_idx.u8[5])));
+    th0 = veorq_u8(vqtbl1q_u8(w0, vld1q_u8(simde_x_gf2p8matrix_nibble_idx.u8[6])), vqtbl1q_u8(w0, vld1q_u8(simde_x_gf2p8matrix_nibble_idx.u8[7])));
+    tl1 = veorq_u8(vqtbl1q_u8(w1, vld1q_u8(simde_x_gf2p8matrix_nibble_idx.u8[4])), vqtbl1q_u8(w1, vld1q_u8(simde_x_gf2p8matrix_nibble_idx.u8[5])));
+    th1 = veorq_u8(vqtbl1q_u8(w1, vld1q_u8(simde_x_gf2p8matrix_nibble_idx.u8[6])), vqtbl1q_u8(w1, vld1q_u8(simde_x_gf2p8matrix_nibble_idx.u8[7])));
+
+    X = simde__m128i_to_neon_u8(x);
+    lo = vandq_u8(X, vdupq_n_u8(0x0F));
+    hi = vshrq_n_u8(X, 4);
+    r0 = veorq_u8(vqtbl1q_u8(tl0, lo), vqtbl1q_u8(th0, hi));
+    r1 = veorq_u8(vqtbl1q_u8(tl1, lo), vqtbl1q_u8(th1, hi));
+
+    return simde__m128i_from_neon_u8(vcombine_u8(vget_low_u8(r0), vget_high_u8(r1)));
   #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     static const uint8_t mask_d[16] = {128, 64, 32, 16, 8, 4, 2, 1, 128, 64, 32, 16, 8, 4, 2, 1};
     const int8x16_t mask = vreinterpretq_s8_u8(vld1q_u8(mask_d));
@@ -372,37 +403,42 @@ SIMDE_FUNCTION_ATTRIBUTES
 simde__m256i
 simde_x_mm256_gf2p8matrix_multiply_epi64_epi8 (simde__m256i x, simde__m256i A) {
   #if defined(SIMDE_X86_AVX2_NATIVE)
-    simde__m256i r, a, p;
-    const simde__m256i byte_select = simde_x_mm256_set_epu64x(UINT64_C(0x0303030303030303), UINT64_C(0x0202020202020202),
-                                                              UINT64_C(0x0101010101010101), UINT64_C(0x0000000000000000));
-    a = simde_mm256_shuffle_epi8(A, simde_mm256_broadcastsi128_si256(simde_x_mm_set_epu64x(UINT64_C(0x08090A0B0C0D0E0F), UINT64_C(0x0001020304050607))));
-    r = simde_mm256_setzero_si256();
-
-    #if !defined(__INTEL_COMPILER)
-      SIMDE_VECTORIZE
-    #endif
-    for (int i = 0 ; i < 8 ; i++) {
-      p = simde_mm256_set1_epi32(simde_mm256_movemask_epi8(a));
-      p = simde_mm256_shuffle_epi8(p, byte_select);
-      p = simde_mm256_xor_si256(r, p);
-      r = simde_mm256_blendv_epi8(r, p, x);
-      a = simde_mm256_add_epi8(a, a);
-      x = simde_mm256_add_epi8(x, x);
-    }
-
-    return r;
+    const simde__m256i nibble = simde_mm256_set1_epi8(0x0F);
+    simde__m256i c, t, w0, w1, tl0, th0, tl1, th1, lo, hi, r0, r1;
+
+    c = simde_mm256_shuffle_epi8(A, simde_mm256_broadcastsi128_si256(simde_x_mm_set_epu64x(UINT64_C(0x08090A0B0C0D0E0F), UINT64_C(0x0001020304050607))));
+    t = simde_mm256_and_si256(simde_mm256_xor_si256(c, simde_mm256_srli_epi64(c,  7)), simde_mm256_set1_epi64x(INT64_C(0x00AA00AA00AA00AA)));
+    c = simde_mm256_xor_si256(c, simde_mm256_xor_si256(t, simde_mm256_slli_epi64(t,  7)));
+    t = simde_mm256_and_si256(simde_mm256_xor_si256(c, simde_mm256_srli_epi64(c, 14)), simde_mm256_set1_epi64x(INT64_C(0x0000CCCC0000CCCC)));
+    c = simde_mm256_xor_si256(c, simde_mm256_xor_si256(t, simde_mm256_slli_epi64(t, 14)));
+    t = simde_mm256_and_si256(simde_mm256_xor_si256(c, simde_mm256_srli_epi64(c, 28)), simde_mm256_set1_epi64x(INT64_C(0x00000000F0F0F0F0)));
+    c = simde_mm256_xor_si256(c, simde_mm256_xor_si256(t, simde_mm256_slli_epi64(t, 28)));
+
+    #define SIMDE_X_GF2P8MATRIX_IDX_(i) simde_mm256_broadcastsi128_si256(simde_x_gf2p8matrix_nibble_idx.m128i[i])
+    w0  = simde_mm256_xor_si256(simde_mm256_shuffle_epi8(c, SIMDE_X_GF2P8MATRIX_IDX_(0)), simde_mm256_shuffle_epi8(c, SIMDE_X_GF2P8MATRIX_IDX_(1)));
+    w1  = simde_mm256_xor_si256(simde_mm256_shuffle_epi8(c, SIMDE_X_GF2P8MATRIX_IDX_(2)), simde_mm256_shuffle_epi8(c, SIMDE_X_GF2P8MATRIX_IDX_(3)));
+    tl0 = simde_mm256_xor_si256(simde_mm256_shuffle_epi8(w0, SIMDE_X_GF2P8MATRIX_IDX_(4)), simde_mm256_shuffle_epi8(w0, SIMDE_X_GF2P8MATRIX_IDX_(5)));
+    th0 = simde_mm256_xor_si256(simde_mm256_shuffle_epi8(w0, SIMDE_X_GF2P8MATRIX_IDX_(6)), simde_mm256_shuffle_epi8(w0, SIMDE_X_GF2P8MATRIX_IDX_(7)));
+    tl1 = simde_mm256_xor_si256(simde_mm256_shuffle_epi8(w1, SIMDE_X_GF2P8MATRIX_IDX_(4)), simde_mm256_shuffle_epi8(w1, SIMDE_X_GF2P8MATRIX_IDX_(5)));
+    th1 = simde_mm256_xor_si256(simde_mm256_shuffle_epi8(w1, SIMDE_X_GF2P8MATRIX_IDX_(6)), simde_mm256_shuffle_epi8(w1, SIMDE_X_GF2P8MATRIX_IDX_(7)));
+    #undef SIMDE_X_GF2P8MATRIX_IDX_
+
+    lo = simde_mm256_and_si256(x, nibble);
+    hi = simde_mm256_and_si256(simde_mm256_srli_epi16(x, 4), nibble);
+    r0 = simde_mm256_xor_si256(simde_mm256_shuffle_epi8(tl0, lo), simde_mm256_shuffle_epi8(th0, hi));
+    r1 = simde_mm256_xor_si256(simde_mm256_shuffle_epi8(tl1, lo), simde_mm256_shuffle_epi8(th1, hi));
+
+    return simde_mm256_blend_epi32(r0, r1, 0xCC);
   #else
     simde__m256i_private
       r_,
       x_ = simde__m256i_to_private(x),
       A_ = simde__m256i_to_private(A);
 
-    #if !defined(__INTEL_COMPILER)
-      SIMDE_VECTORIZE
-    #endif
-    for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
-      r_.m128i[i] = simde_x_mm_gf2p8matrix_multiply_epi64_epi8(x_.m128i[i], A_.m128i[i]);
-    }
+    /* Spelled out rather than looped so that, once inlined, the table
+     * setup for each half is still visibly loop-invariant in the caller. */
+    r_.m128i[0] = simde_x_mm_gf2p8matrix_multiply_epi64_epi8(x_.m128i[0], A_.m128i[0]);
+    r_.m128i[1] = simde_x_mm_gf2p8matrix_multiply_epi64_epi8(x_.m128i[1], A_.m128i[1]);
 
     return simde__m256i_from_private(r_);
   #endif
@@ -412,36 +448,42 @@ SIMDE_FUNCTION_ATTRIBUTES
 simde__m512i
 simde_x_mm512_gf2p8matrix_multiply_epi64_epi8 (simde__m512i x, simde__m512i A) {
   #if defined(SIMDE_X86_AVX512BW_NATIVE)
-    simde__m512i r, a, p;
-    const simde__m512i byte_select = simde_x_mm512_set_epu64(UINT64_C(0x0707070707070707), UINT64_C(0x0606060606060606), UINT64_C(0x0505050505050505), UINT64_C(0x0404040404040404),
-                                                             UINT64_C(0x0303030303030303), UINT64_C(0x0202020202020202), UINT64_C(0x0101010101010101), UINT64_C(0X0000000000000000));
-    a = simde_mm512_shuffle_epi8(A, simde_mm512_broadcast_i32x4(simde_x_mm_set_epu64x(UINT64_C(0x08090A0B0C0D0E0F), UINT64_C(0x0001020304050607))));
-    r = simde_mm512_setzero_si512();
-
-    #if !defined(__INTEL_COMPILER)
-      SIMDE_VECTORIZE
-    #endif
-    for (int i = 0 ; i < 8 ; i++) {
-      p = simde_mm512_set1_epi64(HEDLEY_STATIC_CAST(int64_t, simde_mm512_movepi8_mask(a)));
-      p = simde_mm512_maskz_shuffle_epi8(simde_mm512_movepi8_mask(x), p, byte_select);
-      r = simde_mm512_xor_si512(r, p);
-      a = simde_mm512_add_epi8(a, a);
-      x = simde_mm512_add_epi8(x, x);
-    }
-
-    return r;
+    const simde__m512i nibble = simde_mm512_set1_epi8(0x0F);
+    simde__m512i c, t, w0, w1, tl0, th0, tl1, th1, lo, hi, r0, r1;
+
+    c = simde_mm512_shuffle_epi8(A, simde_mm512_broadcast_i32x4(simde_x_mm_set_epu64x(UINT64_C(0x08090A0B0C0D0E0F), UINT64_C(0x0001020304050607))));
+    t = simde_mm512_and_si512(simde_mm512_xor_si512(c, simde_mm512_srli_epi64(c,  7)), simde_mm512_set1_epi64(INT64_C(0x00AA00AA00AA00AA)));
+    c = simde_mm512_xor_si512(c, simde_mm512_xor_si512(t, simde_mm512_slli_epi64(t,  7)));
+    t = simde_mm512_and_si512(simde_mm512_xor_si512(c, simde_mm512_srli_epi64(c, 14)), simde_mm512_set1_epi64(INT64_C(0x0000CCCC0000CCCC)));
+    c = simde_mm512_xor_si512(c, simde_mm512_xor_si512(t, simde_mm512_slli_epi64(t, 14)));
+    t = simde_mm512_and_si512(simde_mm512_xor_si512(c, simde_mm512_srli_epi64(c, 28)), simde_mm512_set1_epi64(INT64_C(0x00000000F0F0F0F0)));
+    c = simde_mm512_xor_si512(c, simde_mm512_xor_si512(t, simde_mm512_slli_epi64(t, 28)));
+
+    #define SIMDE_X_GF2P8MATRIX_IDX_(i) simde_mm512_broadcast_i32x4(simde_x_gf2p8matrix_nibble_idx.m128i[i])
+    w0  = simde_mm512_xor_si512(simde_mm512_shuffle_epi8(c, SIMDE_X_GF2P8MATRIX_IDX_(0)), simde_mm512_shuffle_epi8(c, SIMDE_X_GF2P8MATRIX_IDX_(1)));
+    w1  = simde_mm512_xor_si512(simde_mm512_shuffle_epi8(c, SIMDE_X_GF2P8MATRIX_IDX_(2)), simde_mm512_shuffle_epi8(c, SIMDE_X_GF2P8MATRIX_IDX_(3)));
+    tl0 = simde_mm512_xor_si512(simde_mm512_shuffle_epi8(w0, SIMDE_X_GF2P8MATRIX_IDX_(4)), simde_mm512_shuffle_epi8(w0, SIMDE_X_GF2P8MATRIX_IDX_(5)));
+    th0 = simde_mm512_xor_si512(simde_mm512_shuffle_epi8(w0, SIMDE_X_GF2P8MATRIX_IDX_(6)), simde_mm512_shuffle_epi8(w0, SIMDE_X_GF2P8MATRIX_IDX_(7)));
+    tl1 = simde_mm512_xor_si512(simde_mm512_shuffle_epi8(w1, SIMDE_X_GF2P8MATRIX_IDX_(4)), simde_mm512_shuffle_epi8(w1, SIMDE_X_GF2P8MATRIX_IDX_(5)));
+    th1 = simde_mm512_xor_si512(simde_mm512_shuffle_epi8(w1, SIMDE_X_GF2P8MATRIX_IDX_(6)), simde_mm512_shuffle_epi8(w1, SIMDE_X_GF2P8MATRIX_IDX_(7)));
+    #undef SIMDE_X_GF2P8MATRIX_IDX_
+
+    lo = simde_mm512_and_si512(x, nibble);
+    hi = simde_mm512_and_si512(simde_mm512_srli_epi16(x, 4), nibble);
+    r0 = simde_mm512_xor_si512(simde_mm512_shuffle_epi8(tl0, lo), simde_mm512_shuffle_epi8(th0, hi));
+    r1 = simde_mm512_xor_si512(simde_mm512_shuffle_epi8(tl1, lo), simde_mm512_shuffle_epi8(th1, hi));
+
+    return simde_mm512_mask_blend_epi64(HEDLEY_STATIC_CAST(simde__mmask8, 0xAA), r0, r1);
   #else
     simde__m512i_private
       r_,
       x_ = simde__m512i_to_private(x),
       A_ = simde__m512i_to_private(A);
 
-    #if !defined(__INTEL_COMPILER)
-      SIMDE_VECTORIZE
-    #endif
-    for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
-      r_.m256i[i] = simde_x_mm256_gf2p8matrix_multiply_epi64_epi8(x_.m256i[i], A_.m256i[i]);
-    }
+    /* Spelled out rather than looped so that, once inlined, the table
+     * setup for each half is still visibly loop-invariant in the caller. */
+    r_.m256i[0] = simde_x_mm256_gf2p8matrix_multiply_epi64_epi8(x_.m256i[0], A_.m256i[0]);
+    r_.m256i[1] = simde_x_mm256_gf2p8matrix_multiply_epi64_epi8(x_.m256i[1], A_.m256i[1]);
 
     return simde__m512i_from_private(r_);
   #endif
@@ -0,0 +1,340 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* SHA extensions (SHA-NI): SHA-1 and SHA-256 message schedule and
+ * round instructions.
+ *
+ * On AArch32/AArch64 with the SHA2 crypto extension the rounds and the
+ * harder message steps are mapped onto the ARMv8 SHA instructions.
+ * The x86 instructions keep the SHA-1 words and state with the first
+ * element in the highest lane and split the SHA-256 state into ABEF /
+ * CDGH halves, while ARM uses ABCD / EFGH in lane order, so most of the
+ * work is shuffling in and out.  ARM has no two-round SHA-256
+ * instruction; _mm_sha256rnds2_epu32 runs four rounds and keeps the
+ * state after the first two (rounds 3 and 4 only depend on it, not the
+ * other way around).
+ *
+ * Everything else uses a straightforward scalar implementation of
+ * FIPS 180-4. */
+
+#if !defined(SIMDE_X86_SHA_H)
+#define SIMDE_X86_SHA_H
+
+#include "ssse3.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+#if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_SHA2)
+  #define SIMDE_X86_SHA_ARM_SHA2_
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_x_sha_rotl32_(uint32_t x, int n) {
+  return (x << n) | (x >> (32 - n));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_x_sha_rotr32_(uint32_t x, int n) {
+  return (x >> n) | (x << (32 - n));
+}
+
+#if defined(SIMDE_X86_SHA_ARM_SHA2_)
+  /* Reverse the order of the four 32-bit lanes. */
+  SIMDE_FUNCTION_ATTRIBUTES
+  uint32x4_t
+  simde_x_sha_rev_u32_(uint32x4_t v) {
+    v = vrev64q_u32(v);
+    return vextq_u32(v, v, 2);
+  }
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sha1msg1_epu32 (simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_X86_SHA_NATIVE)
+    return _mm_sha1msg1_epu32(a, b);
+  #else
+    /* W[i] ^ W[i + 2] for W0..W3 in a, W4 and W5 in the upper half of
+     * b. */
+    return simde_mm_xor_si128(a, simde_mm_alignr_epi8(a, b, 8));
+  #endif
+}
+#if defined(SIMDE_X86_SHA_ENABLE_NATIVE_ALIASES)
+  #undef _mm_sha1msg1_epu32
+  #define _mm_sha1msg1_epu32(a, b) simde_mm_sha1msg1_epu32(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sha1msg2_epu32 (simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_X86_SHA_NATIVE)
+    return _mm_sha1msg2_epu32(a, b);
+  #else
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      b_ = simde__m128i_to_private(b);
+
+    #if defined(SIMDE_X86_SHA_ARM_SHA2_)
+      r_.neon_u32 = simde_x_sha_rev_u32_(vsha1su1q_u32(simde_x_sha_rev_u32_(a_.neon_u32), simde_x_sha_rev_u32_(b_.neon_u32)));
+    #else
+      r_.u32[3] = simde_x_sha_rotl32_(a_.u32[3] ^ b_.u32[2], 1);
+      r_.u32[2] = simde_x_sha_rotl32_(a_.u32[2] ^ b_.u32[1], 1);
+      r_.u32[1] = simde_x_sha_rotl32_(a_.u32[1] ^ b_.u32[0], 1);
+      r_.u32[0] = simde_x_sha_rotl32_(a_.u32[0] ^ r_.u32[3], 1);
+    #endif
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_SHA_ENABLE_NATIVE_ALIASES)
+  #undef _mm_sha1msg2_epu32
+  #define _mm_sha1msg2_epu32(a, b) simde_mm_sha1msg2_epu32(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sha1nexte_epu32 (simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_X86_SHA_NATIVE)
+    return _mm_sha1nexte_epu32(a, b);
+  #else
+    simde__m128i_private
+      r_ = simde__m128i_to_private(b),
+      a_ = simde__m128i_to_private(a);
+
+    r_.u32[3] += simde_x_sha_rotl32_(a_.u32[3], 30);
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_SHA_ENABLE_NATIVE_ALIASES)
+  #undef _mm_sha1nexte_epu32
+  #define _mm_sha1nexte_epu32(a, b) simde_mm_sha1nexte_epu32(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sha1rnds4_epu32 (simde__m128i a, simde__m128i b, const int func)
+    SIMDE_REQUIRE_CONSTANT_RANGE(func, 0, 3) {
+  static const uint32_t k[4] = {
+    UINT32_C(0x5a827999), UINT32_C(0x6ed9eba1), UINT32_C(0x8f1bbcdc), UINT32_C(0xca62c1d6)
+  };
+  simde__m128i_private
+    r_,
+    a_ = simde__m128i_to_private(a),
+    b_ = simde__m128i_to_private(b);
+
+  #if defined(SIMDE_X86_SHA_ARM_SHA2_)
+    /* E is already folded into the first word by sha1nexte. */
+    const uint32x4_t abcd = simde_x_sha_rev_u32_(a_.neon_u32);
+    const uint32x4_t wk = vaddq_u32(simde_x_sha_rev_u32_(b_.neon_u32), vdupq_n_u32(k[func & 3]));
+    uint32x4_t r;
+
+    switch (func & 3) {
+      case 0:
+        r = vsha1cq_u32(abcd, 0, wk);
+        break;
+      case 2:
+        r = vsha1mq_u32(abcd, 0, wk);
+        break;
+      default:
+        r = vsha1pq_u32(abcd, 0, wk);
+        break;
+    }
+    r_.neon_u32 = simde_x_sha_rev_u32_(r);
+  #else
+    uint32_t
+      A = a_.u32[3], B = a_.u32[2], C = a_.u32[1], D = a_.u32[0], E = 0;
+
+    for (int i = 0 ; i < 4 ; i++) {
+      uint32_t f;
+      switch (func & 3) {
+        case 0:
+          f = (B & C) ^ (~B & D);
+          break;
+        case 2:
+          f = (B & C) ^ (B & D) ^ (C & D);
+          break;
+        default:
+          f = B ^ C ^ D;
+          break;
+      }
+
+      const uint32_t T = simde_x_sha_rotl32_(A, 5) + f + E + b_.u32[3 - i] + k[func & 3];
+      E = D;
+      D = C;
+      C = simde_x_sha_rotl32_(B, 30);
+      B = A;
+      A = T;
+    }
+
+    r_.u32[3] = A;
+    r_.u32[2] = B;
+    r_.u32[1] = C;
+    r_.u32[0] = D;
+  #endif
+
+  return simde__m128i_from_private(r_);
+}
+#if defined(SIMDE_X86_SHA_NATIVE)
+  #define simde_mm_sha1rnds4_epu32(a, b, func) _mm_sha1rnds4_epu32(a, b, func)
+#endif
+#if defined(SIMDE_X86_SHA_ENABLE_NATIVE_ALIASES)
+  #undef _mm_sha1rnds4_epu32
+  #define _mm_sha1rnds4_epu32(a, b, func) simde_mm_sha1rnds4_epu32(a, b, func)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sha256msg1_epu32 (simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_X86_SHA_NATIVE)
+    return _mm_sha256msg1_epu32(a, b);
+  #elif defined(SIMDE_X86_SHA_ARM_SHA2_)
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      b_ = simde__m128i_to_private(b);
+
+    r_.neon_u32 = vsha256su0q_u32(a_.neon_u32, b_.neon_u32);
+
+    return simde__m128i_from_private(r_);
+  #else
+    /* W[i] + sigma0(W[i + 1]) */
+    const simde__m128i w = simde_mm_alignr_epi8(b, a, 4);
+    const simde__m128i s0 =
+      simde_mm_xor_si128(
+        simde_mm_xor_si128(
+          simde_mm_or_si128(simde_mm_srli_epi32(w,  7), simde_mm_slli_epi32(w, 25)),
+          simde_mm_or_si128(simde_mm_srli_epi32(w, 18), simde_mm_slli_epi32(w, 14))),
+        simde_mm_srli_epi32(w, 3));
+
+    return simde_mm_add_epi32(a, s0);
+  #endif
+}
+#if defined(SIMDE_X86_SHA_ENABLE_NATIVE_ALIASES)
+  #undef _mm_sha256msg1_epu32
+  #define _mm_sha256msg1_epu32(a, b) simde_mm_sha256msg1_epu32(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sha256msg2_epu32 (simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_X86_SHA_NATIVE)
+    return _mm_sha256msg2_epu32(a, b);
+  #else
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      b_ = simde__m128i_to_private(b);
+
+    #if defined(SIMDE_X86_SHA_ARM_SHA2_)
+      /* vsha256su1q_u32 also adds W[i - 7], taken from the last lane of
+       * b and the second operand; zero them since the x86 code adds
+       * that term separately. */
+      r_.neon_u32 = vsha256su1q_u32(a_.neon_u32, vdupq_n_u32(0), vsetq_lane_u32(0, b_.neon_u32, 0));
+    #else
+      #define SIMDE_X86_SHA256_SIGMA1_(x) \
+        (simde_x_sha_rotr32_((x), 17) ^ simde_x_sha_rotr32_((x), 19) ^ ((x) >> 10))
+      r_.u32[0] = a_.u32[0] + SIMDE_X86_SHA256_SIGMA1_(b_.u32[2]);
+      r_.u32[1] = a_.u32[1] + SIMDE_X86_SHA256_SIGMA1_(b_.u32[3]);
+      r_.u32[2] = a_.u32[2] + SIMDE_X86_SHA256_SIGMA1_(r_.u32[0]);
+      r_.u32[3] = a_.u32[3] + SIMDE_X86_SHA256_SIGMA1_(r_.u32[1]);
+      #undef SIMDE_X86_SHA256_SIGMA1_
+    #endif
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_SHA_ENABLE_NATIVE_ALIASES)
+  #undef _mm_sha256msg2_epu32
+  #define _mm_sha256msg2_epu32(a, b) simde_mm_sha256msg2_epu32(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sha256rnds2_epu32 (simde__m128i a, simde__m128i b, simde__m128i k) {
+  #if defined(SIMDE_X86_SHA_NATIVE)
+    return _mm_sha256rnds2_epu32(a, b, k);
+  #else
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      b_ = simde__m128i_to_private(b),
+      k_ = simde__m128i_to_private(k);
+
+    #if defined(SIMDE_X86_SHA_ARM_SHA2_)
+      /* a = { H, G, D, C }, b = { F, E, B, A } */
+      const uint32x4_t cdgh = vrev64q_u32(a_.neon_u32);
+      const uint32x4_t abef = vrev64q_u32(b_.neon_u32);
+      const uint32x4_t abcd = vcombine_u32(vget_high_u32(abef), vget_high_u32(cdgh));
+      const uint32x4_t efgh = vcombine_u32(vget_low_u32(abef), vget_low_u32(cdgh));
+      const uint32x4_t r_abcd = vsha256hq_u32(abcd, efgh, k_.neon_u32);
+      const uint32x4_t r_efgh = vsha256h2q_u32(efgh, abcd, k_.neon_u32);
+
+      /* After four rounds C and D hold A and B after two. */
+      r_.neon_u32 = vrev64q_u32(vcombine_u32(vget_high_u32(r_efgh), vget_high_u32(r_abcd)));
+    #else
+      uint32_t
+        A = b_.u32[3], B = b_.u32[2], C = a_.u32[3], D = a_.u32[2],
+        E = b_.u32[1], F = b_.u32[0], G = a_.u32[1], H = a_.u32[0];
+
+      for (int i = 0 ; i < 2 ; i++) {
+        const uint32_t S1 = simde_x_sha_rotr32_(E, 6) ^ simde_x_sha_rotr32_(E, 11) ^ simde_x_sha_rotr32_(E, 25);
+        const uint32_t ch = (E & F) ^ (~E & G);
+        const uint32_t T1 = H + S1 + ch + k_.u32[i];
+        const uint32_t S0 = simde_x_sha_rotr32_(A, 2) ^ simde_x_sha_rotr32_(A, 13) ^ simde_x_sha_rotr32_(A, 22);
+        const uint32_t maj = (A & B) ^ (A & C) ^ (B & C);
+
+        H = G;
+        G = F;
+        F = E;
+        E = D + T1;
+        D = C;
+        C = B;
+        B = A;
+        A = T1 + S0 + maj;
+      }
+
+      r_.u32[3] = A;
+      r_.u32[2] = B;
+      r_.u32[1] = E;
+      r_.u32[0] = F;
+    #endif
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_SHA_ENABLE_NATIVE_ALIASES)
+  #undef _mm_sha256rnds2_epu32
+  #define _mm_sha256rnds2_epu32(a, b, k) simde_mm_sha256rnds2_epu32(a, b, k)
+#endif
+
+SIMDE_END_DECLS_
+
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_SHA_H) */
@@ -29,6 +29,7 @@
 #define SIMDE_X86_SSE4_2_H
 
 #include "sse4.1.h"
+#include "../simde-crc32.h"
 
 #if defined(__ARM_ACLE) || (defined(__GNUC__) && defined(__ARM_FEATURE_CRC32))
   #include <arm_acle.h>
@@ -289,6 +290,392 @@ simde_mm_cmpistrz_16_(simde__m128i b) {
   #define _mm_cmpistrz(a, b, imm8) simde_mm_cmpistrz(a, b, imm8)
 #endif
 
+/* The index-, mask- and flag-returning string comparisons below all
+ * compute the same IntRes2 bit mask (one bit per element of b) and only
+ * differ in how they report it; see the SDM description of PCMPxSTRx.
+ *
+ * Rather than nesting loops over every (a, b) element pair, each
+ * element of a is broadcast and compared against all of b at once, so
+ * the fallback is a handful of vector compares per valid element of a
+ * (which is usually a short set of delimiters or ranges). */
+
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_x_mm_cmpstr_index_ (int mask, int n, int most_significant) {
+  if (mask == 0)
+    return n;
+
+  #if HEDLEY_HAS_BUILTIN(__builtin_ctz) || HEDLEY_GCC_VERSION_CHECK(3,4,0)
+    return most_significant ?
+      HEDLEY_STATIC_CAST(int, (sizeof(unsigned int) * CHAR_BIT) - 1) - __builtin_clz(HEDLEY_STATIC_CAST(unsigned int, mask)) :
+      __builtin_ctz(HEDLEY_STATIC_CAST(unsigned int, mask));
+  #else
+    int r = most_significant ? (n - 1) : 0;
+    while (!(mask & (1 << r)))
+      r += most_significant ? -1 : 1;
+    return r;
+  #endif
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_x_mm_cmpstr_movemask_ (simde__m128i v, int imm8) {
+  return simde_mm_movemask_epi8((imm8 & SIMDE_SIDD_UWORD_OPS) ? simde_mm_packs_epi16(v, simde_mm_setzero_si128()) : v);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_mm_cmpstr_cmpeq_ (simde__m128i a, simde__m128i b, int imm8) {
+  return (imm8 & SIMDE_SIDD_UWORD_OPS) ? simde_mm_cmpeq_epi16(a, b) : simde_mm_cmpeq_epi8(a, b);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_mm_cmpstr_set1_ (simde__m128i a, int i, int imm8) {
+  simde__m128i_private a_ = simde__m128i_to_private(a);
+  return (imm8 & SIMDE_SIDD_UWORD_OPS) ? simde_mm_set1_epi16(a_.i16[i]) : simde_mm_set1_epi8(a_.i8[i]);
+}
+
+/* Lanes of b which are within [lo, hi]. */
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_mm_cmpstr_in_range_ (simde__m128i b, simde__m128i lo, simde__m128i hi, int imm8) {
+  switch (imm8 & 3) {
+    case SIMDE_SIDD_UBYTE_OPS:
+      return simde_mm_and_si128(simde_mm_cmpeq_epi8(simde_mm_max_epu8(b, lo), b), simde_mm_cmpeq_epi8(simde_mm_min_epu8(b, hi), b));
+    case SIMDE_SIDD_UWORD_OPS:
+      return simde_mm_and_si128(simde_mm_cmpeq_epi16(simde_mm_max_epu16(b, lo), b), simde_mm_cmpeq_epi16(simde_mm_min_epu16(b, hi), b));
+    case SIMDE_SIDD_SBYTE_OPS:
+      return simde_mm_and_si128(simde_mm_cmpeq_epi8(simde_mm_max_epi8(b, lo), b), simde_mm_cmpeq_epi8(simde_mm_min_epi8(b, hi), b));
+    default:
+      return simde_mm_and_si128(simde_mm_cmpeq_epi16(simde_mm_max_epi16(b, lo), b), simde_mm_cmpeq_epi16(simde_mm_min_epi16(b, hi), b));
+  }
+}
+
+/* la and lb must already be clamped to [0, number of elements]. */
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_x_mm_cmpstr_ (simde__m128i a, int la, simde__m128i b, int lb, int imm8) {
+  const int full = (imm8 & SIMDE_SIDD_UWORD_OPS) ? 0xff : 0xffff;
+  const int va = (1 << la) - 1;
+  const int vb = (1 << lb) - 1;
+  simde__m128i t;
+  int r;
+
+  switch (imm8 & 0x0c) {
+    case SIMDE_SIDD_CMP_EQUAL_ANY:
+      t = simde_mm_setzero_si128();
+      for (int i = 0 ; i < la ; i++) {
+        t = simde_mm_or_si128(t, simde_x_mm_cmpstr_cmpeq_(b, simde_x_mm_cmpstr_set1_(a, i, imm8), imm8));
+      }
+      r = simde_x_mm_cmpstr_movemask_(t, imm8) & vb;
+      break;
+    case SIMDE_SIDD_CMP_RANGES:
+      t = simde_mm_setzero_si128();
+      for (int i = 0 ; i + 1 < la ; i += 2) {
+        t = simde_mm_or_si128(t,
+          simde_x_mm_cmpstr_in_range_(b, simde_x_mm_cmpstr_set1_(a, i, imm8), simde_x_mm_cmpstr_set1_(a, i + 1, imm8), imm8));
+      }
+      r = simde_x_mm_cmpstr_movemask_(t, imm8) & vb;
+      break;
+    case SIMDE_SIDD_CMP_EQUAL_EACH:
+      /* Pairs where both elements are past the end compare equal. */
+      r = simde_x_mm_cmpstr_movemask_(simde_x_mm_cmpstr_cmpeq_(a, b, imm8), imm8);
+      r = ((r & va & vb) | ~(va | vb)) & full;
+      break;
+    default: /* SIMDE_SIDD_CMP_EQUAL_ORDERED */
+      /* Bit j is set if a[0..la) occurs in b at j; a needle running off
+       * the end of the vector (but not past lb) still counts as a
+       * (partial) match. */
+      r = full;
+      for (int k = 0 ; k < la && r != 0 ; k++) {
+        const int eq = simde_x_mm_cmpstr_movemask_(simde_x_mm_cmpstr_cmpeq_(b, simde_x_mm_cmpstr_set1_(a, k, imm8), imm8), imm8) & vb;
+        r &= (eq >> k) | (full & ~(full >> k));
+      }
+      break;
+  }
+
+  switch (imm8 & 0x30) {
+    case SIMDE_SIDD_NEGATIVE_POLARITY:
+      r ^= full;
+      break;
+    case SIMDE_SIDD_MASKED_NEGATIVE_POLARITY:
+      r ^= vb;
+      break;
+    default:
+      break;
+  }
+
+  return r;
+}
+
+/* Length of a null-terminated string in a, or the number of elements. */
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_x_mm_cmpistr_len_ (simde__m128i a, int imm8) {
+  return simde_x_mm_cmpstr_index_(
+    simde_x_mm_cmpstr_movemask_(simde_x_mm_cmpstr_cmpeq_(a, simde_mm_setzero_si128(), imm8), imm8),
+    (imm8 & SIMDE_SIDD_UWORD_OPS) ? 8 : 16, 0);
+}
+
+/* Explicit lengths are taken as absolute values and saturated. */
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_x_mm_cmpestr_len_ (int l, int imm8) {
+  const int n = (imm8 & SIMDE_SIDD_UWORD_OPS) ? 8 : 16;
+  if (l < 0)
+    l = (l < -n) ? n : -l;
+  return (l > n) ? n : l;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_mm_cmpstrm_ (int r, int imm8) {
+  if (imm8 & SIMDE_SIDD_UNIT_MASK) {
+    simde__m128i bits, v;
+    if (imm8 & SIMDE_SIDD_UWORD_OPS) {
+      bits = simde_mm_setr_epi16(1, 2, 4, 8, 16, 32, 64, 128);
+      v = simde_mm_set1_epi16(HEDLEY_STATIC_CAST(int16_t, r));
+      return simde_mm_cmpeq_epi16(simde_mm_and_si128(v, bits), bits);
+    } else {
+      bits = simde_mm_set1_epi64x(INT64_C(0x8040201008040201));
+      v = simde_mm_set_epi64x(
+        HEDLEY_STATIC_CAST(int64_t, HEDLEY_STATIC_CAST(uint64_t, (r >> 8) & 0xff) * UINT64_C(0x0101010101010101)),
+        HEDLEY_STATIC_CAST(int64_t, HEDLEY_STATIC_CAST(uint64_t, (r     ) & 0xff) * UINT64_C(0x0101010101010101)));
+      return simde_mm_cmpeq_epi8(simde_mm_and_si128(v, bits), bits);
+    }
+  } else {
+    return simde_mm_cvtsi32_si128(r);
+  }
+}
+
+
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_mm_cmpistri (simde__m128i a, simde__m128i b, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_x_mm_cmpstr_index_(
+    simde_x_mm_cmpstr_(a, simde_x_mm_cmpistr_len_(a, imm8), b, simde_x_mm_cmpistr_len_(b, imm8), imm8),
+    ((imm8 & SIMDE_SIDD_UWORD_OPS) ? 8 : 16), imm8 & SIMDE_SIDD_MOST_SIGNIFICANT);
+}
+#if defined(SIMDE_X86_SSE4_2_NATIVE)
+  #if defined(__clang__) && !SIMDE_DETECT_CLANG_VERSION_CHECK(3,8,0)
+    #define simde_mm_cmpistri(a, b, imm8) \
+      _mm_cmpistri( \
+        HEDLEY_REINTERPRET_CAST(__v16qi, a), \
+        HEDLEY_REINTERPRET_CAST(__v16qi, b), \
+        imm8)
+  #else
+    #define simde_mm_cmpistri(a, b, imm8) _mm_cmpistri(a, b, imm8)
+  #endif
+#endif
+#if defined(SIMDE_X86_SSE4_2_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cmpistri
+  #define _mm_cmpistri(a, b, imm8) simde_mm_cmpistri(a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_cmpistrm (simde__m128i a, simde__m128i b, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_x_mm_cmpstrm_(simde_x_mm_cmpstr_(a, simde_x_mm_cmpistr_len_(a, imm8), b, simde_x_mm_cmpistr_len_(b, imm8), imm8), imm8);
+}
+#if defined(SIMDE_X86_SSE4_2_NATIVE)
+  #if defined(__clang__) && !SIMDE_DETECT_CLANG_VERSION_CHECK(3,8,0)
+    #define simde_mm_cmpistrm(a, b, imm8) \
+      _mm_cmpistrm( \
+        HEDLEY_REINTERPRET_CAST(__v16qi, a), \
+        HEDLEY_REINTERPRET_CAST(__v16qi, b), \
+        imm8)
+  #else
+    #define simde_mm_cmpistrm(a, b, imm8) _mm_cmpistrm(a, b, imm8)
+  #endif
+#endif
+#if defined(SIMDE_X86_SSE4_2_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cmpistrm
+  #define _mm_cmpistrm(a, b, imm8) simde_mm_cmpistrm(a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_mm_cmpistra (simde__m128i a, simde__m128i b, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return (simde_x_mm_cmpstr_(a, simde_x_mm_cmpistr_len_(a, imm8), b, simde_x_mm_cmpistr_len_(b, imm8), imm8) == 0) &&
+    (simde_x_mm_cmpistr_len_(b, imm8) == ((imm8 & SIMDE_SIDD_UWORD_OPS) ? 8 : 16));
+}
+#if defined(SIMDE_X86_SSE4_2_NATIVE)
+  #if defined(__clang__) && !SIMDE_DETECT_CLANG_VERSION_CHECK(3,8,0)
+    #define simde_mm_cmpistra(a, b, imm8) \
+      _mm_cmpistra( \
+        HEDLEY_REINTERPRET_CAST(__v16qi, a), \
+        HEDLEY_REINTERPRET_CAST(__v16qi, b), \
+        imm8)
+  #else
+    #define simde_mm_cmpistra(a, b, imm8) _mm_cmpistra(a, b, imm8)
+  #endif
+#endif
+#if defined(SIMDE_X86_SSE4_2_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cmpistra
+  #define _mm_cmpistra(a, b, imm8) simde_mm_cmpistra(a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_mm_cmpistrc (simde__m128i a, simde__m128i b, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_x_mm_cmpstr_(a, simde_x_mm_cmpistr_len_(a, imm8), b, simde_x_mm_cmpistr_len_(b, imm8), imm8) != 0;
+}
+#if defined(SIMDE_X86_SSE4_2_NATIVE)
+  #if defined(__clang__) && !SIMDE_DETECT_CLANG_VERSION_CHECK(3,8,0)
+    #define simde_mm_cmpistrc(a, b, imm8) \
+      _mm_cmpistrc( \
+        HEDLEY_REINTERPRET_CAST(__v16qi, a), \
+        HEDLEY_REINTERPRET_CAST(__v16qi, b), \
+        imm8)
+  #else
+    #define simde_mm_cmpistrc(a, b, imm8) _mm_cmpistrc(a, b, imm8)
+  #endif
+#endif
+#if defined(SIMDE_X86_SSE4_2_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cmpistrc
+  #define _mm_cmpistrc(a, b, imm8) simde_mm_cmpistrc(a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_mm_cmpistro (simde__m128i a, simde__m128i b, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_x_mm_cmpstr_(a, simde_x_mm_cmpistr_len_(a, imm8), b, simde_x_mm_cmpistr_len_(b, imm8), imm8) & 1;
+}
+#if defined(SIMDE_X86_SSE4_2_NATIVE)
+  #if defined(__clang__) && !SIMDE_DETECT_CLANG_VERSION_CHECK(3,8,0)
+    #define simde_mm_cmpistro(a, b, imm8) \
+      _mm_cmpistro( \
+        HEDLEY_REINTERPRET_CAST(__v16qi, a), \
+        HEDLEY_REINTERPRET_CAST(__v16qi, b), \
+        imm8)
+  #else
+    #define simde_mm_cmpistro(a, b, imm8) _mm_cmpistro(a, b, imm8)
+  #endif
+#endif
+#if defined(SIMDE_X86_SSE4_2_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cmpistro
+  #define _mm_cmpistro(a, b, imm8) simde_mm_cmpistro(a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_mm_cmpestri (simde__m128i a, int la, simde__m128i b, int lb, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_x_mm_cmpstr_index_(
+    simde_x_mm_cmpstr_(a, simde_x_mm_cmpestr_len_(la, imm8), b, simde_x_mm_cmpestr_len_(lb, imm8), imm8),
+    ((imm8 & SIMDE_SIDD_UWORD_OPS) ? 8 : 16), imm8 & SIMDE_SIDD_MOST_SIGNIFICANT);
+}
+#if defined(SIMDE_X86_SSE4_2_NATIVE)
+  #if defined(__clang__) && !SIMDE_DETECT_CLANG_VERSION_CHECK(3,8,0)
+    #define simde_mm_cmpestri(a, la, b, lb, imm8) \
+      _mm_cmpestri( \
+        HEDLEY_REINTERPRET_CAST(__v16qi, a), la, \
+        HEDLEY_REINTERPRET_CAST(__v16qi, b), lb, \
+        imm8)
+  #else
+    #define simde_mm_cmpestri(a, la, b, lb, imm8) _mm_cmpestri(a, la, b, lb, imm8)
+  #endif
+#endif
+#if defined(SIMDE_X86_SSE4_2_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cmpestri
+  #define _mm_cmpestri(a, la, b, lb, imm8) simde_mm_cmpestri(a, la, b, lb, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_cmpestrm (simde__m128i a, int la, simde__m128i b, int lb, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_x_mm_cmpstrm_(simde_x_mm_cmpstr_(a, simde_x_mm_cmpestr_len_(la, imm8), b, simde_x_mm_cmpestr_len_(lb, imm8), imm8), imm8);
+}
+#if defined(SIMDE_X86_SSE4_2_NATIVE)
+  #if defined(__clang__) && !SIMDE_DETECT_CLANG_VERSION_CHECK(3,8,0)
+    #define simde_mm_cmpestrm(a, la, b, lb, imm8) \
+      _mm_cmpestrm( \
+        HEDLEY_REINTERPRET_CAST(__v16qi, a), la, \
+        HEDLEY_REINTERPRET_CAST(__v16qi, b), lb, \
+        imm8)
+  #else
+    #define simde_mm_cmpestrm(a, la, b, lb, imm8) _mm_cmpestrm(a, la, b, lb, imm8)
+  #endif
+#endif
+#if defined(SIMDE_X86_SSE4_2_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cmpestrm
+  #define _mm_cmpestrm(a, la, b, lb, imm8) simde_mm_cmpestrm(a, la, b, lb, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_mm_cmpestra (simde__m128i a, int la, simde__m128i b, int lb, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return (simde_x_mm_cmpstr_(a, simde_x_mm_cmpestr_len_(la, imm8), b, simde_x_mm_cmpestr_len_(lb, imm8), imm8) == 0) &&
+    (simde_x_mm_cmpestr_len_(lb, imm8) == ((imm8 & SIMDE_SIDD_UWORD_OPS) ? 8 : 16));
+}
+#if defined(SIMDE_X86_SSE4_2_NATIVE)
+  #if defined(__clang__) && !SIMDE_DETECT_CLANG_VERSION_CHECK(3,8,0)
+    #define simde_mm_cmpestra(a, la, b, lb, imm8) \
+      _mm_cmpestra( \
+        HEDLEY_REINTERPRET_CAST(__v16qi, a), la, \
+        HEDLEY_REINTERPRET_CAST(__v16qi, b), lb, \
+        imm8)
+  #else
+    #define simde_mm_cmpestra(a, la, b, lb, imm8) _mm_cmpestra(a, la, b, lb, imm8)
+  #endif
+#endif
+#if defined(SIMDE_X86_SSE4_2_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cmpestra
+  #define _mm_cmpestra(a, la, b, lb, imm8) simde_mm_cmpestra(a, la, b, lb, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_mm_cmpestrc (simde__m128i a, int la, simde__m128i b, int lb, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_x_mm_cmpstr_(a, simde_x_mm_cmpestr_len_(la, imm8), b, simde_x_mm_cmpestr_len_(lb, imm8), imm8) != 0;
+}
+#if defined(SIMDE_X86_SSE4_2_NATIVE)
+  #if defined(__clang__) && !SIMDE_DETECT_CLANG_VERSION_CHECK(3,8,0)
+    #define simde_mm_cmpestrc(a, la, b, lb, imm8) \
+      _mm_cmpestrc( \
+        HEDLEY_REINTERPRET_CAST(__v16qi, a), la, \
+        HEDLEY_REINTERPRET_CAST(__v16qi, b), lb, \
+        imm8)
+  #else
+    #define simde_mm_cmpestrc(a, la, b, lb, imm8) _mm_cmpestrc(a, la, b, lb, imm8)
+  #endif
+#endif
+#if defined(SIMDE_X86_SSE4_2_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cmpestrc
+  #define _mm_cmpestrc(a, la, b, lb, imm8) simde_mm_cmpestrc(a, la, b, lb, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_mm_cmpestro (simde__m128i a, int la, simde__m128i b, int lb, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_x_mm_cmpstr_(a, simde_x_mm_cmpestr_len_(la, imm8), b, simde_x_mm_cmpestr_len_(lb, imm8), imm8) & 1;
+}
+#if defined(SIMDE_X86_SSE4_2_NATIVE)
+  #if defined(__clang__) && !SIMDE_DETECT_CLANG_VERSION_CHECK(3,8,0)
+    #define simde_mm_cmpestro(a, la, b, lb, imm8) \
+      _mm_cmpestro( \
+        HEDLEY_REINTERPRET_CAST(__v16qi, a), la, \
+        HEDLEY_REINTERPRET_CAST(__v16qi, b), lb, \
+        imm8)
+  #else
+    #define simde_mm_cmpestro(a, la, b, lb, imm8) _mm_cmpestro(a, la, b, lb, imm8)
+  #endif
+#endif
+#if defined(SIMDE_X86_SSE4_2_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cmpestro
+  #define _mm_cmpestro(a, la, b, lb, imm8) simde_mm_cmpestro(a, la, b, lb, imm8)
+#endif
+
 SIMDE_FUNCTION_ATTRIBUTES
 uint32_t
 simde_mm_crc32_u8(uint32_t prevcrc, uint8_t v) {
@@ -298,15 +685,7 @@ simde_mm_crc32_u8(uint32_t prevcrc, uint8_t v) {
     #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(__ARM_FEATURE_CRC32)
       return __crc32cb(prevcrc, v);
     #else
-      uint32_t crc = prevcrc;
-      crc ^= v;
-      for(int bit = 0 ; bit < 8 ; bit++) {
-        if (crc & 1)
-          crc = (crc >> 1) ^ UINT32_C(0x82f63b78);
-        else
-          crc = (crc >> 1);
-      }
-      return crc;
+      return simde_x_crc32c_u8(prevcrc, v);
     #endif
   #endif
 }
@@ -323,10 +702,7 @@ simde_mm_crc32_u16(uint32_t prevcrc, uint16_t v) {
     #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(__ARM_FEATURE_CRC32)
       return __crc32ch(prevcrc, v);
     #else
-      uint32_t crc = prevcrc;
-      crc = simde_mm_crc32_u8(crc, v & 0xff);
-      crc = simde_mm_crc32_u8(crc, (v >> 8) & 0xff);
-      return crc;
+      return simde_x_crc32c_u16(prevcrc, v);
     #endif
   #endif
 }
@@ -343,10 +719,7 @@ simde_mm_crc32_u32(uint32_t prevcrc, uint32_t v) {
     #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(__ARM_FEATURE_CRC32)
       return __crc32cw(prevcrc, v);
     #else
-      uint32_t crc = prevcrc;
-      crc = simde_mm_crc32_u16(crc, v & 0xffff);
-      crc = simde_mm_crc32_u16(crc, (v >> 16) & 0xffff);
-      return crc;
+      return simde_x_crc32c_u32(prevcrc, v);
     #endif
   #endif
 }
@@ -363,10 +736,7 @@ simde_mm_crc32_u64(uint64_t prevcrc, uint64_t v) {
     #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(__ARM_FEATURE_CRC32)
       return __crc32cd(HEDLEY_STATIC_CAST(uint32_t, prevcrc), v);
     #else
-      uint64_t crc = prevcrc;
-      crc = simde_mm_crc32_u32(HEDLEY_STATIC_CAST(uint32_t, crc), v & 0xffffffff);
-      crc = simde_mm_crc32_u32(HEDLEY_STATIC_CAST(uint32_t, crc), (v >> 32) & 0xffffffff);
-      return crc;
+      return simde_x_crc32c_u64(HEDLEY_STATIC_CAST(uint32_t, prevcrc), v);
     #endif
   #endif
 }
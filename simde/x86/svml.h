@@ -32,11 +32,17 @@
 #include "avx2.h"
 #include "avx512/abs.h"
 #include "avx512/add.h"
+#include "avx512/and.h"
+#include "avx512/cast.h"
 #include "avx512/cmp.h"
 #include "avx512/copysign.h"
 #include "avx512/xorsign.h"
 #include "avx512/div.h"
 #include "avx512/fmadd.h"
+#include "avx512/fmsub.h"
+#include "avx512/fnmadd.h"
+#include "avx512/max.h"
+#include "avx512/min.h"
 #include "avx512/mov.h"
 #include "avx512/mul.h"
 #include "avx512/negate.h"
@@ -44,8 +50,12 @@
 #include "avx512/set1.h"
 #include "avx512/setone.h"
 #include "avx512/setzero.h"
+#include "avx512/slli.h"
 #include "avx512/sqrt.h"
+#include "avx512/srli.h"
 #include "avx512/sub.h"
+#include "avx512/test.h"
+#include "avx512/xor.h"
 
 #include "../simde-complex.h"
 
@@ -53,6 +63,2085 @@ HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
 SIMDE_BEGIN_DECLS_
 
+/* Without SVML or SLEEF, exp, log, sin, cos, tan, pow, cbrt and erf use
+ * the branch-free kernels below instead of calling libm once per lane.
+ * They are built from SIMDe's own vector operations (range reduction
+ * followed by a polynomial), and stay within SVML's 4 ULP bound.  They
+ * are used for SIMDE_ACCURACY_PREFERENCE <= 1; define it to 2 to keep
+ * calling libm for each lane instead.  Without any native vector support
+ * the per-lane libm loops are kept as well. */
+#if (SIMDE_NATURAL_VECTOR_SIZE > 0) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+  #define SIMDE_X86_SVML_POLY_
+
+  #define SIMDE_X86_SVML_SIN_ 0
+  #define SIMDE_X86_SVML_COS_ 1
+  #define SIMDE_X86_SVML_TAN_ 2
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_x_mm_exp_ps_poly_ (simde__m128 a) {
+  /* exp(a) = 2^n * exp(r), with n = round(a / ln(2)) and r = a - n * ln(2)
+   * using a two-part ln(2).  2^n is applied in two steps so results in the
+   * subnormal range don't need any special handling. */
+  const simde__m128 magic = simde_mm_set1_ps(SIMDE_FLOAT32_C(12582912.0));
+  simde__m128 x, n, n1, r, p;
+
+  x = simde_mm_min_ps(simde_mm_set1_ps(SIMDE_FLOAT32_C(89.0)), simde_mm_max_ps(simde_mm_set1_ps(SIMDE_FLOAT32_C(-104.0)), a));
+  n = simde_mm_sub_ps(simde_mm_fmadd_ps(x, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.44269504088896341)), magic), magic);
+  r = simde_mm_fnmadd_ps(n, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.693359375)), x);
+  r = simde_mm_fnmadd_ps(n, simde_mm_set1_ps(SIMDE_FLOAT32_C(-2.12194440e-4)), r);
+
+  /* exp(r) = 1 + r + r^2 * Q(r) */
+  p = simde_mm_set1_ps(SIMDE_FLOAT32_C(1.9875691500e-4));
+  p = simde_mm_fmadd_ps(p, r, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.3981999507e-3)));
+  p = simde_mm_fmadd_ps(p, r, simde_mm_set1_ps(SIMDE_FLOAT32_C(8.3334519073e-3)));
+  p = simde_mm_fmadd_ps(p, r, simde_mm_set1_ps(SIMDE_FLOAT32_C(4.1665795894e-2)));
+  p = simde_mm_fmadd_ps(p, r, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.6666665459e-1)));
+  p = simde_mm_fmadd_ps(p, r, simde_mm_set1_ps(SIMDE_FLOAT32_C(5.0000001201e-1)));
+  p = simde_mm_fmadd_ps(p, simde_mm_mul_ps(r, r), r);
+  p = simde_mm_add_ps(p, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.0)));
+
+  n1 = simde_mm_sub_ps(simde_mm_fmadd_ps(n, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.5)), magic), magic);
+  n = simde_mm_sub_ps(n, n1);
+  p = simde_mm_mul_ps(p, simde_mm_castsi128_ps(simde_mm_slli_epi32(simde_mm_castps_si128(simde_mm_add_ps(n1, simde_mm_set1_ps(SIMDE_FLOAT32_C(12583039.0)))), 23)));
+  return simde_mm_mul_ps(p, simde_mm_castsi128_ps(simde_mm_slli_epi32(simde_mm_castps_si128(simde_mm_add_ps(n, simde_mm_set1_ps(SIMDE_FLOAT32_C(12583039.0)))), 23)));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_x_mm_exp_pd_poly_ (simde__m128d a) {
+  /* exp(a) = 2^n * exp(r), with n = round(a / ln(2)) and r = a - n * ln(2)
+   * using a two-part ln(2).  2^n is applied in two steps so results in the
+   * subnormal range don't need any special handling. */
+  const simde__m128d magic = simde_mm_set1_pd(SIMDE_FLOAT64_C(6755399441055744.0));
+  simde__m128d x, n, n1, r, p;
+
+  x = simde_mm_min_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(710.0)), simde_mm_max_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(-746.0)), a));
+  n = simde_mm_sub_pd(simde_mm_fmadd_pd(x, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.4426950408889634074)), magic), magic);
+  r = simde_mm_fnmadd_pd(n, simde_mm_set1_pd(SIMDE_FLOAT64_C(6.93147180369123816490e-01)), x);
+  r = simde_mm_fnmadd_pd(n, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.90821492927058770002e-10)), r);
+
+  /* exp(r) = 1 + r + r^2 * Q(r) */
+  p = simde_mm_set1_pd(SIMDE_FLOAT64_C(2.5110038296727242e-08));
+  p = simde_mm_fmadd_pd(p, r, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.7632640675430235e-07)));
+  p = simde_mm_fmadd_pd(p, r, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.7557242367449659e-06)));
+  p = simde_mm_fmadd_pd(p, r, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.4801487366025675e-05)));
+  p = simde_mm_fmadd_pd(p, r, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.00019841269886563802)));
+  p = simde_mm_fmadd_pd(p, r, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.0013888888947785523)));
+  p = simde_mm_fmadd_pd(p, r, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.0083333333333222154)));
+  p = simde_mm_fmadd_pd(p, r, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.041666666666522106)));
+  p = simde_mm_fmadd_pd(p, r, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.16666666666666674)));
+  p = simde_mm_fmadd_pd(p, r, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.500000000000001)));
+  p = simde_mm_fmadd_pd(p, simde_mm_mul_pd(r, r), r);
+  p = simde_mm_add_pd(p, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0)));
+
+  n1 = simde_mm_sub_pd(simde_mm_fmadd_pd(n, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.5)), magic), magic);
+  n = simde_mm_sub_pd(n, n1);
+  p = simde_mm_mul_pd(p, simde_mm_castsi128_pd(simde_mm_slli_epi64(simde_mm_castpd_si128(simde_mm_add_pd(n1, simde_mm_set1_pd(SIMDE_FLOAT64_C(6755399441056767.0)))), 52)));
+  return simde_mm_mul_pd(p, simde_mm_castsi128_pd(simde_mm_slli_epi64(simde_mm_castpd_si128(simde_mm_add_pd(n, simde_mm_set1_pd(SIMDE_FLOAT64_C(6755399441056767.0)))), 52)));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_x_mm256_exp_ps_poly_ (simde__m256 a) {
+  /* exp(a) = 2^n * exp(r), with n = round(a / ln(2)) and r = a - n * ln(2)
+   * using a two-part ln(2).  2^n is applied in two steps so results in the
+   * subnormal range don't need any special handling. */
+  const simde__m256 magic = simde_mm256_set1_ps(SIMDE_FLOAT32_C(12582912.0));
+  simde__m256 x, n, n1, r, p;
+
+  x = simde_mm256_min_ps(simde_mm256_set1_ps(SIMDE_FLOAT32_C(89.0)), simde_mm256_max_ps(simde_mm256_set1_ps(SIMDE_FLOAT32_C(-104.0)), a));
+  n = simde_mm256_sub_ps(simde_mm256_fmadd_ps(x, simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.44269504088896341)), magic), magic);
+  r = simde_mm256_fnmadd_ps(n, simde_mm256_set1_ps(SIMDE_FLOAT32_C(0.693359375)), x);
+  r = simde_mm256_fnmadd_ps(n, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-2.12194440e-4)), r);
+
+  /* exp(r) = 1 + r + r^2 * Q(r) */
+  p = simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.9875691500e-4));
+  p = simde_mm256_fmadd_ps(p, r, simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.3981999507e-3)));
+  p = simde_mm256_fmadd_ps(p, r, simde_mm256_set1_ps(SIMDE_FLOAT32_C(8.3334519073e-3)));
+  p = simde_mm256_fmadd_ps(p, r, simde_mm256_set1_ps(SIMDE_FLOAT32_C(4.1665795894e-2)));
+  p = simde_mm256_fmadd_ps(p, r, simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.6666665459e-1)));
+  p = simde_mm256_fmadd_ps(p, r, simde_mm256_set1_ps(SIMDE_FLOAT32_C(5.0000001201e-1)));
+  p = simde_mm256_fmadd_ps(p, simde_mm256_mul_ps(r, r), r);
+  p = simde_mm256_add_ps(p, simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.0)));
+
+  n1 = simde_mm256_sub_ps(simde_mm256_fmadd_ps(n, simde_mm256_set1_ps(SIMDE_FLOAT32_C(0.5)), magic), magic);
+  n = simde_mm256_sub_ps(n, n1);
+  p = simde_mm256_mul_ps(p, simde_mm256_castsi256_ps(simde_mm256_slli_epi32(simde_mm256_castps_si256(simde_mm256_add_ps(n1, simde_mm256_set1_ps(SIMDE_FLOAT32_C(12583039.0)))), 23)));
+  return simde_mm256_mul_ps(p, simde_mm256_castsi256_ps(simde_mm256_slli_epi32(simde_mm256_castps_si256(simde_mm256_add_ps(n, simde_mm256_set1_ps(SIMDE_FLOAT32_C(12583039.0)))), 23)));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256d
+simde_x_mm256_exp_pd_poly_ (simde__m256d a) {
+  /* exp(a) = 2^n * exp(r), with n = round(a / ln(2)) and r = a - n * ln(2)
+   * using a two-part ln(2).  2^n is applied in two steps so results in the
+   * subnormal range don't need any special handling. */
+  const simde__m256d magic = simde_mm256_set1_pd(SIMDE_FLOAT64_C(6755399441055744.0));
+  simde__m256d x, n, n1, r, p;
+
+  x = simde_mm256_min_pd(simde_mm256_set1_pd(SIMDE_FLOAT64_C(710.0)), simde_mm256_max_pd(simde_mm256_set1_pd(SIMDE_FLOAT64_C(-746.0)), a));
+  n = simde_mm256_sub_pd(simde_mm256_fmadd_pd(x, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.4426950408889634074)), magic), magic);
+  r = simde_mm256_fnmadd_pd(n, simde_mm256_set1_pd(SIMDE_FLOAT64_C(6.93147180369123816490e-01)), x);
+  r = simde_mm256_fnmadd_pd(n, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.90821492927058770002e-10)), r);
+
+  /* exp(r) = 1 + r + r^2 * Q(r) */
+  p = simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.5110038296727242e-08));
+  p = simde_mm256_fmadd_pd(p, r, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.7632640675430235e-07)));
+  p = simde_mm256_fmadd_pd(p, r, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.7557242367449659e-06)));
+  p = simde_mm256_fmadd_pd(p, r, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.4801487366025675e-05)));
+  p = simde_mm256_fmadd_pd(p, r, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.00019841269886563802)));
+  p = simde_mm256_fmadd_pd(p, r, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.0013888888947785523)));
+  p = simde_mm256_fmadd_pd(p, r, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.0083333333333222154)));
+  p = simde_mm256_fmadd_pd(p, r, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.041666666666522106)));
+  p = simde_mm256_fmadd_pd(p, r, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.16666666666666674)));
+  p = simde_mm256_fmadd_pd(p, r, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.500000000000001)));
+  p = simde_mm256_fmadd_pd(p, simde_mm256_mul_pd(r, r), r);
+  p = simde_mm256_add_pd(p, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.0)));
+
+  n1 = simde_mm256_sub_pd(simde_mm256_fmadd_pd(n, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.5)), magic), magic);
+  n = simde_mm256_sub_pd(n, n1);
+  p = simde_mm256_mul_pd(p, simde_mm256_castsi256_pd(simde_mm256_slli_epi64(simde_mm256_castpd_si256(simde_mm256_add_pd(n1, simde_mm256_set1_pd(SIMDE_FLOAT64_C(6755399441056767.0)))), 52)));
+  return simde_mm256_mul_pd(p, simde_mm256_castsi256_pd(simde_mm256_slli_epi64(simde_mm256_castpd_si256(simde_mm256_add_pd(n, simde_mm256_set1_pd(SIMDE_FLOAT64_C(6755399441056767.0)))), 52)));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_x_mm512_exp_ps_poly_ (simde__m512 a) {
+  /* exp(a) = 2^n * exp(r), with n = round(a / ln(2)) and r = a - n * ln(2)
+   * using a two-part ln(2).  2^n is applied in two steps so results in the
+   * subnormal range don't need any special handling. */
+  const simde__m512 magic = simde_mm512_set1_ps(SIMDE_FLOAT32_C(12582912.0));
+  simde__m512 x, n, n1, r, p;
+
+  x = simde_mm512_min_ps(simde_mm512_set1_ps(SIMDE_FLOAT32_C(89.0)), simde_mm512_max_ps(simde_mm512_set1_ps(SIMDE_FLOAT32_C(-104.0)), a));
+  n = simde_mm512_sub_ps(simde_mm512_fmadd_ps(x, simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.44269504088896341)), magic), magic);
+  r = simde_mm512_fnmadd_ps(n, simde_mm512_set1_ps(SIMDE_FLOAT32_C(0.693359375)), x);
+  r = simde_mm512_fnmadd_ps(n, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-2.12194440e-4)), r);
+
+  /* exp(r) = 1 + r + r^2 * Q(r) */
+  p = simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.9875691500e-4));
+  p = simde_mm512_fmadd_ps(p, r, simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.3981999507e-3)));
+  p = simde_mm512_fmadd_ps(p, r, simde_mm512_set1_ps(SIMDE_FLOAT32_C(8.3334519073e-3)));
+  p = simde_mm512_fmadd_ps(p, r, simde_mm512_set1_ps(SIMDE_FLOAT32_C(4.1665795894e-2)));
+  p = simde_mm512_fmadd_ps(p, r, simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.6666665459e-1)));
+  p = simde_mm512_fmadd_ps(p, r, simde_mm512_set1_ps(SIMDE_FLOAT32_C(5.0000001201e-1)));
+  p = simde_mm512_fmadd_ps(p, simde_mm512_mul_ps(r, r), r);
+  p = simde_mm512_add_ps(p, simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.0)));
+
+  n1 = simde_mm512_sub_ps(simde_mm512_fmadd_ps(n, simde_mm512_set1_ps(SIMDE_FLOAT32_C(0.5)), magic), magic);
+  n = simde_mm512_sub_ps(n, n1);
+  p = simde_mm512_mul_ps(p, simde_mm512_castsi512_ps(simde_mm512_slli_epi32(simde_mm512_castps_si512(simde_mm512_add_ps(n1, simde_mm512_set1_ps(SIMDE_FLOAT32_C(12583039.0)))), 23)));
+  return simde_mm512_mul_ps(p, simde_mm512_castsi512_ps(simde_mm512_slli_epi32(simde_mm512_castps_si512(simde_mm512_add_ps(n, simde_mm512_set1_ps(SIMDE_FLOAT32_C(12583039.0)))), 23)));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_x_mm512_exp_pd_poly_ (simde__m512d a) {
+  /* exp(a) = 2^n * exp(r), with n = round(a / ln(2)) and r = a - n * ln(2)
+   * using a two-part ln(2).  2^n is applied in two steps so results in the
+   * subnormal range don't need any special handling. */
+  const simde__m512d magic = simde_mm512_set1_pd(SIMDE_FLOAT64_C(6755399441055744.0));
+  simde__m512d x, n, n1, r, p;
+
+  x = simde_mm512_min_pd(simde_mm512_set1_pd(SIMDE_FLOAT64_C(710.0)), simde_mm512_max_pd(simde_mm512_set1_pd(SIMDE_FLOAT64_C(-746.0)), a));
+  n = simde_mm512_sub_pd(simde_mm512_fmadd_pd(x, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.4426950408889634074)), magic), magic);
+  r = simde_mm512_fnmadd_pd(n, simde_mm512_set1_pd(SIMDE_FLOAT64_C(6.93147180369123816490e-01)), x);
+  r = simde_mm512_fnmadd_pd(n, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.90821492927058770002e-10)), r);
+
+  /* exp(r) = 1 + r + r^2 * Q(r) */
+  p = simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.5110038296727242e-08));
+  p = simde_mm512_fmadd_pd(p, r, simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.7632640675430235e-07)));
+  p = simde_mm512_fmadd_pd(p, r, simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.7557242367449659e-06)));
+  p = simde_mm512_fmadd_pd(p, r, simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.4801487366025675e-05)));
+  p = simde_mm512_fmadd_pd(p, r, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.00019841269886563802)));
+  p = simde_mm512_fmadd_pd(p, r, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.0013888888947785523)));
+  p = simde_mm512_fmadd_pd(p, r, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.0083333333333222154)));
+  p = simde_mm512_fmadd_pd(p, r, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.041666666666522106)));
+  p = simde_mm512_fmadd_pd(p, r, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.16666666666666674)));
+  p = simde_mm512_fmadd_pd(p, r, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.500000000000001)));
+  p = simde_mm512_fmadd_pd(p, simde_mm512_mul_pd(r, r), r);
+  p = simde_mm512_add_pd(p, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.0)));
+
+  n1 = simde_mm512_sub_pd(simde_mm512_fmadd_pd(n, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.5)), magic), magic);
+  n = simde_mm512_sub_pd(n, n1);
+  p = simde_mm512_mul_pd(p, simde_mm512_castsi512_pd(simde_mm512_slli_epi64(simde_mm512_castpd_si512(simde_mm512_add_pd(n1, simde_mm512_set1_pd(SIMDE_FLOAT64_C(6755399441056767.0)))), 52)));
+  return simde_mm512_mul_pd(p, simde_mm512_castsi512_pd(simde_mm512_slli_epi64(simde_mm512_castpd_si512(simde_mm512_add_pd(n, simde_mm512_set1_pd(SIMDE_FLOAT64_C(6755399441056767.0)))), 52)));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_x_mm_log_ps_poly_ (simde__m128 a) {
+  /* Cephes' logf: a = m * 2^e with m in [sqrt(0.5), sqrt(2)), and
+   * log(a) = e * ln(2) + log(1 + f) with f = m - 1. */
+  const simde__m128 one = simde_mm_set1_ps(SIMDE_FLOAT32_C(1.0));
+  simde__m128 tiny, lt;
+  simde__m128 x, e, m, f, z, p;
+  simde__m128i bits;
+
+  /* Scale subnormals into the normal range. */
+  tiny = simde_mm_cmp_ps(a, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.17549435082228750797e-38)), SIMDE_CMP_LT_OQ);
+  x = simde_mm_blendv_ps(a, simde_mm_mul_ps(a, simde_mm_set1_ps(SIMDE_FLOAT32_C(16777216.0))), tiny);
+  bits = simde_mm_castps_si128(x);
+
+  /* OR'ing the exponent field into the mantissa of 2^23 gives us a float
+   * without an int -> float conversion. */
+  e = simde_mm_sub_ps(simde_mm_castsi128_ps(simde_mm_or_si128(simde_mm_srli_epi32(bits, 23), simde_mm_castps_si128(simde_mm_set1_ps(SIMDE_FLOAT32_C(8388608.0))))), simde_mm_set1_ps(SIMDE_FLOAT32_C(8388734.0)));
+  e = simde_mm_sub_ps(e, simde_mm_and_ps(tiny, simde_mm_set1_ps(SIMDE_FLOAT32_C(24.0))));
+  m = simde_mm_castsi128_ps(simde_mm_or_si128(simde_mm_and_si128(bits, simde_mm_set1_epi32(INT32_C(0x007fffff))), simde_mm_set1_epi32(INT32_C(0x3f000000))));
+
+  lt = simde_mm_cmp_ps(m, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.707106781186547524)), SIMDE_CMP_LT_OQ);
+  e = simde_mm_sub_ps(e, simde_mm_and_ps(lt, one));
+  f = simde_mm_sub_ps(simde_mm_add_ps(m, simde_mm_and_ps(lt, m)), one);
+  z = simde_mm_mul_ps(f, f);
+
+  p = simde_mm_set1_ps(SIMDE_FLOAT32_C(7.0376836292e-2));
+  p = simde_mm_fmadd_ps(p, f, simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.1514610310e-1)));
+  p = simde_mm_fmadd_ps(p, f, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.1676998740e-1)));
+  p = simde_mm_fmadd_ps(p, f, simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.2420140846e-1)));
+  p = simde_mm_fmadd_ps(p, f, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.4249322787e-1)));
+  p = simde_mm_fmadd_ps(p, f, simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.6668057665e-1)));
+  p = simde_mm_fmadd_ps(p, f, simde_mm_set1_ps(SIMDE_FLOAT32_C(2.0000714765e-1)));
+  p = simde_mm_fmadd_ps(p, f, simde_mm_set1_ps(SIMDE_FLOAT32_C(-2.4999993993e-1)));
+  p = simde_mm_fmadd_ps(p, f, simde_mm_set1_ps(SIMDE_FLOAT32_C(3.3333331174e-1)));
+  p = simde_mm_mul_ps(simde_mm_mul_ps(p, f), z);
+  p = simde_mm_fmadd_ps(e, simde_mm_set1_ps(SIMDE_FLOAT32_C(-2.12194440e-4)), p);
+  p = simde_mm_fnmadd_ps(simde_mm_set1_ps(SIMDE_FLOAT32_C(0.5)), z, p);
+  p = simde_mm_add_ps(f, p);
+  p = simde_mm_fmadd_ps(e, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.693359375)), p);
+
+  /* log(x < 0) = NaN, log(0) = -inf, log(inf) = inf, log(NaN) = NaN */
+  p = simde_mm_blendv_ps(p, simde_mm_set1_ps(SIMDE_MATH_NANF), simde_mm_cmp_ps(a, simde_mm_setzero_ps(), SIMDE_CMP_LT_OQ));
+  p = simde_mm_blendv_ps(p, simde_mm_set1_ps(-SIMDE_MATH_INFINITYF), simde_mm_cmp_ps(a, simde_mm_setzero_ps(), SIMDE_CMP_EQ_OQ));
+  return simde_mm_blendv_ps(p, a, simde_mm_cmp_ps(a, simde_mm_set1_ps(SIMDE_MATH_INFINITYF), SIMDE_CMP_NLT_UQ));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_x_mm_log_pd_poly_ (simde__m128d a) {
+  /* fdlibm's log: a = m * 2^k with m in (sqrt(0.5), sqrt(2)], f = m - 1,
+   * and log(1 + f) = f - s * (f - R(z)) with s = f / (2 + f), z = s^2. */
+  const simde__m128d one = simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0));
+  simde__m128d tiny, gt;
+  simde__m128d x, k, m, f, s, z, w, t1, t2, hfsq, p;
+  simde__m128i bits;
+
+  /* Scale subnormals into the normal range. */
+  tiny = simde_mm_cmp_pd(a, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.2250738585072013830902e-308)), SIMDE_CMP_LT_OQ);
+  x = simde_mm_blendv_pd(a, simde_mm_mul_pd(a, simde_mm_set1_pd(SIMDE_FLOAT64_C(18014398509481984.0))), tiny);
+  bits = simde_mm_castpd_si128(x);
+
+  /* OR'ing the exponent field into the mantissa of 2^52 gives us a double
+   * without an int -> double conversion. */
+  k = simde_mm_sub_pd(simde_mm_castsi128_pd(simde_mm_or_si128(simde_mm_srli_epi64(bits, 52), simde_mm_castpd_si128(simde_mm_set1_pd(SIMDE_FLOAT64_C(4503599627370496.0))))), simde_mm_set1_pd(SIMDE_FLOAT64_C(4503599627371519.0)));
+  k = simde_mm_sub_pd(k, simde_mm_and_pd(tiny, simde_mm_set1_pd(SIMDE_FLOAT64_C(54.0))));
+  m = simde_mm_castsi128_pd(simde_mm_or_si128(simde_mm_and_si128(bits, simde_mm_set1_epi64x(INT64_C(0x000fffffffffffff))), simde_mm_set1_epi64x(INT64_C(0x3ff0000000000000))));
+
+  gt = simde_mm_cmp_pd(m, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.41421356237309504880)), SIMDE_CMP_GT_OQ);
+  m = simde_mm_blendv_pd(m, simde_mm_mul_pd(m, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.5))), gt);
+  k = simde_mm_add_pd(k, simde_mm_and_pd(gt, one));
+
+  f = simde_mm_sub_pd(m, one);
+  s = simde_mm_div_pd(f, simde_mm_add_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(2.0)), f));
+  z = simde_mm_mul_pd(s, s);
+  w = simde_mm_mul_pd(z, z);
+  t1 = simde_mm_fmadd_pd(simde_mm_fmadd_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(1.479819860511658591e-01)), w, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.818357216161805012e-01))), w, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.857142874366239149e-01)));
+  t1 = simde_mm_mul_pd(z, simde_mm_fmadd_pd(t1, w, simde_mm_set1_pd(SIMDE_FLOAT64_C(6.666666666666735130e-01))));
+  t2 = simde_mm_fmadd_pd(simde_mm_fmadd_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(1.531383769920937332e-01)), w, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.222219843214978396e-01))), w, simde_mm_set1_pd(SIMDE_FLOAT64_C(3.999999999940941908e-01)));
+  t2 = simde_mm_mul_pd(w, t2);
+  hfsq = simde_mm_mul_pd(simde_mm_mul_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(0.5)), f), f);
+
+  /* k * ln2_hi - ((hfsq - (s * (hfsq + R) + k * ln2_lo)) - f) */
+  p = simde_mm_fmadd_pd(s, simde_mm_add_pd(hfsq, simde_mm_add_pd(t1, t2)), simde_mm_mul_pd(k, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.90821492927058770002e-10))));
+  p = simde_mm_sub_pd(simde_mm_sub_pd(hfsq, p), f);
+  p = simde_mm_fmsub_pd(k, simde_mm_set1_pd(SIMDE_FLOAT64_C(6.93147180369123816490e-01)), p);
+
+  /* log(x < 0) = NaN, log(0) = -inf, log(inf) = inf, log(NaN) = NaN */
+  p = simde_mm_blendv_pd(p, simde_mm_set1_pd(SIMDE_MATH_NAN), simde_mm_cmp_pd(a, simde_mm_setzero_pd(), SIMDE_CMP_LT_OQ));
+  p = simde_mm_blendv_pd(p, simde_mm_set1_pd(-SIMDE_MATH_INFINITY), simde_mm_cmp_pd(a, simde_mm_setzero_pd(), SIMDE_CMP_EQ_OQ));
+  return simde_mm_blendv_pd(p, a, simde_mm_cmp_pd(a, simde_mm_set1_pd(SIMDE_MATH_INFINITY), SIMDE_CMP_NLT_UQ));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_x_mm256_log_ps_poly_ (simde__m256 a) {
+  /* Cephes' logf: a = m * 2^e with m in [sqrt(0.5), sqrt(2)), and
+   * log(a) = e * ln(2) + log(1 + f) with f = m - 1. */
+  const simde__m256 one = simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.0));
+  simde__m256 tiny, lt;
+  simde__m256 x, e, m, f, z, p;
+  simde__m256i bits;
+
+  /* Scale subnormals into the normal range. */
+  tiny = simde_mm256_cmp_ps(a, simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.17549435082228750797e-38)), SIMDE_CMP_LT_OQ);
+  x = simde_mm256_blendv_ps(a, simde_mm256_mul_ps(a, simde_mm256_set1_ps(SIMDE_FLOAT32_C(16777216.0))), tiny);
+  bits = simde_mm256_castps_si256(x);
+
+  /* OR'ing the exponent field into the mantissa of 2^23 gives us a float
+   * without an int -> float conversion. */
+  e = simde_mm256_sub_ps(simde_mm256_castsi256_ps(simde_mm256_or_si256(simde_mm256_srli_epi32(bits, 23), simde_mm256_castps_si256(simde_mm256_set1_ps(SIMDE_FLOAT32_C(8388608.0))))), simde_mm256_set1_ps(SIMDE_FLOAT32_C(8388734.0)));
+  e = simde_mm256_sub_ps(e, simde_mm256_and_ps(tiny, simde_mm256_set1_ps(SIMDE_FLOAT32_C(24.0))));
+  m = simde_mm256_castsi256_ps(simde_mm256_or_si256(simde_mm256_and_si256(bits, simde_mm256_set1_epi32(INT32_C(0x007fffff))), simde_mm256_set1_epi32(INT32_C(0x3f000000))));
+
+  lt = simde_mm256_cmp_ps(m, simde_mm256_set1_ps(SIMDE_FLOAT32_C(0.707106781186547524)), SIMDE_CMP_LT_OQ);
+  e = simde_mm256_sub_ps(e, simde_mm256_and_ps(lt, one));
+  f = simde_mm256_sub_ps(simde_mm256_add_ps(m, simde_mm256_and_ps(lt, m)), one);
+  z = simde_mm256_mul_ps(f, f);
+
+  p = simde_mm256_set1_ps(SIMDE_FLOAT32_C(7.0376836292e-2));
+  p = simde_mm256_fmadd_ps(p, f, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-1.1514610310e-1)));
+  p = simde_mm256_fmadd_ps(p, f, simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.1676998740e-1)));
+  p = simde_mm256_fmadd_ps(p, f, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-1.2420140846e-1)));
+  p = simde_mm256_fmadd_ps(p, f, simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.4249322787e-1)));
+  p = simde_mm256_fmadd_ps(p, f, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-1.6668057665e-1)));
+  p = simde_mm256_fmadd_ps(p, f, simde_mm256_set1_ps(SIMDE_FLOAT32_C(2.0000714765e-1)));
+  p = simde_mm256_fmadd_ps(p, f, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-2.4999993993e-1)));
+  p = simde_mm256_fmadd_ps(p, f, simde_mm256_set1_ps(SIMDE_FLOAT32_C(3.3333331174e-1)));
+  p = simde_mm256_mul_ps(simde_mm256_mul_ps(p, f), z);
+  p = simde_mm256_fmadd_ps(e, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-2.12194440e-4)), p);
+  p = simde_mm256_fnmadd_ps(simde_mm256_set1_ps(SIMDE_FLOAT32_C(0.5)), z, p);
+  p = simde_mm256_add_ps(f, p);
+  p = simde_mm256_fmadd_ps(e, simde_mm256_set1_ps(SIMDE_FLOAT32_C(0.693359375)), p);
+
+  /* log(x < 0) = NaN, log(0) = -inf, log(inf) = inf, log(NaN) = NaN */
+  p = simde_mm256_blendv_ps(p, simde_mm256_set1_ps(SIMDE_MATH_NANF), simde_mm256_cmp_ps(a, simde_mm256_setzero_ps(), SIMDE_CMP_LT_OQ));
+  p = simde_mm256_blendv_ps(p, simde_mm256_set1_ps(-SIMDE_MATH_INFINITYF), simde_mm256_cmp_ps(a, simde_mm256_setzero_ps(), SIMDE_CMP_EQ_OQ));
+  return simde_mm256_blendv_ps(p, a, simde_mm256_cmp_ps(a, simde_mm256_set1_ps(SIMDE_MATH_INFINITYF), SIMDE_CMP_NLT_UQ));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256d
+simde_x_mm256_log_pd_poly_ (simde__m256d a) {
+  /* fdlibm's log: a = m * 2^k with m in (sqrt(0.5), sqrt(2)], f = m - 1,
+   * and log(1 + f) = f - s * (f - R(z)) with s = f / (2 + f), z = s^2. */
+  const simde__m256d one = simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.0));
+  simde__m256d tiny, gt;
+  simde__m256d x, k, m, f, s, z, w, t1, t2, hfsq, p;
+  simde__m256i bits;
+
+  /* Scale subnormals into the normal range. */
+  tiny = simde_mm256_cmp_pd(a, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.2250738585072013830902e-308)), SIMDE_CMP_LT_OQ);
+  x = simde_mm256_blendv_pd(a, simde_mm256_mul_pd(a, simde_mm256_set1_pd(SIMDE_FLOAT64_C(18014398509481984.0))), tiny);
+  bits = simde_mm256_castpd_si256(x);
+
+  /* OR'ing the exponent field into the mantissa of 2^52 gives us a double
+   * without an int -> double conversion. */
+  k = simde_mm256_sub_pd(simde_mm256_castsi256_pd(simde_mm256_or_si256(simde_mm256_srli_epi64(bits, 52), simde_mm256_castpd_si256(simde_mm256_set1_pd(SIMDE_FLOAT64_C(4503599627370496.0))))), simde_mm256_set1_pd(SIMDE_FLOAT64_C(4503599627371519.0)));
+  k = simde_mm256_sub_pd(k, simde_mm256_and_pd(tiny, simde_mm256_set1_pd(SIMDE_FLOAT64_C(54.0))));
+  m = simde_mm256_castsi256_pd(simde_mm256_or_si256(simde_mm256_and_si256(bits, simde_mm256_set1_epi64x(INT64_C(0x000fffffffffffff))), simde_mm256_set1_epi64x(INT64_C(0x3ff0000000000000))));
+
+  gt = simde_mm256_cmp_pd(m, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.41421356237309504880)), SIMDE_CMP_GT_OQ);
+  m = simde_mm256_blendv_pd(m, simde_mm256_mul_pd(m, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.5))), gt);
+  k = simde_mm256_add_pd(k, simde_mm256_and_pd(gt, one));
+
+  f = simde_mm256_sub_pd(m, one);
+  s = simde_mm256_div_pd(f, simde_mm256_add_pd(simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.0)), f));
+  z = simde_mm256_mul_pd(s, s);
+  w = simde_mm256_mul_pd(z, z);
+  t1 = simde_mm256_fmadd_pd(simde_mm256_fmadd_pd(simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.479819860511658591e-01)), w, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.818357216161805012e-01))), w, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.857142874366239149e-01)));
+  t1 = simde_mm256_mul_pd(z, simde_mm256_fmadd_pd(t1, w, simde_mm256_set1_pd(SIMDE_FLOAT64_C(6.666666666666735130e-01))));
+  t2 = simde_mm256_fmadd_pd(simde_mm256_fmadd_pd(simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.531383769920937332e-01)), w, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.222219843214978396e-01))), w, simde_mm256_set1_pd(SIMDE_FLOAT64_C(3.999999999940941908e-01)));
+  t2 = simde_mm256_mul_pd(w, t2);
+  hfsq = simde_mm256_mul_pd(simde_mm256_mul_pd(simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.5)), f), f);
+
+  /* k * ln2_hi - ((hfsq - (s * (hfsq + R) + k * ln2_lo)) - f) */
+  p = simde_mm256_fmadd_pd(s, simde_mm256_add_pd(hfsq, simde_mm256_add_pd(t1, t2)), simde_mm256_mul_pd(k, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.90821492927058770002e-10))));
+  p = simde_mm256_sub_pd(simde_mm256_sub_pd(hfsq, p), f);
+  p = simde_mm256_fmsub_pd(k, simde_mm256_set1_pd(SIMDE_FLOAT64_C(6.93147180369123816490e-01)), p);
+
+  /* log(x < 0) = NaN, log(0) = -inf, log(inf) = inf, log(NaN) = NaN */
+  p = simde_mm256_blendv_pd(p, simde_mm256_set1_pd(SIMDE_MATH_NAN), simde_mm256_cmp_pd(a, simde_mm256_setzero_pd(), SIMDE_CMP_LT_OQ));
+  p = simde_mm256_blendv_pd(p, simde_mm256_set1_pd(-SIMDE_MATH_INFINITY), simde_mm256_cmp_pd(a, simde_mm256_setzero_pd(), SIMDE_CMP_EQ_OQ));
+  return simde_mm256_blendv_pd(p, a, simde_mm256_cmp_pd(a, simde_mm256_set1_pd(SIMDE_MATH_INFINITY), SIMDE_CMP_NLT_UQ));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_x_mm512_log_ps_poly_ (simde__m512 a) {
+  /* Cephes' logf: a = m * 2^e with m in [sqrt(0.5), sqrt(2)), and
+   * log(a) = e * ln(2) + log(1 + f) with f = m - 1. */
+  const simde__m512 one = simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.0));
+  simde__mmask16 tiny, lt;
+  simde__m512 x, e, m, f, z, p;
+  simde__m512i bits;
+
+  /* Scale subnormals into the normal range. */
+  tiny = simde_mm512_cmp_ps_mask(a, simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.17549435082228750797e-38)), SIMDE_CMP_LT_OQ);
+  x = simde_mm512_mask_mov_ps(a, tiny, simde_mm512_mul_ps(a, simde_mm512_set1_ps(SIMDE_FLOAT32_C(16777216.0))));
+  bits = simde_mm512_castps_si512(x);
+
+  /* OR'ing the exponent field into the mantissa of 2^23 gives us a float
+   * without an int -> float conversion. */
+  e = simde_mm512_sub_ps(simde_mm512_castsi512_ps(simde_mm512_or_si512(simde_mm512_srli_epi32(bits, 23), simde_mm512_castps_si512(simde_mm512_set1_ps(SIMDE_FLOAT32_C(8388608.0))))), simde_mm512_set1_ps(SIMDE_FLOAT32_C(8388734.0)));
+  e = simde_mm512_sub_ps(e, simde_mm512_maskz_mov_ps(tiny, simde_mm512_set1_ps(SIMDE_FLOAT32_C(24.0))));
+  m = simde_mm512_castsi512_ps(simde_mm512_or_si512(simde_mm512_and_si512(bits, simde_mm512_set1_epi32(INT32_C(0x007fffff))), simde_mm512_set1_epi32(INT32_C(0x3f000000))));
+
+  lt = simde_mm512_cmp_ps_mask(m, simde_mm512_set1_ps(SIMDE_FLOAT32_C(0.707106781186547524)), SIMDE_CMP_LT_OQ);
+  e = simde_mm512_sub_ps(e, simde_mm512_maskz_mov_ps(lt, one));
+  f = simde_mm512_sub_ps(simde_mm512_add_ps(m, simde_mm512_maskz_mov_ps(lt, m)), one);
+  z = simde_mm512_mul_ps(f, f);
+
+  p = simde_mm512_set1_ps(SIMDE_FLOAT32_C(7.0376836292e-2));
+  p = simde_mm512_fmadd_ps(p, f, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-1.1514610310e-1)));
+  p = simde_mm512_fmadd_ps(p, f, simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.1676998740e-1)));
+  p = simde_mm512_fmadd_ps(p, f, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-1.2420140846e-1)));
+  p = simde_mm512_fmadd_ps(p, f, simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.4249322787e-1)));
+  p = simde_mm512_fmadd_ps(p, f, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-1.6668057665e-1)));
+  p = simde_mm512_fmadd_ps(p, f, simde_mm512_set1_ps(SIMDE_FLOAT32_C(2.0000714765e-1)));
+  p = simde_mm512_fmadd_ps(p, f, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-2.4999993993e-1)));
+  p = simde_mm512_fmadd_ps(p, f, simde_mm512_set1_ps(SIMDE_FLOAT32_C(3.3333331174e-1)));
+  p = simde_mm512_mul_ps(simde_mm512_mul_ps(p, f), z);
+  p = simde_mm512_fmadd_ps(e, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-2.12194440e-4)), p);
+  p = simde_mm512_fnmadd_ps(simde_mm512_set1_ps(SIMDE_FLOAT32_C(0.5)), z, p);
+  p = simde_mm512_add_ps(f, p);
+  p = simde_mm512_fmadd_ps(e, simde_mm512_set1_ps(SIMDE_FLOAT32_C(0.693359375)), p);
+
+  /* log(x < 0) = NaN, log(0) = -inf, log(inf) = inf, log(NaN) = NaN */
+  p = simde_mm512_mask_mov_ps(p, simde_mm512_cmp_ps_mask(a, simde_mm512_setzero_ps(), SIMDE_CMP_LT_OQ), simde_mm512_set1_ps(SIMDE_MATH_NANF));
+  p = simde_mm512_mask_mov_ps(p, simde_mm512_cmp_ps_mask(a, simde_mm512_setzero_ps(), SIMDE_CMP_EQ_OQ), simde_mm512_set1_ps(-SIMDE_MATH_INFINITYF));
+  return simde_mm512_mask_mov_ps(p, simde_mm512_cmp_ps_mask(a, simde_mm512_set1_ps(SIMDE_MATH_INFINITYF), SIMDE_CMP_NLT_UQ), a);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_x_mm512_log_pd_poly_ (simde__m512d a) {
+  /* fdlibm's log: a = m * 2^k with m in (sqrt(0.5), sqrt(2)], f = m - 1,
+   * and log(1 + f) = f - s * (f - R(z)) with s = f / (2 + f), z = s^2. */
+  const simde__m512d one = simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.0));
+  simde__mmask8 tiny, gt;
+  simde__m512d x, k, m, f, s, z, w, t1, t2, hfsq, p;
+  simde__m512i bits;
+
+  /* Scale subnormals into the normal range. */
+  tiny = simde_mm512_cmp_pd_mask(a, simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.2250738585072013830902e-308)), SIMDE_CMP_LT_OQ);
+  x = simde_mm512_mask_mov_pd(a, tiny, simde_mm512_mul_pd(a, simde_mm512_set1_pd(SIMDE_FLOAT64_C(18014398509481984.0))));
+  bits = simde_mm512_castpd_si512(x);
+
+  /* OR'ing the exponent field into the mantissa of 2^52 gives us a double
+   * without an int -> double conversion. */
+  k = simde_mm512_sub_pd(simde_mm512_castsi512_pd(simde_mm512_or_si512(simde_mm512_srli_epi64(bits, 52), simde_mm512_castpd_si512(simde_mm512_set1_pd(SIMDE_FLOAT64_C(4503599627370496.0))))), simde_mm512_set1_pd(SIMDE_FLOAT64_C(4503599627371519.0)));
+  k = simde_mm512_sub_pd(k, simde_mm512_maskz_mov_pd(tiny, simde_mm512_set1_pd(SIMDE_FLOAT64_C(54.0))));
+  m = simde_mm512_castsi512_pd(simde_mm512_or_si512(simde_mm512_and_si512(bits, simde_mm512_set1_epi64(INT64_C(0x000fffffffffffff))), simde_mm512_set1_epi64(INT64_C(0x3ff0000000000000))));
+
+  gt = simde_mm512_cmp_pd_mask(m, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.41421356237309504880)), SIMDE_CMP_GT_OQ);
+  m = simde_mm512_mask_mov_pd(m, gt, simde_mm512_mul_pd(m, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.5))));
+  k = simde_mm512_add_pd(k, simde_mm512_maskz_mov_pd(gt, one));
+
+  f = simde_mm512_sub_pd(m, one);
+  s = simde_mm512_div_pd(f, simde_mm512_add_pd(simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.0)), f));
+  z = simde_mm512_mul_pd(s, s);
+  w = simde_mm512_mul_pd(z, z);
+  t1 = simde_mm512_fmadd_pd(simde_mm512_fmadd_pd(simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.479819860511658591e-01)), w, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.818357216161805012e-01))), w, simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.857142874366239149e-01)));
+  t1 = simde_mm512_mul_pd(z, simde_mm512_fmadd_pd(t1, w, simde_mm512_set1_pd(SIMDE_FLOAT64_C(6.666666666666735130e-01))));
+  t2 = simde_mm512_fmadd_pd(simde_mm512_fmadd_pd(simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.531383769920937332e-01)), w, simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.222219843214978396e-01))), w, simde_mm512_set1_pd(SIMDE_FLOAT64_C(3.999999999940941908e-01)));
+  t2 = simde_mm512_mul_pd(w, t2);
+  hfsq = simde_mm512_mul_pd(simde_mm512_mul_pd(simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.5)), f), f);
+
+  /* k * ln2_hi - ((hfsq - (s * (hfsq + R) + k * ln2_lo)) - f) */
+  p = simde_mm512_fmadd_pd(s, simde_mm512_add_pd(hfsq, simde_mm512_add_pd(t1, t2)), simde_mm512_mul_pd(k, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.90821492927058770002e-10))));
+  p = simde_mm512_sub_pd(simde_mm512_sub_pd(hfsq, p), f);
+  p = simde_mm512_fmsub_pd(k, simde_mm512_set1_pd(SIMDE_FLOAT64_C(6.93147180369123816490e-01)), p);
+
+  /* log(x < 0) = NaN, log(0) = -inf, log(inf) = inf, log(NaN) = NaN */
+  p = simde_mm512_mask_mov_pd(p, simde_mm512_cmp_pd_mask(a, simde_mm512_setzero_pd(), SIMDE_CMP_LT_OQ), simde_mm512_set1_pd(SIMDE_MATH_NAN));
+  p = simde_mm512_mask_mov_pd(p, simde_mm512_cmp_pd_mask(a, simde_mm512_setzero_pd(), SIMDE_CMP_EQ_OQ), simde_mm512_set1_pd(-SIMDE_MATH_INFINITY));
+  return simde_mm512_mask_mov_pd(p, simde_mm512_cmp_pd_mask(a, simde_mm512_set1_pd(SIMDE_MATH_INFINITY), SIMDE_CMP_NLT_UQ), a);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_x_mm_sincostan_ps_poly_ (simde__m128 a, int op) {
+  /* |a| = q * pi/2 + r with r in [-pi/4, pi/4]; the low two bits of q then
+   * pick between the sin and cos polynomials and the sign of the result. */
+  const simde__m128 magic = simde_mm_set1_ps(SIMDE_FLOAT32_C(12582912.0));
+  const simde__m128 one = simde_mm_set1_ps(SIMDE_FLOAT32_C(1.0));
+  simde__m128 x, t, q, r, z, s, c, sign;
+  simde__m128i qi;
+
+  x = simde_x_mm_abs_ps(a);
+  sign = simde_mm_xor_ps(a, x);
+  t = simde_mm_fmadd_ps(x, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.63661977236758134308)), magic);
+  qi = simde_mm_castps_si128(t);
+  q = simde_mm_sub_ps(t, magic);
+  r = simde_mm_fnmadd_ps(q, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.5703125)), x);
+  r = simde_mm_fnmadd_ps(q, simde_mm_set1_ps(SIMDE_FLOAT32_C(4.837512969970703125e-4)), r);
+  r = simde_mm_fnmadd_ps(q, simde_mm_set1_ps(SIMDE_FLOAT32_C(7.54953362047672271728515625e-8)), r);
+  r = simde_mm_fnmadd_ps(q, simde_mm_set1_ps(SIMDE_FLOAT32_C(2.563344151594519e-12)), r);
+  z = simde_mm_mul_ps(r, r);
+
+  /* Cephes' sinf and cosf polynomials */
+  s = simde_mm_fmadd_ps(simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.9515295891e-4)), z, simde_mm_set1_ps(SIMDE_FLOAT32_C(8.3321608736e-3)));
+  s = simde_mm_fmadd_ps(s, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.6666654611e-1)));
+  s = simde_mm_fmadd_ps(simde_mm_mul_ps(s, z), r, r);
+  c = simde_mm_fmadd_ps(simde_mm_set1_ps(SIMDE_FLOAT32_C(2.443315711809948e-5)), z, simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.388731625493765e-3)));
+  c = simde_mm_fmadd_ps(c, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(4.166664568298827e-2)));
+  c = simde_mm_mul_ps(simde_mm_mul_ps(c, z), z);
+  c = simde_mm_add_ps(simde_mm_fnmadd_ps(simde_mm_set1_ps(SIMDE_FLOAT32_C(0.5)), z, c), one);
+
+  if (op == SIMDE_X86_SVML_TAN_) {
+    r = simde_mm_div_ps(simde_mm_blendv_ps(s, c, simde_mm_castsi128_ps(simde_mm_slli_epi32(qi, 31))), simde_mm_blendv_ps(c, s, simde_mm_castsi128_ps(simde_mm_slli_epi32(qi, 31))));
+    sign = simde_mm_xor_ps(sign, simde_mm_castsi128_ps(simde_mm_slli_epi32(qi, 31)));
+  } else {
+    if (op == SIMDE_X86_SVML_COS_) {
+      qi = simde_mm_add_epi32(qi, simde_mm_set1_epi32(INT32_C(1)));
+      sign = simde_mm_setzero_ps();
+    }
+    r = simde_mm_blendv_ps(s, c, simde_mm_castsi128_ps(simde_mm_slli_epi32(qi, 31)));
+    sign = simde_mm_xor_ps(sign, simde_mm_and_ps(simde_mm_castsi128_ps(simde_mm_slli_epi32(qi, 30)), simde_mm_set1_ps(SIMDE_FLOAT32_C(-0.0))));
+  }
+  r = simde_mm_xor_ps(r, sign);
+
+  /* Large arguments would need a more careful reduction; they're rare
+   * enough that handing those lanes over to libm is fine. */
+  if (HEDLEY_UNLIKELY((simde_mm_movemask_ps(simde_mm_cmp_ps(x, simde_mm_set1_ps(SIMDE_FLOAT32_C(8192.0)), SIMDE_CMP_GT_OQ)) != 0))) {
+    simde__m128_private
+      r_ = simde__m128_to_private(r),
+      a_ = simde__m128_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+      if (!(simde_math_fabsf(a_.f32[i]) > SIMDE_FLOAT32_C(8192.0)))
+        continue;
+
+      switch (op) {
+        case SIMDE_X86_SVML_SIN_: r_.f32[i] = simde_math_sinf(a_.f32[i]); break;
+        case SIMDE_X86_SVML_COS_: r_.f32[i] = simde_math_cosf(a_.f32[i]); break;
+        default:                  r_.f32[i] = simde_math_tanf(a_.f32[i]); break;
+      }
+    }
+
+    r = simde__m128_from_private(r_);
+  }
+
+  return r;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_x_mm_sincostan_pd_poly_ (simde__m128d a, int op) {
+  /* |a| = q * pi/2 + r with r in [-pi/4, pi/4]; the low two bits of q then
+   * pick between the sin and cos polynomials and the sign of the result. */
+  const simde__m128d magic = simde_mm_set1_pd(SIMDE_FLOAT64_C(6755399441055744.0));
+  const simde__m128d one = simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0));
+  simde__m128d x, t, q, r, z, s, c, h, sign;
+  simde__m128i qi;
+
+  x = simde_x_mm_abs_pd(a);
+  sign = simde_mm_xor_pd(a, x);
+  t = simde_mm_fmadd_pd(x, simde_mm_set1_pd(SIMDE_FLOAT64_C(6.36619772367581382433e-01)), magic);
+  qi = simde_mm_castpd_si128(t);
+  q = simde_mm_sub_pd(t, magic);
+  r = simde_mm_fnmadd_pd(q, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.57079632673412561417e+00)), x);
+  r = simde_mm_fnmadd_pd(q, simde_mm_set1_pd(SIMDE_FLOAT64_C(6.07710050630396597660e-11)), r);
+  r = simde_mm_sub_pd(r, simde_mm_fmadd_pd(q, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.02226624871116645580e-21)), simde_mm_mul_pd(q, simde_mm_set1_pd(SIMDE_FLOAT64_C(8.47842766036889956997e-32)))));
+  z = simde_mm_mul_pd(r, r);
+
+  /* fdlibm's __kernel_sin and __kernel_cos polynomials */
+  s = simde_mm_set1_pd(SIMDE_FLOAT64_C(1.58969099521155010221e-10));
+  s = simde_mm_fmadd_pd(s, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-2.50507602534068634195e-08)));
+  s = simde_mm_fmadd_pd(s, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.75573137070700676789e-06)));
+  s = simde_mm_fmadd_pd(s, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.98412698298579493134e-04)));
+  s = simde_mm_fmadd_pd(s, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(8.33333333332248946124e-03)));
+  s = simde_mm_fmadd_pd(s, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.66666666666666324348e-01)));
+  s = simde_mm_fmadd_pd(simde_mm_mul_pd(s, z), r, r);
+  c = simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.13596475577881948265e-11));
+  c = simde_mm_fmadd_pd(c, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.08757232129817482790e-09)));
+  c = simde_mm_fmadd_pd(c, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-2.75573143513906633035e-07)));
+  c = simde_mm_fmadd_pd(c, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.48015872894767294178e-05)));
+  c = simde_mm_fmadd_pd(c, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.38888888888741095749e-03)));
+  c = simde_mm_fmadd_pd(c, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(4.16666666666666019037e-02)));
+  c = simde_mm_mul_pd(simde_mm_mul_pd(z, z), c);
+  h = simde_mm_mul_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(0.5)), z);
+  t = simde_mm_sub_pd(one, h);
+  c = simde_mm_add_pd(t, simde_mm_add_pd(simde_mm_sub_pd(simde_mm_sub_pd(one, t), h), c));
+
+  if (op == SIMDE_X86_SVML_TAN_) {
+    r = simde_mm_div_pd(simde_mm_blendv_pd(s, c, simde_mm_castsi128_pd(simde_mm_slli_epi64(qi, 63))), simde_mm_blendv_pd(c, s, simde_mm_castsi128_pd(simde_mm_slli_epi64(qi, 63))));
+    sign = simde_mm_xor_pd(sign, simde_mm_castsi128_pd(simde_mm_slli_epi64(qi, 63)));
+  } else {
+    if (op == SIMDE_X86_SVML_COS_) {
+      qi = simde_mm_add_epi64(qi, simde_mm_set1_epi64x(INT64_C(1)));
+      sign = simde_mm_setzero_pd();
+    }
+    r = simde_mm_blendv_pd(s, c, simde_mm_castsi128_pd(simde_mm_slli_epi64(qi, 63)));
+    sign = simde_mm_xor_pd(sign, simde_mm_and_pd(simde_mm_castsi128_pd(simde_mm_slli_epi64(qi, 62)), simde_mm_set1_pd(SIMDE_FLOAT64_C(-0.0))));
+  }
+  r = simde_mm_xor_pd(r, sign);
+
+  /* Large arguments would need a more careful reduction; they're rare
+   * enough that handing those lanes over to libm is fine. */
+  if (HEDLEY_UNLIKELY((simde_mm_movemask_pd(simde_mm_cmp_pd(x, simde_mm_set1_pd(SIMDE_FLOAT64_C(1048576.0)), SIMDE_CMP_GT_OQ)) != 0))) {
+    simde__m128d_private
+      r_ = simde__m128d_to_private(r),
+      a_ = simde__m128d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+      if (!(simde_math_fabs(a_.f64[i]) > SIMDE_FLOAT64_C(1048576.0)))
+        continue;
+
+      switch (op) {
+        case SIMDE_X86_SVML_SIN_: r_.f64[i] = simde_math_sin(a_.f64[i]); break;
+        case SIMDE_X86_SVML_COS_: r_.f64[i] = simde_math_cos(a_.f64[i]); break;
+        default:                  r_.f64[i] = simde_math_tan(a_.f64[i]); break;
+      }
+    }
+
+    r = simde__m128d_from_private(r_);
+  }
+
+  return r;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_x_mm256_sincostan_ps_poly_ (simde__m256 a, int op) {
+  /* |a| = q * pi/2 + r with r in [-pi/4, pi/4]; the low two bits of q then
+   * pick between the sin and cos polynomials and the sign of the result. */
+  const simde__m256 magic = simde_mm256_set1_ps(SIMDE_FLOAT32_C(12582912.0));
+  const simde__m256 one = simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.0));
+  simde__m256 x, t, q, r, z, s, c, sign;
+  simde__m256i qi;
+
+  x = simde_x_mm256_abs_ps(a);
+  sign = simde_mm256_xor_ps(a, x);
+  t = simde_mm256_fmadd_ps(x, simde_mm256_set1_ps(SIMDE_FLOAT32_C(0.63661977236758134308)), magic);
+  qi = simde_mm256_castps_si256(t);
+  q = simde_mm256_sub_ps(t, magic);
+  r = simde_mm256_fnmadd_ps(q, simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.5703125)), x);
+  r = simde_mm256_fnmadd_ps(q, simde_mm256_set1_ps(SIMDE_FLOAT32_C(4.837512969970703125e-4)), r);
+  r = simde_mm256_fnmadd_ps(q, simde_mm256_set1_ps(SIMDE_FLOAT32_C(7.54953362047672271728515625e-8)), r);
+  r = simde_mm256_fnmadd_ps(q, simde_mm256_set1_ps(SIMDE_FLOAT32_C(2.563344151594519e-12)), r);
+  z = simde_mm256_mul_ps(r, r);
+
+  /* Cephes' sinf and cosf polynomials */
+  s = simde_mm256_fmadd_ps(simde_mm256_set1_ps(SIMDE_FLOAT32_C(-1.9515295891e-4)), z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(8.3321608736e-3)));
+  s = simde_mm256_fmadd_ps(s, z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-1.6666654611e-1)));
+  s = simde_mm256_fmadd_ps(simde_mm256_mul_ps(s, z), r, r);
+  c = simde_mm256_fmadd_ps(simde_mm256_set1_ps(SIMDE_FLOAT32_C(2.443315711809948e-5)), z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-1.388731625493765e-3)));
+  c = simde_mm256_fmadd_ps(c, z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(4.166664568298827e-2)));
+  c = simde_mm256_mul_ps(simde_mm256_mul_ps(c, z), z);
+  c = simde_mm256_add_ps(simde_mm256_fnmadd_ps(simde_mm256_set1_ps(SIMDE_FLOAT32_C(0.5)), z, c), one);
+
+  if (op == SIMDE_X86_SVML_TAN_) {
+    r = simde_mm256_div_ps(simde_mm256_blendv_ps(s, c, simde_mm256_castsi256_ps(simde_mm256_slli_epi32(qi, 31))), simde_mm256_blendv_ps(c, s, simde_mm256_castsi256_ps(simde_mm256_slli_epi32(qi, 31))));
+    sign = simde_mm256_xor_ps(sign, simde_mm256_castsi256_ps(simde_mm256_slli_epi32(qi, 31)));
+  } else {
+    if (op == SIMDE_X86_SVML_COS_) {
+      qi = simde_mm256_add_epi32(qi, simde_mm256_set1_epi32(INT32_C(1)));
+      sign = simde_mm256_setzero_ps();
+    }
+    r = simde_mm256_blendv_ps(s, c, simde_mm256_castsi256_ps(simde_mm256_slli_epi32(qi, 31)));
+    sign = simde_mm256_xor_ps(sign, simde_mm256_and_ps(simde_mm256_castsi256_ps(simde_mm256_slli_epi32(qi, 30)), simde_mm256_set1_ps(SIMDE_FLOAT32_C(-0.0))));
+  }
+  r = simde_mm256_xor_ps(r, sign);
+
+  /* Large arguments would need a more careful reduction; they're rare
+   * enough that handing those lanes over to libm is fine. */
+  if (HEDLEY_UNLIKELY((simde_mm256_movemask_ps(simde_mm256_cmp_ps(x, simde_mm256_set1_ps(SIMDE_FLOAT32_C(8192.0)), SIMDE_CMP_GT_OQ)) != 0))) {
+    simde__m256_private
+      r_ = simde__m256_to_private(r),
+      a_ = simde__m256_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+      if (!(simde_math_fabsf(a_.f32[i]) > SIMDE_FLOAT32_C(8192.0)))
+        continue;
+
+      switch (op) {
+        case SIMDE_X86_SVML_SIN_: r_.f32[i] = simde_math_sinf(a_.f32[i]); break;
+        case SIMDE_X86_SVML_COS_: r_.f32[i] = simde_math_cosf(a_.f32[i]); break;
+        default:                  r_.f32[i] = simde_math_tanf(a_.f32[i]); break;
+      }
+    }
+
+    r = simde__m256_from_private(r_);
+  }
+
+  return r;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256d
+simde_x_mm256_sincostan_pd_poly_ (simde__m256d a, int op) {
+  /* |a| = q * pi/2 + r with r in [-pi/4, pi/4]; the low two bits of q then
+   * pick between the sin and cos polynomials and the sign of the result. */
+  const simde__m256d magic = simde_mm256_set1_pd(SIMDE_FLOAT64_C(6755399441055744.0));
+  const simde__m256d one = simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.0));
+  simde__m256d x, t, q, r, z, s, c, h, sign;
+  simde__m256i qi;
+
+  x = simde_x_mm256_abs_pd(a);
+  sign = simde_mm256_xor_pd(a, x);
+  t = simde_mm256_fmadd_pd(x, simde_mm256_set1_pd(SIMDE_FLOAT64_C(6.36619772367581382433e-01)), magic);
+  qi = simde_mm256_castpd_si256(t);
+  q = simde_mm256_sub_pd(t, magic);
+  r = simde_mm256_fnmadd_pd(q, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.57079632673412561417e+00)), x);
+  r = simde_mm256_fnmadd_pd(q, simde_mm256_set1_pd(SIMDE_FLOAT64_C(6.07710050630396597660e-11)), r);
+  r = simde_mm256_sub_pd(r, simde_mm256_fmadd_pd(q, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.02226624871116645580e-21)), simde_mm256_mul_pd(q, simde_mm256_set1_pd(SIMDE_FLOAT64_C(8.47842766036889956997e-32)))));
+  z = simde_mm256_mul_pd(r, r);
+
+  /* fdlibm's __kernel_sin and __kernel_cos polynomials */
+  s = simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.58969099521155010221e-10));
+  s = simde_mm256_fmadd_pd(s, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-2.50507602534068634195e-08)));
+  s = simde_mm256_fmadd_pd(s, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.75573137070700676789e-06)));
+  s = simde_mm256_fmadd_pd(s, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-1.98412698298579493134e-04)));
+  s = simde_mm256_fmadd_pd(s, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(8.33333333332248946124e-03)));
+  s = simde_mm256_fmadd_pd(s, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-1.66666666666666324348e-01)));
+  s = simde_mm256_fmadd_pd(simde_mm256_mul_pd(s, z), r, r);
+  c = simde_mm256_set1_pd(SIMDE_FLOAT64_C(-1.13596475577881948265e-11));
+  c = simde_mm256_fmadd_pd(c, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.08757232129817482790e-09)));
+  c = simde_mm256_fmadd_pd(c, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-2.75573143513906633035e-07)));
+  c = simde_mm256_fmadd_pd(c, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.48015872894767294178e-05)));
+  c = simde_mm256_fmadd_pd(c, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-1.38888888888741095749e-03)));
+  c = simde_mm256_fmadd_pd(c, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(4.16666666666666019037e-02)));
+  c = simde_mm256_mul_pd(simde_mm256_mul_pd(z, z), c);
+  h = simde_mm256_mul_pd(simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.5)), z);
+  t = simde_mm256_sub_pd(one, h);
+  c = simde_mm256_add_pd(t, simde_mm256_add_pd(simde_mm256_sub_pd(simde_mm256_sub_pd(one, t), h), c));
+
+  if (op == SIMDE_X86_SVML_TAN_) {
+    r = simde_mm256_div_pd(simde_mm256_blendv_pd(s, c, simde_mm256_castsi256_pd(simde_mm256_slli_epi64(qi, 63))), simde_mm256_blendv_pd(c, s, simde_mm256_castsi256_pd(simde_mm256_slli_epi64(qi, 63))));
+    sign = simde_mm256_xor_pd(sign, simde_mm256_castsi256_pd(simde_mm256_slli_epi64(qi, 63)));
+  } else {
+    if (op == SIMDE_X86_SVML_COS_) {
+      qi = simde_mm256_add_epi64(qi, simde_mm256_set1_epi64x(INT64_C(1)));
+      sign = simde_mm256_setzero_pd();
+    }
+    r = simde_mm256_blendv_pd(s, c, simde_mm256_castsi256_pd(simde_mm256_slli_epi64(qi, 63)));
+    sign = simde_mm256_xor_pd(sign, simde_mm256_and_pd(simde_mm256_castsi256_pd(simde_mm256_slli_epi64(qi, 62)), simde_mm256_set1_pd(SIMDE_FLOAT64_C(-0.0))));
+  }
+  r = simde_mm256_xor_pd(r, sign);
+
+  /* Large arguments would need a more careful reduction; they're rare
+   * enough that handing those lanes over to libm is fine. */
+  if (HEDLEY_UNLIKELY((simde_mm256_movemask_pd(simde_mm256_cmp_pd(x, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1048576.0)), SIMDE_CMP_GT_OQ)) != 0))) {
+    simde__m256d_private
+      r_ = simde__m256d_to_private(r),
+      a_ = simde__m256d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+      if (!(simde_math_fabs(a_.f64[i]) > SIMDE_FLOAT64_C(1048576.0)))
+        continue;
+
+      switch (op) {
+        case SIMDE_X86_SVML_SIN_: r_.f64[i] = simde_math_sin(a_.f64[i]); break;
+        case SIMDE_X86_SVML_COS_: r_.f64[i] = simde_math_cos(a_.f64[i]); break;
+        default:                  r_.f64[i] = simde_math_tan(a_.f64[i]); break;
+      }
+    }
+
+    r = simde__m256d_from_private(r_);
+  }
+
+  return r;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_x_mm512_sincostan_ps_poly_ (simde__m512 a, int op) {
+  /* |a| = q * pi/2 + r with r in [-pi/4, pi/4]; the low two bits of q then
+   * pick between the sin and cos polynomials and the sign of the result. */
+  const simde__m512 magic = simde_mm512_set1_ps(SIMDE_FLOAT32_C(12582912.0));
+  const simde__m512 one = simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.0));
+  simde__m512 x, t, q, r, z, s, c, sign;
+  simde__m512i qi;
+
+  x = simde_mm512_abs_ps(a);
+  sign = simde_mm512_xor_ps(a, x);
+  t = simde_mm512_fmadd_ps(x, simde_mm512_set1_ps(SIMDE_FLOAT32_C(0.63661977236758134308)), magic);
+  qi = simde_mm512_castps_si512(t);
+  q = simde_mm512_sub_ps(t, magic);
+  r = simde_mm512_fnmadd_ps(q, simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.5703125)), x);
+  r = simde_mm512_fnmadd_ps(q, simde_mm512_set1_ps(SIMDE_FLOAT32_C(4.837512969970703125e-4)), r);
+  r = simde_mm512_fnmadd_ps(q, simde_mm512_set1_ps(SIMDE_FLOAT32_C(7.54953362047672271728515625e-8)), r);
+  r = simde_mm512_fnmadd_ps(q, simde_mm512_set1_ps(SIMDE_FLOAT32_C(2.563344151594519e-12)), r);
+  z = simde_mm512_mul_ps(r, r);
+
+  /* Cephes' sinf and cosf polynomials */
+  s = simde_mm512_fmadd_ps(simde_mm512_set1_ps(SIMDE_FLOAT32_C(-1.9515295891e-4)), z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(8.3321608736e-3)));
+  s = simde_mm512_fmadd_ps(s, z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-1.6666654611e-1)));
+  s = simde_mm512_fmadd_ps(simde_mm512_mul_ps(s, z), r, r);
+  c = simde_mm512_fmadd_ps(simde_mm512_set1_ps(SIMDE_FLOAT32_C(2.443315711809948e-5)), z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-1.388731625493765e-3)));
+  c = simde_mm512_fmadd_ps(c, z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(4.166664568298827e-2)));
+  c = simde_mm512_mul_ps(simde_mm512_mul_ps(c, z), z);
+  c = simde_mm512_add_ps(simde_mm512_fnmadd_ps(simde_mm512_set1_ps(SIMDE_FLOAT32_C(0.5)), z, c), one);
+
+  if (op == SIMDE_X86_SVML_TAN_) {
+    r = simde_mm512_div_ps(simde_mm512_mask_mov_ps(s, simde_mm512_test_epi32_mask(qi, simde_mm512_set1_epi32(INT32_C(1))), c), simde_mm512_mask_mov_ps(c, simde_mm512_test_epi32_mask(qi, simde_mm512_set1_epi32(INT32_C(1))), s));
+    sign = simde_mm512_xor_ps(sign, simde_mm512_castsi512_ps(simde_mm512_slli_epi32(qi, 31)));
+  } else {
+    if (op == SIMDE_X86_SVML_COS_) {
+      qi = simde_mm512_add_epi32(qi, simde_mm512_set1_epi32(INT32_C(1)));
+      sign = simde_mm512_setzero_ps();
+    }
+    r = simde_mm512_mask_mov_ps(s, simde_mm512_test_epi32_mask(qi, simde_mm512_set1_epi32(INT32_C(1))), c);
+    sign = simde_mm512_xor_ps(sign, simde_mm512_and_ps(simde_mm512_castsi512_ps(simde_mm512_slli_epi32(qi, 30)), simde_mm512_set1_ps(SIMDE_FLOAT32_C(-0.0))));
+  }
+  r = simde_mm512_xor_ps(r, sign);
+
+  /* Large arguments would need a more careful reduction; they're rare
+   * enough that handing those lanes over to libm is fine. */
+  if (HEDLEY_UNLIKELY((simde_mm512_cmp_ps_mask(x, simde_mm512_set1_ps(SIMDE_FLOAT32_C(8192.0)), SIMDE_CMP_GT_OQ) != 0))) {
+    simde__m512_private
+      r_ = simde__m512_to_private(r),
+      a_ = simde__m512_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+      if (!(simde_math_fabsf(a_.f32[i]) > SIMDE_FLOAT32_C(8192.0)))
+        continue;
+
+      switch (op) {
+        case SIMDE_X86_SVML_SIN_: r_.f32[i] = simde_math_sinf(a_.f32[i]); break;
+        case SIMDE_X86_SVML_COS_: r_.f32[i] = simde_math_cosf(a_.f32[i]); break;
+        default:                  r_.f32[i] = simde_math_tanf(a_.f32[i]); break;
+      }
+    }
+
+    r = simde__m512_from_private(r_);
+  }
+
+  return r;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_x_mm512_sincostan_pd_poly_ (simde__m512d a, int op) {
+  /* |a| = q * pi/2 + r with r in [-pi/4, pi/4]; the low two bits of q then
+   * pick between the sin and cos polynomials and the sign of the result. */
+  const simde__m512d magic = simde_mm512_set1_pd(SIMDE_FLOAT64_C(6755399441055744.0));
+  const simde__m512d one = simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.0));
+  simde__m512d x, t, q, r, z, s, c, h, sign;
+  simde__m512i qi;
+
+  x = simde_mm512_abs_pd(a);
+  sign = simde_mm512_xor_pd(a, x);
+  t = simde_mm512_fmadd_pd(x, simde_mm512_set1_pd(SIMDE_FLOAT64_C(6.36619772367581382433e-01)), magic);
+  qi = simde_mm512_castpd_si512(t);
+  q = simde_mm512_sub_pd(t, magic);
+  r = simde_mm512_fnmadd_pd(q, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.57079632673412561417e+00)), x);
+  r = simde_mm512_fnmadd_pd(q, simde_mm512_set1_pd(SIMDE_FLOAT64_C(6.07710050630396597660e-11)), r);
+  r = simde_mm512_sub_pd(r, simde_mm512_fmadd_pd(q, simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.02226624871116645580e-21)), simde_mm512_mul_pd(q, simde_mm512_set1_pd(SIMDE_FLOAT64_C(8.47842766036889956997e-32)))));
+  z = simde_mm512_mul_pd(r, r);
+
+  /* fdlibm's __kernel_sin and __kernel_cos polynomials */
+  s = simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.58969099521155010221e-10));
+  s = simde_mm512_fmadd_pd(s, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-2.50507602534068634195e-08)));
+  s = simde_mm512_fmadd_pd(s, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.75573137070700676789e-06)));
+  s = simde_mm512_fmadd_pd(s, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-1.98412698298579493134e-04)));
+  s = simde_mm512_fmadd_pd(s, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(8.33333333332248946124e-03)));
+  s = simde_mm512_fmadd_pd(s, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-1.66666666666666324348e-01)));
+  s = simde_mm512_fmadd_pd(simde_mm512_mul_pd(s, z), r, r);
+  c = simde_mm512_set1_pd(SIMDE_FLOAT64_C(-1.13596475577881948265e-11));
+  c = simde_mm512_fmadd_pd(c, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.08757232129817482790e-09)));
+  c = simde_mm512_fmadd_pd(c, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-2.75573143513906633035e-07)));
+  c = simde_mm512_fmadd_pd(c, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.48015872894767294178e-05)));
+  c = simde_mm512_fmadd_pd(c, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-1.38888888888741095749e-03)));
+  c = simde_mm512_fmadd_pd(c, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(4.16666666666666019037e-02)));
+  c = simde_mm512_mul_pd(simde_mm512_mul_pd(z, z), c);
+  h = simde_mm512_mul_pd(simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.5)), z);
+  t = simde_mm512_sub_pd(one, h);
+  c = simde_mm512_add_pd(t, simde_mm512_add_pd(simde_mm512_sub_pd(simde_mm512_sub_pd(one, t), h), c));
+
+  if (op == SIMDE_X86_SVML_TAN_) {
+    r = simde_mm512_div_pd(simde_mm512_mask_mov_pd(s, simde_mm512_test_epi64_mask(qi, simde_mm512_set1_epi64(INT64_C(1))), c), simde_mm512_mask_mov_pd(c, simde_mm512_test_epi64_mask(qi, simde_mm512_set1_epi64(INT64_C(1))), s));
+    sign = simde_mm512_xor_pd(sign, simde_mm512_castsi512_pd(simde_mm512_slli_epi64(qi, 63)));
+  } else {
+    if (op == SIMDE_X86_SVML_COS_) {
+      qi = simde_mm512_add_epi64(qi, simde_mm512_set1_epi64(INT64_C(1)));
+      sign = simde_mm512_setzero_pd();
+    }
+    r = simde_mm512_mask_mov_pd(s, simde_mm512_test_epi64_mask(qi, simde_mm512_set1_epi64(INT64_C(1))), c);
+    sign = simde_mm512_xor_pd(sign, simde_mm512_and_pd(simde_mm512_castsi512_pd(simde_mm512_slli_epi64(qi, 62)), simde_mm512_set1_pd(SIMDE_FLOAT64_C(-0.0))));
+  }
+  r = simde_mm512_xor_pd(r, sign);
+
+  /* Large arguments would need a more careful reduction; they're rare
+   * enough that handing those lanes over to libm is fine. */
+  if (HEDLEY_UNLIKELY((simde_mm512_cmp_pd_mask(x, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1048576.0)), SIMDE_CMP_GT_OQ) != 0))) {
+    simde__m512d_private
+      r_ = simde__m512d_to_private(r),
+      a_ = simde__m512d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+      if (!(simde_math_fabs(a_.f64[i]) > SIMDE_FLOAT64_C(1048576.0)))
+        continue;
+
+      switch (op) {
+        case SIMDE_X86_SVML_SIN_: r_.f64[i] = simde_math_sin(a_.f64[i]); break;
+        case SIMDE_X86_SVML_COS_: r_.f64[i] = simde_math_cos(a_.f64[i]); break;
+        default:                  r_.f64[i] = simde_math_tan(a_.f64[i]); break;
+      }
+    }
+
+    r = simde__m512d_from_private(r_);
+  }
+
+  return r;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_x_mm_cbrt_ps_poly_ (simde__m128 a) {
+  /* |a| = m * 2^(3q + rem) with m in [1, 2) and rem in {0, 1, 2}.  A
+   * quadratic estimate of cbrt(m) * cbrt(2^rem) is refined using Halley's
+   * method, y += y * (x - y^3) / (2y^3 + x) with x = m * 2^rem, and then
+   * scaled by 2^q. */
+  const simde__m128 magic = simde_mm_set1_ps(SIMDE_FLOAT32_C(12582912.0));
+  const simde__m128 one = simde_mm_set1_ps(SIMDE_FLOAT32_C(1.0));
+  simde__m128 tiny, lt, eq1;
+  simde__m128 x, e, m, q, rem, y, t;
+  simde__m128i bits;
+
+  x = simde_x_mm_abs_ps(a);
+  tiny = simde_mm_cmp_ps(x, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.17549435082228750797e-38)), SIMDE_CMP_LT_OQ);
+  x = simde_mm_blendv_ps(x, simde_mm_mul_ps(x, simde_mm_set1_ps(SIMDE_FLOAT32_C(16777216.0))), tiny);
+  bits = simde_mm_castps_si128(x);
+  e = simde_mm_sub_ps(simde_mm_castsi128_ps(simde_mm_or_si128(simde_mm_srli_epi32(bits, 23), simde_mm_castps_si128(simde_mm_set1_ps(SIMDE_FLOAT32_C(8388608.0))))), simde_mm_set1_ps(SIMDE_FLOAT32_C(8388735.0)));
+  m = simde_mm_castsi128_ps(simde_mm_or_si128(simde_mm_and_si128(bits, simde_mm_set1_epi32(INT32_C(0x007fffff))), simde_mm_set1_epi32(INT32_C(0x3f800000))));
+
+  q = simde_mm_sub_ps(simde_mm_fmadd_ps(simde_mm_sub_ps(e, one), simde_mm_set1_ps(SIMDE_FLOAT32_C(0.33333333333333333333)), magic), magic);
+  rem = simde_mm_fnmadd_ps(q, simde_mm_set1_ps(SIMDE_FLOAT32_C(3.0)), e);
+  lt = simde_mm_cmp_ps(rem, simde_mm_set1_ps(SIMDE_FLOAT32_C(2.0)), SIMDE_CMP_LT_OQ);
+  eq1 = simde_mm_cmp_ps(rem, one, SIMDE_CMP_EQ_OQ);
+  x = simde_mm_mul_ps(m, simde_mm_blendv_ps(simde_mm_set1_ps(SIMDE_FLOAT32_C(4.0)), simde_mm_blendv_ps(one, simde_mm_set1_ps(SIMDE_FLOAT32_C(2.0)), eq1), lt));
+
+  y = simde_mm_fmadd_ps(simde_mm_fmadd_ps(simde_mm_set1_ps(SIMDE_FLOAT32_C(-0.06031935419416206)), m, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.43944172333635173))), m, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.62151366597110536)));
+  y = simde_mm_mul_ps(y, simde_mm_blendv_ps(simde_mm_set1_ps(SIMDE_FLOAT32_C(1.5874010519681994748)), simde_mm_blendv_ps(one, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.2599210498948731648)), eq1), lt));
+
+  t = simde_mm_mul_ps(simde_mm_mul_ps(y, y), y);
+  y = simde_mm_fmadd_ps(y, simde_mm_div_ps(simde_mm_sub_ps(x, t), simde_mm_add_ps(simde_mm_add_ps(t, t), x)), y);
+
+  y = simde_mm_mul_ps(y, simde_mm_castsi128_ps(simde_mm_slli_epi32(simde_mm_castps_si128(simde_mm_add_ps(q, simde_mm_set1_ps(SIMDE_FLOAT32_C(12583039.0)))), 23)));
+  y = simde_mm_blendv_ps(y, simde_mm_mul_ps(y, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.00390625))), tiny);
+  y = simde_mm_or_ps(y, simde_mm_and_ps(a, simde_mm_set1_ps(SIMDE_FLOAT32_C(-0.0))));
+
+  /* cbrt(+/-0) = +/-0, cbrt(+/-inf) = +/-inf, cbrt(NaN) = NaN */
+  x = simde_x_mm_abs_ps(a);
+  y = simde_mm_blendv_ps(y, a, simde_mm_cmp_ps(x, simde_mm_setzero_ps(), SIMDE_CMP_EQ_OQ));
+  return simde_mm_blendv_ps(y, a, simde_mm_cmp_ps(x, simde_mm_set1_ps(SIMDE_MATH_INFINITYF), SIMDE_CMP_NLT_UQ));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_x_mm_cbrt_pd_poly_ (simde__m128d a) {
+  /* |a| = m * 2^(3q + rem) with m in [1, 2) and rem in {0, 1, 2}.  A
+   * quadratic estimate of cbrt(m) * cbrt(2^rem) is refined using Halley's
+   * method, y += y * (x - y^3) / (2y^3 + x) with x = m * 2^rem, and then
+   * scaled by 2^q. */
+  const simde__m128d magic = simde_mm_set1_pd(SIMDE_FLOAT64_C(6755399441055744.0));
+  const simde__m128d one = simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0));
+  simde__m128d tiny, lt, eq1;
+  simde__m128d x, e, m, q, rem, y, t;
+  simde__m128i bits;
+
+  x = simde_x_mm_abs_pd(a);
+  tiny = simde_mm_cmp_pd(x, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.2250738585072013830902e-308)), SIMDE_CMP_LT_OQ);
+  x = simde_mm_blendv_pd(x, simde_mm_mul_pd(x, simde_mm_set1_pd(SIMDE_FLOAT64_C(18014398509481984.0))), tiny);
+  bits = simde_mm_castpd_si128(x);
+  e = simde_mm_sub_pd(simde_mm_castsi128_pd(simde_mm_or_si128(simde_mm_srli_epi64(bits, 52), simde_mm_castpd_si128(simde_mm_set1_pd(SIMDE_FLOAT64_C(4503599627370496.0))))), simde_mm_set1_pd(SIMDE_FLOAT64_C(4503599627371519.0)));
+  m = simde_mm_castsi128_pd(simde_mm_or_si128(simde_mm_and_si128(bits, simde_mm_set1_epi64x(INT64_C(0x000fffffffffffff))), simde_mm_set1_epi64x(INT64_C(0x3ff0000000000000))));
+
+  q = simde_mm_sub_pd(simde_mm_fmadd_pd(simde_mm_sub_pd(e, one), simde_mm_set1_pd(SIMDE_FLOAT64_C(0.33333333333333333333)), magic), magic);
+  rem = simde_mm_fnmadd_pd(q, simde_mm_set1_pd(SIMDE_FLOAT64_C(3.0)), e);
+  lt = simde_mm_cmp_pd(rem, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.0)), SIMDE_CMP_LT_OQ);
+  eq1 = simde_mm_cmp_pd(rem, one, SIMDE_CMP_EQ_OQ);
+  x = simde_mm_mul_pd(m, simde_mm_blendv_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(4.0)), simde_mm_blendv_pd(one, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.0)), eq1), lt));
+
+  y = simde_mm_fmadd_pd(simde_mm_fmadd_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(-0.06031935419416206)), m, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.43944172333635173))), m, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.62151366597110536)));
+  y = simde_mm_mul_pd(y, simde_mm_blendv_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(1.5874010519681994748)), simde_mm_blendv_pd(one, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.2599210498948731648)), eq1), lt));
+
+  t = simde_mm_mul_pd(simde_mm_mul_pd(y, y), y);
+  y = simde_mm_fmadd_pd(y, simde_mm_div_pd(simde_mm_sub_pd(x, t), simde_mm_add_pd(simde_mm_add_pd(t, t), x)), y);
+  t = simde_mm_mul_pd(simde_mm_mul_pd(y, y), y);
+  y = simde_mm_fmadd_pd(y, simde_mm_div_pd(simde_mm_sub_pd(x, t), simde_mm_add_pd(simde_mm_add_pd(t, t), x)), y);
+
+  y = simde_mm_mul_pd(y, simde_mm_castsi128_pd(simde_mm_slli_epi64(simde_mm_castpd_si128(simde_mm_add_pd(q, simde_mm_set1_pd(SIMDE_FLOAT64_C(6755399441056767.0)))), 52)));
+  y = simde_mm_blendv_pd(y, simde_mm_mul_pd(y, simde_mm_set1_pd(SIMDE_FLOAT64_C(3.814697265625e-06))), tiny);
+  y = simde_mm_or_pd(y, simde_mm_and_pd(a, simde_mm_set1_pd(SIMDE_FLOAT64_C(-0.0))));
+
+  /* cbrt(+/-0) = +/-0, cbrt(+/-inf) = +/-inf, cbrt(NaN) = NaN */
+  x = simde_x_mm_abs_pd(a);
+  y = simde_mm_blendv_pd(y, a, simde_mm_cmp_pd(x, simde_mm_setzero_pd(), SIMDE_CMP_EQ_OQ));
+  return simde_mm_blendv_pd(y, a, simde_mm_cmp_pd(x, simde_mm_set1_pd(SIMDE_MATH_INFINITY), SIMDE_CMP_NLT_UQ));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_x_mm256_cbrt_ps_poly_ (simde__m256 a) {
+  /* |a| = m * 2^(3q + rem) with m in [1, 2) and rem in {0, 1, 2}.  A
+   * quadratic estimate of cbrt(m) * cbrt(2^rem) is refined using Halley's
+   * method, y += y * (x - y^3) / (2y^3 + x) with x = m * 2^rem, and then
+   * scaled by 2^q. */
+  const simde__m256 magic = simde_mm256_set1_ps(SIMDE_FLOAT32_C(12582912.0));
+  const simde__m256 one = simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.0));
+  simde__m256 tiny, lt, eq1;
+  simde__m256 x, e, m, q, rem, y, t;
+  simde__m256i bits;
+
+  x = simde_x_mm256_abs_ps(a);
+  tiny = simde_mm256_cmp_ps(x, simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.17549435082228750797e-38)), SIMDE_CMP_LT_OQ);
+  x = simde_mm256_blendv_ps(x, simde_mm256_mul_ps(x, simde_mm256_set1_ps(SIMDE_FLOAT32_C(16777216.0))), tiny);
+  bits = simde_mm256_castps_si256(x);
+  e = simde_mm256_sub_ps(simde_mm256_castsi256_ps(simde_mm256_or_si256(simde_mm256_srli_epi32(bits, 23), simde_mm256_castps_si256(simde_mm256_set1_ps(SIMDE_FLOAT32_C(8388608.0))))), simde_mm256_set1_ps(SIMDE_FLOAT32_C(8388735.0)));
+  m = simde_mm256_castsi256_ps(simde_mm256_or_si256(simde_mm256_and_si256(bits, simde_mm256_set1_epi32(INT32_C(0x007fffff))), simde_mm256_set1_epi32(INT32_C(0x3f800000))));
+
+  q = simde_mm256_sub_ps(simde_mm256_fmadd_ps(simde_mm256_sub_ps(e, one), simde_mm256_set1_ps(SIMDE_FLOAT32_C(0.33333333333333333333)), magic), magic);
+  rem = simde_mm256_fnmadd_ps(q, simde_mm256_set1_ps(SIMDE_FLOAT32_C(3.0)), e);
+  lt = simde_mm256_cmp_ps(rem, simde_mm256_set1_ps(SIMDE_FLOAT32_C(2.0)), SIMDE_CMP_LT_OQ);
+  eq1 = simde_mm256_cmp_ps(rem, one, SIMDE_CMP_EQ_OQ);
+  x = simde_mm256_mul_ps(m, simde_mm256_blendv_ps(simde_mm256_set1_ps(SIMDE_FLOAT32_C(4.0)), simde_mm256_blendv_ps(one, simde_mm256_set1_ps(SIMDE_FLOAT32_C(2.0)), eq1), lt));
+
+  y = simde_mm256_fmadd_ps(simde_mm256_fmadd_ps(simde_mm256_set1_ps(SIMDE_FLOAT32_C(-0.06031935419416206)), m, simde_mm256_set1_ps(SIMDE_FLOAT32_C(0.43944172333635173))), m, simde_mm256_set1_ps(SIMDE_FLOAT32_C(0.62151366597110536)));
+  y = simde_mm256_mul_ps(y, simde_mm256_blendv_ps(simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.5874010519681994748)), simde_mm256_blendv_ps(one, simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.2599210498948731648)), eq1), lt));
+
+  t = simde_mm256_mul_ps(simde_mm256_mul_ps(y, y), y);
+  y = simde_mm256_fmadd_ps(y, simde_mm256_div_ps(simde_mm256_sub_ps(x, t), simde_mm256_add_ps(simde_mm256_add_ps(t, t), x)), y);
+
+  y = simde_mm256_mul_ps(y, simde_mm256_castsi256_ps(simde_mm256_slli_epi32(simde_mm256_castps_si256(simde_mm256_add_ps(q, simde_mm256_set1_ps(SIMDE_FLOAT32_C(12583039.0)))), 23)));
+  y = simde_mm256_blendv_ps(y, simde_mm256_mul_ps(y, simde_mm256_set1_ps(SIMDE_FLOAT32_C(0.00390625))), tiny);
+  y = simde_mm256_or_ps(y, simde_mm256_and_ps(a, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-0.0))));
+
+  /* cbrt(+/-0) = +/-0, cbrt(+/-inf) = +/-inf, cbrt(NaN) = NaN */
+  x = simde_x_mm256_abs_ps(a);
+  y = simde_mm256_blendv_ps(y, a, simde_mm256_cmp_ps(x, simde_mm256_setzero_ps(), SIMDE_CMP_EQ_OQ));
+  return simde_mm256_blendv_ps(y, a, simde_mm256_cmp_ps(x, simde_mm256_set1_ps(SIMDE_MATH_INFINITYF), SIMDE_CMP_NLT_UQ));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256d
+simde_x_mm256_cbrt_pd_poly_ (simde__m256d a) {
+  /* |a| = m * 2^(3q + rem) with m in [1, 2) and rem in {0, 1, 2}.  A
+   * quadratic estimate of cbrt(m) * cbrt(2^rem) is refined using Halley's
+   * method, y += y * (x - y^3) / (2y^3 + x) with x = m * 2^rem, and then
+   * scaled by 2^q. */
+  const simde__m256d magic = simde_mm256_set1_pd(SIMDE_FLOAT64_C(6755399441055744.0));
+  const simde__m256d one = simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.0));
+  simde__m256d tiny, lt, eq1;
+  simde__m256d x, e, m, q, rem, y, t;
+  simde__m256i bits;
+
+  x = simde_x_mm256_abs_pd(a);
+  tiny = simde_mm256_cmp_pd(x, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.2250738585072013830902e-308)), SIMDE_CMP_LT_OQ);
+  x = simde_mm256_blendv_pd(x, simde_mm256_mul_pd(x, simde_mm256_set1_pd(SIMDE_FLOAT64_C(18014398509481984.0))), tiny);
+  bits = simde_mm256_castpd_si256(x);
+  e = simde_mm256_sub_pd(simde_mm256_castsi256_pd(simde_mm256_or_si256(simde_mm256_srli_epi64(bits, 52), simde_mm256_castpd_si256(simde_mm256_set1_pd(SIMDE_FLOAT64_C(4503599627370496.0))))), simde_mm256_set1_pd(SIMDE_FLOAT64_C(4503599627371519.0)));
+  m = simde_mm256_castsi256_pd(simde_mm256_or_si256(simde_mm256_and_si256(bits, simde_mm256_set1_epi64x(INT64_C(0x000fffffffffffff))), simde_mm256_set1_epi64x(INT64_C(0x3ff0000000000000))));
+
+  q = simde_mm256_sub_pd(simde_mm256_fmadd_pd(simde_mm256_sub_pd(e, one), simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.33333333333333333333)), magic), magic);
+  rem = simde_mm256_fnmadd_pd(q, simde_mm256_set1_pd(SIMDE_FLOAT64_C(3.0)), e);
+  lt = simde_mm256_cmp_pd(rem, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.0)), SIMDE_CMP_LT_OQ);
+  eq1 = simde_mm256_cmp_pd(rem, one, SIMDE_CMP_EQ_OQ);
+  x = simde_mm256_mul_pd(m, simde_mm256_blendv_pd(simde_mm256_set1_pd(SIMDE_FLOAT64_C(4.0)), simde_mm256_blendv_pd(one, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.0)), eq1), lt));
+
+  y = simde_mm256_fmadd_pd(simde_mm256_fmadd_pd(simde_mm256_set1_pd(SIMDE_FLOAT64_C(-0.06031935419416206)), m, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.43944172333635173))), m, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.62151366597110536)));
+  y = simde_mm256_mul_pd(y, simde_mm256_blendv_pd(simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.5874010519681994748)), simde_mm256_blendv_pd(one, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.2599210498948731648)), eq1), lt));
+
+  t = simde_mm256_mul_pd(simde_mm256_mul_pd(y, y), y);
+  y = simde_mm256_fmadd_pd(y, simde_mm256_div_pd(simde_mm256_sub_pd(x, t), simde_mm256_add_pd(simde_mm256_add_pd(t, t), x)), y);
+  t = simde_mm256_mul_pd(simde_mm256_mul_pd(y, y), y);
+  y = simde_mm256_fmadd_pd(y, simde_mm256_div_pd(simde_mm256_sub_pd(x, t), simde_mm256_add_pd(simde_mm256_add_pd(t, t), x)), y);
+
+  y = simde_mm256_mul_pd(y, simde_mm256_castsi256_pd(simde_mm256_slli_epi64(simde_mm256_castpd_si256(simde_mm256_add_pd(q, simde_mm256_set1_pd(SIMDE_FLOAT64_C(6755399441056767.0)))), 52)));
+  y = simde_mm256_blendv_pd(y, simde_mm256_mul_pd(y, simde_mm256_set1_pd(SIMDE_FLOAT64_C(3.814697265625e-06))), tiny);
+  y = simde_mm256_or_pd(y, simde_mm256_and_pd(a, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-0.0))));
+
+  /* cbrt(+/-0) = +/-0, cbrt(+/-inf) = +/-inf, cbrt(NaN) = NaN */
+  x = simde_x_mm256_abs_pd(a);
+  y = simde_mm256_blendv_pd(y, a, simde_mm256_cmp_pd(x, simde_mm256_setzero_pd(), SIMDE_CMP_EQ_OQ));
+  return simde_mm256_blendv_pd(y, a, simde_mm256_cmp_pd(x, simde_mm256_set1_pd(SIMDE_MATH_INFINITY), SIMDE_CMP_NLT_UQ));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_x_mm512_cbrt_ps_poly_ (simde__m512 a) {
+  /* |a| = m * 2^(3q + rem) with m in [1, 2) and rem in {0, 1, 2}.  A
+   * quadratic estimate of cbrt(m) * cbrt(2^rem) is refined using Halley's
+   * method, y += y * (x - y^3) / (2y^3 + x) with x = m * 2^rem, and then
+   * scaled by 2^q. */
+  const simde__m512 magic = simde_mm512_set1_ps(SIMDE_FLOAT32_C(12582912.0));
+  const simde__m512 one = simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.0));
+  simde__mmask16 tiny, lt, eq1;
+  simde__m512 x, e, m, q, rem, y, t;
+  simde__m512i bits;
+
+  x = simde_mm512_abs_ps(a);
+  tiny = simde_mm512_cmp_ps_mask(x, simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.17549435082228750797e-38)), SIMDE_CMP_LT_OQ);
+  x = simde_mm512_mask_mov_ps(x, tiny, simde_mm512_mul_ps(x, simde_mm512_set1_ps(SIMDE_FLOAT32_C(16777216.0))));
+  bits = simde_mm512_castps_si512(x);
+  e = simde_mm512_sub_ps(simde_mm512_castsi512_ps(simde_mm512_or_si512(simde_mm512_srli_epi32(bits, 23), simde_mm512_castps_si512(simde_mm512_set1_ps(SIMDE_FLOAT32_C(8388608.0))))), simde_mm512_set1_ps(SIMDE_FLOAT32_C(8388735.0)));
+  m = simde_mm512_castsi512_ps(simde_mm512_or_si512(simde_mm512_and_si512(bits, simde_mm512_set1_epi32(INT32_C(0x007fffff))), simde_mm512_set1_epi32(INT32_C(0x3f800000))));
+
+  q = simde_mm512_sub_ps(simde_mm512_fmadd_ps(simde_mm512_sub_ps(e, one), simde_mm512_set1_ps(SIMDE_FLOAT32_C(0.33333333333333333333)), magic), magic);
+  rem = simde_mm512_fnmadd_ps(q, simde_mm512_set1_ps(SIMDE_FLOAT32_C(3.0)), e);
+  lt = simde_mm512_cmp_ps_mask(rem, simde_mm512_set1_ps(SIMDE_FLOAT32_C(2.0)), SIMDE_CMP_LT_OQ);
+  eq1 = simde_mm512_cmp_ps_mask(rem, one, SIMDE_CMP_EQ_OQ);
+  x = simde_mm512_mul_ps(m, simde_mm512_mask_mov_ps(simde_mm512_set1_ps(SIMDE_FLOAT32_C(4.0)), lt, simde_mm512_mask_mov_ps(one, eq1, simde_mm512_set1_ps(SIMDE_FLOAT32_C(2.0)))));
+
+  y = simde_mm512_fmadd_ps(simde_mm512_fmadd_ps(simde_mm512_set1_ps(SIMDE_FLOAT32_C(-0.06031935419416206)), m, simde_mm512_set1_ps(SIMDE_FLOAT32_C(0.43944172333635173))), m, simde_mm512_set1_ps(SIMDE_FLOAT32_C(0.62151366597110536)));
+  y = simde_mm512_mul_ps(y, simde_mm512_mask_mov_ps(simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.5874010519681994748)), lt, simde_mm512_mask_mov_ps(one, eq1, simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.2599210498948731648)))));
+
+  t = simde_mm512_mul_ps(simde_mm512_mul_ps(y, y), y);
+  y = simde_mm512_fmadd_ps(y, simde_mm512_div_ps(simde_mm512_sub_ps(x, t), simde_mm512_add_ps(simde_mm512_add_ps(t, t), x)), y);
+
+  y = simde_mm512_mul_ps(y, simde_mm512_castsi512_ps(simde_mm512_slli_epi32(simde_mm512_castps_si512(simde_mm512_add_ps(q, simde_mm512_set1_ps(SIMDE_FLOAT32_C(12583039.0)))), 23)));
+  y = simde_mm512_mask_mov_ps(y, tiny, simde_mm512_mul_ps(y, simde_mm512_set1_ps(SIMDE_FLOAT32_C(0.00390625))));
+  y = simde_mm512_or_ps(y, simde_mm512_and_ps(a, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-0.0))));
+
+  /* cbrt(+/-0) = +/-0, cbrt(+/-inf) = +/-inf, cbrt(NaN) = NaN */
+  x = simde_mm512_abs_ps(a);
+  y = simde_mm512_mask_mov_ps(y, simde_mm512_cmp_ps_mask(x, simde_mm512_setzero_ps(), SIMDE_CMP_EQ_OQ), a);
+  return simde_mm512_mask_mov_ps(y, simde_mm512_cmp_ps_mask(x, simde_mm512_set1_ps(SIMDE_MATH_INFINITYF), SIMDE_CMP_NLT_UQ), a);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_x_mm512_cbrt_pd_poly_ (simde__m512d a) {
+  /* |a| = m * 2^(3q + rem) with m in [1, 2) and rem in {0, 1, 2}.  A
+   * quadratic estimate of cbrt(m) * cbrt(2^rem) is refined using Halley's
+   * method, y += y * (x - y^3) / (2y^3 + x) with x = m * 2^rem, and then
+   * scaled by 2^q. */
+  const simde__m512d magic = simde_mm512_set1_pd(SIMDE_FLOAT64_C(6755399441055744.0));
+  const simde__m512d one = simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.0));
+  simde__mmask8 tiny, lt, eq1;
+  simde__m512d x, e, m, q, rem, y, t;
+  simde__m512i bits;
+
+  x = simde_mm512_abs_pd(a);
+  tiny = simde_mm512_cmp_pd_mask(x, simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.2250738585072013830902e-308)), SIMDE_CMP_LT_OQ);
+  x = simde_mm512_mask_mov_pd(x, tiny, simde_mm512_mul_pd(x, simde_mm512_set1_pd(SIMDE_FLOAT64_C(18014398509481984.0))));
+  bits = simde_mm512_castpd_si512(x);
+  e = simde_mm512_sub_pd(simde_mm512_castsi512_pd(simde_mm512_or_si512(simde_mm512_srli_epi64(bits, 52), simde_mm512_castpd_si512(simde_mm512_set1_pd(SIMDE_FLOAT64_C(4503599627370496.0))))), simde_mm512_set1_pd(SIMDE_FLOAT64_C(4503599627371519.0)));
+  m = simde_mm512_castsi512_pd(simde_mm512_or_si512(simde_mm512_and_si512(bits, simde_mm512_set1_epi64(INT64_C(0x000fffffffffffff))), simde_mm512_set1_epi64(INT64_C(0x3ff0000000000000))));
+
+  q = simde_mm512_sub_pd(simde_mm512_fmadd_pd(simde_mm512_sub_pd(e, one), simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.33333333333333333333)), magic), magic);
+  rem = simde_mm512_fnmadd_pd(q, simde_mm512_set1_pd(SIMDE_FLOAT64_C(3.0)), e);
+  lt = simde_mm512_cmp_pd_mask(rem, simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.0)), SIMDE_CMP_LT_OQ);
+  eq1 = simde_mm512_cmp_pd_mask(rem, one, SIMDE_CMP_EQ_OQ);
+  x = simde_mm512_mul_pd(m, simde_mm512_mask_mov_pd(simde_mm512_set1_pd(SIMDE_FLOAT64_C(4.0)), lt, simde_mm512_mask_mov_pd(one, eq1, simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.0)))));
+
+  y = simde_mm512_fmadd_pd(simde_mm512_fmadd_pd(simde_mm512_set1_pd(SIMDE_FLOAT64_C(-0.06031935419416206)), m, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.43944172333635173))), m, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.62151366597110536)));
+  y = simde_mm512_mul_pd(y, simde_mm512_mask_mov_pd(simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.5874010519681994748)), lt, simde_mm512_mask_mov_pd(one, eq1, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.2599210498948731648)))));
+
+  t = simde_mm512_mul_pd(simde_mm512_mul_pd(y, y), y);
+  y = simde_mm512_fmadd_pd(y, simde_mm512_div_pd(simde_mm512_sub_pd(x, t), simde_mm512_add_pd(simde_mm512_add_pd(t, t), x)), y);
+  t = simde_mm512_mul_pd(simde_mm512_mul_pd(y, y), y);
+  y = simde_mm512_fmadd_pd(y, simde_mm512_div_pd(simde_mm512_sub_pd(x, t), simde_mm512_add_pd(simde_mm512_add_pd(t, t), x)), y);
+
+  y = simde_mm512_mul_pd(y, simde_mm512_castsi512_pd(simde_mm512_slli_epi64(simde_mm512_castpd_si512(simde_mm512_add_pd(q, simde_mm512_set1_pd(SIMDE_FLOAT64_C(6755399441056767.0)))), 52)));
+  y = simde_mm512_mask_mov_pd(y, tiny, simde_mm512_mul_pd(y, simde_mm512_set1_pd(SIMDE_FLOAT64_C(3.814697265625e-06))));
+  y = simde_mm512_or_pd(y, simde_mm512_and_pd(a, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-0.0))));
+
+  /* cbrt(+/-0) = +/-0, cbrt(+/-inf) = +/-inf, cbrt(NaN) = NaN */
+  x = simde_mm512_abs_pd(a);
+  y = simde_mm512_mask_mov_pd(y, simde_mm512_cmp_pd_mask(x, simde_mm512_setzero_pd(), SIMDE_CMP_EQ_OQ), a);
+  return simde_mm512_mask_mov_pd(y, simde_mm512_cmp_pd_mask(x, simde_mm512_set1_pd(SIMDE_MATH_INFINITY), SIMDE_CMP_NLT_UQ), a);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_x_mm_erf_ps_poly_ (simde__m128 a) {
+  /* erf(x) = x * P(x^2) for |x| < 1, 1 - exp(Q(x)) above that, where Q
+   * approximates log(erfc(x)); erf(x) rounds to 1 beyond 4. */
+  const simde__m128 one = simde_mm_set1_ps(SIMDE_FLOAT32_C(1.0));
+  simde__m128 x, z, s, b;
+
+  x = simde_x_mm_abs_ps(a);
+  z = simde_mm_mul_ps(x, x);
+  s = simde_mm_set1_ps(SIMDE_FLOAT32_C(7.88907031e-05));
+  s = simde_mm_fmadd_ps(s, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(-0.000802082628)));
+  s = simde_mm_fmadd_ps(s, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.00518953362)));
+  s = simde_mm_fmadd_ps(s, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(-0.0268544437)));
+  s = simde_mm_fmadd_ps(s, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.112836002)));
+  s = simde_mm_fmadd_ps(s, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(-0.376126271)));
+  s = simde_mm_fmadd_ps(s, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.12837917)));
+  s = simde_mm_mul_ps(s, x);
+
+  z = simde_mm_min_ps(simde_mm_set1_ps(SIMDE_FLOAT32_C(4.0)), x);
+  b = simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.56624526e-05));
+  b = simde_mm_fmadd_ps(b, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.000357215344)));
+  b = simde_mm_fmadd_ps(b, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(-0.00371432929)));
+  b = simde_mm_fmadd_ps(b, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.0236651946)));
+  b = simde_mm_fmadd_ps(b, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(-0.105589282)));
+  b = simde_mm_fmadd_ps(b, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(-0.636239223)));
+  b = simde_mm_fmadd_ps(b, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(-1.12784236)));
+  b = simde_mm_fmadd_ps(b, z, simde_mm_set1_ps(SIMDE_FLOAT32_C(-0.00022706457)));
+  b = simde_mm_sub_ps(one, simde_x_mm_exp_ps_poly_(b));
+
+  s = simde_mm_blendv_ps(b, s, simde_mm_cmp_ps(x, one, SIMDE_CMP_LT_OQ));
+  return simde_mm_or_ps(s, simde_mm_and_ps(a, simde_mm_set1_ps(SIMDE_FLOAT32_C(-0.0))));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_x_mm_erf_pd_poly_ (simde__m128d a) {
+  /* erf(x) = x * P(x^2) for |x| < 0.875, and 1 - exp(Q(x)) above that,
+   * with separate fits of log(erfc(x)) on [0.875, 2.5) and [2.5, 6];
+   * erf(x) rounds to 1 beyond 6. */
+  const simde__m128d one = simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0));
+  simde__m128d x, z, s, b, c;
+
+  x = simde_x_mm_abs_pd(a);
+  z = simde_mm_mul_pd(x, x);
+  s = simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0475855081188038e-08));
+  s = simde_mm_fmadd_pd(s, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.562658171126466e-07)));
+  s = simde_mm_fmadd_pd(s, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.6388570805360847e-06)));
+  s = simde_mm_fmadd_pd(s, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.4921050228578471e-05)));
+  s = simde_mm_fmadd_pd(s, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.00012055146998361572)));
+  s = simde_mm_fmadd_pd(s, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-0.00085483221779224174)));
+  s = simde_mm_fmadd_pd(s, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.0052239775465808096)));
+  s = simde_mm_fmadd_pd(s, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-0.026866170637634714)));
+  s = simde_mm_fmadd_pd(s, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.11283791670918554)));
+  s = simde_mm_fmadd_pd(s, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-0.37612638903183054)));
+  s = simde_mm_fmadd_pd(s, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.1283791670955126)));
+  s = simde_mm_mul_pd(s, x);
+
+  z = simde_mm_sub_pd(x, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.6875)));
+  b = simde_mm_set1_pd(SIMDE_FLOAT64_C(-5.9279179734650255e-10));
+  b = simde_mm_fmadd_pd(b, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(9.0626417079736561e-10)));
+  b = simde_mm_fmadd_pd(b, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.8146119286415955e-09)));
+  b = simde_mm_fmadd_pd(b, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-2.5577755969074871e-08)));
+  b = simde_mm_fmadd_pd(b, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.3096180327547031e-07)));
+  b = simde_mm_fmadd_pd(b, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-4.856773170287961e-07)));
+  b = simde_mm_fmadd_pd(b, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.1677766501715469e-06)));
+  b = simde_mm_fmadd_pd(b, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.509812998871545e-07)));
+  b = simde_mm_fmadd_pd(b, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-2.4017618748775297e-05)));
+  b = simde_mm_fmadd_pd(b, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.00018498086218250332)));
+  b = simde_mm_fmadd_pd(b, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-0.0010315018366604642)));
+  b = simde_mm_fmadd_pd(b, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.0049366409277152891)));
+  b = simde_mm_fmadd_pd(b, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-0.021733597992359598)));
+  b = simde_mm_fmadd_pd(b, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-0.9059783429382452)));
+  b = simde_mm_fmadd_pd(b, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-3.8461136606341788)));
+  b = simde_mm_fmadd_pd(b, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-4.0739372120416686)));
+
+  z = simde_mm_sub_pd(simde_mm_min_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(6.0)), x), simde_mm_set1_pd(SIMDE_FLOAT64_C(4.25)));
+  c = simde_mm_set1_pd(SIMDE_FLOAT64_C(2.2793889064603123e-12));
+  c = simde_mm_fmadd_pd(c, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(3.8630781372197366e-11)));
+  c = simde_mm_fmadd_pd(c, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-5.0064729015463857e-10)));
+  c = simde_mm_fmadd_pd(c, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(4.0755705529772695e-09)));
+  c = simde_mm_fmadd_pd(c, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-3.1448027840197196e-08)));
+  c = simde_mm_fmadd_pd(c, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.3015318482514894e-07)));
+  c = simde_mm_fmadd_pd(c, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-1.6068835442196031e-06)));
+  c = simde_mm_fmadd_pd(c, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0879288383268456e-05)));
+  c = simde_mm_fmadd_pd(c, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-7.2379717318215683e-05)));
+  c = simde_mm_fmadd_pd(c, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.00048052874369281515)));
+  c = simde_mm_fmadd_pd(c, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-0.0032637443185890222)));
+  c = simde_mm_fmadd_pd(c, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-0.97608457639565249)));
+  c = simde_mm_fmadd_pd(c, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-8.7237757155181992)));
+  c = simde_mm_fmadd_pd(c, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(-20.107769901469705)));
+
+  b = simde_mm_blendv_pd(c, b, simde_mm_cmp_pd(x, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.5)), SIMDE_CMP_LT_OQ));
+  b = simde_mm_sub_pd(one, simde_x_mm_exp_pd_poly_(b));
+
+  s = simde_mm_blendv_pd(b, s, simde_mm_cmp_pd(x, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.875)), SIMDE_CMP_LT_OQ));
+  return simde_mm_or_pd(s, simde_mm_and_pd(a, simde_mm_set1_pd(SIMDE_FLOAT64_C(-0.0))));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_x_mm256_erf_ps_poly_ (simde__m256 a) {
+  /* erf(x) = x * P(x^2) for |x| < 1, 1 - exp(Q(x)) above that, where Q
+   * approximates log(erfc(x)); erf(x) rounds to 1 beyond 4. */
+  const simde__m256 one = simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.0));
+  simde__m256 x, z, s, b;
+
+  x = simde_x_mm256_abs_ps(a);
+  z = simde_mm256_mul_ps(x, x);
+  s = simde_mm256_set1_ps(SIMDE_FLOAT32_C(7.88907031e-05));
+  s = simde_mm256_fmadd_ps(s, z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-0.000802082628)));
+  s = simde_mm256_fmadd_ps(s, z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(0.00518953362)));
+  s = simde_mm256_fmadd_ps(s, z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-0.0268544437)));
+  s = simde_mm256_fmadd_ps(s, z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(0.112836002)));
+  s = simde_mm256_fmadd_ps(s, z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-0.376126271)));
+  s = simde_mm256_fmadd_ps(s, z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.12837917)));
+  s = simde_mm256_mul_ps(s, x);
+
+  z = simde_mm256_min_ps(simde_mm256_set1_ps(SIMDE_FLOAT32_C(4.0)), x);
+  b = simde_mm256_set1_ps(SIMDE_FLOAT32_C(-1.56624526e-05));
+  b = simde_mm256_fmadd_ps(b, z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(0.000357215344)));
+  b = simde_mm256_fmadd_ps(b, z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-0.00371432929)));
+  b = simde_mm256_fmadd_ps(b, z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(0.0236651946)));
+  b = simde_mm256_fmadd_ps(b, z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-0.105589282)));
+  b = simde_mm256_fmadd_ps(b, z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-0.636239223)));
+  b = simde_mm256_fmadd_ps(b, z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-1.12784236)));
+  b = simde_mm256_fmadd_ps(b, z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-0.00022706457)));
+  b = simde_mm256_sub_ps(one, simde_x_mm256_exp_ps_poly_(b));
+
+  s = simde_mm256_blendv_ps(b, s, simde_mm256_cmp_ps(x, one, SIMDE_CMP_LT_OQ));
+  return simde_mm256_or_ps(s, simde_mm256_and_ps(a, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-0.0))));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256d
+simde_x_mm256_erf_pd_poly_ (simde__m256d a) {
+  /* erf(x) = x * P(x^2) for |x| < 0.875, and 1 - exp(Q(x)) above that,
+   * with separate fits of log(erfc(x)) on [0.875, 2.5) and [2.5, 6];
+   * erf(x) rounds to 1 beyond 6. */
+  const simde__m256d one = simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.0));
+  simde__m256d x, z, s, b, c;
+
+  x = simde_x_mm256_abs_pd(a);
+  z = simde_mm256_mul_pd(x, x);
+  s = simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.0475855081188038e-08));
+  s = simde_mm256_fmadd_pd(s, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-1.562658171126466e-07)));
+  s = simde_mm256_fmadd_pd(s, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.6388570805360847e-06)));
+  s = simde_mm256_fmadd_pd(s, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-1.4921050228578471e-05)));
+  s = simde_mm256_fmadd_pd(s, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.00012055146998361572)));
+  s = simde_mm256_fmadd_pd(s, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-0.00085483221779224174)));
+  s = simde_mm256_fmadd_pd(s, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.0052239775465808096)));
+  s = simde_mm256_fmadd_pd(s, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-0.026866170637634714)));
+  s = simde_mm256_fmadd_pd(s, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.11283791670918554)));
+  s = simde_mm256_fmadd_pd(s, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-0.37612638903183054)));
+  s = simde_mm256_fmadd_pd(s, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.1283791670955126)));
+  s = simde_mm256_mul_pd(s, x);
+
+  z = simde_mm256_sub_pd(x, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.6875)));
+  b = simde_mm256_set1_pd(SIMDE_FLOAT64_C(-5.9279179734650255e-10));
+  b = simde_mm256_fmadd_pd(b, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(9.0626417079736561e-10)));
+  b = simde_mm256_fmadd_pd(b, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.8146119286415955e-09)));
+  b = simde_mm256_fmadd_pd(b, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-2.5577755969074871e-08)));
+  b = simde_mm256_fmadd_pd(b, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.3096180327547031e-07)));
+  b = simde_mm256_fmadd_pd(b, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-4.856773170287961e-07)));
+  b = simde_mm256_fmadd_pd(b, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.1677766501715469e-06)));
+  b = simde_mm256_fmadd_pd(b, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.509812998871545e-07)));
+  b = simde_mm256_fmadd_pd(b, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-2.4017618748775297e-05)));
+  b = simde_mm256_fmadd_pd(b, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.00018498086218250332)));
+  b = simde_mm256_fmadd_pd(b, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-0.0010315018366604642)));
+  b = simde_mm256_fmadd_pd(b, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.0049366409277152891)));
+  b = simde_mm256_fmadd_pd(b, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-0.021733597992359598)));
+  b = simde_mm256_fmadd_pd(b, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-0.9059783429382452)));
+  b = simde_mm256_fmadd_pd(b, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-3.8461136606341788)));
+  b = simde_mm256_fmadd_pd(b, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-4.0739372120416686)));
+
+  z = simde_mm256_sub_pd(simde_mm256_min_pd(simde_mm256_set1_pd(SIMDE_FLOAT64_C(6.0)), x), simde_mm256_set1_pd(SIMDE_FLOAT64_C(4.25)));
+  c = simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.2793889064603123e-12));
+  c = simde_mm256_fmadd_pd(c, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(3.8630781372197366e-11)));
+  c = simde_mm256_fmadd_pd(c, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-5.0064729015463857e-10)));
+  c = simde_mm256_fmadd_pd(c, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(4.0755705529772695e-09)));
+  c = simde_mm256_fmadd_pd(c, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-3.1448027840197196e-08)));
+  c = simde_mm256_fmadd_pd(c, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.3015318482514894e-07)));
+  c = simde_mm256_fmadd_pd(c, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-1.6068835442196031e-06)));
+  c = simde_mm256_fmadd_pd(c, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.0879288383268456e-05)));
+  c = simde_mm256_fmadd_pd(c, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-7.2379717318215683e-05)));
+  c = simde_mm256_fmadd_pd(c, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.00048052874369281515)));
+  c = simde_mm256_fmadd_pd(c, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-0.0032637443185890222)));
+  c = simde_mm256_fmadd_pd(c, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-0.97608457639565249)));
+  c = simde_mm256_fmadd_pd(c, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-8.7237757155181992)));
+  c = simde_mm256_fmadd_pd(c, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-20.107769901469705)));
+
+  b = simde_mm256_blendv_pd(c, b, simde_mm256_cmp_pd(x, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.5)), SIMDE_CMP_LT_OQ));
+  b = simde_mm256_sub_pd(one, simde_x_mm256_exp_pd_poly_(b));
+
+  s = simde_mm256_blendv_pd(b, s, simde_mm256_cmp_pd(x, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.875)), SIMDE_CMP_LT_OQ));
+  return simde_mm256_or_pd(s, simde_mm256_and_pd(a, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-0.0))));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_x_mm512_erf_ps_poly_ (simde__m512 a) {
+  /* erf(x) = x * P(x^2) for |x| < 1, 1 - exp(Q(x)) above that, where Q
+   * approximates log(erfc(x)); erf(x) rounds to 1 beyond 4. */
+  const simde__m512 one = simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.0));
+  simde__m512 x, z, s, b;
+
+  x = simde_mm512_abs_ps(a);
+  z = simde_mm512_mul_ps(x, x);
+  s = simde_mm512_set1_ps(SIMDE_FLOAT32_C(7.88907031e-05));
+  s = simde_mm512_fmadd_ps(s, z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-0.000802082628)));
+  s = simde_mm512_fmadd_ps(s, z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(0.00518953362)));
+  s = simde_mm512_fmadd_ps(s, z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-0.0268544437)));
+  s = simde_mm512_fmadd_ps(s, z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(0.112836002)));
+  s = simde_mm512_fmadd_ps(s, z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-0.376126271)));
+  s = simde_mm512_fmadd_ps(s, z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.12837917)));
+  s = simde_mm512_mul_ps(s, x);
+
+  z = simde_mm512_min_ps(simde_mm512_set1_ps(SIMDE_FLOAT32_C(4.0)), x);
+  b = simde_mm512_set1_ps(SIMDE_FLOAT32_C(-1.56624526e-05));
+  b = simde_mm512_fmadd_ps(b, z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(0.000357215344)));
+  b = simde_mm512_fmadd_ps(b, z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-0.00371432929)));
+  b = simde_mm512_fmadd_ps(b, z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(0.0236651946)));
+  b = simde_mm512_fmadd_ps(b, z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-0.105589282)));
+  b = simde_mm512_fmadd_ps(b, z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-0.636239223)));
+  b = simde_mm512_fmadd_ps(b, z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-1.12784236)));
+  b = simde_mm512_fmadd_ps(b, z, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-0.00022706457)));
+  b = simde_mm512_sub_ps(one, simde_x_mm512_exp_ps_poly_(b));
+
+  s = simde_mm512_mask_mov_ps(b, simde_mm512_cmp_ps_mask(x, one, SIMDE_CMP_LT_OQ), s);
+  return simde_mm512_or_ps(s, simde_mm512_and_ps(a, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-0.0))));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_x_mm512_erf_pd_poly_ (simde__m512d a) {
+  /* erf(x) = x * P(x^2) for |x| < 0.875, and 1 - exp(Q(x)) above that,
+   * with separate fits of log(erfc(x)) on [0.875, 2.5) and [2.5, 6];
+   * erf(x) rounds to 1 beyond 6. */
+  const simde__m512d one = simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.0));
+  simde__m512d x, z, s, b, c;
+
+  x = simde_mm512_abs_pd(a);
+  z = simde_mm512_mul_pd(x, x);
+  s = simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.0475855081188038e-08));
+  s = simde_mm512_fmadd_pd(s, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-1.562658171126466e-07)));
+  s = simde_mm512_fmadd_pd(s, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.6388570805360847e-06)));
+  s = simde_mm512_fmadd_pd(s, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-1.4921050228578471e-05)));
+  s = simde_mm512_fmadd_pd(s, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.00012055146998361572)));
+  s = simde_mm512_fmadd_pd(s, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-0.00085483221779224174)));
+  s = simde_mm512_fmadd_pd(s, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.0052239775465808096)));
+  s = simde_mm512_fmadd_pd(s, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-0.026866170637634714)));
+  s = simde_mm512_fmadd_pd(s, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.11283791670918554)));
+  s = simde_mm512_fmadd_pd(s, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-0.37612638903183054)));
+  s = simde_mm512_fmadd_pd(s, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.1283791670955126)));
+  s = simde_mm512_mul_pd(s, x);
+
+  z = simde_mm512_sub_pd(x, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.6875)));
+  b = simde_mm512_set1_pd(SIMDE_FLOAT64_C(-5.9279179734650255e-10));
+  b = simde_mm512_fmadd_pd(b, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(9.0626417079736561e-10)));
+  b = simde_mm512_fmadd_pd(b, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.8146119286415955e-09)));
+  b = simde_mm512_fmadd_pd(b, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-2.5577755969074871e-08)));
+  b = simde_mm512_fmadd_pd(b, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.3096180327547031e-07)));
+  b = simde_mm512_fmadd_pd(b, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-4.856773170287961e-07)));
+  b = simde_mm512_fmadd_pd(b, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.1677766501715469e-06)));
+  b = simde_mm512_fmadd_pd(b, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.509812998871545e-07)));
+  b = simde_mm512_fmadd_pd(b, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-2.4017618748775297e-05)));
+  b = simde_mm512_fmadd_pd(b, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.00018498086218250332)));
+  b = simde_mm512_fmadd_pd(b, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-0.0010315018366604642)));
+  b = simde_mm512_fmadd_pd(b, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.0049366409277152891)));
+  b = simde_mm512_fmadd_pd(b, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-0.021733597992359598)));
+  b = simde_mm512_fmadd_pd(b, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-0.9059783429382452)));
+  b = simde_mm512_fmadd_pd(b, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-3.8461136606341788)));
+  b = simde_mm512_fmadd_pd(b, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-4.0739372120416686)));
+
+  z = simde_mm512_sub_pd(simde_mm512_min_pd(simde_mm512_set1_pd(SIMDE_FLOAT64_C(6.0)), x), simde_mm512_set1_pd(SIMDE_FLOAT64_C(4.25)));
+  c = simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.2793889064603123e-12));
+  c = simde_mm512_fmadd_pd(c, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(3.8630781372197366e-11)));
+  c = simde_mm512_fmadd_pd(c, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-5.0064729015463857e-10)));
+  c = simde_mm512_fmadd_pd(c, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(4.0755705529772695e-09)));
+  c = simde_mm512_fmadd_pd(c, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-3.1448027840197196e-08)));
+  c = simde_mm512_fmadd_pd(c, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.3015318482514894e-07)));
+  c = simde_mm512_fmadd_pd(c, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-1.6068835442196031e-06)));
+  c = simde_mm512_fmadd_pd(c, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.0879288383268456e-05)));
+  c = simde_mm512_fmadd_pd(c, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-7.2379717318215683e-05)));
+  c = simde_mm512_fmadd_pd(c, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.00048052874369281515)));
+  c = simde_mm512_fmadd_pd(c, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-0.0032637443185890222)));
+  c = simde_mm512_fmadd_pd(c, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-0.97608457639565249)));
+  c = simde_mm512_fmadd_pd(c, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-8.7237757155181992)));
+  c = simde_mm512_fmadd_pd(c, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-20.107769901469705)));
+
+  b = simde_mm512_mask_mov_pd(c, simde_mm512_cmp_pd_mask(x, simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.5)), SIMDE_CMP_LT_OQ), b);
+  b = simde_mm512_sub_pd(one, simde_x_mm512_exp_pd_poly_(b));
+
+  s = simde_mm512_mask_mov_pd(b, simde_mm512_cmp_pd_mask(x, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.875)), SIMDE_CMP_LT_OQ), s);
+  return simde_mm512_or_pd(s, simde_mm512_and_pd(a, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-0.0))));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_x_mm_mul_err_pd_ (simde__m128d a, simde__m128d b, simde__m128d p) {
+  /* The rounding error of p = a * b, so that a * b == p + err exactly. */
+  #if defined(SIMDE_X86_FMA_NATIVE)
+    return simde_mm_fmsub_pd(a, b, p);
+  #elif defined(simde_math_fma) && (defined(__FP_FAST_FMA) || defined(FP_FAST_FMA))
+    simde__m128d_private
+      r_,
+      a_ = simde__m128d_to_private(a),
+      b_ = simde__m128d_to_private(b),
+      p_ = simde__m128d_to_private(p);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+      r_.f64[i] = simde_math_fma(a_.f64[i], b_.f64[i], -p_.f64[i]);
+    }
+
+    return simde__m128d_from_private(r_);
+  #else
+    /* Dekker's product; only valid if the compiler doesn't contract it. */
+    const simde__m128d split = simde_mm_set1_pd(SIMDE_FLOAT64_C(134217729.0));
+    simde__m128d t, ah, al, bh, bl, r;
+
+    t = simde_mm_mul_pd(a, split);
+    ah = simde_mm_sub_pd(t, simde_mm_sub_pd(t, a));
+    al = simde_mm_sub_pd(a, ah);
+    t = simde_mm_mul_pd(b, split);
+    bh = simde_mm_sub_pd(t, simde_mm_sub_pd(t, b));
+    bl = simde_mm_sub_pd(b, bh);
+
+    r = simde_mm_sub_pd(simde_mm_mul_pd(ah, bh), p);
+    r = simde_mm_add_pd(r, simde_mm_mul_pd(ah, bl));
+    r = simde_mm_add_pd(r, simde_mm_mul_pd(al, bh));
+    return simde_mm_add_pd(r, simde_mm_mul_pd(al, bl));
+  #endif
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256d
+simde_x_mm256_mul_err_pd_ (simde__m256d a, simde__m256d b, simde__m256d p) {
+  /* The rounding error of p = a * b, so that a * b == p + err exactly. */
+  #if defined(SIMDE_X86_FMA_NATIVE)
+    return simde_mm256_fmsub_pd(a, b, p);
+  #elif defined(simde_math_fma) && (defined(__FP_FAST_FMA) || defined(FP_FAST_FMA))
+    simde__m256d_private
+      r_,
+      a_ = simde__m256d_to_private(a),
+      b_ = simde__m256d_to_private(b),
+      p_ = simde__m256d_to_private(p);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+      r_.f64[i] = simde_math_fma(a_.f64[i], b_.f64[i], -p_.f64[i]);
+    }
+
+    return simde__m256d_from_private(r_);
+  #else
+    /* Dekker's product; only valid if the compiler doesn't contract it. */
+    const simde__m256d split = simde_mm256_set1_pd(SIMDE_FLOAT64_C(134217729.0));
+    simde__m256d t, ah, al, bh, bl, r;
+
+    t = simde_mm256_mul_pd(a, split);
+    ah = simde_mm256_sub_pd(t, simde_mm256_sub_pd(t, a));
+    al = simde_mm256_sub_pd(a, ah);
+    t = simde_mm256_mul_pd(b, split);
+    bh = simde_mm256_sub_pd(t, simde_mm256_sub_pd(t, b));
+    bl = simde_mm256_sub_pd(b, bh);
+
+    r = simde_mm256_sub_pd(simde_mm256_mul_pd(ah, bh), p);
+    r = simde_mm256_add_pd(r, simde_mm256_mul_pd(ah, bl));
+    r = simde_mm256_add_pd(r, simde_mm256_mul_pd(al, bh));
+    return simde_mm256_add_pd(r, simde_mm256_mul_pd(al, bl));
+  #endif
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_x_mm512_mul_err_pd_ (simde__m512d a, simde__m512d b, simde__m512d p) {
+  /* The rounding error of p = a * b, so that a * b == p + err exactly. */
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return simde_mm512_fmsub_pd(a, b, p);
+  #elif defined(simde_math_fma) && (defined(__FP_FAST_FMA) || defined(FP_FAST_FMA))
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a),
+      b_ = simde__m512d_to_private(b),
+      p_ = simde__m512d_to_private(p);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+      r_.f64[i] = simde_math_fma(a_.f64[i], b_.f64[i], -p_.f64[i]);
+    }
+
+    return simde__m512d_from_private(r_);
+  #else
+    /* Dekker's product; only valid if the compiler doesn't contract it. */
+    const simde__m512d split = simde_mm512_set1_pd(SIMDE_FLOAT64_C(134217729.0));
+    simde__m512d t, ah, al, bh, bl, r;
+
+    t = simde_mm512_mul_pd(a, split);
+    ah = simde_mm512_sub_pd(t, simde_mm512_sub_pd(t, a));
+    al = simde_mm512_sub_pd(a, ah);
+    t = simde_mm512_mul_pd(b, split);
+    bh = simde_mm512_sub_pd(t, simde_mm512_sub_pd(t, b));
+    bl = simde_mm512_sub_pd(b, bh);
+
+    r = simde_mm512_sub_pd(simde_mm512_mul_pd(ah, bh), p);
+    r = simde_mm512_add_pd(r, simde_mm512_mul_pd(ah, bl));
+    r = simde_mm512_add_pd(r, simde_mm512_mul_pd(al, bh));
+    return simde_mm512_add_pd(r, simde_mm512_mul_pd(al, bl));
+  #endif
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_x_mm_pow_ps_fixup_ (simde__m128 a, simde__m128 b, simde__m128 r) {
+  /* r is pow(|a|, b); apply the sign and the C99 special cases.  b is an
+   * integer iff rounding it is a no-op, and odd iff b / 2 isn't an integer.
+   * Everything >= 2^23 is an integer and everything >= 2^24 is even, so
+   * clamping keeps the (x + 2^23) - 2^23 rounding trick valid. */
+  const simde__m128 lim = simde_mm_set1_ps(SIMDE_FLOAT32_C(8388608.0));
+  const simde__m128 one = simde_mm_set1_ps(SIMDE_FLOAT32_C(1.0));
+  simde__m128 odd, not_int;
+  simde__m128 ax, bx, v, h;
+
+  ax = simde_x_mm_abs_ps(a);
+  bx = simde_x_mm_abs_ps(b);
+  v = simde_mm_min_ps(lim, bx);
+  h = simde_mm_mul_ps(simde_mm_min_ps(simde_mm_set1_ps(SIMDE_FLOAT32_C(16777216.0)), bx), simde_mm_set1_ps(SIMDE_FLOAT32_C(0.5)));
+  odd = simde_mm_cmp_ps(simde_mm_sub_ps(simde_mm_add_ps(h, lim), lim), h, SIMDE_CMP_NEQ_OQ);
+  odd = simde_mm_and_ps(odd, simde_mm_cmp_ps(simde_mm_sub_ps(simde_mm_add_ps(v, lim), lim), v, SIMDE_CMP_EQ_OQ));
+  not_int = simde_mm_cmp_ps(simde_mm_sub_ps(simde_mm_add_ps(v, lim), lim), v, SIMDE_CMP_NEQ_OQ);
+
+  /* pow(-x, odd) = -pow(x, odd), pow(-x, non-integer) = NaN for finite x */
+  r = simde_mm_blendv_ps(r, simde_mm_or_ps(r, simde_mm_and_ps(a, simde_mm_set1_ps(SIMDE_FLOAT32_C(-0.0)))), odd);
+  not_int = simde_mm_and_ps(not_int, simde_mm_cmp_ps(a, simde_mm_setzero_ps(), SIMDE_CMP_LT_OQ));
+  not_int = simde_mm_and_ps(not_int, simde_mm_cmp_ps(a, simde_mm_set1_ps(-SIMDE_MATH_INFINITYF), SIMDE_CMP_GT_OQ));
+  r = simde_mm_blendv_ps(r, simde_mm_set1_ps(SIMDE_MATH_NANF), not_int);
+
+  /* pow(x, +/-0) = 1, pow(1, y) = 1, pow(-1, +/-inf) = 1 */
+  r = simde_mm_blendv_ps(r, one, simde_mm_cmp_ps(b, simde_mm_setzero_ps(), SIMDE_CMP_EQ_OQ));
+  r = simde_mm_blendv_ps(r, one, simde_mm_cmp_ps(a, one, SIMDE_CMP_EQ_OQ));
+  return simde_mm_blendv_ps(r, one, simde_mm_and_ps(simde_mm_cmp_ps(ax, one, SIMDE_CMP_EQ_OQ), simde_mm_cmp_ps(bx, simde_mm_set1_ps(SIMDE_MATH_INFINITYF), SIMDE_CMP_EQ_OQ)));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_x_mm_pow_pd_fixup_ (simde__m128d a, simde__m128d b, simde__m128d r) {
+  /* r is pow(|a|, b); apply the sign and the C99 special cases.  b is an
+   * integer iff rounding it is a no-op, and odd iff b / 2 isn't an integer.
+   * Everything >= 2^52 is an integer and everything >= 2^53 is even, so
+   * clamping keeps the (x + 2^52) - 2^52 rounding trick valid. */
+  const simde__m128d lim = simde_mm_set1_pd(SIMDE_FLOAT64_C(4503599627370496.0));
+  const simde__m128d one = simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0));
+  simde__m128d odd, not_int;
+  simde__m128d ax, bx, v, h;
+
+  ax = simde_x_mm_abs_pd(a);
+  bx = simde_x_mm_abs_pd(b);
+  v = simde_mm_min_pd(lim, bx);
+  h = simde_mm_mul_pd(simde_mm_min_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(9007199254740992.0)), bx), simde_mm_set1_pd(SIMDE_FLOAT64_C(0.5)));
+  odd = simde_mm_cmp_pd(simde_mm_sub_pd(simde_mm_add_pd(h, lim), lim), h, SIMDE_CMP_NEQ_OQ);
+  odd = simde_mm_and_pd(odd, simde_mm_cmp_pd(simde_mm_sub_pd(simde_mm_add_pd(v, lim), lim), v, SIMDE_CMP_EQ_OQ));
+  not_int = simde_mm_cmp_pd(simde_mm_sub_pd(simde_mm_add_pd(v, lim), lim), v, SIMDE_CMP_NEQ_OQ);
+
+  /* pow(-x, odd) = -pow(x, odd), pow(-x, non-integer) = NaN for finite x */
+  r = simde_mm_blendv_pd(r, simde_mm_or_pd(r, simde_mm_and_pd(a, simde_mm_set1_pd(SIMDE_FLOAT64_C(-0.0)))), odd);
+  not_int = simde_mm_and_pd(not_int, simde_mm_cmp_pd(a, simde_mm_setzero_pd(), SIMDE_CMP_LT_OQ));
+  not_int = simde_mm_and_pd(not_int, simde_mm_cmp_pd(a, simde_mm_set1_pd(-SIMDE_MATH_INFINITY), SIMDE_CMP_GT_OQ));
+  r = simde_mm_blendv_pd(r, simde_mm_set1_pd(SIMDE_MATH_NAN), not_int);
+
+  /* pow(x, +/-0) = 1, pow(1, y) = 1, pow(-1, +/-inf) = 1 */
+  r = simde_mm_blendv_pd(r, one, simde_mm_cmp_pd(b, simde_mm_setzero_pd(), SIMDE_CMP_EQ_OQ));
+  r = simde_mm_blendv_pd(r, one, simde_mm_cmp_pd(a, one, SIMDE_CMP_EQ_OQ));
+  return simde_mm_blendv_pd(r, one, simde_mm_and_pd(simde_mm_cmp_pd(ax, one, SIMDE_CMP_EQ_OQ), simde_mm_cmp_pd(bx, simde_mm_set1_pd(SIMDE_MATH_INFINITY), SIMDE_CMP_EQ_OQ)));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_x_mm256_pow_ps_fixup_ (simde__m256 a, simde__m256 b, simde__m256 r) {
+  /* r is pow(|a|, b); apply the sign and the C99 special cases.  b is an
+   * integer iff rounding it is a no-op, and odd iff b / 2 isn't an integer.
+   * Everything >= 2^23 is an integer and everything >= 2^24 is even, so
+   * clamping keeps the (x + 2^23) - 2^23 rounding trick valid. */
+  const simde__m256 lim = simde_mm256_set1_ps(SIMDE_FLOAT32_C(8388608.0));
+  const simde__m256 one = simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.0));
+  simde__m256 odd, not_int;
+  simde__m256 ax, bx, v, h;
+
+  ax = simde_x_mm256_abs_ps(a);
+  bx = simde_x_mm256_abs_ps(b);
+  v = simde_mm256_min_ps(lim, bx);
+  h = simde_mm256_mul_ps(simde_mm256_min_ps(simde_mm256_set1_ps(SIMDE_FLOAT32_C(16777216.0)), bx), simde_mm256_set1_ps(SIMDE_FLOAT32_C(0.5)));
+  odd = simde_mm256_cmp_ps(simde_mm256_sub_ps(simde_mm256_add_ps(h, lim), lim), h, SIMDE_CMP_NEQ_OQ);
+  odd = simde_mm256_and_ps(odd, simde_mm256_cmp_ps(simde_mm256_sub_ps(simde_mm256_add_ps(v, lim), lim), v, SIMDE_CMP_EQ_OQ));
+  not_int = simde_mm256_cmp_ps(simde_mm256_sub_ps(simde_mm256_add_ps(v, lim), lim), v, SIMDE_CMP_NEQ_OQ);
+
+  /* pow(-x, odd) = -pow(x, odd), pow(-x, non-integer) = NaN for finite x */
+  r = simde_mm256_blendv_ps(r, simde_mm256_or_ps(r, simde_mm256_and_ps(a, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-0.0)))), odd);
+  not_int = simde_mm256_and_ps(not_int, simde_mm256_cmp_ps(a, simde_mm256_setzero_ps(), SIMDE_CMP_LT_OQ));
+  not_int = simde_mm256_and_ps(not_int, simde_mm256_cmp_ps(a, simde_mm256_set1_ps(-SIMDE_MATH_INFINITYF), SIMDE_CMP_GT_OQ));
+  r = simde_mm256_blendv_ps(r, simde_mm256_set1_ps(SIMDE_MATH_NANF), not_int);
+
+  /* pow(x, +/-0) = 1, pow(1, y) = 1, pow(-1, +/-inf) = 1 */
+  r = simde_mm256_blendv_ps(r, one, simde_mm256_cmp_ps(b, simde_mm256_setzero_ps(), SIMDE_CMP_EQ_OQ));
+  r = simde_mm256_blendv_ps(r, one, simde_mm256_cmp_ps(a, one, SIMDE_CMP_EQ_OQ));
+  return simde_mm256_blendv_ps(r, one, simde_mm256_and_ps(simde_mm256_cmp_ps(ax, one, SIMDE_CMP_EQ_OQ), simde_mm256_cmp_ps(bx, simde_mm256_set1_ps(SIMDE_MATH_INFINITYF), SIMDE_CMP_EQ_OQ)));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256d
+simde_x_mm256_pow_pd_fixup_ (simde__m256d a, simde__m256d b, simde__m256d r) {
+  /* r is pow(|a|, b); apply the sign and the C99 special cases.  b is an
+   * integer iff rounding it is a no-op, and odd iff b / 2 isn't an integer.
+   * Everything >= 2^52 is an integer and everything >= 2^53 is even, so
+   * clamping keeps the (x + 2^52) - 2^52 rounding trick valid. */
+  const simde__m256d lim = simde_mm256_set1_pd(SIMDE_FLOAT64_C(4503599627370496.0));
+  const simde__m256d one = simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.0));
+  simde__m256d odd, not_int;
+  simde__m256d ax, bx, v, h;
+
+  ax = simde_x_mm256_abs_pd(a);
+  bx = simde_x_mm256_abs_pd(b);
+  v = simde_mm256_min_pd(lim, bx);
+  h = simde_mm256_mul_pd(simde_mm256_min_pd(simde_mm256_set1_pd(SIMDE_FLOAT64_C(9007199254740992.0)), bx), simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.5)));
+  odd = simde_mm256_cmp_pd(simde_mm256_sub_pd(simde_mm256_add_pd(h, lim), lim), h, SIMDE_CMP_NEQ_OQ);
+  odd = simde_mm256_and_pd(odd, simde_mm256_cmp_pd(simde_mm256_sub_pd(simde_mm256_add_pd(v, lim), lim), v, SIMDE_CMP_EQ_OQ));
+  not_int = simde_mm256_cmp_pd(simde_mm256_sub_pd(simde_mm256_add_pd(v, lim), lim), v, SIMDE_CMP_NEQ_OQ);
+
+  /* pow(-x, odd) = -pow(x, odd), pow(-x, non-integer) = NaN for finite x */
+  r = simde_mm256_blendv_pd(r, simde_mm256_or_pd(r, simde_mm256_and_pd(a, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-0.0)))), odd);
+  not_int = simde_mm256_and_pd(not_int, simde_mm256_cmp_pd(a, simde_mm256_setzero_pd(), SIMDE_CMP_LT_OQ));
+  not_int = simde_mm256_and_pd(not_int, simde_mm256_cmp_pd(a, simde_mm256_set1_pd(-SIMDE_MATH_INFINITY), SIMDE_CMP_GT_OQ));
+  r = simde_mm256_blendv_pd(r, simde_mm256_set1_pd(SIMDE_MATH_NAN), not_int);
+
+  /* pow(x, +/-0) = 1, pow(1, y) = 1, pow(-1, +/-inf) = 1 */
+  r = simde_mm256_blendv_pd(r, one, simde_mm256_cmp_pd(b, simde_mm256_setzero_pd(), SIMDE_CMP_EQ_OQ));
+  r = simde_mm256_blendv_pd(r, one, simde_mm256_cmp_pd(a, one, SIMDE_CMP_EQ_OQ));
+  return simde_mm256_blendv_pd(r, one, simde_mm256_and_pd(simde_mm256_cmp_pd(ax, one, SIMDE_CMP_EQ_OQ), simde_mm256_cmp_pd(bx, simde_mm256_set1_pd(SIMDE_MATH_INFINITY), SIMDE_CMP_EQ_OQ)));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_x_mm512_pow_ps_fixup_ (simde__m512 a, simde__m512 b, simde__m512 r) {
+  /* r is pow(|a|, b); apply the sign and the C99 special cases.  b is an
+   * integer iff rounding it is a no-op, and odd iff b / 2 isn't an integer.
+   * Everything >= 2^23 is an integer and everything >= 2^24 is even, so
+   * clamping keeps the (x + 2^23) - 2^23 rounding trick valid. */
+  const simde__m512 lim = simde_mm512_set1_ps(SIMDE_FLOAT32_C(8388608.0));
+  const simde__m512 one = simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.0));
+  simde__mmask16 odd, not_int;
+  simde__m512 ax, bx, v, h;
+
+  ax = simde_mm512_abs_ps(a);
+  bx = simde_mm512_abs_ps(b);
+  v = simde_mm512_min_ps(lim, bx);
+  h = simde_mm512_mul_ps(simde_mm512_min_ps(simde_mm512_set1_ps(SIMDE_FLOAT32_C(16777216.0)), bx), simde_mm512_set1_ps(SIMDE_FLOAT32_C(0.5)));
+  odd = simde_mm512_cmp_ps_mask(simde_mm512_sub_ps(simde_mm512_add_ps(h, lim), lim), h, SIMDE_CMP_NEQ_OQ);
+  odd = HEDLEY_STATIC_CAST(simde__mmask16, odd & simde_mm512_cmp_ps_mask(simde_mm512_sub_ps(simde_mm512_add_ps(v, lim), lim), v, SIMDE_CMP_EQ_OQ));
+  not_int = simde_mm512_cmp_ps_mask(simde_mm512_sub_ps(simde_mm512_add_ps(v, lim), lim), v, SIMDE_CMP_NEQ_OQ);
+
+  /* pow(-x, odd) = -pow(x, odd), pow(-x, non-integer) = NaN for finite x */
+  r = simde_mm512_mask_mov_ps(r, odd, simde_mm512_or_ps(r, simde_mm512_and_ps(a, simde_mm512_set1_ps(SIMDE_FLOAT32_C(-0.0)))));
+  not_int = HEDLEY_STATIC_CAST(simde__mmask16, not_int & simde_mm512_cmp_ps_mask(a, simde_mm512_setzero_ps(), SIMDE_CMP_LT_OQ));
+  not_int = HEDLEY_STATIC_CAST(simde__mmask16, not_int & simde_mm512_cmp_ps_mask(a, simde_mm512_set1_ps(-SIMDE_MATH_INFINITYF), SIMDE_CMP_GT_OQ));
+  r = simde_mm512_mask_mov_ps(r, not_int, simde_mm512_set1_ps(SIMDE_MATH_NANF));
+
+  /* pow(x, +/-0) = 1, pow(1, y) = 1, pow(-1, +/-inf) = 1 */
+  r = simde_mm512_mask_mov_ps(r, simde_mm512_cmp_ps_mask(b, simde_mm512_setzero_ps(), SIMDE_CMP_EQ_OQ), one);
+  r = simde_mm512_mask_mov_ps(r, simde_mm512_cmp_ps_mask(a, one, SIMDE_CMP_EQ_OQ), one);
+  return simde_mm512_mask_mov_ps(r, HEDLEY_STATIC_CAST(simde__mmask16, simde_mm512_cmp_ps_mask(ax, one, SIMDE_CMP_EQ_OQ) & simde_mm512_cmp_ps_mask(bx, simde_mm512_set1_ps(SIMDE_MATH_INFINITYF), SIMDE_CMP_EQ_OQ)), one);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_x_mm512_pow_pd_fixup_ (simde__m512d a, simde__m512d b, simde__m512d r) {
+  /* r is pow(|a|, b); apply the sign and the C99 special cases.  b is an
+   * integer iff rounding it is a no-op, and odd iff b / 2 isn't an integer.
+   * Everything >= 2^52 is an integer and everything >= 2^53 is even, so
+   * clamping keeps the (x + 2^52) - 2^52 rounding trick valid. */
+  const simde__m512d lim = simde_mm512_set1_pd(SIMDE_FLOAT64_C(4503599627370496.0));
+  const simde__m512d one = simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.0));
+  simde__mmask8 odd, not_int;
+  simde__m512d ax, bx, v, h;
+
+  ax = simde_mm512_abs_pd(a);
+  bx = simde_mm512_abs_pd(b);
+  v = simde_mm512_min_pd(lim, bx);
+  h = simde_mm512_mul_pd(simde_mm512_min_pd(simde_mm512_set1_pd(SIMDE_FLOAT64_C(9007199254740992.0)), bx), simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.5)));
+  odd = simde_mm512_cmp_pd_mask(simde_mm512_sub_pd(simde_mm512_add_pd(h, lim), lim), h, SIMDE_CMP_NEQ_OQ);
+  odd = HEDLEY_STATIC_CAST(simde__mmask8, odd & simde_mm512_cmp_pd_mask(simde_mm512_sub_pd(simde_mm512_add_pd(v, lim), lim), v, SIMDE_CMP_EQ_OQ));
+  not_int = simde_mm512_cmp_pd_mask(simde_mm512_sub_pd(simde_mm512_add_pd(v, lim), lim), v, SIMDE_CMP_NEQ_OQ);
+
+  /* pow(-x, odd) = -pow(x, odd), pow(-x, non-integer) = NaN for finite x */
+  r = simde_mm512_mask_mov_pd(r, odd, simde_mm512_or_pd(r, simde_mm512_and_pd(a, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-0.0)))));
+  not_int = HEDLEY_STATIC_CAST(simde__mmask8, not_int & simde_mm512_cmp_pd_mask(a, simde_mm512_setzero_pd(), SIMDE_CMP_LT_OQ));
+  not_int = HEDLEY_STATIC_CAST(simde__mmask8, not_int & simde_mm512_cmp_pd_mask(a, simde_mm512_set1_pd(-SIMDE_MATH_INFINITY), SIMDE_CMP_GT_OQ));
+  r = simde_mm512_mask_mov_pd(r, not_int, simde_mm512_set1_pd(SIMDE_MATH_NAN));
+
+  /* pow(x, +/-0) = 1, pow(1, y) = 1, pow(-1, +/-inf) = 1 */
+  r = simde_mm512_mask_mov_pd(r, simde_mm512_cmp_pd_mask(b, simde_mm512_setzero_pd(), SIMDE_CMP_EQ_OQ), one);
+  r = simde_mm512_mask_mov_pd(r, simde_mm512_cmp_pd_mask(a, one, SIMDE_CMP_EQ_OQ), one);
+  return simde_mm512_mask_mov_pd(r, HEDLEY_STATIC_CAST(simde__mmask8, simde_mm512_cmp_pd_mask(ax, one, SIMDE_CMP_EQ_OQ) & simde_mm512_cmp_pd_mask(bx, simde_mm512_set1_pd(SIMDE_MATH_INFINITY), SIMDE_CMP_EQ_OQ)), one);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_x_mm_pow_ps_poly_ (simde__m128 a, simde__m128 b) {
+  /* pow(|a|, b) = exp(b * log(|a|)), in double precision so the float
+   * result is only off by the final rounding. */
+  simde__m128 ax = simde_x_mm_abs_ps(a);
+  simde__m128d lo, hi;
+
+  lo = simde_mm_mul_pd(simde_mm_cvtps_pd(b), simde_x_mm_log_pd_poly_(simde_mm_cvtps_pd(ax)));
+  hi = simde_mm_mul_pd(simde_mm_cvtps_pd(simde_mm_movehl_ps(b, b)), simde_x_mm_log_pd_poly_(simde_mm_cvtps_pd(simde_mm_movehl_ps(ax, ax))));
+  lo = simde_x_mm_exp_pd_poly_(lo);
+  hi = simde_x_mm_exp_pd_poly_(hi);
+
+  return simde_x_mm_pow_ps_fixup_(a, b, simde_mm_movelh_ps(simde_mm_cvtpd_ps(lo), simde_mm_cvtpd_ps(hi)));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_x_mm_pow_pd_poly_ (simde__m128d a, simde__m128d b) {
+  /* pow(|a|, b) = exp(b * log(|a|)), where any error in log(|a|) is scaled
+   * by b, so it's computed in double-double: |a| = m * 2^k with m in
+   * (sqrt(0.5), sqrt(2)], c = 2^(j/4) the closest pivot to m, and
+   * log(m / c) = 2 * atanh(s) with s = (m - c) / (m + c), |s| < 0.044. */
+  const simde__m128d one = simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0));
+  simde__m128d tiny, gt, m0, m1, m2, m3;
+  simde__m128d ax, x, k, m, c, lch, lcl, num, den, den_lo, s, s_lo, z, R, t, u, hi, lo, e;
+  simde__m128i bits;
+
+  ax = simde_x_mm_abs_pd(a);
+  tiny = simde_mm_cmp_pd(ax, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.2250738585072013830902e-308)), SIMDE_CMP_LT_OQ);
+  x = simde_mm_blendv_pd(ax, simde_mm_mul_pd(ax, simde_mm_set1_pd(SIMDE_FLOAT64_C(18014398509481984.0))), tiny);
+  bits = simde_mm_castpd_si128(x);
+  k = simde_mm_sub_pd(simde_mm_castsi128_pd(simde_mm_or_si128(simde_mm_srli_epi64(bits, 52), simde_mm_castpd_si128(simde_mm_set1_pd(SIMDE_FLOAT64_C(4503599627370496.0))))), simde_mm_set1_pd(SIMDE_FLOAT64_C(4503599627371519.0)));
+  k = simde_mm_sub_pd(k, simde_mm_and_pd(tiny, simde_mm_set1_pd(SIMDE_FLOAT64_C(54.0))));
+  m = simde_mm_castsi128_pd(simde_mm_or_si128(simde_mm_and_si128(bits, simde_mm_set1_epi64x(INT64_C(0x000fffffffffffff))), simde_mm_set1_epi64x(INT64_C(0x3ff0000000000000))));
+  gt = simde_mm_cmp_pd(m, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.41421356237309504880)), SIMDE_CMP_GT_OQ);
+  m = simde_mm_blendv_pd(m, simde_mm_mul_pd(m, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.5))), gt);
+  k = simde_mm_add_pd(k, simde_mm_and_pd(gt, one));
+
+  /* c = 2^(j/4) for j in [-2, 2], and log(c) as a double-double */
+  m0 = simde_mm_cmp_pd(m, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.7711054127039704)), SIMDE_CMP_LT_OQ);
+  m1 = simde_mm_cmp_pd(m, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.9170040432046712)), SIMDE_CMP_LT_OQ);
+  m2 = simde_mm_cmp_pd(m, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0905077326652577)), SIMDE_CMP_LT_OQ);
+  m3 = simde_mm_cmp_pd(m, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.2968395546510096)), SIMDE_CMP_LT_OQ);
+  c = simde_mm_blendv_pd(simde_mm_blendv_pd(simde_mm_blendv_pd(simde_mm_blendv_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(1.41421356237309504880)), simde_mm_set1_pd(SIMDE_FLOAT64_C(1.189207115002721)), m3), one, m2), simde_mm_set1_pd(SIMDE_FLOAT64_C(0.8408964152537145)), m1), simde_mm_set1_pd(SIMDE_FLOAT64_C(0.70710678118654752440)), m0);
+  lch = simde_mm_blendv_pd(simde_mm_blendv_pd(simde_mm_blendv_pd(simde_mm_blendv_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(0.3465735902799727)), simde_mm_set1_pd(SIMDE_FLOAT64_C(0.1732867951399863)), m3), simde_mm_setzero_pd(), m2), simde_mm_set1_pd(SIMDE_FLOAT64_C(-0.17328679513998638)), m1), simde_mm_set1_pd(SIMDE_FLOAT64_C(-0.3465735902799726)), m0);
+  lcl = simde_mm_blendv_pd(simde_mm_blendv_pd(simde_mm_blendv_pd(simde_mm_blendv_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(2.4442169414592898e-17)), simde_mm_set1_pd(SIMDE_FLOAT64_C(6.856931399313918e-20)), m3), simde_mm_setzero_pd(), m2), simde_mm_set1_pd(SIMDE_FLOAT64_C(9.61928934371463e-19)), m1), simde_mm_set1_pd(SIMDE_FLOAT64_C(1.2517012761299022e-18)), m0);
+
+  /* s + s_lo = (m - c) / (m + c); m - c is exact, m + c is a two-sum */
+  num = simde_mm_sub_pd(m, c);
+  den = simde_mm_add_pd(m, c);
+  t = simde_mm_sub_pd(den, m);
+  den_lo = simde_mm_add_pd(simde_mm_sub_pd(m, simde_mm_sub_pd(den, t)), simde_mm_sub_pd(c, t));
+  s = simde_mm_div_pd(num, den);
+  t = simde_mm_mul_pd(s, den);
+  s_lo = simde_mm_sub_pd(simde_mm_sub_pd(num, t), simde_x_mm_mul_err_pd_(s, den, t));
+  s_lo = simde_mm_div_pd(simde_mm_fnmadd_pd(s, den_lo, s_lo), den);
+
+  /* log(m / c) = 2s + s * R(s^2) */
+  z = simde_mm_mul_pd(s, s);
+  R = simde_mm_set1_pd(SIMDE_FLOAT64_C(0.15384615384615384615));
+  R = simde_mm_fmadd_pd(R, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.18181818181818181818)));
+  R = simde_mm_fmadd_pd(R, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.22222222222222222222)));
+  R = simde_mm_fmadd_pd(R, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.28571428571428571429)));
+  R = simde_mm_fmadd_pd(R, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.4)));
+  R = simde_mm_fmadd_pd(R, z, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.66666666666666666667)));
+  R = simde_mm_mul_pd(R, z);
+
+  /* hi + lo = k * ln2_hi + log(c)_hi + 2s, using two-sums ... */
+  t = simde_mm_mul_pd(k, simde_mm_set1_pd(SIMDE_FLOAT64_C(6.93147180369123816490e-01)));
+  hi = simde_mm_add_pd(t, lch);
+  u = simde_mm_sub_pd(hi, t);
+  lo = simde_mm_add_pd(simde_mm_sub_pd(t, simde_mm_sub_pd(hi, u)), simde_mm_sub_pd(lch, u));
+  t = hi;
+  s = simde_mm_add_pd(s, s);
+  hi = simde_mm_add_pd(t, s);
+  u = simde_mm_sub_pd(hi, t);
+  lo = simde_mm_add_pd(lo, simde_mm_add_pd(simde_mm_sub_pd(t, simde_mm_sub_pd(hi, u)), simde_mm_sub_pd(s, u)));
+
+  /* ... plus the low-order terms */
+  lo = simde_mm_add_pd(lo, simde_mm_fmadd_pd(k, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.90821492927058770002e-10)), lcl));
+  lo = simde_mm_add_pd(lo, simde_mm_fmadd_pd(s, simde_mm_mul_pd(R, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.5))), simde_mm_add_pd(s_lo, s_lo)));
+  t = simde_mm_add_pd(hi, lo);
+  lo = simde_mm_sub_pd(lo, simde_mm_sub_pd(t, hi));
+  hi = t;
+
+  /* log(inf) = inf, log(0) = -inf, log(NaN) = NaN */
+  hi = simde_mm_blendv_pd(hi, ax, simde_mm_cmp_pd(ax, simde_mm_set1_pd(SIMDE_MATH_INFINITY), SIMDE_CMP_NLT_UQ));
+  hi = simde_mm_blendv_pd(hi, simde_mm_set1_pd(-SIMDE_MATH_INFINITY), simde_mm_cmp_pd(ax, simde_mm_setzero_pd(), SIMDE_CMP_EQ_OQ));
+
+  /* exp(b * (hi + lo)) ~= e + e * (b * lo + err(b * hi)), e = exp(b * hi);
+   * the correction is dropped wherever it isn't finite. */
+  t = simde_mm_mul_pd(b, hi);
+  u = simde_mm_fmadd_pd(b, lo, simde_x_mm_mul_err_pd_(b, hi, t));
+  e = simde_x_mm_exp_pd_poly_(t);
+  t = simde_mm_fmadd_pd(e, u, e);
+  t = simde_mm_blendv_pd(t, e, simde_mm_cmp_pd(t, t, SIMDE_CMP_UNORD_Q));
+
+  return simde_x_mm_pow_pd_fixup_(a, b, t);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_x_mm256_pow_ps_poly_ (simde__m256 a, simde__m256 b) {
+  /* pow(|a|, b) = exp(b * log(|a|)), in double precision so the float
+   * result is only off by the final rounding. */
+  simde__m256 ax = simde_x_mm256_abs_ps(a);
+  simde__m256d lo, hi;
+
+  lo = simde_mm256_mul_pd(simde_mm256_cvtps_pd(simde_mm256_castps256_ps128(b)), simde_x_mm256_log_pd_poly_(simde_mm256_cvtps_pd(simde_mm256_castps256_ps128(ax))));
+  hi = simde_mm256_mul_pd(simde_mm256_cvtps_pd(simde_mm256_extractf128_ps(b, 1)), simde_x_mm256_log_pd_poly_(simde_mm256_cvtps_pd(simde_mm256_extractf128_ps(ax, 1))));
+  lo = simde_x_mm256_exp_pd_poly_(lo);
+  hi = simde_x_mm256_exp_pd_poly_(hi);
+
+  return simde_x_mm256_pow_ps_fixup_(a, b, simde_mm256_set_m128(simde_mm256_cvtpd_ps(hi), simde_mm256_cvtpd_ps(lo)));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256d
+simde_x_mm256_pow_pd_poly_ (simde__m256d a, simde__m256d b) {
+  /* pow(|a|, b) = exp(b * log(|a|)), where any error in log(|a|) is scaled
+   * by b, so it's computed in double-double: |a| = m * 2^k with m in
+   * (sqrt(0.5), sqrt(2)], c = 2^(j/4) the closest pivot to m, and
+   * log(m / c) = 2 * atanh(s) with s = (m - c) / (m + c), |s| < 0.044. */
+  const simde__m256d one = simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.0));
+  simde__m256d tiny, gt, m0, m1, m2, m3;
+  simde__m256d ax, x, k, m, c, lch, lcl, num, den, den_lo, s, s_lo, z, R, t, u, hi, lo, e;
+  simde__m256i bits;
+
+  ax = simde_x_mm256_abs_pd(a);
+  tiny = simde_mm256_cmp_pd(ax, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.2250738585072013830902e-308)), SIMDE_CMP_LT_OQ);
+  x = simde_mm256_blendv_pd(ax, simde_mm256_mul_pd(ax, simde_mm256_set1_pd(SIMDE_FLOAT64_C(18014398509481984.0))), tiny);
+  bits = simde_mm256_castpd_si256(x);
+  k = simde_mm256_sub_pd(simde_mm256_castsi256_pd(simde_mm256_or_si256(simde_mm256_srli_epi64(bits, 52), simde_mm256_castpd_si256(simde_mm256_set1_pd(SIMDE_FLOAT64_C(4503599627370496.0))))), simde_mm256_set1_pd(SIMDE_FLOAT64_C(4503599627371519.0)));
+  k = simde_mm256_sub_pd(k, simde_mm256_and_pd(tiny, simde_mm256_set1_pd(SIMDE_FLOAT64_C(54.0))));
+  m = simde_mm256_castsi256_pd(simde_mm256_or_si256(simde_mm256_and_si256(bits, simde_mm256_set1_epi64x(INT64_C(0x000fffffffffffff))), simde_mm256_set1_epi64x(INT64_C(0x3ff0000000000000))));
+  gt = simde_mm256_cmp_pd(m, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.41421356237309504880)), SIMDE_CMP_GT_OQ);
+  m = simde_mm256_blendv_pd(m, simde_mm256_mul_pd(m, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.5))), gt);
+  k = simde_mm256_add_pd(k, simde_mm256_and_pd(gt, one));
+
+  /* c = 2^(j/4) for j in [-2, 2], and log(c) as a double-double */
+  m0 = simde_mm256_cmp_pd(m, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.7711054127039704)), SIMDE_CMP_LT_OQ);
+  m1 = simde_mm256_cmp_pd(m, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.9170040432046712)), SIMDE_CMP_LT_OQ);
+  m2 = simde_mm256_cmp_pd(m, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.0905077326652577)), SIMDE_CMP_LT_OQ);
+  m3 = simde_mm256_cmp_pd(m, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.2968395546510096)), SIMDE_CMP_LT_OQ);
+  c = simde_mm256_blendv_pd(simde_mm256_blendv_pd(simde_mm256_blendv_pd(simde_mm256_blendv_pd(simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.41421356237309504880)), simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.189207115002721)), m3), one, m2), simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.8408964152537145)), m1), simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.70710678118654752440)), m0);
+  lch = simde_mm256_blendv_pd(simde_mm256_blendv_pd(simde_mm256_blendv_pd(simde_mm256_blendv_pd(simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.3465735902799727)), simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.1732867951399863)), m3), simde_mm256_setzero_pd(), m2), simde_mm256_set1_pd(SIMDE_FLOAT64_C(-0.17328679513998638)), m1), simde_mm256_set1_pd(SIMDE_FLOAT64_C(-0.3465735902799726)), m0);
+  lcl = simde_mm256_blendv_pd(simde_mm256_blendv_pd(simde_mm256_blendv_pd(simde_mm256_blendv_pd(simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.4442169414592898e-17)), simde_mm256_set1_pd(SIMDE_FLOAT64_C(6.856931399313918e-20)), m3), simde_mm256_setzero_pd(), m2), simde_mm256_set1_pd(SIMDE_FLOAT64_C(9.61928934371463e-19)), m1), simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.2517012761299022e-18)), m0);
+
+  /* s + s_lo = (m - c) / (m + c); m - c is exact, m + c is a two-sum */
+  num = simde_mm256_sub_pd(m, c);
+  den = simde_mm256_add_pd(m, c);
+  t = simde_mm256_sub_pd(den, m);
+  den_lo = simde_mm256_add_pd(simde_mm256_sub_pd(m, simde_mm256_sub_pd(den, t)), simde_mm256_sub_pd(c, t));
+  s = simde_mm256_div_pd(num, den);
+  t = simde_mm256_mul_pd(s, den);
+  s_lo = simde_mm256_sub_pd(simde_mm256_sub_pd(num, t), simde_x_mm256_mul_err_pd_(s, den, t));
+  s_lo = simde_mm256_div_pd(simde_mm256_fnmadd_pd(s, den_lo, s_lo), den);
+
+  /* log(m / c) = 2s + s * R(s^2) */
+  z = simde_mm256_mul_pd(s, s);
+  R = simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.15384615384615384615));
+  R = simde_mm256_fmadd_pd(R, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.18181818181818181818)));
+  R = simde_mm256_fmadd_pd(R, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.22222222222222222222)));
+  R = simde_mm256_fmadd_pd(R, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.28571428571428571429)));
+  R = simde_mm256_fmadd_pd(R, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.4)));
+  R = simde_mm256_fmadd_pd(R, z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.66666666666666666667)));
+  R = simde_mm256_mul_pd(R, z);
+
+  /* hi + lo = k * ln2_hi + log(c)_hi + 2s, using two-sums ... */
+  t = simde_mm256_mul_pd(k, simde_mm256_set1_pd(SIMDE_FLOAT64_C(6.93147180369123816490e-01)));
+  hi = simde_mm256_add_pd(t, lch);
+  u = simde_mm256_sub_pd(hi, t);
+  lo = simde_mm256_add_pd(simde_mm256_sub_pd(t, simde_mm256_sub_pd(hi, u)), simde_mm256_sub_pd(lch, u));
+  t = hi;
+  s = simde_mm256_add_pd(s, s);
+  hi = simde_mm256_add_pd(t, s);
+  u = simde_mm256_sub_pd(hi, t);
+  lo = simde_mm256_add_pd(lo, simde_mm256_add_pd(simde_mm256_sub_pd(t, simde_mm256_sub_pd(hi, u)), simde_mm256_sub_pd(s, u)));
+
+  /* ... plus the low-order terms */
+  lo = simde_mm256_add_pd(lo, simde_mm256_fmadd_pd(k, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.90821492927058770002e-10)), lcl));
+  lo = simde_mm256_add_pd(lo, simde_mm256_fmadd_pd(s, simde_mm256_mul_pd(R, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.5))), simde_mm256_add_pd(s_lo, s_lo)));
+  t = simde_mm256_add_pd(hi, lo);
+  lo = simde_mm256_sub_pd(lo, simde_mm256_sub_pd(t, hi));
+  hi = t;
+
+  /* log(inf) = inf, log(0) = -inf, log(NaN) = NaN */
+  hi = simde_mm256_blendv_pd(hi, ax, simde_mm256_cmp_pd(ax, simde_mm256_set1_pd(SIMDE_MATH_INFINITY), SIMDE_CMP_NLT_UQ));
+  hi = simde_mm256_blendv_pd(hi, simde_mm256_set1_pd(-SIMDE_MATH_INFINITY), simde_mm256_cmp_pd(ax, simde_mm256_setzero_pd(), SIMDE_CMP_EQ_OQ));
+
+  /* exp(b * (hi + lo)) ~= e + e * (b * lo + err(b * hi)), e = exp(b * hi);
+   * the correction is dropped wherever it isn't finite. */
+  t = simde_mm256_mul_pd(b, hi);
+  u = simde_mm256_fmadd_pd(b, lo, simde_x_mm256_mul_err_pd_(b, hi, t));
+  e = simde_x_mm256_exp_pd_poly_(t);
+  t = simde_mm256_fmadd_pd(e, u, e);
+  t = simde_mm256_blendv_pd(t, e, simde_mm256_cmp_pd(t, t, SIMDE_CMP_UNORD_Q));
+
+  return simde_x_mm256_pow_pd_fixup_(a, b, t);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_x_mm512_pow_ps_poly_ (simde__m512 a, simde__m512 b) {
+  simde__m512_private
+    r_,
+    a_ = simde__m512_to_private(a),
+    b_ = simde__m512_to_private(b);
+
+  for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
+    r_.m256[i] = simde_x_mm256_pow_ps_poly_(a_.m256[i], b_.m256[i]);
+  }
+
+  return simde__m512_from_private(r_);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_x_mm512_pow_pd_poly_ (simde__m512d a, simde__m512d b) {
+  /* pow(|a|, b) = exp(b * log(|a|)), where any error in log(|a|) is scaled
+   * by b, so it's computed in double-double: |a| = m * 2^k with m in
+   * (sqrt(0.5), sqrt(2)], c = 2^(j/4) the closest pivot to m, and
+   * log(m / c) = 2 * atanh(s) with s = (m - c) / (m + c), |s| < 0.044. */
+  const simde__m512d one = simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.0));
+  simde__mmask8 tiny, gt, m0, m1, m2, m3;
+  simde__m512d ax, x, k, m, c, lch, lcl, num, den, den_lo, s, s_lo, z, R, t, u, hi, lo, e;
+  simde__m512i bits;
+
+  ax = simde_mm512_abs_pd(a);
+  tiny = simde_mm512_cmp_pd_mask(ax, simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.2250738585072013830902e-308)), SIMDE_CMP_LT_OQ);
+  x = simde_mm512_mask_mov_pd(ax, tiny, simde_mm512_mul_pd(ax, simde_mm512_set1_pd(SIMDE_FLOAT64_C(18014398509481984.0))));
+  bits = simde_mm512_castpd_si512(x);
+  k = simde_mm512_sub_pd(simde_mm512_castsi512_pd(simde_mm512_or_si512(simde_mm512_srli_epi64(bits, 52), simde_mm512_castpd_si512(simde_mm512_set1_pd(SIMDE_FLOAT64_C(4503599627370496.0))))), simde_mm512_set1_pd(SIMDE_FLOAT64_C(4503599627371519.0)));
+  k = simde_mm512_sub_pd(k, simde_mm512_maskz_mov_pd(tiny, simde_mm512_set1_pd(SIMDE_FLOAT64_C(54.0))));
+  m = simde_mm512_castsi512_pd(simde_mm512_or_si512(simde_mm512_and_si512(bits, simde_mm512_set1_epi64(INT64_C(0x000fffffffffffff))), simde_mm512_set1_epi64(INT64_C(0x3ff0000000000000))));
+  gt = simde_mm512_cmp_pd_mask(m, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.41421356237309504880)), SIMDE_CMP_GT_OQ);
+  m = simde_mm512_mask_mov_pd(m, gt, simde_mm512_mul_pd(m, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.5))));
+  k = simde_mm512_add_pd(k, simde_mm512_maskz_mov_pd(gt, one));
+
+  /* c = 2^(j/4) for j in [-2, 2], and log(c) as a double-double */
+  m0 = simde_mm512_cmp_pd_mask(m, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.7711054127039704)), SIMDE_CMP_LT_OQ);
+  m1 = simde_mm512_cmp_pd_mask(m, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.9170040432046712)), SIMDE_CMP_LT_OQ);
+  m2 = simde_mm512_cmp_pd_mask(m, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.0905077326652577)), SIMDE_CMP_LT_OQ);
+  m3 = simde_mm512_cmp_pd_mask(m, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.2968395546510096)), SIMDE_CMP_LT_OQ);
+  c = simde_mm512_mask_mov_pd(simde_mm512_mask_mov_pd(simde_mm512_mask_mov_pd(simde_mm512_mask_mov_pd(simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.41421356237309504880)), m3, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.189207115002721))), m2, one), m1, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.8408964152537145))), m0, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.70710678118654752440)));
+  lch = simde_mm512_mask_mov_pd(simde_mm512_mask_mov_pd(simde_mm512_mask_mov_pd(simde_mm512_mask_mov_pd(simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.3465735902799727)), m3, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.1732867951399863))), m2, simde_mm512_setzero_pd()), m1, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-0.17328679513998638))), m0, simde_mm512_set1_pd(SIMDE_FLOAT64_C(-0.3465735902799726)));
+  lcl = simde_mm512_mask_mov_pd(simde_mm512_mask_mov_pd(simde_mm512_mask_mov_pd(simde_mm512_mask_mov_pd(simde_mm512_set1_pd(SIMDE_FLOAT64_C(2.4442169414592898e-17)), m3, simde_mm512_set1_pd(SIMDE_FLOAT64_C(6.856931399313918e-20))), m2, simde_mm512_setzero_pd()), m1, simde_mm512_set1_pd(SIMDE_FLOAT64_C(9.61928934371463e-19))), m0, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.2517012761299022e-18)));
+
+  /* s + s_lo = (m - c) / (m + c); m - c is exact, m + c is a two-sum */
+  num = simde_mm512_sub_pd(m, c);
+  den = simde_mm512_add_pd(m, c);
+  t = simde_mm512_sub_pd(den, m);
+  den_lo = simde_mm512_add_pd(simde_mm512_sub_pd(m, simde_mm512_sub_pd(den, t)), simde_mm512_sub_pd(c, t));
+  s = simde_mm512_div_pd(num, den);
+  t = simde_mm512_mul_pd(s, den);
+  s_lo = simde_mm512_sub_pd(simde_mm512_sub_pd(num, t), simde_x_mm512_mul_err_pd_(s, den, t));
+  s_lo = simde_mm512_div_pd(simde_mm512_fnmadd_pd(s, den_lo, s_lo), den);
+
+  /* log(m / c) = 2s + s * R(s^2) */
+  z = simde_mm512_mul_pd(s, s);
+  R = simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.15384615384615384615));
+  R = simde_mm512_fmadd_pd(R, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.18181818181818181818)));
+  R = simde_mm512_fmadd_pd(R, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.22222222222222222222)));
+  R = simde_mm512_fmadd_pd(R, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.28571428571428571429)));
+  R = simde_mm512_fmadd_pd(R, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.4)));
+  R = simde_mm512_fmadd_pd(R, z, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.66666666666666666667)));
+  R = simde_mm512_mul_pd(R, z);
+
+  /* hi + lo = k * ln2_hi + log(c)_hi + 2s, using two-sums ... */
+  t = simde_mm512_mul_pd(k, simde_mm512_set1_pd(SIMDE_FLOAT64_C(6.93147180369123816490e-01)));
+  hi = simde_mm512_add_pd(t, lch);
+  u = simde_mm512_sub_pd(hi, t);
+  lo = simde_mm512_add_pd(simde_mm512_sub_pd(t, simde_mm512_sub_pd(hi, u)), simde_mm512_sub_pd(lch, u));
+  t = hi;
+  s = simde_mm512_add_pd(s, s);
+  hi = simde_mm512_add_pd(t, s);
+  u = simde_mm512_sub_pd(hi, t);
+  lo = simde_mm512_add_pd(lo, simde_mm512_add_pd(simde_mm512_sub_pd(t, simde_mm512_sub_pd(hi, u)), simde_mm512_sub_pd(s, u)));
+
+  /* ... plus the low-order terms */
+  lo = simde_mm512_add_pd(lo, simde_mm512_fmadd_pd(k, simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.90821492927058770002e-10)), lcl));
+  lo = simde_mm512_add_pd(lo, simde_mm512_fmadd_pd(s, simde_mm512_mul_pd(R, simde_mm512_set1_pd(SIMDE_FLOAT64_C(0.5))), simde_mm512_add_pd(s_lo, s_lo)));
+  t = simde_mm512_add_pd(hi, lo);
+  lo = simde_mm512_sub_pd(lo, simde_mm512_sub_pd(t, hi));
+  hi = t;
+
+  /* log(inf) = inf, log(0) = -inf, log(NaN) = NaN */
+  hi = simde_mm512_mask_mov_pd(hi, simde_mm512_cmp_pd_mask(ax, simde_mm512_set1_pd(SIMDE_MATH_INFINITY), SIMDE_CMP_NLT_UQ), ax);
+  hi = simde_mm512_mask_mov_pd(hi, simde_mm512_cmp_pd_mask(ax, simde_mm512_setzero_pd(), SIMDE_CMP_EQ_OQ), simde_mm512_set1_pd(-SIMDE_MATH_INFINITY));
+
+  /* exp(b * (hi + lo)) ~= e + e * (b * lo + err(b * hi)), e = exp(b * hi);
+   * the correction is dropped wherever it isn't finite. */
+  t = simde_mm512_mul_pd(b, hi);
+  u = simde_mm512_fmadd_pd(b, lo, simde_x_mm512_mul_err_pd_(b, hi, t));
+  e = simde_x_mm512_exp_pd_poly_(t);
+  t = simde_mm512_fmadd_pd(e, u, e);
+  t = simde_mm512_mask_mov_pd(t, simde_mm512_cmp_pd_mask(t, t, SIMDE_CMP_UNORD_Q), e);
+
+  return simde_x_mm512_pow_pd_fixup_(a, b, t);
+}
+
+#endif /* defined(SIMDE_X86_SVML_POLY_) */
+
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m128
 simde_mm_acos_ps (simde__m128 a) {
@@ -1583,6 +3672,8 @@ simde_mm_cbrt_ps (simde__m128 a) {
     return _mm_cbrt_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_cbrtf4_u10(a);
+  #elif defined(SIMDE_X86_SVML_POLY_)
+    return simde_x_mm_cbrt_ps_poly_(a);
   #else
     simde__m128_private
       r_,
@@ -1608,6 +3699,8 @@ simde_mm_cbrt_pd (simde__m128d a) {
     return _mm_cbrt_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_cbrtd2_u10(a);
+  #elif defined(SIMDE_X86_SVML_POLY_)
+    return simde_x_mm_cbrt_pd_poly_(a);
   #else
     simde__m128d_private
       r_,
@@ -1633,6 +3726,8 @@ simde_mm256_cbrt_ps (simde__m256 a) {
     return _mm256_cbrt_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
     return Sleef_cbrtf8_u10(a);
+  #elif defined(SIMDE_X86_SVML_POLY_) && SIMDE_NATURAL_VECTOR_SIZE_GE(256)
+    return simde_x_mm256_cbrt_ps_poly_(a);
   #else
     simde__m256_private
       r_,
@@ -1665,6 +3760,8 @@ simde_mm256_cbrt_pd (simde__m256d a) {
     return _mm256_cbrt_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
     return Sleef_cbrtd4_u10(a);
+  #elif defined(SIMDE_X86_SVML_POLY_) && SIMDE_NATURAL_VECTOR_SIZE_GE(256)
+    return simde_x_mm256_cbrt_pd_poly_(a);
   #else
     simde__m256d_private
       r_,
@@ -1696,6 +3793,8 @@ simde_mm512_cbrt_ps (simde__m512 a) {
     return _mm512_cbrt_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return Sleef_cbrtf16_u10(a);
+  #elif defined(SIMDE_X86_SVML_POLY_) && SIMDE_NATURAL_VECTOR_SIZE_GE(512)
+    return simde_x_mm512_cbrt_ps_poly_(a);
   #else
     simde__m512_private
       r_,
@@ -1727,6 +3826,8 @@ simde_mm512_cbrt_pd (simde__m512d a) {
     return _mm512_cbrt_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return Sleef_cbrtd8_u10(a);
+  #elif defined(SIMDE_X86_SVML_POLY_) && SIMDE_NATURAL_VECTOR_SIZE_GE(512)
+    return simde_x_mm512_cbrt_pd_poly_(a);
   #else
     simde__m512d_private
       r_,
@@ -1840,6 +3941,8 @@ simde_mm_cos_ps (simde__m128 a) {
     #else
       return Sleef_cosf4_u35(a);
     #endif
+  #elif defined(SIMDE_X86_SVML_POLY_)
+    return simde_x_mm_sincostan_ps_poly_(a, SIMDE_X86_SVML_COS_);
   #else
     simde__m128_private
       r_,
@@ -1869,6 +3972,8 @@ simde_mm_cos_pd (simde__m128d a) {
     #else
       return Sleef_cosd2_u35(a);
     #endif
+  #elif defined(SIMDE_X86_SVML_POLY_)
+    return simde_x_mm_sincostan_pd_poly_(a, SIMDE_X86_SVML_COS_);
   #else
     simde__m128d_private
       r_,
@@ -1898,6 +4003,8 @@ simde_mm256_cos_ps (simde__m256 a) {
     #else
       return Sleef_cosf8_u35(a);
     #endif
+  #elif defined(SIMDE_X86_SVML_POLY_) && SIMDE_NATURAL_VECTOR_SIZE_GE(256)
+    return simde_x_mm256_sincostan_ps_poly_(a, SIMDE_X86_SVML_COS_);
   #else
     simde__m256_private
       r_,
@@ -1934,6 +4041,8 @@ simde_mm256_cos_pd (simde__m256d a) {
     #else
       return Sleef_cosd4_u35(a);
     #endif
+  #elif defined(SIMDE_X86_SVML_POLY_) && SIMDE_NATURAL_VECTOR_SIZE_GE(256)
+    return simde_x_mm256_sincostan_pd_poly_(a, SIMDE_X86_SVML_COS_);
   #else
     simde__m256d_private
       r_,
@@ -1969,6 +4078,8 @@ simde_mm512_cos_ps (simde__m512 a) {
     #else
       return Sleef_cosf16_u35(a);
     #endif
+  #elif defined(SIMDE_X86_SVML_POLY_) && SIMDE_NATURAL_VECTOR_SIZE_GE(512)
+    return simde_x_mm512_sincostan_ps_poly_(a, SIMDE_X86_SVML_COS_);
   #else
     simde__m512_private
       r_,
@@ -2004,6 +4115,8 @@ simde_mm512_cos_pd (simde__m512d a) {
     #else
       return Sleef_cosd8_u35(a);
     #endif
+  #elif defined(SIMDE_X86_SVML_POLY_) && SIMDE_NATURAL_VECTOR_SIZE_GE(512)
+    return simde_x_mm512_sincostan_pd_poly_(a, SIMDE_X86_SVML_COS_);
   #else
     simde__m512d_private
       r_,
@@ -3503,6 +5616,8 @@ simde_mm_erf_ps (simde__m128 a) {
     return _mm_erf_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_erff4_u10(a);
+  #elif defined(SIMDE_X86_SVML_POLY_)
+    return simde_x_mm_erf_ps_poly_(a);
   #else
     simde__m128_private
       r_,
@@ -3528,6 +5643,8 @@ simde_mm_erf_pd (simde__m128d a) {
     return _mm_erf_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_erfd2_u10(a);
+  #elif defined(SIMDE_X86_SVML_POLY_)
+    return simde_x_mm_erf_pd_poly_(a);
   #else
     simde__m128d_private
       r_,
@@ -3553,6 +5670,8 @@ simde_mm256_erf_ps (simde__m256 a) {
     return _mm256_erf_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
     return Sleef_erff8_u10(a);
+  #elif defined(SIMDE_X86_SVML_POLY_) && SIMDE_NATURAL_VECTOR_SIZE_GE(256)
+    return simde_x_mm256_erf_ps_poly_(a);
   #else
     simde__m256_private
       r_,
@@ -3585,6 +5704,8 @@ simde_mm256_erf_pd (simde__m256d a) {
     return _mm256_erf_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
     return Sleef_erfd4_u10(a);
+  #elif defined(SIMDE_X86_SVML_POLY_) && SIMDE_NATURAL_VECTOR_SIZE_GE(256)
+    return simde_x_mm256_erf_pd_poly_(a);
   #else
     simde__m256d_private
       r_,
@@ -3616,6 +5737,8 @@ simde_mm512_erf_ps (simde__m512 a) {
     return _mm512_erf_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return Sleef_erff16_u10(a);
+  #elif defined(SIMDE_X86_SVML_POLY_) && SIMDE_NATURAL_VECTOR_SIZE_GE(512)
+    return simde_x_mm512_erf_ps_poly_(a);
   #else
     simde__m512_private
       r_,
@@ -3647,6 +5770,8 @@ simde_mm512_erf_pd (simde__m512d a) {
     return _mm512_erf_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return Sleef_erfd8_u10(a);
+  #elif defined(SIMDE_X86_SVML_POLY_) && SIMDE_NATURAL_VECTOR_SIZE_GE(512)
+    return simde_x_mm512_erf_pd_poly_(a);
   #else
     simde__m512d_private
       r_,
@@ -3909,6 +6034,8 @@ simde_mm_exp_ps (simde__m128 a) {
     return _mm_exp_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_expf4_u10(a);
+  #elif defined(SIMDE_X86_SVML_POLY_)
+    return simde_x_mm_exp_ps_poly_(a);
   #else
     simde__m128_private
       r_,
@@ -3934,6 +6061,8 @@ simde_mm_exp_pd (simde__m128d a) {
     return _mm_exp_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_expd2_u10(a);
+  #elif defined(SIMDE_X86_SVML_POLY_)
+    return simde_x_mm_exp_pd_poly_(a);
   #else
     simde__m128d_private
       r_,
@@ -3959,6 +6088,8 @@ simde_mm256_exp_ps (simde__m256 a) {
     return _mm256_exp_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
     return Sleef_expf8_u10(a);
+  #elif defined(SIMDE_X86_SVML_POLY_) && SIMDE_NATURAL_VECTOR_SIZE_GE(256)
+    return simde_x_mm256_exp_ps_poly_(a);
   #else
     simde__m256_private
       r_,
@@ -3991,6 +6122,8 @@ simde_mm256_exp_pd (simde__m256d a) {
     return _mm256_exp_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
     return Sleef_expd4_u10(a);
+  #elif defined(SIMDE_X86_SVML_POLY_) && SIMDE_NATURAL_VECTOR_SIZE_GE(256)
+    return simde_x_mm256_exp_pd_poly_(a);
   #else
     simde__m256d_private
       r_,
@@ -4022,6 +6155,8 @@ simde_mm512_exp_ps (simde__m512 a) {
     return _mm512_exp_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return Sleef_expf16_u10(a);
+  #elif defined(SIMDE_X86_SVML_POLY_) && SIMDE_NATURAL_VECTOR_SIZE_GE(512)
+    return simde_x_mm512_exp_ps_poly_(a);
   #else
     simde__m512_private
       r_,
@@ -4053,6 +6188,8 @@ simde_mm512_exp_pd (simde__m512d a) {
     return _mm512_exp_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return Sleef_expd8_u10(a);
+  #elif defined(SIMDE_X86_SVML_POLY_) && SIMDE_NATURAL_VECTOR_SIZE_GE(512)
+    return simde_x_mm512_exp_pd_poly_(a);
   #else
     simde__m512d_private
       r_,
@@ -5540,6 +7677,8 @@ simde_mm_log_ps (simde__m128 a) {
     #else
       return Sleef_logf4_u35(a);
     #endif
+  #elif defined(SIMDE_X86_SVML_POLY_)
+    return simde_x_mm_log_ps_poly_(a);
   #else
     simde__m128_private
       r_,
@@ -5569,6 +7708,8 @@ simde_mm_log_pd (simde__m128d a) {
     #else
       return Sleef_logd2_u35(a);
     #endif
+  #elif defined(SIMDE_X86_SVML_POLY_)
+    return simde_x_mm_log_pd_poly_(a);
   #else
     simde__m128d_private
       r_,
@@ -5598,6 +7739,8 @@ simde_mm256_log_ps (simde__m256 a) {
     #else
       return Sleef_logf8_u35(a);
     #endif
+  #elif defined(SIMDE_X86_SVML_POLY_) && SIMDE_NATURAL_VECTOR_SIZE_GE(256)
+    return simde_x_mm256_log_ps_poly_(a);
   #else
     simde__m256_private
       r_,
@@ -5634,6 +7777,8 @@ simde_mm256_log_pd (simde__m256d a) {
     #else
       return Sleef_logd4_u35(a);
     #endif
+  #elif defined(SIMDE_X86_SVML_POLY_) && SIMDE_NATURAL_VECTOR_SIZE_GE(256)
+    return simde_x_mm256_log_pd_poly_(a);
   #else
     simde__m256d_private
       r_,
@@ -5669,6 +7814,8 @@ simde_mm512_log_ps (simde__m512 a) {
     #else
       return Sleef_logf16_u35(a);
     #endif
+  #elif defined(SIMDE_X86_SVML_POLY_) && SIMDE_NATURAL_VECTOR_SIZE_GE(512)
+    return simde_x_mm512_log_ps_poly_(a);
   #else
     simde__m512_private
       r_,
@@ -5704,6 +7851,8 @@ simde_mm512_log_pd (simde__m512d a) {
     #else
       return Sleef_logd8_u35(a);
     #endif
+  #elif defined(SIMDE_X86_SVML_POLY_) && SIMDE_NATURAL_VECTOR_SIZE_GE(512)
+    return simde_x_mm512_log_pd_poly_(a);
   #else
     simde__m512d_private
       r_,
@@ -8611,6 +10760,8 @@ simde_mm_pow_ps (simde__m128 a, simde__m128 b) {
     return _mm_pow_ps(a, b);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_powf4_u10(a, b);
+  #elif defined(SIMDE_X86_SVML_POLY_)
+    return simde_x_mm_pow_ps_poly_(a, b);
   #else
     simde__m128_private
       r_,
@@ -8637,6 +10788,8 @@ simde_mm_pow_pd (simde__m128d a, simde__m128d b) {
     return _mm_pow_pd(a, b);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_powd2_u10(a, b);
+  #elif defined(SIMDE_X86_SVML_POLY_)
+    return simde_x_mm_pow_pd_poly_(a, b);
   #else
     simde__m128d_private
       r_,
@@ -8663,16 +10816,24 @@ simde_mm256_pow_ps (simde__m256 a, simde__m256 b) {
     return _mm256_pow_ps(a, b);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
     return Sleef_powf8_u10(a, b);
+  #elif defined(SIMDE_X86_SVML_POLY_) && SIMDE_NATURAL_VECTOR_SIZE_GE(256)
+    return simde_x_mm256_pow_ps_poly_(a, b);
   #else
     simde__m256_private
       r_,
       a_ = simde__m256_to_private(a),
       b_ = simde__m256_to_private(b);
 
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
-      r_.f32[i] = simde_math_powf(a_.f32[i], b_.f32[i]);
-    }
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+      for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+        r_.m128[i] = simde_mm_pow_ps(a_.m128[i], b_.m128[i]);
+      }
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = simde_math_powf(a_.f32[i], b_.f32[i]);
+      }
+    #endif
 
     return simde__m256_from_private(r_);
   #endif
@@ -8690,16 +10851,24 @@ simde_mm256_pow_pd (simde__m256d a, simde__m256d b) {
     return _mm256_pow_pd(a, b);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
     return Sleef_powd4_u10(a, b);
+  #elif defined(SIMDE_X86_SVML_POLY_) && SIMDE_NATURAL_VECTOR_SIZE_GE(256)
+    return simde_x_mm256_pow_pd_poly_(a, b);
   #else
     simde__m256d_private
       r_,
       a_ = simde__m256d_to_private(a),
       b_ = simde__m256d_to_private(b);
 
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
-      r_.f64[i] = simde_math_pow(a_.f64[i], b_.f64[i]);
-    }
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+      for (size_t i = 0 ; i < (sizeof(r_.m128d) / sizeof(r_.m128d[0])) ; i++) {
+        r_.m128d[i] = simde_mm_pow_pd(a_.m128d[i], b_.m128d[i]);
+      }
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = simde_math_pow(a_.f64[i], b_.f64[i]);
+      }
+    #endif
 
     return simde__m256d_from_private(r_);
   #endif
@@ -8716,16 +10885,24 @@ simde_mm512_pow_ps (simde__m512 a, simde__m512 b) {
     return _mm512_pow_ps(a, b);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return Sleef_powf16_u10(a, b);
+  #elif defined(SIMDE_X86_SVML_POLY_) && SIMDE_NATURAL_VECTOR_SIZE_GE(512)
+    return simde_x_mm512_pow_ps_poly_(a, b);
   #else
     simde__m512_private
       r_,
       a_ = simde__m512_to_private(a),
       b_ = simde__m512_to_private(b);
 
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
-      r_.f32[i] = simde_math_powf(a_.f32[i], b_.f32[i]);
-    }
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+      for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
+        r_.m256[i] = simde_mm256_pow_ps(a_.m256[i], b_.m256[i]);
+      }
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = simde_math_powf(a_.f32[i], b_.f32[i]);
+      }
+    #endif
 
     return simde__m512_from_private(r_);
   #endif
@@ -8742,16 +10919,24 @@ simde_mm512_pow_pd (simde__m512d a, simde__m512d b) {
     return _mm512_pow_pd(a, b);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX512F_NATIVE)
     return Sleef_powd8_u10(a, b);
+  #elif defined(SIMDE_X86_SVML_POLY_) && SIMDE_NATURAL_VECTOR_SIZE_GE(512)
+    return simde_x_mm512_pow_pd_poly_(a, b);
   #else
     simde__m512d_private
       r_,
       a_ = simde__m512d_to_private(a),
       b_ = simde__m512d_to_private(b);
 
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
-      r_.f64[i] = simde_math_pow(a_.f64[i], b_.f64[i]);
-    }
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+      for (size_t i = 0 ; i < (sizeof(r_.m256d) / sizeof(r_.m256d[0])) ; i++) {
+        r_.m256d[i] = simde_mm256_pow_pd(a_.m256d[i], b_.m256d[i]);
+      }
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = simde_math_pow(a_.f64[i], b_.f64[i]);
+      }
+    #endif
 
     return simde__m512d_from_private(r_);
   #endif
@@ -9852,6 +12037,8 @@ simde_mm_sin_ps (simde__m128 a) {
     #else
       return Sleef_sinf4_u35(a);
     #endif
+  #elif defined(SIMDE_X86_SVML_POLY_)
+    return simde_x_mm_sincostan_ps_poly_(a, SIMDE_X86_SVML_SIN_);
   #else
     simde__m128_private
       r_,
@@ -9881,6 +12068,8 @@ simde_mm_sin_pd (simde__m128d a) {
     #else
       return Sleef_sind2_u35(a);
     #endif
+  #elif defined(SIMDE_X86_SVML_POLY_)
+    return simde_x_mm_sincostan_pd_poly_(a, SIMDE_X86_SVML_SIN_);
   #else
     simde__m128d_private
       r_,
@@ -9910,6 +12099,8 @@ simde_mm256_sin_ps (simde__m256 a) {
     #else
       return Sleef_sinf8_u35(a);
     #endif
+  #elif defined(SIMDE_X86_SVML_POLY_) && SIMDE_NATURAL_VECTOR_SIZE_GE(256)
+    return simde_x_mm256_sincostan_ps_poly_(a, SIMDE_X86_SVML_SIN_);
   #else
     simde__m256_private
       r_,
@@ -9946,6 +12137,8 @@ simde_mm256_sin_pd (simde__m256d a) {
     #else
       return Sleef_sind4_u35(a);
     #endif
+  #elif defined(SIMDE_X86_SVML_POLY_) && SIMDE_NATURAL_VECTOR_SIZE_GE(256)
+    return simde_x_mm256_sincostan_pd_poly_(a, SIMDE_X86_SVML_SIN_);
   #else
     simde__m256d_private
       r_,
@@ -9981,6 +12174,8 @@ simde_mm512_sin_ps (simde__m512 a) {
     #else
       return Sleef_sinf16_u35(a);
     #endif
+  #elif defined(SIMDE_X86_SVML_POLY_) && SIMDE_NATURAL_VECTOR_SIZE_GE(512)
+    return simde_x_mm512_sincostan_ps_poly_(a, SIMDE_X86_SVML_SIN_);
   #else
     simde__m512_private
       r_,
@@ -10016,6 +12211,8 @@ simde_mm512_sin_pd (simde__m512d a) {
     #else
       return Sleef_sind8_u35(a);
     #endif
+  #elif defined(SIMDE_X86_SVML_POLY_) && SIMDE_NATURAL_VECTOR_SIZE_GE(512)
+    return simde_x_mm512_sincostan_pd_poly_(a, SIMDE_X86_SVML_SIN_);
   #else
     simde__m512d_private
       r_,
@@ -11285,6 +13482,8 @@ simde_mm_tan_ps (simde__m128 a) {
     #else
       return Sleef_tanf4_u35(a);
     #endif
+  #elif defined(SIMDE_X86_SVML_POLY_)
+    return simde_x_mm_sincostan_ps_poly_(a, SIMDE_X86_SVML_TAN_);
   #else
     simde__m128_private
       r_,
@@ -11314,6 +13513,8 @@ simde_mm_tan_pd (simde__m128d a) {
     #else
       return Sleef_tand2_u35(a);
     #endif
+  #elif defined(SIMDE_X86_SVML_POLY_)
+    return simde_x_mm_sincostan_pd_poly_(a, SIMDE_X86_SVML_TAN_);
   #else
     simde__m128d_private
       r_,
@@ -11343,6 +13544,8 @@ simde_mm256_tan_ps (simde__m256 a) {
     #else
       return Sleef_tanf8_u35(a);
     #endif
+  #elif defined(SIMDE_X86_SVML_POLY_) && SIMDE_NATURAL_VECTOR_SIZE_GE(256)
+    return simde_x_mm256_sincostan_ps_poly_(a, SIMDE_X86_SVML_TAN_);
   #else
     simde__m256_private
       r_,
@@ -11379,6 +13582,8 @@ simde_mm256_tan_pd (simde__m256d a) {
     #else
       return Sleef_tand4_u35(a);
     #endif
+  #elif defined(SIMDE_X86_SVML_POLY_) && SIMDE_NATURAL_VECTOR_SIZE_GE(256)
+    return simde_x_mm256_sincostan_pd_poly_(a, SIMDE_X86_SVML_TAN_);
   #else
     simde__m256d_private
       r_,
@@ -11414,6 +13619,8 @@ simde_mm512_tan_ps (simde__m512 a) {
     #else
       return Sleef_tanf16_u35(a);
     #endif
+  #elif defined(SIMDE_X86_SVML_POLY_) && SIMDE_NATURAL_VECTOR_SIZE_GE(512)
+    return simde_x_mm512_sincostan_ps_poly_(a, SIMDE_X86_SVML_TAN_);
   #else
     simde__m512_private
       r_,
@@ -11449,6 +13656,8 @@ simde_mm512_tan_pd (simde__m512d a) {
     #else
       return Sleef_tand8_u35(a);
     #endif
+  #elif defined(SIMDE_X86_SVML_POLY_) && SIMDE_NATURAL_VECTOR_SIZE_GE(512)
+    return simde_x_mm512_sincostan_pd_poly_(a, SIMDE_X86_SVML_TAN_);
   #else
     simde__m512d_private
       r_,
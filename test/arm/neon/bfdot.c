@@ -0,0 +1,502 @@
+#define SIMDE_TEST_ARM_NEON_INSN bfdot
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/bfdot.h"
+#include "../../../simde/arm/neon/cvt.h"
+#include "../../../simde/arm/neon/reinterpret.h"
+#include "../../../simde/arm/neon/dup_n.h"
+
+static int
+test_simde_vbfdot_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 r_[2];
+    uint16_t a[4];
+    uint16_t b[4];
+    simde_float32 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   -24.61), SIMDE_FLOAT32_C(    85.36) },
+      { UINT16_C(16604), UINT16_C(49335), UINT16_C(16622), UINT16_C(16431) },
+      { UINT16_C(49426), UINT16_C(16657), UINT16_C(49308), UINT16_C(49272) },
+      { SIMDE_FLOAT32_C(  -139.17), SIMDE_FLOAT32_C(    38.51) } },
+    { { SIMDE_FLOAT32_C(   -15.18), SIMDE_FLOAT32_C(    17.70) },
+      { UINT16_C(49392), UINT16_C(16495), UINT16_C(16597), UINT16_C(15996) },
+      { UINT16_C(16572), UINT16_C(16416), UINT16_C(16592), UINT16_C(49356) },
+      { SIMDE_FLOAT32_C(   -49.91), SIMDE_FLOAT32_C(    59.40) } },
+    { { SIMDE_FLOAT32_C(   -28.26), SIMDE_FLOAT32_C(    -6.12) },
+      { UINT16_C(49405), UINT16_C(16663), UINT16_C(16430), UINT16_C(49409) },
+      { UINT16_C(16340), UINT16_C(49115), UINT16_C(49351), UINT16_C(49369) },
+      { SIMDE_FLOAT32_C(   -57.50), SIMDE_FLOAT32_C(    31.65) } },
+    { { SIMDE_FLOAT32_C(    -7.85), SIMDE_FLOAT32_C(   -85.93) },
+      { UINT16_C(16289), UINT16_C(16025), UINT16_C(49391), UINT16_C(16624) },
+      { UINT16_C(49427), UINT16_C(49362), UINT16_C(16587), UINT16_C(49331) },
+      { SIMDE_FLOAT32_C(   -21.37), SIMDE_FLOAT32_C(  -175.26) } },
+    { { SIMDE_FLOAT32_C(   -15.16), SIMDE_FLOAT32_C(    11.92) },
+      { UINT16_C(49061), UINT16_C(48624), UINT16_C(15810), UINT16_C(48817) },
+      { UINT16_C(49422), UINT16_C(16586), UINT16_C(49291), UINT16_C(49425) },
+      { SIMDE_FLOAT32_C(    -4.46), SIMDE_FLOAT32_C(    14.64) } },
+    { { SIMDE_FLOAT32_C(   -18.34), SIMDE_FLOAT32_C(    62.89) },
+      { UINT16_C(16421), UINT16_C(48987), UINT16_C(48865), UINT16_C(49331) },
+      { UINT16_C(16407), UINT16_C(49215), UINT16_C(49419), UINT16_C(49389) },
+      { SIMDE_FLOAT32_C(    -9.70), SIMDE_FLOAT32_C(   108.14) } },
+    { { SIMDE_FLOAT32_C(   -81.48), SIMDE_FLOAT32_C(    36.90) },
+      { UINT16_C(16629), UINT16_C(16548), UINT16_C(49332), UINT16_C(49378) },
+      { UINT16_C(16656), UINT16_C(49185), UINT16_C(49365), UINT16_C(16311) },
+      { SIMDE_FLOAT32_C(   -25.47), SIMDE_FLOAT32_C(    64.24) } },
+    { { SIMDE_FLOAT32_C(    23.75), SIMDE_FLOAT32_C(     8.15) },
+      { UINT16_C(49014), UINT16_C(49275), UINT16_C(48602), UINT16_C(48986) },
+      { UINT16_C(16488), UINT16_C(49028), UINT16_C(49210), UINT16_C(16668) },
+      { SIMDE_FLOAT32_C(    24.31), SIMDE_FLOAT32_C(     0.16) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t r_ = simde_vld1_f32(test_vec[i].r_);
+    simde_bfloat16x4_t a = simde_vreinterpret_bf16_u16(simde_vld1_u16(test_vec[i].a));
+    simde_bfloat16x4_t b = simde_vreinterpret_bf16_u16(simde_vld1_u16(test_vec[i].b));
+    simde_float32x2_t r = simde_vbfdot_f32(r_, a, b);
+
+    simde_test_arm_neon_assert_equal_f32x2(r, simde_vld1_f32(test_vec[i].r), 2);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x2_t r_ = simde_test_arm_neon_random_f32x2(SIMDE_FLOAT32_C(-100.0), SIMDE_FLOAT32_C(100.0));
+    simde_bfloat16x4_t a = simde_vcvt_bf16_f32(simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0)));
+    simde_bfloat16x4_t b = simde_vcvt_bf16_f32(simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0)));
+    simde_float32x2_t r = simde_vbfdot_f32(r_, a, b);
+
+    simde_test_arm_neon_write_f32x2(2, r_, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u16x4(2, simde_vreinterpret_u16_bf16(a), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, simde_vreinterpret_u16_bf16(b), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vbfdotq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 r_[4];
+    uint16_t a[8];
+    uint16_t b[8];
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   -77.86), SIMDE_FLOAT32_C(    51.12), SIMDE_FLOAT32_C(   -16.55), SIMDE_FLOAT32_C(    61.08) },
+      { UINT16_C(16517), UINT16_C(16297), UINT16_C(16397), UINT16_C(49325), UINT16_C(49435), UINT16_C(16542), UINT16_C(49306), UINT16_C(49401) },
+      { UINT16_C(16583), UINT16_C(16361), UINT16_C(49430), UINT16_C(16071), UINT16_C(49367), UINT16_C(16618), UINT16_C(49299), UINT16_C(16653) },
+      { SIMDE_FLOAT32_C(   -49.61), SIMDE_FLOAT32_C(    28.36), SIMDE_FLOAT32_C(    84.64), SIMDE_FLOAT32_C(    14.62) } },
+    { { SIMDE_FLOAT32_C(    22.51), SIMDE_FLOAT32_C(   -84.33), SIMDE_FLOAT32_C(   -18.23), SIMDE_FLOAT32_C(    93.30) },
+      { UINT16_C(16513), UINT16_C(49373), UINT16_C(49193), UINT16_C(49297), UINT16_C(49410), UINT16_C(16368), UINT16_C(16506), UINT16_C(49333) },
+      { UINT16_C(16261), UINT16_C(16615), UINT16_C(16635), UINT16_C(49362), UINT16_C(49416), UINT16_C(16644), UINT16_C(49246), UINT16_C(49366) },
+      { SIMDE_FLOAT32_C(   -23.16), SIMDE_FLOAT32_C(   -75.31), SIMDE_FLOAT32_C(    66.30), SIMDE_FLOAT32_C(   117.58) } },
+    { { SIMDE_FLOAT32_C(    59.77), SIMDE_FLOAT32_C(   -47.16), SIMDE_FLOAT32_C(    43.60), SIMDE_FLOAT32_C(    38.18) },
+      { UINT16_C(49285), UINT16_C(48967), UINT16_C(49287), UINT16_C(16580), UINT16_C(49290), UINT16_C(49297), UINT16_C(16613), UINT16_C(49295) },
+      { UINT16_C(49058), UINT16_C(16035), UINT16_C(49439), UINT16_C(49288), UINT16_C(16540), UINT16_C(16666), UINT16_C(49227), UINT16_C(48876) },
+      { SIMDE_FLOAT32_C(    64.78), SIMDE_FLOAT32_C(   -31.27), SIMDE_FLOAT32_C(   -21.04), SIMDE_FLOAT32_C(    17.54) } },
+    { { SIMDE_FLOAT32_C(   -88.61), SIMDE_FLOAT32_C(    -2.39), SIMDE_FLOAT32_C(   -28.06), SIMDE_FLOAT32_C(     0.42) },
+      { UINT16_C(49281), UINT16_C(49262), UINT16_C(16644), UINT16_C(16561), UINT16_C(49203), UINT16_C(49418), UINT16_C(49423), UINT16_C(49409) },
+      { UINT16_C(49389), UINT16_C(16340), UINT16_C(16087), UINT16_C(49389), UINT16_C(16626), UINT16_C(16474), UINT16_C(16518), UINT16_C(16637) },
+      { SIMDE_FLOAT32_C(   -64.91), SIMDE_FLOAT32_C(   -39.89), SIMDE_FLOAT32_C(   -78.59), SIMDE_FLOAT32_C(  -100.75) } },
+    { { SIMDE_FLOAT32_C(   -37.23), SIMDE_FLOAT32_C(    80.57), SIMDE_FLOAT32_C(    95.23), SIMDE_FLOAT32_C(    81.76) },
+      { UINT16_C(49425), UINT16_C(16609), UINT16_C(16667), UINT16_C(49404), UINT16_C(16618), UINT16_C(16586), UINT16_C(49430), UINT16_C(16517) },
+      { UINT16_C(16550), UINT16_C(16544), UINT16_C(49422), UINT16_C(16662), UINT16_C(49416), UINT16_C(49413), UINT16_C(16655), UINT16_C(48834) },
+      { SIMDE_FLOAT32_C(   -49.09), SIMDE_FLOAT32_C(   -79.23), SIMDE_FLOAT32_C(   -19.40), SIMDE_FLOAT32_C(    -3.60) } },
+    { { SIMDE_FLOAT32_C(   -64.32), SIMDE_FLOAT32_C(   -21.06), SIMDE_FLOAT32_C(    24.72), SIMDE_FLOAT32_C(   -46.33) },
+      { UINT16_C(16645), UINT16_C(16481), UINT16_C(49169), UINT16_C(49195), UINT16_C(49398), UINT16_C(16667), UINT16_C(49271), UINT16_C(16652) },
+      { UINT16_C(16205), UINT16_C(16191), UINT16_C(49360), UINT16_C(15703), UINT16_C(49408), UINT16_C(49029), UINT16_C(16401), UINT16_C(16648) },
+      { SIMDE_FLOAT32_C(   -55.04), SIMDE_FLOAT32_C(    -6.47), SIMDE_FLOAT32_C(    76.15), SIMDE_FLOAT32_C(    19.30) } },
+    { { SIMDE_FLOAT32_C(   -55.81), SIMDE_FLOAT32_C(   -63.69), SIMDE_FLOAT32_C(    57.55), SIMDE_FLOAT32_C(   -73.54) },
+      { UINT16_C(49347), UINT16_C(48862), UINT16_C(49082), UINT16_C(16670), UINT16_C(49419), UINT16_C(16621), UINT16_C(48959), UINT16_C(49384) },
+      { UINT16_C(49320), UINT16_C(16643), UINT16_C(49359), UINT16_C(49093), UINT16_C(49428), UINT16_C(48776), UINT16_C(16512), UINT16_C(16535) },
+      { SIMDE_FLOAT32_C(   -27.37), SIMDE_FLOAT32_C(   -69.49), SIMDE_FLOAT32_C(   135.94), SIMDE_FLOAT32_C(  -110.74) } },
+    { { SIMDE_FLOAT32_C(   -31.98), SIMDE_FLOAT32_C(   -14.81), SIMDE_FLOAT32_C(    65.09), SIMDE_FLOAT32_C(    75.50) },
+      { UINT16_C(49035), UINT16_C(49422), UINT16_C(16652), UINT16_C(49223), UINT16_C(48888), UINT16_C(49425), UINT16_C(49433), UINT16_C(49399) },
+      { UINT16_C(16226), UINT16_C(49305), UINT16_C(16572), UINT16_C(49379), UINT16_C(16455), UINT16_C(49433), UINT16_C(49204), UINT16_C(16653) },
+      { SIMDE_FLOAT32_C(     9.49), SIMDE_FLOAT32_C(    58.65), SIMDE_FLOAT32_C(   150.24), SIMDE_FLOAT32_C(    34.37) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t r_ = simde_vld1q_f32(test_vec[i].r_);
+    simde_bfloat16x8_t a = simde_vreinterpretq_bf16_u16(simde_vld1q_u16(test_vec[i].a));
+    simde_bfloat16x8_t b = simde_vreinterpretq_bf16_u16(simde_vld1q_u16(test_vec[i].b));
+    simde_float32x4_t r = simde_vbfdotq_f32(r_, a, b);
+
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 2);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x4_t r_ = simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-100.0), SIMDE_FLOAT32_C(100.0));
+    simde_bfloat16x8_t a = simde_vcvtq_high_bf16_f32(
+      simde_vcvtq_low_bf16_f32(simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0))),
+      simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0)));
+    simde_bfloat16x8_t b = simde_vcvtq_high_bf16_f32(
+      simde_vcvtq_low_bf16_f32(simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0))),
+      simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0)));
+    simde_float32x4_t r = simde_vbfdotq_f32(r_, a, b);
+
+    simde_test_arm_neon_write_f32x4(2, r_, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u16x8(2, simde_vreinterpretq_u16_bf16(a), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x8(2, simde_vreinterpretq_u16_bf16(b), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vbfdot_lane_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 r_[2];
+    uint16_t a[4];
+    uint16_t b[4];
+    const int lane;
+    simde_float32 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   -48.59), SIMDE_FLOAT32_C(   -37.21) },
+      { UINT16_C(49430), UINT16_C(16622), UINT16_C(48652), UINT16_C(49312) },
+      { UINT16_C(16283), UINT16_C(49301), UINT16_C(16632), UINT16_C(49088) },
+       INT32_C(          0),
+      { SIMDE_FLOAT32_C(   -94.57), SIMDE_FLOAT32_C(   -14.09) } },
+    { { SIMDE_FLOAT32_C(   -86.53), SIMDE_FLOAT32_C(   -56.45) },
+      { UINT16_C(49423), UINT16_C(16552), UINT16_C(49406), UINT16_C(48797) },
+      { UINT16_C(16367), UINT16_C(49410), UINT16_C(16437), UINT16_C(16419) },
+       INT32_C(          1),
+      { SIMDE_FLOAT32_C(   -98.44), SIMDE_FLOAT32_C(   -79.68) } },
+    { { SIMDE_FLOAT32_C(    86.36), SIMDE_FLOAT32_C(    87.36) },
+      { UINT16_C(16665), UINT16_C(16134), UINT16_C(48782), UINT16_C(49075) },
+      { UINT16_C(49388), UINT16_C(16371), UINT16_C(16672), UINT16_C(15756) },
+       INT32_C(          0),
+      { SIMDE_FLOAT32_C(    16.83), SIMDE_FLOAT32_C(    86.75) } },
+    { { SIMDE_FLOAT32_C(    70.69), SIMDE_FLOAT32_C(   -47.10) },
+      { UINT16_C(49184), UINT16_C(49092), UINT16_C(16662), UINT16_C(49191) },
+      { UINT16_C(16551), UINT16_C(49377), UINT16_C(16549), UINT16_C(48906) },
+       INT32_C(          1),
+      { SIMDE_FLOAT32_C(    58.62), SIMDE_FLOAT32_C(     2.65) } },
+    { { SIMDE_FLOAT32_C(    98.33), SIMDE_FLOAT32_C(   -96.70) },
+      { UINT16_C(49305), UINT16_C(16632), UINT16_C(49049), UINT16_C(49293) },
+      { UINT16_C(16621), UINT16_C(49083), UINT16_C(16627), UINT16_C(16234) },
+       INT32_C(          0),
+      { SIMDE_FLOAT32_C(    51.60), SIMDE_FLOAT32_C(   -99.12) } },
+    { { SIMDE_FLOAT32_C(   -87.92), SIMDE_FLOAT32_C(   -80.05) },
+      { UINT16_C(16619), UINT16_C(16644), UINT16_C(49364), UINT16_C(16670) },
+      { UINT16_C(16601), UINT16_C(16176), UINT16_C(16558), UINT16_C(16153) },
+       INT32_C(          1),
+      { SIMDE_FLOAT32_C(   -43.06), SIMDE_FLOAT32_C(  -110.17) } },
+    { { SIMDE_FLOAT32_C(   -93.16), SIMDE_FLOAT32_C(   -41.23) },
+      { UINT16_C(49229), UINT16_C(16637), UINT16_C(49297), UINT16_C(16507) },
+      { UINT16_C(16426), UINT16_C(49397), UINT16_C(48979), UINT16_C(16254) },
+       INT32_C(          0),
+      { SIMDE_FLOAT32_C(  -162.20), SIMDE_FLOAT32_C(   -83.29) } },
+    { { SIMDE_FLOAT32_C(    45.14), SIMDE_FLOAT32_C(   -29.32) },
+      { UINT16_C(16668), UINT16_C(16579), UINT16_C(49432), UINT16_C(16628) },
+      { UINT16_C(16397), UINT16_C(16653), UINT16_C(49326), UINT16_C(16559) },
+       INT32_C(          1),
+      { SIMDE_FLOAT32_C(    25.45), SIMDE_FLOAT32_C(    64.04) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t r_ = simde_vld1_f32(test_vec[i].r_);
+    simde_bfloat16x4_t a = simde_vreinterpret_bf16_u16(simde_vld1_u16(test_vec[i].a));
+    simde_bfloat16x4_t b = simde_vreinterpret_bf16_u16(simde_vld1_u16(test_vec[i].b));
+    simde_float32x2_t r;
+
+    SIMDE_CONSTIFY_2_(simde_vbfdot_lane_f32, r, (HEDLEY_UNREACHABLE(), simde_vdup_n_f32(SIMDE_FLOAT32_C(0.0))), test_vec[i].lane, r_, a, b);
+
+    simde_test_arm_neon_assert_equal_f32x2(r, simde_vld1_f32(test_vec[i].r), 2);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  const int lanes[] = { 0, 1, 0, 1, 0, 1, 0, 1 };
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x2_t r_ = simde_test_arm_neon_random_f32x2(SIMDE_FLOAT32_C(-100.0), SIMDE_FLOAT32_C(100.0));
+    simde_bfloat16x4_t a = simde_vcvt_bf16_f32(simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0)));
+    simde_bfloat16x4_t b = simde_vcvt_bf16_f32(simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0)));
+    simde_float32x2_t r = simde_vbfdot_lane_f32(r_, a, b, lanes[i]);
+
+    simde_test_arm_neon_write_f32x2(2, r_, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u16x4(2, simde_vreinterpret_u16_bf16(a), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, simde_vreinterpret_u16_bf16(b), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, lanes[i], SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vbfdotq_lane_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 r_[4];
+    uint16_t a[8];
+    uint16_t b[4];
+    const int lane;
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(    43.12), SIMDE_FLOAT32_C(   -20.07), SIMDE_FLOAT32_C(   -29.04), SIMDE_FLOAT32_C(    20.28) },
+      { UINT16_C(16665), UINT16_C(16494), UINT16_C(16439), UINT16_C(16494), UINT16_C(16603), UINT16_C(16356), UINT16_C(16519), UINT16_C(49428) },
+      { UINT16_C(16618), UINT16_C(16660), UINT16_C(16326), UINT16_C(16315) },
+       INT32_C(          0),
+      { SIMDE_FLOAT32_C(   147.44), SIMDE_FLOAT32_C(    35.24), SIMDE_FLOAT32_C(    37.48), SIMDE_FLOAT32_C(   -34.43) } },
+    { { SIMDE_FLOAT32_C(    86.90), SIMDE_FLOAT32_C(    13.08), SIMDE_FLOAT32_C(    78.52), SIMDE_FLOAT32_C(     9.49) },
+      { UINT16_C(16307), UINT16_C(16645), UINT16_C(16648), UINT16_C(16374), UINT16_C(16217), UINT16_C(16262), UINT16_C(48930), UINT16_C(49190) },
+      { UINT16_C(49327), UINT16_C(49287), UINT16_C(49330), UINT16_C(16654) },
+       INT32_C(          1),
+      { SIMDE_FLOAT32_C(   152.89), SIMDE_FLOAT32_C(   -17.14), SIMDE_FLOAT32_C(    83.10), SIMDE_FLOAT32_C(   -10.01) } },
+    { { SIMDE_FLOAT32_C(   -18.65), SIMDE_FLOAT32_C(    75.17), SIMDE_FLOAT32_C(    -5.76), SIMDE_FLOAT32_C(    99.23) },
+      { UINT16_C(16366), UINT16_C(49226), UINT16_C(49088), UINT16_C(49301), UINT16_C(49244), UINT16_C(49289), UINT16_C(49294), UINT16_C(49171) },
+      { UINT16_C(49432), UINT16_C(16655), UINT16_C(16582), UINT16_C(49227) },
+       INT32_C(          0),
+      { SIMDE_FLOAT32_C(   -64.52), SIMDE_FLOAT32_C(    47.80), SIMDE_FLOAT32_C(   -11.37), SIMDE_FLOAT32_C(   120.86) } },
+    { { SIMDE_FLOAT32_C(    67.73), SIMDE_FLOAT32_C(   -90.15), SIMDE_FLOAT32_C(    23.31), SIMDE_FLOAT32_C(    18.17) },
+      { UINT16_C(16628), UINT16_C(16666), UINT16_C(16395), UINT16_C(16595), UINT16_C(16510), UINT16_C(49410), UINT16_C(49403), UINT16_C(49399) },
+      { UINT16_C(16547), UINT16_C(48913), UINT16_C(49212), UINT16_C(48396) },
+       INT32_C(          1),
+      { SIMDE_FLOAT32_C(    45.00), SIMDE_FLOAT32_C(   -96.76), SIMDE_FLOAT32_C(    11.93), SIMDE_FLOAT32_C(    41.47) } },
+    { { SIMDE_FLOAT32_C(    87.76), SIMDE_FLOAT32_C(    -3.49), SIMDE_FLOAT32_C(    66.97), SIMDE_FLOAT32_C(   -26.67) },
+      { UINT16_C(16454), UINT16_C(16562), UINT16_C(49355), UINT16_C(16643), UINT16_C(49346), UINT16_C(49372), UINT16_C(16662), UINT16_C(49322) },
+      { UINT16_C(49076), UINT16_C(16653), UINT16_C(49338), UINT16_C(16460) },
+       INT32_C(          0),
+      { SIMDE_FLOAT32_C(   132.43), SIMDE_FLOAT32_C(    77.58), SIMDE_FLOAT32_C(    14.91), SIMDE_FLOAT32_C(   -86.67) } },
+    { { SIMDE_FLOAT32_C(    43.38), SIMDE_FLOAT32_C(   -84.41), SIMDE_FLOAT32_C(   -77.25), SIMDE_FLOAT32_C(    96.33) },
+      { UINT16_C(16593), UINT16_C(16470), UINT16_C(16424), UINT16_C(48694), UINT16_C(16643), UINT16_C(49432), UINT16_C(49290), UINT16_C(49289) },
+      { UINT16_C(16437), UINT16_C(16653), UINT16_C(49313), UINT16_C(49402) },
+       INT32_C(          1),
+      { SIMDE_FLOAT32_C(   -15.60), SIMDE_FLOAT32_C(   -96.23), SIMDE_FLOAT32_C(   -44.22), SIMDE_FLOAT32_C(   151.47) } },
+    { { SIMDE_FLOAT32_C(   -51.46), SIMDE_FLOAT32_C(    70.98), SIMDE_FLOAT32_C(    23.89), SIMDE_FLOAT32_C(   -70.89) },
+      { UINT16_C(16518), UINT16_C(49131), UINT16_C(49422), UINT16_C(49257), UINT16_C(16610), UINT16_C(16656), UINT16_C(49167), UINT16_C(16563) },
+      { UINT16_C(16650), UINT16_C(49404), UINT16_C(49350), UINT16_C(49236) },
+       INT32_C(          0),
+      { SIMDE_FLOAT32_C(    -0.88), SIMDE_FLOAT32_C(    23.10), SIMDE_FLOAT32_C(    13.93), SIMDE_FLOAT32_C(  -134.21) } },
+    { { SIMDE_FLOAT32_C(   -33.89), SIMDE_FLOAT32_C(    27.87), SIMDE_FLOAT32_C(    97.22), SIMDE_FLOAT32_C(   -60.48) },
+      { UINT16_C(49294), UINT16_C(16014), UINT16_C(16532), UINT16_C(49377), UINT16_C(16291), UINT16_C(16411), UINT16_C(16557), UINT16_C(49210) },
+      { UINT16_C(49254), UINT16_C(16324), UINT16_C(49183), UINT16_C(49030) },
+       INT32_C(          1),
+      { SIMDE_FLOAT32_C(   -23.16), SIMDE_FLOAT32_C(    23.74), SIMDE_FLOAT32_C(    91.52), SIMDE_FLOAT32_C(   -70.87) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t r_ = simde_vld1q_f32(test_vec[i].r_);
+    simde_bfloat16x8_t a = simde_vreinterpretq_bf16_u16(simde_vld1q_u16(test_vec[i].a));
+    simde_bfloat16x4_t b = simde_vreinterpret_bf16_u16(simde_vld1_u16(test_vec[i].b));
+    simde_float32x4_t r;
+
+    SIMDE_CONSTIFY_2_(simde_vbfdotq_lane_f32, r, (HEDLEY_UNREACHABLE(), simde_vdupq_n_f32(SIMDE_FLOAT32_C(0.0))), test_vec[i].lane, r_, a, b);
+
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 2);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  const int lanes[] = { 0, 1, 0, 1, 0, 1, 0, 1 };
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x4_t r_ = simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-100.0), SIMDE_FLOAT32_C(100.0));
+    simde_bfloat16x8_t a = simde_vcvtq_high_bf16_f32(
+      simde_vcvtq_low_bf16_f32(simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0))),
+      simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0)));
+    simde_bfloat16x4_t b = simde_vcvt_bf16_f32(simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0)));
+    simde_float32x4_t r = simde_vbfdotq_lane_f32(r_, a, b, lanes[i]);
+
+    simde_test_arm_neon_write_f32x4(2, r_, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u16x8(2, simde_vreinterpretq_u16_bf16(a), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, simde_vreinterpret_u16_bf16(b), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, lanes[i], SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vbfdot_laneq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 r_[2];
+    uint16_t a[4];
+    uint16_t b[8];
+    const int lane;
+    simde_float32 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(    55.46), SIMDE_FLOAT32_C(    94.71) },
+      { UINT16_C(16669), UINT16_C(49360), UINT16_C(16211), UINT16_C(16219) },
+      { UINT16_C(16261), UINT16_C(49346), UINT16_C(49249), UINT16_C(49158), UINT16_C(49348), UINT16_C(48779), UINT16_C(16643), UINT16_C(16461) },
+       INT32_C(          0),
+      { SIMDE_FLOAT32_C(   105.06), SIMDE_FLOAT32_C(    90.38) } },
+    { { SIMDE_FLOAT32_C(   -68.39), SIMDE_FLOAT32_C(   -49.83) },
+      { UINT16_C(49195), UINT16_C(16593), UINT16_C(49430), UINT16_C(49412) },
+      { UINT16_C(16602), UINT16_C(49197), UINT16_C(49354), UINT16_C(16214), UINT16_C(49427), UINT16_C(16520), UINT16_C(16633), UINT16_C(49421) },
+       INT32_C(          1),
+      { SIMDE_FLOAT32_C(   -46.06), SIMDE_FLOAT32_C(     2.45) } },
+    { { SIMDE_FLOAT32_C(     4.93), SIMDE_FLOAT32_C(    86.01) },
+      { UINT16_C(49264), UINT16_C(49282), UINT16_C(16629), UINT16_C(49440) },
+      { UINT16_C(49426), UINT16_C(16381), UINT16_C(16593), UINT16_C(16311), UINT16_C(16495), UINT16_C(49117), UINT16_C(16659), UINT16_C(49260) },
+       INT32_C(          2),
+      { SIMDE_FLOAT32_C(    -2.06), SIMDE_FLOAT32_C(   131.87) } },
+    { { SIMDE_FLOAT32_C(    12.50), SIMDE_FLOAT32_C(   -65.20) },
+      { UINT16_C(49276), UINT16_C(16406), UINT16_C(49417), UINT16_C(16548) },
+      { UINT16_C(49318), UINT16_C(16569), UINT16_C(49385), UINT16_C(16420), UINT16_C(48574), UINT16_C(49315), UINT16_C(16567), UINT16_C(16499) },
+       INT32_C(          3),
+      { SIMDE_FLOAT32_C(    -1.12), SIMDE_FLOAT32_C(   -94.71) } },
+    { { SIMDE_FLOAT32_C(   -18.89), SIMDE_FLOAT32_C(    10.04) },
+      { UINT16_C(49088), UINT16_C(16554), UINT16_C(49429), UINT16_C(49423) },
+      { UINT16_C(16309), UINT16_C(49420), UINT16_C(16627), UINT16_C(16634), UINT16_C(49322), UINT16_C(49355), UINT16_C(16622), UINT16_C(49418) },
+       INT32_C(          0),
+      { SIMDE_FLOAT32_C(   -67.50), SIMDE_FLOAT32_C(    75.07) } },
+    { { SIMDE_FLOAT32_C(     1.69), SIMDE_FLOAT32_C(   -77.36) },
+      { UINT16_C(16669), UINT16_C(49100), UINT16_C(16479), UINT16_C(49287) },
+      { UINT16_C(16624), UINT16_C(16530), UINT16_C(49438), UINT16_C(49414), UINT16_C(49274), UINT16_C(49248), UINT16_C(49432), UINT16_C(16413) },
+       INT32_C(          1),
+      { SIMDE_FLOAT32_C(   -81.86), SIMDE_FLOAT32_C(   -76.44) } },
+    { { SIMDE_FLOAT32_C(   -94.90), SIMDE_FLOAT32_C(     7.92) },
+      { UINT16_C(16545), UINT16_C(49293), UINT16_C(49277), UINT16_C(16613) },
+      { UINT16_C(16557), UINT16_C(16555), UINT16_C(49409), UINT16_C(49308), UINT16_C(49194), UINT16_C(48688), UINT16_C(16549), UINT16_C(16640) },
+       INT32_C(          2),
+      { SIMDE_FLOAT32_C(  -107.51), SIMDE_FLOAT32_C(    17.19) } },
+    { { SIMDE_FLOAT32_C(    15.65), SIMDE_FLOAT32_C(   -86.00) },
+      { UINT16_C(49429), UINT16_C(49152), UINT16_C(16654), UINT16_C(49416) },
+      { UINT16_C(16664), UINT16_C(49436), UINT16_C(49432), UINT16_C(48909), UINT16_C(49417), UINT16_C(49229), UINT16_C(16666), UINT16_C(16663) },
+       INT32_C(          3),
+      { SIMDE_FLOAT32_C(   -92.86), SIMDE_FLOAT32_C(   -80.80) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t r_ = simde_vld1_f32(test_vec[i].r_);
+    simde_bfloat16x4_t a = simde_vreinterpret_bf16_u16(simde_vld1_u16(test_vec[i].a));
+    simde_bfloat16x8_t b = simde_vreinterpretq_bf16_u16(simde_vld1q_u16(test_vec[i].b));
+    simde_float32x2_t r;
+
+    SIMDE_CONSTIFY_4_(simde_vbfdot_laneq_f32, r, (HEDLEY_UNREACHABLE(), simde_vdup_n_f32(SIMDE_FLOAT32_C(0.0))), test_vec[i].lane, r_, a, b);
+
+    simde_test_arm_neon_assert_equal_f32x2(r, simde_vld1_f32(test_vec[i].r), 2);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  const int lanes[] = { 0, 1, 2, 3, 0, 1, 2, 3 };
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x2_t r_ = simde_test_arm_neon_random_f32x2(SIMDE_FLOAT32_C(-100.0), SIMDE_FLOAT32_C(100.0));
+    simde_bfloat16x4_t a = simde_vcvt_bf16_f32(simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0)));
+    simde_bfloat16x8_t b = simde_vcvtq_high_bf16_f32(
+      simde_vcvtq_low_bf16_f32(simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0))),
+      simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0)));
+    simde_float32x2_t r = simde_vbfdot_laneq_f32(r_, a, b, lanes[i]);
+
+    simde_test_arm_neon_write_f32x2(2, r_, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u16x4(2, simde_vreinterpret_u16_bf16(a), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x8(2, simde_vreinterpretq_u16_bf16(b), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, lanes[i], SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vbfdotq_laneq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 r_[4];
+    uint16_t a[8];
+    uint16_t b[8];
+    const int lane;
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(    58.22), SIMDE_FLOAT32_C(    36.06), SIMDE_FLOAT32_C(   -28.87), SIMDE_FLOAT32_C(   -19.46) },
+      { UINT16_C(16136), UINT16_C(49229), UINT16_C(16423), UINT16_C(49341), UINT16_C(16061), UINT16_C(49142), UINT16_C(49387), UINT16_C(49365) },
+      { UINT16_C(49012), UINT16_C(49199), UINT16_C(49170), UINT16_C(16648), UINT16_C(49290), UINT16_C(49183), UINT16_C(49184), UINT16_C(16655) },
+       INT32_C(          0),
+      { SIMDE_FLOAT32_C(    66.47), SIMDE_FLOAT32_C(    49.72), SIMDE_FLOAT32_C(   -23.97), SIMDE_FLOAT32_C(     5.74) } },
+    { { SIMDE_FLOAT32_C(    97.49), SIMDE_FLOAT32_C(    49.32), SIMDE_FLOAT32_C(   -99.17), SIMDE_FLOAT32_C(     5.02) },
+      { UINT16_C(16657), UINT16_C(49314), UINT16_C(16552), UINT16_C(16485), UINT16_C(16213), UINT16_C(16654), UINT16_C(49298), UINT16_C(16660) },
+      { UINT16_C(49281), UINT16_C(16609), UINT16_C(16500), UINT16_C(16305), UINT16_C(49044), UINT16_C(49371), UINT16_C(49222), UINT16_C(16625) },
+       INT32_C(          1),
+      { SIMDE_FLOAT32_C(   125.04), SIMDE_FLOAT32_C(    74.28), SIMDE_FLOAT32_C(   -83.73), SIMDE_FLOAT32_C(     0.42) } },
+    { { SIMDE_FLOAT32_C(     8.58), SIMDE_FLOAT32_C(   -72.41), SIMDE_FLOAT32_C(    17.82), SIMDE_FLOAT32_C(     4.20) },
+      { UINT16_C(16631), UINT16_C(16636), UINT16_C(16626), UINT16_C(49375), UINT16_C(15956), UINT16_C(48424), UINT16_C(49072), UINT16_C(16620) },
+      { UINT16_C(16656), UINT16_C(49390), UINT16_C(16575), UINT16_C(49119), UINT16_C(49143), UINT16_C(49432), UINT16_C(15967), UINT16_C(16401) },
+       INT32_C(          2),
+      { SIMDE_FLOAT32_C(   -81.13), SIMDE_FLOAT32_C(   -20.80), SIMDE_FLOAT32_C(    17.81), SIMDE_FLOAT32_C(   -63.21) } },
+    { { SIMDE_FLOAT32_C(    41.63), SIMDE_FLOAT32_C(   -72.88), SIMDE_FLOAT32_C(   -42.22), SIMDE_FLOAT32_C(     7.23) },
+      { UINT16_C(49300), UINT16_C(16625), UINT16_C(49037), UINT16_C(49430), UINT16_C(16217), UINT16_C(49364), UINT16_C(16533), UINT16_C(49134) },
+      { UINT16_C(16645), UINT16_C(49369), UINT16_C(16512), UINT16_C(16494), UINT16_C(49197), UINT16_C(16601), UINT16_C(16597), UINT16_C(16658) },
+       INT32_C(          3),
+      { SIMDE_FLOAT32_C(    79.57), SIMDE_FLOAT32_C(  -165.76), SIMDE_FLOAT32_C(   -97.03), SIMDE_FLOAT32_C(    21.26) } },
+    { { SIMDE_FLOAT32_C(    20.04), SIMDE_FLOAT32_C(   -58.42), SIMDE_FLOAT32_C(    66.27), SIMDE_FLOAT32_C(   -63.65) },
+      { UINT16_C(16524), UINT16_C(49277), UINT16_C(49168), UINT16_C(49251), UINT16_C(16407), UINT16_C(16618), UINT16_C(16594), UINT16_C(49436) },
+      { UINT16_C(16609), UINT16_C(16507), UINT16_C(49179), UINT16_C(16626), UINT16_C(49296), UINT16_C(16605), UINT16_C(16657), UINT16_C(16515) },
+       INT32_C(          0),
+      { SIMDE_FLOAT32_C(    35.30), SIMDE_FLOAT32_C(   -88.15), SIMDE_FLOAT32_C(   111.54), SIMDE_FLOAT32_C(   -55.75) } },
+    { { SIMDE_FLOAT32_C(   -31.28), SIMDE_FLOAT32_C(   -25.59), SIMDE_FLOAT32_C(   -41.35), SIMDE_FLOAT32_C(   -14.64) },
+      { UINT16_C(49374), UINT16_C(16618), UINT16_C(49221), UINT16_C(49331), UINT16_C(49341), UINT16_C(16373), UINT16_C(49421), UINT16_C(16574) },
+      { UINT16_C(16612), UINT16_C(49265), UINT16_C(49361), UINT16_C(16662), UINT16_C(49120), UINT16_C(16665), UINT16_C(16492), UINT16_C(16453) },
+       INT32_C(          1),
+      { SIMDE_FLOAT32_C(    82.59), SIMDE_FLOAT32_C(   -57.93), SIMDE_FLOAT32_C(    15.17), SIMDE_FLOAT32_C(    98.58) } },
+    { { SIMDE_FLOAT32_C(    13.21), SIMDE_FLOAT32_C(   -84.59), SIMDE_FLOAT32_C(   -71.04), SIMDE_FLOAT32_C(    48.88) },
+      { UINT16_C(49210), UINT16_C(49271), UINT16_C(16652), UINT16_C(49312), UINT16_C(15835), UINT16_C(48971), UINT16_C(16606), UINT16_C(49350) },
+      { UINT16_C(49237), UINT16_C(49229), UINT16_C(49376), UINT16_C(48926), UINT16_C(16548), UINT16_C(16543), UINT16_C(49250), UINT16_C(16464) },
+       INT32_C(          2),
+      { SIMDE_FLOAT32_C(   -20.86), SIMDE_FLOAT32_C(   -64.59), SIMDE_FLOAT32_C(   -74.43), SIMDE_FLOAT32_C(    53.69) } },
+    { { SIMDE_FLOAT32_C(    -3.91), SIMDE_FLOAT32_C(   -25.01), SIMDE_FLOAT32_C(    49.22), SIMDE_FLOAT32_C(    21.14) },
+      { UINT16_C(49395), UINT16_C(49199), UINT16_C(16451), UINT16_C(49287), UINT16_C(16391), UINT16_C(49347), UINT16_C(49299), UINT16_C(49340) },
+      { UINT16_C(16587), UINT16_C(48940), UINT16_C(49398), UINT16_C(16371), UINT16_C(49342), UINT16_C(49431), UINT16_C(16655), UINT16_C(49413) },
+       INT32_C(          3),
+      { SIMDE_FLOAT32_C(   -49.05), SIMDE_FLOAT32_C(    37.29), SIMDE_FLOAT32_C(   118.73), SIMDE_FLOAT32_C(    28.92) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t r_ = simde_vld1q_f32(test_vec[i].r_);
+    simde_bfloat16x8_t a = simde_vreinterpretq_bf16_u16(simde_vld1q_u16(test_vec[i].a));
+    simde_bfloat16x8_t b = simde_vreinterpretq_bf16_u16(simde_vld1q_u16(test_vec[i].b));
+    simde_float32x4_t r;
+
+    SIMDE_CONSTIFY_4_(simde_vbfdotq_laneq_f32, r, (HEDLEY_UNREACHABLE(), simde_vdupq_n_f32(SIMDE_FLOAT32_C(0.0))), test_vec[i].lane, r_, a, b);
+
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 2);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  const int lanes[] = { 0, 1, 2, 3, 0, 1, 2, 3 };
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x4_t r_ = simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-100.0), SIMDE_FLOAT32_C(100.0));
+    simde_bfloat16x8_t a = simde_vcvtq_high_bf16_f32(
+      simde_vcvtq_low_bf16_f32(simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0))),
+      simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0)));
+    simde_bfloat16x8_t b = simde_vcvtq_high_bf16_f32(
+      simde_vcvtq_low_bf16_f32(simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0))),
+      simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0)));
+    simde_float32x4_t r = simde_vbfdotq_laneq_f32(r_, a, b, lanes[i]);
+
+    simde_test_arm_neon_write_f32x4(2, r_, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u16x8(2, simde_vreinterpretq_u16_bf16(a), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x8(2, simde_vreinterpretq_u16_bf16(b), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, lanes[i], SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vbfdot_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vbfdotq_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vbfdot_lane_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vbfdotq_lane_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vbfdot_laneq_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vbfdotq_laneq_f32)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,510 @@
+#define SIMDE_TEST_ARM_NEON_INSN bfmlal
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/bfmlal.h"
+#include "../../../simde/arm/neon/cvt.h"
+#include "../../../simde/arm/neon/reinterpret.h"
+#include "../../../simde/arm/neon/dup_n.h"
+
+static int
+test_simde_vbfmlalbq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 r_[4];
+    uint16_t a[8];
+    uint16_t b[8];
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(    90.14), SIMDE_FLOAT32_C(   -20.99), SIMDE_FLOAT32_C(   -76.01), SIMDE_FLOAT32_C(    71.49) },
+      { UINT16_C(16451), UINT16_C(16407), UINT16_C(49379), UINT16_C(16656), UINT16_C(16601), UINT16_C(16188), UINT16_C(49121), UINT16_C(16669) },
+      { UINT16_C(16651), UINT16_C(49242), UINT16_C(49089), UINT16_C(16252), UINT16_C(16476), UINT16_C(16671), UINT16_C(16560), UINT16_C(49332) },
+      { SIMDE_FLOAT32_C(   116.61), SIMDE_FLOAT32_C(   -10.29), SIMDE_FLOAT32_C(   -52.70), SIMDE_FLOAT32_C(    61.82) } },
+    { { SIMDE_FLOAT32_C(   -78.22), SIMDE_FLOAT32_C(   -91.62), SIMDE_FLOAT32_C(   -77.55), SIMDE_FLOAT32_C(   -79.71) },
+      { UINT16_C(49192), UINT16_C(16198), UINT16_C(16041), UINT16_C(16333), UINT16_C(16549), UINT16_C(49438), UINT16_C(16517), UINT16_C(49381) },
+      { UINT16_C(16543), UINT16_C(16617), UINT16_C(49409), UINT16_C(16414), UINT16_C(49374), UINT16_C(16218), UINT16_C(49348), UINT16_C(16525) },
+      { SIMDE_FLOAT32_C(   -91.26), SIMDE_FLOAT32_C(   -94.28), SIMDE_FLOAT32_C(  -113.32), SIMDE_FLOAT32_C(  -105.17) } },
+    { { SIMDE_FLOAT32_C(   -29.34), SIMDE_FLOAT32_C(    91.54), SIMDE_FLOAT32_C(     9.64), SIMDE_FLOAT32_C(    67.34) },
+      { UINT16_C(49281), UINT16_C(16607), UINT16_C(49405), UINT16_C(16552), UINT16_C(16612), UINT16_C(49415), UINT16_C(16213), UINT16_C(49357) },
+      { UINT16_C(49340), UINT16_C(16605), UINT16_C(49398), UINT16_C(16572), UINT16_C(48851), UINT16_C(49380), UINT16_C(49297), UINT16_C(16386) },
+      { SIMDE_FLOAT32_C(    -5.66), SIMDE_FLOAT32_C(   152.32), SIMDE_FLOAT32_C(     6.70), SIMDE_FLOAT32_C(    63.57) } },
+    { { SIMDE_FLOAT32_C(   -61.64), SIMDE_FLOAT32_C(    35.81), SIMDE_FLOAT32_C(    93.61), SIMDE_FLOAT32_C(    98.29) },
+      { UINT16_C(49405), UINT16_C(49425), UINT16_C(49191), UINT16_C(16589), UINT16_C(16647), UINT16_C(48880), UINT16_C(49205), UINT16_C(49285) },
+      { UINT16_C(16571), UINT16_C(16449), UINT16_C(49178), UINT16_C(16314), UINT16_C(48743), UINT16_C(16582), UINT16_C(16617), UINT16_C(16660) },
+      { SIMDE_FLOAT32_C(  -107.84), SIMDE_FLOAT32_C(    42.09), SIMDE_FLOAT32_C(    91.71), SIMDE_FLOAT32_C(    77.70) } },
+    { { SIMDE_FLOAT32_C(    56.45), SIMDE_FLOAT32_C(    16.05), SIMDE_FLOAT32_C(    60.60), SIMDE_FLOAT32_C(   -56.23) },
+      { UINT16_C(16585), UINT16_C(49379), UINT16_C(16614), UINT16_C(16543), UINT16_C(49366), UINT16_C(16584), UINT16_C(49151), UINT16_C(16133) },
+      { UINT16_C(49375), UINT16_C(49073), UINT16_C(48905), UINT16_C(15806), UINT16_C(49088), UINT16_C(49437), UINT16_C(16535), UINT16_C(16649) },
+      { SIMDE_FLOAT32_C(    12.68), SIMDE_FLOAT32_C(    12.20), SIMDE_FLOAT32_C(    70.63), SIMDE_FLOAT32_C(   -65.63) } },
+    { { SIMDE_FLOAT32_C(   -20.80), SIMDE_FLOAT32_C(    34.14), SIMDE_FLOAT32_C(    51.79), SIMDE_FLOAT32_C(   -63.01) },
+      { UINT16_C(16378), UINT16_C(16406), UINT16_C(16607), UINT16_C(16524), UINT16_C(16237), UINT16_C(49330), UINT16_C(49430), UINT16_C(49410) },
+      { UINT16_C(16612), UINT16_C(16646), UINT16_C(49320), UINT16_C(16539), UINT16_C(49337), UINT16_C(48887), UINT16_C(49373), UINT16_C(49046) },
+      { SIMDE_FLOAT32_C(    -6.88), SIMDE_FLOAT32_C(    -2.45), SIMDE_FLOAT32_C(    46.44), SIMDE_FLOAT32_C(     1.74) } },
+    { { SIMDE_FLOAT32_C(   -75.04), SIMDE_FLOAT32_C(    57.62), SIMDE_FLOAT32_C(    -1.56), SIMDE_FLOAT32_C(   -51.30) },
+      { UINT16_C(16635), UINT16_C(49327), UINT16_C(49287), UINT16_C(16303), UINT16_C(49350), UINT16_C(16658), UINT16_C(49184), UINT16_C(49390) },
+      { UINT16_C(49341), UINT16_C(49288), UINT16_C(16663), UINT16_C(49382), UINT16_C(49261), UINT16_C(49424), UINT16_C(16654), UINT16_C(16512) },
+      { SIMDE_FLOAT32_C(  -121.37), SIMDE_FLOAT32_C(    17.81), SIMDE_FLOAT32_C(    21.35), SIMDE_FLOAT32_C(   -73.49) } },
+    { { SIMDE_FLOAT32_C(   -96.84), SIMDE_FLOAT32_C(    57.29), SIMDE_FLOAT32_C(   -40.91), SIMDE_FLOAT32_C(    -5.37) },
+      { UINT16_C(49413), UINT16_C(49423), UINT16_C(16559), UINT16_C(16499), UINT16_C(16419), UINT16_C(16458), UINT16_C(16501), UINT16_C(49374) },
+      { UINT16_C(48953), UINT16_C(48825), UINT16_C(49135), UINT16_C(16551), UINT16_C(49250), UINT16_C(16412), UINT16_C(49439), UINT16_C(49418) },
+      { SIMDE_FLOAT32_C(   -90.83), SIMDE_FLOAT32_C(    47.08), SIMDE_FLOAT32_C(   -49.90), SIMDE_FLOAT32_C(   -43.41) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t r_ = simde_vld1q_f32(test_vec[i].r_);
+    simde_bfloat16x8_t a = simde_vreinterpretq_bf16_u16(simde_vld1q_u16(test_vec[i].a));
+    simde_bfloat16x8_t b = simde_vreinterpretq_bf16_u16(simde_vld1q_u16(test_vec[i].b));
+    simde_float32x4_t r = simde_vbfmlalbq_f32(r_, a, b);
+
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 2);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x4_t r_ = simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-100.0), SIMDE_FLOAT32_C(100.0));
+    simde_bfloat16x8_t a = simde_vcvtq_high_bf16_f32(
+      simde_vcvtq_low_bf16_f32(simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0))),
+      simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0)));
+    simde_bfloat16x8_t b = simde_vcvtq_high_bf16_f32(
+      simde_vcvtq_low_bf16_f32(simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0))),
+      simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0)));
+    simde_float32x4_t r = simde_vbfmlalbq_f32(r_, a, b);
+
+    simde_test_arm_neon_write_f32x4(2, r_, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u16x8(2, simde_vreinterpretq_u16_bf16(a), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x8(2, simde_vreinterpretq_u16_bf16(b), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vbfmlaltq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 r_[4];
+    uint16_t a[8];
+    uint16_t b[8];
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(     4.58), SIMDE_FLOAT32_C(    55.23), SIMDE_FLOAT32_C(    69.60), SIMDE_FLOAT32_C(    94.31) },
+      { UINT16_C(49187), UINT16_C(16584), UINT16_C(16618), UINT16_C(16550), UINT16_C(49169), UINT16_C(16062), UINT16_C(16484), UINT16_C(49327) },
+      { UINT16_C(49314), UINT16_C(49431), UINT16_C(16626), UINT16_C(49238), UINT16_C(49401), UINT16_C(48849), UINT16_C(49214), UINT16_C(49419) },
+      { SIMDE_FLOAT32_C(   -54.40), SIMDE_FLOAT32_C(    37.88), SIMDE_FLOAT32_C(    69.45), SIMDE_FLOAT32_C(   141.82) } },
+    { { SIMDE_FLOAT32_C(    46.69), SIMDE_FLOAT32_C(    15.50), SIMDE_FLOAT32_C(    21.42), SIMDE_FLOAT32_C(    89.18) },
+      { UINT16_C(16515), UINT16_C(49314), UINT16_C(16564), UINT16_C(16667), UINT16_C(16448), UINT16_C(48979), UINT16_C(49117), UINT16_C(49413) },
+      { UINT16_C(16566), UINT16_C(16531), UINT16_C(49361), UINT16_C(49318), UINT16_C(49090), UINT16_C(16547), UINT16_C(49339), UINT16_C(16584) },
+      { SIMDE_FLOAT32_C(    23.43), SIMDE_FLOAT32_C(   -34.75), SIMDE_FLOAT32_C(    17.22), SIMDE_FLOAT32_C(    37.23) } },
+    { { SIMDE_FLOAT32_C(    82.09), SIMDE_FLOAT32_C(   -67.13), SIMDE_FLOAT32_C(   -56.80), SIMDE_FLOAT32_C(   -82.68) },
+      { UINT16_C(48967), UINT16_C(16531), UINT16_C(49394), UINT16_C(49221), UINT16_C(49204), UINT16_C(49162), UINT16_C(49111), UINT16_C(49429) },
+      { UINT16_C(16591), UINT16_C(16581), UINT16_C(49419), UINT16_C(49412), UINT16_C(49381), UINT16_C(16577), UINT16_C(49429), UINT16_C(16549) },
+      { SIMDE_FLOAT32_C(   110.37), SIMDE_FLOAT32_C(   -41.74), SIMDE_FLOAT32_C(   -69.80), SIMDE_FLOAT32_C(  -130.70) } },
+    { { SIMDE_FLOAT32_C(   -33.01), SIMDE_FLOAT32_C(    75.14), SIMDE_FLOAT32_C(   -32.36), SIMDE_FLOAT32_C(    56.99) },
+      { UINT16_C(49427), UINT16_C(49191), UINT16_C(49346), UINT16_C(15835), UINT16_C(16647), UINT16_C(16574), UINT16_C(49181), UINT16_C(49332) },
+      { UINT16_C(49411), UINT16_C(16432), UINT16_C(16586), UINT16_C(49086), UINT16_C(16642), UINT16_C(49383), UINT16_C(49367), UINT16_C(49408) },
+      { SIMDE_FLOAT32_C(   -40.19), SIMDE_FLOAT32_C(    74.98), SIMDE_FLOAT32_C(   -75.22), SIMDE_FLOAT32_C(   101.99) } },
+    { { SIMDE_FLOAT32_C(     1.54), SIMDE_FLOAT32_C(   -78.18), SIMDE_FLOAT32_C(    43.85), SIMDE_FLOAT32_C(    57.36) },
+      { UINT16_C(49291), UINT16_C(16653), UINT16_C(49439), UINT16_C(16516), UINT16_C(16245), UINT16_C(48922), UINT16_C(49219), UINT16_C(16632) },
+      { UINT16_C(49424), UINT16_C(16545), UINT16_C(15732), UINT16_C(16301), UINT16_C(49400), UINT16_C(16538), UINT16_C(49065), UINT16_C(49340) },
+      { SIMDE_FLOAT32_C(    45.88), SIMDE_FLOAT32_C(   -72.60), SIMDE_FLOAT32_C(    40.95), SIMDE_FLOAT32_C(    11.83) } },
+    { { SIMDE_FLOAT32_C(    -9.34), SIMDE_FLOAT32_C(    41.00), SIMDE_FLOAT32_C(    28.09), SIMDE_FLOAT32_C(    98.59) },
+      { UINT16_C(16437), UINT16_C(16671), UINT16_C(49429), UINT16_C(16442), UINT16_C(16623), UINT16_C(49207), UINT16_C(49361), UINT16_C(49425) },
+      { UINT16_C(49254), UINT16_C(16546), UINT16_C(49364), UINT16_C(49252), UINT16_C(49042), UINT16_C(49424), UINT16_C(49374), UINT16_C(49267) },
+      { SIMDE_FLOAT32_C(    40.97), SIMDE_FLOAT32_C(    30.65), SIMDE_FLOAT32_C(    53.82), SIMDE_FLOAT32_C(   133.00) } },
+    { { SIMDE_FLOAT32_C(    55.37), SIMDE_FLOAT32_C(    55.13), SIMDE_FLOAT32_C(   -30.38), SIMDE_FLOAT32_C(   -37.19) },
+      { UINT16_C(49312), UINT16_C(48843), UINT16_C(16475), UINT16_C(16606), UINT16_C(16658), UINT16_C(49204), UINT16_C(49189), UINT16_C(49322) },
+      { UINT16_C(48808), UINT16_C(49417), UINT16_C(49238), UINT16_C(49419), UINT16_C(49242), UINT16_C(16611), UINT16_C(49145), UINT16_C(16672) },
+      { SIMDE_FLOAT32_C(    58.76), SIMDE_FLOAT32_C(    -5.14), SIMDE_FLOAT32_C(   -50.33), SIMDE_FLOAT32_C(   -90.32) } },
+    { { SIMDE_FLOAT32_C(    69.35), SIMDE_FLOAT32_C(    28.06), SIMDE_FLOAT32_C(    80.59), SIMDE_FLOAT32_C(    11.44) },
+      { UINT16_C(16634), UINT16_C(49306), UINT16_C(49296), UINT16_C(16625), UINT16_C(16462), UINT16_C(16318), UINT16_C(49303), UINT16_C(16175) },
+      { UINT16_C(49287), UINT16_C(49424), UINT16_C(16520), UINT16_C(16512), UINT16_C(48825), UINT16_C(16653), UINT16_C(49416), UINT16_C(16514) },
+      { SIMDE_FLOAT32_C(   112.66), SIMDE_FLOAT32_C(    58.18), SIMDE_FLOAT32_C(    93.67), SIMDE_FLOAT32_C(    14.22) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t r_ = simde_vld1q_f32(test_vec[i].r_);
+    simde_bfloat16x8_t a = simde_vreinterpretq_bf16_u16(simde_vld1q_u16(test_vec[i].a));
+    simde_bfloat16x8_t b = simde_vreinterpretq_bf16_u16(simde_vld1q_u16(test_vec[i].b));
+    simde_float32x4_t r = simde_vbfmlaltq_f32(r_, a, b);
+
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 2);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x4_t r_ = simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-100.0), SIMDE_FLOAT32_C(100.0));
+    simde_bfloat16x8_t a = simde_vcvtq_high_bf16_f32(
+      simde_vcvtq_low_bf16_f32(simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0))),
+      simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0)));
+    simde_bfloat16x8_t b = simde_vcvtq_high_bf16_f32(
+      simde_vcvtq_low_bf16_f32(simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0))),
+      simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0)));
+    simde_float32x4_t r = simde_vbfmlaltq_f32(r_, a, b);
+
+    simde_test_arm_neon_write_f32x4(2, r_, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u16x8(2, simde_vreinterpretq_u16_bf16(a), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x8(2, simde_vreinterpretq_u16_bf16(b), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vbfmlalbq_lane_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 r_[4];
+    uint16_t a[8];
+    uint16_t b[4];
+    const int lane;
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   -79.00), SIMDE_FLOAT32_C(    45.32), SIMDE_FLOAT32_C(    81.91), SIMDE_FLOAT32_C(   -96.79) },
+      { UINT16_C(16642), UINT16_C(16500), UINT16_C(48797), UINT16_C(16316), UINT16_C(49428), UINT16_C(49433), UINT16_C(16388), UINT16_C(49373) },
+      { UINT16_C(49374), UINT16_C(49187), UINT16_C(16132), UINT16_C(16545) },
+       INT32_C(          0),
+      { SIMDE_FLOAT32_C(  -135.37), SIMDE_FLOAT32_C(    47.45), SIMDE_FLOAT32_C(   146.08), SIMDE_FLOAT32_C(  -111.10) } },
+    { { SIMDE_FLOAT32_C(    34.14), SIMDE_FLOAT32_C(    12.21), SIMDE_FLOAT32_C(   -97.62), SIMDE_FLOAT32_C(    77.44) },
+      { UINT16_C(49436), UINT16_C(16668), UINT16_C(48926), UINT16_C(16527), UINT16_C(16370), UINT16_C(49211), UINT16_C(16455), UINT16_C(16538) },
+      { UINT16_C(49311), UINT16_C(16585), UINT16_C(49132), UINT16_C(49300) },
+       INT32_C(          1),
+      { SIMDE_FLOAT32_C(   -27.10), SIMDE_FLOAT32_C(     8.33), SIMDE_FLOAT32_C(   -85.74), SIMDE_FLOAT32_C(    96.97) } },
+    { { SIMDE_FLOAT32_C(   -38.94), SIMDE_FLOAT32_C(    37.50), SIMDE_FLOAT32_C(   -52.93), SIMDE_FLOAT32_C(   -32.75) },
+      { UINT16_C(49437), UINT16_C(49433), UINT16_C(16653), UINT16_C(49115), UINT16_C(16624), UINT16_C(16529), UINT16_C(16618), UINT16_C(49336) },
+      { UINT16_C(15513), UINT16_C(16631), UINT16_C(49175), UINT16_C(49299) },
+       INT32_C(          2),
+      { SIMDE_FLOAT32_C(   -15.79), SIMDE_FLOAT32_C(    16.71), SIMDE_FLOAT32_C(   -70.63), SIMDE_FLOAT32_C(   -50.00) } },
+    { { SIMDE_FLOAT32_C(    77.55), SIMDE_FLOAT32_C(     6.05), SIMDE_FLOAT32_C(    45.00), SIMDE_FLOAT32_C(   -51.93) },
+      { UINT16_C(16563), UINT16_C(49098), UINT16_C(16615), UINT16_C(48753), UINT16_C(49105), UINT16_C(49376), UINT16_C(16597), UINT16_C(49277) },
+      { UINT16_C(16461), UINT16_C(16274), UINT16_C(48938), UINT16_C(48939) },
+       INT32_C(          3),
+      { SIMDE_FLOAT32_C(    73.81), SIMDE_FLOAT32_C(     1.23), SIMDE_FLOAT32_C(    46.09), SIMDE_FLOAT32_C(   -56.38) } },
+    { { SIMDE_FLOAT32_C(   -49.01), SIMDE_FLOAT32_C(   -85.51), SIMDE_FLOAT32_C(   -45.22), SIMDE_FLOAT32_C(   -52.93) },
+      { UINT16_C(49324), UINT16_C(16647), UINT16_C(16651), UINT16_C(49036), UINT16_C(16668), UINT16_C(49438), UINT16_C(49416), UINT16_C(48699) },
+      { UINT16_C(49320), UINT16_C(16439), UINT16_C(49019), UINT16_C(49339) },
+       INT32_C(          0),
+      { SIMDE_FLOAT32_C(   -20.79), SIMDE_FLOAT32_C(  -131.12), SIMDE_FLOAT32_C(   -96.41), SIMDE_FLOAT32_C(    -8.31) } },
+    { { SIMDE_FLOAT32_C(   -86.96), SIMDE_FLOAT32_C(    89.90), SIMDE_FLOAT32_C(   -41.09), SIMDE_FLOAT32_C(    51.36) },
+      { UINT16_C(16104), UINT16_C(49431), UINT16_C(16597), UINT16_C(49333), UINT16_C(49300), UINT16_C(49422), UINT16_C(49058), UINT16_C(16637) },
+      { UINT16_C(49419), UINT16_C(49361), UINT16_C(49151), UINT16_C(16457) },
+       INT32_C(          1),
+      { SIMDE_FLOAT32_C(   -89.92), SIMDE_FLOAT32_C(    46.43), SIMDE_FLOAT32_C(   -10.88), SIMDE_FLOAT32_C(    59.63) } },
+    { { SIMDE_FLOAT32_C(   -39.09), SIMDE_FLOAT32_C(     2.07), SIMDE_FLOAT32_C(   -46.39), SIMDE_FLOAT32_C(    95.26) },
+      { UINT16_C(49224), UINT16_C(16643), UINT16_C(49311), UINT16_C(16660), UINT16_C(16420), UINT16_C(16667), UINT16_C(49416), UINT16_C(49421) },
+      { UINT16_C(16671), UINT16_C(49417), UINT16_C(49299), UINT16_C(16657) },
+       INT32_C(          2),
+      { SIMDE_FLOAT32_C(   -24.73), SIMDE_FLOAT32_C(    24.90), SIMDE_FLOAT32_C(   -58.16), SIMDE_FLOAT32_C(   134.31) } },
+    { { SIMDE_FLOAT32_C(   -76.27), SIMDE_FLOAT32_C(    34.35), SIMDE_FLOAT32_C(   -54.94), SIMDE_FLOAT32_C(   -19.15) },
+      { UINT16_C(49366), UINT16_C(16556), UINT16_C(49357), UINT16_C(49083), UINT16_C(49400), UINT16_C(16551), UINT16_C(16626), UINT16_C(48873) },
+      { UINT16_C(16575), UINT16_C(16537), UINT16_C(16462), UINT16_C(16634) },
+       INT32_C(          3),
+      { SIMDE_FLOAT32_C(  -128.52), SIMDE_FLOAT32_C(   -15.70), SIMDE_FLOAT32_C(  -115.49), SIMDE_FLOAT32_C(    39.93) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t r_ = simde_vld1q_f32(test_vec[i].r_);
+    simde_bfloat16x8_t a = simde_vreinterpretq_bf16_u16(simde_vld1q_u16(test_vec[i].a));
+    simde_bfloat16x4_t b = simde_vreinterpret_bf16_u16(simde_vld1_u16(test_vec[i].b));
+    simde_float32x4_t r;
+
+    SIMDE_CONSTIFY_4_(simde_vbfmlalbq_lane_f32, r, (HEDLEY_UNREACHABLE(), simde_vdupq_n_f32(SIMDE_FLOAT32_C(0.0))), test_vec[i].lane, r_, a, b);
+
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 2);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  const int lanes[] = { 0, 1, 2, 3, 0, 1, 2, 3 };
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x4_t r_ = simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-100.0), SIMDE_FLOAT32_C(100.0));
+    simde_bfloat16x8_t a = simde_vcvtq_high_bf16_f32(
+      simde_vcvtq_low_bf16_f32(simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0))),
+      simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0)));
+    simde_bfloat16x4_t b = simde_vcvt_bf16_f32(simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0)));
+    simde_float32x4_t r = simde_vbfmlalbq_lane_f32(r_, a, b, lanes[i]);
+
+    simde_test_arm_neon_write_f32x4(2, r_, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u16x8(2, simde_vreinterpretq_u16_bf16(a), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, simde_vreinterpret_u16_bf16(b), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, lanes[i], SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vbfmlalbq_laneq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 r_[4];
+    uint16_t a[8];
+    uint16_t b[8];
+    const int lane;
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(    99.71), SIMDE_FLOAT32_C(   -25.44), SIMDE_FLOAT32_C(    -7.90), SIMDE_FLOAT32_C(    81.57) },
+      { UINT16_C(48677), UINT16_C(49366), UINT16_C(16563), UINT16_C(49436), UINT16_C(16660), UINT16_C(16544), UINT16_C(16659), UINT16_C(16559) },
+      { UINT16_C(49191), UINT16_C(16610), UINT16_C(16112), UINT16_C(49394), UINT16_C(49338), UINT16_C(49158), UINT16_C(16399), UINT16_C(49196) },
+       INT32_C(          7),
+      { SIMDE_FLOAT32_C(   100.14), SIMDE_FLOAT32_C(   -40.47), SIMDE_FLOAT32_C(   -32.76), SIMDE_FLOAT32_C(    56.88) } },
+    { { SIMDE_FLOAT32_C(   -86.74), SIMDE_FLOAT32_C(   -23.42), SIMDE_FLOAT32_C(    66.79), SIMDE_FLOAT32_C(    71.25) },
+      { UINT16_C(16648), UINT16_C(16309), UINT16_C(16650), UINT16_C(16471), UINT16_C(16487), UINT16_C(49348), UINT16_C(49151), UINT16_C(16556) },
+      { UINT16_C(16574), UINT16_C(16299), UINT16_C(49324), UINT16_C(16442), UINT16_C(49219), UINT16_C(49298), UINT16_C(16230), UINT16_C(16562) },
+       INT32_C(          4),
+      { SIMDE_FLOAT32_C(  -112.64), SIMDE_FLOAT32_C(   -49.70), SIMDE_FLOAT32_C(    55.79), SIMDE_FLOAT32_C(    77.32) } },
+    { { SIMDE_FLOAT32_C(     5.33), SIMDE_FLOAT32_C(   -54.89), SIMDE_FLOAT32_C(   -38.67), SIMDE_FLOAT32_C(   -50.23) },
+      { UINT16_C(49304), UINT16_C(16464), UINT16_C(16306), UINT16_C(49163), UINT16_C(49345), UINT16_C(16456), UINT16_C(16515), UINT16_C(16575) },
+      { UINT16_C(48971), UINT16_C(49436), UINT16_C(49415), UINT16_C(16398), UINT16_C(49238), UINT16_C(49429), UINT16_C(49246), UINT16_C(16186) },
+       INT32_C(          6),
+      { SIMDE_FLOAT32_C(    21.81), SIMDE_FLOAT32_C(   -59.71), SIMDE_FLOAT32_C(   -17.75), SIMDE_FLOAT32_C(   -64.43) } },
+    { { SIMDE_FLOAT32_C(   -70.38), SIMDE_FLOAT32_C(    98.99), SIMDE_FLOAT32_C(    65.52), SIMDE_FLOAT32_C(    67.71) },
+      { UINT16_C(16256), UINT16_C(16638), UINT16_C(16628), UINT16_C(48907), UINT16_C(16475), UINT16_C(49325), UINT16_C(16019), UINT16_C(49329) },
+      { UINT16_C(16446), UINT16_C(49301), UINT16_C(49271), UINT16_C(16523), UINT16_C(49255), UINT16_C(16642), UINT16_C(16599), UINT16_C(16665) },
+       INT32_C(          4),
+      { SIMDE_FLOAT32_C(   -73.99), SIMDE_FLOAT32_C(    71.47), SIMDE_FLOAT32_C(    53.17), SIMDE_FLOAT32_C(    66.67) } },
+    { { SIMDE_FLOAT32_C(    57.48), SIMDE_FLOAT32_C(    70.50), SIMDE_FLOAT32_C(    25.19), SIMDE_FLOAT32_C(    29.33) },
+      { UINT16_C(16337), UINT16_C(16652), UINT16_C(16359), UINT16_C(49334), UINT16_C(49433), UINT16_C(16360), UINT16_C(49314), UINT16_C(49424) },
+      { UINT16_C(16071), UINT16_C(16222), UINT16_C(16537), UINT16_C(49103), UINT16_C(16426), UINT16_C(49417), UINT16_C(48776), UINT16_C(16638) },
+       INT32_C(          4),
+      { SIMDE_FLOAT32_C(    61.82), SIMDE_FLOAT32_C(    75.29), SIMDE_FLOAT32_C(    -0.21), SIMDE_FLOAT32_C(    15.88) } },
+    { { SIMDE_FLOAT32_C(    17.61), SIMDE_FLOAT32_C(    79.36), SIMDE_FLOAT32_C(   -55.80), SIMDE_FLOAT32_C(   -50.65) },
+      { UINT16_C(16640), UINT16_C(16605), UINT16_C(16425), UINT16_C(49435), UINT16_C(16556), UINT16_C(49123), UINT16_C(49306), UINT16_C(16668) },
+      { UINT16_C(16551), UINT16_C(16290), UINT16_C(16425), UINT16_C(49159), UINT16_C(16631), UINT16_C(16583), UINT16_C(49388), UINT16_C(49300) },
+       INT32_C(          4),
+      { SIMDE_FLOAT32_C(    79.36), SIMDE_FLOAT32_C(    99.74), SIMDE_FLOAT32_C(   -14.31), SIMDE_FLOAT32_C(   -87.80) } },
+    { { SIMDE_FLOAT32_C(   -24.36), SIMDE_FLOAT32_C(    77.79), SIMDE_FLOAT32_C(    96.48), SIMDE_FLOAT32_C(   -32.51) },
+      { UINT16_C(49418), UINT16_C(49353), UINT16_C(49356), UINT16_C(49425), UINT16_C(16549), UINT16_C(49183), UINT16_C(49405), UINT16_C(49346) },
+      { UINT16_C(16592), UINT16_C(49347), UINT16_C(16440), UINT16_C(16570), UINT16_C(16520), UINT16_C(49435), UINT16_C(49334), UINT16_C(16614) },
+       INT32_C(          0),
+      { SIMDE_FLOAT32_C(   -80.42), SIMDE_FLOAT32_C(    36.35), SIMDE_FLOAT32_C(   130.00), SIMDE_FLOAT32_C(   -83.90) } },
+    { { SIMDE_FLOAT32_C(    86.29), SIMDE_FLOAT32_C(    79.94), SIMDE_FLOAT32_C(    88.18), SIMDE_FLOAT32_C(    85.82) },
+      { UINT16_C(16189), UINT16_C(16148), UINT16_C(16641), UINT16_C(16625), UINT16_C(49386), UINT16_C(16662), UINT16_C(49162), UINT16_C(49204) },
+      { UINT16_C(16375), UINT16_C(49287), UINT16_C(49418), UINT16_C(49431), UINT16_C(49145), UINT16_C(49127), UINT16_C(16532), UINT16_C(49295) },
+       INT32_C(          7),
+      { SIMDE_FLOAT32_C(    82.99), SIMDE_FLOAT32_C(    43.91), SIMDE_FLOAT32_C(   120.86), SIMDE_FLOAT32_C(    95.46) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t r_ = simde_vld1q_f32(test_vec[i].r_);
+    simde_bfloat16x8_t a = simde_vreinterpretq_bf16_u16(simde_vld1q_u16(test_vec[i].a));
+    simde_bfloat16x8_t b = simde_vreinterpretq_bf16_u16(simde_vld1q_u16(test_vec[i].b));
+    simde_float32x4_t r;
+
+    SIMDE_CONSTIFY_8_(simde_vbfmlalbq_laneq_f32, r, (HEDLEY_UNREACHABLE(), simde_vdupq_n_f32(SIMDE_FLOAT32_C(0.0))), test_vec[i].lane, r_, a, b);
+
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 2);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  const int lanes[] = { 7, 4, 6, 4, 4, 4, 0, 7 };
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x4_t r_ = simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-100.0), SIMDE_FLOAT32_C(100.0));
+    simde_bfloat16x8_t a = simde_vcvtq_high_bf16_f32(
+      simde_vcvtq_low_bf16_f32(simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0))),
+      simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0)));
+    simde_bfloat16x8_t b = simde_vcvtq_high_bf16_f32(
+      simde_vcvtq_low_bf16_f32(simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0))),
+      simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0)));
+    simde_float32x4_t r = simde_vbfmlalbq_laneq_f32(r_, a, b, lanes[i]);
+
+    simde_test_arm_neon_write_f32x4(2, r_, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u16x8(2, simde_vreinterpretq_u16_bf16(a), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x8(2, simde_vreinterpretq_u16_bf16(b), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, lanes[i], SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vbfmlaltq_lane_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 r_[4];
+    uint16_t a[8];
+    uint16_t b[4];
+    const int lane;
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(    -9.40), SIMDE_FLOAT32_C(     3.97), SIMDE_FLOAT32_C(    89.06), SIMDE_FLOAT32_C(    11.43) },
+      { UINT16_C(16615), UINT16_C(16636), UINT16_C(16492), UINT16_C(16658), UINT16_C(16145), UINT16_C(16467), UINT16_C(49320), UINT16_C(16556) },
+      { UINT16_C(49328), UINT16_C(49316), UINT16_C(49106), UINT16_C(16536) },
+       INT32_C(          0),
+      { SIMDE_FLOAT32_C(   -52.71), SIMDE_FLOAT32_C(   -46.22), SIMDE_FLOAT32_C(    70.93), SIMDE_FLOAT32_C(   -18.13) } },
+    { { SIMDE_FLOAT32_C(    52.28), SIMDE_FLOAT32_C(   -31.24), SIMDE_FLOAT32_C(    72.91), SIMDE_FLOAT32_C(   -43.18) },
+      { UINT16_C(48992), UINT16_C(49287), UINT16_C(49214), UINT16_C(49025), UINT16_C(16654), UINT16_C(16566), UINT16_C(49426), UINT16_C(16635) },
+      { UINT16_C(16643), UINT16_C(16671), UINT16_C(49133), UINT16_C(16660) },
+       INT32_C(          1),
+      { SIMDE_FLOAT32_C(    10.36), SIMDE_FLOAT32_C(   -41.26), SIMDE_FLOAT32_C(   129.43), SIMDE_FLOAT32_C(    34.77) } },
+    { { SIMDE_FLOAT32_C(   -44.84), SIMDE_FLOAT32_C(    57.17), SIMDE_FLOAT32_C(    -5.45), SIMDE_FLOAT32_C(   -86.76) },
+      { UINT16_C(49362), UINT16_C(48991), UINT16_C(16636), UINT16_C(49397), UINT16_C(48968), UINT16_C(49364), UINT16_C(16460), UINT16_C(16646) },
+      { UINT16_C(49434), UINT16_C(48964), UINT16_C(16628), UINT16_C(49364) },
+       INT32_C(          2),
+      { SIMDE_FLOAT32_C(   -51.48), SIMDE_FLOAT32_C(    -1.21), SIMDE_FLOAT32_C(   -55.97), SIMDE_FLOAT32_C(   -22.90) } },
+    { { SIMDE_FLOAT32_C(    51.83), SIMDE_FLOAT32_C(    32.14), SIMDE_FLOAT32_C(    88.25), SIMDE_FLOAT32_C(   -41.03) },
+      { UINT16_C(49247), UINT16_C(49167), UINT16_C(49260), UINT16_C(49311), UINT16_C(49297), UINT16_C(49322), UINT16_C(49382), UINT16_C(16406) },
+      { UINT16_C(49418), UINT16_C(49380), UINT16_C(49396), UINT16_C(49210) },
+       INT32_C(          3),
+      { SIMDE_FLOAT32_C(    58.32), SIMDE_FLOAT32_C(    46.58), SIMDE_FLOAT32_C(   103.69), SIMDE_FLOAT32_C(   -47.84) } },
+    { { SIMDE_FLOAT32_C(   -93.16), SIMDE_FLOAT32_C(    92.33), SIMDE_FLOAT32_C(    40.45), SIMDE_FLOAT32_C(   -26.55) },
+      { UINT16_C(49341), UINT16_C(16270), UINT16_C(49397), UINT16_C(49415), UINT16_C(16600), UINT16_C(16664), UINT16_C(49368), UINT16_C(49211) },
+      { UINT16_C(49439), UINT16_C(49346), UINT16_C(49283), UINT16_C(49419) },
+       INT32_C(          0),
+      { SIMDE_FLOAT32_C(  -104.18), SIMDE_FLOAT32_C(   176.18), SIMDE_FLOAT32_C(   -53.96), SIMDE_FLOAT32_C(     2.49) } },
+    { { SIMDE_FLOAT32_C(    94.77), SIMDE_FLOAT32_C(   -62.97), SIMDE_FLOAT32_C(   -54.87), SIMDE_FLOAT32_C(   -90.02) },
+      { UINT16_C(49434), UINT16_C(49221), UINT16_C(49429), UINT16_C(49174), UINT16_C(16526), UINT16_C(49392), UINT16_C(49191), UINT16_C(16400) },
+      { UINT16_C(49438), UINT16_C(16351), UINT16_C(49049), UINT16_C(16525) },
+       INT32_C(          1),
+      { SIMDE_FLOAT32_C(    89.41), SIMDE_FLOAT32_C(   -67.05), SIMDE_FLOAT32_C(   -67.94), SIMDE_FLOAT32_C(   -86.10) } },
+    { { SIMDE_FLOAT32_C(   -21.92), SIMDE_FLOAT32_C(    -3.67), SIMDE_FLOAT32_C(   -25.26), SIMDE_FLOAT32_C(   -57.32) },
+      { UINT16_C(16553), UINT16_C(16533), UINT16_C(49377), UINT16_C(49106), UINT16_C(49199), UINT16_C(16417), UINT16_C(49155), UINT16_C(16488) },
+      { UINT16_C(16372), UINT16_C(16588), UINT16_C(49276), UINT16_C(49361) },
+       INT32_C(          2),
+      { SIMDE_FLOAT32_C(   -40.25), SIMDE_FLOAT32_C(     2.79), SIMDE_FLOAT32_C(   -35.17), SIMDE_FLOAT32_C(   -71.59) } },
+    { { SIMDE_FLOAT32_C(    66.51), SIMDE_FLOAT32_C(   -50.10), SIMDE_FLOAT32_C(    91.94), SIMDE_FLOAT32_C(    62.05) },
+      { UINT16_C(49362), UINT16_C(49419), UINT16_C(49359), UINT16_C(16547), UINT16_C(49303), UINT16_C(49431), UINT16_C(16415), UINT16_C(49437) },
+      { UINT16_C(16619), UINT16_C(16662), UINT16_C(49431), UINT16_C(16525) },
+       INT32_C(          3),
+      { SIMDE_FLOAT32_C(    28.23), SIMDE_FLOAT32_C(   -27.66), SIMDE_FLOAT32_C(    50.36), SIMDE_FLOAT32_C(    18.81) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t r_ = simde_vld1q_f32(test_vec[i].r_);
+    simde_bfloat16x8_t a = simde_vreinterpretq_bf16_u16(simde_vld1q_u16(test_vec[i].a));
+    simde_bfloat16x4_t b = simde_vreinterpret_bf16_u16(simde_vld1_u16(test_vec[i].b));
+    simde_float32x4_t r;
+
+    SIMDE_CONSTIFY_4_(simde_vbfmlaltq_lane_f32, r, (HEDLEY_UNREACHABLE(), simde_vdupq_n_f32(SIMDE_FLOAT32_C(0.0))), test_vec[i].lane, r_, a, b);
+
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 2);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  const int lanes[] = { 0, 1, 2, 3, 0, 1, 2, 3 };
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x4_t r_ = simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-100.0), SIMDE_FLOAT32_C(100.0));
+    simde_bfloat16x8_t a = simde_vcvtq_high_bf16_f32(
+      simde_vcvtq_low_bf16_f32(simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0))),
+      simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0)));
+    simde_bfloat16x4_t b = simde_vcvt_bf16_f32(simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0)));
+    simde_float32x4_t r = simde_vbfmlaltq_lane_f32(r_, a, b, lanes[i]);
+
+    simde_test_arm_neon_write_f32x4(2, r_, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u16x8(2, simde_vreinterpretq_u16_bf16(a), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x4(2, simde_vreinterpret_u16_bf16(b), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, lanes[i], SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vbfmlaltq_laneq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 r_[4];
+    uint16_t a[8];
+    uint16_t b[8];
+    const int lane;
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(    -0.40), SIMDE_FLOAT32_C(    49.24), SIMDE_FLOAT32_C(    38.38), SIMDE_FLOAT32_C(   -17.75) },
+      { UINT16_C(49301), UINT16_C(16672), UINT16_C(49158), UINT16_C(49159), UINT16_C(49332), UINT16_C(16536), UINT16_C(49264), UINT16_C(48680) },
+      { UINT16_C(16564), UINT16_C(16619), UINT16_C(16659), UINT16_C(16547), UINT16_C(16508), UINT16_C(49428), UINT16_C(49164), UINT16_C(16607) },
+       INT32_C(          6),
+      { SIMDE_FLOAT32_C(   -22.27), SIMDE_FLOAT32_C(    53.85), SIMDE_FLOAT32_C(    27.99), SIMDE_FLOAT32_C(   -17.39) } },
+    { { SIMDE_FLOAT32_C(   -64.79), SIMDE_FLOAT32_C(    -9.10), SIMDE_FLOAT32_C(    64.51), SIMDE_FLOAT32_C(    89.09) },
+      { UINT16_C(48861), UINT16_C(15957), UINT16_C(49272), UINT16_C(16286), UINT16_C(16655), UINT16_C(16396), UINT16_C(49188), UINT16_C(49125) },
+      { UINT16_C(48951), UINT16_C(49198), UINT16_C(49396), UINT16_C(49317), UINT16_C(16651), UINT16_C(49428), UINT16_C(48682), UINT16_C(16465) },
+       INT32_C(          1),
+      { SIMDE_FLOAT32_C(   -65.36), SIMDE_FLOAT32_C(   -12.46), SIMDE_FLOAT32_C(    58.56), SIMDE_FLOAT32_C(    93.95) } },
+    { { SIMDE_FLOAT32_C(    89.66), SIMDE_FLOAT32_C(    79.99), SIMDE_FLOAT32_C(    -0.06), SIMDE_FLOAT32_C(    68.88) },
+      { UINT16_C(16671), UINT16_C(16355), UINT16_C(16547), UINT16_C(16470), UINT16_C(16635), UINT16_C(49152), UINT16_C(16462), UINT16_C(49433) },
+      { UINT16_C(16393), UINT16_C(16670), UINT16_C(49285), UINT16_C(16457), UINT16_C(49434), UINT16_C(16592), UINT16_C(16641), UINT16_C(49431) },
+       INT32_C(          6),
+      { SIMDE_FLOAT32_C(   103.96), SIMDE_FLOAT32_C(   106.95), SIMDE_FLOAT32_C(   -16.18), SIMDE_FLOAT32_C(    -8.22) } },
+    { { SIMDE_FLOAT32_C(   -50.98), SIMDE_FLOAT32_C(   -22.04), SIMDE_FLOAT32_C(   -14.19), SIMDE_FLOAT32_C(    49.87) },
+      { UINT16_C(49030), UINT16_C(49423), UINT16_C(16463), UINT16_C(49037), UINT16_C(16458), UINT16_C(16491), UINT16_C(16564), UINT16_C(49080) },
+      { UINT16_C(16292), UINT16_C(49332), UINT16_C(16525), UINT16_C(16182), UINT16_C(16543), UINT16_C(49345), UINT16_C(49424), UINT16_C(49333) },
+       INT32_C(          6),
+      { SIMDE_FLOAT32_C(    29.46), SIMDE_FLOAT32_C(   -12.13), SIMDE_FLOAT32_C(   -47.24), SIMDE_FLOAT32_C(    62.81) } },
+    { { SIMDE_FLOAT32_C(    95.80), SIMDE_FLOAT32_C(    96.02), SIMDE_FLOAT32_C(   -23.69), SIMDE_FLOAT32_C(    57.40) },
+      { UINT16_C(16654), UINT16_C(48962), UINT16_C(49396), UINT16_C(49314), UINT16_C(16652), UINT16_C(16431), UINT16_C(16359), UINT16_C(16046) },
+      { UINT16_C(49436), UINT16_C(49108), UINT16_C(16605), UINT16_C(49366), UINT16_C(49353), UINT16_C(16061), UINT16_C(49359), UINT16_C(16411) },
+       INT32_C(          0),
+      { SIMDE_FLOAT32_C(   103.19), SIMDE_FLOAT32_C(   145.38), SIMDE_FLOAT32_C(   -50.35), SIMDE_FLOAT32_C(    54.09) } },
+    { { SIMDE_FLOAT32_C(    27.92), SIMDE_FLOAT32_C(    88.96), SIMDE_FLOAT32_C(   -45.26), SIMDE_FLOAT32_C(   -71.64) },
+      { UINT16_C(16525), UINT16_C(16270), UINT16_C(16664), UINT16_C(48852), UINT16_C(49282), UINT16_C(49285), UINT16_C(49271), UINT16_C(48946) },
+      { UINT16_C(16532), UINT16_C(49169), UINT16_C(49404), UINT16_C(16194), UINT16_C(49323), UINT16_C(16112), UINT16_C(16547), UINT16_C(49305) },
+       INT32_C(          3),
+      { SIMDE_FLOAT32_C(    28.76), SIMDE_FLOAT32_C(    88.65), SIMDE_FLOAT32_C(   -48.41), SIMDE_FLOAT32_C(   -72.17) } },
+    { { SIMDE_FLOAT32_C(   -28.09), SIMDE_FLOAT32_C(    70.79), SIMDE_FLOAT32_C(    62.40), SIMDE_FLOAT32_C(    72.18) },
+      { UINT16_C(16664), UINT16_C(16407), UINT16_C(16641), UINT16_C(49297), UINT16_C(16662), UINT16_C(15836), UINT16_C(16666), UINT16_C(49312) },
+      { UINT16_C(49297), UINT16_C(49201), UINT16_C(16317), UINT16_C(49229), UINT16_C(16654), UINT16_C(48959), UINT16_C(49322), UINT16_C(49420) },
+       INT32_C(          0),
+      { SIMDE_FLOAT32_C(   -38.78), SIMDE_FLOAT32_C(    91.32), SIMDE_FLOAT32_C(    61.91), SIMDE_FLOAT32_C(    94.84) } },
+    { { SIMDE_FLOAT32_C(    17.31), SIMDE_FLOAT32_C(   -11.44), SIMDE_FLOAT32_C(   -52.84), SIMDE_FLOAT32_C(   -95.02) },
+      { UINT16_C(16321), UINT16_C(16553), UINT16_C(49301), UINT16_C(49290), UINT16_C(49312), UINT16_C(49236), UINT16_C(16570), UINT16_C(16617) },
+      { UINT16_C(16663), UINT16_C(49406), UINT16_C(16520), UINT16_C(49331), UINT16_C(16642), UINT16_C(48801), UINT16_C(49384), UINT16_C(49238) },
+       INT32_C(          5),
+      { SIMDE_FLOAT32_C(    15.65), SIMDE_FLOAT32_C(   -10.08), SIMDE_FLOAT32_C(   -51.80), SIMDE_FLOAT32_C(   -97.31) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t r_ = simde_vld1q_f32(test_vec[i].r_);
+    simde_bfloat16x8_t a = simde_vreinterpretq_bf16_u16(simde_vld1q_u16(test_vec[i].a));
+    simde_bfloat16x8_t b = simde_vreinterpretq_bf16_u16(simde_vld1q_u16(test_vec[i].b));
+    simde_float32x4_t r;
+
+    SIMDE_CONSTIFY_8_(simde_vbfmlaltq_laneq_f32, r, (HEDLEY_UNREACHABLE(), simde_vdupq_n_f32(SIMDE_FLOAT32_C(0.0))), test_vec[i].lane, r_, a, b);
+
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 2);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  const int lanes[] = { 6, 1, 6, 6, 0, 3, 0, 5 };
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x4_t r_ = simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-100.0), SIMDE_FLOAT32_C(100.0));
+    simde_bfloat16x8_t a = simde_vcvtq_high_bf16_f32(
+      simde_vcvtq_low_bf16_f32(simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0))),
+      simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0)));
+    simde_bfloat16x8_t b = simde_vcvtq_high_bf16_f32(
+      simde_vcvtq_low_bf16_f32(simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0))),
+      simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0)));
+    simde_float32x4_t r = simde_vbfmlaltq_laneq_f32(r_, a, b, lanes[i]);
+
+    simde_test_arm_neon_write_f32x4(2, r_, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u16x8(2, simde_vreinterpretq_u16_bf16(a), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x8(2, simde_vreinterpretq_u16_bf16(b), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_i32(2, lanes[i], SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vbfmlalbq_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vbfmlaltq_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vbfmlalbq_lane_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vbfmlalbq_laneq_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vbfmlaltq_lane_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vbfmlaltq_laneq_f32)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,86 @@
+#define SIMDE_TEST_ARM_NEON_INSN bfmmla
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/bfmmla.h"
+#include "../../../simde/arm/neon/cvt.h"
+#include "../../../simde/arm/neon/reinterpret.h"
+
+static int
+test_simde_vbfmmlaq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 r_[4];
+    uint16_t a[8];
+    uint16_t b[8];
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   -16.46), SIMDE_FLOAT32_C(    37.93), SIMDE_FLOAT32_C(    16.25), SIMDE_FLOAT32_C(   -84.08) },
+      { UINT16_C(16527), UINT16_C(16547), UINT16_C(16606), UINT16_C(48982), UINT16_C(16631), UINT16_C(16468), UINT16_C(49433), UINT16_C(49348) },
+      { UINT16_C(16404), UINT16_C(49138), UINT16_C(49386), UINT16_C(49381), UINT16_C(49438), UINT16_C(16658), UINT16_C(16480), UINT16_C(49289) },
+      { SIMDE_FLOAT32_C(   -60.50), SIMDE_FLOAT32_C(    68.14), SIMDE_FLOAT32_C(   141.59), SIMDE_FLOAT32_C(  -137.32) } },
+    { { SIMDE_FLOAT32_C(    86.25), SIMDE_FLOAT32_C(   -90.73), SIMDE_FLOAT32_C(    96.54), SIMDE_FLOAT32_C(   -44.02) },
+      { UINT16_C(16413), UINT16_C(16307), UINT16_C(49422), UINT16_C(16646), UINT16_C(16658), UINT16_C(48686), UINT16_C(16538), UINT16_C(16652) },
+      { UINT16_C(16426), UINT16_C(48886), UINT16_C(16392), UINT16_C(16671), UINT16_C(49423), UINT16_C(49338), UINT16_C(16608), UINT16_C(16559) },
+      { SIMDE_FLOAT32_C(   156.46), SIMDE_FLOAT32_C(  -137.11), SIMDE_FLOAT32_C(   218.04), SIMDE_FLOAT32_C(   -43.05) } },
+    { { SIMDE_FLOAT32_C(    63.23), SIMDE_FLOAT32_C(    77.04), SIMDE_FLOAT32_C(   -20.54), SIMDE_FLOAT32_C(   -79.23) },
+      { UINT16_C(49388), UINT16_C(16500), UINT16_C(49425), UINT16_C(49332), UINT16_C(16322), UINT16_C(49361), UINT16_C(49322), UINT16_C(49348) },
+      { UINT16_C(49417), UINT16_C(49288), UINT16_C(48873), UINT16_C(16272), UINT16_C(16535), UINT16_C(16655), UINT16_C(49415), UINT16_C(49186) },
+      { SIMDE_FLOAT32_C(   107.97), SIMDE_FLOAT32_C(   167.02), SIMDE_FLOAT32_C(   -10.23), SIMDE_FLOAT32_C(   -70.12) } },
+    { { SIMDE_FLOAT32_C(    66.92), SIMDE_FLOAT32_C(    95.31), SIMDE_FLOAT32_C(    -4.56), SIMDE_FLOAT32_C(    60.68) },
+      { UINT16_C(16340), UINT16_C(16177), UINT16_C(49290), UINT16_C(16488), UINT16_C(49324), UINT16_C(16404), UINT16_C(16639), UINT16_C(49233) },
+      { UINT16_C(16533), UINT16_C(49066), UINT16_C(16592), UINT16_C(49160), UINT16_C(16226), UINT16_C(16664), UINT16_C(49418), UINT16_C(16651) },
+      { SIMDE_FLOAT32_C(    37.98), SIMDE_FLOAT32_C(   172.03), SIMDE_FLOAT32_C(    26.08), SIMDE_FLOAT32_C(   -19.20) } },
+    { { SIMDE_FLOAT32_C(   -23.91), SIMDE_FLOAT32_C(   -99.79), SIMDE_FLOAT32_C(   -61.26), SIMDE_FLOAT32_C(    93.34) },
+      { UINT16_C(49200), UINT16_C(16344), UINT16_C(16363), UINT16_C(48958), UINT16_C(16398), UINT16_C(16416), UINT16_C(49418), UINT16_C(16657) },
+      { UINT16_C(16344), UINT16_C(48787), UINT16_C(16551), UINT16_C(16516), UINT16_C(16404), UINT16_C(16476), UINT16_C(49360), UINT16_C(16636) },
+      { SIMDE_FLOAT32_C(   -22.52), SIMDE_FLOAT32_C(  -118.13), SIMDE_FLOAT32_C(   -65.86), SIMDE_FLOAT32_C(   234.49) } },
+    { { SIMDE_FLOAT32_C(    88.42), SIMDE_FLOAT32_C(    24.48), SIMDE_FLOAT32_C(   -92.21), SIMDE_FLOAT32_C(    37.94) },
+      { UINT16_C(16561), UINT16_C(49248), UINT16_C(16537), UINT16_C(16643), UINT16_C(48599), UINT16_C(16545), UINT16_C(16651), UINT16_C(49372) },
+      { UINT16_C(16514), UINT16_C(16629), UINT16_C(49419), UINT16_C(16380), UINT16_C(16653), UINT16_C(49407), UINT16_C(49394), UINT16_C(49411) },
+      { SIMDE_FLOAT32_C(    58.68), SIMDE_FLOAT32_C(    -2.08), SIMDE_FLOAT32_C(  -143.12), SIMDE_FLOAT32_C(   -12.49) } },
+    { { SIMDE_FLOAT32_C(    10.18), SIMDE_FLOAT32_C(    51.15), SIMDE_FLOAT32_C(   -42.85), SIMDE_FLOAT32_C(    39.05) },
+      { UINT16_C(16649), UINT16_C(49264), UINT16_C(49254), UINT16_C(16548), UINT16_C(16521), UINT16_C(49431), UINT16_C(49140), UINT16_C(16418) },
+      { UINT16_C(16009), UINT16_C(16651), UINT16_C(49342), UINT16_C(49274), UINT16_C(49361), UINT16_C(16461), UINT16_C(49401), UINT16_C(16447) },
+      { SIMDE_FLOAT32_C(   -18.79), SIMDE_FLOAT32_C(    26.47), SIMDE_FLOAT32_C(  -122.26), SIMDE_FLOAT32_C(     3.25) } },
+    { { SIMDE_FLOAT32_C(   -61.12), SIMDE_FLOAT32_C(   -70.62), SIMDE_FLOAT32_C(   -56.73), SIMDE_FLOAT32_C(   -83.23) },
+      { UINT16_C(16393), UINT16_C(49155), UINT16_C(16319), UINT16_C(49432), UINT16_C(16298), UINT16_C(16134), UINT16_C(49436), UINT16_C(16442) },
+      { UINT16_C(49096), UINT16_C(16435), UINT16_C(16440), UINT16_C(16502), UINT16_C(15639), UINT16_C(49200), UINT16_C(49430), UINT16_C(16367) },
+      { SIMDE_FLOAT32_C(  -102.42), SIMDE_FLOAT32_C(   -96.64), SIMDE_FLOAT32_C(   -74.20), SIMDE_FLOAT32_C(    12.21) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t r_ = simde_vld1q_f32(test_vec[i].r_);
+    simde_bfloat16x8_t a = simde_vreinterpretq_bf16_u16(simde_vld1q_u16(test_vec[i].a));
+    simde_bfloat16x8_t b = simde_vreinterpretq_bf16_u16(simde_vld1q_u16(test_vec[i].b));
+    simde_float32x4_t r = simde_vbfmmlaq_f32(r_, a, b);
+
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 2);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32x4_t r_ = simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-100.0), SIMDE_FLOAT32_C(100.0));
+    simde_bfloat16x8_t a = simde_vcvtq_high_bf16_f32(
+      simde_vcvtq_low_bf16_f32(simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0))),
+      simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0)));
+    simde_bfloat16x8_t b = simde_vcvtq_high_bf16_f32(
+      simde_vcvtq_low_bf16_f32(simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0))),
+      simde_test_arm_neon_random_f32x4(SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0)));
+    simde_float32x4_t r = simde_vbfmmlaq_f32(r_, a, b);
+
+    simde_test_arm_neon_write_f32x4(2, r_, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_arm_neon_write_u16x8(2, simde_vreinterpretq_u16_bf16(a), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_u16x8(2, simde_vreinterpretq_u16_bf16(b), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_arm_neon_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vbfmmlaq_f32)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -475,6 +475,45 @@ test_simde___crc32cd(SIMDE_MUNIT_TEST_ARGS) {
 #endif
 }
 
+static int
+test_simde_x_crc32_buffer (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    size_t offset;
+    size_t len;
+    uint32_t crc;
+    uint32_t r;
+  } test_vec[] = {
+    {    0,    0, UINT32_C(0xffffffff), UINT32_C(0xffffffff) },
+    {    0,    1, UINT32_C(0xffffffff), UINT32_C(0x534c6ccf) },
+    {    3,    7, UINT32_C(0x12345678), UINT32_C(0x9cecc510) },
+    {    1,   63, UINT32_C(0xffffffff), UINT32_C(0xa2713214) },
+    {    0,   64, UINT32_C(0x00000000), UINT32_C(0xc9d9ff23) },
+    {    5,  100, UINT32_C(0xdeadbeef), UINT32_C(0x92758207) },
+    {    7,  255, UINT32_C(0xffffffff), UINT32_C(0xd2768a8a) },
+    {   16,  512, UINT32_C(0x9e3779b9), UINT32_C(0x351944cc) },
+    {   13, 1000, UINT32_C(0xffffffff), UINT32_C(0x0f5dd180) },
+    {    0, 1024, UINT32_C(0xffffffff), UINT32_C(0xe4cc2c88) },
+    /* Long enough to go around the 64-byte fold loop many times. */
+    {    0,  128, UINT32_C(0xffffffff), UINT32_C(0xdc2e265f) },
+    {   64, 4096, UINT32_C(0x00000000), UINT32_C(0x901f0e03) },
+    {    3, 4157, UINT32_C(0x12345678), UINT32_C(0xb771d382) },
+    {    1, 4223, UINT32_C(0xffffffff), UINT32_C(0xad09d202) },
+  };
+  uint8_t data[4224];
+
+  for (size_t i = 0 ; i < sizeof(data) ; i++)
+    data[i] = HEDLEY_STATIC_CAST(uint8_t, (i * 167 + 13) ^ (i >> 3));
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_x_crc32_buffer(test_vec[i].crc, data + test_vec[i].offset, test_vec[i].len);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  simde_assert_equal_u32(~simde_x_crc32_buffer(~UINT32_C(0), "123456789", 9), UINT32_C(0xcbf43926));
+
+  return 0;
+}
+
 SIMDE_TEST_FUNC_LIST_BEGIN
 SIMDE_TEST_FUNC_LIST_ENTRY(__crc32b)
 SIMDE_TEST_FUNC_LIST_ENTRY(__crc32h)
@@ -485,6 +524,8 @@ SIMDE_TEST_FUNC_LIST_ENTRY(__crc32cb)
 SIMDE_TEST_FUNC_LIST_ENTRY(__crc32ch)
 SIMDE_TEST_FUNC_LIST_ENTRY(__crc32cw)
 SIMDE_TEST_FUNC_LIST_ENTRY(__crc32cd)
+
+SIMDE_TEST_FUNC_LIST_ENTRY(x_crc32_buffer)
 SIMDE_TEST_FUNC_LIST_END
 
 #include "test-neon-footer.h"
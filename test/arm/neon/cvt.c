@@ -2,6 +2,7 @@
 
 #include "test-neon.h"
 #include "../../../simde/arm/neon/cvt.h"
+#include "../../../simde/arm/neon/reinterpret.h"
 
 static int
 test_simde_vcvth_s16_f16 (SIMDE_MUNIT_TEST_ARGS) {
@@ -3706,6 +3707,220 @@ test_simde_vcvtx_high_f32_f64 (SIMDE_MUNIT_TEST_ARGS) {
 #endif
 }
 
+static int
+test_simde_vcvt_f32_bf16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t a[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    { { UINT16_C(17298), UINT16_C(32704), UINT16_C(65408), UINT16_C(32640) },
+      { UINT32_C(1133641728), UINT32_C(2143289344), UINT32_C(4286578688), UINT32_C(2139095040) } },
+    { { UINT16_C(17163), UINT16_C(    1), UINT16_C(32768), UINT16_C(32639) },
+      { UINT32_C(1124794368), UINT32_C(     65536), UINT32_C(2147483648), UINT32_C(2139029504) } },
+    { { UINT16_C(17521), UINT16_C(32673), UINT16_C(50273), UINT16_C(50284) },
+      { UINT32_C(1148256256), UINT32_C(2141257728), UINT32_C(3294691328), UINT32_C(3295412224) } },
+    { { UINT16_C(16804), UINT16_C(17419), UINT16_C(50201), UINT16_C(50203) },
+      { UINT32_C(1101266944), UINT32_C(1141571584), UINT32_C(3289972736), UINT32_C(3290103808) } },
+    { { UINT16_C(17360), UINT16_C(17521), UINT16_C(17500), UINT16_C(17291) },
+      { UINT32_C(1137704960), UINT32_C(1148256256), UINT32_C(1146880000), UINT32_C(1133182976) } },
+    { { UINT16_C(17491), UINT16_C(50066), UINT16_C(17486), UINT16_C(17215) },
+      { UINT32_C(1146290176), UINT32_C(3281125376), UINT32_C(1145962496), UINT32_C(1128202240) } },
+    { { UINT16_C(17081), UINT16_C(50194), UINT16_C(50176), UINT16_C(50282) },
+      { UINT32_C(1119420416), UINT32_C(3289513984), UINT32_C(3288334336), UINT32_C(3295281152) } },
+    { { UINT16_C(17422), UINT16_C(17107), UINT16_C(50052), UINT16_C(17524) },
+      { UINT32_C(1141768192), UINT32_C(1121124352), UINT32_C(3280207872), UINT32_C(1148452864) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_bfloat16x4_t a = simde_vreinterpret_bf16_u16(simde_vld1_u16(test_vec[i].a));
+    simde_float32x4_t r = simde_vcvt_f32_bf16(a);
+
+    simde_test_arm_neon_assert_equal_u32x4(simde_vreinterpretq_u32_f32(r), simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtq_low_f32_bf16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t a[8];
+    uint32_t r[4];
+  } test_vec[] = {
+    { { UINT16_C(32704), UINT16_C(65408), UINT16_C(17179), UINT16_C(50096), UINT16_C(32640), UINT16_C(49838), UINT16_C(17409), UINT16_C(17307) },
+      { UINT32_C(2143289344), UINT32_C(4286578688), UINT32_C(1125842944), UINT32_C(3283091456) } },
+    { { UINT16_C(17409), UINT16_C(17450), UINT16_C(    1), UINT16_C(17223), UINT16_C(32768), UINT16_C(32639), UINT16_C(32673), UINT16_C(50059) },
+      { UINT32_C(1140916224), UINT32_C(1143603200), UINT32_C(     65536), UINT32_C(1128726528) } },
+    { { UINT16_C(17127), UINT16_C(17319), UINT16_C(50144), UINT16_C(50145), UINT16_C(17291), UINT16_C(50224), UINT16_C(50069), UINT16_C(17382) },
+      { UINT32_C(1122435072), UINT32_C(1135017984), UINT32_C(3286237184), UINT32_C(3286302720) } },
+    { { UINT16_C(17272), UINT16_C(17436), UINT16_C(17052), UINT16_C(17166), UINT16_C(16532), UINT16_C(50025), UINT16_C(50077), UINT16_C(50174) },
+      { UINT32_C(1131937792), UINT32_C(1142685696), UINT32_C(1117519872), UINT32_C(1124990976) } },
+    { { UINT16_C(17200), UINT16_C(16680), UINT16_C(17171), UINT16_C(17339), UINT16_C(50195), UINT16_C(50196), UINT16_C(50226), UINT16_C(49890) },
+      { UINT32_C(1127219200), UINT32_C(1093140480), UINT32_C(1125318656), UINT32_C(1136328704) } },
+    { { UINT16_C(17170), UINT16_C(17412), UINT16_C(50162), UINT16_C(50292), UINT16_C(17188), UINT16_C(50200), UINT16_C(50227), UINT16_C(50212) },
+      { UINT32_C(1125253120), UINT32_C(1141112832), UINT32_C(3287416832), UINT32_C(3295936512) } },
+    { { UINT16_C(17333), UINT16_C(17383), UINT16_C(50161), UINT16_C(17484), UINT16_C(50230), UINT16_C(17281), UINT16_C(17393), UINT16_C(50223) },
+      { UINT32_C(1135935488), UINT32_C(1139212288), UINT32_C(3287351296), UINT32_C(1145831424) } },
+    { { UINT16_C(17503), UINT16_C(50183), UINT16_C(17403), UINT16_C(17426), UINT16_C(50259), UINT16_C(16800), UINT16_C(50178), UINT16_C(49954) },
+      { UINT32_C(1147076608), UINT32_C(3288793088), UINT32_C(1140523008), UINT32_C(1142030336) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_bfloat16x8_t a = simde_vreinterpretq_bf16_u16(simde_vld1q_u16(test_vec[i].a));
+    simde_float32x4_t r = simde_vcvtq_low_f32_bf16(a);
+
+    simde_test_arm_neon_assert_equal_u32x4(simde_vreinterpretq_u32_f32(r), simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtq_high_f32_bf16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t a[8];
+    uint32_t r[4];
+  } test_vec[] = {
+    { { UINT16_C(17431), UINT16_C(17201), UINT16_C(32704), UINT16_C(50067), UINT16_C(16900), UINT16_C(65408), UINT16_C(32640), UINT16_C(    1) },
+      { UINT32_C(1107558400), UINT32_C(4286578688), UINT32_C(2139095040), UINT32_C(     65536) } },
+    { { UINT16_C(32768), UINT16_C(50112), UINT16_C(17258), UINT16_C(49957), UINT16_C(32639), UINT16_C(17510), UINT16_C(17483), UINT16_C(32673) },
+      { UINT32_C(2139029504), UINT32_C(1147535360), UINT32_C(1145765888), UINT32_C(2141257728) } },
+    { { UINT16_C(17461), UINT16_C(50086), UINT16_C(17391), UINT16_C(49427), UINT16_C(50207), UINT16_C(16863), UINT16_C(50262), UINT16_C(50206) },
+      { UINT32_C(3290365952), UINT32_C(1105133568), UINT32_C(3293970432), UINT32_C(3290300416) } },
+    { { UINT16_C(50069), UINT16_C(17427), UINT16_C(50268), UINT16_C(17443), UINT16_C(17495), UINT16_C(50237), UINT16_C(17339), UINT16_C(17215) },
+      { UINT32_C(1146552320), UINT32_C(3292332032), UINT32_C(1136328704), UINT32_C(1128202240) } },
+    { { UINT16_C(50084), UINT16_C(50123), UINT16_C(17330), UINT16_C(17239), UINT16_C(50202), UINT16_C(50271), UINT16_C(49994), UINT16_C(17193) },
+      { UINT32_C(3290038272), UINT32_C(3294560256), UINT32_C(3276406784), UINT32_C(1126760448) } },
+    { { UINT16_C(17367), UINT16_C(50136), UINT16_C(50154), UINT16_C(50102), UINT16_C(17481), UINT16_C(49828), UINT16_C(17481), UINT16_C(17528) },
+      { UINT32_C(1145634816), UINT32_C(3265527808), UINT32_C(1145634816), UINT32_C(1148715008) } },
+    { { UINT16_C(50271), UINT16_C(50286), UINT16_C(17020), UINT16_C(17440), UINT16_C(17362), UINT16_C(49800), UINT16_C(50223), UINT16_C(17472) },
+      { UINT32_C(1137836032), UINT32_C(3263692800), UINT32_C(3291414528), UINT32_C(1145044992) } },
+    { { UINT16_C(17282), UINT16_C(17444), UINT16_C(17443), UINT16_C(49992), UINT16_C(50070), UINT16_C(50274), UINT16_C(50254), UINT16_C(17452) },
+      { UINT32_C(3281387520), UINT32_C(3294756864), UINT32_C(3293446144), UINT32_C(1143734272) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_bfloat16x8_t a = simde_vreinterpretq_bf16_u16(simde_vld1q_u16(test_vec[i].a));
+    simde_float32x4_t r = simde_vcvtq_high_f32_bf16(a);
+
+    simde_test_arm_neon_assert_equal_u32x4(simde_vreinterpretq_u32_f32(r), simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvt_bf16_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a[4];
+    uint16_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(1065385984), UINT32_C(1145984274), UINT32_C(3272691245), UINT32_C(1065451520) },
+      { UINT16_C(16256), UINT16_C(17486), UINT16_C(49937), UINT16_C(16258) } },
+    { { UINT32_C(3287718370), UINT32_C(1065418751), UINT32_C(2139095039), UINT32_C(3295429449) },
+      { UINT16_C(50167), UINT16_C(16257), UINT16_C(32640), UINT16_C(50284) } },
+    { { UINT32_C(1119055800), UINT32_C(2139095040), UINT32_C(4286578688), UINT32_C(2143289344) },
+      { UINT16_C(17075), UINT16_C(32640), UINT16_C(65408), UINT16_C(32704) } },
+    { { UINT32_C(2139095041), UINT32_C(3296291777), UINT32_C(3283576947), UINT32_C(3294834697) },
+      { UINT16_C(32704), UINT16_C(50297), UINT16_C(50103), UINT16_C(50275) } },
+    { { UINT32_C(1147796175), UINT32_C(4288750405), UINT32_C(3295106357), UINT32_C(3279842261) },
+      { UINT16_C(17514), UINT16_C(65505), UINT16_C(50279), UINT16_C(50046) } },
+    { { UINT32_C(3282638381), UINT32_C(     74565), UINT32_C(2147483648), UINT32_C(         0) },
+      { UINT16_C(50089), UINT16_C(    1), UINT16_C(32768), UINT16_C(    0) } },
+    { { UINT32_C(3288642503), UINT32_C(1199570943), UINT32_C(3270961529), UINT32_C(1051372203) },
+      { UINT16_C(50181), UINT16_C(18304), UINT16_C(49911), UINT16_C(16043) } },
+    { { UINT32_C(3289730212), UINT32_C(1148467675), UINT32_C(2155872255), UINT32_C(1145970283) },
+      { UINT16_C(50197), UINT16_C(17524), UINT16_C(32896), UINT16_C(17486) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vreinterpretq_f32_u32(simde_vld1q_u32(test_vec[i].a));
+    simde_bfloat16x4_t r = simde_vcvt_bf16_f32(a);
+
+    simde_test_arm_neon_assert_equal_u16x4(simde_vreinterpret_u16_bf16(r), simde_vld1_u16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtq_low_bf16_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a[4];
+    uint16_t r[8];
+  } test_vec[] = {
+    { { UINT32_C(1065385984), UINT32_C(1143042947), UINT32_C(1065451520), UINT32_C(1065418751) },
+      { UINT16_C(16256), UINT16_C(17441), UINT16_C(16258), UINT16_C(16257), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { UINT32_C(2139095039), UINT32_C(2139095040), UINT32_C(1137461509), UINT32_C(4286578688) },
+      { UINT16_C(32640), UINT16_C(32640), UINT16_C(17356), UINT16_C(65408), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { UINT32_C(2143289344), UINT32_C(3283223225), UINT32_C(2139095041), UINT32_C(4288750405) },
+      { UINT16_C(32704), UINT16_C(50098), UINT16_C(32704), UINT16_C(65505), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { UINT32_C(     74565), UINT32_C(2147483648), UINT32_C(         0), UINT32_C(1199570943) },
+      { UINT16_C(    1), UINT16_C(32768), UINT16_C(    0), UINT16_C(18304), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { UINT32_C(3270961529), UINT32_C(1051372203), UINT32_C(3295825802), UINT32_C(1146274863) },
+      { UINT16_C(49911), UINT16_C(16043), UINT16_C(50290), UINT16_C(17491), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { UINT32_C(3291766792), UINT32_C(2155872255), UINT32_C(1141016096), UINT32_C(1131166368) },
+      { UINT16_C(50228), UINT16_C(32896), UINT16_C(17411), UINT16_C(17260), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { UINT32_C(1146883249), UINT32_C(3293186411), UINT32_C(3294638348), UINT32_C(1140604954) },
+      { UINT16_C(17500), UINT16_C(50250), UINT16_C(50272), UINT16_C(17404), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { UINT32_C(1148083777), UINT32_C(3291279979), UINT32_C(3292667416), UINT32_C(1141493121) },
+      { UINT16_C(17518), UINT16_C(50221), UINT16_C(50242), UINT16_C(17418), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vreinterpretq_f32_u32(simde_vld1q_u32(test_vec[i].a));
+    simde_bfloat16x8_t r = simde_vcvtq_low_bf16_f32(a);
+
+    simde_test_arm_neon_assert_equal_u16x8(simde_vreinterpretq_u16_bf16(r), simde_vld1q_u16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtq_high_bf16_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t inactive[8];
+    uint32_t a[4];
+    uint16_t r[8];
+  } test_vec[] = {
+    { { UINT16_C(32704), UINT16_C(65408), UINT16_C(17493), UINT16_C(32640), UINT16_C(17220), UINT16_C(    1), UINT16_C(32768), UINT16_C(50066) },
+      { UINT32_C(1065385984), UINT32_C(1065451520), UINT32_C(1065418751), UINT32_C(3236816558) },
+      { UINT16_C(32704), UINT16_C(65408), UINT16_C(17493), UINT16_C(32640), UINT16_C(16256), UINT16_C(16258), UINT16_C(16257), UINT16_C(49390) } },
+    { { UINT16_C(17304), UINT16_C(32639), UINT16_C(50201), UINT16_C(50237), UINT16_C(32673), UINT16_C(50205), UINT16_C(17515), UINT16_C(17392) },
+      { UINT32_C(2139095039), UINT32_C(3289971984), UINT32_C(2139095040), UINT32_C(4286578688) },
+      { UINT16_C(17304), UINT16_C(32639), UINT16_C(50201), UINT16_C(50237), UINT16_C(32640), UINT16_C(50201), UINT16_C(32640), UINT16_C(65408) } },
+    { { UINT16_C(50110), UINT16_C(17429), UINT16_C(17436), UINT16_C(50226), UINT16_C(17491), UINT16_C(50102), UINT16_C(17401), UINT16_C(49925) },
+      { UINT32_C(2143289344), UINT32_C(1133179228), UINT32_C(2139095041), UINT32_C(3271635685) },
+      { UINT16_C(50110), UINT16_C(17429), UINT16_C(17436), UINT16_C(50226), UINT16_C(32704), UINT16_C(17291), UINT16_C(32704), UINT16_C(49921) } },
+    { { UINT16_C(50207), UINT16_C(49652), UINT16_C(50137), UINT16_C(17408), UINT16_C(50204), UINT16_C(50215), UINT16_C(17199), UINT16_C(17290) },
+      { UINT32_C(1135026956), UINT32_C(1132997046), UINT32_C(3294764349), UINT32_C(4288750405) },
+      { UINT16_C(50207), UINT16_C(49652), UINT16_C(50137), UINT16_C(17408), UINT16_C(17319), UINT16_C(17288), UINT16_C(50274), UINT16_C(65505) } },
+    { { UINT16_C(50269), UINT16_C(50279), UINT16_C(17365), UINT16_C(17289), UINT16_C(50226), UINT16_C(50248), UINT16_C(17403), UINT16_C(17210) },
+      { UINT32_C(3291805491), UINT32_C(3289633210), UINT32_C(     74565), UINT32_C(2147483648) },
+      { UINT16_C(50269), UINT16_C(50279), UINT16_C(17365), UINT16_C(17289), UINT16_C(50229), UINT16_C(50196), UINT16_C(    1), UINT16_C(32768) } },
+    { { UINT16_C(49731), UINT16_C(50235), UINT16_C(50110), UINT16_C(50218), UINT16_C(50048), UINT16_C(50269), UINT16_C(17218), UINT16_C(17173) },
+      { UINT32_C(3292519137), UINT32_C(3283262021), UINT32_C(         0), UINT32_C(1199570943) },
+      { UINT16_C(49731), UINT16_C(50235), UINT16_C(50110), UINT16_C(50218), UINT16_C(50240), UINT16_C(50099), UINT16_C(    0), UINT16_C(18304) } },
+    { { UINT16_C(50064), UINT16_C(50113), UINT16_C(49908), UINT16_C(50133), UINT16_C(17338), UINT16_C(17472), UINT16_C(17448), UINT16_C(17428) },
+      { UINT32_C(3270961529), UINT32_C(3292616485), UINT32_C(3282135398), UINT32_C(1051372203) },
+      { UINT16_C(50064), UINT16_C(50113), UINT16_C(49908), UINT16_C(50133), UINT16_C(49911), UINT16_C(50241), UINT16_C(50081), UINT16_C(16043) } },
+    { { UINT16_C(50174), UINT16_C(50198), UINT16_C(50217), UINT16_C(50139), UINT16_C(17462), UINT16_C(17484), UINT16_C(50278), UINT16_C(17294) },
+      { UINT32_C(3287230088), UINT32_C(1139102506), UINT32_C(1144986684), UINT32_C(3285305182) },
+      { UINT16_C(50174), UINT16_C(50198), UINT16_C(50217), UINT16_C(50139), UINT16_C(50159), UINT16_C(17381), UINT16_C(17471), UINT16_C(50130) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_bfloat16x8_t inactive = simde_vreinterpretq_bf16_u16(simde_vld1q_u16(test_vec[i].inactive));
+    simde_float32x4_t a = simde_vreinterpretq_f32_u32(simde_vld1q_u32(test_vec[i].a));
+    simde_bfloat16x8_t r = simde_vcvtq_high_bf16_f32(inactive, a);
+
+    simde_test_arm_neon_assert_equal_u16x8(simde_vreinterpretq_u16_bf16(r), simde_vld1q_u16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
 SIMDE_TEST_FUNC_LIST_BEGIN
 SIMDE_TEST_FUNC_LIST_ENTRY(vcvth_s16_f16)
 SIMDE_TEST_FUNC_LIST_ENTRY(vcvth_s32_f16)
@@ -3791,6 +4006,13 @@ SIMDE_TEST_FUNC_LIST_ENTRY(vcvt_high_f64_f32)
 SIMDE_TEST_FUNC_LIST_ENTRY(vcvtxd_f32_f64)
 SIMDE_TEST_FUNC_LIST_ENTRY(vcvtx_f32_f64)
 SIMDE_TEST_FUNC_LIST_ENTRY(vcvtx_high_f32_f64)
+
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvt_f32_bf16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtq_low_f32_bf16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtq_high_f32_bf16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvt_bf16_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtq_low_bf16_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vcvtq_high_bf16_f32)
 SIMDE_TEST_FUNC_LIST_END
 
 #include "test-neon-footer.h"
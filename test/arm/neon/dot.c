@@ -45,6 +45,14 @@ test_simde_vdot_s32 (SIMDE_MUNIT_TEST_ARGS) {
       {  INT8_C(  65), -INT8_C(  16), -INT8_C(  22),  INT8_C(  41), -INT8_C(  58), -INT8_C(  57), -INT8_C( 116), -INT8_C(  90) },
       { -INT8_C(  24), -INT8_C( 122), -INT8_C(  17),  INT8_C(  70), -INT8_C(  11),  INT8_C(  31),  INT8_C(  36),  INT8_C(  64) },
       { -INT32_C(   611599712), -INT32_C(  1472634523) } },
+    { {              INT32_MAX,              INT32_MIN },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN },
+      { -INT32_C(  2147418113), -INT32_C(  2147418112) } },
+    { {  INT32_C(           0), -INT32_C(           1) },
+      {      INT8_MIN,      INT8_MAX, -INT8_C(   1),      INT8_MIN,  INT8_C(   1),      INT8_MIN,      INT8_MAX, -INT8_C( 127) },
+      {      INT8_MIN,  INT8_C(   1),      INT8_MIN,      INT8_MAX, -INT8_C( 127),      INT8_MIN,      INT8_MAX, -INT8_C(   1) },
+      {  INT32_C(         383),  INT32_C(       32512) } },
 
   };
 
@@ -116,6 +124,14 @@ test_simde_vdot_u32 (SIMDE_MUNIT_TEST_ARGS) {
       { UINT8_C( 86), UINT8_C( 49), UINT8_C(118), UINT8_C( 67), UINT8_C(112), UINT8_C(211), UINT8_C(  2), UINT8_C(168) },
       { UINT8_C( 96), UINT8_C( 41), UINT8_C(112), UINT8_C(212), UINT8_C(123), UINT8_C(235), UINT8_C( 31), UINT8_C(136) },
       { UINT32_C( 120950527), UINT32_C( 741414865) } },
+    { {           UINT32_MAX, UINT32_C(4294967294) },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      { UINT32_C(    260099), UINT32_C(    260098) } },
+    { { UINT32_C(         1), UINT32_C(         0) },
+      {    UINT8_MAX, UINT8_C(128), UINT8_C(127),    UINT8_MAX, UINT8_C(  0),    UINT8_MAX, UINT8_C(  1), UINT8_C(128) },
+      {    UINT8_MAX, UINT8_C(  0),    UINT8_MAX, UINT8_C(  1), UINT8_C(128),    UINT8_MAX, UINT8_C(128), UINT8_C(127) },
+      { UINT32_C(     97666), UINT32_C(     81409) } },
 
   };
 
@@ -202,6 +218,18 @@ test_simde_vdotq_s32 (SIMDE_MUNIT_TEST_ARGS) {
       { -INT8_C(  10),  INT8_C(  48),  INT8_C(  32), -INT8_C(  56),  INT8_C( 122),  INT8_C(  99), -INT8_C( 123),  INT8_C(  30),
          INT8_C( 113), -INT8_C( 108),  INT8_C(  71), -INT8_C( 102),  INT8_C(  32), -INT8_C(  47),  INT8_C( 110), -INT8_C(  63) },
       { -INT32_C(  1226590506), -INT32_C(  1119725530),  INT32_C(   688854998), -INT32_C(   729186406) } },
+    { {              INT32_MAX,              INT32_MIN, -INT32_C(           1),  INT32_C(           0) },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN },
+      { -INT32_C(  2147418113), -INT32_C(  2147418112),  INT32_C(       65535),  INT32_C(       65536) } },
+    { {  INT32_C(           0), -INT32_C(           1),              INT32_MIN,              INT32_MAX },
+      {      INT8_MIN,      INT8_MAX, -INT8_C(   1),      INT8_MIN,  INT8_C(   1),      INT8_MIN,      INT8_MAX, -INT8_C( 127),
+             INT8_MIN,      INT8_MAX, -INT8_C(   1),      INT8_MIN,  INT8_C(   1),      INT8_MIN,      INT8_MAX, -INT8_C( 127) },
+      {      INT8_MIN,  INT8_C(   1),      INT8_MIN,      INT8_MAX, -INT8_C( 127),      INT8_MIN,      INT8_MAX, -INT8_C(   1),
+             INT8_MIN,  INT8_C(   1),      INT8_MIN,      INT8_MAX, -INT8_C( 127),      INT8_MIN,      INT8_MAX, -INT8_C(   1) },
+      {  INT32_C(         383),  INT32_C(       32512), -INT32_C(  2147483265), -INT32_C(  2147451136) } },
 
   };
 
@@ -288,6 +316,18 @@ test_simde_vdotq_u32 (SIMDE_MUNIT_TEST_ARGS) {
       { UINT8_C(154), UINT8_C(254), UINT8_C(101), UINT8_C( 11), UINT8_C(108), UINT8_C(133), UINT8_C(115), UINT8_C(160),
         UINT8_C( 93), UINT8_C(158), UINT8_C(182), UINT8_C(174), UINT8_C( 55), UINT8_C( 62), UINT8_C(103), UINT8_C( 41) },
       { UINT32_C(1266286249), UINT32_C(1747042474), UINT32_C( 372008676), UINT32_C(3112701721) } },
+    { {           UINT32_MAX, UINT32_C(4294967294), UINT32_C(         0), UINT32_C(         1) },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,
+           UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,
+           UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+      { UINT32_C(    260099), UINT32_C(    260098), UINT32_C(    260100), UINT32_C(    260101) } },
+    { { UINT32_C(         1), UINT32_C(         0), UINT32_C(4294967294),           UINT32_MAX },
+      {    UINT8_MAX, UINT8_C(128), UINT8_C(127),    UINT8_MAX, UINT8_C(  0),    UINT8_MAX, UINT8_C(  1), UINT8_C(128),
+           UINT8_MAX, UINT8_C(128), UINT8_C(127),    UINT8_MAX, UINT8_C(  0),    UINT8_MAX, UINT8_C(  1), UINT8_C(128) },
+      {    UINT8_MAX, UINT8_C(  0),    UINT8_MAX, UINT8_C(  1), UINT8_C(128),    UINT8_MAX, UINT8_C(128), UINT8_C(127),
+           UINT8_MAX, UINT8_C(  0),    UINT8_MAX, UINT8_C(  1), UINT8_C(128),    UINT8_MAX, UINT8_C(128), UINT8_C(127) },
+      { UINT32_C(     97666), UINT32_C(     81409), UINT32_C(     97663), UINT32_C(     81408) } },
 
   };
 
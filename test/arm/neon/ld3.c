@@ -277,12 +277,615 @@ test_simde_vld3q_f16 (SIMDE_MUNIT_TEST_ARGS) {
 #endif
 }
 
+static int
+test_simde_vld3_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t a[24];
+    uint8_t r[3][8];
+  } test_vec[] = {
+    { {
+        UINT8_C(254), UINT8_C(184), UINT8_C(113), UINT8_C(237), UINT8_C(228), UINT8_C(232), UINT8_C(206), UINT8_C( 13),
+        UINT8_C(171), UINT8_C( 33), UINT8_C(243), UINT8_C(231), UINT8_C( 44), UINT8_C(151), UINT8_C(173), UINT8_C( 16),
+        UINT8_C(116), UINT8_C( 31), UINT8_C(163), UINT8_C(117), UINT8_C(  0), UINT8_C( 71), UINT8_C(200), UINT8_C(175)
+      },
+      {
+        { UINT8_C(254), UINT8_C(237), UINT8_C(206), UINT8_C( 33), UINT8_C( 44), UINT8_C( 16), UINT8_C(163), UINT8_C( 71) },
+        { UINT8_C(184), UINT8_C(228), UINT8_C( 13), UINT8_C(243), UINT8_C(151), UINT8_C(116), UINT8_C(117), UINT8_C(200) },
+        { UINT8_C(113), UINT8_C(232), UINT8_C(171), UINT8_C(231), UINT8_C(173), UINT8_C( 31), UINT8_C(  0), UINT8_C(175) },
+      } },
+    { {
+        UINT8_C( 16), UINT8_C(123), UINT8_C(197), UINT8_C( 31), UINT8_C(137), UINT8_C(207), UINT8_C( 67), UINT8_C(130),
+        UINT8_C(193), UINT8_C(218), UINT8_C(100), UINT8_C(101), UINT8_C(131), UINT8_C(232), UINT8_C(101), UINT8_C( 68),
+        UINT8_C( 69), UINT8_C(128), UINT8_C( 92), UINT8_C( 12), UINT8_C(194), UINT8_C(103), UINT8_C(174), UINT8_C(228)
+      },
+      {
+        { UINT8_C( 16), UINT8_C( 31), UINT8_C( 67), UINT8_C(218), UINT8_C(131), UINT8_C( 68), UINT8_C( 92), UINT8_C(103) },
+        { UINT8_C(123), UINT8_C(137), UINT8_C(130), UINT8_C(100), UINT8_C(232), UINT8_C( 69), UINT8_C( 12), UINT8_C(174) },
+        { UINT8_C(197), UINT8_C(207), UINT8_C(193), UINT8_C(101), UINT8_C(101), UINT8_C(128), UINT8_C(194), UINT8_C(228) },
+      } },
+    { {
+        UINT8_C(186), UINT8_C( 76), UINT8_C(222), UINT8_C(198), UINT8_C( 49), UINT8_C(101), UINT8_C( 30), UINT8_C(220),
+        UINT8_C( 92), UINT8_C(138), UINT8_C(122), UINT8_C( 32), UINT8_C(231), UINT8_C(221), UINT8_C(217), UINT8_C(165),
+        UINT8_C(202), UINT8_C( 65), UINT8_C(  1), UINT8_C(236), UINT8_C(  6), UINT8_C( 24), UINT8_C(174), UINT8_C( 80)
+      },
+      {
+        { UINT8_C(186), UINT8_C(198), UINT8_C( 30), UINT8_C(138), UINT8_C(231), UINT8_C(165), UINT8_C(  1), UINT8_C( 24) },
+        { UINT8_C( 76), UINT8_C( 49), UINT8_C(220), UINT8_C(122), UINT8_C(221), UINT8_C(202), UINT8_C(236), UINT8_C(174) },
+        { UINT8_C(222), UINT8_C(101), UINT8_C( 92), UINT8_C( 32), UINT8_C(217), UINT8_C( 65), UINT8_C(  6), UINT8_C( 80) },
+      } },
+    { {
+        UINT8_C(120), UINT8_C(196), UINT8_C(206), UINT8_C(245), UINT8_C(  3), UINT8_C(106), UINT8_C(228), UINT8_C(181),
+        UINT8_C(210), UINT8_C(223), UINT8_C(213), UINT8_C( 95), UINT8_C(155), UINT8_C( 35), UINT8_C(169), UINT8_C(161),
+        UINT8_C( 29), UINT8_C( 16), UINT8_C(186), UINT8_C(  3), UINT8_C(251), UINT8_C( 27), UINT8_C( 54), UINT8_C( 95)
+      },
+      {
+        { UINT8_C(120), UINT8_C(245), UINT8_C(228), UINT8_C(223), UINT8_C(155), UINT8_C(161), UINT8_C(186), UINT8_C( 27) },
+        { UINT8_C(196), UINT8_C(  3), UINT8_C(181), UINT8_C(213), UINT8_C( 35), UINT8_C( 29), UINT8_C(  3), UINT8_C( 54) },
+        { UINT8_C(206), UINT8_C(106), UINT8_C(210), UINT8_C( 95), UINT8_C(169), UINT8_C( 16), UINT8_C(251), UINT8_C( 95) },
+      } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x8x3_t r = simde_vld3_u8(test_vec[i].a);
+    simde_uint8x8x3_t expected = { {
+      simde_vld1_u8(test_vec[i].r[0]),
+      simde_vld1_u8(test_vec[i].r[1]),
+      simde_vld1_u8(test_vec[i].r[2])
+    } };
+
+    simde_test_arm_neon_assert_equal_u8x8x3(r, expected);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t a[12];
+    int16_t r[3][4];
+  } test_vec[] = {
+    { {
+        -INT16_C(21771), -INT16_C( 7969),  INT16_C( 5409), -INT16_C(28210), -INT16_C(13110),  INT16_C(  439), -INT16_C(26230), -INT16_C( 1834),
+        -INT16_C(11124), -INT16_C(15248), -INT16_C(13052),  INT16_C(18247)
+      },
+      {
+        { -INT16_C(21771), -INT16_C(28210), -INT16_C(26230), -INT16_C(15248) },
+        { -INT16_C( 7969), -INT16_C(13110), -INT16_C( 1834), -INT16_C(13052) },
+        {  INT16_C( 5409),  INT16_C(  439), -INT16_C(11124),  INT16_C(18247) },
+      } },
+    { {
+        -INT16_C(30247),  INT16_C(11760), -INT16_C(26671),  INT16_C(31552),  INT16_C(31599), -INT16_C( 6197), -INT16_C(14209),  INT16_C( 7144),
+        -INT16_C(11073), -INT16_C(23056),  INT16_C(18918), -INT16_C( 7258)
+      },
+      {
+        { -INT16_C(30247),  INT16_C(31552), -INT16_C(14209), -INT16_C(23056) },
+        {  INT16_C(11760),  INT16_C(31599),  INT16_C( 7144),  INT16_C(18918) },
+        { -INT16_C(26671), -INT16_C( 6197), -INT16_C(11073), -INT16_C( 7258) },
+      } },
+    { {
+        -INT16_C(18942),  INT16_C(13983), -INT16_C( 7092), -INT16_C(12395), -INT16_C(27146),  INT16_C(18826),  INT16_C(30814),  INT16_C( 1107),
+         INT16_C(29066), -INT16_C(21377), -INT16_C( 1617), -INT16_C(26181)
+      },
+      {
+        { -INT16_C(18942), -INT16_C(12395),  INT16_C(30814), -INT16_C(21377) },
+        {  INT16_C(13983), -INT16_C(27146),  INT16_C( 1107), -INT16_C( 1617) },
+        { -INT16_C( 7092),  INT16_C(18826),  INT16_C(29066), -INT16_C(26181) },
+      } },
+    { {
+        -INT16_C( 7559), -INT16_C(28673),  INT16_C(31070),  INT16_C( 7144), -INT16_C(11470), -INT16_C(16081), -INT16_C(17678), -INT16_C(11173),
+        -INT16_C(28683),  INT16_C(25410),  INT16_C(20804), -INT16_C(30439)
+      },
+      {
+        { -INT16_C( 7559),  INT16_C( 7144), -INT16_C(17678),  INT16_C(25410) },
+        { -INT16_C(28673), -INT16_C(11470), -INT16_C(11173),  INT16_C(20804) },
+        {  INT16_C(31070), -INT16_C(16081), -INT16_C(28683), -INT16_C(30439) },
+      } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x4x3_t r = simde_vld3_s16(test_vec[i].a);
+    simde_int16x4x3_t expected = { {
+      simde_vld1_s16(test_vec[i].r[0]),
+      simde_vld1_s16(test_vec[i].r[1]),
+      simde_vld1_s16(test_vec[i].r[2])
+    } };
+
+    simde_test_arm_neon_assert_equal_i16x4x3(r, expected);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3q_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t a[48];
+    uint8_t r[3][16];
+  } test_vec[] = {
+    { {
+        UINT8_C(125), UINT8_C(242), UINT8_C(173), UINT8_C(114), UINT8_C( 81), UINT8_C( 94), UINT8_C(153), UINT8_C( 45),
+        UINT8_C(127), UINT8_C(122), UINT8_C(121), UINT8_C( 38), UINT8_C(187), UINT8_C(244), UINT8_C( 15), UINT8_C(106),
+        UINT8_C( 14), UINT8_C( 37), UINT8_C(216), UINT8_C(161), UINT8_C( 30), UINT8_C( 39), UINT8_C( 68), UINT8_C(198),
+        UINT8_C( 85), UINT8_C(117), UINT8_C( 98), UINT8_C(168), UINT8_C(202), UINT8_C(208), UINT8_C(165), UINT8_C( 92),
+        UINT8_C( 66), UINT8_C(223), UINT8_C( 20), UINT8_C( 93), UINT8_C( 22), UINT8_C(206), UINT8_C(232), UINT8_C(  9),
+        UINT8_C(124), UINT8_C(159), UINT8_C(181), UINT8_C(105), UINT8_C(184), UINT8_C( 36), UINT8_C(107), UINT8_C( 68)
+      },
+      {
+        { UINT8_C(125), UINT8_C(114), UINT8_C(153), UINT8_C(122), UINT8_C(187), UINT8_C(106), UINT8_C(216), UINT8_C( 39),
+          UINT8_C( 85), UINT8_C(168), UINT8_C(165), UINT8_C(223), UINT8_C( 22), UINT8_C(  9), UINT8_C(181), UINT8_C( 36) },
+        { UINT8_C(242), UINT8_C( 81), UINT8_C( 45), UINT8_C(121), UINT8_C(244), UINT8_C( 14), UINT8_C(161), UINT8_C( 68),
+          UINT8_C(117), UINT8_C(202), UINT8_C( 92), UINT8_C( 20), UINT8_C(206), UINT8_C(124), UINT8_C(105), UINT8_C(107) },
+        { UINT8_C(173), UINT8_C( 94), UINT8_C(127), UINT8_C( 38), UINT8_C( 15), UINT8_C( 37), UINT8_C( 30), UINT8_C(198),
+          UINT8_C( 98), UINT8_C(208), UINT8_C( 66), UINT8_C( 93), UINT8_C(232), UINT8_C(159), UINT8_C(184), UINT8_C( 68) },
+      } },
+    { {
+        UINT8_C( 61), UINT8_C( 85), UINT8_C( 76), UINT8_C(  0), UINT8_C(196), UINT8_C(176), UINT8_C(214), UINT8_C(230),
+        UINT8_C( 95), UINT8_C(165), UINT8_C(130), UINT8_C(147), UINT8_C(158), UINT8_C(241), UINT8_C(217), UINT8_C(159),
+        UINT8_C( 54), UINT8_C(196), UINT8_C(168), UINT8_C( 56), UINT8_C(  6), UINT8_C(186), UINT8_C(175), UINT8_C(200),
+        UINT8_C(214), UINT8_C(236), UINT8_C(220), UINT8_C( 35), UINT8_C(245), UINT8_C(206), UINT8_C(253), UINT8_C(205),
+        UINT8_C(228), UINT8_C(  6), UINT8_C(231), UINT8_C(140), UINT8_C( 34), UINT8_C( 78), UINT8_C(205), UINT8_C( 93),
+        UINT8_C(201), UINT8_C( 97), UINT8_C(244), UINT8_C(161), UINT8_C( 20), UINT8_C(131), UINT8_C( 67), UINT8_C(162)
+      },
+      {
+        { UINT8_C( 61), UINT8_C(  0), UINT8_C(214), UINT8_C(165), UINT8_C(158), UINT8_C(159), UINT8_C(168), UINT8_C(186),
+          UINT8_C(214), UINT8_C( 35), UINT8_C(253), UINT8_C(  6), UINT8_C( 34), UINT8_C( 93), UINT8_C(244), UINT8_C(131) },
+        { UINT8_C( 85), UINT8_C(196), UINT8_C(230), UINT8_C(130), UINT8_C(241), UINT8_C( 54), UINT8_C( 56), UINT8_C(175),
+          UINT8_C(236), UINT8_C(245), UINT8_C(205), UINT8_C(231), UINT8_C( 78), UINT8_C(201), UINT8_C(161), UINT8_C( 67) },
+        { UINT8_C( 76), UINT8_C(176), UINT8_C( 95), UINT8_C(147), UINT8_C(217), UINT8_C(196), UINT8_C(  6), UINT8_C(200),
+          UINT8_C(220), UINT8_C(206), UINT8_C(228), UINT8_C(140), UINT8_C(205), UINT8_C( 97), UINT8_C( 20), UINT8_C(162) },
+      } },
+    { {
+        UINT8_C(204), UINT8_C(188), UINT8_C( 54), UINT8_C(137), UINT8_C(197), UINT8_C( 37), UINT8_C( 40), UINT8_C(224),
+        UINT8_C( 66), UINT8_C(156), UINT8_C(177), UINT8_C(191), UINT8_C( 84), UINT8_C( 30), UINT8_C(217), UINT8_C( 48),
+        UINT8_C(255), UINT8_C(246), UINT8_C(  3), UINT8_C(216), UINT8_C(158), UINT8_C(104), UINT8_C(130), UINT8_C(173),
+        UINT8_C(201), UINT8_C(172), UINT8_C( 36), UINT8_C(178), UINT8_C(229), UINT8_C(208), UINT8_C( 19), UINT8_C(129),
+        UINT8_C( 14), UINT8_C(160), UINT8_C( 81), UINT8_C(146), UINT8_C(219), UINT8_C(128), UINT8_C(  7), UINT8_C( 94),
+        UINT8_C( 77), UINT8_C( 68), UINT8_C(135), UINT8_C(117), UINT8_C( 97), UINT8_C( 11), UINT8_C( 50), UINT8_C(174)
+      },
+      {
+        { UINT8_C(204), UINT8_C(137), UINT8_C( 40), UINT8_C(156), UINT8_C( 84), UINT8_C( 48), UINT8_C(  3), UINT8_C(104),
+          UINT8_C(201), UINT8_C(178), UINT8_C( 19), UINT8_C(160), UINT8_C(219), UINT8_C( 94), UINT8_C(135), UINT8_C( 11) },
+        { UINT8_C(188), UINT8_C(197), UINT8_C(224), UINT8_C(177), UINT8_C( 30), UINT8_C(255), UINT8_C(216), UINT8_C(130),
+          UINT8_C(172), UINT8_C(229), UINT8_C(129), UINT8_C( 81), UINT8_C(128), UINT8_C( 77), UINT8_C(117), UINT8_C( 50) },
+        { UINT8_C( 54), UINT8_C( 37), UINT8_C( 66), UINT8_C(191), UINT8_C(217), UINT8_C(246), UINT8_C(158), UINT8_C(173),
+          UINT8_C( 36), UINT8_C(208), UINT8_C( 14), UINT8_C(146), UINT8_C(  7), UINT8_C( 68), UINT8_C( 97), UINT8_C(174) },
+      } },
+    { {
+        UINT8_C(182), UINT8_C(147), UINT8_C(225), UINT8_C( 83), UINT8_C(125), UINT8_C(193), UINT8_C(179), UINT8_C( 90),
+        UINT8_C(219), UINT8_C( 51), UINT8_C(234), UINT8_C(249), UINT8_C(  9), UINT8_C( 76), UINT8_C(109), UINT8_C(124),
+        UINT8_C(105), UINT8_C(217), UINT8_C(138), UINT8_C(250), UINT8_C(243), UINT8_C(209), UINT8_C( 94), UINT8_C(107),
+        UINT8_C(  4), UINT8_C( 17), UINT8_C(134), UINT8_C(149), UINT8_C(121), UINT8_C( 18), UINT8_C(230), UINT8_C( 95),
+        UINT8_C( 16), UINT8_C(138), UINT8_C( 35), UINT8_C(159), UINT8_C( 38), UINT8_C(239), UINT8_C(174), UINT8_C(191),
+        UINT8_C(  8), UINT8_C( 31), UINT8_C(255), UINT8_C(219), UINT8_C(223), UINT8_C(209), UINT8_C( 24), UINT8_C(180)
+      },
+      {
+        { UINT8_C(182), UINT8_C( 83), UINT8_C(179), UINT8_C( 51), UINT8_C(  9), UINT8_C(124), UINT8_C(138), UINT8_C(209),
+          UINT8_C(  4), UINT8_C(149), UINT8_C(230), UINT8_C(138), UINT8_C( 38), UINT8_C(191), UINT8_C(255), UINT8_C(209) },
+        { UINT8_C(147), UINT8_C(125), UINT8_C( 90), UINT8_C(234), UINT8_C( 76), UINT8_C(105), UINT8_C(250), UINT8_C( 94),
+          UINT8_C( 17), UINT8_C(121), UINT8_C( 95), UINT8_C( 35), UINT8_C(239), UINT8_C(  8), UINT8_C(219), UINT8_C( 24) },
+        { UINT8_C(225), UINT8_C(193), UINT8_C(219), UINT8_C(249), UINT8_C(109), UINT8_C(217), UINT8_C(243), UINT8_C(107),
+          UINT8_C(134), UINT8_C( 18), UINT8_C( 16), UINT8_C(159), UINT8_C(174), UINT8_C( 31), UINT8_C(223), UINT8_C(180) },
+      } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x16x3_t r = simde_vld3q_u8(test_vec[i].a);
+    simde_uint8x16x3_t expected = { {
+      simde_vld1q_u8(test_vec[i].r[0]),
+      simde_vld1q_u8(test_vec[i].r[1]),
+      simde_vld1q_u8(test_vec[i].r[2])
+    } };
+
+    simde_test_arm_neon_assert_equal_u8x16x3(r, expected);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3q_s8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t a[48];
+    int8_t r[3][16];
+  } test_vec[] = {
+    { {
+         INT8_C( 44),  INT8_C( 83),  INT8_C( 68),  INT8_C(117), -INT8_C(117), -INT8_C( 14),  INT8_C( 24), -INT8_C( 86),
+        -INT8_C( 49), -INT8_C( 54),  INT8_C( 98), -INT8_C( 71), -INT8_C( 60), -INT8_C( 16),  INT8_C(114),  INT8_C( 35),
+         INT8_C(126), -INT8_C(126), -INT8_C( 88), -INT8_C( 27), -INT8_C( 45), -INT8_C( 61),  INT8_C(121), -INT8_C( 16),
+         INT8_C(115), -INT8_C( 77), -INT8_C(  9),  INT8_C(114),  INT8_C( 86), -INT8_C( 51), -INT8_C(124), -INT8_C(121),
+        -INT8_C( 97), -INT8_C(  2),  INT8_C(  5),  INT8_C( 32),  INT8_C( 25),  INT8_C( 33), -INT8_C( 94), -INT8_C( 10),
+        -INT8_C(102), -INT8_C( 70), -INT8_C(124), -INT8_C(105), -INT8_C(  5),  INT8_C( 87),  INT8_C( 94),  INT8_C( 98)
+      },
+      {
+        {  INT8_C( 44),  INT8_C(117),  INT8_C( 24), -INT8_C( 54), -INT8_C( 60),  INT8_C( 35), -INT8_C( 88), -INT8_C( 61),
+           INT8_C(115),  INT8_C(114), -INT8_C(124), -INT8_C(  2),  INT8_C( 25), -INT8_C( 10), -INT8_C(124),  INT8_C( 87) },
+        {  INT8_C( 83), -INT8_C(117), -INT8_C( 86),  INT8_C( 98), -INT8_C( 16),  INT8_C(126), -INT8_C( 27),  INT8_C(121),
+          -INT8_C( 77),  INT8_C( 86), -INT8_C(121),  INT8_C(  5),  INT8_C( 33), -INT8_C(102), -INT8_C(105),  INT8_C( 94) },
+        {  INT8_C( 68), -INT8_C( 14), -INT8_C( 49), -INT8_C( 71),  INT8_C(114), -INT8_C(126), -INT8_C( 45), -INT8_C( 16),
+          -INT8_C(  9), -INT8_C( 51), -INT8_C( 97),  INT8_C( 32), -INT8_C( 94), -INT8_C( 70), -INT8_C(  5),  INT8_C( 98) },
+      } },
+    { {
+         INT8_C( 93),  INT8_C(120),  INT8_C( 43), -INT8_C(125),  INT8_C( 89), -INT8_C( 45),  INT8_C(  8),  INT8_C( 94),
+         INT8_C( 86), -INT8_C( 96), -INT8_C( 75), -INT8_C(123), -INT8_C(  3), -INT8_C( 45),  INT8_C(121), -INT8_C( 40),
+        -INT8_C( 82),  INT8_C( 63), -INT8_C( 25), -INT8_C( 85),  INT8_C( 43),  INT8_C( 96),  INT8_C(123), -INT8_C(119),
+         INT8_C(  4),  INT8_C( 70),  INT8_C(  7),  INT8_C(111), -INT8_C(120),  INT8_C( 56), -INT8_C( 53), -INT8_C( 26),
+         INT8_C( 20), -INT8_C(123), -INT8_C( 80), -INT8_C( 86), -INT8_C(106), -INT8_C(125),  INT8_C(127),  INT8_C(103),
+         INT8_C(109),  INT8_C(  3), -INT8_C( 58), -INT8_C( 39), -INT8_C(127), -INT8_C( 59), -INT8_C(  6), -INT8_C( 39)
+      },
+      {
+        {  INT8_C( 93), -INT8_C(125),  INT8_C(  8), -INT8_C( 96), -INT8_C(  3), -INT8_C( 40), -INT8_C( 25),  INT8_C( 96),
+           INT8_C(  4),  INT8_C(111), -INT8_C( 53), -INT8_C(123), -INT8_C(106),  INT8_C(103), -INT8_C( 58), -INT8_C( 59) },
+        {  INT8_C(120),  INT8_C( 89),  INT8_C( 94), -INT8_C( 75), -INT8_C( 45), -INT8_C( 82), -INT8_C( 85),  INT8_C(123),
+           INT8_C( 70), -INT8_C(120), -INT8_C( 26), -INT8_C( 80), -INT8_C(125),  INT8_C(109), -INT8_C( 39), -INT8_C(  6) },
+        {  INT8_C( 43), -INT8_C( 45),  INT8_C( 86), -INT8_C(123),  INT8_C(121),  INT8_C( 63),  INT8_C( 43), -INT8_C(119),
+           INT8_C(  7),  INT8_C( 56),  INT8_C( 20), -INT8_C( 86),  INT8_C(127),  INT8_C(  3), -INT8_C(127), -INT8_C( 39) },
+      } },
+    { {
+        -INT8_C( 86),  INT8_C( 83),  INT8_C( 83), -INT8_C( 57), -INT8_C(109), -INT8_C( 92),  INT8_C(125),  INT8_C( 30),
+         INT8_C( 27), -INT8_C( 50), -INT8_C( 81),  INT8_C(  5),  INT8_C(119),  INT8_C( 36),  INT8_C(114),  INT8_C(118),
+        -INT8_C( 43), -INT8_C( 23), -INT8_C( 37), -INT8_C( 90), -INT8_C( 24),  INT8_C(109),  INT8_C( 71),  INT8_C( 42),
+         INT8_C( 87),  INT8_C(110),  INT8_C( 59),  INT8_C( 66),  INT8_C(112), -INT8_C( 44), -INT8_C(100), -INT8_C( 12),
+        -INT8_C(102), -INT8_C(  7),  INT8_C( 60),  INT8_C( 32),  INT8_C(100), -INT8_C( 15),  INT8_C( 26), -INT8_C(105),
+         INT8_C(109), -INT8_C(110),  INT8_C( 19),  INT8_C( 52),  INT8_C(124), -INT8_C( 27), -INT8_C( 47), -INT8_C( 70)
+      },
+      {
+        { -INT8_C( 86), -INT8_C( 57),  INT8_C(125), -INT8_C( 50),  INT8_C(119),  INT8_C(118), -INT8_C( 37),  INT8_C(109),
+           INT8_C( 87),  INT8_C( 66), -INT8_C(100), -INT8_C(  7),  INT8_C(100), -INT8_C(105),  INT8_C( 19), -INT8_C( 27) },
+        {  INT8_C( 83), -INT8_C(109),  INT8_C( 30), -INT8_C( 81),  INT8_C( 36), -INT8_C( 43), -INT8_C( 90),  INT8_C( 71),
+           INT8_C(110),  INT8_C(112), -INT8_C( 12),  INT8_C( 60), -INT8_C( 15),  INT8_C(109),  INT8_C( 52), -INT8_C( 47) },
+        {  INT8_C( 83), -INT8_C( 92),  INT8_C( 27),  INT8_C(  5),  INT8_C(114), -INT8_C( 23), -INT8_C( 24),  INT8_C( 42),
+           INT8_C( 59), -INT8_C( 44), -INT8_C(102),  INT8_C( 32),  INT8_C( 26), -INT8_C(110),  INT8_C(124), -INT8_C( 70) },
+      } },
+    { {
+        -INT8_C( 99), -INT8_C( 38),  INT8_C( 80),  INT8_C(107),  INT8_C( 73),  INT8_C(112),  INT8_C( 38), -INT8_C(  3),
+         INT8_C( 89),  INT8_C( 56), -INT8_C( 53), -INT8_C( 23),  INT8_C( 63),  INT8_C( 78),  INT8_C( 45),  INT8_C( 12),
+        -INT8_C( 42), -INT8_C( 94),  INT8_C( 39), -INT8_C( 44), -INT8_C(101), -INT8_C( 11), -INT8_C( 87), -INT8_C( 81),
+        -INT8_C( 43),  INT8_C( 13),  INT8_C( 34),  INT8_C( 65), -INT8_C( 78),  INT8_C(111),  INT8_C( 98), -INT8_C( 49),
+         INT8_C( 92), -INT8_C( 47), -INT8_C(118), -INT8_C(117),  INT8_C( 21), -INT8_C( 80),  INT8_C(110), -INT8_C( 95),
+         INT8_C(111), -INT8_C( 16), -INT8_C( 84),  INT8_C( 54),  INT8_C( 33),  INT8_C( 97), -INT8_C(120),  INT8_C( 73)
+      },
+      {
+        { -INT8_C( 99),  INT8_C(107),  INT8_C( 38),  INT8_C( 56),  INT8_C( 63),  INT8_C( 12),  INT8_C( 39), -INT8_C( 11),
+          -INT8_C( 43),  INT8_C( 65),  INT8_C( 98), -INT8_C( 47),  INT8_C( 21), -INT8_C( 95), -INT8_C( 84),  INT8_C( 97) },
+        { -INT8_C( 38),  INT8_C( 73), -INT8_C(  3), -INT8_C( 53),  INT8_C( 78), -INT8_C( 42), -INT8_C( 44), -INT8_C( 87),
+           INT8_C( 13), -INT8_C( 78), -INT8_C( 49), -INT8_C(118), -INT8_C( 80),  INT8_C(111),  INT8_C( 54), -INT8_C(120) },
+        {  INT8_C( 80),  INT8_C(112),  INT8_C( 89), -INT8_C( 23),  INT8_C( 45), -INT8_C( 94), -INT8_C(101), -INT8_C( 81),
+           INT8_C( 34),  INT8_C(111),  INT8_C( 92), -INT8_C(117),  INT8_C(110), -INT8_C( 16),  INT8_C( 33),  INT8_C( 73) },
+      } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x16x3_t r = simde_vld3q_s8(test_vec[i].a);
+    simde_int8x16x3_t expected = { {
+      simde_vld1q_s8(test_vec[i].r[0]),
+      simde_vld1q_s8(test_vec[i].r[1]),
+      simde_vld1q_s8(test_vec[i].r[2])
+    } };
+
+    simde_test_arm_neon_assert_equal_i8x16x3(r, expected);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3q_u16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t a[24];
+    uint16_t r[3][8];
+  } test_vec[] = {
+    { {
+        UINT16_C(57663), UINT16_C(36965), UINT16_C(33806), UINT16_C( 8861), UINT16_C(43484), UINT16_C(25185), UINT16_C(14120), UINT16_C(29717),
+        UINT16_C(48861), UINT16_C(11847), UINT16_C(18155), UINT16_C( 3427), UINT16_C(62592), UINT16_C(48813), UINT16_C( 9599), UINT16_C(55905),
+        UINT16_C(51927), UINT16_C(35693), UINT16_C(32597), UINT16_C(34263), UINT16_C(41790), UINT16_C(41952), UINT16_C(45754), UINT16_C(56884)
+      },
+      {
+        { UINT16_C(57663), UINT16_C( 8861), UINT16_C(14120), UINT16_C(11847), UINT16_C(62592), UINT16_C(55905), UINT16_C(32597), UINT16_C(41952) },
+        { UINT16_C(36965), UINT16_C(43484), UINT16_C(29717), UINT16_C(18155), UINT16_C(48813), UINT16_C(51927), UINT16_C(34263), UINT16_C(45754) },
+        { UINT16_C(33806), UINT16_C(25185), UINT16_C(48861), UINT16_C( 3427), UINT16_C( 9599), UINT16_C(35693), UINT16_C(41790), UINT16_C(56884) },
+      } },
+    { {
+        UINT16_C(27643), UINT16_C(48330), UINT16_C(34683), UINT16_C(48994), UINT16_C(62933), UINT16_C(41578), UINT16_C( 6737), UINT16_C(13499),
+        UINT16_C(30678), UINT16_C(37229), UINT16_C(49812), UINT16_C(63689), UINT16_C(41508), UINT16_C(18323), UINT16_C(35404), UINT16_C(15847),
+        UINT16_C(34693), UINT16_C(23083), UINT16_C(27999), UINT16_C(44935), UINT16_C(19203), UINT16_C( 9918), UINT16_C(52995), UINT16_C( 6534)
+      },
+      {
+        { UINT16_C(27643), UINT16_C(48994), UINT16_C( 6737), UINT16_C(37229), UINT16_C(41508), UINT16_C(15847), UINT16_C(27999), UINT16_C( 9918) },
+        { UINT16_C(48330), UINT16_C(62933), UINT16_C(13499), UINT16_C(49812), UINT16_C(18323), UINT16_C(34693), UINT16_C(44935), UINT16_C(52995) },
+        { UINT16_C(34683), UINT16_C(41578), UINT16_C(30678), UINT16_C(63689), UINT16_C(35404), UINT16_C(23083), UINT16_C(19203), UINT16_C( 6534) },
+      } },
+    { {
+        UINT16_C(54866), UINT16_C(34300), UINT16_C(22237), UINT16_C( 9740), UINT16_C(38308), UINT16_C(43929), UINT16_C(36656), UINT16_C(28946),
+        UINT16_C(21301), UINT16_C(16728), UINT16_C(44026), UINT16_C(22350), UINT16_C(18308), UINT16_C(57476), UINT16_C(32815), UINT16_C(59551),
+        UINT16_C(21359), UINT16_C(29187), UINT16_C(28027), UINT16_C(36675), UINT16_C(49502), UINT16_C(25006), UINT16_C(60548), UINT16_C(39293)
+      },
+      {
+        { UINT16_C(54866), UINT16_C( 9740), UINT16_C(36656), UINT16_C(16728), UINT16_C(18308), UINT16_C(59551), UINT16_C(28027), UINT16_C(25006) },
+        { UINT16_C(34300), UINT16_C(38308), UINT16_C(28946), UINT16_C(44026), UINT16_C(57476), UINT16_C(21359), UINT16_C(36675), UINT16_C(60548) },
+        { UINT16_C(22237), UINT16_C(43929), UINT16_C(21301), UINT16_C(22350), UINT16_C(32815), UINT16_C(29187), UINT16_C(49502), UINT16_C(39293) },
+      } },
+    { {
+        UINT16_C(17214), UINT16_C(37118), UINT16_C(35296), UINT16_C(39823), UINT16_C(61180), UINT16_C(20965), UINT16_C( 8257), UINT16_C(19559),
+        UINT16_C(13928), UINT16_C(16691), UINT16_C(31538), UINT16_C(60047), UINT16_C(  766), UINT16_C(15136), UINT16_C(15592), UINT16_C(24518),
+        UINT16_C(53607), UINT16_C( 2402), UINT16_C(32942), UINT16_C(31180), UINT16_C(21807), UINT16_C(60984), UINT16_C(12973), UINT16_C(24423)
+      },
+      {
+        { UINT16_C(17214), UINT16_C(39823), UINT16_C( 8257), UINT16_C(16691), UINT16_C(  766), UINT16_C(24518), UINT16_C(32942), UINT16_C(60984) },
+        { UINT16_C(37118), UINT16_C(61180), UINT16_C(19559), UINT16_C(31538), UINT16_C(15136), UINT16_C(53607), UINT16_C(31180), UINT16_C(12973) },
+        { UINT16_C(35296), UINT16_C(20965), UINT16_C(13928), UINT16_C(60047), UINT16_C(15592), UINT16_C( 2402), UINT16_C(21807), UINT16_C(24423) },
+      } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x8x3_t r = simde_vld3q_u16(test_vec[i].a);
+    simde_uint16x8x3_t expected = { {
+      simde_vld1q_u16(test_vec[i].r[0]),
+      simde_vld1q_u16(test_vec[i].r[1]),
+      simde_vld1q_u16(test_vec[i].r[2])
+    } };
+
+    simde_test_arm_neon_assert_equal_u16x8x3(r, expected);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3q_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t a[12];
+    int32_t r[3][4];
+  } test_vec[] = {
+    { {
+         INT32_C(1143299640),  INT32_C(1946590103),  INT32_C(1547212685),  INT32_C( 467931778),
+        -INT32_C(1493403832),  INT32_C(1021418863), -INT32_C( 364516046), -INT32_C( 568225072),
+         INT32_C( 289261520),  INT32_C(1004308157), -INT32_C(1922803008),  INT32_C(1304359773)
+      },
+      {
+        {  INT32_C(1143299640),  INT32_C( 467931778), -INT32_C( 364516046),  INT32_C(1004308157) },
+        {  INT32_C(1946590103), -INT32_C(1493403832), -INT32_C( 568225072), -INT32_C(1922803008) },
+        {  INT32_C(1547212685),  INT32_C(1021418863),  INT32_C( 289261520),  INT32_C(1304359773) },
+      } },
+    { {
+         INT32_C(1044460751),  INT32_C(1038146312), -INT32_C( 784113133), -INT32_C( 668046914),
+         INT32_C(1840773404), -INT32_C(1561806693), -INT32_C( 669558292), -INT32_C(1107071837),
+         INT32_C(1719354527),  INT32_C(1997856300),  INT32_C( 733823084), -INT32_C( 162026216)
+      },
+      {
+        {  INT32_C(1044460751), -INT32_C( 668046914), -INT32_C( 669558292),  INT32_C(1997856300) },
+        {  INT32_C(1038146312),  INT32_C(1840773404), -INT32_C(1107071837),  INT32_C( 733823084) },
+        { -INT32_C( 784113133), -INT32_C(1561806693),  INT32_C(1719354527), -INT32_C( 162026216) },
+      } },
+    { {
+         INT32_C(  90497069), -INT32_C( 649307414),  INT32_C( 162226880),  INT32_C(1325588159),
+         INT32_C(2131912406), -INT32_C(1195942689),  INT32_C(1312745649), -INT32_C(1824805068),
+         INT32_C(1523635611),  INT32_C( 727596746),  INT32_C(1969231086),  INT32_C( 504954979)
+      },
+      {
+        {  INT32_C(  90497069),  INT32_C(1325588159),  INT32_C(1312745649),  INT32_C( 727596746) },
+        { -INT32_C( 649307414),  INT32_C(2131912406), -INT32_C(1824805068),  INT32_C(1969231086) },
+        {  INT32_C( 162226880), -INT32_C(1195942689),  INT32_C(1523635611),  INT32_C( 504954979) },
+      } },
+    { {
+         INT32_C( 910054514),  INT32_C( 285891185), -INT32_C( 500783601),  INT32_C( 637666660),
+        -INT32_C(1193191181),  INT32_C(1842551768),  INT32_C(1506887454),  INT32_C(1032449790),
+        -INT32_C( 427520553),  INT32_C(1291184087),  INT32_C( 788754392),  INT32_C( 107760740)
+      },
+      {
+        {  INT32_C( 910054514),  INT32_C( 637666660),  INT32_C(1506887454),  INT32_C(1291184087) },
+        {  INT32_C( 285891185), -INT32_C(1193191181),  INT32_C(1032449790),  INT32_C( 788754392) },
+        { -INT32_C( 500783601),  INT32_C(1842551768), -INT32_C( 427520553),  INT32_C( 107760740) },
+      } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4x3_t r = simde_vld3q_s32(test_vec[i].a);
+    simde_int32x4x3_t expected = { {
+      simde_vld1q_s32(test_vec[i].r[0]),
+      simde_vld1q_s32(test_vec[i].r[1]),
+      simde_vld1q_s32(test_vec[i].r[2])
+    } };
+
+    simde_test_arm_neon_assert_equal_i32x4x3(r, expected);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3q_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32_t a[12];
+    simde_float32_t r[3][4];
+  } test_vec[] = {
+    { {
+        SIMDE_FLOAT32_C(  -443.19), SIMDE_FLOAT32_C(  -250.17), SIMDE_FLOAT32_C(  -490.98), SIMDE_FLOAT32_C(  -110.68),
+        SIMDE_FLOAT32_C(    -1.30), SIMDE_FLOAT32_C(  -411.44), SIMDE_FLOAT32_C(  -434.67), SIMDE_FLOAT32_C(   204.52),
+        SIMDE_FLOAT32_C(   320.23), SIMDE_FLOAT32_C(   273.79), SIMDE_FLOAT32_C(   364.06), SIMDE_FLOAT32_C(   888.44)
+      },
+      {
+        { SIMDE_FLOAT32_C(  -443.19), SIMDE_FLOAT32_C(  -110.68), SIMDE_FLOAT32_C(  -434.67), SIMDE_FLOAT32_C(   273.79) },
+        { SIMDE_FLOAT32_C(  -250.17), SIMDE_FLOAT32_C(    -1.30), SIMDE_FLOAT32_C(   204.52), SIMDE_FLOAT32_C(   364.06) },
+        { SIMDE_FLOAT32_C(  -490.98), SIMDE_FLOAT32_C(  -411.44), SIMDE_FLOAT32_C(   320.23), SIMDE_FLOAT32_C(   888.44) },
+      } },
+    { {
+        SIMDE_FLOAT32_C(   518.82), SIMDE_FLOAT32_C(   638.40), SIMDE_FLOAT32_C(   928.74), SIMDE_FLOAT32_C(  -899.63),
+        SIMDE_FLOAT32_C(   391.35), SIMDE_FLOAT32_C(     0.14), SIMDE_FLOAT32_C(   718.12), SIMDE_FLOAT32_C(  -412.31),
+        SIMDE_FLOAT32_C(   440.27), SIMDE_FLOAT32_C(  -755.18), SIMDE_FLOAT32_C(   959.45), SIMDE_FLOAT32_C(   301.94)
+      },
+      {
+        { SIMDE_FLOAT32_C(   518.82), SIMDE_FLOAT32_C(  -899.63), SIMDE_FLOAT32_C(   718.12), SIMDE_FLOAT32_C(  -755.18) },
+        { SIMDE_FLOAT32_C(   638.40), SIMDE_FLOAT32_C(   391.35), SIMDE_FLOAT32_C(  -412.31), SIMDE_FLOAT32_C(   959.45) },
+        { SIMDE_FLOAT32_C(   928.74), SIMDE_FLOAT32_C(     0.14), SIMDE_FLOAT32_C(   440.27), SIMDE_FLOAT32_C(   301.94) },
+      } },
+    { {
+        SIMDE_FLOAT32_C(   951.37), SIMDE_FLOAT32_C(  -448.90), SIMDE_FLOAT32_C(    93.66), SIMDE_FLOAT32_C(  -966.21),
+        SIMDE_FLOAT32_C(   726.98), SIMDE_FLOAT32_C(   303.33), SIMDE_FLOAT32_C(  -847.05), SIMDE_FLOAT32_C(  -554.31),
+        SIMDE_FLOAT32_C(   423.20), SIMDE_FLOAT32_C(  -969.92), SIMDE_FLOAT32_C(   955.46), SIMDE_FLOAT32_C(  -657.31)
+      },
+      {
+        { SIMDE_FLOAT32_C(   951.37), SIMDE_FLOAT32_C(  -966.21), SIMDE_FLOAT32_C(  -847.05), SIMDE_FLOAT32_C(  -969.92) },
+        { SIMDE_FLOAT32_C(  -448.90), SIMDE_FLOAT32_C(   726.98), SIMDE_FLOAT32_C(  -554.31), SIMDE_FLOAT32_C(   955.46) },
+        { SIMDE_FLOAT32_C(    93.66), SIMDE_FLOAT32_C(   303.33), SIMDE_FLOAT32_C(   423.20), SIMDE_FLOAT32_C(  -657.31) },
+      } },
+    { {
+        SIMDE_FLOAT32_C(   322.12), SIMDE_FLOAT32_C(   960.74), SIMDE_FLOAT32_C(   526.22), SIMDE_FLOAT32_C(  -572.58),
+        SIMDE_FLOAT32_C(  -336.46), SIMDE_FLOAT32_C(    20.22), SIMDE_FLOAT32_C(   512.31), SIMDE_FLOAT32_C(   104.60),
+        SIMDE_FLOAT32_C(  -816.76), SIMDE_FLOAT32_C(  -302.93), SIMDE_FLOAT32_C(  -523.18), SIMDE_FLOAT32_C(  -883.22)
+      },
+      {
+        { SIMDE_FLOAT32_C(   322.12), SIMDE_FLOAT32_C(  -572.58), SIMDE_FLOAT32_C(   512.31), SIMDE_FLOAT32_C(  -302.93) },
+        { SIMDE_FLOAT32_C(   960.74), SIMDE_FLOAT32_C(  -336.46), SIMDE_FLOAT32_C(   104.60), SIMDE_FLOAT32_C(  -523.18) },
+        { SIMDE_FLOAT32_C(   526.22), SIMDE_FLOAT32_C(    20.22), SIMDE_FLOAT32_C(  -816.76), SIMDE_FLOAT32_C(  -883.22) },
+      } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4x3_t r = simde_vld3q_f32(test_vec[i].a);
+    simde_float32x4x3_t expected = { {
+      simde_vld1q_f32(test_vec[i].r[0]),
+      simde_vld1q_f32(test_vec[i].r[1]),
+      simde_vld1q_f32(test_vec[i].r[2])
+    } };
+
+    simde_test_arm_neon_assert_equal_f32x4x3(r, expected, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3q_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a[6];
+    uint64_t r[3][2];
+  } test_vec[] = {
+    { {
+        UINT64_C(10652502458665766130), UINT64_C(10553858988413514255), UINT64_C(16934539338392904951), UINT64_C(10057280776834291231),
+        UINT64_C( 2499360086388880636), UINT64_C( 2726562951733433375)
+      },
+      {
+        { UINT64_C(10652502458665766130), UINT64_C(10057280776834291231) },
+        { UINT64_C(10553858988413514255), UINT64_C( 2499360086388880636) },
+        { UINT64_C(16934539338392904951), UINT64_C( 2726562951733433375) },
+      } },
+    { {
+        UINT64_C( 3614836625159951320), UINT64_C(  153585883388094391), UINT64_C(   43817058604804980), UINT64_C( 1631929190679820592),
+        UINT64_C( 4046864066514002829), UINT64_C( 9740179655925265709)
+      },
+      {
+        { UINT64_C( 3614836625159951320), UINT64_C( 1631929190679820592) },
+        { UINT64_C(  153585883388094391), UINT64_C( 4046864066514002829) },
+        { UINT64_C(   43817058604804980), UINT64_C( 9740179655925265709) },
+      } },
+    { {
+        UINT64_C(14657202883927545918), UINT64_C(13085827566788448236), UINT64_C(12106616221885107947), UINT64_C( 5753486777152099257),
+        UINT64_C(13701558638913147011), UINT64_C(12412833607991427292)
+      },
+      {
+        { UINT64_C(14657202883927545918), UINT64_C( 5753486777152099257) },
+        { UINT64_C(13085827566788448236), UINT64_C(13701558638913147011) },
+        { UINT64_C(12106616221885107947), UINT64_C(12412833607991427292) },
+      } },
+    { {
+        UINT64_C(10379977341470594002), UINT64_C( 2472042876938382233), UINT64_C( 8123920440775462707), UINT64_C(13729865360700678822),
+        UINT64_C(11524885059115596980), UINT64_C(  557253211785157872)
+      },
+      {
+        { UINT64_C(10379977341470594002), UINT64_C(13729865360700678822) },
+        { UINT64_C( 2472042876938382233), UINT64_C(11524885059115596980) },
+        { UINT64_C( 8123920440775462707), UINT64_C(  557253211785157872) },
+      } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x2x3_t r = simde_vld3q_u64(test_vec[i].a);
+    simde_uint64x2x3_t expected = { {
+      simde_vld1q_u64(test_vec[i].r[0]),
+      simde_vld1q_u64(test_vec[i].r[1]),
+      simde_vld1q_u64(test_vec[i].r[2])
+    } };
+
+    simde_test_arm_neon_assert_equal_u64x2x3(r, expected);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3q_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64_t a[6];
+    simde_float64_t r[3][2];
+  } test_vec[] = {
+    { {
+        SIMDE_FLOAT64_C(  -517.49), SIMDE_FLOAT64_C(   -15.68), SIMDE_FLOAT64_C(   653.84), SIMDE_FLOAT64_C(   781.46),
+        SIMDE_FLOAT64_C(  -362.71), SIMDE_FLOAT64_C(  -607.70)
+      },
+      {
+        { SIMDE_FLOAT64_C(  -517.49), SIMDE_FLOAT64_C(   781.46) },
+        { SIMDE_FLOAT64_C(   -15.68), SIMDE_FLOAT64_C(  -362.71) },
+        { SIMDE_FLOAT64_C(   653.84), SIMDE_FLOAT64_C(  -607.70) },
+      } },
+    { {
+        SIMDE_FLOAT64_C(  -696.29), SIMDE_FLOAT64_C(  -443.84), SIMDE_FLOAT64_C(  -358.98), SIMDE_FLOAT64_C(   699.07),
+        SIMDE_FLOAT64_C(   652.67), SIMDE_FLOAT64_C(   937.99)
+      },
+      {
+        { SIMDE_FLOAT64_C(  -696.29), SIMDE_FLOAT64_C(   699.07) },
+        { SIMDE_FLOAT64_C(  -443.84), SIMDE_FLOAT64_C(   652.67) },
+        { SIMDE_FLOAT64_C(  -358.98), SIMDE_FLOAT64_C(   937.99) },
+      } },
+    { {
+        SIMDE_FLOAT64_C(   271.19), SIMDE_FLOAT64_C(    19.80), SIMDE_FLOAT64_C(   393.84), SIMDE_FLOAT64_C(  -834.76),
+        SIMDE_FLOAT64_C(   873.08), SIMDE_FLOAT64_C(   191.14)
+      },
+      {
+        { SIMDE_FLOAT64_C(   271.19), SIMDE_FLOAT64_C(  -834.76) },
+        { SIMDE_FLOAT64_C(    19.80), SIMDE_FLOAT64_C(   873.08) },
+        { SIMDE_FLOAT64_C(   393.84), SIMDE_FLOAT64_C(   191.14) },
+      } },
+    { {
+        SIMDE_FLOAT64_C(   494.19), SIMDE_FLOAT64_C(  -793.19), SIMDE_FLOAT64_C(  -862.42), SIMDE_FLOAT64_C(   238.19),
+        SIMDE_FLOAT64_C(  -815.74), SIMDE_FLOAT64_C(   784.92)
+      },
+      {
+        { SIMDE_FLOAT64_C(   494.19), SIMDE_FLOAT64_C(   238.19) },
+        { SIMDE_FLOAT64_C(  -793.19), SIMDE_FLOAT64_C(  -815.74) },
+        { SIMDE_FLOAT64_C(  -862.42), SIMDE_FLOAT64_C(   784.92) },
+      } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2x3_t r = simde_vld3q_f64(test_vec[i].a);
+    simde_float64x2x3_t expected = { {
+      simde_vld1q_f64(test_vec[i].r[0]),
+      simde_vld1q_f64(test_vec[i].r[1]),
+      simde_vld1q_f64(test_vec[i].r[2])
+    } };
+
+    simde_test_arm_neon_assert_equal_f64x2x3(r, expected, 1);
+  }
+
+  return 0;
+}
+
 #endif /* !defined(SIMDE_BUG_INTEL_857088) */
 SIMDE_TEST_FUNC_LIST_BEGIN
 #if !defined(SIMDE_BUG_INTEL_857088)
 SIMDE_TEST_FUNC_LIST_ENTRY(vld3_s8)
 SIMDE_TEST_FUNC_LIST_ENTRY(vld3_f16)
 SIMDE_TEST_FUNC_LIST_ENTRY(vld3q_f16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld3_u8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld3_s16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld3q_u8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld3q_s8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld3q_u16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld3q_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld3q_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld3q_u64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld3q_f64)
 #endif /* !defined(SIMDE_BUG_INTEL_857088) */
 SIMDE_TEST_FUNC_LIST_END
 
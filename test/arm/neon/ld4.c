@@ -256,11 +256,699 @@ test_simde_vld4q_f16 (SIMDE_MUNIT_TEST_ARGS) {
 #endif
 }
 
+static int
+test_simde_vld4_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t a[32];
+    uint8_t r[4][8];
+  } test_vec[] = {
+    { {
+        UINT8_C(215), UINT8_C( 54), UINT8_C( 96), UINT8_C(107), UINT8_C(174), UINT8_C( 31), UINT8_C( 77), UINT8_C(189),
+        UINT8_C( 35), UINT8_C(120), UINT8_C(  3), UINT8_C( 73), UINT8_C( 13), UINT8_C( 65), UINT8_C( 78), UINT8_C( 47),
+        UINT8_C(166), UINT8_C(220), UINT8_C(155), UINT8_C( 15), UINT8_C( 60), UINT8_C(218), UINT8_C( 61), UINT8_C(245),
+        UINT8_C( 25), UINT8_C(151), UINT8_C( 15), UINT8_C(126), UINT8_C(  8), UINT8_C(199), UINT8_C(146), UINT8_C(227)
+      },
+      {
+        { UINT8_C(215), UINT8_C(174), UINT8_C( 35), UINT8_C( 13), UINT8_C(166), UINT8_C( 60), UINT8_C( 25), UINT8_C(  8) },
+        { UINT8_C( 54), UINT8_C( 31), UINT8_C(120), UINT8_C( 65), UINT8_C(220), UINT8_C(218), UINT8_C(151), UINT8_C(199) },
+        { UINT8_C( 96), UINT8_C( 77), UINT8_C(  3), UINT8_C( 78), UINT8_C(155), UINT8_C( 61), UINT8_C( 15), UINT8_C(146) },
+        { UINT8_C(107), UINT8_C(189), UINT8_C( 73), UINT8_C( 47), UINT8_C( 15), UINT8_C(245), UINT8_C(126), UINT8_C(227) },
+      } },
+    { {
+        UINT8_C( 29), UINT8_C( 95), UINT8_C(249), UINT8_C(216), UINT8_C(251), UINT8_C(201), UINT8_C(225), UINT8_C( 84),
+        UINT8_C(120), UINT8_C(239), UINT8_C( 67), UINT8_C( 88), UINT8_C(241), UINT8_C( 88), UINT8_C( 80), UINT8_C( 10),
+        UINT8_C(237), UINT8_C( 78), UINT8_C(182), UINT8_C( 15), UINT8_C(166), UINT8_C( 75), UINT8_C(159), UINT8_C(225),
+        UINT8_C(199), UINT8_C(250), UINT8_C(218), UINT8_C(113), UINT8_C(249), UINT8_C(220), UINT8_C( 50), UINT8_C(224)
+      },
+      {
+        { UINT8_C( 29), UINT8_C(251), UINT8_C(120), UINT8_C(241), UINT8_C(237), UINT8_C(166), UINT8_C(199), UINT8_C(249) },
+        { UINT8_C( 95), UINT8_C(201), UINT8_C(239), UINT8_C( 88), UINT8_C( 78), UINT8_C( 75), UINT8_C(250), UINT8_C(220) },
+        { UINT8_C(249), UINT8_C(225), UINT8_C( 67), UINT8_C( 80), UINT8_C(182), UINT8_C(159), UINT8_C(218), UINT8_C( 50) },
+        { UINT8_C(216), UINT8_C( 84), UINT8_C( 88), UINT8_C( 10), UINT8_C( 15), UINT8_C(225), UINT8_C(113), UINT8_C(224) },
+      } },
+    { {
+        UINT8_C(243), UINT8_C(210), UINT8_C(127), UINT8_C(134), UINT8_C(112), UINT8_C( 73), UINT8_C(222), UINT8_C(183),
+        UINT8_C(252), UINT8_C( 27), UINT8_C( 52), UINT8_C(111), UINT8_C(140), UINT8_C( 56), UINT8_C( 56), UINT8_C( 42),
+        UINT8_C(192), UINT8_C(254), UINT8_C(173), UINT8_C(224), UINT8_C( 65), UINT8_C(186), UINT8_C(  5), UINT8_C( 50),
+        UINT8_C(167), UINT8_C(107), UINT8_C(143), UINT8_C( 14), UINT8_C(100), UINT8_C(164), UINT8_C(251), UINT8_C( 19)
+      },
+      {
+        { UINT8_C(243), UINT8_C(112), UINT8_C(252), UINT8_C(140), UINT8_C(192), UINT8_C( 65), UINT8_C(167), UINT8_C(100) },
+        { UINT8_C(210), UINT8_C( 73), UINT8_C( 27), UINT8_C( 56), UINT8_C(254), UINT8_C(186), UINT8_C(107), UINT8_C(164) },
+        { UINT8_C(127), UINT8_C(222), UINT8_C( 52), UINT8_C( 56), UINT8_C(173), UINT8_C(  5), UINT8_C(143), UINT8_C(251) },
+        { UINT8_C(134), UINT8_C(183), UINT8_C(111), UINT8_C( 42), UINT8_C(224), UINT8_C( 50), UINT8_C( 14), UINT8_C( 19) },
+      } },
+    { {
+        UINT8_C(  3), UINT8_C(215), UINT8_C(120), UINT8_C(177), UINT8_C(221), UINT8_C( 31), UINT8_C( 16), UINT8_C( 12),
+        UINT8_C(109), UINT8_C( 80), UINT8_C( 54), UINT8_C(152), UINT8_C(181), UINT8_C(199), UINT8_C(123), UINT8_C(131),
+        UINT8_C(198), UINT8_C(138), UINT8_C(126), UINT8_C(172), UINT8_C( 91), UINT8_C(130), UINT8_C(119), UINT8_C( 19),
+        UINT8_C(  5), UINT8_C(174), UINT8_C( 96), UINT8_C( 47), UINT8_C(161), UINT8_C(237), UINT8_C( 39), UINT8_C( 70)
+      },
+      {
+        { UINT8_C(  3), UINT8_C(221), UINT8_C(109), UINT8_C(181), UINT8_C(198), UINT8_C( 91), UINT8_C(  5), UINT8_C(161) },
+        { UINT8_C(215), UINT8_C( 31), UINT8_C( 80), UINT8_C(199), UINT8_C(138), UINT8_C(130), UINT8_C(174), UINT8_C(237) },
+        { UINT8_C(120), UINT8_C( 16), UINT8_C( 54), UINT8_C(123), UINT8_C(126), UINT8_C(119), UINT8_C( 96), UINT8_C( 39) },
+        { UINT8_C(177), UINT8_C( 12), UINT8_C(152), UINT8_C(131), UINT8_C(172), UINT8_C( 19), UINT8_C( 47), UINT8_C( 70) },
+      } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x8x4_t r = simde_vld4_u8(test_vec[i].a);
+    simde_uint8x8x4_t expected = { {
+      simde_vld1_u8(test_vec[i].r[0]),
+      simde_vld1_u8(test_vec[i].r[1]),
+      simde_vld1_u8(test_vec[i].r[2]),
+      simde_vld1_u8(test_vec[i].r[3])
+    } };
+
+    simde_test_arm_neon_assert_equal_u8x8x4(r, expected);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld4_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t a[16];
+    int16_t r[4][4];
+  } test_vec[] = {
+    { {
+         INT16_C( 1461), -INT16_C(21705),  INT16_C(20619), -INT16_C(17910), -INT16_C(31676),  INT16_C(  849),  INT16_C( 2382), -INT16_C(12876),
+        -INT16_C( 3221),  INT16_C(10092),  INT16_C(11050),  INT16_C( 2129), -INT16_C(26009), -INT16_C(  372), -INT16_C(18093),  INT16_C(14515)
+      },
+      {
+        {  INT16_C( 1461), -INT16_C(31676), -INT16_C( 3221), -INT16_C(26009) },
+        { -INT16_C(21705),  INT16_C(  849),  INT16_C(10092), -INT16_C(  372) },
+        {  INT16_C(20619),  INT16_C( 2382),  INT16_C(11050), -INT16_C(18093) },
+        { -INT16_C(17910), -INT16_C(12876),  INT16_C( 2129),  INT16_C(14515) },
+      } },
+    { {
+        -INT16_C(15170),  INT16_C( 3441),  INT16_C( 7635),  INT16_C(10750), -INT16_C(17182),  INT16_C( 7128), -INT16_C( 5939), -INT16_C(28112),
+         INT16_C( 4577),  INT16_C( 3093),  INT16_C( 7531), -INT16_C( 8658),  INT16_C(31382),  INT16_C(32076), -INT16_C(12955),  INT16_C(  678)
+      },
+      {
+        { -INT16_C(15170), -INT16_C(17182),  INT16_C( 4577),  INT16_C(31382) },
+        {  INT16_C( 3441),  INT16_C( 7128),  INT16_C( 3093),  INT16_C(32076) },
+        {  INT16_C( 7635), -INT16_C( 5939),  INT16_C( 7531), -INT16_C(12955) },
+        {  INT16_C(10750), -INT16_C(28112), -INT16_C( 8658),  INT16_C(  678) },
+      } },
+    { {
+        -INT16_C(30723),  INT16_C(18518),  INT16_C(27686),  INT16_C(11418),  INT16_C( 8115), -INT16_C( 9335),  INT16_C(22985),  INT16_C(18919),
+        -INT16_C( 3845), -INT16_C(18891),  INT16_C( 7181),  INT16_C(10216), -INT16_C(16952), -INT16_C(17650),  INT16_C(17585), -INT16_C(  851)
+      },
+      {
+        { -INT16_C(30723),  INT16_C( 8115), -INT16_C( 3845), -INT16_C(16952) },
+        {  INT16_C(18518), -INT16_C( 9335), -INT16_C(18891), -INT16_C(17650) },
+        {  INT16_C(27686),  INT16_C(22985),  INT16_C( 7181),  INT16_C(17585) },
+        {  INT16_C(11418),  INT16_C(18919),  INT16_C(10216), -INT16_C(  851) },
+      } },
+    { {
+         INT16_C( 9521), -INT16_C( 6135), -INT16_C( 2330), -INT16_C(30764),  INT16_C( 6416), -INT16_C( 7649),  INT16_C( 1214), -INT16_C(27025),
+        -INT16_C(25826),  INT16_C(22239), -INT16_C( 8284),  INT16_C(27959), -INT16_C(10172), -INT16_C(31820),  INT16_C(25091),  INT16_C(10411)
+      },
+      {
+        {  INT16_C( 9521),  INT16_C( 6416), -INT16_C(25826), -INT16_C(10172) },
+        { -INT16_C( 6135), -INT16_C( 7649),  INT16_C(22239), -INT16_C(31820) },
+        { -INT16_C( 2330),  INT16_C( 1214), -INT16_C( 8284),  INT16_C(25091) },
+        { -INT16_C(30764), -INT16_C(27025),  INT16_C(27959),  INT16_C(10411) },
+      } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x4x4_t r = simde_vld4_s16(test_vec[i].a);
+    simde_int16x4x4_t expected = { {
+      simde_vld1_s16(test_vec[i].r[0]),
+      simde_vld1_s16(test_vec[i].r[1]),
+      simde_vld1_s16(test_vec[i].r[2]),
+      simde_vld1_s16(test_vec[i].r[3])
+    } };
+
+    simde_test_arm_neon_assert_equal_i16x4x4(r, expected);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld4q_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t a[64];
+    uint8_t r[4][16];
+  } test_vec[] = {
+    { {
+        UINT8_C( 88), UINT8_C( 50), UINT8_C(197), UINT8_C(158), UINT8_C( 49), UINT8_C( 66), UINT8_C(206), UINT8_C(230),
+        UINT8_C( 70), UINT8_C(248), UINT8_C(213), UINT8_C( 66), UINT8_C(155), UINT8_C( 93), UINT8_C(188), UINT8_C(133),
+        UINT8_C(110), UINT8_C(170), UINT8_C( 29), UINT8_C(254), UINT8_C(121), UINT8_C( 97), UINT8_C(111), UINT8_C(122),
+        UINT8_C(157), UINT8_C(200), UINT8_C( 92), UINT8_C(222), UINT8_C(151), UINT8_C(223), UINT8_C(148), UINT8_C( 14),
+        UINT8_C(180), UINT8_C(110), UINT8_C( 10), UINT8_C( 26), UINT8_C(248), UINT8_C(151), UINT8_C( 45), UINT8_C( 64),
+        UINT8_C( 57), UINT8_C(229), UINT8_C(203), UINT8_C(186), UINT8_C(240), UINT8_C(105), UINT8_C(237), UINT8_C( 17),
+        UINT8_C(  7), UINT8_C( 24), UINT8_C( 80), UINT8_C( 13), UINT8_C(208), UINT8_C(198), UINT8_C(164), UINT8_C( 90),
+        UINT8_C( 21), UINT8_C(104), UINT8_C(101), UINT8_C(143), UINT8_C(248), UINT8_C(184), UINT8_C( 66), UINT8_C(174)
+      },
+      {
+        { UINT8_C( 88), UINT8_C( 49), UINT8_C( 70), UINT8_C(155), UINT8_C(110), UINT8_C(121), UINT8_C(157), UINT8_C(151),
+          UINT8_C(180), UINT8_C(248), UINT8_C( 57), UINT8_C(240), UINT8_C(  7), UINT8_C(208), UINT8_C( 21), UINT8_C(248) },
+        { UINT8_C( 50), UINT8_C( 66), UINT8_C(248), UINT8_C( 93), UINT8_C(170), UINT8_C( 97), UINT8_C(200), UINT8_C(223),
+          UINT8_C(110), UINT8_C(151), UINT8_C(229), UINT8_C(105), UINT8_C( 24), UINT8_C(198), UINT8_C(104), UINT8_C(184) },
+        { UINT8_C(197), UINT8_C(206), UINT8_C(213), UINT8_C(188), UINT8_C( 29), UINT8_C(111), UINT8_C( 92), UINT8_C(148),
+          UINT8_C( 10), UINT8_C( 45), UINT8_C(203), UINT8_C(237), UINT8_C( 80), UINT8_C(164), UINT8_C(101), UINT8_C( 66) },
+        { UINT8_C(158), UINT8_C(230), UINT8_C( 66), UINT8_C(133), UINT8_C(254), UINT8_C(122), UINT8_C(222), UINT8_C( 14),
+          UINT8_C( 26), UINT8_C( 64), UINT8_C(186), UINT8_C( 17), UINT8_C( 13), UINT8_C( 90), UINT8_C(143), UINT8_C(174) },
+      } },
+    { {
+        UINT8_C(101), UINT8_C(209), UINT8_C( 17), UINT8_C(211), UINT8_C(102), UINT8_C(229), UINT8_C( 41), UINT8_C( 51),
+        UINT8_C(235), UINT8_C( 12), UINT8_C( 23), UINT8_C(252), UINT8_C(249), UINT8_C(106), UINT8_C( 98), UINT8_C(220),
+        UINT8_C(227), UINT8_C(173), UINT8_C( 14), UINT8_C(177), UINT8_C(181), UINT8_C(139), UINT8_C( 18), UINT8_C( 34),
+        UINT8_C(203), UINT8_C( 38), UINT8_C(209), UINT8_C( 95), UINT8_C(203), UINT8_C(124), UINT8_C( 44), UINT8_C(  4),
+        UINT8_C( 98), UINT8_C(115), UINT8_C(101), UINT8_C(149), UINT8_C(123), UINT8_C(206), UINT8_C(175), UINT8_C( 13),
+        UINT8_C( 56), UINT8_C( 40), UINT8_C( 79), UINT8_C(120), UINT8_C( 68), UINT8_C(222), UINT8_C( 28), UINT8_C(127),
+        UINT8_C( 36), UINT8_C(241), UINT8_C( 62), UINT8_C( 68), UINT8_C( 60), UINT8_C( 15), UINT8_C(164), UINT8_C(194),
+        UINT8_C(236), UINT8_C(237), UINT8_C(140), UINT8_C(107), UINT8_C(209), UINT8_C(244), UINT8_C( 70), UINT8_C(123)
+      },
+      {
+        { UINT8_C(101), UINT8_C(102), UINT8_C(235), UINT8_C(249), UINT8_C(227), UINT8_C(181), UINT8_C(203), UINT8_C(203),
+          UINT8_C( 98), UINT8_C(123), UINT8_C( 56), UINT8_C( 68), UINT8_C( 36), UINT8_C( 60), UINT8_C(236), UINT8_C(209) },
+        { UINT8_C(209), UINT8_C(229), UINT8_C( 12), UINT8_C(106), UINT8_C(173), UINT8_C(139), UINT8_C( 38), UINT8_C(124),
+          UINT8_C(115), UINT8_C(206), UINT8_C( 40), UINT8_C(222), UINT8_C(241), UINT8_C( 15), UINT8_C(237), UINT8_C(244) },
+        { UINT8_C( 17), UINT8_C( 41), UINT8_C( 23), UINT8_C( 98), UINT8_C( 14), UINT8_C( 18), UINT8_C(209), UINT8_C( 44),
+          UINT8_C(101), UINT8_C(175), UINT8_C( 79), UINT8_C( 28), UINT8_C( 62), UINT8_C(164), UINT8_C(140), UINT8_C( 70) },
+        { UINT8_C(211), UINT8_C( 51), UINT8_C(252), UINT8_C(220), UINT8_C(177), UINT8_C( 34), UINT8_C( 95), UINT8_C(  4),
+          UINT8_C(149), UINT8_C( 13), UINT8_C(120), UINT8_C(127), UINT8_C( 68), UINT8_C(194), UINT8_C(107), UINT8_C(123) },
+      } },
+    { {
+        UINT8_C(210), UINT8_C(  9), UINT8_C(221), UINT8_C(245), UINT8_C(123), UINT8_C(239), UINT8_C(  9), UINT8_C(225),
+        UINT8_C(221), UINT8_C(235), UINT8_C( 72), UINT8_C(141), UINT8_C(223), UINT8_C(178), UINT8_C( 30), UINT8_C(230),
+        UINT8_C(102), UINT8_C(201), UINT8_C(  7), UINT8_C(174), UINT8_C(170), UINT8_C(  5), UINT8_C(247), UINT8_C( 88),
+        UINT8_C(202), UINT8_C( 16), UINT8_C( 99), UINT8_C(  4), UINT8_C( 99), UINT8_C(243), UINT8_C(220), UINT8_C(  0),
+        UINT8_C( 91), UINT8_C(126), UINT8_C(154), UINT8_C(199), UINT8_C(247), UINT8_C( 78), UINT8_C(183), UINT8_C( 84),
+        UINT8_C(109), UINT8_C( 72), UINT8_C( 49), UINT8_C( 52), UINT8_C(236), UINT8_C( 26), UINT8_C(169), UINT8_C(107),
+        UINT8_C(126), UINT8_C( 85), UINT8_C(171), UINT8_C(242), UINT8_C( 82), UINT8_C(149), UINT8_C(162), UINT8_C(124),
+        UINT8_C(136), UINT8_C( 41), UINT8_C( 44), UINT8_C( 79), UINT8_C(225), UINT8_C( 52), UINT8_C(223), UINT8_C( 83)
+      },
+      {
+        { UINT8_C(210), UINT8_C(123), UINT8_C(221), UINT8_C(223), UINT8_C(102), UINT8_C(170), UINT8_C(202), UINT8_C( 99),
+          UINT8_C( 91), UINT8_C(247), UINT8_C(109), UINT8_C(236), UINT8_C(126), UINT8_C( 82), UINT8_C(136), UINT8_C(225) },
+        { UINT8_C(  9), UINT8_C(239), UINT8_C(235), UINT8_C(178), UINT8_C(201), UINT8_C(  5), UINT8_C( 16), UINT8_C(243),
+          UINT8_C(126), UINT8_C( 78), UINT8_C( 72), UINT8_C( 26), UINT8_C( 85), UINT8_C(149), UINT8_C( 41), UINT8_C( 52) },
+        { UINT8_C(221), UINT8_C(  9), UINT8_C( 72), UINT8_C( 30), UINT8_C(  7), UINT8_C(247), UINT8_C( 99), UINT8_C(220),
+          UINT8_C(154), UINT8_C(183), UINT8_C( 49), UINT8_C(169), UINT8_C(171), UINT8_C(162), UINT8_C( 44), UINT8_C(223) },
+        { UINT8_C(245), UINT8_C(225), UINT8_C(141), UINT8_C(230), UINT8_C(174), UINT8_C( 88), UINT8_C(  4), UINT8_C(  0),
+          UINT8_C(199), UINT8_C( 84), UINT8_C( 52), UINT8_C(107), UINT8_C(242), UINT8_C(124), UINT8_C( 79), UINT8_C( 83) },
+      } },
+    { {
+        UINT8_C(182), UINT8_C(202), UINT8_C( 48), UINT8_C( 35), UINT8_C( 56), UINT8_C( 13), UINT8_C(188), UINT8_C(220),
+        UINT8_C( 42), UINT8_C( 66), UINT8_C( 34), UINT8_C( 81), UINT8_C(234), UINT8_C(141), UINT8_C(177), UINT8_C(150),
+        UINT8_C(114), UINT8_C(246), UINT8_C(139), UINT8_C(104), UINT8_C(112), UINT8_C(  7), UINT8_C(167), UINT8_C( 77),
+        UINT8_C(120), UINT8_C(251), UINT8_C(106), UINT8_C( 71), UINT8_C(163), UINT8_C( 21), UINT8_C(253), UINT8_C(225),
+        UINT8_C(176), UINT8_C( 94), UINT8_C( 13), UINT8_C( 59), UINT8_C(209), UINT8_C( 66), UINT8_C( 88), UINT8_C(178),
+        UINT8_C( 31), UINT8_C(  1), UINT8_C( 70), UINT8_C( 28), UINT8_C(163), UINT8_C(188), UINT8_C( 54), UINT8_C(136),
+        UINT8_C(234), UINT8_C(236), UINT8_C(172), UINT8_C( 80), UINT8_C(  7), UINT8_C( 75), UINT8_C(112), UINT8_C(103),
+        UINT8_C( 86), UINT8_C(168), UINT8_C( 52), UINT8_C(173), UINT8_C(129), UINT8_C( 24), UINT8_C( 39), UINT8_C( 58)
+      },
+      {
+        { UINT8_C(182), UINT8_C( 56), UINT8_C( 42), UINT8_C(234), UINT8_C(114), UINT8_C(112), UINT8_C(120), UINT8_C(163),
+          UINT8_C(176), UINT8_C(209), UINT8_C( 31), UINT8_C(163), UINT8_C(234), UINT8_C(  7), UINT8_C( 86), UINT8_C(129) },
+        { UINT8_C(202), UINT8_C( 13), UINT8_C( 66), UINT8_C(141), UINT8_C(246), UINT8_C(  7), UINT8_C(251), UINT8_C( 21),
+          UINT8_C( 94), UINT8_C( 66), UINT8_C(  1), UINT8_C(188), UINT8_C(236), UINT8_C( 75), UINT8_C(168), UINT8_C( 24) },
+        { UINT8_C( 48), UINT8_C(188), UINT8_C( 34), UINT8_C(177), UINT8_C(139), UINT8_C(167), UINT8_C(106), UINT8_C(253),
+          UINT8_C( 13), UINT8_C( 88), UINT8_C( 70), UINT8_C( 54), UINT8_C(172), UINT8_C(112), UINT8_C( 52), UINT8_C( 39) },
+        { UINT8_C( 35), UINT8_C(220), UINT8_C( 81), UINT8_C(150), UINT8_C(104), UINT8_C( 77), UINT8_C( 71), UINT8_C(225),
+          UINT8_C( 59), UINT8_C(178), UINT8_C( 28), UINT8_C(136), UINT8_C( 80), UINT8_C(103), UINT8_C(173), UINT8_C( 58) },
+      } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x16x4_t r = simde_vld4q_u8(test_vec[i].a);
+    simde_uint8x16x4_t expected = { {
+      simde_vld1q_u8(test_vec[i].r[0]),
+      simde_vld1q_u8(test_vec[i].r[1]),
+      simde_vld1q_u8(test_vec[i].r[2]),
+      simde_vld1q_u8(test_vec[i].r[3])
+    } };
+
+    simde_test_arm_neon_assert_equal_u8x16x4(r, expected);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld4q_s8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t a[64];
+    int8_t r[4][16];
+  } test_vec[] = {
+    { {
+        -INT8_C( 83),  INT8_C(103), -INT8_C( 45), -INT8_C( 63), -INT8_C( 23),  INT8_C( 10),  INT8_C( 44), -INT8_C(108),
+         INT8_C(113),  INT8_C( 91), -INT8_C( 80),  INT8_C( 58), -INT8_C(  3),  INT8_C( 81), -INT8_C(  3),  INT8_C( 13),
+        -INT8_C( 50),  INT8_C( 41), -INT8_C(  6), -INT8_C(  4), -INT8_C( 76), -INT8_C( 13),  INT8_C( 19),  INT8_C( 97),
+         INT8_C(112),  INT8_C(105), -INT8_C(  1),  INT8_C( 94), -INT8_C(115),  INT8_C( 22),  INT8_C(106), -INT8_C( 37),
+         INT8_C( 54),  INT8_C(106), -INT8_C(100),  INT8_C(114), -INT8_C( 51), -INT8_C(  6), -INT8_C( 89), -INT8_C( 57),
+         INT8_C(126), -INT8_C( 18), -INT8_C( 83),  INT8_C( 30),  INT8_C(  6), -INT8_C( 72),  INT8_C( 26),  INT8_C( 20),
+        -INT8_C( 42),  INT8_C( 97),  INT8_C( 32), -INT8_C( 93),  INT8_C(125),  INT8_C(122),  INT8_C( 60),  INT8_C(  6),
+        -INT8_C( 14), -INT8_C( 88),  INT8_C( 12),  INT8_C( 39),  INT8_C( 76),  INT8_C(106), -INT8_C( 53), -INT8_C(  1)
+      },
+      {
+        { -INT8_C( 83), -INT8_C( 23),  INT8_C(113), -INT8_C(  3), -INT8_C( 50), -INT8_C( 76),  INT8_C(112), -INT8_C(115),
+           INT8_C( 54), -INT8_C( 51),  INT8_C(126),  INT8_C(  6), -INT8_C( 42),  INT8_C(125), -INT8_C( 14),  INT8_C( 76) },
+        {  INT8_C(103),  INT8_C( 10),  INT8_C( 91),  INT8_C( 81),  INT8_C( 41), -INT8_C( 13),  INT8_C(105),  INT8_C( 22),
+           INT8_C(106), -INT8_C(  6), -INT8_C( 18), -INT8_C( 72),  INT8_C( 97),  INT8_C(122), -INT8_C( 88),  INT8_C(106) },
+        { -INT8_C( 45),  INT8_C( 44), -INT8_C( 80), -INT8_C(  3), -INT8_C(  6),  INT8_C( 19), -INT8_C(  1),  INT8_C(106),
+          -INT8_C(100), -INT8_C( 89), -INT8_C( 83),  INT8_C( 26),  INT8_C( 32),  INT8_C( 60),  INT8_C( 12), -INT8_C( 53) },
+        { -INT8_C( 63), -INT8_C(108),  INT8_C( 58),  INT8_C( 13), -INT8_C(  4),  INT8_C( 97),  INT8_C( 94), -INT8_C( 37),
+           INT8_C(114), -INT8_C( 57),  INT8_C( 30),  INT8_C( 20), -INT8_C( 93),  INT8_C(  6),  INT8_C( 39), -INT8_C(  1) },
+      } },
+    { {
+        -INT8_C( 15), -INT8_C( 20), -INT8_C(119),  INT8_C( 52), -INT8_C(124),  INT8_C(117),  INT8_C( 73), -INT8_C( 45),
+         INT8_C( 28),  INT8_C( 49), -INT8_C( 87),  INT8_C(112),  INT8_C( 88),  INT8_C(126), -INT8_C(125),  INT8_C(112),
+         INT8_C(  4),  INT8_C( 42),  INT8_C( 85),  INT8_C( 69), -INT8_C(125),  INT8_C( 60),  INT8_C(105), -INT8_C( 36),
+        -INT8_C( 43),  INT8_C( 27),  INT8_C(  7), -INT8_C( 36), -INT8_C( 65), -INT8_C( 89), -INT8_C( 48),  INT8_C( 35),
+        -INT8_C( 41), -INT8_C(104), -INT8_C( 70),  INT8_C( 31), -INT8_C( 98),  INT8_C( 80), -INT8_C(100),  INT8_C(118),
+         INT8_C(103),  INT8_C( 30),  INT8_C( 45),  INT8_C( 71), -INT8_C( 81),  INT8_C(  5), -INT8_C( 69),  INT8_C(118),
+        -INT8_C( 32),  INT8_C(108), -INT8_C( 87), -INT8_C( 52), -INT8_C( 72),  INT8_C( 21),  INT8_C( 21), -INT8_C( 51),
+        -INT8_C(  4),  INT8_C( 98), -INT8_C( 69), -INT8_C( 17),  INT8_C( 79), -INT8_C( 10),  INT8_C( 90), -INT8_C( 22)
+      },
+      {
+        { -INT8_C( 15), -INT8_C(124),  INT8_C( 28),  INT8_C( 88),  INT8_C(  4), -INT8_C(125), -INT8_C( 43), -INT8_C( 65),
+          -INT8_C( 41), -INT8_C( 98),  INT8_C(103), -INT8_C( 81), -INT8_C( 32), -INT8_C( 72), -INT8_C(  4),  INT8_C( 79) },
+        { -INT8_C( 20),  INT8_C(117),  INT8_C( 49),  INT8_C(126),  INT8_C( 42),  INT8_C( 60),  INT8_C( 27), -INT8_C( 89),
+          -INT8_C(104),  INT8_C( 80),  INT8_C( 30),  INT8_C(  5),  INT8_C(108),  INT8_C( 21),  INT8_C( 98), -INT8_C( 10) },
+        { -INT8_C(119),  INT8_C( 73), -INT8_C( 87), -INT8_C(125),  INT8_C( 85),  INT8_C(105),  INT8_C(  7), -INT8_C( 48),
+          -INT8_C( 70), -INT8_C(100),  INT8_C( 45), -INT8_C( 69), -INT8_C( 87),  INT8_C( 21), -INT8_C( 69),  INT8_C( 90) },
+        {  INT8_C( 52), -INT8_C( 45),  INT8_C(112),  INT8_C(112),  INT8_C( 69), -INT8_C( 36), -INT8_C( 36),  INT8_C( 35),
+           INT8_C( 31),  INT8_C(118),  INT8_C( 71),  INT8_C(118), -INT8_C( 52), -INT8_C( 51), -INT8_C( 17), -INT8_C( 22) },
+      } },
+    { {
+         INT8_C( 10), -INT8_C( 66), -INT8_C(109),  INT8_C(  4), -INT8_C(  7),  INT8_C( 36), -INT8_C( 35),  INT8_C(126),
+         INT8_C( 93),  INT8_C( 88), -INT8_C( 53), -INT8_C( 44),  INT8_C( 24), -INT8_C( 73), -INT8_C( 31),  INT8_C( 80),
+         INT8_C( 61),  INT8_C(103),  INT8_C( 49), -INT8_C( 33),  INT8_C( 88),  INT8_C( 93), -INT8_C(121), -INT8_C( 74),
+         INT8_C( 31),  INT8_C( 12), -INT8_C( 75),  INT8_C(116), -INT8_C( 14),  INT8_C( 58),  INT8_C(121),  INT8_C(103),
+        -INT8_C( 96), -INT8_C( 31),  INT8_C( 30),  INT8_C(113),  INT8_C(114), -INT8_C(104),  INT8_C(105), -INT8_C( 27),
+        -INT8_C( 88), -INT8_C( 52), -INT8_C( 47),  INT8_C( 55),  INT8_C( 69),  INT8_C( 43),  INT8_C(122), -INT8_C(121),
+         INT8_C( 98), -INT8_C( 77), -INT8_C(117), -INT8_C(102), -INT8_C(119), -INT8_C(106), -INT8_C( 69), -INT8_C( 65),
+        -INT8_C(116), -INT8_C(124), -INT8_C( 79), -INT8_C( 34),  INT8_C( 75),  INT8_C( 12), -INT8_C( 70), -INT8_C( 67)
+      },
+      {
+        {  INT8_C( 10), -INT8_C(  7),  INT8_C( 93),  INT8_C( 24),  INT8_C( 61),  INT8_C( 88),  INT8_C( 31), -INT8_C( 14),
+          -INT8_C( 96),  INT8_C(114), -INT8_C( 88),  INT8_C( 69),  INT8_C( 98), -INT8_C(119), -INT8_C(116),  INT8_C( 75) },
+        { -INT8_C( 66),  INT8_C( 36),  INT8_C( 88), -INT8_C( 73),  INT8_C(103),  INT8_C( 93),  INT8_C( 12),  INT8_C( 58),
+          -INT8_C( 31), -INT8_C(104), -INT8_C( 52),  INT8_C( 43), -INT8_C( 77), -INT8_C(106), -INT8_C(124),  INT8_C( 12) },
+        { -INT8_C(109), -INT8_C( 35), -INT8_C( 53), -INT8_C( 31),  INT8_C( 49), -INT8_C(121), -INT8_C( 75),  INT8_C(121),
+           INT8_C( 30),  INT8_C(105), -INT8_C( 47),  INT8_C(122), -INT8_C(117), -INT8_C( 69), -INT8_C( 79), -INT8_C( 70) },
+        {  INT8_C(  4),  INT8_C(126), -INT8_C( 44),  INT8_C( 80), -INT8_C( 33), -INT8_C( 74),  INT8_C(116),  INT8_C(103),
+           INT8_C(113), -INT8_C( 27),  INT8_C( 55), -INT8_C(121), -INT8_C(102), -INT8_C( 65), -INT8_C( 34), -INT8_C( 67) },
+      } },
+    { {
+         INT8_C( 14),  INT8_C(122),  INT8_C(127), -INT8_C( 35), -INT8_C( 17), -INT8_C( 31), -INT8_C( 41), -INT8_C( 77),
+         INT8_C( 15), -INT8_C(113),  INT8_C( 79), -INT8_C( 78),  INT8_C( 99),  INT8_C( 48),  INT8_C(  0),  INT8_C(123),
+         INT8_C(107),  INT8_C( 28), -INT8_C( 69),  INT8_C(110),  INT8_C( 27),  INT8_C( 55),  INT8_C( 89),  INT8_C( 25),
+         INT8_C( 53), -INT8_C( 69),  INT8_C( 21),  INT8_C( 33),  INT8_C( 55),  INT8_C( 52),  INT8_C( 52), -INT8_C( 65),
+        -INT8_C( 83), -INT8_C(  2),  INT8_C( 88), -INT8_C( 51), -INT8_C( 33), -INT8_C( 78),  INT8_C(  1),  INT8_C( 16),
+        -INT8_C( 24),  INT8_C( 45),  INT8_C(107),  INT8_C( 78),  INT8_C( 40),  INT8_C(  8),  INT8_C( 78),  INT8_C(110),
+        -INT8_C( 74), -INT8_C( 31), -INT8_C(106),  INT8_C( 58),  INT8_C( 46),  INT8_C( 35),  INT8_C( 79), -INT8_C( 41),
+        -INT8_C( 65), -INT8_C( 32),  INT8_C( 16), -INT8_C(  6), -INT8_C( 39),  INT8_C( 50), -INT8_C( 58),  INT8_C( 28)
+      },
+      {
+        {  INT8_C( 14), -INT8_C( 17),  INT8_C( 15),  INT8_C( 99),  INT8_C(107),  INT8_C( 27),  INT8_C( 53),  INT8_C( 55),
+          -INT8_C( 83), -INT8_C( 33), -INT8_C( 24),  INT8_C( 40), -INT8_C( 74),  INT8_C( 46), -INT8_C( 65), -INT8_C( 39) },
+        {  INT8_C(122), -INT8_C( 31), -INT8_C(113),  INT8_C( 48),  INT8_C( 28),  INT8_C( 55), -INT8_C( 69),  INT8_C( 52),
+          -INT8_C(  2), -INT8_C( 78),  INT8_C( 45),  INT8_C(  8), -INT8_C( 31),  INT8_C( 35), -INT8_C( 32),  INT8_C( 50) },
+        {  INT8_C(127), -INT8_C( 41),  INT8_C( 79),  INT8_C(  0), -INT8_C( 69),  INT8_C( 89),  INT8_C( 21),  INT8_C( 52),
+           INT8_C( 88),  INT8_C(  1),  INT8_C(107),  INT8_C( 78), -INT8_C(106),  INT8_C( 79),  INT8_C( 16), -INT8_C( 58) },
+        { -INT8_C( 35), -INT8_C( 77), -INT8_C( 78),  INT8_C(123),  INT8_C(110),  INT8_C( 25),  INT8_C( 33), -INT8_C( 65),
+          -INT8_C( 51),  INT8_C( 16),  INT8_C( 78),  INT8_C(110),  INT8_C( 58), -INT8_C( 41), -INT8_C(  6),  INT8_C( 28) },
+      } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x16x4_t r = simde_vld4q_s8(test_vec[i].a);
+    simde_int8x16x4_t expected = { {
+      simde_vld1q_s8(test_vec[i].r[0]),
+      simde_vld1q_s8(test_vec[i].r[1]),
+      simde_vld1q_s8(test_vec[i].r[2]),
+      simde_vld1q_s8(test_vec[i].r[3])
+    } };
+
+    simde_test_arm_neon_assert_equal_i8x16x4(r, expected);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld4q_u16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t a[32];
+    uint16_t r[4][8];
+  } test_vec[] = {
+    { {
+        UINT16_C(41294), UINT16_C(39194), UINT16_C(38066), UINT16_C(63751), UINT16_C(  601), UINT16_C(61710), UINT16_C(12192), UINT16_C( 3856),
+        UINT16_C(41959), UINT16_C(54377), UINT16_C(20678), UINT16_C(16392), UINT16_C(19752), UINT16_C(15869), UINT16_C(64687), UINT16_C(17642),
+        UINT16_C(18890), UINT16_C(53368), UINT16_C(34734), UINT16_C(13415), UINT16_C(26436), UINT16_C(22295), UINT16_C(54572), UINT16_C(25723),
+        UINT16_C(45281), UINT16_C(65294), UINT16_C( 5051), UINT16_C(50210), UINT16_C(24957), UINT16_C(19588), UINT16_C( 9101), UINT16_C(21161)
+      },
+      {
+        { UINT16_C(41294), UINT16_C(  601), UINT16_C(41959), UINT16_C(19752), UINT16_C(18890), UINT16_C(26436), UINT16_C(45281), UINT16_C(24957) },
+        { UINT16_C(39194), UINT16_C(61710), UINT16_C(54377), UINT16_C(15869), UINT16_C(53368), UINT16_C(22295), UINT16_C(65294), UINT16_C(19588) },
+        { UINT16_C(38066), UINT16_C(12192), UINT16_C(20678), UINT16_C(64687), UINT16_C(34734), UINT16_C(54572), UINT16_C( 5051), UINT16_C( 9101) },
+        { UINT16_C(63751), UINT16_C( 3856), UINT16_C(16392), UINT16_C(17642), UINT16_C(13415), UINT16_C(25723), UINT16_C(50210), UINT16_C(21161) },
+      } },
+    { {
+        UINT16_C(60570), UINT16_C(17325), UINT16_C(23406), UINT16_C(58911), UINT16_C(33227), UINT16_C( 1893), UINT16_C(52253), UINT16_C(  573),
+        UINT16_C(48050), UINT16_C(14394), UINT16_C(53228), UINT16_C(60587), UINT16_C(26673), UINT16_C(37612), UINT16_C(60038), UINT16_C(23987),
+        UINT16_C(16200), UINT16_C(29409), UINT16_C(17638), UINT16_C(28509), UINT16_C( 3622), UINT16_C(36741), UINT16_C( 7924), UINT16_C(12441),
+        UINT16_C(64111), UINT16_C(50525), UINT16_C(34809), UINT16_C(38804), UINT16_C(38327), UINT16_C(27931), UINT16_C(38234), UINT16_C(24449)
+      },
+      {
+        { UINT16_C(60570), UINT16_C(33227), UINT16_C(48050), UINT16_C(26673), UINT16_C(16200), UINT16_C( 3622), UINT16_C(64111), UINT16_C(38327) },
+        { UINT16_C(17325), UINT16_C( 1893), UINT16_C(14394), UINT16_C(37612), UINT16_C(29409), UINT16_C(36741), UINT16_C(50525), UINT16_C(27931) },
+        { UINT16_C(23406), UINT16_C(52253), UINT16_C(53228), UINT16_C(60038), UINT16_C(17638), UINT16_C( 7924), UINT16_C(34809), UINT16_C(38234) },
+        { UINT16_C(58911), UINT16_C(  573), UINT16_C(60587), UINT16_C(23987), UINT16_C(28509), UINT16_C(12441), UINT16_C(38804), UINT16_C(24449) },
+      } },
+    { {
+        UINT16_C( 2789), UINT16_C(38360), UINT16_C(60977), UINT16_C(17027), UINT16_C(33933), UINT16_C(39146), UINT16_C(50718), UINT16_C(59929),
+        UINT16_C( 1641), UINT16_C(16653), UINT16_C(17754), UINT16_C(57316), UINT16_C(26177), UINT16_C(49265), UINT16_C(15144), UINT16_C(46041),
+        UINT16_C(40338), UINT16_C(40673), UINT16_C(52796), UINT16_C(23038), UINT16_C(39251), UINT16_C(28514), UINT16_C(59579), UINT16_C(15388),
+        UINT16_C( 5848), UINT16_C(53497), UINT16_C( 2621), UINT16_C(63017), UINT16_C(54599), UINT16_C(35118), UINT16_C( 3229), UINT16_C(28326)
+      },
+      {
+        { UINT16_C( 2789), UINT16_C(33933), UINT16_C( 1641), UINT16_C(26177), UINT16_C(40338), UINT16_C(39251), UINT16_C( 5848), UINT16_C(54599) },
+        { UINT16_C(38360), UINT16_C(39146), UINT16_C(16653), UINT16_C(49265), UINT16_C(40673), UINT16_C(28514), UINT16_C(53497), UINT16_C(35118) },
+        { UINT16_C(60977), UINT16_C(50718), UINT16_C(17754), UINT16_C(15144), UINT16_C(52796), UINT16_C(59579), UINT16_C( 2621), UINT16_C( 3229) },
+        { UINT16_C(17027), UINT16_C(59929), UINT16_C(57316), UINT16_C(46041), UINT16_C(23038), UINT16_C(15388), UINT16_C(63017), UINT16_C(28326) },
+      } },
+    { {
+        UINT16_C(27343), UINT16_C(30941), UINT16_C(37262), UINT16_C(19088), UINT16_C( 1990), UINT16_C(31947), UINT16_C( 5218), UINT16_C(27599),
+        UINT16_C(21043), UINT16_C(17341), UINT16_C(40118), UINT16_C(65416), UINT16_C(37005), UINT16_C(57398), UINT16_C(33459), UINT16_C( 2611),
+        UINT16_C(39077), UINT16_C(42370), UINT16_C(32793), UINT16_C(31911), UINT16_C( 1457), UINT16_C(  995), UINT16_C(60387), UINT16_C(23352),
+        UINT16_C(25587), UINT16_C( 5500), UINT16_C(37275), UINT16_C(36664), UINT16_C(38336), UINT16_C(21206), UINT16_C(19490), UINT16_C(32276)
+      },
+      {
+        { UINT16_C(27343), UINT16_C( 1990), UINT16_C(21043), UINT16_C(37005), UINT16_C(39077), UINT16_C( 1457), UINT16_C(25587), UINT16_C(38336) },
+        { UINT16_C(30941), UINT16_C(31947), UINT16_C(17341), UINT16_C(57398), UINT16_C(42370), UINT16_C(  995), UINT16_C( 5500), UINT16_C(21206) },
+        { UINT16_C(37262), UINT16_C( 5218), UINT16_C(40118), UINT16_C(33459), UINT16_C(32793), UINT16_C(60387), UINT16_C(37275), UINT16_C(19490) },
+        { UINT16_C(19088), UINT16_C(27599), UINT16_C(65416), UINT16_C( 2611), UINT16_C(31911), UINT16_C(23352), UINT16_C(36664), UINT16_C(32276) },
+      } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x8x4_t r = simde_vld4q_u16(test_vec[i].a);
+    simde_uint16x8x4_t expected = { {
+      simde_vld1q_u16(test_vec[i].r[0]),
+      simde_vld1q_u16(test_vec[i].r[1]),
+      simde_vld1q_u16(test_vec[i].r[2]),
+      simde_vld1q_u16(test_vec[i].r[3])
+    } };
+
+    simde_test_arm_neon_assert_equal_u16x8x4(r, expected);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld4q_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t a[16];
+    int32_t r[4][4];
+  } test_vec[] = {
+    { {
+        -INT32_C( 498735482),  INT32_C(1038589978),  INT32_C(1432155183),  INT32_C( 836281773),
+         INT32_C(1664976082),  INT32_C( 430094427), -INT32_C(1774101479),  INT32_C(1505678828),
+        -INT32_C(1497000990), -INT32_C(1916314265),  INT32_C( 434389260),  INT32_C( 890371596),
+         INT32_C( 800750547), -INT32_C( 483683714), -INT32_C(1010563232),  INT32_C(1764080853)
+      },
+      {
+        { -INT32_C( 498735482),  INT32_C(1664976082), -INT32_C(1497000990),  INT32_C( 800750547) },
+        {  INT32_C(1038589978),  INT32_C( 430094427), -INT32_C(1916314265), -INT32_C( 483683714) },
+        {  INT32_C(1432155183), -INT32_C(1774101479),  INT32_C( 434389260), -INT32_C(1010563232) },
+        {  INT32_C( 836281773),  INT32_C(1505678828),  INT32_C( 890371596),  INT32_C(1764080853) },
+      } },
+    { {
+         INT32_C(1786370391),  INT32_C( 262282866),  INT32_C(2079129654),  INT32_C( 331072402),
+         INT32_C( 778967075),  INT32_C( 378013353),  INT32_C(  68136897),  INT32_C(2122051998),
+         INT32_C(1514720747), -INT32_C(1415839715),  INT32_C( 180949336), -INT32_C(  49675474),
+         INT32_C(1048672977), -INT32_C(2087371683),  INT32_C( 349558733), -INT32_C(2087626584)
+      },
+      {
+        {  INT32_C(1786370391),  INT32_C( 778967075),  INT32_C(1514720747),  INT32_C(1048672977) },
+        {  INT32_C( 262282866),  INT32_C( 378013353), -INT32_C(1415839715), -INT32_C(2087371683) },
+        {  INT32_C(2079129654),  INT32_C(  68136897),  INT32_C( 180949336),  INT32_C( 349558733) },
+        {  INT32_C( 331072402),  INT32_C(2122051998), -INT32_C(  49675474), -INT32_C(2087626584) },
+      } },
+    { {
+         INT32_C( 543716030),  INT32_C(1445294815),  INT32_C(1180050647),  INT32_C(  20695572),
+         INT32_C(1048813343), -INT32_C( 345674824),  INT32_C(1770147000), -INT32_C( 887315346),
+        -INT32_C( 248508126),  INT32_C( 629196267), -INT32_C(1816396445),  INT32_C(2022915992),
+         INT32_C( 305237302),  INT32_C( 886964310),  INT32_C(1641433245), -INT32_C(1387668347)
+      },
+      {
+        {  INT32_C( 543716030),  INT32_C(1048813343), -INT32_C( 248508126),  INT32_C( 305237302) },
+        {  INT32_C(1445294815), -INT32_C( 345674824),  INT32_C( 629196267),  INT32_C( 886964310) },
+        {  INT32_C(1180050647),  INT32_C(1770147000), -INT32_C(1816396445),  INT32_C(1641433245) },
+        {  INT32_C(  20695572), -INT32_C( 887315346),  INT32_C(2022915992), -INT32_C(1387668347) },
+      } },
+    { {
+        -INT32_C( 554053269),  INT32_C(1075242917), -INT32_C(1419113686), -INT32_C(  71380164),
+         INT32_C(1338622427),  INT32_C(1529005467), -INT32_C( 946828087),  INT32_C(1017042565),
+         INT32_C( 120543060), -INT32_C( 692818966),  INT32_C( 133801558), -INT32_C(1823332896),
+         INT32_C(1561665623), -INT32_C( 792725486), -INT32_C(1818110159),  INT32_C(1008885531)
+      },
+      {
+        { -INT32_C( 554053269),  INT32_C(1338622427),  INT32_C( 120543060),  INT32_C(1561665623) },
+        {  INT32_C(1075242917),  INT32_C(1529005467), -INT32_C( 692818966), -INT32_C( 792725486) },
+        { -INT32_C(1419113686), -INT32_C( 946828087),  INT32_C( 133801558), -INT32_C(1818110159) },
+        { -INT32_C(  71380164),  INT32_C(1017042565), -INT32_C(1823332896),  INT32_C(1008885531) },
+      } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4x4_t r = simde_vld4q_s32(test_vec[i].a);
+    simde_int32x4x4_t expected = { {
+      simde_vld1q_s32(test_vec[i].r[0]),
+      simde_vld1q_s32(test_vec[i].r[1]),
+      simde_vld1q_s32(test_vec[i].r[2]),
+      simde_vld1q_s32(test_vec[i].r[3])
+    } };
+
+    simde_test_arm_neon_assert_equal_i32x4x4(r, expected);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld4q_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32_t a[16];
+    simde_float32_t r[4][4];
+  } test_vec[] = {
+    { {
+        SIMDE_FLOAT32_C(  -781.92), SIMDE_FLOAT32_C(   843.31), SIMDE_FLOAT32_C(  -934.30), SIMDE_FLOAT32_C(  -448.74),
+        SIMDE_FLOAT32_C(   356.74), SIMDE_FLOAT32_C(  -368.80), SIMDE_FLOAT32_C(   407.80), SIMDE_FLOAT32_C(   334.91),
+        SIMDE_FLOAT32_C(  -132.29), SIMDE_FLOAT32_C(  -427.50), SIMDE_FLOAT32_C(  -427.86), SIMDE_FLOAT32_C(  -374.30),
+        SIMDE_FLOAT32_C(  -866.90), SIMDE_FLOAT32_C(   897.29), SIMDE_FLOAT32_C(   601.38), SIMDE_FLOAT32_C(  -996.95)
+      },
+      {
+        { SIMDE_FLOAT32_C(  -781.92), SIMDE_FLOAT32_C(   356.74), SIMDE_FLOAT32_C(  -132.29), SIMDE_FLOAT32_C(  -866.90) },
+        { SIMDE_FLOAT32_C(   843.31), SIMDE_FLOAT32_C(  -368.80), SIMDE_FLOAT32_C(  -427.50), SIMDE_FLOAT32_C(   897.29) },
+        { SIMDE_FLOAT32_C(  -934.30), SIMDE_FLOAT32_C(   407.80), SIMDE_FLOAT32_C(  -427.86), SIMDE_FLOAT32_C(   601.38) },
+        { SIMDE_FLOAT32_C(  -448.74), SIMDE_FLOAT32_C(   334.91), SIMDE_FLOAT32_C(  -374.30), SIMDE_FLOAT32_C(  -996.95) },
+      } },
+    { {
+        SIMDE_FLOAT32_C(   602.63), SIMDE_FLOAT32_C(   891.43), SIMDE_FLOAT32_C(   733.26), SIMDE_FLOAT32_C(   -32.63),
+        SIMDE_FLOAT32_C(   536.01), SIMDE_FLOAT32_C(   259.02), SIMDE_FLOAT32_C(   475.45), SIMDE_FLOAT32_C(  -147.28),
+        SIMDE_FLOAT32_C(   164.23), SIMDE_FLOAT32_C(  -324.91), SIMDE_FLOAT32_C(  -528.30), SIMDE_FLOAT32_C(   896.59),
+        SIMDE_FLOAT32_C(   909.50), SIMDE_FLOAT32_C(  -668.18), SIMDE_FLOAT32_C(   437.73), SIMDE_FLOAT32_C(  -722.26)
+      },
+      {
+        { SIMDE_FLOAT32_C(   602.63), SIMDE_FLOAT32_C(   536.01), SIMDE_FLOAT32_C(   164.23), SIMDE_FLOAT32_C(   909.50) },
+        { SIMDE_FLOAT32_C(   891.43), SIMDE_FLOAT32_C(   259.02), SIMDE_FLOAT32_C(  -324.91), SIMDE_FLOAT32_C(  -668.18) },
+        { SIMDE_FLOAT32_C(   733.26), SIMDE_FLOAT32_C(   475.45), SIMDE_FLOAT32_C(  -528.30), SIMDE_FLOAT32_C(   437.73) },
+        { SIMDE_FLOAT32_C(   -32.63), SIMDE_FLOAT32_C(  -147.28), SIMDE_FLOAT32_C(   896.59), SIMDE_FLOAT32_C(  -722.26) },
+      } },
+    { {
+        SIMDE_FLOAT32_C(   149.99), SIMDE_FLOAT32_C(   801.11), SIMDE_FLOAT32_C(  -363.71), SIMDE_FLOAT32_C(  -801.15),
+        SIMDE_FLOAT32_C(   624.20), SIMDE_FLOAT32_C(   -73.84), SIMDE_FLOAT32_C(  -263.31), SIMDE_FLOAT32_C(   431.50),
+        SIMDE_FLOAT32_C(  -432.46), SIMDE_FLOAT32_C(   877.93), SIMDE_FLOAT32_C(  -992.70), SIMDE_FLOAT32_C(   941.75),
+        SIMDE_FLOAT32_C(   900.81), SIMDE_FLOAT32_C(  -763.85), SIMDE_FLOAT32_C(   884.49), SIMDE_FLOAT32_C(  -120.93)
+      },
+      {
+        { SIMDE_FLOAT32_C(   149.99), SIMDE_FLOAT32_C(   624.20), SIMDE_FLOAT32_C(  -432.46), SIMDE_FLOAT32_C(   900.81) },
+        { SIMDE_FLOAT32_C(   801.11), SIMDE_FLOAT32_C(   -73.84), SIMDE_FLOAT32_C(   877.93), SIMDE_FLOAT32_C(  -763.85) },
+        { SIMDE_FLOAT32_C(  -363.71), SIMDE_FLOAT32_C(  -263.31), SIMDE_FLOAT32_C(  -992.70), SIMDE_FLOAT32_C(   884.49) },
+        { SIMDE_FLOAT32_C(  -801.15), SIMDE_FLOAT32_C(   431.50), SIMDE_FLOAT32_C(   941.75), SIMDE_FLOAT32_C(  -120.93) },
+      } },
+    { {
+        SIMDE_FLOAT32_C(  -481.11), SIMDE_FLOAT32_C(  -321.80), SIMDE_FLOAT32_C(   333.01), SIMDE_FLOAT32_C(   560.80),
+        SIMDE_FLOAT32_C(   751.61), SIMDE_FLOAT32_C(  -359.70), SIMDE_FLOAT32_C(   178.40), SIMDE_FLOAT32_C(  -855.63),
+        SIMDE_FLOAT32_C(  -731.52), SIMDE_FLOAT32_C(   565.29), SIMDE_FLOAT32_C(  -897.86), SIMDE_FLOAT32_C(   422.88),
+        SIMDE_FLOAT32_C(   255.91), SIMDE_FLOAT32_C(  -628.98), SIMDE_FLOAT32_C(   451.23), SIMDE_FLOAT32_C(  -781.58)
+      },
+      {
+        { SIMDE_FLOAT32_C(  -481.11), SIMDE_FLOAT32_C(   751.61), SIMDE_FLOAT32_C(  -731.52), SIMDE_FLOAT32_C(   255.91) },
+        { SIMDE_FLOAT32_C(  -321.80), SIMDE_FLOAT32_C(  -359.70), SIMDE_FLOAT32_C(   565.29), SIMDE_FLOAT32_C(  -628.98) },
+        { SIMDE_FLOAT32_C(   333.01), SIMDE_FLOAT32_C(   178.40), SIMDE_FLOAT32_C(  -897.86), SIMDE_FLOAT32_C(   451.23) },
+        { SIMDE_FLOAT32_C(   560.80), SIMDE_FLOAT32_C(  -855.63), SIMDE_FLOAT32_C(   422.88), SIMDE_FLOAT32_C(  -781.58) },
+      } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4x4_t r = simde_vld4q_f32(test_vec[i].a);
+    simde_float32x4x4_t expected = { {
+      simde_vld1q_f32(test_vec[i].r[0]),
+      simde_vld1q_f32(test_vec[i].r[1]),
+      simde_vld1q_f32(test_vec[i].r[2]),
+      simde_vld1q_f32(test_vec[i].r[3])
+    } };
+
+    simde_test_arm_neon_assert_equal_f32x4x4(r, expected, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld4q_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a[8];
+    uint64_t r[4][2];
+  } test_vec[] = {
+    { {
+        UINT64_C(16336286178153548690), UINT64_C( 7938165428203504093), UINT64_C(12010132798405340127), UINT64_C(  237548920770595511),
+        UINT64_C( 3808143564994865018), UINT64_C(16750207037953563253), UINT64_C(18376196479045574892), UINT64_C( 5028930643956711759)
+      },
+      {
+        { UINT64_C(16336286178153548690), UINT64_C( 3808143564994865018) },
+        { UINT64_C( 7938165428203504093), UINT64_C(16750207037953563253) },
+        { UINT64_C(12010132798405340127), UINT64_C(18376196479045574892) },
+        { UINT64_C(  237548920770595511), UINT64_C( 5028930643956711759) },
+      } },
+    { {
+        UINT64_C(18178980762091792395), UINT64_C( 9065789831701566219), UINT64_C(  148623459290743023), UINT64_C(10602971318986770195),
+        UINT64_C( 3404514701374638842), UINT64_C( 4789519059073276744), UINT64_C(14320954135741659461), UINT64_C(17352754275400625234)
+      },
+      {
+        { UINT64_C(18178980762091792395), UINT64_C( 3404514701374638842) },
+        { UINT64_C( 9065789831701566219), UINT64_C( 4789519059073276744) },
+        { UINT64_C(  148623459290743023), UINT64_C(14320954135741659461) },
+        { UINT64_C(10602971318986770195), UINT64_C(17352754275400625234) },
+      } },
+    { {
+        UINT64_C( 7853439122937521062), UINT64_C( 5991000966336924866), UINT64_C( 8099082714848286589), UINT64_C( 1145528846821752264),
+        UINT64_C( 3498693005949630260), UINT64_C( 3480596739506533050), UINT64_C(18371024830762392336), UINT64_C(18241240644375800657)
+      },
+      {
+        { UINT64_C( 7853439122937521062), UINT64_C( 3498693005949630260) },
+        { UINT64_C( 5991000966336924866), UINT64_C( 3480596739506533050) },
+        { UINT64_C( 8099082714848286589), UINT64_C(18371024830762392336) },
+        { UINT64_C( 1145528846821752264), UINT64_C(18241240644375800657) },
+      } },
+    { {
+        UINT64_C( 8506141210767625909), UINT64_C(  373862939666286445), UINT64_C( 9053143685979477731), UINT64_C( 1402962190187204293),
+        UINT64_C( 5257498701432943493), UINT64_C( 7438553470366228816), UINT64_C(11971996334016322609), UINT64_C( 9420657964842875703)
+      },
+      {
+        { UINT64_C( 8506141210767625909), UINT64_C( 5257498701432943493) },
+        { UINT64_C(  373862939666286445), UINT64_C( 7438553470366228816) },
+        { UINT64_C( 9053143685979477731), UINT64_C(11971996334016322609) },
+        { UINT64_C( 1402962190187204293), UINT64_C( 9420657964842875703) },
+      } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x2x4_t r = simde_vld4q_u64(test_vec[i].a);
+    simde_uint64x2x4_t expected = { {
+      simde_vld1q_u64(test_vec[i].r[0]),
+      simde_vld1q_u64(test_vec[i].r[1]),
+      simde_vld1q_u64(test_vec[i].r[2]),
+      simde_vld1q_u64(test_vec[i].r[3])
+    } };
+
+    simde_test_arm_neon_assert_equal_u64x2x4(r, expected);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld4q_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64_t a[8];
+    simde_float64_t r[4][2];
+  } test_vec[] = {
+    { {
+        SIMDE_FLOAT64_C(   669.09), SIMDE_FLOAT64_C(   -54.81), SIMDE_FLOAT64_C(   595.21), SIMDE_FLOAT64_C(  -100.84),
+        SIMDE_FLOAT64_C(   826.14), SIMDE_FLOAT64_C(  -288.88), SIMDE_FLOAT64_C(  -119.69), SIMDE_FLOAT64_C(  -866.82)
+      },
+      {
+        { SIMDE_FLOAT64_C(   669.09), SIMDE_FLOAT64_C(   826.14) },
+        { SIMDE_FLOAT64_C(   -54.81), SIMDE_FLOAT64_C(  -288.88) },
+        { SIMDE_FLOAT64_C(   595.21), SIMDE_FLOAT64_C(  -119.69) },
+        { SIMDE_FLOAT64_C(  -100.84), SIMDE_FLOAT64_C(  -866.82) },
+      } },
+    { {
+        SIMDE_FLOAT64_C(   392.96), SIMDE_FLOAT64_C(   798.69), SIMDE_FLOAT64_C(   982.68), SIMDE_FLOAT64_C(   454.42),
+        SIMDE_FLOAT64_C(  -492.39), SIMDE_FLOAT64_C(  -537.52), SIMDE_FLOAT64_C(  -482.37), SIMDE_FLOAT64_C(   596.16)
+      },
+      {
+        { SIMDE_FLOAT64_C(   392.96), SIMDE_FLOAT64_C(  -492.39) },
+        { SIMDE_FLOAT64_C(   798.69), SIMDE_FLOAT64_C(  -537.52) },
+        { SIMDE_FLOAT64_C(   982.68), SIMDE_FLOAT64_C(  -482.37) },
+        { SIMDE_FLOAT64_C(   454.42), SIMDE_FLOAT64_C(   596.16) },
+      } },
+    { {
+        SIMDE_FLOAT64_C(   620.98), SIMDE_FLOAT64_C(   -37.14), SIMDE_FLOAT64_C(   730.78), SIMDE_FLOAT64_C(  -725.15),
+        SIMDE_FLOAT64_C(   232.89), SIMDE_FLOAT64_C(  -280.71), SIMDE_FLOAT64_C(   346.83), SIMDE_FLOAT64_C(  -311.56)
+      },
+      {
+        { SIMDE_FLOAT64_C(   620.98), SIMDE_FLOAT64_C(   232.89) },
+        { SIMDE_FLOAT64_C(   -37.14), SIMDE_FLOAT64_C(  -280.71) },
+        { SIMDE_FLOAT64_C(   730.78), SIMDE_FLOAT64_C(   346.83) },
+        { SIMDE_FLOAT64_C(  -725.15), SIMDE_FLOAT64_C(  -311.56) },
+      } },
+    { {
+        SIMDE_FLOAT64_C(   442.81), SIMDE_FLOAT64_C(   326.56), SIMDE_FLOAT64_C(   559.15), SIMDE_FLOAT64_C(  -404.78),
+        SIMDE_FLOAT64_C(   228.51), SIMDE_FLOAT64_C(  -235.21), SIMDE_FLOAT64_C(   686.36), SIMDE_FLOAT64_C(  -247.46)
+      },
+      {
+        { SIMDE_FLOAT64_C(   442.81), SIMDE_FLOAT64_C(   228.51) },
+        { SIMDE_FLOAT64_C(   326.56), SIMDE_FLOAT64_C(  -235.21) },
+        { SIMDE_FLOAT64_C(   559.15), SIMDE_FLOAT64_C(   686.36) },
+        { SIMDE_FLOAT64_C(  -404.78), SIMDE_FLOAT64_C(  -247.46) },
+      } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2x4_t r = simde_vld4q_f64(test_vec[i].a);
+    simde_float64x2x4_t expected = { {
+      simde_vld1q_f64(test_vec[i].r[0]),
+      simde_vld1q_f64(test_vec[i].r[1]),
+      simde_vld1q_f64(test_vec[i].r[2]),
+      simde_vld1q_f64(test_vec[i].r[3])
+    } };
+
+    simde_test_arm_neon_assert_equal_f64x2x4(r, expected, 1);
+  }
+
+  return 0;
+}
+
 #endif /* !defined(SIMDE_BUG_INTEL_857088) */
 SIMDE_TEST_FUNC_LIST_BEGIN
 #if !defined(SIMDE_BUG_INTEL_857088)
 SIMDE_TEST_FUNC_LIST_ENTRY(vld4_f16)
 SIMDE_TEST_FUNC_LIST_ENTRY(vld4q_f16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld4_u8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld4_s16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld4q_u8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld4q_s8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld4q_u16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld4q_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld4q_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld4q_u64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld4q_f64)
 #endif /* !defined(SIMDE_BUG_INTEL_857088) */
 SIMDE_TEST_FUNC_LIST_END
 
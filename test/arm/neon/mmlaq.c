@@ -92,6 +92,26 @@ test_simde_vmmlaq_s32 (SIMDE_MUNIT_TEST_ARGS) {
         -INT8_C(        19), -INT8_C(        61),  INT8_C(        49), -INT8_C(        99),
         -INT8_C(        66), -INT8_C(        58),  INT8_C(        81), -INT8_C(       119) },
       {  INT32_C(1433661461), -INT32_C(1717024191), -INT32_C(1630561478), -INT32_C( 713674880) } },
+    { {            INT32_MAX,            INT32_MIN, -INT32_C(         1),  INT32_C(         0) },
+      {            INT8_MIN,            INT8_MIN,            INT8_MIN,            INT8_MIN,
+                   INT8_MIN,            INT8_MIN,            INT8_MIN,            INT8_MIN,
+                   INT8_MIN,            INT8_MIN,            INT8_MIN,            INT8_MIN,
+                   INT8_MIN,            INT8_MIN,            INT8_MIN,            INT8_MIN },
+      {            INT8_MIN,            INT8_MIN,            INT8_MIN,            INT8_MIN,
+                   INT8_MIN,            INT8_MIN,            INT8_MIN,            INT8_MIN,
+                   INT8_MIN,            INT8_MIN,            INT8_MIN,            INT8_MIN,
+                   INT8_MIN,            INT8_MIN,            INT8_MIN,            INT8_MIN },
+      { -INT32_C(2147352577), -INT32_C(2147352576),  INT32_C(    131071),  INT32_C(    131072) } },
+    { {  INT32_C(         0), -INT32_C(         1),            INT32_MIN,            INT32_MAX },
+      {            INT8_MIN,            INT8_MAX, -INT8_C(         1),            INT8_MIN,
+         INT8_C(         1),            INT8_MIN,            INT8_MAX, -INT8_C(       127),
+                   INT8_MIN,            INT8_MAX, -INT8_C(         1),            INT8_MIN,
+         INT8_C(         1),            INT8_MIN,            INT8_MAX, -INT8_C(       127) },
+      {            INT8_MIN,  INT8_C(         1),            INT8_MIN,            INT8_MAX,
+        -INT8_C(       127),            INT8_MIN,            INT8_MAX, -INT8_C(         1),
+                   INT8_MIN,  INT8_C(         1),            INT8_MIN,            INT8_MAX,
+        -INT8_C(       127),            INT8_MIN,            INT8_MAX, -INT8_C(         1) },
+      {  INT32_C(     32896),  INT32_C(     32895), -INT32_C(2147450752), -INT32_C(2147450753) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -214,6 +234,26 @@ test_simde_vmmlaq_u32 (SIMDE_MUNIT_TEST_ARGS) {
          UINT32_C(        69),  UINT32_C(       183),  UINT32_C(       218),  UINT32_C(        99),
          UINT32_C(        50),  UINT32_C(        59),  UINT32_C(       181),  UINT32_C(        53) },
       {  UINT32_C(3606118076),  UINT32_C(3050076203),  UINT32_C(4195791756),  UINT32_C(2145035342) } },
+    { {            UINT32_MAX,  UINT32_C(4294967294),  UINT32_C(         0),  UINT32_C(         1) },
+      {  UINT32_C(       255),  UINT32_C(       255),  UINT32_C(       255),  UINT32_C(       255),
+         UINT32_C(       255),  UINT32_C(       255),  UINT32_C(       255),  UINT32_C(       255),
+         UINT32_C(       255),  UINT32_C(       255),  UINT32_C(       255),  UINT32_C(       255),
+         UINT32_C(       255),  UINT32_C(       255),  UINT32_C(       255),  UINT32_C(       255) },
+      {  UINT32_C(       255),  UINT32_C(       255),  UINT32_C(       255),  UINT32_C(       255),
+         UINT32_C(       255),  UINT32_C(       255),  UINT32_C(       255),  UINT32_C(       255),
+         UINT32_C(       255),  UINT32_C(       255),  UINT32_C(       255),  UINT32_C(       255),
+         UINT32_C(       255),  UINT32_C(       255),  UINT32_C(       255),  UINT32_C(       255) },
+      {  UINT32_C(    520199),  UINT32_C(    520198),  UINT32_C(    520200),  UINT32_C(    520201) } },
+    { {  UINT32_C(         1),  UINT32_C(         0),  UINT32_C(4294967294),            UINT32_MAX },
+      {  UINT32_C(       255),  UINT32_C(       128),  UINT32_C(       127),  UINT32_C(       255),
+         UINT32_C(         0),  UINT32_C(       255),  UINT32_C(         1),  UINT32_C(       128),
+         UINT32_C(       255),  UINT32_C(       128),  UINT32_C(       127),  UINT32_C(       255),
+         UINT32_C(         0),  UINT32_C(       255),  UINT32_C(         1),  UINT32_C(       128) },
+      {  UINT32_C(       255),  UINT32_C(         0),  UINT32_C(       255),  UINT32_C(         1),
+         UINT32_C(       128),  UINT32_C(       255),  UINT32_C(       128),  UINT32_C(       127),
+         UINT32_C(       255),  UINT32_C(         0),  UINT32_C(       255),  UINT32_C(         1),
+         UINT32_C(       128),  UINT32_C(       255),  UINT32_C(       128),  UINT32_C(       127) },
+      {  UINT32_C(    179075),  UINT32_C(    179074),  UINT32_C(    179072),  UINT32_C(    179073) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -336,6 +376,26 @@ test_simde_vusmmlaq_s32 (SIMDE_MUNIT_TEST_ARGS) {
         -INT8_C(        29), -INT8_C(        26),  INT8_C(         7),  INT8_C(       117),
          INT8_C(       109),  INT8_C(        55), -INT8_C(        71), -INT8_C(        63) },
       {  INT32_C(  86903118), -INT32_C(1590397115), -INT32_C( 509274403),  INT32_C( 511112073) } },
+    { {            INT32_MAX,            INT32_MIN, -INT32_C(         1),  INT32_C(         0) },
+      {            UINT8_MAX,            UINT8_MAX,            UINT8_MAX,            UINT8_MAX,
+                   UINT8_MAX,            UINT8_MAX,            UINT8_MAX,            UINT8_MAX,
+                   UINT8_MAX,            UINT8_MAX,            UINT8_MAX,            UINT8_MAX,
+                   UINT8_MAX,            UINT8_MAX,            UINT8_MAX,            UINT8_MAX },
+      {            INT8_MIN,            INT8_MIN,            INT8_MIN,            INT8_MIN,
+                   INT8_MIN,            INT8_MIN,            INT8_MIN,            INT8_MIN,
+                   INT8_MIN,            INT8_MIN,            INT8_MIN,            INT8_MIN,
+                   INT8_MIN,            INT8_MIN,            INT8_MIN,            INT8_MIN },
+      {  INT32_C(2147222527),  INT32_C(2147222528), -INT32_C(    261121), -INT32_C(    261120) } },
+    { {  INT32_C(         0), -INT32_C(         1),            INT32_MIN,            INT32_MAX },
+      {            UINT8_MAX,  UINT8_C(       128),  UINT8_C(       127),            UINT8_MAX,
+         UINT8_C(         0),            UINT8_MAX,  UINT8_C(         1),  UINT8_C(       128),
+                   UINT8_MAX,  UINT8_C(       128),  UINT8_C(       127),            UINT8_MAX,
+         UINT8_C(         0),            UINT8_MAX,  UINT8_C(         1),  UINT8_C(       128) },
+      {            INT8_MIN,  INT8_C(         1),            INT8_MIN,            INT8_MAX,
+        -INT8_C(       127),            INT8_MIN,            INT8_MAX, -INT8_C(         1),
+                   INT8_MIN,  INT8_C(         1),            INT8_MIN,            INT8_MAX,
+        -INT8_C(       127),            INT8_MIN,            INT8_MAX, -INT8_C(         1) },
+      { -INT32_C(     49024), -INT32_C(     49025),  INT32_C(2147434624),  INT32_C(2147434623) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -333,6 +333,13 @@ test_simde_vqtbl2_u8 (SIMDE_MUNIT_TEST_ARGS) {
             UINT8_C( 78), UINT8_C( 89), UINT8_C(181), UINT8_C(105), UINT8_C( 27), UINT8_C(152), UINT8_C(179), UINT8_C(245) } },
       { UINT8_C(132), UINT8_C( 22), UINT8_C(190), UINT8_C( 20), UINT8_C( 22), UINT8_C(  4), UINT8_C(155), UINT8_C( 20) },
       { UINT8_C(  0), UINT8_C(142), UINT8_C(  0), UINT8_C( 62), UINT8_C(142), UINT8_C(207), UINT8_C(  0), UINT8_C( 62) } },
+    {
+        { {    UINT8_MAX, UINT8_C(254), UINT8_C(253), UINT8_C(252), UINT8_C(251), UINT8_C(250), UINT8_C(249), UINT8_C(248),
+            UINT8_C(247), UINT8_C(246), UINT8_C(245), UINT8_C(244), UINT8_C(243), UINT8_C(242), UINT8_C(241), UINT8_C(240) },
+          { UINT8_C(239), UINT8_C(238), UINT8_C(237), UINT8_C(236), UINT8_C(235), UINT8_C(234), UINT8_C(233), UINT8_C(232),
+            UINT8_C(231), UINT8_C(230), UINT8_C(229), UINT8_C(228), UINT8_C(227), UINT8_C(226), UINT8_C(225), UINT8_C(224) } },
+      { UINT8_C(  0), UINT8_C( 16), UINT8_C( 31), UINT8_C( 32), UINT8_C( 47), UINT8_C(128), UINT8_C(143),    UINT8_MAX },
+      {    UINT8_MAX, UINT8_C(239), UINT8_C(224), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -571,6 +578,15 @@ test_simde_vqtbl3_u8 (SIMDE_MUNIT_TEST_ARGS) {
             UINT8_C( 94), UINT8_C(207), UINT8_C(232), UINT8_C( 89), UINT8_C( 58), UINT8_C(184), UINT8_C(213), UINT8_C( 62) } },
       { UINT8_C( 20), UINT8_C( 30), UINT8_C( 23), UINT8_C( 43), UINT8_C( 15), UINT8_C( 41), UINT8_C(  7), UINT8_C(  0) },
       { UINT8_C(118), UINT8_C(200), UINT8_C( 12), UINT8_C( 89), UINT8_C(123), UINT8_C(207), UINT8_C( 82), UINT8_C(137) } },
+    {
+        { {    UINT8_MAX, UINT8_C(254), UINT8_C(253), UINT8_C(252), UINT8_C(251), UINT8_C(250), UINT8_C(249), UINT8_C(248),
+            UINT8_C(247), UINT8_C(246), UINT8_C(245), UINT8_C(244), UINT8_C(243), UINT8_C(242), UINT8_C(241), UINT8_C(240) },
+          { UINT8_C(239), UINT8_C(238), UINT8_C(237), UINT8_C(236), UINT8_C(235), UINT8_C(234), UINT8_C(233), UINT8_C(232),
+            UINT8_C(231), UINT8_C(230), UINT8_C(229), UINT8_C(228), UINT8_C(227), UINT8_C(226), UINT8_C(225), UINT8_C(224) },
+          { UINT8_C(223), UINT8_C(222), UINT8_C(221), UINT8_C(220), UINT8_C(219), UINT8_C(218), UINT8_C(217), UINT8_C(216),
+            UINT8_C(215), UINT8_C(214), UINT8_C(213), UINT8_C(212), UINT8_C(211), UINT8_C(210), UINT8_C(209), UINT8_C(208) } },
+      { UINT8_C(  0), UINT8_C( 16), UINT8_C( 47), UINT8_C( 48), UINT8_C( 63), UINT8_C(128), UINT8_C(143),    UINT8_MAX },
+      {    UINT8_MAX, UINT8_C(239), UINT8_C(208), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -843,6 +859,17 @@ test_simde_vqtbl4_u8 (SIMDE_MUNIT_TEST_ARGS) {
             UINT8_C(105), UINT8_C(119), UINT8_C( 84), UINT8_C( 81), UINT8_C(245), UINT8_C(223), UINT8_C(118), UINT8_C(181) } },
       { UINT8_C( 38), UINT8_C( 54), UINT8_C( 63), UINT8_C(215), UINT8_C(  4), UINT8_C( 42), UINT8_C( 35), UINT8_C(239) },
       { UINT8_C(235), UINT8_C( 93), UINT8_C(181), UINT8_C(  0), UINT8_C(138), UINT8_C( 37), UINT8_C( 74), UINT8_C(  0) } },
+    {
+        { {    UINT8_MAX, UINT8_C(254), UINT8_C(253), UINT8_C(252), UINT8_C(251), UINT8_C(250), UINT8_C(249), UINT8_C(248),
+            UINT8_C(247), UINT8_C(246), UINT8_C(245), UINT8_C(244), UINT8_C(243), UINT8_C(242), UINT8_C(241), UINT8_C(240) },
+          { UINT8_C(239), UINT8_C(238), UINT8_C(237), UINT8_C(236), UINT8_C(235), UINT8_C(234), UINT8_C(233), UINT8_C(232),
+            UINT8_C(231), UINT8_C(230), UINT8_C(229), UINT8_C(228), UINT8_C(227), UINT8_C(226), UINT8_C(225), UINT8_C(224) },
+          { UINT8_C(223), UINT8_C(222), UINT8_C(221), UINT8_C(220), UINT8_C(219), UINT8_C(218), UINT8_C(217), UINT8_C(216),
+            UINT8_C(215), UINT8_C(214), UINT8_C(213), UINT8_C(212), UINT8_C(211), UINT8_C(210), UINT8_C(209), UINT8_C(208) },
+          { UINT8_C(207), UINT8_C(206), UINT8_C(205), UINT8_C(204), UINT8_C(203), UINT8_C(202), UINT8_C(201), UINT8_C(200),
+            UINT8_C(199), UINT8_C(198), UINT8_C(197), UINT8_C(196), UINT8_C(195), UINT8_C(194), UINT8_C(193), UINT8_C(192) } },
+      { UINT8_C(  0), UINT8_C( 16), UINT8_C( 63), UINT8_C( 64), UINT8_C( 79), UINT8_C(128), UINT8_C(143),    UINT8_MAX },
+      {    UINT8_MAX, UINT8_C(239), UINT8_C(192), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -1269,6 +1296,15 @@ test_simde_vqtbl2q_u8 (SIMDE_MUNIT_TEST_ARGS) {
         UINT8_C( 13), UINT8_C( 13), UINT8_C( 13), UINT8_C(  0), UINT8_C( 31), UINT8_C( 27), UINT8_C( 25), UINT8_C( 24) },
       { UINT8_C(198), UINT8_C(238), UINT8_C(179), UINT8_C(184), UINT8_C(155), UINT8_C(  0), UINT8_C(155), UINT8_C(  0),
         UINT8_C(114), UINT8_C(114), UINT8_C(114), UINT8_C( 43), UINT8_C( 56), UINT8_C(106), UINT8_C(198), UINT8_C(157) } },
+    {
+        { {    UINT8_MAX, UINT8_C(254), UINT8_C(253), UINT8_C(252), UINT8_C(251), UINT8_C(250), UINT8_C(249), UINT8_C(248),
+            UINT8_C(247), UINT8_C(246), UINT8_C(245), UINT8_C(244), UINT8_C(243), UINT8_C(242), UINT8_C(241), UINT8_C(240) },
+          { UINT8_C(239), UINT8_C(238), UINT8_C(237), UINT8_C(236), UINT8_C(235), UINT8_C(234), UINT8_C(233), UINT8_C(232),
+            UINT8_C(231), UINT8_C(230), UINT8_C(229), UINT8_C(228), UINT8_C(227), UINT8_C(226), UINT8_C(225), UINT8_C(224) } },
+      { UINT8_C(  0), UINT8_C( 15), UINT8_C( 16), UINT8_C( 31), UINT8_C( 32), UINT8_C( 33), UINT8_C( 47), UINT8_C( 63),
+        UINT8_C( 64), UINT8_C(127), UINT8_C(128), UINT8_C(129), UINT8_C(143), UINT8_C(192), UINT8_C(240),    UINT8_MAX },
+      {    UINT8_MAX, UINT8_C(240), UINT8_C(239), UINT8_C(224), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -1539,6 +1575,17 @@ test_simde_vqtbl3q_u8 (SIMDE_MUNIT_TEST_ARGS) {
         UINT8_C(  2), UINT8_C(177), UINT8_C( 35), UINT8_C(238), UINT8_C( 21), UINT8_C( 47), UINT8_C( 31), UINT8_C( 33) },
       { UINT8_C(111), UINT8_C(149), UINT8_C( 69), UINT8_C(132), UINT8_C( 80), UINT8_C(179), UINT8_C(179), UINT8_C(  2),
         UINT8_C(150), UINT8_C(  0), UINT8_C(148), UINT8_C(  0), UINT8_C(170), UINT8_C( 73), UINT8_C( 49), UINT8_C( 66) } },
+    {
+        { {    UINT8_MAX, UINT8_C(254), UINT8_C(253), UINT8_C(252), UINT8_C(251), UINT8_C(250), UINT8_C(249), UINT8_C(248),
+            UINT8_C(247), UINT8_C(246), UINT8_C(245), UINT8_C(244), UINT8_C(243), UINT8_C(242), UINT8_C(241), UINT8_C(240) },
+          { UINT8_C(239), UINT8_C(238), UINT8_C(237), UINT8_C(236), UINT8_C(235), UINT8_C(234), UINT8_C(233), UINT8_C(232),
+            UINT8_C(231), UINT8_C(230), UINT8_C(229), UINT8_C(228), UINT8_C(227), UINT8_C(226), UINT8_C(225), UINT8_C(224) },
+          { UINT8_C(223), UINT8_C(222), UINT8_C(221), UINT8_C(220), UINT8_C(219), UINT8_C(218), UINT8_C(217), UINT8_C(216),
+            UINT8_C(215), UINT8_C(214), UINT8_C(213), UINT8_C(212), UINT8_C(211), UINT8_C(210), UINT8_C(209), UINT8_C(208) } },
+      { UINT8_C(  0), UINT8_C( 15), UINT8_C( 16), UINT8_C( 47), UINT8_C( 48), UINT8_C( 49), UINT8_C( 63), UINT8_C( 63),
+        UINT8_C( 64), UINT8_C(127), UINT8_C(128), UINT8_C(129), UINT8_C(143), UINT8_C(192), UINT8_C(240),    UINT8_MAX },
+      {    UINT8_MAX, UINT8_C(240), UINT8_C(239), UINT8_C(208), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -1843,6 +1890,19 @@ test_simde_vqtbl4q_u8 (SIMDE_MUNIT_TEST_ARGS) {
         UINT8_C( 53), UINT8_C( 28), UINT8_C( 42), UINT8_C( 25), UINT8_C( 21), UINT8_C(156), UINT8_C(  6), UINT8_C( 32) },
       { UINT8_C(129), UINT8_C(  0), UINT8_C(190), UINT8_C(230), UINT8_C(182), UINT8_C( 89), UINT8_C(  0), UINT8_C(216),
         UINT8_C(191), UINT8_C( 54), UINT8_C(191), UINT8_C(191), UINT8_C(175), UINT8_C(  0), UINT8_C( 79), UINT8_C(252) } },
+    {
+        { {    UINT8_MAX, UINT8_C(254), UINT8_C(253), UINT8_C(252), UINT8_C(251), UINT8_C(250), UINT8_C(249), UINT8_C(248),
+            UINT8_C(247), UINT8_C(246), UINT8_C(245), UINT8_C(244), UINT8_C(243), UINT8_C(242), UINT8_C(241), UINT8_C(240) },
+          { UINT8_C(239), UINT8_C(238), UINT8_C(237), UINT8_C(236), UINT8_C(235), UINT8_C(234), UINT8_C(233), UINT8_C(232),
+            UINT8_C(231), UINT8_C(230), UINT8_C(229), UINT8_C(228), UINT8_C(227), UINT8_C(226), UINT8_C(225), UINT8_C(224) },
+          { UINT8_C(223), UINT8_C(222), UINT8_C(221), UINT8_C(220), UINT8_C(219), UINT8_C(218), UINT8_C(217), UINT8_C(216),
+            UINT8_C(215), UINT8_C(214), UINT8_C(213), UINT8_C(212), UINT8_C(211), UINT8_C(210), UINT8_C(209), UINT8_C(208) },
+          { UINT8_C(207), UINT8_C(206), UINT8_C(205), UINT8_C(204), UINT8_C(203), UINT8_C(202), UINT8_C(201), UINT8_C(200),
+            UINT8_C(199), UINT8_C(198), UINT8_C(197), UINT8_C(196), UINT8_C(195), UINT8_C(194), UINT8_C(193), UINT8_C(192) } },
+      { UINT8_C(  0), UINT8_C( 15), UINT8_C( 16), UINT8_C( 63), UINT8_C( 64), UINT8_C( 65), UINT8_C( 79), UINT8_C( 63),
+        UINT8_C( 64), UINT8_C(127), UINT8_C(128), UINT8_C(129), UINT8_C(143), UINT8_C(192), UINT8_C(240),    UINT8_MAX },
+      {    UINT8_MAX, UINT8_C(240), UINT8_C(239), UINT8_C(192), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(192),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -91,6 +91,18 @@ test_simde_vsha1cq_u32(SIMDE_MUNIT_TEST_ARGS) {
          UINT32_C(   613209907),
       {  UINT32_C(  3127548287),  UINT32_C(  2904645084),  UINT32_C(  1336196063),  UINT32_C(  2606398120) },
       {  UINT32_C(  2349160910),  UINT32_C(    49395543),  UINT32_C(  4044737366),  UINT32_C(   946257302) } },
+    { {  UINT32_C(           0),  UINT32_C(           0),  UINT32_C(           0),  UINT32_C(           0) },
+                     UINT32_MAX,
+      {  UINT32_C(           0),  UINT32_C(           0),  UINT32_C(           0),  UINT32_C(           0) },
+      {  UINT32_C(  4294967294),              UINT32_MAX,              UINT32_MAX,              UINT32_MAX } },
+    { {              UINT32_MAX,              UINT32_MAX,              UINT32_MAX,              UINT32_MAX },
+         UINT32_C(           0),
+      {              UINT32_MAX,              UINT32_MAX,              UINT32_MAX,              UINT32_MAX },
+      {  UINT32_C(  2147414940),  UINT32_C(  4294965148),  UINT32_C(  1073741807),  UINT32_C(  2147483647) } },
+    { {  UINT32_C(  2147483648),  UINT32_C(  2147483647),  UINT32_C(  2147483648),  UINT32_C(  2147483647) },
+         UINT32_C(  1518500250),
+      {  UINT32_C(  1518500248),  UINT32_C(  1518500249),  UINT32_C(  1518500250),  UINT32_C(  2147483648) },
+      {  UINT32_C(  1010345876),  UINT32_C(  2845426742),  UINT32_C(  3200792699),  UINT32_C(  2906733776) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -162,6 +174,18 @@ test_simde_vsha1mq_u32(SIMDE_MUNIT_TEST_ARGS) {
          UINT32_C(  1973177457),
       {  UINT32_C(  1161827945),  UINT32_C(  1074963440),  UINT32_C(  2392014423),  UINT32_C(  3224863588) },
       {  UINT32_C(  3163174908),  UINT32_C(  4210326126),  UINT32_C(   616982086),  UINT32_C(  1690357874) } },
+    { {  UINT32_C(           0),  UINT32_C(           0),  UINT32_C(           0),  UINT32_C(           0) },
+                     UINT32_MAX,
+      {  UINT32_C(           0),  UINT32_C(           0),  UINT32_C(           0),  UINT32_C(           0) },
+      {  UINT32_C(  4294967294),              UINT32_MAX,              UINT32_MAX,              UINT32_MAX } },
+    { {              UINT32_MAX,              UINT32_MAX,              UINT32_MAX,              UINT32_MAX },
+         UINT32_C(           0),
+      {              UINT32_MAX,              UINT32_MAX,              UINT32_MAX,              UINT32_MAX },
+      {  UINT32_C(  4294898588),  UINT32_C(  4294965148),  UINT32_C(  1073741807),  UINT32_C(  2147483647) } },
+    { {  UINT32_C(  2147483648),  UINT32_C(  2147483647),  UINT32_C(  2147483648),  UINT32_C(  2147483647) },
+         UINT32_C(  2400959709),
+      {  UINT32_C(  2400959707),  UINT32_C(  2400959708),  UINT32_C(  2400959709),  UINT32_C(  2147483648) },
+      {  UINT32_C(  2621891084),  UINT32_C(  1857155182),  UINT32_C(  2508373363),  UINT32_C(  3884834417) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -233,6 +257,18 @@ test_simde_vsha1pq_u32(SIMDE_MUNIT_TEST_ARGS) {
          UINT32_C(   645397295),
       {  UINT32_C(  1101345173),  UINT32_C(   596753320),  UINT32_C(  1078414121),  UINT32_C(  2839874921) },
       {  UINT32_C(  1499728580),  UINT32_C(   678570888),  UINT32_C(  3134853944),  UINT32_C(  1118079412) } },
+    { {  UINT32_C(           0),  UINT32_C(           0),  UINT32_C(           0),  UINT32_C(           0) },
+                     UINT32_MAX,
+      {  UINT32_C(           0),  UINT32_C(           0),  UINT32_C(           0),  UINT32_C(           0) },
+      {  UINT32_C(  4294967263),  UINT32_C(  4294967294),              UINT32_MAX,              UINT32_MAX } },
+    { {              UINT32_MAX,              UINT32_MAX,              UINT32_MAX,              UINT32_MAX },
+         UINT32_C(           0),
+      {              UINT32_MAX,              UINT32_MAX,              UINT32_MAX,              UINT32_MAX },
+      {  UINT32_C(  2147414809),  UINT32_C(  4294965146),  UINT32_C(  1073741807),  UINT32_C(  2147483647) } },
+    { {  UINT32_C(  2147483648),  UINT32_C(  2147483647),  UINT32_C(  2147483648),  UINT32_C(  2147483647) },
+         UINT32_C(  1859775394),
+      {  UINT32_C(  1859775392),  UINT32_C(  1859775393),  UINT32_C(  1859775394),  UINT32_C(  2147483648) },
+      {  UINT32_C(   173167652),  UINT32_C(  1002492319),  UINT32_C(  2706716026),  UINT32_C(  2540500436) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -304,6 +340,14 @@ test_simde_vsha1su0q_u32(SIMDE_MUNIT_TEST_ARGS) {
       {  UINT32_C(  3758871113),  UINT32_C(   157466866),  UINT32_C(  2444468263),  UINT32_C(  1329114005) },
       {  UINT32_C(  3595434628),  UINT32_C(  3885991330),  UINT32_C(  3685516802),  UINT32_C(  2439860337) },
       {  UINT32_C(  2469830944),  UINT32_C(  3327072080),  UINT32_C(  1810683510),  UINT32_C(  3619398141) } },
+    { {              UINT32_MAX,              UINT32_MAX,              UINT32_MAX,              UINT32_MAX },
+      {              UINT32_MAX,              UINT32_MAX,              UINT32_MAX,              UINT32_MAX },
+      {              UINT32_MAX,              UINT32_MAX,              UINT32_MAX,              UINT32_MAX },
+      {              UINT32_MAX,              UINT32_MAX,              UINT32_MAX,              UINT32_MAX } },
+    { {  UINT32_C(  2147483648),  UINT32_C(  2147483647),  UINT32_C(           1),  UINT32_C(           0) },
+      {  UINT32_C(           0),  UINT32_C(           1),  UINT32_C(  2147483647),  UINT32_C(  2147483648) },
+      {  UINT32_C(  2147483648),  UINT32_C(  2147483647),  UINT32_C(           1),  UINT32_C(           0) },
+      {  UINT32_C(           1),  UINT32_C(           0),  UINT32_C(           0),  UINT32_C(           1) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -366,6 +410,12 @@ test_simde_vsha1su1q_u32(SIMDE_MUNIT_TEST_ARGS) {
     { {  UINT32_C(  2729808259),  UINT32_C(  2433737520),  UINT32_C(   557037430),  UINT32_C(   565759223) },
       {  UINT32_C(  3589950301),  UINT32_C(  1454470668),  UINT32_C(   595324087),  UINT32_C(  2277533768) },
       {  UINT32_C(  3892956959),  UINT32_C(  1692933903),  UINT32_C(  1307033213),  UINT32_C(  2472675281) } },
+    { {              UINT32_MAX,              UINT32_MAX,              UINT32_MAX,              UINT32_MAX },
+      {              UINT32_MAX,              UINT32_MAX,              UINT32_MAX,              UINT32_MAX },
+      {  UINT32_C(           0),  UINT32_C(           0),  UINT32_C(           0),              UINT32_MAX } },
+    { {  UINT32_C(  2147483648),  UINT32_C(  2147483647),  UINT32_C(           1),  UINT32_C(           0) },
+      {  UINT32_C(           0),  UINT32_C(           1),  UINT32_C(  2147483647),  UINT32_C(  2147483648) },
+      {  UINT32_C(           3),  UINT32_C(           0),  UINT32_C(           3),  UINT32_C(           6) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -44,6 +44,14 @@ test_simde_vsha256hq_u32(SIMDE_MUNIT_TEST_ARGS) {
       {  UINT32_C(  3036918958),  UINT32_C(   300927086),  UINT32_C(   777455403),  UINT32_C(  2933385981) },
       {  UINT32_C(  2901199133),  UINT32_C(  3041655483),  UINT32_C(   421254258),  UINT32_C(  2699057251) },
       {  UINT32_C(   765546576),  UINT32_C(  2112225606),  UINT32_C(  4088877414),  UINT32_C(  3107927617) } },
+    { {              UINT32_MAX,              UINT32_MAX,              UINT32_MAX,              UINT32_MAX },
+      {              UINT32_MAX,              UINT32_MAX,              UINT32_MAX,              UINT32_MAX },
+      {              UINT32_MAX,              UINT32_MAX,              UINT32_MAX,              UINT32_MAX },
+      {  UINT32_C(  1076686550),  UINT32_C(  1795052659),  UINT32_C(  2941774329),  UINT32_C(  4294967290) } },
+    { {  UINT32_C(  2147483648),  UINT32_C(  2147483647),  UINT32_C(           1),  UINT32_C(           0) },
+      {  UINT32_C(           0),  UINT32_C(           1),  UINT32_C(  2147483647),  UINT32_C(  2147483648) },
+      {  UINT32_C(  2147483648),  UINT32_C(  2147483647),  UINT32_C(           1),  UINT32_C(           0) },
+      {  UINT32_C(  2809951524),  UINT32_C(  1764304686),  UINT32_C(  3321889757),  UINT32_C(  2684617216) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -115,6 +123,14 @@ test_simde_vsha256h2q_u32(SIMDE_MUNIT_TEST_ARGS) {
       {  UINT32_C(  2298591707),  UINT32_C(  1390264363),  UINT32_C(   867279222),  UINT32_C(   765459070) },
       {  UINT32_C(  1335741655),  UINT32_C(   895855911),  UINT32_C(  1571893265),  UINT32_C(  3787382854) },
       {  UINT32_C(  2426515505),  UINT32_C(  3558082144),  UINT32_C(   890562784),  UINT32_C(   387884112) } },
+    { {              UINT32_MAX,              UINT32_MAX,              UINT32_MAX,              UINT32_MAX },
+      {              UINT32_MAX,              UINT32_MAX,              UINT32_MAX,              UINT32_MAX },
+      {              UINT32_MAX,              UINT32_MAX,              UINT32_MAX,              UINT32_MAX },
+      {  UINT32_C(  3484934549),  UINT32_C(  4013878779),  UINT32_C(  4018142715),  UINT32_C(  4294967291) } },
+    { {  UINT32_C(  2147483648),  UINT32_C(  2147483647),  UINT32_C(           1),  UINT32_C(           0) },
+      {  UINT32_C(           0),  UINT32_C(           1),  UINT32_C(  2147483647),  UINT32_C(  2147483648) },
+      {  UINT32_C(  2147483648),  UINT32_C(  2147483647),  UINT32_C(           1),  UINT32_C(           0) },
+      {  UINT32_C(  3416249434),  UINT32_C(  1069104463),  UINT32_C(  2182619709),  UINT32_C(    34603073) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -177,6 +193,12 @@ test_simde_vsha256su0q_u32(SIMDE_MUNIT_TEST_ARGS) {
     { {  UINT32_C(  1502615895),  UINT32_C(  4189183975),  UINT32_C(  3189336951),  UINT32_C(  3309092636) },
       {  UINT32_C(  4271059759),  UINT32_C(  3359173109),  UINT32_C(  1861595397),  UINT32_C(  1535281278) },
       {  UINT32_C(    13418374),  UINT32_C(  2618609701),  UINT32_C(  3439610697),  UINT32_C(  1377926851) } },
+    { {              UINT32_MAX,              UINT32_MAX,              UINT32_MAX,              UINT32_MAX },
+      {              UINT32_MAX,              UINT32_MAX,              UINT32_MAX,              UINT32_MAX },
+      {  UINT32_C(   536870910),  UINT32_C(   536870910),  UINT32_C(   536870910),  UINT32_C(   536870910) } },
+    { {  UINT32_C(  2147483648),  UINT32_C(  2147483647),  UINT32_C(           1),  UINT32_C(           0) },
+      {  UINT32_C(           0),  UINT32_C(           1),  UINT32_C(  2147483647),  UINT32_C(  2147483648) },
+      {  UINT32_C(  2399133695),  UINT32_C(  2181054463),  UINT32_C(           1),  UINT32_C(           0) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -245,6 +267,14 @@ test_simde_vsha256su1q_u32(SIMDE_MUNIT_TEST_ARGS) {
       {  UINT32_C(   996497672),  UINT32_C(  2650982513),  UINT32_C(  2068231911),  UINT32_C(  2169901460) },
       {  UINT32_C(  1162322282),  UINT32_C(  3303878071),  UINT32_C(  2242394192),  UINT32_C(  1269307114) },
       {  UINT32_C(   422192494),  UINT32_C(  1639490948),  UINT32_C(  4282503987),  UINT32_C(  1784261000) } },
+    { {              UINT32_MAX,              UINT32_MAX,              UINT32_MAX,              UINT32_MAX },
+      {              UINT32_MAX,              UINT32_MAX,              UINT32_MAX,              UINT32_MAX },
+      {              UINT32_MAX,              UINT32_MAX,              UINT32_MAX,              UINT32_MAX },
+      {  UINT32_C(     4194301),  UINT32_C(     4194301),  UINT32_C(       77797),  UINT32_C(       77797) } },
+    { {  UINT32_C(  2147483648),  UINT32_C(  2147483647),  UINT32_C(           1),  UINT32_C(           0) },
+      {  UINT32_C(           0),  UINT32_C(           1),  UINT32_C(  2147483647),  UINT32_C(  2147483648) },
+      {  UINT32_C(  2147483648),  UINT32_C(  2147483647),  UINT32_C(           1),  UINT32_C(           0) },
+      {  UINT32_C(  2147524609),  UINT32_C(  4294967294),  UINT32_C(  3290492969),  UINT32_C(  2151636991) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
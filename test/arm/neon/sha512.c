@@ -177,6 +177,12 @@ test_simde_vsha512su0q_u64(SIMDE_MUNIT_TEST_ARGS) {
     { {  UINT64_C(14334734463220060160),  UINT64_C( 8421390715225748480) },
       {  UINT64_C( 4609425874196063744),  UINT64_C(17216900159273388032) },
       {  UINT64_C(  135454660325448924),  UINT64_C(10708062898192734890) } },
+    { {                      UINT64_MAX,                      UINT64_MAX },
+      {                      UINT64_MAX,                      UINT64_MAX },
+      {  UINT64_C(  144115188075855870),  UINT64_C(  144115188075855870) } },
+    { {  UINT64_C( 9223372036854775808),  UINT64_C(                   1) },
+      {  UINT64_C( 9223372036854775807),  UINT64_C( 9223372036854775809) },
+      {  UINT64_C(   72057594037927936),  UINT64_C( 4647714815446351872) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -245,6 +251,14 @@ test_simde_vsha512su1q_u64(SIMDE_MUNIT_TEST_ARGS) {
       {  UINT64_C(17155745380901191680),  UINT64_C(14122100795215757312) },
       {  UINT64_C(14194165624435322880),  UINT64_C( 5943118735598111744) },
       {  UINT64_C(18057304952478182546),  UINT64_C(12805986210024573861) } },
+    { {                      UINT64_MAX,                      UINT64_MAX },
+      {                      UINT64_MAX,                      UINT64_MAX },
+      {                      UINT64_MAX,                      UINT64_MAX },
+      {  UINT64_C(  288230376151711741),  UINT64_C(  288230376151711741) } },
+    { {  UINT64_C( 9223372036854775808),  UINT64_C(                   1) },
+      {  UINT64_C( 9223372036854775807),  UINT64_C( 9223372036854775809) },
+      {  UINT64_C( 9223372036854775808),  UINT64_C(                   1) },
+      {  UINT64_C(  144097595889811451),  UINT64_C(  144167964633989134) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -1390,6 +1390,66 @@ test_simde_vst3_u8 (SIMDE_MUNIT_TEST_ARGS) {
       UINT8_C(141),
       }
     },
+    { { UINT8_C(  0), UINT8_C(  3), UINT8_C(  6), UINT8_C(  9), UINT8_C( 12), UINT8_C( 15), UINT8_C( 18), UINT8_C( 21) },
+      { UINT8_C(  1), UINT8_C(  4), UINT8_C(  7), UINT8_C( 10), UINT8_C( 13), UINT8_C( 16), UINT8_C( 19), UINT8_C( 22) },
+      { UINT8_C(  2), UINT8_C(  5), UINT8_C(  8), UINT8_C( 11), UINT8_C( 14), UINT8_C( 17), UINT8_C( 20), UINT8_C( 23) },
+      {
+      UINT8_C(  0),
+      UINT8_C(  1),
+      UINT8_C(  2),
+      UINT8_C(  3),
+      UINT8_C(  4),
+      UINT8_C(  5),
+      UINT8_C(  6),
+      UINT8_C(  7),
+      UINT8_C(  8),
+      UINT8_C(  9),
+      UINT8_C( 10),
+      UINT8_C( 11),
+      UINT8_C( 12),
+      UINT8_C( 13),
+      UINT8_C( 14),
+      UINT8_C( 15),
+      UINT8_C( 16),
+      UINT8_C( 17),
+      UINT8_C( 18),
+      UINT8_C( 19),
+      UINT8_C( 20),
+      UINT8_C( 21),
+      UINT8_C( 22),
+      UINT8_C( 23),
+      }
+    },
+    { { UINT8_C(255), UINT8_C(252), UINT8_C(249), UINT8_C(246), UINT8_C(243), UINT8_C(240), UINT8_C(237), UINT8_C(234) },
+      { UINT8_C(254), UINT8_C(251), UINT8_C(248), UINT8_C(245), UINT8_C(242), UINT8_C(239), UINT8_C(236), UINT8_C(233) },
+      { UINT8_C(253), UINT8_C(250), UINT8_C(247), UINT8_C(244), UINT8_C(241), UINT8_C(238), UINT8_C(235), UINT8_C(232) },
+      {
+      UINT8_C(255),
+      UINT8_C(254),
+      UINT8_C(253),
+      UINT8_C(252),
+      UINT8_C(251),
+      UINT8_C(250),
+      UINT8_C(249),
+      UINT8_C(248),
+      UINT8_C(247),
+      UINT8_C(246),
+      UINT8_C(245),
+      UINT8_C(244),
+      UINT8_C(243),
+      UINT8_C(242),
+      UINT8_C(241),
+      UINT8_C(240),
+      UINT8_C(239),
+      UINT8_C(238),
+      UINT8_C(237),
+      UINT8_C(236),
+      UINT8_C(235),
+      UINT8_C(234),
+      UINT8_C(233),
+      UINT8_C(232),
+      }
+    },
 
   };
 
@@ -1585,6 +1645,42 @@ test_simde_vst3_u16 (SIMDE_MUNIT_TEST_ARGS) {
       UINT16_C( 9725),
       }
     },
+    { { UINT16_C(    0), UINT16_C(  771), UINT16_C( 1542), UINT16_C( 2313) },
+      { UINT16_C(  257), UINT16_C( 1028), UINT16_C( 1799), UINT16_C( 2570) },
+      { UINT16_C(  514), UINT16_C( 1285), UINT16_C( 2056), UINT16_C( 2827) },
+      {
+      UINT16_C(    0),
+      UINT16_C(  257),
+      UINT16_C(  514),
+      UINT16_C(  771),
+      UINT16_C( 1028),
+      UINT16_C( 1285),
+      UINT16_C( 1542),
+      UINT16_C( 1799),
+      UINT16_C( 2056),
+      UINT16_C( 2313),
+      UINT16_C( 2570),
+      UINT16_C( 2827),
+      }
+    },
+    { { UINT16_C(65535), UINT16_C(64764), UINT16_C(63993), UINT16_C(63222) },
+      { UINT16_C(65278), UINT16_C(64507), UINT16_C(63736), UINT16_C(62965) },
+      { UINT16_C(65021), UINT16_C(64250), UINT16_C(63479), UINT16_C(62708) },
+      {
+      UINT16_C(65535),
+      UINT16_C(65278),
+      UINT16_C(65021),
+      UINT16_C(64764),
+      UINT16_C(64507),
+      UINT16_C(64250),
+      UINT16_C(63993),
+      UINT16_C(63736),
+      UINT16_C(63479),
+      UINT16_C(63222),
+      UINT16_C(62965),
+      UINT16_C(62708),
+      }
+    },
 
   };
 
@@ -1732,6 +1828,30 @@ test_simde_vst3_u32 (SIMDE_MUNIT_TEST_ARGS) {
       UINT32_C(2503624567),
       }
     },
+    { { UINT32_C(         0), UINT32_C(  50529027) },
+      { UINT32_C(  16843009), UINT32_C(  67372036) },
+      { UINT32_C(  33686018), UINT32_C(  84215045) },
+      {
+      UINT32_C(         0),
+      UINT32_C(  16843009),
+      UINT32_C(  33686018),
+      UINT32_C(  50529027),
+      UINT32_C(  67372036),
+      UINT32_C(  84215045),
+      }
+    },
+    { { UINT32_C(4294967295), UINT32_C(4244438268) },
+      { UINT32_C(4278124286), UINT32_C(4227595259) },
+      { UINT32_C(4261281277), UINT32_C(4210752250) },
+      {
+      UINT32_C(4294967295),
+      UINT32_C(4278124286),
+      UINT32_C(4261281277),
+      UINT32_C(4244438268),
+      UINT32_C(4227595259),
+      UINT32_C(4210752250),
+      }
+    },
 
   };
 
@@ -3992,6 +4112,120 @@ test_simde_vst3q_u8 (SIMDE_MUNIT_TEST_ARGS) {
       UINT8_C(124),
       }
     },
+    { { UINT8_C(  0), UINT8_C(  3), UINT8_C(  6), UINT8_C(  9), UINT8_C( 12), UINT8_C( 15), UINT8_C( 18), UINT8_C( 21),
+        UINT8_C( 24), UINT8_C( 27), UINT8_C( 30), UINT8_C( 33), UINT8_C( 36), UINT8_C( 39), UINT8_C( 42), UINT8_C( 45) },
+      { UINT8_C(  1), UINT8_C(  4), UINT8_C(  7), UINT8_C( 10), UINT8_C( 13), UINT8_C( 16), UINT8_C( 19), UINT8_C( 22),
+        UINT8_C( 25), UINT8_C( 28), UINT8_C( 31), UINT8_C( 34), UINT8_C( 37), UINT8_C( 40), UINT8_C( 43), UINT8_C( 46) },
+      { UINT8_C(  2), UINT8_C(  5), UINT8_C(  8), UINT8_C( 11), UINT8_C( 14), UINT8_C( 17), UINT8_C( 20), UINT8_C( 23),
+        UINT8_C( 26), UINT8_C( 29), UINT8_C( 32), UINT8_C( 35), UINT8_C( 38), UINT8_C( 41), UINT8_C( 44), UINT8_C( 47) },
+      {
+      UINT8_C(  0),
+      UINT8_C(  1),
+      UINT8_C(  2),
+      UINT8_C(  3),
+      UINT8_C(  4),
+      UINT8_C(  5),
+      UINT8_C(  6),
+      UINT8_C(  7),
+      UINT8_C(  8),
+      UINT8_C(  9),
+      UINT8_C( 10),
+      UINT8_C( 11),
+      UINT8_C( 12),
+      UINT8_C( 13),
+      UINT8_C( 14),
+      UINT8_C( 15),
+      UINT8_C( 16),
+      UINT8_C( 17),
+      UINT8_C( 18),
+      UINT8_C( 19),
+      UINT8_C( 20),
+      UINT8_C( 21),
+      UINT8_C( 22),
+      UINT8_C( 23),
+      UINT8_C( 24),
+      UINT8_C( 25),
+      UINT8_C( 26),
+      UINT8_C( 27),
+      UINT8_C( 28),
+      UINT8_C( 29),
+      UINT8_C( 30),
+      UINT8_C( 31),
+      UINT8_C( 32),
+      UINT8_C( 33),
+      UINT8_C( 34),
+      UINT8_C( 35),
+      UINT8_C( 36),
+      UINT8_C( 37),
+      UINT8_C( 38),
+      UINT8_C( 39),
+      UINT8_C( 40),
+      UINT8_C( 41),
+      UINT8_C( 42),
+      UINT8_C( 43),
+      UINT8_C( 44),
+      UINT8_C( 45),
+      UINT8_C( 46),
+      UINT8_C( 47),
+      }
+    },
+    { { UINT8_C(255), UINT8_C(252), UINT8_C(249), UINT8_C(246), UINT8_C(243), UINT8_C(240), UINT8_C(237), UINT8_C(234),
+        UINT8_C(231), UINT8_C(228), UINT8_C(225), UINT8_C(222), UINT8_C(219), UINT8_C(216), UINT8_C(213), UINT8_C(210) },
+      { UINT8_C(254), UINT8_C(251), UINT8_C(248), UINT8_C(245), UINT8_C(242), UINT8_C(239), UINT8_C(236), UINT8_C(233),
+        UINT8_C(230), UINT8_C(227), UINT8_C(224), UINT8_C(221), UINT8_C(218), UINT8_C(215), UINT8_C(212), UINT8_C(209) },
+      { UINT8_C(253), UINT8_C(250), UINT8_C(247), UINT8_C(244), UINT8_C(241), UINT8_C(238), UINT8_C(235), UINT8_C(232),
+        UINT8_C(229), UINT8_C(226), UINT8_C(223), UINT8_C(220), UINT8_C(217), UINT8_C(214), UINT8_C(211), UINT8_C(208) },
+      {
+      UINT8_C(255),
+      UINT8_C(254),
+      UINT8_C(253),
+      UINT8_C(252),
+      UINT8_C(251),
+      UINT8_C(250),
+      UINT8_C(249),
+      UINT8_C(248),
+      UINT8_C(247),
+      UINT8_C(246),
+      UINT8_C(245),
+      UINT8_C(244),
+      UINT8_C(243),
+      UINT8_C(242),
+      UINT8_C(241),
+      UINT8_C(240),
+      UINT8_C(239),
+      UINT8_C(238),
+      UINT8_C(237),
+      UINT8_C(236),
+      UINT8_C(235),
+      UINT8_C(234),
+      UINT8_C(233),
+      UINT8_C(232),
+      UINT8_C(231),
+      UINT8_C(230),
+      UINT8_C(229),
+      UINT8_C(228),
+      UINT8_C(227),
+      UINT8_C(226),
+      UINT8_C(225),
+      UINT8_C(224),
+      UINT8_C(223),
+      UINT8_C(222),
+      UINT8_C(221),
+      UINT8_C(220),
+      UINT8_C(219),
+      UINT8_C(218),
+      UINT8_C(217),
+      UINT8_C(216),
+      UINT8_C(215),
+      UINT8_C(214),
+      UINT8_C(213),
+      UINT8_C(212),
+      UINT8_C(211),
+      UINT8_C(210),
+      UINT8_C(209),
+      UINT8_C(208),
+      }
+    },
 
   };
 
@@ -4283,6 +4517,66 @@ test_simde_vst3q_u16 (SIMDE_MUNIT_TEST_ARGS) {
       UINT16_C(57953),
       }
     },
+    { { UINT16_C(    0), UINT16_C(  771), UINT16_C( 1542), UINT16_C( 2313), UINT16_C( 3084), UINT16_C( 3855), UINT16_C( 4626), UINT16_C( 5397) },
+      { UINT16_C(  257), UINT16_C( 1028), UINT16_C( 1799), UINT16_C( 2570), UINT16_C( 3341), UINT16_C( 4112), UINT16_C( 4883), UINT16_C( 5654) },
+      { UINT16_C(  514), UINT16_C( 1285), UINT16_C( 2056), UINT16_C( 2827), UINT16_C( 3598), UINT16_C( 4369), UINT16_C( 5140), UINT16_C( 5911) },
+      {
+      UINT16_C(    0),
+      UINT16_C(  257),
+      UINT16_C(  514),
+      UINT16_C(  771),
+      UINT16_C( 1028),
+      UINT16_C( 1285),
+      UINT16_C( 1542),
+      UINT16_C( 1799),
+      UINT16_C( 2056),
+      UINT16_C( 2313),
+      UINT16_C( 2570),
+      UINT16_C( 2827),
+      UINT16_C( 3084),
+      UINT16_C( 3341),
+      UINT16_C( 3598),
+      UINT16_C( 3855),
+      UINT16_C( 4112),
+      UINT16_C( 4369),
+      UINT16_C( 4626),
+      UINT16_C( 4883),
+      UINT16_C( 5140),
+      UINT16_C( 5397),
+      UINT16_C( 5654),
+      UINT16_C( 5911),
+      }
+    },
+    { { UINT16_C(65535), UINT16_C(64764), UINT16_C(63993), UINT16_C(63222), UINT16_C(62451), UINT16_C(61680), UINT16_C(60909), UINT16_C(60138) },
+      { UINT16_C(65278), UINT16_C(64507), UINT16_C(63736), UINT16_C(62965), UINT16_C(62194), UINT16_C(61423), UINT16_C(60652), UINT16_C(59881) },
+      { UINT16_C(65021), UINT16_C(64250), UINT16_C(63479), UINT16_C(62708), UINT16_C(61937), UINT16_C(61166), UINT16_C(60395), UINT16_C(59624) },
+      {
+      UINT16_C(65535),
+      UINT16_C(65278),
+      UINT16_C(65021),
+      UINT16_C(64764),
+      UINT16_C(64507),
+      UINT16_C(64250),
+      UINT16_C(63993),
+      UINT16_C(63736),
+      UINT16_C(63479),
+      UINT16_C(63222),
+      UINT16_C(62965),
+      UINT16_C(62708),
+      UINT16_C(62451),
+      UINT16_C(62194),
+      UINT16_C(61937),
+      UINT16_C(61680),
+      UINT16_C(61423),
+      UINT16_C(61166),
+      UINT16_C(60909),
+      UINT16_C(60652),
+      UINT16_C(60395),
+      UINT16_C(60138),
+      UINT16_C(59881),
+      UINT16_C(59624),
+      }
+    },
 
   };
 
@@ -4479,6 +4773,42 @@ test_simde_vst3q_u32 (SIMDE_MUNIT_TEST_ARGS) {
       UINT32_C(1305021130),
       }
     },
+    { { UINT32_C(         0), UINT32_C(  50529027), UINT32_C( 101058054), UINT32_C( 151587081) },
+      { UINT32_C(  16843009), UINT32_C(  67372036), UINT32_C( 117901063), UINT32_C( 168430090) },
+      { UINT32_C(  33686018), UINT32_C(  84215045), UINT32_C( 134744072), UINT32_C( 185273099) },
+      {
+      UINT32_C(         0),
+      UINT32_C(  16843009),
+      UINT32_C(  33686018),
+      UINT32_C(  50529027),
+      UINT32_C(  67372036),
+      UINT32_C(  84215045),
+      UINT32_C( 101058054),
+      UINT32_C( 117901063),
+      UINT32_C( 134744072),
+      UINT32_C( 151587081),
+      UINT32_C( 168430090),
+      UINT32_C( 185273099),
+      }
+    },
+    { { UINT32_C(4294967295), UINT32_C(4244438268), UINT32_C(4193909241), UINT32_C(4143380214) },
+      { UINT32_C(4278124286), UINT32_C(4227595259), UINT32_C(4177066232), UINT32_C(4126537205) },
+      { UINT32_C(4261281277), UINT32_C(4210752250), UINT32_C(4160223223), UINT32_C(4109694196) },
+      {
+      UINT32_C(4294967295),
+      UINT32_C(4278124286),
+      UINT32_C(4261281277),
+      UINT32_C(4244438268),
+      UINT32_C(4227595259),
+      UINT32_C(4210752250),
+      UINT32_C(4193909241),
+      UINT32_C(4177066232),
+      UINT32_C(4160223223),
+      UINT32_C(4143380214),
+      UINT32_C(4126537205),
+      UINT32_C(4109694196),
+      }
+    },
 
   };
 
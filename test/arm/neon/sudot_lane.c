@@ -70,6 +70,20 @@ test_simde_vsudot_lane_s32 (SIMDE_MUNIT_TEST_ARGS) {
          UINT8_C(   213),  UINT8_C(   185),  UINT8_C(    56),  UINT8_C(   160) },
          INT8_C(     0),
       { -INT32_C(  1455524983),  INT32_C(  1434304931) } },
+    { {              INT32_MAX,              INT32_MIN },
+      {        INT8_MIN,        INT8_MIN,        INT8_MIN,        INT8_MIN,
+               INT8_MIN,        INT8_MIN,        INT8_MIN,        INT8_MIN },
+      {        UINT8_MAX,        UINT8_MAX,        UINT8_MAX,        UINT8_MAX,
+               UINT8_MAX,        UINT8_MAX,        UINT8_MAX,        UINT8_MAX },
+         INT8_C(     0),
+      {  INT32_C(  2147353087),  INT32_C(  2147353088) } },
+    { {  INT32_C(           0), -INT32_C(           1) },
+      {        INT8_MIN,        INT8_MAX, -INT8_C(     1),        INT8_MIN,
+         INT8_C(     1),        INT8_MIN,        INT8_MAX, -INT8_C(   127) },
+      {        UINT8_MAX,  UINT8_C(     0),        UINT8_MAX,  UINT8_C(     1),
+         UINT8_C(   128),        UINT8_MAX,  UINT8_C(   128),  UINT8_C(   127) },
+         INT8_C(     1),
+      { -INT32_C(         383), -INT32_C(       32386) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -188,6 +202,24 @@ test_simde_vsudot_laneq_s32 (SIMDE_MUNIT_TEST_ARGS) {
          UINT8_C(    90),  UINT8_C(   180),  UINT8_C(   239),  UINT8_C(   106) },
          INT8_C(     0),
       {  INT32_C(   461043101), -INT32_C(  1844953339) } },
+    { {              INT32_MAX,              INT32_MIN },
+      {        INT8_MIN,        INT8_MIN,        INT8_MIN,        INT8_MIN,
+               INT8_MIN,        INT8_MIN,        INT8_MIN,        INT8_MIN },
+      {        UINT8_MAX,        UINT8_MAX,        UINT8_MAX,        UINT8_MAX,
+               UINT8_MAX,        UINT8_MAX,        UINT8_MAX,        UINT8_MAX,
+               UINT8_MAX,        UINT8_MAX,        UINT8_MAX,        UINT8_MAX,
+               UINT8_MAX,        UINT8_MAX,        UINT8_MAX,        UINT8_MAX },
+         INT8_C(     0),
+      {  INT32_C(  2147353087),  INT32_C(  2147353088) } },
+    { {  INT32_C(           0), -INT32_C(           1) },
+      {        INT8_MIN,        INT8_MAX, -INT8_C(     1),        INT8_MIN,
+         INT8_C(     1),        INT8_MIN,        INT8_MAX, -INT8_C(   127) },
+      {        UINT8_MAX,  UINT8_C(     0),        UINT8_MAX,  UINT8_C(     1),
+         UINT8_C(   128),        UINT8_MAX,  UINT8_C(   128),  UINT8_C(   127),
+               UINT8_MAX,  UINT8_C(     0),        UINT8_MAX,  UINT8_C(     1),
+         UINT8_C(   128),        UINT8_MAX,  UINT8_C(   128),  UINT8_C(   127) },
+         INT8_C(     3),
+      { -INT32_C(         383), -INT32_C(       32386) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -322,6 +354,28 @@ test_simde_vsudotq_laneq_s32 (SIMDE_MUNIT_TEST_ARGS) {
          UINT8_C(   144),  UINT8_C(    37),  UINT8_C(   176),  UINT8_C(   106) },
          INT8_C(     1),
       { -INT32_C(   122905321), -INT32_C(  1420675746),  INT32_C(  1582312093),  INT32_C(  1983198831) } },
+    { {              INT32_MAX,              INT32_MIN, -INT32_C(           1),  INT32_C(           0) },
+      {        INT8_MIN,        INT8_MIN,        INT8_MIN,        INT8_MIN,
+               INT8_MIN,        INT8_MIN,        INT8_MIN,        INT8_MIN,
+               INT8_MIN,        INT8_MIN,        INT8_MIN,        INT8_MIN,
+               INT8_MIN,        INT8_MIN,        INT8_MIN,        INT8_MIN },
+      {        UINT8_MAX,        UINT8_MAX,        UINT8_MAX,        UINT8_MAX,
+               UINT8_MAX,        UINT8_MAX,        UINT8_MAX,        UINT8_MAX,
+               UINT8_MAX,        UINT8_MAX,        UINT8_MAX,        UINT8_MAX,
+               UINT8_MAX,        UINT8_MAX,        UINT8_MAX,        UINT8_MAX },
+         INT8_C(     0),
+      {  INT32_C(  2147353087),  INT32_C(  2147353088), -INT32_C(      130561), -INT32_C(      130560) } },
+    { {  INT32_C(           0), -INT32_C(           1),              INT32_MIN,              INT32_MAX },
+      {        INT8_MIN,        INT8_MAX, -INT8_C(     1),        INT8_MIN,
+         INT8_C(     1),        INT8_MIN,        INT8_MAX, -INT8_C(   127),
+               INT8_MIN,        INT8_MAX, -INT8_C(     1),        INT8_MIN,
+         INT8_C(     1),        INT8_MIN,        INT8_MAX, -INT8_C(   127) },
+      {        UINT8_MAX,  UINT8_C(     0),        UINT8_MAX,  UINT8_C(     1),
+         UINT8_C(   128),        UINT8_MAX,  UINT8_C(   128),  UINT8_C(   127),
+               UINT8_MAX,  UINT8_C(     0),        UINT8_MAX,  UINT8_C(     1),
+         UINT8_C(   128),        UINT8_MAX,  UINT8_C(   128),  UINT8_C(   127) },
+         INT8_C(     3),
+      { -INT32_C(         383), -INT32_C(       32386),  INT32_C(  2147483265),  INT32_C(  2147451262) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -440,6 +494,24 @@ test_simde_vsudotq_lane_s32 (SIMDE_MUNIT_TEST_ARGS) {
          UINT8_C(   130),  UINT8_C(   113),  UINT8_C(    47),  UINT8_C(   188) },
          INT8_C(     0),
       {  INT32_C(   550160816),  INT32_C(   424220529), -INT32_C(  1171949013),  INT32_C(  1596300981) } },
+    { {              INT32_MAX,              INT32_MIN, -INT32_C(           1),  INT32_C(           0) },
+      {        INT8_MIN,        INT8_MIN,        INT8_MIN,        INT8_MIN,
+               INT8_MIN,        INT8_MIN,        INT8_MIN,        INT8_MIN,
+               INT8_MIN,        INT8_MIN,        INT8_MIN,        INT8_MIN,
+               INT8_MIN,        INT8_MIN,        INT8_MIN,        INT8_MIN },
+      {        UINT8_MAX,        UINT8_MAX,        UINT8_MAX,        UINT8_MAX,
+               UINT8_MAX,        UINT8_MAX,        UINT8_MAX,        UINT8_MAX },
+         INT8_C(     0),
+      {  INT32_C(  2147353087),  INT32_C(  2147353088), -INT32_C(      130561), -INT32_C(      130560) } },
+    { {  INT32_C(           0), -INT32_C(           1),              INT32_MIN,              INT32_MAX },
+      {        INT8_MIN,        INT8_MAX, -INT8_C(     1),        INT8_MIN,
+         INT8_C(     1),        INT8_MIN,        INT8_MAX, -INT8_C(   127),
+               INT8_MIN,        INT8_MAX, -INT8_C(     1),        INT8_MIN,
+         INT8_C(     1),        INT8_MIN,        INT8_MAX, -INT8_C(   127) },
+      {        UINT8_MAX,  UINT8_C(     0),        UINT8_MAX,  UINT8_C(     1),
+         UINT8_C(   128),        UINT8_MAX,  UINT8_C(   128),  UINT8_C(   127) },
+         INT8_C(     1),
+      { -INT32_C(         383), -INT32_C(       32386),  INT32_C(  2147483265),  INT32_C(  2147451262) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -61,6 +61,18 @@ test_simde_vusdot_s32 (SIMDE_MUNIT_TEST_ARGS) {
       {  INT8_C(   115), -INT8_C(    35),  INT8_C(    34), -INT8_C(    25),
         -INT8_C(    66),  INT8_C(    63),  INT8_C(   110),  INT8_C(    14) },
       {  INT32_C(  1415108752),  INT32_C(    77313466) } },
+    { {              INT32_MAX,              INT32_MIN },
+      {        UINT8_MAX,        UINT8_MAX,        UINT8_MAX,        UINT8_MAX,
+               UINT8_MAX,        UINT8_MAX,        UINT8_MAX,        UINT8_MAX },
+      {        INT8_MIN,        INT8_MIN,        INT8_MIN,        INT8_MIN,
+               INT8_MIN,        INT8_MIN,        INT8_MIN,        INT8_MIN },
+      {  INT32_C(  2147353087),  INT32_C(  2147353088) } },
+    { {  INT32_C(           0), -INT32_C(           1) },
+      {        UINT8_MAX,  UINT8_C(   128),  UINT8_C(   127),        UINT8_MAX,
+         UINT8_C(     0),        UINT8_MAX,  UINT8_C(     1),  UINT8_C(   128) },
+      {        INT8_MIN,  INT8_C(     1),        INT8_MIN,        INT8_MAX,
+        -INT8_C(   127),        INT8_MIN,        INT8_MAX, -INT8_C(     1) },
+      { -INT32_C(       16383), -INT32_C(       32642) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -148,6 +160,26 @@ test_simde_vusdotq_s32 (SIMDE_MUNIT_TEST_ARGS) {
       {  INT8_C(   115), -INT8_C(    35),  INT8_C(    34), -INT8_C(    25),
         -INT8_C(    66),  INT8_C(    63),  INT8_C(   110),  INT8_C(    14) },
       {  INT32_C(  1415108752),  INT32_C(    77313466) } },
+    { {              INT32_MAX,              INT32_MIN, -INT32_C(           1),  INT32_C(           0) },
+      {        UINT8_MAX,        UINT8_MAX,        UINT8_MAX,        UINT8_MAX,
+               UINT8_MAX,        UINT8_MAX,        UINT8_MAX,        UINT8_MAX,
+               UINT8_MAX,        UINT8_MAX,        UINT8_MAX,        UINT8_MAX,
+               UINT8_MAX,        UINT8_MAX,        UINT8_MAX,        UINT8_MAX },
+      {        INT8_MIN,        INT8_MIN,        INT8_MIN,        INT8_MIN,
+               INT8_MIN,        INT8_MIN,        INT8_MIN,        INT8_MIN,
+               INT8_MIN,        INT8_MIN,        INT8_MIN,        INT8_MIN,
+               INT8_MIN,        INT8_MIN,        INT8_MIN,        INT8_MIN },
+      {  INT32_C(  2147353087),  INT32_C(  2147353088), -INT32_C(      130561), -INT32_C(      130560) } },
+    { {  INT32_C(           0), -INT32_C(           1),              INT32_MIN,              INT32_MAX },
+      {        UINT8_MAX,  UINT8_C(   128),  UINT8_C(   127),        UINT8_MAX,
+         UINT8_C(     0),        UINT8_MAX,  UINT8_C(     1),  UINT8_C(   128),
+               UINT8_MAX,  UINT8_C(   128),  UINT8_C(   127),        UINT8_MAX,
+         UINT8_C(     0),        UINT8_MAX,  UINT8_C(     1),  UINT8_C(   128) },
+      {        INT8_MIN,  INT8_C(     1),        INT8_MIN,        INT8_MAX,
+        -INT8_C(   127),        INT8_MIN,        INT8_MAX, -INT8_C(     1),
+               INT8_MIN,  INT8_C(     1),        INT8_MIN,        INT8_MAX,
+        -INT8_C(   127),        INT8_MIN,        INT8_MAX, -INT8_C(     1) },
+      { -INT32_C(       16383), -INT32_C(       32642),  INT32_C(  2147467265),  INT32_C(  2147451006) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
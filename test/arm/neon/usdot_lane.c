@@ -73,6 +73,20 @@ test_simde_vusdot_lane_s32 (SIMDE_MUNIT_TEST_ARGS) {
         -INT8_C(   106), -INT8_C(    57), -INT8_C(    93), -INT8_C(   127) },
          INT8_C(     0),
       { -INT32_C(  1164257222),  INT32_C(   313457603) } },
+    { {              INT32_MAX,              INT32_MIN },
+      {        UINT8_MAX,        UINT8_MAX,        UINT8_MAX,        UINT8_MAX,
+               UINT8_MAX,        UINT8_MAX,        UINT8_MAX,        UINT8_MAX },
+      {        INT8_MIN,        INT8_MIN,        INT8_MIN,        INT8_MIN,
+               INT8_MIN,        INT8_MIN,        INT8_MIN,        INT8_MIN },
+         INT8_C(     0),
+      {  INT32_C(  2147353087),  INT32_C(  2147353088) } },
+    { {  INT32_C(           0), -INT32_C(           1) },
+      {        UINT8_MAX,  UINT8_C(   128),  UINT8_C(   127),        UINT8_MAX,
+         UINT8_C(     0),        UINT8_MAX,  UINT8_C(     1),  UINT8_C(   128) },
+      {        INT8_MIN,  INT8_C(     1),        INT8_MIN,        INT8_MAX,
+        -INT8_C(   127),        INT8_MIN,        INT8_MAX, -INT8_C(     1) },
+         INT8_C(     1),
+      { -INT32_C(       32895), -INT32_C(       32642) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -199,6 +213,24 @@ test_simde_vusdot_laneq_s32 (SIMDE_MUNIT_TEST_ARGS) {
          INT8_C(   121), -INT8_C(   122),  INT8_C(   123), -INT8_C(    99) },
          INT8_C(     1),
       {  INT32_C(  1753054693), -INT32_C(  1649662383) } },
+    { {              INT32_MAX,              INT32_MIN },
+      {        UINT8_MAX,        UINT8_MAX,        UINT8_MAX,        UINT8_MAX,
+               UINT8_MAX,        UINT8_MAX,        UINT8_MAX,        UINT8_MAX },
+      {        INT8_MIN,        INT8_MIN,        INT8_MIN,        INT8_MIN,
+               INT8_MIN,        INT8_MIN,        INT8_MIN,        INT8_MIN,
+               INT8_MIN,        INT8_MIN,        INT8_MIN,        INT8_MIN,
+               INT8_MIN,        INT8_MIN,        INT8_MIN,        INT8_MIN },
+         INT8_C(     0),
+      {  INT32_C(  2147353087),  INT32_C(  2147353088) } },
+    { {  INT32_C(           0), -INT32_C(           1) },
+      {        UINT8_MAX,  UINT8_C(   128),  UINT8_C(   127),        UINT8_MAX,
+         UINT8_C(     0),        UINT8_MAX,  UINT8_C(     1),  UINT8_C(   128) },
+      {        INT8_MIN,  INT8_C(     1),        INT8_MIN,        INT8_MAX,
+        -INT8_C(   127),        INT8_MIN,        INT8_MAX, -INT8_C(     1),
+               INT8_MIN,  INT8_C(     1),        INT8_MIN,        INT8_MAX,
+        -INT8_C(   127),        INT8_MIN,        INT8_MAX, -INT8_C(     1) },
+         INT8_C(     3),
+      { -INT32_C(       32895), -INT32_C(       32642) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -345,6 +377,28 @@ test_simde_vusdotq_laneq_s32 (SIMDE_MUNIT_TEST_ARGS) {
         -INT8_C(    50), -INT8_C(    79),  INT8_C(    79),  INT8_C(    86) },
          INT8_C(     1),
       {  INT32_C(   141229542), -INT32_C(   275545126), -INT32_C(  2103112710), -INT32_C(  1174373132) } },
+    { {              INT32_MAX,              INT32_MIN, -INT32_C(           1),  INT32_C(           0) },
+      {        UINT8_MAX,        UINT8_MAX,        UINT8_MAX,        UINT8_MAX,
+               UINT8_MAX,        UINT8_MAX,        UINT8_MAX,        UINT8_MAX,
+               UINT8_MAX,        UINT8_MAX,        UINT8_MAX,        UINT8_MAX,
+               UINT8_MAX,        UINT8_MAX,        UINT8_MAX,        UINT8_MAX },
+      {        INT8_MIN,        INT8_MIN,        INT8_MIN,        INT8_MIN,
+               INT8_MIN,        INT8_MIN,        INT8_MIN,        INT8_MIN,
+               INT8_MIN,        INT8_MIN,        INT8_MIN,        INT8_MIN,
+               INT8_MIN,        INT8_MIN,        INT8_MIN,        INT8_MIN },
+         INT8_C(     0),
+      {  INT32_C(  2147353087),  INT32_C(  2147353088), -INT32_C(      130561), -INT32_C(      130560) } },
+    { {  INT32_C(           0), -INT32_C(           1),              INT32_MIN,              INT32_MAX },
+      {        UINT8_MAX,  UINT8_C(   128),  UINT8_C(   127),        UINT8_MAX,
+         UINT8_C(     0),        UINT8_MAX,  UINT8_C(     1),  UINT8_C(   128),
+               UINT8_MAX,  UINT8_C(   128),  UINT8_C(   127),        UINT8_MAX,
+         UINT8_C(     0),        UINT8_MAX,  UINT8_C(     1),  UINT8_C(   128) },
+      {        INT8_MIN,  INT8_C(     1),        INT8_MIN,        INT8_MAX,
+        -INT8_C(   127),        INT8_MIN,        INT8_MAX, -INT8_C(     1),
+               INT8_MIN,  INT8_C(     1),        INT8_MIN,        INT8_MAX,
+        -INT8_C(   127),        INT8_MIN,        INT8_MAX, -INT8_C(     1) },
+         INT8_C(     3),
+      { -INT32_C(       32895), -INT32_C(       32642),  INT32_C(  2147450753),  INT32_C(  2147451006) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -475,6 +529,24 @@ test_simde_vusdotq_lane_s32 (SIMDE_MUNIT_TEST_ARGS) {
         -INT8_C(    62),  INT8_C(   101),  INT8_C(   122),  INT8_C(    64) },
          INT8_C(     0),
       {  INT32_C(  2142913376),  INT32_C(  1602140187), -INT32_C(   826262393),  INT32_C(  1808605498) } },
+    { {              INT32_MAX,              INT32_MIN, -INT32_C(           1),  INT32_C(           0) },
+      {        UINT8_MAX,        UINT8_MAX,        UINT8_MAX,        UINT8_MAX,
+               UINT8_MAX,        UINT8_MAX,        UINT8_MAX,        UINT8_MAX,
+               UINT8_MAX,        UINT8_MAX,        UINT8_MAX,        UINT8_MAX,
+               UINT8_MAX,        UINT8_MAX,        UINT8_MAX,        UINT8_MAX },
+      {        INT8_MIN,        INT8_MIN,        INT8_MIN,        INT8_MIN,
+               INT8_MIN,        INT8_MIN,        INT8_MIN,        INT8_MIN },
+         INT8_C(     0),
+      {  INT32_C(  2147353087),  INT32_C(  2147353088), -INT32_C(      130561), -INT32_C(      130560) } },
+    { {  INT32_C(           0), -INT32_C(           1),              INT32_MIN,              INT32_MAX },
+      {        UINT8_MAX,  UINT8_C(   128),  UINT8_C(   127),        UINT8_MAX,
+         UINT8_C(     0),        UINT8_MAX,  UINT8_C(     1),  UINT8_C(   128),
+               UINT8_MAX,  UINT8_C(   128),  UINT8_C(   127),        UINT8_MAX,
+         UINT8_C(     0),        UINT8_MAX,  UINT8_C(     1),  UINT8_C(   128) },
+      {        INT8_MIN,  INT8_C(     1),        INT8_MIN,        INT8_MAX,
+        -INT8_C(   127),        INT8_MIN,        INT8_MAX, -INT8_C(     1) },
+         INT8_C(     1),
+      { -INT32_C(       32895), -INT32_C(       32642),  INT32_C(  2147450753),  INT32_C(  2147451006) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -0,0 +1,70 @@
+#define SIMDE_ENABLE_RUNTIME_DISPATCH
+#include "../test.h"
+#include "../../simde/simde-dispatch.h"
+
+/* Normally each variant would live in its own translation unit built
+ * with different compiler flags, but the resolver doesn't care where
+ * the symbols come from. */
+
+typedef int simde_test_dispatch_fn (int);
+
+SIMDE_DISPATCH_DEFINE(simde_test_dispatch_fn, simde_test_dispatch_level)
+
+int simde_test_dispatch_level_portable  (int v) { return v + SIMDE_DISPATCH_LEVEL_PORTABLE;  }
+int simde_test_dispatch_level_x86_64_v1 (int v) { return v + SIMDE_DISPATCH_LEVEL_X86_64_V1; }
+int simde_test_dispatch_level_x86_64_v2 (int v) { return v + SIMDE_DISPATCH_LEVEL_X86_64_V2; }
+int simde_test_dispatch_level_x86_64_v3 (int v) { return v + SIMDE_DISPATCH_LEVEL_X86_64_V3; }
+int simde_test_dispatch_level_x86_64_v4 (int v) { return v + SIMDE_DISPATCH_LEVEL_X86_64_V4; }
+
+static int
+test_simde_dispatch_cpu_level (SIMDE_MUNIT_TEST_ARGS) {
+  int level = simde_x_dispatch_cpu_level();
+
+  /* We're running, so the CPU must support whatever we were compiled
+   * for. */
+  simde_assert_int(level, >=, SIMDE_DISPATCH_COMPILED_LEVEL);
+  simde_assert_int(level, <=, SIMDE_DISPATCH_LEVEL_X86_64_V4);
+
+  /* Cached value should be stable. */
+  simde_assert_int(simde_x_dispatch_cpu_level(), ==, level);
+
+  return 0;
+}
+
+static int
+test_simde_dispatch_resolve (SIMDE_MUNIT_TEST_ARGS) {
+  int level = simde_x_dispatch_cpu_level();
+  simde_test_dispatch_fn* fn = SIMDE_DISPATCH(simde_test_dispatch_level);
+
+  #if defined(SIMDE_ARCH_X86) || defined(SIMDE_ARCH_AMD64)
+    simde_assert_int(fn(0), ==, level);
+  #else
+    simde_assert_int(fn(0), ==, SIMDE_DISPATCH_COMPILED_LEVEL);
+  #endif
+  simde_assert_int(SIMDE_DISPATCH(simde_test_dispatch_level)(1), ==, fn(1));
+  simde_assert_int(SIMDE_DISPATCH_NAME(simde_test_dispatch_level)(0), ==, SIMDE_DISPATCH_COMPILED_LEVEL);
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(dispatch_cpu_level)
+  SIMDE_TEST_FUNC_LIST_ENTRY(dispatch_resolve)
+SIMDE_TEST_FUNC_LIST_END
+
+int main(void) {
+  int retval = EXIT_SUCCESS;
+
+  fprintf(stdout, "1..%zu\n", (sizeof(test_suite_tests) / sizeof(test_suite_tests[0])));
+  for (size_t i = 0 ; i < (sizeof(test_suite_tests) / sizeof(test_suite_tests[0])) ; i++) {
+    int res = test_suite_tests[i].func();
+    if (res != 0) {
+      retval = EXIT_FAILURE;
+      fprintf(stdout, "not ok %zu %s\n", i + 1, test_suite_tests[i].name);
+    } else {
+      fprintf(stdout, "ok %zu %s\n", i + 1, test_suite_tests[i].name);
+    }
+  }
+
+  return retval;
+}
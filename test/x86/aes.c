@@ -24,7 +24,7 @@
 
 #define SIMDE_TESTS_CURRENT_ISAX aes
 #include <simde/x86/aes.h>
-#include <test/x86/test-sse2.h>
+#include <test/x86/avx512/test-avx512.h>
 
 static int
 test_simde_mm_aesenc_si128 (SIMDE_MUNIT_TEST_ARGS) {
@@ -344,12 +344,996 @@ test_simde_mm_aesimc_si128 (SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm256_aesenc_epi128 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t a[32];
+    const int8_t b[32];
+    const int8_t r[32];
+  } test_vec[] = {
+    { { -INT8_C( 106),  INT8_C(  78),  INT8_C(  54), -INT8_C(  24), -INT8_C(  73), -INT8_C(  22), -INT8_C( 118), -INT8_C(  93),
+        -INT8_C(  25),  INT8_C(  78),  INT8_C(  93), -INT8_C( 103), -INT8_C(  23),  INT8_C( 120),  INT8_C(  74),  INT8_C(  62),
+         INT8_C(   3), -INT8_C( 108),  INT8_C( 124), -INT8_C(  66), -INT8_C(  73),  INT8_C(   9), -INT8_C(   8), -INT8_C(  32),
+         INT8_C(  51),  INT8_C(   0), -INT8_C(  84), -INT8_C(  45),  INT8_C(  97), -INT8_C(  92), -INT8_C(   6),  INT8_C(  99) },
+      { -INT8_C(  50),  INT8_C(   9), -INT8_C(  57),  INT8_C(  50),  INT8_C( 114), -INT8_C(  73),  INT8_C(  79),  INT8_C(   4),
+        -INT8_C( 101), -INT8_C(  97),  INT8_C(  92), -INT8_C( 124),  INT8_C(  25),  INT8_C(  21), -INT8_C( 119),  INT8_C(  26),
+         INT8_C(  91),  INT8_C(  10), -INT8_C(  25),  INT8_C(   4), -INT8_C(  78),  INT8_C( 115), -INT8_C(  25), -INT8_C(  73),
+        -INT8_C(  64),  INT8_C( 102),  INT8_C(  79), -INT8_C(  81),  INT8_C(  30),  INT8_C(  97),  INT8_C(  40), -INT8_C(  45) },
+      { -INT8_C( 103), -INT8_C(  22), -INT8_C( 123),  INT8_C(  45),  INT8_C(   7), -INT8_C(  70), -INT8_C(  56),  INT8_C(  48),
+         INT8_C( 120),  INT8_C( 109),  INT8_C(  96), -INT8_C( 114), -INT8_C(  60),  INT8_C(  57),  INT8_C( 109), -INT8_C(  82),
+        -INT8_C(  60),  INT8_C(  32), -INT8_C(  78), -INT8_C(  12), -INT8_C(  35), -INT8_C(  59), -INT8_C(  98),  INT8_C(  94),
+         INT8_C( 119), -INT8_C(  26), -INT8_C(  35),  INT8_C( 113), -INT8_C( 102),  INT8_C( 111), -INT8_C(  51),  INT8_C(  86) } },
+    { { -INT8_C(  91), -INT8_C(  43),  INT8_C(  28),  INT8_C(   8),  INT8_C(  93), -INT8_C(  75),  INT8_C( 124), -INT8_C( 122),
+        -INT8_C(  79), -INT8_C(  94), -INT8_C( 114),  INT8_C(  52), -INT8_C( 121), -INT8_C(  48),  INT8_C(  68), -INT8_C(  39),
+         INT8_C(   8),  INT8_C(   4), -INT8_C(  30),  INT8_C(  22), -INT8_C(  44), -INT8_C(  58), -INT8_C(  19), -INT8_C( 108),
+        -INT8_C( 120),  INT8_C(  55),  INT8_C(  15), -INT8_C(  55),  INT8_C(  76), -INT8_C(  43), -INT8_C( 123),  INT8_C( 111) },
+      {  INT8_C(   4),  INT8_C(   7), -INT8_C(  24),  INT8_C(  40), -INT8_C(   9), -INT8_C(  50), -INT8_C(  35),  INT8_C(  64),
+        -INT8_C(  32),  INT8_C(  95), -INT8_C( 107), -INT8_C(  85),  INT8_C(  89), -INT8_C(  81),  INT8_C(  49), -INT8_C(  13),
+        -INT8_C(  58), -INT8_C(  48),  INT8_C(  44), -INT8_C(  58),  INT8_C(  34), -INT8_C(  30),  INT8_C(  54), -INT8_C( 114),
+         INT8_C(   0), -INT8_C(  23),  INT8_C(   3),  INT8_C(   1),  INT8_C(  47),  INT8_C(  42), -INT8_C(  53),  INT8_C(   1) },
+      {  INT8_C(  64), -INT8_C(  82),  INT8_C(  86), -INT8_C( 124),  INT8_C(  10), -INT8_C(  21), -INT8_C(  51), -INT8_C(  43),
+         INT8_C(  35), -INT8_C( 116), -INT8_C(  62), -INT8_C( 116),  INT8_C( 122), -INT8_C( 106),  INT8_C(  45), -INT8_C(  23),
+        -INT8_C(  65), -INT8_C(  95), -INT8_C(  89),  INT8_C(  31), -INT8_C(  41),  INT8_C(  96),  INT8_C(  24), -INT8_C(  43),
+         INT8_C(  44), -INT8_C(  70), -INT8_C( 119), -INT8_C( 119), -INT8_C(   8), -INT8_C(  34), -INT8_C(  58),  INT8_C( 124) } },
+    { { -INT8_C(  66), -INT8_C(   5),  INT8_C(  11), -INT8_C(  86), -INT8_C( 108), -INT8_C(  30), -INT8_C(  46),  INT8_C(  57),
+         INT8_C(  87), -INT8_C(  62), -INT8_C(  78), -INT8_C(  62),  INT8_C(  48), -INT8_C(  11),  INT8_C( 125),      INT8_MIN,
+        -INT8_C(   1), -INT8_C(  25),  INT8_C(  95),  INT8_C(  58),  INT8_C(  54), -INT8_C(  38), -INT8_C(  78), -INT8_C(   1),
+        -INT8_C(  84),  INT8_C(  69),  INT8_C( 120), -INT8_C(  39), -INT8_C(  90),  INT8_C(  26),  INT8_C(  94),  INT8_C( 119) },
+      {  INT8_C(  61),  INT8_C(  52),  INT8_C(  29), -INT8_C(  19), -INT8_C(  56), -INT8_C( 115),  INT8_C(  57), -INT8_C(  75),
+        -INT8_C(  40),  INT8_C(  13), -INT8_C(  46), -INT8_C( 122),  INT8_C(  46),  INT8_C(  63), -INT8_C( 122), -INT8_C( 125),
+        -INT8_C(  96), -INT8_C(  90),  INT8_C(   7), -INT8_C(  31),  INT8_C( 112), -INT8_C(  13),  INT8_C(  18), -INT8_C(  61),
+         INT8_C(   2), -INT8_C( 127), -INT8_C(  17),  INT8_C(  78),  INT8_C(  94),  INT8_C(  98),  INT8_C(  81),  INT8_C(  11) },
+      {  INT8_C(  51),  INT8_C(  37),  INT8_C(   9),  INT8_C(  42), -INT8_C(  80),  INT8_C(  83),  INT8_C(  52),  INT8_C(  74),
+         INT8_C( 102), -INT8_C(  18),  INT8_C(  15), -INT8_C( 126), -INT8_C(  89), -INT8_C(  60), -INT8_C( 109),  INT8_C( 127),
+         INT8_C(  60),  INT8_C(  52),  INT8_C(  33), -INT8_C(  63),  INT8_C(  16),  INT8_C(  66),  INT8_C(  82), -INT8_C(  31),
+         INT8_C(  31),  INT8_C(  19),  INT8_C(  99), -INT8_C(  89), -INT8_C(  77),  INT8_C(  25), -INT8_C(  48), -INT8_C(  82) } },
+    { { -INT8_C(  49),  INT8_C(   7), -INT8_C(  10),  INT8_C(  63),  INT8_C(  98), -INT8_C(  95), -INT8_C(  10), -INT8_C(  73),
+         INT8_C(  53), -INT8_C( 124),  INT8_C(  56), -INT8_C( 105), -INT8_C( 117), -INT8_C(  72),  INT8_C(   3),  INT8_C(  34),
+         INT8_C( 100), -INT8_C(  78),  INT8_C(  62),  INT8_C( 120),  INT8_C( 101),  INT8_C( 121),  INT8_C(  45), -INT8_C(  84),
+         INT8_C(  13),  INT8_C(  97),  INT8_C(  43), -INT8_C(  31), -INT8_C(  23),  INT8_C( 126),  INT8_C(   5), -INT8_C(  47) },
+      {  INT8_C( 116), -INT8_C(  71),  INT8_C( 103),  INT8_C(  44),  INT8_C(  48), -INT8_C(  18),  INT8_C(  73),  INT8_C( 112),
+         INT8_C(  57),  INT8_C(  97), -INT8_C(  22),  INT8_C(  61),  INT8_C(  97), -INT8_C( 101),  INT8_C(  10), -INT8_C( 101),
+        -INT8_C(  48),  INT8_C(  76), -INT8_C(  44), -INT8_C(  16), -INT8_C(  12),  INT8_C(  10),  INT8_C(  52), -INT8_C(  17),
+        -INT8_C(  60), -INT8_C(  71),  INT8_C( 125),  INT8_C(  88),  INT8_C(  33), -INT8_C(  98), -INT8_C( 100), -INT8_C(  37) },
+      { -INT8_C(  71), -INT8_C(  51),  INT8_C( 127), -INT8_C(  95), -INT8_C( 112),  INT8_C(   2), -INT8_C(  43),  INT8_C(  91),
+         INT8_C(  81),  INT8_C(  64),  INT8_C( 116), -INT8_C(   5), -INT8_C( 123),  INT8_C( 121), -INT8_C(  11),  INT8_C(  80),
+         INT8_C(  88),  INT8_C(  78), -INT8_C( 102),  INT8_C(  14), -INT8_C( 109), -INT8_C( 125), -INT8_C(  97), -INT8_C(  33),
+         INT8_C(  92), -INT8_C(  49), -INT8_C( 114),  INT8_C(  66),  INT8_C( 100),  INT8_C( 101),  INT8_C(  13), -INT8_C(   3) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i b = simde_mm256_loadu_epi8(test_vec[i].b);
+    simde__m256i r = simde_mm256_aesenc_epi128(a, b);
+    simde_test_x86_assert_equal_i8x32(r, simde_mm256_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_aesdec_epi128 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t a[32];
+    const int8_t b[32];
+    const int8_t r[32];
+  } test_vec[] = {
+    { { -INT8_C( 106),  INT8_C(  78),  INT8_C(  54), -INT8_C(  24), -INT8_C(  73), -INT8_C(  22), -INT8_C( 118), -INT8_C(  93),
+        -INT8_C(  25),  INT8_C(  78),  INT8_C(  93), -INT8_C( 103), -INT8_C(  23),  INT8_C( 120),  INT8_C(  74),  INT8_C(  62),
+         INT8_C(   3), -INT8_C( 108),  INT8_C( 124), -INT8_C(  66), -INT8_C(  73),  INT8_C(   9), -INT8_C(   8), -INT8_C(  32),
+         INT8_C(  51),  INT8_C(   0), -INT8_C(  84), -INT8_C(  45),  INT8_C(  97), -INT8_C(  92), -INT8_C(   6),  INT8_C(  99) },
+      { -INT8_C(  50),  INT8_C(   9), -INT8_C(  57),  INT8_C(  50),  INT8_C( 114), -INT8_C(  73),  INT8_C(  79),  INT8_C(   4),
+        -INT8_C( 101), -INT8_C(  97),  INT8_C(  92), -INT8_C( 124),  INT8_C(  25),  INT8_C(  21), -INT8_C( 119),  INT8_C(  26),
+         INT8_C(  91),  INT8_C(  10), -INT8_C(  25),  INT8_C(   4), -INT8_C(  78),  INT8_C( 115), -INT8_C(  25), -INT8_C(  73),
+        -INT8_C(  64),  INT8_C( 102),  INT8_C(  79), -INT8_C(  81),  INT8_C(  30),  INT8_C(  97),  INT8_C(  40), -INT8_C(  45) },
+      { -INT8_C( 106), -INT8_C(  18),  INT8_C(  55),  INT8_C( 117),  INT8_C(  62),  INT8_C(  89),  INT8_C(  25), -INT8_C(  61),
+         INT8_C(  20), -INT8_C(   3), -INT8_C(  96),  INT8_C( 107),  INT8_C( 100),  INT8_C(  14),  INT8_C( 100), -INT8_C(  53),
+         INT8_C( 106),  INT8_C(  40),  INT8_C(  54),  INT8_C(   4),  INT8_C(  80), -INT8_C(  51), -INT8_C(  59), -INT8_C(  77),
+         INT8_C( 105), -INT8_C(  69), -INT8_C(  49),  INT8_C( 124), -INT8_C( 113), -INT8_C(  52), -INT8_C(  30),  INT8_C(  20) } },
+    { { -INT8_C(  91), -INT8_C(  43),  INT8_C(  28),  INT8_C(   8),  INT8_C(  93), -INT8_C(  75),  INT8_C( 124), -INT8_C( 122),
+        -INT8_C(  79), -INT8_C(  94), -INT8_C( 114),  INT8_C(  52), -INT8_C( 121), -INT8_C(  48),  INT8_C(  68), -INT8_C(  39),
+         INT8_C(   8),  INT8_C(   4), -INT8_C(  30),  INT8_C(  22), -INT8_C(  44), -INT8_C(  58), -INT8_C(  19), -INT8_C( 108),
+        -INT8_C( 120),  INT8_C(  55),  INT8_C(  15), -INT8_C(  55),  INT8_C(  76), -INT8_C(  43), -INT8_C( 123),  INT8_C( 111) },
+      {  INT8_C(   4),  INT8_C(   7), -INT8_C(  24),  INT8_C(  40), -INT8_C(   9), -INT8_C(  50), -INT8_C(  35),  INT8_C(  64),
+        -INT8_C(  32),  INT8_C(  95), -INT8_C( 107), -INT8_C(  85),  INT8_C(  89), -INT8_C(  81),  INT8_C(  49), -INT8_C(  13),
+        -INT8_C(  58), -INT8_C(  48),  INT8_C(  44), -INT8_C(  58),  INT8_C(  34), -INT8_C(  30),  INT8_C(  54), -INT8_C( 114),
+         INT8_C(   0), -INT8_C(  23),  INT8_C(   3),  INT8_C(   1),  INT8_C(  47),  INT8_C(  42), -INT8_C(  53),  INT8_C(   1) },
+      {  INT8_C( 104),  INT8_C( 112), -INT8_C(  83),  INT8_C(   5),  INT8_C( 108),  INT8_C(  21),  INT8_C( 122),  INT8_C(  49),
+         INT8_C(  33), -INT8_C( 121), -INT8_C( 105),  INT8_C(  21), -INT8_C(  63),  INT8_C(  41), -INT8_C(  34),  INT8_C(  76),
+        -INT8_C(  64),  INT8_C(  12),  INT8_C(  66),  INT8_C( 100),  INT8_C(   0),  INT8_C( 126), -INT8_C(  46), -INT8_C( 120),
+        -INT8_C( 103), -INT8_C(  52), -INT8_C(  20),  INT8_C(  63), -INT8_C(  30),  INT8_C(   3), -INT8_C( 114), -INT8_C(  29) } },
+    { { -INT8_C(  66), -INT8_C(   5),  INT8_C(  11), -INT8_C(  86), -INT8_C( 108), -INT8_C(  30), -INT8_C(  46),  INT8_C(  57),
+         INT8_C(  87), -INT8_C(  62), -INT8_C(  78), -INT8_C(  62),  INT8_C(  48), -INT8_C(  11),  INT8_C( 125),      INT8_MIN,
+        -INT8_C(   1), -INT8_C(  25),  INT8_C(  95),  INT8_C(  58),  INT8_C(  54), -INT8_C(  38), -INT8_C(  78), -INT8_C(   1),
+        -INT8_C(  84),  INT8_C(  69),  INT8_C( 120), -INT8_C(  39), -INT8_C(  90),  INT8_C(  26),  INT8_C(  94),  INT8_C( 119) },
+      {  INT8_C(  61),  INT8_C(  52),  INT8_C(  29), -INT8_C(  19), -INT8_C(  56), -INT8_C( 115),  INT8_C(  57), -INT8_C(  75),
+        -INT8_C(  40),  INT8_C(  13), -INT8_C(  46), -INT8_C( 122),  INT8_C(  46),  INT8_C(  63), -INT8_C( 122), -INT8_C( 125),
+        -INT8_C(  96), -INT8_C(  90),  INT8_C(   7), -INT8_C(  31),  INT8_C( 112), -INT8_C(  13),  INT8_C(  18), -INT8_C(  61),
+         INT8_C(   2), -INT8_C( 127), -INT8_C(  17),  INT8_C(  78),  INT8_C(  94),  INT8_C(  98),  INT8_C(  81),  INT8_C(  11) },
+      { -INT8_C( 120),  INT8_C(  95),  INT8_C(  92),  INT8_C(  58),  INT8_C(  29), -INT8_C(  45),  INT8_C( 102),  INT8_C(  94),
+        -INT8_C( 117),  INT8_C(  56),  INT8_C(  79),  INT8_C(  56), -INT8_C( 104),  INT8_C(   5),  INT8_C(  38),  INT8_C(  18),
+        -INT8_C( 103), -INT8_C(   4), -INT8_C(  99), -INT8_C( 102),  INT8_C( 120), -INT8_C( 101),  INT8_C(  96),  INT8_C(  61),
+         INT8_C( 123),  INT8_C(  55),  INT8_C(  20),  INT8_C(  44), -INT8_C(  71),  INT8_C(   1),  INT8_C(  47), -INT8_C(  64) } },
+    { { -INT8_C(  49),  INT8_C(   7), -INT8_C(  10),  INT8_C(  63),  INT8_C(  98), -INT8_C(  95), -INT8_C(  10), -INT8_C(  73),
+         INT8_C(  53), -INT8_C( 124),  INT8_C(  56), -INT8_C( 105), -INT8_C( 117), -INT8_C(  72),  INT8_C(   3),  INT8_C(  34),
+         INT8_C( 100), -INT8_C(  78),  INT8_C(  62),  INT8_C( 120),  INT8_C( 101),  INT8_C( 121),  INT8_C(  45), -INT8_C(  84),
+         INT8_C(  13),  INT8_C(  97),  INT8_C(  43), -INT8_C(  31), -INT8_C(  23),  INT8_C( 126),  INT8_C(   5), -INT8_C(  47) },
+      {  INT8_C( 116), -INT8_C(  71),  INT8_C( 103),  INT8_C(  44),  INT8_C(  48), -INT8_C(  18),  INT8_C(  73),  INT8_C( 112),
+         INT8_C(  57),  INT8_C(  97), -INT8_C(  22),  INT8_C(  61),  INT8_C(  97), -INT8_C( 101),  INT8_C(  10), -INT8_C( 101),
+        -INT8_C(  48),  INT8_C(  76), -INT8_C(  44), -INT8_C(  16), -INT8_C(  12),  INT8_C(  10),  INT8_C(  52), -INT8_C(  17),
+        -INT8_C(  60), -INT8_C(  71),  INT8_C( 125),  INT8_C(  88),  INT8_C(  33), -INT8_C(  98), -INT8_C( 100), -INT8_C(  37) },
+      {  INT8_C( 121),  INT8_C(  89),  INT8_C( 126),  INT8_C(  75), -INT8_C(  60),  INT8_C(  84),  INT8_C(  94), -INT8_C(  22),
+        -INT8_C( 101),  INT8_C(  70), -INT8_C( 109), -INT8_C(  85),  INT8_C(  25), -INT8_C( 127), -INT8_C( 114),  INT8_C(  15),
+        -INT8_C( 110), -INT8_C(  73),  INT8_C(  68),  INT8_C( 126), -INT8_C( 117), -INT8_C(  77),  INT8_C( 105),  INT8_C(  32),
+         INT8_C(  97),  INT8_C(  89),  INT8_C(  89), -INT8_C(  27), -INT8_C(  96),  INT8_C(  46),  INT8_C(  28),  INT8_C(  98) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i b = simde_mm256_loadu_epi8(test_vec[i].b);
+    simde__m256i r = simde_mm256_aesdec_epi128(a, b);
+    simde_test_x86_assert_equal_i8x32(r, simde_mm256_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_aesenclast_epi128 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t a[32];
+    const int8_t b[32];
+    const int8_t r[32];
+  } test_vec[] = {
+    { { -INT8_C( 106),  INT8_C(  78),  INT8_C(  54), -INT8_C(  24), -INT8_C(  73), -INT8_C(  22), -INT8_C( 118), -INT8_C(  93),
+        -INT8_C(  25),  INT8_C(  78),  INT8_C(  93), -INT8_C( 103), -INT8_C(  23),  INT8_C( 120),  INT8_C(  74),  INT8_C(  62),
+         INT8_C(   3), -INT8_C( 108),  INT8_C( 124), -INT8_C(  66), -INT8_C(  73),  INT8_C(   9), -INT8_C(   8), -INT8_C(  32),
+         INT8_C(  51),  INT8_C(   0), -INT8_C(  84), -INT8_C(  45),  INT8_C(  97), -INT8_C(  92), -INT8_C(   6),  INT8_C(  99) },
+      { -INT8_C(  50),  INT8_C(   9), -INT8_C(  57),  INT8_C(  50),  INT8_C( 114), -INT8_C(  73),  INT8_C(  79),  INT8_C(   4),
+        -INT8_C( 101), -INT8_C(  97),  INT8_C(  92), -INT8_C( 124),  INT8_C(  25),  INT8_C(  21), -INT8_C( 119),  INT8_C(  26),
+         INT8_C(  91),  INT8_C(  10), -INT8_C(  25),  INT8_C(   4), -INT8_C(  78),  INT8_C( 115), -INT8_C(  25), -INT8_C(  73),
+        -INT8_C(  64),  INT8_C( 102),  INT8_C(  79), -INT8_C(  81),  INT8_C(  30),  INT8_C(  97),  INT8_C(  40), -INT8_C(  45) },
+      {  INT8_C(  94), -INT8_C( 114), -INT8_C( 117),      INT8_MIN, -INT8_C(  37), -INT8_C( 104), -INT8_C( 103), -INT8_C(  97),
+         INT8_C(  15),  INT8_C(  35),  INT8_C(  89), -INT8_C( 114),  INT8_C(   7),  INT8_C(  58), -INT8_C(   9), -INT8_C(  12),
+         INT8_C(  32),  INT8_C(  11),  INT8_C( 118), -INT8_C(   1),  INT8_C(  27),  INT8_C(  16), -INT8_C(  54),  INT8_C(  25),
+         INT8_C(   3),  INT8_C(  47),  INT8_C(  95),  INT8_C(  78), -INT8_C(  15),  INT8_C(  67),  INT8_C( 105), -INT8_C(  75) } },
+    { { -INT8_C(  91), -INT8_C(  43),  INT8_C(  28),  INT8_C(   8),  INT8_C(  93), -INT8_C(  75),  INT8_C( 124), -INT8_C( 122),
+        -INT8_C(  79), -INT8_C(  94), -INT8_C( 114),  INT8_C(  52), -INT8_C( 121), -INT8_C(  48),  INT8_C(  68), -INT8_C(  39),
+         INT8_C(   8),  INT8_C(   4), -INT8_C(  30),  INT8_C(  22), -INT8_C(  44), -INT8_C(  58), -INT8_C(  19), -INT8_C( 108),
+        -INT8_C( 120),  INT8_C(  55),  INT8_C(  15), -INT8_C(  55),  INT8_C(  76), -INT8_C(  43), -INT8_C( 123),  INT8_C( 111) },
+      {  INT8_C(   4),  INT8_C(   7), -INT8_C(  24),  INT8_C(  40), -INT8_C(   9), -INT8_C(  50), -INT8_C(  35),  INT8_C(  64),
+        -INT8_C(  32),  INT8_C(  95), -INT8_C( 107), -INT8_C(  85),  INT8_C(  89), -INT8_C(  81),  INT8_C(  49), -INT8_C(  13),
+        -INT8_C(  58), -INT8_C(  48),  INT8_C(  44), -INT8_C(  58),  INT8_C(  34), -INT8_C(  30),  INT8_C(  54), -INT8_C( 114),
+         INT8_C(   0), -INT8_C(  23),  INT8_C(   3),  INT8_C(   1),  INT8_C(  47),  INT8_C(  42), -INT8_C(  53),  INT8_C(   1) },
+      {  INT8_C(   2), -INT8_C(  46), -INT8_C(  15),  INT8_C(  29), -INT8_C(  69), -INT8_C(  12), -INT8_C(  58),  INT8_C( 112),
+         INT8_C(  40),  INT8_C(  47),  INT8_C(   9), -INT8_C(  17),  INT8_C(  78), -INT8_C(  84),  INT8_C(  33), -INT8_C(  21),
+        -INT8_C(  10),  INT8_C( 100),  INT8_C(  90),  INT8_C( 110),  INT8_C( 106),  INT8_C( 120), -INT8_C(  95), -INT8_C(  55),
+        -INT8_C(  60), -INT8_C(  22), -INT8_C( 101),  INT8_C(  35),  INT8_C(   6), -INT8_C(  40), -INT8_C(  98), -INT8_C(  36) } },
+    { { -INT8_C(  66), -INT8_C(   5),  INT8_C(  11), -INT8_C(  86), -INT8_C( 108), -INT8_C(  30), -INT8_C(  46),  INT8_C(  57),
+         INT8_C(  87), -INT8_C(  62), -INT8_C(  78), -INT8_C(  62),  INT8_C(  48), -INT8_C(  11),  INT8_C( 125),      INT8_MIN,
+        -INT8_C(   1), -INT8_C(  25),  INT8_C(  95),  INT8_C(  58),  INT8_C(  54), -INT8_C(  38), -INT8_C(  78), -INT8_C(   1),
+        -INT8_C(  84),  INT8_C(  69),  INT8_C( 120), -INT8_C(  39), -INT8_C(  90),  INT8_C(  26),  INT8_C(  94),  INT8_C( 119) },
+      {  INT8_C(  61),  INT8_C(  52),  INT8_C(  29), -INT8_C(  19), -INT8_C(  56), -INT8_C( 115),  INT8_C(  57), -INT8_C(  75),
+        -INT8_C(  40),  INT8_C(  13), -INT8_C(  46), -INT8_C( 122),  INT8_C(  46),  INT8_C(  63), -INT8_C( 122), -INT8_C( 125),
+        -INT8_C(  96), -INT8_C(  90),  INT8_C(   7), -INT8_C(  31),  INT8_C( 112), -INT8_C(  13),  INT8_C(  18), -INT8_C(  61),
+         INT8_C(   2), -INT8_C( 127), -INT8_C(  17),  INT8_C(  78),  INT8_C(  94),  INT8_C(  98),  INT8_C(  81),  INT8_C(  11) },
+      { -INT8_C( 109), -INT8_C(  84),  INT8_C(  42),  INT8_C(  32), -INT8_C(  22), -INT8_C(  88), -INT8_C(  58),  INT8_C(  25),
+        -INT8_C( 125), -INT8_C(  21), -INT8_C(   7), -INT8_C( 108),  INT8_C(  42),  INT8_C(  48),  INT8_C(  51), -INT8_C(  90),
+        -INT8_C(  74), -INT8_C(  15), -INT8_C(  69),  INT8_C(  20),  INT8_C( 117), -INT8_C(  99),  INT8_C(  74),  INT8_C(  67),
+        -INT8_C( 109),  INT8_C(  35),  INT8_C(  32),  INT8_C(  88),  INT8_C( 122), -INT8_C(  10),  INT8_C( 102),  INT8_C(  62) } },
+    { { -INT8_C(  49),  INT8_C(   7), -INT8_C(  10),  INT8_C(  63),  INT8_C(  98), -INT8_C(  95), -INT8_C(  10), -INT8_C(  73),
+         INT8_C(  53), -INT8_C( 124),  INT8_C(  56), -INT8_C( 105), -INT8_C( 117), -INT8_C(  72),  INT8_C(   3),  INT8_C(  34),
+         INT8_C( 100), -INT8_C(  78),  INT8_C(  62),  INT8_C( 120),  INT8_C( 101),  INT8_C( 121),  INT8_C(  45), -INT8_C(  84),
+         INT8_C(  13),  INT8_C(  97),  INT8_C(  43), -INT8_C(  31), -INT8_C(  23),  INT8_C( 126),  INT8_C(   5), -INT8_C(  47) },
+      {  INT8_C( 116), -INT8_C(  71),  INT8_C( 103),  INT8_C(  44),  INT8_C(  48), -INT8_C(  18),  INT8_C(  73),  INT8_C( 112),
+         INT8_C(  57),  INT8_C(  97), -INT8_C(  22),  INT8_C(  61),  INT8_C(  97), -INT8_C( 101),  INT8_C(  10), -INT8_C( 101),
+        -INT8_C(  48),  INT8_C(  76), -INT8_C(  44), -INT8_C(  16), -INT8_C(  12),  INT8_C(  10),  INT8_C(  52), -INT8_C(  17),
+        -INT8_C(  60), -INT8_C(  71),  INT8_C( 125),  INT8_C(  88),  INT8_C(  33), -INT8_C(  98), -INT8_C( 100), -INT8_C(  37) },
+      { -INT8_C(   2), -INT8_C( 117),  INT8_C(  96), -INT8_C(  65), -INT8_C( 102), -INT8_C(  79),  INT8_C(  50),  INT8_C(   5),
+        -INT8_C(  81),  INT8_C(  13), -INT8_C(  88), -INT8_C( 108),  INT8_C(  92),  INT8_C(  94),  INT8_C(  72),  INT8_C(  19),
+        -INT8_C( 109), -INT8_C(   6),  INT8_C(  37), -INT8_C(  50), -INT8_C(  71), -INT8_C(  27),  INT8_C(  95),  INT8_C(  83),
+         INT8_C(  19),  INT8_C(  74), -INT8_C(  49), -INT8_C(  55),  INT8_C(  63), -INT8_C(  87),  INT8_C(  68),  INT8_C(  35) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i b = simde_mm256_loadu_epi8(test_vec[i].b);
+    simde__m256i r = simde_mm256_aesenclast_epi128(a, b);
+    simde_test_x86_assert_equal_i8x32(r, simde_mm256_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_aesdeclast_epi128 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t a[32];
+    const int8_t b[32];
+    const int8_t r[32];
+  } test_vec[] = {
+    { { -INT8_C( 106),  INT8_C(  78),  INT8_C(  54), -INT8_C(  24), -INT8_C(  73), -INT8_C(  22), -INT8_C( 118), -INT8_C(  93),
+        -INT8_C(  25),  INT8_C(  78),  INT8_C(  93), -INT8_C( 103), -INT8_C(  23),  INT8_C( 120),  INT8_C(  74),  INT8_C(  62),
+         INT8_C(   3), -INT8_C( 108),  INT8_C( 124), -INT8_C(  66), -INT8_C(  73),  INT8_C(   9), -INT8_C(   8), -INT8_C(  32),
+         INT8_C(  51),  INT8_C(   0), -INT8_C(  84), -INT8_C(  45),  INT8_C(  97), -INT8_C(  92), -INT8_C(   6),  INT8_C(  99) },
+      { -INT8_C(  50),  INT8_C(   9), -INT8_C(  57),  INT8_C(  50),  INT8_C( 114), -INT8_C(  73),  INT8_C(  79),  INT8_C(   4),
+        -INT8_C( 101), -INT8_C(  97),  INT8_C(  92), -INT8_C( 124),  INT8_C(  25),  INT8_C(  21), -INT8_C( 119),  INT8_C(  26),
+         INT8_C(  91),  INT8_C(  10), -INT8_C(  25),  INT8_C(   4), -INT8_C(  78),  INT8_C( 115), -INT8_C(  25), -INT8_C(  73),
+        -INT8_C(  64),  INT8_C( 102),  INT8_C(  79), -INT8_C(  81),  INT8_C(  30),  INT8_C(  97),  INT8_C(  40), -INT8_C(  45) },
+      { -INT8_C(   5), -INT8_C(  56),  INT8_C(  74),  INT8_C(  67),  INT8_C(  82),  INT8_C(   1),  INT8_C(  19), -INT8_C(   3),
+         INT8_C(  43),  INT8_C(  36),  INT8_C( 120),  INT8_C(  85), -INT8_C(  14), -INT8_C(  93),  INT8_C(  70), -INT8_C(  46),
+        -INT8_C( 114),  INT8_C(  23),  INT8_C(  77), -INT8_C(  92), -INT8_C( 110), -INT8_C( 108), -INT8_C(  13),  INT8_C(  30),
+        -INT8_C(  90),  INT8_C(  38),  INT8_C(  78), -INT8_C(  81), -INT8_C(  58),  INT8_C(  51), -INT8_C(  55), -INT8_C( 119) } },
+    { { -INT8_C(  91), -INT8_C(  43),  INT8_C(  28),  INT8_C(   8),  INT8_C(  93), -INT8_C(  75),  INT8_C( 124), -INT8_C( 122),
+        -INT8_C(  79), -INT8_C(  94), -INT8_C( 114),  INT8_C(  52), -INT8_C( 121), -INT8_C(  48),  INT8_C(  68), -INT8_C(  39),
+         INT8_C(   8),  INT8_C(   4), -INT8_C(  30),  INT8_C(  22), -INT8_C(  44), -INT8_C(  58), -INT8_C(  19), -INT8_C( 108),
+        -INT8_C( 120),  INT8_C(  55),  INT8_C(  15), -INT8_C(  55),  INT8_C(  76), -INT8_C(  43), -INT8_C( 123),  INT8_C( 111) },
+      {  INT8_C(   4),  INT8_C(   7), -INT8_C(  24),  INT8_C(  40), -INT8_C(   9), -INT8_C(  50), -INT8_C(  35),  INT8_C(  64),
+        -INT8_C(  32),  INT8_C(  95), -INT8_C( 107), -INT8_C(  85),  INT8_C(  89), -INT8_C(  81),  INT8_C(  49), -INT8_C(  13),
+        -INT8_C(  58), -INT8_C(  48),  INT8_C(  44), -INT8_C(  58),  INT8_C(  34), -INT8_C(  30),  INT8_C(  54), -INT8_C( 114),
+         INT8_C(   0), -INT8_C(  23),  INT8_C(   3),  INT8_C(   1),  INT8_C(  47),  INT8_C(  42), -INT8_C(  53),  INT8_C(   1) },
+      {  INT8_C(  45),  INT8_C( 103),  INT8_C(  14), -INT8_C(  12),  INT8_C( 122),  INT8_C( 123),  INT8_C(  91),  INT8_C( 104),
+        -INT8_C(  74), -INT8_C( 115),  INT8_C(  81),  INT8_C(  78), -INT8_C(  77), -INT8_C(  75),  INT8_C(  48),  INT8_C(  76),
+         INT8_C( 121),  INT8_C( 101), -INT8_C(  41),  INT8_C(  33),  INT8_C(  59), -INT8_C(  46),  INT8_C(  81), -INT8_C( 100),
+        -INT8_C( 105),  INT8_C(  46),  INT8_C(  56),  INT8_C(   7),  INT8_C( 114), -INT8_C( 104), -INT8_C( 104), -INT8_C(   2) } },
+    { { -INT8_C(  66), -INT8_C(   5),  INT8_C(  11), -INT8_C(  86), -INT8_C( 108), -INT8_C(  30), -INT8_C(  46),  INT8_C(  57),
+         INT8_C(  87), -INT8_C(  62), -INT8_C(  78), -INT8_C(  62),  INT8_C(  48), -INT8_C(  11),  INT8_C( 125),      INT8_MIN,
+        -INT8_C(   1), -INT8_C(  25),  INT8_C(  95),  INT8_C(  58),  INT8_C(  54), -INT8_C(  38), -INT8_C(  78), -INT8_C(   1),
+        -INT8_C(  84),  INT8_C(  69),  INT8_C( 120), -INT8_C(  39), -INT8_C(  90),  INT8_C(  26),  INT8_C(  94),  INT8_C( 119) },
+      {  INT8_C(  61),  INT8_C(  52),  INT8_C(  29), -INT8_C(  19), -INT8_C(  56), -INT8_C( 115),  INT8_C(  57), -INT8_C(  75),
+        -INT8_C(  40),  INT8_C(  13), -INT8_C(  46), -INT8_C( 122),  INT8_C(  46),  INT8_C(  63), -INT8_C( 122), -INT8_C( 125),
+        -INT8_C(  96), -INT8_C(  90),  INT8_C(   7), -INT8_C(  31),  INT8_C( 112), -INT8_C(  13),  INT8_C(  18), -INT8_C(  61),
+         INT8_C(   2), -INT8_C( 127), -INT8_C(  17),  INT8_C(  78),  INT8_C(  94),  INT8_C(  98),  INT8_C(  81),  INT8_C(  11) },
+      {  INT8_C( 103),  INT8_C(  67),  INT8_C(  35), -INT8_C(  74),  INT8_C(  47), -INT8_C(  18),  INT8_C(  42),  INT8_C(  29),
+         INT8_C(   2),  INT8_C(  54),  INT8_C(  76), -INT8_C(  68),  INT8_C(  38), -INT8_C( 105), -INT8_C(   7), -INT8_C(  31),
+        -INT8_C(  35), -INT8_C(  27), -INT8_C(  58), -INT8_C( 100),  INT8_C(  84),  INT8_C(  67), -INT8_C( 113),  INT8_C(  38),
+        -INT8_C(  88), -INT8_C(   5),  INT8_C( 107),  INT8_C(  76), -INT8_C( 101),  INT8_C(  10),  INT8_C( 111), -INT8_C(  87) } },
+    { { -INT8_C(  49),  INT8_C(   7), -INT8_C(  10),  INT8_C(  63),  INT8_C(  98), -INT8_C(  95), -INT8_C(  10), -INT8_C(  73),
+         INT8_C(  53), -INT8_C( 124),  INT8_C(  56), -INT8_C( 105), -INT8_C( 117), -INT8_C(  72),  INT8_C(   3),  INT8_C(  34),
+         INT8_C( 100), -INT8_C(  78),  INT8_C(  62),  INT8_C( 120),  INT8_C( 101),  INT8_C( 121),  INT8_C(  45), -INT8_C(  84),
+         INT8_C(  13),  INT8_C(  97),  INT8_C(  43), -INT8_C(  31), -INT8_C(  23),  INT8_C( 126),  INT8_C(   5), -INT8_C(  47) },
+      {  INT8_C( 116), -INT8_C(  71),  INT8_C( 103),  INT8_C(  44),  INT8_C(  48), -INT8_C(  18),  INT8_C(  73),  INT8_C( 112),
+         INT8_C(  57),  INT8_C(  97), -INT8_C(  22),  INT8_C(  61),  INT8_C(  97), -INT8_C( 101),  INT8_C(  10), -INT8_C( 101),
+        -INT8_C(  48),  INT8_C(  76), -INT8_C(  44), -INT8_C(  16), -INT8_C(  12),  INT8_C(  10),  INT8_C(  52), -INT8_C(  17),
+        -INT8_C(  60), -INT8_C(  71),  INT8_C( 125),  INT8_C(  88),  INT8_C(  33), -INT8_C(  98), -INT8_C( 100), -INT8_C(  37) },
+      {  INT8_C(  43),  INT8_C(  35),  INT8_C(  17),  INT8_C(  12), -INT8_C( 101), -INT8_C(  42), -INT8_C( 100), -INT8_C(  11),
+        -INT8_C(  32), -INT8_C( 112),  INT8_C(  60), -INT8_C(  87), -INT8_C(  81), -INT8_C(  44), -INT8_C(  36), -INT8_C(  66),
+         INT8_C(  92), -INT8_C(  58), -INT8_C(  33),  INT8_C(  90),  INT8_C(  72),  INT8_C(  52),  INT8_C(   2),  INT8_C(  15),
+         INT8_C(  55),  INT8_C(  22), -INT8_C(  84),  INT8_C(   9), -INT8_C(  54),  INT8_C(  70),  INT8_C( 102),  INT8_C(  26) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i b = simde_mm256_loadu_epi8(test_vec[i].b);
+    simde__m256i r = simde_mm256_aesdeclast_epi128(a, b);
+    simde_test_x86_assert_equal_i8x32(r, simde_mm256_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_aesenc_epi128 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t a[64];
+    const int8_t b[64];
+    const int8_t r[64];
+  } test_vec[] = {
+    { { -INT8_C( 106),  INT8_C(  78),  INT8_C(  54), -INT8_C(  24), -INT8_C(  73), -INT8_C(  22), -INT8_C( 118), -INT8_C(  93),
+        -INT8_C(  25),  INT8_C(  78),  INT8_C(  93), -INT8_C( 103), -INT8_C(  23),  INT8_C( 120),  INT8_C(  74),  INT8_C(  62),
+         INT8_C(   3), -INT8_C( 108),  INT8_C( 124), -INT8_C(  66), -INT8_C(  73),  INT8_C(   9), -INT8_C(   8), -INT8_C(  32),
+         INT8_C(  51),  INT8_C(   0), -INT8_C(  84), -INT8_C(  45),  INT8_C(  97), -INT8_C(  92), -INT8_C(   6),  INT8_C(  99),
+        -INT8_C(  50),  INT8_C(   9), -INT8_C(  57),  INT8_C(  50),  INT8_C( 114), -INT8_C(  73),  INT8_C(  79),  INT8_C(   4),
+        -INT8_C( 101), -INT8_C(  97),  INT8_C(  92), -INT8_C( 124),  INT8_C(  25),  INT8_C(  21), -INT8_C( 119),  INT8_C(  26),
+         INT8_C(  91),  INT8_C(  10), -INT8_C(  25),  INT8_C(   4), -INT8_C(  78),  INT8_C( 115), -INT8_C(  25), -INT8_C(  73),
+        -INT8_C(  64),  INT8_C( 102),  INT8_C(  79), -INT8_C(  81),  INT8_C(  30),  INT8_C(  97),  INT8_C(  40), -INT8_C(  45) },
+      { -INT8_C(  91), -INT8_C(  43),  INT8_C(  28),  INT8_C(   8),  INT8_C(  93), -INT8_C(  75),  INT8_C( 124), -INT8_C( 122),
+        -INT8_C(  79), -INT8_C(  94), -INT8_C( 114),  INT8_C(  52), -INT8_C( 121), -INT8_C(  48),  INT8_C(  68), -INT8_C(  39),
+         INT8_C(   8),  INT8_C(   4), -INT8_C(  30),  INT8_C(  22), -INT8_C(  44), -INT8_C(  58), -INT8_C(  19), -INT8_C( 108),
+        -INT8_C( 120),  INT8_C(  55),  INT8_C(  15), -INT8_C(  55),  INT8_C(  76), -INT8_C(  43), -INT8_C( 123),  INT8_C( 111),
+         INT8_C(   4),  INT8_C(   7), -INT8_C(  24),  INT8_C(  40), -INT8_C(   9), -INT8_C(  50), -INT8_C(  35),  INT8_C(  64),
+        -INT8_C(  32),  INT8_C(  95), -INT8_C( 107), -INT8_C(  85),  INT8_C(  89), -INT8_C(  81),  INT8_C(  49), -INT8_C(  13),
+        -INT8_C(  58), -INT8_C(  48),  INT8_C(  44), -INT8_C(  58),  INT8_C(  34), -INT8_C(  30),  INT8_C(  54), -INT8_C( 114),
+         INT8_C(   0), -INT8_C(  23),  INT8_C(   3),  INT8_C(   1),  INT8_C(  47),  INT8_C(  42), -INT8_C(  53),  INT8_C(   1) },
+      { -INT8_C(  14),  INT8_C(  54),  INT8_C(  94),  INT8_C(  23),  INT8_C(  40), -INT8_C(  72), -INT8_C(   5), -INT8_C(  78),
+         INT8_C(  82),  INT8_C(  80), -INT8_C(  78),  INT8_C(  62),  INT8_C(  90), -INT8_C(   4), -INT8_C(  96),  INT8_C( 109),
+        -INT8_C( 105),  INT8_C(  46), -INT8_C(  73), -INT8_C(  26), -INT8_C(  69),  INT8_C( 112), -INT8_C( 108),  INT8_C( 125),
+         INT8_C(  63), -INT8_C(  73), -INT8_C(  99),  INT8_C(  23), -INT8_C(  56), -INT8_C(  37),  INT8_C(  96), -INT8_C(  22),
+         INT8_C(   1), -INT8_C(  71), -INT8_C(  93),  INT8_C(  18), -INT8_C( 123), -INT8_C(  14),  INT8_C( 118), -INT8_C(  70),
+         INT8_C(  23),  INT8_C(  90),  INT8_C(  66), -INT8_C(   9),  INT8_C(  50), -INT8_C(  79),  INT8_C(  22), -INT8_C(  81),
+        -INT8_C(  36),  INT8_C(  29),  INT8_C(  35),  INT8_C(  74), -INT8_C(  33),  INT8_C(  29),  INT8_C(  87),  INT8_C(  47),
+         INT8_C( 120), -INT8_C( 104), -INT8_C( 123), -INT8_C(  26), -INT8_C( 113),  INT8_C(  72),  INT8_C( 102), -INT8_C( 106) } },
+    { { -INT8_C(  66), -INT8_C(   5),  INT8_C(  11), -INT8_C(  86), -INT8_C( 108), -INT8_C(  30), -INT8_C(  46),  INT8_C(  57),
+         INT8_C(  87), -INT8_C(  62), -INT8_C(  78), -INT8_C(  62),  INT8_C(  48), -INT8_C(  11),  INT8_C( 125),      INT8_MIN,
+        -INT8_C(   1), -INT8_C(  25),  INT8_C(  95),  INT8_C(  58),  INT8_C(  54), -INT8_C(  38), -INT8_C(  78), -INT8_C(   1),
+        -INT8_C(  84),  INT8_C(  69),  INT8_C( 120), -INT8_C(  39), -INT8_C(  90),  INT8_C(  26),  INT8_C(  94),  INT8_C( 119),
+         INT8_C(  61),  INT8_C(  52),  INT8_C(  29), -INT8_C(  19), -INT8_C(  56), -INT8_C( 115),  INT8_C(  57), -INT8_C(  75),
+        -INT8_C(  40),  INT8_C(  13), -INT8_C(  46), -INT8_C( 122),  INT8_C(  46),  INT8_C(  63), -INT8_C( 122), -INT8_C( 125),
+        -INT8_C(  96), -INT8_C(  90),  INT8_C(   7), -INT8_C(  31),  INT8_C( 112), -INT8_C(  13),  INT8_C(  18), -INT8_C(  61),
+         INT8_C(   2), -INT8_C( 127), -INT8_C(  17),  INT8_C(  78),  INT8_C(  94),  INT8_C(  98),  INT8_C(  81),  INT8_C(  11) },
+      { -INT8_C(  49),  INT8_C(   7), -INT8_C(  10),  INT8_C(  63),  INT8_C(  98), -INT8_C(  95), -INT8_C(  10), -INT8_C(  73),
+         INT8_C(  53), -INT8_C( 124),  INT8_C(  56), -INT8_C( 105), -INT8_C( 117), -INT8_C(  72),  INT8_C(   3),  INT8_C(  34),
+         INT8_C( 100), -INT8_C(  78),  INT8_C(  62),  INT8_C( 120),  INT8_C( 101),  INT8_C( 121),  INT8_C(  45), -INT8_C(  84),
+         INT8_C(  13),  INT8_C(  97),  INT8_C(  43), -INT8_C(  31), -INT8_C(  23),  INT8_C( 126),  INT8_C(   5), -INT8_C(  47),
+         INT8_C( 116), -INT8_C(  71),  INT8_C( 103),  INT8_C(  44),  INT8_C(  48), -INT8_C(  18),  INT8_C(  73),  INT8_C( 112),
+         INT8_C(  57),  INT8_C(  97), -INT8_C(  22),  INT8_C(  61),  INT8_C(  97), -INT8_C( 101),  INT8_C(  10), -INT8_C( 101),
+        -INT8_C(  48),  INT8_C(  76), -INT8_C(  44), -INT8_C(  16), -INT8_C(  12),  INT8_C(  10),  INT8_C(  52), -INT8_C(  17),
+        -INT8_C(  60), -INT8_C(  71),  INT8_C( 125),  INT8_C(  88),  INT8_C(  33), -INT8_C(  98), -INT8_C( 100), -INT8_C(  37) },
+      { -INT8_C(  63),  INT8_C(  22), -INT8_C(  30), -INT8_C(   8),  INT8_C(  26),  INT8_C( 127), -INT8_C(   5),  INT8_C(  72),
+        -INT8_C( 117),  INT8_C( 103), -INT8_C(  27), -INT8_C( 109),  INT8_C(   2),  INT8_C(  67),  INT8_C(  22), -INT8_C(  34),
+        -INT8_C(   8),  INT8_C(  32),  INT8_C(  24),  INT8_C(  88),  INT8_C(   5), -INT8_C(  56),  INT8_C( 109), -INT8_C( 114),
+         INT8_C(  16), -INT8_C(  13), -INT8_C(  89),  INT8_C(   8),  INT8_C(   4),  INT8_C(   5), -INT8_C( 124),  INT8_C( 116),
+        -INT8_C( 124),  INT8_C(  12),  INT8_C(  67),  INT8_C( 110), -INT8_C( 120),  INT8_C(  42),  INT8_C(   1),  INT8_C( 106),
+         INT8_C(  21), -INT8_C(  56), -INT8_C(  55), -INT8_C(   2),  INT8_C( 125), -INT8_C(  24), -INT8_C(  53),  INT8_C(  74),
+        -INT8_C(  24), -INT8_C(  25), -INT8_C(  31),  INT8_C(  79),  INT8_C( 107), -INT8_C(  45), -INT8_C(  61),  INT8_C(  42),
+         INT8_C(  36), -INT8_C(   5),  INT8_C(  67), -INT8_C(  14),  INT8_C(  27), -INT8_C(  31),  INT8_C(  24),      INT8_MIN } },
+    { {  INT8_C(  91), -INT8_C( 122),  INT8_C(  42),  INT8_C(  85), -INT8_C(  55),  INT8_C(   6), -INT8_C(   6),  INT8_C( 124),
+        -INT8_C( 121),  INT8_C(   3),  INT8_C(  23), -INT8_C(  30), -INT8_C(  98), -INT8_C( 106), -INT8_C(  41),  INT8_C(  60),
+         INT8_C(  44),  INT8_C(  20), -INT8_C( 119),  INT8_C(  10),  INT8_C( 108),  INT8_C(  71),  INT8_C(  12),  INT8_C(  57),
+        -INT8_C(  90), -INT8_C( 103), -INT8_C(  10), -INT8_C(  52), -INT8_C(  67),  INT8_C(  23), -INT8_C(  90), -INT8_C(  52),
+        -INT8_C(  11),  INT8_C(  89),  INT8_C(  99), -INT8_C(  19), -INT8_C( 122), -INT8_C(  87),  INT8_C(  79),  INT8_C(  53),
+         INT8_C( 120),  INT8_C(  31),  INT8_C(   2), -INT8_C(  64), -INT8_C(  69),  INT8_C(  68), -INT8_C(  58), -INT8_C(  56),
+         INT8_C(  43),  INT8_C(  12), -INT8_C(   9),  INT8_C(  57), -INT8_C(  73),  INT8_C(  89), -INT8_C(  62),  INT8_C(  35),
+         INT8_C(   1),      INT8_MIN, -INT8_C(  72), -INT8_C(  44), -INT8_C(  40),  INT8_C(  16), -INT8_C(  53), -INT8_C(  63) },
+      { -INT8_C( 121),  INT8_C( 111), -INT8_C(  54), -INT8_C(  68),  INT8_C(  55), -INT8_C(   7),  INT8_C(  28), -INT8_C(  12),
+         INT8_C( 119),  INT8_C( 109), -INT8_C( 121),  INT8_C(   6), -INT8_C( 117), -INT8_C( 101), -INT8_C(  59), -INT8_C(  30),
+        -INT8_C(  76),  INT8_C( 117),  INT8_C(  80), -INT8_C( 107),  INT8_C(  98), -INT8_C(  72),  INT8_C( 122),  INT8_C(  65),
+        -INT8_C(  79),  INT8_C(  92), -INT8_C(  88), -INT8_C(  27),  INT8_C(  23), -INT8_C( 117), -INT8_C(   2),  INT8_C( 119),
+        -INT8_C(  69),  INT8_C(  47),  INT8_C(  14),  INT8_C(  47),      INT8_MIN, -INT8_C(  77),  INT8_C(  78), -INT8_C(  82),
+         INT8_C( 113),  INT8_C(   0), -INT8_C(  69),  INT8_C(  75), -INT8_C(  72), -INT8_C( 107), -INT8_C(  72), -INT8_C(  85),
+         INT8_C(  38),  INT8_C(  12),  INT8_C( 108),  INT8_C(  93),  INT8_C(  66),  INT8_C(  38),  INT8_C(   6), -INT8_C(  75),
+         INT8_C(  93), -INT8_C(  97),  INT8_C(  56), -INT8_C(  23), -INT8_C(  10),  INT8_C(  76),  INT8_C(  77), -INT8_C(  63) },
+      {  INT8_C(  95),  INT8_C( 104),  INT8_C(  65), -INT8_C(  91), -INT8_C(  23),  INT8_C(  60), -INT8_C(  71),  INT8_C(  30),
+         INT8_C(   7),  INT8_C( 101), -INT8_C(  31),  INT8_C( 106), -INT8_C(  28), -INT8_C(   9),  INT8_C(  99), -INT8_C(  67),
+        -INT8_C(  92), -INT8_C(  46), -INT8_C(  40),  INT8_C( 114), -INT8_C(  88),  INT8_C(  36),  INT8_C(  37), -INT8_C(  75),
+         INT8_C(  71),  INT8_C(  99),  INT8_C(  31), -INT8_C(   6),  INT8_C(  67),  INT8_C(  76),  INT8_C(  68),  INT8_C( 107),
+        -INT8_C(  99),  INT8_C(   5), -INT8_C(  10),  INT8_C( 113), -INT8_C(  78), -INT8_C(   2),  INT8_C(  70), -INT8_C(  68),
+         INT8_C(  82),  INT8_C(  10),  INT8_C(  80),  INT8_C(  67),  INT8_C(  15), -INT8_C(  33),  INT8_C(  95), -INT8_C(  82),
+        -INT8_C( 115), -INT8_C(  68),  INT8_C(   6),  INT8_C(   2),  INT8_C(  74),  INT8_C(  61),  INT8_C( 106), -INT8_C(  93),
+        -INT8_C(  82), -INT8_C(  14),  INT8_C(  52), -INT8_C( 125),  INT8_C(  64), -INT8_C(  19),  INT8_C(  64),  INT8_C(  41) } },
+    { { -INT8_C(  65), -INT8_C(  28), -INT8_C( 108),  INT8_C( 125), -INT8_C(  56),  INT8_C(  22), -INT8_C(  97), -INT8_C(  40),
+        -INT8_C( 126),  INT8_C(   9), -INT8_C(  35),  INT8_C(  43), -INT8_C(  72), -INT8_C( 110), -INT8_C( 122), -INT8_C(  85),
+        -INT8_C(  32),  INT8_C(  87),  INT8_C( 103),  INT8_C(  95),  INT8_C(   5),  INT8_C(  38),  INT8_C(  74),  INT8_C(  10),
+         INT8_C( 102), -INT8_C(  54),  INT8_C(  93), -INT8_C(  10), -INT8_C( 118), -INT8_C(  64),  INT8_C(  83), -INT8_C(  53),
+         INT8_C(  72), -INT8_C(   5), -INT8_C(  74), -INT8_C(   7),  INT8_C( 117),  INT8_C(  80), -INT8_C(  94),  INT8_C(  75),
+         INT8_C(  56),  INT8_C(  27), -INT8_C(  22),  INT8_C( 116), -INT8_C(  71),  INT8_C( 102), -INT8_C(  12), -INT8_C(  15),
+         INT8_C( 105),  INT8_C(  75),  INT8_C( 113), -INT8_C(  90),  INT8_C(  77),  INT8_C(  47), -INT8_C(  40),  INT8_C( 116),
+         INT8_C( 125),  INT8_C( 113),  INT8_C(  97),  INT8_C(  58), -INT8_C(  77),  INT8_C(   0), -INT8_C(  74), -INT8_C( 119) },
+      {  INT8_C(  10), -INT8_C(  81), -INT8_C(  80), -INT8_C(  46), -INT8_C(  95), -INT8_C(   6), -INT8_C(  85),  INT8_C(  87),
+        -INT8_C(  78), -INT8_C(  52), -INT8_C(  97), -INT8_C(  28),  INT8_C(  38), -INT8_C(  69),  INT8_C(  48),  INT8_C( 115),
+         INT8_C( 105),  INT8_C(  79), -INT8_C(  26),  INT8_C( 110),  INT8_C(  54), -INT8_C(  51), -INT8_C(  21),  INT8_C(  12),
+        -INT8_C(  78),  INT8_C( 123), -INT8_C(   3), -INT8_C(  48),  INT8_C(  92),  INT8_C(  56),  INT8_C(   0), -INT8_C(  46),
+         INT8_C(  18), -INT8_C(  27), -INT8_C(  78),  INT8_C(  63), -INT8_C(  18), -INT8_C(  91), -INT8_C(  19),  INT8_C(  27),
+         INT8_C(  24), -INT8_C(  82),  INT8_C(  55), -INT8_C(  65),  INT8_C(  61),  INT8_C(  37), -INT8_C(  58), -INT8_C(  96),
+         INT8_C(   8),  INT8_C(  85), -INT8_C(  15), -INT8_C(  69), -INT8_C( 101), -INT8_C(  69),  INT8_C(  11),  INT8_C( 109),
+        -INT8_C(  97),  INT8_C(  78), -INT8_C(  89),  INT8_C(  52), -INT8_C(  35), -INT8_C(  94),  INT8_C(  90),  INT8_C(   0) },
+      {  INT8_C( 112),  INT8_C(  19), -INT8_C(  64), -INT8_C( 120), -INT8_C(  46),  INT8_C(  35), -INT8_C(  48), -INT8_C(  44),
+         INT8_C(   6),  INT8_C(  70),  INT8_C(  36),  INT8_C( 126),  INT8_C( 111), -INT8_C( 126), -INT8_C( 112), -INT8_C( 116),
+        -INT8_C(  31), -INT8_C( 112),  INT8_C(  73), -INT8_C(  45),  INT8_C(  94), -INT8_C(  83),  INT8_C( 127), -INT8_C(  83),
+        -INT8_C(  29), -INT8_C(  44), -INT8_C(  52),  INT8_C( 116), -INT8_C(  39), -INT8_C(  45),  INT8_C(  84),  INT8_C(  89),
+         INT8_C( 101),  INT8_C(  34),  INT8_C(  94),  INT8_C(  68),  INT8_C(   3),  INT8_C(  62),  INT8_C(  10), -INT8_C(  98),
+        -INT8_C(  66), -INT8_C(  82),  INT8_C(  81), -INT8_C(  74),  INT8_C(  40), -INT8_C(  79),  INT8_C(  70),  INT8_C(  80),
+        -INT8_C( 106),  INT8_C(  11),  INT8_C(  42),  INT8_C(   4), -INT8_C(  46), -INT8_C(  13), -INT8_C(  69), -INT8_C(  10),
+        -INT8_C(  18),  INT8_C(  27), -INT8_C(  53), -INT8_C(  47),  INT8_C(  40), -INT8_C( 111), -INT8_C(  35),  INT8_C( 126) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi8(test_vec[i].b);
+    simde__m512i r = simde_mm512_aesenc_epi128(a, b);
+    simde_test_x86_assert_equal_i8x64(r, simde_mm512_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_aesdec_epi128 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t a[64];
+    const int8_t b[64];
+    const int8_t r[64];
+  } test_vec[] = {
+    { { -INT8_C( 106),  INT8_C(  78),  INT8_C(  54), -INT8_C(  24), -INT8_C(  73), -INT8_C(  22), -INT8_C( 118), -INT8_C(  93),
+        -INT8_C(  25),  INT8_C(  78),  INT8_C(  93), -INT8_C( 103), -INT8_C(  23),  INT8_C( 120),  INT8_C(  74),  INT8_C(  62),
+         INT8_C(   3), -INT8_C( 108),  INT8_C( 124), -INT8_C(  66), -INT8_C(  73),  INT8_C(   9), -INT8_C(   8), -INT8_C(  32),
+         INT8_C(  51),  INT8_C(   0), -INT8_C(  84), -INT8_C(  45),  INT8_C(  97), -INT8_C(  92), -INT8_C(   6),  INT8_C(  99),
+        -INT8_C(  50),  INT8_C(   9), -INT8_C(  57),  INT8_C(  50),  INT8_C( 114), -INT8_C(  73),  INT8_C(  79),  INT8_C(   4),
+        -INT8_C( 101), -INT8_C(  97),  INT8_C(  92), -INT8_C( 124),  INT8_C(  25),  INT8_C(  21), -INT8_C( 119),  INT8_C(  26),
+         INT8_C(  91),  INT8_C(  10), -INT8_C(  25),  INT8_C(   4), -INT8_C(  78),  INT8_C( 115), -INT8_C(  25), -INT8_C(  73),
+        -INT8_C(  64),  INT8_C( 102),  INT8_C(  79), -INT8_C(  81),  INT8_C(  30),  INT8_C(  97),  INT8_C(  40), -INT8_C(  45) },
+      { -INT8_C(  91), -INT8_C(  43),  INT8_C(  28),  INT8_C(   8),  INT8_C(  93), -INT8_C(  75),  INT8_C( 124), -INT8_C( 122),
+        -INT8_C(  79), -INT8_C(  94), -INT8_C( 114),  INT8_C(  52), -INT8_C( 121), -INT8_C(  48),  INT8_C(  68), -INT8_C(  39),
+         INT8_C(   8),  INT8_C(   4), -INT8_C(  30),  INT8_C(  22), -INT8_C(  44), -INT8_C(  58), -INT8_C(  19), -INT8_C( 108),
+        -INT8_C( 120),  INT8_C(  55),  INT8_C(  15), -INT8_C(  55),  INT8_C(  76), -INT8_C(  43), -INT8_C( 123),  INT8_C( 111),
+         INT8_C(   4),  INT8_C(   7), -INT8_C(  24),  INT8_C(  40), -INT8_C(   9), -INT8_C(  50), -INT8_C(  35),  INT8_C(  64),
+        -INT8_C(  32),  INT8_C(  95), -INT8_C( 107), -INT8_C(  85),  INT8_C(  89), -INT8_C(  81),  INT8_C(  49), -INT8_C(  13),
+        -INT8_C(  58), -INT8_C(  48),  INT8_C(  44), -INT8_C(  58),  INT8_C(  34), -INT8_C(  30),  INT8_C(  54), -INT8_C( 114),
+         INT8_C(   0), -INT8_C(  23),  INT8_C(   3),  INT8_C(   1),  INT8_C(  47),  INT8_C(  42), -INT8_C(  53),  INT8_C(   1) },
+      { -INT8_C(   3),  INT8_C(  50), -INT8_C(  20),  INT8_C(  79),  INT8_C(  17),  INT8_C(  91),  INT8_C(  42),  INT8_C(  65),
+         INT8_C(  62), -INT8_C(  64),  INT8_C( 114), -INT8_C(  37), -INT8_C(   6), -INT8_C(  53), -INT8_C(  87),  INT8_C(   8),
+         INT8_C(  57),  INT8_C(  38),  INT8_C(  51),  INT8_C(  22),  INT8_C(  54),  INT8_C( 120), -INT8_C(  49), -INT8_C( 112),
+         INT8_C(  33), -INT8_C(  22), -INT8_C( 113),  INT8_C(  26), -INT8_C(  35),  INT8_C( 120),  INT8_C(  79), -INT8_C(  88),
+             INT8_MIN, -INT8_C(  99), -INT8_C( 113),  INT8_C(   5),  INT8_C( 114),  INT8_C( 119),  INT8_C( 105),  INT8_C(  43),
+        -INT8_C(  41), -INT8_C(  41),  INT8_C(  20),  INT8_C(  47),  INT8_C( 109),  INT8_C(  34), -INT8_C(  92),  INT8_C(  12),
+         INT8_C(  99), -INT8_C(  97),  INT8_C(  54),  INT8_C(  11),  INT8_C(  85),  INT8_C(   8),  INT8_C(  65),  INT8_C(  12),
+         INT8_C(   3),  INT8_C(  45), -INT8_C(  90), -INT8_C(  22), -INT8_C(  48), -INT8_C( 125),  INT8_C(   2),  INT8_C(  36) } },
+    { { -INT8_C(  66), -INT8_C(   5),  INT8_C(  11), -INT8_C(  86), -INT8_C( 108), -INT8_C(  30), -INT8_C(  46),  INT8_C(  57),
+         INT8_C(  87), -INT8_C(  62), -INT8_C(  78), -INT8_C(  62),  INT8_C(  48), -INT8_C(  11),  INT8_C( 125),      INT8_MIN,
+        -INT8_C(   1), -INT8_C(  25),  INT8_C(  95),  INT8_C(  58),  INT8_C(  54), -INT8_C(  38), -INT8_C(  78), -INT8_C(   1),
+        -INT8_C(  84),  INT8_C(  69),  INT8_C( 120), -INT8_C(  39), -INT8_C(  90),  INT8_C(  26),  INT8_C(  94),  INT8_C( 119),
+         INT8_C(  61),  INT8_C(  52),  INT8_C(  29), -INT8_C(  19), -INT8_C(  56), -INT8_C( 115),  INT8_C(  57), -INT8_C(  75),
+        -INT8_C(  40),  INT8_C(  13), -INT8_C(  46), -INT8_C( 122),  INT8_C(  46),  INT8_C(  63), -INT8_C( 122), -INT8_C( 125),
+        -INT8_C(  96), -INT8_C(  90),  INT8_C(   7), -INT8_C(  31),  INT8_C( 112), -INT8_C(  13),  INT8_C(  18), -INT8_C(  61),
+         INT8_C(   2), -INT8_C( 127), -INT8_C(  17),  INT8_C(  78),  INT8_C(  94),  INT8_C(  98),  INT8_C(  81),  INT8_C(  11) },
+      { -INT8_C(  49),  INT8_C(   7), -INT8_C(  10),  INT8_C(  63),  INT8_C(  98), -INT8_C(  95), -INT8_C(  10), -INT8_C(  73),
+         INT8_C(  53), -INT8_C( 124),  INT8_C(  56), -INT8_C( 105), -INT8_C( 117), -INT8_C(  72),  INT8_C(   3),  INT8_C(  34),
+         INT8_C( 100), -INT8_C(  78),  INT8_C(  62),  INT8_C( 120),  INT8_C( 101),  INT8_C( 121),  INT8_C(  45), -INT8_C(  84),
+         INT8_C(  13),  INT8_C(  97),  INT8_C(  43), -INT8_C(  31), -INT8_C(  23),  INT8_C( 126),  INT8_C(   5), -INT8_C(  47),
+         INT8_C( 116), -INT8_C(  71),  INT8_C( 103),  INT8_C(  44),  INT8_C(  48), -INT8_C(  18),  INT8_C(  73),  INT8_C( 112),
+         INT8_C(  57),  INT8_C(  97), -INT8_C(  22),  INT8_C(  61),  INT8_C(  97), -INT8_C( 101),  INT8_C(  10), -INT8_C( 101),
+        -INT8_C(  48),  INT8_C(  76), -INT8_C(  44), -INT8_C(  16), -INT8_C(  12),  INT8_C(  10),  INT8_C(  52), -INT8_C(  17),
+        -INT8_C(  60), -INT8_C(  71),  INT8_C( 125),  INT8_C(  88),  INT8_C(  33), -INT8_C(  98), -INT8_C( 100), -INT8_C(  37) },
+      {  INT8_C( 122),  INT8_C( 108), -INT8_C(  73), -INT8_C(  24), -INT8_C(  73), -INT8_C(   1), -INT8_C(  87),  INT8_C(  92),
+         INT8_C( 102), -INT8_C(  79), -INT8_C(  91),  INT8_C(  41),  INT8_C(  61), -INT8_C( 126), -INT8_C(  93), -INT8_C(  77),
+         INT8_C(  93), -INT8_C(  24), -INT8_C(  92),  INT8_C(   3),  INT8_C( 109),  INT8_C(  17),  INT8_C(  95),  INT8_C(  82),
+         INT8_C( 116), -INT8_C(  41), -INT8_C(  48), -INT8_C( 125),  INT8_C(  14),  INT8_C(  29),  INT8_C( 123),  INT8_C(  26),
+         INT8_C(  94), -INT8_C(  62), -INT8_C(  65), -INT8_C(  90),  INT8_C(  58), -INT8_C(  11),  INT8_C(   7), -INT8_C(  74),
+        -INT8_C(  22), -INT8_C(  50), -INT8_C(  58),  INT8_C( 107),  INT8_C( 119),  INT8_C( 118), -INT8_C(  12), -INT8_C(  90),
+        -INT8_C(  11),  INT8_C(   7), -INT8_C(  80),  INT8_C(  68), -INT8_C(  87),  INT8_C( 120),  INT8_C( 116),  INT8_C(  83),
+             INT8_MIN, -INT8_C(  77),  INT8_C(  20), -INT8_C(  51),  INT8_C(  37), -INT8_C(  68), -INT8_C( 115),  INT8_C(  57) } },
+    { {  INT8_C(  91), -INT8_C( 122),  INT8_C(  42),  INT8_C(  85), -INT8_C(  55),  INT8_C(   6), -INT8_C(   6),  INT8_C( 124),
+        -INT8_C( 121),  INT8_C(   3),  INT8_C(  23), -INT8_C(  30), -INT8_C(  98), -INT8_C( 106), -INT8_C(  41),  INT8_C(  60),
+         INT8_C(  44),  INT8_C(  20), -INT8_C( 119),  INT8_C(  10),  INT8_C( 108),  INT8_C(  71),  INT8_C(  12),  INT8_C(  57),
+        -INT8_C(  90), -INT8_C( 103), -INT8_C(  10), -INT8_C(  52), -INT8_C(  67),  INT8_C(  23), -INT8_C(  90), -INT8_C(  52),
+        -INT8_C(  11),  INT8_C(  89),  INT8_C(  99), -INT8_C(  19), -INT8_C( 122), -INT8_C(  87),  INT8_C(  79),  INT8_C(  53),
+         INT8_C( 120),  INT8_C(  31),  INT8_C(   2), -INT8_C(  64), -INT8_C(  69),  INT8_C(  68), -INT8_C(  58), -INT8_C(  56),
+         INT8_C(  43),  INT8_C(  12), -INT8_C(   9),  INT8_C(  57), -INT8_C(  73),  INT8_C(  89), -INT8_C(  62),  INT8_C(  35),
+         INT8_C(   1),      INT8_MIN, -INT8_C(  72), -INT8_C(  44), -INT8_C(  40),  INT8_C(  16), -INT8_C(  53), -INT8_C(  63) },
+      { -INT8_C( 121),  INT8_C( 111), -INT8_C(  54), -INT8_C(  68),  INT8_C(  55), -INT8_C(   7),  INT8_C(  28), -INT8_C(  12),
+         INT8_C( 119),  INT8_C( 109), -INT8_C( 121),  INT8_C(   6), -INT8_C( 117), -INT8_C( 101), -INT8_C(  59), -INT8_C(  30),
+        -INT8_C(  76),  INT8_C( 117),  INT8_C(  80), -INT8_C( 107),  INT8_C(  98), -INT8_C(  72),  INT8_C( 122),  INT8_C(  65),
+        -INT8_C(  79),  INT8_C(  92), -INT8_C(  88), -INT8_C(  27),  INT8_C(  23), -INT8_C( 117), -INT8_C(   2),  INT8_C( 119),
+        -INT8_C(  69),  INT8_C(  47),  INT8_C(  14),  INT8_C(  47),      INT8_MIN, -INT8_C(  77),  INT8_C(  78), -INT8_C(  82),
+         INT8_C( 113),  INT8_C(   0), -INT8_C(  69),  INT8_C(  75), -INT8_C(  72), -INT8_C( 107), -INT8_C(  72), -INT8_C(  85),
+         INT8_C(  38),  INT8_C(  12),  INT8_C( 108),  INT8_C(  93),  INT8_C(  66),  INT8_C(  38),  INT8_C(   6), -INT8_C(  75),
+         INT8_C(  93), -INT8_C(  97),  INT8_C(  56), -INT8_C(  23), -INT8_C(  10),  INT8_C(  76),  INT8_C(  77), -INT8_C(  63) },
+      { -INT8_C(   4),  INT8_C( 112), -INT8_C(  78),  INT8_C(  68), -INT8_C(  89),  INT8_C(  84),  INT8_C( 120),  INT8_C(  85),
+        -INT8_C( 100), -INT8_C(  35),  INT8_C( 102),  INT8_C(  11),  INT8_C( 107),  INT8_C(  29),  INT8_C(  19), -INT8_C(  95),
+         INT8_C(  63),  INT8_C(  51), -INT8_C(  33), -INT8_C(  97), -INT8_C(  32), -INT8_C(  54),  INT8_C(  28),  INT8_C(  22),
+         INT8_C(  35),  INT8_C( 107),  INT8_C(   1), -INT8_C(  17),  INT8_C(  63),  INT8_C(  87), -INT8_C(  74), -INT8_C(  35),
+         INT8_C(  37),  INT8_C( 105),  INT8_C(   9), -INT8_C(  78),  INT8_C(  32), -INT8_C(  88), -INT8_C(  41), -INT8_C(  99),
+        -INT8_C(  48),  INT8_C( 127),  INT8_C(  78), -INT8_C(  89), -INT8_C( 110), -INT8_C(  81),  INT8_C(  13), -INT8_C(   6),
+        -INT8_C(  52), -INT8_C(   7), -INT8_C(  78),  INT8_C(  67),  INT8_C( 108), -INT8_C(  14), -INT8_C( 120),  INT8_C(  32),
+         INT8_C(  78),  INT8_C( 127), -INT8_C(  47),  INT8_C(  20),  INT8_C(  82),  INT8_C(  83), -INT8_C(  65),  INT8_C( 108) } },
+    { { -INT8_C(  65), -INT8_C(  28), -INT8_C( 108),  INT8_C( 125), -INT8_C(  56),  INT8_C(  22), -INT8_C(  97), -INT8_C(  40),
+        -INT8_C( 126),  INT8_C(   9), -INT8_C(  35),  INT8_C(  43), -INT8_C(  72), -INT8_C( 110), -INT8_C( 122), -INT8_C(  85),
+        -INT8_C(  32),  INT8_C(  87),  INT8_C( 103),  INT8_C(  95),  INT8_C(   5),  INT8_C(  38),  INT8_C(  74),  INT8_C(  10),
+         INT8_C( 102), -INT8_C(  54),  INT8_C(  93), -INT8_C(  10), -INT8_C( 118), -INT8_C(  64),  INT8_C(  83), -INT8_C(  53),
+         INT8_C(  72), -INT8_C(   5), -INT8_C(  74), -INT8_C(   7),  INT8_C( 117),  INT8_C(  80), -INT8_C(  94),  INT8_C(  75),
+         INT8_C(  56),  INT8_C(  27), -INT8_C(  22),  INT8_C( 116), -INT8_C(  71),  INT8_C( 102), -INT8_C(  12), -INT8_C(  15),
+         INT8_C( 105),  INT8_C(  75),  INT8_C( 113), -INT8_C(  90),  INT8_C(  77),  INT8_C(  47), -INT8_C(  40),  INT8_C( 116),
+         INT8_C( 125),  INT8_C( 113),  INT8_C(  97),  INT8_C(  58), -INT8_C(  77),  INT8_C(   0), -INT8_C(  74), -INT8_C( 119) },
+      {  INT8_C(  10), -INT8_C(  81), -INT8_C(  80), -INT8_C(  46), -INT8_C(  95), -INT8_C(   6), -INT8_C(  85),  INT8_C(  87),
+        -INT8_C(  78), -INT8_C(  52), -INT8_C(  97), -INT8_C(  28),  INT8_C(  38), -INT8_C(  69),  INT8_C(  48),  INT8_C( 115),
+         INT8_C( 105),  INT8_C(  79), -INT8_C(  26),  INT8_C( 110),  INT8_C(  54), -INT8_C(  51), -INT8_C(  21),  INT8_C(  12),
+        -INT8_C(  78),  INT8_C( 123), -INT8_C(   3), -INT8_C(  48),  INT8_C(  92),  INT8_C(  56),  INT8_C(   0), -INT8_C(  46),
+         INT8_C(  18), -INT8_C(  27), -INT8_C(  78),  INT8_C(  63), -INT8_C(  18), -INT8_C(  91), -INT8_C(  19),  INT8_C(  27),
+         INT8_C(  24), -INT8_C(  82),  INT8_C(  55), -INT8_C(  65),  INT8_C(  61),  INT8_C(  37), -INT8_C(  58), -INT8_C(  96),
+         INT8_C(   8),  INT8_C(  85), -INT8_C(  15), -INT8_C(  69), -INT8_C( 101), -INT8_C(  69),  INT8_C(  11),  INT8_C( 109),
+        -INT8_C(  97),  INT8_C(  78), -INT8_C(  89),  INT8_C(  52), -INT8_C(  35), -INT8_C(  94),  INT8_C(  90),  INT8_C(   0) },
+      {  INT8_C( 120), -INT8_C(  84),  INT8_C(  55),  INT8_C(  64),  INT8_C(  83), -INT8_C(  64), -INT8_C(  65),  INT8_C(  67),
+        -INT8_C(  82), -INT8_C(  43),  INT8_C( 123),  INT8_C(   2),  INT8_C(   6),  INT8_C(  24), -INT8_C(  79), -INT8_C(  42),
+         INT8_C( 109), -INT8_C(  36), -INT8_C(  10),  INT8_C( 120),  INT8_C(  87),  INT8_C(  63),  INT8_C(  56),  INT8_C(  38),
+         INT8_C(  31),  INT8_C(  53), -INT8_C(  44), -INT8_C(  71),  INT8_C( 115), -INT8_C(  23), -INT8_C(  78), -INT8_C( 103),
+        -INT8_C(  78),  INT8_C(  71), -INT8_C(  99),  INT8_C(  98),  INT8_C(  28), -INT8_C(  86), -INT8_C(  62), -INT8_C(  27),
+         INT8_C(  88), -INT8_C(  47), -INT8_C(  24),  INT8_C(  23),  INT8_C(  39), -INT8_C(  92), -INT8_C(  34), -INT8_C(  49),
+        -INT8_C( 104), -INT8_C(  83),  INT8_C(  14), -INT8_C( 120),  INT8_C(   8),  INT8_C( 106),  INT8_C(  96),  INT8_C(  54),
+         INT8_C(  61), -INT8_C(  11),  INT8_C(  39),  INT8_C(  46),  INT8_C(  64), -INT8_C(  98), -INT8_C(  92), -INT8_C(  48) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi8(test_vec[i].b);
+    simde__m512i r = simde_mm512_aesdec_epi128(a, b);
+    simde_test_x86_assert_equal_i8x64(r, simde_mm512_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_aesenclast_epi128 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t a[64];
+    const int8_t b[64];
+    const int8_t r[64];
+  } test_vec[] = {
+    { { -INT8_C( 106),  INT8_C(  78),  INT8_C(  54), -INT8_C(  24), -INT8_C(  73), -INT8_C(  22), -INT8_C( 118), -INT8_C(  93),
+        -INT8_C(  25),  INT8_C(  78),  INT8_C(  93), -INT8_C( 103), -INT8_C(  23),  INT8_C( 120),  INT8_C(  74),  INT8_C(  62),
+         INT8_C(   3), -INT8_C( 108),  INT8_C( 124), -INT8_C(  66), -INT8_C(  73),  INT8_C(   9), -INT8_C(   8), -INT8_C(  32),
+         INT8_C(  51),  INT8_C(   0), -INT8_C(  84), -INT8_C(  45),  INT8_C(  97), -INT8_C(  92), -INT8_C(   6),  INT8_C(  99),
+        -INT8_C(  50),  INT8_C(   9), -INT8_C(  57),  INT8_C(  50),  INT8_C( 114), -INT8_C(  73),  INT8_C(  79),  INT8_C(   4),
+        -INT8_C( 101), -INT8_C(  97),  INT8_C(  92), -INT8_C( 124),  INT8_C(  25),  INT8_C(  21), -INT8_C( 119),  INT8_C(  26),
+         INT8_C(  91),  INT8_C(  10), -INT8_C(  25),  INT8_C(   4), -INT8_C(  78),  INT8_C( 115), -INT8_C(  25), -INT8_C(  73),
+        -INT8_C(  64),  INT8_C( 102),  INT8_C(  79), -INT8_C(  81),  INT8_C(  30),  INT8_C(  97),  INT8_C(  40), -INT8_C(  45) },
+      { -INT8_C(  91), -INT8_C(  43),  INT8_C(  28),  INT8_C(   8),  INT8_C(  93), -INT8_C(  75),  INT8_C( 124), -INT8_C( 122),
+        -INT8_C(  79), -INT8_C(  94), -INT8_C( 114),  INT8_C(  52), -INT8_C( 121), -INT8_C(  48),  INT8_C(  68), -INT8_C(  39),
+         INT8_C(   8),  INT8_C(   4), -INT8_C(  30),  INT8_C(  22), -INT8_C(  44), -INT8_C(  58), -INT8_C(  19), -INT8_C( 108),
+        -INT8_C( 120),  INT8_C(  55),  INT8_C(  15), -INT8_C(  55),  INT8_C(  76), -INT8_C(  43), -INT8_C( 123),  INT8_C( 111),
+         INT8_C(   4),  INT8_C(   7), -INT8_C(  24),  INT8_C(  40), -INT8_C(   9), -INT8_C(  50), -INT8_C(  35),  INT8_C(  64),
+        -INT8_C(  32),  INT8_C(  95), -INT8_C( 107), -INT8_C(  85),  INT8_C(  89), -INT8_C(  81),  INT8_C(  49), -INT8_C(  13),
+        -INT8_C(  58), -INT8_C(  48),  INT8_C(  44), -INT8_C(  58),  INT8_C(  34), -INT8_C(  30),  INT8_C(  54), -INT8_C( 114),
+         INT8_C(   0), -INT8_C(  23),  INT8_C(   3),  INT8_C(   1),  INT8_C(  47),  INT8_C(  42), -INT8_C(  53),  INT8_C(   1) },
+      {  INT8_C(  53),  INT8_C(  82),  INT8_C(  80), -INT8_C(  70), -INT8_C(  12), -INT8_C( 102), -INT8_C(  86),  INT8_C(  29),
+         INT8_C(  37),  INT8_C(  30), -INT8_C( 117),  INT8_C(  62), -INT8_C( 103), -INT8_C(   1),  INT8_C(  58),  INT8_C(  55),
+         INT8_C( 115),  INT8_C(   5),  INT8_C( 115), -INT8_C(  19),  INT8_C( 125), -INT8_C(  91), -INT8_C(  64),  INT8_C(  58),
+         INT8_C(  75),  INT8_C( 126),  INT8_C(  31),  INT8_C(  40), -INT8_C(  93), -INT8_C(   9), -INT8_C(  60),  INT8_C(   9),
+        -INT8_C( 113), -INT8_C(  82), -INT8_C(  94), -INT8_C( 118), -INT8_C(  73),  INT8_C(  21),  INT8_C( 122),  INT8_C(  99),
+        -INT8_C(  12),  INT8_C(   6),  INT8_C(  83),  INT8_C(  89), -INT8_C( 115), -INT8_C(  82), -INT8_C(  75), -INT8_C(  84),
+        -INT8_C(   1),  INT8_C(  95), -INT8_C(  88), -INT8_C(  96),  INT8_C(  21), -INT8_C(  47),  INT8_C(   2),  INT8_C( 124),
+        -INT8_C(  70),  INT8_C(   6), -INT8_C( 105), -INT8_C(  88),  INT8_C(  93),  INT8_C(  77),  INT8_C(  95),  INT8_C( 120) } },
+    { { -INT8_C(  66), -INT8_C(   5),  INT8_C(  11), -INT8_C(  86), -INT8_C( 108), -INT8_C(  30), -INT8_C(  46),  INT8_C(  57),
+         INT8_C(  87), -INT8_C(  62), -INT8_C(  78), -INT8_C(  62),  INT8_C(  48), -INT8_C(  11),  INT8_C( 125),      INT8_MIN,
+        -INT8_C(   1), -INT8_C(  25),  INT8_C(  95),  INT8_C(  58),  INT8_C(  54), -INT8_C(  38), -INT8_C(  78), -INT8_C(   1),
+        -INT8_C(  84),  INT8_C(  69),  INT8_C( 120), -INT8_C(  39), -INT8_C(  90),  INT8_C(  26),  INT8_C(  94),  INT8_C( 119),
+         INT8_C(  61),  INT8_C(  52),  INT8_C(  29), -INT8_C(  19), -INT8_C(  56), -INT8_C( 115),  INT8_C(  57), -INT8_C(  75),
+        -INT8_C(  40),  INT8_C(  13), -INT8_C(  46), -INT8_C( 122),  INT8_C(  46),  INT8_C(  63), -INT8_C( 122), -INT8_C( 125),
+        -INT8_C(  96), -INT8_C(  90),  INT8_C(   7), -INT8_C(  31),  INT8_C( 112), -INT8_C(  13),  INT8_C(  18), -INT8_C(  61),
+         INT8_C(   2), -INT8_C( 127), -INT8_C(  17),  INT8_C(  78),  INT8_C(  94),  INT8_C(  98),  INT8_C(  81),  INT8_C(  11) },
+      { -INT8_C(  49),  INT8_C(   7), -INT8_C(  10),  INT8_C(  63),  INT8_C(  98), -INT8_C(  95), -INT8_C(  10), -INT8_C(  73),
+         INT8_C(  53), -INT8_C( 124),  INT8_C(  56), -INT8_C( 105), -INT8_C( 117), -INT8_C(  72),  INT8_C(   3),  INT8_C(  34),
+         INT8_C( 100), -INT8_C(  78),  INT8_C(  62),  INT8_C( 120),  INT8_C( 101),  INT8_C( 121),  INT8_C(  45), -INT8_C(  84),
+         INT8_C(  13),  INT8_C(  97),  INT8_C(  43), -INT8_C(  31), -INT8_C(  23),  INT8_C( 126),  INT8_C(   5), -INT8_C(  47),
+         INT8_C( 116), -INT8_C(  71),  INT8_C( 103),  INT8_C(  44),  INT8_C(  48), -INT8_C(  18),  INT8_C(  73),  INT8_C( 112),
+         INT8_C(  57),  INT8_C(  97), -INT8_C(  22),  INT8_C(  61),  INT8_C(  97), -INT8_C( 101),  INT8_C(  10), -INT8_C( 101),
+        -INT8_C(  48),  INT8_C(  76), -INT8_C(  44), -INT8_C(  16), -INT8_C(  12),  INT8_C(  10),  INT8_C(  52), -INT8_C(  17),
+        -INT8_C(  60), -INT8_C(  71),  INT8_C( 125),  INT8_C(  88),  INT8_C(  33), -INT8_C(  98), -INT8_C( 100), -INT8_C(  37) },
+      {  INT8_C(  97), -INT8_C(  97), -INT8_C(  63), -INT8_C(  14),  INT8_C(  64), -INT8_C( 124),  INT8_C(   9),  INT8_C(  27),
+         INT8_C( 110),  INT8_C(  98),  INT8_C(  19), -INT8_C( 123), -INT8_C( 113), -INT8_C(  73), -INT8_C(  74),  INT8_C(   7),
+         INT8_C( 114), -INT8_C(  27), -INT8_C( 126), -INT8_C( 115),  INT8_C(  96),  INT8_C(  23),  INT8_C( 117),  INT8_C(  44),
+        -INT8_C( 100), -INT8_C(  61), -INT8_C(  28), -INT8_C(   9), -INT8_C(  51), -INT8_C(  22),  INT8_C(  50), -INT8_C(  28),
+         INT8_C(  83), -INT8_C(  28), -INT8_C(  46), -INT8_C(  64), -INT8_C(  40),  INT8_C(  57),  INT8_C(  13),  INT8_C(  37),
+         INT8_C(  88),  INT8_C(  20),  INT8_C(  78), -INT8_C(  24),  INT8_C(  80), -INT8_C( 125),  INT8_C(  24), -INT8_C(  33),
+         INT8_C(  48),  INT8_C(  65),  INT8_C(  11), -INT8_C(  37), -INT8_C(  91),  INT8_C(   6), -INT8_C(  27),  INT8_C(  23),
+        -INT8_C(  77),  INT8_C(  19), -INT8_C(  72),  INT8_C( 118),  INT8_C( 121), -INT8_C(  70),  INT8_C(  85), -INT8_C(  12) } },
+    { {  INT8_C(  91), -INT8_C( 122),  INT8_C(  42),  INT8_C(  85), -INT8_C(  55),  INT8_C(   6), -INT8_C(   6),  INT8_C( 124),
+        -INT8_C( 121),  INT8_C(   3),  INT8_C(  23), -INT8_C(  30), -INT8_C(  98), -INT8_C( 106), -INT8_C(  41),  INT8_C(  60),
+         INT8_C(  44),  INT8_C(  20), -INT8_C( 119),  INT8_C(  10),  INT8_C( 108),  INT8_C(  71),  INT8_C(  12),  INT8_C(  57),
+        -INT8_C(  90), -INT8_C( 103), -INT8_C(  10), -INT8_C(  52), -INT8_C(  67),  INT8_C(  23), -INT8_C(  90), -INT8_C(  52),
+        -INT8_C(  11),  INT8_C(  89),  INT8_C(  99), -INT8_C(  19), -INT8_C( 122), -INT8_C(  87),  INT8_C(  79),  INT8_C(  53),
+         INT8_C( 120),  INT8_C(  31),  INT8_C(   2), -INT8_C(  64), -INT8_C(  69),  INT8_C(  68), -INT8_C(  58), -INT8_C(  56),
+         INT8_C(  43),  INT8_C(  12), -INT8_C(   9),  INT8_C(  57), -INT8_C(  73),  INT8_C(  89), -INT8_C(  62),  INT8_C(  35),
+         INT8_C(   1),      INT8_MIN, -INT8_C(  72), -INT8_C(  44), -INT8_C(  40),  INT8_C(  16), -INT8_C(  53), -INT8_C(  63) },
+      { -INT8_C( 121),  INT8_C( 111), -INT8_C(  54), -INT8_C(  68),  INT8_C(  55), -INT8_C(   7),  INT8_C(  28), -INT8_C(  12),
+         INT8_C( 119),  INT8_C( 109), -INT8_C( 121),  INT8_C(   6), -INT8_C( 117), -INT8_C( 101), -INT8_C(  59), -INT8_C(  30),
+        -INT8_C(  76),  INT8_C( 117),  INT8_C(  80), -INT8_C( 107),  INT8_C(  98), -INT8_C(  72),  INT8_C( 122),  INT8_C(  65),
+        -INT8_C(  79),  INT8_C(  92), -INT8_C(  88), -INT8_C(  27),  INT8_C(  23), -INT8_C( 117), -INT8_C(   2),  INT8_C( 119),
+        -INT8_C(  69),  INT8_C(  47),  INT8_C(  14),  INT8_C(  47),      INT8_MIN, -INT8_C(  77),  INT8_C(  78), -INT8_C(  82),
+         INT8_C( 113),  INT8_C(   0), -INT8_C(  69),  INT8_C(  75), -INT8_C(  72), -INT8_C( 107), -INT8_C(  72), -INT8_C(  85),
+         INT8_C(  38),  INT8_C(  12),  INT8_C( 108),  INT8_C(  93),  INT8_C(  66),  INT8_C(  38),  INT8_C(   6), -INT8_C(  75),
+         INT8_C(  93), -INT8_C(  97),  INT8_C(  56), -INT8_C(  23), -INT8_C(  10),  INT8_C(  76),  INT8_C(  77), -INT8_C(  63) },
+      { -INT8_C(  66),  INT8_C(   0),  INT8_C(  58),  INT8_C(  87), -INT8_C(  22), -INT8_C( 126),  INT8_C(  18),  INT8_C(   8),
+         INT8_C(  96), -INT8_C(   3),  INT8_C(  98),  INT8_C(  22),      INT8_MIN, -INT8_C(  33), -INT8_C(  24),  INT8_C( 122),
+        -INT8_C(  59), -INT8_C(  43),  INT8_C(  18), -INT8_C(  34),  INT8_C(  50),  INT8_C(  86),  INT8_C(  94),  INT8_C(  38),
+        -INT8_C( 107), -INT8_C(  84),  INT8_C(  15), -INT8_C(   9),  INT8_C( 109),  INT8_C( 113),  INT8_C(   0),  INT8_C(  60),
+         INT8_C(  93), -INT8_C(   4),  INT8_C( 121), -INT8_C(  57), -INT8_C(  60),  INT8_C( 115), -INT8_C(   6), -INT8_C(   5),
+        -INT8_C(  51),  INT8_C(  27),  INT8_C(  64), -INT8_C(  35),  INT8_C(  82),  INT8_C(  94),  INT8_C(  60),  INT8_C(  17),
+        -INT8_C(  41), -INT8_C(  57),  INT8_C(   0),  INT8_C(  37), -INT8_C(  21), -INT8_C(  21),  INT8_C(  25), -INT8_C(  89),
+         INT8_C(  33),  INT8_C(  85),  INT8_C(  80), -INT8_C(  49), -INT8_C( 105), -INT8_C(  78),  INT8_C( 104), -INT8_C( 119) } },
+    { { -INT8_C(  65), -INT8_C(  28), -INT8_C( 108),  INT8_C( 125), -INT8_C(  56),  INT8_C(  22), -INT8_C(  97), -INT8_C(  40),
+        -INT8_C( 126),  INT8_C(   9), -INT8_C(  35),  INT8_C(  43), -INT8_C(  72), -INT8_C( 110), -INT8_C( 122), -INT8_C(  85),
+        -INT8_C(  32),  INT8_C(  87),  INT8_C( 103),  INT8_C(  95),  INT8_C(   5),  INT8_C(  38),  INT8_C(  74),  INT8_C(  10),
+         INT8_C( 102), -INT8_C(  54),  INT8_C(  93), -INT8_C(  10), -INT8_C( 118), -INT8_C(  64),  INT8_C(  83), -INT8_C(  53),
+         INT8_C(  72), -INT8_C(   5), -INT8_C(  74), -INT8_C(   7),  INT8_C( 117),  INT8_C(  80), -INT8_C(  94),  INT8_C(  75),
+         INT8_C(  56),  INT8_C(  27), -INT8_C(  22),  INT8_C( 116), -INT8_C(  71),  INT8_C( 102), -INT8_C(  12), -INT8_C(  15),
+         INT8_C( 105),  INT8_C(  75),  INT8_C( 113), -INT8_C(  90),  INT8_C(  77),  INT8_C(  47), -INT8_C(  40),  INT8_C( 116),
+         INT8_C( 125),  INT8_C( 113),  INT8_C(  97),  INT8_C(  58), -INT8_C(  77),  INT8_C(   0), -INT8_C(  74), -INT8_C( 119) },
+      {  INT8_C(  10), -INT8_C(  81), -INT8_C(  80), -INT8_C(  46), -INT8_C(  95), -INT8_C(   6), -INT8_C(  85),  INT8_C(  87),
+        -INT8_C(  78), -INT8_C(  52), -INT8_C(  97), -INT8_C(  28),  INT8_C(  38), -INT8_C(  69),  INT8_C(  48),  INT8_C( 115),
+         INT8_C( 105),  INT8_C(  79), -INT8_C(  26),  INT8_C( 110),  INT8_C(  54), -INT8_C(  51), -INT8_C(  21),  INT8_C(  12),
+        -INT8_C(  78),  INT8_C( 123), -INT8_C(   3), -INT8_C(  48),  INT8_C(  92),  INT8_C(  56),  INT8_C(   0), -INT8_C(  46),
+         INT8_C(  18), -INT8_C(  27), -INT8_C(  78),  INT8_C(  63), -INT8_C(  18), -INT8_C(  91), -INT8_C(  19),  INT8_C(  27),
+         INT8_C(  24), -INT8_C(  82),  INT8_C(  55), -INT8_C(  65),  INT8_C(  61),  INT8_C(  37), -INT8_C(  58), -INT8_C(  96),
+         INT8_C(   8),  INT8_C(  85), -INT8_C(  15), -INT8_C(  69), -INT8_C( 101), -INT8_C(  69),  INT8_C(  11),  INT8_C( 109),
+        -INT8_C(  97),  INT8_C(  78), -INT8_C(  89),  INT8_C(  52), -INT8_C(  35), -INT8_C(  94),  INT8_C(  90),  INT8_C(   0) },
+      {  INT8_C(   2), -INT8_C(  24),  INT8_C( 113), -INT8_C(  80),  INT8_C(  73), -INT8_C(   5), -INT8_C(  17), -INT8_C(  88),
+        -INT8_C(  95), -INT8_C( 125), -INT8_C(  67), -INT8_C( 123),  INT8_C(  74), -INT8_C(  46), -INT8_C(  21), -INT8_C( 126),
+        -INT8_C( 120), -INT8_C(  72), -INT8_C(  86),  INT8_C( 113),  INT8_C(  93), -INT8_C(  71),  INT8_C(   6), -INT8_C(  61),
+        -INT8_C( 127), -INT8_C(  63),  INT8_C( 120), -INT8_C(  73),  INT8_C(  34),  INT8_C(  99), -INT8_C(  42), -INT8_C( 112),
+         INT8_C(  64), -INT8_C(  74),  INT8_C(  53), -INT8_C(  98),  INT8_C( 115),  INT8_C(  10),  INT8_C(  82), -INT8_C( 126),
+         INT8_C(  31), -INT8_C(  99),  INT8_C( 121),  INT8_C(  12),  INT8_C( 107),  INT8_C(  42), -INT8_C(   4),  INT8_C(  50),
+        -INT8_C(  15),  INT8_C(  64),  INT8_C(  30),  INT8_C(  28),  INT8_C( 120),  INT8_C(  24),  INT8_C(  69),  INT8_C(  73),
+         INT8_C(  96),  INT8_C(  45),  INT8_C(   4), -INT8_C(  90), -INT8_C(  80),  INT8_C(  17),  INT8_C(  59),      INT8_MIN } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi8(test_vec[i].b);
+    simde__m512i r = simde_mm512_aesenclast_epi128(a, b);
+    simde_test_x86_assert_equal_i8x64(r, simde_mm512_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_aesdeclast_epi128 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t a[64];
+    const int8_t b[64];
+    const int8_t r[64];
+  } test_vec[] = {
+    { { -INT8_C( 106),  INT8_C(  78),  INT8_C(  54), -INT8_C(  24), -INT8_C(  73), -INT8_C(  22), -INT8_C( 118), -INT8_C(  93),
+        -INT8_C(  25),  INT8_C(  78),  INT8_C(  93), -INT8_C( 103), -INT8_C(  23),  INT8_C( 120),  INT8_C(  74),  INT8_C(  62),
+         INT8_C(   3), -INT8_C( 108),  INT8_C( 124), -INT8_C(  66), -INT8_C(  73),  INT8_C(   9), -INT8_C(   8), -INT8_C(  32),
+         INT8_C(  51),  INT8_C(   0), -INT8_C(  84), -INT8_C(  45),  INT8_C(  97), -INT8_C(  92), -INT8_C(   6),  INT8_C(  99),
+        -INT8_C(  50),  INT8_C(   9), -INT8_C(  57),  INT8_C(  50),  INT8_C( 114), -INT8_C(  73),  INT8_C(  79),  INT8_C(   4),
+        -INT8_C( 101), -INT8_C(  97),  INT8_C(  92), -INT8_C( 124),  INT8_C(  25),  INT8_C(  21), -INT8_C( 119),  INT8_C(  26),
+         INT8_C(  91),  INT8_C(  10), -INT8_C(  25),  INT8_C(   4), -INT8_C(  78),  INT8_C( 115), -INT8_C(  25), -INT8_C(  73),
+        -INT8_C(  64),  INT8_C( 102),  INT8_C(  79), -INT8_C(  81),  INT8_C(  30),  INT8_C(  97),  INT8_C(  40), -INT8_C(  45) },
+      { -INT8_C(  91), -INT8_C(  43),  INT8_C(  28),  INT8_C(   8),  INT8_C(  93), -INT8_C(  75),  INT8_C( 124), -INT8_C( 122),
+        -INT8_C(  79), -INT8_C(  94), -INT8_C( 114),  INT8_C(  52), -INT8_C( 121), -INT8_C(  48),  INT8_C(  68), -INT8_C(  39),
+         INT8_C(   8),  INT8_C(   4), -INT8_C(  30),  INT8_C(  22), -INT8_C(  44), -INT8_C(  58), -INT8_C(  19), -INT8_C( 108),
+        -INT8_C( 120),  INT8_C(  55),  INT8_C(  15), -INT8_C(  55),  INT8_C(  76), -INT8_C(  43), -INT8_C( 123),  INT8_C( 111),
+         INT8_C(   4),  INT8_C(   7), -INT8_C(  24),  INT8_C(  40), -INT8_C(   9), -INT8_C(  50), -INT8_C(  35),  INT8_C(  64),
+        -INT8_C(  32),  INT8_C(  95), -INT8_C( 107), -INT8_C(  85),  INT8_C(  89), -INT8_C(  81),  INT8_C(  49), -INT8_C(  13),
+        -INT8_C(  58), -INT8_C(  48),  INT8_C(  44), -INT8_C(  58),  INT8_C(  34), -INT8_C(  30),  INT8_C(  54), -INT8_C( 114),
+         INT8_C(   0), -INT8_C(  23),  INT8_C(   3),  INT8_C(   1),  INT8_C(  47),  INT8_C(  42), -INT8_C(  53),  INT8_C(   1) },
+      { -INT8_C( 112),  INT8_C(  20), -INT8_C( 111),  INT8_C( 121),  INT8_C( 125),  INT8_C(   3),  INT8_C(  32),  INT8_C( 127),
+         INT8_C(   1),  INT8_C(  25), -INT8_C(  86), -INT8_C(  27),  INT8_C( 108),  INT8_C( 102), -INT8_C( 117),  INT8_C(  17),
+        -INT8_C(  35),  INT8_C(  25),  INT8_C(  72), -INT8_C(  74), -INT8_C(  12),  INT8_C(  33), -INT8_C(   7),  INT8_C(  61),
+        -INT8_C(  18),  INT8_C( 119),  INT8_C(  14), -INT8_C(  55), -INT8_C( 108), -INT8_C( 121),  INT8_C( 100),  INT8_C(  53),
+        -INT8_C(  24),  INT8_C(  40),  INT8_C(  79),  INT8_C(  24), -INT8_C(  23), -INT8_C( 114),  INT8_C(  47),  INT8_C(  15),
+         INT8_C(   8),  INT8_C( 127), -INT8_C(  92), -INT8_C(  24), -INT8_C(  41), -INT8_C(  63), -INT8_C(  93),  INT8_C(  82),
+        -INT8_C( 111),  INT8_C(   8), -INT8_C(  66), -INT8_C(  26),  INT8_C(  28),  INT8_C(  65), -INT8_C(  40), -INT8_C( 107),
+         INT8_C(  31),  INT8_C( 102), -INT8_C(  77), -INT8_C(  88), -INT8_C(  58), -INT8_C(   7),  INT8_C( 123),  INT8_C(  49) } },
+    { { -INT8_C(  66), -INT8_C(   5),  INT8_C(  11), -INT8_C(  86), -INT8_C( 108), -INT8_C(  30), -INT8_C(  46),  INT8_C(  57),
+         INT8_C(  87), -INT8_C(  62), -INT8_C(  78), -INT8_C(  62),  INT8_C(  48), -INT8_C(  11),  INT8_C( 125),      INT8_MIN,
+        -INT8_C(   1), -INT8_C(  25),  INT8_C(  95),  INT8_C(  58),  INT8_C(  54), -INT8_C(  38), -INT8_C(  78), -INT8_C(   1),
+        -INT8_C(  84),  INT8_C(  69),  INT8_C( 120), -INT8_C(  39), -INT8_C(  90),  INT8_C(  26),  INT8_C(  94),  INT8_C( 119),
+         INT8_C(  61),  INT8_C(  52),  INT8_C(  29), -INT8_C(  19), -INT8_C(  56), -INT8_C( 115),  INT8_C(  57), -INT8_C(  75),
+        -INT8_C(  40),  INT8_C(  13), -INT8_C(  46), -INT8_C( 122),  INT8_C(  46),  INT8_C(  63), -INT8_C( 122), -INT8_C( 125),
+        -INT8_C(  96), -INT8_C(  90),  INT8_C(   7), -INT8_C(  31),  INT8_C( 112), -INT8_C(  13),  INT8_C(  18), -INT8_C(  61),
+         INT8_C(   2), -INT8_C( 127), -INT8_C(  17),  INT8_C(  78),  INT8_C(  94),  INT8_C(  98),  INT8_C(  81),  INT8_C(  11) },
+      { -INT8_C(  49),  INT8_C(   7), -INT8_C(  10),  INT8_C(  63),  INT8_C(  98), -INT8_C(  95), -INT8_C(  10), -INT8_C(  73),
+         INT8_C(  53), -INT8_C( 124),  INT8_C(  56), -INT8_C( 105), -INT8_C( 117), -INT8_C(  72),  INT8_C(   3),  INT8_C(  34),
+         INT8_C( 100), -INT8_C(  78),  INT8_C(  62),  INT8_C( 120),  INT8_C( 101),  INT8_C( 121),  INT8_C(  45), -INT8_C(  84),
+         INT8_C(  13),  INT8_C(  97),  INT8_C(  43), -INT8_C(  31), -INT8_C(  23),  INT8_C( 126),  INT8_C(   5), -INT8_C(  47),
+         INT8_C( 116), -INT8_C(  71),  INT8_C( 103),  INT8_C(  44),  INT8_C(  48), -INT8_C(  18),  INT8_C(  73),  INT8_C( 112),
+         INT8_C(  57),  INT8_C(  97), -INT8_C(  22),  INT8_C(  61),  INT8_C(  97), -INT8_C( 101),  INT8_C(  10), -INT8_C( 101),
+        -INT8_C(  48),  INT8_C(  76), -INT8_C(  44), -INT8_C(  16), -INT8_C(  12),  INT8_C(  10),  INT8_C(  52), -INT8_C(  17),
+        -INT8_C(  60), -INT8_C(  71),  INT8_C( 125),  INT8_C(  88),  INT8_C(  33), -INT8_C(  98), -INT8_C( 100), -INT8_C(  37) },
+      { -INT8_C( 107),  INT8_C( 112), -INT8_C(  56),  INT8_C( 100), -INT8_C( 123), -INT8_C(  62), -INT8_C(  27),  INT8_C(  31),
+        -INT8_C(  17), -INT8_C(  65), -INT8_C(  90), -INT8_C(  83), -INT8_C( 125),  INT8_C(  16),  INT8_C( 124),  INT8_C(  64),
+         INT8_C(  25), -INT8_C(  15), -INT8_C(   1),  INT8_C(   5),  INT8_C(  65), -INT8_C(  55), -INT8_C(  80),  INT8_C(  73),
+        -INT8_C(  89),  INT8_C(  27), -INT8_C(  81), -INT8_C(  29),  INT8_C(  44),  INT8_C(  22),  INT8_C(  59),  INT8_C( 115),
+        -INT8_C(   1), -INT8_C( 100),  INT8_C(  24), -INT8_C(   2), -INT8_C( 127), -INT8_C(  58), -INT8_C( 107), -INT8_C(  84),
+         INT8_C(  20), -INT8_C(  43),  INT8_C(  52),  INT8_C( 124), -INT8_C(  94),  INT8_C( 104),  INT8_C(  81), -INT8_C(  56),
+        -INT8_C( 105), -INT8_C(  25), -INT8_C(  75), -INT8_C(  61),  INT8_C(  36), -INT8_C(  49),  INT8_C(  68),  INT8_C(  89),
+        -INT8_C(  82), -INT8_C(  57),  INT8_C(  69), -INT8_C(  58), -INT8_C(  68),  INT8_C(  15), -INT8_C(  91),  INT8_C(  59) } },
+    { {  INT8_C(  91), -INT8_C( 122),  INT8_C(  42),  INT8_C(  85), -INT8_C(  55),  INT8_C(   6), -INT8_C(   6),  INT8_C( 124),
+        -INT8_C( 121),  INT8_C(   3),  INT8_C(  23), -INT8_C(  30), -INT8_C(  98), -INT8_C( 106), -INT8_C(  41),  INT8_C(  60),
+         INT8_C(  44),  INT8_C(  20), -INT8_C( 119),  INT8_C(  10),  INT8_C( 108),  INT8_C(  71),  INT8_C(  12),  INT8_C(  57),
+        -INT8_C(  90), -INT8_C( 103), -INT8_C(  10), -INT8_C(  52), -INT8_C(  67),  INT8_C(  23), -INT8_C(  90), -INT8_C(  52),
+        -INT8_C(  11),  INT8_C(  89),  INT8_C(  99), -INT8_C(  19), -INT8_C( 122), -INT8_C(  87),  INT8_C(  79),  INT8_C(  53),
+         INT8_C( 120),  INT8_C(  31),  INT8_C(   2), -INT8_C(  64), -INT8_C(  69),  INT8_C(  68), -INT8_C(  58), -INT8_C(  56),
+         INT8_C(  43),  INT8_C(  12), -INT8_C(   9),  INT8_C(  57), -INT8_C(  73),  INT8_C(  89), -INT8_C(  62),  INT8_C(  35),
+         INT8_C(   1),      INT8_MIN, -INT8_C(  72), -INT8_C(  44), -INT8_C(  40),  INT8_C(  16), -INT8_C(  53), -INT8_C(  63) },
+      { -INT8_C( 121),  INT8_C( 111), -INT8_C(  54), -INT8_C(  68),  INT8_C(  55), -INT8_C(   7),  INT8_C(  28), -INT8_C(  12),
+         INT8_C( 119),  INT8_C( 109), -INT8_C( 121),  INT8_C(   6), -INT8_C( 117), -INT8_C( 101), -INT8_C(  59), -INT8_C(  30),
+        -INT8_C(  76),  INT8_C( 117),  INT8_C(  80), -INT8_C( 107),  INT8_C(  98), -INT8_C(  72),  INT8_C( 122),  INT8_C(  65),
+        -INT8_C(  79),  INT8_C(  92), -INT8_C(  88), -INT8_C(  27),  INT8_C(  23), -INT8_C( 117), -INT8_C(   2),  INT8_C( 119),
+        -INT8_C(  69),  INT8_C(  47),  INT8_C(  14),  INT8_C(  47),      INT8_MIN, -INT8_C(  77),  INT8_C(  78), -INT8_C(  82),
+         INT8_C( 113),  INT8_C(   0), -INT8_C(  69),  INT8_C(  75), -INT8_C(  72), -INT8_C( 107), -INT8_C(  72), -INT8_C(  85),
+         INT8_C(  38),  INT8_C(  12),  INT8_C( 108),  INT8_C(  93),  INT8_C(  66),  INT8_C(  38),  INT8_C(   6), -INT8_C(  75),
+         INT8_C(  93), -INT8_C(  97),  INT8_C(  56), -INT8_C(  23), -INT8_C(  10),  INT8_C(  76),  INT8_C(  77), -INT8_C(  63) },
+      { -INT8_C(  48),  INT8_C(  90),  INT8_C(  77), -INT8_C(  67),  INT8_C(  37),  INT8_C(  37),  INT8_C(  17), -INT8_C(  49),
+        -INT8_C(  99), -INT8_C(  56),  INT8_C(  18),  INT8_C( 107),  INT8_C(  84),  INT8_C(  78), -INT8_C(  47),  INT8_C(  15),
+        -INT8_C(  10), -INT8_C(  14), -INT8_C( 122), -INT8_C(  50), -INT8_C(  38),  INT8_C(  35), -INT8_C(  65),  INT8_C( 102),
+         INT8_C( 116),  INT8_C(  74),  INT8_C(  90), -INT8_C(  62), -INT8_C(  38),  INT8_C( 114),  INT8_C( 127), -INT8_C(  44),
+        -INT8_C(  52), -INT8_C(  87),  INT8_C( 100), -INT8_C(  10),  INT8_C(  92), -INT8_C(  90), -INT8_C( 119), -INT8_C(  79),
+        -INT8_C(  80), -INT8_C(  73), -INT8_C(  69), -INT8_C(   6),  INT8_C(  70),  INT8_C(  94),  INT8_C(  42), -INT8_C(   8),
+         INT8_C(  45),  INT8_C( 112), -INT8_C(  10),  INT8_C( 111),  INT8_C(  98), -INT8_C(  89),  INT8_C(  95), -INT8_C(  84),
+         INT8_C(  84), -INT8_C( 118),  INT8_C(  30),  INT8_C(  52), -INT8_C(  37),  INT8_C( 118), -INT8_C(  27), -INT8_C( 102) } },
+    { { -INT8_C(  65), -INT8_C(  28), -INT8_C( 108),  INT8_C( 125), -INT8_C(  56),  INT8_C(  22), -INT8_C(  97), -INT8_C(  40),
+        -INT8_C( 126),  INT8_C(   9), -INT8_C(  35),  INT8_C(  43), -INT8_C(  72), -INT8_C( 110), -INT8_C( 122), -INT8_C(  85),
+        -INT8_C(  32),  INT8_C(  87),  INT8_C( 103),  INT8_C(  95),  INT8_C(   5),  INT8_C(  38),  INT8_C(  74),  INT8_C(  10),
+         INT8_C( 102), -INT8_C(  54),  INT8_C(  93), -INT8_C(  10), -INT8_C( 118), -INT8_C(  64),  INT8_C(  83), -INT8_C(  53),
+         INT8_C(  72), -INT8_C(   5), -INT8_C(  74), -INT8_C(   7),  INT8_C( 117),  INT8_C(  80), -INT8_C(  94),  INT8_C(  75),
+         INT8_C(  56),  INT8_C(  27), -INT8_C(  22),  INT8_C( 116), -INT8_C(  71),  INT8_C( 102), -INT8_C(  12), -INT8_C(  15),
+         INT8_C( 105),  INT8_C(  75),  INT8_C( 113), -INT8_C(  90),  INT8_C(  77),  INT8_C(  47), -INT8_C(  40),  INT8_C( 116),
+         INT8_C( 125),  INT8_C( 113),  INT8_C(  97),  INT8_C(  58), -INT8_C(  77),  INT8_C(   0), -INT8_C(  74), -INT8_C( 119) },
+      {  INT8_C(  10), -INT8_C(  81), -INT8_C(  80), -INT8_C(  46), -INT8_C(  95), -INT8_C(   6), -INT8_C(  85),  INT8_C(  87),
+        -INT8_C(  78), -INT8_C(  52), -INT8_C(  97), -INT8_C(  28),  INT8_C(  38), -INT8_C(  69),  INT8_C(  48),  INT8_C( 115),
+         INT8_C( 105),  INT8_C(  79), -INT8_C(  26),  INT8_C( 110),  INT8_C(  54), -INT8_C(  51), -INT8_C(  21),  INT8_C(  12),
+        -INT8_C(  78),  INT8_C( 123), -INT8_C(   3), -INT8_C(  48),  INT8_C(  92),  INT8_C(  56),  INT8_C(   0), -INT8_C(  46),
+         INT8_C(  18), -INT8_C(  27), -INT8_C(  78),  INT8_C(  63), -INT8_C(  18), -INT8_C(  91), -INT8_C(  19),  INT8_C(  27),
+         INT8_C(  24), -INT8_C(  82),  INT8_C(  55), -INT8_C(  65),  INT8_C(  61),  INT8_C(  37), -INT8_C(  58), -INT8_C(  96),
+         INT8_C(   8),  INT8_C(  85), -INT8_C(  15), -INT8_C(  69), -INT8_C( 101), -INT8_C(  69),  INT8_C(  11),  INT8_C( 109),
+        -INT8_C(  97),  INT8_C(  78), -INT8_C(  89),  INT8_C(  52), -INT8_C(  35), -INT8_C(  94),  INT8_C(  90),  INT8_C(   0) },
+      { -INT8_C(   2), -INT8_C(  37),  INT8_C( 121), -INT8_C(   1),  INT8_C(  16),  INT8_C(  84),  INT8_C( 119),  INT8_C(  92),
+        -INT8_C(  93),  INT8_C(  51),  INT8_C( 120), -INT8_C(  22), -INT8_C(  68), -INT8_C(   5),  INT8_C(  94),  INT8_C(  96),
+        -INT8_C(  55),  INT8_C(  80),  INT8_C( 107), -INT8_C(  51),  INT8_C(   0),  INT8_C(  23), -INT8_C(  69), -INT8_C(  38),
+         INT8_C(  97),  INT8_C(  88), -INT8_C(   9), -INT8_C( 119), -INT8_C( 109),  INT8_C(  40),  INT8_C(  92),  INT8_C(  86),
+        -INT8_C(  58),  INT8_C(  54),  INT8_C(   9), -INT8_C(  13), -INT8_C(  47), -INT8_C(  58),  INT8_C(  87), -INT8_C(  47),
+         INT8_C( 110), -INT8_C(  62),  INT8_C(  78), -INT8_C( 108), -INT8_C(  26),  INT8_C(  97), -INT8_C(  36), -INT8_C(  55),
+        -INT8_C(  20),  INT8_C(   7),  INT8_C(  41),  INT8_C( 113), -INT8_C(   2),  INT8_C( 119),  INT8_C( 114), -INT8_C(  49),
+        -INT8_C( 116),  INT8_C(   0), -INT8_C( 117), -INT8_C(  58), -INT8_C( 106), -INT8_C( 114),  INT8_C( 119), -INT8_C(  59) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi8(test_vec[i].b);
+    simde__m512i r = simde_mm512_aesdeclast_epi128(a, b);
+    simde_test_x86_assert_equal_i8x64(r, simde_mm512_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+/* FIPS-197 appendix C.1-C.3 (AES-128/192/256) key schedules; the
+ * first block is the appendix C example. */
+static int
+test_simde_x_aes_encrypt_blocks (SIMDE_MUNIT_TEST_ARGS) {
+  static const uint8_t a[9][16] = {
+    { 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff },
+    { 0x9d, 0x8d, 0xbd, 0xad, 0xdd, 0xcd, 0xfd, 0xed, 0x1d, 0x0d, 0x3d, 0x2d, 0x5d, 0x4d, 0x7d, 0x6d },
+    { 0x3a, 0x29, 0x1c, 0x0f, 0x76, 0x65, 0x50, 0x43, 0xa2, 0xb1, 0x84, 0x97, 0xee, 0xfd, 0xc8, 0xdb },
+    { 0xd7, 0xc5, 0xf3, 0xed, 0x9f, 0x8d, 0xa3, 0xb5, 0x47, 0x55, 0x63, 0x4d, 0x3f, 0x2d, 0x13, 0x05 },
+    { 0x74, 0x61, 0x5e, 0x4b, 0x20, 0x35, 0x0a, 0x1f, 0xdc, 0xc9, 0xf6, 0xe3, 0x88, 0x9d, 0xa2, 0xb7 },
+    { 0x11, 0x05, 0x39, 0x2d, 0x41, 0x5d, 0x69, 0x45, 0xb1, 0xa5, 0x89, 0x9d, 0xe1, 0x8d, 0xb9, 0xa5 },
+    { 0xae, 0xb9, 0x80, 0x8f, 0xf2, 0xe5, 0xec, 0xf3, 0x16, 0x01, 0x38, 0x57, 0x2a, 0x3d, 0x14, 0x0b },
+    { 0x4b, 0x5d, 0x67, 0x6d, 0x13, 0x3d, 0x07, 0x0d, 0xfb, 0xed, 0xa7, 0xbd, 0xd3, 0xcd, 0xc7, 0xdd },
+    { 0xe8, 0xf1, 0xda, 0xc3, 0x8c, 0x95, 0xbe, 0xa7, 0x20, 0x39, 0x12, 0x0b, 0x44, 0x5d, 0x76, 0x6f },
+  };
+  static const struct {
+    int rounds;
+    uint8_t round_keys[15][16];
+    uint8_t r[9][16];
+  } test_vec[] = {
+    { INT32_C(10),
+      {
+        { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f },
+        { 0xd6, 0xaa, 0x74, 0xfd, 0xd2, 0xaf, 0x72, 0xfa, 0xda, 0xa6, 0x78, 0xf1, 0xd6, 0xab, 0x76, 0xfe },
+        { 0xb6, 0x92, 0xcf, 0x0b, 0x64, 0x3d, 0xbd, 0xf1, 0xbe, 0x9b, 0xc5, 0x00, 0x68, 0x30, 0xb3, 0xfe },
+        { 0xb6, 0xff, 0x74, 0x4e, 0xd2, 0xc2, 0xc9, 0xbf, 0x6c, 0x59, 0x0c, 0xbf, 0x04, 0x69, 0xbf, 0x41 },
+        { 0x47, 0xf7, 0xf7, 0xbc, 0x95, 0x35, 0x3e, 0x03, 0xf9, 0x6c, 0x32, 0xbc, 0xfd, 0x05, 0x8d, 0xfd },
+        { 0x3c, 0xaa, 0xa3, 0xe8, 0xa9, 0x9f, 0x9d, 0xeb, 0x50, 0xf3, 0xaf, 0x57, 0xad, 0xf6, 0x22, 0xaa },
+        { 0x5e, 0x39, 0x0f, 0x7d, 0xf7, 0xa6, 0x92, 0x96, 0xa7, 0x55, 0x3d, 0xc1, 0x0a, 0xa3, 0x1f, 0x6b },
+        { 0x14, 0xf9, 0x70, 0x1a, 0xe3, 0x5f, 0xe2, 0x8c, 0x44, 0x0a, 0xdf, 0x4d, 0x4e, 0xa9, 0xc0, 0x26 },
+        { 0x47, 0x43, 0x87, 0x35, 0xa4, 0x1c, 0x65, 0xb9, 0xe0, 0x16, 0xba, 0xf4, 0xae, 0xbf, 0x7a, 0xd2 },
+        { 0x54, 0x99, 0x32, 0xd1, 0xf0, 0x85, 0x57, 0x68, 0x10, 0x93, 0xed, 0x9c, 0xbe, 0x2c, 0x97, 0x4e },
+        { 0x13, 0x11, 0x1d, 0x7f, 0xe3, 0x94, 0x4a, 0x17, 0xf3, 0x07, 0xa7, 0x8b, 0x4d, 0x2b, 0x30, 0xc5 },
+      },
+      {
+        { 0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30, 0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a },
+        { 0xdf, 0xb3, 0x5a, 0x12, 0x01, 0xa0, 0x65, 0xf1, 0xc8, 0xdf, 0xe8, 0x6e, 0xb1, 0x20, 0xee, 0x21 },
+        { 0xa0, 0x76, 0x23, 0xd8, 0x0c, 0xd5, 0xa0, 0x3d, 0x93, 0x61, 0x06, 0x6a, 0xd4, 0x01, 0x09, 0xac },
+        { 0x4d, 0xde, 0x48, 0x76, 0x1f, 0xd6, 0x4b, 0x80, 0xa3, 0x9c, 0x69, 0xd0, 0xf3, 0x60, 0xed, 0x2a },
+        { 0x4f, 0x15, 0x9e, 0xe7, 0x86, 0x5a, 0xf7, 0xc2, 0x08, 0xe2, 0x06, 0x89, 0x37, 0x95, 0x95, 0x07 },
+        { 0x22, 0x81, 0x1c, 0xe1, 0x80, 0xba, 0x72, 0x1b, 0x26, 0x6e, 0x41, 0x9b, 0x6e, 0xc4, 0x5c, 0x6d },
+        { 0x70, 0x5c, 0xfd, 0xd4, 0x0f, 0x1a, 0x2f, 0x6f, 0x58, 0x20, 0xb2, 0x46, 0xa5, 0x66, 0x86, 0xae },
+        { 0x5b, 0xd9, 0xf9, 0xaf, 0x67, 0x5c, 0xf7, 0x25, 0x1e, 0x96, 0x18, 0x60, 0x81, 0x12, 0xde, 0x6b },
+        { 0x42, 0x47, 0xd8, 0xde, 0x72, 0x55, 0x74, 0x70, 0xe5, 0x99, 0xf2, 0x13, 0x7b, 0x0a, 0x22, 0x60 },
+      } },
+    { INT32_C(12),
+      {
+        { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f },
+        { 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x58, 0x46, 0xf2, 0xf9, 0x5c, 0x43, 0xf4, 0xfe },
+        { 0x54, 0x4a, 0xfe, 0xf5, 0x58, 0x47, 0xf0, 0xfa, 0x48, 0x56, 0xe2, 0xe9, 0x5c, 0x43, 0xf4, 0xfe },
+        { 0x40, 0xf9, 0x49, 0xb3, 0x1c, 0xba, 0xbd, 0x4d, 0x48, 0xf0, 0x43, 0xb8, 0x10, 0xb7, 0xb3, 0x42 },
+        { 0x58, 0xe1, 0x51, 0xab, 0x04, 0xa2, 0xa5, 0x55, 0x7e, 0xff, 0xb5, 0x41, 0x62, 0x45, 0x08, 0x0c },
+        { 0x2a, 0xb5, 0x4b, 0xb4, 0x3a, 0x02, 0xf8, 0xf6, 0x62, 0xe3, 0xa9, 0x5d, 0x66, 0x41, 0x0c, 0x08 },
+        { 0xf5, 0x01, 0x85, 0x72, 0x97, 0x44, 0x8d, 0x7e, 0xbd, 0xf1, 0xc6, 0xca, 0x87, 0xf3, 0x3e, 0x3c },
+        { 0xe5, 0x10, 0x97, 0x61, 0x83, 0x51, 0x9b, 0x69, 0x34, 0x15, 0x7c, 0x9e, 0xa3, 0x51, 0xf1, 0xe0 },
+        { 0x1e, 0xa0, 0x37, 0x2a, 0x99, 0x53, 0x09, 0x16, 0x7c, 0x43, 0x9e, 0x77, 0xff, 0x12, 0x05, 0x1e },
+        { 0xdd, 0x7e, 0x0e, 0x88, 0x7e, 0x2f, 0xff, 0x68, 0x60, 0x8f, 0xc8, 0x42, 0xf9, 0xdc, 0xc1, 0x54 },
+        { 0x85, 0x9f, 0x5f, 0x23, 0x7a, 0x8d, 0x5a, 0x3d, 0xc0, 0xc0, 0x29, 0x52, 0xbe, 0xef, 0xd6, 0x3a },
+        { 0xde, 0x60, 0x1e, 0x78, 0x27, 0xbc, 0xdf, 0x2c, 0xa2, 0x23, 0x80, 0x0f, 0xd8, 0xae, 0xda, 0x32 },
+        { 0xa4, 0x97, 0x0a, 0x33, 0x1a, 0x78, 0xdc, 0x09, 0xc4, 0x18, 0xc2, 0x71, 0xe3, 0xa4, 0x1d, 0x5d },
+      },
+      {
+        { 0xdd, 0xa9, 0x7c, 0xa4, 0x86, 0x4c, 0xdf, 0xe0, 0x6e, 0xaf, 0x70, 0xa0, 0xec, 0x0d, 0x71, 0x91 },
+        { 0x64, 0x77, 0x5e, 0xc7, 0x26, 0xe8, 0xe5, 0x8b, 0xdd, 0xaa, 0xca, 0x8e, 0xa2, 0x67, 0x67, 0x7d },
+        { 0xd0, 0x33, 0x62, 0x52, 0xe0, 0xce, 0x2e, 0x83, 0x22, 0x06, 0xb7, 0x43, 0x9c, 0x08, 0xd3, 0xc4 },
+        { 0xc6, 0xd5, 0x63, 0x82, 0xb0, 0xd4, 0x7b, 0x9f, 0x57, 0x3c, 0x48, 0xac, 0x6e, 0x57, 0x9f, 0x3e },
+        { 0x8a, 0x39, 0x3c, 0x63, 0xef, 0x37, 0x9d, 0x6d, 0x93, 0x8b, 0x8f, 0xcd, 0xa2, 0x3c, 0xe7, 0xfe },
+        { 0xd9, 0xc1, 0x87, 0x12, 0x68, 0xa1, 0x4c, 0xbd, 0x6d, 0x71, 0x16, 0x95, 0x05, 0xe8, 0xbc, 0x40 },
+        { 0x1a, 0xb1, 0x8c, 0xbf, 0x0a, 0xc5, 0xd7, 0x3d, 0x54, 0xf6, 0x4a, 0x1b, 0x2a, 0xb8, 0xf7, 0x94 },
+        { 0x13, 0xc5, 0x11, 0xa1, 0x83, 0xe0, 0x45, 0x73, 0x5c, 0x99, 0xc1, 0x49, 0x5b, 0x79, 0x69, 0xdf },
+        { 0x6c, 0x46, 0xce, 0xb2, 0x05, 0x04, 0x14, 0x14, 0x0c, 0xbb, 0x51, 0xa1, 0x15, 0x43, 0xa8, 0x0c },
+      } },
+    { INT32_C(14),
+      {
+        { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f },
+        { 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f },
+        { 0xa5, 0x73, 0xc2, 0x9f, 0xa1, 0x76, 0xc4, 0x98, 0xa9, 0x7f, 0xce, 0x93, 0xa5, 0x72, 0xc0, 0x9c },
+        { 0x16, 0x51, 0xa8, 0xcd, 0x02, 0x44, 0xbe, 0xda, 0x1a, 0x5d, 0xa4, 0xc1, 0x06, 0x40, 0xba, 0xde },
+        { 0xae, 0x87, 0xdf, 0xf0, 0x0f, 0xf1, 0x1b, 0x68, 0xa6, 0x8e, 0xd5, 0xfb, 0x03, 0xfc, 0x15, 0x67 },
+        { 0x6d, 0xe1, 0xf1, 0x48, 0x6f, 0xa5, 0x4f, 0x92, 0x75, 0xf8, 0xeb, 0x53, 0x73, 0xb8, 0x51, 0x8d },
+        { 0xc6, 0x56, 0x82, 0x7f, 0xc9, 0xa7, 0x99, 0x17, 0x6f, 0x29, 0x4c, 0xec, 0x6c, 0xd5, 0x59, 0x8b },
+        { 0x3d, 0xe2, 0x3a, 0x75, 0x52, 0x47, 0x75, 0xe7, 0x27, 0xbf, 0x9e, 0xb4, 0x54, 0x07, 0xcf, 0x39 },
+        { 0x0b, 0xdc, 0x90, 0x5f, 0xc2, 0x7b, 0x09, 0x48, 0xad, 0x52, 0x45, 0xa4, 0xc1, 0x87, 0x1c, 0x2f },
+        { 0x45, 0xf5, 0xa6, 0x60, 0x17, 0xb2, 0xd3, 0x87, 0x30, 0x0d, 0x4d, 0x33, 0x64, 0x0a, 0x82, 0x0a },
+        { 0x7c, 0xcf, 0xf7, 0x1c, 0xbe, 0xb4, 0xfe, 0x54, 0x13, 0xe6, 0xbb, 0xf0, 0xd2, 0x61, 0xa7, 0xdf },
+        { 0xf0, 0x1a, 0xfa, 0xfe, 0xe7, 0xa8, 0x29, 0x79, 0xd7, 0xa5, 0x64, 0x4a, 0xb3, 0xaf, 0xe6, 0x40 },
+        { 0x25, 0x41, 0xfe, 0x71, 0x9b, 0xf5, 0x00, 0x25, 0x88, 0x13, 0xbb, 0xd5, 0x5a, 0x72, 0x1c, 0x0a },
+        { 0x4e, 0x5a, 0x66, 0x99, 0xa9, 0xf2, 0x4f, 0xe0, 0x7e, 0x57, 0x2b, 0xaa, 0xcd, 0xf8, 0xcd, 0xea },
+        { 0x24, 0xfc, 0x79, 0xcc, 0xbf, 0x09, 0x79, 0xe9, 0x37, 0x1a, 0xc2, 0x3c, 0x6d, 0x68, 0xde, 0x36 },
+      },
+      {
+        { 0x8e, 0xa2, 0xb7, 0xca, 0x51, 0x67, 0x45, 0xbf, 0xea, 0xfc, 0x49, 0x90, 0x4b, 0x49, 0x60, 0x89 },
+        { 0xc4, 0xac, 0x2a, 0x9e, 0xe6, 0x9e, 0x79, 0x88, 0xa1, 0xb6, 0x06, 0x1d, 0xa7, 0xf2, 0x4c, 0x38 },
+        { 0x9f, 0xfa, 0x77, 0x86, 0x75, 0xac, 0x84, 0x18, 0x37, 0xfb, 0xb5, 0xa2, 0xb5, 0x17, 0x8c, 0x6d },
+        { 0xde, 0x00, 0xc5, 0x85, 0xe5, 0x1a, 0xfc, 0x80, 0xf5, 0xd8, 0xca, 0x8c, 0xe9, 0xcf, 0xf4, 0x3a },
+        { 0xab, 0xb0, 0x44, 0x72, 0xd7, 0x2f, 0xd8, 0x2a, 0x4b, 0x0e, 0x52, 0x76, 0x04, 0xe5, 0x7c, 0x0f },
+        { 0xa0, 0xe6, 0x51, 0x08, 0xbf, 0xc7, 0x43, 0x53, 0x7b, 0x81, 0x10, 0xa9, 0x38, 0x52, 0x22, 0x31 },
+        { 0x8d, 0xb7, 0x89, 0x7c, 0x96, 0x47, 0x29, 0xca, 0xd1, 0xc8, 0x06, 0xcf, 0x99, 0xc9, 0x36, 0x89 },
+        { 0xdb, 0x28, 0x48, 0xa4, 0x98, 0x2a, 0x95, 0x8e, 0x79, 0x37, 0xbd, 0x6e, 0x17, 0x4a, 0xd2, 0x95 },
+        { 0x32, 0x2f, 0x8b, 0x81, 0x99, 0xe5, 0x1c, 0x63, 0x7c, 0xa4, 0x65, 0x94, 0xbb, 0x13, 0x1e, 0x4c },
+      } },
+  };
+
+  for (size_t t = 0 ; t < (sizeof(test_vec) / sizeof(test_vec[0])) ; t++) {
+    simde__m128i k[15], b[9];
+
+    for (int i = 0 ; i <= test_vec[t].rounds ; i++)
+      k[i] = simde_mm_loadu_si128(test_vec[t].round_keys[i]);
+
+    /* Every count up to one full batch plus one, so both the bitsliced
+     * and the single-block paths get exercised. */
+    for (size_t n = 0 ; n <= (sizeof(a) / sizeof(a[0])) ; n++) {
+      for (size_t i = 0 ; i < n ; i++)
+        b[i] = simde_mm_loadu_si128(a[i]);
+      simde_x_aes_encrypt_blocks(b, n, k, test_vec[t].rounds);
+      for (size_t i = 0 ; i < n ; i++)
+        simde_test_x86_assert_equal_u8x16(b[i], simde_mm_loadu_si128(test_vec[t].r[i]));
+    }
+  }
+
+  return 0;
+}
+
+/* The same keys as equivalent inverse cipher key schedules, decrypting
+ * the ciphertexts from the encryption test. */
+static int
+test_simde_x_aes_decrypt_blocks (SIMDE_MUNIT_TEST_ARGS) {
+  static const uint8_t r[9][16] = {
+    { 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff },
+    { 0x9d, 0x8d, 0xbd, 0xad, 0xdd, 0xcd, 0xfd, 0xed, 0x1d, 0x0d, 0x3d, 0x2d, 0x5d, 0x4d, 0x7d, 0x6d },
+    { 0x3a, 0x29, 0x1c, 0x0f, 0x76, 0x65, 0x50, 0x43, 0xa2, 0xb1, 0x84, 0x97, 0xee, 0xfd, 0xc8, 0xdb },
+    { 0xd7, 0xc5, 0xf3, 0xed, 0x9f, 0x8d, 0xa3, 0xb5, 0x47, 0x55, 0x63, 0x4d, 0x3f, 0x2d, 0x13, 0x05 },
+    { 0x74, 0x61, 0x5e, 0x4b, 0x20, 0x35, 0x0a, 0x1f, 0xdc, 0xc9, 0xf6, 0xe3, 0x88, 0x9d, 0xa2, 0xb7 },
+    { 0x11, 0x05, 0x39, 0x2d, 0x41, 0x5d, 0x69, 0x45, 0xb1, 0xa5, 0x89, 0x9d, 0xe1, 0x8d, 0xb9, 0xa5 },
+    { 0xae, 0xb9, 0x80, 0x8f, 0xf2, 0xe5, 0xec, 0xf3, 0x16, 0x01, 0x38, 0x57, 0x2a, 0x3d, 0x14, 0x0b },
+    { 0x4b, 0x5d, 0x67, 0x6d, 0x13, 0x3d, 0x07, 0x0d, 0xfb, 0xed, 0xa7, 0xbd, 0xd3, 0xcd, 0xc7, 0xdd },
+    { 0xe8, 0xf1, 0xda, 0xc3, 0x8c, 0x95, 0xbe, 0xa7, 0x20, 0x39, 0x12, 0x0b, 0x44, 0x5d, 0x76, 0x6f },
+  };
+  static const struct {
+    int rounds;
+    uint8_t round_keys[15][16];
+    uint8_t a[9][16];
+  } test_vec[] = {
+    { INT32_C(10),
+      {
+        { 0x13, 0x11, 0x1d, 0x7f, 0xe3, 0x94, 0x4a, 0x17, 0xf3, 0x07, 0xa7, 0x8b, 0x4d, 0x2b, 0x30, 0xc5 },
+        { 0x13, 0xaa, 0x29, 0xbe, 0x9c, 0x8f, 0xaf, 0xf6, 0xf7, 0x70, 0xf5, 0x80, 0x00, 0xf7, 0xbf, 0x03 },
+        { 0x13, 0x62, 0xa4, 0x63, 0x8f, 0x25, 0x86, 0x48, 0x6b, 0xff, 0x5a, 0x76, 0xf7, 0x87, 0x4a, 0x83 },
+        { 0x8d, 0x82, 0xfc, 0x74, 0x9c, 0x47, 0x22, 0x2b, 0xe4, 0xda, 0xdc, 0x3e, 0x9c, 0x78, 0x10, 0xf5 },
+        { 0x72, 0xe3, 0x09, 0x8d, 0x11, 0xc5, 0xde, 0x5f, 0x78, 0x9d, 0xfe, 0x15, 0x78, 0xa2, 0xcc, 0xcb },
+        { 0x2e, 0xc4, 0x10, 0x27, 0x63, 0x26, 0xd7, 0xd2, 0x69, 0x58, 0x20, 0x4a, 0x00, 0x3f, 0x32, 0xde },
+        { 0xa8, 0xa2, 0xf5, 0x04, 0x4d, 0xe2, 0xc7, 0xf5, 0x0a, 0x7e, 0xf7, 0x98, 0x69, 0x67, 0x12, 0x94 },
+        { 0xc7, 0xc6, 0xe3, 0x91, 0xe5, 0x40, 0x32, 0xf1, 0x47, 0x9c, 0x30, 0x6d, 0x63, 0x19, 0xe5, 0x0c },
+        { 0xa0, 0xdb, 0x02, 0x99, 0x22, 0x86, 0xd1, 0x60, 0xa2, 0xdc, 0x02, 0x9c, 0x24, 0x85, 0xd5, 0x61 },
+        { 0x8c, 0x56, 0xdf, 0xf0, 0x82, 0x5d, 0xd3, 0xf9, 0x80, 0x5a, 0xd3, 0xfc, 0x86, 0x59, 0xd7, 0xfd },
+        { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f },
+      },
+      {
+        { 0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30, 0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a },
+        { 0xdf, 0xb3, 0x5a, 0x12, 0x01, 0xa0, 0x65, 0xf1, 0xc8, 0xdf, 0xe8, 0x6e, 0xb1, 0x20, 0xee, 0x21 },
+        { 0xa0, 0x76, 0x23, 0xd8, 0x0c, 0xd5, 0xa0, 0x3d, 0x93, 0x61, 0x06, 0x6a, 0xd4, 0x01, 0x09, 0xac },
+        { 0x4d, 0xde, 0x48, 0x76, 0x1f, 0xd6, 0x4b, 0x80, 0xa3, 0x9c, 0x69, 0xd0, 0xf3, 0x60, 0xed, 0x2a },
+        { 0x4f, 0x15, 0x9e, 0xe7, 0x86, 0x5a, 0xf7, 0xc2, 0x08, 0xe2, 0x06, 0x89, 0x37, 0x95, 0x95, 0x07 },
+        { 0x22, 0x81, 0x1c, 0xe1, 0x80, 0xba, 0x72, 0x1b, 0x26, 0x6e, 0x41, 0x9b, 0x6e, 0xc4, 0x5c, 0x6d },
+        { 0x70, 0x5c, 0xfd, 0xd4, 0x0f, 0x1a, 0x2f, 0x6f, 0x58, 0x20, 0xb2, 0x46, 0xa5, 0x66, 0x86, 0xae },
+        { 0x5b, 0xd9, 0xf9, 0xaf, 0x67, 0x5c, 0xf7, 0x25, 0x1e, 0x96, 0x18, 0x60, 0x81, 0x12, 0xde, 0x6b },
+        { 0x42, 0x47, 0xd8, 0xde, 0x72, 0x55, 0x74, 0x70, 0xe5, 0x99, 0xf2, 0x13, 0x7b, 0x0a, 0x22, 0x60 },
+      } },
+    { INT32_C(12),
+      {
+        { 0xa4, 0x97, 0x0a, 0x33, 0x1a, 0x78, 0xdc, 0x09, 0xc4, 0x18, 0xc2, 0x71, 0xe3, 0xa4, 0x1d, 0x5d },
+        { 0xd6, 0xbe, 0xbd, 0x0d, 0xc2, 0x09, 0xea, 0x49, 0x4d, 0xb0, 0x73, 0x80, 0x3e, 0x02, 0x1b, 0xb9 },
+        { 0x8f, 0xb9, 0x99, 0xc9, 0x73, 0xb2, 0x68, 0x39, 0xc7, 0xf9, 0xd8, 0x9d, 0x85, 0xc6, 0x8c, 0x72 },
+        { 0xf7, 0x7d, 0x6e, 0xc1, 0x42, 0x3f, 0x54, 0xef, 0x53, 0x78, 0x31, 0x7f, 0x14, 0xb7, 0x57, 0x44 },
+        { 0x11, 0x47, 0x65, 0x90, 0x47, 0xcf, 0x66, 0x3b, 0x9b, 0x0e, 0xce, 0x8d, 0xfc, 0x0b, 0xf1, 0xf0 },
+        { 0xdc, 0xc1, 0xa8, 0xb6, 0x67, 0x05, 0x3f, 0x7d, 0xcc, 0x5c, 0x19, 0x4a, 0xb5, 0x42, 0x3a, 0x2e },
+        { 0xc6, 0xde, 0xb0, 0xab, 0x79, 0x1e, 0x23, 0x64, 0xa4, 0x05, 0x5f, 0xbe, 0x56, 0x88, 0x03, 0xab },
+        { 0xdd, 0x1b, 0x7c, 0xda, 0xf2, 0x8d, 0x5c, 0x15, 0x8a, 0x49, 0xab, 0x1d, 0xbb, 0xc4, 0x97, 0xcb },
+        { 0x78, 0xc4, 0xf7, 0x08, 0x31, 0x8d, 0x3c, 0xd6, 0x96, 0x55, 0xb7, 0x01, 0xbf, 0xc0, 0x93, 0xcf },
+        { 0x60, 0xdc, 0xef, 0x10, 0x29, 0x95, 0x24, 0xce, 0x62, 0xdb, 0xef, 0x15, 0x2f, 0x96, 0x20, 0xcf },
+        { 0x4b, 0x4e, 0xcb, 0xdb, 0x4d, 0x4d, 0xcf, 0xda, 0x57, 0x52, 0xd7, 0xc7, 0x49, 0x49, 0xcb, 0xde },
+        { 0x1a, 0x1f, 0x18, 0x1d, 0x1e, 0x1b, 0x1c, 0x19, 0x47, 0x42, 0xc7, 0xd7, 0x49, 0x49, 0xcb, 0xde },
+        { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f },
+      },
+      {
+        { 0xdd, 0xa9, 0x7c, 0xa4, 0x86, 0x4c, 0xdf, 0xe0, 0x6e, 0xaf, 0x70, 0xa0, 0xec, 0x0d, 0x71, 0x91 },
+        { 0x64, 0x77, 0x5e, 0xc7, 0x26, 0xe8, 0xe5, 0x8b, 0xdd, 0xaa, 0xca, 0x8e, 0xa2, 0x67, 0x67, 0x7d },
+        { 0xd0, 0x33, 0x62, 0x52, 0xe0, 0xce, 0x2e, 0x83, 0x22, 0x06, 0xb7, 0x43, 0x9c, 0x08, 0xd3, 0xc4 },
+        { 0xc6, 0xd5, 0x63, 0x82, 0xb0, 0xd4, 0x7b, 0x9f, 0x57, 0x3c, 0x48, 0xac, 0x6e, 0x57, 0x9f, 0x3e },
+        { 0x8a, 0x39, 0x3c, 0x63, 0xef, 0x37, 0x9d, 0x6d, 0x93, 0x8b, 0x8f, 0xcd, 0xa2, 0x3c, 0xe7, 0xfe },
+        { 0xd9, 0xc1, 0x87, 0x12, 0x68, 0xa1, 0x4c, 0xbd, 0x6d, 0x71, 0x16, 0x95, 0x05, 0xe8, 0xbc, 0x40 },
+        { 0x1a, 0xb1, 0x8c, 0xbf, 0x0a, 0xc5, 0xd7, 0x3d, 0x54, 0xf6, 0x4a, 0x1b, 0x2a, 0xb8, 0xf7, 0x94 },
+        { 0x13, 0xc5, 0x11, 0xa1, 0x83, 0xe0, 0x45, 0x73, 0x5c, 0x99, 0xc1, 0x49, 0x5b, 0x79, 0x69, 0xdf },
+        { 0x6c, 0x46, 0xce, 0xb2, 0x05, 0x04, 0x14, 0x14, 0x0c, 0xbb, 0x51, 0xa1, 0x15, 0x43, 0xa8, 0x0c },
+      } },
+    { INT32_C(14),
+      {
+        { 0x24, 0xfc, 0x79, 0xcc, 0xbf, 0x09, 0x79, 0xe9, 0x37, 0x1a, 0xc2, 0x3c, 0x6d, 0x68, 0xde, 0x36 },
+        { 0x34, 0xf1, 0xd1, 0xff, 0xbf, 0xce, 0xaa, 0x2f, 0xfc, 0xe9, 0xe2, 0x5f, 0x25, 0x58, 0x01, 0x6e },
+        { 0x5e, 0x16, 0x48, 0xeb, 0x38, 0x4c, 0x35, 0x0a, 0x75, 0x71, 0xb7, 0x46, 0xdc, 0x80, 0xe6, 0x84 },
+        { 0xc8, 0xa3, 0x05, 0x80, 0x8b, 0x3f, 0x7b, 0xd0, 0x43, 0x27, 0x48, 0x70, 0xd9, 0xb1, 0xe3, 0x31 },
+        { 0xb5, 0x70, 0x8e, 0x13, 0x66, 0x5a, 0x7d, 0xe1, 0x4d, 0x3d, 0x82, 0x4c, 0xa9, 0xf1, 0x51, 0xc2 },
+        { 0x74, 0xda, 0x7b, 0xa3, 0x43, 0x9c, 0x7e, 0x50, 0xc8, 0x18, 0x33, 0xa0, 0x9a, 0x96, 0xab, 0x41 },
+        { 0x3c, 0xa6, 0x97, 0x15, 0xd3, 0x2a, 0xf3, 0xf2, 0x2b, 0x67, 0xff, 0xad, 0xe4, 0xcc, 0xd3, 0x8e },
+        { 0xf8, 0x5f, 0xc4, 0xf3, 0x37, 0x46, 0x05, 0xf3, 0x8b, 0x84, 0x4d, 0xf0, 0x52, 0x8e, 0x98, 0xe1 },
+        { 0xde, 0x69, 0x40, 0x9a, 0xef, 0x8c, 0x64, 0xe7, 0xf8, 0x4d, 0x0c, 0x5f, 0xcf, 0xab, 0x2c, 0x23 },
+        { 0xae, 0xd5, 0x58, 0x16, 0xcf, 0x19, 0xc1, 0x00, 0xbc, 0xc2, 0x48, 0x03, 0xd9, 0x0a, 0xd5, 0x11 },
+        { 0x15, 0xc6, 0x68, 0xbd, 0x31, 0xe5, 0x24, 0x7d, 0x17, 0xc1, 0x68, 0xb8, 0x37, 0xe6, 0x20, 0x7c },
+        { 0x7f, 0xd7, 0x85, 0x0f, 0x61, 0xcc, 0x99, 0x16, 0x73, 0xdb, 0x89, 0x03, 0x65, 0xc8, 0x9d, 0x12 },
+        { 0x2a, 0x28, 0x40, 0xc9, 0x24, 0x23, 0x4c, 0xc0, 0x26, 0x24, 0x4c, 0xc5, 0x20, 0x27, 0x48, 0xc4 },
+        { 0x1a, 0x1f, 0x18, 0x1d, 0x1e, 0x1b, 0x1c, 0x19, 0x12, 0x17, 0x10, 0x15, 0x16, 0x13, 0x14, 0x11 },
+        { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f },
+      },
+      {
+        { 0x8e, 0xa2, 0xb7, 0xca, 0x51, 0x67, 0x45, 0xbf, 0xea, 0xfc, 0x49, 0x90, 0x4b, 0x49, 0x60, 0x89 },
+        { 0xc4, 0xac, 0x2a, 0x9e, 0xe6, 0x9e, 0x79, 0x88, 0xa1, 0xb6, 0x06, 0x1d, 0xa7, 0xf2, 0x4c, 0x38 },
+        { 0x9f, 0xfa, 0x77, 0x86, 0x75, 0xac, 0x84, 0x18, 0x37, 0xfb, 0xb5, 0xa2, 0xb5, 0x17, 0x8c, 0x6d },
+        { 0xde, 0x00, 0xc5, 0x85, 0xe5, 0x1a, 0xfc, 0x80, 0xf5, 0xd8, 0xca, 0x8c, 0xe9, 0xcf, 0xf4, 0x3a },
+        { 0xab, 0xb0, 0x44, 0x72, 0xd7, 0x2f, 0xd8, 0x2a, 0x4b, 0x0e, 0x52, 0x76, 0x04, 0xe5, 0x7c, 0x0f },
+        { 0xa0, 0xe6, 0x51, 0x08, 0xbf, 0xc7, 0x43, 0x53, 0x7b, 0x81, 0x10, 0xa9, 0x38, 0x52, 0x22, 0x31 },
+        { 0x8d, 0xb7, 0x89, 0x7c, 0x96, 0x47, 0x29, 0xca, 0xd1, 0xc8, 0x06, 0xcf, 0x99, 0xc9, 0x36, 0x89 },
+        { 0xdb, 0x28, 0x48, 0xa4, 0x98, 0x2a, 0x95, 0x8e, 0x79, 0x37, 0xbd, 0x6e, 0x17, 0x4a, 0xd2, 0x95 },
+        { 0x32, 0x2f, 0x8b, 0x81, 0x99, 0xe5, 0x1c, 0x63, 0x7c, 0xa4, 0x65, 0x94, 0xbb, 0x13, 0x1e, 0x4c },
+      } },
+  };
+
+  for (size_t t = 0 ; t < (sizeof(test_vec) / sizeof(test_vec[0])) ; t++) {
+    simde__m128i k[15], b[9];
+
+    for (int i = 0 ; i <= test_vec[t].rounds ; i++)
+      k[i] = simde_mm_loadu_si128(test_vec[t].round_keys[i]);
+
+    /* Every count up to one full batch plus one, so both the bitsliced
+     * and the single-block paths get exercised. */
+    for (size_t n = 0 ; n <= (sizeof(r) / sizeof(r[0])) ; n++) {
+      for (size_t i = 0 ; i < n ; i++)
+        b[i] = simde_mm_loadu_si128(test_vec[t].a[i]);
+      simde_x_aes_decrypt_blocks(b, n, k, test_vec[t].rounds);
+      for (size_t i = 0 ; i < n ; i++)
+        simde_test_x86_assert_equal_u8x16(b[i], simde_mm_loadu_si128(r[i]));
+    }
+  }
+
+  return 0;
+}
+
 SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_aesenc_si128)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_aesdec_si128)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_aesenclast_si128)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_aesdeclast_si128)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_aesimc_si128)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_aesenc_epi128)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_aesdec_epi128)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_aesenclast_epi128)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_aesdeclast_epi128)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_aesenc_epi128)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_aesdec_epi128)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_aesenclast_epi128)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_aesdeclast_epi128)
+  SIMDE_TEST_FUNC_LIST_ENTRY(x_aes_encrypt_blocks)
+  SIMDE_TEST_FUNC_LIST_ENTRY(x_aes_decrypt_blocks)
 SIMDE_TEST_FUNC_LIST_END
 
 #include <test/x86/test-x86-footer.h>
@@ -0,0 +1,1494 @@
+/* MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+  #define _GNU_SOURCE
+#endif
+
+#define SIMDE_TESTS_CURRENT_ISAX amx
+#include <simde/x86/amx.h>
+#include <test/x86/test-x86.h>
+
+#if defined(SIMDE_X86_AMX_TILE_NATIVE) && defined(__linux__)
+  #include <unistd.h>
+  #include <sys/syscall.h>
+#endif
+
+/* Configure tile 0 as C (m x n dwords), tile 1 as A (m x k dwords) and
+ * tile 2 as B (k x n dwords). */
+static void
+simde_test_amx_config (uint8_t m, uint8_t k, uint8_t n) {
+  uint8_t config[64] = { 0 };
+
+  #if defined(SIMDE_X86_AMX_TILE_NATIVE) && defined(__linux__)
+    /* Linux only hands out the tile data state on request
+     * (ARCH_REQ_XCOMP_PERM, XFEATURE_XTILEDATA). */
+    syscall(SYS_arch_prctl, 0x1023, 18);
+  #endif
+
+  config[0] = 1;
+  config[16 + (2 * 0)] = HEDLEY_STATIC_CAST(uint8_t, n * 4);
+  config[16 + (2 * 1)] = HEDLEY_STATIC_CAST(uint8_t, k * 4);
+  config[16 + (2 * 2)] = HEDLEY_STATIC_CAST(uint8_t, n * 4);
+  config[48 + 0] = m;
+  config[48 + 1] = m;
+  config[48 + 2] = k;
+  simde_tile_loadconfig(config);
+}
+
+static int
+test_simde_tile_storeconfig (SIMDE_MUNIT_TEST_ARGS) {
+  uint8_t config[64];
+
+  simde_test_amx_config(6, 8, 5);
+  simde_tile_storeconfig(config);
+  simde_assert_equal_u8(config[0], 1);
+  simde_assert_equal_u8(config[16], 20);
+  simde_assert_equal_u8(config[17], 0);
+  simde_assert_equal_u8(config[18], 32);
+  simde_assert_equal_u8(config[48], 6);
+  simde_assert_equal_u8(config[50], 8);
+  simde_assert_equal_u8(config[51], 0);
+
+  simde_tile_release();
+  simde_tile_storeconfig(config);
+  for (size_t i = 0 ; i < sizeof(config) ; i++) {
+    simde_assert_equal_u8(config[i], 0);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_tile_loadd (SIMDE_MUNIT_TEST_ARGS) {
+  static const uint8_t a[4][32] =
+    { { UINT8_C( 89), UINT8_C(236), UINT8_C(226), UINT8_C(242), UINT8_C(188), UINT8_C(214), UINT8_C( 81), UINT8_C( 46),
+      UINT8_C(234), UINT8_C(122), UINT8_C(107), UINT8_C(209), UINT8_C(105), UINT8_C( 76), UINT8_C(241), UINT8_C(231),
+      UINT8_C( 53), UINT8_C( 82), UINT8_C(251), UINT8_C(243), UINT8_C( 20), UINT8_C(226), UINT8_C( 25), UINT8_C(176),
+      UINT8_C(111), UINT8_C( 62), UINT8_C( 47), UINT8_C(134), UINT8_C( 79), UINT8_C( 13), UINT8_C(153), UINT8_C(237) },
+    { UINT8_C(121), UINT8_C(157), UINT8_C(235), UINT8_C(125), UINT8_C( 20), UINT8_C(123), UINT8_C(125), UINT8_C(150),
+      UINT8_C(151), UINT8_C( 65), UINT8_C(216), UINT8_C(197), UINT8_C(148), UINT8_C( 82), UINT8_C(230), UINT8_C(178),
+      UINT8_C( 50), UINT8_C( 45), UINT8_C(120), UINT8_C(122), UINT8_C( 23), UINT8_C( 50), UINT8_C( 71), UINT8_C( 29),
+      UINT8_C(180), UINT8_C(124), UINT8_C(234), UINT8_C( 53), UINT8_C(217), UINT8_C(116), UINT8_C(251), UINT8_C(173) },
+    { UINT8_C(226), UINT8_C( 41), UINT8_C(103), UINT8_C(160), UINT8_C(178), UINT8_C( 14), UINT8_C(244), UINT8_C(205),
+      UINT8_C(200), UINT8_C(129), UINT8_C( 34), UINT8_C(161), UINT8_C( 56), UINT8_C(245), UINT8_C(202), UINT8_C(187),
+      UINT8_C(116), UINT8_C( 13), UINT8_C(205), UINT8_C( 63), UINT8_C(142), UINT8_C(169), UINT8_C(228), UINT8_C(179),
+      UINT8_C( 46), UINT8_C( 65), UINT8_C(210), UINT8_C( 14), UINT8_C(  6), UINT8_C(255), UINT8_C( 72), UINT8_C(199) },
+    { UINT8_C( 11), UINT8_C( 34), UINT8_C(102), UINT8_C( 51), UINT8_C(143), UINT8_C(232), UINT8_C(129), UINT8_C( 84),
+      UINT8_C(217), UINT8_C(123), UINT8_C(  1), UINT8_C(230), UINT8_C(178), UINT8_C( 44), UINT8_C(124), UINT8_C(224),
+      UINT8_C(145), UINT8_C(196), UINT8_C( 99), UINT8_C(204), UINT8_C(193), UINT8_C(247), UINT8_C(115), UINT8_C( 71),
+      UINT8_C(180), UINT8_C( 32), UINT8_C(224), UINT8_C(201), UINT8_C(252), UINT8_C(205), UINT8_C(154), UINT8_C( 36) } };
+  static const uint8_t e[4][24] =
+    { { UINT8_C( 89), UINT8_C(236), UINT8_C(226), UINT8_C(242), UINT8_C(188), UINT8_C(214), UINT8_C( 81), UINT8_C( 46),
+      UINT8_C(234), UINT8_C(122), UINT8_C(107), UINT8_C(209), UINT8_C(105), UINT8_C( 76), UINT8_C(241), UINT8_C(231),
+      UINT8_C( 53), UINT8_C( 82), UINT8_C(251), UINT8_C(243), UINT8_C(170), UINT8_C(170), UINT8_C(170), UINT8_C(170) },
+    { UINT8_C(121), UINT8_C(157), UINT8_C(235), UINT8_C(125), UINT8_C( 20), UINT8_C(123), UINT8_C(125), UINT8_C(150),
+      UINT8_C(151), UINT8_C( 65), UINT8_C(216), UINT8_C(197), UINT8_C(148), UINT8_C( 82), UINT8_C(230), UINT8_C(178),
+      UINT8_C( 50), UINT8_C( 45), UINT8_C(120), UINT8_C(122), UINT8_C(170), UINT8_C(170), UINT8_C(170), UINT8_C(170) },
+    { UINT8_C(226), UINT8_C( 41), UINT8_C(103), UINT8_C(160), UINT8_C(178), UINT8_C( 14), UINT8_C(244), UINT8_C(205),
+      UINT8_C(200), UINT8_C(129), UINT8_C( 34), UINT8_C(161), UINT8_C( 56), UINT8_C(245), UINT8_C(202), UINT8_C(187),
+      UINT8_C(116), UINT8_C( 13), UINT8_C(205), UINT8_C( 63), UINT8_C(170), UINT8_C(170), UINT8_C(170), UINT8_C(170) },
+    { UINT8_C(170), UINT8_C(170), UINT8_C(170), UINT8_C(170), UINT8_C(170), UINT8_C(170), UINT8_C(170), UINT8_C(170),
+      UINT8_C(170), UINT8_C(170), UINT8_C(170), UINT8_C(170), UINT8_C(170), UINT8_C(170), UINT8_C(170), UINT8_C(170),
+      UINT8_C(170), UINT8_C(170), UINT8_C(170), UINT8_C(170), UINT8_C(170), UINT8_C(170), UINT8_C(170), UINT8_C(170) } };
+  uint8_t config[64] = { 0 };
+  uint8_t r[4][24];
+
+  config[0] = 1;
+  config[16 + (2 * 3)] = 20;
+  config[48 + 3] = 3;
+  simde_tile_loadconfig(config);
+  simde_tile_loadd(3, a, sizeof(a[0]));
+  simde_memset(r, 0xAA, sizeof(r));
+  simde_tile_stored(3, r, sizeof(r[0]));
+  for (size_t i = 0 ; i < (sizeof(r) / sizeof(r[0])) ; i++) {
+    simde_assert_equal_vu8(sizeof(r[i]), r[i], e[i]);
+  }
+
+  simde_tile_zero(3);
+  simde_tile_stored(3, r, sizeof(r[0]));
+  for (size_t i = 0 ; i < 3 ; i++) {
+    for (size_t j = 0 ; j < 20 ; j++) {
+      simde_assert_equal_u8(r[i][j], 0);
+    }
+  }
+  simde_tile_release();
+
+  return 0;
+}
+
+static int
+test_simde_tile_dpbssd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const uint8_t m;
+    const uint8_t k;
+    const uint8_t n;
+    const int8_t a[6][64];
+    const int8_t b[16][64];
+    const int32_t c[6][16];
+    const int32_t r[6][16];
+  } test_vec[] = {
+    { 6, 8, 5,
+      { { INT8_C(  94), INT8_C(  99), INT8_C(  36), INT8_C(  62), INT8_C( -17), INT8_C( -52), INT8_C(  96), INT8_C(  99), INT8_C(  10), INT8_C(  80), INT8_C(  34), INT8_C(  62), INT8_C( 114), INT8_C(  19), INT8_C( 105), INT8_C(  59),
+        INT8_C( -19), INT8_C(  36), INT8_C( 115), INT8_C(  65), INT8_C( -84), INT8_C(  -2), INT8_C(  39), INT8_C(  65), INT8_C(  83), INT8_C(  57), INT8_C(   8), INT8_C( 102), INT8_C(  41), INT8_C(-114), INT8_C( -58), INT8_C(-100),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C( 108), INT8_C(-123), INT8_C(  66), INT8_C( -35), INT8_C(  -7), INT8_C(  40), INT8_C( 103), INT8_C( -57), INT8_C( 101), INT8_C(  49), INT8_C(  69), INT8_C( -24), INT8_C(  46), INT8_C(   1), INT8_C(-112), INT8_C(  95),
+        INT8_C(  16), INT8_C( 119), INT8_C( -65), INT8_C( -14), INT8_C(  92), INT8_C( -38), INT8_C( 119), INT8_C(  80), INT8_C(  65), INT8_C( -46), INT8_C(  12), INT8_C( -37), INT8_C( -74), INT8_C(  14), INT8_C(-120), INT8_C( 104),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C(  43), INT8_C(  85), INT8_C( -73), INT8_C( -54), INT8_C(-122), INT8_C( -12), INT8_C( -60), INT8_C(   1), INT8_C( -46), INT8_C(  90), INT8_C(  27), INT8_C( -82), INT8_C(  80), INT8_C( -17), INT8_C(  -5), INT8_C( 105),
+        INT8_C( -53), INT8_C(  53), INT8_C( 101), INT8_C( 118), INT8_C(   4), INT8_C( -41), INT8_C(-104), INT8_C(  31), INT8_C( -20), INT8_C(  23), INT8_C( -96), INT8_C(   5), INT8_C(  71), INT8_C(  76), INT8_C(-118), INT8_C( 103),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C(  43), INT8_C(  72), INT8_C( 120), INT8_C( -77), INT8_C( -40), INT8_C(  55), INT8_C(  89), INT8_C(  18), INT8_C(  19), INT8_C(  20), INT8_C(  27), INT8_C(-128), INT8_C( -92), INT8_C(  10), INT8_C(  69), INT8_C(  43),
+        INT8_C( -92), INT8_C(  60), INT8_C( -37), INT8_C(-105), INT8_C( -66), INT8_C(  17), INT8_C(  86), INT8_C(-128), INT8_C( -14), INT8_C( 123), INT8_C(  39), INT8_C(  33), INT8_C(-124), INT8_C( -42), INT8_C(  66), INT8_C( -84),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C(-108), INT8_C( -36), INT8_C( 110), INT8_C( -44), INT8_C(  22), INT8_C(-122), INT8_C(-111), INT8_C( -32), INT8_C(  44), INT8_C(  43), INT8_C(  87), INT8_C(-123), INT8_C(  59), INT8_C( -20), INT8_C(  61), INT8_C(  14),
+        INT8_C(  71), INT8_C( 114), INT8_C( -88), INT8_C( -28), INT8_C(  45), INT8_C( -33), INT8_C( -85), INT8_C(-124), INT8_C(  -2), INT8_C(  99), INT8_C(  93), INT8_C( 114), INT8_C( 106), INT8_C( -78), INT8_C(  53), INT8_C(-120),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C(  70), INT8_C( -88), INT8_C(  63), INT8_C( -79), INT8_C(   3), INT8_C(  -9), INT8_C( -12), INT8_C(  -2), INT8_C(  37), INT8_C(  44), INT8_C(  -6), INT8_C( 125), INT8_C( -95), INT8_C(  56), INT8_C( 124), INT8_C( -74),
+        INT8_C(  72), INT8_C( -83), INT8_C( -26), INT8_C(  40), INT8_C(  99), INT8_C(  87), INT8_C(  75), INT8_C(  75), INT8_C(  72), INT8_C(  -1), INT8_C(-114), INT8_C(  64), INT8_C(  86), INT8_C( -38), INT8_C( -28), INT8_C(  36),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) } },
+      { { INT8_C(  37), INT8_C(  30), INT8_C( -79), INT8_C( -15), INT8_C( -99), INT8_C( -75), INT8_C( -41), INT8_C(  97), INT8_C( -67), INT8_C(-125), INT8_C(  46), INT8_C(  56), INT8_C( 108), INT8_C( 113), INT8_C(-120), INT8_C(  91),
+        INT8_C( -61), INT8_C(  70), INT8_C(  69), INT8_C(  68), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C(-106), INT8_C( -26), INT8_C( -95), INT8_C( -32), INT8_C(  74), INT8_C(  -9), INT8_C(-103), INT8_C( -63), INT8_C( -54), INT8_C(  80), INT8_C(  68), INT8_C(  -2), INT8_C( -96), INT8_C(  62), INT8_C( 119), INT8_C(-101),
+        INT8_C(  14), INT8_C( -24), INT8_C( -47), INT8_C(  52), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C(  38), INT8_C(  79), INT8_C( -23), INT8_C(  52), INT8_C( 114), INT8_C( -94), INT8_C( -33), INT8_C( 126), INT8_C( 121), INT8_C( -83), INT8_C(-106), INT8_C(   8), INT8_C( -75), INT8_C(  59), INT8_C(  24), INT8_C( -50),
+        INT8_C(  95), INT8_C( 121), INT8_C( -99), INT8_C(  43), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C(  66), INT8_C(-121), INT8_C( -88), INT8_C(-107), INT8_C(  16), INT8_C(-100), INT8_C(-124), INT8_C( -87), INT8_C( -66), INT8_C(  63), INT8_C(  82), INT8_C( -55), INT8_C( -75), INT8_C(  41), INT8_C(  64), INT8_C(  40),
+        INT8_C(  54), INT8_C(  81), INT8_C( -25), INT8_C(  80), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C( -99), INT8_C( 117), INT8_C( -87), INT8_C( -45), INT8_C( -74), INT8_C(-110), INT8_C(   3), INT8_C( -43), INT8_C(  82), INT8_C(   3), INT8_C(  88), INT8_C(-111), INT8_C( 110), INT8_C(  65), INT8_C( 107), INT8_C(  86),
+        INT8_C( -74), INT8_C( -72), INT8_C(  -1), INT8_C(-106), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C(  11), INT8_C( 121), INT8_C( -91), INT8_C( -54), INT8_C( -62), INT8_C(  65), INT8_C( -31), INT8_C(-100), INT8_C(  78), INT8_C( -15), INT8_C(-101), INT8_C(  74), INT8_C(  11), INT8_C( -23), INT8_C( -57), INT8_C(   4),
+        INT8_C( -32), INT8_C( -17), INT8_C( -90), INT8_C( -48), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C(  39), INT8_C( -21), INT8_C( -67), INT8_C( -97), INT8_C( -16), INT8_C(  76), INT8_C(  78), INT8_C(-116), INT8_C( 122), INT8_C( -48), INT8_C(  81), INT8_C( -99), INT8_C(  90), INT8_C(  42), INT8_C(  -5), INT8_C(  57),
+        INT8_C( -93), INT8_C(  64), INT8_C( -74), INT8_C(  -7), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C(   0), INT8_C( -63), INT8_C(  18), INT8_C(  83), INT8_C(  -1), INT8_C(  -4), INT8_C(  40), INT8_C( -71), INT8_C( -49), INT8_C( 107), INT8_C(  39), INT8_C( -56), INT8_C(  13), INT8_C( 123), INT8_C(  29), INT8_C( 124),
+        INT8_C(-126), INT8_C(  54), INT8_C( -85), INT8_C(  48), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C(  82), INT8_C(-127), INT8_C(  35), INT8_C(  53), INT8_C(  11), INT8_C( 108), INT8_C(  14), INT8_C(   2), INT8_C(-112), INT8_C( -60), INT8_C(  33), INT8_C(   3), INT8_C( -83), INT8_C(  21), INT8_C(  14), INT8_C( -88),
+        INT8_C(  60), INT8_C( -16), INT8_C(  96), INT8_C(  20), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C(  12), INT8_C( -26), INT8_C(  60), INT8_C( -65), INT8_C(  33), INT8_C(   4), INT8_C(  41), INT8_C(  -3), INT8_C(  68), INT8_C( 100), INT8_C( -17), INT8_C(  41), INT8_C(-102), INT8_C(-109), INT8_C( -46), INT8_C(  49),
+        INT8_C(-112), INT8_C(-122), INT8_C(  25), INT8_C(  52), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C(   3), INT8_C(  34), INT8_C( 105), INT8_C(  96), INT8_C(  36), INT8_C(  16), INT8_C(-126), INT8_C(  22), INT8_C(-108), INT8_C( -56), INT8_C( -33), INT8_C( 116), INT8_C( -15), INT8_C( -98), INT8_C(  70), INT8_C( -77),
+        INT8_C( -35), INT8_C(  37), INT8_C(  54), INT8_C( 102), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C( -82), INT8_C(  36), INT8_C( -27), INT8_C(   9), INT8_C(  21), INT8_C( -36), INT8_C(-105), INT8_C(  80), INT8_C( -94), INT8_C( 102), INT8_C( 101), INT8_C(  96), INT8_C( 121), INT8_C( -96), INT8_C(  53), INT8_C(  49),
+        INT8_C( -21), INT8_C(  38), INT8_C( -63), INT8_C(  58), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C(  89), INT8_C( -41), INT8_C( -55), INT8_C(  20), INT8_C( 125), INT8_C( -23), INT8_C( 117), INT8_C( -18), INT8_C(  -7), INT8_C( -79), INT8_C(-119), INT8_C( 114), INT8_C( -70), INT8_C(  85), INT8_C(  26), INT8_C( -57),
+        INT8_C(   0), INT8_C( -47), INT8_C( 108), INT8_C( -22), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C(   0), INT8_C( -89), INT8_C(  46), INT8_C(  61), INT8_C( 114), INT8_C( -52), INT8_C( -38), INT8_C( -66), INT8_C(  -7), INT8_C( -30), INT8_C(  57), INT8_C(  -7), INT8_C( 107), INT8_C(  -7), INT8_C(  74), INT8_C(  71),
+        INT8_C(  37), INT8_C(  58), INT8_C( -26), INT8_C(  36), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C( -69), INT8_C( -66), INT8_C(  35), INT8_C( -63), INT8_C( -13), INT8_C(-115), INT8_C(  19), INT8_C(  69), INT8_C(  39), INT8_C( -12), INT8_C( -35), INT8_C(-111), INT8_C( -52), INT8_C( -79), INT8_C( -95), INT8_C(  46),
+        INT8_C(-128), INT8_C(  92), INT8_C(  77), INT8_C(-121), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C(-114), INT8_C( -60), INT8_C(  59), INT8_C(  69), INT8_C(  80), INT8_C(  -4), INT8_C(-126), INT8_C(  55), INT8_C(  82), INT8_C(  56), INT8_C(  33), INT8_C( -61), INT8_C( -97), INT8_C(  89), INT8_C( -88), INT8_C( -72),
+        INT8_C(  34), INT8_C( 116), INT8_C(-117), INT8_C( 120), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) } },
+      { { INT32_C( 1226148045), INT32_C( -293513808), INT32_C( 1701065545), INT32_C( -892302312), INT32_C( -124453872), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C(-1743398273), INT32_C(-1531726413), INT32_C( 1436013653), INT32_C( -471105301), INT32_C(-2131585133), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C(-1449254316), INT32_C( -569523002), INT32_C( 1629171648), INT32_C( 1098973196), INT32_C(  181156667), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C(-1951242230), INT32_C( -271884960), INT32_C(  487342541), INT32_C( -593973307), INT32_C( 1752089253), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C(  367044790), INT32_C(  115756340), INT32_C( -192685732), INT32_C(-1796135013), INT32_C(-1643499750), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C( -770844138), INT32_C(  790948244), INT32_C(-1552470115), INT32_C(-2099044624), INT32_C(   45081697), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) } },
+      { { INT32_C( 1226114785), INT32_C( -293571479), INT32_C( 1701028463), INT32_C( -892273452), INT32_C( -124453278), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C(-1743391670), INT32_C(-1531779215), INT32_C( 1436025373), INT32_C( -471097396), INT32_C(-2131595791), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C(-1449221122), INT32_C( -569597020), INT32_C( 1629112012), INT32_C( 1099050870), INT32_C(  181180997), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C(-1951263547), INT32_C( -271914639), INT32_C(  487329806), INT32_C( -593981090), INT32_C( 1752106845), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C(  367042833), INT32_C(  115759574), INT32_C( -192707765), INT32_C(-1796183457), INT32_C(-1643514327), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C( -770857879), INT32_C(  790909847), INT32_C(-1552455335), INT32_C(-2099046957), INT32_C(   45050039), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) } } },
+    { 5, 16, 16,
+      { { INT8_C(  13), INT8_C( -40), INT8_C(  96), INT8_C(  94), INT8_C( -72), INT8_C(  92), INT8_C(  55), INT8_C( -65), INT8_C( 107), INT8_C(  64), INT8_C( -67), INT8_C( -37), INT8_C( 122), INT8_C( -21), INT8_C( -84), INT8_C(  13),
+        INT8_C( 102), INT8_C( -22), INT8_C(-118), INT8_C( 108), INT8_C( 107), INT8_C( -62), INT8_C( -53), INT8_C( -73), INT8_C(  56), INT8_C(  79), INT8_C(  82), INT8_C( 123), INT8_C( -72), INT8_C(   0), INT8_C(  29), INT8_C( -39),
+        INT8_C( -70), INT8_C( -11), INT8_C( 112), INT8_C( -10), INT8_C( -78), INT8_C(  51), INT8_C( 124), INT8_C( -46), INT8_C(  96), INT8_C( 110), INT8_C(-123), INT8_C(  13), INT8_C(-125), INT8_C(  10), INT8_C( 114), INT8_C(   2),
+        INT8_C( -73), INT8_C(  50), INT8_C(  85), INT8_C(  77), INT8_C( -11), INT8_C(  -6), INT8_C( -92), INT8_C( -72), INT8_C(  39), INT8_C(  68), INT8_C( -20), INT8_C(  34), INT8_C(  27), INT8_C(  11), INT8_C(   2), INT8_C(-111) },
+      { INT8_C(  59), INT8_C(-115), INT8_C(-114), INT8_C( 118), INT8_C(  72), INT8_C( -56), INT8_C(  47), INT8_C(  63), INT8_C( -16), INT8_C(  22), INT8_C(-121), INT8_C(   9), INT8_C(  33), INT8_C( 111), INT8_C(  53), INT8_C(  23),
+        INT8_C( -46), INT8_C(  87), INT8_C(  25), INT8_C(-123), INT8_C( -87), INT8_C(  -6), INT8_C( -81), INT8_C( -31), INT8_C(-121), INT8_C( -88), INT8_C( -71), INT8_C( -44), INT8_C( 103), INT8_C(  63), INT8_C(  62), INT8_C( 110),
+        INT8_C(  38), INT8_C(  47), INT8_C( -79), INT8_C( -53), INT8_C(  72), INT8_C(  45), INT8_C(  77), INT8_C( -87), INT8_C( -14), INT8_C(  76), INT8_C( -81), INT8_C( -69), INT8_C(   6), INT8_C(  50), INT8_C( -37), INT8_C( -25),
+        INT8_C( -26), INT8_C(  31), INT8_C(  41), INT8_C( -43), INT8_C( 114), INT8_C(  77), INT8_C(  78), INT8_C(  34), INT8_C( -65), INT8_C( -53), INT8_C( 115), INT8_C(  58), INT8_C( 125), INT8_C(  86), INT8_C( -77), INT8_C(  72) },
+      { INT8_C(  81), INT8_C( -44), INT8_C(   5), INT8_C( -76), INT8_C(  15), INT8_C( 120), INT8_C( -69), INT8_C(  32), INT8_C(  50), INT8_C(  22), INT8_C( -14), INT8_C( -37), INT8_C( -34), INT8_C(-121), INT8_C( -20), INT8_C(  76),
+        INT8_C(  22), INT8_C(  30), INT8_C( 108), INT8_C( 124), INT8_C( -19), INT8_C(  39), INT8_C(  12), INT8_C(   0), INT8_C(  45), INT8_C(  67), INT8_C(  58), INT8_C( 122), INT8_C( -39), INT8_C(  45), INT8_C( -73), INT8_C( -77),
+        INT8_C(-118), INT8_C( -46), INT8_C( 121), INT8_C( 115), INT8_C(  91), INT8_C(  -6), INT8_C(  33), INT8_C(  82), INT8_C(  27), INT8_C(-128), INT8_C( -69), INT8_C(-103), INT8_C(   5), INT8_C( 112), INT8_C(  56), INT8_C( -68),
+        INT8_C( 101), INT8_C( -75), INT8_C( -62), INT8_C(  10), INT8_C( 126), INT8_C( -54), INT8_C(  86), INT8_C(  27), INT8_C( -66), INT8_C( -39), INT8_C(  22), INT8_C(  95), INT8_C(  43), INT8_C(  -1), INT8_C(  70), INT8_C(  74) },
+      { INT8_C( -26), INT8_C(  18), INT8_C( -82), INT8_C( -38), INT8_C( 104), INT8_C(  -5), INT8_C(  70), INT8_C(  66), INT8_C( 113), INT8_C( -90), INT8_C(  32), INT8_C( -78), INT8_C( -70), INT8_C( 125), INT8_C( -77), INT8_C(   0),
+        INT8_C( -19), INT8_C(-124), INT8_C( -88), INT8_C( -53), INT8_C(  64), INT8_C( -27), INT8_C( 110), INT8_C( -65), INT8_C(  35), INT8_C(   8), INT8_C( -59), INT8_C(-128), INT8_C(  15), INT8_C(  83), INT8_C( 105), INT8_C( -78),
+        INT8_C( -22), INT8_C( -26), INT8_C(  95), INT8_C( -75), INT8_C(  41), INT8_C( -78), INT8_C(  77), INT8_C( -14), INT8_C(  51), INT8_C(  37), INT8_C( -93), INT8_C(  59), INT8_C(  49), INT8_C( -98), INT8_C(  62), INT8_C(  98),
+        INT8_C(  -9), INT8_C( 126), INT8_C(-128), INT8_C( -96), INT8_C( 101), INT8_C( -28), INT8_C(  51), INT8_C( -77), INT8_C( -24), INT8_C( 118), INT8_C(  84), INT8_C( -91), INT8_C( -90), INT8_C( -74), INT8_C(  11), INT8_C( 123) },
+      { INT8_C( -23), INT8_C( -35), INT8_C(  89), INT8_C( -41), INT8_C(-107), INT8_C( -29), INT8_C(-107), INT8_C(  85), INT8_C(  73), INT8_C( -41), INT8_C( -95), INT8_C( -38), INT8_C(  16), INT8_C(  -8), INT8_C( -34), INT8_C(  91),
+        INT8_C( -46), INT8_C(-107), INT8_C( -70), INT8_C(-117), INT8_C(  96), INT8_C(  49), INT8_C(-104), INT8_C(  75), INT8_C( -97), INT8_C( -10), INT8_C( -38), INT8_C(  73), INT8_C(  76), INT8_C( -37), INT8_C( -33), INT8_C(  53),
+        INT8_C(-115), INT8_C( -54), INT8_C(  74), INT8_C( -30), INT8_C( -69), INT8_C( -95), INT8_C( -63), INT8_C(  32), INT8_C( -65), INT8_C( -61), INT8_C( -13), INT8_C(  32), INT8_C(  66), INT8_C(  15), INT8_C( 125), INT8_C(-117),
+        INT8_C(-126), INT8_C( -48), INT8_C( -19), INT8_C( -66), INT8_C( -98), INT8_C(  -2), INT8_C( -10), INT8_C( -39), INT8_C(  52), INT8_C(  -3), INT8_C(  93), INT8_C(  48), INT8_C(  89), INT8_C(  65), INT8_C( -54), INT8_C(-120) },
+      { INT8_C( 112), INT8_C(-118), INT8_C( -44), INT8_C(  -5), INT8_C(-111), INT8_C( -87), INT8_C(  37), INT8_C(  65), INT8_C( -50), INT8_C(  10), INT8_C( -93), INT8_C( -93), INT8_C(-125), INT8_C(  32), INT8_C(-101), INT8_C( -40),
+        INT8_C( 101), INT8_C(  31), INT8_C(   2), INT8_C(  86), INT8_C( -41), INT8_C(  36), INT8_C( -25), INT8_C( 124), INT8_C(  26), INT8_C( -60), INT8_C(  52), INT8_C(   4), INT8_C(  57), INT8_C(  69), INT8_C( -66), INT8_C( -61),
+        INT8_C( 116), INT8_C( -55), INT8_C(  23), INT8_C( -83), INT8_C( -54), INT8_C( -42), INT8_C(  79), INT8_C(  99), INT8_C( -16), INT8_C(  60), INT8_C( -27), INT8_C( -40), INT8_C(  20), INT8_C(  95), INT8_C(  46), INT8_C(  11),
+        INT8_C( -52), INT8_C( -54), INT8_C( -73), INT8_C( -79), INT8_C(-111), INT8_C(  63), INT8_C( -31), INT8_C(  -3), INT8_C( 112), INT8_C(  56), INT8_C(  91), INT8_C(  -5), INT8_C(-105), INT8_C(   0), INT8_C( -56), INT8_C(  -6) } },
+      { { INT8_C(  -3), INT8_C(  -9), INT8_C( 114), INT8_C(  50), INT8_C(  -7), INT8_C(  16), INT8_C(-105), INT8_C( -56), INT8_C(  21), INT8_C(  75), INT8_C( -34), INT8_C(  34), INT8_C(  39), INT8_C( 119), INT8_C( -89), INT8_C(   0),
+        INT8_C(   1), INT8_C( -24), INT8_C(  57), INT8_C(  16), INT8_C(  13), INT8_C(  19), INT8_C(-104), INT8_C(-121), INT8_C(  24), INT8_C(  57), INT8_C(  30), INT8_C(  90), INT8_C( -79), INT8_C( -83), INT8_C( -98), INT8_C(  33),
+        INT8_C( -70), INT8_C( -13), INT8_C( -87), INT8_C(-108), INT8_C(  84), INT8_C(  58), INT8_C(  81), INT8_C(  26), INT8_C(  17), INT8_C(  97), INT8_C( -14), INT8_C( -70), INT8_C(  70), INT8_C( 112), INT8_C( -79), INT8_C(  61),
+        INT8_C( -27), INT8_C(  71), INT8_C(  -7), INT8_C(-118), INT8_C( -25), INT8_C(-125), INT8_C(  82), INT8_C( -69), INT8_C(  84), INT8_C(  -4), INT8_C(-128), INT8_C(  57), INT8_C( -33), INT8_C(  26), INT8_C(-102), INT8_C(  28) },
+      { INT8_C( -75), INT8_C(   4), INT8_C(  -5), INT8_C(-113), INT8_C( -24), INT8_C( 115), INT8_C(   5), INT8_C( 111), INT8_C( -67), INT8_C(  -9), INT8_C(  56), INT8_C( -58), INT8_C(  15), INT8_C(  61), INT8_C( -63), INT8_C(  65),
+        INT8_C( -91), INT8_C(-126), INT8_C( -47), INT8_C(-120), INT8_C( 120), INT8_C(-105), INT8_C(  32), INT8_C( 121), INT8_C(   5), INT8_C( -44), INT8_C( -82), INT8_C(  78), INT8_C(   9), INT8_C( -70), INT8_C( -29), INT8_C( -20),
+        INT8_C(  58), INT8_C(  52), INT8_C(  34), INT8_C(  -6), INT8_C(  64), INT8_C( -48), INT8_C( -73), INT8_C(  83), INT8_C(   3), INT8_C( -47), INT8_C(  65), INT8_C(  38), INT8_C( 100), INT8_C( -81), INT8_C( -74), INT8_C(   9),
+        INT8_C( -50), INT8_C(  74), INT8_C(-113), INT8_C(  86), INT8_C( -80), INT8_C(  98), INT8_C(  13), INT8_C(   5), INT8_C( -40), INT8_C( 118), INT8_C( 108), INT8_C(  78), INT8_C( 103), INT8_C(  59), INT8_C( 119), INT8_C( -11) },
+      { INT8_C(  15), INT8_C( -55), INT8_C( 124), INT8_C( -58), INT8_C(  27), INT8_C( -97), INT8_C( -72), INT8_C(  83), INT8_C( 127), INT8_C( -96), INT8_C( 114), INT8_C(-125), INT8_C( -84), INT8_C( -92), INT8_C(-106), INT8_C(  87),
+        INT8_C( 127), INT8_C( 112), INT8_C(  19), INT8_C( -27), INT8_C( 109), INT8_C( -93), INT8_C(  25), INT8_C( -95), INT8_C(  41), INT8_C(  69), INT8_C(  89), INT8_C(  59), INT8_C(  61), INT8_C( -85), INT8_C(  94), INT8_C(-102),
+        INT8_C(  63), INT8_C( -89), INT8_C( -63), INT8_C( -56), INT8_C(  45), INT8_C( -99), INT8_C( -52), INT8_C( -44), INT8_C(  77), INT8_C( -12), INT8_C( 116), INT8_C(  27), INT8_C(  15), INT8_C(  58), INT8_C( -33), INT8_C( -60),
+        INT8_C(  59), INT8_C(  91), INT8_C(  32), INT8_C( -59), INT8_C(  33), INT8_C(  91), INT8_C(  88), INT8_C(  53), INT8_C(-123), INT8_C( 104), INT8_C( -30), INT8_C( -32), INT8_C( -76), INT8_C(  22), INT8_C(  10), INT8_C( -14) },
+      { INT8_C(-120), INT8_C(  -1), INT8_C(  64), INT8_C( -20), INT8_C( -64), INT8_C( -75), INT8_C( -61), INT8_C(  96), INT8_C( -67), INT8_C(  14), INT8_C( -99), INT8_C(  34), INT8_C(-114), INT8_C(-111), INT8_C( 116), INT8_C(-117),
+        INT8_C( -67), INT8_C( 124), INT8_C( -94), INT8_C(-108), INT8_C( -45), INT8_C(  -1), INT8_C(  13), INT8_C( -54), INT8_C( -70), INT8_C( -70), INT8_C(-107), INT8_C(  75), INT8_C( -98), INT8_C( -38), INT8_C(-125), INT8_C( 126),
+        INT8_C(  44), INT8_C(  11), INT8_C( -92), INT8_C(  65), INT8_C( -34), INT8_C( 125), INT8_C( -94), INT8_C(  29), INT8_C( 101), INT8_C( -19), INT8_C(  43), INT8_C( -88), INT8_C( -54), INT8_C(  92), INT8_C(  21), INT8_C( -80),
+        INT8_C( -97), INT8_C( -52), INT8_C(  -1), INT8_C(  33), INT8_C( -34), INT8_C(  95), INT8_C( -25), INT8_C( 125), INT8_C(  -8), INT8_C( 112), INT8_C( -56), INT8_C( -47), INT8_C( -87), INT8_C( -32), INT8_C(  44), INT8_C( -22) },
+      { INT8_C( -46), INT8_C( 104), INT8_C(  51), INT8_C(  -1), INT8_C( 108), INT8_C(  24), INT8_C(  33), INT8_C(  38), INT8_C(  -9), INT8_C(  82), INT8_C(  96), INT8_C( -92), INT8_C( 104), INT8_C( -94), INT8_C(  -5), INT8_C( -14),
+        INT8_C( -79), INT8_C( 121), INT8_C( -12), INT8_C( -33), INT8_C(  16), INT8_C(-109), INT8_C(  -2), INT8_C( -86), INT8_C(-127), INT8_C(  19), INT8_C(-105), INT8_C( -41), INT8_C(  39), INT8_C( -39), INT8_C( -95), INT8_C(  75),
+        INT8_C(  55), INT8_C(  23), INT8_C( 103), INT8_C(  75), INT8_C(  13), INT8_C( 118), INT8_C(  45), INT8_C( 124), INT8_C(  24), INT8_C( -57), INT8_C(-111), INT8_C(  41), INT8_C( -40), INT8_C(-111), INT8_C(-117), INT8_C(  31),
+        INT8_C(  -1), INT8_C( -67), INT8_C( -63), INT8_C(  75), INT8_C(  38), INT8_C(  61), INT8_C( -48), INT8_C(-105), INT8_C( -69), INT8_C(  18), INT8_C( -32), INT8_C( -65), INT8_C(  69), INT8_C(-106), INT8_C( -79), INT8_C(  66) },
+      { INT8_C(  -1), INT8_C(  65), INT8_C( -45), INT8_C( -47), INT8_C( -43), INT8_C( 103), INT8_C( -63), INT8_C(  24), INT8_C(  22), INT8_C(  54), INT8_C(  49), INT8_C( -10), INT8_C( -57), INT8_C( -91), INT8_C( -49), INT8_C( -58),
+        INT8_C(  99), INT8_C(  20), INT8_C( 109), INT8_C(-122), INT8_C( -75), INT8_C( -33), INT8_C(  -9), INT8_C( -74), INT8_C( -16), INT8_C(  31), INT8_C( -82), INT8_C( 111), INT8_C( 118), INT8_C( -71), INT8_C(  91), INT8_C( -19),
+        INT8_C( 125), INT8_C( -36), INT8_C(-116), INT8_C(-112), INT8_C(  56), INT8_C(  68), INT8_C( -66), INT8_C(  23), INT8_C(  80), INT8_C(  24), INT8_C(  75), INT8_C(  89), INT8_C( -34), INT8_C( -25), INT8_C(  55), INT8_C( -16),
+        INT8_C( 117), INT8_C(  19), INT8_C(-102), INT8_C( -45), INT8_C( -91), INT8_C( -30), INT8_C( -97), INT8_C(-115), INT8_C(  62), INT8_C(  70), INT8_C( -43), INT8_C(  14), INT8_C(  61), INT8_C( -28), INT8_C( -61), INT8_C(  36) },
+      { INT8_C(   0), INT8_C( -58), INT8_C(  22), INT8_C( 125), INT8_C( -49), INT8_C( -18), INT8_C(-107), INT8_C( -27), INT8_C( -92), INT8_C(  73), INT8_C( -37), INT8_C( -25), INT8_C( -57), INT8_C(  70), INT8_C( -77), INT8_C(-110),
+        INT8_C( -19), INT8_C(-124), INT8_C(  83), INT8_C( 114), INT8_C(-126), INT8_C(  97), INT8_C(  46), INT8_C( -37), INT8_C( 103), INT8_C(   3), INT8_C( -43), INT8_C( 116), INT8_C(  15), INT8_C( 100), INT8_C(  39), INT8_C(-113),
+        INT8_C(  86), INT8_C( -81), INT8_C(  32), INT8_C( -50), INT8_C(-119), INT8_C(-103), INT8_C( -80), INT8_C( 108), INT8_C( -94), INT8_C( -10), INT8_C(  62), INT8_C( 127), INT8_C(  98), INT8_C( 109), INT8_C( -12), INT8_C( -52),
+        INT8_C( -22), INT8_C( 113), INT8_C(  61), INT8_C( -84), INT8_C( -18), INT8_C( -80), INT8_C( 117), INT8_C(-122), INT8_C( -92), INT8_C( 107), INT8_C( -57), INT8_C(  60), INT8_C(  43), INT8_C( -88), INT8_C(  93), INT8_C(  96) },
+      { INT8_C( 126), INT8_C(  40), INT8_C(-112), INT8_C(-101), INT8_C(-124), INT8_C( 124), INT8_C(  65), INT8_C(-114), INT8_C(  71), INT8_C(-112), INT8_C(  25), INT8_C( -13), INT8_C(  -2), INT8_C(  46), INT8_C( -35), INT8_C(  90),
+        INT8_C(  64), INT8_C( 114), INT8_C(  57), INT8_C( 102), INT8_C(  63), INT8_C(  74), INT8_C( 120), INT8_C( -99), INT8_C(  43), INT8_C(  57), INT8_C(  94), INT8_C( 120), INT8_C( 107), INT8_C(  68), INT8_C(   0), INT8_C( 115),
+        INT8_C(  88), INT8_C( -32), INT8_C( -10), INT8_C(  20), INT8_C(  13), INT8_C(  65), INT8_C(  18), INT8_C( -48), INT8_C(-120), INT8_C( -31), INT8_C(  68), INT8_C( -51), INT8_C(  70), INT8_C(-118), INT8_C( -12), INT8_C( -64),
+        INT8_C(-100), INT8_C(  54), INT8_C(  76), INT8_C(  52), INT8_C( -42), INT8_C(  -4), INT8_C( -97), INT8_C(-105), INT8_C( -32), INT8_C(  71), INT8_C(-118), INT8_C( -53), INT8_C(  17), INT8_C( -17), INT8_C( -87), INT8_C( -16) },
+      { INT8_C(  24), INT8_C(-122), INT8_C(  50), INT8_C(  18), INT8_C( -20), INT8_C(  58), INT8_C( -26), INT8_C( -27), INT8_C( -35), INT8_C( 126), INT8_C(-101), INT8_C( -96), INT8_C( -66), INT8_C( -83), INT8_C(  96), INT8_C(-103),
+        INT8_C( -61), INT8_C(  28), INT8_C( -16), INT8_C( -17), INT8_C( -25), INT8_C(   1), INT8_C( -41), INT8_C( -93), INT8_C(   6), INT8_C( 125), INT8_C(  91), INT8_C(  13), INT8_C( 120), INT8_C( 119), INT8_C( -10), INT8_C(  86),
+        INT8_C( -77), INT8_C( 120), INT8_C(  53), INT8_C( 110), INT8_C(   2), INT8_C(-114), INT8_C( -32), INT8_C( -24), INT8_C( -17), INT8_C( -69), INT8_C(-122), INT8_C( -64), INT8_C(  19), INT8_C(  77), INT8_C(  83), INT8_C(-127),
+        INT8_C(  65), INT8_C(-102), INT8_C(-108), INT8_C(-112), INT8_C(  50), INT8_C(  11), INT8_C( -83), INT8_C( -48), INT8_C( -89), INT8_C(   7), INT8_C( -86), INT8_C(  62), INT8_C( -18), INT8_C(  59), INT8_C( 106), INT8_C(-116) },
+      { INT8_C(  67), INT8_C(  56), INT8_C(  45), INT8_C( -99), INT8_C(  -4), INT8_C(  31), INT8_C( -36), INT8_C(  32), INT8_C(  15), INT8_C(-102), INT8_C(  62), INT8_C( -47), INT8_C(-124), INT8_C( 125), INT8_C( -37), INT8_C( 122),
+        INT8_C( -20), INT8_C( -49), INT8_C( -45), INT8_C( -30), INT8_C(  69), INT8_C( -66), INT8_C( -49), INT8_C( -79), INT8_C( -77), INT8_C( -70), INT8_C(  50), INT8_C( -22), INT8_C(  60), INT8_C(  58), INT8_C( -55), INT8_C(-116),
+        INT8_C(  42), INT8_C( -43), INT8_C(  79), INT8_C(-124), INT8_C( -71), INT8_C(-120), INT8_C(  41), INT8_C(-118), INT8_C(-124), INT8_C( -33), INT8_C(-120), INT8_C(-128), INT8_C(  20), INT8_C(  26), INT8_C(  76), INT8_C(  65),
+        INT8_C( 104), INT8_C(  -1), INT8_C( -27), INT8_C(-109), INT8_C( -67), INT8_C( -15), INT8_C( -85), INT8_C(  27), INT8_C(  43), INT8_C(  44), INT8_C( -65), INT8_C(  23), INT8_C( 106), INT8_C(-107), INT8_C(-121), INT8_C(-105) },
+      { INT8_C( -44), INT8_C( -99), INT8_C( -97), INT8_C( -48), INT8_C(  94), INT8_C( -12), INT8_C( 114), INT8_C( 105), INT8_C( -64), INT8_C( -47), INT8_C( -90), INT8_C( -17), INT8_C(  60), INT8_C(-117), INT8_C(  91), INT8_C(  18),
+        INT8_C(-128), INT8_C( -89), INT8_C(-127), INT8_C( 110), INT8_C(  -9), INT8_C( -32), INT8_C(  20), INT8_C(-100), INT8_C(-107), INT8_C( -13), INT8_C(   8), INT8_C(  94), INT8_C(  97), INT8_C( -78), INT8_C( -67), INT8_C( -74),
+        INT8_C(  65), INT8_C(  24), INT8_C(  21), INT8_C( -25), INT8_C(-115), INT8_C(  91), INT8_C(-125), INT8_C(   7), INT8_C( -36), INT8_C(-111), INT8_C(  81), INT8_C( -52), INT8_C( -60), INT8_C(  86), INT8_C( -40), INT8_C(  13),
+        INT8_C(  83), INT8_C(  29), INT8_C( -51), INT8_C(  -6), INT8_C( -49), INT8_C(  -8), INT8_C(-123), INT8_C( -36), INT8_C(-113), INT8_C( -82), INT8_C( -19), INT8_C(  19), INT8_C( -68), INT8_C(  82), INT8_C( -37), INT8_C(  16) },
+      { INT8_C(-124), INT8_C( 119), INT8_C(-124), INT8_C(-105), INT8_C( 126), INT8_C( -51), INT8_C(  80), INT8_C( -71), INT8_C(-122), INT8_C(  10), INT8_C(   1), INT8_C(-114), INT8_C(  58), INT8_C(  89), INT8_C( -35), INT8_C( -91),
+        INT8_C(  45), INT8_C( 123), INT8_C( -27), INT8_C(-128), INT8_C( -11), INT8_C( 115), INT8_C(  31), INT8_C(  48), INT8_C(-123), INT8_C(  40), INT8_C(  -6), INT8_C( 104), INT8_C(  99), INT8_C(  93), INT8_C(  90), INT8_C(-118),
+        INT8_C(-102), INT8_C( -56), INT8_C(  57), INT8_C( -64), INT8_C( -22), INT8_C(-108), INT8_C( 123), INT8_C(  12), INT8_C( -69), INT8_C(  24), INT8_C(  94), INT8_C(-109), INT8_C( -51), INT8_C(  75), INT8_C( -21), INT8_C(  60),
+        INT8_C(  82), INT8_C( 126), INT8_C( -24), INT8_C(  57), INT8_C( 103), INT8_C(  44), INT8_C(-114), INT8_C( -78), INT8_C(  84), INT8_C(   5), INT8_C( -63), INT8_C(  45), INT8_C(  -2), INT8_C(  28), INT8_C( -66), INT8_C( -44) },
+      { INT8_C(  -8), INT8_C(  51), INT8_C(  60), INT8_C(  34), INT8_C( -28), INT8_C(  11), INT8_C(  44), INT8_C( -61), INT8_C(-116), INT8_C( -43), INT8_C( -42), INT8_C(  50), INT8_C( -30), INT8_C( 109), INT8_C( 106), INT8_C( -19),
+        INT8_C( -73), INT8_C( -37), INT8_C(-115), INT8_C( -41), INT8_C(  38), INT8_C( -69), INT8_C(  22), INT8_C(  79), INT8_C(  22), INT8_C(  84), INT8_C( -25), INT8_C(  24), INT8_C(  32), INT8_C( 102), INT8_C(  71), INT8_C(  31),
+        INT8_C(  37), INT8_C(  71), INT8_C( -22), INT8_C( -62), INT8_C(   6), INT8_C(  -2), INT8_C(  26), INT8_C(-117), INT8_C(-125), INT8_C(  22), INT8_C( -13), INT8_C( -91), INT8_C(-101), INT8_C(  58), INT8_C(  83), INT8_C( -51),
+        INT8_C( -78), INT8_C(  35), INT8_C(-123), INT8_C( 101), INT8_C(  77), INT8_C( 125), INT8_C( -16), INT8_C( -77), INT8_C(  -5), INT8_C( -88), INT8_C( 116), INT8_C(  82), INT8_C(  68), INT8_C(  64), INT8_C( -14), INT8_C(  34) },
+      { INT8_C(  -1), INT8_C( -64), INT8_C( -33), INT8_C( -51), INT8_C(  19), INT8_C( -56), INT8_C( -81), INT8_C(  52), INT8_C( 109), INT8_C(   8), INT8_C( -43), INT8_C(-102), INT8_C(  64), INT8_C(   3), INT8_C( -89), INT8_C( -41),
+        INT8_C( -30), INT8_C(-108), INT8_C( -83), INT8_C( -12), INT8_C(  93), INT8_C( -26), INT8_C(  67), INT8_C(  42), INT8_C( 111), INT8_C( -89), INT8_C(  61), INT8_C(-110), INT8_C( -90), INT8_C(  14), INT8_C(   1), INT8_C(  -1),
+        INT8_C(-106), INT8_C( -24), INT8_C( -24), INT8_C( -12), INT8_C(  14), INT8_C( -99), INT8_C( -32), INT8_C(-113), INT8_C(  51), INT8_C( -58), INT8_C(  21), INT8_C(  79), INT8_C(  41), INT8_C(  -1), INT8_C(   6), INT8_C(  79),
+        INT8_C(  24), INT8_C( -64), INT8_C(  28), INT8_C(-105), INT8_C(  53), INT8_C(  70), INT8_C( 124), INT8_C( -73), INT8_C(  -7), INT8_C(  59), INT8_C( -87), INT8_C(  39), INT8_C( 118), INT8_C( 126), INT8_C( -52), INT8_C(  63) },
+      { INT8_C(  62), INT8_C(-106), INT8_C( -44), INT8_C( -60), INT8_C(  46), INT8_C(  -2), INT8_C(-106), INT8_C( 100), INT8_C(  19), INT8_C( -10), INT8_C(  67), INT8_C(  68), INT8_C(  79), INT8_C( -49), INT8_C( -43), INT8_C( -26),
+        INT8_C( -98), INT8_C(  33), INT8_C(   4), INT8_C(  91), INT8_C(-109), INT8_C( -17), INT8_C( -65), INT8_C( -79), INT8_C(  16), INT8_C(  -5), INT8_C( 107), INT8_C(  46), INT8_C( 120), INT8_C(  54), INT8_C( -58), INT8_C(  53),
+        INT8_C( -49), INT8_C( -57), INT8_C( -73), INT8_C( -94), INT8_C(  -5), INT8_C( 122), INT8_C(  96), INT8_C( 115), INT8_C( -34), INT8_C(  -8), INT8_C( -28), INT8_C( -53), INT8_C(   0), INT8_C(  22), INT8_C(  -7), INT8_C( 126),
+        INT8_C(   4), INT8_C(  43), INT8_C( 111), INT8_C(  65), INT8_C( 101), INT8_C(  61), INT8_C(  15), INT8_C(   0), INT8_C( -39), INT8_C(  73), INT8_C(  19), INT8_C(  -3), INT8_C( -32), INT8_C( -74), INT8_C( -33), INT8_C( -72) },
+      { INT8_C( -30), INT8_C( -63), INT8_C(  15), INT8_C(  23), INT8_C(  49), INT8_C(-112), INT8_C( 122), INT8_C( 127), INT8_C(  -3), INT8_C(  58), INT8_C( -73), INT8_C(  99), INT8_C( -11), INT8_C( -54), INT8_C(  19), INT8_C(  21),
+        INT8_C(  16), INT8_C( -48), INT8_C( -55), INT8_C(-108), INT8_C(-105), INT8_C( -54), INT8_C(  65), INT8_C(  13), INT8_C( 113), INT8_C(  98), INT8_C(  39), INT8_C(  -9), INT8_C(  61), INT8_C( -82), INT8_C( -92), INT8_C(  -6),
+        INT8_C(-127), INT8_C(  72), INT8_C( -27), INT8_C(  13), INT8_C(  98), INT8_C(  98), INT8_C(  14), INT8_C( -76), INT8_C( -40), INT8_C(-118), INT8_C(-128), INT8_C( 100), INT8_C(-107), INT8_C(-103), INT8_C(  49), INT8_C( -90),
+        INT8_C( -40), INT8_C( -76), INT8_C( 117), INT8_C( -82), INT8_C( 120), INT8_C(  93), INT8_C( -52), INT8_C(  10), INT8_C( 103), INT8_C( -18), INT8_C(-116), INT8_C(-100), INT8_C( 105), INT8_C( 105), INT8_C( -89), INT8_C(  15) } },
+      { { INT32_C( 1519397448), INT32_C(  342821480), INT32_C(  101395003), INT32_C(-1314833748), INT32_C( -672297072), INT32_C(-1720824080), INT32_C( 1871776234), INT32_C( -786446549),
+        INT32_C( -209996661), INT32_C( -757041328), INT32_C(-1287952193), INT32_C(-1639821930), INT32_C(-1594446026), INT32_C( 1185287883), INT32_C(  694643134), INT32_C( 1681891496) },
+      { INT32_C(-2082213433), INT32_C(-1164884513), INT32_C( 1218121576), INT32_C( 1737485499), INT32_C( -985357946), INT32_C( 2028129786), INT32_C(  264594536), INT32_C(  -67396638),
+        INT32_C(  110561856), INT32_C( 2116297089), INT32_C( 1594547705), INT32_C(   24448600), INT32_C(-1565446711), INT32_C(  650258821), INT32_C(  823407039), INT32_C(   42673661) },
+      { INT32_C( -211505054), INT32_C( -327417794), INT32_C( -294963600), INT32_C( -519779932), INT32_C(-1874523152), INT32_C(-1023587816), INT32_C( 1294730860), INT32_C( -309259005),
+        INT32_C( 1950200570), INT32_C(  732785012), INT32_C(-1444941583), INT32_C(-1024611015), INT32_C(  236916941), INT32_C(-1444495676), INT32_C(  266013434), INT32_C(-1336966956) },
+      { INT32_C( -247362391), INT32_C( -489571692), INT32_C( -242332192), INT32_C( 1503470894), INT32_C( 1977361530), INT32_C(-2007937450), INT32_C( -421619395), INT32_C(-1740460110),
+        INT32_C( 1251538949), INT32_C( 1356286963), INT32_C(-1468849372), INT32_C(  543465015), INT32_C( 1438856578), INT32_C( -383375802), INT32_C(  170996184), INT32_C( 1416554921) },
+      { INT32_C(  492113804), INT32_C( 2019201352), INT32_C(-1344062087), INT32_C( -640497394), INT32_C(-1706300185), INT32_C(-1218184667), INT32_C(-2088972146), INT32_C(-2040568567),
+        INT32_C(-1923270042), INT32_C( 1574200618), INT32_C(  -83271177), INT32_C(-1729045136), INT32_C( 2114466372), INT32_C(  800968067), INT32_C(    2931035), INT32_C( -451824058) },
+      { INT32_C( 1588942997), INT32_C(  682254642), INT32_C( -783142896), INT32_C(-1581413277), INT32_C(-1066249260), INT32_C( -704882023), INT32_C( 1194106737), INT32_C(  283103394),
+        INT32_C(  481275938), INT32_C(  372671501), INT32_C(  141504703), INT32_C(-1405563670), INT32_C(-2117721080), INT32_C( -445597829), INT32_C( 1054432466), INT32_C( -974418696) } },
+      { { INT32_C( 1519410070), INT32_C(  342790372), INT32_C(  101387622), INT32_C(-1314870590), INT32_C( -672272414), INT32_C(-1720907598), INT32_C( 1871804666), INT32_C( -786418506),
+        INT32_C( -209942774), INT32_C( -756977577), INT32_C(-1287957052), INT32_C(-1639785794), INT32_C(-1594408552), INT32_C( 1185263026), INT32_C(  694633662), INT32_C( 1681895644) },
+      { INT32_C(-2082233723), INT32_C(-1164918247), INT32_C( 1218180447), INT32_C( 1737463010), INT32_C( -985343177), INT32_C( 2028164999), INT32_C(  264631118), INT32_C(  -67399906),
+        INT32_C(  110542788), INT32_C( 2116358719), INT32_C( 1594483098), INT32_C(   24445731), INT32_C(-1565493917), INT32_C(  650326550), INT32_C(  823457032), INT32_C(   42713916) },
+      { INT32_C( -211443657), INT32_C( -327363601), INT32_C( -294966552), INT32_C( -519786201), INT32_C(-1874530016), INT32_C(-1023560924), INT32_C( 1294744318), INT32_C( -309266657),
+        INT32_C( 1950214473), INT32_C(  732787758), INT32_C(-1444968741), INT32_C(-1024657722), INT32_C(  236946477), INT32_C(-1444499032), INT32_C(  266008277), INT32_C(-1336964835) },
+      { INT32_C( -247436019), INT32_C( -489544471), INT32_C( -242284493), INT32_C( 1503454108), INT32_C( 1977355081), INT32_C(-2007823219), INT32_C( -421601309), INT32_C(-1740416988),
+        INT32_C( 1251589977), INT32_C( 1356337664), INT32_C(-1468833503), INT32_C(  543540978), INT32_C( 1438925366), INT32_C( -383373676), INT32_C(  170926143), INT32_C( 1416557505) },
+      { INT32_C(  492090084), INT32_C( 2019198715), INT32_C(-1344027255), INT32_C( -640486516), INT32_C(-1706211546), INT32_C(-1218227456), INT32_C(-2088912205), INT32_C(-2040555364),
+        INT32_C(-1923284647), INT32_C( 1574312102), INT32_C(  -83240750), INT32_C(-1729079107), INT32_C( 2114487884), INT32_C(  800987963), INT32_C(    2963085), INT32_C( -451849949) },
+      { INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int32_t r[6][16];
+
+    simde_test_amx_config(test_vec[i].m, test_vec[i].k, test_vec[i].n);
+    simde_tile_loadd(0, test_vec[i].c, sizeof(test_vec[i].c[0]));
+    simde_tile_loadd(1, test_vec[i].a, sizeof(test_vec[i].a[0]));
+    simde_tile_loadd(2, test_vec[i].b, sizeof(test_vec[i].b[0]));
+    simde_tile_dpbssd(0, 1, 2);
+    simde_memset(r, 0, sizeof(r));
+    simde_tile_stored(0, r, sizeof(r[0]));
+    simde_tile_release();
+
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) {
+      simde_assert_equal_vi32(sizeof(r[j]) / sizeof(r[j][0]), r[j], test_vec[i].r[j]);
+    }
+  }
+
+  return 0;
+}
+
+static int
+test_simde_tile_dpbsud (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const uint8_t m;
+    const uint8_t k;
+    const uint8_t n;
+    const int8_t a[6][64];
+    const uint8_t b[16][64];
+    const int32_t c[6][16];
+    const int32_t r[6][16];
+  } test_vec[] = {
+    { 6, 8, 5,
+      { { INT8_C(  13), INT8_C(  -2), INT8_C( -22), INT8_C(   1), INT8_C( -99), INT8_C(  54), INT8_C(  61), INT8_C( -82), INT8_C( 105), INT8_C(-116), INT8_C( -92), INT8_C( 120), INT8_C( -37), INT8_C( 100), INT8_C(  65), INT8_C( -88),
+        INT8_C( 106), INT8_C( 125), INT8_C( -55), INT8_C( -93), INT8_C(  38), INT8_C(  23), INT8_C(-106), INT8_C( 116), INT8_C( 122), INT8_C( -22), INT8_C( -55), INT8_C(  70), INT8_C(  -3), INT8_C(   5), INT8_C( -11), INT8_C( -55),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C( -43), INT8_C(  86), INT8_C( 118), INT8_C( -69), INT8_C( 126), INT8_C(-106), INT8_C( -53), INT8_C( -62), INT8_C( -53), INT8_C( -54), INT8_C( -50), INT8_C( -49), INT8_C( 100), INT8_C(  77), INT8_C(  72), INT8_C( 106),
+        INT8_C( -28), INT8_C( -48), INT8_C(   9), INT8_C( 118), INT8_C( -20), INT8_C(  19), INT8_C(   8), INT8_C( -77), INT8_C(  32), INT8_C(  37), INT8_C(  -5), INT8_C(  99), INT8_C(-101), INT8_C(  -7), INT8_C( -49), INT8_C(  75),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C(  99), INT8_C(  21), INT8_C(  61), INT8_C( -32), INT8_C(   0), INT8_C( -60), INT8_C( -97), INT8_C( -11), INT8_C(-107), INT8_C(  72), INT8_C(-111), INT8_C(  22), INT8_C( -32), INT8_C(  64), INT8_C(  11), INT8_C( 113),
+        INT8_C(  58), INT8_C(  -5), INT8_C(-127), INT8_C( 106), INT8_C( 102), INT8_C(  23), INT8_C(  35), INT8_C( -20), INT8_C( -78), INT8_C( -24), INT8_C( 108), INT8_C( -37), INT8_C(  74), INT8_C(  16), INT8_C( -57), INT8_C( -30),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C(  94), INT8_C(  47), INT8_C(  80), INT8_C(  43), INT8_C( -43), INT8_C( -29), INT8_C(  19), INT8_C( 116), INT8_C(-107), INT8_C(-119), INT8_C(  -4), INT8_C( -46), INT8_C( -55), INT8_C( -18), INT8_C( -35), INT8_C( -57),
+        INT8_C( -42), INT8_C(  92), INT8_C( -39), INT8_C(  -1), INT8_C(  66), INT8_C(-121), INT8_C( -86), INT8_C(  26), INT8_C( 103), INT8_C(-119), INT8_C(  -5), INT8_C(-101), INT8_C( 123), INT8_C(  60), INT8_C(  82), INT8_C( -46),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C(  64), INT8_C( -14), INT8_C(  87), INT8_C(   1), INT8_C(  51), INT8_C(  42), INT8_C(-100), INT8_C(  34), INT8_C(  84), INT8_C(  57), INT8_C(  45), INT8_C(  77), INT8_C(  86), INT8_C( -51), INT8_C( 116), INT8_C( 120),
+        INT8_C( 105), INT8_C(  88), INT8_C( -27), INT8_C(  82), INT8_C( 125), INT8_C( -37), INT8_C(-127), INT8_C( 101), INT8_C( -81), INT8_C( -53), INT8_C( -55), INT8_C(  32), INT8_C( 121), INT8_C(-123), INT8_C( -49), INT8_C(-118),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C( 106), INT8_C(   6), INT8_C( -45), INT8_C(  18), INT8_C( 113), INT8_C(  81), INT8_C( -46), INT8_C( -10), INT8_C( -65), INT8_C(  49), INT8_C(-112), INT8_C( -12), INT8_C( -42), INT8_C( -55), INT8_C(  57), INT8_C(  96),
+        INT8_C( -65), INT8_C(  89), INT8_C(  81), INT8_C( 125), INT8_C( 105), INT8_C(  97), INT8_C( -67), INT8_C(  62), INT8_C(  -8), INT8_C(-111), INT8_C( -73), INT8_C(-115), INT8_C(  37), INT8_C(  57), INT8_C(  66), INT8_C(  23),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) } },
+      { { UINT8_C(150), UINT8_C(229), UINT8_C( 92), UINT8_C(231), UINT8_C(113), UINT8_C( 25), UINT8_C(173), UINT8_C(144), UINT8_C( 86), UINT8_C(249), UINT8_C( 94), UINT8_C( 72), UINT8_C(255), UINT8_C( 53), UINT8_C(116), UINT8_C(117),
+        UINT8_C(152), UINT8_C( 86), UINT8_C(248), UINT8_C(121), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C( 45), UINT8_C(165), UINT8_C(  2), UINT8_C( 22), UINT8_C(154), UINT8_C( 62), UINT8_C( 43), UINT8_C( 16), UINT8_C( 71), UINT8_C(157), UINT8_C(224), UINT8_C(103), UINT8_C(145), UINT8_C(168), UINT8_C(230), UINT8_C( 80),
+        UINT8_C(165), UINT8_C(188), UINT8_C(141), UINT8_C(161), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C(124), UINT8_C(108), UINT8_C( 53), UINT8_C(233), UINT8_C(161), UINT8_C(130), UINT8_C(243), UINT8_C(134), UINT8_C(137), UINT8_C( 90), UINT8_C( 13), UINT8_C(228), UINT8_C(141), UINT8_C(101), UINT8_C(154), UINT8_C( 31),
+        UINT8_C(245), UINT8_C(122), UINT8_C( 19), UINT8_C( 77), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C(189), UINT8_C( 20), UINT8_C(104), UINT8_C( 46), UINT8_C( 33), UINT8_C(133), UINT8_C( 30), UINT8_C( 52), UINT8_C(165), UINT8_C(178), UINT8_C( 91), UINT8_C( 86), UINT8_C(182), UINT8_C( 48), UINT8_C(144), UINT8_C(171),
+        UINT8_C(120), UINT8_C( 40), UINT8_C(121), UINT8_C( 17), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C(115), UINT8_C(238), UINT8_C(182), UINT8_C(123), UINT8_C(203), UINT8_C(211), UINT8_C(115), UINT8_C(180), UINT8_C( 76), UINT8_C(102), UINT8_C(209), UINT8_C( 64), UINT8_C(202), UINT8_C(211), UINT8_C( 47), UINT8_C( 41),
+        UINT8_C(178), UINT8_C( 68), UINT8_C(237), UINT8_C( 76), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C( 72), UINT8_C(133), UINT8_C(223), UINT8_C(188), UINT8_C(244), UINT8_C( 87), UINT8_C(  4), UINT8_C(244), UINT8_C(120), UINT8_C(200), UINT8_C(  3), UINT8_C(136), UINT8_C( 13), UINT8_C( 20), UINT8_C(176), UINT8_C(228),
+        UINT8_C(127), UINT8_C(237), UINT8_C( 50), UINT8_C( 66), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C(186), UINT8_C(247), UINT8_C( 18), UINT8_C(170), UINT8_C(178), UINT8_C(110), UINT8_C(205), UINT8_C(182), UINT8_C(220), UINT8_C(183), UINT8_C(222), UINT8_C( 99), UINT8_C(237), UINT8_C( 10), UINT8_C(242), UINT8_C(158),
+        UINT8_C( 11), UINT8_C( 54), UINT8_C(237), UINT8_C( 24), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C(176), UINT8_C(225), UINT8_C(154), UINT8_C(138), UINT8_C( 46), UINT8_C( 75), UINT8_C(144), UINT8_C(128), UINT8_C(182), UINT8_C(146), UINT8_C(111), UINT8_C( 43), UINT8_C(168), UINT8_C(169), UINT8_C(245), UINT8_C(254),
+        UINT8_C( 58), UINT8_C(130), UINT8_C( 25), UINT8_C(223), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C(164), UINT8_C(191), UINT8_C( 43), UINT8_C( 98), UINT8_C(227), UINT8_C( 18), UINT8_C(134), UINT8_C(101), UINT8_C(254), UINT8_C(175), UINT8_C( 68), UINT8_C(117), UINT8_C(251), UINT8_C(116), UINT8_C(224), UINT8_C(242),
+        UINT8_C(124), UINT8_C(120), UINT8_C( 78), UINT8_C( 61), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C( 96), UINT8_C(  1), UINT8_C( 85), UINT8_C( 69), UINT8_C( 78), UINT8_C(168), UINT8_C( 68), UINT8_C(189), UINT8_C(151), UINT8_C(211), UINT8_C( 51), UINT8_C(159), UINT8_C(183), UINT8_C( 29), UINT8_C(  6), UINT8_C(247),
+        UINT8_C(109), UINT8_C( 33), UINT8_C(119), UINT8_C(147), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C( 51), UINT8_C( 15), UINT8_C(248), UINT8_C(190), UINT8_C( 84), UINT8_C( 64), UINT8_C(174), UINT8_C( 33), UINT8_C( 10), UINT8_C(208), UINT8_C( 71), UINT8_C(220), UINT8_C( 13), UINT8_C(249), UINT8_C(185), UINT8_C( 22),
+        UINT8_C( 48), UINT8_C(197), UINT8_C( 22), UINT8_C(147), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C( 77), UINT8_C(173), UINT8_C(120), UINT8_C( 78), UINT8_C(192), UINT8_C( 51), UINT8_C(189), UINT8_C(160), UINT8_C(221), UINT8_C( 93), UINT8_C(133), UINT8_C(246), UINT8_C(172), UINT8_C(253), UINT8_C(219), UINT8_C(157),
+        UINT8_C(220), UINT8_C(146), UINT8_C( 71), UINT8_C(  1), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C( 98), UINT8_C( 36), UINT8_C(189), UINT8_C( 84), UINT8_C( 28), UINT8_C(232), UINT8_C( 95), UINT8_C(146), UINT8_C(159), UINT8_C( 39), UINT8_C(183), UINT8_C(169), UINT8_C(193), UINT8_C( 94), UINT8_C(151), UINT8_C( 53),
+        UINT8_C( 18), UINT8_C(153), UINT8_C(101), UINT8_C( 91), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C(126), UINT8_C( 16), UINT8_C(100), UINT8_C( 78), UINT8_C(152), UINT8_C(252), UINT8_C(193), UINT8_C( 64), UINT8_C(249), UINT8_C(162), UINT8_C(198), UINT8_C(115), UINT8_C(106), UINT8_C(208), UINT8_C(160), UINT8_C( 51),
+        UINT8_C(128), UINT8_C(213), UINT8_C(107), UINT8_C(106), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C( 41), UINT8_C(224), UINT8_C(  8), UINT8_C(131), UINT8_C(227), UINT8_C( 16), UINT8_C( 31), UINT8_C( 93), UINT8_C(129), UINT8_C(231), UINT8_C(163), UINT8_C( 93), UINT8_C(  8), UINT8_C( 13), UINT8_C(213), UINT8_C( 59),
+        UINT8_C(193), UINT8_C( 56), UINT8_C(136), UINT8_C(234), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C(152), UINT8_C(212), UINT8_C(134), UINT8_C( 19), UINT8_C(251), UINT8_C(179), UINT8_C( 82), UINT8_C(110), UINT8_C( 72), UINT8_C(126), UINT8_C( 94), UINT8_C(167), UINT8_C(191), UINT8_C(195), UINT8_C(237), UINT8_C(210),
+        UINT8_C(217), UINT8_C( 61), UINT8_C(215), UINT8_C(144), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) } },
+      { { INT32_C(-1181245679), INT32_C(-2130723240), INT32_C( 1021161011), INT32_C( 2001574885), INT32_C(  -54771230), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C(-1503094926), INT32_C(-1325780140), INT32_C( 2039654392), INT32_C(-1677575944), INT32_C( 1613505915), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C( 1609638779), INT32_C(  634179175), INT32_C( -984478837), INT32_C(  125055239), INT32_C(-1167923659), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C( 1683865103), INT32_C( 1031827308), INT32_C(  397234814), INT32_C(  478536219), INT32_C( -576671238), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C( 2074484885), INT32_C( 1739781390), INT32_C(  226882281), INT32_C( -800829005), INT32_C(-1550313229), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C( -850588108), INT32_C( 1443467416), INT32_C(  435593912), INT32_C(-1539235652), INT32_C( 1865707701), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) } },
+      { { INT32_C(-1181177975), INT32_C(-2130654713), INT32_C( 1021248562), INT32_C( 2001623120), INT32_C(  -54763918), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C(-1503088535), INT32_C(-1325767254), INT32_C( 2039668454), INT32_C(-1677580451), INT32_C( 1613524802), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C( 1609630423), INT32_C(  634199316), INT32_C( -984476408), INT32_C(  125053126), INT32_C(-1167910564), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C( 1683847209), INT32_C( 1031825047), INT32_C(  397230559), INT32_C(  478568272), INT32_C( -576711526), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C( 2074558024), INT32_C( 1739909568), INT32_C(  226939139), INT32_C( -800758686), INT32_C(-1550237251), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C( -850518966), INT32_C( 1443514933), INT32_C(  435642035), INT32_C(-1539181052), INT32_C( 1865779851), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) } } },
+    { 5, 16, 16,
+      { { INT8_C(-104), INT8_C(  41), INT8_C( -15), INT8_C( 107), INT8_C(  80), INT8_C( 108), INT8_C(  28), INT8_C(  48), INT8_C(   6), INT8_C( -60), INT8_C(  72), INT8_C( -23), INT8_C(  25), INT8_C(  41), INT8_C(-106), INT8_C(  75),
+        INT8_C( -47), INT8_C( -72), INT8_C( -37), INT8_C(  93), INT8_C( -78), INT8_C( -16), INT8_C(  30), INT8_C(-103), INT8_C( 126), INT8_C( -35), INT8_C(  28), INT8_C(-120), INT8_C( -97), INT8_C( -22), INT8_C(  -5), INT8_C(  25),
+        INT8_C( 107), INT8_C( -76), INT8_C( -62), INT8_C( -29), INT8_C( 122), INT8_C(  14), INT8_C( -93), INT8_C( -94), INT8_C( -62), INT8_C( -87), INT8_C( 126), INT8_C(  84), INT8_C( -35), INT8_C(  77), INT8_C(  94), INT8_C( 105),
+        INT8_C( 111), INT8_C(  30), INT8_C(  92), INT8_C( -77), INT8_C(  -6), INT8_C(  39), INT8_C( -89), INT8_C( 109), INT8_C( -59), INT8_C(  -5), INT8_C( -16), INT8_C( -82), INT8_C(  88), INT8_C( 106), INT8_C(  43), INT8_C(  37) },
+      { INT8_C( -22), INT8_C( 104), INT8_C(-120), INT8_C(  80), INT8_C( -40), INT8_C( -60), INT8_C( -76), INT8_C( 111), INT8_C( -77), INT8_C( -85), INT8_C(-102), INT8_C(  -7), INT8_C(-126), INT8_C(  17), INT8_C( -46), INT8_C(  15),
+        INT8_C(  74), INT8_C( -96), INT8_C( -18), INT8_C( -34), INT8_C( -69), INT8_C(  19), INT8_C(  67), INT8_C( -57), INT8_C(  59), INT8_C(  24), INT8_C(  22), INT8_C( -14), INT8_C( -82), INT8_C(-100), INT8_C( -50), INT8_C(  73),
+        INT8_C(  94), INT8_C(  75), INT8_C(-111), INT8_C(  48), INT8_C( -20), INT8_C(-123), INT8_C( -70), INT8_C(  20), INT8_C( -66), INT8_C(  13), INT8_C( -48), INT8_C(  65), INT8_C( -53), INT8_C(  97), INT8_C( 108), INT8_C( -59),
+        INT8_C(  93), INT8_C( -25), INT8_C(  -1), INT8_C( 110), INT8_C( -51), INT8_C(-117), INT8_C( -52), INT8_C(  57), INT8_C(-106), INT8_C(  49), INT8_C( -11), INT8_C( 101), INT8_C(  45), INT8_C(  79), INT8_C( -20), INT8_C(   3) },
+      { INT8_C(  22), INT8_C(  -4), INT8_C( -43), INT8_C(  48), INT8_C( -14), INT8_C(  -7), INT8_C(  24), INT8_C( -14), INT8_C(-111), INT8_C( -44), INT8_C(-126), INT8_C(  42), INT8_C(  65), INT8_C(  39), INT8_C( -95), INT8_C(-101),
+        INT8_C(  22), INT8_C(  80), INT8_C( 116), INT8_C( -20), INT8_C(  12), INT8_C( -92), INT8_C( 114), INT8_C(-100), INT8_C( -59), INT8_C( 125), INT8_C(   1), INT8_C(-118), INT8_C( 127), INT8_C(  -3), INT8_C(-126), INT8_C( -40),
+        INT8_C( -54), INT8_C( -26), INT8_C( 109), INT8_C(  79), INT8_C(  20), INT8_C( -46), INT8_C( -29), INT8_C( 110), INT8_C( 119), INT8_C(  35), INT8_C(-117), INT8_C(  30), INT8_C(  74), INT8_C( -73), INT8_C( -58), INT8_C(  53),
+        INT8_C(  80), INT8_C(  11), INT8_C( 103), INT8_C(  70), INT8_C( -98), INT8_C(-128), INT8_C( -84), INT8_C( -36), INT8_C( -28), INT8_C( -23), INT8_C( -89), INT8_C( -50), INT8_C(  47), INT8_C(  50), INT8_C( -18), INT8_C( -57) },
+      { INT8_C(  29), INT8_C(  65), INT8_C(  71), INT8_C(  36), INT8_C(  10), INT8_C( -31), INT8_C( 104), INT8_C( -95), INT8_C( -17), INT8_C(  94), INT8_C(  26), INT8_C( 100), INT8_C( -94), INT8_C( -61), INT8_C(  12), INT8_C( -59),
+        INT8_C(  80), INT8_C(-122), INT8_C( -85), INT8_C(  85), INT8_C( -39), INT8_C( -87), INT8_C(  32), INT8_C(  74), INT8_C( -18), INT8_C(  -1), INT8_C( -87), INT8_C(  56), INT8_C( -91), INT8_C(  -2), INT8_C( -43), INT8_C( -31),
+        INT8_C( 125), INT8_C( -66), INT8_C( 109), INT8_C(  37), INT8_C(  67), INT8_C( -14), INT8_C(  48), INT8_C(  46), INT8_C( -81), INT8_C(  43), INT8_C( -64), INT8_C( 107), INT8_C( 116), INT8_C( -13), INT8_C( -79), INT8_C( -46),
+        INT8_C(  11), INT8_C( -49), INT8_C( -59), INT8_C(  39), INT8_C(  17), INT8_C( -14), INT8_C( 114), INT8_C(  94), INT8_C( -88), INT8_C(  58), INT8_C( 106), INT8_C( 125), INT8_C(  37), INT8_C( -23), INT8_C(  38), INT8_C( 111) },
+      { INT8_C(  -4), INT8_C(  53), INT8_C(  34), INT8_C( -50), INT8_C(  17), INT8_C( -53), INT8_C( -46), INT8_C( -48), INT8_C(  66), INT8_C( -50), INT8_C(   9), INT8_C(-126), INT8_C(  -4), INT8_C(  51), INT8_C(-124), INT8_C(  14),
+        INT8_C( -70), INT8_C(  52), INT8_C(  40), INT8_C(  48), INT8_C( 111), INT8_C(   8), INT8_C(  33), INT8_C( -44), INT8_C(-121), INT8_C(  59), INT8_C( -14), INT8_C(  92), INT8_C(  26), INT8_C( -35), INT8_C(  20), INT8_C(  -2),
+        INT8_C( -89), INT8_C( 109), INT8_C( -69), INT8_C(  60), INT8_C(  -2), INT8_C(  20), INT8_C( -88), INT8_C( 114), INT8_C( 123), INT8_C(  77), INT8_C(  24), INT8_C(  86), INT8_C( -24), INT8_C(-118), INT8_C( -50), INT8_C( 123),
+        INT8_C( -66), INT8_C(  10), INT8_C( -66), INT8_C( -22), INT8_C(-124), INT8_C( -37), INT8_C( -79), INT8_C( -55), INT8_C(  69), INT8_C(-122), INT8_C(  85), INT8_C( 101), INT8_C(  92), INT8_C( -95), INT8_C( -78), INT8_C( -76) },
+      { INT8_C( -36), INT8_C(-104), INT8_C( -13), INT8_C( -83), INT8_C( 119), INT8_C(  24), INT8_C( -92), INT8_C(  34), INT8_C( -48), INT8_C( 110), INT8_C(  59), INT8_C(  89), INT8_C( -81), INT8_C( -66), INT8_C(  26), INT8_C(-125),
+        INT8_C(  44), INT8_C( -50), INT8_C(  91), INT8_C(  75), INT8_C(   0), INT8_C(  85), INT8_C(  35), INT8_C(-126), INT8_C( -34), INT8_C(  64), INT8_C( -66), INT8_C( -48), INT8_C(  24), INT8_C(  75), INT8_C(  19), INT8_C( -51),
+        INT8_C(  84), INT8_C( -83), INT8_C( -33), INT8_C(  41), INT8_C( 103), INT8_C(  65), INT8_C( -21), INT8_C( -11), INT8_C(  51), INT8_C(-118), INT8_C(-100), INT8_C(  98), INT8_C( -92), INT8_C(-111), INT8_C(  80), INT8_C(-102),
+        INT8_C(  88), INT8_C( 109), INT8_C(  57), INT8_C(-128), INT8_C( 100), INT8_C( -81), INT8_C(  22), INT8_C(  67), INT8_C( -17), INT8_C(  76), INT8_C( -88), INT8_C( 115), INT8_C( -37), INT8_C( -34), INT8_C(  83), INT8_C( -47) } },
+      { { UINT8_C(237), UINT8_C(205), UINT8_C(199), UINT8_C(199), UINT8_C( 79), UINT8_C(194), UINT8_C( 91), UINT8_C( 56), UINT8_C(198), UINT8_C(132), UINT8_C( 92), UINT8_C(123), UINT8_C(158), UINT8_C( 44), UINT8_C(106), UINT8_C(240),
+        UINT8_C(252), UINT8_C(178), UINT8_C(166), UINT8_C(211), UINT8_C(223), UINT8_C( 67), UINT8_C( 34), UINT8_C(132), UINT8_C( 90), UINT8_C(214), UINT8_C(249), UINT8_C(151), UINT8_C( 92), UINT8_C(117), UINT8_C(220), UINT8_C( 79),
+        UINT8_C(112), UINT8_C(250), UINT8_C( 18), UINT8_C(108), UINT8_C(170), UINT8_C(185), UINT8_C(240), UINT8_C( 66), UINT8_C( 43), UINT8_C(156), UINT8_C(144), UINT8_C(229), UINT8_C( 71), UINT8_C(188), UINT8_C(185), UINT8_C( 16),
+        UINT8_C(107), UINT8_C( 22), UINT8_C(233), UINT8_C(144), UINT8_C(183), UINT8_C( 13), UINT8_C( 79), UINT8_C(186), UINT8_C(  7), UINT8_C(197), UINT8_C( 64), UINT8_C(211), UINT8_C(252), UINT8_C(177), UINT8_C(215), UINT8_C( 55) },
+      { UINT8_C(  4), UINT8_C( 48), UINT8_C(148), UINT8_C(234), UINT8_C(205), UINT8_C(214), UINT8_C( 12), UINT8_C(137), UINT8_C( 96), UINT8_C(177), UINT8_C(198), UINT8_C( 87), UINT8_C(  5), UINT8_C(114), UINT8_C( 81), UINT8_C( 39),
+        UINT8_C( 58), UINT8_C(216), UINT8_C( 46), UINT8_C( 98), UINT8_C(235), UINT8_C( 52), UINT8_C(  8), UINT8_C(232), UINT8_C( 89), UINT8_C(136), UINT8_C(132), UINT8_C(168), UINT8_C(173), UINT8_C(237), UINT8_C(158), UINT8_C(113),
+        UINT8_C(179), UINT8_C(166), UINT8_C( 39), UINT8_C(151), UINT8_C(  5), UINT8_C(132), UINT8_C(113), UINT8_C( 86), UINT8_C( 96), UINT8_C( 56), UINT8_C( 51), UINT8_C(101), UINT8_C( 69), UINT8_C(219), UINT8_C( 54), UINT8_C(103),
+        UINT8_C( 14), UINT8_C(201), UINT8_C(203), UINT8_C(219), UINT8_C(219), UINT8_C( 19), UINT8_C( 22), UINT8_C(232), UINT8_C(147), UINT8_C(185), UINT8_C(  2), UINT8_C(244), UINT8_C(114), UINT8_C( 82), UINT8_C(146), UINT8_C( 70) },
+      { UINT8_C(214), UINT8_C( 36), UINT8_C( 11), UINT8_C(220), UINT8_C( 87), UINT8_C( 83), UINT8_C(111), UINT8_C(242), UINT8_C(205), UINT8_C(  5), UINT8_C(190), UINT8_C(164), UINT8_C(192), UINT8_C(204), UINT8_C(245), UINT8_C(254),
+        UINT8_C( 92), UINT8_C(209), UINT8_C( 89), UINT8_C(255), UINT8_C(159), UINT8_C(108), UINT8_C(136), UINT8_C(141), UINT8_C(192), UINT8_C( 86), UINT8_C(169), UINT8_C( 84), UINT8_C(127), UINT8_C( 35), UINT8_C( 68), UINT8_C( 43),
+        UINT8_C(200), UINT8_C(247), UINT8_C( 70), UINT8_C( 11), UINT8_C(154), UINT8_C(194), UINT8_C( 57), UINT8_C(130), UINT8_C( 18), UINT8_C(100), UINT8_C( 93), UINT8_C(254), UINT8_C(140), UINT8_C( 54), UINT8_C(240), UINT8_C( 13),
+        UINT8_C(162), UINT8_C( 53), UINT8_C(212), UINT8_C( 43), UINT8_C( 90), UINT8_C(172), UINT8_C( 73), UINT8_C(112), UINT8_C(143), UINT8_C( 58), UINT8_C(127), UINT8_C(100), UINT8_C(206), UINT8_C(103), UINT8_C(217), UINT8_C(129) },
+      { UINT8_C(228), UINT8_C(172), UINT8_C( 23), UINT8_C( 70), UINT8_C(236), UINT8_C(148), UINT8_C( 26), UINT8_C(241), UINT8_C(217), UINT8_C(158), UINT8_C( 96), UINT8_C( 56), UINT8_C(150), UINT8_C(152), UINT8_C(206), UINT8_C(207),
+        UINT8_C( 26), UINT8_C(135), UINT8_C(169), UINT8_C(110), UINT8_C( 19), UINT8_C( 11), UINT8_C(187), UINT8_C(145), UINT8_C(186), UINT8_C(222), UINT8_C( 40), UINT8_C( 43), UINT8_C(224), UINT8_C(144), UINT8_C( 37), UINT8_C(189),
+        UINT8_C(253), UINT8_C(109), UINT8_C( 75), UINT8_C( 82), UINT8_C(166), UINT8_C( 79), UINT8_C( 86), UINT8_C( 49), UINT8_C(207), UINT8_C(110), UINT8_C(189), UINT8_C(120), UINT8_C( 63), UINT8_C(173), UINT8_C(198), UINT8_C(126),
+        UINT8_C(199), UINT8_C(249), UINT8_C( 70), UINT8_C(103), UINT8_C( 21), UINT8_C(179), UINT8_C(173), UINT8_C( 32), UINT8_C(149), UINT8_C(183), UINT8_C(127), UINT8_C(186), UINT8_C(174), UINT8_C( 37), UINT8_C(208), UINT8_C(220) },
+      { UINT8_C(233), UINT8_C(103), UINT8_C(112), UINT8_C( 16), UINT8_C( 43), UINT8_C(108), UINT8_C( 60), UINT8_C(131), UINT8_C(109), UINT8_C(224), UINT8_C(239), UINT8_C(181), UINT8_C( 39), UINT8_C(160), UINT8_C(112), UINT8_C(223),
+        UINT8_C(193), UINT8_C(235), UINT8_C(209), UINT8_C( 94), UINT8_C(241), UINT8_C( 33), UINT8_C( 99), UINT8_C(182), UINT8_C( 24), UINT8_C(162), UINT8_C(191), UINT8_C(103), UINT8_C(239), UINT8_C(  6), UINT8_C(157), UINT8_C( 47),
+        UINT8_C( 86), UINT8_C( 59), UINT8_C(241), UINT8_C(193), UINT8_C( 41), UINT8_C(199), UINT8_C(217), UINT8_C(204), UINT8_C(170), UINT8_C( 25), UINT8_C(210), UINT8_C(213), UINT8_C( 58), UINT8_C(158), UINT8_C(254), UINT8_C( 91),
+        UINT8_C(  9), UINT8_C( 17), UINT8_C(118), UINT8_C(135), UINT8_C(137), UINT8_C(162), UINT8_C( 91), UINT8_C(206), UINT8_C(193), UINT8_C(124), UINT8_C(124), UINT8_C(112), UINT8_C( 21), UINT8_C( 36), UINT8_C(  2), UINT8_C(  2) },
+      { UINT8_C(216), UINT8_C(159), UINT8_C(162), UINT8_C(243), UINT8_C(162), UINT8_C(187), UINT8_C(200), UINT8_C(124), UINT8_C( 84), UINT8_C(138), UINT8_C( 98), UINT8_C(175), UINT8_C( 29), UINT8_C(  0), UINT8_C( 30), UINT8_C( 89),
+        UINT8_C(136), UINT8_C(229), UINT8_C( 28), UINT8_C(215), UINT8_C(136), UINT8_C(242), UINT8_C( 64), UINT8_C(199), UINT8_C( 51), UINT8_C(243), UINT8_C( 49), UINT8_C(160), UINT8_C( 27), UINT8_C(195), UINT8_C( 27), UINT8_C( 25),
+        UINT8_C(  3), UINT8_C(113), UINT8_C( 56), UINT8_C(189), UINT8_C( 43), UINT8_C(163), UINT8_C( 94), UINT8_C( 85), UINT8_C(164), UINT8_C(177), UINT8_C( 72), UINT8_C(180), UINT8_C( 63), UINT8_C( 86), UINT8_C( 15), UINT8_C(106),
+        UINT8_C(155), UINT8_C( 10), UINT8_C(223), UINT8_C( 19), UINT8_C(130), UINT8_C(170), UINT8_C(241), UINT8_C( 26), UINT8_C(123), UINT8_C( 39), UINT8_C(202), UINT8_C( 25), UINT8_C(189), UINT8_C( 46), UINT8_C(238), UINT8_C(141) },
+      { UINT8_C( 44), UINT8_C( 40), UINT8_C(  4), UINT8_C(239), UINT8_C(130), UINT8_C( 65), UINT8_C(163), UINT8_C(199), UINT8_C(159), UINT8_C(104), UINT8_C( 64), UINT8_C(132), UINT8_C( 15), UINT8_C(143), UINT8_C(197), UINT8_C( 93),
+        UINT8_C(239), UINT8_C(175), UINT8_C( 63), UINT8_C( 97), UINT8_C(186), UINT8_C(145), UINT8_C(243), UINT8_C(223), UINT8_C( 55), UINT8_C(168), UINT8_C( 96), UINT8_C( 27), UINT8_C(151), UINT8_C( 99), UINT8_C(110), UINT8_C( 53),
+        UINT8_C(  7), UINT8_C(119), UINT8_C(111), UINT8_C(199), UINT8_C( 14), UINT8_C(236), UINT8_C( 74), UINT8_C( 95), UINT8_C(134), UINT8_C( 38), UINT8_C(124), UINT8_C( 68), UINT8_C( 73), UINT8_C(133), UINT8_C(254), UINT8_C( 34),
+        UINT8_C( 83), UINT8_C(209), UINT8_C( 38), UINT8_C( 99), UINT8_C(182), UINT8_C(246), UINT8_C( 97), UINT8_C( 87), UINT8_C(229), UINT8_C( 50), UINT8_C( 78), UINT8_C(236), UINT8_C( 95), UINT8_C( 39), UINT8_C(152), UINT8_C( 13) },
+      { UINT8_C(134), UINT8_C( 67), UINT8_C(121), UINT8_C(252), UINT8_C(135), UINT8_C(133), UINT8_C( 64), UINT8_C(213), UINT8_C( 56), UINT8_C(243), UINT8_C(254), UINT8_C( 34), UINT8_C( 73), UINT8_C(210), UINT8_C(214), UINT8_C(246),
+        UINT8_C(  7), UINT8_C(  6), UINT8_C(113), UINT8_C(225), UINT8_C(203), UINT8_C(206), UINT8_C(100), UINT8_C(134), UINT8_C( 45), UINT8_C(251), UINT8_C( 95), UINT8_C( 87), UINT8_C(142), UINT8_C(255), UINT8_C( 82), UINT8_C(185),
+        UINT8_C( 41), UINT8_C( 10), UINT8_C(156), UINT8_C(156), UINT8_C( 32), UINT8_C(194), UINT8_C(185), UINT8_C(130), UINT8_C(110), UINT8_C( 48), UINT8_C(172), UINT8_C(208), UINT8_C(159), UINT8_C( 33), UINT8_C(194), UINT8_C( 50),
+        UINT8_C(241), UINT8_C(199), UINT8_C(196), UINT8_C(173), UINT8_C( 77), UINT8_C(235), UINT8_C(146), UINT8_C(236), UINT8_C( 85), UINT8_C(147), UINT8_C( 56), UINT8_C(143), UINT8_C( 35), UINT8_C(203), UINT8_C( 89), UINT8_C(251) },
+      { UINT8_C( 45), UINT8_C(179), UINT8_C(254), UINT8_C( 98), UINT8_C( 20), UINT8_C( 54), UINT8_C(181), UINT8_C( 18), UINT8_C( 81), UINT8_C( 81), UINT8_C( 36), UINT8_C( 22), UINT8_C(180), UINT8_C( 15), UINT8_C(157), UINT8_C( 54),
+        UINT8_C( 30), UINT8_C(246), UINT8_C(163), UINT8_C(119), UINT8_C(157), UINT8_C(162), UINT8_C( 42), UINT8_C( 48), UINT8_C(245), UINT8_C( 74), UINT8_C( 30), UINT8_C( 15), UINT8_C( 65), UINT8_C( 40), UINT8_C( 66), UINT8_C( 62),
+        UINT8_C( 13), UINT8_C( 35), UINT8_C( 31), UINT8_C(122), UINT8_C(171), UINT8_C(154), UINT8_C(188), UINT8_C(103), UINT8_C( 43), UINT8_C(231), UINT8_C( 87), UINT8_C( 94), UINT8_C( 36), UINT8_C( 60), UINT8_C( 82), UINT8_C(148),
+        UINT8_C(249), UINT8_C(105), UINT8_C(101), UINT8_C(186), UINT8_C( 96), UINT8_C(196), UINT8_C( 94), UINT8_C(175), UINT8_C( 47), UINT8_C(219), UINT8_C( 20), UINT8_C(223), UINT8_C(194), UINT8_C(112), UINT8_C(150), UINT8_C( 19) },
+      { UINT8_C(240), UINT8_C(140), UINT8_C(190), UINT8_C( 83), UINT8_C(113), UINT8_C(143), UINT8_C(174), UINT8_C( 84), UINT8_C(104), UINT8_C(  4), UINT8_C( 46), UINT8_C(233), UINT8_C(170), UINT8_C(  1), UINT8_C(171), UINT8_C(228),
+        UINT8_C(252), UINT8_C( 18), UINT8_C( 14), UINT8_C(110), UINT8_C( 59), UINT8_C(104), UINT8_C( 73), UINT8_C( 86), UINT8_C( 50), UINT8_C(118), UINT8_C(158), UINT8_C( 26), UINT8_C( 68), UINT8_C(167), UINT8_C( 86), UINT8_C(215),
+        UINT8_C(192), UINT8_C(234), UINT8_C(191), UINT8_C(205), UINT8_C(159), UINT8_C( 54), UINT8_C(226), UINT8_C( 93), UINT8_C(231), UINT8_C(213), UINT8_C(214), UINT8_C( 22), UINT8_C(109), UINT8_C(143), UINT8_C(124), UINT8_C(149),
+        UINT8_C(241), UINT8_C(187), UINT8_C(190), UINT8_C(126), UINT8_C( 93), UINT8_C( 92), UINT8_C( 15), UINT8_C( 63), UINT8_C(214), UINT8_C(237), UINT8_C( 20), UINT8_C(245), UINT8_C(208), UINT8_C(165), UINT8_C( 69), UINT8_C(234) },
+      { UINT8_C(147), UINT8_C( 94), UINT8_C( 51), UINT8_C(223), UINT8_C( 76), UINT8_C(169), UINT8_C( 11), UINT8_C(177), UINT8_C( 21), UINT8_C(167), UINT8_C( 21), UINT8_C( 23), UINT8_C( 59), UINT8_C(166), UINT8_C(114), UINT8_C(154),
+        UINT8_C(213), UINT8_C(187), UINT8_C(206), UINT8_C(144), UINT8_C( 44), UINT8_C(232), UINT8_C( 80), UINT8_C( 85), UINT8_C(214), UINT8_C(147), UINT8_C( 95), UINT8_C(223), UINT8_C(147), UINT8_C(  2), UINT8_C(245), UINT8_C( 66),
+        UINT8_C(138), UINT8_C(239), UINT8_C( 46), UINT8_C( 37), UINT8_C( 39), UINT8_C(217), UINT8_C( 25), UINT8_C(244), UINT8_C(229), UINT8_C(219), UINT8_C(164), UINT8_C( 24), UINT8_C( 57), UINT8_C(123), UINT8_C(222), UINT8_C(241),
+        UINT8_C( 24), UINT8_C(175), UINT8_C(182), UINT8_C(100), UINT8_C(176), UINT8_C( 70), UINT8_C(129), UINT8_C( 80), UINT8_C(218), UINT8_C( 98), UINT8_C(  3), UINT8_C(222), UINT8_C(129), UINT8_C( 30), UINT8_C( 34), UINT8_C( 20) },
+      { UINT8_C(225), UINT8_C(216), UINT8_C( 33), UINT8_C(126), UINT8_C( 95), UINT8_C(208), UINT8_C(127), UINT8_C(217), UINT8_C( 53), UINT8_C( 69), UINT8_C( 14), UINT8_C( 94), UINT8_C( 55), UINT8_C(233), UINT8_C( 84), UINT8_C(164),
+        UINT8_C(189), UINT8_C(110), UINT8_C( 69), UINT8_C(177), UINT8_C(197), UINT8_C(221), UINT8_C(243), UINT8_C(185), UINT8_C(168), UINT8_C(149), UINT8_C( 65), UINT8_C(242), UINT8_C(126), UINT8_C(242), UINT8_C( 77), UINT8_C( 25),
+        UINT8_C(  4), UINT8_C(249), UINT8_C(109), UINT8_C(137), UINT8_C( 57), UINT8_C(220), UINT8_C( 97), UINT8_C(231), UINT8_C(101), UINT8_C( 24), UINT8_C( 36), UINT8_C(179), UINT8_C(210), UINT8_C(172), UINT8_C(255), UINT8_C(127),
+        UINT8_C( 39), UINT8_C(150), UINT8_C( 27), UINT8_C(165), UINT8_C(152), UINT8_C(114), UINT8_C(151), UINT8_C( 56), UINT8_C(126), UINT8_C(237), UINT8_C(139), UINT8_C(169), UINT8_C( 38), UINT8_C(145), UINT8_C( 45), UINT8_C(  6) },
+      { UINT8_C(175), UINT8_C(204), UINT8_C( 59), UINT8_C(177), UINT8_C( 30), UINT8_C(144), UINT8_C(122), UINT8_C(103), UINT8_C(134), UINT8_C(204), UINT8_C(188), UINT8_C(238), UINT8_C( 62), UINT8_C(173), UINT8_C(187), UINT8_C(110),
+        UINT8_C( 32), UINT8_C(103), UINT8_C( 78), UINT8_C(188), UINT8_C(245), UINT8_C(191), UINT8_C(230), UINT8_C( 62), UINT8_C( 20), UINT8_C( 88), UINT8_C(117), UINT8_C( 90), UINT8_C( 45), UINT8_C( 11), UINT8_C( 17), UINT8_C(126),
+        UINT8_C( 62), UINT8_C( 52), UINT8_C(180), UINT8_C( 79), UINT8_C(127), UINT8_C(130), UINT8_C(233), UINT8_C(161), UINT8_C(234), UINT8_C(138), UINT8_C( 49), UINT8_C( 89), UINT8_C(  1), UINT8_C( 99), UINT8_C(201), UINT8_C(105),
+        UINT8_C( 90), UINT8_C(107), UINT8_C(224), UINT8_C(162), UINT8_C(133), UINT8_C( 25), UINT8_C(159), UINT8_C( 99), UINT8_C(254), UINT8_C(  7), UINT8_C(219), UINT8_C( 57), UINT8_C(252), UINT8_C(248), UINT8_C(186), UINT8_C(  4) },
+      { UINT8_C(196), UINT8_C(130), UINT8_C( 25), UINT8_C(228), UINT8_C( 36), UINT8_C(106), UINT8_C( 63), UINT8_C(175), UINT8_C(196), UINT8_C( 95), UINT8_C(125), UINT8_C(234), UINT8_C( 19), UINT8_C(121), UINT8_C( 53), UINT8_C( 43),
+        UINT8_C(254), UINT8_C( 15), UINT8_C( 27), UINT8_C( 64), UINT8_C(205), UINT8_C(151), UINT8_C(242), UINT8_C( 67), UINT8_C(179), UINT8_C( 55), UINT8_C(140), UINT8_C(121), UINT8_C( 85), UINT8_C(218), UINT8_C(201), UINT8_C( 26),
+        UINT8_C( 69), UINT8_C(225), UINT8_C(250), UINT8_C(246), UINT8_C( 51), UINT8_C(219), UINT8_C( 88), UINT8_C(233), UINT8_C(  2), UINT8_C(200), UINT8_C(105), UINT8_C( 16), UINT8_C(229), UINT8_C(129), UINT8_C( 49), UINT8_C(103),
+        UINT8_C( 32), UINT8_C( 24), UINT8_C(210), UINT8_C(129), UINT8_C(188), UINT8_C(252), UINT8_C(197), UINT8_C(150), UINT8_C( 48), UINT8_C(178), UINT8_C(245), UINT8_C( 88), UINT8_C(249), UINT8_C(136), UINT8_C( 91), UINT8_C(178) },
+      { UINT8_C(205), UINT8_C( 34), UINT8_C( 82), UINT8_C(197), UINT8_C(190), UINT8_C(  3), UINT8_C(164), UINT8_C(100), UINT8_C(122), UINT8_C(149), UINT8_C(211), UINT8_C(243), UINT8_C(160), UINT8_C(172), UINT8_C( 54), UINT8_C(183),
+        UINT8_C( 39), UINT8_C(119), UINT8_C(238), UINT8_C(242), UINT8_C(227), UINT8_C( 18), UINT8_C( 28), UINT8_C(174), UINT8_C(137), UINT8_C( 44), UINT8_C( 99), UINT8_C(150), UINT8_C(236), UINT8_C(117), UINT8_C(226), UINT8_C( 52),
+        UINT8_C( 82), UINT8_C( 52), UINT8_C(237), UINT8_C(229), UINT8_C(101), UINT8_C(124), UINT8_C(167), UINT8_C(157), UINT8_C( 20), UINT8_C(216), UINT8_C(255), UINT8_C(197), UINT8_C(241), UINT8_C( 44), UINT8_C( 46), UINT8_C( 72),
+        UINT8_C(203), UINT8_C(181), UINT8_C(224), UINT8_C( 89), UINT8_C(157), UINT8_C(173), UINT8_C( 17), UINT8_C( 27), UINT8_C( 19), UINT8_C(224), UINT8_C(126), UINT8_C(162), UINT8_C(100), UINT8_C(  6), UINT8_C( 67), UINT8_C(165) },
+      { UINT8_C(110), UINT8_C(218), UINT8_C( 37), UINT8_C(162), UINT8_C(119), UINT8_C( 56), UINT8_C(189), UINT8_C(226), UINT8_C( 84), UINT8_C(239), UINT8_C(206), UINT8_C(251), UINT8_C( 34), UINT8_C(132), UINT8_C( 41), UINT8_C(221),
+        UINT8_C(226), UINT8_C(162), UINT8_C(104), UINT8_C(140), UINT8_C( 68), UINT8_C(132), UINT8_C(151), UINT8_C(152), UINT8_C(254), UINT8_C( 99), UINT8_C(140), UINT8_C(173), UINT8_C( 52), UINT8_C(255), UINT8_C(177), UINT8_C(248),
+        UINT8_C(246), UINT8_C( 54), UINT8_C(235), UINT8_C( 70), UINT8_C(240), UINT8_C(195), UINT8_C(138), UINT8_C(233), UINT8_C( 39), UINT8_C(119), UINT8_C(249), UINT8_C(197), UINT8_C( 68), UINT8_C(144), UINT8_C( 87), UINT8_C( 46),
+        UINT8_C(238), UINT8_C(113), UINT8_C( 55), UINT8_C(149), UINT8_C(159), UINT8_C( 28), UINT8_C( 13), UINT8_C(110), UINT8_C(203), UINT8_C(198), UINT8_C(200), UINT8_C(106), UINT8_C(216), UINT8_C(204), UINT8_C(158), UINT8_C(242) } },
+      { { INT32_C( 1484468601), INT32_C(-1061804349), INT32_C( -553699968), INT32_C(  265439151), INT32_C(  358902929), INT32_C( -145857106), INT32_C( -631511948), INT32_C( -638904745),
+        INT32_C(-1423477374), INT32_C( 1669695901), INT32_C( 2064798723), INT32_C(-1521968934), INT32_C(-1325522785), INT32_C( 1245192986), INT32_C(-1987933768), INT32_C( 1662816442) },
+      { INT32_C(-1872812570), INT32_C(  764919742), INT32_C( 1307507352), INT32_C( -941104764), INT32_C(-1169999006), INT32_C( 1935039064), INT32_C( -596188408), INT32_C(-1236741207),
+        INT32_C( 1893796078), INT32_C( 2082737545), INT32_C(  409765751), INT32_C( -947730192), INT32_C( -289096668), INT32_C(-1618972236), INT32_C(  448764394), INT32_C(  190272691) },
+      { INT32_C(-1815122635), INT32_C(  988529850), INT32_C( 1615535035), INT32_C(  -66276574), INT32_C(  828774467), INT32_C(-1949928873), INT32_C(  206573892), INT32_C(-1171925703),
+        INT32_C( -833307590), INT32_C(  689693515), INT32_C(   38073369), INT32_C( -947363883), INT32_C(-1281443840), INT32_C( 1536982165), INT32_C(-1208208194), INT32_C(-1531672147) },
+      { INT32_C(   43408117), INT32_C( -357423192), INT32_C(   23724018), INT32_C( -379814193), INT32_C( 1469263344), INT32_C(  116180516), INT32_C( 1884675280), INT32_C( 1966676412),
+        INT32_C( 1639804004), INT32_C(  900490355), INT32_C(  694229351), INT32_C( -527016013), INT32_C(-1204022595), INT32_C(-1035882422), INT32_C(-1323497889), INT32_C( 1526033636) },
+      { INT32_C( 1295761358), INT32_C( 1942825762), INT32_C( 2093369273), INT32_C(  -62379651), INT32_C(  278051115), INT32_C( 1814768363), INT32_C( -977675318), INT32_C( -870415877),
+        INT32_C(-1390184735), INT32_C(   91038775), INT32_C(  498327018), INT32_C( -743628808), INT32_C(-1434114206), INT32_C(-2052917198), INT32_C( 1166502507), INT32_C(  105178636) },
+      { INT32_C(  848837999), INT32_C(-1007636552), INT32_C( 1879919201), INT32_C( -414403562), INT32_C(-1422621741), INT32_C( -840433979), INT32_C(  626829579), INT32_C(-1323373493),
+        INT32_C( 1825173995), INT32_C( -104257671), INT32_C(  -45499720), INT32_C( -107221940), INT32_C( -938473094), INT32_C(-1228614477), INT32_C(  564994712), INT32_C(-1256301389) } },
+      { { INT32_C( 1484474032), INT32_C(-1061705334), INT32_C( -553649948), INT32_C(  265513885), INT32_C(  358929899), INT32_C( -145807026), INT32_C( -631404182), INT32_C( -638805943),
+        INT32_C(-1423420556), INT32_C( 1669785549), INT32_C( 2064847876), INT32_C(-1521875942), INT32_C(-1325398911), INT32_C( 1245256167), INT32_C(-1987772191), INT32_C( 1662933445) },
+      { INT32_C(-1872848726), INT32_C(  764835825), INT32_C( 1307438258), INT32_C( -941193903), INT32_C(-1170000782), INT32_C( 1935022416), INT32_C( -596285356), INT32_C(-1236846502),
+        INT32_C( 1893729358), INT32_C( 2082682216), INT32_C(  409693987), INT32_C( -947839326), INT32_C( -289187470), INT32_C(-1619001097), INT32_C(  448820816), INT32_C(  190187985) },
+      { INT32_C(-1815120175), INT32_C(  988482825), INT32_C( 1615488571), INT32_C(  -66333280), INT32_C(  828745030), INT32_C(-1950051453), INT32_C(  206529038), INT32_C(-1172025814),
+        INT32_C( -833405239), INT32_C(  689687527), INT32_C(   38010805), INT32_C( -947427496), INT32_C(-1281447805), INT32_C( 1536955139), INT32_C(-1208204735), INT32_C(-1531756282) },
+      { INT32_C(   43549900), INT32_C( -357359598), INT32_C(   23849439), INT32_C( -379697180), INT32_C( 1469399556), INT32_C(  116240811), INT32_C( 1884761067), INT32_C( 1966722915),
+        INT32_C( 1639922942), INT32_C(  900653637), INT32_C(  694341018), INT32_C( -527036726), INT32_C(-1203917601), INT32_C(-1035839167), INT32_C(-1323409942), INT32_C( 1526160760) },
+      { INT32_C( 1295752237), INT32_C( 1942833253), INT32_C( 2093315953), INT32_C(  -62443863), INT32_C(  278061572), INT32_C( 1814674592), INT32_C( -977651835), INT32_C( -870492054),
+        INT32_C(-1390148484), INT32_C(   91025668), INT32_C(  498297793), INT32_C( -743628389), INT32_C(-1434096990), INT32_C(-2052968591), INT32_C( 1166499346), INT32_C(  105089541) },
+      { INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int32_t r[6][16];
+
+    simde_test_amx_config(test_vec[i].m, test_vec[i].k, test_vec[i].n);
+    simde_tile_loadd(0, test_vec[i].c, sizeof(test_vec[i].c[0]));
+    simde_tile_loadd(1, test_vec[i].a, sizeof(test_vec[i].a[0]));
+    simde_tile_loadd(2, test_vec[i].b, sizeof(test_vec[i].b[0]));
+    simde_tile_dpbsud(0, 1, 2);
+    simde_memset(r, 0, sizeof(r));
+    simde_tile_stored(0, r, sizeof(r[0]));
+    simde_tile_release();
+
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) {
+      simde_assert_equal_vi32(sizeof(r[j]) / sizeof(r[j][0]), r[j], test_vec[i].r[j]);
+    }
+  }
+
+  return 0;
+}
+
+static int
+test_simde_tile_dpbusd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const uint8_t m;
+    const uint8_t k;
+    const uint8_t n;
+    const uint8_t a[6][64];
+    const int8_t b[16][64];
+    const int32_t c[6][16];
+    const int32_t r[6][16];
+  } test_vec[] = {
+    { 6, 8, 5,
+      { { UINT8_C( 20), UINT8_C(244), UINT8_C(128), UINT8_C(201), UINT8_C( 67), UINT8_C(240), UINT8_C(140), UINT8_C(175), UINT8_C(133), UINT8_C(123), UINT8_C( 25), UINT8_C(158), UINT8_C(170), UINT8_C( 56), UINT8_C(117), UINT8_C(  4),
+        UINT8_C( 35), UINT8_C(231), UINT8_C(114), UINT8_C(211), UINT8_C(161), UINT8_C( 19), UINT8_C(231), UINT8_C(196), UINT8_C(154), UINT8_C(  6), UINT8_C(166), UINT8_C(  7), UINT8_C( 68), UINT8_C(229), UINT8_C(233), UINT8_C(166),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C(  1), UINT8_C(131), UINT8_C( 94), UINT8_C( 38), UINT8_C(201), UINT8_C( 18), UINT8_C( 56), UINT8_C(239), UINT8_C( 48), UINT8_C(173), UINT8_C(217), UINT8_C(169), UINT8_C( 70), UINT8_C(179), UINT8_C( 36), UINT8_C(167),
+        UINT8_C(119), UINT8_C( 79), UINT8_C( 27), UINT8_C(113), UINT8_C(213), UINT8_C(174), UINT8_C(197), UINT8_C(140), UINT8_C(145), UINT8_C(231), UINT8_C( 99), UINT8_C( 45), UINT8_C(212), UINT8_C( 16), UINT8_C( 22), UINT8_C(  5),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C(220), UINT8_C( 53), UINT8_C(237), UINT8_C(  6), UINT8_C(165), UINT8_C(184), UINT8_C( 41), UINT8_C(227), UINT8_C(110), UINT8_C(214), UINT8_C(243), UINT8_C(208), UINT8_C(121), UINT8_C(196), UINT8_C( 37), UINT8_C(114),
+        UINT8_C(207), UINT8_C( 34), UINT8_C(160), UINT8_C(248), UINT8_C( 17), UINT8_C(135), UINT8_C(248), UINT8_C(187), UINT8_C(215), UINT8_C(244), UINT8_C(114), UINT8_C(203), UINT8_C(224), UINT8_C(183), UINT8_C(206), UINT8_C(239),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C( 67), UINT8_C(160), UINT8_C( 83), UINT8_C( 98), UINT8_C(248), UINT8_C(184), UINT8_C(  8), UINT8_C(236), UINT8_C( 84), UINT8_C(128), UINT8_C(213), UINT8_C( 54), UINT8_C( 93), UINT8_C(210), UINT8_C(167), UINT8_C(251),
+        UINT8_C(206), UINT8_C(205), UINT8_C( 54), UINT8_C( 68), UINT8_C(123), UINT8_C(  2), UINT8_C(192), UINT8_C(249), UINT8_C(125), UINT8_C( 32), UINT8_C( 21), UINT8_C( 56), UINT8_C(160), UINT8_C(117), UINT8_C(254), UINT8_C(218),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C( 64), UINT8_C(255), UINT8_C(198), UINT8_C( 14), UINT8_C(224), UINT8_C( 57), UINT8_C(103), UINT8_C( 10), UINT8_C(  1), UINT8_C(122), UINT8_C(138), UINT8_C(170), UINT8_C(163), UINT8_C(255), UINT8_C( 39), UINT8_C( 30),
+        UINT8_C( 59), UINT8_C(169), UINT8_C( 88), UINT8_C( 75), UINT8_C(128), UINT8_C( 22), UINT8_C( 57), UINT8_C(106), UINT8_C( 47), UINT8_C( 41), UINT8_C( 41), UINT8_C( 93), UINT8_C( 59), UINT8_C( 19), UINT8_C(194), UINT8_C(151),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C(135), UINT8_C( 16), UINT8_C( 72), UINT8_C(233), UINT8_C( 62), UINT8_C( 28), UINT8_C( 21), UINT8_C( 75), UINT8_C( 94), UINT8_C( 79), UINT8_C(177), UINT8_C(202), UINT8_C(214), UINT8_C(200), UINT8_C(184), UINT8_C( 37),
+        UINT8_C( 54), UINT8_C(232), UINT8_C( 39), UINT8_C( 16), UINT8_C( 81), UINT8_C(169), UINT8_C( 71), UINT8_C(140), UINT8_C( 42), UINT8_C(127), UINT8_C( 82), UINT8_C( 14), UINT8_C(174), UINT8_C(101), UINT8_C(142), UINT8_C( 97),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) } },
+      { { INT8_C(  82), INT8_C(  47), INT8_C( -15), INT8_C(  46), INT8_C(  68), INT8_C(   7), INT8_C(  63), INT8_C(  54), INT8_C(  90), INT8_C(  98), INT8_C( -86), INT8_C( -76), INT8_C(  15), INT8_C(-121), INT8_C(  12), INT8_C( -81),
+        INT8_C( -76), INT8_C(  -4), INT8_C(  45), INT8_C(  36), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C(  64), INT8_C(  18), INT8_C(  86), INT8_C( -18), INT8_C( 115), INT8_C(-128), INT8_C( -64), INT8_C( -17), INT8_C(-112), INT8_C( -74), INT8_C(  73), INT8_C(  15), INT8_C(-108), INT8_C( -58), INT8_C(  76), INT8_C(-104),
+        INT8_C( 107), INT8_C(  -9), INT8_C( -49), INT8_C(  84), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C( -52), INT8_C(  95), INT8_C(  28), INT8_C(   9), INT8_C(  49), INT8_C( 119), INT8_C( -23), INT8_C(   9), INT8_C( 122), INT8_C(  34), INT8_C(-128), INT8_C( -94), INT8_C(   7), INT8_C(   8), INT8_C( 118), INT8_C( -95),
+        INT8_C(  75), INT8_C(-111), INT8_C( -55), INT8_C( -36), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C(-111), INT8_C( -83), INT8_C(  62), INT8_C( -57), INT8_C(  57), INT8_C(-128), INT8_C( -48), INT8_C(-106), INT8_C( 126), INT8_C( -39), INT8_C( 107), INT8_C( -38), INT8_C(  92), INT8_C( -54), INT8_C(  41), INT8_C( 118),
+        INT8_C( -10), INT8_C( -30), INT8_C(-128), INT8_C( -30), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C( -48), INT8_C(   4), INT8_C(  61), INT8_C( -92), INT8_C(-113), INT8_C(  44), INT8_C( 124), INT8_C(  26), INT8_C( -62), INT8_C(  21), INT8_C(-121), INT8_C( -54), INT8_C( -96), INT8_C( -64), INT8_C( -73), INT8_C(   6),
+        INT8_C(  53), INT8_C(  72), INT8_C(-123), INT8_C(  89), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C(  77), INT8_C( 116), INT8_C( -69), INT8_C(  38), INT8_C(  82), INT8_C(  57), INT8_C(  73), INT8_C( 112), INT8_C( 103), INT8_C(-100), INT8_C(-101), INT8_C( 101), INT8_C(-112), INT8_C(   5), INT8_C(   2), INT8_C(  14),
+        INT8_C(   1), INT8_C(  -9), INT8_C( 101), INT8_C( -94), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C( -24), INT8_C(  -3), INT8_C(   9), INT8_C(  24), INT8_C(  82), INT8_C( -99), INT8_C( -24), INT8_C(-102), INT8_C( -86), INT8_C(  49), INT8_C( 119), INT8_C(  39), INT8_C( -71), INT8_C( 121), INT8_C( 122), INT8_C( -94),
+        INT8_C( -93), INT8_C(   7), INT8_C( -20), INT8_C( 108), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C(  77), INT8_C( -67), INT8_C( -55), INT8_C( -49), INT8_C(  46), INT8_C(  96), INT8_C(  93), INT8_C(  95), INT8_C(  74), INT8_C( -76), INT8_C(  41), INT8_C( -21), INT8_C(  41), INT8_C( -34), INT8_C( -40), INT8_C(  44),
+        INT8_C(-112), INT8_C(  -8), INT8_C(  82), INT8_C( -85), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C(  58), INT8_C( -16), INT8_C( -53), INT8_C( -87), INT8_C(  -6), INT8_C(  35), INT8_C(  57), INT8_C( 119), INT8_C( -83), INT8_C( 101), INT8_C( -50), INT8_C( -53), INT8_C(   9), INT8_C( 103), INT8_C( 112), INT8_C( 121),
+        INT8_C(-105), INT8_C(  50), INT8_C( -34), INT8_C(  16), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C( -36), INT8_C( -14), INT8_C( -62), INT8_C( -60), INT8_C(  45), INT8_C( -61), INT8_C(  27), INT8_C( -23), INT8_C(  92), INT8_C( -52), INT8_C(  60), INT8_C(  91), INT8_C(-112), INT8_C( 102), INT8_C( -70), INT8_C( -18),
+        INT8_C( -91), INT8_C( -51), INT8_C( -95), INT8_C( -82), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C(  28), INT8_C(  53), INT8_C(   9), INT8_C( -38), INT8_C( -31), INT8_C(   0), INT8_C(  57), INT8_C( -70), INT8_C(  36), INT8_C(  31), INT8_C(  74), INT8_C(  42), INT8_C( -80), INT8_C(  12), INT8_C( -16), INT8_C(   5),
+        INT8_C(  49), INT8_C(   7), INT8_C( -77), INT8_C( -41), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C( -45), INT8_C(  87), INT8_C(  27), INT8_C(-115), INT8_C( -67), INT8_C(  26), INT8_C( -87), INT8_C( -84), INT8_C(  50), INT8_C( -21), INT8_C( -51), INT8_C( -54), INT8_C( -18), INT8_C(-118), INT8_C( -77), INT8_C( -72),
+        INT8_C(   0), INT8_C(  31), INT8_C(   6), INT8_C(-122), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C(  61), INT8_C(  61), INT8_C(  54), INT8_C( -59), INT8_C(  85), INT8_C( -25), INT8_C( -51), INT8_C( 101), INT8_C(  -7), INT8_C(  76), INT8_C(  63), INT8_C(-128), INT8_C(  65), INT8_C( -14), INT8_C( -10), INT8_C(  40),
+        INT8_C( -24), INT8_C(  22), INT8_C( -50), INT8_C(  70), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C(  -3), INT8_C(  82), INT8_C( -60), INT8_C(  18), INT8_C( -11), INT8_C(-112), INT8_C(  54), INT8_C(  67), INT8_C( 110), INT8_C(  81), INT8_C( -60), INT8_C( -53), INT8_C( -28), INT8_C(-124), INT8_C(   1), INT8_C(  70),
+        INT8_C(  32), INT8_C(  94), INT8_C( -98), INT8_C( 105), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C( 105), INT8_C( 121), INT8_C(  22), INT8_C(  76), INT8_C( 111), INT8_C(  35), INT8_C(  43), INT8_C(  91), INT8_C( -90), INT8_C( -55), INT8_C(-111), INT8_C(-111), INT8_C( -91), INT8_C( -29), INT8_C(  10), INT8_C( 108),
+        INT8_C( -80), INT8_C(  58), INT8_C( 115), INT8_C(  77), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) },
+      { INT8_C( -68), INT8_C( -79), INT8_C( -49), INT8_C( -93), INT8_C( -47), INT8_C(  45), INT8_C( 121), INT8_C(-100), INT8_C( -39), INT8_C(  18), INT8_C(  68), INT8_C(  -3), INT8_C(  79), INT8_C(  77), INT8_C(  18), INT8_C( -31),
+        INT8_C(  80), INT8_C(-100), INT8_C(  -7), INT8_C(  -2), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0),
+        INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0) } },
+      { { INT32_C( 1861137921), INT32_C( 1221620869), INT32_C( 1239516922), INT32_C( 1290232713), INT32_C(-1514392029), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C(-2080527235), INT32_C(  550195668), INT32_C( 1977812625), INT32_C(-1298205199), INT32_C( -876453992), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C(-1191183438), INT32_C( 1662662242), INT32_C( 1049186104), INT32_C( -848345234), INT32_C(-1488509191), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C( -142724973), INT32_C(  571001609), INT32_C( -414743180), INT32_C(  320528730), INT32_C( 1466101147), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C( 2030160708), INT32_C( -774121444), INT32_C( 1213371313), INT32_C(  854588514), INT32_C( -904168925), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C(-1028253882), INT32_C( 2007778703), INT32_C(  757378902), INT32_C(  476492527), INT32_C(-1493221693), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) } },
+      { { INT32_C( 1861126040), INT32_C( 1221775206), INT32_C( 1239527303), INT32_C( 1290130209), INT32_C(-1514391052), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C(-2080489572), INT32_C(  550248532), INT32_C( 1977777179), INT32_C(-1298242523), INT32_C( -876466993), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C(-1191197432), INT32_C( 1662769153), INT32_C( 1049100093), INT32_C( -848384092), INT32_C(-1488540322), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C( -142738383), INT32_C(  571087084), INT32_C( -414775367), INT32_C(  320445321), INT32_C( 1466088135), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C( 2030173403), INT32_C( -774038189), INT32_C( 1213361890), INT32_C(  854510092), INT32_C( -904180174), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C(-1028229900), INT32_C( 2007865730), INT32_C(  757388571), INT32_C(  476478320), INT32_C(-1493271542), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) } } },
+    { 5, 16, 16,
+      { { UINT8_C( 53), UINT8_C( 21), UINT8_C(230), UINT8_C( 19), UINT8_C(131), UINT8_C(210), UINT8_C(211), UINT8_C(  6), UINT8_C(132), UINT8_C(244), UINT8_C( 17), UINT8_C(187), UINT8_C(236), UINT8_C( 56), UINT8_C(211), UINT8_C(195),
+        UINT8_C(106), UINT8_C( 48), UINT8_C(152), UINT8_C(218), UINT8_C(138), UINT8_C(110), UINT8_C( 28), UINT8_C(212), UINT8_C( 72), UINT8_C(190), UINT8_C(223), UINT8_C(224), UINT8_C( 30), UINT8_C( 37), UINT8_C(106), UINT8_C(167),
+        UINT8_C( 95), UINT8_C( 69), UINT8_C(173), UINT8_C( 28), UINT8_C(108), UINT8_C(144), UINT8_C(241), UINT8_C(246), UINT8_C(182), UINT8_C( 69), UINT8_C( 87), UINT8_C(111), UINT8_C(133), UINT8_C(217), UINT8_C(223), UINT8_C(241),
+        UINT8_C( 67), UINT8_C( 89), UINT8_C( 45), UINT8_C(139), UINT8_C(156), UINT8_C(120), UINT8_C(205), UINT8_C( 13), UINT8_C(  4), UINT8_C( 85), UINT8_C( 55), UINT8_C( 94), UINT8_C( 87), UINT8_C( 36), UINT8_C(116), UINT8_C(210) },
+      { UINT8_C(229), UINT8_C(159), UINT8_C(183), UINT8_C( 45), UINT8_C(  6), UINT8_C( 46), UINT8_C( 62), UINT8_C(128), UINT8_C(245), UINT8_C(162), UINT8_C( 36), UINT8_C( 19), UINT8_C(112), UINT8_C( 61), UINT8_C(251), UINT8_C(185),
+        UINT8_C(180), UINT8_C( 20), UINT8_C(137), UINT8_C(152), UINT8_C(195), UINT8_C(121), UINT8_C( 74), UINT8_C(220), UINT8_C( 17), UINT8_C(155), UINT8_C( 41), UINT8_C(230), UINT8_C(177), UINT8_C( 71), UINT8_C(232), UINT8_C( 57),
+        UINT8_C(204), UINT8_C(221), UINT8_C(242), UINT8_C(118), UINT8_C(183), UINT8_C(119), UINT8_C( 45), UINT8_C(187), UINT8_C(204), UINT8_C(156), UINT8_C(160), UINT8_C(  8), UINT8_C(204), UINT8_C( 89), UINT8_C(161), UINT8_C(253),
+        UINT8_C(224), UINT8_C(209), UINT8_C(162), UINT8_C(253), UINT8_C( 87), UINT8_C(172), UINT8_C(  9), UINT8_C(107), UINT8_C(141), UINT8_C(159), UINT8_C( 13), UINT8_C( 78), UINT8_C(238), UINT8_C(232), UINT8_C(191), UINT8_C(208) },
+      { UINT8_C( 92), UINT8_C(  6), UINT8_C( 58), UINT8_C(  8), UINT8_C(  1), UINT8_C( 54), UINT8_C( 15), UINT8_C(134), UINT8_C(147), UINT8_C(139), UINT8_C(222), UINT8_C( 79), UINT8_C( 50), UINT8_C(202), UINT8_C(242), UINT8_C(223),
+        UINT8_C(134), UINT8_C(101), UINT8_C(212), UINT8_C(236), UINT8_C( 90), UINT8_C(243), UINT8_C(189), UINT8_C(156), UINT8_C(129), UINT8_C( 32), UINT8_C(106), UINT8_C(  5), UINT8_C(166), UINT8_C(  1), UINT8_C(101), UINT8_C( 61),
+        UINT8_C(174), UINT8_C(210), UINT8_C(148), UINT8_C( 93), UINT8_C(140), UINT8_C(115), UINT8_C( 81), UINT8_C( 92), UINT8_C(170), UINT8_C( 89), UINT8_C( 66), UINT8_C(106), UINT8_C(224), UINT8_C(221), UINT8_C( 61), UINT8_C(123),
+        UINT8_C(113), UINT8_C(250), UINT8_C(192), UINT8_C(197), UINT8_C( 88), UINT8_C( 57), UINT8_C(220), UINT8_C(251), UINT8_C( 98), UINT8_C(187), UINT8_C(187), UINT8_C( 55), UINT8_C( 70), UINT8_C(213), UINT8_C(233), UINT8_C(116) },
+      { UINT8_C(254), UINT8_C(158), UINT8_C(210), UINT8_C( 25), UINT8_C( 49), UINT8_C(163), UINT8_C(195), UINT8_C(177), UINT8_C( 81), UINT8_C(118), UINT8_C(148), UINT8_C(155), UINT8_C(222), UINT8_C(236), UINT8_C(191), UINT8_C(196),
+        UINT8_C(226), UINT8_C(128), UINT8_C( 22), UINT8_C(  4), UINT8_C(231), UINT8_C( 48), UINT8_C( 65), UINT8_C(197), UINT8_C(  7), UINT8_C( 43), UINT8_C( 15), UINT8_C(113), UINT8_C(156), UINT8_C(228), UINT8_C( 69), UINT8_C( 54),
+        UINT8_C( 36), UINT8_C(135), UINT8_C(137), UINT8_C(137), UINT8_C( 83), UINT8_C( 83), UINT8_C(231), UINT8_C( 26), UINT8_C(167), UINT8_C(191), UINT8_C( 10), UINT8_C(173), UINT8_C( 57), UINT8_C( 51), UINT8_C( 14), UINT8_C( 57),
+        UINT8_C( 76), UINT8_C(244), UINT8_C( 93), UINT8_C(172), UINT8_C(104), UINT8_C(170), UINT8_C(208), UINT8_C(222), UINT8_C(149), UINT8_C(220), UINT8_C(215), UINT8_C( 61), UINT8_C( 44), UINT8_C(175), UINT8_C(171), UINT8_C(241) },
+      { UINT8_C(245), UINT8_C(161), UINT8_C(147), UINT8_C(212), UINT8_C(221), UINT8_C(103), UINT8_C( 44), UINT8_C( 44), UINT8_C( 17), UINT8_C(222), UINT8_C(132), UINT8_C(202), UINT8_C(205), UINT8_C( 67), UINT8_C(187), UINT8_C(230),
+        UINT8_C(235), UINT8_C(134), UINT8_C(163), UINT8_C(168), UINT8_C( 79), UINT8_C(186), UINT8_C( 34), UINT8_C( 58), UINT8_C(113), UINT8_C(192), UINT8_C( 62), UINT8_C(210), UINT8_C( 71), UINT8_C( 78), UINT8_C(118), UINT8_C(132),
+        UINT8_C(  3), UINT8_C(237), UINT8_C( 38), UINT8_C( 62), UINT8_C(197), UINT8_C(204), UINT8_C(138), UINT8_C( 57), UINT8_C( 72), UINT8_C( 16), UINT8_C(157), UINT8_C(164), UINT8_C(190), UINT8_C(171), UINT8_C(159), UINT8_C(206),
+        UINT8_C(142), UINT8_C( 13), UINT8_C(221), UINT8_C(165), UINT8_C(111), UINT8_C(234), UINT8_C(  2), UINT8_C( 81), UINT8_C(104), UINT8_C(156), UINT8_C(115), UINT8_C( 68), UINT8_C(160), UINT8_C( 26), UINT8_C(212), UINT8_C(191) },
+      { UINT8_C( 22), UINT8_C(110), UINT8_C( 58), UINT8_C(240), UINT8_C( 21), UINT8_C( 84), UINT8_C(129), UINT8_C( 48), UINT8_C( 89), UINT8_C(135), UINT8_C(134), UINT8_C(103), UINT8_C(228), UINT8_C(100), UINT8_C( 19), UINT8_C(206),
+        UINT8_C(105), UINT8_C(205), UINT8_C(130), UINT8_C( 85), UINT8_C( 20), UINT8_C(222), UINT8_C( 96), UINT8_C(140), UINT8_C( 80), UINT8_C(129), UINT8_C( 87), UINT8_C( 35), UINT8_C(249), UINT8_C(184), UINT8_C( 47), UINT8_C(131),
+        UINT8_C(200), UINT8_C(179), UINT8_C( 97), UINT8_C(255), UINT8_C( 46), UINT8_C(195), UINT8_C(178), UINT8_C( 30), UINT8_C(234), UINT8_C( 67), UINT8_C( 69), UINT8_C( 12), UINT8_C(  7), UINT8_C( 29), UINT8_C(108), UINT8_C( 21),
+        UINT8_C( 42), UINT8_C(179), UINT8_C( 60), UINT8_C(182), UINT8_C(124), UINT8_C( 90), UINT8_C( 12), UINT8_C(  1), UINT8_C(111), UINT8_C( 78), UINT8_C(217), UINT8_C( 54), UINT8_C(209), UINT8_C( 31), UINT8_C(203), UINT8_C(191) } },
+      { { INT8_C(  61), INT8_C( 125), INT8_C(  58), INT8_C(  38), INT8_C(  30), INT8_C(  47), INT8_C( -35), INT8_C( -23), INT8_C( -51), INT8_C(  37), INT8_C(  76), INT8_C(  94), INT8_C( -38), INT8_C( 100), INT8_C( -65), INT8_C( -46),
+        INT8_C( 107), INT8_C(  65), INT8_C(-113), INT8_C(   9), INT8_C(-127), INT8_C(-109), INT8_C(  75), INT8_C(  45), INT8_C(  99), INT8_C( -96), INT8_C(  39), INT8_C( -47), INT8_C(   0), INT8_C( -59), INT8_C( -21), INT8_C(  -9),
+        INT8_C(-118), INT8_C(  58), INT8_C( -49), INT8_C(  88), INT8_C(-123), INT8_C( -79), INT8_C(  56), INT8_C(-111), INT8_C( 114), INT8_C(-124), INT8_C( -11), INT8_C( -38), INT8_C( -57), INT8_C( -29), INT8_C(-125), INT8_C( 122),
+        INT8_C(  91), INT8_C( -31), INT8_C( 104), INT8_C(  27), INT8_C(  29), INT8_C( 125), INT8_C(-118), INT8_C(-113), INT8_C( 120), INT8_C( -53), INT8_C(  94), INT8_C( -29), INT8_C(-123), INT8_C(  33), INT8_C(  91), INT8_C( -71) },
+      { INT8_C( -83), INT8_C(  78), INT8_C(  79), INT8_C( 110), INT8_C(   1), INT8_C( -90), INT8_C( 122), INT8_C(  16), INT8_C(-111), INT8_C( -31), INT8_C( -67), INT8_C(-107), INT8_C(  -8), INT8_C(  80), INT8_C( 110), INT8_C(  98),
+        INT8_C( 101), INT8_C(-107), INT8_C(-119), INT8_C(  24), INT8_C( -62), INT8_C( -10), INT8_C( -74), INT8_C( 122), INT8_C( -43), INT8_C(  74), INT8_C( -85), INT8_C( -64), INT8_C( -71), INT8_C(-121), INT8_C( 119), INT8_C( -21),
+        INT8_C(  71), INT8_C(  40), INT8_C(  64), INT8_C(  49), INT8_C(-123), INT8_C(  40), INT8_C( 104), INT8_C( 112), INT8_C( -19), INT8_C(  84), INT8_C( -67), INT8_C( -63), INT8_C( -27), INT8_C(  77), INT8_C(-109), INT8_C(  93),
+        INT8_C( 101), INT8_C( -32), INT8_C(   1), INT8_C(  56), INT8_C(  46), INT8_C(  16), INT8_C( 100), INT8_C(  15), INT8_C(  55), INT8_C( -85), INT8_C( 103), INT8_C( -85), INT8_C(-118), INT8_C(  87), INT8_C(   6), INT8_C( -83) },
+      { INT8_C(  49), INT8_C( -10), INT8_C(  81), INT8_C( 114), INT8_C( -71), INT8_C( -17), INT8_C( -97), INT8_C(  74), INT8_C(  -4), INT8_C(  33), INT8_C(-112), INT8_C(-101), INT8_C( -21), INT8_C( -81), INT8_C( -84), INT8_C(-114),
+        INT8_C( -87), INT8_C( 120), INT8_C(-102), INT8_C(  51), INT8_C(  27), INT8_C(  46), INT8_C( -90), INT8_C(  24), INT8_C(-107), INT8_C( -82), INT8_C( 109), INT8_C( -18), INT8_C(  90), INT8_C( -33), INT8_C( -63), INT8_C( -74),
+        INT8_C(-128), INT8_C(  84), INT8_C(  -5), INT8_C(  72), INT8_C( -54), INT8_C(  -8), INT8_C(  79), INT8_C( 127), INT8_C(-110), INT8_C(  45), INT8_C(  72), INT8_C( -65), INT8_C(-123), INT8_C( 110), INT8_C( -96), INT8_C(-108),
+        INT8_C( -72), INT8_C( -29), INT8_C( 118), INT8_C( -58), INT8_C(  66), INT8_C( -97), INT8_C( -58), INT8_C(   7), INT8_C(  87), INT8_C( -24), INT8_C(  93), INT8_C(  -8), INT8_C(   0), INT8_C(  57), INT8_C(  33), INT8_C( 125) },
+      { INT8_C(-122), INT8_C(-126), INT8_C( -75), INT8_C( 106), INT8_C(-124), INT8_C(  -2), INT8_C(  58), INT8_C(  33), INT8_C( -98), INT8_C(  10), INT8_C( -53), INT8_C( -27), INT8_C( -96), INT8_C(   6), INT8_C( -43), INT8_C(  13),
+        INT8_C(  67), INT8_C(  76), INT8_C( -18), INT8_C( -39), INT8_C(  61), INT8_C(  22), INT8_C(  69), INT8_C(  -1), INT8_C(-108), INT8_C( -30), INT8_C( -69), INT8_C( -26), INT8_C( 113), INT8_C(-109), INT8_C(  53), INT8_C(  50),
+        INT8_C( -58), INT8_C(  76), INT8_C(   2), INT8_C( -36), INT8_C( 105), INT8_C( -83), INT8_C(  25), INT8_C( -76), INT8_C( -67), INT8_C( -78), INT8_C( 102), INT8_C(  -6), INT8_C(  70), INT8_C( -44), INT8_C(  17), INT8_C( -52),
+        INT8_C( 111), INT8_C(-125), INT8_C( -80), INT8_C(-128), INT8_C(  34), INT8_C( -16), INT8_C( -92), INT8_C(  15), INT8_C(-128), INT8_C( 114), INT8_C( -68), INT8_C( -14), INT8_C( 117), INT8_C( -48), INT8_C(  63), INT8_C( 127) },
+      { INT8_C(  80), INT8_C( -78), INT8_C( -61), INT8_C(-115), INT8_C( 109), INT8_C( 120), INT8_C(  11), INT8_C(  91), INT8_C(-114), INT8_C(  60), INT8_C(  57), INT8_C(  75), INT8_C(  35), INT8_C(  36), INT8_C(  62), INT8_C( -21),
+        INT8_C(  21), INT8_C(  26), INT8_C( -43), INT8_C(  -9), INT8_C(-128), INT8_C( 104), INT8_C( -23), INT8_C(   7), INT8_C( -38), INT8_C(  79), INT8_C( -77), INT8_C(  76), INT8_C(   1), INT8_C( -74), INT8_C(-111), INT8_C( 126),
+        INT8_C(-124), INT8_C( -61), INT8_C( -42), INT8_C(  14), INT8_C(   2), INT8_C( -11), INT8_C( -17), INT8_C( -39), INT8_C(   5), INT8_C( -75), INT8_C(  -9), INT8_C( -51), INT8_C( -86), INT8_C( 122), INT8_C(  -9), INT8_C(  83),
+        INT8_C( -51), INT8_C(  89), INT8_C(  20), INT8_C(   7), INT8_C(   1), INT8_C(  90), INT8_C( -83), INT8_C( -31), INT8_C( -54), INT8_C(  29), INT8_C( 127), INT8_C(  88), INT8_C(  80), INT8_C(  60), INT8_C( -31), INT8_C(  84) },
+      { INT8_C( -68), INT8_C(  62), INT8_C(  21), INT8_C( 123), INT8_C( -22), INT8_C(  60), INT8_C(  55), INT8_C(   1), INT8_C(  64), INT8_C( -46), INT8_C( 116), INT8_C(  20), INT8_C(  50), INT8_C(  79), INT8_C(  36), INT8_C( -99),
+        INT8_C(-110), INT8_C(-116), INT8_C(  10), INT8_C(  91), INT8_C(  50), INT8_C( -91), INT8_C( 109), INT8_C( -10), INT8_C( -81), INT8_C(  21), INT8_C( -71), INT8_C( -29), INT8_C(   5), INT8_C( 123), INT8_C( -10), INT8_C(-111),
+        INT8_C(  72), INT8_C( -48), INT8_C(  -4), INT8_C( -24), INT8_C(-113), INT8_C( -27), INT8_C(  81), INT8_C(-115), INT8_C( 114), INT8_C( -88), INT8_C(  23), INT8_C(   8), INT8_C( -79), INT8_C(  86), INT8_C( -15), INT8_C(-110),
+        INT8_C(  33), INT8_C( -38), INT8_C( -54), INT8_C(  86), INT8_C(  51), INT8_C(-110), INT8_C(  23), INT8_C(  58), INT8_C( 102), INT8_C(  41), INT8_C(  71), INT8_C( -29), INT8_C(  80), INT8_C(  81), INT8_C(  97), INT8_C(  93) },
+      { INT8_C( 119), INT8_C( -85), INT8_C(  -5), INT8_C( 116), INT8_C(-117), INT8_C(-121), INT8_C(   2), INT8_C( -62), INT8_C( -42), INT8_C(  13), INT8_C( -40), INT8_C( 117), INT8_C( 127), INT8_C( -78), INT8_C( 120), INT8_C( -13),
+        INT8_C( -63), INT8_C(-110), INT8_C(  78), INT8_C( -11), INT8_C(-112), INT8_C(  28), INT8_C( -69), INT8_C( -54), INT8_C( -51), INT8_C(  33), INT8_C(  94), INT8_C( -53), INT8_C(  27), INT8_C( 126), INT8_C(-100), INT8_C(  26),
+        INT8_C( -28), INT8_C(  74), INT8_C( -72), INT8_C(  -9), INT8_C(  16), INT8_C(  53), INT8_C(  17), INT8_C(-123), INT8_C( -61), INT8_C( -65), INT8_C( -40), INT8_C(  37), INT8_C( -73), INT8_C( -37), INT8_C( 119), INT8_C( -56),
+        INT8_C(  27), INT8_C(  88), INT8_C(  52), INT8_C( -21), INT8_C(  62), INT8_C(  33), INT8_C(  95), INT8_C(  64), INT8_C( -30), INT8_C(-105), INT8_C(-122), INT8_C(-108), INT8_C( -76), INT8_C(-103), INT8_C(  38), INT8_C( -48) },
+      { INT8_C(  54), INT8_C(  83), INT8_C(  81), INT8_C(  48), INT8_C( -84), INT8_C(  57), INT8_C( -76), INT8_C(  12), INT8_C(  27), INT8_C(-120), INT8_C(-110), INT8_C(  -6), INT8_C(  55), INT8_C( -58), INT8_C(-127), INT8_C( -59),
+        INT8_C(  32), INT8_C( 105), INT8_C( -44), INT8_C( -65), INT8_C(-109), INT8_C(  60), INT8_C(  70), INT8_C(  12), INT8_C(  22), INT8_C(-112), INT8_C(-100), INT8_C(  70), INT8_C(  -6), INT8_C( 103), INT8_C(   0), INT8_C( -37),
+        INT8_C(-123), INT8_C(  36), INT8_C(  -1), INT8_C(  43), INT8_C(  17), INT8_C( -43), INT8_C( -70), INT8_C( 118), INT8_C( 117), INT8_C(-112), INT8_C( -26), INT8_C( 104), INT8_C(  -5), INT8_C( -52), INT8_C(  56), INT8_C( -87),
+        INT8_C(  52), INT8_C(  26), INT8_C( 118), INT8_C( -43), INT8_C(  54), INT8_C(  27), INT8_C(  44), INT8_C(  29), INT8_C( -68), INT8_C(  82), INT8_C( -78), INT8_C( -55), INT8_C( 103), INT8_C(-119), INT8_C(  11), INT8_C(  32) },
+      { INT8_C(  91), INT8_C( 123), INT8_C( -96), INT8_C(  73), INT8_C(-118), INT8_C( -12), INT8_C(  13), INT8_C(  29), INT8_C(  -5), INT8_C( -98), INT8_C(  33), INT8_C( -21), INT8_C( -27), INT8_C( -52), INT8_C( -17), INT8_C(-112),
+        INT8_C(  12), INT8_C(  60), INT8_C( -24), INT8_C(  14), INT8_C(-121), INT8_C( 118), INT8_C(-101), INT8_C( -45), INT8_C( 115), INT8_C(  49), INT8_C(  76), INT8_C(  98), INT8_C(  38), INT8_C(  34), INT8_C( -33), INT8_C( -81),
+        INT8_C(  31), INT8_C(  82), INT8_C( -65), INT8_C(   4), INT8_C( -36), INT8_C( -43), INT8_C( 123), INT8_C(  79), INT8_C( 104), INT8_C( 124), INT8_C( 117), INT8_C(-121), INT8_C(  37), INT8_C( -48), INT8_C(  29), INT8_C(  47),
+        INT8_C(  59), INT8_C( 123), INT8_C( -50), INT8_C(  73), INT8_C( -18), INT8_C(-105), INT8_C( -78), INT8_C(-114), INT8_C(  88), INT8_C( -35), INT8_C( 126), INT8_C(  43), INT8_C( -61), INT8_C( -34), INT8_C(-109), INT8_C(  90) },
+      { INT8_C(  23), INT8_C(  52), INT8_C( -72), INT8_C( -72), INT8_C(  17), INT8_C( -26), INT8_C( 100), INT8_C(  27), INT8_C(-118), INT8_C(  67), INT8_C(  41), INT8_C(  74), INT8_C(  68), INT8_C( 114), INT8_C(  31), INT8_C( -64),
+        INT8_C(  -1), INT8_C(  45), INT8_C( -72), INT8_C( 111), INT8_C(  39), INT8_C(   4), INT8_C(  46), INT8_C(  74), INT8_C(-101), INT8_C(  53), INT8_C( 106), INT8_C(  89), INT8_C( -72), INT8_C(  26), INT8_C(  77), INT8_C(  72),
+        INT8_C(  73), INT8_C(  19), INT8_C(-120), INT8_C( -64), INT8_C( -71), INT8_C( 111), INT8_C(  21), INT8_C(   0), INT8_C( 116), INT8_C( -94), INT8_C( -63), INT8_C( -99), INT8_C(  31), INT8_C( 103), INT8_C( -72), INT8_C( -44),
+        INT8_C( -14), INT8_C( -86), INT8_C(-127), INT8_C(  -3), INT8_C(  26), INT8_C( -34), INT8_C(  -3), INT8_C( -14), INT8_C(  16), INT8_C(  82), INT8_C(  29), INT8_C(  22), INT8_C(  24), INT8_C(  30), INT8_C( -29), INT8_C( -58) },
+      { INT8_C( 115), INT8_C(  15), INT8_C( 120), INT8_C(  19), INT8_C( 119), INT8_C(-127), INT8_C(  21), INT8_C(  60), INT8_C(   9), INT8_C(  94), INT8_C( 109), INT8_C(-104), INT8_C( -26), INT8_C(  69), INT8_C( -77), INT8_C(  56),
+        INT8_C(-103), INT8_C( -67), INT8_C( -32), INT8_C( -18), INT8_C(  57), INT8_C(  -1), INT8_C(  32), INT8_C(  57), INT8_C( -83), INT8_C( -52), INT8_C( -21), INT8_C(-119), INT8_C(-121), INT8_C( -40), INT8_C( 122), INT8_C( 124),
+        INT8_C( 102), INT8_C(  79), INT8_C(  92), INT8_C(-101), INT8_C( -48), INT8_C(  -5), INT8_C(  96), INT8_C( -55), INT8_C(  17), INT8_C( -28), INT8_C(   2), INT8_C(  62), INT8_C( -94), INT8_C(  49), INT8_C( -78), INT8_C( -43),
+        INT8_C( -14), INT8_C( -71), INT8_C( -93), INT8_C( -30), INT8_C(  -8), INT8_C( -86), INT8_C(  74), INT8_C(  33), INT8_C( -75), INT8_C(  17), INT8_C(  84), INT8_C( -72), INT8_C(  70), INT8_C( -30), INT8_C(-125), INT8_C( 110) },
+      { INT8_C( 105), INT8_C( -76), INT8_C( -15), INT8_C(  66), INT8_C( -66), INT8_C( 117), INT8_C(  98), INT8_C( 109), INT8_C( -74), INT8_C( -40), INT8_C(  43), INT8_C(  43), INT8_C( -45), INT8_C( 100), INT8_C( -74), INT8_C(  94),
+        INT8_C(  50), INT8_C( -30), INT8_C(-127), INT8_C(  91), INT8_C(  66), INT8_C(  -4), INT8_C(-116), INT8_C(  23), INT8_C( -35), INT8_C(  15), INT8_C(  21), INT8_C(   2), INT8_C(  34), INT8_C( -13), INT8_C(  24), INT8_C(  86),
+        INT8_C(  -6), INT8_C(  46), INT8_C(  33), INT8_C(-116), INT8_C(  20), INT8_C( -93), INT8_C(  92), INT8_C(  62), INT8_C( -49), INT8_C(  57), INT8_C(-126), INT8_C(  65), INT8_C(-120), INT8_C(  68), INT8_C( 103), INT8_C( -60),
+        INT8_C(  13), INT8_C( 100), INT8_C(  14), INT8_C( -53), INT8_C( -50), INT8_C( 118), INT8_C( -10), INT8_C(   6), INT8_C(  75), INT8_C(-116), INT8_C( -53), INT8_C(  45), INT8_C(  84), INT8_C(-107), INT8_C(   6), INT8_C(-117) },
+      { INT8_C(  67), INT8_C(   8), INT8_C(  66), INT8_C(-121), INT8_C(-119), INT8_C( -13), INT8_C( -87), INT8_C( -24), INT8_C( -11), INT8_C(  35), INT8_C( -11), INT8_C(  40), INT8_C(  58), INT8_C( -62), INT8_C(  12), INT8_C(   7),
+        INT8_C(  12), INT8_C( -67), INT8_C(-125), INT8_C( -56), INT8_C( -51), INT8_C(-110), INT8_C(  51), INT8_C( -41), INT8_C(  34), INT8_C( -55), INT8_C(  36), INT8_C(  62), INT8_C( -49), INT8_C(-127), INT8_C(  67), INT8_C(  41),
+        INT8_C(  41), INT8_C(  43), INT8_C(-115), INT8_C(  76), INT8_C( -98), INT8_C( 127), INT8_C(-112), INT8_C( -36), INT8_C( 127), INT8_C(  -9), INT8_C(  50), INT8_C(  97), INT8_C(-112), INT8_C(  72), INT8_C(  51), INT8_C( -59),
+        INT8_C( 100), INT8_C(-118), INT8_C(   0), INT8_C(  86), INT8_C( 124), INT8_C( -44), INT8_C( 109), INT8_C( -61), INT8_C(-119), INT8_C( -58), INT8_C( -54), INT8_C(  67), INT8_C(-119), INT8_C( 103), INT8_C(  48), INT8_C(  48) },
+      { INT8_C(-123), INT8_C( -86), INT8_C(-104), INT8_C(  24), INT8_C(  50), INT8_C( -58), INT8_C( -83), INT8_C( -75), INT8_C(  58), INT8_C(  71), INT8_C( -59), INT8_C( -79), INT8_C(  63), INT8_C( -22), INT8_C(  16), INT8_C(  27),
+        INT8_C( -49), INT8_C(  46), INT8_C(-121), INT8_C( -12), INT8_C(  71), INT8_C(  25), INT8_C(  20), INT8_C(  -5), INT8_C( 115), INT8_C(   4), INT8_C( 127), INT8_C(-109), INT8_C( 125), INT8_C( -22), INT8_C(  37), INT8_C(  99),
+        INT8_C(  45), INT8_C(  83), INT8_C( 119), INT8_C( -79), INT8_C( -37), INT8_C(-104), INT8_C( -86), INT8_C(  22), INT8_C(  34), INT8_C( -98), INT8_C(-108), INT8_C( -64), INT8_C( 118), INT8_C( -84), INT8_C( -67), INT8_C(-115),
+        INT8_C(  38), INT8_C(  81), INT8_C(  23), INT8_C( -70), INT8_C(  48), INT8_C( -48), INT8_C( 119), INT8_C(  41), INT8_C( -84), INT8_C( 115), INT8_C(-120), INT8_C( -92), INT8_C(   5), INT8_C(  24), INT8_C(-114), INT8_C( -90) },
+      { INT8_C(   7), INT8_C(-122), INT8_C(  45), INT8_C( -45), INT8_C( -55), INT8_C( -94), INT8_C(-117), INT8_C(  36), INT8_C( -84), INT8_C( -84), INT8_C( -35), INT8_C( 100), INT8_C( -78), INT8_C(   6), INT8_C( -74), INT8_C( -44),
+        INT8_C( -17), INT8_C( -91), INT8_C( -98), INT8_C(-101), INT8_C(  51), INT8_C( -18), INT8_C( -72), INT8_C(  14), INT8_C(-100), INT8_C(  90), INT8_C( 117), INT8_C( 105), INT8_C(-114), INT8_C(  41), INT8_C( -37), INT8_C(  31),
+        INT8_C(  43), INT8_C( -78), INT8_C(-102), INT8_C(-118), INT8_C( -87), INT8_C( 112), INT8_C(  91), INT8_C(-100), INT8_C(  46), INT8_C(  50), INT8_C(  24), INT8_C(  69), INT8_C(  15), INT8_C(  61), INT8_C(  45), INT8_C(-124),
+        INT8_C( -65), INT8_C( 105), INT8_C(  90), INT8_C(  68), INT8_C(  58), INT8_C( -68), INT8_C(  10), INT8_C( -37), INT8_C(  37), INT8_C(  44), INT8_C(  56), INT8_C( 105), INT8_C(  48), INT8_C(  72), INT8_C(   1), INT8_C(  57) },
+      { INT8_C( -94), INT8_C( -99), INT8_C(-121), INT8_C(  76), INT8_C( -79), INT8_C( -90), INT8_C(  -5), INT8_C(-128), INT8_C( 108), INT8_C( -43), INT8_C( -16), INT8_C(-112), INT8_C( -36), INT8_C( -78), INT8_C(  30), INT8_C( -26),
+        INT8_C( -21), INT8_C(-101), INT8_C(  56), INT8_C(  48), INT8_C(  73), INT8_C(   0), INT8_C(  41), INT8_C( -63), INT8_C( -84), INT8_C(  59), INT8_C(-123), INT8_C( -55), INT8_C( -82), INT8_C( 126), INT8_C( -64), INT8_C(  69),
+        INT8_C( -26), INT8_C(  67), INT8_C( -66), INT8_C( -89), INT8_C(-114), INT8_C( -26), INT8_C(  77), INT8_C( -57), INT8_C( -61), INT8_C(-116), INT8_C(-108), INT8_C(  12), INT8_C(  47), INT8_C( -43), INT8_C(  41), INT8_C( -36),
+        INT8_C(  78), INT8_C(   4), INT8_C( -32), INT8_C(  76), INT8_C( 111), INT8_C( -63), INT8_C( -88), INT8_C( -59), INT8_C(  62), INT8_C(  87), INT8_C( -12), INT8_C( -44), INT8_C(  69), INT8_C(  43), INT8_C( 105), INT8_C(-111) } },
+      { { INT32_C(-1650945495), INT32_C(-1808972939), INT32_C( -413112002), INT32_C(  217869911), INT32_C( 1546315624), INT32_C(   22029473), INT32_C( 1195867232), INT32_C( 1880603243),
+        INT32_C(   82304979), INT32_C( 1791794304), INT32_C( -638536552), INT32_C(  726250896), INT32_C( 1616170046), INT32_C( -244403353), INT32_C(-1459571216), INT32_C( -610748310) },
+      { INT32_C( 1154573417), INT32_C(-1893965969), INT32_C(  325804730), INT32_C( 1796100537), INT32_C( 1982953410), INT32_C(  952281819), INT32_C(-1005240823), INT32_C(-1754448338),
+        INT32_C( 1506326419), INT32_C(-2105657997), INT32_C(-2125210406), INT32_C(-1979499490), INT32_C( 1769951799), INT32_C(  938783255), INT32_C(  146044626), INT32_C(-1063592531) },
+      { INT32_C(-1246742699), INT32_C(  115423540), INT32_C(  915486163), INT32_C( 1338360521), INT32_C( -850367149), INT32_C(  287529759), INT32_C( -614065488), INT32_C( -450172708),
+        INT32_C(  639304848), INT32_C( 2016024227), INT32_C( -295316636), INT32_C(-1597245878), INT32_C(  322468890), INT32_C( 1928412993), INT32_C(-1108305709), INT32_C(-1354148034) },
+      { INT32_C( -289310921), INT32_C( 1607534373), INT32_C( -522272813), INT32_C( 1325072110), INT32_C(  125866822), INT32_C( 1899008956), INT32_C(-1906598978), INT32_C(  794837422),
+        INT32_C(  981675710), INT32_C(-1170041300), INT32_C(  820948559), INT32_C(-1845076649), INT32_C(  442067159), INT32_C(-1410448645), INT32_C( 1180119495), INT32_C(  771867259) },
+      { INT32_C( 1410347090), INT32_C(  136779410), INT32_C( 1389574049), INT32_C( 1243429593), INT32_C(-1741937211), INT32_C(-1512956084), INT32_C(-1611326488), INT32_C( -434795270),
+        INT32_C( 1738146533), INT32_C(-1016515145), INT32_C( 1689620031), INT32_C( 1860450110), INT32_C( 1003446577), INT32_C( -626782612), INT32_C(-1342775530), INT32_C( 1618152058) },
+      { INT32_C(  326893507), INT32_C(-1339062326), INT32_C( 1520934583), INT32_C( -985350257), INT32_C( 1779420814), INT32_C(   27577185), INT32_C( 1516537917), INT32_C( 1937916339),
+        INT32_C( -131497564), INT32_C( 1256660488), INT32_C( -707770471), INT32_C( -860097028), INT32_C( 1386263098), INT32_C(    6013167), INT32_C( 1005353004), INT32_C( 2100294548) } },
+      { { INT32_C(-1650933000), INT32_C(-1808967385), INT32_C( -413130537), INT32_C(  217839280), INT32_C( 1546188547), INT32_C(   22041015), INT32_C( 1195872213), INT32_C( 1880707936),
+        INT32_C(   82277310), INT32_C( 1791776553), INT32_C( -638577446), INT32_C(  726147085), INT32_C( 1616235521), INT32_C( -244377807), INT32_C(-1459601964), INT32_C( -610653362) },
+      { INT32_C( 1154696548), INT32_C(-1894101836), INT32_C(  325793766), INT32_C( 1796005821), INT32_C( 1982848643), INT32_C(  952271223), INT32_C(-1005338479), INT32_C(-1754370816),
+        INT32_C( 1506280268), INT32_C(-2105782858), INT32_C(-2125167850), INT32_C(-1979642450), INT32_C( 1770057365), INT32_C(  938753889), INT32_C(  146123905), INT32_C(-1063497800) },
+      { INT32_C(-1246699841), INT32_C(  115324551), INT32_C(  915361247), INT32_C( 1338353975), INT32_C( -850537249), INT32_C(  287517221), INT32_C( -614062886), INT32_C( -450128858),
+        INT32_C(  639240060), INT32_C( 2015999443), INT32_C( -295306711), INT32_C(-1597318110), INT32_C(  322513365), INT32_C( 1928361676), INT32_C(-1108254928), INT32_C(-1353995989) },
+      { INT32_C( -289229429), INT32_C( 1607430031), INT32_C( -522446552), INT32_C( 1325019248), INT32_C(  125742124), INT32_C( 1898996376), INT32_C(-1906672071), INT32_C(  794857712),
+        INT32_C(  981624575), INT32_C(-1170079077), INT32_C(  820921003), INT32_C(-1845251239), INT32_C(  442133146), INT32_C(-1410451271), INT32_C( 1180158014), INT32_C(  772011553) },
+      { INT32_C( 1410453758), INT32_C(  136734507), INT32_C( 1389469055), INT32_C( 1243390352), INT32_C(-1741978321), INT32_C(-1512941835), INT32_C(-1611397084), INT32_C( -434710681),
+        INT32_C( 1738097418), INT32_C(-1016628665), INT32_C( 1689619510), INT32_C( 1860374732), INT32_C( 1003580883), INT32_C( -626789040), INT32_C(-1342763164), INT32_C( 1618251799) },
+      { INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int32_t r[6][16];
+
+    simde_test_amx_config(test_vec[i].m, test_vec[i].k, test_vec[i].n);
+    simde_tile_loadd(0, test_vec[i].c, sizeof(test_vec[i].c[0]));
+    simde_tile_loadd(1, test_vec[i].a, sizeof(test_vec[i].a[0]));
+    simde_tile_loadd(2, test_vec[i].b, sizeof(test_vec[i].b[0]));
+    simde_tile_dpbusd(0, 1, 2);
+    simde_memset(r, 0, sizeof(r));
+    simde_tile_stored(0, r, sizeof(r[0]));
+    simde_tile_release();
+
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) {
+      simde_assert_equal_vi32(sizeof(r[j]) / sizeof(r[j][0]), r[j], test_vec[i].r[j]);
+    }
+  }
+
+  return 0;
+}
+
+static int
+test_simde_tile_dpbuud (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const uint8_t m;
+    const uint8_t k;
+    const uint8_t n;
+    const uint8_t a[6][64];
+    const uint8_t b[16][64];
+    const int32_t c[6][16];
+    const int32_t r[6][16];
+  } test_vec[] = {
+    { 6, 8, 5,
+      { { UINT8_C( 86), UINT8_C(148), UINT8_C(210), UINT8_C(191), UINT8_C(227), UINT8_C(158), UINT8_C( 54), UINT8_C(126), UINT8_C(167), UINT8_C(190), UINT8_C(242), UINT8_C(130), UINT8_C(202), UINT8_C(249), UINT8_C(166), UINT8_C( 40),
+        UINT8_C(178), UINT8_C(242), UINT8_C(186), UINT8_C( 59), UINT8_C(177), UINT8_C( 26), UINT8_C(111), UINT8_C(153), UINT8_C(228), UINT8_C( 46), UINT8_C(255), UINT8_C(140), UINT8_C( 46), UINT8_C(218), UINT8_C(119), UINT8_C(188),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C(174), UINT8_C(124), UINT8_C( 88), UINT8_C(143), UINT8_C(154), UINT8_C(146), UINT8_C( 72), UINT8_C( 99), UINT8_C(106), UINT8_C(123), UINT8_C(254), UINT8_C(109), UINT8_C(153), UINT8_C( 38), UINT8_C(194), UINT8_C(179),
+        UINT8_C(164), UINT8_C(  6), UINT8_C(103), UINT8_C( 78), UINT8_C( 53), UINT8_C(114), UINT8_C(236), UINT8_C(152), UINT8_C(255), UINT8_C(208), UINT8_C(131), UINT8_C( 14), UINT8_C(197), UINT8_C( 29), UINT8_C(240), UINT8_C(240),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C(163), UINT8_C( 61), UINT8_C(253), UINT8_C(137), UINT8_C(155), UINT8_C(  5), UINT8_C( 87), UINT8_C(229), UINT8_C(190), UINT8_C( 40), UINT8_C(179), UINT8_C( 27), UINT8_C( 15), UINT8_C( 81), UINT8_C(144), UINT8_C(253),
+        UINT8_C(165), UINT8_C(210), UINT8_C(203), UINT8_C(204), UINT8_C(206), UINT8_C( 50), UINT8_C( 76), UINT8_C(225), UINT8_C( 19), UINT8_C( 45), UINT8_C(149), UINT8_C(109), UINT8_C(220), UINT8_C(232), UINT8_C(120), UINT8_C( 56),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C(208), UINT8_C(234), UINT8_C(231), UINT8_C( 21), UINT8_C( 31), UINT8_C(155), UINT8_C(104), UINT8_C( 78), UINT8_C(226), UINT8_C(120), UINT8_C( 85), UINT8_C(146), UINT8_C(  3), UINT8_C(200), UINT8_C(238), UINT8_C(136),
+        UINT8_C(191), UINT8_C(160), UINT8_C(122), UINT8_C(  3), UINT8_C(101), UINT8_C( 28), UINT8_C(148), UINT8_C(116), UINT8_C( 60), UINT8_C(209), UINT8_C( 70), UINT8_C(220), UINT8_C( 93), UINT8_C(237), UINT8_C( 58), UINT8_C( 68),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C( 92), UINT8_C(175), UINT8_C( 61), UINT8_C(224), UINT8_C(175), UINT8_C(198), UINT8_C( 83), UINT8_C( 39), UINT8_C( 98), UINT8_C( 81), UINT8_C(232), UINT8_C(116), UINT8_C(164), UINT8_C(243), UINT8_C( 33), UINT8_C( 12),
+        UINT8_C(239), UINT8_C(233), UINT8_C(104), UINT8_C( 29), UINT8_C(201), UINT8_C(254), UINT8_C(189), UINT8_C( 34), UINT8_C( 32), UINT8_C(161), UINT8_C( 66), UINT8_C(168), UINT8_C( 89), UINT8_C(238), UINT8_C( 10), UINT8_C(245),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C( 76), UINT8_C( 31), UINT8_C(180), UINT8_C( 76), UINT8_C( 38), UINT8_C( 64), UINT8_C(170), UINT8_C( 36), UINT8_C(216), UINT8_C( 30), UINT8_C(255), UINT8_C( 32), UINT8_C( 19), UINT8_C(138), UINT8_C(152), UINT8_C( 22),
+        UINT8_C( 50), UINT8_C(  5), UINT8_C(233), UINT8_C( 84), UINT8_C( 60), UINT8_C(207), UINT8_C( 23), UINT8_C(110), UINT8_C(254), UINT8_C( 29), UINT8_C( 22), UINT8_C(201), UINT8_C(186), UINT8_C(114), UINT8_C(142), UINT8_C( 61),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) } },
+      { { UINT8_C(207), UINT8_C(147), UINT8_C(183), UINT8_C( 56), UINT8_C(232), UINT8_C(168), UINT8_C( 92), UINT8_C(177), UINT8_C( 64), UINT8_C(224), UINT8_C(211), UINT8_C(231), UINT8_C( 57), UINT8_C(128), UINT8_C(168), UINT8_C(106),
+        UINT8_C(144), UINT8_C(213), UINT8_C(153), UINT8_C(229), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C( 42), UINT8_C(  7), UINT8_C( 91), UINT8_C(190), UINT8_C(  4), UINT8_C(141), UINT8_C(156), UINT8_C( 52), UINT8_C(181), UINT8_C(127), UINT8_C(208), UINT8_C( 28), UINT8_C( 91), UINT8_C(206), UINT8_C( 95), UINT8_C(203),
+        UINT8_C(115), UINT8_C( 13), UINT8_C( 15), UINT8_C(252), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C(135), UINT8_C(243), UINT8_C( 51), UINT8_C( 57), UINT8_C(130), UINT8_C(193), UINT8_C( 63), UINT8_C(235), UINT8_C(232), UINT8_C( 32), UINT8_C(233), UINT8_C(186), UINT8_C(163), UINT8_C(254), UINT8_C( 45), UINT8_C( 98),
+        UINT8_C(117), UINT8_C( 45), UINT8_C(224), UINT8_C(137), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C(236), UINT8_C(163), UINT8_C(140), UINT8_C(167), UINT8_C( 52), UINT8_C(187), UINT8_C(208), UINT8_C(101), UINT8_C(123), UINT8_C( 78), UINT8_C( 83), UINT8_C( 19), UINT8_C(221), UINT8_C(195), UINT8_C(216), UINT8_C(211),
+        UINT8_C( 42), UINT8_C( 52), UINT8_C(186), UINT8_C( 36), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C( 24), UINT8_C(234), UINT8_C( 31), UINT8_C( 80), UINT8_C(125), UINT8_C(141), UINT8_C(116), UINT8_C( 89), UINT8_C(126), UINT8_C(189), UINT8_C(127), UINT8_C( 19), UINT8_C( 74), UINT8_C( 19), UINT8_C( 52), UINT8_C(141),
+        UINT8_C( 39), UINT8_C(136), UINT8_C(227), UINT8_C(191), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C( 40), UINT8_C( 85), UINT8_C( 52), UINT8_C(150), UINT8_C(212), UINT8_C(100), UINT8_C( 87), UINT8_C(235), UINT8_C(232), UINT8_C( 53), UINT8_C(180), UINT8_C( 58), UINT8_C(119), UINT8_C(161), UINT8_C( 49), UINT8_C(139),
+        UINT8_C(136), UINT8_C( 10), UINT8_C( 34), UINT8_C( 62), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C( 11), UINT8_C(206), UINT8_C( 96), UINT8_C( 41), UINT8_C(187), UINT8_C( 71), UINT8_C(205), UINT8_C(245), UINT8_C(  8), UINT8_C(210), UINT8_C(161), UINT8_C(210), UINT8_C( 11), UINT8_C( 17), UINT8_C(131), UINT8_C(  3),
+        UINT8_C(121), UINT8_C(224), UINT8_C(228), UINT8_C(208), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C( 21), UINT8_C( 96), UINT8_C( 15), UINT8_C(172), UINT8_C( 47), UINT8_C(135), UINT8_C( 39), UINT8_C( 81), UINT8_C( 41), UINT8_C(127), UINT8_C( 19), UINT8_C(190), UINT8_C(218), UINT8_C(238), UINT8_C(125), UINT8_C(194),
+        UINT8_C(255), UINT8_C( 82), UINT8_C(231), UINT8_C( 13), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C(237), UINT8_C(131), UINT8_C( 35), UINT8_C(223), UINT8_C(239), UINT8_C( 43), UINT8_C( 84), UINT8_C( 73), UINT8_C(180), UINT8_C(143), UINT8_C( 68), UINT8_C(154), UINT8_C(208), UINT8_C(105), UINT8_C(241), UINT8_C( 22),
+        UINT8_C(200), UINT8_C(116), UINT8_C(151), UINT8_C(149), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C(143), UINT8_C(140), UINT8_C(124), UINT8_C(109), UINT8_C(200), UINT8_C(184), UINT8_C(179), UINT8_C(124), UINT8_C(235), UINT8_C(244), UINT8_C(106), UINT8_C(189), UINT8_C(255), UINT8_C( 85), UINT8_C(102), UINT8_C(178),
+        UINT8_C(249), UINT8_C(196), UINT8_C(  5), UINT8_C(173), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C(242), UINT8_C( 18), UINT8_C( 39), UINT8_C(102), UINT8_C(103), UINT8_C(114), UINT8_C(210), UINT8_C(136), UINT8_C(188), UINT8_C(197), UINT8_C(147), UINT8_C(181), UINT8_C(182), UINT8_C(230), UINT8_C(173), UINT8_C(117),
+        UINT8_C(146), UINT8_C(212), UINT8_C( 45), UINT8_C(190), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C( 90), UINT8_C(118), UINT8_C( 97), UINT8_C(193), UINT8_C(244), UINT8_C(214), UINT8_C(214), UINT8_C(249), UINT8_C( 73), UINT8_C( 38), UINT8_C(238), UINT8_C(151), UINT8_C(241), UINT8_C(173), UINT8_C(160), UINT8_C(196),
+        UINT8_C( 47), UINT8_C(207), UINT8_C(106), UINT8_C( 76), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C( 93), UINT8_C(145), UINT8_C( 63), UINT8_C(186), UINT8_C( 66), UINT8_C( 59), UINT8_C( 20), UINT8_C(217), UINT8_C(219), UINT8_C(156), UINT8_C( 29), UINT8_C( 56), UINT8_C( 93), UINT8_C(124), UINT8_C( 68), UINT8_C( 75),
+        UINT8_C(221), UINT8_C( 83), UINT8_C(196), UINT8_C(129), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C( 94), UINT8_C(222), UINT8_C( 56), UINT8_C(244), UINT8_C( 82), UINT8_C( 30), UINT8_C(122), UINT8_C(243), UINT8_C(103), UINT8_C(149), UINT8_C( 10), UINT8_C(252), UINT8_C(144), UINT8_C( 77), UINT8_C(101), UINT8_C( 32),
+        UINT8_C(186), UINT8_C(239), UINT8_C(225), UINT8_C(180), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C(190), UINT8_C( 91), UINT8_C( 66), UINT8_C(163), UINT8_C( 66), UINT8_C(173), UINT8_C( 33), UINT8_C(194), UINT8_C( 36), UINT8_C( 38), UINT8_C(248), UINT8_C(  4), UINT8_C(151), UINT8_C(114), UINT8_C(224), UINT8_C(244),
+        UINT8_C(187), UINT8_C(173), UINT8_C(217), UINT8_C( 23), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { UINT8_C(147), UINT8_C(131), UINT8_C(174), UINT8_C(204), UINT8_C( 91), UINT8_C(246), UINT8_C(199), UINT8_C(123), UINT8_C(  1), UINT8_C(243), UINT8_C( 97), UINT8_C(116), UINT8_C( 55), UINT8_C(247), UINT8_C(150), UINT8_C(135),
+        UINT8_C( 85), UINT8_C( 60), UINT8_C(202), UINT8_C( 97), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+        UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) } },
+      { { INT32_C( 1047102050), INT32_C( -583334885), INT32_C(-1194792145), INT32_C( 1802766861), INT32_C( 2071555557), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C( -418492405), INT32_C( -887817213), INT32_C(-2023387822), INT32_C( -288881208), INT32_C(-1028918088), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C(-1784870819), INT32_C( 1111734532), INT32_C(-1769357817), INT32_C( 1585503400), INT32_C( 1845533425), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C(  920908037), INT32_C( 1961517990), INT32_C( -337378645), INT32_C( 1489017594), INT32_C(  806453109), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C(-1261827928), INT32_C( 1355151683), INT32_C(-1677334752), INT32_C( 1371457804), INT32_C( -153824713), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C( 1988776848), INT32_C(-1480690534), INT32_C( 1910719643), INT32_C(-2134251386), INT32_C( 1741428731), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) } },
+      { { INT32_C( 1047644491), INT32_C( -582646096), INT32_C(-1194091252), INT32_C( 1803404840), INT32_C( 2072205538), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C( -418046215), INT32_C( -887278559), INT32_C(-2022846209), INT32_C( -288327012), INT32_C(-1028341390), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C(-1784398495), INT32_C( 1112293372), INT32_C(-1768803288), INT32_C( 1586075783), INT32_C( 1846163119), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C(  921391565), INT32_C( 1962129434), INT32_C( -336790758), INT32_C( 1489541128), INT32_C(  806987368), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C(-1261375350), INT32_C( 1355722046), INT32_C(-1676662236), INT32_C( 1371991075), INT32_C( -153324524), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) },
+      { INT32_C( 1989062495), INT32_C(-1480241374), INT32_C( 1911145044), INT32_C(-2133849993), INT32_C( 1741897034), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) } } },
+    { 5, 16, 16,
+      { { UINT8_C( 97), UINT8_C(106), UINT8_C(103), UINT8_C(228), UINT8_C(219), UINT8_C( 85), UINT8_C( 55), UINT8_C(209), UINT8_C(195), UINT8_C( 72), UINT8_C( 91), UINT8_C(228), UINT8_C( 47), UINT8_C(121), UINT8_C( 45), UINT8_C(164),
+        UINT8_C(216), UINT8_C( 64), UINT8_C(170), UINT8_C( 86), UINT8_C(151), UINT8_C(215), UINT8_C(115), UINT8_C( 59), UINT8_C( 14), UINT8_C( 31), UINT8_C(166), UINT8_C( 27), UINT8_C( 26), UINT8_C( 20), UINT8_C(202), UINT8_C(234),
+        UINT8_C(137), UINT8_C( 58), UINT8_C(135), UINT8_C(223), UINT8_C( 75), UINT8_C(107), UINT8_C(251), UINT8_C(229), UINT8_C( 76), UINT8_C(  7), UINT8_C( 30), UINT8_C(252), UINT8_C( 87), UINT8_C(169), UINT8_C(123), UINT8_C(139),
+        UINT8_C( 12), UINT8_C(206), UINT8_C( 89), UINT8_C( 30), UINT8_C( 61), UINT8_C( 30), UINT8_C(107), UINT8_C( 10), UINT8_C(191), UINT8_C(175), UINT8_C(  6), UINT8_C(104), UINT8_C( 77), UINT8_C( 66), UINT8_C(240), UINT8_C(136) },
+      { UINT8_C(103), UINT8_C(162), UINT8_C(242), UINT8_C( 68), UINT8_C( 95), UINT8_C(181), UINT8_C(206), UINT8_C(236), UINT8_C( 84), UINT8_C( 98), UINT8_C( 94), UINT8_C(191), UINT8_C(130), UINT8_C( 83), UINT8_C( 60), UINT8_C(  2),
+        UINT8_C( 33), UINT8_C( 32), UINT8_C(178), UINT8_C( 82), UINT8_C( 97), UINT8_C(104), UINT8_C(142), UINT8_C(215), UINT8_C(  7), UINT8_C(124), UINT8_C(245), UINT8_C(158), UINT8_C(207), UINT8_C(146), UINT8_C( 93), UINT8_C(122),
+        UINT8_C(169), UINT8_C( 78), UINT8_C(241), UINT8_C(236), UINT8_C(215), UINT8_C(167), UINT8_C(151), UINT8_C(194), UINT8_C(170), UINT8_C(101), UINT8_C( 80), UINT8_C(145), UINT8_C(216), UINT8_C(  7), UINT8_C(150), UINT8_C(170),
+        UINT8_C(253), UINT8_C(101), UINT8_C( 29), UINT8_C(192), UINT8_C(199), UINT8_C( 96), UINT8_C( 79), UINT8_C(179), UINT8_C(201), UINT8_C(186), UINT8_C(160), UINT8_C(161), UINT8_C( 27), UINT8_C( 78), UINT8_C( 32), UINT8_C( 17) },
+      { UINT8_C(187), UINT8_C(236), UINT8_C( 12), UINT8_C(211), UINT8_C(102), UINT8_C( 61), UINT8_C(117), UINT8_C(118), UINT8_C( 98), UINT8_C( 77), UINT8_C( 51), UINT8_C(103), UINT8_C(209), UINT8_C(  9), UINT8_C( 89), UINT8_C(242),
+        UINT8_C( 10), UINT8_C(135), UINT8_C(165), UINT8_C(196), UINT8_C(160), UINT8_C(116), UINT8_C( 72), UINT8_C(196), UINT8_C(161), UINT8_C( 98), UINT8_C(211), UINT8_C( 19), UINT8_C(190), UINT8_C( 93), UINT8_C(250), UINT8_C(  8),
+        UINT8_C(149), UINT8_C(214), UINT8_C(106), UINT8_C(236), UINT8_C( 81), UINT8_C(160), UINT8_C( 30), UINT8_C(220), UINT8_C( 62), UINT8_C(  9), UINT8_C(160), UINT8_C(106), UINT8_C( 89), UINT8_C(230), UINT8_C(195), UINT8_C(190),
+        UINT8_C(160), UINT8_C(150), UINT8_C(173), UINT8_C( 37), UINT8_C(244), UINT8_C(235), UINT8_C(148), UINT8_C( 95), UINT8_C(248), UINT8_C(247), UINT8_C( 71), UINT8_C( 91), UINT8_C(248), UINT8_C(132), UINT8_C(140), UINT8_C(250) },
+      { UINT8_C( 82), UINT8_C( 45), UINT8_C(237), UINT8_C(101), UINT8_C(145), UINT8_C( 87), UINT8_C( 23), UINT8_C(  9), UINT8_C(200), UINT8_C( 45), UINT8_C(229), UINT8_C( 41), UINT8_C( 11), UINT8_C(252), UINT8_C( 72), UINT8_C( 57),
+        UINT8_C( 62), UINT8_C( 43), UINT8_C( 74), UINT8_C( 59), UINT8_C(226), UINT8_C( 78), UINT8_C(133), UINT8_C(113), UINT8_C( 67), UINT8_C( 90), UINT8_C(114), UINT8_C(131), UINT8_C(179), UINT8_C(185), UINT8_C(240), UINT8_C(252),
+        UINT8_C(159), UINT8_C( 32), UINT8_C(128), UINT8_C( 75), UINT8_C(127), UINT8_C(128), UINT8_C( 49), UINT8_C(120), UINT8_C(245), UINT8_C( 59), UINT8_C( 30), UINT8_C(248), UINT8_C( 28), UINT8_C(168), UINT8_C(245), UINT8_C(123),
+        UINT8_C(178), UINT8_C(226), UINT8_C( 44), UINT8_C( 23), UINT8_C(199), UINT8_C(225), UINT8_C(170), UINT8_C(221), UINT8_C( 23), UINT8_C(181), UINT8_C(231), UINT8_C(149), UINT8_C(206), UINT8_C(177), UINT8_C(251), UINT8_C( 28) },
+      { UINT8_C(234), UINT8_C(156), UINT8_C( 55), UINT8_C(223), UINT8_C( 84), UINT8_C( 11), UINT8_C(133), UINT8_C( 88), UINT8_C(116), UINT8_C( 60), UINT8_C(202), UINT8_C( 44), UINT8_C(128), UINT8_C(240), UINT8_C(180), UINT8_C(176),
+        UINT8_C(231), UINT8_C(185), UINT8_C(218), UINT8_C(226), UINT8_C( 83), UINT8_C(206), UINT8_C(194), UINT8_C( 24), UINT8_C(214), UINT8_C(116), UINT8_C(215), UINT8_C(163), UINT8_C(242), UINT8_C(254), UINT8_C( 25), UINT8_C(147),
+        UINT8_C(160), UINT8_C(136), UINT8_C(133), UINT8_C(  1), UINT8_C( 13), UINT8_C(138), UINT8_C( 61), UINT8_C(146), UINT8_C(106), UINT8_C( 32), UINT8_C( 98), UINT8_C( 99), UINT8_C(197), UINT8_C(153), UINT8_C(161), UINT8_C(211),
+        UINT8_C(252), UINT8_C( 65), UINT8_C( 77), UINT8_C(  4), UINT8_C(  2), UINT8_C(247), UINT8_C(224), UINT8_C(213), UINT8_C(224), UINT8_C(119), UINT8_C(112), UINT8_C(240), UINT8_C(  2), UINT8_C(211), UINT8_C( 40), UINT8_C(125) },
+      { UINT8_C(129), UINT8_C(167), UINT8_C(229), UINT8_C(136), UINT8_C(  9), UINT8_C(173), UINT8_C(242), UINT8_C( 13), UINT8_C( 43), UINT8_C( 96), UINT8_C(196), UINT8_C(  7), UINT8_C( 51), UINT8_C(248), UINT8_C(126), UINT8_C(252),
+        UINT8_C(208), UINT8_C(192), UINT8_C(131), UINT8_C(100), UINT8_C( 54), UINT8_C( 94), UINT8_C( 52), UINT8_C( 89), UINT8_C( 82), UINT8_C(212), UINT8_C(165), UINT8_C(  5), UINT8_C(  9), UINT8_C(245), UINT8_C(181), UINT8_C(182),
+        UINT8_C( 56), UINT8_C( 39), UINT8_C(196), UINT8_C(144), UINT8_C(141), UINT8_C(118), UINT8_C(222), UINT8_C(195), UINT8_C( 63), UINT8_C(171), UINT8_C(126), UINT8_C( 85), UINT8_C( 16), UINT8_C(107), UINT8_C( 20), UINT8_C(125),
+        UINT8_C( 15), UINT8_C( 88), UINT8_C( 69), UINT8_C(202), UINT8_C(244), UINT8_C( 28), UINT8_C(196), UINT8_C(119), UINT8_C(122), UINT8_C( 59), UINT8_C(169), UINT8_C( 18), UINT8_C(124), UINT8_C( 46), UINT8_C( 60), UINT8_C(178) } },
+      { { UINT8_C(152), UINT8_C(166), UINT8_C(111), UINT8_C( 71), UINT8_C( 91), UINT8_C( 47), UINT8_C( 63), UINT8_C(  8), UINT8_C(157), UINT8_C(199), UINT8_C(219), UINT8_C( 34), UINT8_C(151), UINT8_C(115), UINT8_C(235), UINT8_C(247),
+        UINT8_C(176), UINT8_C(152), UINT8_C(140), UINT8_C(155), UINT8_C( 14), UINT8_C(171), UINT8_C( 76), UINT8_C( 96), UINT8_C(212), UINT8_C( 53), UINT8_C( 39), UINT8_C(227), UINT8_C( 40), UINT8_C(134), UINT8_C(107), UINT8_C(239),
+        UINT8_C( 93), UINT8_C( 88), UINT8_C(176), UINT8_C(206), UINT8_C(241), UINT8_C(120), UINT8_C( 85), UINT8_C(111), UINT8_C( 32), UINT8_C(104), UINT8_C(101), UINT8_C(193), UINT8_C( 84), UINT8_C( 19), UINT8_C( 87), UINT8_C( 74),
+        UINT8_C(248), UINT8_C( 63), UINT8_C( 77), UINT8_C( 35), UINT8_C(216), UINT8_C(226), UINT8_C(101), UINT8_C(144), UINT8_C(121), UINT8_C( 36), UINT8_C( 35), UINT8_C( 42), UINT8_C( 56), UINT8_C(195), UINT8_C( 33), UINT8_C(246) },
+      { UINT8_C( 71), UINT8_C( 13), UINT8_C(  6), UINT8_C(  7), UINT8_C(164), UINT8_C(130), UINT8_C(209), UINT8_C( 12), UINT8_C(209), UINT8_C( 65), UINT8_C(184), UINT8_C(155), UINT8_C(113), UINT8_C(219), UINT8_C(110), UINT8_C(202),
+        UINT8_C( 54), UINT8_C(133), UINT8_C(187), UINT8_C( 60), UINT8_C( 89), UINT8_C(138), UINT8_C(175), UINT8_C(  0), UINT8_C( 41), UINT8_C( 24), UINT8_C(144), UINT8_C(  4), UINT8_C( 27), UINT8_C(213), UINT8_C(166), UINT8_C(177),
+        UINT8_C( 17), UINT8_C(242), UINT8_C(105), UINT8_C( 79), UINT8_C(201), UINT8_C( 56), UINT8_C(227), UINT8_C(251), UINT8_C(  8), UINT8_C(178), UINT8_C(163), UINT8_C( 13), UINT8_C( 85), UINT8_C(179), UINT8_C( 52), UINT8_C(146),
+        UINT8_C(193), UINT8_C(167), UINT8_C(232), UINT8_C( 86), UINT8_C(  6), UINT8_C(173), UINT8_C(230), UINT8_C(217), UINT8_C( 12), UINT8_C(190), UINT8_C(164), UINT8_C( 56), UINT8_C(222), UINT8_C( 47), UINT8_C(216), UINT8_C(181) },
+      { UINT8_C(149), UINT8_C(243), UINT8_C(217), UINT8_C(249), UINT8_C(232), UINT8_C( 27), UINT8_C(203), UINT8_C(235), UINT8_C(123), UINT8_C(243), UINT8_C(163), UINT8_C( 98), UINT8_C( 20), UINT8_C( 99), UINT8_C( 13), UINT8_C(  5),
+        UINT8_C(  4), UINT8_C(135), UINT8_C(228), UINT8_C( 72), UINT8_C( 83), UINT8_C( 10), UINT8_C( 40), UINT8_C( 51), UINT8_C(118), UINT8_C( 59), UINT8_C(151), UINT8_C( 90), UINT8_C(152), UINT8_C(110), UINT8_C( 42), UINT8_C( 18),
+        UINT8_C(106), UINT8_C(246), UINT8_C( 87), UINT8_C( 18), UINT8_C( 64), UINT8_C(141), UINT8_C(167), UINT8_C(160), UINT8_C( 97), UINT8_C(190), UINT8_C(213), UINT8_C(102), UINT8_C( 70), UINT8_C( 66), UINT8_C(180), UINT8_C(127),
+        UINT8_C(255), UINT8_C(165), UINT8_C(179), UINT8_C( 97), UINT8_C(187), UINT8_C(218), UINT8_C( 35), UINT8_C(142), UINT8_C(252), UINT8_C(246), UINT8_C(235), UINT8_C(219), UINT8_C(152), UINT8_C(  3), UINT8_C(105), UINT8_C( 45) },
+      { UINT8_C(229), UINT8_C(115), UINT8_C(248), UINT8_C(151), UINT8_C(114), UINT8_C(146), UINT8_C(251), UINT8_C(148), UINT8_C( 33), UINT8_C(218), UINT8_C( 32), UINT8_C( 80), UINT8_C( 55), UINT8_C(218), UINT8_C( 42), UINT8_C( 31),
+        UINT8_C(162), UINT8_C( 69), UINT8_C( 14), UINT8_C(199), UINT8_C(138), UINT8_C(198), UINT8_C( 28), UINT8_C( 99), UINT8_C( 34), UINT8_C(105), UINT8_C(224), UINT8_C( 98), UINT8_C(145), UINT8_C( 60), UINT8_C(176), UINT8_C(151),
+        UINT8_C( 24), UINT8_C(142), UINT8_C( 76), UINT8_C(203), UINT8_C(104), UINT8_C(164), UINT8_C( 66), UINT8_C( 97), UINT8_C(181), UINT8_C(174), UINT8_C(250), UINT8_C(237), UINT8_C(147), UINT8_C( 21), UINT8_C( 80), UINT8_C( 43),
+        UINT8_C(203), UINT8_C( 36), UINT8_C( 66), UINT8_C(237), UINT8_C(211), UINT8_C(197), UINT8_C(140), UINT8_C( 80), UINT8_C(187), UINT8_C(252), UINT8_C(211), UINT8_C(173), UINT8_C( 28), UINT8_C(250), UINT8_C(235), UINT8_C(119) },
+      { UINT8_C(252), UINT8_C( 76), UINT8_C(241), UINT8_C( 47), UINT8_C( 45), UINT8_C( 92), UINT8_C( 11), UINT8_C( 87), UINT8_C(137), UINT8_C(188), UINT8_C(158), UINT8_C(142), UINT8_C(141), UINT8_C( 17), UINT8_C(167), UINT8_C(134),
+        UINT8_C(250), UINT8_C(105), UINT8_C(107), UINT8_C(188), UINT8_C( 75), UINT8_C(133), UINT8_C(166), UINT8_C( 22), UINT8_C(189), UINT8_C(184), UINT8_C(185), UINT8_C(223), UINT8_C(247), UINT8_C(254), UINT8_C(171), UINT8_C( 27),
+        UINT8_C( 27), UINT8_C( 99), UINT8_C(244), UINT8_C(151), UINT8_C(212), UINT8_C(151), UINT8_C(191), UINT8_C( 19), UINT8_C(238), UINT8_C(  5), UINT8_C( 79), UINT8_C(113), UINT8_C(244), UINT8_C(165), UINT8_C( 48), UINT8_C(130),
+        UINT8_C( 51), UINT8_C(244), UINT8_C(121), UINT8_C(236), UINT8_C(169), UINT8_C(182), UINT8_C( 77), UINT8_C( 47), UINT8_C( 34), UINT8_C(201), UINT8_C(199), UINT8_C( 49), UINT8_C(140), UINT8_C(201), UINT8_C(112), UINT8_C(162) },
+      { UINT8_C(130), UINT8_C( 99), UINT8_C( 36), UINT8_C(242), UINT8_C(187), UINT8_C(172), UINT8_C(143), UINT8_C(117), UINT8_C(143), UINT8_C( 80), UINT8_C(181), UINT8_C(129), UINT8_C(135), UINT8_C(138), UINT8_C( 68), UINT8_C( 60),
+        UINT8_C(148), UINT8_C(195), UINT8_C(143), UINT8_C(110), UINT8_C(200), UINT8_C( 24), UINT8_C( 62), UINT8_C( 60), UINT8_C( 42), UINT8_C(240), UINT8_C(184), UINT8_C(251), UINT8_C( 19), UINT8_C(202), UINT8_C(190), UINT8_C( 56),
+        UINT8_C(183), UINT8_C(114), UINT8_C(158), UINT8_C( 21), UINT8_C(138), UINT8_C( 52), UINT8_C(214), UINT8_C( 74), UINT8_C(177), UINT8_C( 42), UINT8_C( 43), UINT8_C(255), UINT8_C(241), UINT8_C( 78), UINT8_C(125), UINT8_C( 53),
+        UINT8_C(120), UINT8_C( 40), UINT8_C( 57), UINT8_C(143), UINT8_C(205), UINT8_C(167), UINT8_C(242), UINT8_C(127), UINT8_C( 42), UINT8_C( 33), UINT8_C(218), UINT8_C( 14), UINT8_C(254), UINT8_C(164), UINT8_C( 18), UINT8_C(162) },
+      { UINT8_C( 33), UINT8_C( 11), UINT8_C(172), UINT8_C(109), UINT8_C(154), UINT8_C( 96), UINT8_C( 73), UINT8_C( 44), UINT8_C(146), UINT8_C(220), UINT8_C(178), UINT8_C(128), UINT8_C(215), UINT8_C( 35), UINT8_C( 79), UINT8_C(189),
+        UINT8_C(211), UINT8_C( 78), UINT8_C(159), UINT8_C(178), UINT8_C( 88), UINT8_C(231), UINT8_C( 56), UINT8_C(138), UINT8_C( 66), UINT8_C( 34), UINT8_C(  5), UINT8_C(148), UINT8_C(202), UINT8_C(139), UINT8_C(123), UINT8_C(169),
+        UINT8_C( 14), UINT8_C( 35), UINT8_C( 56), UINT8_C(146), UINT8_C(112), UINT8_C(132), UINT8_C(109), UINT8_C( 13), UINT8_C(147), UINT8_C(234), UINT8_C( 85), UINT8_C(233), UINT8_C(201), UINT8_C( 99), UINT8_C(206), UINT8_C(151),
+        UINT8_C( 37), UINT8_C(218), UINT8_C( 19), UINT8_C(164), UINT8_C(188), UINT8_C(247), UINT8_C(222), UINT8_C(217), UINT8_C( 73), UINT8_C(233), UINT8_C(214), UINT8_C(109), UINT8_C(254), UINT8_C( 40), UINT8_C( 92), UINT8_C(206) },
+      { UINT8_C( 38), UINT8_C(109), UINT8_C(227), UINT8_C( 98), UINT8_C(196), UINT8_C(  1), UINT8_C(210), UINT8_C(141), UINT8_C( 47), UINT8_C(141), UINT8_C( 59), UINT8_C(143), UINT8_C(244), UINT8_C( 99), UINT8_C(143), UINT8_C(  9),
+        UINT8_C(145), UINT8_C( 32), UINT8_C( 24), UINT8_C( 42), UINT8_C( 45), UINT8_C(206), UINT8_C( 80), UINT8_C( 74), UINT8_C(182), UINT8_C(222), UINT8_C(192), UINT8_C(164), UINT8_C( 16), UINT8_C(188), UINT8_C( 16), UINT8_C(241),
+        UINT8_C(238), UINT8_C( 42), UINT8_C(211), UINT8_C(229), UINT8_C(156), UINT8_C(135), UINT8_C(135), UINT8_C( 77), UINT8_C(188), UINT8_C( 79), UINT8_C(211), UINT8_C(123), UINT8_C( 76), UINT8_C(  5), UINT8_C(119), UINT8_C(126),
+        UINT8_C(214), UINT8_C(182), UINT8_C(230), UINT8_C(253), UINT8_C( 83), UINT8_C(193), UINT8_C(240), UINT8_C(187), UINT8_C(230), UINT8_C( 43), UINT8_C(115), UINT8_C(183), UINT8_C(105), UINT8_C(155), UINT8_C(241), UINT8_C( 53) },
+      { UINT8_C(238), UINT8_C(111), UINT8_C(176), UINT8_C(202), UINT8_C(204), UINT8_C( 16), UINT8_C(232), UINT8_C(118), UINT8_C( 62), UINT8_C( 24), UINT8_C(232), UINT8_C( 62), UINT8_C(194), UINT8_C(201), UINT8_C( 54), UINT8_C(134),
+        UINT8_C(246), UINT8_C( 68), UINT8_C(218), UINT8_C(171), UINT8_C( 15), UINT8_C(141), UINT8_C(138), UINT8_C( 47), UINT8_C(145), UINT8_C(213), UINT8_C( 38), UINT8_C( 98), UINT8_C( 85), UINT8_C(144), UINT8_C(192), UINT8_C(183),
+        UINT8_C( 41), UINT8_C(138), UINT8_C( 37), UINT8_C(220), UINT8_C( 25), UINT8_C(244), UINT8_C(103), UINT8_C( 23), UINT8_C(244), UINT8_C( 34), UINT8_C(122), UINT8_C( 63), UINT8_C( 92), UINT8_C( 65), UINT8_C(100), UINT8_C(226),
+        UINT8_C(228), UINT8_C(215), UINT8_C( 88), UINT8_C(102), UINT8_C( 40), UINT8_C( 82), UINT8_C(138), UINT8_C(106), UINT8_C(112), UINT8_C(235), UINT8_C(192), UINT8_C( 50), UINT8_C(161), UINT8_C(114), UINT8_C(209), UINT8_C(  6) },
+      { UINT8_C( 63), UINT8_C(149), UINT8_C( 54), UINT8_C(184), UINT8_C( 79), UINT8_C(104), UINT8_C(230), UINT8_C(102), UINT8_C( 98), UINT8_C(169), UINT8_C(116), UINT8_C( 57), UINT8_C(218), UINT8_C(171), UINT8_C(209), UINT8_C(145),
+        UINT8_C(140), UINT8_C(124), UINT8_C( 46), UINT8_C(232), UINT8_C( 85), UINT8_C(126), UINT8_C(250), UINT8_C( 87), UINT8_C( 59), UINT8_C(  5), UINT8_C(  9), UINT8_C(227), UINT8_C(105), UINT8_C(194), UINT8_C( 17), UINT8_C(134),
+        UINT8_C( 74), UINT8_C(  5), UINT8_C(163), UINT8_C(  8), UINT8_C( 67), UINT8_C(213), UINT8_C( 29), UINT8_C( 22), UINT8_C(151), UINT8_C(253), UINT8_C(195), UINT8_C(  2), UINT8_C(106), UINT8_C(113), UINT8_C(255), UINT8_C(186),
+        UINT8_C( 76), UINT8_C(133), UINT8_C(119), UINT8_C( 52), UINT8_C(246), UINT8_C(108), UINT8_C(222), UINT8_C(160), UINT8_C(173), UINT8_C(203), UINT8_C( 19), UINT8_C(164), UINT8_C(115), UINT8_C(131), UINT8_C( 46), UINT8_C(215) },
+      { UINT8_C(171), UINT8_C(153), UINT8_C( 59), UINT8_C(127), UINT8_C( 42), UINT8_C(223), UINT8_C( 96), UINT8_C(  6), UINT8_C(224), UINT8_C(245), UINT8_C( 76), UINT8_C( 76), UINT8_C(178), UINT8_C(119), UINT8_C(197), UINT8_C(201),
+        UINT8_C(200), UINT8_C(226), UINT8_C( 85), UINT8_C( 63), UINT8_C(117), UINT8_C(115), UINT8_C(175), UINT8_C(178), UINT8_C(146), UINT8_C(128), UINT8_C( 62), UINT8_C(238), UINT8_C( 67), UINT8_C(156), UINT8_C(188), UINT8_C( 83),
+        UINT8_C(128), UINT8_C(160), UINT8_C(183), UINT8_C( 43), UINT8_C( 51), UINT8_C( 18), UINT8_C(190), UINT8_C(146), UINT8_C(192), UINT8_C( 37), UINT8_C( 24), UINT8_C( 34), UINT8_C(195), UINT8_C(218), UINT8_C(138), UINT8_C(192),
+        UINT8_C(243), UINT8_C(141), UINT8_C(188), UINT8_C( 84), UINT8_C(167), UINT8_C(119), UINT8_C(122), UINT8_C(242), UINT8_C(135), UINT8_C(181), UINT8_C(185), UINT8_C(  0), UINT8_C(151), UINT8_C(230), UINT8_C(136), UINT8_C( 53) },
+      { UINT8_C( 84), UINT8_C( 23), UINT8_C(253), UINT8_C(177), UINT8_C(219), UINT8_C(125), UINT8_C(234), UINT8_C(101), UINT8_C(140), UINT8_C(154), UINT8_C(112), UINT8_C( 89), UINT8_C(103), UINT8_C(168), UINT8_C(220), UINT8_C(125),
+        UINT8_C(144), UINT8_C(116), UINT8_C(152), UINT8_C( 26), UINT8_C(201), UINT8_C( 41), UINT8_C(176), UINT8_C(246), UINT8_C(145), UINT8_C(139), UINT8_C(104), UINT8_C( 61), UINT8_C(227), UINT8_C(131), UINT8_C(196), UINT8_C( 11),
+        UINT8_C(181), UINT8_C( 49), UINT8_C( 53), UINT8_C(247), UINT8_C(192), UINT8_C(219), UINT8_C(163), UINT8_C( 97), UINT8_C( 32), UINT8_C(252), UINT8_C( 76), UINT8_C( 61), UINT8_C(  9), UINT8_C(251), UINT8_C(193), UINT8_C(214),
+        UINT8_C(134), UINT8_C(176), UINT8_C(211), UINT8_C(137), UINT8_C( 31), UINT8_C( 79), UINT8_C(234), UINT8_C( 90), UINT8_C(244), UINT8_C(133), UINT8_C( 72), UINT8_C( 87), UINT8_C( 68), UINT8_C(  4), UINT8_C(236), UINT8_C( 37) },
+      { UINT8_C( 82), UINT8_C(125), UINT8_C( 55), UINT8_C(170), UINT8_C(148), UINT8_C(127), UINT8_C( 47), UINT8_C(219), UINT8_C(187), UINT8_C(128), UINT8_C(200), UINT8_C(215), UINT8_C(218), UINT8_C(203), UINT8_C(227), UINT8_C(204),
+        UINT8_C(131), UINT8_C( 26), UINT8_C(126), UINT8_C( 34), UINT8_C( 13), UINT8_C(127), UINT8_C( 92), UINT8_C( 44), UINT8_C(116), UINT8_C( 27), UINT8_C(121), UINT8_C(  1), UINT8_C( 85), UINT8_C( 54), UINT8_C(124), UINT8_C( 62),
+        UINT8_C(194), UINT8_C(218), UINT8_C(248), UINT8_C(174), UINT8_C( 77), UINT8_C(236), UINT8_C( 18), UINT8_C(186), UINT8_C( 26), UINT8_C(117), UINT8_C(153), UINT8_C(133), UINT8_C(226), UINT8_C(161), UINT8_C(167), UINT8_C(146),
+        UINT8_C( 32), UINT8_C(  2), UINT8_C(120), UINT8_C( 24), UINT8_C( 23), UINT8_C(150), UINT8_C( 21), UINT8_C( 47), UINT8_C(108), UINT8_C(  3), UINT8_C(106), UINT8_C( 94), UINT8_C( 29), UINT8_C(246), UINT8_C(172), UINT8_C( 26) },
+      { UINT8_C( 58), UINT8_C(212), UINT8_C(208), UINT8_C( 62), UINT8_C( 38), UINT8_C(106), UINT8_C(150), UINT8_C(130), UINT8_C(171), UINT8_C(135), UINT8_C( 20), UINT8_C( 86), UINT8_C(209), UINT8_C( 53), UINT8_C(218), UINT8_C(254),
+        UINT8_C(205), UINT8_C(147), UINT8_C(206), UINT8_C( 43), UINT8_C( 96), UINT8_C(156), UINT8_C( 73), UINT8_C(176), UINT8_C(  3), UINT8_C( 51), UINT8_C(245), UINT8_C( 97), UINT8_C(119), UINT8_C( 87), UINT8_C(189), UINT8_C( 74),
+        UINT8_C(140), UINT8_C( 64), UINT8_C( 14), UINT8_C(223), UINT8_C(126), UINT8_C(253), UINT8_C(180), UINT8_C( 55), UINT8_C( 14), UINT8_C( 96), UINT8_C( 99), UINT8_C(110), UINT8_C(219), UINT8_C(221), UINT8_C( 27), UINT8_C( 57),
+        UINT8_C(245), UINT8_C( 69), UINT8_C( 37), UINT8_C( 55), UINT8_C(177), UINT8_C(192), UINT8_C(199), UINT8_C(120), UINT8_C(230), UINT8_C( 25), UINT8_C( 34), UINT8_C(142), UINT8_C(209), UINT8_C( 65), UINT8_C( 39), UINT8_C(146) },
+      { UINT8_C(121), UINT8_C( 94), UINT8_C(170), UINT8_C(167), UINT8_C(109), UINT8_C( 87), UINT8_C(116), UINT8_C( 45), UINT8_C(158), UINT8_C(101), UINT8_C(107), UINT8_C(150), UINT8_C(179), UINT8_C(164), UINT8_C( 86), UINT8_C(245),
+        UINT8_C(195), UINT8_C(  8), UINT8_C(244), UINT8_C(152), UINT8_C(228), UINT8_C( 58), UINT8_C(151), UINT8_C( 13), UINT8_C(146), UINT8_C(106), UINT8_C(224), UINT8_C( 29), UINT8_C( 80), UINT8_C( 83), UINT8_C(222), UINT8_C(183),
+        UINT8_C( 19), UINT8_C(175), UINT8_C( 54), UINT8_C( 75), UINT8_C( 93), UINT8_C(239), UINT8_C(185), UINT8_C( 46), UINT8_C(  4), UINT8_C(  1), UINT8_C(252), UINT8_C( 19), UINT8_C(255), UINT8_C(202), UINT8_C( 30), UINT8_C(160),
+        UINT8_C(142), UINT8_C( 89), UINT8_C( 38), UINT8_C(195), UINT8_C(180), UINT8_C(254), UINT8_C( 28), UINT8_C(210), UINT8_C(191), UINT8_C( 30), UINT8_C(195), UINT8_C( 92), UINT8_C( 79), UINT8_C( 63), UINT8_C(171), UINT8_C(  1) },
+      { UINT8_C(158), UINT8_C(222), UINT8_C(121), UINT8_C(225), UINT8_C( 95), UINT8_C(147), UINT8_C( 46), UINT8_C(166), UINT8_C(119), UINT8_C(241), UINT8_C( 17), UINT8_C( 36), UINT8_C( 67), UINT8_C( 73), UINT8_C( 61), UINT8_C(100),
+        UINT8_C(135), UINT8_C(167), UINT8_C(165), UINT8_C(193), UINT8_C(150), UINT8_C(239), UINT8_C(213), UINT8_C( 12), UINT8_C(179), UINT8_C( 95), UINT8_C(  3), UINT8_C(114), UINT8_C(248), UINT8_C( 86), UINT8_C(135), UINT8_C(170),
+        UINT8_C(101), UINT8_C( 90), UINT8_C( 15), UINT8_C(132), UINT8_C(184), UINT8_C( 65), UINT8_C( 70), UINT8_C(103), UINT8_C(200), UINT8_C(176), UINT8_C(  5), UINT8_C(214), UINT8_C( 50), UINT8_C(123), UINT8_C( 33), UINT8_C(206),
+        UINT8_C(134), UINT8_C(229), UINT8_C(251), UINT8_C(106), UINT8_C(225), UINT8_C(145), UINT8_C(107), UINT8_C( 27), UINT8_C( 53), UINT8_C(253), UINT8_C( 39), UINT8_C(205), UINT8_C(160), UINT8_C( 65), UINT8_C( 12), UINT8_C(106) } },
+      { { INT32_C(-2104792370), INT32_C( -820082076), INT32_C( 2017945527), INT32_C(  846024739), INT32_C(  604888730), INT32_C( 2090539312), INT32_C( 2040137389), INT32_C(  981601486),
+        INT32_C( -696655296), INT32_C(  -12184315), INT32_C( 2057691948), INT32_C(-1915303500), INT32_C( -714170357), INT32_C( 1176102786), INT32_C(  579342505), INT32_C( -966451340) },
+      { INT32_C( 1829897859), INT32_C(  870105686), INT32_C( -863633048), INT32_C( -345266082), INT32_C( 1655382655), INT32_C(-1313831985), INT32_C(  527313323), INT32_C( 1861312631),
+        INT32_C( 1195276900), INT32_C(  777545292), INT32_C( 1399172605), INT32_C( -123976038), INT32_C( 1917844882), INT32_C(-1785791656), INT32_C(  420010824), INT32_C(  818558703) },
+      { INT32_C(-1561629345), INT32_C( -275518658), INT32_C( 1616869911), INT32_C(-1498002571), INT32_C( 1463548443), INT32_C( -657413337), INT32_C( -887938314), INT32_C(-1278886529),
+        INT32_C( -803933545), INT32_C( 1638244957), INT32_C(-1748984295), INT32_C(   61594332), INT32_C(-2099642956), INT32_C(-1421417349), INT32_C(  196561452), INT32_C( -836877326) },
+      { INT32_C(  370010795), INT32_C(-1726903447), INT32_C(-1859219163), INT32_C( 1713514354), INT32_C( 1441047890), INT32_C(  909355462), INT32_C(  149279051), INT32_C(-1498239794),
+        INT32_C(  684261498), INT32_C( -986202621), INT32_C(-2067287848), INT32_C(-1067515300), INT32_C(-1319827847), INT32_C( -894433172), INT32_C(-1049798493), INT32_C( -173260124) },
+      { INT32_C( -346121150), INT32_C( -722502777), INT32_C( -641413396), INT32_C(  147285647), INT32_C(  -29456332), INT32_C(  581482143), INT32_C(-1693371269), INT32_C(-1226271903),
+        INT32_C(  868603137), INT32_C(  904821167), INT32_C(    4693907), INT32_C( 1923424749), INT32_C( 1980575670), INT32_C(-1454395910), INT32_C( 1920101488), INT32_C(   32125535) },
+      { INT32_C(-2067638379), INT32_C( 1550032843), INT32_C( 1595566534), INT32_C(  120959023), INT32_C(-1852249531), INT32_C(-1289023482), INT32_C(  425737388), INT32_C( 2047283979),
+        INT32_C(  279067012), INT32_C( -343121492), INT32_C(-1117748806), INT32_C(-1456893403), INT32_C(-2109128455), INT32_C( 1571282606), INT32_C(-2106785716), INT32_C(-1809277662) } },
+      { { INT32_C(-2103749521), INT32_C( -819178277), INT32_C( 2018861963), INT32_C(  847054010), INT32_C(  605837499), INT32_C( 2091344406), INT32_C( 2041014702), INT32_C(  982552752),
+        INT32_C( -695788983), INT32_C(  -11238769), INT32_C( 2058542419), INT32_C(-1914263623), INT32_C( -713172123), INT32_C( 1177265541), INT32_C(  580212537), INT32_C( -965536715) },
+      { INT32_C( 1831025669), INT32_C(  871137910), INT32_C( -862469061), INT32_C( -344011113), INT32_C( 1656502109), INT32_C(-1312902177), INT32_C(  528240658), INT32_C( 1862365073),
+        INT32_C( 1196294038), INT32_C(  778592072), INT32_C( 1400127786), INT32_C( -122853515), INT32_C( 1918944550), INT32_C(-1784495000), INT32_C(  421142103), INT32_C(  819559179) },
+      { INT32_C(-1560396931), INT32_C( -274486912), INT32_C( 1617937368), INT32_C(-1496756793), INT32_C( 1464755126), INT32_C( -656451020), INT32_C( -886868934), INT32_C(-1277757513),
+        INT32_C( -802899483), INT32_C( 1639417446), INT32_C(-1747935379), INT32_C(   62799961), INT32_C(-2098389011), INT32_C(-1420087478), INT32_C(  197684326), INT32_C( -835747063) },
+      { INT32_C(  371141373), INT32_C(-1725910599), INT32_C(-1858141762), INT32_C( 1714680347), INT32_C( 1442099028), INT32_C(  910299118), INT32_C(  150257462), INT32_C(-1497245470),
+        INT32_C(  685220491), INT32_C( -985164988), INT32_C(-2066255411), INT32_C(-1066458696), INT32_C(-1318691112), INT32_C( -893169312), INT32_C(-1048794473), INT32_C( -172208992) },
+      { INT32_C( -344924625), INT32_C( -721449619), INT32_C( -640243572), INT32_C(  148535445), INT32_C(  -28223485), INT32_C(  582466006), INT32_C(-1692201209), INT32_C(-1225084414),
+        INT32_C(  869605938), INT32_C(  905979329), INT32_C(    5754053), INT32_C( 1924553732), INT32_C( 1981759801), INT32_C(-1453081235), INT32_C( 1921304505), INT32_C(   33231023) },
+      { INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0),
+        INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0), INT32_C(          0) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int32_t r[6][16];
+
+    simde_test_amx_config(test_vec[i].m, test_vec[i].k, test_vec[i].n);
+    simde_tile_loadd(0, test_vec[i].c, sizeof(test_vec[i].c[0]));
+    simde_tile_loadd(1, test_vec[i].a, sizeof(test_vec[i].a[0]));
+    simde_tile_loadd(2, test_vec[i].b, sizeof(test_vec[i].b[0]));
+    simde_tile_dpbuud(0, 1, 2);
+    simde_memset(r, 0, sizeof(r));
+    simde_tile_stored(0, r, sizeof(r[0]));
+    simde_tile_release();
+
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) {
+      simde_assert_equal_vi32(sizeof(r[j]) / sizeof(r[j][0]), r[j], test_vec[i].r[j]);
+    }
+  }
+
+  return 0;
+}
+
+static int
+test_simde_tile_dpbf16ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const uint8_t m;
+    const uint8_t k;
+    const uint8_t n;
+    const uint16_t a[6][32];
+    const uint16_t b[16][32];
+    const simde_float32 c[6][16];
+    const simde_float32 r[6][16];
+  } test_vec[] = {
+    { 6, 8, 5,
+      { { UINT16_C(49408), UINT16_C(49392), UINT16_C(16320), UINT16_C(49216), UINT16_C(16528), UINT16_C(48896), UINT16_C(16560), UINT16_C(16592),
+        UINT16_C(49152), UINT16_C(16592), UINT16_C(48896), UINT16_C(16480), UINT16_C(49088), UINT16_C(49376), UINT16_C(49376), UINT16_C(49152),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(49392), UINT16_C(49216), UINT16_C(49360), UINT16_C(49184), UINT16_C(16528), UINT16_C(49376), UINT16_C(16592), UINT16_C(49088),
+        UINT16_C(16640), UINT16_C(48896), UINT16_C(49216), UINT16_C(49408), UINT16_C(49248), UINT16_C(16128), UINT16_C(16384), UINT16_C(16560),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(16640), UINT16_C(16448), UINT16_C(16416), UINT16_C(16592), UINT16_C(16512), UINT16_C(49184), UINT16_C(16544), UINT16_C(16320),
+        UINT16_C(16608), UINT16_C(49408), UINT16_C(49184), UINT16_C(16640), UINT16_C(49152), UINT16_C(16560), UINT16_C(49216), UINT16_C(49216),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(49088), UINT16_C(16640), UINT16_C(49280), UINT16_C(16416), UINT16_C(49280), UINT16_C(16592), UINT16_C(    0), UINT16_C(48896),
+        UINT16_C(49088), UINT16_C(49088), UINT16_C(49392), UINT16_C(16576), UINT16_C(49344), UINT16_C(49280), UINT16_C(16416), UINT16_C(49392),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(49328), UINT16_C(16576), UINT16_C(16256), UINT16_C(49344), UINT16_C(16480), UINT16_C(49344), UINT16_C(49248), UINT16_C(49376),
+        UINT16_C(49152), UINT16_C(49312), UINT16_C(49376), UINT16_C(49312), UINT16_C(16544), UINT16_C(49088), UINT16_C(49392), UINT16_C(48896),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(49360), UINT16_C(49360), UINT16_C(16128), UINT16_C(49312), UINT16_C(49216), UINT16_C(49392), UINT16_C(49408), UINT16_C(49328),
+        UINT16_C(49024), UINT16_C(16544), UINT16_C(49248), UINT16_C(16256), UINT16_C(16256), UINT16_C(16320), UINT16_C(49184), UINT16_C(16480),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+      { { UINT16_C(16576), UINT16_C(16576), UINT16_C(16544), UINT16_C(16384), UINT16_C(16512), UINT16_C(16128), UINT16_C(16640), UINT16_C(49408),
+        UINT16_C(49312), UINT16_C(49184), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(16560), UINT16_C(49344), UINT16_C(49152), UINT16_C(16480), UINT16_C(49408), UINT16_C(49216), UINT16_C(49312), UINT16_C(49408),
+        UINT16_C(16560), UINT16_C(16384), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(16384), UINT16_C(48896), UINT16_C(16528), UINT16_C(49184), UINT16_C(16256), UINT16_C(49408), UINT16_C(16560), UINT16_C(16560),
+        UINT16_C(49280), UINT16_C(16560), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(49152), UINT16_C(16624), UINT16_C(49408), UINT16_C(16416), UINT16_C(16624), UINT16_C(49184), UINT16_C(16640), UINT16_C(49088),
+        UINT16_C(49312), UINT16_C(16480), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(16128), UINT16_C(16576), UINT16_C(49296), UINT16_C(16560), UINT16_C(16544), UINT16_C(49344), UINT16_C(49248), UINT16_C(49184),
+        UINT16_C(49152), UINT16_C(49024), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(49392), UINT16_C(16480), UINT16_C(49328), UINT16_C(16480), UINT16_C(49360), UINT16_C(49344), UINT16_C(49088), UINT16_C(49024),
+        UINT16_C(49152), UINT16_C(49344), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(48896), UINT16_C(49216), UINT16_C(49024), UINT16_C(49184), UINT16_C(49360), UINT16_C(49216), UINT16_C(16480), UINT16_C(16256),
+        UINT16_C(16624), UINT16_C(16384), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(16624), UINT16_C(16528), UINT16_C(49360), UINT16_C(16512), UINT16_C(49088), UINT16_C(49152), UINT16_C(16640), UINT16_C(49184),
+        UINT16_C(49216), UINT16_C(49184), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(49328), UINT16_C(49328), UINT16_C(16480), UINT16_C(16640), UINT16_C(16640), UINT16_C(16320), UINT16_C(16448), UINT16_C(16592),
+        UINT16_C(49248), UINT16_C(49024), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(16608), UINT16_C(16480), UINT16_C(49248), UINT16_C(49360), UINT16_C(49280), UINT16_C(49280), UINT16_C(16544), UINT16_C(49248),
+        UINT16_C(49152), UINT16_C(49328), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(16592), UINT16_C(16448), UINT16_C(16416), UINT16_C(49392), UINT16_C(16576), UINT16_C(49376), UINT16_C(16384), UINT16_C(49088),
+        UINT16_C(    0), UINT16_C(49392), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(16560), UINT16_C(16512), UINT16_C(49344), UINT16_C(49216), UINT16_C(49088), UINT16_C(16528), UINT16_C(16544), UINT16_C(16384),
+        UINT16_C(49280), UINT16_C(49392), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(49184), UINT16_C(16544), UINT16_C(16320), UINT16_C(49216), UINT16_C(49184), UINT16_C(49184), UINT16_C(49184), UINT16_C(16592),
+        UINT16_C(49216), UINT16_C(49296), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(16512), UINT16_C(16480), UINT16_C(49392), UINT16_C(49392), UINT16_C(16528), UINT16_C(16624), UINT16_C(16320), UINT16_C(16448),
+        UINT16_C(16448), UINT16_C(49216), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(49344), UINT16_C(49328), UINT16_C(49344), UINT16_C(16544), UINT16_C(16128), UINT16_C(16544), UINT16_C(49184), UINT16_C(16416),
+        UINT16_C(16448), UINT16_C(16128), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(16416), UINT16_C(16384), UINT16_C(16512), UINT16_C(49312), UINT16_C(49280), UINT16_C(16576), UINT16_C(16608), UINT16_C(49024),
+        UINT16_C(16640), UINT16_C(16512), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+      { { SIMDE_FLOAT32_C( -32.00), SIMDE_FLOAT32_C(  54.00), SIMDE_FLOAT32_C(  56.00), SIMDE_FLOAT32_C(  90.00),
+        SIMDE_FLOAT32_C( -52.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00) },
+      { SIMDE_FLOAT32_C(  85.00), SIMDE_FLOAT32_C( -43.00), SIMDE_FLOAT32_C(  37.00), SIMDE_FLOAT32_C(  11.00),
+        SIMDE_FLOAT32_C( -61.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00) },
+      { SIMDE_FLOAT32_C( -23.00), SIMDE_FLOAT32_C( -24.00), SIMDE_FLOAT32_C(  54.00), SIMDE_FLOAT32_C( -59.00),
+        SIMDE_FLOAT32_C( -19.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00) },
+      { SIMDE_FLOAT32_C(   6.00), SIMDE_FLOAT32_C( -72.00), SIMDE_FLOAT32_C( -23.00), SIMDE_FLOAT32_C(  78.00),
+        SIMDE_FLOAT32_C( -83.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00) },
+      { SIMDE_FLOAT32_C( -78.00), SIMDE_FLOAT32_C( -27.00), SIMDE_FLOAT32_C( -91.00), SIMDE_FLOAT32_C( -42.00),
+        SIMDE_FLOAT32_C(  80.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00) },
+      { SIMDE_FLOAT32_C(  77.00), SIMDE_FLOAT32_C( -28.00), SIMDE_FLOAT32_C(  46.00), SIMDE_FLOAT32_C( -26.00),
+        SIMDE_FLOAT32_C( -73.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00) } },
+      { { SIMDE_FLOAT32_C( -37.50), SIMDE_FLOAT32_C(  95.50), SIMDE_FLOAT32_C(  29.25), SIMDE_FLOAT32_C(  83.50),
+        SIMDE_FLOAT32_C( -38.25), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00) },
+      { SIMDE_FLOAT32_C(  25.00), SIMDE_FLOAT32_C(-139.25), SIMDE_FLOAT32_C( 295.75), SIMDE_FLOAT32_C(  44.25),
+        SIMDE_FLOAT32_C(-157.50), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00) },
+      { SIMDE_FLOAT32_C( -21.00), SIMDE_FLOAT32_C( -10.25), SIMDE_FLOAT32_C( 164.00), SIMDE_FLOAT32_C( -64.25),
+        SIMDE_FLOAT32_C(-125.75), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00) },
+      { SIMDE_FLOAT32_C(  60.50), SIMDE_FLOAT32_C( -51.75), SIMDE_FLOAT32_C(  21.25), SIMDE_FLOAT32_C(  44.50),
+        SIMDE_FLOAT32_C(-120.75), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00) },
+      { SIMDE_FLOAT32_C(-121.50), SIMDE_FLOAT32_C(  23.75), SIMDE_FLOAT32_C(  22.50), SIMDE_FLOAT32_C(-130.00),
+        SIMDE_FLOAT32_C( 143.25), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00) },
+      { SIMDE_FLOAT32_C(  55.50), SIMDE_FLOAT32_C(  43.75), SIMDE_FLOAT32_C(   6.00), SIMDE_FLOAT32_C(-130.50),
+        SIMDE_FLOAT32_C( -32.75), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00) } } },
+    { 5, 16, 16,
+      { { UINT16_C(49296), UINT16_C(    0), UINT16_C(49088), UINT16_C(49024), UINT16_C(16512), UINT16_C(16592), UINT16_C(49328), UINT16_C(16592),
+        UINT16_C(48896), UINT16_C(49408), UINT16_C(16128), UINT16_C(16320), UINT16_C(49296), UINT16_C(16448), UINT16_C(49280), UINT16_C(49296),
+        UINT16_C(    0), UINT16_C(16384), UINT16_C(16528), UINT16_C(16480), UINT16_C(49392), UINT16_C(49216), UINT16_C(49024), UINT16_C(49296),
+        UINT16_C(49328), UINT16_C(16448), UINT16_C(16624), UINT16_C(16320), UINT16_C(49088), UINT16_C(49184), UINT16_C(16576), UINT16_C(49280) },
+      { UINT16_C(49248), UINT16_C(16544), UINT16_C(16624), UINT16_C(49360), UINT16_C(49296), UINT16_C(49328), UINT16_C(16624), UINT16_C(49344),
+        UINT16_C(16384), UINT16_C(49408), UINT16_C(16320), UINT16_C(16128), UINT16_C(16576), UINT16_C(16448), UINT16_C(16544), UINT16_C(49216),
+        UINT16_C(49312), UINT16_C(    0), UINT16_C(    0), UINT16_C(16480), UINT16_C(49360), UINT16_C(49312), UINT16_C(16480), UINT16_C(16560),
+        UINT16_C(16640), UINT16_C(49312), UINT16_C(16624), UINT16_C(    0), UINT16_C(16560), UINT16_C(49296), UINT16_C(16480), UINT16_C(49296) },
+      { UINT16_C(49328), UINT16_C(49360), UINT16_C(16512), UINT16_C(49296), UINT16_C(16544), UINT16_C(16320), UINT16_C(    0), UINT16_C(49280),
+        UINT16_C(49152), UINT16_C(49088), UINT16_C(49152), UINT16_C(49296), UINT16_C(49296), UINT16_C(16528), UINT16_C(49024), UINT16_C(49360),
+        UINT16_C(16256), UINT16_C(49088), UINT16_C(16320), UINT16_C(16528), UINT16_C(16480), UINT16_C(49328), UINT16_C(16560), UINT16_C(16544),
+        UINT16_C(16512), UINT16_C(48896), UINT16_C(48896), UINT16_C(16512), UINT16_C(49376), UINT16_C(16640), UINT16_C(16256), UINT16_C(49392) },
+      { UINT16_C(49088), UINT16_C(16640), UINT16_C(16384), UINT16_C(49376), UINT16_C(16512), UINT16_C(16576), UINT16_C(16128), UINT16_C(16448),
+        UINT16_C(49152), UINT16_C(49360), UINT16_C(49312), UINT16_C(16608), UINT16_C(16592), UINT16_C(16480), UINT16_C(16544), UINT16_C(49248),
+        UINT16_C(49328), UINT16_C(49152), UINT16_C(49152), UINT16_C(49328), UINT16_C(16592), UINT16_C(49360), UINT16_C(49376), UINT16_C(49408),
+        UINT16_C(49280), UINT16_C(49152), UINT16_C(49408), UINT16_C(16384), UINT16_C(16544), UINT16_C(49184), UINT16_C(16448), UINT16_C(48896) },
+      { UINT16_C(49328), UINT16_C(49408), UINT16_C(16384), UINT16_C(16640), UINT16_C(16128), UINT16_C(16384), UINT16_C(49024), UINT16_C(16384),
+        UINT16_C(16128), UINT16_C(16480), UINT16_C(16576), UINT16_C(49360), UINT16_C(16512), UINT16_C(49312), UINT16_C(49408), UINT16_C(    0),
+        UINT16_C(16480), UINT16_C(    0), UINT16_C(49328), UINT16_C(49088), UINT16_C(16128), UINT16_C(49296), UINT16_C(49024), UINT16_C(16544),
+        UINT16_C(16576), UINT16_C(    0), UINT16_C(49088), UINT16_C(    0), UINT16_C(16128), UINT16_C(49088), UINT16_C(16320), UINT16_C(16320) },
+      { UINT16_C(49184), UINT16_C(16640), UINT16_C(16480), UINT16_C(49088), UINT16_C(16576), UINT16_C(    0), UINT16_C(49280), UINT16_C(16320),
+        UINT16_C(16416), UINT16_C(16624), UINT16_C(49248), UINT16_C(16416), UINT16_C(49152), UINT16_C(49248), UINT16_C(16128), UINT16_C(16256),
+        UINT16_C(49360), UINT16_C(    0), UINT16_C(49376), UINT16_C(16256), UINT16_C(16320), UINT16_C(49088), UINT16_C(16528), UINT16_C(16416),
+        UINT16_C(16544), UINT16_C(49392), UINT16_C(49088), UINT16_C(16576), UINT16_C(49296), UINT16_C(16528), UINT16_C(16640), UINT16_C(49184) } },
+      { { UINT16_C(16384), UINT16_C(49376), UINT16_C(16128), UINT16_C(16560), UINT16_C(49392), UINT16_C(16320), UINT16_C(16256), UINT16_C(16128),
+        UINT16_C(16512), UINT16_C(16128), UINT16_C(    0), UINT16_C(16128), UINT16_C(49248), UINT16_C(49024), UINT16_C(49328), UINT16_C(49248),
+        UINT16_C(16320), UINT16_C(49280), UINT16_C(49328), UINT16_C(49360), UINT16_C(49376), UINT16_C(49280), UINT16_C(16384), UINT16_C(16608),
+        UINT16_C(49248), UINT16_C(16576), UINT16_C(49296), UINT16_C(16320), UINT16_C(49184), UINT16_C(49360), UINT16_C(16320), UINT16_C(16512) },
+      { UINT16_C(16480), UINT16_C(16624), UINT16_C(49184), UINT16_C(16640), UINT16_C(49280), UINT16_C(49248), UINT16_C(49024), UINT16_C(49312),
+        UINT16_C(16480), UINT16_C(49152), UINT16_C(49280), UINT16_C(16560), UINT16_C(16384), UINT16_C(16384), UINT16_C(16640), UINT16_C(16512),
+        UINT16_C(16528), UINT16_C(16592), UINT16_C(49296), UINT16_C(49152), UINT16_C(49360), UINT16_C(16256), UINT16_C(48896), UINT16_C(49392),
+        UINT16_C(49376), UINT16_C(49184), UINT16_C(49088), UINT16_C(16256), UINT16_C(48896), UINT16_C(16576), UINT16_C(16576), UINT16_C(16480) },
+      { UINT16_C(16624), UINT16_C(49248), UINT16_C(49344), UINT16_C(48896), UINT16_C(16320), UINT16_C(16640), UINT16_C(49296), UINT16_C(49312),
+        UINT16_C(16560), UINT16_C(49024), UINT16_C(    0), UINT16_C(49376), UINT16_C(16512), UINT16_C(16576), UINT16_C(49376), UINT16_C(16528),
+        UINT16_C(16480), UINT16_C(48896), UINT16_C(49392), UINT16_C(16624), UINT16_C(48896), UINT16_C(49184), UINT16_C(48896), UINT16_C(16640),
+        UINT16_C(16384), UINT16_C(49376), UINT16_C(16512), UINT16_C(49408), UINT16_C(16560), UINT16_C(16320), UINT16_C(49184), UINT16_C(49088) },
+      { UINT16_C(49184), UINT16_C(49344), UINT16_C(49312), UINT16_C(16608), UINT16_C(16640), UINT16_C(49296), UINT16_C(49152), UINT16_C(16640),
+        UINT16_C(    0), UINT16_C(16608), UINT16_C(49328), UINT16_C(16128), UINT16_C(16528), UINT16_C(16544), UINT16_C(49024), UINT16_C(16624),
+        UINT16_C(49328), UINT16_C(49184), UINT16_C(16416), UINT16_C(49152), UINT16_C(16256), UINT16_C(49296), UINT16_C(16624), UINT16_C(16624),
+        UINT16_C(16416), UINT16_C(48896), UINT16_C(49408), UINT16_C(16560), UINT16_C(16416), UINT16_C(49088), UINT16_C(49328), UINT16_C(16560) },
+      { UINT16_C(16416), UINT16_C(    0), UINT16_C(49408), UINT16_C(16512), UINT16_C(49280), UINT16_C(49328), UINT16_C(49392), UINT16_C(49296),
+        UINT16_C(49248), UINT16_C(16528), UINT16_C(16608), UINT16_C(16384), UINT16_C(48896), UINT16_C(49184), UINT16_C(16448), UINT16_C(48896),
+        UINT16_C(16416), UINT16_C(16528), UINT16_C(49184), UINT16_C(49328), UINT16_C(49392), UINT16_C(16320), UINT16_C(16128), UINT16_C(16384),
+        UINT16_C(49312), UINT16_C(16528), UINT16_C(16320), UINT16_C(49408), UINT16_C(49280), UINT16_C(49408), UINT16_C(49152), UINT16_C(49360) },
+      { UINT16_C(49184), UINT16_C(49408), UINT16_C(49344), UINT16_C(49408), UINT16_C(16608), UINT16_C(49152), UINT16_C(49184), UINT16_C(49344),
+        UINT16_C(49408), UINT16_C(16480), UINT16_C(16320), UINT16_C(16576), UINT16_C(16528), UINT16_C(16480), UINT16_C(49216), UINT16_C(49088),
+        UINT16_C(16544), UINT16_C(49088), UINT16_C(16576), UINT16_C(16128), UINT16_C(16416), UINT16_C(49408), UINT16_C(16608), UINT16_C(49296),
+        UINT16_C(16528), UINT16_C(16384), UINT16_C(    0), UINT16_C(16592), UINT16_C(49328), UINT16_C(49392), UINT16_C(49360), UINT16_C(16640) },
+      { UINT16_C(16448), UINT16_C(49344), UINT16_C(16448), UINT16_C(16592), UINT16_C(16256), UINT16_C(16544), UINT16_C(    0), UINT16_C(49408),
+        UINT16_C(16592), UINT16_C(49312), UINT16_C(16560), UINT16_C(16624), UINT16_C(49360), UINT16_C(16576), UINT16_C(16576), UINT16_C(16576),
+        UINT16_C(16384), UINT16_C(49328), UINT16_C(16416), UINT16_C(16416), UINT16_C(49296), UINT16_C(16512), UINT16_C(16480), UINT16_C(49088),
+        UINT16_C(49280), UINT16_C(16544), UINT16_C(49184), UINT16_C(16128), UINT16_C(49088), UINT16_C(49280), UINT16_C(16480), UINT16_C(16480) },
+      { UINT16_C(49360), UINT16_C(48896), UINT16_C(49360), UINT16_C(49312), UINT16_C(16416), UINT16_C(16448), UINT16_C(49392), UINT16_C(16640),
+        UINT16_C(16320), UINT16_C(16544), UINT16_C(49392), UINT16_C(16544), UINT16_C(16544), UINT16_C(49216), UINT16_C(49296), UINT16_C(16512),
+        UINT16_C(16544), UINT16_C(49152), UINT16_C(49312), UINT16_C(49152), UINT16_C(49184), UINT16_C(49376), UINT16_C(16512), UINT16_C(49328),
+        UINT16_C(48896), UINT16_C(49344), UINT16_C(49328), UINT16_C(16480), UINT16_C(49392), UINT16_C(16320), UINT16_C(    0), UINT16_C(16256) },
+      { UINT16_C(49328), UINT16_C(16592), UINT16_C(16576), UINT16_C(49328), UINT16_C(49328), UINT16_C(49088), UINT16_C(49376), UINT16_C(16320),
+        UINT16_C(16576), UINT16_C(16544), UINT16_C(16448), UINT16_C(    0), UINT16_C(49024), UINT16_C(16576), UINT16_C(49392), UINT16_C(16624),
+        UINT16_C(16608), UINT16_C(16416), UINT16_C(16592), UINT16_C(49216), UINT16_C(16448), UINT16_C(49328), UINT16_C(16528), UINT16_C(16576),
+        UINT16_C(16512), UINT16_C(16528), UINT16_C(16608), UINT16_C(16320), UINT16_C(49248), UINT16_C(    0), UINT16_C(49392), UINT16_C(49248) },
+      { UINT16_C(16512), UINT16_C(16448), UINT16_C(49392), UINT16_C(16384), UINT16_C(49024), UINT16_C(49408), UINT16_C(16608), UINT16_C(49360),
+        UINT16_C(16320), UINT16_C(16560), UINT16_C(16560), UINT16_C(49152), UINT16_C(49344), UINT16_C(49312), UINT16_C(49392), UINT16_C(49360),
+        UINT16_C(49376), UINT16_C(16592), UINT16_C(16480), UINT16_C(16640), UINT16_C(16624), UINT16_C(16128), UINT16_C(16528), UINT16_C(49376),
+        UINT16_C(49328), UINT16_C(49408), UINT16_C(49248), UINT16_C(48896), UINT16_C(16624), UINT16_C(16256), UINT16_C(16448), UINT16_C(16320) },
+      { UINT16_C(16448), UINT16_C(49312), UINT16_C(49248), UINT16_C(16128), UINT16_C(16256), UINT16_C(49280), UINT16_C(16384), UINT16_C(16512),
+        UINT16_C(16128), UINT16_C(49392), UINT16_C(49152), UINT16_C(49184), UINT16_C(49248), UINT16_C(16416), UINT16_C(49088), UINT16_C(49152),
+        UINT16_C(16128), UINT16_C(16528), UINT16_C(49088), UINT16_C(16640), UINT16_C(49408), UINT16_C(49408), UINT16_C(16624), UINT16_C(49296),
+        UINT16_C(16416), UINT16_C(49216), UINT16_C(16416), UINT16_C(49344), UINT16_C(49248), UINT16_C(16512), UINT16_C(49088), UINT16_C(49344) },
+      { UINT16_C(49280), UINT16_C(49088), UINT16_C(    0), UINT16_C(16608), UINT16_C(    0), UINT16_C(49392), UINT16_C(16448), UINT16_C(49248),
+        UINT16_C(16608), UINT16_C(16624), UINT16_C(49312), UINT16_C(49280), UINT16_C(49328), UINT16_C(16512), UINT16_C(16320), UINT16_C(16128),
+        UINT16_C(16448), UINT16_C(49088), UINT16_C(16640), UINT16_C(16320), UINT16_C(16544), UINT16_C(49376), UINT16_C(49248), UINT16_C(16608),
+        UINT16_C(49376), UINT16_C(16256), UINT16_C(48896), UINT16_C(49024), UINT16_C(16416), UINT16_C(16256), UINT16_C(16480), UINT16_C(16576) },
+      { UINT16_C(16256), UINT16_C(16560), UINT16_C(16528), UINT16_C(49392), UINT16_C(16640), UINT16_C(16512), UINT16_C(16256), UINT16_C(16560),
+        UINT16_C(49344), UINT16_C(16624), UINT16_C(49328), UINT16_C(48896), UINT16_C(16592), UINT16_C(16416), UINT16_C(16640), UINT16_C(16640),
+        UINT16_C(49216), UINT16_C(49280), UINT16_C(49360), UINT16_C(16560), UINT16_C(49280), UINT16_C(16608), UINT16_C(16528), UINT16_C(16480),
+        UINT16_C(49296), UINT16_C(16416), UINT16_C(49280), UINT16_C(16320), UINT16_C(16576), UINT16_C(49312), UINT16_C(16560), UINT16_C(49360) },
+      { UINT16_C(49312), UINT16_C(    0), UINT16_C(49312), UINT16_C(49344), UINT16_C(49088), UINT16_C(16576), UINT16_C(49360), UINT16_C(    0),
+        UINT16_C(16448), UINT16_C(49280), UINT16_C(49312), UINT16_C(16512), UINT16_C(16480), UINT16_C(49088), UINT16_C(    0), UINT16_C(49216),
+        UINT16_C(16416), UINT16_C(    0), UINT16_C(49328), UINT16_C(49280), UINT16_C(16608), UINT16_C(49216), UINT16_C(49328), UINT16_C(16640),
+        UINT16_C(16256), UINT16_C(    0), UINT16_C(49184), UINT16_C(49376), UINT16_C(16480), UINT16_C(49152), UINT16_C(16416), UINT16_C(48896) },
+      { UINT16_C(16608), UINT16_C(49184), UINT16_C(16448), UINT16_C(16416), UINT16_C(16128), UINT16_C(16640), UINT16_C(49024), UINT16_C(49248),
+        UINT16_C(49184), UINT16_C(49216), UINT16_C(16608), UINT16_C(16416), UINT16_C(16384), UINT16_C(16560), UINT16_C(49216), UINT16_C(16480),
+        UINT16_C(49152), UINT16_C(49248), UINT16_C(16320), UINT16_C(16320), UINT16_C(49216), UINT16_C(49376), UINT16_C(16384), UINT16_C(49088),
+        UINT16_C(49152), UINT16_C(49088), UINT16_C(16512), UINT16_C(    0), UINT16_C(49024), UINT16_C(16560), UINT16_C(49088), UINT16_C(16448) },
+      { UINT16_C(16416), UINT16_C(16544), UINT16_C(49408), UINT16_C(49216), UINT16_C(    0), UINT16_C(16512), UINT16_C(16384), UINT16_C(49376),
+        UINT16_C(49152), UINT16_C(16544), UINT16_C(49376), UINT16_C(48896), UINT16_C(16448), UINT16_C(16256), UINT16_C(49024), UINT16_C(49280),
+        UINT16_C(    0), UINT16_C(49360), UINT16_C(48896), UINT16_C(49360), UINT16_C(16512), UINT16_C(49376), UINT16_C(49184), UINT16_C(16512),
+        UINT16_C(16624), UINT16_C(16528), UINT16_C(16320), UINT16_C(16480), UINT16_C(16128), UINT16_C(16448), UINT16_C(16544), UINT16_C(16512) } },
+      { { SIMDE_FLOAT32_C(  10.00), SIMDE_FLOAT32_C( -56.00), SIMDE_FLOAT32_C( -71.00), SIMDE_FLOAT32_C( -63.00),
+        SIMDE_FLOAT32_C(  22.00), SIMDE_FLOAT32_C( -27.00), SIMDE_FLOAT32_C( -24.00), SIMDE_FLOAT32_C( -31.00),
+        SIMDE_FLOAT32_C( -89.00), SIMDE_FLOAT32_C( -29.00), SIMDE_FLOAT32_C(  78.00), SIMDE_FLOAT32_C(  80.00),
+        SIMDE_FLOAT32_C( -88.00), SIMDE_FLOAT32_C(  78.00), SIMDE_FLOAT32_C( -13.00), SIMDE_FLOAT32_C(  11.00) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  84.00), SIMDE_FLOAT32_C( -81.00), SIMDE_FLOAT32_C(  34.00),
+        SIMDE_FLOAT32_C( -40.00), SIMDE_FLOAT32_C(  99.00), SIMDE_FLOAT32_C(  35.00), SIMDE_FLOAT32_C( -39.00),
+        SIMDE_FLOAT32_C( -11.00), SIMDE_FLOAT32_C(  13.00), SIMDE_FLOAT32_C(  79.00), SIMDE_FLOAT32_C(   2.00),
+        SIMDE_FLOAT32_C(  45.00), SIMDE_FLOAT32_C( -48.00), SIMDE_FLOAT32_C( -56.00), SIMDE_FLOAT32_C(  -7.00) },
+      { SIMDE_FLOAT32_C(  26.00), SIMDE_FLOAT32_C( -24.00), SIMDE_FLOAT32_C( -30.00), SIMDE_FLOAT32_C( -37.00),
+        SIMDE_FLOAT32_C(  32.00), SIMDE_FLOAT32_C(  21.00), SIMDE_FLOAT32_C(  70.00), SIMDE_FLOAT32_C(  59.00),
+        SIMDE_FLOAT32_C(   6.00), SIMDE_FLOAT32_C( -49.00), SIMDE_FLOAT32_C( -30.00), SIMDE_FLOAT32_C(   9.00),
+        SIMDE_FLOAT32_C( -37.00), SIMDE_FLOAT32_C( -42.00), SIMDE_FLOAT32_C( -22.00), SIMDE_FLOAT32_C(  43.00) },
+      { SIMDE_FLOAT32_C(  91.00), SIMDE_FLOAT32_C( -99.00), SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C( -98.00),
+        SIMDE_FLOAT32_C(  88.00), SIMDE_FLOAT32_C( -28.00), SIMDE_FLOAT32_C(  66.00), SIMDE_FLOAT32_C( -26.00),
+        SIMDE_FLOAT32_C(  98.00), SIMDE_FLOAT32_C( -35.00), SIMDE_FLOAT32_C( -24.00), SIMDE_FLOAT32_C(  11.00),
+        SIMDE_FLOAT32_C( -69.00), SIMDE_FLOAT32_C(  77.00), SIMDE_FLOAT32_C(  16.00), SIMDE_FLOAT32_C( -88.00) },
+      { SIMDE_FLOAT32_C(  99.00), SIMDE_FLOAT32_C(  91.00), SIMDE_FLOAT32_C(  -6.00), SIMDE_FLOAT32_C( -46.00),
+        SIMDE_FLOAT32_C(  96.00), SIMDE_FLOAT32_C(  15.00), SIMDE_FLOAT32_C(  58.00), SIMDE_FLOAT32_C(   4.00),
+        SIMDE_FLOAT32_C( -72.00), SIMDE_FLOAT32_C( -88.00), SIMDE_FLOAT32_C(  31.00), SIMDE_FLOAT32_C(   1.00),
+        SIMDE_FLOAT32_C(  26.00), SIMDE_FLOAT32_C( -12.00), SIMDE_FLOAT32_C( -28.00), SIMDE_FLOAT32_C( -79.00) },
+      { SIMDE_FLOAT32_C(  89.00), SIMDE_FLOAT32_C(  35.00), SIMDE_FLOAT32_C( -55.00), SIMDE_FLOAT32_C( -95.00),
+        SIMDE_FLOAT32_C( -79.00), SIMDE_FLOAT32_C(  69.00), SIMDE_FLOAT32_C(  43.00), SIMDE_FLOAT32_C(  -1.00),
+        SIMDE_FLOAT32_C( -54.00), SIMDE_FLOAT32_C( -20.00), SIMDE_FLOAT32_C( -59.00), SIMDE_FLOAT32_C( -22.00),
+        SIMDE_FLOAT32_C(  46.00), SIMDE_FLOAT32_C( -30.00), SIMDE_FLOAT32_C( -71.00), SIMDE_FLOAT32_C(  94.00) } },
+      { { SIMDE_FLOAT32_C( -38.50), SIMDE_FLOAT32_C(-190.25), SIMDE_FLOAT32_C( -77.75), SIMDE_FLOAT32_C( -39.00),
+        SIMDE_FLOAT32_C(  21.25), SIMDE_FLOAT32_C( -39.25), SIMDE_FLOAT32_C(  84.75), SIMDE_FLOAT32_C( -23.75),
+        SIMDE_FLOAT32_C(-114.00), SIMDE_FLOAT32_C( 103.00), SIMDE_FLOAT32_C( 420.00), SIMDE_FLOAT32_C( -31.00),
+        SIMDE_FLOAT32_C( -57.50), SIMDE_FLOAT32_C( 211.25), SIMDE_FLOAT32_C(  69.75), SIMDE_FLOAT32_C(  77.50) },
+      { SIMDE_FLOAT32_C( -95.25), SIMDE_FLOAT32_C(  10.75), SIMDE_FLOAT32_C(   5.00), SIMDE_FLOAT32_C( -77.50),
+        SIMDE_FLOAT32_C(-113.75), SIMDE_FLOAT32_C( -73.75), SIMDE_FLOAT32_C(  96.00), SIMDE_FLOAT32_C(  24.00),
+        SIMDE_FLOAT32_C( -68.75), SIMDE_FLOAT32_C( -36.25), SIMDE_FLOAT32_C( 148.75), SIMDE_FLOAT32_C(  12.00),
+        SIMDE_FLOAT32_C( -37.00), SIMDE_FLOAT32_C(-167.75), SIMDE_FLOAT32_C( -51.50), SIMDE_FLOAT32_C( 246.75) },
+      { SIMDE_FLOAT32_C(  14.75), SIMDE_FLOAT32_C(  -8.75), SIMDE_FLOAT32_C(  78.50), SIMDE_FLOAT32_C(-122.00),
+        SIMDE_FLOAT32_C(  -4.25), SIMDE_FLOAT32_C(-172.50), SIMDE_FLOAT32_C( 119.25), SIMDE_FLOAT32_C( 105.00),
+        SIMDE_FLOAT32_C(  30.00), SIMDE_FLOAT32_C(  75.50), SIMDE_FLOAT32_C( 165.50), SIMDE_FLOAT32_C(   5.25),
+        SIMDE_FLOAT32_C(-106.00), SIMDE_FLOAT32_C(-140.50), SIMDE_FLOAT32_C( 134.50), SIMDE_FLOAT32_C(  82.00) },
+      { SIMDE_FLOAT32_C(  51.50), SIMDE_FLOAT32_C(-222.75), SIMDE_FLOAT32_C( 239.25), SIMDE_FLOAT32_C( -64.75),
+        SIMDE_FLOAT32_C(  31.25), SIMDE_FLOAT32_C(  33.50), SIMDE_FLOAT32_C(  99.25), SIMDE_FLOAT32_C( -24.50),
+        SIMDE_FLOAT32_C(-114.25), SIMDE_FLOAT32_C(-196.25), SIMDE_FLOAT32_C(-206.25), SIMDE_FLOAT32_C( 242.50),
+        SIMDE_FLOAT32_C(  55.50), SIMDE_FLOAT32_C( 183.25), SIMDE_FLOAT32_C(-219.25), SIMDE_FLOAT32_C(  49.00) },
+      { SIMDE_FLOAT32_C( 337.25), SIMDE_FLOAT32_C( 281.75), SIMDE_FLOAT32_C(   3.50), SIMDE_FLOAT32_C( -65.00),
+        SIMDE_FLOAT32_C(  94.25), SIMDE_FLOAT32_C(   6.00), SIMDE_FLOAT32_C( 106.00), SIMDE_FLOAT32_C( 221.00),
+        SIMDE_FLOAT32_C(  61.75), SIMDE_FLOAT32_C( -64.75), SIMDE_FLOAT32_C(  62.25), SIMDE_FLOAT32_C(  69.00),
+        SIMDE_FLOAT32_C(  10.75), SIMDE_FLOAT32_C(  30.25), SIMDE_FLOAT32_C(  99.75), SIMDE_FLOAT32_C(-140.00) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32 r[6][16];
+
+    simde_test_amx_config(test_vec[i].m, test_vec[i].k, test_vec[i].n);
+    simde_tile_loadd(0, test_vec[i].c, sizeof(test_vec[i].c[0]));
+    simde_tile_loadd(1, test_vec[i].a, sizeof(test_vec[i].a[0]));
+    simde_tile_loadd(2, test_vec[i].b, sizeof(test_vec[i].b[0]));
+    simde_tile_dpbf16ps(0, 1, 2);
+    simde_memset(r, 0, sizeof(r));
+    simde_tile_stored(0, r, sizeof(r[0]));
+    simde_tile_release();
+
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) {
+      simde_assert_equal_vf32(sizeof(r[j]) / sizeof(r[j][0]), r[j], test_vec[i].r[j], 1);
+    }
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(tile_storeconfig)
+  SIMDE_TEST_FUNC_LIST_ENTRY(tile_loadd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(tile_dpbssd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(tile_dpbsud)
+  SIMDE_TEST_FUNC_LIST_ENTRY(tile_dpbusd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(tile_dpbuud)
+  SIMDE_TEST_FUNC_LIST_ENTRY(tile_dpbf16ps)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/test-x86-footer.h>
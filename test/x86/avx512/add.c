@@ -3316,6 +3316,915 @@ test_simde_mm512_maskz_add_pd (SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm_add_ph (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float16 a[8];
+    const simde_float16 b[8];
+    const simde_float16 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(   -32.34), SIMDE_FLOAT16_VALUE(     75.3), SIMDE_FLOAT16_VALUE(    -81.1), SIMDE_FLOAT16_VALUE(    -63.8),
+        SIMDE_FLOAT16_VALUE(    56.28), SIMDE_FLOAT16_VALUE(    25.23), SIMDE_FLOAT16_VALUE(  -0.8525), SIMDE_FLOAT16_VALUE(    22.77) },
+      { SIMDE_FLOAT16_VALUE(    -55.7), SIMDE_FLOAT16_VALUE(    -61.8), SIMDE_FLOAT16_VALUE(    44.94), SIMDE_FLOAT16_VALUE(    -22.9),
+        SIMDE_FLOAT16_VALUE(   -46.53), SIMDE_FLOAT16_VALUE(    65.75), SIMDE_FLOAT16_VALUE(     87.3), SIMDE_FLOAT16_VALUE(   -2.756) },
+      { SIMDE_FLOAT16_VALUE(    -88.0), SIMDE_FLOAT16_VALUE(     13.5), SIMDE_FLOAT16_VALUE(    -36.2), SIMDE_FLOAT16_VALUE(   -86.75),
+        SIMDE_FLOAT16_VALUE(     9.75), SIMDE_FLOAT16_VALUE(     91.0), SIMDE_FLOAT16_VALUE(    86.44), SIMDE_FLOAT16_VALUE(    20.02) } },
+    { { SIMDE_FLOAT16_VALUE(   -42.62), SIMDE_FLOAT16_VALUE(    -24.9), SIMDE_FLOAT16_VALUE(    -83.4), SIMDE_FLOAT16_VALUE(    -88.8),
+        SIMDE_FLOAT16_VALUE(    -73.6), SIMDE_FLOAT16_VALUE(    -26.7), SIMDE_FLOAT16_VALUE(    -39.8), SIMDE_FLOAT16_VALUE(   -51.94) },
+      { SIMDE_FLOAT16_VALUE(   -40.94), SIMDE_FLOAT16_VALUE(    97.94), SIMDE_FLOAT16_VALUE(    55.88), SIMDE_FLOAT16_VALUE(     75.9),
+        SIMDE_FLOAT16_VALUE(     35.2), SIMDE_FLOAT16_VALUE(     -9.4), SIMDE_FLOAT16_VALUE(   -99.75), SIMDE_FLOAT16_VALUE(   -5.484) },
+      { SIMDE_FLOAT16_VALUE(   -83.56), SIMDE_FLOAT16_VALUE(     73.0), SIMDE_FLOAT16_VALUE(    -27.5), SIMDE_FLOAT16_VALUE(   -12.94),
+        SIMDE_FLOAT16_VALUE(   -38.44), SIMDE_FLOAT16_VALUE(    -36.1), SIMDE_FLOAT16_VALUE(   -139.5), SIMDE_FLOAT16_VALUE(   -57.44) } },
+    { { SIMDE_FLOAT16_VALUE(   -25.81), SIMDE_FLOAT16_VALUE(    -9.47), SIMDE_FLOAT16_VALUE(    -97.9), SIMDE_FLOAT16_VALUE(    63.03),
+        SIMDE_FLOAT16_VALUE(    -70.3), SIMDE_FLOAT16_VALUE(  -14.766), SIMDE_FLOAT16_VALUE(     96.6), SIMDE_FLOAT16_VALUE(    -9.52) },
+      { SIMDE_FLOAT16_VALUE(   -32.03), SIMDE_FLOAT16_VALUE(    57.34), SIMDE_FLOAT16_VALUE(    5.473), SIMDE_FLOAT16_VALUE(   -28.03),
+        SIMDE_FLOAT16_VALUE(     21.4), SIMDE_FLOAT16_VALUE(     83.9), SIMDE_FLOAT16_VALUE(    -35.0), SIMDE_FLOAT16_VALUE(    -81.5) },
+      { SIMDE_FLOAT16_VALUE(   -57.84), SIMDE_FLOAT16_VALUE(    47.88), SIMDE_FLOAT16_VALUE(    -92.4), SIMDE_FLOAT16_VALUE(     35.0),
+        SIMDE_FLOAT16_VALUE(    -48.9), SIMDE_FLOAT16_VALUE(     69.1), SIMDE_FLOAT16_VALUE(    61.62), SIMDE_FLOAT16_VALUE(    -91.0) } },
+    { { SIMDE_FLOAT16_VALUE(   0.6953), SIMDE_FLOAT16_VALUE(   -69.44), SIMDE_FLOAT16_VALUE(    -56.0), SIMDE_FLOAT16_VALUE(    -94.3),
+        SIMDE_FLOAT16_VALUE(    -99.2), SIMDE_FLOAT16_VALUE(    -58.7), SIMDE_FLOAT16_VALUE(   -13.05), SIMDE_FLOAT16_VALUE(   -86.06) },
+      { SIMDE_FLOAT16_VALUE(   -48.75), SIMDE_FLOAT16_VALUE(   -28.02), SIMDE_FLOAT16_VALUE(   -83.94), SIMDE_FLOAT16_VALUE(     97.2),
+        SIMDE_FLOAT16_VALUE(    -91.4), SIMDE_FLOAT16_VALUE(  -0.9077), SIMDE_FLOAT16_VALUE(     77.5), SIMDE_FLOAT16_VALUE(    -4.95) },
+      { SIMDE_FLOAT16_VALUE(   -48.06), SIMDE_FLOAT16_VALUE(   -97.44), SIMDE_FLOAT16_VALUE(   -140.0), SIMDE_FLOAT16_VALUE(    2.875),
+        SIMDE_FLOAT16_VALUE(   -190.5), SIMDE_FLOAT16_VALUE(    -59.6), SIMDE_FLOAT16_VALUE(    64.44), SIMDE_FLOAT16_VALUE(    -91.0) } },
+    { { SIMDE_FLOAT16_VALUE(    85.75), SIMDE_FLOAT16_VALUE(    41.53), SIMDE_FLOAT16_VALUE(   -56.16), SIMDE_FLOAT16_VALUE(    16.55),
+        SIMDE_FLOAT16_VALUE(    59.28), SIMDE_FLOAT16_VALUE(   14.055), SIMDE_FLOAT16_VALUE(    23.83), SIMDE_FLOAT16_VALUE(    -72.6) },
+      { SIMDE_FLOAT16_VALUE(    -7.19), SIMDE_FLOAT16_VALUE(     40.9), SIMDE_FLOAT16_VALUE(    41.22), SIMDE_FLOAT16_VALUE(     35.4),
+        SIMDE_FLOAT16_VALUE(   -13.53), SIMDE_FLOAT16_VALUE(   -18.88), SIMDE_FLOAT16_VALUE(   -39.97), SIMDE_FLOAT16_VALUE(   -86.56) },
+      { SIMDE_FLOAT16_VALUE(    78.56), SIMDE_FLOAT16_VALUE(    82.44), SIMDE_FLOAT16_VALUE(   -14.94), SIMDE_FLOAT16_VALUE(    51.94),
+        SIMDE_FLOAT16_VALUE(    45.75), SIMDE_FLOAT16_VALUE(    -4.82), SIMDE_FLOAT16_VALUE(   -16.14), SIMDE_FLOAT16_VALUE(   -159.2) } },
+    { { SIMDE_FLOAT16_VALUE(    17.69), SIMDE_FLOAT16_VALUE(    -86.4), SIMDE_FLOAT16_VALUE(    93.44), SIMDE_FLOAT16_VALUE(     62.3),
+        SIMDE_FLOAT16_VALUE(   -23.48), SIMDE_FLOAT16_VALUE(     95.5), SIMDE_FLOAT16_VALUE(   -1.351), SIMDE_FLOAT16_VALUE(    49.28) },
+      { SIMDE_FLOAT16_VALUE(    -35.6), SIMDE_FLOAT16_VALUE(    12.98), SIMDE_FLOAT16_VALUE(     93.5), SIMDE_FLOAT16_VALUE(    89.75),
+        SIMDE_FLOAT16_VALUE(    51.38), SIMDE_FLOAT16_VALUE(    64.56), SIMDE_FLOAT16_VALUE(   -54.53), SIMDE_FLOAT16_VALUE(     60.6) },
+      { SIMDE_FLOAT16_VALUE(    -17.9), SIMDE_FLOAT16_VALUE(    -73.4), SIMDE_FLOAT16_VALUE(    187.0), SIMDE_FLOAT16_VALUE(    152.0),
+        SIMDE_FLOAT16_VALUE(    27.89), SIMDE_FLOAT16_VALUE(    160.0), SIMDE_FLOAT16_VALUE(   -55.88), SIMDE_FLOAT16_VALUE(    109.9) } },
+    { { SIMDE_FLOAT16_VALUE(    1.657), SIMDE_FLOAT16_VALUE(     33.2), SIMDE_FLOAT16_VALUE(     93.7), SIMDE_FLOAT16_VALUE(    25.06),
+        SIMDE_FLOAT16_VALUE(    10.11), SIMDE_FLOAT16_VALUE(     82.9), SIMDE_FLOAT16_VALUE(   -52.34), SIMDE_FLOAT16_VALUE(   -63.84) },
+      { SIMDE_FLOAT16_VALUE(   0.9253), SIMDE_FLOAT16_VALUE(    -61.2), SIMDE_FLOAT16_VALUE(   -70.25), SIMDE_FLOAT16_VALUE(   -47.28),
+        SIMDE_FLOAT16_VALUE(     8.69), SIMDE_FLOAT16_VALUE(   -41.03), SIMDE_FLOAT16_VALUE(  -12.914), SIMDE_FLOAT16_VALUE(   -60.62) },
+      { SIMDE_FLOAT16_VALUE(    2.582), SIMDE_FLOAT16_VALUE(    -28.0), SIMDE_FLOAT16_VALUE(    23.44), SIMDE_FLOAT16_VALUE(   -22.22),
+        SIMDE_FLOAT16_VALUE(     18.8), SIMDE_FLOAT16_VALUE(    41.84), SIMDE_FLOAT16_VALUE(   -65.25), SIMDE_FLOAT16_VALUE(   -124.5) } },
+    { { SIMDE_FLOAT16_VALUE(    28.42), SIMDE_FLOAT16_VALUE(   -59.88), SIMDE_FLOAT16_VALUE(     60.0), SIMDE_FLOAT16_VALUE(    22.83),
+        SIMDE_FLOAT16_VALUE(    19.78), SIMDE_FLOAT16_VALUE(    22.38), SIMDE_FLOAT16_VALUE(   -45.03), SIMDE_FLOAT16_VALUE(     8.13) },
+      { SIMDE_FLOAT16_VALUE(    64.44), SIMDE_FLOAT16_VALUE(   -31.19), SIMDE_FLOAT16_VALUE(    39.88), SIMDE_FLOAT16_VALUE(    18.22),
+        SIMDE_FLOAT16_VALUE(    30.86), SIMDE_FLOAT16_VALUE(    -77.0), SIMDE_FLOAT16_VALUE(    -69.2), SIMDE_FLOAT16_VALUE(    71.44) },
+      { SIMDE_FLOAT16_VALUE(     92.9), SIMDE_FLOAT16_VALUE(   -91.06), SIMDE_FLOAT16_VALUE(     99.9), SIMDE_FLOAT16_VALUE(    41.06),
+        SIMDE_FLOAT16_VALUE(    50.62), SIMDE_FLOAT16_VALUE(   -54.62), SIMDE_FLOAT16_VALUE(  -114.25), SIMDE_FLOAT16_VALUE(    79.56) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128h a = simde_mm_loadu_ph(test_vec[i].a);
+    simde__m128h b = simde_mm_loadu_ph(test_vec[i].b);
+    simde__m128h r = simde_mm_add_ph(a, b);
+    simde_test_x86_assert_equal_f16x8(r, simde_mm_loadu_ph(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm256_add_ph (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float16 a[16];
+    const simde_float16 b[16];
+    const simde_float16 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(     98.5), SIMDE_FLOAT16_VALUE(    -96.6), SIMDE_FLOAT16_VALUE(    -70.5), SIMDE_FLOAT16_VALUE(    31.42),
+        SIMDE_FLOAT16_VALUE(    -81.0), SIMDE_FLOAT16_VALUE(   -10.68), SIMDE_FLOAT16_VALUE(    58.44), SIMDE_FLOAT16_VALUE(    98.75),
+        SIMDE_FLOAT16_VALUE(    52.75), SIMDE_FLOAT16_VALUE(    -64.5), SIMDE_FLOAT16_VALUE(    84.25), SIMDE_FLOAT16_VALUE(    26.36),
+        SIMDE_FLOAT16_VALUE(     8.64), SIMDE_FLOAT16_VALUE(    -43.3), SIMDE_FLOAT16_VALUE(   -38.12), SIMDE_FLOAT16_VALUE(   0.4126) },
+      { SIMDE_FLOAT16_VALUE(    22.62), SIMDE_FLOAT16_VALUE(    -68.1), SIMDE_FLOAT16_VALUE(   -19.44), SIMDE_FLOAT16_VALUE(   -38.44),
+        SIMDE_FLOAT16_VALUE(     68.1), SIMDE_FLOAT16_VALUE(    77.75), SIMDE_FLOAT16_VALUE(     22.8), SIMDE_FLOAT16_VALUE(    24.61),
+        SIMDE_FLOAT16_VALUE(   -14.05), SIMDE_FLOAT16_VALUE(     25.4), SIMDE_FLOAT16_VALUE(   -45.88), SIMDE_FLOAT16_VALUE(     60.4),
+        SIMDE_FLOAT16_VALUE(   -19.86), SIMDE_FLOAT16_VALUE(     32.3), SIMDE_FLOAT16_VALUE(    52.06), SIMDE_FLOAT16_VALUE(     87.4) },
+      { SIMDE_FLOAT16_VALUE(    121.1), SIMDE_FLOAT16_VALUE(   -164.8), SIMDE_FLOAT16_VALUE(   -89.94), SIMDE_FLOAT16_VALUE(   -7.016),
+        SIMDE_FLOAT16_VALUE(  -12.875), SIMDE_FLOAT16_VALUE(    67.06), SIMDE_FLOAT16_VALUE(    81.25), SIMDE_FLOAT16_VALUE(    123.4),
+        SIMDE_FLOAT16_VALUE(     38.7), SIMDE_FLOAT16_VALUE(    -39.1), SIMDE_FLOAT16_VALUE(    38.38), SIMDE_FLOAT16_VALUE(    86.75),
+        SIMDE_FLOAT16_VALUE(   -11.22), SIMDE_FLOAT16_VALUE(    -11.0), SIMDE_FLOAT16_VALUE(    13.94), SIMDE_FLOAT16_VALUE(     87.8) } },
+    { { SIMDE_FLOAT16_VALUE(    31.53), SIMDE_FLOAT16_VALUE(    38.22), SIMDE_FLOAT16_VALUE(    26.97), SIMDE_FLOAT16_VALUE(    -13.1),
+        SIMDE_FLOAT16_VALUE(    39.06), SIMDE_FLOAT16_VALUE(    -16.9), SIMDE_FLOAT16_VALUE(     55.5), SIMDE_FLOAT16_VALUE(   -21.19),
+        SIMDE_FLOAT16_VALUE(    43.03), SIMDE_FLOAT16_VALUE(     27.1), SIMDE_FLOAT16_VALUE(     8.58), SIMDE_FLOAT16_VALUE(    79.44),
+        SIMDE_FLOAT16_VALUE(   -6.938), SIMDE_FLOAT16_VALUE(    -79.7), SIMDE_FLOAT16_VALUE(    -60.0), SIMDE_FLOAT16_VALUE(    21.47) },
+      { SIMDE_FLOAT16_VALUE(    -88.7), SIMDE_FLOAT16_VALUE(     21.2), SIMDE_FLOAT16_VALUE(     -9.5), SIMDE_FLOAT16_VALUE(   -1.252),
+        SIMDE_FLOAT16_VALUE(   -33.28), SIMDE_FLOAT16_VALUE(     86.1), SIMDE_FLOAT16_VALUE(    60.62), SIMDE_FLOAT16_VALUE(     94.9),
+        SIMDE_FLOAT16_VALUE(    5.613), SIMDE_FLOAT16_VALUE(    3.092), SIMDE_FLOAT16_VALUE(   -60.28), SIMDE_FLOAT16_VALUE(    26.39),
+        SIMDE_FLOAT16_VALUE(   -88.44), SIMDE_FLOAT16_VALUE(    -34.2), SIMDE_FLOAT16_VALUE(   -35.66), SIMDE_FLOAT16_VALUE(    31.48) },
+      { SIMDE_FLOAT16_VALUE(   -57.16), SIMDE_FLOAT16_VALUE(    59.44), SIMDE_FLOAT16_VALUE(    17.47), SIMDE_FLOAT16_VALUE(   -14.35),
+        SIMDE_FLOAT16_VALUE(     5.78), SIMDE_FLOAT16_VALUE(    69.25), SIMDE_FLOAT16_VALUE(    116.1), SIMDE_FLOAT16_VALUE(     73.7),
+        SIMDE_FLOAT16_VALUE(    48.66), SIMDE_FLOAT16_VALUE(    30.19), SIMDE_FLOAT16_VALUE(    -51.7), SIMDE_FLOAT16_VALUE(    105.8),
+        SIMDE_FLOAT16_VALUE(    -95.4), SIMDE_FLOAT16_VALUE(   -113.9), SIMDE_FLOAT16_VALUE(    -95.6), SIMDE_FLOAT16_VALUE(    52.94) } },
+    { { SIMDE_FLOAT16_VALUE(     65.7), SIMDE_FLOAT16_VALUE(    -83.2), SIMDE_FLOAT16_VALUE(    4.754), SIMDE_FLOAT16_VALUE(    62.16),
+        SIMDE_FLOAT16_VALUE(    -62.8), SIMDE_FLOAT16_VALUE(   -49.47), SIMDE_FLOAT16_VALUE(     69.6), SIMDE_FLOAT16_VALUE(    87.44),
+        SIMDE_FLOAT16_VALUE(   -30.88), SIMDE_FLOAT16_VALUE(     83.3), SIMDE_FLOAT16_VALUE(    25.36), SIMDE_FLOAT16_VALUE(    40.38),
+        SIMDE_FLOAT16_VALUE(    -60.5), SIMDE_FLOAT16_VALUE(    -67.1), SIMDE_FLOAT16_VALUE(    71.06), SIMDE_FLOAT16_VALUE(    -79.5) },
+      { SIMDE_FLOAT16_VALUE(     93.8), SIMDE_FLOAT16_VALUE(     9.85), SIMDE_FLOAT16_VALUE(     54.1), SIMDE_FLOAT16_VALUE(    -73.7),
+        SIMDE_FLOAT16_VALUE(    61.25), SIMDE_FLOAT16_VALUE(    77.06), SIMDE_FLOAT16_VALUE(    55.28), SIMDE_FLOAT16_VALUE(    36.06),
+        SIMDE_FLOAT16_VALUE(   -25.39), SIMDE_FLOAT16_VALUE(     6.06), SIMDE_FLOAT16_VALUE(   -35.97), SIMDE_FLOAT16_VALUE(    21.81),
+        SIMDE_FLOAT16_VALUE(    -74.7), SIMDE_FLOAT16_VALUE(   -70.25), SIMDE_FLOAT16_VALUE(     81.1), SIMDE_FLOAT16_VALUE(     32.3) },
+      { SIMDE_FLOAT16_VALUE(    159.5), SIMDE_FLOAT16_VALUE(    -73.3), SIMDE_FLOAT16_VALUE(    58.84), SIMDE_FLOAT16_VALUE(   -11.53),
+        SIMDE_FLOAT16_VALUE(  -1.5625), SIMDE_FLOAT16_VALUE(     27.6), SIMDE_FLOAT16_VALUE(    124.9), SIMDE_FLOAT16_VALUE(    123.5),
+        SIMDE_FLOAT16_VALUE(   -56.25), SIMDE_FLOAT16_VALUE(     89.4), SIMDE_FLOAT16_VALUE(   -10.61), SIMDE_FLOAT16_VALUE(     62.2),
+        SIMDE_FLOAT16_VALUE(   -135.2), SIMDE_FLOAT16_VALUE(   -137.4), SIMDE_FLOAT16_VALUE(    152.2), SIMDE_FLOAT16_VALUE(    -47.2) } },
+    { { SIMDE_FLOAT16_VALUE(    32.44), SIMDE_FLOAT16_VALUE(    67.94), SIMDE_FLOAT16_VALUE(    -89.4), SIMDE_FLOAT16_VALUE(     52.0),
+        SIMDE_FLOAT16_VALUE(    83.25), SIMDE_FLOAT16_VALUE(   -24.19), SIMDE_FLOAT16_VALUE(    -14.2), SIMDE_FLOAT16_VALUE(     76.5),
+        SIMDE_FLOAT16_VALUE(    -84.4), SIMDE_FLOAT16_VALUE(    97.75), SIMDE_FLOAT16_VALUE(    -52.1), SIMDE_FLOAT16_VALUE(    -66.9),
+        SIMDE_FLOAT16_VALUE(   -15.04), SIMDE_FLOAT16_VALUE(   -18.69), SIMDE_FLOAT16_VALUE(    -87.0), SIMDE_FLOAT16_VALUE(      2.0) },
+      { SIMDE_FLOAT16_VALUE(    -69.1), SIMDE_FLOAT16_VALUE(    7.562), SIMDE_FLOAT16_VALUE(    2.102), SIMDE_FLOAT16_VALUE(     4.21),
+        SIMDE_FLOAT16_VALUE(    -65.6), SIMDE_FLOAT16_VALUE(   -39.06), SIMDE_FLOAT16_VALUE(    59.56), SIMDE_FLOAT16_VALUE(    -91.9),
+        SIMDE_FLOAT16_VALUE(     76.4), SIMDE_FLOAT16_VALUE(   -69.25), SIMDE_FLOAT16_VALUE(     85.5), SIMDE_FLOAT16_VALUE(    30.22),
+        SIMDE_FLOAT16_VALUE(     73.7), SIMDE_FLOAT16_VALUE(   -34.25), SIMDE_FLOAT16_VALUE(     64.6), SIMDE_FLOAT16_VALUE(   -30.44) },
+      { SIMDE_FLOAT16_VALUE(    -36.7), SIMDE_FLOAT16_VALUE(     75.5), SIMDE_FLOAT16_VALUE(   -87.25), SIMDE_FLOAT16_VALUE(    56.22),
+        SIMDE_FLOAT16_VALUE(    17.62), SIMDE_FLOAT16_VALUE(   -63.25), SIMDE_FLOAT16_VALUE(    45.38), SIMDE_FLOAT16_VALUE(  -15.375),
+        SIMDE_FLOAT16_VALUE(     -8.0), SIMDE_FLOAT16_VALUE(     28.5), SIMDE_FLOAT16_VALUE(     33.4), SIMDE_FLOAT16_VALUE(   -36.66),
+        SIMDE_FLOAT16_VALUE(    58.66), SIMDE_FLOAT16_VALUE(   -52.94), SIMDE_FLOAT16_VALUE(   -22.38), SIMDE_FLOAT16_VALUE(   -28.44) } },
+    { { SIMDE_FLOAT16_VALUE(    47.53), SIMDE_FLOAT16_VALUE(   -67.25), SIMDE_FLOAT16_VALUE(     71.8), SIMDE_FLOAT16_VALUE(   -50.53),
+        SIMDE_FLOAT16_VALUE(     39.3), SIMDE_FLOAT16_VALUE(    -59.1), SIMDE_FLOAT16_VALUE(     54.5), SIMDE_FLOAT16_VALUE(   -32.78),
+        SIMDE_FLOAT16_VALUE(   -30.12), SIMDE_FLOAT16_VALUE(    58.16), SIMDE_FLOAT16_VALUE(   -26.36), SIMDE_FLOAT16_VALUE(    -98.3),
+        SIMDE_FLOAT16_VALUE(    -95.0), SIMDE_FLOAT16_VALUE(     9.73), SIMDE_FLOAT16_VALUE(   -23.95), SIMDE_FLOAT16_VALUE(    34.12) },
+      { SIMDE_FLOAT16_VALUE(     88.0), SIMDE_FLOAT16_VALUE(    49.94), SIMDE_FLOAT16_VALUE(   -27.88), SIMDE_FLOAT16_VALUE(    -70.2),
+        SIMDE_FLOAT16_VALUE(     59.6), SIMDE_FLOAT16_VALUE(   -27.31), SIMDE_FLOAT16_VALUE(    22.19), SIMDE_FLOAT16_VALUE(    -92.3),
+        SIMDE_FLOAT16_VALUE(    -42.9), SIMDE_FLOAT16_VALUE(    -37.4), SIMDE_FLOAT16_VALUE(    37.44), SIMDE_FLOAT16_VALUE(    35.47),
+        SIMDE_FLOAT16_VALUE(    29.44), SIMDE_FLOAT16_VALUE(   -23.33), SIMDE_FLOAT16_VALUE(   -43.78), SIMDE_FLOAT16_VALUE(    45.16) },
+      { SIMDE_FLOAT16_VALUE(    135.5), SIMDE_FLOAT16_VALUE(   -17.31), SIMDE_FLOAT16_VALUE(    43.94), SIMDE_FLOAT16_VALUE(  -120.75),
+        SIMDE_FLOAT16_VALUE(     98.9), SIMDE_FLOAT16_VALUE(    -86.4), SIMDE_FLOAT16_VALUE(     76.7), SIMDE_FLOAT16_VALUE(   -125.1),
+        SIMDE_FLOAT16_VALUE(    -73.0), SIMDE_FLOAT16_VALUE(    20.75), SIMDE_FLOAT16_VALUE(    11.08), SIMDE_FLOAT16_VALUE(   -62.84),
+        SIMDE_FLOAT16_VALUE(   -65.56), SIMDE_FLOAT16_VALUE(    -13.6), SIMDE_FLOAT16_VALUE(   -67.75), SIMDE_FLOAT16_VALUE(    79.25) } },
+    { { SIMDE_FLOAT16_VALUE(   -28.05), SIMDE_FLOAT16_VALUE(    3.969), SIMDE_FLOAT16_VALUE(    -36.5), SIMDE_FLOAT16_VALUE(    -90.3),
+        SIMDE_FLOAT16_VALUE(    51.22), SIMDE_FLOAT16_VALUE(    -66.7), SIMDE_FLOAT16_VALUE(     86.5), SIMDE_FLOAT16_VALUE(     81.6),
+        SIMDE_FLOAT16_VALUE(     76.8), SIMDE_FLOAT16_VALUE(    -52.4), SIMDE_FLOAT16_VALUE(    -94.9), SIMDE_FLOAT16_VALUE(    -70.3),
+        SIMDE_FLOAT16_VALUE(    71.06), SIMDE_FLOAT16_VALUE(    -60.1), SIMDE_FLOAT16_VALUE(    12.97), SIMDE_FLOAT16_VALUE(   -7.652) },
+      { SIMDE_FLOAT16_VALUE(    58.78), SIMDE_FLOAT16_VALUE(    -13.1), SIMDE_FLOAT16_VALUE(   -56.53), SIMDE_FLOAT16_VALUE(     73.1),
+        SIMDE_FLOAT16_VALUE(     8.46), SIMDE_FLOAT16_VALUE(   -36.28), SIMDE_FLOAT16_VALUE(   -35.56), SIMDE_FLOAT16_VALUE(   -50.62),
+        SIMDE_FLOAT16_VALUE(     88.7), SIMDE_FLOAT16_VALUE(   -55.78), SIMDE_FLOAT16_VALUE(    38.66), SIMDE_FLOAT16_VALUE(    -89.1),
+        SIMDE_FLOAT16_VALUE(    15.58), SIMDE_FLOAT16_VALUE(    6.316), SIMDE_FLOAT16_VALUE(   -71.44), SIMDE_FLOAT16_VALUE(   -22.44) },
+      { SIMDE_FLOAT16_VALUE(    30.73), SIMDE_FLOAT16_VALUE(    -9.13), SIMDE_FLOAT16_VALUE(    -93.0), SIMDE_FLOAT16_VALUE(   -17.19),
+        SIMDE_FLOAT16_VALUE(     59.7), SIMDE_FLOAT16_VALUE(   -103.0), SIMDE_FLOAT16_VALUE(    50.94), SIMDE_FLOAT16_VALUE(     31.0),
+        SIMDE_FLOAT16_VALUE(    165.5), SIMDE_FLOAT16_VALUE(   -108.2), SIMDE_FLOAT16_VALUE(   -56.22), SIMDE_FLOAT16_VALUE(   -159.5),
+        SIMDE_FLOAT16_VALUE(     86.6), SIMDE_FLOAT16_VALUE(   -53.78), SIMDE_FLOAT16_VALUE(   -58.47), SIMDE_FLOAT16_VALUE(    -30.1) } },
+    { { SIMDE_FLOAT16_VALUE(    18.36), SIMDE_FLOAT16_VALUE(   -75.94), SIMDE_FLOAT16_VALUE(    60.28), SIMDE_FLOAT16_VALUE(   -23.14),
+        SIMDE_FLOAT16_VALUE(     62.9), SIMDE_FLOAT16_VALUE(    -8.61), SIMDE_FLOAT16_VALUE(   -78.75), SIMDE_FLOAT16_VALUE(   -54.22),
+        SIMDE_FLOAT16_VALUE(    33.03), SIMDE_FLOAT16_VALUE(   -41.94), SIMDE_FLOAT16_VALUE(    23.69), SIMDE_FLOAT16_VALUE(     71.7),
+        SIMDE_FLOAT16_VALUE(    1.271), SIMDE_FLOAT16_VALUE(    23.98), SIMDE_FLOAT16_VALUE(    60.94), SIMDE_FLOAT16_VALUE(    -40.4) },
+      { SIMDE_FLOAT16_VALUE(    -70.9), SIMDE_FLOAT16_VALUE(    34.94), SIMDE_FLOAT16_VALUE(     84.3), SIMDE_FLOAT16_VALUE(  -12.695),
+        SIMDE_FLOAT16_VALUE(     33.5), SIMDE_FLOAT16_VALUE(    47.78), SIMDE_FLOAT16_VALUE(    46.25), SIMDE_FLOAT16_VALUE(   -51.25),
+        SIMDE_FLOAT16_VALUE(   -40.16), SIMDE_FLOAT16_VALUE(    -66.5), SIMDE_FLOAT16_VALUE(    -71.6), SIMDE_FLOAT16_VALUE(    15.47),
+        SIMDE_FLOAT16_VALUE(    -90.6), SIMDE_FLOAT16_VALUE(    53.78), SIMDE_FLOAT16_VALUE(   -75.94), SIMDE_FLOAT16_VALUE(    20.64) },
+      { SIMDE_FLOAT16_VALUE(    -52.5), SIMDE_FLOAT16_VALUE(    -41.0), SIMDE_FLOAT16_VALUE(    144.6), SIMDE_FLOAT16_VALUE(   -35.84),
+        SIMDE_FLOAT16_VALUE(     96.4), SIMDE_FLOAT16_VALUE(     39.2), SIMDE_FLOAT16_VALUE(    -32.5), SIMDE_FLOAT16_VALUE(   -105.5),
+        SIMDE_FLOAT16_VALUE(   -7.125), SIMDE_FLOAT16_VALUE(  -108.44), SIMDE_FLOAT16_VALUE(   -47.94), SIMDE_FLOAT16_VALUE(     87.1),
+        SIMDE_FLOAT16_VALUE(    -89.4), SIMDE_FLOAT16_VALUE(    77.75), SIMDE_FLOAT16_VALUE(    -15.0), SIMDE_FLOAT16_VALUE(   -19.77) } },
+    { { SIMDE_FLOAT16_VALUE(    -50.5), SIMDE_FLOAT16_VALUE(    -69.8), SIMDE_FLOAT16_VALUE(   -93.94), SIMDE_FLOAT16_VALUE(   -65.25),
+        SIMDE_FLOAT16_VALUE(     11.6), SIMDE_FLOAT16_VALUE(   -87.94), SIMDE_FLOAT16_VALUE(    13.94), SIMDE_FLOAT16_VALUE(   -12.18),
+        SIMDE_FLOAT16_VALUE(     5.85), SIMDE_FLOAT16_VALUE(   -82.25), SIMDE_FLOAT16_VALUE(   -47.88), SIMDE_FLOAT16_VALUE(     68.5),
+        SIMDE_FLOAT16_VALUE(     8.71), SIMDE_FLOAT16_VALUE(    -64.6), SIMDE_FLOAT16_VALUE(   -22.14), SIMDE_FLOAT16_VALUE(    46.94) },
+      { SIMDE_FLOAT16_VALUE(    22.77), SIMDE_FLOAT16_VALUE(    -34.4), SIMDE_FLOAT16_VALUE(    -8.93), SIMDE_FLOAT16_VALUE(     96.7),
+        SIMDE_FLOAT16_VALUE(    39.28), SIMDE_FLOAT16_VALUE(    -88.8), SIMDE_FLOAT16_VALUE(    49.78), SIMDE_FLOAT16_VALUE(    -83.3),
+        SIMDE_FLOAT16_VALUE(    97.94), SIMDE_FLOAT16_VALUE(    23.14), SIMDE_FLOAT16_VALUE(    27.73), SIMDE_FLOAT16_VALUE(     2.49),
+        SIMDE_FLOAT16_VALUE(   -2.254), SIMDE_FLOAT16_VALUE(   -92.44), SIMDE_FLOAT16_VALUE(   13.266), SIMDE_FLOAT16_VALUE(   -43.47) },
+      { SIMDE_FLOAT16_VALUE(   -27.73), SIMDE_FLOAT16_VALUE(  -104.25), SIMDE_FLOAT16_VALUE(   -102.9), SIMDE_FLOAT16_VALUE(    31.44),
+        SIMDE_FLOAT16_VALUE(    50.88), SIMDE_FLOAT16_VALUE(   -176.8), SIMDE_FLOAT16_VALUE(    63.72), SIMDE_FLOAT16_VALUE(    -95.5),
+        SIMDE_FLOAT16_VALUE(    103.8), SIMDE_FLOAT16_VALUE(   -59.12), SIMDE_FLOAT16_VALUE(   -20.14), SIMDE_FLOAT16_VALUE(     71.0),
+        SIMDE_FLOAT16_VALUE(    6.457), SIMDE_FLOAT16_VALUE(   -157.0), SIMDE_FLOAT16_VALUE(   -8.875), SIMDE_FLOAT16_VALUE(    3.469) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256h a = simde_mm256_loadu_ph(test_vec[i].a);
+    simde__m256h b = simde_mm256_loadu_ph(test_vec[i].b);
+    simde__m256h r = simde_mm256_add_ph(a, b);
+    simde_test_x86_assert_equal_f16x16(r, simde_mm256_loadu_ph(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm512_add_ph (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float16 a[32];
+    const simde_float16 b[32];
+    const simde_float16 r[32];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(     8.71), SIMDE_FLOAT16_VALUE(    -42.9), SIMDE_FLOAT16_VALUE(   -66.25), SIMDE_FLOAT16_VALUE(    20.69),
+        SIMDE_FLOAT16_VALUE(    -93.9), SIMDE_FLOAT16_VALUE(    34.62), SIMDE_FLOAT16_VALUE(    20.89), SIMDE_FLOAT16_VALUE(    22.98),
+        SIMDE_FLOAT16_VALUE(    26.66), SIMDE_FLOAT16_VALUE(    -86.0), SIMDE_FLOAT16_VALUE(     41.9), SIMDE_FLOAT16_VALUE(   -71.94),
+        SIMDE_FLOAT16_VALUE(     77.7), SIMDE_FLOAT16_VALUE(    -86.4), SIMDE_FLOAT16_VALUE(   -5.773), SIMDE_FLOAT16_VALUE(    20.72),
+        SIMDE_FLOAT16_VALUE(    -75.2), SIMDE_FLOAT16_VALUE(    -95.2), SIMDE_FLOAT16_VALUE(    30.12), SIMDE_FLOAT16_VALUE(    -77.6),
+        SIMDE_FLOAT16_VALUE(     71.7), SIMDE_FLOAT16_VALUE(   -5.426), SIMDE_FLOAT16_VALUE(    -43.8), SIMDE_FLOAT16_VALUE(    19.06),
+        SIMDE_FLOAT16_VALUE(    50.84), SIMDE_FLOAT16_VALUE(   -86.06), SIMDE_FLOAT16_VALUE(     88.1), SIMDE_FLOAT16_VALUE(    -51.8),
+        SIMDE_FLOAT16_VALUE(   -22.84), SIMDE_FLOAT16_VALUE(    -94.3), SIMDE_FLOAT16_VALUE(    -36.9), SIMDE_FLOAT16_VALUE(    6.832) },
+      { SIMDE_FLOAT16_VALUE(   -70.06), SIMDE_FLOAT16_VALUE(    -78.9), SIMDE_FLOAT16_VALUE(    -46.3), SIMDE_FLOAT16_VALUE(    12.67),
+        SIMDE_FLOAT16_VALUE(    36.84), SIMDE_FLOAT16_VALUE(   -3.043), SIMDE_FLOAT16_VALUE(   -49.12), SIMDE_FLOAT16_VALUE(     81.5),
+        SIMDE_FLOAT16_VALUE(    -53.5), SIMDE_FLOAT16_VALUE(    19.33), SIMDE_FLOAT16_VALUE(     48.1), SIMDE_FLOAT16_VALUE(    6.184),
+        SIMDE_FLOAT16_VALUE(    40.94), SIMDE_FLOAT16_VALUE(   -6.906), SIMDE_FLOAT16_VALUE(    27.52), SIMDE_FLOAT16_VALUE(    -91.0),
+        SIMDE_FLOAT16_VALUE(    57.16), SIMDE_FLOAT16_VALUE(   -46.47), SIMDE_FLOAT16_VALUE(     46.5), SIMDE_FLOAT16_VALUE(   -2.705),
+        SIMDE_FLOAT16_VALUE(   -16.61), SIMDE_FLOAT16_VALUE(    2.352), SIMDE_FLOAT16_VALUE(    -58.3), SIMDE_FLOAT16_VALUE(   -6.586),
+        SIMDE_FLOAT16_VALUE(    -69.9), SIMDE_FLOAT16_VALUE(    -1.16), SIMDE_FLOAT16_VALUE(    81.25), SIMDE_FLOAT16_VALUE(    -86.5),
+        SIMDE_FLOAT16_VALUE(     2.37), SIMDE_FLOAT16_VALUE(   -56.56), SIMDE_FLOAT16_VALUE(    34.25), SIMDE_FLOAT16_VALUE(   -35.72) },
+      { SIMDE_FLOAT16_VALUE(   -61.34), SIMDE_FLOAT16_VALUE(  -121.75), SIMDE_FLOAT16_VALUE(  -112.56), SIMDE_FLOAT16_VALUE(    33.38),
+        SIMDE_FLOAT16_VALUE(   -57.03), SIMDE_FLOAT16_VALUE(    31.58), SIMDE_FLOAT16_VALUE(   -28.23), SIMDE_FLOAT16_VALUE(    104.5),
+        SIMDE_FLOAT16_VALUE(   -26.84), SIMDE_FLOAT16_VALUE(    -66.7), SIMDE_FLOAT16_VALUE(     90.0), SIMDE_FLOAT16_VALUE(   -65.75),
+        SIMDE_FLOAT16_VALUE(    118.6), SIMDE_FLOAT16_VALUE(   -93.25), SIMDE_FLOAT16_VALUE(    21.75), SIMDE_FLOAT16_VALUE(   -70.25),
+        SIMDE_FLOAT16_VALUE(   -18.03), SIMDE_FLOAT16_VALUE(   -141.6), SIMDE_FLOAT16_VALUE(     76.6), SIMDE_FLOAT16_VALUE(    -80.3),
+        SIMDE_FLOAT16_VALUE(    55.06), SIMDE_FLOAT16_VALUE(   -3.074), SIMDE_FLOAT16_VALUE(   -102.1), SIMDE_FLOAT16_VALUE(    12.48),
+        SIMDE_FLOAT16_VALUE(   -19.03), SIMDE_FLOAT16_VALUE(   -87.25), SIMDE_FLOAT16_VALUE(    169.4), SIMDE_FLOAT16_VALUE(   -138.2),
+        SIMDE_FLOAT16_VALUE(   -20.47), SIMDE_FLOAT16_VALUE(   -150.9), SIMDE_FLOAT16_VALUE(   -2.656), SIMDE_FLOAT16_VALUE(   -28.89) } },
+    { { SIMDE_FLOAT16_VALUE(   -13.02), SIMDE_FLOAT16_VALUE(    19.55), SIMDE_FLOAT16_VALUE(   -97.06), SIMDE_FLOAT16_VALUE(    73.94),
+        SIMDE_FLOAT16_VALUE(    40.22), SIMDE_FLOAT16_VALUE(    -87.6), SIMDE_FLOAT16_VALUE(    -59.3), SIMDE_FLOAT16_VALUE(    -46.0),
+        SIMDE_FLOAT16_VALUE(    12.24), SIMDE_FLOAT16_VALUE(     88.1), SIMDE_FLOAT16_VALUE(    30.23), SIMDE_FLOAT16_VALUE(   -16.48),
+        SIMDE_FLOAT16_VALUE(   -23.58), SIMDE_FLOAT16_VALUE(   -78.56), SIMDE_FLOAT16_VALUE(   -95.75), SIMDE_FLOAT16_VALUE(   -28.75),
+        SIMDE_FLOAT16_VALUE(    76.94), SIMDE_FLOAT16_VALUE(    -88.5), SIMDE_FLOAT16_VALUE(   -60.25), SIMDE_FLOAT16_VALUE(     87.8),
+        SIMDE_FLOAT16_VALUE(     44.0), SIMDE_FLOAT16_VALUE(    -33.7), SIMDE_FLOAT16_VALUE(   0.3752), SIMDE_FLOAT16_VALUE(   -90.44),
+        SIMDE_FLOAT16_VALUE(    -62.4), SIMDE_FLOAT16_VALUE(    1.998), SIMDE_FLOAT16_VALUE(   -31.89), SIMDE_FLOAT16_VALUE(     60.7),
+        SIMDE_FLOAT16_VALUE(    -95.4), SIMDE_FLOAT16_VALUE(    -42.0), SIMDE_FLOAT16_VALUE(    41.28), SIMDE_FLOAT16_VALUE(   -4.504) },
+      { SIMDE_FLOAT16_VALUE(    23.45), SIMDE_FLOAT16_VALUE(     80.5), SIMDE_FLOAT16_VALUE(     99.3), SIMDE_FLOAT16_VALUE(    9.305),
+        SIMDE_FLOAT16_VALUE(    -42.3), SIMDE_FLOAT16_VALUE(   -7.008), SIMDE_FLOAT16_VALUE(    5.938), SIMDE_FLOAT16_VALUE(   -28.72),
+        SIMDE_FLOAT16_VALUE(     74.2), SIMDE_FLOAT16_VALUE(    35.78), SIMDE_FLOAT16_VALUE(    -70.7), SIMDE_FLOAT16_VALUE(    19.66),
+        SIMDE_FLOAT16_VALUE(    -70.4), SIMDE_FLOAT16_VALUE(     4.07), SIMDE_FLOAT16_VALUE(   -50.97), SIMDE_FLOAT16_VALUE(   -26.83),
+        SIMDE_FLOAT16_VALUE(     54.4), SIMDE_FLOAT16_VALUE(    -89.9), SIMDE_FLOAT16_VALUE(    -89.1), SIMDE_FLOAT16_VALUE(     79.9),
+        SIMDE_FLOAT16_VALUE(     95.2), SIMDE_FLOAT16_VALUE(    -55.8), SIMDE_FLOAT16_VALUE(    33.12), SIMDE_FLOAT16_VALUE(   -37.03),
+        SIMDE_FLOAT16_VALUE(   -44.34), SIMDE_FLOAT16_VALUE(     91.2), SIMDE_FLOAT16_VALUE(     93.9), SIMDE_FLOAT16_VALUE(     93.2),
+        SIMDE_FLOAT16_VALUE(   -98.06), SIMDE_FLOAT16_VALUE(   -31.62), SIMDE_FLOAT16_VALUE(   -8.164), SIMDE_FLOAT16_VALUE(   -35.56) },
+      { SIMDE_FLOAT16_VALUE(    10.43), SIMDE_FLOAT16_VALUE(   100.06), SIMDE_FLOAT16_VALUE(     2.25), SIMDE_FLOAT16_VALUE(    83.25),
+        SIMDE_FLOAT16_VALUE(   -2.094), SIMDE_FLOAT16_VALUE(    -94.6), SIMDE_FLOAT16_VALUE(   -53.38), SIMDE_FLOAT16_VALUE(   -74.75),
+        SIMDE_FLOAT16_VALUE(    86.44), SIMDE_FLOAT16_VALUE(    123.9), SIMDE_FLOAT16_VALUE(   -40.44), SIMDE_FLOAT16_VALUE(    3.172),
+        SIMDE_FLOAT16_VALUE(   -93.94), SIMDE_FLOAT16_VALUE(    -74.5), SIMDE_FLOAT16_VALUE(   -146.8), SIMDE_FLOAT16_VALUE(   -55.56),
+        SIMDE_FLOAT16_VALUE(    131.4), SIMDE_FLOAT16_VALUE(   -178.4), SIMDE_FLOAT16_VALUE(   -149.4), SIMDE_FLOAT16_VALUE(    167.8),
+        SIMDE_FLOAT16_VALUE(    139.2), SIMDE_FLOAT16_VALUE(    -89.5), SIMDE_FLOAT16_VALUE(     33.5), SIMDE_FLOAT16_VALUE(   -127.5),
+        SIMDE_FLOAT16_VALUE(  -106.75), SIMDE_FLOAT16_VALUE(     93.2), SIMDE_FLOAT16_VALUE(     62.0), SIMDE_FLOAT16_VALUE(    153.9),
+        SIMDE_FLOAT16_VALUE(   -193.5), SIMDE_FLOAT16_VALUE(    -73.6), SIMDE_FLOAT16_VALUE(    33.12), SIMDE_FLOAT16_VALUE(   -40.06) } },
+    { { SIMDE_FLOAT16_VALUE(     98.6), SIMDE_FLOAT16_VALUE(     75.3), SIMDE_FLOAT16_VALUE(   -77.75), SIMDE_FLOAT16_VALUE(    -37.5),
+        SIMDE_FLOAT16_VALUE(    -79.1), SIMDE_FLOAT16_VALUE(   -31.48), SIMDE_FLOAT16_VALUE(    75.75), SIMDE_FLOAT16_VALUE(    56.34),
+        SIMDE_FLOAT16_VALUE(    -77.1), SIMDE_FLOAT16_VALUE(    77.25), SIMDE_FLOAT16_VALUE(    57.38), SIMDE_FLOAT16_VALUE(    19.77),
+        SIMDE_FLOAT16_VALUE(   -50.34), SIMDE_FLOAT16_VALUE(    -73.0), SIMDE_FLOAT16_VALUE(    72.06), SIMDE_FLOAT16_VALUE(    2.697),
+        SIMDE_FLOAT16_VALUE(    -23.6), SIMDE_FLOAT16_VALUE(    -9.56), SIMDE_FLOAT16_VALUE(   -56.97), SIMDE_FLOAT16_VALUE(     57.0),
+        SIMDE_FLOAT16_VALUE(     95.7), SIMDE_FLOAT16_VALUE(   -72.25), SIMDE_FLOAT16_VALUE(   -16.97), SIMDE_FLOAT16_VALUE(   -27.86),
+        SIMDE_FLOAT16_VALUE(    42.56), SIMDE_FLOAT16_VALUE(     24.7), SIMDE_FLOAT16_VALUE(    52.25), SIMDE_FLOAT16_VALUE(     87.7),
+        SIMDE_FLOAT16_VALUE(   -37.78), SIMDE_FLOAT16_VALUE(    -81.0), SIMDE_FLOAT16_VALUE(    48.28), SIMDE_FLOAT16_VALUE(    94.75) },
+      { SIMDE_FLOAT16_VALUE(    -44.7), SIMDE_FLOAT16_VALUE(   -89.94), SIMDE_FLOAT16_VALUE(     92.7), SIMDE_FLOAT16_VALUE(    41.78),
+        SIMDE_FLOAT16_VALUE(    58.62), SIMDE_FLOAT16_VALUE(   -19.17), SIMDE_FLOAT16_VALUE(    25.66), SIMDE_FLOAT16_VALUE(     9.11),
+        SIMDE_FLOAT16_VALUE(   -65.56), SIMDE_FLOAT16_VALUE(    -90.3), SIMDE_FLOAT16_VALUE(    -82.6), SIMDE_FLOAT16_VALUE(    41.12),
+        SIMDE_FLOAT16_VALUE(   -21.67), SIMDE_FLOAT16_VALUE(   -30.92), SIMDE_FLOAT16_VALUE(    39.12), SIMDE_FLOAT16_VALUE(    62.03),
+        SIMDE_FLOAT16_VALUE(   -55.16), SIMDE_FLOAT16_VALUE(   -55.66), SIMDE_FLOAT16_VALUE(   -25.69), SIMDE_FLOAT16_VALUE(     59.9),
+        SIMDE_FLOAT16_VALUE(   -19.81), SIMDE_FLOAT16_VALUE(     43.4), SIMDE_FLOAT16_VALUE(   -34.34), SIMDE_FLOAT16_VALUE(    19.38),
+        SIMDE_FLOAT16_VALUE(    -84.5), SIMDE_FLOAT16_VALUE(   -33.88), SIMDE_FLOAT16_VALUE(    -81.2), SIMDE_FLOAT16_VALUE(     28.1),
+        SIMDE_FLOAT16_VALUE(    30.38), SIMDE_FLOAT16_VALUE(    53.38), SIMDE_FLOAT16_VALUE(    -73.9), SIMDE_FLOAT16_VALUE(   -25.66) },
+      { SIMDE_FLOAT16_VALUE(    53.94), SIMDE_FLOAT16_VALUE(  -14.625), SIMDE_FLOAT16_VALUE(    14.94), SIMDE_FLOAT16_VALUE(     4.28),
+        SIMDE_FLOAT16_VALUE(    -20.5), SIMDE_FLOAT16_VALUE(   -50.66), SIMDE_FLOAT16_VALUE(    101.4), SIMDE_FLOAT16_VALUE(    65.44),
+        SIMDE_FLOAT16_VALUE(   -142.8), SIMDE_FLOAT16_VALUE(   -13.06), SIMDE_FLOAT16_VALUE(   -25.25), SIMDE_FLOAT16_VALUE(    60.88),
+        SIMDE_FLOAT16_VALUE(    -72.0), SIMDE_FLOAT16_VALUE(  -103.94), SIMDE_FLOAT16_VALUE(    111.2), SIMDE_FLOAT16_VALUE(    64.75),
+        SIMDE_FLOAT16_VALUE(   -78.75), SIMDE_FLOAT16_VALUE(   -65.25), SIMDE_FLOAT16_VALUE(    -82.6), SIMDE_FLOAT16_VALUE(    116.9),
+        SIMDE_FLOAT16_VALUE(     75.9), SIMDE_FLOAT16_VALUE(   -28.84), SIMDE_FLOAT16_VALUE(    -51.3), SIMDE_FLOAT16_VALUE(   -8.484),
+        SIMDE_FLOAT16_VALUE(   -41.94), SIMDE_FLOAT16_VALUE(    -9.17), SIMDE_FLOAT16_VALUE(   -28.94), SIMDE_FLOAT16_VALUE(   115.75),
+        SIMDE_FLOAT16_VALUE(   -7.406), SIMDE_FLOAT16_VALUE(   -27.62), SIMDE_FLOAT16_VALUE(    -25.6), SIMDE_FLOAT16_VALUE(     69.1) } },
+    { { SIMDE_FLOAT16_VALUE(   -24.19), SIMDE_FLOAT16_VALUE(     73.8), SIMDE_FLOAT16_VALUE(    -45.5), SIMDE_FLOAT16_VALUE(   -99.25),
+        SIMDE_FLOAT16_VALUE(    38.94), SIMDE_FLOAT16_VALUE(     91.1), SIMDE_FLOAT16_VALUE(    -96.4), SIMDE_FLOAT16_VALUE(    51.62),
+        SIMDE_FLOAT16_VALUE(   -46.22), SIMDE_FLOAT16_VALUE(   -50.22), SIMDE_FLOAT16_VALUE(    98.56), SIMDE_FLOAT16_VALUE(   -46.25),
+        SIMDE_FLOAT16_VALUE(    36.72), SIMDE_FLOAT16_VALUE(    4.188), SIMDE_FLOAT16_VALUE(    -76.8), SIMDE_FLOAT16_VALUE(    -70.3),
+        SIMDE_FLOAT16_VALUE(    -85.8), SIMDE_FLOAT16_VALUE(   0.0779), SIMDE_FLOAT16_VALUE(    -74.3), SIMDE_FLOAT16_VALUE(     77.2),
+        SIMDE_FLOAT16_VALUE(    16.84), SIMDE_FLOAT16_VALUE(     81.3), SIMDE_FLOAT16_VALUE(    -90.6), SIMDE_FLOAT16_VALUE(    81.94),
+        SIMDE_FLOAT16_VALUE(   -19.83), SIMDE_FLOAT16_VALUE(     82.7), SIMDE_FLOAT16_VALUE(     90.4), SIMDE_FLOAT16_VALUE(  -15.664),
+        SIMDE_FLOAT16_VALUE(     36.7), SIMDE_FLOAT16_VALUE(   -19.27), SIMDE_FLOAT16_VALUE(     90.5), SIMDE_FLOAT16_VALUE(   -97.56) },
+      { SIMDE_FLOAT16_VALUE(    44.75), SIMDE_FLOAT16_VALUE(   -58.38), SIMDE_FLOAT16_VALUE(    79.06), SIMDE_FLOAT16_VALUE(   -10.68),
+        SIMDE_FLOAT16_VALUE(   -26.52), SIMDE_FLOAT16_VALUE(    4.902), SIMDE_FLOAT16_VALUE(    62.78), SIMDE_FLOAT16_VALUE(    68.06),
+        SIMDE_FLOAT16_VALUE(    -83.1), SIMDE_FLOAT16_VALUE(     36.7), SIMDE_FLOAT16_VALUE(   -46.56), SIMDE_FLOAT16_VALUE(     88.5),
+        SIMDE_FLOAT16_VALUE(    51.62), SIMDE_FLOAT16_VALUE(   -56.44), SIMDE_FLOAT16_VALUE(     9.08), SIMDE_FLOAT16_VALUE(   -34.88),
+        SIMDE_FLOAT16_VALUE(   -40.88), SIMDE_FLOAT16_VALUE(    49.78), SIMDE_FLOAT16_VALUE(    -77.0), SIMDE_FLOAT16_VALUE(    63.97),
+        SIMDE_FLOAT16_VALUE(    48.84), SIMDE_FLOAT16_VALUE(    -5.49), SIMDE_FLOAT16_VALUE(    -84.0), SIMDE_FLOAT16_VALUE(    55.38),
+        SIMDE_FLOAT16_VALUE(   -7.207), SIMDE_FLOAT16_VALUE(   -6.113), SIMDE_FLOAT16_VALUE(    60.62), SIMDE_FLOAT16_VALUE(    2.402),
+        SIMDE_FLOAT16_VALUE(     65.4), SIMDE_FLOAT16_VALUE(     81.2), SIMDE_FLOAT16_VALUE(   -73.44), SIMDE_FLOAT16_VALUE(    -71.7) },
+      { SIMDE_FLOAT16_VALUE(    20.56), SIMDE_FLOAT16_VALUE(    15.44), SIMDE_FLOAT16_VALUE(    33.56), SIMDE_FLOAT16_VALUE(  -109.94),
+        SIMDE_FLOAT16_VALUE(    12.42), SIMDE_FLOAT16_VALUE(     96.0), SIMDE_FLOAT16_VALUE(    -33.6), SIMDE_FLOAT16_VALUE(    119.7),
+        SIMDE_FLOAT16_VALUE(   -129.4), SIMDE_FLOAT16_VALUE(   -13.53), SIMDE_FLOAT16_VALUE(     52.0), SIMDE_FLOAT16_VALUE(    42.25),
+        SIMDE_FLOAT16_VALUE(     88.4), SIMDE_FLOAT16_VALUE(   -52.25), SIMDE_FLOAT16_VALUE(   -67.75), SIMDE_FLOAT16_VALUE(   -105.2),
+        SIMDE_FLOAT16_VALUE(   -126.7), SIMDE_FLOAT16_VALUE(    49.84), SIMDE_FLOAT16_VALUE(   -151.2), SIMDE_FLOAT16_VALUE(    141.1),
+        SIMDE_FLOAT16_VALUE(     65.7), SIMDE_FLOAT16_VALUE(     75.8), SIMDE_FLOAT16_VALUE(   -174.6), SIMDE_FLOAT16_VALUE(    137.2),
+        SIMDE_FLOAT16_VALUE(   -27.03), SIMDE_FLOAT16_VALUE(    76.56), SIMDE_FLOAT16_VALUE(    151.0), SIMDE_FLOAT16_VALUE(  -13.266),
+        SIMDE_FLOAT16_VALUE(   102.06), SIMDE_FLOAT16_VALUE(    61.94), SIMDE_FLOAT16_VALUE(    17.06), SIMDE_FLOAT16_VALUE(   -169.2) } },
+    { { SIMDE_FLOAT16_VALUE(    27.14), SIMDE_FLOAT16_VALUE(   -60.44), SIMDE_FLOAT16_VALUE(    32.72), SIMDE_FLOAT16_VALUE(    68.25),
+        SIMDE_FLOAT16_VALUE(    5.465), SIMDE_FLOAT16_VALUE(   -85.75), SIMDE_FLOAT16_VALUE(     83.3), SIMDE_FLOAT16_VALUE(    56.47),
+        SIMDE_FLOAT16_VALUE(    20.55), SIMDE_FLOAT16_VALUE(    39.34), SIMDE_FLOAT16_VALUE(   -22.45), SIMDE_FLOAT16_VALUE(     97.6),
+        SIMDE_FLOAT16_VALUE(   -47.28), SIMDE_FLOAT16_VALUE(    19.95), SIMDE_FLOAT16_VALUE(   -5.824), SIMDE_FLOAT16_VALUE(   -35.44),
+        SIMDE_FLOAT16_VALUE(     95.6), SIMDE_FLOAT16_VALUE(    44.16), SIMDE_FLOAT16_VALUE(   -3.957), SIMDE_FLOAT16_VALUE(   -34.84),
+        SIMDE_FLOAT16_VALUE(     45.4), SIMDE_FLOAT16_VALUE(     65.9), SIMDE_FLOAT16_VALUE(    -46.1), SIMDE_FLOAT16_VALUE(    -51.1),
+        SIMDE_FLOAT16_VALUE(    -63.7), SIMDE_FLOAT16_VALUE(    95.44), SIMDE_FLOAT16_VALUE(    11.52), SIMDE_FLOAT16_VALUE(    19.39),
+        SIMDE_FLOAT16_VALUE(    39.28), SIMDE_FLOAT16_VALUE(    -99.8), SIMDE_FLOAT16_VALUE(     68.2), SIMDE_FLOAT16_VALUE(    97.25) },
+      { SIMDE_FLOAT16_VALUE(     80.3), SIMDE_FLOAT16_VALUE(   -42.84), SIMDE_FLOAT16_VALUE(   -2.742), SIMDE_FLOAT16_VALUE(     37.0),
+        SIMDE_FLOAT16_VALUE(    26.69), SIMDE_FLOAT16_VALUE(   -39.66), SIMDE_FLOAT16_VALUE(    32.88), SIMDE_FLOAT16_VALUE(    62.25),
+        SIMDE_FLOAT16_VALUE(    88.94), SIMDE_FLOAT16_VALUE(    -71.7), SIMDE_FLOAT16_VALUE(   -38.38), SIMDE_FLOAT16_VALUE(    51.25),
+        SIMDE_FLOAT16_VALUE(   -5.836), SIMDE_FLOAT16_VALUE(    22.81), SIMDE_FLOAT16_VALUE(   -24.39), SIMDE_FLOAT16_VALUE(    59.47),
+        SIMDE_FLOAT16_VALUE(   -45.78), SIMDE_FLOAT16_VALUE(    20.34), SIMDE_FLOAT16_VALUE(     87.0), SIMDE_FLOAT16_VALUE(   -43.53),
+        SIMDE_FLOAT16_VALUE(     77.9), SIMDE_FLOAT16_VALUE(    31.73), SIMDE_FLOAT16_VALUE(     80.7), SIMDE_FLOAT16_VALUE(    78.06),
+        SIMDE_FLOAT16_VALUE(    -25.1), SIMDE_FLOAT16_VALUE(    78.06), SIMDE_FLOAT16_VALUE(    64.44), SIMDE_FLOAT16_VALUE(   -81.44),
+        SIMDE_FLOAT16_VALUE(    76.06), SIMDE_FLOAT16_VALUE(     30.1), SIMDE_FLOAT16_VALUE(   -19.73), SIMDE_FLOAT16_VALUE(   -28.06) },
+      { SIMDE_FLOAT16_VALUE(   107.44), SIMDE_FLOAT16_VALUE(  -103.25), SIMDE_FLOAT16_VALUE(    29.97), SIMDE_FLOAT16_VALUE(   105.25),
+        SIMDE_FLOAT16_VALUE(    32.16), SIMDE_FLOAT16_VALUE(   -125.4), SIMDE_FLOAT16_VALUE(    116.2), SIMDE_FLOAT16_VALUE(   118.75),
+        SIMDE_FLOAT16_VALUE(    109.5), SIMDE_FLOAT16_VALUE(   -32.34), SIMDE_FLOAT16_VALUE(    -60.8), SIMDE_FLOAT16_VALUE(    148.9),
+        SIMDE_FLOAT16_VALUE(   -53.12), SIMDE_FLOAT16_VALUE(    42.75), SIMDE_FLOAT16_VALUE(   -30.22), SIMDE_FLOAT16_VALUE(    24.03),
+        SIMDE_FLOAT16_VALUE(    49.84), SIMDE_FLOAT16_VALUE(     64.5), SIMDE_FLOAT16_VALUE(    83.06), SIMDE_FLOAT16_VALUE(    -78.4),
+        SIMDE_FLOAT16_VALUE(   123.25), SIMDE_FLOAT16_VALUE(     97.6), SIMDE_FLOAT16_VALUE(     34.6), SIMDE_FLOAT16_VALUE(    26.97),
+        SIMDE_FLOAT16_VALUE(   -88.75), SIMDE_FLOAT16_VALUE(    173.5), SIMDE_FLOAT16_VALUE(    75.94), SIMDE_FLOAT16_VALUE(   -62.06),
+        SIMDE_FLOAT16_VALUE(    115.4), SIMDE_FLOAT16_VALUE(   -69.75), SIMDE_FLOAT16_VALUE(    48.44), SIMDE_FLOAT16_VALUE(     69.2) } },
+    { { SIMDE_FLOAT16_VALUE(    -78.0), SIMDE_FLOAT16_VALUE(    28.42), SIMDE_FLOAT16_VALUE(    57.56), SIMDE_FLOAT16_VALUE(    69.56),
+        SIMDE_FLOAT16_VALUE(   -41.78), SIMDE_FLOAT16_VALUE(    -78.6), SIMDE_FLOAT16_VALUE(   -18.56), SIMDE_FLOAT16_VALUE(     92.7),
+        SIMDE_FLOAT16_VALUE(    -18.3), SIMDE_FLOAT16_VALUE(   -53.66), SIMDE_FLOAT16_VALUE(     93.9), SIMDE_FLOAT16_VALUE(   -36.56),
+        SIMDE_FLOAT16_VALUE(   -51.66), SIMDE_FLOAT16_VALUE(    22.52), SIMDE_FLOAT16_VALUE(   -59.88), SIMDE_FLOAT16_VALUE(    -93.7),
+        SIMDE_FLOAT16_VALUE(     68.0), SIMDE_FLOAT16_VALUE(    4.887), SIMDE_FLOAT16_VALUE(   -6.508), SIMDE_FLOAT16_VALUE(    18.61),
+        SIMDE_FLOAT16_VALUE(    41.62), SIMDE_FLOAT16_VALUE(    -48.2), SIMDE_FLOAT16_VALUE(     59.6), SIMDE_FLOAT16_VALUE(    50.88),
+        SIMDE_FLOAT16_VALUE(     61.7), SIMDE_FLOAT16_VALUE(    53.06), SIMDE_FLOAT16_VALUE(    34.97), SIMDE_FLOAT16_VALUE(   -24.03),
+        SIMDE_FLOAT16_VALUE(   -18.77), SIMDE_FLOAT16_VALUE(   -72.25), SIMDE_FLOAT16_VALUE(    -34.0), SIMDE_FLOAT16_VALUE(    24.97) },
+      { SIMDE_FLOAT16_VALUE(      3.0), SIMDE_FLOAT16_VALUE(   -66.44), SIMDE_FLOAT16_VALUE(     28.4), SIMDE_FLOAT16_VALUE(   -63.22),
+        SIMDE_FLOAT16_VALUE(   -49.88), SIMDE_FLOAT16_VALUE(    -41.6), SIMDE_FLOAT16_VALUE(     68.7), SIMDE_FLOAT16_VALUE(     53.4),
+        SIMDE_FLOAT16_VALUE(    12.33), SIMDE_FLOAT16_VALUE(     76.3), SIMDE_FLOAT16_VALUE(     59.4), SIMDE_FLOAT16_VALUE(     50.8),
+        SIMDE_FLOAT16_VALUE(   -56.28), SIMDE_FLOAT16_VALUE(   -32.56), SIMDE_FLOAT16_VALUE(     87.1), SIMDE_FLOAT16_VALUE(    -96.9),
+        SIMDE_FLOAT16_VALUE(    86.94), SIMDE_FLOAT16_VALUE(    -79.0), SIMDE_FLOAT16_VALUE(   -77.75), SIMDE_FLOAT16_VALUE(    -52.2),
+        SIMDE_FLOAT16_VALUE(     85.3), SIMDE_FLOAT16_VALUE(   -39.62), SIMDE_FLOAT16_VALUE(    32.72), SIMDE_FLOAT16_VALUE(   -79.44),
+        SIMDE_FLOAT16_VALUE(     53.6), SIMDE_FLOAT16_VALUE(    46.75), SIMDE_FLOAT16_VALUE(   11.766), SIMDE_FLOAT16_VALUE(    -99.6),
+        SIMDE_FLOAT16_VALUE(    8.586), SIMDE_FLOAT16_VALUE(   -67.44), SIMDE_FLOAT16_VALUE(    -99.3), SIMDE_FLOAT16_VALUE(     48.2) },
+      { SIMDE_FLOAT16_VALUE(    -75.0), SIMDE_FLOAT16_VALUE(    -38.0), SIMDE_FLOAT16_VALUE(     86.0), SIMDE_FLOAT16_VALUE(    6.344),
+        SIMDE_FLOAT16_VALUE(    -91.6), SIMDE_FLOAT16_VALUE(  -120.25), SIMDE_FLOAT16_VALUE(    50.12), SIMDE_FLOAT16_VALUE(    146.1),
+        SIMDE_FLOAT16_VALUE(    -5.97), SIMDE_FLOAT16_VALUE(    22.66), SIMDE_FLOAT16_VALUE(    153.2), SIMDE_FLOAT16_VALUE(    14.25),
+        SIMDE_FLOAT16_VALUE(  -107.94), SIMDE_FLOAT16_VALUE(   -10.05), SIMDE_FLOAT16_VALUE(    27.25), SIMDE_FLOAT16_VALUE(   -190.5),
+        SIMDE_FLOAT16_VALUE(    155.0), SIMDE_FLOAT16_VALUE(    -74.1), SIMDE_FLOAT16_VALUE(   -84.25), SIMDE_FLOAT16_VALUE(   -33.56),
+        SIMDE_FLOAT16_VALUE(   126.94), SIMDE_FLOAT16_VALUE(    -87.8), SIMDE_FLOAT16_VALUE(     92.3), SIMDE_FLOAT16_VALUE(   -28.56),
+        SIMDE_FLOAT16_VALUE(   115.25), SIMDE_FLOAT16_VALUE(     99.8), SIMDE_FLOAT16_VALUE(    46.75), SIMDE_FLOAT16_VALUE(   -123.6),
+        SIMDE_FLOAT16_VALUE(   -10.18), SIMDE_FLOAT16_VALUE(   -139.8), SIMDE_FLOAT16_VALUE(   -133.2), SIMDE_FLOAT16_VALUE(     73.1) } },
+    { { SIMDE_FLOAT16_VALUE(    44.88), SIMDE_FLOAT16_VALUE(    44.97), SIMDE_FLOAT16_VALUE(    -35.2), SIMDE_FLOAT16_VALUE(   -66.94),
+        SIMDE_FLOAT16_VALUE(   -67.25), SIMDE_FLOAT16_VALUE(   -16.62), SIMDE_FLOAT16_VALUE(   -51.62), SIMDE_FLOAT16_VALUE(    34.25),
+        SIMDE_FLOAT16_VALUE(    -88.0), SIMDE_FLOAT16_VALUE(     53.1), SIMDE_FLOAT16_VALUE(    3.877), SIMDE_FLOAT16_VALUE(    -86.4),
+        SIMDE_FLOAT16_VALUE(   -41.62), SIMDE_FLOAT16_VALUE(   -45.34), SIMDE_FLOAT16_VALUE(    -48.2), SIMDE_FLOAT16_VALUE(    -40.6),
+        SIMDE_FLOAT16_VALUE(   -46.34), SIMDE_FLOAT16_VALUE(     6.18), SIMDE_FLOAT16_VALUE(   -20.17), SIMDE_FLOAT16_VALUE(   -27.56),
+        SIMDE_FLOAT16_VALUE(    50.88), SIMDE_FLOAT16_VALUE(    83.94), SIMDE_FLOAT16_VALUE(     65.3), SIMDE_FLOAT16_VALUE(    -64.5),
+        SIMDE_FLOAT16_VALUE(   -6.617), SIMDE_FLOAT16_VALUE(    62.84), SIMDE_FLOAT16_VALUE(    25.62), SIMDE_FLOAT16_VALUE(     86.7),
+        SIMDE_FLOAT16_VALUE(   -5.176), SIMDE_FLOAT16_VALUE(    -72.1), SIMDE_FLOAT16_VALUE(   -55.06), SIMDE_FLOAT16_VALUE(   -24.11) },
+      { SIMDE_FLOAT16_VALUE(   -27.77), SIMDE_FLOAT16_VALUE(   -22.98), SIMDE_FLOAT16_VALUE(   -72.94), SIMDE_FLOAT16_VALUE(    -71.4),
+        SIMDE_FLOAT16_VALUE(    -35.7), SIMDE_FLOAT16_VALUE(   -23.53), SIMDE_FLOAT16_VALUE(     88.5), SIMDE_FLOAT16_VALUE(   -14.41),
+        SIMDE_FLOAT16_VALUE(    59.97), SIMDE_FLOAT16_VALUE(   -82.25), SIMDE_FLOAT16_VALUE(     83.6), SIMDE_FLOAT16_VALUE(   -99.06),
+        SIMDE_FLOAT16_VALUE(   13.586), SIMDE_FLOAT16_VALUE(   -85.75), SIMDE_FLOAT16_VALUE(    -66.6), SIMDE_FLOAT16_VALUE(     90.9),
+        SIMDE_FLOAT16_VALUE(    -96.1), SIMDE_FLOAT16_VALUE(     74.3), SIMDE_FLOAT16_VALUE(   -61.53), SIMDE_FLOAT16_VALUE(    11.37),
+        SIMDE_FLOAT16_VALUE(    -44.2), SIMDE_FLOAT16_VALUE(    98.94), SIMDE_FLOAT16_VALUE(    -67.6), SIMDE_FLOAT16_VALUE(    -74.7),
+        SIMDE_FLOAT16_VALUE(   -80.75), SIMDE_FLOAT16_VALUE(    -79.7), SIMDE_FLOAT16_VALUE(    -84.2), SIMDE_FLOAT16_VALUE(     68.4),
+        SIMDE_FLOAT16_VALUE(     58.8), SIMDE_FLOAT16_VALUE(   -16.61), SIMDE_FLOAT16_VALUE(     -7.8), SIMDE_FLOAT16_VALUE(   -33.34) },
+      { SIMDE_FLOAT16_VALUE(    17.11), SIMDE_FLOAT16_VALUE(    21.98), SIMDE_FLOAT16_VALUE(   -108.1), SIMDE_FLOAT16_VALUE(   -138.2),
+        SIMDE_FLOAT16_VALUE(  -102.94), SIMDE_FLOAT16_VALUE(   -40.16), SIMDE_FLOAT16_VALUE(    36.88), SIMDE_FLOAT16_VALUE(    19.84),
+        SIMDE_FLOAT16_VALUE(   -28.03), SIMDE_FLOAT16_VALUE(   -29.16), SIMDE_FLOAT16_VALUE(     87.5), SIMDE_FLOAT16_VALUE(   -185.5),
+        SIMDE_FLOAT16_VALUE(   -28.03), SIMDE_FLOAT16_VALUE(   -131.1), SIMDE_FLOAT16_VALUE(   -114.8), SIMDE_FLOAT16_VALUE(    50.28),
+        SIMDE_FLOAT16_VALUE(   -142.5), SIMDE_FLOAT16_VALUE(     80.5), SIMDE_FLOAT16_VALUE(    -81.7), SIMDE_FLOAT16_VALUE(   -16.19),
+        SIMDE_FLOAT16_VALUE(    6.688), SIMDE_FLOAT16_VALUE(    182.9), SIMDE_FLOAT16_VALUE(   -2.312), SIMDE_FLOAT16_VALUE(   -139.2),
+        SIMDE_FLOAT16_VALUE(    -87.4), SIMDE_FLOAT16_VALUE(   -16.84), SIMDE_FLOAT16_VALUE(   -58.56), SIMDE_FLOAT16_VALUE(    155.0),
+        SIMDE_FLOAT16_VALUE(    53.62), SIMDE_FLOAT16_VALUE(   -88.75), SIMDE_FLOAT16_VALUE(   -62.88), SIMDE_FLOAT16_VALUE(   -57.44) } },
+    { { SIMDE_FLOAT16_VALUE(   -87.25), SIMDE_FLOAT16_VALUE(   -34.56), SIMDE_FLOAT16_VALUE(     75.8), SIMDE_FLOAT16_VALUE(    13.76),
+        SIMDE_FLOAT16_VALUE(   -45.03), SIMDE_FLOAT16_VALUE(   11.664), SIMDE_FLOAT16_VALUE(   -20.47), SIMDE_FLOAT16_VALUE(    -99.0),
+        SIMDE_FLOAT16_VALUE(   -16.44), SIMDE_FLOAT16_VALUE(   -22.28), SIMDE_FLOAT16_VALUE(   -63.38), SIMDE_FLOAT16_VALUE(    75.25),
+        SIMDE_FLOAT16_VALUE(    25.58), SIMDE_FLOAT16_VALUE(     35.1), SIMDE_FLOAT16_VALUE(   -88.94), SIMDE_FLOAT16_VALUE(    -85.6),
+        SIMDE_FLOAT16_VALUE(    85.56), SIMDE_FLOAT16_VALUE(   -84.44), SIMDE_FLOAT16_VALUE(    63.62), SIMDE_FLOAT16_VALUE(     95.4),
+        SIMDE_FLOAT16_VALUE(    -47.0), SIMDE_FLOAT16_VALUE(     78.4), SIMDE_FLOAT16_VALUE(   -51.88), SIMDE_FLOAT16_VALUE(    49.94),
+        SIMDE_FLOAT16_VALUE(   -12.16), SIMDE_FLOAT16_VALUE(    -48.1), SIMDE_FLOAT16_VALUE(    15.53), SIMDE_FLOAT16_VALUE(    -91.5),
+        SIMDE_FLOAT16_VALUE(   -32.03), SIMDE_FLOAT16_VALUE(     4.42), SIMDE_FLOAT16_VALUE(   -21.03), SIMDE_FLOAT16_VALUE(   -73.44) },
+      { SIMDE_FLOAT16_VALUE(    81.44), SIMDE_FLOAT16_VALUE(    24.16), SIMDE_FLOAT16_VALUE(   -28.72), SIMDE_FLOAT16_VALUE(    37.62),
+        SIMDE_FLOAT16_VALUE(    23.69), SIMDE_FLOAT16_VALUE(    73.44), SIMDE_FLOAT16_VALUE(   -27.69), SIMDE_FLOAT16_VALUE(    -48.8),
+        SIMDE_FLOAT16_VALUE(   -29.23), SIMDE_FLOAT16_VALUE(   -88.75), SIMDE_FLOAT16_VALUE(   -92.75), SIMDE_FLOAT16_VALUE(     82.9),
+        SIMDE_FLOAT16_VALUE(   -10.18), SIMDE_FLOAT16_VALUE(    16.06), SIMDE_FLOAT16_VALUE(   -96.06), SIMDE_FLOAT16_VALUE(     32.8),
+        SIMDE_FLOAT16_VALUE(    -69.4), SIMDE_FLOAT16_VALUE(  -15.586), SIMDE_FLOAT16_VALUE(   -98.25), SIMDE_FLOAT16_VALUE(    17.62),
+        SIMDE_FLOAT16_VALUE(   -1.956), SIMDE_FLOAT16_VALUE(    36.25), SIMDE_FLOAT16_VALUE(     58.4), SIMDE_FLOAT16_VALUE(    58.12),
+        SIMDE_FLOAT16_VALUE(     82.1), SIMDE_FLOAT16_VALUE(    33.28), SIMDE_FLOAT16_VALUE(    63.22), SIMDE_FLOAT16_VALUE(    -95.5),
+        SIMDE_FLOAT16_VALUE(    43.06), SIMDE_FLOAT16_VALUE(     96.6), SIMDE_FLOAT16_VALUE(   -22.95), SIMDE_FLOAT16_VALUE(   -45.34) },
+      { SIMDE_FLOAT16_VALUE(   -5.812), SIMDE_FLOAT16_VALUE(   -10.41), SIMDE_FLOAT16_VALUE(     47.1), SIMDE_FLOAT16_VALUE(    51.38),
+        SIMDE_FLOAT16_VALUE(   -21.34), SIMDE_FLOAT16_VALUE(     85.1), SIMDE_FLOAT16_VALUE(   -48.16), SIMDE_FLOAT16_VALUE(   -147.8),
+        SIMDE_FLOAT16_VALUE(    -45.7), SIMDE_FLOAT16_VALUE(   -111.0), SIMDE_FLOAT16_VALUE(   -156.1), SIMDE_FLOAT16_VALUE(    158.1),
+        SIMDE_FLOAT16_VALUE(     15.4), SIMDE_FLOAT16_VALUE(    51.16), SIMDE_FLOAT16_VALUE(   -185.0), SIMDE_FLOAT16_VALUE(    -52.8),
+        SIMDE_FLOAT16_VALUE(    16.19), SIMDE_FLOAT16_VALUE(   -100.0), SIMDE_FLOAT16_VALUE(   -34.62), SIMDE_FLOAT16_VALUE(    113.0),
+        SIMDE_FLOAT16_VALUE(   -48.97), SIMDE_FLOAT16_VALUE(    114.6), SIMDE_FLOAT16_VALUE(     6.53), SIMDE_FLOAT16_VALUE(   108.06),
+        SIMDE_FLOAT16_VALUE(     70.0), SIMDE_FLOAT16_VALUE(   -14.81), SIMDE_FLOAT16_VALUE(    78.75), SIMDE_FLOAT16_VALUE(   -187.0),
+        SIMDE_FLOAT16_VALUE(    11.03), SIMDE_FLOAT16_VALUE(   101.06), SIMDE_FLOAT16_VALUE(    -44.0), SIMDE_FLOAT16_VALUE(  -118.75) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512h a = simde_mm512_loadu_ph(test_vec[i].a);
+    simde__m512h b = simde_mm512_loadu_ph(test_vec[i].b);
+    simde__m512h r = simde_mm512_add_ph(a, b);
+    simde_test_x86_assert_equal_f16x32(r, simde_mm512_loadu_ph(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm512_mask_add_ph (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float16 src[32];
+    const simde__mmask32 k;
+    const simde_float16 a[32];
+    const simde_float16 b[32];
+    const simde_float16 r[32];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(     4.21), SIMDE_FLOAT16_VALUE(   -5.008), SIMDE_FLOAT16_VALUE(   -80.44), SIMDE_FLOAT16_VALUE(    -98.0),
+        SIMDE_FLOAT16_VALUE(   -34.97), SIMDE_FLOAT16_VALUE(   10.984), SIMDE_FLOAT16_VALUE(    93.06), SIMDE_FLOAT16_VALUE(    10.71),
+        SIMDE_FLOAT16_VALUE(    54.25), SIMDE_FLOAT16_VALUE(   -30.72), SIMDE_FLOAT16_VALUE(   -25.62), SIMDE_FLOAT16_VALUE(    98.25),
+        SIMDE_FLOAT16_VALUE(    7.812), SIMDE_FLOAT16_VALUE(    23.61), SIMDE_FLOAT16_VALUE(    86.25), SIMDE_FLOAT16_VALUE(   -19.25),
+        SIMDE_FLOAT16_VALUE(   -2.158), SIMDE_FLOAT16_VALUE(    6.734), SIMDE_FLOAT16_VALUE(    12.36), SIMDE_FLOAT16_VALUE(    -86.8),
+        SIMDE_FLOAT16_VALUE(   -53.34), SIMDE_FLOAT16_VALUE(   -67.44), SIMDE_FLOAT16_VALUE(    35.12), SIMDE_FLOAT16_VALUE(    10.45),
+        SIMDE_FLOAT16_VALUE(    -68.1), SIMDE_FLOAT16_VALUE(    -99.0), SIMDE_FLOAT16_VALUE(     97.3), SIMDE_FLOAT16_VALUE(   -56.78),
+        SIMDE_FLOAT16_VALUE(     65.3), SIMDE_FLOAT16_VALUE(   -62.88), SIMDE_FLOAT16_VALUE(   -25.47), SIMDE_FLOAT16_VALUE(   -84.56) },
+      UINT32_C(1711213349),
+      { SIMDE_FLOAT16_VALUE(     72.6), SIMDE_FLOAT16_VALUE(   -10.15), SIMDE_FLOAT16_VALUE(    -77.7), SIMDE_FLOAT16_VALUE(     66.5),
+        SIMDE_FLOAT16_VALUE(    24.84), SIMDE_FLOAT16_VALUE(   -40.66), SIMDE_FLOAT16_VALUE(     62.8), SIMDE_FLOAT16_VALUE(   -91.25),
+        SIMDE_FLOAT16_VALUE(   -45.88), SIMDE_FLOAT16_VALUE(     54.0), SIMDE_FLOAT16_VALUE(    93.94), SIMDE_FLOAT16_VALUE(    -36.0),
+        SIMDE_FLOAT16_VALUE(    -97.0), SIMDE_FLOAT16_VALUE(   -29.23), SIMDE_FLOAT16_VALUE(    99.44), SIMDE_FLOAT16_VALUE(     49.6),
+        SIMDE_FLOAT16_VALUE(     96.7), SIMDE_FLOAT16_VALUE(     78.2), SIMDE_FLOAT16_VALUE(    -85.9), SIMDE_FLOAT16_VALUE(   -85.44),
+        SIMDE_FLOAT16_VALUE(     66.0), SIMDE_FLOAT16_VALUE(     92.9), SIMDE_FLOAT16_VALUE(    -71.5), SIMDE_FLOAT16_VALUE(    48.88),
+        SIMDE_FLOAT16_VALUE(     87.3), SIMDE_FLOAT16_VALUE(    63.34), SIMDE_FLOAT16_VALUE(    21.61), SIMDE_FLOAT16_VALUE(    64.44),
+        SIMDE_FLOAT16_VALUE(    16.33), SIMDE_FLOAT16_VALUE(   -68.25), SIMDE_FLOAT16_VALUE(    54.16), SIMDE_FLOAT16_VALUE(    14.67) },
+      { SIMDE_FLOAT16_VALUE(    72.06), SIMDE_FLOAT16_VALUE(   -36.66), SIMDE_FLOAT16_VALUE(    48.22), SIMDE_FLOAT16_VALUE(     81.3),
+        SIMDE_FLOAT16_VALUE(    -65.4), SIMDE_FLOAT16_VALUE(    38.97), SIMDE_FLOAT16_VALUE(    -75.3), SIMDE_FLOAT16_VALUE(    -84.8),
+        SIMDE_FLOAT16_VALUE(   -37.22), SIMDE_FLOAT16_VALUE(   -20.77), SIMDE_FLOAT16_VALUE(   -37.38), SIMDE_FLOAT16_VALUE(    24.47),
+        SIMDE_FLOAT16_VALUE(    34.97), SIMDE_FLOAT16_VALUE(    63.25), SIMDE_FLOAT16_VALUE(   -95.06), SIMDE_FLOAT16_VALUE(     36.0),
+        SIMDE_FLOAT16_VALUE(   -17.56), SIMDE_FLOAT16_VALUE(    43.22), SIMDE_FLOAT16_VALUE(    2.307), SIMDE_FLOAT16_VALUE(    35.53),
+        SIMDE_FLOAT16_VALUE(    -32.5), SIMDE_FLOAT16_VALUE(   -81.06), SIMDE_FLOAT16_VALUE(    33.38), SIMDE_FLOAT16_VALUE(     26.3),
+        SIMDE_FLOAT16_VALUE(  -15.234), SIMDE_FLOAT16_VALUE(    43.06), SIMDE_FLOAT16_VALUE(    39.62), SIMDE_FLOAT16_VALUE(    34.03),
+        SIMDE_FLOAT16_VALUE(    66.56), SIMDE_FLOAT16_VALUE(   11.125), SIMDE_FLOAT16_VALUE(    60.25), SIMDE_FLOAT16_VALUE(   -95.75) },
+      { SIMDE_FLOAT16_VALUE(    144.8), SIMDE_FLOAT16_VALUE(   -5.008), SIMDE_FLOAT16_VALUE(   -29.47), SIMDE_FLOAT16_VALUE(    -98.0),
+        SIMDE_FLOAT16_VALUE(   -34.97), SIMDE_FLOAT16_VALUE(  -1.6875), SIMDE_FLOAT16_VALUE(    93.06), SIMDE_FLOAT16_VALUE(    10.71),
+        SIMDE_FLOAT16_VALUE(    -83.1), SIMDE_FLOAT16_VALUE(    33.25), SIMDE_FLOAT16_VALUE(   -25.62), SIMDE_FLOAT16_VALUE(   -11.53),
+        SIMDE_FLOAT16_VALUE(    7.812), SIMDE_FLOAT16_VALUE(    23.61), SIMDE_FLOAT16_VALUE(    86.25), SIMDE_FLOAT16_VALUE(   -19.25),
+        SIMDE_FLOAT16_VALUE(     79.1), SIMDE_FLOAT16_VALUE(    121.4), SIMDE_FLOAT16_VALUE(   -83.56), SIMDE_FLOAT16_VALUE(    -49.9),
+        SIMDE_FLOAT16_VALUE(     33.5), SIMDE_FLOAT16_VALUE(    11.81), SIMDE_FLOAT16_VALUE(   -38.12), SIMDE_FLOAT16_VALUE(     75.2),
+        SIMDE_FLOAT16_VALUE(    72.06), SIMDE_FLOAT16_VALUE(    -99.0), SIMDE_FLOAT16_VALUE(    61.25), SIMDE_FLOAT16_VALUE(   -56.78),
+        SIMDE_FLOAT16_VALUE(     65.3), SIMDE_FLOAT16_VALUE(   -57.12), SIMDE_FLOAT16_VALUE(    114.4), SIMDE_FLOAT16_VALUE(   -84.56) } },
+    { { SIMDE_FLOAT16_VALUE(     99.1), SIMDE_FLOAT16_VALUE(     93.4), SIMDE_FLOAT16_VALUE(    -81.2), SIMDE_FLOAT16_VALUE(     24.9),
+        SIMDE_FLOAT16_VALUE(    60.88), SIMDE_FLOAT16_VALUE(    -92.7), SIMDE_FLOAT16_VALUE(    -89.1), SIMDE_FLOAT16_VALUE(   -65.44),
+        SIMDE_FLOAT16_VALUE(    52.97), SIMDE_FLOAT16_VALUE(    63.56), SIMDE_FLOAT16_VALUE(   -61.75), SIMDE_FLOAT16_VALUE(     32.5),
+        SIMDE_FLOAT16_VALUE(   -58.34), SIMDE_FLOAT16_VALUE(    -58.4), SIMDE_FLOAT16_VALUE(    22.22), SIMDE_FLOAT16_VALUE(  -13.586),
+        SIMDE_FLOAT16_VALUE(    67.06), SIMDE_FLOAT16_VALUE(    52.94), SIMDE_FLOAT16_VALUE(     25.5), SIMDE_FLOAT16_VALUE(      7.4),
+        SIMDE_FLOAT16_VALUE(   -49.16), SIMDE_FLOAT16_VALUE(    -9.32), SIMDE_FLOAT16_VALUE(    27.89), SIMDE_FLOAT16_VALUE(    30.73),
+        SIMDE_FLOAT16_VALUE(    95.44), SIMDE_FLOAT16_VALUE(     34.5), SIMDE_FLOAT16_VALUE(    24.27), SIMDE_FLOAT16_VALUE(     5.15),
+        SIMDE_FLOAT16_VALUE(    29.77), SIMDE_FLOAT16_VALUE(    23.72), SIMDE_FLOAT16_VALUE(     35.5), SIMDE_FLOAT16_VALUE(    -81.1) },
+      UINT32_C(505829699),
+      { SIMDE_FLOAT16_VALUE(    55.28), SIMDE_FLOAT16_VALUE(    53.62), SIMDE_FLOAT16_VALUE(     4.13), SIMDE_FLOAT16_VALUE(    -90.5),
+        SIMDE_FLOAT16_VALUE(     24.5), SIMDE_FLOAT16_VALUE(    -75.8), SIMDE_FLOAT16_VALUE(   -27.61), SIMDE_FLOAT16_VALUE(    93.75),
+        SIMDE_FLOAT16_VALUE(   -48.56), SIMDE_FLOAT16_VALUE(   -97.75), SIMDE_FLOAT16_VALUE(    37.78), SIMDE_FLOAT16_VALUE(   -46.16),
+        SIMDE_FLOAT16_VALUE(     77.3), SIMDE_FLOAT16_VALUE(   -38.53), SIMDE_FLOAT16_VALUE(    -67.8), SIMDE_FLOAT16_VALUE(    -66.1),
+        SIMDE_FLOAT16_VALUE(    26.23), SIMDE_FLOAT16_VALUE(    12.32), SIMDE_FLOAT16_VALUE(   -98.25), SIMDE_FLOAT16_VALUE(    42.03),
+        SIMDE_FLOAT16_VALUE(   -28.39), SIMDE_FLOAT16_VALUE(   -20.48), SIMDE_FLOAT16_VALUE(    -95.0), SIMDE_FLOAT16_VALUE(   -42.53),
+        SIMDE_FLOAT16_VALUE(    2.082), SIMDE_FLOAT16_VALUE(    22.02), SIMDE_FLOAT16_VALUE(     88.7), SIMDE_FLOAT16_VALUE(    40.84),
+        SIMDE_FLOAT16_VALUE(   -34.88), SIMDE_FLOAT16_VALUE(    13.95), SIMDE_FLOAT16_VALUE(    -36.8), SIMDE_FLOAT16_VALUE(   -21.55) },
+      { SIMDE_FLOAT16_VALUE(    -6.88), SIMDE_FLOAT16_VALUE(   -91.44), SIMDE_FLOAT16_VALUE(     71.3), SIMDE_FLOAT16_VALUE(   -53.25),
+        SIMDE_FLOAT16_VALUE(    97.25), SIMDE_FLOAT16_VALUE(     62.5), SIMDE_FLOAT16_VALUE(    -67.7), SIMDE_FLOAT16_VALUE(    29.52),
+        SIMDE_FLOAT16_VALUE(    92.06), SIMDE_FLOAT16_VALUE(   -62.44), SIMDE_FLOAT16_VALUE(    -77.9), SIMDE_FLOAT16_VALUE(   -77.94),
+        SIMDE_FLOAT16_VALUE(   -97.56), SIMDE_FLOAT16_VALUE(    33.97), SIMDE_FLOAT16_VALUE(    40.16), SIMDE_FLOAT16_VALUE(    26.55),
+        SIMDE_FLOAT16_VALUE(    20.05), SIMDE_FLOAT16_VALUE(    29.52), SIMDE_FLOAT16_VALUE(    43.66), SIMDE_FLOAT16_VALUE(    -81.8),
+        SIMDE_FLOAT16_VALUE(   -25.98), SIMDE_FLOAT16_VALUE(   -29.98), SIMDE_FLOAT16_VALUE(    32.53), SIMDE_FLOAT16_VALUE(   -36.12),
+        SIMDE_FLOAT16_VALUE(     66.3), SIMDE_FLOAT16_VALUE(   -16.83), SIMDE_FLOAT16_VALUE(   -85.75), SIMDE_FLOAT16_VALUE(    17.19),
+        SIMDE_FLOAT16_VALUE(    -54.5), SIMDE_FLOAT16_VALUE(    -8.89), SIMDE_FLOAT16_VALUE(    -96.8), SIMDE_FLOAT16_VALUE(   -81.44) },
+      { SIMDE_FLOAT16_VALUE(     48.4), SIMDE_FLOAT16_VALUE(    -37.8), SIMDE_FLOAT16_VALUE(    -81.2), SIMDE_FLOAT16_VALUE(     24.9),
+        SIMDE_FLOAT16_VALUE(    60.88), SIMDE_FLOAT16_VALUE(    -92.7), SIMDE_FLOAT16_VALUE(    -95.3), SIMDE_FLOAT16_VALUE(   -65.44),
+        SIMDE_FLOAT16_VALUE(     43.5), SIMDE_FLOAT16_VALUE(    63.56), SIMDE_FLOAT16_VALUE(   -61.75), SIMDE_FLOAT16_VALUE(   -124.1),
+        SIMDE_FLOAT16_VALUE(   -20.25), SIMDE_FLOAT16_VALUE(    -58.4), SIMDE_FLOAT16_VALUE(   -27.66), SIMDE_FLOAT16_VALUE(  -13.586),
+        SIMDE_FLOAT16_VALUE(    67.06), SIMDE_FLOAT16_VALUE(    41.84), SIMDE_FLOAT16_VALUE(    -54.6), SIMDE_FLOAT16_VALUE(      7.4),
+        SIMDE_FLOAT16_VALUE(   -49.16), SIMDE_FLOAT16_VALUE(   -50.47), SIMDE_FLOAT16_VALUE(    27.89), SIMDE_FLOAT16_VALUE(    30.73),
+        SIMDE_FLOAT16_VALUE(    95.44), SIMDE_FLOAT16_VALUE(    5.188), SIMDE_FLOAT16_VALUE(    2.938), SIMDE_FLOAT16_VALUE(    58.03),
+        SIMDE_FLOAT16_VALUE(    -89.4), SIMDE_FLOAT16_VALUE(    23.72), SIMDE_FLOAT16_VALUE(     35.5), SIMDE_FLOAT16_VALUE(    -81.1) } },
+    { { SIMDE_FLOAT16_VALUE(   -14.27), SIMDE_FLOAT16_VALUE(     85.9), SIMDE_FLOAT16_VALUE(   -31.75), SIMDE_FLOAT16_VALUE(    -80.9),
+        SIMDE_FLOAT16_VALUE(    94.56), SIMDE_FLOAT16_VALUE(    10.51), SIMDE_FLOAT16_VALUE(    19.67), SIMDE_FLOAT16_VALUE(    -42.0),
+        SIMDE_FLOAT16_VALUE(  -13.445), SIMDE_FLOAT16_VALUE(    9.836), SIMDE_FLOAT16_VALUE(   -54.22), SIMDE_FLOAT16_VALUE(     66.2),
+        SIMDE_FLOAT16_VALUE(   -85.75), SIMDE_FLOAT16_VALUE(     98.3), SIMDE_FLOAT16_VALUE(    12.35), SIMDE_FLOAT16_VALUE(   -20.14),
+        SIMDE_FLOAT16_VALUE(    -95.8), SIMDE_FLOAT16_VALUE(   -99.44), SIMDE_FLOAT16_VALUE(   -4.324), SIMDE_FLOAT16_VALUE(    43.38),
+        SIMDE_FLOAT16_VALUE(    -84.8), SIMDE_FLOAT16_VALUE(    61.72), SIMDE_FLOAT16_VALUE(   -93.56), SIMDE_FLOAT16_VALUE(   -22.45),
+        SIMDE_FLOAT16_VALUE(   -57.34), SIMDE_FLOAT16_VALUE(   -3.686), SIMDE_FLOAT16_VALUE(    -78.6), SIMDE_FLOAT16_VALUE(    -41.3),
+        SIMDE_FLOAT16_VALUE(  -12.664), SIMDE_FLOAT16_VALUE(     78.2), SIMDE_FLOAT16_VALUE(    16.86), SIMDE_FLOAT16_VALUE(     73.9) },
+      UINT32_C(2550276150),
+      { SIMDE_FLOAT16_VALUE(   -21.11), SIMDE_FLOAT16_VALUE(    29.81), SIMDE_FLOAT16_VALUE(     73.3), SIMDE_FLOAT16_VALUE(     78.1),
+        SIMDE_FLOAT16_VALUE(    -98.5), SIMDE_FLOAT16_VALUE(    41.03), SIMDE_FLOAT16_VALUE(   -56.84), SIMDE_FLOAT16_VALUE(    60.06),
+        SIMDE_FLOAT16_VALUE(   -51.25), SIMDE_FLOAT16_VALUE(     7.92), SIMDE_FLOAT16_VALUE(    -86.8), SIMDE_FLOAT16_VALUE(     64.7),
+        SIMDE_FLOAT16_VALUE(    31.94), SIMDE_FLOAT16_VALUE(    -68.1), SIMDE_FLOAT16_VALUE(     93.6), SIMDE_FLOAT16_VALUE(   -73.56),
+        SIMDE_FLOAT16_VALUE(    -85.4), SIMDE_FLOAT16_VALUE(   -31.95), SIMDE_FLOAT16_VALUE(   -88.25), SIMDE_FLOAT16_VALUE(    -55.3),
+        SIMDE_FLOAT16_VALUE(    -47.7), SIMDE_FLOAT16_VALUE(    25.47), SIMDE_FLOAT16_VALUE(   -81.25), SIMDE_FLOAT16_VALUE(    90.44),
+        SIMDE_FLOAT16_VALUE(   -28.73), SIMDE_FLOAT16_VALUE(    -69.8), SIMDE_FLOAT16_VALUE(     46.5), SIMDE_FLOAT16_VALUE(   -95.56),
+        SIMDE_FLOAT16_VALUE(   -16.98), SIMDE_FLOAT16_VALUE(    29.84), SIMDE_FLOAT16_VALUE(     95.4), SIMDE_FLOAT16_VALUE(   -10.21) },
+      { SIMDE_FLOAT16_VALUE(    -77.4), SIMDE_FLOAT16_VALUE(     67.6), SIMDE_FLOAT16_VALUE(     80.4), SIMDE_FLOAT16_VALUE(    59.97),
+        SIMDE_FLOAT16_VALUE(    -80.0), SIMDE_FLOAT16_VALUE(   -77.25), SIMDE_FLOAT16_VALUE(   -96.56), SIMDE_FLOAT16_VALUE(    22.75),
+        SIMDE_FLOAT16_VALUE(    -53.7), SIMDE_FLOAT16_VALUE(     72.6), SIMDE_FLOAT16_VALUE(   -1.641), SIMDE_FLOAT16_VALUE(   -29.14),
+        SIMDE_FLOAT16_VALUE(   -11.68), SIMDE_FLOAT16_VALUE(    42.88), SIMDE_FLOAT16_VALUE(   -88.75), SIMDE_FLOAT16_VALUE(   -28.11),
+        SIMDE_FLOAT16_VALUE(   -1.151), SIMDE_FLOAT16_VALUE(   -51.53), SIMDE_FLOAT16_VALUE(    -45.9), SIMDE_FLOAT16_VALUE(  -0.2094),
+        SIMDE_FLOAT16_VALUE(    2.219), SIMDE_FLOAT16_VALUE(    11.49), SIMDE_FLOAT16_VALUE(    26.88), SIMDE_FLOAT16_VALUE(    54.47),
+        SIMDE_FLOAT16_VALUE(     66.3), SIMDE_FLOAT16_VALUE(   -51.12), SIMDE_FLOAT16_VALUE(   -45.72), SIMDE_FLOAT16_VALUE(    -29.3),
+        SIMDE_FLOAT16_VALUE(    41.88), SIMDE_FLOAT16_VALUE(     35.5), SIMDE_FLOAT16_VALUE(     26.2), SIMDE_FLOAT16_VALUE(    -46.8) },
+      { SIMDE_FLOAT16_VALUE(   -14.27), SIMDE_FLOAT16_VALUE(    97.44), SIMDE_FLOAT16_VALUE(    153.8), SIMDE_FLOAT16_VALUE(    -80.9),
+        SIMDE_FLOAT16_VALUE(   -178.5), SIMDE_FLOAT16_VALUE(   -36.22), SIMDE_FLOAT16_VALUE(    19.67), SIMDE_FLOAT16_VALUE(    -42.0),
+        SIMDE_FLOAT16_VALUE(  -13.445), SIMDE_FLOAT16_VALUE(    9.836), SIMDE_FLOAT16_VALUE(   -54.22), SIMDE_FLOAT16_VALUE(     66.2),
+        SIMDE_FLOAT16_VALUE(   -85.75), SIMDE_FLOAT16_VALUE(   -25.25), SIMDE_FLOAT16_VALUE(    12.35), SIMDE_FLOAT16_VALUE(   -20.14),
+        SIMDE_FLOAT16_VALUE(    -95.8), SIMDE_FLOAT16_VALUE(    -83.5), SIMDE_FLOAT16_VALUE(   -4.324), SIMDE_FLOAT16_VALUE(    43.38),
+        SIMDE_FLOAT16_VALUE(    -84.8), SIMDE_FLOAT16_VALUE(    61.72), SIMDE_FLOAT16_VALUE(   -93.56), SIMDE_FLOAT16_VALUE(   -22.45),
+        SIMDE_FLOAT16_VALUE(   -57.34), SIMDE_FLOAT16_VALUE(   -3.686), SIMDE_FLOAT16_VALUE(    -78.6), SIMDE_FLOAT16_VALUE(   -124.9),
+        SIMDE_FLOAT16_VALUE(    24.89), SIMDE_FLOAT16_VALUE(     78.2), SIMDE_FLOAT16_VALUE(    16.86), SIMDE_FLOAT16_VALUE(   -57.03) } },
+    { { SIMDE_FLOAT16_VALUE(     9.96), SIMDE_FLOAT16_VALUE(    94.06), SIMDE_FLOAT16_VALUE(    51.97), SIMDE_FLOAT16_VALUE(    -29.7),
+        SIMDE_FLOAT16_VALUE(    -50.0), SIMDE_FLOAT16_VALUE(   -81.94), SIMDE_FLOAT16_VALUE(   -12.02), SIMDE_FLOAT16_VALUE(    -36.9),
+        SIMDE_FLOAT16_VALUE(    -36.4), SIMDE_FLOAT16_VALUE(    -81.6), SIMDE_FLOAT16_VALUE(    -70.9), SIMDE_FLOAT16_VALUE(   -73.44),
+        SIMDE_FLOAT16_VALUE(     54.8), SIMDE_FLOAT16_VALUE(     66.3), SIMDE_FLOAT16_VALUE(    -61.7), SIMDE_FLOAT16_VALUE(   -99.56),
+        SIMDE_FLOAT16_VALUE(    83.06), SIMDE_FLOAT16_VALUE(   -55.75), SIMDE_FLOAT16_VALUE(    -37.0), SIMDE_FLOAT16_VALUE(    53.84),
+        SIMDE_FLOAT16_VALUE(   -73.25), SIMDE_FLOAT16_VALUE(    25.11), SIMDE_FLOAT16_VALUE(  -10.586), SIMDE_FLOAT16_VALUE(   -31.92),
+        SIMDE_FLOAT16_VALUE(   -20.83), SIMDE_FLOAT16_VALUE(    -97.7), SIMDE_FLOAT16_VALUE(   -95.44), SIMDE_FLOAT16_VALUE(   -14.61),
+        SIMDE_FLOAT16_VALUE(    55.62), SIMDE_FLOAT16_VALUE(     64.5), SIMDE_FLOAT16_VALUE(    -37.6), SIMDE_FLOAT16_VALUE(  -13.875) },
+      UINT32_C(808332466),
+      { SIMDE_FLOAT16_VALUE(    7.945), SIMDE_FLOAT16_VALUE(     76.1), SIMDE_FLOAT16_VALUE(   15.125), SIMDE_FLOAT16_VALUE(    52.88),
+        SIMDE_FLOAT16_VALUE(    -57.1), SIMDE_FLOAT16_VALUE(    25.78), SIMDE_FLOAT16_VALUE(    53.66), SIMDE_FLOAT16_VALUE(    -79.7),
+        SIMDE_FLOAT16_VALUE(    26.86), SIMDE_FLOAT16_VALUE(     54.7), SIMDE_FLOAT16_VALUE(    -8.44), SIMDE_FLOAT16_VALUE(    53.78),
+        SIMDE_FLOAT16_VALUE(    -9.51), SIMDE_FLOAT16_VALUE(    40.38), SIMDE_FLOAT16_VALUE(    39.66), SIMDE_FLOAT16_VALUE(    77.25),
+        SIMDE_FLOAT16_VALUE(   -89.75), SIMDE_FLOAT16_VALUE(   -12.69), SIMDE_FLOAT16_VALUE(    30.31), SIMDE_FLOAT16_VALUE(   -91.75),
+        SIMDE_FLOAT16_VALUE(    26.97), SIMDE_FLOAT16_VALUE(    75.94), SIMDE_FLOAT16_VALUE(   -74.75), SIMDE_FLOAT16_VALUE(   -49.88),
+        SIMDE_FLOAT16_VALUE(   -71.44), SIMDE_FLOAT16_VALUE(    52.66), SIMDE_FLOAT16_VALUE(    57.66), SIMDE_FLOAT16_VALUE(    18.19),
+        SIMDE_FLOAT16_VALUE(   -26.72), SIMDE_FLOAT16_VALUE(     90.2), SIMDE_FLOAT16_VALUE(    -92.7), SIMDE_FLOAT16_VALUE(  -10.234) },
+      { SIMDE_FLOAT16_VALUE(     89.4), SIMDE_FLOAT16_VALUE(   -55.12), SIMDE_FLOAT16_VALUE(    98.94), SIMDE_FLOAT16_VALUE(   0.2164),
+        SIMDE_FLOAT16_VALUE(    -82.0), SIMDE_FLOAT16_VALUE(   -13.18), SIMDE_FLOAT16_VALUE(   11.664), SIMDE_FLOAT16_VALUE(    82.06),
+        SIMDE_FLOAT16_VALUE(   -65.75), SIMDE_FLOAT16_VALUE(   -47.38), SIMDE_FLOAT16_VALUE(    15.55), SIMDE_FLOAT16_VALUE(   -29.48),
+        SIMDE_FLOAT16_VALUE(     24.4), SIMDE_FLOAT16_VALUE(    6.777), SIMDE_FLOAT16_VALUE(     8.09), SIMDE_FLOAT16_VALUE(    -64.7),
+        SIMDE_FLOAT16_VALUE(   -6.297), SIMDE_FLOAT16_VALUE(   -48.56), SIMDE_FLOAT16_VALUE(     71.1), SIMDE_FLOAT16_VALUE(    24.95),
+        SIMDE_FLOAT16_VALUE(   -94.44), SIMDE_FLOAT16_VALUE(    59.22), SIMDE_FLOAT16_VALUE(    -41.8), SIMDE_FLOAT16_VALUE(    10.56),
+        SIMDE_FLOAT16_VALUE(    -73.7), SIMDE_FLOAT16_VALUE(     87.0), SIMDE_FLOAT16_VALUE(    29.89), SIMDE_FLOAT16_VALUE(     64.6),
+        SIMDE_FLOAT16_VALUE(    -95.6), SIMDE_FLOAT16_VALUE(    -54.6), SIMDE_FLOAT16_VALUE(   -19.89), SIMDE_FLOAT16_VALUE(   -49.47) },
+      { SIMDE_FLOAT16_VALUE(     9.96), SIMDE_FLOAT16_VALUE(     21.0), SIMDE_FLOAT16_VALUE(    51.97), SIMDE_FLOAT16_VALUE(    -29.7),
+        SIMDE_FLOAT16_VALUE(   -139.1), SIMDE_FLOAT16_VALUE(     12.6), SIMDE_FLOAT16_VALUE(   -12.02), SIMDE_FLOAT16_VALUE(    2.375),
+        SIMDE_FLOAT16_VALUE(    -36.4), SIMDE_FLOAT16_VALUE(    -81.6), SIMDE_FLOAT16_VALUE(     7.11), SIMDE_FLOAT16_VALUE(     24.3),
+        SIMDE_FLOAT16_VALUE(     54.8), SIMDE_FLOAT16_VALUE(    47.16), SIMDE_FLOAT16_VALUE(    -61.7), SIMDE_FLOAT16_VALUE(   -99.56),
+        SIMDE_FLOAT16_VALUE(    83.06), SIMDE_FLOAT16_VALUE(   -61.25), SIMDE_FLOAT16_VALUE(   101.44), SIMDE_FLOAT16_VALUE(    -66.8),
+        SIMDE_FLOAT16_VALUE(   -73.25), SIMDE_FLOAT16_VALUE(    135.1), SIMDE_FLOAT16_VALUE(  -10.586), SIMDE_FLOAT16_VALUE(   -31.92),
+        SIMDE_FLOAT16_VALUE(   -20.83), SIMDE_FLOAT16_VALUE(    -97.7), SIMDE_FLOAT16_VALUE(   -95.44), SIMDE_FLOAT16_VALUE(   -14.61),
+        SIMDE_FLOAT16_VALUE(   -122.4), SIMDE_FLOAT16_VALUE(     35.6), SIMDE_FLOAT16_VALUE(    -37.6), SIMDE_FLOAT16_VALUE(  -13.875) } },
+    { { SIMDE_FLOAT16_VALUE(   -98.44), SIMDE_FLOAT16_VALUE(    4.836), SIMDE_FLOAT16_VALUE(     19.1), SIMDE_FLOAT16_VALUE(   -47.53),
+        SIMDE_FLOAT16_VALUE(    36.03), SIMDE_FLOAT16_VALUE(   -4.746), SIMDE_FLOAT16_VALUE(   -41.28), SIMDE_FLOAT16_VALUE(    13.29),
+        SIMDE_FLOAT16_VALUE(     60.8), SIMDE_FLOAT16_VALUE(    25.94), SIMDE_FLOAT16_VALUE(     6.87), SIMDE_FLOAT16_VALUE(     98.9),
+        SIMDE_FLOAT16_VALUE(    -71.0), SIMDE_FLOAT16_VALUE(   -21.23), SIMDE_FLOAT16_VALUE(    -73.6), SIMDE_FLOAT16_VALUE(  -10.875),
+        SIMDE_FLOAT16_VALUE(   -16.77), SIMDE_FLOAT16_VALUE(     42.6), SIMDE_FLOAT16_VALUE(     33.4), SIMDE_FLOAT16_VALUE(    73.75),
+        SIMDE_FLOAT16_VALUE(    96.06), SIMDE_FLOAT16_VALUE(   -67.44), SIMDE_FLOAT16_VALUE(    66.06), SIMDE_FLOAT16_VALUE(   -7.312),
+        SIMDE_FLOAT16_VALUE(    30.33), SIMDE_FLOAT16_VALUE(     89.7), SIMDE_FLOAT16_VALUE(     52.6), SIMDE_FLOAT16_VALUE(   -32.16),
+        SIMDE_FLOAT16_VALUE(   -8.375), SIMDE_FLOAT16_VALUE(    7.777), SIMDE_FLOAT16_VALUE(   -63.62), SIMDE_FLOAT16_VALUE(    5.793) },
+      UINT32_C(1633324798),
+      { SIMDE_FLOAT16_VALUE(   -95.25), SIMDE_FLOAT16_VALUE(    84.44), SIMDE_FLOAT16_VALUE(     85.6), SIMDE_FLOAT16_VALUE(   -43.53),
+        SIMDE_FLOAT16_VALUE(    28.12), SIMDE_FLOAT16_VALUE(    49.84), SIMDE_FLOAT16_VALUE(    44.12), SIMDE_FLOAT16_VALUE(     36.9),
+        SIMDE_FLOAT16_VALUE(     90.7), SIMDE_FLOAT16_VALUE(     22.1), SIMDE_FLOAT16_VALUE(    -96.3), SIMDE_FLOAT16_VALUE(     24.7),
+        SIMDE_FLOAT16_VALUE(    19.81), SIMDE_FLOAT16_VALUE(     41.9), SIMDE_FLOAT16_VALUE(     87.5), SIMDE_FLOAT16_VALUE(    -22.9),
+        SIMDE_FLOAT16_VALUE(    -76.2), SIMDE_FLOAT16_VALUE(     69.9), SIMDE_FLOAT16_VALUE(    -59.0), SIMDE_FLOAT16_VALUE(   -28.48),
+        SIMDE_FLOAT16_VALUE(    -39.6), SIMDE_FLOAT16_VALUE(     43.0), SIMDE_FLOAT16_VALUE(    -85.2), SIMDE_FLOAT16_VALUE(    -92.2),
+        SIMDE_FLOAT16_VALUE(    -83.5), SIMDE_FLOAT16_VALUE(     71.3), SIMDE_FLOAT16_VALUE(    2.945), SIMDE_FLOAT16_VALUE(     45.6),
+        SIMDE_FLOAT16_VALUE(    32.06), SIMDE_FLOAT16_VALUE(     84.3), SIMDE_FLOAT16_VALUE(    -71.7), SIMDE_FLOAT16_VALUE(   -20.27) },
+      { SIMDE_FLOAT16_VALUE(    92.56), SIMDE_FLOAT16_VALUE(   -2.965), SIMDE_FLOAT16_VALUE(   -37.62), SIMDE_FLOAT16_VALUE(    -86.1),
+        SIMDE_FLOAT16_VALUE(     91.5), SIMDE_FLOAT16_VALUE(   -53.34), SIMDE_FLOAT16_VALUE(    -90.0), SIMDE_FLOAT16_VALUE(    94.56),
+        SIMDE_FLOAT16_VALUE(    2.375), SIMDE_FLOAT16_VALUE(    -90.8), SIMDE_FLOAT16_VALUE(   -53.53), SIMDE_FLOAT16_VALUE(   -74.94),
+        SIMDE_FLOAT16_VALUE(     64.5), SIMDE_FLOAT16_VALUE(    89.25), SIMDE_FLOAT16_VALUE(   -38.16), SIMDE_FLOAT16_VALUE(     4.28),
+        SIMDE_FLOAT16_VALUE(    4.656), SIMDE_FLOAT16_VALUE(    40.88), SIMDE_FLOAT16_VALUE(    30.52), SIMDE_FLOAT16_VALUE(   -90.56),
+        SIMDE_FLOAT16_VALUE(    34.75), SIMDE_FLOAT16_VALUE(     94.6), SIMDE_FLOAT16_VALUE(     81.0), SIMDE_FLOAT16_VALUE(    62.34),
+        SIMDE_FLOAT16_VALUE(     95.6), SIMDE_FLOAT16_VALUE(    29.56), SIMDE_FLOAT16_VALUE(   -25.17), SIMDE_FLOAT16_VALUE(    94.25),
+        SIMDE_FLOAT16_VALUE(     75.0), SIMDE_FLOAT16_VALUE(    -44.0), SIMDE_FLOAT16_VALUE(    26.89), SIMDE_FLOAT16_VALUE(     64.0) },
+      { SIMDE_FLOAT16_VALUE(   -98.44), SIMDE_FLOAT16_VALUE(     81.5), SIMDE_FLOAT16_VALUE(     48.0), SIMDE_FLOAT16_VALUE(   -129.6),
+        SIMDE_FLOAT16_VALUE(    119.6), SIMDE_FLOAT16_VALUE(     -3.5), SIMDE_FLOAT16_VALUE(   -45.88), SIMDE_FLOAT16_VALUE(    131.5),
+        SIMDE_FLOAT16_VALUE(     60.8), SIMDE_FLOAT16_VALUE(   -68.75), SIMDE_FLOAT16_VALUE(   -149.9), SIMDE_FLOAT16_VALUE(   -50.25),
+        SIMDE_FLOAT16_VALUE(    -71.0), SIMDE_FLOAT16_VALUE(   -21.23), SIMDE_FLOAT16_VALUE(    -73.6), SIMDE_FLOAT16_VALUE(   -18.62),
+        SIMDE_FLOAT16_VALUE(   -16.77), SIMDE_FLOAT16_VALUE(   110.75), SIMDE_FLOAT16_VALUE(     33.4), SIMDE_FLOAT16_VALUE(  -119.06),
+        SIMDE_FLOAT16_VALUE(   -4.844), SIMDE_FLOAT16_VALUE(   -67.44), SIMDE_FLOAT16_VALUE(   -4.188), SIMDE_FLOAT16_VALUE(   -7.312),
+        SIMDE_FLOAT16_VALUE(   12.125), SIMDE_FLOAT16_VALUE(     89.7), SIMDE_FLOAT16_VALUE(     52.6), SIMDE_FLOAT16_VALUE(   -32.16),
+        SIMDE_FLOAT16_VALUE(   -8.375), SIMDE_FLOAT16_VALUE(     40.3), SIMDE_FLOAT16_VALUE(    -44.8), SIMDE_FLOAT16_VALUE(    5.793) } },
+    { { SIMDE_FLOAT16_VALUE(   -22.31), SIMDE_FLOAT16_VALUE(   -45.56), SIMDE_FLOAT16_VALUE(    50.06), SIMDE_FLOAT16_VALUE(   -49.03),
+        SIMDE_FLOAT16_VALUE(   -37.25), SIMDE_FLOAT16_VALUE(    -67.2), SIMDE_FLOAT16_VALUE(   -58.25), SIMDE_FLOAT16_VALUE(    11.19),
+        SIMDE_FLOAT16_VALUE(   -27.14), SIMDE_FLOAT16_VALUE(    -1.84), SIMDE_FLOAT16_VALUE(   -20.72), SIMDE_FLOAT16_VALUE(    31.55),
+        SIMDE_FLOAT16_VALUE(    -81.1), SIMDE_FLOAT16_VALUE(   -21.53), SIMDE_FLOAT16_VALUE(    -61.4), SIMDE_FLOAT16_VALUE(    3.467),
+        SIMDE_FLOAT16_VALUE(   -63.22), SIMDE_FLOAT16_VALUE(    -54.3), SIMDE_FLOAT16_VALUE(    -73.1), SIMDE_FLOAT16_VALUE(   -63.38),
+        SIMDE_FLOAT16_VALUE(   -10.47), SIMDE_FLOAT16_VALUE(    -74.7), SIMDE_FLOAT16_VALUE(    -11.8), SIMDE_FLOAT16_VALUE(   -14.66),
+        SIMDE_FLOAT16_VALUE(     93.5), SIMDE_FLOAT16_VALUE(     99.3), SIMDE_FLOAT16_VALUE(   -6.504), SIMDE_FLOAT16_VALUE(   -10.76),
+        SIMDE_FLOAT16_VALUE(    31.34), SIMDE_FLOAT16_VALUE(   -52.78), SIMDE_FLOAT16_VALUE(    -64.5), SIMDE_FLOAT16_VALUE(    -85.5) },
+      UINT32_C(1402721627),
+      { SIMDE_FLOAT16_VALUE(    7.867), SIMDE_FLOAT16_VALUE(    61.72), SIMDE_FLOAT16_VALUE(     77.7), SIMDE_FLOAT16_VALUE(     93.6),
+        SIMDE_FLOAT16_VALUE(    0.337), SIMDE_FLOAT16_VALUE(     5.27), SIMDE_FLOAT16_VALUE(    -99.6), SIMDE_FLOAT16_VALUE(    68.25),
+        SIMDE_FLOAT16_VALUE(    84.44), SIMDE_FLOAT16_VALUE(    54.72), SIMDE_FLOAT16_VALUE(     5.71), SIMDE_FLOAT16_VALUE(   -88.44),
+        SIMDE_FLOAT16_VALUE(   -14.55), SIMDE_FLOAT16_VALUE(   -85.44), SIMDE_FLOAT16_VALUE(     6.61), SIMDE_FLOAT16_VALUE(    -83.1),
+        SIMDE_FLOAT16_VALUE(   -35.56), SIMDE_FLOAT16_VALUE(    -97.3), SIMDE_FLOAT16_VALUE(    -91.2), SIMDE_FLOAT16_VALUE(    -24.3),
+        SIMDE_FLOAT16_VALUE(    -59.8), SIMDE_FLOAT16_VALUE(    44.56), SIMDE_FLOAT16_VALUE(    -99.0), SIMDE_FLOAT16_VALUE(    66.94),
+        SIMDE_FLOAT16_VALUE(     71.9), SIMDE_FLOAT16_VALUE(    99.94), SIMDE_FLOAT16_VALUE(   -25.03), SIMDE_FLOAT16_VALUE(   -99.94),
+        SIMDE_FLOAT16_VALUE(    -91.2), SIMDE_FLOAT16_VALUE(     17.3), SIMDE_FLOAT16_VALUE(     43.4), SIMDE_FLOAT16_VALUE(    -34.6) },
+      { SIMDE_FLOAT16_VALUE(     93.8), SIMDE_FLOAT16_VALUE(    -10.6), SIMDE_FLOAT16_VALUE(   -50.72), SIMDE_FLOAT16_VALUE(   -71.25),
+        SIMDE_FLOAT16_VALUE(   -14.82), SIMDE_FLOAT16_VALUE(    89.06), SIMDE_FLOAT16_VALUE(     25.2), SIMDE_FLOAT16_VALUE(     42.3),
+        SIMDE_FLOAT16_VALUE(   -43.78), SIMDE_FLOAT16_VALUE(    20.98), SIMDE_FLOAT16_VALUE(    18.14), SIMDE_FLOAT16_VALUE(     53.5),
+        SIMDE_FLOAT16_VALUE(   -1.172), SIMDE_FLOAT16_VALUE(    -89.7), SIMDE_FLOAT16_VALUE(    47.25), SIMDE_FLOAT16_VALUE(   -91.44),
+        SIMDE_FLOAT16_VALUE(    -75.7), SIMDE_FLOAT16_VALUE(    23.53), SIMDE_FLOAT16_VALUE(    39.56), SIMDE_FLOAT16_VALUE(   12.945),
+        SIMDE_FLOAT16_VALUE(    -66.9), SIMDE_FLOAT16_VALUE(     74.3), SIMDE_FLOAT16_VALUE(   -12.58), SIMDE_FLOAT16_VALUE(   -27.25),
+        SIMDE_FLOAT16_VALUE(    60.62), SIMDE_FLOAT16_VALUE(   -57.25), SIMDE_FLOAT16_VALUE(     94.7), SIMDE_FLOAT16_VALUE(     13.9),
+        SIMDE_FLOAT16_VALUE(     87.2), SIMDE_FLOAT16_VALUE(    -14.4), SIMDE_FLOAT16_VALUE(     81.3), SIMDE_FLOAT16_VALUE(    27.22) },
+      { SIMDE_FLOAT16_VALUE(    101.7), SIMDE_FLOAT16_VALUE(    51.12), SIMDE_FLOAT16_VALUE(    50.06), SIMDE_FLOAT16_VALUE(    22.38),
+        SIMDE_FLOAT16_VALUE(  -14.484), SIMDE_FLOAT16_VALUE(    -67.2), SIMDE_FLOAT16_VALUE(   -74.44), SIMDE_FLOAT16_VALUE(    11.19),
+        SIMDE_FLOAT16_VALUE(    40.66), SIMDE_FLOAT16_VALUE(    -1.84), SIMDE_FLOAT16_VALUE(    23.84), SIMDE_FLOAT16_VALUE(    31.55),
+        SIMDE_FLOAT16_VALUE(   -15.72), SIMDE_FLOAT16_VALUE(   -21.53), SIMDE_FLOAT16_VALUE(    53.88), SIMDE_FLOAT16_VALUE(   -174.5),
+        SIMDE_FLOAT16_VALUE(  -111.25), SIMDE_FLOAT16_VALUE(   -73.75), SIMDE_FLOAT16_VALUE(    -73.1), SIMDE_FLOAT16_VALUE(   -11.35),
+        SIMDE_FLOAT16_VALUE(   -126.7), SIMDE_FLOAT16_VALUE(    -74.7), SIMDE_FLOAT16_VALUE(    -11.8), SIMDE_FLOAT16_VALUE(     39.7),
+        SIMDE_FLOAT16_VALUE(    132.5), SIMDE_FLOAT16_VALUE(     42.7), SIMDE_FLOAT16_VALUE(   -6.504), SIMDE_FLOAT16_VALUE(   -10.76),
+        SIMDE_FLOAT16_VALUE(     -4.0), SIMDE_FLOAT16_VALUE(   -52.78), SIMDE_FLOAT16_VALUE(   124.75), SIMDE_FLOAT16_VALUE(    -85.5) } },
+    { { SIMDE_FLOAT16_VALUE(    36.12), SIMDE_FLOAT16_VALUE(    -70.3), SIMDE_FLOAT16_VALUE(    92.75), SIMDE_FLOAT16_VALUE(    -86.8),
+        SIMDE_FLOAT16_VALUE(     56.3), SIMDE_FLOAT16_VALUE(    19.81), SIMDE_FLOAT16_VALUE(    15.24), SIMDE_FLOAT16_VALUE(    32.66),
+        SIMDE_FLOAT16_VALUE(    -88.6), SIMDE_FLOAT16_VALUE(   -47.62), SIMDE_FLOAT16_VALUE(    32.28), SIMDE_FLOAT16_VALUE(     88.3),
+        SIMDE_FLOAT16_VALUE(     84.3), SIMDE_FLOAT16_VALUE(    55.25), SIMDE_FLOAT16_VALUE(     92.7), SIMDE_FLOAT16_VALUE(    -31.0),
+        SIMDE_FLOAT16_VALUE(   -22.73), SIMDE_FLOAT16_VALUE(    21.94), SIMDE_FLOAT16_VALUE(   -43.44), SIMDE_FLOAT16_VALUE(   -55.56),
+        SIMDE_FLOAT16_VALUE(    -94.7), SIMDE_FLOAT16_VALUE(    61.88), SIMDE_FLOAT16_VALUE(     44.3), SIMDE_FLOAT16_VALUE(     85.3),
+        SIMDE_FLOAT16_VALUE(   -26.75), SIMDE_FLOAT16_VALUE(   -15.77), SIMDE_FLOAT16_VALUE(    5.242), SIMDE_FLOAT16_VALUE(     88.8),
+        SIMDE_FLOAT16_VALUE(   -51.44), SIMDE_FLOAT16_VALUE(   -21.73), SIMDE_FLOAT16_VALUE(    -76.3), SIMDE_FLOAT16_VALUE(    -45.3) },
+      UINT32_C(608073107),
+      { SIMDE_FLOAT16_VALUE(   -16.39), SIMDE_FLOAT16_VALUE(     95.4), SIMDE_FLOAT16_VALUE(   -89.94), SIMDE_FLOAT16_VALUE(      9.0),
+        SIMDE_FLOAT16_VALUE(    32.44), SIMDE_FLOAT16_VALUE(    41.97), SIMDE_FLOAT16_VALUE(    -62.8), SIMDE_FLOAT16_VALUE(   -41.03),
+        SIMDE_FLOAT16_VALUE(    -86.6), SIMDE_FLOAT16_VALUE(   -47.03), SIMDE_FLOAT16_VALUE(   -63.84), SIMDE_FLOAT16_VALUE(    -45.0),
+        SIMDE_FLOAT16_VALUE(   -40.62), SIMDE_FLOAT16_VALUE(    45.12), SIMDE_FLOAT16_VALUE(    31.36), SIMDE_FLOAT16_VALUE(    42.47),
+        SIMDE_FLOAT16_VALUE(    77.25), SIMDE_FLOAT16_VALUE(   -16.08), SIMDE_FLOAT16_VALUE(   -93.06), SIMDE_FLOAT16_VALUE(   -25.86),
+        SIMDE_FLOAT16_VALUE(   -99.94), SIMDE_FLOAT16_VALUE(   -32.28), SIMDE_FLOAT16_VALUE(    53.72), SIMDE_FLOAT16_VALUE(     60.9),
+        SIMDE_FLOAT16_VALUE(    72.56), SIMDE_FLOAT16_VALUE(    -94.8), SIMDE_FLOAT16_VALUE(   -16.17), SIMDE_FLOAT16_VALUE(   -30.12),
+        SIMDE_FLOAT16_VALUE(   -44.78), SIMDE_FLOAT16_VALUE(   -27.92), SIMDE_FLOAT16_VALUE(     78.9), SIMDE_FLOAT16_VALUE(    -68.7) },
+      { SIMDE_FLOAT16_VALUE(    83.94), SIMDE_FLOAT16_VALUE(   -63.75), SIMDE_FLOAT16_VALUE(    -78.9), SIMDE_FLOAT16_VALUE(    25.23),
+        SIMDE_FLOAT16_VALUE(    89.75), SIMDE_FLOAT16_VALUE(     76.4), SIMDE_FLOAT16_VALUE(   -66.56), SIMDE_FLOAT16_VALUE(    -80.1),
+        SIMDE_FLOAT16_VALUE(   0.4688), SIMDE_FLOAT16_VALUE(    -85.7), SIMDE_FLOAT16_VALUE(    -70.9), SIMDE_FLOAT16_VALUE(    68.44),
+        SIMDE_FLOAT16_VALUE(   -44.25), SIMDE_FLOAT16_VALUE(  -14.516), SIMDE_FLOAT16_VALUE(   -78.44), SIMDE_FLOAT16_VALUE(    24.78),
+        SIMDE_FLOAT16_VALUE(     5.47), SIMDE_FLOAT16_VALUE(    54.62), SIMDE_FLOAT16_VALUE(   10.914), SIMDE_FLOAT16_VALUE(    -73.3),
+        SIMDE_FLOAT16_VALUE(    -81.4), SIMDE_FLOAT16_VALUE(    1.909), SIMDE_FLOAT16_VALUE(   -69.44), SIMDE_FLOAT16_VALUE(    -3.94),
+        SIMDE_FLOAT16_VALUE(     81.7), SIMDE_FLOAT16_VALUE(   -24.53), SIMDE_FLOAT16_VALUE(    -45.9), SIMDE_FLOAT16_VALUE(    32.28),
+        SIMDE_FLOAT16_VALUE(   -22.67), SIMDE_FLOAT16_VALUE(   -15.32), SIMDE_FLOAT16_VALUE(   -13.06), SIMDE_FLOAT16_VALUE(    -36.6) },
+      { SIMDE_FLOAT16_VALUE(    67.56), SIMDE_FLOAT16_VALUE(    31.62), SIMDE_FLOAT16_VALUE(    92.75), SIMDE_FLOAT16_VALUE(    -86.8),
+        SIMDE_FLOAT16_VALUE(    122.2), SIMDE_FLOAT16_VALUE(    19.81), SIMDE_FLOAT16_VALUE(    15.24), SIMDE_FLOAT16_VALUE(   -121.1),
+        SIMDE_FLOAT16_VALUE(    -86.1), SIMDE_FLOAT16_VALUE(   -47.62), SIMDE_FLOAT16_VALUE(   -134.8), SIMDE_FLOAT16_VALUE(     88.3),
+        SIMDE_FLOAT16_VALUE(    -84.9), SIMDE_FLOAT16_VALUE(    30.61), SIMDE_FLOAT16_VALUE(   -47.06), SIMDE_FLOAT16_VALUE(    -31.0),
+        SIMDE_FLOAT16_VALUE(   -22.73), SIMDE_FLOAT16_VALUE(    38.56), SIMDE_FLOAT16_VALUE(    -82.1), SIMDE_FLOAT16_VALUE(    -99.2),
+        SIMDE_FLOAT16_VALUE(   -181.2), SIMDE_FLOAT16_VALUE(   -30.38), SIMDE_FLOAT16_VALUE(     44.3), SIMDE_FLOAT16_VALUE(     85.3),
+        SIMDE_FLOAT16_VALUE(   -26.75), SIMDE_FLOAT16_VALUE(   -15.77), SIMDE_FLOAT16_VALUE(   -62.06), SIMDE_FLOAT16_VALUE(     88.8),
+        SIMDE_FLOAT16_VALUE(   -51.44), SIMDE_FLOAT16_VALUE(   -43.25), SIMDE_FLOAT16_VALUE(    -76.3), SIMDE_FLOAT16_VALUE(    -45.3) } },
+    { { SIMDE_FLOAT16_VALUE(   -56.53), SIMDE_FLOAT16_VALUE(   -33.75), SIMDE_FLOAT16_VALUE(   -27.95), SIMDE_FLOAT16_VALUE(   -82.06),
+        SIMDE_FLOAT16_VALUE(    -91.9), SIMDE_FLOAT16_VALUE(    49.53), SIMDE_FLOAT16_VALUE(   -71.75), SIMDE_FLOAT16_VALUE(    -9.64),
+        SIMDE_FLOAT16_VALUE(   -24.53), SIMDE_FLOAT16_VALUE(   -70.06), SIMDE_FLOAT16_VALUE(    10.14), SIMDE_FLOAT16_VALUE(    67.56),
+        SIMDE_FLOAT16_VALUE(    69.25), SIMDE_FLOAT16_VALUE(    39.34), SIMDE_FLOAT16_VALUE(   -23.98), SIMDE_FLOAT16_VALUE(    -85.9),
+        SIMDE_FLOAT16_VALUE(  -15.945), SIMDE_FLOAT16_VALUE(    -84.9), SIMDE_FLOAT16_VALUE(    81.44), SIMDE_FLOAT16_VALUE(   -25.52),
+        SIMDE_FLOAT16_VALUE(    -8.98), SIMDE_FLOAT16_VALUE(     99.5), SIMDE_FLOAT16_VALUE(    0.985), SIMDE_FLOAT16_VALUE(     52.6),
+        SIMDE_FLOAT16_VALUE(   12.305), SIMDE_FLOAT16_VALUE(   -74.94), SIMDE_FLOAT16_VALUE(   -53.47), SIMDE_FLOAT16_VALUE(   -23.33),
+        SIMDE_FLOAT16_VALUE(    65.44), SIMDE_FLOAT16_VALUE(     81.7), SIMDE_FLOAT16_VALUE(    39.88), SIMDE_FLOAT16_VALUE(   -58.28) },
+      UINT32_C(3784187894),
+      { SIMDE_FLOAT16_VALUE(    33.62), SIMDE_FLOAT16_VALUE(    28.08), SIMDE_FLOAT16_VALUE(   -46.72), SIMDE_FLOAT16_VALUE(    20.28),
+        SIMDE_FLOAT16_VALUE(   -43.94), SIMDE_FLOAT16_VALUE(    27.81), SIMDE_FLOAT16_VALUE(     70.4), SIMDE_FLOAT16_VALUE(    16.64),
+        SIMDE_FLOAT16_VALUE(     71.2), SIMDE_FLOAT16_VALUE(    -72.4), SIMDE_FLOAT16_VALUE(    49.16), SIMDE_FLOAT16_VALUE(    57.72),
+        SIMDE_FLOAT16_VALUE(    47.94), SIMDE_FLOAT16_VALUE(    55.12), SIMDE_FLOAT16_VALUE(    39.72), SIMDE_FLOAT16_VALUE(    -78.6),
+        SIMDE_FLOAT16_VALUE(    76.75), SIMDE_FLOAT16_VALUE(    54.22), SIMDE_FLOAT16_VALUE(    -67.3), SIMDE_FLOAT16_VALUE(    20.42),
+        SIMDE_FLOAT16_VALUE(    -17.1), SIMDE_FLOAT16_VALUE(    14.59), SIMDE_FLOAT16_VALUE(  -12.234), SIMDE_FLOAT16_VALUE(   -44.88),
+        SIMDE_FLOAT16_VALUE(    42.66), SIMDE_FLOAT16_VALUE(   -95.75), SIMDE_FLOAT16_VALUE(    39.97), SIMDE_FLOAT16_VALUE(    -70.9),
+        SIMDE_FLOAT16_VALUE(   -22.38), SIMDE_FLOAT16_VALUE(   -52.44), SIMDE_FLOAT16_VALUE(    24.86), SIMDE_FLOAT16_VALUE(    -8.41) },
+      { SIMDE_FLOAT16_VALUE(     5.09), SIMDE_FLOAT16_VALUE(   -51.22), SIMDE_FLOAT16_VALUE(     44.7), SIMDE_FLOAT16_VALUE(     88.6),
+        SIMDE_FLOAT16_VALUE(    54.06), SIMDE_FLOAT16_VALUE(   -2.824), SIMDE_FLOAT16_VALUE(    23.92), SIMDE_FLOAT16_VALUE(   -98.75),
+        SIMDE_FLOAT16_VALUE(   -35.25), SIMDE_FLOAT16_VALUE(    -82.9), SIMDE_FLOAT16_VALUE(    -99.5), SIMDE_FLOAT16_VALUE(    36.84),
+        SIMDE_FLOAT16_VALUE(    -81.3), SIMDE_FLOAT16_VALUE(   -58.12), SIMDE_FLOAT16_VALUE(   -42.66), SIMDE_FLOAT16_VALUE(   -40.84),
+        SIMDE_FLOAT16_VALUE(   -93.44), SIMDE_FLOAT16_VALUE(    -70.5), SIMDE_FLOAT16_VALUE(    13.66), SIMDE_FLOAT16_VALUE(   -3.346),
+        SIMDE_FLOAT16_VALUE(    -46.4), SIMDE_FLOAT16_VALUE(   -39.47), SIMDE_FLOAT16_VALUE(   -49.75), SIMDE_FLOAT16_VALUE(    -44.1),
+        SIMDE_FLOAT16_VALUE(     52.0), SIMDE_FLOAT16_VALUE(    -86.6), SIMDE_FLOAT16_VALUE(    -71.1), SIMDE_FLOAT16_VALUE(    -7.84),
+        SIMDE_FLOAT16_VALUE(   -42.84), SIMDE_FLOAT16_VALUE(    -3.59), SIMDE_FLOAT16_VALUE(    -47.7), SIMDE_FLOAT16_VALUE(     81.0) },
+      { SIMDE_FLOAT16_VALUE(   -56.53), SIMDE_FLOAT16_VALUE(   -23.14), SIMDE_FLOAT16_VALUE(   -2.031), SIMDE_FLOAT16_VALUE(   -82.06),
+        SIMDE_FLOAT16_VALUE(   10.125), SIMDE_FLOAT16_VALUE(    24.98), SIMDE_FLOAT16_VALUE(     94.3), SIMDE_FLOAT16_VALUE(    -82.1),
+        SIMDE_FLOAT16_VALUE(    35.94), SIMDE_FLOAT16_VALUE(   -155.2), SIMDE_FLOAT16_VALUE(   -50.34), SIMDE_FLOAT16_VALUE(    94.56),
+        SIMDE_FLOAT16_VALUE(   -33.38), SIMDE_FLOAT16_VALUE(    39.34), SIMDE_FLOAT16_VALUE(   -23.98), SIMDE_FLOAT16_VALUE(    -85.9),
+        SIMDE_FLOAT16_VALUE(  -15.945), SIMDE_FLOAT16_VALUE(   -16.28), SIMDE_FLOAT16_VALUE(   -53.66), SIMDE_FLOAT16_VALUE(    17.08),
+        SIMDE_FLOAT16_VALUE(    -8.98), SIMDE_FLOAT16_VALUE(     99.5), SIMDE_FLOAT16_VALUE(    0.985), SIMDE_FLOAT16_VALUE(    -89.0),
+        SIMDE_FLOAT16_VALUE(     94.6), SIMDE_FLOAT16_VALUE(   -74.94), SIMDE_FLOAT16_VALUE(   -53.47), SIMDE_FLOAT16_VALUE(   -23.33),
+        SIMDE_FLOAT16_VALUE(    65.44), SIMDE_FLOAT16_VALUE(   -56.03), SIMDE_FLOAT16_VALUE(   -22.83), SIMDE_FLOAT16_VALUE(     72.6) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512h src = simde_mm512_loadu_ph(test_vec[i].src);
+    simde__m512h a = simde_mm512_loadu_ph(test_vec[i].a);
+    simde__m512h b = simde_mm512_loadu_ph(test_vec[i].b);
+    simde__m512h r = simde_mm512_mask_add_ph(src, test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_f16x32(r, simde_mm512_loadu_ph(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm512_maskz_add_ph (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 k;
+    const simde_float16 a[32];
+    const simde_float16 b[32];
+    const simde_float16 r[32];
+  } test_vec[] = {
+    { UINT32_C(2786552634),
+      { SIMDE_FLOAT16_VALUE(    48.06), SIMDE_FLOAT16_VALUE(    12.64), SIMDE_FLOAT16_VALUE(     78.2), SIMDE_FLOAT16_VALUE(   -35.25),
+        SIMDE_FLOAT16_VALUE(    20.84), SIMDE_FLOAT16_VALUE(    12.43), SIMDE_FLOAT16_VALUE(    -77.1), SIMDE_FLOAT16_VALUE(    -42.1),
+        SIMDE_FLOAT16_VALUE(   -30.72), SIMDE_FLOAT16_VALUE(     75.6), SIMDE_FLOAT16_VALUE(    -63.0), SIMDE_FLOAT16_VALUE(   -35.34),
+        SIMDE_FLOAT16_VALUE(    -93.4), SIMDE_FLOAT16_VALUE(    47.75), SIMDE_FLOAT16_VALUE(    -21.3), SIMDE_FLOAT16_VALUE(     83.4),
+        SIMDE_FLOAT16_VALUE(   -22.86), SIMDE_FLOAT16_VALUE(    74.94), SIMDE_FLOAT16_VALUE(   -25.48), SIMDE_FLOAT16_VALUE(    -71.2),
+        SIMDE_FLOAT16_VALUE(   -60.38), SIMDE_FLOAT16_VALUE(    -80.7), SIMDE_FLOAT16_VALUE(   -24.56), SIMDE_FLOAT16_VALUE(     54.6),
+        SIMDE_FLOAT16_VALUE(   -24.31), SIMDE_FLOAT16_VALUE(   -28.88), SIMDE_FLOAT16_VALUE(   -15.91), SIMDE_FLOAT16_VALUE(   -49.72),
+        SIMDE_FLOAT16_VALUE(     38.6), SIMDE_FLOAT16_VALUE(   -51.06), SIMDE_FLOAT16_VALUE(   -77.25), SIMDE_FLOAT16_VALUE(   -27.53) },
+      { SIMDE_FLOAT16_VALUE(    92.44), SIMDE_FLOAT16_VALUE(     45.3), SIMDE_FLOAT16_VALUE(   -79.94), SIMDE_FLOAT16_VALUE(    17.92),
+        SIMDE_FLOAT16_VALUE(    31.88), SIMDE_FLOAT16_VALUE(   -64.25), SIMDE_FLOAT16_VALUE(    -66.2), SIMDE_FLOAT16_VALUE(    -66.8),
+        SIMDE_FLOAT16_VALUE(    -78.0), SIMDE_FLOAT16_VALUE(   -50.28), SIMDE_FLOAT16_VALUE(    -26.4), SIMDE_FLOAT16_VALUE(    82.56),
+        SIMDE_FLOAT16_VALUE(    39.84), SIMDE_FLOAT16_VALUE(    70.25), SIMDE_FLOAT16_VALUE(    39.12), SIMDE_FLOAT16_VALUE(    -84.0),
+        SIMDE_FLOAT16_VALUE(    95.25), SIMDE_FLOAT16_VALUE(     8.41), SIMDE_FLOAT16_VALUE(   -58.62), SIMDE_FLOAT16_VALUE(     56.7),
+        SIMDE_FLOAT16_VALUE(    67.75), SIMDE_FLOAT16_VALUE(    6.465), SIMDE_FLOAT16_VALUE(    33.44), SIMDE_FLOAT16_VALUE(   -97.25),
+        SIMDE_FLOAT16_VALUE(    84.56), SIMDE_FLOAT16_VALUE(   -30.27), SIMDE_FLOAT16_VALUE(     75.5), SIMDE_FLOAT16_VALUE(    -85.0),
+        SIMDE_FLOAT16_VALUE(    -89.0), SIMDE_FLOAT16_VALUE(    34.25), SIMDE_FLOAT16_VALUE(    -87.1), SIMDE_FLOAT16_VALUE(     8.76) },
+      { SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(    57.94), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(   -17.33),
+        SIMDE_FLOAT16_VALUE(    52.72), SIMDE_FLOAT16_VALUE(    -51.8), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(  -108.75), SIMDE_FLOAT16_VALUE(    25.34), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(    47.22),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(    118.0), SIMDE_FLOAT16_VALUE(    17.83), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(     72.4), SIMDE_FLOAT16_VALUE(     83.4), SIMDE_FLOAT16_VALUE(    -84.1), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(    7.375), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(   -59.12), SIMDE_FLOAT16_VALUE(     59.6), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(   -16.81), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(   -18.78) } },
+    { UINT32_C(580022751),
+      { SIMDE_FLOAT16_VALUE(     89.8), SIMDE_FLOAT16_VALUE(   -81.75), SIMDE_FLOAT16_VALUE(    2.281), SIMDE_FLOAT16_VALUE(     92.1),
+        SIMDE_FLOAT16_VALUE(   -38.94), SIMDE_FLOAT16_VALUE(     41.9), SIMDE_FLOAT16_VALUE(   -37.88), SIMDE_FLOAT16_VALUE(    -90.5),
+        SIMDE_FLOAT16_VALUE(     50.0), SIMDE_FLOAT16_VALUE(    -79.1), SIMDE_FLOAT16_VALUE(   -70.44), SIMDE_FLOAT16_VALUE(   -58.47),
+        SIMDE_FLOAT16_VALUE(    68.94), SIMDE_FLOAT16_VALUE(     56.9), SIMDE_FLOAT16_VALUE(    -70.8), SIMDE_FLOAT16_VALUE(    64.94),
+        SIMDE_FLOAT16_VALUE(    -59.4), SIMDE_FLOAT16_VALUE(   -90.25), SIMDE_FLOAT16_VALUE(     91.7), SIMDE_FLOAT16_VALUE(    74.44),
+        SIMDE_FLOAT16_VALUE(      6.7), SIMDE_FLOAT16_VALUE(     22.8), SIMDE_FLOAT16_VALUE(   -81.25), SIMDE_FLOAT16_VALUE(    79.56),
+        SIMDE_FLOAT16_VALUE(   -10.08), SIMDE_FLOAT16_VALUE(   -2.086), SIMDE_FLOAT16_VALUE(   -17.02), SIMDE_FLOAT16_VALUE(     88.0),
+        SIMDE_FLOAT16_VALUE(     88.5), SIMDE_FLOAT16_VALUE(     -8.0), SIMDE_FLOAT16_VALUE(    4.297), SIMDE_FLOAT16_VALUE(    37.56) },
+      { SIMDE_FLOAT16_VALUE(    29.45), SIMDE_FLOAT16_VALUE(   -68.44), SIMDE_FLOAT16_VALUE(    15.71), SIMDE_FLOAT16_VALUE(    21.61),
+        SIMDE_FLOAT16_VALUE(   -43.28), SIMDE_FLOAT16_VALUE(    -31.8), SIMDE_FLOAT16_VALUE(   -99.75), SIMDE_FLOAT16_VALUE(    -0.67),
+        SIMDE_FLOAT16_VALUE(    11.32), SIMDE_FLOAT16_VALUE(     99.2), SIMDE_FLOAT16_VALUE(    -88.5), SIMDE_FLOAT16_VALUE(    95.75),
+        SIMDE_FLOAT16_VALUE(   -44.16), SIMDE_FLOAT16_VALUE(   -14.18), SIMDE_FLOAT16_VALUE(     66.2), SIMDE_FLOAT16_VALUE(   -2.176),
+        SIMDE_FLOAT16_VALUE(    52.66), SIMDE_FLOAT16_VALUE(   -13.92), SIMDE_FLOAT16_VALUE(    39.84), SIMDE_FLOAT16_VALUE(    49.66),
+        SIMDE_FLOAT16_VALUE(  -0.3655), SIMDE_FLOAT16_VALUE(   -53.72), SIMDE_FLOAT16_VALUE(    -62.9), SIMDE_FLOAT16_VALUE(     49.9),
+        SIMDE_FLOAT16_VALUE(    -82.7), SIMDE_FLOAT16_VALUE(   -38.22), SIMDE_FLOAT16_VALUE(    -56.6), SIMDE_FLOAT16_VALUE(    6.375),
+        SIMDE_FLOAT16_VALUE(     79.4), SIMDE_FLOAT16_VALUE(     66.9), SIMDE_FLOAT16_VALUE(   -11.12), SIMDE_FLOAT16_VALUE(    37.56) },
+      { SIMDE_FLOAT16_VALUE(   119.25), SIMDE_FLOAT16_VALUE(   -150.2), SIMDE_FLOAT16_VALUE(     18.0), SIMDE_FLOAT16_VALUE(   113.75),
+        SIMDE_FLOAT16_VALUE(   -82.25), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(   -137.6), SIMDE_FLOAT16_VALUE(    -91.2),
+        SIMDE_FLOAT16_VALUE(     61.3), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(    24.78), SIMDE_FLOAT16_VALUE(    42.72), SIMDE_FLOAT16_VALUE(   -4.625), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(   -104.2), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(    6.332), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(    129.5),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(    -40.3), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(    58.88), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0) } },
+    { UINT32_C(330575963),
+      { SIMDE_FLOAT16_VALUE(   -16.61), SIMDE_FLOAT16_VALUE(    61.97), SIMDE_FLOAT16_VALUE(    18.33), SIMDE_FLOAT16_VALUE(    -32.0),
+        SIMDE_FLOAT16_VALUE(   -71.56), SIMDE_FLOAT16_VALUE(    -62.5), SIMDE_FLOAT16_VALUE(     99.8), SIMDE_FLOAT16_VALUE(     54.3),
+        SIMDE_FLOAT16_VALUE(    57.66), SIMDE_FLOAT16_VALUE(   -35.44), SIMDE_FLOAT16_VALUE(     80.6), SIMDE_FLOAT16_VALUE(    -28.2),
+        SIMDE_FLOAT16_VALUE(     90.7), SIMDE_FLOAT16_VALUE(   -18.42), SIMDE_FLOAT16_VALUE(    16.92), SIMDE_FLOAT16_VALUE(     58.7),
+        SIMDE_FLOAT16_VALUE(    -83.2), SIMDE_FLOAT16_VALUE(    -79.6), SIMDE_FLOAT16_VALUE(    2.643), SIMDE_FLOAT16_VALUE(   -40.66),
+        SIMDE_FLOAT16_VALUE(     99.2), SIMDE_FLOAT16_VALUE(    39.88), SIMDE_FLOAT16_VALUE(   -60.62), SIMDE_FLOAT16_VALUE(    51.34),
+        SIMDE_FLOAT16_VALUE(    57.84), SIMDE_FLOAT16_VALUE(   -63.38), SIMDE_FLOAT16_VALUE(    6.715), SIMDE_FLOAT16_VALUE(     39.0),
+        SIMDE_FLOAT16_VALUE(    -91.9), SIMDE_FLOAT16_VALUE(    28.98), SIMDE_FLOAT16_VALUE(    -95.5), SIMDE_FLOAT16_VALUE(     47.8) },
+      { SIMDE_FLOAT16_VALUE(    -95.4), SIMDE_FLOAT16_VALUE(    -97.3), SIMDE_FLOAT16_VALUE(     96.2), SIMDE_FLOAT16_VALUE(    -44.1),
+        SIMDE_FLOAT16_VALUE(   -58.78), SIMDE_FLOAT16_VALUE(    23.44), SIMDE_FLOAT16_VALUE(     16.1), SIMDE_FLOAT16_VALUE(   -89.25),
+        SIMDE_FLOAT16_VALUE(    -62.1), SIMDE_FLOAT16_VALUE(    23.03), SIMDE_FLOAT16_VALUE(   -71.56), SIMDE_FLOAT16_VALUE(    -42.7),
+        SIMDE_FLOAT16_VALUE(   14.195), SIMDE_FLOAT16_VALUE(     69.8), SIMDE_FLOAT16_VALUE(    21.05), SIMDE_FLOAT16_VALUE(    56.47),
+        SIMDE_FLOAT16_VALUE(    2.963), SIMDE_FLOAT16_VALUE(    -93.8), SIMDE_FLOAT16_VALUE(    38.78), SIMDE_FLOAT16_VALUE(     20.2),
+        SIMDE_FLOAT16_VALUE(    -67.8), SIMDE_FLOAT16_VALUE(     75.7), SIMDE_FLOAT16_VALUE(  -0.8325), SIMDE_FLOAT16_VALUE(    5.094),
+        SIMDE_FLOAT16_VALUE(    38.88), SIMDE_FLOAT16_VALUE(    18.16), SIMDE_FLOAT16_VALUE(   -8.414), SIMDE_FLOAT16_VALUE(    -53.8),
+        SIMDE_FLOAT16_VALUE(   -21.33), SIMDE_FLOAT16_VALUE(   -26.36), SIMDE_FLOAT16_VALUE(    56.06), SIMDE_FLOAT16_VALUE(    -8.52) },
+      { SIMDE_FLOAT16_VALUE(   -112.0), SIMDE_FLOAT16_VALUE(   -35.34), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(    -76.1),
+        SIMDE_FLOAT16_VALUE(   -130.4), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(    115.9), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(    104.9), SIMDE_FLOAT16_VALUE(    51.38), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(    41.44), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(    31.38), SIMDE_FLOAT16_VALUE(   115.56), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(    56.44),
+        SIMDE_FLOAT16_VALUE(    96.75), SIMDE_FLOAT16_VALUE(   -45.22), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(   -113.2), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0) } },
+    { UINT32_C(2959067),
+      { SIMDE_FLOAT16_VALUE(   -57.22), SIMDE_FLOAT16_VALUE(     66.0), SIMDE_FLOAT16_VALUE(    12.95), SIMDE_FLOAT16_VALUE(   -51.34),
+        SIMDE_FLOAT16_VALUE(     97.8), SIMDE_FLOAT16_VALUE(   -11.08), SIMDE_FLOAT16_VALUE(   -98.25), SIMDE_FLOAT16_VALUE(    -98.9),
+        SIMDE_FLOAT16_VALUE(    24.36), SIMDE_FLOAT16_VALUE(     28.1), SIMDE_FLOAT16_VALUE(   -16.58), SIMDE_FLOAT16_VALUE(   -62.53),
+        SIMDE_FLOAT16_VALUE(    16.23), SIMDE_FLOAT16_VALUE(    -99.5), SIMDE_FLOAT16_VALUE(   -92.75), SIMDE_FLOAT16_VALUE(   -5.184),
+        SIMDE_FLOAT16_VALUE(    19.73), SIMDE_FLOAT16_VALUE(     67.9), SIMDE_FLOAT16_VALUE(    -88.7), SIMDE_FLOAT16_VALUE(    35.56),
+        SIMDE_FLOAT16_VALUE(    -27.2), SIMDE_FLOAT16_VALUE(   -51.12), SIMDE_FLOAT16_VALUE(   -61.84), SIMDE_FLOAT16_VALUE(   -31.64),
+        SIMDE_FLOAT16_VALUE(     95.0), SIMDE_FLOAT16_VALUE(   -10.15), SIMDE_FLOAT16_VALUE(   -2.729), SIMDE_FLOAT16_VALUE(    41.12),
+        SIMDE_FLOAT16_VALUE(    88.56), SIMDE_FLOAT16_VALUE(    30.12), SIMDE_FLOAT16_VALUE(     73.1), SIMDE_FLOAT16_VALUE(   -36.88) },
+      { SIMDE_FLOAT16_VALUE(    59.06), SIMDE_FLOAT16_VALUE(    45.06), SIMDE_FLOAT16_VALUE(     12.3), SIMDE_FLOAT16_VALUE(     46.8),
+        SIMDE_FLOAT16_VALUE(   -91.56), SIMDE_FLOAT16_VALUE(    63.78), SIMDE_FLOAT16_VALUE(    34.88), SIMDE_FLOAT16_VALUE(    59.22),
+        SIMDE_FLOAT16_VALUE(   -90.06), SIMDE_FLOAT16_VALUE(    -21.2), SIMDE_FLOAT16_VALUE(    38.16), SIMDE_FLOAT16_VALUE(    6.594),
+        SIMDE_FLOAT16_VALUE(    -18.6), SIMDE_FLOAT16_VALUE(     57.9), SIMDE_FLOAT16_VALUE(     98.4), SIMDE_FLOAT16_VALUE(   -1.521),
+        SIMDE_FLOAT16_VALUE(    -85.9), SIMDE_FLOAT16_VALUE(    -50.2), SIMDE_FLOAT16_VALUE(     65.6), SIMDE_FLOAT16_VALUE(     45.6),
+        SIMDE_FLOAT16_VALUE(    32.72), SIMDE_FLOAT16_VALUE(     22.8), SIMDE_FLOAT16_VALUE(     97.2), SIMDE_FLOAT16_VALUE(   -51.44),
+        SIMDE_FLOAT16_VALUE(     7.48), SIMDE_FLOAT16_VALUE(     53.4), SIMDE_FLOAT16_VALUE(   -4.074), SIMDE_FLOAT16_VALUE(    48.78),
+        SIMDE_FLOAT16_VALUE(    30.88), SIMDE_FLOAT16_VALUE(     88.4), SIMDE_FLOAT16_VALUE(     86.6), SIMDE_FLOAT16_VALUE(    65.75) },
+      { SIMDE_FLOAT16_VALUE(    1.844), SIMDE_FLOAT16_VALUE(   111.06), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(    -4.53),
+        SIMDE_FLOAT16_VALUE(     6.25), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(   -63.38), SIMDE_FLOAT16_VALUE(   -39.66),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(     6.89), SIMDE_FLOAT16_VALUE(    21.58), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(    -41.6), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(    -66.1), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(   -23.06), SIMDE_FLOAT16_VALUE(     81.1),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(   -28.33), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0) } },
+    { UINT32_C(4133208830),
+      { SIMDE_FLOAT16_VALUE(     89.2), SIMDE_FLOAT16_VALUE(     94.7), SIMDE_FLOAT16_VALUE(   -2.043), SIMDE_FLOAT16_VALUE(    73.56),
+        SIMDE_FLOAT16_VALUE(   -99.94), SIMDE_FLOAT16_VALUE(     53.2), SIMDE_FLOAT16_VALUE(    37.28), SIMDE_FLOAT16_VALUE(    25.39),
+        SIMDE_FLOAT16_VALUE(   -51.03), SIMDE_FLOAT16_VALUE(     8.95), SIMDE_FLOAT16_VALUE(     34.9), SIMDE_FLOAT16_VALUE(    -49.2),
+        SIMDE_FLOAT16_VALUE(   -36.53), SIMDE_FLOAT16_VALUE(   -13.83), SIMDE_FLOAT16_VALUE(   -39.44), SIMDE_FLOAT16_VALUE(    10.48),
+        SIMDE_FLOAT16_VALUE(    96.94), SIMDE_FLOAT16_VALUE(     97.4), SIMDE_FLOAT16_VALUE(    37.94), SIMDE_FLOAT16_VALUE(   -23.84),
+        SIMDE_FLOAT16_VALUE(     90.9), SIMDE_FLOAT16_VALUE(   -88.94), SIMDE_FLOAT16_VALUE(   -40.25), SIMDE_FLOAT16_VALUE(    36.56),
+        SIMDE_FLOAT16_VALUE(    -65.7), SIMDE_FLOAT16_VALUE(    -59.0), SIMDE_FLOAT16_VALUE(   -48.25), SIMDE_FLOAT16_VALUE(   -98.94),
+        SIMDE_FLOAT16_VALUE(    -65.6), SIMDE_FLOAT16_VALUE(    -94.2), SIMDE_FLOAT16_VALUE(   -67.44), SIMDE_FLOAT16_VALUE(    -69.8) },
+      { SIMDE_FLOAT16_VALUE(   -26.67), SIMDE_FLOAT16_VALUE(     73.2), SIMDE_FLOAT16_VALUE(     20.9), SIMDE_FLOAT16_VALUE(    23.31),
+        SIMDE_FLOAT16_VALUE(    -98.2), SIMDE_FLOAT16_VALUE(    -23.6), SIMDE_FLOAT16_VALUE(    21.03), SIMDE_FLOAT16_VALUE(    63.22),
+        SIMDE_FLOAT16_VALUE(    -73.3), SIMDE_FLOAT16_VALUE(    25.77), SIMDE_FLOAT16_VALUE(   -14.86), SIMDE_FLOAT16_VALUE(    22.94),
+        SIMDE_FLOAT16_VALUE(  -12.734), SIMDE_FLOAT16_VALUE(     94.2), SIMDE_FLOAT16_VALUE(    1.034), SIMDE_FLOAT16_VALUE(    -95.2),
+        SIMDE_FLOAT16_VALUE(    62.56), SIMDE_FLOAT16_VALUE(    22.45), SIMDE_FLOAT16_VALUE(   -22.05), SIMDE_FLOAT16_VALUE(   -18.62),
+        SIMDE_FLOAT16_VALUE(    -44.4), SIMDE_FLOAT16_VALUE(    16.25), SIMDE_FLOAT16_VALUE(    -80.5), SIMDE_FLOAT16_VALUE(     58.0),
+        SIMDE_FLOAT16_VALUE(    -32.6), SIMDE_FLOAT16_VALUE(    39.47), SIMDE_FLOAT16_VALUE(   -25.23), SIMDE_FLOAT16_VALUE(    35.62),
+        SIMDE_FLOAT16_VALUE(   -19.25), SIMDE_FLOAT16_VALUE(   -44.78), SIMDE_FLOAT16_VALUE(   -46.88), SIMDE_FLOAT16_VALUE(    74.56) },
+      { SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(    167.9), SIMDE_FLOAT16_VALUE(    18.86), SIMDE_FLOAT16_VALUE(     96.9),
+        SIMDE_FLOAT16_VALUE(   -198.1), SIMDE_FLOAT16_VALUE(     29.6), SIMDE_FLOAT16_VALUE(     58.3), SIMDE_FLOAT16_VALUE(     88.6),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(    34.72), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(    -38.4), SIMDE_FLOAT16_VALUE(    -84.7),
+        SIMDE_FLOAT16_VALUE(    159.5), SIMDE_FLOAT16_VALUE(    119.8), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(   -42.47),
+        SIMDE_FLOAT16_VALUE(    46.47), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(  -120.75), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(   -19.53), SIMDE_FLOAT16_VALUE(    -73.5), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(    -84.9), SIMDE_FLOAT16_VALUE(   -139.0), SIMDE_FLOAT16_VALUE(   -114.3), SIMDE_FLOAT16_VALUE(     4.75) } },
+    { UINT32_C(2423748444),
+      { SIMDE_FLOAT16_VALUE(   -21.31), SIMDE_FLOAT16_VALUE(    -2.29), SIMDE_FLOAT16_VALUE(    44.97), SIMDE_FLOAT16_VALUE(     87.5),
+        SIMDE_FLOAT16_VALUE(    -98.4), SIMDE_FLOAT16_VALUE(   -66.94), SIMDE_FLOAT16_VALUE(    -20.7), SIMDE_FLOAT16_VALUE(    98.94),
+        SIMDE_FLOAT16_VALUE(    2.994), SIMDE_FLOAT16_VALUE(   -30.88), SIMDE_FLOAT16_VALUE(    68.44), SIMDE_FLOAT16_VALUE(    53.38),
+        SIMDE_FLOAT16_VALUE(    32.72), SIMDE_FLOAT16_VALUE(    -94.9), SIMDE_FLOAT16_VALUE(    85.56), SIMDE_FLOAT16_VALUE(     95.7),
+        SIMDE_FLOAT16_VALUE(   -32.97), SIMDE_FLOAT16_VALUE(    30.23), SIMDE_FLOAT16_VALUE(    55.78), SIMDE_FLOAT16_VALUE(   -16.02),
+        SIMDE_FLOAT16_VALUE(    59.66), SIMDE_FLOAT16_VALUE(    -83.3), SIMDE_FLOAT16_VALUE(  -0.4011), SIMDE_FLOAT16_VALUE(     36.5),
+        SIMDE_FLOAT16_VALUE(    79.25), SIMDE_FLOAT16_VALUE(    10.08), SIMDE_FLOAT16_VALUE(   12.555), SIMDE_FLOAT16_VALUE(    16.34),
+        SIMDE_FLOAT16_VALUE(    11.66), SIMDE_FLOAT16_VALUE(    -37.6), SIMDE_FLOAT16_VALUE(    21.44), SIMDE_FLOAT16_VALUE(     73.4) },
+      { SIMDE_FLOAT16_VALUE(     52.4), SIMDE_FLOAT16_VALUE(    30.42), SIMDE_FLOAT16_VALUE(     82.2), SIMDE_FLOAT16_VALUE(    -35.3),
+        SIMDE_FLOAT16_VALUE(    -69.9), SIMDE_FLOAT16_VALUE(    33.78), SIMDE_FLOAT16_VALUE(     93.9), SIMDE_FLOAT16_VALUE(    21.84),
+        SIMDE_FLOAT16_VALUE(   -82.56), SIMDE_FLOAT16_VALUE(   -37.03), SIMDE_FLOAT16_VALUE(     58.2), SIMDE_FLOAT16_VALUE(    -55.4),
+        SIMDE_FLOAT16_VALUE(    -94.8), SIMDE_FLOAT16_VALUE(   -2.922), SIMDE_FLOAT16_VALUE(   -3.148), SIMDE_FLOAT16_VALUE(    71.25),
+        SIMDE_FLOAT16_VALUE(   -76.44), SIMDE_FLOAT16_VALUE(    76.06), SIMDE_FLOAT16_VALUE(    98.06), SIMDE_FLOAT16_VALUE(     92.3),
+        SIMDE_FLOAT16_VALUE(    30.44), SIMDE_FLOAT16_VALUE(   -85.25), SIMDE_FLOAT16_VALUE(    67.56), SIMDE_FLOAT16_VALUE(     9.08),
+        SIMDE_FLOAT16_VALUE(    43.66), SIMDE_FLOAT16_VALUE(    -32.3), SIMDE_FLOAT16_VALUE(     47.7), SIMDE_FLOAT16_VALUE(   -91.44),
+        SIMDE_FLOAT16_VALUE(     89.4), SIMDE_FLOAT16_VALUE(   -49.47), SIMDE_FLOAT16_VALUE(     47.9), SIMDE_FLOAT16_VALUE(    95.56) },
+      { SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(    127.1), SIMDE_FLOAT16_VALUE(     52.2),
+        SIMDE_FLOAT16_VALUE(   -168.2), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(     73.2), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(   -79.56), SIMDE_FLOAT16_VALUE(    -67.9), SIMDE_FLOAT16_VALUE(    126.6), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(    -62.1), SIMDE_FLOAT16_VALUE(    -97.8), SIMDE_FLOAT16_VALUE(    82.44), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(   -109.4), SIMDE_FLOAT16_VALUE(    106.3), SIMDE_FLOAT16_VALUE(    153.9), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(     90.1), SIMDE_FLOAT16_VALUE(   -168.5), SIMDE_FLOAT16_VALUE(     67.2), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(    101.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(    169.0) } },
+    { UINT32_C(1392574323),
+      { SIMDE_FLOAT16_VALUE(     8.44), SIMDE_FLOAT16_VALUE(    -87.1), SIMDE_FLOAT16_VALUE(    -87.2), SIMDE_FLOAT16_VALUE(   -32.53),
+        SIMDE_FLOAT16_VALUE(     55.0), SIMDE_FLOAT16_VALUE(    29.22), SIMDE_FLOAT16_VALUE(   -14.13), SIMDE_FLOAT16_VALUE(    -43.4),
+        SIMDE_FLOAT16_VALUE(    41.53), SIMDE_FLOAT16_VALUE(    -74.5), SIMDE_FLOAT16_VALUE(    42.72), SIMDE_FLOAT16_VALUE(     67.0),
+        SIMDE_FLOAT16_VALUE(   -56.62), SIMDE_FLOAT16_VALUE(    56.12), SIMDE_FLOAT16_VALUE(    -78.7), SIMDE_FLOAT16_VALUE(   -20.56),
+        SIMDE_FLOAT16_VALUE(   -81.44), SIMDE_FLOAT16_VALUE(     6.65), SIMDE_FLOAT16_VALUE(     60.8), SIMDE_FLOAT16_VALUE(    -96.9),
+        SIMDE_FLOAT16_VALUE(    1.646), SIMDE_FLOAT16_VALUE(   -55.94), SIMDE_FLOAT16_VALUE(    90.75), SIMDE_FLOAT16_VALUE(    -18.5),
+        SIMDE_FLOAT16_VALUE(    16.28), SIMDE_FLOAT16_VALUE(   14.164), SIMDE_FLOAT16_VALUE(    75.75), SIMDE_FLOAT16_VALUE(   0.3516),
+        SIMDE_FLOAT16_VALUE(   -47.38), SIMDE_FLOAT16_VALUE(    -92.1), SIMDE_FLOAT16_VALUE(    77.06), SIMDE_FLOAT16_VALUE(    86.06) },
+      { SIMDE_FLOAT16_VALUE(     64.3), SIMDE_FLOAT16_VALUE(   -50.88), SIMDE_FLOAT16_VALUE(   -1.285), SIMDE_FLOAT16_VALUE(   -25.19),
+        SIMDE_FLOAT16_VALUE(    98.25), SIMDE_FLOAT16_VALUE(    42.12), SIMDE_FLOAT16_VALUE(    -32.7), SIMDE_FLOAT16_VALUE(    -8.44),
+        SIMDE_FLOAT16_VALUE(    -73.5), SIMDE_FLOAT16_VALUE(   -20.66), SIMDE_FLOAT16_VALUE(    -10.9), SIMDE_FLOAT16_VALUE(    10.49),
+        SIMDE_FLOAT16_VALUE(     40.2), SIMDE_FLOAT16_VALUE(    47.62), SIMDE_FLOAT16_VALUE(    22.02), SIMDE_FLOAT16_VALUE(     64.7),
+        SIMDE_FLOAT16_VALUE(   -26.55), SIMDE_FLOAT16_VALUE(   0.1893), SIMDE_FLOAT16_VALUE(   -26.97), SIMDE_FLOAT16_VALUE(    45.44),
+        SIMDE_FLOAT16_VALUE(    26.89), SIMDE_FLOAT16_VALUE(   -6.543), SIMDE_FLOAT16_VALUE(     4.89), SIMDE_FLOAT16_VALUE(    31.88),
+        SIMDE_FLOAT16_VALUE(    51.22), SIMDE_FLOAT16_VALUE(    -51.0), SIMDE_FLOAT16_VALUE(     38.5), SIMDE_FLOAT16_VALUE(    90.06),
+        SIMDE_FLOAT16_VALUE(     70.0), SIMDE_FLOAT16_VALUE(   -16.66), SIMDE_FLOAT16_VALUE(   -34.44), SIMDE_FLOAT16_VALUE(    65.56) },
+      { SIMDE_FLOAT16_VALUE(    72.75), SIMDE_FLOAT16_VALUE(   -138.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(    153.2), SIMDE_FLOAT16_VALUE(     71.4), SIMDE_FLOAT16_VALUE(    -46.8), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(   -31.97), SIMDE_FLOAT16_VALUE(    -95.1), SIMDE_FLOAT16_VALUE(    31.81), SIMDE_FLOAT16_VALUE(     77.5),
+        SIMDE_FLOAT16_VALUE(   -16.44), SIMDE_FLOAT16_VALUE(   103.75), SIMDE_FLOAT16_VALUE(    -56.7), SIMDE_FLOAT16_VALUE(    44.12),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(     67.5), SIMDE_FLOAT16_VALUE(   -36.84), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(    22.62), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(    42.62), SIMDE_FLOAT16_VALUE(      0.0) } },
+    { UINT32_C(1733945785),
+      { SIMDE_FLOAT16_VALUE(    46.12), SIMDE_FLOAT16_VALUE(    -62.8), SIMDE_FLOAT16_VALUE(   -12.71), SIMDE_FLOAT16_VALUE(   -33.94),
+        SIMDE_FLOAT16_VALUE(    77.06), SIMDE_FLOAT16_VALUE(   -28.47), SIMDE_FLOAT16_VALUE(     81.2), SIMDE_FLOAT16_VALUE(    -47.5),
+        SIMDE_FLOAT16_VALUE(    15.93), SIMDE_FLOAT16_VALUE(    -91.3), SIMDE_FLOAT16_VALUE(   -56.12), SIMDE_FLOAT16_VALUE(    53.12),
+        SIMDE_FLOAT16_VALUE(    -70.2), SIMDE_FLOAT16_VALUE(   -23.28), SIMDE_FLOAT16_VALUE(     9.45), SIMDE_FLOAT16_VALUE(    61.22),
+        SIMDE_FLOAT16_VALUE(    -57.3), SIMDE_FLOAT16_VALUE(    48.34), SIMDE_FLOAT16_VALUE(    41.22), SIMDE_FLOAT16_VALUE(    -65.6),
+        SIMDE_FLOAT16_VALUE(     94.8), SIMDE_FLOAT16_VALUE(    -84.1), SIMDE_FLOAT16_VALUE(    -46.4), SIMDE_FLOAT16_VALUE(     70.3),
+        SIMDE_FLOAT16_VALUE(    96.25), SIMDE_FLOAT16_VALUE(   -50.25), SIMDE_FLOAT16_VALUE(    -89.9), SIMDE_FLOAT16_VALUE(     97.1),
+        SIMDE_FLOAT16_VALUE(   -42.34), SIMDE_FLOAT16_VALUE(     86.4), SIMDE_FLOAT16_VALUE(     75.8), SIMDE_FLOAT16_VALUE(    -81.9) },
+      { SIMDE_FLOAT16_VALUE(     66.1), SIMDE_FLOAT16_VALUE(    20.97), SIMDE_FLOAT16_VALUE(    33.47), SIMDE_FLOAT16_VALUE(    -21.6),
+        SIMDE_FLOAT16_VALUE(    28.16), SIMDE_FLOAT16_VALUE(   -55.28), SIMDE_FLOAT16_VALUE(    26.62), SIMDE_FLOAT16_VALUE(   13.164),
+        SIMDE_FLOAT16_VALUE(    53.28), SIMDE_FLOAT16_VALUE(     91.6), SIMDE_FLOAT16_VALUE(   -29.27), SIMDE_FLOAT16_VALUE(    22.97),
+        SIMDE_FLOAT16_VALUE(     57.1), SIMDE_FLOAT16_VALUE(    -44.3), SIMDE_FLOAT16_VALUE(     93.7), SIMDE_FLOAT16_VALUE(    -99.8),
+        SIMDE_FLOAT16_VALUE(    42.75), SIMDE_FLOAT16_VALUE(    32.25), SIMDE_FLOAT16_VALUE(    -88.6), SIMDE_FLOAT16_VALUE(   -7.816),
+        SIMDE_FLOAT16_VALUE(   -85.06), SIMDE_FLOAT16_VALUE(   -42.16), SIMDE_FLOAT16_VALUE(   -26.52), SIMDE_FLOAT16_VALUE(    44.03),
+        SIMDE_FLOAT16_VALUE(   -52.78), SIMDE_FLOAT16_VALUE(    60.94), SIMDE_FLOAT16_VALUE(   -13.15), SIMDE_FLOAT16_VALUE(  -0.1788),
+        SIMDE_FLOAT16_VALUE(    -66.9), SIMDE_FLOAT16_VALUE(    35.25), SIMDE_FLOAT16_VALUE(   -51.97), SIMDE_FLOAT16_VALUE(     85.2) },
+      { SIMDE_FLOAT16_VALUE(   112.25), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(   -55.53),
+        SIMDE_FLOAT16_VALUE(   105.25), SIMDE_FLOAT16_VALUE(   -83.75), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(   -34.34),
+        SIMDE_FLOAT16_VALUE(     69.2), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(     76.1),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(    -67.6), SIMDE_FLOAT16_VALUE(    103.1), SIMDE_FLOAT16_VALUE(    -38.6),
+        SIMDE_FLOAT16_VALUE(   -14.56), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(   -73.44),
+        SIMDE_FLOAT16_VALUE(     9.75), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(   -72.94), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(    43.47), SIMDE_FLOAT16_VALUE(    10.69), SIMDE_FLOAT16_VALUE(   -103.0), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(    121.6), SIMDE_FLOAT16_VALUE(    23.84), SIMDE_FLOAT16_VALUE(      0.0) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512h a = simde_mm512_loadu_ph(test_vec[i].a);
+    simde__m512h b = simde_mm512_loadu_ph(test_vec[i].b);
+    simde__m512h r = simde_mm512_maskz_add_ph(test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_f16x32(r, simde_mm512_loadu_ph(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
 SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_add_epi8)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_add_epi8)
@@ -3351,6 +4260,14 @@ SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_add_pd)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_add_pd)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_add_pd)
+
+  #if defined(SIMDE_FLOAT16_IS_SCALAR)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm_add_ph)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm256_add_ph)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm512_add_ph)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_add_ph)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_add_ph)
+  #endif
 SIMDE_TEST_FUNC_LIST_END
 
 #include <test/x86/avx512/test-avx512-footer.h>
@@ -5958,6 +5958,232 @@ test_simde_mm512_cmp_ph_mask (SIMDE_MUNIT_TEST_ARGS) {
 }
 #endif /* SIMDE_FLOAT16_IS_SCALAR */
 
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm_cmp_ph_mask (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float16 a[8];
+    const simde_float16 b[8];
+    const simde__mmask8 r;
+  } test_vec[] = {
+    { {            SIMDE_NANHF,            SIMDE_NANHF, SIMDE_FLOAT16_VALUE(    929.0), SIMDE_FLOAT16_VALUE(    403.5),
+        SIMDE_FLOAT16_VALUE(    776.5), SIMDE_FLOAT16_VALUE(    201.5), SIMDE_FLOAT16_VALUE(    564.0), SIMDE_FLOAT16_VALUE(   -86.06) },
+      { SIMDE_FLOAT16_VALUE(     66.3),            SIMDE_NANHF,            SIMDE_NANHF, SIMDE_FLOAT16_VALUE(   -577.5),
+        SIMDE_FLOAT16_VALUE(   -682.0), SIMDE_FLOAT16_VALUE(    148.4), SIMDE_FLOAT16_VALUE(   -779.0), SIMDE_FLOAT16_VALUE(   -857.0) },
+      UINT8_C(  0) },
+    { {            SIMDE_NANHF,            SIMDE_NANHF, SIMDE_FLOAT16_VALUE(   -820.0), SIMDE_FLOAT16_VALUE(    410.5),
+        SIMDE_FLOAT16_VALUE(    347.5), SIMDE_FLOAT16_VALUE(   -848.5), SIMDE_FLOAT16_VALUE(   -530.0), SIMDE_FLOAT16_VALUE(    616.0) },
+      { SIMDE_FLOAT16_VALUE(   -527.0),            SIMDE_NANHF,            SIMDE_NANHF, SIMDE_FLOAT16_VALUE(    410.5),
+        SIMDE_FLOAT16_VALUE(    347.5), SIMDE_FLOAT16_VALUE(   -848.5), SIMDE_FLOAT16_VALUE(    429.8), SIMDE_FLOAT16_VALUE(   -144.0) },
+      UINT8_C( 64) },
+    { {            SIMDE_NANHF,            SIMDE_NANHF, SIMDE_FLOAT16_VALUE(   0.4116), SIMDE_FLOAT16_VALUE(   -231.5),
+        SIMDE_FLOAT16_VALUE(   -650.0), SIMDE_FLOAT16_VALUE(    -85.5), SIMDE_FLOAT16_VALUE(   -734.5), SIMDE_FLOAT16_VALUE(   -213.9) },
+      { SIMDE_FLOAT16_VALUE(    829.0),            SIMDE_NANHF,            SIMDE_NANHF, SIMDE_FLOAT16_VALUE(   -925.5),
+        SIMDE_FLOAT16_VALUE(   -753.0), SIMDE_FLOAT16_VALUE(   -291.2), SIMDE_FLOAT16_VALUE(   -734.5), SIMDE_FLOAT16_VALUE(   -213.9) },
+      UINT8_C(192) },
+    { {            SIMDE_NANHF,            SIMDE_NANHF, SIMDE_FLOAT16_VALUE(    177.0), SIMDE_FLOAT16_VALUE(   -167.1),
+        SIMDE_FLOAT16_VALUE(    -79.6), SIMDE_FLOAT16_VALUE(    838.5), SIMDE_FLOAT16_VALUE(   -452.2), SIMDE_FLOAT16_VALUE(    877.5) },
+      { SIMDE_FLOAT16_VALUE(   -99.44),            SIMDE_NANHF,            SIMDE_NANHF, SIMDE_FLOAT16_VALUE(   -167.1),
+        SIMDE_FLOAT16_VALUE(    975.5), SIMDE_FLOAT16_VALUE(   -982.0), SIMDE_FLOAT16_VALUE(   -452.2), SIMDE_FLOAT16_VALUE(   -895.5) },
+      UINT8_C(  7) },
+    { {            SIMDE_NANHF,            SIMDE_NANHF, SIMDE_FLOAT16_VALUE(   -99.44), SIMDE_FLOAT16_VALUE(   -32.72),
+        SIMDE_FLOAT16_VALUE(   -702.5), SIMDE_FLOAT16_VALUE(    729.5), SIMDE_FLOAT16_VALUE(    976.5), SIMDE_FLOAT16_VALUE(   -671.0) },
+      { SIMDE_FLOAT16_VALUE(    788.5),            SIMDE_NANHF,            SIMDE_NANHF, SIMDE_FLOAT16_VALUE(    593.5),
+        SIMDE_FLOAT16_VALUE(    194.8), SIMDE_FLOAT16_VALUE(    729.5), SIMDE_FLOAT16_VALUE(    779.5), SIMDE_FLOAT16_VALUE(   -12.82) },
+      UINT8_C(223) },
+    { {            SIMDE_NANHF,            SIMDE_NANHF, SIMDE_FLOAT16_VALUE(    478.2), SIMDE_FLOAT16_VALUE(   -743.0),
+        SIMDE_FLOAT16_VALUE(    -79.1), SIMDE_FLOAT16_VALUE(   -686.0), SIMDE_FLOAT16_VALUE(    441.8), SIMDE_FLOAT16_VALUE(    669.5) },
+      { SIMDE_FLOAT16_VALUE(    586.0),            SIMDE_NANHF,            SIMDE_NANHF, SIMDE_FLOAT16_VALUE(   -743.0),
+        SIMDE_FLOAT16_VALUE(   -456.8), SIMDE_FLOAT16_VALUE(    156.4), SIMDE_FLOAT16_VALUE(    219.0), SIMDE_FLOAT16_VALUE(    669.5) },
+      UINT8_C(223) },
+    { {            SIMDE_NANHF,            SIMDE_NANHF, SIMDE_FLOAT16_VALUE(    991.0), SIMDE_FLOAT16_VALUE(    803.0),
+        SIMDE_FLOAT16_VALUE(    132.4), SIMDE_FLOAT16_VALUE(   -402.5), SIMDE_FLOAT16_VALUE(    336.0), SIMDE_FLOAT16_VALUE(   -518.5) },
+      { SIMDE_FLOAT16_VALUE(    909.0),            SIMDE_NANHF,            SIMDE_NANHF, SIMDE_FLOAT16_VALUE(   -672.5),
+        SIMDE_FLOAT16_VALUE(    132.4), SIMDE_FLOAT16_VALUE(   -402.5), SIMDE_FLOAT16_VALUE(    -35.4), SIMDE_FLOAT16_VALUE(   -518.5) },
+      UINT8_C( 79) },
+    { {            SIMDE_NANHF,            SIMDE_NANHF, SIMDE_FLOAT16_VALUE(    663.5), SIMDE_FLOAT16_VALUE(   -423.0),
+        SIMDE_FLOAT16_VALUE(    780.0), SIMDE_FLOAT16_VALUE(    515.5), SIMDE_FLOAT16_VALUE(   -600.0), SIMDE_FLOAT16_VALUE(    28.84) },
+      { SIMDE_FLOAT16_VALUE(    864.5),            SIMDE_NANHF,            SIMDE_NANHF, SIMDE_FLOAT16_VALUE(    850.5),
+        SIMDE_FLOAT16_VALUE(   -19.75), SIMDE_FLOAT16_VALUE(   -705.5), SIMDE_FLOAT16_VALUE(   -671.0), SIMDE_FLOAT16_VALUE(    28.84) },
+      UINT8_C(248) }
+  };
+
+  simde__m128h a, b;
+  simde__mmask8 r;
+
+  a = simde_mm_loadu_ph(test_vec[0].a);
+  b = simde_mm_loadu_ph(test_vec[0].b);
+  r = simde_mm_cmp_ph_mask(a, b, SIMDE_CMP_EQ_OQ);
+  simde_assert_equal_mmask8(r, test_vec[0].r);
+
+  a = simde_mm_loadu_ph(test_vec[1].a);
+  b = simde_mm_loadu_ph(test_vec[1].b);
+  r = simde_mm_cmp_ph_mask(a, b, SIMDE_CMP_LT_OS);
+  simde_assert_equal_mmask8(r, test_vec[1].r);
+
+  a = simde_mm_loadu_ph(test_vec[2].a);
+  b = simde_mm_loadu_ph(test_vec[2].b);
+  r = simde_mm_cmp_ph_mask(a, b, SIMDE_CMP_LE_OS);
+  simde_assert_equal_mmask8(r, test_vec[2].r);
+
+  a = simde_mm_loadu_ph(test_vec[3].a);
+  b = simde_mm_loadu_ph(test_vec[3].b);
+  r = simde_mm_cmp_ph_mask(a, b, SIMDE_CMP_UNORD_Q);
+  simde_assert_equal_mmask8(r, test_vec[3].r);
+
+  a = simde_mm_loadu_ph(test_vec[4].a);
+  b = simde_mm_loadu_ph(test_vec[4].b);
+  r = simde_mm_cmp_ph_mask(a, b, SIMDE_CMP_NEQ_UQ);
+  simde_assert_equal_mmask8(r, test_vec[4].r);
+
+  a = simde_mm_loadu_ph(test_vec[5].a);
+  b = simde_mm_loadu_ph(test_vec[5].b);
+  r = simde_mm_cmp_ph_mask(a, b, SIMDE_CMP_NLT_US);
+  simde_assert_equal_mmask8(r, test_vec[5].r);
+
+  a = simde_mm_loadu_ph(test_vec[6].a);
+  b = simde_mm_loadu_ph(test_vec[6].b);
+  r = simde_mm_cmp_ph_mask(a, b, SIMDE_CMP_NLE_US);
+  simde_assert_equal_mmask8(r, test_vec[6].r);
+
+  a = simde_mm_loadu_ph(test_vec[7].a);
+  b = simde_mm_loadu_ph(test_vec[7].b);
+  r = simde_mm_cmp_ph_mask(a, b, SIMDE_CMP_ORD_Q);
+  simde_assert_equal_mmask8(r, test_vec[7].r);
+
+  return 0;
+}
+#endif /* SIMDE_FLOAT16_IS_SCALAR */
+
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm256_cmp_ph_mask (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float16 a[16];
+    const simde_float16 b[16];
+    const simde__mmask16 r;
+  } test_vec[] = {
+    { {            SIMDE_NANHF,            SIMDE_NANHF, SIMDE_FLOAT16_VALUE(   -159.4), SIMDE_FLOAT16_VALUE(    712.0),
+        SIMDE_FLOAT16_VALUE(   -407.2), SIMDE_FLOAT16_VALUE(   -813.0), SIMDE_FLOAT16_VALUE(   -507.0), SIMDE_FLOAT16_VALUE(    138.0),
+        SIMDE_FLOAT16_VALUE(    302.8), SIMDE_FLOAT16_VALUE(    28.42), SIMDE_FLOAT16_VALUE(   -333.8), SIMDE_FLOAT16_VALUE(    832.0),
+        SIMDE_FLOAT16_VALUE(    474.0), SIMDE_FLOAT16_VALUE(   -815.5), SIMDE_FLOAT16_VALUE(    204.0), SIMDE_FLOAT16_VALUE(    910.0) },
+      { SIMDE_FLOAT16_VALUE(    615.0),            SIMDE_NANHF,            SIMDE_NANHF, SIMDE_FLOAT16_VALUE(    395.0),
+        SIMDE_FLOAT16_VALUE(    989.0), SIMDE_FLOAT16_VALUE(    46.78), SIMDE_FLOAT16_VALUE(   -594.5), SIMDE_FLOAT16_VALUE(   -240.4),
+        SIMDE_FLOAT16_VALUE(    302.8), SIMDE_FLOAT16_VALUE(    350.2), SIMDE_FLOAT16_VALUE(    299.2), SIMDE_FLOAT16_VALUE(    702.0),
+        SIMDE_FLOAT16_VALUE(    474.0), SIMDE_FLOAT16_VALUE(    693.0), SIMDE_FLOAT16_VALUE(   -188.4), SIMDE_FLOAT16_VALUE(    651.0) },
+      UINT16_C( 4352) },
+    { {            SIMDE_NANHF,            SIMDE_NANHF, SIMDE_FLOAT16_VALUE(   -86.44), SIMDE_FLOAT16_VALUE(    743.0),
+        SIMDE_FLOAT16_VALUE(    654.5), SIMDE_FLOAT16_VALUE(   -432.8), SIMDE_FLOAT16_VALUE(   -570.0), SIMDE_FLOAT16_VALUE(   -236.8),
+        SIMDE_FLOAT16_VALUE(    981.5), SIMDE_FLOAT16_VALUE(    889.5), SIMDE_FLOAT16_VALUE(   -843.0), SIMDE_FLOAT16_VALUE(   -864.5),
+        SIMDE_FLOAT16_VALUE(   -639.0), SIMDE_FLOAT16_VALUE(    215.9), SIMDE_FLOAT16_VALUE(    504.0), SIMDE_FLOAT16_VALUE(   -58.78) },
+      { SIMDE_FLOAT16_VALUE(   -310.2),            SIMDE_NANHF,            SIMDE_NANHF, SIMDE_FLOAT16_VALUE(    743.0),
+        SIMDE_FLOAT16_VALUE(    477.0), SIMDE_FLOAT16_VALUE(    623.5), SIMDE_FLOAT16_VALUE(   -330.0), SIMDE_FLOAT16_VALUE(   -236.8),
+        SIMDE_FLOAT16_VALUE(   -42.94), SIMDE_FLOAT16_VALUE(    889.5), SIMDE_FLOAT16_VALUE(   -160.1), SIMDE_FLOAT16_VALUE(   -395.5),
+        SIMDE_FLOAT16_VALUE(   -810.5), SIMDE_FLOAT16_VALUE(   -617.0), SIMDE_FLOAT16_VALUE(    504.0), SIMDE_FLOAT16_VALUE(    269.2) },
+      UINT16_C(35936) },
+    { {            SIMDE_NANHF,            SIMDE_NANHF, SIMDE_FLOAT16_VALUE(   -154.4), SIMDE_FLOAT16_VALUE(    645.5),
+        SIMDE_FLOAT16_VALUE(    665.0), SIMDE_FLOAT16_VALUE(   -885.5), SIMDE_FLOAT16_VALUE(    599.0), SIMDE_FLOAT16_VALUE(   -958.0),
+        SIMDE_FLOAT16_VALUE(    939.0), SIMDE_FLOAT16_VALUE(   -426.5), SIMDE_FLOAT16_VALUE(    690.5), SIMDE_FLOAT16_VALUE(    480.8),
+        SIMDE_FLOAT16_VALUE(   -539.0), SIMDE_FLOAT16_VALUE(   -332.0), SIMDE_FLOAT16_VALUE(   -346.2), SIMDE_FLOAT16_VALUE(    153.5) },
+      { SIMDE_FLOAT16_VALUE(    527.5),            SIMDE_NANHF,            SIMDE_NANHF, SIMDE_FLOAT16_VALUE(   -762.0),
+        SIMDE_FLOAT16_VALUE(    665.0), SIMDE_FLOAT16_VALUE(    125.3), SIMDE_FLOAT16_VALUE(    710.0), SIMDE_FLOAT16_VALUE(   -74.44),
+        SIMDE_FLOAT16_VALUE(   -622.5), SIMDE_FLOAT16_VALUE(   -426.5), SIMDE_FLOAT16_VALUE(    690.5), SIMDE_FLOAT16_VALUE(   -265.0),
+        SIMDE_FLOAT16_VALUE(   -461.5), SIMDE_FLOAT16_VALUE(   -365.2), SIMDE_FLOAT16_VALUE(    866.0), SIMDE_FLOAT16_VALUE(    174.4) },
+      UINT16_C(55024) },
+    { {            SIMDE_NANHF,            SIMDE_NANHF, SIMDE_FLOAT16_VALUE(   -849.5), SIMDE_FLOAT16_VALUE(    359.5),
+        SIMDE_FLOAT16_VALUE(  -108.25), SIMDE_FLOAT16_VALUE(   -272.0), SIMDE_FLOAT16_VALUE(    344.5), SIMDE_FLOAT16_VALUE(    185.4),
+        SIMDE_FLOAT16_VALUE(    660.0), SIMDE_FLOAT16_VALUE(   -603.5), SIMDE_FLOAT16_VALUE(   -763.5), SIMDE_FLOAT16_VALUE(    923.5),
+        SIMDE_FLOAT16_VALUE(    212.5), SIMDE_FLOAT16_VALUE(    543.0), SIMDE_FLOAT16_VALUE(    288.0), SIMDE_FLOAT16_VALUE(    874.0) },
+      { SIMDE_FLOAT16_VALUE(   -405.0),            SIMDE_NANHF,            SIMDE_NANHF, SIMDE_FLOAT16_VALUE(    -95.9),
+        SIMDE_FLOAT16_VALUE(  -108.25), SIMDE_FLOAT16_VALUE(   -272.0), SIMDE_FLOAT16_VALUE(    892.5), SIMDE_FLOAT16_VALUE(    990.5),
+        SIMDE_FLOAT16_VALUE(   -341.2), SIMDE_FLOAT16_VALUE(   -885.5), SIMDE_FLOAT16_VALUE(   -524.0), SIMDE_FLOAT16_VALUE(   -514.5),
+        SIMDE_FLOAT16_VALUE(   -559.0), SIMDE_FLOAT16_VALUE(   -619.5), SIMDE_FLOAT16_VALUE(    121.0), SIMDE_FLOAT16_VALUE(    874.0) },
+      UINT16_C(    7) },
+    { {            SIMDE_NANHF,            SIMDE_NANHF, SIMDE_FLOAT16_VALUE(   -140.6), SIMDE_FLOAT16_VALUE(    895.5),
+        SIMDE_FLOAT16_VALUE(    861.0), SIMDE_FLOAT16_VALUE(   -419.5), SIMDE_FLOAT16_VALUE(   -530.5), SIMDE_FLOAT16_VALUE(   -932.5),
+        SIMDE_FLOAT16_VALUE(   -343.2), SIMDE_FLOAT16_VALUE(   -568.5), SIMDE_FLOAT16_VALUE(   -341.0), SIMDE_FLOAT16_VALUE(   -223.8),
+        SIMDE_FLOAT16_VALUE(   -953.5), SIMDE_FLOAT16_VALUE(    761.0), SIMDE_FLOAT16_VALUE(    496.5), SIMDE_FLOAT16_VALUE(    795.0) },
+      { SIMDE_FLOAT16_VALUE(   -164.4),            SIMDE_NANHF,            SIMDE_NANHF, SIMDE_FLOAT16_VALUE(    431.5),
+        SIMDE_FLOAT16_VALUE(    861.0), SIMDE_FLOAT16_VALUE(   -419.5), SIMDE_FLOAT16_VALUE(    10.69), SIMDE_FLOAT16_VALUE(   -932.5),
+        SIMDE_FLOAT16_VALUE(   -451.5), SIMDE_FLOAT16_VALUE(   -568.5), SIMDE_FLOAT16_VALUE(   -341.0), SIMDE_FLOAT16_VALUE(    507.5),
+        SIMDE_FLOAT16_VALUE(    189.9), SIMDE_FLOAT16_VALUE(    761.0), SIMDE_FLOAT16_VALUE(   -219.5), SIMDE_FLOAT16_VALUE(   -1.033) },
+      UINT16_C(55631) },
+    { {            SIMDE_NANHF,            SIMDE_NANHF, SIMDE_FLOAT16_VALUE(    185.0), SIMDE_FLOAT16_VALUE(   -576.0),
+        SIMDE_FLOAT16_VALUE(    205.9), SIMDE_FLOAT16_VALUE(    733.5), SIMDE_FLOAT16_VALUE(   -821.0), SIMDE_FLOAT16_VALUE(   -954.0),
+        SIMDE_FLOAT16_VALUE(    559.5), SIMDE_FLOAT16_VALUE(    517.5), SIMDE_FLOAT16_VALUE(   -694.5), SIMDE_FLOAT16_VALUE(    852.5),
+        SIMDE_FLOAT16_VALUE(   -825.5), SIMDE_FLOAT16_VALUE(    810.0), SIMDE_FLOAT16_VALUE(    421.2), SIMDE_FLOAT16_VALUE(   -201.4) },
+      { SIMDE_FLOAT16_VALUE(   -187.6),            SIMDE_NANHF,            SIMDE_NANHF, SIMDE_FLOAT16_VALUE(   -378.2),
+        SIMDE_FLOAT16_VALUE(   -11.35), SIMDE_FLOAT16_VALUE(   -815.0), SIMDE_FLOAT16_VALUE(   -963.0), SIMDE_FLOAT16_VALUE(   -954.0),
+        SIMDE_FLOAT16_VALUE(    559.5), SIMDE_FLOAT16_VALUE(    964.0), SIMDE_FLOAT16_VALUE(   -88.56), SIMDE_FLOAT16_VALUE(   -484.2),
+        SIMDE_FLOAT16_VALUE(    143.4), SIMDE_FLOAT16_VALUE(   -948.5), SIMDE_FLOAT16_VALUE(   -145.1), SIMDE_FLOAT16_VALUE(   -532.0) },
+      UINT16_C(59895) },
+    { {            SIMDE_NANHF,            SIMDE_NANHF, SIMDE_FLOAT16_VALUE(    789.5), SIMDE_FLOAT16_VALUE(    717.0),
+        SIMDE_FLOAT16_VALUE(   -757.5), SIMDE_FLOAT16_VALUE(    -42.9), SIMDE_FLOAT16_VALUE(    524.5), SIMDE_FLOAT16_VALUE(    459.8),
+        SIMDE_FLOAT16_VALUE(   -518.5), SIMDE_FLOAT16_VALUE(    495.2), SIMDE_FLOAT16_VALUE(    517.5), SIMDE_FLOAT16_VALUE(    838.5),
+        SIMDE_FLOAT16_VALUE(   -442.0), SIMDE_FLOAT16_VALUE(    903.5), SIMDE_FLOAT16_VALUE(    464.0), SIMDE_FLOAT16_VALUE(   -167.1) },
+      { SIMDE_FLOAT16_VALUE(    578.5),            SIMDE_NANHF,            SIMDE_NANHF, SIMDE_FLOAT16_VALUE(    717.0),
+        SIMDE_FLOAT16_VALUE(   -757.5), SIMDE_FLOAT16_VALUE(    -42.9), SIMDE_FLOAT16_VALUE(    524.5), SIMDE_FLOAT16_VALUE(    489.0),
+        SIMDE_FLOAT16_VALUE(    -77.7), SIMDE_FLOAT16_VALUE(    520.0), SIMDE_FLOAT16_VALUE(   -412.8), SIMDE_FLOAT16_VALUE(    294.8),
+        SIMDE_FLOAT16_VALUE(    774.5), SIMDE_FLOAT16_VALUE(    977.0), SIMDE_FLOAT16_VALUE(    464.0), SIMDE_FLOAT16_VALUE(   -783.0) },
+      UINT16_C(35847) },
+    { {            SIMDE_NANHF,            SIMDE_NANHF, SIMDE_FLOAT16_VALUE(    494.0), SIMDE_FLOAT16_VALUE(   -502.8),
+        SIMDE_FLOAT16_VALUE(    515.0), SIMDE_FLOAT16_VALUE(   -278.8), SIMDE_FLOAT16_VALUE(   -585.0), SIMDE_FLOAT16_VALUE(     83.6),
+        SIMDE_FLOAT16_VALUE(   -746.5), SIMDE_FLOAT16_VALUE(   -356.8), SIMDE_FLOAT16_VALUE(   -548.5), SIMDE_FLOAT16_VALUE(    918.5),
+        SIMDE_FLOAT16_VALUE(    86.94), SIMDE_FLOAT16_VALUE(   -772.5), SIMDE_FLOAT16_VALUE(    481.5), SIMDE_FLOAT16_VALUE(   103.56) },
+      { SIMDE_FLOAT16_VALUE(    601.5),            SIMDE_NANHF,            SIMDE_NANHF, SIMDE_FLOAT16_VALUE(    287.8),
+        SIMDE_FLOAT16_VALUE(   -637.0), SIMDE_FLOAT16_VALUE(   -278.8), SIMDE_FLOAT16_VALUE(   -585.0), SIMDE_FLOAT16_VALUE(    149.8),
+        SIMDE_FLOAT16_VALUE(    605.5), SIMDE_FLOAT16_VALUE(    386.8), SIMDE_FLOAT16_VALUE(   -853.0), SIMDE_FLOAT16_VALUE(   -415.2),
+        SIMDE_FLOAT16_VALUE(    86.94), SIMDE_FLOAT16_VALUE(   -772.5), SIMDE_FLOAT16_VALUE(    559.0), SIMDE_FLOAT16_VALUE(   -601.5) },
+      UINT16_C(65528) }
+  };
+
+  simde__m256h a, b;
+  simde__mmask16 r;
+
+  a = simde_mm256_loadu_ph(test_vec[0].a);
+  b = simde_mm256_loadu_ph(test_vec[0].b);
+  r = simde_mm256_cmp_ph_mask(a, b, SIMDE_CMP_EQ_OQ);
+  simde_assert_equal_mmask16(r, test_vec[0].r);
+
+  a = simde_mm256_loadu_ph(test_vec[1].a);
+  b = simde_mm256_loadu_ph(test_vec[1].b);
+  r = simde_mm256_cmp_ph_mask(a, b, SIMDE_CMP_LT_OS);
+  simde_assert_equal_mmask16(r, test_vec[1].r);
+
+  a = simde_mm256_loadu_ph(test_vec[2].a);
+  b = simde_mm256_loadu_ph(test_vec[2].b);
+  r = simde_mm256_cmp_ph_mask(a, b, SIMDE_CMP_LE_OS);
+  simde_assert_equal_mmask16(r, test_vec[2].r);
+
+  a = simde_mm256_loadu_ph(test_vec[3].a);
+  b = simde_mm256_loadu_ph(test_vec[3].b);
+  r = simde_mm256_cmp_ph_mask(a, b, SIMDE_CMP_UNORD_Q);
+  simde_assert_equal_mmask16(r, test_vec[3].r);
+
+  a = simde_mm256_loadu_ph(test_vec[4].a);
+  b = simde_mm256_loadu_ph(test_vec[4].b);
+  r = simde_mm256_cmp_ph_mask(a, b, SIMDE_CMP_NEQ_UQ);
+  simde_assert_equal_mmask16(r, test_vec[4].r);
+
+  a = simde_mm256_loadu_ph(test_vec[5].a);
+  b = simde_mm256_loadu_ph(test_vec[5].b);
+  r = simde_mm256_cmp_ph_mask(a, b, SIMDE_CMP_NLT_US);
+  simde_assert_equal_mmask16(r, test_vec[5].r);
+
+  a = simde_mm256_loadu_ph(test_vec[6].a);
+  b = simde_mm256_loadu_ph(test_vec[6].b);
+  r = simde_mm256_cmp_ph_mask(a, b, SIMDE_CMP_NLE_US);
+  simde_assert_equal_mmask16(r, test_vec[6].r);
+
+  a = simde_mm256_loadu_ph(test_vec[7].a);
+  b = simde_mm256_loadu_ph(test_vec[7].b);
+  r = simde_mm256_cmp_ph_mask(a, b, SIMDE_CMP_ORD_Q);
+  simde_assert_equal_mmask16(r, test_vec[7].r);
+
+  return 0;
+}
+#endif /* SIMDE_FLOAT16_IS_SCALAR */
+
 #endif /* !defined(SIMDE_NATIVE_ALIASES_TESTING */
 
 #endif /* !defined(SIMDE_FAST_MATH) */
@@ -5986,6 +6212,8 @@ SIMDE_TEST_FUNC_LIST_BEGIN
       SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmp_pd_mask)
       #if defined(SIMDE_FLOAT16_IS_SCALAR)
         SIMDE_TEST_FUNC_LIST_ENTRY(mm512_cmp_ph_mask)
+        SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmp_ph_mask)
+        SIMDE_TEST_FUNC_LIST_ENTRY(mm256_cmp_ph_mask)
       #endif
     #endif
   #endif
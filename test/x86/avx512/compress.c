@@ -465,6 +465,30 @@ test_simde_mm256_mask_compress_epi32 (SIMDE_MUNIT_TEST_ARGS) {
       UINT8_C(203),
       {  INT32_C(  1140841903), -INT32_C(   791068105), -INT32_C(  1865752012), -INT32_C(  2107929616),  INT32_C(  1763580924), -INT32_C(   549982571), -INT32_C(   731993679), -INT32_C(  1012985836) },
       {  INT32_C(  1140841903), -INT32_C(   791068105), -INT32_C(  2107929616), -INT32_C(   731993679), -INT32_C(  1012985836), -INT32_C(   797282916),  INT32_C(  1925335757), -INT32_C(  1301666945) } },
+    { { -INT32_C(   370370374),  INT32_C(   740740748), -INT32_C(  1111111122),  INT32_C(  1481481496), -INT32_C(  1851851870), -INT32_C(  2072745052),  INT32_C(  1702374678), -INT32_C(  1332004304) },
+      UINT8_C(  0),
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312) },
+      { -INT32_C(   370370374),  INT32_C(   740740748), -INT32_C(  1111111122),  INT32_C(  1481481496), -INT32_C(  1851851870), -INT32_C(  2072745052),  INT32_C(  1702374678), -INT32_C(  1332004304) } },
+    { { -INT32_C(   370370374),  INT32_C(   740740748), -INT32_C(  1111111122),  INT32_C(  1481481496), -INT32_C(  1851851870), -INT32_C(  2072745052),  INT32_C(  1702374678), -INT32_C(  1332004304) },
+         UINT8_MAX,
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312) },
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312) } },
+    { { -INT32_C(   370370374),  INT32_C(   740740748), -INT32_C(  1111111122),  INT32_C(  1481481496), -INT32_C(  1851851870), -INT32_C(  2072745052),  INT32_C(  1702374678), -INT32_C(  1332004304) },
+      UINT8_C(  1),
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312) },
+      {  INT32_C(   123456789),  INT32_C(   740740748), -INT32_C(  1111111122),  INT32_C(  1481481496), -INT32_C(  1851851870), -INT32_C(  2072745052),  INT32_C(  1702374678), -INT32_C(  1332004304) } },
+    { { -INT32_C(   370370374),  INT32_C(   740740748), -INT32_C(  1111111122),  INT32_C(  1481481496), -INT32_C(  1851851870), -INT32_C(  2072745052),  INT32_C(  1702374678), -INT32_C(  1332004304) },
+      UINT8_C(128),
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312) },
+      { -INT32_C(   987654312),  INT32_C(   740740748), -INT32_C(  1111111122),  INT32_C(  1481481496), -INT32_C(  1851851870), -INT32_C(  2072745052),  INT32_C(  1702374678), -INT32_C(  1332004304) } },
+    { { -INT32_C(   370370374),  INT32_C(   740740748), -INT32_C(  1111111122),  INT32_C(  1481481496), -INT32_C(  1851851870), -INT32_C(  2072745052),  INT32_C(  1702374678), -INT32_C(  1332004304) },
+      UINT8_C(170),
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312) },
+      { -INT32_C(   246913578), -INT32_C(   493827156), -INT32_C(   740740734), -INT32_C(   987654312), -INT32_C(  1851851870), -INT32_C(  2072745052),  INT32_C(  1702374678), -INT32_C(  1332004304) } },
+    { { -INT32_C(   370370374),  INT32_C(   740740748), -INT32_C(  1111111122),  INT32_C(  1481481496), -INT32_C(  1851851870), -INT32_C(  2072745052),  INT32_C(  1702374678), -INT32_C(  1332004304) },
+      UINT8_C(240),
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312) },
+      {  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312), -INT32_C(  1851851870), -INT32_C(  2072745052),  INT32_C(  1702374678), -INT32_C(  1332004304) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -524,6 +548,24 @@ test_simde_mm256_mask_compressstoreu_epi32 (SIMDE_MUNIT_TEST_ARGS) {
     { UINT8_C( 93),
       {  INT32_C(   571745903), -INT32_C(  1731801111),  INT32_C(   306385132),  INT32_C(  1210508381), -INT32_C(   398197757),  INT32_C(   200014692),  INT32_C(  1512847005),  INT32_C(   750245308) },
       {  INT32_C(   571745903),  INT32_C(   306385132),  INT32_C(  1210508381), -INT32_C(   398197757),  INT32_C(  1512847005),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(  0),
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    {    UINT8_MAX,
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312) },
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312) } },
+    { UINT8_C(  1),
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312) },
+      {  INT32_C(   123456789),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(128),
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312) },
+      { -INT32_C(   987654312),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(170),
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312) },
+      { -INT32_C(   246913578), -INT32_C(   493827156), -INT32_C(   740740734), -INT32_C(   987654312),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(240),
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312) },
+      {  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -582,6 +624,24 @@ test_simde_mm256_maskz_compress_epi32 (SIMDE_MUNIT_TEST_ARGS) {
     { UINT8_C(236),
       {  INT32_C(   134429877), -INT32_C(   263458774), -INT32_C(  1408129535), -INT32_C(   313038244),  INT32_C(  2050703040),  INT32_C(   939765820),  INT32_C(   161901433),  INT32_C(  1727359409) },
       { -INT32_C(  1408129535), -INT32_C(   313038244),  INT32_C(   939765820),  INT32_C(   161901433),  INT32_C(  1727359409),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(  0),
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    {    UINT8_MAX,
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312) },
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312) } },
+    { UINT8_C(  1),
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312) },
+      {  INT32_C(   123456789),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(128),
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312) },
+      { -INT32_C(   987654312),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(170),
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312) },
+      { -INT32_C(   246913578), -INT32_C(   493827156), -INT32_C(   740740734), -INT32_C(   987654312),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(240),
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312) },
+      {  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -647,6 +707,30 @@ test_simde_mm256_mask_compress_epi64 (SIMDE_MUNIT_TEST_ARGS) {
       UINT8_C(163),
       { -INT64_C( 7138210707381570119), -INT64_C( 2930045336832047683), -INT64_C(  207437002978086053), -INT64_C( 8022834162468255434) },
       { -INT64_C( 7138210707381570119), -INT64_C( 2930045336832047683), -INT64_C( 3318386145431614196), -INT64_C(  806760910580492278) } },
+    { { -INT64_C(  462962958796296301),  INT64_C(  925925917592592602), -INT64_C( 1388888876388888903),  INT64_C( 1851851835185185204) },
+      UINT8_C(  0),
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392) },
+      { -INT64_C(  462962958796296301),  INT64_C(  925925917592592602), -INT64_C( 1388888876388888903),  INT64_C( 1851851835185185204) } },
+    { { -INT64_C(  462962958796296301),  INT64_C(  925925917592592602), -INT64_C( 1388888876388888903),  INT64_C( 1851851835185185204) },
+      UINT8_C( 15),
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392) },
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392) } },
+    { { -INT64_C(  462962958796296301),  INT64_C(  925925917592592602), -INT64_C( 1388888876388888903),  INT64_C( 1851851835185185204) },
+      UINT8_C(  1),
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392) },
+      {  INT64_C(  154320986265432098),  INT64_C(  925925917592592602), -INT64_C( 1388888876388888903),  INT64_C( 1851851835185185204) } },
+    { { -INT64_C(  462962958796296301),  INT64_C(  925925917592592602), -INT64_C( 1388888876388888903),  INT64_C( 1851851835185185204) },
+      UINT8_C(  8),
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392) },
+      { -INT64_C(  617283945061728392),  INT64_C(  925925917592592602), -INT64_C( 1388888876388888903),  INT64_C( 1851851835185185204) } },
+    { { -INT64_C(  462962958796296301),  INT64_C(  925925917592592602), -INT64_C( 1388888876388888903),  INT64_C( 1851851835185185204) },
+      UINT8_C( 10),
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392) },
+      { -INT64_C(  308641972530864196), -INT64_C(  617283945061728392), -INT64_C( 1388888876388888903),  INT64_C( 1851851835185185204) } },
+    { { -INT64_C(  462962958796296301),  INT64_C(  925925917592592602), -INT64_C( 1388888876388888903),  INT64_C( 1851851835185185204) },
+      UINT8_C( 12),
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392) },
+      {  INT64_C(  462962958796296294), -INT64_C(  617283945061728392), -INT64_C( 1388888876388888903),  INT64_C( 1851851835185185204) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -706,6 +790,24 @@ test_simde_mm256_mask_compressstoreu_epi64 (SIMDE_MUNIT_TEST_ARGS) {
     { UINT8_C(135),
       { -INT64_C( 8879565576733354861), -INT64_C( 4370926392724550625), -INT64_C( 4378973417519102457),  INT64_C( 3481165537567159623) },
       { -INT64_C( 8879565576733354861), -INT64_C( 4370926392724550625), -INT64_C( 4378973417519102457),  INT64_C(                   0) } },
+    { UINT8_C(  0),
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 15),
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392) },
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392) } },
+    { UINT8_C(  1),
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392) },
+      {  INT64_C(  154320986265432098),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(  8),
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392) },
+      { -INT64_C(  617283945061728392),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 10),
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392) },
+      { -INT64_C(  308641972530864196), -INT64_C(  617283945061728392),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 12),
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392) },
+      {  INT64_C(  462962958796296294), -INT64_C(  617283945061728392),  INT64_C(                   0),  INT64_C(                   0) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -764,6 +866,24 @@ test_simde_mm256_maskz_compress_epi64 (SIMDE_MUNIT_TEST_ARGS) {
     { UINT8_C( 19),
       { -INT64_C( 2609540668708900589),  INT64_C( 5481731862906559998),  INT64_C( 2674938996965126276), -INT64_C( 7650467315170839853) },
       { -INT64_C( 2609540668708900589),  INT64_C( 5481731862906559998),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(  0),
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 15),
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392) },
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392) } },
+    { UINT8_C(  1),
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392) },
+      {  INT64_C(  154320986265432098),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(  8),
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392) },
+      { -INT64_C(  617283945061728392),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 10),
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392) },
+      { -INT64_C(  308641972530864196), -INT64_C(  617283945061728392),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 12),
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392) },
+      {  INT64_C(  462962958796296294), -INT64_C(  617283945061728392),  INT64_C(                   0),  INT64_C(                   0) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -1547,6 +1667,48 @@ test_simde_mm512_mask_compress_epi32 (SIMDE_MUNIT_TEST_ARGS) {
         -INT32_C(   636490071), -INT32_C(  1612475280), -INT32_C(  1204510968), -INT32_C(  1929773419),  INT32_C(    82829892),  INT32_C(   479817805),  INT32_C(  1962982624), -INT32_C(  1287985142) },
       { -INT32_C(  1782811601),  INT32_C(  1103820207), -INT32_C(  1786680640), -INT32_C(   636490071), -INT32_C(  1612475280),  INT32_C(  1763002312),  INT32_C(  1504959231), -INT32_C(  1346776605),
          INT32_C(   200252981), -INT32_C(   702938322), -INT32_C(  1378338182),  INT32_C(   996586224),  INT32_C(    43136057),  INT32_C(  2070652795),  INT32_C(  1708400257),  INT32_C(   605326831) } },
+    { { -INT32_C(   370370374),  INT32_C(   740740748), -INT32_C(  1111111122),  INT32_C(  1481481496), -INT32_C(  1851851870), -INT32_C(  2072745052),  INT32_C(  1702374678), -INT32_C(  1332004304),
+         INT32_C(   961633930), -INT32_C(   591263556),  INT32_C(   220893182),  INT32_C(   149477192), -INT32_C(   519847566),  INT32_C(   890217940), -INT32_C(  1260588314),  INT32_C(  1630958688) },
+      UINT16_C(    0),
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312),
+         INT32_C(  1111111101), -INT32_C(  1234567890),  INT32_C(  1358024679), -INT32_C(  1481481468),  INT32_C(  1604938257), -INT32_C(  1728395046),  INT32_C(  1851851835), -INT32_C(  1975308624) },
+      { -INT32_C(   370370374),  INT32_C(   740740748), -INT32_C(  1111111122),  INT32_C(  1481481496), -INT32_C(  1851851870), -INT32_C(  2072745052),  INT32_C(  1702374678), -INT32_C(  1332004304),
+         INT32_C(   961633930), -INT32_C(   591263556),  INT32_C(   220893182),  INT32_C(   149477192), -INT32_C(   519847566),  INT32_C(   890217940), -INT32_C(  1260588314),  INT32_C(  1630958688) } },
+    { { -INT32_C(   370370374),  INT32_C(   740740748), -INT32_C(  1111111122),  INT32_C(  1481481496), -INT32_C(  1851851870), -INT32_C(  2072745052),  INT32_C(  1702374678), -INT32_C(  1332004304),
+         INT32_C(   961633930), -INT32_C(   591263556),  INT32_C(   220893182),  INT32_C(   149477192), -INT32_C(   519847566),  INT32_C(   890217940), -INT32_C(  1260588314),  INT32_C(  1630958688) },
+           UINT16_MAX,
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312),
+         INT32_C(  1111111101), -INT32_C(  1234567890),  INT32_C(  1358024679), -INT32_C(  1481481468),  INT32_C(  1604938257), -INT32_C(  1728395046),  INT32_C(  1851851835), -INT32_C(  1975308624) },
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312),
+         INT32_C(  1111111101), -INT32_C(  1234567890),  INT32_C(  1358024679), -INT32_C(  1481481468),  INT32_C(  1604938257), -INT32_C(  1728395046),  INT32_C(  1851851835), -INT32_C(  1975308624) } },
+    { { -INT32_C(   370370374),  INT32_C(   740740748), -INT32_C(  1111111122),  INT32_C(  1481481496), -INT32_C(  1851851870), -INT32_C(  2072745052),  INT32_C(  1702374678), -INT32_C(  1332004304),
+         INT32_C(   961633930), -INT32_C(   591263556),  INT32_C(   220893182),  INT32_C(   149477192), -INT32_C(   519847566),  INT32_C(   890217940), -INT32_C(  1260588314),  INT32_C(  1630958688) },
+      UINT16_C(    1),
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312),
+         INT32_C(  1111111101), -INT32_C(  1234567890),  INT32_C(  1358024679), -INT32_C(  1481481468),  INT32_C(  1604938257), -INT32_C(  1728395046),  INT32_C(  1851851835), -INT32_C(  1975308624) },
+      {  INT32_C(   123456789),  INT32_C(   740740748), -INT32_C(  1111111122),  INT32_C(  1481481496), -INT32_C(  1851851870), -INT32_C(  2072745052),  INT32_C(  1702374678), -INT32_C(  1332004304),
+         INT32_C(   961633930), -INT32_C(   591263556),  INT32_C(   220893182),  INT32_C(   149477192), -INT32_C(   519847566),  INT32_C(   890217940), -INT32_C(  1260588314),  INT32_C(  1630958688) } },
+    { { -INT32_C(   370370374),  INT32_C(   740740748), -INT32_C(  1111111122),  INT32_C(  1481481496), -INT32_C(  1851851870), -INT32_C(  2072745052),  INT32_C(  1702374678), -INT32_C(  1332004304),
+         INT32_C(   961633930), -INT32_C(   591263556),  INT32_C(   220893182),  INT32_C(   149477192), -INT32_C(   519847566),  INT32_C(   890217940), -INT32_C(  1260588314),  INT32_C(  1630958688) },
+      UINT16_C(32768),
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312),
+         INT32_C(  1111111101), -INT32_C(  1234567890),  INT32_C(  1358024679), -INT32_C(  1481481468),  INT32_C(  1604938257), -INT32_C(  1728395046),  INT32_C(  1851851835), -INT32_C(  1975308624) },
+      { -INT32_C(  1975308624),  INT32_C(   740740748), -INT32_C(  1111111122),  INT32_C(  1481481496), -INT32_C(  1851851870), -INT32_C(  2072745052),  INT32_C(  1702374678), -INT32_C(  1332004304),
+         INT32_C(   961633930), -INT32_C(   591263556),  INT32_C(   220893182),  INT32_C(   149477192), -INT32_C(   519847566),  INT32_C(   890217940), -INT32_C(  1260588314),  INT32_C(  1630958688) } },
+    { { -INT32_C(   370370374),  INT32_C(   740740748), -INT32_C(  1111111122),  INT32_C(  1481481496), -INT32_C(  1851851870), -INT32_C(  2072745052),  INT32_C(  1702374678), -INT32_C(  1332004304),
+         INT32_C(   961633930), -INT32_C(   591263556),  INT32_C(   220893182),  INT32_C(   149477192), -INT32_C(   519847566),  INT32_C(   890217940), -INT32_C(  1260588314),  INT32_C(  1630958688) },
+      UINT16_C(43690),
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312),
+         INT32_C(  1111111101), -INT32_C(  1234567890),  INT32_C(  1358024679), -INT32_C(  1481481468),  INT32_C(  1604938257), -INT32_C(  1728395046),  INT32_C(  1851851835), -INT32_C(  1975308624) },
+      { -INT32_C(   246913578), -INT32_C(   493827156), -INT32_C(   740740734), -INT32_C(   987654312), -INT32_C(  1234567890), -INT32_C(  1481481468), -INT32_C(  1728395046), -INT32_C(  1975308624),
+         INT32_C(   961633930), -INT32_C(   591263556),  INT32_C(   220893182),  INT32_C(   149477192), -INT32_C(   519847566),  INT32_C(   890217940), -INT32_C(  1260588314),  INT32_C(  1630958688) } },
+    { { -INT32_C(   370370374),  INT32_C(   740740748), -INT32_C(  1111111122),  INT32_C(  1481481496), -INT32_C(  1851851870), -INT32_C(  2072745052),  INT32_C(  1702374678), -INT32_C(  1332004304),
+         INT32_C(   961633930), -INT32_C(   591263556),  INT32_C(   220893182),  INT32_C(   149477192), -INT32_C(   519847566),  INT32_C(   890217940), -INT32_C(  1260588314),  INT32_C(  1630958688) },
+      UINT16_C(65280),
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312),
+         INT32_C(  1111111101), -INT32_C(  1234567890),  INT32_C(  1358024679), -INT32_C(  1481481468),  INT32_C(  1604938257), -INT32_C(  1728395046),  INT32_C(  1851851835), -INT32_C(  1975308624) },
+      {  INT32_C(  1111111101), -INT32_C(  1234567890),  INT32_C(  1358024679), -INT32_C(  1481481468),  INT32_C(  1604938257), -INT32_C(  1728395046),  INT32_C(  1851851835), -INT32_C(  1975308624),
+         INT32_C(   961633930), -INT32_C(   591263556),  INT32_C(   220893182),  INT32_C(   149477192), -INT32_C(   519847566),  INT32_C(   890217940), -INT32_C(  1260588314),  INT32_C(  1630958688) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -1622,6 +1784,36 @@ test_simde_mm512_mask_compressstoreu_epi32 (SIMDE_MUNIT_TEST_ARGS) {
         -INT32_C(  1223229801), -INT32_C(  1352814274), -INT32_C(    16127121), -INT32_C(  1383255749), -INT32_C(   328207547),  INT32_C(  2093829964),  INT32_C(  1414675877),  INT32_C(   799340183) },
       { -INT32_C(  1516552416), -INT32_C(  1910026353), -INT32_C(   505390681), -INT32_C(   697280976),  INT32_C(  1352948399), -INT32_C(  1352814274), -INT32_C(    16127121), -INT32_C(  1383255749),
          INT32_C(  1414675877),  INT32_C(   799340183),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(    0),
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312),
+         INT32_C(  1111111101), -INT32_C(  1234567890),  INT32_C(  1358024679), -INT32_C(  1481481468),  INT32_C(  1604938257), -INT32_C(  1728395046),  INT32_C(  1851851835), -INT32_C(  1975308624) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    {      UINT16_MAX,
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312),
+         INT32_C(  1111111101), -INT32_C(  1234567890),  INT32_C(  1358024679), -INT32_C(  1481481468),  INT32_C(  1604938257), -INT32_C(  1728395046),  INT32_C(  1851851835), -INT32_C(  1975308624) },
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312),
+         INT32_C(  1111111101), -INT32_C(  1234567890),  INT32_C(  1358024679), -INT32_C(  1481481468),  INT32_C(  1604938257), -INT32_C(  1728395046),  INT32_C(  1851851835), -INT32_C(  1975308624) } },
+    { UINT16_C(    1),
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312),
+         INT32_C(  1111111101), -INT32_C(  1234567890),  INT32_C(  1358024679), -INT32_C(  1481481468),  INT32_C(  1604938257), -INT32_C(  1728395046),  INT32_C(  1851851835), -INT32_C(  1975308624) },
+      {  INT32_C(   123456789),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(32768),
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312),
+         INT32_C(  1111111101), -INT32_C(  1234567890),  INT32_C(  1358024679), -INT32_C(  1481481468),  INT32_C(  1604938257), -INT32_C(  1728395046),  INT32_C(  1851851835), -INT32_C(  1975308624) },
+      { -INT32_C(  1975308624),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(43690),
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312),
+         INT32_C(  1111111101), -INT32_C(  1234567890),  INT32_C(  1358024679), -INT32_C(  1481481468),  INT32_C(  1604938257), -INT32_C(  1728395046),  INT32_C(  1851851835), -INT32_C(  1975308624) },
+      { -INT32_C(   246913578), -INT32_C(   493827156), -INT32_C(   740740734), -INT32_C(   987654312), -INT32_C(  1234567890), -INT32_C(  1481481468), -INT32_C(  1728395046), -INT32_C(  1975308624),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(65280),
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312),
+         INT32_C(  1111111101), -INT32_C(  1234567890),  INT32_C(  1358024679), -INT32_C(  1481481468),  INT32_C(  1604938257), -INT32_C(  1728395046),  INT32_C(  1851851835), -INT32_C(  1975308624) },
+      {  INT32_C(  1111111101), -INT32_C(  1234567890),  INT32_C(  1358024679), -INT32_C(  1481481468),  INT32_C(  1604938257), -INT32_C(  1728395046),  INT32_C(  1851851835), -INT32_C(  1975308624),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -1696,6 +1888,36 @@ test_simde_mm512_maskz_compress_epi32 (SIMDE_MUNIT_TEST_ARGS) {
          INT32_C(   711509034),  INT32_C(   130602080),  INT32_C(  2022359709),  INT32_C(   661016378),  INT32_C(   864183171),  INT32_C(  1157749969), -INT32_C(  1628331608), -INT32_C(    47769645) },
       { -INT32_C(  1637049344),  INT32_C(  1543255277), -INT32_C(  1994050826),  INT32_C(   711509034),  INT32_C(   661016378),  INT32_C(   864183171),  INT32_C(  1157749969), -INT32_C(  1628331608),
          INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(    0),
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312),
+         INT32_C(  1111111101), -INT32_C(  1234567890),  INT32_C(  1358024679), -INT32_C(  1481481468),  INT32_C(  1604938257), -INT32_C(  1728395046),  INT32_C(  1851851835), -INT32_C(  1975308624) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    {      UINT16_MAX,
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312),
+         INT32_C(  1111111101), -INT32_C(  1234567890),  INT32_C(  1358024679), -INT32_C(  1481481468),  INT32_C(  1604938257), -INT32_C(  1728395046),  INT32_C(  1851851835), -INT32_C(  1975308624) },
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312),
+         INT32_C(  1111111101), -INT32_C(  1234567890),  INT32_C(  1358024679), -INT32_C(  1481481468),  INT32_C(  1604938257), -INT32_C(  1728395046),  INT32_C(  1851851835), -INT32_C(  1975308624) } },
+    { UINT16_C(    1),
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312),
+         INT32_C(  1111111101), -INT32_C(  1234567890),  INT32_C(  1358024679), -INT32_C(  1481481468),  INT32_C(  1604938257), -INT32_C(  1728395046),  INT32_C(  1851851835), -INT32_C(  1975308624) },
+      {  INT32_C(   123456789),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(32768),
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312),
+         INT32_C(  1111111101), -INT32_C(  1234567890),  INT32_C(  1358024679), -INT32_C(  1481481468),  INT32_C(  1604938257), -INT32_C(  1728395046),  INT32_C(  1851851835), -INT32_C(  1975308624) },
+      { -INT32_C(  1975308624),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(43690),
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312),
+         INT32_C(  1111111101), -INT32_C(  1234567890),  INT32_C(  1358024679), -INT32_C(  1481481468),  INT32_C(  1604938257), -INT32_C(  1728395046),  INT32_C(  1851851835), -INT32_C(  1975308624) },
+      { -INT32_C(   246913578), -INT32_C(   493827156), -INT32_C(   740740734), -INT32_C(   987654312), -INT32_C(  1234567890), -INT32_C(  1481481468), -INT32_C(  1728395046), -INT32_C(  1975308624),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(65280),
+      {  INT32_C(   123456789), -INT32_C(   246913578),  INT32_C(   370370367), -INT32_C(   493827156),  INT32_C(   617283945), -INT32_C(   740740734),  INT32_C(   864197523), -INT32_C(   987654312),
+         INT32_C(  1111111101), -INT32_C(  1234567890),  INT32_C(  1358024679), -INT32_C(  1481481468),  INT32_C(  1604938257), -INT32_C(  1728395046),  INT32_C(  1851851835), -INT32_C(  1975308624) },
+      {  INT32_C(  1111111101), -INT32_C(  1234567890),  INT32_C(  1358024679), -INT32_C(  1481481468),  INT32_C(  1604938257), -INT32_C(  1728395046),  INT32_C(  1851851835), -INT32_C(  1975308624),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -1785,6 +2007,48 @@ test_simde_mm512_mask_compress_epi64 (SIMDE_MUNIT_TEST_ARGS) {
         -INT64_C( 9202695636988389619),  INT64_C( 7082909649666282999), -INT64_C( 1515692192841526334),  INT64_C( 9057915810236279388) },
       { -INT64_C( 3733206529576220789),  INT64_C( 8189592403690270703), -INT64_C(  324190735203608212), -INT64_C( 2546792199631536393),
         -INT64_C( 8311032031394636880), -INT64_C( 1498681080831452067),  INT64_C( 2247542677356669686),  INT64_C( 1420795951341595102) } },
+    { { -INT64_C(  462962958796296301),  INT64_C(  925925917592592602), -INT64_C( 1388888876388888903),  INT64_C( 1851851835185185204),
+        -INT64_C( 2314814793981481505),  INT64_C( 2777777752777777806), -INT64_C( 3240740711574074107),  INT64_C( 3703703670370370408) },
+      UINT8_C(  0),
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392),
+         INT64_C(  771604931327160490), -INT64_C(  925925917592592588),  INT64_C( 1080246903858024686), -INT64_C( 1234567890123456784) },
+      { -INT64_C(  462962958796296301),  INT64_C(  925925917592592602), -INT64_C( 1388888876388888903),  INT64_C( 1851851835185185204),
+        -INT64_C( 2314814793981481505),  INT64_C( 2777777752777777806), -INT64_C( 3240740711574074107),  INT64_C( 3703703670370370408) } },
+    { { -INT64_C(  462962958796296301),  INT64_C(  925925917592592602), -INT64_C( 1388888876388888903),  INT64_C( 1851851835185185204),
+        -INT64_C( 2314814793981481505),  INT64_C( 2777777752777777806), -INT64_C( 3240740711574074107),  INT64_C( 3703703670370370408) },
+         UINT8_MAX,
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392),
+         INT64_C(  771604931327160490), -INT64_C(  925925917592592588),  INT64_C( 1080246903858024686), -INT64_C( 1234567890123456784) },
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392),
+         INT64_C(  771604931327160490), -INT64_C(  925925917592592588),  INT64_C( 1080246903858024686), -INT64_C( 1234567890123456784) } },
+    { { -INT64_C(  462962958796296301),  INT64_C(  925925917592592602), -INT64_C( 1388888876388888903),  INT64_C( 1851851835185185204),
+        -INT64_C( 2314814793981481505),  INT64_C( 2777777752777777806), -INT64_C( 3240740711574074107),  INT64_C( 3703703670370370408) },
+      UINT8_C(  1),
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392),
+         INT64_C(  771604931327160490), -INT64_C(  925925917592592588),  INT64_C( 1080246903858024686), -INT64_C( 1234567890123456784) },
+      {  INT64_C(  154320986265432098),  INT64_C(  925925917592592602), -INT64_C( 1388888876388888903),  INT64_C( 1851851835185185204),
+        -INT64_C( 2314814793981481505),  INT64_C( 2777777752777777806), -INT64_C( 3240740711574074107),  INT64_C( 3703703670370370408) } },
+    { { -INT64_C(  462962958796296301),  INT64_C(  925925917592592602), -INT64_C( 1388888876388888903),  INT64_C( 1851851835185185204),
+        -INT64_C( 2314814793981481505),  INT64_C( 2777777752777777806), -INT64_C( 3240740711574074107),  INT64_C( 3703703670370370408) },
+      UINT8_C(128),
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392),
+         INT64_C(  771604931327160490), -INT64_C(  925925917592592588),  INT64_C( 1080246903858024686), -INT64_C( 1234567890123456784) },
+      { -INT64_C( 1234567890123456784),  INT64_C(  925925917592592602), -INT64_C( 1388888876388888903),  INT64_C( 1851851835185185204),
+        -INT64_C( 2314814793981481505),  INT64_C( 2777777752777777806), -INT64_C( 3240740711574074107),  INT64_C( 3703703670370370408) } },
+    { { -INT64_C(  462962958796296301),  INT64_C(  925925917592592602), -INT64_C( 1388888876388888903),  INT64_C( 1851851835185185204),
+        -INT64_C( 2314814793981481505),  INT64_C( 2777777752777777806), -INT64_C( 3240740711574074107),  INT64_C( 3703703670370370408) },
+      UINT8_C(170),
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392),
+         INT64_C(  771604931327160490), -INT64_C(  925925917592592588),  INT64_C( 1080246903858024686), -INT64_C( 1234567890123456784) },
+      { -INT64_C(  308641972530864196), -INT64_C(  617283945061728392), -INT64_C(  925925917592592588), -INT64_C( 1234567890123456784),
+        -INT64_C( 2314814793981481505),  INT64_C( 2777777752777777806), -INT64_C( 3240740711574074107),  INT64_C( 3703703670370370408) } },
+    { { -INT64_C(  462962958796296301),  INT64_C(  925925917592592602), -INT64_C( 1388888876388888903),  INT64_C( 1851851835185185204),
+        -INT64_C( 2314814793981481505),  INT64_C( 2777777752777777806), -INT64_C( 3240740711574074107),  INT64_C( 3703703670370370408) },
+      UINT8_C(240),
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392),
+         INT64_C(  771604931327160490), -INT64_C(  925925917592592588),  INT64_C( 1080246903858024686), -INT64_C( 1234567890123456784) },
+      {  INT64_C(  771604931327160490), -INT64_C(  925925917592592588),  INT64_C( 1080246903858024686), -INT64_C( 1234567890123456784),
+        -INT64_C( 2314814793981481505),  INT64_C( 2777777752777777806), -INT64_C( 3240740711574074107),  INT64_C( 3703703670370370408) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -1860,6 +2124,36 @@ test_simde_mm512_mask_compressstoreu_epi64 (SIMDE_MUNIT_TEST_ARGS) {
          INT64_C( 5812607648818413541),  INT64_C( 1929594973434804802), -INT64_C( 6046284682670769871),  INT64_C( 7722283055574738860) },
       {  INT64_C( 9006246294607119931),  INT64_C( 2330170136248499060),  INT64_C( 1929594973434804802),  INT64_C( 7722283055574738860),
          INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(  0),
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392),
+         INT64_C(  771604931327160490), -INT64_C(  925925917592592588),  INT64_C( 1080246903858024686), -INT64_C( 1234567890123456784) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    {    UINT8_MAX,
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392),
+         INT64_C(  771604931327160490), -INT64_C(  925925917592592588),  INT64_C( 1080246903858024686), -INT64_C( 1234567890123456784) },
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392),
+         INT64_C(  771604931327160490), -INT64_C(  925925917592592588),  INT64_C( 1080246903858024686), -INT64_C( 1234567890123456784) } },
+    { UINT8_C(  1),
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392),
+         INT64_C(  771604931327160490), -INT64_C(  925925917592592588),  INT64_C( 1080246903858024686), -INT64_C( 1234567890123456784) },
+      {  INT64_C(  154320986265432098),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(128),
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392),
+         INT64_C(  771604931327160490), -INT64_C(  925925917592592588),  INT64_C( 1080246903858024686), -INT64_C( 1234567890123456784) },
+      { -INT64_C( 1234567890123456784),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(170),
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392),
+         INT64_C(  771604931327160490), -INT64_C(  925925917592592588),  INT64_C( 1080246903858024686), -INT64_C( 1234567890123456784) },
+      { -INT64_C(  308641972530864196), -INT64_C(  617283945061728392), -INT64_C(  925925917592592588), -INT64_C( 1234567890123456784),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(240),
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392),
+         INT64_C(  771604931327160490), -INT64_C(  925925917592592588),  INT64_C( 1080246903858024686), -INT64_C( 1234567890123456784) },
+      {  INT64_C(  771604931327160490), -INT64_C(  925925917592592588),  INT64_C( 1080246903858024686), -INT64_C( 1234567890123456784),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -1934,6 +2228,36 @@ test_simde_mm512_maskz_compress_epi64 (SIMDE_MUNIT_TEST_ARGS) {
         -INT64_C(   73663940351841968),  INT64_C( 2294001780559867084), -INT64_C( 1441520703368044486), -INT64_C( 7294469883978837141) },
       { -INT64_C( 6865350558291912042), -INT64_C(   73663940351841968),  INT64_C( 2294001780559867084), -INT64_C( 1441520703368044486),
          INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(  0),
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392),
+         INT64_C(  771604931327160490), -INT64_C(  925925917592592588),  INT64_C( 1080246903858024686), -INT64_C( 1234567890123456784) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    {    UINT8_MAX,
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392),
+         INT64_C(  771604931327160490), -INT64_C(  925925917592592588),  INT64_C( 1080246903858024686), -INT64_C( 1234567890123456784) },
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392),
+         INT64_C(  771604931327160490), -INT64_C(  925925917592592588),  INT64_C( 1080246903858024686), -INT64_C( 1234567890123456784) } },
+    { UINT8_C(  1),
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392),
+         INT64_C(  771604931327160490), -INT64_C(  925925917592592588),  INT64_C( 1080246903858024686), -INT64_C( 1234567890123456784) },
+      {  INT64_C(  154320986265432098),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(128),
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392),
+         INT64_C(  771604931327160490), -INT64_C(  925925917592592588),  INT64_C( 1080246903858024686), -INT64_C( 1234567890123456784) },
+      { -INT64_C( 1234567890123456784),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(170),
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392),
+         INT64_C(  771604931327160490), -INT64_C(  925925917592592588),  INT64_C( 1080246903858024686), -INT64_C( 1234567890123456784) },
+      { -INT64_C(  308641972530864196), -INT64_C(  617283945061728392), -INT64_C(  925925917592592588), -INT64_C( 1234567890123456784),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(240),
+      {  INT64_C(  154320986265432098), -INT64_C(  308641972530864196),  INT64_C(  462962958796296294), -INT64_C(  617283945061728392),
+         INT64_C(  771604931327160490), -INT64_C(  925925917592592588),  INT64_C( 1080246903858024686), -INT64_C( 1234567890123456784) },
+      {  INT64_C(  771604931327160490), -INT64_C(  925925917592592588),  INT64_C( 1080246903858024686), -INT64_C( 1234567890123456784),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -1958,6 +2282,1832 @@ test_simde_mm512_maskz_compress_epi64 (SIMDE_MUNIT_TEST_ARGS) {
 #endif
 }
 
+static int
+test_simde_mm_mask_compress_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int8_t src[16];
+    const simde__mmask16 k;
+    const int8_t a[16];
+    const int8_t r[16];
+  } test_vec[] = {
+    { { -INT8_C(  50), -INT8_C( 119), -INT8_C(  43),  INT8_C( 118), -INT8_C(  51),  INT8_C(  95),  INT8_C(  76), -INT8_C(  53),
+        -INT8_C(  78),  INT8_C(  22),  INT8_C( 102),  INT8_C(  33), -INT8_C(  30),  INT8_C(  89), -INT8_C(  65),  INT8_C(  76) },
+      UINT16_C( 4867),
+      {  INT8_C(   1),  INT8_C(  69),  INT8_C(   0), -INT8_C(  25), -INT8_C(   2),  INT8_C(  17), -INT8_C(  95),  INT8_C(  80),
+        -INT8_C(  56), -INT8_C(  37), -INT8_C( 104),  INT8_C(  61),  INT8_C(  39),  INT8_C( 102), -INT8_C(  58), -INT8_C(   4) },
+      {  INT8_C(   1),  INT8_C(  69), -INT8_C(  56), -INT8_C(  37),  INT8_C(  39),  INT8_C(  95),  INT8_C(  76), -INT8_C(  53),
+        -INT8_C(  78),  INT8_C(  22),  INT8_C( 102),  INT8_C(  33), -INT8_C(  30),  INT8_C(  89), -INT8_C(  65),  INT8_C(  76) } },
+    { { -INT8_C(  35), -INT8_C( 109),  INT8_C(  91),  INT8_C(  41),  INT8_C(  95),  INT8_C(  13),  INT8_C(  63), -INT8_C(  59),
+         INT8_C(  47),  INT8_C(  33),  INT8_C(  30), -INT8_C(  18),  INT8_C( 109),  INT8_C(  33),  INT8_C(   1),  INT8_C( 111) },
+      UINT16_C(  615),
+      {  INT8_C(  86),  INT8_C( 101),  INT8_C(  19), -INT8_C(   9), -INT8_C(  75), -INT8_C(  37), -INT8_C(  46),  INT8_C(  78),
+         INT8_C(  24), -INT8_C(   7), -INT8_C(  76), -INT8_C(  33), -INT8_C(  10), -INT8_C( 111),  INT8_C( 114),  INT8_C(  81) },
+      {  INT8_C(  86),  INT8_C( 101),  INT8_C(  19), -INT8_C(  37), -INT8_C(  46), -INT8_C(   7),  INT8_C(  63), -INT8_C(  59),
+         INT8_C(  47),  INT8_C(  33),  INT8_C(  30), -INT8_C(  18),  INT8_C( 109),  INT8_C(  33),  INT8_C(   1),  INT8_C( 111) } },
+    { { -INT8_C(  70), -INT8_C(  47),  INT8_C(  95), -INT8_C(   7), -INT8_C( 105), -INT8_C( 114),  INT8_C(  26), -INT8_C(  75),
+         INT8_C( 124), -INT8_C( 120), -INT8_C(  41),  INT8_C( 126), -INT8_C(   9),  INT8_C(  62),      INT8_MIN,  INT8_C(  77) },
+      UINT16_C(37795),
+      {  INT8_C(  68),  INT8_C(  88),  INT8_C( 111),  INT8_C(  23), -INT8_C(  90), -INT8_C( 121),  INT8_C(  16),  INT8_C(  91),
+         INT8_C( 102),  INT8_C(   6), -INT8_C(  20), -INT8_C(  39),  INT8_C(  88), -INT8_C(  89), -INT8_C(  86), -INT8_C(  73) },
+      {  INT8_C(  68),  INT8_C(  88), -INT8_C( 121),  INT8_C(  91),  INT8_C( 102),  INT8_C(   6),  INT8_C(  88), -INT8_C(  73),
+         INT8_C( 124), -INT8_C( 120), -INT8_C(  41),  INT8_C( 126), -INT8_C(   9),  INT8_C(  62),      INT8_MIN,  INT8_C(  77) } },
+    { { -INT8_C(  96),  INT8_C(  65),  INT8_C(  69), -INT8_C(  69), -INT8_C(   9), -INT8_C(  63),  INT8_C(  67), -INT8_C(  50),
+         INT8_C(  63),  INT8_C(  58),  INT8_C(  12), -INT8_C(  65), -INT8_C( 121), -INT8_C(  81),  INT8_C(  83), -INT8_C(  53) },
+      UINT16_C(49671),
+      { -INT8_C(  30), -INT8_C(  82),  INT8_C(  73), -INT8_C(  13),  INT8_C(   9), -INT8_C(  80), -INT8_C(   7), -INT8_C(  11),
+        -INT8_C( 119),  INT8_C(  81), -INT8_C( 100),  INT8_C(  51),  INT8_C(   8),  INT8_C(  61),  INT8_C( 117),  INT8_C(  77) },
+      { -INT8_C(  30), -INT8_C(  82),  INT8_C(  73),  INT8_C(  81),  INT8_C( 117),  INT8_C(  77),  INT8_C(  67), -INT8_C(  50),
+         INT8_C(  63),  INT8_C(  58),  INT8_C(  12), -INT8_C(  65), -INT8_C( 121), -INT8_C(  81),  INT8_C(  83), -INT8_C(  53) } },
+    { { -INT8_C(   8),  INT8_C( 108),  INT8_C(  15),  INT8_C(  59),  INT8_C(  58),  INT8_C(  78),  INT8_C( 117),  INT8_C(  70),
+         INT8_C(  14), -INT8_C(   4), -INT8_C(  11),  INT8_C(  97), -INT8_C(  57), -INT8_C(   4),  INT8_C(  35), -INT8_C(  86) },
+      UINT16_C(27818),
+      { -INT8_C(  99), -INT8_C(  77),  INT8_C(  28), -INT8_C( 106), -INT8_C(  87), -INT8_C(  91), -INT8_C(  24),  INT8_C(  69),
+        -INT8_C(  39), -INT8_C(  16), -INT8_C( 126),  INT8_C(  78),  INT8_C(  62),  INT8_C( 122), -INT8_C(  70),  INT8_C(  77) },
+      { -INT8_C(  77), -INT8_C( 106), -INT8_C(  91),  INT8_C(  69), -INT8_C( 126),  INT8_C(  78),  INT8_C( 122), -INT8_C(  70),
+         INT8_C(  14), -INT8_C(   4), -INT8_C(  11),  INT8_C(  97), -INT8_C(  57), -INT8_C(   4),  INT8_C(  35), -INT8_C(  86) } },
+    { { -INT8_C(  75), -INT8_C(  12), -INT8_C( 101),  INT8_C(  42),  INT8_C(  58), -INT8_C(  87),  INT8_C(  38),  INT8_C(  47),
+         INT8_C(  10), -INT8_C(  18),  INT8_C(  43),  INT8_C(  45), -INT8_C( 104), -INT8_C(  42), -INT8_C( 102),  INT8_C(  53) },
+      UINT16_C(46729),
+      { -INT8_C(  53),  INT8_C(  50),  INT8_C(  92), -INT8_C(  77),  INT8_C( 120),  INT8_C(  53), -INT8_C(  92), -INT8_C(   6),
+        -INT8_C( 125), -INT8_C(  30),  INT8_C( 117),  INT8_C(  61),  INT8_C(  47),  INT8_C(  42),  INT8_C(  49), -INT8_C(  54) },
+      { -INT8_C(  53), -INT8_C(  77), -INT8_C(   6), -INT8_C(  30),  INT8_C( 117),  INT8_C(  47),  INT8_C(  42), -INT8_C(  54),
+         INT8_C(  10), -INT8_C(  18),  INT8_C(  43),  INT8_C(  45), -INT8_C( 104), -INT8_C(  42), -INT8_C( 102),  INT8_C(  53) } },
+    { {  INT8_C(  85),  INT8_C( 107),  INT8_C( 116),  INT8_C( 123), -INT8_C( 102),  INT8_C( 126),  INT8_C( 105), -INT8_C(  59),
+        -INT8_C(  84),  INT8_C(   1), -INT8_C( 101),  INT8_C(  70),  INT8_C(  54),  INT8_C(  37), -INT8_C(   4),  INT8_C(   2) },
+      UINT16_C(22615),
+      { -INT8_C(  75), -INT8_C(  49), -INT8_C( 115),  INT8_C(  89), -INT8_C(  54),  INT8_C(  16),  INT8_C(  59),  INT8_C(  63),
+         INT8_C(  77),  INT8_C( 106),  INT8_C( 105),  INT8_C( 126),  INT8_C(  53), -INT8_C(  66), -INT8_C(  23), -INT8_C(  87) },
+      { -INT8_C(  75), -INT8_C(  49), -INT8_C( 115), -INT8_C(  54),  INT8_C(  59),  INT8_C( 126),  INT8_C(  53), -INT8_C(  23),
+        -INT8_C(  84),  INT8_C(   1), -INT8_C( 101),  INT8_C(  70),  INT8_C(  54),  INT8_C(  37), -INT8_C(   4),  INT8_C(   2) } },
+    { {  INT8_C(  58), -INT8_C( 125),  INT8_C(  39), -INT8_C(  93),  INT8_C(  73), -INT8_C(  45), -INT8_C(  91), -INT8_C(  28),
+         INT8_C(  25), -INT8_C(  37),  INT8_C(   9),  INT8_C(  22), -INT8_C(  35),  INT8_C(  97),  INT8_C( 110), -INT8_C( 109) },
+      UINT16_C(64560),
+      { -INT8_C(  20), -INT8_C(   6),  INT8_C(  12),  INT8_C(  40),  INT8_C(  57),  INT8_C(  90), -INT8_C( 110), -INT8_C(  93),
+        -INT8_C(  40), -INT8_C(  57),  INT8_C(  97), -INT8_C(  62),  INT8_C( 112), -INT8_C( 101),  INT8_C(  69), -INT8_C( 104) },
+      {  INT8_C(  57),  INT8_C(  90),  INT8_C(  97), -INT8_C(  62),  INT8_C( 112), -INT8_C( 101),  INT8_C(  69), -INT8_C( 104),
+         INT8_C(  25), -INT8_C(  37),  INT8_C(   9),  INT8_C(  22), -INT8_C(  35),  INT8_C(  97),  INT8_C( 110), -INT8_C( 109) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi8(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i r = simde_mm_mask_compress_epi8(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m128i src = simde_test_x86_random_i8x16();
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m128i a = simde_test_x86_random_i8x16();
+    simde__m128i r = simde_mm_mask_compress_epi8(src, k, a);
+
+    simde_test_x86_write_i8x16(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_maskz_compress_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask16 k;
+    const int8_t a[16];
+    const int8_t r[16];
+  } test_vec[] = {
+    { UINT16_C(36415),
+      {  INT8_C( 107), -INT8_C(  28),  INT8_C( 115), -INT8_C( 123), -INT8_C(  65),  INT8_C( 124), -INT8_C( 101), -INT8_C(  99),
+        -INT8_C(  35),  INT8_C(   9),  INT8_C(  48),  INT8_C(  14),  INT8_C(   5),  INT8_C(  28),  INT8_C(   8),  INT8_C(  18) },
+      {  INT8_C( 107), -INT8_C(  28),  INT8_C( 115), -INT8_C( 123), -INT8_C(  65),  INT8_C( 124),  INT8_C(   9),  INT8_C(  48),
+         INT8_C(  14),  INT8_C(  18),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(16964),
+      {  INT8_C( 108), -INT8_C(  41), -INT8_C(  27),  INT8_C(  68), -INT8_C(  98),  INT8_C(  70),  INT8_C(   6),  INT8_C(  15),
+        -INT8_C(  30),  INT8_C(  76), -INT8_C(  89),  INT8_C(  33), -INT8_C(  38),  INT8_C(  18),  INT8_C(   5),  INT8_C(  77) },
+      { -INT8_C(  27),  INT8_C(   6),  INT8_C(  76),  INT8_C(   5),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(50327),
+      { -INT8_C(  54),  INT8_C(  50),  INT8_C(  97), -INT8_C(  89),  INT8_C(  60), -INT8_C( 111), -INT8_C(  75),  INT8_C(  65),
+        -INT8_C(  82), -INT8_C(  66),  INT8_C(  83), -INT8_C(  14),  INT8_C(   0), -INT8_C(  65), -INT8_C(  55), -INT8_C(  27) },
+      { -INT8_C(  54),  INT8_C(  50),  INT8_C(  97),  INT8_C(  60),  INT8_C(  65),  INT8_C(  83), -INT8_C(  55), -INT8_C(  27),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(26628),
+      {  INT8_C(  43),  INT8_C(  10),  INT8_C( 119),  INT8_C(  13),  INT8_C(  86),  INT8_C(  30),  INT8_C(  46),  INT8_C(  49),
+         INT8_C(  48),  INT8_C(  51),  INT8_C( 126), -INT8_C(  56), -INT8_C(   8),  INT8_C(  72), -INT8_C(   6),  INT8_C(  89) },
+      {  INT8_C( 119), -INT8_C(  56),  INT8_C(  72), -INT8_C(   6),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(14064),
+      { -INT8_C(  21), -INT8_C(  91),  INT8_C( 120), -INT8_C( 103),  INT8_C(  99), -INT8_C(  53), -INT8_C( 117),  INT8_C(  99),
+        -INT8_C( 117),  INT8_C(  85),  INT8_C(  72), -INT8_C( 113), -INT8_C(  67),  INT8_C( 116), -INT8_C( 103),  INT8_C(  52) },
+      {  INT8_C(  99), -INT8_C(  53), -INT8_C( 117),  INT8_C(  99),  INT8_C(  85),  INT8_C(  72), -INT8_C(  67),  INT8_C( 116),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(61569),
+      {  INT8_C(  82), -INT8_C(  80),  INT8_C(  33), -INT8_C( 126), -INT8_C(  29), -INT8_C(  97),  INT8_C(  74), -INT8_C(  37),
+        -INT8_C(  24),  INT8_C(  69),  INT8_C(  53), -INT8_C(  40),  INT8_C( 123),  INT8_C(  32),  INT8_C( 125), -INT8_C(  13) },
+      {  INT8_C(  82), -INT8_C(  37),  INT8_C( 123),  INT8_C(  32),  INT8_C( 125), -INT8_C(  13),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(57785),
+      { -INT8_C(  65),  INT8_C(  68),  INT8_C(  68),  INT8_C(  74), -INT8_C( 103), -INT8_C( 115), -INT8_C(  39),  INT8_C(  86),
+         INT8_C(   1),  INT8_C( 114), -INT8_C( 118), -INT8_C( 126),  INT8_C(  98), -INT8_C(  36),  INT8_C(  50), -INT8_C( 125) },
+      { -INT8_C(  65),  INT8_C(  74), -INT8_C( 103), -INT8_C( 115),  INT8_C(  86),  INT8_C(   1), -INT8_C(  36),  INT8_C(  50),
+        -INT8_C( 125),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C( 5727),
+      {  INT8_C(  35), -INT8_C(  87), -INT8_C(  15),  INT8_C(  11), -INT8_C(  18),  INT8_C(  38), -INT8_C(  29),  INT8_C( 106),
+         INT8_C(  70),  INT8_C(  96),  INT8_C(  93), -INT8_C(   1),  INT8_C(  65),  INT8_C(  28),  INT8_C(  68), -INT8_C( 122) },
+      {  INT8_C(  35), -INT8_C(  87), -INT8_C(  15),  INT8_C(  11), -INT8_C(  18), -INT8_C(  29),  INT8_C(  96),  INT8_C(  93),
+         INT8_C(  65),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i r = simde_mm_maskz_compress_epi8(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m128i a = simde_test_x86_random_i8x16();
+    simde__m128i r = simde_mm_maskz_compress_epi8(k, a);
+
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i8x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_mask_compressstoreu_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask16 k;
+    const int8_t a[16];
+    const int8_t r[16];
+  } test_vec[] = {
+    { UINT16_C(56678),
+      {  INT8_C(  19),  INT8_C(  63),  INT8_C(  52),  INT8_C(  20), -INT8_C(  78), -INT8_C(  66), -INT8_C( 106),  INT8_C(  20),
+        -INT8_C( 101), -INT8_C(  55), -INT8_C( 104), -INT8_C(   6), -INT8_C(  33), -INT8_C(  69), -INT8_C(  93), -INT8_C(  48) },
+      {  INT8_C(  63),  INT8_C(  52), -INT8_C(  66), -INT8_C( 106), -INT8_C( 101), -INT8_C( 104), -INT8_C(   6), -INT8_C(  33),
+        -INT8_C(  93), -INT8_C(  48),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(37574),
+      { -INT8_C(   9), -INT8_C(  87), -INT8_C(   4),  INT8_C(  61),  INT8_C(   9),  INT8_C(  89),  INT8_C(  61),  INT8_C(  75),
+         INT8_C( 118), -INT8_C( 127), -INT8_C(  47), -INT8_C(  36),  INT8_C(  94), -INT8_C(  28),  INT8_C(  28), -INT8_C( 110) },
+      { -INT8_C(  87), -INT8_C(   4),  INT8_C(  61),  INT8_C(  75), -INT8_C( 127),  INT8_C(  94), -INT8_C( 110),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(52984),
+      {  INT8_C(  81), -INT8_C( 114), -INT8_C(  30), -INT8_C(  20),  INT8_C(  87),  INT8_C( 122), -INT8_C(  26),  INT8_C(  54),
+         INT8_C(  53), -INT8_C( 119),  INT8_C(   7), -INT8_C(   5),  INT8_C(  27), -INT8_C(   2), -INT8_C(  92),  INT8_C(  23) },
+      { -INT8_C(  20),  INT8_C(  87),  INT8_C( 122), -INT8_C(  26),  INT8_C(  54), -INT8_C( 119),  INT8_C(   7), -INT8_C(   5),
+        -INT8_C(  92),  INT8_C(  23),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(44603),
+      {  INT8_C( 113),  INT8_C( 120), -INT8_C(   7), -INT8_C(  25), -INT8_C(   7), -INT8_C(  54), -INT8_C(  61),  INT8_C(  88),
+        -INT8_C(  82), -INT8_C(  33), -INT8_C(  22), -INT8_C(  90), -INT8_C(  83),  INT8_C(  59),  INT8_C(  52), -INT8_C( 112) },
+      {  INT8_C( 113),  INT8_C( 120), -INT8_C(  25), -INT8_C(   7), -INT8_C(  54), -INT8_C(  33), -INT8_C(  22), -INT8_C(  90),
+         INT8_C(  59), -INT8_C( 112),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(35879),
+      {  INT8_C(  10),  INT8_C(  13), -INT8_C(  62),  INT8_C(  64), -INT8_C( 105), -INT8_C(  55),  INT8_C(  59), -INT8_C(  78),
+        -INT8_C(  57), -INT8_C(  32), -INT8_C(  54),  INT8_C(   3), -INT8_C( 114),  INT8_C(  59),  INT8_C( 123), -INT8_C( 121) },
+      {  INT8_C(  10),  INT8_C(  13), -INT8_C(  62), -INT8_C(  55), -INT8_C(  54),  INT8_C(   3), -INT8_C( 121),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(29986),
+      {  INT8_C(  81), -INT8_C(  27), -INT8_C(  51), -INT8_C(   1), -INT8_C(  59), -INT8_C(  73), -INT8_C(  91),  INT8_C( 114),
+        -INT8_C(  13), -INT8_C(  39),  INT8_C(   2),  INT8_C(  26),  INT8_C( 101),  INT8_C(  13),  INT8_C(  40),  INT8_C(  40) },
+      { -INT8_C(  27), -INT8_C(  73), -INT8_C(  13),  INT8_C(   2),  INT8_C( 101),  INT8_C(  13),  INT8_C(  40),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(48973),
+      { -INT8_C(  15), -INT8_C( 120),  INT8_C( 113), -INT8_C(  71),  INT8_C( 104),  INT8_C(  59), -INT8_C(  68), -INT8_C(  10),
+         INT8_C( 118),  INT8_C(  55),  INT8_C( 125), -INT8_C( 104), -INT8_C(  84), -INT8_C(  50),  INT8_C( 126),  INT8_C( 121) },
+      { -INT8_C(  15),  INT8_C( 113), -INT8_C(  71), -INT8_C(  68),  INT8_C( 118),  INT8_C(  55),  INT8_C( 125), -INT8_C( 104),
+        -INT8_C(  84), -INT8_C(  50),  INT8_C( 121),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(17357),
+      {  INT8_C(  49),  INT8_C( 114), -INT8_C(  75),  INT8_C(  36),  INT8_C(  76), -INT8_C(  72),  INT8_C(  62), -INT8_C(  79),
+        -INT8_C(  59),  INT8_C( 102), -INT8_C(  39),  INT8_C(  18),  INT8_C(  37), -INT8_C(  53), -INT8_C( 102), -INT8_C( 105) },
+      {  INT8_C(  49), -INT8_C(  75),  INT8_C(  36),  INT8_C(  62), -INT8_C(  79), -INT8_C(  59),  INT8_C( 102), -INT8_C( 102),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i r = simde_mm_setzero_si128();
+    simde_mm_mask_compressstoreu_epi8(&r, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m128i a = simde_test_x86_random_i8x16();
+    simde__m128i r = simde_mm_setzero_si128();
+    simde_mm_mask_compressstoreu_epi8(&r, k, a);
+
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i8x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_mask_compress_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int16_t src[8];
+    const simde__mmask8 k;
+    const int16_t a[8];
+    const int16_t r[8];
+  } test_vec[] = {
+    { {  INT16_C(   900),  INT16_C( 16594),  INT16_C( 18937),  INT16_C( 30583),  INT16_C(  9441),  INT16_C( 24389),  INT16_C(  5021), -INT16_C( 12638) },
+      UINT8_C(133),
+      { -INT16_C(  3496),  INT16_C(  4305), -INT16_C( 31951), -INT16_C( 26667), -INT16_C(  6308),  INT16_C( 10173),  INT16_C( 21633), -INT16_C( 31573) },
+      { -INT16_C(  3496), -INT16_C( 31951), -INT16_C( 31573),  INT16_C( 30583),  INT16_C(  9441),  INT16_C( 24389),  INT16_C(  5021), -INT16_C( 12638) } },
+    { { -INT16_C(  5338),  INT16_C( 28542), -INT16_C(  2717), -INT16_C( 30895), -INT16_C( 20422),  INT16_C( 19748), -INT16_C(  3245), -INT16_C( 21549) },
+      UINT8_C(229),
+      { -INT16_C( 17500),  INT16_C( 10006), -INT16_C( 20848),  INT16_C( 30596), -INT16_C( 21653), -INT16_C( 16392),  INT16_C( 32087),  INT16_C( 17125) },
+      { -INT16_C( 17500), -INT16_C( 20848), -INT16_C( 16392),  INT16_C( 32087),  INT16_C( 17125),  INT16_C( 19748), -INT16_C(  3245), -INT16_C( 21549) } },
+    { {  INT16_C( 22011), -INT16_C(  3931),  INT16_C( 11430),  INT16_C( 22058),  INT16_C( 30801),  INT16_C( 17577),  INT16_C( 21579), -INT16_C(  4311) },
+      UINT8_C( 15),
+      {  INT16_C(  5952), -INT16_C(  4449),  INT16_C(  5787),  INT16_C( 18009),  INT16_C(  6159), -INT16_C( 29539), -INT16_C(  7939),  INT16_C( 21127) },
+      {  INT16_C(  5952), -INT16_C(  4449),  INT16_C(  5787),  INT16_C( 18009),  INT16_C( 30801),  INT16_C( 17577),  INT16_C( 21579), -INT16_C(  4311) } },
+    { {  INT16_C( 30597), -INT16_C( 19720),  INT16_C( 20385),  INT16_C(  6403),  INT16_C( 18424),  INT16_C( 19812),  INT16_C( 21616), -INT16_C( 20388) },
+      UINT8_C(107),
+      { -INT16_C( 24836),  INT16_C(  4614),  INT16_C( 19703),  INT16_C(  3873), -INT16_C( 21014), -INT16_C( 13811),  INT16_C( 24372), -INT16_C( 21681) },
+      { -INT16_C( 24836),  INT16_C(  4614),  INT16_C(  3873), -INT16_C( 13811),  INT16_C( 24372),  INT16_C( 19812),  INT16_C( 21616), -INT16_C( 20388) } },
+    { {  INT16_C(   344), -INT16_C( 22707),  INT16_C( 26116),  INT16_C( 19359), -INT16_C(  4917),  INT16_C(  8124),  INT16_C( 27721),  INT16_C( 17802) },
+      UINT8_C( 11),
+      {  INT16_C( 22416), -INT16_C(  9214),  INT16_C(  4729),  INT16_C(  9926), -INT16_C( 28641),  INT16_C( 32347),  INT16_C(  1760), -INT16_C(  7722) },
+      {  INT16_C( 22416), -INT16_C(  9214),  INT16_C(  9926),  INT16_C( 19359), -INT16_C(  4917),  INT16_C(  8124),  INT16_C( 27721),  INT16_C( 17802) } },
+    { {  INT16_C( 32083), -INT16_C( 17690),  INT16_C( 12573),  INT16_C(  2437), -INT16_C( 23315),  INT16_C( 23122), -INT16_C( 26834), -INT16_C( 16795) },
+      UINT8_C(239),
+      { -INT16_C( 26009),  INT16_C( 31080), -INT16_C( 29087), -INT16_C(  3688),  INT16_C(  6121), -INT16_C(  3887), -INT16_C( 19475),  INT16_C( 27459) },
+      { -INT16_C( 26009),  INT16_C( 31080), -INT16_C( 29087), -INT16_C(  3688), -INT16_C(  3887), -INT16_C( 19475),  INT16_C( 27459), -INT16_C( 16795) } },
+    { { -INT16_C(   615), -INT16_C( 13688), -INT16_C( 28286),  INT16_C(  9912),  INT16_C(  4836),  INT16_C( 31572),  INT16_C(  4727), -INT16_C(  8598) },
+      UINT8_C(173),
+      {  INT16_C( 22738),  INT16_C( 24846), -INT16_C(    16),  INT16_C(  1866),  INT16_C( 15057), -INT16_C( 31499),  INT16_C( 24702),  INT16_C( 31517) },
+      {  INT16_C( 22738), -INT16_C(    16),  INT16_C(  1866), -INT16_C( 31499),  INT16_C( 31517),  INT16_C( 31572),  INT16_C(  4727), -INT16_C(  8598) } },
+    { { -INT16_C(  6168),  INT16_C( 31230),  INT16_C(  9375), -INT16_C( 20131), -INT16_C(  9863), -INT16_C( 29912),  INT16_C(  1859),  INT16_C(  5688) },
+      UINT8_C( 95),
+      {  INT16_C( 30534),  INT16_C( 17999),  INT16_C( 22465), -INT16_C(  1001), -INT16_C( 25780), -INT16_C( 21382), -INT16_C(  2632), -INT16_C( 24684) },
+      {  INT16_C( 30534),  INT16_C( 17999),  INT16_C( 22465), -INT16_C(  1001), -INT16_C( 25780), -INT16_C(  2632),  INT16_C(  1859),  INT16_C(  5688) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi16(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i r = simde_mm_mask_compress_epi16(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m128i src = simde_test_x86_random_i16x8();
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128i a = simde_test_x86_random_i16x8();
+    simde__m128i r = simde_mm_mask_compress_epi16(src, k, a);
+
+    simde_test_x86_write_i16x8(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i16x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i16x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_maskz_compress_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const int16_t a[8];
+    const int16_t r[8];
+  } test_vec[] = {
+    { UINT8_C(243),
+      {  INT16_C( 16141),  INT16_C( 27416), -INT16_C( 28176),  INT16_C(  6468), -INT16_C( 30948),  INT16_C( 21792),  INT16_C( 32669),  INT16_C(  5275) },
+      {  INT16_C( 16141),  INT16_C( 27416), -INT16_C( 30948),  INT16_C( 21792),  INT16_C( 32669),  INT16_C(  5275),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(206),
+      { -INT16_C( 10527), -INT16_C(  2011),  INT16_C( 29138),  INT16_C( 19603),  INT16_C( 19229), -INT16_C( 20159),  INT16_C( 13803),  INT16_C( 10943) },
+      { -INT16_C(  2011),  INT16_C( 29138),  INT16_C( 19603),  INT16_C( 13803),  INT16_C( 10943),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C( 77),
+      {  INT16_C(  6698),  INT16_C( 28382), -INT16_C(  1485),  INT16_C( 21493), -INT16_C( 27825), -INT16_C(  5166), -INT16_C( 24153),  INT16_C( 32204) },
+      {  INT16_C(  6698), -INT16_C(  1485),  INT16_C( 21493), -INT16_C( 24153),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(198),
+      {  INT16_C( 20421),  INT16_C( 22584),  INT16_C( 21915), -INT16_C(  8796), -INT16_C( 28921), -INT16_C( 14830),  INT16_C( 24505), -INT16_C( 11280) },
+      {  INT16_C( 22584),  INT16_C( 21915),  INT16_C( 24505), -INT16_C( 11280),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C( 61),
+      {  INT16_C(  1886),  INT16_C( 21303), -INT16_C( 30886),  INT16_C( 11750), -INT16_C( 29070),  INT16_C( 16078), -INT16_C( 27637),  INT16_C( 23299) },
+      {  INT16_C(  1886), -INT16_C( 30886),  INT16_C( 11750), -INT16_C( 29070),  INT16_C( 16078),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(204),
+      { -INT16_C(  2468),  INT16_C(    34),  INT16_C( 10707), -INT16_C(  6769),  INT16_C( 18671), -INT16_C(  8380), -INT16_C( 32485),  INT16_C(  8765) },
+      {  INT16_C( 10707), -INT16_C(  6769), -INT16_C( 32485),  INT16_C(  8765),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(185),
+      {  INT16_C( 32144),  INT16_C( 30528), -INT16_C( 19798),  INT16_C( 30725),  INT16_C(  4336), -INT16_C(  3060), -INT16_C(  9877),  INT16_C( 25168) },
+      {  INT16_C( 32144),  INT16_C( 30725),  INT16_C(  4336), -INT16_C(  3060),  INT16_C( 25168),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(251),
+      {  INT16_C( 13648), -INT16_C(  8412),  INT16_C(  4891),  INT16_C( 24359),  INT16_C( 17138),  INT16_C( 12257), -INT16_C( 26011), -INT16_C(  7489) },
+      {  INT16_C( 13648), -INT16_C(  8412),  INT16_C( 24359),  INT16_C( 17138),  INT16_C( 12257), -INT16_C( 26011), -INT16_C(  7489),  INT16_C(     0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i r = simde_mm_maskz_compress_epi16(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128i a = simde_test_x86_random_i16x8();
+    simde__m128i r = simde_mm_maskz_compress_epi16(k, a);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i16x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i16x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_mask_compressstoreu_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const int16_t a[8];
+    const int16_t r[8];
+  } test_vec[] = {
+    { UINT8_C(218),
+      { -INT16_C( 29642),  INT16_C( 15244),  INT16_C( 31748),  INT16_C(  4172), -INT16_C( 18576), -INT16_C( 16151), -INT16_C(  7143),  INT16_C( 20240) },
+      {  INT16_C( 15244),  INT16_C(  4172), -INT16_C( 18576), -INT16_C(  7143),  INT16_C( 20240),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(  8),
+      {  INT16_C( 27375),  INT16_C(  5659),  INT16_C(  3529), -INT16_C( 21927), -INT16_C( 16836), -INT16_C(   956),  INT16_C(  7840),  INT16_C( 11314) },
+      { -INT16_C( 21927),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(170),
+      {  INT16_C( 12398), -INT16_C( 17881), -INT16_C( 26816),  INT16_C( 10865), -INT16_C( 29864),  INT16_C( 26638),  INT16_C(  6106),  INT16_C( 17496) },
+      { -INT16_C( 17881),  INT16_C( 10865),  INT16_C( 26638),  INT16_C( 17496),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C( 50),
+      {  INT16_C(  3438), -INT16_C( 14528),  INT16_C( 31928), -INT16_C(   891),  INT16_C(  9592), -INT16_C( 21733), -INT16_C( 15023), -INT16_C( 32487) },
+      { -INT16_C( 14528),  INT16_C(  9592), -INT16_C( 21733),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(236),
+      { -INT16_C( 15661),  INT16_C( 17540), -INT16_C(  8980), -INT16_C(  1329), -INT16_C( 22204), -INT16_C( 25583),  INT16_C( 17645), -INT16_C(  1269) },
+      { -INT16_C(  8980), -INT16_C(  1329), -INT16_C( 25583),  INT16_C( 17645), -INT16_C(  1269),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(132),
+      { -INT16_C( 19502),  INT16_C( 22528),  INT16_C( 31151), -INT16_C( 13699), -INT16_C( 12508),  INT16_C( 15760),  INT16_C( 31824),  INT16_C(  4624) },
+      {  INT16_C( 31151),  INT16_C(  4624),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(  0),
+      { -INT16_C(   428),  INT16_C(  9436),  INT16_C(  8697),  INT16_C(  2765), -INT16_C( 17475), -INT16_C( 14258), -INT16_C( 11594),  INT16_C( 27035) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(211),
+      {  INT16_C(  6387),  INT16_C( 28748),  INT16_C( 28899),  INT16_C( 29503), -INT16_C( 28499), -INT16_C( 16913), -INT16_C(  3934), -INT16_C( 24303) },
+      {  INT16_C(  6387),  INT16_C( 28748), -INT16_C( 28499), -INT16_C(  3934), -INT16_C( 24303),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i r = simde_mm_setzero_si128();
+    simde_mm_mask_compressstoreu_epi16(&r, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128i a = simde_test_x86_random_i16x8();
+    simde__m128i r = simde_mm_setzero_si128();
+    simde_mm_mask_compressstoreu_epi16(&r, k, a);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i16x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i16x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_mask_compress_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int8_t src[32];
+    const simde__mmask32 k;
+    const int8_t a[32];
+    const int8_t r[32];
+  } test_vec[] = {
+    { { -INT8_C(  52),  INT8_C(  53), -INT8_C( 102), -INT8_C(  19),  INT8_C(   3), -INT8_C(  92), -INT8_C(  85), -INT8_C(  66),
+        -INT8_C(  13),  INT8_C( 115),  INT8_C( 116), -INT8_C(  59),  INT8_C(  14), -INT8_C(  35), -INT8_C( 104),  INT8_C(   1),
+        -INT8_C(  11), -INT8_C(  28),  INT8_C( 114), -INT8_C(  40),  INT8_C(  84), -INT8_C(  79),  INT8_C(  75),  INT8_C(   1),
+         INT8_C(  65),  INT8_C(  59), -INT8_C(  66), -INT8_C(  28),  INT8_C(  43), -INT8_C(  48), -INT8_C( 123), -INT8_C(   9) },
+      UINT32_C( 149233413),
+      { -INT8_C(  61), -INT8_C( 112), -INT8_C(  58), -INT8_C(  74),  INT8_C(   3),  INT8_C(  58),  INT8_C( 124),  INT8_C(  18),
+         INT8_C(  23),  INT8_C(  20),  INT8_C(  19),  INT8_C(  13), -INT8_C(   7), -INT8_C( 123), -INT8_C(  27),  INT8_C(  77),
+         INT8_C(  55),  INT8_C(  49),  INT8_C(  79),  INT8_C( 120),  INT8_C( 108),  INT8_C(  13),  INT8_C(  92), -INT8_C( 105),
+        -INT8_C(  35), -INT8_C(  31), -INT8_C( 114), -INT8_C(  29),  INT8_C(   0),  INT8_C( 115), -INT8_C(  21), -INT8_C(  60) },
+      { -INT8_C(  61), -INT8_C(  58),  INT8_C(  23),  INT8_C(  20),  INT8_C(  19),  INT8_C(  13), -INT8_C(   7),  INT8_C(  55),
+         INT8_C(  79),  INT8_C(  13),  INT8_C(  92), -INT8_C( 105), -INT8_C(  29), -INT8_C(  35), -INT8_C( 104),  INT8_C(   1),
+        -INT8_C(  11), -INT8_C(  28),  INT8_C( 114), -INT8_C(  40),  INT8_C(  84), -INT8_C(  79),  INT8_C(  75),  INT8_C(   1),
+         INT8_C(  65),  INT8_C(  59), -INT8_C(  66), -INT8_C(  28),  INT8_C(  43), -INT8_C(  48), -INT8_C( 123), -INT8_C(   9) } },
+    { {  INT8_C(   3), -INT8_C(  78),  INT8_C( 122),  INT8_C(   7), -INT8_C(  20), -INT8_C(  10),  INT8_C(  25),  INT8_C(   4),
+         INT8_C(  11),  INT8_C(  44),  INT8_C(  17),  INT8_C(   4), -INT8_C(  78), -INT8_C(  10),  INT8_C(  81), -INT8_C(  23),
+         INT8_C(  39), -INT8_C(  96),  INT8_C(  97), -INT8_C( 109), -INT8_C(  82), -INT8_C(  66),  INT8_C(  42), -INT8_C( 117),
+        -INT8_C(  97), -INT8_C(  71),  INT8_C( 110), -INT8_C(  96),  INT8_C(  44),  INT8_C(  90),  INT8_C( 100),  INT8_C(  48) },
+      UINT32_C(4164410892),
+      { -INT8_C(  43),  INT8_C(  80), -INT8_C(   4), -INT8_C(  32),  INT8_C( 124),  INT8_C(  13), -INT8_C(  28),  INT8_C(  46),
+         INT8_C(   4),  INT8_C(  53),  INT8_C(  23),  INT8_C(  43), -INT8_C(  42),  INT8_C( 121), -INT8_C(  65), -INT8_C( 124),
+         INT8_C(  55), -INT8_C(  23),  INT8_C(  15), -INT8_C(  42), -INT8_C(  94),  INT8_C( 126),  INT8_C( 118), -INT8_C(  49),
+        -INT8_C(  40), -INT8_C(  38), -INT8_C(   1), -INT8_C(  28), -INT8_C(  71),  INT8_C(  54), -INT8_C(  36), -INT8_C( 114) },
+      { -INT8_C(   4), -INT8_C(  32),  INT8_C(  53),  INT8_C(  23),  INT8_C(  43), -INT8_C(  42), -INT8_C(  65), -INT8_C( 124),
+         INT8_C(  55), -INT8_C(  23),  INT8_C(  15), -INT8_C(  94),  INT8_C( 126), -INT8_C(  28), -INT8_C(  71),  INT8_C(  54),
+        -INT8_C(  36), -INT8_C( 114),  INT8_C(  97), -INT8_C( 109), -INT8_C(  82), -INT8_C(  66),  INT8_C(  42), -INT8_C( 117),
+        -INT8_C(  97), -INT8_C(  71),  INT8_C( 110), -INT8_C(  96),  INT8_C(  44),  INT8_C(  90),  INT8_C( 100),  INT8_C(  48) } },
+    { { -INT8_C( 122), -INT8_C(  39),  INT8_C( 110),  INT8_C(   2), -INT8_C(  26),  INT8_C(  82),  INT8_C(  49), -INT8_C(  22),
+        -INT8_C( 121),  INT8_C(  72),  INT8_C(  22),  INT8_C(  93), -INT8_C(  63), -INT8_C(  43), -INT8_C(  31), -INT8_C(   8),
+        -INT8_C(  66), -INT8_C(  15), -INT8_C(  49),  INT8_C(  97),  INT8_C( 111),  INT8_C(  69),  INT8_C(  48),  INT8_C(  71),
+         INT8_C(  32),  INT8_C(  47),  INT8_C(  43), -INT8_C(  39),  INT8_C( 101),  INT8_C(   7),  INT8_C( 103), -INT8_C(  21) },
+      UINT32_C(3354252768),
+      {  INT8_C(  39),  INT8_C(  30), -INT8_C(  79), -INT8_C(  82),  INT8_C( 103), -INT8_C(  57),  INT8_C(  12),  INT8_C(  40),
+        -INT8_C( 100), -INT8_C(  19),  INT8_C(  33),  INT8_C(  91), -INT8_C(  34), -INT8_C(  16), -INT8_C(  68),  INT8_C(  77),
+         INT8_C(  53), -INT8_C(  20), -INT8_C( 108),  INT8_C(  85),  INT8_C(  27), -INT8_C(  65),  INT8_C(  46),      INT8_MIN,
+        -INT8_C(  57), -INT8_C( 107),  INT8_C( 107), -INT8_C(  89),  INT8_C( 106),  INT8_C(  88),  INT8_C( 110), -INT8_C( 111) },
+      { -INT8_C(  57),  INT8_C(  12),  INT8_C(  40), -INT8_C( 100),  INT8_C(  33), -INT8_C(  34), -INT8_C(  68),  INT8_C(  77),
+         INT8_C(  53), -INT8_C( 108),  INT8_C(  85), -INT8_C(  65),  INT8_C(  46),      INT8_MIN, -INT8_C(  57), -INT8_C( 107),
+         INT8_C( 107),  INT8_C( 110), -INT8_C( 111),  INT8_C(  97),  INT8_C( 111),  INT8_C(  69),  INT8_C(  48),  INT8_C(  71),
+         INT8_C(  32),  INT8_C(  47),  INT8_C(  43), -INT8_C(  39),  INT8_C( 101),  INT8_C(   7),  INT8_C( 103), -INT8_C(  21) } },
+    { {  INT8_C( 119),  INT8_C(  32),  INT8_C(  64), -INT8_C(  34), -INT8_C(  25),  INT8_C(  76),  INT8_C(   6), -INT8_C( 124),
+         INT8_C(  57),  INT8_C(  39), -INT8_C(  33),  INT8_C(  24),  INT8_C(  23), -INT8_C( 101),  INT8_C( 101),  INT8_C(  77),
+        -INT8_C( 121), -INT8_C(   6), -INT8_C(  94), -INT8_C(  94), -INT8_C(  71), -INT8_C(  47),  INT8_C(  34),      INT8_MIN,
+         INT8_C( 102), -INT8_C( 115),  INT8_C(  40), -INT8_C(  47), -INT8_C(  27), -INT8_C( 106),  INT8_C(  98),  INT8_C(  92) },
+      UINT32_C(2654642870),
+      { -INT8_C(  18),  INT8_C(  65),  INT8_C(  34),  INT8_C(  40),  INT8_C( 104),  INT8_C(   1),  INT8_C(  64),      INT8_MIN,
+        -INT8_C( 100), -INT8_C(  91), -INT8_C(  51),  INT8_C(  35), -INT8_C(  97),  INT8_C( 111), -INT8_C(  59),  INT8_C(  89),
+         INT8_C(  64), -INT8_C(  25), -INT8_C(  39), -INT8_C(  89),  INT8_C( 116),  INT8_C(   1),  INT8_C( 120),  INT8_C(  89),
+        -INT8_C( 104), -INT8_C(  38), -INT8_C(  74),  INT8_C(  78),  INT8_C( 125), -INT8_C(  16), -INT8_C(  20),  INT8_C( 107) },
+      {  INT8_C(  65),  INT8_C(  34),  INT8_C( 104),  INT8_C(   1),      INT8_MIN, -INT8_C(  91),  INT8_C( 111),  INT8_C(  89),
+        -INT8_C(  25), -INT8_C(  89),  INT8_C( 116),  INT8_C(   1), -INT8_C(  38), -INT8_C(  74),  INT8_C(  78),  INT8_C( 125),
+         INT8_C( 107), -INT8_C(   6), -INT8_C(  94), -INT8_C(  94), -INT8_C(  71), -INT8_C(  47),  INT8_C(  34),      INT8_MIN,
+         INT8_C( 102), -INT8_C( 115),  INT8_C(  40), -INT8_C(  47), -INT8_C(  27), -INT8_C( 106),  INT8_C(  98),  INT8_C(  92) } },
+    { {  INT8_C(  49),  INT8_C(  14), -INT8_C( 109), -INT8_C( 102),  INT8_C(  15), -INT8_C(  45),  INT8_C(  26), -INT8_C(  85),
+         INT8_C( 121), -INT8_C(  25), -INT8_C(  50),  INT8_C(  24),  INT8_C(  86), -INT8_C( 109),  INT8_C( 113), -INT8_C( 105),
+         INT8_C( 122),  INT8_C(  75),  INT8_C(  62), -INT8_C(  18),  INT8_C(  76), -INT8_C(  74),  INT8_C(  72), -INT8_C(  28),
+        -INT8_C( 112), -INT8_C(   2),  INT8_C(  51),  INT8_C(  13), -INT8_C(  18),  INT8_C(  31),  INT8_C( 121),  INT8_C(  32) },
+      UINT32_C(1035602990),
+      { -INT8_C(  32), -INT8_C(  44), -INT8_C(  23),  INT8_C(  89), -INT8_C(  69), -INT8_C(  73),  INT8_C( 113),  INT8_C(  17),
+         INT8_C(  75), -INT8_C(  29), -INT8_C(  88), -INT8_C(  59),  INT8_C(  46), -INT8_C(  26), -INT8_C(  76),  INT8_C( 122),
+        -INT8_C( 100), -INT8_C(   4),  INT8_C(  95),  INT8_C(  45), -INT8_C(   6), -INT8_C( 110),  INT8_C(  58), -INT8_C(  24),
+        -INT8_C(  79), -INT8_C(  77),  INT8_C(   8), -INT8_C(  33), -INT8_C(  64), -INT8_C(  62),  INT8_C(  29), -INT8_C(  96) },
+      { -INT8_C(  44), -INT8_C(  23),  INT8_C(  89), -INT8_C(  73), -INT8_C(  88), -INT8_C(  59), -INT8_C(   4),  INT8_C(  45),
+        -INT8_C(   6), -INT8_C( 110), -INT8_C(  24), -INT8_C(  79),  INT8_C(   8), -INT8_C(  33), -INT8_C(  64), -INT8_C(  62),
+         INT8_C( 122),  INT8_C(  75),  INT8_C(  62), -INT8_C(  18),  INT8_C(  76), -INT8_C(  74),  INT8_C(  72), -INT8_C(  28),
+        -INT8_C( 112), -INT8_C(   2),  INT8_C(  51),  INT8_C(  13), -INT8_C(  18),  INT8_C(  31),  INT8_C( 121),  INT8_C(  32) } },
+    { { -INT8_C( 106),  INT8_C(   6), -INT8_C(   7),  INT8_C(  81), -INT8_C(  67),  INT8_C( 106),  INT8_C(  99),  INT8_C(   8),
+         INT8_C(  77),  INT8_C(  11), -INT8_C(  50),  INT8_C( 123), -INT8_C(  14), -INT8_C( 126), -INT8_C(  10), -INT8_C( 114),
+         INT8_C( 126),  INT8_C(  85), -INT8_C(  69),  INT8_C( 120), -INT8_C(  25), -INT8_C(  10),  INT8_C(  96), -INT8_C( 104),
+        -INT8_C(  87),  INT8_C( 105),  INT8_C( 120),  INT8_C( 105),  INT8_C(  43), -INT8_C( 107),  INT8_C(   9), -INT8_C(  62) },
+      UINT32_C(1477640859),
+      {  INT8_C( 109),  INT8_C( 118),  INT8_C(  97), -INT8_C(  70), -INT8_C( 126),  INT8_C(  47),  INT8_C(  54),  INT8_C( 116),
+        -INT8_C(  79),  INT8_C(  44),  INT8_C(   2),  INT8_C(  47), -INT8_C( 127), -INT8_C(  66), -INT8_C(  89),  INT8_C( 104),
+        -INT8_C(  76),  INT8_C(   7),  INT8_C(   0),  INT8_C(  93),  INT8_C( 112),  INT8_C( 120), -INT8_C(  57), -INT8_C( 100),
+         INT8_C(  13), -INT8_C(  48),  INT8_C(  94), -INT8_C(  88), -INT8_C(  45),  INT8_C( 113),  INT8_C(   1),  INT8_C(  64) },
+      {  INT8_C( 109),  INT8_C( 118), -INT8_C(  70), -INT8_C( 126),  INT8_C( 116),  INT8_C(  44), -INT8_C(  76),  INT8_C(   7),
+         INT8_C( 112), -INT8_C(  88), -INT8_C(  45),  INT8_C(   1), -INT8_C(  14), -INT8_C( 126), -INT8_C(  10), -INT8_C( 114),
+         INT8_C( 126),  INT8_C(  85), -INT8_C(  69),  INT8_C( 120), -INT8_C(  25), -INT8_C(  10),  INT8_C(  96), -INT8_C( 104),
+        -INT8_C(  87),  INT8_C( 105),  INT8_C( 120),  INT8_C( 105),  INT8_C(  43), -INT8_C( 107),  INT8_C(   9), -INT8_C(  62) } },
+    { { -INT8_C(  24),  INT8_C(  98), -INT8_C(   6),  INT8_C( 106), -INT8_C( 111),  INT8_C(  48), -INT8_C(  34),  INT8_C(  66),
+         INT8_C(  92), -INT8_C(  32),  INT8_C( 113), -INT8_C(  35), -INT8_C(  98),  INT8_C(  24),  INT8_C(  69),  INT8_C(  82),
+         INT8_C(  31),  INT8_C(  70), -INT8_C(  80), -INT8_C( 112), -INT8_C(  66),  INT8_C( 119),  INT8_C(  44), -INT8_C(  52),
+         INT8_C(  71), -INT8_C( 118),  INT8_C( 116),  INT8_C(  26), -INT8_C(   5),  INT8_C( 117),  INT8_C(  90), -INT8_C(  29) },
+      UINT32_C(1749898711),
+      { -INT8_C( 123),  INT8_C(  43), -INT8_C(  86), -INT8_C(  30),  INT8_C(  12),  INT8_C(  27), -INT8_C(  65), -INT8_C(  86),
+         INT8_C(  51),  INT8_C(   5), -INT8_C(   3),  INT8_C(  83),  INT8_C(  75), -INT8_C(  83), -INT8_C(  29),  INT8_C(   9),
+         INT8_C(  36),  INT8_C(  15), -INT8_C(  43),  INT8_C( 107), -INT8_C( 103),  INT8_C(  74), -INT8_C( 122), -INT8_C( 108),
+        -INT8_C(  65), -INT8_C(  32),  INT8_C( 120), -INT8_C( 105),  INT8_C(  53), -INT8_C(  59), -INT8_C(   1), -INT8_C(  69) },
+      { -INT8_C( 123),  INT8_C(  43), -INT8_C(  86),  INT8_C(  12), -INT8_C(  65), -INT8_C(  86),  INT8_C(  51), -INT8_C(   3),
+         INT8_C(  75), -INT8_C(  29),  INT8_C(  36), -INT8_C(  43),  INT8_C( 107), -INT8_C( 122), -INT8_C( 105), -INT8_C(  59),
+        -INT8_C(   1),  INT8_C(  70), -INT8_C(  80), -INT8_C( 112), -INT8_C(  66),  INT8_C( 119),  INT8_C(  44), -INT8_C(  52),
+         INT8_C(  71), -INT8_C( 118),  INT8_C( 116),  INT8_C(  26), -INT8_C(   5),  INT8_C( 117),  INT8_C(  90), -INT8_C(  29) } },
+    { { -INT8_C(  15), -INT8_C(  86), -INT8_C(  99), -INT8_C(   3), -INT8_C(  59),  INT8_C(  92), -INT8_C(  89), -INT8_C(   7),
+         INT8_C(  97), -INT8_C(  92),  INT8_C(  76), -INT8_C(  84),  INT8_C(  81),  INT8_C(  47), -INT8_C(  74),  INT8_C( 117),
+         INT8_C(  62), -INT8_C( 117), -INT8_C(  31), -INT8_C(  41), -INT8_C(  43),  INT8_C( 103),  INT8_C( 107), -INT8_C( 107),
+         INT8_C(  71), -INT8_C(  29),  INT8_C(  44),  INT8_C( 125), -INT8_C(  87),  INT8_C(  43),  INT8_C(  56), -INT8_C( 102) },
+      UINT32_C(2610419157),
+      {  INT8_C(  49),  INT8_C(  62), -INT8_C( 108), -INT8_C( 109), -INT8_C(  29), -INT8_C(  32),  INT8_C(  63),  INT8_C(  52),
+         INT8_C(  15), -INT8_C(  11), -INT8_C(  86),  INT8_C(  77), -INT8_C( 127), -INT8_C( 117),  INT8_C(  36),  INT8_C(  86),
+        -INT8_C(  14), -INT8_C( 113), -INT8_C(  21),  INT8_C(  57),  INT8_C( 115),  INT8_C(  23), -INT8_C(  74),  INT8_C(  28),
+         INT8_C(  67), -INT8_C(  18), -INT8_C(  74),  INT8_C(  24), -INT8_C(  61),  INT8_C(  77), -INT8_C(  77), -INT8_C(  11) },
+      {  INT8_C(  49), -INT8_C( 108), -INT8_C(  29),  INT8_C(  63),  INT8_C(  52),  INT8_C(  15), -INT8_C(  86), -INT8_C( 127),
+         INT8_C(  36),  INT8_C(  86), -INT8_C(  14), -INT8_C( 113), -INT8_C(  21),  INT8_C( 115),  INT8_C(  28),  INT8_C(  67),
+        -INT8_C(  18),  INT8_C(  24), -INT8_C(  61), -INT8_C(  11), -INT8_C(  43),  INT8_C( 103),  INT8_C( 107), -INT8_C( 107),
+         INT8_C(  71), -INT8_C(  29),  INT8_C(  44),  INT8_C( 125), -INT8_C(  87),  INT8_C(  43),  INT8_C(  56), -INT8_C( 102) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi8(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i r = simde_mm256_mask_compress_epi8(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x32(r, simde_x_mm256_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m256i src = simde_test_x86_random_i8x32();
+    simde__mmask32 k = simde_test_x86_random_mmask32();
+    simde__m256i a = simde_test_x86_random_i8x32();
+    simde__m256i r = simde_mm256_mask_compress_epi8(src, k, a);
+
+    simde_test_x86_write_i8x32(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask32(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x32(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_maskz_compress_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask32 k;
+    const int8_t a[32];
+    const int8_t r[32];
+  } test_vec[] = {
+    { UINT32_C(1854424971),
+      {  INT8_C(  39), -INT8_C(  57), -INT8_C(  93),  INT8_C(  54), -INT8_C(  67),  INT8_C(  77), -INT8_C( 125),  INT8_C(  62),
+        -INT8_C(  40), -INT8_C(  89), -INT8_C( 108), -INT8_C(  54),  INT8_C(  55),      INT8_MIN,  INT8_C(   3), -INT8_C(  86),
+        -INT8_C( 105), -INT8_C(  70), -INT8_C(  58), -INT8_C(  38), -INT8_C(  88),  INT8_C( 124), -INT8_C(  13),  INT8_C( 108),
+        -INT8_C(  55), -INT8_C(  90),  INT8_C(  97),  INT8_C(  84), -INT8_C(  18), -INT8_C(  23), -INT8_C(  61),  INT8_C(  21) },
+      {  INT8_C(  39), -INT8_C(  57),  INT8_C(  54),  INT8_C(  62), -INT8_C(  40), -INT8_C(  89), -INT8_C( 108),  INT8_C(   3),
+        -INT8_C(  38),  INT8_C( 108), -INT8_C(  90),  INT8_C(  97),  INT8_C(  84), -INT8_C(  23), -INT8_C(  61),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(1833723568),
+      { -INT8_C(  77), -INT8_C(  49), -INT8_C(  85), -INT8_C( 117),  INT8_C( 119),  INT8_C(  64),  INT8_C(  85), -INT8_C(  82),
+        -INT8_C(  64),  INT8_C(  88),  INT8_C(  88),  INT8_C(  87),  INT8_C(  18),  INT8_C(  30),  INT8_C(  50), -INT8_C(  69),
+        -INT8_C( 102),  INT8_C(  37),  INT8_C(  39),  INT8_C(  99), -INT8_C(  53), -INT8_C( 120), -INT8_C(  73), -INT8_C(  71),
+         INT8_C( 113),  INT8_C( 122), -INT8_C(  49),  INT8_C(  33), -INT8_C(  32),  INT8_C(  27), -INT8_C( 113), -INT8_C( 109) },
+      {  INT8_C( 119),  INT8_C(  64), -INT8_C(  82),  INT8_C(  88),  INT8_C(  88),  INT8_C(  30),  INT8_C(  50),  INT8_C(  39),
+         INT8_C(  99), -INT8_C(  73),  INT8_C( 113), -INT8_C(  49),  INT8_C(  33),  INT8_C(  27), -INT8_C( 113),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(1629371114),
+      {  INT8_C( 122),  INT8_C( 115),  INT8_C(  15),  INT8_C(  58), -INT8_C(  52),  INT8_C( 103), -INT8_C( 110), -INT8_C(  34),
+        -INT8_C( 123), -INT8_C(  60), -INT8_C( 103),  INT8_C(  31), -INT8_C(  23), -INT8_C(  64), -INT8_C( 126), -INT8_C(  76),
+         INT8_C(  72),  INT8_C(  58),  INT8_C( 110), -INT8_C(  71), -INT8_C(  76),  INT8_C(  61), -INT8_C(  37), -INT8_C( 107),
+         INT8_C(  88),  INT8_C( 106),  INT8_C(  40),  INT8_C(  66), -INT8_C(  92),  INT8_C(  71), -INT8_C(  92),  INT8_C(  31) },
+      {  INT8_C( 115),  INT8_C(  58),  INT8_C( 103), -INT8_C( 110), -INT8_C(  34), -INT8_C(  60),  INT8_C(  31), -INT8_C(  23),
+        -INT8_C(  64),  INT8_C(  58),  INT8_C( 110), -INT8_C(  71), -INT8_C(  76),  INT8_C(  88),  INT8_C(  71), -INT8_C(  92),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(2254025658),
+      {  INT8_C(  27), -INT8_C(  21),  INT8_C( 101), -INT8_C(  96), -INT8_C(  81), -INT8_C(   2), -INT8_C(  64), -INT8_C( 104),
+        -INT8_C(  65),  INT8_C(  66),  INT8_C(  77),  INT8_C(   7),  INT8_C( 124), -INT8_C(  69), -INT8_C(  63),  INT8_C(  49),
+        -INT8_C(   8), -INT8_C( 100), -INT8_C(  58),  INT8_C(  80),  INT8_C(   6), -INT8_C(  18), -INT8_C( 110), -INT8_C(  86),
+         INT8_C(  53),  INT8_C(  54), -INT8_C(  55), -INT8_C(  16), -INT8_C(  22),  INT8_C(  35),  INT8_C( 118),  INT8_C(   5) },
+      { -INT8_C(  21), -INT8_C(  96), -INT8_C(  81), -INT8_C(   2), -INT8_C( 104), -INT8_C(  65),  INT8_C(  66),  INT8_C( 124),
+        -INT8_C(  69),  INT8_C(  49), -INT8_C(   8),  INT8_C(  80),  INT8_C(   6), -INT8_C( 110),  INT8_C(  54), -INT8_C(  55),
+         INT8_C(   5),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(3198540558),
+      { -INT8_C(  38),  INT8_C( 101),  INT8_C(  86), -INT8_C( 103), -INT8_C(  88), -INT8_C(  93), -INT8_C(  96),  INT8_C(  36),
+         INT8_C(  94),  INT8_C(  97),  INT8_C(  85),  INT8_C(  86), -INT8_C(   3),  INT8_C(  27), -INT8_C(  90),  INT8_C(   3),
+         INT8_C(  10),  INT8_C(  57), -INT8_C(  82),  INT8_C(  63),  INT8_C( 111),  INT8_C( 119),  INT8_C(  47),  INT8_C(  89),
+        -INT8_C( 102), -INT8_C(  90),  INT8_C(  94), -INT8_C(  87), -INT8_C( 127),  INT8_C(   4),  INT8_C( 103),  INT8_C(  91) },
+      {  INT8_C( 101),  INT8_C(  86), -INT8_C( 103),  INT8_C(  94),  INT8_C(  97),  INT8_C(  86), -INT8_C(   3), -INT8_C(  90),
+         INT8_C(   3),  INT8_C(  10), -INT8_C(  82),  INT8_C( 119),  INT8_C(  89), -INT8_C(  90),  INT8_C(  94), -INT8_C(  87),
+        -INT8_C( 127),  INT8_C(   4),  INT8_C(  91),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C( 301251945),
+      {  INT8_C(  97), -INT8_C( 107),  INT8_C(  54), -INT8_C(  65), -INT8_C(  10), -INT8_C( 117),  INT8_C(  22), -INT8_C(  12),
+        -INT8_C(  89), -INT8_C(  68), -INT8_C(   9), -INT8_C(  79), -INT8_C(  11), -INT8_C(  91), -INT8_C(  16),  INT8_C( 101),
+         INT8_C(  29),  INT8_C(  32), -INT8_C(  66), -INT8_C(  73), -INT8_C(  58),  INT8_C(  29),  INT8_C(  96),  INT8_C(  71),
+         INT8_C(  33), -INT8_C(  57), -INT8_C(  93), -INT8_C( 118), -INT8_C( 123), -INT8_C( 105), -INT8_C( 100), -INT8_C(  26) },
+      {  INT8_C(  97), -INT8_C(  65), -INT8_C( 117),  INT8_C(  22), -INT8_C(  89), -INT8_C(   9), -INT8_C(  79), -INT8_C(  11),
+        -INT8_C(  91),  INT8_C( 101), -INT8_C(  66), -INT8_C(  58),  INT8_C(  29),  INT8_C(  96),  INT8_C(  71),  INT8_C(  33),
+        -INT8_C( 123),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C( 598069804),
+      {  INT8_C(  93), -INT8_C(  69),  INT8_C(  23),  INT8_C(   4),  INT8_C( 120),  INT8_C(  14), -INT8_C(  75),  INT8_C( 109),
+        -INT8_C(  76), -INT8_C(  90), -INT8_C(  46), -INT8_C(  47), -INT8_C(  58), -INT8_C( 111), -INT8_C( 120), -INT8_C( 116),
+        -INT8_C(  82), -INT8_C(  23), -INT8_C(  45), -INT8_C(  49), -INT8_C(  80),  INT8_C( 118),  INT8_C(  89),  INT8_C(  53),
+         INT8_C(  14), -INT8_C(  11),  INT8_C(  27),  INT8_C(  58), -INT8_C(  57), -INT8_C(  63),  INT8_C(  93),  INT8_C(  37) },
+      {  INT8_C(  23),  INT8_C(   4),  INT8_C(  14), -INT8_C(  90), -INT8_C(  58), -INT8_C( 120), -INT8_C( 116), -INT8_C(  82),
+        -INT8_C(  45),  INT8_C( 118),  INT8_C(  53),  INT8_C(  14), -INT8_C(  11), -INT8_C(  63),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(4096357500),
+      { -INT8_C( 125), -INT8_C(  33),  INT8_C(  98),  INT8_C(  55), -INT8_C( 123),  INT8_C(  52),  INT8_C(   8),  INT8_C(  75),
+        -INT8_C(  59), -INT8_C( 112), -INT8_C(  41),  INT8_C( 115),  INT8_C( 121), -INT8_C(  86),  INT8_C(  66),  INT8_C(  42),
+         INT8_C(  33), -INT8_C( 100),  INT8_C(  95),  INT8_C(  47), -INT8_C( 111),  INT8_C( 123),  INT8_C( 105),  INT8_C(  89),
+         INT8_C(  60), -INT8_C(  57),  INT8_C( 126), -INT8_C(  72),  INT8_C(  59), -INT8_C(  89), -INT8_C(  83), -INT8_C(  66) },
+      {  INT8_C(  98),  INT8_C(  55), -INT8_C( 123),  INT8_C(  52),  INT8_C(   8), -INT8_C(  41),  INT8_C( 121), -INT8_C(  86),
+         INT8_C(  66),  INT8_C(  33),  INT8_C(  47),  INT8_C( 123),  INT8_C( 126),  INT8_C(  59), -INT8_C(  89), -INT8_C(  83),
+        -INT8_C(  66),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i r = simde_mm256_maskz_compress_epi8(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x32(r, simde_x_mm256_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask32 k = simde_test_x86_random_mmask32();
+    simde__m256i a = simde_test_x86_random_i8x32();
+    simde__m256i r = simde_mm256_maskz_compress_epi8(k, a);
+
+    simde_test_x86_write_mmask32(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i8x32(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_mask_compressstoreu_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask32 k;
+    const int8_t a[32];
+    const int8_t r[32];
+  } test_vec[] = {
+    { UINT32_C( 200609670),
+      {  INT8_C(  67), -INT8_C(   3),  INT8_C(  86),  INT8_C(   9), -INT8_C( 114),  INT8_C(  45),  INT8_C( 124),  INT8_C(   7),
+        -INT8_C(  40), -INT8_C(  65),  INT8_C(  49), -INT8_C(   7),  INT8_C(  91), -INT8_C( 111),  INT8_C(  40), -INT8_C(  20),
+         INT8_C(  12), -INT8_C( 111),  INT8_C(  69),  INT8_C(  72),  INT8_C(  88), -INT8_C(  61),  INT8_C(   0), -INT8_C( 108),
+         INT8_C( 107), -INT8_C(  83),  INT8_C(  82), -INT8_C(  15), -INT8_C(  68),  INT8_C(  72), -INT8_C(   3),  INT8_C(   0) },
+      { -INT8_C(   3),  INT8_C(  86),  INT8_C(   7), -INT8_C(  40), -INT8_C(  65),  INT8_C(  49), -INT8_C(   7),  INT8_C(  12),
+         INT8_C(  69),  INT8_C(  88), -INT8_C(  61),  INT8_C(   0), -INT8_C( 108),  INT8_C( 107), -INT8_C(  83), -INT8_C(  15),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(3540603717),
+      { -INT8_C( 127), -INT8_C( 123), -INT8_C(  37),  INT8_C(  89),  INT8_C(  68),  INT8_C(  12),  INT8_C(  82), -INT8_C(  97),
+        -INT8_C(  99),  INT8_C( 122), -INT8_C( 116), -INT8_C(  87),  INT8_C(  11), -INT8_C(  47), -INT8_C(  15),  INT8_C( 100),
+        -INT8_C( 107), -INT8_C(  14), -INT8_C(   8),  INT8_C(   0), -INT8_C(  97),  INT8_C(  74), -INT8_C(  15),  INT8_C(  92),
+        -INT8_C( 110), -INT8_C(  18),  INT8_C(  92), -INT8_C(  40),  INT8_C(  66),  INT8_C( 101), -INT8_C(  85), -INT8_C(  61) },
+      { -INT8_C( 127), -INT8_C(  37),  INT8_C(  82), -INT8_C(  99),  INT8_C( 122),  INT8_C(  11), -INT8_C(  15), -INT8_C( 107),
+         INT8_C(   0), -INT8_C( 110), -INT8_C(  18),  INT8_C(  66), -INT8_C(  85), -INT8_C(  61),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C( 790398698),
+      { -INT8_C( 109),  INT8_C( 110), -INT8_C(  50),  INT8_C(  48), -INT8_C(  24),  INT8_C(  90), -INT8_C(  38), -INT8_C(  13),
+         INT8_C(  44), -INT8_C(  53),  INT8_C(  87), -INT8_C(  63), -INT8_C(  67),  INT8_C(  79), -INT8_C(  63),  INT8_C(  93),
+        -INT8_C( 102), -INT8_C(  78), -INT8_C(  71),  INT8_C(  44), -INT8_C(  95),  INT8_C(  21),  INT8_C(   4), -INT8_C(  29),
+         INT8_C( 122), -INT8_C(  80), -INT8_C(  90),  INT8_C( 100),  INT8_C(  54), -INT8_C(  62), -INT8_C( 109), -INT8_C(  55) },
+      {  INT8_C( 110),  INT8_C(  48),  INT8_C(  90), -INT8_C(  38), -INT8_C(  13), -INT8_C(  53),  INT8_C(  87),  INT8_C(  93),
+        -INT8_C(  71),  INT8_C(  44), -INT8_C(  95),  INT8_C( 122), -INT8_C(  80), -INT8_C(  90),  INT8_C( 100), -INT8_C(  62),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C( 419062320),
+      { -INT8_C(  68), -INT8_C(  44),  INT8_C(  11), -INT8_C(  24), -INT8_C(  97),  INT8_C(  99), -INT8_C(  87),  INT8_C(  93),
+        -INT8_C(  78),  INT8_C( 106), -INT8_C(  70),  INT8_C(  76),  INT8_C(  29),  INT8_C( 115),  INT8_C( 121), -INT8_C(  66),
+        -INT8_C( 120),  INT8_C( 125), -INT8_C(  95),  INT8_C(   2),  INT8_C(  45),  INT8_C(  71),  INT8_C( 102),  INT8_C( 100),
+         INT8_C(   9), -INT8_C(   6),  INT8_C(  45),  INT8_C(  57),  INT8_C(  92),  INT8_C(  39),  INT8_C(  81),  INT8_C(  24) },
+      { -INT8_C(  97),  INT8_C(  99),  INT8_C( 106),  INT8_C( 115),  INT8_C( 121),  INT8_C( 125),  INT8_C(   2),  INT8_C(  45),
+         INT8_C(  71),  INT8_C( 102),  INT8_C( 100),  INT8_C(  57),  INT8_C(  92),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(2600557819),
+      { -INT8_C(  65), -INT8_C(  86), -INT8_C(   8),  INT8_C( 114),  INT8_C(  21), -INT8_C(  78), -INT8_C(  66),  INT8_C(  50),
+         INT8_C(  37),  INT8_C(  55), -INT8_C(  16), -INT8_C(  83), -INT8_C(  75), -INT8_C( 111), -INT8_C(  81), -INT8_C(  30),
+        -INT8_C(  40),  INT8_C(  21),  INT8_C(  70), -INT8_C(  31),  INT8_C(  15),  INT8_C( 116),  INT8_C(  26),  INT8_C( 107),
+        -INT8_C( 101),  INT8_C( 107), -INT8_C( 124), -INT8_C( 105), -INT8_C(  57), -INT8_C( 123),  INT8_C(  50), -INT8_C( 121) },
+      { -INT8_C(  65), -INT8_C(  86),  INT8_C( 114),  INT8_C(  21), -INT8_C(  78), -INT8_C(  66),  INT8_C(  50), -INT8_C(  16),
+        -INT8_C(  83), -INT8_C(  75), -INT8_C(  81), -INT8_C(  40), -INT8_C( 101),  INT8_C( 107), -INT8_C( 105), -INT8_C(  57),
+        -INT8_C( 121),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(1157179951),
+      { -INT8_C(  36), -INT8_C(  73),  INT8_C( 118),  INT8_C(   1), -INT8_C(  17),  INT8_C( 102), -INT8_C(  82), -INT8_C(  92),
+        -INT8_C(   9),  INT8_C(  93), -INT8_C( 122), -INT8_C(  49),  INT8_C( 114), -INT8_C(  51), -INT8_C(  80), -INT8_C( 126),
+         INT8_C(  65), -INT8_C(  54), -INT8_C(  19), -INT8_C(  36),  INT8_C(  53),  INT8_C( 113),  INT8_C( 115), -INT8_C(   3),
+        -INT8_C(  10), -INT8_C(  91), -INT8_C( 124),  INT8_C(  38), -INT8_C(  49),  INT8_C( 125),  INT8_C( 106), -INT8_C(  85) },
+      { -INT8_C(  36), -INT8_C(  73),  INT8_C( 118),  INT8_C(   1),  INT8_C( 102),  INT8_C(  93), -INT8_C(  49), -INT8_C(  51),
+         INT8_C(  65), -INT8_C(  36),  INT8_C(  53),  INT8_C( 113),  INT8_C( 115), -INT8_C(   3), -INT8_C( 124),  INT8_C( 106),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C( 598532404),
+      {  INT8_C(  71),  INT8_C(  90), -INT8_C(  57),  INT8_C(  63), -INT8_C(  73),  INT8_C(  78),  INT8_C(  14),  INT8_C(  42),
+         INT8_C(  27), -INT8_C(  65), -INT8_C(  84),  INT8_C(  92), -INT8_C( 119), -INT8_C( 103),  INT8_C(  56), -INT8_C(  65),
+         INT8_C(  11), -INT8_C(  84), -INT8_C(  68),  INT8_C(   1),  INT8_C(  81),  INT8_C(  64),  INT8_C(  39),  INT8_C(  33),
+        -INT8_C(  67), -INT8_C( 110), -INT8_C(  52), -INT8_C(  15),  INT8_C( 115),  INT8_C( 121),  INT8_C(  21), -INT8_C(  70) },
+      { -INT8_C(  57), -INT8_C(  73),  INT8_C(  78),  INT8_C(  27), -INT8_C( 103),  INT8_C(  56), -INT8_C(  65), -INT8_C(  68),
+         INT8_C(   1),  INT8_C(  64),  INT8_C(  33), -INT8_C(  67), -INT8_C( 110),  INT8_C( 121),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(2348408019),
+      {  INT8_C(  42),  INT8_C(   8), -INT8_C(  75),  INT8_C(  69), -INT8_C(  57),  INT8_C(  97), -INT8_C(  95),  INT8_C(  80),
+        -INT8_C(   6), -INT8_C(  38),  INT8_C(  15),  INT8_C(   5), -INT8_C( 122), -INT8_C(  53),  INT8_C(   7), -INT8_C(  41),
+         INT8_C(  11),  INT8_C(  46), -INT8_C(   8), -INT8_C(  56), -INT8_C(  64), -INT8_C(  59), -INT8_C(  70),  INT8_C(  51),
+         INT8_C(  62), -INT8_C(  49), -INT8_C(  18),  INT8_C(  17), -INT8_C(  85), -INT8_C(  25), -INT8_C( 100), -INT8_C(  42) },
+      {  INT8_C(  42),  INT8_C(   8), -INT8_C(  57), -INT8_C(  95),  INT8_C(  80),  INT8_C(  15),  INT8_C(   5), -INT8_C( 122),
+         INT8_C(   7), -INT8_C(  41),  INT8_C(  11), -INT8_C(  56), -INT8_C(  64), -INT8_C(  59), -INT8_C(  70),  INT8_C(  51),
+         INT8_C(  62), -INT8_C(  49),  INT8_C(  17), -INT8_C(  42),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i r = simde_mm256_setzero_si256();
+    simde_mm256_mask_compressstoreu_epi8(&r, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x32(r, simde_x_mm256_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask32 k = simde_test_x86_random_mmask32();
+    simde__m256i a = simde_test_x86_random_i8x32();
+    simde__m256i r = simde_mm256_setzero_si256();
+    simde_mm256_mask_compressstoreu_epi8(&r, k, a);
+
+    simde_test_x86_write_mmask32(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i8x32(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_mask_compress_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int16_t src[16];
+    const simde__mmask16 k;
+    const int16_t a[16];
+    const int16_t r[16];
+  } test_vec[] = {
+    { {  INT16_C( 20975), -INT16_C( 18917), -INT16_C( 16974), -INT16_C( 21241),  INT16_C(  5783),  INT16_C(  7602), -INT16_C( 17950), -INT16_C(  4620),
+        -INT16_C(  4632), -INT16_C( 22346),  INT16_C( 28850), -INT16_C(  3876), -INT16_C( 13761), -INT16_C(  5631), -INT16_C( 24911), -INT16_C( 24128) },
+      UINT16_C(56559),
+      { -INT16_C( 23977),  INT16_C( 24217),  INT16_C( 12367),  INT16_C(   373),  INT16_C( 22349),  INT16_C( 16827), -INT16_C( 23740), -INT16_C(  1490),
+        -INT16_C(  8117),  INT16_C( 10090), -INT16_C( 22064), -INT16_C( 11535), -INT16_C( 23660),  INT16_C( 21616),  INT16_C( 24388), -INT16_C( 25808) },
+      { -INT16_C( 23977),  INT16_C( 24217),  INT16_C( 12367),  INT16_C(   373),  INT16_C( 16827), -INT16_C( 23740), -INT16_C(  1490), -INT16_C( 22064),
+        -INT16_C( 11535), -INT16_C( 23660),  INT16_C( 24388), -INT16_C( 25808), -INT16_C( 13761), -INT16_C(  5631), -INT16_C( 24911), -INT16_C( 24128) } },
+    { { -INT16_C( 14079),  INT16_C( 20730),  INT16_C( 28665),  INT16_C( 18002),  INT16_C(  3526),  INT16_C(  2696), -INT16_C( 18768), -INT16_C(  1275),
+         INT16_C( 28567),  INT16_C( 26403),  INT16_C(  5145), -INT16_C( 21191), -INT16_C( 22089), -INT16_C(  1279),  INT16_C( 12809),  INT16_C(  2711) },
+      UINT16_C(37371),
+      { -INT16_C(  2725), -INT16_C( 21248), -INT16_C( 14789), -INT16_C( 15430),  INT16_C( 27344), -INT16_C( 10886),  INT16_C(  4453), -INT16_C( 30651),
+         INT16_C( 24184), -INT16_C( 19811),  INT16_C( 21515),  INT16_C(  3163),  INT16_C( 25680), -INT16_C(  6338),  INT16_C( 14959), -INT16_C( 13704) },
+      { -INT16_C(  2725), -INT16_C( 21248), -INT16_C( 15430),  INT16_C( 27344), -INT16_C( 10886),  INT16_C(  4453), -INT16_C( 30651),  INT16_C( 24184),
+         INT16_C( 25680), -INT16_C( 13704),  INT16_C(  5145), -INT16_C( 21191), -INT16_C( 22089), -INT16_C(  1279),  INT16_C( 12809),  INT16_C(  2711) } },
+    { {  INT16_C( 30767),  INT16_C( 27255),  INT16_C( 12606),  INT16_C(  3630), -INT16_C( 22373),  INT16_C(   228),  INT16_C( 10681),  INT16_C( 12681),
+         INT16_C(  9863), -INT16_C( 27933),  INT16_C( 16250), -INT16_C( 13666), -INT16_C(  8797),  INT16_C(  4785),  INT16_C( 10519),  INT16_C( 18140) },
+      UINT16_C(21409),
+      { -INT16_C(  8272), -INT16_C(  8572),  INT16_C(  8174), -INT16_C( 11642),  INT16_C( 16160), -INT16_C( 22021), -INT16_C( 32143),  INT16_C( 21711),
+         INT16_C( 18708), -INT16_C( 19821),  INT16_C( 14100), -INT16_C( 14961), -INT16_C( 22967),  INT16_C(  9967), -INT16_C( 28436), -INT16_C( 25223) },
+      { -INT16_C(  8272), -INT16_C( 22021),  INT16_C( 21711),  INT16_C( 18708), -INT16_C( 19821), -INT16_C( 22967), -INT16_C( 28436),  INT16_C( 12681),
+         INT16_C(  9863), -INT16_C( 27933),  INT16_C( 16250), -INT16_C( 13666), -INT16_C(  8797),  INT16_C(  4785),  INT16_C( 10519),  INT16_C( 18140) } },
+    { { -INT16_C(   400),  INT16_C( 24187),  INT16_C(   541),  INT16_C( 15664),  INT16_C( 11073), -INT16_C( 19738), -INT16_C( 19027), -INT16_C( 16121),
+        -INT16_C( 25857),  INT16_C(  4979),  INT16_C(   977),  INT16_C(  7128), -INT16_C( 14423), -INT16_C( 27071), -INT16_C( 17832), -INT16_C( 14285) },
+      UINT16_C(44728),
+      { -INT16_C( 10714),  INT16_C( 22192), -INT16_C(  3565), -INT16_C(  1407),  INT16_C( 11940), -INT16_C( 21585), -INT16_C( 20753),  INT16_C( 25158),
+         INT16_C(  6081), -INT16_C( 26011),  INT16_C(  3890),  INT16_C( 29537), -INT16_C( 18011), -INT16_C( 10194), -INT16_C(  6527), -INT16_C( 22650) },
+      { -INT16_C(  1407),  INT16_C( 11940), -INT16_C( 21585),  INT16_C( 25158), -INT16_C( 26011),  INT16_C(  3890),  INT16_C( 29537), -INT16_C( 10194),
+        -INT16_C( 22650),  INT16_C(  4979),  INT16_C(   977),  INT16_C(  7128), -INT16_C( 14423), -INT16_C( 27071), -INT16_C( 17832), -INT16_C( 14285) } },
+    { {  INT16_C( 14268), -INT16_C( 12035),  INT16_C( 32297), -INT16_C( 12854),  INT16_C( 31148), -INT16_C( 25735), -INT16_C( 16600), -INT16_C(  5634),
+         INT16_C( 25558),  INT16_C(  2435), -INT16_C(  6798),  INT16_C(  6012), -INT16_C( 21858),  INT16_C(  8431),  INT16_C( 30353),  INT16_C( 19911) },
+      UINT16_C(50605),
+      { -INT16_C( 10723), -INT16_C(  6333), -INT16_C(  3933),  INT16_C(  7265), -INT16_C( 30325), -INT16_C( 30245), -INT16_C( 19854), -INT16_C(  2323),
+         INT16_C( 24507),  INT16_C( 14299),  INT16_C( 31095),  INT16_C( 26338),  INT16_C( 29593),  INT16_C( 25052), -INT16_C( 30272), -INT16_C(  8666) },
+      { -INT16_C( 10723), -INT16_C(  3933),  INT16_C(  7265), -INT16_C( 30245), -INT16_C(  2323),  INT16_C( 24507),  INT16_C( 31095), -INT16_C( 30272),
+        -INT16_C(  8666),  INT16_C(  2435), -INT16_C(  6798),  INT16_C(  6012), -INT16_C( 21858),  INT16_C(  8431),  INT16_C( 30353),  INT16_C( 19911) } },
+    { {  INT16_C( 26975),  INT16_C(   965),  INT16_C(  9817), -INT16_C(  6881), -INT16_C(  1105),  INT16_C(  8814),  INT16_C( 23469),  INT16_C( 26648),
+        -INT16_C(  3141),  INT16_C( 12959), -INT16_C( 32404),  INT16_C(  1688),  INT16_C( 30196), -INT16_C( 19097), -INT16_C( 29186),  INT16_C( 24211) },
+      UINT16_C(22774),
+      {  INT16_C( 20577), -INT16_C( 32641),  INT16_C( 11829), -INT16_C( 23685),  INT16_C( 10320),  INT16_C( 26879), -INT16_C( 17776),  INT16_C( 12379),
+        -INT16_C( 14100), -INT16_C( 31567), -INT16_C( 22834),  INT16_C( 13817), -INT16_C(  1957), -INT16_C(  4414), -INT16_C( 18346), -INT16_C( 18618) },
+      { -INT16_C( 32641),  INT16_C( 11829),  INT16_C( 10320),  INT16_C( 26879), -INT16_C( 17776),  INT16_C( 12379),  INT16_C( 13817), -INT16_C(  1957),
+        -INT16_C( 18346),  INT16_C( 12959), -INT16_C( 32404),  INT16_C(  1688),  INT16_C( 30196), -INT16_C( 19097), -INT16_C( 29186),  INT16_C( 24211) } },
+    { { -INT16_C( 15096),  INT16_C( 15671), -INT16_C( 19468),  INT16_C( 17633), -INT16_C(  7973),  INT16_C( 27821),  INT16_C(  2202), -INT16_C( 31076),
+         INT16_C( 19920), -INT16_C( 25078),  INT16_C(  1267),  INT16_C( 20179), -INT16_C( 27140),  INT16_C( 21052), -INT16_C( 31922),  INT16_C( 22025) },
+      UINT16_C(16456),
+      {  INT16_C( 15508),  INT16_C( 30195), -INT16_C( 12415),  INT16_C( 11861), -INT16_C(  4293), -INT16_C( 10442),  INT16_C(  1909),  INT16_C( 32548),
+         INT16_C(  6309),  INT16_C( 31107),  INT16_C( 32614), -INT16_C( 23794),  INT16_C( 23761), -INT16_C(  9690),  INT16_C( 28339),  INT16_C( 18203) },
+      {  INT16_C( 11861),  INT16_C(  1909),  INT16_C( 28339),  INT16_C( 17633), -INT16_C(  7973),  INT16_C( 27821),  INT16_C(  2202), -INT16_C( 31076),
+         INT16_C( 19920), -INT16_C( 25078),  INT16_C(  1267),  INT16_C( 20179), -INT16_C( 27140),  INT16_C( 21052), -INT16_C( 31922),  INT16_C( 22025) } },
+    { {  INT16_C(  3755),  INT16_C( 11452),  INT16_C(  4573),  INT16_C(  6234), -INT16_C( 28672),  INT16_C( 30191),  INT16_C(  5271),  INT16_C( 15860),
+         INT16_C( 30764), -INT16_C( 27978), -INT16_C( 15113), -INT16_C( 14027),  INT16_C( 23329), -INT16_C( 11101), -INT16_C( 16694),  INT16_C( 29979) },
+      UINT16_C(55245),
+      { -INT16_C( 21855), -INT16_C(  1048), -INT16_C(  5949), -INT16_C( 19829),  INT16_C(  9053),  INT16_C( 20934), -INT16_C(  3488),  INT16_C(  5833),
+        -INT16_C( 15995), -INT16_C( 17702), -INT16_C(  1142),  INT16_C( 11542), -INT16_C(  7985), -INT16_C(  5396), -INT16_C( 18091), -INT16_C(  2367) },
+      { -INT16_C( 21855), -INT16_C(  5949), -INT16_C( 19829), -INT16_C(  3488),  INT16_C(  5833), -INT16_C( 15995), -INT16_C( 17702), -INT16_C(  1142),
+        -INT16_C(  7985), -INT16_C( 18091), -INT16_C(  2367), -INT16_C( 14027),  INT16_C( 23329), -INT16_C( 11101), -INT16_C( 16694),  INT16_C( 29979) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi16(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256i r = simde_mm256_mask_compress_epi16(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x16(r, simde_x_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m256i src = simde_test_x86_random_i16x16();
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m256i a = simde_test_x86_random_i16x16();
+    simde__m256i r = simde_mm256_mask_compress_epi16(src, k, a);
+
+    simde_test_x86_write_i16x16(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i16x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i16x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_maskz_compress_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask16 k;
+    const int16_t a[16];
+    const int16_t r[16];
+  } test_vec[] = {
+    { UINT16_C(43363),
+      {  INT16_C(  9969),  INT16_C( 31889), -INT16_C(  4391), -INT16_C( 24673), -INT16_C(   192),  INT16_C(  2450),  INT16_C(  5909), -INT16_C(  3894),
+         INT16_C( 21713), -INT16_C(  6165), -INT16_C( 17534),  INT16_C( 28359),  INT16_C(  7333),  INT16_C( 26407), -INT16_C( 30190),  INT16_C(   784) },
+      {  INT16_C(  9969),  INT16_C( 31889),  INT16_C(  2450),  INT16_C(  5909),  INT16_C( 21713),  INT16_C( 28359),  INT16_C( 26407),  INT16_C(   784),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(41649),
+      { -INT16_C( 30080),  INT16_C(  8080), -INT16_C( 12247), -INT16_C( 17633),  INT16_C( 13530), -INT16_C( 23342), -INT16_C( 23516),  INT16_C(  4345),
+         INT16_C( 31627),  INT16_C( 21451),  INT16_C( 28905),  INT16_C(  4207), -INT16_C( 32041), -INT16_C(  5990),  INT16_C( 19333),  INT16_C(  1418) },
+      { -INT16_C( 30080),  INT16_C( 13530), -INT16_C( 23342),  INT16_C(  4345),  INT16_C( 21451), -INT16_C(  5990),  INT16_C(  1418),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C( 6869),
+      { -INT16_C(   219),  INT16_C( 17643), -INT16_C( 14918), -INT16_C( 29320), -INT16_C( 25239),  INT16_C( 25137), -INT16_C( 17235),  INT16_C( 30941),
+        -INT16_C( 14833),  INT16_C( 32744), -INT16_C( 16170),  INT16_C( 28929), -INT16_C( 31064),  INT16_C( 12988), -INT16_C( 28020), -INT16_C( 20148) },
+      { -INT16_C(   219), -INT16_C( 14918), -INT16_C( 25239), -INT16_C( 17235),  INT16_C( 30941),  INT16_C( 32744),  INT16_C( 28929), -INT16_C( 31064),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(14225),
+      {  INT16_C( 19445),  INT16_C( 28156),  INT16_C( 26328),  INT16_C(  2314), -INT16_C( 18488), -INT16_C( 22842), -INT16_C( 10961),  INT16_C(  6252),
+         INT16_C( 17236),  INT16_C( 21976), -INT16_C( 32588),  INT16_C( 28892),  INT16_C( 26802), -INT16_C(   510), -INT16_C( 27879),  INT16_C(  3638) },
+      {  INT16_C( 19445), -INT16_C( 18488),  INT16_C(  6252),  INT16_C( 17236),  INT16_C( 21976), -INT16_C( 32588),  INT16_C( 26802), -INT16_C(   510),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(13023),
+      { -INT16_C( 18565), -INT16_C( 31080),  INT16_C( 25025), -INT16_C( 30915),  INT16_C( 27911),  INT16_C( 29532), -INT16_C( 20091),  INT16_C( 23990),
+         INT16_C( 27142), -INT16_C(  7459), -INT16_C( 28709), -INT16_C(  8886),  INT16_C( 25485), -INT16_C( 15503),  INT16_C( 20593), -INT16_C(  4618) },
+      { -INT16_C( 18565), -INT16_C( 31080),  INT16_C( 25025), -INT16_C( 30915),  INT16_C( 27911), -INT16_C( 20091),  INT16_C( 23990), -INT16_C(  7459),
+         INT16_C( 25485), -INT16_C( 15503),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(36359),
+      { -INT16_C( 14221), -INT16_C( 20241), -INT16_C(  2481), -INT16_C( 21475), -INT16_C( 23958),  INT16_C(  8285),  INT16_C( 25599), -INT16_C(  9077),
+         INT16_C( 26182), -INT16_C( 28565), -INT16_C(  1725), -INT16_C( 19212),  INT16_C( 26044), -INT16_C( 19964),  INT16_C(  3154), -INT16_C( 15039) },
+      { -INT16_C( 14221), -INT16_C( 20241), -INT16_C(  2481), -INT16_C( 28565), -INT16_C(  1725), -INT16_C( 19212), -INT16_C( 15039),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(12500),
+      {  INT16_C(  9334), -INT16_C( 27865), -INT16_C( 28208),  INT16_C( 11574),  INT16_C( 13745),  INT16_C( 15504), -INT16_C( 10734),  INT16_C( 32162),
+        -INT16_C(  6553),  INT16_C( 23414),  INT16_C( 13210), -INT16_C( 24640),  INT16_C(  5093),  INT16_C(  9899),  INT16_C( 32728),  INT16_C( 20055) },
+      { -INT16_C( 28208),  INT16_C( 13745), -INT16_C( 10734),  INT16_C( 32162),  INT16_C(  5093),  INT16_C(  9899),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(32419),
+      {  INT16_C( 29666),  INT16_C(  6159), -INT16_C( 16224),  INT16_C( 12621),  INT16_C( 24573), -INT16_C( 24825),  INT16_C( 28381),  INT16_C( 21381),
+         INT16_C(  8393), -INT16_C( 30074),  INT16_C( 27839),  INT16_C( 27293),  INT16_C( 30098), -INT16_C(  5655), -INT16_C( 29244), -INT16_C( 22937) },
+      {  INT16_C( 29666),  INT16_C(  6159), -INT16_C( 24825),  INT16_C( 21381), -INT16_C( 30074),  INT16_C( 27839),  INT16_C( 27293),  INT16_C( 30098),
+        -INT16_C(  5655), -INT16_C( 29244),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256i r = simde_mm256_maskz_compress_epi16(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x16(r, simde_x_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m256i a = simde_test_x86_random_i16x16();
+    simde__m256i r = simde_mm256_maskz_compress_epi16(k, a);
+
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i16x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i16x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_mask_compressstoreu_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask16 k;
+    const int16_t a[16];
+    const int16_t r[16];
+  } test_vec[] = {
+    { UINT16_C(30208),
+      { -INT16_C( 24130),  INT16_C(  2871),  INT16_C( 13522), -INT16_C(  9877),  INT16_C( 18643),  INT16_C( 22856),  INT16_C(  4507),  INT16_C(  8825),
+         INT16_C( 14491),  INT16_C( 14478),  INT16_C(  8354), -INT16_C( 29778),  INT16_C( 29194),  INT16_C( 28952),  INT16_C(  6424), -INT16_C( 10520) },
+      {  INT16_C( 14478),  INT16_C(  8354),  INT16_C( 29194),  INT16_C( 28952),  INT16_C(  6424),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C( 8122),
+      { -INT16_C( 29471),  INT16_C( 19539),  INT16_C(  9829), -INT16_C( 21100),  INT16_C( 12415), -INT16_C(  1857),  INT16_C( 23122), -INT16_C(  8144),
+        -INT16_C( 11629),  INT16_C( 16640),  INT16_C(  2654),  INT16_C( 30387), -INT16_C( 13444),  INT16_C( 25743),  INT16_C( 18849), -INT16_C( 32125) },
+      {  INT16_C( 19539), -INT16_C( 21100),  INT16_C( 12415), -INT16_C(  1857), -INT16_C(  8144), -INT16_C( 11629),  INT16_C( 16640),  INT16_C(  2654),
+         INT16_C( 30387), -INT16_C( 13444),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(54997),
+      {  INT16_C( 15311),  INT16_C( 25596),  INT16_C( 31976), -INT16_C( 22637), -INT16_C(  6796), -INT16_C( 23294), -INT16_C( 27195), -INT16_C( 14729),
+        -INT16_C( 10794), -INT16_C( 30256),  INT16_C( 19532), -INT16_C(  9388), -INT16_C(  2640),  INT16_C( 13093), -INT16_C(  1417),  INT16_C( 17929) },
+      {  INT16_C( 15311),  INT16_C( 31976), -INT16_C(  6796), -INT16_C( 27195), -INT16_C( 14729), -INT16_C( 30256),  INT16_C( 19532), -INT16_C(  2640),
+        -INT16_C(  1417),  INT16_C( 17929),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C( 1589),
+      {  INT16_C(  7850),  INT16_C( 15746), -INT16_C(  2363), -INT16_C( 14557), -INT16_C(  5989),  INT16_C(  4956),  INT16_C( 12974),  INT16_C( 32744),
+         INT16_C( 13499),  INT16_C(  4043),  INT16_C( 31760),  INT16_C( 13572),  INT16_C( 31919), -INT16_C( 18129),  INT16_C( 26050),  INT16_C( 27839) },
+      {  INT16_C(  7850), -INT16_C(  2363), -INT16_C(  5989),  INT16_C(  4956),  INT16_C(  4043),  INT16_C( 31760),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(16771),
+      {  INT16_C( 18602), -INT16_C( 13001), -INT16_C( 11504),  INT16_C( 27829),  INT16_C( 25830), -INT16_C( 12641),  INT16_C( 23267), -INT16_C( 20989),
+         INT16_C(  4970),  INT16_C( 28202), -INT16_C(  9656),  INT16_C( 30698), -INT16_C( 21101),  INT16_C( 21212),  INT16_C( 24345), -INT16_C( 15469) },
+      {  INT16_C( 18602), -INT16_C( 13001), -INT16_C( 20989),  INT16_C(  4970),  INT16_C( 24345),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(51880),
+      { -INT16_C( 18288),  INT16_C( 18077), -INT16_C( 31964), -INT16_C( 15446), -INT16_C( 29358),  INT16_C( 21790), -INT16_C( 30661),  INT16_C( 26216),
+        -INT16_C( 20234), -INT16_C(  7872), -INT16_C( 11481),  INT16_C(  1166), -INT16_C( 22747), -INT16_C( 18333),  INT16_C(  2923), -INT16_C(  1150) },
+      { -INT16_C( 15446),  INT16_C( 21790),  INT16_C( 26216), -INT16_C(  7872),  INT16_C(  1166),  INT16_C(  2923), -INT16_C(  1150),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C( 8387),
+      { -INT16_C(  6079), -INT16_C(  5213), -INT16_C(  2645), -INT16_C( 13960), -INT16_C( 19382), -INT16_C( 19887),  INT16_C( 18458),  INT16_C( 23138),
+        -INT16_C( 30167), -INT16_C( 18643),  INT16_C( 21134), -INT16_C(  3746), -INT16_C( 14070), -INT16_C( 29443), -INT16_C( 16187),  INT16_C(  1708) },
+      { -INT16_C(  6079), -INT16_C(  5213),  INT16_C( 18458),  INT16_C( 23138), -INT16_C( 29443),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(20648),
+      {  INT16_C( 21746),  INT16_C( 27205), -INT16_C( 28643),  INT16_C( 28446),  INT16_C( 14402), -INT16_C( 23113), -INT16_C(  8046), -INT16_C( 16593),
+        -INT16_C( 17001), -INT16_C(  2799),  INT16_C(  7086), -INT16_C( 21569), -INT16_C( 31576),  INT16_C( 21612),  INT16_C(  5258),  INT16_C( 31908) },
+      {  INT16_C( 28446), -INT16_C( 23113), -INT16_C( 16593), -INT16_C( 31576),  INT16_C(  5258),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256i r = simde_mm256_setzero_si256();
+    simde_mm256_mask_compressstoreu_epi16(&r, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x16(r, simde_x_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m256i a = simde_test_x86_random_i16x16();
+    simde__m256i r = simde_mm256_setzero_si256();
+    simde_mm256_mask_compressstoreu_epi16(&r, k, a);
+
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i16x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i16x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_mask_compress_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int8_t src[64];
+    const simde__mmask64 k;
+    const int8_t a[64];
+    const int8_t r[64];
+  } test_vec[] = {
+    { {  INT8_C( 104), -INT8_C(  22), -INT8_C(  25), -INT8_C( 122),  INT8_C( 122),  INT8_C(   5), -INT8_C(  11), -INT8_C(  68),
+         INT8_C(  62), -INT8_C(  84),  INT8_C(  97), -INT8_C(  48), -INT8_C( 116), -INT8_C( 112), -INT8_C( 112),  INT8_C(  35),
+         INT8_C(  77), -INT8_C(  95),  INT8_C(  24), -INT8_C(   4), -INT8_C(  67), -INT8_C(  41), -INT8_C(  89),  INT8_C( 101),
+         INT8_C(  91),  INT8_C(  19), -INT8_C(  71), -INT8_C(  26),  INT8_C(  40),  INT8_C(  94),  INT8_C(  98), -INT8_C( 112),
+         INT8_C(  72),  INT8_C(  73),  INT8_C(  22), -INT8_C(  62),  INT8_C(  79),  INT8_C(  11),  INT8_C( 126), -INT8_C( 115),
+        -INT8_C(  73), -INT8_C(  32),  INT8_C(  93),  INT8_C(  67),  INT8_C( 112), -INT8_C(  19),  INT8_C( 102), -INT8_C(  66),
+        -INT8_C( 113),      INT8_MAX, -INT8_C(  70),  INT8_C(  76),  INT8_C(  86),  INT8_C(  97), -INT8_C(  79), -INT8_C(  78),
+         INT8_C( 117),  INT8_C( 106), -INT8_C( 104), -INT8_C(  99), -INT8_C(  56), -INT8_C(   6),  INT8_C(  45),  INT8_C(  16) },
+      UINT64_C(  513499759744533572),
+      {  INT8_C(  49),  INT8_C( 125),  INT8_C(  74), -INT8_C(  95),  INT8_C( 107), -INT8_C(  79),  INT8_C(  95), -INT8_C(   6),
+         INT8_C(  48),  INT8_C(  25),  INT8_C(  70), -INT8_C( 122),  INT8_C( 123), -INT8_C(   9),  INT8_C(  56), -INT8_C(  16),
+         INT8_C(  97), -INT8_C(  48), -INT8_C( 115),  INT8_C(  42), -INT8_C(  53), -INT8_C(  70),  INT8_C(  58),  INT8_C(  15),
+        -INT8_C(   2),  INT8_C(  13), -INT8_C(  94),  INT8_C(  78),  INT8_C(  94), -INT8_C(  62),  INT8_C(  85), -INT8_C( 113),
+         INT8_C(  63), -INT8_C(  97),  INT8_C(  48), -INT8_C(  86),  INT8_C(  80), -INT8_C( 112), -INT8_C(  92),      INT8_MIN,
+        -INT8_C(  87), -INT8_C(  22),  INT8_C(   7),  INT8_C(  36), -INT8_C(  31),  INT8_C(  63),  INT8_C(  20),  INT8_C(  67),
+         INT8_C(  16), -INT8_C(  95),  INT8_C( 109), -INT8_C(  37),  INT8_C(  92), -INT8_C(  89), -INT8_C(  22),  INT8_C(  90),
+        -INT8_C(  76), -INT8_C( 116), -INT8_C(  88),  INT8_C(  18),  INT8_C(  78), -INT8_C(   3), -INT8_C(  95), -INT8_C( 115) },
+      {  INT8_C(  74),  INT8_C(  95),  INT8_C(  70),  INT8_C(  56), -INT8_C(  48), -INT8_C(  53),  INT8_C(  58),  INT8_C(  15),
+        -INT8_C(   2),  INT8_C(  13),  INT8_C(  94), -INT8_C( 113),  INT8_C(  63), -INT8_C(  97),  INT8_C(  48), -INT8_C(  86),
+        -INT8_C(  92), -INT8_C(  87), -INT8_C(  31),  INT8_C(  20), -INT8_C(  89), -INT8_C(  76), -INT8_C( 116), -INT8_C(  88),
+         INT8_C(  91),  INT8_C(  19), -INT8_C(  71), -INT8_C(  26),  INT8_C(  40),  INT8_C(  94),  INT8_C(  98), -INT8_C( 112),
+         INT8_C(  72),  INT8_C(  73),  INT8_C(  22), -INT8_C(  62),  INT8_C(  79),  INT8_C(  11),  INT8_C( 126), -INT8_C( 115),
+        -INT8_C(  73), -INT8_C(  32),  INT8_C(  93),  INT8_C(  67),  INT8_C( 112), -INT8_C(  19),  INT8_C( 102), -INT8_C(  66),
+        -INT8_C( 113),      INT8_MAX, -INT8_C(  70),  INT8_C(  76),  INT8_C(  86),  INT8_C(  97), -INT8_C(  79), -INT8_C(  78),
+         INT8_C( 117),  INT8_C( 106), -INT8_C( 104), -INT8_C(  99), -INT8_C(  56), -INT8_C(   6),  INT8_C(  45),  INT8_C(  16) } },
+    { { -INT8_C(  99), -INT8_C(  46),  INT8_C(  56), -INT8_C(  19),  INT8_C(  98), -INT8_C(  36),  INT8_C( 110),  INT8_C(  11),
+        -INT8_C(  57),  INT8_C( 117),  INT8_C(  48), -INT8_C(  88), -INT8_C(  76),  INT8_C(  68), -INT8_C(  21), -INT8_C(  60),
+        -INT8_C(  26),  INT8_C(  88), -INT8_C(  97),  INT8_C(  66),  INT8_C(   0), -INT8_C( 119), -INT8_C( 100), -INT8_C(  76),
+         INT8_C(  21),  INT8_C(  69), -INT8_C(  57),  INT8_C(  99),  INT8_C(  66),  INT8_C( 104), -INT8_C(  15), -INT8_C(  33),
+         INT8_C(  58),  INT8_C(  41), -INT8_C(  51), -INT8_C( 100),  INT8_C(   5),  INT8_C(  59), -INT8_C(  88), -INT8_C(  52),
+        -INT8_C(  80), -INT8_C(  40),  INT8_C( 117),  INT8_C( 100),  INT8_C(  28),  INT8_C(  96),  INT8_C(  41),  INT8_C(   2),
+        -INT8_C(  71), -INT8_C(  56),  INT8_C(  68), -INT8_C(  71),  INT8_C(  82), -INT8_C(  31),  INT8_C( 109),  INT8_C( 103),
+         INT8_C(  38),  INT8_C(  52), -INT8_C(  53),  INT8_C( 104), -INT8_C(  99), -INT8_C(  68),  INT8_C(  72), -INT8_C(  41) },
+      UINT64_C(   51541054594487781),
+      { -INT8_C(  12),  INT8_C(  44),  INT8_C( 100),  INT8_C(  16), -INT8_C( 116), -INT8_C( 115),  INT8_C(  19),  INT8_C(  69),
+         INT8_C(  86),  INT8_C(  87), -INT8_C(   2), -INT8_C(  88),  INT8_C(  56),  INT8_C( 108),  INT8_C(  15),  INT8_C(  94),
+        -INT8_C(  96), -INT8_C(  38), -INT8_C(  57),  INT8_C(  61), -INT8_C( 106),  INT8_C(  15),  INT8_C(  21),  INT8_C( 123),
+         INT8_C(  36), -INT8_C( 119),  INT8_C( 102),  INT8_C( 116), -INT8_C(  91),  INT8_C(  29),  INT8_C( 116), -INT8_C( 103),
+         INT8_C(  73), -INT8_C(  40), -INT8_C(  87), -INT8_C(  43),  INT8_C( 102), -INT8_C(  68),  INT8_C(  27), -INT8_C(  68),
+         INT8_C(  20),  INT8_C(  25),  INT8_C( 100),  INT8_C(  76), -INT8_C( 123),  INT8_C( 115), -INT8_C(  85),  INT8_C(  38),
+         INT8_C(  78),  INT8_C( 114),  INT8_C(  99), -INT8_C(  28), -INT8_C( 127),  INT8_C( 120),  INT8_C(  96), -INT8_C(  91),
+         INT8_C(   1), -INT8_C(  58),  INT8_C(  25), -INT8_C(  90), -INT8_C(  29), -INT8_C( 115),  INT8_C(  63),  INT8_C(  44) },
+      { -INT8_C(  12),  INT8_C( 100), -INT8_C( 115),  INT8_C(  19),  INT8_C(  69),  INT8_C(  86), -INT8_C(   2),  INT8_C(  56),
+        -INT8_C(  57), -INT8_C( 106),  INT8_C(  15),  INT8_C(  21), -INT8_C( 119),  INT8_C( 116),  INT8_C(  29),  INT8_C( 116),
+        -INT8_C( 103),  INT8_C( 102),  INT8_C(  27),  INT8_C( 100),  INT8_C(  76), -INT8_C( 123),  INT8_C(  78),  INT8_C( 114),
+         INT8_C(  99), -INT8_C( 127),  INT8_C( 120), -INT8_C(  91),  INT8_C(  66),  INT8_C( 104), -INT8_C(  15), -INT8_C(  33),
+         INT8_C(  58),  INT8_C(  41), -INT8_C(  51), -INT8_C( 100),  INT8_C(   5),  INT8_C(  59), -INT8_C(  88), -INT8_C(  52),
+        -INT8_C(  80), -INT8_C(  40),  INT8_C( 117),  INT8_C( 100),  INT8_C(  28),  INT8_C(  96),  INT8_C(  41),  INT8_C(   2),
+        -INT8_C(  71), -INT8_C(  56),  INT8_C(  68), -INT8_C(  71),  INT8_C(  82), -INT8_C(  31),  INT8_C( 109),  INT8_C( 103),
+         INT8_C(  38),  INT8_C(  52), -INT8_C(  53),  INT8_C( 104), -INT8_C(  99), -INT8_C(  68),  INT8_C(  72), -INT8_C(  41) } },
+    { {  INT8_C( 101), -INT8_C(  23),  INT8_C(   1), -INT8_C(  53), -INT8_C(  91),  INT8_C(  28), -INT8_C( 121), -INT8_C(  71),
+         INT8_C(  54), -INT8_C(  21),  INT8_C(   6), -INT8_C(  69),  INT8_C(  95), -INT8_C(  79), -INT8_C(  31), -INT8_C(  83),
+         INT8_C(  35),  INT8_C(  69), -INT8_C( 111), -INT8_C(  92), -INT8_C(  67), -INT8_C(  15),  INT8_C(  73), -INT8_C(  65),
+        -INT8_C(  73),  INT8_C(  98),  INT8_C( 101), -INT8_C( 102), -INT8_C(  17), -INT8_C(  91), -INT8_C(  58),  INT8_C(  84),
+        -INT8_C( 114), -INT8_C(  56),  INT8_C(  32),  INT8_C(  51), -INT8_C(  28), -INT8_C(  89), -INT8_C(  19),  INT8_C(  26),
+        -INT8_C( 109), -INT8_C(  13), -INT8_C(  42), -INT8_C(  14), -INT8_C(  92), -INT8_C(  73), -INT8_C(  97), -INT8_C(  57),
+        -INT8_C(   4),  INT8_C(  48),  INT8_C( 107), -INT8_C(  70),  INT8_C(  34), -INT8_C(  76),  INT8_C( 121), -INT8_C(  39),
+         INT8_C(  22), -INT8_C(  34),  INT8_C( 116),  INT8_C(   5), -INT8_C( 125),  INT8_C(  58),  INT8_C(  89),  INT8_C(  17) },
+      UINT64_C(12970703522999138562),
+      {  INT8_C(  37), -INT8_C(  41), -INT8_C(  90), -INT8_C(  55), -INT8_C( 113),  INT8_C(  69), -INT8_C( 112), -INT8_C( 117),
+         INT8_C( 117), -INT8_C(   5),  INT8_C(  69), -INT8_C( 105), -INT8_C(  81), -INT8_C(  66),  INT8_C( 113), -INT8_C(  59),
+        -INT8_C(  99), -INT8_C(  27), -INT8_C(  54),  INT8_C(  32),  INT8_C(  31),  INT8_C(  35),  INT8_C(  50),  INT8_C(  34),
+        -INT8_C(  99),  INT8_C( 119),  INT8_C(   9), -INT8_C(  66), -INT8_C(  87),  INT8_C(  10),  INT8_C( 114), -INT8_C(  50),
+        -INT8_C(  30),  INT8_C(  24), -INT8_C( 105),  INT8_C( 113),  INT8_C(  93),  INT8_C(  39), -INT8_C(   4), -INT8_C(  46),
+         INT8_C(  34),  INT8_C(  66),  INT8_C( 106), -INT8_C(  47),  INT8_C(   0), -INT8_C(  37), -INT8_C( 106), -INT8_C(  99),
+        -INT8_C(  64),  INT8_C(  96), -INT8_C(  66), -INT8_C(  33), -INT8_C( 125), -INT8_C(  16),  INT8_C(   1),  INT8_C(  32),
+         INT8_C( 103),  INT8_C(  10), -INT8_C(  34),  INT8_C(  16),  INT8_C(  21),  INT8_C(  80), -INT8_C(  34), -INT8_C(   9) },
+      { -INT8_C(  41),  INT8_C( 117), -INT8_C( 105), -INT8_C(  81), -INT8_C(  66),  INT8_C( 113), -INT8_C(  99), -INT8_C(  54),
+         INT8_C(  50), -INT8_C(  99),  INT8_C( 119),  INT8_C(   9),  INT8_C(  10),  INT8_C( 114), -INT8_C(  50), -INT8_C(  30),
+         INT8_C(  39),  INT8_C(  66),  INT8_C(   0), -INT8_C(  37), -INT8_C(  64), -INT8_C(  34),  INT8_C(  21),  INT8_C(  80),
+        -INT8_C(   9),  INT8_C(  98),  INT8_C( 101), -INT8_C( 102), -INT8_C(  17), -INT8_C(  91), -INT8_C(  58),  INT8_C(  84),
+        -INT8_C( 114), -INT8_C(  56),  INT8_C(  32),  INT8_C(  51), -INT8_C(  28), -INT8_C(  89), -INT8_C(  19),  INT8_C(  26),
+        -INT8_C( 109), -INT8_C(  13), -INT8_C(  42), -INT8_C(  14), -INT8_C(  92), -INT8_C(  73), -INT8_C(  97), -INT8_C(  57),
+        -INT8_C(   4),  INT8_C(  48),  INT8_C( 107), -INT8_C(  70),  INT8_C(  34), -INT8_C(  76),  INT8_C( 121), -INT8_C(  39),
+         INT8_C(  22), -INT8_C(  34),  INT8_C( 116),  INT8_C(   5), -INT8_C( 125),  INT8_C(  58),  INT8_C(  89),  INT8_C(  17) } },
+    { {  INT8_C( 104),  INT8_C( 117),  INT8_C( 104), -INT8_C(  59), -INT8_C( 100),  INT8_C( 100), -INT8_C( 104), -INT8_C(  66),
+        -INT8_C(  90),  INT8_C(   2), -INT8_C( 113), -INT8_C(  89), -INT8_C(  35),  INT8_C(  37),  INT8_C(  68), -INT8_C(  99),
+        -INT8_C( 123),  INT8_C(   2),  INT8_C( 124),  INT8_C(   8), -INT8_C(  14),  INT8_C( 126),  INT8_C(  41),  INT8_C(  89),
+        -INT8_C( 120),  INT8_C(   7),  INT8_C( 105), -INT8_C(  99),  INT8_C(  88),  INT8_C(  71), -INT8_C( 108), -INT8_C(  64),
+        -INT8_C(  68), -INT8_C(   4), -INT8_C( 122),  INT8_C(  88),  INT8_C(  97),  INT8_C(  30),  INT8_C(  22),  INT8_C(   7),
+         INT8_C(  32), -INT8_C(  91), -INT8_C(  82), -INT8_C(   3), -INT8_C(  54), -INT8_C(  13), -INT8_C( 102),  INT8_C(  79),
+        -INT8_C(  11),  INT8_C(  22),  INT8_C(  88), -INT8_C(  24), -INT8_C( 108), -INT8_C( 127),  INT8_C(  65),  INT8_C(  29),
+        -INT8_C( 120), -INT8_C(  85), -INT8_C(  70), -INT8_C(  32), -INT8_C(  14),  INT8_C(  79), -INT8_C(  95), -INT8_C(  81) },
+      UINT64_C( 7328515778226366283),
+      { -INT8_C(  61),  INT8_C(  98),  INT8_C(  98), -INT8_C( 114),  INT8_C(  85), -INT8_C(   4), -INT8_C(  35),  INT8_C(  75),
+         INT8_C(  18),  INT8_C(  53),  INT8_C(  51), -INT8_C(  89), -INT8_C(  74),  INT8_C( 116), -INT8_C(  60),  INT8_C(  63),
+         INT8_C(  31),  INT8_C( 126),  INT8_C(  31),  INT8_C(  18), -INT8_C(  51), -INT8_C(  64), -INT8_C(  63),  INT8_C(  25),
+        -INT8_C(  25), -INT8_C(  56), -INT8_C(  59),  INT8_C(  44), -INT8_C(  26),  INT8_C( 121), -INT8_C( 111), -INT8_C(  86),
+        -INT8_C(  36), -INT8_C(  13),  INT8_C(  56),  INT8_C(  49), -INT8_C(  17),  INT8_C(  21),  INT8_C( 124),  INT8_C(   2),
+         INT8_C(  75), -INT8_C(  81), -INT8_C(  87),  INT8_C(   1),  INT8_C(  36),  INT8_C( 109),  INT8_C(  64),  INT8_C(  67),
+        -INT8_C(  21),  INT8_C(  96),  INT8_C(  85), -INT8_C(  71),  INT8_C(  32),  INT8_C(  22), -INT8_C(  46),  INT8_C(   8),
+        -INT8_C(  33), -INT8_C( 105),  INT8_C(  52), -INT8_C(  59),  INT8_C(  17), -INT8_C(  58),  INT8_C( 111), -INT8_C(  19) },
+      { -INT8_C(  61),  INT8_C(  98), -INT8_C( 114), -INT8_C(  35),  INT8_C(  18),  INT8_C(  53),  INT8_C(  51),  INT8_C( 116),
+         INT8_C(  31),  INT8_C( 126),  INT8_C(  31), -INT8_C(  59),  INT8_C(  44),  INT8_C( 121), -INT8_C(  86), -INT8_C(  36),
+         INT8_C(  56),  INT8_C( 124), -INT8_C(  81), -INT8_C(  87),  INT8_C(   1),  INT8_C(  36),  INT8_C(  85),  INT8_C(  32),
+         INT8_C(  22),  INT8_C(   8), -INT8_C(  33),  INT8_C(  52), -INT8_C(  58),  INT8_C( 111), -INT8_C( 108), -INT8_C(  64),
+        -INT8_C(  68), -INT8_C(   4), -INT8_C( 122),  INT8_C(  88),  INT8_C(  97),  INT8_C(  30),  INT8_C(  22),  INT8_C(   7),
+         INT8_C(  32), -INT8_C(  91), -INT8_C(  82), -INT8_C(   3), -INT8_C(  54), -INT8_C(  13), -INT8_C( 102),  INT8_C(  79),
+        -INT8_C(  11),  INT8_C(  22),  INT8_C(  88), -INT8_C(  24), -INT8_C( 108), -INT8_C( 127),  INT8_C(  65),  INT8_C(  29),
+        -INT8_C( 120), -INT8_C(  85), -INT8_C(  70), -INT8_C(  32), -INT8_C(  14),  INT8_C(  79), -INT8_C(  95), -INT8_C(  81) } },
+    { { -INT8_C(  71), -INT8_C(  89),  INT8_C(  30), -INT8_C(  87), -INT8_C(  67), -INT8_C( 101), -INT8_C(  85),  INT8_C(   8),
+         INT8_C(  74),  INT8_C(  84),  INT8_C(   9),  INT8_C( 110), -INT8_C(  63),  INT8_C(  74), -INT8_C(  78), -INT8_C(  84),
+        -INT8_C(  86),  INT8_C(   7),  INT8_C( 101), -INT8_C(  54),  INT8_C(  30),  INT8_C(  55), -INT8_C(  46), -INT8_C(   3),
+        -INT8_C(  49),  INT8_C(   7), -INT8_C(  62), -INT8_C(  32), -INT8_C(  51),  INT8_C(  50), -INT8_C(  51), -INT8_C( 122),
+        -INT8_C(  39), -INT8_C(  21),  INT8_C(  47), -INT8_C( 106), -INT8_C( 122), -INT8_C(  38), -INT8_C(  98), -INT8_C(  47),
+         INT8_C(  46), -INT8_C(  88),  INT8_C(  63), -INT8_C(  17), -INT8_C(  14), -INT8_C(  15), -INT8_C( 100), -INT8_C( 100),
+        -INT8_C(   7),  INT8_C(   1),  INT8_C( 102),  INT8_C(  23),  INT8_C(  57),  INT8_C(  57),  INT8_C(  20),  INT8_C(   8),
+         INT8_C(  64), -INT8_C(  42), -INT8_C(  24),  INT8_C(  13),  INT8_C(   8), -INT8_C(  75), -INT8_C( 109), -INT8_C(  30) },
+      UINT64_C(14769580941701071776),
+      { -INT8_C(  65),  INT8_C(  55), -INT8_C(  69), -INT8_C(  79),  INT8_C(  41),  INT8_C(  87),  INT8_C(  77),  INT8_C(  34),
+         INT8_C(  89), -INT8_C(  77),  INT8_C(  57), -INT8_C( 110), -INT8_C(  20),  INT8_C(  77), -INT8_C( 102),  INT8_C(  44),
+         INT8_C(  35), -INT8_C( 126),  INT8_C(  57),  INT8_C(  44),  INT8_C(  55), -INT8_C(  51),  INT8_C(  14), -INT8_C(  41),
+        -INT8_C( 112), -INT8_C( 122), -INT8_C(   2),  INT8_C(  45), -INT8_C(  99), -INT8_C(  10), -INT8_C(   7),  INT8_C(  92),
+         INT8_C(  46), -INT8_C(  75),  INT8_C(  13),  INT8_C(  87),  INT8_C(  12),  INT8_C(  90),  INT8_C( 121),  INT8_C( 101),
+         INT8_C(  14), -INT8_C(  78), -INT8_C(   9), -INT8_C(   6), -INT8_C(   1), -INT8_C( 111),  INT8_C(  39),  INT8_C(  34),
+         INT8_C(  19),  INT8_C(  96),  INT8_C(  78),  INT8_C(  74),  INT8_C(  45),  INT8_C(  92),  INT8_C(  34), -INT8_C(  67),
+        -INT8_C(  29),  INT8_C(  32), -INT8_C(  21),      INT8_MIN,  INT8_C(  23), -INT8_C(  28), -INT8_C(  35),  INT8_C(  69) },
+      {  INT8_C(  87),  INT8_C(  34),  INT8_C(  89), -INT8_C(  77), -INT8_C( 102),  INT8_C(  44),  INT8_C(  44),  INT8_C(  55),
+        -INT8_C(  51),  INT8_C(  14), -INT8_C( 112), -INT8_C( 122), -INT8_C(   2), -INT8_C(  10),  INT8_C(  46),  INT8_C(  13),
+         INT8_C(  87),  INT8_C(  12),  INT8_C( 101),  INT8_C(  14), -INT8_C(  78), -INT8_C(   9), -INT8_C(   1),  INT8_C(  74),
+         INT8_C(  45),  INT8_C(  92),  INT8_C(  34), -INT8_C(  67), -INT8_C(  21),      INT8_MIN, -INT8_C(  35),  INT8_C(  69),
+        -INT8_C(  39), -INT8_C(  21),  INT8_C(  47), -INT8_C( 106), -INT8_C( 122), -INT8_C(  38), -INT8_C(  98), -INT8_C(  47),
+         INT8_C(  46), -INT8_C(  88),  INT8_C(  63), -INT8_C(  17), -INT8_C(  14), -INT8_C(  15), -INT8_C( 100), -INT8_C( 100),
+        -INT8_C(   7),  INT8_C(   1),  INT8_C( 102),  INT8_C(  23),  INT8_C(  57),  INT8_C(  57),  INT8_C(  20),  INT8_C(   8),
+         INT8_C(  64), -INT8_C(  42), -INT8_C(  24),  INT8_C(  13),  INT8_C(   8), -INT8_C(  75), -INT8_C( 109), -INT8_C(  30) } },
+    { { -INT8_C( 103), -INT8_C(  22), -INT8_C( 100), -INT8_C(  90),  INT8_C(  69),  INT8_C(  21),  INT8_C(  11),  INT8_C(  83),
+        -INT8_C(  57),  INT8_C(   3),  INT8_C(  77), -INT8_C(  58), -INT8_C( 108),  INT8_C( 116), -INT8_C(  24), -INT8_C(  88),
+        -INT8_C(  43),  INT8_C(  55), -INT8_C(  14),  INT8_C(   2), -INT8_C( 109),  INT8_C(  20), -INT8_C(  64),  INT8_C( 118),
+         INT8_C(  53), -INT8_C(  85), -INT8_C(   9),  INT8_C(  76), -INT8_C( 113), -INT8_C(  44), -INT8_C( 111),  INT8_C(  41),
+        -INT8_C(  66),  INT8_C(  45), -INT8_C(  49),  INT8_C(   3),  INT8_C(  66), -INT8_C(  38),  INT8_C(  86),  INT8_C(   9),
+        -INT8_C(  35), -INT8_C(  92), -INT8_C(  49),  INT8_C( 114),  INT8_C(  24), -INT8_C(  73),  INT8_C(  26), -INT8_C(  19),
+        -INT8_C(  18),  INT8_C(  12), -INT8_C(  16), -INT8_C( 126),  INT8_C(  33), -INT8_C(  80), -INT8_C(   8),  INT8_C(  86),
+         INT8_C(  91), -INT8_C(  17), -INT8_C(  94), -INT8_C(  22), -INT8_C(  61),  INT8_C(  51),  INT8_C(  19), -INT8_C( 126) },
+      UINT64_C(11145244409892037216),
+      {      INT8_MIN,  INT8_C( 122),  INT8_C(  12), -INT8_C( 104),  INT8_C(  49),  INT8_C(  38), -INT8_C( 122),  INT8_C(  32),
+         INT8_C(  51),  INT8_C( 118), -INT8_C(  94),  INT8_C(  84),  INT8_C(  38), -INT8_C( 102), -INT8_C(  86), -INT8_C( 127),
+        -INT8_C( 118),  INT8_C(  76),  INT8_C( 107),  INT8_C(  77),      INT8_MAX,      INT8_MAX, -INT8_C(  49), -INT8_C(  33),
+         INT8_C(  97),  INT8_C(  85), -INT8_C( 127),  INT8_C(  30),  INT8_C(  49),  INT8_C(  44), -INT8_C(  71), -INT8_C(  79),
+        -INT8_C(  90), -INT8_C(  59),  INT8_C(  73), -INT8_C(  41), -INT8_C(  20), -INT8_C(  49), -INT8_C(   9),  INT8_C(  31),
+         INT8_C(  69), -INT8_C( 103),  INT8_C( 115),  INT8_C( 107),  INT8_C(  52),  INT8_C(  29), -INT8_C(  20), -INT8_C(  66),
+         INT8_C( 105),  INT8_C(  88),  INT8_C(  11), -INT8_C(  24), -INT8_C(  41), -INT8_C(  37), -INT8_C(  57),  INT8_C(  56),
+         INT8_C(  48),  INT8_C(  72),  INT8_C(  87),  INT8_C(  97),  INT8_C( 116),  INT8_C(  16),  INT8_C(  18),  INT8_C(  26) },
+      {  INT8_C(  38), -INT8_C( 122),  INT8_C( 118), -INT8_C( 102), -INT8_C(  86), -INT8_C( 127), -INT8_C( 118),  INT8_C( 107),
+        -INT8_C(  33),  INT8_C(  85),  INT8_C(  44), -INT8_C(  79), -INT8_C(  90),  INT8_C(  73), -INT8_C(  41), -INT8_C(  20),
+        -INT8_C(  49),  INT8_C(  31),  INT8_C( 115),  INT8_C( 107),  INT8_C(  52), -INT8_C(  20), -INT8_C(  66),  INT8_C( 105),
+         INT8_C(  88), -INT8_C(  24), -INT8_C(  37),  INT8_C(  56),  INT8_C(  72),  INT8_C(  97),  INT8_C( 116),  INT8_C(  26),
+        -INT8_C(  66),  INT8_C(  45), -INT8_C(  49),  INT8_C(   3),  INT8_C(  66), -INT8_C(  38),  INT8_C(  86),  INT8_C(   9),
+        -INT8_C(  35), -INT8_C(  92), -INT8_C(  49),  INT8_C( 114),  INT8_C(  24), -INT8_C(  73),  INT8_C(  26), -INT8_C(  19),
+        -INT8_C(  18),  INT8_C(  12), -INT8_C(  16), -INT8_C( 126),  INT8_C(  33), -INT8_C(  80), -INT8_C(   8),  INT8_C(  86),
+         INT8_C(  91), -INT8_C(  17), -INT8_C(  94), -INT8_C(  22), -INT8_C(  61),  INT8_C(  51),  INT8_C(  19), -INT8_C( 126) } },
+    { { -INT8_C(  43),  INT8_C(  91), -INT8_C(  15), -INT8_C(  63),  INT8_C(  43), -INT8_C(  23), -INT8_C(  32),  INT8_C( 112),
+        -INT8_C( 126),  INT8_C(  83), -INT8_C(  36), -INT8_C(  74),  INT8_C( 112), -INT8_C(  56),  INT8_C( 116), -INT8_C(  39),
+         INT8_C(  32),      INT8_MIN, -INT8_C(  63), -INT8_C(   9),  INT8_C(  91), -INT8_C( 120),  INT8_C(  48), -INT8_C( 117),
+        -INT8_C(  48), -INT8_C( 121), -INT8_C(  20),  INT8_C(  68), -INT8_C( 105), -INT8_C(   2),  INT8_C(  94),  INT8_C( 108),
+         INT8_C(  89),  INT8_C(  80),  INT8_C(  46), -INT8_C( 124),  INT8_C(  57),  INT8_C(  14), -INT8_C(  11), -INT8_C(  69),
+         INT8_C(  98), -INT8_C(  47),  INT8_C( 114), -INT8_C(  46), -INT8_C( 103), -INT8_C(  26), -INT8_C(  84), -INT8_C(  70),
+         INT8_C( 102),  INT8_C( 109), -INT8_C(  79), -INT8_C(  63), -INT8_C(  10), -INT8_C(  31),  INT8_C(  76), -INT8_C(  58),
+         INT8_C( 104),  INT8_C(  56),  INT8_C(  11), -INT8_C(   1),  INT8_C(  54),  INT8_C( 105),  INT8_C( 108), -INT8_C( 112) },
+      UINT64_C(  769563207547525817),
+      { -INT8_C(  38),  INT8_C(  32), -INT8_C(  35),  INT8_C( 116),  INT8_C(   6), -INT8_C( 119),  INT8_C(  46),  INT8_C( 109),
+        -INT8_C(  10), -INT8_C(  33),  INT8_C(  46), -INT8_C(  20), -INT8_C(  63),  INT8_C( 123), -INT8_C(  77),  INT8_C(  41),
+        -INT8_C(  77), -INT8_C(  66),  INT8_C(  41), -INT8_C(  22),  INT8_C(  39), -INT8_C( 107),  INT8_C( 122), -INT8_C(  31),
+         INT8_C(  47), -INT8_C( 114), -INT8_C(  45), -INT8_C(  41), -INT8_C( 104), -INT8_C( 127), -INT8_C(  30),  INT8_C( 114),
+        -INT8_C(  95), -INT8_C(  65), -INT8_C(  26), -INT8_C(  88),  INT8_C(  72),  INT8_C(  20),  INT8_C(  21),  INT8_C(  62),
+        -INT8_C(  12),  INT8_C(  67),  INT8_C(  43), -INT8_C(  75), -INT8_C(  66), -INT8_C(  34), -INT8_C(  34),  INT8_C( 114),
+        -INT8_C( 100),  INT8_C(   7),  INT8_C(  92), -INT8_C(  61), -INT8_C( 100), -INT8_C(  42), -INT8_C(  92), -INT8_C(  53),
+         INT8_C( 100),  INT8_C( 120), -INT8_C(  93), -INT8_C(   4), -INT8_C(   7), -INT8_C( 123),  INT8_C( 111), -INT8_C( 101) },
+      { -INT8_C(  38),  INT8_C( 116),  INT8_C(   6), -INT8_C( 119),  INT8_C( 109), -INT8_C(  33), -INT8_C(  20), -INT8_C(  63),
+         INT8_C(  41),  INT8_C(  41),  INT8_C(  39), -INT8_C( 114), -INT8_C( 104), -INT8_C( 127), -INT8_C(  30),  INT8_C( 114),
+        -INT8_C(  88),  INT8_C(  20),  INT8_C(  62), -INT8_C(  12), -INT8_C(  75),  INT8_C(   7),  INT8_C(  92), -INT8_C(  61),
+        -INT8_C(  42), -INT8_C(  53),  INT8_C( 120), -INT8_C(   4), -INT8_C( 105), -INT8_C(   2),  INT8_C(  94),  INT8_C( 108),
+         INT8_C(  89),  INT8_C(  80),  INT8_C(  46), -INT8_C( 124),  INT8_C(  57),  INT8_C(  14), -INT8_C(  11), -INT8_C(  69),
+         INT8_C(  98), -INT8_C(  47),  INT8_C( 114), -INT8_C(  46), -INT8_C( 103), -INT8_C(  26), -INT8_C(  84), -INT8_C(  70),
+         INT8_C( 102),  INT8_C( 109), -INT8_C(  79), -INT8_C(  63), -INT8_C(  10), -INT8_C(  31),  INT8_C(  76), -INT8_C(  58),
+         INT8_C( 104),  INT8_C(  56),  INT8_C(  11), -INT8_C(   1),  INT8_C(  54),  INT8_C( 105),  INT8_C( 108), -INT8_C( 112) } },
+    { {  INT8_C(  68),  INT8_C(  85),  INT8_C(  67), -INT8_C( 116),  INT8_C( 106),  INT8_C(  88), -INT8_C(  54),  INT8_C(  94),
+        -INT8_C( 101), -INT8_C(  11),  INT8_C(  19),  INT8_C(  90), -INT8_C(  45), -INT8_C(  15), -INT8_C(  52),  INT8_C( 111),
+        -INT8_C(   7),  INT8_C(  40),  INT8_C(  51), -INT8_C( 107), -INT8_C(   2), -INT8_C(  41),  INT8_C(  97),  INT8_C(  98),
+         INT8_C(  79),  INT8_C(   4),  INT8_C(  95),  INT8_C(  73), -INT8_C( 119), -INT8_C(  50), -INT8_C(  28), -INT8_C(  51),
+         INT8_C(  35),  INT8_C(  39),  INT8_C(  89), -INT8_C( 115),      INT8_MAX,  INT8_C(  35), -INT8_C(  21),  INT8_C(  26),
+         INT8_C(  25), -INT8_C(   2),  INT8_C( 116), -INT8_C(  20), -INT8_C(  16),  INT8_C(  64),  INT8_C(  92), -INT8_C(  23),
+         INT8_C( 104), -INT8_C( 113),  INT8_C( 126),  INT8_C( 102),  INT8_C( 102), -INT8_C(  33), -INT8_C(  55), -INT8_C(  74),
+        -INT8_C(  29),  INT8_C(  40), -INT8_C(   1),  INT8_C( 108), -INT8_C(  10), -INT8_C(  29),  INT8_C(  57),  INT8_C(  25) },
+      UINT64_C(14961963699746083338),
+      { -INT8_C( 111),  INT8_C(  24), -INT8_C(  69), -INT8_C( 127),  INT8_C(  88),  INT8_C(  23),  INT8_C( 106), -INT8_C(  63),
+        -INT8_C(  90), -INT8_C(  24),  INT8_C(  39),  INT8_C(  13), -INT8_C(  56), -INT8_C(  16), -INT8_C(  61), -INT8_C(  85),
+         INT8_C(  24), -INT8_C(  62),  INT8_C(  24),  INT8_C(  14), -INT8_C(  91),  INT8_C(  81),  INT8_C(  40), -INT8_C(  81),
+        -INT8_C(  28), -INT8_C(  49),  INT8_C(  56), -INT8_C( 102),  INT8_C(  97), -INT8_C(  37),  INT8_C( 105), -INT8_C(  14),
+        -INT8_C(  13),  INT8_C(  36),  INT8_C( 115),  INT8_C(  76),  INT8_C(  60), -INT8_C(  35),  INT8_C(  13), -INT8_C(  30),
+        -INT8_C(  58),  INT8_C(  52), -INT8_C(  17), -INT8_C( 114),  INT8_C(  37), -INT8_C(  78),  INT8_C(  57),  INT8_C(  61),
+         INT8_C( 116),  INT8_C(  81),  INT8_C(  76),  INT8_C(  25), -INT8_C(  93),  INT8_C( 116), -INT8_C(  56), -INT8_C( 121),
+         INT8_C(  67),  INT8_C(   0),  INT8_C(  33), -INT8_C(  92), -INT8_C(  36), -INT8_C( 118), -INT8_C( 105), -INT8_C(  49) },
+      {  INT8_C(  24), -INT8_C( 127), -INT8_C(  24), -INT8_C(  56), -INT8_C(  85),  INT8_C(  24), -INT8_C(  62),  INT8_C(  24),
+         INT8_C(  81), -INT8_C(  81), -INT8_C(  28), -INT8_C( 102), -INT8_C(  14),  INT8_C(  36),  INT8_C( 115),  INT8_C(  60),
+        -INT8_C(  35), -INT8_C(  30),  INT8_C(  52),  INT8_C(  37),  INT8_C(  61),  INT8_C( 116),  INT8_C(  81),  INT8_C( 116),
+        -INT8_C( 121),  INT8_C(  67),  INT8_C(   0),  INT8_C(  33), -INT8_C(  92), -INT8_C( 105), -INT8_C(  49), -INT8_C(  51),
+         INT8_C(  35),  INT8_C(  39),  INT8_C(  89), -INT8_C( 115),      INT8_MAX,  INT8_C(  35), -INT8_C(  21),  INT8_C(  26),
+         INT8_C(  25), -INT8_C(   2),  INT8_C( 116), -INT8_C(  20), -INT8_C(  16),  INT8_C(  64),  INT8_C(  92), -INT8_C(  23),
+         INT8_C( 104), -INT8_C( 113),  INT8_C( 126),  INT8_C( 102),  INT8_C( 102), -INT8_C(  33), -INT8_C(  55), -INT8_C(  74),
+        -INT8_C(  29),  INT8_C(  40), -INT8_C(   1),  INT8_C( 108), -INT8_C(  10), -INT8_C(  29),  INT8_C(  57),  INT8_C(  25) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi8(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i r = simde_mm512_mask_compress_epi8(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x64(r, simde_mm512_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m512i src = simde_test_x86_random_i8x64();
+    simde__mmask64 k = simde_test_x86_random_mmask64();
+    simde__m512i a = simde_test_x86_random_i8x64();
+    simde__m512i r = simde_mm512_mask_compress_epi8(src, k, a);
+
+    simde_test_x86_write_i8x64(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask64(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x64(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x64(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_maskz_compress_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask64 k;
+    const int8_t a[64];
+    const int8_t r[64];
+  } test_vec[] = {
+    { UINT64_C(12595768713650309806),
+      {  INT8_C(  93), -INT8_C(  68),  INT8_C(  60), -INT8_C( 126),  INT8_C( 111),  INT8_C( 117), -INT8_C(  65), -INT8_C(  29),
+        -INT8_C(  57),  INT8_C(  11), -INT8_C(   3),  INT8_C( 106),      INT8_MAX, -INT8_C(  59), -INT8_C(  15), -INT8_C(  62),
+        -INT8_C(  58),  INT8_C(  18),  INT8_C( 103), -INT8_C(  94), -INT8_C( 100), -INT8_C(   2),  INT8_C( 113),  INT8_C(  74),
+         INT8_C(   8), -INT8_C( 115),  INT8_C(  53), -INT8_C(  16), -INT8_C(  75),  INT8_C(   2), -INT8_C(  98),  INT8_C(  18),
+        -INT8_C(  66), -INT8_C(  38), -INT8_C( 108),  INT8_C(  45),  INT8_C(  80),  INT8_C(  84),  INT8_C(  17),  INT8_C(  23),
+         INT8_C(  95),  INT8_C(  14), -INT8_C( 127), -INT8_C(  33), -INT8_C(  45),  INT8_C( 114), -INT8_C(  95), -INT8_C( 103),
+        -INT8_C( 124),  INT8_C(   8),  INT8_C(  59),  INT8_C(  32),  INT8_C(   6), -INT8_C(  83),  INT8_C( 106),  INT8_C(  15),
+         INT8_C(  58), -INT8_C(  97), -INT8_C(   1), -INT8_C(  17), -INT8_C(  95), -INT8_C(  98),  INT8_C(   2),  INT8_C(  96) },
+      { -INT8_C(  68),  INT8_C(  60), -INT8_C( 126),  INT8_C( 117), -INT8_C(  29),  INT8_C(  11),  INT8_C( 106), -INT8_C(  58),
+         INT8_C(  18), -INT8_C(  94), -INT8_C( 100), -INT8_C( 115), -INT8_C(  16),  INT8_C(   2), -INT8_C(  98),  INT8_C(  18),
+         INT8_C(  45),  INT8_C(  84),  INT8_C(  17),  INT8_C(  23), -INT8_C(  33),  INT8_C( 114), -INT8_C( 124),  INT8_C(  59),
+         INT8_C(  32),  INT8_C( 106),  INT8_C(  15), -INT8_C(  97), -INT8_C(   1), -INT8_C(  17), -INT8_C(  98),  INT8_C(  96),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C( 5395205609837401720),
+      { -INT8_C(  84),  INT8_C(  96),  INT8_C(  41),      INT8_MIN, -INT8_C(  46), -INT8_C(  54),  INT8_C(  25),  INT8_C(  86),
+        -INT8_C(  45),  INT8_C(  85),  INT8_C( 118), -INT8_C(  39),  INT8_C(   2), -INT8_C(  31), -INT8_C(  24),  INT8_C(  60),
+             INT8_MIN, -INT8_C(  24),  INT8_C(  43),  INT8_C(  34), -INT8_C( 122),  INT8_C(  45), -INT8_C( 126), -INT8_C(   2),
+        -INT8_C(  60),  INT8_C(  15), -INT8_C(  57), -INT8_C(  82), -INT8_C(  82), -INT8_C(  90), -INT8_C(   8),  INT8_C(  90),
+         INT8_C(   7),  INT8_C(  33), -INT8_C(  38), -INT8_C(  39), -INT8_C(  20), -INT8_C(  12),  INT8_C(  48), -INT8_C(  65),
+         INT8_C(  73), -INT8_C(  90), -INT8_C( 104),  INT8_C(  75), -INT8_C( 121), -INT8_C( 127), -INT8_C( 121),  INT8_C(   8),
+         INT8_C( 105), -INT8_C(  78),  INT8_C(  42), -INT8_C(  17), -INT8_C(  32), -INT8_C(  84), -INT8_C(  19), -INT8_C(  92),
+        -INT8_C(  69), -INT8_C(  76),  INT8_C(  82),  INT8_C( 105),  INT8_C(  91),  INT8_C(  75), -INT8_C(  60),  INT8_C(  98) },
+      {      INT8_MIN, -INT8_C(  46), -INT8_C(  54),  INT8_C(  25),  INT8_C(  85),  INT8_C( 118),  INT8_C(   2),  INT8_C(  60),
+             INT8_MIN,  INT8_C(  43),  INT8_C(  34), -INT8_C(   2), -INT8_C(  82), -INT8_C(   8),  INT8_C(  90),  INT8_C(  33),
+        -INT8_C(  39), -INT8_C(  12),  INT8_C(  48), -INT8_C(  65), -INT8_C(  90), -INT8_C( 104),  INT8_C(  75), -INT8_C( 121),
+         INT8_C(   8),  INT8_C( 105), -INT8_C(  78),  INT8_C(  42), -INT8_C(  17), -INT8_C(  32), -INT8_C(  19), -INT8_C(  92),
+        -INT8_C(  76),  INT8_C( 105), -INT8_C(  60),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C(15787205295060262508),
+      {  INT8_C(  18), -INT8_C(  80),  INT8_C(  38), -INT8_C( 103),  INT8_C(  49), -INT8_C(  83), -INT8_C(  95), -INT8_C( 102),
+         INT8_C(  96), -INT8_C(  53), -INT8_C( 119),  INT8_C(  64),  INT8_C( 119),  INT8_C( 118), -INT8_C(  28),  INT8_C(  51),
+         INT8_C(  43),  INT8_C(  54), -INT8_C( 100), -INT8_C( 122), -INT8_C( 127),  INT8_C(  96), -INT8_C(  24), -INT8_C(  18),
+        -INT8_C(   1),  INT8_C(  35),  INT8_C(  70), -INT8_C( 111), -INT8_C( 113),  INT8_C(  94),  INT8_C( 109), -INT8_C(  95),
+         INT8_C(  14), -INT8_C( 109),  INT8_C(  58),  INT8_C(  63),  INT8_C(  65), -INT8_C(  36), -INT8_C(  39), -INT8_C(  95),
+        -INT8_C(  89),  INT8_C(  98), -INT8_C(  31),  INT8_C(  31), -INT8_C(  40), -INT8_C(  59),  INT8_C(  82),  INT8_C(   3),
+        -INT8_C(   5), -INT8_C(  18), -INT8_C( 119),  INT8_C( 125),  INT8_C(  79),  INT8_C( 113),  INT8_C( 107),  INT8_C(  78),
+        -INT8_C( 107), -INT8_C(  79), -INT8_C(  33),  INT8_C(  36),  INT8_C(  15),  INT8_C(  76), -INT8_C(  59),  INT8_C(  29) },
+      {  INT8_C(  38), -INT8_C( 103), -INT8_C(  83), -INT8_C(  95), -INT8_C(  53), -INT8_C( 119),  INT8_C(  64),  INT8_C( 119),
+         INT8_C(  51),  INT8_C(  43),  INT8_C(  54), -INT8_C( 122), -INT8_C( 127),  INT8_C(  96), -INT8_C( 111), -INT8_C( 113),
+         INT8_C( 109), -INT8_C( 109),  INT8_C(  65), -INT8_C(  95), -INT8_C(  89),  INT8_C(  98),  INT8_C(  31), -INT8_C(  59),
+         INT8_C(  82), -INT8_C(   5), -INT8_C(  18), -INT8_C( 119),  INT8_C(  79), -INT8_C( 107), -INT8_C(  79),  INT8_C(  36),
+         INT8_C(  15), -INT8_C(  59),  INT8_C(  29),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C( 9494210179724279776),
+      { -INT8_C( 105), -INT8_C(  93), -INT8_C(  94),  INT8_C( 112),  INT8_C( 104), -INT8_C(  12),  INT8_C( 115),  INT8_C(  99),
+        -INT8_C(  30), -INT8_C(   3), -INT8_C(  32),  INT8_C(  49),  INT8_C( 110),  INT8_C(  75),      INT8_MAX,  INT8_C(   3),
+        -INT8_C(   3),  INT8_C(  95),  INT8_C(  39),  INT8_C(  12), -INT8_C(  85), -INT8_C(  20),  INT8_C(  42), -INT8_C( 117),
+        -INT8_C(  20), -INT8_C( 122), -INT8_C(  84), -INT8_C(  57), -INT8_C(  68),  INT8_C( 110),  INT8_C(  74),  INT8_C(  83),
+         INT8_C(  17), -INT8_C(  20), -INT8_C(  61),  INT8_C( 121), -INT8_C(  32),  INT8_C(  55), -INT8_C(  35), -INT8_C(  61),
+         INT8_C(  52), -INT8_C(  67), -INT8_C(  12), -INT8_C(  94),  INT8_C(   9),  INT8_C( 116), -INT8_C(  90),  INT8_C(   6),
+        -INT8_C(  45), -INT8_C(  51),  INT8_C(  18),  INT8_C( 126), -INT8_C(  70),  INT8_C(  60),  INT8_C(  10), -INT8_C(  90),
+        -INT8_C(  61), -INT8_C(  74),  INT8_C( 109),      INT8_MAX,  INT8_C(  37), -INT8_C(  72), -INT8_C(  46),  INT8_C(  54) },
+      { -INT8_C(  12),  INT8_C( 115),  INT8_C(  99), -INT8_C(  30), -INT8_C(   3), -INT8_C(  32),  INT8_C(  49),  INT8_C( 110),
+         INT8_C(  75),      INT8_MAX,  INT8_C(   3),  INT8_C(  39),  INT8_C(  12), -INT8_C(  85),  INT8_C(  42), -INT8_C(  20),
+         INT8_C( 110),  INT8_C(  17), -INT8_C(  20),  INT8_C( 121), -INT8_C(  32), -INT8_C(  35), -INT8_C(  61),  INT8_C(  52),
+        -INT8_C(  12),  INT8_C(   9),  INT8_C( 116), -INT8_C(  51),  INT8_C(  10), -INT8_C(  90), -INT8_C(  61), -INT8_C(  74),
+         INT8_C(  54),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C(   92479706211849892),
+      {  INT8_C(  74),  INT8_C(  60), -INT8_C(  93),  INT8_C(  83), -INT8_C(  80),  INT8_C(  73),  INT8_C(  89), -INT8_C( 125),
+         INT8_C(  23),  INT8_C( 108),  INT8_C(   2), -INT8_C(  47), -INT8_C(  88),  INT8_C(  12),  INT8_C( 119),  INT8_C( 107),
+        -INT8_C(  62), -INT8_C(  28), -INT8_C(  22), -INT8_C(  25), -INT8_C( 100), -INT8_C(  67),  INT8_C(  30),  INT8_C(  65),
+         INT8_C(  83), -INT8_C(  50), -INT8_C(  58),  INT8_C(  32),  INT8_C(  91),  INT8_C(  14),  INT8_C(  33), -INT8_C(  91),
+         INT8_C(  74), -INT8_C(  60), -INT8_C(   7), -INT8_C(   5),  INT8_C(  14),  INT8_C(  82),  INT8_C( 126),  INT8_C(  37),
+        -INT8_C(  66),      INT8_MIN, -INT8_C(  10),  INT8_C( 103), -INT8_C( 116),  INT8_C( 109), -INT8_C(  46),  INT8_C(  79),
+         INT8_C(  81), -INT8_C(  67),  INT8_C(  54), -INT8_C(  18),  INT8_C( 122),  INT8_C(  84),  INT8_C(  47), -INT8_C(  51),
+         INT8_C(  34), -INT8_C(  11), -INT8_C(  19),  INT8_C( 125),  INT8_C(   3),  INT8_C(  14),  INT8_C(  35),  INT8_C(  77) },
+      { -INT8_C(  93),  INT8_C(  73), -INT8_C( 125),  INT8_C( 108),  INT8_C(   2), -INT8_C(  88),  INT8_C( 107), -INT8_C( 100),
+        -INT8_C(  67),  INT8_C(  65),  INT8_C(  83), -INT8_C(  58), -INT8_C(  91),  INT8_C(  74), -INT8_C(   7), -INT8_C(   5),
+         INT8_C( 126),  INT8_C(  37), -INT8_C(  66), -INT8_C(  10),  INT8_C( 103),  INT8_C(  79), -INT8_C(  18),  INT8_C(  47),
+         INT8_C(  34),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C( 3244218385613462738),
+      {  INT8_C(  71), -INT8_C(   5), -INT8_C( 108), -INT8_C(  44),  INT8_C( 104),  INT8_C( 102),  INT8_C(  35), -INT8_C(  70),
+         INT8_C(  35),  INT8_C(  89), -INT8_C(  88), -INT8_C(  99), -INT8_C(  82), -INT8_C(  41),  INT8_C( 106), -INT8_C(  48),
+        -INT8_C(  52),  INT8_C(  87),  INT8_C(  78), -INT8_C(  49),  INT8_C( 101),  INT8_C( 113),  INT8_C(  28),  INT8_C(  56),
+        -INT8_C( 115),  INT8_C( 101),  INT8_C(  24), -INT8_C(   5),  INT8_C(  44),  INT8_C(  30),  INT8_C(  40),  INT8_C( 115),
+         INT8_C(  25), -INT8_C(  68),  INT8_C(  71), -INT8_C( 126),  INT8_C(  35),  INT8_C( 106),  INT8_C(  60),  INT8_C(  70),
+        -INT8_C(  60), -INT8_C(  28), -INT8_C(  28),  INT8_C( 114), -INT8_C(  69),  INT8_C(  78),  INT8_C(  66), -INT8_C( 121),
+        -INT8_C(  90), -INT8_C( 112),  INT8_C(  86),  INT8_C(  11),  INT8_C(   1),  INT8_C( 114),  INT8_C(  67), -INT8_C( 114),
+        -INT8_C(  41),  INT8_C(  92), -INT8_C( 118),  INT8_C(   3),  INT8_C( 122), -INT8_C(  78),  INT8_C( 119), -INT8_C( 109) },
+      { -INT8_C(   5),  INT8_C( 104),  INT8_C(  35), -INT8_C(  70), -INT8_C(  88), -INT8_C(  99), -INT8_C(  82), -INT8_C(  49),
+         INT8_C(  28),  INT8_C(  30),  INT8_C(  40),  INT8_C( 115), -INT8_C(  68),  INT8_C(  71), -INT8_C( 126),  INT8_C( 106),
+         INT8_C(  60), -INT8_C(  60), -INT8_C(  28), -INT8_C(  28),  INT8_C(  66), -INT8_C( 121), -INT8_C(  90),  INT8_C(  86),
+        -INT8_C(  41), -INT8_C( 118),  INT8_C(   3), -INT8_C(  78),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C(17138537620944830063),
+      {  INT8_C(  53), -INT8_C(  68),  INT8_C(  95), -INT8_C(  16),  INT8_C(  11), -INT8_C(  95),  INT8_C( 119), -INT8_C(  79),
+         INT8_C(  50), -INT8_C(  51), -INT8_C(  68),  INT8_C(  51),  INT8_C(  64),  INT8_C(   0), -INT8_C(  62),  INT8_C(  23),
+         INT8_C(  92),  INT8_C(  76),  INT8_C(  27), -INT8_C(  42), -INT8_C(   2), -INT8_C( 110),  INT8_C( 105),  INT8_C( 109),
+         INT8_C(  80),      INT8_MAX, -INT8_C(   1),  INT8_C( 121), -INT8_C(  48), -INT8_C(  40),  INT8_C( 102),  INT8_C(   6),
+        -INT8_C( 108), -INT8_C(  59), -INT8_C(  10), -INT8_C(  97),  INT8_C( 103),  INT8_C( 110),  INT8_C(  80), -INT8_C( 103),
+         INT8_C(  59),  INT8_C(  13), -INT8_C(  52),  INT8_C( 123),  INT8_C(  13), -INT8_C( 114), -INT8_C( 109),  INT8_C( 105),
+        -INT8_C(  38), -INT8_C(  82),  INT8_C(  63), -INT8_C(  39),  INT8_C(  64), -INT8_C(  88),  INT8_C(  70), -INT8_C( 112),
+         INT8_C(  39),  INT8_C(  70),  INT8_C(  10), -INT8_C(   8),  INT8_C(  30),  INT8_C( 112), -INT8_C(   2), -INT8_C(  78) },
+      {  INT8_C(  53), -INT8_C(  68),  INT8_C(  95), -INT8_C(  16), -INT8_C(  95),  INT8_C( 119), -INT8_C(  51), -INT8_C(  68),
+         INT8_C(  51),  INT8_C(  64),  INT8_C(   0),  INT8_C(  23),  INT8_C(  92),  INT8_C(  27), -INT8_C(   2),      INT8_MAX,
+        -INT8_C(  48),  INT8_C(   6), -INT8_C( 108), -INT8_C(  97),  INT8_C( 110),  INT8_C(  59),  INT8_C(  13), -INT8_C( 109),
+        -INT8_C(  39),  INT8_C(  64),  INT8_C(  70), -INT8_C( 112),  INT8_C(  39),  INT8_C(  10), -INT8_C(   8),  INT8_C( 112),
+        -INT8_C(   2), -INT8_C(  78),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C(11400478051164943414),
+      { -INT8_C(  81),  INT8_C(   2),  INT8_C(  25), -INT8_C(  68), -INT8_C( 111), -INT8_C(  84),  INT8_C(  37),  INT8_C( 107),
+         INT8_C(  90),  INT8_C( 100),  INT8_C(  68), -INT8_C( 102),  INT8_C(  13), -INT8_C( 117),  INT8_C(  43),  INT8_C(  52),
+        -INT8_C(  47),  INT8_C(  53),  INT8_C(  44), -INT8_C(  17), -INT8_C(  91),  INT8_C(  42), -INT8_C(  95), -INT8_C(  37),
+         INT8_C(  31), -INT8_C(  13),  INT8_C( 120), -INT8_C( 127), -INT8_C( 106), -INT8_C(  82),  INT8_C(  31),  INT8_C(  69),
+        -INT8_C(  79),  INT8_C(  57),  INT8_C(   2),  INT8_C(  66), -INT8_C(  27),  INT8_C(  39), -INT8_C(  83),  INT8_C(  64),
+        -INT8_C( 116), -INT8_C(  14), -INT8_C(  38), -INT8_C( 103),  INT8_C( 125),  INT8_C(   5), -INT8_C(  51),  INT8_C(  78),
+         INT8_C(  58), -INT8_C(   6),  INT8_C(  61), -INT8_C(  32),  INT8_C(  36), -INT8_C(  34), -INT8_C(  69),  INT8_C(  67),
+        -INT8_C(  46),  INT8_C(  52), -INT8_C(  59),  INT8_C( 104), -INT8_C(  30), -INT8_C(  28), -INT8_C(  83), -INT8_C( 109) },
+      {  INT8_C(   2),  INT8_C(  25), -INT8_C( 111), -INT8_C(  84),  INT8_C(  68),  INT8_C(  13), -INT8_C( 117),  INT8_C(  43),
+         INT8_C(  52),  INT8_C(  53), -INT8_C(  91), -INT8_C(  95),  INT8_C(  31),  INT8_C( 120), -INT8_C( 127), -INT8_C( 106),
+         INT8_C(  69),  INT8_C(  57),  INT8_C(  39), -INT8_C(  83), -INT8_C(  14),  INT8_C(   5),  INT8_C(  78), -INT8_C(   6),
+         INT8_C(  61),  INT8_C(  36), -INT8_C(  34),  INT8_C(  52), -INT8_C(  59),  INT8_C( 104), -INT8_C(  30), -INT8_C( 109),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i r = simde_mm512_maskz_compress_epi8(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x64(r, simde_mm512_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask64 k = simde_test_x86_random_mmask64();
+    simde__m512i a = simde_test_x86_random_i8x64();
+    simde__m512i r = simde_mm512_maskz_compress_epi8(k, a);
+
+    simde_test_x86_write_mmask64(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i8x64(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x64(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_mask_compressstoreu_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask64 k;
+    const int8_t a[64];
+    const int8_t r[64];
+  } test_vec[] = {
+    { UINT64_C( 7152705592700022557),
+      {  INT8_C( 117),  INT8_C(  29), -INT8_C(   4), -INT8_C(  14),  INT8_C(  35), -INT8_C(  55),  INT8_C(  64),  INT8_C(  93),
+        -INT8_C(  61),  INT8_C( 125),  INT8_C(  61), -INT8_C(  24),  INT8_C(  91), -INT8_C(   7),  INT8_C(  43),  INT8_C(  45),
+         INT8_C(  45), -INT8_C(  16), -INT8_C( 107),  INT8_C(  15), -INT8_C(  43),  INT8_C(  67), -INT8_C(  93), -INT8_C(  14),
+        -INT8_C(  14),  INT8_C( 120), -INT8_C(  11), -INT8_C(  55), -INT8_C(   5),  INT8_C(  56),  INT8_C(  44),  INT8_C( 112),
+         INT8_C(  86),  INT8_C(  40),  INT8_C(  98),  INT8_C( 121), -INT8_C(  14), -INT8_C(  94), -INT8_C(  42), -INT8_C(  75),
+         INT8_C(  31),  INT8_C(  20), -INT8_C(  99),  INT8_C( 123),  INT8_C(  13), -INT8_C(  55), -INT8_C(  88),  INT8_C(  58),
+        -INT8_C(  71),  INT8_C(  62),  INT8_C(  73), -INT8_C( 114), -INT8_C( 127), -INT8_C(  20), -INT8_C( 127),  INT8_C( 115),
+         INT8_C( 101),  INT8_C( 118),  INT8_C(  61),  INT8_C(  96), -INT8_C(  81),  INT8_C( 105), -INT8_C(  47),  INT8_C(   5) },
+      {  INT8_C( 117), -INT8_C(   4), -INT8_C(  14),  INT8_C(  35), -INT8_C(  61),  INT8_C( 125),  INT8_C(  61), -INT8_C(  24),
+        -INT8_C(   7),  INT8_C(  45),  INT8_C(  45), -INT8_C( 107), -INT8_C(  43), -INT8_C(  93), -INT8_C(  14), -INT8_C(  14),
+         INT8_C( 120),  INT8_C(  86),  INT8_C(  40),  INT8_C(  98), -INT8_C(  14), -INT8_C(  42), -INT8_C(  75),  INT8_C(  31),
+         INT8_C(  20),  INT8_C(  58), -INT8_C(  71),  INT8_C(  62), -INT8_C( 127),  INT8_C( 101),  INT8_C( 118),  INT8_C( 105),
+        -INT8_C(  47),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C(17670247893287449490),
+      {  INT8_C( 104), -INT8_C(  41),  INT8_C( 112),  INT8_C( 117), -INT8_C(  96),  INT8_C(  25), -INT8_C(  81),  INT8_C(  89),
+         INT8_C(  87), -INT8_C(   7), -INT8_C(  24), -INT8_C(  40), -INT8_C(  27),  INT8_C( 105),  INT8_C(  75),  INT8_C(  74),
+        -INT8_C(  33), -INT8_C( 120), -INT8_C(  85), -INT8_C( 114), -INT8_C(  14),  INT8_C( 124), -INT8_C( 109), -INT8_C( 124),
+        -INT8_C(  81),  INT8_C(  17),  INT8_C(   8), -INT8_C( 123),  INT8_C( 102),  INT8_C(  65),  INT8_C( 123), -INT8_C(  50),
+         INT8_C(  24), -INT8_C(  21),  INT8_C(  68), -INT8_C(  72),  INT8_C(   4), -INT8_C(  13),  INT8_C(  18),  INT8_C(  91),
+        -INT8_C(  20), -INT8_C(   6),  INT8_C(  51), -INT8_C(  46),  INT8_C(  99),      INT8_MAX,  INT8_C(  28),  INT8_C(  66),
+         INT8_C(   7), -INT8_C(  57), -INT8_C(  47), -INT8_C(   7),  INT8_C(  67),  INT8_C( 100),  INT8_C( 125), -INT8_C(  13),
+         INT8_C( 118), -INT8_C( 123),  INT8_C( 120), -INT8_C(  36), -INT8_C(  57), -INT8_C(  13), -INT8_C(  86), -INT8_C(  33) },
+      { -INT8_C(  41), -INT8_C(  96),  INT8_C(  89),  INT8_C(  87), -INT8_C(   7), -INT8_C(  27),  INT8_C( 105), -INT8_C( 120),
+        -INT8_C(  85), -INT8_C( 114), -INT8_C(  14),  INT8_C( 124), -INT8_C( 109),  INT8_C(   8), -INT8_C(  50), -INT8_C(  21),
+         INT8_C(  68),  INT8_C(   4),  INT8_C(  18),  INT8_C(  91),  INT8_C(  51),  INT8_C(  99),  INT8_C(  28),  INT8_C(   7),
+        -INT8_C(   7),  INT8_C(  67),  INT8_C( 100),  INT8_C( 118),  INT8_C( 120), -INT8_C(  57), -INT8_C(  13), -INT8_C(  86),
+        -INT8_C(  33),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C(14861785186803707615),
+      { -INT8_C(  92),  INT8_C( 114), -INT8_C(  96),  INT8_C(   7), -INT8_C(  15), -INT8_C(  67),  INT8_C(  73), -INT8_C(   7),
+        -INT8_C( 124),  INT8_C(  26), -INT8_C(  14), -INT8_C(  56),      INT8_MAX,  INT8_C( 112), -INT8_C(  69), -INT8_C(  11),
+        -INT8_C(  11),  INT8_C(  51), -INT8_C(  47), -INT8_C(  68),  INT8_C(  39),  INT8_C( 123), -INT8_C( 100),  INT8_C(   6),
+         INT8_C( 106),  INT8_C(  52), -INT8_C(  23),  INT8_C(  76), -INT8_C(  34),  INT8_C(  40),  INT8_C(  26), -INT8_C( 126),
+        -INT8_C( 101), -INT8_C(  69), -INT8_C( 119), -INT8_C( 116),  INT8_C( 120), -INT8_C(  46), -INT8_C( 123), -INT8_C(   4),
+        -INT8_C(  19),  INT8_C( 120), -INT8_C(  60),  INT8_C( 108), -INT8_C(  24),      INT8_MAX,  INT8_C(  97), -INT8_C(  35),
+        -INT8_C(  77),  INT8_C(  50), -INT8_C( 102), -INT8_C(  38), -INT8_C(  83),  INT8_C(  54), -INT8_C(  32),  INT8_C(  23),
+         INT8_C( 106), -INT8_C(  55),  INT8_C(  99),  INT8_C(  72), -INT8_C(  14),  INT8_C( 126), -INT8_C(  54), -INT8_C( 115) },
+      { -INT8_C(  92),  INT8_C( 114), -INT8_C(  96),  INT8_C(   7), -INT8_C(  15),  INT8_C(  73), -INT8_C(   7),  INT8_C(  26),
+        -INT8_C(  14), -INT8_C(  56),  INT8_C( 112), -INT8_C(  69), -INT8_C(  11), -INT8_C(  68),  INT8_C(  39),  INT8_C(   6),
+         INT8_C( 106),  INT8_C(  52),  INT8_C(  40),  INT8_C(  26), -INT8_C( 126), -INT8_C(  69), -INT8_C(  46), -INT8_C( 123),
+        -INT8_C(   4),  INT8_C( 120),  INT8_C( 108),      INT8_MAX, -INT8_C(  35), -INT8_C(  77),  INT8_C(  50), -INT8_C( 102),
+        -INT8_C(  38), -INT8_C(  83),  INT8_C(  54), -INT8_C(  55),  INT8_C(  99),  INT8_C(  72), -INT8_C(  54), -INT8_C( 115),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C( 1345906847887479609),
+      {  INT8_C(  23),  INT8_C( 114),  INT8_C( 126), -INT8_C(   1), -INT8_C(  15), -INT8_C(  33), -INT8_C(  36), -INT8_C(  92),
+         INT8_C(  17),  INT8_C( 118),  INT8_C( 126), -INT8_C(  65), -INT8_C(  84),  INT8_C(  94), -INT8_C(  42),  INT8_C(  22),
+         INT8_C(  40),  INT8_C(  58),  INT8_C(  94),  INT8_C(  26), -INT8_C(  72),  INT8_C(  40), -INT8_C(  89), -INT8_C(  15),
+         INT8_C( 123), -INT8_C(  64), -INT8_C(  94), -INT8_C(  95),  INT8_C(  95),  INT8_C(  79), -INT8_C(  77),  INT8_C( 118),
+        -INT8_C(  63),  INT8_C(  50),  INT8_C( 117), -INT8_C(  77),  INT8_C(  17),  INT8_C(  82),  INT8_C(  87),  INT8_C(  35),
+        -INT8_C(  56), -INT8_C(  42), -INT8_C(  30),  INT8_C( 117),  INT8_C(  52), -INT8_C(  72), -INT8_C( 117),  INT8_C(  92),
+        -INT8_C(  14), -INT8_C(  22),  INT8_C( 118), -INT8_C(  86),  INT8_C(  18),  INT8_C(  29), -INT8_C( 101), -INT8_C( 114),
+        -INT8_C(  34),  INT8_C(  61),  INT8_C(  47),  INT8_C(  61), -INT8_C( 115), -INT8_C(  30), -INT8_C(  76),  INT8_C(  78) },
+      {  INT8_C(  23), -INT8_C(   1), -INT8_C(  15), -INT8_C(  33),  INT8_C(  17),  INT8_C( 118), -INT8_C(  84), -INT8_C(  42),
+         INT8_C(  40),  INT8_C(  26), -INT8_C(  72),  INT8_C( 123),  INT8_C(  95),  INT8_C(  79),  INT8_C( 118), -INT8_C(  63),
+         INT8_C( 117),  INT8_C(  82), -INT8_C(  56), -INT8_C(  42), -INT8_C(  30),  INT8_C( 117),  INT8_C(  52),  INT8_C(  92),
+        -INT8_C(  14),  INT8_C( 118), -INT8_C(  86),  INT8_C(  29), -INT8_C( 114),  INT8_C(  61), -INT8_C( 115),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C( 4920562453332437268),
+      {  INT8_C(  47),  INT8_C(  43), -INT8_C(  71),  INT8_C(  99), -INT8_C(  29),  INT8_C(  68), -INT8_C(  64), -INT8_C(  42),
+         INT8_C(  46),  INT8_C(  54),      INT8_MIN,  INT8_C(  65),  INT8_C(  84),  INT8_C(  28), -INT8_C(  49),  INT8_C(  50),
+         INT8_C(  89), -INT8_C(   2),  INT8_C( 111), -INT8_C(  26), -INT8_C(  32),  INT8_C(  35),  INT8_C(  53), -INT8_C(  11),
+         INT8_C(  77),  INT8_C(  54),  INT8_C(  27), -INT8_C(  56), -INT8_C( 113),  INT8_C( 100),  INT8_C(  12), -INT8_C(  66),
+        -INT8_C( 113), -INT8_C(  59),  INT8_C(  34),  INT8_C( 114),  INT8_C(  10), -INT8_C(  30),  INT8_C(  72),  INT8_C(  56),
+         INT8_C(  24), -INT8_C(  55),  INT8_C( 121),  INT8_C( 108), -INT8_C(  27),  INT8_C(  72), -INT8_C(  98),  INT8_C(  62),
+         INT8_C(  70),  INT8_C(  14),  INT8_C(  37),  INT8_C(  39),  INT8_C(  49),  INT8_C(  90),  INT8_C(  28),  INT8_C( 126),
+        -INT8_C( 112),  INT8_C(  55),  INT8_C(  71),  INT8_C(  32), -INT8_C( 101),  INT8_C(  83), -INT8_C(  34),  INT8_C(  42) },
+      { -INT8_C(  71), -INT8_C(  29),  INT8_C(  46),  INT8_C(  65),  INT8_C(  28),  INT8_C(  89),  INT8_C(  54),  INT8_C(  27),
+         INT8_C( 100), -INT8_C( 113), -INT8_C(  59),  INT8_C( 114),  INT8_C(  10), -INT8_C(  30),  INT8_C(  72),  INT8_C(  24),
+         INT8_C( 108), -INT8_C(  27), -INT8_C(  98),  INT8_C(  70),  INT8_C(  39),  INT8_C(  28),  INT8_C(  71), -INT8_C(  34),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C(18112323085823377433),
+      { -INT8_C(  82), -INT8_C(  43),  INT8_C( 103), -INT8_C( 109),  INT8_C(  29),  INT8_C(   6), -INT8_C(  47),  INT8_C( 100),
+         INT8_C(  20), -INT8_C(  10), -INT8_C( 117),  INT8_C(  69),  INT8_C(  80), -INT8_C(  89), -INT8_C(  60), -INT8_C(  31),
+        -INT8_C(  34),  INT8_C(  11),  INT8_C(   1),  INT8_C( 121),  INT8_C(  94), -INT8_C(  33), -INT8_C(  93),  INT8_C( 119),
+        -INT8_C(  32),  INT8_C(  63), -INT8_C( 102), -INT8_C(  62),  INT8_C(  36), -INT8_C(  10), -INT8_C(  67), -INT8_C(  46),
+        -INT8_C(  53),  INT8_C(  37),  INT8_C( 101), -INT8_C(  24),  INT8_C(  43),  INT8_C(  55),  INT8_C(  76),  INT8_C(  63),
+         INT8_C(  45), -INT8_C(  41), -INT8_C( 124),  INT8_C( 126),  INT8_C( 126),  INT8_C(  72),  INT8_C(  95),  INT8_C(  92),
+         INT8_C(  83),  INT8_C(  96), -INT8_C(  43), -INT8_C(  78),  INT8_C(  63),  INT8_C( 120),  INT8_C(  41),  INT8_C(  31),
+        -INT8_C(  72), -INT8_C(  60), -INT8_C(  30), -INT8_C(  36), -INT8_C(  70), -INT8_C(  97), -INT8_C(  81), -INT8_C( 123) },
+      { -INT8_C(  82), -INT8_C( 109),  INT8_C(  29),  INT8_C(   1),  INT8_C( 121),  INT8_C(  94),  INT8_C( 119), -INT8_C(  32),
+         INT8_C(  63), -INT8_C(  10),  INT8_C(  37),  INT8_C(  55),  INT8_C(  76),  INT8_C(  63),  INT8_C(  45), -INT8_C( 124),
+         INT8_C(  72),  INT8_C(  95),  INT8_C(  92),  INT8_C(  83),  INT8_C(  96), -INT8_C(  78),  INT8_C(  63),  INT8_C(  41),
+        -INT8_C(  72), -INT8_C(  60), -INT8_C(  36), -INT8_C(  70), -INT8_C(  97), -INT8_C(  81), -INT8_C( 123),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C( 8732121562820187332),
+      { -INT8_C( 111), -INT8_C(  77), -INT8_C(   9),  INT8_C(  16), -INT8_C(   5),  INT8_C(  86),  INT8_C( 108),  INT8_C(  79),
+        -INT8_C(  74),  INT8_C(  66),  INT8_C(   1), -INT8_C(  11), -INT8_C(  70),  INT8_C(  42),  INT8_C(  21),  INT8_C( 114),
+        -INT8_C(  18), -INT8_C(   9),  INT8_C(  79), -INT8_C(  88), -INT8_C( 106), -INT8_C(   2),  INT8_C(  45),  INT8_C(  91),
+         INT8_C(  18), -INT8_C( 101),  INT8_C(  74),  INT8_C(  94),  INT8_C(  85),  INT8_C( 121), -INT8_C(  41), -INT8_C(  26),
+         INT8_C(  44), -INT8_C(  50), -INT8_C(  10),  INT8_C(  39),  INT8_C(  36),  INT8_C(  99),  INT8_C( 118), -INT8_C(  38),
+        -INT8_C(  91),  INT8_C( 119), -INT8_C(  49),  INT8_C(  95), -INT8_C(  94), -INT8_C(  28), -INT8_C(  46), -INT8_C( 112),
+        -INT8_C(  37),  INT8_C(  33),  INT8_C(  57),  INT8_C( 114),  INT8_C(  31),  INT8_C( 102), -INT8_C(  51),  INT8_C(  49),
+         INT8_C(   1),  INT8_C(  23), -INT8_C( 113),  INT8_C(  86), -INT8_C( 112),  INT8_C( 102),  INT8_C(  61), -INT8_C(  68) },
+      { -INT8_C(   9),  INT8_C( 108),  INT8_C(  79),  INT8_C(   1), -INT8_C(  70), -INT8_C(  18),  INT8_C(  79), -INT8_C(  88),
+        -INT8_C(   2),  INT8_C(  45),  INT8_C(  18), -INT8_C( 101),  INT8_C(  74),  INT8_C(  94),  INT8_C( 121), -INT8_C(  41),
+        -INT8_C(  26),  INT8_C(  44), -INT8_C(  50),  INT8_C(  39),  INT8_C( 118),  INT8_C( 119),  INT8_C(  95), -INT8_C(  94),
+        -INT8_C(  28), -INT8_C( 112),  INT8_C(  33),  INT8_C(  57),  INT8_C( 114),  INT8_C( 102),  INT8_C(   1),  INT8_C(  86),
+        -INT8_C( 112),  INT8_C( 102),  INT8_C(  61),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C( 4265571398856225588),
+      { -INT8_C(  46),  INT8_C(   2), -INT8_C( 101),  INT8_C( 116), -INT8_C(  26),  INT8_C( 109),  INT8_C(   4), -INT8_C(  62),
+        -INT8_C( 114),  INT8_C(  61),  INT8_C(  52), -INT8_C(  83), -INT8_C(  92),  INT8_C(   1), -INT8_C(  34), -INT8_C(  91),
+         INT8_C(  24),  INT8_C( 110), -INT8_C(   4), -INT8_C(  87), -INT8_C(  44),  INT8_C(  57),  INT8_C( 101),  INT8_C(   9),
+         INT8_C( 108),  INT8_C(  73),  INT8_C(  97),  INT8_C(   3), -INT8_C(  92), -INT8_C( 108),  INT8_C(  62),  INT8_C( 118),
+        -INT8_C( 106), -INT8_C(  39), -INT8_C(  22),  INT8_C( 124),  INT8_C(  70), -INT8_C(  18),  INT8_C(  62), -INT8_C(  44),
+         INT8_C(  44),  INT8_C( 114), -INT8_C( 127), -INT8_C(  48),  INT8_C( 115),  INT8_C(  96),  INT8_C( 117), -INT8_C( 116),
+        -INT8_C(  50),  INT8_C( 113),  INT8_C(  53), -INT8_C(  94), -INT8_C(  86), -INT8_C( 102), -INT8_C(  85),  INT8_C(  23),
+        -INT8_C(  28),  INT8_C(  13),  INT8_C(  26), -INT8_C( 120), -INT8_C(  95),  INT8_C(  88), -INT8_C(   2),  INT8_C(  55) },
+      { -INT8_C( 101), -INT8_C(  26),  INT8_C( 109), -INT8_C( 114),  INT8_C(  61), -INT8_C(  92),  INT8_C(   1), -INT8_C(   4),
+         INT8_C(  57),  INT8_C( 101),  INT8_C(   9),  INT8_C(   3), -INT8_C(  92),  INT8_C(  62), -INT8_C(  39), -INT8_C(  22),
+         INT8_C(  70), -INT8_C(  44),  INT8_C( 114), -INT8_C(  48),  INT8_C( 115),  INT8_C( 117),  INT8_C( 113), -INT8_C(  86),
+        -INT8_C( 102), -INT8_C(  28),  INT8_C(  13), -INT8_C( 120), -INT8_C(  95),  INT8_C(  88),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i r = simde_mm512_setzero_si512();
+    simde_mm512_mask_compressstoreu_epi8(&r, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x64(r, simde_mm512_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask64 k = simde_test_x86_random_mmask64();
+    simde__m512i a = simde_test_x86_random_i8x64();
+    simde__m512i r = simde_mm512_setzero_si512();
+    simde_mm512_mask_compressstoreu_epi8(&r, k, a);
+
+    simde_test_x86_write_mmask64(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i8x64(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x64(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_mask_compress_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int16_t src[32];
+    const simde__mmask32 k;
+    const int16_t a[32];
+    const int16_t r[32];
+  } test_vec[] = {
+    { { -INT16_C(  6094),  INT16_C( 30899), -INT16_C(  3370),  INT16_C(   589), -INT16_C( 12700), -INT16_C( 10030),  INT16_C( 18478), -INT16_C(   924),
+        -INT16_C( 26183),  INT16_C( 25759),  INT16_C( 18995),  INT16_C(  6011), -INT16_C( 27305), -INT16_C(  1889), -INT16_C( 25107),  INT16_C(  7983),
+        -INT16_C(  7291),  INT16_C( 23704), -INT16_C(  6699),  INT16_C( 14686),  INT16_C( 12723), -INT16_C(  7663),  INT16_C( 30073),  INT16_C( 13022),
+         INT16_C( 32014),  INT16_C( 17046),  INT16_C(  4552),  INT16_C(  8025), -INT16_C(  1626), -INT16_C( 27624),  INT16_C( 18326),  INT16_C(  7347) },
+      UINT32_C(4286073642),
+      { -INT16_C( 10704), -INT16_C(  7111),  INT16_C( 18951), -INT16_C( 32570), -INT16_C( 23360), -INT16_C( 12621),  INT16_C( 18722), -INT16_C(  5616),
+         INT16_C( 27227),  INT16_C(   265),  INT16_C(  8547), -INT16_C(  1643),  INT16_C( 18793), -INT16_C( 27883), -INT16_C( 29292), -INT16_C( 14957),
+        -INT16_C( 13212),  INT16_C( 27561),  INT16_C( 28438), -INT16_C( 10516), -INT16_C( 24813),  INT16_C( 13733), -INT16_C( 18968),  INT16_C( 17183),
+         INT16_C( 10527), -INT16_C( 32187), -INT16_C(  9654), -INT16_C( 19588), -INT16_C( 28381), -INT16_C( 18361), -INT16_C(  9697), -INT16_C( 31875) },
+      { -INT16_C(  7111), -INT16_C( 32570), -INT16_C( 12621),  INT16_C( 27227),  INT16_C(   265), -INT16_C(  1643), -INT16_C( 29292), -INT16_C( 10516),
+        -INT16_C( 24813),  INT16_C( 13733), -INT16_C( 18968),  INT16_C( 10527), -INT16_C( 32187), -INT16_C(  9654), -INT16_C( 19588), -INT16_C( 28381),
+        -INT16_C( 18361), -INT16_C(  9697), -INT16_C( 31875),  INT16_C( 14686),  INT16_C( 12723), -INT16_C(  7663),  INT16_C( 30073),  INT16_C( 13022),
+         INT16_C( 32014),  INT16_C( 17046),  INT16_C(  4552),  INT16_C(  8025), -INT16_C(  1626), -INT16_C( 27624),  INT16_C( 18326),  INT16_C(  7347) } },
+    { {  INT16_C(  9894), -INT16_C( 17170), -INT16_C(  9579), -INT16_C( 22381),  INT16_C( 14457),  INT16_C( 25310), -INT16_C(   531),  INT16_C(  3493),
+        -INT16_C(  5594),  INT16_C( 29071),  INT16_C(  3013), -INT16_C(  6108),  INT16_C( 27549), -INT16_C( 17248),  INT16_C(  7493), -INT16_C(  5313),
+         INT16_C( 11587), -INT16_C( 10072),  INT16_C( 15112), -INT16_C( 32383),  INT16_C( 24435),  INT16_C( 24803), -INT16_C( 30372), -INT16_C( 31891),
+        -INT16_C(   653),  INT16_C( 14580),  INT16_C(  6152), -INT16_C( 23263), -INT16_C( 15996), -INT16_C( 13983), -INT16_C( 24353),  INT16_C(  8885) },
+      UINT32_C(3606797774),
+      {  INT16_C( 31896),  INT16_C(  2903),  INT16_C( 15323),  INT16_C( 14187), -INT16_C(  9788),  INT16_C( 14266), -INT16_C( 20778), -INT16_C(  8592),
+        -INT16_C( 28217),  INT16_C( 19332), -INT16_C(  6830),  INT16_C( 12564), -INT16_C( 13946),  INT16_C( 21588),  INT16_C( 20262), -INT16_C( 16854),
+        -INT16_C( 32309), -INT16_C( 22839),  INT16_C( 13756), -INT16_C( 32547), -INT16_C( 26610), -INT16_C(  6984),  INT16_C( 10310),  INT16_C(  3522),
+         INT16_C( 18105),  INT16_C(  2904),  INT16_C( 27948), -INT16_C( 19907), -INT16_C( 28362),  INT16_C( 23814),  INT16_C( 12512), -INT16_C( 21733) },
+      {  INT16_C(  2903),  INT16_C( 15323),  INT16_C( 14187), -INT16_C( 20778), -INT16_C(  8592), -INT16_C( 28217), -INT16_C(  6830),  INT16_C( 12564),
+        -INT16_C( 13946),  INT16_C( 20262), -INT16_C( 32309), -INT16_C( 22839), -INT16_C( 32547), -INT16_C( 26610), -INT16_C(  6984),  INT16_C( 10310),
+         INT16_C(  3522),  INT16_C(  2904),  INT16_C( 27948), -INT16_C( 28362),  INT16_C( 12512), -INT16_C( 21733), -INT16_C( 30372), -INT16_C( 31891),
+        -INT16_C(   653),  INT16_C( 14580),  INT16_C(  6152), -INT16_C( 23263), -INT16_C( 15996), -INT16_C( 13983), -INT16_C( 24353),  INT16_C(  8885) } },
+    { { -INT16_C(  6735),  INT16_C( 28241),  INT16_C( 11802),  INT16_C( 10478), -INT16_C( 22842),  INT16_C(  3340), -INT16_C( 12594), -INT16_C( 30950),
+         INT16_C( 29461),  INT16_C( 16787), -INT16_C( 12064),  INT16_C(  5875), -INT16_C(  1695),  INT16_C( 16755), -INT16_C( 28887), -INT16_C(  9492),
+         INT16_C( 15732), -INT16_C( 29112),  INT16_C( 14187),  INT16_C( 12982), -INT16_C( 15651), -INT16_C( 21441),  INT16_C( 22928), -INT16_C( 23245),
+        -INT16_C( 14644), -INT16_C( 21274), -INT16_C(  9834), -INT16_C(  2109),  INT16_C( 14034), -INT16_C(  1224),  INT16_C(  9413),  INT16_C( 14806) },
+      UINT32_C(3452378721),
+      {  INT16_C( 32085),  INT16_C( 13311),  INT16_C( 15935), -INT16_C( 12065),  INT16_C(  4759),  INT16_C( 25717),  INT16_C( 23769),  INT16_C( 28432),
+        -INT16_C( 11467),  INT16_C(  2151), -INT16_C( 24822), -INT16_C( 12541), -INT16_C(  9788),  INT16_C(  9481), -INT16_C( 12040),  INT16_C( 19954),
+        -INT16_C(  3762), -INT16_C( 29312),  INT16_C( 24367), -INT16_C( 14499), -INT16_C( 11406),  INT16_C( 19243),  INT16_C( 15151),  INT16_C( 25786),
+         INT16_C(  8463),  INT16_C(  6508),  INT16_C( 28865), -INT16_C( 31256), -INT16_C(  3767),  INT16_C( 16810), -INT16_C( 25150),  INT16_C(  4239) },
+      {  INT16_C( 32085),  INT16_C( 25717),  INT16_C( 23769),  INT16_C(  2151), -INT16_C( 24822), -INT16_C( 12541), -INT16_C(  9788), -INT16_C(  3762),
+        -INT16_C( 29312),  INT16_C( 24367),  INT16_C( 15151),  INT16_C( 25786),  INT16_C(  8463),  INT16_C( 28865), -INT16_C( 31256), -INT16_C( 25150),
+         INT16_C(  4239), -INT16_C( 29112),  INT16_C( 14187),  INT16_C( 12982), -INT16_C( 15651), -INT16_C( 21441),  INT16_C( 22928), -INT16_C( 23245),
+        -INT16_C( 14644), -INT16_C( 21274), -INT16_C(  9834), -INT16_C(  2109),  INT16_C( 14034), -INT16_C(  1224),  INT16_C(  9413),  INT16_C( 14806) } },
+    { {  INT16_C(  3982), -INT16_C( 16739), -INT16_C(  1169), -INT16_C(  7803), -INT16_C( 20274), -INT16_C(   724), -INT16_C(  6421), -INT16_C(  1439),
+        -INT16_C( 12792), -INT16_C( 14061), -INT16_C(   962), -INT16_C( 30898), -INT16_C(  1811), -INT16_C( 20535),  INT16_C( 22677),  INT16_C(  9407),
+         INT16_C( 23911), -INT16_C( 10526),  INT16_C( 26456),  INT16_C(  9911), -INT16_C(  7401),  INT16_C(   547), -INT16_C( 31542), -INT16_C( 11523),
+         INT16_C(  4178), -INT16_C( 28517), -INT16_C(  5876), -INT16_C(  1512), -INT16_C(  7711),  INT16_C( 30633),  INT16_C( 26937), -INT16_C( 24421) },
+      UINT32_C( 511147462),
+      {  INT16_C( 12004), -INT16_C(  1212),  INT16_C( 26386), -INT16_C(  8963), -INT16_C(  1301),  INT16_C( 16046),  INT16_C( 18699),  INT16_C(  6094),
+        -INT16_C(  6606),  INT16_C(  4881), -INT16_C( 17465),  INT16_C(   138),  INT16_C(  9508), -INT16_C(  5471),  INT16_C(  6306), -INT16_C( 31224),
+         INT16_C( 19526),  INT16_C( 22657),  INT16_C( 32691), -INT16_C( 25036), -INT16_C(  7559), -INT16_C( 31524), -INT16_C( 21717),  INT16_C( 23964),
+        -INT16_C( 21103),  INT16_C( 22897), -INT16_C(  1176), -INT16_C( 29607), -INT16_C(  1503), -INT16_C( 15498),  INT16_C( 32274),  INT16_C( 22858) },
+      { -INT16_C(  1212),  INT16_C( 26386),  INT16_C( 18699),  INT16_C(  6094), -INT16_C(  6606), -INT16_C( 17465),  INT16_C(   138),  INT16_C(  9508),
+        -INT16_C(  5471),  INT16_C(  6306),  INT16_C( 19526),  INT16_C( 22657),  INT16_C( 32691), -INT16_C(  7559), -INT16_C( 31524), -INT16_C( 21717),
+         INT16_C( 22897), -INT16_C(  1176), -INT16_C( 29607), -INT16_C(  1503), -INT16_C(  7401),  INT16_C(   547), -INT16_C( 31542), -INT16_C( 11523),
+         INT16_C(  4178), -INT16_C( 28517), -INT16_C(  5876), -INT16_C(  1512), -INT16_C(  7711),  INT16_C( 30633),  INT16_C( 26937), -INT16_C( 24421) } },
+    { { -INT16_C( 13366),  INT16_C( 32177), -INT16_C(  6582), -INT16_C( 15332), -INT16_C(  1848), -INT16_C(  3000), -INT16_C(  7005),  INT16_C( 13649),
+        -INT16_C( 15726), -INT16_C(  1394), -INT16_C(  6210), -INT16_C(  8313), -INT16_C(   542), -INT16_C(  2910), -INT16_C(  4996),  INT16_C( 17997),
+        -INT16_C(    72),  INT16_C(   708), -INT16_C(  7963), -INT16_C( 21050),  INT16_C(  4056),  INT16_C( 31905), -INT16_C(  3085), -INT16_C( 31311),
+         INT16_C( 16309),  INT16_C( 29568),  INT16_C(  1830),  INT16_C(  2130), -INT16_C(  2812), -INT16_C( 32515),  INT16_C( 19169), -INT16_C( 26169) },
+      UINT32_C( 782011209),
+      {  INT16_C( 25195),  INT16_C( 17372),  INT16_C( 32113),  INT16_C( 26047),  INT16_C( 28784),  INT16_C(  9962),  INT16_C( 27311), -INT16_C( 10599),
+        -INT16_C(  5007),  INT16_C( 30430), -INT16_C(  9247), -INT16_C( 15626), -INT16_C( 17114),  INT16_C( 28508), -INT16_C(  1976), -INT16_C( 19554),
+         INT16_C( 31322), -INT16_C( 13065), -INT16_C( 18697),  INT16_C( 26673),  INT16_C(  6951), -INT16_C( 10610),  INT16_C( 10118), -INT16_C(  2132),
+        -INT16_C( 29933), -INT16_C(  2963),  INT16_C( 25702), -INT16_C( 29513),  INT16_C(  4897),  INT16_C( 27388), -INT16_C( 26101),  INT16_C( 25885) },
+      {  INT16_C( 25195),  INT16_C( 26047),  INT16_C( 27311), -INT16_C(  5007),  INT16_C( 30430), -INT16_C( 15626), -INT16_C( 19554), -INT16_C( 18697),
+         INT16_C( 26673),  INT16_C(  6951), -INT16_C(  2132), -INT16_C(  2963),  INT16_C( 25702), -INT16_C( 29513),  INT16_C( 27388),  INT16_C( 17997),
+        -INT16_C(    72),  INT16_C(   708), -INT16_C(  7963), -INT16_C( 21050),  INT16_C(  4056),  INT16_C( 31905), -INT16_C(  3085), -INT16_C( 31311),
+         INT16_C( 16309),  INT16_C( 29568),  INT16_C(  1830),  INT16_C(  2130), -INT16_C(  2812), -INT16_C( 32515),  INT16_C( 19169), -INT16_C( 26169) } },
+    { {  INT16_C(  5140),  INT16_C(  2865),  INT16_C( 25291), -INT16_C(  3469),  INT16_C(   382),  INT16_C(  1224),  INT16_C( 29993),  INT16_C( 15611),
+         INT16_C( 26880),  INT16_C( 26161), -INT16_C(  5939), -INT16_C(  4365), -INT16_C(  4101),  INT16_C(  1624),  INT16_C( 30345), -INT16_C( 25237),
+        -INT16_C( 25206),  INT16_C( 21928),  INT16_C(  7423),  INT16_C( 32071),  INT16_C(  4125),  INT16_C( 18049),  INT16_C( 32133), -INT16_C( 31357),
+        -INT16_C( 19226), -INT16_C( 19477), -INT16_C(  8548), -INT16_C( 26719), -INT16_C(  1331),  INT16_C( 22173),  INT16_C(  2160), -INT16_C(  1293) },
+      UINT32_C(2773523621),
+      { -INT16_C( 26696), -INT16_C( 10974), -INT16_C( 23385),  INT16_C( 11292), -INT16_C( 24799),  INT16_C(  1969), -INT16_C( 25261), -INT16_C(  4166),
+         INT16_C( 23419),  INT16_C( 18822),  INT16_C(  9045), -INT16_C( 14945), -INT16_C( 27861), -INT16_C( 11840),  INT16_C(  4143), -INT16_C(  6282),
+        -INT16_C( 26457),  INT16_C( 20412), -INT16_C( 10180),  INT16_C( 23931),  INT16_C( 11639), -INT16_C( 13724),  INT16_C(  7882),  INT16_C( 17849),
+         INT16_C( 16250), -INT16_C( 12402),  INT16_C( 11874), -INT16_C( 29035),  INT16_C( 21953), -INT16_C(  4001), -INT16_C( 10907),  INT16_C(  3287) },
+      { -INT16_C( 26696), -INT16_C( 23385),  INT16_C(  1969), -INT16_C(  4166),  INT16_C(  9045), -INT16_C( 14945), -INT16_C( 27861), -INT16_C(  6282),
+         INT16_C( 11639),  INT16_C(  7882),  INT16_C( 16250),  INT16_C( 11874), -INT16_C(  4001),  INT16_C(  3287),  INT16_C( 30345), -INT16_C( 25237),
+        -INT16_C( 25206),  INT16_C( 21928),  INT16_C(  7423),  INT16_C( 32071),  INT16_C(  4125),  INT16_C( 18049),  INT16_C( 32133), -INT16_C( 31357),
+        -INT16_C( 19226), -INT16_C( 19477), -INT16_C(  8548), -INT16_C( 26719), -INT16_C(  1331),  INT16_C( 22173),  INT16_C(  2160), -INT16_C(  1293) } },
+    { { -INT16_C( 27795), -INT16_C( 21925), -INT16_C( 10388), -INT16_C(  7417),  INT16_C( 27652), -INT16_C( 12626),  INT16_C( 26506),  INT16_C(  1043),
+        -INT16_C( 23897),  INT16_C(  2516),  INT16_C( 27088), -INT16_C( 28265), -INT16_C(  2370),  INT16_C(  9089),  INT16_C( 22731),  INT16_C( 14639),
+        -INT16_C( 29717),  INT16_C( 22499), -INT16_C(  5534),  INT16_C( 26171), -INT16_C(  5802), -INT16_C(  7884),  INT16_C( 18256), -INT16_C(  2075),
+        -INT16_C( 17943), -INT16_C( 18175), -INT16_C( 26590), -INT16_C(  8118), -INT16_C( 13425),  INT16_C( 23043),  INT16_C( 13091),  INT16_C(  3987) },
+      UINT32_C( 543585982),
+      { -INT16_C( 24223), -INT16_C( 18554), -INT16_C( 17782), -INT16_C(  9320),  INT16_C( 32257), -INT16_C(  5166), -INT16_C( 11465),  INT16_C( 23204),
+        -INT16_C(  4244), -INT16_C(  1222),  INT16_C( 16058), -INT16_C(  8619), -INT16_C(  5775),  INT16_C( 12269),  INT16_C( 21343), -INT16_C( 16305),
+        -INT16_C( 10763),  INT16_C( 32632),  INT16_C(  4239), -INT16_C( 28582),  INT16_C( 11662), -INT16_C( 14725),  INT16_C(  8192),  INT16_C( 27680),
+         INT16_C( 23055), -INT16_C( 13977), -INT16_C( 17000),  INT16_C(  2471), -INT16_C( 27482),  INT16_C(  1336), -INT16_C( 30744), -INT16_C(  8762) },
+      { -INT16_C( 18554), -INT16_C( 17782), -INT16_C(  9320),  INT16_C( 32257), -INT16_C(  5166),  INT16_C( 23204), -INT16_C(  1222),  INT16_C( 16058),
+        -INT16_C(  5775),  INT16_C( 12269),  INT16_C( 21343),  INT16_C( 32632),  INT16_C(  4239), -INT16_C( 14725),  INT16_C(  8192),  INT16_C(  1336),
+        -INT16_C( 29717),  INT16_C( 22499), -INT16_C(  5534),  INT16_C( 26171), -INT16_C(  5802), -INT16_C(  7884),  INT16_C( 18256), -INT16_C(  2075),
+        -INT16_C( 17943), -INT16_C( 18175), -INT16_C( 26590), -INT16_C(  8118), -INT16_C( 13425),  INT16_C( 23043),  INT16_C( 13091),  INT16_C(  3987) } },
+    { {  INT16_C( 15964), -INT16_C(  5284), -INT16_C( 18610), -INT16_C(  8836), -INT16_C(  2076), -INT16_C(  7005), -INT16_C( 15593),  INT16_C(  9809),
+        -INT16_C( 18403), -INT16_C( 18704), -INT16_C( 26763),  INT16_C(  7103), -INT16_C(  2004),  INT16_C(  5153), -INT16_C(  6273), -INT16_C(  8975),
+         INT16_C( 19749),  INT16_C( 29639),  INT16_C( 17156), -INT16_C(  6064), -INT16_C(  3269),  INT16_C( 21197),  INT16_C(  7862), -INT16_C( 11143),
+         INT16_C( 27094),  INT16_C( 19594),  INT16_C( 18688),  INT16_C( 11367), -INT16_C( 30655), -INT16_C( 16064),  INT16_C( 12655), -INT16_C( 27491) },
+      UINT32_C(2198365311),
+      {  INT16_C( 22696), -INT16_C(  7316),  INT16_C( 14668),  INT16_C(   565), -INT16_C( 20905),  INT16_C( 11734),  INT16_C( 24599),  INT16_C(  6265),
+        -INT16_C(  7766), -INT16_C(  5308), -INT16_C( 31383), -INT16_C(  9812),  INT16_C( 18870),  INT16_C( 13677),  INT16_C( 30126),  INT16_C( 22201),
+         INT16_C(  9678),  INT16_C(  6713),  INT16_C( 28254), -INT16_C( 19172), -INT16_C(  3299),  INT16_C( 13538),  INT16_C( 23635), -INT16_C(   692),
+        -INT16_C( 28355), -INT16_C( 22807), -INT16_C( 27370), -INT16_C( 13185), -INT16_C(  4641), -INT16_C( 29438), -INT16_C( 17566),  INT16_C( 12515) },
+      {  INT16_C( 22696), -INT16_C(  7316),  INT16_C( 14668),  INT16_C(   565), -INT16_C( 20905),  INT16_C( 11734),  INT16_C( 24599), -INT16_C( 31383),
+         INT16_C( 13677),  INT16_C( 30126), -INT16_C( 19172), -INT16_C( 28355), -INT16_C( 22807),  INT16_C( 12515), -INT16_C(  6273), -INT16_C(  8975),
+         INT16_C( 19749),  INT16_C( 29639),  INT16_C( 17156), -INT16_C(  6064), -INT16_C(  3269),  INT16_C( 21197),  INT16_C(  7862), -INT16_C( 11143),
+         INT16_C( 27094),  INT16_C( 19594),  INT16_C( 18688),  INT16_C( 11367), -INT16_C( 30655), -INT16_C( 16064),  INT16_C( 12655), -INT16_C( 27491) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi16(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    simde__m512i r = simde_mm512_mask_compress_epi16(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x32(r, simde_mm512_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m512i src = simde_test_x86_random_i16x32();
+    simde__mmask32 k = simde_test_x86_random_mmask32();
+    simde__m512i a = simde_test_x86_random_i16x32();
+    simde__m512i r = simde_mm512_mask_compress_epi16(src, k, a);
+
+    simde_test_x86_write_i16x32(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask32(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i16x32(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i16x32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_maskz_compress_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask32 k;
+    const int16_t a[32];
+    const int16_t r[32];
+  } test_vec[] = {
+    { UINT32_C(1045044448),
+      {  INT16_C( 26506), -INT16_C( 22541), -INT16_C( 10918), -INT16_C( 21028),  INT16_C( 10289),  INT16_C( 28331), -INT16_C( 27463), -INT16_C( 12523),
+        -INT16_C( 27607),  INT16_C(  2204), -INT16_C( 24959), -INT16_C(  7019),  INT16_C( 30809),  INT16_C( 14612),  INT16_C( 24468),  INT16_C(  8055),
+         INT16_C( 27334),  INT16_C(  8390), -INT16_C( 24001),  INT16_C( 29133),  INT16_C( 30923), -INT16_C( 31521), -INT16_C(  3060),  INT16_C( 13908),
+        -INT16_C(  3959),  INT16_C(  2622), -INT16_C( 11122), -INT16_C(  6162),  INT16_C(   844), -INT16_C(  7904), -INT16_C( 26782),  INT16_C( 10240) },
+      {  INT16_C( 28331), -INT16_C( 27463), -INT16_C( 12523), -INT16_C( 24959), -INT16_C(  7019),  INT16_C( 30809),  INT16_C(  8390),  INT16_C( 29133),
+        -INT16_C(  3060),  INT16_C(  2622), -INT16_C( 11122), -INT16_C(  6162),  INT16_C(   844), -INT16_C(  7904),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C(1078511105),
+      {  INT16_C(  5481),  INT16_C( 13489), -INT16_C( 28274), -INT16_C( 25928),  INT16_C(  3205),  INT16_C(  3792),  INT16_C(  4092), -INT16_C( 30183),
+         INT16_C(  2019),  INT16_C( 12145), -INT16_C( 28406),  INT16_C( 27664),  INT16_C(  4136),  INT16_C( 10644), -INT16_C(  9001),  INT16_C( 16490),
+         INT16_C(  7154), -INT16_C( 32652),  INT16_C( 11436),  INT16_C( 12826), -INT16_C(  5319),  INT16_C( 13632),  INT16_C( 23034), -INT16_C(  8768),
+         INT16_C( 12641),  INT16_C( 27404),  INT16_C(  7619), -INT16_C(  5160),  INT16_C( 27693),  INT16_C(  1045),  INT16_C( 32585),  INT16_C( 15172) },
+      {  INT16_C(  5481),  INT16_C( 12145), -INT16_C( 28406), -INT16_C(  9001),  INT16_C( 16490),  INT16_C( 12826),  INT16_C( 23034),  INT16_C( 32585),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C(1203484826),
+      { -INT16_C( 10779),  INT16_C(  7801), -INT16_C( 17984), -INT16_C( 17837),  INT16_C(  4883),  INT16_C( 29847), -INT16_C( 23483),  INT16_C(  2271),
+        -INT16_C( 18495), -INT16_C(  4365),  INT16_C(  2084),  INT16_C( 28147),  INT16_C( 14215),  INT16_C(  8872),  INT16_C( 25584), -INT16_C( 10903),
+        -INT16_C(  7624), -INT16_C(  1549),  INT16_C( 18075), -INT16_C( 20813),  INT16_C( 19290), -INT16_C( 24798),  INT16_C(   751), -INT16_C( 20313),
+        -INT16_C( 25927), -INT16_C(  8802), -INT16_C( 28253),  INT16_C( 10826), -INT16_C(  3383), -INT16_C( 18100), -INT16_C( 19115), -INT16_C( 29042) },
+      {  INT16_C(  7801), -INT16_C( 17837),  INT16_C(  4883),  INT16_C(  2271),  INT16_C( 28147),  INT16_C( 14215),  INT16_C(  8872), -INT16_C( 10903),
+        -INT16_C(  7624), -INT16_C(  1549), -INT16_C( 20813),  INT16_C( 19290), -INT16_C( 24798), -INT16_C( 20313), -INT16_C( 25927), -INT16_C(  8802),
+        -INT16_C( 28253), -INT16_C( 19115),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C( 864518551),
+      {  INT16_C( 15047),  INT16_C(  8673),  INT16_C(  1157),  INT16_C( 29888),  INT16_C( 26374), -INT16_C( 16604), -INT16_C( 15614), -INT16_C( 23139),
+        -INT16_C(  6316),  INT16_C(  7631),  INT16_C(  7386),  INT16_C( 12246),  INT16_C( 25809),  INT16_C( 27069),  INT16_C( 17637), -INT16_C( 21092),
+         INT16_C( 32127),  INT16_C(  1230), -INT16_C( 28799), -INT16_C( 30855), -INT16_C( 25098), -INT16_C(  1977), -INT16_C(  7072), -INT16_C( 19043),
+         INT16_C( 28107), -INT16_C( 23086), -INT16_C( 22135),  INT16_C( 23253), -INT16_C( 28147), -INT16_C(  3133),  INT16_C( 24535),  INT16_C( 22176) },
+      {  INT16_C( 15047),  INT16_C(  8673),  INT16_C(  1157),  INT16_C( 26374), -INT16_C( 23139), -INT16_C(  6316), -INT16_C( 21092),  INT16_C( 32127),
+         INT16_C(  1230), -INT16_C( 28799), -INT16_C( 19043),  INT16_C( 28107), -INT16_C( 23086), -INT16_C( 28147), -INT16_C(  3133),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C(1582984925),
+      { -INT16_C( 11267), -INT16_C(  2842),  INT16_C( 11633), -INT16_C( 11796), -INT16_C( 30191), -INT16_C(  9082),  INT16_C( 23031), -INT16_C( 32638),
+         INT16_C( 22274),  INT16_C(  4058), -INT16_C( 24855), -INT16_C( 16382), -INT16_C( 23811), -INT16_C(  9706),  INT16_C( 28945),  INT16_C(  3641),
+         INT16_C(  8004), -INT16_C( 19198), -INT16_C(  4276),  INT16_C( 23943),  INT16_C(  3449),  INT16_C( 28729), -INT16_C( 17562),  INT16_C( 26864),
+        -INT16_C( 13806), -INT16_C(   904),  INT16_C( 31336),  INT16_C( 26300), -INT16_C( 11491),  INT16_C( 11840),  INT16_C( 31044), -INT16_C( 30660) },
+      { -INT16_C( 11267),  INT16_C( 11633), -INT16_C( 11796), -INT16_C( 30191),  INT16_C( 23031), -INT16_C( 32638),  INT16_C(  4058), -INT16_C( 24855),
+        -INT16_C( 16382), -INT16_C(  9706),  INT16_C( 28945), -INT16_C( 19198),  INT16_C( 23943),  INT16_C(  3449), -INT16_C( 17562), -INT16_C(   904),
+         INT16_C( 31336),  INT16_C( 26300), -INT16_C( 11491),  INT16_C( 31044),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C(3829284760),
+      { -INT16_C( 15058), -INT16_C( 22719),  INT16_C( 31698),  INT16_C( 14615),  INT16_C(  1846),  INT16_C( 18849),  INT16_C(  6609),  INT16_C( 14917),
+         INT16_C(   404), -INT16_C( 20064), -INT16_C(  7980),  INT16_C(  6367),  INT16_C(  7002), -INT16_C(  3423), -INT16_C(  8358), -INT16_C( 30505),
+         INT16_C(  6308),  INT16_C( 30255),  INT16_C( 18067), -INT16_C( 13649),  INT16_C( 20813),  INT16_C(  7955),  INT16_C( 22634), -INT16_C(   423),
+        -INT16_C(  1703),  INT16_C( 11951), -INT16_C( 28967),  INT16_C( 13126), -INT16_C(  6230),  INT16_C(  1062), -INT16_C(   570),  INT16_C( 27277) },
+      {  INT16_C( 14615),  INT16_C(  1846),  INT16_C( 14917),  INT16_C(   404), -INT16_C( 20064), -INT16_C(  7980),  INT16_C(  6367),  INT16_C(  7002),
+        -INT16_C(  3423),  INT16_C( 30255),  INT16_C( 18067), -INT16_C( 13649),  INT16_C( 20813),  INT16_C(  7955), -INT16_C( 28967),  INT16_C(  1062),
+        -INT16_C(   570),  INT16_C( 27277),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C(2850143253),
+      { -INT16_C( 28669),  INT16_C( 20595), -INT16_C( 31007),  INT16_C( 19567), -INT16_C( 14114),  INT16_C( 14154), -INT16_C(  1343), -INT16_C( 25755),
+        -INT16_C( 21368),  INT16_C( 13006), -INT16_C(  2925),  INT16_C( 23095), -INT16_C( 15119),  INT16_C(  1988), -INT16_C( 23168), -INT16_C( 31824),
+         INT16_C(  9014),  INT16_C(  6100),  INT16_C( 17321), -INT16_C( 30877), -INT16_C( 20980), -INT16_C( 12866),  INT16_C(  9384),  INT16_C( 12392),
+         INT16_C( 14288),  INT16_C( 25443), -INT16_C( 26069),  INT16_C(  7613), -INT16_C( 32162), -INT16_C(  8668), -INT16_C( 11225),  INT16_C( 23906) },
+      { -INT16_C( 28669), -INT16_C( 31007), -INT16_C( 14114), -INT16_C(  2925),  INT16_C( 23095), -INT16_C( 15119),  INT16_C(  1988), -INT16_C( 31824),
+         INT16_C(  9014), -INT16_C( 12866),  INT16_C(  9384),  INT16_C( 12392),  INT16_C( 14288),  INT16_C(  7613), -INT16_C(  8668),  INT16_C( 23906),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C(2692036343),
+      { -INT16_C( 10119), -INT16_C( 31449), -INT16_C(  6778),  INT16_C( 11859), -INT16_C( 17655), -INT16_C(  9889), -INT16_C( 15630),  INT16_C(  7741),
+        -INT16_C(  1444), -INT16_C( 17861),  INT16_C( 24444), -INT16_C( 23400), -INT16_C(  1485),  INT16_C( 10753),  INT16_C( 30256), -INT16_C( 21814),
+        -INT16_C(  3761), -INT16_C( 10961), -INT16_C( 32042), -INT16_C(  8188),  INT16_C( 25406),  INT16_C( 12473), -INT16_C(  2523), -INT16_C( 32434),
+        -INT16_C( 30223),  INT16_C( 27963), -INT16_C( 11288),  INT16_C(  6929),  INT16_C(  5070), -INT16_C(   443),  INT16_C(  3977), -INT16_C( 10072) },
+      { -INT16_C( 10119), -INT16_C( 31449), -INT16_C(  6778), -INT16_C( 17655), -INT16_C(  9889), -INT16_C( 15630),  INT16_C(  7741), -INT16_C( 17861),
+         INT16_C( 24444), -INT16_C(  1485),  INT16_C( 10753), -INT16_C(  3761), -INT16_C( 32042),  INT16_C( 25406),  INT16_C( 12473), -INT16_C(  2523),
+        -INT16_C(   443), -INT16_C( 10072),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    simde__m512i r = simde_mm512_maskz_compress_epi16(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x32(r, simde_mm512_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask32 k = simde_test_x86_random_mmask32();
+    simde__m512i a = simde_test_x86_random_i16x32();
+    simde__m512i r = simde_mm512_maskz_compress_epi16(k, a);
+
+    simde_test_x86_write_mmask32(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i16x32(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i16x32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
 SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_compress_pd)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_compressstoreu_pd)
@@ -1984,6 +4134,23 @@ SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_compress_epi64)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_compressstoreu_epi64)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_compress_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_compress_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_compress_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_compressstoreu_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_compress_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_compress_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_compressstoreu_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_compress_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_compress_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_compressstoreu_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_compress_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_compress_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_compressstoreu_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_compress_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_compress_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_compressstoreu_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_compress_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_compress_epi16)
 SIMDE_TEST_FUNC_LIST_END
 
 #include <test/x86/avx512/test-avx512-footer.h>
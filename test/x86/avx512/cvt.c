@@ -1345,6 +1345,2382 @@ test_simde_mm512_cvtps_epi32 (SIMDE_MUNIT_TEST_ARGS) {
 #endif
 }
 
+static int
+test_simde_mm_cvtne2ps_pbh (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde_float32 a[4];
+    const simde_float32 b[4];
+    const uint16_t r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT32_C(1.01171875),            SIMDE_MATH_NANF,  SIMDE_FLOAT32_C(-1.0e-39), SIMDE_FLOAT32_C(1.00390625) },
+      { SIMDE_FLOAT32_C(1.00390625), SIMDE_FLOAT32_C(1.01171875),            SIMDE_MATH_NANF,  SIMDE_FLOAT32_C(-1.0e-39) },
+      { UINT16_C(16256), UINT16_C(16258), UINT16_C(32704), UINT16_C(32768), UINT16_C(16258), UINT16_C(32704), UINT16_C(32768), UINT16_C(16256) } },
+    #endif
+    { { SIMDE_FLOAT32_C(  -553.47), SIMDE_FLOAT32_C(   802.93), SIMDE_FLOAT32_C(  -283.93), SIMDE_FLOAT32_C(  -479.20) },
+      { SIMDE_FLOAT32_C(   608.56), SIMDE_FLOAT32_C(   263.33), SIMDE_FLOAT32_C(  -700.59), SIMDE_FLOAT32_C(   102.67) },
+      { UINT16_C(17432), UINT16_C(17284), UINT16_C(50223), UINT16_C(17101), UINT16_C(50186), UINT16_C(17481), UINT16_C(50062), UINT16_C(50160) } },
+    { { SIMDE_FLOAT32_C(  -591.16), SIMDE_FLOAT32_C(   956.00), SIMDE_FLOAT32_C(  -192.65), SIMDE_FLOAT32_C(   980.87) },
+      { SIMDE_FLOAT32_C(  -122.70), SIMDE_FLOAT32_C(   215.06), SIMDE_FLOAT32_C(   745.19), SIMDE_FLOAT32_C(   373.77) },
+      { UINT16_C(49909), UINT16_C(17239), UINT16_C(17466), UINT16_C(17339), UINT16_C(50196), UINT16_C(17519), UINT16_C(49985), UINT16_C(17525) } },
+    { { SIMDE_FLOAT32_C(   -30.52), SIMDE_FLOAT32_C(  -437.35), SIMDE_FLOAT32_C(  -490.76), SIMDE_FLOAT32_C(  -757.63) },
+      { SIMDE_FLOAT32_C(   998.46), SIMDE_FLOAT32_C(  -442.74), SIMDE_FLOAT32_C(  -763.44), SIMDE_FLOAT32_C(  -676.57) },
+      { UINT16_C(17530), UINT16_C(50141), UINT16_C(50239), UINT16_C(50217), UINT16_C(49652), UINT16_C(50139), UINT16_C(50165), UINT16_C(50237) } },
+    { { SIMDE_FLOAT32_C(   -30.26), SIMDE_FLOAT32_C(  -125.91), SIMDE_FLOAT32_C(   190.89), SIMDE_FLOAT32_C(  -810.29) },
+      { SIMDE_FLOAT32_C(   -50.96), SIMDE_FLOAT32_C(  -527.47), SIMDE_FLOAT32_C(   730.91), SIMDE_FLOAT32_C(   878.04) },
+      { UINT16_C(49740), UINT16_C(50180), UINT16_C(17463), UINT16_C(17500), UINT16_C(49650), UINT16_C(49916), UINT16_C(17215), UINT16_C(50251) } },
+    { { SIMDE_FLOAT32_C(  -305.02), SIMDE_FLOAT32_C(   138.80), SIMDE_FLOAT32_C(   878.27), SIMDE_FLOAT32_C(  -472.92) },
+      { SIMDE_FLOAT32_C(  -395.43), SIMDE_FLOAT32_C(  -622.58), SIMDE_FLOAT32_C(   256.84), SIMDE_FLOAT32_C(   -61.48) },
+      { UINT16_C(50118), UINT16_C(50204), UINT16_C(17280), UINT16_C(49782), UINT16_C(50073), UINT16_C(17163), UINT16_C(17500), UINT16_C(50156) } },
+    { { SIMDE_FLOAT32_C(   172.09), SIMDE_FLOAT32_C(  -434.83), SIMDE_FLOAT32_C(   872.26), SIMDE_FLOAT32_C(  -283.45) },
+      { SIMDE_FLOAT32_C(  -496.93), SIMDE_FLOAT32_C(  -929.72), SIMDE_FLOAT32_C(  -707.60), SIMDE_FLOAT32_C(  -601.92) },
+      { UINT16_C(50168), UINT16_C(50280), UINT16_C(50225), UINT16_C(50198), UINT16_C(17196), UINT16_C(50137), UINT16_C(17498), UINT16_C(50062) } },
+    { { SIMDE_FLOAT32_C(  -936.94), SIMDE_FLOAT32_C(   843.27), SIMDE_FLOAT32_C(   482.52), SIMDE_FLOAT32_C(   574.27) },
+      { SIMDE_FLOAT32_C(  -683.51), SIMDE_FLOAT32_C(   289.17), SIMDE_FLOAT32_C(  -605.34), SIMDE_FLOAT32_C(   -19.52) },
+      { UINT16_C(50219), UINT16_C(17297), UINT16_C(50199), UINT16_C(49564), UINT16_C(50282), UINT16_C(17491), UINT16_C(17393), UINT16_C(17424) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 b = simde_mm_loadu_ps(test_vec[i].b);
+    simde__m128bh r = simde_mm_cvtne2ps_pbh(a, b);
+    simde_test_x86_assert_equal_u16x8(simde_x_mm_castpbh_si128(r), simde_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m128 a = simde_test_x86_random_f32x4(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__m128 b = simde_test_x86_random_f32x4(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__m128bh r = simde_mm_cvtne2ps_pbh(a, b);
+
+    simde_test_x86_write_f32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u16x8(2, simde_x_mm_castpbh_si128(r), SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_cvtne2ps_pbh (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde_float32 a[8];
+    const simde_float32 b[8];
+    const uint16_t r[16];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { {            SIMDE_MATH_NANF,    SIMDE_FLOAT32_C(3.4e38),      -SIMDE_MATH_INFINITYF,       SIMDE_MATH_INFINITYF,
+        SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(1.00390625),  SIMDE_FLOAT32_C(-1.0e-39), SIMDE_FLOAT32_C(1.01171875) },
+      { SIMDE_FLOAT32_C(1.00390625),       SIMDE_MATH_INFINITYF,    SIMDE_FLOAT32_C(3.4e38), SIMDE_FLOAT32_C(1.01171875),
+             -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    -0.00),  SIMDE_FLOAT32_C(-1.0e-39),            SIMDE_MATH_NANF },
+      { UINT16_C(16256), UINT16_C(32640), UINT16_C(32640), UINT16_C(16258), UINT16_C(65408), UINT16_C(32768), UINT16_C(32768), UINT16_C(32704),
+        UINT16_C(32704), UINT16_C(32640), UINT16_C(65408), UINT16_C(32640), UINT16_C(32768), UINT16_C(16256), UINT16_C(32768), UINT16_C(16258) } },
+    #endif
+    { { SIMDE_FLOAT32_C(   155.77), SIMDE_FLOAT32_C(   -63.22), SIMDE_FLOAT32_C(   918.43), SIMDE_FLOAT32_C(  -354.54),
+        SIMDE_FLOAT32_C(  -846.57), SIMDE_FLOAT32_C(  -269.03), SIMDE_FLOAT32_C(   989.26), SIMDE_FLOAT32_C(   283.30) },
+      { SIMDE_FLOAT32_C(   295.89), SIMDE_FLOAT32_C(   646.33), SIMDE_FLOAT32_C(   841.10), SIMDE_FLOAT32_C(  -862.80),
+        SIMDE_FLOAT32_C(   679.27), SIMDE_FLOAT32_C(  -769.61), SIMDE_FLOAT32_C(  -897.07), SIMDE_FLOAT32_C(   290.79) },
+      { UINT16_C(17300), UINT16_C(17442), UINT16_C(17490), UINT16_C(50264), UINT16_C(17450), UINT16_C(50240), UINT16_C(50272), UINT16_C(17297),
+        UINT16_C(17180), UINT16_C(49789), UINT16_C(17510), UINT16_C(50097), UINT16_C(50260), UINT16_C(50055), UINT16_C(17527), UINT16_C(17294) } },
+    { { SIMDE_FLOAT32_C(  -436.23), SIMDE_FLOAT32_C(   186.72), SIMDE_FLOAT32_C(    16.18), SIMDE_FLOAT32_C(    96.80),
+        SIMDE_FLOAT32_C(   592.82), SIMDE_FLOAT32_C(   449.78), SIMDE_FLOAT32_C(  -984.51), SIMDE_FLOAT32_C(  -283.44) },
+      { SIMDE_FLOAT32_C(  -776.82), SIMDE_FLOAT32_C(  -753.15), SIMDE_FLOAT32_C(  -234.95), SIMDE_FLOAT32_C(  -413.25),
+        SIMDE_FLOAT32_C(   449.04), SIMDE_FLOAT32_C(  -333.08), SIMDE_FLOAT32_C(  -495.33), SIMDE_FLOAT32_C(  -436.01) },
+      { UINT16_C(50242), UINT16_C(50236), UINT16_C(50027), UINT16_C(50127), UINT16_C(17377), UINT16_C(50087), UINT16_C(50168), UINT16_C(50138),
+        UINT16_C(50138), UINT16_C(17211), UINT16_C(16769), UINT16_C(17090), UINT16_C(17428), UINT16_C(17377), UINT16_C(50294), UINT16_C(50062) } },
+    { { SIMDE_FLOAT32_C(   628.05), SIMDE_FLOAT32_C(   948.07), SIMDE_FLOAT32_C(   520.40), SIMDE_FLOAT32_C(   655.40),
+        SIMDE_FLOAT32_C(  -609.73), SIMDE_FLOAT32_C(   699.71), SIMDE_FLOAT32_C(  -850.05), SIMDE_FLOAT32_C(   582.72) },
+      { SIMDE_FLOAT32_C(   -93.20), SIMDE_FLOAT32_C(   323.84), SIMDE_FLOAT32_C(  -899.50), SIMDE_FLOAT32_C(  -620.61),
+        SIMDE_FLOAT32_C(   624.15), SIMDE_FLOAT32_C(   207.59), SIMDE_FLOAT32_C(  -433.89), SIMDE_FLOAT32_C(   989.34) },
+      { UINT16_C(49850), UINT16_C(17314), UINT16_C(50273), UINT16_C(50203), UINT16_C(17436), UINT16_C(17232), UINT16_C(50137), UINT16_C(17527),
+        UINT16_C(17437), UINT16_C(17517), UINT16_C(17410), UINT16_C(17444), UINT16_C(50200), UINT16_C(17455), UINT16_C(50261), UINT16_C(17426) } },
+    { { SIMDE_FLOAT32_C(  -900.37), SIMDE_FLOAT32_C(   219.47), SIMDE_FLOAT32_C(   -78.14), SIMDE_FLOAT32_C(   803.89),
+        SIMDE_FLOAT32_C(   639.70), SIMDE_FLOAT32_C(   -49.10), SIMDE_FLOAT32_C(  -390.21), SIMDE_FLOAT32_C(  -904.66) },
+      { SIMDE_FLOAT32_C(  -888.74), SIMDE_FLOAT32_C(  -939.04), SIMDE_FLOAT32_C(  -386.53), SIMDE_FLOAT32_C(  -269.98),
+        SIMDE_FLOAT32_C(  -408.34), SIMDE_FLOAT32_C(   341.63), SIMDE_FLOAT32_C(   478.54), SIMDE_FLOAT32_C(  -737.22) },
+      { UINT16_C(50270), UINT16_C(50283), UINT16_C(50113), UINT16_C(50055), UINT16_C(50124), UINT16_C(17323), UINT16_C(17391), UINT16_C(50232),
+        UINT16_C(50273), UINT16_C(17243), UINT16_C(49820), UINT16_C(17481), UINT16_C(17440), UINT16_C(49732), UINT16_C(50115), UINT16_C(50274) } },
+    { { SIMDE_FLOAT32_C(  -919.70), SIMDE_FLOAT32_C(   741.58), SIMDE_FLOAT32_C(  -455.31), SIMDE_FLOAT32_C(  -398.94),
+        SIMDE_FLOAT32_C(   615.24), SIMDE_FLOAT32_C(  -601.00), SIMDE_FLOAT32_C(    24.34), SIMDE_FLOAT32_C(   477.70) },
+      { SIMDE_FLOAT32_C(   864.89), SIMDE_FLOAT32_C(  -437.41), SIMDE_FLOAT32_C(  -116.68), SIMDE_FLOAT32_C(  -228.06),
+        SIMDE_FLOAT32_C(  -774.40), SIMDE_FLOAT32_C(   977.65), SIMDE_FLOAT32_C(   207.45), SIMDE_FLOAT32_C(   620.69) },
+      { UINT16_C(17496), UINT16_C(50139), UINT16_C(49897), UINT16_C(50020), UINT16_C(50242), UINT16_C(17524), UINT16_C(17231), UINT16_C(17435),
+        UINT16_C(50278), UINT16_C(17465), UINT16_C(50148), UINT16_C(50119), UINT16_C(17434), UINT16_C(50198), UINT16_C(16835), UINT16_C(17391) } },
+    { { SIMDE_FLOAT32_C(   110.61), SIMDE_FLOAT32_C(  -366.06), SIMDE_FLOAT32_C(    22.87), SIMDE_FLOAT32_C(   286.26),
+        SIMDE_FLOAT32_C(   775.88), SIMDE_FLOAT32_C(   756.90), SIMDE_FLOAT32_C(  -755.96), SIMDE_FLOAT32_C(    10.65) },
+      { SIMDE_FLOAT32_C(   696.00), SIMDE_FLOAT32_C(  -669.44), SIMDE_FLOAT32_C(   -32.17), SIMDE_FLOAT32_C(   435.55),
+        SIMDE_FLOAT32_C(  -802.43), SIMDE_FLOAT32_C(  -291.04), SIMDE_FLOAT32_C(    71.41), SIMDE_FLOAT32_C(  -363.91) },
+      { UINT16_C(17454), UINT16_C(50215), UINT16_C(49665), UINT16_C(17370), UINT16_C(50249), UINT16_C(50066), UINT16_C(17039), UINT16_C(50102),
+        UINT16_C(17117), UINT16_C(50103), UINT16_C(16823), UINT16_C(17295), UINT16_C(17474), UINT16_C(17469), UINT16_C(50237), UINT16_C(16682) } },
+    { { SIMDE_FLOAT32_C(  -693.68), SIMDE_FLOAT32_C(   886.53), SIMDE_FLOAT32_C(    83.22), SIMDE_FLOAT32_C(   393.20),
+        SIMDE_FLOAT32_C(  -398.11), SIMDE_FLOAT32_C(  -511.75), SIMDE_FLOAT32_C(  -406.63), SIMDE_FLOAT32_C(  -660.03) },
+      { SIMDE_FLOAT32_C(   921.30), SIMDE_FLOAT32_C(  -761.25), SIMDE_FLOAT32_C(  -514.60), SIMDE_FLOAT32_C(   267.01),
+        SIMDE_FLOAT32_C(  -590.80), SIMDE_FLOAT32_C(  -572.65), SIMDE_FLOAT32_C(  -494.05), SIMDE_FLOAT32_C(  -531.79) },
+      { UINT16_C(17510), UINT16_C(50238), UINT16_C(50177), UINT16_C(17286), UINT16_C(50196), UINT16_C(50191), UINT16_C(50167), UINT16_C(50181),
+        UINT16_C(50221), UINT16_C(17502), UINT16_C(17062), UINT16_C(17349), UINT16_C(50119), UINT16_C(50176), UINT16_C(50123), UINT16_C(50213) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde__m256 b = simde_mm256_loadu_ps(test_vec[i].b);
+    simde__m256bh r = simde_mm256_cvtne2ps_pbh(a, b);
+    simde_test_x86_assert_equal_u16x16(simde_x_mm256_castpbh_si256(r), simde_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m256 a = simde_test_x86_random_f32x8(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__m256 b = simde_test_x86_random_f32x8(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__m256bh r = simde_mm256_cvtne2ps_pbh(a, b);
+
+    simde_test_x86_write_f32x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x8(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u16x16(2, simde_x_mm256_castpbh_si256(r), SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_cvtne2ps_pbh (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde_float32 a[16];
+    const simde_float32 b[16];
+    const uint16_t r[32];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(1.00390625),       SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(1.01171875),
+        SIMDE_FLOAT32_C(1.01171875),    SIMDE_FLOAT32_C(3.4e38),      -SIMDE_MATH_INFINITYF,      -SIMDE_MATH_INFINITYF,
+         SIMDE_FLOAT32_C(-1.0e-39),  SIMDE_FLOAT32_C(-1.0e-39), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(1.00390625),
+                   SIMDE_MATH_NANF,            SIMDE_MATH_NANF,       SIMDE_MATH_INFINITYF,    SIMDE_FLOAT32_C(3.4e38) },
+      { SIMDE_FLOAT32_C(1.01171875),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(1.01171875),
+              SIMDE_MATH_INFINITYF,      -SIMDE_MATH_INFINITYF,  SIMDE_FLOAT32_C(-1.0e-39),       SIMDE_MATH_INFINITYF,
+             -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(1.00390625),    SIMDE_FLOAT32_C(3.4e38), SIMDE_FLOAT32_C(1.00390625),
+           SIMDE_FLOAT32_C(3.4e38),  SIMDE_FLOAT32_C(-1.0e-39), SIMDE_FLOAT32_C(    -0.00),            SIMDE_MATH_NANF },
+      { UINT16_C(16258), UINT16_C(32704), UINT16_C(32768), UINT16_C(16258), UINT16_C(32640), UINT16_C(65408), UINT16_C(32768), UINT16_C(32640),
+        UINT16_C(65408), UINT16_C(16256), UINT16_C(32640), UINT16_C(16256), UINT16_C(32640), UINT16_C(32768), UINT16_C(32768), UINT16_C(32704),
+        UINT16_C(32768), UINT16_C(16256), UINT16_C(32640), UINT16_C(16258), UINT16_C(16258), UINT16_C(32640), UINT16_C(65408), UINT16_C(65408),
+        UINT16_C(32768), UINT16_C(32768), UINT16_C(32768), UINT16_C(16256), UINT16_C(32704), UINT16_C(32704), UINT16_C(32640), UINT16_C(32640) } },
+    #endif
+    { { SIMDE_FLOAT32_C(  -756.25), SIMDE_FLOAT32_C(   630.80), SIMDE_FLOAT32_C(   856.31), SIMDE_FLOAT32_C(   298.23),
+        SIMDE_FLOAT32_C(   -26.53), SIMDE_FLOAT32_C(  -889.81), SIMDE_FLOAT32_C(   -58.07), SIMDE_FLOAT32_C(  -954.81),
+        SIMDE_FLOAT32_C(  -723.31), SIMDE_FLOAT32_C(   281.60), SIMDE_FLOAT32_C(   517.71), SIMDE_FLOAT32_C(  -650.69),
+        SIMDE_FLOAT32_C(  -599.44), SIMDE_FLOAT32_C(   383.65), SIMDE_FLOAT32_C(  -230.20), SIMDE_FLOAT32_C(  -579.43) },
+      { SIMDE_FLOAT32_C(  -744.16), SIMDE_FLOAT32_C(   669.58), SIMDE_FLOAT32_C(  -343.81), SIMDE_FLOAT32_C(  -871.87),
+        SIMDE_FLOAT32_C(   933.38), SIMDE_FLOAT32_C(   845.72), SIMDE_FLOAT32_C(  -963.23), SIMDE_FLOAT32_C(   453.07),
+        SIMDE_FLOAT32_C(   114.83), SIMDE_FLOAT32_C(   542.50), SIMDE_FLOAT32_C(   515.31), SIMDE_FLOAT32_C(   122.09),
+        SIMDE_FLOAT32_C(  -702.86), SIMDE_FLOAT32_C(  -897.13), SIMDE_FLOAT32_C(  -331.30), SIMDE_FLOAT32_C(   214.29) },
+      { UINT16_C(50234), UINT16_C(17447), UINT16_C(50092), UINT16_C(50266), UINT16_C(17513), UINT16_C(17491), UINT16_C(50289), UINT16_C(17379),
+        UINT16_C(17126), UINT16_C(17416), UINT16_C(17409), UINT16_C(17140), UINT16_C(50224), UINT16_C(50272), UINT16_C(50086), UINT16_C(17238),
+        UINT16_C(50237), UINT16_C(17438), UINT16_C(17494), UINT16_C(17301), UINT16_C(49620), UINT16_C(50270), UINT16_C(49768), UINT16_C(50287),
+        UINT16_C(50229), UINT16_C(17293), UINT16_C(17409), UINT16_C(50211), UINT16_C(50198), UINT16_C(17344), UINT16_C(50022), UINT16_C(50193) } },
+    { { SIMDE_FLOAT32_C(  -917.95), SIMDE_FLOAT32_C(   347.26), SIMDE_FLOAT32_C(  -330.36), SIMDE_FLOAT32_C(  -638.80),
+        SIMDE_FLOAT32_C(   585.55), SIMDE_FLOAT32_C(    51.77), SIMDE_FLOAT32_C(  -367.62), SIMDE_FLOAT32_C(   845.93),
+        SIMDE_FLOAT32_C(   875.36), SIMDE_FLOAT32_C(  -149.91), SIMDE_FLOAT32_C(    93.62), SIMDE_FLOAT32_C(  -999.57),
+        SIMDE_FLOAT32_C(  -286.70), SIMDE_FLOAT32_C(   975.18), SIMDE_FLOAT32_C(    20.61), SIMDE_FLOAT32_C(   987.59) },
+      { SIMDE_FLOAT32_C(  -942.48), SIMDE_FLOAT32_C(  -965.48), SIMDE_FLOAT32_C(  -876.87), SIMDE_FLOAT32_C(  -849.39),
+        SIMDE_FLOAT32_C(   510.16), SIMDE_FLOAT32_C(   976.30), SIMDE_FLOAT32_C(   522.61), SIMDE_FLOAT32_C(   210.00),
+        SIMDE_FLOAT32_C(  -237.44), SIMDE_FLOAT32_C(  -236.39), SIMDE_FLOAT32_C(  -739.04), SIMDE_FLOAT32_C(  -205.88),
+        SIMDE_FLOAT32_C(  -756.67), SIMDE_FLOAT32_C(   619.56), SIMDE_FLOAT32_C(    76.65), SIMDE_FLOAT32_C(  -244.85) },
+      { UINT16_C(50284), UINT16_C(50289), UINT16_C(50267), UINT16_C(50260), UINT16_C(17407), UINT16_C(17524), UINT16_C(17411), UINT16_C(17234),
+        UINT16_C(50029), UINT16_C(50028), UINT16_C(50233), UINT16_C(49998), UINT16_C(50237), UINT16_C(17435), UINT16_C(17049), UINT16_C(50037),
+        UINT16_C(50277), UINT16_C(17326), UINT16_C(50085), UINT16_C(50208), UINT16_C(17426), UINT16_C(16975), UINT16_C(50104), UINT16_C(17491),
+        UINT16_C(17499), UINT16_C(49942), UINT16_C(17083), UINT16_C(50298), UINT16_C(50063), UINT16_C(17524), UINT16_C(16805), UINT16_C(17527) } },
+    { { SIMDE_FLOAT32_C(   893.65), SIMDE_FLOAT32_C(   839.35), SIMDE_FLOAT32_C(  -316.25), SIMDE_FLOAT32_C(   916.00),
+        SIMDE_FLOAT32_C(   849.07), SIMDE_FLOAT32_C(  -386.09), SIMDE_FLOAT32_C(   346.21), SIMDE_FLOAT32_C(  -823.15),
+        SIMDE_FLOAT32_C(  -102.06), SIMDE_FLOAT32_C(   922.38), SIMDE_FLOAT32_C(  -456.40), SIMDE_FLOAT32_C(  -400.85),
+        SIMDE_FLOAT32_C(   880.45), SIMDE_FLOAT32_C(  -237.95), SIMDE_FLOAT32_C(   720.69), SIMDE_FLOAT32_C(   430.32) },
+      { SIMDE_FLOAT32_C(  -716.86), SIMDE_FLOAT32_C(  -828.82), SIMDE_FLOAT32_C(   193.17), SIMDE_FLOAT32_C(   773.38),
+        SIMDE_FLOAT32_C(   745.59), SIMDE_FLOAT32_C(   862.26), SIMDE_FLOAT32_C(   505.33), SIMDE_FLOAT32_C(   205.66),
+        SIMDE_FLOAT32_C(   880.15), SIMDE_FLOAT32_C(   421.54), SIMDE_FLOAT32_C(   621.17), SIMDE_FLOAT32_C(  -197.97),
+        SIMDE_FLOAT32_C(  -223.95), SIMDE_FLOAT32_C(  -374.60), SIMDE_FLOAT32_C(  -801.10), SIMDE_FLOAT32_C(   871.26) },
+      { UINT16_C(50227), UINT16_C(50255), UINT16_C(17217), UINT16_C(17473), UINT16_C(17466), UINT16_C(17496), UINT16_C(17405), UINT16_C(17230),
+        UINT16_C(17500), UINT16_C(17363), UINT16_C(17435), UINT16_C(49990), UINT16_C(50016), UINT16_C(50107), UINT16_C(50248), UINT16_C(17498),
+        UINT16_C(17503), UINT16_C(17490), UINT16_C(50078), UINT16_C(17509), UINT16_C(17492), UINT16_C(50113), UINT16_C(17325), UINT16_C(50254),
+        UINT16_C(49868), UINT16_C(17511), UINT16_C(50148), UINT16_C(50120), UINT16_C(17500), UINT16_C(50030), UINT16_C(17460), UINT16_C(17367) } },
+    { { SIMDE_FLOAT32_C(    11.32), SIMDE_FLOAT32_C(  -931.44), SIMDE_FLOAT32_C(   534.02), SIMDE_FLOAT32_C(   924.42),
+        SIMDE_FLOAT32_C(  -656.37), SIMDE_FLOAT32_C(   889.18), SIMDE_FLOAT32_C(   846.13), SIMDE_FLOAT32_C(   722.40),
+        SIMDE_FLOAT32_C(   181.87), SIMDE_FLOAT32_C(   957.42), SIMDE_FLOAT32_C(   633.12), SIMDE_FLOAT32_C(    98.39),
+        SIMDE_FLOAT32_C(   -31.07), SIMDE_FLOAT32_C(  -583.31), SIMDE_FLOAT32_C(  -663.88), SIMDE_FLOAT32_C(   741.58) },
+      { SIMDE_FLOAT32_C(  -923.04), SIMDE_FLOAT32_C(   743.93), SIMDE_FLOAT32_C(  -748.91), SIMDE_FLOAT32_C(  -944.96),
+        SIMDE_FLOAT32_C(   617.13), SIMDE_FLOAT32_C(  -175.15), SIMDE_FLOAT32_C(   149.29), SIMDE_FLOAT32_C(  -660.66),
+        SIMDE_FLOAT32_C(   -11.41), SIMDE_FLOAT32_C(  -665.84), SIMDE_FLOAT32_C(   199.50), SIMDE_FLOAT32_C(  -372.72),
+        SIMDE_FLOAT32_C(   509.38), SIMDE_FLOAT32_C(  -675.71), SIMDE_FLOAT32_C(   792.10), SIMDE_FLOAT32_C(  -471.32) },
+      { UINT16_C(50279), UINT16_C(17466), UINT16_C(50235), UINT16_C(50284), UINT16_C(17434), UINT16_C(49967), UINT16_C(17173), UINT16_C(50213),
+        UINT16_C(49463), UINT16_C(50214), UINT16_C(17224), UINT16_C(50106), UINT16_C(17407), UINT16_C(50217), UINT16_C(17478), UINT16_C(50156),
+        UINT16_C(16693), UINT16_C(50281), UINT16_C(17414), UINT16_C(17511), UINT16_C(50212), UINT16_C(17502), UINT16_C(17492), UINT16_C(17461),
+        UINT16_C(17206), UINT16_C(17519), UINT16_C(17438), UINT16_C(17093), UINT16_C(49657), UINT16_C(50194), UINT16_C(50214), UINT16_C(17465) } },
+    { { SIMDE_FLOAT32_C(  -219.90), SIMDE_FLOAT32_C(  -879.45), SIMDE_FLOAT32_C(  -514.46), SIMDE_FLOAT32_C(    95.86),
+        SIMDE_FLOAT32_C(   967.06), SIMDE_FLOAT32_C(   152.22), SIMDE_FLOAT32_C(  -457.17), SIMDE_FLOAT32_C(  -706.19),
+        SIMDE_FLOAT32_C(  -752.89), SIMDE_FLOAT32_C(   343.48), SIMDE_FLOAT32_C(   105.03), SIMDE_FLOAT32_C(  -354.11),
+        SIMDE_FLOAT32_C(  -531.15), SIMDE_FLOAT32_C(  -408.90), SIMDE_FLOAT32_C(   838.20), SIMDE_FLOAT32_C(  -681.81) },
+      { SIMDE_FLOAT32_C(  -169.19), SIMDE_FLOAT32_C(   551.78), SIMDE_FLOAT32_C(    89.27), SIMDE_FLOAT32_C(   -93.63),
+        SIMDE_FLOAT32_C(  -414.21), SIMDE_FLOAT32_C(   769.25), SIMDE_FLOAT32_C(   145.93), SIMDE_FLOAT32_C(   318.30),
+        SIMDE_FLOAT32_C(   151.11), SIMDE_FLOAT32_C(    95.73), SIMDE_FLOAT32_C(   756.42), SIMDE_FLOAT32_C(  -870.85),
+        SIMDE_FLOAT32_C(  -941.06), SIMDE_FLOAT32_C(   578.05), SIMDE_FLOAT32_C(  -322.59), SIMDE_FLOAT32_C(   439.16) },
+      { UINT16_C(49961), UINT16_C(17418), UINT16_C(17075), UINT16_C(49851), UINT16_C(50127), UINT16_C(17472), UINT16_C(17170), UINT16_C(17311),
+        UINT16_C(17175), UINT16_C(17087), UINT16_C(17469), UINT16_C(50266), UINT16_C(50283), UINT16_C(17425), UINT16_C(50081), UINT16_C(17372),
+        UINT16_C(50012), UINT16_C(50268), UINT16_C(50177), UINT16_C(17088), UINT16_C(17522), UINT16_C(17176), UINT16_C(50149), UINT16_C(50225),
+        UINT16_C(50236), UINT16_C(17324), UINT16_C(17106), UINT16_C(50097), UINT16_C(50181), UINT16_C(50124), UINT16_C(17490), UINT16_C(50218) } },
+    { { SIMDE_FLOAT32_C(  -761.15), SIMDE_FLOAT32_C(  -202.44), SIMDE_FLOAT32_C(   -96.72), SIMDE_FLOAT32_C(  -959.18),
+        SIMDE_FLOAT32_C(  -283.24), SIMDE_FLOAT32_C(   505.53), SIMDE_FLOAT32_C(    59.29), SIMDE_FLOAT32_C(   653.96),
+        SIMDE_FLOAT32_C(   462.92), SIMDE_FLOAT32_C(  -728.41), SIMDE_FLOAT32_C(   987.60), SIMDE_FLOAT32_C(  -360.97),
+        SIMDE_FLOAT32_C(  -162.66), SIMDE_FLOAT32_C(    37.65), SIMDE_FLOAT32_C(  -951.44), SIMDE_FLOAT32_C(   896.98) },
+      { SIMDE_FLOAT32_C(  -438.44), SIMDE_FLOAT32_C(  -936.77), SIMDE_FLOAT32_C(  -589.25), SIMDE_FLOAT32_C(   945.79),
+        SIMDE_FLOAT32_C(  -802.56), SIMDE_FLOAT32_C(   502.46), SIMDE_FLOAT32_C(  -547.54), SIMDE_FLOAT32_C(   531.79),
+        SIMDE_FLOAT32_C(  -767.09), SIMDE_FLOAT32_C(   251.72), SIMDE_FLOAT32_C(  -535.39), SIMDE_FLOAT32_C(   241.49),
+        SIMDE_FLOAT32_C(   484.05), SIMDE_FLOAT32_C(   389.77), SIMDE_FLOAT32_C(   164.70), SIMDE_FLOAT32_C(   823.88) },
+      { UINT16_C(50139), UINT16_C(50282), UINT16_C(50195), UINT16_C(17516), UINT16_C(50249), UINT16_C(17403), UINT16_C(50185), UINT16_C(17413),
+        UINT16_C(50240), UINT16_C(17276), UINT16_C(50182), UINT16_C(17265), UINT16_C(17394), UINT16_C(17347), UINT16_C(17189), UINT16_C(17486),
+        UINT16_C(50238), UINT16_C(49994), UINT16_C(49857), UINT16_C(50288), UINT16_C(50062), UINT16_C(17405), UINT16_C(17005), UINT16_C(17443),
+        UINT16_C(17383), UINT16_C(50230), UINT16_C(17527), UINT16_C(50100), UINT16_C(49955), UINT16_C(16919), UINT16_C(50286), UINT16_C(17504) } },
+    { { SIMDE_FLOAT32_C(    88.01), SIMDE_FLOAT32_C(  -876.60), SIMDE_FLOAT32_C(   691.14), SIMDE_FLOAT32_C(  -126.70),
+        SIMDE_FLOAT32_C(   813.27), SIMDE_FLOAT32_C(  -310.78), SIMDE_FLOAT32_C(  -344.23), SIMDE_FLOAT32_C(   865.62),
+        SIMDE_FLOAT32_C(  -565.91), SIMDE_FLOAT32_C(   729.80), SIMDE_FLOAT32_C(   107.67), SIMDE_FLOAT32_C(   986.41),
+        SIMDE_FLOAT32_C(   746.17), SIMDE_FLOAT32_C(  -420.76), SIMDE_FLOAT32_C(   152.39), SIMDE_FLOAT32_C(   878.38) },
+      { SIMDE_FLOAT32_C(   552.07), SIMDE_FLOAT32_C(  -784.43), SIMDE_FLOAT32_C(  -259.67), SIMDE_FLOAT32_C(   374.81),
+        SIMDE_FLOAT32_C(   942.23), SIMDE_FLOAT32_C(  -824.98), SIMDE_FLOAT32_C(   608.89), SIMDE_FLOAT32_C(   388.18),
+        SIMDE_FLOAT32_C(  -834.87), SIMDE_FLOAT32_C(   376.18), SIMDE_FLOAT32_C(   646.42), SIMDE_FLOAT32_C(   609.87),
+        SIMDE_FLOAT32_C(  -817.10), SIMDE_FLOAT32_C(  -509.50), SIMDE_FLOAT32_C(   316.18), SIMDE_FLOAT32_C(   544.10) },
+      { UINT16_C(17418), UINT16_C(50244), UINT16_C(50050), UINT16_C(17339), UINT16_C(17516), UINT16_C(50254), UINT16_C(17432), UINT16_C(17346),
+        UINT16_C(50257), UINT16_C(17340), UINT16_C(17442), UINT16_C(17432), UINT16_C(50252), UINT16_C(50175), UINT16_C(17310), UINT16_C(17416),
+        UINT16_C(17072), UINT16_C(50267), UINT16_C(17453), UINT16_C(49917), UINT16_C(17483), UINT16_C(50075), UINT16_C(50092), UINT16_C(17496),
+        UINT16_C(50189), UINT16_C(17462), UINT16_C(17111), UINT16_C(17527), UINT16_C(17467), UINT16_C(50130), UINT16_C(17176), UINT16_C(17500) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 b = simde_mm512_loadu_ps(test_vec[i].b);
+    simde__m512bh r = simde_mm512_cvtne2ps_pbh(a, b);
+    simde_test_x86_assert_equal_u16x32(simde_x_mm512_castpbh_si512(r), simde_mm512_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m512 a = simde_test_x86_random_f32x16(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__m512 b = simde_test_x86_random_f32x16(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__m512bh r = simde_mm512_cvtne2ps_pbh(a, b);
+
+    simde_test_x86_write_f32x16(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x16(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u16x32(2, simde_x_mm512_castpbh_si512(r), SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_mask_cvtne2ps_pbh (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint16_t src[32];
+    const simde__mmask32 k;
+    const simde_float32 a[16];
+    const simde_float32 b[16];
+    const uint16_t r[32];
+  } test_vec[] = {
+    { { UINT16_C(22353), UINT16_C(35515), UINT16_C(15092), UINT16_C(26343), UINT16_C(50930), UINT16_C(17268), UINT16_C(12913), UINT16_C(33998),
+        UINT16_C(45333), UINT16_C(52354), UINT16_C(10533), UINT16_C(20831), UINT16_C(60464), UINT16_C(59604), UINT16_C(39389), UINT16_C(15700),
+        UINT16_C(14790), UINT16_C( 4137), UINT16_C(33910), UINT16_C(18825), UINT16_C(44375), UINT16_C(25308), UINT16_C(  671), UINT16_C(40478),
+        UINT16_C(11146), UINT16_C(61911), UINT16_C(59304), UINT16_C(57558), UINT16_C(61808), UINT16_C(27445), UINT16_C(  791), UINT16_C(27558) },
+      UINT32_C(2585035803),
+      { SIMDE_FLOAT32_C(   459.70), SIMDE_FLOAT32_C(   643.23), SIMDE_FLOAT32_C(   450.49), SIMDE_FLOAT32_C(  -221.88),
+        SIMDE_FLOAT32_C(   161.73), SIMDE_FLOAT32_C(   -78.87), SIMDE_FLOAT32_C(   953.97), SIMDE_FLOAT32_C(  -777.98),
+        SIMDE_FLOAT32_C(   988.92), SIMDE_FLOAT32_C(  -740.30), SIMDE_FLOAT32_C(  -388.94), SIMDE_FLOAT32_C(   142.46),
+        SIMDE_FLOAT32_C(   884.70), SIMDE_FLOAT32_C(   758.66), SIMDE_FLOAT32_C(   521.35), SIMDE_FLOAT32_C(   284.59) },
+      { SIMDE_FLOAT32_C(   506.51), SIMDE_FLOAT32_C(  -386.77), SIMDE_FLOAT32_C(  -909.74), SIMDE_FLOAT32_C(   178.29),
+        SIMDE_FLOAT32_C(  -565.63), SIMDE_FLOAT32_C(   -89.82), SIMDE_FLOAT32_C(   536.11), SIMDE_FLOAT32_C(   957.17),
+        SIMDE_FLOAT32_C(  -743.15), SIMDE_FLOAT32_C(   844.09), SIMDE_FLOAT32_C(  -534.56), SIMDE_FLOAT32_C(    34.58),
+        SIMDE_FLOAT32_C(   601.89), SIMDE_FLOAT32_C(   358.30), SIMDE_FLOAT32_C(  -239.16), SIMDE_FLOAT32_C(   786.54) },
+      { UINT16_C(17405), UINT16_C(50113), UINT16_C(15092), UINT16_C(17202), UINT16_C(50189), UINT16_C(17268), UINT16_C(12913), UINT16_C(33998),
+        UINT16_C(45333), UINT16_C(52354), UINT16_C(50182), UINT16_C(20831), UINT16_C(60464), UINT16_C(59604), UINT16_C(39389), UINT16_C(17477),
+        UINT16_C(14790), UINT16_C( 4137), UINT16_C(17377), UINT16_C(18825), UINT16_C(17186), UINT16_C(25308), UINT16_C(  671), UINT16_C(40478),
+        UINT16_C(11146), UINT16_C(50233), UINT16_C(59304), UINT16_C(17166), UINT16_C(17501), UINT16_C(27445), UINT16_C(  791), UINT16_C(17294) } },
+    { { UINT16_C(14042), UINT16_C(35198), UINT16_C(23560), UINT16_C(35133), UINT16_C(19980), UINT16_C(63598), UINT16_C(30238), UINT16_C(58000),
+        UINT16_C(24837), UINT16_C(22969), UINT16_C( 5356), UINT16_C(60746), UINT16_C(44221), UINT16_C(34554), UINT16_C(51966), UINT16_C(47061),
+        UINT16_C(15174), UINT16_C(37052), UINT16_C( 6047), UINT16_C(21799), UINT16_C(14699), UINT16_C(47733), UINT16_C(60420), UINT16_C(34320),
+        UINT16_C(13438), UINT16_C( 3766), UINT16_C(46112), UINT16_C(27295), UINT16_C( 1238), UINT16_C(19448), UINT16_C(44100), UINT16_C(44386) },
+      UINT32_C(2770717339),
+      { SIMDE_FLOAT32_C(   833.96), SIMDE_FLOAT32_C(  -694.06), SIMDE_FLOAT32_C(   479.88), SIMDE_FLOAT32_C(   913.11),
+        SIMDE_FLOAT32_C(   730.35), SIMDE_FLOAT32_C(  -864.63), SIMDE_FLOAT32_C(  -359.45), SIMDE_FLOAT32_C(   391.22),
+        SIMDE_FLOAT32_C(   571.75), SIMDE_FLOAT32_C(  -392.12), SIMDE_FLOAT32_C(    54.61), SIMDE_FLOAT32_C(   570.03),
+        SIMDE_FLOAT32_C(   738.86), SIMDE_FLOAT32_C(  -631.93), SIMDE_FLOAT32_C(   943.73), SIMDE_FLOAT32_C(   514.92) },
+      { SIMDE_FLOAT32_C(    73.91), SIMDE_FLOAT32_C(  -484.05), SIMDE_FLOAT32_C(  -466.45), SIMDE_FLOAT32_C(  -618.28),
+        SIMDE_FLOAT32_C(   606.75), SIMDE_FLOAT32_C(  -379.27), SIMDE_FLOAT32_C(  -494.47), SIMDE_FLOAT32_C(  -209.67),
+        SIMDE_FLOAT32_C(  -462.30), SIMDE_FLOAT32_C(  -536.13), SIMDE_FLOAT32_C(   370.79), SIMDE_FLOAT32_C(  -883.68),
+        SIMDE_FLOAT32_C(  -399.18), SIMDE_FLOAT32_C(  -494.57), SIMDE_FLOAT32_C(   823.56), SIMDE_FLOAT32_C(   418.51) },
+      { UINT16_C(17044), UINT16_C(50162), UINT16_C(23560), UINT16_C(50203), UINT16_C(17432), UINT16_C(63598), UINT16_C(30238), UINT16_C(50002),
+        UINT16_C(24837), UINT16_C(50182), UINT16_C( 5356), UINT16_C(50269), UINT16_C(44221), UINT16_C(34554), UINT16_C(17486), UINT16_C(17361),
+        UINT16_C(17488), UINT16_C(37052), UINT16_C(17392), UINT16_C(21799), UINT16_C(14699), UINT16_C(50264), UINT16_C(60420), UINT16_C(34320),
+        UINT16_C(17423), UINT16_C( 3766), UINT16_C(16986), UINT16_C(27295), UINT16_C( 1238), UINT16_C(50206), UINT16_C(44100), UINT16_C(17409) } },
+    { { UINT16_C(27501), UINT16_C(33671), UINT16_C( 9339), UINT16_C( 5645), UINT16_C(55482), UINT16_C( 1410), UINT16_C(40227), UINT16_C(57957),
+        UINT16_C(47761), UINT16_C(54706), UINT16_C(25364), UINT16_C( 7451), UINT16_C(64184), UINT16_C(29343), UINT16_C(48201), UINT16_C(37017),
+        UINT16_C(33753), UINT16_C(51716), UINT16_C(21836), UINT16_C(25911), UINT16_C(11624), UINT16_C(43169), UINT16_C(45179), UINT16_C(27073),
+        UINT16_C(13721), UINT16_C( 5719), UINT16_C(40642), UINT16_C(43993), UINT16_C(30317), UINT16_C(57969), UINT16_C(21825), UINT16_C(27657) },
+      UINT32_C(2183196679),
+      { SIMDE_FLOAT32_C(  -247.74), SIMDE_FLOAT32_C(  -167.02), SIMDE_FLOAT32_C(   -41.49), SIMDE_FLOAT32_C(   841.71),
+        SIMDE_FLOAT32_C(   539.20), SIMDE_FLOAT32_C(   -15.96), SIMDE_FLOAT32_C(  -409.54), SIMDE_FLOAT32_C(  -567.26),
+        SIMDE_FLOAT32_C(  -257.25), SIMDE_FLOAT32_C(   664.19), SIMDE_FLOAT32_C(   681.94), SIMDE_FLOAT32_C(   304.42),
+        SIMDE_FLOAT32_C(   321.42), SIMDE_FLOAT32_C(  -931.03), SIMDE_FLOAT32_C(   361.18), SIMDE_FLOAT32_C(  -102.19) },
+      { SIMDE_FLOAT32_C(   252.43), SIMDE_FLOAT32_C(   763.63), SIMDE_FLOAT32_C(  -110.97), SIMDE_FLOAT32_C(   530.95),
+        SIMDE_FLOAT32_C(   613.07), SIMDE_FLOAT32_C(  -994.37), SIMDE_FLOAT32_C(  -614.80), SIMDE_FLOAT32_C(  -407.87),
+        SIMDE_FLOAT32_C(  -855.44), SIMDE_FLOAT32_C(   459.89), SIMDE_FLOAT32_C(  -414.94), SIMDE_FLOAT32_C(  -903.18),
+        SIMDE_FLOAT32_C(   300.81), SIMDE_FLOAT32_C(  -207.83), SIMDE_FLOAT32_C(   -54.44), SIMDE_FLOAT32_C(   676.54) },
+      { UINT16_C(17276), UINT16_C(17471), UINT16_C(49886), UINT16_C( 5645), UINT16_C(55482), UINT16_C( 1410), UINT16_C(40227), UINT16_C(57957),
+        UINT16_C(47761), UINT16_C(54706), UINT16_C(25364), UINT16_C( 7451), UINT16_C(17302), UINT16_C(50000), UINT16_C(49754), UINT16_C(17449),
+        UINT16_C(33753), UINT16_C(51716), UINT16_C(21836), UINT16_C(25911), UINT16_C(11624), UINT16_C(49535), UINT16_C(45179), UINT16_C(27073),
+        UINT16_C(13721), UINT16_C(17446), UINT16_C(40642), UINT16_C(43993), UINT16_C(30317), UINT16_C(57969), UINT16_C(21825), UINT16_C(49868) } },
+    { { UINT16_C(39902), UINT16_C( 9382), UINT16_C(38284), UINT16_C(16182), UINT16_C(47632), UINT16_C(50705), UINT16_C(61981), UINT16_C(18956),
+        UINT16_C( 3560), UINT16_C(36298), UINT16_C(59567), UINT16_C(61365), UINT16_C(47923), UINT16_C(42482), UINT16_C(58516), UINT16_C( 2361),
+        UINT16_C(51574), UINT16_C(12133), UINT16_C(55795), UINT16_C(28262), UINT16_C(33507), UINT16_C(44366), UINT16_C(46452), UINT16_C( 4872),
+        UINT16_C(40104), UINT16_C(52766), UINT16_C(40196), UINT16_C( 2142), UINT16_C( 2958), UINT16_C(  661), UINT16_C(12516), UINT16_C( 4370) },
+      UINT32_C(1294371813),
+      { SIMDE_FLOAT32_C(  -924.76), SIMDE_FLOAT32_C(  -593.38), SIMDE_FLOAT32_C(  -752.49), SIMDE_FLOAT32_C(  -641.33),
+        SIMDE_FLOAT32_C(   842.77), SIMDE_FLOAT32_C(  -963.11), SIMDE_FLOAT32_C(   -30.19), SIMDE_FLOAT32_C(  -848.47),
+        SIMDE_FLOAT32_C(  -979.10), SIMDE_FLOAT32_C(   852.88), SIMDE_FLOAT32_C(     6.15), SIMDE_FLOAT32_C(   715.93),
+        SIMDE_FLOAT32_C(   258.53), SIMDE_FLOAT32_C(   149.11), SIMDE_FLOAT32_C(   535.58), SIMDE_FLOAT32_C(  -989.95) },
+      { SIMDE_FLOAT32_C(  -582.58), SIMDE_FLOAT32_C(   359.03), SIMDE_FLOAT32_C(   986.10), SIMDE_FLOAT32_C(  -615.43),
+        SIMDE_FLOAT32_C(  -208.27), SIMDE_FLOAT32_C(   360.77), SIMDE_FLOAT32_C(   144.43), SIMDE_FLOAT32_C(   465.11),
+        SIMDE_FLOAT32_C(  -906.35), SIMDE_FLOAT32_C(  -513.70), SIMDE_FLOAT32_C(   350.87), SIMDE_FLOAT32_C(   484.61),
+        SIMDE_FLOAT32_C(   326.32), SIMDE_FLOAT32_C(   609.48), SIMDE_FLOAT32_C(   604.80), SIMDE_FLOAT32_C(  -998.08) },
+      { UINT16_C(50194), UINT16_C( 9382), UINT16_C(17527), UINT16_C(16182), UINT16_C(47632), UINT16_C(17332), UINT16_C(17168), UINT16_C(17385),
+        UINT16_C(50275), UINT16_C(50176), UINT16_C(59567), UINT16_C(17394), UINT16_C(47923), UINT16_C(42482), UINT16_C(58516), UINT16_C(50298),
+        UINT16_C(51574), UINT16_C(50196), UINT16_C(50236), UINT16_C(28262), UINT16_C(33507), UINT16_C(50289), UINT16_C(46452), UINT16_C( 4872),
+        UINT16_C(50293), UINT16_C(52766), UINT16_C(16581), UINT16_C(17459), UINT16_C( 2958), UINT16_C(  661), UINT16_C(17414), UINT16_C( 4370) } },
+    { { UINT16_C(48660), UINT16_C( 5936), UINT16_C(48699), UINT16_C(62498), UINT16_C(27748), UINT16_C(62963), UINT16_C(35624), UINT16_C(14594),
+        UINT16_C(38581), UINT16_C( 8495), UINT16_C(61014), UINT16_C( 5152), UINT16_C( 5876), UINT16_C(62525), UINT16_C( 7308), UINT16_C(14559),
+        UINT16_C(31359), UINT16_C(23554), UINT16_C(47674), UINT16_C(43720), UINT16_C(24886), UINT16_C(52657), UINT16_C( 2571), UINT16_C(49700),
+        UINT16_C(52039), UINT16_C(12812), UINT16_C(11490), UINT16_C( 9288), UINT16_C(10624), UINT16_C(13264), UINT16_C( 6142), UINT16_C(58027) },
+      UINT32_C(2864037386),
+      { SIMDE_FLOAT32_C(  -719.26), SIMDE_FLOAT32_C(  -374.50), SIMDE_FLOAT32_C(  -717.97), SIMDE_FLOAT32_C(   452.62),
+        SIMDE_FLOAT32_C(  -698.67), SIMDE_FLOAT32_C(   -91.02), SIMDE_FLOAT32_C(  -886.29), SIMDE_FLOAT32_C(  -209.64),
+        SIMDE_FLOAT32_C(  -480.55), SIMDE_FLOAT32_C(    78.51), SIMDE_FLOAT32_C(  -471.37), SIMDE_FLOAT32_C(  -566.97),
+        SIMDE_FLOAT32_C(  -296.34), SIMDE_FLOAT32_C(   888.61), SIMDE_FLOAT32_C(   981.47), SIMDE_FLOAT32_C(  -682.76) },
+      { SIMDE_FLOAT32_C(   479.43), SIMDE_FLOAT32_C(  -886.91), SIMDE_FLOAT32_C(  -373.68), SIMDE_FLOAT32_C(   560.59),
+        SIMDE_FLOAT32_C(   455.42), SIMDE_FLOAT32_C(   390.24), SIMDE_FLOAT32_C(   -14.89), SIMDE_FLOAT32_C(  -110.64),
+        SIMDE_FLOAT32_C(  -897.37), SIMDE_FLOAT32_C(   318.63), SIMDE_FLOAT32_C(   280.68), SIMDE_FLOAT32_C(  -255.10),
+        SIMDE_FLOAT32_C(  -707.18), SIMDE_FLOAT32_C(  -481.78), SIMDE_FLOAT32_C(   609.84), SIMDE_FLOAT32_C(  -821.16) },
+      { UINT16_C(48660), UINT16_C(50270), UINT16_C(48699), UINT16_C(17420), UINT16_C(27748), UINT16_C(62963), UINT16_C(35624), UINT16_C(14594),
+        UINT16_C(38581), UINT16_C(17311), UINT16_C(17292), UINT16_C(50047), UINT16_C(50225), UINT16_C(50161), UINT16_C( 7308), UINT16_C(50253),
+        UINT16_C(50228), UINT16_C(23554), UINT16_C(50227), UINT16_C(43720), UINT16_C(50223), UINT16_C(49846), UINT16_C( 2571), UINT16_C(50002),
+        UINT16_C(52039), UINT16_C(17053), UINT16_C(11490), UINT16_C(50190), UINT16_C(10624), UINT16_C(17502), UINT16_C( 6142), UINT16_C(50219) } },
+    { { UINT16_C(34231), UINT16_C(32531), UINT16_C(48187), UINT16_C(24586), UINT16_C(55401), UINT16_C(43011), UINT16_C(19832), UINT16_C(40772),
+        UINT16_C( 1838), UINT16_C(57341), UINT16_C(51871), UINT16_C(39509), UINT16_C(61030), UINT16_C(24769), UINT16_C(22258), UINT16_C(33517),
+        UINT16_C(15348), UINT16_C(12732), UINT16_C( 1287), UINT16_C(16222), UINT16_C(21148), UINT16_C(21517), UINT16_C( 3647), UINT16_C(32517),
+        UINT16_C(32417), UINT16_C(  447), UINT16_C(21238), UINT16_C(59975), UINT16_C(28989), UINT16_C(64349), UINT16_C( 8717), UINT16_C(59848) },
+      UINT32_C(4098282188),
+      { SIMDE_FLOAT32_C(   176.90), SIMDE_FLOAT32_C(   251.88), SIMDE_FLOAT32_C(   967.01), SIMDE_FLOAT32_C(   866.84),
+        SIMDE_FLOAT32_C(   964.44), SIMDE_FLOAT32_C(    17.31), SIMDE_FLOAT32_C(  -258.54), SIMDE_FLOAT32_C(   518.93),
+        SIMDE_FLOAT32_C(   735.13), SIMDE_FLOAT32_C(   804.41), SIMDE_FLOAT32_C(  -625.97), SIMDE_FLOAT32_C(   785.63),
+        SIMDE_FLOAT32_C(  -115.71), SIMDE_FLOAT32_C(  -242.16), SIMDE_FLOAT32_C(  -299.07), SIMDE_FLOAT32_C(   945.10) },
+      { SIMDE_FLOAT32_C(   374.79), SIMDE_FLOAT32_C(  -897.86), SIMDE_FLOAT32_C(   428.38), SIMDE_FLOAT32_C(   613.09),
+        SIMDE_FLOAT32_C(   235.12), SIMDE_FLOAT32_C(   339.59), SIMDE_FLOAT32_C(  -488.69), SIMDE_FLOAT32_C(  -371.94),
+        SIMDE_FLOAT32_C(  -545.02), SIMDE_FLOAT32_C(  -877.31), SIMDE_FLOAT32_C(   627.53), SIMDE_FLOAT32_C(  -217.06),
+        SIMDE_FLOAT32_C(   566.89), SIMDE_FLOAT32_C(   122.16), SIMDE_FLOAT32_C(   539.25), SIMDE_FLOAT32_C(   819.29) },
+      { UINT16_C(34231), UINT16_C(32531), UINT16_C(17366), UINT16_C(17433), UINT16_C(55401), UINT16_C(43011), UINT16_C(50164), UINT16_C(50106),
+        UINT16_C( 1838), UINT16_C(50267), UINT16_C(51871), UINT16_C(39509), UINT16_C(17422), UINT16_C(24769), UINT16_C(17415), UINT16_C(17485),
+        UINT16_C(15348), UINT16_C(17276), UINT16_C(17522), UINT16_C(16222), UINT16_C(21148), UINT16_C(21517), UINT16_C(50049), UINT16_C(32517),
+        UINT16_C(32417), UINT16_C(  447), UINT16_C(50204), UINT16_C(59975), UINT16_C(49895), UINT16_C(50034), UINT16_C(50070), UINT16_C(17516) } },
+    { { UINT16_C(37664), UINT16_C(50163), UINT16_C(64704), UINT16_C(32436), UINT16_C(35960), UINT16_C(47506), UINT16_C(64615), UINT16_C(12999),
+        UINT16_C(33704), UINT16_C(33651), UINT16_C(34731), UINT16_C(47162), UINT16_C(24499), UINT16_C(32520), UINT16_C(56291), UINT16_C(18128),
+        UINT16_C(23909), UINT16_C(52776), UINT16_C(58700), UINT16_C(40592), UINT16_C(28923), UINT16_C(33074), UINT16_C(38098), UINT16_C( 8168),
+        UINT16_C(21972), UINT16_C(61521), UINT16_C(10256), UINT16_C(26807), UINT16_C(23647), UINT16_C(26476), UINT16_C(36556), UINT16_C(47649) },
+      UINT32_C(3341591545),
+      { SIMDE_FLOAT32_C(  -118.92), SIMDE_FLOAT32_C(  -778.74), SIMDE_FLOAT32_C(   964.55), SIMDE_FLOAT32_C(   838.81),
+        SIMDE_FLOAT32_C(  -233.42), SIMDE_FLOAT32_C(  -600.53), SIMDE_FLOAT32_C(   677.95), SIMDE_FLOAT32_C(  -321.15),
+        SIMDE_FLOAT32_C(  -600.40), SIMDE_FLOAT32_C(   624.00), SIMDE_FLOAT32_C(  -901.98), SIMDE_FLOAT32_C(    33.08),
+        SIMDE_FLOAT32_C(  -348.85), SIMDE_FLOAT32_C(  -525.32), SIMDE_FLOAT32_C(   720.72), SIMDE_FLOAT32_C(  -153.62) },
+      { SIMDE_FLOAT32_C(   582.64), SIMDE_FLOAT32_C(  -959.04), SIMDE_FLOAT32_C(   496.98), SIMDE_FLOAT32_C(    18.12),
+        SIMDE_FLOAT32_C(   439.23), SIMDE_FLOAT32_C(  -450.90), SIMDE_FLOAT32_C(  -120.98), SIMDE_FLOAT32_C(  -547.46),
+        SIMDE_FLOAT32_C(  -436.80), SIMDE_FLOAT32_C(  -980.81), SIMDE_FLOAT32_C(   625.34), SIMDE_FLOAT32_C(  -425.39),
+        SIMDE_FLOAT32_C(  -563.99), SIMDE_FLOAT32_C(  -140.05), SIMDE_FLOAT32_C(  -302.93), SIMDE_FLOAT32_C(    99.65) },
+      { UINT16_C(17426), UINT16_C(50163), UINT16_C(64704), UINT16_C(16785), UINT16_C(17372), UINT16_C(50145), UINT16_C(49906), UINT16_C(50185),
+        UINT16_C(50138), UINT16_C(50293), UINT16_C(34731), UINT16_C(47162), UINT16_C(24499), UINT16_C(49932), UINT16_C(56291), UINT16_C(17095),
+        UINT16_C(23909), UINT16_C(52776), UINT16_C(17521), UINT16_C(17490), UINT16_C(28923), UINT16_C(50198), UINT16_C(38098), UINT16_C( 8168),
+        UINT16_C(50198), UINT16_C(17436), UINT16_C(50273), UINT16_C(26807), UINT16_C(23647), UINT16_C(26476), UINT16_C(17460), UINT16_C(49946) } },
+    { { UINT16_C( 1620), UINT16_C(31070), UINT16_C( 3164), UINT16_C(52735), UINT16_C(27069), UINT16_C( 8688), UINT16_C(25787), UINT16_C(38775),
+        UINT16_C(13598), UINT16_C(34978), UINT16_C(17331), UINT16_C(30992), UINT16_C(20426), UINT16_C(37040), UINT16_C(20802), UINT16_C( 3111),
+        UINT16_C(48168), UINT16_C(44225), UINT16_C(49762), UINT16_C(38218), UINT16_C( 4555), UINT16_C(23066), UINT16_C(62117), UINT16_C(28251),
+        UINT16_C(17343), UINT16_C(52886), UINT16_C(19476), UINT16_C(65395), UINT16_C(16544), UINT16_C(21551), UINT16_C(23783), UINT16_C( 7508) },
+      UINT32_C(1614236459),
+      { SIMDE_FLOAT32_C(  -643.36), SIMDE_FLOAT32_C(  -660.41), SIMDE_FLOAT32_C(  -283.36), SIMDE_FLOAT32_C(  -753.94),
+        SIMDE_FLOAT32_C(  -859.83), SIMDE_FLOAT32_C(   833.29), SIMDE_FLOAT32_C(  -177.10), SIMDE_FLOAT32_C(  -502.90),
+        SIMDE_FLOAT32_C(  -650.85), SIMDE_FLOAT32_C(   475.68), SIMDE_FLOAT32_C(  -937.25), SIMDE_FLOAT32_C(    22.88),
+        SIMDE_FLOAT32_C(  -127.15), SIMDE_FLOAT32_C(    77.31), SIMDE_FLOAT32_C(  -294.66), SIMDE_FLOAT32_C(   831.54) },
+      { SIMDE_FLOAT32_C(  -891.59), SIMDE_FLOAT32_C(   515.27), SIMDE_FLOAT32_C(  -697.49), SIMDE_FLOAT32_C(  -891.73),
+        SIMDE_FLOAT32_C(  -797.27), SIMDE_FLOAT32_C(  -454.23), SIMDE_FLOAT32_C(   -35.68), SIMDE_FLOAT32_C(  -525.92),
+        SIMDE_FLOAT32_C(  -654.60), SIMDE_FLOAT32_C(  -735.32), SIMDE_FLOAT32_C(   619.25), SIMDE_FLOAT32_C(   797.93),
+        SIMDE_FLOAT32_C(  -424.80), SIMDE_FLOAT32_C(   523.33), SIMDE_FLOAT32_C(   334.45), SIMDE_FLOAT32_C(   702.31) },
+      { UINT16_C(50271), UINT16_C(17409), UINT16_C( 3164), UINT16_C(50271), UINT16_C(27069), UINT16_C(50147), UINT16_C(25787), UINT16_C(38775),
+        UINT16_C(50212), UINT16_C(50232), UINT16_C(17331), UINT16_C(17479), UINT16_C(20426), UINT16_C(37040), UINT16_C(17319), UINT16_C( 3111),
+        UINT16_C(50209), UINT16_C(50213), UINT16_C(50062), UINT16_C(38218), UINT16_C(50263), UINT16_C(17488), UINT16_C(62117), UINT16_C(28251),
+        UINT16_C(17343), UINT16_C(52886), UINT16_C(19476), UINT16_C(65395), UINT16_C(16544), UINT16_C(17051), UINT16_C(50067), UINT16_C( 7508) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512bh src = simde_x_mm512_castsi512_pbh(simde_mm512_loadu_epi16(test_vec[i].src));
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 b = simde_mm512_loadu_ps(test_vec[i].b);
+    simde__m512bh r = simde_mm512_mask_cvtne2ps_pbh(src, test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_u16x32(simde_x_mm512_castpbh_si512(r), simde_mm512_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m512bh src = simde_x_mm512_castsi512_pbh(simde_test_x86_random_u16x32());
+    simde__mmask32 k = simde_test_x86_random_mmask32();
+    simde__m512 a = simde_test_x86_random_f32x16(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__m512 b = simde_test_x86_random_f32x16(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__m512bh r = simde_mm512_mask_cvtne2ps_pbh(src, k, a, b);
+
+    simde_test_x86_write_u16x32(2, simde_x_mm512_castpbh_si512(src), SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask32(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x16(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u16x32(2, simde_x_mm512_castpbh_si512(r), SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_maskz_cvtne2ps_pbh (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask32 k;
+    const simde_float32 a[16];
+    const simde_float32 b[16];
+    const uint16_t r[32];
+  } test_vec[] = {
+    { UINT32_C(3701362656),
+      { SIMDE_FLOAT32_C(  -763.68), SIMDE_FLOAT32_C(   153.39), SIMDE_FLOAT32_C(   442.98), SIMDE_FLOAT32_C(  -846.62),
+        SIMDE_FLOAT32_C(  -418.83), SIMDE_FLOAT32_C(  -899.20), SIMDE_FLOAT32_C(  -149.61), SIMDE_FLOAT32_C(  -538.56),
+        SIMDE_FLOAT32_C(   175.78), SIMDE_FLOAT32_C(   360.48), SIMDE_FLOAT32_C(  -150.61), SIMDE_FLOAT32_C(   -15.31),
+        SIMDE_FLOAT32_C(   946.90), SIMDE_FLOAT32_C(   347.99), SIMDE_FLOAT32_C(  -796.56), SIMDE_FLOAT32_C(   554.73) },
+      { SIMDE_FLOAT32_C(   -79.25), SIMDE_FLOAT32_C(   771.27), SIMDE_FLOAT32_C(  -712.92), SIMDE_FLOAT32_C(   -47.56),
+        SIMDE_FLOAT32_C(   951.81), SIMDE_FLOAT32_C(   582.41), SIMDE_FLOAT32_C(   673.82), SIMDE_FLOAT32_C(   825.65),
+        SIMDE_FLOAT32_C(   726.91), SIMDE_FLOAT32_C(   336.31), SIMDE_FLOAT32_C(  -884.52), SIMDE_FLOAT32_C(   472.84),
+        SIMDE_FLOAT32_C(   -11.09), SIMDE_FLOAT32_C(  -841.26), SIMDE_FLOAT32_C(  -727.33), SIMDE_FLOAT32_C(   862.53) },
+      { UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(17426), UINT16_C(17448), UINT16_C(17486),
+        UINT16_C(17462), UINT16_C(17320), UINT16_C(50269), UINT16_C(17388), UINT16_C(    0), UINT16_C(    0), UINT16_C(50230), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(17177), UINT16_C(17373), UINT16_C(50260), UINT16_C(50129), UINT16_C(    0), UINT16_C(    0), UINT16_C(50183),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(49943), UINT16_C(49525), UINT16_C(17517), UINT16_C(    0), UINT16_C(50247), UINT16_C(17419) } },
+    { UINT32_C( 958427648),
+      { SIMDE_FLOAT32_C(   998.11), SIMDE_FLOAT32_C(  -498.77), SIMDE_FLOAT32_C(   181.80), SIMDE_FLOAT32_C(   499.99),
+        SIMDE_FLOAT32_C(   696.45), SIMDE_FLOAT32_C(  -446.80), SIMDE_FLOAT32_C(  -602.27), SIMDE_FLOAT32_C(   424.93),
+        SIMDE_FLOAT32_C(  -163.31), SIMDE_FLOAT32_C(   771.09), SIMDE_FLOAT32_C(   -44.26), SIMDE_FLOAT32_C(   492.94),
+        SIMDE_FLOAT32_C(   262.53), SIMDE_FLOAT32_C(  -880.93), SIMDE_FLOAT32_C(  -574.61), SIMDE_FLOAT32_C(  -438.69) },
+      { SIMDE_FLOAT32_C(  -113.24), SIMDE_FLOAT32_C(   -64.24), SIMDE_FLOAT32_C(   948.22), SIMDE_FLOAT32_C(  -397.53),
+        SIMDE_FLOAT32_C(  -763.43), SIMDE_FLOAT32_C(   415.00), SIMDE_FLOAT32_C(  -452.19), SIMDE_FLOAT32_C(   584.19),
+        SIMDE_FLOAT32_C(  -614.04), SIMDE_FLOAT32_C(   833.52), SIMDE_FLOAT32_C(    62.33), SIMDE_FLOAT32_C(  -951.45),
+        SIMDE_FLOAT32_C(   837.72), SIMDE_FLOAT32_C(  -123.80), SIMDE_FLOAT32_C(  -860.67), SIMDE_FLOAT32_C(  -553.21) },
+      { UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(17488), UINT16_C(    0), UINT16_C(    0), UINT16_C(17489), UINT16_C(49912), UINT16_C(50263), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(50143), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(49955), UINT16_C(    0), UINT16_C(    0), UINT16_C(17398), UINT16_C(17283), UINT16_C(50268), UINT16_C(    0), UINT16_C(    0) } },
+    { UINT32_C(2189990758),
+      { SIMDE_FLOAT32_C(  -247.51), SIMDE_FLOAT32_C(  -442.47), SIMDE_FLOAT32_C(  -572.84), SIMDE_FLOAT32_C(   610.80),
+        SIMDE_FLOAT32_C(   -90.19), SIMDE_FLOAT32_C(   376.81), SIMDE_FLOAT32_C(  -489.34), SIMDE_FLOAT32_C(   776.46),
+        SIMDE_FLOAT32_C(   718.19), SIMDE_FLOAT32_C(  -916.86), SIMDE_FLOAT32_C(   191.70), SIMDE_FLOAT32_C(  -465.29),
+        SIMDE_FLOAT32_C(   -41.58), SIMDE_FLOAT32_C(  -109.09), SIMDE_FLOAT32_C(   -63.44), SIMDE_FLOAT32_C(   -44.62) },
+      { SIMDE_FLOAT32_C(   785.41), SIMDE_FLOAT32_C(  -463.23), SIMDE_FLOAT32_C(  -111.81), SIMDE_FLOAT32_C(  -340.44),
+        SIMDE_FLOAT32_C(   238.92), SIMDE_FLOAT32_C(  -968.98), SIMDE_FLOAT32_C(   428.22), SIMDE_FLOAT32_C(   545.06),
+        SIMDE_FLOAT32_C(  -398.88), SIMDE_FLOAT32_C(   874.02), SIMDE_FLOAT32_C(  -891.03), SIMDE_FLOAT32_C(   851.75),
+        SIMDE_FLOAT32_C(   308.07), SIMDE_FLOAT32_C(   604.46), SIMDE_FLOAT32_C(  -935.62), SIMDE_FLOAT32_C(   182.26) },
+      { UINT16_C(    0), UINT16_C(50152), UINT16_C(49888), UINT16_C(    0), UINT16_C(    0), UINT16_C(50290), UINT16_C(17366), UINT16_C(    0),
+        UINT16_C(50119), UINT16_C(17499), UINT16_C(    0), UINT16_C(17493), UINT16_C(17306), UINT16_C(    0), UINT16_C(    0), UINT16_C(17206),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(17433), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(17474),
+        UINT16_C(    0), UINT16_C(50277), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(49714) } },
+    { UINT32_C(1762160437),
+      { SIMDE_FLOAT32_C(  -912.67), SIMDE_FLOAT32_C(  -290.58), SIMDE_FLOAT32_C(   921.28), SIMDE_FLOAT32_C(   464.53),
+        SIMDE_FLOAT32_C(  -580.13), SIMDE_FLOAT32_C(   181.67), SIMDE_FLOAT32_C(   832.21), SIMDE_FLOAT32_C(   297.32),
+        SIMDE_FLOAT32_C(   204.65), SIMDE_FLOAT32_C(  -258.37), SIMDE_FLOAT32_C(   812.51), SIMDE_FLOAT32_C(   170.47),
+        SIMDE_FLOAT32_C(  -346.76), SIMDE_FLOAT32_C(  -590.80), SIMDE_FLOAT32_C(  -266.01), SIMDE_FLOAT32_C(   945.09) },
+      { SIMDE_FLOAT32_C(  -486.49), SIMDE_FLOAT32_C(   430.15), SIMDE_FLOAT32_C(   -23.49), SIMDE_FLOAT32_C(  -922.90),
+        SIMDE_FLOAT32_C(  -709.31), SIMDE_FLOAT32_C(  -269.73), SIMDE_FLOAT32_C(  -887.54), SIMDE_FLOAT32_C(   829.01),
+        SIMDE_FLOAT32_C(  -799.38), SIMDE_FLOAT32_C(   601.54), SIMDE_FLOAT32_C(   335.17), SIMDE_FLOAT32_C(  -576.50),
+        SIMDE_FLOAT32_C(   299.80), SIMDE_FLOAT32_C(  -856.76), SIMDE_FLOAT32_C(   422.63), SIMDE_FLOAT32_C(  -131.36) },
+      { UINT16_C(50163), UINT16_C(    0), UINT16_C(49596), UINT16_C(    0), UINT16_C(50225), UINT16_C(50055), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(50248), UINT16_C(17430), UINT16_C(17320), UINT16_C(50192), UINT16_C(    0), UINT16_C(50262), UINT16_C(17363), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(17384), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(17229), UINT16_C(    0), UINT16_C(    0), UINT16_C(17194), UINT16_C(    0), UINT16_C(50196), UINT16_C(50053), UINT16_C(    0) } },
+    { UINT32_C(3733563610),
+      { SIMDE_FLOAT32_C(  -426.30), SIMDE_FLOAT32_C(  -346.78), SIMDE_FLOAT32_C(   599.33), SIMDE_FLOAT32_C(   454.26),
+        SIMDE_FLOAT32_C(   655.62), SIMDE_FLOAT32_C(  -685.53), SIMDE_FLOAT32_C(   330.39), SIMDE_FLOAT32_C(   995.85),
+        SIMDE_FLOAT32_C(  -743.48), SIMDE_FLOAT32_C(   805.95), SIMDE_FLOAT32_C(   581.91), SIMDE_FLOAT32_C(   137.55),
+        SIMDE_FLOAT32_C(  -783.78), SIMDE_FLOAT32_C(   539.80), SIMDE_FLOAT32_C(   765.36), SIMDE_FLOAT32_C(   285.38) },
+      { SIMDE_FLOAT32_C(   651.68), SIMDE_FLOAT32_C(   446.67), SIMDE_FLOAT32_C(  -506.47), SIMDE_FLOAT32_C(   868.71),
+        SIMDE_FLOAT32_C(   192.77), SIMDE_FLOAT32_C(  -955.83), SIMDE_FLOAT32_C(   157.06), SIMDE_FLOAT32_C(   499.41),
+        SIMDE_FLOAT32_C(   -83.33), SIMDE_FLOAT32_C(  -188.82), SIMDE_FLOAT32_C(   291.24), SIMDE_FLOAT32_C(   882.53),
+        SIMDE_FLOAT32_C(  -744.03), SIMDE_FLOAT32_C(   -76.32), SIMDE_FLOAT32_C(   294.04), SIMDE_FLOAT32_C(  -327.76) },
+      { UINT16_C(    0), UINT16_C(17375), UINT16_C(    0), UINT16_C(17497), UINT16_C(17217), UINT16_C(    0), UINT16_C(17181), UINT16_C(17402),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(17501), UINT16_C(    0), UINT16_C(49817), UINT16_C(    0), UINT16_C(50084),
+        UINT16_C(50133), UINT16_C(    0), UINT16_C(    0), UINT16_C(17379), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(17529),
+        UINT16_C(    0), UINT16_C(17481), UINT16_C(17425), UINT16_C(17162), UINT16_C(50244), UINT16_C(    0), UINT16_C(17471), UINT16_C(17295) } },
+    { UINT32_C( 965229177),
+      { SIMDE_FLOAT32_C(  -187.14), SIMDE_FLOAT32_C(  -999.08), SIMDE_FLOAT32_C(   147.40), SIMDE_FLOAT32_C(   867.34),
+        SIMDE_FLOAT32_C(   133.15), SIMDE_FLOAT32_C(  -710.29), SIMDE_FLOAT32_C(  -149.84), SIMDE_FLOAT32_C(   595.96),
+        SIMDE_FLOAT32_C(    82.15), SIMDE_FLOAT32_C(   379.78), SIMDE_FLOAT32_C(  -758.32), SIMDE_FLOAT32_C(   326.33),
+        SIMDE_FLOAT32_C(   815.13), SIMDE_FLOAT32_C(  -861.26), SIMDE_FLOAT32_C(  -187.15), SIMDE_FLOAT32_C(    14.23) },
+      { SIMDE_FLOAT32_C(   141.10), SIMDE_FLOAT32_C(  -144.90), SIMDE_FLOAT32_C(   293.59), SIMDE_FLOAT32_C(   377.94),
+        SIMDE_FLOAT32_C(   866.50), SIMDE_FLOAT32_C(  -683.04), SIMDE_FLOAT32_C(  -608.77), SIMDE_FLOAT32_C(  -606.77),
+        SIMDE_FLOAT32_C(  -532.36), SIMDE_FLOAT32_C(   502.85), SIMDE_FLOAT32_C(   942.23), SIMDE_FLOAT32_C(   -22.70),
+        SIMDE_FLOAT32_C(   343.62), SIMDE_FLOAT32_C(  -976.23), SIMDE_FLOAT32_C(  -267.00), SIMDE_FLOAT32_C(  -347.34) },
+      { UINT16_C(17165), UINT16_C(    0), UINT16_C(    0), UINT16_C(17341), UINT16_C(17497), UINT16_C(50219), UINT16_C(50200), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(17403), UINT16_C(    0), UINT16_C(49590), UINT16_C(17324), UINT16_C(50292), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(17497), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(17429),
+        UINT16_C(17060), UINT16_C(    0), UINT16_C(    0), UINT16_C(17315), UINT16_C(17484), UINT16_C(50263), UINT16_C(    0), UINT16_C(    0) } },
+    { UINT32_C(3905193499),
+      { SIMDE_FLOAT32_C(  -950.11), SIMDE_FLOAT32_C(   -11.91), SIMDE_FLOAT32_C(   123.39), SIMDE_FLOAT32_C(  -424.74),
+        SIMDE_FLOAT32_C(  -680.36), SIMDE_FLOAT32_C(  -982.10), SIMDE_FLOAT32_C(   318.67), SIMDE_FLOAT32_C(   507.27),
+        SIMDE_FLOAT32_C(  -901.37), SIMDE_FLOAT32_C(   385.76), SIMDE_FLOAT32_C(   765.99), SIMDE_FLOAT32_C(  -363.11),
+        SIMDE_FLOAT32_C(   936.16), SIMDE_FLOAT32_C(   880.31), SIMDE_FLOAT32_C(   670.68), SIMDE_FLOAT32_C(  -533.11) },
+      { SIMDE_FLOAT32_C(  -868.97), SIMDE_FLOAT32_C(  -236.76), SIMDE_FLOAT32_C(  -791.40), SIMDE_FLOAT32_C(   846.46),
+        SIMDE_FLOAT32_C(    57.50), SIMDE_FLOAT32_C(  -170.15), SIMDE_FLOAT32_C(   -77.86), SIMDE_FLOAT32_C(  -926.63),
+        SIMDE_FLOAT32_C(   616.12), SIMDE_FLOAT32_C(   443.50), SIMDE_FLOAT32_C(  -841.97), SIMDE_FLOAT32_C(  -434.08),
+        SIMDE_FLOAT32_C(   713.98), SIMDE_FLOAT32_C(   894.82), SIMDE_FLOAT32_C(   795.82), SIMDE_FLOAT32_C(   370.98) },
+      { UINT16_C(50265), UINT16_C(50029), UINT16_C(    0), UINT16_C(17492), UINT16_C(16998), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(17374), UINT16_C(50258), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(17337),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(17143), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(17311), UINT16_C(17406),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(50102), UINT16_C(    0), UINT16_C(17500), UINT16_C(17448), UINT16_C(50181) } },
+    { UINT32_C(1868689559),
+      { SIMDE_FLOAT32_C(  -844.02), SIMDE_FLOAT32_C(  -864.93), SIMDE_FLOAT32_C(   899.12), SIMDE_FLOAT32_C(   539.14),
+        SIMDE_FLOAT32_C(   913.47), SIMDE_FLOAT32_C(  -597.75), SIMDE_FLOAT32_C(   601.46), SIMDE_FLOAT32_C(   575.62),
+        SIMDE_FLOAT32_C(    56.01), SIMDE_FLOAT32_C(   411.06), SIMDE_FLOAT32_C(  -906.81), SIMDE_FLOAT32_C(  -566.83),
+        SIMDE_FLOAT32_C(   142.69), SIMDE_FLOAT32_C(   730.73), SIMDE_FLOAT32_C(  -676.78), SIMDE_FLOAT32_C(  -654.84) },
+      { SIMDE_FLOAT32_C(   486.35), SIMDE_FLOAT32_C(  -331.53), SIMDE_FLOAT32_C(   647.96), SIMDE_FLOAT32_C(   660.01),
+        SIMDE_FLOAT32_C(  -536.78), SIMDE_FLOAT32_C(  -169.43), SIMDE_FLOAT32_C(  -834.17), SIMDE_FLOAT32_C(  -686.30),
+        SIMDE_FLOAT32_C(  -508.13), SIMDE_FLOAT32_C(   364.72), SIMDE_FLOAT32_C(  -996.06), SIMDE_FLOAT32_C(   460.52),
+        SIMDE_FLOAT32_C(  -667.70), SIMDE_FLOAT32_C(   635.61), SIMDE_FLOAT32_C(   177.94), SIMDE_FLOAT32_C(   803.23) },
+      { UINT16_C(17395), UINT16_C(50086), UINT16_C(17442), UINT16_C(    0), UINT16_C(50182), UINT16_C(    0), UINT16_C(    0), UINT16_C(50220),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(50215), UINT16_C(17439), UINT16_C(17202), UINT16_C(17481),
+        UINT16_C(50259), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(50197), UINT16_C(17430), UINT16_C(    0),
+        UINT16_C(16992), UINT16_C(17358), UINT16_C(50275), UINT16_C(50190), UINT16_C(    0), UINT16_C(17463), UINT16_C(50217), UINT16_C(    0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 b = simde_mm512_loadu_ps(test_vec[i].b);
+    simde__m512bh r = simde_mm512_maskz_cvtne2ps_pbh(test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_u16x32(simde_x_mm512_castpbh_si512(r), simde_mm512_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask32 k = simde_test_x86_random_mmask32();
+    simde__m512 a = simde_test_x86_random_f32x16(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__m512 b = simde_test_x86_random_f32x16(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__m512bh r = simde_mm512_maskz_cvtne2ps_pbh(k, a, b);
+
+    simde_test_x86_write_mmask32(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x16(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u16x32(2, simde_x_mm512_castpbh_si512(r), SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_cvtneps_pbh (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde_float32 a[4];
+    const uint16_t r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT32_C(1.01171875), SIMDE_FLOAT32_C(1.00390625),  SIMDE_FLOAT32_C(-1.0e-39),            SIMDE_MATH_NANF },
+      { UINT16_C(16258), UINT16_C(16256), UINT16_C(32768), UINT16_C(32704), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    #endif
+    { { SIMDE_FLOAT32_C(  -213.36), SIMDE_FLOAT32_C(  -719.45), SIMDE_FLOAT32_C(  -144.53), SIMDE_FLOAT32_C(   360.01) },
+      { UINT16_C(50005), UINT16_C(50228), UINT16_C(49937), UINT16_C(17332), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { SIMDE_FLOAT32_C(   713.93), SIMDE_FLOAT32_C(   923.70), SIMDE_FLOAT32_C(   799.84), SIMDE_FLOAT32_C(   586.05) },
+      { UINT16_C(17458), UINT16_C(17511), UINT16_C(17480), UINT16_C(17427), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { SIMDE_FLOAT32_C(   149.31), SIMDE_FLOAT32_C(   525.56), SIMDE_FLOAT32_C(   830.43), SIMDE_FLOAT32_C(   634.47) },
+      { UINT16_C(17173), UINT16_C(17411), UINT16_C(17488), UINT16_C(17439), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { SIMDE_FLOAT32_C(   700.08), SIMDE_FLOAT32_C(   787.38), SIMDE_FLOAT32_C(  -987.88), SIMDE_FLOAT32_C(  -775.32) },
+      { UINT16_C(17455), UINT16_C(17477), UINT16_C(50295), UINT16_C(50242), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { SIMDE_FLOAT32_C(  -133.37), SIMDE_FLOAT32_C(   538.48), SIMDE_FLOAT32_C(   918.73), SIMDE_FLOAT32_C(   585.63) },
+      { UINT16_C(49925), UINT16_C(17415), UINT16_C(17510), UINT16_C(17426), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { SIMDE_FLOAT32_C(  -341.70), SIMDE_FLOAT32_C(    79.99), SIMDE_FLOAT32_C(   350.10), SIMDE_FLOAT32_C(  -133.14) },
+      { UINT16_C(50091), UINT16_C(17056), UINT16_C(17327), UINT16_C(49925), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { SIMDE_FLOAT32_C(   624.50), SIMDE_FLOAT32_C(  -915.21), SIMDE_FLOAT32_C(   257.57), SIMDE_FLOAT32_C(  -262.41) },
+      { UINT16_C(17436), UINT16_C(50277), UINT16_C(17281), UINT16_C(50051), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128bh r = simde_mm_cvtneps_pbh(a);
+    simde_test_x86_assert_equal_u16x8(simde_x_mm_castpbh_si128(r), simde_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m128 a = simde_test_x86_random_f32x4(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__m128bh r = simde_mm_cvtneps_pbh(a);
+
+    simde_test_x86_write_f32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_u16x8(2, simde_x_mm_castpbh_si128(r), SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_mask_cvtneps_pbh (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint16_t src[8];
+    const simde__mmask8 k;
+    const simde_float32 a[4];
+    const uint16_t r[8];
+  } test_vec[] = {
+    { { UINT16_C(13321), UINT16_C(56356), UINT16_C(47322), UINT16_C(33727), UINT16_C(42381), UINT16_C(46938), UINT16_C(56366), UINT16_C(15987) },
+      UINT8_C(214),
+      { SIMDE_FLOAT32_C(   924.60), SIMDE_FLOAT32_C(  -910.19), SIMDE_FLOAT32_C(    60.92), SIMDE_FLOAT32_C(   267.61) },
+      { UINT16_C(13321), UINT16_C(50276), UINT16_C(17012), UINT16_C(33727), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { UINT16_C(58040), UINT16_C(22694), UINT16_C(13075), UINT16_C(62497), UINT16_C(20820), UINT16_C(53212), UINT16_C(31057), UINT16_C( 4072) },
+      UINT8_C( 23),
+      { SIMDE_FLOAT32_C(   -85.61), SIMDE_FLOAT32_C(  -400.40), SIMDE_FLOAT32_C(  -461.44), SIMDE_FLOAT32_C(  -893.73) },
+      { UINT16_C(49835), UINT16_C(50120), UINT16_C(50151), UINT16_C(62497), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { UINT16_C(38433), UINT16_C(27481), UINT16_C(55863), UINT16_C(38530), UINT16_C(61318), UINT16_C( 5091), UINT16_C( 4905), UINT16_C(19384) },
+      UINT8_C( 11),
+      { SIMDE_FLOAT32_C(   285.86), SIMDE_FLOAT32_C(    29.38), SIMDE_FLOAT32_C(  -166.53), SIMDE_FLOAT32_C(  -867.26) },
+      { UINT16_C(17295), UINT16_C(16875), UINT16_C(55863), UINT16_C(50265), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { UINT16_C(26372), UINT16_C( 8390), UINT16_C(52297), UINT16_C(56982), UINT16_C(63274), UINT16_C(15446), UINT16_C(61050), UINT16_C( 2615) },
+      UINT8_C( 48),
+      { SIMDE_FLOAT32_C(    93.95), SIMDE_FLOAT32_C(   314.18), SIMDE_FLOAT32_C(   503.00), SIMDE_FLOAT32_C(    55.37) },
+      { UINT16_C(26372), UINT16_C( 8390), UINT16_C(52297), UINT16_C(56982), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { UINT16_C(51266), UINT16_C(64805), UINT16_C(54382), UINT16_C(63735), UINT16_C(21136), UINT16_C(28638), UINT16_C(36520), UINT16_C(12347) },
+      UINT8_C(  7),
+      { SIMDE_FLOAT32_C(   920.88), SIMDE_FLOAT32_C(  -994.26), SIMDE_FLOAT32_C(  -323.54), SIMDE_FLOAT32_C(  -904.30) },
+      { UINT16_C(17510), UINT16_C(50297), UINT16_C(50082), UINT16_C(63735), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { UINT16_C(30743), UINT16_C(65171), UINT16_C(22878), UINT16_C(16018), UINT16_C(50276), UINT16_C( 7629), UINT16_C(57675), UINT16_C(49903) },
+      UINT8_C(154),
+      { SIMDE_FLOAT32_C(    22.82), SIMDE_FLOAT32_C(  -194.57), SIMDE_FLOAT32_C(    55.42), SIMDE_FLOAT32_C(  -363.79) },
+      { UINT16_C(30743), UINT16_C(49987), UINT16_C(22878), UINT16_C(50102), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { UINT16_C(56306), UINT16_C(34670), UINT16_C(39307), UINT16_C(39736), UINT16_C(27703), UINT16_C(62798), UINT16_C(45561), UINT16_C(35799) },
+      UINT8_C( 28),
+      { SIMDE_FLOAT32_C(  -976.09), SIMDE_FLOAT32_C(    77.51), SIMDE_FLOAT32_C(  -839.40), SIMDE_FLOAT32_C(  -134.42) },
+      { UINT16_C(56306), UINT16_C(34670), UINT16_C(50258), UINT16_C(49926), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { UINT16_C(19434), UINT16_C(42128), UINT16_C(29464), UINT16_C(18243), UINT16_C(65132), UINT16_C(46613), UINT16_C(43663), UINT16_C( 8924) },
+      UINT8_C(156),
+      { SIMDE_FLOAT32_C(   -20.38), SIMDE_FLOAT32_C(  -538.81), SIMDE_FLOAT32_C(  -468.58), SIMDE_FLOAT32_C(   755.49) },
+      { UINT16_C(19434), UINT16_C(42128), UINT16_C(50154), UINT16_C(17469), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128bh src = simde_x_mm_castsi128_pbh(simde_mm_loadu_epi16(test_vec[i].src));
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128bh r = simde_mm_mask_cvtneps_pbh(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_u16x8(simde_x_mm_castpbh_si128(r), simde_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m128bh src = simde_x_mm_castsi128_pbh(simde_test_x86_random_u16x8());
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128 a = simde_test_x86_random_f32x4(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__m128bh r = simde_mm_mask_cvtneps_pbh(src, k, a);
+
+    simde_test_x86_write_u16x8(2, simde_x_mm_castpbh_si128(src), SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u16x8(2, simde_x_mm_castpbh_si128(r), SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_cvtneps_pbh (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde_float32 a[8];
+    const uint16_t r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { {      -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(1.00390625),       SIMDE_MATH_INFINITYF,
+         SIMDE_FLOAT32_C(-1.0e-39), SIMDE_FLOAT32_C(1.01171875),            SIMDE_MATH_NANF,    SIMDE_FLOAT32_C(3.4e38) },
+      { UINT16_C(65408), UINT16_C(32768), UINT16_C(16256), UINT16_C(32640), UINT16_C(32768), UINT16_C(16258), UINT16_C(32704), UINT16_C(32640) } },
+    #endif
+    { { SIMDE_FLOAT32_C(  -231.99), SIMDE_FLOAT32_C(   894.10), SIMDE_FLOAT32_C(  -108.18), SIMDE_FLOAT32_C(  -968.87),
+        SIMDE_FLOAT32_C(   300.81), SIMDE_FLOAT32_C(    72.33), SIMDE_FLOAT32_C(  -897.40), SIMDE_FLOAT32_C(    77.54) },
+      { UINT16_C(50024), UINT16_C(17504), UINT16_C(49880), UINT16_C(50290), UINT16_C(17302), UINT16_C(17041), UINT16_C(50272), UINT16_C(17051) } },
+    { { SIMDE_FLOAT32_C(   337.66), SIMDE_FLOAT32_C(  -976.85), SIMDE_FLOAT32_C(   614.19), SIMDE_FLOAT32_C(  -371.64),
+        SIMDE_FLOAT32_C(    41.84), SIMDE_FLOAT32_C(  -339.80), SIMDE_FLOAT32_C(   -20.53), SIMDE_FLOAT32_C(  -279.86) },
+      { UINT16_C(17321), UINT16_C(50292), UINT16_C(17434), UINT16_C(50106), UINT16_C(16935), UINT16_C(50090), UINT16_C(49572), UINT16_C(50060) } },
+    { { SIMDE_FLOAT32_C(  -796.77), SIMDE_FLOAT32_C(  -367.85), SIMDE_FLOAT32_C(  -859.99), SIMDE_FLOAT32_C(   764.82),
+        SIMDE_FLOAT32_C(  -928.19), SIMDE_FLOAT32_C(   974.97), SIMDE_FLOAT32_C(   433.04), SIMDE_FLOAT32_C(  -485.21) },
+      { UINT16_C(50247), UINT16_C(50104), UINT16_C(50263), UINT16_C(17471), UINT16_C(50280), UINT16_C(17524), UINT16_C(17369), UINT16_C(50163) } },
+    { { SIMDE_FLOAT32_C(   380.81), SIMDE_FLOAT32_C(  -303.23), SIMDE_FLOAT32_C(  -494.50), SIMDE_FLOAT32_C(  -395.27),
+        SIMDE_FLOAT32_C(  -602.38), SIMDE_FLOAT32_C(   209.72), SIMDE_FLOAT32_C(   -82.43), SIMDE_FLOAT32_C(  -997.49) },
+      { UINT16_C(17342), UINT16_C(50072), UINT16_C(50167), UINT16_C(50118), UINT16_C(50199), UINT16_C(17234), UINT16_C(49829), UINT16_C(50297) } },
+    { { SIMDE_FLOAT32_C(  -729.42), SIMDE_FLOAT32_C(  -723.75), SIMDE_FLOAT32_C(  -878.06), SIMDE_FLOAT32_C(   920.97),
+        SIMDE_FLOAT32_C(   991.11), SIMDE_FLOAT32_C(   655.20), SIMDE_FLOAT32_C(   715.31), SIMDE_FLOAT32_C(  -452.86) },
+      { UINT16_C(50230), UINT16_C(50229), UINT16_C(50268), UINT16_C(17510), UINT16_C(17528), UINT16_C(17444), UINT16_C(17459), UINT16_C(50146) } },
+    { { SIMDE_FLOAT32_C(  -496.02), SIMDE_FLOAT32_C(   577.06), SIMDE_FLOAT32_C(  -160.59), SIMDE_FLOAT32_C(   440.14),
+        SIMDE_FLOAT32_C(    58.25), SIMDE_FLOAT32_C(   290.65), SIMDE_FLOAT32_C(   681.74), SIMDE_FLOAT32_C(  -484.49) },
+      { UINT16_C(50168), UINT16_C(17424), UINT16_C(49953), UINT16_C(17372), UINT16_C(17001), UINT16_C(17297), UINT16_C(17450), UINT16_C(50162) } },
+    { { SIMDE_FLOAT32_C(  -793.00), SIMDE_FLOAT32_C(  -910.95), SIMDE_FLOAT32_C(  -991.20), SIMDE_FLOAT32_C(   850.35),
+        SIMDE_FLOAT32_C(   282.06), SIMDE_FLOAT32_C(   110.27), SIMDE_FLOAT32_C(   536.69), SIMDE_FLOAT32_C(   767.32) },
+      { UINT16_C(50246), UINT16_C(50276), UINT16_C(50296), UINT16_C(17493), UINT16_C(17293), UINT16_C(17117), UINT16_C(17414), UINT16_C(17472) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde__m128bh r = simde_mm256_cvtneps_pbh(a);
+    simde_test_x86_assert_equal_u16x8(simde_x_mm_castpbh_si128(r), simde_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m256 a = simde_test_x86_random_f32x8(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__m128bh r = simde_mm256_cvtneps_pbh(a);
+
+    simde_test_x86_write_f32x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_u16x8(2, simde_x_mm_castpbh_si128(r), SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_cvtneps_pbh (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde_float32 a[16];
+    const uint16_t r[16];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { {            SIMDE_MATH_NANF,       SIMDE_MATH_INFINITYF,      -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(1.01171875),
+        SIMDE_FLOAT32_C(1.00390625), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(1.01171875), SIMDE_FLOAT32_C(    -0.00),
+                   SIMDE_MATH_NANF,  SIMDE_FLOAT32_C(-1.0e-39),    SIMDE_FLOAT32_C(3.4e38),  SIMDE_FLOAT32_C(-1.0e-39),
+             -SIMDE_MATH_INFINITYF,    SIMDE_FLOAT32_C(3.4e38),       SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(1.00390625) },
+      { UINT16_C(32704), UINT16_C(32640), UINT16_C(65408), UINT16_C(16258), UINT16_C(16256), UINT16_C(32768), UINT16_C(16258), UINT16_C(32768),
+        UINT16_C(32704), UINT16_C(32768), UINT16_C(32640), UINT16_C(32768), UINT16_C(65408), UINT16_C(32640), UINT16_C(32640), UINT16_C(16256) } },
+    #endif
+    { { SIMDE_FLOAT32_C(   226.70), SIMDE_FLOAT32_C(   651.56), SIMDE_FLOAT32_C(  -766.26), SIMDE_FLOAT32_C(     7.88),
+        SIMDE_FLOAT32_C(   689.76), SIMDE_FLOAT32_C(  -790.81), SIMDE_FLOAT32_C(   478.52), SIMDE_FLOAT32_C(  -694.75),
+        SIMDE_FLOAT32_C(  -756.16), SIMDE_FLOAT32_C(   318.22), SIMDE_FLOAT32_C(  -959.37), SIMDE_FLOAT32_C(   569.34),
+        SIMDE_FLOAT32_C(   158.42), SIMDE_FLOAT32_C(  -249.41), SIMDE_FLOAT32_C(   274.33), SIMDE_FLOAT32_C(  -228.36) },
+      { UINT16_C(17251), UINT16_C(17443), UINT16_C(50240), UINT16_C(16636), UINT16_C(17452), UINT16_C(50246), UINT16_C(17391), UINT16_C(50222),
+        UINT16_C(50237), UINT16_C(17311), UINT16_C(50288), UINT16_C(17422), UINT16_C(17182), UINT16_C(50041), UINT16_C(17289), UINT16_C(50020) } },
+    { { SIMDE_FLOAT32_C(    17.05), SIMDE_FLOAT32_C(  -787.16), SIMDE_FLOAT32_C(   227.72), SIMDE_FLOAT32_C(  -433.89),
+        SIMDE_FLOAT32_C(  -916.54), SIMDE_FLOAT32_C(   905.20), SIMDE_FLOAT32_C(   -12.27), SIMDE_FLOAT32_C(  -891.74),
+        SIMDE_FLOAT32_C(   339.61), SIMDE_FLOAT32_C(    65.01), SIMDE_FLOAT32_C(  -300.29), SIMDE_FLOAT32_C(   324.29),
+        SIMDE_FLOAT32_C(  -149.84), SIMDE_FLOAT32_C(   699.06), SIMDE_FLOAT32_C(   869.52), SIMDE_FLOAT32_C(  -544.39) },
+      { UINT16_C(16776), UINT16_C(50245), UINT16_C(17252), UINT16_C(50137), UINT16_C(50277), UINT16_C(17506), UINT16_C(49476), UINT16_C(50271),
+        UINT16_C(17322), UINT16_C(17026), UINT16_C(50070), UINT16_C(17314), UINT16_C(49942), UINT16_C(17455), UINT16_C(17497), UINT16_C(50184) } },
+    { { SIMDE_FLOAT32_C(  -436.86), SIMDE_FLOAT32_C(  -493.16), SIMDE_FLOAT32_C(   249.35), SIMDE_FLOAT32_C(   623.72),
+        SIMDE_FLOAT32_C(   100.42), SIMDE_FLOAT32_C(  -748.70), SIMDE_FLOAT32_C(  -435.28), SIMDE_FLOAT32_C(   777.99),
+        SIMDE_FLOAT32_C(   560.87), SIMDE_FLOAT32_C(  -733.97), SIMDE_FLOAT32_C(   589.41), SIMDE_FLOAT32_C(  -643.33),
+        SIMDE_FLOAT32_C(  -613.00), SIMDE_FLOAT32_C(   653.36), SIMDE_FLOAT32_C(   479.19), SIMDE_FLOAT32_C(  -486.74) },
+      { UINT16_C(50138), UINT16_C(50167), UINT16_C(17273), UINT16_C(17436), UINT16_C(17097), UINT16_C(50235), UINT16_C(50138), UINT16_C(17474),
+        UINT16_C(17420), UINT16_C(50231), UINT16_C(17427), UINT16_C(50209), UINT16_C(50201), UINT16_C(17443), UINT16_C(17392), UINT16_C(50163) } },
+    { { SIMDE_FLOAT32_C(  -450.88), SIMDE_FLOAT32_C(    68.86), SIMDE_FLOAT32_C(   -48.42), SIMDE_FLOAT32_C(  -575.94),
+        SIMDE_FLOAT32_C(  -429.96), SIMDE_FLOAT32_C(    37.97), SIMDE_FLOAT32_C(   958.44), SIMDE_FLOAT32_C(   -56.42),
+        SIMDE_FLOAT32_C(  -366.65), SIMDE_FLOAT32_C(   702.69), SIMDE_FLOAT32_C(   481.32), SIMDE_FLOAT32_C(   361.36),
+        SIMDE_FLOAT32_C(    66.99), SIMDE_FLOAT32_C(    51.80), SIMDE_FLOAT32_C(  -266.30), SIMDE_FLOAT32_C(   971.41) },
+      { UINT16_C(50145), UINT16_C(17034), UINT16_C(49730), UINT16_C(50192), UINT16_C(50135), UINT16_C(16920), UINT16_C(17520), UINT16_C(49762),
+        UINT16_C(50103), UINT16_C(17456), UINT16_C(17393), UINT16_C(17333), UINT16_C(17030), UINT16_C(16975), UINT16_C(50053), UINT16_C(17523) } },
+    { { SIMDE_FLOAT32_C(   196.57), SIMDE_FLOAT32_C(   677.94), SIMDE_FLOAT32_C(   850.25), SIMDE_FLOAT32_C(   315.87),
+        SIMDE_FLOAT32_C(  -296.29), SIMDE_FLOAT32_C(   386.58), SIMDE_FLOAT32_C(   496.27), SIMDE_FLOAT32_C(   527.49),
+        SIMDE_FLOAT32_C(   654.04), SIMDE_FLOAT32_C(   766.59), SIMDE_FLOAT32_C(   250.08), SIMDE_FLOAT32_C(   256.07),
+        SIMDE_FLOAT32_C(  -223.71), SIMDE_FLOAT32_C(  -268.55), SIMDE_FLOAT32_C(   690.80), SIMDE_FLOAT32_C(   138.09) },
+      { UINT16_C(17221), UINT16_C(17449), UINT16_C(17493), UINT16_C(17310), UINT16_C(50068), UINT16_C(17345), UINT16_C(17400), UINT16_C(17412),
+        UINT16_C(17444), UINT16_C(17472), UINT16_C(17274), UINT16_C(17280), UINT16_C(50016), UINT16_C(50054), UINT16_C(17453), UINT16_C(17162) } },
+    { { SIMDE_FLOAT32_C(   578.68), SIMDE_FLOAT32_C(   804.88), SIMDE_FLOAT32_C(    15.42), SIMDE_FLOAT32_C(  -467.95),
+        SIMDE_FLOAT32_C(   791.91), SIMDE_FLOAT32_C(   581.16), SIMDE_FLOAT32_C(  -223.03), SIMDE_FLOAT32_C(     4.07),
+        SIMDE_FLOAT32_C(  -635.31), SIMDE_FLOAT32_C(  -162.06), SIMDE_FLOAT32_C(   739.08), SIMDE_FLOAT32_C(   876.86),
+        SIMDE_FLOAT32_C(  -408.97), SIMDE_FLOAT32_C(   738.88), SIMDE_FLOAT32_C(   932.77), SIMDE_FLOAT32_C(   988.28) },
+      { UINT16_C(17425), UINT16_C(17481), UINT16_C(16759), UINT16_C(50154), UINT16_C(17478), UINT16_C(17425), UINT16_C(50015), UINT16_C(16514),
+        UINT16_C(50207), UINT16_C(49954), UINT16_C(17465), UINT16_C(17499), UINT16_C(50124), UINT16_C(17465), UINT16_C(17513), UINT16_C(17527) } },
+    { { SIMDE_FLOAT32_C(  -176.88), SIMDE_FLOAT32_C(  -613.11), SIMDE_FLOAT32_C(  -642.89), SIMDE_FLOAT32_C(  -713.62),
+        SIMDE_FLOAT32_C(   427.24), SIMDE_FLOAT32_C(   150.67), SIMDE_FLOAT32_C(   669.77), SIMDE_FLOAT32_C(   830.56),
+        SIMDE_FLOAT32_C(  -722.65), SIMDE_FLOAT32_C(  -328.21), SIMDE_FLOAT32_C(   941.39), SIMDE_FLOAT32_C(   486.05),
+        SIMDE_FLOAT32_C(    12.74), SIMDE_FLOAT32_C(   249.96), SIMDE_FLOAT32_C(   -78.70), SIMDE_FLOAT32_C(  -135.90) },
+      { UINT16_C(49969), UINT16_C(50201), UINT16_C(50209), UINT16_C(50226), UINT16_C(17366), UINT16_C(17175), UINT16_C(17447), UINT16_C(17488),
+        UINT16_C(50229), UINT16_C(50084), UINT16_C(17515), UINT16_C(17395), UINT16_C(16716), UINT16_C(17274), UINT16_C(49821), UINT16_C(49928) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m256bh r = simde_mm512_cvtneps_pbh(a);
+    simde_test_x86_assert_equal_u16x16(simde_x_mm256_castpbh_si256(r), simde_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m512 a = simde_test_x86_random_f32x16(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__m256bh r = simde_mm512_cvtneps_pbh(a);
+
+    simde_test_x86_write_f32x16(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_u16x16(2, simde_x_mm256_castpbh_si256(r), SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_mask_cvtneps_pbh (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint16_t src[16];
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const uint16_t r[16];
+  } test_vec[] = {
+    { { UINT16_C(17231), UINT16_C(44328), UINT16_C( 9999), UINT16_C(22865), UINT16_C(10094), UINT16_C( 7329), UINT16_C(13205), UINT16_C(44589),
+        UINT16_C(61990), UINT16_C(36458), UINT16_C( 2878), UINT16_C( 8749), UINT16_C(30780), UINT16_C(34468), UINT16_C(14497), UINT16_C(61431) },
+      UINT16_C(44990),
+      { SIMDE_FLOAT32_C(  -388.48), SIMDE_FLOAT32_C(   407.83), SIMDE_FLOAT32_C(   524.53), SIMDE_FLOAT32_C(  -937.18),
+        SIMDE_FLOAT32_C(   666.01), SIMDE_FLOAT32_C(   476.74), SIMDE_FLOAT32_C(    -5.32), SIMDE_FLOAT32_C(   -73.22),
+        SIMDE_FLOAT32_C(  -602.64), SIMDE_FLOAT32_C(  -169.91), SIMDE_FLOAT32_C(   285.80), SIMDE_FLOAT32_C(  -245.77),
+        SIMDE_FLOAT32_C(  -834.79), SIMDE_FLOAT32_C(  -264.26), SIMDE_FLOAT32_C(  -275.74), SIMDE_FLOAT32_C(  -248.65) },
+      { UINT16_C(17231), UINT16_C(17356), UINT16_C(17411), UINT16_C(50282), UINT16_C(17447), UINT16_C(17390), UINT16_C(13205), UINT16_C(49810),
+        UINT16_C(50199), UINT16_C(49962), UINT16_C(17295), UINT16_C(50038), UINT16_C(30780), UINT16_C(50052), UINT16_C(14497), UINT16_C(50041) } },
+    { { UINT16_C( 1092), UINT16_C(33734), UINT16_C(34443), UINT16_C(11905), UINT16_C(64663), UINT16_C(16468), UINT16_C(49841), UINT16_C(51030),
+        UINT16_C(18291), UINT16_C(45500), UINT16_C(48922), UINT16_C(58646), UINT16_C(21170), UINT16_C(41551), UINT16_C(15867), UINT16_C(11382) },
+      UINT16_C(57137),
+      { SIMDE_FLOAT32_C(  -841.39), SIMDE_FLOAT32_C(   735.58), SIMDE_FLOAT32_C(    36.85), SIMDE_FLOAT32_C(   677.58),
+        SIMDE_FLOAT32_C(   822.23), SIMDE_FLOAT32_C(  -216.24), SIMDE_FLOAT32_C(  -576.78), SIMDE_FLOAT32_C(   250.76),
+        SIMDE_FLOAT32_C(   601.68), SIMDE_FLOAT32_C(   175.87), SIMDE_FLOAT32_C(  -692.18), SIMDE_FLOAT32_C(  -271.30),
+        SIMDE_FLOAT32_C(   209.65), SIMDE_FLOAT32_C(   954.72), SIMDE_FLOAT32_C(   775.08), SIMDE_FLOAT32_C(  -810.73) },
+      { UINT16_C(50258), UINT16_C(33734), UINT16_C(34443), UINT16_C(11905), UINT16_C(17486), UINT16_C(50008), UINT16_C(49841), UINT16_C(51030),
+        UINT16_C(17430), UINT16_C(17200), UINT16_C(50221), UINT16_C(50056), UINT16_C(17234), UINT16_C(41551), UINT16_C(17474), UINT16_C(50251) } },
+    { { UINT16_C(41952), UINT16_C( 5490), UINT16_C(63088), UINT16_C(56277), UINT16_C(10370), UINT16_C(23838), UINT16_C(  826), UINT16_C(58749),
+        UINT16_C(53475), UINT16_C(55394), UINT16_C(65053), UINT16_C(38686), UINT16_C(26960), UINT16_C(54371), UINT16_C(38112), UINT16_C(28715) },
+      UINT16_C(62729),
+      { SIMDE_FLOAT32_C(     7.88), SIMDE_FLOAT32_C(   202.97), SIMDE_FLOAT32_C(  -415.85), SIMDE_FLOAT32_C(  -101.89),
+        SIMDE_FLOAT32_C(   247.54), SIMDE_FLOAT32_C(  -720.12), SIMDE_FLOAT32_C(   477.98), SIMDE_FLOAT32_C(   276.81),
+        SIMDE_FLOAT32_C(   616.93), SIMDE_FLOAT32_C(   434.96), SIMDE_FLOAT32_C(  -326.67), SIMDE_FLOAT32_C(   -72.62),
+        SIMDE_FLOAT32_C(   -32.58), SIMDE_FLOAT32_C(  -448.36), SIMDE_FLOAT32_C(  -648.12), SIMDE_FLOAT32_C(  -702.94) },
+      { UINT16_C(16636), UINT16_C( 5490), UINT16_C(63088), UINT16_C(49868), UINT16_C(10370), UINT16_C(23838), UINT16_C(  826), UINT16_C(58749),
+        UINT16_C(17434), UINT16_C(55394), UINT16_C(50083), UINT16_C(38686), UINT16_C(49666), UINT16_C(50144), UINT16_C(50210), UINT16_C(50224) } },
+    { { UINT16_C(16561), UINT16_C(56948), UINT16_C(26251), UINT16_C(26391), UINT16_C(54193), UINT16_C(44746), UINT16_C(25039), UINT16_C(40706),
+        UINT16_C(61587), UINT16_C(22608), UINT16_C(46667), UINT16_C(26800), UINT16_C( 6337), UINT16_C( 4269), UINT16_C(58445), UINT16_C(38942) },
+      UINT16_C(40179),
+      { SIMDE_FLOAT32_C(  -877.15), SIMDE_FLOAT32_C(  -440.82), SIMDE_FLOAT32_C(    -2.19), SIMDE_FLOAT32_C(   286.81),
+        SIMDE_FLOAT32_C(   944.04), SIMDE_FLOAT32_C(  -683.46), SIMDE_FLOAT32_C(    22.44), SIMDE_FLOAT32_C(  -668.96),
+        SIMDE_FLOAT32_C(   357.63), SIMDE_FLOAT32_C(  -880.23), SIMDE_FLOAT32_C(  -791.57), SIMDE_FLOAT32_C(  -454.86),
+        SIMDE_FLOAT32_C(   426.32), SIMDE_FLOAT32_C(   508.64), SIMDE_FLOAT32_C(  -445.22), SIMDE_FLOAT32_C(  -894.11) },
+      { UINT16_C(50267), UINT16_C(50140), UINT16_C(26251), UINT16_C(26391), UINT16_C(17516), UINT16_C(50219), UINT16_C(16820), UINT16_C(50215),
+        UINT16_C(61587), UINT16_C(22608), UINT16_C(50246), UINT16_C(50147), UINT16_C(17365), UINT16_C( 4269), UINT16_C(58445), UINT16_C(50272) } },
+    { { UINT16_C(36616), UINT16_C(57096), UINT16_C(57757), UINT16_C(17428), UINT16_C( 3706), UINT16_C(58594), UINT16_C(31631), UINT16_C( 3037),
+        UINT16_C(48929), UINT16_C(42832), UINT16_C(26669), UINT16_C(33831), UINT16_C(12935), UINT16_C(42428), UINT16_C( 7846), UINT16_C(54536) },
+      UINT16_C(13609),
+      { SIMDE_FLOAT32_C(  -678.11), SIMDE_FLOAT32_C(   -50.39), SIMDE_FLOAT32_C(  -200.47), SIMDE_FLOAT32_C(    -3.48),
+        SIMDE_FLOAT32_C(  -850.59), SIMDE_FLOAT32_C(  -653.28), SIMDE_FLOAT32_C(   698.50), SIMDE_FLOAT32_C(   727.20),
+        SIMDE_FLOAT32_C(   -96.93), SIMDE_FLOAT32_C(   119.66), SIMDE_FLOAT32_C(  -689.63), SIMDE_FLOAT32_C(  -688.51),
+        SIMDE_FLOAT32_C(  -374.78), SIMDE_FLOAT32_C(   980.66), SIMDE_FLOAT32_C(  -846.77), SIMDE_FLOAT32_C(    24.33) },
+      { UINT16_C(50218), UINT16_C(57096), UINT16_C(57757), UINT16_C(49247), UINT16_C( 3706), UINT16_C(50211), UINT16_C(31631), UINT16_C( 3037),
+        UINT16_C(49858), UINT16_C(42832), UINT16_C(50220), UINT16_C(33831), UINT16_C(50107), UINT16_C(17525), UINT16_C( 7846), UINT16_C(54536) } },
+    { { UINT16_C(32889), UINT16_C(48785), UINT16_C(43080), UINT16_C( 3834), UINT16_C(26723), UINT16_C( 5420), UINT16_C(46370), UINT16_C( 3744),
+        UINT16_C(41480), UINT16_C( 3938), UINT16_C(31507), UINT16_C(25209), UINT16_C(50838), UINT16_C(22637), UINT16_C(35536), UINT16_C(37367) },
+      UINT16_C(54648),
+      { SIMDE_FLOAT32_C(   554.90), SIMDE_FLOAT32_C(   105.43), SIMDE_FLOAT32_C(    63.76), SIMDE_FLOAT32_C(  -255.19),
+        SIMDE_FLOAT32_C(  -546.74), SIMDE_FLOAT32_C(  -577.20), SIMDE_FLOAT32_C(   -35.44), SIMDE_FLOAT32_C(   -59.52),
+        SIMDE_FLOAT32_C(   903.37), SIMDE_FLOAT32_C(  -719.98), SIMDE_FLOAT32_C(   355.09), SIMDE_FLOAT32_C(  -658.39),
+        SIMDE_FLOAT32_C(  -350.17), SIMDE_FLOAT32_C(   334.40), SIMDE_FLOAT32_C(   124.81), SIMDE_FLOAT32_C(  -879.26) },
+      { UINT16_C(32889), UINT16_C(48785), UINT16_C(43080), UINT16_C(50047), UINT16_C(50185), UINT16_C(50192), UINT16_C(49678), UINT16_C( 3744),
+        UINT16_C(17506), UINT16_C( 3938), UINT16_C(17330), UINT16_C(25209), UINT16_C(50095), UINT16_C(22637), UINT16_C(17146), UINT16_C(50268) } },
+    { { UINT16_C(32577), UINT16_C(45333), UINT16_C(32708), UINT16_C(62134), UINT16_C( 9007), UINT16_C( 8480), UINT16_C(46551), UINT16_C( 2237),
+        UINT16_C(32585), UINT16_C(54838), UINT16_C(19505), UINT16_C(13709), UINT16_C(55086), UINT16_C(49027), UINT16_C(39053), UINT16_C(24740) },
+      UINT16_C(18598),
+      { SIMDE_FLOAT32_C(  -813.93), SIMDE_FLOAT32_C(   862.72), SIMDE_FLOAT32_C(  -721.54), SIMDE_FLOAT32_C(  -847.90),
+        SIMDE_FLOAT32_C(   337.06), SIMDE_FLOAT32_C(   434.43), SIMDE_FLOAT32_C(  -397.81), SIMDE_FLOAT32_C(     7.09),
+        SIMDE_FLOAT32_C(   404.79), SIMDE_FLOAT32_C(   974.65), SIMDE_FLOAT32_C(  -915.96), SIMDE_FLOAT32_C(    26.34),
+        SIMDE_FLOAT32_C(   532.76), SIMDE_FLOAT32_C(  -324.57), SIMDE_FLOAT32_C(   774.41), SIMDE_FLOAT32_C(  -943.97) },
+      { UINT16_C(32577), UINT16_C(17496), UINT16_C(50228), UINT16_C(62134), UINT16_C( 9007), UINT16_C(17369), UINT16_C(46551), UINT16_C(16611),
+        UINT16_C(32585), UINT16_C(54838), UINT16_C(19505), UINT16_C(16851), UINT16_C(55086), UINT16_C(49027), UINT16_C(17474), UINT16_C(24740) } },
+    { { UINT16_C( 9500), UINT16_C( 5057), UINT16_C(64970), UINT16_C(18397), UINT16_C(47942), UINT16_C(62708), UINT16_C(52007), UINT16_C(29603),
+        UINT16_C(36426), UINT16_C(63306), UINT16_C( 6990), UINT16_C(53350), UINT16_C(11720), UINT16_C(15879), UINT16_C( 3565), UINT16_C(20950) },
+      UINT16_C(60668),
+      { SIMDE_FLOAT32_C(   518.64), SIMDE_FLOAT32_C(  -514.34), SIMDE_FLOAT32_C(  -241.50), SIMDE_FLOAT32_C(   679.86),
+        SIMDE_FLOAT32_C(   246.93), SIMDE_FLOAT32_C(  -964.66), SIMDE_FLOAT32_C(  -408.99), SIMDE_FLOAT32_C(   -89.59),
+        SIMDE_FLOAT32_C(  -258.43), SIMDE_FLOAT32_C(  -286.60), SIMDE_FLOAT32_C(   858.83), SIMDE_FLOAT32_C(   112.14),
+        SIMDE_FLOAT32_C(  -388.51), SIMDE_FLOAT32_C(  -963.65), SIMDE_FLOAT32_C(  -959.87), SIMDE_FLOAT32_C(  -680.73) },
+      { UINT16_C( 9500), UINT16_C( 5057), UINT16_C(50034), UINT16_C(17450), UINT16_C(17271), UINT16_C(50289), UINT16_C(50124), UINT16_C(49843),
+        UINT16_C(36426), UINT16_C(63306), UINT16_C(17495), UINT16_C(17120), UINT16_C(11720), UINT16_C(50289), UINT16_C(50288), UINT16_C(50218) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256bh src = simde_x_mm256_castsi256_pbh(simde_mm256_loadu_epi16(test_vec[i].src));
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m256bh r = simde_mm512_mask_cvtneps_pbh(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_u16x16(simde_x_mm256_castpbh_si256(r), simde_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m256bh src = simde_x_mm256_castsi256_pbh(simde_test_x86_random_u16x16());
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m512 a = simde_test_x86_random_f32x16(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__m256bh r = simde_mm512_mask_cvtneps_pbh(src, k, a);
+
+    simde_test_x86_write_u16x16(2, simde_x_mm256_castpbh_si256(src), SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u16x16(2, simde_x_mm256_castpbh_si256(r), SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_maskz_cvtneps_pbh (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const uint16_t r[16];
+  } test_vec[] = {
+    { UINT16_C(61658),
+      { SIMDE_FLOAT32_C(  -855.57), SIMDE_FLOAT32_C(   738.12), SIMDE_FLOAT32_C(  -645.40), SIMDE_FLOAT32_C(  -501.65),
+        SIMDE_FLOAT32_C(  -423.58), SIMDE_FLOAT32_C(    95.96), SIMDE_FLOAT32_C(  -548.92), SIMDE_FLOAT32_C(   480.10),
+        SIMDE_FLOAT32_C(   345.53), SIMDE_FLOAT32_C(  -852.52), SIMDE_FLOAT32_C(  -598.88), SIMDE_FLOAT32_C(  -534.92),
+        SIMDE_FLOAT32_C(  -565.45), SIMDE_FLOAT32_C(   415.19), SIMDE_FLOAT32_C(   837.45), SIMDE_FLOAT32_C(   254.73) },
+      { UINT16_C(    0), UINT16_C(17465), UINT16_C(    0), UINT16_C(50171), UINT16_C(50132), UINT16_C(    0), UINT16_C(50185), UINT16_C(17392),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(50189), UINT16_C(17360), UINT16_C(17489), UINT16_C(17279) } },
+    { UINT16_C(46315),
+      { SIMDE_FLOAT32_C(   933.07), SIMDE_FLOAT32_C(   986.86), SIMDE_FLOAT32_C(   388.98), SIMDE_FLOAT32_C(   570.30),
+        SIMDE_FLOAT32_C(   590.37), SIMDE_FLOAT32_C(   155.12), SIMDE_FLOAT32_C(   998.59), SIMDE_FLOAT32_C(  -934.67),
+        SIMDE_FLOAT32_C(   352.59), SIMDE_FLOAT32_C(  -824.09), SIMDE_FLOAT32_C(  -833.77), SIMDE_FLOAT32_C(  -489.11),
+        SIMDE_FLOAT32_C(   345.70), SIMDE_FLOAT32_C(  -409.36), SIMDE_FLOAT32_C(  -553.66), SIMDE_FLOAT32_C(  -715.54) },
+      { UINT16_C(17513), UINT16_C(17527), UINT16_C(    0), UINT16_C(17423), UINT16_C(    0), UINT16_C(17179), UINT16_C(17530), UINT16_C(50282),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(50256), UINT16_C(    0), UINT16_C(17325), UINT16_C(50125), UINT16_C(    0), UINT16_C(50227) } },
+    { UINT16_C(63917),
+      { SIMDE_FLOAT32_C(   501.91), SIMDE_FLOAT32_C(   306.52), SIMDE_FLOAT32_C(  -816.56), SIMDE_FLOAT32_C(  -746.84),
+        SIMDE_FLOAT32_C(  -126.41), SIMDE_FLOAT32_C(   332.70), SIMDE_FLOAT32_C(   -92.70), SIMDE_FLOAT32_C(  -371.87),
+        SIMDE_FLOAT32_C(  -768.83), SIMDE_FLOAT32_C(  -364.94), SIMDE_FLOAT32_C(  -199.00), SIMDE_FLOAT32_C(   970.09),
+        SIMDE_FLOAT32_C(   812.12), SIMDE_FLOAT32_C(   637.26), SIMDE_FLOAT32_C(  -752.88), SIMDE_FLOAT32_C(  -944.23) },
+      { UINT16_C(17403), UINT16_C(    0), UINT16_C(50252), UINT16_C(50235), UINT16_C(    0), UINT16_C(17318), UINT16_C(    0), UINT16_C(50106),
+        UINT16_C(50240), UINT16_C(    0), UINT16_C(    0), UINT16_C(17523), UINT16_C(17483), UINT16_C(17439), UINT16_C(50236), UINT16_C(50284) } },
+    { UINT16_C(10398),
+      { SIMDE_FLOAT32_C(   651.58), SIMDE_FLOAT32_C(   240.03), SIMDE_FLOAT32_C(  -925.05), SIMDE_FLOAT32_C(   135.23),
+        SIMDE_FLOAT32_C(  -799.10), SIMDE_FLOAT32_C(   420.10), SIMDE_FLOAT32_C(   900.80), SIMDE_FLOAT32_C(  -832.44),
+        SIMDE_FLOAT32_C(  -800.36), SIMDE_FLOAT32_C(   538.00), SIMDE_FLOAT32_C(   677.19), SIMDE_FLOAT32_C(   775.98),
+        SIMDE_FLOAT32_C(  -850.75), SIMDE_FLOAT32_C(  -178.11), SIMDE_FLOAT32_C(   769.93), SIMDE_FLOAT32_C(   595.69) },
+      { UINT16_C(    0), UINT16_C(17264), UINT16_C(50279), UINT16_C(17159), UINT16_C(50248), UINT16_C(    0), UINT16_C(    0), UINT16_C(50256),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(17474), UINT16_C(    0), UINT16_C(49970), UINT16_C(    0), UINT16_C(    0) } },
+    { UINT16_C(56397),
+      { SIMDE_FLOAT32_C(   893.51), SIMDE_FLOAT32_C(   -93.32), SIMDE_FLOAT32_C(   -22.24), SIMDE_FLOAT32_C(  -321.53),
+        SIMDE_FLOAT32_C(   200.71), SIMDE_FLOAT32_C(  -916.02), SIMDE_FLOAT32_C(   859.81), SIMDE_FLOAT32_C(  -527.89),
+        SIMDE_FLOAT32_C(  -130.66), SIMDE_FLOAT32_C(   474.21), SIMDE_FLOAT32_C(  -878.76), SIMDE_FLOAT32_C(  -985.71),
+        SIMDE_FLOAT32_C(   753.92), SIMDE_FLOAT32_C(  -122.86), SIMDE_FLOAT32_C(  -966.94), SIMDE_FLOAT32_C(  -782.27) },
+      { UINT16_C(17503), UINT16_C(    0), UINT16_C(49586), UINT16_C(50081), UINT16_C(    0), UINT16_C(    0), UINT16_C(17495), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(50268), UINT16_C(50294), UINT16_C(17468), UINT16_C(    0), UINT16_C(50290), UINT16_C(50244) } },
+    { UINT16_C(45656),
+      { SIMDE_FLOAT32_C(   827.80), SIMDE_FLOAT32_C(  -119.81), SIMDE_FLOAT32_C(   757.50), SIMDE_FLOAT32_C(   432.44),
+        SIMDE_FLOAT32_C(   789.19), SIMDE_FLOAT32_C(   198.91), SIMDE_FLOAT32_C(   440.66), SIMDE_FLOAT32_C(   833.89),
+        SIMDE_FLOAT32_C(   569.22), SIMDE_FLOAT32_C(    55.65), SIMDE_FLOAT32_C(   655.42), SIMDE_FLOAT32_C(   491.28),
+        SIMDE_FLOAT32_C(  -728.18), SIMDE_FLOAT32_C(   545.60), SIMDE_FLOAT32_C(  -951.80), SIMDE_FLOAT32_C(   702.81) },
+      { UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(17368), UINT16_C(17477), UINT16_C(    0), UINT16_C(17372), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(16991), UINT16_C(    0), UINT16_C(    0), UINT16_C(50230), UINT16_C(17416), UINT16_C(    0), UINT16_C(17456) } },
+    { UINT16_C(61461),
+      { SIMDE_FLOAT32_C(  -341.35), SIMDE_FLOAT32_C(   715.82), SIMDE_FLOAT32_C(    -4.40), SIMDE_FLOAT32_C(  -711.17),
+        SIMDE_FLOAT32_C(   706.64), SIMDE_FLOAT32_C(    18.53), SIMDE_FLOAT32_C(  -295.93), SIMDE_FLOAT32_C(   758.71),
+        SIMDE_FLOAT32_C(  -833.24), SIMDE_FLOAT32_C(  -741.50), SIMDE_FLOAT32_C(   936.52), SIMDE_FLOAT32_C(   970.59),
+        SIMDE_FLOAT32_C(  -740.79), SIMDE_FLOAT32_C(   755.20), SIMDE_FLOAT32_C(   851.28), SIMDE_FLOAT32_C(   350.21) },
+      { UINT16_C(50091), UINT16_C(    0), UINT16_C(49293), UINT16_C(    0), UINT16_C(17457), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+        UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(50233), UINT16_C(17469), UINT16_C(17493), UINT16_C(17327) } },
+    { UINT16_C(65532),
+      { SIMDE_FLOAT32_C(  -235.24), SIMDE_FLOAT32_C(  -145.33), SIMDE_FLOAT32_C(   980.96), SIMDE_FLOAT32_C(   -79.00),
+        SIMDE_FLOAT32_C(   -81.19), SIMDE_FLOAT32_C(  -102.21), SIMDE_FLOAT32_C(   121.01), SIMDE_FLOAT32_C(  -475.86),
+        SIMDE_FLOAT32_C(   102.26), SIMDE_FLOAT32_C(   995.75), SIMDE_FLOAT32_C(     2.96), SIMDE_FLOAT32_C(   758.66),
+        SIMDE_FLOAT32_C(  -158.77), SIMDE_FLOAT32_C(    73.00), SIMDE_FLOAT32_C(   624.12), SIMDE_FLOAT32_C(  -225.93) },
+      { UINT16_C(    0), UINT16_C(    0), UINT16_C(17525), UINT16_C(49822), UINT16_C(49826), UINT16_C(49868), UINT16_C(17138), UINT16_C(50158),
+        UINT16_C(17101), UINT16_C(17529), UINT16_C(16445), UINT16_C(17470), UINT16_C(49951), UINT16_C(17042), UINT16_C(17436), UINT16_C(50018) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m256bh r = simde_mm512_maskz_cvtneps_pbh(test_vec[i].k, a);
+    simde_test_x86_assert_equal_u16x16(simde_x_mm256_castpbh_si256(r), simde_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m512 a = simde_test_x86_random_f32x16(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__m256bh r = simde_mm512_maskz_cvtneps_pbh(k, a);
+
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u16x16(2, simde_x_mm256_castpbh_si256(r), SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_cvtpbh_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint16_t a[8];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { UINT16_C(49024), UINT16_C(65473), UINT16_C(    0), UINT16_C(    0), UINT16_C(32704), UINT16_C(32640), UINT16_C(    0), UINT16_C(49024) },
+      { SIMDE_FLOAT32_C(    -1.00),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    #endif
+    { { UINT16_C(17313), UINT16_C(17329), UINT16_C(17229), UINT16_C(49956), UINT16_C(17205), UINT16_C(17290), UINT16_C(50182), UINT16_C(17324) },
+      { SIMDE_FLOAT32_C(   322.00), SIMDE_FLOAT32_C(   354.00), SIMDE_FLOAT32_C(   205.00), SIMDE_FLOAT32_C(  -164.00) } },
+    { { UINT16_C(17489), UINT16_C(17497), UINT16_C(17397), UINT16_C(17528), UINT16_C(17381), UINT16_C(17403), UINT16_C(50275), UINT16_C(17473) },
+      { SIMDE_FLOAT32_C(   836.00), SIMDE_FLOAT32_C(   868.00), SIMDE_FLOAT32_C(   490.00), SIMDE_FLOAT32_C(   992.00) } },
+    { { UINT16_C(50155), UINT16_C(17157), UINT16_C(17406), UINT16_C(17277), UINT16_C(17453), UINT16_C(50154), UINT16_C(17501), UINT16_C(17348) },
+      { SIMDE_FLOAT32_C(  -470.00), SIMDE_FLOAT32_C(   133.00), SIMDE_FLOAT32_C(   508.00), SIMDE_FLOAT32_C(   253.00) } },
+    { { UINT16_C(50292), UINT16_C(17443), UINT16_C(50197), UINT16_C(17529), UINT16_C(50241), UINT16_C(17488), UINT16_C(17237), UINT16_C(17192) },
+      { SIMDE_FLOAT32_C(  -976.00), SIMDE_FLOAT32_C(   652.00), SIMDE_FLOAT32_C(  -596.00), SIMDE_FLOAT32_C(   996.00) } },
+    { { UINT16_C(50239), UINT16_C(50269), UINT16_C(16956), UINT16_C(50209), UINT16_C(49799), UINT16_C(17445), UINT16_C(17487), UINT16_C(17424) },
+      { SIMDE_FLOAT32_C(  -764.00), SIMDE_FLOAT32_C(  -884.00), SIMDE_FLOAT32_C(    47.00), SIMDE_FLOAT32_C(  -644.00) } },
+    { { UINT16_C(50042), UINT16_C(17495), UINT16_C(49474), UINT16_C(17397), UINT16_C(17337), UINT16_C(49992), UINT16_C(17033), UINT16_C(50104) },
+      { SIMDE_FLOAT32_C(  -250.00), SIMDE_FLOAT32_C(   860.00), SIMDE_FLOAT32_C(   -12.12), SIMDE_FLOAT32_C(   490.00) } },
+    { { UINT16_C(17481), UINT16_C(50270), UINT16_C(49936), UINT16_C(50282), UINT16_C(49985), UINT16_C(17485), UINT16_C(17506), UINT16_C(50278) },
+      { SIMDE_FLOAT32_C(   804.00), SIMDE_FLOAT32_C(  -888.00), SIMDE_FLOAT32_C(  -144.00), SIMDE_FLOAT32_C(  -936.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128bh a = simde_x_mm_castsi128_pbh(simde_mm_loadu_epi16(test_vec[i].a));
+    simde__m128 r = simde_mm_cvtpbh_ps(a);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m128bh a = simde_x_mm_castsi128_pbh(simde_test_x86_random_u16x8());
+    simde__m128 r = simde_mm_cvtpbh_ps(a);
+
+    simde_test_x86_write_u16x8(2, simde_x_mm_castpbh_si128(a), SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST, 1);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_cvtpbh_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint16_t a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { UINT16_C(32704), UINT16_C(65408), UINT16_C(49024), UINT16_C(49024), UINT16_C(65408), UINT16_C(32640), UINT16_C(65473), UINT16_C(16256) },
+      {            SIMDE_MATH_NANF,      -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    -1.00), SIMDE_FLOAT32_C(    -1.00),
+             -SIMDE_MATH_INFINITYF,       SIMDE_MATH_INFINITYF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     1.00) } },
+    #endif
+    { { UINT16_C(17330), UINT16_C(17369), UINT16_C(17407), UINT16_C(49974), UINT16_C(50256), UINT16_C(17520), UINT16_C(17443), UINT16_C(17485) },
+      { SIMDE_FLOAT32_C(   356.00), SIMDE_FLOAT32_C(   434.00), SIMDE_FLOAT32_C(   510.00), SIMDE_FLOAT32_C(  -182.00),
+        SIMDE_FLOAT32_C(  -832.00), SIMDE_FLOAT32_C(   960.00), SIMDE_FLOAT32_C(   652.00), SIMDE_FLOAT32_C(   820.00) } },
+    { { UINT16_C(17443), UINT16_C(17461), UINT16_C(17490), UINT16_C(17362), UINT16_C(49893), UINT16_C(16932), UINT16_C(50281), UINT16_C(50251) },
+      { SIMDE_FLOAT32_C(   652.00), SIMDE_FLOAT32_C(   724.00), SIMDE_FLOAT32_C(   840.00), SIMDE_FLOAT32_C(   420.00),
+        SIMDE_FLOAT32_C(  -114.50), SIMDE_FLOAT32_C(    41.00), SIMDE_FLOAT32_C(  -932.00), SIMDE_FLOAT32_C(  -812.00) } },
+    { { UINT16_C(50014), UINT16_C(49944), UINT16_C(17292), UINT16_C(17526), UINT16_C(17525), UINT16_C(17291), UINT16_C(50166), UINT16_C(17412) },
+      { SIMDE_FLOAT32_C(  -222.00), SIMDE_FLOAT32_C(  -152.00), SIMDE_FLOAT32_C(   280.00), SIMDE_FLOAT32_C(   984.00),
+        SIMDE_FLOAT32_C(   980.00), SIMDE_FLOAT32_C(   278.00), SIMDE_FLOAT32_C(  -492.00), SIMDE_FLOAT32_C(   528.00) } },
+    { { UINT16_C(50121), UINT16_C(17475), UINT16_C(50215), UINT16_C(17431), UINT16_C(17442), UINT16_C(50077), UINT16_C(17358), UINT16_C(17437) },
+      { SIMDE_FLOAT32_C(  -402.00), SIMDE_FLOAT32_C(   780.00), SIMDE_FLOAT32_C(  -668.00), SIMDE_FLOAT32_C(   604.00),
+        SIMDE_FLOAT32_C(   648.00), SIMDE_FLOAT32_C(  -314.00), SIMDE_FLOAT32_C(   412.00), SIMDE_FLOAT32_C(   628.00) } },
+    { { UINT16_C(50153), UINT16_C(17445), UINT16_C(17398), UINT16_C(50134), UINT16_C(16916), UINT16_C(50203), UINT16_C(17361), UINT16_C(50213) },
+      { SIMDE_FLOAT32_C(  -466.00), SIMDE_FLOAT32_C(   660.00), SIMDE_FLOAT32_C(   492.00), SIMDE_FLOAT32_C(  -428.00),
+        SIMDE_FLOAT32_C(    37.00), SIMDE_FLOAT32_C(  -620.00), SIMDE_FLOAT32_C(   418.00), SIMDE_FLOAT32_C(  -660.00) } },
+    { { UINT16_C(50075), UINT16_C(17494), UINT16_C(50186), UINT16_C(17490), UINT16_C(17331), UINT16_C(17529), UINT16_C(50210), UINT16_C(17414) },
+      { SIMDE_FLOAT32_C(  -310.00), SIMDE_FLOAT32_C(   856.00), SIMDE_FLOAT32_C(  -552.00), SIMDE_FLOAT32_C(   840.00),
+        SIMDE_FLOAT32_C(   358.00), SIMDE_FLOAT32_C(   996.00), SIMDE_FLOAT32_C(  -648.00), SIMDE_FLOAT32_C(   536.00) } },
+    { { UINT16_C(17308), UINT16_C(17510), UINT16_C(50259), UINT16_C(17401), UINT16_C(50183), UINT16_C(17457), UINT16_C(17413), UINT16_C(17522) },
+      { SIMDE_FLOAT32_C(   312.00), SIMDE_FLOAT32_C(   920.00), SIMDE_FLOAT32_C(  -844.00), SIMDE_FLOAT32_C(   498.00),
+        SIMDE_FLOAT32_C(  -540.00), SIMDE_FLOAT32_C(   708.00), SIMDE_FLOAT32_C(   532.00), SIMDE_FLOAT32_C(   968.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128bh a = simde_x_mm_castsi128_pbh(simde_mm_loadu_epi16(test_vec[i].a));
+    simde__m256 r = simde_mm256_cvtpbh_ps(a);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m128bh a = simde_x_mm_castsi128_pbh(simde_test_x86_random_u16x8());
+    simde__m256 r = simde_mm256_cvtpbh_ps(a);
+
+    simde_test_x86_write_u16x8(2, simde_x_mm_castpbh_si128(a), SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x8(2, r, SIMDE_TEST_VEC_POS_LAST, 1);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_cvtpbh_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint16_t a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { UINT16_C(49024), UINT16_C(65473), UINT16_C(49024), UINT16_C(32768), UINT16_C(65473), UINT16_C(16256), UINT16_C(49024), UINT16_C(65473),
+        UINT16_C(16256), UINT16_C(65408), UINT16_C(16256), UINT16_C(32768), UINT16_C(65408), UINT16_C(    0), UINT16_C(49024), UINT16_C(32768) },
+      { SIMDE_FLOAT32_C(    -1.00),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    -1.00), SIMDE_FLOAT32_C(    -0.00),
+                   SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(    -1.00),            SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(     1.00),      -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(    -0.00),
+             -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    -1.00), SIMDE_FLOAT32_C(    -0.00) } },
+    #endif
+    { { UINT16_C(49958), UINT16_C(49923), UINT16_C(50272), UINT16_C(50181), UINT16_C(50219), UINT16_C(17300), UINT16_C(17414), UINT16_C(16943),
+        UINT16_C(50201), UINT16_C(50074), UINT16_C(50200), UINT16_C(50078), UINT16_C(17292), UINT16_C(17294), UINT16_C(17413), UINT16_C(49966) },
+      { SIMDE_FLOAT32_C(  -166.00), SIMDE_FLOAT32_C(  -131.00), SIMDE_FLOAT32_C(  -896.00), SIMDE_FLOAT32_C(  -532.00),
+        SIMDE_FLOAT32_C(  -684.00), SIMDE_FLOAT32_C(   296.00), SIMDE_FLOAT32_C(   536.00), SIMDE_FLOAT32_C(    43.75),
+        SIMDE_FLOAT32_C(  -612.00), SIMDE_FLOAT32_C(  -308.00), SIMDE_FLOAT32_C(  -608.00), SIMDE_FLOAT32_C(  -316.00),
+        SIMDE_FLOAT32_C(   280.00), SIMDE_FLOAT32_C(   284.00), SIMDE_FLOAT32_C(   532.00), SIMDE_FLOAT32_C(  -174.00) } },
+    { { UINT16_C(17356), UINT16_C(50068), UINT16_C(49605), UINT16_C(50281), UINT16_C(49949), UINT16_C(50089), UINT16_C(50184), UINT16_C(17447),
+        UINT16_C(17346), UINT16_C(17430), UINT16_C(50281), UINT16_C(17392), UINT16_C(17459), UINT16_C(50281), UINT16_C(17345), UINT16_C(50005) },
+      { SIMDE_FLOAT32_C(   408.00), SIMDE_FLOAT32_C(  -296.00), SIMDE_FLOAT32_C(   -24.62), SIMDE_FLOAT32_C(  -932.00),
+        SIMDE_FLOAT32_C(  -157.00), SIMDE_FLOAT32_C(  -338.00), SIMDE_FLOAT32_C(  -544.00), SIMDE_FLOAT32_C(   668.00),
+        SIMDE_FLOAT32_C(   388.00), SIMDE_FLOAT32_C(   600.00), SIMDE_FLOAT32_C(  -932.00), SIMDE_FLOAT32_C(   480.00),
+        SIMDE_FLOAT32_C(   716.00), SIMDE_FLOAT32_C(  -932.00), SIMDE_FLOAT32_C(   386.00), SIMDE_FLOAT32_C(  -213.00) } },
+    { { UINT16_C(17283), UINT16_C(49991), UINT16_C(50242), UINT16_C(17416), UINT16_C(17504), UINT16_C(17375), UINT16_C(16986), UINT16_C(17306),
+        UINT16_C(50067), UINT16_C(17052), UINT16_C(17427), UINT16_C(50213), UINT16_C(17345), UINT16_C(17487), UINT16_C(49638), UINT16_C(50255) },
+      { SIMDE_FLOAT32_C(   262.00), SIMDE_FLOAT32_C(  -199.00), SIMDE_FLOAT32_C(  -776.00), SIMDE_FLOAT32_C(   544.00),
+        SIMDE_FLOAT32_C(   896.00), SIMDE_FLOAT32_C(   446.00), SIMDE_FLOAT32_C(    54.50), SIMDE_FLOAT32_C(   308.00),
+        SIMDE_FLOAT32_C(  -294.00), SIMDE_FLOAT32_C(    78.00), SIMDE_FLOAT32_C(   588.00), SIMDE_FLOAT32_C(  -660.00),
+        SIMDE_FLOAT32_C(   386.00), SIMDE_FLOAT32_C(   828.00), SIMDE_FLOAT32_C(   -28.75), SIMDE_FLOAT32_C(  -828.00) } },
+    { { UINT16_C(50037), UINT16_C(17521), UINT16_C(49859), UINT16_C(50181), UINT16_C(50269), UINT16_C(50263), UINT16_C(17135), UINT16_C(50275),
+        UINT16_C(17437), UINT16_C(17419), UINT16_C(17518), UINT16_C(50047), UINT16_C(50241), UINT16_C(17080), UINT16_C(50099), UINT16_C(16923) },
+      { SIMDE_FLOAT32_C(  -245.00), SIMDE_FLOAT32_C(   964.00), SIMDE_FLOAT32_C(   -97.50), SIMDE_FLOAT32_C(  -532.00),
+        SIMDE_FLOAT32_C(  -884.00), SIMDE_FLOAT32_C(  -860.00), SIMDE_FLOAT32_C(   119.50), SIMDE_FLOAT32_C(  -908.00),
+        SIMDE_FLOAT32_C(   628.00), SIMDE_FLOAT32_C(   556.00), SIMDE_FLOAT32_C(   952.00), SIMDE_FLOAT32_C(  -255.00),
+        SIMDE_FLOAT32_C(  -772.00), SIMDE_FLOAT32_C(    92.00), SIMDE_FLOAT32_C(  -358.00), SIMDE_FLOAT32_C(    38.75) } },
+    { { UINT16_C(49542), UINT16_C(17434), UINT16_C(49925), UINT16_C(49702), UINT16_C(17378), UINT16_C(16944), UINT16_C(50110), UINT16_C(17510),
+        UINT16_C(50271), UINT16_C(17517), UINT16_C(16836), UINT16_C(50283), UINT16_C(50258), UINT16_C(17382), UINT16_C(50135), UINT16_C(50241) },
+      { SIMDE_FLOAT32_C(   -16.75), SIMDE_FLOAT32_C(   616.00), SIMDE_FLOAT32_C(  -133.00), SIMDE_FLOAT32_C(   -41.50),
+        SIMDE_FLOAT32_C(   452.00), SIMDE_FLOAT32_C(    44.00), SIMDE_FLOAT32_C(  -380.00), SIMDE_FLOAT32_C(   920.00),
+        SIMDE_FLOAT32_C(  -892.00), SIMDE_FLOAT32_C(   948.00), SIMDE_FLOAT32_C(    24.50), SIMDE_FLOAT32_C(  -940.00),
+        SIMDE_FLOAT32_C(  -840.00), SIMDE_FLOAT32_C(   460.00), SIMDE_FLOAT32_C(  -430.00), SIMDE_FLOAT32_C(  -772.00) } },
+    { { UINT16_C(50177), UINT16_C(50177), UINT16_C(50268), UINT16_C(50162), UINT16_C(17483), UINT16_C(17522), UINT16_C(50260), UINT16_C(50117),
+        UINT16_C(17235), UINT16_C(50237), UINT16_C(17500), UINT16_C(50211), UINT16_C(17346), UINT16_C(17442), UINT16_C(50195), UINT16_C(17516) },
+      { SIMDE_FLOAT32_C(  -516.00), SIMDE_FLOAT32_C(  -516.00), SIMDE_FLOAT32_C(  -880.00), SIMDE_FLOAT32_C(  -484.00),
+        SIMDE_FLOAT32_C(   812.00), SIMDE_FLOAT32_C(   968.00), SIMDE_FLOAT32_C(  -848.00), SIMDE_FLOAT32_C(  -394.00),
+        SIMDE_FLOAT32_C(   211.00), SIMDE_FLOAT32_C(  -756.00), SIMDE_FLOAT32_C(   880.00), SIMDE_FLOAT32_C(  -652.00),
+        SIMDE_FLOAT32_C(   388.00), SIMDE_FLOAT32_C(   648.00), SIMDE_FLOAT32_C(  -588.00), SIMDE_FLOAT32_C(   944.00) } },
+    { { UINT16_C(50063), UINT16_C(50003), UINT16_C(17410), UINT16_C(16661), UINT16_C(17468), UINT16_C(50251), UINT16_C(50185), UINT16_C(49591),
+        UINT16_C(50217), UINT16_C(50297), UINT16_C(17435), UINT16_C(17445), UINT16_C(17372), UINT16_C(50213), UINT16_C(50202), UINT16_C(16945) },
+      { SIMDE_FLOAT32_C(  -286.00), SIMDE_FLOAT32_C(  -211.00), SIMDE_FLOAT32_C(   520.00), SIMDE_FLOAT32_C(     9.31),
+        SIMDE_FLOAT32_C(   752.00), SIMDE_FLOAT32_C(  -812.00), SIMDE_FLOAT32_C(  -548.00), SIMDE_FLOAT32_C(   -22.88),
+        SIMDE_FLOAT32_C(  -676.00), SIMDE_FLOAT32_C(  -996.00), SIMDE_FLOAT32_C(   620.00), SIMDE_FLOAT32_C(   660.00),
+        SIMDE_FLOAT32_C(   440.00), SIMDE_FLOAT32_C(  -660.00), SIMDE_FLOAT32_C(  -616.00), SIMDE_FLOAT32_C(    44.25) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256bh a = simde_x_mm256_castsi256_pbh(simde_mm256_loadu_epi16(test_vec[i].a));
+    simde__m512 r = simde_mm512_cvtpbh_ps(a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m256bh a = simde_x_mm256_castsi256_pbh(simde_test_x86_random_u16x16());
+    simde__m512 r = simde_mm512_cvtpbh_ps(a);
+
+    simde_test_x86_write_u16x16(2, simde_x_mm256_castpbh_si256(a), SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x16(2, r, SIMDE_TEST_VEC_POS_LAST, 1);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_mask_cvtpbh_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde_float32 src[16];
+    const simde__mmask16 k;
+    const uint16_t a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -941.85), SIMDE_FLOAT32_C(   376.45), SIMDE_FLOAT32_C(  -608.23), SIMDE_FLOAT32_C(   -46.55),
+        SIMDE_FLOAT32_C(    31.51), SIMDE_FLOAT32_C(  -844.44), SIMDE_FLOAT32_C(   -80.52), SIMDE_FLOAT32_C(  -875.37),
+        SIMDE_FLOAT32_C(   760.01), SIMDE_FLOAT32_C(   124.53), SIMDE_FLOAT32_C(    78.37), SIMDE_FLOAT32_C(  -323.83),
+        SIMDE_FLOAT32_C(   -81.89), SIMDE_FLOAT32_C(   611.34), SIMDE_FLOAT32_C(  -913.15), SIMDE_FLOAT32_C(  -336.67) },
+      UINT16_C(20875),
+      { UINT16_C(17021), UINT16_C(16863), UINT16_C(50292), UINT16_C(17483), UINT16_C(49709), UINT16_C(50232), UINT16_C(17346), UINT16_C(17490),
+        UINT16_C(50208), UINT16_C(17527), UINT16_C(50035), UINT16_C(49966), UINT16_C(50236), UINT16_C(50190), UINT16_C(17518), UINT16_C(50189) },
+      { SIMDE_FLOAT32_C(    63.25), SIMDE_FLOAT32_C(    27.88), SIMDE_FLOAT32_C(  -608.23), SIMDE_FLOAT32_C(   812.00),
+        SIMDE_FLOAT32_C(    31.51), SIMDE_FLOAT32_C(  -844.44), SIMDE_FLOAT32_C(   -80.52), SIMDE_FLOAT32_C(   840.00),
+        SIMDE_FLOAT32_C(  -640.00), SIMDE_FLOAT32_C(   124.53), SIMDE_FLOAT32_C(    78.37), SIMDE_FLOAT32_C(  -323.83),
+        SIMDE_FLOAT32_C(  -752.00), SIMDE_FLOAT32_C(   611.34), SIMDE_FLOAT32_C(   952.00), SIMDE_FLOAT32_C(  -336.67) } },
+    { { SIMDE_FLOAT32_C(  -986.89), SIMDE_FLOAT32_C(  -725.80), SIMDE_FLOAT32_C(   901.58), SIMDE_FLOAT32_C(   893.87),
+        SIMDE_FLOAT32_C(   616.40), SIMDE_FLOAT32_C(   563.18), SIMDE_FLOAT32_C(  -604.87), SIMDE_FLOAT32_C(  -537.63),
+        SIMDE_FLOAT32_C(   212.27), SIMDE_FLOAT32_C(   962.49), SIMDE_FLOAT32_C(  -417.26), SIMDE_FLOAT32_C(  -480.78),
+        SIMDE_FLOAT32_C(  -600.47), SIMDE_FLOAT32_C(  -608.24), SIMDE_FLOAT32_C(     1.22), SIMDE_FLOAT32_C(   767.37) },
+      UINT16_C(12268),
+      { UINT16_C(50121), UINT16_C(17475), UINT16_C(49901), UINT16_C(50243), UINT16_C(50296), UINT16_C(17303), UINT16_C(17474), UINT16_C(17478),
+        UINT16_C(50251), UINT16_C(17123), UINT16_C(50054), UINT16_C(17478), UINT16_C(16883), UINT16_C(17336), UINT16_C(50147), UINT16_C(50206) },
+      { SIMDE_FLOAT32_C(  -986.89), SIMDE_FLOAT32_C(  -725.80), SIMDE_FLOAT32_C(  -118.50), SIMDE_FLOAT32_C(  -780.00),
+        SIMDE_FLOAT32_C(   616.40), SIMDE_FLOAT32_C(   302.00), SIMDE_FLOAT32_C(   776.00), SIMDE_FLOAT32_C(   792.00),
+        SIMDE_FLOAT32_C(  -812.00), SIMDE_FLOAT32_C(   113.50), SIMDE_FLOAT32_C(  -268.00), SIMDE_FLOAT32_C(   792.00),
+        SIMDE_FLOAT32_C(  -600.47), SIMDE_FLOAT32_C(   368.00), SIMDE_FLOAT32_C(     1.22), SIMDE_FLOAT32_C(   767.37) } },
+    { { SIMDE_FLOAT32_C(   -68.67), SIMDE_FLOAT32_C(   -40.39), SIMDE_FLOAT32_C(   929.13), SIMDE_FLOAT32_C(  -578.22),
+        SIMDE_FLOAT32_C(   137.99), SIMDE_FLOAT32_C(   494.64), SIMDE_FLOAT32_C(   671.76), SIMDE_FLOAT32_C(   -18.18),
+        SIMDE_FLOAT32_C(   254.54), SIMDE_FLOAT32_C(  -433.59), SIMDE_FLOAT32_C(  -351.46), SIMDE_FLOAT32_C(    27.69),
+        SIMDE_FLOAT32_C(  -541.76), SIMDE_FLOAT32_C(  -652.37), SIMDE_FLOAT32_C(   892.32), SIMDE_FLOAT32_C(  -924.42) },
+      UINT16_C( 3105),
+      { UINT16_C(17526), UINT16_C(17392), UINT16_C(17499), UINT16_C(50049), UINT16_C(17058), UINT16_C(49959), UINT16_C(17407), UINT16_C(50267),
+        UINT16_C(17363), UINT16_C(17225), UINT16_C(50122), UINT16_C(17419), UINT16_C(50089), UINT16_C(49947), UINT16_C(50097), UINT16_C(17496) },
+      { SIMDE_FLOAT32_C(   984.00), SIMDE_FLOAT32_C(   -40.39), SIMDE_FLOAT32_C(   929.13), SIMDE_FLOAT32_C(  -578.22),
+        SIMDE_FLOAT32_C(   137.99), SIMDE_FLOAT32_C(  -167.00), SIMDE_FLOAT32_C(   671.76), SIMDE_FLOAT32_C(   -18.18),
+        SIMDE_FLOAT32_C(   254.54), SIMDE_FLOAT32_C(  -433.59), SIMDE_FLOAT32_C(  -404.00), SIMDE_FLOAT32_C(   556.00),
+        SIMDE_FLOAT32_C(  -541.76), SIMDE_FLOAT32_C(  -652.37), SIMDE_FLOAT32_C(   892.32), SIMDE_FLOAT32_C(  -924.42) } },
+    { { SIMDE_FLOAT32_C(   861.33), SIMDE_FLOAT32_C(  -484.89), SIMDE_FLOAT32_C(   720.19), SIMDE_FLOAT32_C(   868.08),
+        SIMDE_FLOAT32_C(  -525.31), SIMDE_FLOAT32_C(    59.62), SIMDE_FLOAT32_C(   414.36), SIMDE_FLOAT32_C(   953.10),
+        SIMDE_FLOAT32_C(  -491.54), SIMDE_FLOAT32_C(    -3.14), SIMDE_FLOAT32_C(  -637.03), SIMDE_FLOAT32_C(  -677.30),
+        SIMDE_FLOAT32_C(  -793.32), SIMDE_FLOAT32_C(  -803.13), SIMDE_FLOAT32_C(  -248.35), SIMDE_FLOAT32_C(   878.17) },
+      UINT16_C(62773),
+      { UINT16_C(17080), UINT16_C(17514), UINT16_C(50253), UINT16_C(49915), UINT16_C(17505), UINT16_C(17467), UINT16_C(49922), UINT16_C(49925),
+        UINT16_C(49861), UINT16_C(17311), UINT16_C(50002), UINT16_C(50039), UINT16_C(17338), UINT16_C(50247), UINT16_C(50222), UINT16_C(50100) },
+      { SIMDE_FLOAT32_C(    92.00), SIMDE_FLOAT32_C(  -484.89), SIMDE_FLOAT32_C(  -820.00), SIMDE_FLOAT32_C(   868.08),
+        SIMDE_FLOAT32_C(   900.00), SIMDE_FLOAT32_C(   748.00), SIMDE_FLOAT32_C(   414.36), SIMDE_FLOAT32_C(   953.10),
+        SIMDE_FLOAT32_C(   -98.50), SIMDE_FLOAT32_C(    -3.14), SIMDE_FLOAT32_C(  -210.00), SIMDE_FLOAT32_C(  -677.30),
+        SIMDE_FLOAT32_C(   372.00), SIMDE_FLOAT32_C(  -796.00), SIMDE_FLOAT32_C(  -696.00), SIMDE_FLOAT32_C(  -360.00) } },
+    { { SIMDE_FLOAT32_C(  -717.55), SIMDE_FLOAT32_C(  -714.08), SIMDE_FLOAT32_C(   648.06), SIMDE_FLOAT32_C(  -977.76),
+        SIMDE_FLOAT32_C(   984.87), SIMDE_FLOAT32_C(   152.67), SIMDE_FLOAT32_C(  -531.94), SIMDE_FLOAT32_C(  -747.69),
+        SIMDE_FLOAT32_C(   481.86), SIMDE_FLOAT32_C(   148.72), SIMDE_FLOAT32_C(    65.09), SIMDE_FLOAT32_C(  -826.31),
+        SIMDE_FLOAT32_C(   529.93), SIMDE_FLOAT32_C(  -383.41), SIMDE_FLOAT32_C(   925.47), SIMDE_FLOAT32_C(   875.22) },
+      UINT16_C(57768),
+      { UINT16_C(50236), UINT16_C(50192), UINT16_C(17224), UINT16_C(50160), UINT16_C(17324), UINT16_C(50152), UINT16_C(50289), UINT16_C(17529),
+        UINT16_C(16959), UINT16_C(17389), UINT16_C(17009), UINT16_C(50267), UINT16_C(50050), UINT16_C(50202), UINT16_C(17200), UINT16_C(17446) },
+      { SIMDE_FLOAT32_C(  -717.55), SIMDE_FLOAT32_C(  -714.08), SIMDE_FLOAT32_C(   648.06), SIMDE_FLOAT32_C(  -480.00),
+        SIMDE_FLOAT32_C(   984.87), SIMDE_FLOAT32_C(  -464.00), SIMDE_FLOAT32_C(  -531.94), SIMDE_FLOAT32_C(   996.00),
+        SIMDE_FLOAT32_C(    47.75), SIMDE_FLOAT32_C(   148.72), SIMDE_FLOAT32_C(    65.09), SIMDE_FLOAT32_C(  -826.31),
+        SIMDE_FLOAT32_C(   529.93), SIMDE_FLOAT32_C(  -616.00), SIMDE_FLOAT32_C(   176.00), SIMDE_FLOAT32_C(   664.00) } },
+    { { SIMDE_FLOAT32_C(  -378.29), SIMDE_FLOAT32_C(   553.88), SIMDE_FLOAT32_C(  -588.20), SIMDE_FLOAT32_C(   361.79),
+        SIMDE_FLOAT32_C(  -500.04), SIMDE_FLOAT32_C(   402.71), SIMDE_FLOAT32_C(  -343.84), SIMDE_FLOAT32_C(   637.00),
+        SIMDE_FLOAT32_C(   622.92), SIMDE_FLOAT32_C(   -89.01), SIMDE_FLOAT32_C(  -891.80), SIMDE_FLOAT32_C(    11.09),
+        SIMDE_FLOAT32_C(  -579.80), SIMDE_FLOAT32_C(   656.33), SIMDE_FLOAT32_C(   779.18), SIMDE_FLOAT32_C(   643.93) },
+      UINT16_C(40969),
+      { UINT16_C(17489), UINT16_C(17058), UINT16_C(17433), UINT16_C(17204), UINT16_C(50195), UINT16_C(17288), UINT16_C(50252), UINT16_C(17526),
+        UINT16_C(50066), UINT16_C(17162), UINT16_C(50027), UINT16_C(17463), UINT16_C(50258), UINT16_C(50225), UINT16_C(50271), UINT16_C(17429) },
+      { SIMDE_FLOAT32_C(   836.00), SIMDE_FLOAT32_C(   553.88), SIMDE_FLOAT32_C(  -588.20), SIMDE_FLOAT32_C(   180.00),
+        SIMDE_FLOAT32_C(  -500.04), SIMDE_FLOAT32_C(   402.71), SIMDE_FLOAT32_C(  -343.84), SIMDE_FLOAT32_C(   637.00),
+        SIMDE_FLOAT32_C(   622.92), SIMDE_FLOAT32_C(   -89.01), SIMDE_FLOAT32_C(  -891.80), SIMDE_FLOAT32_C(    11.09),
+        SIMDE_FLOAT32_C(  -579.80), SIMDE_FLOAT32_C(  -708.00), SIMDE_FLOAT32_C(   779.18), SIMDE_FLOAT32_C(   596.00) } },
+    { { SIMDE_FLOAT32_C(   205.74), SIMDE_FLOAT32_C(  -972.61), SIMDE_FLOAT32_C(  -488.30), SIMDE_FLOAT32_C(  -370.53),
+        SIMDE_FLOAT32_C(   259.46), SIMDE_FLOAT32_C(  -410.39), SIMDE_FLOAT32_C(   621.07), SIMDE_FLOAT32_C(   150.79),
+        SIMDE_FLOAT32_C(    61.87), SIMDE_FLOAT32_C(   566.23), SIMDE_FLOAT32_C(  -289.33), SIMDE_FLOAT32_C(  -299.83),
+        SIMDE_FLOAT32_C(  -905.08), SIMDE_FLOAT32_C(   359.54), SIMDE_FLOAT32_C(  -146.53), SIMDE_FLOAT32_C(  -371.26) },
+      UINT16_C(18441),
+      { UINT16_C(50061), UINT16_C(49818), UINT16_C(17483), UINT16_C(50244), UINT16_C(50264), UINT16_C(17415), UINT16_C(17354), UINT16_C(50244),
+        UINT16_C(50177), UINT16_C(17334), UINT16_C(50218), UINT16_C(49659), UINT16_C(17511), UINT16_C(50217), UINT16_C(17372), UINT16_C(17468) },
+      { SIMDE_FLOAT32_C(  -282.00), SIMDE_FLOAT32_C(  -972.61), SIMDE_FLOAT32_C(  -488.30), SIMDE_FLOAT32_C(  -784.00),
+        SIMDE_FLOAT32_C(   259.46), SIMDE_FLOAT32_C(  -410.39), SIMDE_FLOAT32_C(   621.07), SIMDE_FLOAT32_C(   150.79),
+        SIMDE_FLOAT32_C(    61.87), SIMDE_FLOAT32_C(   566.23), SIMDE_FLOAT32_C(  -289.33), SIMDE_FLOAT32_C(   -31.38),
+        SIMDE_FLOAT32_C(  -905.08), SIMDE_FLOAT32_C(   359.54), SIMDE_FLOAT32_C(   440.00), SIMDE_FLOAT32_C(  -371.26) } },
+    { { SIMDE_FLOAT32_C(  -364.88), SIMDE_FLOAT32_C(   941.89), SIMDE_FLOAT32_C(   665.01), SIMDE_FLOAT32_C(   366.17),
+        SIMDE_FLOAT32_C(   113.19), SIMDE_FLOAT32_C(  -423.76), SIMDE_FLOAT32_C(   277.31), SIMDE_FLOAT32_C(   559.06),
+        SIMDE_FLOAT32_C(  -156.96), SIMDE_FLOAT32_C(  -188.12), SIMDE_FLOAT32_C(   801.73), SIMDE_FLOAT32_C(    27.65),
+        SIMDE_FLOAT32_C(   532.19), SIMDE_FLOAT32_C(   136.93), SIMDE_FLOAT32_C(  -736.93), SIMDE_FLOAT32_C(   -37.56) },
+      UINT16_C(21336),
+      { UINT16_C(50251), UINT16_C(17254), UINT16_C(17306), UINT16_C(49974), UINT16_C(50110), UINT16_C(17449), UINT16_C(17330), UINT16_C(50228),
+        UINT16_C(50295), UINT16_C(49644), UINT16_C(49988), UINT16_C(49940), UINT16_C(17509), UINT16_C(50143), UINT16_C(49778), UINT16_C(49963) },
+      { SIMDE_FLOAT32_C(  -364.88), SIMDE_FLOAT32_C(   941.89), SIMDE_FLOAT32_C(   665.01), SIMDE_FLOAT32_C(  -182.00),
+        SIMDE_FLOAT32_C(  -380.00), SIMDE_FLOAT32_C(  -423.76), SIMDE_FLOAT32_C(   356.00), SIMDE_FLOAT32_C(   559.06),
+        SIMDE_FLOAT32_C(  -988.00), SIMDE_FLOAT32_C(   -29.50), SIMDE_FLOAT32_C(   801.73), SIMDE_FLOAT32_C(    27.65),
+        SIMDE_FLOAT32_C(   916.00), SIMDE_FLOAT32_C(   136.93), SIMDE_FLOAT32_C(   -60.50), SIMDE_FLOAT32_C(   -37.56) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 src = simde_mm512_loadu_ps(test_vec[i].src);
+    simde__m256bh a = simde_x_mm256_castsi256_pbh(simde_mm256_loadu_epi16(test_vec[i].a));
+    simde__m512 r = simde_mm512_mask_cvtpbh_ps(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m512 src = simde_test_x86_random_f32x16(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m256bh a = simde_x_mm256_castsi256_pbh(simde_test_x86_random_u16x16());
+    simde__m512 r = simde_mm512_mask_cvtpbh_ps(src, k, a);
+
+    simde_test_x86_write_f32x16(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u16x16(2, simde_x_mm256_castpbh_si256(a), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x16(2, r, SIMDE_TEST_VEC_POS_LAST, 1);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_maskz_cvtpbh_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask16 k;
+    const uint16_t a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { UINT16_C(38008),
+      { UINT16_C(50248), UINT16_C(49921), UINT16_C(17408), UINT16_C(17202), UINT16_C(50286), UINT16_C(50217), UINT16_C(17010), UINT16_C(50269),
+        UINT16_C(17466), UINT16_C(17492), UINT16_C(17480), UINT16_C(50102), UINT16_C(17258), UINT16_C(17494), UINT16_C(50259), UINT16_C(17470) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   178.00),
+        SIMDE_FLOAT32_C(  -952.00), SIMDE_FLOAT32_C(  -676.00), SIMDE_FLOAT32_C(    60.50), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   800.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(   234.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   760.00) } },
+    { UINT16_C(35025),
+      { UINT16_C(50051), UINT16_C(17290), UINT16_C(17430), UINT16_C(50275), UINT16_C(50201), UINT16_C(50228), UINT16_C(50279), UINT16_C(17198),
+        UINT16_C(17517), UINT16_C(50260), UINT16_C(17463), UINT16_C(17513), UINT16_C(17443), UINT16_C(50267), UINT16_C(17240), UINT16_C(50065) },
+      { SIMDE_FLOAT32_C(  -262.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(  -612.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -924.00), SIMDE_FLOAT32_C(   174.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   932.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -290.00) } },
+    { UINT16_C(44445),
+      { UINT16_C(50249), UINT16_C(17488), UINT16_C(50215), UINT16_C(50271), UINT16_C(17223), UINT16_C(49979), UINT16_C(50207), UINT16_C(49395),
+        UINT16_C(17399), UINT16_C(50295), UINT16_C(17315), UINT16_C(17437), UINT16_C(17438), UINT16_C(17235), UINT16_C(17514), UINT16_C(50038) },
+      { SIMDE_FLOAT32_C(  -804.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -668.00), SIMDE_FLOAT32_C(  -892.00),
+        SIMDE_FLOAT32_C(   199.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    -7.59),
+        SIMDE_FLOAT32_C(   494.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   326.00), SIMDE_FLOAT32_C(   628.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   211.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -246.00) } },
+    { UINT16_C(31711),
+      { UINT16_C(17162), UINT16_C(49949), UINT16_C(17285), UINT16_C(50284), UINT16_C(17178), UINT16_C(17292), UINT16_C(50145), UINT16_C(17420),
+        UINT16_C(50281), UINT16_C(17455), UINT16_C(17503), UINT16_C(17136), UINT16_C(49928), UINT16_C(50121), UINT16_C(17517), UINT16_C(17288) },
+      { SIMDE_FLOAT32_C(   138.00), SIMDE_FLOAT32_C(  -157.00), SIMDE_FLOAT32_C(   266.00), SIMDE_FLOAT32_C(  -944.00),
+        SIMDE_FLOAT32_C(   154.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -450.00), SIMDE_FLOAT32_C(   560.00),
+        SIMDE_FLOAT32_C(  -932.00), SIMDE_FLOAT32_C(   700.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   120.00),
+        SIMDE_FLOAT32_C(  -136.00), SIMDE_FLOAT32_C(  -402.00), SIMDE_FLOAT32_C(   948.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C(38133),
+      { UINT16_C(50258), UINT16_C(17176), UINT16_C(17178), UINT16_C(49874), UINT16_C(50031), UINT16_C(50111), UINT16_C(50007), UINT16_C(17095),
+        UINT16_C(17332), UINT16_C(50170), UINT16_C(17483), UINT16_C(17349), UINT16_C(17368), UINT16_C(50236), UINT16_C(17459), UINT16_C(17506) },
+      { SIMDE_FLOAT32_C(  -840.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   154.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(  -239.00), SIMDE_FLOAT32_C(  -382.00), SIMDE_FLOAT32_C(  -215.00), SIMDE_FLOAT32_C(    99.50),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   812.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(   432.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   904.00) } },
+    { UINT16_C(62169),
+      { UINT16_C(50097), UINT16_C(17396), UINT16_C(17501), UINT16_C(17397), UINT16_C(17507), UINT16_C(50194), UINT16_C(17428), UINT16_C(17296),
+        UINT16_C(17363), UINT16_C(50180), UINT16_C(50118), UINT16_C(17120), UINT16_C(50161), UINT16_C(17323), UINT16_C(17479), UINT16_C(17356) },
+      { SIMDE_FLOAT32_C(  -354.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   490.00),
+        SIMDE_FLOAT32_C(   908.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   592.00), SIMDE_FLOAT32_C(   288.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -528.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(  -482.00), SIMDE_FLOAT32_C(   342.00), SIMDE_FLOAT32_C(   796.00), SIMDE_FLOAT32_C(   408.00) } },
+    { UINT16_C(51882),
+      { UINT16_C(50044), UINT16_C(17336), UINT16_C(17221), UINT16_C(50235), UINT16_C(17489), UINT16_C(17446), UINT16_C(17036), UINT16_C(50209),
+        UINT16_C(17490), UINT16_C(50141), UINT16_C(50230), UINT16_C(50111), UINT16_C(17466), UINT16_C(50268), UINT16_C(49738), UINT16_C(50229) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   368.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -748.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   664.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -644.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -442.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -382.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   -50.50), SIMDE_FLOAT32_C(  -724.00) } },
+    { UINT16_C(33113),
+      { UINT16_C(17116), UINT16_C(17380), UINT16_C(17346), UINT16_C(49865), UINT16_C(17387), UINT16_C(50013), UINT16_C(16969), UINT16_C(17315),
+        UINT16_C(17430), UINT16_C(17464), UINT16_C(50072), UINT16_C(50248), UINT16_C(17517), UINT16_C(17408), UINT16_C(50261), UINT16_C(50193) },
+      { SIMDE_FLOAT32_C(   110.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -100.50),
+        SIMDE_FLOAT32_C(   470.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    50.25), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(   600.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -580.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256bh a = simde_x_mm256_castsi256_pbh(simde_mm256_loadu_epi16(test_vec[i].a));
+    simde__m512 r = simde_mm512_maskz_cvtpbh_ps(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m256bh a = simde_x_mm256_castsi256_pbh(simde_test_x86_random_u16x16());
+    simde__m512 r = simde_mm512_maskz_cvtpbh_ps(k, a);
+
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_u16x16(2, simde_x_mm256_castpbh_si256(a), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x16(2, r, SIMDE_TEST_VEC_POS_LAST, 1);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_cvtness_sbh (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde_float32 a;
+    const uint16_t r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { SIMDE_FLOAT32_C(1.00390625), UINT16_C(16256) },
+    {  SIMDE_FLOAT32_C(-1.0e-39), UINT16_C(32768) },
+    {            SIMDE_MATH_NANF, UINT16_C(32704) },
+    #endif
+    { SIMDE_FLOAT32_C(   179.12), UINT16_C(17203) },
+    { SIMDE_FLOAT32_C(  -758.41), UINT16_C(50238) },
+    { SIMDE_FLOAT32_C(  -179.61), UINT16_C(49972) },
+    { SIMDE_FLOAT32_C(   451.55), UINT16_C(17378) },
+    { SIMDE_FLOAT32_C(  -978.58), UINT16_C(50293) },
+    { SIMDE_FLOAT32_C(   613.07), UINT16_C(17433) },
+    { SIMDE_FLOAT32_C(   -94.31), UINT16_C(49853) },
+    { SIMDE_FLOAT32_C(  -157.67), UINT16_C(49950) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_bfloat16 r = simde_mm_cvtness_sbh(test_vec[i].a);
+    simde_assert_equal_u16(simde_bfloat16_as_uint16(r), test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_float32 a = simde_test_codegen_random_f32(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde_bfloat16 r = simde_mm_cvtness_sbh(a);
+
+    simde_test_codegen_write_f32(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_u16(2, simde_bfloat16_as_uint16(r), SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_cvtsbh_ss (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint16_t a;
+    const simde_float32 r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT16_C(65473),            SIMDE_MATH_NANF },
+    #endif
+    { UINT16_C(50055), SIMDE_FLOAT32_C(  -270.00) },
+    { UINT16_C(50286), SIMDE_FLOAT32_C(  -952.00) },
+    { UINT16_C(16903), SIMDE_FLOAT32_C(    33.75) },
+    { UINT16_C(50230), SIMDE_FLOAT32_C(  -728.00) },
+    { UINT16_C(17415), SIMDE_FLOAT32_C(   540.00) },
+    { UINT16_C(17496), SIMDE_FLOAT32_C(   864.00) },
+    { UINT16_C(17193), SIMDE_FLOAT32_C(   169.00) },
+    { UINT16_C(17295), SIMDE_FLOAT32_C(   286.00) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32 r = simde_mm_cvtsbh_ss(simde_uint16_as_bfloat16(test_vec[i].a));
+    simde_assert_equal_f32(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_bfloat16 a = simde_mm_cvtness_sbh(simde_test_codegen_random_f32(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0)));
+    simde_float32 r = simde_mm_cvtsbh_ss(a);
+
+    simde_test_codegen_write_u16(2, simde_bfloat16_as_uint16(a), SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_f32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm_cvtxph_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float16 a[8];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(   -611.0), SIMDE_FLOAT16_VALUE(    735.5), SIMDE_FLOAT16_VALUE(   -156.5), SIMDE_FLOAT16_VALUE(    609.0),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0) },
+      { SIMDE_FLOAT32_C(      -611.0), SIMDE_FLOAT32_C(       735.5), SIMDE_FLOAT32_C(      -156.5), SIMDE_FLOAT32_C(       609.0) } },
+    { { SIMDE_FLOAT16_VALUE(   -87.56), SIMDE_FLOAT16_VALUE(   -16.62), SIMDE_FLOAT16_VALUE(   -342.2), SIMDE_FLOAT16_VALUE(    30.61),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0) },
+      { SIMDE_FLOAT32_C(    -87.5625), SIMDE_FLOAT32_C(     -16.625), SIMDE_FLOAT32_C(     -342.25), SIMDE_FLOAT32_C(   30.609375) } },
+    { { SIMDE_FLOAT16_VALUE(    199.4), SIMDE_FLOAT16_VALUE(    551.0), SIMDE_FLOAT16_VALUE(   -895.0), SIMDE_FLOAT16_VALUE(   -826.5),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0) },
+      { SIMDE_FLOAT32_C(     199.375), SIMDE_FLOAT32_C(       551.0), SIMDE_FLOAT32_C(      -895.0), SIMDE_FLOAT32_C(      -826.5) } },
+    { { SIMDE_FLOAT16_VALUE(    162.9), SIMDE_FLOAT16_VALUE(     9.85), SIMDE_FLOAT16_VALUE(    186.0), SIMDE_FLOAT16_VALUE(    -83.3),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0) },
+      { SIMDE_FLOAT32_C(     162.875), SIMDE_FLOAT32_C(   9.8515625), SIMDE_FLOAT32_C(       186.0), SIMDE_FLOAT32_C(    -83.3125) } },
+    { { SIMDE_FLOAT16_VALUE(    103.1), SIMDE_FLOAT16_VALUE(    796.5), SIMDE_FLOAT16_VALUE(    724.0), SIMDE_FLOAT16_VALUE(   -315.5),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0) },
+      { SIMDE_FLOAT32_C(     103.125), SIMDE_FLOAT32_C(       796.5), SIMDE_FLOAT32_C(       724.0), SIMDE_FLOAT32_C(      -315.5) } },
+    { { SIMDE_FLOAT16_VALUE(    113.2), SIMDE_FLOAT16_VALUE(   -209.6), SIMDE_FLOAT16_VALUE(   -319.8), SIMDE_FLOAT16_VALUE(   -941.5),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0) },
+      { SIMDE_FLOAT32_C(    113.1875), SIMDE_FLOAT32_C(    -209.625), SIMDE_FLOAT32_C(     -319.75), SIMDE_FLOAT32_C(      -941.5) } },
+    { { SIMDE_FLOAT16_VALUE(    910.5), SIMDE_FLOAT16_VALUE(    542.0), SIMDE_FLOAT16_VALUE(    353.8), SIMDE_FLOAT16_VALUE(   -173.6),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0) },
+      { SIMDE_FLOAT32_C(       910.5), SIMDE_FLOAT32_C(       542.0), SIMDE_FLOAT32_C(      353.75), SIMDE_FLOAT32_C(    -173.625) } },
+    { { SIMDE_FLOAT16_VALUE(    787.5), SIMDE_FLOAT16_VALUE(    624.0), SIMDE_FLOAT16_VALUE(    627.5), SIMDE_FLOAT16_VALUE(    550.0),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0) },
+      { SIMDE_FLOAT32_C(       787.5), SIMDE_FLOAT32_C(       624.0), SIMDE_FLOAT32_C(       627.5), SIMDE_FLOAT32_C(       550.0) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128h a = simde_mm_loadu_ph(test_vec[i].a);
+    simde__m128 r = simde_mm_cvtxph_ps(a);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm256_cvtxph_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float16 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(    179.0), SIMDE_FLOAT16_VALUE(    336.8), SIMDE_FLOAT16_VALUE(   -278.0), SIMDE_FLOAT16_VALUE(    860.0),
+        SIMDE_FLOAT16_VALUE(    955.5), SIMDE_FLOAT16_VALUE(    199.5), SIMDE_FLOAT16_VALUE(   -21.53), SIMDE_FLOAT16_VALUE(   -927.0) },
+      { SIMDE_FLOAT32_C(       179.0), SIMDE_FLOAT32_C(      336.75), SIMDE_FLOAT32_C(      -278.0), SIMDE_FLOAT32_C(       860.0),
+        SIMDE_FLOAT32_C(       955.5), SIMDE_FLOAT32_C(       199.5), SIMDE_FLOAT32_C(   -21.53125), SIMDE_FLOAT32_C(      -927.0) } },
+    { { SIMDE_FLOAT16_VALUE(    385.0), SIMDE_FLOAT16_VALUE(   -887.0), SIMDE_FLOAT16_VALUE(   -150.9), SIMDE_FLOAT16_VALUE(    564.0),
+        SIMDE_FLOAT16_VALUE(    588.0), SIMDE_FLOAT16_VALUE(   -945.0), SIMDE_FLOAT16_VALUE(   -869.5), SIMDE_FLOAT16_VALUE(    113.1) },
+      { SIMDE_FLOAT32_C(       385.0), SIMDE_FLOAT32_C(      -887.0), SIMDE_FLOAT32_C(    -150.875), SIMDE_FLOAT32_C(       564.0),
+        SIMDE_FLOAT32_C(       588.0), SIMDE_FLOAT32_C(      -945.0), SIMDE_FLOAT32_C(      -869.5), SIMDE_FLOAT32_C(     113.125) } },
+    { { SIMDE_FLOAT16_VALUE(   -883.0), SIMDE_FLOAT16_VALUE(    183.0), SIMDE_FLOAT16_VALUE(   -776.0), SIMDE_FLOAT16_VALUE(  -126.75),
+        SIMDE_FLOAT16_VALUE(   -996.0), SIMDE_FLOAT16_VALUE(    236.8), SIMDE_FLOAT16_VALUE(    313.2), SIMDE_FLOAT16_VALUE(   -624.0) },
+      { SIMDE_FLOAT32_C(      -883.0), SIMDE_FLOAT32_C(       183.0), SIMDE_FLOAT32_C(      -776.0), SIMDE_FLOAT32_C(     -126.75),
+        SIMDE_FLOAT32_C(      -996.0), SIMDE_FLOAT32_C(      236.75), SIMDE_FLOAT32_C(      313.25), SIMDE_FLOAT32_C(      -624.0) } },
+    { { SIMDE_FLOAT16_VALUE(    -88.0), SIMDE_FLOAT16_VALUE(   -488.5), SIMDE_FLOAT16_VALUE(    207.9), SIMDE_FLOAT16_VALUE(    608.5),
+        SIMDE_FLOAT16_VALUE(   -213.8), SIMDE_FLOAT16_VALUE(    84.75), SIMDE_FLOAT16_VALUE(   -706.5), SIMDE_FLOAT16_VALUE(   -606.5) },
+      { SIMDE_FLOAT32_C(       -88.0), SIMDE_FLOAT32_C(      -488.5), SIMDE_FLOAT32_C(     207.875), SIMDE_FLOAT32_C(       608.5),
+        SIMDE_FLOAT32_C(     -213.75), SIMDE_FLOAT32_C(       84.75), SIMDE_FLOAT32_C(      -706.5), SIMDE_FLOAT32_C(      -606.5) } },
+    { { SIMDE_FLOAT16_VALUE(    700.0), SIMDE_FLOAT16_VALUE(   -523.0), SIMDE_FLOAT16_VALUE(    127.4), SIMDE_FLOAT16_VALUE(   -394.0),
+        SIMDE_FLOAT16_VALUE(   -879.0), SIMDE_FLOAT16_VALUE(    833.0), SIMDE_FLOAT16_VALUE(    876.0), SIMDE_FLOAT16_VALUE(    107.4) },
+      { SIMDE_FLOAT32_C(       700.0), SIMDE_FLOAT32_C(      -523.0), SIMDE_FLOAT32_C(     127.375), SIMDE_FLOAT32_C(      -394.0),
+        SIMDE_FLOAT32_C(      -879.0), SIMDE_FLOAT32_C(       833.0), SIMDE_FLOAT32_C(       876.0), SIMDE_FLOAT32_C(     107.375) } },
+    { { SIMDE_FLOAT16_VALUE(   -286.2), SIMDE_FLOAT16_VALUE(    693.5), SIMDE_FLOAT16_VALUE(   -477.8), SIMDE_FLOAT16_VALUE(     73.2),
+        SIMDE_FLOAT16_VALUE(   -816.0), SIMDE_FLOAT16_VALUE(   -555.0), SIMDE_FLOAT16_VALUE(   -258.8), SIMDE_FLOAT16_VALUE(    357.2) },
+      { SIMDE_FLOAT32_C(     -286.25), SIMDE_FLOAT32_C(       693.5), SIMDE_FLOAT32_C(     -477.75), SIMDE_FLOAT32_C(     73.1875),
+        SIMDE_FLOAT32_C(      -816.0), SIMDE_FLOAT32_C(      -555.0), SIMDE_FLOAT32_C(     -258.75), SIMDE_FLOAT32_C(      357.25) } },
+    { { SIMDE_FLOAT16_VALUE(    760.5), SIMDE_FLOAT16_VALUE(   -906.0), SIMDE_FLOAT16_VALUE(   -513.5), SIMDE_FLOAT16_VALUE(    886.5),
+        SIMDE_FLOAT16_VALUE(   -877.5), SIMDE_FLOAT16_VALUE(   -60.06), SIMDE_FLOAT16_VALUE(    -9.58), SIMDE_FLOAT16_VALUE(   -767.0) },
+      { SIMDE_FLOAT32_C(       760.5), SIMDE_FLOAT32_C(      -906.0), SIMDE_FLOAT32_C(      -513.5), SIMDE_FLOAT32_C(       886.5),
+        SIMDE_FLOAT32_C(      -877.5), SIMDE_FLOAT32_C(    -60.0625), SIMDE_FLOAT32_C(   -9.578125), SIMDE_FLOAT32_C(      -767.0) } },
+    { { SIMDE_FLOAT16_VALUE(   -614.0), SIMDE_FLOAT16_VALUE(    524.5), SIMDE_FLOAT16_VALUE(   -960.0), SIMDE_FLOAT16_VALUE(    233.6),
+        SIMDE_FLOAT16_VALUE(   -169.1), SIMDE_FLOAT16_VALUE(    818.5), SIMDE_FLOAT16_VALUE(   -426.2), SIMDE_FLOAT16_VALUE(   -983.0) },
+      { SIMDE_FLOAT32_C(      -614.0), SIMDE_FLOAT32_C(       524.5), SIMDE_FLOAT32_C(      -960.0), SIMDE_FLOAT32_C(     233.625),
+        SIMDE_FLOAT32_C(    -169.125), SIMDE_FLOAT32_C(       818.5), SIMDE_FLOAT32_C(     -426.25), SIMDE_FLOAT32_C(      -983.0) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128h a = simde_mm_loadu_ph(test_vec[i].a);
+    simde__m256 r = simde_mm256_cvtxph_ps(a);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm512_cvtxph_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float16 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(   -597.0), SIMDE_FLOAT16_VALUE(   -160.2), SIMDE_FLOAT16_VALUE(   110.25), SIMDE_FLOAT16_VALUE(    468.8),
+        SIMDE_FLOAT16_VALUE(    716.5), SIMDE_FLOAT16_VALUE(   -27.97), SIMDE_FLOAT16_VALUE(   -27.31), SIMDE_FLOAT16_VALUE(   -784.0),
+        SIMDE_FLOAT16_VALUE(   -900.0), SIMDE_FLOAT16_VALUE(   -346.0), SIMDE_FLOAT16_VALUE(    574.5), SIMDE_FLOAT16_VALUE(    141.8),
+        SIMDE_FLOAT16_VALUE(    760.5), SIMDE_FLOAT16_VALUE(    966.0), SIMDE_FLOAT16_VALUE(    531.0), SIMDE_FLOAT16_VALUE(    303.8) },
+      { SIMDE_FLOAT32_C(      -597.0), SIMDE_FLOAT32_C(     -160.25), SIMDE_FLOAT32_C(      110.25), SIMDE_FLOAT32_C(      468.75),
+        SIMDE_FLOAT32_C(       716.5), SIMDE_FLOAT32_C(   -27.96875), SIMDE_FLOAT32_C(    -27.3125), SIMDE_FLOAT32_C(      -784.0),
+        SIMDE_FLOAT32_C(      -900.0), SIMDE_FLOAT32_C(      -346.0), SIMDE_FLOAT32_C(       574.5), SIMDE_FLOAT32_C(      141.75),
+        SIMDE_FLOAT32_C(       760.5), SIMDE_FLOAT32_C(       966.0), SIMDE_FLOAT32_C(       531.0), SIMDE_FLOAT32_C(      303.75) } },
+    { { SIMDE_FLOAT16_VALUE(   -388.0), SIMDE_FLOAT16_VALUE(   -564.0), SIMDE_FLOAT16_VALUE(    979.0), SIMDE_FLOAT16_VALUE(   -223.6),
+        SIMDE_FLOAT16_VALUE(   -715.0), SIMDE_FLOAT16_VALUE(    434.2), SIMDE_FLOAT16_VALUE(    724.5), SIMDE_FLOAT16_VALUE(   -436.5),
+        SIMDE_FLOAT16_VALUE(    437.0), SIMDE_FLOAT16_VALUE(   -744.0), SIMDE_FLOAT16_VALUE(   -284.2), SIMDE_FLOAT16_VALUE(    689.0),
+        SIMDE_FLOAT16_VALUE(    -61.7), SIMDE_FLOAT16_VALUE(   -129.5), SIMDE_FLOAT16_VALUE(   -134.6), SIMDE_FLOAT16_VALUE(   -434.0) },
+      { SIMDE_FLOAT32_C(      -388.0), SIMDE_FLOAT32_C(      -564.0), SIMDE_FLOAT32_C(       979.0), SIMDE_FLOAT32_C(    -223.625),
+        SIMDE_FLOAT32_C(      -715.0), SIMDE_FLOAT32_C(      434.25), SIMDE_FLOAT32_C(       724.5), SIMDE_FLOAT32_C(      -436.5),
+        SIMDE_FLOAT32_C(       437.0), SIMDE_FLOAT32_C(      -744.0), SIMDE_FLOAT32_C(     -284.25), SIMDE_FLOAT32_C(       689.0),
+        SIMDE_FLOAT32_C(    -61.6875), SIMDE_FLOAT32_C(      -129.5), SIMDE_FLOAT32_C(    -134.625), SIMDE_FLOAT32_C(      -434.0) } },
+    { { SIMDE_FLOAT16_VALUE(   -55.62), SIMDE_FLOAT16_VALUE(   -24.69), SIMDE_FLOAT16_VALUE(     68.3), SIMDE_FLOAT16_VALUE(   -598.5),
+        SIMDE_FLOAT16_VALUE(   -942.5), SIMDE_FLOAT16_VALUE(   -388.8), SIMDE_FLOAT16_VALUE(    -95.1), SIMDE_FLOAT16_VALUE(    554.0),
+        SIMDE_FLOAT16_VALUE(    351.2), SIMDE_FLOAT16_VALUE(    779.0), SIMDE_FLOAT16_VALUE(    716.0), SIMDE_FLOAT16_VALUE(    636.5),
+        SIMDE_FLOAT16_VALUE(    48.97), SIMDE_FLOAT16_VALUE(   -191.8), SIMDE_FLOAT16_VALUE(    674.5), SIMDE_FLOAT16_VALUE(    775.5) },
+      { SIMDE_FLOAT32_C(     -55.625), SIMDE_FLOAT32_C(    -24.6875), SIMDE_FLOAT32_C(     68.3125), SIMDE_FLOAT32_C(      -598.5),
+        SIMDE_FLOAT32_C(      -942.5), SIMDE_FLOAT32_C(     -388.75), SIMDE_FLOAT32_C(     -95.125), SIMDE_FLOAT32_C(       554.0),
+        SIMDE_FLOAT32_C(      351.25), SIMDE_FLOAT32_C(       779.0), SIMDE_FLOAT32_C(       716.0), SIMDE_FLOAT32_C(       636.5),
+        SIMDE_FLOAT32_C(    48.96875), SIMDE_FLOAT32_C(     -191.75), SIMDE_FLOAT32_C(       674.5), SIMDE_FLOAT32_C(       775.5) } },
+    { { SIMDE_FLOAT16_VALUE(    960.0), SIMDE_FLOAT16_VALUE(    -37.2), SIMDE_FLOAT16_VALUE(    143.1), SIMDE_FLOAT16_VALUE(    -47.8),
+        SIMDE_FLOAT16_VALUE(   -754.5), SIMDE_FLOAT16_VALUE(    884.5), SIMDE_FLOAT16_VALUE(    655.0), SIMDE_FLOAT16_VALUE(   -760.5),
+        SIMDE_FLOAT16_VALUE(   -274.8), SIMDE_FLOAT16_VALUE(   -26.11), SIMDE_FLOAT16_VALUE(    967.5), SIMDE_FLOAT16_VALUE(    31.69),
+        SIMDE_FLOAT16_VALUE(    945.0), SIMDE_FLOAT16_VALUE(    386.0), SIMDE_FLOAT16_VALUE(   -880.0), SIMDE_FLOAT16_VALUE(   -664.0) },
+      { SIMDE_FLOAT32_C(       960.0), SIMDE_FLOAT32_C(    -37.1875), SIMDE_FLOAT32_C(     143.125), SIMDE_FLOAT32_C(    -47.8125),
+        SIMDE_FLOAT32_C(      -754.5), SIMDE_FLOAT32_C(       884.5), SIMDE_FLOAT32_C(       655.0), SIMDE_FLOAT32_C(      -760.5),
+        SIMDE_FLOAT32_C(     -274.75), SIMDE_FLOAT32_C(  -26.109375), SIMDE_FLOAT32_C(       967.5), SIMDE_FLOAT32_C(     31.6875),
+        SIMDE_FLOAT32_C(       945.0), SIMDE_FLOAT32_C(       386.0), SIMDE_FLOAT32_C(      -880.0), SIMDE_FLOAT32_C(      -664.0) } },
+    { { SIMDE_FLOAT16_VALUE(   -756.5), SIMDE_FLOAT16_VALUE(   -974.0), SIMDE_FLOAT16_VALUE(   -653.5), SIMDE_FLOAT16_VALUE(    579.5),
+        SIMDE_FLOAT16_VALUE(   -679.0), SIMDE_FLOAT16_VALUE(    1.155), SIMDE_FLOAT16_VALUE(    651.0), SIMDE_FLOAT16_VALUE(    502.5),
+        SIMDE_FLOAT16_VALUE(   -826.0), SIMDE_FLOAT16_VALUE(    750.0), SIMDE_FLOAT16_VALUE(    997.0), SIMDE_FLOAT16_VALUE(   -231.2),
+        SIMDE_FLOAT16_VALUE(    765.0), SIMDE_FLOAT16_VALUE(    112.8), SIMDE_FLOAT16_VALUE(   -192.8), SIMDE_FLOAT16_VALUE(    678.5) },
+      { SIMDE_FLOAT32_C(      -756.5), SIMDE_FLOAT32_C(      -974.0), SIMDE_FLOAT32_C(      -653.5), SIMDE_FLOAT32_C(       579.5),
+        SIMDE_FLOAT32_C(      -679.0), SIMDE_FLOAT32_C(   1.1552734), SIMDE_FLOAT32_C(       651.0), SIMDE_FLOAT32_C(       502.5),
+        SIMDE_FLOAT32_C(      -826.0), SIMDE_FLOAT32_C(       750.0), SIMDE_FLOAT32_C(       997.0), SIMDE_FLOAT32_C(     -231.25),
+        SIMDE_FLOAT32_C(       765.0), SIMDE_FLOAT32_C(    112.8125), SIMDE_FLOAT32_C(     -192.75), SIMDE_FLOAT32_C(       678.5) } },
+    { { SIMDE_FLOAT16_VALUE(   -320.5), SIMDE_FLOAT16_VALUE(    293.5), SIMDE_FLOAT16_VALUE(   -183.2), SIMDE_FLOAT16_VALUE(     8.84),
+        SIMDE_FLOAT16_VALUE(   108.94), SIMDE_FLOAT16_VALUE(    134.1), SIMDE_FLOAT16_VALUE(    945.0), SIMDE_FLOAT16_VALUE(    108.3),
+        SIMDE_FLOAT16_VALUE(   -905.0), SIMDE_FLOAT16_VALUE(   -577.0), SIMDE_FLOAT16_VALUE(    518.0), SIMDE_FLOAT16_VALUE(    329.5),
+        SIMDE_FLOAT16_VALUE(   -841.5), SIMDE_FLOAT16_VALUE(    542.0), SIMDE_FLOAT16_VALUE(   -632.5), SIMDE_FLOAT16_VALUE(   -497.8) },
+      { SIMDE_FLOAT32_C(      -320.5), SIMDE_FLOAT32_C(       293.5), SIMDE_FLOAT32_C(     -183.25), SIMDE_FLOAT32_C(     8.84375),
+        SIMDE_FLOAT32_C(    108.9375), SIMDE_FLOAT32_C(     134.125), SIMDE_FLOAT32_C(       945.0), SIMDE_FLOAT32_C(    108.3125),
+        SIMDE_FLOAT32_C(      -905.0), SIMDE_FLOAT32_C(      -577.0), SIMDE_FLOAT32_C(       518.0), SIMDE_FLOAT32_C(       329.5),
+        SIMDE_FLOAT32_C(      -841.5), SIMDE_FLOAT32_C(       542.0), SIMDE_FLOAT32_C(      -632.5), SIMDE_FLOAT32_C(     -497.75) } },
+    { { SIMDE_FLOAT16_VALUE(    518.0), SIMDE_FLOAT16_VALUE(   101.44), SIMDE_FLOAT16_VALUE(    617.0), SIMDE_FLOAT16_VALUE(    583.5),
+        SIMDE_FLOAT16_VALUE(    938.0), SIMDE_FLOAT16_VALUE(   -516.0), SIMDE_FLOAT16_VALUE(    307.8), SIMDE_FLOAT16_VALUE(    962.5),
+        SIMDE_FLOAT16_VALUE(   -568.0), SIMDE_FLOAT16_VALUE(    927.0), SIMDE_FLOAT16_VALUE(   -934.5), SIMDE_FLOAT16_VALUE(   -115.7),
+        SIMDE_FLOAT16_VALUE(   -135.1), SIMDE_FLOAT16_VALUE(   -432.8), SIMDE_FLOAT16_VALUE(    760.5), SIMDE_FLOAT16_VALUE(   -303.0) },
+      { SIMDE_FLOAT32_C(       518.0), SIMDE_FLOAT32_C(    101.4375), SIMDE_FLOAT32_C(       617.0), SIMDE_FLOAT32_C(       583.5),
+        SIMDE_FLOAT32_C(       938.0), SIMDE_FLOAT32_C(      -516.0), SIMDE_FLOAT32_C(      307.75), SIMDE_FLOAT32_C(       962.5),
+        SIMDE_FLOAT32_C(      -568.0), SIMDE_FLOAT32_C(       927.0), SIMDE_FLOAT32_C(      -934.5), SIMDE_FLOAT32_C(   -115.6875),
+        SIMDE_FLOAT32_C(    -135.125), SIMDE_FLOAT32_C(     -432.75), SIMDE_FLOAT32_C(       760.5), SIMDE_FLOAT32_C(      -303.0) } },
+    { { SIMDE_FLOAT16_VALUE(    145.5), SIMDE_FLOAT16_VALUE(   -685.0), SIMDE_FLOAT16_VALUE(    918.0), SIMDE_FLOAT16_VALUE(   -646.5),
+        SIMDE_FLOAT16_VALUE(    819.0), SIMDE_FLOAT16_VALUE(    957.5), SIMDE_FLOAT16_VALUE(   -555.0), SIMDE_FLOAT16_VALUE(   -148.1),
+        SIMDE_FLOAT16_VALUE(    722.0), SIMDE_FLOAT16_VALUE(    726.0), SIMDE_FLOAT16_VALUE(   -664.5), SIMDE_FLOAT16_VALUE(   -744.5),
+        SIMDE_FLOAT16_VALUE(    726.0), SIMDE_FLOAT16_VALUE(   -336.5), SIMDE_FLOAT16_VALUE(     38.1), SIMDE_FLOAT16_VALUE(    602.0) },
+      { SIMDE_FLOAT32_C(       145.5), SIMDE_FLOAT32_C(      -685.0), SIMDE_FLOAT32_C(       918.0), SIMDE_FLOAT32_C(      -646.5),
+        SIMDE_FLOAT32_C(       819.0), SIMDE_FLOAT32_C(       957.5), SIMDE_FLOAT32_C(      -555.0), SIMDE_FLOAT32_C(    -148.125),
+        SIMDE_FLOAT32_C(       722.0), SIMDE_FLOAT32_C(       726.0), SIMDE_FLOAT32_C(      -664.5), SIMDE_FLOAT32_C(      -744.5),
+        SIMDE_FLOAT32_C(       726.0), SIMDE_FLOAT32_C(      -336.5), SIMDE_FLOAT32_C(    38.09375), SIMDE_FLOAT32_C(       602.0) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256h a = simde_mm256_loadu_ph(test_vec[i].a);
+    simde__m512 r = simde_mm512_cvtxph_ps(a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm_cvtxps_ph (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[4];
+    const simde_float16 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   -388.9304), SIMDE_FLOAT32_C(    2.585987), SIMDE_FLOAT32_C(  -119.04585), SIMDE_FLOAT32_C(   -691.3428) },
+      { SIMDE_FLOAT16_VALUE(   -389.0), SIMDE_FLOAT16_VALUE(    2.586), SIMDE_FLOAT16_VALUE(  -119.06), SIMDE_FLOAT16_VALUE(   -691.5),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0) } },
+    { { SIMDE_FLOAT32_C(  -968.29614), SIMDE_FLOAT32_C(    897.1653), SIMDE_FLOAT32_C(  -701.48145), SIMDE_FLOAT32_C(   807.06177) },
+      { SIMDE_FLOAT16_VALUE(   -968.5), SIMDE_FLOAT16_VALUE(    897.0), SIMDE_FLOAT16_VALUE(   -701.5), SIMDE_FLOAT16_VALUE(    807.0),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0) } },
+    { { SIMDE_FLOAT32_C(   544.97375), SIMDE_FLOAT32_C(   -967.3177), SIMDE_FLOAT32_C(   -720.2567), SIMDE_FLOAT32_C(   475.19434) },
+      { SIMDE_FLOAT16_VALUE(    545.0), SIMDE_FLOAT16_VALUE(   -967.5), SIMDE_FLOAT16_VALUE(   -720.5), SIMDE_FLOAT16_VALUE(    475.2),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0) } },
+    { { SIMDE_FLOAT32_C(   265.30746), SIMDE_FLOAT32_C(   -913.5206), SIMDE_FLOAT32_C(     162.315), SIMDE_FLOAT32_C(   486.79617) },
+      { SIMDE_FLOAT16_VALUE(    265.2), SIMDE_FLOAT16_VALUE(   -913.5), SIMDE_FLOAT16_VALUE(    162.4), SIMDE_FLOAT16_VALUE(    486.8),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0) } },
+    { { SIMDE_FLOAT32_C(    530.1245), SIMDE_FLOAT32_C(  -153.20683), SIMDE_FLOAT32_C(  -964.10986), SIMDE_FLOAT32_C(     629.966) },
+      { SIMDE_FLOAT16_VALUE(    530.0), SIMDE_FLOAT16_VALUE(   -153.2), SIMDE_FLOAT16_VALUE(   -964.0), SIMDE_FLOAT16_VALUE(    630.0),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0) } },
+    { { SIMDE_FLOAT32_C(  -275.38715), SIMDE_FLOAT32_C(  -144.64943), SIMDE_FLOAT32_C(  -74.541985), SIMDE_FLOAT32_C(  -277.32516) },
+      { SIMDE_FLOAT16_VALUE(   -275.5), SIMDE_FLOAT16_VALUE(   -144.6), SIMDE_FLOAT16_VALUE(   -74.56), SIMDE_FLOAT16_VALUE(   -277.2),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0) } },
+    { { SIMDE_FLOAT32_C(   116.86774), SIMDE_FLOAT32_C(    236.5797), SIMDE_FLOAT32_C(   3.8159919), SIMDE_FLOAT32_C(  -860.55554) },
+      { SIMDE_FLOAT16_VALUE(    116.9), SIMDE_FLOAT16_VALUE(    236.6), SIMDE_FLOAT16_VALUE(    3.816), SIMDE_FLOAT16_VALUE(   -860.5),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0) } },
+    { { SIMDE_FLOAT32_C(    462.7254), SIMDE_FLOAT32_C(  -533.06116), SIMDE_FLOAT32_C(    962.5429), SIMDE_FLOAT32_C(    682.8172) },
+      { SIMDE_FLOAT16_VALUE(    462.8), SIMDE_FLOAT16_VALUE(   -533.0), SIMDE_FLOAT16_VALUE(    962.5), SIMDE_FLOAT16_VALUE(    683.0),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128h r = simde_mm_cvtxps_ph(a);
+    simde_test_x86_assert_equal_f16x8(r, simde_mm_loadu_ph(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm256_cvtxps_ph (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[8];
+    const simde_float16 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   89.521164), SIMDE_FLOAT32_C(    41.48199), SIMDE_FLOAT32_C(    -570.686), SIMDE_FLOAT32_C(     893.225),
+        SIMDE_FLOAT32_C(   464.67123), SIMDE_FLOAT32_C(   -733.2767), SIMDE_FLOAT32_C(  -342.10617), SIMDE_FLOAT32_C(   -363.1126) },
+      { SIMDE_FLOAT16_VALUE(     89.5), SIMDE_FLOAT16_VALUE(    41.47), SIMDE_FLOAT16_VALUE(   -570.5), SIMDE_FLOAT16_VALUE(    893.0),
+        SIMDE_FLOAT16_VALUE(    464.8), SIMDE_FLOAT16_VALUE(   -733.5), SIMDE_FLOAT16_VALUE(   -342.0), SIMDE_FLOAT16_VALUE(   -363.0) } },
+    { { SIMDE_FLOAT32_C(     798.881), SIMDE_FLOAT32_C(   167.94319), SIMDE_FLOAT32_C(  -129.88777), SIMDE_FLOAT32_C(    75.30914),
+        SIMDE_FLOAT32_C(  -214.75388), SIMDE_FLOAT32_C(   572.82745), SIMDE_FLOAT32_C(  -855.67456), SIMDE_FLOAT32_C(   -469.1643) },
+      { SIMDE_FLOAT16_VALUE(    799.0), SIMDE_FLOAT16_VALUE(    168.0), SIMDE_FLOAT16_VALUE(   -129.9), SIMDE_FLOAT16_VALUE(     75.3),
+        SIMDE_FLOAT16_VALUE(   -214.8), SIMDE_FLOAT16_VALUE(    573.0), SIMDE_FLOAT16_VALUE(   -855.5), SIMDE_FLOAT16_VALUE(   -469.2) } },
+    { { SIMDE_FLOAT32_C(  -796.48987), SIMDE_FLOAT32_C(  -355.52914), SIMDE_FLOAT32_C(   154.80737), SIMDE_FLOAT32_C(   821.23016),
+        SIMDE_FLOAT32_C(   -666.6456), SIMDE_FLOAT32_C(   462.62167), SIMDE_FLOAT32_C(   581.72046), SIMDE_FLOAT32_C(    694.3895) },
+      { SIMDE_FLOAT16_VALUE(   -796.5), SIMDE_FLOAT16_VALUE(   -355.5), SIMDE_FLOAT16_VALUE(    154.8), SIMDE_FLOAT16_VALUE(    821.0),
+        SIMDE_FLOAT16_VALUE(   -666.5), SIMDE_FLOAT16_VALUE(    462.5), SIMDE_FLOAT16_VALUE(    581.5), SIMDE_FLOAT16_VALUE(    694.5) } },
+    { { SIMDE_FLOAT32_C(   507.13712), SIMDE_FLOAT32_C(    900.9232), SIMDE_FLOAT32_C(  -661.78937), SIMDE_FLOAT32_C(   110.39523),
+        SIMDE_FLOAT32_C(  -157.93564), SIMDE_FLOAT32_C(   153.09647), SIMDE_FLOAT32_C(   -953.0476), SIMDE_FLOAT32_C(   296.59717) },
+      { SIMDE_FLOAT16_VALUE(    507.2), SIMDE_FLOAT16_VALUE(    901.0), SIMDE_FLOAT16_VALUE(   -662.0), SIMDE_FLOAT16_VALUE(    110.4),
+        SIMDE_FLOAT16_VALUE(   -157.9), SIMDE_FLOAT16_VALUE(    153.1), SIMDE_FLOAT16_VALUE(   -953.0), SIMDE_FLOAT16_VALUE(    296.5) } },
+    { { SIMDE_FLOAT32_C(  -304.11935), SIMDE_FLOAT32_C(  -533.59357), SIMDE_FLOAT32_C(   970.26056), SIMDE_FLOAT32_C(   -831.7716),
+        SIMDE_FLOAT32_C(    672.6989), SIMDE_FLOAT32_C(   -955.1131), SIMDE_FLOAT32_C(   -602.1524), SIMDE_FLOAT32_C(   -867.2203) },
+      { SIMDE_FLOAT16_VALUE(   -304.0), SIMDE_FLOAT16_VALUE(   -533.5), SIMDE_FLOAT16_VALUE(    970.5), SIMDE_FLOAT16_VALUE(   -832.0),
+        SIMDE_FLOAT16_VALUE(    672.5), SIMDE_FLOAT16_VALUE(   -955.0), SIMDE_FLOAT16_VALUE(   -602.0), SIMDE_FLOAT16_VALUE(   -867.0) } },
+    { { SIMDE_FLOAT32_C(   -716.3948), SIMDE_FLOAT32_C(   -512.3826), SIMDE_FLOAT32_C(  -525.50165), SIMDE_FLOAT32_C(   -888.1964),
+        SIMDE_FLOAT32_C(    85.24886), SIMDE_FLOAT32_C(   313.80798), SIMDE_FLOAT32_C(  -309.29068), SIMDE_FLOAT32_C(   46.763435) },
+      { SIMDE_FLOAT16_VALUE(   -716.5), SIMDE_FLOAT16_VALUE(   -512.5), SIMDE_FLOAT16_VALUE(   -525.5), SIMDE_FLOAT16_VALUE(   -888.0),
+        SIMDE_FLOAT16_VALUE(    85.25), SIMDE_FLOAT16_VALUE(    313.8), SIMDE_FLOAT16_VALUE(   -309.2), SIMDE_FLOAT16_VALUE(    46.75) } },
+    { { SIMDE_FLOAT32_C(    602.3676), SIMDE_FLOAT32_C(   222.00726), SIMDE_FLOAT32_C(   111.28955), SIMDE_FLOAT32_C(   -558.7831),
+        SIMDE_FLOAT32_C(  -623.06805), SIMDE_FLOAT32_C(    72.27701), SIMDE_FLOAT32_C(    974.7565), SIMDE_FLOAT32_C(  -74.843315) },
+      { SIMDE_FLOAT16_VALUE(    602.5), SIMDE_FLOAT16_VALUE(    222.0), SIMDE_FLOAT16_VALUE(    111.3), SIMDE_FLOAT16_VALUE(   -559.0),
+        SIMDE_FLOAT16_VALUE(   -623.0), SIMDE_FLOAT16_VALUE(    72.25), SIMDE_FLOAT16_VALUE(    975.0), SIMDE_FLOAT16_VALUE(    -74.8) } },
+    { { SIMDE_FLOAT32_C(    906.8353), SIMDE_FLOAT32_C(  -530.31445), SIMDE_FLOAT32_C(   -957.8744), SIMDE_FLOAT32_C(    553.9554),
+        SIMDE_FLOAT32_C(  -561.97345), SIMDE_FLOAT32_C(   975.34186), SIMDE_FLOAT32_C(    -374.824), SIMDE_FLOAT32_C(   456.48895) },
+      { SIMDE_FLOAT16_VALUE(    907.0), SIMDE_FLOAT16_VALUE(   -530.5), SIMDE_FLOAT16_VALUE(   -958.0), SIMDE_FLOAT16_VALUE(    554.0),
+        SIMDE_FLOAT16_VALUE(   -562.0), SIMDE_FLOAT16_VALUE(    975.5), SIMDE_FLOAT16_VALUE(   -374.8), SIMDE_FLOAT16_VALUE(    456.5) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde__m128h r = simde_mm256_cvtxps_ph(a);
+    simde_test_x86_assert_equal_f16x8(r, simde_mm_loadu_ph(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm512_cvtxps_ph (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[16];
+    const simde_float16 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -303.96133), SIMDE_FLOAT32_C(  -676.59467), SIMDE_FLOAT32_C(   -756.8627), SIMDE_FLOAT32_C(    949.9456),
+        SIMDE_FLOAT32_C(   -978.2357), SIMDE_FLOAT32_C(   -437.5014), SIMDE_FLOAT32_C(  -505.47894), SIMDE_FLOAT32_C(  -363.61786),
+        SIMDE_FLOAT32_C(   -631.0813), SIMDE_FLOAT32_C(  121.216934), SIMDE_FLOAT32_C(  -222.85197), SIMDE_FLOAT32_C(    659.3929),
+        SIMDE_FLOAT32_C(   13.470992), SIMDE_FLOAT32_C(     548.665), SIMDE_FLOAT32_C(  -288.04208), SIMDE_FLOAT32_C(   423.67993) },
+      { SIMDE_FLOAT16_VALUE(   -304.0), SIMDE_FLOAT16_VALUE(   -676.5), SIMDE_FLOAT16_VALUE(   -757.0), SIMDE_FLOAT16_VALUE(    950.0),
+        SIMDE_FLOAT16_VALUE(   -978.0), SIMDE_FLOAT16_VALUE(   -437.5), SIMDE_FLOAT16_VALUE(   -505.5), SIMDE_FLOAT16_VALUE(   -363.5),
+        SIMDE_FLOAT16_VALUE(   -631.0), SIMDE_FLOAT16_VALUE(    121.2), SIMDE_FLOAT16_VALUE(   -222.9), SIMDE_FLOAT16_VALUE(    659.5),
+        SIMDE_FLOAT16_VALUE(    13.47), SIMDE_FLOAT16_VALUE(    548.5), SIMDE_FLOAT16_VALUE(   -288.0), SIMDE_FLOAT16_VALUE(    423.8) } },
+    { { SIMDE_FLOAT32_C(   19.369871), SIMDE_FLOAT32_C(   445.83282), SIMDE_FLOAT32_C(   -561.5386), SIMDE_FLOAT32_C(   987.04193),
+        SIMDE_FLOAT32_C(  -171.02931), SIMDE_FLOAT32_C(   281.92438), SIMDE_FLOAT32_C(   746.28217), SIMDE_FLOAT32_C(  -801.80115),
+        SIMDE_FLOAT32_C(  -454.12515), SIMDE_FLOAT32_C(    878.4505), SIMDE_FLOAT32_C(  -940.47235), SIMDE_FLOAT32_C(   276.34335),
+        SIMDE_FLOAT32_C(   426.80695), SIMDE_FLOAT32_C(    815.9351), SIMDE_FLOAT32_C(    694.5501), SIMDE_FLOAT32_C(   -755.9467) },
+      { SIMDE_FLOAT16_VALUE(    19.38), SIMDE_FLOAT16_VALUE(    445.8), SIMDE_FLOAT16_VALUE(   -561.5), SIMDE_FLOAT16_VALUE(    987.0),
+        SIMDE_FLOAT16_VALUE(   -171.0), SIMDE_FLOAT16_VALUE(    282.0), SIMDE_FLOAT16_VALUE(    746.5), SIMDE_FLOAT16_VALUE(   -802.0),
+        SIMDE_FLOAT16_VALUE(   -454.2), SIMDE_FLOAT16_VALUE(    878.5), SIMDE_FLOAT16_VALUE(   -940.5), SIMDE_FLOAT16_VALUE(    276.2),
+        SIMDE_FLOAT16_VALUE(    426.8), SIMDE_FLOAT16_VALUE(    816.0), SIMDE_FLOAT16_VALUE(    694.5), SIMDE_FLOAT16_VALUE(   -756.0) } },
+    { { SIMDE_FLOAT32_C(    663.6966), SIMDE_FLOAT32_C(  -151.22772), SIMDE_FLOAT32_C(  -958.75256), SIMDE_FLOAT32_C(    146.4529),
+        SIMDE_FLOAT32_C(  -261.18912), SIMDE_FLOAT32_C(   232.18523), SIMDE_FLOAT32_C(  -404.95056), SIMDE_FLOAT32_C(    646.3275),
+        SIMDE_FLOAT32_C(    619.0205), SIMDE_FLOAT32_C(   -601.0414), SIMDE_FLOAT32_C(  -463.75375), SIMDE_FLOAT32_C(   -953.8736),
+        SIMDE_FLOAT32_C(   -613.7516), SIMDE_FLOAT32_C(    871.9742), SIMDE_FLOAT32_C(   988.46075), SIMDE_FLOAT32_C(  -225.11069) },
+      { SIMDE_FLOAT16_VALUE(    663.5), SIMDE_FLOAT16_VALUE(   -151.2), SIMDE_FLOAT16_VALUE(   -959.0), SIMDE_FLOAT16_VALUE(    146.5),
+        SIMDE_FLOAT16_VALUE(   -261.2), SIMDE_FLOAT16_VALUE(    232.1), SIMDE_FLOAT16_VALUE(   -405.0), SIMDE_FLOAT16_VALUE(    646.5),
+        SIMDE_FLOAT16_VALUE(    619.0), SIMDE_FLOAT16_VALUE(   -601.0), SIMDE_FLOAT16_VALUE(   -463.8), SIMDE_FLOAT16_VALUE(   -954.0),
+        SIMDE_FLOAT16_VALUE(   -614.0), SIMDE_FLOAT16_VALUE(    872.0), SIMDE_FLOAT16_VALUE(    988.5), SIMDE_FLOAT16_VALUE(   -225.1) } },
+    { { SIMDE_FLOAT32_C(   650.81464), SIMDE_FLOAT32_C(   918.33887), SIMDE_FLOAT32_C(  -211.88551), SIMDE_FLOAT32_C(   41.835033),
+        SIMDE_FLOAT32_C(   23.098457), SIMDE_FLOAT32_C(   84.968185), SIMDE_FLOAT32_C(  -182.08148), SIMDE_FLOAT32_C(  -185.60707),
+        SIMDE_FLOAT32_C(  -53.038193), SIMDE_FLOAT32_C(  -233.29115), SIMDE_FLOAT32_C(   -690.3166), SIMDE_FLOAT32_C(   203.24213),
+        SIMDE_FLOAT32_C(   828.58905), SIMDE_FLOAT32_C(  -465.57278), SIMDE_FLOAT32_C(  -482.83383), SIMDE_FLOAT32_C(    158.5384) },
+      { SIMDE_FLOAT16_VALUE(    651.0), SIMDE_FLOAT16_VALUE(    918.5), SIMDE_FLOAT16_VALUE(   -211.9), SIMDE_FLOAT16_VALUE(    41.84),
+        SIMDE_FLOAT16_VALUE(     23.1), SIMDE_FLOAT16_VALUE(    84.94), SIMDE_FLOAT16_VALUE(   -182.1), SIMDE_FLOAT16_VALUE(   -185.6),
+        SIMDE_FLOAT16_VALUE(   -53.03), SIMDE_FLOAT16_VALUE(   -233.2), SIMDE_FLOAT16_VALUE(   -690.5), SIMDE_FLOAT16_VALUE(    203.2),
+        SIMDE_FLOAT16_VALUE(    828.5), SIMDE_FLOAT16_VALUE(   -465.5), SIMDE_FLOAT16_VALUE(   -482.8), SIMDE_FLOAT16_VALUE(    158.5) } },
+    { { SIMDE_FLOAT32_C(  -575.47754), SIMDE_FLOAT32_C(     642.967), SIMDE_FLOAT32_C(   166.06726), SIMDE_FLOAT32_C(   -586.6587),
+        SIMDE_FLOAT32_C(   553.81714), SIMDE_FLOAT32_C(  -493.17685), SIMDE_FLOAT32_C(    668.1373), SIMDE_FLOAT32_C(    295.2465),
+        SIMDE_FLOAT32_C(   -773.2091), SIMDE_FLOAT32_C(   -777.2185), SIMDE_FLOAT32_C(   12.051819), SIMDE_FLOAT32_C(    588.7079),
+        SIMDE_FLOAT32_C(   303.04047), SIMDE_FLOAT32_C(     765.206), SIMDE_FLOAT32_C(  -351.06992), SIMDE_FLOAT32_C(  -220.37137) },
+      { SIMDE_FLOAT16_VALUE(   -575.5), SIMDE_FLOAT16_VALUE(    643.0), SIMDE_FLOAT16_VALUE(    166.1), SIMDE_FLOAT16_VALUE(   -586.5),
+        SIMDE_FLOAT16_VALUE(    554.0), SIMDE_FLOAT16_VALUE(   -493.2), SIMDE_FLOAT16_VALUE(    668.0), SIMDE_FLOAT16_VALUE(    295.2),
+        SIMDE_FLOAT16_VALUE(   -773.0), SIMDE_FLOAT16_VALUE(   -777.0), SIMDE_FLOAT16_VALUE(   12.055), SIMDE_FLOAT16_VALUE(    588.5),
+        SIMDE_FLOAT16_VALUE(    303.0), SIMDE_FLOAT16_VALUE(    765.0), SIMDE_FLOAT16_VALUE(   -351.0), SIMDE_FLOAT16_VALUE(   -220.4) } },
+    { { SIMDE_FLOAT32_C(    98.57498), SIMDE_FLOAT32_C(  -418.36435), SIMDE_FLOAT32_C(    480.3389), SIMDE_FLOAT32_C(    702.4381),
+        SIMDE_FLOAT32_C(   5.1813297), SIMDE_FLOAT32_C(    746.6836), SIMDE_FLOAT32_C(   -683.1842), SIMDE_FLOAT32_C(   196.89072),
+        SIMDE_FLOAT32_C(   -539.1426), SIMDE_FLOAT32_C(    814.5468), SIMDE_FLOAT32_C(   -296.6671), SIMDE_FLOAT32_C(  -444.84015),
+        SIMDE_FLOAT32_C(   465.03546), SIMDE_FLOAT32_C(   362.85626), SIMDE_FLOAT32_C(   434.70554), SIMDE_FLOAT32_C(    851.0745) },
+      { SIMDE_FLOAT16_VALUE(    98.56), SIMDE_FLOAT16_VALUE(   -418.2), SIMDE_FLOAT16_VALUE(    480.2), SIMDE_FLOAT16_VALUE(    702.5),
+        SIMDE_FLOAT16_VALUE(     5.18), SIMDE_FLOAT16_VALUE(    746.5), SIMDE_FLOAT16_VALUE(   -683.0), SIMDE_FLOAT16_VALUE(    196.9),
+        SIMDE_FLOAT16_VALUE(   -539.0), SIMDE_FLOAT16_VALUE(    814.5), SIMDE_FLOAT16_VALUE(   -296.8), SIMDE_FLOAT16_VALUE(   -444.8),
+        SIMDE_FLOAT16_VALUE(    465.0), SIMDE_FLOAT16_VALUE(    362.8), SIMDE_FLOAT16_VALUE(    434.8), SIMDE_FLOAT16_VALUE(    851.0) } },
+    { { SIMDE_FLOAT32_C(   317.19846), SIMDE_FLOAT32_C(    8.927468), SIMDE_FLOAT32_C(     757.631), SIMDE_FLOAT32_C(    873.7741),
+        SIMDE_FLOAT32_C(   1.3349323), SIMDE_FLOAT32_C(   219.24918), SIMDE_FLOAT32_C(  -875.74567), SIMDE_FLOAT32_C(   -786.5557),
+        SIMDE_FLOAT32_C(    329.0303), SIMDE_FLOAT32_C(   203.09563), SIMDE_FLOAT32_C(   -287.0964), SIMDE_FLOAT32_C(   65.514015),
+        SIMDE_FLOAT32_C(   718.79083), SIMDE_FLOAT32_C(   862.14606), SIMDE_FLOAT32_C(   258.35382), SIMDE_FLOAT32_C(   935.31195) },
+      { SIMDE_FLOAT16_VALUE(    317.2), SIMDE_FLOAT16_VALUE(     8.93), SIMDE_FLOAT16_VALUE(    757.5), SIMDE_FLOAT16_VALUE(    874.0),
+        SIMDE_FLOAT16_VALUE(    1.335), SIMDE_FLOAT16_VALUE(    219.2), SIMDE_FLOAT16_VALUE(   -875.5), SIMDE_FLOAT16_VALUE(   -786.5),
+        SIMDE_FLOAT16_VALUE(    329.0), SIMDE_FLOAT16_VALUE(    203.1), SIMDE_FLOAT16_VALUE(   -287.0), SIMDE_FLOAT16_VALUE(     65.5),
+        SIMDE_FLOAT16_VALUE(    719.0), SIMDE_FLOAT16_VALUE(    862.0), SIMDE_FLOAT16_VALUE(    258.2), SIMDE_FLOAT16_VALUE(    935.5) } },
+    { { SIMDE_FLOAT32_C(  100.621895), SIMDE_FLOAT32_C(   126.41212), SIMDE_FLOAT32_C(   -182.2082), SIMDE_FLOAT32_C(  -404.23257),
+        SIMDE_FLOAT32_C(   213.22112), SIMDE_FLOAT32_C(  -40.363426), SIMDE_FLOAT32_C(  -130.74707), SIMDE_FLOAT32_C(  -709.78296),
+        SIMDE_FLOAT32_C(    240.4886), SIMDE_FLOAT32_C(   132.32443), SIMDE_FLOAT32_C(  -940.02423), SIMDE_FLOAT32_C(   -605.9055),
+        SIMDE_FLOAT32_C(   192.19864), SIMDE_FLOAT32_C(   35.688198), SIMDE_FLOAT32_C(   -851.9749), SIMDE_FLOAT32_C(  -348.94537) },
+      { SIMDE_FLOAT16_VALUE(    100.6), SIMDE_FLOAT16_VALUE(   126.44), SIMDE_FLOAT16_VALUE(   -182.2), SIMDE_FLOAT16_VALUE(   -404.2),
+        SIMDE_FLOAT16_VALUE(    213.2), SIMDE_FLOAT16_VALUE(   -40.38), SIMDE_FLOAT16_VALUE(   -130.8), SIMDE_FLOAT16_VALUE(   -710.0),
+        SIMDE_FLOAT16_VALUE(    240.5), SIMDE_FLOAT16_VALUE(    132.4), SIMDE_FLOAT16_VALUE(   -940.0), SIMDE_FLOAT16_VALUE(   -606.0),
+        SIMDE_FLOAT16_VALUE(    192.2), SIMDE_FLOAT16_VALUE(     35.7), SIMDE_FLOAT16_VALUE(   -852.0), SIMDE_FLOAT16_VALUE(   -349.0) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m256h r = simde_mm512_cvtxps_ph(a);
+    simde_test_x86_assert_equal_f16x16(r, simde_mm256_loadu_ph(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm_cvtph_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float16 a[8];
+    const int16_t r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(   6236.0), SIMDE_FLOAT16_VALUE(      1.5), SIMDE_FLOAT16_VALUE(  25856.0), SIMDE_FLOAT16_VALUE(  -4804.0),
+        SIMDE_FLOAT16_VALUE( -30928.0), SIMDE_FLOAT16_VALUE(      1.5), SIMDE_FLOAT16_VALUE(  -2600.0), SIMDE_FLOAT16_VALUE(  20480.0) },
+      { INT16_C(  6236), INT16_C(     2), INT16_C( 25856), INT16_C( -4804), INT16_C(-30928), INT16_C(     2), INT16_C( -2600), INT16_C( 20480) } },
+    { { SIMDE_FLOAT16_VALUE(  -4320.0), SIMDE_FLOAT16_VALUE(     -2.5), SIMDE_FLOAT16_VALUE(   2526.0), SIMDE_FLOAT16_VALUE(     -1.5),
+        SIMDE_FLOAT16_VALUE(  34112.0), SIMDE_FLOAT16_VALUE(    -64.0), SIMDE_FLOAT16_VALUE(   3018.0), SIMDE_FLOAT16_VALUE(      2.5) },
+      { INT16_C( -4320), INT16_C(    -2), INT16_C(  2526), INT16_C(    -2), INT16_C(-32768), INT16_C(   -64), INT16_C(  3018), INT16_C(     2) } },
+    { { SIMDE_FLOAT16_VALUE(     -2.5), SIMDE_FLOAT16_VALUE(      2.5), SIMDE_FLOAT16_VALUE(   7920.0), SIMDE_FLOAT16_VALUE( -26048.0),
+        SIMDE_FLOAT16_VALUE(      2.5), SIMDE_FLOAT16_VALUE(  -8472.0), SIMDE_FLOAT16_VALUE(     -2.5), SIMDE_FLOAT16_VALUE( -34912.0) },
+      { INT16_C(    -2), INT16_C(     2), INT16_C(  7920), INT16_C(-26048), INT16_C(     2), INT16_C( -8472), INT16_C(    -2), INT16_C(-32768) } },
+    { { SIMDE_FLOAT16_VALUE( -15784.0), SIMDE_FLOAT16_VALUE( -17984.0), SIMDE_FLOAT16_VALUE(      0.5), SIMDE_FLOAT16_VALUE(     -0.5),
+        SIMDE_FLOAT16_VALUE(      1.5), SIMDE_FLOAT16_VALUE( -17616.0), SIMDE_FLOAT16_VALUE( -23904.0), SIMDE_FLOAT16_VALUE( -22944.0) },
+      { INT16_C(-15784), INT16_C(-17984), INT16_C(     0), INT16_C(     0), INT16_C(     2), INT16_C(-17616), INT16_C(-23904), INT16_C(-22944) } },
+    { { SIMDE_FLOAT16_VALUE( -29744.0), SIMDE_FLOAT16_VALUE(     -1.5), SIMDE_FLOAT16_VALUE(      1.5), SIMDE_FLOAT16_VALUE(   6112.0),
+        SIMDE_FLOAT16_VALUE(  -3656.0), SIMDE_FLOAT16_VALUE(     -1.5), SIMDE_FLOAT16_VALUE( -20608.0), SIMDE_FLOAT16_VALUE(  17424.0) },
+      { INT16_C(-29744), INT16_C(    -2), INT16_C(     2), INT16_C(  6112), INT16_C( -3656), INT16_C(    -2), INT16_C(-20608), INT16_C( 17424) } },
+    { { SIMDE_FLOAT16_VALUE(   6040.0), SIMDE_FLOAT16_VALUE(  21296.0), SIMDE_FLOAT16_VALUE( -12096.0), SIMDE_FLOAT16_VALUE( -11200.0),
+        SIMDE_FLOAT16_VALUE( -25840.0), SIMDE_FLOAT16_VALUE(  32720.0), SIMDE_FLOAT16_VALUE(     -1.5), SIMDE_FLOAT16_VALUE(      4.5) },
+      { INT16_C(  6040), INT16_C( 21296), INT16_C(-12096), INT16_C(-11200), INT16_C(-25840), INT16_C( 32720), INT16_C(    -2), INT16_C(     4) } },
+    { { SIMDE_FLOAT16_VALUE(  14312.0), SIMDE_FLOAT16_VALUE( -32048.0), SIMDE_FLOAT16_VALUE( -38720.0), SIMDE_FLOAT16_VALUE(     -0.5),
+        SIMDE_FLOAT16_VALUE(  15896.0), SIMDE_FLOAT16_VALUE(      1.5), SIMDE_FLOAT16_VALUE(   8448.0), SIMDE_FLOAT16_VALUE(  33856.0) },
+      { INT16_C( 14312), INT16_C(-32048), INT16_C(-32768), INT16_C(     0), INT16_C( 15896), INT16_C(     2), INT16_C(  8448), INT16_C(-32768) } },
+    { { SIMDE_FLOAT16_VALUE( -39296.0), SIMDE_FLOAT16_VALUE(      0.5), SIMDE_FLOAT16_VALUE(  33600.0), SIMDE_FLOAT16_VALUE(  28176.0),
+        SIMDE_FLOAT16_VALUE(     -1.5), SIMDE_FLOAT16_VALUE(  -6924.0), SIMDE_FLOAT16_VALUE(     -3.5), SIMDE_FLOAT16_VALUE(      4.5) },
+      { INT16_C(-32768), INT16_C(     0), INT16_C(-32768), INT16_C( 28176), INT16_C(    -2), INT16_C( -6924), INT16_C(    -4), INT16_C(     4) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128h a = simde_mm_loadu_ph(test_vec[i].a);
+    simde__m128i r = simde_mm_cvtph_epi16(a);
+    simde_test_x86_assert_equal_i16x8(r, simde_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+#endif
+
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm256_cvtph_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float16 a[16];
+    const int16_t r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(  31760.0), SIMDE_FLOAT16_VALUE(   2064.0), SIMDE_FLOAT16_VALUE( -12184.0), SIMDE_FLOAT16_VALUE(    202.1),
+        SIMDE_FLOAT16_VALUE( -36896.0), SIMDE_FLOAT16_VALUE( -37312.0), SIMDE_FLOAT16_VALUE(  23424.0), SIMDE_FLOAT16_VALUE(      2.5),
+        SIMDE_FLOAT16_VALUE( -19136.0), SIMDE_FLOAT16_VALUE(  -8544.0), SIMDE_FLOAT16_VALUE( -38240.0), SIMDE_FLOAT16_VALUE( -26752.0),
+        SIMDE_FLOAT16_VALUE(  33920.0), SIMDE_FLOAT16_VALUE(  29040.0), SIMDE_FLOAT16_VALUE(  36416.0), SIMDE_FLOAT16_VALUE( -14960.0) },
+      { INT16_C( 31760), INT16_C(  2064), INT16_C(-12184), INT16_C(   202), INT16_C(-32768), INT16_C(-32768), INT16_C( 23424), INT16_C(     2),
+        INT16_C(-19136), INT16_C( -8544), INT16_C(-32768), INT16_C(-26752), INT16_C(-32768), INT16_C( 29040), INT16_C(-32768), INT16_C(-14960) } },
+    { { SIMDE_FLOAT16_VALUE(   8568.0), SIMDE_FLOAT16_VALUE(      2.5), SIMDE_FLOAT16_VALUE(  38912.0), SIMDE_FLOAT16_VALUE( -17280.0),
+        SIMDE_FLOAT16_VALUE(   -601.5), SIMDE_FLOAT16_VALUE(  36320.0), SIMDE_FLOAT16_VALUE(  15232.0), SIMDE_FLOAT16_VALUE(  12568.0),
+        SIMDE_FLOAT16_VALUE(  24432.0), SIMDE_FLOAT16_VALUE( -30000.0), SIMDE_FLOAT16_VALUE(      2.5), SIMDE_FLOAT16_VALUE(  25456.0),
+        SIMDE_FLOAT16_VALUE( -39456.0), SIMDE_FLOAT16_VALUE( -31344.0), SIMDE_FLOAT16_VALUE(      0.5), SIMDE_FLOAT16_VALUE( -15152.0) },
+      { INT16_C(  8568), INT16_C(     2), INT16_C(-32768), INT16_C(-17280), INT16_C(  -602), INT16_C(-32768), INT16_C( 15232), INT16_C( 12568),
+        INT16_C( 24432), INT16_C(-30000), INT16_C(     2), INT16_C( 25456), INT16_C(-32768), INT16_C(-31344), INT16_C(     0), INT16_C(-15152) } },
+    { { SIMDE_FLOAT16_VALUE(  32800.0), SIMDE_FLOAT16_VALUE(  29648.0), SIMDE_FLOAT16_VALUE(  39488.0), SIMDE_FLOAT16_VALUE(     -1.5),
+        SIMDE_FLOAT16_VALUE( -28704.0), SIMDE_FLOAT16_VALUE(     -0.5), SIMDE_FLOAT16_VALUE(      0.5), SIMDE_FLOAT16_VALUE( -14512.0),
+        SIMDE_FLOAT16_VALUE(  20304.0), SIMDE_FLOAT16_VALUE(  -6868.0), SIMDE_FLOAT16_VALUE(      0.5), SIMDE_FLOAT16_VALUE( -18944.0),
+        SIMDE_FLOAT16_VALUE(  33728.0), SIMDE_FLOAT16_VALUE(  19504.0), SIMDE_FLOAT16_VALUE(  -5232.0), SIMDE_FLOAT16_VALUE(      1.5) },
+      { INT16_C(-32768), INT16_C( 29648), INT16_C(-32768), INT16_C(    -2), INT16_C(-28704), INT16_C(     0), INT16_C(     0), INT16_C(-14512),
+        INT16_C( 20304), INT16_C( -6868), INT16_C(     0), INT16_C(-18944), INT16_C(-32768), INT16_C( 19504), INT16_C( -5232), INT16_C(     2) } },
+    { { SIMDE_FLOAT16_VALUE(     -1.5), SIMDE_FLOAT16_VALUE( -31184.0), SIMDE_FLOAT16_VALUE(  26160.0), SIMDE_FLOAT16_VALUE( -11056.0),
+        SIMDE_FLOAT16_VALUE( -32368.0), SIMDE_FLOAT16_VALUE(  27216.0), SIMDE_FLOAT16_VALUE(  -3072.0), SIMDE_FLOAT16_VALUE(  15632.0),
+        SIMDE_FLOAT16_VALUE(  12928.0), SIMDE_FLOAT16_VALUE(     -1.5), SIMDE_FLOAT16_VALUE( -36288.0), SIMDE_FLOAT16_VALUE(     -0.5),
+        SIMDE_FLOAT16_VALUE( -13392.0), SIMDE_FLOAT16_VALUE(     -0.5), SIMDE_FLOAT16_VALUE(     -0.5), SIMDE_FLOAT16_VALUE( -33248.0) },
+      { INT16_C(    -2), INT16_C(-31184), INT16_C( 26160), INT16_C(-11056), INT16_C(-32368), INT16_C( 27216), INT16_C( -3072), INT16_C( 15632),
+        INT16_C( 12928), INT16_C(    -2), INT16_C(-32768), INT16_C(     0), INT16_C(-13392), INT16_C(     0), INT16_C(     0), INT16_C(-32768) } },
+    { { SIMDE_FLOAT16_VALUE(      1.5), SIMDE_FLOAT16_VALUE(   7060.0), SIMDE_FLOAT16_VALUE(  24064.0), SIMDE_FLOAT16_VALUE(  17760.0),
+        SIMDE_FLOAT16_VALUE(  14680.0), SIMDE_FLOAT16_VALUE(  19552.0), SIMDE_FLOAT16_VALUE( -33024.0), SIMDE_FLOAT16_VALUE(  22480.0),
+        SIMDE_FLOAT16_VALUE(  -8360.0), SIMDE_FLOAT16_VALUE(  32320.0), SIMDE_FLOAT16_VALUE( -19296.0), SIMDE_FLOAT16_VALUE(  35424.0),
+        SIMDE_FLOAT16_VALUE(  39136.0), SIMDE_FLOAT16_VALUE(  16400.0), SIMDE_FLOAT16_VALUE(  23856.0), SIMDE_FLOAT16_VALUE(   2170.0) },
+      { INT16_C(     2), INT16_C(  7060), INT16_C( 24064), INT16_C( 17760), INT16_C( 14680), INT16_C( 19552), INT16_C(-32768), INT16_C( 22480),
+        INT16_C( -8360), INT16_C( 32320), INT16_C(-19296), INT16_C(-32768), INT16_C(-32768), INT16_C( 16400), INT16_C( 23856), INT16_C(  2170) } },
+    { { SIMDE_FLOAT16_VALUE(     -2.5), SIMDE_FLOAT16_VALUE( -21488.0), SIMDE_FLOAT16_VALUE( -20000.0), SIMDE_FLOAT16_VALUE(  26320.0),
+        SIMDE_FLOAT16_VALUE( -11408.0), SIMDE_FLOAT16_VALUE(  36704.0), SIMDE_FLOAT16_VALUE( -35520.0), SIMDE_FLOAT16_VALUE(   -338.0),
+        SIMDE_FLOAT16_VALUE(   9080.0), SIMDE_FLOAT16_VALUE( -13224.0), SIMDE_FLOAT16_VALUE( -34656.0), SIMDE_FLOAT16_VALUE(  -8280.0),
+        SIMDE_FLOAT16_VALUE(  -3390.0), SIMDE_FLOAT16_VALUE(     -0.5), SIMDE_FLOAT16_VALUE( -21680.0), SIMDE_FLOAT16_VALUE(  13816.0) },
+      { INT16_C(    -2), INT16_C(-21488), INT16_C(-20000), INT16_C( 26320), INT16_C(-11408), INT16_C(-32768), INT16_C(-32768), INT16_C(  -338),
+        INT16_C(  9080), INT16_C(-13224), INT16_C(-32768), INT16_C( -8280), INT16_C( -3390), INT16_C(     0), INT16_C(-21680), INT16_C( 13816) } },
+    { { SIMDE_FLOAT16_VALUE( -32240.0), SIMDE_FLOAT16_VALUE(     -1.5), SIMDE_FLOAT16_VALUE(      0.5), SIMDE_FLOAT16_VALUE(  -8360.0),
+        SIMDE_FLOAT16_VALUE( -13136.0), SIMDE_FLOAT16_VALUE( -30480.0), SIMDE_FLOAT16_VALUE(   3938.0), SIMDE_FLOAT16_VALUE(     -0.5),
+        SIMDE_FLOAT16_VALUE( -20224.0), SIMDE_FLOAT16_VALUE(  15752.0), SIMDE_FLOAT16_VALUE(   7848.0), SIMDE_FLOAT16_VALUE(     -1.5),
+        SIMDE_FLOAT16_VALUE(  39680.0), SIMDE_FLOAT16_VALUE(     -5.5), SIMDE_FLOAT16_VALUE(  35936.0), SIMDE_FLOAT16_VALUE(      3.5) },
+      { INT16_C(-32240), INT16_C(    -2), INT16_C(     0), INT16_C( -8360), INT16_C(-13136), INT16_C(-30480), INT16_C(  3938), INT16_C(     0),
+        INT16_C(-20224), INT16_C( 15752), INT16_C(  7848), INT16_C(    -2), INT16_C(-32768), INT16_C(    -6), INT16_C(-32768), INT16_C(     4) } },
+    { { SIMDE_FLOAT16_VALUE( -30672.0), SIMDE_FLOAT16_VALUE(  28528.0), SIMDE_FLOAT16_VALUE( -28192.0), SIMDE_FLOAT16_VALUE(  -9296.0),
+        SIMDE_FLOAT16_VALUE(      1.5), SIMDE_FLOAT16_VALUE(  38560.0), SIMDE_FLOAT16_VALUE( -15304.0), SIMDE_FLOAT16_VALUE( -31728.0),
+        SIMDE_FLOAT16_VALUE(     -4.5), SIMDE_FLOAT16_VALUE( -31472.0), SIMDE_FLOAT16_VALUE(      0.5), SIMDE_FLOAT16_VALUE(  -8584.0),
+        SIMDE_FLOAT16_VALUE(   -374.2), SIMDE_FLOAT16_VALUE(     -0.5), SIMDE_FLOAT16_VALUE(   9536.0), SIMDE_FLOAT16_VALUE(     -2.5) },
+      { INT16_C(-30672), INT16_C( 28528), INT16_C(-28192), INT16_C( -9296), INT16_C(     2), INT16_C(-32768), INT16_C(-15304), INT16_C(-31728),
+        INT16_C(    -4), INT16_C(-31472), INT16_C(     0), INT16_C( -8584), INT16_C(  -374), INT16_C(     0), INT16_C(  9536), INT16_C(    -2) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256h a = simde_mm256_loadu_ph(test_vec[i].a);
+    simde__m256i r = simde_mm256_cvtph_epi16(a);
+    simde_test_x86_assert_equal_i16x16(r, simde_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+#endif
+
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm512_cvtph_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float16 a[32];
+    const int16_t r[32];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(    861.5), SIMDE_FLOAT16_VALUE(  17952.0), SIMDE_FLOAT16_VALUE(  34528.0), SIMDE_FLOAT16_VALUE( -32688.0),
+        SIMDE_FLOAT16_VALUE( -10896.0), SIMDE_FLOAT16_VALUE(  27472.0), SIMDE_FLOAT16_VALUE( -34752.0), SIMDE_FLOAT16_VALUE(  -6904.0),
+        SIMDE_FLOAT16_VALUE(      0.5), SIMDE_FLOAT16_VALUE(  -2968.0), SIMDE_FLOAT16_VALUE( -24480.0), SIMDE_FLOAT16_VALUE(     -0.5),
+        SIMDE_FLOAT16_VALUE( -38560.0), SIMDE_FLOAT16_VALUE(  -2556.0), SIMDE_FLOAT16_VALUE( -20288.0), SIMDE_FLOAT16_VALUE(  26912.0),
+        SIMDE_FLOAT16_VALUE(     -0.5), SIMDE_FLOAT16_VALUE(  17424.0), SIMDE_FLOAT16_VALUE( -12784.0), SIMDE_FLOAT16_VALUE( -29600.0),
+        SIMDE_FLOAT16_VALUE(  36768.0), SIMDE_FLOAT16_VALUE(     -0.5), SIMDE_FLOAT16_VALUE(  -7672.0), SIMDE_FLOAT16_VALUE( -33248.0),
+        SIMDE_FLOAT16_VALUE(   7004.0), SIMDE_FLOAT16_VALUE(     -1.5), SIMDE_FLOAT16_VALUE(     -1.5), SIMDE_FLOAT16_VALUE( -27632.0),
+        SIMDE_FLOAT16_VALUE(     -5.5), SIMDE_FLOAT16_VALUE( -24432.0), SIMDE_FLOAT16_VALUE(     -1.5), SIMDE_FLOAT16_VALUE(  11448.0) },
+      { INT16_C(   862), INT16_C( 17952), INT16_C(-32768), INT16_C(-32688), INT16_C(-10896), INT16_C( 27472), INT16_C(-32768), INT16_C( -6904),
+        INT16_C(     0), INT16_C( -2968), INT16_C(-24480), INT16_C(     0), INT16_C(-32768), INT16_C( -2556), INT16_C(-20288), INT16_C( 26912),
+        INT16_C(     0), INT16_C( 17424), INT16_C(-12784), INT16_C(-29600), INT16_C(-32768), INT16_C(     0), INT16_C( -7672), INT16_C(-32768),
+        INT16_C(  7004), INT16_C(    -2), INT16_C(    -2), INT16_C(-27632), INT16_C(    -6), INT16_C(-24432), INT16_C(    -2), INT16_C( 11448) } },
+    { { SIMDE_FLOAT16_VALUE(   8720.0), SIMDE_FLOAT16_VALUE(      0.5), SIMDE_FLOAT16_VALUE(  -8248.0), SIMDE_FLOAT16_VALUE(   9552.0),
+        SIMDE_FLOAT16_VALUE(      3.5), SIMDE_FLOAT16_VALUE(  26096.0), SIMDE_FLOAT16_VALUE( -27520.0), SIMDE_FLOAT16_VALUE(  14152.0),
+        SIMDE_FLOAT16_VALUE(   6296.0), SIMDE_FLOAT16_VALUE(   1556.0), SIMDE_FLOAT16_VALUE(  34208.0), SIMDE_FLOAT16_VALUE( -39648.0),
+        SIMDE_FLOAT16_VALUE(  34016.0), SIMDE_FLOAT16_VALUE( -39776.0), SIMDE_FLOAT16_VALUE(     -1.5), SIMDE_FLOAT16_VALUE(     -0.5),
+        SIMDE_FLOAT16_VALUE(  -2298.0), SIMDE_FLOAT16_VALUE(      3.5), SIMDE_FLOAT16_VALUE(  23616.0), SIMDE_FLOAT16_VALUE(  25728.0),
+        SIMDE_FLOAT16_VALUE( -25936.0), SIMDE_FLOAT16_VALUE(  -3852.0), SIMDE_FLOAT16_VALUE(  12664.0), SIMDE_FLOAT16_VALUE(  -2486.0),
+        SIMDE_FLOAT16_VALUE(      0.5), SIMDE_FLOAT16_VALUE(      1.5), SIMDE_FLOAT16_VALUE(  10920.0), SIMDE_FLOAT16_VALUE(  23344.0),
+        SIMDE_FLOAT16_VALUE(  34912.0), SIMDE_FLOAT16_VALUE(  -3318.0), SIMDE_FLOAT16_VALUE( -18256.0), SIMDE_FLOAT16_VALUE(  12112.0) },
+      { INT16_C(  8720), INT16_C(     0), INT16_C( -8248), INT16_C(  9552), INT16_C(     4), INT16_C( 26096), INT16_C(-27520), INT16_C( 14152),
+        INT16_C(  6296), INT16_C(  1556), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(-32768), INT16_C(    -2), INT16_C(     0),
+        INT16_C( -2298), INT16_C(     4), INT16_C( 23616), INT16_C( 25728), INT16_C(-25936), INT16_C( -3852), INT16_C( 12664), INT16_C( -2486),
+        INT16_C(     0), INT16_C(     2), INT16_C( 10920), INT16_C( 23344), INT16_C(-32768), INT16_C( -3318), INT16_C(-18256), INT16_C( 12112) } },
+    { { SIMDE_FLOAT16_VALUE(   2746.0), SIMDE_FLOAT16_VALUE(     -5.5), SIMDE_FLOAT16_VALUE(      0.5), SIMDE_FLOAT16_VALUE( -26896.0),
+        SIMDE_FLOAT16_VALUE( -39424.0), SIMDE_FLOAT16_VALUE(   8984.0), SIMDE_FLOAT16_VALUE(   2974.0), SIMDE_FLOAT16_VALUE(  39264.0),
+        SIMDE_FLOAT16_VALUE(  -6824.0), SIMDE_FLOAT16_VALUE(  19792.0), SIMDE_FLOAT16_VALUE(  32336.0), SIMDE_FLOAT16_VALUE( -35072.0),
+        SIMDE_FLOAT16_VALUE(  28112.0), SIMDE_FLOAT16_VALUE( -15120.0), SIMDE_FLOAT16_VALUE(  38208.0), SIMDE_FLOAT16_VALUE(  15584.0),
+        SIMDE_FLOAT16_VALUE(  15224.0), SIMDE_FLOAT16_VALUE(     -3.5), SIMDE_FLOAT16_VALUE(  20864.0), SIMDE_FLOAT16_VALUE(     -3.5),
+        SIMDE_FLOAT16_VALUE( -35904.0), SIMDE_FLOAT16_VALUE( -33152.0), SIMDE_FLOAT16_VALUE(   3172.0), SIMDE_FLOAT16_VALUE(  32048.0),
+        SIMDE_FLOAT16_VALUE(  29904.0), SIMDE_FLOAT16_VALUE(  -8760.0), SIMDE_FLOAT16_VALUE( -37856.0), SIMDE_FLOAT16_VALUE(      0.5),
+        SIMDE_FLOAT16_VALUE( -18816.0), SIMDE_FLOAT16_VALUE( -38208.0), SIMDE_FLOAT16_VALUE(  -1503.0), SIMDE_FLOAT16_VALUE(  11536.0) },
+      { INT16_C(  2746), INT16_C(    -6), INT16_C(     0), INT16_C(-26896), INT16_C(-32768), INT16_C(  8984), INT16_C(  2974), INT16_C(-32768),
+        INT16_C( -6824), INT16_C( 19792), INT16_C( 32336), INT16_C(-32768), INT16_C( 28112), INT16_C(-15120), INT16_C(-32768), INT16_C( 15584),
+        INT16_C( 15224), INT16_C(    -4), INT16_C( 20864), INT16_C(    -4), INT16_C(-32768), INT16_C(-32768), INT16_C(  3172), INT16_C( 32048),
+        INT16_C( 29904), INT16_C( -8760), INT16_C(-32768), INT16_C(     0), INT16_C(-18816), INT16_C(-32768), INT16_C( -1503), INT16_C( 11536) } },
+    { { SIMDE_FLOAT16_VALUE(      0.5), SIMDE_FLOAT16_VALUE( -36192.0), SIMDE_FLOAT16_VALUE(  11120.0), SIMDE_FLOAT16_VALUE(      2.5),
+        SIMDE_FLOAT16_VALUE(      0.5), SIMDE_FLOAT16_VALUE(      3.5), SIMDE_FLOAT16_VALUE(  32608.0), SIMDE_FLOAT16_VALUE(     -1.5),
+        SIMDE_FLOAT16_VALUE(  36640.0), SIMDE_FLOAT16_VALUE(  34272.0), SIMDE_FLOAT16_VALUE(   -263.0), SIMDE_FLOAT16_VALUE(  10904.0),
+        SIMDE_FLOAT16_VALUE(     -1.5), SIMDE_FLOAT16_VALUE(  22896.0), SIMDE_FLOAT16_VALUE( -33088.0), SIMDE_FLOAT16_VALUE( -11736.0),
+        SIMDE_FLOAT16_VALUE(   4964.0), SIMDE_FLOAT16_VALUE(  -1093.0), SIMDE_FLOAT16_VALUE(      0.5), SIMDE_FLOAT16_VALUE( -29120.0),
+        SIMDE_FLOAT16_VALUE( -14800.0), SIMDE_FLOAT16_VALUE(  20576.0), SIMDE_FLOAT16_VALUE(  38848.0), SIMDE_FLOAT16_VALUE( -14744.0),
+        SIMDE_FLOAT16_VALUE(  25008.0), SIMDE_FLOAT16_VALUE(    536.0), SIMDE_FLOAT16_VALUE(     -2.5), SIMDE_FLOAT16_VALUE(  -6552.0),
+        SIMDE_FLOAT16_VALUE(   7068.0), SIMDE_FLOAT16_VALUE( -16208.0), SIMDE_FLOAT16_VALUE(  18336.0), SIMDE_FLOAT16_VALUE(      0.5) },
+      { INT16_C(     0), INT16_C(-32768), INT16_C( 11120), INT16_C(     2), INT16_C(     0), INT16_C(     4), INT16_C( 32608), INT16_C(    -2),
+        INT16_C(-32768), INT16_C(-32768), INT16_C(  -263), INT16_C( 10904), INT16_C(    -2), INT16_C( 22896), INT16_C(-32768), INT16_C(-11736),
+        INT16_C(  4964), INT16_C( -1093), INT16_C(     0), INT16_C(-29120), INT16_C(-14800), INT16_C( 20576), INT16_C(-32768), INT16_C(-14744),
+        INT16_C( 25008), INT16_C(   536), INT16_C(    -2), INT16_C( -6552), INT16_C(  7068), INT16_C(-16208), INT16_C( 18336), INT16_C(     0) } },
+    { { SIMDE_FLOAT16_VALUE(  10144.0), SIMDE_FLOAT16_VALUE(  -1913.0), SIMDE_FLOAT16_VALUE(   7828.0), SIMDE_FLOAT16_VALUE(  -5548.0),
+        SIMDE_FLOAT16_VALUE(      1.5), SIMDE_FLOAT16_VALUE(  -8464.0), SIMDE_FLOAT16_VALUE(   5160.0), SIMDE_FLOAT16_VALUE( -39968.0),
+        SIMDE_FLOAT16_VALUE( -32304.0), SIMDE_FLOAT16_VALUE(     -2.5), SIMDE_FLOAT16_VALUE( -37856.0), SIMDE_FLOAT16_VALUE( -19888.0),
+        SIMDE_FLOAT16_VALUE(      4.5), SIMDE_FLOAT16_VALUE(  37792.0), SIMDE_FLOAT16_VALUE(     -1.5), SIMDE_FLOAT16_VALUE( -20032.0),
+        SIMDE_FLOAT16_VALUE(      0.5), SIMDE_FLOAT16_VALUE( -36960.0), SIMDE_FLOAT16_VALUE(  32048.0), SIMDE_FLOAT16_VALUE( -19488.0),
+        SIMDE_FLOAT16_VALUE(   8848.0), SIMDE_FLOAT16_VALUE( -33216.0), SIMDE_FLOAT16_VALUE( -26016.0), SIMDE_FLOAT16_VALUE( -16016.0),
+        SIMDE_FLOAT16_VALUE(  24992.0), SIMDE_FLOAT16_VALUE(  12048.0), SIMDE_FLOAT16_VALUE( -25568.0), SIMDE_FLOAT16_VALUE(  39392.0),
+        SIMDE_FLOAT16_VALUE( -35072.0), SIMDE_FLOAT16_VALUE(  -2982.0), SIMDE_FLOAT16_VALUE(  -8004.0), SIMDE_FLOAT16_VALUE(  15896.0) },
+      { INT16_C( 10144), INT16_C( -1913), INT16_C(  7828), INT16_C( -5548), INT16_C(     2), INT16_C( -8464), INT16_C(  5160), INT16_C(-32768),
+        INT16_C(-32304), INT16_C(    -2), INT16_C(-32768), INT16_C(-19888), INT16_C(     4), INT16_C(-32768), INT16_C(    -2), INT16_C(-20032),
+        INT16_C(     0), INT16_C(-32768), INT16_C( 32048), INT16_C(-19488), INT16_C(  8848), INT16_C(-32768), INT16_C(-26016), INT16_C(-16016),
+        INT16_C( 24992), INT16_C( 12048), INT16_C(-25568), INT16_C(-32768), INT16_C(-32768), INT16_C( -2982), INT16_C( -8004), INT16_C( 15896) } },
+    { { SIMDE_FLOAT16_VALUE( -21536.0), SIMDE_FLOAT16_VALUE(  15480.0), SIMDE_FLOAT16_VALUE(     -0.5), SIMDE_FLOAT16_VALUE(  11632.0),
+        SIMDE_FLOAT16_VALUE( -10400.0), SIMDE_FLOAT16_VALUE( -13752.0), SIMDE_FLOAT16_VALUE(  28608.0), SIMDE_FLOAT16_VALUE(  -6708.0),
+        SIMDE_FLOAT16_VALUE( -35520.0), SIMDE_FLOAT16_VALUE(   3972.0), SIMDE_FLOAT16_VALUE(  17184.0), SIMDE_FLOAT16_VALUE( -30304.0),
+        SIMDE_FLOAT16_VALUE(  39520.0), SIMDE_FLOAT16_VALUE(  16480.0), SIMDE_FLOAT16_VALUE(   9888.0), SIMDE_FLOAT16_VALUE(   8640.0),
+        SIMDE_FLOAT16_VALUE( -19664.0), SIMDE_FLOAT16_VALUE( -20816.0), SIMDE_FLOAT16_VALUE(     -1.5), SIMDE_FLOAT16_VALUE(      1.5),
+        SIMDE_FLOAT16_VALUE(      2.5), SIMDE_FLOAT16_VALUE( -28816.0), SIMDE_FLOAT16_VALUE( -18208.0), SIMDE_FLOAT16_VALUE( -15392.0),
+        SIMDE_FLOAT16_VALUE(      1.5), SIMDE_FLOAT16_VALUE( -23824.0), SIMDE_FLOAT16_VALUE(      3.5), SIMDE_FLOAT16_VALUE(     -0.5),
+        SIMDE_FLOAT16_VALUE( -16448.0), SIMDE_FLOAT16_VALUE(  -4996.0), SIMDE_FLOAT16_VALUE( -15376.0), SIMDE_FLOAT16_VALUE( -13552.0) },
+      { INT16_C(-21536), INT16_C( 15480), INT16_C(     0), INT16_C( 11632), INT16_C(-10400), INT16_C(-13752), INT16_C( 28608), INT16_C( -6708),
+        INT16_C(-32768), INT16_C(  3972), INT16_C( 17184), INT16_C(-30304), INT16_C(-32768), INT16_C( 16480), INT16_C(  9888), INT16_C(  8640),
+        INT16_C(-19664), INT16_C(-20816), INT16_C(    -2), INT16_C(     2), INT16_C(     2), INT16_C(-28816), INT16_C(-18208), INT16_C(-15392),
+        INT16_C(     2), INT16_C(-23824), INT16_C(     4), INT16_C(     0), INT16_C(-16448), INT16_C( -4996), INT16_C(-15376), INT16_C(-13552) } },
+    { { SIMDE_FLOAT16_VALUE(  -6920.0), SIMDE_FLOAT16_VALUE( -14648.0), SIMDE_FLOAT16_VALUE(     -0.5), SIMDE_FLOAT16_VALUE( -33664.0),
+        SIMDE_FLOAT16_VALUE(  -9760.0), SIMDE_FLOAT16_VALUE( -10520.0), SIMDE_FLOAT16_VALUE(  -9232.0), SIMDE_FLOAT16_VALUE(      1.5),
+        SIMDE_FLOAT16_VALUE( -18864.0), SIMDE_FLOAT16_VALUE(     -1.5), SIMDE_FLOAT16_VALUE( -33216.0), SIMDE_FLOAT16_VALUE( -13296.0),
+        SIMDE_FLOAT16_VALUE(     -2.5), SIMDE_FLOAT16_VALUE( -32080.0), SIMDE_FLOAT16_VALUE(  -5888.0), SIMDE_FLOAT16_VALUE( -35168.0),
+        SIMDE_FLOAT16_VALUE( -11368.0), SIMDE_FLOAT16_VALUE( -26224.0), SIMDE_FLOAT16_VALUE(  -7032.0), SIMDE_FLOAT16_VALUE( -26496.0),
+        SIMDE_FLOAT16_VALUE(      1.5), SIMDE_FLOAT16_VALUE( -31328.0), SIMDE_FLOAT16_VALUE( -30624.0), SIMDE_FLOAT16_VALUE(  32128.0),
+        SIMDE_FLOAT16_VALUE(     -0.5), SIMDE_FLOAT16_VALUE( -23792.0), SIMDE_FLOAT16_VALUE(  30608.0), SIMDE_FLOAT16_VALUE(      0.5),
+        SIMDE_FLOAT16_VALUE(  28928.0), SIMDE_FLOAT16_VALUE(  31376.0), SIMDE_FLOAT16_VALUE( -36192.0), SIMDE_FLOAT16_VALUE( -26496.0) },
+      { INT16_C( -6920), INT16_C(-14648), INT16_C(     0), INT16_C(-32768), INT16_C( -9760), INT16_C(-10520), INT16_C( -9232), INT16_C(     2),
+        INT16_C(-18864), INT16_C(    -2), INT16_C(-32768), INT16_C(-13296), INT16_C(    -2), INT16_C(-32080), INT16_C( -5888), INT16_C(-32768),
+        INT16_C(-11368), INT16_C(-26224), INT16_C( -7032), INT16_C(-26496), INT16_C(     2), INT16_C(-31328), INT16_C(-30624), INT16_C( 32128),
+        INT16_C(     0), INT16_C(-23792), INT16_C( 30608), INT16_C(     0), INT16_C( 28928), INT16_C( 31376), INT16_C(-32768), INT16_C(-26496) } },
+    { { SIMDE_FLOAT16_VALUE(  19616.0), SIMDE_FLOAT16_VALUE(   4352.0), SIMDE_FLOAT16_VALUE(   -486.2), SIMDE_FLOAT16_VALUE(  32992.0),
+        SIMDE_FLOAT16_VALUE(  -7680.0), SIMDE_FLOAT16_VALUE(  11032.0), SIMDE_FLOAT16_VALUE(   8020.0), SIMDE_FLOAT16_VALUE( -37120.0),
+        SIMDE_FLOAT16_VALUE( -34848.0), SIMDE_FLOAT16_VALUE(   2998.0), SIMDE_FLOAT16_VALUE(  18592.0), SIMDE_FLOAT16_VALUE(  10456.0),
+        SIMDE_FLOAT16_VALUE(  31680.0), SIMDE_FLOAT16_VALUE(  15728.0), SIMDE_FLOAT16_VALUE(  -4112.0), SIMDE_FLOAT16_VALUE(  16928.0),
+        SIMDE_FLOAT16_VALUE( -15120.0), SIMDE_FLOAT16_VALUE( -20032.0), SIMDE_FLOAT16_VALUE(  33792.0), SIMDE_FLOAT16_VALUE(  11000.0),
+        SIMDE_FLOAT16_VALUE(     -0.5), SIMDE_FLOAT16_VALUE(  -2782.0), SIMDE_FLOAT16_VALUE(      1.5), SIMDE_FLOAT16_VALUE(  -4088.0),
+        SIMDE_FLOAT16_VALUE( -34208.0), SIMDE_FLOAT16_VALUE( -24016.0), SIMDE_FLOAT16_VALUE(  -7348.0), SIMDE_FLOAT16_VALUE(   2614.0),
+        SIMDE_FLOAT16_VALUE(  -5964.0), SIMDE_FLOAT16_VALUE(     -2.5), SIMDE_FLOAT16_VALUE(      0.5), SIMDE_FLOAT16_VALUE( -37536.0) },
+      { INT16_C( 19616), INT16_C(  4352), INT16_C(  -486), INT16_C(-32768), INT16_C( -7680), INT16_C( 11032), INT16_C(  8020), INT16_C(-32768),
+        INT16_C(-32768), INT16_C(  2998), INT16_C( 18592), INT16_C( 10456), INT16_C( 31680), INT16_C( 15728), INT16_C( -4112), INT16_C( 16928),
+        INT16_C(-15120), INT16_C(-20032), INT16_C(-32768), INT16_C( 11000), INT16_C(     0), INT16_C( -2782), INT16_C(     2), INT16_C( -4088),
+        INT16_C(-32768), INT16_C(-24016), INT16_C( -7348), INT16_C(  2614), INT16_C( -5964), INT16_C(    -2), INT16_C(     0), INT16_C(-32768) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512h a = simde_mm512_loadu_ph(test_vec[i].a);
+    simde__m512i r = simde_mm512_cvtph_epi16(a);
+    simde_test_x86_assert_equal_i16x32(r, simde_mm512_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+#endif
+
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm_cvtepi16_ph (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t a[8];
+    const simde_float16 r[8];
+  } test_vec[] = {
+    { { INT16_C( 25765), INT16_C( 29671), INT16_C( 28426), INT16_C(  1589), INT16_C(-19796), INT16_C( 12613), INT16_C(   218), INT16_C( 23689) },
+      { SIMDE_FLOAT16_VALUE(  25760.0), SIMDE_FLOAT16_VALUE(  29664.0), SIMDE_FLOAT16_VALUE(  28432.0), SIMDE_FLOAT16_VALUE(   1589.0),
+        SIMDE_FLOAT16_VALUE( -19792.0), SIMDE_FLOAT16_VALUE(  12616.0), SIMDE_FLOAT16_VALUE(    218.0), SIMDE_FLOAT16_VALUE(  23696.0) } },
+    { { INT16_C(  -134), INT16_C(  1366), INT16_C(  9707), INT16_C( 16313), INT16_C(-19866), INT16_C(-27494), INT16_C(  8104), INT16_C(  1048) },
+      { SIMDE_FLOAT16_VALUE(   -134.0), SIMDE_FLOAT16_VALUE(   1366.0), SIMDE_FLOAT16_VALUE(   9704.0), SIMDE_FLOAT16_VALUE(  16312.0),
+        SIMDE_FLOAT16_VALUE( -19872.0), SIMDE_FLOAT16_VALUE( -27488.0), SIMDE_FLOAT16_VALUE(   8104.0), SIMDE_FLOAT16_VALUE(   1048.0) } },
+    { { INT16_C(   744), INT16_C(   496), INT16_C(  1208), INT16_C(   318), INT16_C(-24724), INT16_C(  1367), INT16_C(-23047), INT16_C(  9162) },
+      { SIMDE_FLOAT16_VALUE(    744.0), SIMDE_FLOAT16_VALUE(    496.0), SIMDE_FLOAT16_VALUE(   1208.0), SIMDE_FLOAT16_VALUE(    318.0),
+        SIMDE_FLOAT16_VALUE( -24720.0), SIMDE_FLOAT16_VALUE(   1367.0), SIMDE_FLOAT16_VALUE( -23040.0), SIMDE_FLOAT16_VALUE(   9160.0) } },
+    { { INT16_C(   845), INT16_C(   681), INT16_C( 16643), INT16_C(   861), INT16_C(-24133), INT16_C(  1321), INT16_C( 20255), INT16_C(-19274) },
+      { SIMDE_FLOAT16_VALUE(    845.0), SIMDE_FLOAT16_VALUE(    681.0), SIMDE_FLOAT16_VALUE(  16640.0), SIMDE_FLOAT16_VALUE(    861.0),
+        SIMDE_FLOAT16_VALUE( -24128.0), SIMDE_FLOAT16_VALUE(   1321.0), SIMDE_FLOAT16_VALUE(  20256.0), SIMDE_FLOAT16_VALUE( -19280.0) } },
+    { { INT16_C(  2045), INT16_C( -2769), INT16_C( 29849), INT16_C( -1077), INT16_C( 25221), INT16_C( -3704), INT16_C(  1790), INT16_C(  -981) },
+      { SIMDE_FLOAT16_VALUE(   2045.0), SIMDE_FLOAT16_VALUE(  -2768.0), SIMDE_FLOAT16_VALUE(  29856.0), SIMDE_FLOAT16_VALUE(  -1077.0),
+        SIMDE_FLOAT16_VALUE(  25216.0), SIMDE_FLOAT16_VALUE(  -3704.0), SIMDE_FLOAT16_VALUE(   1790.0), SIMDE_FLOAT16_VALUE(   -981.0) } },
+    { { INT16_C(-22718), INT16_C(-19656), INT16_C( -3185), INT16_C( -1901), INT16_C( 24166), INT16_C(  1646), INT16_C(  1725), INT16_C(-19420) },
+      { SIMDE_FLOAT16_VALUE( -22720.0), SIMDE_FLOAT16_VALUE( -19648.0), SIMDE_FLOAT16_VALUE(  -3184.0), SIMDE_FLOAT16_VALUE(  -1901.0),
+        SIMDE_FLOAT16_VALUE(  24160.0), SIMDE_FLOAT16_VALUE(   1646.0), SIMDE_FLOAT16_VALUE(   1725.0), SIMDE_FLOAT16_VALUE( -19424.0) } },
+    { { INT16_C(  2068), INT16_C( -1879), INT16_C( 29903), INT16_C(-15203), INT16_C( -1423), INT16_C(  4449), INT16_C( -7045), INT16_C(-13318) },
+      { SIMDE_FLOAT16_VALUE(   2068.0), SIMDE_FLOAT16_VALUE(  -1879.0), SIMDE_FLOAT16_VALUE(  29904.0), SIMDE_FLOAT16_VALUE( -15200.0),
+        SIMDE_FLOAT16_VALUE(  -1423.0), SIMDE_FLOAT16_VALUE(   4448.0), SIMDE_FLOAT16_VALUE(  -7044.0), SIMDE_FLOAT16_VALUE( -13320.0) } },
+    { { INT16_C(  -422), INT16_C(-25835), INT16_C(-24700), INT16_C(   352), INT16_C( 17177), INT16_C(  1719), INT16_C(  1288), INT16_C( 10511) },
+      { SIMDE_FLOAT16_VALUE(   -422.0), SIMDE_FLOAT16_VALUE( -25840.0), SIMDE_FLOAT16_VALUE( -24704.0), SIMDE_FLOAT16_VALUE(    352.0),
+        SIMDE_FLOAT16_VALUE(  17184.0), SIMDE_FLOAT16_VALUE(   1719.0), SIMDE_FLOAT16_VALUE(   1288.0), SIMDE_FLOAT16_VALUE(  10512.0) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_epi16(test_vec[i].a);
+    simde__m128h r = simde_mm_cvtepi16_ph(a);
+    simde_test_x86_assert_equal_f16x8(r, simde_mm_loadu_ph(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm256_cvtepi16_ph (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t a[16];
+    const simde_float16 r[16];
+  } test_vec[] = {
+    { { INT16_C(   809), INT16_C(  1776), INT16_C(   661), INT16_C(-11122), INT16_C(-25434), INT16_C(-26480), INT16_C( 31878), INT16_C(   607),
+        INT16_C(-28741), INT16_C(   409), INT16_C(   121), INT16_C( 19020), INT16_C(  -285), INT16_C(-30383), INT16_C(   -15), INT16_C(    -7) },
+      { SIMDE_FLOAT16_VALUE(    809.0), SIMDE_FLOAT16_VALUE(   1776.0), SIMDE_FLOAT16_VALUE(    661.0), SIMDE_FLOAT16_VALUE( -11120.0),
+        SIMDE_FLOAT16_VALUE( -25440.0), SIMDE_FLOAT16_VALUE( -26480.0), SIMDE_FLOAT16_VALUE(  31872.0), SIMDE_FLOAT16_VALUE(    607.0),
+        SIMDE_FLOAT16_VALUE( -28736.0), SIMDE_FLOAT16_VALUE(    409.0), SIMDE_FLOAT16_VALUE(    121.0), SIMDE_FLOAT16_VALUE(  19024.0),
+        SIMDE_FLOAT16_VALUE(   -285.0), SIMDE_FLOAT16_VALUE( -30384.0), SIMDE_FLOAT16_VALUE(    -15.0), SIMDE_FLOAT16_VALUE(     -7.0) } },
+    { { INT16_C( 27767), INT16_C(  1943), INT16_C( -1022), INT16_C( 18381), INT16_C( 16463), INT16_C(  -689), INT16_C(  1918), INT16_C(-11984),
+        INT16_C( -1948), INT16_C( 19356), INT16_C( -1578), INT16_C( 21199), INT16_C(  1953), INT16_C(  -476), INT16_C( 10727), INT16_C(  1812) },
+      { SIMDE_FLOAT16_VALUE(  27760.0), SIMDE_FLOAT16_VALUE(   1943.0), SIMDE_FLOAT16_VALUE(  -1022.0), SIMDE_FLOAT16_VALUE(  18384.0),
+        SIMDE_FLOAT16_VALUE(  16464.0), SIMDE_FLOAT16_VALUE(   -689.0), SIMDE_FLOAT16_VALUE(   1918.0), SIMDE_FLOAT16_VALUE( -11984.0),
+        SIMDE_FLOAT16_VALUE(  -1948.0), SIMDE_FLOAT16_VALUE(  19360.0), SIMDE_FLOAT16_VALUE(  -1578.0), SIMDE_FLOAT16_VALUE(  21200.0),
+        SIMDE_FLOAT16_VALUE(   1953.0), SIMDE_FLOAT16_VALUE(   -476.0), SIMDE_FLOAT16_VALUE(  10728.0), SIMDE_FLOAT16_VALUE(   1812.0) } },
+    { { INT16_C(-29151), INT16_C(-30604), INT16_C(   861), INT16_C(-23898), INT16_C(-32158), INT16_C( -1723), INT16_C(   725), INT16_C( -9051),
+        INT16_C( -4407), INT16_C(-27359), INT16_C(  -170), INT16_C( 32586), INT16_C(-21577), INT16_C( 26732), INT16_C(-14672), INT16_C( 17223) },
+      { SIMDE_FLOAT16_VALUE( -29152.0), SIMDE_FLOAT16_VALUE( -30608.0), SIMDE_FLOAT16_VALUE(    861.0), SIMDE_FLOAT16_VALUE( -23904.0),
+        SIMDE_FLOAT16_VALUE( -32160.0), SIMDE_FLOAT16_VALUE(  -1723.0), SIMDE_FLOAT16_VALUE(    725.0), SIMDE_FLOAT16_VALUE(  -9048.0),
+        SIMDE_FLOAT16_VALUE(  -4408.0), SIMDE_FLOAT16_VALUE( -27360.0), SIMDE_FLOAT16_VALUE(   -170.0), SIMDE_FLOAT16_VALUE(  32592.0),
+        SIMDE_FLOAT16_VALUE( -21584.0), SIMDE_FLOAT16_VALUE(  26736.0), SIMDE_FLOAT16_VALUE( -14672.0), SIMDE_FLOAT16_VALUE(  17216.0) } },
+    { { INT16_C(  3741), INT16_C( -1547), INT16_C(-28639), INT16_C( 16730), INT16_C( -7875), INT16_C(-11021), INT16_C( -1831), INT16_C( 24583),
+        INT16_C( 18085), INT16_C(  -802), INT16_C(-13669), INT16_C(   439), INT16_C( -5597), INT16_C( -2042), INT16_C(-31247), INT16_C(   319) },
+      { SIMDE_FLOAT16_VALUE(   3740.0), SIMDE_FLOAT16_VALUE(  -1547.0), SIMDE_FLOAT16_VALUE( -28640.0), SIMDE_FLOAT16_VALUE(  16736.0),
+        SIMDE_FLOAT16_VALUE(  -7876.0), SIMDE_FLOAT16_VALUE( -11024.0), SIMDE_FLOAT16_VALUE(  -1831.0), SIMDE_FLOAT16_VALUE(  24576.0),
+        SIMDE_FLOAT16_VALUE(  18080.0), SIMDE_FLOAT16_VALUE(   -802.0), SIMDE_FLOAT16_VALUE( -13672.0), SIMDE_FLOAT16_VALUE(    439.0),
+        SIMDE_FLOAT16_VALUE(  -5596.0), SIMDE_FLOAT16_VALUE(  -2042.0), SIMDE_FLOAT16_VALUE( -31248.0), SIMDE_FLOAT16_VALUE(    319.0) } },
+    { { INT16_C( -7040), INT16_C(  4196), INT16_C(  1978), INT16_C( 21028), INT16_C(-22978), INT16_C( 29462), INT16_C( 30175), INT16_C(-32426),
+        INT16_C(-31402), INT16_C(-24196), INT16_C( 16294), INT16_C( 27384), INT16_C(  1068), INT16_C( 19510), INT16_C( 28752), INT16_C(  -159) },
+      { SIMDE_FLOAT16_VALUE(  -7040.0), SIMDE_FLOAT16_VALUE(   4196.0), SIMDE_FLOAT16_VALUE(   1978.0), SIMDE_FLOAT16_VALUE(  21024.0),
+        SIMDE_FLOAT16_VALUE( -22976.0), SIMDE_FLOAT16_VALUE(  29456.0), SIMDE_FLOAT16_VALUE(  30176.0), SIMDE_FLOAT16_VALUE( -32432.0),
+        SIMDE_FLOAT16_VALUE( -31408.0), SIMDE_FLOAT16_VALUE( -24192.0), SIMDE_FLOAT16_VALUE(  16296.0), SIMDE_FLOAT16_VALUE(  27392.0),
+        SIMDE_FLOAT16_VALUE(   1068.0), SIMDE_FLOAT16_VALUE(  19504.0), SIMDE_FLOAT16_VALUE(  28752.0), SIMDE_FLOAT16_VALUE(   -159.0) } },
+    { { INT16_C(   984), INT16_C(   401), INT16_C( 30581), INT16_C(  1517), INT16_C(  -116), INT16_C( 14855), INT16_C(  5270), INT16_C(   924),
+        INT16_C(   616), INT16_C(  1200), INT16_C(   102), INT16_C(   907), INT16_C(-23585), INT16_C( -7765), INT16_C(-19047), INT16_C(  -351) },
+      { SIMDE_FLOAT16_VALUE(    984.0), SIMDE_FLOAT16_VALUE(    401.0), SIMDE_FLOAT16_VALUE(  30576.0), SIMDE_FLOAT16_VALUE(   1517.0),
+        SIMDE_FLOAT16_VALUE(   -116.0), SIMDE_FLOAT16_VALUE(  14856.0), SIMDE_FLOAT16_VALUE(   5272.0), SIMDE_FLOAT16_VALUE(    924.0),
+        SIMDE_FLOAT16_VALUE(    616.0), SIMDE_FLOAT16_VALUE(   1200.0), SIMDE_FLOAT16_VALUE(    102.0), SIMDE_FLOAT16_VALUE(    907.0),
+        SIMDE_FLOAT16_VALUE( -23584.0), SIMDE_FLOAT16_VALUE(  -7764.0), SIMDE_FLOAT16_VALUE( -19040.0), SIMDE_FLOAT16_VALUE(   -351.0) } },
+    { { INT16_C(-10024), INT16_C( -3806), INT16_C(  -730), INT16_C(  1975), INT16_C( 14116), INT16_C( -1739), INT16_C(-14988), INT16_C( -4983),
+        INT16_C( 17422), INT16_C( 28822), INT16_C(-19116), INT16_C(  1023), INT16_C(  4327), INT16_C( -2039), INT16_C(    -4), INT16_C(   410) },
+      { SIMDE_FLOAT16_VALUE( -10024.0), SIMDE_FLOAT16_VALUE(  -3806.0), SIMDE_FLOAT16_VALUE(   -730.0), SIMDE_FLOAT16_VALUE(   1975.0),
+        SIMDE_FLOAT16_VALUE(  14112.0), SIMDE_FLOAT16_VALUE(  -1739.0), SIMDE_FLOAT16_VALUE( -14992.0), SIMDE_FLOAT16_VALUE(  -4984.0),
+        SIMDE_FLOAT16_VALUE(  17424.0), SIMDE_FLOAT16_VALUE(  28816.0), SIMDE_FLOAT16_VALUE( -19120.0), SIMDE_FLOAT16_VALUE(   1023.0),
+        SIMDE_FLOAT16_VALUE(   4328.0), SIMDE_FLOAT16_VALUE(  -2039.0), SIMDE_FLOAT16_VALUE(     -4.0), SIMDE_FLOAT16_VALUE(    410.0) } },
+    { { INT16_C(   826), INT16_C( 23476), INT16_C(   892), INT16_C( -3098), INT16_C(-14980), INT16_C(-25208), INT16_C( -2622), INT16_C(   645),
+        INT16_C( -6446), INT16_C( -1921), INT16_C(-30724), INT16_C(  1195), INT16_C( 29226), INT16_C( 15297), INT16_C( -6427), INT16_C(  -591) },
+      { SIMDE_FLOAT16_VALUE(    826.0), SIMDE_FLOAT16_VALUE(  23472.0), SIMDE_FLOAT16_VALUE(    892.0), SIMDE_FLOAT16_VALUE(  -3098.0),
+        SIMDE_FLOAT16_VALUE( -14976.0), SIMDE_FLOAT16_VALUE( -25216.0), SIMDE_FLOAT16_VALUE(  -2622.0), SIMDE_FLOAT16_VALUE(    645.0),
+        SIMDE_FLOAT16_VALUE(  -6448.0), SIMDE_FLOAT16_VALUE(  -1921.0), SIMDE_FLOAT16_VALUE( -30720.0), SIMDE_FLOAT16_VALUE(   1195.0),
+        SIMDE_FLOAT16_VALUE(  29232.0), SIMDE_FLOAT16_VALUE(  15296.0), SIMDE_FLOAT16_VALUE(  -6428.0), SIMDE_FLOAT16_VALUE(   -591.0) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256h r = simde_mm256_cvtepi16_ph(a);
+    simde_test_x86_assert_equal_f16x16(r, simde_mm256_loadu_ph(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm512_cvtepi16_ph (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t a[32];
+    const simde_float16 r[32];
+  } test_vec[] = {
+    { { INT16_C( 25632), INT16_C(-19158), INT16_C( -1369), INT16_C( -8540), INT16_C(-16368), INT16_C(-15762), INT16_C( -2545), INT16_C(-10780),
+        INT16_C(  1466), INT16_C( -4634), INT16_C( -1919), INT16_C(  9547), INT16_C( 19271), INT16_C( -1196), INT16_C( 13961), INT16_C(   175),
+        INT16_C(   218), INT16_C(  1048), INT16_C( -7897), INT16_C( 11520), INT16_C(-17953), INT16_C( -1735), INT16_C(  -549), INT16_C( 20449),
+        INT16_C(  9625), INT16_C( 10031), INT16_C(-32380), INT16_C(  1445), INT16_C(-31493), INT16_C(-13531), INT16_C( 19128), INT16_C(  -130) },
+      { SIMDE_FLOAT16_VALUE(  25632.0), SIMDE_FLOAT16_VALUE( -19152.0), SIMDE_FLOAT16_VALUE(  -1369.0), SIMDE_FLOAT16_VALUE(  -8544.0),
+        SIMDE_FLOAT16_VALUE( -16368.0), SIMDE_FLOAT16_VALUE( -15760.0), SIMDE_FLOAT16_VALUE(  -2544.0), SIMDE_FLOAT16_VALUE( -10784.0),
+        SIMDE_FLOAT16_VALUE(   1466.0), SIMDE_FLOAT16_VALUE(  -4632.0), SIMDE_FLOAT16_VALUE(  -1919.0), SIMDE_FLOAT16_VALUE(   9544.0),
+        SIMDE_FLOAT16_VALUE(  19264.0), SIMDE_FLOAT16_VALUE(  -1196.0), SIMDE_FLOAT16_VALUE(  13960.0), SIMDE_FLOAT16_VALUE(    175.0),
+        SIMDE_FLOAT16_VALUE(    218.0), SIMDE_FLOAT16_VALUE(   1048.0), SIMDE_FLOAT16_VALUE(  -7896.0), SIMDE_FLOAT16_VALUE(  11520.0),
+        SIMDE_FLOAT16_VALUE( -17952.0), SIMDE_FLOAT16_VALUE(  -1735.0), SIMDE_FLOAT16_VALUE(   -549.0), SIMDE_FLOAT16_VALUE(  20448.0),
+        SIMDE_FLOAT16_VALUE(   9624.0), SIMDE_FLOAT16_VALUE(  10032.0), SIMDE_FLOAT16_VALUE( -32384.0), SIMDE_FLOAT16_VALUE(   1445.0),
+        SIMDE_FLOAT16_VALUE( -31488.0), SIMDE_FLOAT16_VALUE( -13528.0), SIMDE_FLOAT16_VALUE(  19136.0), SIMDE_FLOAT16_VALUE(   -130.0) } },
+    { { INT16_C(  5900), INT16_C(-23841), INT16_C(  -256), INT16_C( 24182), INT16_C( -5846), INT16_C(  -152), INT16_C( -3150), INT16_C(   771),
+        INT16_C(-22869), INT16_C( 21548), INT16_C( 30796), INT16_C(  -932), INT16_C( 18764), INT16_C( 11445), INT16_C(-13274), INT16_C(  8321),
+        INT16_C(-21937), INT16_C( -1471), INT16_C(-18265), INT16_C(-21632), INT16_C( 28128), INT16_C( -7054), INT16_C(  7108), INT16_C( 22658),
+        INT16_C(-25717), INT16_C(-24040), INT16_C( 18834), INT16_C(  5755), INT16_C(  1893), INT16_C( 10758), INT16_C(-28680), INT16_C(  4994) },
+      { SIMDE_FLOAT16_VALUE(   5900.0), SIMDE_FLOAT16_VALUE( -23840.0), SIMDE_FLOAT16_VALUE(   -256.0), SIMDE_FLOAT16_VALUE(  24176.0),
+        SIMDE_FLOAT16_VALUE(  -5848.0), SIMDE_FLOAT16_VALUE(   -152.0), SIMDE_FLOAT16_VALUE(  -3150.0), SIMDE_FLOAT16_VALUE(    771.0),
+        SIMDE_FLOAT16_VALUE( -22864.0), SIMDE_FLOAT16_VALUE(  21552.0), SIMDE_FLOAT16_VALUE(  30800.0), SIMDE_FLOAT16_VALUE(   -932.0),
+        SIMDE_FLOAT16_VALUE(  18768.0), SIMDE_FLOAT16_VALUE(  11448.0), SIMDE_FLOAT16_VALUE( -13272.0), SIMDE_FLOAT16_VALUE(   8320.0),
+        SIMDE_FLOAT16_VALUE( -21936.0), SIMDE_FLOAT16_VALUE(  -1471.0), SIMDE_FLOAT16_VALUE( -18272.0), SIMDE_FLOAT16_VALUE( -21632.0),
+        SIMDE_FLOAT16_VALUE(  28128.0), SIMDE_FLOAT16_VALUE(  -7056.0), SIMDE_FLOAT16_VALUE(   7108.0), SIMDE_FLOAT16_VALUE(  22656.0),
+        SIMDE_FLOAT16_VALUE( -25712.0), SIMDE_FLOAT16_VALUE( -24032.0), SIMDE_FLOAT16_VALUE(  18832.0), SIMDE_FLOAT16_VALUE(   5756.0),
+        SIMDE_FLOAT16_VALUE(   1893.0), SIMDE_FLOAT16_VALUE(  10760.0), SIMDE_FLOAT16_VALUE( -28672.0), SIMDE_FLOAT16_VALUE(   4992.0) } },
+    { { INT16_C( 17395), INT16_C(  1532), INT16_C(  -632), INT16_C(  1251), INT16_C( -5357), INT16_C(-20962), INT16_C( -1726), INT16_C(-11258),
+        INT16_C(  -992), INT16_C(-19911), INT16_C( 23136), INT16_C(   604), INT16_C(-11480), INT16_C( -1728), INT16_C(  -699), INT16_C( -1135),
+        INT16_C(-25707), INT16_C(-26002), INT16_C(-31934), INT16_C( -1602), INT16_C(-10051), INT16_C(-11792), INT16_C(  1192), INT16_C(  6060),
+        INT16_C(-11128), INT16_C( -8710), INT16_C(-10911), INT16_C(   787), INT16_C(  -277), INT16_C( 13936), INT16_C(  -322), INT16_C(  2017) },
+      { SIMDE_FLOAT16_VALUE(  17392.0), SIMDE_FLOAT16_VALUE(   1532.0), SIMDE_FLOAT16_VALUE(   -632.0), SIMDE_FLOAT16_VALUE(   1251.0),
+        SIMDE_FLOAT16_VALUE(  -5356.0), SIMDE_FLOAT16_VALUE( -20960.0), SIMDE_FLOAT16_VALUE(  -1726.0), SIMDE_FLOAT16_VALUE( -11256.0),
+        SIMDE_FLOAT16_VALUE(   -992.0), SIMDE_FLOAT16_VALUE( -19904.0), SIMDE_FLOAT16_VALUE(  23136.0), SIMDE_FLOAT16_VALUE(    604.0),
+        SIMDE_FLOAT16_VALUE( -11480.0), SIMDE_FLOAT16_VALUE(  -1728.0), SIMDE_FLOAT16_VALUE(   -699.0), SIMDE_FLOAT16_VALUE(  -1135.0),
+        SIMDE_FLOAT16_VALUE( -25712.0), SIMDE_FLOAT16_VALUE( -26000.0), SIMDE_FLOAT16_VALUE( -31936.0), SIMDE_FLOAT16_VALUE(  -1602.0),
+        SIMDE_FLOAT16_VALUE( -10048.0), SIMDE_FLOAT16_VALUE( -11792.0), SIMDE_FLOAT16_VALUE(   1192.0), SIMDE_FLOAT16_VALUE(   6060.0),
+        SIMDE_FLOAT16_VALUE( -11128.0), SIMDE_FLOAT16_VALUE(  -8712.0), SIMDE_FLOAT16_VALUE( -10912.0), SIMDE_FLOAT16_VALUE(    787.0),
+        SIMDE_FLOAT16_VALUE(   -277.0), SIMDE_FLOAT16_VALUE(  13936.0), SIMDE_FLOAT16_VALUE(   -322.0), SIMDE_FLOAT16_VALUE(   2017.0) } },
+    { { INT16_C( 30275), INT16_C(-20782), INT16_C( 31891), INT16_C( 10125), INT16_C(  1196), INT16_C(  -579), INT16_C(  -989), INT16_C( 32531),
+        INT16_C(   382), INT16_C(  4080), INT16_C( 26468), INT16_C(   944), INT16_C( 24018), INT16_C(-13644), INT16_C(  5713), INT16_C(  1757),
+        INT16_C(  6500), INT16_C( -1706), INT16_C(-11635), INT16_C(   174), INT16_C( -1461), INT16_C( 28381), INT16_C(  1526), INT16_C(-22262),
+        INT16_C(-22214), INT16_C(-22535), INT16_C(  5265), INT16_C(   105), INT16_C(  4898), INT16_C(  -187), INT16_C(    12), INT16_C( 18898) },
+      { SIMDE_FLOAT16_VALUE(  30272.0), SIMDE_FLOAT16_VALUE( -20784.0), SIMDE_FLOAT16_VALUE(  31888.0), SIMDE_FLOAT16_VALUE(  10128.0),
+        SIMDE_FLOAT16_VALUE(   1196.0), SIMDE_FLOAT16_VALUE(   -579.0), SIMDE_FLOAT16_VALUE(   -989.0), SIMDE_FLOAT16_VALUE(  32528.0),
+        SIMDE_FLOAT16_VALUE(    382.0), SIMDE_FLOAT16_VALUE(   4080.0), SIMDE_FLOAT16_VALUE(  26464.0), SIMDE_FLOAT16_VALUE(    944.0),
+        SIMDE_FLOAT16_VALUE(  24016.0), SIMDE_FLOAT16_VALUE( -13648.0), SIMDE_FLOAT16_VALUE(   5712.0), SIMDE_FLOAT16_VALUE(   1757.0),
+        SIMDE_FLOAT16_VALUE(   6500.0), SIMDE_FLOAT16_VALUE(  -1706.0), SIMDE_FLOAT16_VALUE( -11632.0), SIMDE_FLOAT16_VALUE(    174.0),
+        SIMDE_FLOAT16_VALUE(  -1461.0), SIMDE_FLOAT16_VALUE(  28384.0), SIMDE_FLOAT16_VALUE(   1526.0), SIMDE_FLOAT16_VALUE( -22256.0),
+        SIMDE_FLOAT16_VALUE( -22208.0), SIMDE_FLOAT16_VALUE( -22528.0), SIMDE_FLOAT16_VALUE(   5264.0), SIMDE_FLOAT16_VALUE(    105.0),
+        SIMDE_FLOAT16_VALUE(   4896.0), SIMDE_FLOAT16_VALUE(   -187.0), SIMDE_FLOAT16_VALUE(     12.0), SIMDE_FLOAT16_VALUE(  18896.0) } },
+    { { INT16_C(   826), INT16_C(  -896), INT16_C(  4891), INT16_C(-24382), INT16_C(  1530), INT16_C( 11060), INT16_C(-29163), INT16_C( -1428),
+        INT16_C( -3092), INT16_C( 11206), INT16_C(  1009), INT16_C(-19236), INT16_C( 25122), INT16_C( -1981), INT16_C( 22853), INT16_C(-15379),
+        INT16_C(  3658), INT16_C( 12698), INT16_C( 32191), INT16_C(  -819), INT16_C(  -258), INT16_C(-22976), INT16_C(-32398), INT16_C(-29240),
+        INT16_C( 14529), INT16_C( 14150), INT16_C( -9076), INT16_C(-18854), INT16_C(-20142), INT16_C(  -440), INT16_C( -6848), INT16_C(  1565) },
+      { SIMDE_FLOAT16_VALUE(    826.0), SIMDE_FLOAT16_VALUE(   -896.0), SIMDE_FLOAT16_VALUE(   4892.0), SIMDE_FLOAT16_VALUE( -24384.0),
+        SIMDE_FLOAT16_VALUE(   1530.0), SIMDE_FLOAT16_VALUE(  11056.0), SIMDE_FLOAT16_VALUE( -29168.0), SIMDE_FLOAT16_VALUE(  -1428.0),
+        SIMDE_FLOAT16_VALUE(  -3092.0), SIMDE_FLOAT16_VALUE(  11208.0), SIMDE_FLOAT16_VALUE(   1009.0), SIMDE_FLOAT16_VALUE( -19232.0),
+        SIMDE_FLOAT16_VALUE(  25120.0), SIMDE_FLOAT16_VALUE(  -1981.0), SIMDE_FLOAT16_VALUE(  22848.0), SIMDE_FLOAT16_VALUE( -15376.0),
+        SIMDE_FLOAT16_VALUE(   3658.0), SIMDE_FLOAT16_VALUE(  12696.0), SIMDE_FLOAT16_VALUE(  32192.0), SIMDE_FLOAT16_VALUE(   -819.0),
+        SIMDE_FLOAT16_VALUE(   -258.0), SIMDE_FLOAT16_VALUE( -22976.0), SIMDE_FLOAT16_VALUE( -32400.0), SIMDE_FLOAT16_VALUE( -29248.0),
+        SIMDE_FLOAT16_VALUE(  14528.0), SIMDE_FLOAT16_VALUE(  14152.0), SIMDE_FLOAT16_VALUE(  -9072.0), SIMDE_FLOAT16_VALUE( -18848.0),
+        SIMDE_FLOAT16_VALUE( -20144.0), SIMDE_FLOAT16_VALUE(   -440.0), SIMDE_FLOAT16_VALUE(  -6848.0), SIMDE_FLOAT16_VALUE(   1565.0) } },
+    { { INT16_C(-25660), INT16_C( -2022), INT16_C(-30031), INT16_C( -5055), INT16_C( -2244), INT16_C(  -622), INT16_C(  1590), INT16_C(-18470),
+        INT16_C( 14900), INT16_C(-27729), INT16_C(-27748), INT16_C(-32309), INT16_C(-21572), INT16_C( 30178), INT16_C(  7292), INT16_C(  5747),
+        INT16_C(-16779), INT16_C( 15702), INT16_C( -1832), INT16_C(  1392), INT16_C( 25301), INT16_C(  1552), INT16_C(   701), INT16_C(   329),
+        INT16_C( -1263), INT16_C(-30823), INT16_C(  1345), INT16_C( 25758), INT16_C(-25727), INT16_C(  -445), INT16_C( -6198), INT16_C(-29530) },
+      { SIMDE_FLOAT16_VALUE( -25664.0), SIMDE_FLOAT16_VALUE(  -2022.0), SIMDE_FLOAT16_VALUE( -30032.0), SIMDE_FLOAT16_VALUE(  -5056.0),
+        SIMDE_FLOAT16_VALUE(  -2244.0), SIMDE_FLOAT16_VALUE(   -622.0), SIMDE_FLOAT16_VALUE(   1590.0), SIMDE_FLOAT16_VALUE( -18464.0),
+        SIMDE_FLOAT16_VALUE(  14896.0), SIMDE_FLOAT16_VALUE( -27728.0), SIMDE_FLOAT16_VALUE( -27744.0), SIMDE_FLOAT16_VALUE( -32304.0),
+        SIMDE_FLOAT16_VALUE( -21568.0), SIMDE_FLOAT16_VALUE(  30176.0), SIMDE_FLOAT16_VALUE(   7292.0), SIMDE_FLOAT16_VALUE(   5748.0),
+        SIMDE_FLOAT16_VALUE( -16784.0), SIMDE_FLOAT16_VALUE(  15704.0), SIMDE_FLOAT16_VALUE(  -1832.0), SIMDE_FLOAT16_VALUE(   1392.0),
+        SIMDE_FLOAT16_VALUE(  25296.0), SIMDE_FLOAT16_VALUE(   1552.0), SIMDE_FLOAT16_VALUE(    701.0), SIMDE_FLOAT16_VALUE(    329.0),
+        SIMDE_FLOAT16_VALUE(  -1263.0), SIMDE_FLOAT16_VALUE( -30816.0), SIMDE_FLOAT16_VALUE(   1345.0), SIMDE_FLOAT16_VALUE(  25760.0),
+        SIMDE_FLOAT16_VALUE( -25728.0), SIMDE_FLOAT16_VALUE(   -445.0), SIMDE_FLOAT16_VALUE(  -6200.0), SIMDE_FLOAT16_VALUE( -29536.0) } },
+    { { INT16_C(-14876), INT16_C(-27230), INT16_C( 23646), INT16_C( -1084), INT16_C(  1172), INT16_C(   696), INT16_C(  -834), INT16_C(  4862),
+        INT16_C(-17813), INT16_C(   529), INT16_C(-13780), INT16_C( -1060), INT16_C(-12316), INT16_C(   709), INT16_C(  4634), INT16_C( 21093),
+        INT16_C(  5104), INT16_C(  7419), INT16_C(-32060), INT16_C(  6502), INT16_C(-32289), INT16_C(  1268), INT16_C( -2938), INT16_C( -1648),
+        INT16_C( 25357), INT16_C(  5989), INT16_C(-13866), INT16_C(  1561), INT16_C( 24193), INT16_C(-17137), INT16_C( 10363), INT16_C(  1166) },
+      { SIMDE_FLOAT16_VALUE( -14880.0), SIMDE_FLOAT16_VALUE( -27232.0), SIMDE_FLOAT16_VALUE(  23648.0), SIMDE_FLOAT16_VALUE(  -1084.0),
+        SIMDE_FLOAT16_VALUE(   1172.0), SIMDE_FLOAT16_VALUE(    696.0), SIMDE_FLOAT16_VALUE(   -834.0), SIMDE_FLOAT16_VALUE(   4864.0),
+        SIMDE_FLOAT16_VALUE( -17808.0), SIMDE_FLOAT16_VALUE(    529.0), SIMDE_FLOAT16_VALUE( -13776.0), SIMDE_FLOAT16_VALUE(  -1060.0),
+        SIMDE_FLOAT16_VALUE( -12320.0), SIMDE_FLOAT16_VALUE(    709.0), SIMDE_FLOAT16_VALUE(   4632.0), SIMDE_FLOAT16_VALUE(  21088.0),
+        SIMDE_FLOAT16_VALUE(   5104.0), SIMDE_FLOAT16_VALUE(   7420.0), SIMDE_FLOAT16_VALUE( -32064.0), SIMDE_FLOAT16_VALUE(   6504.0),
+        SIMDE_FLOAT16_VALUE( -32288.0), SIMDE_FLOAT16_VALUE(   1268.0), SIMDE_FLOAT16_VALUE(  -2938.0), SIMDE_FLOAT16_VALUE(  -1648.0),
+        SIMDE_FLOAT16_VALUE(  25360.0), SIMDE_FLOAT16_VALUE(   5988.0), SIMDE_FLOAT16_VALUE( -13864.0), SIMDE_FLOAT16_VALUE(   1561.0),
+        SIMDE_FLOAT16_VALUE(  24192.0), SIMDE_FLOAT16_VALUE( -17136.0), SIMDE_FLOAT16_VALUE(  10360.0), SIMDE_FLOAT16_VALUE(   1166.0) } },
+    { { INT16_C( 21527), INT16_C(  1832), INT16_C(-31071), INT16_C(  6473), INT16_C( 15829), INT16_C( -1303), INT16_C( 11990), INT16_C( -6687),
+        INT16_C(-18177), INT16_C(  1898), INT16_C(  6542), INT16_C(  -855), INT16_C(  1902), INT16_C(-15455), INT16_C(-28249), INT16_C( 16157),
+        INT16_C( -5781), INT16_C( -2039), INT16_C( 16989), INT16_C(-21950), INT16_C(-25981), INT16_C(  -944), INT16_C(-24576), INT16_C( -6020),
+        INT16_C(-25474), INT16_C( 29631), INT16_C(-17641), INT16_C( -1816), INT16_C(   -50), INT16_C(  4238), INT16_C( 20853), INT16_C(-23155) },
+      { SIMDE_FLOAT16_VALUE(  21520.0), SIMDE_FLOAT16_VALUE(   1832.0), SIMDE_FLOAT16_VALUE( -31072.0), SIMDE_FLOAT16_VALUE(   6472.0),
+        SIMDE_FLOAT16_VALUE(  15832.0), SIMDE_FLOAT16_VALUE(  -1303.0), SIMDE_FLOAT16_VALUE(  11992.0), SIMDE_FLOAT16_VALUE(  -6688.0),
+        SIMDE_FLOAT16_VALUE( -18176.0), SIMDE_FLOAT16_VALUE(   1898.0), SIMDE_FLOAT16_VALUE(   6544.0), SIMDE_FLOAT16_VALUE(   -855.0),
+        SIMDE_FLOAT16_VALUE(   1902.0), SIMDE_FLOAT16_VALUE( -15456.0), SIMDE_FLOAT16_VALUE( -28256.0), SIMDE_FLOAT16_VALUE(  16160.0),
+        SIMDE_FLOAT16_VALUE(  -5780.0), SIMDE_FLOAT16_VALUE(  -2039.0), SIMDE_FLOAT16_VALUE(  16992.0), SIMDE_FLOAT16_VALUE( -21952.0),
+        SIMDE_FLOAT16_VALUE( -25984.0), SIMDE_FLOAT16_VALUE(   -944.0), SIMDE_FLOAT16_VALUE( -24576.0), SIMDE_FLOAT16_VALUE(  -6020.0),
+        SIMDE_FLOAT16_VALUE( -25472.0), SIMDE_FLOAT16_VALUE(  29632.0), SIMDE_FLOAT16_VALUE( -17648.0), SIMDE_FLOAT16_VALUE(  -1816.0),
+        SIMDE_FLOAT16_VALUE(    -50.0), SIMDE_FLOAT16_VALUE(   4240.0), SIMDE_FLOAT16_VALUE(  20848.0), SIMDE_FLOAT16_VALUE( -23152.0) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    simde__m512h r = simde_mm512_cvtepi16_ph(a);
+    simde_test_x86_assert_equal_f16x32(r, simde_mm512_loadu_ph(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
+static int
+test_simde_mm512_cvtps_ph (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[16];
+    const int16_t r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   290.78714), SIMDE_FLOAT32_C(    923.7885), SIMDE_FLOAT32_C(   -926.6506), SIMDE_FLOAT32_C(    720.0197),
+        SIMDE_FLOAT32_C(    958.3281), SIMDE_FLOAT32_C(   504.11475), SIMDE_FLOAT32_C(   144.39789), SIMDE_FLOAT32_C(   -345.0257),
+        SIMDE_FLOAT32_C(  -281.38647), SIMDE_FLOAT32_C(   248.97543), SIMDE_FLOAT32_C(    911.3918), SIMDE_FLOAT32_C(     723.436),
+        SIMDE_FLOAT32_C(    344.1121), SIMDE_FLOAT32_C(   -98.93167), SIMDE_FLOAT32_C(  -166.54192), SIMDE_FLOAT32_C(    551.5784) },
+      { INT16_C( 23691), INT16_C( 25400), INT16_C( -7363), INT16_C( 24992), INT16_C( 25469), INT16_C( 24544), INT16_C( 22659), INT16_C( -8860),
+        INT16_C( -9114), INT16_C( 23496), INT16_C( 25375), INT16_C( 24999), INT16_C( 23904), INT16_C(-10705), INT16_C( -9932), INT16_C( 24655) } },
+    { { SIMDE_FLOAT32_C(    603.1678), SIMDE_FLOAT32_C(  -785.43774), SIMDE_FLOAT32_C(    536.8191), SIMDE_FLOAT32_C(  -413.05353),
+        SIMDE_FLOAT32_C(   808.86993), SIMDE_FLOAT32_C(   132.70792), SIMDE_FLOAT32_C(   226.09094), SIMDE_FLOAT32_C(   -635.1453),
+        SIMDE_FLOAT32_C(   -517.8796), SIMDE_FLOAT32_C(    631.1071), SIMDE_FLOAT32_C(   586.93274), SIMDE_FLOAT32_C(    9.094776),
+        SIMDE_FLOAT32_C(   -208.4613), SIMDE_FLOAT32_C( -114.676926), SIMDE_FLOAT32_C(    513.7706), SIMDE_FLOAT32_C(   959.58624) },
+      { INT16_C( 24758), INT16_C( -7645), INT16_C( 24626), INT16_C( -8588), INT16_C( 25170), INT16_C( 22566), INT16_C( 23313), INT16_C( -7946),
+        INT16_C( -8180), INT16_C( 24814), INT16_C( 24726), INT16_C( 18572), INT16_C( -9596), INT16_C(-10453), INT16_C( 24580), INT16_C( 25471) } },
+    { { SIMDE_FLOAT32_C(  -173.16766), SIMDE_FLOAT32_C(  -749.80695), SIMDE_FLOAT32_C(   880.43787), SIMDE_FLOAT32_C(   747.92566),
+        SIMDE_FLOAT32_C(   -525.0838), SIMDE_FLOAT32_C(    883.0842), SIMDE_FLOAT32_C(   159.40154), SIMDE_FLOAT32_C(    47.91166),
+        SIMDE_FLOAT32_C(   -66.37472), SIMDE_FLOAT32_C(  -63.158375), SIMDE_FLOAT32_C(    -551.709), SIMDE_FLOAT32_C(   448.58847),
+        SIMDE_FLOAT32_C(  -489.99786), SIMDE_FLOAT32_C(  -32.684174), SIMDE_FLOAT32_C(  -98.405655), SIMDE_FLOAT32_C(    109.2558) },
+      { INT16_C( -9879), INT16_C( -7716), INT16_C( 25313), INT16_C( 25048), INT16_C( -8166), INT16_C( 25318), INT16_C( 22779), INT16_C( 20989),
+        INT16_C(-11226), INT16_C(-11291), INT16_C( -8113), INT16_C( 24322), INT16_C( -8280), INT16_C(-12266), INT16_C(-10714), INT16_C( 22228) } },
+    { { SIMDE_FLOAT32_C(   -384.6008), SIMDE_FLOAT32_C(    400.3042), SIMDE_FLOAT32_C(    906.2227), SIMDE_FLOAT32_C(  -511.61142),
+        SIMDE_FLOAT32_C(      676.73), SIMDE_FLOAT32_C(  -122.42445), SIMDE_FLOAT32_C(   -666.2737), SIMDE_FLOAT32_C(   427.30228),
+        SIMDE_FLOAT32_C(  -407.74548), SIMDE_FLOAT32_C(   -790.1519), SIMDE_FLOAT32_C(  -693.05786), SIMDE_FLOAT32_C(   503.97882),
+        SIMDE_FLOAT32_C(   -839.2635), SIMDE_FLOAT32_C(   953.53394), SIMDE_FLOAT32_C(  -833.01605), SIMDE_FLOAT32_C(   62.685947) },
+      { INT16_C( -8702), INT16_C( 24129), INT16_C( 25364), INT16_C( -8194), INT16_C( 24905), INT16_C(-10329), INT16_C( -7883), INT16_C( 24237),
+        INT16_C( -8609), INT16_C( -7636), INT16_C( -7830), INT16_C( 24544), INT16_C( -7537), INT16_C( 25459), INT16_C( -7550), INT16_C( 21462) } },
+    { { SIMDE_FLOAT32_C(   938.78784), SIMDE_FLOAT32_C(  -539.04095), SIMDE_FLOAT32_C(    989.9122), SIMDE_FLOAT32_C(  -162.23273),
+        SIMDE_FLOAT32_C(   -89.86151), SIMDE_FLOAT32_C(   18.414011), SIMDE_FLOAT32_C(   334.03693), SIMDE_FLOAT32_C(  -389.03998),
+        SIMDE_FLOAT32_C(    743.6499), SIMDE_FLOAT32_C(   -780.5604), SIMDE_FLOAT32_C(    493.2295), SIMDE_FLOAT32_C(   -6.328216),
+        SIMDE_FLOAT32_C(   779.28485), SIMDE_FLOAT32_C(   -748.7593), SIMDE_FLOAT32_C(   -675.5804), SIMDE_FLOAT32_C(  -480.66516) },
+      { INT16_C( 25430), INT16_C( -8138), INT16_C( 25532), INT16_C( -9966), INT16_C(-10850), INT16_C( 19610), INT16_C( 23864), INT16_C( -8684),
+        INT16_C( 25039), INT16_C( -7655), INT16_C( 24501), INT16_C(-14764), INT16_C( 25111), INT16_C( -7718), INT16_C( -7865), INT16_C( -8317) } },
+    { { SIMDE_FLOAT32_C(  -253.21335), SIMDE_FLOAT32_C(   -891.1908), SIMDE_FLOAT32_C(   -888.5017), SIMDE_FLOAT32_C(  -501.45407),
+        SIMDE_FLOAT32_C(  -230.60358), SIMDE_FLOAT32_C(    58.44801), SIMDE_FLOAT32_C(    749.6365), SIMDE_FLOAT32_C(   137.41637),
+        SIMDE_FLOAT32_C(  -392.79715), SIMDE_FLOAT32_C(   -90.01238), SIMDE_FLOAT32_C(    95.44913), SIMDE_FLOAT32_C(   -682.6006),
+        SIMDE_FLOAT32_C(    849.8738), SIMDE_FLOAT32_C(    412.5337), SIMDE_FLOAT32_C(   263.56772), SIMDE_FLOAT32_C(    788.3341) },
+      { INT16_C( -9238), INT16_C( -7434), INT16_C( -7439), INT16_C( -8234), INT16_C( -9419), INT16_C( 21326), INT16_C( 25051), INT16_C( 22603),
+        INT16_C( -8669), INT16_C(-10848), INT16_C( 22007), INT16_C( -7851), INT16_C( 25252), INT16_C( 24178), INT16_C( 23582), INT16_C( 25129) } },
+    { { SIMDE_FLOAT32_C(   157.48727), SIMDE_FLOAT32_C(  -361.73108), SIMDE_FLOAT32_C(   -795.0098), SIMDE_FLOAT32_C(  -766.26184),
+        SIMDE_FLOAT32_C(  -21.504663), SIMDE_FLOAT32_C(   133.35544), SIMDE_FLOAT32_C(  -868.44824), SIMDE_FLOAT32_C(   142.67789),
+        SIMDE_FLOAT32_C(   -859.5436), SIMDE_FLOAT32_C(  -318.28583), SIMDE_FLOAT32_C(    463.9549), SIMDE_FLOAT32_C(   320.91928),
+        SIMDE_FLOAT32_C(    724.8933), SIMDE_FLOAT32_C(   965.52997), SIMDE_FLOAT32_C(   193.27501), SIMDE_FLOAT32_C(    697.5303) },
+      { INT16_C( 22764), INT16_C( -8793), INT16_C( -7626), INT16_C( -7683), INT16_C(-12960), INT16_C( 22571), INT16_C( -7479), INT16_C( 22645),
+        INT16_C( -7497), INT16_C( -8967), INT16_C( 24384), INT16_C( 23812), INT16_C( 25002), INT16_C( 25483), INT16_C( 23050), INT16_C( 24947) } },
+    { { SIMDE_FLOAT32_C(    306.0136), SIMDE_FLOAT32_C(   -300.5296), SIMDE_FLOAT32_C(  -582.83966), SIMDE_FLOAT32_C(   -728.2538),
+        SIMDE_FLOAT32_C(  -588.75757), SIMDE_FLOAT32_C(   483.24698), SIMDE_FLOAT32_C(  -39.173225), SIMDE_FLOAT32_C(   -731.7388),
+        SIMDE_FLOAT32_C(   173.13528), SIMDE_FLOAT32_C(    323.2334), SIMDE_FLOAT32_C(    799.0133), SIMDE_FLOAT32_C(  -647.83356),
+        SIMDE_FLOAT32_C(    93.41851), SIMDE_FLOAT32_C(    578.0955), SIMDE_FLOAT32_C(   -999.2257), SIMDE_FLOAT32_C(   80.519844) },
+      { INT16_C( 23752), INT16_C( -9038), INT16_C( -8050), INT16_C( -7759), INT16_C( -8038), INT16_C( 24461), INT16_C(-12058), INT16_C( -7753),
+        INT16_C( 22889), INT16_C( 23821), INT16_C( 25150), INT16_C( -7920), INT16_C( 21975), INT16_C( 24708), INT16_C( -7218), INT16_C( 21768) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m256i r = simde_mm512_cvtps_ph(a, SIMDE_MM_FROUND_TO_NEAREST_INT);
+    simde_test_x86_assert_equal_i16x16(r, simde_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
 SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_cvtepi64_pd)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_cvtepi64_pd)
@@ -1359,7 +3735,41 @@ SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_cvtepu16_epi32)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_cvtepu32_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_cvtph_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_cvtps_ph)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_cvtps_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cvtne2ps_pbh)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_cvtne2ps_pbh)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_cvtne2ps_pbh)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_cvtne2ps_pbh)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_cvtne2ps_pbh)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cvtneps_pbh)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_cvtneps_pbh)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_cvtneps_pbh)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_cvtneps_pbh)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_cvtneps_pbh)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_cvtneps_pbh)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cvtpbh_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_cvtpbh_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_cvtpbh_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_cvtpbh_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_cvtpbh_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cvtness_sbh)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cvtsbh_ss)
+
+  #if defined(SIMDE_FLOAT16_IS_SCALAR)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm_cvtxph_ps)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm256_cvtxph_ps)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm512_cvtxph_ps)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm_cvtxps_ph)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm256_cvtxps_ph)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm512_cvtxps_ph)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm_cvtph_epi16)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm256_cvtph_epi16)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm512_cvtph_epi16)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm_cvtepi16_ph)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm256_cvtepi16_ph)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm512_cvtepi16_ph)
+  #endif
 SIMDE_TEST_FUNC_LIST_END
 
 #include <test/x86/avx512/test-avx512-footer.h>
@@ -812,6 +812,405 @@ test_simde_mm512_maskz_div_pd(SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm_div_ph (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float16 a[8];
+    const simde_float16 b[8];
+    const simde_float16 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(     62.4), SIMDE_FLOAT16_VALUE(     74.2), SIMDE_FLOAT16_VALUE(    51.53), SIMDE_FLOAT16_VALUE(     48.1),
+        SIMDE_FLOAT16_VALUE(    24.53), SIMDE_FLOAT16_VALUE(   -20.52), SIMDE_FLOAT16_VALUE(   -24.95), SIMDE_FLOAT16_VALUE(    50.88) },
+      { SIMDE_FLOAT16_VALUE(    -53.1), SIMDE_FLOAT16_VALUE(   -18.52), SIMDE_FLOAT16_VALUE(   -86.25), SIMDE_FLOAT16_VALUE(     92.4),
+        SIMDE_FLOAT16_VALUE(    -20.7), SIMDE_FLOAT16_VALUE(   -4.258), SIMDE_FLOAT16_VALUE(    31.31), SIMDE_FLOAT16_VALUE(   -12.22) },
+      { SIMDE_FLOAT16_VALUE(   -1.176), SIMDE_FLOAT16_VALUE(   -4.008), SIMDE_FLOAT16_VALUE(  -0.5977), SIMDE_FLOAT16_VALUE(   0.5205),
+        SIMDE_FLOAT16_VALUE(   -1.185), SIMDE_FLOAT16_VALUE(    4.816), SIMDE_FLOAT16_VALUE(   -0.797), SIMDE_FLOAT16_VALUE(   -4.164) } },
+    { { SIMDE_FLOAT16_VALUE(  -14.805), SIMDE_FLOAT16_VALUE(    27.27), SIMDE_FLOAT16_VALUE(    45.72), SIMDE_FLOAT16_VALUE(     47.0),
+        SIMDE_FLOAT16_VALUE(    -94.9), SIMDE_FLOAT16_VALUE(    -68.5), SIMDE_FLOAT16_VALUE(    27.89), SIMDE_FLOAT16_VALUE(    -90.9) },
+      { SIMDE_FLOAT16_VALUE(    52.25), SIMDE_FLOAT16_VALUE(    51.72), SIMDE_FLOAT16_VALUE(   -59.56), SIMDE_FLOAT16_VALUE(   -61.88),
+        SIMDE_FLOAT16_VALUE(   -57.03), SIMDE_FLOAT16_VALUE(    39.97), SIMDE_FLOAT16_VALUE(    -1.37), SIMDE_FLOAT16_VALUE(    -77.1) },
+      { SIMDE_FLOAT16_VALUE(  -0.2834), SIMDE_FLOAT16_VALUE(   0.5273), SIMDE_FLOAT16_VALUE(  -0.7676), SIMDE_FLOAT16_VALUE(    -0.76),
+        SIMDE_FLOAT16_VALUE(    1.663), SIMDE_FLOAT16_VALUE(   -1.714), SIMDE_FLOAT16_VALUE(   -20.36), SIMDE_FLOAT16_VALUE(    1.179) } },
+    { { SIMDE_FLOAT16_VALUE(    62.28), SIMDE_FLOAT16_VALUE(     47.0), SIMDE_FLOAT16_VALUE(   -16.98), SIMDE_FLOAT16_VALUE(    93.75),
+        SIMDE_FLOAT16_VALUE(    39.84), SIMDE_FLOAT16_VALUE(     85.4), SIMDE_FLOAT16_VALUE(    -67.4), SIMDE_FLOAT16_VALUE(   -61.53) },
+      { SIMDE_FLOAT16_VALUE(    -29.7), SIMDE_FLOAT16_VALUE(   -57.44), SIMDE_FLOAT16_VALUE(     98.0), SIMDE_FLOAT16_VALUE(    88.56),
+        SIMDE_FLOAT16_VALUE(     68.0), SIMDE_FLOAT16_VALUE(     99.4), SIMDE_FLOAT16_VALUE(   -61.97), SIMDE_FLOAT16_VALUE(   -60.03) },
+      { SIMDE_FLOAT16_VALUE(   -2.098), SIMDE_FLOAT16_VALUE(  -0.8184), SIMDE_FLOAT16_VALUE(  -0.1733), SIMDE_FLOAT16_VALUE(    1.059),
+        SIMDE_FLOAT16_VALUE(    0.586), SIMDE_FLOAT16_VALUE(    0.859), SIMDE_FLOAT16_VALUE(    1.087), SIMDE_FLOAT16_VALUE(    1.025) } },
+    { { SIMDE_FLOAT16_VALUE(  -11.734), SIMDE_FLOAT16_VALUE(    38.22), SIMDE_FLOAT16_VALUE(    46.25), SIMDE_FLOAT16_VALUE(    83.06),
+        SIMDE_FLOAT16_VALUE(     92.8), SIMDE_FLOAT16_VALUE(    -93.6), SIMDE_FLOAT16_VALUE(    62.88), SIMDE_FLOAT16_VALUE(    7.945) },
+      { SIMDE_FLOAT16_VALUE(    97.25), SIMDE_FLOAT16_VALUE(   -26.22), SIMDE_FLOAT16_VALUE(   -67.75), SIMDE_FLOAT16_VALUE(   -16.02),
+        SIMDE_FLOAT16_VALUE(    68.06), SIMDE_FLOAT16_VALUE(   -92.75), SIMDE_FLOAT16_VALUE(   -8.914), SIMDE_FLOAT16_VALUE(    -30.9) },
+      { SIMDE_FLOAT16_VALUE( -0.12067), SIMDE_FLOAT16_VALUE(   -1.458), SIMDE_FLOAT16_VALUE(  -0.6826), SIMDE_FLOAT16_VALUE(   -5.188),
+        SIMDE_FLOAT16_VALUE(    1.363), SIMDE_FLOAT16_VALUE(     1.01), SIMDE_FLOAT16_VALUE(   -7.055), SIMDE_FLOAT16_VALUE(   -0.257) } },
+    { { SIMDE_FLOAT16_VALUE(    24.45), SIMDE_FLOAT16_VALUE(    76.25), SIMDE_FLOAT16_VALUE(    -78.7), SIMDE_FLOAT16_VALUE(   -39.72),
+        SIMDE_FLOAT16_VALUE(     64.7), SIMDE_FLOAT16_VALUE(   -92.94), SIMDE_FLOAT16_VALUE(   -55.62), SIMDE_FLOAT16_VALUE(     77.8) },
+      { SIMDE_FLOAT16_VALUE(    43.34), SIMDE_FLOAT16_VALUE(     90.6), SIMDE_FLOAT16_VALUE(     68.2), SIMDE_FLOAT16_VALUE(   -89.56),
+        SIMDE_FLOAT16_VALUE(    17.52), SIMDE_FLOAT16_VALUE(   -2.338), SIMDE_FLOAT16_VALUE(    -19.8), SIMDE_FLOAT16_VALUE(    -80.2) },
+      { SIMDE_FLOAT16_VALUE(    0.564), SIMDE_FLOAT16_VALUE(   0.8413), SIMDE_FLOAT16_VALUE(   -1.154), SIMDE_FLOAT16_VALUE(   0.4434),
+        SIMDE_FLOAT16_VALUE(    3.693), SIMDE_FLOAT16_VALUE(    39.75), SIMDE_FLOAT16_VALUE(     2.81), SIMDE_FLOAT16_VALUE(    -0.97) } },
+    { { SIMDE_FLOAT16_VALUE(   -52.62), SIMDE_FLOAT16_VALUE(   -92.44), SIMDE_FLOAT16_VALUE(     4.46), SIMDE_FLOAT16_VALUE(    -20.1),
+        SIMDE_FLOAT16_VALUE(    71.06), SIMDE_FLOAT16_VALUE(    73.75), SIMDE_FLOAT16_VALUE(    36.97), SIMDE_FLOAT16_VALUE(    30.27) },
+      { SIMDE_FLOAT16_VALUE(    87.44), SIMDE_FLOAT16_VALUE(   -39.28), SIMDE_FLOAT16_VALUE(     86.5), SIMDE_FLOAT16_VALUE(   -52.34),
+        SIMDE_FLOAT16_VALUE(   -9.805), SIMDE_FLOAT16_VALUE(    -34.4), SIMDE_FLOAT16_VALUE(   -97.25), SIMDE_FLOAT16_VALUE(    -81.5) },
+      { SIMDE_FLOAT16_VALUE(   -0.602), SIMDE_FLOAT16_VALUE(    2.354), SIMDE_FLOAT16_VALUE(  0.05157), SIMDE_FLOAT16_VALUE(   0.3838),
+        SIMDE_FLOAT16_VALUE(   -7.246), SIMDE_FLOAT16_VALUE(   -2.143), SIMDE_FLOAT16_VALUE(  -0.3801), SIMDE_FLOAT16_VALUE(  -0.3713) } },
+    { { SIMDE_FLOAT16_VALUE(    -93.8), SIMDE_FLOAT16_VALUE(    2.469), SIMDE_FLOAT16_VALUE(   -40.88), SIMDE_FLOAT16_VALUE(    -30.0),
+        SIMDE_FLOAT16_VALUE(     82.1), SIMDE_FLOAT16_VALUE(     66.6), SIMDE_FLOAT16_VALUE(   -18.86), SIMDE_FLOAT16_VALUE(    3.512) },
+      { SIMDE_FLOAT16_VALUE(   -97.06), SIMDE_FLOAT16_VALUE(   -22.94), SIMDE_FLOAT16_VALUE(    76.56), SIMDE_FLOAT16_VALUE(     9.44),
+        SIMDE_FLOAT16_VALUE(   -70.75), SIMDE_FLOAT16_VALUE(   -45.12), SIMDE_FLOAT16_VALUE(    48.47), SIMDE_FLOAT16_VALUE(     71.4) },
+      { SIMDE_FLOAT16_VALUE(   0.9663), SIMDE_FLOAT16_VALUE(  -0.1076), SIMDE_FLOAT16_VALUE(  -0.5337), SIMDE_FLOAT16_VALUE(    -3.18),
+        SIMDE_FLOAT16_VALUE(   -1.161), SIMDE_FLOAT16_VALUE(   -1.477), SIMDE_FLOAT16_VALUE(  -0.3892), SIMDE_FLOAT16_VALUE(   0.0492) } },
+    { { SIMDE_FLOAT16_VALUE(   -76.06), SIMDE_FLOAT16_VALUE(    52.12), SIMDE_FLOAT16_VALUE(    -85.9), SIMDE_FLOAT16_VALUE(    -96.1),
+        SIMDE_FLOAT16_VALUE(    59.47), SIMDE_FLOAT16_VALUE(     99.5), SIMDE_FLOAT16_VALUE(     34.1), SIMDE_FLOAT16_VALUE(    99.06) },
+      { SIMDE_FLOAT16_VALUE(     86.5), SIMDE_FLOAT16_VALUE(     92.1), SIMDE_FLOAT16_VALUE(    11.37), SIMDE_FLOAT16_VALUE(    61.03),
+        SIMDE_FLOAT16_VALUE(    18.55), SIMDE_FLOAT16_VALUE(   -11.12), SIMDE_FLOAT16_VALUE(   -43.22), SIMDE_FLOAT16_VALUE(   -7.133) },
+      { SIMDE_FLOAT16_VALUE(  -0.8794), SIMDE_FLOAT16_VALUE(    0.566), SIMDE_FLOAT16_VALUE(   -7.555), SIMDE_FLOAT16_VALUE(   -1.575),
+        SIMDE_FLOAT16_VALUE(    3.207), SIMDE_FLOAT16_VALUE(    -8.95), SIMDE_FLOAT16_VALUE(   -0.789), SIMDE_FLOAT16_VALUE(   -13.89) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128h a = simde_mm_loadu_ph(test_vec[i].a);
+    simde__m128h b = simde_mm_loadu_ph(test_vec[i].b);
+    simde__m128h r = simde_mm_div_ph(a, b);
+    simde_test_x86_assert_equal_f16x8(r, simde_mm_loadu_ph(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm256_div_ph (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float16 a[16];
+    const simde_float16 b[16];
+    const simde_float16 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(   -1.758), SIMDE_FLOAT16_VALUE(    29.47), SIMDE_FLOAT16_VALUE(   -85.44), SIMDE_FLOAT16_VALUE(    -78.9),
+        SIMDE_FLOAT16_VALUE(     71.0), SIMDE_FLOAT16_VALUE(    -43.4), SIMDE_FLOAT16_VALUE(   -83.75), SIMDE_FLOAT16_VALUE(   -86.44),
+        SIMDE_FLOAT16_VALUE(     83.3), SIMDE_FLOAT16_VALUE(    55.66), SIMDE_FLOAT16_VALUE(    95.06), SIMDE_FLOAT16_VALUE(   -91.56),
+        SIMDE_FLOAT16_VALUE(    -80.3), SIMDE_FLOAT16_VALUE(    -42.3), SIMDE_FLOAT16_VALUE(    5.816), SIMDE_FLOAT16_VALUE(   -22.34) },
+      { SIMDE_FLOAT16_VALUE(    -63.2), SIMDE_FLOAT16_VALUE(   -14.38), SIMDE_FLOAT16_VALUE(    18.27), SIMDE_FLOAT16_VALUE(    35.28),
+        SIMDE_FLOAT16_VALUE(    -65.5), SIMDE_FLOAT16_VALUE(   -71.06), SIMDE_FLOAT16_VALUE(   -50.62), SIMDE_FLOAT16_VALUE(    36.78),
+        SIMDE_FLOAT16_VALUE(    32.94), SIMDE_FLOAT16_VALUE(    92.56), SIMDE_FLOAT16_VALUE(     4.19), SIMDE_FLOAT16_VALUE(   -59.66),
+        SIMDE_FLOAT16_VALUE(    10.76), SIMDE_FLOAT16_VALUE(     69.5), SIMDE_FLOAT16_VALUE(   -31.78), SIMDE_FLOAT16_VALUE(    -23.9) },
+      { SIMDE_FLOAT16_VALUE(  0.02782), SIMDE_FLOAT16_VALUE(   -2.049), SIMDE_FLOAT16_VALUE(   -4.676), SIMDE_FLOAT16_VALUE(   -2.236),
+        SIMDE_FLOAT16_VALUE(   -1.084), SIMDE_FLOAT16_VALUE(    0.611), SIMDE_FLOAT16_VALUE(    1.654), SIMDE_FLOAT16_VALUE(    -2.35),
+        SIMDE_FLOAT16_VALUE(     2.53), SIMDE_FLOAT16_VALUE(    0.601), SIMDE_FLOAT16_VALUE(    22.69), SIMDE_FLOAT16_VALUE(    1.535),
+        SIMDE_FLOAT16_VALUE(   -7.465), SIMDE_FLOAT16_VALUE(   -0.609), SIMDE_FLOAT16_VALUE(   -0.183), SIMDE_FLOAT16_VALUE(   0.9346) } },
+    { { SIMDE_FLOAT16_VALUE(    91.25), SIMDE_FLOAT16_VALUE(    22.78), SIMDE_FLOAT16_VALUE(     26.5), SIMDE_FLOAT16_VALUE(     76.6),
+        SIMDE_FLOAT16_VALUE(    34.03), SIMDE_FLOAT16_VALUE(    -93.1), SIMDE_FLOAT16_VALUE(    0.637), SIMDE_FLOAT16_VALUE(    -69.9),
+        SIMDE_FLOAT16_VALUE(   -76.06), SIMDE_FLOAT16_VALUE(    -35.4), SIMDE_FLOAT16_VALUE(   -4.797), SIMDE_FLOAT16_VALUE(   -58.66),
+        SIMDE_FLOAT16_VALUE(    14.45), SIMDE_FLOAT16_VALUE(    73.06), SIMDE_FLOAT16_VALUE(   -98.94), SIMDE_FLOAT16_VALUE(     56.6) },
+      { SIMDE_FLOAT16_VALUE(   -6.996), SIMDE_FLOAT16_VALUE(   -68.44), SIMDE_FLOAT16_VALUE(     97.7), SIMDE_FLOAT16_VALUE(     4.65),
+        SIMDE_FLOAT16_VALUE(    -81.3), SIMDE_FLOAT16_VALUE(   -36.53), SIMDE_FLOAT16_VALUE(     26.6), SIMDE_FLOAT16_VALUE(     81.7),
+        SIMDE_FLOAT16_VALUE(   -5.418), SIMDE_FLOAT16_VALUE(    -52.8), SIMDE_FLOAT16_VALUE(     44.2), SIMDE_FLOAT16_VALUE(    -34.6),
+        SIMDE_FLOAT16_VALUE(   15.445), SIMDE_FLOAT16_VALUE(   -89.56), SIMDE_FLOAT16_VALUE(    -52.3), SIMDE_FLOAT16_VALUE(   -42.28) },
+      { SIMDE_FLOAT16_VALUE(   -13.05), SIMDE_FLOAT16_VALUE(  -0.3328), SIMDE_FLOAT16_VALUE(   0.2712), SIMDE_FLOAT16_VALUE(    16.48),
+        SIMDE_FLOAT16_VALUE(  -0.4185), SIMDE_FLOAT16_VALUE(    2.549), SIMDE_FLOAT16_VALUE(  0.02396), SIMDE_FLOAT16_VALUE(  -0.8555),
+        SIMDE_FLOAT16_VALUE(    14.04), SIMDE_FLOAT16_VALUE(   0.6704), SIMDE_FLOAT16_VALUE(  -0.1086), SIMDE_FLOAT16_VALUE(    1.695),
+        SIMDE_FLOAT16_VALUE(   0.9355), SIMDE_FLOAT16_VALUE(   -0.816), SIMDE_FLOAT16_VALUE(    1.892), SIMDE_FLOAT16_VALUE(   -1.339) } },
+    { { SIMDE_FLOAT16_VALUE(   -13.95), SIMDE_FLOAT16_VALUE(   -24.86), SIMDE_FLOAT16_VALUE(     63.8), SIMDE_FLOAT16_VALUE(     90.4),
+        SIMDE_FLOAT16_VALUE(    -58.2), SIMDE_FLOAT16_VALUE(   -29.69), SIMDE_FLOAT16_VALUE(     92.9), SIMDE_FLOAT16_VALUE(   -47.53),
+        SIMDE_FLOAT16_VALUE(    61.53), SIMDE_FLOAT16_VALUE(     49.3), SIMDE_FLOAT16_VALUE(     89.5), SIMDE_FLOAT16_VALUE(     83.9),
+        SIMDE_FLOAT16_VALUE(   -64.25), SIMDE_FLOAT16_VALUE(     37.3), SIMDE_FLOAT16_VALUE(    96.06), SIMDE_FLOAT16_VALUE(    93.56) },
+      { SIMDE_FLOAT16_VALUE(    62.44), SIMDE_FLOAT16_VALUE(    -66.1), SIMDE_FLOAT16_VALUE(   -12.36), SIMDE_FLOAT16_VALUE(   -44.12),
+        SIMDE_FLOAT16_VALUE(     77.7), SIMDE_FLOAT16_VALUE(     94.2), SIMDE_FLOAT16_VALUE(    -91.7), SIMDE_FLOAT16_VALUE(    62.38),
+        SIMDE_FLOAT16_VALUE(    -8.52), SIMDE_FLOAT16_VALUE(     86.9), SIMDE_FLOAT16_VALUE(     65.1), SIMDE_FLOAT16_VALUE(    40.06),
+        SIMDE_FLOAT16_VALUE(   -11.13), SIMDE_FLOAT16_VALUE(   -88.25), SIMDE_FLOAT16_VALUE(     78.8), SIMDE_FLOAT16_VALUE(    -89.6) },
+      { SIMDE_FLOAT16_VALUE(  -0.2235), SIMDE_FLOAT16_VALUE(    0.376), SIMDE_FLOAT16_VALUE(   -5.164), SIMDE_FLOAT16_VALUE(   -2.049),
+        SIMDE_FLOAT16_VALUE(   -0.749), SIMDE_FLOAT16_VALUE(  -0.3152), SIMDE_FLOAT16_VALUE(   -1.013), SIMDE_FLOAT16_VALUE(   -0.762),
+        SIMDE_FLOAT16_VALUE(    -7.22), SIMDE_FLOAT16_VALUE(   0.5674), SIMDE_FLOAT16_VALUE(    1.374), SIMDE_FLOAT16_VALUE(    2.094),
+        SIMDE_FLOAT16_VALUE(     5.77), SIMDE_FLOAT16_VALUE(  -0.4229), SIMDE_FLOAT16_VALUE(    1.219), SIMDE_FLOAT16_VALUE(   -1.044) } },
+    { { SIMDE_FLOAT16_VALUE(    71.56), SIMDE_FLOAT16_VALUE(   -47.53), SIMDE_FLOAT16_VALUE(     65.4), SIMDE_FLOAT16_VALUE(    28.67),
+        SIMDE_FLOAT16_VALUE(    58.44), SIMDE_FLOAT16_VALUE(   -45.28), SIMDE_FLOAT16_VALUE(     43.9), SIMDE_FLOAT16_VALUE(    65.75),
+        SIMDE_FLOAT16_VALUE(    -79.5), SIMDE_FLOAT16_VALUE(    -76.9), SIMDE_FLOAT16_VALUE(   -26.61), SIMDE_FLOAT16_VALUE(   -19.94),
+        SIMDE_FLOAT16_VALUE(    61.22), SIMDE_FLOAT16_VALUE(   -43.75), SIMDE_FLOAT16_VALUE(    -92.1), SIMDE_FLOAT16_VALUE(   -51.44) },
+      { SIMDE_FLOAT16_VALUE(    49.62), SIMDE_FLOAT16_VALUE(    -76.4), SIMDE_FLOAT16_VALUE(    12.32), SIMDE_FLOAT16_VALUE(    -86.4),
+        SIMDE_FLOAT16_VALUE(   -42.38), SIMDE_FLOAT16_VALUE(    41.12), SIMDE_FLOAT16_VALUE(     87.2), SIMDE_FLOAT16_VALUE(   -40.44),
+        SIMDE_FLOAT16_VALUE(   -90.75), SIMDE_FLOAT16_VALUE(    25.78), SIMDE_FLOAT16_VALUE(    49.03), SIMDE_FLOAT16_VALUE(    10.62),
+        SIMDE_FLOAT16_VALUE(   -23.28), SIMDE_FLOAT16_VALUE(    45.94), SIMDE_FLOAT16_VALUE(    89.25), SIMDE_FLOAT16_VALUE(     75.9) },
+      { SIMDE_FLOAT16_VALUE(    1.442), SIMDE_FLOAT16_VALUE(   0.6226), SIMDE_FLOAT16_VALUE(    5.305), SIMDE_FLOAT16_VALUE(   -0.332),
+        SIMDE_FLOAT16_VALUE(   -1.379), SIMDE_FLOAT16_VALUE(   -1.101), SIMDE_FLOAT16_VALUE(   0.5034), SIMDE_FLOAT16_VALUE(   -1.626),
+        SIMDE_FLOAT16_VALUE(    0.876), SIMDE_FLOAT16_VALUE(   -2.982), SIMDE_FLOAT16_VALUE(  -0.5425), SIMDE_FLOAT16_VALUE(   -1.878),
+        SIMDE_FLOAT16_VALUE(   -2.629), SIMDE_FLOAT16_VALUE(   -0.952), SIMDE_FLOAT16_VALUE(   -1.032), SIMDE_FLOAT16_VALUE(  -0.6777) } },
+    { { SIMDE_FLOAT16_VALUE(    -49.4), SIMDE_FLOAT16_VALUE(   -63.88), SIMDE_FLOAT16_VALUE(   -99.25), SIMDE_FLOAT16_VALUE(    -50.5),
+        SIMDE_FLOAT16_VALUE(    55.72), SIMDE_FLOAT16_VALUE(     92.0), SIMDE_FLOAT16_VALUE(   -60.94), SIMDE_FLOAT16_VALUE(     62.5),
+        SIMDE_FLOAT16_VALUE(    -37.2), SIMDE_FLOAT16_VALUE(    98.25), SIMDE_FLOAT16_VALUE(   -26.27), SIMDE_FLOAT16_VALUE(    48.22),
+        SIMDE_FLOAT16_VALUE(     94.3), SIMDE_FLOAT16_VALUE(    -61.3), SIMDE_FLOAT16_VALUE(    -94.5), SIMDE_FLOAT16_VALUE(    -72.4) },
+      { SIMDE_FLOAT16_VALUE(   -63.25), SIMDE_FLOAT16_VALUE(     78.3), SIMDE_FLOAT16_VALUE(    -87.0), SIMDE_FLOAT16_VALUE(     56.2),
+        SIMDE_FLOAT16_VALUE(    -97.1), SIMDE_FLOAT16_VALUE(   -85.06), SIMDE_FLOAT16_VALUE(   -33.28), SIMDE_FLOAT16_VALUE(    -72.3),
+        SIMDE_FLOAT16_VALUE(    -59.6), SIMDE_FLOAT16_VALUE(   -20.86), SIMDE_FLOAT16_VALUE(    -72.8), SIMDE_FLOAT16_VALUE(    29.08),
+        SIMDE_FLOAT16_VALUE(    -67.3), SIMDE_FLOAT16_VALUE(     9.82), SIMDE_FLOAT16_VALUE(   -40.47), SIMDE_FLOAT16_VALUE(   -7.453) },
+      { SIMDE_FLOAT16_VALUE(   0.7812), SIMDE_FLOAT16_VALUE(  -0.8154), SIMDE_FLOAT16_VALUE(    1.141), SIMDE_FLOAT16_VALUE(   -0.899),
+        SIMDE_FLOAT16_VALUE(  -0.5737), SIMDE_FLOAT16_VALUE(   -1.082), SIMDE_FLOAT16_VALUE(    1.831), SIMDE_FLOAT16_VALUE(  -0.8643),
+        SIMDE_FLOAT16_VALUE(    0.624), SIMDE_FLOAT16_VALUE(    -4.71), SIMDE_FLOAT16_VALUE(   0.3608), SIMDE_FLOAT16_VALUE(    1.658),
+        SIMDE_FLOAT16_VALUE(   -1.401), SIMDE_FLOAT16_VALUE(   -6.242), SIMDE_FLOAT16_VALUE(    2.336), SIMDE_FLOAT16_VALUE(     9.71) } },
+    { { SIMDE_FLOAT16_VALUE(    35.75), SIMDE_FLOAT16_VALUE(    28.31), SIMDE_FLOAT16_VALUE(   -41.62), SIMDE_FLOAT16_VALUE(   -3.162),
+        SIMDE_FLOAT16_VALUE(    26.72), SIMDE_FLOAT16_VALUE(   -17.64), SIMDE_FLOAT16_VALUE(   -55.62), SIMDE_FLOAT16_VALUE(    18.19),
+        SIMDE_FLOAT16_VALUE(    60.88), SIMDE_FLOAT16_VALUE(    33.53), SIMDE_FLOAT16_VALUE(    -75.8), SIMDE_FLOAT16_VALUE(    95.06),
+        SIMDE_FLOAT16_VALUE(    -91.1), SIMDE_FLOAT16_VALUE(    66.06), SIMDE_FLOAT16_VALUE(     44.3), SIMDE_FLOAT16_VALUE(    76.94) },
+      { SIMDE_FLOAT16_VALUE(     73.4), SIMDE_FLOAT16_VALUE(     75.5), SIMDE_FLOAT16_VALUE(   -22.78), SIMDE_FLOAT16_VALUE(    6.785),
+        SIMDE_FLOAT16_VALUE(   -15.71), SIMDE_FLOAT16_VALUE(    23.05), SIMDE_FLOAT16_VALUE(    -61.9), SIMDE_FLOAT16_VALUE(    -35.2),
+        SIMDE_FLOAT16_VALUE(   -44.53), SIMDE_FLOAT16_VALUE(    -80.8), SIMDE_FLOAT16_VALUE(   -57.94), SIMDE_FLOAT16_VALUE(    -78.3),
+        SIMDE_FLOAT16_VALUE(     50.5), SIMDE_FLOAT16_VALUE(   -21.08), SIMDE_FLOAT16_VALUE(   -17.19), SIMDE_FLOAT16_VALUE(    -4.56) },
+      { SIMDE_FLOAT16_VALUE(   0.4873), SIMDE_FLOAT16_VALUE(    0.375), SIMDE_FLOAT16_VALUE(    1.827), SIMDE_FLOAT16_VALUE(   -0.466),
+        SIMDE_FLOAT16_VALUE(     -1.7), SIMDE_FLOAT16_VALUE(  -0.7656), SIMDE_FLOAT16_VALUE(   0.8984), SIMDE_FLOAT16_VALUE(   -0.517),
+        SIMDE_FLOAT16_VALUE(   -1.367), SIMDE_FLOAT16_VALUE(   -0.415), SIMDE_FLOAT16_VALUE(    1.309), SIMDE_FLOAT16_VALUE(   -1.214),
+        SIMDE_FLOAT16_VALUE(   -1.805), SIMDE_FLOAT16_VALUE(   -3.135), SIMDE_FLOAT16_VALUE(   -2.578), SIMDE_FLOAT16_VALUE(   -16.88) } },
+    { { SIMDE_FLOAT16_VALUE(   -11.05), SIMDE_FLOAT16_VALUE(     97.1), SIMDE_FLOAT16_VALUE(     36.2), SIMDE_FLOAT16_VALUE(     64.0),
+        SIMDE_FLOAT16_VALUE(    16.45), SIMDE_FLOAT16_VALUE(    -7.62), SIMDE_FLOAT16_VALUE(    42.53), SIMDE_FLOAT16_VALUE(   -65.25),
+        SIMDE_FLOAT16_VALUE(   -26.14), SIMDE_FLOAT16_VALUE(   -22.23), SIMDE_FLOAT16_VALUE(    70.75), SIMDE_FLOAT16_VALUE(    -86.3),
+        SIMDE_FLOAT16_VALUE(   -3.553), SIMDE_FLOAT16_VALUE(    66.25), SIMDE_FLOAT16_VALUE(     89.9), SIMDE_FLOAT16_VALUE(   -53.44) },
+      { SIMDE_FLOAT16_VALUE(     63.0), SIMDE_FLOAT16_VALUE(    39.03), SIMDE_FLOAT16_VALUE(     88.6), SIMDE_FLOAT16_VALUE(     7.73),
+        SIMDE_FLOAT16_VALUE(    -62.3), SIMDE_FLOAT16_VALUE(   -99.06), SIMDE_FLOAT16_VALUE(    46.22), SIMDE_FLOAT16_VALUE(   -36.84),
+        SIMDE_FLOAT16_VALUE(    7.676), SIMDE_FLOAT16_VALUE(     73.9), SIMDE_FLOAT16_VALUE(   -13.92), SIMDE_FLOAT16_VALUE(    -90.4),
+        SIMDE_FLOAT16_VALUE(    2.816), SIMDE_FLOAT16_VALUE(     92.6), SIMDE_FLOAT16_VALUE(   -53.34), SIMDE_FLOAT16_VALUE(   -93.56) },
+      { SIMDE_FLOAT16_VALUE(  -0.1753), SIMDE_FLOAT16_VALUE(    2.488), SIMDE_FLOAT16_VALUE(   0.4082), SIMDE_FLOAT16_VALUE(     8.28),
+        SIMDE_FLOAT16_VALUE(  -0.2642), SIMDE_FLOAT16_VALUE(   0.0769), SIMDE_FLOAT16_VALUE(   0.9204), SIMDE_FLOAT16_VALUE(   1.7705),
+        SIMDE_FLOAT16_VALUE(   -3.406), SIMDE_FLOAT16_VALUE(   -0.301), SIMDE_FLOAT16_VALUE(   -5.082), SIMDE_FLOAT16_VALUE(    0.955),
+        SIMDE_FLOAT16_VALUE(   -1.262), SIMDE_FLOAT16_VALUE(   0.7153), SIMDE_FLOAT16_VALUE(   -1.685), SIMDE_FLOAT16_VALUE(   0.5713) } },
+    { { SIMDE_FLOAT16_VALUE(    57.06), SIMDE_FLOAT16_VALUE(    48.03), SIMDE_FLOAT16_VALUE(    15.56), SIMDE_FLOAT16_VALUE(   10.945),
+        SIMDE_FLOAT16_VALUE(   -28.36), SIMDE_FLOAT16_VALUE(    63.25), SIMDE_FLOAT16_VALUE(    72.56), SIMDE_FLOAT16_VALUE(   -52.12),
+        SIMDE_FLOAT16_VALUE(    -19.9), SIMDE_FLOAT16_VALUE(    -49.1), SIMDE_FLOAT16_VALUE(    61.25), SIMDE_FLOAT16_VALUE(   -42.34),
+        SIMDE_FLOAT16_VALUE(     76.6), SIMDE_FLOAT16_VALUE(    -17.2), SIMDE_FLOAT16_VALUE(    35.12), SIMDE_FLOAT16_VALUE(    34.94) },
+      { SIMDE_FLOAT16_VALUE(    -8.69), SIMDE_FLOAT16_VALUE(   -75.56), SIMDE_FLOAT16_VALUE(    17.73), SIMDE_FLOAT16_VALUE(   -49.75),
+        SIMDE_FLOAT16_VALUE(   -69.44), SIMDE_FLOAT16_VALUE(    92.94), SIMDE_FLOAT16_VALUE(    72.25), SIMDE_FLOAT16_VALUE(    -58.8),
+        SIMDE_FLOAT16_VALUE(   -73.56), SIMDE_FLOAT16_VALUE(   -23.86), SIMDE_FLOAT16_VALUE(   -34.62), SIMDE_FLOAT16_VALUE(     33.5),
+        SIMDE_FLOAT16_VALUE(     88.5), SIMDE_FLOAT16_VALUE(    19.06), SIMDE_FLOAT16_VALUE(    12.61), SIMDE_FLOAT16_VALUE(    -80.2) },
+      { SIMDE_FLOAT16_VALUE(   -6.566), SIMDE_FLOAT16_VALUE(  -0.6357), SIMDE_FLOAT16_VALUE(   0.8774), SIMDE_FLOAT16_VALUE(    -0.22),
+        SIMDE_FLOAT16_VALUE(   0.4084), SIMDE_FLOAT16_VALUE(   0.6807), SIMDE_FLOAT16_VALUE(    1.004), SIMDE_FLOAT16_VALUE(    0.886),
+        SIMDE_FLOAT16_VALUE(   0.2705), SIMDE_FLOAT16_VALUE(    2.059), SIMDE_FLOAT16_VALUE(   -1.769), SIMDE_FLOAT16_VALUE(   -1.264),
+        SIMDE_FLOAT16_VALUE(   0.8657), SIMDE_FLOAT16_VALUE(  -0.9023), SIMDE_FLOAT16_VALUE(    2.785), SIMDE_FLOAT16_VALUE(  -0.4358) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256h a = simde_mm256_loadu_ph(test_vec[i].a);
+    simde__m256h b = simde_mm256_loadu_ph(test_vec[i].b);
+    simde__m256h r = simde_mm256_div_ph(a, b);
+    simde_test_x86_assert_equal_f16x16(r, simde_mm256_loadu_ph(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm512_div_ph (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float16 a[32];
+    const simde_float16 b[32];
+    const simde_float16 r[32];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(     12.0), SIMDE_FLOAT16_VALUE(   -30.98), SIMDE_FLOAT16_VALUE(     85.7), SIMDE_FLOAT16_VALUE(    39.75),
+        SIMDE_FLOAT16_VALUE(     4.56), SIMDE_FLOAT16_VALUE(   -22.06), SIMDE_FLOAT16_VALUE(    -8.74), SIMDE_FLOAT16_VALUE(   -58.06),
+        SIMDE_FLOAT16_VALUE(     61.7), SIMDE_FLOAT16_VALUE(   -43.84), SIMDE_FLOAT16_VALUE(   -29.19), SIMDE_FLOAT16_VALUE(    31.69),
+        SIMDE_FLOAT16_VALUE(    30.97), SIMDE_FLOAT16_VALUE(    6.527), SIMDE_FLOAT16_VALUE(    -46.4), SIMDE_FLOAT16_VALUE(   -93.06),
+        SIMDE_FLOAT16_VALUE(     71.1), SIMDE_FLOAT16_VALUE(    28.42), SIMDE_FLOAT16_VALUE(     5.43), SIMDE_FLOAT16_VALUE(   -26.27),
+        SIMDE_FLOAT16_VALUE(    -89.1), SIMDE_FLOAT16_VALUE(    20.77), SIMDE_FLOAT16_VALUE(     89.5), SIMDE_FLOAT16_VALUE(     72.1),
+        SIMDE_FLOAT16_VALUE(    -89.8), SIMDE_FLOAT16_VALUE(    -45.7), SIMDE_FLOAT16_VALUE(    -44.2), SIMDE_FLOAT16_VALUE(    -59.6),
+        SIMDE_FLOAT16_VALUE(    -45.4), SIMDE_FLOAT16_VALUE(   -61.94), SIMDE_FLOAT16_VALUE(   -86.75), SIMDE_FLOAT16_VALUE(    28.47) },
+      { SIMDE_FLOAT16_VALUE(    1.757), SIMDE_FLOAT16_VALUE(    -72.0), SIMDE_FLOAT16_VALUE(   -32.97), SIMDE_FLOAT16_VALUE(    -82.4),
+        SIMDE_FLOAT16_VALUE(    -83.1), SIMDE_FLOAT16_VALUE(    89.94), SIMDE_FLOAT16_VALUE(     71.2), SIMDE_FLOAT16_VALUE(    -35.6),
+        SIMDE_FLOAT16_VALUE(    -91.9), SIMDE_FLOAT16_VALUE(     36.8), SIMDE_FLOAT16_VALUE(     37.7), SIMDE_FLOAT16_VALUE(     55.5),
+        SIMDE_FLOAT16_VALUE(   -56.22), SIMDE_FLOAT16_VALUE(     89.3), SIMDE_FLOAT16_VALUE(   -74.56), SIMDE_FLOAT16_VALUE(   -43.06),
+        SIMDE_FLOAT16_VALUE(   -49.34), SIMDE_FLOAT16_VALUE(    47.75), SIMDE_FLOAT16_VALUE(    56.94), SIMDE_FLOAT16_VALUE(    78.94),
+        SIMDE_FLOAT16_VALUE(     41.2), SIMDE_FLOAT16_VALUE(    55.22), SIMDE_FLOAT16_VALUE(    -7.62), SIMDE_FLOAT16_VALUE(    75.44),
+        SIMDE_FLOAT16_VALUE(     8.72), SIMDE_FLOAT16_VALUE(    -85.3), SIMDE_FLOAT16_VALUE(     70.1), SIMDE_FLOAT16_VALUE(    69.06),
+        SIMDE_FLOAT16_VALUE(   -85.25), SIMDE_FLOAT16_VALUE(    -71.6), SIMDE_FLOAT16_VALUE(     9.34), SIMDE_FLOAT16_VALUE(    -29.5) },
+      { SIMDE_FLOAT16_VALUE(    6.832), SIMDE_FLOAT16_VALUE(   0.4304), SIMDE_FLOAT16_VALUE(     -2.6), SIMDE_FLOAT16_VALUE(  -0.4827),
+        SIMDE_FLOAT16_VALUE( -0.05484), SIMDE_FLOAT16_VALUE(  -0.2454), SIMDE_FLOAT16_VALUE(  -0.1228), SIMDE_FLOAT16_VALUE(    1.631),
+        SIMDE_FLOAT16_VALUE(  -0.6714), SIMDE_FLOAT16_VALUE(   -1.191), SIMDE_FLOAT16_VALUE(  -0.7744), SIMDE_FLOAT16_VALUE(    0.571),
+        SIMDE_FLOAT16_VALUE(   -0.551), SIMDE_FLOAT16_VALUE(  0.07306), SIMDE_FLOAT16_VALUE(   0.6226), SIMDE_FLOAT16_VALUE(     2.16),
+        SIMDE_FLOAT16_VALUE(   -1.441), SIMDE_FLOAT16_VALUE(    0.595), SIMDE_FLOAT16_VALUE(  0.09534), SIMDE_FLOAT16_VALUE(  -0.3328),
+        SIMDE_FLOAT16_VALUE(   -2.164), SIMDE_FLOAT16_VALUE(    0.376), SIMDE_FLOAT16_VALUE(   -11.74), SIMDE_FLOAT16_VALUE(    0.956),
+        SIMDE_FLOAT16_VALUE(  -10.305), SIMDE_FLOAT16_VALUE(   0.5356), SIMDE_FLOAT16_VALUE(    -0.63), SIMDE_FLOAT16_VALUE(   -0.863),
+        SIMDE_FLOAT16_VALUE(   0.5327), SIMDE_FLOAT16_VALUE(   0.8647), SIMDE_FLOAT16_VALUE(    -9.28), SIMDE_FLOAT16_VALUE(   -0.965) } },
+    { { SIMDE_FLOAT16_VALUE(     96.3), SIMDE_FLOAT16_VALUE(    -20.5), SIMDE_FLOAT16_VALUE(   -47.47), SIMDE_FLOAT16_VALUE(    12.14),
+        SIMDE_FLOAT16_VALUE(    -62.2), SIMDE_FLOAT16_VALUE(    37.78), SIMDE_FLOAT16_VALUE(     98.3), SIMDE_FLOAT16_VALUE(     99.8),
+        SIMDE_FLOAT16_VALUE(   -63.22), SIMDE_FLOAT16_VALUE(   -15.75), SIMDE_FLOAT16_VALUE(    21.98), SIMDE_FLOAT16_VALUE(     36.6),
+        SIMDE_FLOAT16_VALUE(    -75.6), SIMDE_FLOAT16_VALUE(    45.88), SIMDE_FLOAT16_VALUE(     34.7), SIMDE_FLOAT16_VALUE(    20.14),
+        SIMDE_FLOAT16_VALUE(    69.94), SIMDE_FLOAT16_VALUE(   -59.56), SIMDE_FLOAT16_VALUE(   -61.75), SIMDE_FLOAT16_VALUE(     67.9),
+        SIMDE_FLOAT16_VALUE(    -72.4), SIMDE_FLOAT16_VALUE(     88.5), SIMDE_FLOAT16_VALUE(    -88.7), SIMDE_FLOAT16_VALUE(    -28.3),
+        SIMDE_FLOAT16_VALUE(     96.3), SIMDE_FLOAT16_VALUE(   -35.62), SIMDE_FLOAT16_VALUE(     85.9), SIMDE_FLOAT16_VALUE(    10.86),
+        SIMDE_FLOAT16_VALUE(   -65.06), SIMDE_FLOAT16_VALUE(    52.06), SIMDE_FLOAT16_VALUE(     96.4), SIMDE_FLOAT16_VALUE(    97.44) },
+      { SIMDE_FLOAT16_VALUE(     41.8), SIMDE_FLOAT16_VALUE(    -9.11), SIMDE_FLOAT16_VALUE(   -95.25), SIMDE_FLOAT16_VALUE(    77.56),
+        SIMDE_FLOAT16_VALUE(    3.238), SIMDE_FLOAT16_VALUE(   -69.56), SIMDE_FLOAT16_VALUE(     68.8), SIMDE_FLOAT16_VALUE(   -14.23),
+        SIMDE_FLOAT16_VALUE(    -85.5), SIMDE_FLOAT16_VALUE(   -30.02), SIMDE_FLOAT16_VALUE(   -44.22), SIMDE_FLOAT16_VALUE(     54.2),
+        SIMDE_FLOAT16_VALUE(   -13.35), SIMDE_FLOAT16_VALUE(   -47.56), SIMDE_FLOAT16_VALUE(    -74.9), SIMDE_FLOAT16_VALUE(     84.0),
+        SIMDE_FLOAT16_VALUE(    -62.6), SIMDE_FLOAT16_VALUE(     34.1), SIMDE_FLOAT16_VALUE(    63.22), SIMDE_FLOAT16_VALUE(     33.7),
+        SIMDE_FLOAT16_VALUE(    22.69), SIMDE_FLOAT16_VALUE(     20.7), SIMDE_FLOAT16_VALUE(    94.06), SIMDE_FLOAT16_VALUE(     99.4),
+        SIMDE_FLOAT16_VALUE(   -97.44), SIMDE_FLOAT16_VALUE(    -93.4), SIMDE_FLOAT16_VALUE(  -1.9375), SIMDE_FLOAT16_VALUE(     9.03),
+        SIMDE_FLOAT16_VALUE(    34.47), SIMDE_FLOAT16_VALUE(    31.02), SIMDE_FLOAT16_VALUE(     94.8), SIMDE_FLOAT16_VALUE(    -74.0) },
+      { SIMDE_FLOAT16_VALUE(    2.303), SIMDE_FLOAT16_VALUE(     2.25), SIMDE_FLOAT16_VALUE(   0.4983), SIMDE_FLOAT16_VALUE(   0.1565),
+        SIMDE_FLOAT16_VALUE(    -19.2), SIMDE_FLOAT16_VALUE(   -0.543), SIMDE_FLOAT16_VALUE(    1.429), SIMDE_FLOAT16_VALUE(   -7.016),
+        SIMDE_FLOAT16_VALUE(   0.7393), SIMDE_FLOAT16_VALUE(    0.525), SIMDE_FLOAT16_VALUE(   -0.497), SIMDE_FLOAT16_VALUE(   0.6753),
+        SIMDE_FLOAT16_VALUE(    5.664), SIMDE_FLOAT16_VALUE(  -0.9644), SIMDE_FLOAT16_VALUE(  -0.4634), SIMDE_FLOAT16_VALUE(   0.2397),
+        SIMDE_FLOAT16_VALUE(   -1.117), SIMDE_FLOAT16_VALUE(   -1.747), SIMDE_FLOAT16_VALUE(  -0.9766), SIMDE_FLOAT16_VALUE(    2.016),
+        SIMDE_FLOAT16_VALUE(    -3.19), SIMDE_FLOAT16_VALUE(    4.273), SIMDE_FLOAT16_VALUE(   -0.943), SIMDE_FLOAT16_VALUE(  -0.2847),
+        SIMDE_FLOAT16_VALUE(  -0.9883), SIMDE_FLOAT16_VALUE(   0.3816), SIMDE_FLOAT16_VALUE(    -44.3), SIMDE_FLOAT16_VALUE(    1.202),
+        SIMDE_FLOAT16_VALUE(   -1.888), SIMDE_FLOAT16_VALUE(    1.679), SIMDE_FLOAT16_VALUE(    1.017), SIMDE_FLOAT16_VALUE(   -1.316) } },
+    { { SIMDE_FLOAT16_VALUE(     96.8), SIMDE_FLOAT16_VALUE(    -72.9), SIMDE_FLOAT16_VALUE(    46.03), SIMDE_FLOAT16_VALUE(    29.36),
+        SIMDE_FLOAT16_VALUE(    -97.9), SIMDE_FLOAT16_VALUE(    -42.7), SIMDE_FLOAT16_VALUE(    82.06), SIMDE_FLOAT16_VALUE(    74.56),
+        SIMDE_FLOAT16_VALUE(     67.2), SIMDE_FLOAT16_VALUE(   -24.17), SIMDE_FLOAT16_VALUE(     59.5), SIMDE_FLOAT16_VALUE(    24.94),
+        SIMDE_FLOAT16_VALUE(    -69.8), SIMDE_FLOAT16_VALUE(     67.1), SIMDE_FLOAT16_VALUE(    30.06), SIMDE_FLOAT16_VALUE(    -76.0),
+        SIMDE_FLOAT16_VALUE(     85.8), SIMDE_FLOAT16_VALUE(    22.45), SIMDE_FLOAT16_VALUE(    34.03), SIMDE_FLOAT16_VALUE(    46.12),
+        SIMDE_FLOAT16_VALUE(     78.5), SIMDE_FLOAT16_VALUE(    -23.0), SIMDE_FLOAT16_VALUE(    53.53), SIMDE_FLOAT16_VALUE(    57.78),
+        SIMDE_FLOAT16_VALUE(    40.44), SIMDE_FLOAT16_VALUE(    -28.3), SIMDE_FLOAT16_VALUE(   -20.84), SIMDE_FLOAT16_VALUE(     37.9),
+        SIMDE_FLOAT16_VALUE(    54.53), SIMDE_FLOAT16_VALUE(  -11.945), SIMDE_FLOAT16_VALUE(    79.06), SIMDE_FLOAT16_VALUE(    99.25) },
+      { SIMDE_FLOAT16_VALUE(     -3.5), SIMDE_FLOAT16_VALUE(    44.03), SIMDE_FLOAT16_VALUE(    -86.8), SIMDE_FLOAT16_VALUE(    -79.4),
+        SIMDE_FLOAT16_VALUE(    10.23), SIMDE_FLOAT16_VALUE(     40.6), SIMDE_FLOAT16_VALUE(    24.17), SIMDE_FLOAT16_VALUE(    -81.8),
+        SIMDE_FLOAT16_VALUE(    51.25), SIMDE_FLOAT16_VALUE(    82.44), SIMDE_FLOAT16_VALUE(     94.8), SIMDE_FLOAT16_VALUE(    54.94),
+        SIMDE_FLOAT16_VALUE(     45.2), SIMDE_FLOAT16_VALUE(    36.47), SIMDE_FLOAT16_VALUE(    87.94), SIMDE_FLOAT16_VALUE(     71.8),
+        SIMDE_FLOAT16_VALUE(    -70.8), SIMDE_FLOAT16_VALUE(    -45.3), SIMDE_FLOAT16_VALUE(     37.4), SIMDE_FLOAT16_VALUE(    71.94),
+        SIMDE_FLOAT16_VALUE(    -36.7), SIMDE_FLOAT16_VALUE(   -46.25), SIMDE_FLOAT16_VALUE(    -90.3), SIMDE_FLOAT16_VALUE(    37.44),
+        SIMDE_FLOAT16_VALUE(   -29.39), SIMDE_FLOAT16_VALUE(   -60.78), SIMDE_FLOAT16_VALUE(   -36.22), SIMDE_FLOAT16_VALUE(    -85.8),
+        SIMDE_FLOAT16_VALUE(     79.1), SIMDE_FLOAT16_VALUE(     10.9), SIMDE_FLOAT16_VALUE(   -17.77), SIMDE_FLOAT16_VALUE(   -51.28) },
+      { SIMDE_FLOAT16_VALUE(   -27.66), SIMDE_FLOAT16_VALUE(   -1.655), SIMDE_FLOAT16_VALUE(  -0.5303), SIMDE_FLOAT16_VALUE(  -0.3699),
+        SIMDE_FLOAT16_VALUE(    -9.57), SIMDE_FLOAT16_VALUE(   -1.052), SIMDE_FLOAT16_VALUE(    3.395), SIMDE_FLOAT16_VALUE(  -0.9116),
+        SIMDE_FLOAT16_VALUE(    1.311), SIMDE_FLOAT16_VALUE(  -0.2932), SIMDE_FLOAT16_VALUE(   0.6274), SIMDE_FLOAT16_VALUE(   0.4539),
+        SIMDE_FLOAT16_VALUE(   -1.545), SIMDE_FLOAT16_VALUE(    1.841), SIMDE_FLOAT16_VALUE(   0.3418), SIMDE_FLOAT16_VALUE(   -1.059),
+        SIMDE_FLOAT16_VALUE(   -1.212), SIMDE_FLOAT16_VALUE(  -0.4956), SIMDE_FLOAT16_VALUE(   0.9097), SIMDE_FLOAT16_VALUE(    0.641),
+        SIMDE_FLOAT16_VALUE(    -2.14), SIMDE_FLOAT16_VALUE(   0.4973), SIMDE_FLOAT16_VALUE(   -0.593), SIMDE_FLOAT16_VALUE(    1.543),
+        SIMDE_FLOAT16_VALUE(   -1.376), SIMDE_FLOAT16_VALUE(   0.4656), SIMDE_FLOAT16_VALUE(   0.5757), SIMDE_FLOAT16_VALUE(  -0.4417),
+        SIMDE_FLOAT16_VALUE(    0.689), SIMDE_FLOAT16_VALUE(   -1.096), SIMDE_FLOAT16_VALUE(    -4.45), SIMDE_FLOAT16_VALUE(   -1.936) } },
+    { { SIMDE_FLOAT16_VALUE(    1.015), SIMDE_FLOAT16_VALUE(    61.06), SIMDE_FLOAT16_VALUE(   -47.84), SIMDE_FLOAT16_VALUE(    47.94),
+        SIMDE_FLOAT16_VALUE(   -63.06), SIMDE_FLOAT16_VALUE(    74.06), SIMDE_FLOAT16_VALUE(    61.88), SIMDE_FLOAT16_VALUE(   -71.94),
+        SIMDE_FLOAT16_VALUE(    91.44), SIMDE_FLOAT16_VALUE(   15.914), SIMDE_FLOAT16_VALUE(   -83.94), SIMDE_FLOAT16_VALUE(    -43.4),
+        SIMDE_FLOAT16_VALUE(    -88.0), SIMDE_FLOAT16_VALUE(     69.2), SIMDE_FLOAT16_VALUE(    2.006), SIMDE_FLOAT16_VALUE(   -29.36),
+        SIMDE_FLOAT16_VALUE(   -15.79), SIMDE_FLOAT16_VALUE(   -61.44), SIMDE_FLOAT16_VALUE(     64.6), SIMDE_FLOAT16_VALUE(    22.34),
+        SIMDE_FLOAT16_VALUE(    15.75), SIMDE_FLOAT16_VALUE(   -34.75), SIMDE_FLOAT16_VALUE(     17.2), SIMDE_FLOAT16_VALUE(    75.06),
+        SIMDE_FLOAT16_VALUE(    14.61), SIMDE_FLOAT16_VALUE(     44.1), SIMDE_FLOAT16_VALUE(    24.22), SIMDE_FLOAT16_VALUE(    -74.0),
+        SIMDE_FLOAT16_VALUE(    54.44), SIMDE_FLOAT16_VALUE(    25.97), SIMDE_FLOAT16_VALUE(     44.4), SIMDE_FLOAT16_VALUE(   -51.12) },
+      { SIMDE_FLOAT16_VALUE(   -91.25), SIMDE_FLOAT16_VALUE(     9.64), SIMDE_FLOAT16_VALUE(   -55.47), SIMDE_FLOAT16_VALUE(    -80.2),
+        SIMDE_FLOAT16_VALUE(    -15.5), SIMDE_FLOAT16_VALUE(     65.4), SIMDE_FLOAT16_VALUE(    -54.6), SIMDE_FLOAT16_VALUE(   -1.669),
+        SIMDE_FLOAT16_VALUE(   -29.27), SIMDE_FLOAT16_VALUE(    -42.0), SIMDE_FLOAT16_VALUE(    -92.3), SIMDE_FLOAT16_VALUE(   14.516),
+        SIMDE_FLOAT16_VALUE(    12.14), SIMDE_FLOAT16_VALUE(   -7.957), SIMDE_FLOAT16_VALUE(   -65.56), SIMDE_FLOAT16_VALUE(   -17.06),
+        SIMDE_FLOAT16_VALUE(   -39.84), SIMDE_FLOAT16_VALUE(    -6.66), SIMDE_FLOAT16_VALUE(   -17.62), SIMDE_FLOAT16_VALUE(   -79.44),
+        SIMDE_FLOAT16_VALUE(    -98.8), SIMDE_FLOAT16_VALUE(    40.03), SIMDE_FLOAT16_VALUE(    14.22), SIMDE_FLOAT16_VALUE(   -23.81),
+        SIMDE_FLOAT16_VALUE(    -67.7), SIMDE_FLOAT16_VALUE(   -37.47), SIMDE_FLOAT16_VALUE(   -52.94), SIMDE_FLOAT16_VALUE(   -23.03),
+        SIMDE_FLOAT16_VALUE(     92.5), SIMDE_FLOAT16_VALUE(     84.2), SIMDE_FLOAT16_VALUE(    59.62), SIMDE_FLOAT16_VALUE(    60.22) },
+      { SIMDE_FLOAT16_VALUE(-0.011116), SIMDE_FLOAT16_VALUE(    6.332), SIMDE_FLOAT16_VALUE(   0.8623), SIMDE_FLOAT16_VALUE(  -0.5977),
+        SIMDE_FLOAT16_VALUE(     4.07), SIMDE_FLOAT16_VALUE(    1.133), SIMDE_FLOAT16_VALUE(   -1.134), SIMDE_FLOAT16_VALUE(     43.1),
+        SIMDE_FLOAT16_VALUE(   -3.125), SIMDE_FLOAT16_VALUE(   -0.379), SIMDE_FLOAT16_VALUE(    0.909), SIMDE_FLOAT16_VALUE(    -2.99),
+        SIMDE_FLOAT16_VALUE(    -7.25), SIMDE_FLOAT16_VALUE(   -8.695), SIMDE_FLOAT16_VALUE(  -0.0306), SIMDE_FLOAT16_VALUE(    1.721),
+        SIMDE_FLOAT16_VALUE(   0.3962), SIMDE_FLOAT16_VALUE(     9.23), SIMDE_FLOAT16_VALUE(   -3.666), SIMDE_FLOAT16_VALUE(  -0.2812),
+        SIMDE_FLOAT16_VALUE(  -0.1594), SIMDE_FLOAT16_VALUE(   -0.868), SIMDE_FLOAT16_VALUE(     1.21), SIMDE_FLOAT16_VALUE(   -3.152),
+        SIMDE_FLOAT16_VALUE(  -0.2158), SIMDE_FLOAT16_VALUE(   -1.177), SIMDE_FLOAT16_VALUE(  -0.4575), SIMDE_FLOAT16_VALUE(    3.213),
+        SIMDE_FLOAT16_VALUE(   0.5884), SIMDE_FLOAT16_VALUE(   0.3083), SIMDE_FLOAT16_VALUE(   0.7446), SIMDE_FLOAT16_VALUE(   -0.849) } },
+    { { SIMDE_FLOAT16_VALUE(   -27.52), SIMDE_FLOAT16_VALUE(   -15.66), SIMDE_FLOAT16_VALUE(    3.314), SIMDE_FLOAT16_VALUE(    -62.4),
+        SIMDE_FLOAT16_VALUE(    -89.4), SIMDE_FLOAT16_VALUE(    -68.5), SIMDE_FLOAT16_VALUE(    74.56), SIMDE_FLOAT16_VALUE(     89.7),
+        SIMDE_FLOAT16_VALUE(   -35.56), SIMDE_FLOAT16_VALUE(   -1.203), SIMDE_FLOAT16_VALUE(   -38.38), SIMDE_FLOAT16_VALUE(     77.8),
+        SIMDE_FLOAT16_VALUE(    7.848), SIMDE_FLOAT16_VALUE(    18.69), SIMDE_FLOAT16_VALUE(    27.53), SIMDE_FLOAT16_VALUE(   -23.06),
+        SIMDE_FLOAT16_VALUE(     64.3), SIMDE_FLOAT16_VALUE(    -70.5), SIMDE_FLOAT16_VALUE(    -68.7), SIMDE_FLOAT16_VALUE(   -32.22),
+        SIMDE_FLOAT16_VALUE(    74.75), SIMDE_FLOAT16_VALUE(    9.625), SIMDE_FLOAT16_VALUE(    73.25), SIMDE_FLOAT16_VALUE(    -97.8),
+        SIMDE_FLOAT16_VALUE(     77.0), SIMDE_FLOAT16_VALUE(    63.94), SIMDE_FLOAT16_VALUE(    6.277), SIMDE_FLOAT16_VALUE(    -84.9),
+        SIMDE_FLOAT16_VALUE(    29.45), SIMDE_FLOAT16_VALUE(    2.156), SIMDE_FLOAT16_VALUE(   -52.66), SIMDE_FLOAT16_VALUE(    -72.9) },
+      { SIMDE_FLOAT16_VALUE(   -26.94), SIMDE_FLOAT16_VALUE(   -21.14), SIMDE_FLOAT16_VALUE(     79.0), SIMDE_FLOAT16_VALUE(     95.2),
+        SIMDE_FLOAT16_VALUE(    36.56), SIMDE_FLOAT16_VALUE(    -78.3), SIMDE_FLOAT16_VALUE(   -79.44), SIMDE_FLOAT16_VALUE(    96.25),
+        SIMDE_FLOAT16_VALUE(    30.86), SIMDE_FLOAT16_VALUE(     98.3), SIMDE_FLOAT16_VALUE(  -11.945), SIMDE_FLOAT16_VALUE(     79.6),
+        SIMDE_FLOAT16_VALUE(   -11.75), SIMDE_FLOAT16_VALUE(    91.75), SIMDE_FLOAT16_VALUE(     57.5), SIMDE_FLOAT16_VALUE(   -16.92),
+        SIMDE_FLOAT16_VALUE(     82.9), SIMDE_FLOAT16_VALUE(     48.2), SIMDE_FLOAT16_VALUE(    -65.0), SIMDE_FLOAT16_VALUE(    -35.8),
+        SIMDE_FLOAT16_VALUE(    -67.8), SIMDE_FLOAT16_VALUE(   -48.88), SIMDE_FLOAT16_VALUE(   -16.53), SIMDE_FLOAT16_VALUE(    -92.2),
+        SIMDE_FLOAT16_VALUE(    -75.4), SIMDE_FLOAT16_VALUE(    35.03), SIMDE_FLOAT16_VALUE(    6.867), SIMDE_FLOAT16_VALUE(    -9.04),
+        SIMDE_FLOAT16_VALUE(   -36.56), SIMDE_FLOAT16_VALUE(     79.2), SIMDE_FLOAT16_VALUE(    -25.9), SIMDE_FLOAT16_VALUE(    35.16) },
+      { SIMDE_FLOAT16_VALUE(    1.021), SIMDE_FLOAT16_VALUE(   0.7407), SIMDE_FLOAT16_VALUE(  0.04196), SIMDE_FLOAT16_VALUE(   -0.656),
+        SIMDE_FLOAT16_VALUE(   -2.445), SIMDE_FLOAT16_VALUE(   0.8745), SIMDE_FLOAT16_VALUE(  -0.9385), SIMDE_FLOAT16_VALUE(   0.9316),
+        SIMDE_FLOAT16_VALUE(   -1.152), SIMDE_FLOAT16_VALUE( -0.01224), SIMDE_FLOAT16_VALUE(    3.213), SIMDE_FLOAT16_VALUE(    0.977),
+        SIMDE_FLOAT16_VALUE(   -0.668), SIMDE_FLOAT16_VALUE(   0.2037), SIMDE_FLOAT16_VALUE(   0.4788), SIMDE_FLOAT16_VALUE(    1.363),
+        SIMDE_FLOAT16_VALUE(    0.776), SIMDE_FLOAT16_VALUE(   -1.463), SIMDE_FLOAT16_VALUE(    1.057), SIMDE_FLOAT16_VALUE(   0.8994),
+        SIMDE_FLOAT16_VALUE(   -1.103), SIMDE_FLOAT16_VALUE(  -0.1969), SIMDE_FLOAT16_VALUE(    -4.43), SIMDE_FLOAT16_VALUE(    1.061),
+        SIMDE_FLOAT16_VALUE(   -1.021), SIMDE_FLOAT16_VALUE(    1.825), SIMDE_FLOAT16_VALUE(    0.914), SIMDE_FLOAT16_VALUE(     9.39),
+        SIMDE_FLOAT16_VALUE(  -0.8057), SIMDE_FLOAT16_VALUE(  0.02724), SIMDE_FLOAT16_VALUE(    2.033), SIMDE_FLOAT16_VALUE(   -2.072) } },
+    { { SIMDE_FLOAT16_VALUE(    43.97), SIMDE_FLOAT16_VALUE(    30.38), SIMDE_FLOAT16_VALUE(    -96.2), SIMDE_FLOAT16_VALUE(     97.5),
+        SIMDE_FLOAT16_VALUE(   -37.34), SIMDE_FLOAT16_VALUE(   -3.283), SIMDE_FLOAT16_VALUE(    -81.5), SIMDE_FLOAT16_VALUE(     80.9),
+        SIMDE_FLOAT16_VALUE(   -25.61), SIMDE_FLOAT16_VALUE(    -65.5), SIMDE_FLOAT16_VALUE(   -80.94), SIMDE_FLOAT16_VALUE(    7.797),
+        SIMDE_FLOAT16_VALUE(    10.24), SIMDE_FLOAT16_VALUE(    91.25), SIMDE_FLOAT16_VALUE(     75.2), SIMDE_FLOAT16_VALUE(     83.2),
+        SIMDE_FLOAT16_VALUE(   -7.902), SIMDE_FLOAT16_VALUE(    58.62), SIMDE_FLOAT16_VALUE(     80.9), SIMDE_FLOAT16_VALUE(    -76.4),
+        SIMDE_FLOAT16_VALUE(    52.53), SIMDE_FLOAT16_VALUE(    23.47), SIMDE_FLOAT16_VALUE(   0.1721), SIMDE_FLOAT16_VALUE(    -98.8),
+        SIMDE_FLOAT16_VALUE(    -65.4), SIMDE_FLOAT16_VALUE(     82.9), SIMDE_FLOAT16_VALUE(     75.1), SIMDE_FLOAT16_VALUE(     59.6),
+        SIMDE_FLOAT16_VALUE(     33.4), SIMDE_FLOAT16_VALUE(   -82.56), SIMDE_FLOAT16_VALUE(     82.6), SIMDE_FLOAT16_VALUE(    -64.5) },
+      { SIMDE_FLOAT16_VALUE(     34.7), SIMDE_FLOAT16_VALUE(    63.97), SIMDE_FLOAT16_VALUE(    58.06), SIMDE_FLOAT16_VALUE(    93.06),
+        SIMDE_FLOAT16_VALUE(    37.97), SIMDE_FLOAT16_VALUE(     91.8), SIMDE_FLOAT16_VALUE(    41.56), SIMDE_FLOAT16_VALUE(    -75.2),
+        SIMDE_FLOAT16_VALUE(     37.7), SIMDE_FLOAT16_VALUE(    48.38), SIMDE_FLOAT16_VALUE(   -81.25), SIMDE_FLOAT16_VALUE(    75.94),
+        SIMDE_FLOAT16_VALUE(   -39.75), SIMDE_FLOAT16_VALUE(   -17.53), SIMDE_FLOAT16_VALUE(     64.1), SIMDE_FLOAT16_VALUE(   -78.94),
+        SIMDE_FLOAT16_VALUE(   -57.47), SIMDE_FLOAT16_VALUE(    36.72), SIMDE_FLOAT16_VALUE(    -39.7), SIMDE_FLOAT16_VALUE(    83.06),
+        SIMDE_FLOAT16_VALUE(    -90.8), SIMDE_FLOAT16_VALUE(    45.53), SIMDE_FLOAT16_VALUE(  -13.695), SIMDE_FLOAT16_VALUE(   -19.73),
+        SIMDE_FLOAT16_VALUE(    -20.8), SIMDE_FLOAT16_VALUE(   -61.72), SIMDE_FLOAT16_VALUE(   -56.66), SIMDE_FLOAT16_VALUE(    91.75),
+        SIMDE_FLOAT16_VALUE(    -26.3), SIMDE_FLOAT16_VALUE(    -55.1), SIMDE_FLOAT16_VALUE(    -40.2), SIMDE_FLOAT16_VALUE(    -96.4) },
+      { SIMDE_FLOAT16_VALUE(    1.268), SIMDE_FLOAT16_VALUE(   0.4749), SIMDE_FLOAT16_VALUE(   -1.656), SIMDE_FLOAT16_VALUE(    1.048),
+        SIMDE_FLOAT16_VALUE(  -0.9834), SIMDE_FLOAT16_VALUE( -0.03577), SIMDE_FLOAT16_VALUE(   -1.961), SIMDE_FLOAT16_VALUE(   -1.075),
+        SIMDE_FLOAT16_VALUE(  -0.6797), SIMDE_FLOAT16_VALUE(  -1.3545), SIMDE_FLOAT16_VALUE(    0.996), SIMDE_FLOAT16_VALUE(  0.10266),
+        SIMDE_FLOAT16_VALUE(  -0.2576), SIMDE_FLOAT16_VALUE(   -5.203), SIMDE_FLOAT16_VALUE(    1.173), SIMDE_FLOAT16_VALUE(   -1.054),
+        SIMDE_FLOAT16_VALUE(   0.1375), SIMDE_FLOAT16_VALUE(    1.597), SIMDE_FLOAT16_VALUE(   -2.037), SIMDE_FLOAT16_VALUE(  -0.9194),
+        SIMDE_FLOAT16_VALUE(  -0.5786), SIMDE_FLOAT16_VALUE(   0.5156), SIMDE_FLOAT16_VALUE(-0.012566), SIMDE_FLOAT16_VALUE(    5.008),
+        SIMDE_FLOAT16_VALUE(    3.143), SIMDE_FLOAT16_VALUE(   -1.343), SIMDE_FLOAT16_VALUE(   -1.326), SIMDE_FLOAT16_VALUE(   0.6494),
+        SIMDE_FLOAT16_VALUE(  -1.2705), SIMDE_FLOAT16_VALUE(    1.499), SIMDE_FLOAT16_VALUE(   -2.057), SIMDE_FLOAT16_VALUE(   0.6694) } },
+    { { SIMDE_FLOAT16_VALUE(    69.56), SIMDE_FLOAT16_VALUE(   -53.06), SIMDE_FLOAT16_VALUE(     90.7), SIMDE_FLOAT16_VALUE(   -35.25),
+        SIMDE_FLOAT16_VALUE(   -54.25), SIMDE_FLOAT16_VALUE(     64.1), SIMDE_FLOAT16_VALUE(    93.75), SIMDE_FLOAT16_VALUE(   -45.78),
+        SIMDE_FLOAT16_VALUE(     9.85), SIMDE_FLOAT16_VALUE(     99.2), SIMDE_FLOAT16_VALUE(   -27.56), SIMDE_FLOAT16_VALUE(    -53.9),
+        SIMDE_FLOAT16_VALUE(     8.37), SIMDE_FLOAT16_VALUE(    -82.9), SIMDE_FLOAT16_VALUE(     87.6), SIMDE_FLOAT16_VALUE(   -37.38),
+        SIMDE_FLOAT16_VALUE(    -44.5), SIMDE_FLOAT16_VALUE(     64.6), SIMDE_FLOAT16_VALUE(    34.62), SIMDE_FLOAT16_VALUE(     97.3),
+        SIMDE_FLOAT16_VALUE(   13.484), SIMDE_FLOAT16_VALUE(   -87.75), SIMDE_FLOAT16_VALUE(   -55.56), SIMDE_FLOAT16_VALUE(    37.62),
+        SIMDE_FLOAT16_VALUE(     84.6), SIMDE_FLOAT16_VALUE(    24.67), SIMDE_FLOAT16_VALUE(   -97.56), SIMDE_FLOAT16_VALUE(    12.15),
+        SIMDE_FLOAT16_VALUE(    -36.2), SIMDE_FLOAT16_VALUE(   0.0725), SIMDE_FLOAT16_VALUE(   -44.78), SIMDE_FLOAT16_VALUE(     71.4) },
+      { SIMDE_FLOAT16_VALUE(     67.9), SIMDE_FLOAT16_VALUE(    5.094), SIMDE_FLOAT16_VALUE(    26.27), SIMDE_FLOAT16_VALUE(    -50.3),
+        SIMDE_FLOAT16_VALUE(    59.88), SIMDE_FLOAT16_VALUE(     66.6), SIMDE_FLOAT16_VALUE(    -43.2), SIMDE_FLOAT16_VALUE(     67.7),
+        SIMDE_FLOAT16_VALUE(   -80.44), SIMDE_FLOAT16_VALUE(    71.44), SIMDE_FLOAT16_VALUE(   -26.27), SIMDE_FLOAT16_VALUE(   -60.44),
+        SIMDE_FLOAT16_VALUE(    30.73), SIMDE_FLOAT16_VALUE(   -48.34), SIMDE_FLOAT16_VALUE(    81.06), SIMDE_FLOAT16_VALUE(     61.1),
+        SIMDE_FLOAT16_VALUE(   -89.25), SIMDE_FLOAT16_VALUE(    35.84), SIMDE_FLOAT16_VALUE(   -29.83), SIMDE_FLOAT16_VALUE(   -36.78),
+        SIMDE_FLOAT16_VALUE(     83.0), SIMDE_FLOAT16_VALUE(    -90.7), SIMDE_FLOAT16_VALUE(    5.395), SIMDE_FLOAT16_VALUE(    52.94),
+        SIMDE_FLOAT16_VALUE(    -86.9), SIMDE_FLOAT16_VALUE(    40.22), SIMDE_FLOAT16_VALUE(    61.22), SIMDE_FLOAT16_VALUE(     72.0),
+        SIMDE_FLOAT16_VALUE(   -47.66), SIMDE_FLOAT16_VALUE(   -13.39), SIMDE_FLOAT16_VALUE(   -17.84), SIMDE_FLOAT16_VALUE(    60.78) },
+      { SIMDE_FLOAT16_VALUE(    1.024), SIMDE_FLOAT16_VALUE(  -10.414), SIMDE_FLOAT16_VALUE(    3.453), SIMDE_FLOAT16_VALUE(   0.7007),
+        SIMDE_FLOAT16_VALUE(  -0.9062), SIMDE_FLOAT16_VALUE(   0.9624), SIMDE_FLOAT16_VALUE(    -2.17), SIMDE_FLOAT16_VALUE(  -0.6763),
+        SIMDE_FLOAT16_VALUE(  -0.1225), SIMDE_FLOAT16_VALUE(    1.389), SIMDE_FLOAT16_VALUE(     1.05), SIMDE_FLOAT16_VALUE(    0.892),
+        SIMDE_FLOAT16_VALUE(   0.2722), SIMDE_FLOAT16_VALUE(    1.714), SIMDE_FLOAT16_VALUE(    1.081), SIMDE_FLOAT16_VALUE(   -0.612),
+        SIMDE_FLOAT16_VALUE(   0.4985), SIMDE_FLOAT16_VALUE(    1.803), SIMDE_FLOAT16_VALUE(   -1.161), SIMDE_FLOAT16_VALUE(   -2.646),
+        SIMDE_FLOAT16_VALUE(   0.1625), SIMDE_FLOAT16_VALUE(    0.968), SIMDE_FLOAT16_VALUE(    -10.3), SIMDE_FLOAT16_VALUE(    0.711),
+        SIMDE_FLOAT16_VALUE(   -0.974), SIMDE_FLOAT16_VALUE(   0.6133), SIMDE_FLOAT16_VALUE(   -1.594), SIMDE_FLOAT16_VALUE(   0.1687),
+        SIMDE_FLOAT16_VALUE(   0.7593), SIMDE_FLOAT16_VALUE(-0.005417), SIMDE_FLOAT16_VALUE(     2.51), SIMDE_FLOAT16_VALUE(    1.174) } },
+    { { SIMDE_FLOAT16_VALUE(    -36.8), SIMDE_FLOAT16_VALUE(     45.9), SIMDE_FLOAT16_VALUE(    88.06), SIMDE_FLOAT16_VALUE(   -50.84),
+        SIMDE_FLOAT16_VALUE(     92.2), SIMDE_FLOAT16_VALUE(    39.16), SIMDE_FLOAT16_VALUE(    -71.5), SIMDE_FLOAT16_VALUE(   -33.62),
+        SIMDE_FLOAT16_VALUE(   -48.22), SIMDE_FLOAT16_VALUE(    -90.5), SIMDE_FLOAT16_VALUE(     42.9), SIMDE_FLOAT16_VALUE(     83.0),
+        SIMDE_FLOAT16_VALUE(     55.5), SIMDE_FLOAT16_VALUE(   -16.14), SIMDE_FLOAT16_VALUE(   -83.75), SIMDE_FLOAT16_VALUE(   -46.22),
+        SIMDE_FLOAT16_VALUE(   -53.44), SIMDE_FLOAT16_VALUE(    27.36), SIMDE_FLOAT16_VALUE(    44.72), SIMDE_FLOAT16_VALUE(     0.22),
+        SIMDE_FLOAT16_VALUE(   -40.72), SIMDE_FLOAT16_VALUE(   -78.94), SIMDE_FLOAT16_VALUE(   -41.72), SIMDE_FLOAT16_VALUE(    -55.3),
+        SIMDE_FLOAT16_VALUE(   -48.34), SIMDE_FLOAT16_VALUE(    44.56), SIMDE_FLOAT16_VALUE(    41.28), SIMDE_FLOAT16_VALUE(   -76.06),
+        SIMDE_FLOAT16_VALUE(     69.5), SIMDE_FLOAT16_VALUE(    75.75), SIMDE_FLOAT16_VALUE(    15.71), SIMDE_FLOAT16_VALUE(    83.56) },
+      { SIMDE_FLOAT16_VALUE(    44.12), SIMDE_FLOAT16_VALUE(    10.64), SIMDE_FLOAT16_VALUE(    -94.8), SIMDE_FLOAT16_VALUE(    -81.7),
+        SIMDE_FLOAT16_VALUE(    62.38), SIMDE_FLOAT16_VALUE(   -19.17), SIMDE_FLOAT16_VALUE(   -92.94), SIMDE_FLOAT16_VALUE(     65.3),
+        SIMDE_FLOAT16_VALUE(    -8.19), SIMDE_FLOAT16_VALUE(    50.34), SIMDE_FLOAT16_VALUE(    75.44), SIMDE_FLOAT16_VALUE(   -52.72),
+        SIMDE_FLOAT16_VALUE(    4.402), SIMDE_FLOAT16_VALUE(   -33.16), SIMDE_FLOAT16_VALUE(    27.34), SIMDE_FLOAT16_VALUE(   -88.06),
+        SIMDE_FLOAT16_VALUE(     7.43), SIMDE_FLOAT16_VALUE(   -73.44), SIMDE_FLOAT16_VALUE(    5.285), SIMDE_FLOAT16_VALUE(   -20.95),
+        SIMDE_FLOAT16_VALUE(   -63.25), SIMDE_FLOAT16_VALUE(    4.754), SIMDE_FLOAT16_VALUE(    68.94), SIMDE_FLOAT16_VALUE(     67.2),
+        SIMDE_FLOAT16_VALUE(     27.9), SIMDE_FLOAT16_VALUE(    -37.2), SIMDE_FLOAT16_VALUE(    -89.7), SIMDE_FLOAT16_VALUE(    77.44),
+        SIMDE_FLOAT16_VALUE(    74.06), SIMDE_FLOAT16_VALUE(    57.03), SIMDE_FLOAT16_VALUE(   -96.06), SIMDE_FLOAT16_VALUE(   -39.22) },
+      { SIMDE_FLOAT16_VALUE(  -0.8345), SIMDE_FLOAT16_VALUE(    4.312), SIMDE_FLOAT16_VALUE(  -0.9287), SIMDE_FLOAT16_VALUE(   0.6226),
+        SIMDE_FLOAT16_VALUE(    1.478), SIMDE_FLOAT16_VALUE(   -2.043), SIMDE_FLOAT16_VALUE(   0.7695), SIMDE_FLOAT16_VALUE(  -0.5146),
+        SIMDE_FLOAT16_VALUE(     5.89), SIMDE_FLOAT16_VALUE(   -1.798), SIMDE_FLOAT16_VALUE(    0.569), SIMDE_FLOAT16_VALUE(   -1.574),
+        SIMDE_FLOAT16_VALUE(    12.61), SIMDE_FLOAT16_VALUE(   0.4868), SIMDE_FLOAT16_VALUE(   -3.062), SIMDE_FLOAT16_VALUE(    0.525),
+        SIMDE_FLOAT16_VALUE(    -7.19), SIMDE_FLOAT16_VALUE(  -0.3726), SIMDE_FLOAT16_VALUE(     8.46), SIMDE_FLOAT16_VALUE(  -0.0105),
+        SIMDE_FLOAT16_VALUE(   0.6436), SIMDE_FLOAT16_VALUE(   -16.61), SIMDE_FLOAT16_VALUE(   -0.605), SIMDE_FLOAT16_VALUE(   -0.823),
+        SIMDE_FLOAT16_VALUE(   -1.732), SIMDE_FLOAT16_VALUE(   -1.198), SIMDE_FLOAT16_VALUE(  -0.4602), SIMDE_FLOAT16_VALUE(  -0.9824),
+        SIMDE_FLOAT16_VALUE(   0.9385), SIMDE_FLOAT16_VALUE(    1.328), SIMDE_FLOAT16_VALUE(  -0.1636), SIMDE_FLOAT16_VALUE(    -2.13) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512h a = simde_mm512_loadu_ph(test_vec[i].a);
+    simde__m512h b = simde_mm512_loadu_ph(test_vec[i].b);
+    simde__m512h r = simde_mm512_div_ph(a, b);
+    simde_test_x86_assert_equal_f16x32(r, simde_mm512_loadu_ph(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
 SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_div_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_div_ps)
@@ -819,6 +1218,12 @@ SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_div_pd)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_div_pd)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_div_pd)
+
+  #if defined(SIMDE_FLOAT16_IS_SCALAR)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm_div_ph)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm256_div_ph)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm512_div_ph)
+  #endif
 SIMDE_TEST_FUNC_LIST_END
 
 #include <test/x86/avx512/test-avx512-footer.h>
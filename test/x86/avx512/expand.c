@@ -156,9 +156,2709 @@ test_simde_mm256_maskz_expand_epi32 (SIMDE_MUNIT_TEST_ARGS) {
 #endif
 }
 
+static int
+test_simde_mm_mask_expand_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int8_t src[16];
+    const simde__mmask16 k;
+    const int8_t a[16];
+    const int8_t r[16];
+  } test_vec[] = {
+    { { -INT8_C(  16), -INT8_C(  27), -INT8_C(  11),  INT8_C(  75),  INT8_C(  62), -INT8_C(  85),  INT8_C( 107),  INT8_C(  28),
+        -INT8_C( 127),  INT8_C(  99), -INT8_C(  28), -INT8_C(  38),  INT8_C(  86),  INT8_C(  70), -INT8_C(   3),  INT8_C(  90) },
+      UINT16_C(25652),
+      { -INT8_C(  19),  INT8_C(  52), -INT8_C(  59), -INT8_C(  24),  INT8_C(  86), -INT8_C(  50), -INT8_C(  73),  INT8_C(  63),
+         INT8_C(  72),  INT8_C( 122),  INT8_C(   1),  INT8_C( 126), -INT8_C(   7), -INT8_C(  15),  INT8_C(  99), -INT8_C(  17) },
+      { -INT8_C(  16), -INT8_C(  27), -INT8_C(  19),  INT8_C(  75),  INT8_C(  52), -INT8_C(  59),  INT8_C( 107),  INT8_C(  28),
+        -INT8_C( 127),  INT8_C(  99), -INT8_C(  24), -INT8_C(  38),  INT8_C(  86),  INT8_C(  86), -INT8_C(  50),  INT8_C(  90) } },
+    { {  INT8_C(  60), -INT8_C(  95), -INT8_C( 102), -INT8_C(  89), -INT8_C(  66),  INT8_C(  27),  INT8_C(  10), -INT8_C(  94),
+        -INT8_C(  10),  INT8_C(  96), -INT8_C(  24), -INT8_C(  13), -INT8_C(  70),  INT8_C(  28),  INT8_C(  87), -INT8_C(  89) },
+      UINT16_C( 7248),
+      { -INT8_C( 112), -INT8_C(  90), -INT8_C(  22),  INT8_C(  71), -INT8_C(  27),  INT8_C(  50), -INT8_C(  63), -INT8_C(  25),
+        -INT8_C(  79), -INT8_C(  69), -INT8_C(  40),  INT8_C(  20), -INT8_C(  86),  INT8_C(  21), -INT8_C(  74),  INT8_C(  68) },
+      {  INT8_C(  60), -INT8_C(  95), -INT8_C( 102), -INT8_C(  89), -INT8_C( 112),  INT8_C(  27), -INT8_C(  90), -INT8_C(  94),
+        -INT8_C(  10),  INT8_C(  96), -INT8_C(  22),  INT8_C(  71), -INT8_C(  27),  INT8_C(  28),  INT8_C(  87), -INT8_C(  89) } },
+    { { -INT8_C(  68),  INT8_C( 116),  INT8_C(  96), -INT8_C(  57),  INT8_C(  22),  INT8_C(  86),  INT8_C(  39), -INT8_C(   2),
+         INT8_C(  73), -INT8_C(  30),  INT8_C(  27), -INT8_C(  96), -INT8_C( 119),  INT8_C( 107), -INT8_C(  68),  INT8_C(  25) },
+      UINT16_C(42514),
+      {  INT8_C(  96), -INT8_C(   9), -INT8_C(  40),  INT8_C(  34), -INT8_C(  34), -INT8_C( 119), -INT8_C(  35), -INT8_C(  73),
+        -INT8_C(  98), -INT8_C( 121), -INT8_C(  52),  INT8_C(  84), -INT8_C(  53), -INT8_C( 120), -INT8_C(  56),  INT8_C(  43) },
+      { -INT8_C(  68),  INT8_C(  96),  INT8_C(  96), -INT8_C(  57), -INT8_C(   9),  INT8_C(  86),  INT8_C(  39), -INT8_C(   2),
+         INT8_C(  73), -INT8_C(  40),  INT8_C(  34), -INT8_C(  96), -INT8_C( 119), -INT8_C(  34), -INT8_C(  68), -INT8_C( 119) } },
+    { {  INT8_C(  79), -INT8_C(  34), -INT8_C( 127),  INT8_C( 119), -INT8_C(  36), -INT8_C(  54),  INT8_C(  89), -INT8_C(   9),
+         INT8_C( 106), -INT8_C(  30),  INT8_C(  99),  INT8_C(  38), -INT8_C(   4),  INT8_C( 117), -INT8_C(  52),  INT8_C(  92) },
+      UINT16_C(42348),
+      {  INT8_C( 126),  INT8_C(  75),  INT8_C(  46),  INT8_C(  91),  INT8_C(   2), -INT8_C(  52), -INT8_C(  30), -INT8_C(  50),
+         INT8_C(  32), -INT8_C(  82),  INT8_C(  86), -INT8_C(  24), -INT8_C(  39), -INT8_C(  90), -INT8_C(  58),  INT8_C(  91) },
+      {  INT8_C(  79), -INT8_C(  34),  INT8_C( 126),  INT8_C(  75), -INT8_C(  36),  INT8_C(  46),  INT8_C(  91), -INT8_C(   9),
+         INT8_C(   2), -INT8_C(  30), -INT8_C(  52),  INT8_C(  38), -INT8_C(   4), -INT8_C(  30), -INT8_C(  52), -INT8_C(  50) } },
+    { {  INT8_C(  29), -INT8_C(  93),  INT8_C(  37),  INT8_C( 118), -INT8_C( 102), -INT8_C( 112),  INT8_C(  88), -INT8_C(   3),
+        -INT8_C(  74),  INT8_C(  84),  INT8_C( 114), -INT8_C( 125), -INT8_C(  79), -INT8_C(  33),  INT8_C(  40),  INT8_C(  47) },
+      UINT16_C(22058),
+      { -INT8_C( 117),  INT8_C(  44),  INT8_C(  35),  INT8_C( 109), -INT8_C(   6),  INT8_C(  67),  INT8_C(  27),  INT8_C(  80),
+         INT8_C(  44), -INT8_C(  11), -INT8_C(  10), -INT8_C(  14),  INT8_C(  80),  INT8_C(  19), -INT8_C( 107),  INT8_C( 117) },
+      {  INT8_C(  29), -INT8_C( 117),  INT8_C(  37),  INT8_C(  44), -INT8_C( 102),  INT8_C(  35),  INT8_C(  88), -INT8_C(   3),
+        -INT8_C(  74),  INT8_C( 109), -INT8_C(   6), -INT8_C( 125),  INT8_C(  67), -INT8_C(  33),  INT8_C(  27),  INT8_C(  47) } },
+    { { -INT8_C( 119),  INT8_C(  48),  INT8_C(   5), -INT8_C(  30),  INT8_C(  45), -INT8_C(  68),  INT8_C(  54), -INT8_C(  96),
+         INT8_C(  63), -INT8_C(  25),      INT8_MAX,  INT8_C( 103),  INT8_C(  23), -INT8_C(  87), -INT8_C(  67), -INT8_C(  94) },
+      UINT16_C(57557),
+      {  INT8_C(  15), -INT8_C(  49),  INT8_C(  36),  INT8_C(  43),  INT8_C(  31),  INT8_C(  80),  INT8_C(  32),  INT8_C(  22),
+         INT8_C(  66),  INT8_C( 112),  INT8_C(  41), -INT8_C(  40), -INT8_C(  27), -INT8_C(  77),  INT8_C(   8), -INT8_C(  21) },
+      {  INT8_C(  15),  INT8_C(  48), -INT8_C(  49), -INT8_C(  30),  INT8_C(  36), -INT8_C(  68),  INT8_C(  43),  INT8_C(  31),
+         INT8_C(  63), -INT8_C(  25),      INT8_MAX,  INT8_C( 103),  INT8_C(  23),  INT8_C(  80),  INT8_C(  32),  INT8_C(  22) } },
+    { { -INT8_C( 107),  INT8_C(  53), -INT8_C(  89), -INT8_C(  53), -INT8_C(  43), -INT8_C(  26), -INT8_C(  77),  INT8_C(  84),
+         INT8_C(  77), -INT8_C(  54), -INT8_C(   3),  INT8_C(  10),  INT8_C( 108), -INT8_C(  46), -INT8_C(  21),  INT8_C( 123) },
+      UINT16_C( 4001),
+      { -INT8_C(  90), -INT8_C(  63),  INT8_C(  95), -INT8_C(  58), -INT8_C(  41), -INT8_C(  95),  INT8_C(  54),  INT8_C(   0),
+         INT8_C( 121),  INT8_C(  28), -INT8_C(  77), -INT8_C( 127),  INT8_C(   7),  INT8_C(  72), -INT8_C(  73), -INT8_C(  82) },
+      { -INT8_C(  90),  INT8_C(  53), -INT8_C(  89), -INT8_C(  53), -INT8_C(  43), -INT8_C(  63), -INT8_C(  77),  INT8_C(  95),
+        -INT8_C(  58), -INT8_C(  41), -INT8_C(  95),  INT8_C(  54),  INT8_C( 108), -INT8_C(  46), -INT8_C(  21),  INT8_C( 123) } },
+    { {  INT8_C(  20), -INT8_C( 116), -INT8_C( 108), -INT8_C(  57), -INT8_C(  31), -INT8_C(  31), -INT8_C( 111), -INT8_C(  34),
+        -INT8_C(  21), -INT8_C(   3), -INT8_C(  79), -INT8_C(  42),  INT8_C( 120),  INT8_C(  82), -INT8_C(  27),  INT8_C(  31) },
+      UINT16_C(17427),
+      { -INT8_C(  27), -INT8_C(  22), -INT8_C(  26),  INT8_C(  28), -INT8_C(  21),  INT8_C(  95),  INT8_C(  56), -INT8_C(  98),
+        -INT8_C(  31),  INT8_C(  63), -INT8_C(  25), -INT8_C( 104), -INT8_C(  19), -INT8_C(   5),  INT8_C(  36), -INT8_C( 127) },
+      { -INT8_C(  27), -INT8_C(  22), -INT8_C( 108), -INT8_C(  57), -INT8_C(  26), -INT8_C(  31), -INT8_C( 111), -INT8_C(  34),
+        -INT8_C(  21), -INT8_C(   3),  INT8_C(  28), -INT8_C(  42),  INT8_C( 120),  INT8_C(  82), -INT8_C(  21),  INT8_C(  31) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi8(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i r = simde_mm_mask_expand_epi8(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m128i src = simde_test_x86_random_i8x16();
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m128i a = simde_test_x86_random_i8x16();
+    simde__m128i r = simde_mm_mask_expand_epi8(src, k, a);
+
+    simde_test_x86_write_i8x16(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_maskz_expand_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask16 k;
+    const int8_t a[16];
+    const int8_t r[16];
+  } test_vec[] = {
+    { UINT16_C( 1474),
+      {  INT8_C(  98),  INT8_C(  83), -INT8_C(  28),  INT8_C(  77),  INT8_C(  80), -INT8_C( 107),  INT8_C(  36), -INT8_C(  56),
+        -INT8_C(  25),  INT8_C(   9), -INT8_C(  25), -INT8_C(   5),  INT8_C(  78), -INT8_C(  51), -INT8_C(  27),  INT8_C(  52) },
+      {  INT8_C(   0),  INT8_C(  98),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  83), -INT8_C(  28),
+         INT8_C(  77),  INT8_C(   0),  INT8_C(  80),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(53481),
+      { -INT8_C( 109),  INT8_C(  33),  INT8_C( 111),  INT8_C( 116),  INT8_C(  96),  INT8_C(  86),  INT8_C(  12),  INT8_C(  77),
+         INT8_C(  81),  INT8_C(  49), -INT8_C(  50),  INT8_C(  19),  INT8_C(  54),  INT8_C(  48),  INT8_C( 102),  INT8_C(  26) },
+      { -INT8_C( 109),  INT8_C(   0),  INT8_C(   0),  INT8_C(  33),  INT8_C(   0),  INT8_C( 111),  INT8_C( 116),  INT8_C(  96),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  86),  INT8_C(   0),  INT8_C(  12),  INT8_C(  77) } },
+    { UINT16_C(46717),
+      { -INT8_C(  81), -INT8_C(  95),  INT8_C( 126), -INT8_C( 105), -INT8_C(  85),  INT8_C( 102), -INT8_C( 110), -INT8_C(   7),
+         INT8_C(  51),  INT8_C( 119),  INT8_C(  45),  INT8_C(  28),  INT8_C(  72), -INT8_C(  64),  INT8_C(  61), -INT8_C(  73) },
+      { -INT8_C(  81),  INT8_C(   0), -INT8_C(  95),  INT8_C( 126), -INT8_C( 105), -INT8_C(  85),  INT8_C( 102),  INT8_C(   0),
+         INT8_C(   0), -INT8_C( 110), -INT8_C(   7),  INT8_C(   0),  INT8_C(  51),  INT8_C( 119),  INT8_C(   0),  INT8_C(  45) } },
+    { UINT16_C(40245),
+      {  INT8_C(  13),  INT8_C(  65), -INT8_C(  22),  INT8_C(  94),  INT8_C( 114), -INT8_C(  72),  INT8_C( 113), -INT8_C(  87),
+        -INT8_C(  24), -INT8_C(  41), -INT8_C(  61),  INT8_C( 101), -INT8_C( 115),  INT8_C( 115),  INT8_C(   7),  INT8_C(  11) },
+      {  INT8_C(  13),  INT8_C(   0),  INT8_C(  65),  INT8_C(   0), -INT8_C(  22),  INT8_C(  94),  INT8_C(   0),  INT8_C(   0),
+         INT8_C( 114),  INT8_C(   0), -INT8_C(  72),  INT8_C( 113), -INT8_C(  87),  INT8_C(   0),  INT8_C(   0), -INT8_C(  24) } },
+    { UINT16_C(45578),
+      {  INT8_C( 113), -INT8_C( 100), -INT8_C(  85), -INT8_C(  92),  INT8_C(  19), -INT8_C(  40), -INT8_C(  64),  INT8_C(  91),
+        -INT8_C( 104), -INT8_C(   3),  INT8_C(  18), -INT8_C(  51), -INT8_C( 102),  INT8_C(  31),  INT8_C(  15), -INT8_C( 124) },
+      {  INT8_C(   0),  INT8_C( 113),  INT8_C(   0), -INT8_C( 100),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0), -INT8_C(  85),  INT8_C(   0),  INT8_C(   0), -INT8_C(  92),  INT8_C(  19),  INT8_C(   0), -INT8_C(  40) } },
+    { UINT16_C(33149),
+      {  INT8_C(  60), -INT8_C(  18),  INT8_C(  42),  INT8_C(  36), -INT8_C(  59), -INT8_C(  18), -INT8_C( 118),  INT8_C(  82),
+         INT8_C(  97), -INT8_C( 111),  INT8_C(  94),  INT8_C( 107),  INT8_C(  67), -INT8_C(  49),  INT8_C(   7), -INT8_C(  18) },
+      {  INT8_C(  60),  INT8_C(   0), -INT8_C(  18),  INT8_C(  42),  INT8_C(  36), -INT8_C(  59), -INT8_C(  18),  INT8_C(   0),
+        -INT8_C( 118),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  82) } },
+    { UINT16_C( 6772),
+      { -INT8_C(  58),  INT8_C(  52),  INT8_C( 118),  INT8_C(  94),  INT8_C(  50), -INT8_C( 120),  INT8_C(  44), -INT8_C(  52),
+        -INT8_C(  88),  INT8_C(  59),  INT8_C(  81),  INT8_C(  37), -INT8_C(  68), -INT8_C( 115),  INT8_C(  20), -INT8_C(  25) },
+      {  INT8_C(   0),  INT8_C(   0), -INT8_C(  58),  INT8_C(   0),  INT8_C(  52),  INT8_C( 118),  INT8_C(  94),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(  50),  INT8_C(   0), -INT8_C( 120),  INT8_C(  44),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(55730),
+      { -INT8_C(  43),  INT8_C(  60),  INT8_C(  44),  INT8_C(  54), -INT8_C(  51), -INT8_C( 118), -INT8_C(  95),  INT8_C(  16),
+         INT8_C(  89), -INT8_C(  88), -INT8_C(   2), -INT8_C(  51), -INT8_C(  62), -INT8_C(  60),  INT8_C(   2),  INT8_C(  56) },
+      {  INT8_C(   0), -INT8_C(  43),  INT8_C(   0),  INT8_C(   0),  INT8_C(  60),  INT8_C(  44),  INT8_C(   0),  INT8_C(  54),
+        -INT8_C(  51),  INT8_C(   0),  INT8_C(   0), -INT8_C( 118), -INT8_C(  95),  INT8_C(   0),  INT8_C(  16),  INT8_C(  89) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i r = simde_mm_maskz_expand_epi8(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m128i a = simde_test_x86_random_i8x16();
+    simde__m128i r = simde_mm_maskz_expand_epi8(k, a);
+
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i8x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_mask_expandloadu_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int8_t src[16];
+    const simde__mmask16 k;
+    const int8_t a[16];
+    const int8_t r[16];
+  } test_vec[] = {
+    { {  INT8_C(  34),  INT8_C(  52), -INT8_C(  63),  INT8_C(  78),  INT8_C(   0),  INT8_C( 105), -INT8_C( 119),  INT8_C(  81),
+        -INT8_C( 114),  INT8_C(  70), -INT8_C(  33), -INT8_C(  94),  INT8_C(  45), -INT8_C( 111),  INT8_C( 124),  INT8_C(   2) },
+      UINT16_C(43213),
+      {  INT8_C(  56), -INT8_C( 102),  INT8_C(  50), -INT8_C(  39), -INT8_C(  86), -INT8_C( 117), -INT8_C( 127), -INT8_C(  88),
+         INT8_C(  89),  INT8_C(  67),  INT8_C( 108),  INT8_C(  91),  INT8_C( 124), -INT8_C( 114), -INT8_C( 113),  INT8_C(  61) },
+      {  INT8_C(  56),  INT8_C(  52), -INT8_C( 102),  INT8_C(  50),  INT8_C(   0),  INT8_C( 105), -INT8_C(  39), -INT8_C(  86),
+        -INT8_C( 114),  INT8_C(  70), -INT8_C(  33), -INT8_C( 117),  INT8_C(  45), -INT8_C( 127),  INT8_C( 124), -INT8_C(  88) } },
+    { { -INT8_C(  35), -INT8_C( 113), -INT8_C(  90),  INT8_C( 102), -INT8_C(  31),  INT8_C(  52), -INT8_C(  84), -INT8_C(  64),
+        -INT8_C(  41), -INT8_C(  39),  INT8_C(  81),  INT8_C(  83), -INT8_C(  37),  INT8_C(  30), -INT8_C(   5),  INT8_C(  19) },
+      UINT16_C(11704),
+      { -INT8_C(  20),  INT8_C(  98), -INT8_C(  72),  INT8_C( 109),  INT8_C(  10),  INT8_C(  17), -INT8_C(  79),  INT8_C( 118),
+         INT8_C( 108),  INT8_C(  45),  INT8_C(   4), -INT8_C(   5),  INT8_C( 106), -INT8_C(  31), -INT8_C( 117),  INT8_C(  16) },
+      { -INT8_C(  35), -INT8_C( 113), -INT8_C(  90), -INT8_C(  20),  INT8_C(  98), -INT8_C(  72), -INT8_C(  84),  INT8_C( 109),
+         INT8_C(  10), -INT8_C(  39),  INT8_C(  17), -INT8_C(  79), -INT8_C(  37),  INT8_C( 118), -INT8_C(   5),  INT8_C(  19) } },
+    { {  INT8_C(  72),  INT8_C( 108),  INT8_C(  68), -INT8_C(  12),  INT8_C(  44),  INT8_C(  27), -INT8_C(  50),  INT8_C( 125),
+         INT8_C( 110), -INT8_C(  87), -INT8_C( 101),  INT8_C( 105), -INT8_C(  67),  INT8_C(  83), -INT8_C( 106), -INT8_C(  87) },
+      UINT16_C(20405),
+      {  INT8_C(  23), -INT8_C(  65),  INT8_C(  96), -INT8_C(  56),  INT8_C(  53), -INT8_C(  51), -INT8_C(  11),  INT8_C(  57),
+        -INT8_C(  56),  INT8_C(  95),  INT8_C(  27),  INT8_C(  83),  INT8_C( 111),  INT8_C(  99), -INT8_C(  65), -INT8_C(  77) },
+      {  INT8_C(  23),  INT8_C( 108), -INT8_C(  65), -INT8_C(  12),  INT8_C(  96), -INT8_C(  56), -INT8_C(  50),  INT8_C(  53),
+        -INT8_C(  51), -INT8_C(  11),  INT8_C(  57), -INT8_C(  56), -INT8_C(  67),  INT8_C(  83),  INT8_C(  95), -INT8_C(  87) } },
+    { {  INT8_C(  87), -INT8_C(  21), -INT8_C(  49),  INT8_C(  37),  INT8_C( 104),  INT8_C(  61), -INT8_C(  49),  INT8_C(   3),
+        -INT8_C(  89), -INT8_C( 116),  INT8_C(  86),  INT8_C(  61),  INT8_C(  53),  INT8_C(  11), -INT8_C( 116),  INT8_C(  76) },
+      UINT16_C(60874),
+      {  INT8_C(  20), -INT8_C(   1), -INT8_C(  70),  INT8_C(   9),  INT8_C(  57), -INT8_C( 126),  INT8_C( 104),  INT8_C(  84),
+        -INT8_C(  42), -INT8_C(  41), -INT8_C(  73), -INT8_C( 107), -INT8_C( 117),  INT8_C(  14), -INT8_C( 127),  INT8_C(  90) },
+      {  INT8_C(  87),  INT8_C(  20), -INT8_C(  49), -INT8_C(   1),  INT8_C( 104),  INT8_C(  61), -INT8_C(  70),  INT8_C(   9),
+         INT8_C(  57), -INT8_C( 116), -INT8_C( 126),  INT8_C( 104),  INT8_C(  53),  INT8_C(  84), -INT8_C(  42), -INT8_C(  41) } },
+    { {  INT8_C(  52), -INT8_C(  23), -INT8_C( 105),  INT8_C(   3), -INT8_C(  19),  INT8_C(  62), -INT8_C( 113),  INT8_C(  67),
+         INT8_C( 124), -INT8_C(  60),  INT8_C(  79),  INT8_C(   8),  INT8_C(  17),  INT8_C(  25), -INT8_C(  11),  INT8_C(  37) },
+      UINT16_C(44825),
+      {  INT8_C(  47),  INT8_C(  82),  INT8_C(  50), -INT8_C( 105), -INT8_C(  90),  INT8_C(   8),  INT8_C( 111),  INT8_C(  93),
+        -INT8_C(  99), -INT8_C(   6),  INT8_C( 107),  INT8_C(  30),  INT8_C(  84), -INT8_C(  97),  INT8_C(   8), -INT8_C(  21) },
+      {  INT8_C(  47), -INT8_C(  23), -INT8_C( 105),  INT8_C(  82),  INT8_C(  50),  INT8_C(  62), -INT8_C( 113),  INT8_C(  67),
+        -INT8_C( 105), -INT8_C(  90),  INT8_C(   8),  INT8_C( 111),  INT8_C(  17),  INT8_C(  93), -INT8_C(  11), -INT8_C(  99) } },
+    { { -INT8_C(  94), -INT8_C(  11),  INT8_C(  42),  INT8_C(  49),  INT8_C(  56), -INT8_C(  90), -INT8_C(  10), -INT8_C( 121),
+        -INT8_C(  82),  INT8_C(   7), -INT8_C(  95), -INT8_C(  92),  INT8_C(  44), -INT8_C(  70),  INT8_C(  83),  INT8_C(  91) },
+      UINT16_C(34060),
+      { -INT8_C(  13), -INT8_C(  78), -INT8_C( 115),  INT8_C(  98),  INT8_C(  15),  INT8_C(  43),  INT8_C(  92),  INT8_C( 122),
+         INT8_C(  73), -INT8_C(  80),  INT8_C(  26),  INT8_C(  81), -INT8_C( 101), -INT8_C(  68),  INT8_C(  70), -INT8_C(  59) },
+      { -INT8_C(  94), -INT8_C(  11), -INT8_C(  13), -INT8_C(  78),  INT8_C(  56), -INT8_C(  90), -INT8_C(  10), -INT8_C( 121),
+        -INT8_C( 115),  INT8_C(   7),  INT8_C(  98), -INT8_C(  92),  INT8_C(  44), -INT8_C(  70),  INT8_C(  83),  INT8_C(  15) } },
+    { { -INT8_C(  18),      INT8_MAX,  INT8_C( 107), -INT8_C(  28),  INT8_C(   6),  INT8_C(  26), -INT8_C(  21), -INT8_C(  89),
+        -INT8_C(  66),  INT8_C(  23),  INT8_C(  97),  INT8_C(  17),  INT8_C( 115),  INT8_C( 109), -INT8_C( 105),  INT8_C( 102) },
+      UINT16_C( 9247),
+      { -INT8_C(  56),  INT8_C(  46),  INT8_C(  79),  INT8_C(  36), -INT8_C(  87), -INT8_C( 103), -INT8_C(  44), -INT8_C(  61),
+        -INT8_C(  22),  INT8_C( 111),      INT8_MAX,  INT8_C(  49),  INT8_C(  53),  INT8_C( 109), -INT8_C(  80), -INT8_C(  96) },
+      { -INT8_C(  56),  INT8_C(  46),  INT8_C(  79),  INT8_C(  36), -INT8_C(  87),  INT8_C(  26), -INT8_C(  21), -INT8_C(  89),
+        -INT8_C(  66),  INT8_C(  23), -INT8_C( 103),  INT8_C(  17),  INT8_C( 115), -INT8_C(  44), -INT8_C( 105),  INT8_C( 102) } },
+    { {  INT8_C(  81), -INT8_C(  74), -INT8_C(  70),  INT8_C(  60),  INT8_C(  94),  INT8_C( 120),  INT8_C(  84), -INT8_C(  65),
+        -INT8_C( 118), -INT8_C(  57),  INT8_C(  45),  INT8_C(  33),  INT8_C(  45),  INT8_C(  76),  INT8_C(  69), -INT8_C(  11) },
+      UINT16_C(38267),
+      {  INT8_C(  25),  INT8_C(  36),  INT8_C(  46), -INT8_C(  19), -INT8_C(  25),  INT8_C(  24),  INT8_C(  92),  INT8_C( 102),
+         INT8_C(  73), -INT8_C( 111), -INT8_C(  44), -INT8_C(   7),  INT8_C(  50),  INT8_C(  37), -INT8_C(  80), -INT8_C(  20) },
+      {  INT8_C(  25),  INT8_C(  36), -INT8_C(  70),  INT8_C(  46), -INT8_C(  19), -INT8_C(  25),  INT8_C(  24), -INT8_C(  65),
+         INT8_C(  92), -INT8_C(  57),  INT8_C( 102),  INT8_C(  33),  INT8_C(  73),  INT8_C(  76),  INT8_C(  69), -INT8_C( 111) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi8(test_vec[i].src);
+    simde__m128i r = simde_mm_mask_expandloadu_epi8(src, test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m128i src = simde_test_x86_random_i8x16();
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m128i a = simde_test_x86_random_i8x16();
+    simde__m128i r = simde_mm_mask_expandloadu_epi8(src, k, &a);
+
+    simde_test_x86_write_i8x16(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_maskz_expandloadu_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask16 k;
+    const int8_t a[16];
+    const int8_t r[16];
+  } test_vec[] = {
+    { UINT16_C( 3682),
+      {  INT8_C( 101), -INT8_C(  74), -INT8_C(  51), -INT8_C(  17),  INT8_C( 125), -INT8_C(   6),  INT8_C(  16), -INT8_C(  86),
+         INT8_C(  71),  INT8_C(  85), -INT8_C(  97), -INT8_C(  62), -INT8_C(  22), -INT8_C(  72), -INT8_C(  26),  INT8_C(  24) },
+      {  INT8_C(   0),  INT8_C( 101),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  74), -INT8_C(  51),  INT8_C(   0),
+         INT8_C(   0), -INT8_C(  17),  INT8_C( 125), -INT8_C(   6),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(52645),
+      {  INT8_C(  49),  INT8_C(   1),  INT8_C(  51),  INT8_C( 122), -INT8_C( 109),  INT8_C(   7),  INT8_C( 116), -INT8_C(  59),
+         INT8_C(  45),  INT8_C(  36), -INT8_C(  79), -INT8_C( 113),  INT8_C(  50),  INT8_C(  22),  INT8_C(  69), -INT8_C(   1) },
+      {  INT8_C(  49),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(  51),  INT8_C(   0),  INT8_C( 122),
+        -INT8_C( 109),  INT8_C(   0),  INT8_C(   7),  INT8_C( 116),  INT8_C(   0),  INT8_C(   0), -INT8_C(  59),  INT8_C(  45) } },
+    { UINT16_C(49669),
+      { -INT8_C(   6),  INT8_C(  21),  INT8_C( 108),  INT8_C(  65),  INT8_C( 107),  INT8_C(  11),  INT8_C(   3),  INT8_C(  85),
+        -INT8_C(  61), -INT8_C(  23),  INT8_C( 110),  INT8_C( 104), -INT8_C(  74), -INT8_C(  97),  INT8_C( 105), -INT8_C(  23) },
+      { -INT8_C(   6),  INT8_C(   0),  INT8_C(  21),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C( 108),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  65),  INT8_C( 107) } },
+    { UINT16_C(64537),
+      { -INT8_C(  15), -INT8_C( 115), -INT8_C(  63),  INT8_C(  30), -INT8_C(  79),  INT8_C( 115), -INT8_C(  83), -INT8_C(  29),
+        -INT8_C( 119), -INT8_C(  14), -INT8_C(  29), -INT8_C( 113), -INT8_C(  76), -INT8_C(  35), -INT8_C(  92),  INT8_C(  32) },
+      { -INT8_C(  15),  INT8_C(   0),  INT8_C(   0), -INT8_C( 115), -INT8_C(  63),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(  30), -INT8_C(  79),  INT8_C( 115), -INT8_C(  83), -INT8_C(  29), -INT8_C( 119) } },
+    { UINT16_C( 3870),
+      {  INT8_C(  43),  INT8_C(  33),  INT8_C( 101), -INT8_C(  18),  INT8_C(  10), -INT8_C(  45),  INT8_C(  86), -INT8_C(  64),
+         INT8_C( 114), -INT8_C(  65), -INT8_C(  87), -INT8_C( 117), -INT8_C(  68), -INT8_C( 102),  INT8_C(  25),  INT8_C( 125) },
+      {  INT8_C(   0),  INT8_C(  43),  INT8_C(  33),  INT8_C( 101), -INT8_C(  18),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  10), -INT8_C(  45),  INT8_C(  86), -INT8_C(  64),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(51896),
+      { -INT8_C(  16),  INT8_C( 101), -INT8_C(  82),  INT8_C( 122),  INT8_C(  87), -INT8_C( 111),  INT8_C(   9),  INT8_C(  11),
+         INT8_C( 110), -INT8_C(  83),  INT8_C(  43), -INT8_C( 116), -INT8_C(  67),  INT8_C(  86), -INT8_C(  83),  INT8_C(  34) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  16),  INT8_C( 101), -INT8_C(  82),  INT8_C(   0),  INT8_C( 122),
+         INT8_C(   0),  INT8_C(  87),  INT8_C(   0), -INT8_C( 111),  INT8_C(   0),  INT8_C(   0),  INT8_C(   9),  INT8_C(  11) } },
+    { UINT16_C(46916),
+      { -INT8_C(  11), -INT8_C( 102),  INT8_C( 119),  INT8_C( 103),  INT8_C(  90),  INT8_C(  32), -INT8_C(  14),  INT8_C(  22),
+        -INT8_C(  69),  INT8_C(  11), -INT8_C( 109),  INT8_C( 115), -INT8_C(  42), -INT8_C( 124), -INT8_C(  39), -INT8_C( 124) },
+      {  INT8_C(   0),  INT8_C(   0), -INT8_C(  11),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 102),  INT8_C(   0),
+         INT8_C( 119),  INT8_C( 103),  INT8_C(  90),  INT8_C(   0),  INT8_C(  32), -INT8_C(  14),  INT8_C(   0),  INT8_C(  22) } },
+    { UINT16_C(12542),
+      {  INT8_C(  21),  INT8_C(   7),  INT8_C(  60), -INT8_C( 125), -INT8_C(  76),  INT8_C( 103),  INT8_C(  15),  INT8_C( 113),
+        -INT8_C(  66), -INT8_C(  68), -INT8_C( 109),  INT8_C(   2),  INT8_C( 115), -INT8_C( 120), -INT8_C(  99), -INT8_C(  22) },
+      {  INT8_C(   0),  INT8_C(  21),  INT8_C(   7),  INT8_C(  60), -INT8_C( 125), -INT8_C(  76),  INT8_C( 103),  INT8_C(  15),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 113), -INT8_C(  66),  INT8_C(   0),  INT8_C(   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i r = simde_mm_maskz_expandloadu_epi8(test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m128i a = simde_test_x86_random_i8x16();
+    simde__m128i r = simde_mm_maskz_expandloadu_epi8(k, &a);
+
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i8x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_mask_expand_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int16_t src[8];
+    const simde__mmask8 k;
+    const int16_t a[8];
+    const int16_t r[8];
+  } test_vec[] = {
+    { { -INT16_C(  2065), -INT16_C(  7670), -INT16_C( 15091), -INT16_C( 24339), -INT16_C( 15559),  INT16_C(  4644),  INT16_C(  8775),  INT16_C( 23618) },
+      UINT8_C( 41),
+      { -INT16_C(  8322), -INT16_C(  6434),  INT16_C( 20462), -INT16_C( 21852), -INT16_C( 22813),  INT16_C( 27421),  INT16_C(  1859),  INT16_C( 14939) },
+      { -INT16_C(  8322), -INT16_C(  7670), -INT16_C( 15091), -INT16_C(  6434), -INT16_C( 15559),  INT16_C( 20462),  INT16_C(  8775),  INT16_C( 23618) } },
+    { {  INT16_C( 15634), -INT16_C( 10425), -INT16_C(  6102), -INT16_C(  4592),  INT16_C(  8716),  INT16_C( 12085), -INT16_C( 28059), -INT16_C(  7336) },
+      UINT8_C(113),
+      { -INT16_C( 14026), -INT16_C( 31136),  INT16_C(  2669),  INT16_C(  5225), -INT16_C( 11224),  INT16_C( 12119), -INT16_C( 28113),  INT16_C( 27713) },
+      { -INT16_C( 14026), -INT16_C( 10425), -INT16_C(  6102), -INT16_C(  4592), -INT16_C( 31136),  INT16_C(  2669),  INT16_C(  5225), -INT16_C(  7336) } },
+    { {  INT16_C(  6617), -INT16_C( 15977), -INT16_C( 31447),  INT16_C( 19662), -INT16_C(   582),  INT16_C( 19633), -INT16_C( 27563), -INT16_C( 29506) },
+      UINT8_C( 94),
+      {  INT16_C(  4638),  INT16_C( 10443), -INT16_C(  8325),  INT16_C( 20304), -INT16_C( 32713), -INT16_C( 13953), -INT16_C(  5183), -INT16_C(  9566) },
+      {  INT16_C(  6617),  INT16_C(  4638),  INT16_C( 10443), -INT16_C(  8325),  INT16_C( 20304),  INT16_C( 19633), -INT16_C( 32713), -INT16_C( 29506) } },
+    { {  INT16_C( 25730),  INT16_C(  1796),  INT16_C( 20530),  INT16_C( 12226),  INT16_C(  3585), -INT16_C( 27260),  INT16_C(  4300), -INT16_C(  5389) },
+      UINT8_C( 34),
+      {  INT16_C(  5055), -INT16_C( 24931), -INT16_C(  4765), -INT16_C(  7211), -INT16_C( 24980),  INT16_C( 22437),  INT16_C( 32577), -INT16_C( 23078) },
+      {  INT16_C( 25730),  INT16_C(  5055),  INT16_C( 20530),  INT16_C( 12226),  INT16_C(  3585), -INT16_C( 24931),  INT16_C(  4300), -INT16_C(  5389) } },
+    { { -INT16_C(  7805), -INT16_C( 11305),  INT16_C(  1699), -INT16_C( 19756),  INT16_C( 27274), -INT16_C( 25730),  INT16_C( 26973),  INT16_C(  7357) },
+      UINT8_C(124),
+      { -INT16_C( 17573),  INT16_C( 18655), -INT16_C( 15472),  INT16_C( 12212),  INT16_C(  2920), -INT16_C(  6288),  INT16_C(  5605), -INT16_C( 14485) },
+      { -INT16_C(  7805), -INT16_C( 11305), -INT16_C( 17573),  INT16_C( 18655), -INT16_C( 15472),  INT16_C( 12212),  INT16_C(  2920),  INT16_C(  7357) } },
+    { {  INT16_C( 16108), -INT16_C(  3478),  INT16_C(  7187),  INT16_C( 32124),  INT16_C(  6043),  INT16_C(  1242), -INT16_C(  2091),  INT16_C( 12416) },
+      UINT8_C(178),
+      {  INT16_C( 30815),  INT16_C(  8770),  INT16_C( 28972),  INT16_C( 14218),  INT16_C( 29409), -INT16_C(  2531), -INT16_C(  6947),  INT16_C(  7138) },
+      {  INT16_C( 16108),  INT16_C( 30815),  INT16_C(  7187),  INT16_C( 32124),  INT16_C(  8770),  INT16_C( 28972), -INT16_C(  2091),  INT16_C( 14218) } },
+    { { -INT16_C( 11186),  INT16_C( 27438), -INT16_C( 21679),  INT16_C( 26630),  INT16_C(  2694),  INT16_C( 32061),  INT16_C( 28042), -INT16_C(  5841) },
+      UINT8_C(229),
+      {  INT16_C(  3185), -INT16_C(  7407),  INT16_C( 18838),  INT16_C(  2244), -INT16_C( 17562),  INT16_C( 19173),  INT16_C(   413),  INT16_C( 29336) },
+      {  INT16_C(  3185),  INT16_C( 27438), -INT16_C(  7407),  INT16_C( 26630),  INT16_C(  2694),  INT16_C( 18838),  INT16_C(  2244), -INT16_C( 17562) } },
+    { {  INT16_C(   815), -INT16_C(  9277),  INT16_C( 11017),  INT16_C(  4961), -INT16_C(  8599), -INT16_C( 10595), -INT16_C( 30963),  INT16_C( 32444) },
+      UINT8_C(147),
+      {  INT16_C( 25037),  INT16_C(  5673),  INT16_C( 12838), -INT16_C(  7812), -INT16_C( 14825),  INT16_C(  6270), -INT16_C(  4001),  INT16_C( 25160) },
+      {  INT16_C( 25037),  INT16_C(  5673),  INT16_C( 11017),  INT16_C(  4961),  INT16_C( 12838), -INT16_C( 10595), -INT16_C( 30963), -INT16_C(  7812) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi16(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i r = simde_mm_mask_expand_epi16(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m128i src = simde_test_x86_random_i16x8();
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128i a = simde_test_x86_random_i16x8();
+    simde__m128i r = simde_mm_mask_expand_epi16(src, k, a);
+
+    simde_test_x86_write_i16x8(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i16x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i16x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_maskz_expand_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const int16_t a[8];
+    const int16_t r[8];
+  } test_vec[] = {
+    { UINT8_C(179),
+      {  INT16_C( 27683), -INT16_C( 31521),  INT16_C( 18559),  INT16_C(  7522),  INT16_C( 28446), -INT16_C(  9564),  INT16_C( 14317),  INT16_C( 20392) },
+      {  INT16_C( 27683), -INT16_C( 31521),  INT16_C(     0),  INT16_C(     0),  INT16_C( 18559),  INT16_C(  7522),  INT16_C(     0),  INT16_C( 28446) } },
+    { UINT8_C( 96),
+      {  INT16_C( 30142),  INT16_C( 15250), -INT16_C( 21930), -INT16_C( 11263),  INT16_C( 24770),  INT16_C(  2757),  INT16_C( 30915),  INT16_C( 12077) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 30142),  INT16_C( 15250),  INT16_C(     0) } },
+    { UINT8_C( 87),
+      { -INT16_C( 20815),  INT16_C(  5023), -INT16_C( 16693),  INT16_C( 28546),  INT16_C( 28824),  INT16_C( 16550),  INT16_C(  1983),  INT16_C( 13567) },
+      { -INT16_C( 20815),  INT16_C(  5023), -INT16_C( 16693),  INT16_C(     0),  INT16_C( 28546),  INT16_C(     0),  INT16_C( 28824),  INT16_C(     0) } },
+    { UINT8_C(153),
+      { -INT16_C( 30150),  INT16_C( 15171),  INT16_C(  1630),  INT16_C(  9116),  INT16_C( 24336),  INT16_C( 16028), -INT16_C(  3186),  INT16_C( 15599) },
+      { -INT16_C( 30150),  INT16_C(     0),  INT16_C(     0),  INT16_C( 15171),  INT16_C(  1630),  INT16_C(     0),  INT16_C(     0),  INT16_C(  9116) } },
+    { UINT8_C(147),
+      {  INT16_C(  2051), -INT16_C( 31407), -INT16_C(  5769),  INT16_C(  7925), -INT16_C( 19414),  INT16_C( 10533), -INT16_C( 16664),  INT16_C( 29283) },
+      {  INT16_C(  2051), -INT16_C( 31407),  INT16_C(     0),  INT16_C(     0), -INT16_C(  5769),  INT16_C(     0),  INT16_C(     0),  INT16_C(  7925) } },
+    { UINT8_C(  2),
+      { -INT16_C( 11874),  INT16_C( 14856),  INT16_C(  6388), -INT16_C( 28519),  INT16_C( 10070),  INT16_C( 18052),  INT16_C(  5988),  INT16_C( 27721) },
+      {  INT16_C(     0), -INT16_C( 11874),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(104),
+      { -INT16_C(  7218), -INT16_C( 15279),  INT16_C( 31489),  INT16_C(  9848),  INT16_C( 24996),  INT16_C(  2021), -INT16_C(  6189), -INT16_C( 23386) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  7218),  INT16_C(     0), -INT16_C( 15279),  INT16_C( 31489),  INT16_C(     0) } },
+    { UINT8_C(239),
+      { -INT16_C( 26144),  INT16_C( 31239),  INT16_C( 24105), -INT16_C( 21087),  INT16_C(  1444), -INT16_C(  4668),  INT16_C( 11377),  INT16_C( 21947) },
+      { -INT16_C( 26144),  INT16_C( 31239),  INT16_C( 24105), -INT16_C( 21087),  INT16_C(     0),  INT16_C(  1444), -INT16_C(  4668),  INT16_C( 11377) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i r = simde_mm_maskz_expand_epi16(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128i a = simde_test_x86_random_i16x8();
+    simde__m128i r = simde_mm_maskz_expand_epi16(k, a);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i16x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i16x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_mask_expandloadu_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int16_t src[8];
+    const simde__mmask8 k;
+    const int16_t a[8];
+    const int16_t r[8];
+  } test_vec[] = {
+    { {  INT16_C( 32638), -INT16_C(  1706),  INT16_C( 32248),  INT16_C( 22942), -INT16_C( 23198),  INT16_C( 18732), -INT16_C( 11957),  INT16_C( 11320) },
+      UINT8_C(106),
+      { -INT16_C( 22977), -INT16_C( 25197),  INT16_C( 16711),  INT16_C( 19777),  INT16_C( 11781),  INT16_C( 12990),  INT16_C(  5098),  INT16_C( 27056) },
+      {  INT16_C( 32638), -INT16_C( 22977),  INT16_C( 32248), -INT16_C( 25197), -INT16_C( 23198),  INT16_C( 16711),  INT16_C( 19777),  INT16_C( 11320) } },
+    { { -INT16_C( 22166), -INT16_C(  6303), -INT16_C( 17849), -INT16_C(  4791), -INT16_C( 27929), -INT16_C( 18376),  INT16_C( 25802),  INT16_C(  2338) },
+      UINT8_C( 10),
+      { -INT16_C( 22603), -INT16_C(  2478), -INT16_C( 24600),  INT16_C(  6140),  INT16_C( 11869),  INT16_C( 28929),  INT16_C( 27358), -INT16_C( 30757) },
+      { -INT16_C( 22166), -INT16_C( 22603), -INT16_C( 17849), -INT16_C(  2478), -INT16_C( 27929), -INT16_C( 18376),  INT16_C( 25802),  INT16_C(  2338) } },
+    { { -INT16_C( 15668), -INT16_C( 31025), -INT16_C( 17397), -INT16_C( 25235),  INT16_C(  9716),  INT16_C( 22887),  INT16_C( 28743), -INT16_C(   669) },
+      UINT8_C( 23),
+      { -INT16_C(  3147),  INT16_C( 21504),  INT16_C(  6127),  INT16_C(  7602),  INT16_C(  8984), -INT16_C( 32005), -INT16_C( 31746), -INT16_C( 16306) },
+      { -INT16_C(  3147),  INT16_C( 21504),  INT16_C(  6127), -INT16_C( 25235),  INT16_C(  7602),  INT16_C( 22887),  INT16_C( 28743), -INT16_C(   669) } },
+    { { -INT16_C( 10926),  INT16_C(  3787),  INT16_C( 26690),  INT16_C( 26626),  INT16_C( 23503),  INT16_C( 16303), -INT16_C( 21313),  INT16_C( 29783) },
+      UINT8_C(160),
+      { -INT16_C( 13993),  INT16_C( 28303), -INT16_C( 21125), -INT16_C( 24954),  INT16_C(  2216),  INT16_C( 11164),  INT16_C( 23639),  INT16_C( 11389) },
+      { -INT16_C( 10926),  INT16_C(  3787),  INT16_C( 26690),  INT16_C( 26626),  INT16_C( 23503), -INT16_C( 13993), -INT16_C( 21313),  INT16_C( 28303) } },
+    { { -INT16_C( 29913), -INT16_C( 28818), -INT16_C( 10610), -INT16_C(  5794), -INT16_C( 25210),  INT16_C( 12968),  INT16_C(  7668),  INT16_C( 19410) },
+      UINT8_C(230),
+      { -INT16_C( 18078),  INT16_C(  3937), -INT16_C(   193),  INT16_C( 18615), -INT16_C(  7269), -INT16_C(  2145), -INT16_C( 13472), -INT16_C(  5090) },
+      { -INT16_C( 29913), -INT16_C( 18078),  INT16_C(  3937), -INT16_C(  5794), -INT16_C( 25210), -INT16_C(   193),  INT16_C( 18615), -INT16_C(  7269) } },
+    { { -INT16_C( 21191),  INT16_C(  4218),  INT16_C( 25355), -INT16_C( 22378), -INT16_C( 14324),  INT16_C( 10653), -INT16_C(  5989), -INT16_C(   753) },
+      UINT8_C(162),
+      {  INT16_C(  3184),  INT16_C( 28641),  INT16_C( 10691), -INT16_C( 23030),  INT16_C(   456), -INT16_C( 27897), -INT16_C(  3297), -INT16_C( 13107) },
+      { -INT16_C( 21191),  INT16_C(  3184),  INT16_C( 25355), -INT16_C( 22378), -INT16_C( 14324),  INT16_C( 28641), -INT16_C(  5989),  INT16_C( 10691) } },
+    { { -INT16_C(  8851), -INT16_C( 12073),  INT16_C( 32627),  INT16_C( 15324),  INT16_C(  1308),  INT16_C(  1494), -INT16_C( 11500), -INT16_C( 31577) },
+      UINT8_C(223),
+      { -INT16_C(  3192), -INT16_C( 19805),  INT16_C( 18941), -INT16_C(   390),  INT16_C(  3664),  INT16_C( 17181), -INT16_C(  5669), -INT16_C( 18256) },
+      { -INT16_C(  3192), -INT16_C( 19805),  INT16_C( 18941), -INT16_C(   390),  INT16_C(  3664),  INT16_C(  1494),  INT16_C( 17181), -INT16_C(  5669) } },
+    { { -INT16_C( 32320),  INT16_C( 16427),  INT16_C( 26205),  INT16_C( 25436),  INT16_C( 24893),  INT16_C(  4215), -INT16_C(  1016), -INT16_C( 28176) },
+      UINT8_C(239),
+      {  INT16_C( 17299), -INT16_C(  8979), -INT16_C(  5187), -INT16_C( 13523),  INT16_C( 28681), -INT16_C(  3418),  INT16_C( 24097), -INT16_C( 23885) },
+      {  INT16_C( 17299), -INT16_C(  8979), -INT16_C(  5187), -INT16_C( 13523),  INT16_C( 24893),  INT16_C( 28681), -INT16_C(  3418),  INT16_C( 24097) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi16(test_vec[i].src);
+    simde__m128i r = simde_mm_mask_expandloadu_epi16(src, test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m128i src = simde_test_x86_random_i16x8();
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128i a = simde_test_x86_random_i16x8();
+    simde__m128i r = simde_mm_mask_expandloadu_epi16(src, k, &a);
+
+    simde_test_x86_write_i16x8(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i16x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i16x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_maskz_expandloadu_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const int16_t a[8];
+    const int16_t r[8];
+  } test_vec[] = {
+    { UINT8_C(137),
+      { -INT16_C(    13),  INT16_C( 20464),  INT16_C( 11618), -INT16_C(  9551), -INT16_C( 18115),  INT16_C( 11734), -INT16_C( 15030), -INT16_C( 29248) },
+      { -INT16_C(    13),  INT16_C(     0),  INT16_C(     0),  INT16_C( 20464),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 11618) } },
+    { UINT8_C(178),
+      {  INT16_C( 19357), -INT16_C( 13666), -INT16_C( 22762), -INT16_C( 17094),  INT16_C( 23449),  INT16_C( 19483), -INT16_C( 23043), -INT16_C(   705) },
+      {  INT16_C(     0),  INT16_C( 19357),  INT16_C(     0),  INT16_C(     0), -INT16_C( 13666), -INT16_C( 22762),  INT16_C(     0), -INT16_C( 17094) } },
+    { UINT8_C(149),
+      {  INT16_C( 24463),  INT16_C( 16578), -INT16_C(   199),  INT16_C(  4089),  INT16_C( 17453), -INT16_C(  4651), -INT16_C( 30767),  INT16_C(  7306) },
+      {  INT16_C( 24463),  INT16_C(     0),  INT16_C( 16578),  INT16_C(     0), -INT16_C(   199),  INT16_C(     0),  INT16_C(     0),  INT16_C(  4089) } },
+    { UINT8_C( 37),
+      {  INT16_C( 13140), -INT16_C( 28724),  INT16_C( 26352),  INT16_C(  3050), -INT16_C(  5966), -INT16_C(  3408),  INT16_C( 17893),  INT16_C( 17537) },
+      {  INT16_C( 13140),  INT16_C(     0), -INT16_C( 28724),  INT16_C(     0),  INT16_C(     0),  INT16_C( 26352),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(  7),
+      {  INT16_C( 32449), -INT16_C( 17913),  INT16_C( 13453),  INT16_C( 25342), -INT16_C( 12255), -INT16_C( 21270),  INT16_C(  4076),  INT16_C(  7936) },
+      {  INT16_C( 32449), -INT16_C( 17913),  INT16_C( 13453),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(220),
+      {  INT16_C(  3983),  INT16_C( 31298), -INT16_C(  3045), -INT16_C( 13470),  INT16_C( 18406),  INT16_C( 26385),  INT16_C(  6283),  INT16_C(  2344) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(  3983),  INT16_C( 31298), -INT16_C(  3045),  INT16_C(     0), -INT16_C( 13470),  INT16_C( 18406) } },
+    { UINT8_C( 31),
+      { -INT16_C( 26653), -INT16_C(  7853),  INT16_C( 30201), -INT16_C(  7247), -INT16_C( 25055),  INT16_C(  8691), -INT16_C( 12355), -INT16_C( 12879) },
+      { -INT16_C( 26653), -INT16_C(  7853),  INT16_C( 30201), -INT16_C(  7247), -INT16_C( 25055),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C( 17),
+      { -INT16_C(  6101), -INT16_C( 29435), -INT16_C(  4941), -INT16_C( 15148),  INT16_C( 24403),  INT16_C( 31965), -INT16_C(   919),  INT16_C(    95) },
+      { -INT16_C(  6101),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 29435),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i r = simde_mm_maskz_expandloadu_epi16(test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128i a = simde_test_x86_random_i16x8();
+    simde__m128i r = simde_mm_maskz_expandloadu_epi16(k, &a);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i16x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i16x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_mask_expand_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int8_t src[32];
+    const simde__mmask32 k;
+    const int8_t a[32];
+    const int8_t r[32];
+  } test_vec[] = {
+    { {  INT8_C(  80),  INT8_C(  64), -INT8_C(   7), -INT8_C(  59), -INT8_C(  14), -INT8_C(  35), -INT8_C(  26), -INT8_C( 112),
+        -INT8_C(  48),  INT8_C(   7),  INT8_C(  77), -INT8_C(  97), -INT8_C(  72),  INT8_C(  26), -INT8_C(  80), -INT8_C(  29),
+         INT8_C(   2), -INT8_C(  75),  INT8_C( 112), -INT8_C(  74), -INT8_C(  95),  INT8_C(  68),  INT8_C( 122), -INT8_C(  11),
+        -INT8_C(  92),  INT8_C(  87),  INT8_C( 113),  INT8_C(  13),  INT8_C(  84), -INT8_C(  48),  INT8_C(  13), -INT8_C(  92) },
+      UINT32_C(  40437264),
+      { -INT8_C(  29),  INT8_C(  79), -INT8_C( 110), -INT8_C(  77),  INT8_C(  86), -INT8_C(  32),  INT8_C(  82),  INT8_C(  15),
+        -INT8_C(   6),  INT8_C(   2), -INT8_C(  14), -INT8_C(   3), -INT8_C(  72),  INT8_C(  99), -INT8_C(  77),  INT8_C(  89),
+        -INT8_C(  89),  INT8_C(  45),  INT8_C(  78),  INT8_C(  75), -INT8_C( 123), -INT8_C(  65),  INT8_C(  88), -INT8_C(  39),
+        -INT8_C( 113),  INT8_C( 101),  INT8_C( 125), -INT8_C(  96),  INT8_C( 108), -INT8_C(  26), -INT8_C(  94),  INT8_C(  79) },
+      {  INT8_C(  80),  INT8_C(  64), -INT8_C(   7), -INT8_C(  59), -INT8_C(  29), -INT8_C(  35), -INT8_C(  26), -INT8_C( 112),
+        -INT8_C(  48),  INT8_C(  79), -INT8_C( 110), -INT8_C(  97), -INT8_C(  72),  INT8_C(  26), -INT8_C(  80), -INT8_C(  29),
+        -INT8_C(  77), -INT8_C(  75),  INT8_C( 112),  INT8_C(  86), -INT8_C(  95), -INT8_C(  32),  INT8_C(  82), -INT8_C(  11),
+        -INT8_C(  92),  INT8_C(  15),  INT8_C( 113),  INT8_C(  13),  INT8_C(  84), -INT8_C(  48),  INT8_C(  13), -INT8_C(  92) } },
+    { {  INT8_C(  53),  INT8_C(  53),  INT8_C(   3), -INT8_C( 117),  INT8_C(  21),  INT8_C(  85), -INT8_C( 102),  INT8_C(  15),
+         INT8_C(  88), -INT8_C( 115),  INT8_C(  12),  INT8_C(  16), -INT8_C(  16), -INT8_C(  65),  INT8_C( 105), -INT8_C( 105),
+        -INT8_C(  19), -INT8_C(  72), -INT8_C(  29),  INT8_C( 114),  INT8_C( 119),  INT8_C(  59),  INT8_C(  75),  INT8_C(   7),
+        -INT8_C(  95), -INT8_C(  56), -INT8_C(  89),  INT8_C(  13), -INT8_C(  82),  INT8_C(  73),  INT8_C(  92), -INT8_C(  29) },
+      UINT32_C(2473484158),
+      { -INT8_C(  75),  INT8_C(   9), -INT8_C(  93),  INT8_C(  13), -INT8_C( 106), -INT8_C(  81),  INT8_C(  29), -INT8_C( 122),
+         INT8_C( 111), -INT8_C( 122),  INT8_C(  29),  INT8_C(  92),  INT8_C(  62),  INT8_C(   0), -INT8_C(  50), -INT8_C(  74),
+         INT8_C(  60),  INT8_C(  25), -INT8_C(  67), -INT8_C(  35), -INT8_C(  31),  INT8_C( 100), -INT8_C(  22), -INT8_C( 113),
+        -INT8_C(  83),  INT8_C(  70),  INT8_C( 114),  INT8_C(  44), -INT8_C(  90), -INT8_C(  32), -INT8_C(  65),  INT8_C(  91) },
+      {  INT8_C(  53), -INT8_C(  75),  INT8_C(   9), -INT8_C(  93),  INT8_C(  13), -INT8_C( 106), -INT8_C(  81),  INT8_C(  15),
+         INT8_C(  29), -INT8_C( 122),  INT8_C( 111), -INT8_C( 122),  INT8_C(  29), -INT8_C(  65),  INT8_C(  92), -INT8_C( 105),
+        -INT8_C(  19),  INT8_C(  62),  INT8_C(   0), -INT8_C(  50),  INT8_C( 119), -INT8_C(  74),  INT8_C(  60),  INT8_C(   7),
+         INT8_C(  25), -INT8_C(  67), -INT8_C(  89),  INT8_C(  13), -INT8_C(  35),  INT8_C(  73),  INT8_C(  92), -INT8_C(  31) } },
+    { { -INT8_C(  23),  INT8_C(  98),  INT8_C( 104),      INT8_MAX,  INT8_C(  18), -INT8_C( 123),  INT8_C(   5), -INT8_C( 127),
+         INT8_C(  11),  INT8_C(  35), -INT8_C(  35),  INT8_C(  74),  INT8_C(  35), -INT8_C(  85),  INT8_C(   0),  INT8_C(  95),
+        -INT8_C(  60), -INT8_C(  67),  INT8_C(  60), -INT8_C(  91),  INT8_C(  33),  INT8_C(  38),  INT8_C(  52), -INT8_C(  50),
+         INT8_C( 109), -INT8_C(  90), -INT8_C(   6),  INT8_C(  19), -INT8_C( 122), -INT8_C(  70),  INT8_C( 110),  INT8_C( 112) },
+      UINT32_C( 787469852),
+      {  INT8_C(  91), -INT8_C(  11), -INT8_C(  81),  INT8_C( 102),  INT8_C(  24), -INT8_C( 116), -INT8_C(  80),  INT8_C(  59),
+         INT8_C(  55), -INT8_C(  80), -INT8_C( 101), -INT8_C(   5),  INT8_C( 109), -INT8_C(  41), -INT8_C(  96), -INT8_C( 114),
+        -INT8_C(   2), -INT8_C(  44),  INT8_C(  93),  INT8_C( 107),  INT8_C( 122),  INT8_C(  87),  INT8_C( 126),  INT8_C(   1),
+         INT8_C(  17), -INT8_C(  20),  INT8_C( 113),  INT8_C(  46), -INT8_C(  62),  INT8_C(  96),  INT8_C(  92),  INT8_C(  29) },
+      { -INT8_C(  23),  INT8_C(  98),  INT8_C(  91), -INT8_C(  11), -INT8_C(  81), -INT8_C( 123),  INT8_C(   5), -INT8_C( 127),
+         INT8_C(  11),  INT8_C( 102),  INT8_C(  24),  INT8_C(  74), -INT8_C( 116), -INT8_C(  85), -INT8_C(  80),  INT8_C(  59),
+         INT8_C(  55), -INT8_C(  80), -INT8_C( 101), -INT8_C(   5),  INT8_C(  33),  INT8_C( 109), -INT8_C(  41), -INT8_C(  96),
+         INT8_C( 109), -INT8_C( 114), -INT8_C(   2), -INT8_C(  44), -INT8_C( 122),  INT8_C(  93),  INT8_C( 110),  INT8_C( 112) } },
+    { {  INT8_C(  85),  INT8_C(  12), -INT8_C( 125),  INT8_C( 109), -INT8_C( 104),  INT8_C(  52), -INT8_C(  87), -INT8_C(  48),
+        -INT8_C(  28),  INT8_C(  68), -INT8_C(  53),  INT8_C(  82),  INT8_C(  27),  INT8_C( 108), -INT8_C(  32),  INT8_C(  25),
+         INT8_C(  64),  INT8_C(  61), -INT8_C( 124), -INT8_C(  69), -INT8_C( 107),  INT8_C(   2), -INT8_C(  68), -INT8_C(  90),
+        -INT8_C(  18),  INT8_C(  45), -INT8_C(  44), -INT8_C(  80), -INT8_C( 115),  INT8_C(  49), -INT8_C(  51), -INT8_C(  29) },
+      UINT32_C(3578810685),
+      { -INT8_C( 123), -INT8_C(   7), -INT8_C(  91),  INT8_C( 105),  INT8_C(  61),  INT8_C( 113), -INT8_C(  69),  INT8_C(  89),
+        -INT8_C(  35), -INT8_C( 100),  INT8_C( 114),  INT8_C(  29), -INT8_C(  39), -INT8_C(   9), -INT8_C(  40),  INT8_C( 110),
+        -INT8_C(   7), -INT8_C( 108),  INT8_C(  21), -INT8_C(  24), -INT8_C(  63), -INT8_C(  23), -INT8_C( 104),  INT8_C(  79),
+         INT8_C(  26),  INT8_C( 102),  INT8_C(  50),  INT8_C(  87), -INT8_C(  73), -INT8_C( 126),  INT8_C(  45),  INT8_C(  60) },
+      { -INT8_C( 123),  INT8_C(  12), -INT8_C(   7), -INT8_C(  91),  INT8_C( 105),  INT8_C(  61), -INT8_C(  87), -INT8_C(  48),
+         INT8_C( 113),  INT8_C(  68), -INT8_C(  53),  INT8_C(  82), -INT8_C(  69),  INT8_C( 108),  INT8_C(  89),  INT8_C(  25),
+         INT8_C(  64),  INT8_C(  61), -INT8_C( 124), -INT8_C(  69), -INT8_C(  35),  INT8_C(   2), -INT8_C( 100), -INT8_C(  90),
+         INT8_C( 114),  INT8_C(  45),  INT8_C(  29), -INT8_C(  80), -INT8_C(  39),  INT8_C(  49), -INT8_C(   9), -INT8_C(  40) } },
+    { {  INT8_C( 124), -INT8_C(  46), -INT8_C(  91), -INT8_C(  71),  INT8_C(  67),  INT8_C(  97),  INT8_C(  18),  INT8_C(  32),
+        -INT8_C(   3), -INT8_C( 123),  INT8_C(  62), -INT8_C(  42),  INT8_C( 124),  INT8_C(  22),  INT8_C(  69),  INT8_C( 117),
+        -INT8_C(  85),  INT8_C(  90),  INT8_C(  93),  INT8_C( 108),  INT8_C(  67), -INT8_C(  10), -INT8_C(  69),  INT8_C(  94),
+         INT8_C(  92), -INT8_C(  19), -INT8_C(  75),  INT8_C(  19),  INT8_C( 112), -INT8_C(  30),  INT8_C(  79), -INT8_C(  20) },
+      UINT32_C(4171625653),
+      {  INT8_C(  85), -INT8_C(  72),  INT8_C(  25),  INT8_C(  82),  INT8_C(  61),  INT8_C(  87),  INT8_C(  41), -INT8_C(  71),
+         INT8_C( 109),  INT8_C( 110),  INT8_C(  46),  INT8_C(  24), -INT8_C(  56), -INT8_C( 116), -INT8_C( 123),  INT8_C(  11),
+        -INT8_C( 126),  INT8_C(  64),  INT8_C( 105), -INT8_C(  34),  INT8_C(  46),  INT8_C(  31), -INT8_C(  15), -INT8_C(  98),
+         INT8_C(   1),  INT8_C(  64), -INT8_C( 118), -INT8_C(  74),  INT8_C(  52),  INT8_C(  47), -INT8_C(  81), -INT8_C( 118) },
+      {  INT8_C(  85), -INT8_C(  46), -INT8_C(  72), -INT8_C(  71),  INT8_C(  25),  INT8_C(  82),  INT8_C(  18),  INT8_C(  61),
+        -INT8_C(   3), -INT8_C( 123),  INT8_C(  87), -INT8_C(  42),  INT8_C(  41), -INT8_C(  71),  INT8_C( 109),  INT8_C( 110),
+         INT8_C(  46),  INT8_C(  90),  INT8_C(  24),  INT8_C( 108),  INT8_C(  67), -INT8_C(  56), -INT8_C(  69), -INT8_C( 116),
+         INT8_C(  92), -INT8_C(  19), -INT8_C(  75), -INT8_C( 123),  INT8_C(  11), -INT8_C( 126),  INT8_C(  64),  INT8_C( 105) } },
+    { { -INT8_C(  25), -INT8_C(  56), -INT8_C(  36),  INT8_C(  36),  INT8_C(  31),  INT8_C(   5), -INT8_C(  35), -INT8_C( 116),
+         INT8_C( 115),  INT8_C(  12), -INT8_C(  91),  INT8_C(  59), -INT8_C( 104),  INT8_C(  42),  INT8_C(  71),  INT8_C(  26),
+         INT8_C( 106), -INT8_C(  80), -INT8_C(   8), -INT8_C( 104), -INT8_C(  49), -INT8_C(  23),  INT8_C(  54), -INT8_C(  47),
+         INT8_C(  41), -INT8_C(  64), -INT8_C( 121),  INT8_C(  93), -INT8_C(  16),  INT8_C(  54), -INT8_C(  25), -INT8_C(  41) },
+      UINT32_C( 503104766),
+      { -INT8_C(  55), -INT8_C(  39), -INT8_C(  86),  INT8_C(  61), -INT8_C(  27),  INT8_C(  79),  INT8_C( 120),  INT8_C( 125),
+         INT8_C( 121), -INT8_C(  65), -INT8_C( 105), -INT8_C(  29),  INT8_C( 112), -INT8_C( 113),  INT8_C( 124),  INT8_C(  63),
+         INT8_C( 120), -INT8_C(  78),  INT8_C(  16), -INT8_C(  95),  INT8_C( 115), -INT8_C( 104), -INT8_C(   1),  INT8_C(  99),
+        -INT8_C(  50), -INT8_C(  26),  INT8_C(  58), -INT8_C(  51), -INT8_C(  86),  INT8_C(  54), -INT8_C(  22),  INT8_C( 116) },
+      { -INT8_C(  25), -INT8_C(  55), -INT8_C(  39), -INT8_C(  86),  INT8_C(  61), -INT8_C(  27),  INT8_C(  79),  INT8_C( 120),
+         INT8_C( 115),  INT8_C(  12),  INT8_C( 125),  INT8_C(  59), -INT8_C( 104),  INT8_C(  42),  INT8_C( 121), -INT8_C(  65),
+         INT8_C( 106), -INT8_C(  80), -INT8_C( 105), -INT8_C(  29),  INT8_C( 112), -INT8_C( 113),  INT8_C( 124),  INT8_C(  63),
+         INT8_C( 120), -INT8_C(  64), -INT8_C(  78),  INT8_C(  16), -INT8_C(  95),  INT8_C(  54), -INT8_C(  25), -INT8_C(  41) } },
+    { {  INT8_C(  16), -INT8_C( 108), -INT8_C(  79), -INT8_C(  11), -INT8_C(  29),  INT8_C(  41),  INT8_C( 115),  INT8_C(  92),
+        -INT8_C(  23),  INT8_C(  10),  INT8_C(  64),  INT8_C(  89), -INT8_C( 102), -INT8_C(  68), -INT8_C( 104),  INT8_C(  18),
+         INT8_C( 110), -INT8_C(  87), -INT8_C(  76), -INT8_C(  31),  INT8_C(  65), -INT8_C(  77),  INT8_C(  68),  INT8_C(  15),
+        -INT8_C( 103),      INT8_MAX, -INT8_C(  36),  INT8_C(  68), -INT8_C(  75), -INT8_C(  57), -INT8_C(  72), -INT8_C(  59) },
+      UINT32_C(1069246811),
+      { -INT8_C( 110),  INT8_C(  46), -INT8_C( 101),  INT8_C( 123),  INT8_C(  56), -INT8_C(  37), -INT8_C(  44), -INT8_C(  46),
+        -INT8_C( 105),  INT8_C( 109), -INT8_C(  27),  INT8_C(   6),  INT8_C(  22), -INT8_C( 103), -INT8_C(  25),  INT8_C(  87),
+         INT8_C(  76),  INT8_C(  44),  INT8_C( 102), -INT8_C(  27), -INT8_C(  85),  INT8_C(  67),  INT8_C(  41),  INT8_C(  96),
+         INT8_C(  10), -INT8_C(  31),  INT8_C(  38),  INT8_C( 101),  INT8_C(  74), -INT8_C(  31), -INT8_C(  92), -INT8_C(  35) },
+      { -INT8_C( 110),  INT8_C(  46), -INT8_C(  79), -INT8_C( 101),  INT8_C( 123),  INT8_C(  41),  INT8_C(  56),  INT8_C(  92),
+        -INT8_C(  37),  INT8_C(  10),  INT8_C(  64), -INT8_C(  44), -INT8_C( 102), -INT8_C(  46), -INT8_C( 105),  INT8_C(  18),
+         INT8_C( 109), -INT8_C(  27), -INT8_C(  76),  INT8_C(   6),  INT8_C(  22), -INT8_C( 103),  INT8_C(  68), -INT8_C(  25),
+         INT8_C(  87),  INT8_C(  76),  INT8_C(  44),  INT8_C( 102), -INT8_C(  27), -INT8_C(  85), -INT8_C(  72), -INT8_C(  59) } },
+    { {  INT8_C(  15),  INT8_C(  64),  INT8_C(  88),  INT8_C(  71),  INT8_C(  27),  INT8_C(  45),  INT8_C(  26), -INT8_C(  77),
+        -INT8_C( 102), -INT8_C(   1), -INT8_C(  71), -INT8_C(  80), -INT8_C( 104), -INT8_C(  96),  INT8_C(   7), -INT8_C(  28),
+        -INT8_C(  52),  INT8_C( 109), -INT8_C(  55),  INT8_C( 119), -INT8_C(  80), -INT8_C(  13), -INT8_C(  40), -INT8_C(  70),
+        -INT8_C(  44), -INT8_C(   2),  INT8_C(  32),  INT8_C(  31), -INT8_C(  33), -INT8_C(  60), -INT8_C(   4), -INT8_C(  18) },
+      UINT32_C( 540365828),
+      { -INT8_C( 127),  INT8_C(  79), -INT8_C(  45),  INT8_C(  27),  INT8_C(  78), -INT8_C( 116), -INT8_C(  53), -INT8_C(  26),
+         INT8_C(  44), -INT8_C(  46), -INT8_C(  54), -INT8_C(   7),  INT8_C(  64), -INT8_C( 108),  INT8_C( 112), -INT8_C(  16),
+        -INT8_C( 121),  INT8_C(  72), -INT8_C(  85),  INT8_C(  91),  INT8_C(  70), -INT8_C(  53),  INT8_C( 122),  INT8_C(  37),
+        -INT8_C( 113),  INT8_C( 118),  INT8_C(  19), -INT8_C( 108), -INT8_C(  53),  INT8_C(  73), -INT8_C(  76),  INT8_C(  76) },
+      {  INT8_C(  15),  INT8_C(  64), -INT8_C( 127),  INT8_C(  71),  INT8_C(  27),  INT8_C(  45),  INT8_C(  26), -INT8_C(  77),
+        -INT8_C( 102), -INT8_C(   1),  INT8_C(  79), -INT8_C(  80), -INT8_C(  45), -INT8_C(  96),  INT8_C(  27), -INT8_C(  28),
+         INT8_C(  78),  INT8_C( 109), -INT8_C( 116),  INT8_C( 119), -INT8_C(  53), -INT8_C(  26), -INT8_C(  40), -INT8_C(  70),
+        -INT8_C(  44), -INT8_C(   2),  INT8_C(  32),  INT8_C(  31), -INT8_C(  33),  INT8_C(  44), -INT8_C(   4), -INT8_C(  18) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi8(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i r = simde_mm256_mask_expand_epi8(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x32(r, simde_x_mm256_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m256i src = simde_test_x86_random_i8x32();
+    simde__mmask32 k = simde_test_x86_random_mmask32();
+    simde__m256i a = simde_test_x86_random_i8x32();
+    simde__m256i r = simde_mm256_mask_expand_epi8(src, k, a);
+
+    simde_test_x86_write_i8x32(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask32(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x32(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_maskz_expand_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask32 k;
+    const int8_t a[32];
+    const int8_t r[32];
+  } test_vec[] = {
+    { UINT32_C(3882387352),
+      {  INT8_C(  19),  INT8_C(  51), -INT8_C(  51),  INT8_C(  63),  INT8_C(   6), -INT8_C( 104),  INT8_C(  56),  INT8_C(  70),
+         INT8_C(  44), -INT8_C(  87),  INT8_C(  54), -INT8_C(  77), -INT8_C(  15), -INT8_C(  31),  INT8_C(  14),  INT8_C(  56),
+        -INT8_C(  84), -INT8_C( 119),  INT8_C(  93),  INT8_C(  60), -INT8_C(   1),  INT8_C( 113), -INT8_C(  48), -INT8_C(  54),
+        -INT8_C(  70), -INT8_C( 124),  INT8_C(  23),  INT8_C(  82),  INT8_C(  11),      INT8_MAX,  INT8_C(  57),  INT8_C(  30) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  19),  INT8_C(  51),  INT8_C(   0),  INT8_C(   0), -INT8_C(  51),
+         INT8_C(  63),  INT8_C(   6), -INT8_C( 104),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  56),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  70),  INT8_C(   0),  INT8_C(  44), -INT8_C(  87),  INT8_C(   0),
+         INT8_C(  54), -INT8_C(  77), -INT8_C(  15),  INT8_C(   0),  INT8_C(   0), -INT8_C(  31),  INT8_C(  14),  INT8_C(  56) } },
+    { UINT32_C(3093104562),
+      { -INT8_C(  97), -INT8_C( 106), -INT8_C(   2), -INT8_C(  53),  INT8_C(  63),  INT8_C(  53),  INT8_C( 126),  INT8_C(  48),
+         INT8_C(  22), -INT8_C( 116),  INT8_C( 104), -INT8_C(  61),  INT8_C(  21), -INT8_C(  58), -INT8_C(   1),  INT8_C(  21),
+         INT8_C(  55), -INT8_C(  49), -INT8_C(  33), -INT8_C(  15),  INT8_C(  83), -INT8_C(  10),  INT8_C(  67),  INT8_C(  94),
+         INT8_C( 117),  INT8_C( 125),  INT8_C( 124),  INT8_C(  40), -INT8_C( 124), -INT8_C(  39), -INT8_C(  32),  INT8_C(  35) },
+      {  INT8_C(   0), -INT8_C(  97),  INT8_C(   0),  INT8_C(   0), -INT8_C( 106), -INT8_C(   2),  INT8_C(   0), -INT8_C(  53),
+         INT8_C(  63),  INT8_C(  53),  INT8_C( 126),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  48),  INT8_C(   0),  INT8_C(  22), -INT8_C( 116),  INT8_C( 104),  INT8_C(   0), -INT8_C(  61),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  21), -INT8_C(  58), -INT8_C(   1),  INT8_C(   0),  INT8_C(  21) } },
+    { UINT32_C(2934890351),
+      {  INT8_C(  20),  INT8_C( 108), -INT8_C(  33),  INT8_C(  42), -INT8_C(   8),  INT8_C(  71), -INT8_C(  19),  INT8_C(  14),
+         INT8_C(  13), -INT8_C(  20),  INT8_C(  35),  INT8_C(  68), -INT8_C(  69),  INT8_C(   2),  INT8_C(  53),  INT8_C(  14),
+        -INT8_C(   7),  INT8_C( 121),  INT8_C( 108),  INT8_C( 110), -INT8_C(  10), -INT8_C(  24), -INT8_C( 106),  INT8_C( 122),
+        -INT8_C(  62),  INT8_C( 119), -INT8_C(  99),  INT8_C(  49),  INT8_C(  86), -INT8_C( 117), -INT8_C(  32),  INT8_C( 106) },
+      {  INT8_C(  20),  INT8_C( 108), -INT8_C(  33),  INT8_C(  42),  INT8_C(   0), -INT8_C(   8),  INT8_C(  71),  INT8_C(   0),
+        -INT8_C(  19),  INT8_C(  14),  INT8_C(  13), -INT8_C(  20),  INT8_C(  35),  INT8_C(   0),  INT8_C(  68), -INT8_C(  69),
+         INT8_C(   0),  INT8_C(   2),  INT8_C(  53),  INT8_C(  14),  INT8_C(   0), -INT8_C(   7),  INT8_C( 121),  INT8_C( 108),
+         INT8_C(   0),  INT8_C( 110), -INT8_C(  10), -INT8_C(  24),  INT8_C(   0), -INT8_C( 106),  INT8_C(   0),  INT8_C( 122) } },
+    { UINT32_C(4019503095),
+      {  INT8_C(   6), -INT8_C( 126), -INT8_C(   3),  INT8_C(  20),  INT8_C( 110),  INT8_C(  32),  INT8_C(  88),  INT8_C(  42),
+         INT8_C(  35), -INT8_C( 114),  INT8_C(  56),  INT8_C(  28),  INT8_C(   7), -INT8_C(  91), -INT8_C( 118), -INT8_C(   3),
+        -INT8_C( 115),  INT8_C(  33),  INT8_C( 119),  INT8_C(  79), -INT8_C( 104),  INT8_C(  20), -INT8_C( 127), -INT8_C(  18),
+        -INT8_C(  97),  INT8_C(  97),  INT8_C(  88), -INT8_C( 106),  INT8_C(  32), -INT8_C(  20), -INT8_C( 123),  INT8_C(  38) },
+      {  INT8_C(   6), -INT8_C( 126), -INT8_C(   3),  INT8_C(   0),  INT8_C(  20),  INT8_C( 110),  INT8_C(  32),  INT8_C(  88),
+         INT8_C(  42),  INT8_C(  35), -INT8_C( 114),  INT8_C(  56),  INT8_C(  28),  INT8_C(   7),  INT8_C(   0), -INT8_C(  91),
+         INT8_C(   0),  INT8_C(   0), -INT8_C( 118),  INT8_C(   0), -INT8_C(   3),  INT8_C(   0),  INT8_C(   0), -INT8_C( 115),
+         INT8_C(  33),  INT8_C( 119),  INT8_C(  79), -INT8_C( 104),  INT8_C(   0),  INT8_C(  20), -INT8_C( 127), -INT8_C(  18) } },
+    { UINT32_C(3711599470),
+      { -INT8_C(  93), -INT8_C( 109),  INT8_C(   7), -INT8_C(  58),  INT8_C(  33),  INT8_C(  63), -INT8_C(  30),  INT8_C(  40),
+        -INT8_C(  28),  INT8_C( 109),  INT8_C(  37),  INT8_C( 114), -INT8_C( 114), -INT8_C( 100), -INT8_C(  63),  INT8_C(  38),
+        -INT8_C(  80),  INT8_C(  66),  INT8_C(  20),  INT8_C(  79), -INT8_C(  93),  INT8_C( 108), -INT8_C(  27), -INT8_C(  61),
+         INT8_C(  88),  INT8_C( 106), -INT8_C(  22), -INT8_C(  57), -INT8_C(  19),  INT8_C(  36), -INT8_C(  92), -INT8_C( 111) },
+      {  INT8_C(   0), -INT8_C(  93), -INT8_C( 109),  INT8_C(   7),  INT8_C(   0), -INT8_C(  58),  INT8_C(  33),  INT8_C(   0),
+         INT8_C(  63), -INT8_C(  30),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  40),
+         INT8_C(   0), -INT8_C(  28),  INT8_C(   0),  INT8_C( 109),  INT8_C(  37),  INT8_C( 114),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C( 114),  INT8_C(   0), -INT8_C( 100), -INT8_C(  63),  INT8_C(  38),  INT8_C(   0), -INT8_C(  80),  INT8_C(  66) } },
+    { UINT32_C(3629624247),
+      { -INT8_C(  22),  INT8_C(  58),  INT8_C(   0), -INT8_C(  49), -INT8_C(  89),  INT8_C(  37),  INT8_C(  65),  INT8_C(  53),
+        -INT8_C(  63),  INT8_C(   2),  INT8_C(  91),  INT8_C( 113),  INT8_C(  69),  INT8_C( 111), -INT8_C(  64), -INT8_C(  24),
+        -INT8_C(  37), -INT8_C(  91), -INT8_C(  84),  INT8_C(  51),  INT8_C(  16), -INT8_C( 106), -INT8_C(   6), -INT8_C(   3),
+        -INT8_C(  70), -INT8_C(  98), -INT8_C( 114),  INT8_C( 114),  INT8_C(  73), -INT8_C(  26),  INT8_C(  74),  INT8_C(  52) },
+      { -INT8_C(  22),  INT8_C(  58),  INT8_C(   0),  INT8_C(   0), -INT8_C(  49), -INT8_C(  89),  INT8_C(   0),  INT8_C(  37),
+         INT8_C(  65),  INT8_C(  53),  INT8_C(   0), -INT8_C(  63),  INT8_C(   0),  INT8_C(   2),  INT8_C(   0),  INT8_C(  91),
+         INT8_C( 113),  INT8_C(  69),  INT8_C( 111),  INT8_C(   0), -INT8_C(  64),  INT8_C(   0), -INT8_C(  24),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  37), -INT8_C(  91),  INT8_C(   0), -INT8_C(  84),  INT8_C(  51) } },
+    { UINT32_C(3338881824),
+      {  INT8_C( 112),  INT8_C(  68), -INT8_C(   4),  INT8_C(  50),  INT8_C(  70),  INT8_C(  87), -INT8_C(  93), -INT8_C( 117),
+        -INT8_C(  58),  INT8_C( 100),  INT8_C( 116), -INT8_C(  95),  INT8_C(   9),  INT8_C(  32), -INT8_C(  44),  INT8_C(  25),
+        -INT8_C(  74), -INT8_C(  49),  INT8_C(  23),  INT8_C( 112),  INT8_C( 109), -INT8_C(  91), -INT8_C(  30), -INT8_C(  73),
+        -INT8_C( 117),  INT8_C(  45), -INT8_C(  21), -INT8_C(  85),  INT8_C( 120), -INT8_C(  18),  INT8_C( 114), -INT8_C(  24) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 112),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  68), -INT8_C(   4),  INT8_C(   0),  INT8_C(  50),  INT8_C(   0),  INT8_C(   0),  INT8_C(  70),  INT8_C(   0),
+         INT8_C(  87), -INT8_C(  93),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C( 117), -INT8_C(  58),  INT8_C( 100),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 116), -INT8_C(  95) } },
+    { UINT32_C(2014998066),
+      { -INT8_C(  59), -INT8_C(  66),  INT8_C(   4), -INT8_C( 117),  INT8_C(  34),  INT8_C( 120),  INT8_C(  44),  INT8_C(  43),
+        -INT8_C( 104),  INT8_C(   1),  INT8_C(  69),  INT8_C(  78), -INT8_C(  48),  INT8_C(  92), -INT8_C(  66),  INT8_C(  61),
+         INT8_C(   1), -INT8_C(  95), -INT8_C(  12), -INT8_C( 115), -INT8_C(  50), -INT8_C(  33),  INT8_C(  56),  INT8_C(  70),
+        -INT8_C(  51), -INT8_C(  85),  INT8_C(  46), -INT8_C(   1),  INT8_C(  25),  INT8_C(  73),  INT8_C( 120), -INT8_C(  33) },
+      {  INT8_C(   0), -INT8_C(  59),  INT8_C(   0),  INT8_C(   0), -INT8_C(  66),  INT8_C(   4),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0), -INT8_C( 117),  INT8_C(  34),  INT8_C( 120),  INT8_C(   0),  INT8_C(  44),  INT8_C(  43),  INT8_C(   0),
+         INT8_C(   0), -INT8_C( 104),  INT8_C(   0),  INT8_C(   1),  INT8_C(  69),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  78), -INT8_C(  48),  INT8_C(  92), -INT8_C(  66),  INT8_C(   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i r = simde_mm256_maskz_expand_epi8(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x32(r, simde_x_mm256_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask32 k = simde_test_x86_random_mmask32();
+    simde__m256i a = simde_test_x86_random_i8x32();
+    simde__m256i r = simde_mm256_maskz_expand_epi8(k, a);
+
+    simde_test_x86_write_mmask32(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i8x32(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_mask_expandloadu_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int8_t src[32];
+    const simde__mmask32 k;
+    const int8_t a[32];
+    const int8_t r[32];
+  } test_vec[] = {
+    { {  INT8_C(   7),  INT8_C( 124),  INT8_C( 106),  INT8_C(  41), -INT8_C(  12), -INT8_C( 105),  INT8_C(  84), -INT8_C( 116),
+        -INT8_C( 104), -INT8_C( 103), -INT8_C(  38),  INT8_C( 104), -INT8_C(  11), -INT8_C( 104), -INT8_C(  91), -INT8_C(   9),
+         INT8_C(  57), -INT8_C( 102), -INT8_C( 124),  INT8_C(   7),  INT8_C( 121), -INT8_C(  68),  INT8_C(  77),  INT8_C(  71),
+         INT8_C( 103),  INT8_C( 124),  INT8_C(  70), -INT8_C( 127), -INT8_C(  59), -INT8_C(  66),  INT8_C(  96), -INT8_C(  52) },
+      UINT32_C( 787860026),
+      {  INT8_C(  97),  INT8_C(  73), -INT8_C(  70), -INT8_C(   7), -INT8_C(  29), -INT8_C( 108),  INT8_C(  97), -INT8_C(  40),
+         INT8_C(  45),  INT8_C(   7), -INT8_C(  49),  INT8_C( 102), -INT8_C(  95),  INT8_C(  83),  INT8_C( 110),  INT8_C(  26),
+         INT8_C(  16), -INT8_C(  69),  INT8_C(  97),  INT8_C( 119),  INT8_C(  55), -INT8_C(  88), -INT8_C(   8), -INT8_C(   4),
+         INT8_C( 102),  INT8_C(  88), -INT8_C(  56), -INT8_C(  95),  INT8_C(  35), -INT8_C(  67), -INT8_C(  49), -INT8_C( 124) },
+      {  INT8_C(   7),  INT8_C(  97),  INT8_C( 106),  INT8_C(  73), -INT8_C(  70), -INT8_C(   7),  INT8_C(  84), -INT8_C( 116),
+        -INT8_C( 104), -INT8_C(  29), -INT8_C(  38), -INT8_C( 108), -INT8_C(  11), -INT8_C( 104),  INT8_C(  97), -INT8_C(  40),
+         INT8_C(  45), -INT8_C( 102),  INT8_C(   7),  INT8_C(   7), -INT8_C(  49),  INT8_C( 102), -INT8_C(  95),  INT8_C(  83),
+         INT8_C( 103),  INT8_C( 110),  INT8_C(  26),  INT8_C(  16), -INT8_C(  59), -INT8_C(  69),  INT8_C(  96), -INT8_C(  52) } },
+    { {  INT8_C(   7), -INT8_C( 118),  INT8_C( 126), -INT8_C(  22),  INT8_C(  30), -INT8_C(  33), -INT8_C(  62),  INT8_C(  75),
+        -INT8_C(  26), -INT8_C( 110), -INT8_C(  78), -INT8_C( 121), -INT8_C(  27),  INT8_C(  32), -INT8_C(  94), -INT8_C(  11),
+        -INT8_C(  37),  INT8_C(   3),  INT8_C( 109),  INT8_C(  19), -INT8_C(  85),  INT8_C( 101),  INT8_C(  15),  INT8_C(  18),
+        -INT8_C(  66), -INT8_C(  40), -INT8_C(  77), -INT8_C(  31), -INT8_C( 107), -INT8_C( 126),  INT8_C( 101), -INT8_C( 100) },
+      UINT32_C( 730260236),
+      { -INT8_C(  61),  INT8_C(  73),  INT8_C( 118), -INT8_C(  87), -INT8_C(  37),  INT8_C(  40),  INT8_C(  49), -INT8_C(  64),
+         INT8_C(  72), -INT8_C(  45), -INT8_C(  74),  INT8_C(  36), -INT8_C(  42),  INT8_C(  35),  INT8_C(  55), -INT8_C( 126),
+        -INT8_C( 120),  INT8_C(  70), -INT8_C( 108),  INT8_C(  70),  INT8_C(  30),  INT8_C(  71),  INT8_C(  39), -INT8_C(  76),
+        -INT8_C(  55), -INT8_C( 115),  INT8_C(  80), -INT8_C(  42),  INT8_C( 112), -INT8_C(  41),  INT8_C(   1),  INT8_C(  51) },
+      {  INT8_C(   7), -INT8_C( 118), -INT8_C(  61),  INT8_C(  73),  INT8_C(  30), -INT8_C(  33), -INT8_C(  62),  INT8_C(  75),
+         INT8_C( 118), -INT8_C(  87), -INT8_C(  78), -INT8_C( 121), -INT8_C(  27), -INT8_C(  37),  INT8_C(  40),  INT8_C(  49),
+        -INT8_C(  37), -INT8_C(  64),  INT8_C(  72),  INT8_C(  19), -INT8_C(  85),  INT8_C( 101),  INT8_C(  15), -INT8_C(  45),
+        -INT8_C(  74),  INT8_C(  36), -INT8_C(  77), -INT8_C(  42), -INT8_C( 107),  INT8_C(  35),  INT8_C( 101), -INT8_C( 100) } },
+    { {  INT8_C(  32),  INT8_C( 119), -INT8_C(  35), -INT8_C(   5), -INT8_C(  96),  INT8_C(  14), -INT8_C(  69), -INT8_C(  24),
+        -INT8_C(  31),  INT8_C( 113),  INT8_C(  12), -INT8_C(  73), -INT8_C( 108),  INT8_C(  67),  INT8_C(  57),  INT8_C(  29),
+        -INT8_C( 118), -INT8_C(  51),  INT8_C(  99), -INT8_C(  88),  INT8_C(  20), -INT8_C( 117),  INT8_C(  92), -INT8_C(  34),
+         INT8_C(  24), -INT8_C(  83), -INT8_C(  76), -INT8_C( 120), -INT8_C( 124), -INT8_C(  75), -INT8_C(  68), -INT8_C(  92) },
+      UINT32_C(3433011500),
+      { -INT8_C(  89),  INT8_C(  90), -INT8_C(  75), -INT8_C( 120), -INT8_C(  52), -INT8_C(  63),  INT8_C(  63),  INT8_C(  96),
+         INT8_C(   5),  INT8_C( 121),  INT8_C( 125), -INT8_C( 113),  INT8_C(  70), -INT8_C(  31),  INT8_C(  55),  INT8_C(  91),
+         INT8_C( 108), -INT8_C( 108),  INT8_C(  57), -INT8_C( 124),  INT8_C(  65), -INT8_C(  19),  INT8_C(  12), -INT8_C(  59),
+        -INT8_C(  94), -INT8_C(  56),  INT8_C( 105), -INT8_C(  50),  INT8_C(  97),  INT8_C(   8), -INT8_C( 101),  INT8_C(   8) },
+      {  INT8_C(  32),  INT8_C( 119), -INT8_C(  89),  INT8_C(  90), -INT8_C(  96), -INT8_C(  75), -INT8_C(  69), -INT8_C(  24),
+        -INT8_C( 120),  INT8_C( 113),  INT8_C(  12), -INT8_C(  52), -INT8_C(  63),  INT8_C(  67),  INT8_C(  57),  INT8_C(  63),
+         INT8_C(  96),  INT8_C(   5),  INT8_C( 121),  INT8_C( 125), -INT8_C( 113), -INT8_C( 117),  INT8_C(  92),  INT8_C(  70),
+         INT8_C(  24), -INT8_C(  83), -INT8_C(  31),  INT8_C(  55), -INT8_C( 124), -INT8_C(  75),  INT8_C(  91),  INT8_C( 108) } },
+    { {  INT8_C(  98),  INT8_C(  80), -INT8_C( 112),  INT8_C(  46),  INT8_C(  17), -INT8_C(  48), -INT8_C( 113),  INT8_C(  22),
+         INT8_C(  73),  INT8_C(  12), -INT8_C(  91), -INT8_C( 113), -INT8_C(  19), -INT8_C(  35), -INT8_C(  22),  INT8_C(  89),
+         INT8_C( 113),  INT8_C(  35), -INT8_C(  35), -INT8_C(  78),  INT8_C(  16), -INT8_C(  22),  INT8_C( 119), -INT8_C(  78),
+        -INT8_C(  78), -INT8_C(  32), -INT8_C( 127),  INT8_C(  20), -INT8_C(  24),  INT8_C(  28),  INT8_C(  28),  INT8_C(  74) },
+      UINT32_C(2105126252),
+      {  INT8_C( 125),  INT8_C(   8), -INT8_C( 108), -INT8_C(  58),  INT8_C(  20),  INT8_C(  57),  INT8_C(  85),  INT8_C(   2),
+         INT8_C(  22),  INT8_C(  64),  INT8_C(  91), -INT8_C( 121),  INT8_C(  99),  INT8_C(  57),  INT8_C(  57),  INT8_C( 116),
+         INT8_C(  35), -INT8_C(  80),  INT8_C(  38), -INT8_C(  43), -INT8_C( 112), -INT8_C(  89), -INT8_C(  23),  INT8_C( 120),
+        -INT8_C(  61),  INT8_C(   6), -INT8_C(  61),  INT8_C(  47), -INT8_C(  77),  INT8_C(  60), -INT8_C(  83),  INT8_C(  48) },
+      {  INT8_C(  98),  INT8_C(  80),  INT8_C( 125),  INT8_C(   8),  INT8_C(  17), -INT8_C( 108), -INT8_C(  58),  INT8_C(  22),
+         INT8_C(  20),  INT8_C(  12),  INT8_C(  57),  INT8_C(  85), -INT8_C(  19),  INT8_C(   2), -INT8_C(  22),  INT8_C(  22),
+         INT8_C(  64),  INT8_C(  35), -INT8_C(  35),  INT8_C(  91), -INT8_C( 121),  INT8_C(  99),  INT8_C(  57), -INT8_C(  78),
+         INT8_C(  57), -INT8_C(  32),  INT8_C( 116),  INT8_C(  35), -INT8_C(  80),  INT8_C(  38), -INT8_C(  43),  INT8_C(  74) } },
+    { {  INT8_C(  68),  INT8_C(  65), -INT8_C(  10),  INT8_C(  88),  INT8_C( 122),  INT8_C(  75),  INT8_C(  90), -INT8_C( 111),
+        -INT8_C( 117), -INT8_C(  74),  INT8_C(  24), -INT8_C(  17), -INT8_C(  17),  INT8_C(  82),  INT8_C(  99),  INT8_C(  18),
+         INT8_C(   2), -INT8_C( 119), -INT8_C(  25), -INT8_C( 109),  INT8_C(  49), -INT8_C(  47),  INT8_C(  11), -INT8_C(  12),
+        -INT8_C(  41), -INT8_C(  50),  INT8_C(  36), -INT8_C( 118),  INT8_C(  10), -INT8_C(  47), -INT8_C(  70),  INT8_C(  78) },
+      UINT32_C(2359799826),
+      { -INT8_C(   5),  INT8_C(   1),  INT8_C(  29), -INT8_C( 121), -INT8_C(  73),  INT8_C(  54),  INT8_C( 118), -INT8_C(  90),
+        -INT8_C( 120), -INT8_C(  39), -INT8_C(  72), -INT8_C( 118),  INT8_C(  98), -INT8_C(  96),  INT8_C(  29), -INT8_C( 109),
+         INT8_C( 113),  INT8_C(  41), -INT8_C( 120),  INT8_C(  72), -INT8_C(   9), -INT8_C(  84), -INT8_C(  46),  INT8_C(   2),
+         INT8_C( 125), -INT8_C( 116),  INT8_C(  80), -INT8_C( 113),  INT8_C(  60), -INT8_C(   9),  INT8_C(  27),  INT8_C(  55) },
+      {  INT8_C(  68), -INT8_C(   5), -INT8_C(  10),  INT8_C(  88),  INT8_C(   1),  INT8_C(  75),  INT8_C(  90), -INT8_C( 111),
+        -INT8_C( 117), -INT8_C(  74),  INT8_C(  24), -INT8_C(  17),  INT8_C(  29), -INT8_C( 121),  INT8_C(  99), -INT8_C(  73),
+         INT8_C(  54),  INT8_C( 118), -INT8_C(  90), -INT8_C( 109),  INT8_C(  49), -INT8_C( 120),  INT8_C(  11), -INT8_C(  39),
+        -INT8_C(  41), -INT8_C(  50), -INT8_C(  72), -INT8_C( 118),  INT8_C(  10), -INT8_C(  47), -INT8_C(  70),  INT8_C(  98) } },
+    { { -INT8_C(   7),  INT8_C(  57), -INT8_C(  66), -INT8_C(  80),  INT8_C( 111),  INT8_C(  52),  INT8_C(  87), -INT8_C(   9),
+         INT8_C(  13),  INT8_C(  15), -INT8_C( 127),  INT8_C( 112), -INT8_C(  81), -INT8_C(  97),  INT8_C(   3),  INT8_C(  32),
+        -INT8_C(  56), -INT8_C( 117),  INT8_C( 104), -INT8_C(  65),  INT8_C(  55),  INT8_C(  58), -INT8_C(  63), -INT8_C(  76),
+        -INT8_C(  58),  INT8_C(  18),  INT8_C(  67),  INT8_C(   2),  INT8_C(   9),  INT8_C(  95),  INT8_C(  58),  INT8_C(   2) },
+      UINT32_C( 129235096),
+      {  INT8_C(  45),  INT8_C(  10), -INT8_C(   2),  INT8_C(  58),  INT8_C(  25),      INT8_MAX, -INT8_C(  86), -INT8_C(  55),
+         INT8_C(  30), -INT8_C(  82), -INT8_C(  23), -INT8_C(  26),  INT8_C(  57),  INT8_C(  82), -INT8_C(  90),  INT8_C( 113),
+        -INT8_C( 116),  INT8_C( 103),  INT8_C(  37),  INT8_C(  83),  INT8_C( 121),  INT8_C( 105),  INT8_C(  85), -INT8_C( 125),
+        -INT8_C(  56), -INT8_C( 113), -INT8_C( 123),  INT8_C(  96), -INT8_C( 120),  INT8_C(  56),  INT8_C( 103), -INT8_C(  75) },
+      { -INT8_C(   7),  INT8_C(  57), -INT8_C(  66),  INT8_C(  45),  INT8_C(  10),  INT8_C(  52),  INT8_C(  87), -INT8_C(   2),
+         INT8_C(  13),  INT8_C(  15), -INT8_C( 127),  INT8_C(  58),  INT8_C(  25),      INT8_MAX, -INT8_C(  86), -INT8_C(  55),
+         INT8_C(  30), -INT8_C(  82),  INT8_C( 104), -INT8_C(  65), -INT8_C(  23), -INT8_C(  26), -INT8_C(  63),  INT8_C(  57),
+         INT8_C(  82), -INT8_C(  90),  INT8_C( 113),  INT8_C(   2),  INT8_C(   9),  INT8_C(  95),  INT8_C(  58),  INT8_C(   2) } },
+    { {  INT8_C(  66),  INT8_C( 101), -INT8_C(  17),  INT8_C(  92), -INT8_C(  28), -INT8_C( 102),  INT8_C(  37),  INT8_C(   3),
+         INT8_C(  72),  INT8_C(  14), -INT8_C(  23), -INT8_C( 127),  INT8_C(  96), -INT8_C( 113), -INT8_C(  14), -INT8_C(  19),
+        -INT8_C(   9),  INT8_C(  24),  INT8_C(  64),  INT8_C( 112), -INT8_C( 127), -INT8_C( 107), -INT8_C(  13),  INT8_C(  73),
+         INT8_C(  37),  INT8_C( 121), -INT8_C(  87), -INT8_C(  83), -INT8_C(  79),  INT8_C(  16),  INT8_C(  98), -INT8_C(  12) },
+      UINT32_C(1498435957),
+      { -INT8_C(  21),  INT8_C( 117),  INT8_C(  92),  INT8_C(  51), -INT8_C( 125),  INT8_C(  70), -INT8_C(  75), -INT8_C(  28),
+        -INT8_C(  43), -INT8_C(  89), -INT8_C(  47), -INT8_C(  52), -INT8_C(  65),  INT8_C(  17),  INT8_C(  61),  INT8_C(  64),
+        -INT8_C(  90),  INT8_C(  48), -INT8_C( 119), -INT8_C(  53), -INT8_C(  87),  INT8_C(  50),  INT8_C( 120),  INT8_C(  91),
+         INT8_C(  66), -INT8_C(  38),  INT8_C(  79), -INT8_C(  73),  INT8_C(  44), -INT8_C(  97),  INT8_C(  17),  INT8_C(  23) },
+      { -INT8_C(  21),  INT8_C( 101),  INT8_C( 117),  INT8_C(  92),  INT8_C(  92),  INT8_C(  51), -INT8_C( 125),  INT8_C(   3),
+         INT8_C(  70),  INT8_C(  14), -INT8_C(  23), -INT8_C( 127), -INT8_C(  75), -INT8_C( 113), -INT8_C(  28), -INT8_C(  19),
+        -INT8_C(   9),  INT8_C(  24),  INT8_C(  64),  INT8_C( 112), -INT8_C(  43), -INT8_C( 107), -INT8_C(  89),  INT8_C(  73),
+        -INT8_C(  47),  INT8_C( 121), -INT8_C(  87), -INT8_C(  52), -INT8_C(  65),  INT8_C(  16),  INT8_C(  17), -INT8_C(  12) } },
+    { {  INT8_C(  20),  INT8_C( 109),  INT8_C(  75), -INT8_C( 105), -INT8_C(  77),  INT8_C(   0),  INT8_C( 123), -INT8_C( 119),
+        -INT8_C(  89),  INT8_C(  76),  INT8_C(  85),  INT8_C( 103),  INT8_C(  93), -INT8_C( 110), -INT8_C(  89),  INT8_C(   4),
+        -INT8_C(  61),  INT8_C(  49), -INT8_C(  49),  INT8_C( 108),  INT8_C(  99),  INT8_C(  72), -INT8_C(  57), -INT8_C(  90),
+         INT8_C(  34),  INT8_C(  22),  INT8_C(  93),  INT8_C(  78), -INT8_C(  75),  INT8_C( 110),  INT8_C( 102), -INT8_C(  55) },
+      UINT32_C(2405544412),
+      { -INT8_C(  79), -INT8_C(  36),  INT8_C(  24),  INT8_C(  88),  INT8_C(  41),  INT8_C( 110), -INT8_C(  65), -INT8_C( 122),
+         INT8_C(   0),  INT8_C( 103), -INT8_C( 118), -INT8_C(  61), -INT8_C( 104),  INT8_C(  90),  INT8_C(  48), -INT8_C(   5),
+        -INT8_C(  94), -INT8_C(   9), -INT8_C(  95), -INT8_C(  60),  INT8_C(  14), -INT8_C(   1),  INT8_C(  19), -INT8_C(  61),
+         INT8_C( 109),  INT8_C( 121), -INT8_C( 115),  INT8_C(  73),  INT8_C(  42), -INT8_C(  18), -INT8_C(  39), -INT8_C(  37) },
+      {  INT8_C(  20),  INT8_C( 109), -INT8_C(  79), -INT8_C(  36),  INT8_C(  24),  INT8_C(   0),  INT8_C(  88),  INT8_C(  41),
+         INT8_C( 110),  INT8_C(  76),  INT8_C(  85),  INT8_C( 103), -INT8_C(  65), -INT8_C( 122), -INT8_C(  89),  INT8_C(   0),
+         INT8_C( 103),  INT8_C(  49), -INT8_C(  49),  INT8_C( 108),  INT8_C(  99), -INT8_C( 118), -INT8_C(  61), -INT8_C(  90),
+        -INT8_C( 104),  INT8_C(  90),  INT8_C(  48), -INT8_C(   5), -INT8_C(  75),  INT8_C( 110),  INT8_C( 102), -INT8_C(  94) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi8(test_vec[i].src);
+    simde__m256i r = simde_mm256_mask_expandloadu_epi8(src, test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_i8x32(r, simde_x_mm256_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m256i src = simde_test_x86_random_i8x32();
+    simde__mmask32 k = simde_test_x86_random_mmask32();
+    simde__m256i a = simde_test_x86_random_i8x32();
+    simde__m256i r = simde_mm256_mask_expandloadu_epi8(src, k, &a);
+
+    simde_test_x86_write_i8x32(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask32(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x32(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_maskz_expandloadu_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask32 k;
+    const int8_t a[32];
+    const int8_t r[32];
+  } test_vec[] = {
+    { UINT32_C(4080267722),
+      {  INT8_C(  95), -INT8_C(  13),  INT8_C( 122),  INT8_C(  96),  INT8_C(  90),  INT8_C(   4),  INT8_C(  35), -INT8_C(  14),
+         INT8_C(  94),  INT8_C(  83), -INT8_C(  19),  INT8_C(   0),  INT8_C(  75), -INT8_C( 113), -INT8_C(  59),  INT8_C(  89),
+        -INT8_C( 114), -INT8_C(  40),  INT8_C(  28), -INT8_C(   5),  INT8_C(  81), -INT8_C(  87),  INT8_C(  69),  INT8_C( 123),
+        -INT8_C( 105),  INT8_C(  30),  INT8_C(  86),  INT8_C(  98),  INT8_C(  15), -INT8_C( 119),  INT8_C(  85),  INT8_C( 111) },
+      {  INT8_C(   0),  INT8_C(  95),  INT8_C(   0), -INT8_C(  13),  INT8_C(   0),  INT8_C(   0),  INT8_C( 122),  INT8_C(  96),
+         INT8_C(  90),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   4),  INT8_C(  35), -INT8_C(  14),  INT8_C(  94),
+         INT8_C(  83), -INT8_C(  19),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  75),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C( 113), -INT8_C(  59),  INT8_C(   0),  INT8_C(   0),  INT8_C(  89), -INT8_C( 114), -INT8_C(  40),  INT8_C(  28) } },
+    { UINT32_C(3603943292),
+      { -INT8_C(  44), -INT8_C(  14), -INT8_C(  56),  INT8_C(  50),  INT8_C(  70), -INT8_C(  74),  INT8_C(  51), -INT8_C( 111),
+         INT8_C(  69), -INT8_C(   8), -INT8_C(  22), -INT8_C(  45), -INT8_C(  48),  INT8_C(   6), -INT8_C(  50),  INT8_C(  33),
+        -INT8_C(  80),  INT8_C(  19), -INT8_C( 100),  INT8_C(  71),  INT8_C(  49), -INT8_C(  14), -INT8_C(  87),  INT8_C(  65),
+         INT8_C( 123), -INT8_C(   1), -INT8_C(  80), -INT8_C(   8), -INT8_C(  50),      INT8_MAX, -INT8_C(  50), -INT8_C(  94) },
+      {  INT8_C(   0),  INT8_C(   0), -INT8_C(  44), -INT8_C(  14), -INT8_C(  56),  INT8_C(  50),  INT8_C(  70),  INT8_C(   0),
+        -INT8_C(  74),  INT8_C(  51), -INT8_C( 111),  INT8_C(  69),  INT8_C(   0),  INT8_C(   0), -INT8_C(   8), -INT8_C(  22),
+        -INT8_C(  45), -INT8_C(  48),  INT8_C(   6), -INT8_C(  50),  INT8_C(   0),  INT8_C(   0),  INT8_C(  33), -INT8_C(  80),
+         INT8_C(   0),  INT8_C(  19), -INT8_C( 100),  INT8_C(   0),  INT8_C(  71),  INT8_C(   0),  INT8_C(  49), -INT8_C(  14) } },
+    { UINT32_C(3084228465),
+      {  INT8_C(  77),  INT8_C(   8),  INT8_C(  72), -INT8_C( 110),  INT8_C(   0),  INT8_C(  50),  INT8_C( 101), -INT8_C(  48),
+         INT8_C(  57),  INT8_C(  51), -INT8_C(  15), -INT8_C(  23),  INT8_C(  71), -INT8_C( 115),  INT8_C(  48),  INT8_C( 120),
+             INT8_MAX, -INT8_C(  38), -INT8_C(  71), -INT8_C(   6), -INT8_C(  39),  INT8_C( 105), -INT8_C(  14), -INT8_C(  89),
+        -INT8_C(  24), -INT8_C(  63),  INT8_C(  74),  INT8_C(  90),  INT8_C(  88),  INT8_C(  31),  INT8_C(  17), -INT8_C(  91) },
+      {  INT8_C(  77),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   8),  INT8_C(  72), -INT8_C( 110),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(  50),  INT8_C( 101),  INT8_C(   0), -INT8_C(  48),  INT8_C(   0),  INT8_C(   0),  INT8_C(  57),
+         INT8_C(  51),  INT8_C(   0), -INT8_C(  15),  INT8_C(   0), -INT8_C(  23),  INT8_C(   0),  INT8_C(  71), -INT8_C( 115),
+         INT8_C(  48),  INT8_C( 120),      INT8_MAX,  INT8_C(   0), -INT8_C(  38), -INT8_C(  71),  INT8_C(   0), -INT8_C(   6) } },
+    { UINT32_C( 657938983),
+      { -INT8_C( 116), -INT8_C( 100), -INT8_C(   9), -INT8_C(  59), -INT8_C(  49), -INT8_C(  24), -INT8_C(  82),  INT8_C(  22),
+         INT8_C( 117), -INT8_C(  33), -INT8_C( 113), -INT8_C(  12), -INT8_C(  71),  INT8_C(  72), -INT8_C(  18), -INT8_C( 110),
+        -INT8_C(  78), -INT8_C(  31),  INT8_C(  57), -INT8_C( 102), -INT8_C(  94), -INT8_C( 125), -INT8_C(  12), -INT8_C(   6),
+        -INT8_C(  94),  INT8_C(   6), -INT8_C(  97), -INT8_C(  55),  INT8_C(  96), -INT8_C(  42), -INT8_C(  16), -INT8_C(  20) },
+      { -INT8_C( 116), -INT8_C( 100), -INT8_C(   9),  INT8_C(   0),  INT8_C(   0), -INT8_C(  59),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0), -INT8_C(  49),  INT8_C(   0), -INT8_C(  24), -INT8_C(  82),  INT8_C(   0),  INT8_C(  22),  INT8_C(   0),
+         INT8_C( 117), -INT8_C(  33), -INT8_C( 113),  INT8_C(   0), -INT8_C(  12), -INT8_C(  71),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  72), -INT8_C(  18), -INT8_C( 110),  INT8_C(   0),  INT8_C(   0), -INT8_C(  78),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(1102243698),
+      { -INT8_C(  49),  INT8_C(  96),  INT8_C(  88),  INT8_C(  68),  INT8_C(  63), -INT8_C(  25),  INT8_C(  56), -INT8_C(   8),
+         INT8_C(  47),  INT8_C(  39), -INT8_C( 118), -INT8_C(  31),  INT8_C(   8), -INT8_C(  60),  INT8_C( 124), -INT8_C(  86),
+         INT8_C(  71),  INT8_C( 112), -INT8_C(  92), -INT8_C(  22),  INT8_C( 118),  INT8_C(  67), -INT8_C(  77), -INT8_C(  42),
+         INT8_C(  25), -INT8_C(  92), -INT8_C(  61), -INT8_C( 117), -INT8_C( 117),  INT8_C( 117), -INT8_C(  52),  INT8_C(  91) },
+      {  INT8_C(   0), -INT8_C(  49),  INT8_C(   0),  INT8_C(   0),  INT8_C(  96),  INT8_C(  88),  INT8_C(  68),  INT8_C(   0),
+         INT8_C(  63), -INT8_C(  25),  INT8_C(  56),  INT8_C(   0),  INT8_C(   0), -INT8_C(   8),  INT8_C(  47),  INT8_C(  39),
+         INT8_C(   0), -INT8_C( 118),  INT8_C(   0),  INT8_C(   0), -INT8_C(  31),  INT8_C(   8),  INT8_C(   0), -INT8_C(  60),
+         INT8_C( 124),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  86),  INT8_C(   0) } },
+    { UINT32_C( 362751189),
+      {  INT8_C(  11), -INT8_C(  40),  INT8_C(  13),  INT8_C(  59), -INT8_C(   1), -INT8_C( 104),  INT8_C(  28),  INT8_C(   7),
+         INT8_C(  92), -INT8_C( 104), -INT8_C(  79), -INT8_C(  93),  INT8_C(   9),  INT8_C(  85), -INT8_C( 115),      INT8_MAX,
+        -INT8_C( 104),  INT8_C(  65),  INT8_C(  86), -INT8_C(  79), -INT8_C(  27),  INT8_C(  25),  INT8_C(  60),  INT8_C( 112),
+        -INT8_C( 114),  INT8_C(   8), -INT8_C(  53),  INT8_C(  99),  INT8_C(  45),  INT8_C( 107),  INT8_C( 120),  INT8_C(  56) },
+      {  INT8_C(  11),  INT8_C(   0), -INT8_C(  40),  INT8_C(   0),  INT8_C(  13),  INT8_C(   0),  INT8_C(  59), -INT8_C(   1),
+         INT8_C(   0),  INT8_C(   0), -INT8_C( 104),  INT8_C(   0),  INT8_C(   0),  INT8_C(  28),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   7),  INT8_C(  92), -INT8_C( 104), -INT8_C(  79), -INT8_C(  93),  INT8_C(   0),  INT8_C(   0),  INT8_C(   9),
+         INT8_C(  85),  INT8_C(   0), -INT8_C( 115),  INT8_C(   0),      INT8_MAX,  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(1114867267),
+      {  INT8_C(  30), -INT8_C( 112),  INT8_C(  73),  INT8_C( 122),  INT8_C(  40), -INT8_C(   6),  INT8_C(  29),  INT8_C(  49),
+         INT8_C(  79), -INT8_C(  85), -INT8_C(  79), -INT8_C(  25), -INT8_C(  20),  INT8_C(   7), -INT8_C( 104), -INT8_C(  47),
+         INT8_C(  32), -INT8_C(  44),  INT8_C(  65), -INT8_C(  82), -INT8_C(  36),  INT8_C(  13),  INT8_C(  17),  INT8_C(   9),
+         INT8_C( 120), -INT8_C( 118),  INT8_C(  66), -INT8_C(  69),  INT8_C(  16), -INT8_C(  75), -INT8_C(   3),  INT8_C(  46) },
+      {  INT8_C(  30), -INT8_C( 112),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  73),  INT8_C(   0),
+         INT8_C(   0),  INT8_C( 122),  INT8_C(  40),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   6),
+         INT8_C(  29),  INT8_C(  49),  INT8_C(   0),  INT8_C(   0),  INT8_C(  79), -INT8_C(  85), -INT8_C(  79),  INT8_C(   0),
+         INT8_C(   0), -INT8_C(  25),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  20),  INT8_C(   0) } },
+    { UINT32_C(1856521797),
+      {  INT8_C(  64), -INT8_C(  59), -INT8_C(  97), -INT8_C( 113),  INT8_C( 112),  INT8_C(  80),  INT8_C( 118),  INT8_C(  92),
+         INT8_C(  87),  INT8_C(  14),  INT8_C(  45),  INT8_C( 119), -INT8_C(  30),  INT8_C( 111),  INT8_C(  37), -INT8_C(  66),
+         INT8_C( 124),  INT8_C(  55), -INT8_C(  56), -INT8_C(  12), -INT8_C(  63),  INT8_C(  10), -INT8_C(  81), -INT8_C(  47),
+        -INT8_C(  65), -INT8_C(  84), -INT8_C(   1),  INT8_C(   5), -INT8_C(  14), -INT8_C(  89),  INT8_C( 115),  INT8_C(  50) },
+      {  INT8_C(  64),  INT8_C(   0), -INT8_C(  59),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  97),  INT8_C(   0),
+         INT8_C(   0), -INT8_C( 113),  INT8_C( 112),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  80),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 118),  INT8_C(   0),  INT8_C(  92),  INT8_C(   0),  INT8_C(  87),
+         INT8_C(   0),  INT8_C(  14),  INT8_C(  45),  INT8_C( 119),  INT8_C(   0), -INT8_C(  30),  INT8_C( 111),  INT8_C(   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i r = simde_mm256_maskz_expandloadu_epi8(test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_i8x32(r, simde_x_mm256_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask32 k = simde_test_x86_random_mmask32();
+    simde__m256i a = simde_test_x86_random_i8x32();
+    simde__m256i r = simde_mm256_maskz_expandloadu_epi8(k, &a);
+
+    simde_test_x86_write_mmask32(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i8x32(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_mask_expand_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int16_t src[16];
+    const simde__mmask16 k;
+    const int16_t a[16];
+    const int16_t r[16];
+  } test_vec[] = {
+    { {  INT16_C(  4716), -INT16_C(  8767),  INT16_C( 14179), -INT16_C( 17863),  INT16_C( 26437),  INT16_C( 10034),  INT16_C( 22486),  INT16_C( 21221),
+        -INT16_C( 21106),  INT16_C( 20294), -INT16_C(  2633),  INT16_C( 30496),  INT16_C(  8097), -INT16_C( 27780), -INT16_C(  4154),  INT16_C( 13253) },
+      UINT16_C(34305),
+      {  INT16_C( 25616),  INT16_C( 18877),  INT16_C(   543),  INT16_C( 20912), -INT16_C( 31191),  INT16_C(  3752),  INT16_C( 14296),  INT16_C(  7868),
+         INT16_C( 29574), -INT16_C( 22765), -INT16_C( 19222),  INT16_C( 26310), -INT16_C( 29369),  INT16_C(  3157),  INT16_C( 22464), -INT16_C( 12142) },
+      {  INT16_C( 25616), -INT16_C(  8767),  INT16_C( 14179), -INT16_C( 17863),  INT16_C( 26437),  INT16_C( 10034),  INT16_C( 22486),  INT16_C( 21221),
+        -INT16_C( 21106),  INT16_C( 18877),  INT16_C(   543),  INT16_C( 30496),  INT16_C(  8097), -INT16_C( 27780), -INT16_C(  4154),  INT16_C( 20912) } },
+    { {  INT16_C( 20411), -INT16_C(  9703), -INT16_C( 13743),  INT16_C( 31275), -INT16_C( 11184),  INT16_C( 10633),  INT16_C( 17675), -INT16_C( 28345),
+         INT16_C( 23480), -INT16_C( 23752), -INT16_C(   241),  INT16_C( 22281),  INT16_C( 24460),  INT16_C( 19555), -INT16_C(  2378),  INT16_C( 28956) },
+      UINT16_C(13637),
+      { -INT16_C( 26804),  INT16_C( 30719),  INT16_C( 20497), -INT16_C( 26037),  INT16_C( 22137), -INT16_C( 16161), -INT16_C( 26392),  INT16_C(  8219),
+         INT16_C( 11067),  INT16_C( 17439), -INT16_C( 21630), -INT16_C(  6749),  INT16_C( 23031),  INT16_C(  5083),  INT16_C(  8651),  INT16_C(  5961) },
+      { -INT16_C( 26804), -INT16_C(  9703),  INT16_C( 30719),  INT16_C( 31275), -INT16_C( 11184),  INT16_C( 10633),  INT16_C( 20497), -INT16_C( 28345),
+        -INT16_C( 26037), -INT16_C( 23752),  INT16_C( 22137),  INT16_C( 22281), -INT16_C( 16161), -INT16_C( 26392), -INT16_C(  2378),  INT16_C( 28956) } },
+    { {  INT16_C( 18616), -INT16_C( 13938), -INT16_C(  9576),  INT16_C(  4452),  INT16_C( 17200),  INT16_C(  6354), -INT16_C(  4645),  INT16_C(  5689),
+         INT16_C( 22552), -INT16_C( 26021), -INT16_C(   508), -INT16_C(  1152),  INT16_C( 23384),  INT16_C(  8975),  INT16_C( 22652),  INT16_C( 13370) },
+      UINT16_C(51360),
+      {  INT16_C( 14846),  INT16_C( 25250), -INT16_C( 11446),  INT16_C(  7333), -INT16_C( 32277),  INT16_C(  9226),  INT16_C(  8855), -INT16_C(  3459),
+        -INT16_C( 32323),  INT16_C( 15857),  INT16_C( 18812), -INT16_C( 29800),  INT16_C(  5484), -INT16_C( 22813), -INT16_C( 31671),  INT16_C( 18286) },
+      {  INT16_C( 18616), -INT16_C( 13938), -INT16_C(  9576),  INT16_C(  4452),  INT16_C( 17200),  INT16_C( 14846), -INT16_C(  4645),  INT16_C( 25250),
+         INT16_C( 22552), -INT16_C( 26021), -INT16_C(   508), -INT16_C( 11446),  INT16_C( 23384),  INT16_C(  8975),  INT16_C(  7333), -INT16_C( 32277) } },
+    { {  INT16_C(  4541),  INT16_C(  1961),  INT16_C( 20452), -INT16_C( 12508),  INT16_C( 11984),  INT16_C( 26612),  INT16_C( 29008),  INT16_C(  3418),
+         INT16_C( 19442),  INT16_C( 28234), -INT16_C(  7276),  INT16_C(   250), -INT16_C(  8712),  INT16_C( 16806),  INT16_C(  5217),  INT16_C(  7817) },
+      UINT16_C(12837),
+      {  INT16_C(  2342),  INT16_C( 19073),  INT16_C( 20953), -INT16_C( 12936), -INT16_C( 14151),  INT16_C(  4926),  INT16_C( 12502),  INT16_C(  8286),
+        -INT16_C(  3426), -INT16_C( 26621), -INT16_C(  1038), -INT16_C( 26506), -INT16_C( 10435), -INT16_C( 14676), -INT16_C( 11530),  INT16_C(  7416) },
+      {  INT16_C(  2342),  INT16_C(  1961),  INT16_C( 19073), -INT16_C( 12508),  INT16_C( 11984),  INT16_C( 20953),  INT16_C( 29008),  INT16_C(  3418),
+         INT16_C( 19442), -INT16_C( 12936), -INT16_C(  7276),  INT16_C(   250), -INT16_C( 14151),  INT16_C(  4926),  INT16_C(  5217),  INT16_C(  7817) } },
+    { {  INT16_C( 31451), -INT16_C( 19354), -INT16_C(  8501), -INT16_C( 31615), -INT16_C( 16474),  INT16_C( 31895), -INT16_C(  2577), -INT16_C( 29027),
+        -INT16_C( 24345), -INT16_C(  9946), -INT16_C( 25444), -INT16_C(  9871),  INT16_C(  7796),  INT16_C( 27295), -INT16_C( 26640), -INT16_C( 13434) },
+      UINT16_C(60433),
+      { -INT16_C(  8832),  INT16_C(   458),  INT16_C( 28769), -INT16_C(  1599), -INT16_C( 20243), -INT16_C( 29970), -INT16_C( 10690),  INT16_C( 25898),
+        -INT16_C( 14673),  INT16_C(  8449),  INT16_C( 30111),  INT16_C( 15935),  INT16_C( 12255),  INT16_C( 26070), -INT16_C(  6150),  INT16_C( 31313) },
+      { -INT16_C(  8832), -INT16_C( 19354), -INT16_C(  8501), -INT16_C( 31615),  INT16_C(   458),  INT16_C( 31895), -INT16_C(  2577), -INT16_C( 29027),
+        -INT16_C( 24345), -INT16_C(  9946),  INT16_C( 28769), -INT16_C(  1599),  INT16_C(  7796), -INT16_C( 20243), -INT16_C( 29970), -INT16_C( 10690) } },
+    { {  INT16_C(  7108),  INT16_C(  9852),  INT16_C( 15756),  INT16_C( 31007),  INT16_C(  3565),  INT16_C( 11267),  INT16_C( 11747), -INT16_C( 27759),
+        -INT16_C( 27916), -INT16_C( 27724), -INT16_C(  3320), -INT16_C(  6190), -INT16_C( 22494),  INT16_C(  7245), -INT16_C( 24945),  INT16_C( 21655) },
+      UINT16_C( 5050),
+      {  INT16_C( 18042), -INT16_C( 26288),  INT16_C( 15807), -INT16_C( 15706), -INT16_C( 30103), -INT16_C(  1297), -INT16_C(  7395), -INT16_C( 11891),
+        -INT16_C( 27273),  INT16_C( 18884), -INT16_C(  6532), -INT16_C( 13839), -INT16_C( 32766), -INT16_C( 26264),  INT16_C(  8916),  INT16_C( 20140) },
+      {  INT16_C(  7108),  INT16_C( 18042),  INT16_C( 15756), -INT16_C( 26288),  INT16_C( 15807), -INT16_C( 15706),  INT16_C( 11747), -INT16_C( 30103),
+        -INT16_C(  1297), -INT16_C(  7395), -INT16_C(  3320), -INT16_C(  6190), -INT16_C( 11891),  INT16_C(  7245), -INT16_C( 24945),  INT16_C( 21655) } },
+    { { -INT16_C(   920),  INT16_C( 10215), -INT16_C( 29126), -INT16_C( 23575), -INT16_C( 10216),  INT16_C( 13726),  INT16_C( 11196),  INT16_C( 13062),
+        -INT16_C( 13632),  INT16_C( 15484),  INT16_C( 28080), -INT16_C( 19962),  INT16_C( 28397), -INT16_C( 15796), -INT16_C(  1904), -INT16_C(  2032) },
+      UINT16_C(63733),
+      {  INT16_C( 12063),  INT16_C(  2182), -INT16_C( 24878),  INT16_C( 28896), -INT16_C( 25389), -INT16_C(  9829),  INT16_C( 23503),  INT16_C( 19363),
+         INT16_C( 21400), -INT16_C( 24904), -INT16_C( 23035),  INT16_C( 20748), -INT16_C( 25496),  INT16_C( 30794),  INT16_C( 16276), -INT16_C( 19600) },
+      {  INT16_C( 12063),  INT16_C( 10215),  INT16_C(  2182), -INT16_C( 23575), -INT16_C( 24878),  INT16_C( 28896), -INT16_C( 25389), -INT16_C(  9829),
+        -INT16_C( 13632),  INT16_C( 15484),  INT16_C( 28080),  INT16_C( 23503),  INT16_C( 19363),  INT16_C( 21400), -INT16_C( 24904), -INT16_C( 23035) } },
+    { { -INT16_C(  2450),  INT16_C( 16571), -INT16_C( 25708),  INT16_C( 26545),  INT16_C( 19512),  INT16_C(  1856), -INT16_C(  7256),  INT16_C( 16467),
+         INT16_C(  2870),  INT16_C( 15582), -INT16_C(  5455),  INT16_C(  6541), -INT16_C( 10362),  INT16_C(  6802),  INT16_C(   534), -INT16_C( 31539) },
+      UINT16_C(35065),
+      { -INT16_C( 29243),  INT16_C( 30243),  INT16_C( 23541),  INT16_C( 13762),  INT16_C( 27235), -INT16_C( 18919),  INT16_C( 20394), -INT16_C( 30527),
+         INT16_C( 29579),  INT16_C(  6514), -INT16_C(  1908),  INT16_C(  7920),  INT16_C(  1810), -INT16_C(  8415),  INT16_C(  6795),  INT16_C( 20583) },
+      { -INT16_C( 29243),  INT16_C( 16571), -INT16_C( 25708),  INT16_C( 30243),  INT16_C( 23541),  INT16_C( 13762),  INT16_C( 27235), -INT16_C( 18919),
+         INT16_C(  2870),  INT16_C( 15582), -INT16_C(  5455),  INT16_C( 20394), -INT16_C( 10362),  INT16_C(  6802),  INT16_C(   534), -INT16_C( 30527) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi16(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256i r = simde_mm256_mask_expand_epi16(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x16(r, simde_x_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m256i src = simde_test_x86_random_i16x16();
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m256i a = simde_test_x86_random_i16x16();
+    simde__m256i r = simde_mm256_mask_expand_epi16(src, k, a);
+
+    simde_test_x86_write_i16x16(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i16x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i16x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_maskz_expand_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask16 k;
+    const int16_t a[16];
+    const int16_t r[16];
+  } test_vec[] = {
+    { UINT16_C(35751),
+      { -INT16_C( 25402), -INT16_C( 30234),  INT16_C( 18898), -INT16_C(  5133), -INT16_C( 24833), -INT16_C( 16070), -INT16_C( 14810), -INT16_C( 26316),
+        -INT16_C( 16161), -INT16_C( 12399), -INT16_C( 23329),  INT16_C(   214),  INT16_C( 25219), -INT16_C(  5350), -INT16_C( 15950),  INT16_C( 31094) },
+      { -INT16_C( 25402), -INT16_C( 30234),  INT16_C( 18898),  INT16_C(     0),  INT16_C(     0), -INT16_C(  5133),  INT16_C(     0), -INT16_C( 24833),
+        -INT16_C( 16070), -INT16_C( 14810),  INT16_C(     0), -INT16_C( 26316),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 16161) } },
+    { UINT16_C(23646),
+      {  INT16_C( 12290), -INT16_C(  2650), -INT16_C( 23269),  INT16_C( 21907), -INT16_C( 17818), -INT16_C( 26085), -INT16_C(  1453), -INT16_C(  7077),
+         INT16_C( 15050), -INT16_C( 24440),  INT16_C(  3130),  INT16_C( 21506), -INT16_C( 18953),  INT16_C( 27925),  INT16_C( 29486),  INT16_C( 12489) },
+      {  INT16_C(     0),  INT16_C( 12290), -INT16_C(  2650), -INT16_C( 23269),  INT16_C( 21907),  INT16_C(     0), -INT16_C( 17818),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0), -INT16_C( 26085), -INT16_C(  1453), -INT16_C(  7077),  INT16_C(     0),  INT16_C( 15050),  INT16_C(     0) } },
+    { UINT16_C(28579),
+      { -INT16_C( 16859), -INT16_C( 18155),  INT16_C( 31508),  INT16_C( 12147), -INT16_C( 14826),  INT16_C( 28970), -INT16_C(  2902),  INT16_C( 13227),
+        -INT16_C(  6764), -INT16_C( 26817),  INT16_C( 13881),  INT16_C( 20044),  INT16_C( 31395),  INT16_C( 27842),  INT16_C( 26026), -INT16_C( 12324) },
+      { -INT16_C( 16859), -INT16_C( 18155),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 31508),  INT16_C(     0),  INT16_C( 12147),
+        -INT16_C( 14826),  INT16_C( 28970), -INT16_C(  2902),  INT16_C( 13227),  INT16_C(     0), -INT16_C(  6764), -INT16_C( 26817),  INT16_C(     0) } },
+    { UINT16_C(61732),
+      {  INT16_C( 14472), -INT16_C(  1172), -INT16_C( 32153), -INT16_C( 28223),  INT16_C( 27891), -INT16_C( 24955),  INT16_C(  6815), -INT16_C(  8573),
+        -INT16_C( 17231), -INT16_C(   748), -INT16_C( 18677), -INT16_C( 12937),  INT16_C(  8483), -INT16_C(   206),  INT16_C( 22256),  INT16_C( 31216) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C( 14472),  INT16_C(     0),  INT16_C(     0), -INT16_C(  1172),  INT16_C(     0),  INT16_C(     0),
+        -INT16_C( 32153),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 28223),  INT16_C( 27891), -INT16_C( 24955),  INT16_C(  6815) } },
+    { UINT16_C(23950),
+      { -INT16_C(  2444),  INT16_C( 14047), -INT16_C( 11385),  INT16_C(  3490),  INT16_C( 16753), -INT16_C(  2777), -INT16_C( 10209),  INT16_C( 13233),
+        -INT16_C( 17195),  INT16_C( 19690),  INT16_C(  3465), -INT16_C( 17299),  INT16_C( 23821), -INT16_C(   750), -INT16_C( 24106),  INT16_C( 19290) },
+      {  INT16_C(     0), -INT16_C(  2444),  INT16_C( 14047), -INT16_C( 11385),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  3490),
+         INT16_C( 16753),  INT16_C(     0), -INT16_C(  2777), -INT16_C( 10209),  INT16_C( 13233),  INT16_C(     0), -INT16_C( 17195),  INT16_C(     0) } },
+    { UINT16_C(14999),
+      {  INT16_C(  7809),  INT16_C(  8973),  INT16_C( 32299),  INT16_C( 21092), -INT16_C( 31885),  INT16_C(  9514), -INT16_C(    74), -INT16_C( 24351),
+         INT16_C( 27467), -INT16_C( 18259), -INT16_C( 17881),  INT16_C( 14614), -INT16_C(  4936),  INT16_C(  4826),  INT16_C( 28983), -INT16_C( 18356) },
+      {  INT16_C(  7809),  INT16_C(  8973),  INT16_C( 32299),  INT16_C(     0),  INT16_C( 21092),  INT16_C(     0),  INT16_C(     0), -INT16_C( 31885),
+         INT16_C(     0),  INT16_C(  9514),  INT16_C(     0), -INT16_C(    74), -INT16_C( 24351),  INT16_C( 27467),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(22928),
+      { -INT16_C( 17445),  INT16_C( 16344),  INT16_C( 19214),  INT16_C( 14530),  INT16_C( 30832),  INT16_C( 21048), -INT16_C( 31976), -INT16_C( 14659),
+        -INT16_C(  7108),  INT16_C( 21120),  INT16_C( 14365), -INT16_C(  1986),  INT16_C( 30283), -INT16_C( 26775), -INT16_C(  1746),  INT16_C(  2801) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 17445),  INT16_C(     0),  INT16_C(     0),  INT16_C( 16344),
+         INT16_C( 19214),  INT16_C(     0),  INT16_C(     0),  INT16_C( 14530),  INT16_C( 30832),  INT16_C(     0),  INT16_C( 21048),  INT16_C(     0) } },
+    { UINT16_C(51637),
+      { -INT16_C( 15543),  INT16_C(  3092), -INT16_C( 31237),  INT16_C( 13188), -INT16_C( 25129), -INT16_C( 27465), -INT16_C(  3229), -INT16_C(  7304),
+        -INT16_C( 27323), -INT16_C( 31972),  INT16_C( 26509), -INT16_C(  2055),  INT16_C( 10494), -INT16_C(  4112), -INT16_C( 23246),  INT16_C( 31672) },
+      { -INT16_C( 15543),  INT16_C(     0),  INT16_C(  3092),  INT16_C(     0), -INT16_C( 31237),  INT16_C( 13188),  INT16_C(     0), -INT16_C( 25129),
+        -INT16_C( 27465),  INT16_C(     0),  INT16_C(     0), -INT16_C(  3229),  INT16_C(     0),  INT16_C(     0), -INT16_C(  7304), -INT16_C( 27323) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256i r = simde_mm256_maskz_expand_epi16(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x16(r, simde_x_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m256i a = simde_test_x86_random_i16x16();
+    simde__m256i r = simde_mm256_maskz_expand_epi16(k, a);
+
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i16x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i16x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_mask_expandloadu_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int16_t src[16];
+    const simde__mmask16 k;
+    const int16_t a[16];
+    const int16_t r[16];
+  } test_vec[] = {
+    { { -INT16_C( 12952),  INT16_C( 25735),  INT16_C(  3154),  INT16_C( 10647),  INT16_C( 20137),  INT16_C(  3261),  INT16_C( 13633), -INT16_C( 30993),
+         INT16_C(  3018),  INT16_C( 22538),  INT16_C(   882),  INT16_C( 29007),  INT16_C( 16171),  INT16_C( 23904),  INT16_C(  6629),  INT16_C( 19929) },
+      UINT16_C(24806),
+      {  INT16_C( 14513),  INT16_C( 18796),  INT16_C(  5473),  INT16_C(  7831), -INT16_C(  9951),  INT16_C(  4435),  INT16_C(  7519),  INT16_C( 26908),
+        -INT16_C( 28811), -INT16_C( 15251), -INT16_C( 26624),  INT16_C( 24580), -INT16_C(  5642), -INT16_C( 12423),  INT16_C( 24374), -INT16_C(  6097) },
+      { -INT16_C( 12952),  INT16_C( 14513),  INT16_C( 18796),  INT16_C( 10647),  INT16_C( 20137),  INT16_C(  5473),  INT16_C(  7831), -INT16_C(  9951),
+         INT16_C(  3018),  INT16_C( 22538),  INT16_C(   882),  INT16_C( 29007),  INT16_C( 16171),  INT16_C(  4435),  INT16_C(  7519),  INT16_C( 19929) } },
+    { { -INT16_C( 25449), -INT16_C(  1999), -INT16_C( 14159), -INT16_C( 11498),  INT16_C( 27041),  INT16_C(   484),  INT16_C(   135), -INT16_C(   918),
+        -INT16_C( 10353), -INT16_C( 28735), -INT16_C( 14992),  INT16_C( 26352),  INT16_C( 27054), -INT16_C(  7115),  INT16_C( 25801),  INT16_C( 24780) },
+      UINT16_C(64768),
+      { -INT16_C( 19879),  INT16_C( 28614),  INT16_C( 26501),  INT16_C( 27097),  INT16_C( 24680), -INT16_C( 11415), -INT16_C(  1700),  INT16_C(  7594),
+         INT16_C(  6792),  INT16_C( 30946), -INT16_C( 28544), -INT16_C( 18974), -INT16_C( 21643),  INT16_C( 16666),  INT16_C(  6667),  INT16_C( 25663) },
+      { -INT16_C( 25449), -INT16_C(  1999), -INT16_C( 14159), -INT16_C( 11498),  INT16_C( 27041),  INT16_C(   484),  INT16_C(   135), -INT16_C(   918),
+        -INT16_C( 19879), -INT16_C( 28735),  INT16_C( 28614),  INT16_C( 26501),  INT16_C( 27097),  INT16_C( 24680), -INT16_C( 11415), -INT16_C(  1700) } },
+    { {  INT16_C(  1484),  INT16_C( 20948), -INT16_C( 21140), -INT16_C( 10822),  INT16_C(  9229),  INT16_C( 27048),  INT16_C( 21021), -INT16_C( 23161),
+         INT16_C( 26989), -INT16_C(  4834),  INT16_C(   250),  INT16_C( 28579), -INT16_C( 16981), -INT16_C( 18768), -INT16_C(  4137), -INT16_C( 23525) },
+      UINT16_C(61428),
+      {  INT16_C( 25077), -INT16_C( 20324), -INT16_C( 22218), -INT16_C(  8492), -INT16_C(  3822), -INT16_C( 26320), -INT16_C( 25194), -INT16_C( 19453),
+        -INT16_C(   629),  INT16_C( 11956),  INT16_C( 24428),  INT16_C(  7403), -INT16_C( 15850),  INT16_C( 12556),  INT16_C(   102),  INT16_C( 23584) },
+      {  INT16_C(  1484),  INT16_C( 20948),  INT16_C( 25077), -INT16_C( 10822), -INT16_C( 20324), -INT16_C( 22218), -INT16_C(  8492), -INT16_C(  3822),
+        -INT16_C( 26320), -INT16_C( 25194), -INT16_C( 19453), -INT16_C(   629), -INT16_C( 16981),  INT16_C( 11956),  INT16_C( 24428),  INT16_C(  7403) } },
+    { { -INT16_C( 17311), -INT16_C( 26868), -INT16_C(  8091),  INT16_C( 30581), -INT16_C( 22831),  INT16_C( 26385),  INT16_C(  5187), -INT16_C( 12772),
+        -INT16_C( 12271),  INT16_C( 32252), -INT16_C(  6352),  INT16_C( 18073), -INT16_C( 23126),  INT16_C(  4215), -INT16_C( 26714),  INT16_C(  1900) },
+      UINT16_C(30803),
+      { -INT16_C( 18273),  INT16_C(  5208),  INT16_C( 10543),  INT16_C( 16570), -INT16_C(   367), -INT16_C( 21164),  INT16_C( 26060), -INT16_C( 13955),
+        -INT16_C( 21022),  INT16_C( 31920),  INT16_C( 23283),  INT16_C( 27169), -INT16_C( 14485), -INT16_C( 10495),  INT16_C( 21711),  INT16_C( 28240) },
+      { -INT16_C( 18273),  INT16_C(  5208), -INT16_C(  8091),  INT16_C( 30581),  INT16_C( 10543),  INT16_C( 26385),  INT16_C( 16570), -INT16_C( 12772),
+        -INT16_C( 12271),  INT16_C( 32252), -INT16_C(  6352), -INT16_C(   367), -INT16_C( 21164),  INT16_C( 26060), -INT16_C( 13955),  INT16_C(  1900) } },
+    { { -INT16_C( 22516),  INT16_C( 15490),  INT16_C( 15826),  INT16_C( 25468), -INT16_C( 11973),  INT16_C(  1808), -INT16_C( 29386),  INT16_C(  6608),
+        -INT16_C( 32453),  INT16_C( 11925), -INT16_C( 18725),  INT16_C( 18073), -INT16_C( 25986),  INT16_C( 19742),  INT16_C( 28399), -INT16_C(  1093) },
+      UINT16_C(15638),
+      { -INT16_C(  6089), -INT16_C( 19334), -INT16_C( 19125),  INT16_C( 23429), -INT16_C( 17475), -INT16_C( 29207),  INT16_C(  9428),  INT16_C( 26894),
+        -INT16_C(  5550), -INT16_C(  5344), -INT16_C( 25040),  INT16_C( 20102),  INT16_C( 30187), -INT16_C( 22852), -INT16_C( 11408), -INT16_C( 22301) },
+      { -INT16_C( 22516), -INT16_C(  6089), -INT16_C( 19334),  INT16_C( 25468), -INT16_C( 19125),  INT16_C(  1808), -INT16_C( 29386),  INT16_C(  6608),
+         INT16_C( 23429),  INT16_C( 11925), -INT16_C( 17475), -INT16_C( 29207),  INT16_C(  9428),  INT16_C( 26894),  INT16_C( 28399), -INT16_C(  1093) } },
+    { {  INT16_C( 24251),  INT16_C(  1884), -INT16_C(  7917), -INT16_C( 12190),  INT16_C( 19356),  INT16_C( 29022),  INT16_C( 27759), -INT16_C( 15654),
+        -INT16_C(  1450), -INT16_C( 30803),  INT16_C( 13208), -INT16_C( 31787), -INT16_C( 27992),  INT16_C(  6441),  INT16_C(  3429),  INT16_C(  8385) },
+      UINT16_C( 7531),
+      {  INT16_C( 32295), -INT16_C( 29954), -INT16_C( 26033), -INT16_C( 21035),  INT16_C( 17675), -INT16_C(  6631),  INT16_C( 28679), -INT16_C( 19232),
+         INT16_C( 31223), -INT16_C( 13080), -INT16_C( 28420),  INT16_C(  9822), -INT16_C( 15447),  INT16_C( 27187), -INT16_C( 24860),  INT16_C(  2951) },
+      {  INT16_C( 32295), -INT16_C( 29954), -INT16_C(  7917), -INT16_C( 26033),  INT16_C( 19356), -INT16_C( 21035),  INT16_C( 17675), -INT16_C( 15654),
+        -INT16_C(  6631), -INT16_C( 30803),  INT16_C( 28679), -INT16_C( 19232),  INT16_C( 31223),  INT16_C(  6441),  INT16_C(  3429),  INT16_C(  8385) } },
+    { { -INT16_C( 31460),  INT16_C( 27541),  INT16_C( 27424),  INT16_C( 11032),  INT16_C( 12976), -INT16_C( 18671), -INT16_C(  3422), -INT16_C( 26261),
+         INT16_C( 21355),  INT16_C( 26469), -INT16_C( 15132), -INT16_C( 29299), -INT16_C( 16249),  INT16_C( 27640),  INT16_C( 32606),  INT16_C( 31607) },
+      UINT16_C( 3077),
+      {  INT16_C(  9702), -INT16_C(   137),  INT16_C( 10064),  INT16_C( 25137), -INT16_C( 11298),  INT16_C( 19028), -INT16_C( 16532), -INT16_C( 11875),
+        -INT16_C( 32474), -INT16_C( 19307),  INT16_C(  7439),  INT16_C(  1908), -INT16_C( 11384), -INT16_C(   122), -INT16_C( 29874),  INT16_C( 13324) },
+      {  INT16_C(  9702),  INT16_C( 27541), -INT16_C(   137),  INT16_C( 11032),  INT16_C( 12976), -INT16_C( 18671), -INT16_C(  3422), -INT16_C( 26261),
+         INT16_C( 21355),  INT16_C( 26469),  INT16_C( 10064),  INT16_C( 25137), -INT16_C( 16249),  INT16_C( 27640),  INT16_C( 32606),  INT16_C( 31607) } },
+    { { -INT16_C( 31824),  INT16_C(   307),  INT16_C( 25771), -INT16_C( 30365), -INT16_C( 18633), -INT16_C( 23597),  INT16_C( 29046), -INT16_C( 25483),
+         INT16_C(  2802),  INT16_C(   336), -INT16_C( 15065), -INT16_C( 20472), -INT16_C( 28776), -INT16_C(  6481), -INT16_C( 17638), -INT16_C( 13542) },
+      UINT16_C(20031),
+      { -INT16_C(  5428),  INT16_C( 12210), -INT16_C(  5517),  INT16_C( 18406),  INT16_C( 23693),  INT16_C(   696), -INT16_C( 21768),  INT16_C( 18701),
+         INT16_C( 13484), -INT16_C( 19442), -INT16_C( 22812), -INT16_C( 27581),  INT16_C( 24204), -INT16_C( 22961), -INT16_C( 29143), -INT16_C(  2572) },
+      { -INT16_C(  5428),  INT16_C( 12210), -INT16_C(  5517),  INT16_C( 18406),  INT16_C( 23693),  INT16_C(   696),  INT16_C( 29046), -INT16_C( 25483),
+         INT16_C(  2802), -INT16_C( 21768),  INT16_C( 18701),  INT16_C( 13484), -INT16_C( 28776), -INT16_C(  6481), -INT16_C( 19442), -INT16_C( 13542) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi16(test_vec[i].src);
+    simde__m256i r = simde_mm256_mask_expandloadu_epi16(src, test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_i16x16(r, simde_x_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m256i src = simde_test_x86_random_i16x16();
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m256i a = simde_test_x86_random_i16x16();
+    simde__m256i r = simde_mm256_mask_expandloadu_epi16(src, k, &a);
+
+    simde_test_x86_write_i16x16(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i16x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i16x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_maskz_expandloadu_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask16 k;
+    const int16_t a[16];
+    const int16_t r[16];
+  } test_vec[] = {
+    { UINT16_C(42872),
+      { -INT16_C(  5084),  INT16_C(  2705),  INT16_C(  7731), -INT16_C(  5274),  INT16_C( 24097),  INT16_C( 11925),  INT16_C( 16807), -INT16_C( 19102),
+         INT16_C( 18422),  INT16_C( 14683), -INT16_C(  6181),  INT16_C( 10903), -INT16_C( 16242), -INT16_C( 32071),  INT16_C( 12725), -INT16_C(  9943) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  5084),  INT16_C(  2705),  INT16_C(  7731), -INT16_C(  5274),  INT16_C(     0),
+         INT16_C( 24097),  INT16_C( 11925),  INT16_C( 16807),  INT16_C(     0),  INT16_C(     0), -INT16_C( 19102),  INT16_C(     0),  INT16_C( 18422) } },
+    { UINT16_C(47645),
+      {  INT16_C( 20707),  INT16_C( 18905), -INT16_C(  1477), -INT16_C( 11864),  INT16_C( 20264), -INT16_C( 30190),  INT16_C(  2053),  INT16_C( 24785),
+        -INT16_C( 21438), -INT16_C(  9912), -INT16_C( 10537), -INT16_C( 28518),  INT16_C( 20312), -INT16_C( 32063), -INT16_C(  8407),  INT16_C(  3132) },
+      {  INT16_C( 20707),  INT16_C(     0),  INT16_C( 18905), -INT16_C(  1477), -INT16_C( 11864),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C( 20264),  INT16_C(     0), -INT16_C( 30190),  INT16_C(  2053),  INT16_C( 24785),  INT16_C(     0), -INT16_C( 21438) } },
+    { UINT16_C( 5423),
+      {  INT16_C( 27478), -INT16_C(   497),  INT16_C( 14140),  INT16_C( 20045),  INT16_C( 21186), -INT16_C( 27817), -INT16_C( 26189), -INT16_C(  1216),
+         INT16_C(  6002),  INT16_C(  3281),  INT16_C( 10663),  INT16_C( 26716), -INT16_C( 31317), -INT16_C(  6073),  INT16_C( 30609), -INT16_C(  6147) },
+      {  INT16_C( 27478), -INT16_C(   497),  INT16_C( 14140),  INT16_C( 20045),  INT16_C(     0),  INT16_C( 21186),  INT16_C(     0),  INT16_C(     0),
+        -INT16_C( 27817),  INT16_C(     0), -INT16_C( 26189),  INT16_C(     0), -INT16_C(  1216),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C( 3554),
+      {  INT16_C(  7909),  INT16_C( 13124),  INT16_C(  1644), -INT16_C( 15483),  INT16_C( 14490), -INT16_C(  9636), -INT16_C( 12493),  INT16_C(  1265),
+        -INT16_C( 26405),  INT16_C( 14126), -INT16_C(  9984),  INT16_C( 18620),  INT16_C( 20161), -INT16_C( 16449), -INT16_C( 24267),  INT16_C(  7116) },
+      {  INT16_C(     0),  INT16_C(  7909),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 13124),  INT16_C(  1644), -INT16_C( 15483),
+         INT16_C( 14490),  INT16_C(     0), -INT16_C(  9636), -INT16_C( 12493),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C( 4287),
+      {  INT16_C( 11086), -INT16_C( 11497), -INT16_C( 19985),  INT16_C( 19212),  INT16_C( 16267),  INT16_C( 31770), -INT16_C(  2492),  INT16_C( 29204),
+         INT16_C(  5165), -INT16_C(  5557),  INT16_C(  3420),  INT16_C(  6968),  INT16_C( 28108), -INT16_C( 26436),  INT16_C( 31624), -INT16_C( 10584) },
+      {  INT16_C( 11086), -INT16_C( 11497), -INT16_C( 19985),  INT16_C( 19212),  INT16_C( 16267),  INT16_C( 31770),  INT16_C(     0), -INT16_C(  2492),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 29204),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(49063),
+      { -INT16_C( 26966), -INT16_C( 18832), -INT16_C(  1055), -INT16_C(   779),  INT16_C( 14711), -INT16_C( 29710),  INT16_C(  8107), -INT16_C(  2144),
+        -INT16_C(  1015),  INT16_C( 16644), -INT16_C( 12264), -INT16_C( 11089),  INT16_C( 14184),  INT16_C(  4176), -INT16_C(  2290), -INT16_C( 18224) },
+      { -INT16_C( 26966), -INT16_C( 18832), -INT16_C(  1055),  INT16_C(     0),  INT16_C(     0), -INT16_C(   779),  INT16_C(     0),  INT16_C( 14711),
+        -INT16_C( 29710),  INT16_C(  8107), -INT16_C(  2144), -INT16_C(  1015),  INT16_C( 16644), -INT16_C( 12264),  INT16_C(     0), -INT16_C( 11089) } },
+    { UINT16_C(16525),
+      {  INT16_C( 28270),  INT16_C( 25404), -INT16_C( 19606),  INT16_C( 23709),  INT16_C( 18495), -INT16_C(  8324), -INT16_C( 31425),  INT16_C( 17371),
+        -INT16_C(  3129),  INT16_C( 30227),  INT16_C( 31688),  INT16_C(  6317), -INT16_C( 17524),  INT16_C( 23567), -INT16_C( 25485), -INT16_C(  7780) },
+      {  INT16_C( 28270),  INT16_C(     0),  INT16_C( 25404), -INT16_C( 19606),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 23709),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 18495),  INT16_C(     0) } },
+    { UINT16_C(55306),
+      {  INT16_C( 30021), -INT16_C(  7540), -INT16_C( 13359),  INT16_C( 19754),  INT16_C( 27306), -INT16_C( 31277), -INT16_C( 25939), -INT16_C( 16007),
+         INT16_C( 16656), -INT16_C( 17092), -INT16_C( 14247),  INT16_C( 26745), -INT16_C(  5084), -INT16_C( 16124),  INT16_C(  3790),  INT16_C(  5017) },
+      {  INT16_C(     0),  INT16_C( 30021),  INT16_C(     0), -INT16_C(  7540),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 13359),  INT16_C( 19754),  INT16_C(     0),  INT16_C( 27306), -INT16_C( 31277) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i r = simde_mm256_maskz_expandloadu_epi16(test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_i16x16(r, simde_x_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m256i a = simde_test_x86_random_i16x16();
+    simde__m256i r = simde_mm256_maskz_expandloadu_epi16(k, &a);
+
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i16x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i16x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_mask_expand_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int8_t src[64];
+    const simde__mmask64 k;
+    const int8_t a[64];
+    const int8_t r[64];
+  } test_vec[] = {
+    { { -INT8_C( 125),  INT8_C(  37), -INT8_C(  11),  INT8_C(  85), -INT8_C(  16),  INT8_C(  31), -INT8_C(  94), -INT8_C( 102),
+        -INT8_C( 119),  INT8_C( 117),  INT8_C(  32),  INT8_C(  55),  INT8_C(  15), -INT8_C( 103), -INT8_C(   8),  INT8_C(  31),
+        -INT8_C(  38),  INT8_C(  52), -INT8_C(  35),  INT8_C(  51), -INT8_C(   3),  INT8_C(  86), -INT8_C( 101),  INT8_C(  33),
+         INT8_C(  66), -INT8_C(  97), -INT8_C(  30),  INT8_C(  16), -INT8_C(  83),  INT8_C( 124),  INT8_C(  35),  INT8_C(  49),
+        -INT8_C(  95),  INT8_C(  24), -INT8_C( 122), -INT8_C( 110),  INT8_C(  56),  INT8_C(  40),  INT8_C(  44), -INT8_C(  63),
+        -INT8_C(  98),  INT8_C(  76), -INT8_C(   8), -INT8_C(  83), -INT8_C(  27), -INT8_C(  16), -INT8_C(  51), -INT8_C(  65),
+         INT8_C(  37), -INT8_C(  86), -INT8_C(  14),  INT8_C(  34),  INT8_C(   0), -INT8_C( 115),  INT8_C(  67),  INT8_C(  66),
+         INT8_C(  44),  INT8_C(  38),  INT8_C(  83), -INT8_C(  38), -INT8_C(  94),  INT8_C( 118),  INT8_C(  11),  INT8_C(  67) },
+      UINT64_C( 6307294275077247375),
+      {  INT8_C(  78), -INT8_C( 127),  INT8_C(   5),  INT8_C(  52),  INT8_C( 113), -INT8_C(  46), -INT8_C(  13), -INT8_C( 106),
+         INT8_C( 124), -INT8_C(  26), -INT8_C(  72),  INT8_C( 124),  INT8_C( 115), -INT8_C(   4), -INT8_C(  66), -INT8_C(  96),
+         INT8_C(  34),  INT8_C(  17),  INT8_C( 122), -INT8_C(  60), -INT8_C( 120), -INT8_C( 123),  INT8_C(   7),  INT8_C(  23),
+         INT8_C(  22), -INT8_C(  35), -INT8_C(  34), -INT8_C(  49), -INT8_C(  33),  INT8_C( 102),  INT8_C(  39),  INT8_C(  45),
+        -INT8_C(  25),  INT8_C(  44),  INT8_C(  97),  INT8_C(  89), -INT8_C(   2),  INT8_C(  85), -INT8_C(  17),  INT8_C( 122),
+         INT8_C(  59), -INT8_C(  88), -INT8_C(  10), -INT8_C(  82), -INT8_C(  92), -INT8_C(  76),  INT8_C(  78), -INT8_C(  58),
+        -INT8_C(  58), -INT8_C(  56), -INT8_C( 118),  INT8_C(  78),  INT8_C(  77), -INT8_C( 111),  INT8_C( 101),  INT8_C(  99),
+         INT8_C( 110),  INT8_C(  67),  INT8_C(  51),  INT8_C(  77), -INT8_C(  87),  INT8_C(  90),  INT8_C( 123), -INT8_C( 111) },
+      {  INT8_C(  78), -INT8_C( 127),  INT8_C(   5),  INT8_C(  52), -INT8_C(  16),  INT8_C(  31), -INT8_C(  94),  INT8_C( 113),
+        -INT8_C(  46),  INT8_C( 117),  INT8_C(  32),  INT8_C(  55), -INT8_C(  13), -INT8_C( 103), -INT8_C(   8), -INT8_C( 106),
+         INT8_C( 124),  INT8_C(  52), -INT8_C(  26),  INT8_C(  51), -INT8_C(  72),  INT8_C(  86),  INT8_C( 124),  INT8_C( 115),
+        -INT8_C(   4), -INT8_C(  66), -INT8_C(  96),  INT8_C(  16), -INT8_C(  83),  INT8_C( 124),  INT8_C(  34),  INT8_C(  17),
+         INT8_C( 122),  INT8_C(  24), -INT8_C( 122), -INT8_C(  60), -INT8_C( 120), -INT8_C( 123),  INT8_C(  44),  INT8_C(   7),
+        -INT8_C(  98),  INT8_C(  23), -INT8_C(   8), -INT8_C(  83), -INT8_C(  27), -INT8_C(  16), -INT8_C(  51), -INT8_C(  65),
+         INT8_C(  37), -INT8_C(  86), -INT8_C(  14),  INT8_C(  22),  INT8_C(   0), -INT8_C( 115),  INT8_C(  67), -INT8_C(  35),
+        -INT8_C(  34), -INT8_C(  49), -INT8_C(  33), -INT8_C(  38),  INT8_C( 102),  INT8_C( 118),  INT8_C(  39),  INT8_C(  67) } },
+    { { -INT8_C( 122), -INT8_C(  36), -INT8_C(  22), -INT8_C( 124),  INT8_C(  49), -INT8_C(  39), -INT8_C(   2),  INT8_C( 108),
+        -INT8_C( 127), -INT8_C(  12),  INT8_C(  27),  INT8_C(  37), -INT8_C(  88),  INT8_C( 105), -INT8_C(  21),  INT8_C( 110),
+         INT8_C(  50),  INT8_C( 117), -INT8_C(  68),      INT8_MAX,  INT8_C(   7),  INT8_C(  33), -INT8_C(  29),  INT8_C( 117),
+         INT8_C( 100),  INT8_C(  22), -INT8_C(  61),  INT8_C(  14),  INT8_C( 112),  INT8_C(  62), -INT8_C(  97), -INT8_C(  10),
+         INT8_C(  26), -INT8_C( 119),  INT8_C( 122),  INT8_C(  76),  INT8_C(  98),  INT8_C( 120), -INT8_C(  72), -INT8_C(  28),
+         INT8_C( 108), -INT8_C(  45),  INT8_C(   9),  INT8_C(  20),  INT8_C(  61), -INT8_C(  11), -INT8_C( 125),  INT8_C( 111),
+         INT8_C( 106),  INT8_C(  63), -INT8_C(  18),  INT8_C( 113),  INT8_C(  97), -INT8_C(  47), -INT8_C(  25), -INT8_C(  59),
+        -INT8_C(  25), -INT8_C(  86), -INT8_C(  45),  INT8_C(  87), -INT8_C(  24),  INT8_C( 114),  INT8_C(  77),  INT8_C(   2) },
+      UINT64_C(12340433897695135739),
+      { -INT8_C(  38),  INT8_C(  75), -INT8_C(  64),  INT8_C(  23),  INT8_C(  64),  INT8_C(  67), -INT8_C( 122), -INT8_C(  85),
+        -INT8_C( 126),  INT8_C( 117),  INT8_C(  28), -INT8_C(  29),  INT8_C(  70),  INT8_C(   3), -INT8_C(  87),  INT8_C(  46),
+        -INT8_C(  83),  INT8_C( 124), -INT8_C( 123), -INT8_C( 107), -INT8_C(  17), -INT8_C(  45), -INT8_C( 104), -INT8_C(  22),
+        -INT8_C( 102), -INT8_C(  26),  INT8_C(  72), -INT8_C(  38), -INT8_C(  19), -INT8_C( 118), -INT8_C( 123), -INT8_C(  56),
+        -INT8_C(  42),  INT8_C(  69), -INT8_C(  33),  INT8_C(  22), -INT8_C( 120),  INT8_C( 102), -INT8_C(  63),  INT8_C(  11),
+        -INT8_C(  37), -INT8_C(  34), -INT8_C(  18),  INT8_C(  33), -INT8_C(  31), -INT8_C( 105),  INT8_C(  79), -INT8_C( 113),
+         INT8_C(  20), -INT8_C(  43),  INT8_C(  36),  INT8_C(   3), -INT8_C(  88), -INT8_C(  68), -INT8_C(  19),  INT8_C(  66),
+        -INT8_C(  93),  INT8_C(  54),  INT8_C(  28), -INT8_C( 112), -INT8_C(  64), -INT8_C(  94),  INT8_C(  88), -INT8_C( 106) },
+      { -INT8_C(  38),  INT8_C(  75), -INT8_C(  22), -INT8_C(  64),  INT8_C(  23),  INT8_C(  64),  INT8_C(  67), -INT8_C( 122),
+        -INT8_C(  85), -INT8_C( 126),  INT8_C( 117),  INT8_C(  37), -INT8_C(  88),  INT8_C( 105),  INT8_C(  28), -INT8_C(  29),
+         INT8_C(  50),  INT8_C(  70),  INT8_C(   3), -INT8_C(  87),  INT8_C(   7),  INT8_C(  33),  INT8_C(  46),  INT8_C( 117),
+         INT8_C( 100), -INT8_C(  83),  INT8_C( 124), -INT8_C( 123), -INT8_C( 107),  INT8_C(  62), -INT8_C(  17), -INT8_C(  10),
+        -INT8_C(  45), -INT8_C( 104), -INT8_C(  22), -INT8_C( 102), -INT8_C(  26),  INT8_C(  72), -INT8_C(  72), -INT8_C(  28),
+        -INT8_C(  38), -INT8_C(  19), -INT8_C( 118),  INT8_C(  20),  INT8_C(  61), -INT8_C(  11), -INT8_C( 125),  INT8_C( 111),
+         INT8_C( 106), -INT8_C( 123), -INT8_C(  18),  INT8_C( 113),  INT8_C(  97), -INT8_C(  47), -INT8_C(  56), -INT8_C(  59),
+        -INT8_C(  42),  INT8_C(  69), -INT8_C(  45), -INT8_C(  33), -INT8_C(  24),  INT8_C(  22),  INT8_C(  77), -INT8_C( 120) } },
+    { { -INT8_C(  25),  INT8_C(  56), -INT8_C(  83),  INT8_C( 112), -INT8_C(  98),  INT8_C( 110),  INT8_C( 123),  INT8_C( 121),
+         INT8_C(  76),  INT8_C( 105), -INT8_C( 102),  INT8_C(  46),  INT8_C(   1), -INT8_C(  22), -INT8_C(  67),  INT8_C(  21),
+        -INT8_C(  65), -INT8_C(  31),  INT8_C(  24),  INT8_C( 103), -INT8_C(  98),  INT8_C(   5), -INT8_C(  87),  INT8_C(  65),
+         INT8_C(  59), -INT8_C(  58), -INT8_C(  47), -INT8_C(   4),  INT8_C( 104),  INT8_C(  42), -INT8_C( 110),  INT8_C(  79),
+         INT8_C(  98),  INT8_C(  63), -INT8_C(  65),  INT8_C(   0), -INT8_C(  82),  INT8_C(  58),  INT8_C( 121), -INT8_C(   6),
+        -INT8_C(  92),  INT8_C(  19),  INT8_C(  40), -INT8_C(  91), -INT8_C(   3), -INT8_C(  27), -INT8_C(  70), -INT8_C(  68),
+        -INT8_C(  57), -INT8_C(  46),  INT8_C(  35),  INT8_C( 101), -INT8_C(  41), -INT8_C(  51), -INT8_C(  90),  INT8_C(  19),
+        -INT8_C( 109),  INT8_C( 119),  INT8_C(  15), -INT8_C(   5), -INT8_C(  95), -INT8_C(  95),  INT8_C(  74),  INT8_C(   3) },
+      UINT64_C(16756060522507602657),
+      { -INT8_C( 112), -INT8_C(  78), -INT8_C( 115), -INT8_C( 115), -INT8_C( 105),  INT8_C(  71),  INT8_C(  74),  INT8_C(  94),
+         INT8_C(  25),  INT8_C( 109), -INT8_C(  61), -INT8_C(  15),  INT8_C(  58),  INT8_C( 105),  INT8_C(   4), -INT8_C(  51),
+        -INT8_C(  31),  INT8_C(  19), -INT8_C(  56), -INT8_C( 126), -INT8_C(  76),  INT8_C(  19), -INT8_C( 122), -INT8_C( 107),
+         INT8_C(  29), -INT8_C( 119),  INT8_C(  36),  INT8_C(  97),  INT8_C(   6), -INT8_C(  82),  INT8_C(  74), -INT8_C( 106),
+         INT8_C(  96), -INT8_C(  41),  INT8_C(  35), -INT8_C(   9),  INT8_C(  31),  INT8_C( 109),  INT8_C(  86),  INT8_C(  56),
+        -INT8_C(  37),  INT8_C(  25),  INT8_C(  41),  INT8_C(  21), -INT8_C( 125),  INT8_C(  45), -INT8_C(  29),  INT8_C( 100),
+         INT8_C(  64), -INT8_C(  85), -INT8_C(  26), -INT8_C(  11), -INT8_C(  66),  INT8_C( 108), -INT8_C( 118), -INT8_C(  37),
+        -INT8_C(  10), -INT8_C(  81),  INT8_C(  61), -INT8_C(   4),  INT8_C(  93), -INT8_C( 121), -INT8_C( 110), -INT8_C(  67) },
+      { -INT8_C( 112),  INT8_C(  56), -INT8_C(  83),  INT8_C( 112), -INT8_C(  98), -INT8_C(  78), -INT8_C( 115), -INT8_C( 115),
+         INT8_C(  76), -INT8_C( 105), -INT8_C( 102),  INT8_C(  71),  INT8_C(   1), -INT8_C(  22), -INT8_C(  67),  INT8_C(  21),
+         INT8_C(  74),  INT8_C(  94),  INT8_C(  24),  INT8_C( 103), -INT8_C(  98),  INT8_C(   5), -INT8_C(  87),  INT8_C(  65),
+         INT8_C(  25),  INT8_C( 109), -INT8_C(  61), -INT8_C(  15),  INT8_C( 104),  INT8_C(  42), -INT8_C( 110),  INT8_C(  58),
+         INT8_C(  98),  INT8_C(  63),  INT8_C( 105),  INT8_C(   0), -INT8_C(  82),  INT8_C(  58),  INT8_C(   4), -INT8_C(   6),
+        -INT8_C(  92),  INT8_C(  19), -INT8_C(  51), -INT8_C(  31),  INT8_C(  19), -INT8_C(  56), -INT8_C( 126), -INT8_C(  68),
+        -INT8_C(  76), -INT8_C(  46),  INT8_C(  35),  INT8_C(  19), -INT8_C(  41), -INT8_C(  51), -INT8_C(  90), -INT8_C( 122),
+        -INT8_C( 109),  INT8_C( 119),  INT8_C(  15), -INT8_C( 107), -INT8_C(  95),  INT8_C(  29), -INT8_C( 119),  INT8_C(  36) } },
+    { {  INT8_C(  94), -INT8_C(  75), -INT8_C(  76),  INT8_C( 125),  INT8_C(  35),  INT8_C(  10), -INT8_C(  74), -INT8_C(   2),
+         INT8_C(  36), -INT8_C(  33),  INT8_C(  19), -INT8_C(  89),  INT8_C(  13), -INT8_C(  10),  INT8_C(  11),  INT8_C(  77),
+        -INT8_C(  94), -INT8_C(  15),  INT8_C(  66),  INT8_C(  96),  INT8_C(  94), -INT8_C(  51),  INT8_C(  60),  INT8_C(  84),
+         INT8_C( 124),  INT8_C( 121),  INT8_C(  80), -INT8_C(  39),  INT8_C(   0), -INT8_C(  30), -INT8_C( 106),  INT8_C(  94),
+        -INT8_C( 105),  INT8_C(  74), -INT8_C(  36), -INT8_C(  70),  INT8_C(  85), -INT8_C( 110), -INT8_C(  72),  INT8_C( 121),
+         INT8_C( 113), -INT8_C(  52),  INT8_C(  32),  INT8_C( 126), -INT8_C(  62),  INT8_C(  43), -INT8_C(  52),  INT8_C( 100),
+         INT8_C(  28),  INT8_C(  14), -INT8_C(  59),  INT8_C( 122), -INT8_C(  37),  INT8_C(   1), -INT8_C(  50),  INT8_C(  87),
+         INT8_C( 122),  INT8_C(  30),  INT8_C(  48),  INT8_C( 122),  INT8_C(   0), -INT8_C(  58), -INT8_C(  40), -INT8_C( 104) },
+      UINT64_C(13321378619777528849),
+      { -INT8_C(  41), -INT8_C(   1),  INT8_C(  54), -INT8_C( 103),  INT8_C(  42),  INT8_C(   2), -INT8_C(   2),  INT8_C(  70),
+         INT8_C(  17), -INT8_C(  61), -INT8_C(  63), -INT8_C(  20), -INT8_C(  60), -INT8_C( 113),  INT8_C(  68),  INT8_C(  62),
+        -INT8_C(  82),  INT8_C( 116), -INT8_C(  72), -INT8_C(  82),  INT8_C(  59), -INT8_C( 112),  INT8_C(  70),  INT8_C(  76),
+         INT8_C(  69), -INT8_C( 103), -INT8_C(  78), -INT8_C( 117), -INT8_C(  92), -INT8_C( 111),  INT8_C(  67),  INT8_C( 123),
+        -INT8_C( 112),  INT8_C( 122),  INT8_C(  20), -INT8_C(  70),  INT8_C( 124),  INT8_C(  18),  INT8_C(   0), -INT8_C( 115),
+        -INT8_C(  43), -INT8_C(  63),  INT8_C( 122), -INT8_C( 103),  INT8_C(  81), -INT8_C(  66), -INT8_C(  41), -INT8_C(   1),
+         INT8_C(  50), -INT8_C( 113), -INT8_C(  83),  INT8_C( 109),  INT8_C(  32), -INT8_C(  12), -INT8_C(  71),  INT8_C( 101),
+        -INT8_C( 115),  INT8_C( 107), -INT8_C(  16),  INT8_C(  49), -INT8_C(   4),  INT8_C(  52), -INT8_C(  84), -INT8_C( 116) },
+      { -INT8_C(  41), -INT8_C(  75), -INT8_C(  76),  INT8_C( 125), -INT8_C(   1),  INT8_C(  10), -INT8_C(  74), -INT8_C(   2),
+         INT8_C(  36), -INT8_C(  33),  INT8_C(  54), -INT8_C(  89), -INT8_C( 103),  INT8_C(  42),  INT8_C(  11),  INT8_C(   2),
+        -INT8_C(  94), -INT8_C(   2),  INT8_C(  66),  INT8_C(  96),  INT8_C(  70), -INT8_C(  51),  INT8_C(  17),  INT8_C(  84),
+         INT8_C( 124), -INT8_C(  61), -INT8_C(  63), -INT8_C(  39),  INT8_C(   0), -INT8_C(  20), -INT8_C(  60),  INT8_C(  94),
+        -INT8_C( 105), -INT8_C( 113),  INT8_C(  68), -INT8_C(  70),  INT8_C(  85), -INT8_C( 110),  INT8_C(  62),  INT8_C( 121),
+        -INT8_C(  82),  INT8_C( 116),  INT8_C(  32), -INT8_C(  72), -INT8_C(  62),  INT8_C(  43), -INT8_C(  52),  INT8_C( 100),
+        -INT8_C(  82),  INT8_C(  59), -INT8_C( 112),  INT8_C(  70),  INT8_C(  76),  INT8_C(   1),  INT8_C(  69), -INT8_C( 103),
+         INT8_C( 122),  INT8_C(  30),  INT8_C(  48), -INT8_C(  78), -INT8_C( 117), -INT8_C(  92), -INT8_C(  40), -INT8_C( 111) } },
+    { { -INT8_C(  82), -INT8_C(  64),  INT8_C(  70),  INT8_C(  42), -INT8_C(  45),  INT8_C(  71), -INT8_C(  72), -INT8_C(  88),
+         INT8_C(   8),  INT8_C(  50),  INT8_C(  66),  INT8_C(  89), -INT8_C(  16),  INT8_C(  25),  INT8_C(  88),  INT8_C(  34),
+        -INT8_C(  87),  INT8_C(   6), -INT8_C( 112), -INT8_C(  55), -INT8_C(   6),  INT8_C(  73),  INT8_C(  46), -INT8_C( 121),
+        -INT8_C(  75),  INT8_C(  30), -INT8_C(  72), -INT8_C(  79),  INT8_C(  82),  INT8_C( 100),  INT8_C(  62),  INT8_C(   0),
+         INT8_C(  36), -INT8_C( 124),  INT8_C(  43), -INT8_C(   9), -INT8_C(  53), -INT8_C(  29), -INT8_C(  96), -INT8_C(  44),
+         INT8_C(  21), -INT8_C(  30),  INT8_C(  45),  INT8_C(   5), -INT8_C(   5), -INT8_C( 122),  INT8_C(  39), -INT8_C(  92),
+        -INT8_C( 116), -INT8_C(  73),  INT8_C( 109), -INT8_C( 122),  INT8_C(   1), -INT8_C( 101),  INT8_C(  13), -INT8_C(  74),
+        -INT8_C(  70), -INT8_C(  59),  INT8_C( 103),  INT8_C(  12),  INT8_C(  41), -INT8_C(  91),  INT8_C(  13),  INT8_C(  77) },
+      UINT64_C( 3515592892381214762),
+      { -INT8_C(  57), -INT8_C(   9),  INT8_C(  53), -INT8_C(  62),  INT8_C( 125),  INT8_C(  92),  INT8_C( 103),  INT8_C(   9),
+         INT8_C(  20), -INT8_C(  44), -INT8_C( 113),  INT8_C(  21),  INT8_C( 112), -INT8_C( 100), -INT8_C(  53),  INT8_C(  42),
+         INT8_C(  97),  INT8_C(  50),  INT8_C(  54), -INT8_C( 118), -INT8_C(  40),  INT8_C(  67), -INT8_C(  41),  INT8_C(   2),
+         INT8_C( 123),  INT8_C(  28), -INT8_C(   9), -INT8_C( 106),  INT8_C(   1), -INT8_C(  63), -INT8_C(  58), -INT8_C(  56),
+        -INT8_C(  72), -INT8_C(   5), -INT8_C( 117),  INT8_C(  53),  INT8_C(  88), -INT8_C(  14),  INT8_C(  62),  INT8_C( 108),
+        -INT8_C(  58), -INT8_C(  51), -INT8_C( 127),  INT8_C(  54),  INT8_C( 105),  INT8_C(  76),  INT8_C(  96), -INT8_C(  54),
+         INT8_C( 126), -INT8_C( 105),  INT8_C(  84),  INT8_C(  86), -INT8_C(  38),  INT8_C(  43),  INT8_C(  88),  INT8_C(  86),
+         INT8_C(  72),  INT8_C(  80), -INT8_C(  20),  INT8_C(  73),  INT8_C(  17), -INT8_C(  77),  INT8_C(  18), -INT8_C(  55) },
+      { -INT8_C(  82), -INT8_C(  57),  INT8_C(  70), -INT8_C(   9), -INT8_C(  45),  INT8_C(  53), -INT8_C(  72), -INT8_C(  88),
+         INT8_C(   8),  INT8_C(  50),  INT8_C(  66), -INT8_C(  62),  INT8_C( 125),  INT8_C(  92),  INT8_C(  88),  INT8_C(  34),
+         INT8_C( 103),  INT8_C(   6),  INT8_C(   9), -INT8_C(  55), -INT8_C(   6),  INT8_C(  73),  INT8_C(  20), -INT8_C( 121),
+        -INT8_C(  44),  INT8_C(  30), -INT8_C( 113), -INT8_C(  79),  INT8_C(  21),  INT8_C( 112), -INT8_C( 100), -INT8_C(  53),
+         INT8_C(  42),  INT8_C(  97),  INT8_C(  43),  INT8_C(  50),  INT8_C(  54), -INT8_C(  29), -INT8_C(  96), -INT8_C(  44),
+        -INT8_C( 118), -INT8_C(  30), -INT8_C(  40),  INT8_C(   5), -INT8_C(   5),  INT8_C(  67), -INT8_C(  41),  INT8_C(   2),
+         INT8_C( 123), -INT8_C(  73),  INT8_C( 109),  INT8_C(  28),  INT8_C(   1), -INT8_C( 101), -INT8_C(   9), -INT8_C( 106),
+        -INT8_C(  70), -INT8_C(  59),  INT8_C( 103),  INT8_C(  12),  INT8_C(   1), -INT8_C(  63),  INT8_C(  13),  INT8_C(  77) } },
+    { { -INT8_C(  82), -INT8_C(  99), -INT8_C(   2),  INT8_C(   6), -INT8_C( 113),  INT8_C(  60),  INT8_C( 114),  INT8_C(  85),
+         INT8_C(   9), -INT8_C(  13), -INT8_C( 116),  INT8_C( 114),  INT8_C(  63), -INT8_C(  20),  INT8_C(  60), -INT8_C(  66),
+        -INT8_C( 125), -INT8_C( 112),  INT8_C(  20),  INT8_C(  94), -INT8_C(  69),  INT8_C( 109), -INT8_C(  76),  INT8_C(   3),
+        -INT8_C(  67), -INT8_C(  96),  INT8_C(  77), -INT8_C(  50),  INT8_C(  83),  INT8_C(  95), -INT8_C( 105),  INT8_C(   2),
+        -INT8_C(   4), -INT8_C( 107),  INT8_C(   8), -INT8_C( 117), -INT8_C(  47),  INT8_C( 123), -INT8_C(  32), -INT8_C(  38),
+         INT8_C( 110),  INT8_C( 108),  INT8_C(  76), -INT8_C(  82),  INT8_C(  89), -INT8_C( 120),  INT8_C( 108), -INT8_C(  36),
+         INT8_C(  24),      INT8_MIN,  INT8_C(  58), -INT8_C(  45), -INT8_C(  19), -INT8_C(  18), -INT8_C(  41), -INT8_C(  86),
+        -INT8_C( 113),  INT8_C(  36),  INT8_C( 120), -INT8_C(  30), -INT8_C( 125),  INT8_C(  15), -INT8_C(  28),      INT8_MAX },
+      UINT64_C(15442819381637868964),
+      {  INT8_C(  87), -INT8_C( 101), -INT8_C( 124), -INT8_C(  80),  INT8_C(  35), -INT8_C(  16), -INT8_C( 116),  INT8_C(  59),
+         INT8_C( 113), -INT8_C(  57),  INT8_C(  15),  INT8_C(  94), -INT8_C(  75), -INT8_C(  26),  INT8_C(   9),  INT8_C(  68),
+         INT8_C(  10), -INT8_C( 127),  INT8_C(  39), -INT8_C( 115), -INT8_C( 111),  INT8_C(  11),  INT8_C(  12),  INT8_C(  53),
+        -INT8_C(   8),  INT8_C(  22), -INT8_C(  85),  INT8_C(  96),  INT8_C(   0), -INT8_C(   6),  INT8_C(  55),  INT8_C(  87),
+        -INT8_C( 106), -INT8_C(  69),  INT8_C(   7), -INT8_C(  71), -INT8_C(  84), -INT8_C( 108), -INT8_C(  11),  INT8_C(  29),
+         INT8_C(  91),  INT8_C(   4),  INT8_C( 123),  INT8_C(  16), -INT8_C(  22), -INT8_C( 124),  INT8_C(  85), -INT8_C(  12),
+         INT8_C(   6),  INT8_C( 124), -INT8_C( 127), -INT8_C( 105), -INT8_C( 121), -INT8_C( 115), -INT8_C(  52),      INT8_MIN,
+        -INT8_C(  93),  INT8_C( 119), -INT8_C(  32), -INT8_C(  93),  INT8_C( 114),  INT8_C(  23), -INT8_C(   5),  INT8_C(   8) },
+      { -INT8_C(  82), -INT8_C(  99),  INT8_C(  87),  INT8_C(   6), -INT8_C( 113), -INT8_C( 101),  INT8_C( 114), -INT8_C( 124),
+        -INT8_C(  80), -INT8_C(  13),  INT8_C(  35), -INT8_C(  16),  INT8_C(  63), -INT8_C( 116),  INT8_C(  59),  INT8_C( 113),
+        -INT8_C( 125), -INT8_C(  57),  INT8_C(  20),  INT8_C(  15), -INT8_C(  69),  INT8_C( 109), -INT8_C(  76),  INT8_C(   3),
+         INT8_C(  94), -INT8_C(  96), -INT8_C(  75), -INT8_C(  50), -INT8_C(  26),  INT8_C(   9),  INT8_C(  68),  INT8_C(   2),
+        -INT8_C(   4), -INT8_C( 107),  INT8_C(   8),  INT8_C(  10), -INT8_C(  47), -INT8_C( 127),  INT8_C(  39), -INT8_C(  38),
+         INT8_C( 110), -INT8_C( 115),  INT8_C(  76), -INT8_C( 111),  INT8_C(  89),  INT8_C(  11),  INT8_C(  12),  INT8_C(  53),
+        -INT8_C(   8),  INT8_C(  22), -INT8_C(  85),  INT8_C(  96), -INT8_C(  19), -INT8_C(  18),  INT8_C(   0), -INT8_C(  86),
+        -INT8_C( 113), -INT8_C(   6),  INT8_C(  55), -INT8_C(  30),  INT8_C(  87),  INT8_C(  15), -INT8_C( 106), -INT8_C(  69) } },
+    { { -INT8_C(  45),  INT8_C(   2), -INT8_C(  63),      INT8_MAX, -INT8_C( 106), -INT8_C(  74), -INT8_C( 100), -INT8_C(  15),
+        -INT8_C(  70),  INT8_C(  23),  INT8_C(   2), -INT8_C(  92), -INT8_C( 100),  INT8_C(  87), -INT8_C( 104), -INT8_C(  94),
+        -INT8_C(  45),  INT8_C(  25),  INT8_C(  57),  INT8_C(  90), -INT8_C(  90),  INT8_C(   5), -INT8_C(  38),  INT8_C(  73),
+         INT8_C( 125), -INT8_C(  69), -INT8_C(  19), -INT8_C(  17), -INT8_C(  46), -INT8_C(  24), -INT8_C(   9), -INT8_C(  91),
+        -INT8_C(  22), -INT8_C(  72),  INT8_C(  36), -INT8_C( 127),  INT8_C( 111), -INT8_C(  64),  INT8_C( 114),  INT8_C(  41),
+        -INT8_C(  40),  INT8_C( 116), -INT8_C(  50),  INT8_C( 116), -INT8_C(  53),  INT8_C( 102),  INT8_C(  22), -INT8_C(  98),
+             INT8_MIN,  INT8_C(  79), -INT8_C(   7),  INT8_C(  38),  INT8_C(  84), -INT8_C(  45),  INT8_C( 112), -INT8_C(  47),
+        -INT8_C( 114),  INT8_C(  93), -INT8_C(  64),  INT8_C(  97),  INT8_C(  69), -INT8_C(  73),  INT8_C(   6),  INT8_C(  47) },
+      UINT64_C(14053522133186784112),
+      { -INT8_C( 105), -INT8_C(  42),  INT8_C(  55),  INT8_C(  99),  INT8_C(  61),  INT8_C(  77),  INT8_C(   1), -INT8_C(  67),
+        -INT8_C( 100), -INT8_C(   6), -INT8_C(  29), -INT8_C(  15), -INT8_C(  50),  INT8_C(  83), -INT8_C(  62),  INT8_C(  92),
+        -INT8_C(  80), -INT8_C( 125), -INT8_C(  67), -INT8_C(  11),  INT8_C(  58), -INT8_C(  60),  INT8_C(  37), -INT8_C(  86),
+        -INT8_C(  17), -INT8_C(  43), -INT8_C( 119), -INT8_C(  38), -INT8_C(   8), -INT8_C( 110), -INT8_C(  98), -INT8_C( 112),
+         INT8_C( 104), -INT8_C(  43), -INT8_C(  13), -INT8_C(  91),  INT8_C(  35), -INT8_C(  12),  INT8_C(  98), -INT8_C(  65),
+        -INT8_C(  17),  INT8_C(  70), -INT8_C(  80), -INT8_C(  67), -INT8_C( 103),  INT8_C( 115),  INT8_C(  25),  INT8_C(  74),
+        -INT8_C(  10), -INT8_C(  41),  INT8_C(  63),  INT8_C(  48), -INT8_C( 101),  INT8_C( 100), -INT8_C(  37), -INT8_C( 118),
+         INT8_C(  58),  INT8_C( 100),  INT8_C( 100),  INT8_C(  50), -INT8_C(  10),  INT8_C(   2), -INT8_C(  62),  INT8_C(  95) },
+      { -INT8_C(  45),  INT8_C(   2), -INT8_C(  63),      INT8_MAX, -INT8_C( 105), -INT8_C(  42),  INT8_C(  55), -INT8_C(  15),
+         INT8_C(  99),  INT8_C(  61),  INT8_C(   2),  INT8_C(  77), -INT8_C( 100),  INT8_C(   1), -INT8_C( 104), -INT8_C(  94),
+        -INT8_C(  45),  INT8_C(  25),  INT8_C(  57),  INT8_C(  90), -INT8_C(  67), -INT8_C( 100), -INT8_C(  38), -INT8_C(   6),
+        -INT8_C(  29), -INT8_C(  15), -INT8_C(  50),  INT8_C(  83), -INT8_C(  62), -INT8_C(  24),  INT8_C(  92), -INT8_C(  80),
+        -INT8_C( 125), -INT8_C(  67),  INT8_C(  36), -INT8_C(  11),  INT8_C( 111),  INT8_C(  58), -INT8_C(  60),  INT8_C(  37),
+        -INT8_C(  86), -INT8_C(  17), -INT8_C(  50),  INT8_C( 116), -INT8_C(  53), -INT8_C(  43),  INT8_C(  22), -INT8_C(  98),
+             INT8_MIN,  INT8_C(  79), -INT8_C(   7), -INT8_C( 119),  INT8_C(  84), -INT8_C(  45),  INT8_C( 112), -INT8_C(  47),
+        -INT8_C(  38), -INT8_C(   8), -INT8_C(  64),  INT8_C(  97),  INT8_C(  69), -INT8_C(  73), -INT8_C( 110), -INT8_C(  98) } },
+    { { -INT8_C(  40), -INT8_C(  75),  INT8_C(   4), -INT8_C(   5), -INT8_C(  86),  INT8_C( 103), -INT8_C(  70), -INT8_C( 103),
+        -INT8_C(  83),  INT8_C( 107),  INT8_C(  86),  INT8_C(  70), -INT8_C(  34),  INT8_C( 111), -INT8_C( 112), -INT8_C(  44),
+         INT8_C(  70), -INT8_C(  48),  INT8_C(   4), -INT8_C(  31),  INT8_C(  52), -INT8_C(  33),  INT8_C( 107),  INT8_C( 110),
+         INT8_C(  68), -INT8_C(  48), -INT8_C(  95),  INT8_C(  58), -INT8_C(  46),  INT8_C(  99), -INT8_C( 103), -INT8_C(  86),
+         INT8_C(  25), -INT8_C(  98), -INT8_C(  91), -INT8_C(  61),  INT8_C(   5),  INT8_C(  96),  INT8_C(  92), -INT8_C(  78),
+        -INT8_C(  53), -INT8_C(  78), -INT8_C(   8), -INT8_C(  87),  INT8_C(  33), -INT8_C( 119),  INT8_C( 125),  INT8_C( 104),
+         INT8_C(  89), -INT8_C( 127),  INT8_C(  73), -INT8_C( 115),  INT8_C(  97), -INT8_C(  75), -INT8_C(   4), -INT8_C(  91),
+        -INT8_C( 123), -INT8_C(  99), -INT8_C(  33),  INT8_C(  87),  INT8_C(   0),  INT8_C( 121),  INT8_C(   2),  INT8_C(  25) },
+      UINT64_C(15190140196367410967),
+      { -INT8_C(  22), -INT8_C(  58),  INT8_C( 123),  INT8_C(  12),  INT8_C(  79), -INT8_C(   8),  INT8_C( 116), -INT8_C(  88),
+         INT8_C( 122), -INT8_C(  67),  INT8_C(  54), -INT8_C(  37),  INT8_C( 114),  INT8_C(  50),      INT8_MIN, -INT8_C(   9),
+        -INT8_C(  49),  INT8_C(  95),  INT8_C(  79), -INT8_C(  49), -INT8_C(  40),  INT8_C(  81), -INT8_C(  23), -INT8_C(  17),
+        -INT8_C(   8), -INT8_C(  59),  INT8_C(  11),  INT8_C(   0), -INT8_C(   2), -INT8_C(  39), -INT8_C(  46), -INT8_C(  24),
+        -INT8_C(  96),  INT8_C(  78), -INT8_C(  12), -INT8_C(  17),  INT8_C(  70),  INT8_C( 104), -INT8_C( 104), -INT8_C(  64),
+         INT8_C(  38), -INT8_C(  50), -INT8_C( 101), -INT8_C( 104),  INT8_C(   0),  INT8_C(  27), -INT8_C( 112), -INT8_C(  49),
+         INT8_C( 123), -INT8_C(  33), -INT8_C(  98),  INT8_C(  83),  INT8_C(  48), -INT8_C( 121),  INT8_C(  67),  INT8_C(  40),
+         INT8_C(  77),  INT8_C(  78),  INT8_C(  40),  INT8_C(  75),  INT8_C(  40), -INT8_C(   5),  INT8_C(  51), -INT8_C(  56) },
+      { -INT8_C(  22), -INT8_C(  58),  INT8_C( 123), -INT8_C(   5),  INT8_C(  12),  INT8_C( 103), -INT8_C(  70), -INT8_C( 103),
+         INT8_C(  79), -INT8_C(   8),  INT8_C( 116),  INT8_C(  70), -INT8_C(  34), -INT8_C(  88), -INT8_C( 112),  INT8_C( 122),
+         INT8_C(  70), -INT8_C(  48), -INT8_C(  67),  INT8_C(  54), -INT8_C(  37), -INT8_C(  33),  INT8_C( 114),  INT8_C(  50),
+         INT8_C(  68), -INT8_C(  48),      INT8_MIN, -INT8_C(   9), -INT8_C(  49),  INT8_C(  99), -INT8_C( 103), -INT8_C(  86),
+         INT8_C(  95),  INT8_C(  79), -INT8_C(  49), -INT8_C(  61),  INT8_C(   5),  INT8_C(  96),  INT8_C(  92), -INT8_C(  78),
+        -INT8_C(  53), -INT8_C(  78), -INT8_C(   8), -INT8_C(  40),  INT8_C(  81), -INT8_C(  23),  INT8_C( 125),  INT8_C( 104),
+         INT8_C(  89), -INT8_C(  17), -INT8_C(   8), -INT8_C(  59),  INT8_C(  97), -INT8_C(  75),  INT8_C(  11),  INT8_C(   0),
+        -INT8_C( 123), -INT8_C(   2), -INT8_C(  33),  INT8_C(  87), -INT8_C(  39),  INT8_C( 121), -INT8_C(  46), -INT8_C(  24) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi8(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i r = simde_mm512_mask_expand_epi8(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x64(r, simde_mm512_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m512i src = simde_test_x86_random_i8x64();
+    simde__mmask64 k = simde_test_x86_random_mmask64();
+    simde__m512i a = simde_test_x86_random_i8x64();
+    simde__m512i r = simde_mm512_mask_expand_epi8(src, k, a);
+
+    simde_test_x86_write_i8x64(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask64(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x64(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x64(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_maskz_expand_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask64 k;
+    const int8_t a[64];
+    const int8_t r[64];
+  } test_vec[] = {
+    { UINT64_C(13137087595344767049),
+      {  INT8_C(  29), -INT8_C(  21),  INT8_C(  79),  INT8_C(  29),  INT8_C(   7), -INT8_C(  33), -INT8_C(  20), -INT8_C( 126),
+        -INT8_C(  66), -INT8_C( 117), -INT8_C(  43), -INT8_C(  18),  INT8_C(  18),  INT8_C(  24),  INT8_C(  22),  INT8_C(  95),
+         INT8_C( 103),  INT8_C(  63), -INT8_C(  86), -INT8_C( 113),  INT8_C(  58), -INT8_C(  34),  INT8_C(  87), -INT8_C( 125),
+         INT8_C(   6),  INT8_C(  14),  INT8_C(  18), -INT8_C( 106),  INT8_C(  94),  INT8_C(  98),  INT8_C(  77),  INT8_C( 123),
+         INT8_C(  78), -INT8_C( 100), -INT8_C( 103),  INT8_C(  85),  INT8_C( 123), -INT8_C( 123), -INT8_C(  41),  INT8_C(  57),
+         INT8_C(  16), -INT8_C(  84),  INT8_C(  39),  INT8_C(  35), -INT8_C(  59),  INT8_C(  61), -INT8_C( 126),  INT8_C(  44),
+         INT8_C( 124),  INT8_C(  45), -INT8_C(  69), -INT8_C(  74),  INT8_C(  11),  INT8_C(  18),  INT8_C(  57),  INT8_C(  17),
+         INT8_C(  32),  INT8_C(  76), -INT8_C(  89),  INT8_C( 126), -INT8_C(  82), -INT8_C(  12), -INT8_C(   6), -INT8_C(   4) },
+      {  INT8_C(  29),  INT8_C(   0),  INT8_C(   0), -INT8_C(  21),  INT8_C(   0),  INT8_C(   0),  INT8_C(  79),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  29),  INT8_C(   0),  INT8_C(   7),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  33), -INT8_C(  20), -INT8_C( 126),  INT8_C(   0), -INT8_C(  66), -INT8_C( 117),  INT8_C(   0), -INT8_C(  43),
+        -INT8_C(  18),  INT8_C(  18),  INT8_C(  24),  INT8_C(  22),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  95),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 103),  INT8_C(   0),  INT8_C(   0),  INT8_C(  63),
+        -INT8_C(  86), -INT8_C( 113),  INT8_C(  58), -INT8_C(  34),  INT8_C(   0),  INT8_C(   0),  INT8_C(  87),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 125),  INT8_C(   0),  INT8_C(   6),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(  14),  INT8_C(  18),  INT8_C(   0), -INT8_C( 106),  INT8_C(  94),  INT8_C(   0),  INT8_C(  98) } },
+    { UINT64_C( 2973545737705591696),
+      { -INT8_C(  43),  INT8_C( 107),  INT8_C(  76), -INT8_C( 102), -INT8_C(  87), -INT8_C(  50), -INT8_C(  58),  INT8_C(  37),
+        -INT8_C(   5), -INT8_C( 127), -INT8_C(  36),  INT8_C(   6), -INT8_C( 109),  INT8_C(  21),  INT8_C(  23), -INT8_C(  77),
+         INT8_C(  97), -INT8_C(  65),  INT8_C(  50),  INT8_C(  16), -INT8_C(  77),  INT8_C(  44),  INT8_C(  12),  INT8_C(  68),
+        -INT8_C(  65),  INT8_C(  94),  INT8_C(  79), -INT8_C(  41), -INT8_C( 122), -INT8_C( 108),  INT8_C(   0),  INT8_C(  91),
+        -INT8_C(   1),  INT8_C(  76), -INT8_C(  11), -INT8_C(  88),  INT8_C(  27), -INT8_C(  69), -INT8_C(  50),  INT8_C(  22),
+         INT8_C(  60), -INT8_C(  86),  INT8_C(  29), -INT8_C(  49), -INT8_C(  65),  INT8_C(  52), -INT8_C( 125),  INT8_C(  33),
+        -INT8_C(  13), -INT8_C(  75),  INT8_C(  49), -INT8_C(  89), -INT8_C(  31),  INT8_C(  61), -INT8_C(  21), -INT8_C(  96),
+        -INT8_C( 101),  INT8_C(  58),  INT8_C( 119),  INT8_C(  34), -INT8_C(  50),  INT8_C( 120),  INT8_C( 125), -INT8_C(  50) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  43),  INT8_C(   0),  INT8_C(   0),  INT8_C( 107),
+         INT8_C(  76), -INT8_C( 102),  INT8_C(   0),  INT8_C(   0), -INT8_C(  87),  INT8_C(   0),  INT8_C(   0), -INT8_C(  50),
+        -INT8_C(  58),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  37),  INT8_C(   0), -INT8_C(   5),  INT8_C(   0),
+        -INT8_C( 127), -INT8_C(  36),  INT8_C(   0),  INT8_C(   6),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 109),  INT8_C(  21),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  23),  INT8_C(   0), -INT8_C(  77),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(  97),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  65),  INT8_C(   0),
+         INT8_C(  50),  INT8_C(   0),  INT8_C(   0),  INT8_C(  16),  INT8_C(   0), -INT8_C(  77),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C( 7779480374437376964),
+      { -INT8_C(  18),  INT8_C(  19),  INT8_C(  58), -INT8_C(  82),  INT8_C(  71), -INT8_C(  67), -INT8_C(  49),  INT8_C(  59),
+         INT8_C( 114),  INT8_C(   0), -INT8_C(  30),  INT8_C(  83),  INT8_C(  61), -INT8_C(  51), -INT8_C(  13), -INT8_C(  39),
+         INT8_C(   7),  INT8_C( 107), -INT8_C(   5), -INT8_C(  42), -INT8_C(  29),  INT8_C( 120), -INT8_C(  92), -INT8_C(  89),
+        -INT8_C(  21),  INT8_C(  26), -INT8_C( 121),  INT8_C(  26),  INT8_C(  95),  INT8_C( 125), -INT8_C( 123),  INT8_C(  77),
+        -INT8_C( 112), -INT8_C(  65), -INT8_C(   5), -INT8_C(  41),  INT8_C( 125), -INT8_C(  54),  INT8_C(  18), -INT8_C(  17),
+        -INT8_C(  54), -INT8_C(  12),  INT8_C(  67),  INT8_C(   8), -INT8_C(  63),  INT8_C(  54), -INT8_C(  31), -INT8_C(  55),
+        -INT8_C(  95), -INT8_C(  36), -INT8_C(  97), -INT8_C( 124),  INT8_C(  84),  INT8_C(  67),  INT8_C(  44),  INT8_C(  64),
+         INT8_C(  93), -INT8_C(  77),  INT8_C(  90), -INT8_C(  68),  INT8_C(  48), -INT8_C(  33),  INT8_C(  10), -INT8_C(  64) },
+      {  INT8_C(   0),  INT8_C(   0), -INT8_C(  18),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  19),  INT8_C(  58),
+        -INT8_C(  82),  INT8_C(  71),  INT8_C(   0),  INT8_C(   0), -INT8_C(  67), -INT8_C(  49),  INT8_C(  59),  INT8_C(   0),
+         INT8_C(   0),  INT8_C( 114),  INT8_C(   0),  INT8_C(   0), -INT8_C(  30),  INT8_C(  83),  INT8_C(  61),  INT8_C(   0),
+        -INT8_C(  51), -INT8_C(  13), -INT8_C(  39),  INT8_C(   7),  INT8_C( 107),  INT8_C(   0), -INT8_C(   5), -INT8_C(  42),
+         INT8_C(   0), -INT8_C(  29),  INT8_C( 120), -INT8_C(  92),  INT8_C(   0), -INT8_C(  89),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0), -INT8_C(  21),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  26),  INT8_C(   0),
+         INT8_C(   0), -INT8_C( 121),  INT8_C(  26),  INT8_C(   0),  INT8_C(  95),  INT8_C( 125), -INT8_C( 123),  INT8_C(  77),
+        -INT8_C( 112), -INT8_C(  65),  INT8_C(   0), -INT8_C(   5),  INT8_C(   0), -INT8_C(  41),  INT8_C( 125),  INT8_C(   0) } },
+    { UINT64_C(11100153517377521054),
+      { -INT8_C(  98),  INT8_C(  78), -INT8_C(  94),  INT8_C(  96), -INT8_C( 124), -INT8_C( 125),  INT8_C(  41),  INT8_C(  38),
+         INT8_C(  95), -INT8_C(  56), -INT8_C(  86), -INT8_C(  76),  INT8_C(  11), -INT8_C(  42), -INT8_C(  12),  INT8_C( 104),
+        -INT8_C( 119),  INT8_C(  78),  INT8_C(  37), -INT8_C(  71),  INT8_C(  45),  INT8_C(  47),  INT8_C( 121), -INT8_C(  53),
+         INT8_C(  52),  INT8_C(  17), -INT8_C(  25),  INT8_C(   4), -INT8_C(  69), -INT8_C(  14), -INT8_C(  97),  INT8_C(  89),
+         INT8_C(  64),  INT8_C(  65), -INT8_C(  71), -INT8_C(  60), -INT8_C(  59), -INT8_C(  30), -INT8_C(  22),  INT8_C(  36),
+        -INT8_C(  86), -INT8_C( 107), -INT8_C(  40), -INT8_C(  75),  INT8_C( 107), -INT8_C(  52),  INT8_C(  30), -INT8_C(  11),
+         INT8_C(  26),  INT8_C(  67), -INT8_C(  82),  INT8_C(  71),  INT8_C( 114),  INT8_C(  40),  INT8_C(  19), -INT8_C(  90),
+         INT8_C(  57), -INT8_C(   6), -INT8_C(  85), -INT8_C(  12), -INT8_C(  20),  INT8_C(  74),  INT8_C(  77),  INT8_C(  44) },
+      {  INT8_C(   0), -INT8_C(  98),  INT8_C(  78), -INT8_C(  94),  INT8_C(  96),  INT8_C(   0),  INT8_C(   0), -INT8_C( 124),
+        -INT8_C( 125),  INT8_C(   0),  INT8_C(  41),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  38),  INT8_C(  95), -INT8_C(  56),  INT8_C(   0), -INT8_C(  86),  INT8_C(   0),  INT8_C(   0), -INT8_C(  76),
+         INT8_C(  11), -INT8_C(  42),  INT8_C(   0), -INT8_C(  12),  INT8_C( 104),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 119),  INT8_C(   0),  INT8_C(  78),  INT8_C(  37),
+         INT8_C(   0), -INT8_C(  71),  INT8_C(   0),  INT8_C(  45),  INT8_C(   0),  INT8_C(  47),  INT8_C(   0),  INT8_C( 121),
+        -INT8_C(  53),  INT8_C(  52),  INT8_C(   0),  INT8_C(  17),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0), -INT8_C(  25),  INT8_C(   0),  INT8_C(   4), -INT8_C(  69),  INT8_C(   0),  INT8_C(   0), -INT8_C(  14) } },
+    { UINT64_C(10697698285020252043),
+      {  INT8_C( 112),  INT8_C(  77),  INT8_C(  73), -INT8_C(  37),  INT8_C(  26),  INT8_C( 103), -INT8_C(  48),  INT8_C(  52),
+        -INT8_C(  86),      INT8_MAX,  INT8_C( 124),  INT8_C(  28), -INT8_C(  89), -INT8_C( 113), -INT8_C(  61), -INT8_C(  32),
+        -INT8_C( 119),  INT8_C( 110), -INT8_C(  44),  INT8_C( 117), -INT8_C(  72),  INT8_C(  33), -INT8_C(  95),  INT8_C(  67),
+         INT8_C(  40), -INT8_C( 111), -INT8_C( 108),  INT8_C(  18),  INT8_C( 108),  INT8_C(   9), -INT8_C(  90), -INT8_C(  36),
+         INT8_C(  86), -INT8_C(  17), -INT8_C(  72),  INT8_C( 112),  INT8_C(  87), -INT8_C( 120), -INT8_C(  91),  INT8_C(   1),
+         INT8_C(   7),  INT8_C(  33),  INT8_C(  30), -INT8_C(  82), -INT8_C(  80), -INT8_C(  31), -INT8_C( 114),  INT8_C(  57),
+         INT8_C(  79),  INT8_C(  98), -INT8_C(  82),  INT8_C(   7), -INT8_C( 124),  INT8_C(  79),  INT8_C(  74), -INT8_C(  84),
+        -INT8_C(  32), -INT8_C(  34), -INT8_C(  66),  INT8_C(  77), -INT8_C(  25),  INT8_C( 100),  INT8_C(  41),  INT8_C(  62) },
+      {  INT8_C( 112),  INT8_C(  77),  INT8_C(   0),  INT8_C(  73),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  37),
+         INT8_C(  26),  INT8_C( 103), -INT8_C(  48),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  52), -INT8_C(  86),      INT8_MAX,  INT8_C( 124),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  28),  INT8_C(   0), -INT8_C(  89),  INT8_C(   0),
+        -INT8_C( 113),  INT8_C(   0),  INT8_C(   0), -INT8_C(  61),  INT8_C(   0), -INT8_C(  32), -INT8_C( 119),  INT8_C( 110),
+        -INT8_C(  44),  INT8_C( 117),  INT8_C(   0), -INT8_C(  72),  INT8_C(  33),  INT8_C(   0), -INT8_C(  95),  INT8_C(  67),
+         INT8_C(  40),  INT8_C(   0), -INT8_C( 111),  INT8_C(   0), -INT8_C( 108),  INT8_C(  18),  INT8_C( 108),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   9),  INT8_C(   0), -INT8_C(  90),  INT8_C(   0),  INT8_C(   0), -INT8_C(  36) } },
+    { UINT64_C( 8191013539892093268),
+      {  INT8_C( 116), -INT8_C(  54),  INT8_C(  32),  INT8_C(  36), -INT8_C(  85), -INT8_C(  82),  INT8_C(  93), -INT8_C(   6),
+         INT8_C(  17),  INT8_C(  11),  INT8_C(   1), -INT8_C( 107),  INT8_C(  90),  INT8_C(  76),  INT8_C(  65),  INT8_C(  59),
+         INT8_C(  42),  INT8_C(   0), -INT8_C( 120),  INT8_C(  18),  INT8_C( 100), -INT8_C(  79),  INT8_C(  80), -INT8_C(  72),
+        -INT8_C( 109), -INT8_C(   2),  INT8_C(  99), -INT8_C(   3),  INT8_C(  82),  INT8_C(  16),  INT8_C( 110), -INT8_C(  58),
+        -INT8_C(  38), -INT8_C( 114), -INT8_C(  21), -INT8_C( 122),  INT8_C(  61),  INT8_C(  72),      INT8_MIN,  INT8_C(  78),
+         INT8_C(  84), -INT8_C( 126), -INT8_C(  29), -INT8_C(  82), -INT8_C(  50),  INT8_C(  36), -INT8_C(  23), -INT8_C(   8),
+         INT8_C(  36),  INT8_C( 113),  INT8_C(  10), -INT8_C( 119),  INT8_C(  35),  INT8_C(  90),  INT8_C(  65), -INT8_C(  74),
+         INT8_C(  89), -INT8_C(  91), -INT8_C(  77), -INT8_C(  85), -INT8_C(  75),  INT8_C(  33),  INT8_C( 113), -INT8_C( 113) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C( 116),  INT8_C(   0), -INT8_C(  54),  INT8_C(   0),  INT8_C(  32),  INT8_C(   0),
+         INT8_C(  36),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  85), -INT8_C(  82),  INT8_C(  93),
+         INT8_C(   0), -INT8_C(   6),  INT8_C(  17),  INT8_C(  11),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0), -INT8_C( 107),
+         INT8_C(  90),  INT8_C(  76),  INT8_C(   0),  INT8_C(  65),  INT8_C(   0),  INT8_C(  59),  INT8_C(   0),  INT8_C(  42),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 120),  INT8_C(   0),  INT8_C(  18),  INT8_C( 100),  INT8_C(   0),
+        -INT8_C(  79),  INT8_C(  80),  INT8_C(   0),  INT8_C(   0), -INT8_C(  72),  INT8_C(   0), -INT8_C( 109),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0), -INT8_C(   2),  INT8_C(  99),  INT8_C(   0), -INT8_C(   3),  INT8_C(   0),  INT8_C(  82),
+         INT8_C(  16),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 110), -INT8_C(  58), -INT8_C(  38),  INT8_C(   0) } },
+    { UINT64_C(17959113578461355184),
+      {  INT8_C(  24),  INT8_C(  30), -INT8_C(  89), -INT8_C(  26),  INT8_C(  66), -INT8_C( 111), -INT8_C(  34),  INT8_C( 103),
+         INT8_C(   2), -INT8_C(  23), -INT8_C(  16),  INT8_C(  37),  INT8_C(  67),  INT8_C(  49), -INT8_C(  37), -INT8_C( 100),
+        -INT8_C(  42), -INT8_C( 114),  INT8_C(  71), -INT8_C( 117), -INT8_C(  80), -INT8_C(  71),  INT8_C(  27),  INT8_C(  96),
+         INT8_C(  21),  INT8_C(  48),  INT8_C(  77), -INT8_C(  70), -INT8_C(  58), -INT8_C( 120), -INT8_C(  77), -INT8_C(  34),
+        -INT8_C(  90),  INT8_C(  91), -INT8_C(  60), -INT8_C(  24), -INT8_C(  20), -INT8_C(  93),  INT8_C(  79), -INT8_C(  18),
+        -INT8_C( 116),  INT8_C(  63),  INT8_C(  20), -INT8_C(  49),  INT8_C( 113), -INT8_C(  17),  INT8_C( 108),  INT8_C(  71),
+         INT8_C( 126), -INT8_C(  77), -INT8_C(  45),  INT8_C(  46),  INT8_C( 108), -INT8_C(  18), -INT8_C( 114), -INT8_C( 126),
+         INT8_C(  30), -INT8_C(  37),  INT8_C(  60), -INT8_C(  27),  INT8_C(  99), -INT8_C(  16), -INT8_C(  61),  INT8_C(   9) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  24),  INT8_C(  30),  INT8_C(   0), -INT8_C(  89),
+         INT8_C(   0),  INT8_C(   0), -INT8_C(  26),  INT8_C(  66), -INT8_C( 111),  INT8_C(   0), -INT8_C(  34),  INT8_C(   0),
+         INT8_C( 103),  INT8_C(   0),  INT8_C(   2),  INT8_C(   0), -INT8_C(  23),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  16),  INT8_C(   0),  INT8_C(  37),  INT8_C(  67),  INT8_C(   0),  INT8_C(  49), -INT8_C(  37), -INT8_C( 100),
+        -INT8_C(  42),  INT8_C(   0), -INT8_C( 114),  INT8_C(   0),  INT8_C(   0),  INT8_C(  71),  INT8_C(   0), -INT8_C( 117),
+         INT8_C(   0), -INT8_C(  80), -INT8_C(  71),  INT8_C(   0),  INT8_C(  27),  INT8_C(   0),  INT8_C(   0),  INT8_C(  96),
+         INT8_C(  21),  INT8_C(  48),  INT8_C(   0),  INT8_C(  77), -INT8_C(  70), -INT8_C(  58),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C( 120),  INT8_C(   0),  INT8_C(   0), -INT8_C(  77), -INT8_C(  34), -INT8_C(  90),  INT8_C(  91), -INT8_C(  60) } },
+    { UINT64_C(13197025936957081675),
+      {      INT8_MIN,  INT8_C(  57), -INT8_C( 122), -INT8_C(  15),  INT8_C(  41), -INT8_C(  14),  INT8_C(  57), -INT8_C(  89),
+        -INT8_C(  90),  INT8_C(  12), -INT8_C(  43),  INT8_C(  18), -INT8_C(   6),  INT8_C(  99), -INT8_C( 108),  INT8_C(  24),
+         INT8_C(  62), -INT8_C(  47), -INT8_C(   3), -INT8_C(  95), -INT8_C(  63), -INT8_C(  63), -INT8_C(  86),  INT8_C(  12),
+         INT8_C(  73), -INT8_C( 101),  INT8_C(  67),  INT8_C( 116), -INT8_C(  36),  INT8_C( 104),  INT8_C(  43),  INT8_C(  93),
+        -INT8_C(  94), -INT8_C(  79),  INT8_C(  78), -INT8_C(  53), -INT8_C(  92), -INT8_C( 121),  INT8_C( 114),  INT8_C(  74),
+        -INT8_C( 109),  INT8_C(  71),  INT8_C(  92), -INT8_C( 115), -INT8_C(  86), -INT8_C(  15), -INT8_C(  90), -INT8_C(  24),
+        -INT8_C(  62), -INT8_C(  93), -INT8_C( 119), -INT8_C( 125),  INT8_C( 100),  INT8_C(  51), -INT8_C( 113), -INT8_C(  83),
+        -INT8_C(  50), -INT8_C(  46),  INT8_C(  33), -INT8_C(  85),  INT8_C(  58),  INT8_C(  76),  INT8_C(   8), -INT8_C(  36) },
+      {      INT8_MIN,  INT8_C(  57),  INT8_C(   0), -INT8_C( 122),  INT8_C(   0),  INT8_C(   0), -INT8_C(  15),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  41),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  14),
+         INT8_C(  57),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  89), -INT8_C(  90),  INT8_C(  12), -INT8_C(  43),
+         INT8_C(  18), -INT8_C(   6),  INT8_C(  99),  INT8_C(   0), -INT8_C( 108),  INT8_C(  24),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  62), -INT8_C(  47),  INT8_C(   0), -INT8_C(   3),  INT8_C(   0), -INT8_C(  95),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  63),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  63),  INT8_C(   0),
+        -INT8_C(  86),  INT8_C(   0),  INT8_C(  12),  INT8_C(   0),  INT8_C(   0),  INT8_C(  73),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C( 101),  INT8_C(  67),  INT8_C( 116),  INT8_C(   0), -INT8_C(  36),  INT8_C( 104),  INT8_C(   0),  INT8_C(  43) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i r = simde_mm512_maskz_expand_epi8(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x64(r, simde_mm512_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask64 k = simde_test_x86_random_mmask64();
+    simde__m512i a = simde_test_x86_random_i8x64();
+    simde__m512i r = simde_mm512_maskz_expand_epi8(k, a);
+
+    simde_test_x86_write_mmask64(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i8x64(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x64(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_mask_expandloadu_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int8_t src[64];
+    const simde__mmask64 k;
+    const int8_t a[64];
+    const int8_t r[64];
+  } test_vec[] = {
+    { { -INT8_C(   2),  INT8_C(  86), -INT8_C(  89), -INT8_C(  94), -INT8_C(  34),  INT8_C(  25), -INT8_C(  20),  INT8_C( 113),
+         INT8_C(  96),  INT8_C(  72), -INT8_C(   1),  INT8_C(  10),  INT8_C(  57), -INT8_C(  91), -INT8_C(  14), -INT8_C(   5),
+         INT8_C(  72),  INT8_C( 123),  INT8_C( 126), -INT8_C(  83), -INT8_C(  82),  INT8_C(  13),  INT8_C(  90),  INT8_C( 125),
+        -INT8_C(  33),  INT8_C( 124),  INT8_C(  40),  INT8_C(  26), -INT8_C(  56),  INT8_C(  48), -INT8_C(  10), -INT8_C(  58),
+        -INT8_C( 122), -INT8_C(  98),  INT8_C( 104),  INT8_C( 100), -INT8_C(  73),  INT8_C(  84), -INT8_C(  42),  INT8_C(  24),
+        -INT8_C(  99), -INT8_C(  43),  INT8_C(  34), -INT8_C(  42),  INT8_C( 122),  INT8_C(  21), -INT8_C(  46), -INT8_C(  62),
+        -INT8_C( 112),  INT8_C(  80),  INT8_C( 111),  INT8_C(  63),  INT8_C(  94), -INT8_C(  54), -INT8_C(  68),  INT8_C(  61),
+         INT8_C(  70), -INT8_C(  28),  INT8_C(  87),  INT8_C(  14),  INT8_C(  20),  INT8_C(  78), -INT8_C(  43), -INT8_C( 102) },
+      UINT64_C( 3439577566220860908),
+      { -INT8_C(  86), -INT8_C(  34),  INT8_C(   5),  INT8_C(  36), -INT8_C(  13), -INT8_C(  41), -INT8_C(  26), -INT8_C( 125),
+         INT8_C(  40),  INT8_C(  86), -INT8_C(  62), -INT8_C( 122),  INT8_C(  32),  INT8_C( 126), -INT8_C(  61),  INT8_C( 102),
+         INT8_C(  98),  INT8_C(  27),  INT8_C( 116),  INT8_C( 118),  INT8_C( 105),  INT8_C(  73),  INT8_C(  17),  INT8_C(  85),
+        -INT8_C( 121),  INT8_C(  16), -INT8_C(   8),  INT8_C(  25), -INT8_C(  27), -INT8_C(  76),  INT8_C(  72), -INT8_C( 113),
+        -INT8_C( 110),  INT8_C(  77), -INT8_C(  77), -INT8_C( 123),  INT8_C(  37), -INT8_C( 103),  INT8_C(   8),  INT8_C(  77),
+        -INT8_C(  17), -INT8_C(  53), -INT8_C(  45),  INT8_C(  15),  INT8_C(  73), -INT8_C( 106),  INT8_C( 117), -INT8_C(  84),
+        -INT8_C(  79), -INT8_C(  22),  INT8_C(  34),  INT8_C(  26),  INT8_C(  51),  INT8_C(  51),  INT8_C( 111), -INT8_C(  70),
+         INT8_C(  67),  INT8_C( 104), -INT8_C(  45),  INT8_C(  40),  INT8_C(  28),  INT8_C(  27), -INT8_C(  73), -INT8_C(  82) },
+      { -INT8_C(   2),  INT8_C(  86), -INT8_C(  86), -INT8_C(  34), -INT8_C(  34),  INT8_C(   5),  INT8_C(  36), -INT8_C(  13),
+        -INT8_C(  41),  INT8_C(  72), -INT8_C(  26), -INT8_C( 125),  INT8_C(  40),  INT8_C(  86), -INT8_C(  14), -INT8_C(   5),
+        -INT8_C(  62), -INT8_C( 122),  INT8_C(  32),  INT8_C( 126), -INT8_C(  61),  INT8_C( 102),  INT8_C(  98),  INT8_C(  27),
+         INT8_C( 116),  INT8_C( 118),  INT8_C(  40),  INT8_C(  26), -INT8_C(  56),  INT8_C( 105), -INT8_C(  10),  INT8_C(  73),
+        -INT8_C( 122),  INT8_C(  17),  INT8_C( 104),  INT8_C( 100),  INT8_C(  85),  INT8_C(  84), -INT8_C(  42), -INT8_C( 121),
+         INT8_C(  16), -INT8_C(  43), -INT8_C(   8), -INT8_C(  42),  INT8_C(  25),  INT8_C(  21), -INT8_C(  27), -INT8_C(  76),
+         INT8_C(  72), -INT8_C( 113),  INT8_C( 111), -INT8_C( 110),  INT8_C(  77), -INT8_C(  77), -INT8_C(  68), -INT8_C( 123),
+         INT8_C(  37), -INT8_C( 103),  INT8_C(   8),  INT8_C(  77),  INT8_C(  20), -INT8_C(  17), -INT8_C(  43), -INT8_C( 102) } },
+    { {  INT8_C( 105),  INT8_C( 106),  INT8_C(  51), -INT8_C( 114),  INT8_C(   4),  INT8_C(  59), -INT8_C(  37), -INT8_C(  13),
+         INT8_C(   6), -INT8_C(  82),  INT8_C(   3),  INT8_C(  80),  INT8_C(  68),  INT8_C( 120), -INT8_C(   4), -INT8_C(  10),
+         INT8_C(  98),  INT8_C(  30),  INT8_C(  16), -INT8_C( 106),  INT8_C(  82),      INT8_MIN,  INT8_C(  80), -INT8_C( 107),
+        -INT8_C(  24),  INT8_C(  36), -INT8_C(  66),  INT8_C(   4),  INT8_C(  63),  INT8_C( 117), -INT8_C(  78), -INT8_C(  88),
+        -INT8_C(  32), -INT8_C(  27),  INT8_C(  54), -INT8_C(  28),  INT8_C(  32),  INT8_C(  17), -INT8_C(  41),  INT8_C(  39),
+        -INT8_C(  65), -INT8_C(  38),  INT8_C( 119),  INT8_C(   4),  INT8_C(  83),  INT8_C( 115), -INT8_C(   6), -INT8_C(  75),
+        -INT8_C( 111),  INT8_C(  10),  INT8_C(  75), -INT8_C(  29), -INT8_C( 118), -INT8_C( 100),  INT8_C( 121),  INT8_C( 114),
+        -INT8_C(  64),  INT8_C(  55),  INT8_C( 118), -INT8_C(   1), -INT8_C(  84),  INT8_C(  40), -INT8_C(  88), -INT8_C( 116) },
+      UINT64_C(12634084526066294285),
+      {  INT8_C(  34), -INT8_C(  52), -INT8_C(  77),  INT8_C( 117),  INT8_C(  63), -INT8_C(  83),  INT8_C(  43), -INT8_C(  48),
+        -INT8_C(  72),  INT8_C( 118), -INT8_C(  76),  INT8_C(  66),  INT8_C(  18),  INT8_C(  45), -INT8_C(  75), -INT8_C(  46),
+         INT8_C( 100),  INT8_C(  43), -INT8_C(  46),  INT8_C(  16),  INT8_C(  84),  INT8_C( 122), -INT8_C(  99),  INT8_C(  97),
+         INT8_C(  88),  INT8_C(  13), -INT8_C( 113),  INT8_C(  72),  INT8_C(  85), -INT8_C(  28), -INT8_C(   8),  INT8_C( 120),
+        -INT8_C(  80), -INT8_C(  85), -INT8_C(  19), -INT8_C(  17),  INT8_C(  89),  INT8_C(  24), -INT8_C(  64),  INT8_C(  17),
+        -INT8_C( 113),  INT8_C( 116),  INT8_C(  83), -INT8_C(  95), -INT8_C(  95),  INT8_C(   8),  INT8_C( 116),  INT8_C(   5),
+         INT8_C(  52),  INT8_C(  70),  INT8_C(  21), -INT8_C( 120), -INT8_C(  64), -INT8_C(  78), -INT8_C(  23),  INT8_C(  24),
+        -INT8_C(  64),  INT8_C( 121),  INT8_C(  97),  INT8_C(  21),  INT8_C(  93),  INT8_C(  89), -INT8_C( 115),  INT8_C(  14) },
+      {  INT8_C(  34),  INT8_C( 106), -INT8_C(  52), -INT8_C(  77),  INT8_C(   4),  INT8_C(  59), -INT8_C(  37), -INT8_C(  13),
+         INT8_C(   6),  INT8_C( 117),  INT8_C(  63), -INT8_C(  83),  INT8_C(  43),  INT8_C( 120), -INT8_C(  48), -INT8_C(  72),
+         INT8_C(  98),  INT8_C(  30),  INT8_C(  16), -INT8_C( 106),  INT8_C( 118), -INT8_C(  76),  INT8_C(  66), -INT8_C( 107),
+        -INT8_C(  24),  INT8_C(  18),  INT8_C(  45), -INT8_C(  75),  INT8_C(  63), -INT8_C(  46), -INT8_C(  78), -INT8_C(  88),
+        -INT8_C(  32), -INT8_C(  27),  INT8_C(  54), -INT8_C(  28),  INT8_C( 100),  INT8_C(  43), -INT8_C(  46),  INT8_C(  16),
+        -INT8_C(  65), -INT8_C(  38),  INT8_C( 119),  INT8_C(  84),  INT8_C(  83),  INT8_C( 115),  INT8_C( 122), -INT8_C(  75),
+        -INT8_C(  99),  INT8_C(  10),  INT8_C(  97), -INT8_C(  29),  INT8_C(  88), -INT8_C( 100),  INT8_C(  13),  INT8_C( 114),
+        -INT8_C( 113),  INT8_C(  72),  INT8_C(  85), -INT8_C(  28), -INT8_C(  84), -INT8_C(   8), -INT8_C(  88),  INT8_C( 120) } },
+    { {  INT8_C(   4),  INT8_C( 123), -INT8_C(   3),  INT8_C(  93), -INT8_C( 109), -INT8_C(  67),  INT8_C( 110),  INT8_C(  34),
+         INT8_C(  49), -INT8_C(  62), -INT8_C(  60), -INT8_C(  46), -INT8_C(  54),  INT8_C(  56), -INT8_C(  41), -INT8_C(   2),
+         INT8_C( 126), -INT8_C(  19), -INT8_C( 122),  INT8_C(  62), -INT8_C(  97),  INT8_C( 112),  INT8_C(  86),  INT8_C(  95),
+        -INT8_C(  23), -INT8_C(  73),  INT8_C( 117),  INT8_C(  70),  INT8_C(  16),  INT8_C(   2),  INT8_C(  84),  INT8_C(  21),
+         INT8_C( 125),  INT8_C(  82),  INT8_C( 114),  INT8_C(  17),  INT8_C(  15), -INT8_C(  31),  INT8_C(  51),  INT8_C(  65),
+        -INT8_C(  93), -INT8_C(   9),  INT8_C(  19),  INT8_C( 109),  INT8_C(  47), -INT8_C(  21),  INT8_C( 108), -INT8_C(  83),
+        -INT8_C(  40), -INT8_C(  14), -INT8_C(  21),  INT8_C( 119),  INT8_C(  98),  INT8_C(  66), -INT8_C(  41),  INT8_C(  75),
+        -INT8_C(   7),  INT8_C(  76), -INT8_C( 110),  INT8_C(  10),  INT8_C(  78), -INT8_C(  26),  INT8_C(  31), -INT8_C(  52) },
+      UINT64_C( 1551789629640642872),
+      {  INT8_C(   8), -INT8_C( 100), -INT8_C( 125),  INT8_C(  55), -INT8_C( 121), -INT8_C(  17), -INT8_C(  27),  INT8_C(  95),
+        -INT8_C(  31), -INT8_C(  48), -INT8_C(  41),  INT8_C(  68),  INT8_C(  18), -INT8_C(  82), -INT8_C( 113),  INT8_C(  12),
+        -INT8_C(   6),  INT8_C(  33),  INT8_C(  22),  INT8_C(  72),  INT8_C(   8),  INT8_C(  53),  INT8_C(  20),  INT8_C(  64),
+        -INT8_C(  58), -INT8_C(  15), -INT8_C( 120),  INT8_C(  57),  INT8_C(   2),  INT8_C(  17),  INT8_C(  78),  INT8_C(  10),
+        -INT8_C(  82), -INT8_C(  47),  INT8_C(  65),  INT8_C(  53), -INT8_C(  64),  INT8_C(  38), -INT8_C( 107), -INT8_C(  94),
+        -INT8_C(   9),  INT8_C( 108), -INT8_C(  26),  INT8_C(   9),  INT8_C(  26),  INT8_C( 117),  INT8_C(  21),  INT8_C(  20),
+        -INT8_C( 105),  INT8_C(  43),  INT8_C(  92), -INT8_C(  97),  INT8_C(  96),  INT8_C( 113), -INT8_C(  33),  INT8_C(  39),
+         INT8_C(  98),  INT8_C( 104),  INT8_C(  96),  INT8_C( 100),  INT8_C( 121), -INT8_C(  82),  INT8_C( 110),  INT8_C(  39) },
+      {  INT8_C(   4),  INT8_C( 123), -INT8_C(   3),  INT8_C(   8), -INT8_C( 100), -INT8_C( 125),  INT8_C( 110),  INT8_C(  34),
+         INT8_C(  55), -INT8_C(  62), -INT8_C(  60), -INT8_C(  46), -INT8_C( 121),  INT8_C(  56), -INT8_C(  41), -INT8_C(  17),
+        -INT8_C(  27), -INT8_C(  19),  INT8_C(  95), -INT8_C(  31), -INT8_C(  48),  INT8_C( 112), -INT8_C(  41),  INT8_C(  68),
+        -INT8_C(  23), -INT8_C(  73),  INT8_C( 117),  INT8_C(  18),  INT8_C(  16),  INT8_C(   2), -INT8_C(  82),  INT8_C(  21),
+         INT8_C( 125), -INT8_C( 113),  INT8_C( 114),  INT8_C(  17),  INT8_C(  12), -INT8_C(   6),  INT8_C(  33),  INT8_C(  65),
+        -INT8_C(  93), -INT8_C(   9),  INT8_C(  19),  INT8_C( 109),  INT8_C(  22), -INT8_C(  21),  INT8_C( 108), -INT8_C(  83),
+         INT8_C(  72), -INT8_C(  14), -INT8_C(  21),  INT8_C(   8),  INT8_C(  98),  INT8_C(  66), -INT8_C(  41),  INT8_C(  53),
+         INT8_C(  20),  INT8_C(  76),  INT8_C(  64),  INT8_C(  10), -INT8_C(  58), -INT8_C(  26),  INT8_C(  31), -INT8_C(  52) } },
+    { {      INT8_MIN, -INT8_C(  80),  INT8_C(  93),  INT8_C(  64), -INT8_C(  42), -INT8_C(  14), -INT8_C(  30), -INT8_C(  51),
+         INT8_C(  94), -INT8_C(  56), -INT8_C(  41),  INT8_C( 120),  INT8_C(  62), -INT8_C(  20), -INT8_C( 116), -INT8_C(  43),
+         INT8_C(  24), -INT8_C(  24),  INT8_C( 116),  INT8_C( 120),  INT8_C(  89),  INT8_C(  83), -INT8_C(  97), -INT8_C(  68),
+        -INT8_C(  69), -INT8_C(   1),  INT8_C(  32),  INT8_C(  53), -INT8_C(  82), -INT8_C( 113),  INT8_C(  92),  INT8_C(  46),
+         INT8_C(  63), -INT8_C(  71),  INT8_C( 110),  INT8_C(  21), -INT8_C(  85),  INT8_C(  81), -INT8_C(  29),  INT8_C(   9),
+         INT8_C(  25), -INT8_C(  70), -INT8_C( 127),  INT8_C(  87), -INT8_C(  90),  INT8_C(  13),  INT8_C(  44), -INT8_C(  66),
+        -INT8_C(  10), -INT8_C(  96),  INT8_C(  55),  INT8_C(  79), -INT8_C(  12), -INT8_C(  42),  INT8_C(  11), -INT8_C(  81),
+        -INT8_C(  42),  INT8_C(  44), -INT8_C(  28), -INT8_C( 124), -INT8_C(  69),  INT8_C(  65), -INT8_C(  78), -INT8_C(   6) },
+      UINT64_C(10065530262127583482),
+      { -INT8_C(  84),  INT8_C(  49), -INT8_C(  30),  INT8_C(  83),  INT8_C(  62),  INT8_C(  15),  INT8_C(  17),  INT8_C(  52),
+        -INT8_C(  81),  INT8_C(  72), -INT8_C( 124), -INT8_C(  93),  INT8_C(  31), -INT8_C( 113),  INT8_C(  83), -INT8_C(  11),
+        -INT8_C(  69),  INT8_C(  55),  INT8_C( 121),  INT8_C( 118),  INT8_C( 120),  INT8_C(  43),  INT8_C( 112),  INT8_C( 115),
+         INT8_C(  75),      INT8_MIN,  INT8_C(  25), -INT8_C(  67),  INT8_C( 114), -INT8_C(  56),  INT8_C(  72),  INT8_C(  31),
+        -INT8_C(   7),  INT8_C(  42),  INT8_C( 114),  INT8_C(  56),  INT8_C(  57), -INT8_C( 125),  INT8_C( 108), -INT8_C(  23),
+        -INT8_C(  52), -INT8_C(  16), -INT8_C( 116), -INT8_C(  21),      INT8_MIN, -INT8_C(  33), -INT8_C(  32),  INT8_C(  59),
+         INT8_C(  23),  INT8_C(  89), -INT8_C(  78), -INT8_C( 113), -INT8_C( 124),  INT8_C(  34),  INT8_C(   2), -INT8_C(  49),
+        -INT8_C(  94),  INT8_C(  27), -INT8_C( 116),  INT8_C(  21), -INT8_C(  28), -INT8_C(  44),  INT8_C(  52), -INT8_C(  35) },
+      {      INT8_MIN, -INT8_C(  84),  INT8_C(  93),  INT8_C(  49), -INT8_C(  30),  INT8_C(  83),  INT8_C(  62),  INT8_C(  15),
+         INT8_C(  94), -INT8_C(  56), -INT8_C(  41),  INT8_C( 120),  INT8_C(  62),  INT8_C(  17), -INT8_C( 116), -INT8_C(  43),
+         INT8_C(  52), -INT8_C(  81),  INT8_C(  72), -INT8_C( 124),  INT8_C(  89),  INT8_C(  83), -INT8_C(  97), -INT8_C(  68),
+        -INT8_C(  69), -INT8_C(  93),  INT8_C(  31),  INT8_C(  53), -INT8_C(  82), -INT8_C( 113),  INT8_C(  92),  INT8_C(  83),
+        -INT8_C(  11), -INT8_C(  71),  INT8_C( 110),  INT8_C(  21), -INT8_C(  69),  INT8_C(  55),  INT8_C( 121),  INT8_C(   9),
+         INT8_C(  25),  INT8_C( 118), -INT8_C( 127),  INT8_C(  87),  INT8_C( 120),  INT8_C(  43),  INT8_C( 112),  INT8_C( 115),
+         INT8_C(  75),      INT8_MIN,  INT8_C(  25), -INT8_C(  67), -INT8_C(  12),  INT8_C( 114),  INT8_C(  11), -INT8_C(  56),
+         INT8_C(  72),  INT8_C(  31), -INT8_C(  28), -INT8_C(   7), -INT8_C(  69),  INT8_C(  65), -INT8_C(  78),  INT8_C(  42) } },
+    { { -INT8_C(   1), -INT8_C(  90),  INT8_C(  21),  INT8_C(  56),  INT8_C(  41), -INT8_C( 126),  INT8_C(  33), -INT8_C(  11),
+         INT8_C( 114), -INT8_C(  82), -INT8_C(  32), -INT8_C(  14), -INT8_C( 115), -INT8_C(  64),  INT8_C(  46), -INT8_C(  92),
+         INT8_C(  25), -INT8_C(  32),  INT8_C(  52), -INT8_C(  99),  INT8_C(   2),  INT8_C(  54),  INT8_C( 109), -INT8_C(  91),
+         INT8_C(  82), -INT8_C(   7), -INT8_C(  70),  INT8_C(  54), -INT8_C(  50), -INT8_C(  18),  INT8_C(  19), -INT8_C(  51),
+        -INT8_C( 108),  INT8_C(  41),  INT8_C(   5), -INT8_C(  67), -INT8_C(  85),  INT8_C(  39), -INT8_C(  77),  INT8_C(  29),
+        -INT8_C(  43), -INT8_C( 109),  INT8_C(  16),  INT8_C(  98),  INT8_C(  84),  INT8_C(  62),  INT8_C(   7),  INT8_C( 109),
+         INT8_C(  30),  INT8_C(  59),  INT8_C(  11),  INT8_C(  32),  INT8_C( 113),  INT8_C( 120), -INT8_C(  59), -INT8_C(  61),
+         INT8_C( 113),      INT8_MAX, -INT8_C(   7),  INT8_C(  63),  INT8_C( 109),  INT8_C(  13),  INT8_C(  12),  INT8_C(   1) },
+      UINT64_C( 1080426553541595702),
+      {  INT8_C(   5),  INT8_C(  14),  INT8_C( 112),  INT8_C(  89),  INT8_C(  76),  INT8_C( 119), -INT8_C(  57),  INT8_C( 106),
+        -INT8_C(  78), -INT8_C(  46), -INT8_C( 117),  INT8_C(  36),  INT8_C(  74),  INT8_C(  80), -INT8_C(  25), -INT8_C(  69),
+        -INT8_C(  48), -INT8_C(  31), -INT8_C(   5),  INT8_C(  61), -INT8_C(  18),  INT8_C(   7),  INT8_C(  63),  INT8_C(  36),
+         INT8_C(  25), -INT8_C(   2),  INT8_C(   5),  INT8_C(  82),  INT8_C( 112),  INT8_C(   3),  INT8_C(  96),  INT8_C( 117),
+         INT8_C(  18), -INT8_C(  47), -INT8_C(  49),  INT8_C(  94),  INT8_C(  72), -INT8_C( 106), -INT8_C(  55), -INT8_C(   5),
+         INT8_C( 104),  INT8_C(  84),  INT8_C(  31), -INT8_C(  78), -INT8_C(  92),  INT8_C(   6),  INT8_C( 109),  INT8_C( 116),
+        -INT8_C(  25),  INT8_C( 104), -INT8_C(  78), -INT8_C(  43),  INT8_C( 112), -INT8_C(  15), -INT8_C(   7), -INT8_C( 119),
+        -INT8_C(  17), -INT8_C(   2), -INT8_C(  36),  INT8_C(  95),  INT8_C(   2),  INT8_C(  60), -INT8_C(  44),  INT8_C(  20) },
+      { -INT8_C(   1),  INT8_C(   5),  INT8_C(  14),  INT8_C(  56),  INT8_C( 112),  INT8_C(  89),  INT8_C(  33), -INT8_C(  11),
+         INT8_C( 114),  INT8_C(  76), -INT8_C(  32), -INT8_C(  14),  INT8_C( 119), -INT8_C(  64),  INT8_C(  46), -INT8_C(  92),
+        -INT8_C(  57),  INT8_C( 106), -INT8_C(  78), -INT8_C(  46), -INT8_C( 117),  INT8_C(  36),  INT8_C( 109),  INT8_C(  74),
+         INT8_C(  80), -INT8_C(   7), -INT8_C(  70),  INT8_C(  54), -INT8_C(  50), -INT8_C(  25), -INT8_C(  69), -INT8_C(  48),
+        -INT8_C(  31),  INT8_C(  41),  INT8_C(   5), -INT8_C(   5),  INT8_C(  61), -INT8_C(  18), -INT8_C(  77),  INT8_C(  29),
+        -INT8_C(  43),  INT8_C(   7),  INT8_C(  16),  INT8_C(  98),  INT8_C(  63),  INT8_C(  36),  INT8_C(  25),  INT8_C( 109),
+         INT8_C(  30), -INT8_C(   2),  INT8_C(   5),  INT8_C(  82),  INT8_C( 112),  INT8_C(   3),  INT8_C(  96),  INT8_C( 117),
+         INT8_C( 113),  INT8_C(  18), -INT8_C(  47), -INT8_C(  49),  INT8_C( 109),  INT8_C(  13),  INT8_C(  12),  INT8_C(   1) } },
+    { {  INT8_C(  13), -INT8_C(  93),  INT8_C( 114),  INT8_C(  86),  INT8_C(  57),  INT8_C(  59),  INT8_C(  81), -INT8_C(  95),
+        -INT8_C( 113),  INT8_C( 112),  INT8_C(  83),  INT8_C(  52),  INT8_C( 118), -INT8_C(  63), -INT8_C(  88),  INT8_C(  94),
+         INT8_C(  41),  INT8_C(  90),  INT8_C(  51), -INT8_C( 103),  INT8_C(  75),  INT8_C(  45),  INT8_C(  35),  INT8_C(  58),
+         INT8_C(  43), -INT8_C(   1), -INT8_C( 103),  INT8_C(  45),  INT8_C(  59),  INT8_C( 110),  INT8_C(  65),  INT8_C(  73),
+         INT8_C(  17), -INT8_C(  76), -INT8_C(  97),  INT8_C(  75), -INT8_C(  17), -INT8_C(  16), -INT8_C(  20),      INT8_MAX,
+         INT8_C(  96),  INT8_C(  64), -INT8_C(  77), -INT8_C(  42),  INT8_C(   1),  INT8_C(  91),  INT8_C(  52),  INT8_C(  42),
+        -INT8_C(  74),  INT8_C( 104), -INT8_C(  60),  INT8_C(   1), -INT8_C( 107), -INT8_C(  25),  INT8_C(  60), -INT8_C(  64),
+        -INT8_C(  26), -INT8_C(  43), -INT8_C(  18),  INT8_C(  33),  INT8_C(  67),  INT8_C(  47),  INT8_C( 106),  INT8_C(  85) },
+      UINT64_C( 6436361822091086307),
+      { -INT8_C(  52),  INT8_C(   5),  INT8_C(  48), -INT8_C(  51),  INT8_C(  96),  INT8_C( 100), -INT8_C(   8),  INT8_C(  22),
+        -INT8_C(  52), -INT8_C(  68),  INT8_C(  24),  INT8_C(  97), -INT8_C(  93),  INT8_C(  84),  INT8_C(  34), -INT8_C( 119),
+         INT8_C(  41),  INT8_C(  16), -INT8_C(  86),  INT8_C( 109),  INT8_C(  63),  INT8_C(  21), -INT8_C(  62),  INT8_C(  35),
+         INT8_C(  30),  INT8_C(  98), -INT8_C(  10),  INT8_C(  24), -INT8_C(  18),  INT8_C(  72),  INT8_C( 113), -INT8_C(  69),
+         INT8_C(  77), -INT8_C(  95), -INT8_C( 120), -INT8_C(  83),  INT8_C(   6),      INT8_MIN, -INT8_C(  60), -INT8_C(  46),
+         INT8_C(  60), -INT8_C(  36),  INT8_C(  52), -INT8_C(  33),  INT8_C(  48),  INT8_C(  86),  INT8_C( 104),  INT8_C(  89),
+         INT8_C( 102),  INT8_C(  19), -INT8_C(  58), -INT8_C(  91),  INT8_C(  40), -INT8_C( 120), -INT8_C(  56),  INT8_C(  70),
+        -INT8_C(  22), -INT8_C(  66),  INT8_C(  94), -INT8_C(  39),  INT8_C(   6), -INT8_C(  48), -INT8_C( 108),  INT8_C(  83) },
+      { -INT8_C(  52),  INT8_C(   5),  INT8_C( 114),  INT8_C(  86),  INT8_C(  57),  INT8_C(  48), -INT8_C(  51),  INT8_C(  96),
+         INT8_C( 100),  INT8_C( 112),  INT8_C(  83), -INT8_C(   8),  INT8_C( 118), -INT8_C(  63), -INT8_C(  88),  INT8_C(  94),
+         INT8_C(  41),  INT8_C(  90),  INT8_C(  51), -INT8_C( 103),  INT8_C(  75),  INT8_C(  22),  INT8_C(  35), -INT8_C(  52),
+        -INT8_C(  68),  INT8_C(  24), -INT8_C( 103),  INT8_C(  45),  INT8_C(  97),  INT8_C( 110), -INT8_C(  93),  INT8_C(  84),
+         INT8_C(  34), -INT8_C(  76), -INT8_C(  97), -INT8_C( 119),  INT8_C(  41),  INT8_C(  16), -INT8_C(  86),  INT8_C( 109),
+         INT8_C(  96),  INT8_C(  64),  INT8_C(  63),  INT8_C(  21),  INT8_C(   1),  INT8_C(  91),  INT8_C(  52), -INT8_C(  62),
+        -INT8_C(  74),  INT8_C(  35), -INT8_C(  60),  INT8_C(   1),  INT8_C(  30), -INT8_C(  25),  INT8_C(  98), -INT8_C(  64),
+        -INT8_C(  10), -INT8_C(  43), -INT8_C(  18),  INT8_C(  24), -INT8_C(  18),  INT8_C(  47),  INT8_C(  72),  INT8_C(  85) } },
+    { {  INT8_C( 113),  INT8_C(  28),  INT8_C(   1),  INT8_C( 119), -INT8_C(  99), -INT8_C(  59),  INT8_C(  74), -INT8_C(  39),
+        -INT8_C(  95),  INT8_C( 126), -INT8_C(  71), -INT8_C(  47), -INT8_C(  44),  INT8_C(  33),  INT8_C(  42),  INT8_C(  58),
+         INT8_C(  52), -INT8_C(  15), -INT8_C(  33),  INT8_C(  92),  INT8_C( 121), -INT8_C(  88), -INT8_C(  93),  INT8_C( 100),
+         INT8_C( 102),  INT8_C(   1),  INT8_C(  61),  INT8_C( 109), -INT8_C(  47), -INT8_C(  47), -INT8_C(  64),  INT8_C(  67),
+        -INT8_C(  19), -INT8_C(  63), -INT8_C(  70), -INT8_C( 118), -INT8_C( 122),  INT8_C(   4),  INT8_C( 100),  INT8_C(  39),
+        -INT8_C( 126),  INT8_C(  29), -INT8_C(   8),  INT8_C(  86),  INT8_C(  62),  INT8_C(  35), -INT8_C( 112),  INT8_C( 115),
+         INT8_C(  20),  INT8_C( 112), -INT8_C(  49), -INT8_C( 115),  INT8_C(  24),  INT8_C( 114), -INT8_C(  15),  INT8_C( 126),
+         INT8_C( 116),  INT8_C(  46), -INT8_C(  21),  INT8_C(  69), -INT8_C(   1), -INT8_C(  84), -INT8_C( 120), -INT8_C(  19) },
+      UINT64_C(14563474922123248493),
+      { -INT8_C(   8),  INT8_C(  20),  INT8_C(  32),  INT8_C(  55),  INT8_C(  55), -INT8_C(  79), -INT8_C(  86),  INT8_C(  75),
+         INT8_C(  33),  INT8_C( 121), -INT8_C(  40),  INT8_C(  57), -INT8_C(  20), -INT8_C(  54), -INT8_C(  73),  INT8_C(  96),
+        -INT8_C(   8), -INT8_C(  93), -INT8_C(  91), -INT8_C(   8),  INT8_C(  79),  INT8_C(  46), -INT8_C(  27), -INT8_C(  68),
+         INT8_C( 113),  INT8_C(  92), -INT8_C(  80), -INT8_C(  72),  INT8_C(  56), -INT8_C(  52), -INT8_C( 126),  INT8_C(  48),
+        -INT8_C(  32), -INT8_C(  93),  INT8_C( 103),  INT8_C(  23),  INT8_C(  84),  INT8_C(  17),  INT8_C(  98),  INT8_C( 117),
+        -INT8_C( 117),  INT8_C(  58), -INT8_C(  82),  INT8_C( 119),  INT8_C(   4),  INT8_C( 101), -INT8_C(  41), -INT8_C(   3),
+         INT8_C(   8),  INT8_C( 124), -INT8_C(  11),  INT8_C(  87), -INT8_C(  86), -INT8_C(  38),  INT8_C(  20),  INT8_C(  27),
+         INT8_C(  54), -INT8_C(  60), -INT8_C(  44),  INT8_C( 110), -INT8_C( 112),  INT8_C(  86), -INT8_C(  97),  INT8_C( 112) },
+      { -INT8_C(   8),  INT8_C(  28),  INT8_C(  20),  INT8_C(  32), -INT8_C(  99),  INT8_C(  55),  INT8_C(  55), -INT8_C(  39),
+        -INT8_C(  79), -INT8_C(  86), -INT8_C(  71), -INT8_C(  47), -INT8_C(  44),  INT8_C(  33),  INT8_C(  75),  INT8_C(  58),
+         INT8_C(  33),  INT8_C( 121), -INT8_C(  40),  INT8_C(  92),  INT8_C(  57), -INT8_C(  20), -INT8_C(  54),  INT8_C( 100),
+         INT8_C( 102),  INT8_C(   1), -INT8_C(  73),  INT8_C( 109),  INT8_C(  96), -INT8_C(   8), -INT8_C(  93), -INT8_C(  91),
+        -INT8_C(   8),  INT8_C(  79),  INT8_C(  46), -INT8_C( 118), -INT8_C( 122),  INT8_C(   4), -INT8_C(  27),  INT8_C(  39),
+        -INT8_C(  68),  INT8_C( 113), -INT8_C(   8),  INT8_C(  92), -INT8_C(  80),  INT8_C(  35), -INT8_C(  72),  INT8_C(  56),
+        -INT8_C(  52), -INT8_C( 126), -INT8_C(  49),  INT8_C(  48), -INT8_C(  32),  INT8_C( 114), -INT8_C(  15),  INT8_C( 126),
+         INT8_C( 116), -INT8_C(  93), -INT8_C(  21),  INT8_C( 103), -INT8_C(   1), -INT8_C(  84),  INT8_C(  23),  INT8_C(  84) } },
+    { { -INT8_C(   7),  INT8_C(   6), -INT8_C( 121),  INT8_C(  77),  INT8_C(  24), -INT8_C(  23), -INT8_C(  62), -INT8_C(  93),
+         INT8_C(  36),  INT8_C( 112),  INT8_C(  26),  INT8_C(  40), -INT8_C(  42), -INT8_C(  15),  INT8_C(  37), -INT8_C(  34),
+         INT8_C( 109),  INT8_C(  26),  INT8_C(  54),  INT8_C(  24), -INT8_C(  12),  INT8_C(  74),  INT8_C(  51),  INT8_C(  43),
+         INT8_C(  14),  INT8_C(   7), -INT8_C( 103), -INT8_C(  97),  INT8_C(  94),  INT8_C(  56),  INT8_C(  15),  INT8_C(  87),
+         INT8_C(  63), -INT8_C( 105), -INT8_C(  91),  INT8_C(  87),      INT8_MIN,  INT8_C( 103), -INT8_C(   6), -INT8_C(  92),
+        -INT8_C(  40),  INT8_C(  20), -INT8_C(  51), -INT8_C(  82),  INT8_C(   5), -INT8_C(  14), -INT8_C( 116),  INT8_C( 114),
+         INT8_C(  13), -INT8_C(  62), -INT8_C( 118),  INT8_C(   1),  INT8_C(  12), -INT8_C(  66),  INT8_C(  44),  INT8_C(  27),
+        -INT8_C(  59), -INT8_C(  58), -INT8_C(  70),  INT8_C(  35), -INT8_C(   2), -INT8_C(  55),  INT8_C( 123),  INT8_C(  61) },
+      UINT64_C( 6883064319761981536),
+      { -INT8_C(  94),  INT8_C(  82),  INT8_C(  13), -INT8_C(  89),  INT8_C(  69), -INT8_C( 102),  INT8_C(  26),  INT8_C(  82),
+         INT8_C(  92), -INT8_C(  92),  INT8_C(  83),  INT8_C( 105),  INT8_C(  98),      INT8_MIN, -INT8_C( 124),  INT8_C(  40),
+         INT8_C(  70),  INT8_C(  62),  INT8_C(  75),  INT8_C(  68),  INT8_C(   7), -INT8_C(  58), -INT8_C( 126),  INT8_C( 104),
+        -INT8_C(  26),  INT8_C(  22),  INT8_C(  73),  INT8_C( 110), -INT8_C(  91), -INT8_C(  50), -INT8_C(  51),  INT8_C(  71),
+         INT8_C(  33), -INT8_C(  37), -INT8_C(  17),  INT8_C( 102),  INT8_C( 117),  INT8_C(   9), -INT8_C(  72), -INT8_C(  47),
+        -INT8_C(  83),  INT8_C(  11),  INT8_C(  58),  INT8_C(  16), -INT8_C( 117), -INT8_C(  66),  INT8_C(  56), -INT8_C(  47),
+        -INT8_C(   4), -INT8_C( 125),  INT8_C(  22),  INT8_C(   4),  INT8_C(  74), -INT8_C( 104),  INT8_C( 108),  INT8_C(  48),
+        -INT8_C(  82), -INT8_C(  75), -INT8_C(  98),  INT8_C(  83), -INT8_C( 125),  INT8_C( 108), -INT8_C( 101), -INT8_C(  92) },
+      { -INT8_C(   7),  INT8_C(   6), -INT8_C( 121),  INT8_C(  77),  INT8_C(  24), -INT8_C(  94),  INT8_C(  82), -INT8_C(  93),
+         INT8_C(  36),  INT8_C( 112),  INT8_C(  26),  INT8_C(  40), -INT8_C(  42),  INT8_C(  13),  INT8_C(  37), -INT8_C(  34),
+         INT8_C( 109),  INT8_C(  26), -INT8_C(  89),  INT8_C(  24),  INT8_C(  69),  INT8_C(  74),  INT8_C(  51), -INT8_C( 102),
+         INT8_C(  26),  INT8_C(   7), -INT8_C( 103), -INT8_C(  97),  INT8_C(  94),  INT8_C(  82),  INT8_C(  92), -INT8_C(  92),
+         INT8_C(  83),  INT8_C( 105),  INT8_C(  98),  INT8_C(  87),      INT8_MIN,  INT8_C( 103), -INT8_C(   6),      INT8_MIN,
+        -INT8_C(  40), -INT8_C( 124),  INT8_C(  40),  INT8_C(  70),  INT8_C(   5), -INT8_C(  14), -INT8_C( 116),  INT8_C(  62),
+         INT8_C(  75), -INT8_C(  62),  INT8_C(  68),  INT8_C(   1),  INT8_C(  12), -INT8_C(  66),  INT8_C(  44),  INT8_C(   7),
+        -INT8_C(  58), -INT8_C( 126),  INT8_C( 104), -INT8_C(  26),  INT8_C(  22), -INT8_C(  55),  INT8_C(  73),  INT8_C(  61) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi8(test_vec[i].src);
+    simde__m512i r = simde_mm512_mask_expandloadu_epi8(src, test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_i8x64(r, simde_mm512_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m512i src = simde_test_x86_random_i8x64();
+    simde__mmask64 k = simde_test_x86_random_mmask64();
+    simde__m512i a = simde_test_x86_random_i8x64();
+    simde__m512i r = simde_mm512_mask_expandloadu_epi8(src, k, &a);
+
+    simde_test_x86_write_i8x64(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask64(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x64(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x64(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_maskz_expandloadu_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask64 k;
+    const int8_t a[64];
+    const int8_t r[64];
+  } test_vec[] = {
+    { UINT64_C( 4651587929914378823),
+      { -INT8_C(  50), -INT8_C(  56),  INT8_C(  80),  INT8_C(  89), -INT8_C( 122), -INT8_C( 120),  INT8_C(  43), -INT8_C( 125),
+         INT8_C(  12),  INT8_C(  65), -INT8_C( 121),  INT8_C(  86), -INT8_C(  39), -INT8_C(  13), -INT8_C( 122), -INT8_C( 121),
+        -INT8_C(  88),  INT8_C(  37), -INT8_C(  37),  INT8_C(  43), -INT8_C( 111),  INT8_C( 118), -INT8_C(  48), -INT8_C(  40),
+         INT8_C(   0), -INT8_C(  38), -INT8_C( 108), -INT8_C( 109), -INT8_C(  99),  INT8_C(  33), -INT8_C(  45),  INT8_C( 107),
+        -INT8_C(  23),  INT8_C(  36), -INT8_C(  60),  INT8_C( 112), -INT8_C(  84), -INT8_C(  17), -INT8_C(  13), -INT8_C(  72),
+         INT8_C(  48),  INT8_C( 122),  INT8_C(  14),  INT8_C(   9),  INT8_C( 109), -INT8_C( 107), -INT8_C( 111),  INT8_C(  21),
+        -INT8_C(  70),  INT8_C( 108),  INT8_C(  64),  INT8_C(  75), -INT8_C(  30),  INT8_C(  16),  INT8_C(  35), -INT8_C(  30),
+        -INT8_C(  21), -INT8_C(  73),  INT8_C( 117), -INT8_C( 120), -INT8_C(  40),  INT8_C(  72), -INT8_C(  13), -INT8_C(  62) },
+      { -INT8_C(  50), -INT8_C(  56),  INT8_C(  80),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  89),  INT8_C(   0),
+         INT8_C(   0), -INT8_C( 122),  INT8_C(   0), -INT8_C( 120),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  43),
+         INT8_C(   0), -INT8_C( 125),  INT8_C(   0),  INT8_C(  12),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(  65), -INT8_C( 121),  INT8_C(  86), -INT8_C(  39),  INT8_C(   0), -INT8_C(  13),
+        -INT8_C( 122), -INT8_C( 121),  INT8_C(   0),  INT8_C(   0), -INT8_C(  88),  INT8_C(   0),  INT8_C(   0),  INT8_C(  37),
+         INT8_C(   0), -INT8_C(  37),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  43), -INT8_C( 111),
+         INT8_C( 118),  INT8_C(   0), -INT8_C(  48), -INT8_C(  40),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  38),  INT8_C(   0) } },
+    { UINT64_C(15551252387899553644),
+      { -INT8_C(  97), -INT8_C(  32), -INT8_C(  31),  INT8_C(  12),  INT8_C( 117),  INT8_C( 114),  INT8_C(  33),  INT8_C(  47),
+        -INT8_C(  34),  INT8_C(  97),  INT8_C( 122), -INT8_C(  64),  INT8_C( 114), -INT8_C(  99), -INT8_C(  94),  INT8_C(  93),
+         INT8_C(  84),  INT8_C(  23), -INT8_C(  27),  INT8_C(  44),  INT8_C(  95), -INT8_C(  40), -INT8_C(  18), -INT8_C(  52),
+        -INT8_C( 113),  INT8_C(  32), -INT8_C(  27),  INT8_C(  54),  INT8_C(  69), -INT8_C(  74),  INT8_C(  14), -INT8_C(  28),
+        -INT8_C( 106), -INT8_C(  17), -INT8_C(  16),  INT8_C(  11),  INT8_C(  97),  INT8_C(  17),  INT8_C(  58),  INT8_C(  63),
+         INT8_C( 115), -INT8_C(  76), -INT8_C(   1), -INT8_C(  27),  INT8_C(  81), -INT8_C(  95),  INT8_C(  66), -INT8_C(  91),
+        -INT8_C(  72),  INT8_C(  39), -INT8_C(  46),  INT8_C(  23), -INT8_C(   1), -INT8_C(  64), -INT8_C(  29), -INT8_C( 114),
+        -INT8_C(  31), -INT8_C(  56), -INT8_C(  59),  INT8_C(  38),      INT8_MAX, -INT8_C(  45),  INT8_C(  11),  INT8_C(  21) },
+      {  INT8_C(   0),  INT8_C(   0), -INT8_C(  97), -INT8_C(  32),  INT8_C(   0), -INT8_C(  31),  INT8_C(  12),  INT8_C(   0),
+         INT8_C( 117),  INT8_C( 114),  INT8_C(  33),  INT8_C(   0),  INT8_C(  47), -INT8_C(  34),  INT8_C(   0),  INT8_C(  97),
+         INT8_C(   0),  INT8_C( 122),  INT8_C(   0),  INT8_C(   0), -INT8_C(  64),  INT8_C( 114),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  99),  INT8_C(   0),  INT8_C(   0), -INT8_C(  94),  INT8_C(  93),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  84),  INT8_C(  23), -INT8_C(  27),  INT8_C(   0),  INT8_C(   0),  INT8_C(  44),  INT8_C(   0),  INT8_C(  95),
+        -INT8_C(  40),  INT8_C(   0), -INT8_C(  18),  INT8_C(   0),  INT8_C(   0), -INT8_C(  52),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C( 113),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  32),  INT8_C(   0), -INT8_C(  27),  INT8_C(  54),
+         INT8_C(  69), -INT8_C(  74),  INT8_C(  14),  INT8_C(   0), -INT8_C(  28),  INT8_C(   0), -INT8_C( 106), -INT8_C(  17) } },
+    { UINT64_C( 9251056696554552258),
+      {  INT8_C(  16),  INT8_C(  97),  INT8_C( 101),  INT8_C(  97),  INT8_C(   2), -INT8_C(  89),  INT8_C(   7), -INT8_C(  70),
+        -INT8_C(  50), -INT8_C(  39), -INT8_C(  47), -INT8_C(  51), -INT8_C( 103), -INT8_C(  75),  INT8_C(  91),  INT8_C( 122),
+         INT8_C( 125),  INT8_C(  32), -INT8_C(  95), -INT8_C(   4), -INT8_C(  13), -INT8_C(  84),  INT8_C(  18), -INT8_C(  75),
+        -INT8_C(  89),  INT8_C(  51), -INT8_C(  40), -INT8_C(  76), -INT8_C( 114),  INT8_C(  58),  INT8_C(  52), -INT8_C(  98),
+        -INT8_C( 101), -INT8_C( 103),  INT8_C(   0), -INT8_C(  99),  INT8_C(  64),  INT8_C(   7),  INT8_C(  87),  INT8_C(  14),
+        -INT8_C(  32),  INT8_C(  41), -INT8_C(  37),  INT8_C( 121), -INT8_C(  34),  INT8_C(  55), -INT8_C(  12),  INT8_C(  91),
+         INT8_C(  87), -INT8_C( 107),  INT8_C(  88),  INT8_C(  75),  INT8_C(  65),  INT8_C( 106),  INT8_C(   0), -INT8_C(  24),
+        -INT8_C(  99), -INT8_C(  39), -INT8_C(  99),  INT8_C(  43),  INT8_C(  19), -INT8_C(  47), -INT8_C(  54), -INT8_C(  81) },
+      {  INT8_C(   0),  INT8_C(  16),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  97),  INT8_C( 101),
+         INT8_C(  97),  INT8_C(   2),  INT8_C(   0), -INT8_C(  89),  INT8_C(   7), -INT8_C(  70), -INT8_C(  50), -INT8_C(  39),
+        -INT8_C(  47),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  51),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C( 103), -INT8_C(  75),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  91),  INT8_C(   0),  INT8_C(   0),
+         INT8_C( 122),  INT8_C(   0),  INT8_C( 125),  INT8_C(  32),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  95), -INT8_C(   4),  INT8_C(   0), -INT8_C(  13), -INT8_C(  84),  INT8_C(   0),  INT8_C(  18),  INT8_C(   0),
+         INT8_C(   0), -INT8_C(  75),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  89),  INT8_C(  51),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  40) } },
+    { UINT64_C(12806729710810483307),
+      { -INT8_C(  51), -INT8_C( 107),  INT8_C(  42), -INT8_C(  85), -INT8_C(  52),  INT8_C(  30),  INT8_C(   6),  INT8_C(  36),
+        -INT8_C(  77),  INT8_C(  94),  INT8_C( 111), -INT8_C(  12), -INT8_C(  56),  INT8_C( 111), -INT8_C(  35),  INT8_C( 101),
+         INT8_C(  72),  INT8_C( 122), -INT8_C( 111),  INT8_C(  92),  INT8_C(  75),  INT8_C(  91),  INT8_C(  11), -INT8_C(  74),
+         INT8_C(  37),  INT8_C(  87),  INT8_C(  98), -INT8_C(  10), -INT8_C(   5),  INT8_C(  28), -INT8_C(  89), -INT8_C(  56),
+        -INT8_C(  79), -INT8_C(  47),  INT8_C( 115),  INT8_C( 126), -INT8_C(  16),  INT8_C( 122), -INT8_C(  94), -INT8_C(  93),
+        -INT8_C(  40),  INT8_C(  17), -INT8_C( 104), -INT8_C(  95),      INT8_MIN,  INT8_C( 117),  INT8_C(   6), -INT8_C(  55),
+        -INT8_C(  17), -INT8_C( 105),  INT8_C(  37),  INT8_C(  58), -INT8_C(  14),  INT8_C(  48), -INT8_C(  15),  INT8_C(  23),
+        -INT8_C( 121),  INT8_C(  83),  INT8_C(  13), -INT8_C( 125),  INT8_C( 111), -INT8_C(  76),  INT8_C(  75),  INT8_C(  32) },
+      { -INT8_C(  51), -INT8_C( 107),  INT8_C(   0),  INT8_C(  42),  INT8_C(   0), -INT8_C(  85), -INT8_C(  52),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(  30),  INT8_C(   0),  INT8_C(   6),  INT8_C(   0),  INT8_C(   0),  INT8_C(  36), -INT8_C(  77),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(  94),  INT8_C( 111),  INT8_C(   0),  INT8_C(   0), -INT8_C(  12),  INT8_C(   0),
+        -INT8_C(  56),  INT8_C( 111),  INT8_C(   0), -INT8_C(  35),  INT8_C(   0),  INT8_C( 101),  INT8_C(   0),  INT8_C(  72),
+         INT8_C( 122),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 111),  INT8_C(   0),  INT8_C(  92),  INT8_C(  75),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(  91),  INT8_C(   0),  INT8_C(   0),  INT8_C(  11),  INT8_C(   0), -INT8_C(  74),
+         INT8_C(   0),  INT8_C(  37),  INT8_C(   0),  INT8_C(  87),  INT8_C(  98), -INT8_C(  10),  INT8_C(   0), -INT8_C(   5),
+         INT8_C(  28),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  89), -INT8_C(  56),  INT8_C(   0), -INT8_C(  79) } },
+    { UINT64_C( 1232086588609970054),
+      {  INT8_C(  81), -INT8_C(  79), -INT8_C(  78), -INT8_C(  46),  INT8_C(  38), -INT8_C(  71), -INT8_C( 101),  INT8_C(  21),
+         INT8_C(  80), -INT8_C(  64),  INT8_C(  80),  INT8_C(  67), -INT8_C(  16),  INT8_C(  65),  INT8_C(  90),  INT8_C( 119),
+        -INT8_C( 108),  INT8_C( 104), -INT8_C(   6),  INT8_C(   3),  INT8_C(  28),  INT8_C(  70),  INT8_C(  35), -INT8_C(  94),
+         INT8_C(   5), -INT8_C(  62),  INT8_C(  24),  INT8_C(  62),  INT8_C(   2),  INT8_C(  50),  INT8_C(  79),  INT8_C(  84),
+        -INT8_C(  29),  INT8_C(   2),  INT8_C(  38),  INT8_C(  10), -INT8_C(  69), -INT8_C(  63),  INT8_C(  31),  INT8_C(  11),
+        -INT8_C( 127),  INT8_C( 111),  INT8_C(  78),  INT8_C( 113), -INT8_C(  80), -INT8_C(  87), -INT8_C(  24),  INT8_C(  68),
+         INT8_C(  17), -INT8_C(  29),  INT8_C(  71),  INT8_C(  45),  INT8_C(  41),  INT8_C( 107), -INT8_C(  48),  INT8_C(  46),
+         INT8_C(  45), -INT8_C(  24),  INT8_C( 108),  INT8_C(  47),  INT8_C(  26), -INT8_C(  69), -INT8_C( 125), -INT8_C(   2) },
+      {  INT8_C(   0),  INT8_C(  81), -INT8_C(  79),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  78),
+        -INT8_C(  46),  INT8_C(  38), -INT8_C(  71), -INT8_C( 101),  INT8_C(  21),  INT8_C(  80),  INT8_C(   0), -INT8_C(  64),
+         INT8_C(   0),  INT8_C(  80),  INT8_C(  67), -INT8_C(  16),  INT8_C(  65),  INT8_C(   0),  INT8_C(   0),  INT8_C(  90),
+         INT8_C(   0),  INT8_C( 119), -INT8_C( 108),  INT8_C(   0),  INT8_C( 104), -INT8_C(   6),  INT8_C(   3),  INT8_C(   0),
+         INT8_C(  28),  INT8_C(   0),  INT8_C(   0),  INT8_C(  70),  INT8_C(  35), -INT8_C(  94),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   5),  INT8_C(   0),
+        -INT8_C(  62),  INT8_C(   0),  INT8_C(   0),  INT8_C(  24),  INT8_C(  62),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  50),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C(16970732634072721853),
+      { -INT8_C( 105), -INT8_C(  46),  INT8_C(  92),  INT8_C(  71),  INT8_C( 123),  INT8_C(  69), -INT8_C( 116), -INT8_C( 116),
+         INT8_C(  40), -INT8_C(  45), -INT8_C(  70),  INT8_C(  81),  INT8_C(  62), -INT8_C( 118),      INT8_MAX,  INT8_C( 107),
+         INT8_C( 114), -INT8_C(  21), -INT8_C( 101), -INT8_C( 115), -INT8_C(  90),  INT8_C(  30), -INT8_C( 117),  INT8_C( 100),
+        -INT8_C(  56), -INT8_C( 109), -INT8_C(  36),  INT8_C(  50), -INT8_C(  70),  INT8_C(  96),  INT8_C(  30),  INT8_C(  81),
+         INT8_C(  51),  INT8_C( 122), -INT8_C( 103), -INT8_C(  82), -INT8_C(  65),  INT8_C(  37),  INT8_C(  59), -INT8_C(  25),
+        -INT8_C(   8), -INT8_C(  11),  INT8_C(  56),  INT8_C(  55),      INT8_MAX, -INT8_C(  73), -INT8_C(  94), -INT8_C(  15),
+        -INT8_C(  94),  INT8_C(  61),  INT8_C( 126),  INT8_C(  73),  INT8_C(  92),  INT8_C(   9), -INT8_C(  83),  INT8_C(  36),
+        -INT8_C( 100), -INT8_C( 119),  INT8_C(  86),  INT8_C(  87), -INT8_C(  22),  INT8_C( 116), -INT8_C(  88),  INT8_C(  29) },
+      { -INT8_C( 105),  INT8_C(   0), -INT8_C(  46),  INT8_C(  92),  INT8_C(  71),  INT8_C( 123),  INT8_C(   0),  INT8_C(  69),
+        -INT8_C( 116),  INT8_C(   0),  INT8_C(   0), -INT8_C( 116),  INT8_C(   0),  INT8_C(  40),  INT8_C(   0), -INT8_C(  45),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  70),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  81),  INT8_C(  62), -INT8_C( 118),      INT8_MAX,  INT8_C(   0),
+         INT8_C(   0),  INT8_C( 107),  INT8_C(   0),  INT8_C( 114),  INT8_C(   0), -INT8_C(  21), -INT8_C( 101),  INT8_C(   0),
+        -INT8_C( 115), -INT8_C(  90),  INT8_C(  30),  INT8_C(   0),  INT8_C(   0), -INT8_C( 117),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C( 100),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  56),
+        -INT8_C( 109), -INT8_C(  36),  INT8_C(   0),  INT8_C(  50),  INT8_C(   0), -INT8_C(  70),  INT8_C(  96),  INT8_C(  30) } },
+    { UINT64_C( 6887699718198739439),
+      { -INT8_C(   5), -INT8_C(  50), -INT8_C( 106),  INT8_C( 122), -INT8_C( 122),  INT8_C(  56),  INT8_C( 108),  INT8_C(  40),
+         INT8_C( 118), -INT8_C(  22),  INT8_C( 113), -INT8_C(  46), -INT8_C(  12),  INT8_C(  30), -INT8_C(  10), -INT8_C( 112),
+        -INT8_C(  88),  INT8_C(  76), -INT8_C(  25), -INT8_C( 110), -INT8_C(  63), -INT8_C( 112), -INT8_C(  81), -INT8_C(  80),
+        -INT8_C(  47),  INT8_C( 122),  INT8_C(  94),  INT8_C(  56), -INT8_C( 127), -INT8_C(  12), -INT8_C( 105),  INT8_C( 124),
+        -INT8_C(  61),  INT8_C(  45), -INT8_C(   9),  INT8_C(  73),  INT8_C( 101),  INT8_C(  99),  INT8_C( 113), -INT8_C(  37),
+         INT8_C(  77), -INT8_C(  29), -INT8_C(  83),  INT8_C(  65),  INT8_C(   1), -INT8_C(  93), -INT8_C(  46), -INT8_C(  87),
+        -INT8_C(  16), -INT8_C(  71),  INT8_C(  59), -INT8_C(  79),  INT8_C(  73), -INT8_C(  22),  INT8_C(  97),  INT8_C(  27),
+         INT8_C( 101), -INT8_C(  65),  INT8_C(  83), -INT8_C(  26), -INT8_C(  76), -INT8_C(  22),  INT8_C(  98),  INT8_C( 119) },
+      { -INT8_C(   5), -INT8_C(  50), -INT8_C( 106),  INT8_C( 122),  INT8_C(   0), -INT8_C( 122),  INT8_C(  56),  INT8_C( 108),
+         INT8_C(  40),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 118),  INT8_C(   0),
+        -INT8_C(  22),  INT8_C( 113),  INT8_C(   0), -INT8_C(  46),  INT8_C(   0),  INT8_C(   0), -INT8_C(  12),  INT8_C(  30),
+         INT8_C(   0), -INT8_C(  10), -INT8_C( 112), -INT8_C(  88),  INT8_C(   0),  INT8_C(  76),  INT8_C(   0), -INT8_C(  25),
+         INT8_C(   0), -INT8_C( 110), -INT8_C(  63),  INT8_C(   0),  INT8_C(   0), -INT8_C( 112), -INT8_C(  81),  INT8_C(   0),
+         INT8_C(   0), -INT8_C(  80), -INT8_C(  47),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C( 122),  INT8_C(  94),  INT8_C(   0),  INT8_C(  56),  INT8_C(   0),  INT8_C(   0), -INT8_C( 127),
+        -INT8_C(  12), -INT8_C( 105),  INT8_C( 124), -INT8_C(  61),  INT8_C(  45),  INT8_C(   0), -INT8_C(   9),  INT8_C(   0) } },
+    { UINT64_C(  745400423946410263),
+      {  INT8_C(  20),  INT8_C(   5),  INT8_C(  75),  INT8_C(  22), -INT8_C(  87),  INT8_C(  29), -INT8_C(  65), -INT8_C( 103),
+        -INT8_C(  41), -INT8_C(   5),  INT8_C(  74),  INT8_C(  32), -INT8_C(  27), -INT8_C(  85),  INT8_C(  59),  INT8_C(  74),
+         INT8_C( 106), -INT8_C( 114),  INT8_C(  48),  INT8_C(  30),  INT8_C( 120), -INT8_C( 109), -INT8_C( 107), -INT8_C( 113),
+        -INT8_C(  20),  INT8_C(  85),  INT8_C(  12), -INT8_C(  87), -INT8_C( 121),  INT8_C( 100), -INT8_C(  77), -INT8_C( 101),
+         INT8_C( 105), -INT8_C(   2), -INT8_C(  79),  INT8_C(  18),  INT8_C(  28),  INT8_C( 113), -INT8_C(  85), -INT8_C(  13),
+         INT8_C( 108), -INT8_C(  11),  INT8_C(  19),  INT8_C(  81), -INT8_C(  96),  INT8_C(  79), -INT8_C( 100),  INT8_C(  11),
+        -INT8_C(  35), -INT8_C(  52),  INT8_C(  41),  INT8_C(  86),  INT8_C(  95), -INT8_C(  65), -INT8_C(  27),  INT8_C(  76),
+         INT8_C(  20), -INT8_C(  15), -INT8_C(  11), -INT8_C( 101),  INT8_C(  85), -INT8_C(  88),  INT8_C(  55), -INT8_C(  65) },
+      {  INT8_C(  20),  INT8_C(   5),  INT8_C(  75),  INT8_C(   0),  INT8_C(  22),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  87),  INT8_C(   0),  INT8_C(   0),  INT8_C(  29), -INT8_C(  65),  INT8_C(   0), -INT8_C( 103),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  41), -INT8_C(   5),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(  74),  INT8_C(  32), -INT8_C(  27), -INT8_C(  85),  INT8_C(  59),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(  74),  INT8_C( 106), -INT8_C( 114),  INT8_C(  48),  INT8_C(   0),  INT8_C(  30),
+         INT8_C( 120),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 109), -INT8_C( 107),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 113), -INT8_C(  20),  INT8_C(   0),  INT8_C(  85),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(  12),  INT8_C(   0), -INT8_C(  87),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i r = simde_mm512_maskz_expandloadu_epi8(test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_i8x64(r, simde_mm512_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask64 k = simde_test_x86_random_mmask64();
+    simde__m512i a = simde_test_x86_random_i8x64();
+    simde__m512i r = simde_mm512_maskz_expandloadu_epi8(k, &a);
+
+    simde_test_x86_write_mmask64(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i8x64(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i8x64(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_mask_expand_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int16_t src[32];
+    const simde__mmask32 k;
+    const int16_t a[32];
+    const int16_t r[32];
+  } test_vec[] = {
+    { { -INT16_C(  5978), -INT16_C( 15663),  INT16_C( 32089), -INT16_C( 14923), -INT16_C( 13966),  INT16_C(  4887), -INT16_C( 19688), -INT16_C(  2786),
+         INT16_C( 18303), -INT16_C(  8373),  INT16_C( 12550),  INT16_C(  6955),  INT16_C(  8226),  INT16_C( 30902), -INT16_C(  4664),  INT16_C( 28215),
+         INT16_C(  2262),  INT16_C( 12081), -INT16_C(  6523), -INT16_C(  1803),  INT16_C(  3247), -INT16_C( 14581),  INT16_C( 10687),  INT16_C( 16061),
+         INT16_C(  2160),  INT16_C( 30493),  INT16_C( 18489),  INT16_C( 23698),  INT16_C( 18536),  INT16_C( 12500),  INT16_C(  2870),  INT16_C(  3231) },
+      UINT32_C(2570833939),
+      {  INT16_C( 12470),  INT16_C( 26257), -INT16_C( 25540), -INT16_C(  1235), -INT16_C(  5435),  INT16_C( 13626),  INT16_C( 22515),  INT16_C( 11436),
+         INT16_C( 16032),  INT16_C(  2184),  INT16_C( 23687), -INT16_C( 17095), -INT16_C( 10137),  INT16_C( 31689),  INT16_C(  1192),  INT16_C( 24084),
+        -INT16_C( 23243),  INT16_C( 29124), -INT16_C(  3519),  INT16_C(  1645), -INT16_C( 22564), -INT16_C( 12485), -INT16_C(  5890), -INT16_C( 24836),
+        -INT16_C( 31706), -INT16_C( 21081), -INT16_C(  7967),  INT16_C( 18538),  INT16_C( 13240),  INT16_C( 24771), -INT16_C( 10440),  INT16_C( 28094) },
+      {  INT16_C( 12470),  INT16_C( 26257),  INT16_C( 32089), -INT16_C( 14923), -INT16_C( 25540),  INT16_C(  4887), -INT16_C( 19688), -INT16_C(  2786),
+         INT16_C( 18303), -INT16_C(  8373),  INT16_C( 12550),  INT16_C(  6955), -INT16_C(  1235),  INT16_C( 30902), -INT16_C(  5435),  INT16_C( 13626),
+         INT16_C( 22515),  INT16_C( 11436), -INT16_C(  6523),  INT16_C( 16032),  INT16_C(  2184),  INT16_C( 23687),  INT16_C( 10687),  INT16_C( 16061),
+        -INT16_C( 17095),  INT16_C( 30493),  INT16_C( 18489), -INT16_C( 10137),  INT16_C( 31689),  INT16_C( 12500),  INT16_C(  2870),  INT16_C(  1192) } },
+    { { -INT16_C( 31876), -INT16_C( 16930),  INT16_C( 19317),  INT16_C( 20931), -INT16_C(    14), -INT16_C(  3807),  INT16_C(  7655),  INT16_C(  3471),
+         INT16_C( 13985), -INT16_C( 32069),  INT16_C(  9494), -INT16_C( 12597), -INT16_C( 29095), -INT16_C( 28370), -INT16_C(  4762), -INT16_C(  7426),
+        -INT16_C(  9104), -INT16_C(  6752),  INT16_C( 25384),  INT16_C(  6710),  INT16_C( 22370),  INT16_C( 18699), -INT16_C( 25740),  INT16_C(  5719),
+         INT16_C(  4817), -INT16_C(  5992),  INT16_C( 25399), -INT16_C( 28490), -INT16_C(  6670),  INT16_C( 22561),  INT16_C(  8146),  INT16_C( 16954) },
+      UINT32_C( 606591740),
+      {  INT16_C( 23870), -INT16_C( 24514),  INT16_C( 19125),  INT16_C( 10730),  INT16_C( 16869), -INT16_C( 18881), -INT16_C( 10157), -INT16_C( 30050),
+         INT16_C( 21819),  INT16_C( 11547),  INT16_C( 15418),  INT16_C(  3205), -INT16_C( 16292),  INT16_C( 22606),  INT16_C( 30106), -INT16_C( 10116),
+        -INT16_C( 17710), -INT16_C( 30855),  INT16_C( 25348), -INT16_C(  5711), -INT16_C(  3932), -INT16_C(  2144),  INT16_C( 16072),  INT16_C(  1153),
+        -INT16_C( 25453), -INT16_C( 13007), -INT16_C( 18471),  INT16_C( 13785),  INT16_C( 10103),  INT16_C(  4493),  INT16_C(  2460),  INT16_C( 28650) },
+      { -INT16_C( 31876), -INT16_C( 16930),  INT16_C( 23870), -INT16_C( 24514),  INT16_C( 19125),  INT16_C( 10730),  INT16_C( 16869), -INT16_C( 18881),
+         INT16_C( 13985), -INT16_C( 10157),  INT16_C(  9494), -INT16_C( 30050),  INT16_C( 21819), -INT16_C( 28370),  INT16_C( 11547),  INT16_C( 15418),
+         INT16_C(  3205), -INT16_C( 16292),  INT16_C( 22606),  INT16_C(  6710),  INT16_C( 22370),  INT16_C( 30106), -INT16_C( 25740),  INT16_C(  5719),
+         INT16_C(  4817), -INT16_C(  5992), -INT16_C( 10116), -INT16_C( 28490), -INT16_C(  6670), -INT16_C( 17710),  INT16_C(  8146),  INT16_C( 16954) } },
+    { {  INT16_C( 25539), -INT16_C( 14090), -INT16_C( 22586),  INT16_C( 27313),  INT16_C( 20888),  INT16_C( 24673), -INT16_C(  7536),  INT16_C(  9060),
+        -INT16_C( 27009),  INT16_C( 22769), -INT16_C( 13747), -INT16_C( 15219),  INT16_C(  6898), -INT16_C( 28971), -INT16_C( 16605), -INT16_C(  6403),
+        -INT16_C(  3038), -INT16_C(  5970),  INT16_C( 24731),  INT16_C( 13138), -INT16_C( 19535),  INT16_C( 16788), -INT16_C(  1898),  INT16_C(  5477),
+         INT16_C( 22158), -INT16_C(  9363), -INT16_C(  1504),  INT16_C(  4767),  INT16_C( 29972),  INT16_C( 14241), -INT16_C( 25036),  INT16_C( 22301) },
+      UINT32_C( 775933074),
+      { -INT16_C( 28116), -INT16_C(  8863), -INT16_C(  2747), -INT16_C(  9441), -INT16_C( 31506),  INT16_C( 31984),  INT16_C( 24026), -INT16_C(  1448),
+        -INT16_C(  2217),  INT16_C( 27405), -INT16_C( 20884), -INT16_C( 24158), -INT16_C( 16308), -INT16_C(  8200),  INT16_C( 14220), -INT16_C( 18419),
+         INT16_C( 28361),  INT16_C(  3989), -INT16_C( 19356),  INT16_C( 21226), -INT16_C(  9416),  INT16_C(  4814),  INT16_C(  9784), -INT16_C( 28659),
+         INT16_C(  6686), -INT16_C( 29957), -INT16_C( 24888),  INT16_C(  5163),  INT16_C(  9054), -INT16_C(  5389),  INT16_C(    91),  INT16_C(  9378) },
+      {  INT16_C( 25539), -INT16_C( 28116), -INT16_C( 22586),  INT16_C( 27313), -INT16_C(  8863),  INT16_C( 24673), -INT16_C(  7536), -INT16_C(  2747),
+        -INT16_C( 27009),  INT16_C( 22769), -INT16_C(  9441), -INT16_C( 31506),  INT16_C(  6898), -INT16_C( 28971),  INT16_C( 31984),  INT16_C( 24026),
+        -INT16_C(  1448), -INT16_C(  2217),  INT16_C( 27405), -INT16_C( 20884), -INT16_C( 24158), -INT16_C( 16308), -INT16_C(  1898),  INT16_C(  5477),
+         INT16_C( 22158), -INT16_C(  8200),  INT16_C( 14220), -INT16_C( 18419),  INT16_C( 29972),  INT16_C( 28361), -INT16_C( 25036),  INT16_C( 22301) } },
+    { {  INT16_C( 14191), -INT16_C( 11469),  INT16_C(  7916),  INT16_C(  9253), -INT16_C(  3079),  INT16_C( 12599),  INT16_C( 17434),  INT16_C( 14529),
+        -INT16_C( 17058),  INT16_C(  9922), -INT16_C(  4517), -INT16_C( 18118),  INT16_C( 11793),  INT16_C( 27811),  INT16_C( 17710), -INT16_C( 25199),
+        -INT16_C( 15236),  INT16_C( 26736), -INT16_C( 27166), -INT16_C(  9331), -INT16_C( 15223), -INT16_C( 23795), -INT16_C( 12792),  INT16_C( 26331),
+        -INT16_C( 25205), -INT16_C(  6516), -INT16_C( 14709), -INT16_C( 25185),  INT16_C( 17140),  INT16_C(  8969), -INT16_C( 25977),  INT16_C(  1216) },
+      UINT32_C(1097609567),
+      { -INT16_C(  1594),  INT16_C( 20253),  INT16_C( 10941), -INT16_C( 14862), -INT16_C( 12808), -INT16_C( 31701), -INT16_C( 18581), -INT16_C(  2454),
+         INT16_C(  2686),  INT16_C( 29331), -INT16_C( 25268), -INT16_C( 11115),  INT16_C( 22071), -INT16_C( 26920),  INT16_C( 17543),  INT16_C( 19928),
+        -INT16_C(  2754), -INT16_C(  1123), -INT16_C( 28897),  INT16_C(  6081), -INT16_C(  5027), -INT16_C( 14181),  INT16_C(  1700),  INT16_C(  8894),
+         INT16_C( 21008),  INT16_C( 23700),  INT16_C( 10991),  INT16_C(  9776),  INT16_C(  2176),  INT16_C(  1981), -INT16_C( 27315), -INT16_C( 29868) },
+      { -INT16_C(  1594),  INT16_C( 20253),  INT16_C( 10941), -INT16_C( 14862), -INT16_C( 12808),  INT16_C( 12599), -INT16_C( 31701),  INT16_C( 14529),
+        -INT16_C( 18581),  INT16_C(  9922), -INT16_C(  4517), -INT16_C( 18118), -INT16_C(  2454),  INT16_C(  2686),  INT16_C( 17710), -INT16_C( 25199),
+        -INT16_C( 15236),  INT16_C( 26736),  INT16_C( 29331), -INT16_C( 25268), -INT16_C( 15223), -INT16_C( 11115),  INT16_C( 22071),  INT16_C( 26331),
+        -INT16_C( 26920), -INT16_C(  6516), -INT16_C( 14709), -INT16_C( 25185),  INT16_C( 17140),  INT16_C(  8969),  INT16_C( 17543),  INT16_C(  1216) } },
+    { { -INT16_C(  3702), -INT16_C( 22138),  INT16_C( 18305), -INT16_C(  8512),  INT16_C( 23604), -INT16_C( 10074),  INT16_C( 25698),  INT16_C( 29434),
+        -INT16_C( 29002), -INT16_C( 23090), -INT16_C(    72),  INT16_C( 14540), -INT16_C( 30457),  INT16_C( 21567), -INT16_C( 27618), -INT16_C( 22305),
+         INT16_C( 26245),  INT16_C(  1617),  INT16_C(  4525), -INT16_C(  7708), -INT16_C( 30099), -INT16_C( 12359), -INT16_C( 19473), -INT16_C( 23231),
+         INT16_C(  4162), -INT16_C(  1461),  INT16_C(  5903),  INT16_C(  5683),  INT16_C( 29344), -INT16_C( 16789),  INT16_C( 18950), -INT16_C( 29594) },
+      UINT32_C(1586673584),
+      {  INT16_C( 30664),  INT16_C( 13887), -INT16_C(  1791), -INT16_C(  4091),  INT16_C( 18348), -INT16_C(  4458), -INT16_C(  7849),  INT16_C( 26345),
+         INT16_C(  7416), -INT16_C( 26500), -INT16_C(  6258), -INT16_C( 27306), -INT16_C( 17358), -INT16_C(  7647), -INT16_C( 19597),  INT16_C( 15168),
+        -INT16_C( 32726),  INT16_C( 11377),  INT16_C( 30585),  INT16_C(  9500), -INT16_C( 19778),  INT16_C(  5396), -INT16_C(   621), -INT16_C( 29829),
+        -INT16_C(  2279), -INT16_C( 22749),  INT16_C( 31199),  INT16_C(  4412),  INT16_C( 23861), -INT16_C( 22285),  INT16_C( 13329),  INT16_C( 15332) },
+      { -INT16_C(  3702), -INT16_C( 22138),  INT16_C( 18305), -INT16_C(  8512),  INT16_C( 30664),  INT16_C( 13887),  INT16_C( 25698), -INT16_C(  1791),
+        -INT16_C(  4091),  INT16_C( 18348), -INT16_C(  4458),  INT16_C( 14540), -INT16_C(  7849),  INT16_C( 26345), -INT16_C( 27618),  INT16_C(  7416),
+         INT16_C( 26245), -INT16_C( 26500),  INT16_C(  4525), -INT16_C(  7708), -INT16_C(  6258), -INT16_C( 12359), -INT16_C( 19473), -INT16_C( 27306),
+         INT16_C(  4162), -INT16_C( 17358), -INT16_C(  7647), -INT16_C( 19597),  INT16_C( 15168), -INT16_C( 16789), -INT16_C( 32726), -INT16_C( 29594) } },
+    { {  INT16_C( 21940),  INT16_C( 11623), -INT16_C( 31540), -INT16_C( 30126),  INT16_C( 26166), -INT16_C( 13665),  INT16_C(  6755),  INT16_C( 31829),
+         INT16_C( 30994), -INT16_C(  3804),  INT16_C( 24818),  INT16_C( 10242), -INT16_C(  2626), -INT16_C( 12336), -INT16_C( 19415), -INT16_C(  8950),
+         INT16_C( 29194), -INT16_C( 10742),  INT16_C( 24054),  INT16_C( 11361),  INT16_C(   195),  INT16_C( 10230),  INT16_C( 19483),  INT16_C( 11683),
+        -INT16_C( 14395), -INT16_C( 18658),  INT16_C(  8232), -INT16_C(  6433), -INT16_C( 20459),  INT16_C( 16309), -INT16_C( 16540),  INT16_C( 28188) },
+      UINT32_C( 658843441),
+      { -INT16_C( 22908),  INT16_C( 18260),  INT16_C( 19110), -INT16_C( 16018),  INT16_C(  4758),  INT16_C( 23534),  INT16_C(  3289),  INT16_C(   275),
+        -INT16_C(  3540),  INT16_C( 17127), -INT16_C( 25438),  INT16_C(  1921), -INT16_C( 25252), -INT16_C( 29323), -INT16_C( 17724),  INT16_C( 18613),
+         INT16_C(  2400),  INT16_C(  1936), -INT16_C(   429), -INT16_C(  5432), -INT16_C( 18672), -INT16_C(  5563),  INT16_C( 22723), -INT16_C(  3861),
+        -INT16_C( 11445), -INT16_C(  4814), -INT16_C( 19601), -INT16_C( 13324),  INT16_C( 27216),  INT16_C(  5465),  INT16_C(  3620), -INT16_C( 31395) },
+      { -INT16_C( 22908),  INT16_C( 11623), -INT16_C( 31540), -INT16_C( 30126),  INT16_C( 18260),  INT16_C( 19110),  INT16_C(  6755),  INT16_C( 31829),
+        -INT16_C( 16018),  INT16_C(  4758),  INT16_C( 23534),  INT16_C( 10242), -INT16_C(  2626),  INT16_C(  3289), -INT16_C( 19415), -INT16_C(  8950),
+         INT16_C(   275), -INT16_C( 10742), -INT16_C(  3540),  INT16_C( 11361),  INT16_C(   195),  INT16_C( 10230),  INT16_C( 17127),  INT16_C( 11683),
+        -INT16_C( 25438),  INT16_C(  1921), -INT16_C( 25252), -INT16_C(  6433), -INT16_C( 20459), -INT16_C( 29323), -INT16_C( 16540),  INT16_C( 28188) } },
+    { { -INT16_C(  4841),  INT16_C( 27276),  INT16_C( 21740), -INT16_C(   940), -INT16_C( 26101), -INT16_C( 12314), -INT16_C( 11534),  INT16_C( 15807),
+        -INT16_C(  3675),  INT16_C(  5163),  INT16_C(  8100), -INT16_C(  2848),  INT16_C( 14729), -INT16_C( 20983),  INT16_C( 26439),  INT16_C( 24115),
+        -INT16_C( 16556),  INT16_C( 16584),  INT16_C(  7443),  INT16_C(  7997),  INT16_C(  9143), -INT16_C( 22034), -INT16_C( 21003), -INT16_C( 25881),
+         INT16_C(  4766),  INT16_C( 17071), -INT16_C( 28879), -INT16_C( 17610),  INT16_C( 16584),  INT16_C(  3945), -INT16_C( 25433), -INT16_C(  1171) },
+      UINT32_C(1849439579),
+      {  INT16_C( 31058),  INT16_C(  2445),  INT16_C( 31644), -INT16_C( 27981), -INT16_C( 26072), -INT16_C( 14804), -INT16_C(  9300), -INT16_C(  8952),
+         INT16_C( 16234),  INT16_C( 12952),  INT16_C(   383),  INT16_C(  9793), -INT16_C( 20835), -INT16_C(  2015),  INT16_C( 24036),  INT16_C( 13927),
+        -INT16_C(  2858),  INT16_C( 29504), -INT16_C(  3216), -INT16_C( 26619),  INT16_C( 12685),  INT16_C( 14687),  INT16_C( 26381),  INT16_C( 30486),
+        -INT16_C( 20570),  INT16_C(  9642), -INT16_C(  5200),  INT16_C( 20043),  INT16_C( 28058),  INT16_C( 32326), -INT16_C( 21046), -INT16_C( 24140) },
+      {  INT16_C( 31058),  INT16_C(  2445),  INT16_C( 21740),  INT16_C( 31644), -INT16_C( 27981), -INT16_C( 12314), -INT16_C( 26072),  INT16_C( 15807),
+        -INT16_C( 14804),  INT16_C(  5163), -INT16_C(  9300), -INT16_C(  2848), -INT16_C(  8952),  INT16_C( 16234),  INT16_C( 26439),  INT16_C( 24115),
+        -INT16_C( 16556),  INT16_C( 16584),  INT16_C( 12952),  INT16_C(   383),  INT16_C(  9793), -INT16_C( 20835), -INT16_C( 21003), -INT16_C( 25881),
+         INT16_C(  4766), -INT16_C(  2015),  INT16_C( 24036),  INT16_C( 13927),  INT16_C( 16584), -INT16_C(  2858),  INT16_C( 29504), -INT16_C(  1171) } },
+    { { -INT16_C(  2910),  INT16_C(  4628),  INT16_C(  6631),  INT16_C( 29866),  INT16_C(  2378),  INT16_C( 22445), -INT16_C( 15247),  INT16_C(  6095),
+         INT16_C( 31091),  INT16_C(  9021), -INT16_C( 30620), -INT16_C(   399), -INT16_C( 18187), -INT16_C( 16260),  INT16_C( 12645),  INT16_C(  1889),
+         INT16_C( 29989),  INT16_C(  3353), -INT16_C( 15218), -INT16_C( 10111),  INT16_C( 12237),  INT16_C( 15920), -INT16_C(    13),  INT16_C( 26198),
+        -INT16_C( 27784), -INT16_C(  9079), -INT16_C(  1253),  INT16_C(  4571),  INT16_C( 22451),  INT16_C(  6353),  INT16_C( 12936), -INT16_C( 20960) },
+      UINT32_C( 901462439),
+      {  INT16_C( 15613), -INT16_C( 13555),  INT16_C( 15723),  INT16_C( 24073),  INT16_C( 24380), -INT16_C( 19260),  INT16_C( 20210),  INT16_C(  3729),
+         INT16_C( 27721), -INT16_C(   993), -INT16_C(  3901),  INT16_C( 19476),  INT16_C( 13346), -INT16_C( 13830), -INT16_C( 19090),  INT16_C( 27646),
+         INT16_C(  3057),  INT16_C( 23862),  INT16_C( 16457), -INT16_C( 31301), -INT16_C( 32609), -INT16_C( 28102), -INT16_C( 13362),  INT16_C(  6048),
+        -INT16_C( 16585), -INT16_C(  1517),  INT16_C( 10159), -INT16_C( 11962),  INT16_C( 16476), -INT16_C( 13670), -INT16_C( 26379), -INT16_C(  6347) },
+      {  INT16_C( 15613), -INT16_C( 13555),  INT16_C( 15723),  INT16_C( 29866),  INT16_C(  2378),  INT16_C( 24073), -INT16_C( 15247),  INT16_C( 24380),
+        -INT16_C( 19260),  INT16_C(  9021), -INT16_C( 30620),  INT16_C( 20210),  INT16_C(  3729),  INT16_C( 27721),  INT16_C( 12645),  INT16_C(  1889),
+        -INT16_C(   993), -INT16_C(  3901), -INT16_C( 15218),  INT16_C( 19476),  INT16_C( 13346), -INT16_C( 13830), -INT16_C(    13), -INT16_C( 19090),
+         INT16_C( 27646), -INT16_C(  9079),  INT16_C(  3057),  INT16_C(  4571),  INT16_C( 23862),  INT16_C( 16457),  INT16_C( 12936), -INT16_C( 20960) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi16(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    simde__m512i r = simde_mm512_mask_expand_epi16(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x32(r, simde_mm512_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m512i src = simde_test_x86_random_i16x32();
+    simde__mmask32 k = simde_test_x86_random_mmask32();
+    simde__m512i a = simde_test_x86_random_i16x32();
+    simde__m512i r = simde_mm512_mask_expand_epi16(src, k, a);
+
+    simde_test_x86_write_i16x32(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask32(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i16x32(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i16x32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_maskz_expand_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask32 k;
+    const int16_t a[32];
+    const int16_t r[32];
+  } test_vec[] = {
+    { UINT32_C(3963907235),
+      { -INT16_C(    84),  INT16_C( 19314), -INT16_C( 21377),  INT16_C( 19933),  INT16_C( 32119), -INT16_C( 20892),  INT16_C( 30524), -INT16_C(  5208),
+        -INT16_C(  4193), -INT16_C(  1092),  INT16_C( 22063),  INT16_C(  9669), -INT16_C(  1298), -INT16_C( 28148),  INT16_C( 20582),  INT16_C(  4734),
+        -INT16_C(  4017), -INT16_C( 12450),  INT16_C( 15260),  INT16_C(  4892), -INT16_C( 32327), -INT16_C(  2623),  INT16_C( 27384), -INT16_C( 26655),
+        -INT16_C( 25255), -INT16_C( 30574),  INT16_C( 22516), -INT16_C(  7507), -INT16_C( 18094), -INT16_C( 18316), -INT16_C(  3319),  INT16_C( 22987) },
+      { -INT16_C(    84),  INT16_C( 19314),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 21377),  INT16_C(     0),  INT16_C( 19933),
+         INT16_C(     0),  INT16_C(     0),  INT16_C( 32119), -INT16_C( 20892),  INT16_C(     0),  INT16_C( 30524), -INT16_C(  5208),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0), -INT16_C(  4193),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  1092),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C( 22063),  INT16_C(  9669),  INT16_C(     0), -INT16_C(  1298), -INT16_C( 28148),  INT16_C( 20582) } },
+    { UINT32_C(2150115811),
+      {  INT16_C( 17508),  INT16_C(  7571),  INT16_C( 21957), -INT16_C( 16877), -INT16_C(  2881),  INT16_C(  6229), -INT16_C(  5999), -INT16_C( 31328),
+         INT16_C( 20031), -INT16_C( 28312), -INT16_C(  9209),  INT16_C(  4426),  INT16_C(  5583), -INT16_C( 19606), -INT16_C( 28098), -INT16_C( 24013),
+        -INT16_C( 14634), -INT16_C( 25408), -INT16_C( 11493), -INT16_C(  9638), -INT16_C( 20537),  INT16_C( 22770), -INT16_C( 27753), -INT16_C( 10274),
+         INT16_C( 18145), -INT16_C(  6040), -INT16_C( 19934), -INT16_C(  3335),  INT16_C( 25543),  INT16_C(  1445), -INT16_C(  9995), -INT16_C( 13144) },
+      {  INT16_C( 17508),  INT16_C(  7571),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 21957), -INT16_C( 16877), -INT16_C(  2881),
+         INT16_C(  6229),  INT16_C(     0),  INT16_C(     0), -INT16_C(  5999),  INT16_C(     0), -INT16_C( 31328),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 20031),  INT16_C(     0), -INT16_C( 28312),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  9209) } },
+    { UINT32_C(3127404702),
+      { -INT16_C( 15813),  INT16_C(   660), -INT16_C( 30863),  INT16_C(  2394),  INT16_C( 14362), -INT16_C(  1056),  INT16_C( 18558), -INT16_C( 24093),
+        -INT16_C(  8709), -INT16_C( 15725),  INT16_C( 14400),  INT16_C( 14024),  INT16_C( 28688), -INT16_C( 20990),  INT16_C( 27352),  INT16_C(  4968),
+        -INT16_C(   724), -INT16_C( 25323),  INT16_C( 28548), -INT16_C( 24922), -INT16_C( 31064),  INT16_C(  9881),  INT16_C( 31951), -INT16_C( 13625),
+         INT16_C( 23129), -INT16_C( 25972),  INT16_C( 21650), -INT16_C( 23856), -INT16_C( 11580), -INT16_C( 25519), -INT16_C( 18116),  INT16_C( 26799) },
+      {  INT16_C(     0), -INT16_C( 15813),  INT16_C(   660), -INT16_C( 30863),  INT16_C(  2394),  INT16_C(     0),  INT16_C(     0),  INT16_C( 14362),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  1056),  INT16_C(     0),  INT16_C( 18558), -INT16_C( 24093),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  8709),  INT16_C(     0), -INT16_C( 15725),  INT16_C( 14400),  INT16_C(     0),
+         INT16_C(     0),  INT16_C( 14024),  INT16_C(     0),  INT16_C( 28688), -INT16_C( 20990),  INT16_C( 27352),  INT16_C(     0),  INT16_C(  4968) } },
+    { UINT32_C( 973456566),
+      { -INT16_C( 21452), -INT16_C(  9000),  INT16_C( 28978),  INT16_C(   258), -INT16_C( 13586),  INT16_C( 18379),  INT16_C( 22564), -INT16_C( 18463),
+        -INT16_C( 20052),  INT16_C( 29017), -INT16_C( 21885), -INT16_C( 16627), -INT16_C( 17052),  INT16_C(  6695),  INT16_C( 11649), -INT16_C( 19115),
+         INT16_C( 11737),  INT16_C(  2961), -INT16_C( 27489), -INT16_C( 29427), -INT16_C( 10146), -INT16_C( 32044), -INT16_C( 18896), -INT16_C(  8903),
+        -INT16_C( 27801), -INT16_C(  5298),  INT16_C( 23357), -INT16_C( 24150), -INT16_C( 11752), -INT16_C( 25924),  INT16_C(  4607), -INT16_C( 10161) },
+      {  INT16_C(     0), -INT16_C( 21452), -INT16_C(  9000),  INT16_C(     0),  INT16_C( 28978),  INT16_C(   258),  INT16_C(     0), -INT16_C( 13586),
+         INT16_C(     0),  INT16_C(     0),  INT16_C( 18379),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 22564), -INT16_C( 18463),
+        -INT16_C( 20052),  INT16_C(     0),  INT16_C( 29017),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0), -INT16_C( 21885),  INT16_C(     0), -INT16_C( 16627), -INT16_C( 17052),  INT16_C(  6695),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C(3722699070),
+      { -INT16_C(  3979), -INT16_C( 11414),  INT16_C( 16329), -INT16_C(  1707), -INT16_C( 28683),  INT16_C( 23766),  INT16_C(  9250),  INT16_C( 24391),
+        -INT16_C(  3456), -INT16_C( 26623), -INT16_C( 16956), -INT16_C( 15566), -INT16_C( 32050),  INT16_C(  3227),  INT16_C( 32355), -INT16_C( 10006),
+         INT16_C( 21615),  INT16_C( 14507),  INT16_C(   147), -INT16_C( 30671),  INT16_C(  2191), -INT16_C( 19995),  INT16_C( 11308), -INT16_C( 21487),
+         INT16_C(  4638), -INT16_C(  7611),  INT16_C( 30671), -INT16_C( 25179),  INT16_C( 16633),  INT16_C( 23721), -INT16_C( 27713),  INT16_C( 11828) },
+      {  INT16_C(     0), -INT16_C(  3979), -INT16_C( 11414),  INT16_C( 16329), -INT16_C(  1707), -INT16_C( 28683),  INT16_C(     0),  INT16_C(     0),
+         INT16_C( 23766),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  9250),  INT16_C( 24391), -INT16_C(  3456),
+        -INT16_C( 26623), -INT16_C( 16956),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 15566), -INT16_C( 32050),  INT16_C(  3227),
+         INT16_C( 32355),  INT16_C(     0), -INT16_C( 10006),  INT16_C( 21615),  INT16_C( 14507),  INT16_C(     0),  INT16_C(   147), -INT16_C( 30671) } },
+    { UINT32_C(2070339560),
+      { -INT16_C( 26656),  INT16_C( 28420), -INT16_C(  5729), -INT16_C( 13279),  INT16_C( 12821),  INT16_C( 13432), -INT16_C( 17084),  INT16_C(  4886),
+        -INT16_C( 17355),  INT16_C( 11952),  INT16_C( 23036), -INT16_C( 17525), -INT16_C( 16403), -INT16_C( 10775),  INT16_C( 20383),  INT16_C( 32592),
+         INT16_C( 21735), -INT16_C( 30994),  INT16_C(  3901),  INT16_C( 21330), -INT16_C( 13503), -INT16_C( 31353), -INT16_C( 25208), -INT16_C( 17000),
+         INT16_C( 18521),  INT16_C( 22252),  INT16_C( 30626), -INT16_C( 28911), -INT16_C(  1226), -INT16_C( 10908), -INT16_C( 19382),  INT16_C( 12628) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 26656),  INT16_C(     0),  INT16_C( 28420), -INT16_C(  5729), -INT16_C( 13279),
+         INT16_C( 12821),  INT16_C( 13432), -INT16_C( 17084),  INT16_C(  4886), -INT16_C( 17355),  INT16_C(     0),  INT16_C( 11952),  INT16_C( 23036),
+         INT16_C(     0), -INT16_C( 17525), -INT16_C( 16403),  INT16_C(     0),  INT16_C(     0), -INT16_C( 10775),  INT16_C( 20383),  INT16_C(     0),
+         INT16_C( 32592),  INT16_C( 21735),  INT16_C(     0), -INT16_C( 30994),  INT16_C(  3901),  INT16_C( 21330), -INT16_C( 13503),  INT16_C(     0) } },
+    { UINT32_C(1186480905),
+      {  INT16_C(  2642), -INT16_C( 27495),  INT16_C(  8405),  INT16_C( 24089), -INT16_C( 19778),  INT16_C(  5915),  INT16_C(  2042), -INT16_C( 25491),
+         INT16_C( 32638), -INT16_C( 19157), -INT16_C( 28806), -INT16_C( 15222), -INT16_C(  8380),  INT16_C( 19958), -INT16_C( 20958),  INT16_C( 29843),
+         INT16_C( 11704), -INT16_C( 29176),  INT16_C(  8781),  INT16_C(  3052),  INT16_C(  2004), -INT16_C( 12765), -INT16_C( 28657), -INT16_C( 29333),
+        -INT16_C( 27121), -INT16_C( 30398), -INT16_C( 13018),  INT16_C( 27214),  INT16_C( 17580), -INT16_C( 12617),  INT16_C( 19186), -INT16_C( 21950) },
+      {  INT16_C(  2642),  INT16_C(     0),  INT16_C(     0), -INT16_C( 27495),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(  8405),  INT16_C( 24089),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 19778),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  5915),  INT16_C(  2042), -INT16_C( 25491),  INT16_C(     0),  INT16_C( 32638),
+         INT16_C(     0), -INT16_C( 19157), -INT16_C( 28806),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 15222),  INT16_C(     0) } },
+    { UINT32_C(3308800887),
+      {  INT16_C(  9325),  INT16_C( 16848), -INT16_C(  3284),  INT16_C( 15119),  INT16_C( 31364), -INT16_C( 27704),  INT16_C(  2833),  INT16_C( 14109),
+         INT16_C( 27608), -INT16_C( 31583),  INT16_C( 22703), -INT16_C( 24238), -INT16_C( 27486),  INT16_C(  6731), -INT16_C( 31521),  INT16_C( 19679),
+        -INT16_C( 20568), -INT16_C( 11123), -INT16_C( 25181),  INT16_C(  9999), -INT16_C( 10217),  INT16_C( 10426), -INT16_C( 10269), -INT16_C( 17569),
+         INT16_C(    66), -INT16_C(  3777), -INT16_C( 28328), -INT16_C(  1134), -INT16_C(  8667),  INT16_C(  1301), -INT16_C(  2974),  INT16_C(  2641) },
+      {  INT16_C(  9325),  INT16_C( 16848), -INT16_C(  3284),  INT16_C(     0),  INT16_C( 15119),  INT16_C( 31364), -INT16_C( 27704),  INT16_C(     0),
+         INT16_C(  2833),  INT16_C( 14109),  INT16_C(     0),  INT16_C( 27608),  INT16_C(     0),  INT16_C(     0), -INT16_C( 31583),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 22703), -INT16_C( 24238), -INT16_C( 27486),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(  6731),  INT16_C(     0), -INT16_C( 31521),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 19679), -INT16_C( 20568) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    simde__m512i r = simde_mm512_maskz_expand_epi16(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x32(r, simde_mm512_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask32 k = simde_test_x86_random_mmask32();
+    simde__m512i a = simde_test_x86_random_i16x32();
+    simde__m512i r = simde_mm512_maskz_expand_epi16(k, a);
+
+    simde_test_x86_write_mmask32(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i16x32(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i16x32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_mask_expandloadu_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int16_t src[32];
+    const simde__mmask32 k;
+    const int16_t a[32];
+    const int16_t r[32];
+  } test_vec[] = {
+    { { -INT16_C(  8285),  INT16_C( 18143), -INT16_C(  4484), -INT16_C( 27795),  INT16_C( 10438), -INT16_C( 22084),  INT16_C(  7167),  INT16_C( 16996),
+        -INT16_C( 23780),  INT16_C( 29747), -INT16_C( 14796),  INT16_C( 23151), -INT16_C( 31580),  INT16_C(  1631), -INT16_C( 20360),  INT16_C(  7184),
+        -INT16_C(  4209),  INT16_C(  2914), -INT16_C( 12066), -INT16_C( 23393),  INT16_C( 23544), -INT16_C(  2226), -INT16_C( 19850), -INT16_C( 28103),
+         INT16_C( 27990), -INT16_C( 30201),  INT16_C( 30259), -INT16_C( 10268),  INT16_C( 17403),  INT16_C( 29661), -INT16_C(  4620), -INT16_C( 31857) },
+      UINT32_C(3146773213),
+      {  INT16_C( 11970), -INT16_C( 17825), -INT16_C( 21111), -INT16_C(    79), -INT16_C(  5280), -INT16_C( 18798), -INT16_C( 26280), -INT16_C( 29888),
+         INT16_C(  9487),  INT16_C(  2658),  INT16_C( 16232),  INT16_C( 23678),  INT16_C(  3372),  INT16_C(  2528),  INT16_C( 28671), -INT16_C( 15932),
+         INT16_C(  9373),  INT16_C(  9851),  INT16_C( 11729),  INT16_C( 12581), -INT16_C( 18664),  INT16_C( 28903),  INT16_C( 10320),  INT16_C( 24827),
+         INT16_C( 23885), -INT16_C( 19094), -INT16_C(  5988), -INT16_C( 14318), -INT16_C(  3338), -INT16_C(  2606), -INT16_C( 27039), -INT16_C(   329) },
+      {  INT16_C( 11970),  INT16_C( 18143), -INT16_C( 17825), -INT16_C( 21111), -INT16_C(    79), -INT16_C( 22084), -INT16_C(  5280), -INT16_C( 18798),
+        -INT16_C( 23780), -INT16_C( 26280), -INT16_C( 14796),  INT16_C( 23151), -INT16_C( 29888),  INT16_C(  9487),  INT16_C(  2658),  INT16_C( 16232),
+         INT16_C( 23678),  INT16_C(  3372),  INT16_C(  2528),  INT16_C( 28671),  INT16_C( 23544), -INT16_C(  2226), -INT16_C( 19850), -INT16_C( 15932),
+         INT16_C(  9373),  INT16_C(  9851),  INT16_C( 30259),  INT16_C( 11729),  INT16_C( 12581), -INT16_C( 18664), -INT16_C(  4620),  INT16_C( 28903) } },
+    { {  INT16_C( 12986), -INT16_C( 29660),  INT16_C( 18783),  INT16_C( 30653), -INT16_C( 23295),  INT16_C( 20967), -INT16_C(  7475),  INT16_C(  6833),
+         INT16_C(  7231), -INT16_C(  9265), -INT16_C(  7932), -INT16_C(  1372),  INT16_C( 30419),  INT16_C( 13552), -INT16_C( 22772), -INT16_C( 14542),
+         INT16_C( 22233),  INT16_C( 14675),  INT16_C(  4256), -INT16_C( 24144), -INT16_C( 26443), -INT16_C( 32014), -INT16_C( 23430), -INT16_C( 17764),
+         INT16_C( 27840), -INT16_C( 15211),  INT16_C( 14669),  INT16_C(  8639), -INT16_C( 20561), -INT16_C( 17323), -INT16_C( 30634),  INT16_C( 12163) },
+      UINT32_C(2120799966),
+      {  INT16_C(  6630), -INT16_C( 25569),  INT16_C(  4785),  INT16_C( 11038), -INT16_C( 17482),  INT16_C( 30437),  INT16_C( 31527),  INT16_C( 29754),
+        -INT16_C(  1612),  INT16_C( 25749), -INT16_C(  5208), -INT16_C(   480), -INT16_C( 23693),  INT16_C( 20782), -INT16_C( 27015),  INT16_C( 24528),
+        -INT16_C(  4177),  INT16_C( 24827),  INT16_C(  6657), -INT16_C( 18548),  INT16_C( 29141), -INT16_C(   979),  INT16_C( 26860), -INT16_C( 24208),
+         INT16_C(  1633),  INT16_C(  2565),  INT16_C(  9713),  INT16_C( 25608),  INT16_C( 14024),  INT16_C( 16821), -INT16_C( 31283),  INT16_C( 31904) },
+      {  INT16_C( 12986),  INT16_C(  6630), -INT16_C( 25569),  INT16_C(  4785),  INT16_C( 11038),  INT16_C( 20967), -INT16_C( 17482),  INT16_C( 30437),
+         INT16_C(  7231),  INT16_C( 31527),  INT16_C( 29754), -INT16_C(  1372), -INT16_C(  1612),  INT16_C( 13552),  INT16_C( 25749), -INT16_C(  5208),
+         INT16_C( 22233),  INT16_C( 14675),  INT16_C(  4256), -INT16_C(   480), -INT16_C( 26443), -INT16_C( 23693),  INT16_C( 20782), -INT16_C( 17764),
+         INT16_C( 27840), -INT16_C( 27015),  INT16_C( 24528), -INT16_C(  4177),  INT16_C( 24827),  INT16_C(  6657), -INT16_C( 18548),  INT16_C( 12163) } },
+    { { -INT16_C( 25483),  INT16_C( 30429),  INT16_C( 27062), -INT16_C( 29906),  INT16_C( 23514), -INT16_C( 14457), -INT16_C(  2109),  INT16_C(  9576),
+         INT16_C( 28157), -INT16_C(  4561),  INT16_C( 14226),  INT16_C( 23122),  INT16_C(  2158),  INT16_C( 15259),  INT16_C( 15245),  INT16_C(   695),
+        -INT16_C( 27433), -INT16_C( 29319), -INT16_C( 22531), -INT16_C( 10216), -INT16_C( 24830), -INT16_C( 14689),  INT16_C(  1943), -INT16_C( 27413),
+         INT16_C(  6772),  INT16_C(  1667), -INT16_C( 10927), -INT16_C( 16544), -INT16_C(  1059),  INT16_C( 27642), -INT16_C( 19914),  INT16_C(  3693) },
+      UINT32_C(1151067718),
+      { -INT16_C( 19315), -INT16_C( 28644), -INT16_C( 17581), -INT16_C(  5546),  INT16_C( 16834),  INT16_C( 13951),  INT16_C(   603), -INT16_C( 21444),
+        -INT16_C( 25385), -INT16_C( 19092),  INT16_C( 26263), -INT16_C( 13024), -INT16_C( 29416),  INT16_C( 24539),  INT16_C( 30580),  INT16_C(   419),
+        -INT16_C( 16597),  INT16_C( 32401), -INT16_C(  6278),  INT16_C( 15465), -INT16_C(  6104), -INT16_C( 31886), -INT16_C( 20758), -INT16_C( 16080),
+        -INT16_C( 25526), -INT16_C(  7818), -INT16_C( 27134),  INT16_C(  7086), -INT16_C( 30172), -INT16_C( 26502),  INT16_C(  7425),  INT16_C( 11417) },
+      { -INT16_C( 25483), -INT16_C( 19315), -INT16_C( 28644), -INT16_C( 29906),  INT16_C( 23514), -INT16_C( 14457), -INT16_C( 17581),  INT16_C(  9576),
+         INT16_C( 28157), -INT16_C(  5546),  INT16_C( 16834),  INT16_C( 23122),  INT16_C(  2158),  INT16_C( 13951),  INT16_C(   603), -INT16_C( 21444),
+        -INT16_C( 25385), -INT16_C( 19092), -INT16_C( 22531),  INT16_C( 26263), -INT16_C( 13024), -INT16_C( 14689),  INT16_C(  1943), -INT16_C( 29416),
+         INT16_C(  6772),  INT16_C(  1667),  INT16_C( 24539), -INT16_C( 16544), -INT16_C(  1059),  INT16_C( 27642),  INT16_C( 30580),  INT16_C(  3693) } },
+    { {  INT16_C( 11228),  INT16_C( 22186),  INT16_C(  4882),  INT16_C( 15250),  INT16_C(  1275), -INT16_C(  6722), -INT16_C(  4430), -INT16_C(   857),
+         INT16_C(  7562), -INT16_C( 29219), -INT16_C( 29772), -INT16_C( 10072),  INT16_C(  8725),  INT16_C(  5744),  INT16_C(  2367),  INT16_C(  6978),
+        -INT16_C(  4812),  INT16_C( 18289),  INT16_C(   768), -INT16_C(   894),  INT16_C( 16391), -INT16_C( 17951), -INT16_C( 30673), -INT16_C( 17995),
+        -INT16_C( 27994),  INT16_C( 23110), -INT16_C(  4579),  INT16_C( 13106), -INT16_C( 24048),  INT16_C( 20297), -INT16_C( 29525), -INT16_C(  8086) },
+      UINT32_C(2032655225),
+      { -INT16_C( 22050), -INT16_C(  6795),  INT16_C( 22505),  INT16_C(  6302),  INT16_C( 21471), -INT16_C( 31278),  INT16_C(  6373),  INT16_C(   991),
+         INT16_C(  4359),  INT16_C(  5942),  INT16_C( 32691),  INT16_C( 24423), -INT16_C( 12021), -INT16_C( 31681),  INT16_C( 26285), -INT16_C( 29698),
+         INT16_C( 29455), -INT16_C(  1935),  INT16_C(  4042), -INT16_C( 21999), -INT16_C(  7325),  INT16_C( 18479),  INT16_C(  4091),  INT16_C(   587),
+        -INT16_C( 32480), -INT16_C( 11238), -INT16_C( 32511),  INT16_C(  3123),  INT16_C( 29266), -INT16_C(   111), -INT16_C( 28712), -INT16_C(  6261) },
+      { -INT16_C( 22050),  INT16_C( 22186),  INT16_C(  4882), -INT16_C(  6795),  INT16_C( 22505),  INT16_C(  6302),  INT16_C( 21471), -INT16_C(   857),
+        -INT16_C( 31278),  INT16_C(  6373), -INT16_C( 29772),  INT16_C(   991),  INT16_C(  4359),  INT16_C(  5744),  INT16_C(  5942),  INT16_C( 32691),
+         INT16_C( 24423), -INT16_C( 12021), -INT16_C( 31681), -INT16_C(   894),  INT16_C( 16391),  INT16_C( 26285), -INT16_C( 30673), -INT16_C( 17995),
+        -INT16_C( 29698),  INT16_C( 23110), -INT16_C(  4579),  INT16_C( 29455), -INT16_C(  1935),  INT16_C(  4042), -INT16_C( 21999), -INT16_C(  8086) } },
+    { { -INT16_C(  1022), -INT16_C( 12833), -INT16_C(  4085),  INT16_C( 28279), -INT16_C( 22829), -INT16_C( 12361),  INT16_C(   693), -INT16_C( 10543),
+        -INT16_C(  5244), -INT16_C( 31318), -INT16_C(  8852), -INT16_C( 16495),  INT16_C(  8783),  INT16_C( 10174),  INT16_C( 18865), -INT16_C( 19442),
+        -INT16_C(  4795),  INT16_C( 20865), -INT16_C(  1826), -INT16_C( 20033),  INT16_C( 30366),  INT16_C( 21632),  INT16_C( 21113), -INT16_C(   726),
+        -INT16_C( 11203), -INT16_C( 21886),  INT16_C(  5041),  INT16_C(   105),  INT16_C( 10038), -INT16_C(  6361),  INT16_C( 13681), -INT16_C( 18789) },
+      UINT32_C(    465954),
+      { -INT16_C( 14572), -INT16_C( 19534),  INT16_C( 12861), -INT16_C( 18937),  INT16_C( 12676), -INT16_C( 15693),  INT16_C( 13573), -INT16_C( 18836),
+        -INT16_C( 10935),  INT16_C( 32694), -INT16_C(  8708),  INT16_C( 28006),  INT16_C(   530),  INT16_C( 13348),  INT16_C( 11038),  INT16_C( 13109),
+        -INT16_C(  6158),  INT16_C( 12518), -INT16_C(  4839), -INT16_C( 24858), -INT16_C( 26082),  INT16_C(  9056), -INT16_C( 13105),  INT16_C(  6361),
+        -INT16_C( 28767), -INT16_C( 25193), -INT16_C(   404),  INT16_C( 32267),  INT16_C( 12032),  INT16_C(  7858), -INT16_C(  6310),  INT16_C( 19793) },
+      { -INT16_C(  1022), -INT16_C( 14572), -INT16_C(  4085),  INT16_C( 28279), -INT16_C( 22829), -INT16_C( 19534),  INT16_C(   693), -INT16_C( 10543),
+        -INT16_C(  5244), -INT16_C( 31318),  INT16_C( 12861), -INT16_C( 18937),  INT16_C( 12676),  INT16_C( 10174),  INT16_C( 18865), -INT16_C( 19442),
+        -INT16_C( 15693),  INT16_C( 13573), -INT16_C( 18836), -INT16_C( 20033),  INT16_C( 30366),  INT16_C( 21632),  INT16_C( 21113), -INT16_C(   726),
+        -INT16_C( 11203), -INT16_C( 21886),  INT16_C(  5041),  INT16_C(   105),  INT16_C( 10038), -INT16_C(  6361),  INT16_C( 13681), -INT16_C( 18789) } },
+    { {  INT16_C( 14286), -INT16_C(  6019),  INT16_C( 25380),  INT16_C( 17030), -INT16_C(  6403), -INT16_C( 12955),  INT16_C( 16050),  INT16_C( 21477),
+         INT16_C( 32205),  INT16_C( 14832), -INT16_C(  1157),  INT16_C( 31671),  INT16_C( 27178), -INT16_C( 31335), -INT16_C(  5295),  INT16_C(  8402),
+         INT16_C( 20258),  INT16_C( 18184), -INT16_C( 29006), -INT16_C( 20343), -INT16_C(  4236),  INT16_C(  9853),  INT16_C( 25133), -INT16_C(  1159),
+         INT16_C( 27103),  INT16_C( 23092), -INT16_C(  5019), -INT16_C( 28715),  INT16_C( 28502), -INT16_C( 22764), -INT16_C(  6566),  INT16_C( 31943) },
+      UINT32_C(3905146677),
+      {  INT16_C( 19805), -INT16_C( 11880),  INT16_C(  5436),  INT16_C( 27127),  INT16_C( 28791),  INT16_C( 22372), -INT16_C( 26150),  INT16_C( 16305),
+        -INT16_C( 30843), -INT16_C(  9266), -INT16_C(  7178),  INT16_C( 20610),  INT16_C( 19145), -INT16_C(    52), -INT16_C( 28647),  INT16_C( 30695),
+         INT16_C( 32733),  INT16_C(  6472),  INT16_C( 16532),  INT16_C(  2946), -INT16_C(  6224), -INT16_C( 30110),  INT16_C(  5248),  INT16_C(  1481),
+        -INT16_C( 26469), -INT16_C( 28192),  INT16_C( 25211),  INT16_C( 17633), -INT16_C( 21076), -INT16_C( 14781),  INT16_C( 10813),  INT16_C(  6717) },
+      {  INT16_C( 19805), -INT16_C(  6019), -INT16_C( 11880),  INT16_C( 17030),  INT16_C(  5436),  INT16_C( 27127),  INT16_C( 16050),  INT16_C( 21477),
+         INT16_C( 28791),  INT16_C( 22372), -INT16_C( 26150),  INT16_C( 16305),  INT16_C( 27178), -INT16_C( 31335), -INT16_C( 30843), -INT16_C(  9266),
+        -INT16_C(  7178),  INT16_C( 20610), -INT16_C( 29006), -INT16_C( 20343), -INT16_C(  4236),  INT16_C(  9853),  INT16_C( 19145), -INT16_C(    52),
+         INT16_C( 27103),  INT16_C( 23092), -INT16_C(  5019), -INT16_C( 28647),  INT16_C( 28502),  INT16_C( 30695),  INT16_C( 32733),  INT16_C(  6472) } },
+    { { -INT16_C( 31319),  INT16_C( 15667), -INT16_C( 18747),  INT16_C( 30281), -INT16_C( 21603),  INT16_C(  7424), -INT16_C( 13633),  INT16_C( 23074),
+         INT16_C(   610), -INT16_C(  8725), -INT16_C( 13212),  INT16_C(  4385),  INT16_C( 25978), -INT16_C( 18473),  INT16_C(  5263),  INT16_C( 14802),
+         INT16_C(  1433),  INT16_C( 24438), -INT16_C( 16453),  INT16_C( 22741), -INT16_C( 10901),  INT16_C( 10869), -INT16_C( 26721),  INT16_C(   389),
+         INT16_C( 28825), -INT16_C(   290),  INT16_C(    61), -INT16_C( 18673), -INT16_C(  6555), -INT16_C(  2962),  INT16_C( 16634), -INT16_C( 27859) },
+      UINT32_C(  32678982),
+      { -INT16_C( 14493), -INT16_C( 12710), -INT16_C( 12387),  INT16_C( 15609),  INT16_C( 32359),  INT16_C(    62),  INT16_C(  7406),  INT16_C( 11262),
+         INT16_C(  3356), -INT16_C( 32286),  INT16_C( 20979), -INT16_C(  4746), -INT16_C( 23663), -INT16_C( 10367),  INT16_C( 29511), -INT16_C( 21543),
+         INT16_C( 13115), -INT16_C( 10119),  INT16_C( 29186),  INT16_C( 26900),  INT16_C( 21232), -INT16_C(  8342),  INT16_C( 26735), -INT16_C( 29942),
+        -INT16_C(  4746),  INT16_C( 26893), -INT16_C( 31938), -INT16_C( 12457), -INT16_C( 10202),  INT16_C( 28327), -INT16_C( 32693), -INT16_C( 31207) },
+      { -INT16_C( 31319), -INT16_C( 14493), -INT16_C( 12710),  INT16_C( 30281), -INT16_C( 21603),  INT16_C(  7424), -INT16_C( 12387),  INT16_C( 23074),
+         INT16_C(   610), -INT16_C(  8725),  INT16_C( 15609),  INT16_C(  4385),  INT16_C( 25978),  INT16_C( 32359),  INT16_C(  5263),  INT16_C(    62),
+         INT16_C(  1433),  INT16_C(  7406), -INT16_C( 16453),  INT16_C( 22741),  INT16_C( 11262),  INT16_C(  3356), -INT16_C( 32286),  INT16_C( 20979),
+        -INT16_C(  4746), -INT16_C(   290),  INT16_C(    61), -INT16_C( 18673), -INT16_C(  6555), -INT16_C(  2962),  INT16_C( 16634), -INT16_C( 27859) } },
+    { { -INT16_C( 27981), -INT16_C( 19106),  INT16_C( 29445), -INT16_C(  2785), -INT16_C( 30267),  INT16_C( 13524), -INT16_C(  8207),  INT16_C( 26560),
+        -INT16_C( 12852),  INT16_C(  2769),  INT16_C( 10320),  INT16_C( 30425),        INT16_MIN,  INT16_C( 19428), -INT16_C(   768), -INT16_C( 19502),
+         INT16_C( 12432), -INT16_C( 27287), -INT16_C( 30557),  INT16_C( 27018),  INT16_C( 24337),  INT16_C(   669),  INT16_C( 23870),  INT16_C(  2666),
+         INT16_C( 15146),  INT16_C( 31252), -INT16_C(  4765),  INT16_C( 25585), -INT16_C( 10898),  INT16_C( 28334), -INT16_C( 32557),  INT16_C( 25378) },
+      UINT32_C(1425574833),
+      { -INT16_C( 32237),  INT16_C(  9405),  INT16_C( 23521),  INT16_C(  7974), -INT16_C( 28488), -INT16_C(  7383),  INT16_C( 15819),  INT16_C( 11869),
+         INT16_C( 20011), -INT16_C( 26223),  INT16_C( 16420), -INT16_C(  2297),  INT16_C( 10688),  INT16_C( 29018),  INT16_C( 21172), -INT16_C( 14394),
+        -INT16_C( 31788), -INT16_C( 18709),  INT16_C(  4830), -INT16_C( 26667), -INT16_C(    94),  INT16_C( 28282), -INT16_C( 10436),  INT16_C( 26524),
+         INT16_C( 11814),  INT16_C( 18944),  INT16_C(  2158),  INT16_C( 11841), -INT16_C( 25807), -INT16_C(  6496),  INT16_C( 26349), -INT16_C( 15955) },
+      { -INT16_C( 32237), -INT16_C( 19106),  INT16_C( 29445), -INT16_C(  2785),  INT16_C(  9405),  INT16_C( 23521), -INT16_C(  8207),  INT16_C(  7974),
+        -INT16_C( 28488), -INT16_C(  7383),  INT16_C( 10320),  INT16_C( 15819),        INT16_MIN,  INT16_C( 19428), -INT16_C(   768),  INT16_C( 11869),
+         INT16_C( 12432), -INT16_C( 27287), -INT16_C( 30557),  INT16_C( 20011), -INT16_C( 26223),  INT16_C( 16420), -INT16_C(  2297),  INT16_C( 10688),
+         INT16_C( 15146),  INT16_C( 31252),  INT16_C( 29018),  INT16_C( 25585),  INT16_C( 21172),  INT16_C( 28334), -INT16_C( 14394),  INT16_C( 25378) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi16(test_vec[i].src);
+    simde__m512i r = simde_mm512_mask_expandloadu_epi16(src, test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_i16x32(r, simde_mm512_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m512i src = simde_test_x86_random_i16x32();
+    simde__mmask32 k = simde_test_x86_random_mmask32();
+    simde__m512i a = simde_test_x86_random_i16x32();
+    simde__m512i r = simde_mm512_mask_expandloadu_epi16(src, k, &a);
+
+    simde_test_x86_write_i16x32(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask32(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i16x32(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i16x32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_maskz_expandloadu_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask32 k;
+    const int16_t a[32];
+    const int16_t r[32];
+  } test_vec[] = {
+    { UINT32_C(3363281385),
+      {  INT16_C( 19883),  INT16_C( 19807), -INT16_C(  9908), -INT16_C( 30533),  INT16_C( 22704), -INT16_C( 10512), -INT16_C(  3962), -INT16_C(  3040),
+         INT16_C( 25080),  INT16_C( 10786), -INT16_C( 15620), -INT16_C(  5872), -INT16_C( 17112),  INT16_C(  4779),  INT16_C(  8790),  INT16_C(   474),
+         INT16_C( 14703), -INT16_C( 17585),  INT16_C(  2578), -INT16_C( 15804),  INT16_C( 13410), -INT16_C(  5991), -INT16_C( 18140),  INT16_C(  7644),
+        -INT16_C(   229),  INT16_C(  5959),  INT16_C( 22465), -INT16_C(  5631), -INT16_C( 21484),  INT16_C( 27644), -INT16_C( 10546),  INT16_C( 15980) },
+      {  INT16_C( 19883),  INT16_C(     0),  INT16_C(     0),  INT16_C( 19807),  INT16_C(     0), -INT16_C(  9908), -INT16_C( 30533),  INT16_C( 22704),
+        -INT16_C( 10512),  INT16_C(     0),  INT16_C(     0), -INT16_C(  3962), -INT16_C(  3040),  INT16_C(     0),  INT16_C(     0),  INT16_C( 25080),
+         INT16_C( 10786), -INT16_C( 15620), -INT16_C(  5872),  INT16_C(     0), -INT16_C( 17112),  INT16_C(  4779),  INT16_C(  8790),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   474),  INT16_C(     0),  INT16_C(     0),  INT16_C( 14703), -INT16_C( 17585) } },
+    { UINT32_C( 570014479),
+      {  INT16_C( 15814),  INT16_C( 10467),  INT16_C( 31857), -INT16_C( 27119), -INT16_C(  4810),  INT16_C( 20915), -INT16_C(  1300), -INT16_C( 20888),
+         INT16_C( 26961),  INT16_C( 26008), -INT16_C( 27627), -INT16_C(  6960),  INT16_C( 15722),  INT16_C( 31010),  INT16_C(  7160), -INT16_C( 16742),
+         INT16_C( 32089), -INT16_C( 13593), -INT16_C(  1798),  INT16_C( 12384),  INT16_C(  5093), -INT16_C( 11647), -INT16_C(  5875),  INT16_C( 24192),
+         INT16_C(  6227),  INT16_C( 26820), -INT16_C( 27476),  INT16_C(  5708),  INT16_C( 28369), -INT16_C( 13681),  INT16_C( 10634), -INT16_C(  7288) },
+      {  INT16_C( 15814),  INT16_C( 10467),  INT16_C( 31857), -INT16_C( 27119),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+        -INT16_C(  4810),  INT16_C( 20915),  INT16_C(     0), -INT16_C(  1300), -INT16_C( 20888),  INT16_C( 26961),  INT16_C(     0),  INT16_C( 26008),
+        -INT16_C( 27627),  INT16_C(     0),  INT16_C(     0), -INT16_C(  6960),  INT16_C( 15722),  INT16_C( 31010),  INT16_C(  7160), -INT16_C( 16742),
+         INT16_C( 32089),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 13593),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C(2695720870),
+      {  INT16_C(  3687),  INT16_C( 19920),  INT16_C( 20769),  INT16_C( 12063), -INT16_C( 24773), -INT16_C( 29043),  INT16_C( 20919),  INT16_C( 25590),
+         INT16_C( 17382), -INT16_C( 18567),  INT16_C(  2225),  INT16_C( 15233),  INT16_C(  2609), -INT16_C( 10466), -INT16_C( 13191), -INT16_C(  7816),
+         INT16_C( 18650), -INT16_C(  1234),  INT16_C( 19866), -INT16_C( 10966), -INT16_C( 18196), -INT16_C( 23709),  INT16_C( 22793), -INT16_C(  4346),
+         INT16_C( 32668),  INT16_C( 20135),  INT16_C( 10375), -INT16_C( 18295), -INT16_C( 22478), -INT16_C( 21361),  INT16_C(  1908),  INT16_C( 20109) },
+      {  INT16_C(     0),  INT16_C(  3687),  INT16_C( 19920),  INT16_C(     0),  INT16_C(     0),  INT16_C( 20769),  INT16_C(     0),  INT16_C( 12063),
+        -INT16_C( 24773), -INT16_C( 29043),  INT16_C( 20919),  INT16_C( 25590),  INT16_C(     0),  INT16_C( 17382), -INT16_C( 18567),  INT16_C(     0),
+         INT16_C(  2225),  INT16_C(     0),  INT16_C( 15233),  INT16_C(  2609),  INT16_C(     0), -INT16_C( 10466),  INT16_C(     0), -INT16_C( 13191),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  7816),  INT16_C(     0),  INT16_C( 18650) } },
+    { UINT32_C(3930700624),
+      {  INT16_C( 29704), -INT16_C(  2881),  INT16_C(  8748),  INT16_C( 13719), -INT16_C( 25221),  INT16_C(  6181), -INT16_C( 13284), -INT16_C( 23706),
+        -INT16_C(  4108),  INT16_C( 10075), -INT16_C(  5481),  INT16_C(  3027),  INT16_C( 24818),  INT16_C( 16985), -INT16_C( 23781),  INT16_C(  9004),
+        -INT16_C(  5353),  INT16_C( 17175), -INT16_C( 20979), -INT16_C( 30600), -INT16_C( 25269),  INT16_C( 26528),  INT16_C(  1641),  INT16_C( 24074),
+         INT16_C( 26102), -INT16_C( 29307),  INT16_C( 22607),  INT16_C( 16793), -INT16_C(  3400), -INT16_C( 11389), -INT16_C( 20587), -INT16_C( 21258) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 29704),  INT16_C(     0), -INT16_C(  2881),  INT16_C(     0),
+         INT16_C(  8748),  INT16_C( 13719),  INT16_C(     0), -INT16_C( 25221),  INT16_C(  6181), -INT16_C( 13284),  INT16_C(     0), -INT16_C( 23706),
+        -INT16_C(  4108),  INT16_C(     0),  INT16_C(     0),  INT16_C( 10075),  INT16_C(     0),  INT16_C(     0), -INT16_C(  5481),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(  3027),  INT16_C(     0),  INT16_C( 24818),  INT16_C(     0),  INT16_C( 16985), -INT16_C( 23781),  INT16_C(  9004) } },
+    { UINT32_C(2817461658),
+      {  INT16_C( 26811),  INT16_C(  1584), -INT16_C( 12283),  INT16_C( 28525),  INT16_C( 30679), -INT16_C( 12851),  INT16_C( 21212),  INT16_C( 11098),
+        -INT16_C(  3158),  INT16_C( 25197), -INT16_C(  3866),  INT16_C( 31541),  INT16_C( 11168),  INT16_C( 14888),  INT16_C(  5944), -INT16_C(  3102),
+         INT16_C(  4735), -INT16_C( 31239),  INT16_C( 26338), -INT16_C( 17932), -INT16_C( 15907), -INT16_C( 18042), -INT16_C(  7917), -INT16_C( 16924),
+         INT16_C( 20948), -INT16_C( 17889),  INT16_C( 21570), -INT16_C(  7626),  INT16_C( 24191), -INT16_C( 18660), -INT16_C(   395), -INT16_C(  2646) },
+      {  INT16_C(     0),  INT16_C( 26811),  INT16_C(     0),  INT16_C(  1584), -INT16_C( 12283),  INT16_C(     0),  INT16_C(     0),  INT16_C( 28525),
+         INT16_C( 30679),  INT16_C(     0), -INT16_C( 12851),  INT16_C( 21212),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C( 11098), -INT16_C(  3158),  INT16_C( 25197), -INT16_C(  3866),  INT16_C(     0),  INT16_C( 31541),  INT16_C( 11168),  INT16_C( 14888),
+         INT16_C(  5944), -INT16_C(  3102),  INT16_C(  4735),  INT16_C(     0),  INT16_C(     0), -INT16_C( 31239),  INT16_C(     0),  INT16_C( 26338) } },
+    { UINT32_C(4084900624),
+      {  INT16_C( 28169), -INT16_C(  6484),  INT16_C( 13103),  INT16_C( 17055), -INT16_C( 31980), -INT16_C(  5889),  INT16_C(  7893),  INT16_C(  6051),
+        -INT16_C(  9870), -INT16_C(  3591),  INT16_C(  5431), -INT16_C( 21336),  INT16_C( 21012),  INT16_C(  9377),  INT16_C(  7157), -INT16_C(   489),
+        -INT16_C( 15223), -INT16_C( 18204), -INT16_C( 31753),  INT16_C(  3066), -INT16_C(  1786), -INT16_C(  9229), -INT16_C( 27113), -INT16_C( 30222),
+        -INT16_C(  5265), -INT16_C( 22918),  INT16_C(  8705),  INT16_C(  5459), -INT16_C(  2956),  INT16_C( 26937),  INT16_C( 20752), -INT16_C( 26265) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 28169),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+        -INT16_C(  6484),  INT16_C( 13103),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 17055),  INT16_C(     0), -INT16_C( 31980),
+         INT16_C(     0), -INT16_C(  5889),  INT16_C(     0),  INT16_C(  7893),  INT16_C(  6051), -INT16_C(  9870), -INT16_C(  3591),  INT16_C(     0),
+         INT16_C(  5431), -INT16_C( 21336),  INT16_C(     0),  INT16_C(     0),  INT16_C( 21012),  INT16_C(  9377),  INT16_C(  7157), -INT16_C(   489) } },
+    { UINT32_C( 206719765),
+      {  INT16_C( 19662), -INT16_C( 10985),  INT16_C(  2630),  INT16_C( 23984), -INT16_C( 23647),  INT16_C(  4327),  INT16_C( 24974), -INT16_C( 28745),
+         INT16_C(  2692), -INT16_C(  1884), -INT16_C(  8450),  INT16_C(  3682), -INT16_C( 14033),  INT16_C( 17576), -INT16_C(  1515), -INT16_C(  7344),
+         INT16_C( 26438), -INT16_C( 29512),  INT16_C( 26993),  INT16_C(  4842), -INT16_C( 12020), -INT16_C( 26077), -INT16_C(  9678), -INT16_C( 18902),
+        -INT16_C( 12572), -INT16_C(  7505),  INT16_C(  4524), -INT16_C(  9231), -INT16_C( 26150), -INT16_C(  4321),  INT16_C( 28563), -INT16_C(  9773) },
+      {  INT16_C( 19662),  INT16_C(     0), -INT16_C( 10985),  INT16_C(     0),  INT16_C(  2630),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C( 23984), -INT16_C( 23647),  INT16_C(     0),  INT16_C(  4327),  INT16_C(     0),  INT16_C(     0),  INT16_C( 24974),  INT16_C(     0),
+         INT16_C(     0), -INT16_C( 28745),  INT16_C(     0),  INT16_C(     0),  INT16_C(  2692),  INT16_C(     0), -INT16_C(  1884),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0), -INT16_C(  8450),  INT16_C(  3682),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C(1214680022),
+      {  INT16_C( 20724),  INT16_C(    90),  INT16_C( 32033),  INT16_C( 21403), -INT16_C( 15017),  INT16_C( 15114), -INT16_C( 18029),  INT16_C( 16414),
+         INT16_C(  4042), -INT16_C( 23525),  INT16_C( 15272),  INT16_C( 15252),  INT16_C( 26538), -INT16_C( 32492),  INT16_C( 31474), -INT16_C(  6199),
+         INT16_C(  9162), -INT16_C(  5145), -INT16_C( 32095), -INT16_C(  1985),  INT16_C( 18759), -INT16_C(  9420),  INT16_C( 20994), -INT16_C( 13285),
+         INT16_C( 13921),  INT16_C(  2416),  INT16_C(  1137),  INT16_C(  7236),  INT16_C( 22635),  INT16_C( 24221),  INT16_C( 26323), -INT16_C( 25275) },
+      {  INT16_C(     0),  INT16_C( 20724),  INT16_C(    90),  INT16_C(     0),  INT16_C( 32033),  INT16_C(     0),  INT16_C( 21403), -INT16_C( 15017),
+         INT16_C( 15114), -INT16_C( 18029),  INT16_C(     0),  INT16_C( 16414),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  4042),
+         INT16_C(     0), -INT16_C( 23525),  INT16_C( 15272),  INT16_C(     0),  INT16_C(     0),  INT16_C( 15252),  INT16_C( 26538),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 32492),  INT16_C(     0),  INT16_C(     0),  INT16_C( 31474),  INT16_C(     0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i r = simde_mm512_maskz_expandloadu_epi16(test_vec[i].k, test_vec[i].a);
+    simde_test_x86_assert_equal_i16x32(r, simde_mm512_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask32 k = simde_test_x86_random_mmask32();
+    simde__m512i a = simde_test_x86_random_i16x32();
+    simde__m512i r = simde_mm512_maskz_expandloadu_epi16(k, &a);
+
+    simde_test_x86_write_mmask32(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_i16x32(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_i16x32(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
 SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_expand_epi32)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_expand_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_expand_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_expand_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_expandloadu_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_expandloadu_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_expand_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_expand_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_expandloadu_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_expandloadu_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_expand_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_expand_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_expandloadu_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_expandloadu_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_expand_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_expand_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_expandloadu_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_expandloadu_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_expand_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_expand_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_expandloadu_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_expandloadu_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_expand_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_expand_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_expandloadu_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_expandloadu_epi16)
 SIMDE_TEST_FUNC_LIST_END
 
 #include <test/x86/avx512/test-avx512-footer.h>
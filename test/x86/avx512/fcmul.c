@@ -0,0 +1,815 @@
+#define SIMDE_TEST_X86_AVX512_INSN fcmul
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/fcmul.h>
+
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm_fmul_pch (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float16 a[8];
+    const simde_float16 b[8];
+    const simde_float16 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(    4.887), SIMDE_FLOAT16_VALUE(    3.771), SIMDE_FLOAT16_VALUE(   -6.992), SIMDE_FLOAT16_VALUE(   -5.797),
+        SIMDE_FLOAT16_VALUE(      9.6), SIMDE_FLOAT16_VALUE(   -5.004), SIMDE_FLOAT16_VALUE(    3.016), SIMDE_FLOAT16_VALUE(  -0.6304) },
+      { SIMDE_FLOAT16_VALUE(   0.5913), SIMDE_FLOAT16_VALUE(   -0.976), SIMDE_FLOAT16_VALUE(    0.501), SIMDE_FLOAT16_VALUE(   -7.707),
+        SIMDE_FLOAT16_VALUE(   -0.192), SIMDE_FLOAT16_VALUE(    7.508), SIMDE_FLOAT16_VALUE(   0.0321), SIMDE_FLOAT16_VALUE(     8.06) },
+      { SIMDE_FLOAT16_VALUE(     6.57), SIMDE_FLOAT16_VALUE(    -2.54), SIMDE_FLOAT16_VALUE(    -48.2), SIMDE_FLOAT16_VALUE(     51.0),
+        SIMDE_FLOAT16_VALUE(    35.72), SIMDE_FLOAT16_VALUE(    73.06), SIMDE_FLOAT16_VALUE(     5.18), SIMDE_FLOAT16_VALUE(     24.3) } },
+    { { SIMDE_FLOAT16_VALUE(    -8.51), SIMDE_FLOAT16_VALUE(   -4.918), SIMDE_FLOAT16_VALUE(   0.7705), SIMDE_FLOAT16_VALUE(   -3.117),
+        SIMDE_FLOAT16_VALUE(    3.385), SIMDE_FLOAT16_VALUE(   -1.137), SIMDE_FLOAT16_VALUE(     4.94), SIMDE_FLOAT16_VALUE(   0.3513) },
+      { SIMDE_FLOAT16_VALUE(    -3.53), SIMDE_FLOAT16_VALUE(    6.426), SIMDE_FLOAT16_VALUE(     -5.6), SIMDE_FLOAT16_VALUE(    5.016),
+        SIMDE_FLOAT16_VALUE(    9.695), SIMDE_FLOAT16_VALUE(   -2.297), SIMDE_FLOAT16_VALUE(    -9.17), SIMDE_FLOAT16_VALUE(     8.52) },
+      { SIMDE_FLOAT16_VALUE(    61.62), SIMDE_FLOAT16_VALUE(    -37.3), SIMDE_FLOAT16_VALUE(    11.32), SIMDE_FLOAT16_VALUE(    21.33),
+        SIMDE_FLOAT16_VALUE(     30.2), SIMDE_FLOAT16_VALUE(    -18.8), SIMDE_FLOAT16_VALUE(    -48.3), SIMDE_FLOAT16_VALUE(     38.9) } },
+    { { SIMDE_FLOAT16_VALUE(    5.117), SIMDE_FLOAT16_VALUE(     1.53), SIMDE_FLOAT16_VALUE(    1.735), SIMDE_FLOAT16_VALUE(     8.14),
+        SIMDE_FLOAT16_VALUE(   -7.207), SIMDE_FLOAT16_VALUE(    1.452), SIMDE_FLOAT16_VALUE(   -4.242), SIMDE_FLOAT16_VALUE(  -0.1094) },
+      { SIMDE_FLOAT16_VALUE(   -2.148), SIMDE_FLOAT16_VALUE(    3.424), SIMDE_FLOAT16_VALUE(   -5.156), SIMDE_FLOAT16_VALUE(   -4.477),
+        SIMDE_FLOAT16_VALUE(     5.68), SIMDE_FLOAT16_VALUE(    7.312), SIMDE_FLOAT16_VALUE(   -1.623), SIMDE_FLOAT16_VALUE(  0.06696) },
+      { SIMDE_FLOAT16_VALUE(   -16.23), SIMDE_FLOAT16_VALUE(   14.234), SIMDE_FLOAT16_VALUE(     27.5), SIMDE_FLOAT16_VALUE(   -49.75),
+        SIMDE_FLOAT16_VALUE(   -51.56), SIMDE_FLOAT16_VALUE(   -44.47), SIMDE_FLOAT16_VALUE(    6.895), SIMDE_FLOAT16_VALUE(  -0.1065) } },
+    { { SIMDE_FLOAT16_VALUE(   0.5317), SIMDE_FLOAT16_VALUE(     8.93), SIMDE_FLOAT16_VALUE(     9.52), SIMDE_FLOAT16_VALUE(     9.34),
+        SIMDE_FLOAT16_VALUE(     7.11), SIMDE_FLOAT16_VALUE(    9.055), SIMDE_FLOAT16_VALUE(  -0.1786), SIMDE_FLOAT16_VALUE( -0.02394) },
+      { SIMDE_FLOAT16_VALUE(    -5.49), SIMDE_FLOAT16_VALUE(     8.81), SIMDE_FLOAT16_VALUE(    5.184), SIMDE_FLOAT16_VALUE(  -0.5977),
+        SIMDE_FLOAT16_VALUE(    5.086), SIMDE_FLOAT16_VALUE(   -0.846), SIMDE_FLOAT16_VALUE(     3.47), SIMDE_FLOAT16_VALUE(    4.113) },
+      { SIMDE_FLOAT16_VALUE(    -81.6), SIMDE_FLOAT16_VALUE(    -44.3), SIMDE_FLOAT16_VALUE(    54.94), SIMDE_FLOAT16_VALUE(    42.75),
+        SIMDE_FLOAT16_VALUE(     43.8), SIMDE_FLOAT16_VALUE(    40.03), SIMDE_FLOAT16_VALUE(  -0.5215), SIMDE_FLOAT16_VALUE(   -0.818) } },
+    { { SIMDE_FLOAT16_VALUE(    -8.86), SIMDE_FLOAT16_VALUE(    3.957), SIMDE_FLOAT16_VALUE(    3.994), SIMDE_FLOAT16_VALUE(   -1.962),
+        SIMDE_FLOAT16_VALUE(   -9.734), SIMDE_FLOAT16_VALUE(   -6.605), SIMDE_FLOAT16_VALUE(   -6.957), SIMDE_FLOAT16_VALUE(     8.69) },
+      { SIMDE_FLOAT16_VALUE(    -5.28), SIMDE_FLOAT16_VALUE(    -2.68), SIMDE_FLOAT16_VALUE(     4.69), SIMDE_FLOAT16_VALUE(    1.829),
+        SIMDE_FLOAT16_VALUE(   -0.783), SIMDE_FLOAT16_VALUE(      6.5), SIMDE_FLOAT16_VALUE(    3.807), SIMDE_FLOAT16_VALUE(    0.258) },
+      { SIMDE_FLOAT16_VALUE(     57.4), SIMDE_FLOAT16_VALUE(    2.842), SIMDE_FLOAT16_VALUE(    22.33), SIMDE_FLOAT16_VALUE(   -1.898),
+        SIMDE_FLOAT16_VALUE(    50.56), SIMDE_FLOAT16_VALUE(    -58.1), SIMDE_FLOAT16_VALUE(   -28.72), SIMDE_FLOAT16_VALUE(    31.28) } },
+    { { SIMDE_FLOAT16_VALUE(    -6.22), SIMDE_FLOAT16_VALUE(   -1.865), SIMDE_FLOAT16_VALUE(    3.264), SIMDE_FLOAT16_VALUE(   0.5596),
+        SIMDE_FLOAT16_VALUE(     -9.4), SIMDE_FLOAT16_VALUE(    3.354), SIMDE_FLOAT16_VALUE(    -8.48), SIMDE_FLOAT16_VALUE(    1.797) },
+      { SIMDE_FLOAT16_VALUE(    -7.36), SIMDE_FLOAT16_VALUE(     -5.4), SIMDE_FLOAT16_VALUE(      1.1), SIMDE_FLOAT16_VALUE(   -3.768),
+        SIMDE_FLOAT16_VALUE(    0.614), SIMDE_FLOAT16_VALUE(   -4.562), SIMDE_FLOAT16_VALUE(   -9.234), SIMDE_FLOAT16_VALUE(   0.3638) },
+      { SIMDE_FLOAT16_VALUE(     35.7), SIMDE_FLOAT16_VALUE(     47.3), SIMDE_FLOAT16_VALUE(    5.695), SIMDE_FLOAT16_VALUE(   -11.68),
+        SIMDE_FLOAT16_VALUE(     9.53), SIMDE_FLOAT16_VALUE(    44.94), SIMDE_FLOAT16_VALUE(     77.6), SIMDE_FLOAT16_VALUE(   -19.67) } },
+    { { SIMDE_FLOAT16_VALUE(   -6.336), SIMDE_FLOAT16_VALUE(     9.56), SIMDE_FLOAT16_VALUE(    5.227), SIMDE_FLOAT16_VALUE(    7.047),
+        SIMDE_FLOAT16_VALUE(   -5.195), SIMDE_FLOAT16_VALUE(     4.45), SIMDE_FLOAT16_VALUE(   -7.027), SIMDE_FLOAT16_VALUE(   -5.004) },
+      { SIMDE_FLOAT16_VALUE(   -4.164), SIMDE_FLOAT16_VALUE(   -1.509), SIMDE_FLOAT16_VALUE(    7.266), SIMDE_FLOAT16_VALUE(    7.883),
+        SIMDE_FLOAT16_VALUE(   -4.715), SIMDE_FLOAT16_VALUE(   0.1582), SIMDE_FLOAT16_VALUE(    1.278), SIMDE_FLOAT16_VALUE(     9.99) },
+      { SIMDE_FLOAT16_VALUE(     40.8), SIMDE_FLOAT16_VALUE(   -30.27), SIMDE_FLOAT16_VALUE(   -17.58), SIMDE_FLOAT16_VALUE(     92.4),
+        SIMDE_FLOAT16_VALUE(     23.8), SIMDE_FLOAT16_VALUE(    -21.8), SIMDE_FLOAT16_VALUE(    41.03), SIMDE_FLOAT16_VALUE(    -76.6) } },
+    { { SIMDE_FLOAT16_VALUE(    3.303), SIMDE_FLOAT16_VALUE(    0.559), SIMDE_FLOAT16_VALUE(    -3.76), SIMDE_FLOAT16_VALUE(    -8.88),
+        SIMDE_FLOAT16_VALUE(    8.664), SIMDE_FLOAT16_VALUE(    1.166), SIMDE_FLOAT16_VALUE(    3.334), SIMDE_FLOAT16_VALUE(    7.465) },
+      { SIMDE_FLOAT16_VALUE(   -5.434), SIMDE_FLOAT16_VALUE(    -8.95), SIMDE_FLOAT16_VALUE(     8.66), SIMDE_FLOAT16_VALUE(    1.244),
+        SIMDE_FLOAT16_VALUE(   -1.406), SIMDE_FLOAT16_VALUE(     8.57), SIMDE_FLOAT16_VALUE(   -6.586), SIMDE_FLOAT16_VALUE(   -6.695) },
+      { SIMDE_FLOAT16_VALUE(   -12.94), SIMDE_FLOAT16_VALUE(    -32.6), SIMDE_FLOAT16_VALUE(    -21.5), SIMDE_FLOAT16_VALUE(   -81.56),
+        SIMDE_FLOAT16_VALUE(   -22.17), SIMDE_FLOAT16_VALUE(     72.6), SIMDE_FLOAT16_VALUE(    28.02), SIMDE_FLOAT16_VALUE(    -71.5) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128h a = simde_mm_loadu_ph(test_vec[i].a);
+    simde__m128h b = simde_mm_loadu_ph(test_vec[i].b);
+    simde__m128h r = simde_mm_fmul_pch(a, b);
+    simde_test_x86_assert_equal_f16x8(r, simde_mm_loadu_ph(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm256_fmul_pch (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float16 a[16];
+    const simde_float16 b[16];
+    const simde_float16 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(   -2.102), SIMDE_FLOAT16_VALUE(   -8.164), SIMDE_FLOAT16_VALUE(    6.664), SIMDE_FLOAT16_VALUE(   -4.527),
+        SIMDE_FLOAT16_VALUE(    9.484), SIMDE_FLOAT16_VALUE(    -9.79), SIMDE_FLOAT16_VALUE(    -7.02), SIMDE_FLOAT16_VALUE(     -8.5),
+        SIMDE_FLOAT16_VALUE(    3.533), SIMDE_FLOAT16_VALUE(    3.555), SIMDE_FLOAT16_VALUE(    5.914), SIMDE_FLOAT16_VALUE(    2.783),
+        SIMDE_FLOAT16_VALUE(   -7.574), SIMDE_FLOAT16_VALUE(   -5.023), SIMDE_FLOAT16_VALUE(    -1.33), SIMDE_FLOAT16_VALUE(    -9.55) },
+      { SIMDE_FLOAT16_VALUE(     2.99), SIMDE_FLOAT16_VALUE(   -7.266), SIMDE_FLOAT16_VALUE(  -0.2101), SIMDE_FLOAT16_VALUE(      8.0),
+        SIMDE_FLOAT16_VALUE(     4.02), SIMDE_FLOAT16_VALUE(    9.984), SIMDE_FLOAT16_VALUE(     6.23), SIMDE_FLOAT16_VALUE(    1.191),
+        SIMDE_FLOAT16_VALUE(   -3.662), SIMDE_FLOAT16_VALUE(    -6.74), SIMDE_FLOAT16_VALUE(   -6.496), SIMDE_FLOAT16_VALUE(   -3.525),
+        SIMDE_FLOAT16_VALUE(   -6.566), SIMDE_FLOAT16_VALUE(   -9.695), SIMDE_FLOAT16_VALUE(   -3.057), SIMDE_FLOAT16_VALUE(    -8.26) },
+      { SIMDE_FLOAT16_VALUE(    -65.6), SIMDE_FLOAT16_VALUE(    -9.14), SIMDE_FLOAT16_VALUE(     34.8), SIMDE_FLOAT16_VALUE(    54.25),
+        SIMDE_FLOAT16_VALUE(    135.9), SIMDE_FLOAT16_VALUE(    55.34), SIMDE_FLOAT16_VALUE(    -33.6), SIMDE_FLOAT16_VALUE(    -61.3),
+        SIMDE_FLOAT16_VALUE(   11.016), SIMDE_FLOAT16_VALUE(    -36.8), SIMDE_FLOAT16_VALUE(   -28.61), SIMDE_FLOAT16_VALUE(   -38.94),
+        SIMDE_FLOAT16_VALUE(    1.031), SIMDE_FLOAT16_VALUE(   106.44), SIMDE_FLOAT16_VALUE(   -74.75), SIMDE_FLOAT16_VALUE(    40.16) } },
+    { { SIMDE_FLOAT16_VALUE(   -7.562), SIMDE_FLOAT16_VALUE(    -9.36), SIMDE_FLOAT16_VALUE(    7.793), SIMDE_FLOAT16_VALUE(   -7.098),
+        SIMDE_FLOAT16_VALUE(    -8.69), SIMDE_FLOAT16_VALUE(     8.15), SIMDE_FLOAT16_VALUE(    1.752), SIMDE_FLOAT16_VALUE(     9.62),
+        SIMDE_FLOAT16_VALUE(    5.668), SIMDE_FLOAT16_VALUE(   -9.305), SIMDE_FLOAT16_VALUE(    6.215), SIMDE_FLOAT16_VALUE(   -4.703),
+        SIMDE_FLOAT16_VALUE(   -2.893), SIMDE_FLOAT16_VALUE(   -1.348), SIMDE_FLOAT16_VALUE(   -2.027), SIMDE_FLOAT16_VALUE(   -1.803) },
+      { SIMDE_FLOAT16_VALUE(   -2.354), SIMDE_FLOAT16_VALUE(     3.58), SIMDE_FLOAT16_VALUE(    -6.92), SIMDE_FLOAT16_VALUE(   0.8784),
+        SIMDE_FLOAT16_VALUE(   -4.188), SIMDE_FLOAT16_VALUE(    -5.56), SIMDE_FLOAT16_VALUE(     2.51), SIMDE_FLOAT16_VALUE(     2.16),
+        SIMDE_FLOAT16_VALUE(  -0.4666), SIMDE_FLOAT16_VALUE(    -8.73), SIMDE_FLOAT16_VALUE(    -8.38), SIMDE_FLOAT16_VALUE( -0.04758),
+        SIMDE_FLOAT16_VALUE(   -7.754), SIMDE_FLOAT16_VALUE(     9.38), SIMDE_FLOAT16_VALUE(   0.7017), SIMDE_FLOAT16_VALUE(    7.992) },
+      { SIMDE_FLOAT16_VALUE(     51.3), SIMDE_FLOAT16_VALUE(   -5.047), SIMDE_FLOAT16_VALUE(   -47.72), SIMDE_FLOAT16_VALUE(    55.97),
+        SIMDE_FLOAT16_VALUE(     81.7), SIMDE_FLOAT16_VALUE(    14.17), SIMDE_FLOAT16_VALUE(   -16.38), SIMDE_FLOAT16_VALUE(    27.92),
+        SIMDE_FLOAT16_VALUE(    -83.8), SIMDE_FLOAT16_VALUE(   -45.12), SIMDE_FLOAT16_VALUE(    -52.3), SIMDE_FLOAT16_VALUE(    39.12),
+        SIMDE_FLOAT16_VALUE(    35.06), SIMDE_FLOAT16_VALUE(   -16.69), SIMDE_FLOAT16_VALUE(   12.984), SIMDE_FLOAT16_VALUE(   -17.47) } },
+    { { SIMDE_FLOAT16_VALUE(     -2.9), SIMDE_FLOAT16_VALUE(     2.78), SIMDE_FLOAT16_VALUE(   -6.914), SIMDE_FLOAT16_VALUE(    2.236),
+        SIMDE_FLOAT16_VALUE(     8.44), SIMDE_FLOAT16_VALUE(   -3.133), SIMDE_FLOAT16_VALUE(   -9.125), SIMDE_FLOAT16_VALUE(    6.457),
+        SIMDE_FLOAT16_VALUE(    7.723), SIMDE_FLOAT16_VALUE(     2.73), SIMDE_FLOAT16_VALUE(   -5.785), SIMDE_FLOAT16_VALUE(     9.11),
+        SIMDE_FLOAT16_VALUE(    -4.98), SIMDE_FLOAT16_VALUE(     6.24), SIMDE_FLOAT16_VALUE(    0.874), SIMDE_FLOAT16_VALUE(    2.146) },
+      { SIMDE_FLOAT16_VALUE(    1.473), SIMDE_FLOAT16_VALUE(    5.883), SIMDE_FLOAT16_VALUE(    3.268), SIMDE_FLOAT16_VALUE(    -8.95),
+        SIMDE_FLOAT16_VALUE(    5.723), SIMDE_FLOAT16_VALUE(    -7.89), SIMDE_FLOAT16_VALUE(    -8.75), SIMDE_FLOAT16_VALUE(     6.88),
+        SIMDE_FLOAT16_VALUE(    2.236), SIMDE_FLOAT16_VALUE(   -7.117), SIMDE_FLOAT16_VALUE(    -1.61), SIMDE_FLOAT16_VALUE(    -7.07),
+        SIMDE_FLOAT16_VALUE(   -6.965), SIMDE_FLOAT16_VALUE(    9.445), SIMDE_FLOAT16_VALUE(    7.184), SIMDE_FLOAT16_VALUE(    -8.72) },
+      { SIMDE_FLOAT16_VALUE(   -20.62), SIMDE_FLOAT16_VALUE(   -12.97), SIMDE_FLOAT16_VALUE(    -2.57), SIMDE_FLOAT16_VALUE(     69.2),
+        SIMDE_FLOAT16_VALUE(    23.56), SIMDE_FLOAT16_VALUE(    -84.5), SIMDE_FLOAT16_VALUE(    35.44), SIMDE_FLOAT16_VALUE(  -119.25),
+        SIMDE_FLOAT16_VALUE(    36.72), SIMDE_FLOAT16_VALUE(   -48.84), SIMDE_FLOAT16_VALUE(    73.75), SIMDE_FLOAT16_VALUE(    26.23),
+        SIMDE_FLOAT16_VALUE(   -24.23), SIMDE_FLOAT16_VALUE(    -90.5), SIMDE_FLOAT16_VALUE(     25.0), SIMDE_FLOAT16_VALUE(      7.8) } },
+    { { SIMDE_FLOAT16_VALUE(     9.05), SIMDE_FLOAT16_VALUE(     7.88), SIMDE_FLOAT16_VALUE(     8.73), SIMDE_FLOAT16_VALUE(    -4.75),
+        SIMDE_FLOAT16_VALUE(   -2.916), SIMDE_FLOAT16_VALUE(    -8.14), SIMDE_FLOAT16_VALUE(     8.56), SIMDE_FLOAT16_VALUE(    -3.31),
+        SIMDE_FLOAT16_VALUE(      9.9), SIMDE_FLOAT16_VALUE(   -1.872), SIMDE_FLOAT16_VALUE(  -0.4111), SIMDE_FLOAT16_VALUE(     9.72),
+        SIMDE_FLOAT16_VALUE(  0.11694), SIMDE_FLOAT16_VALUE(    -8.77), SIMDE_FLOAT16_VALUE(    3.336), SIMDE_FLOAT16_VALUE(   -5.203) },
+      { SIMDE_FLOAT16_VALUE(    1.462), SIMDE_FLOAT16_VALUE(     8.09), SIMDE_FLOAT16_VALUE(   -1.744), SIMDE_FLOAT16_VALUE(     7.68),
+        SIMDE_FLOAT16_VALUE(    5.652), SIMDE_FLOAT16_VALUE(    -9.44), SIMDE_FLOAT16_VALUE(   -7.953), SIMDE_FLOAT16_VALUE(    5.285),
+        SIMDE_FLOAT16_VALUE(    -4.62), SIMDE_FLOAT16_VALUE(    -4.91), SIMDE_FLOAT16_VALUE(   -4.316), SIMDE_FLOAT16_VALUE(     7.74),
+        SIMDE_FLOAT16_VALUE(     -6.5), SIMDE_FLOAT16_VALUE(    -7.16), SIMDE_FLOAT16_VALUE(      8.2), SIMDE_FLOAT16_VALUE(   -2.168) },
+      { SIMDE_FLOAT16_VALUE(   -50.53), SIMDE_FLOAT16_VALUE(    84.75), SIMDE_FLOAT16_VALUE(    21.27), SIMDE_FLOAT16_VALUE(     75.3),
+        SIMDE_FLOAT16_VALUE(    -93.3), SIMDE_FLOAT16_VALUE(    -18.5), SIMDE_FLOAT16_VALUE(    -50.6), SIMDE_FLOAT16_VALUE(    71.56),
+        SIMDE_FLOAT16_VALUE(   -54.94), SIMDE_FLOAT16_VALUE(   -39.94), SIMDE_FLOAT16_VALUE(   -73.44), SIMDE_FLOAT16_VALUE(   -45.12),
+        SIMDE_FLOAT16_VALUE(    -63.6), SIMDE_FLOAT16_VALUE(     56.2), SIMDE_FLOAT16_VALUE(    16.08), SIMDE_FLOAT16_VALUE(    -49.9) } },
+    { { SIMDE_FLOAT16_VALUE(    4.094), SIMDE_FLOAT16_VALUE(   -9.445), SIMDE_FLOAT16_VALUE(     3.08), SIMDE_FLOAT16_VALUE(    7.098),
+        SIMDE_FLOAT16_VALUE(    1.959), SIMDE_FLOAT16_VALUE(   -5.816), SIMDE_FLOAT16_VALUE(    0.948), SIMDE_FLOAT16_VALUE(    1.561),
+        SIMDE_FLOAT16_VALUE(   0.4937), SIMDE_FLOAT16_VALUE(    6.496), SIMDE_FLOAT16_VALUE(      6.4), SIMDE_FLOAT16_VALUE(    -2.62),
+        SIMDE_FLOAT16_VALUE(   -7.137), SIMDE_FLOAT16_VALUE(     9.18), SIMDE_FLOAT16_VALUE(   0.2527), SIMDE_FLOAT16_VALUE(   -3.156) },
+      { SIMDE_FLOAT16_VALUE(    0.861), SIMDE_FLOAT16_VALUE(   -5.055), SIMDE_FLOAT16_VALUE(     6.08), SIMDE_FLOAT16_VALUE(    3.959),
+        SIMDE_FLOAT16_VALUE(   -1.697), SIMDE_FLOAT16_VALUE(   -1.042), SIMDE_FLOAT16_VALUE(     4.18), SIMDE_FLOAT16_VALUE(   -3.494),
+        SIMDE_FLOAT16_VALUE(   -3.799), SIMDE_FLOAT16_VALUE(     9.18), SIMDE_FLOAT16_VALUE(    1.302), SIMDE_FLOAT16_VALUE(      5.9),
+        SIMDE_FLOAT16_VALUE(   -6.777), SIMDE_FLOAT16_VALUE(   0.4321), SIMDE_FLOAT16_VALUE(  -0.4292), SIMDE_FLOAT16_VALUE(   -2.492) },
+      { SIMDE_FLOAT16_VALUE(   -44.22), SIMDE_FLOAT16_VALUE(   -28.83), SIMDE_FLOAT16_VALUE(   -9.375), SIMDE_FLOAT16_VALUE(    55.34),
+        SIMDE_FLOAT16_VALUE(    -9.38), SIMDE_FLOAT16_VALUE(    7.832), SIMDE_FLOAT16_VALUE(    9.414), SIMDE_FLOAT16_VALUE(    3.209),
+        SIMDE_FLOAT16_VALUE(    -61.5), SIMDE_FLOAT16_VALUE(   -20.14), SIMDE_FLOAT16_VALUE(    23.78), SIMDE_FLOAT16_VALUE(    34.34),
+        SIMDE_FLOAT16_VALUE(     44.4), SIMDE_FLOAT16_VALUE(    -65.3), SIMDE_FLOAT16_VALUE(   -7.973), SIMDE_FLOAT16_VALUE(    0.725) } },
+    { { SIMDE_FLOAT16_VALUE(    -6.04), SIMDE_FLOAT16_VALUE(   -0.046), SIMDE_FLOAT16_VALUE(    -4.39), SIMDE_FLOAT16_VALUE(    7.934),
+        SIMDE_FLOAT16_VALUE(     4.09), SIMDE_FLOAT16_VALUE(    5.227), SIMDE_FLOAT16_VALUE(    -8.32), SIMDE_FLOAT16_VALUE(    -9.32),
+        SIMDE_FLOAT16_VALUE(    1.639), SIMDE_FLOAT16_VALUE(    5.387), SIMDE_FLOAT16_VALUE(   -1.641), SIMDE_FLOAT16_VALUE(    6.137),
+        SIMDE_FLOAT16_VALUE(    -2.74), SIMDE_FLOAT16_VALUE(   0.2354), SIMDE_FLOAT16_VALUE(   -4.402), SIMDE_FLOAT16_VALUE(   -3.871) },
+      { SIMDE_FLOAT16_VALUE(    -4.64), SIMDE_FLOAT16_VALUE(    -4.44), SIMDE_FLOAT16_VALUE(    -2.69), SIMDE_FLOAT16_VALUE(     8.45),
+        SIMDE_FLOAT16_VALUE(   -2.248), SIMDE_FLOAT16_VALUE(     7.85), SIMDE_FLOAT16_VALUE(   -0.726), SIMDE_FLOAT16_VALUE(   -3.818),
+        SIMDE_FLOAT16_VALUE(    0.889), SIMDE_FLOAT16_VALUE(    8.516), SIMDE_FLOAT16_VALUE(    8.375), SIMDE_FLOAT16_VALUE(    3.494),
+        SIMDE_FLOAT16_VALUE(   -0.909), SIMDE_FLOAT16_VALUE(    -9.08), SIMDE_FLOAT16_VALUE(    -8.23), SIMDE_FLOAT16_VALUE(    -1.76) },
+      { SIMDE_FLOAT16_VALUE(    27.83), SIMDE_FLOAT16_VALUE(    27.03), SIMDE_FLOAT16_VALUE(   -55.25), SIMDE_FLOAT16_VALUE(   -58.44),
+        SIMDE_FLOAT16_VALUE(   -50.22), SIMDE_FLOAT16_VALUE(    20.36), SIMDE_FLOAT16_VALUE(   -29.55), SIMDE_FLOAT16_VALUE(    38.53),
+        SIMDE_FLOAT16_VALUE(    -44.4), SIMDE_FLOAT16_VALUE(    18.75), SIMDE_FLOAT16_VALUE(    -35.2), SIMDE_FLOAT16_VALUE(    45.66),
+        SIMDE_FLOAT16_VALUE(     4.63), SIMDE_FLOAT16_VALUE(    24.66), SIMDE_FLOAT16_VALUE(     29.4), SIMDE_FLOAT16_VALUE(     39.6) } },
+    { { SIMDE_FLOAT16_VALUE( -0.00405), SIMDE_FLOAT16_VALUE(    -7.53), SIMDE_FLOAT16_VALUE(     9.68), SIMDE_FLOAT16_VALUE(   -7.402),
+        SIMDE_FLOAT16_VALUE(    9.445), SIMDE_FLOAT16_VALUE(     -9.5), SIMDE_FLOAT16_VALUE(  -0.3284), SIMDE_FLOAT16_VALUE(    -5.47),
+        SIMDE_FLOAT16_VALUE(   -2.652), SIMDE_FLOAT16_VALUE(   -3.168), SIMDE_FLOAT16_VALUE(    6.613), SIMDE_FLOAT16_VALUE(   0.4536),
+        SIMDE_FLOAT16_VALUE(  -0.3691), SIMDE_FLOAT16_VALUE(    -7.55), SIMDE_FLOAT16_VALUE(   -3.396), SIMDE_FLOAT16_VALUE(    0.656) },
+      { SIMDE_FLOAT16_VALUE(   -5.656), SIMDE_FLOAT16_VALUE(    -8.55), SIMDE_FLOAT16_VALUE(    9.875), SIMDE_FLOAT16_VALUE(    1.676),
+        SIMDE_FLOAT16_VALUE(   -3.281), SIMDE_FLOAT16_VALUE(     9.13), SIMDE_FLOAT16_VALUE(   -6.797), SIMDE_FLOAT16_VALUE(    -9.51),
+        SIMDE_FLOAT16_VALUE(    -8.09), SIMDE_FLOAT16_VALUE(   -2.643), SIMDE_FLOAT16_VALUE(    1.011), SIMDE_FLOAT16_VALUE(   -6.777),
+        SIMDE_FLOAT16_VALUE(   -1.491), SIMDE_FLOAT16_VALUE(    0.792), SIMDE_FLOAT16_VALUE(  -0.9985), SIMDE_FLOAT16_VALUE(   -7.883) },
+      { SIMDE_FLOAT16_VALUE(    -64.4), SIMDE_FLOAT16_VALUE(    42.62), SIMDE_FLOAT16_VALUE(    108.0), SIMDE_FLOAT16_VALUE(   -56.88),
+        SIMDE_FLOAT16_VALUE(    55.78), SIMDE_FLOAT16_VALUE(   117.44), SIMDE_FLOAT16_VALUE(   -49.75), SIMDE_FLOAT16_VALUE(    40.28),
+        SIMDE_FLOAT16_VALUE(    13.09), SIMDE_FLOAT16_VALUE(    32.66), SIMDE_FLOAT16_VALUE(     9.76), SIMDE_FLOAT16_VALUE(   -44.38),
+        SIMDE_FLOAT16_VALUE(     6.53), SIMDE_FLOAT16_VALUE(    10.97), SIMDE_FLOAT16_VALUE(     8.56), SIMDE_FLOAT16_VALUE(    26.12) } },
+    { { SIMDE_FLOAT16_VALUE(    8.414), SIMDE_FLOAT16_VALUE(    6.434), SIMDE_FLOAT16_VALUE(     8.94), SIMDE_FLOAT16_VALUE(    -5.22),
+        SIMDE_FLOAT16_VALUE(   -6.875), SIMDE_FLOAT16_VALUE(   -5.152), SIMDE_FLOAT16_VALUE(   -6.066), SIMDE_FLOAT16_VALUE(     6.15),
+        SIMDE_FLOAT16_VALUE(    3.107), SIMDE_FLOAT16_VALUE(    3.572), SIMDE_FLOAT16_VALUE(   0.1823), SIMDE_FLOAT16_VALUE(     5.76),
+        SIMDE_FLOAT16_VALUE(     3.38), SIMDE_FLOAT16_VALUE(   -7.418), SIMDE_FLOAT16_VALUE(   -1.646), SIMDE_FLOAT16_VALUE(    -6.34) },
+      { SIMDE_FLOAT16_VALUE(    3.713), SIMDE_FLOAT16_VALUE(    -8.18), SIMDE_FLOAT16_VALUE(   -3.693), SIMDE_FLOAT16_VALUE(    2.594),
+        SIMDE_FLOAT16_VALUE(   -7.832), SIMDE_FLOAT16_VALUE(   -7.285), SIMDE_FLOAT16_VALUE(    0.581), SIMDE_FLOAT16_VALUE(   -5.336),
+        SIMDE_FLOAT16_VALUE(   -1.406), SIMDE_FLOAT16_VALUE(    7.977), SIMDE_FLOAT16_VALUE(   -1.098), SIMDE_FLOAT16_VALUE(     8.91),
+        SIMDE_FLOAT16_VALUE(    2.803), SIMDE_FLOAT16_VALUE(   -4.855), SIMDE_FLOAT16_VALUE(     9.78), SIMDE_FLOAT16_VALUE(    0.776) },
+      { SIMDE_FLOAT16_VALUE(     83.9), SIMDE_FLOAT16_VALUE(   -44.94), SIMDE_FLOAT16_VALUE(   -19.47), SIMDE_FLOAT16_VALUE(    42.47),
+        SIMDE_FLOAT16_VALUE(    16.31), SIMDE_FLOAT16_VALUE(    90.44), SIMDE_FLOAT16_VALUE(    29.28), SIMDE_FLOAT16_VALUE(    35.94),
+        SIMDE_FLOAT16_VALUE(   -32.88), SIMDE_FLOAT16_VALUE(    19.77), SIMDE_FLOAT16_VALUE(    -51.5), SIMDE_FLOAT16_VALUE(   -4.703),
+        SIMDE_FLOAT16_VALUE(   -26.55), SIMDE_FLOAT16_VALUE(   -37.22), SIMDE_FLOAT16_VALUE(   -11.19), SIMDE_FLOAT16_VALUE(   -63.28) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256h a = simde_mm256_loadu_ph(test_vec[i].a);
+    simde__m256h b = simde_mm256_loadu_ph(test_vec[i].b);
+    simde__m256h r = simde_mm256_fmul_pch(a, b);
+    simde_test_x86_assert_equal_f16x16(r, simde_mm256_loadu_ph(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm512_fmul_pch (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float16 a[32];
+    const simde_float16 b[32];
+    const simde_float16 r[32];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(      1.9), SIMDE_FLOAT16_VALUE(    2.512), SIMDE_FLOAT16_VALUE(    2.727), SIMDE_FLOAT16_VALUE(   -6.895),
+        SIMDE_FLOAT16_VALUE(    -7.97), SIMDE_FLOAT16_VALUE(     7.61), SIMDE_FLOAT16_VALUE(     -8.3), SIMDE_FLOAT16_VALUE(    -9.33),
+        SIMDE_FLOAT16_VALUE(    3.121), SIMDE_FLOAT16_VALUE(    -9.04), SIMDE_FLOAT16_VALUE(    6.688), SIMDE_FLOAT16_VALUE(   -1.766),
+        SIMDE_FLOAT16_VALUE(    3.416), SIMDE_FLOAT16_VALUE(     3.03), SIMDE_FLOAT16_VALUE(    -8.14), SIMDE_FLOAT16_VALUE(     7.64),
+        SIMDE_FLOAT16_VALUE(     6.75), SIMDE_FLOAT16_VALUE(     8.73), SIMDE_FLOAT16_VALUE(   -6.113), SIMDE_FLOAT16_VALUE(    2.334),
+        SIMDE_FLOAT16_VALUE(  -0.3096), SIMDE_FLOAT16_VALUE(    6.066), SIMDE_FLOAT16_VALUE(    -6.83), SIMDE_FLOAT16_VALUE(   -9.125),
+        SIMDE_FLOAT16_VALUE(     7.13), SIMDE_FLOAT16_VALUE(      8.0), SIMDE_FLOAT16_VALUE(    7.656), SIMDE_FLOAT16_VALUE(   -7.547),
+        SIMDE_FLOAT16_VALUE(    -6.81), SIMDE_FLOAT16_VALUE(    1.789), SIMDE_FLOAT16_VALUE(   -6.453), SIMDE_FLOAT16_VALUE(    2.707) },
+      { SIMDE_FLOAT16_VALUE(   -3.086), SIMDE_FLOAT16_VALUE(      7.3), SIMDE_FLOAT16_VALUE(    3.617), SIMDE_FLOAT16_VALUE(   -3.793),
+        SIMDE_FLOAT16_VALUE(    -4.11), SIMDE_FLOAT16_VALUE(   -9.305), SIMDE_FLOAT16_VALUE(     8.35), SIMDE_FLOAT16_VALUE(   -1.635),
+        SIMDE_FLOAT16_VALUE(    1.544), SIMDE_FLOAT16_VALUE(    3.213), SIMDE_FLOAT16_VALUE(   -5.617), SIMDE_FLOAT16_VALUE(     -9.5),
+        SIMDE_FLOAT16_VALUE(   -2.234), SIMDE_FLOAT16_VALUE(    2.453), SIMDE_FLOAT16_VALUE(    -9.59), SIMDE_FLOAT16_VALUE(      3.8),
+        SIMDE_FLOAT16_VALUE(   -8.875), SIMDE_FLOAT16_VALUE(    -8.17), SIMDE_FLOAT16_VALUE(    4.555), SIMDE_FLOAT16_VALUE(    2.207),
+        SIMDE_FLOAT16_VALUE(     7.74), SIMDE_FLOAT16_VALUE(     7.25), SIMDE_FLOAT16_VALUE(   -3.775), SIMDE_FLOAT16_VALUE(   -1.086),
+        SIMDE_FLOAT16_VALUE(     7.16), SIMDE_FLOAT16_VALUE(    0.964), SIMDE_FLOAT16_VALUE(   0.2341), SIMDE_FLOAT16_VALUE(     8.95),
+        SIMDE_FLOAT16_VALUE(   -5.727), SIMDE_FLOAT16_VALUE(   -2.611), SIMDE_FLOAT16_VALUE(     8.31), SIMDE_FLOAT16_VALUE(    5.645) },
+      { SIMDE_FLOAT16_VALUE(    -24.2), SIMDE_FLOAT16_VALUE(    6.125), SIMDE_FLOAT16_VALUE(   -16.28), SIMDE_FLOAT16_VALUE(   -35.28),
+        SIMDE_FLOAT16_VALUE(   103.56), SIMDE_FLOAT16_VALUE(    42.88), SIMDE_FLOAT16_VALUE(   -84.56), SIMDE_FLOAT16_VALUE(    -64.3),
+        SIMDE_FLOAT16_VALUE(    33.88), SIMDE_FLOAT16_VALUE(   -3.928), SIMDE_FLOAT16_VALUE(   -54.34), SIMDE_FLOAT16_VALUE(   -53.62),
+        SIMDE_FLOAT16_VALUE(   -15.06), SIMDE_FLOAT16_VALUE(    1.611), SIMDE_FLOAT16_VALUE(    49.06), SIMDE_FLOAT16_VALUE(  -104.25),
+        SIMDE_FLOAT16_VALUE(    11.41), SIMDE_FLOAT16_VALUE(   -132.6), SIMDE_FLOAT16_VALUE(    -33.0), SIMDE_FLOAT16_VALUE(   -2.861),
+        SIMDE_FLOAT16_VALUE(   -46.38), SIMDE_FLOAT16_VALUE(     44.7), SIMDE_FLOAT16_VALUE(    15.87), SIMDE_FLOAT16_VALUE(    41.88),
+        SIMDE_FLOAT16_VALUE(    43.34), SIMDE_FLOAT16_VALUE(     64.1), SIMDE_FLOAT16_VALUE(     69.4), SIMDE_FLOAT16_VALUE(    66.75),
+        SIMDE_FLOAT16_VALUE(    43.66), SIMDE_FLOAT16_VALUE(    7.535), SIMDE_FLOAT16_VALUE(   -68.94), SIMDE_FLOAT16_VALUE(   -13.92) } },
+    { { SIMDE_FLOAT16_VALUE(   -3.705), SIMDE_FLOAT16_VALUE(   -2.969), SIMDE_FLOAT16_VALUE(   -1.504), SIMDE_FLOAT16_VALUE(  -0.4597),
+        SIMDE_FLOAT16_VALUE(   -4.188), SIMDE_FLOAT16_VALUE(    -4.24), SIMDE_FLOAT16_VALUE(   -3.133), SIMDE_FLOAT16_VALUE(     9.08),
+        SIMDE_FLOAT16_VALUE(     -9.0), SIMDE_FLOAT16_VALUE(   -0.541), SIMDE_FLOAT16_VALUE(    1.912), SIMDE_FLOAT16_VALUE(    2.928),
+        SIMDE_FLOAT16_VALUE(    -9.48), SIMDE_FLOAT16_VALUE(   -3.994), SIMDE_FLOAT16_VALUE(    0.852), SIMDE_FLOAT16_VALUE(    1.057),
+        SIMDE_FLOAT16_VALUE(   -0.549), SIMDE_FLOAT16_VALUE(    9.625), SIMDE_FLOAT16_VALUE(    4.355), SIMDE_FLOAT16_VALUE(    -9.46),
+        SIMDE_FLOAT16_VALUE(     4.69), SIMDE_FLOAT16_VALUE(   0.5425), SIMDE_FLOAT16_VALUE(    2.002), SIMDE_FLOAT16_VALUE(    3.084),
+        SIMDE_FLOAT16_VALUE(   -3.594), SIMDE_FLOAT16_VALUE(     5.55), SIMDE_FLOAT16_VALUE(    2.691), SIMDE_FLOAT16_VALUE(    3.273),
+        SIMDE_FLOAT16_VALUE(   -3.217), SIMDE_FLOAT16_VALUE(    -9.81), SIMDE_FLOAT16_VALUE(    1.823), SIMDE_FLOAT16_VALUE(    -2.97) },
+      { SIMDE_FLOAT16_VALUE(   -6.656), SIMDE_FLOAT16_VALUE(   -5.562), SIMDE_FLOAT16_VALUE(   -0.554), SIMDE_FLOAT16_VALUE(   -3.303),
+        SIMDE_FLOAT16_VALUE(    -8.95), SIMDE_FLOAT16_VALUE(   -1.777), SIMDE_FLOAT16_VALUE(    3.709), SIMDE_FLOAT16_VALUE(    3.584),
+        SIMDE_FLOAT16_VALUE(  -0.3625), SIMDE_FLOAT16_VALUE(   -1.162), SIMDE_FLOAT16_VALUE(    7.523), SIMDE_FLOAT16_VALUE(    -7.59),
+        SIMDE_FLOAT16_VALUE(   -7.176), SIMDE_FLOAT16_VALUE(    5.457), SIMDE_FLOAT16_VALUE(    -3.36), SIMDE_FLOAT16_VALUE(   -1.099),
+        SIMDE_FLOAT16_VALUE(    -9.68), SIMDE_FLOAT16_VALUE(   -1.684), SIMDE_FLOAT16_VALUE(   -3.598), SIMDE_FLOAT16_VALUE(   0.6694),
+        SIMDE_FLOAT16_VALUE(   -1.791), SIMDE_FLOAT16_VALUE(    5.594), SIMDE_FLOAT16_VALUE(    -6.47), SIMDE_FLOAT16_VALUE(     8.67),
+        SIMDE_FLOAT16_VALUE(   -5.883), SIMDE_FLOAT16_VALUE(    3.316), SIMDE_FLOAT16_VALUE(   -7.316), SIMDE_FLOAT16_VALUE(     2.74),
+        SIMDE_FLOAT16_VALUE(   -2.352), SIMDE_FLOAT16_VALUE(   -7.957), SIMDE_FLOAT16_VALUE(     5.41), SIMDE_FLOAT16_VALUE(    1.161) },
+      { SIMDE_FLOAT16_VALUE(     8.15), SIMDE_FLOAT16_VALUE(    40.38), SIMDE_FLOAT16_VALUE(   -0.685), SIMDE_FLOAT16_VALUE(    5.223),
+        SIMDE_FLOAT16_VALUE(    29.95), SIMDE_FLOAT16_VALUE(    45.38), SIMDE_FLOAT16_VALUE(   -44.16), SIMDE_FLOAT16_VALUE(    22.44),
+        SIMDE_FLOAT16_VALUE(    2.635), SIMDE_FLOAT16_VALUE(    10.66), SIMDE_FLOAT16_VALUE(     36.6), SIMDE_FLOAT16_VALUE(    7.516),
+        SIMDE_FLOAT16_VALUE(     89.8), SIMDE_FLOAT16_VALUE(   -23.05), SIMDE_FLOAT16_VALUE(   -1.701), SIMDE_FLOAT16_VALUE(   -4.484),
+        SIMDE_FLOAT16_VALUE(    21.52), SIMDE_FLOAT16_VALUE(   -92.25), SIMDE_FLOAT16_VALUE(   -9.336), SIMDE_FLOAT16_VALUE(    36.94),
+        SIMDE_FLOAT16_VALUE(   -11.44), SIMDE_FLOAT16_VALUE(    25.27), SIMDE_FLOAT16_VALUE(    -39.7), SIMDE_FLOAT16_VALUE(   -2.588),
+        SIMDE_FLOAT16_VALUE(    2.732), SIMDE_FLOAT16_VALUE(   -44.56), SIMDE_FLOAT16_VALUE(   -28.66), SIMDE_FLOAT16_VALUE(   -16.58),
+        SIMDE_FLOAT16_VALUE(    -70.5), SIMDE_FLOAT16_VALUE(    48.66), SIMDE_FLOAT16_VALUE(    13.31), SIMDE_FLOAT16_VALUE(   -13.95) } },
+    { { SIMDE_FLOAT16_VALUE(     6.49), SIMDE_FLOAT16_VALUE(     8.29), SIMDE_FLOAT16_VALUE(    1.121), SIMDE_FLOAT16_VALUE(     8.49),
+        SIMDE_FLOAT16_VALUE(     7.79), SIMDE_FLOAT16_VALUE(    1.034), SIMDE_FLOAT16_VALUE(    1.942), SIMDE_FLOAT16_VALUE(     7.63),
+        SIMDE_FLOAT16_VALUE(     7.42), SIMDE_FLOAT16_VALUE(   -3.936), SIMDE_FLOAT16_VALUE(     8.81), SIMDE_FLOAT16_VALUE(   -2.123),
+        SIMDE_FLOAT16_VALUE(   -7.273), SIMDE_FLOAT16_VALUE(   -1.048), SIMDE_FLOAT16_VALUE(    3.312), SIMDE_FLOAT16_VALUE(     2.29),
+        SIMDE_FLOAT16_VALUE(    2.547), SIMDE_FLOAT16_VALUE(    6.895), SIMDE_FLOAT16_VALUE(   -8.734), SIMDE_FLOAT16_VALUE(   -6.414),
+        SIMDE_FLOAT16_VALUE(   -0.604), SIMDE_FLOAT16_VALUE(    3.764), SIMDE_FLOAT16_VALUE(    -4.85), SIMDE_FLOAT16_VALUE(     8.93),
+        SIMDE_FLOAT16_VALUE(    -8.56), SIMDE_FLOAT16_VALUE(   -4.086), SIMDE_FLOAT16_VALUE(    2.676), SIMDE_FLOAT16_VALUE(     3.49),
+        SIMDE_FLOAT16_VALUE(    6.293), SIMDE_FLOAT16_VALUE(   -7.734), SIMDE_FLOAT16_VALUE(     3.94), SIMDE_FLOAT16_VALUE(    -9.26) },
+      { SIMDE_FLOAT16_VALUE(   -7.617), SIMDE_FLOAT16_VALUE(    -5.78), SIMDE_FLOAT16_VALUE(   -2.668), SIMDE_FLOAT16_VALUE(   -5.824),
+        SIMDE_FLOAT16_VALUE(    3.064), SIMDE_FLOAT16_VALUE(    1.051), SIMDE_FLOAT16_VALUE(    2.418), SIMDE_FLOAT16_VALUE(     5.06),
+        SIMDE_FLOAT16_VALUE(   -1.142), SIMDE_FLOAT16_VALUE(   -2.666), SIMDE_FLOAT16_VALUE(    0.853), SIMDE_FLOAT16_VALUE(    4.727),
+        SIMDE_FLOAT16_VALUE(    1.473), SIMDE_FLOAT16_VALUE(   -1.299), SIMDE_FLOAT16_VALUE(   -2.959), SIMDE_FLOAT16_VALUE(    -6.85),
+        SIMDE_FLOAT16_VALUE(    3.521), SIMDE_FLOAT16_VALUE(     5.16), SIMDE_FLOAT16_VALUE(   -1.203), SIMDE_FLOAT16_VALUE(    1.476),
+        SIMDE_FLOAT16_VALUE(    -6.14), SIMDE_FLOAT16_VALUE(     4.03), SIMDE_FLOAT16_VALUE(    7.062), SIMDE_FLOAT16_VALUE(    6.195),
+        SIMDE_FLOAT16_VALUE(-0.005447), SIMDE_FLOAT16_VALUE(    2.764), SIMDE_FLOAT16_VALUE(    -5.59), SIMDE_FLOAT16_VALUE(   -1.415),
+        SIMDE_FLOAT16_VALUE(    5.902), SIMDE_FLOAT16_VALUE(   0.3635), SIMDE_FLOAT16_VALUE(   0.2659), SIMDE_FLOAT16_VALUE(    6.043) },
+      { SIMDE_FLOAT16_VALUE(   -1.501), SIMDE_FLOAT16_VALUE(   -100.6), SIMDE_FLOAT16_VALUE(    46.47), SIMDE_FLOAT16_VALUE(   -29.19),
+        SIMDE_FLOAT16_VALUE(    22.78), SIMDE_FLOAT16_VALUE(    11.35), SIMDE_FLOAT16_VALUE(    -33.9), SIMDE_FLOAT16_VALUE(    28.27),
+        SIMDE_FLOAT16_VALUE(   -18.97), SIMDE_FLOAT16_VALUE(    -15.3), SIMDE_FLOAT16_VALUE(    17.55), SIMDE_FLOAT16_VALUE(    39.84),
+        SIMDE_FLOAT16_VALUE(   -12.07), SIMDE_FLOAT16_VALUE(    7.902), SIMDE_FLOAT16_VALUE(    5.883), SIMDE_FLOAT16_VALUE(   -29.47),
+        SIMDE_FLOAT16_VALUE(   -26.61), SIMDE_FLOAT16_VALUE(     37.4), SIMDE_FLOAT16_VALUE(    19.97), SIMDE_FLOAT16_VALUE(    -5.17),
+        SIMDE_FLOAT16_VALUE(   -11.46), SIMDE_FLOAT16_VALUE(   -25.55), SIMDE_FLOAT16_VALUE(   -89.56), SIMDE_FLOAT16_VALUE(     33.0),
+        SIMDE_FLOAT16_VALUE(   11.336), SIMDE_FLOAT16_VALUE(   -23.64), SIMDE_FLOAT16_VALUE(  -10.016), SIMDE_FLOAT16_VALUE(    -23.3),
+        SIMDE_FLOAT16_VALUE(    39.97), SIMDE_FLOAT16_VALUE(   -43.38), SIMDE_FLOAT16_VALUE(     57.0), SIMDE_FLOAT16_VALUE(    21.34) } },
+    { { SIMDE_FLOAT16_VALUE(    4.305), SIMDE_FLOAT16_VALUE(    5.613), SIMDE_FLOAT16_VALUE(    2.842), SIMDE_FLOAT16_VALUE(    1.278),
+        SIMDE_FLOAT16_VALUE(    -7.47), SIMDE_FLOAT16_VALUE(    3.076), SIMDE_FLOAT16_VALUE(      9.4), SIMDE_FLOAT16_VALUE(   -5.516),
+        SIMDE_FLOAT16_VALUE(     4.97), SIMDE_FLOAT16_VALUE(   -4.453), SIMDE_FLOAT16_VALUE(    4.082), SIMDE_FLOAT16_VALUE(   -8.516),
+        SIMDE_FLOAT16_VALUE(    1.286), SIMDE_FLOAT16_VALUE(   -3.904), SIMDE_FLOAT16_VALUE(  -0.2311), SIMDE_FLOAT16_VALUE(   0.6055),
+        SIMDE_FLOAT16_VALUE(   -8.516), SIMDE_FLOAT16_VALUE(    1.843), SIMDE_FLOAT16_VALUE(    -4.17), SIMDE_FLOAT16_VALUE(    2.824),
+        SIMDE_FLOAT16_VALUE(    -9.21), SIMDE_FLOAT16_VALUE(   -4.234), SIMDE_FLOAT16_VALUE(     6.01), SIMDE_FLOAT16_VALUE(   -0.273),
+        SIMDE_FLOAT16_VALUE(    5.125), SIMDE_FLOAT16_VALUE(     -0.8), SIMDE_FLOAT16_VALUE(   -6.246), SIMDE_FLOAT16_VALUE(    3.502),
+        SIMDE_FLOAT16_VALUE(    -4.59), SIMDE_FLOAT16_VALUE(    1.773), SIMDE_FLOAT16_VALUE(    5.477), SIMDE_FLOAT16_VALUE(    2.475) },
+      { SIMDE_FLOAT16_VALUE(    3.066), SIMDE_FLOAT16_VALUE(   -1.132), SIMDE_FLOAT16_VALUE(   -3.787), SIMDE_FLOAT16_VALUE(     7.77),
+        SIMDE_FLOAT16_VALUE(   -2.418), SIMDE_FLOAT16_VALUE(     9.38), SIMDE_FLOAT16_VALUE(   -2.158), SIMDE_FLOAT16_VALUE(   -0.767),
+        SIMDE_FLOAT16_VALUE(     9.24), SIMDE_FLOAT16_VALUE(  -0.0779), SIMDE_FLOAT16_VALUE(   -9.086), SIMDE_FLOAT16_VALUE(    -7.23),
+        SIMDE_FLOAT16_VALUE(  -1.4795), SIMDE_FLOAT16_VALUE(    -2.06), SIMDE_FLOAT16_VALUE(   -8.016), SIMDE_FLOAT16_VALUE(     1.54),
+        SIMDE_FLOAT16_VALUE(   1.8545), SIMDE_FLOAT16_VALUE(    9.484), SIMDE_FLOAT16_VALUE(   -2.824), SIMDE_FLOAT16_VALUE(    7.754),
+        SIMDE_FLOAT16_VALUE(    3.889), SIMDE_FLOAT16_VALUE(     8.03), SIMDE_FLOAT16_VALUE(    -8.89), SIMDE_FLOAT16_VALUE(     9.79),
+        SIMDE_FLOAT16_VALUE(   -5.297), SIMDE_FLOAT16_VALUE(    4.414), SIMDE_FLOAT16_VALUE(   -3.508), SIMDE_FLOAT16_VALUE(   -1.582),
+        SIMDE_FLOAT16_VALUE(   -2.666), SIMDE_FLOAT16_VALUE(     5.84), SIMDE_FLOAT16_VALUE(   -2.775), SIMDE_FLOAT16_VALUE(    2.824) },
+      { SIMDE_FLOAT16_VALUE(    19.55), SIMDE_FLOAT16_VALUE(    12.34), SIMDE_FLOAT16_VALUE(   -20.69), SIMDE_FLOAT16_VALUE(    17.23),
+        SIMDE_FLOAT16_VALUE(  -10.805), SIMDE_FLOAT16_VALUE(    -77.5), SIMDE_FLOAT16_VALUE(   -24.52), SIMDE_FLOAT16_VALUE(    4.695),
+        SIMDE_FLOAT16_VALUE(    45.56), SIMDE_FLOAT16_VALUE(   -41.53), SIMDE_FLOAT16_VALUE(    -98.7), SIMDE_FLOAT16_VALUE(    47.84),
+        SIMDE_FLOAT16_VALUE(   -9.945), SIMDE_FLOAT16_VALUE(    3.127), SIMDE_FLOAT16_VALUE(     0.92), SIMDE_FLOAT16_VALUE(    -5.21),
+        SIMDE_FLOAT16_VALUE(   -33.28), SIMDE_FLOAT16_VALUE(    -77.4), SIMDE_FLOAT16_VALUE(   -10.12), SIMDE_FLOAT16_VALUE(    -40.3),
+        SIMDE_FLOAT16_VALUE(   -1.811), SIMDE_FLOAT16_VALUE(   -90.44), SIMDE_FLOAT16_VALUE(   -50.78), SIMDE_FLOAT16_VALUE(    61.28),
+        SIMDE_FLOAT16_VALUE(   -23.61), SIMDE_FLOAT16_VALUE(    26.86), SIMDE_FLOAT16_VALUE(    27.45), SIMDE_FLOAT16_VALUE(   -2.402),
+        SIMDE_FLOAT16_VALUE(     1.88), SIMDE_FLOAT16_VALUE(   -31.53), SIMDE_FLOAT16_VALUE(   -22.19), SIMDE_FLOAT16_VALUE(      8.6) } },
+    { { SIMDE_FLOAT16_VALUE(     2.38), SIMDE_FLOAT16_VALUE(  -0.3481), SIMDE_FLOAT16_VALUE(   0.4895), SIMDE_FLOAT16_VALUE(    -9.49),
+        SIMDE_FLOAT16_VALUE(     0.28), SIMDE_FLOAT16_VALUE(    6.234), SIMDE_FLOAT16_VALUE(    1.013), SIMDE_FLOAT16_VALUE(    9.195),
+        SIMDE_FLOAT16_VALUE(    8.266), SIMDE_FLOAT16_VALUE(   -2.096), SIMDE_FLOAT16_VALUE(    2.678), SIMDE_FLOAT16_VALUE(    6.246),
+        SIMDE_FLOAT16_VALUE(     9.82), SIMDE_FLOAT16_VALUE(     8.66), SIMDE_FLOAT16_VALUE(   -8.734), SIMDE_FLOAT16_VALUE(    -9.43),
+        SIMDE_FLOAT16_VALUE(     5.93), SIMDE_FLOAT16_VALUE(   -0.618), SIMDE_FLOAT16_VALUE(   -5.582), SIMDE_FLOAT16_VALUE(     5.25),
+        SIMDE_FLOAT16_VALUE(     3.54), SIMDE_FLOAT16_VALUE(     8.04), SIMDE_FLOAT16_VALUE(     -9.9), SIMDE_FLOAT16_VALUE(     2.19),
+        SIMDE_FLOAT16_VALUE(   -7.727), SIMDE_FLOAT16_VALUE(     5.76), SIMDE_FLOAT16_VALUE(    -0.85), SIMDE_FLOAT16_VALUE(   0.4646),
+        SIMDE_FLOAT16_VALUE(     0.73), SIMDE_FLOAT16_VALUE(   -8.836), SIMDE_FLOAT16_VALUE(   -6.977), SIMDE_FLOAT16_VALUE(    3.592) },
+      { SIMDE_FLOAT16_VALUE(    9.336), SIMDE_FLOAT16_VALUE(     9.69), SIMDE_FLOAT16_VALUE(   -0.629), SIMDE_FLOAT16_VALUE(    2.906),
+        SIMDE_FLOAT16_VALUE(     5.78), SIMDE_FLOAT16_VALUE(    3.562), SIMDE_FLOAT16_VALUE(  -0.2118), SIMDE_FLOAT16_VALUE(   -2.262),
+        SIMDE_FLOAT16_VALUE(    3.076), SIMDE_FLOAT16_VALUE(    -9.37), SIMDE_FLOAT16_VALUE(    1.614), SIMDE_FLOAT16_VALUE(    -8.03),
+        SIMDE_FLOAT16_VALUE(   -7.945), SIMDE_FLOAT16_VALUE(     3.42), SIMDE_FLOAT16_VALUE(    -2.36), SIMDE_FLOAT16_VALUE(     -9.9),
+        SIMDE_FLOAT16_VALUE(   -4.242), SIMDE_FLOAT16_VALUE(   -2.543), SIMDE_FLOAT16_VALUE(    4.125), SIMDE_FLOAT16_VALUE(     9.91),
+        SIMDE_FLOAT16_VALUE(   -0.721), SIMDE_FLOAT16_VALUE(    9.914), SIMDE_FLOAT16_VALUE(   -3.627), SIMDE_FLOAT16_VALUE(     8.96),
+        SIMDE_FLOAT16_VALUE(    -8.25), SIMDE_FLOAT16_VALUE(   -0.655), SIMDE_FLOAT16_VALUE(   -6.918), SIMDE_FLOAT16_VALUE(   -6.465),
+        SIMDE_FLOAT16_VALUE(   -7.418), SIMDE_FLOAT16_VALUE(    3.773), SIMDE_FLOAT16_VALUE(     8.02), SIMDE_FLOAT16_VALUE(   -7.273) },
+      { SIMDE_FLOAT16_VALUE(     25.6), SIMDE_FLOAT16_VALUE(    19.81), SIMDE_FLOAT16_VALUE(    27.28), SIMDE_FLOAT16_VALUE(     7.39),
+        SIMDE_FLOAT16_VALUE(    -20.6), SIMDE_FLOAT16_VALUE(    37.03), SIMDE_FLOAT16_VALUE(    20.58), SIMDE_FLOAT16_VALUE(    -4.24),
+        SIMDE_FLOAT16_VALUE(    5.797), SIMDE_FLOAT16_VALUE(    -83.9), SIMDE_FLOAT16_VALUE(     54.5), SIMDE_FLOAT16_VALUE(   -11.42),
+        SIMDE_FLOAT16_VALUE(   -107.6), SIMDE_FLOAT16_VALUE(    -35.2), SIMDE_FLOAT16_VALUE(   -72.75), SIMDE_FLOAT16_VALUE(    108.7),
+        SIMDE_FLOAT16_VALUE(   -26.73), SIMDE_FLOAT16_VALUE(   -12.45), SIMDE_FLOAT16_VALUE(   -75.06), SIMDE_FLOAT16_VALUE(   -33.66),
+        SIMDE_FLOAT16_VALUE(   -82.25), SIMDE_FLOAT16_VALUE(    29.28), SIMDE_FLOAT16_VALUE(    16.28), SIMDE_FLOAT16_VALUE(    -96.6),
+        SIMDE_FLOAT16_VALUE(     67.5), SIMDE_FLOAT16_VALUE(   -42.47), SIMDE_FLOAT16_VALUE(     8.88), SIMDE_FLOAT16_VALUE(    2.281),
+        SIMDE_FLOAT16_VALUE(    27.92), SIMDE_FLOAT16_VALUE(     68.3), SIMDE_FLOAT16_VALUE(   -29.84), SIMDE_FLOAT16_VALUE(    79.56) } },
+    { { SIMDE_FLOAT16_VALUE(    -8.77), SIMDE_FLOAT16_VALUE(     3.79), SIMDE_FLOAT16_VALUE(   -4.258), SIMDE_FLOAT16_VALUE(   -4.914),
+        SIMDE_FLOAT16_VALUE(   -2.406), SIMDE_FLOAT16_VALUE(   -6.742), SIMDE_FLOAT16_VALUE(    4.277), SIMDE_FLOAT16_VALUE(     7.54),
+        SIMDE_FLOAT16_VALUE(    6.566), SIMDE_FLOAT16_VALUE(    0.845), SIMDE_FLOAT16_VALUE(     6.17), SIMDE_FLOAT16_VALUE(    3.385),
+        SIMDE_FLOAT16_VALUE(    7.586), SIMDE_FLOAT16_VALUE(     6.49), SIMDE_FLOAT16_VALUE(    0.992), SIMDE_FLOAT16_VALUE(   -2.713),
+        SIMDE_FLOAT16_VALUE(    -8.05), SIMDE_FLOAT16_VALUE(     -9.7), SIMDE_FLOAT16_VALUE(   -2.545), SIMDE_FLOAT16_VALUE(     2.16),
+        SIMDE_FLOAT16_VALUE(    4.195), SIMDE_FLOAT16_VALUE(    -9.49), SIMDE_FLOAT16_VALUE(    9.516), SIMDE_FLOAT16_VALUE(    3.355),
+        SIMDE_FLOAT16_VALUE(     9.38), SIMDE_FLOAT16_VALUE(    3.287), SIMDE_FLOAT16_VALUE(   -7.926), SIMDE_FLOAT16_VALUE(   -2.307),
+        SIMDE_FLOAT16_VALUE(   -5.492), SIMDE_FLOAT16_VALUE(    -4.05), SIMDE_FLOAT16_VALUE(   -5.434), SIMDE_FLOAT16_VALUE(     8.19) },
+      { SIMDE_FLOAT16_VALUE(    -6.29), SIMDE_FLOAT16_VALUE(   -3.268), SIMDE_FLOAT16_VALUE(    6.547), SIMDE_FLOAT16_VALUE(    3.006),
+        SIMDE_FLOAT16_VALUE(    3.494), SIMDE_FLOAT16_VALUE(     9.15), SIMDE_FLOAT16_VALUE(    -8.21), SIMDE_FLOAT16_VALUE(    3.902),
+        SIMDE_FLOAT16_VALUE(     8.95), SIMDE_FLOAT16_VALUE(    7.754), SIMDE_FLOAT16_VALUE(     8.53), SIMDE_FLOAT16_VALUE(    -9.04),
+        SIMDE_FLOAT16_VALUE(     8.03), SIMDE_FLOAT16_VALUE(   -4.973), SIMDE_FLOAT16_VALUE(     2.63), SIMDE_FLOAT16_VALUE(   -5.805),
+        SIMDE_FLOAT16_VALUE(      8.2), SIMDE_FLOAT16_VALUE(   -2.207), SIMDE_FLOAT16_VALUE(    -8.16), SIMDE_FLOAT16_VALUE(     9.49),
+        SIMDE_FLOAT16_VALUE(    -3.37), SIMDE_FLOAT16_VALUE(    -9.07), SIMDE_FLOAT16_VALUE(    2.424), SIMDE_FLOAT16_VALUE(   -4.805),
+        SIMDE_FLOAT16_VALUE(   -0.677), SIMDE_FLOAT16_VALUE(    2.342), SIMDE_FLOAT16_VALUE(    9.266), SIMDE_FLOAT16_VALUE(    2.271),
+        SIMDE_FLOAT16_VALUE(    -8.73), SIMDE_FLOAT16_VALUE(   -3.562), SIMDE_FLOAT16_VALUE(  -0.2435), SIMDE_FLOAT16_VALUE(   -7.016) },
+      { SIMDE_FLOAT16_VALUE(    67.56), SIMDE_FLOAT16_VALUE(     4.84), SIMDE_FLOAT16_VALUE(    -13.1), SIMDE_FLOAT16_VALUE(   -44.97),
+        SIMDE_FLOAT16_VALUE(    53.28), SIMDE_FLOAT16_VALUE(   -45.56), SIMDE_FLOAT16_VALUE(   -64.56), SIMDE_FLOAT16_VALUE(   -45.22),
+        SIMDE_FLOAT16_VALUE(    52.25), SIMDE_FLOAT16_VALUE(    58.47), SIMDE_FLOAT16_VALUE(    83.25), SIMDE_FLOAT16_VALUE(    -26.9),
+        SIMDE_FLOAT16_VALUE(     93.2), SIMDE_FLOAT16_VALUE(    14.39), SIMDE_FLOAT16_VALUE(   -13.14), SIMDE_FLOAT16_VALUE(    -12.9),
+        SIMDE_FLOAT16_VALUE(   -87.44), SIMDE_FLOAT16_VALUE(   -61.84), SIMDE_FLOAT16_VALUE(   0.2524), SIMDE_FLOAT16_VALUE(   -41.78),
+        SIMDE_FLOAT16_VALUE(  -100.25), SIMDE_FLOAT16_VALUE(   -6.074), SIMDE_FLOAT16_VALUE(     39.2), SIMDE_FLOAT16_VALUE(    -37.6),
+        SIMDE_FLOAT16_VALUE(   -14.05), SIMDE_FLOAT16_VALUE(    19.75), SIMDE_FLOAT16_VALUE(    -68.2), SIMDE_FLOAT16_VALUE(   -39.38),
+        SIMDE_FLOAT16_VALUE(     33.5), SIMDE_FLOAT16_VALUE(     54.9), SIMDE_FLOAT16_VALUE(    58.75), SIMDE_FLOAT16_VALUE(    36.12) } },
+    { { SIMDE_FLOAT16_VALUE(    1.164), SIMDE_FLOAT16_VALUE(  -0.7075), SIMDE_FLOAT16_VALUE(   -5.137), SIMDE_FLOAT16_VALUE(    7.336),
+        SIMDE_FLOAT16_VALUE(    6.125), SIMDE_FLOAT16_VALUE(   -3.564), SIMDE_FLOAT16_VALUE(   -7.016), SIMDE_FLOAT16_VALUE(   -4.344),
+        SIMDE_FLOAT16_VALUE(   0.9087), SIMDE_FLOAT16_VALUE(   0.8027), SIMDE_FLOAT16_VALUE(    3.787), SIMDE_FLOAT16_VALUE(    0.687),
+        SIMDE_FLOAT16_VALUE(   -1.317), SIMDE_FLOAT16_VALUE(    -8.96), SIMDE_FLOAT16_VALUE(   -5.227), SIMDE_FLOAT16_VALUE(  -0.8115),
+        SIMDE_FLOAT16_VALUE(     3.19), SIMDE_FLOAT16_VALUE(    -4.22), SIMDE_FLOAT16_VALUE(    -9.48), SIMDE_FLOAT16_VALUE(     9.05),
+        SIMDE_FLOAT16_VALUE(   -5.664), SIMDE_FLOAT16_VALUE(   -2.318), SIMDE_FLOAT16_VALUE(   -7.062), SIMDE_FLOAT16_VALUE(  -0.1566),
+        SIMDE_FLOAT16_VALUE(     4.55), SIMDE_FLOAT16_VALUE(     8.54), SIMDE_FLOAT16_VALUE(    -5.33), SIMDE_FLOAT16_VALUE(    -8.42),
+        SIMDE_FLOAT16_VALUE(   -3.936), SIMDE_FLOAT16_VALUE(   0.9995), SIMDE_FLOAT16_VALUE(      9.3), SIMDE_FLOAT16_VALUE(   -5.887) },
+      { SIMDE_FLOAT16_VALUE(    -9.94), SIMDE_FLOAT16_VALUE(   -5.086), SIMDE_FLOAT16_VALUE(    -9.13), SIMDE_FLOAT16_VALUE(    3.127),
+        SIMDE_FLOAT16_VALUE(    3.105), SIMDE_FLOAT16_VALUE(     8.93), SIMDE_FLOAT16_VALUE(   -3.645), SIMDE_FLOAT16_VALUE(   -5.773),
+        SIMDE_FLOAT16_VALUE(   0.8125), SIMDE_FLOAT16_VALUE(     -1.3), SIMDE_FLOAT16_VALUE(    7.113), SIMDE_FLOAT16_VALUE(   0.5996),
+        SIMDE_FLOAT16_VALUE(   -3.488), SIMDE_FLOAT16_VALUE(    9.664), SIMDE_FLOAT16_VALUE(    5.758), SIMDE_FLOAT16_VALUE(    7.906),
+        SIMDE_FLOAT16_VALUE(     5.76), SIMDE_FLOAT16_VALUE(   -2.098), SIMDE_FLOAT16_VALUE(    -9.79), SIMDE_FLOAT16_VALUE(    1.462),
+        SIMDE_FLOAT16_VALUE(    6.656), SIMDE_FLOAT16_VALUE(    4.812), SIMDE_FLOAT16_VALUE(   -3.592), SIMDE_FLOAT16_VALUE(   -3.662),
+        SIMDE_FLOAT16_VALUE(    -6.46), SIMDE_FLOAT16_VALUE(   -2.334), SIMDE_FLOAT16_VALUE(    9.586), SIMDE_FLOAT16_VALUE(   -4.203),
+        SIMDE_FLOAT16_VALUE(     9.73), SIMDE_FLOAT16_VALUE(    3.031), SIMDE_FLOAT16_VALUE(   -5.598), SIMDE_FLOAT16_VALUE(    3.268) },
+      { SIMDE_FLOAT16_VALUE(  -15.164), SIMDE_FLOAT16_VALUE(     1.11), SIMDE_FLOAT16_VALUE(    23.97), SIMDE_FLOAT16_VALUE(   -83.06),
+        SIMDE_FLOAT16_VALUE(    50.84), SIMDE_FLOAT16_VALUE(    43.62), SIMDE_FLOAT16_VALUE(   0.4902), SIMDE_FLOAT16_VALUE(    56.34),
+        SIMDE_FLOAT16_VALUE(    1.781), SIMDE_FLOAT16_VALUE(   -0.529), SIMDE_FLOAT16_VALUE(    26.53), SIMDE_FLOAT16_VALUE(    7.156),
+        SIMDE_FLOAT16_VALUE(     91.2), SIMDE_FLOAT16_VALUE(    18.53), SIMDE_FLOAT16_VALUE(   -23.67), SIMDE_FLOAT16_VALUE(    -46.0),
+        SIMDE_FLOAT16_VALUE(     9.52), SIMDE_FLOAT16_VALUE(    -31.0), SIMDE_FLOAT16_VALUE(    79.56), SIMDE_FLOAT16_VALUE(  -102.44),
+        SIMDE_FLOAT16_VALUE(   -26.55), SIMDE_FLOAT16_VALUE(    -42.7), SIMDE_FLOAT16_VALUE(     24.8), SIMDE_FLOAT16_VALUE(    26.42),
+        SIMDE_FLOAT16_VALUE(    -9.47), SIMDE_FLOAT16_VALUE(    -65.8), SIMDE_FLOAT16_VALUE(    -86.5), SIMDE_FLOAT16_VALUE(   -58.34),
+        SIMDE_FLOAT16_VALUE(    -41.3), SIMDE_FLOAT16_VALUE(   -2.207), SIMDE_FLOAT16_VALUE(    -32.8), SIMDE_FLOAT16_VALUE(    63.34) } },
+    { { SIMDE_FLOAT16_VALUE(    6.965), SIMDE_FLOAT16_VALUE(   -5.945), SIMDE_FLOAT16_VALUE(    6.203), SIMDE_FLOAT16_VALUE(    5.523),
+        SIMDE_FLOAT16_VALUE(     5.43), SIMDE_FLOAT16_VALUE(    -9.89), SIMDE_FLOAT16_VALUE(    -7.95), SIMDE_FLOAT16_VALUE(    -9.37),
+        SIMDE_FLOAT16_VALUE(     8.06), SIMDE_FLOAT16_VALUE(    -7.41), SIMDE_FLOAT16_VALUE(    0.697), SIMDE_FLOAT16_VALUE(    -2.78),
+        SIMDE_FLOAT16_VALUE(   -2.225), SIMDE_FLOAT16_VALUE(    -9.35), SIMDE_FLOAT16_VALUE(     7.84), SIMDE_FLOAT16_VALUE(   -2.504),
+        SIMDE_FLOAT16_VALUE(  0.08307), SIMDE_FLOAT16_VALUE(     5.81), SIMDE_FLOAT16_VALUE(    -5.95), SIMDE_FLOAT16_VALUE(     -7.9),
+        SIMDE_FLOAT16_VALUE(   -8.016), SIMDE_FLOAT16_VALUE(     8.17), SIMDE_FLOAT16_VALUE(    -9.05), SIMDE_FLOAT16_VALUE(   -3.232),
+        SIMDE_FLOAT16_VALUE(   -1.461), SIMDE_FLOAT16_VALUE(    -4.06), SIMDE_FLOAT16_VALUE(   -3.967), SIMDE_FLOAT16_VALUE(   -5.375),
+        SIMDE_FLOAT16_VALUE(     5.73), SIMDE_FLOAT16_VALUE(    3.852), SIMDE_FLOAT16_VALUE(   -1.317), SIMDE_FLOAT16_VALUE(   -5.195) },
+      { SIMDE_FLOAT16_VALUE(    3.645), SIMDE_FLOAT16_VALUE(   -5.406), SIMDE_FLOAT16_VALUE(    3.324), SIMDE_FLOAT16_VALUE(    7.164),
+        SIMDE_FLOAT16_VALUE(     4.11), SIMDE_FLOAT16_VALUE(   -7.215), SIMDE_FLOAT16_VALUE(    -8.95), SIMDE_FLOAT16_VALUE(   -2.506),
+        SIMDE_FLOAT16_VALUE(   -7.875), SIMDE_FLOAT16_VALUE(    -9.36), SIMDE_FLOAT16_VALUE(   0.6343), SIMDE_FLOAT16_VALUE(    6.266),
+        SIMDE_FLOAT16_VALUE(   -8.266), SIMDE_FLOAT16_VALUE(     9.98), SIMDE_FLOAT16_VALUE(    -2.66), SIMDE_FLOAT16_VALUE(     3.81),
+        SIMDE_FLOAT16_VALUE(    6.156), SIMDE_FLOAT16_VALUE(    -7.98), SIMDE_FLOAT16_VALUE(     -8.0), SIMDE_FLOAT16_VALUE(    5.773),
+        SIMDE_FLOAT16_VALUE(   -1.872), SIMDE_FLOAT16_VALUE(    6.254), SIMDE_FLOAT16_VALUE(    0.455), SIMDE_FLOAT16_VALUE(     2.51),
+        SIMDE_FLOAT16_VALUE(   -4.996), SIMDE_FLOAT16_VALUE(    -8.41), SIMDE_FLOAT16_VALUE(    6.305), SIMDE_FLOAT16_VALUE(    3.342),
+        SIMDE_FLOAT16_VALUE(   -7.465), SIMDE_FLOAT16_VALUE(    -9.42), SIMDE_FLOAT16_VALUE(   -4.234), SIMDE_FLOAT16_VALUE(   -0.511) },
+      { SIMDE_FLOAT16_VALUE(   -6.758), SIMDE_FLOAT16_VALUE(    -59.3), SIMDE_FLOAT16_VALUE(   -18.95), SIMDE_FLOAT16_VALUE(     62.8),
+        SIMDE_FLOAT16_VALUE(   -49.03), SIMDE_FLOAT16_VALUE(    -79.8), SIMDE_FLOAT16_VALUE(     47.7), SIMDE_FLOAT16_VALUE(    103.8),
+        SIMDE_FLOAT16_VALUE(   -132.9), SIMDE_FLOAT16_VALUE(   -17.11), SIMDE_FLOAT16_VALUE(    17.86), SIMDE_FLOAT16_VALUE(    2.604),
+        SIMDE_FLOAT16_VALUE(    111.7), SIMDE_FLOAT16_VALUE(     55.1), SIMDE_FLOAT16_VALUE(   -11.31), SIMDE_FLOAT16_VALUE(    36.53),
+        SIMDE_FLOAT16_VALUE(    46.88), SIMDE_FLOAT16_VALUE(     35.1), SIMDE_FLOAT16_VALUE(     93.2), SIMDE_FLOAT16_VALUE(    28.84),
+        SIMDE_FLOAT16_VALUE(    -36.1), SIMDE_FLOAT16_VALUE(   -65.44), SIMDE_FLOAT16_VALUE(    3.996), SIMDE_FLOAT16_VALUE(   -24.17),
+        SIMDE_FLOAT16_VALUE(   -26.81), SIMDE_FLOAT16_VALUE(    32.56), SIMDE_FLOAT16_VALUE(   -7.047), SIMDE_FLOAT16_VALUE(   -47.16),
+        SIMDE_FLOAT16_VALUE(    -6.49), SIMDE_FLOAT16_VALUE(   -82.75), SIMDE_FLOAT16_VALUE(    2.922), SIMDE_FLOAT16_VALUE(    22.67) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512h a = simde_mm512_loadu_ph(test_vec[i].a);
+    simde__m512h b = simde_mm512_loadu_ph(test_vec[i].b);
+    simde__m512h r = simde_mm512_fmul_pch(a, b);
+    simde_test_x86_assert_equal_f16x32(r, simde_mm512_loadu_ph(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm_fcmul_pch (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float16 a[8];
+    const simde_float16 b[8];
+    const simde_float16 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(    -9.28), SIMDE_FLOAT16_VALUE(   -7.477), SIMDE_FLOAT16_VALUE(   -5.125), SIMDE_FLOAT16_VALUE(   -9.164),
+        SIMDE_FLOAT16_VALUE( -0.08374), SIMDE_FLOAT16_VALUE(    1.536), SIMDE_FLOAT16_VALUE(   -1.627), SIMDE_FLOAT16_VALUE(     4.81) },
+      { SIMDE_FLOAT16_VALUE(   -3.604), SIMDE_FLOAT16_VALUE(     7.03), SIMDE_FLOAT16_VALUE(    -3.24), SIMDE_FLOAT16_VALUE(    -6.67),
+        SIMDE_FLOAT16_VALUE(   0.0818), SIMDE_FLOAT16_VALUE(    7.613), SIMDE_FLOAT16_VALUE(   -1.797), SIMDE_FLOAT16_VALUE(    1.582) },
+      { SIMDE_FLOAT16_VALUE(   -19.12), SIMDE_FLOAT16_VALUE(     92.2), SIMDE_FLOAT16_VALUE(    77.75), SIMDE_FLOAT16_VALUE(     -4.5),
+        SIMDE_FLOAT16_VALUE(    11.69), SIMDE_FLOAT16_VALUE(    0.763), SIMDE_FLOAT16_VALUE(    10.53), SIMDE_FLOAT16_VALUE(   -6.066) } },
+    { { SIMDE_FLOAT16_VALUE(     8.66), SIMDE_FLOAT16_VALUE(    2.805), SIMDE_FLOAT16_VALUE(    1.657), SIMDE_FLOAT16_VALUE(   -7.887),
+        SIMDE_FLOAT16_VALUE(      7.5), SIMDE_FLOAT16_VALUE(   -8.805), SIMDE_FLOAT16_VALUE(     5.12), SIMDE_FLOAT16_VALUE(     3.55) },
+      { SIMDE_FLOAT16_VALUE(     6.63), SIMDE_FLOAT16_VALUE(   -1.217), SIMDE_FLOAT16_VALUE(    7.383), SIMDE_FLOAT16_VALUE(   -1.806),
+        SIMDE_FLOAT16_VALUE(   -3.527), SIMDE_FLOAT16_VALUE(   -9.266), SIMDE_FLOAT16_VALUE(   -5.523), SIMDE_FLOAT16_VALUE(    6.137) },
+      { SIMDE_FLOAT16_VALUE(    53.97), SIMDE_FLOAT16_VALUE(    29.12), SIMDE_FLOAT16_VALUE(    26.47), SIMDE_FLOAT16_VALUE(   -55.22),
+        SIMDE_FLOAT16_VALUE(    55.12), SIMDE_FLOAT16_VALUE(   100.56), SIMDE_FLOAT16_VALUE(   -6.496), SIMDE_FLOAT16_VALUE(   -51.03) } },
+    { { SIMDE_FLOAT16_VALUE(    3.719), SIMDE_FLOAT16_VALUE(   -3.643), SIMDE_FLOAT16_VALUE(     8.63), SIMDE_FLOAT16_VALUE(     4.84),
+        SIMDE_FLOAT16_VALUE(   -7.355), SIMDE_FLOAT16_VALUE(   -7.363), SIMDE_FLOAT16_VALUE(     5.63), SIMDE_FLOAT16_VALUE(   -4.465) },
+      { SIMDE_FLOAT16_VALUE(     9.18), SIMDE_FLOAT16_VALUE(    3.002), SIMDE_FLOAT16_VALUE(    7.434), SIMDE_FLOAT16_VALUE(    6.336),
+        SIMDE_FLOAT16_VALUE(   -5.914), SIMDE_FLOAT16_VALUE(    6.723), SIMDE_FLOAT16_VALUE(    -4.63), SIMDE_FLOAT16_VALUE(     4.88) },
+      { SIMDE_FLOAT16_VALUE(     23.2), SIMDE_FLOAT16_VALUE(    -44.6), SIMDE_FLOAT16_VALUE(     94.8), SIMDE_FLOAT16_VALUE(   -18.72),
+        SIMDE_FLOAT16_VALUE(     -6.0), SIMDE_FLOAT16_VALUE(     93.0), SIMDE_FLOAT16_VALUE(   -47.84), SIMDE_FLOAT16_VALUE(   -6.797) } },
+    { { SIMDE_FLOAT16_VALUE(    4.957), SIMDE_FLOAT16_VALUE(   -7.664), SIMDE_FLOAT16_VALUE(    1.138), SIMDE_FLOAT16_VALUE(    6.836),
+        SIMDE_FLOAT16_VALUE(    2.361), SIMDE_FLOAT16_VALUE(     8.01), SIMDE_FLOAT16_VALUE(   -4.508), SIMDE_FLOAT16_VALUE(    4.203) },
+      { SIMDE_FLOAT16_VALUE(   0.7866), SIMDE_FLOAT16_VALUE(    -7.77), SIMDE_FLOAT16_VALUE(    -8.32), SIMDE_FLOAT16_VALUE(  -0.3027),
+        SIMDE_FLOAT16_VALUE(     8.84), SIMDE_FLOAT16_VALUE(    -6.12), SIMDE_FLOAT16_VALUE(   -4.176), SIMDE_FLOAT16_VALUE(   -3.805) },
+      { SIMDE_FLOAT16_VALUE(    63.44), SIMDE_FLOAT16_VALUE(     32.5), SIMDE_FLOAT16_VALUE(   -11.54), SIMDE_FLOAT16_VALUE(   -56.53),
+        SIMDE_FLOAT16_VALUE(   -28.14), SIMDE_FLOAT16_VALUE(    85.25), SIMDE_FLOAT16_VALUE(    2.832), SIMDE_FLOAT16_VALUE(    -34.7) } },
+    { { SIMDE_FLOAT16_VALUE(    -2.24), SIMDE_FLOAT16_VALUE(   -6.773), SIMDE_FLOAT16_VALUE(    -4.71), SIMDE_FLOAT16_VALUE(   -6.363),
+        SIMDE_FLOAT16_VALUE(   -6.812), SIMDE_FLOAT16_VALUE(   -1.067), SIMDE_FLOAT16_VALUE(   0.4932), SIMDE_FLOAT16_VALUE( -0.09875) },
+      { SIMDE_FLOAT16_VALUE(    8.445), SIMDE_FLOAT16_VALUE(   -3.771), SIMDE_FLOAT16_VALUE(     8.27), SIMDE_FLOAT16_VALUE(    -6.46),
+        SIMDE_FLOAT16_VALUE(   -6.816), SIMDE_FLOAT16_VALUE(   -5.676), SIMDE_FLOAT16_VALUE(   -2.922), SIMDE_FLOAT16_VALUE(     6.88) },
+      { SIMDE_FLOAT16_VALUE(    6.625), SIMDE_FLOAT16_VALUE(    -65.6), SIMDE_FLOAT16_VALUE(    2.137), SIMDE_FLOAT16_VALUE(   -83.06),
+        SIMDE_FLOAT16_VALUE(     52.5), SIMDE_FLOAT16_VALUE(   -31.39), SIMDE_FLOAT16_VALUE(   -2.121), SIMDE_FLOAT16_VALUE(   -3.104) } },
+    { { SIMDE_FLOAT16_VALUE(    2.877), SIMDE_FLOAT16_VALUE(    6.727), SIMDE_FLOAT16_VALUE(    -4.97), SIMDE_FLOAT16_VALUE(    -6.95),
+        SIMDE_FLOAT16_VALUE(   -3.107), SIMDE_FLOAT16_VALUE(     7.09), SIMDE_FLOAT16_VALUE(   -2.193), SIMDE_FLOAT16_VALUE(   0.3481) },
+      { SIMDE_FLOAT16_VALUE(     9.48), SIMDE_FLOAT16_VALUE(     4.03), SIMDE_FLOAT16_VALUE(    1.959), SIMDE_FLOAT16_VALUE(    -4.27),
+        SIMDE_FLOAT16_VALUE(    9.305), SIMDE_FLOAT16_VALUE(    -1.18), SIMDE_FLOAT16_VALUE(   -5.484), SIMDE_FLOAT16_VALUE(   -0.631) },
+      { SIMDE_FLOAT16_VALUE(    54.38), SIMDE_FLOAT16_VALUE(    52.16), SIMDE_FLOAT16_VALUE(    19.94), SIMDE_FLOAT16_VALUE(    -34.8),
+        SIMDE_FLOAT16_VALUE(   -37.28), SIMDE_FLOAT16_VALUE(     62.3), SIMDE_FLOAT16_VALUE(    11.81), SIMDE_FLOAT16_VALUE(   -3.293) } },
+    { { SIMDE_FLOAT16_VALUE(     2.96), SIMDE_FLOAT16_VALUE(    4.504), SIMDE_FLOAT16_VALUE(    4.047), SIMDE_FLOAT16_VALUE(     5.98),
+        SIMDE_FLOAT16_VALUE(     -5.1), SIMDE_FLOAT16_VALUE(    4.133), SIMDE_FLOAT16_VALUE(    -3.65), SIMDE_FLOAT16_VALUE(     9.42) },
+      { SIMDE_FLOAT16_VALUE(    3.176), SIMDE_FLOAT16_VALUE(   -1.585), SIMDE_FLOAT16_VALUE(    -8.14), SIMDE_FLOAT16_VALUE(     8.68),
+        SIMDE_FLOAT16_VALUE(    2.578), SIMDE_FLOAT16_VALUE(  -0.1875), SIMDE_FLOAT16_VALUE(   -2.229), SIMDE_FLOAT16_VALUE(   -3.035) },
+      { SIMDE_FLOAT16_VALUE(    2.266), SIMDE_FLOAT16_VALUE(     19.0), SIMDE_FLOAT16_VALUE(    18.97), SIMDE_FLOAT16_VALUE(    -83.8),
+        SIMDE_FLOAT16_VALUE(   -13.93), SIMDE_FLOAT16_VALUE(    9.695), SIMDE_FLOAT16_VALUE(   -20.47), SIMDE_FLOAT16_VALUE(   -32.06) } },
+    { { SIMDE_FLOAT16_VALUE(    5.957), SIMDE_FLOAT16_VALUE(    9.516), SIMDE_FLOAT16_VALUE(      2.3), SIMDE_FLOAT16_VALUE(     4.17),
+        SIMDE_FLOAT16_VALUE(    4.113), SIMDE_FLOAT16_VALUE(   -4.758), SIMDE_FLOAT16_VALUE(    3.281), SIMDE_FLOAT16_VALUE(    8.945) },
+      { SIMDE_FLOAT16_VALUE(    -3.38), SIMDE_FLOAT16_VALUE(    -7.07), SIMDE_FLOAT16_VALUE(   0.1553), SIMDE_FLOAT16_VALUE(    4.734),
+        SIMDE_FLOAT16_VALUE(   -2.951), SIMDE_FLOAT16_VALUE(    4.613), SIMDE_FLOAT16_VALUE(    4.242), SIMDE_FLOAT16_VALUE(    -5.09) },
+      { SIMDE_FLOAT16_VALUE(   -87.44), SIMDE_FLOAT16_VALUE(    9.945), SIMDE_FLOAT16_VALUE(    20.11), SIMDE_FLOAT16_VALUE(   -10.24),
+        SIMDE_FLOAT16_VALUE(    -34.1), SIMDE_FLOAT16_VALUE(   -4.934), SIMDE_FLOAT16_VALUE(   -31.61), SIMDE_FLOAT16_VALUE(    54.66) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128h a = simde_mm_loadu_ph(test_vec[i].a);
+    simde__m128h b = simde_mm_loadu_ph(test_vec[i].b);
+    simde__m128h r = simde_mm_fcmul_pch(a, b);
+    simde_test_x86_assert_equal_f16x8(r, simde_mm_loadu_ph(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm256_fcmul_pch (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float16 a[16];
+    const simde_float16 b[16];
+    const simde_float16 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(   -6.016), SIMDE_FLOAT16_VALUE(    2.703), SIMDE_FLOAT16_VALUE(   -2.234), SIMDE_FLOAT16_VALUE(    -6.12),
+        SIMDE_FLOAT16_VALUE(    -8.48), SIMDE_FLOAT16_VALUE(    2.916), SIMDE_FLOAT16_VALUE(    7.508), SIMDE_FLOAT16_VALUE(    6.895),
+        SIMDE_FLOAT16_VALUE(   -6.242), SIMDE_FLOAT16_VALUE(   -5.453), SIMDE_FLOAT16_VALUE(     9.28), SIMDE_FLOAT16_VALUE(   -3.592),
+        SIMDE_FLOAT16_VALUE(    0.972), SIMDE_FLOAT16_VALUE(   -7.945), SIMDE_FLOAT16_VALUE(     6.64), SIMDE_FLOAT16_VALUE(     5.17) },
+      { SIMDE_FLOAT16_VALUE(    1.497), SIMDE_FLOAT16_VALUE(    8.836), SIMDE_FLOAT16_VALUE(  -1.1045), SIMDE_FLOAT16_VALUE(   -9.234),
+        SIMDE_FLOAT16_VALUE(     5.01), SIMDE_FLOAT16_VALUE(    -5.45), SIMDE_FLOAT16_VALUE(    5.133), SIMDE_FLOAT16_VALUE(   -2.654),
+        SIMDE_FLOAT16_VALUE(    -9.48), SIMDE_FLOAT16_VALUE(    0.648), SIMDE_FLOAT16_VALUE(   -5.938), SIMDE_FLOAT16_VALUE(    -4.55),
+        SIMDE_FLOAT16_VALUE(     8.23), SIMDE_FLOAT16_VALUE(    -9.49), SIMDE_FLOAT16_VALUE(   -1.586), SIMDE_FLOAT16_VALUE(    7.117) },
+      { SIMDE_FLOAT16_VALUE(   14.875), SIMDE_FLOAT16_VALUE(     57.2), SIMDE_FLOAT16_VALUE(     59.0), SIMDE_FLOAT16_VALUE(  -13.875),
+        SIMDE_FLOAT16_VALUE(   -58.38), SIMDE_FLOAT16_VALUE(   -31.58), SIMDE_FLOAT16_VALUE(    20.23), SIMDE_FLOAT16_VALUE(     55.3),
+        SIMDE_FLOAT16_VALUE(    55.62), SIMDE_FLOAT16_VALUE(    55.72), SIMDE_FLOAT16_VALUE(   -38.75), SIMDE_FLOAT16_VALUE(    63.56),
+        SIMDE_FLOAT16_VALUE(    83.44), SIMDE_FLOAT16_VALUE(   -56.12), SIMDE_FLOAT16_VALUE(    26.28), SIMDE_FLOAT16_VALUE(   -55.47) } },
+    { { SIMDE_FLOAT16_VALUE(     5.54), SIMDE_FLOAT16_VALUE(    1.058), SIMDE_FLOAT16_VALUE(    6.527), SIMDE_FLOAT16_VALUE(   -3.857),
+        SIMDE_FLOAT16_VALUE(    1.122), SIMDE_FLOAT16_VALUE(   -7.094), SIMDE_FLOAT16_VALUE(    5.305), SIMDE_FLOAT16_VALUE(     6.47),
+        SIMDE_FLOAT16_VALUE(   -6.375), SIMDE_FLOAT16_VALUE(    7.832), SIMDE_FLOAT16_VALUE(   -3.156), SIMDE_FLOAT16_VALUE(   -3.236),
+        SIMDE_FLOAT16_VALUE(    6.082), SIMDE_FLOAT16_VALUE(   0.2152), SIMDE_FLOAT16_VALUE(     4.55), SIMDE_FLOAT16_VALUE(   -1.645) },
+      { SIMDE_FLOAT16_VALUE(   -1.578), SIMDE_FLOAT16_VALUE(    -8.35), SIMDE_FLOAT16_VALUE(    0.942), SIMDE_FLOAT16_VALUE(     -8.1),
+        SIMDE_FLOAT16_VALUE(   -5.188), SIMDE_FLOAT16_VALUE(   -2.578), SIMDE_FLOAT16_VALUE(     3.23), SIMDE_FLOAT16_VALUE(    9.945),
+        SIMDE_FLOAT16_VALUE(    -3.05), SIMDE_FLOAT16_VALUE(    3.215), SIMDE_FLOAT16_VALUE(     8.64), SIMDE_FLOAT16_VALUE(     9.47),
+        SIMDE_FLOAT16_VALUE(   -0.713), SIMDE_FLOAT16_VALUE(    1.498), SIMDE_FLOAT16_VALUE(   -0.787), SIMDE_FLOAT16_VALUE(   -6.637) },
+      { SIMDE_FLOAT16_VALUE(   -17.58), SIMDE_FLOAT16_VALUE(     44.6), SIMDE_FLOAT16_VALUE(     37.4), SIMDE_FLOAT16_VALUE(    49.25),
+        SIMDE_FLOAT16_VALUE(    12.47), SIMDE_FLOAT16_VALUE(     39.7), SIMDE_FLOAT16_VALUE(     81.5), SIMDE_FLOAT16_VALUE(   -31.86),
+        SIMDE_FLOAT16_VALUE(    44.62), SIMDE_FLOAT16_VALUE(   -3.398), SIMDE_FLOAT16_VALUE(    -57.9), SIMDE_FLOAT16_VALUE(    1.922),
+        SIMDE_FLOAT16_VALUE(    -4.01), SIMDE_FLOAT16_VALUE(   -9.266), SIMDE_FLOAT16_VALUE(    7.332), SIMDE_FLOAT16_VALUE(     31.5) } },
+    { { SIMDE_FLOAT16_VALUE(     4.62), SIMDE_FLOAT16_VALUE(    7.273), SIMDE_FLOAT16_VALUE(    -7.72), SIMDE_FLOAT16_VALUE( -0.02278),
+        SIMDE_FLOAT16_VALUE(  -0.6143), SIMDE_FLOAT16_VALUE(     1.45), SIMDE_FLOAT16_VALUE(   -3.084), SIMDE_FLOAT16_VALUE(   -5.832),
+        SIMDE_FLOAT16_VALUE(     8.77), SIMDE_FLOAT16_VALUE(    -1.89), SIMDE_FLOAT16_VALUE(     3.08), SIMDE_FLOAT16_VALUE(   -6.758),
+        SIMDE_FLOAT16_VALUE(    -7.54), SIMDE_FLOAT16_VALUE(   -7.457), SIMDE_FLOAT16_VALUE(    -9.97), SIMDE_FLOAT16_VALUE(    3.076) },
+      { SIMDE_FLOAT16_VALUE(   -5.562), SIMDE_FLOAT16_VALUE(      5.3), SIMDE_FLOAT16_VALUE(    7.785), SIMDE_FLOAT16_VALUE(     7.37),
+        SIMDE_FLOAT16_VALUE(    1.363), SIMDE_FLOAT16_VALUE(    0.636), SIMDE_FLOAT16_VALUE(    -4.59), SIMDE_FLOAT16_VALUE(     3.67),
+        SIMDE_FLOAT16_VALUE(    7.574), SIMDE_FLOAT16_VALUE(   -4.664), SIMDE_FLOAT16_VALUE(    9.375), SIMDE_FLOAT16_VALUE(   0.7837),
+        SIMDE_FLOAT16_VALUE(    -5.04), SIMDE_FLOAT16_VALUE(     2.18), SIMDE_FLOAT16_VALUE(    9.305), SIMDE_FLOAT16_VALUE(    6.824) },
+      { SIMDE_FLOAT16_VALUE(    12.85), SIMDE_FLOAT16_VALUE(   -64.94), SIMDE_FLOAT16_VALUE(   -60.25), SIMDE_FLOAT16_VALUE(    56.72),
+        SIMDE_FLOAT16_VALUE(  0.08527), SIMDE_FLOAT16_VALUE(    2.367), SIMDE_FLOAT16_VALUE(    -7.25), SIMDE_FLOAT16_VALUE(     38.1),
+        SIMDE_FLOAT16_VALUE(    75.25), SIMDE_FLOAT16_VALUE(    26.61), SIMDE_FLOAT16_VALUE(    23.58), SIMDE_FLOAT16_VALUE(   -65.75),
+        SIMDE_FLOAT16_VALUE(    21.73), SIMDE_FLOAT16_VALUE(     54.0), SIMDE_FLOAT16_VALUE(   -71.75), SIMDE_FLOAT16_VALUE(     96.6) } },
+    { { SIMDE_FLOAT16_VALUE(    4.062), SIMDE_FLOAT16_VALUE(   -0.379), SIMDE_FLOAT16_VALUE(    1.856), SIMDE_FLOAT16_VALUE(   -3.977),
+        SIMDE_FLOAT16_VALUE(    -4.51), SIMDE_FLOAT16_VALUE(    2.438), SIMDE_FLOAT16_VALUE(   0.3005), SIMDE_FLOAT16_VALUE(    -9.34),
+        SIMDE_FLOAT16_VALUE(    -6.04), SIMDE_FLOAT16_VALUE(    -9.28), SIMDE_FLOAT16_VALUE(    -5.11), SIMDE_FLOAT16_VALUE(    2.658),
+        SIMDE_FLOAT16_VALUE(    9.305), SIMDE_FLOAT16_VALUE(   -7.207), SIMDE_FLOAT16_VALUE(    1.264), SIMDE_FLOAT16_VALUE(    1.704) },
+      { SIMDE_FLOAT16_VALUE(    3.936), SIMDE_FLOAT16_VALUE(    -6.46), SIMDE_FLOAT16_VALUE(   -2.453), SIMDE_FLOAT16_VALUE(    -8.22),
+        SIMDE_FLOAT16_VALUE(     9.92), SIMDE_FLOAT16_VALUE(   -4.207), SIMDE_FLOAT16_VALUE(   0.4536), SIMDE_FLOAT16_VALUE(    2.836),
+        SIMDE_FLOAT16_VALUE(     8.24), SIMDE_FLOAT16_VALUE(    0.379), SIMDE_FLOAT16_VALUE(    5.055), SIMDE_FLOAT16_VALUE(   -5.973),
+        SIMDE_FLOAT16_VALUE(    3.027), SIMDE_FLOAT16_VALUE(  -0.1648), SIMDE_FLOAT16_VALUE(    0.379), SIMDE_FLOAT16_VALUE(    6.703) },
+      { SIMDE_FLOAT16_VALUE(    18.44), SIMDE_FLOAT16_VALUE(    24.75), SIMDE_FLOAT16_VALUE(    28.12), SIMDE_FLOAT16_VALUE(    25.02),
+        SIMDE_FLOAT16_VALUE(   -55.03), SIMDE_FLOAT16_VALUE(    5.203), SIMDE_FLOAT16_VALUE(   -26.36), SIMDE_FLOAT16_VALUE(    -5.09),
+        SIMDE_FLOAT16_VALUE(   -53.28), SIMDE_FLOAT16_VALUE(    -74.2), SIMDE_FLOAT16_VALUE(    -41.7), SIMDE_FLOAT16_VALUE(   -17.08),
+        SIMDE_FLOAT16_VALUE(    29.36), SIMDE_FLOAT16_VALUE(   -20.28), SIMDE_FLOAT16_VALUE(     11.9), SIMDE_FLOAT16_VALUE(   -7.824) } },
+    { { SIMDE_FLOAT16_VALUE(   -5.625), SIMDE_FLOAT16_VALUE(    7.367), SIMDE_FLOAT16_VALUE(   -1.043), SIMDE_FLOAT16_VALUE(    -9.54),
+        SIMDE_FLOAT16_VALUE(    2.129), SIMDE_FLOAT16_VALUE(    -8.51), SIMDE_FLOAT16_VALUE(    3.342), SIMDE_FLOAT16_VALUE(    -8.55),
+        SIMDE_FLOAT16_VALUE(    5.715), SIMDE_FLOAT16_VALUE(   -7.246), SIMDE_FLOAT16_VALUE(   -1.167), SIMDE_FLOAT16_VALUE(     9.78),
+        SIMDE_FLOAT16_VALUE(   -2.822), SIMDE_FLOAT16_VALUE(    2.719), SIMDE_FLOAT16_VALUE(    -9.31), SIMDE_FLOAT16_VALUE(   -7.582) },
+      { SIMDE_FLOAT16_VALUE(    -8.61), SIMDE_FLOAT16_VALUE(    -8.03), SIMDE_FLOAT16_VALUE(  -0.1532), SIMDE_FLOAT16_VALUE(    1.589),
+        SIMDE_FLOAT16_VALUE(    6.656), SIMDE_FLOAT16_VALUE(    7.438), SIMDE_FLOAT16_VALUE(   -1.442), SIMDE_FLOAT16_VALUE(     -4.8),
+        SIMDE_FLOAT16_VALUE(   -8.414), SIMDE_FLOAT16_VALUE(   -1.178), SIMDE_FLOAT16_VALUE(    6.832), SIMDE_FLOAT16_VALUE(    4.844),
+        SIMDE_FLOAT16_VALUE(   -0.642), SIMDE_FLOAT16_VALUE(    -9.52), SIMDE_FLOAT16_VALUE(    -2.61), SIMDE_FLOAT16_VALUE(    3.314) },
+      { SIMDE_FLOAT16_VALUE(   -10.74), SIMDE_FLOAT16_VALUE(   -108.6), SIMDE_FLOAT16_VALUE(    -15.0), SIMDE_FLOAT16_VALUE(     3.12),
+        SIMDE_FLOAT16_VALUE(    -49.1), SIMDE_FLOAT16_VALUE(   -72.44), SIMDE_FLOAT16_VALUE(    36.22), SIMDE_FLOAT16_VALUE(    28.38),
+        SIMDE_FLOAT16_VALUE(   -39.56), SIMDE_FLOAT16_VALUE(     67.7), SIMDE_FLOAT16_VALUE(     39.4), SIMDE_FLOAT16_VALUE(     72.5),
+        SIMDE_FLOAT16_VALUE(   -24.08), SIMDE_FLOAT16_VALUE(   -28.62), SIMDE_FLOAT16_VALUE(  -0.8306), SIMDE_FLOAT16_VALUE(    50.66) } },
+    { { SIMDE_FLOAT16_VALUE(    4.066), SIMDE_FLOAT16_VALUE(   -0.809), SIMDE_FLOAT16_VALUE(     -9.5), SIMDE_FLOAT16_VALUE(   -3.648),
+        SIMDE_FLOAT16_VALUE(     -6.4), SIMDE_FLOAT16_VALUE(   -6.668), SIMDE_FLOAT16_VALUE(   -3.275), SIMDE_FLOAT16_VALUE(    4.832),
+        SIMDE_FLOAT16_VALUE(   -1.073), SIMDE_FLOAT16_VALUE(   -6.168), SIMDE_FLOAT16_VALUE(   -2.615), SIMDE_FLOAT16_VALUE(   -9.555),
+        SIMDE_FLOAT16_VALUE(    3.307), SIMDE_FLOAT16_VALUE(    -8.76), SIMDE_FLOAT16_VALUE(   -0.942), SIMDE_FLOAT16_VALUE(   -0.721) },
+      { SIMDE_FLOAT16_VALUE(    -9.18), SIMDE_FLOAT16_VALUE(   0.2324), SIMDE_FLOAT16_VALUE(    4.258), SIMDE_FLOAT16_VALUE(     8.58),
+        SIMDE_FLOAT16_VALUE(    0.808), SIMDE_FLOAT16_VALUE(    6.484), SIMDE_FLOAT16_VALUE(     8.95), SIMDE_FLOAT16_VALUE(    -9.64),
+        SIMDE_FLOAT16_VALUE(    -1.74), SIMDE_FLOAT16_VALUE(    6.746), SIMDE_FLOAT16_VALUE(    8.734), SIMDE_FLOAT16_VALUE(     9.49),
+        SIMDE_FLOAT16_VALUE(   -7.742), SIMDE_FLOAT16_VALUE(   -5.234), SIMDE_FLOAT16_VALUE(-0.001463), SIMDE_FLOAT16_VALUE(    6.875) },
+      { SIMDE_FLOAT16_VALUE(   -37.53), SIMDE_FLOAT16_VALUE(     6.48), SIMDE_FLOAT16_VALUE(   -71.75), SIMDE_FLOAT16_VALUE(    65.94),
+        SIMDE_FLOAT16_VALUE(    -48.4), SIMDE_FLOAT16_VALUE(     36.1), SIMDE_FLOAT16_VALUE(   -75.94), SIMDE_FLOAT16_VALUE(    11.69),
+        SIMDE_FLOAT16_VALUE(   -39.75), SIMDE_FLOAT16_VALUE(    17.97), SIMDE_FLOAT16_VALUE(  -113.56), SIMDE_FLOAT16_VALUE(   -58.62),
+        SIMDE_FLOAT16_VALUE(    20.23), SIMDE_FLOAT16_VALUE(     85.1), SIMDE_FLOAT16_VALUE(   -4.957), SIMDE_FLOAT16_VALUE(    6.477) } },
+    { { SIMDE_FLOAT16_VALUE(    3.738), SIMDE_FLOAT16_VALUE(     8.63), SIMDE_FLOAT16_VALUE(    9.586), SIMDE_FLOAT16_VALUE(    5.277),
+        SIMDE_FLOAT16_VALUE(   -7.086), SIMDE_FLOAT16_VALUE(   -6.133), SIMDE_FLOAT16_VALUE(   -5.926), SIMDE_FLOAT16_VALUE(   -2.895),
+        SIMDE_FLOAT16_VALUE(   0.5444), SIMDE_FLOAT16_VALUE(   -1.597), SIMDE_FLOAT16_VALUE(     5.26), SIMDE_FLOAT16_VALUE(    1.206),
+        SIMDE_FLOAT16_VALUE(   -1.921), SIMDE_FLOAT16_VALUE(    5.758), SIMDE_FLOAT16_VALUE(   -0.757), SIMDE_FLOAT16_VALUE(    -8.14) },
+      { SIMDE_FLOAT16_VALUE(    -9.59), SIMDE_FLOAT16_VALUE(  -1.1045), SIMDE_FLOAT16_VALUE(    -4.91), SIMDE_FLOAT16_VALUE(   0.8984),
+        SIMDE_FLOAT16_VALUE(    -8.19), SIMDE_FLOAT16_VALUE(   -7.523), SIMDE_FLOAT16_VALUE(   -1.503), SIMDE_FLOAT16_VALUE(    0.627),
+        SIMDE_FLOAT16_VALUE(   -3.336), SIMDE_FLOAT16_VALUE(    5.992), SIMDE_FLOAT16_VALUE(  0.08136), SIMDE_FLOAT16_VALUE(   -7.707),
+        SIMDE_FLOAT16_VALUE(     9.54), SIMDE_FLOAT16_VALUE(    -8.34), SIMDE_FLOAT16_VALUE(   -3.375), SIMDE_FLOAT16_VALUE(    -6.86) },
+      { SIMDE_FLOAT16_VALUE(    -45.4), SIMDE_FLOAT16_VALUE(    -78.7), SIMDE_FLOAT16_VALUE(    -42.3), SIMDE_FLOAT16_VALUE(   -34.53),
+        SIMDE_FLOAT16_VALUE(    104.1), SIMDE_FLOAT16_VALUE(   -3.098), SIMDE_FLOAT16_VALUE(     7.09), SIMDE_FLOAT16_VALUE(     8.06),
+        SIMDE_FLOAT16_VALUE(   -11.38), SIMDE_FLOAT16_VALUE(    2.064), SIMDE_FLOAT16_VALUE(    -8.87), SIMDE_FLOAT16_VALUE(    40.66),
+        SIMDE_FLOAT16_VALUE(    -66.4), SIMDE_FLOAT16_VALUE(     38.9), SIMDE_FLOAT16_VALUE(     58.4), SIMDE_FLOAT16_VALUE(    22.28) } },
+    { { SIMDE_FLOAT16_VALUE(     5.16), SIMDE_FLOAT16_VALUE(    2.512), SIMDE_FLOAT16_VALUE(   -3.418), SIMDE_FLOAT16_VALUE(    -9.62),
+        SIMDE_FLOAT16_VALUE(   -2.389), SIMDE_FLOAT16_VALUE(    1.255), SIMDE_FLOAT16_VALUE(    -9.15), SIMDE_FLOAT16_VALUE(     8.52),
+        SIMDE_FLOAT16_VALUE(   -6.445), SIMDE_FLOAT16_VALUE(     5.43), SIMDE_FLOAT16_VALUE(   -1.687), SIMDE_FLOAT16_VALUE(    -5.57),
+        SIMDE_FLOAT16_VALUE(     9.56), SIMDE_FLOAT16_VALUE(    7.562), SIMDE_FLOAT16_VALUE(    -9.14), SIMDE_FLOAT16_VALUE(   -1.151) },
+      { SIMDE_FLOAT16_VALUE(   -6.625), SIMDE_FLOAT16_VALUE(    3.225), SIMDE_FLOAT16_VALUE(      8.8), SIMDE_FLOAT16_VALUE(   -3.395),
+        SIMDE_FLOAT16_VALUE(    3.975), SIMDE_FLOAT16_VALUE(     8.89), SIMDE_FLOAT16_VALUE(    2.387), SIMDE_FLOAT16_VALUE(   -1.105),
+        SIMDE_FLOAT16_VALUE(    3.166), SIMDE_FLOAT16_VALUE(     -8.4), SIMDE_FLOAT16_VALUE(    6.316), SIMDE_FLOAT16_VALUE(   -7.176),
+        SIMDE_FLOAT16_VALUE(     8.03), SIMDE_FLOAT16_VALUE(    5.582), SIMDE_FLOAT16_VALUE(    -8.43), SIMDE_FLOAT16_VALUE(   -3.922) },
+      { SIMDE_FLOAT16_VALUE(    -26.1), SIMDE_FLOAT16_VALUE(   -33.28), SIMDE_FLOAT16_VALUE(    2.578), SIMDE_FLOAT16_VALUE(    -96.2),
+        SIMDE_FLOAT16_VALUE(    1.663), SIMDE_FLOAT16_VALUE(    26.22), SIMDE_FLOAT16_VALUE(   -31.25), SIMDE_FLOAT16_VALUE(    10.23),
+        SIMDE_FLOAT16_VALUE(    -66.0), SIMDE_FLOAT16_VALUE(   -36.94), SIMDE_FLOAT16_VALUE(    29.31), SIMDE_FLOAT16_VALUE(   -47.28),
+        SIMDE_FLOAT16_VALUE(    119.0), SIMDE_FLOAT16_VALUE(     7.36), SIMDE_FLOAT16_VALUE(    81.56), SIMDE_FLOAT16_VALUE(   -26.14) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256h a = simde_mm256_loadu_ph(test_vec[i].a);
+    simde__m256h b = simde_mm256_loadu_ph(test_vec[i].b);
+    simde__m256h r = simde_mm256_fcmul_pch(a, b);
+    simde_test_x86_assert_equal_f16x16(r, simde_mm256_loadu_ph(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm512_fcmul_pch (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float16 a[32];
+    const simde_float16 b[32];
+    const simde_float16 r[32];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(    6.543), SIMDE_FLOAT16_VALUE(   -0.981), SIMDE_FLOAT16_VALUE(     9.84), SIMDE_FLOAT16_VALUE(    6.188),
+        SIMDE_FLOAT16_VALUE(    1.674), SIMDE_FLOAT16_VALUE(    1.527), SIMDE_FLOAT16_VALUE(    -8.65), SIMDE_FLOAT16_VALUE(   -2.266),
+        SIMDE_FLOAT16_VALUE(     6.62), SIMDE_FLOAT16_VALUE(   -2.723), SIMDE_FLOAT16_VALUE(    9.016), SIMDE_FLOAT16_VALUE(   0.4375),
+        SIMDE_FLOAT16_VALUE(   -6.336), SIMDE_FLOAT16_VALUE(    9.164), SIMDE_FLOAT16_VALUE(    4.508), SIMDE_FLOAT16_VALUE(   -5.594),
+        SIMDE_FLOAT16_VALUE(   -3.104), SIMDE_FLOAT16_VALUE(    6.152), SIMDE_FLOAT16_VALUE(    1.114), SIMDE_FLOAT16_VALUE(     5.34),
+        SIMDE_FLOAT16_VALUE(   -5.445), SIMDE_FLOAT16_VALUE( -0.01257), SIMDE_FLOAT16_VALUE(    -6.64), SIMDE_FLOAT16_VALUE(    2.387),
+        SIMDE_FLOAT16_VALUE(   0.4192), SIMDE_FLOAT16_VALUE(    1.052), SIMDE_FLOAT16_VALUE(     8.67), SIMDE_FLOAT16_VALUE(    -8.85),
+        SIMDE_FLOAT16_VALUE(    -9.61), SIMDE_FLOAT16_VALUE(     8.14), SIMDE_FLOAT16_VALUE(    -4.39), SIMDE_FLOAT16_VALUE(   -7.285) },
+      { SIMDE_FLOAT16_VALUE(    1.237), SIMDE_FLOAT16_VALUE(   -2.604), SIMDE_FLOAT16_VALUE(   -9.164), SIMDE_FLOAT16_VALUE(   -2.734),
+        SIMDE_FLOAT16_VALUE(   -1.058), SIMDE_FLOAT16_VALUE(     4.03), SIMDE_FLOAT16_VALUE(    0.755), SIMDE_FLOAT16_VALUE(     8.02),
+        SIMDE_FLOAT16_VALUE(    1.042), SIMDE_FLOAT16_VALUE(    -3.67), SIMDE_FLOAT16_VALUE(    7.098), SIMDE_FLOAT16_VALUE(   -6.324),
+        SIMDE_FLOAT16_VALUE(  -0.6494), SIMDE_FLOAT16_VALUE(    -5.84), SIMDE_FLOAT16_VALUE(    5.176), SIMDE_FLOAT16_VALUE(  -0.7896),
+        SIMDE_FLOAT16_VALUE(     8.31), SIMDE_FLOAT16_VALUE(   -2.902), SIMDE_FLOAT16_VALUE(    -9.38), SIMDE_FLOAT16_VALUE(    5.855),
+        SIMDE_FLOAT16_VALUE(    8.766), SIMDE_FLOAT16_VALUE(    -9.63), SIMDE_FLOAT16_VALUE(   -2.594), SIMDE_FLOAT16_VALUE(     0.99),
+        SIMDE_FLOAT16_VALUE(   -1.124), SIMDE_FLOAT16_VALUE(    -4.85), SIMDE_FLOAT16_VALUE(    5.508), SIMDE_FLOAT16_VALUE(    8.875),
+        SIMDE_FLOAT16_VALUE(    3.377), SIMDE_FLOAT16_VALUE(   -1.737), SIMDE_FLOAT16_VALUE(      5.8), SIMDE_FLOAT16_VALUE(   -4.168) },
+      { SIMDE_FLOAT16_VALUE(    10.65), SIMDE_FLOAT16_VALUE(    15.82), SIMDE_FLOAT16_VALUE(   -107.1), SIMDE_FLOAT16_VALUE(   -29.78),
+        SIMDE_FLOAT16_VALUE(    4.387), SIMDE_FLOAT16_VALUE(    -8.36), SIMDE_FLOAT16_VALUE(    -24.7), SIMDE_FLOAT16_VALUE(     67.7),
+        SIMDE_FLOAT16_VALUE(    16.89), SIMDE_FLOAT16_VALUE(    21.47), SIMDE_FLOAT16_VALUE(    61.22), SIMDE_FLOAT16_VALUE(    60.12),
+        SIMDE_FLOAT16_VALUE(    -49.4), SIMDE_FLOAT16_VALUE(   -42.94), SIMDE_FLOAT16_VALUE(    27.75), SIMDE_FLOAT16_VALUE(   -25.39),
+        SIMDE_FLOAT16_VALUE(   -43.66), SIMDE_FLOAT16_VALUE(    42.12), SIMDE_FLOAT16_VALUE(    20.81), SIMDE_FLOAT16_VALUE(   -56.62),
+        SIMDE_FLOAT16_VALUE(   -47.62), SIMDE_FLOAT16_VALUE(   -52.56), SIMDE_FLOAT16_VALUE(     19.6), SIMDE_FLOAT16_VALUE(   0.3853),
+        SIMDE_FLOAT16_VALUE(   -5.574), SIMDE_FLOAT16_VALUE(   0.8516), SIMDE_FLOAT16_VALUE(    -30.8), SIMDE_FLOAT16_VALUE(   -125.7),
+        SIMDE_FLOAT16_VALUE(    -46.6), SIMDE_FLOAT16_VALUE(     10.8), SIMDE_FLOAT16_VALUE(    4.895), SIMDE_FLOAT16_VALUE(   -60.56) } },
+    { { SIMDE_FLOAT16_VALUE(    6.668), SIMDE_FLOAT16_VALUE(    9.484), SIMDE_FLOAT16_VALUE(    5.406), SIMDE_FLOAT16_VALUE(    -9.42),
+        SIMDE_FLOAT16_VALUE(     2.15), SIMDE_FLOAT16_VALUE(   -5.832), SIMDE_FLOAT16_VALUE(    2.848), SIMDE_FLOAT16_VALUE(    -5.69),
+        SIMDE_FLOAT16_VALUE(   -5.535), SIMDE_FLOAT16_VALUE(    7.387), SIMDE_FLOAT16_VALUE(    3.148), SIMDE_FLOAT16_VALUE(   -6.574),
+        SIMDE_FLOAT16_VALUE(     8.78), SIMDE_FLOAT16_VALUE(    6.387), SIMDE_FLOAT16_VALUE(     9.49), SIMDE_FLOAT16_VALUE(    5.777),
+        SIMDE_FLOAT16_VALUE(    -7.05), SIMDE_FLOAT16_VALUE(   -4.055), SIMDE_FLOAT16_VALUE(     5.17), SIMDE_FLOAT16_VALUE(    2.955),
+        SIMDE_FLOAT16_VALUE(    6.574), SIMDE_FLOAT16_VALUE(     9.43), SIMDE_FLOAT16_VALUE(    5.785), SIMDE_FLOAT16_VALUE(   -5.164),
+        SIMDE_FLOAT16_VALUE(   -0.434), SIMDE_FLOAT16_VALUE(   -5.676), SIMDE_FLOAT16_VALUE(     1.07), SIMDE_FLOAT16_VALUE(     7.85),
+        SIMDE_FLOAT16_VALUE(   -3.045), SIMDE_FLOAT16_VALUE(   -6.547), SIMDE_FLOAT16_VALUE(    5.066), SIMDE_FLOAT16_VALUE(    5.836) },
+      { SIMDE_FLOAT16_VALUE(    4.105), SIMDE_FLOAT16_VALUE(    -1.64), SIMDE_FLOAT16_VALUE(   -4.207), SIMDE_FLOAT16_VALUE(   0.3003),
+        SIMDE_FLOAT16_VALUE(   -2.209), SIMDE_FLOAT16_VALUE(    6.934), SIMDE_FLOAT16_VALUE(    4.973), SIMDE_FLOAT16_VALUE(  -0.3513),
+        SIMDE_FLOAT16_VALUE(     3.97), SIMDE_FLOAT16_VALUE(     4.93), SIMDE_FLOAT16_VALUE(    5.715), SIMDE_FLOAT16_VALUE(    1.937),
+        SIMDE_FLOAT16_VALUE(    -9.86), SIMDE_FLOAT16_VALUE(    -4.83), SIMDE_FLOAT16_VALUE(     3.72), SIMDE_FLOAT16_VALUE(     9.29),
+        SIMDE_FLOAT16_VALUE(    7.793), SIMDE_FLOAT16_VALUE(    -6.24), SIMDE_FLOAT16_VALUE(    7.805), SIMDE_FLOAT16_VALUE(     -5.4),
+        SIMDE_FLOAT16_VALUE(     8.19), SIMDE_FLOAT16_VALUE(    0.876), SIMDE_FLOAT16_VALUE(   -6.938), SIMDE_FLOAT16_VALUE(     5.41),
+        SIMDE_FLOAT16_VALUE(  -0.8965), SIMDE_FLOAT16_VALUE(   0.5615), SIMDE_FLOAT16_VALUE(    4.258), SIMDE_FLOAT16_VALUE(   -2.516),
+        SIMDE_FLOAT16_VALUE(    -3.02), SIMDE_FLOAT16_VALUE(    1.484), SIMDE_FLOAT16_VALUE(     9.52), SIMDE_FLOAT16_VALUE(      8.3) },
+      { SIMDE_FLOAT16_VALUE(    11.82), SIMDE_FLOAT16_VALUE(    49.88), SIMDE_FLOAT16_VALUE(   -25.58), SIMDE_FLOAT16_VALUE(     38.0),
+        SIMDE_FLOAT16_VALUE(    -45.2), SIMDE_FLOAT16_VALUE(   -2.027), SIMDE_FLOAT16_VALUE(    16.16), SIMDE_FLOAT16_VALUE(    -27.3),
+        SIMDE_FLOAT16_VALUE(    14.44), SIMDE_FLOAT16_VALUE(    56.62), SIMDE_FLOAT16_VALUE(     5.26), SIMDE_FLOAT16_VALUE(   -43.66),
+        SIMDE_FLOAT16_VALUE(  -117.44), SIMDE_FLOAT16_VALUE(   -20.58), SIMDE_FLOAT16_VALUE(     89.0), SIMDE_FLOAT16_VALUE(    -66.7),
+        SIMDE_FLOAT16_VALUE(   -29.66), SIMDE_FLOAT16_VALUE(   -75.56), SIMDE_FLOAT16_VALUE(     24.4), SIMDE_FLOAT16_VALUE(    50.97),
+        SIMDE_FLOAT16_VALUE(     62.1), SIMDE_FLOAT16_VALUE(    71.44), SIMDE_FLOAT16_VALUE(   -68.06), SIMDE_FLOAT16_VALUE(    4.527),
+        SIMDE_FLOAT16_VALUE(   -2.799), SIMDE_FLOAT16_VALUE(    5.332), SIMDE_FLOAT16_VALUE(  -15.195), SIMDE_FLOAT16_VALUE(    36.12),
+        SIMDE_FLOAT16_VALUE(   -0.524), SIMDE_FLOAT16_VALUE(    24.28), SIMDE_FLOAT16_VALUE(     96.7), SIMDE_FLOAT16_VALUE(    13.54) } },
+    { { SIMDE_FLOAT16_VALUE(    -3.67), SIMDE_FLOAT16_VALUE(    5.895), SIMDE_FLOAT16_VALUE(    -9.65), SIMDE_FLOAT16_VALUE(  -0.7837),
+        SIMDE_FLOAT16_VALUE(    7.094), SIMDE_FLOAT16_VALUE(    2.807), SIMDE_FLOAT16_VALUE(   -6.965), SIMDE_FLOAT16_VALUE(     5.19),
+        SIMDE_FLOAT16_VALUE(    2.281), SIMDE_FLOAT16_VALUE(    2.982), SIMDE_FLOAT16_VALUE(     6.22), SIMDE_FLOAT16_VALUE(    -1.97),
+        SIMDE_FLOAT16_VALUE(   -2.912), SIMDE_FLOAT16_VALUE(    -8.86), SIMDE_FLOAT16_VALUE(   -1.272), SIMDE_FLOAT16_VALUE(    -9.14),
+        SIMDE_FLOAT16_VALUE(   -7.965), SIMDE_FLOAT16_VALUE(   -7.977), SIMDE_FLOAT16_VALUE(    8.766), SIMDE_FLOAT16_VALUE(   -7.906),
+        SIMDE_FLOAT16_VALUE(   -6.113), SIMDE_FLOAT16_VALUE(    -6.85), SIMDE_FLOAT16_VALUE(   0.8916), SIMDE_FLOAT16_VALUE(    3.395),
+        SIMDE_FLOAT16_VALUE(    -9.33), SIMDE_FLOAT16_VALUE(     8.74), SIMDE_FLOAT16_VALUE(   -2.182), SIMDE_FLOAT16_VALUE(   0.8955),
+        SIMDE_FLOAT16_VALUE(   -7.035), SIMDE_FLOAT16_VALUE(    6.668), SIMDE_FLOAT16_VALUE(    -9.57), SIMDE_FLOAT16_VALUE(   -9.375) },
+      { SIMDE_FLOAT16_VALUE(     -6.0), SIMDE_FLOAT16_VALUE(    2.242), SIMDE_FLOAT16_VALUE(   -6.688), SIMDE_FLOAT16_VALUE(     6.79),
+        SIMDE_FLOAT16_VALUE(    -9.82), SIMDE_FLOAT16_VALUE(   -7.684), SIMDE_FLOAT16_VALUE(    2.795), SIMDE_FLOAT16_VALUE(    2.154),
+        SIMDE_FLOAT16_VALUE(   -1.047), SIMDE_FLOAT16_VALUE(    6.074), SIMDE_FLOAT16_VALUE(    5.664), SIMDE_FLOAT16_VALUE(     9.88),
+        SIMDE_FLOAT16_VALUE(     8.77), SIMDE_FLOAT16_VALUE(  -0.6445), SIMDE_FLOAT16_VALUE(    5.848), SIMDE_FLOAT16_VALUE(    -8.22),
+        SIMDE_FLOAT16_VALUE(    6.465), SIMDE_FLOAT16_VALUE(     9.24), SIMDE_FLOAT16_VALUE(    2.195), SIMDE_FLOAT16_VALUE(    5.113),
+        SIMDE_FLOAT16_VALUE(    -9.17), SIMDE_FLOAT16_VALUE(   -1.284), SIMDE_FLOAT16_VALUE(  -0.7837), SIMDE_FLOAT16_VALUE(   -3.625),
+        SIMDE_FLOAT16_VALUE(   -2.953), SIMDE_FLOAT16_VALUE(   -3.004), SIMDE_FLOAT16_VALUE(    8.734), SIMDE_FLOAT16_VALUE(   0.2311),
+        SIMDE_FLOAT16_VALUE(    1.112), SIMDE_FLOAT16_VALUE(  -0.9023), SIMDE_FLOAT16_VALUE(   -8.086), SIMDE_FLOAT16_VALUE(    7.098) },
+      { SIMDE_FLOAT16_VALUE(    35.25), SIMDE_FLOAT16_VALUE(   -27.14), SIMDE_FLOAT16_VALUE(    59.22), SIMDE_FLOAT16_VALUE(    70.75),
+        SIMDE_FLOAT16_VALUE(   -91.25), SIMDE_FLOAT16_VALUE(    26.94), SIMDE_FLOAT16_VALUE(    -8.28), SIMDE_FLOAT16_VALUE(    29.52),
+        SIMDE_FLOAT16_VALUE(    15.73), SIMDE_FLOAT16_VALUE(   -16.98), SIMDE_FLOAT16_VALUE(    15.76), SIMDE_FLOAT16_VALUE(    -72.6),
+        SIMDE_FLOAT16_VALUE(   -19.84), SIMDE_FLOAT16_VALUE(    -79.6), SIMDE_FLOAT16_VALUE(     67.7), SIMDE_FLOAT16_VALUE(    -63.9),
+        SIMDE_FLOAT16_VALUE(   -125.2), SIMDE_FLOAT16_VALUE(    22.05), SIMDE_FLOAT16_VALUE(   -21.19), SIMDE_FLOAT16_VALUE(    -62.2),
+        SIMDE_FLOAT16_VALUE(     64.9), SIMDE_FLOAT16_VALUE(     55.0), SIMDE_FLOAT16_VALUE(   -13.01), SIMDE_FLOAT16_VALUE(    0.572),
+        SIMDE_FLOAT16_VALUE(    1.286), SIMDE_FLOAT16_VALUE(   -53.84), SIMDE_FLOAT16_VALUE(   -18.84), SIMDE_FLOAT16_VALUE(     8.33),
+        SIMDE_FLOAT16_VALUE(   -13.84), SIMDE_FLOAT16_VALUE(    1.068), SIMDE_FLOAT16_VALUE(    10.84), SIMDE_FLOAT16_VALUE(    143.8) } },
+    { { SIMDE_FLOAT16_VALUE(   -6.785), SIMDE_FLOAT16_VALUE(    1.919), SIMDE_FLOAT16_VALUE(    8.414), SIMDE_FLOAT16_VALUE(   -9.086),
+        SIMDE_FLOAT16_VALUE(    3.158), SIMDE_FLOAT16_VALUE(    -4.09), SIMDE_FLOAT16_VALUE(    -8.63), SIMDE_FLOAT16_VALUE(    1.747),
+        SIMDE_FLOAT16_VALUE(     3.17), SIMDE_FLOAT16_VALUE(    2.684), SIMDE_FLOAT16_VALUE(     9.06), SIMDE_FLOAT16_VALUE(    0.579),
+        SIMDE_FLOAT16_VALUE(     9.22), SIMDE_FLOAT16_VALUE(    1.719), SIMDE_FLOAT16_VALUE(     9.15), SIMDE_FLOAT16_VALUE(    -5.65),
+        SIMDE_FLOAT16_VALUE(   -9.164), SIMDE_FLOAT16_VALUE(    -6.15), SIMDE_FLOAT16_VALUE(    7.504), SIMDE_FLOAT16_VALUE(     8.72),
+        SIMDE_FLOAT16_VALUE(    6.574), SIMDE_FLOAT16_VALUE(    1.832), SIMDE_FLOAT16_VALUE(    1.279), SIMDE_FLOAT16_VALUE(    3.361),
+        SIMDE_FLOAT16_VALUE(   -5.914), SIMDE_FLOAT16_VALUE(    3.742), SIMDE_FLOAT16_VALUE(   -7.258), SIMDE_FLOAT16_VALUE(   0.4785),
+        SIMDE_FLOAT16_VALUE(    4.812), SIMDE_FLOAT16_VALUE(      9.8), SIMDE_FLOAT16_VALUE(    2.986), SIMDE_FLOAT16_VALUE(   -8.375) },
+      { SIMDE_FLOAT16_VALUE(   -1.754), SIMDE_FLOAT16_VALUE(    2.227), SIMDE_FLOAT16_VALUE(    -8.49), SIMDE_FLOAT16_VALUE(    5.902),
+        SIMDE_FLOAT16_VALUE(    1.335), SIMDE_FLOAT16_VALUE(   -4.996), SIMDE_FLOAT16_VALUE(    -5.56), SIMDE_FLOAT16_VALUE(    3.697),
+        SIMDE_FLOAT16_VALUE(     8.19), SIMDE_FLOAT16_VALUE(     8.22), SIMDE_FLOAT16_VALUE(   -4.305), SIMDE_FLOAT16_VALUE(     8.01),
+        SIMDE_FLOAT16_VALUE(   -7.004), SIMDE_FLOAT16_VALUE(  -0.5195), SIMDE_FLOAT16_VALUE(   -7.066), SIMDE_FLOAT16_VALUE(   -1.235),
+        SIMDE_FLOAT16_VALUE(   -3.293), SIMDE_FLOAT16_VALUE(    1.767), SIMDE_FLOAT16_VALUE(    2.936), SIMDE_FLOAT16_VALUE(    5.965),
+        SIMDE_FLOAT16_VALUE(   -8.695), SIMDE_FLOAT16_VALUE(    4.547), SIMDE_FLOAT16_VALUE(     7.48), SIMDE_FLOAT16_VALUE(   -8.164),
+        SIMDE_FLOAT16_VALUE(    -7.46), SIMDE_FLOAT16_VALUE(   -7.496), SIMDE_FLOAT16_VALUE(  -0.7793), SIMDE_FLOAT16_VALUE(  -0.6562),
+        SIMDE_FLOAT16_VALUE(    4.363), SIMDE_FLOAT16_VALUE(     4.19), SIMDE_FLOAT16_VALUE(     8.77), SIMDE_FLOAT16_VALUE(    7.082) },
+      { SIMDE_FLOAT16_VALUE(    16.17), SIMDE_FLOAT16_VALUE(    11.74), SIMDE_FLOAT16_VALUE(  -125.06), SIMDE_FLOAT16_VALUE(     27.5),
+        SIMDE_FLOAT16_VALUE(    24.66), SIMDE_FLOAT16_VALUE(    10.32), SIMDE_FLOAT16_VALUE(    54.44), SIMDE_FLOAT16_VALUE(     22.2),
+        SIMDE_FLOAT16_VALUE(     48.0), SIMDE_FLOAT16_VALUE(   -4.082), SIMDE_FLOAT16_VALUE(   -34.38), SIMDE_FLOAT16_VALUE(   -75.06),
+        SIMDE_FLOAT16_VALUE(   -65.44), SIMDE_FLOAT16_VALUE(    -7.25), SIMDE_FLOAT16_VALUE(   -57.66), SIMDE_FLOAT16_VALUE(    51.22),
+        SIMDE_FLOAT16_VALUE(    19.31), SIMDE_FLOAT16_VALUE(    36.44), SIMDE_FLOAT16_VALUE(    74.06), SIMDE_FLOAT16_VALUE(   -19.17),
+        SIMDE_FLOAT16_VALUE(   -48.84), SIMDE_FLOAT16_VALUE(    -45.8), SIMDE_FLOAT16_VALUE(   -17.88), SIMDE_FLOAT16_VALUE(     35.6),
+        SIMDE_FLOAT16_VALUE(    16.08), SIMDE_FLOAT16_VALUE(   -72.25), SIMDE_FLOAT16_VALUE(    5.344), SIMDE_FLOAT16_VALUE(   -5.137),
+        SIMDE_FLOAT16_VALUE(    62.06), SIMDE_FLOAT16_VALUE(    22.58), SIMDE_FLOAT16_VALUE(   -33.12), SIMDE_FLOAT16_VALUE(    -94.6) } },
+    { { SIMDE_FLOAT16_VALUE(  -0.3433), SIMDE_FLOAT16_VALUE(   -6.145), SIMDE_FLOAT16_VALUE(    8.836), SIMDE_FLOAT16_VALUE(    -7.42),
+        SIMDE_FLOAT16_VALUE(     8.27), SIMDE_FLOAT16_VALUE(    2.842), SIMDE_FLOAT16_VALUE(    -9.45), SIMDE_FLOAT16_VALUE(   -6.957),
+        SIMDE_FLOAT16_VALUE(    -2.31), SIMDE_FLOAT16_VALUE(   0.2605), SIMDE_FLOAT16_VALUE(   -2.865), SIMDE_FLOAT16_VALUE(    -7.32),
+        SIMDE_FLOAT16_VALUE(    5.617), SIMDE_FLOAT16_VALUE(   -2.387), SIMDE_FLOAT16_VALUE(    -5.41), SIMDE_FLOAT16_VALUE(    9.984),
+        SIMDE_FLOAT16_VALUE(   -6.832), SIMDE_FLOAT16_VALUE(    2.322), SIMDE_FLOAT16_VALUE(     4.68), SIMDE_FLOAT16_VALUE(    -8.66),
+        SIMDE_FLOAT16_VALUE(      8.7), SIMDE_FLOAT16_VALUE(    -8.26), SIMDE_FLOAT16_VALUE(   -6.383), SIMDE_FLOAT16_VALUE(    -6.57),
+        SIMDE_FLOAT16_VALUE(    5.668), SIMDE_FLOAT16_VALUE(   0.6675), SIMDE_FLOAT16_VALUE(  0.06366), SIMDE_FLOAT16_VALUE(    -7.42),
+        SIMDE_FLOAT16_VALUE(    3.473), SIMDE_FLOAT16_VALUE(    8.125), SIMDE_FLOAT16_VALUE(   -7.465), SIMDE_FLOAT16_VALUE(    5.094) },
+      { SIMDE_FLOAT16_VALUE(  -0.7456), SIMDE_FLOAT16_VALUE(  -0.5913), SIMDE_FLOAT16_VALUE(    5.066), SIMDE_FLOAT16_VALUE(     9.67),
+        SIMDE_FLOAT16_VALUE(    3.344), SIMDE_FLOAT16_VALUE(    2.848), SIMDE_FLOAT16_VALUE(    5.527), SIMDE_FLOAT16_VALUE(    6.812),
+        SIMDE_FLOAT16_VALUE(  -0.8037), SIMDE_FLOAT16_VALUE(    -3.34), SIMDE_FLOAT16_VALUE(    9.484), SIMDE_FLOAT16_VALUE(     9.75),
+        SIMDE_FLOAT16_VALUE(    5.414), SIMDE_FLOAT16_VALUE(   -1.512), SIMDE_FLOAT16_VALUE(  -0.8584), SIMDE_FLOAT16_VALUE(   -3.625),
+        SIMDE_FLOAT16_VALUE(    6.062), SIMDE_FLOAT16_VALUE(  -0.7817), SIMDE_FLOAT16_VALUE(    4.406), SIMDE_FLOAT16_VALUE(     4.76),
+        SIMDE_FLOAT16_VALUE(   -4.234), SIMDE_FLOAT16_VALUE(    1.411), SIMDE_FLOAT16_VALUE(   -3.492), SIMDE_FLOAT16_VALUE(    3.557),
+        SIMDE_FLOAT16_VALUE(    -8.51), SIMDE_FLOAT16_VALUE(  -0.7637), SIMDE_FLOAT16_VALUE(  -0.3735), SIMDE_FLOAT16_VALUE(     4.11),
+        SIMDE_FLOAT16_VALUE(    3.867), SIMDE_FLOAT16_VALUE(     7.33), SIMDE_FLOAT16_VALUE(   -9.445), SIMDE_FLOAT16_VALUE(    -7.98) },
+      { SIMDE_FLOAT16_VALUE(    3.889), SIMDE_FLOAT16_VALUE(     4.38), SIMDE_FLOAT16_VALUE(   -27.02), SIMDE_FLOAT16_VALUE(  -123.06),
+        SIMDE_FLOAT16_VALUE(    35.75), SIMDE_FLOAT16_VALUE(  -14.055), SIMDE_FLOAT16_VALUE(    -99.6), SIMDE_FLOAT16_VALUE(    25.95),
+        SIMDE_FLOAT16_VALUE(    0.987), SIMDE_FLOAT16_VALUE(   -7.926), SIMDE_FLOAT16_VALUE(   -98.56), SIMDE_FLOAT16_VALUE(    -41.5),
+        SIMDE_FLOAT16_VALUE(    34.03), SIMDE_FLOAT16_VALUE(    -4.43), SIMDE_FLOAT16_VALUE(   -31.55), SIMDE_FLOAT16_VALUE(   -28.19),
+        SIMDE_FLOAT16_VALUE(   -43.25), SIMDE_FLOAT16_VALUE(    8.734), SIMDE_FLOAT16_VALUE(    -20.6), SIMDE_FLOAT16_VALUE(   -60.44),
+        SIMDE_FLOAT16_VALUE(    -48.5), SIMDE_FLOAT16_VALUE(    22.69), SIMDE_FLOAT16_VALUE(   -1.078), SIMDE_FLOAT16_VALUE(    45.66),
+        SIMDE_FLOAT16_VALUE(   -48.72), SIMDE_FLOAT16_VALUE(   -1.351), SIMDE_FLOAT16_VALUE(   -30.52), SIMDE_FLOAT16_VALUE(     2.51),
+        SIMDE_FLOAT16_VALUE(     73.0), SIMDE_FLOAT16_VALUE(    5.973), SIMDE_FLOAT16_VALUE(    29.86), SIMDE_FLOAT16_VALUE(   -107.7) } },
+    { { SIMDE_FLOAT16_VALUE(   0.2295), SIMDE_FLOAT16_VALUE(    -4.83), SIMDE_FLOAT16_VALUE(    -5.18), SIMDE_FLOAT16_VALUE(     5.71),
+        SIMDE_FLOAT16_VALUE(   -4.785), SIMDE_FLOAT16_VALUE(    3.969), SIMDE_FLOAT16_VALUE(    5.715), SIMDE_FLOAT16_VALUE(   -1.934),
+        SIMDE_FLOAT16_VALUE(    1.431), SIMDE_FLOAT16_VALUE(    -4.55), SIMDE_FLOAT16_VALUE(      8.8), SIMDE_FLOAT16_VALUE(   -6.332),
+        SIMDE_FLOAT16_VALUE(     5.34), SIMDE_FLOAT16_VALUE(    -8.58), SIMDE_FLOAT16_VALUE(   -6.566), SIMDE_FLOAT16_VALUE(   -1.802),
+        SIMDE_FLOAT16_VALUE(   -9.664), SIMDE_FLOAT16_VALUE(     1.03), SIMDE_FLOAT16_VALUE(   -8.766), SIMDE_FLOAT16_VALUE(    3.822),
+        SIMDE_FLOAT16_VALUE(    -1.53), SIMDE_FLOAT16_VALUE(     7.15), SIMDE_FLOAT16_VALUE(    6.555), SIMDE_FLOAT16_VALUE(    -1.34),
+        SIMDE_FLOAT16_VALUE(   -7.723), SIMDE_FLOAT16_VALUE(   -2.451), SIMDE_FLOAT16_VALUE(     8.42), SIMDE_FLOAT16_VALUE(    3.807),
+        SIMDE_FLOAT16_VALUE(     6.78), SIMDE_FLOAT16_VALUE(     7.92), SIMDE_FLOAT16_VALUE(    8.016), SIMDE_FLOAT16_VALUE(     7.29) },
+      { SIMDE_FLOAT16_VALUE(     8.79), SIMDE_FLOAT16_VALUE(     4.49), SIMDE_FLOAT16_VALUE(     8.13), SIMDE_FLOAT16_VALUE(    4.742),
+        SIMDE_FLOAT16_VALUE(     7.09), SIMDE_FLOAT16_VALUE(   -1.805), SIMDE_FLOAT16_VALUE(    -6.88), SIMDE_FLOAT16_VALUE(   -1.947),
+        SIMDE_FLOAT16_VALUE(     9.16), SIMDE_FLOAT16_VALUE(      8.4), SIMDE_FLOAT16_VALUE(    5.363), SIMDE_FLOAT16_VALUE(    7.332),
+        SIMDE_FLOAT16_VALUE(    -3.31), SIMDE_FLOAT16_VALUE(    2.004), SIMDE_FLOAT16_VALUE(     7.91), SIMDE_FLOAT16_VALUE(   -3.246),
+        SIMDE_FLOAT16_VALUE(    -8.63), SIMDE_FLOAT16_VALUE(   0.4282), SIMDE_FLOAT16_VALUE(   -9.695), SIMDE_FLOAT16_VALUE(    7.203),
+        SIMDE_FLOAT16_VALUE(   -4.605), SIMDE_FLOAT16_VALUE(    3.375), SIMDE_FLOAT16_VALUE(    1.171), SIMDE_FLOAT16_VALUE(    -8.44),
+        SIMDE_FLOAT16_VALUE(   -4.812), SIMDE_FLOAT16_VALUE(    -9.76), SIMDE_FLOAT16_VALUE(    -3.63), SIMDE_FLOAT16_VALUE(    7.895),
+        SIMDE_FLOAT16_VALUE(   -1.599), SIMDE_FLOAT16_VALUE(   -1.461), SIMDE_FLOAT16_VALUE(     5.33), SIMDE_FLOAT16_VALUE(    -8.07) },
+      { SIMDE_FLOAT16_VALUE(   -19.66), SIMDE_FLOAT16_VALUE(   -43.47), SIMDE_FLOAT16_VALUE(   -15.05), SIMDE_FLOAT16_VALUE(     71.0),
+        SIMDE_FLOAT16_VALUE(    -41.1), SIMDE_FLOAT16_VALUE(     19.5), SIMDE_FLOAT16_VALUE(   -35.53), SIMDE_FLOAT16_VALUE(    24.42),
+        SIMDE_FLOAT16_VALUE(   -25.12), SIMDE_FLOAT16_VALUE(    -53.7), SIMDE_FLOAT16_VALUE(   0.7534), SIMDE_FLOAT16_VALUE(   -98.44),
+        SIMDE_FLOAT16_VALUE(   -34.88), SIMDE_FLOAT16_VALUE(     17.7), SIMDE_FLOAT16_VALUE(    -46.1), SIMDE_FLOAT16_VALUE(   -35.56),
+        SIMDE_FLOAT16_VALUE(     83.9), SIMDE_FLOAT16_VALUE(   -4.754), SIMDE_FLOAT16_VALUE(    112.5), SIMDE_FLOAT16_VALUE(    26.08),
+        SIMDE_FLOAT16_VALUE(    31.17), SIMDE_FLOAT16_VALUE(   -27.75), SIMDE_FLOAT16_VALUE(    18.98), SIMDE_FLOAT16_VALUE(    53.75),
+        SIMDE_FLOAT16_VALUE(     61.1), SIMDE_FLOAT16_VALUE(   -63.56), SIMDE_FLOAT16_VALUE(   -0.527), SIMDE_FLOAT16_VALUE(    -80.3),
+        SIMDE_FLOAT16_VALUE(   -22.42), SIMDE_FLOAT16_VALUE(   -2.758), SIMDE_FLOAT16_VALUE(   -16.11), SIMDE_FLOAT16_VALUE(    103.5) } },
+    { { SIMDE_FLOAT16_VALUE(    -3.59), SIMDE_FLOAT16_VALUE(    2.646), SIMDE_FLOAT16_VALUE(    4.633), SIMDE_FLOAT16_VALUE(    6.312),
+        SIMDE_FLOAT16_VALUE(     5.27), SIMDE_FLOAT16_VALUE(    1.395), SIMDE_FLOAT16_VALUE(     5.05), SIMDE_FLOAT16_VALUE(    -8.94),
+        SIMDE_FLOAT16_VALUE(    4.523), SIMDE_FLOAT16_VALUE(    1.257), SIMDE_FLOAT16_VALUE(    5.082), SIMDE_FLOAT16_VALUE(     6.94),
+        SIMDE_FLOAT16_VALUE(    3.334), SIMDE_FLOAT16_VALUE(     5.17), SIMDE_FLOAT16_VALUE(   0.4011), SIMDE_FLOAT16_VALUE(    -5.13),
+        SIMDE_FLOAT16_VALUE(    6.504), SIMDE_FLOAT16_VALUE(     2.98), SIMDE_FLOAT16_VALUE(    7.793), SIMDE_FLOAT16_VALUE(   -6.766),
+        SIMDE_FLOAT16_VALUE(    3.527), SIMDE_FLOAT16_VALUE(      6.3), SIMDE_FLOAT16_VALUE(    6.414), SIMDE_FLOAT16_VALUE(   -6.055),
+        SIMDE_FLOAT16_VALUE(   -2.016), SIMDE_FLOAT16_VALUE(   0.2627), SIMDE_FLOAT16_VALUE(    -6.33), SIMDE_FLOAT16_VALUE(     -5.6),
+        SIMDE_FLOAT16_VALUE(    5.996), SIMDE_FLOAT16_VALUE(     5.84), SIMDE_FLOAT16_VALUE(     7.43), SIMDE_FLOAT16_VALUE(     9.18) },
+      { SIMDE_FLOAT16_VALUE(    5.902), SIMDE_FLOAT16_VALUE(   -1.455), SIMDE_FLOAT16_VALUE(   -2.637), SIMDE_FLOAT16_VALUE(     6.21),
+        SIMDE_FLOAT16_VALUE(   0.4375), SIMDE_FLOAT16_VALUE(   -0.629), SIMDE_FLOAT16_VALUE(     3.46), SIMDE_FLOAT16_VALUE(    -9.55),
+        SIMDE_FLOAT16_VALUE(     1.43), SIMDE_FLOAT16_VALUE(   -4.094), SIMDE_FLOAT16_VALUE(   -6.508), SIMDE_FLOAT16_VALUE(     8.84),
+        SIMDE_FLOAT16_VALUE(     7.19), SIMDE_FLOAT16_VALUE(   -1.475), SIMDE_FLOAT16_VALUE(    6.277), SIMDE_FLOAT16_VALUE(   -5.613),
+        SIMDE_FLOAT16_VALUE(    -7.01), SIMDE_FLOAT16_VALUE(    -7.53), SIMDE_FLOAT16_VALUE(    1.477), SIMDE_FLOAT16_VALUE(     4.81),
+        SIMDE_FLOAT16_VALUE(    2.816), SIMDE_FLOAT16_VALUE(     4.28), SIMDE_FLOAT16_VALUE(    2.875), SIMDE_FLOAT16_VALUE(   -7.742),
+        SIMDE_FLOAT16_VALUE(    3.639), SIMDE_FLOAT16_VALUE(    4.984), SIMDE_FLOAT16_VALUE(   -1.869), SIMDE_FLOAT16_VALUE(    5.715),
+        SIMDE_FLOAT16_VALUE(    -3.91), SIMDE_FLOAT16_VALUE(   1.8955), SIMDE_FLOAT16_VALUE(    9.195), SIMDE_FLOAT16_VALUE(    4.895) },
+      { SIMDE_FLOAT16_VALUE(   -25.05), SIMDE_FLOAT16_VALUE(     10.4), SIMDE_FLOAT16_VALUE(    26.98), SIMDE_FLOAT16_VALUE(    -45.4),
+        SIMDE_FLOAT16_VALUE(    1.429), SIMDE_FLOAT16_VALUE(    3.924), SIMDE_FLOAT16_VALUE(    102.8), SIMDE_FLOAT16_VALUE(    17.28),
+        SIMDE_FLOAT16_VALUE(    1.322), SIMDE_FLOAT16_VALUE(    20.31), SIMDE_FLOAT16_VALUE(    28.31), SIMDE_FLOAT16_VALUE(    -90.1),
+        SIMDE_FLOAT16_VALUE(    16.34), SIMDE_FLOAT16_VALUE(    42.12), SIMDE_FLOAT16_VALUE(    31.31), SIMDE_FLOAT16_VALUE(   -29.94),
+        SIMDE_FLOAT16_VALUE(   -68.06), SIMDE_FLOAT16_VALUE(    28.08), SIMDE_FLOAT16_VALUE(   -21.03), SIMDE_FLOAT16_VALUE(   -47.47),
+        SIMDE_FLOAT16_VALUE(     36.9), SIMDE_FLOAT16_VALUE(    2.645), SIMDE_FLOAT16_VALUE(     65.3), SIMDE_FLOAT16_VALUE(    32.25),
+        SIMDE_FLOAT16_VALUE(   -6.023), SIMDE_FLOAT16_VALUE(     11.0), SIMDE_FLOAT16_VALUE(   -20.19), SIMDE_FLOAT16_VALUE(    46.62),
+        SIMDE_FLOAT16_VALUE(  -12.375), SIMDE_FLOAT16_VALUE(    -34.2), SIMDE_FLOAT16_VALUE(   113.25), SIMDE_FLOAT16_VALUE(    48.03) } },
+    { { SIMDE_FLOAT16_VALUE(   -3.645), SIMDE_FLOAT16_VALUE(    -4.39), SIMDE_FLOAT16_VALUE(     8.84), SIMDE_FLOAT16_VALUE(   -2.297),
+        SIMDE_FLOAT16_VALUE(    -9.96), SIMDE_FLOAT16_VALUE(     -9.9), SIMDE_FLOAT16_VALUE(    5.676), SIMDE_FLOAT16_VALUE(    9.805),
+        SIMDE_FLOAT16_VALUE(     -0.8), SIMDE_FLOAT16_VALUE(    1.904), SIMDE_FLOAT16_VALUE(    4.664), SIMDE_FLOAT16_VALUE(   -3.965),
+        SIMDE_FLOAT16_VALUE(     8.83), SIMDE_FLOAT16_VALUE(      6.8), SIMDE_FLOAT16_VALUE(    4.164), SIMDE_FLOAT16_VALUE(    4.598),
+        SIMDE_FLOAT16_VALUE(  -0.1323), SIMDE_FLOAT16_VALUE(   -1.704), SIMDE_FLOAT16_VALUE(     7.17), SIMDE_FLOAT16_VALUE(   0.8413),
+        SIMDE_FLOAT16_VALUE(   -1.831), SIMDE_FLOAT16_VALUE(    -8.18), SIMDE_FLOAT16_VALUE(    -9.28), SIMDE_FLOAT16_VALUE(   -3.168),
+        SIMDE_FLOAT16_VALUE(    -3.15), SIMDE_FLOAT16_VALUE(    7.277), SIMDE_FLOAT16_VALUE(   -4.793), SIMDE_FLOAT16_VALUE(   -7.395),
+        SIMDE_FLOAT16_VALUE(    -8.36), SIMDE_FLOAT16_VALUE(    -9.02), SIMDE_FLOAT16_VALUE(  -0.3398), SIMDE_FLOAT16_VALUE(   0.1975) },
+      { SIMDE_FLOAT16_VALUE(    1.193), SIMDE_FLOAT16_VALUE(   -1.908), SIMDE_FLOAT16_VALUE(   -5.215), SIMDE_FLOAT16_VALUE(     7.87),
+        SIMDE_FLOAT16_VALUE(    6.164), SIMDE_FLOAT16_VALUE(     8.44), SIMDE_FLOAT16_VALUE(   -1.424), SIMDE_FLOAT16_VALUE(    -7.35),
+        SIMDE_FLOAT16_VALUE(    2.205), SIMDE_FLOAT16_VALUE(    0.563), SIMDE_FLOAT16_VALUE(    -9.16), SIMDE_FLOAT16_VALUE(    8.266),
+        SIMDE_FLOAT16_VALUE(     8.47), SIMDE_FLOAT16_VALUE(     -1.4), SIMDE_FLOAT16_VALUE(   -3.623), SIMDE_FLOAT16_VALUE(    4.945),
+        SIMDE_FLOAT16_VALUE(    -5.49), SIMDE_FLOAT16_VALUE(   -2.012), SIMDE_FLOAT16_VALUE(   -6.387), SIMDE_FLOAT16_VALUE(    0.952),
+        SIMDE_FLOAT16_VALUE(    2.271), SIMDE_FLOAT16_VALUE(    6.004), SIMDE_FLOAT16_VALUE(    -3.29), SIMDE_FLOAT16_VALUE(   -6.492),
+        SIMDE_FLOAT16_VALUE(     7.25), SIMDE_FLOAT16_VALUE(    -6.14), SIMDE_FLOAT16_VALUE(  -0.9927), SIMDE_FLOAT16_VALUE(    4.566),
+        SIMDE_FLOAT16_VALUE(    -2.38), SIMDE_FLOAT16_VALUE(   -3.932), SIMDE_FLOAT16_VALUE(    -2.49), SIMDE_FLOAT16_VALUE(    3.496) },
+      { SIMDE_FLOAT16_VALUE(    4.027), SIMDE_FLOAT16_VALUE(  -12.195), SIMDE_FLOAT16_VALUE(    -64.2), SIMDE_FLOAT16_VALUE(   -57.62),
+        SIMDE_FLOAT16_VALUE(   -144.9), SIMDE_FLOAT16_VALUE(    23.03), SIMDE_FLOAT16_VALUE(    -80.2), SIMDE_FLOAT16_VALUE(    27.77),
+        SIMDE_FLOAT16_VALUE(  -0.6914), SIMDE_FLOAT16_VALUE(     4.65), SIMDE_FLOAT16_VALUE(    -75.5), SIMDE_FLOAT16_VALUE(   -2.248),
+        SIMDE_FLOAT16_VALUE(    65.25), SIMDE_FLOAT16_VALUE(    69.94), SIMDE_FLOAT16_VALUE(     7.65), SIMDE_FLOAT16_VALUE(   -37.25),
+        SIMDE_FLOAT16_VALUE(    4.156), SIMDE_FLOAT16_VALUE(    9.086), SIMDE_FLOAT16_VALUE(    -45.0), SIMDE_FLOAT16_VALUE(    -12.2),
+        SIMDE_FLOAT16_VALUE(   -53.28), SIMDE_FLOAT16_VALUE(   -7.586), SIMDE_FLOAT16_VALUE(     51.1), SIMDE_FLOAT16_VALUE(   -49.84),
+        SIMDE_FLOAT16_VALUE(    -67.5), SIMDE_FLOAT16_VALUE(     33.4), SIMDE_FLOAT16_VALUE(   -29.02), SIMDE_FLOAT16_VALUE(    29.23),
+        SIMDE_FLOAT16_VALUE(    55.38), SIMDE_FLOAT16_VALUE(   -11.38), SIMDE_FLOAT16_VALUE(    1.537), SIMDE_FLOAT16_VALUE(   0.6963) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512h a = simde_mm512_loadu_ph(test_vec[i].a);
+    simde__m512h b = simde_mm512_loadu_ph(test_vec[i].b);
+    simde__m512h r = simde_mm512_fcmul_pch(a, b);
+    simde_test_x86_assert_equal_f16x32(r, simde_mm512_loadu_ph(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  #if defined(SIMDE_FLOAT16_IS_SCALAR)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm_fmul_pch)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm256_fmul_pch)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm512_fmul_pch)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm_fcmul_pch)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm256_fcmul_pch)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm512_fcmul_pch)
+  #endif
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -581,11 +581,781 @@ test_simde_mm512_fmadd_pd (SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm_fmadd_ph (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float16 a[8];
+    const simde_float16 b[8];
+    const simde_float16 c[8];
+    const simde_float16 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(   -2.854), SIMDE_FLOAT16_VALUE(    3.596), SIMDE_FLOAT16_VALUE(    5.344), SIMDE_FLOAT16_VALUE(  -0.1261),
+        SIMDE_FLOAT16_VALUE(   -1.668), SIMDE_FLOAT16_VALUE(   -6.477), SIMDE_FLOAT16_VALUE(    -7.54), SIMDE_FLOAT16_VALUE(    -9.36) },
+      { SIMDE_FLOAT16_VALUE(   -1.212), SIMDE_FLOAT16_VALUE(   0.6724), SIMDE_FLOAT16_VALUE(   -4.383), SIMDE_FLOAT16_VALUE(    2.895),
+        SIMDE_FLOAT16_VALUE(   -3.215), SIMDE_FLOAT16_VALUE(   -4.617), SIMDE_FLOAT16_VALUE(     9.29), SIMDE_FLOAT16_VALUE(     9.56) },
+      { SIMDE_FLOAT16_VALUE(   -72.25), SIMDE_FLOAT16_VALUE(    11.97), SIMDE_FLOAT16_VALUE(     88.5), SIMDE_FLOAT16_VALUE(   -49.53),
+        SIMDE_FLOAT16_VALUE(    57.44), SIMDE_FLOAT16_VALUE(   -2.621), SIMDE_FLOAT16_VALUE(    54.84), SIMDE_FLOAT16_VALUE(    54.44) },
+      { SIMDE_FLOAT16_VALUE(    -68.8), SIMDE_FLOAT16_VALUE(    14.38), SIMDE_FLOAT16_VALUE(    65.06), SIMDE_FLOAT16_VALUE(    -49.9),
+        SIMDE_FLOAT16_VALUE(     62.8), SIMDE_FLOAT16_VALUE(    27.28), SIMDE_FLOAT16_VALUE(   -15.19), SIMDE_FLOAT16_VALUE(   -35.06) } },
+    { { SIMDE_FLOAT16_VALUE(   -7.195), SIMDE_FLOAT16_VALUE(    1.519), SIMDE_FLOAT16_VALUE(     9.44), SIMDE_FLOAT16_VALUE(   -2.535),
+        SIMDE_FLOAT16_VALUE(    -9.65), SIMDE_FLOAT16_VALUE(  -0.2522), SIMDE_FLOAT16_VALUE(   -3.965), SIMDE_FLOAT16_VALUE(    -4.23) },
+      { SIMDE_FLOAT16_VALUE(    7.953), SIMDE_FLOAT16_VALUE(      6.5), SIMDE_FLOAT16_VALUE(   -1.668), SIMDE_FLOAT16_VALUE(   -3.309),
+        SIMDE_FLOAT16_VALUE(  -0.6816), SIMDE_FLOAT16_VALUE(   -3.828), SIMDE_FLOAT16_VALUE(    9.016), SIMDE_FLOAT16_VALUE(   -1.268) },
+      { SIMDE_FLOAT16_VALUE(    -70.4), SIMDE_FLOAT16_VALUE(    45.12), SIMDE_FLOAT16_VALUE(    -96.6), SIMDE_FLOAT16_VALUE(    1.114),
+        SIMDE_FLOAT16_VALUE(    13.83), SIMDE_FLOAT16_VALUE(    -37.3), SIMDE_FLOAT16_VALUE(    26.31), SIMDE_FLOAT16_VALUE(   -36.22) },
+      { SIMDE_FLOAT16_VALUE(   -127.6), SIMDE_FLOAT16_VALUE(     55.0), SIMDE_FLOAT16_VALUE(   -112.4), SIMDE_FLOAT16_VALUE(      9.5),
+        SIMDE_FLOAT16_VALUE(     20.4), SIMDE_FLOAT16_VALUE(   -36.34), SIMDE_FLOAT16_VALUE(    -9.43), SIMDE_FLOAT16_VALUE(   -30.86) } },
+    { { SIMDE_FLOAT16_VALUE(   -8.945), SIMDE_FLOAT16_VALUE(      9.0), SIMDE_FLOAT16_VALUE(     3.27), SIMDE_FLOAT16_VALUE(     3.91),
+        SIMDE_FLOAT16_VALUE(    0.515), SIMDE_FLOAT16_VALUE(    3.896), SIMDE_FLOAT16_VALUE(    -9.96), SIMDE_FLOAT16_VALUE(    5.082) },
+      { SIMDE_FLOAT16_VALUE(    7.023), SIMDE_FLOAT16_VALUE(   0.3406), SIMDE_FLOAT16_VALUE(     4.48), SIMDE_FLOAT16_VALUE(    -0.53),
+        SIMDE_FLOAT16_VALUE(    -8.82), SIMDE_FLOAT16_VALUE(   -7.496), SIMDE_FLOAT16_VALUE(    4.477), SIMDE_FLOAT16_VALUE(  -0.9585) },
+      { SIMDE_FLOAT16_VALUE(   -35.25), SIMDE_FLOAT16_VALUE(    3.414), SIMDE_FLOAT16_VALUE(    -98.0), SIMDE_FLOAT16_VALUE(    61.56),
+        SIMDE_FLOAT16_VALUE(   13.664), SIMDE_FLOAT16_VALUE(    89.44), SIMDE_FLOAT16_VALUE(    96.25), SIMDE_FLOAT16_VALUE(    -70.4) },
+      { SIMDE_FLOAT16_VALUE(   -98.06), SIMDE_FLOAT16_VALUE(     6.48), SIMDE_FLOAT16_VALUE(    -83.4), SIMDE_FLOAT16_VALUE(     59.5),
+        SIMDE_FLOAT16_VALUE(     9.12), SIMDE_FLOAT16_VALUE(    60.22), SIMDE_FLOAT16_VALUE(    51.66), SIMDE_FLOAT16_VALUE(   -75.25) } },
+    { { SIMDE_FLOAT16_VALUE(   -1.169), SIMDE_FLOAT16_VALUE(    -6.39), SIMDE_FLOAT16_VALUE(   -1.298), SIMDE_FLOAT16_VALUE(    1.873),
+        SIMDE_FLOAT16_VALUE(    3.914), SIMDE_FLOAT16_VALUE(   -1.329), SIMDE_FLOAT16_VALUE(   0.9023), SIMDE_FLOAT16_VALUE(    -8.53) },
+      { SIMDE_FLOAT16_VALUE(   -1.073), SIMDE_FLOAT16_VALUE(    6.305), SIMDE_FLOAT16_VALUE(   -3.572), SIMDE_FLOAT16_VALUE(    2.945),
+        SIMDE_FLOAT16_VALUE(    1.095), SIMDE_FLOAT16_VALUE(     4.72), SIMDE_FLOAT16_VALUE(   0.3064), SIMDE_FLOAT16_VALUE(     9.66) },
+      { SIMDE_FLOAT16_VALUE(   0.4658), SIMDE_FLOAT16_VALUE(    17.11), SIMDE_FLOAT16_VALUE(     79.0), SIMDE_FLOAT16_VALUE(    -33.8),
+        SIMDE_FLOAT16_VALUE(    9.336), SIMDE_FLOAT16_VALUE(     55.0), SIMDE_FLOAT16_VALUE(   -94.56), SIMDE_FLOAT16_VALUE(    27.52) },
+      { SIMDE_FLOAT16_VALUE(    1.721), SIMDE_FLOAT16_VALUE(   -23.19), SIMDE_FLOAT16_VALUE(     83.6), SIMDE_FLOAT16_VALUE(    -28.3),
+        SIMDE_FLOAT16_VALUE(    13.62), SIMDE_FLOAT16_VALUE(    48.72), SIMDE_FLOAT16_VALUE(    -94.3), SIMDE_FLOAT16_VALUE(   -54.88) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128h a = simde_mm_loadu_ph(test_vec[i].a);
+    simde__m128h b = simde_mm_loadu_ph(test_vec[i].b);
+    simde__m128h c = simde_mm_loadu_ph(test_vec[i].c);
+    simde__m128h r = simde_mm_fmadd_ph(a, b, c);
+    simde_test_x86_assert_equal_f16x8(r, simde_mm_loadu_ph(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm256_fmadd_ph (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float16 a[16];
+    const simde_float16 b[16];
+    const simde_float16 c[16];
+    const simde_float16 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(    -1.36), SIMDE_FLOAT16_VALUE(    -8.89), SIMDE_FLOAT16_VALUE(   -3.197), SIMDE_FLOAT16_VALUE(    1.396),
+        SIMDE_FLOAT16_VALUE(   -2.545), SIMDE_FLOAT16_VALUE(    5.867), SIMDE_FLOAT16_VALUE(    -8.63), SIMDE_FLOAT16_VALUE(   -9.555),
+        SIMDE_FLOAT16_VALUE(      6.6), SIMDE_FLOAT16_VALUE(    3.102), SIMDE_FLOAT16_VALUE(   -0.725), SIMDE_FLOAT16_VALUE(   -4.742),
+        SIMDE_FLOAT16_VALUE(    0.606), SIMDE_FLOAT16_VALUE(    7.266), SIMDE_FLOAT16_VALUE(    -4.39), SIMDE_FLOAT16_VALUE(   -7.168) },
+      { SIMDE_FLOAT16_VALUE(     9.07), SIMDE_FLOAT16_VALUE(    3.537), SIMDE_FLOAT16_VALUE(    -5.66), SIMDE_FLOAT16_VALUE(    8.305),
+        SIMDE_FLOAT16_VALUE(   -1.463), SIMDE_FLOAT16_VALUE(    -9.64), SIMDE_FLOAT16_VALUE(     7.43), SIMDE_FLOAT16_VALUE(    4.727),
+        SIMDE_FLOAT16_VALUE(  -0.7095), SIMDE_FLOAT16_VALUE(    -9.54), SIMDE_FLOAT16_VALUE(     9.39), SIMDE_FLOAT16_VALUE(    6.723),
+        SIMDE_FLOAT16_VALUE(    -9.12), SIMDE_FLOAT16_VALUE(   -2.807), SIMDE_FLOAT16_VALUE(    3.025), SIMDE_FLOAT16_VALUE(     6.21) },
+      { SIMDE_FLOAT16_VALUE(     73.3), SIMDE_FLOAT16_VALUE(   -3.803), SIMDE_FLOAT16_VALUE(  -15.984), SIMDE_FLOAT16_VALUE(    90.44),
+        SIMDE_FLOAT16_VALUE(    65.44), SIMDE_FLOAT16_VALUE(     86.1), SIMDE_FLOAT16_VALUE(   -24.98), SIMDE_FLOAT16_VALUE(   -46.53),
+        SIMDE_FLOAT16_VALUE(    13.91), SIMDE_FLOAT16_VALUE(     65.1), SIMDE_FLOAT16_VALUE(    17.28), SIMDE_FLOAT16_VALUE(    23.89),
+        SIMDE_FLOAT16_VALUE(   -56.88), SIMDE_FLOAT16_VALUE(    -69.2), SIMDE_FLOAT16_VALUE(    -94.9), SIMDE_FLOAT16_VALUE(    20.83) },
+      { SIMDE_FLOAT16_VALUE(    60.97), SIMDE_FLOAT16_VALUE(   -35.25), SIMDE_FLOAT16_VALUE(    2.113), SIMDE_FLOAT16_VALUE(   102.06),
+        SIMDE_FLOAT16_VALUE(     69.2), SIMDE_FLOAT16_VALUE(    29.56), SIMDE_FLOAT16_VALUE(    -89.1), SIMDE_FLOAT16_VALUE(    -91.7),
+        SIMDE_FLOAT16_VALUE(     9.22), SIMDE_FLOAT16_VALUE(    35.53), SIMDE_FLOAT16_VALUE(    10.47), SIMDE_FLOAT16_VALUE(    -7.99),
+        SIMDE_FLOAT16_VALUE(    -62.4), SIMDE_FLOAT16_VALUE(   -89.56), SIMDE_FLOAT16_VALUE(   -108.2), SIMDE_FLOAT16_VALUE(   -23.69) } },
+    { { SIMDE_FLOAT16_VALUE(  -0.6475), SIMDE_FLOAT16_VALUE(    -9.72), SIMDE_FLOAT16_VALUE(   -3.324), SIMDE_FLOAT16_VALUE(   -2.176),
+        SIMDE_FLOAT16_VALUE(    3.436), SIMDE_FLOAT16_VALUE(    4.414), SIMDE_FLOAT16_VALUE(    3.627), SIMDE_FLOAT16_VALUE(    4.008),
+        SIMDE_FLOAT16_VALUE(   -8.875), SIMDE_FLOAT16_VALUE(     7.47), SIMDE_FLOAT16_VALUE(     6.38), SIMDE_FLOAT16_VALUE(    7.875),
+        SIMDE_FLOAT16_VALUE(   -3.037), SIMDE_FLOAT16_VALUE(   -7.566), SIMDE_FLOAT16_VALUE(    -9.34), SIMDE_FLOAT16_VALUE(    -8.71) },
+      { SIMDE_FLOAT16_VALUE(   0.5024), SIMDE_FLOAT16_VALUE(    9.016), SIMDE_FLOAT16_VALUE(   -1.348), SIMDE_FLOAT16_VALUE(    0.712),
+        SIMDE_FLOAT16_VALUE(   -3.668), SIMDE_FLOAT16_VALUE(    2.045), SIMDE_FLOAT16_VALUE(   -9.945), SIMDE_FLOAT16_VALUE(    5.773),
+        SIMDE_FLOAT16_VALUE(    2.732), SIMDE_FLOAT16_VALUE(   -6.727), SIMDE_FLOAT16_VALUE(    6.074), SIMDE_FLOAT16_VALUE(   -8.125),
+        SIMDE_FLOAT16_VALUE(    -6.07), SIMDE_FLOAT16_VALUE(    1.396), SIMDE_FLOAT16_VALUE(    6.598), SIMDE_FLOAT16_VALUE(     9.38) },
+      { SIMDE_FLOAT16_VALUE(    -2.13), SIMDE_FLOAT16_VALUE(    -35.7), SIMDE_FLOAT16_VALUE(   -65.25), SIMDE_FLOAT16_VALUE(    -72.8),
+        SIMDE_FLOAT16_VALUE(    -98.3), SIMDE_FLOAT16_VALUE(     44.2), SIMDE_FLOAT16_VALUE(    26.16), SIMDE_FLOAT16_VALUE(   -31.66),
+        SIMDE_FLOAT16_VALUE(    77.94), SIMDE_FLOAT16_VALUE(     8.08), SIMDE_FLOAT16_VALUE(    49.72), SIMDE_FLOAT16_VALUE(   -59.16),
+        SIMDE_FLOAT16_VALUE(     75.9), SIMDE_FLOAT16_VALUE(    37.94), SIMDE_FLOAT16_VALUE(   -84.94), SIMDE_FLOAT16_VALUE(    24.16) },
+      { SIMDE_FLOAT16_VALUE(   -2.457), SIMDE_FLOAT16_VALUE(   -123.3), SIMDE_FLOAT16_VALUE(   -60.78), SIMDE_FLOAT16_VALUE(    -74.4),
+        SIMDE_FLOAT16_VALUE(  -110.94), SIMDE_FLOAT16_VALUE(    53.22), SIMDE_FLOAT16_VALUE(   -9.914), SIMDE_FLOAT16_VALUE(   -8.516),
+        SIMDE_FLOAT16_VALUE(     53.7), SIMDE_FLOAT16_VALUE(   -42.16), SIMDE_FLOAT16_VALUE(    88.44), SIMDE_FLOAT16_VALUE(   -123.1),
+        SIMDE_FLOAT16_VALUE(     94.3), SIMDE_FLOAT16_VALUE(    27.38), SIMDE_FLOAT16_VALUE(   -146.6), SIMDE_FLOAT16_VALUE(   -57.56) } },
+    { { SIMDE_FLOAT16_VALUE(   -3.834), SIMDE_FLOAT16_VALUE(  -0.5947), SIMDE_FLOAT16_VALUE(    -7.37), SIMDE_FLOAT16_VALUE(    5.496),
+        SIMDE_FLOAT16_VALUE(    5.766), SIMDE_FLOAT16_VALUE(    -7.12), SIMDE_FLOAT16_VALUE(   -2.982), SIMDE_FLOAT16_VALUE(   -1.943),
+        SIMDE_FLOAT16_VALUE(    8.945), SIMDE_FLOAT16_VALUE(    1.305), SIMDE_FLOAT16_VALUE(    -5.81), SIMDE_FLOAT16_VALUE(    2.457),
+        SIMDE_FLOAT16_VALUE(   -2.443), SIMDE_FLOAT16_VALUE(    3.875), SIMDE_FLOAT16_VALUE(    1.386), SIMDE_FLOAT16_VALUE(    -8.24) },
+      { SIMDE_FLOAT16_VALUE(    -9.89), SIMDE_FLOAT16_VALUE(    0.596), SIMDE_FLOAT16_VALUE(     -3.2), SIMDE_FLOAT16_VALUE(     5.63),
+        SIMDE_FLOAT16_VALUE(   -1.454), SIMDE_FLOAT16_VALUE(     -9.7), SIMDE_FLOAT16_VALUE(   -1.479), SIMDE_FLOAT16_VALUE(    3.732),
+        SIMDE_FLOAT16_VALUE(    0.301), SIMDE_FLOAT16_VALUE(     5.53), SIMDE_FLOAT16_VALUE(    2.324), SIMDE_FLOAT16_VALUE(  -0.9995),
+        SIMDE_FLOAT16_VALUE(     4.79), SIMDE_FLOAT16_VALUE(     -2.7), SIMDE_FLOAT16_VALUE(     2.72), SIMDE_FLOAT16_VALUE(  -0.9097) },
+      { SIMDE_FLOAT16_VALUE(    -60.9), SIMDE_FLOAT16_VALUE(    -64.0), SIMDE_FLOAT16_VALUE(    -56.5), SIMDE_FLOAT16_VALUE(    28.25),
+        SIMDE_FLOAT16_VALUE(   -4.453), SIMDE_FLOAT16_VALUE(    -32.4), SIMDE_FLOAT16_VALUE(     7.26), SIMDE_FLOAT16_VALUE(    -68.9),
+        SIMDE_FLOAT16_VALUE(    -73.8), SIMDE_FLOAT16_VALUE(    -56.3), SIMDE_FLOAT16_VALUE(    58.28), SIMDE_FLOAT16_VALUE(    81.06),
+        SIMDE_FLOAT16_VALUE(    9.766), SIMDE_FLOAT16_VALUE(   -33.38), SIMDE_FLOAT16_VALUE(    37.97), SIMDE_FLOAT16_VALUE(   -73.75) },
+      { SIMDE_FLOAT16_VALUE(   -22.98), SIMDE_FLOAT16_VALUE(    -64.4), SIMDE_FLOAT16_VALUE(    -32.9), SIMDE_FLOAT16_VALUE(     59.2),
+        SIMDE_FLOAT16_VALUE(  -12.836), SIMDE_FLOAT16_VALUE(     36.7), SIMDE_FLOAT16_VALUE(    11.67), SIMDE_FLOAT16_VALUE(    -76.1),
+        SIMDE_FLOAT16_VALUE(    -71.1), SIMDE_FLOAT16_VALUE(    -49.1), SIMDE_FLOAT16_VALUE(    44.78), SIMDE_FLOAT16_VALUE(     78.6),
+        SIMDE_FLOAT16_VALUE(   -1.936), SIMDE_FLOAT16_VALUE(   -43.84), SIMDE_FLOAT16_VALUE(    41.75), SIMDE_FLOAT16_VALUE(   -66.25) } },
+    { { SIMDE_FLOAT16_VALUE(    2.648), SIMDE_FLOAT16_VALUE(    6.754), SIMDE_FLOAT16_VALUE(    6.492), SIMDE_FLOAT16_VALUE(   -6.652),
+        SIMDE_FLOAT16_VALUE(   -4.027), SIMDE_FLOAT16_VALUE(    3.885), SIMDE_FLOAT16_VALUE(    5.867), SIMDE_FLOAT16_VALUE(   -7.797),
+        SIMDE_FLOAT16_VALUE(   -5.566), SIMDE_FLOAT16_VALUE(     4.17), SIMDE_FLOAT16_VALUE(   -4.555), SIMDE_FLOAT16_VALUE(   -5.035),
+        SIMDE_FLOAT16_VALUE(   -7.867), SIMDE_FLOAT16_VALUE(    -4.36), SIMDE_FLOAT16_VALUE(    7.633), SIMDE_FLOAT16_VALUE(     6.33) },
+      { SIMDE_FLOAT16_VALUE(   0.8887), SIMDE_FLOAT16_VALUE(   -4.312), SIMDE_FLOAT16_VALUE(     5.12), SIMDE_FLOAT16_VALUE(     -9.0),
+        SIMDE_FLOAT16_VALUE(   -1.827), SIMDE_FLOAT16_VALUE(    2.516), SIMDE_FLOAT16_VALUE(    2.498), SIMDE_FLOAT16_VALUE(    5.902),
+        SIMDE_FLOAT16_VALUE(    2.787), SIMDE_FLOAT16_VALUE(   -4.438), SIMDE_FLOAT16_VALUE(   -8.336), SIMDE_FLOAT16_VALUE(   -3.256),
+        SIMDE_FLOAT16_VALUE(      7.9), SIMDE_FLOAT16_VALUE(    2.139), SIMDE_FLOAT16_VALUE(  -0.1323), SIMDE_FLOAT16_VALUE(    4.047) },
+      { SIMDE_FLOAT16_VALUE(    39.12), SIMDE_FLOAT16_VALUE(    55.53), SIMDE_FLOAT16_VALUE(    54.88), SIMDE_FLOAT16_VALUE(    73.75),
+        SIMDE_FLOAT16_VALUE(     6.72), SIMDE_FLOAT16_VALUE(    -86.9), SIMDE_FLOAT16_VALUE(    29.25), SIMDE_FLOAT16_VALUE(    40.44),
+        SIMDE_FLOAT16_VALUE(     89.5), SIMDE_FLOAT16_VALUE(    95.75), SIMDE_FLOAT16_VALUE(   -39.34), SIMDE_FLOAT16_VALUE(     84.4),
+        SIMDE_FLOAT16_VALUE(    30.67), SIMDE_FLOAT16_VALUE(    -98.4), SIMDE_FLOAT16_VALUE(    -69.2), SIMDE_FLOAT16_VALUE(    29.95) },
+      { SIMDE_FLOAT16_VALUE(    41.47), SIMDE_FLOAT16_VALUE(     26.4), SIMDE_FLOAT16_VALUE(     88.1), SIMDE_FLOAT16_VALUE(    133.6),
+        SIMDE_FLOAT16_VALUE(    14.08), SIMDE_FLOAT16_VALUE(    -77.1), SIMDE_FLOAT16_VALUE(     43.9), SIMDE_FLOAT16_VALUE(   -5.582),
+        SIMDE_FLOAT16_VALUE(     74.0), SIMDE_FLOAT16_VALUE(    77.25), SIMDE_FLOAT16_VALUE(   -1.376), SIMDE_FLOAT16_VALUE(   100.75),
+        SIMDE_FLOAT16_VALUE(   -31.47), SIMDE_FLOAT16_VALUE(   -107.7), SIMDE_FLOAT16_VALUE(    -70.2), SIMDE_FLOAT16_VALUE(    55.56) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256h a = simde_mm256_loadu_ph(test_vec[i].a);
+    simde__m256h b = simde_mm256_loadu_ph(test_vec[i].b);
+    simde__m256h c = simde_mm256_loadu_ph(test_vec[i].c);
+    simde__m256h r = simde_mm256_fmadd_ph(a, b, c);
+    simde_test_x86_assert_equal_f16x16(r, simde_mm256_loadu_ph(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm512_fmadd_ph (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float16 a[32];
+    const simde_float16 b[32];
+    const simde_float16 c[32];
+    const simde_float16 r[32];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(  -0.5483), SIMDE_FLOAT16_VALUE(    1.694), SIMDE_FLOAT16_VALUE(   -1.897), SIMDE_FLOAT16_VALUE(     9.65),
+        SIMDE_FLOAT16_VALUE(    6.445), SIMDE_FLOAT16_VALUE(     4.67), SIMDE_FLOAT16_VALUE(    3.934), SIMDE_FLOAT16_VALUE(   -4.293),
+        SIMDE_FLOAT16_VALUE(    2.277), SIMDE_FLOAT16_VALUE(    1.057), SIMDE_FLOAT16_VALUE(   -5.812), SIMDE_FLOAT16_VALUE(   -3.016),
+        SIMDE_FLOAT16_VALUE(    6.297), SIMDE_FLOAT16_VALUE(   -6.953), SIMDE_FLOAT16_VALUE(     -8.3), SIMDE_FLOAT16_VALUE(    7.926),
+        SIMDE_FLOAT16_VALUE(    4.445), SIMDE_FLOAT16_VALUE(   -1.691), SIMDE_FLOAT16_VALUE(    -7.02), SIMDE_FLOAT16_VALUE(   -2.674),
+        SIMDE_FLOAT16_VALUE(     -5.8), SIMDE_FLOAT16_VALUE(    -5.67), SIMDE_FLOAT16_VALUE(   -2.195), SIMDE_FLOAT16_VALUE(     1.25),
+        SIMDE_FLOAT16_VALUE(     8.39), SIMDE_FLOAT16_VALUE(    -8.54), SIMDE_FLOAT16_VALUE(   -2.377), SIMDE_FLOAT16_VALUE(   -4.812),
+        SIMDE_FLOAT16_VALUE(     9.96), SIMDE_FLOAT16_VALUE(   -4.906), SIMDE_FLOAT16_VALUE(    4.535), SIMDE_FLOAT16_VALUE(   -3.576) },
+      { SIMDE_FLOAT16_VALUE(   -5.844), SIMDE_FLOAT16_VALUE(    -2.24), SIMDE_FLOAT16_VALUE(     5.47), SIMDE_FLOAT16_VALUE(     -9.1),
+        SIMDE_FLOAT16_VALUE(    5.664), SIMDE_FLOAT16_VALUE(    5.902), SIMDE_FLOAT16_VALUE(    3.291), SIMDE_FLOAT16_VALUE(    3.191),
+        SIMDE_FLOAT16_VALUE(    1.369), SIMDE_FLOAT16_VALUE(   -9.164), SIMDE_FLOAT16_VALUE(    -2.01), SIMDE_FLOAT16_VALUE(     1.63),
+        SIMDE_FLOAT16_VALUE(     9.76), SIMDE_FLOAT16_VALUE(   -4.473), SIMDE_FLOAT16_VALUE(     7.91), SIMDE_FLOAT16_VALUE(   -3.541),
+        SIMDE_FLOAT16_VALUE(   0.6177), SIMDE_FLOAT16_VALUE(    2.193), SIMDE_FLOAT16_VALUE(   -6.594), SIMDE_FLOAT16_VALUE(    7.566),
+        SIMDE_FLOAT16_VALUE(     8.57), SIMDE_FLOAT16_VALUE(   0.4902), SIMDE_FLOAT16_VALUE(    0.258), SIMDE_FLOAT16_VALUE(    -8.26),
+        SIMDE_FLOAT16_VALUE(    1.506), SIMDE_FLOAT16_VALUE(    -8.51), SIMDE_FLOAT16_VALUE(   -2.215), SIMDE_FLOAT16_VALUE(   -4.473),
+        SIMDE_FLOAT16_VALUE(    1.721), SIMDE_FLOAT16_VALUE(   -4.887), SIMDE_FLOAT16_VALUE(     4.91), SIMDE_FLOAT16_VALUE(    -1.56) },
+      { SIMDE_FLOAT16_VALUE(     97.4), SIMDE_FLOAT16_VALUE(    4.566), SIMDE_FLOAT16_VALUE(   -57.28), SIMDE_FLOAT16_VALUE(   -63.75),
+        SIMDE_FLOAT16_VALUE(    -19.1), SIMDE_FLOAT16_VALUE(    78.06), SIMDE_FLOAT16_VALUE(     8.18), SIMDE_FLOAT16_VALUE(   -93.44),
+        SIMDE_FLOAT16_VALUE(    20.72), SIMDE_FLOAT16_VALUE(    21.73), SIMDE_FLOAT16_VALUE(    -49.0), SIMDE_FLOAT16_VALUE(     6.96),
+        SIMDE_FLOAT16_VALUE(    27.33), SIMDE_FLOAT16_VALUE(    32.44), SIMDE_FLOAT16_VALUE(    -26.4), SIMDE_FLOAT16_VALUE(   -20.95),
+        SIMDE_FLOAT16_VALUE(    65.25), SIMDE_FLOAT16_VALUE(   -60.47), SIMDE_FLOAT16_VALUE(    22.53), SIMDE_FLOAT16_VALUE(   0.8574),
+        SIMDE_FLOAT16_VALUE(    49.75), SIMDE_FLOAT16_VALUE(    -61.9), SIMDE_FLOAT16_VALUE(    61.94), SIMDE_FLOAT16_VALUE(    0.297),
+        SIMDE_FLOAT16_VALUE(   -58.38), SIMDE_FLOAT16_VALUE(    56.97), SIMDE_FLOAT16_VALUE(   -13.41), SIMDE_FLOAT16_VALUE(     64.6),
+        SIMDE_FLOAT16_VALUE(    31.66), SIMDE_FLOAT16_VALUE(    31.42), SIMDE_FLOAT16_VALUE(   -20.14), SIMDE_FLOAT16_VALUE(     64.1) },
+      { SIMDE_FLOAT16_VALUE(   100.56), SIMDE_FLOAT16_VALUE(   0.7705), SIMDE_FLOAT16_VALUE(    -67.7), SIMDE_FLOAT16_VALUE(   -151.6),
+        SIMDE_FLOAT16_VALUE(     17.4), SIMDE_FLOAT16_VALUE(    105.6), SIMDE_FLOAT16_VALUE(    21.12), SIMDE_FLOAT16_VALUE(   -107.1),
+        SIMDE_FLOAT16_VALUE(    23.84), SIMDE_FLOAT16_VALUE(   12.055), SIMDE_FLOAT16_VALUE(    -37.3), SIMDE_FLOAT16_VALUE(    2.045),
+        SIMDE_FLOAT16_VALUE(    88.75), SIMDE_FLOAT16_VALUE(    63.53), SIMDE_FLOAT16_VALUE(   -92.06), SIMDE_FLOAT16_VALUE(   -49.03),
+        SIMDE_FLOAT16_VALUE(     68.0), SIMDE_FLOAT16_VALUE(    -64.2), SIMDE_FLOAT16_VALUE(     68.8), SIMDE_FLOAT16_VALUE(   -19.38),
+        SIMDE_FLOAT16_VALUE(   0.0355), SIMDE_FLOAT16_VALUE(    -64.7), SIMDE_FLOAT16_VALUE(    61.38), SIMDE_FLOAT16_VALUE(   -10.02),
+        SIMDE_FLOAT16_VALUE(   -45.75), SIMDE_FLOAT16_VALUE(    129.6), SIMDE_FLOAT16_VALUE(    -8.14), SIMDE_FLOAT16_VALUE(     86.1),
+        SIMDE_FLOAT16_VALUE(    48.78), SIMDE_FLOAT16_VALUE(     55.4), SIMDE_FLOAT16_VALUE(    2.127), SIMDE_FLOAT16_VALUE(     69.7) } },
+    { { SIMDE_FLOAT16_VALUE(     8.23), SIMDE_FLOAT16_VALUE(    8.805), SIMDE_FLOAT16_VALUE(    -3.34), SIMDE_FLOAT16_VALUE(   -2.021),
+        SIMDE_FLOAT16_VALUE(    2.557), SIMDE_FLOAT16_VALUE(   -3.215), SIMDE_FLOAT16_VALUE(      4.0), SIMDE_FLOAT16_VALUE(   -3.096),
+        SIMDE_FLOAT16_VALUE(    5.332), SIMDE_FLOAT16_VALUE(    4.734), SIMDE_FLOAT16_VALUE(     8.51), SIMDE_FLOAT16_VALUE(   -3.082),
+        SIMDE_FLOAT16_VALUE(     4.34), SIMDE_FLOAT16_VALUE(    2.473), SIMDE_FLOAT16_VALUE(      8.1), SIMDE_FLOAT16_VALUE(   -5.504),
+        SIMDE_FLOAT16_VALUE(   -4.465), SIMDE_FLOAT16_VALUE(     4.14), SIMDE_FLOAT16_VALUE(   -6.773), SIMDE_FLOAT16_VALUE(   -1.342),
+        SIMDE_FLOAT16_VALUE(    5.984), SIMDE_FLOAT16_VALUE(     4.37), SIMDE_FLOAT16_VALUE(   -6.453), SIMDE_FLOAT16_VALUE(    -7.08),
+        SIMDE_FLOAT16_VALUE(    -7.32), SIMDE_FLOAT16_VALUE(    4.266), SIMDE_FLOAT16_VALUE(    5.926), SIMDE_FLOAT16_VALUE(  -0.5195),
+        SIMDE_FLOAT16_VALUE(    1.044), SIMDE_FLOAT16_VALUE(     5.19), SIMDE_FLOAT16_VALUE(    6.457), SIMDE_FLOAT16_VALUE(    -3.84) },
+      { SIMDE_FLOAT16_VALUE(    8.805), SIMDE_FLOAT16_VALUE(   -5.305), SIMDE_FLOAT16_VALUE(    5.516), SIMDE_FLOAT16_VALUE(     6.78),
+        SIMDE_FLOAT16_VALUE(   -3.785), SIMDE_FLOAT16_VALUE(    7.324), SIMDE_FLOAT16_VALUE(     8.35), SIMDE_FLOAT16_VALUE(    -5.35),
+        SIMDE_FLOAT16_VALUE(    2.016), SIMDE_FLOAT16_VALUE(    7.605), SIMDE_FLOAT16_VALUE(    -9.45), SIMDE_FLOAT16_VALUE(    6.473),
+        SIMDE_FLOAT16_VALUE(   -5.117), SIMDE_FLOAT16_VALUE(   -3.795), SIMDE_FLOAT16_VALUE(   -1.344), SIMDE_FLOAT16_VALUE(    3.148),
+        SIMDE_FLOAT16_VALUE(     7.33), SIMDE_FLOAT16_VALUE(    3.863), SIMDE_FLOAT16_VALUE(   -7.133), SIMDE_FLOAT16_VALUE(   -3.408),
+        SIMDE_FLOAT16_VALUE(  -0.9995), SIMDE_FLOAT16_VALUE(     5.45), SIMDE_FLOAT16_VALUE(     9.81), SIMDE_FLOAT16_VALUE(    -9.93),
+        SIMDE_FLOAT16_VALUE(   -7.953), SIMDE_FLOAT16_VALUE(    1.784), SIMDE_FLOAT16_VALUE(   -3.049), SIMDE_FLOAT16_VALUE(    -2.95),
+        SIMDE_FLOAT16_VALUE(   -6.164), SIMDE_FLOAT16_VALUE(     8.76), SIMDE_FLOAT16_VALUE(     7.37), SIMDE_FLOAT16_VALUE(   -2.816) },
+      { SIMDE_FLOAT16_VALUE(    20.69), SIMDE_FLOAT16_VALUE(    58.97), SIMDE_FLOAT16_VALUE(   -6.848), SIMDE_FLOAT16_VALUE(     -9.5),
+        SIMDE_FLOAT16_VALUE(     96.2), SIMDE_FLOAT16_VALUE(    51.75), SIMDE_FLOAT16_VALUE(    37.25), SIMDE_FLOAT16_VALUE(     68.1),
+        SIMDE_FLOAT16_VALUE(     71.0), SIMDE_FLOAT16_VALUE(   0.4805), SIMDE_FLOAT16_VALUE(    30.55), SIMDE_FLOAT16_VALUE(   -94.56),
+        SIMDE_FLOAT16_VALUE(    45.22), SIMDE_FLOAT16_VALUE(    28.83), SIMDE_FLOAT16_VALUE(    -98.4), SIMDE_FLOAT16_VALUE(    -72.2),
+        SIMDE_FLOAT16_VALUE(    46.16), SIMDE_FLOAT16_VALUE(   -43.03), SIMDE_FLOAT16_VALUE(    26.44), SIMDE_FLOAT16_VALUE(   -68.44),
+        SIMDE_FLOAT16_VALUE(    88.56), SIMDE_FLOAT16_VALUE(    99.94), SIMDE_FLOAT16_VALUE(    -86.2), SIMDE_FLOAT16_VALUE(   -29.69),
+        SIMDE_FLOAT16_VALUE(    5.793), SIMDE_FLOAT16_VALUE(   0.9707), SIMDE_FLOAT16_VALUE(   -26.66), SIMDE_FLOAT16_VALUE(     6.54),
+        SIMDE_FLOAT16_VALUE(    54.84), SIMDE_FLOAT16_VALUE(     96.9), SIMDE_FLOAT16_VALUE(    -83.3), SIMDE_FLOAT16_VALUE(     95.2) },
+      { SIMDE_FLOAT16_VALUE(     93.1), SIMDE_FLOAT16_VALUE(   12.266), SIMDE_FLOAT16_VALUE(   -25.27), SIMDE_FLOAT16_VALUE(    -23.2),
+        SIMDE_FLOAT16_VALUE(     86.5), SIMDE_FLOAT16_VALUE(     28.2), SIMDE_FLOAT16_VALUE(     70.6), SIMDE_FLOAT16_VALUE(     84.7),
+        SIMDE_FLOAT16_VALUE(    81.75), SIMDE_FLOAT16_VALUE(     36.5), SIMDE_FLOAT16_VALUE(   -49.88), SIMDE_FLOAT16_VALUE(   -114.5),
+        SIMDE_FLOAT16_VALUE(    23.02), SIMDE_FLOAT16_VALUE(    19.44), SIMDE_FLOAT16_VALUE(  -109.25), SIMDE_FLOAT16_VALUE(    -89.5),
+        SIMDE_FLOAT16_VALUE(    13.44), SIMDE_FLOAT16_VALUE(   -27.03), SIMDE_FLOAT16_VALUE(    74.75), SIMDE_FLOAT16_VALUE(   -63.88),
+        SIMDE_FLOAT16_VALUE(    82.56), SIMDE_FLOAT16_VALUE(   123.75), SIMDE_FLOAT16_VALUE(   -149.5), SIMDE_FLOAT16_VALUE(     40.6),
+        SIMDE_FLOAT16_VALUE(     64.0), SIMDE_FLOAT16_VALUE(     8.58), SIMDE_FLOAT16_VALUE(   -44.72), SIMDE_FLOAT16_VALUE(     8.07),
+        SIMDE_FLOAT16_VALUE(     48.4), SIMDE_FLOAT16_VALUE(    142.4), SIMDE_FLOAT16_VALUE(   -35.72), SIMDE_FLOAT16_VALUE(    106.0) } },
+    { { SIMDE_FLOAT16_VALUE(    7.797), SIMDE_FLOAT16_VALUE(    5.664), SIMDE_FLOAT16_VALUE(   -7.926), SIMDE_FLOAT16_VALUE(   -6.285),
+        SIMDE_FLOAT16_VALUE(   -0.563), SIMDE_FLOAT16_VALUE(    3.674), SIMDE_FLOAT16_VALUE(   -0.694), SIMDE_FLOAT16_VALUE(   -2.693),
+        SIMDE_FLOAT16_VALUE(    3.592), SIMDE_FLOAT16_VALUE(     2.13), SIMDE_FLOAT16_VALUE(   -3.105), SIMDE_FLOAT16_VALUE(    6.027),
+        SIMDE_FLOAT16_VALUE(   -2.295), SIMDE_FLOAT16_VALUE(   -3.273), SIMDE_FLOAT16_VALUE(    6.594), SIMDE_FLOAT16_VALUE(    2.443),
+        SIMDE_FLOAT16_VALUE(     9.64), SIMDE_FLOAT16_VALUE(    -6.85), SIMDE_FLOAT16_VALUE(    2.227), SIMDE_FLOAT16_VALUE(     3.92),
+        SIMDE_FLOAT16_VALUE(    -5.11), SIMDE_FLOAT16_VALUE(    -2.05), SIMDE_FLOAT16_VALUE(    1.968), SIMDE_FLOAT16_VALUE(   -4.816),
+        SIMDE_FLOAT16_VALUE(   -9.664), SIMDE_FLOAT16_VALUE(    -7.42), SIMDE_FLOAT16_VALUE(     7.96), SIMDE_FLOAT16_VALUE(    4.645),
+        SIMDE_FLOAT16_VALUE(    3.201), SIMDE_FLOAT16_VALUE(   -5.934), SIMDE_FLOAT16_VALUE(    -4.09), SIMDE_FLOAT16_VALUE(  -0.1444) },
+      { SIMDE_FLOAT16_VALUE(   -2.104), SIMDE_FLOAT16_VALUE(    4.195), SIMDE_FLOAT16_VALUE(    -4.75), SIMDE_FLOAT16_VALUE(   -1.768),
+        SIMDE_FLOAT16_VALUE(     3.25), SIMDE_FLOAT16_VALUE(   -9.055), SIMDE_FLOAT16_VALUE(   0.8066), SIMDE_FLOAT16_VALUE(    3.223),
+        SIMDE_FLOAT16_VALUE(    2.139), SIMDE_FLOAT16_VALUE(   -5.523), SIMDE_FLOAT16_VALUE(    -8.42), SIMDE_FLOAT16_VALUE(     8.29),
+        SIMDE_FLOAT16_VALUE(     8.13), SIMDE_FLOAT16_VALUE(   -2.566), SIMDE_FLOAT16_VALUE(     4.34), SIMDE_FLOAT16_VALUE(    1.025),
+        SIMDE_FLOAT16_VALUE(   -9.016), SIMDE_FLOAT16_VALUE(   -4.953), SIMDE_FLOAT16_VALUE(   -2.602), SIMDE_FLOAT16_VALUE(    4.098),
+        SIMDE_FLOAT16_VALUE(    7.816), SIMDE_FLOAT16_VALUE(     3.06), SIMDE_FLOAT16_VALUE(   -7.863), SIMDE_FLOAT16_VALUE(   -5.332),
+        SIMDE_FLOAT16_VALUE(    -8.69), SIMDE_FLOAT16_VALUE(   -6.793), SIMDE_FLOAT16_VALUE(   -0.534), SIMDE_FLOAT16_VALUE(    -8.92),
+        SIMDE_FLOAT16_VALUE(   -7.645), SIMDE_FLOAT16_VALUE(   -6.016), SIMDE_FLOAT16_VALUE(    -6.82), SIMDE_FLOAT16_VALUE(    2.627) },
+      { SIMDE_FLOAT16_VALUE(    33.97), SIMDE_FLOAT16_VALUE(     33.0), SIMDE_FLOAT16_VALUE(     46.3), SIMDE_FLOAT16_VALUE(   -48.22),
+        SIMDE_FLOAT16_VALUE(   -8.336), SIMDE_FLOAT16_VALUE(     98.0), SIMDE_FLOAT16_VALUE(   -53.62), SIMDE_FLOAT16_VALUE(     41.9),
+        SIMDE_FLOAT16_VALUE(    29.83), SIMDE_FLOAT16_VALUE(     7.29), SIMDE_FLOAT16_VALUE(   -54.56), SIMDE_FLOAT16_VALUE(   -33.38),
+        SIMDE_FLOAT16_VALUE(    14.43), SIMDE_FLOAT16_VALUE(   -35.94), SIMDE_FLOAT16_VALUE(   -43.16), SIMDE_FLOAT16_VALUE(    34.38),
+        SIMDE_FLOAT16_VALUE(    40.16), SIMDE_FLOAT16_VALUE(    11.86), SIMDE_FLOAT16_VALUE(    60.97), SIMDE_FLOAT16_VALUE(   -60.88),
+        SIMDE_FLOAT16_VALUE(   -15.92), SIMDE_FLOAT16_VALUE(     90.7), SIMDE_FLOAT16_VALUE(   -22.48), SIMDE_FLOAT16_VALUE(    48.38),
+        SIMDE_FLOAT16_VALUE(     82.7), SIMDE_FLOAT16_VALUE(     37.3), SIMDE_FLOAT16_VALUE(   -1.386), SIMDE_FLOAT16_VALUE(   -83.44),
+        SIMDE_FLOAT16_VALUE(    14.31), SIMDE_FLOAT16_VALUE(    23.67), SIMDE_FLOAT16_VALUE(   -80.94), SIMDE_FLOAT16_VALUE(    73.44) },
+      { SIMDE_FLOAT16_VALUE(    17.56), SIMDE_FLOAT16_VALUE(    56.75), SIMDE_FLOAT16_VALUE(    83.94), SIMDE_FLOAT16_VALUE(    -37.1),
+        SIMDE_FLOAT16_VALUE(  -10.164), SIMDE_FLOAT16_VALUE(    64.75), SIMDE_FLOAT16_VALUE(    -54.2), SIMDE_FLOAT16_VALUE(    33.22),
+        SIMDE_FLOAT16_VALUE(     37.5), SIMDE_FLOAT16_VALUE(    -4.48), SIMDE_FLOAT16_VALUE(    -28.4), SIMDE_FLOAT16_VALUE(     16.6),
+        SIMDE_FLOAT16_VALUE(   -4.234), SIMDE_FLOAT16_VALUE(   -27.53), SIMDE_FLOAT16_VALUE(   -14.54), SIMDE_FLOAT16_VALUE(    36.88),
+        SIMDE_FLOAT16_VALUE(   -46.75), SIMDE_FLOAT16_VALUE(    45.78), SIMDE_FLOAT16_VALUE(     55.2), SIMDE_FLOAT16_VALUE(    -44.8),
+        SIMDE_FLOAT16_VALUE(   -55.84), SIMDE_FLOAT16_VALUE(    84.44), SIMDE_FLOAT16_VALUE(   -37.97), SIMDE_FLOAT16_VALUE(    74.06),
+        SIMDE_FLOAT16_VALUE(    166.6), SIMDE_FLOAT16_VALUE(    87.75), SIMDE_FLOAT16_VALUE(   -5.637), SIMDE_FLOAT16_VALUE(   -124.9),
+        SIMDE_FLOAT16_VALUE(   -10.16), SIMDE_FLOAT16_VALUE(    59.38), SIMDE_FLOAT16_VALUE(   -53.03), SIMDE_FLOAT16_VALUE(    73.06) } },
+    { { SIMDE_FLOAT16_VALUE(   0.1272), SIMDE_FLOAT16_VALUE(     9.34), SIMDE_FLOAT16_VALUE(     9.13), SIMDE_FLOAT16_VALUE(   -5.086),
+        SIMDE_FLOAT16_VALUE(   -3.678), SIMDE_FLOAT16_VALUE(    -8.13), SIMDE_FLOAT16_VALUE(   0.8525), SIMDE_FLOAT16_VALUE(    -9.95),
+        SIMDE_FLOAT16_VALUE(   -6.977), SIMDE_FLOAT16_VALUE(     5.92), SIMDE_FLOAT16_VALUE(   -5.918), SIMDE_FLOAT16_VALUE(   -1.347),
+        SIMDE_FLOAT16_VALUE(     -9.3), SIMDE_FLOAT16_VALUE(   0.6934), SIMDE_FLOAT16_VALUE(    0.836), SIMDE_FLOAT16_VALUE(   -6.582),
+        SIMDE_FLOAT16_VALUE(    -8.62), SIMDE_FLOAT16_VALUE(    2.957), SIMDE_FLOAT16_VALUE(  -0.2637), SIMDE_FLOAT16_VALUE(   -5.715),
+        SIMDE_FLOAT16_VALUE(    4.094), SIMDE_FLOAT16_VALUE(     3.71), SIMDE_FLOAT16_VALUE(   -2.207), SIMDE_FLOAT16_VALUE(   -0.838),
+        SIMDE_FLOAT16_VALUE(   -3.035), SIMDE_FLOAT16_VALUE(    3.229), SIMDE_FLOAT16_VALUE(    -8.57), SIMDE_FLOAT16_VALUE(   -2.443),
+        SIMDE_FLOAT16_VALUE(   -4.348), SIMDE_FLOAT16_VALUE(    6.934), SIMDE_FLOAT16_VALUE(   -0.517), SIMDE_FLOAT16_VALUE(    -8.47) },
+      { SIMDE_FLOAT16_VALUE(    7.758), SIMDE_FLOAT16_VALUE(    -5.61), SIMDE_FLOAT16_VALUE(   -3.617), SIMDE_FLOAT16_VALUE(   -2.203),
+        SIMDE_FLOAT16_VALUE(     5.13), SIMDE_FLOAT16_VALUE(     7.64), SIMDE_FLOAT16_VALUE(    -8.81), SIMDE_FLOAT16_VALUE(    4.605),
+        SIMDE_FLOAT16_VALUE(    1.686), SIMDE_FLOAT16_VALUE(   -2.889), SIMDE_FLOAT16_VALUE(    3.652), SIMDE_FLOAT16_VALUE(   -1.986),
+        SIMDE_FLOAT16_VALUE(    3.953), SIMDE_FLOAT16_VALUE(   -7.953), SIMDE_FLOAT16_VALUE(    4.668), SIMDE_FLOAT16_VALUE(   -1.631),
+        SIMDE_FLOAT16_VALUE(   -2.217), SIMDE_FLOAT16_VALUE(    6.254), SIMDE_FLOAT16_VALUE(     6.71), SIMDE_FLOAT16_VALUE(   -3.219),
+        SIMDE_FLOAT16_VALUE(    1.586), SIMDE_FLOAT16_VALUE(   -4.746), SIMDE_FLOAT16_VALUE(    -9.19), SIMDE_FLOAT16_VALUE(   -3.541),
+        SIMDE_FLOAT16_VALUE(   -5.605), SIMDE_FLOAT16_VALUE(   -3.938), SIMDE_FLOAT16_VALUE(   -1.841), SIMDE_FLOAT16_VALUE(   -3.104),
+        SIMDE_FLOAT16_VALUE(    2.816), SIMDE_FLOAT16_VALUE(   -5.746), SIMDE_FLOAT16_VALUE(     3.35), SIMDE_FLOAT16_VALUE(    1.734) },
+      { SIMDE_FLOAT16_VALUE(     74.7), SIMDE_FLOAT16_VALUE(    17.12), SIMDE_FLOAT16_VALUE(    42.38), SIMDE_FLOAT16_VALUE(    -56.3),
+        SIMDE_FLOAT16_VALUE(    -49.6), SIMDE_FLOAT16_VALUE(    35.62), SIMDE_FLOAT16_VALUE(   -2.635), SIMDE_FLOAT16_VALUE(    40.56),
+        SIMDE_FLOAT16_VALUE(   -5.844), SIMDE_FLOAT16_VALUE(   -50.75), SIMDE_FLOAT16_VALUE(     97.8), SIMDE_FLOAT16_VALUE(   -7.656),
+        SIMDE_FLOAT16_VALUE(    42.94), SIMDE_FLOAT16_VALUE(    61.47), SIMDE_FLOAT16_VALUE(   -48.06), SIMDE_FLOAT16_VALUE(    44.56),
+        SIMDE_FLOAT16_VALUE(    80.75), SIMDE_FLOAT16_VALUE(    -38.3), SIMDE_FLOAT16_VALUE(   -53.34), SIMDE_FLOAT16_VALUE(   -11.23),
+        SIMDE_FLOAT16_VALUE(    8.305), SIMDE_FLOAT16_VALUE(     33.3), SIMDE_FLOAT16_VALUE(    16.77), SIMDE_FLOAT16_VALUE(   -17.88),
+        SIMDE_FLOAT16_VALUE(   -5.758), SIMDE_FLOAT16_VALUE(     66.7), SIMDE_FLOAT16_VALUE(   -26.45), SIMDE_FLOAT16_VALUE(    6.375),
+        SIMDE_FLOAT16_VALUE(    66.56), SIMDE_FLOAT16_VALUE(    47.75), SIMDE_FLOAT16_VALUE(   -11.22), SIMDE_FLOAT16_VALUE(   -47.16) },
+      { SIMDE_FLOAT16_VALUE(     75.7), SIMDE_FLOAT16_VALUE(   -35.28), SIMDE_FLOAT16_VALUE(     9.34), SIMDE_FLOAT16_VALUE(    -45.1),
+        SIMDE_FLOAT16_VALUE(   -68.44), SIMDE_FLOAT16_VALUE(   -26.52), SIMDE_FLOAT16_VALUE(   -10.15), SIMDE_FLOAT16_VALUE(   -5.277),
+        SIMDE_FLOAT16_VALUE(   -17.61), SIMDE_FLOAT16_VALUE(    -67.9), SIMDE_FLOAT16_VALUE(     76.2), SIMDE_FLOAT16_VALUE(    -4.98),
+        SIMDE_FLOAT16_VALUE(    6.188), SIMDE_FLOAT16_VALUE(    55.97), SIMDE_FLOAT16_VALUE(   -44.16), SIMDE_FLOAT16_VALUE(    55.28),
+        SIMDE_FLOAT16_VALUE(     99.9), SIMDE_FLOAT16_VALUE(   -19.81), SIMDE_FLOAT16_VALUE(   -55.12), SIMDE_FLOAT16_VALUE(    7.168),
+        SIMDE_FLOAT16_VALUE(     14.8), SIMDE_FLOAT16_VALUE(     15.7), SIMDE_FLOAT16_VALUE(    37.03), SIMDE_FLOAT16_VALUE(   -14.91),
+        SIMDE_FLOAT16_VALUE(    11.26), SIMDE_FLOAT16_VALUE(    53.97), SIMDE_FLOAT16_VALUE(   -10.68), SIMDE_FLOAT16_VALUE(    13.96),
+        SIMDE_FLOAT16_VALUE(     54.3), SIMDE_FLOAT16_VALUE(     7.91), SIMDE_FLOAT16_VALUE(   -12.95), SIMDE_FLOAT16_VALUE(   -61.84) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512h a = simde_mm512_loadu_ph(test_vec[i].a);
+    simde__m512h b = simde_mm512_loadu_ph(test_vec[i].b);
+    simde__m512h c = simde_mm512_loadu_ph(test_vec[i].c);
+    simde__m512h r = simde_mm512_fmadd_ph(a, b, c);
+    simde_test_x86_assert_equal_f16x32(r, simde_mm512_loadu_ph(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm512_mask_fmadd_ph (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float16 a[32];
+    const simde__mmask32 k;
+    const simde_float16 b[32];
+    const simde_float16 c[32];
+    const simde_float16 r[32];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(   -5.625), SIMDE_FLOAT16_VALUE(    -4.29), SIMDE_FLOAT16_VALUE(   -2.129), SIMDE_FLOAT16_VALUE(     6.69),
+        SIMDE_FLOAT16_VALUE(    -2.82), SIMDE_FLOAT16_VALUE(      8.9), SIMDE_FLOAT16_VALUE(    3.713), SIMDE_FLOAT16_VALUE(    3.877),
+        SIMDE_FLOAT16_VALUE(   -2.334), SIMDE_FLOAT16_VALUE(  -0.1266), SIMDE_FLOAT16_VALUE(   -0.752), SIMDE_FLOAT16_VALUE(     9.39),
+        SIMDE_FLOAT16_VALUE(   -2.586), SIMDE_FLOAT16_VALUE(  -0.8066), SIMDE_FLOAT16_VALUE(     6.15), SIMDE_FLOAT16_VALUE(     9.81),
+        SIMDE_FLOAT16_VALUE(   -3.152), SIMDE_FLOAT16_VALUE(    7.277), SIMDE_FLOAT16_VALUE(   -1.796), SIMDE_FLOAT16_VALUE(   -1.021),
+        SIMDE_FLOAT16_VALUE(   -2.764), SIMDE_FLOAT16_VALUE(    3.025), SIMDE_FLOAT16_VALUE(    9.805), SIMDE_FLOAT16_VALUE(    5.004),
+        SIMDE_FLOAT16_VALUE(    -1.65), SIMDE_FLOAT16_VALUE(     4.35), SIMDE_FLOAT16_VALUE(     9.16), SIMDE_FLOAT16_VALUE(      3.1),
+        SIMDE_FLOAT16_VALUE(     5.96), SIMDE_FLOAT16_VALUE(    -6.56), SIMDE_FLOAT16_VALUE(    -6.89), SIMDE_FLOAT16_VALUE(    1.066) },
+      UINT32_C(2642784291),
+      { SIMDE_FLOAT16_VALUE(    -3.43), SIMDE_FLOAT16_VALUE(    5.574), SIMDE_FLOAT16_VALUE(   -7.875), SIMDE_FLOAT16_VALUE(   0.7896),
+        SIMDE_FLOAT16_VALUE(    5.746), SIMDE_FLOAT16_VALUE(   -6.254), SIMDE_FLOAT16_VALUE(  -0.3718), SIMDE_FLOAT16_VALUE(   -4.438),
+        SIMDE_FLOAT16_VALUE(     5.16), SIMDE_FLOAT16_VALUE(  -0.5522), SIMDE_FLOAT16_VALUE(     8.62), SIMDE_FLOAT16_VALUE(   -9.125),
+        SIMDE_FLOAT16_VALUE(    3.605), SIMDE_FLOAT16_VALUE(   -4.344), SIMDE_FLOAT16_VALUE(   -7.742), SIMDE_FLOAT16_VALUE(    -8.45),
+        SIMDE_FLOAT16_VALUE(   -5.875), SIMDE_FLOAT16_VALUE(     7.29), SIMDE_FLOAT16_VALUE(    4.633), SIMDE_FLOAT16_VALUE(    -7.32),
+        SIMDE_FLOAT16_VALUE(   -7.402), SIMDE_FLOAT16_VALUE(     7.15), SIMDE_FLOAT16_VALUE(   -1.923), SIMDE_FLOAT16_VALUE(   -6.543),
+        SIMDE_FLOAT16_VALUE(   -3.918), SIMDE_FLOAT16_VALUE(   -6.965), SIMDE_FLOAT16_VALUE(    5.254), SIMDE_FLOAT16_VALUE(   -2.582),
+        SIMDE_FLOAT16_VALUE(     -8.7), SIMDE_FLOAT16_VALUE(     9.43), SIMDE_FLOAT16_VALUE(    -7.21), SIMDE_FLOAT16_VALUE(   -1.483) },
+      { SIMDE_FLOAT16_VALUE(    51.22), SIMDE_FLOAT16_VALUE(   -28.31), SIMDE_FLOAT16_VALUE(    66.44), SIMDE_FLOAT16_VALUE(    84.56),
+        SIMDE_FLOAT16_VALUE(    16.17), SIMDE_FLOAT16_VALUE(    87.75), SIMDE_FLOAT16_VALUE(   -1.564), SIMDE_FLOAT16_VALUE(    -64.9),
+        SIMDE_FLOAT16_VALUE(   -89.94), SIMDE_FLOAT16_VALUE(     7.98), SIMDE_FLOAT16_VALUE(    -46.0), SIMDE_FLOAT16_VALUE(     72.0),
+        SIMDE_FLOAT16_VALUE(    55.47), SIMDE_FLOAT16_VALUE(   -23.86), SIMDE_FLOAT16_VALUE(     78.4), SIMDE_FLOAT16_VALUE(    7.074),
+        SIMDE_FLOAT16_VALUE(     66.5), SIMDE_FLOAT16_VALUE(    86.94), SIMDE_FLOAT16_VALUE(   -94.25), SIMDE_FLOAT16_VALUE(   -74.75),
+        SIMDE_FLOAT16_VALUE(    7.586), SIMDE_FLOAT16_VALUE(     19.0), SIMDE_FLOAT16_VALUE(     58.1), SIMDE_FLOAT16_VALUE(    54.56),
+        SIMDE_FLOAT16_VALUE(    -82.7), SIMDE_FLOAT16_VALUE(   -47.66), SIMDE_FLOAT16_VALUE(    72.25), SIMDE_FLOAT16_VALUE(     22.9),
+        SIMDE_FLOAT16_VALUE(     90.6), SIMDE_FLOAT16_VALUE(   -23.38), SIMDE_FLOAT16_VALUE(     27.9), SIMDE_FLOAT16_VALUE(    18.56) },
+      { SIMDE_FLOAT16_VALUE(     70.5), SIMDE_FLOAT16_VALUE(   -52.22), SIMDE_FLOAT16_VALUE(   -2.129), SIMDE_FLOAT16_VALUE(     6.69),
+        SIMDE_FLOAT16_VALUE(    -2.82), SIMDE_FLOAT16_VALUE(     32.1), SIMDE_FLOAT16_VALUE(    3.713), SIMDE_FLOAT16_VALUE(    3.877),
+        SIMDE_FLOAT16_VALUE(   -2.334), SIMDE_FLOAT16_VALUE(  -0.1266), SIMDE_FLOAT16_VALUE(   -0.752), SIMDE_FLOAT16_VALUE(     9.39),
+        SIMDE_FLOAT16_VALUE(    46.16), SIMDE_FLOAT16_VALUE(   -20.36), SIMDE_FLOAT16_VALUE(     6.15), SIMDE_FLOAT16_VALUE(    -75.9),
+        SIMDE_FLOAT16_VALUE(     85.0), SIMDE_FLOAT16_VALUE(    7.277), SIMDE_FLOAT16_VALUE(  -102.56), SIMDE_FLOAT16_VALUE(   -1.021),
+        SIMDE_FLOAT16_VALUE(   -2.764), SIMDE_FLOAT16_VALUE(    3.025), SIMDE_FLOAT16_VALUE(    9.805), SIMDE_FLOAT16_VALUE(    21.83),
+        SIMDE_FLOAT16_VALUE(   -76.25), SIMDE_FLOAT16_VALUE(     4.35), SIMDE_FLOAT16_VALUE(    120.4), SIMDE_FLOAT16_VALUE(    14.91),
+        SIMDE_FLOAT16_VALUE(    38.75), SIMDE_FLOAT16_VALUE(    -6.56), SIMDE_FLOAT16_VALUE(    -6.89), SIMDE_FLOAT16_VALUE(    16.98) } },
+    { { SIMDE_FLOAT16_VALUE(    -4.02), SIMDE_FLOAT16_VALUE(     8.94), SIMDE_FLOAT16_VALUE(     9.57), SIMDE_FLOAT16_VALUE(    1.634),
+        SIMDE_FLOAT16_VALUE(    6.848), SIMDE_FLOAT16_VALUE(    4.426), SIMDE_FLOAT16_VALUE(   -5.043), SIMDE_FLOAT16_VALUE(   -3.324),
+        SIMDE_FLOAT16_VALUE(    4.168), SIMDE_FLOAT16_VALUE(   -1.023), SIMDE_FLOAT16_VALUE(   -1.672), SIMDE_FLOAT16_VALUE(   -6.477),
+        SIMDE_FLOAT16_VALUE(   -6.746), SIMDE_FLOAT16_VALUE(    -5.87), SIMDE_FLOAT16_VALUE(    5.492), SIMDE_FLOAT16_VALUE(   -6.207),
+        SIMDE_FLOAT16_VALUE(   -2.314), SIMDE_FLOAT16_VALUE(    3.047), SIMDE_FLOAT16_VALUE(   -5.715), SIMDE_FLOAT16_VALUE(  -0.4866),
+        SIMDE_FLOAT16_VALUE(    6.867), SIMDE_FLOAT16_VALUE(   0.9814), SIMDE_FLOAT16_VALUE(   0.4163), SIMDE_FLOAT16_VALUE(    3.545),
+        SIMDE_FLOAT16_VALUE(     6.35), SIMDE_FLOAT16_VALUE(   -7.098), SIMDE_FLOAT16_VALUE(    1.041), SIMDE_FLOAT16_VALUE(    -8.05),
+        SIMDE_FLOAT16_VALUE(    9.195), SIMDE_FLOAT16_VALUE(     -9.3), SIMDE_FLOAT16_VALUE(   -4.484), SIMDE_FLOAT16_VALUE(    7.918) },
+      UINT32_C(1611381213),
+      { SIMDE_FLOAT16_VALUE(     9.49), SIMDE_FLOAT16_VALUE(    -8.57), SIMDE_FLOAT16_VALUE(   0.6714), SIMDE_FLOAT16_VALUE(  -0.3164),
+        SIMDE_FLOAT16_VALUE(     8.52), SIMDE_FLOAT16_VALUE(     2.04), SIMDE_FLOAT16_VALUE(    3.768), SIMDE_FLOAT16_VALUE(    -6.42),
+        SIMDE_FLOAT16_VALUE(      8.4), SIMDE_FLOAT16_VALUE(   -2.428), SIMDE_FLOAT16_VALUE(    2.996), SIMDE_FLOAT16_VALUE(   -6.656),
+        SIMDE_FLOAT16_VALUE(    -7.48), SIMDE_FLOAT16_VALUE(    6.855), SIMDE_FLOAT16_VALUE(   0.3506), SIMDE_FLOAT16_VALUE(   -6.008),
+        SIMDE_FLOAT16_VALUE(   -7.594), SIMDE_FLOAT16_VALUE(    4.965), SIMDE_FLOAT16_VALUE(  -0.9883), SIMDE_FLOAT16_VALUE(     -8.0),
+        SIMDE_FLOAT16_VALUE(    3.242), SIMDE_FLOAT16_VALUE(     9.04), SIMDE_FLOAT16_VALUE(    2.338), SIMDE_FLOAT16_VALUE(    5.137),
+        SIMDE_FLOAT16_VALUE(   -2.068), SIMDE_FLOAT16_VALUE(      7.1), SIMDE_FLOAT16_VALUE(    5.184), SIMDE_FLOAT16_VALUE(    -2.76),
+        SIMDE_FLOAT16_VALUE(     -9.1), SIMDE_FLOAT16_VALUE(    5.156), SIMDE_FLOAT16_VALUE(    -5.78), SIMDE_FLOAT16_VALUE(    1.951) },
+      { SIMDE_FLOAT16_VALUE(    1.487), SIMDE_FLOAT16_VALUE(    -67.4), SIMDE_FLOAT16_VALUE(     98.7), SIMDE_FLOAT16_VALUE(    33.34),
+        SIMDE_FLOAT16_VALUE(    -58.1), SIMDE_FLOAT16_VALUE(   -3.057), SIMDE_FLOAT16_VALUE(   -46.56), SIMDE_FLOAT16_VALUE(   -57.97),
+        SIMDE_FLOAT16_VALUE(     42.8), SIMDE_FLOAT16_VALUE(     79.2), SIMDE_FLOAT16_VALUE(    -93.5), SIMDE_FLOAT16_VALUE(    -26.3),
+        SIMDE_FLOAT16_VALUE(    -60.9), SIMDE_FLOAT16_VALUE(   -15.89), SIMDE_FLOAT16_VALUE(     49.0), SIMDE_FLOAT16_VALUE(     82.8),
+        SIMDE_FLOAT16_VALUE(   -76.44), SIMDE_FLOAT16_VALUE(     80.4), SIMDE_FLOAT16_VALUE(     90.1), SIMDE_FLOAT16_VALUE(    43.66),
+        SIMDE_FLOAT16_VALUE(   -33.72), SIMDE_FLOAT16_VALUE(     45.4), SIMDE_FLOAT16_VALUE(    12.34), SIMDE_FLOAT16_VALUE(    18.89),
+        SIMDE_FLOAT16_VALUE(    -82.4), SIMDE_FLOAT16_VALUE(     1.26), SIMDE_FLOAT16_VALUE(    13.52), SIMDE_FLOAT16_VALUE(     81.8),
+        SIMDE_FLOAT16_VALUE(   -77.75), SIMDE_FLOAT16_VALUE(     69.2), SIMDE_FLOAT16_VALUE(   -34.62), SIMDE_FLOAT16_VALUE(   -30.14) },
+      { SIMDE_FLOAT16_VALUE(   -36.66), SIMDE_FLOAT16_VALUE(     8.94), SIMDE_FLOAT16_VALUE(    105.1), SIMDE_FLOAT16_VALUE(     32.8),
+        SIMDE_FLOAT16_VALUE(   0.2717), SIMDE_FLOAT16_VALUE(    4.426), SIMDE_FLOAT16_VALUE(   -65.56), SIMDE_FLOAT16_VALUE(   -36.62),
+        SIMDE_FLOAT16_VALUE(     77.8), SIMDE_FLOAT16_VALUE(   -1.023), SIMDE_FLOAT16_VALUE(   -1.672), SIMDE_FLOAT16_VALUE(    16.81),
+        SIMDE_FLOAT16_VALUE(  -10.445), SIMDE_FLOAT16_VALUE(   -56.12), SIMDE_FLOAT16_VALUE(    5.492), SIMDE_FLOAT16_VALUE(    120.1),
+        SIMDE_FLOAT16_VALUE(   -58.88), SIMDE_FLOAT16_VALUE(     95.5), SIMDE_FLOAT16_VALUE(   -5.715), SIMDE_FLOAT16_VALUE(    47.56),
+        SIMDE_FLOAT16_VALUE(    6.867), SIMDE_FLOAT16_VALUE(   0.9814), SIMDE_FLOAT16_VALUE(   0.4163), SIMDE_FLOAT16_VALUE(    3.545),
+        SIMDE_FLOAT16_VALUE(     6.35), SIMDE_FLOAT16_VALUE(   -7.098), SIMDE_FLOAT16_VALUE(    1.041), SIMDE_FLOAT16_VALUE(    -8.05),
+        SIMDE_FLOAT16_VALUE(    9.195), SIMDE_FLOAT16_VALUE(    21.25), SIMDE_FLOAT16_VALUE(     -8.7), SIMDE_FLOAT16_VALUE(    7.918) } },
+    { { SIMDE_FLOAT16_VALUE(    8.836), SIMDE_FLOAT16_VALUE(    7.855), SIMDE_FLOAT16_VALUE(  0.01848), SIMDE_FLOAT16_VALUE(    -7.55),
+        SIMDE_FLOAT16_VALUE(    -9.33), SIMDE_FLOAT16_VALUE(   -5.477), SIMDE_FLOAT16_VALUE(     5.37), SIMDE_FLOAT16_VALUE(   -4.273),
+        SIMDE_FLOAT16_VALUE(    2.387), SIMDE_FLOAT16_VALUE(   -9.984), SIMDE_FLOAT16_VALUE(     9.98), SIMDE_FLOAT16_VALUE(    4.156),
+        SIMDE_FLOAT16_VALUE(    -3.43), SIMDE_FLOAT16_VALUE(    7.137), SIMDE_FLOAT16_VALUE(    8.734), SIMDE_FLOAT16_VALUE(   -5.934),
+        SIMDE_FLOAT16_VALUE(    6.934), SIMDE_FLOAT16_VALUE(   -3.566), SIMDE_FLOAT16_VALUE(   -4.785), SIMDE_FLOAT16_VALUE(   -1.375),
+        SIMDE_FLOAT16_VALUE(    6.375), SIMDE_FLOAT16_VALUE(   0.1411), SIMDE_FLOAT16_VALUE(    2.154), SIMDE_FLOAT16_VALUE(    -4.71),
+        SIMDE_FLOAT16_VALUE(    2.176), SIMDE_FLOAT16_VALUE(   -1.876), SIMDE_FLOAT16_VALUE(    3.498), SIMDE_FLOAT16_VALUE(     5.95),
+        SIMDE_FLOAT16_VALUE(    3.182), SIMDE_FLOAT16_VALUE(   -3.664), SIMDE_FLOAT16_VALUE(   -3.127), SIMDE_FLOAT16_VALUE(   -2.951) },
+      UINT32_C(1969455599),
+      { SIMDE_FLOAT16_VALUE(    4.586), SIMDE_FLOAT16_VALUE(     9.95), SIMDE_FLOAT16_VALUE(    -5.09), SIMDE_FLOAT16_VALUE(   -6.523),
+        SIMDE_FLOAT16_VALUE(    6.184), SIMDE_FLOAT16_VALUE(    7.105), SIMDE_FLOAT16_VALUE(  -0.5464), SIMDE_FLOAT16_VALUE(    2.602),
+        SIMDE_FLOAT16_VALUE(   -2.145), SIMDE_FLOAT16_VALUE(    2.268), SIMDE_FLOAT16_VALUE(     5.94), SIMDE_FLOAT16_VALUE(   -0.935),
+        SIMDE_FLOAT16_VALUE(    8.516), SIMDE_FLOAT16_VALUE(  -0.7715), SIMDE_FLOAT16_VALUE(     9.92), SIMDE_FLOAT16_VALUE(   1.3955),
+        SIMDE_FLOAT16_VALUE(     4.33), SIMDE_FLOAT16_VALUE(     8.27), SIMDE_FLOAT16_VALUE(   0.1814), SIMDE_FLOAT16_VALUE(    2.896),
+        SIMDE_FLOAT16_VALUE(     8.54), SIMDE_FLOAT16_VALUE(  -0.5996), SIMDE_FLOAT16_VALUE(    3.031), SIMDE_FLOAT16_VALUE(    -5.26),
+        SIMDE_FLOAT16_VALUE(    9.375), SIMDE_FLOAT16_VALUE(   -6.887), SIMDE_FLOAT16_VALUE(    8.516), SIMDE_FLOAT16_VALUE(   -4.402),
+        SIMDE_FLOAT16_VALUE(    3.777), SIMDE_FLOAT16_VALUE(    3.588), SIMDE_FLOAT16_VALUE(    6.844), SIMDE_FLOAT16_VALUE(    -9.94) },
+      { SIMDE_FLOAT16_VALUE(    31.11), SIMDE_FLOAT16_VALUE(    -35.6), SIMDE_FLOAT16_VALUE(    59.56), SIMDE_FLOAT16_VALUE(    -97.9),
+        SIMDE_FLOAT16_VALUE(   -46.97), SIMDE_FLOAT16_VALUE(    4.535), SIMDE_FLOAT16_VALUE(     4.53), SIMDE_FLOAT16_VALUE(    -8.49),
+        SIMDE_FLOAT16_VALUE(    42.75), SIMDE_FLOAT16_VALUE(   -4.125), SIMDE_FLOAT16_VALUE(    88.06), SIMDE_FLOAT16_VALUE(   -35.47),
+        SIMDE_FLOAT16_VALUE(    68.44), SIMDE_FLOAT16_VALUE(   -92.56), SIMDE_FLOAT16_VALUE(   -26.75), SIMDE_FLOAT16_VALUE(   -60.38),
+        SIMDE_FLOAT16_VALUE(   -44.06), SIMDE_FLOAT16_VALUE(    25.06), SIMDE_FLOAT16_VALUE(    11.92), SIMDE_FLOAT16_VALUE(     72.7),
+        SIMDE_FLOAT16_VALUE(   -28.55), SIMDE_FLOAT16_VALUE(    69.44), SIMDE_FLOAT16_VALUE(     86.2), SIMDE_FLOAT16_VALUE(   -60.66),
+        SIMDE_FLOAT16_VALUE(   -44.94), SIMDE_FLOAT16_VALUE(     63.4), SIMDE_FLOAT16_VALUE(     97.2), SIMDE_FLOAT16_VALUE(    -10.2),
+        SIMDE_FLOAT16_VALUE(   -14.99), SIMDE_FLOAT16_VALUE(    -81.0), SIMDE_FLOAT16_VALUE(    39.94), SIMDE_FLOAT16_VALUE(    36.78) },
+      { SIMDE_FLOAT16_VALUE(     71.6), SIMDE_FLOAT16_VALUE(     42.6), SIMDE_FLOAT16_VALUE(    59.47), SIMDE_FLOAT16_VALUE(   -48.62),
+        SIMDE_FLOAT16_VALUE(    -9.33), SIMDE_FLOAT16_VALUE(   -34.38), SIMDE_FLOAT16_VALUE(    1.597), SIMDE_FLOAT16_VALUE(   -19.61),
+        SIMDE_FLOAT16_VALUE(    37.62), SIMDE_FLOAT16_VALUE(   -9.984), SIMDE_FLOAT16_VALUE(     9.98), SIMDE_FLOAT16_VALUE(    4.156),
+        SIMDE_FLOAT16_VALUE(    -3.43), SIMDE_FLOAT16_VALUE(    7.137), SIMDE_FLOAT16_VALUE(    8.734), SIMDE_FLOAT16_VALUE(    -68.6),
+        SIMDE_FLOAT16_VALUE(  -14.055), SIMDE_FLOAT16_VALUE(   -4.445), SIMDE_FLOAT16_VALUE(   -4.785), SIMDE_FLOAT16_VALUE(   -1.375),
+        SIMDE_FLOAT16_VALUE(    6.375), SIMDE_FLOAT16_VALUE(     69.4), SIMDE_FLOAT16_VALUE(     92.7), SIMDE_FLOAT16_VALUE(    -4.71),
+        SIMDE_FLOAT16_VALUE(   -24.55), SIMDE_FLOAT16_VALUE(   -1.876), SIMDE_FLOAT16_VALUE(    127.0), SIMDE_FLOAT16_VALUE(     5.95),
+        SIMDE_FLOAT16_VALUE(   -2.975), SIMDE_FLOAT16_VALUE(    -94.1), SIMDE_FLOAT16_VALUE(    18.53), SIMDE_FLOAT16_VALUE(   -2.951) } },
+    { { SIMDE_FLOAT16_VALUE(    -6.12), SIMDE_FLOAT16_VALUE(    -8.17), SIMDE_FLOAT16_VALUE(    5.168), SIMDE_FLOAT16_VALUE(    1.455),
+        SIMDE_FLOAT16_VALUE(    5.094), SIMDE_FLOAT16_VALUE(    3.717), SIMDE_FLOAT16_VALUE(    -0.73), SIMDE_FLOAT16_VALUE(   -6.734),
+        SIMDE_FLOAT16_VALUE(     4.78), SIMDE_FLOAT16_VALUE(    0.906), SIMDE_FLOAT16_VALUE(   -1.806), SIMDE_FLOAT16_VALUE(     4.92),
+        SIMDE_FLOAT16_VALUE(     8.57), SIMDE_FLOAT16_VALUE(     7.25), SIMDE_FLOAT16_VALUE(     7.05), SIMDE_FLOAT16_VALUE(    2.613),
+        SIMDE_FLOAT16_VALUE(    5.746), SIMDE_FLOAT16_VALUE( -0.04907), SIMDE_FLOAT16_VALUE(     5.28), SIMDE_FLOAT16_VALUE(    -4.82),
+        SIMDE_FLOAT16_VALUE(    -9.02), SIMDE_FLOAT16_VALUE(   -7.777), SIMDE_FLOAT16_VALUE(     -0.7), SIMDE_FLOAT16_VALUE(    8.836),
+        SIMDE_FLOAT16_VALUE(     6.41), SIMDE_FLOAT16_VALUE(    4.406), SIMDE_FLOAT16_VALUE(     -8.1), SIMDE_FLOAT16_VALUE(   0.4143),
+        SIMDE_FLOAT16_VALUE(    7.695), SIMDE_FLOAT16_VALUE(   -2.717), SIMDE_FLOAT16_VALUE(     3.68), SIMDE_FLOAT16_VALUE(  -0.9336) },
+      UINT32_C(1909644457),
+      { SIMDE_FLOAT16_VALUE(     4.67), SIMDE_FLOAT16_VALUE(     1.24), SIMDE_FLOAT16_VALUE(    7.617), SIMDE_FLOAT16_VALUE(   -7.688),
+        SIMDE_FLOAT16_VALUE(    1.844), SIMDE_FLOAT16_VALUE(    -9.21), SIMDE_FLOAT16_VALUE(    9.664), SIMDE_FLOAT16_VALUE(   -0.965),
+        SIMDE_FLOAT16_VALUE(     3.91), SIMDE_FLOAT16_VALUE(    4.273), SIMDE_FLOAT16_VALUE(     8.53), SIMDE_FLOAT16_VALUE(   -4.473),
+        SIMDE_FLOAT16_VALUE(    -2.86), SIMDE_FLOAT16_VALUE(    2.074), SIMDE_FLOAT16_VALUE(    9.914), SIMDE_FLOAT16_VALUE(    4.598),
+        SIMDE_FLOAT16_VALUE(  -0.2147), SIMDE_FLOAT16_VALUE(   0.1395), SIMDE_FLOAT16_VALUE(    -8.39), SIMDE_FLOAT16_VALUE(      5.6),
+        SIMDE_FLOAT16_VALUE(      5.3), SIMDE_FLOAT16_VALUE(      9.6), SIMDE_FLOAT16_VALUE(    1.365), SIMDE_FLOAT16_VALUE(    6.363),
+        SIMDE_FLOAT16_VALUE(     8.91), SIMDE_FLOAT16_VALUE(     8.07), SIMDE_FLOAT16_VALUE(    6.273), SIMDE_FLOAT16_VALUE(    9.945),
+        SIMDE_FLOAT16_VALUE(    -7.11), SIMDE_FLOAT16_VALUE(   -5.883), SIMDE_FLOAT16_VALUE(   0.6187), SIMDE_FLOAT16_VALUE(    9.836) },
+      { SIMDE_FLOAT16_VALUE(    -75.3), SIMDE_FLOAT16_VALUE(    17.88), SIMDE_FLOAT16_VALUE(   -60.78), SIMDE_FLOAT16_VALUE(    63.97),
+        SIMDE_FLOAT16_VALUE(    20.44), SIMDE_FLOAT16_VALUE(     90.3), SIMDE_FLOAT16_VALUE(    -81.0), SIMDE_FLOAT16_VALUE(     97.9),
+        SIMDE_FLOAT16_VALUE(   -63.94), SIMDE_FLOAT16_VALUE(     21.1), SIMDE_FLOAT16_VALUE(    25.69), SIMDE_FLOAT16_VALUE(   -10.12),
+        SIMDE_FLOAT16_VALUE(    59.16), SIMDE_FLOAT16_VALUE(    -85.1), SIMDE_FLOAT16_VALUE(    4.445), SIMDE_FLOAT16_VALUE(   -21.47),
+        SIMDE_FLOAT16_VALUE(    -54.1), SIMDE_FLOAT16_VALUE(     52.4), SIMDE_FLOAT16_VALUE(   -55.12), SIMDE_FLOAT16_VALUE(   -3.848),
+        SIMDE_FLOAT16_VALUE(    -77.0), SIMDE_FLOAT16_VALUE(    -90.5), SIMDE_FLOAT16_VALUE(     99.4), SIMDE_FLOAT16_VALUE(    -8.78),
+        SIMDE_FLOAT16_VALUE(     88.2), SIMDE_FLOAT16_VALUE(    -5.74), SIMDE_FLOAT16_VALUE(    -40.8), SIMDE_FLOAT16_VALUE(     56.3),
+        SIMDE_FLOAT16_VALUE(   -13.37), SIMDE_FLOAT16_VALUE(   -61.03), SIMDE_FLOAT16_VALUE(    60.38), SIMDE_FLOAT16_VALUE(    53.75) },
+      { SIMDE_FLOAT16_VALUE(  -103.94), SIMDE_FLOAT16_VALUE(    -8.17), SIMDE_FLOAT16_VALUE(    5.168), SIMDE_FLOAT16_VALUE(    52.78),
+        SIMDE_FLOAT16_VALUE(    5.094), SIMDE_FLOAT16_VALUE(    56.06), SIMDE_FLOAT16_VALUE(    -0.73), SIMDE_FLOAT16_VALUE(    104.4),
+        SIMDE_FLOAT16_VALUE(     4.78), SIMDE_FLOAT16_VALUE(    0.906), SIMDE_FLOAT16_VALUE(    10.28), SIMDE_FLOAT16_VALUE(   -32.12),
+        SIMDE_FLOAT16_VALUE(    34.66), SIMDE_FLOAT16_VALUE(     7.25), SIMDE_FLOAT16_VALUE(     74.4), SIMDE_FLOAT16_VALUE(    -9.45),
+        SIMDE_FLOAT16_VALUE(    5.746), SIMDE_FLOAT16_VALUE(     52.4), SIMDE_FLOAT16_VALUE(     5.28), SIMDE_FLOAT16_VALUE(    -4.82),
+        SIMDE_FLOAT16_VALUE(   -124.8), SIMDE_FLOAT16_VALUE(   -7.777), SIMDE_FLOAT16_VALUE(    98.44), SIMDE_FLOAT16_VALUE(    47.44),
+        SIMDE_FLOAT16_VALUE(    145.2), SIMDE_FLOAT16_VALUE(    4.406), SIMDE_FLOAT16_VALUE(     -8.1), SIMDE_FLOAT16_VALUE(   0.4143),
+        SIMDE_FLOAT16_VALUE(   -68.06), SIMDE_FLOAT16_VALUE(   -45.06), SIMDE_FLOAT16_VALUE(    62.66), SIMDE_FLOAT16_VALUE(  -0.9336) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512h a = simde_mm512_loadu_ph(test_vec[i].a);
+    simde__m512h b = simde_mm512_loadu_ph(test_vec[i].b);
+    simde__m512h c = simde_mm512_loadu_ph(test_vec[i].c);
+    simde__m512h r = simde_mm512_mask_fmadd_ph(a, test_vec[i].k, b, c);
+    simde_test_x86_assert_equal_f16x32(r, simde_mm512_loadu_ph(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm512_mask3_fmadd_ph (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float16 a[32];
+    const simde_float16 b[32];
+    const simde_float16 c[32];
+    const simde__mmask32 k;
+    const simde_float16 r[32];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(  -0.2898), SIMDE_FLOAT16_VALUE(   -3.578), SIMDE_FLOAT16_VALUE(   0.3564), SIMDE_FLOAT16_VALUE(    2.654),
+        SIMDE_FLOAT16_VALUE(   -0.983), SIMDE_FLOAT16_VALUE(  0.03183), SIMDE_FLOAT16_VALUE(   -9.664), SIMDE_FLOAT16_VALUE(    -3.52),
+        SIMDE_FLOAT16_VALUE(   -5.547), SIMDE_FLOAT16_VALUE(   -3.342), SIMDE_FLOAT16_VALUE(     9.36), SIMDE_FLOAT16_VALUE(    1.215),
+        SIMDE_FLOAT16_VALUE(     8.69), SIMDE_FLOAT16_VALUE(   -3.041), SIMDE_FLOAT16_VALUE(   -1.472), SIMDE_FLOAT16_VALUE(     9.44),
+        SIMDE_FLOAT16_VALUE(     9.44), SIMDE_FLOAT16_VALUE(    1.839), SIMDE_FLOAT16_VALUE(    8.266), SIMDE_FLOAT16_VALUE(    1.437),
+        SIMDE_FLOAT16_VALUE(   -9.305), SIMDE_FLOAT16_VALUE(   -7.285), SIMDE_FLOAT16_VALUE(      7.0), SIMDE_FLOAT16_VALUE(    -6.62),
+        SIMDE_FLOAT16_VALUE(   -7.586), SIMDE_FLOAT16_VALUE(    5.227), SIMDE_FLOAT16_VALUE(    -4.99), SIMDE_FLOAT16_VALUE(   -4.824),
+        SIMDE_FLOAT16_VALUE(   -7.035), SIMDE_FLOAT16_VALUE(   -6.496), SIMDE_FLOAT16_VALUE(    6.566), SIMDE_FLOAT16_VALUE(  -0.5356) },
+      { SIMDE_FLOAT16_VALUE(    1.881), SIMDE_FLOAT16_VALUE(    -2.61), SIMDE_FLOAT16_VALUE(     -7.8), SIMDE_FLOAT16_VALUE(    -8.75),
+        SIMDE_FLOAT16_VALUE(  0.04422), SIMDE_FLOAT16_VALUE(     4.49), SIMDE_FLOAT16_VALUE(    8.086), SIMDE_FLOAT16_VALUE(    7.473),
+        SIMDE_FLOAT16_VALUE(    6.855), SIMDE_FLOAT16_VALUE(    -6.56), SIMDE_FLOAT16_VALUE(    3.203), SIMDE_FLOAT16_VALUE(    1.408),
+        SIMDE_FLOAT16_VALUE(    1.042), SIMDE_FLOAT16_VALUE(   -4.156), SIMDE_FLOAT16_VALUE(   -6.605), SIMDE_FLOAT16_VALUE(   0.1554),
+        SIMDE_FLOAT16_VALUE(  0.09143), SIMDE_FLOAT16_VALUE(   -2.367), SIMDE_FLOAT16_VALUE(   -1.361), SIMDE_FLOAT16_VALUE(    7.258),
+        SIMDE_FLOAT16_VALUE(    -4.02), SIMDE_FLOAT16_VALUE(    2.324), SIMDE_FLOAT16_VALUE(   -3.197), SIMDE_FLOAT16_VALUE(     8.36),
+        SIMDE_FLOAT16_VALUE(   -3.834), SIMDE_FLOAT16_VALUE(    -9.08), SIMDE_FLOAT16_VALUE(  -0.8955), SIMDE_FLOAT16_VALUE(   -3.732),
+        SIMDE_FLOAT16_VALUE(      3.3), SIMDE_FLOAT16_VALUE(    1.071), SIMDE_FLOAT16_VALUE(    -9.65), SIMDE_FLOAT16_VALUE(     9.46) },
+      { SIMDE_FLOAT16_VALUE(    15.64), SIMDE_FLOAT16_VALUE(    -96.8), SIMDE_FLOAT16_VALUE(   -24.25), SIMDE_FLOAT16_VALUE(    76.94),
+        SIMDE_FLOAT16_VALUE(     75.9), SIMDE_FLOAT16_VALUE(    35.53), SIMDE_FLOAT16_VALUE(    14.58), SIMDE_FLOAT16_VALUE(   -42.47),
+        SIMDE_FLOAT16_VALUE(    -38.3), SIMDE_FLOAT16_VALUE(    57.22), SIMDE_FLOAT16_VALUE(   -40.56), SIMDE_FLOAT16_VALUE(    -73.4),
+        SIMDE_FLOAT16_VALUE(   -96.75), SIMDE_FLOAT16_VALUE(     91.7), SIMDE_FLOAT16_VALUE(     9.24), SIMDE_FLOAT16_VALUE(   -74.25),
+        SIMDE_FLOAT16_VALUE(  -10.086), SIMDE_FLOAT16_VALUE(    49.75), SIMDE_FLOAT16_VALUE(    4.418), SIMDE_FLOAT16_VALUE(   -39.56),
+        SIMDE_FLOAT16_VALUE(   -48.44), SIMDE_FLOAT16_VALUE(   -48.12), SIMDE_FLOAT16_VALUE(    -96.5), SIMDE_FLOAT16_VALUE(   -93.75),
+        SIMDE_FLOAT16_VALUE(   -57.94), SIMDE_FLOAT16_VALUE(   -64.06), SIMDE_FLOAT16_VALUE(   -3.855), SIMDE_FLOAT16_VALUE(   -85.56),
+        SIMDE_FLOAT16_VALUE(    29.62), SIMDE_FLOAT16_VALUE(     55.2), SIMDE_FLOAT16_VALUE(    23.34), SIMDE_FLOAT16_VALUE(   -16.52) },
+      UINT32_C(283476565),
+      { SIMDE_FLOAT16_VALUE(    15.09), SIMDE_FLOAT16_VALUE(    -96.8), SIMDE_FLOAT16_VALUE(   -27.03), SIMDE_FLOAT16_VALUE(    76.94),
+        SIMDE_FLOAT16_VALUE(     75.8), SIMDE_FLOAT16_VALUE(    35.53), SIMDE_FLOAT16_VALUE(   -63.56), SIMDE_FLOAT16_VALUE(   -42.47),
+        SIMDE_FLOAT16_VALUE(    -38.3), SIMDE_FLOAT16_VALUE(     79.1), SIMDE_FLOAT16_VALUE(   -40.56), SIMDE_FLOAT16_VALUE(    -73.4),
+        SIMDE_FLOAT16_VALUE(   -96.75), SIMDE_FLOAT16_VALUE(     91.7), SIMDE_FLOAT16_VALUE(     9.24), SIMDE_FLOAT16_VALUE(    -72.8),
+        SIMDE_FLOAT16_VALUE(    -9.23), SIMDE_FLOAT16_VALUE(    49.75), SIMDE_FLOAT16_VALUE(   -6.836), SIMDE_FLOAT16_VALUE(   -39.56),
+        SIMDE_FLOAT16_VALUE(   -48.44), SIMDE_FLOAT16_VALUE(   -65.06), SIMDE_FLOAT16_VALUE(   -118.9), SIMDE_FLOAT16_VALUE(   -149.1),
+        SIMDE_FLOAT16_VALUE(   -57.94), SIMDE_FLOAT16_VALUE(   -64.06), SIMDE_FLOAT16_VALUE(   -3.855), SIMDE_FLOAT16_VALUE(   -85.56),
+        SIMDE_FLOAT16_VALUE(    6.402), SIMDE_FLOAT16_VALUE(     55.2), SIMDE_FLOAT16_VALUE(    23.34), SIMDE_FLOAT16_VALUE(   -16.52) } },
+    { { SIMDE_FLOAT16_VALUE(   -5.426), SIMDE_FLOAT16_VALUE(     8.91), SIMDE_FLOAT16_VALUE(    -4.48), SIMDE_FLOAT16_VALUE(  -0.3623),
+        SIMDE_FLOAT16_VALUE(   -2.234), SIMDE_FLOAT16_VALUE(    6.164), SIMDE_FLOAT16_VALUE(     8.36), SIMDE_FLOAT16_VALUE(   -9.875),
+        SIMDE_FLOAT16_VALUE(    4.418), SIMDE_FLOAT16_VALUE(     5.71), SIMDE_FLOAT16_VALUE(    1.715), SIMDE_FLOAT16_VALUE(     5.07),
+        SIMDE_FLOAT16_VALUE(    3.508), SIMDE_FLOAT16_VALUE(   -8.555), SIMDE_FLOAT16_VALUE(    -3.26), SIMDE_FLOAT16_VALUE(    -4.97),
+        SIMDE_FLOAT16_VALUE(    -1.04), SIMDE_FLOAT16_VALUE(    -9.25), SIMDE_FLOAT16_VALUE(   -1.924), SIMDE_FLOAT16_VALUE(    6.984),
+        SIMDE_FLOAT16_VALUE(   -4.508), SIMDE_FLOAT16_VALUE(    5.273), SIMDE_FLOAT16_VALUE(    -5.94), SIMDE_FLOAT16_VALUE(   0.7676),
+        SIMDE_FLOAT16_VALUE(    3.541), SIMDE_FLOAT16_VALUE(   -2.738), SIMDE_FLOAT16_VALUE(     9.04), SIMDE_FLOAT16_VALUE(    -8.27),
+        SIMDE_FLOAT16_VALUE(    -5.21), SIMDE_FLOAT16_VALUE(   -1.208), SIMDE_FLOAT16_VALUE(   -8.484), SIMDE_FLOAT16_VALUE(     6.27) },
+      { SIMDE_FLOAT16_VALUE(    -4.48), SIMDE_FLOAT16_VALUE(    7.742), SIMDE_FLOAT16_VALUE(    4.383), SIMDE_FLOAT16_VALUE(    2.268),
+        SIMDE_FLOAT16_VALUE(   -6.688), SIMDE_FLOAT16_VALUE(     6.36), SIMDE_FLOAT16_VALUE(    6.227), SIMDE_FLOAT16_VALUE(    -2.28),
+        SIMDE_FLOAT16_VALUE(   -5.293), SIMDE_FLOAT16_VALUE(    -8.65), SIMDE_FLOAT16_VALUE(    7.164), SIMDE_FLOAT16_VALUE(    2.635),
+        SIMDE_FLOAT16_VALUE(   -6.844), SIMDE_FLOAT16_VALUE(    -9.93), SIMDE_FLOAT16_VALUE(  -0.1296), SIMDE_FLOAT16_VALUE(    2.068),
+        SIMDE_FLOAT16_VALUE(   -3.434), SIMDE_FLOAT16_VALUE(   -4.215), SIMDE_FLOAT16_VALUE(     4.79), SIMDE_FLOAT16_VALUE(    7.707),
+        SIMDE_FLOAT16_VALUE(    6.094), SIMDE_FLOAT16_VALUE(   -1.475), SIMDE_FLOAT16_VALUE(  -0.1736), SIMDE_FLOAT16_VALUE(    1.829),
+        SIMDE_FLOAT16_VALUE(    7.348), SIMDE_FLOAT16_VALUE(  0.01994), SIMDE_FLOAT16_VALUE(   -7.234), SIMDE_FLOAT16_VALUE(    -7.98),
+        SIMDE_FLOAT16_VALUE(    -9.83), SIMDE_FLOAT16_VALUE( 0.015076), SIMDE_FLOAT16_VALUE(    5.902), SIMDE_FLOAT16_VALUE(   -8.836) },
+      { SIMDE_FLOAT16_VALUE(     62.4), SIMDE_FLOAT16_VALUE(    82.75), SIMDE_FLOAT16_VALUE(    97.44), SIMDE_FLOAT16_VALUE(    81.94),
+        SIMDE_FLOAT16_VALUE(    23.31), SIMDE_FLOAT16_VALUE(    54.28), SIMDE_FLOAT16_VALUE(    53.72), SIMDE_FLOAT16_VALUE(    -64.6),
+        SIMDE_FLOAT16_VALUE(     34.3), SIMDE_FLOAT16_VALUE(    27.17), SIMDE_FLOAT16_VALUE(    -96.7), SIMDE_FLOAT16_VALUE(    -73.4),
+        SIMDE_FLOAT16_VALUE(    60.34), SIMDE_FLOAT16_VALUE(    29.67), SIMDE_FLOAT16_VALUE(    -85.2), SIMDE_FLOAT16_VALUE(     45.7),
+        SIMDE_FLOAT16_VALUE(  -0.1848), SIMDE_FLOAT16_VALUE(   -83.56), SIMDE_FLOAT16_VALUE(    44.16), SIMDE_FLOAT16_VALUE(   -56.78),
+        SIMDE_FLOAT16_VALUE(    -83.6), SIMDE_FLOAT16_VALUE(    3.166), SIMDE_FLOAT16_VALUE(    10.04), SIMDE_FLOAT16_VALUE(     66.7),
+        SIMDE_FLOAT16_VALUE(     69.7), SIMDE_FLOAT16_VALUE(     58.4), SIMDE_FLOAT16_VALUE(    28.08), SIMDE_FLOAT16_VALUE(   -86.94),
+        SIMDE_FLOAT16_VALUE(    -62.4), SIMDE_FLOAT16_VALUE(    -84.7), SIMDE_FLOAT16_VALUE(    39.28), SIMDE_FLOAT16_VALUE(   -20.55) },
+      UINT32_C(4164007596),
+      { SIMDE_FLOAT16_VALUE(     62.4), SIMDE_FLOAT16_VALUE(    82.75), SIMDE_FLOAT16_VALUE(     77.8), SIMDE_FLOAT16_VALUE(     81.1),
+        SIMDE_FLOAT16_VALUE(    23.31), SIMDE_FLOAT16_VALUE(     93.5), SIMDE_FLOAT16_VALUE(    53.72), SIMDE_FLOAT16_VALUE(   -42.12),
+        SIMDE_FLOAT16_VALUE(     34.3), SIMDE_FLOAT16_VALUE(   -22.22), SIMDE_FLOAT16_VALUE(    -84.4), SIMDE_FLOAT16_VALUE(    -73.4),
+        SIMDE_FLOAT16_VALUE(    36.34), SIMDE_FLOAT16_VALUE(    114.6), SIMDE_FLOAT16_VALUE(    -85.2), SIMDE_FLOAT16_VALUE(     35.4),
+        SIMDE_FLOAT16_VALUE(    3.387), SIMDE_FLOAT16_VALUE(   -83.56), SIMDE_FLOAT16_VALUE(    44.16), SIMDE_FLOAT16_VALUE(   -56.78),
+        SIMDE_FLOAT16_VALUE(   -111.1), SIMDE_FLOAT16_VALUE(    -4.61), SIMDE_FLOAT16_VALUE(    10.04), SIMDE_FLOAT16_VALUE(     66.7),
+        SIMDE_FLOAT16_VALUE(     69.7), SIMDE_FLOAT16_VALUE(     58.4), SIMDE_FLOAT16_VALUE(    28.08), SIMDE_FLOAT16_VALUE(    -20.9),
+        SIMDE_FLOAT16_VALUE(  -11.195), SIMDE_FLOAT16_VALUE(    -84.7), SIMDE_FLOAT16_VALUE(    -10.8), SIMDE_FLOAT16_VALUE(   -75.94) } },
+    { { SIMDE_FLOAT16_VALUE(   -4.957), SIMDE_FLOAT16_VALUE(  -0.8086), SIMDE_FLOAT16_VALUE(    -5.17), SIMDE_FLOAT16_VALUE(    2.055),
+        SIMDE_FLOAT16_VALUE(    -6.38), SIMDE_FLOAT16_VALUE(    5.426), SIMDE_FLOAT16_VALUE(   -4.758), SIMDE_FLOAT16_VALUE(    2.525),
+        SIMDE_FLOAT16_VALUE(    -2.66), SIMDE_FLOAT16_VALUE(   -5.387), SIMDE_FLOAT16_VALUE(    -7.54), SIMDE_FLOAT16_VALUE(   -9.836),
+        SIMDE_FLOAT16_VALUE(    4.633), SIMDE_FLOAT16_VALUE(    3.752), SIMDE_FLOAT16_VALUE(   -3.826), SIMDE_FLOAT16_VALUE(   -2.074),
+        SIMDE_FLOAT16_VALUE(  0.03778), SIMDE_FLOAT16_VALUE(   -4.164), SIMDE_FLOAT16_VALUE(     9.24), SIMDE_FLOAT16_VALUE(     8.22),
+        SIMDE_FLOAT16_VALUE(    2.139), SIMDE_FLOAT16_VALUE(    3.324), SIMDE_FLOAT16_VALUE(    3.033), SIMDE_FLOAT16_VALUE(    2.344),
+        SIMDE_FLOAT16_VALUE(    6.723), SIMDE_FLOAT16_VALUE(    -3.25), SIMDE_FLOAT16_VALUE(   -1.148), SIMDE_FLOAT16_VALUE(    -4.91),
+        SIMDE_FLOAT16_VALUE(    3.871), SIMDE_FLOAT16_VALUE(     7.83), SIMDE_FLOAT16_VALUE(    5.137), SIMDE_FLOAT16_VALUE(    3.197) },
+      { SIMDE_FLOAT16_VALUE(    6.043), SIMDE_FLOAT16_VALUE(    -6.34), SIMDE_FLOAT16_VALUE(   -1.358), SIMDE_FLOAT16_VALUE(    -2.32),
+        SIMDE_FLOAT16_VALUE(    1.958), SIMDE_FLOAT16_VALUE(   -8.836), SIMDE_FLOAT16_VALUE(    3.312), SIMDE_FLOAT16_VALUE(     7.74),
+        SIMDE_FLOAT16_VALUE(   0.7163), SIMDE_FLOAT16_VALUE(   -4.215), SIMDE_FLOAT16_VALUE(     -9.8), SIMDE_FLOAT16_VALUE(    1.251),
+        SIMDE_FLOAT16_VALUE(    -8.18), SIMDE_FLOAT16_VALUE(   -1.813), SIMDE_FLOAT16_VALUE(   -7.277), SIMDE_FLOAT16_VALUE(    7.176),
+        SIMDE_FLOAT16_VALUE(     3.43), SIMDE_FLOAT16_VALUE(    4.383), SIMDE_FLOAT16_VALUE(     4.49), SIMDE_FLOAT16_VALUE(     4.63),
+        SIMDE_FLOAT16_VALUE(   -2.764), SIMDE_FLOAT16_VALUE(   -0.764), SIMDE_FLOAT16_VALUE(     7.65), SIMDE_FLOAT16_VALUE(     8.99),
+        SIMDE_FLOAT16_VALUE(   -3.879), SIMDE_FLOAT16_VALUE(   -6.684), SIMDE_FLOAT16_VALUE(    4.137), SIMDE_FLOAT16_VALUE(   0.1537),
+        SIMDE_FLOAT16_VALUE(     5.16), SIMDE_FLOAT16_VALUE(    1.437), SIMDE_FLOAT16_VALUE(  -0.8804), SIMDE_FLOAT16_VALUE(    7.445) },
+      { SIMDE_FLOAT16_VALUE(    34.34), SIMDE_FLOAT16_VALUE(   -49.28), SIMDE_FLOAT16_VALUE(    -35.2), SIMDE_FLOAT16_VALUE(    -26.8),
+        SIMDE_FLOAT16_VALUE(     54.6), SIMDE_FLOAT16_VALUE(    18.89), SIMDE_FLOAT16_VALUE(     23.8), SIMDE_FLOAT16_VALUE(   -76.44),
+        SIMDE_FLOAT16_VALUE(    -57.0), SIMDE_FLOAT16_VALUE(   -35.03), SIMDE_FLOAT16_VALUE(    -33.9), SIMDE_FLOAT16_VALUE(    -64.3),
+        SIMDE_FLOAT16_VALUE(     88.1), SIMDE_FLOAT16_VALUE(    -80.8), SIMDE_FLOAT16_VALUE(   -14.49), SIMDE_FLOAT16_VALUE(    -40.2),
+        SIMDE_FLOAT16_VALUE(    -3.61), SIMDE_FLOAT16_VALUE(    -44.4), SIMDE_FLOAT16_VALUE(   -26.62), SIMDE_FLOAT16_VALUE(    -9.89),
+        SIMDE_FLOAT16_VALUE(     38.5), SIMDE_FLOAT16_VALUE(     87.1), SIMDE_FLOAT16_VALUE(    -71.8), SIMDE_FLOAT16_VALUE(   -57.25),
+        SIMDE_FLOAT16_VALUE(     23.8), SIMDE_FLOAT16_VALUE(    22.12), SIMDE_FLOAT16_VALUE(    30.81), SIMDE_FLOAT16_VALUE(   -44.06),
+        SIMDE_FLOAT16_VALUE(    5.945), SIMDE_FLOAT16_VALUE(    28.42), SIMDE_FLOAT16_VALUE(    -75.7), SIMDE_FLOAT16_VALUE(    -74.1) },
+      UINT32_C(3668956460),
+      { SIMDE_FLOAT16_VALUE(    34.34), SIMDE_FLOAT16_VALUE(   -49.28), SIMDE_FLOAT16_VALUE(   -28.16), SIMDE_FLOAT16_VALUE(   -31.56),
+        SIMDE_FLOAT16_VALUE(     54.6), SIMDE_FLOAT16_VALUE(   -29.05), SIMDE_FLOAT16_VALUE(     23.8), SIMDE_FLOAT16_VALUE(   -76.44),
+        SIMDE_FLOAT16_VALUE(    -58.9), SIMDE_FLOAT16_VALUE(   -35.03), SIMDE_FLOAT16_VALUE(    39.94), SIMDE_FLOAT16_VALUE(    -64.3),
+        SIMDE_FLOAT16_VALUE(    50.22), SIMDE_FLOAT16_VALUE(    -80.8), SIMDE_FLOAT16_VALUE(    13.35), SIMDE_FLOAT16_VALUE(   -55.06),
+        SIMDE_FLOAT16_VALUE(    -3.48), SIMDE_FLOAT16_VALUE(   -62.66), SIMDE_FLOAT16_VALUE(    14.86), SIMDE_FLOAT16_VALUE(    28.16),
+        SIMDE_FLOAT16_VALUE(     38.5), SIMDE_FLOAT16_VALUE(    84.56), SIMDE_FLOAT16_VALUE(    -71.8), SIMDE_FLOAT16_VALUE(    -36.2),
+        SIMDE_FLOAT16_VALUE(     23.8), SIMDE_FLOAT16_VALUE(    43.84), SIMDE_FLOAT16_VALUE(    30.81), SIMDE_FLOAT16_VALUE(    -44.8),
+        SIMDE_FLOAT16_VALUE(    25.92), SIMDE_FLOAT16_VALUE(    28.42), SIMDE_FLOAT16_VALUE(    -80.2), SIMDE_FLOAT16_VALUE(    -50.3) } },
+    { { SIMDE_FLOAT16_VALUE(   -8.625), SIMDE_FLOAT16_VALUE(   -3.637), SIMDE_FLOAT16_VALUE(    -8.34), SIMDE_FLOAT16_VALUE(    -9.92),
+        SIMDE_FLOAT16_VALUE(     2.96), SIMDE_FLOAT16_VALUE(    6.016), SIMDE_FLOAT16_VALUE(    4.066), SIMDE_FLOAT16_VALUE(     9.95),
+        SIMDE_FLOAT16_VALUE(   -3.166), SIMDE_FLOAT16_VALUE(    9.484), SIMDE_FLOAT16_VALUE(   -5.953), SIMDE_FLOAT16_VALUE(   -3.812),
+        SIMDE_FLOAT16_VALUE(   -3.225), SIMDE_FLOAT16_VALUE(   0.8857), SIMDE_FLOAT16_VALUE( -0.03122), SIMDE_FLOAT16_VALUE(    4.168),
+        SIMDE_FLOAT16_VALUE(    -6.29), SIMDE_FLOAT16_VALUE(   0.4668), SIMDE_FLOAT16_VALUE(    -4.38), SIMDE_FLOAT16_VALUE(     6.73),
+        SIMDE_FLOAT16_VALUE(    -8.39), SIMDE_FLOAT16_VALUE(   -4.395), SIMDE_FLOAT16_VALUE(    5.004), SIMDE_FLOAT16_VALUE(    4.918),
+        SIMDE_FLOAT16_VALUE(    0.393), SIMDE_FLOAT16_VALUE(     8.04), SIMDE_FLOAT16_VALUE(   0.5024), SIMDE_FLOAT16_VALUE(     2.85),
+        SIMDE_FLOAT16_VALUE(   -3.469), SIMDE_FLOAT16_VALUE(    2.521), SIMDE_FLOAT16_VALUE(   -1.848), SIMDE_FLOAT16_VALUE(   -2.123) },
+      { SIMDE_FLOAT16_VALUE(   -8.805), SIMDE_FLOAT16_VALUE(   -2.879), SIMDE_FLOAT16_VALUE(    5.625), SIMDE_FLOAT16_VALUE(      3.6),
+        SIMDE_FLOAT16_VALUE(    -7.69), SIMDE_FLOAT16_VALUE(    1.786), SIMDE_FLOAT16_VALUE(   -0.496), SIMDE_FLOAT16_VALUE(   -6.664),
+        SIMDE_FLOAT16_VALUE(    1.725), SIMDE_FLOAT16_VALUE(     8.58), SIMDE_FLOAT16_VALUE(    2.355), SIMDE_FLOAT16_VALUE(    5.227),
+        SIMDE_FLOAT16_VALUE(   -1.928), SIMDE_FLOAT16_VALUE(   -0.968), SIMDE_FLOAT16_VALUE(  -0.4824), SIMDE_FLOAT16_VALUE(    -5.45),
+        SIMDE_FLOAT16_VALUE(    8.305), SIMDE_FLOAT16_VALUE(    3.846), SIMDE_FLOAT16_VALUE(     9.01), SIMDE_FLOAT16_VALUE(    -3.07),
+        SIMDE_FLOAT16_VALUE(    4.996), SIMDE_FLOAT16_VALUE(   -3.504), SIMDE_FLOAT16_VALUE(    4.242), SIMDE_FLOAT16_VALUE(    6.625),
+        SIMDE_FLOAT16_VALUE(   0.3252), SIMDE_FLOAT16_VALUE(    -4.05), SIMDE_FLOAT16_VALUE(    -8.64), SIMDE_FLOAT16_VALUE(     9.61),
+        SIMDE_FLOAT16_VALUE(   -4.133), SIMDE_FLOAT16_VALUE(   -2.531), SIMDE_FLOAT16_VALUE(    6.863), SIMDE_FLOAT16_VALUE(   -4.004) },
+      { SIMDE_FLOAT16_VALUE(   -27.45), SIMDE_FLOAT16_VALUE(    88.25), SIMDE_FLOAT16_VALUE(   -97.06), SIMDE_FLOAT16_VALUE(    31.33),
+        SIMDE_FLOAT16_VALUE(     41.8), SIMDE_FLOAT16_VALUE(   -3.535), SIMDE_FLOAT16_VALUE(     75.7), SIMDE_FLOAT16_VALUE(     74.5),
+        SIMDE_FLOAT16_VALUE(    3.684), SIMDE_FLOAT16_VALUE(    -73.4), SIMDE_FLOAT16_VALUE(    -86.6), SIMDE_FLOAT16_VALUE(    21.88),
+        SIMDE_FLOAT16_VALUE(    -7.53), SIMDE_FLOAT16_VALUE(    35.56), SIMDE_FLOAT16_VALUE(   -32.84), SIMDE_FLOAT16_VALUE(   -29.55),
+        SIMDE_FLOAT16_VALUE(   -21.31), SIMDE_FLOAT16_VALUE(   -79.75), SIMDE_FLOAT16_VALUE(     94.3), SIMDE_FLOAT16_VALUE(     88.5),
+        SIMDE_FLOAT16_VALUE(    14.88), SIMDE_FLOAT16_VALUE(   -17.75), SIMDE_FLOAT16_VALUE(    -66.0), SIMDE_FLOAT16_VALUE(    2.246),
+        SIMDE_FLOAT16_VALUE(   -69.25), SIMDE_FLOAT16_VALUE(    28.73), SIMDE_FLOAT16_VALUE(    -95.0), SIMDE_FLOAT16_VALUE(   -40.38),
+        SIMDE_FLOAT16_VALUE(    71.25), SIMDE_FLOAT16_VALUE(     6.38), SIMDE_FLOAT16_VALUE(    -57.9), SIMDE_FLOAT16_VALUE(    45.53) },
+      UINT32_C(203898925),
+      { SIMDE_FLOAT16_VALUE(     48.5), SIMDE_FLOAT16_VALUE(    88.25), SIMDE_FLOAT16_VALUE(   -144.0), SIMDE_FLOAT16_VALUE(   -4.387),
+        SIMDE_FLOAT16_VALUE(     41.8), SIMDE_FLOAT16_VALUE(     7.21), SIMDE_FLOAT16_VALUE(     75.7), SIMDE_FLOAT16_VALUE(     74.5),
+        SIMDE_FLOAT16_VALUE(    3.684), SIMDE_FLOAT16_VALUE(    -73.4), SIMDE_FLOAT16_VALUE(    -86.6), SIMDE_FLOAT16_VALUE(    21.88),
+        SIMDE_FLOAT16_VALUE(    -7.53), SIMDE_FLOAT16_VALUE(    35.56), SIMDE_FLOAT16_VALUE(   -32.84), SIMDE_FLOAT16_VALUE(   -29.55),
+        SIMDE_FLOAT16_VALUE(   -73.56), SIMDE_FLOAT16_VALUE(   -77.94), SIMDE_FLOAT16_VALUE(    54.88), SIMDE_FLOAT16_VALUE(     88.5),
+        SIMDE_FLOAT16_VALUE(    14.88), SIMDE_FLOAT16_VALUE(   -2.352), SIMDE_FLOAT16_VALUE(    -66.0), SIMDE_FLOAT16_VALUE(    2.246),
+        SIMDE_FLOAT16_VALUE(   -69.25), SIMDE_FLOAT16_VALUE(    28.73), SIMDE_FLOAT16_VALUE(    -99.3), SIMDE_FLOAT16_VALUE(   -12.99),
+        SIMDE_FLOAT16_VALUE(    71.25), SIMDE_FLOAT16_VALUE(     6.38), SIMDE_FLOAT16_VALUE(    -57.9), SIMDE_FLOAT16_VALUE(    45.53) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512h a = simde_mm512_loadu_ph(test_vec[i].a);
+    simde__m512h b = simde_mm512_loadu_ph(test_vec[i].b);
+    simde__m512h c = simde_mm512_loadu_ph(test_vec[i].c);
+    simde__m512h r = simde_mm512_mask3_fmadd_ph(a, b, c, test_vec[i].k);
+    simde_test_x86_assert_equal_f16x32(r, simde_mm512_loadu_ph(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm512_maskz_fmadd_ph (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 k;
+    const simde_float16 a[32];
+    const simde_float16 b[32];
+    const simde_float16 c[32];
+    const simde_float16 r[32];
+  } test_vec[] = {
+    { UINT32_C(587979866),
+      { SIMDE_FLOAT16_VALUE(     2.65), SIMDE_FLOAT16_VALUE(    -5.52), SIMDE_FLOAT16_VALUE(    3.807), SIMDE_FLOAT16_VALUE(    -8.56),
+        SIMDE_FLOAT16_VALUE(  -0.1133), SIMDE_FLOAT16_VALUE(   -2.787), SIMDE_FLOAT16_VALUE(    -1.29), SIMDE_FLOAT16_VALUE(    0.818),
+        SIMDE_FLOAT16_VALUE(   -1.692), SIMDE_FLOAT16_VALUE(   -3.635), SIMDE_FLOAT16_VALUE(      7.2), SIMDE_FLOAT16_VALUE(     9.52),
+        SIMDE_FLOAT16_VALUE(     8.57), SIMDE_FLOAT16_VALUE(    7.867), SIMDE_FLOAT16_VALUE(   -4.746), SIMDE_FLOAT16_VALUE(   0.4119),
+        SIMDE_FLOAT16_VALUE(     9.79), SIMDE_FLOAT16_VALUE(   -9.055), SIMDE_FLOAT16_VALUE(   0.3203), SIMDE_FLOAT16_VALUE(    7.254),
+        SIMDE_FLOAT16_VALUE(   0.3413), SIMDE_FLOAT16_VALUE(    2.764), SIMDE_FLOAT16_VALUE(     9.38), SIMDE_FLOAT16_VALUE(     9.84),
+        SIMDE_FLOAT16_VALUE(     7.14), SIMDE_FLOAT16_VALUE(   -2.377), SIMDE_FLOAT16_VALUE(     0.18), SIMDE_FLOAT16_VALUE(      4.1),
+        SIMDE_FLOAT16_VALUE(    -9.86), SIMDE_FLOAT16_VALUE(    6.383), SIMDE_FLOAT16_VALUE(    4.582), SIMDE_FLOAT16_VALUE(     9.06) },
+      { SIMDE_FLOAT16_VALUE(   -4.125), SIMDE_FLOAT16_VALUE(    7.195), SIMDE_FLOAT16_VALUE(    1.348), SIMDE_FLOAT16_VALUE(   -5.043),
+        SIMDE_FLOAT16_VALUE(  0.10474), SIMDE_FLOAT16_VALUE(   -2.918), SIMDE_FLOAT16_VALUE(    -3.01), SIMDE_FLOAT16_VALUE(    -8.43),
+        SIMDE_FLOAT16_VALUE(    2.486), SIMDE_FLOAT16_VALUE(   -4.457), SIMDE_FLOAT16_VALUE(   -1.323), SIMDE_FLOAT16_VALUE(   -0.551),
+        SIMDE_FLOAT16_VALUE(   -2.521), SIMDE_FLOAT16_VALUE(  -0.1428), SIMDE_FLOAT16_VALUE(    -5.96), SIMDE_FLOAT16_VALUE(   -0.528),
+        SIMDE_FLOAT16_VALUE(    4.105), SIMDE_FLOAT16_VALUE(     3.94), SIMDE_FLOAT16_VALUE(    -6.62), SIMDE_FLOAT16_VALUE(   -4.234),
+        SIMDE_FLOAT16_VALUE(     9.46), SIMDE_FLOAT16_VALUE(    7.027), SIMDE_FLOAT16_VALUE(    6.934), SIMDE_FLOAT16_VALUE(      9.9),
+        SIMDE_FLOAT16_VALUE(   0.8823), SIMDE_FLOAT16_VALUE(   -3.275), SIMDE_FLOAT16_VALUE(     6.41), SIMDE_FLOAT16_VALUE(     5.37),
+        SIMDE_FLOAT16_VALUE(    2.379), SIMDE_FLOAT16_VALUE(   -1.477), SIMDE_FLOAT16_VALUE(    4.035), SIMDE_FLOAT16_VALUE(    -8.02) },
+      { SIMDE_FLOAT16_VALUE(     78.7), SIMDE_FLOAT16_VALUE(     99.9), SIMDE_FLOAT16_VALUE(   -33.28), SIMDE_FLOAT16_VALUE(   -59.38),
+        SIMDE_FLOAT16_VALUE(     57.7), SIMDE_FLOAT16_VALUE(   -49.62), SIMDE_FLOAT16_VALUE(   -42.66), SIMDE_FLOAT16_VALUE(   -21.69),
+        SIMDE_FLOAT16_VALUE(    -89.6), SIMDE_FLOAT16_VALUE(   -75.25), SIMDE_FLOAT16_VALUE(   -57.56), SIMDE_FLOAT16_VALUE(    37.16),
+        SIMDE_FLOAT16_VALUE(    -51.1), SIMDE_FLOAT16_VALUE(    -89.7), SIMDE_FLOAT16_VALUE(    -79.8), SIMDE_FLOAT16_VALUE(     9.06),
+        SIMDE_FLOAT16_VALUE(    80.44), SIMDE_FLOAT16_VALUE(    9.914), SIMDE_FLOAT16_VALUE(   -77.56), SIMDE_FLOAT16_VALUE(   -62.12),
+        SIMDE_FLOAT16_VALUE(   -53.22), SIMDE_FLOAT16_VALUE(    91.25), SIMDE_FLOAT16_VALUE(    86.44), SIMDE_FLOAT16_VALUE(     55.0),
+        SIMDE_FLOAT16_VALUE(     94.7), SIMDE_FLOAT16_VALUE(    95.44), SIMDE_FLOAT16_VALUE(     53.2), SIMDE_FLOAT16_VALUE(    59.03),
+        SIMDE_FLOAT16_VALUE(    -70.0), SIMDE_FLOAT16_VALUE(     74.0), SIMDE_FLOAT16_VALUE(    58.88), SIMDE_FLOAT16_VALUE(    86.25) },
+      { SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(    60.16), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(   -16.19),
+        SIMDE_FLOAT16_VALUE(     57.7), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(   -38.78), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(   -67.06), SIMDE_FLOAT16_VALUE(     31.9),
+        SIMDE_FLOAT16_VALUE(    -72.7), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(   -51.53), SIMDE_FLOAT16_VALUE(     8.84),
+        SIMDE_FLOAT16_VALUE(    120.6), SIMDE_FLOAT16_VALUE(   -25.75), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(    -92.8),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(    101.0), SIMDE_FLOAT16_VALUE(   103.25), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(    64.56), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0) } },
+    { UINT32_C(2389080337),
+      { SIMDE_FLOAT16_VALUE(      7.5), SIMDE_FLOAT16_VALUE(   -2.436), SIMDE_FLOAT16_VALUE(   -1.776), SIMDE_FLOAT16_VALUE(   -3.477),
+        SIMDE_FLOAT16_VALUE(   -3.291), SIMDE_FLOAT16_VALUE(    -7.43), SIMDE_FLOAT16_VALUE(   0.1537), SIMDE_FLOAT16_VALUE(     8.43),
+        SIMDE_FLOAT16_VALUE(    1.016), SIMDE_FLOAT16_VALUE(    3.787), SIMDE_FLOAT16_VALUE(   -1.004), SIMDE_FLOAT16_VALUE(    5.152),
+        SIMDE_FLOAT16_VALUE(    -8.78), SIMDE_FLOAT16_VALUE(     4.44), SIMDE_FLOAT16_VALUE(    8.055), SIMDE_FLOAT16_VALUE(     7.11),
+        SIMDE_FLOAT16_VALUE(    -3.41), SIMDE_FLOAT16_VALUE(   -3.338), SIMDE_FLOAT16_VALUE(    5.434), SIMDE_FLOAT16_VALUE(    3.713),
+        SIMDE_FLOAT16_VALUE(    -9.84), SIMDE_FLOAT16_VALUE(   -8.836), SIMDE_FLOAT16_VALUE(   -2.656), SIMDE_FLOAT16_VALUE(    6.207),
+        SIMDE_FLOAT16_VALUE(    8.414), SIMDE_FLOAT16_VALUE(   -7.082), SIMDE_FLOAT16_VALUE(    -8.18), SIMDE_FLOAT16_VALUE(   -1.337),
+        SIMDE_FLOAT16_VALUE(    -4.07), SIMDE_FLOAT16_VALUE(     5.59), SIMDE_FLOAT16_VALUE(     2.48), SIMDE_FLOAT16_VALUE(   -6.445) },
+      { SIMDE_FLOAT16_VALUE(    -2.81), SIMDE_FLOAT16_VALUE(   -0.734), SIMDE_FLOAT16_VALUE(     4.56), SIMDE_FLOAT16_VALUE(     7.05),
+        SIMDE_FLOAT16_VALUE(   -1.453), SIMDE_FLOAT16_VALUE(     8.18), SIMDE_FLOAT16_VALUE(     7.51), SIMDE_FLOAT16_VALUE(     8.27),
+        SIMDE_FLOAT16_VALUE(   -5.832), SIMDE_FLOAT16_VALUE(    -9.43), SIMDE_FLOAT16_VALUE(    -5.24), SIMDE_FLOAT16_VALUE(   0.1302),
+        SIMDE_FLOAT16_VALUE(     6.79), SIMDE_FLOAT16_VALUE(   -2.885), SIMDE_FLOAT16_VALUE(  -0.4285), SIMDE_FLOAT16_VALUE(     4.51),
+        SIMDE_FLOAT16_VALUE(   0.3125), SIMDE_FLOAT16_VALUE(    -8.43), SIMDE_FLOAT16_VALUE(   -6.523), SIMDE_FLOAT16_VALUE(    1.022),
+        SIMDE_FLOAT16_VALUE(    -8.87), SIMDE_FLOAT16_VALUE(   -8.586), SIMDE_FLOAT16_VALUE(    7.234), SIMDE_FLOAT16_VALUE(    7.137),
+        SIMDE_FLOAT16_VALUE(   -7.645), SIMDE_FLOAT16_VALUE(   -0.325), SIMDE_FLOAT16_VALUE(   -0.662), SIMDE_FLOAT16_VALUE(    -9.09),
+        SIMDE_FLOAT16_VALUE(    7.305), SIMDE_FLOAT16_VALUE(     8.67), SIMDE_FLOAT16_VALUE(   -7.758), SIMDE_FLOAT16_VALUE(    3.309) },
+      { SIMDE_FLOAT16_VALUE(     91.6), SIMDE_FLOAT16_VALUE(    -71.6), SIMDE_FLOAT16_VALUE(    -38.6), SIMDE_FLOAT16_VALUE(   -39.56),
+        SIMDE_FLOAT16_VALUE(    -40.8), SIMDE_FLOAT16_VALUE(    -84.8), SIMDE_FLOAT16_VALUE(   -18.72), SIMDE_FLOAT16_VALUE(   15.484),
+        SIMDE_FLOAT16_VALUE(     83.7), SIMDE_FLOAT16_VALUE(   -4.805), SIMDE_FLOAT16_VALUE(   -28.53), SIMDE_FLOAT16_VALUE(    -99.5),
+        SIMDE_FLOAT16_VALUE(    -2.74), SIMDE_FLOAT16_VALUE(   -14.39), SIMDE_FLOAT16_VALUE(    33.94), SIMDE_FLOAT16_VALUE(  -0.4612),
+        SIMDE_FLOAT16_VALUE(    28.53), SIMDE_FLOAT16_VALUE(   -52.72), SIMDE_FLOAT16_VALUE(   -9.695), SIMDE_FLOAT16_VALUE(    52.78),
+        SIMDE_FLOAT16_VALUE(     69.8), SIMDE_FLOAT16_VALUE(   -33.94), SIMDE_FLOAT16_VALUE(   -88.56), SIMDE_FLOAT16_VALUE(     84.2),
+        SIMDE_FLOAT16_VALUE(   -33.78), SIMDE_FLOAT16_VALUE(   -2.877), SIMDE_FLOAT16_VALUE(    1.831), SIMDE_FLOAT16_VALUE(    -96.9),
+        SIMDE_FLOAT16_VALUE(    -72.3), SIMDE_FLOAT16_VALUE(    90.44), SIMDE_FLOAT16_VALUE(    85.94), SIMDE_FLOAT16_VALUE(    15.92) },
+      { SIMDE_FLOAT16_VALUE(    70.56), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(   -36.03), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(    77.75), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(    -98.8),
+        SIMDE_FLOAT16_VALUE(   -62.34), SIMDE_FLOAT16_VALUE(    -27.2), SIMDE_FLOAT16_VALUE(    30.48), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(   -24.58), SIMDE_FLOAT16_VALUE(   -45.16), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(    41.94), SIMDE_FLOAT16_VALUE(  -107.75), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(  -0.5757), SIMDE_FLOAT16_VALUE(    7.246), SIMDE_FLOAT16_VALUE(    -84.7),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(   -5.402) } },
+    { UINT32_C(3226403343),
+      { SIMDE_FLOAT16_VALUE(    9.734), SIMDE_FLOAT16_VALUE(  -0.3665), SIMDE_FLOAT16_VALUE(      8.0), SIMDE_FLOAT16_VALUE(    1.026),
+        SIMDE_FLOAT16_VALUE(   -0.428), SIMDE_FLOAT16_VALUE(    3.826), SIMDE_FLOAT16_VALUE(    9.016), SIMDE_FLOAT16_VALUE(    2.074),
+        SIMDE_FLOAT16_VALUE(      7.7), SIMDE_FLOAT16_VALUE(   -9.945), SIMDE_FLOAT16_VALUE(   -9.445), SIMDE_FLOAT16_VALUE(     -5.2),
+        SIMDE_FLOAT16_VALUE(     7.93), SIMDE_FLOAT16_VALUE(    7.258), SIMDE_FLOAT16_VALUE(    6.426), SIMDE_FLOAT16_VALUE(    5.594),
+        SIMDE_FLOAT16_VALUE(    5.414), SIMDE_FLOAT16_VALUE(     7.55), SIMDE_FLOAT16_VALUE(    2.928), SIMDE_FLOAT16_VALUE(   -5.496),
+        SIMDE_FLOAT16_VALUE(    1.957), SIMDE_FLOAT16_VALUE(     8.51), SIMDE_FLOAT16_VALUE(   -2.076), SIMDE_FLOAT16_VALUE(     3.52),
+        SIMDE_FLOAT16_VALUE(     5.86), SIMDE_FLOAT16_VALUE(    1.644), SIMDE_FLOAT16_VALUE(   -0.549), SIMDE_FLOAT16_VALUE(    -8.65),
+        SIMDE_FLOAT16_VALUE(   -3.203), SIMDE_FLOAT16_VALUE(   0.1239), SIMDE_FLOAT16_VALUE(  -0.9307), SIMDE_FLOAT16_VALUE(   -1.825) },
+      { SIMDE_FLOAT16_VALUE(    -4.98), SIMDE_FLOAT16_VALUE(     7.67), SIMDE_FLOAT16_VALUE(    -9.57), SIMDE_FLOAT16_VALUE(      8.2),
+        SIMDE_FLOAT16_VALUE(   -5.113), SIMDE_FLOAT16_VALUE(     8.64), SIMDE_FLOAT16_VALUE(   -6.926), SIMDE_FLOAT16_VALUE(    -6.92),
+        SIMDE_FLOAT16_VALUE(    -4.51), SIMDE_FLOAT16_VALUE(   -7.414), SIMDE_FLOAT16_VALUE(    1.282), SIMDE_FLOAT16_VALUE(     3.77),
+        SIMDE_FLOAT16_VALUE(   -8.414), SIMDE_FLOAT16_VALUE(     7.73), SIMDE_FLOAT16_VALUE(    -9.96), SIMDE_FLOAT16_VALUE(   -1.211),
+        SIMDE_FLOAT16_VALUE(    -8.43), SIMDE_FLOAT16_VALUE(    -8.97), SIMDE_FLOAT16_VALUE(    6.895), SIMDE_FLOAT16_VALUE(    -8.32),
+        SIMDE_FLOAT16_VALUE(   0.3662), SIMDE_FLOAT16_VALUE(    -9.73), SIMDE_FLOAT16_VALUE(    -8.25), SIMDE_FLOAT16_VALUE(     6.86),
+        SIMDE_FLOAT16_VALUE(    -8.92), SIMDE_FLOAT16_VALUE(   0.7324), SIMDE_FLOAT16_VALUE(    6.566), SIMDE_FLOAT16_VALUE(   -1.812),
+        SIMDE_FLOAT16_VALUE(   -5.574), SIMDE_FLOAT16_VALUE(   -7.227), SIMDE_FLOAT16_VALUE(   -4.727), SIMDE_FLOAT16_VALUE(    6.543) },
+      { SIMDE_FLOAT16_VALUE(    -96.7), SIMDE_FLOAT16_VALUE(   -12.86), SIMDE_FLOAT16_VALUE(    -35.3), SIMDE_FLOAT16_VALUE(    56.56),
+        SIMDE_FLOAT16_VALUE(    -86.6), SIMDE_FLOAT16_VALUE(     68.4), SIMDE_FLOAT16_VALUE(   -1.063), SIMDE_FLOAT16_VALUE(    -9.28),
+        SIMDE_FLOAT16_VALUE(    -47.3), SIMDE_FLOAT16_VALUE(   -58.66), SIMDE_FLOAT16_VALUE(    13.22), SIMDE_FLOAT16_VALUE(    -93.1),
+        SIMDE_FLOAT16_VALUE(    30.38), SIMDE_FLOAT16_VALUE(    53.56), SIMDE_FLOAT16_VALUE(    -14.1), SIMDE_FLOAT16_VALUE(    98.75),
+        SIMDE_FLOAT16_VALUE(    83.06), SIMDE_FLOAT16_VALUE(   -24.03), SIMDE_FLOAT16_VALUE(   -68.56), SIMDE_FLOAT16_VALUE(    92.06),
+        SIMDE_FLOAT16_VALUE(     7.17), SIMDE_FLOAT16_VALUE(    3.148), SIMDE_FLOAT16_VALUE(    42.94), SIMDE_FLOAT16_VALUE(    -65.7),
+        SIMDE_FLOAT16_VALUE(    -98.0), SIMDE_FLOAT16_VALUE(   -39.75), SIMDE_FLOAT16_VALUE(    -81.9), SIMDE_FLOAT16_VALUE(    33.94),
+        SIMDE_FLOAT16_VALUE(     68.4), SIMDE_FLOAT16_VALUE(   -22.06), SIMDE_FLOAT16_VALUE(    3.795), SIMDE_FLOAT16_VALUE(     89.3) },
+      { SIMDE_FLOAT16_VALUE(   -145.1), SIMDE_FLOAT16_VALUE(   -15.67), SIMDE_FLOAT16_VALUE(   -111.9), SIMDE_FLOAT16_VALUE(     65.0),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(    15.08), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(    37.44), SIMDE_FLOAT16_VALUE(   -91.75), SIMDE_FLOAT16_VALUE(   -48.38), SIMDE_FLOAT16_VALUE(    137.8),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(    60.06), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(    8.195), SIMDE_FLOAT16_VALUE(     77.4) } },
+    { UINT32_C(2450537218),
+      { SIMDE_FLOAT16_VALUE(    3.895), SIMDE_FLOAT16_VALUE(     8.61), SIMDE_FLOAT16_VALUE(   -5.883), SIMDE_FLOAT16_VALUE(    -5.98),
+        SIMDE_FLOAT16_VALUE(      8.0), SIMDE_FLOAT16_VALUE(    -5.41), SIMDE_FLOAT16_VALUE(   -8.086), SIMDE_FLOAT16_VALUE(    -6.53),
+        SIMDE_FLOAT16_VALUE(   -5.492), SIMDE_FLOAT16_VALUE(   -7.223), SIMDE_FLOAT16_VALUE(    5.777), SIMDE_FLOAT16_VALUE(   -6.902),
+        SIMDE_FLOAT16_VALUE(    7.797), SIMDE_FLOAT16_VALUE(   -1.154), SIMDE_FLOAT16_VALUE(    -2.24), SIMDE_FLOAT16_VALUE(   -5.586),
+        SIMDE_FLOAT16_VALUE(    3.396), SIMDE_FLOAT16_VALUE(   0.3416), SIMDE_FLOAT16_VALUE(     -3.2), SIMDE_FLOAT16_VALUE(     8.04),
+        SIMDE_FLOAT16_VALUE(   0.2299), SIMDE_FLOAT16_VALUE(   -3.684), SIMDE_FLOAT16_VALUE(    3.537), SIMDE_FLOAT16_VALUE(   -6.895),
+        SIMDE_FLOAT16_VALUE(     9.74), SIMDE_FLOAT16_VALUE(   -1.039), SIMDE_FLOAT16_VALUE(    -8.04), SIMDE_FLOAT16_VALUE(     6.19),
+        SIMDE_FLOAT16_VALUE(    4.418), SIMDE_FLOAT16_VALUE(   -6.453), SIMDE_FLOAT16_VALUE(     9.51), SIMDE_FLOAT16_VALUE(      6.4) },
+      { SIMDE_FLOAT16_VALUE(   -0.513), SIMDE_FLOAT16_VALUE(     -5.8), SIMDE_FLOAT16_VALUE(    4.074), SIMDE_FLOAT16_VALUE(   -1.513),
+        SIMDE_FLOAT16_VALUE(    -2.27), SIMDE_FLOAT16_VALUE(   -9.805), SIMDE_FLOAT16_VALUE(    8.625), SIMDE_FLOAT16_VALUE(   -7.223),
+        SIMDE_FLOAT16_VALUE(    5.336), SIMDE_FLOAT16_VALUE(     9.45), SIMDE_FLOAT16_VALUE(   -7.223), SIMDE_FLOAT16_VALUE(   -4.414),
+        SIMDE_FLOAT16_VALUE(    -5.18), SIMDE_FLOAT16_VALUE(    -3.86), SIMDE_FLOAT16_VALUE(    6.984), SIMDE_FLOAT16_VALUE(   0.8037),
+        SIMDE_FLOAT16_VALUE(     9.52), SIMDE_FLOAT16_VALUE(   -1.779), SIMDE_FLOAT16_VALUE(   0.4207), SIMDE_FLOAT16_VALUE(   -6.613),
+        SIMDE_FLOAT16_VALUE(  -0.1417), SIMDE_FLOAT16_VALUE(    -7.68), SIMDE_FLOAT16_VALUE(    1.792), SIMDE_FLOAT16_VALUE(     7.44),
+        SIMDE_FLOAT16_VALUE(    -5.49), SIMDE_FLOAT16_VALUE(    -8.83), SIMDE_FLOAT16_VALUE(   -3.982), SIMDE_FLOAT16_VALUE(     8.41),
+        SIMDE_FLOAT16_VALUE(   -6.875), SIMDE_FLOAT16_VALUE(  -0.4353), SIMDE_FLOAT16_VALUE(    5.605), SIMDE_FLOAT16_VALUE(     8.43) },
+      { SIMDE_FLOAT16_VALUE(     64.4), SIMDE_FLOAT16_VALUE(     77.4), SIMDE_FLOAT16_VALUE(     50.3), SIMDE_FLOAT16_VALUE(   -64.94),
+        SIMDE_FLOAT16_VALUE(   -1.618), SIMDE_FLOAT16_VALUE(    -38.9), SIMDE_FLOAT16_VALUE(    12.49), SIMDE_FLOAT16_VALUE(     45.8),
+        SIMDE_FLOAT16_VALUE(   -25.28), SIMDE_FLOAT16_VALUE(    72.25), SIMDE_FLOAT16_VALUE(    -95.7), SIMDE_FLOAT16_VALUE(    -94.2),
+        SIMDE_FLOAT16_VALUE(    -79.8), SIMDE_FLOAT16_VALUE(   -62.88), SIMDE_FLOAT16_VALUE(    -97.5), SIMDE_FLOAT16_VALUE(    4.816),
+        SIMDE_FLOAT16_VALUE(    97.25), SIMDE_FLOAT16_VALUE(   -21.64), SIMDE_FLOAT16_VALUE(   -58.97), SIMDE_FLOAT16_VALUE(    -43.4),
+        SIMDE_FLOAT16_VALUE(    36.56), SIMDE_FLOAT16_VALUE(   -13.62), SIMDE_FLOAT16_VALUE(    90.75), SIMDE_FLOAT16_VALUE(    4.156),
+        SIMDE_FLOAT16_VALUE(    38.03), SIMDE_FLOAT16_VALUE(   -37.84), SIMDE_FLOAT16_VALUE(    7.973), SIMDE_FLOAT16_VALUE(   -17.33),
+        SIMDE_FLOAT16_VALUE(   -37.84), SIMDE_FLOAT16_VALUE(    91.44), SIMDE_FLOAT16_VALUE(     5.92), SIMDE_FLOAT16_VALUE(   -34.22) },
+      { SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(    27.44), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(    -54.6), SIMDE_FLOAT16_VALUE(    3.973), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(   -63.72),
+        SIMDE_FLOAT16_VALUE(   -120.2), SIMDE_FLOAT16_VALUE(    -58.4), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(    36.53), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(   -28.67), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0),
+        SIMDE_FLOAT16_VALUE(    -68.2), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(      0.0), SIMDE_FLOAT16_VALUE(    19.72) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512h a = simde_mm512_loadu_ph(test_vec[i].a);
+    simde__m512h b = simde_mm512_loadu_ph(test_vec[i].b);
+    simde__m512h c = simde_mm512_loadu_ph(test_vec[i].c);
+    simde__m512h r = simde_mm512_maskz_fmadd_ph(test_vec[i].k, a, b, c);
+    simde_test_x86_assert_equal_f16x32(r, simde_mm512_loadu_ph(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
 SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_fmadd_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_fmadd_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_fmadd_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_fmadd_pd)
+
+  #if defined(SIMDE_FLOAT16_IS_SCALAR)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm_fmadd_ph)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm256_fmadd_ph)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm512_fmadd_ph)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_fmadd_ph)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask3_fmadd_ph)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_fmadd_ph)
+  #endif
 SIMDE_TEST_FUNC_LIST_END
 
 #include <test/x86/avx512/test-avx512-footer.h>
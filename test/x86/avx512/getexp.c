@@ -0,0 +1,1469 @@
+#define SIMDE_TEST_X86_AVX512_INSN getexp
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/getexp.h>
+
+static int
+test_simde_mm_getexp_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(  1.0e-40),     -SIMDE_MATH_INFINITYF },
+      {     -SIMDE_MATH_INFINITYF,     -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  -133.00),      SIMDE_MATH_INFINITYF } },
+    #endif
+    #if !defined(SIMDE_FAST_MATH)
+    { {      SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C( -2.5e-39), SIMDE_FLOAT32_C(     0.25), SIMDE_FLOAT32_C(    -0.75) },
+      {      SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  -129.00), SIMDE_FLOAT32_C(    -2.00), SIMDE_FLOAT32_C(    -1.00) } },
+    #endif
+    #if !defined(SIMDE_FAST_MATH)
+    { {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   289.40),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   983.91) },
+      {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     8.00),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     9.00) } },
+    #endif
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT32_C(   570.13),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  -930.48) },
+      { SIMDE_FLOAT32_C(     9.00),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     9.00) } },
+    #endif
+    { { SIMDE_FLOAT32_C(   914.67), SIMDE_FLOAT32_C(   923.48), SIMDE_FLOAT32_C(  -652.56), SIMDE_FLOAT32_C(   323.66) },
+      { SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     8.00) } },
+    { { SIMDE_FLOAT32_C(   979.54), SIMDE_FLOAT32_C(  -528.96), SIMDE_FLOAT32_C(    31.86), SIMDE_FLOAT32_C(   790.26) },
+      { SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(     9.00) } },
+    { { SIMDE_FLOAT32_C(   541.52), SIMDE_FLOAT32_C(   751.45), SIMDE_FLOAT32_C(  -619.81), SIMDE_FLOAT32_C(   518.38) },
+      { SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00) } },
+    { { SIMDE_FLOAT32_C(    -9.55), SIMDE_FLOAT32_C(   671.90), SIMDE_FLOAT32_C(   832.13), SIMDE_FLOAT32_C(  -508.03) },
+      { SIMDE_FLOAT32_C(     3.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     8.00) } },
+    { { SIMDE_FLOAT32_C(   149.99), SIMDE_FLOAT32_C(  -683.78), SIMDE_FLOAT32_C(   955.90), SIMDE_FLOAT32_C(  -870.97) },
+      { SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00) } },
+    { { SIMDE_FLOAT32_C(   735.23), SIMDE_FLOAT32_C(   174.67), SIMDE_FLOAT32_C(   815.12), SIMDE_FLOAT32_C(   684.84) },
+      { SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 r = simde_mm_getexp_ps(a);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  simde_float32 values[8 * sizeof(simde__m128)];
+  simde_test_x86_random_f32x4_full(8, 1, values, -1000.0f, 1000.0f, SIMDE_TEST_VEC_FLOAT_NAN);
+
+  for (size_t i = 0 ; i < 8 ; i++) {
+    simde__m128 a = simde_test_x86_random_extract_f32x4(i, 1, 0, values);
+    simde__m128 r = simde_mm_getexp_ps(a);
+
+    simde_test_x86_write_f32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_mask_getexp_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde_float32 src[4];
+    const simde__mmask8 k;
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT32_C(   721.99), SIMDE_FLOAT32_C(   219.27), SIMDE_FLOAT32_C(  -925.11), SIMDE_FLOAT32_C(  -336.00) },
+      UINT8_C(231),
+      {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    11.69),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  -965.80) },
+      {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     3.00),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  -336.00) } },
+    #endif
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT32_C(  -821.39), SIMDE_FLOAT32_C(   520.68), SIMDE_FLOAT32_C(  -115.65), SIMDE_FLOAT32_C(  -370.24) },
+      UINT8_C( 93),
+      { SIMDE_FLOAT32_C(   -57.99),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  -143.32) },
+      { SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(   520.68),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     7.00) } },
+    #endif
+    { { SIMDE_FLOAT32_C(  -341.83), SIMDE_FLOAT32_C(   551.96), SIMDE_FLOAT32_C(   -86.78), SIMDE_FLOAT32_C(  -777.75) },
+      UINT8_C( 79),
+      { SIMDE_FLOAT32_C(   794.28), SIMDE_FLOAT32_C(  -548.84), SIMDE_FLOAT32_C(  -819.66), SIMDE_FLOAT32_C(   773.82) },
+      { SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00) } },
+    { { SIMDE_FLOAT32_C(   876.87), SIMDE_FLOAT32_C(  -833.48), SIMDE_FLOAT32_C(   997.77), SIMDE_FLOAT32_C(   830.96) },
+      UINT8_C(203),
+      { SIMDE_FLOAT32_C(   -77.81), SIMDE_FLOAT32_C(   212.20), SIMDE_FLOAT32_C(   564.08), SIMDE_FLOAT32_C(  -536.29) },
+      { SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(   997.77), SIMDE_FLOAT32_C(     9.00) } },
+    { { SIMDE_FLOAT32_C(   812.00), SIMDE_FLOAT32_C(  -722.98), SIMDE_FLOAT32_C(  -451.17), SIMDE_FLOAT32_C(   942.44) },
+      UINT8_C(191),
+      { SIMDE_FLOAT32_C(   -36.35), SIMDE_FLOAT32_C(   944.27), SIMDE_FLOAT32_C(   982.10), SIMDE_FLOAT32_C(   954.09) },
+      { SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00) } },
+    { { SIMDE_FLOAT32_C(   444.01), SIMDE_FLOAT32_C(   808.12), SIMDE_FLOAT32_C(  -744.38), SIMDE_FLOAT32_C(  -845.69) },
+      UINT8_C(188),
+      { SIMDE_FLOAT32_C(   616.16), SIMDE_FLOAT32_C(   814.23), SIMDE_FLOAT32_C(  -553.93), SIMDE_FLOAT32_C(  -233.85) },
+      { SIMDE_FLOAT32_C(   444.01), SIMDE_FLOAT32_C(   808.12), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     7.00) } },
+    { { SIMDE_FLOAT32_C(  -703.69), SIMDE_FLOAT32_C(   876.30), SIMDE_FLOAT32_C(  -422.09), SIMDE_FLOAT32_C(  -628.79) },
+      UINT8_C( 32),
+      { SIMDE_FLOAT32_C(  -869.55), SIMDE_FLOAT32_C(  -598.04), SIMDE_FLOAT32_C(  -104.82), SIMDE_FLOAT32_C(   865.68) },
+      { SIMDE_FLOAT32_C(  -703.69), SIMDE_FLOAT32_C(   876.30), SIMDE_FLOAT32_C(  -422.09), SIMDE_FLOAT32_C(  -628.79) } },
+    { { SIMDE_FLOAT32_C(   667.98), SIMDE_FLOAT32_C(  -450.19), SIMDE_FLOAT32_C(  -939.01), SIMDE_FLOAT32_C(  -447.66) },
+      UINT8_C( 67),
+      { SIMDE_FLOAT32_C(   576.63), SIMDE_FLOAT32_C(  -289.70), SIMDE_FLOAT32_C(   550.52), SIMDE_FLOAT32_C(  -959.31) },
+      { SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(  -939.01), SIMDE_FLOAT32_C(  -447.66) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 src = simde_mm_loadu_ps(test_vec[i].src);
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 r = simde_mm_mask_getexp_ps(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  simde_float32 values[8 * sizeof(simde__m128)];
+  simde_test_x86_random_f32x4_full(8, 1, values, -1000.0f, 1000.0f, SIMDE_TEST_VEC_FLOAT_NAN);
+
+  for (size_t i = 0 ; i < 8 ; i++) {
+    simde__m128 src = simde_test_x86_random_f32x4(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128 a = simde_test_x86_random_extract_f32x4(i, 1, 0, values);
+    simde__m128 r = simde_mm_mask_getexp_ps(src, k, a);
+
+    simde_test_x86_write_f32x4(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_maskz_getexp_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT8_C( 74),
+      {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   210.51),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  -324.77) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     8.00) } },
+    #endif
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT8_C(116),
+      { SIMDE_FLOAT32_C(   432.76),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   599.28) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     0.00) } },
+    #endif
+    { UINT8_C( 25),
+      { SIMDE_FLOAT32_C(  -255.03), SIMDE_FLOAT32_C(  -616.95), SIMDE_FLOAT32_C(   381.97), SIMDE_FLOAT32_C(  -443.03) },
+      { SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     8.00) } },
+    { UINT8_C( 67),
+      { SIMDE_FLOAT32_C(  -339.92), SIMDE_FLOAT32_C(   930.80), SIMDE_FLOAT32_C(  -500.59), SIMDE_FLOAT32_C(   339.06) },
+      { SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(102),
+      { SIMDE_FLOAT32_C(   374.81), SIMDE_FLOAT32_C(  -692.47), SIMDE_FLOAT32_C(   594.68), SIMDE_FLOAT32_C(   529.13) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(159),
+      { SIMDE_FLOAT32_C(   666.17), SIMDE_FLOAT32_C(   891.00), SIMDE_FLOAT32_C(   405.43), SIMDE_FLOAT32_C(  -755.91) },
+      { SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00) } },
+    { UINT8_C( 97),
+      { SIMDE_FLOAT32_C(  -737.80), SIMDE_FLOAT32_C(   945.74), SIMDE_FLOAT32_C(   912.07), SIMDE_FLOAT32_C(  -187.98) },
+      { SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C( 55),
+      { SIMDE_FLOAT32_C(  -993.27), SIMDE_FLOAT32_C(  -535.59), SIMDE_FLOAT32_C(   991.59), SIMDE_FLOAT32_C(   768.74) },
+      { SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     0.00) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 r = simde_mm_maskz_getexp_ps(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  simde_float32 values[8 * sizeof(simde__m128)];
+  simde_test_x86_random_f32x4_full(8, 1, values, -1000.0f, 1000.0f, SIMDE_TEST_VEC_FLOAT_NAN);
+
+  for (size_t i = 0 ; i < 8 ; i++) {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128 a = simde_test_x86_random_extract_f32x4(i, 1, 0, values);
+    simde__m128 r = simde_mm_maskz_getexp_ps(k, a);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_getexp_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  -911.07),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  -960.81),
+        SIMDE_FLOAT32_C(  -980.27), SIMDE_FLOAT32_C(   271.68), SIMDE_FLOAT32_C(   378.25), SIMDE_FLOAT32_C(   394.55) },
+      {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     9.00),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     9.00),
+        SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     8.00) } },
+    #endif
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT32_C(   579.21),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   245.39),
+        SIMDE_FLOAT32_C(  -136.07), SIMDE_FLOAT32_C(  -670.89), SIMDE_FLOAT32_C(   489.47), SIMDE_FLOAT32_C(   126.13) },
+      { SIMDE_FLOAT32_C(     9.00),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     6.00) } },
+    #endif
+    { { SIMDE_FLOAT32_C(  -725.15), SIMDE_FLOAT32_C(   401.55), SIMDE_FLOAT32_C(   938.15), SIMDE_FLOAT32_C(  -718.42),
+        SIMDE_FLOAT32_C(   865.96), SIMDE_FLOAT32_C(   929.74), SIMDE_FLOAT32_C(  -949.69), SIMDE_FLOAT32_C(   540.88) },
+      { SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00),
+        SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00) } },
+    { { SIMDE_FLOAT32_C(  -347.13), SIMDE_FLOAT32_C(  -505.72), SIMDE_FLOAT32_C(  -351.44), SIMDE_FLOAT32_C(  -876.80),
+        SIMDE_FLOAT32_C(   490.34), SIMDE_FLOAT32_C(   355.53), SIMDE_FLOAT32_C(  -661.50), SIMDE_FLOAT32_C(  -130.55) },
+      { SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     7.00) } },
+    { { SIMDE_FLOAT32_C(   444.46), SIMDE_FLOAT32_C(   110.77), SIMDE_FLOAT32_C(   -91.36), SIMDE_FLOAT32_C(   464.20),
+        SIMDE_FLOAT32_C(  -617.55), SIMDE_FLOAT32_C(  -713.10), SIMDE_FLOAT32_C(  -141.25), SIMDE_FLOAT32_C(   961.66) },
+      { SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     8.00),
+        SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(     9.00) } },
+    { { SIMDE_FLOAT32_C(   259.83), SIMDE_FLOAT32_C(   782.43), SIMDE_FLOAT32_C(   207.05), SIMDE_FLOAT32_C(  -876.24),
+        SIMDE_FLOAT32_C(  -888.46), SIMDE_FLOAT32_C(  -303.48), SIMDE_FLOAT32_C(   249.90), SIMDE_FLOAT32_C(  -613.61) },
+      { SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(     9.00),
+        SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(     9.00) } },
+    { { SIMDE_FLOAT32_C(  -901.93), SIMDE_FLOAT32_C(   188.04), SIMDE_FLOAT32_C(  -332.04), SIMDE_FLOAT32_C(   964.02),
+        SIMDE_FLOAT32_C(   117.79), SIMDE_FLOAT32_C(  -281.72), SIMDE_FLOAT32_C(   504.90), SIMDE_FLOAT32_C(   770.65) },
+      { SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00),
+        SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00) } },
+    { { SIMDE_FLOAT32_C(   212.55), SIMDE_FLOAT32_C(  -846.54), SIMDE_FLOAT32_C(   893.85), SIMDE_FLOAT32_C(  -297.11),
+        SIMDE_FLOAT32_C(   508.99), SIMDE_FLOAT32_C(  -767.64), SIMDE_FLOAT32_C(   572.35), SIMDE_FLOAT32_C(   -46.54) },
+      { SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     8.00),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     5.00) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde__m256 r = simde_mm256_getexp_ps(a);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  simde_float32 values[8 * sizeof(simde__m256)];
+  simde_test_x86_random_f32x8_full(8, 1, values, -1000.0f, 1000.0f, SIMDE_TEST_VEC_FLOAT_NAN);
+
+  for (size_t i = 0 ; i < 8 ; i++) {
+    simde__m256 a = simde_test_x86_random_extract_f32x8(i, 1, 0, values);
+    simde__m256 r = simde_mm256_getexp_ps(a);
+
+    simde_test_x86_write_f32x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_mask_getexp_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde_float32 src[8];
+    const simde__mmask8 k;
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT32_C(   441.28), SIMDE_FLOAT32_C(   630.52), SIMDE_FLOAT32_C(  -542.28), SIMDE_FLOAT32_C(   -90.95),
+        SIMDE_FLOAT32_C(   990.55), SIMDE_FLOAT32_C(  -834.89), SIMDE_FLOAT32_C(   435.67), SIMDE_FLOAT32_C(   244.86) },
+      UINT8_C(182),
+      {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  -519.01),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   725.58),
+        SIMDE_FLOAT32_C(  -232.11), SIMDE_FLOAT32_C(   276.41), SIMDE_FLOAT32_C(   687.24), SIMDE_FLOAT32_C(  -972.28) },
+      { SIMDE_FLOAT32_C(   441.28), SIMDE_FLOAT32_C(     9.00),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   -90.95),
+        SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(   435.67), SIMDE_FLOAT32_C(     9.00) } },
+    #endif
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT32_C(   132.65), SIMDE_FLOAT32_C(  -910.02), SIMDE_FLOAT32_C(   284.23), SIMDE_FLOAT32_C(  -613.61),
+        SIMDE_FLOAT32_C(  -376.04), SIMDE_FLOAT32_C(   133.90), SIMDE_FLOAT32_C(   864.85), SIMDE_FLOAT32_C(  -189.15) },
+      UINT8_C(254),
+      { SIMDE_FLOAT32_C(    58.83),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   170.37),
+        SIMDE_FLOAT32_C(   590.81), SIMDE_FLOAT32_C(   401.38), SIMDE_FLOAT32_C(   556.76), SIMDE_FLOAT32_C(   688.87) },
+      { SIMDE_FLOAT32_C(   132.65),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00) } },
+    #endif
+    { { SIMDE_FLOAT32_C(  -713.68), SIMDE_FLOAT32_C(  -844.47), SIMDE_FLOAT32_C(   725.53), SIMDE_FLOAT32_C(  -136.66),
+        SIMDE_FLOAT32_C(  -188.54), SIMDE_FLOAT32_C(  -868.01), SIMDE_FLOAT32_C(  -701.19), SIMDE_FLOAT32_C(  -712.35) },
+      UINT8_C(133),
+      { SIMDE_FLOAT32_C(  -410.58), SIMDE_FLOAT32_C(  -775.28), SIMDE_FLOAT32_C(   652.89), SIMDE_FLOAT32_C(   707.21),
+        SIMDE_FLOAT32_C(   -57.00), SIMDE_FLOAT32_C(   157.79), SIMDE_FLOAT32_C(   477.86), SIMDE_FLOAT32_C(  -844.44) },
+      { SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(  -844.47), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(  -136.66),
+        SIMDE_FLOAT32_C(  -188.54), SIMDE_FLOAT32_C(  -868.01), SIMDE_FLOAT32_C(  -701.19), SIMDE_FLOAT32_C(     9.00) } },
+    { { SIMDE_FLOAT32_C(  -834.92), SIMDE_FLOAT32_C(   537.56), SIMDE_FLOAT32_C(   100.27), SIMDE_FLOAT32_C(   -56.87),
+        SIMDE_FLOAT32_C(   -21.17), SIMDE_FLOAT32_C(  -269.21), SIMDE_FLOAT32_C(   400.85), SIMDE_FLOAT32_C(   887.89) },
+      UINT8_C( 46),
+      { SIMDE_FLOAT32_C(   311.26), SIMDE_FLOAT32_C(   371.72), SIMDE_FLOAT32_C(  -141.55), SIMDE_FLOAT32_C(  -179.75),
+        SIMDE_FLOAT32_C(   604.08), SIMDE_FLOAT32_C(  -569.20), SIMDE_FLOAT32_C(   773.71), SIMDE_FLOAT32_C(   -52.80) },
+      { SIMDE_FLOAT32_C(  -834.92), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(   -21.17), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(   400.85), SIMDE_FLOAT32_C(   887.89) } },
+    { { SIMDE_FLOAT32_C(   565.97), SIMDE_FLOAT32_C(   323.55), SIMDE_FLOAT32_C(   966.20), SIMDE_FLOAT32_C(   589.95),
+        SIMDE_FLOAT32_C(  -543.80), SIMDE_FLOAT32_C(  -943.83), SIMDE_FLOAT32_C(  -125.82), SIMDE_FLOAT32_C(  -157.41) },
+      UINT8_C( 45),
+      { SIMDE_FLOAT32_C(   -88.21), SIMDE_FLOAT32_C(  -808.63), SIMDE_FLOAT32_C(  -327.22), SIMDE_FLOAT32_C(   679.67),
+        SIMDE_FLOAT32_C(   467.78), SIMDE_FLOAT32_C(  -639.98), SIMDE_FLOAT32_C(   707.39), SIMDE_FLOAT32_C(  -473.39) },
+      { SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(   323.55), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00),
+        SIMDE_FLOAT32_C(  -543.80), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(  -125.82), SIMDE_FLOAT32_C(  -157.41) } },
+    { { SIMDE_FLOAT32_C(  -991.91), SIMDE_FLOAT32_C(  -292.56), SIMDE_FLOAT32_C(   490.98), SIMDE_FLOAT32_C(  -301.13),
+        SIMDE_FLOAT32_C(    -6.24), SIMDE_FLOAT32_C(   646.51), SIMDE_FLOAT32_C(  -575.60), SIMDE_FLOAT32_C(   857.10) },
+      UINT8_C( 28),
+      { SIMDE_FLOAT32_C(   254.31), SIMDE_FLOAT32_C(   858.87), SIMDE_FLOAT32_C(   696.98), SIMDE_FLOAT32_C(  -154.88),
+        SIMDE_FLOAT32_C(   260.25), SIMDE_FLOAT32_C(   253.74), SIMDE_FLOAT32_C(  -466.01), SIMDE_FLOAT32_C(   849.67) },
+      { SIMDE_FLOAT32_C(  -991.91), SIMDE_FLOAT32_C(  -292.56), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(   646.51), SIMDE_FLOAT32_C(  -575.60), SIMDE_FLOAT32_C(   857.10) } },
+    { { SIMDE_FLOAT32_C(  -443.61), SIMDE_FLOAT32_C(  -844.09), SIMDE_FLOAT32_C(  -254.37), SIMDE_FLOAT32_C(  -301.09),
+        SIMDE_FLOAT32_C(  -679.01), SIMDE_FLOAT32_C(  -716.82), SIMDE_FLOAT32_C(   799.18), SIMDE_FLOAT32_C(   264.12) },
+      UINT8_C(178),
+      { SIMDE_FLOAT32_C(   478.47), SIMDE_FLOAT32_C(  -813.12), SIMDE_FLOAT32_C(   556.88), SIMDE_FLOAT32_C(  -578.53),
+        SIMDE_FLOAT32_C(   344.68), SIMDE_FLOAT32_C(    34.74), SIMDE_FLOAT32_C(  -422.98), SIMDE_FLOAT32_C(  -344.06) },
+      { SIMDE_FLOAT32_C(  -443.61), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(  -254.37), SIMDE_FLOAT32_C(  -301.09),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(   799.18), SIMDE_FLOAT32_C(     8.00) } },
+    { { SIMDE_FLOAT32_C(  -470.03), SIMDE_FLOAT32_C(  -335.03), SIMDE_FLOAT32_C(   149.90), SIMDE_FLOAT32_C(   251.31),
+        SIMDE_FLOAT32_C(  -769.06), SIMDE_FLOAT32_C(  -526.55), SIMDE_FLOAT32_C(   217.50), SIMDE_FLOAT32_C(   820.89) },
+      UINT8_C(248),
+      { SIMDE_FLOAT32_C(  -593.54), SIMDE_FLOAT32_C(   435.47), SIMDE_FLOAT32_C(   476.19), SIMDE_FLOAT32_C(  -989.46),
+        SIMDE_FLOAT32_C(   866.27), SIMDE_FLOAT32_C(   249.90), SIMDE_FLOAT32_C(   -42.26), SIMDE_FLOAT32_C(  -221.95) },
+      { SIMDE_FLOAT32_C(  -470.03), SIMDE_FLOAT32_C(  -335.03), SIMDE_FLOAT32_C(   149.90), SIMDE_FLOAT32_C(     9.00),
+        SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(     7.00) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 src = simde_mm256_loadu_ps(test_vec[i].src);
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde__m256 r = simde_mm256_mask_getexp_ps(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  simde_float32 values[8 * sizeof(simde__m256)];
+  simde_test_x86_random_f32x8_full(8, 1, values, -1000.0f, 1000.0f, SIMDE_TEST_VEC_FLOAT_NAN);
+
+  for (size_t i = 0 ; i < 8 ; i++) {
+    simde__m256 src = simde_test_x86_random_f32x8(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256 a = simde_test_x86_random_extract_f32x8(i, 1, 0, values);
+    simde__m256 r = simde_mm256_mask_getexp_ps(src, k, a);
+
+    simde_test_x86_write_f32x8(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_maskz_getexp_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT8_C( 41),
+      {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  -304.92),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   953.81),
+        SIMDE_FLOAT32_C(  -296.84), SIMDE_FLOAT32_C(  -520.32), SIMDE_FLOAT32_C(   444.80), SIMDE_FLOAT32_C(   402.04) },
+      {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     9.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    #endif
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT8_C( 17),
+      { SIMDE_FLOAT32_C(   473.45),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   330.55),
+        SIMDE_FLOAT32_C(   549.28), SIMDE_FLOAT32_C(  -617.18), SIMDE_FLOAT32_C(   486.46), SIMDE_FLOAT32_C(  -705.09) },
+      { SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    #endif
+    { UINT8_C(183),
+      { SIMDE_FLOAT32_C(    81.74), SIMDE_FLOAT32_C(   807.45), SIMDE_FLOAT32_C(  -421.91), SIMDE_FLOAT32_C(  -119.09),
+        SIMDE_FLOAT32_C(    71.57), SIMDE_FLOAT32_C(   840.10), SIMDE_FLOAT32_C(   410.88), SIMDE_FLOAT32_C(   736.54) },
+      { SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     9.00) } },
+    { UINT8_C(236),
+      { SIMDE_FLOAT32_C(    -9.99), SIMDE_FLOAT32_C(  -337.81), SIMDE_FLOAT32_C(   967.48), SIMDE_FLOAT32_C(   463.46),
+        SIMDE_FLOAT32_C(   879.70), SIMDE_FLOAT32_C(   788.38), SIMDE_FLOAT32_C(  -606.88), SIMDE_FLOAT32_C(   153.37) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     8.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     7.00) } },
+    { UINT8_C(144),
+      { SIMDE_FLOAT32_C(  -516.55), SIMDE_FLOAT32_C(  -834.64), SIMDE_FLOAT32_C(   107.19), SIMDE_FLOAT32_C(   186.62),
+        SIMDE_FLOAT32_C(  -354.96), SIMDE_FLOAT32_C(  -448.02), SIMDE_FLOAT32_C(  -411.35), SIMDE_FLOAT32_C(  -881.51) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     9.00) } },
+    { UINT8_C( 94),
+      { SIMDE_FLOAT32_C(   643.29), SIMDE_FLOAT32_C(  -584.91), SIMDE_FLOAT32_C(   449.03), SIMDE_FLOAT32_C(   192.57),
+        SIMDE_FLOAT32_C(  -202.09), SIMDE_FLOAT32_C(   -64.51), SIMDE_FLOAT32_C(   487.48), SIMDE_FLOAT32_C(   879.65) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(203),
+      { SIMDE_FLOAT32_C(  -257.06), SIMDE_FLOAT32_C(  -934.43), SIMDE_FLOAT32_C(  -239.44), SIMDE_FLOAT32_C(   814.51),
+        SIMDE_FLOAT32_C(   905.67), SIMDE_FLOAT32_C(  -828.56), SIMDE_FLOAT32_C(   551.05), SIMDE_FLOAT32_C(  -104.32) },
+      { SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     9.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     6.00) } },
+    { UINT8_C(110),
+      { SIMDE_FLOAT32_C(  -166.37), SIMDE_FLOAT32_C(   518.54), SIMDE_FLOAT32_C(  -640.86), SIMDE_FLOAT32_C(  -286.67),
+        SIMDE_FLOAT32_C(   306.91), SIMDE_FLOAT32_C(  -247.75), SIMDE_FLOAT32_C(   866.70), SIMDE_FLOAT32_C(   790.37) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     8.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     0.00) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde__m256 r = simde_mm256_maskz_getexp_ps(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  simde_float32 values[8 * sizeof(simde__m256)];
+  simde_test_x86_random_f32x8_full(8, 1, values, -1000.0f, 1000.0f, SIMDE_TEST_VEC_FLOAT_NAN);
+
+  for (size_t i = 0 ; i < 8 ; i++) {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256 a = simde_test_x86_random_extract_f32x8(i, 1, 0, values);
+    simde__m256 r = simde_mm256_maskz_getexp_ps(k, a);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_getexp_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   130.17),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  -221.36),
+        SIMDE_FLOAT32_C(  -934.33), SIMDE_FLOAT32_C(   849.22), SIMDE_FLOAT32_C(  -341.72), SIMDE_FLOAT32_C(  -191.39),
+        SIMDE_FLOAT32_C(   914.78), SIMDE_FLOAT32_C(   418.84), SIMDE_FLOAT32_C(  -376.88), SIMDE_FLOAT32_C(   820.46),
+        SIMDE_FLOAT32_C(   590.28), SIMDE_FLOAT32_C(  -825.82), SIMDE_FLOAT32_C(  -283.87), SIMDE_FLOAT32_C(  -576.08) },
+      {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     7.00),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00),
+        SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00) } },
+    #endif
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT32_C(   692.71),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    -0.37),
+        SIMDE_FLOAT32_C(   827.52), SIMDE_FLOAT32_C(     3.95), SIMDE_FLOAT32_C(  -210.01), SIMDE_FLOAT32_C(  -254.86),
+        SIMDE_FLOAT32_C(   977.84), SIMDE_FLOAT32_C(   766.98), SIMDE_FLOAT32_C(  -692.21), SIMDE_FLOAT32_C(   503.72),
+        SIMDE_FLOAT32_C(   332.61), SIMDE_FLOAT32_C(   988.93), SIMDE_FLOAT32_C(  -327.11), SIMDE_FLOAT32_C(   313.34) },
+      { SIMDE_FLOAT32_C(     9.00),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    -2.00),
+        SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     8.00),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     8.00) } },
+    #endif
+    { { SIMDE_FLOAT32_C(   119.10), SIMDE_FLOAT32_C(    34.63), SIMDE_FLOAT32_C(  -908.03), SIMDE_FLOAT32_C(   184.77),
+        SIMDE_FLOAT32_C(  -116.16), SIMDE_FLOAT32_C(  -249.75), SIMDE_FLOAT32_C(   993.38), SIMDE_FLOAT32_C(  -201.37),
+        SIMDE_FLOAT32_C(  -830.91), SIMDE_FLOAT32_C(  -383.50), SIMDE_FLOAT32_C(  -380.92), SIMDE_FLOAT32_C(   759.38),
+        SIMDE_FLOAT32_C(  -209.32), SIMDE_FLOAT32_C(   335.22), SIMDE_FLOAT32_C(  -816.70), SIMDE_FLOAT32_C(  -516.60) },
+      { SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00),
+        SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00) } },
+    { { SIMDE_FLOAT32_C(  -589.51), SIMDE_FLOAT32_C(   320.54), SIMDE_FLOAT32_C(   483.02), SIMDE_FLOAT32_C(  -761.99),
+        SIMDE_FLOAT32_C(  -675.50), SIMDE_FLOAT32_C(  -726.98), SIMDE_FLOAT32_C(   -16.85), SIMDE_FLOAT32_C(  -697.66),
+        SIMDE_FLOAT32_C(  -960.01), SIMDE_FLOAT32_C(   290.94), SIMDE_FLOAT32_C(   806.06), SIMDE_FLOAT32_C(   372.61),
+        SIMDE_FLOAT32_C(   279.87), SIMDE_FLOAT32_C(  -521.05), SIMDE_FLOAT32_C(  -314.06), SIMDE_FLOAT32_C(  -601.03) },
+      { SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00),
+        SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(     9.00),
+        SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     8.00),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00) } },
+    { { SIMDE_FLOAT32_C(   513.57), SIMDE_FLOAT32_C(  -222.09), SIMDE_FLOAT32_C(   583.74), SIMDE_FLOAT32_C(  -602.58),
+        SIMDE_FLOAT32_C(   528.17), SIMDE_FLOAT32_C(   577.12), SIMDE_FLOAT32_C(   196.05), SIMDE_FLOAT32_C(   697.26),
+        SIMDE_FLOAT32_C(  -806.37), SIMDE_FLOAT32_C(   815.13), SIMDE_FLOAT32_C(   456.64), SIMDE_FLOAT32_C(   -15.69),
+        SIMDE_FLOAT32_C(   150.35), SIMDE_FLOAT32_C(   639.93), SIMDE_FLOAT32_C(   467.70), SIMDE_FLOAT32_C(   560.84) },
+      { SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00),
+        SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(     9.00),
+        SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00) } },
+    { { SIMDE_FLOAT32_C(   -39.52), SIMDE_FLOAT32_C(   -49.27), SIMDE_FLOAT32_C(   798.85), SIMDE_FLOAT32_C(   284.97),
+        SIMDE_FLOAT32_C(   223.74), SIMDE_FLOAT32_C(  -218.00), SIMDE_FLOAT32_C(   587.32), SIMDE_FLOAT32_C(   263.74),
+        SIMDE_FLOAT32_C(  -927.06), SIMDE_FLOAT32_C(   393.38), SIMDE_FLOAT32_C(  -363.66), SIMDE_FLOAT32_C(   352.80),
+        SIMDE_FLOAT32_C(   872.32), SIMDE_FLOAT32_C(   322.29), SIMDE_FLOAT32_C(   751.77), SIMDE_FLOAT32_C(   385.89) },
+      { SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     8.00),
+        SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     8.00),
+        SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     8.00),
+        SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     8.00) } },
+    { { SIMDE_FLOAT32_C(  -899.80), SIMDE_FLOAT32_C(   335.51), SIMDE_FLOAT32_C(   783.31), SIMDE_FLOAT32_C(   628.37),
+        SIMDE_FLOAT32_C(   -87.36), SIMDE_FLOAT32_C(   -20.64), SIMDE_FLOAT32_C(   325.63), SIMDE_FLOAT32_C(   106.26),
+        SIMDE_FLOAT32_C(  -205.51), SIMDE_FLOAT32_C(  -217.74), SIMDE_FLOAT32_C(  -909.43), SIMDE_FLOAT32_C(   944.83),
+        SIMDE_FLOAT32_C(  -577.81), SIMDE_FLOAT32_C(   558.27), SIMDE_FLOAT32_C(   505.67), SIMDE_FLOAT32_C(   382.67) },
+      { SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00),
+        SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     6.00),
+        SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00),
+        SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     8.00) } },
+    { { SIMDE_FLOAT32_C(  -491.00), SIMDE_FLOAT32_C(   304.52), SIMDE_FLOAT32_C(  -332.35), SIMDE_FLOAT32_C(   732.74),
+        SIMDE_FLOAT32_C(  -913.48), SIMDE_FLOAT32_C(  -745.04), SIMDE_FLOAT32_C(    -3.52), SIMDE_FLOAT32_C(  -840.55),
+        SIMDE_FLOAT32_C(   648.34), SIMDE_FLOAT32_C(   632.82), SIMDE_FLOAT32_C(   512.26), SIMDE_FLOAT32_C(   520.66),
+        SIMDE_FLOAT32_C(   -44.89), SIMDE_FLOAT32_C(   264.03), SIMDE_FLOAT32_C(   -93.45), SIMDE_FLOAT32_C(    55.31) },
+      { SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00),
+        SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     9.00),
+        SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00),
+        SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     5.00) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_getexp_ps(a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  simde_float32 values[8 * sizeof(simde__m512)];
+  simde_test_x86_random_f32x16_full(8, 1, values, -1000.0f, 1000.0f, SIMDE_TEST_VEC_FLOAT_NAN);
+
+  for (size_t i = 0 ; i < 8 ; i++) {
+    simde__m512 a = simde_test_x86_random_extract_f32x16(i, 1, 0, values);
+    simde__m512 r = simde_mm512_getexp_ps(a);
+
+    simde_test_x86_write_f32x16(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_mask_getexp_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde_float32 src[16];
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT32_C(  -950.42), SIMDE_FLOAT32_C(  -858.60), SIMDE_FLOAT32_C(  -787.43), SIMDE_FLOAT32_C(  -939.69),
+        SIMDE_FLOAT32_C(  -290.18), SIMDE_FLOAT32_C(  -455.47), SIMDE_FLOAT32_C(  -771.00), SIMDE_FLOAT32_C(  -448.67),
+        SIMDE_FLOAT32_C(  -384.82), SIMDE_FLOAT32_C(   295.77), SIMDE_FLOAT32_C(  -890.63), SIMDE_FLOAT32_C(   148.20),
+        SIMDE_FLOAT32_C(   219.49), SIMDE_FLOAT32_C(    91.48), SIMDE_FLOAT32_C(   376.31), SIMDE_FLOAT32_C(   264.26) },
+      UINT16_C( 7526),
+      {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  -310.14),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   512.18),
+        SIMDE_FLOAT32_C(   669.22), SIMDE_FLOAT32_C(  -990.70), SIMDE_FLOAT32_C(  -381.56), SIMDE_FLOAT32_C(  -536.29),
+        SIMDE_FLOAT32_C(  -208.44), SIMDE_FLOAT32_C(  -290.99), SIMDE_FLOAT32_C(  -591.46), SIMDE_FLOAT32_C(   213.76),
+        SIMDE_FLOAT32_C(  -732.72), SIMDE_FLOAT32_C(   914.21), SIMDE_FLOAT32_C(  -403.57), SIMDE_FLOAT32_C(  -223.73) },
+      { SIMDE_FLOAT32_C(  -950.42), SIMDE_FLOAT32_C(     8.00),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  -939.69),
+        SIMDE_FLOAT32_C(  -290.18), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(  -448.67),
+        SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(   295.77), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(    91.48), SIMDE_FLOAT32_C(   376.31), SIMDE_FLOAT32_C(   264.26) } },
+    #endif
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT32_C(  -841.10), SIMDE_FLOAT32_C(   401.48), SIMDE_FLOAT32_C(     8.97), SIMDE_FLOAT32_C(   609.15),
+        SIMDE_FLOAT32_C(  -794.74), SIMDE_FLOAT32_C(  -740.01), SIMDE_FLOAT32_C(   561.77), SIMDE_FLOAT32_C(   812.09),
+        SIMDE_FLOAT32_C(   -90.52), SIMDE_FLOAT32_C(  -195.97), SIMDE_FLOAT32_C(   182.97), SIMDE_FLOAT32_C(   908.52),
+        SIMDE_FLOAT32_C(  -524.11), SIMDE_FLOAT32_C(   232.54), SIMDE_FLOAT32_C(  -950.09), SIMDE_FLOAT32_C(  -311.54) },
+      UINT16_C(27145),
+      { SIMDE_FLOAT32_C(   218.73),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   305.25),
+        SIMDE_FLOAT32_C(   519.04), SIMDE_FLOAT32_C(   505.49), SIMDE_FLOAT32_C(   464.70), SIMDE_FLOAT32_C(   167.37),
+        SIMDE_FLOAT32_C(   138.32), SIMDE_FLOAT32_C(   -23.05), SIMDE_FLOAT32_C(  -311.97), SIMDE_FLOAT32_C(  -906.57),
+        SIMDE_FLOAT32_C(  -759.02), SIMDE_FLOAT32_C(   594.58), SIMDE_FLOAT32_C(   148.73), SIMDE_FLOAT32_C(  -159.48) },
+      { SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(   401.48), SIMDE_FLOAT32_C(     8.97), SIMDE_FLOAT32_C(     8.00),
+        SIMDE_FLOAT32_C(  -794.74), SIMDE_FLOAT32_C(  -740.01), SIMDE_FLOAT32_C(   561.77), SIMDE_FLOAT32_C(   812.09),
+        SIMDE_FLOAT32_C(   -90.52), SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(   182.97), SIMDE_FLOAT32_C(     9.00),
+        SIMDE_FLOAT32_C(  -524.11), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(  -311.54) } },
+    #endif
+    { { SIMDE_FLOAT32_C(   232.99), SIMDE_FLOAT32_C(   521.85), SIMDE_FLOAT32_C(   311.06), SIMDE_FLOAT32_C(   848.17),
+        SIMDE_FLOAT32_C(  -182.38), SIMDE_FLOAT32_C(   420.43), SIMDE_FLOAT32_C(    -3.63), SIMDE_FLOAT32_C(  -962.89),
+        SIMDE_FLOAT32_C(  -488.09), SIMDE_FLOAT32_C(  -627.31), SIMDE_FLOAT32_C(   301.38), SIMDE_FLOAT32_C(   236.12),
+        SIMDE_FLOAT32_C(  -589.58), SIMDE_FLOAT32_C(   460.27), SIMDE_FLOAT32_C(  -362.40), SIMDE_FLOAT32_C(   419.39) },
+      UINT16_C(50151),
+      { SIMDE_FLOAT32_C(  -715.55), SIMDE_FLOAT32_C(   832.41), SIMDE_FLOAT32_C(  -647.30), SIMDE_FLOAT32_C(   953.67),
+        SIMDE_FLOAT32_C(   841.71), SIMDE_FLOAT32_C(   -28.86), SIMDE_FLOAT32_C(  -582.62), SIMDE_FLOAT32_C(  -366.73),
+        SIMDE_FLOAT32_C(   680.15), SIMDE_FLOAT32_C(  -174.08), SIMDE_FLOAT32_C(   847.02), SIMDE_FLOAT32_C(   947.42),
+        SIMDE_FLOAT32_C(  -259.87), SIMDE_FLOAT32_C(  -556.55), SIMDE_FLOAT32_C(  -276.30), SIMDE_FLOAT32_C(   958.86) },
+      { SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(   848.17),
+        SIMDE_FLOAT32_C(  -182.38), SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     8.00),
+        SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(   301.38), SIMDE_FLOAT32_C(   236.12),
+        SIMDE_FLOAT32_C(  -589.58), SIMDE_FLOAT32_C(   460.27), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00) } },
+    { { SIMDE_FLOAT32_C(   679.38), SIMDE_FLOAT32_C(  -368.80), SIMDE_FLOAT32_C(  -345.05), SIMDE_FLOAT32_C(  -411.15),
+        SIMDE_FLOAT32_C(   435.23), SIMDE_FLOAT32_C(   837.92), SIMDE_FLOAT32_C(  -502.63), SIMDE_FLOAT32_C(   911.12),
+        SIMDE_FLOAT32_C(    70.46), SIMDE_FLOAT32_C(  -452.72), SIMDE_FLOAT32_C(  -400.42), SIMDE_FLOAT32_C(  -636.69),
+        SIMDE_FLOAT32_C(   307.02), SIMDE_FLOAT32_C(   832.57), SIMDE_FLOAT32_C(   885.17), SIMDE_FLOAT32_C(  -381.92) },
+      UINT16_C(40152),
+      { SIMDE_FLOAT32_C(   707.52), SIMDE_FLOAT32_C(   232.71), SIMDE_FLOAT32_C(   264.11), SIMDE_FLOAT32_C(   226.56),
+        SIMDE_FLOAT32_C(  -261.79), SIMDE_FLOAT32_C(  -271.19), SIMDE_FLOAT32_C(  -606.07), SIMDE_FLOAT32_C(   876.53),
+        SIMDE_FLOAT32_C(   705.76), SIMDE_FLOAT32_C(    81.96), SIMDE_FLOAT32_C(   969.95), SIMDE_FLOAT32_C(   946.74),
+        SIMDE_FLOAT32_C(  -323.46), SIMDE_FLOAT32_C(   118.69), SIMDE_FLOAT32_C(  -212.73), SIMDE_FLOAT32_C(   -39.01) },
+      { SIMDE_FLOAT32_C(   679.38), SIMDE_FLOAT32_C(  -368.80), SIMDE_FLOAT32_C(  -345.05), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(   837.92), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00),
+        SIMDE_FLOAT32_C(    70.46), SIMDE_FLOAT32_C(  -452.72), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(   832.57), SIMDE_FLOAT32_C(   885.17), SIMDE_FLOAT32_C(     5.00) } },
+    { { SIMDE_FLOAT32_C(  -961.49), SIMDE_FLOAT32_C(  -322.89), SIMDE_FLOAT32_C(  -260.10), SIMDE_FLOAT32_C(  -449.57),
+        SIMDE_FLOAT32_C(    49.80), SIMDE_FLOAT32_C(  -958.72), SIMDE_FLOAT32_C(   786.55), SIMDE_FLOAT32_C(   460.22),
+        SIMDE_FLOAT32_C(   501.55), SIMDE_FLOAT32_C(  -575.85), SIMDE_FLOAT32_C(  -120.40), SIMDE_FLOAT32_C(  -429.02),
+        SIMDE_FLOAT32_C(   267.00), SIMDE_FLOAT32_C(  -441.02), SIMDE_FLOAT32_C(   202.18), SIMDE_FLOAT32_C(   921.95) },
+      UINT16_C(13600),
+      { SIMDE_FLOAT32_C(   -48.91), SIMDE_FLOAT32_C(   139.97), SIMDE_FLOAT32_C(   -85.34), SIMDE_FLOAT32_C(  -207.20),
+        SIMDE_FLOAT32_C(  -888.89), SIMDE_FLOAT32_C(   332.03), SIMDE_FLOAT32_C(   426.07), SIMDE_FLOAT32_C(   791.25),
+        SIMDE_FLOAT32_C(  -842.05), SIMDE_FLOAT32_C(   273.09), SIMDE_FLOAT32_C(   738.68), SIMDE_FLOAT32_C(  -101.92),
+        SIMDE_FLOAT32_C(   716.54), SIMDE_FLOAT32_C(  -537.62), SIMDE_FLOAT32_C(  -143.05), SIMDE_FLOAT32_C(   424.06) },
+      { SIMDE_FLOAT32_C(  -961.49), SIMDE_FLOAT32_C(  -322.89), SIMDE_FLOAT32_C(  -260.10), SIMDE_FLOAT32_C(  -449.57),
+        SIMDE_FLOAT32_C(    49.80), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(   786.55), SIMDE_FLOAT32_C(   460.22),
+        SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(  -575.85), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(  -429.02),
+        SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(   202.18), SIMDE_FLOAT32_C(   921.95) } },
+    { { SIMDE_FLOAT32_C(   759.87), SIMDE_FLOAT32_C(   645.20), SIMDE_FLOAT32_C(  -451.47), SIMDE_FLOAT32_C(  -169.67),
+        SIMDE_FLOAT32_C(  -807.51), SIMDE_FLOAT32_C(   148.11), SIMDE_FLOAT32_C(   193.64), SIMDE_FLOAT32_C(   499.51),
+        SIMDE_FLOAT32_C(   -19.32), SIMDE_FLOAT32_C(    78.81), SIMDE_FLOAT32_C(  -882.41), SIMDE_FLOAT32_C(  -338.58),
+        SIMDE_FLOAT32_C(   781.60), SIMDE_FLOAT32_C(  -843.90), SIMDE_FLOAT32_C(   338.53), SIMDE_FLOAT32_C(  -478.50) },
+      UINT16_C( 1530),
+      { SIMDE_FLOAT32_C(   695.09), SIMDE_FLOAT32_C(  -878.95), SIMDE_FLOAT32_C(  -349.38), SIMDE_FLOAT32_C(  -566.70),
+        SIMDE_FLOAT32_C(  -150.14), SIMDE_FLOAT32_C(    44.55), SIMDE_FLOAT32_C(  -690.17), SIMDE_FLOAT32_C(  -444.38),
+        SIMDE_FLOAT32_C(  -873.49), SIMDE_FLOAT32_C(  -720.22), SIMDE_FLOAT32_C(  -497.63), SIMDE_FLOAT32_C(  -196.95),
+        SIMDE_FLOAT32_C(   398.46), SIMDE_FLOAT32_C(   289.63), SIMDE_FLOAT32_C(   764.04), SIMDE_FLOAT32_C(  -650.44) },
+      { SIMDE_FLOAT32_C(   759.87), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(  -451.47), SIMDE_FLOAT32_C(     9.00),
+        SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     8.00),
+        SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(    78.81), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(  -338.58),
+        SIMDE_FLOAT32_C(   781.60), SIMDE_FLOAT32_C(  -843.90), SIMDE_FLOAT32_C(   338.53), SIMDE_FLOAT32_C(  -478.50) } },
+    { { SIMDE_FLOAT32_C(  -437.22), SIMDE_FLOAT32_C(  -506.93), SIMDE_FLOAT32_C(   848.55), SIMDE_FLOAT32_C(  -935.67),
+        SIMDE_FLOAT32_C(   -82.78), SIMDE_FLOAT32_C(  -271.84), SIMDE_FLOAT32_C(  -364.69), SIMDE_FLOAT32_C(  -815.78),
+        SIMDE_FLOAT32_C(   287.14), SIMDE_FLOAT32_C(   837.49), SIMDE_FLOAT32_C(  -893.82), SIMDE_FLOAT32_C(  -565.03),
+        SIMDE_FLOAT32_C(  -525.10), SIMDE_FLOAT32_C(   866.05), SIMDE_FLOAT32_C(  -919.83), SIMDE_FLOAT32_C(    23.42) },
+      UINT16_C( 8876),
+      { SIMDE_FLOAT32_C(  -570.40), SIMDE_FLOAT32_C(  -321.30), SIMDE_FLOAT32_C(   142.36), SIMDE_FLOAT32_C(  -459.29),
+        SIMDE_FLOAT32_C(  -989.27), SIMDE_FLOAT32_C(  -431.58), SIMDE_FLOAT32_C(  -668.03), SIMDE_FLOAT32_C(  -831.31),
+        SIMDE_FLOAT32_C(   841.51), SIMDE_FLOAT32_C(  -929.36), SIMDE_FLOAT32_C(    66.77), SIMDE_FLOAT32_C(   558.05),
+        SIMDE_FLOAT32_C(  -466.98), SIMDE_FLOAT32_C(   923.72), SIMDE_FLOAT32_C(   -17.89), SIMDE_FLOAT32_C(  -771.89) },
+      { SIMDE_FLOAT32_C(  -437.22), SIMDE_FLOAT32_C(  -506.93), SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(     8.00),
+        SIMDE_FLOAT32_C(   -82.78), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(  -364.69), SIMDE_FLOAT32_C(     9.00),
+        SIMDE_FLOAT32_C(   287.14), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(  -893.82), SIMDE_FLOAT32_C(  -565.03),
+        SIMDE_FLOAT32_C(  -525.10), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(  -919.83), SIMDE_FLOAT32_C(    23.42) } },
+    { { SIMDE_FLOAT32_C(  -828.47), SIMDE_FLOAT32_C(   890.02), SIMDE_FLOAT32_C(   772.17), SIMDE_FLOAT32_C(   152.21),
+        SIMDE_FLOAT32_C(   -31.18), SIMDE_FLOAT32_C(   889.75), SIMDE_FLOAT32_C(   813.63), SIMDE_FLOAT32_C(  -249.58),
+        SIMDE_FLOAT32_C(  -954.15), SIMDE_FLOAT32_C(   152.16), SIMDE_FLOAT32_C(   271.92), SIMDE_FLOAT32_C(  -247.62),
+        SIMDE_FLOAT32_C(   540.49), SIMDE_FLOAT32_C(   834.70), SIMDE_FLOAT32_C(   245.45), SIMDE_FLOAT32_C(   389.05) },
+      UINT16_C( 6106),
+      { SIMDE_FLOAT32_C(  -955.23), SIMDE_FLOAT32_C(   632.72), SIMDE_FLOAT32_C(  -338.59), SIMDE_FLOAT32_C(  -105.37),
+        SIMDE_FLOAT32_C(  -322.73), SIMDE_FLOAT32_C(   -28.76), SIMDE_FLOAT32_C(   450.26), SIMDE_FLOAT32_C(  -196.22),
+        SIMDE_FLOAT32_C(   251.02), SIMDE_FLOAT32_C(   952.62), SIMDE_FLOAT32_C(   606.83), SIMDE_FLOAT32_C(  -350.52),
+        SIMDE_FLOAT32_C(   242.26), SIMDE_FLOAT32_C(   370.88), SIMDE_FLOAT32_C(    -0.96), SIMDE_FLOAT32_C(   671.86) },
+      { SIMDE_FLOAT32_C(  -828.47), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(   772.17), SIMDE_FLOAT32_C(     6.00),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(   889.75), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(  -247.62),
+        SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(   834.70), SIMDE_FLOAT32_C(   245.45), SIMDE_FLOAT32_C(   389.05) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 src = simde_mm512_loadu_ps(test_vec[i].src);
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_mask_getexp_ps(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  simde_float32 values[8 * sizeof(simde__m512)];
+  simde_test_x86_random_f32x16_full(8, 1, values, -1000.0f, 1000.0f, SIMDE_TEST_VEC_FLOAT_NAN);
+
+  for (size_t i = 0 ; i < 8 ; i++) {
+    simde__m512 src = simde_test_x86_random_f32x16(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m512 a = simde_test_x86_random_extract_f32x16(i, 1, 0, values);
+    simde__m512 r = simde_mm512_mask_getexp_ps(src, k, a);
+
+    simde_test_x86_write_f32x16(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_maskz_getexp_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT16_C(30222),
+      {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  -465.66),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   404.34),
+        SIMDE_FLOAT32_C(  -628.17), SIMDE_FLOAT32_C(  -546.93), SIMDE_FLOAT32_C(   839.31), SIMDE_FLOAT32_C(  -153.27),
+        SIMDE_FLOAT32_C(  -680.88), SIMDE_FLOAT32_C(   919.48), SIMDE_FLOAT32_C(   870.15), SIMDE_FLOAT32_C(    15.50),
+        SIMDE_FLOAT32_C(  -807.86), SIMDE_FLOAT32_C(  -958.32), SIMDE_FLOAT32_C(   -94.49), SIMDE_FLOAT32_C(   964.31) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     8.00),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     8.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     0.00) } },
+    #endif
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT16_C(33946),
+      { SIMDE_FLOAT32_C(   193.89),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     7.51),
+        SIMDE_FLOAT32_C(  -375.24), SIMDE_FLOAT32_C(   899.91), SIMDE_FLOAT32_C(  -840.33), SIMDE_FLOAT32_C(   896.68),
+        SIMDE_FLOAT32_C(  -347.72), SIMDE_FLOAT32_C(   700.17), SIMDE_FLOAT32_C(   731.39), SIMDE_FLOAT32_C(   897.74),
+        SIMDE_FLOAT32_C(    89.21), SIMDE_FLOAT32_C(   630.42), SIMDE_FLOAT32_C(  -939.59), SIMDE_FLOAT32_C(   206.41) },
+      { SIMDE_FLOAT32_C(     0.00),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     2.00),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     9.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     7.00) } },
+    #endif
+    { UINT16_C(17423),
+      { SIMDE_FLOAT32_C(  -835.24), SIMDE_FLOAT32_C(  -592.69), SIMDE_FLOAT32_C(  -389.25), SIMDE_FLOAT32_C(  -463.41),
+        SIMDE_FLOAT32_C(  -139.62), SIMDE_FLOAT32_C(  -549.94), SIMDE_FLOAT32_C(   383.32), SIMDE_FLOAT32_C(   179.50),
+        SIMDE_FLOAT32_C(  -630.47), SIMDE_FLOAT32_C(   253.47), SIMDE_FLOAT32_C(  -805.00), SIMDE_FLOAT32_C(  -438.33),
+        SIMDE_FLOAT32_C(   295.15), SIMDE_FLOAT32_C(   100.51), SIMDE_FLOAT32_C(  -474.02), SIMDE_FLOAT32_C(  -510.96) },
+      { SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     8.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C(26393),
+      { SIMDE_FLOAT32_C(   -25.15), SIMDE_FLOAT32_C(  -619.97), SIMDE_FLOAT32_C(   496.55), SIMDE_FLOAT32_C(   599.61),
+        SIMDE_FLOAT32_C(  -720.06), SIMDE_FLOAT32_C(   656.22), SIMDE_FLOAT32_C(   496.30), SIMDE_FLOAT32_C(   -67.77),
+        SIMDE_FLOAT32_C(   356.39), SIMDE_FLOAT32_C(   227.68), SIMDE_FLOAT32_C(  -170.04), SIMDE_FLOAT32_C(  -554.40),
+        SIMDE_FLOAT32_C(  -141.90), SIMDE_FLOAT32_C(  -109.63), SIMDE_FLOAT32_C(   652.02), SIMDE_FLOAT32_C(    22.86) },
+      { SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     9.00),
+        SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C(18800),
+      { SIMDE_FLOAT32_C(   297.68), SIMDE_FLOAT32_C(  -737.23), SIMDE_FLOAT32_C(   559.46), SIMDE_FLOAT32_C(  -841.94),
+        SIMDE_FLOAT32_C(  -287.18), SIMDE_FLOAT32_C(   -57.22), SIMDE_FLOAT32_C(   337.56), SIMDE_FLOAT32_C(    82.35),
+        SIMDE_FLOAT32_C(  -803.75), SIMDE_FLOAT32_C(   532.56), SIMDE_FLOAT32_C(   644.03), SIMDE_FLOAT32_C(   491.40),
+        SIMDE_FLOAT32_C(  -366.92), SIMDE_FLOAT32_C(  -830.00), SIMDE_FLOAT32_C(   980.44), SIMDE_FLOAT32_C(   607.93) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     8.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C( 5488),
+      { SIMDE_FLOAT32_C(  -449.96), SIMDE_FLOAT32_C(   476.99), SIMDE_FLOAT32_C(   207.54), SIMDE_FLOAT32_C(  -170.02),
+        SIMDE_FLOAT32_C(   133.21), SIMDE_FLOAT32_C(  -296.16), SIMDE_FLOAT32_C(   762.20), SIMDE_FLOAT32_C(  -510.40),
+        SIMDE_FLOAT32_C(   931.52), SIMDE_FLOAT32_C(  -407.84), SIMDE_FLOAT32_C(   -64.80), SIMDE_FLOAT32_C(  -210.37),
+        SIMDE_FLOAT32_C(   482.54), SIMDE_FLOAT32_C(  -412.78), SIMDE_FLOAT32_C(   812.49), SIMDE_FLOAT32_C(  -219.79) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C(25737),
+      { SIMDE_FLOAT32_C(  -150.02), SIMDE_FLOAT32_C(   371.95), SIMDE_FLOAT32_C(   -61.73), SIMDE_FLOAT32_C(   562.81),
+        SIMDE_FLOAT32_C(  -685.28), SIMDE_FLOAT32_C(  -724.16), SIMDE_FLOAT32_C(  -354.84), SIMDE_FLOAT32_C(  -489.03),
+        SIMDE_FLOAT32_C(   808.40), SIMDE_FLOAT32_C(  -710.81), SIMDE_FLOAT32_C(  -997.63), SIMDE_FLOAT32_C(  -558.52),
+        SIMDE_FLOAT32_C(  -540.81), SIMDE_FLOAT32_C(   982.81), SIMDE_FLOAT32_C(  -950.59), SIMDE_FLOAT32_C(     9.23) },
+      { SIMDE_FLOAT32_C(     7.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     9.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     8.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C( 5249),
+      { SIMDE_FLOAT32_C(   459.79), SIMDE_FLOAT32_C(   256.95), SIMDE_FLOAT32_C(   839.20), SIMDE_FLOAT32_C(  -406.99),
+        SIMDE_FLOAT32_C(   960.79), SIMDE_FLOAT32_C(   601.41), SIMDE_FLOAT32_C(    82.61), SIMDE_FLOAT32_C(   892.32),
+        SIMDE_FLOAT32_C(  -806.43), SIMDE_FLOAT32_C(  -982.19), SIMDE_FLOAT32_C(  -318.06), SIMDE_FLOAT32_C(   676.11),
+        SIMDE_FLOAT32_C(  -394.97), SIMDE_FLOAT32_C(  -505.57), SIMDE_FLOAT32_C(  -543.68), SIMDE_FLOAT32_C(   455.02) },
+      { SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     9.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_maskz_getexp_ps(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  simde_float32 values[8 * sizeof(simde__m512)];
+  simde_test_x86_random_f32x16_full(8, 1, values, -1000.0f, 1000.0f, SIMDE_TEST_VEC_FLOAT_NAN);
+
+  for (size_t i = 0 ; i < 8 ; i++) {
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m512 a = simde_test_x86_random_extract_f32x16(i, 1, 0, values);
+    simde__m512 r = simde_mm512_maskz_getexp_ps(k, a);
+
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_getexp_pd (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT64_C(    -0.00), SIMDE_FLOAT64_C( 1.0e-310) },
+      {       -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C( -1030.00) } },
+    #endif
+    #if !defined(SIMDE_FAST_MATH)
+    { {       -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(-2.5e-320) },
+      {        SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C( -1062.00) } },
+    #endif
+    #if !defined(SIMDE_FAST_MATH)
+    { {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   259.79) },
+      {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     8.00) } },
+    #endif
+    #if !defined(SIMDE_FAST_MATH)
+    { {             SIMDE_MATH_NAN,             SIMDE_MATH_NAN },
+      {             SIMDE_MATH_NAN,             SIMDE_MATH_NAN } },
+    #endif
+    #if !defined(SIMDE_FAST_MATH)
+    { {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   812.66) },
+      {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     9.00) } },
+    #endif
+    { { SIMDE_FLOAT64_C(    79.78), SIMDE_FLOAT64_C(    54.77) },
+      { SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(     5.00) } },
+    { { SIMDE_FLOAT64_C(   830.47), SIMDE_FLOAT64_C(   761.73) },
+      { SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     9.00) } },
+    { { SIMDE_FLOAT64_C(  -269.13), SIMDE_FLOAT64_C(  -564.50) },
+      { SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     9.00) } },
+    { { SIMDE_FLOAT64_C(  -743.84), SIMDE_FLOAT64_C(   187.19) },
+      { SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     7.00) } },
+    { { SIMDE_FLOAT64_C(   890.52), SIMDE_FLOAT64_C(  -877.46) },
+      { SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     9.00) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d r = simde_mm_getexp_pd(a);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  simde_float64 values[8 * sizeof(simde__m128d)];
+  simde_test_x86_random_f64x2_full(8, 1, values, -1000.0, 1000.0, SIMDE_TEST_VEC_FLOAT_NAN);
+
+  for (size_t i = 0 ; i < 8 ; i++) {
+    simde__m128d a = simde_test_x86_random_extract_f64x2(i, 1, 0, values);
+    simde__m128d r = simde_mm_getexp_pd(a);
+
+    simde_test_x86_write_f64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_mask_getexp_pd (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde_float64 src[2];
+    const simde__mmask8 k;
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT64_C(   615.23), SIMDE_FLOAT64_C(   234.49) },
+      UINT8_C(207),
+      {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   -91.66) },
+      {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     6.00) } },
+    #endif
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT64_C(  -523.57), SIMDE_FLOAT64_C(    47.15) },
+      UINT8_C(230),
+      {             SIMDE_MATH_NAN,             SIMDE_MATH_NAN },
+      { SIMDE_FLOAT64_C(  -523.57),             SIMDE_MATH_NAN } },
+    #endif
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT64_C(   531.20), SIMDE_FLOAT64_C(  -122.38) },
+      UINT8_C( 39),
+      {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(    -4.29) },
+      {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     2.00) } },
+    #endif
+    { { SIMDE_FLOAT64_C(  -737.93), SIMDE_FLOAT64_C(   313.12) },
+      UINT8_C( 73),
+      { SIMDE_FLOAT64_C(   731.05), SIMDE_FLOAT64_C(  -476.50) },
+      { SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(   313.12) } },
+    { { SIMDE_FLOAT64_C(   449.26), SIMDE_FLOAT64_C(   203.64) },
+      UINT8_C(122),
+      { SIMDE_FLOAT64_C(   690.15), SIMDE_FLOAT64_C(   651.36) },
+      { SIMDE_FLOAT64_C(   449.26), SIMDE_FLOAT64_C(     9.00) } },
+    { { SIMDE_FLOAT64_C(  -968.95), SIMDE_FLOAT64_C(  -888.02) },
+      UINT8_C( 46),
+      { SIMDE_FLOAT64_C(   -65.14), SIMDE_FLOAT64_C(  -632.60) },
+      { SIMDE_FLOAT64_C(  -968.95), SIMDE_FLOAT64_C(     9.00) } },
+    { { SIMDE_FLOAT64_C(  -716.74), SIMDE_FLOAT64_C(  -316.69) },
+      UINT8_C(252),
+      { SIMDE_FLOAT64_C(   621.07), SIMDE_FLOAT64_C(  -644.56) },
+      { SIMDE_FLOAT64_C(  -716.74), SIMDE_FLOAT64_C(  -316.69) } },
+    { { SIMDE_FLOAT64_C(  -985.69), SIMDE_FLOAT64_C(   206.80) },
+      UINT8_C( 19),
+      { SIMDE_FLOAT64_C(  -495.56), SIMDE_FLOAT64_C(  -152.26) },
+      { SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     7.00) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d src = simde_mm_loadu_pd(test_vec[i].src);
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d r = simde_mm_mask_getexp_pd(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  simde_float64 values[8 * sizeof(simde__m128d)];
+  simde_test_x86_random_f64x2_full(8, 1, values, -1000.0, 1000.0, SIMDE_TEST_VEC_FLOAT_NAN);
+
+  for (size_t i = 0 ; i < 8 ; i++) {
+    simde__m128d src = simde_test_x86_random_f64x2(SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128d a = simde_test_x86_random_extract_f64x2(i, 1, 0, values);
+    simde__m128d r = simde_mm_mask_getexp_pd(src, k, a);
+
+    simde_test_x86_write_f64x2(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x2(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_maskz_getexp_pd (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT8_C(107),
+      {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(  -858.34) },
+      {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     9.00) } },
+    #endif
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT8_C(120),
+      {             SIMDE_MATH_NAN,             SIMDE_MATH_NAN },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    #endif
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT8_C(220),
+      {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   116.77) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    #endif
+    { UINT8_C(230),
+      { SIMDE_FLOAT64_C(  -865.52), SIMDE_FLOAT64_C(  -887.67) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     9.00) } },
+    { UINT8_C( 56),
+      { SIMDE_FLOAT64_C(  -648.74), SIMDE_FLOAT64_C(  -830.31) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C( 86),
+      { SIMDE_FLOAT64_C(  -411.24), SIMDE_FLOAT64_C(   398.41) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     8.00) } },
+    { UINT8_C(169),
+      { SIMDE_FLOAT64_C(   284.68), SIMDE_FLOAT64_C(  -880.04) },
+      { SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(123),
+      { SIMDE_FLOAT64_C(  -723.97), SIMDE_FLOAT64_C(  -838.60) },
+      { SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     9.00) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d r = simde_mm_maskz_getexp_pd(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  simde_float64 values[8 * sizeof(simde__m128d)];
+  simde_test_x86_random_f64x2_full(8, 1, values, -1000.0, 1000.0, SIMDE_TEST_VEC_FLOAT_NAN);
+
+  for (size_t i = 0 ; i < 8 ; i++) {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128d a = simde_test_x86_random_extract_f64x2(i, 1, 0, values);
+    simde__m128d r = simde_mm_maskz_getexp_pd(k, a);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x2(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_getexp_pd (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(  -854.40),             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(  -336.48) },
+      {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     9.00),             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     8.00) } },
+    #endif
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT64_C(  -840.09),             SIMDE_MATH_NAN,             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   825.58) },
+      { SIMDE_FLOAT64_C(     9.00),             SIMDE_MATH_NAN,             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     9.00) } },
+    #endif
+    { { SIMDE_FLOAT64_C(   -63.46), SIMDE_FLOAT64_C(   520.76), SIMDE_FLOAT64_C(   112.32), SIMDE_FLOAT64_C(   433.64) },
+      { SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(     8.00) } },
+    { { SIMDE_FLOAT64_C(  -362.47), SIMDE_FLOAT64_C(   246.80), SIMDE_FLOAT64_C(   545.97), SIMDE_FLOAT64_C(   -11.21) },
+      { SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     7.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     3.00) } },
+    { { SIMDE_FLOAT64_C(   416.49), SIMDE_FLOAT64_C(  -865.26), SIMDE_FLOAT64_C(  -612.80), SIMDE_FLOAT64_C(  -298.82) },
+      { SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     8.00) } },
+    { { SIMDE_FLOAT64_C(  -745.31), SIMDE_FLOAT64_C(  -336.77), SIMDE_FLOAT64_C(  -137.42), SIMDE_FLOAT64_C(  -363.28) },
+      { SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     7.00), SIMDE_FLOAT64_C(     8.00) } },
+    { { SIMDE_FLOAT64_C(  -747.61), SIMDE_FLOAT64_C(  -843.15), SIMDE_FLOAT64_C(  -532.00), SIMDE_FLOAT64_C(    45.18) },
+      { SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     5.00) } },
+    { { SIMDE_FLOAT64_C(  -293.46), SIMDE_FLOAT64_C(  -669.66), SIMDE_FLOAT64_C(   949.95), SIMDE_FLOAT64_C(  -184.71) },
+      { SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     7.00) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256d a = simde_mm256_loadu_pd(test_vec[i].a);
+    simde__m256d r = simde_mm256_getexp_pd(a);
+    simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  simde_float64 values[8 * sizeof(simde__m256d)];
+  simde_test_x86_random_f64x4_full(8, 1, values, -1000.0, 1000.0, SIMDE_TEST_VEC_FLOAT_NAN);
+
+  for (size_t i = 0 ; i < 8 ; i++) {
+    simde__m256d a = simde_test_x86_random_extract_f64x4(i, 1, 0, values);
+    simde__m256d r = simde_mm256_getexp_pd(a);
+
+    simde_test_x86_write_f64x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_mask_getexp_pd (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde_float64 src[4];
+    const simde__mmask8 k;
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT64_C(   370.32), SIMDE_FLOAT64_C(   -41.70), SIMDE_FLOAT64_C(   185.34), SIMDE_FLOAT64_C(   703.24) },
+      UINT8_C(160),
+      {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   538.03),             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(  -364.15) },
+      { SIMDE_FLOAT64_C(   370.32), SIMDE_FLOAT64_C(   -41.70), SIMDE_FLOAT64_C(   185.34), SIMDE_FLOAT64_C(   703.24) } },
+    #endif
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT64_C(   646.77), SIMDE_FLOAT64_C(   -27.30), SIMDE_FLOAT64_C(   253.56), SIMDE_FLOAT64_C(   220.52) },
+      UINT8_C(108),
+      { SIMDE_FLOAT64_C(  -667.08),             SIMDE_MATH_NAN,             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   269.46) },
+      { SIMDE_FLOAT64_C(   646.77), SIMDE_FLOAT64_C(   -27.30),             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     8.00) } },
+    #endif
+    { { SIMDE_FLOAT64_C(   799.10), SIMDE_FLOAT64_C(  -958.93), SIMDE_FLOAT64_C(   924.86), SIMDE_FLOAT64_C(   333.44) },
+      UINT8_C(177),
+      { SIMDE_FLOAT64_C(   908.01), SIMDE_FLOAT64_C(   573.75), SIMDE_FLOAT64_C(  -296.90), SIMDE_FLOAT64_C(  -454.46) },
+      { SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(  -958.93), SIMDE_FLOAT64_C(   924.86), SIMDE_FLOAT64_C(   333.44) } },
+    { { SIMDE_FLOAT64_C(  -691.33), SIMDE_FLOAT64_C(   254.97), SIMDE_FLOAT64_C(   216.33), SIMDE_FLOAT64_C(   -52.84) },
+      UINT8_C(194),
+      { SIMDE_FLOAT64_C(  -179.45), SIMDE_FLOAT64_C(  -750.93), SIMDE_FLOAT64_C(   534.33), SIMDE_FLOAT64_C(  -762.96) },
+      { SIMDE_FLOAT64_C(  -691.33), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(   216.33), SIMDE_FLOAT64_C(   -52.84) } },
+    { { SIMDE_FLOAT64_C(    17.13), SIMDE_FLOAT64_C(  -777.62), SIMDE_FLOAT64_C(  -323.10), SIMDE_FLOAT64_C(   -25.23) },
+      UINT8_C(241),
+      { SIMDE_FLOAT64_C(  -616.20), SIMDE_FLOAT64_C(   921.54), SIMDE_FLOAT64_C(   -61.78), SIMDE_FLOAT64_C(  -361.50) },
+      { SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(  -777.62), SIMDE_FLOAT64_C(  -323.10), SIMDE_FLOAT64_C(   -25.23) } },
+    { { SIMDE_FLOAT64_C(  -440.77), SIMDE_FLOAT64_C(   638.97), SIMDE_FLOAT64_C(  -960.85), SIMDE_FLOAT64_C(  -608.48) },
+      UINT8_C( 73),
+      { SIMDE_FLOAT64_C(  -415.23), SIMDE_FLOAT64_C(   800.80), SIMDE_FLOAT64_C(   275.21), SIMDE_FLOAT64_C(  -162.84) },
+      { SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(   638.97), SIMDE_FLOAT64_C(  -960.85), SIMDE_FLOAT64_C(     7.00) } },
+    { { SIMDE_FLOAT64_C(  -411.35), SIMDE_FLOAT64_C(   761.85), SIMDE_FLOAT64_C(  -923.25), SIMDE_FLOAT64_C(   773.99) },
+      UINT8_C(123),
+      { SIMDE_FLOAT64_C(   957.65), SIMDE_FLOAT64_C(   743.22), SIMDE_FLOAT64_C(   882.34), SIMDE_FLOAT64_C(  -335.81) },
+      { SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(  -923.25), SIMDE_FLOAT64_C(     8.00) } },
+    { { SIMDE_FLOAT64_C(   422.29), SIMDE_FLOAT64_C(   420.76), SIMDE_FLOAT64_C(  -562.21), SIMDE_FLOAT64_C(  -324.15) },
+      UINT8_C( 66),
+      { SIMDE_FLOAT64_C(  -926.44), SIMDE_FLOAT64_C(   832.29), SIMDE_FLOAT64_C(   479.49), SIMDE_FLOAT64_C(  -450.50) },
+      { SIMDE_FLOAT64_C(   422.29), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(  -562.21), SIMDE_FLOAT64_C(  -324.15) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256d src = simde_mm256_loadu_pd(test_vec[i].src);
+    simde__m256d a = simde_mm256_loadu_pd(test_vec[i].a);
+    simde__m256d r = simde_mm256_mask_getexp_pd(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  simde_float64 values[8 * sizeof(simde__m256d)];
+  simde_test_x86_random_f64x4_full(8, 1, values, -1000.0, 1000.0, SIMDE_TEST_VEC_FLOAT_NAN);
+
+  for (size_t i = 0 ; i < 8 ; i++) {
+    simde__m256d src = simde_test_x86_random_f64x4(SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256d a = simde_test_x86_random_extract_f64x4(i, 1, 0, values);
+    simde__m256d r = simde_mm256_mask_getexp_pd(src, k, a);
+
+    simde_test_x86_write_f64x4(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_maskz_getexp_pd (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT8_C(169),
+      {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(  -525.05),             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(  -961.56) },
+      {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     9.00) } },
+    #endif
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT8_C( 44),
+      { SIMDE_FLOAT64_C(   808.39),             SIMDE_MATH_NAN,             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(    63.36) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     5.00) } },
+    #endif
+    { UINT8_C( 92),
+      { SIMDE_FLOAT64_C(  -823.22), SIMDE_FLOAT64_C(   294.27), SIMDE_FLOAT64_C(   -96.90), SIMDE_FLOAT64_C(   193.91) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(     7.00) } },
+    { UINT8_C( 21),
+      { SIMDE_FLOAT64_C(   516.64), SIMDE_FLOAT64_C(   580.00), SIMDE_FLOAT64_C(  -831.32), SIMDE_FLOAT64_C(   482.24) },
+      { SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(164),
+      { SIMDE_FLOAT64_C(  -860.77), SIMDE_FLOAT64_C(   807.65), SIMDE_FLOAT64_C(   521.39), SIMDE_FLOAT64_C(  -469.24) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C( 41),
+      { SIMDE_FLOAT64_C(   -73.90), SIMDE_FLOAT64_C(  -889.96), SIMDE_FLOAT64_C(  -707.40), SIMDE_FLOAT64_C(     2.85) },
+      { SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.00) } },
+    { UINT8_C(  3),
+      { SIMDE_FLOAT64_C(   884.03), SIMDE_FLOAT64_C(   757.69), SIMDE_FLOAT64_C(  -574.85), SIMDE_FLOAT64_C(   304.79) },
+      { SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(220),
+      { SIMDE_FLOAT64_C(  -804.52), SIMDE_FLOAT64_C(   101.00), SIMDE_FLOAT64_C(   946.07), SIMDE_FLOAT64_C(  -690.94) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     9.00) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256d a = simde_mm256_loadu_pd(test_vec[i].a);
+    simde__m256d r = simde_mm256_maskz_getexp_pd(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  simde_float64 values[8 * sizeof(simde__m256d)];
+  simde_test_x86_random_f64x4_full(8, 1, values, -1000.0, 1000.0, SIMDE_TEST_VEC_FLOAT_NAN);
+
+  for (size_t i = 0 ; i < 8 ; i++) {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256d a = simde_test_x86_random_extract_f64x4(i, 1, 0, values);
+    simde__m256d r = simde_mm256_maskz_getexp_pd(k, a);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_getexp_pd (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   350.80),             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   505.52),
+        SIMDE_FLOAT64_C(   -69.20), SIMDE_FLOAT64_C(   128.22), SIMDE_FLOAT64_C(   -12.24), SIMDE_FLOAT64_C(    70.04) },
+      {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     8.00),             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     8.00),
+        SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(     7.00), SIMDE_FLOAT64_C(     3.00), SIMDE_FLOAT64_C(     6.00) } },
+    #endif
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT64_C(   -64.13),             SIMDE_MATH_NAN,             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   861.97),
+        SIMDE_FLOAT64_C(  -380.81), SIMDE_FLOAT64_C(   893.40), SIMDE_FLOAT64_C(  -135.17), SIMDE_FLOAT64_C(  -496.78) },
+      { SIMDE_FLOAT64_C(     6.00),             SIMDE_MATH_NAN,             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     9.00),
+        SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     7.00), SIMDE_FLOAT64_C(     8.00) } },
+    #endif
+    { { SIMDE_FLOAT64_C(   651.09), SIMDE_FLOAT64_C(   289.97), SIMDE_FLOAT64_C(   808.01), SIMDE_FLOAT64_C(   846.57),
+        SIMDE_FLOAT64_C(  -609.03), SIMDE_FLOAT64_C(   754.07), SIMDE_FLOAT64_C(  -844.37), SIMDE_FLOAT64_C(   966.93) },
+      { SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     9.00),
+        SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     9.00) } },
+    { { SIMDE_FLOAT64_C(  -617.52), SIMDE_FLOAT64_C(  -496.86), SIMDE_FLOAT64_C(   351.27), SIMDE_FLOAT64_C(   971.34),
+        SIMDE_FLOAT64_C(   197.75), SIMDE_FLOAT64_C(   798.97), SIMDE_FLOAT64_C(   736.97), SIMDE_FLOAT64_C(   186.62) },
+      { SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     9.00),
+        SIMDE_FLOAT64_C(     7.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     7.00) } },
+    { { SIMDE_FLOAT64_C(   149.77), SIMDE_FLOAT64_C(  -303.48), SIMDE_FLOAT64_C(  -307.85), SIMDE_FLOAT64_C(  -919.43),
+        SIMDE_FLOAT64_C(   824.74), SIMDE_FLOAT64_C(   679.91), SIMDE_FLOAT64_C(   150.61), SIMDE_FLOAT64_C(  -239.39) },
+      { SIMDE_FLOAT64_C(     7.00), SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     9.00),
+        SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     7.00), SIMDE_FLOAT64_C(     7.00) } },
+    { { SIMDE_FLOAT64_C(  -810.94), SIMDE_FLOAT64_C(  -248.60), SIMDE_FLOAT64_C(  -377.41), SIMDE_FLOAT64_C(  -191.75),
+        SIMDE_FLOAT64_C(  -355.20), SIMDE_FLOAT64_C(   487.41), SIMDE_FLOAT64_C(   311.47), SIMDE_FLOAT64_C(  -704.11) },
+      { SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     7.00), SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     7.00),
+        SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     9.00) } },
+    { { SIMDE_FLOAT64_C(  -222.61), SIMDE_FLOAT64_C(   119.47), SIMDE_FLOAT64_C(  -857.53), SIMDE_FLOAT64_C(   168.36),
+        SIMDE_FLOAT64_C(  -126.46), SIMDE_FLOAT64_C(  -701.90), SIMDE_FLOAT64_C(   135.29), SIMDE_FLOAT64_C(   256.02) },
+      { SIMDE_FLOAT64_C(     7.00), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     7.00),
+        SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     7.00), SIMDE_FLOAT64_C(     8.00) } },
+    { { SIMDE_FLOAT64_C(  -198.76), SIMDE_FLOAT64_C(  -513.44), SIMDE_FLOAT64_C(   227.36), SIMDE_FLOAT64_C(   998.98),
+        SIMDE_FLOAT64_C(  -714.48), SIMDE_FLOAT64_C(   -35.67), SIMDE_FLOAT64_C(   185.61), SIMDE_FLOAT64_C(   435.29) },
+      { SIMDE_FLOAT64_C(     7.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     7.00), SIMDE_FLOAT64_C(     9.00),
+        SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(     7.00), SIMDE_FLOAT64_C(     8.00) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_getexp_pd(a);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  simde_float64 values[8 * sizeof(simde__m512d)];
+  simde_test_x86_random_f64x8_full(8, 1, values, -1000.0, 1000.0, SIMDE_TEST_VEC_FLOAT_NAN);
+
+  for (size_t i = 0 ; i < 8 ; i++) {
+    simde__m512d a = simde_test_x86_random_extract_f64x8(i, 1, 0, values);
+    simde__m512d r = simde_mm512_getexp_pd(a);
+
+    simde_test_x86_write_f64x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_mask_getexp_pd (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde_float64 src[8];
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT64_C(   735.84), SIMDE_FLOAT64_C(   420.91), SIMDE_FLOAT64_C(   833.97), SIMDE_FLOAT64_C(   562.80),
+        SIMDE_FLOAT64_C(  -879.29), SIMDE_FLOAT64_C(   801.06), SIMDE_FLOAT64_C(  -192.37), SIMDE_FLOAT64_C(   689.30) },
+      UINT8_C(234),
+      {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   877.75),             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   485.59),
+        SIMDE_FLOAT64_C(   557.66), SIMDE_FLOAT64_C(  -333.53), SIMDE_FLOAT64_C(  -753.80), SIMDE_FLOAT64_C(   746.72) },
+      { SIMDE_FLOAT64_C(   735.84), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(   833.97), SIMDE_FLOAT64_C(     8.00),
+        SIMDE_FLOAT64_C(  -879.29), SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     9.00) } },
+    #endif
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT64_C(  -884.87), SIMDE_FLOAT64_C(   614.09), SIMDE_FLOAT64_C(  -288.40), SIMDE_FLOAT64_C(   781.19),
+        SIMDE_FLOAT64_C(  -327.52), SIMDE_FLOAT64_C(  -914.01), SIMDE_FLOAT64_C(   948.28), SIMDE_FLOAT64_C(  -967.17) },
+      UINT8_C(215),
+      { SIMDE_FLOAT64_C(   417.87),             SIMDE_MATH_NAN,             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(  -937.33),
+        SIMDE_FLOAT64_C(  -643.80), SIMDE_FLOAT64_C(   866.43), SIMDE_FLOAT64_C(  -641.44), SIMDE_FLOAT64_C(   133.59) },
+      { SIMDE_FLOAT64_C(     8.00),             SIMDE_MATH_NAN,             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   781.19),
+        SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(  -914.01), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     7.00) } },
+    #endif
+    { { SIMDE_FLOAT64_C(   -85.50), SIMDE_FLOAT64_C(  -169.58), SIMDE_FLOAT64_C(   669.15), SIMDE_FLOAT64_C(   481.08),
+        SIMDE_FLOAT64_C(   551.83), SIMDE_FLOAT64_C(  -638.71), SIMDE_FLOAT64_C(   647.00), SIMDE_FLOAT64_C(  -517.44) },
+      UINT8_C(  5),
+      { SIMDE_FLOAT64_C(   -14.10), SIMDE_FLOAT64_C(  -498.97), SIMDE_FLOAT64_C(  -698.04), SIMDE_FLOAT64_C(   859.45),
+        SIMDE_FLOAT64_C(  -200.87), SIMDE_FLOAT64_C(   437.25), SIMDE_FLOAT64_C(   115.47), SIMDE_FLOAT64_C(   600.36) },
+      { SIMDE_FLOAT64_C(     3.00), SIMDE_FLOAT64_C(  -169.58), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(   481.08),
+        SIMDE_FLOAT64_C(   551.83), SIMDE_FLOAT64_C(  -638.71), SIMDE_FLOAT64_C(   647.00), SIMDE_FLOAT64_C(  -517.44) } },
+    { { SIMDE_FLOAT64_C(  -402.11), SIMDE_FLOAT64_C(    57.92), SIMDE_FLOAT64_C(   327.90), SIMDE_FLOAT64_C(  -788.52),
+        SIMDE_FLOAT64_C(  -206.24), SIMDE_FLOAT64_C(  -251.19), SIMDE_FLOAT64_C(  -954.55), SIMDE_FLOAT64_C(  -643.45) },
+      UINT8_C( 83),
+      { SIMDE_FLOAT64_C(   923.81), SIMDE_FLOAT64_C(  -657.17), SIMDE_FLOAT64_C(   599.35), SIMDE_FLOAT64_C(  -790.67),
+        SIMDE_FLOAT64_C(   307.16), SIMDE_FLOAT64_C(  -215.04), SIMDE_FLOAT64_C(   644.62), SIMDE_FLOAT64_C(   -31.99) },
+      { SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(   327.90), SIMDE_FLOAT64_C(  -788.52),
+        SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(  -251.19), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(  -643.45) } },
+    { { SIMDE_FLOAT64_C(   846.50), SIMDE_FLOAT64_C(   164.18), SIMDE_FLOAT64_C(  -441.19), SIMDE_FLOAT64_C(  -830.38),
+        SIMDE_FLOAT64_C(   279.31), SIMDE_FLOAT64_C(  -827.10), SIMDE_FLOAT64_C(  -118.78), SIMDE_FLOAT64_C(    60.50) },
+      UINT8_C( 86),
+      { SIMDE_FLOAT64_C(  -337.29), SIMDE_FLOAT64_C(   160.49), SIMDE_FLOAT64_C(  -546.40), SIMDE_FLOAT64_C(  -779.63),
+        SIMDE_FLOAT64_C(   826.96), SIMDE_FLOAT64_C(  -300.20), SIMDE_FLOAT64_C(   967.09), SIMDE_FLOAT64_C(   244.83) },
+      { SIMDE_FLOAT64_C(   846.50), SIMDE_FLOAT64_C(     7.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(  -830.38),
+        SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(  -827.10), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(    60.50) } },
+    { { SIMDE_FLOAT64_C(   -32.79), SIMDE_FLOAT64_C(     8.77), SIMDE_FLOAT64_C(  -121.79), SIMDE_FLOAT64_C(  -712.95),
+        SIMDE_FLOAT64_C(   923.27), SIMDE_FLOAT64_C(   708.64), SIMDE_FLOAT64_C(   956.20), SIMDE_FLOAT64_C(   404.34) },
+      UINT8_C(223),
+      { SIMDE_FLOAT64_C(   568.59), SIMDE_FLOAT64_C(  -477.94), SIMDE_FLOAT64_C(   307.50), SIMDE_FLOAT64_C(   924.79),
+        SIMDE_FLOAT64_C(  -611.51), SIMDE_FLOAT64_C(   666.06), SIMDE_FLOAT64_C(    58.39), SIMDE_FLOAT64_C(   374.39) },
+      { SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     9.00),
+        SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(   708.64), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(     8.00) } },
+    { { SIMDE_FLOAT64_C(  -682.52), SIMDE_FLOAT64_C(    51.35), SIMDE_FLOAT64_C(   743.02), SIMDE_FLOAT64_C(  -321.93),
+        SIMDE_FLOAT64_C(   649.24), SIMDE_FLOAT64_C(  -199.06), SIMDE_FLOAT64_C(  -994.03), SIMDE_FLOAT64_C(   860.72) },
+      UINT8_C( 64),
+      { SIMDE_FLOAT64_C(  -832.91), SIMDE_FLOAT64_C(   360.35), SIMDE_FLOAT64_C(   233.84), SIMDE_FLOAT64_C(   -33.78),
+        SIMDE_FLOAT64_C(  -202.40), SIMDE_FLOAT64_C(  -650.69), SIMDE_FLOAT64_C(  -433.42), SIMDE_FLOAT64_C(  -278.60) },
+      { SIMDE_FLOAT64_C(  -682.52), SIMDE_FLOAT64_C(    51.35), SIMDE_FLOAT64_C(   743.02), SIMDE_FLOAT64_C(  -321.93),
+        SIMDE_FLOAT64_C(   649.24), SIMDE_FLOAT64_C(  -199.06), SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(   860.72) } },
+    { { SIMDE_FLOAT64_C(  -245.22), SIMDE_FLOAT64_C(   906.17), SIMDE_FLOAT64_C(   951.25), SIMDE_FLOAT64_C(   624.29),
+        SIMDE_FLOAT64_C(   752.67), SIMDE_FLOAT64_C(   115.43), SIMDE_FLOAT64_C(  -816.89), SIMDE_FLOAT64_C(   922.29) },
+      UINT8_C(200),
+      { SIMDE_FLOAT64_C(  -307.86), SIMDE_FLOAT64_C(  -834.07), SIMDE_FLOAT64_C(   -69.27), SIMDE_FLOAT64_C(   999.30),
+        SIMDE_FLOAT64_C(   -49.12), SIMDE_FLOAT64_C(  -424.64), SIMDE_FLOAT64_C(   -32.69), SIMDE_FLOAT64_C(   613.59) },
+      { SIMDE_FLOAT64_C(  -245.22), SIMDE_FLOAT64_C(   906.17), SIMDE_FLOAT64_C(   951.25), SIMDE_FLOAT64_C(     9.00),
+        SIMDE_FLOAT64_C(   752.67), SIMDE_FLOAT64_C(   115.43), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(     9.00) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d src = simde_mm512_loadu_pd(test_vec[i].src);
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_mask_getexp_pd(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  simde_float64 values[8 * sizeof(simde__m512d)];
+  simde_test_x86_random_f64x8_full(8, 1, values, -1000.0, 1000.0, SIMDE_TEST_VEC_FLOAT_NAN);
+
+  for (size_t i = 0 ; i < 8 ; i++) {
+    simde__m512d src = simde_test_x86_random_f64x8(SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m512d a = simde_test_x86_random_extract_f64x8(i, 1, 0, values);
+    simde__m512d r = simde_mm512_mask_getexp_pd(src, k, a);
+
+    simde_test_x86_write_f64x8(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_maskz_getexp_pd (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT8_C( 55),
+      {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(  -196.50),             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   201.40),
+        SIMDE_FLOAT64_C(   770.72), SIMDE_FLOAT64_C(  -536.00), SIMDE_FLOAT64_C(  -920.39), SIMDE_FLOAT64_C(  -942.24) },
+      {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     7.00),             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     0.00),
+        SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    #endif
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT8_C(133),
+      { SIMDE_FLOAT64_C(  -612.73),             SIMDE_MATH_NAN,             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   791.62),
+        SIMDE_FLOAT64_C(    48.71), SIMDE_FLOAT64_C(  -668.56), SIMDE_FLOAT64_C(  -157.03), SIMDE_FLOAT64_C(  -208.27) },
+      { SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     0.00),             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     0.00),
+        SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     7.00) } },
+    #endif
+    { UINT8_C(190),
+      { SIMDE_FLOAT64_C(     9.51), SIMDE_FLOAT64_C(  -507.80), SIMDE_FLOAT64_C(   592.67), SIMDE_FLOAT64_C(    15.49),
+        SIMDE_FLOAT64_C(  -647.07), SIMDE_FLOAT64_C(   187.36), SIMDE_FLOAT64_C(   770.27), SIMDE_FLOAT64_C(  -740.91) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     3.00),
+        SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     7.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     9.00) } },
+    { UINT8_C(124),
+      { SIMDE_FLOAT64_C(   138.61), SIMDE_FLOAT64_C(   394.56), SIMDE_FLOAT64_C(  -988.24), SIMDE_FLOAT64_C(  -745.97),
+        SIMDE_FLOAT64_C(   577.67), SIMDE_FLOAT64_C(   934.05), SIMDE_FLOAT64_C(  -351.23), SIMDE_FLOAT64_C(   933.68) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     9.00),
+        SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(159),
+      { SIMDE_FLOAT64_C(  -262.45), SIMDE_FLOAT64_C(  -896.00), SIMDE_FLOAT64_C(   135.08), SIMDE_FLOAT64_C(  -491.73),
+        SIMDE_FLOAT64_C(  -432.00), SIMDE_FLOAT64_C(   214.68), SIMDE_FLOAT64_C(  -433.97), SIMDE_FLOAT64_C(   -44.73) },
+      { SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     7.00), SIMDE_FLOAT64_C(     8.00),
+        SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     5.00) } },
+    { UINT8_C( 60),
+      { SIMDE_FLOAT64_C(     2.93), SIMDE_FLOAT64_C(  -420.01), SIMDE_FLOAT64_C(  -253.11), SIMDE_FLOAT64_C(  -948.36),
+        SIMDE_FLOAT64_C(   -88.57), SIMDE_FLOAT64_C(   589.86), SIMDE_FLOAT64_C(  -156.64), SIMDE_FLOAT64_C(   920.95) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     7.00), SIMDE_FLOAT64_C(     9.00),
+        SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(108),
+      { SIMDE_FLOAT64_C(  -917.94), SIMDE_FLOAT64_C(  -563.97), SIMDE_FLOAT64_C(   -63.57), SIMDE_FLOAT64_C(  -565.01),
+        SIMDE_FLOAT64_C(   623.39), SIMDE_FLOAT64_C(  -293.30), SIMDE_FLOAT64_C(  -305.92), SIMDE_FLOAT64_C(  -238.00) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(     9.00),
+        SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     0.00) } },
+    {    UINT8_MAX,
+      { SIMDE_FLOAT64_C(  -898.74), SIMDE_FLOAT64_C(  -294.16), SIMDE_FLOAT64_C(    16.03), SIMDE_FLOAT64_C(   678.93),
+        SIMDE_FLOAT64_C(  -360.11), SIMDE_FLOAT64_C(   664.80), SIMDE_FLOAT64_C(   612.61), SIMDE_FLOAT64_C(   377.45) },
+      { SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     4.00), SIMDE_FLOAT64_C(     9.00),
+        SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(     8.00) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_maskz_getexp_pd(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  simde_float64 values[8 * sizeof(simde__m512d)];
+  simde_test_x86_random_f64x8_full(8, 1, values, -1000.0, 1000.0, SIMDE_TEST_VEC_FLOAT_NAN);
+
+  for (size_t i = 0 ; i < 8 ; i++) {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m512d a = simde_test_x86_random_extract_f64x8(i, 1, 0, values);
+    simde__m512d r = simde_mm512_maskz_getexp_pd(k, a);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_getexp_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_getexp_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_getexp_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_getexp_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_getexp_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_getexp_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_getexp_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_getexp_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_getexp_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_getexp_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_getexp_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_getexp_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_getexp_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_getexp_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_getexp_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_getexp_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_getexp_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_getexp_pd)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
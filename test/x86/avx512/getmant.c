@@ -0,0 +1,3253 @@
+#define SIMDE_TEST_X86_AVX512_INSN getmant
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/getmant.h>
+
+static int
+test_simde_mm_getmant_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   576.48), SIMDE_FLOAT32_C(   358.78), SIMDE_FLOAT32_C(   785.72), SIMDE_FLOAT32_C(   904.18) },
+      { SIMDE_FLOAT32_C(     0.56), SIMDE_FLOAT32_C(     1.40), SIMDE_FLOAT32_C(     0.77), SIMDE_FLOAT32_C(     0.88) } },
+    { { SIMDE_FLOAT32_C(  -200.90), SIMDE_FLOAT32_C(    23.13), SIMDE_FLOAT32_C(    13.04), SIMDE_FLOAT32_C(   319.90) },
+      { SIMDE_FLOAT32_C(     0.78), SIMDE_FLOAT32_C(     0.72), SIMDE_FLOAT32_C(     0.81), SIMDE_FLOAT32_C(     0.62) } },
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(  1.0e-40),     -SIMDE_MATH_INFINITYF },
+      { SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(    -1.00), SIMDE_FLOAT32_C(     1.09), SIMDE_FLOAT32_C(    -1.00) } },
+    { {      SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C( -2.5e-39), SIMDE_FLOAT32_C(     0.25), SIMDE_FLOAT32_C(    -0.75) },
+      { SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     0.85), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     0.75) } },
+    { {      SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C( -2.5e-39), SIMDE_FLOAT32_C(     0.25), SIMDE_FLOAT32_C(    -0.75) },
+      { SIMDE_FLOAT32_C(     1.00),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     0.50),            SIMDE_MATH_NANF } },
+    { { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(  1.0e-40),     -SIMDE_MATH_INFINITYF },
+      { SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(    -1.00), SIMDE_FLOAT32_C(     1.09), SIMDE_FLOAT32_C(    -1.00) } },
+    { { SIMDE_FLOAT32_C(  -258.43), SIMDE_FLOAT32_C(   478.26), SIMDE_FLOAT32_C(   703.49), SIMDE_FLOAT32_C(  -579.06) },
+      {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     1.87), SIMDE_FLOAT32_C(     1.37),            SIMDE_MATH_NANF } },
+    { { SIMDE_FLOAT32_C(   126.77), SIMDE_FLOAT32_C(  -483.86), SIMDE_FLOAT32_C(  -852.70), SIMDE_FLOAT32_C(   647.67) },
+      { SIMDE_FLOAT32_C(     0.99),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     1.26) } },
+    #endif
+  };
+
+  simde__m128 a, r;
+
+  a = simde_mm_loadu_ps(test_vec[0].a);
+  r = simde_mm_getmant_ps(a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[0].r), 1);
+
+  a = simde_mm_loadu_ps(test_vec[1].a);
+  r = simde_mm_getmant_ps(a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[1].r), 1);
+
+  #if !defined(SIMDE_FAST_MATH)
+  a = simde_mm_loadu_ps(test_vec[2].a);
+  r = simde_mm_getmant_ps(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[2].r), 1);
+
+  a = simde_mm_loadu_ps(test_vec[3].a);
+  r = simde_mm_getmant_ps(a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[3].r), 1);
+
+  a = simde_mm_loadu_ps(test_vec[4].a);
+  r = simde_mm_getmant_ps(a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[4].r), 1);
+
+  a = simde_mm_loadu_ps(test_vec[5].a);
+  r = simde_mm_getmant_ps(a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[5].r), 1);
+
+  a = simde_mm_loadu_ps(test_vec[6].a);
+  r = simde_mm_getmant_ps(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[6].r), 1);
+
+  a = simde_mm_loadu_ps(test_vec[7].a);
+  r = simde_mm_getmant_ps(a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[7].r), 1);
+  #endif
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  simde_float32 values[8 * sizeof(simde__m128)];
+  simde_test_x86_random_f32x4_full(8, 1, values, -1000.0f, 1000.0f, SIMDE_TEST_VEC_FLOAT_NAN);
+
+  {
+    simde__m128 a = simde_test_x86_random_extract_f32x4(0, 1, 0, values);
+    simde__m128 r = simde_mm_getmant_ps(a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_f32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m128 a = simde_test_x86_random_extract_f32x4(1, 1, 0, values);
+    simde__m128 r = simde_mm_getmant_ps(a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+
+    simde_test_x86_write_f32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m128 a = simde_test_x86_random_extract_f32x4(2, 1, 0, values);
+    simde__m128 r = simde_mm_getmant_ps(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_f32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m128 a = simde_test_x86_random_extract_f32x4(3, 1, 0, values);
+    simde__m128 r = simde_mm_getmant_ps(a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+
+    simde_test_x86_write_f32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m128 a = simde_test_x86_random_extract_f32x4(4, 1, 0, values);
+    simde__m128 r = simde_mm_getmant_ps(a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_f32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m128 a = simde_test_x86_random_extract_f32x4(5, 1, 0, values);
+    simde__m128 r = simde_mm_getmant_ps(a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_f32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m128 a = simde_test_x86_random_extract_f32x4(6, 1, 0, values);
+    simde__m128 r = simde_mm_getmant_ps(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_f32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m128 a = simde_test_x86_random_extract_f32x4(7, 1, 0, values);
+    simde__m128 r = simde_mm_getmant_ps(a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_f32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_mask_getmant_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde_float32 src[4];
+    const simde__mmask8 k;
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   700.52), SIMDE_FLOAT32_C(  -345.49), SIMDE_FLOAT32_C(  -414.51), SIMDE_FLOAT32_C(   624.07) },
+      UINT8_C( 12),
+      { SIMDE_FLOAT32_C(  -308.79), SIMDE_FLOAT32_C(  -131.18), SIMDE_FLOAT32_C(  -989.85), SIMDE_FLOAT32_C(   432.78) },
+      { SIMDE_FLOAT32_C(   700.52), SIMDE_FLOAT32_C(  -345.49), SIMDE_FLOAT32_C(    -0.97), SIMDE_FLOAT32_C(     0.85) } },
+    { { SIMDE_FLOAT32_C(  -775.07), SIMDE_FLOAT32_C(   451.81), SIMDE_FLOAT32_C(   598.45), SIMDE_FLOAT32_C(  -112.49) },
+      UINT8_C(172),
+      { SIMDE_FLOAT32_C(  -652.92), SIMDE_FLOAT32_C(   713.64), SIMDE_FLOAT32_C(   853.72), SIMDE_FLOAT32_C(   923.56) },
+      { SIMDE_FLOAT32_C(  -775.07), SIMDE_FLOAT32_C(   451.81), SIMDE_FLOAT32_C(     1.67), SIMDE_FLOAT32_C(     1.80) } },
+    { { SIMDE_FLOAT32_C(  -210.13), SIMDE_FLOAT32_C(  -323.15), SIMDE_FLOAT32_C(   649.51), SIMDE_FLOAT32_C(  -871.41) },
+      UINT8_C( 82),
+      { SIMDE_FLOAT32_C(    72.42), SIMDE_FLOAT32_C(   639.45), SIMDE_FLOAT32_C(   827.73), SIMDE_FLOAT32_C(   871.52) },
+      { SIMDE_FLOAT32_C(  -210.13), SIMDE_FLOAT32_C(     0.62), SIMDE_FLOAT32_C(   649.51), SIMDE_FLOAT32_C(  -871.41) } },
+    { { SIMDE_FLOAT32_C(  -454.25), SIMDE_FLOAT32_C(  -693.04), SIMDE_FLOAT32_C(   256.89), SIMDE_FLOAT32_C(  -390.83) },
+      UINT8_C( 12),
+      { SIMDE_FLOAT32_C(  -337.43), SIMDE_FLOAT32_C(  -159.22), SIMDE_FLOAT32_C(   191.42), SIMDE_FLOAT32_C(   789.34) },
+      { SIMDE_FLOAT32_C(  -454.25), SIMDE_FLOAT32_C(  -693.04), SIMDE_FLOAT32_C(     0.75), SIMDE_FLOAT32_C(     0.77) } },
+    { { SIMDE_FLOAT32_C(   356.51), SIMDE_FLOAT32_C(   251.67), SIMDE_FLOAT32_C(  -127.68), SIMDE_FLOAT32_C(   970.54) },
+      UINT8_C(213),
+      { SIMDE_FLOAT32_C(   356.92), SIMDE_FLOAT32_C(   338.72), SIMDE_FLOAT32_C(   437.01), SIMDE_FLOAT32_C(  -103.76) },
+      { SIMDE_FLOAT32_C(     1.39), SIMDE_FLOAT32_C(   251.67), SIMDE_FLOAT32_C(     0.85), SIMDE_FLOAT32_C(   970.54) } },
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT32_C(  -821.63), SIMDE_FLOAT32_C(   143.02), SIMDE_FLOAT32_C(  -936.58), SIMDE_FLOAT32_C(   403.01) },
+      UINT8_C(164),
+      {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  -160.35),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   167.17) },
+      { SIMDE_FLOAT32_C(  -821.63), SIMDE_FLOAT32_C(   143.02),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   403.01) } },
+    { { SIMDE_FLOAT32_C(  -357.50), SIMDE_FLOAT32_C(   162.35), SIMDE_FLOAT32_C(  -385.97), SIMDE_FLOAT32_C(  -392.23) },
+      UINT8_C( 50),
+      { SIMDE_FLOAT32_C(   224.65),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   759.33) },
+      { SIMDE_FLOAT32_C(  -357.50),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  -385.97), SIMDE_FLOAT32_C(  -392.23) } },
+    { { SIMDE_FLOAT32_C(   -69.28), SIMDE_FLOAT32_C(   298.98), SIMDE_FLOAT32_C(   353.44), SIMDE_FLOAT32_C(   -59.13) },
+      UINT8_C(141),
+      { SIMDE_FLOAT32_C(  -485.59), SIMDE_FLOAT32_C(   965.27), SIMDE_FLOAT32_C(   322.28), SIMDE_FLOAT32_C(  -683.31) },
+      {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   298.98), SIMDE_FLOAT32_C(     0.63),            SIMDE_MATH_NANF } },
+    #endif
+  };
+
+  simde__m128 src, a, r;
+
+  src = simde_mm_loadu_ps(test_vec[0].src);
+  a = simde_mm_loadu_ps(test_vec[0].a);
+  r = simde_mm_mask_getmant_ps(src, test_vec[0].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[0].r), 1);
+
+  src = simde_mm_loadu_ps(test_vec[1].src);
+  a = simde_mm_loadu_ps(test_vec[1].a);
+  r = simde_mm_mask_getmant_ps(src, test_vec[1].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[1].r), 1);
+
+  src = simde_mm_loadu_ps(test_vec[2].src);
+  a = simde_mm_loadu_ps(test_vec[2].a);
+  r = simde_mm_mask_getmant_ps(src, test_vec[2].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[2].r), 1);
+
+  src = simde_mm_loadu_ps(test_vec[3].src);
+  a = simde_mm_loadu_ps(test_vec[3].a);
+  r = simde_mm_mask_getmant_ps(src, test_vec[3].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[3].r), 1);
+
+  src = simde_mm_loadu_ps(test_vec[4].src);
+  a = simde_mm_loadu_ps(test_vec[4].a);
+  r = simde_mm_mask_getmant_ps(src, test_vec[4].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[4].r), 1);
+
+  #if !defined(SIMDE_FAST_MATH)
+  src = simde_mm_loadu_ps(test_vec[5].src);
+  a = simde_mm_loadu_ps(test_vec[5].a);
+  r = simde_mm_mask_getmant_ps(src, test_vec[5].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[5].r), 1);
+
+  src = simde_mm_loadu_ps(test_vec[6].src);
+  a = simde_mm_loadu_ps(test_vec[6].a);
+  r = simde_mm_mask_getmant_ps(src, test_vec[6].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[6].r), 1);
+
+  src = simde_mm_loadu_ps(test_vec[7].src);
+  a = simde_mm_loadu_ps(test_vec[7].a);
+  r = simde_mm_mask_getmant_ps(src, test_vec[7].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[7].r), 1);
+  #endif
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  simde_float32 values[8 * sizeof(simde__m128)];
+  simde_test_x86_random_f32x4_full(8, 1, values, -1000.0f, 1000.0f, SIMDE_TEST_VEC_FLOAT_NAN);
+
+  {
+    simde__m128 src = simde_test_x86_random_f32x4(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128 a = simde_test_x86_random_extract_f32x4(0, 1, 0, values);
+    simde__m128 r = simde_mm_mask_getmant_ps(src, k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_f32x4(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m128 src = simde_test_x86_random_f32x4(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128 a = simde_test_x86_random_extract_f32x4(1, 1, 0, values);
+    simde__m128 r = simde_mm_mask_getmant_ps(src, k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_f32x4(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m128 src = simde_test_x86_random_f32x4(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128 a = simde_test_x86_random_extract_f32x4(2, 1, 0, values);
+    simde__m128 r = simde_mm_mask_getmant_ps(src, k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_f32x4(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m128 src = simde_test_x86_random_f32x4(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128 a = simde_test_x86_random_extract_f32x4(3, 1, 0, values);
+    simde__m128 r = simde_mm_mask_getmant_ps(src, k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+
+    simde_test_x86_write_f32x4(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m128 src = simde_test_x86_random_f32x4(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128 a = simde_test_x86_random_extract_f32x4(4, 1, 0, values);
+    simde__m128 r = simde_mm_mask_getmant_ps(src, k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_f32x4(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m128 src = simde_test_x86_random_f32x4(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128 a = simde_test_x86_random_extract_f32x4(5, 1, 0, values);
+    simde__m128 r = simde_mm_mask_getmant_ps(src, k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_f32x4(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m128 src = simde_test_x86_random_f32x4(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128 a = simde_test_x86_random_extract_f32x4(6, 1, 0, values);
+    simde__m128 r = simde_mm_mask_getmant_ps(src, k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+
+    simde_test_x86_write_f32x4(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m128 src = simde_test_x86_random_f32x4(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128 a = simde_test_x86_random_extract_f32x4(7, 1, 0, values);
+    simde__m128 r = simde_mm_mask_getmant_ps(src, k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_f32x4(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_maskz_getmant_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { UINT8_C( 38),
+      { SIMDE_FLOAT32_C(   486.78), SIMDE_FLOAT32_C(   822.03), SIMDE_FLOAT32_C(   588.12), SIMDE_FLOAT32_C(   779.36) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.80), SIMDE_FLOAT32_C(     1.15), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(204),
+      { SIMDE_FLOAT32_C(  -621.16), SIMDE_FLOAT32_C(   974.62), SIMDE_FLOAT32_C(    47.46), SIMDE_FLOAT32_C(   635.72) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.74), SIMDE_FLOAT32_C(     0.62) } },
+    { UINT8_C( 44),
+      { SIMDE_FLOAT32_C(  -416.21), SIMDE_FLOAT32_C(  -242.57), SIMDE_FLOAT32_C(    -7.77), SIMDE_FLOAT32_C(   835.46) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.97), SIMDE_FLOAT32_C(     0.82) } },
+    { UINT8_C(240),
+      { SIMDE_FLOAT32_C(   629.75), SIMDE_FLOAT32_C(   -37.23), SIMDE_FLOAT32_C(   694.91), SIMDE_FLOAT32_C(   -13.31) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT8_C(200),
+      {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   -98.74),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  -289.62) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    -1.13) } },
+    { UINT8_C(144),
+      { SIMDE_FLOAT32_C(   842.13),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  -503.36) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(177),
+      { SIMDE_FLOAT32_C(  -524.32), SIMDE_FLOAT32_C(  -965.03), SIMDE_FLOAT32_C(  -776.42), SIMDE_FLOAT32_C(  -299.39) },
+      {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(167),
+      { SIMDE_FLOAT32_C(  -388.10), SIMDE_FLOAT32_C(  -735.03), SIMDE_FLOAT32_C(   428.87), SIMDE_FLOAT32_C(  -259.50) },
+      {            SIMDE_MATH_NANF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     1.68), SIMDE_FLOAT32_C(     0.00) } },
+    #endif
+  };
+
+  simde__m128 a, r;
+
+  a = simde_mm_loadu_ps(test_vec[0].a);
+  r = simde_mm_maskz_getmant_ps(test_vec[0].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[0].r), 1);
+
+  a = simde_mm_loadu_ps(test_vec[1].a);
+  r = simde_mm_maskz_getmant_ps(test_vec[1].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[1].r), 1);
+
+  a = simde_mm_loadu_ps(test_vec[2].a);
+  r = simde_mm_maskz_getmant_ps(test_vec[2].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[2].r), 1);
+
+  a = simde_mm_loadu_ps(test_vec[3].a);
+  r = simde_mm_maskz_getmant_ps(test_vec[3].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[3].r), 1);
+
+  #if !defined(SIMDE_FAST_MATH)
+  a = simde_mm_loadu_ps(test_vec[4].a);
+  r = simde_mm_maskz_getmant_ps(test_vec[4].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[4].r), 1);
+
+  a = simde_mm_loadu_ps(test_vec[5].a);
+  r = simde_mm_maskz_getmant_ps(test_vec[5].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[5].r), 1);
+
+  a = simde_mm_loadu_ps(test_vec[6].a);
+  r = simde_mm_maskz_getmant_ps(test_vec[6].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[6].r), 1);
+
+  a = simde_mm_loadu_ps(test_vec[7].a);
+  r = simde_mm_maskz_getmant_ps(test_vec[7].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[7].r), 1);
+  #endif
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  simde_float32 values[8 * sizeof(simde__m128)];
+  simde_test_x86_random_f32x4_full(8, 1, values, -1000.0f, 1000.0f, SIMDE_TEST_VEC_FLOAT_NAN);
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128 a = simde_test_x86_random_extract_f32x4(0, 1, 0, values);
+    simde__m128 r = simde_mm_maskz_getmant_ps(k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128 a = simde_test_x86_random_extract_f32x4(1, 1, 0, values);
+    simde__m128 r = simde_mm_maskz_getmant_ps(k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128 a = simde_test_x86_random_extract_f32x4(2, 1, 0, values);
+    simde__m128 r = simde_mm_maskz_getmant_ps(k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128 a = simde_test_x86_random_extract_f32x4(3, 1, 0, values);
+    simde__m128 r = simde_mm_maskz_getmant_ps(k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128 a = simde_test_x86_random_extract_f32x4(4, 1, 0, values);
+    simde__m128 r = simde_mm_maskz_getmant_ps(k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128 a = simde_test_x86_random_extract_f32x4(5, 1, 0, values);
+    simde__m128 r = simde_mm_maskz_getmant_ps(k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128 a = simde_test_x86_random_extract_f32x4(6, 1, 0, values);
+    simde__m128 r = simde_mm_maskz_getmant_ps(k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128 a = simde_test_x86_random_extract_f32x4(7, 1, 0, values);
+    simde__m128 r = simde_mm_maskz_getmant_ps(k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_getmant_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   780.08), SIMDE_FLOAT32_C(   719.23), SIMDE_FLOAT32_C(   312.67), SIMDE_FLOAT32_C(  -476.39),
+        SIMDE_FLOAT32_C(   827.21), SIMDE_FLOAT32_C(   515.48), SIMDE_FLOAT32_C(   742.80), SIMDE_FLOAT32_C(   970.16) },
+      { SIMDE_FLOAT32_C(     0.76), SIMDE_FLOAT32_C(     1.40), SIMDE_FLOAT32_C(     1.22), SIMDE_FLOAT32_C(    -0.93),
+        SIMDE_FLOAT32_C(     0.81), SIMDE_FLOAT32_C(     1.01), SIMDE_FLOAT32_C(     1.45), SIMDE_FLOAT32_C(     0.95) } },
+    { { SIMDE_FLOAT32_C(   846.96), SIMDE_FLOAT32_C(  -348.58), SIMDE_FLOAT32_C(    95.20), SIMDE_FLOAT32_C(  -340.44),
+        SIMDE_FLOAT32_C(   299.69), SIMDE_FLOAT32_C(  -117.33), SIMDE_FLOAT32_C(  -944.06), SIMDE_FLOAT32_C(  -294.61) },
+      { SIMDE_FLOAT32_C(     0.83), SIMDE_FLOAT32_C(    -1.36), SIMDE_FLOAT32_C(     1.49), SIMDE_FLOAT32_C(    -1.33),
+        SIMDE_FLOAT32_C(     1.17), SIMDE_FLOAT32_C(    -1.83), SIMDE_FLOAT32_C(    -0.92), SIMDE_FLOAT32_C(    -1.15) } },
+    { { SIMDE_FLOAT32_C(   662.36), SIMDE_FLOAT32_C(   287.79), SIMDE_FLOAT32_C(   740.85), SIMDE_FLOAT32_C(   404.83),
+        SIMDE_FLOAT32_C(  -785.45), SIMDE_FLOAT32_C(   763.00), SIMDE_FLOAT32_C(    11.33), SIMDE_FLOAT32_C(   994.63) },
+      { SIMDE_FLOAT32_C(     0.65), SIMDE_FLOAT32_C(     0.56), SIMDE_FLOAT32_C(     0.72), SIMDE_FLOAT32_C(     0.79),
+        SIMDE_FLOAT32_C(     0.77), SIMDE_FLOAT32_C(     0.75), SIMDE_FLOAT32_C(     0.71), SIMDE_FLOAT32_C(     0.97) } },
+    #if !defined(SIMDE_FAST_MATH)
+    { {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  -573.61),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   629.73),
+        SIMDE_FLOAT32_C(  -751.58), SIMDE_FLOAT32_C(   507.94), SIMDE_FLOAT32_C(   409.10), SIMDE_FLOAT32_C(  -139.68) },
+      {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    -1.12),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     1.23),
+        SIMDE_FLOAT32_C(    -1.47), SIMDE_FLOAT32_C(     1.98), SIMDE_FLOAT32_C(     1.60), SIMDE_FLOAT32_C(    -1.09) } },
+    { { SIMDE_FLOAT32_C(   772.91),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  -848.26),
+        SIMDE_FLOAT32_C(  -187.41), SIMDE_FLOAT32_C(  -351.73), SIMDE_FLOAT32_C(   787.46), SIMDE_FLOAT32_C(   396.39) },
+      { SIMDE_FLOAT32_C(     0.75),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     0.83),
+        SIMDE_FLOAT32_C(     0.73), SIMDE_FLOAT32_C(     1.37), SIMDE_FLOAT32_C(     0.77), SIMDE_FLOAT32_C(     1.55) } },
+    { { SIMDE_FLOAT32_C(   405.70), SIMDE_FLOAT32_C(  -220.30), SIMDE_FLOAT32_C(   231.85), SIMDE_FLOAT32_C(    35.45),
+        SIMDE_FLOAT32_C(   742.47), SIMDE_FLOAT32_C(   -73.25), SIMDE_FLOAT32_C(  -977.85), SIMDE_FLOAT32_C(   606.50) },
+      { SIMDE_FLOAT32_C(     0.79),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     0.91), SIMDE_FLOAT32_C(     0.55),
+        SIMDE_FLOAT32_C(     0.73),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     0.59) } },
+    { { SIMDE_FLOAT32_C(   941.86), SIMDE_FLOAT32_C(   662.62), SIMDE_FLOAT32_C(   599.90), SIMDE_FLOAT32_C(  -809.72),
+        SIMDE_FLOAT32_C(   170.55), SIMDE_FLOAT32_C(     8.99), SIMDE_FLOAT32_C(    50.60), SIMDE_FLOAT32_C(   -56.54) },
+      { SIMDE_FLOAT32_C(     1.84), SIMDE_FLOAT32_C(     1.29), SIMDE_FLOAT32_C(     1.17),            SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(     1.33), SIMDE_FLOAT32_C(     1.12), SIMDE_FLOAT32_C(     1.58),            SIMDE_MATH_NANF } },
+    { { SIMDE_FLOAT32_C(   482.23), SIMDE_FLOAT32_C(  -676.00), SIMDE_FLOAT32_C(  -481.76), SIMDE_FLOAT32_C(   309.44),
+        SIMDE_FLOAT32_C(   839.48), SIMDE_FLOAT32_C(  -738.96), SIMDE_FLOAT32_C(   279.60), SIMDE_FLOAT32_C(   781.34) },
+      { SIMDE_FLOAT32_C(     0.94),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     1.21),
+        SIMDE_FLOAT32_C(     0.82),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     1.09), SIMDE_FLOAT32_C(     0.76) } },
+    #endif
+  };
+
+  simde__m256 a, r;
+
+  a = simde_mm256_loadu_ps(test_vec[0].a);
+  r = simde_mm256_getmant_ps(a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[0].r), 1);
+
+  a = simde_mm256_loadu_ps(test_vec[1].a);
+  r = simde_mm256_getmant_ps(a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[1].r), 1);
+
+  a = simde_mm256_loadu_ps(test_vec[2].a);
+  r = simde_mm256_getmant_ps(a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[2].r), 1);
+
+  #if !defined(SIMDE_FAST_MATH)
+  a = simde_mm256_loadu_ps(test_vec[3].a);
+  r = simde_mm256_getmant_ps(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[3].r), 1);
+
+  a = simde_mm256_loadu_ps(test_vec[4].a);
+  r = simde_mm256_getmant_ps(a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[4].r), 1);
+
+  a = simde_mm256_loadu_ps(test_vec[5].a);
+  r = simde_mm256_getmant_ps(a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[5].r), 1);
+
+  a = simde_mm256_loadu_ps(test_vec[6].a);
+  r = simde_mm256_getmant_ps(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[6].r), 1);
+
+  a = simde_mm256_loadu_ps(test_vec[7].a);
+  r = simde_mm256_getmant_ps(a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[7].r), 1);
+  #endif
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  simde_float32 values[8 * sizeof(simde__m256)];
+  simde_test_x86_random_f32x8_full(8, 1, values, -1000.0f, 1000.0f, SIMDE_TEST_VEC_FLOAT_NAN);
+
+  {
+    simde__m256 a = simde_test_x86_random_extract_f32x8(0, 1, 0, values);
+    simde__m256 r = simde_mm256_getmant_ps(a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_f32x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m256 a = simde_test_x86_random_extract_f32x8(1, 1, 0, values);
+    simde__m256 r = simde_mm256_getmant_ps(a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_f32x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m256 a = simde_test_x86_random_extract_f32x8(2, 1, 0, values);
+    simde__m256 r = simde_mm256_getmant_ps(a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+
+    simde_test_x86_write_f32x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m256 a = simde_test_x86_random_extract_f32x8(3, 1, 0, values);
+    simde__m256 r = simde_mm256_getmant_ps(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_f32x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m256 a = simde_test_x86_random_extract_f32x8(4, 1, 0, values);
+    simde__m256 r = simde_mm256_getmant_ps(a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+
+    simde_test_x86_write_f32x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m256 a = simde_test_x86_random_extract_f32x8(5, 1, 0, values);
+    simde__m256 r = simde_mm256_getmant_ps(a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_f32x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m256 a = simde_test_x86_random_extract_f32x8(6, 1, 0, values);
+    simde__m256 r = simde_mm256_getmant_ps(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_f32x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m256 a = simde_test_x86_random_extract_f32x8(7, 1, 0, values);
+    simde__m256 r = simde_mm256_getmant_ps(a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_f32x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_mask_getmant_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde_float32 src[8];
+    const simde__mmask8 k;
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   105.02), SIMDE_FLOAT32_C(  -285.34), SIMDE_FLOAT32_C(   634.90), SIMDE_FLOAT32_C(    91.74),
+        SIMDE_FLOAT32_C(   225.59), SIMDE_FLOAT32_C(   467.35), SIMDE_FLOAT32_C(   100.28), SIMDE_FLOAT32_C(  -230.75) },
+      UINT8_C(230),
+      { SIMDE_FLOAT32_C(  -581.93), SIMDE_FLOAT32_C(  -533.84), SIMDE_FLOAT32_C(   974.23), SIMDE_FLOAT32_C(  -742.45),
+        SIMDE_FLOAT32_C(  -272.80), SIMDE_FLOAT32_C(   253.83), SIMDE_FLOAT32_C(  -961.10), SIMDE_FLOAT32_C(  -349.14) },
+      { SIMDE_FLOAT32_C(   105.02), SIMDE_FLOAT32_C(    -1.04), SIMDE_FLOAT32_C(     0.95), SIMDE_FLOAT32_C(    91.74),
+        SIMDE_FLOAT32_C(   225.59), SIMDE_FLOAT32_C(     0.99), SIMDE_FLOAT32_C(    -0.94), SIMDE_FLOAT32_C(    -1.36) } },
+    { { SIMDE_FLOAT32_C(  -831.33), SIMDE_FLOAT32_C(  -696.65), SIMDE_FLOAT32_C(   -90.71), SIMDE_FLOAT32_C(   327.17),
+        SIMDE_FLOAT32_C(  -669.95), SIMDE_FLOAT32_C(  -541.94), SIMDE_FLOAT32_C(  -271.17), SIMDE_FLOAT32_C(   -17.91) },
+      UINT8_C( 56),
+      { SIMDE_FLOAT32_C(   -84.38), SIMDE_FLOAT32_C(  -847.73), SIMDE_FLOAT32_C(   679.70), SIMDE_FLOAT32_C(   -68.84),
+        SIMDE_FLOAT32_C(  -396.78), SIMDE_FLOAT32_C(   358.42), SIMDE_FLOAT32_C(  -390.93), SIMDE_FLOAT32_C(  -658.04) },
+      { SIMDE_FLOAT32_C(  -831.33), SIMDE_FLOAT32_C(  -696.65), SIMDE_FLOAT32_C(   -90.71), SIMDE_FLOAT32_C(    -1.08),
+        SIMDE_FLOAT32_C(    -1.55), SIMDE_FLOAT32_C(     1.40), SIMDE_FLOAT32_C(  -271.17), SIMDE_FLOAT32_C(   -17.91) } },
+    { { SIMDE_FLOAT32_C(  -160.19), SIMDE_FLOAT32_C(  -766.30), SIMDE_FLOAT32_C(  -574.97), SIMDE_FLOAT32_C(  -612.68),
+        SIMDE_FLOAT32_C(   338.72), SIMDE_FLOAT32_C(   139.68), SIMDE_FLOAT32_C(  -977.78), SIMDE_FLOAT32_C(  -569.54) },
+      UINT8_C(  1),
+      { SIMDE_FLOAT32_C(  -222.01), SIMDE_FLOAT32_C(   691.81), SIMDE_FLOAT32_C(  -704.75), SIMDE_FLOAT32_C(   960.55),
+        SIMDE_FLOAT32_C(   785.89), SIMDE_FLOAT32_C(  -756.83), SIMDE_FLOAT32_C(  -374.66), SIMDE_FLOAT32_C(  -796.04) },
+      { SIMDE_FLOAT32_C(     0.87), SIMDE_FLOAT32_C(  -766.30), SIMDE_FLOAT32_C(  -574.97), SIMDE_FLOAT32_C(  -612.68),
+        SIMDE_FLOAT32_C(   338.72), SIMDE_FLOAT32_C(   139.68), SIMDE_FLOAT32_C(  -977.78), SIMDE_FLOAT32_C(  -569.54) } },
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT32_C(  -489.07), SIMDE_FLOAT32_C(   832.46), SIMDE_FLOAT32_C(  -991.46), SIMDE_FLOAT32_C(   543.67),
+        SIMDE_FLOAT32_C(   615.20), SIMDE_FLOAT32_C(   765.80), SIMDE_FLOAT32_C(  -749.96), SIMDE_FLOAT32_C(  -469.18) },
+      UINT8_C(189),
+      {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  -120.51),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    94.21),
+        SIMDE_FLOAT32_C(   888.49), SIMDE_FLOAT32_C(    22.22), SIMDE_FLOAT32_C(  -962.33), SIMDE_FLOAT32_C(   735.45) },
+      {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   832.46),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     1.47),
+        SIMDE_FLOAT32_C(     1.74), SIMDE_FLOAT32_C(     1.39), SIMDE_FLOAT32_C(  -749.96), SIMDE_FLOAT32_C(     1.44) } },
+    { { SIMDE_FLOAT32_C(   929.74), SIMDE_FLOAT32_C(   461.99), SIMDE_FLOAT32_C(  -478.72), SIMDE_FLOAT32_C(   288.16),
+        SIMDE_FLOAT32_C(  -928.94), SIMDE_FLOAT32_C(  -136.76), SIMDE_FLOAT32_C(  -933.85), SIMDE_FLOAT32_C(   762.87) },
+      UINT8_C(195),
+      { SIMDE_FLOAT32_C(   673.64),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   -26.67),
+        SIMDE_FLOAT32_C(  -984.45), SIMDE_FLOAT32_C(  -549.05), SIMDE_FLOAT32_C(   678.72), SIMDE_FLOAT32_C(   677.91) },
+      { SIMDE_FLOAT32_C(     0.66),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  -478.72), SIMDE_FLOAT32_C(   288.16),
+        SIMDE_FLOAT32_C(  -928.94), SIMDE_FLOAT32_C(  -136.76), SIMDE_FLOAT32_C(     0.66), SIMDE_FLOAT32_C(     0.66) } },
+    { { SIMDE_FLOAT32_C(  -973.30), SIMDE_FLOAT32_C(   548.76), SIMDE_FLOAT32_C(   401.66), SIMDE_FLOAT32_C(  -347.96),
+        SIMDE_FLOAT32_C(   752.73), SIMDE_FLOAT32_C(  -889.01), SIMDE_FLOAT32_C(   251.61), SIMDE_FLOAT32_C(  -785.76) },
+      UINT8_C(201),
+      { SIMDE_FLOAT32_C(   738.74), SIMDE_FLOAT32_C(   419.57), SIMDE_FLOAT32_C(    82.74), SIMDE_FLOAT32_C(   953.29),
+        SIMDE_FLOAT32_C(   182.57), SIMDE_FLOAT32_C(  -905.93), SIMDE_FLOAT32_C(   947.92), SIMDE_FLOAT32_C(  -335.21) },
+      { SIMDE_FLOAT32_C(     0.72), SIMDE_FLOAT32_C(   548.76), SIMDE_FLOAT32_C(   401.66), SIMDE_FLOAT32_C(     0.93),
+        SIMDE_FLOAT32_C(   752.73), SIMDE_FLOAT32_C(  -889.01), SIMDE_FLOAT32_C(     0.93),            SIMDE_MATH_NANF } },
+    { { SIMDE_FLOAT32_C(  -133.92), SIMDE_FLOAT32_C(    19.30), SIMDE_FLOAT32_C(   613.38), SIMDE_FLOAT32_C(  -215.85),
+        SIMDE_FLOAT32_C(   -50.96), SIMDE_FLOAT32_C(    75.36), SIMDE_FLOAT32_C(   305.43), SIMDE_FLOAT32_C(  -762.80) },
+      UINT8_C(  3),
+      { SIMDE_FLOAT32_C(  -866.68), SIMDE_FLOAT32_C(  -989.48), SIMDE_FLOAT32_C(   745.07), SIMDE_FLOAT32_C(  -978.19),
+        SIMDE_FLOAT32_C(    32.74), SIMDE_FLOAT32_C(   782.74), SIMDE_FLOAT32_C(   757.26), SIMDE_FLOAT32_C(  -293.63) },
+      {            SIMDE_MATH_NANF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   613.38), SIMDE_FLOAT32_C(  -215.85),
+        SIMDE_FLOAT32_C(   -50.96), SIMDE_FLOAT32_C(    75.36), SIMDE_FLOAT32_C(   305.43), SIMDE_FLOAT32_C(  -762.80) } },
+    { { SIMDE_FLOAT32_C(   489.58), SIMDE_FLOAT32_C(   530.74), SIMDE_FLOAT32_C(   134.52), SIMDE_FLOAT32_C(  -427.87),
+        SIMDE_FLOAT32_C(  -603.18), SIMDE_FLOAT32_C(  -846.18), SIMDE_FLOAT32_C(  -814.49), SIMDE_FLOAT32_C(   180.97) },
+      UINT8_C(236),
+      { SIMDE_FLOAT32_C(  -290.67), SIMDE_FLOAT32_C(  -400.43), SIMDE_FLOAT32_C(  -538.48), SIMDE_FLOAT32_C(   436.53),
+        SIMDE_FLOAT32_C(   853.40), SIMDE_FLOAT32_C(  -499.59), SIMDE_FLOAT32_C(  -912.61), SIMDE_FLOAT32_C(   986.73) },
+      { SIMDE_FLOAT32_C(   489.58), SIMDE_FLOAT32_C(   530.74),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     0.85),
+        SIMDE_FLOAT32_C(  -603.18),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     0.96) } },
+    #endif
+  };
+
+  simde__m256 src, a, r;
+
+  src = simde_mm256_loadu_ps(test_vec[0].src);
+  a = simde_mm256_loadu_ps(test_vec[0].a);
+  r = simde_mm256_mask_getmant_ps(src, test_vec[0].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[0].r), 1);
+
+  src = simde_mm256_loadu_ps(test_vec[1].src);
+  a = simde_mm256_loadu_ps(test_vec[1].a);
+  r = simde_mm256_mask_getmant_ps(src, test_vec[1].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[1].r), 1);
+
+  src = simde_mm256_loadu_ps(test_vec[2].src);
+  a = simde_mm256_loadu_ps(test_vec[2].a);
+  r = simde_mm256_mask_getmant_ps(src, test_vec[2].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[2].r), 1);
+
+  #if !defined(SIMDE_FAST_MATH)
+  src = simde_mm256_loadu_ps(test_vec[3].src);
+  a = simde_mm256_loadu_ps(test_vec[3].a);
+  r = simde_mm256_mask_getmant_ps(src, test_vec[3].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[3].r), 1);
+
+  src = simde_mm256_loadu_ps(test_vec[4].src);
+  a = simde_mm256_loadu_ps(test_vec[4].a);
+  r = simde_mm256_mask_getmant_ps(src, test_vec[4].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[4].r), 1);
+
+  src = simde_mm256_loadu_ps(test_vec[5].src);
+  a = simde_mm256_loadu_ps(test_vec[5].a);
+  r = simde_mm256_mask_getmant_ps(src, test_vec[5].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[5].r), 1);
+
+  src = simde_mm256_loadu_ps(test_vec[6].src);
+  a = simde_mm256_loadu_ps(test_vec[6].a);
+  r = simde_mm256_mask_getmant_ps(src, test_vec[6].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[6].r), 1);
+
+  src = simde_mm256_loadu_ps(test_vec[7].src);
+  a = simde_mm256_loadu_ps(test_vec[7].a);
+  r = simde_mm256_mask_getmant_ps(src, test_vec[7].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[7].r), 1);
+  #endif
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  simde_float32 values[8 * sizeof(simde__m256)];
+  simde_test_x86_random_f32x8_full(8, 1, values, -1000.0f, 1000.0f, SIMDE_TEST_VEC_FLOAT_NAN);
+
+  {
+    simde__m256 src = simde_test_x86_random_f32x8(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256 a = simde_test_x86_random_extract_f32x8(0, 1, 0, values);
+    simde__m256 r = simde_mm256_mask_getmant_ps(src, k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_f32x8(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m256 src = simde_test_x86_random_f32x8(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256 a = simde_test_x86_random_extract_f32x8(1, 1, 0, values);
+    simde__m256 r = simde_mm256_mask_getmant_ps(src, k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_f32x8(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m256 src = simde_test_x86_random_f32x8(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256 a = simde_test_x86_random_extract_f32x8(2, 1, 0, values);
+    simde__m256 r = simde_mm256_mask_getmant_ps(src, k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+
+    simde_test_x86_write_f32x8(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m256 src = simde_test_x86_random_f32x8(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256 a = simde_test_x86_random_extract_f32x8(3, 1, 0, values);
+    simde__m256 r = simde_mm256_mask_getmant_ps(src, k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_f32x8(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m256 src = simde_test_x86_random_f32x8(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256 a = simde_test_x86_random_extract_f32x8(4, 1, 0, values);
+    simde__m256 r = simde_mm256_mask_getmant_ps(src, k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+
+    simde_test_x86_write_f32x8(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m256 src = simde_test_x86_random_f32x8(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256 a = simde_test_x86_random_extract_f32x8(5, 1, 0, values);
+    simde__m256 r = simde_mm256_mask_getmant_ps(src, k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_f32x8(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m256 src = simde_test_x86_random_f32x8(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256 a = simde_test_x86_random_extract_f32x8(6, 1, 0, values);
+    simde__m256 r = simde_mm256_mask_getmant_ps(src, k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_f32x8(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m256 src = simde_test_x86_random_f32x8(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256 a = simde_test_x86_random_extract_f32x8(7, 1, 0, values);
+    simde__m256 r = simde_mm256_mask_getmant_ps(src, k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_f32x8(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_maskz_getmant_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { UINT8_C(250),
+      { SIMDE_FLOAT32_C(    49.92), SIMDE_FLOAT32_C(  -977.87), SIMDE_FLOAT32_C(  -114.00), SIMDE_FLOAT32_C(   203.74),
+        SIMDE_FLOAT32_C(  -792.36), SIMDE_FLOAT32_C(  -933.03), SIMDE_FLOAT32_C(  -693.40), SIMDE_FLOAT32_C(   468.50) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    -0.95), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.80),
+        SIMDE_FLOAT32_C(    -0.77), SIMDE_FLOAT32_C(    -0.91), SIMDE_FLOAT32_C(    -1.35), SIMDE_FLOAT32_C(     0.92) } },
+    { UINT8_C(116),
+      { SIMDE_FLOAT32_C(   -32.98), SIMDE_FLOAT32_C(   901.73), SIMDE_FLOAT32_C(  -780.90), SIMDE_FLOAT32_C(   -47.55),
+        SIMDE_FLOAT32_C(   452.61), SIMDE_FLOAT32_C(   408.36), SIMDE_FLOAT32_C(   362.90), SIMDE_FLOAT32_C(   390.80) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    -0.76), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     1.77), SIMDE_FLOAT32_C(     1.60), SIMDE_FLOAT32_C(     1.42), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(191),
+      { SIMDE_FLOAT32_C(   936.34), SIMDE_FLOAT32_C(   -86.97), SIMDE_FLOAT32_C(   351.22), SIMDE_FLOAT32_C(  -105.22),
+        SIMDE_FLOAT32_C(  -171.57), SIMDE_FLOAT32_C(  -198.78), SIMDE_FLOAT32_C(   383.96), SIMDE_FLOAT32_C(   878.36) },
+      { SIMDE_FLOAT32_C(     0.91), SIMDE_FLOAT32_C(     0.68), SIMDE_FLOAT32_C(     0.69), SIMDE_FLOAT32_C(     0.82),
+        SIMDE_FLOAT32_C(     0.67), SIMDE_FLOAT32_C(     0.78), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.86) } },
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT8_C(172),
+      {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  -513.60),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  -592.71),
+        SIMDE_FLOAT32_C(  -344.93), SIMDE_FLOAT32_C(   643.41), SIMDE_FLOAT32_C(   316.58), SIMDE_FLOAT32_C(   982.24) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    -1.16),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.26), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.92) } },
+    { UINT8_C(217),
+      { SIMDE_FLOAT32_C(   973.46),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   -44.45),
+        SIMDE_FLOAT32_C(   985.43), SIMDE_FLOAT32_C(   550.87), SIMDE_FLOAT32_C(   189.26), SIMDE_FLOAT32_C(  -589.55) },
+      { SIMDE_FLOAT32_C(     0.95), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.69),
+        SIMDE_FLOAT32_C(     0.96), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.74), SIMDE_FLOAT32_C(     0.58) } },
+    { UINT8_C(181),
+      { SIMDE_FLOAT32_C(   938.20), SIMDE_FLOAT32_C(  -472.02), SIMDE_FLOAT32_C(   550.13), SIMDE_FLOAT32_C(   960.42),
+        SIMDE_FLOAT32_C(   -41.56), SIMDE_FLOAT32_C(   915.40), SIMDE_FLOAT32_C(   450.00), SIMDE_FLOAT32_C(  -510.82) },
+      { SIMDE_FLOAT32_C(     0.92), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.54), SIMDE_FLOAT32_C(     0.00),
+                   SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     0.89), SIMDE_FLOAT32_C(     0.00),            SIMDE_MATH_NANF } },
+    { UINT8_C(177),
+      { SIMDE_FLOAT32_C(  -446.64), SIMDE_FLOAT32_C(   646.67), SIMDE_FLOAT32_C(   875.79), SIMDE_FLOAT32_C(   208.44),
+        SIMDE_FLOAT32_C(   290.08), SIMDE_FLOAT32_C(   192.38), SIMDE_FLOAT32_C(   190.67), SIMDE_FLOAT32_C(   263.55) },
+      {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     1.13), SIMDE_FLOAT32_C(     1.50), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.03) } },
+    { UINT8_C( 13),
+      { SIMDE_FLOAT32_C(  -176.66), SIMDE_FLOAT32_C(  -730.04), SIMDE_FLOAT32_C(    82.10), SIMDE_FLOAT32_C(    30.98),
+        SIMDE_FLOAT32_C(  -663.07), SIMDE_FLOAT32_C(   388.71), SIMDE_FLOAT32_C(  -500.52), SIMDE_FLOAT32_C(  -109.70) },
+      {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.28), SIMDE_FLOAT32_C(     0.97),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    #endif
+  };
+
+  simde__m256 a, r;
+
+  a = simde_mm256_loadu_ps(test_vec[0].a);
+  r = simde_mm256_maskz_getmant_ps(test_vec[0].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[0].r), 1);
+
+  a = simde_mm256_loadu_ps(test_vec[1].a);
+  r = simde_mm256_maskz_getmant_ps(test_vec[1].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[1].r), 1);
+
+  a = simde_mm256_loadu_ps(test_vec[2].a);
+  r = simde_mm256_maskz_getmant_ps(test_vec[2].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[2].r), 1);
+
+  #if !defined(SIMDE_FAST_MATH)
+  a = simde_mm256_loadu_ps(test_vec[3].a);
+  r = simde_mm256_maskz_getmant_ps(test_vec[3].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[3].r), 1);
+
+  a = simde_mm256_loadu_ps(test_vec[4].a);
+  r = simde_mm256_maskz_getmant_ps(test_vec[4].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[4].r), 1);
+
+  a = simde_mm256_loadu_ps(test_vec[5].a);
+  r = simde_mm256_maskz_getmant_ps(test_vec[5].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[5].r), 1);
+
+  a = simde_mm256_loadu_ps(test_vec[6].a);
+  r = simde_mm256_maskz_getmant_ps(test_vec[6].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[6].r), 1);
+
+  a = simde_mm256_loadu_ps(test_vec[7].a);
+  r = simde_mm256_maskz_getmant_ps(test_vec[7].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[7].r), 1);
+  #endif
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  simde_float32 values[8 * sizeof(simde__m256)];
+  simde_test_x86_random_f32x8_full(8, 1, values, -1000.0f, 1000.0f, SIMDE_TEST_VEC_FLOAT_NAN);
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256 a = simde_test_x86_random_extract_f32x8(0, 1, 0, values);
+    simde__m256 r = simde_mm256_maskz_getmant_ps(k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256 a = simde_test_x86_random_extract_f32x8(1, 1, 0, values);
+    simde__m256 r = simde_mm256_maskz_getmant_ps(k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256 a = simde_test_x86_random_extract_f32x8(2, 1, 0, values);
+    simde__m256 r = simde_mm256_maskz_getmant_ps(k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256 a = simde_test_x86_random_extract_f32x8(3, 1, 0, values);
+    simde__m256 r = simde_mm256_maskz_getmant_ps(k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256 a = simde_test_x86_random_extract_f32x8(4, 1, 0, values);
+    simde__m256 r = simde_mm256_maskz_getmant_ps(k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256 a = simde_test_x86_random_extract_f32x8(5, 1, 0, values);
+    simde__m256 r = simde_mm256_maskz_getmant_ps(k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256 a = simde_test_x86_random_extract_f32x8(6, 1, 0, values);
+    simde__m256 r = simde_mm256_maskz_getmant_ps(k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256 a = simde_test_x86_random_extract_f32x8(7, 1, 0, values);
+    simde__m256 r = simde_mm256_maskz_getmant_ps(k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_getmant_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   731.88), SIMDE_FLOAT32_C(  -189.34), SIMDE_FLOAT32_C(   286.89), SIMDE_FLOAT32_C(  -327.46),
+        SIMDE_FLOAT32_C(   351.45), SIMDE_FLOAT32_C(  -784.39), SIMDE_FLOAT32_C(  -351.43), SIMDE_FLOAT32_C(  -732.48),
+        SIMDE_FLOAT32_C(   243.06), SIMDE_FLOAT32_C(   -49.95), SIMDE_FLOAT32_C(  -248.76), SIMDE_FLOAT32_C(   559.92),
+        SIMDE_FLOAT32_C(  -159.46), SIMDE_FLOAT32_C(   769.64), SIMDE_FLOAT32_C(    67.91), SIMDE_FLOAT32_C(  -460.87) },
+      { SIMDE_FLOAT32_C(     1.43), SIMDE_FLOAT32_C(    -1.48), SIMDE_FLOAT32_C(     1.12), SIMDE_FLOAT32_C(    -1.28),
+        SIMDE_FLOAT32_C(     1.37), SIMDE_FLOAT32_C(    -0.77), SIMDE_FLOAT32_C(    -1.37), SIMDE_FLOAT32_C(    -1.43),
+        SIMDE_FLOAT32_C(     0.95), SIMDE_FLOAT32_C(    -0.78), SIMDE_FLOAT32_C(    -0.97), SIMDE_FLOAT32_C(     1.09),
+        SIMDE_FLOAT32_C(    -1.25), SIMDE_FLOAT32_C(     0.75), SIMDE_FLOAT32_C(     1.06), SIMDE_FLOAT32_C(    -0.90) } },
+    { { SIMDE_FLOAT32_C(  -683.01), SIMDE_FLOAT32_C(   719.76), SIMDE_FLOAT32_C(    43.77), SIMDE_FLOAT32_C(   668.43),
+        SIMDE_FLOAT32_C(   935.37), SIMDE_FLOAT32_C(   692.34), SIMDE_FLOAT32_C(   935.95), SIMDE_FLOAT32_C(   178.44),
+        SIMDE_FLOAT32_C(  -357.61), SIMDE_FLOAT32_C(  -312.81), SIMDE_FLOAT32_C(  -261.64), SIMDE_FLOAT32_C(   482.93),
+        SIMDE_FLOAT32_C(  -543.17), SIMDE_FLOAT32_C(   806.26), SIMDE_FLOAT32_C(  -977.95), SIMDE_FLOAT32_C(  -267.99) },
+      { SIMDE_FLOAT32_C(    -0.67), SIMDE_FLOAT32_C(     0.70), SIMDE_FLOAT32_C(     0.68), SIMDE_FLOAT32_C(     0.65),
+        SIMDE_FLOAT32_C(     0.91), SIMDE_FLOAT32_C(     0.68), SIMDE_FLOAT32_C(     0.91), SIMDE_FLOAT32_C(     0.70),
+        SIMDE_FLOAT32_C(    -1.40), SIMDE_FLOAT32_C(    -1.22), SIMDE_FLOAT32_C(    -1.02), SIMDE_FLOAT32_C(     1.89),
+        SIMDE_FLOAT32_C(    -0.53), SIMDE_FLOAT32_C(     0.79), SIMDE_FLOAT32_C(    -0.96), SIMDE_FLOAT32_C(    -1.05) } },
+    { { SIMDE_FLOAT32_C(    25.90), SIMDE_FLOAT32_C(   476.23), SIMDE_FLOAT32_C(  -637.28), SIMDE_FLOAT32_C(  -568.18),
+        SIMDE_FLOAT32_C(    -1.74), SIMDE_FLOAT32_C(   112.05), SIMDE_FLOAT32_C(   409.78), SIMDE_FLOAT32_C(  -364.28),
+        SIMDE_FLOAT32_C(   571.46), SIMDE_FLOAT32_C(  -853.24), SIMDE_FLOAT32_C(   820.14), SIMDE_FLOAT32_C(  -789.19),
+        SIMDE_FLOAT32_C(   653.09), SIMDE_FLOAT32_C(  -746.99), SIMDE_FLOAT32_C(  -417.96), SIMDE_FLOAT32_C(   970.07) },
+      { SIMDE_FLOAT32_C(     0.81), SIMDE_FLOAT32_C(     0.93), SIMDE_FLOAT32_C(     0.62), SIMDE_FLOAT32_C(     0.55),
+        SIMDE_FLOAT32_C(     0.87), SIMDE_FLOAT32_C(     0.88), SIMDE_FLOAT32_C(     0.80), SIMDE_FLOAT32_C(     0.71),
+        SIMDE_FLOAT32_C(     0.56), SIMDE_FLOAT32_C(     0.83), SIMDE_FLOAT32_C(     0.80), SIMDE_FLOAT32_C(     0.77),
+        SIMDE_FLOAT32_C(     0.64), SIMDE_FLOAT32_C(     0.73), SIMDE_FLOAT32_C(     0.82), SIMDE_FLOAT32_C(     0.95) } },
+    #if !defined(SIMDE_FAST_MATH)
+    { {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   808.10),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  -356.26),
+        SIMDE_FLOAT32_C(   216.46), SIMDE_FLOAT32_C(  -149.98), SIMDE_FLOAT32_C(  -965.46), SIMDE_FLOAT32_C(   152.80),
+        SIMDE_FLOAT32_C(   763.05), SIMDE_FLOAT32_C(   385.77), SIMDE_FLOAT32_C(  -952.42), SIMDE_FLOAT32_C(  -408.51),
+        SIMDE_FLOAT32_C(  -813.02), SIMDE_FLOAT32_C(   431.54), SIMDE_FLOAT32_C(  -530.15), SIMDE_FLOAT32_C(    10.33) },
+      {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     1.58),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    -1.39),
+        SIMDE_FLOAT32_C(     1.69), SIMDE_FLOAT32_C(    -1.17), SIMDE_FLOAT32_C(    -1.89), SIMDE_FLOAT32_C(     1.19),
+        SIMDE_FLOAT32_C(     1.49), SIMDE_FLOAT32_C(     1.51), SIMDE_FLOAT32_C(    -1.86), SIMDE_FLOAT32_C(    -1.60),
+        SIMDE_FLOAT32_C(    -1.59), SIMDE_FLOAT32_C(     1.69), SIMDE_FLOAT32_C(    -1.04), SIMDE_FLOAT32_C(     1.29) } },
+    { { SIMDE_FLOAT32_C(   701.50),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  -961.57),
+        SIMDE_FLOAT32_C(   -59.35), SIMDE_FLOAT32_C(  -459.21), SIMDE_FLOAT32_C(   -71.28), SIMDE_FLOAT32_C(   976.03),
+        SIMDE_FLOAT32_C(   -83.93), SIMDE_FLOAT32_C(    27.45), SIMDE_FLOAT32_C(  -698.52), SIMDE_FLOAT32_C(  -516.27),
+        SIMDE_FLOAT32_C(  -683.14), SIMDE_FLOAT32_C(   890.49), SIMDE_FLOAT32_C(    18.40), SIMDE_FLOAT32_C(   507.99) },
+      { SIMDE_FLOAT32_C(     0.69),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     0.94),
+        SIMDE_FLOAT32_C(     0.93), SIMDE_FLOAT32_C(     1.79), SIMDE_FLOAT32_C(     1.11), SIMDE_FLOAT32_C(     0.95),
+        SIMDE_FLOAT32_C(     1.31), SIMDE_FLOAT32_C(     1.72), SIMDE_FLOAT32_C(     0.68), SIMDE_FLOAT32_C(     0.50),
+        SIMDE_FLOAT32_C(     0.67), SIMDE_FLOAT32_C(     0.87), SIMDE_FLOAT32_C(     1.15), SIMDE_FLOAT32_C(     1.98) } },
+    { { SIMDE_FLOAT32_C(   698.59), SIMDE_FLOAT32_C(  -494.47), SIMDE_FLOAT32_C(  -848.27), SIMDE_FLOAT32_C(   -84.95),
+        SIMDE_FLOAT32_C(   355.55), SIMDE_FLOAT32_C(  -813.72), SIMDE_FLOAT32_C(  -932.15), SIMDE_FLOAT32_C(   118.60),
+        SIMDE_FLOAT32_C(   572.04), SIMDE_FLOAT32_C(  -884.57), SIMDE_FLOAT32_C(   710.09), SIMDE_FLOAT32_C(   759.02),
+        SIMDE_FLOAT32_C(   546.96), SIMDE_FLOAT32_C(  -820.06), SIMDE_FLOAT32_C(  -230.65), SIMDE_FLOAT32_C(   248.46) },
+      { SIMDE_FLOAT32_C(     0.68),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF,            SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(     0.69),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     0.93),
+        SIMDE_FLOAT32_C(     0.56),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     0.69), SIMDE_FLOAT32_C(     0.74),
+        SIMDE_FLOAT32_C(     0.53),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     0.97) } },
+    { { SIMDE_FLOAT32_C(  -724.83), SIMDE_FLOAT32_C(   219.64), SIMDE_FLOAT32_C(   454.18), SIMDE_FLOAT32_C(   630.72),
+        SIMDE_FLOAT32_C(   405.92), SIMDE_FLOAT32_C(   522.03), SIMDE_FLOAT32_C(  -250.68), SIMDE_FLOAT32_C(   -22.04),
+        SIMDE_FLOAT32_C(   637.46), SIMDE_FLOAT32_C(  -540.59), SIMDE_FLOAT32_C(  -263.02), SIMDE_FLOAT32_C(   184.42),
+        SIMDE_FLOAT32_C(  -360.65), SIMDE_FLOAT32_C(   506.33), SIMDE_FLOAT32_C(  -567.12), SIMDE_FLOAT32_C(  -628.77) },
+      {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     1.72), SIMDE_FLOAT32_C(     1.77), SIMDE_FLOAT32_C(     1.23),
+        SIMDE_FLOAT32_C(     1.59), SIMDE_FLOAT32_C(     1.02),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(     1.25),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     1.44),
+                   SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     1.98),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF } },
+    { { SIMDE_FLOAT32_C(   972.77), SIMDE_FLOAT32_C(   625.81), SIMDE_FLOAT32_C(   638.50), SIMDE_FLOAT32_C(   908.15),
+        SIMDE_FLOAT32_C(   318.15), SIMDE_FLOAT32_C(   574.45), SIMDE_FLOAT32_C(    86.58), SIMDE_FLOAT32_C(   960.54),
+        SIMDE_FLOAT32_C(  -738.36), SIMDE_FLOAT32_C(   824.94), SIMDE_FLOAT32_C(   443.46), SIMDE_FLOAT32_C(  -281.53),
+        SIMDE_FLOAT32_C(   631.20), SIMDE_FLOAT32_C(   465.52), SIMDE_FLOAT32_C(   450.48), SIMDE_FLOAT32_C(  -342.89) },
+      { SIMDE_FLOAT32_C(     0.95), SIMDE_FLOAT32_C(     1.22), SIMDE_FLOAT32_C(     1.25), SIMDE_FLOAT32_C(     0.89),
+        SIMDE_FLOAT32_C(     1.24), SIMDE_FLOAT32_C(     1.12), SIMDE_FLOAT32_C(     1.35), SIMDE_FLOAT32_C(     0.94),
+                   SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     0.81), SIMDE_FLOAT32_C(     0.87),            SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(     1.23), SIMDE_FLOAT32_C(     0.91), SIMDE_FLOAT32_C(     0.88),            SIMDE_MATH_NANF } },
+    #endif
+  };
+
+  simde__m512 a, r;
+
+  a = simde_mm512_loadu_ps(test_vec[0].a);
+  r = simde_mm512_getmant_ps(a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[0].r), 1);
+
+  a = simde_mm512_loadu_ps(test_vec[1].a);
+  r = simde_mm512_getmant_ps(a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[1].r), 1);
+
+  a = simde_mm512_loadu_ps(test_vec[2].a);
+  r = simde_mm512_getmant_ps(a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[2].r), 1);
+
+  #if !defined(SIMDE_FAST_MATH)
+  a = simde_mm512_loadu_ps(test_vec[3].a);
+  r = simde_mm512_getmant_ps(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[3].r), 1);
+
+  a = simde_mm512_loadu_ps(test_vec[4].a);
+  r = simde_mm512_getmant_ps(a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[4].r), 1);
+
+  a = simde_mm512_loadu_ps(test_vec[5].a);
+  r = simde_mm512_getmant_ps(a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[5].r), 1);
+
+  a = simde_mm512_loadu_ps(test_vec[6].a);
+  r = simde_mm512_getmant_ps(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[6].r), 1);
+
+  a = simde_mm512_loadu_ps(test_vec[7].a);
+  r = simde_mm512_getmant_ps(a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[7].r), 1);
+  #endif
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  simde_float32 values[8 * sizeof(simde__m512)];
+  simde_test_x86_random_f32x16_full(8, 1, values, -1000.0f, 1000.0f, SIMDE_TEST_VEC_FLOAT_NAN);
+
+  {
+    simde__m512 a = simde_test_x86_random_extract_f32x16(0, 1, 0, values);
+    simde__m512 r = simde_mm512_getmant_ps(a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_f32x16(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m512 a = simde_test_x86_random_extract_f32x16(1, 1, 0, values);
+    simde__m512 r = simde_mm512_getmant_ps(a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_f32x16(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m512 a = simde_test_x86_random_extract_f32x16(2, 1, 0, values);
+    simde__m512 r = simde_mm512_getmant_ps(a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+
+    simde_test_x86_write_f32x16(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m512 a = simde_test_x86_random_extract_f32x16(3, 1, 0, values);
+    simde__m512 r = simde_mm512_getmant_ps(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_f32x16(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m512 a = simde_test_x86_random_extract_f32x16(4, 1, 0, values);
+    simde__m512 r = simde_mm512_getmant_ps(a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+
+    simde_test_x86_write_f32x16(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m512 a = simde_test_x86_random_extract_f32x16(5, 1, 0, values);
+    simde__m512 r = simde_mm512_getmant_ps(a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_f32x16(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m512 a = simde_test_x86_random_extract_f32x16(6, 1, 0, values);
+    simde__m512 r = simde_mm512_getmant_ps(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_f32x16(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m512 a = simde_test_x86_random_extract_f32x16(7, 1, 0, values);
+    simde__m512 r = simde_mm512_getmant_ps(a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_f32x16(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_mask_getmant_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde_float32 src[16];
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -159.45), SIMDE_FLOAT32_C(   438.99), SIMDE_FLOAT32_C(   711.19), SIMDE_FLOAT32_C(   470.18),
+        SIMDE_FLOAT32_C(   741.92), SIMDE_FLOAT32_C(   234.18), SIMDE_FLOAT32_C(   592.89), SIMDE_FLOAT32_C(   939.64),
+        SIMDE_FLOAT32_C(   155.97), SIMDE_FLOAT32_C(  -549.25), SIMDE_FLOAT32_C(   131.72), SIMDE_FLOAT32_C(  -108.91),
+        SIMDE_FLOAT32_C(  -998.98), SIMDE_FLOAT32_C(   192.16), SIMDE_FLOAT32_C(   267.88), SIMDE_FLOAT32_C(   177.38) },
+      UINT16_C(13337),
+      { SIMDE_FLOAT32_C(  -562.98), SIMDE_FLOAT32_C(  -243.27), SIMDE_FLOAT32_C(  -706.71), SIMDE_FLOAT32_C(   918.59),
+        SIMDE_FLOAT32_C(  -626.88), SIMDE_FLOAT32_C(  -512.65), SIMDE_FLOAT32_C(   661.81), SIMDE_FLOAT32_C(   814.44),
+        SIMDE_FLOAT32_C(  -875.13), SIMDE_FLOAT32_C(  -876.51), SIMDE_FLOAT32_C(  -113.03), SIMDE_FLOAT32_C(   227.91),
+        SIMDE_FLOAT32_C(  -964.35), SIMDE_FLOAT32_C(  -383.40), SIMDE_FLOAT32_C(   272.69), SIMDE_FLOAT32_C(   761.02) },
+      { SIMDE_FLOAT32_C(    -1.10), SIMDE_FLOAT32_C(   438.99), SIMDE_FLOAT32_C(   711.19), SIMDE_FLOAT32_C(     0.90),
+        SIMDE_FLOAT32_C(    -1.22), SIMDE_FLOAT32_C(   234.18), SIMDE_FLOAT32_C(   592.89), SIMDE_FLOAT32_C(   939.64),
+        SIMDE_FLOAT32_C(   155.97), SIMDE_FLOAT32_C(  -549.25), SIMDE_FLOAT32_C(    -0.88), SIMDE_FLOAT32_C(  -108.91),
+        SIMDE_FLOAT32_C(    -0.94), SIMDE_FLOAT32_C(    -1.50), SIMDE_FLOAT32_C(   267.88), SIMDE_FLOAT32_C(   177.38) } },
+    { { SIMDE_FLOAT32_C(    26.67), SIMDE_FLOAT32_C(   565.43), SIMDE_FLOAT32_C(    15.11), SIMDE_FLOAT32_C(  -817.36),
+        SIMDE_FLOAT32_C(  -983.81), SIMDE_FLOAT32_C(  -853.18), SIMDE_FLOAT32_C(    73.74), SIMDE_FLOAT32_C(  -982.79),
+        SIMDE_FLOAT32_C(   338.98), SIMDE_FLOAT32_C(  -658.39), SIMDE_FLOAT32_C(   194.59), SIMDE_FLOAT32_C(   713.62),
+        SIMDE_FLOAT32_C(  -985.55), SIMDE_FLOAT32_C(   614.47), SIMDE_FLOAT32_C(   253.11), SIMDE_FLOAT32_C(  -875.08) },
+      UINT16_C(14388),
+      { SIMDE_FLOAT32_C(   363.36), SIMDE_FLOAT32_C(   -88.75), SIMDE_FLOAT32_C(   861.96), SIMDE_FLOAT32_C(   736.47),
+        SIMDE_FLOAT32_C(   398.60), SIMDE_FLOAT32_C(   523.77), SIMDE_FLOAT32_C(   550.91), SIMDE_FLOAT32_C(   523.47),
+        SIMDE_FLOAT32_C(   647.26), SIMDE_FLOAT32_C(  -562.12), SIMDE_FLOAT32_C(  -248.63), SIMDE_FLOAT32_C(   682.91),
+        SIMDE_FLOAT32_C(    54.48), SIMDE_FLOAT32_C(  -975.94), SIMDE_FLOAT32_C(   443.93), SIMDE_FLOAT32_C(  -510.35) },
+      { SIMDE_FLOAT32_C(    26.67), SIMDE_FLOAT32_C(   565.43), SIMDE_FLOAT32_C(     0.84), SIMDE_FLOAT32_C(  -817.36),
+        SIMDE_FLOAT32_C(     1.56), SIMDE_FLOAT32_C(     0.51), SIMDE_FLOAT32_C(    73.74), SIMDE_FLOAT32_C(  -982.79),
+        SIMDE_FLOAT32_C(   338.98), SIMDE_FLOAT32_C(  -658.39), SIMDE_FLOAT32_C(   194.59), SIMDE_FLOAT32_C(     0.67),
+        SIMDE_FLOAT32_C(     0.85), SIMDE_FLOAT32_C(    -0.95), SIMDE_FLOAT32_C(   253.11), SIMDE_FLOAT32_C(  -875.08) } },
+    { { SIMDE_FLOAT32_C(   621.42), SIMDE_FLOAT32_C(  -774.73), SIMDE_FLOAT32_C(  -389.03), SIMDE_FLOAT32_C(   766.68),
+        SIMDE_FLOAT32_C(   575.14), SIMDE_FLOAT32_C(  -727.21), SIMDE_FLOAT32_C(   661.22), SIMDE_FLOAT32_C(   656.45),
+        SIMDE_FLOAT32_C(  -224.85), SIMDE_FLOAT32_C(    -5.23), SIMDE_FLOAT32_C(   448.94), SIMDE_FLOAT32_C(  -252.30),
+        SIMDE_FLOAT32_C(  -929.77), SIMDE_FLOAT32_C(  -524.38), SIMDE_FLOAT32_C(  -686.87), SIMDE_FLOAT32_C(    85.34) },
+      UINT16_C(60638),
+      { SIMDE_FLOAT32_C(   281.55), SIMDE_FLOAT32_C(   855.57), SIMDE_FLOAT32_C(   242.08), SIMDE_FLOAT32_C(    99.58),
+        SIMDE_FLOAT32_C(   414.53), SIMDE_FLOAT32_C(   957.25), SIMDE_FLOAT32_C(   874.00), SIMDE_FLOAT32_C(  -171.67),
+        SIMDE_FLOAT32_C(   -66.31), SIMDE_FLOAT32_C(  -746.31), SIMDE_FLOAT32_C(   386.52), SIMDE_FLOAT32_C(  -559.96),
+        SIMDE_FLOAT32_C(  -139.68), SIMDE_FLOAT32_C(  -995.52), SIMDE_FLOAT32_C(  -616.59), SIMDE_FLOAT32_C(  -776.32) },
+      { SIMDE_FLOAT32_C(   621.42), SIMDE_FLOAT32_C(     0.84), SIMDE_FLOAT32_C(     0.95), SIMDE_FLOAT32_C(     0.78),
+        SIMDE_FLOAT32_C(     0.81), SIMDE_FLOAT32_C(  -727.21), SIMDE_FLOAT32_C(     0.85), SIMDE_FLOAT32_C(     0.67),
+        SIMDE_FLOAT32_C(  -224.85), SIMDE_FLOAT32_C(    -5.23), SIMDE_FLOAT32_C(     0.75), SIMDE_FLOAT32_C(     0.55),
+        SIMDE_FLOAT32_C(  -929.77), SIMDE_FLOAT32_C(     0.97), SIMDE_FLOAT32_C(     0.60), SIMDE_FLOAT32_C(     0.76) } },
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT32_C(  -601.19), SIMDE_FLOAT32_C(  -264.84), SIMDE_FLOAT32_C(    -5.64), SIMDE_FLOAT32_C(   813.33),
+        SIMDE_FLOAT32_C(  -307.60), SIMDE_FLOAT32_C(  -131.64), SIMDE_FLOAT32_C(  -358.34), SIMDE_FLOAT32_C(   626.10),
+        SIMDE_FLOAT32_C(   122.05), SIMDE_FLOAT32_C(  -971.82), SIMDE_FLOAT32_C(  -933.87), SIMDE_FLOAT32_C(   982.37),
+        SIMDE_FLOAT32_C(  -967.34), SIMDE_FLOAT32_C(  -550.46), SIMDE_FLOAT32_C(  -793.96), SIMDE_FLOAT32_C(   -51.60) },
+      UINT16_C(37842),
+      {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   813.20),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   940.01),
+        SIMDE_FLOAT32_C(   -74.75), SIMDE_FLOAT32_C(  -501.29), SIMDE_FLOAT32_C(  -424.27), SIMDE_FLOAT32_C(  -503.29),
+        SIMDE_FLOAT32_C(  -354.54), SIMDE_FLOAT32_C(  -604.13), SIMDE_FLOAT32_C(  -292.48), SIMDE_FLOAT32_C(  -701.45),
+        SIMDE_FLOAT32_C(  -351.12), SIMDE_FLOAT32_C(   289.56), SIMDE_FLOAT32_C(  -731.38), SIMDE_FLOAT32_C(  -378.35) },
+      { SIMDE_FLOAT32_C(  -601.19), SIMDE_FLOAT32_C(     1.59), SIMDE_FLOAT32_C(    -5.64), SIMDE_FLOAT32_C(   813.33),
+        SIMDE_FLOAT32_C(    -1.17), SIMDE_FLOAT32_C(  -131.64), SIMDE_FLOAT32_C(    -1.66), SIMDE_FLOAT32_C(    -1.97),
+        SIMDE_FLOAT32_C(    -1.38), SIMDE_FLOAT32_C(    -1.18), SIMDE_FLOAT32_C(  -933.87), SIMDE_FLOAT32_C(   982.37),
+        SIMDE_FLOAT32_C(    -1.37), SIMDE_FLOAT32_C(  -550.46), SIMDE_FLOAT32_C(  -793.96), SIMDE_FLOAT32_C(    -1.48) } },
+    { { SIMDE_FLOAT32_C(   262.73), SIMDE_FLOAT32_C(  -535.95), SIMDE_FLOAT32_C(   677.26), SIMDE_FLOAT32_C(   100.53),
+        SIMDE_FLOAT32_C(   880.44), SIMDE_FLOAT32_C(   626.20), SIMDE_FLOAT32_C(   689.70), SIMDE_FLOAT32_C(   -20.25),
+        SIMDE_FLOAT32_C(  -370.37), SIMDE_FLOAT32_C(  -697.07), SIMDE_FLOAT32_C(   522.99), SIMDE_FLOAT32_C(  -877.29),
+        SIMDE_FLOAT32_C(  -802.28), SIMDE_FLOAT32_C(   921.79), SIMDE_FLOAT32_C(  -142.14), SIMDE_FLOAT32_C(   192.08) },
+      UINT16_C(36109),
+      { SIMDE_FLOAT32_C(   -84.63),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  -766.48),
+        SIMDE_FLOAT32_C(   481.57), SIMDE_FLOAT32_C(   616.38), SIMDE_FLOAT32_C(  -805.94), SIMDE_FLOAT32_C(   743.21),
+        SIMDE_FLOAT32_C(   441.32), SIMDE_FLOAT32_C(   637.52), SIMDE_FLOAT32_C(  -538.32), SIMDE_FLOAT32_C(    72.53),
+        SIMDE_FLOAT32_C(   103.04), SIMDE_FLOAT32_C(   912.16), SIMDE_FLOAT32_C(   729.63), SIMDE_FLOAT32_C(  -955.21) },
+      { SIMDE_FLOAT32_C(     1.32), SIMDE_FLOAT32_C(  -535.95),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     0.75),
+        SIMDE_FLOAT32_C(   880.44), SIMDE_FLOAT32_C(   626.20), SIMDE_FLOAT32_C(   689.70), SIMDE_FLOAT32_C(   -20.25),
+        SIMDE_FLOAT32_C(     1.72), SIMDE_FLOAT32_C(  -697.07), SIMDE_FLOAT32_C(     0.53), SIMDE_FLOAT32_C(     1.13),
+        SIMDE_FLOAT32_C(  -802.28), SIMDE_FLOAT32_C(   921.79), SIMDE_FLOAT32_C(  -142.14), SIMDE_FLOAT32_C(     0.93) } },
+    { { SIMDE_FLOAT32_C(  -939.56), SIMDE_FLOAT32_C(  -623.22), SIMDE_FLOAT32_C(   176.36), SIMDE_FLOAT32_C(   182.49),
+        SIMDE_FLOAT32_C(  -595.04), SIMDE_FLOAT32_C(   242.50), SIMDE_FLOAT32_C(   164.85), SIMDE_FLOAT32_C(  -562.37),
+        SIMDE_FLOAT32_C(   692.04), SIMDE_FLOAT32_C(   370.89), SIMDE_FLOAT32_C(   386.03), SIMDE_FLOAT32_C(  -613.05),
+        SIMDE_FLOAT32_C(   537.09), SIMDE_FLOAT32_C(  -351.24), SIMDE_FLOAT32_C(  -149.00), SIMDE_FLOAT32_C(   214.34) },
+      UINT16_C(13628),
+      { SIMDE_FLOAT32_C(   725.37), SIMDE_FLOAT32_C(  -181.44), SIMDE_FLOAT32_C(   984.80), SIMDE_FLOAT32_C(  -349.38),
+        SIMDE_FLOAT32_C(   317.27), SIMDE_FLOAT32_C(  -439.47), SIMDE_FLOAT32_C(   147.32), SIMDE_FLOAT32_C(   962.73),
+        SIMDE_FLOAT32_C(   -43.60), SIMDE_FLOAT32_C(   854.84), SIMDE_FLOAT32_C(  -738.72), SIMDE_FLOAT32_C(   605.28),
+        SIMDE_FLOAT32_C(   144.40), SIMDE_FLOAT32_C(  -470.10), SIMDE_FLOAT32_C(  -773.07), SIMDE_FLOAT32_C(  -940.23) },
+      { SIMDE_FLOAT32_C(  -939.56), SIMDE_FLOAT32_C(  -623.22), SIMDE_FLOAT32_C(     0.96),            SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(     0.62),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   164.85), SIMDE_FLOAT32_C(  -562.37),
+                   SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   370.89),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  -613.05),
+        SIMDE_FLOAT32_C(     0.56),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  -149.00), SIMDE_FLOAT32_C(   214.34) } },
+    { { SIMDE_FLOAT32_C(  -580.12), SIMDE_FLOAT32_C(   539.49), SIMDE_FLOAT32_C(  -889.53), SIMDE_FLOAT32_C(  -888.08),
+        SIMDE_FLOAT32_C(   -89.61), SIMDE_FLOAT32_C(   496.50), SIMDE_FLOAT32_C(  -501.13), SIMDE_FLOAT32_C(  -552.53),
+        SIMDE_FLOAT32_C(  -854.74), SIMDE_FLOAT32_C(   349.87), SIMDE_FLOAT32_C(   661.82), SIMDE_FLOAT32_C(   894.55),
+        SIMDE_FLOAT32_C(  -918.69), SIMDE_FLOAT32_C(  -497.63), SIMDE_FLOAT32_C(   333.54), SIMDE_FLOAT32_C(   792.50) },
+      UINT16_C(37310),
+      { SIMDE_FLOAT32_C(   435.16), SIMDE_FLOAT32_C(   257.49), SIMDE_FLOAT32_C(  -588.36), SIMDE_FLOAT32_C(  -247.57),
+        SIMDE_FLOAT32_C(   818.02), SIMDE_FLOAT32_C(   558.96), SIMDE_FLOAT32_C(  -284.83), SIMDE_FLOAT32_C(  -225.58),
+        SIMDE_FLOAT32_C(   413.80), SIMDE_FLOAT32_C(   -23.55), SIMDE_FLOAT32_C(  -620.30), SIMDE_FLOAT32_C(  -441.80),
+        SIMDE_FLOAT32_C(   506.35), SIMDE_FLOAT32_C(  -393.37), SIMDE_FLOAT32_C(  -382.04), SIMDE_FLOAT32_C(   943.37) },
+      { SIMDE_FLOAT32_C(  -580.12), SIMDE_FLOAT32_C(     1.01),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(     1.60), SIMDE_FLOAT32_C(     1.09), SIMDE_FLOAT32_C(  -501.13),            SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(     1.62), SIMDE_FLOAT32_C(   349.87), SIMDE_FLOAT32_C(   661.82), SIMDE_FLOAT32_C(   894.55),
+        SIMDE_FLOAT32_C(     1.98), SIMDE_FLOAT32_C(  -497.63), SIMDE_FLOAT32_C(   333.54), SIMDE_FLOAT32_C(     1.84) } },
+    { { SIMDE_FLOAT32_C(   232.16), SIMDE_FLOAT32_C(   732.00), SIMDE_FLOAT32_C(  -653.47), SIMDE_FLOAT32_C(  -428.86),
+        SIMDE_FLOAT32_C(  -926.39), SIMDE_FLOAT32_C(   541.12), SIMDE_FLOAT32_C(  -715.24), SIMDE_FLOAT32_C(  -911.93),
+        SIMDE_FLOAT32_C(   155.59), SIMDE_FLOAT32_C(   537.87), SIMDE_FLOAT32_C(  -787.01), SIMDE_FLOAT32_C(  -118.02),
+        SIMDE_FLOAT32_C(   701.37), SIMDE_FLOAT32_C(   834.41), SIMDE_FLOAT32_C(   107.25), SIMDE_FLOAT32_C(  -687.66) },
+      UINT16_C(64751),
+      { SIMDE_FLOAT32_C(   -84.26), SIMDE_FLOAT32_C(  -754.63), SIMDE_FLOAT32_C(   960.15), SIMDE_FLOAT32_C(  -685.67),
+        SIMDE_FLOAT32_C(   769.14), SIMDE_FLOAT32_C(   511.06), SIMDE_FLOAT32_C(   837.80), SIMDE_FLOAT32_C(   416.39),
+        SIMDE_FLOAT32_C(   948.95), SIMDE_FLOAT32_C(  -410.83), SIMDE_FLOAT32_C(    99.31), SIMDE_FLOAT32_C(     3.43),
+        SIMDE_FLOAT32_C(  -386.77), SIMDE_FLOAT32_C(  -456.76), SIMDE_FLOAT32_C(   493.08), SIMDE_FLOAT32_C(   894.79) },
+      {            SIMDE_MATH_NANF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     0.94),            SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(  -926.39), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     0.82), SIMDE_FLOAT32_C(     0.81),
+        SIMDE_FLOAT32_C(   155.59), SIMDE_FLOAT32_C(   537.87), SIMDE_FLOAT32_C(     0.78), SIMDE_FLOAT32_C(     0.86),
+                   SIMDE_MATH_NANF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     0.96), SIMDE_FLOAT32_C(     0.87) } },
+    #endif
+  };
+
+  simde__m512 src, a, r;
+
+  src = simde_mm512_loadu_ps(test_vec[0].src);
+  a = simde_mm512_loadu_ps(test_vec[0].a);
+  r = simde_mm512_mask_getmant_ps(src, test_vec[0].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[0].r), 1);
+
+  src = simde_mm512_loadu_ps(test_vec[1].src);
+  a = simde_mm512_loadu_ps(test_vec[1].a);
+  r = simde_mm512_mask_getmant_ps(src, test_vec[1].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[1].r), 1);
+
+  src = simde_mm512_loadu_ps(test_vec[2].src);
+  a = simde_mm512_loadu_ps(test_vec[2].a);
+  r = simde_mm512_mask_getmant_ps(src, test_vec[2].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[2].r), 1);
+
+  #if !defined(SIMDE_FAST_MATH)
+  src = simde_mm512_loadu_ps(test_vec[3].src);
+  a = simde_mm512_loadu_ps(test_vec[3].a);
+  r = simde_mm512_mask_getmant_ps(src, test_vec[3].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[3].r), 1);
+
+  src = simde_mm512_loadu_ps(test_vec[4].src);
+  a = simde_mm512_loadu_ps(test_vec[4].a);
+  r = simde_mm512_mask_getmant_ps(src, test_vec[4].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[4].r), 1);
+
+  src = simde_mm512_loadu_ps(test_vec[5].src);
+  a = simde_mm512_loadu_ps(test_vec[5].a);
+  r = simde_mm512_mask_getmant_ps(src, test_vec[5].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[5].r), 1);
+
+  src = simde_mm512_loadu_ps(test_vec[6].src);
+  a = simde_mm512_loadu_ps(test_vec[6].a);
+  r = simde_mm512_mask_getmant_ps(src, test_vec[6].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[6].r), 1);
+
+  src = simde_mm512_loadu_ps(test_vec[7].src);
+  a = simde_mm512_loadu_ps(test_vec[7].a);
+  r = simde_mm512_mask_getmant_ps(src, test_vec[7].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[7].r), 1);
+  #endif
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  simde_float32 values[8 * sizeof(simde__m512)];
+  simde_test_x86_random_f32x16_full(8, 1, values, -1000.0f, 1000.0f, SIMDE_TEST_VEC_FLOAT_NAN);
+
+  {
+    simde__m512 src = simde_test_x86_random_f32x16(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m512 a = simde_test_x86_random_extract_f32x16(0, 1, 0, values);
+    simde__m512 r = simde_mm512_mask_getmant_ps(src, k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_f32x16(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m512 src = simde_test_x86_random_f32x16(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m512 a = simde_test_x86_random_extract_f32x16(1, 1, 0, values);
+    simde__m512 r = simde_mm512_mask_getmant_ps(src, k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_f32x16(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m512 src = simde_test_x86_random_f32x16(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m512 a = simde_test_x86_random_extract_f32x16(2, 1, 0, values);
+    simde__m512 r = simde_mm512_mask_getmant_ps(src, k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+
+    simde_test_x86_write_f32x16(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m512 src = simde_test_x86_random_f32x16(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m512 a = simde_test_x86_random_extract_f32x16(3, 1, 0, values);
+    simde__m512 r = simde_mm512_mask_getmant_ps(src, k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_f32x16(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m512 src = simde_test_x86_random_f32x16(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m512 a = simde_test_x86_random_extract_f32x16(4, 1, 0, values);
+    simde__m512 r = simde_mm512_mask_getmant_ps(src, k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+
+    simde_test_x86_write_f32x16(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m512 src = simde_test_x86_random_f32x16(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m512 a = simde_test_x86_random_extract_f32x16(5, 1, 0, values);
+    simde__m512 r = simde_mm512_mask_getmant_ps(src, k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_f32x16(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m512 src = simde_test_x86_random_f32x16(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m512 a = simde_test_x86_random_extract_f32x16(6, 1, 0, values);
+    simde__m512 r = simde_mm512_mask_getmant_ps(src, k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_f32x16(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m512 src = simde_test_x86_random_f32x16(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m512 a = simde_test_x86_random_extract_f32x16(7, 1, 0, values);
+    simde__m512 r = simde_mm512_mask_getmant_ps(src, k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_f32x16(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_maskz_getmant_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { UINT16_C(58477),
+      { SIMDE_FLOAT32_C(   157.89), SIMDE_FLOAT32_C(  -987.72), SIMDE_FLOAT32_C(    84.58), SIMDE_FLOAT32_C(   973.23),
+        SIMDE_FLOAT32_C(   805.96), SIMDE_FLOAT32_C(  -876.84), SIMDE_FLOAT32_C(     1.55), SIMDE_FLOAT32_C(  -518.38),
+        SIMDE_FLOAT32_C(  -136.90), SIMDE_FLOAT32_C(   864.29), SIMDE_FLOAT32_C(  -735.47), SIMDE_FLOAT32_C(   915.38),
+        SIMDE_FLOAT32_C(  -671.90), SIMDE_FLOAT32_C(  -270.17), SIMDE_FLOAT32_C(   552.80), SIMDE_FLOAT32_C(  -945.77) },
+      { SIMDE_FLOAT32_C(     1.23), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.32), SIMDE_FLOAT32_C(     0.95),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    -0.86), SIMDE_FLOAT32_C(     0.77), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    -1.44), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    -1.06), SIMDE_FLOAT32_C(     1.08), SIMDE_FLOAT32_C(    -0.92) } },
+    { UINT16_C(48510),
+      { SIMDE_FLOAT32_C(  -153.31), SIMDE_FLOAT32_C(   107.49), SIMDE_FLOAT32_C(  -680.12), SIMDE_FLOAT32_C(  -347.35),
+        SIMDE_FLOAT32_C(   230.65), SIMDE_FLOAT32_C(   321.43), SIMDE_FLOAT32_C(   134.27), SIMDE_FLOAT32_C(  -906.26),
+        SIMDE_FLOAT32_C(   185.72), SIMDE_FLOAT32_C(   398.80), SIMDE_FLOAT32_C(  -990.87), SIMDE_FLOAT32_C(   513.83),
+        SIMDE_FLOAT32_C(  -871.38), SIMDE_FLOAT32_C(   561.92), SIMDE_FLOAT32_C(   568.06), SIMDE_FLOAT32_C(   662.58) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.68), SIMDE_FLOAT32_C(    -0.66), SIMDE_FLOAT32_C(    -1.36),
+        SIMDE_FLOAT32_C(     0.90), SIMDE_FLOAT32_C(     1.26), SIMDE_FLOAT32_C(     0.52), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.73), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    -0.97), SIMDE_FLOAT32_C(     0.50),
+        SIMDE_FLOAT32_C(    -0.85), SIMDE_FLOAT32_C(     0.55), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.65) } },
+    { UINT16_C(11728),
+      { SIMDE_FLOAT32_C(  -887.58), SIMDE_FLOAT32_C(   605.49), SIMDE_FLOAT32_C(   788.45), SIMDE_FLOAT32_C(   768.59),
+        SIMDE_FLOAT32_C(   953.42), SIMDE_FLOAT32_C(  -230.37), SIMDE_FLOAT32_C(   -48.44), SIMDE_FLOAT32_C(  -975.50),
+        SIMDE_FLOAT32_C(   527.78), SIMDE_FLOAT32_C(  -588.23), SIMDE_FLOAT32_C(  -536.47), SIMDE_FLOAT32_C(  -283.45),
+        SIMDE_FLOAT32_C(   246.18), SIMDE_FLOAT32_C(  -513.56), SIMDE_FLOAT32_C(    63.20), SIMDE_FLOAT32_C(  -907.13) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.93), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.76), SIMDE_FLOAT32_C(     0.95),
+        SIMDE_FLOAT32_C(     0.52), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.52), SIMDE_FLOAT32_C(     0.55),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.50), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT16_C(29622),
+      {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   262.31),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   360.28),
+        SIMDE_FLOAT32_C(  -742.93), SIMDE_FLOAT32_C(   787.78), SIMDE_FLOAT32_C(  -892.02), SIMDE_FLOAT32_C(  -672.70),
+        SIMDE_FLOAT32_C(  -736.60), SIMDE_FLOAT32_C(  -578.88), SIMDE_FLOAT32_C(   412.64), SIMDE_FLOAT32_C(   -78.34),
+        SIMDE_FLOAT32_C(  -249.56), SIMDE_FLOAT32_C(  -355.20), SIMDE_FLOAT32_C(  -346.34), SIMDE_FLOAT32_C(    96.97) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.02),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(    -1.45), SIMDE_FLOAT32_C(     1.54), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    -1.31),
+        SIMDE_FLOAT32_C(    -1.44), SIMDE_FLOAT32_C(    -1.13), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(    -1.95), SIMDE_FLOAT32_C(    -1.39), SIMDE_FLOAT32_C(    -1.35), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C(20092),
+      { SIMDE_FLOAT32_C(   215.94),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   500.70),
+        SIMDE_FLOAT32_C(  -184.66), SIMDE_FLOAT32_C(   793.67), SIMDE_FLOAT32_C(    38.57), SIMDE_FLOAT32_C(    28.33),
+        SIMDE_FLOAT32_C(  -324.34), SIMDE_FLOAT32_C(  -260.06), SIMDE_FLOAT32_C(  -137.27), SIMDE_FLOAT32_C(   782.91),
+        SIMDE_FLOAT32_C(    52.28), SIMDE_FLOAT32_C(  -536.18), SIMDE_FLOAT32_C(  -534.70), SIMDE_FLOAT32_C(   637.41) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     1.96),
+        SIMDE_FLOAT32_C(     0.72), SIMDE_FLOAT32_C(     0.78), SIMDE_FLOAT32_C(     0.60), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.02), SIMDE_FLOAT32_C(     0.54), SIMDE_FLOAT32_C(     0.76),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.52), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C(37855),
+      { SIMDE_FLOAT32_C(   726.13), SIMDE_FLOAT32_C(  -195.87), SIMDE_FLOAT32_C(    -2.30), SIMDE_FLOAT32_C(   983.20),
+        SIMDE_FLOAT32_C(  -408.09), SIMDE_FLOAT32_C(   105.68), SIMDE_FLOAT32_C(  -689.50), SIMDE_FLOAT32_C(  -144.69),
+        SIMDE_FLOAT32_C(   526.80), SIMDE_FLOAT32_C(   723.14), SIMDE_FLOAT32_C(   776.97), SIMDE_FLOAT32_C(  -722.76),
+        SIMDE_FLOAT32_C(  -632.06), SIMDE_FLOAT32_C(  -569.38), SIMDE_FLOAT32_C(   374.20), SIMDE_FLOAT32_C(   583.88) },
+      { SIMDE_FLOAT32_C(     0.71),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     0.96),
+                   SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     0.00),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(     0.51), SIMDE_FLOAT32_C(     0.71), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+                   SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.57) } },
+    { UINT16_C( 4768),
+      { SIMDE_FLOAT32_C(   533.96), SIMDE_FLOAT32_C(  -449.51), SIMDE_FLOAT32_C(  -962.57), SIMDE_FLOAT32_C(  -874.13),
+        SIMDE_FLOAT32_C(   656.18), SIMDE_FLOAT32_C(  -652.06), SIMDE_FLOAT32_C(   -18.82), SIMDE_FLOAT32_C(   182.97),
+        SIMDE_FLOAT32_C(  -928.92), SIMDE_FLOAT32_C(  -241.86), SIMDE_FLOAT32_C(   460.21), SIMDE_FLOAT32_C(  -560.98),
+        SIMDE_FLOAT32_C(   188.77), SIMDE_FLOAT32_C(  -165.59), SIMDE_FLOAT32_C(  -977.09), SIMDE_FLOAT32_C(  -653.34) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.43),
+        SIMDE_FLOAT32_C(     0.00),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     1.47), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C(10535),
+      { SIMDE_FLOAT32_C(   593.93), SIMDE_FLOAT32_C(   383.08), SIMDE_FLOAT32_C(  -254.47), SIMDE_FLOAT32_C(  -175.43),
+        SIMDE_FLOAT32_C(  -295.48), SIMDE_FLOAT32_C(   879.80), SIMDE_FLOAT32_C(   -81.68), SIMDE_FLOAT32_C(   890.24),
+        SIMDE_FLOAT32_C(   278.59), SIMDE_FLOAT32_C(   -72.56), SIMDE_FLOAT32_C(   404.06), SIMDE_FLOAT32_C(   407.22),
+        SIMDE_FLOAT32_C(  -510.64), SIMDE_FLOAT32_C(   -27.88), SIMDE_FLOAT32_C(    69.80), SIMDE_FLOAT32_C(  -398.22) },
+      { SIMDE_FLOAT32_C(     1.16), SIMDE_FLOAT32_C(     1.50),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.86), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     1.09), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.80),
+        SIMDE_FLOAT32_C(     0.00),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    #endif
+  };
+
+  simde__m512 a, r;
+
+  a = simde_mm512_loadu_ps(test_vec[0].a);
+  r = simde_mm512_maskz_getmant_ps(test_vec[0].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[0].r), 1);
+
+  a = simde_mm512_loadu_ps(test_vec[1].a);
+  r = simde_mm512_maskz_getmant_ps(test_vec[1].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[1].r), 1);
+
+  a = simde_mm512_loadu_ps(test_vec[2].a);
+  r = simde_mm512_maskz_getmant_ps(test_vec[2].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[2].r), 1);
+
+  #if !defined(SIMDE_FAST_MATH)
+  a = simde_mm512_loadu_ps(test_vec[3].a);
+  r = simde_mm512_maskz_getmant_ps(test_vec[3].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[3].r), 1);
+
+  a = simde_mm512_loadu_ps(test_vec[4].a);
+  r = simde_mm512_maskz_getmant_ps(test_vec[4].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[4].r), 1);
+
+  a = simde_mm512_loadu_ps(test_vec[5].a);
+  r = simde_mm512_maskz_getmant_ps(test_vec[5].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[5].r), 1);
+
+  a = simde_mm512_loadu_ps(test_vec[6].a);
+  r = simde_mm512_maskz_getmant_ps(test_vec[6].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[6].r), 1);
+
+  a = simde_mm512_loadu_ps(test_vec[7].a);
+  r = simde_mm512_maskz_getmant_ps(test_vec[7].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[7].r), 1);
+  #endif
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  simde_float32 values[8 * sizeof(simde__m512)];
+  simde_test_x86_random_f32x16_full(8, 1, values, -1000.0f, 1000.0f, SIMDE_TEST_VEC_FLOAT_NAN);
+
+  {
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m512 a = simde_test_x86_random_extract_f32x16(0, 1, 0, values);
+    simde__m512 r = simde_mm512_maskz_getmant_ps(k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m512 a = simde_test_x86_random_extract_f32x16(1, 1, 0, values);
+    simde__m512 r = simde_mm512_maskz_getmant_ps(k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m512 a = simde_test_x86_random_extract_f32x16(2, 1, 0, values);
+    simde__m512 r = simde_mm512_maskz_getmant_ps(k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m512 a = simde_test_x86_random_extract_f32x16(3, 1, 0, values);
+    simde__m512 r = simde_mm512_maskz_getmant_ps(k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m512 a = simde_test_x86_random_extract_f32x16(4, 1, 0, values);
+    simde__m512 r = simde_mm512_maskz_getmant_ps(k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m512 a = simde_test_x86_random_extract_f32x16(5, 1, 0, values);
+    simde__m512 r = simde_mm512_maskz_getmant_ps(k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m512 a = simde_test_x86_random_extract_f32x16(6, 1, 0, values);
+    simde__m512 r = simde_mm512_maskz_getmant_ps(k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    simde__m512 a = simde_test_x86_random_extract_f32x16(7, 1, 0, values);
+    simde__m512 r = simde_mm512_maskz_getmant_ps(k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x16(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f32x16(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_getmant_pd (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -616.11), SIMDE_FLOAT64_C(  -740.88) },
+      { SIMDE_FLOAT64_C(    -0.60), SIMDE_FLOAT64_C(    -0.72) } },
+    { { SIMDE_FLOAT64_C(   289.44), SIMDE_FLOAT64_C(   453.69) },
+      { SIMDE_FLOAT64_C(     0.57), SIMDE_FLOAT64_C(     0.89) } },
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT64_C(    -0.00), SIMDE_FLOAT64_C( 1.0e-310) },
+      { SIMDE_FLOAT64_C(    -1.00), SIMDE_FLOAT64_C(     1.15) } },
+    { {       -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(-2.5e-320) },
+      { SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     1.24) } },
+    { {       -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(-2.5e-320) },
+      {             SIMDE_MATH_NAN,             SIMDE_MATH_NAN } },
+    { { SIMDE_FLOAT64_C(    -0.00), SIMDE_FLOAT64_C( 1.0e-310) },
+      { SIMDE_FLOAT64_C(    -1.00), SIMDE_FLOAT64_C(     1.15) } },
+    { { SIMDE_FLOAT64_C(   769.76), SIMDE_FLOAT64_C(  -682.68) },
+      { SIMDE_FLOAT64_C(     1.50),             SIMDE_MATH_NAN } },
+    { { SIMDE_FLOAT64_C(  -139.10), SIMDE_FLOAT64_C(   867.05) },
+      {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     0.85) } },
+    #endif
+  };
+
+  simde__m128d a, r;
+
+  a = simde_mm_loadu_pd(test_vec[0].a);
+  r = simde_mm_getmant_pd(a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[0].r), 1);
+
+  a = simde_mm_loadu_pd(test_vec[1].a);
+  r = simde_mm_getmant_pd(a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[1].r), 1);
+
+  #if !defined(SIMDE_FAST_MATH)
+  a = simde_mm_loadu_pd(test_vec[2].a);
+  r = simde_mm_getmant_pd(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[2].r), 1);
+
+  a = simde_mm_loadu_pd(test_vec[3].a);
+  r = simde_mm_getmant_pd(a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[3].r), 1);
+
+  a = simde_mm_loadu_pd(test_vec[4].a);
+  r = simde_mm_getmant_pd(a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[4].r), 1);
+
+  a = simde_mm_loadu_pd(test_vec[5].a);
+  r = simde_mm_getmant_pd(a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[5].r), 1);
+
+  a = simde_mm_loadu_pd(test_vec[6].a);
+  r = simde_mm_getmant_pd(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[6].r), 1);
+
+  a = simde_mm_loadu_pd(test_vec[7].a);
+  r = simde_mm_getmant_pd(a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[7].r), 1);
+  #endif
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  simde_float64 values[8 * sizeof(simde__m128d)];
+  simde_test_x86_random_f64x2_full(8, 1, values, -1000.0, 1000.0, SIMDE_TEST_VEC_FLOAT_NAN);
+
+  {
+    simde__m128d a = simde_test_x86_random_extract_f64x2(0, 1, 0, values);
+    simde__m128d r = simde_mm_getmant_pd(a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_f64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m128d a = simde_test_x86_random_extract_f64x2(1, 1, 0, values);
+    simde__m128d r = simde_mm_getmant_pd(a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+
+    simde_test_x86_write_f64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m128d a = simde_test_x86_random_extract_f64x2(2, 1, 0, values);
+    simde__m128d r = simde_mm_getmant_pd(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_f64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m128d a = simde_test_x86_random_extract_f64x2(3, 1, 0, values);
+    simde__m128d r = simde_mm_getmant_pd(a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+
+    simde_test_x86_write_f64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m128d a = simde_test_x86_random_extract_f64x2(4, 1, 0, values);
+    simde__m128d r = simde_mm_getmant_pd(a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_f64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m128d a = simde_test_x86_random_extract_f64x2(5, 1, 0, values);
+    simde__m128d r = simde_mm_getmant_pd(a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_f64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m128d a = simde_test_x86_random_extract_f64x2(6, 1, 0, values);
+    simde__m128d r = simde_mm_getmant_pd(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_f64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m128d a = simde_test_x86_random_extract_f64x2(7, 1, 0, values);
+    simde__m128d r = simde_mm_getmant_pd(a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_f64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_mask_getmant_pd (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde_float64 src[2];
+    const simde__mmask8 k;
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   216.50), SIMDE_FLOAT64_C(   372.79) },
+      UINT8_C(192),
+      { SIMDE_FLOAT64_C(    95.50), SIMDE_FLOAT64_C(  -713.09) },
+      { SIMDE_FLOAT64_C(   216.50), SIMDE_FLOAT64_C(   372.79) } },
+    { { SIMDE_FLOAT64_C(   -17.86), SIMDE_FLOAT64_C(   464.96) },
+      UINT8_C( 60),
+      { SIMDE_FLOAT64_C(   266.79), SIMDE_FLOAT64_C(   478.18) },
+      { SIMDE_FLOAT64_C(   -17.86), SIMDE_FLOAT64_C(   464.96) } },
+    { { SIMDE_FLOAT64_C(   -78.03), SIMDE_FLOAT64_C(  -981.84) },
+      UINT8_C( 14),
+      { SIMDE_FLOAT64_C(   903.13), SIMDE_FLOAT64_C(  -660.44) },
+      { SIMDE_FLOAT64_C(   -78.03), SIMDE_FLOAT64_C(     0.64) } },
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT64_C(  -842.16), SIMDE_FLOAT64_C(  -498.40) },
+      UINT8_C( 13),
+      {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   231.27) },
+      {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(  -498.40) } },
+    { { SIMDE_FLOAT64_C(   855.93), SIMDE_FLOAT64_C(   343.91) },
+      UINT8_C(191),
+      {             SIMDE_MATH_NAN,             SIMDE_MATH_NAN },
+      {             SIMDE_MATH_NAN,             SIMDE_MATH_NAN } },
+    { { SIMDE_FLOAT64_C(  -167.40), SIMDE_FLOAT64_C(   113.67) },
+      UINT8_C( 96),
+      {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   -46.38) },
+      { SIMDE_FLOAT64_C(  -167.40), SIMDE_FLOAT64_C(   113.67) } },
+    { { SIMDE_FLOAT64_C(  -329.81), SIMDE_FLOAT64_C(  -766.31) },
+      UINT8_C(215),
+      { SIMDE_FLOAT64_C(   972.68), SIMDE_FLOAT64_C(   -32.29) },
+      { SIMDE_FLOAT64_C(     1.90),             SIMDE_MATH_NAN } },
+    { { SIMDE_FLOAT64_C(  -982.53), SIMDE_FLOAT64_C(  -694.93) },
+      UINT8_C(243),
+      { SIMDE_FLOAT64_C(  -422.40), SIMDE_FLOAT64_C(  -778.38) },
+      {             SIMDE_MATH_NAN,             SIMDE_MATH_NAN } },
+    #endif
+  };
+
+  simde__m128d src, a, r;
+
+  src = simde_mm_loadu_pd(test_vec[0].src);
+  a = simde_mm_loadu_pd(test_vec[0].a);
+  r = simde_mm_mask_getmant_pd(src, test_vec[0].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[0].r), 1);
+
+  src = simde_mm_loadu_pd(test_vec[1].src);
+  a = simde_mm_loadu_pd(test_vec[1].a);
+  r = simde_mm_mask_getmant_pd(src, test_vec[1].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[1].r), 1);
+
+  src = simde_mm_loadu_pd(test_vec[2].src);
+  a = simde_mm_loadu_pd(test_vec[2].a);
+  r = simde_mm_mask_getmant_pd(src, test_vec[2].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[2].r), 1);
+
+  #if !defined(SIMDE_FAST_MATH)
+  src = simde_mm_loadu_pd(test_vec[3].src);
+  a = simde_mm_loadu_pd(test_vec[3].a);
+  r = simde_mm_mask_getmant_pd(src, test_vec[3].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[3].r), 1);
+
+  src = simde_mm_loadu_pd(test_vec[4].src);
+  a = simde_mm_loadu_pd(test_vec[4].a);
+  r = simde_mm_mask_getmant_pd(src, test_vec[4].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[4].r), 1);
+
+  src = simde_mm_loadu_pd(test_vec[5].src);
+  a = simde_mm_loadu_pd(test_vec[5].a);
+  r = simde_mm_mask_getmant_pd(src, test_vec[5].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[5].r), 1);
+
+  src = simde_mm_loadu_pd(test_vec[6].src);
+  a = simde_mm_loadu_pd(test_vec[6].a);
+  r = simde_mm_mask_getmant_pd(src, test_vec[6].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[6].r), 1);
+
+  src = simde_mm_loadu_pd(test_vec[7].src);
+  a = simde_mm_loadu_pd(test_vec[7].a);
+  r = simde_mm_mask_getmant_pd(src, test_vec[7].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[7].r), 1);
+  #endif
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  simde_float64 values[8 * sizeof(simde__m128d)];
+  simde_test_x86_random_f64x2_full(8, 1, values, -1000.0, 1000.0, SIMDE_TEST_VEC_FLOAT_NAN);
+
+  {
+    simde__m128d src = simde_test_x86_random_f64x2(SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128d a = simde_test_x86_random_extract_f64x2(0, 1, 0, values);
+    simde__m128d r = simde_mm_mask_getmant_pd(src, k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_f64x2(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x2(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m128d src = simde_test_x86_random_f64x2(SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128d a = simde_test_x86_random_extract_f64x2(1, 1, 0, values);
+    simde__m128d r = simde_mm_mask_getmant_pd(src, k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_f64x2(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x2(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m128d src = simde_test_x86_random_f64x2(SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128d a = simde_test_x86_random_extract_f64x2(2, 1, 0, values);
+    simde__m128d r = simde_mm_mask_getmant_pd(src, k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+
+    simde_test_x86_write_f64x2(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x2(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m128d src = simde_test_x86_random_f64x2(SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128d a = simde_test_x86_random_extract_f64x2(3, 1, 0, values);
+    simde__m128d r = simde_mm_mask_getmant_pd(src, k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_f64x2(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x2(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m128d src = simde_test_x86_random_f64x2(SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128d a = simde_test_x86_random_extract_f64x2(4, 1, 0, values);
+    simde__m128d r = simde_mm_mask_getmant_pd(src, k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+
+    simde_test_x86_write_f64x2(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x2(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m128d src = simde_test_x86_random_f64x2(SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128d a = simde_test_x86_random_extract_f64x2(5, 1, 0, values);
+    simde__m128d r = simde_mm_mask_getmant_pd(src, k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_f64x2(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x2(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m128d src = simde_test_x86_random_f64x2(SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128d a = simde_test_x86_random_extract_f64x2(6, 1, 0, values);
+    simde__m128d r = simde_mm_mask_getmant_pd(src, k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_f64x2(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x2(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m128d src = simde_test_x86_random_f64x2(SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128d a = simde_test_x86_random_extract_f64x2(7, 1, 0, values);
+    simde__m128d r = simde_mm_mask_getmant_pd(src, k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_f64x2(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x2(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_maskz_getmant_pd (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { UINT8_C(170),
+      { SIMDE_FLOAT64_C(   109.94), SIMDE_FLOAT64_C(  -930.74) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(    -0.91) } },
+    { UINT8_C(151),
+      { SIMDE_FLOAT64_C(   925.19), SIMDE_FLOAT64_C(  -142.64) },
+      { SIMDE_FLOAT64_C(     0.90), SIMDE_FLOAT64_C(    -0.56) } },
+    { UINT8_C(107),
+      { SIMDE_FLOAT64_C(  -487.53), SIMDE_FLOAT64_C(  -242.20) },
+      { SIMDE_FLOAT64_C(     0.95), SIMDE_FLOAT64_C(     0.95) } },
+    { UINT8_C(180),
+      { SIMDE_FLOAT64_C(   971.03), SIMDE_FLOAT64_C(   -12.31) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT8_C(115),
+      {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   571.86) },
+      {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     1.12) } },
+    { UINT8_C( 98),
+      {             SIMDE_MATH_NAN,             SIMDE_MATH_NAN },
+      { SIMDE_FLOAT64_C(     0.00),             SIMDE_MATH_NAN } },
+    { UINT8_C(192),
+      {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(    11.85) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(166),
+      { SIMDE_FLOAT64_C(   513.45), SIMDE_FLOAT64_C(  -645.42) },
+      { SIMDE_FLOAT64_C(     0.00),             SIMDE_MATH_NAN } },
+    #endif
+  };
+
+  simde__m128d a, r;
+
+  a = simde_mm_loadu_pd(test_vec[0].a);
+  r = simde_mm_maskz_getmant_pd(test_vec[0].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[0].r), 1);
+
+  a = simde_mm_loadu_pd(test_vec[1].a);
+  r = simde_mm_maskz_getmant_pd(test_vec[1].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[1].r), 1);
+
+  a = simde_mm_loadu_pd(test_vec[2].a);
+  r = simde_mm_maskz_getmant_pd(test_vec[2].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[2].r), 1);
+
+  a = simde_mm_loadu_pd(test_vec[3].a);
+  r = simde_mm_maskz_getmant_pd(test_vec[3].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[3].r), 1);
+
+  #if !defined(SIMDE_FAST_MATH)
+  a = simde_mm_loadu_pd(test_vec[4].a);
+  r = simde_mm_maskz_getmant_pd(test_vec[4].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[4].r), 1);
+
+  a = simde_mm_loadu_pd(test_vec[5].a);
+  r = simde_mm_maskz_getmant_pd(test_vec[5].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[5].r), 1);
+
+  a = simde_mm_loadu_pd(test_vec[6].a);
+  r = simde_mm_maskz_getmant_pd(test_vec[6].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[6].r), 1);
+
+  a = simde_mm_loadu_pd(test_vec[7].a);
+  r = simde_mm_maskz_getmant_pd(test_vec[7].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[7].r), 1);
+  #endif
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  simde_float64 values[8 * sizeof(simde__m128d)];
+  simde_test_x86_random_f64x2_full(8, 1, values, -1000.0, 1000.0, SIMDE_TEST_VEC_FLOAT_NAN);
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128d a = simde_test_x86_random_extract_f64x2(0, 1, 0, values);
+    simde__m128d r = simde_mm_maskz_getmant_pd(k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x2(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128d a = simde_test_x86_random_extract_f64x2(1, 1, 0, values);
+    simde__m128d r = simde_mm_maskz_getmant_pd(k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x2(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128d a = simde_test_x86_random_extract_f64x2(2, 1, 0, values);
+    simde__m128d r = simde_mm_maskz_getmant_pd(k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x2(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128d a = simde_test_x86_random_extract_f64x2(3, 1, 0, values);
+    simde__m128d r = simde_mm_maskz_getmant_pd(k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x2(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128d a = simde_test_x86_random_extract_f64x2(4, 1, 0, values);
+    simde__m128d r = simde_mm_maskz_getmant_pd(k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x2(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128d a = simde_test_x86_random_extract_f64x2(5, 1, 0, values);
+    simde__m128d r = simde_mm_maskz_getmant_pd(k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x2(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128d a = simde_test_x86_random_extract_f64x2(6, 1, 0, values);
+    simde__m128d r = simde_mm_maskz_getmant_pd(k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x2(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128d a = simde_test_x86_random_extract_f64x2(7, 1, 0, values);
+    simde__m128d r = simde_mm_maskz_getmant_pd(k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x2(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_getmant_pd (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   799.40), SIMDE_FLOAT64_C(   549.49), SIMDE_FLOAT64_C(   -81.74), SIMDE_FLOAT64_C(   312.86) },
+      { SIMDE_FLOAT64_C(     0.78), SIMDE_FLOAT64_C(     1.07), SIMDE_FLOAT64_C(    -1.28), SIMDE_FLOAT64_C(     1.22) } },
+    { { SIMDE_FLOAT64_C(   601.25), SIMDE_FLOAT64_C(  -858.75), SIMDE_FLOAT64_C(   404.22), SIMDE_FLOAT64_C(   575.54) },
+      { SIMDE_FLOAT64_C(     0.59), SIMDE_FLOAT64_C(    -0.84), SIMDE_FLOAT64_C(     1.58), SIMDE_FLOAT64_C(     0.56) } },
+    { { SIMDE_FLOAT64_C(   485.08), SIMDE_FLOAT64_C(  -843.44), SIMDE_FLOAT64_C(  -779.98), SIMDE_FLOAT64_C(    62.60) },
+      { SIMDE_FLOAT64_C(     0.95), SIMDE_FLOAT64_C(     0.82), SIMDE_FLOAT64_C(     0.76), SIMDE_FLOAT64_C(     0.98) } },
+    #if !defined(SIMDE_FAST_MATH)
+    { {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(  -451.41),             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   397.22) },
+      {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(    -1.76),             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     1.55) } },
+    { { SIMDE_FLOAT64_C(  -433.94),             SIMDE_MATH_NAN,             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   551.24) },
+      { SIMDE_FLOAT64_C(     1.70),             SIMDE_MATH_NAN,             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     0.54) } },
+    { { SIMDE_FLOAT64_C(   -62.42), SIMDE_FLOAT64_C(  -212.45), SIMDE_FLOAT64_C(  -560.45), SIMDE_FLOAT64_C(  -151.00) },
+      {             SIMDE_MATH_NAN,             SIMDE_MATH_NAN,             SIMDE_MATH_NAN,             SIMDE_MATH_NAN } },
+    { { SIMDE_FLOAT64_C(   904.07), SIMDE_FLOAT64_C(  -156.55), SIMDE_FLOAT64_C(  -829.78), SIMDE_FLOAT64_C(  -583.46) },
+      { SIMDE_FLOAT64_C(     1.77),             SIMDE_MATH_NAN,             SIMDE_MATH_NAN,             SIMDE_MATH_NAN } },
+    { { SIMDE_FLOAT64_C(  -459.39), SIMDE_FLOAT64_C(   846.64), SIMDE_FLOAT64_C(  -894.92), SIMDE_FLOAT64_C(   -45.57) },
+      {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     0.83),             SIMDE_MATH_NAN,             SIMDE_MATH_NAN } },
+    #endif
+  };
+
+  simde__m256d a, r;
+
+  a = simde_mm256_loadu_pd(test_vec[0].a);
+  r = simde_mm256_getmant_pd(a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[0].r), 1);
+
+  a = simde_mm256_loadu_pd(test_vec[1].a);
+  r = simde_mm256_getmant_pd(a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[1].r), 1);
+
+  a = simde_mm256_loadu_pd(test_vec[2].a);
+  r = simde_mm256_getmant_pd(a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[2].r), 1);
+
+  #if !defined(SIMDE_FAST_MATH)
+  a = simde_mm256_loadu_pd(test_vec[3].a);
+  r = simde_mm256_getmant_pd(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[3].r), 1);
+
+  a = simde_mm256_loadu_pd(test_vec[4].a);
+  r = simde_mm256_getmant_pd(a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[4].r), 1);
+
+  a = simde_mm256_loadu_pd(test_vec[5].a);
+  r = simde_mm256_getmant_pd(a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[5].r), 1);
+
+  a = simde_mm256_loadu_pd(test_vec[6].a);
+  r = simde_mm256_getmant_pd(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[6].r), 1);
+
+  a = simde_mm256_loadu_pd(test_vec[7].a);
+  r = simde_mm256_getmant_pd(a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[7].r), 1);
+  #endif
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  simde_float64 values[8 * sizeof(simde__m256d)];
+  simde_test_x86_random_f64x4_full(8, 1, values, -1000.0, 1000.0, SIMDE_TEST_VEC_FLOAT_NAN);
+
+  {
+    simde__m256d a = simde_test_x86_random_extract_f64x4(0, 1, 0, values);
+    simde__m256d r = simde_mm256_getmant_pd(a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_f64x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m256d a = simde_test_x86_random_extract_f64x4(1, 1, 0, values);
+    simde__m256d r = simde_mm256_getmant_pd(a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_f64x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m256d a = simde_test_x86_random_extract_f64x4(2, 1, 0, values);
+    simde__m256d r = simde_mm256_getmant_pd(a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+
+    simde_test_x86_write_f64x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m256d a = simde_test_x86_random_extract_f64x4(3, 1, 0, values);
+    simde__m256d r = simde_mm256_getmant_pd(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_f64x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m256d a = simde_test_x86_random_extract_f64x4(4, 1, 0, values);
+    simde__m256d r = simde_mm256_getmant_pd(a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+
+    simde_test_x86_write_f64x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m256d a = simde_test_x86_random_extract_f64x4(5, 1, 0, values);
+    simde__m256d r = simde_mm256_getmant_pd(a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_f64x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m256d a = simde_test_x86_random_extract_f64x4(6, 1, 0, values);
+    simde__m256d r = simde_mm256_getmant_pd(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_f64x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m256d a = simde_test_x86_random_extract_f64x4(7, 1, 0, values);
+    simde__m256d r = simde_mm256_getmant_pd(a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_f64x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_mask_getmant_pd (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde_float64 src[4];
+    const simde__mmask8 k;
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   719.04), SIMDE_FLOAT64_C(  -354.15), SIMDE_FLOAT64_C(  -710.55), SIMDE_FLOAT64_C(  -676.19) },
+      UINT8_C(249),
+      { SIMDE_FLOAT64_C(   492.51), SIMDE_FLOAT64_C(   -47.92), SIMDE_FLOAT64_C(  -681.99), SIMDE_FLOAT64_C(   291.92) },
+      { SIMDE_FLOAT64_C(     0.96), SIMDE_FLOAT64_C(  -354.15), SIMDE_FLOAT64_C(  -710.55), SIMDE_FLOAT64_C(     0.57) } },
+    { { SIMDE_FLOAT64_C(  -630.82), SIMDE_FLOAT64_C(    98.80), SIMDE_FLOAT64_C(   873.65), SIMDE_FLOAT64_C(  -949.84) },
+      UINT8_C( 81),
+      { SIMDE_FLOAT64_C(  -498.43), SIMDE_FLOAT64_C(   236.27), SIMDE_FLOAT64_C(  -395.23), SIMDE_FLOAT64_C(  -594.37) },
+      { SIMDE_FLOAT64_C(    -0.97), SIMDE_FLOAT64_C(    98.80), SIMDE_FLOAT64_C(   873.65), SIMDE_FLOAT64_C(  -949.84) } },
+    { { SIMDE_FLOAT64_C(   880.30), SIMDE_FLOAT64_C(   406.56), SIMDE_FLOAT64_C(  -893.60), SIMDE_FLOAT64_C(   449.30) },
+      UINT8_C( 97),
+      { SIMDE_FLOAT64_C(   -83.75), SIMDE_FLOAT64_C(  -773.61), SIMDE_FLOAT64_C(   256.52), SIMDE_FLOAT64_C(  -598.67) },
+      { SIMDE_FLOAT64_C(    -1.31), SIMDE_FLOAT64_C(   406.56), SIMDE_FLOAT64_C(  -893.60), SIMDE_FLOAT64_C(   449.30) } },
+    { { SIMDE_FLOAT64_C(   824.81), SIMDE_FLOAT64_C(  -815.98), SIMDE_FLOAT64_C(   514.21), SIMDE_FLOAT64_C(  -495.50) },
+      UINT8_C( 95),
+      { SIMDE_FLOAT64_C(  -617.04), SIMDE_FLOAT64_C(   476.54), SIMDE_FLOAT64_C(   463.92), SIMDE_FLOAT64_C(   -76.44) },
+      { SIMDE_FLOAT64_C(     0.60), SIMDE_FLOAT64_C(     0.93), SIMDE_FLOAT64_C(     0.91), SIMDE_FLOAT64_C(     0.60) } },
+    { { SIMDE_FLOAT64_C(  -551.17), SIMDE_FLOAT64_C(   696.71), SIMDE_FLOAT64_C(  -814.65), SIMDE_FLOAT64_C(  -124.05) },
+      UINT8_C(104),
+      { SIMDE_FLOAT64_C(   323.18), SIMDE_FLOAT64_C(   569.00), SIMDE_FLOAT64_C(   878.00), SIMDE_FLOAT64_C(   718.41) },
+      { SIMDE_FLOAT64_C(  -551.17), SIMDE_FLOAT64_C(   696.71), SIMDE_FLOAT64_C(  -814.65), SIMDE_FLOAT64_C(     1.40) } },
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT64_C(  -265.28), SIMDE_FLOAT64_C(  -770.35), SIMDE_FLOAT64_C(  -320.31), SIMDE_FLOAT64_C(   266.16) },
+      UINT8_C( 75),
+      {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   165.72),             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   -38.72) },
+      {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     1.29), SIMDE_FLOAT64_C(  -320.31), SIMDE_FLOAT64_C(    -1.21) } },
+    { { SIMDE_FLOAT64_C(   192.21), SIMDE_FLOAT64_C(  -264.83), SIMDE_FLOAT64_C(  -572.88), SIMDE_FLOAT64_C(  -855.71) },
+      UINT8_C( 75),
+      { SIMDE_FLOAT64_C(  -468.57),             SIMDE_MATH_NAN,             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   469.01) },
+      { SIMDE_FLOAT64_C(     1.83),             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(  -572.88), SIMDE_FLOAT64_C(     1.83) } },
+    { { SIMDE_FLOAT64_C(  -899.96), SIMDE_FLOAT64_C(   306.68), SIMDE_FLOAT64_C(  -583.63), SIMDE_FLOAT64_C(  -517.00) },
+      UINT8_C(227),
+      { SIMDE_FLOAT64_C(  -920.27), SIMDE_FLOAT64_C(  -225.01), SIMDE_FLOAT64_C(  -177.83), SIMDE_FLOAT64_C(   680.98) },
+      {             SIMDE_MATH_NAN,             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(  -583.63), SIMDE_FLOAT64_C(  -517.00) } },
+    #endif
+  };
+
+  simde__m256d src, a, r;
+
+  src = simde_mm256_loadu_pd(test_vec[0].src);
+  a = simde_mm256_loadu_pd(test_vec[0].a);
+  r = simde_mm256_mask_getmant_pd(src, test_vec[0].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[0].r), 1);
+
+  src = simde_mm256_loadu_pd(test_vec[1].src);
+  a = simde_mm256_loadu_pd(test_vec[1].a);
+  r = simde_mm256_mask_getmant_pd(src, test_vec[1].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[1].r), 1);
+
+  src = simde_mm256_loadu_pd(test_vec[2].src);
+  a = simde_mm256_loadu_pd(test_vec[2].a);
+  r = simde_mm256_mask_getmant_pd(src, test_vec[2].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[2].r), 1);
+
+  src = simde_mm256_loadu_pd(test_vec[3].src);
+  a = simde_mm256_loadu_pd(test_vec[3].a);
+  r = simde_mm256_mask_getmant_pd(src, test_vec[3].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[3].r), 1);
+
+  src = simde_mm256_loadu_pd(test_vec[4].src);
+  a = simde_mm256_loadu_pd(test_vec[4].a);
+  r = simde_mm256_mask_getmant_pd(src, test_vec[4].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[4].r), 1);
+
+  #if !defined(SIMDE_FAST_MATH)
+  src = simde_mm256_loadu_pd(test_vec[5].src);
+  a = simde_mm256_loadu_pd(test_vec[5].a);
+  r = simde_mm256_mask_getmant_pd(src, test_vec[5].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[5].r), 1);
+
+  src = simde_mm256_loadu_pd(test_vec[6].src);
+  a = simde_mm256_loadu_pd(test_vec[6].a);
+  r = simde_mm256_mask_getmant_pd(src, test_vec[6].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[6].r), 1);
+
+  src = simde_mm256_loadu_pd(test_vec[7].src);
+  a = simde_mm256_loadu_pd(test_vec[7].a);
+  r = simde_mm256_mask_getmant_pd(src, test_vec[7].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[7].r), 1);
+  #endif
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  simde_float64 values[8 * sizeof(simde__m256d)];
+  simde_test_x86_random_f64x4_full(8, 1, values, -1000.0, 1000.0, SIMDE_TEST_VEC_FLOAT_NAN);
+
+  {
+    simde__m256d src = simde_test_x86_random_f64x4(SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256d a = simde_test_x86_random_extract_f64x4(0, 1, 0, values);
+    simde__m256d r = simde_mm256_mask_getmant_pd(src, k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_f64x4(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m256d src = simde_test_x86_random_f64x4(SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256d a = simde_test_x86_random_extract_f64x4(1, 1, 0, values);
+    simde__m256d r = simde_mm256_mask_getmant_pd(src, k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_f64x4(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m256d src = simde_test_x86_random_f64x4(SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256d a = simde_test_x86_random_extract_f64x4(2, 1, 0, values);
+    simde__m256d r = simde_mm256_mask_getmant_pd(src, k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_f64x4(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m256d src = simde_test_x86_random_f64x4(SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256d a = simde_test_x86_random_extract_f64x4(3, 1, 0, values);
+    simde__m256d r = simde_mm256_mask_getmant_pd(src, k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+
+    simde_test_x86_write_f64x4(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m256d src = simde_test_x86_random_f64x4(SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256d a = simde_test_x86_random_extract_f64x4(4, 1, 0, values);
+    simde__m256d r = simde_mm256_mask_getmant_pd(src, k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_f64x4(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m256d src = simde_test_x86_random_f64x4(SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256d a = simde_test_x86_random_extract_f64x4(5, 1, 0, values);
+    simde__m256d r = simde_mm256_mask_getmant_pd(src, k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_f64x4(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m256d src = simde_test_x86_random_f64x4(SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256d a = simde_test_x86_random_extract_f64x4(6, 1, 0, values);
+    simde__m256d r = simde_mm256_mask_getmant_pd(src, k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+
+    simde_test_x86_write_f64x4(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m256d src = simde_test_x86_random_f64x4(SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256d a = simde_test_x86_random_extract_f64x4(7, 1, 0, values);
+    simde__m256d r = simde_mm256_mask_getmant_pd(src, k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_f64x4(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_maskz_getmant_pd (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    { UINT8_C( 27),
+      { SIMDE_FLOAT64_C(   411.98), SIMDE_FLOAT64_C(   947.32), SIMDE_FLOAT64_C(  -967.35), SIMDE_FLOAT64_C(   512.03) },
+      { SIMDE_FLOAT64_C(     0.80), SIMDE_FLOAT64_C(     0.93), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.50) } },
+    { UINT8_C(122),
+      { SIMDE_FLOAT64_C(   254.00), SIMDE_FLOAT64_C(  -550.97), SIMDE_FLOAT64_C(   995.03), SIMDE_FLOAT64_C(  -962.78) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(    -1.08), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(    -0.94) } },
+    { UINT8_C(213),
+      { SIMDE_FLOAT64_C(  -313.85), SIMDE_FLOAT64_C(   968.44), SIMDE_FLOAT64_C(   962.65), SIMDE_FLOAT64_C(  -799.64) },
+      { SIMDE_FLOAT64_C(    -1.23), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.94), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(194),
+      { SIMDE_FLOAT64_C(  -527.07), SIMDE_FLOAT64_C(   412.83), SIMDE_FLOAT64_C(  -350.81), SIMDE_FLOAT64_C(  -830.36) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.81), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT8_C(152),
+      {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(  -405.01),             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   527.98) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.03) } },
+    { UINT8_C( 65),
+      { SIMDE_FLOAT64_C(   -81.20),             SIMDE_MATH_NAN,             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(  -982.39) },
+      { SIMDE_FLOAT64_C(     1.27), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(134),
+      { SIMDE_FLOAT64_C(  -670.67), SIMDE_FLOAT64_C(   401.59), SIMDE_FLOAT64_C(  -856.37), SIMDE_FLOAT64_C(   778.63) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.57),             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(183),
+      { SIMDE_FLOAT64_C(   598.18), SIMDE_FLOAT64_C(   525.14), SIMDE_FLOAT64_C(  -989.36), SIMDE_FLOAT64_C(  -163.30) },
+      { SIMDE_FLOAT64_C(     1.17), SIMDE_FLOAT64_C(     1.03),             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     0.00) } },
+    #endif
+  };
+
+  simde__m256d a, r;
+
+  a = simde_mm256_loadu_pd(test_vec[0].a);
+  r = simde_mm256_maskz_getmant_pd(test_vec[0].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[0].r), 1);
+
+  a = simde_mm256_loadu_pd(test_vec[1].a);
+  r = simde_mm256_maskz_getmant_pd(test_vec[1].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[1].r), 1);
+
+  a = simde_mm256_loadu_pd(test_vec[2].a);
+  r = simde_mm256_maskz_getmant_pd(test_vec[2].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[2].r), 1);
+
+  a = simde_mm256_loadu_pd(test_vec[3].a);
+  r = simde_mm256_maskz_getmant_pd(test_vec[3].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[3].r), 1);
+
+  #if !defined(SIMDE_FAST_MATH)
+  a = simde_mm256_loadu_pd(test_vec[4].a);
+  r = simde_mm256_maskz_getmant_pd(test_vec[4].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[4].r), 1);
+
+  a = simde_mm256_loadu_pd(test_vec[5].a);
+  r = simde_mm256_maskz_getmant_pd(test_vec[5].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[5].r), 1);
+
+  a = simde_mm256_loadu_pd(test_vec[6].a);
+  r = simde_mm256_maskz_getmant_pd(test_vec[6].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[6].r), 1);
+
+  a = simde_mm256_loadu_pd(test_vec[7].a);
+  r = simde_mm256_maskz_getmant_pd(test_vec[7].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[7].r), 1);
+  #endif
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  simde_float64 values[8 * sizeof(simde__m256d)];
+  simde_test_x86_random_f64x4_full(8, 1, values, -1000.0, 1000.0, SIMDE_TEST_VEC_FLOAT_NAN);
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256d a = simde_test_x86_random_extract_f64x4(0, 1, 0, values);
+    simde__m256d r = simde_mm256_maskz_getmant_pd(k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256d a = simde_test_x86_random_extract_f64x4(1, 1, 0, values);
+    simde__m256d r = simde_mm256_maskz_getmant_pd(k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256d a = simde_test_x86_random_extract_f64x4(2, 1, 0, values);
+    simde__m256d r = simde_mm256_maskz_getmant_pd(k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256d a = simde_test_x86_random_extract_f64x4(3, 1, 0, values);
+    simde__m256d r = simde_mm256_maskz_getmant_pd(k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256d a = simde_test_x86_random_extract_f64x4(4, 1, 0, values);
+    simde__m256d r = simde_mm256_maskz_getmant_pd(k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256d a = simde_test_x86_random_extract_f64x4(5, 1, 0, values);
+    simde__m256d r = simde_mm256_maskz_getmant_pd(k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256d a = simde_test_x86_random_extract_f64x4(6, 1, 0, values);
+    simde__m256d r = simde_mm256_maskz_getmant_pd(k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256d a = simde_test_x86_random_extract_f64x4(7, 1, 0, values);
+    simde__m256d r = simde_mm256_maskz_getmant_pd(k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_getmant_pd (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -236.86), SIMDE_FLOAT64_C(   821.21), SIMDE_FLOAT64_C(  -423.67), SIMDE_FLOAT64_C(  -201.04),
+        SIMDE_FLOAT64_C(  -916.95), SIMDE_FLOAT64_C(   632.86), SIMDE_FLOAT64_C(  -753.24), SIMDE_FLOAT64_C(  -707.79) },
+      { SIMDE_FLOAT64_C(    -0.93), SIMDE_FLOAT64_C(     0.80), SIMDE_FLOAT64_C(    -0.83), SIMDE_FLOAT64_C(    -0.79),
+        SIMDE_FLOAT64_C(    -0.90), SIMDE_FLOAT64_C(     1.24), SIMDE_FLOAT64_C(    -1.47), SIMDE_FLOAT64_C(    -1.38) } },
+    { { SIMDE_FLOAT64_C(  -100.24), SIMDE_FLOAT64_C(   773.98), SIMDE_FLOAT64_C(   560.48), SIMDE_FLOAT64_C(  -487.80),
+        SIMDE_FLOAT64_C(   382.80), SIMDE_FLOAT64_C(  -196.57), SIMDE_FLOAT64_C(  -402.42), SIMDE_FLOAT64_C(  -595.56) },
+      { SIMDE_FLOAT64_C(    -1.57), SIMDE_FLOAT64_C(     0.76), SIMDE_FLOAT64_C(     0.55), SIMDE_FLOAT64_C(    -1.91),
+        SIMDE_FLOAT64_C(     1.50), SIMDE_FLOAT64_C(    -0.77), SIMDE_FLOAT64_C(    -1.57), SIMDE_FLOAT64_C(    -0.58) } },
+    { { SIMDE_FLOAT64_C(  -304.43), SIMDE_FLOAT64_C(  -147.40), SIMDE_FLOAT64_C(    24.27), SIMDE_FLOAT64_C(  -887.16),
+        SIMDE_FLOAT64_C(   118.25), SIMDE_FLOAT64_C(  -519.20), SIMDE_FLOAT64_C(   650.24), SIMDE_FLOAT64_C(   881.39) },
+      { SIMDE_FLOAT64_C(     0.59), SIMDE_FLOAT64_C(     0.58), SIMDE_FLOAT64_C(     0.76), SIMDE_FLOAT64_C(     0.87),
+        SIMDE_FLOAT64_C(     0.92), SIMDE_FLOAT64_C(     0.51), SIMDE_FLOAT64_C(     0.64), SIMDE_FLOAT64_C(     0.86) } },
+    #if !defined(SIMDE_FAST_MATH)
+    { {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(    89.19),             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   463.16),
+        SIMDE_FLOAT64_C(   538.22), SIMDE_FLOAT64_C(   -45.14), SIMDE_FLOAT64_C(   500.38), SIMDE_FLOAT64_C(   867.54) },
+      {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     1.39),             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     1.81),
+        SIMDE_FLOAT64_C(     1.05), SIMDE_FLOAT64_C(    -1.41), SIMDE_FLOAT64_C(     1.95), SIMDE_FLOAT64_C(     1.69) } },
+    { { SIMDE_FLOAT64_C(  -643.55),             SIMDE_MATH_NAN,             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(    42.59),
+        SIMDE_FLOAT64_C(   612.44), SIMDE_FLOAT64_C(   608.82), SIMDE_FLOAT64_C(   242.95), SIMDE_FLOAT64_C(  -914.62) },
+      { SIMDE_FLOAT64_C(     0.63),             SIMDE_MATH_NAN,             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     0.67),
+        SIMDE_FLOAT64_C(     0.60), SIMDE_FLOAT64_C(     0.59), SIMDE_FLOAT64_C(     0.95), SIMDE_FLOAT64_C(     0.89) } },
+    { { SIMDE_FLOAT64_C(    21.65), SIMDE_FLOAT64_C(   892.14), SIMDE_FLOAT64_C(  -744.98), SIMDE_FLOAT64_C(  -380.18),
+        SIMDE_FLOAT64_C(   417.27), SIMDE_FLOAT64_C(  -734.35), SIMDE_FLOAT64_C(   456.53), SIMDE_FLOAT64_C(   537.40) },
+      { SIMDE_FLOAT64_C(     0.68), SIMDE_FLOAT64_C(     0.87),             SIMDE_MATH_NAN,             SIMDE_MATH_NAN,
+        SIMDE_FLOAT64_C(     0.81),             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     0.89), SIMDE_FLOAT64_C(     0.52) } },
+    { { SIMDE_FLOAT64_C(  -277.95), SIMDE_FLOAT64_C(   206.59), SIMDE_FLOAT64_C(   755.37), SIMDE_FLOAT64_C(  -739.73),
+        SIMDE_FLOAT64_C(  -838.55), SIMDE_FLOAT64_C(   255.75), SIMDE_FLOAT64_C(  -872.19), SIMDE_FLOAT64_C(  -482.11) },
+      {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     1.61), SIMDE_FLOAT64_C(     1.48),             SIMDE_MATH_NAN,
+                    SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     2.00),             SIMDE_MATH_NAN,             SIMDE_MATH_NAN } },
+    { { SIMDE_FLOAT64_C(  -697.99), SIMDE_FLOAT64_C(  -773.43), SIMDE_FLOAT64_C(  -319.66), SIMDE_FLOAT64_C(  -614.94),
+        SIMDE_FLOAT64_C(   859.43), SIMDE_FLOAT64_C(   -72.90), SIMDE_FLOAT64_C(  -322.73), SIMDE_FLOAT64_C(  -418.52) },
+      {             SIMDE_MATH_NAN,             SIMDE_MATH_NAN,             SIMDE_MATH_NAN,             SIMDE_MATH_NAN,
+        SIMDE_FLOAT64_C(     0.84),             SIMDE_MATH_NAN,             SIMDE_MATH_NAN,             SIMDE_MATH_NAN } },
+    #endif
+  };
+
+  simde__m512d a, r;
+
+  a = simde_mm512_loadu_pd(test_vec[0].a);
+  r = simde_mm512_getmant_pd(a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[0].r), 1);
+
+  a = simde_mm512_loadu_pd(test_vec[1].a);
+  r = simde_mm512_getmant_pd(a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[1].r), 1);
+
+  a = simde_mm512_loadu_pd(test_vec[2].a);
+  r = simde_mm512_getmant_pd(a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[2].r), 1);
+
+  #if !defined(SIMDE_FAST_MATH)
+  a = simde_mm512_loadu_pd(test_vec[3].a);
+  r = simde_mm512_getmant_pd(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[3].r), 1);
+
+  a = simde_mm512_loadu_pd(test_vec[4].a);
+  r = simde_mm512_getmant_pd(a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[4].r), 1);
+
+  a = simde_mm512_loadu_pd(test_vec[5].a);
+  r = simde_mm512_getmant_pd(a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[5].r), 1);
+
+  a = simde_mm512_loadu_pd(test_vec[6].a);
+  r = simde_mm512_getmant_pd(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[6].r), 1);
+
+  a = simde_mm512_loadu_pd(test_vec[7].a);
+  r = simde_mm512_getmant_pd(a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[7].r), 1);
+  #endif
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  simde_float64 values[8 * sizeof(simde__m512d)];
+  simde_test_x86_random_f64x8_full(8, 1, values, -1000.0, 1000.0, SIMDE_TEST_VEC_FLOAT_NAN);
+
+  {
+    simde__m512d a = simde_test_x86_random_extract_f64x8(0, 1, 0, values);
+    simde__m512d r = simde_mm512_getmant_pd(a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_f64x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m512d a = simde_test_x86_random_extract_f64x8(1, 1, 0, values);
+    simde__m512d r = simde_mm512_getmant_pd(a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_f64x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m512d a = simde_test_x86_random_extract_f64x8(2, 1, 0, values);
+    simde__m512d r = simde_mm512_getmant_pd(a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+
+    simde_test_x86_write_f64x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m512d a = simde_test_x86_random_extract_f64x8(3, 1, 0, values);
+    simde__m512d r = simde_mm512_getmant_pd(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_f64x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m512d a = simde_test_x86_random_extract_f64x8(4, 1, 0, values);
+    simde__m512d r = simde_mm512_getmant_pd(a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+
+    simde_test_x86_write_f64x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m512d a = simde_test_x86_random_extract_f64x8(5, 1, 0, values);
+    simde__m512d r = simde_mm512_getmant_pd(a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_f64x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m512d a = simde_test_x86_random_extract_f64x8(6, 1, 0, values);
+    simde__m512d r = simde_mm512_getmant_pd(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_f64x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m512d a = simde_test_x86_random_extract_f64x8(7, 1, 0, values);
+    simde__m512d r = simde_mm512_getmant_pd(a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_f64x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_mask_getmant_pd (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde_float64 src[8];
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -877.44), SIMDE_FLOAT64_C(   139.02), SIMDE_FLOAT64_C(  -590.04), SIMDE_FLOAT64_C(   566.31),
+        SIMDE_FLOAT64_C(  -555.42), SIMDE_FLOAT64_C(   317.61), SIMDE_FLOAT64_C(   732.97), SIMDE_FLOAT64_C(   471.72) },
+      UINT8_C(  4),
+      { SIMDE_FLOAT64_C(  -449.47), SIMDE_FLOAT64_C(   555.04), SIMDE_FLOAT64_C(   985.36), SIMDE_FLOAT64_C(   668.78),
+        SIMDE_FLOAT64_C(  -964.16), SIMDE_FLOAT64_C(   635.59), SIMDE_FLOAT64_C(   550.17), SIMDE_FLOAT64_C(  -662.15) },
+      { SIMDE_FLOAT64_C(  -877.44), SIMDE_FLOAT64_C(   139.02), SIMDE_FLOAT64_C(     0.96), SIMDE_FLOAT64_C(   566.31),
+        SIMDE_FLOAT64_C(  -555.42), SIMDE_FLOAT64_C(   317.61), SIMDE_FLOAT64_C(   732.97), SIMDE_FLOAT64_C(   471.72) } },
+    { { SIMDE_FLOAT64_C(   299.81), SIMDE_FLOAT64_C(  -198.06), SIMDE_FLOAT64_C(  -260.56), SIMDE_FLOAT64_C(  -300.52),
+        SIMDE_FLOAT64_C(   276.97), SIMDE_FLOAT64_C(   682.45), SIMDE_FLOAT64_C(   620.36), SIMDE_FLOAT64_C(   866.38) },
+      UINT8_C( 68),
+      { SIMDE_FLOAT64_C(   862.16), SIMDE_FLOAT64_C(  -769.49), SIMDE_FLOAT64_C(  -277.09), SIMDE_FLOAT64_C(   721.59),
+        SIMDE_FLOAT64_C(   157.61), SIMDE_FLOAT64_C(   400.18), SIMDE_FLOAT64_C(  -696.93), SIMDE_FLOAT64_C(   291.30) },
+      { SIMDE_FLOAT64_C(   299.81), SIMDE_FLOAT64_C(  -198.06), SIMDE_FLOAT64_C(    -1.08), SIMDE_FLOAT64_C(  -300.52),
+        SIMDE_FLOAT64_C(   276.97), SIMDE_FLOAT64_C(   682.45), SIMDE_FLOAT64_C(    -1.36), SIMDE_FLOAT64_C(   866.38) } },
+    { { SIMDE_FLOAT64_C(  -355.91), SIMDE_FLOAT64_C(  -291.48), SIMDE_FLOAT64_C(  -210.75), SIMDE_FLOAT64_C(  -623.09),
+        SIMDE_FLOAT64_C(  -168.93), SIMDE_FLOAT64_C(   928.28), SIMDE_FLOAT64_C(  -213.14), SIMDE_FLOAT64_C(  -602.62) },
+      UINT8_C(173),
+      { SIMDE_FLOAT64_C(  -227.02), SIMDE_FLOAT64_C(   209.73), SIMDE_FLOAT64_C(   -15.76), SIMDE_FLOAT64_C(   949.93),
+        SIMDE_FLOAT64_C(   -92.34), SIMDE_FLOAT64_C(   515.02), SIMDE_FLOAT64_C(   822.44), SIMDE_FLOAT64_C(   458.19) },
+      { SIMDE_FLOAT64_C(    -0.89), SIMDE_FLOAT64_C(  -291.48), SIMDE_FLOAT64_C(    -0.98), SIMDE_FLOAT64_C(     0.93),
+        SIMDE_FLOAT64_C(  -168.93), SIMDE_FLOAT64_C(     0.50), SIMDE_FLOAT64_C(  -213.14), SIMDE_FLOAT64_C(     1.79) } },
+    { { SIMDE_FLOAT64_C(  -895.53), SIMDE_FLOAT64_C(  -869.65), SIMDE_FLOAT64_C(   844.57), SIMDE_FLOAT64_C(   487.34),
+        SIMDE_FLOAT64_C(   430.16), SIMDE_FLOAT64_C(  -353.49), SIMDE_FLOAT64_C(  -773.22), SIMDE_FLOAT64_C(  -870.36) },
+      UINT8_C( 98),
+      { SIMDE_FLOAT64_C(    70.06), SIMDE_FLOAT64_C(   807.80), SIMDE_FLOAT64_C(   126.97), SIMDE_FLOAT64_C(   105.90),
+        SIMDE_FLOAT64_C(   443.39), SIMDE_FLOAT64_C(  -322.86), SIMDE_FLOAT64_C(   443.75), SIMDE_FLOAT64_C(   305.55) },
+      { SIMDE_FLOAT64_C(  -895.53), SIMDE_FLOAT64_C(     0.79), SIMDE_FLOAT64_C(   844.57), SIMDE_FLOAT64_C(   487.34),
+        SIMDE_FLOAT64_C(   430.16), SIMDE_FLOAT64_C(     0.63), SIMDE_FLOAT64_C(     0.87), SIMDE_FLOAT64_C(  -870.36) } },
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT64_C(  -524.96), SIMDE_FLOAT64_C(   -56.99), SIMDE_FLOAT64_C(   -79.12), SIMDE_FLOAT64_C(  -410.59),
+        SIMDE_FLOAT64_C(   342.48), SIMDE_FLOAT64_C(    30.26), SIMDE_FLOAT64_C(   447.32), SIMDE_FLOAT64_C(  -884.54) },
+      UINT8_C( 31),
+      {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(  -567.36),             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(  -704.86),
+        SIMDE_FLOAT64_C(   688.40), SIMDE_FLOAT64_C(   -30.44), SIMDE_FLOAT64_C(  -186.97), SIMDE_FLOAT64_C(  -411.85) },
+      {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(    -1.11),             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(    -1.38),
+        SIMDE_FLOAT64_C(     1.34), SIMDE_FLOAT64_C(    30.26), SIMDE_FLOAT64_C(   447.32), SIMDE_FLOAT64_C(  -884.54) } },
+    { { SIMDE_FLOAT64_C(  -568.43), SIMDE_FLOAT64_C(  -934.61), SIMDE_FLOAT64_C(   147.65), SIMDE_FLOAT64_C(   946.59),
+        SIMDE_FLOAT64_C(   887.83), SIMDE_FLOAT64_C(  -394.16), SIMDE_FLOAT64_C(    16.65), SIMDE_FLOAT64_C(   695.63) },
+      UINT8_C(221),
+      { SIMDE_FLOAT64_C(  -256.46),             SIMDE_MATH_NAN,             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(  -873.67),
+        SIMDE_FLOAT64_C(   176.95), SIMDE_FLOAT64_C(   697.93), SIMDE_FLOAT64_C(  -469.22), SIMDE_FLOAT64_C(   872.51) },
+      { SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(  -934.61),             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     0.85),
+        SIMDE_FLOAT64_C(     0.69), SIMDE_FLOAT64_C(  -394.16), SIMDE_FLOAT64_C(     1.83), SIMDE_FLOAT64_C(     0.85) } },
+    { { SIMDE_FLOAT64_C(  -349.39), SIMDE_FLOAT64_C(   313.71), SIMDE_FLOAT64_C(   140.40), SIMDE_FLOAT64_C(  -109.40),
+        SIMDE_FLOAT64_C(   745.28), SIMDE_FLOAT64_C(   205.79), SIMDE_FLOAT64_C(  -961.75), SIMDE_FLOAT64_C(   691.87) },
+      UINT8_C( 63),
+      { SIMDE_FLOAT64_C(   832.82), SIMDE_FLOAT64_C(   144.82), SIMDE_FLOAT64_C(   586.44), SIMDE_FLOAT64_C(   521.22),
+        SIMDE_FLOAT64_C(  -885.62), SIMDE_FLOAT64_C(  -600.53), SIMDE_FLOAT64_C(  -890.63), SIMDE_FLOAT64_C(  -142.09) },
+      { SIMDE_FLOAT64_C(     1.63), SIMDE_FLOAT64_C(     1.13), SIMDE_FLOAT64_C(     1.15), SIMDE_FLOAT64_C(     1.02),
+                    SIMDE_MATH_NAN,             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(  -961.75), SIMDE_FLOAT64_C(   691.87) } },
+    { { SIMDE_FLOAT64_C(   909.23), SIMDE_FLOAT64_C(   750.00), SIMDE_FLOAT64_C(   789.87), SIMDE_FLOAT64_C(   -65.83),
+        SIMDE_FLOAT64_C(  -599.39), SIMDE_FLOAT64_C(   103.58), SIMDE_FLOAT64_C(  -925.44), SIMDE_FLOAT64_C(   291.21) },
+      UINT8_C( 12),
+      { SIMDE_FLOAT64_C(   -92.35), SIMDE_FLOAT64_C(  -833.34), SIMDE_FLOAT64_C(    27.14), SIMDE_FLOAT64_C(  -934.74),
+        SIMDE_FLOAT64_C(   566.84), SIMDE_FLOAT64_C(   330.22), SIMDE_FLOAT64_C(   356.57), SIMDE_FLOAT64_C(   399.66) },
+      { SIMDE_FLOAT64_C(   909.23), SIMDE_FLOAT64_C(   750.00), SIMDE_FLOAT64_C(     0.85),             SIMDE_MATH_NAN,
+        SIMDE_FLOAT64_C(  -599.39), SIMDE_FLOAT64_C(   103.58), SIMDE_FLOAT64_C(  -925.44), SIMDE_FLOAT64_C(   291.21) } },
+    #endif
+  };
+
+  simde__m512d src, a, r;
+
+  src = simde_mm512_loadu_pd(test_vec[0].src);
+  a = simde_mm512_loadu_pd(test_vec[0].a);
+  r = simde_mm512_mask_getmant_pd(src, test_vec[0].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[0].r), 1);
+
+  src = simde_mm512_loadu_pd(test_vec[1].src);
+  a = simde_mm512_loadu_pd(test_vec[1].a);
+  r = simde_mm512_mask_getmant_pd(src, test_vec[1].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[1].r), 1);
+
+  src = simde_mm512_loadu_pd(test_vec[2].src);
+  a = simde_mm512_loadu_pd(test_vec[2].a);
+  r = simde_mm512_mask_getmant_pd(src, test_vec[2].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[2].r), 1);
+
+  src = simde_mm512_loadu_pd(test_vec[3].src);
+  a = simde_mm512_loadu_pd(test_vec[3].a);
+  r = simde_mm512_mask_getmant_pd(src, test_vec[3].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[3].r), 1);
+
+  #if !defined(SIMDE_FAST_MATH)
+  src = simde_mm512_loadu_pd(test_vec[4].src);
+  a = simde_mm512_loadu_pd(test_vec[4].a);
+  r = simde_mm512_mask_getmant_pd(src, test_vec[4].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[4].r), 1);
+
+  src = simde_mm512_loadu_pd(test_vec[5].src);
+  a = simde_mm512_loadu_pd(test_vec[5].a);
+  r = simde_mm512_mask_getmant_pd(src, test_vec[5].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[5].r), 1);
+
+  src = simde_mm512_loadu_pd(test_vec[6].src);
+  a = simde_mm512_loadu_pd(test_vec[6].a);
+  r = simde_mm512_mask_getmant_pd(src, test_vec[6].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[6].r), 1);
+
+  src = simde_mm512_loadu_pd(test_vec[7].src);
+  a = simde_mm512_loadu_pd(test_vec[7].a);
+  r = simde_mm512_mask_getmant_pd(src, test_vec[7].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[7].r), 1);
+  #endif
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  simde_float64 values[8 * sizeof(simde__m512d)];
+  simde_test_x86_random_f64x8_full(8, 1, values, -1000.0, 1000.0, SIMDE_TEST_VEC_FLOAT_NAN);
+
+  {
+    simde__m512d src = simde_test_x86_random_f64x8(SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m512d a = simde_test_x86_random_extract_f64x8(0, 1, 0, values);
+    simde__m512d r = simde_mm512_mask_getmant_pd(src, k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_f64x8(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m512d src = simde_test_x86_random_f64x8(SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m512d a = simde_test_x86_random_extract_f64x8(1, 1, 0, values);
+    simde__m512d r = simde_mm512_mask_getmant_pd(src, k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_f64x8(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m512d src = simde_test_x86_random_f64x8(SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m512d a = simde_test_x86_random_extract_f64x8(2, 1, 0, values);
+    simde__m512d r = simde_mm512_mask_getmant_pd(src, k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_f64x8(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m512d src = simde_test_x86_random_f64x8(SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m512d a = simde_test_x86_random_extract_f64x8(3, 1, 0, values);
+    simde__m512d r = simde_mm512_mask_getmant_pd(src, k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+
+    simde_test_x86_write_f64x8(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m512d src = simde_test_x86_random_f64x8(SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m512d a = simde_test_x86_random_extract_f64x8(4, 1, 0, values);
+    simde__m512d r = simde_mm512_mask_getmant_pd(src, k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_f64x8(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m512d src = simde_test_x86_random_f64x8(SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m512d a = simde_test_x86_random_extract_f64x8(5, 1, 0, values);
+    simde__m512d r = simde_mm512_mask_getmant_pd(src, k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+
+    simde_test_x86_write_f64x8(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m512d src = simde_test_x86_random_f64x8(SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m512d a = simde_test_x86_random_extract_f64x8(6, 1, 0, values);
+    simde__m512d r = simde_mm512_mask_getmant_pd(src, k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_f64x8(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__m512d src = simde_test_x86_random_f64x8(SIMDE_FLOAT64_C(-1000.0), SIMDE_FLOAT64_C(1000.0));
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m512d a = simde_test_x86_random_extract_f64x8(7, 1, 0, values);
+    simde__m512d r = simde_mm512_mask_getmant_pd(src, k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_f64x8(2, src, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_maskz_getmant_pd (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { UINT8_C(249),
+      { SIMDE_FLOAT64_C(   668.78), SIMDE_FLOAT64_C(   799.33), SIMDE_FLOAT64_C(  -681.54), SIMDE_FLOAT64_C(  -227.64),
+        SIMDE_FLOAT64_C(   873.89), SIMDE_FLOAT64_C(   609.68), SIMDE_FLOAT64_C(   621.22), SIMDE_FLOAT64_C(   154.24) },
+      { SIMDE_FLOAT64_C(     1.31), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(    -0.89),
+        SIMDE_FLOAT64_C(     0.85), SIMDE_FLOAT64_C(     1.19), SIMDE_FLOAT64_C(     1.21), SIMDE_FLOAT64_C(     1.21) } },
+    { UINT8_C(  2),
+      { SIMDE_FLOAT64_C(   782.92), SIMDE_FLOAT64_C(  -599.52), SIMDE_FLOAT64_C(   969.18), SIMDE_FLOAT64_C(   247.27),
+        SIMDE_FLOAT64_C(   642.27), SIMDE_FLOAT64_C(  -422.78), SIMDE_FLOAT64_C(  -443.81), SIMDE_FLOAT64_C(  -628.58) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(    -0.59), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+        SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C( 33),
+      { SIMDE_FLOAT64_C(  -384.57), SIMDE_FLOAT64_C(  -488.38), SIMDE_FLOAT64_C(   327.34), SIMDE_FLOAT64_C(  -216.72),
+        SIMDE_FLOAT64_C(  -609.46), SIMDE_FLOAT64_C(  -807.50), SIMDE_FLOAT64_C(  -298.87), SIMDE_FLOAT64_C(  -940.68) },
+      { SIMDE_FLOAT64_C(     0.75), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+        SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.79), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT8_C(193),
+      {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   329.46),             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(  -626.03),
+        SIMDE_FLOAT64_C(   973.55), SIMDE_FLOAT64_C(   249.24), SIMDE_FLOAT64_C(   163.22), SIMDE_FLOAT64_C(  -649.54) },
+      {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+        SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.28), SIMDE_FLOAT64_C(    -1.27) } },
+    { UINT8_C( 61),
+      { SIMDE_FLOAT64_C(  -919.69),             SIMDE_MATH_NAN,             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(  -522.31),
+        SIMDE_FLOAT64_C(   464.35), SIMDE_FLOAT64_C(   241.80), SIMDE_FLOAT64_C(  -391.95), SIMDE_FLOAT64_C(   308.92) },
+      { SIMDE_FLOAT64_C(     0.90), SIMDE_FLOAT64_C(     0.00),             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     0.51),
+        SIMDE_FLOAT64_C(     1.81), SIMDE_FLOAT64_C(     0.94), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C( 22),
+      { SIMDE_FLOAT64_C(  -270.86), SIMDE_FLOAT64_C(  -961.79), SIMDE_FLOAT64_C(   955.43), SIMDE_FLOAT64_C(   -44.07),
+        SIMDE_FLOAT64_C(  -832.15), SIMDE_FLOAT64_C(   878.92), SIMDE_FLOAT64_C(  -134.84), SIMDE_FLOAT64_C(   917.85) },
+      { SIMDE_FLOAT64_C(     0.00),             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     0.93), SIMDE_FLOAT64_C(     0.00),
+                    SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(145),
+      { SIMDE_FLOAT64_C(   -60.86), SIMDE_FLOAT64_C(  -838.06), SIMDE_FLOAT64_C(   528.21), SIMDE_FLOAT64_C(   -87.31),
+        SIMDE_FLOAT64_C(   411.17), SIMDE_FLOAT64_C(  -308.57), SIMDE_FLOAT64_C(   263.15), SIMDE_FLOAT64_C(   491.48) },
+      {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+        SIMDE_FLOAT64_C(     1.61), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.92) } },
+    { UINT8_C( 62),
+      { SIMDE_FLOAT64_C(   991.83), SIMDE_FLOAT64_C(    19.59), SIMDE_FLOAT64_C(  -168.32), SIMDE_FLOAT64_C(   865.72),
+        SIMDE_FLOAT64_C(  -370.74), SIMDE_FLOAT64_C(  -547.10), SIMDE_FLOAT64_C(    19.96), SIMDE_FLOAT64_C(   568.40) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.22),             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     0.85),
+                    SIMDE_MATH_NAN,             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    #endif
+  };
+
+  simde__m512d a, r;
+
+  a = simde_mm512_loadu_pd(test_vec[0].a);
+  r = simde_mm512_maskz_getmant_pd(test_vec[0].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[0].r), 1);
+
+  a = simde_mm512_loadu_pd(test_vec[1].a);
+  r = simde_mm512_maskz_getmant_pd(test_vec[1].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[1].r), 1);
+
+  a = simde_mm512_loadu_pd(test_vec[2].a);
+  r = simde_mm512_maskz_getmant_pd(test_vec[2].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[2].r), 1);
+
+  #if !defined(SIMDE_FAST_MATH)
+  a = simde_mm512_loadu_pd(test_vec[3].a);
+  r = simde_mm512_maskz_getmant_pd(test_vec[3].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[3].r), 1);
+
+  a = simde_mm512_loadu_pd(test_vec[4].a);
+  r = simde_mm512_maskz_getmant_pd(test_vec[4].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[4].r), 1);
+
+  a = simde_mm512_loadu_pd(test_vec[5].a);
+  r = simde_mm512_maskz_getmant_pd(test_vec[5].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[5].r), 1);
+
+  a = simde_mm512_loadu_pd(test_vec[6].a);
+  r = simde_mm512_maskz_getmant_pd(test_vec[6].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[6].r), 1);
+
+  a = simde_mm512_loadu_pd(test_vec[7].a);
+  r = simde_mm512_maskz_getmant_pd(test_vec[7].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[7].r), 1);
+  #endif
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  simde_float64 values[8 * sizeof(simde__m512d)];
+  simde_test_x86_random_f64x8_full(8, 1, values, -1000.0, 1000.0, SIMDE_TEST_VEC_FLOAT_NAN);
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m512d a = simde_test_x86_random_extract_f64x8(0, 1, 0, values);
+    simde__m512d r = simde_mm512_maskz_getmant_pd(k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m512d a = simde_test_x86_random_extract_f64x8(1, 1, 0, values);
+    simde__m512d r = simde_mm512_maskz_getmant_pd(k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m512d a = simde_test_x86_random_extract_f64x8(2, 1, 0, values);
+    simde__m512d r = simde_mm512_maskz_getmant_pd(k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m512d a = simde_test_x86_random_extract_f64x8(3, 1, 0, values);
+    simde__m512d r = simde_mm512_maskz_getmant_pd(k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m512d a = simde_test_x86_random_extract_f64x8(4, 1, 0, values);
+    simde__m512d r = simde_mm512_maskz_getmant_pd(k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m512d a = simde_test_x86_random_extract_f64x8(5, 1, 0, values);
+    simde__m512d r = simde_mm512_maskz_getmant_pd(k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m512d a = simde_test_x86_random_extract_f64x8(6, 1, 0, values);
+    simde__m512d r = simde_mm512_maskz_getmant_pd(k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+
+  {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m512d a = simde_test_x86_random_extract_f64x8(7, 1, 0, values);
+    simde__m512d r = simde_mm512_maskz_getmant_pd(k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f64x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_f64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_getmant_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_getmant_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_getmant_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_getmant_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_getmant_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_getmant_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_getmant_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_getmant_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_getmant_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_getmant_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_getmant_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_getmant_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_getmant_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_getmant_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_getmant_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_getmant_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_getmant_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_getmant_pd)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -0,0 +1,1873 @@
+#define SIMDE_TEST_X86_AVX512_INSN madd52
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/madd52.h>
+
+static int
+test_simde_mm_madd52lo_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint64_t a[2];
+    const uint64_t b[2];
+    const uint64_t c[2];
+    const uint64_t r[2];
+  } test_vec[] = {
+    { { UINT64_C(14335459235194530973), UINT64_C( 4630535304631516704) },
+      { UINT64_C( 4413394113317965234), UINT64_C(17954437036232462751) },
+      { UINT64_C(17286143369940436965), UINT64_C(  344985321846299445) },
+      { UINT64_C(14338339233851968215), UINT64_C( 4631682329895987467) } },
+    { { UINT64_C(  972036922180298671), UINT64_C( 2054712588660587823) },
+      { UINT64_C( 4004576386549893845), UINT64_C( 4886275392886862456) },
+      { UINT64_C( 8929512491336330865), UINT64_C( 3715620731347111997) },
+      { UINT64_C(  974989263755670964), UINT64_C( 2058692563889062855) } },
+    { { UINT64_C( 6848685202287872467), UINT64_C(14282315565323963228) },
+      { UINT64_C(17703528876265027560), UINT64_C( 1203298092987298849) },
+      { UINT64_C( 5767405727142742466), UINT64_C( 1573855431212741564) },
+      { UINT64_C( 6851508611774959523), UINT64_C(14284680776129619608) } },
+    { { UINT64_C( 3448059728277109805), UINT64_C(18373386014756324013) },
+      { UINT64_C(10101205425373831402), UINT64_C( 1236085145633386468) },
+      { UINT64_C( 1598161496942473456), UINT64_C( 2831633027140999954) },
+      { UINT64_C( 3451474461296867213), UINT64_C(18375764475299507381) } },
+    { { UINT64_C( 9743594571874825179), UINT64_C( 4294393671016109730) },
+      { UINT64_C( 8047763611323043376), UINT64_C( 9774228098936320065) },
+      { UINT64_C( 9162129091534760699), UINT64_C(12738323242176331585) },
+      { UINT64_C( 9744046181636390123), UINT64_C( 4294862551286093347) } },
+    { { UINT64_C(12103698217343451179), UINT64_C(13392520835720656297) },
+      { UINT64_C(13533457043575803508), UINT64_C(11488135589745120830) },
+      { UINT64_C( 6421043110958642958), UINT64_C( 9245196297188557270) },
+      { UINT64_C(12106078544980784771), UINT64_C(13393521016626252669) } },
+    { { UINT64_C( 7191582460093834904), UINT64_C( 3642162108107396472) },
+      { UINT64_C(12200747081172169543), UINT64_C( 2346528822364339972) },
+      { UINT64_C( 9059272148353442353), UINT64_C(12784299229294746389) },
+      { UINT64_C( 7192794723562169647), UINT64_C( 3644546866533854412) } },
+    { { UINT64_C(15502791603535810983), UINT64_C( 2207459728846971641) },
+      { UINT64_C(16815646975976592602), UINT64_C( 7071932051596953096) },
+      { UINT64_C(13855327309237439901), UINT64_C( 9398982358914445412) },
+      { UINT64_C(15505946942385696089), UINT64_C( 2208835969861172761) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i c = simde_x_mm_loadu_epi64(test_vec[i].c);
+    simde__m128i r = simde_mm_madd52lo_epu64(a, b, c);
+    simde_test_x86_assert_equal_u64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m128i a = simde_test_x86_random_u64x2();
+    simde__m128i b = simde_test_x86_random_u64x2();
+    simde__m128i c = simde_test_x86_random_u64x2();
+    simde__m128i r = simde_mm_madd52lo_epu64(a, b, c);
+
+    simde_test_x86_write_u64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_u64x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x2(2, c, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_mask_madd52lo_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint64_t a[2];
+    const simde__mmask8 k;
+    const uint64_t b[2];
+    const uint64_t c[2];
+    const uint64_t r[2];
+  } test_vec[] = {
+    { { UINT64_C( 1834863976012506040), UINT64_C(14025247338605090949) },
+      UINT8_C(126),
+      { UINT64_C(12458652550998340480), UINT64_C( 9936302687082788680) },
+      { UINT64_C( 9258754222111486264), UINT64_C(16243754196542012735) },
+      { UINT64_C( 1834863976012506040), UINT64_C(14027691015796579133) } },
+    { { UINT64_C(  127027373318321051), UINT64_C( 2788029358892980097) },
+      UINT8_C(131),
+      { UINT64_C( 6358497304137899595), UINT64_C( 5590263027878931857) },
+      { UINT64_C( 9784359839953497341), UINT64_C(17206454972614832436) },
+      { UINT64_C(  131394122049980346), UINT64_C( 2789913284134099445) } },
+    { { UINT64_C(12730878035703379129), UINT64_C(18248372388903872087) },
+      UINT8_C(234),
+      { UINT64_C(18411243103699158341), UINT64_C(14171297030166660949) },
+      { UINT64_C( 1368413331045810044), UINT64_C( 8315350450015759934) },
+      { UINT64_C(12730878035703379129), UINT64_C(18252564402016531181) } },
+    { { UINT64_C(17681485769140649812), UINT64_C( 1035425023175033609) },
+      UINT8_C(144),
+      { UINT64_C(11534931071313163330), UINT64_C(13169722637520048224) },
+      { UINT64_C(10037199243125859840), UINT64_C( 9535013501326451762) },
+      { UINT64_C(17681485769140649812), UINT64_C( 1035425023175033609) } },
+    { { UINT64_C( 4409709982583066592), UINT64_C( 4660223138740371200) },
+      UINT8_C(151),
+      { UINT64_C(12862468334525841922), UINT64_C( 2725937363710919623) },
+      { UINT64_C(10899625446358542036), UINT64_C(16857845207857052395) },
+      { UINT64_C( 4410213124209378696), UINT64_C( 4664454204316929197) } },
+    { { UINT64_C( 9447065188193211034), UINT64_C( 6608271073852460794) },
+      UINT8_C(177),
+      { UINT64_C( 2081191768221130679), UINT64_C( 4785897248427031992) },
+      { UINT64_C(18146272752380596771), UINT64_C(15057185129288066297) },
+      { UINT64_C( 9450767047863436959), UINT64_C( 6608271073852460794) } },
+    { { UINT64_C(15455411770126384765), UINT64_C(10256967302958710757) },
+      UINT8_C(227),
+      { UINT64_C(11588266778397010006), UINT64_C( 5235585243594429773) },
+      { UINT64_C(  277883443292342351), UINT64_C(11518233441580544484) },
+      { UINT64_C(15459749352258609415), UINT64_C(10259898699842909561) } },
+    { { UINT64_C(13925210808791902308), UINT64_C(15110304087136860511) },
+      UINT8_C(157),
+      { UINT64_C(10680889750205875993), UINT64_C(12750389871237738386) },
+      { UINT64_C(14672135852191421172), UINT64_C(15060915356196210385) },
+      { UINT64_C(13927477208965361208), UINT64_C(15110304087136860511) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i c = simde_x_mm_loadu_epi64(test_vec[i].c);
+    simde__m128i r = simde_mm_mask_madd52lo_epu64(a, test_vec[i].k, b, c);
+    simde_test_x86_assert_equal_u64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m128i a = simde_test_x86_random_u64x2();
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128i b = simde_test_x86_random_u64x2();
+    simde__m128i c = simde_test_x86_random_u64x2();
+    simde__m128i r = simde_mm_mask_madd52lo_epu64(a, k, b, c);
+
+    simde_test_x86_write_u64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x2(2, c, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_maskz_madd52lo_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const uint64_t a[2];
+    const uint64_t b[2];
+    const uint64_t c[2];
+    const uint64_t r[2];
+  } test_vec[] = {
+    { UINT8_C(229),
+      { UINT64_C(10581801482909657124), UINT64_C(17035510292879665401) },
+      { UINT64_C( 5486942651871570030), UINT64_C(12959906791474629590) },
+      { UINT64_C( 8715264071491674878), UINT64_C( 5009790418031643711) },
+      { UINT64_C(10585792989826998600), UINT64_C(                   0) } },
+    { UINT8_C(  1),
+      { UINT64_C( 5306528708663155012), UINT64_C(15378539779978729879) },
+      { UINT64_C( 5448737341698264200), UINT64_C(   78364105309829051) },
+      { UINT64_C( 9730155572276190464), UINT64_C(17606084337411153933) },
+      { UINT64_C( 5310115466458235204), UINT64_C(                   0) } },
+    { UINT8_C( 44),
+      { UINT64_C( 2824380322746684330), UINT64_C(13457008976908797784) },
+      { UINT64_C( 7437186286943370933), UINT64_C(13165086091878053414) },
+      { UINT64_C( 3184994725806317083), UINT64_C(12951698306079922086) },
+      { UINT64_C(                   0), UINT64_C(                   0) } },
+    { UINT8_C( 42),
+      { UINT64_C(14537364594637266023), UINT64_C(11010892047842625259) },
+      { UINT64_C( 2647721912463907512), UINT64_C(16671434662880658053) },
+      { UINT64_C( 1192960382742826417), UINT64_C(12040535161130214278) },
+      { UINT64_C(                   0), UINT64_C(11012691530008004489) } },
+    { UINT8_C(108),
+      { UINT64_C( 4658022179139075973), UINT64_C( 4559514408950159040) },
+      { UINT64_C(18225069994258205478), UINT64_C(  736219262664535096) },
+      { UINT64_C( 1085593252874793298), UINT64_C(11318929559600287907) },
+      { UINT64_C(                   0), UINT64_C(                   0) } },
+    { UINT8_C(245),
+      { UINT64_C( 6567809494188688248), UINT64_C(15662649962261377142) },
+      { UINT64_C(  973682683335420946), UINT64_C(16625918105205561819) },
+      { UINT64_C( 5435273915038648611), UINT64_C( 5326263255584493033) },
+      { UINT64_C( 6568853474857135086), UINT64_C(                   0) } },
+    { UINT8_C(221),
+      { UINT64_C(  370464690265532690), UINT64_C(17216796989806864810) },
+      { UINT64_C(13478444026504020268), UINT64_C( 1940834870283607650) },
+      { UINT64_C(15786954184296958308), UINT64_C( 1009814440207878513) },
+      { UINT64_C(  374090511888230978), UINT64_C(                   0) } },
+    { UINT8_C(149),
+      { UINT64_C( 6788542298469970630), UINT64_C( 4706403687791544497) },
+      { UINT64_C(   62290045657244133), UINT64_C(13554973920110769138) },
+      { UINT64_C(10502893373521666082), UINT64_C(10270123226675685389) },
+      { UINT64_C( 6789490126048187184), UINT64_C(                   0) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i c = simde_x_mm_loadu_epi64(test_vec[i].c);
+    simde__m128i r = simde_mm_maskz_madd52lo_epu64(test_vec[i].k, a, b, c);
+    simde_test_x86_assert_equal_u64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128i a = simde_test_x86_random_u64x2();
+    simde__m128i b = simde_test_x86_random_u64x2();
+    simde__m128i c = simde_test_x86_random_u64x2();
+    simde__m128i r = simde_mm_maskz_madd52lo_epu64(k, a, b, c);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_u64x2(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x2(2, c, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_madd52lo_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint64_t a[4];
+    const uint64_t b[4];
+    const uint64_t c[4];
+    const uint64_t r[4];
+  } test_vec[] = {
+    { { UINT64_C( 3938072713552983855), UINT64_C(11204633135142504651), UINT64_C(16243567777434898170), UINT64_C(16725995974793030374) },
+      { UINT64_C(13627388839869684132), UINT64_C(12741244879359696061), UINT64_C( 8341501648573287948), UINT64_C( 4143631158070208737) },
+      { UINT64_C(  210331373945294907), UINT64_C( 8467340595201337883), UINT64_C(16562012937302379992), UINT64_C( 4165267798794099712) },
+      { UINT64_C( 3942250357852872699), UINT64_C(11206305214350496442), UINT64_C(16245844877649478938), UINT64_C(16728306276085679846) } },
+    { { UINT64_C( 5356840640735342352), UINT64_C( 8186028553777418428), UINT64_C(  545972427374915498), UINT64_C( 2504680970622079627) },
+      { UINT64_C( 4094280566205524313), UINT64_C( 3848879532809252190), UINT64_C( 8859838239316590822), UINT64_C( 6034196755879530633) },
+      { UINT64_C( 7035374694288798959), UINT64_C(15949993917736943513), UINT64_C( 4353784244360330242), UINT64_C( 2566370314985893455) },
+      { UINT64_C( 5360558746239016231), UINT64_C( 8188071243398582250), UINT64_C(  549855751490722166), UINT64_C( 2506526549665090258) } },
+    { { UINT64_C(13703380705068546248), UINT64_C( 5333171560517895471), UINT64_C(15882128306384653688), UINT64_C(11271599283929235221) },
+      { UINT64_C( 6422013403885730364), UINT64_C(13090418467029320216), UINT64_C(11725202499209127248), UINT64_C(16066970599987863176) },
+      { UINT64_C(  924749702644064338), UINT64_C( 2833633705877853536), UINT64_C(  444374760588326140), UINT64_C(13842758408687720091) },
+      { UINT64_C(13703916261014380544), UINT64_C( 5334054563069904431), UINT64_C(15884433919558142008), UINT64_C(11275640041237752685) } },
+    { { UINT64_C( 1854376631498201788), UINT64_C( 4279838287636932966), UINT64_C(13961983644945115455), UINT64_C( 4337557430586975492) },
+      { UINT64_C(16592573295097572979), UINT64_C( 4993799320485821394), UINT64_C(  349808520989839859), UINT64_C( 7252671104248371433) },
+      { UINT64_C(  972447921969598999), UINT64_C( 2313561773411640016), UINT64_C(14519628153031826557), UINT64_C(13205356342349658092) },
+      { UINT64_C( 1856116289729715473), UINT64_C( 4281766673726089222), UINT64_C(13965886748125544678), UINT64_C( 4337764921149352656) } },
+    { { UINT64_C( 8625745306271601259), UINT64_C(13599859597166629743), UINT64_C(17739319432263103876), UINT64_C(11963836849829732784) },
+      { UINT64_C(10594437904963819497), UINT64_C( 4670773481584940245), UINT64_C( 8421965241103223521), UINT64_C(12976784550457029685) },
+      { UINT64_C( 4169008774126002979), UINT64_C(15536046482498914975), UINT64_C( 5359461771620991273), UINT64_C( 1573393378907399510) },
+      { UINT64_C( 8629314040172507718), UINT64_C(13602687386229790138), UINT64_C(17741611768444933261), UINT64_C(11967552851568661630) } },
+    { { UINT64_C(  275061957438740787), UINT64_C( 7426429455697846082), UINT64_C(14527121951103963195), UINT64_C( 6476387532726228441) },
+      { UINT64_C(13132991792917069017), UINT64_C(15386826965330600162), UINT64_C( 7640848869083176141), UINT64_C(10201521440444248852) },
+      { UINT64_C( 2916938681758221393), UINT64_C( 3754824951539526060), UINT64_C( 1488295641853739181), UINT64_C( 4877928297231473776) },
+      { UINT64_C(  276139137564884444), UINT64_C( 7428077785440119066), UINT64_C(14530416404538214084), UINT64_C( 6480118049860083353) } },
+    { { UINT64_C( 3878870901609495653), UINT64_C(11207374722586844653), UINT64_C(16855988766141709527), UINT64_C( 9336452531293600349) },
+      { UINT64_C(  862441659788270138), UINT64_C(16332839554012640031), UINT64_C( 6937413709869974243), UINT64_C( 5511631969264227296) },
+      { UINT64_C(14700602052439944154), UINT64_C( 3343786703954011003), UINT64_C(11991345031832805638), UINT64_C( 3639507012114585636) },
+      { UINT64_C( 3880215432066011081), UINT64_C(11211592934334032594), UINT64_C(16860063782249976105), UINT64_C( 9338787199080859101) } },
+    { { UINT64_C( 1460342316344185547), UINT64_C(12180268470475825040), UINT64_C( 9840114930570990370), UINT64_C( 2143221195967705652) },
+      { UINT64_C(11997828097649273042), UINT64_C( 4487144459217214200), UINT64_C( 5263220413246732318), UINT64_C(15805545655341271273) },
+      { UINT64_C(13779264190588382588), UINT64_C( 7150765431326423778), UINT64_C(  357454647589692567), UINT64_C(15824126673911007927) },
+      { UINT64_C( 1462548120134992515), UINT64_C(12180769000071634560), UINT64_C( 9840807139667911892), UINT64_C( 2145121331353463491) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i c = simde_x_mm256_loadu_epi64(test_vec[i].c);
+    simde__m256i r = simde_mm256_madd52lo_epu64(a, b, c);
+    simde_test_x86_assert_equal_u64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m256i a = simde_test_x86_random_u64x4();
+    simde__m256i b = simde_test_x86_random_u64x4();
+    simde__m256i c = simde_test_x86_random_u64x4();
+    simde__m256i r = simde_mm256_madd52lo_epu64(a, b, c);
+
+    simde_test_x86_write_u64x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_u64x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x4(2, c, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_mask_madd52lo_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint64_t a[4];
+    const simde__mmask8 k;
+    const uint64_t b[4];
+    const uint64_t c[4];
+    const uint64_t r[4];
+  } test_vec[] = {
+    { { UINT64_C(10018722092090777988), UINT64_C(11171676970138821729), UINT64_C(10684857036967505449), UINT64_C(11691606446970210054) },
+      UINT8_C(207),
+      { UINT64_C( 6536134790712192429), UINT64_C( 5943618342519462796), UINT64_C(10413099729644666944), UINT64_C(15408029453165455126) },
+      { UINT64_C(15893166046067641406), UINT64_C( 2805649000331406649), UINT64_C(17798829228031090282), UINT64_C( 4614166526121783564) },
+      { UINT64_C(10021389995056287082), UINT64_C(11175136553426248333), UINT64_C(10688395425051117737), UINT64_C(11693553072204976654) } },
+    { { UINT64_C( 5208697808809636124), UINT64_C(10087170507207440368), UINT64_C(14973062227198648050), UINT64_C(12966720498301061041) },
+      UINT8_C( 60),
+      { UINT64_C(16166959942845866088), UINT64_C(14790257885573165690), UINT64_C(11978835997615985803), UINT64_C( 5524212381334237538) },
+      { UINT64_C(  313585709052654865), UINT64_C( 8449759961077144646), UINT64_C(10749598851120878504), UINT64_C( 7881769234836122416) },
+      { UINT64_C( 5208697808809636124), UINT64_C(10087170507207440368), UINT64_C(14975313637798161194), UINT64_C(12969740912212574225) } },
+    { { UINT64_C( 8299925400044640673), UINT64_C(13690428388255826334), UINT64_C( 7982474475994415103), UINT64_C( 1632806057065826782) },
+      UINT8_C(253),
+      { UINT64_C(17397578468403331471), UINT64_C(17776486143500941446), UINT64_C( 8455688261568095240), UINT64_C(14557604574084633382) },
+      { UINT64_C( 6170789996310311233), UINT64_C( 8498777853838993668), UINT64_C(17203549126666429854), UINT64_C(17068923693729098459) },
+      { UINT64_C( 8302374923046886896), UINT64_C(13690428388255826334), UINT64_C( 7983241558312281327), UINT64_C( 1637227064156677984) } },
+    { { UINT64_C(10183835614539775024), UINT64_C(12955863360607902698), UINT64_C(16020917972256013214), UINT64_C( 9150704544877137510) },
+      UINT8_C( 81),
+      { UINT64_C( 3226098859115183514), UINT64_C(11747345957061205231), UINT64_C( 1230755673674313201), UINT64_C(13664163309360653690) },
+      { UINT64_C(15012571104526498393), UINT64_C( 9080452625139800185), UINT64_C(12357949058079042476), UINT64_C( 1533082853430714214) },
+      { UINT64_C(10185756922630539962), UINT64_C(12955863360607902698), UINT64_C(16020917972256013214), UINT64_C( 9150704544877137510) } },
+    { { UINT64_C(13026545631471066645), UINT64_C(16949887904796507951), UINT64_C( 1054365306515515333), UINT64_C( 5371348727268613050) },
+      UINT8_C(187),
+      { UINT64_C(  544841032898331082), UINT64_C(17122177288549845951), UINT64_C(14997166208893424779), UINT64_C(16921237798709990971) },
+      { UINT64_C( 3792271084863867537), UINT64_C(11788641617778173478), UINT64_C(  883878505954750015), UINT64_C( 3155890407483984576) },
+      { UINT64_C(13027555027094504831), UINT64_C(16954153840616527753), UINT64_C( 1054365306515515333), UINT64_C( 5372049957857285626) } },
+    { { UINT64_C( 1616058824203179715), UINT64_C( 7279324593138072139), UINT64_C(17971366069748240265), UINT64_C( 5273051629906136168) },
+      UINT8_C(186),
+      { UINT64_C( 7611578074633306609), UINT64_C( 1759205452707464068), UINT64_C(13282604228524754126), UINT64_C( 8611593346634045475) },
+      { UINT64_C( 8313485414066105608), UINT64_C(12795496076997226097), UINT64_C( 5864799616756540287), UINT64_C( 3407143713419927628) },
+      { UINT64_C( 1616058824203179715), UINT64_C( 7280225894905397135), UINT64_C(17971366069748240265), UINT64_C( 5276374512820065996) } },
+    { { UINT64_C(17666360764067550665), UINT64_C(13260851548078964083), UINT64_C(16601612491447052005), UINT64_C(16266157534605770087) },
+      UINT8_C( 22),
+      { UINT64_C( 4817601200605731298), UINT64_C(16205415154076824062), UINT64_C(15691774050998876311), UINT64_C(17451399142897242649) },
+      { UINT64_C( 6157322664640366957), UINT64_C(13366467238947057254), UINT64_C( 8388476967260191283), UINT64_C(11254422004415945517) },
+      { UINT64_C(17666360764067550665), UINT64_C(13265146073343954087), UINT64_C(16603679315663561466), UINT64_C(16266157534605770087) } },
+    { { UINT64_C( 2536443298865580166), UINT64_C(17801113883793066031), UINT64_C( 2957722547963502908), UINT64_C(15787251213145643084) },
+      UINT8_C( 30),
+      { UINT64_C( 8382886571620940260), UINT64_C(15149598633813911232), UINT64_C( 8787358367196566966), UINT64_C( 7571019936589311326) },
+      { UINT64_C(12376986796440874083), UINT64_C(16144819905327135626), UINT64_C( 3466498283768634305), UINT64_C(17785899735666977255) },
+      { UINT64_C( 2536443298865580166), UINT64_C(17805103803952442287), UINT64_C( 2958072933840515442), UINT64_C(15788011622274815518) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i c = simde_x_mm256_loadu_epi64(test_vec[i].c);
+    simde__m256i r = simde_mm256_mask_madd52lo_epu64(a, test_vec[i].k, b, c);
+    simde_test_x86_assert_equal_u64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m256i a = simde_test_x86_random_u64x4();
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256i b = simde_test_x86_random_u64x4();
+    simde__m256i c = simde_test_x86_random_u64x4();
+    simde__m256i r = simde_mm256_mask_madd52lo_epu64(a, k, b, c);
+
+    simde_test_x86_write_u64x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x4(2, c, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_maskz_madd52lo_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const uint64_t a[4];
+    const uint64_t b[4];
+    const uint64_t c[4];
+    const uint64_t r[4];
+  } test_vec[] = {
+    { UINT8_C( 34),
+      { UINT64_C(  346978421765326179), UINT64_C(17515078497912949605), UINT64_C(13400450585464321174), UINT64_C(11129031534035362330) },
+      { UINT64_C(11211343170319187592), UINT64_C( 7766737747476006332), UINT64_C(11473890393401822899), UINT64_C( 6027331201011779796) },
+      { UINT64_C(17559951898631833312), UINT64_C( 5656399752255282496), UINT64_C( 4702897571642866207), UINT64_C( 8481389246631654292) },
+      { UINT64_C(                   0), UINT64_C(17516505289728509541), UINT64_C(                   0), UINT64_C(                   0) } },
+    { UINT8_C(120),
+      { UINT64_C(15660038708209355672), UINT64_C(16220773884045322091), UINT64_C( 3978243095883858068), UINT64_C(16088337020502185179) },
+      { UINT64_C(  207523572828271820), UINT64_C(12498923938501252781), UINT64_C( 3320703592667399129), UINT64_C(17239288043794063639) },
+      { UINT64_C( 2580238740798058549), UINT64_C(13832011198112451631), UINT64_C(15884392446031643632), UINT64_C(16331874885699333267) },
+      { UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(16092072061634185488) } },
+    { UINT8_C(169),
+      { UINT64_C( 5379341386554257310), UINT64_C( 2888759978472042489), UINT64_C( 3878385194812397708), UINT64_C(14710942411805329413) },
+      { UINT64_C( 9456410820285319027), UINT64_C(16710535338865028058), UINT64_C(11823628662763541783), UINT64_C( 3421409416642230144) },
+      { UINT64_C( 9555894770490982288), UINT64_C( 2019911733908620998), UINT64_C(11908381792504982784), UINT64_C( 4608817048025523466) },
+      { UINT64_C( 5380418642803862862), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(14712071978934973189) } },
+    { UINT8_C(141),
+      { UINT64_C( 4339426007618902294), UINT64_C(10244667023791577344), UINT64_C( 8392273253916461915), UINT64_C( 5262565237326036396) },
+      { UINT64_C(18153995785819799484), UINT64_C(16878175905034744139), UINT64_C(17555822202053979678), UINT64_C(16539598447241446668) },
+      { UINT64_C( 9343991991552721845), UINT64_C( 4913823182050153400), UINT64_C( 7246595646263822679), UINT64_C( 3019430951947402969) },
+      { UINT64_C( 4343019567714704642), UINT64_C(                   0), UINT64_C( 8392889955463972237), UINT64_C( 5262588709343145176) } },
+    { UINT8_C(111),
+      { UINT64_C( 6394872348673431935), UINT64_C(13912678322325554771), UINT64_C( 4621393891283284277), UINT64_C( 9997389788467176481) },
+      { UINT64_C(15894699005935968951), UINT64_C(  815058995581031254), UINT64_C(  567022435477776476), UINT64_C( 2824059815902679963) },
+      { UINT64_C( 7627682778878100085), UINT64_C( 8786038116750684684), UINT64_C( 6169357246281499567), UINT64_C( 8872141869123695240) },
+      { UINT64_C( 6397094203920393506), UINT64_C(13912979778861087323), UINT64_C( 4622672903540907033), UINT64_C(10000629902577439865) } },
+    { UINT8_C(240),
+      { UINT64_C(14234308678093339012), UINT64_C(11410533055163690339), UINT64_C( 9219060355279941490), UINT64_C(10289035241456986538) },
+      { UINT64_C(11209623543682419832), UINT64_C( 4610736922430960130), UINT64_C(12509758429573109135), UINT64_C(10887257621061312384) },
+      { UINT64_C(13542029102548198171), UINT64_C( 7238153027249058918), UINT64_C( 3538452381089929834), UINT64_C(  860700933543862586) },
+      { UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0) } },
+    { UINT8_C(245),
+      { UINT64_C( 9344239478692994644), UINT64_C( 7926820592116162945), UINT64_C( 3138816020347580217), UINT64_C( 3301462718981859338) },
+      { UINT64_C( 7588885226126147460), UINT64_C(11152321565541050115), UINT64_C( 4550180665029485680), UINT64_C(16892418800737796198) },
+      { UINT64_C(  629391260649251436), UINT64_C( 3363667470008171699), UINT64_C( 9258642283562638345), UINT64_C(17428979511789066383) },
+      { UINT64_C( 9346187880365404676), UINT64_C(                   0), UINT64_C( 3142491396123506473), UINT64_C(                   0) } },
+    { UINT8_C( 14),
+      { UINT64_C(13716586783998952859), UINT64_C(13378411212287274874), UINT64_C(18208426457981773779), UINT64_C( 2399982671863391763) },
+      { UINT64_C(17759985248663855544), UINT64_C( 8244190543678469267), UINT64_C(11783181962164059430), UINT64_C( 3788426122121906411) },
+      { UINT64_C( 1370332886819822738), UINT64_C(18404854716401162842), UINT64_C( 3431197854550065002), UINT64_C( 4956551906012004632) },
+      { UINT64_C(                   0), UINT64_C(13382161093123103016), UINT64_C(18211051021758894991), UINT64_C( 2401027094706710299) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i c = simde_x_mm256_loadu_epi64(test_vec[i].c);
+    simde__m256i r = simde_mm256_maskz_madd52lo_epu64(test_vec[i].k, a, b, c);
+    simde_test_x86_assert_equal_u64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256i a = simde_test_x86_random_u64x4();
+    simde__m256i b = simde_test_x86_random_u64x4();
+    simde__m256i c = simde_test_x86_random_u64x4();
+    simde__m256i r = simde_mm256_maskz_madd52lo_epu64(k, a, b, c);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_u64x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x4(2, c, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_madd52lo_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint64_t a[8];
+    const uint64_t b[8];
+    const uint64_t c[8];
+    const uint64_t r[8];
+  } test_vec[] = {
+    { { UINT64_C( 8657420545846065041), UINT64_C( 9280471972594182641), UINT64_C( 8957404997872145371), UINT64_C(13227029384806854809),
+        UINT64_C( 2965600806881583505), UINT64_C( 5867554203734612439), UINT64_C(11164633484925921297), UINT64_C( 7749698641549656496) },
+      { UINT64_C( 1997137821971404118), UINT64_C( 8764416540231183323), UINT64_C( 9365761890932626014), UINT64_C(12260455509334154975),
+        UINT64_C( 6744404885224570937), UINT64_C( 8538067433123848603), UINT64_C( 3005253665143745377), UINT64_C( 2858106731830119341) },
+      { UINT64_C( 7937380848110986056), UINT64_C( 9614602622026765790), UINT64_C(13748481485960594009), UINT64_C(   39522733146419062),
+        UINT64_C( 5516331673392394572), UINT64_C( 5075751315947388615), UINT64_C(  703042659876939762), UINT64_C( 3827210761981034596) },
+      { UINT64_C( 8661098823889582529), UINT64_C( 9284655901061228763), UINT64_C( 8958843866504295049), UINT64_C(13228090999159266403),
+        UINT64_C( 2967704569993354109), UINT64_C( 5868914964111360852), UINT64_C(11167213095692349635), UINT64_C( 7750811024370045252) } },
+    { { UINT64_C(11522145017092433452), UINT64_C(14705373021641255391), UINT64_C( 1638907511149952034), UINT64_C( 6066153160994598161),
+        UINT64_C( 4876787497707668277), UINT64_C( 6098757021653284862), UINT64_C( 1578730492894212895), UINT64_C(11416693676547447540) },
+      { UINT64_C( 3560192482134941377), UINT64_C(13481152319555401872), UINT64_C(15796504224789700383), UINT64_C( 5086367753778448271),
+        UINT64_C( 3038473561177801158), UINT64_C(18348230992552801100), UINT64_C( 3666591603367161633), UINT64_C(  606789965135403680) },
+      { UINT64_C(17709891691659580930), UINT64_C(15365296440806847071), UINT64_C( 6234318573982735790), UINT64_C( 8206656314097250201),
+        UINT64_C( 8168354425141585340), UINT64_C( 7354075517528586373), UINT64_C( 4852414923880852298), UINT64_C( 8488442768272577260) },
+      { UINT64_C(11524084971780372910), UINT64_C(14707376855163537231), UINT64_C( 1639680204710307380), UINT64_C( 6066636166782497416),
+        UINT64_C( 4881079438522379933), UINT64_C( 6100570658989637242), UINT64_C( 1582910215036886441), UINT64_C(11418017299192866420) } },
+    { { UINT64_C( 3704834868121426663), UINT64_C( 5876769834421525103), UINT64_C( 8021940642144929382), UINT64_C( 6532920355052024187),
+        UINT64_C( 3122329057368442226), UINT64_C(11759146278625460696), UINT64_C(11896829245503275303), UINT64_C(17313387819835188600) },
+      { UINT64_C( 3382032168981141511), UINT64_C( 5333736555868406309), UINT64_C( 4074931654273382590), UINT64_C(17321805043177055989),
+        UINT64_C(18268187613077992193), UINT64_C(10255370141837529829), UINT64_C( 5554069020157036573), UINT64_C(11692509708362463338) },
+      { UINT64_C( 9253911639914903703), UINT64_C( 5579918366812458002), UINT64_C( 6109202071320978978), UINT64_C( 4880473370084804726),
+        UINT64_C( 5043783314212828388), UINT64_C( 9541041154395965418), UINT64_C( 5168943600016200316), UINT64_C( 3692416575800828751) },
+      { UINT64_C( 3705522619655802632), UINT64_C( 5879907553352695049), UINT64_C( 8022741982375478178), UINT64_C( 6535063154850205289),
+        UINT64_C( 3123897035898005078), UINT64_C(11760980790518336042), UINT64_C(11898224020449196339), UINT64_C(17316115188685098030) } },
+    { { UINT64_C(17962238837513187533), UINT64_C( 9231671166074383672), UINT64_C( 3541977627758042127), UINT64_C( 7820055035503216132),
+        UINT64_C( 2405682966046783578), UINT64_C(  118176549734938144), UINT64_C( 3461026397544352500), UINT64_C(18058038809685341583) },
+      { UINT64_C(15802504075207182402), UINT64_C(15361675942007081019), UINT64_C(12216213109708951596), UINT64_C( 6378068033630899178),
+        UINT64_C(16578825186581997180), UINT64_C(16253565498691949274), UINT64_C(15859076384790494547), UINT64_C(15941310437650722508) },
+      { UINT64_C( 7593395043433823951), UINT64_C(  923156254508217658), UINT64_C(10862840398501972210), UINT64_C(16049898948973307261),
+        UINT64_C( 3704697751382643056), UINT64_C( 3815940053954301232), UINT64_C( 8744258731633044985), UINT64_C(17575883048847200766) },
+      { UINT64_C(17966728417421400619), UINT64_C( 9235616170792141206), UINT64_C( 3544628559016019367), UINT64_C( 7821357780854581574),
+        UINT64_C( 2406378550754626202), UINT64_C(  118635927093055744), UINT64_C( 3462462452417071023), UINT64_C(18060349517109833719) } },
+    { { UINT64_C( 3319535550569006053), UINT64_C( 2116704070538769129), UINT64_C( 5759603995486222456), UINT64_C( 4575734576140994058),
+        UINT64_C(13237538144290435721), UINT64_C( 5737940893661580385), UINT64_C(14149100265974038971), UINT64_C( 9697325304335415033) },
+      { UINT64_C( 4668477851594240324), UINT64_C(12228793537306930063), UINT64_C( 2767198284231834344), UINT64_C(14864428034260908230),
+        UINT64_C(12168630645683148479), UINT64_C(17504299925042537556), UINT64_C( 8615945396785881150), UINT64_C(15640019754687270068) },
+      { UINT64_C(16905200828300127449), UINT64_C(12463457354583419642), UINT64_C( 4458748934928960696), UINT64_C( 8549952628941593268),
+        UINT64_C( 8139136426809302900), UINT64_C(17422575621727658159), UINT64_C( 4449057839848808697), UINT64_C( 3920299650498378324) },
+      { UINT64_C( 3323499220724627081), UINT64_C( 2119653875158921871), UINT64_C( 5760781294952755000), UINT64_C( 4577845088780766530),
+        UINT64_C(13241768563370156565), UINT64_C( 5738933699426361805), UINT64_C(14150379020085075465), UINT64_C( 9701764657990773257) } },
+    { { UINT64_C( 9635228022705541586), UINT64_C(10555992883853405269), UINT64_C( 7354609169788557387), UINT64_C(11602609439254191116),
+        UINT64_C(14910187434618144144), UINT64_C( 4897623880176012748), UINT64_C(16801848143260289971), UINT64_C(15182684661252326211) },
+      { UINT64_C(  596765688987163392), UINT64_C( 3669137920384410800), UINT64_C( 7797458465147257456), UINT64_C(12230705289573100967),
+        UINT64_C(14416140158172918988), UINT64_C( 5963149509754191120), UINT64_C( 9508178381454162014), UINT64_C( 8004067115796296130) },
+      { UINT64_C(12897614038610425629), UINT64_C( 2970408504008994308), UINT64_C( 8150007545456613819), UINT64_C(14710991345340417558),
+        UINT64_C( 3061601284944666151), UINT64_C( 8890469328840932717), UINT64_C(14790714769229877795), UINT64_C( 3903966733572317106) },
+      { UINT64_C( 9635337312690200786), UINT64_C(10558837730052955925), UINT64_C( 7357059547749650459), UINT64_C(11605028131914183270),
+        UINT64_C(14913057725012539556), UINT64_C( 4900040893065829788), UINT64_C(16804452172677700749), UINT64_C(15185665164259039783) } },
+    { { UINT64_C(11140633538347347531), UINT64_C( 1906205678130867257), UINT64_C( 7262669794899166790), UINT64_C( 5229791857537863502),
+        UINT64_C( 5181765266710303266), UINT64_C( 3751697428026276608), UINT64_C( 8741763042790997050), UINT64_C( 3210900552214255179) },
+      { UINT64_C(11263894764383848700), UINT64_C( 9170071308255596831), UINT64_C(13422340353276212128), UINT64_C( 9297841434814127058),
+        UINT64_C(  437655000492770265), UINT64_C(16803305459704636781), UINT64_C( 3022752452927855817), UINT64_C( 6781028527107339029) },
+      { UINT64_C(17257202795184170640), UINT64_C(12663791091080860044), UINT64_C( 9362941211526525550), UINT64_C(10569726234040464589),
+        UINT64_C(17747990597451023324), UINT64_C( 3363777433710620184), UINT64_C( 4389006804985812731), UINT64_C( 1543394615976920023) },
+      { UINT64_C(11142669350351905803), UINT64_C( 1908043902950545453), UINT64_C( 7267164661633873158), UINT64_C( 5232377297332584056),
+        UINT64_C( 5182657288884775838), UINT64_C( 3753298947076166456), UINT64_C( 8741903140845026125), UINT64_C( 3211889228175932398) } },
+    { { UINT64_C( 1522710342616184257), UINT64_C( 8114575537740246190), UINT64_C( 5261823338880733273), UINT64_C(10453856188308296644),
+        UINT64_C(17660546285804750339), UINT64_C( 5093290722533321417), UINT64_C(  814047927873800080), UINT64_C(    2565149739806631) },
+      { UINT64_C( 7845015068659008930), UINT64_C(15309241752924930881), UINT64_C( 4554304259605628129), UINT64_C(18127199991062019474),
+        UINT64_C(16831575408886780293), UINT64_C( 8871685109285666823), UINT64_C(12387950230289773842), UINT64_C(16675082714620862740) },
+      { UINT64_C( 1868329817713102428), UINT64_C(12031791453784180452), UINT64_C( 9888845353133907319), UINT64_C(11395900645253216221),
+        UINT64_C(13751899631856530861), UINT64_C( 3877659469529562261), UINT64_C( 4310228918046433747), UINT64_C(15301437301477525369) },
+      { UINT64_C( 1524059973331179513), UINT64_C( 8116428066526550162), UINT64_C( 5264063777497043440), UINT64_C(10454118968753756366),
+        UINT64_C(17663102880043394532), UINT64_C( 5095457195033498332), UINT64_C(  815915513714956134), UINT64_C(    4962181103164955) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi64(test_vec[i].c);
+    simde__m512i r = simde_mm512_madd52lo_epu64(a, b, c);
+    simde_test_x86_assert_equal_u64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m512i a = simde_test_x86_random_u64x8();
+    simde__m512i b = simde_test_x86_random_u64x8();
+    simde__m512i c = simde_test_x86_random_u64x8();
+    simde__m512i r = simde_mm512_madd52lo_epu64(a, b, c);
+
+    simde_test_x86_write_u64x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_u64x8(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x8(2, c, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_mask_madd52lo_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint64_t a[8];
+    const simde__mmask8 k;
+    const uint64_t b[8];
+    const uint64_t c[8];
+    const uint64_t r[8];
+  } test_vec[] = {
+    { { UINT64_C( 2336924599558929365), UINT64_C(13086363073106258856), UINT64_C(15984346433926816315), UINT64_C(14092310712392633749),
+        UINT64_C( 4221808616068490732), UINT64_C( 3756632081164198027), UINT64_C( 9430433084551798686), UINT64_C( 6097540094279776238) },
+      UINT8_C(245),
+      { UINT64_C( 4719139511450651409), UINT64_C( 3115487142201780833), UINT64_C(10793890389272575548), UINT64_C( 6241516592740345561),
+        UINT64_C( 5098291268145325341), UINT64_C(12098111621069863854), UINT64_C( 8147662192209362270), UINT64_C( 9264389740027384054) },
+      { UINT64_C( 5407344986947573982), UINT64_C( 7912238566359887547), UINT64_C(10949090315178955497), UINT64_C(11956603768924146955),
+        UINT64_C( 7432193570798955836), UINT64_C(18437274076453874274), UINT64_C(14908729799617857453), UINT64_C( 6407542670783985792) },
+      { UINT64_C( 2337058617439448211), UINT64_C(13086363073106258856), UINT64_C(15987041413692473047), UINT64_C(14092310712392633749),
+        UINT64_C( 4225523584537178552), UINT64_C( 3758202259094750503), UINT64_C( 9431265564537416228), UINT64_C( 6100881017090917102) } },
+    { { UINT64_C( 3182731891030709783), UINT64_C(13949190749206460800), UINT64_C(  564345813599196483), UINT64_C( 5990415582339404206),
+        UINT64_C( 2920376174223250321), UINT64_C(16415712588689450491), UINT64_C( 9509278964295262312), UINT64_C( 1323336465531094735) },
+      UINT8_C(194),
+      { UINT64_C( 1851705076061269364), UINT64_C( 8218679623169000018), UINT64_C( 4257251802061799047), UINT64_C(17315160226621300249),
+        UINT64_C(11189574019574117947), UINT64_C( 2891679991580394268), UINT64_C( 5584042649438742861), UINT64_C( 4903330417305074335) },
+      { UINT64_C( 3007487614765020119), UINT64_C(11063929541060263361), UINT64_C( 1793656926062245730), UINT64_C(12889653820978870932),
+        UINT64_C(15360245695664772851), UINT64_C( 6733095829822243467), UINT64_C( 4128349112962862266), UINT64_C(12690783923690962577) },
+      { UINT64_C( 3182731891030709783), UINT64_C(13950175533081117522), UINT64_C(  564345813599196483), UINT64_C( 5990415582339404206),
+        UINT64_C( 2920376174223250321), UINT64_C(16415712588689450491), UINT64_C( 9509377635747249754), UINT64_C( 1326264530663685342) } },
+    { { UINT64_C(  862399192754155790), UINT64_C(12408916650775162845), UINT64_C(10483862063697242271), UINT64_C( 1879439259056624807),
+        UINT64_C( 9122098913702888973), UINT64_C( 7782655345089215075), UINT64_C(12701610042784342195), UINT64_C( 7902173986590835587) },
+      UINT8_C(239),
+      { UINT64_C(  900172996211178215), UINT64_C(13088382826734867556), UINT64_C(16044758235109807863), UINT64_C(14671790684696885891),
+        UINT64_C(11476127580485463205), UINT64_C( 6612465558209109305), UINT64_C( 8359293272564335240), UINT64_C(10382693709696221286) },
+      { UINT64_C(11151769614156299497), UINT64_C( 1002171333152952872), UINT64_C(18182214318700980975), UINT64_C( 1941152806518289780),
+        UINT64_C(16957463007305054041), UINT64_C( 6550027624871624276), UINT64_C(13716714639675037641), UINT64_C( 6291545164429042180) },
+      { UINT64_C(  863214619466051917), UINT64_C(12413054587494164349), UINT64_C(10486291042739593016), UINT64_C( 1883905630339643139),
+        UINT64_C( 9122098913702888973), UINT64_C( 7785260524820340503), UINT64_C(12704564919911880059), UINT64_C( 7902964701364605211) } },
+    { { UINT64_C(16533672531758059461), UINT64_C( 1381096876979186277), UINT64_C(17997737562649879995), UINT64_C(13170355930437509744),
+        UINT64_C(11855076480952227855), UINT64_C(11887708514051966107), UINT64_C(12390368199402220548), UINT64_C(12823965451442332241) },
+      UINT8_C(185),
+      { UINT64_C( 1982320336615002421), UINT64_C(14750880188233639697), UINT64_C(14128269913819164241), UINT64_C( 9179770124463657676),
+        UINT64_C(  890561517150690921), UINT64_C( 6376096545510350671), UINT64_C(  109820551783547680), UINT64_C( 7945778028782480507) },
+      { UINT64_C(16319086353053559665), UINT64_C(14467549544051783273), UINT64_C( 9568196513235656594), UINT64_C(18189914147645913085),
+        UINT64_C(10497857921279925817), UINT64_C(16395574692586471704), UINT64_C( 2320607404639327143), UINT64_C( 5004503093663137260) },
+      { UINT64_C(16535455997061418794), UINT64_C( 1381096876979186277), UINT64_C(17997737562649879995), UINT64_C(13173562331188726284),
+        UINT64_C(11855570289363200880), UINT64_C(11889937962435625731), UINT64_C(12390368199402220548), UINT64_C(12824861386922930869) } },
+    { { UINT64_C(15449811547090771119), UINT64_C(15579674257651034370), UINT64_C( 4717164734410449202), UINT64_C(15675671483784927290),
+        UINT64_C( 7033806087890443528), UINT64_C( 9623042674025313410), UINT64_C(  748249342931506379), UINT64_C( 5758938742036372200) },
+      UINT8_C(121),
+      { UINT64_C(16660567315499718299), UINT64_C( 9917699842266294765), UINT64_C( 4599129754188759706), UINT64_C( 7713211304068375988),
+        UINT64_C(  613991600823001834), UINT64_C( 1819033685016428608), UINT64_C(12729380346567890755), UINT64_C(17003140288669035708) },
+      { UINT64_C(12560274852080588588), UINT64_C(17539446523100868303), UINT64_C(18438865262026124344), UINT64_C(11176670314300646446),
+        UINT64_C( 9418771415221642394), UINT64_C(17438845653417531745), UINT64_C(10369268078371823269), UINT64_C(10248462071716803119) },
+      { UINT64_C(15451660537308490835), UINT64_C(15579674257651034370), UINT64_C( 4717164734410449202), UINT64_C(15677537048213925522),
+        UINT64_C( 7036649187505931724), UINT64_C( 9624714304150457538), UINT64_C(  750631017832525050), UINT64_C( 5758938742036372200) } },
+    { { UINT64_C(12732885949501283454), UINT64_C( 7138984680191198565), UINT64_C( 8219687535451519010), UINT64_C( 2893362282653339812),
+        UINT64_C( 8026836250501168486), UINT64_C(  915253172737353106), UINT64_C(15316356610743336665), UINT64_C( 5639514883011485297) },
+      UINT8_C( 81),
+      { UINT64_C(10177514383322317725), UINT64_C( 4599445438867148122), UINT64_C( 2171936235561480466), UINT64_C( 2348438653472489649),
+        UINT64_C( 1678726372162007639), UINT64_C( 6347515016250573717), UINT64_C( 8968127878580111064), UINT64_C( 2743915723146492784) },
+      { UINT64_C( 8944204827825921867), UINT64_C(17407654016800994037), UINT64_C( 4626813995864137967), UINT64_C(11110458685505402682),
+        UINT64_C( 4434571493038560550), UINT64_C( 3819067078568697333), UINT64_C( 4809039595992664493), UINT64_C( 6847014290718454043) },
+      { UINT64_C(12733708664785268349), UINT64_C( 7138984680191198565), UINT64_C( 8219687535451519010), UINT64_C( 2893362282653339812),
+        UINT64_C( 8030726532750498128), UINT64_C(  915253172737353106), UINT64_C(15317429587812398801), UINT64_C( 5639514883011485297) } },
+    { { UINT64_C( 6923710945204938897), UINT64_C( 5282283228696121043), UINT64_C( 8936131641030950329), UINT64_C( 6561159487898931061),
+        UINT64_C( 4854679672978700691), UINT64_C(17923670376733069016), UINT64_C( 9134915266780169448), UINT64_C( 3112613616762530828) },
+      UINT8_C(179),
+      { UINT64_C( 6307122540395571558), UINT64_C( 4420157386867997635), UINT64_C( 1301757334259147079), UINT64_C( 9141978593397237489),
+        UINT64_C( 3161163444714865150), UINT64_C( 5235418080227259313), UINT64_C(11820643575015468690), UINT64_C( 9933161262899770690) },
+      { UINT64_C( 7944893713544644526), UINT64_C( 6893462695452400481), UINT64_C(10792141286444430957), UINT64_C(17306428756133450777),
+        UINT64_C(10159073107537968337), UINT64_C(13929239283290264610), UINT64_C( 2483636280909473423), UINT64_C(  103004656581895995) },
+      { UINT64_C( 6925340148076156389), UINT64_C( 5282356937460794550), UINT64_C( 8936131641030950329), UINT64_C( 6561159487898931061),
+        UINT64_C( 4854911734708675057), UINT64_C(17923889681485643866), UINT64_C( 9134915266780169448), UINT64_C( 3115279224425218114) } },
+    { { UINT64_C(16061397282864460847), UINT64_C(18191194952838272095), UINT64_C( 4029971785790150081), UINT64_C(15343237977039221692),
+        UINT64_C( 7579297628625469077), UINT64_C(15587398215175830759), UINT64_C( 4690656817085296613), UINT64_C( 9492495026524965954) },
+      UINT8_C(155),
+      { UINT64_C(18439158560146642154), UINT64_C(13447729296224696873), UINT64_C( 7305825515196088465), UINT64_C(17467166108272511919),
+        UINT64_C( 4877069752791469227), UINT64_C( 4924012963301213455), UINT64_C(14202884370429482012), UINT64_C(17297474344017030675) },
+      { UINT64_C(16240348395638619141), UINT64_C( 1516536570247405075), UINT64_C( 5422585982111871077), UINT64_C(14954328777149501779),
+        UINT64_C( 9881547901718374510), UINT64_C(15329226667257208493), UINT64_C(13784831728508962762), UINT64_C(10663361893463733089) },
+      { UINT64_C(16064666156236272833), UINT64_C(18193417021946540906), UINT64_C( 4029971785790150081), UINT64_C(15344026576048823417),
+        UINT64_C( 7583173061940652047), UINT64_C(15587398215175830759), UINT64_C( 4690656817085296613), UINT64_C( 9492687902140123765) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi64(test_vec[i].c);
+    simde__m512i r = simde_mm512_mask_madd52lo_epu64(a, test_vec[i].k, b, c);
+    simde_test_x86_assert_equal_u64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m512i a = simde_test_x86_random_u64x8();
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m512i b = simde_test_x86_random_u64x8();
+    simde__m512i c = simde_test_x86_random_u64x8();
+    simde__m512i r = simde_mm512_mask_madd52lo_epu64(a, k, b, c);
+
+    simde_test_x86_write_u64x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x8(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x8(2, c, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_maskz_madd52lo_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const uint64_t a[8];
+    const uint64_t b[8];
+    const uint64_t c[8];
+    const uint64_t r[8];
+  } test_vec[] = {
+    { UINT8_C(  7),
+      { UINT64_C(10729270816836277481), UINT64_C(15022837693510028630), UINT64_C( 9086007625597615399), UINT64_C( 2826349881917129554),
+        UINT64_C( 1410829261331216138), UINT64_C(10875136946649470930), UINT64_C( 8576371173448493500), UINT64_C(16793046561816422567) },
+      { UINT64_C( 9469520466649181081), UINT64_C( 3034173175985286678), UINT64_C( 8237285804619163573), UINT64_C( 8442107299095902559),
+        UINT64_C(11962466129001845455), UINT64_C(16500421780975625061), UINT64_C(14261789948972478126), UINT64_C( 8527895369470919431) },
+      { UINT64_C(14012098517661001021), UINT64_C(10713943558493413532), UINT64_C( 9397880456412556608), UINT64_C(15517926138036252221),
+        UINT64_C(16574119959884812516), UINT64_C( 7653129977498605754), UINT64_C( 8848582871025206222), UINT64_C(15374086199918408426) },
+      { UINT64_C(10730233762855818590), UINT64_C(15025082029452518078), UINT64_C( 9088617389450623847), UINT64_C(                   0),
+        UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0) } },
+    { UINT8_C( 10),
+      { UINT64_C(12814212194259703297), UINT64_C(17085608783618209260), UINT64_C( 7258858337107338838), UINT64_C(11297045038666956804),
+        UINT64_C( 4759333208740797249), UINT64_C( 9555139971100239618), UINT64_C( 7901867264542426131), UINT64_C( 7605157178360200786) },
+      { UINT64_C(15034933990895403278), UINT64_C(17827805772281296823), UINT64_C( 2572371024137732059), UINT64_C(15957831068691783139),
+        UINT64_C(13869653130649614812), UINT64_C(16787746010035516959), UINT64_C(18357197766338033357), UINT64_C( 5217559172962964155) },
+      { UINT64_C(12790623794267073207), UINT64_C(  169076530573747811), UINT64_C( 2233049171875693796), UINT64_C( 4389059677001418292),
+        UINT64_C(12393763548574899388), UINT64_C( 5034025347584865188), UINT64_C( 1475282780505275896), UINT64_C(17368587391835906887) },
+      { UINT64_C(                   0), UINT64_C(17089957555781118897), UINT64_C(                   0), UINT64_C(11297171404699509792),
+        UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0) } },
+    { UINT8_C(122),
+      { UINT64_C(17377260377003474694), UINT64_C( 6626369410734097034), UINT64_C(17105602439647219931), UINT64_C( 4547530861991571459),
+        UINT64_C(15601009306856841042), UINT64_C( 4982893697278792685), UINT64_C(12957635337645023515), UINT64_C( 6443649442499654900) },
+      { UINT64_C(  610072941411512145), UINT64_C( 3741640369944939581), UINT64_C(  486084272530672987), UINT64_C(15366458421263209439),
+        UINT64_C(15200752192143502032), UINT64_C( 2126374958815364920), UINT64_C( 7335491359587474355), UINT64_C( 8093968675768107257) },
+      { UINT64_C(16941785004719720631), UINT64_C(12751588292898297622), UINT64_C(18321841777024573016), UINT64_C(15299801185880150082),
+        UINT64_C( 1456701162574098072), UINT64_C( 9836673231143858900), UINT64_C( 8936454726802143233), UINT64_C(16802280747722244411) },
+      { UINT64_C(                   0), UINT64_C( 6628235903382293192), UINT64_C(                   0), UINT64_C( 4549935873566752641),
+        UINT64_C(15604790617741634258), UINT64_C( 4986926149382028877), UINT64_C(12959073397239801038), UINT64_C(                   0) } },
+    { UINT8_C( 96),
+      { UINT64_C(15951593111866389581), UINT64_C(12268251452745265246), UINT64_C(14835244529868883963), UINT64_C(12956864264494004671),
+        UINT64_C(18267899297552805435), UINT64_C( 2461919949648466381), UINT64_C( 3377886015066214343), UINT64_C( 4682739781059215074) },
+      { UINT64_C(11905948236619659933), UINT64_C(13782791636790900989), UINT64_C(11095940084452691550), UINT64_C(12174882409055165360),
+        UINT64_C( 5086288331124628761), UINT64_C( 7588477456561650584), UINT64_C( 9443823926916882878), UINT64_C(16898120226396762575) },
+      { UINT64_C( 2349314985980291083), UINT64_C( 8403436208003286316), UINT64_C(15670829104371455522), UINT64_C(16907698136082002410),
+        UINT64_C( 2037555506871959453), UINT64_C( 1803677320927770590), UINT64_C(15252716575846822345), UINT64_C( 3603779738491838265) },
+      { UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0),
+        UINT64_C(                   0), UINT64_C( 2464073323069630365), UINT64_C( 3381465305572666357), UINT64_C(                   0) } },
+    { UINT8_C(178),
+      { UINT64_C(10734821868308682562), UINT64_C( 9641544432420162578), UINT64_C(12355135522936365236), UINT64_C(15327001403277217744),
+        UINT64_C( 2953209163602155465), UINT64_C(16253203176561084277), UINT64_C( 1050064661017197722), UINT64_C( 1047866762203353635) },
+      { UINT64_C(15517839033114130716), UINT64_C( 1947365389849626616), UINT64_C(15832287635386279018), UINT64_C(12302175631710472295),
+        UINT64_C(10938460230133821332), UINT64_C( 9681546345763876286), UINT64_C( 6520058815292857831), UINT64_C(13612059673510677679) },
+      { UINT64_C(13413550362383795439), UINT64_C(10218480247926088237), UINT64_C(10664428142613888690), UINT64_C(13013354283239736757),
+        UINT64_C(17884753768323631996), UINT64_C( 3782197416623680843), UINT64_C(  614416254267664910), UINT64_C(10040349925379954653) },
+      { UINT64_C(                   0), UINT64_C( 9641666505602851498), UINT64_C(                   0), UINT64_C(                   0),
+        UINT64_C( 2956864481489764217), UINT64_C(16256615468284761119), UINT64_C(                   0), UINT64_C( 1049157897125510710) } },
+    { UINT8_C(200),
+      { UINT64_C( 7227304570388677785), UINT64_C( 7344274482223529421), UINT64_C(13594889968630161396), UINT64_C( 4389135670007516324),
+        UINT64_C(15417662143767346267), UINT64_C(16926391031093714119), UINT64_C(  261034363586059901), UINT64_C( 2129092951570410413) },
+      { UINT64_C( 1974728744282081930), UINT64_C( 3918839454069693057), UINT64_C( 2847322225702934817), UINT64_C( 4612254147666290467),
+        UINT64_C(15509616833359688142), UINT64_C( 9098029210438457940), UINT64_C( 3993427418650926026), UINT64_C(13122961449223578409) },
+      { UINT64_C( 9223114936486064593), UINT64_C(14541224892785446640), UINT64_C( 8463803343549876777), UINT64_C( 9437982074789401180),
+        UINT64_C(15712401499846529891), UINT64_C(10430323985067055351), UINT64_C(11565035228117191870), UINT64_C(12108173087894459348) },
+      { UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C( 4393082864188674872),
+        UINT64_C(                   0), UINT64_C(                   0), UINT64_C(  262046959213655657), UINT64_C( 2133531118872515745) } },
+    { UINT8_C(178),
+      { UINT64_C(15803825173579970226), UINT64_C(15227182745093556383), UINT64_C(12589453062891396255), UINT64_C(17811344299048254621),
+        UINT64_C(16280694356171803601), UINT64_C(11802180923589669614), UINT64_C( 3939308931146703137), UINT64_C(  915885741646716792) },
+      { UINT64_C(11227210735268399276), UINT64_C( 3092383085733430082), UINT64_C( 2597401245549817659), UINT64_C( 5384218962770902385),
+        UINT64_C( 3163505961838631070), UINT64_C(  972035152994793546), UINT64_C(16761251531262698699), UINT64_C(12795654612012268714) },
+      { UINT64_C( 2178024589445942308), UINT64_C(15149526436189154141), UINT64_C(13254344443681120146), UINT64_C(17664687636939310177),
+        UINT64_C( 7300681377345839967), UINT64_C( 4810077158885409510), UINT64_C( 5743844272428943858), UINT64_C(12215424966971340479) },
+      { UINT64_C(                   0), UINT64_C(15227976239141014937), UINT64_C(                   0), UINT64_C(                   0),
+        UINT64_C(16281802149468686451), UINT64_C(11805563091100785002), UINT64_C(                   0), UINT64_C(  916914231895031374) } },
+    { UINT8_C( 11),
+      { UINT64_C(17269467483582225543), UINT64_C( 6977449490267477774), UINT64_C( 4550497686956987179), UINT64_C(14002871272108242528),
+        UINT64_C(17233358093505882125), UINT64_C(15383634047935826118), UINT64_C(14573755497791081592), UINT64_C(  510428457592932375) },
+      { UINT64_C(10349390457687153359), UINT64_C(10282327176936976692), UINT64_C( 7433700599764348662), UINT64_C( 8329916192013237399),
+        UINT64_C( 8845848423877106537), UINT64_C(10293270072547372597), UINT64_C(14893148018951743736), UINT64_C(11559606887362095188) },
+      { UINT64_C( 9841935645341290452), UINT64_C(17305834697595809027), UINT64_C( 9447117358674483220), UINT64_C( 5127039709171382863),
+        UINT64_C(10399645578398136694), UINT64_C(16702539106653841123), UINT64_C( 4116656104936702830), UINT64_C(18050680757784976582) },
+      { UINT64_C(17272603240000893171), UINT64_C( 6979121113142791850), UINT64_C(                   0), UINT64_C(14004741298278326009),
+        UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi64(test_vec[i].c);
+    simde__m512i r = simde_mm512_maskz_madd52lo_epu64(test_vec[i].k, a, b, c);
+    simde_test_x86_assert_equal_u64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m512i a = simde_test_x86_random_u64x8();
+    simde__m512i b = simde_test_x86_random_u64x8();
+    simde__m512i c = simde_test_x86_random_u64x8();
+    simde__m512i r = simde_mm512_maskz_madd52lo_epu64(k, a, b, c);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_u64x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x8(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x8(2, c, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_madd52hi_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint64_t a[2];
+    const uint64_t b[2];
+    const uint64_t c[2];
+    const uint64_t r[2];
+  } test_vec[] = {
+    { { UINT64_C(13618065967048614623), UINT64_C(17147000929121675580) },
+      { UINT64_C( 4289868264916068453), UINT64_C( 1064807947562207304) },
+      { UINT64_C(15955261310929439447), UINT64_C(14560105044317569954) },
+      { UINT64_C(13619969527945620592), UINT64_C(17148945209507870696) } },
+    { { UINT64_C(10357049092220754442), UINT64_C(18241585258910396650) },
+      { UINT64_C(13702229475594183595), UINT64_C(   93433158822794268) },
+      { UINT64_C(17248851469004727434), UINT64_C( 9767798365697391467) },
+      { UINT64_C(10357081938154651485), UINT64_C(18244566375085415132) } },
+    { { UINT64_C( 8119422045438229459), UINT64_C(  578497589120437775) },
+      { UINT64_C( 3356652609738475424), UINT64_C(11553788915408150004) },
+      { UINT64_C( 3768454221025716872), UINT64_C( 1824311313237163467) },
+      { UINT64_C( 8120547169363763896), UINT64_C(  578658943777087056) } },
+    { { UINT64_C( 6465573005878569929), UINT64_C( 5791490340727388913) },
+      { UINT64_C(17799484860653170603), UINT64_C( 5280912017819975606) },
+      { UINT64_C( 5654991007496079548), UINT64_C(14925329545464488714) },
+      { UINT64_C( 6466404341218803462), UINT64_C( 5791729777246756697) } },
+    { { UINT64_C( 9042846278687346267), UINT64_C(  913658224067854051) },
+      { UINT64_C( 2065647076400530175), UINT64_C( 9169064011225806667) },
+      { UINT64_C( 7323562738054520413), UINT64_C( 5089197624427892547) },
+      { UINT64_C( 9043318818397807103), UINT64_C(  913780622359189370) } },
+    { { UINT64_C(13846119644963982840), UINT64_C( 9414051701921355011) },
+      { UINT64_C( 8373679560451402829), UINT64_C( 7792819950146092696) },
+      { UINT64_C( 1633292722762139509), UINT64_C(10762726012018809524) },
+      { UINT64_C(13847107337473252675), UINT64_C( 9415334131323393223) } },
+    { { UINT64_C(16443656318879073166), UINT64_C( 6447158928450206616) },
+      { UINT64_C( 4888919696717639855), UINT64_C( 9630518955212608968) },
+      { UINT64_C( 4444058486221048700), UINT64_C(  643945857959948467) },
+      { UINT64_C(16445615333638886916), UINT64_C( 6448953995786771910) } },
+    { { UINT64_C(16826753470979257265), UINT64_C(10823450741448483256) },
+      { UINT64_C(11712748753828870314), UINT64_C( 5249834423179400570) },
+      { UINT64_C(   28443577625978203), UINT64_C(12204442723648757678) },
+      { UINT64_C(16827823752035791886), UINT64_C(10826373820813734596) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i c = simde_x_mm_loadu_epi64(test_vec[i].c);
+    simde__m128i r = simde_mm_madd52hi_epu64(a, b, c);
+    simde_test_x86_assert_equal_u64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m128i a = simde_test_x86_random_u64x2();
+    simde__m128i b = simde_test_x86_random_u64x2();
+    simde__m128i c = simde_test_x86_random_u64x2();
+    simde__m128i r = simde_mm_madd52hi_epu64(a, b, c);
+
+    simde_test_x86_write_u64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_u64x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x2(2, c, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_mask_madd52hi_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint64_t a[2];
+    const simde__mmask8 k;
+    const uint64_t b[2];
+    const uint64_t c[2];
+    const uint64_t r[2];
+  } test_vec[] = {
+    { { UINT64_C( 4750600268670352475), UINT64_C(12266379661723051610) },
+      UINT8_C(148),
+      { UINT64_C(16969244042847922115), UINT64_C( 6975112257368376973) },
+      { UINT64_C( 3128707633287403403), UINT64_C( 6484942216886901883) },
+      { UINT64_C( 4750600268670352475), UINT64_C(12266379661723051610) } },
+    { { UINT64_C( 5099103619750943819), UINT64_C(14767728966470446573) },
+      UINT8_C(154),
+      { UINT64_C(11888316950295534616), UINT64_C( 4662233198224893251) },
+      { UINT64_C(18181665355405626301), UINT64_C(17083290099006694647) },
+      { UINT64_C( 5099103619750943819), UINT64_C(14767983281506019891) } },
+    { { UINT64_C(13894001207962088421), UINT64_C( 6733685869660081101) },
+      UINT8_C(103),
+      { UINT64_C(17916641019470201452), UINT64_C(16635939905445175279) },
+      { UINT64_C(16671802300794342184), UINT64_C( 8038331607813689419) },
+      { UINT64_C(13895169268882193823), UINT64_C( 6737285704445389295) } },
+    { { UINT64_C(16551785221433607078), UINT64_C( 7348111233249083871) },
+      UINT8_C(199),
+      { UINT64_C(16414083883133564252), UINT64_C(14022895868527964433) },
+      { UINT64_C( 9948905714652567153), UINT64_C( 8862568521201493115) },
+      { UINT64_C(16552084394257089288), UINT64_C( 7350936263269404528) } },
+    { { UINT64_C( 4420498729484263713), UINT64_C(  357418877060333237) },
+      UINT8_C( 36),
+      { UINT64_C( 7694038525945918893), UINT64_C(11441961087487508094) },
+      { UINT64_C(15380926975716245499), UINT64_C( 5417105348520093754) },
+      { UINT64_C( 4420498729484263713), UINT64_C(  357418877060333237) } },
+    { { UINT64_C(10399475725833231265), UINT64_C(15633407025889335898) },
+      UINT8_C( 67),
+      { UINT64_C(12970840871214421951), UINT64_C(10530995065916033559) },
+      { UINT64_C( 4244982808321527090), UINT64_C(17633824779340759151) },
+      { UINT64_C(10399748495324856973), UINT64_C(15634189735383787282) } },
+    { { UINT64_C( 6433036107565994630), UINT64_C( 7390408315624003526) },
+      UINT8_C( 14),
+      { UINT64_C( 2295332637615519029), UINT64_C(10895132212271075006) },
+      { UINT64_C(11711102907085079812), UINT64_C( 5268715770461193230) },
+      { UINT64_C( 6433036107565994630), UINT64_C( 7391231229144087561) } },
+    { { UINT64_C(17523942879850105906), UINT64_C(15310219823043086043) },
+      UINT8_C(152),
+      { UINT64_C(11498328783105266769), UINT64_C( 5587837665752097308) },
+      { UINT64_C( 6059721727770992047), UINT64_C(14087250232314427668) },
+      { UINT64_C(17523942879850105906), UINT64_C(15310219823043086043) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i c = simde_x_mm_loadu_epi64(test_vec[i].c);
+    simde__m128i r = simde_mm_mask_madd52hi_epu64(a, test_vec[i].k, b, c);
+    simde_test_x86_assert_equal_u64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m128i a = simde_test_x86_random_u64x2();
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128i b = simde_test_x86_random_u64x2();
+    simde__m128i c = simde_test_x86_random_u64x2();
+    simde__m128i r = simde_mm_mask_madd52hi_epu64(a, k, b, c);
+
+    simde_test_x86_write_u64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x2(2, c, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_maskz_madd52hi_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const uint64_t a[2];
+    const uint64_t b[2];
+    const uint64_t c[2];
+    const uint64_t r[2];
+  } test_vec[] = {
+    { UINT8_C(140),
+      { UINT64_C( 8900316663168583458), UINT64_C(  406599850742504953) },
+      { UINT64_C(17551416129616077066), UINT64_C( 2075642633096886859) },
+      { UINT64_C(13025545622747641200), UINT64_C(10543857499946745829) },
+      { UINT64_C(                   0), UINT64_C(                   0) } },
+    { UINT8_C( 47),
+      { UINT64_C( 2204826079802757159), UINT64_C( 2313500741204499586) },
+      { UINT64_C( 2929468587353269433), UINT64_C( 8049975738229650745) },
+      { UINT64_C( 9229098284667035730), UINT64_C( 1873012976402508851) },
+      { UINT64_C( 2205404019632187447), UINT64_C( 2315324150428485380) } },
+    { UINT8_C(171),
+      { UINT64_C( 8621011748768766937), UINT64_C(13997240289287154348) },
+      { UINT64_C( 8536642681894287085), UINT64_C( 3269033151109224043) },
+      { UINT64_C(15691730967915344331), UINT64_C(11531476411961803876) },
+      { UINT64_C( 8621625067286905975), UINT64_C(13999210333644854615) } },
+    { UINT8_C( 62),
+      { UINT64_C(12858620656824739015), UINT64_C(12939462411383350486) },
+      { UINT64_C( 2912063847707762891), UINT64_C( 9207745466381086593) },
+      { UINT64_C( 2841762915538063712), UINT64_C( 8381340372523971868) },
+      { UINT64_C(                   0), UINT64_C(12939537417262860748) } },
+    { UINT8_C( 96),
+      { UINT64_C(10550858483946060081), UINT64_C( 1145262025359422985) },
+      { UINT64_C( 9611673434213818703), UINT64_C( 9391592170352214132) },
+      { UINT64_C(10489685660245252637), UINT64_C(17626238630564846799) },
+      { UINT64_C(                   0), UINT64_C(                   0) } },
+    { UINT8_C(155),
+      { UINT64_C(11526735228633299964), UINT64_C(11250117492736060511) },
+      { UINT64_C(10342716323454525663), UINT64_C(12564807333159638474) },
+      { UINT64_C(11142511562478062180), UINT64_C(16425117142310818323) },
+      { UINT64_C(11527065156652619631), UINT64_C(11250581193905758037) } },
+    { UINT8_C(221),
+      { UINT64_C( 4148975395297860373), UINT64_C(14114731724804675923) },
+      { UINT64_C( 1730675862170166473), UINT64_C( 6904580401107065142) },
+      { UINT64_C(15273886121405800858), UINT64_C( 4941066149007778327) },
+      { UINT64_C( 4149601512529626973), UINT64_C(                   0) } },
+    { UINT8_C( 21),
+      { UINT64_C(10619403508750431632), UINT64_C( 9540943034588222159) },
+      { UINT64_C(18391812597960943207), UINT64_C( 3345822260009765672) },
+      { UINT64_C(10070812636101413364), UINT64_C( 4949950621132890121) },
+      { UINT64_C(10620016714127667048), UINT64_C(                   0) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i c = simde_x_mm_loadu_epi64(test_vec[i].c);
+    simde__m128i r = simde_mm_maskz_madd52hi_epu64(test_vec[i].k, a, b, c);
+    simde_test_x86_assert_equal_u64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m128i a = simde_test_x86_random_u64x2();
+    simde__m128i b = simde_test_x86_random_u64x2();
+    simde__m128i c = simde_test_x86_random_u64x2();
+    simde__m128i r = simde_mm_maskz_madd52hi_epu64(k, a, b, c);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_u64x2(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x2(2, c, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_madd52hi_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint64_t a[4];
+    const uint64_t b[4];
+    const uint64_t c[4];
+    const uint64_t r[4];
+  } test_vec[] = {
+    { { UINT64_C(13044013920848295400), UINT64_C( 3710258275079323569), UINT64_C(10721983893866665349), UINT64_C(14980506074694624707) },
+      { UINT64_C(11919579008835276583), UINT64_C( 8920068411102624089), UINT64_C( 1398237185252797511), UINT64_C(13935432036206782638) },
+      { UINT64_C( 7747001780171848168), UINT64_C( 3515848861052794714), UINT64_C(13716954083728984057), UINT64_C(10587321335733817489) },
+      { UINT64_C(13044563558070171830), UINT64_C( 3712244348610710737), UINT64_C(10723629281436068288), UINT64_C(14981616464103138948) } },
+    { { UINT64_C(11416608854841975793), UINT64_C( 4143795718549566056), UINT64_C( 9155500203313366079), UINT64_C(  876679217963229934) },
+      { UINT64_C(17572623027786521083), UINT64_C(14153624525023268082), UINT64_C(13526035691834961482), UINT64_C(17557984604018925955) },
+      { UINT64_C( 3139872304405920278), UINT64_C(16727998073013131485), UINT64_C(16014473009211324855), UINT64_C( 2603966851918369079) },
+      { UINT64_C(11417391181628983484), UINT64_C( 4144994648946734613), UINT64_C( 9157100789111588032), UINT64_C(  877260391891029912) } },
+    { { UINT64_C( 4919435367809373920), UINT64_C( 2501410306939789872), UINT64_C(16374213774185780740), UINT64_C(13738571368085239926) },
+      { UINT64_C(17813458116425576075), UINT64_C(12343659211128167615), UINT64_C( 5683902102507221842), UINT64_C(13014130967962645502) },
+      { UINT64_C( 5811857457653707753), UINT64_C( 4182657579320306873), UINT64_C( 6476767095231616444), UINT64_C( 1867536100008309773) },
+      { UINT64_C( 4920281689600847322), UINT64_C( 2504206420718437088), UINT64_C(16374260920605145524), UINT64_C(13740756979374786908) } },
+    { { UINT64_C( 2893123436279337285), UINT64_C( 2666294161409941981), UINT64_C( 6872100857982826665), UINT64_C(12437111924181013584) },
+      { UINT64_C(12729609973110301457), UINT64_C( 8059322128949195081), UINT64_C( 9034170468251505070), UINT64_C( 9617883907642750054) },
+      { UINT64_C(17040967484070820857), UINT64_C( 1735141952566784991), UINT64_C(13957350524007778312), UINT64_C( 4568065393738821484) },
+      { UINT64_C( 2895207173723390914), UINT64_C( 2666958633805299710), UINT64_C( 6872788358302060170), UINT64_C(12437960060816501712) } },
+    { { UINT64_C(17839190337932519938), UINT64_C(12609710237564022653), UINT64_C(18110264445457602361), UINT64_C(16989902065551336004) },
+      { UINT64_C(15833285605859579052), UINT64_C( 4658340530038593361), UINT64_C( 7016933801164310743), UINT64_C( 3161724300565298443) },
+      { UINT64_C(16411304590037708935), UINT64_C( 1822127445841183233), UINT64_C( 5802290282506427655), UINT64_C(12306126812387569438) },
+      { UINT64_C(17839320805069675419), UINT64_C(12610670937827108958), UINT64_C(18110384016464502678), UINT64_C(16990002535954426226) } },
+    { { UINT64_C( 7064547343689824149), UINT64_C( 7650968580098024658), UINT64_C(12278522926467034320), UINT64_C( 7372128503829343107) },
+      { UINT64_C(  110786994141781958), UINT64_C( 8667813721614447740), UINT64_C( 8009076808853936622), UINT64_C( 4816147337138498720) },
+      { UINT64_C( 8679549172449961027), UINT64_C(13260747718199380199), UINT64_C( 3015257297706521980), UINT64_C(10773578227878915524) },
+      { UINT64_C( 7065214573387044748), UINT64_C( 7652347584134205264), UINT64_C(12279397504112147026), UINT64_C( 7372515219238688050) } },
+    { { UINT64_C(14432202686378536404), UINT64_C(13872879351774028035), UINT64_C(15467051144859728371), UINT64_C( 9643501684358791406) },
+      { UINT64_C( 6498586885551938694), UINT64_C(15511997887552194112), UINT64_C( 6724148500853124712), UINT64_C( 9687085572247283257) },
+      { UINT64_C(11816913686561145933), UINT64_C( 4493867671815137186), UINT64_C(16475865814255841754), UINT64_C(  141086808511234927) },
+      { UINT64_C(14436079851471621471), UINT64_C(13874222513442261989), UINT64_C(15467154571503332540), UINT64_C( 9644925402666691296) } },
+    { { UINT64_C(11675480876281881345), UINT64_C( 8565713019247013834), UINT64_C( 1136427322149148471), UINT64_C(15158680734534636457) },
+      { UINT64_C( 8212382804641973078), UINT64_C(15960458725338194029), UINT64_C( 5564061705232662152), UINT64_C( 9203677760280245528) },
+      { UINT64_C(11250780423855665419), UINT64_C(12425751486911493357), UINT64_C(14794900597980278881), UINT64_C( 1110260474550025408) },
+      { UINT64_C(11675887214843732746), UINT64_C( 8566011927293840714), UINT64_C( 1136697891217323773), UINT64_C(15160169819682357719) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i c = simde_x_mm256_loadu_epi64(test_vec[i].c);
+    simde__m256i r = simde_mm256_madd52hi_epu64(a, b, c);
+    simde_test_x86_assert_equal_u64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m256i a = simde_test_x86_random_u64x4();
+    simde__m256i b = simde_test_x86_random_u64x4();
+    simde__m256i c = simde_test_x86_random_u64x4();
+    simde__m256i r = simde_mm256_madd52hi_epu64(a, b, c);
+
+    simde_test_x86_write_u64x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_u64x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x4(2, c, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_mask_madd52hi_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint64_t a[4];
+    const simde__mmask8 k;
+    const uint64_t b[4];
+    const uint64_t c[4];
+    const uint64_t r[4];
+  } test_vec[] = {
+    { { UINT64_C(17810860260861164897), UINT64_C( 6118419314900717591), UINT64_C( 9849279789361904685), UINT64_C( 3943703935443887527) },
+      UINT8_C( 22),
+      { UINT64_C(14012133244873524859), UINT64_C( 6182890989073903779), UINT64_C(14247037778198900836), UINT64_C(10954953445611299351) },
+      { UINT64_C(16378020915511175062), UINT64_C( 8001015323715371035), UINT64_C(16296052924310496770), UINT64_C( 2832160060041576856) },
+      { UINT64_C(17810860260861164897), UINT64_C( 6120720686233373367), UINT64_C( 9850249623144022100), UINT64_C( 3943703935443887527) } },
+    { { UINT64_C(14493984027606729473), UINT64_C(18119255604915447802), UINT64_C(13860536112539103916), UINT64_C(  719944854367710533) },
+      UINT8_C(  5),
+      { UINT64_C( 1558100810761718444), UINT64_C(  805309909201495290), UINT64_C( 3256089336083621222), UINT64_C(12551317766012142952) },
+      { UINT64_C( 6344432089249931911), UINT64_C( 9924532954201659800), UINT64_C( 5320901674384289451), UINT64_C(15085548339123653801) },
+      { UINT64_C(14497239792314264993), UINT64_C(18119255604915447802), UINT64_C(13862680326488874163), UINT64_C(  719944854367710533) } },
+    { { UINT64_C( 4124120377029209732), UINT64_C(14238030278293066987), UINT64_C( 6394908814804519828), UINT64_C( 6444191288857408083) },
+      UINT8_C( 11),
+      { UINT64_C(10156152037879659572), UINT64_C(11676264377403047888), UINT64_C( 8176189732876812252), UINT64_C(13192626064318665900) },
+      { UINT64_C( 8782211315666895580), UINT64_C(15052712157062858669), UINT64_C(10099441872498079353), UINT64_C(16914019427221401216) },
+      { UINT64_C( 4124143185279815849), UINT64_C(14239126251117642072), UINT64_C( 6394908814804519828), UINT64_C( 6445246609315945427) } },
+    { { UINT64_C(15172660289263794030), UINT64_C(17468050604404605094), UINT64_C( 5448742893804740401), UINT64_C( 5492430971461317441) },
+      UINT8_C(127),
+      { UINT64_C( 8375418724880245623), UINT64_C(11509195415508342156), UINT64_C(11069202910388341130), UINT64_C(11280606830058335236) },
+      { UINT64_C( 3715590257080676392), UINT64_C(16655000117937077571), UINT64_C( 4989110159231192124), UINT64_C(11569992053774529742) },
+      { UINT64_C(15172746678773408635), UINT64_C(17468432657806677187), UINT64_C( 5451849065436631805), UINT64_C( 5492626143420223172) } },
+    { { UINT64_C( 8279951682716877326), UINT64_C( 5840912621354984138), UINT64_C(  155989041340437411), UINT64_C( 7637126790778354915) },
+      UINT8_C( 72),
+      { UINT64_C(12236256028466290361), UINT64_C( 6456489538389735391), UINT64_C( 2744540083595869955), UINT64_C( 2834147823899996806) },
+      { UINT64_C(10788932236916673288), UINT64_C( 9967071290773501939), UINT64_C(17759613560414855334), UINT64_C(16922934077169006404) },
+      { UINT64_C( 8279951682716877326), UINT64_C( 5840912621354984138), UINT64_C(  155989041340437411), UINT64_C( 7638020926448452748) } },
+    { { UINT64_C(17828820758725986081), UINT64_C(14139969254173308970), UINT64_C( 1047522090507630371), UINT64_C(  238300322169195394) },
+      UINT8_C(163),
+      { UINT64_C( 4477879056714947143), UINT64_C(  573963833662297488), UINT64_C(11476262655209081397), UINT64_C( 4386933700869334945) },
+      { UINT64_C(13250252179982682206), UINT64_C(10756709580597313071), UINT64_C(11151080868831107084), UINT64_C( 2554025620830372159) },
+      { UINT64_C(17829012023321382412), UINT64_C(14140911047988743182), UINT64_C( 1047522090507630371), UINT64_C(  238300322169195394) } },
+    { { UINT64_C( 3540015134926153537), UINT64_C( 4169409859649907687), UINT64_C(  676413827299553744), UINT64_C( 3766047172164729435) },
+      UINT8_C( 86),
+      { UINT64_C( 7465431875387431946), UINT64_C(17258865511170892283), UINT64_C(16905882634213215272), UINT64_C(  722283484887760128) },
+      { UINT64_C(16415998772476993197), UINT64_C( 6693785235933783609), UINT64_C( 6989651909856370278), UINT64_C(11169516340963827192) },
+      { UINT64_C( 3540015134926153537), UINT64_C( 4169751635279149895), UINT64_C(  676469977118334292), UINT64_C( 3766047172164729435) } },
+    { { UINT64_C( 5711082293549186933), UINT64_C( 6398818965845891133), UINT64_C(11424628014704389066), UINT64_C( 3086541019460050251) },
+      UINT8_C( 87),
+      { UINT64_C(11668472358526355674), UINT64_C(10950762168455487235), UINT64_C( 5554305792791618394), UINT64_C(18257641418346614385) },
+      { UINT64_C(10241077300098485940), UINT64_C(17996865276858905341), UINT64_C( 5464791431946370776), UINT64_C(13278218106353080356) },
+      { UINT64_C( 5715131880337988081), UINT64_C( 6399087292488198478), UINT64_C(11425212538325316724), UINT64_C( 3086541019460050251) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i c = simde_x_mm256_loadu_epi64(test_vec[i].c);
+    simde__m256i r = simde_mm256_mask_madd52hi_epu64(a, test_vec[i].k, b, c);
+    simde_test_x86_assert_equal_u64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m256i a = simde_test_x86_random_u64x4();
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256i b = simde_test_x86_random_u64x4();
+    simde__m256i c = simde_test_x86_random_u64x4();
+    simde__m256i r = simde_mm256_mask_madd52hi_epu64(a, k, b, c);
+
+    simde_test_x86_write_u64x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x4(2, c, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_maskz_madd52hi_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const uint64_t a[4];
+    const uint64_t b[4];
+    const uint64_t c[4];
+    const uint64_t r[4];
+  } test_vec[] = {
+    { UINT8_C(131),
+      { UINT64_C(  544544491983222260), UINT64_C( 8639767177930848345), UINT64_C( 2115457370586967904), UINT64_C(15865013705602343922) },
+      { UINT64_C( 3416821265035245838), UINT64_C( 1055007443701796788), UINT64_C( 9652517557705766546), UINT64_C(18232919771864372548) },
+      { UINT64_C( 2708574814324422033), UINT64_C( 9914384267907093465), UINT64_C(13836559423383854061), UINT64_C( 1897973163739591018) },
+      { UINT64_C(  545857129964531295), UINT64_C( 8640274636527857586), UINT64_C(                   0), UINT64_C(                   0) } },
+    { UINT8_C(106),
+      { UINT64_C(16886529478260130230), UINT64_C( 5924319795907453267), UINT64_C(17188427490986538954), UINT64_C(17211228597540872828) },
+      { UINT64_C(  726144653936473618), UINT64_C( 2842488646426555305), UINT64_C( 5615654281937305924), UINT64_C(  637709008517293490) },
+      { UINT64_C(13262894258931713870), UINT64_C( 3872053280604972088), UINT64_C( 9487436046639891084), UINT64_C( 5658850999271319689) },
+      { UINT64_C(                   0), UINT64_C( 5924871056149003299), UINT64_C(                   0), UINT64_C(17212626156446166900) } },
+    { UINT8_C(142),
+      { UINT64_C(14354755845468607418), UINT64_C( 9873840399191690031), UINT64_C( 8561587044522615842), UINT64_C(10530195313211625548) },
+      { UINT64_C( 4990488761462800407), UINT64_C(  622841340077537683), UINT64_C( 3075712105510338346), UINT64_C(  133665336279770479) },
+      { UINT64_C(14266203170622106527), UINT64_C(12368156168867068853), UINT64_C( 9334433785311392643), UINT64_C(14385519925869955256) },
+      { UINT64_C(                   0), UINT64_C( 9874220044826615501), UINT64_C( 8564399588375447170), UINT64_C(10530890419341784508) } },
+    { UINT8_C( 13),
+      { UINT64_C( 3715757184190020895), UINT64_C(14117764280630914277), UINT64_C( 2273568871897451843), UINT64_C(17496219380001222431) },
+      { UINT64_C(18029983073257197451), UINT64_C(10240992362249841547), UINT64_C( 7680028570951087261), UINT64_C( 8423414560780442400) },
+      { UINT64_C(11247931457906651913), UINT64_C( 7526385566770297754), UINT64_C(16771530113297536523), UINT64_C(17341605034657049676) },
+      { UINT64_C( 3716882194997519012), UINT64_C(                   0), UINT64_C( 2273607516819243872), UINT64_C(17497245895603354787) } },
+    { UINT8_C(116),
+      { UINT64_C(11630865062746721824), UINT64_C(10897820224064409114), UINT64_C( 4570950569205666738), UINT64_C( 7950848190925153314) },
+      { UINT64_C( 1867770085867642148), UINT64_C(16162440697894033652), UINT64_C( 1561750655839021849), UINT64_C(  924171307614523928) },
+      { UINT64_C(12269286110036103213), UINT64_C( 3434465400402710426), UINT64_C( 4062044692439412055), UINT64_C(15280838497802278683) },
+      { UINT64_C(                   0), UINT64_C(                   0), UINT64_C( 4574298402446480833), UINT64_C(                   0) } },
+    { UINT8_C(130),
+      { UINT64_C(15295318647794827366), UINT64_C( 7009318134941879106), UINT64_C( 5050992522009153717), UINT64_C(10542014325406440536) },
+      { UINT64_C(12312135937285653699), UINT64_C(10781581087652497289), UINT64_C( 3793345749103812974), UINT64_C( 1694842563506115271) },
+      { UINT64_C(14474847646006689999), UINT64_C(14283629489014864324), UINT64_C( 4456249668663495623), UINT64_C(17277415796954420825) },
+      { UINT64_C(                   0), UINT64_C( 7012011248992370245), UINT64_C(                   0), UINT64_C(                   0) } },
+    { UINT8_C(118),
+      { UINT64_C( 9198176757477615333), UINT64_C( 5759995635081628291), UINT64_C( 4675021644283351744), UINT64_C( 4206450381881904947) },
+      { UINT64_C( 1584356202842494326), UINT64_C( 3521864870100062990), UINT64_C(15882395612238882495), UINT64_C(10428408307391056425) },
+      { UINT64_C(12097241005733762619), UINT64_C(  899621841037500379), UINT64_C(17889880803659560127), UINT64_C( 7787620070359173993) },
+      { UINT64_C(                   0), UINT64_C( 5760033414779825457), UINT64_C( 4675971904520918662), UINT64_C(                   0) } },
+    { UINT8_C(  5),
+      { UINT64_C( 4180261961589537055), UINT64_C(18399618780285587327), UINT64_C( 1283743624614298056), UINT64_C( 9687716028376830780) },
+      { UINT64_C(15437408609984450791), UINT64_C( 2291145110553871104), UINT64_C(11214059140094007689), UINT64_C( 8617490071664714410) },
+      { UINT64_C(17849935720038876553), UINT64_C( 8642000791797900921), UINT64_C( 8512268168042280230), UINT64_C( 3138761142550603912) },
+      { UINT64_C( 4181983728383717704), UINT64_C(                   0), UINT64_C( 1283753540976710506), UINT64_C(                   0) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i c = simde_x_mm256_loadu_epi64(test_vec[i].c);
+    simde__m256i r = simde_mm256_maskz_madd52hi_epu64(test_vec[i].k, a, b, c);
+    simde_test_x86_assert_equal_u64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m256i a = simde_test_x86_random_u64x4();
+    simde__m256i b = simde_test_x86_random_u64x4();
+    simde__m256i c = simde_test_x86_random_u64x4();
+    simde__m256i r = simde_mm256_maskz_madd52hi_epu64(k, a, b, c);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_u64x4(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x4(2, c, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_madd52hi_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint64_t a[8];
+    const uint64_t b[8];
+    const uint64_t c[8];
+    const uint64_t r[8];
+  } test_vec[] = {
+    { { UINT64_C( 3986181268009846883), UINT64_C(14361967812153840617), UINT64_C( 9560138138522572138), UINT64_C(13142396869246006422),
+        UINT64_C( 1885426261167205941), UINT64_C(10366512445302845556), UINT64_C( 3320967774855309974), UINT64_C( 1562408088821478310) },
+      { UINT64_C(10701452250049986104), UINT64_C( 5410941591548949602), UINT64_C(17687873583371378096), UINT64_C(16112925810178776487),
+        UINT64_C( 4039390037832934490), UINT64_C(17167678069465462591), UINT64_C(13256818361955196085), UINT64_C(15929753609709741707) },
+      { UINT64_C( 7245277107240524158), UINT64_C(15729270459765116188), UINT64_C(13365512915023462580), UINT64_C( 1233420681860659645),
+        UINT64_C(17717146474990892119), UINT64_C( 9529222981877774399), UINT64_C(12682353099827387417), UINT64_C( 4693610535624699006) },
+      { UINT64_C( 3986878131665887715), UINT64_C(14363238123548885382), UINT64_C( 9561794223030669248), UINT64_C(13145500967905804791),
+        UINT64_C( 1889577661619486868), UINT64_C(10370582327568346068), UINT64_C( 3321098786170515446), UINT64_C( 1562507685102847023) } },
+    { { UINT64_C(13353344944475768961), UINT64_C( 5920082013303185620), UINT64_C(12978135210193940855), UINT64_C(11146945748682476422),
+        UINT64_C(15971247562455084401), UINT64_C(10768293755380417253), UINT64_C( 2883741520358279451), UINT64_C( 2655515964503280422) },
+      { UINT64_C(17987013062490640311), UINT64_C(16513441758543552375), UINT64_C( 7807900651164674960), UINT64_C(17644969464743916295),
+        UINT64_C( 1973230452843278165), UINT64_C(10385542634275961202), UINT64_C(11148974871034353415), UINT64_C( 4630320452614776081) },
+      { UINT64_C(13538395841322677794), UINT64_C( 8508451363749270404), UINT64_C(  404053979023267694), UINT64_C( 4976078619292200930),
+        UINT64_C( 5156884098199631756), UINT64_C(  821590950996117121), UINT64_C( 9777780595995978167), UINT64_C( 2810074208704726423) },
+      { UINT64_C(13353873822035375622), UINT64_C( 5920911964007179607), UINT64_C(12980405902410488631), UINT64_C(11150928363929418534),
+        UINT64_C(15971285674850229894), UINT64_C(10768397730454261389), UINT64_C( 2884006899028310610), UINT64_C( 2656112325657668105) } },
+    { { UINT64_C( 8801594952052837146), UINT64_C( 9924755802850783506), UINT64_C(  443294980429432825), UINT64_C(17990965573902695403),
+        UINT64_C( 4989983111914105035), UINT64_C( 8306802078944438764), UINT64_C( 5686983526391643255), UINT64_C( 4002715372650540212) },
+      { UINT64_C( 5377643607018398248), UINT64_C(13749858300982761188), UINT64_C(15095099605561697483), UINT64_C(18005656089213030461),
+        UINT64_C(18085319305961266259), UINT64_C( 2274645826315224205), UINT64_C(  359383927544952334), UINT64_C(11881215249420804377) },
+      { UINT64_C(13509480767408125802), UINT64_C(  920740926942270549), UINT64_C(17735513832332661846), UINT64_C(14450576067227864980),
+        UINT64_C( 9719829235715662074), UINT64_C(16691455749132284313), UINT64_C(11735859520143153674), UINT64_C( 8870985712674586357) },
+      { UINT64_C( 8801839438492272044), UINT64_C( 9924920051764554969), UINT64_C(  443560847684018134), UINT64_C(17991143625534333099),
+        UINT64_C( 4990776473850881549), UINT64_C( 8306883327294576747), UINT64_C( 5690166580816666365), UINT64_C( 4003258197263181543) } },
+    { { UINT64_C(14098947624004707826), UINT64_C(15596244573093550327), UINT64_C(10414468155240904151), UINT64_C( 1466203299159215965),
+        UINT64_C( 8814636846575778917), UINT64_C( 9466412122297839289), UINT64_C( 2023505738418626792), UINT64_C( 6715804894004771070) },
+      { UINT64_C(  382033341625232209), UINT64_C(12402328178487218415), UINT64_C( 8279661708343018763), UINT64_C( 9768805903344263740),
+        UINT64_C(12646574773306621744), UINT64_C(  317899571026529785), UINT64_C( 1861032132979169772), UINT64_C( 6581693284686325144) },
+      { UINT64_C( 5966523320640254302), UINT64_C( 7666386045080901223), UINT64_C( 9298137633287516946), UINT64_C(10703550216051644164),
+        UINT64_C( 2523000664652669527), UINT64_C(11420538814595273365), UINT64_C(16899361665929070619), UINT64_C(15256124590806128366) },
+      { UINT64_C(14102060425113269548), UINT64_C(15597340396333721060), UINT64_C(10415698164975420358), UINT64_C( 1466534964889941255),
+        UINT64_C( 8814738977145533594), UINT64_C( 9468712961279130625), UINT64_C( 2023936567455657703), UINT64_C( 6716849682267111302) } },
+    { { UINT64_C( 9215920551032482310), UINT64_C( 7764785544425531545), UINT64_C(15431854500996927575), UINT64_C(17013108339682001355),
+        UINT64_C(13656765802516225566), UINT64_C( 9130947258217535740), UINT64_C(16767996650260801525), UINT64_C( 9292978141057232421) },
+      { UINT64_C( 3947983661529802216), UINT64_C( 5029459000454982694), UINT64_C(10549073463629482081), UINT64_C(14368335350539851140),
+        UINT64_C( 2497701175954239033), UINT64_C(14330240045908241225), UINT64_C( 6684654492946006725), UINT64_C( 3379012490657751358) },
+      { UINT64_C(11508467629201406103), UINT64_C( 2999987118940956278), UINT64_C(14866135598080189978), UINT64_C(15250261717006652032),
+        UINT64_C(  395222271522129288), UINT64_C(16775772060564698435), UINT64_C(14539354944208317033), UINT64_C(  777682937796539068) },
+      { UINT64_C( 9217033312447995248), UINT64_C( 7765236266122297405), UINT64_C(15433407602717389280), UINT64_C(17013549870095138034),
+        UINT64_C(13658814915470440148), UINT64_C( 9135106825698137732), UINT64_C(16768502444833143043), UINT64_C( 9293871219469233935) } },
+    { { UINT64_C(10429321122027090215), UINT64_C( 9930443916739845401), UINT64_C(10467571515636427569), UINT64_C(10053814909202367226),
+        UINT64_C(16961399323743120772), UINT64_C(15007298665239976347), UINT64_C(  554944465669440845), UINT64_C( 1369386273470626833) },
+      { UINT64_C(15867103158366126967), UINT64_C(17748646173232006879), UINT64_C( 4302850973385661089), UINT64_C(13450759240472934664),
+        UINT64_C(12976056715740090102), UINT64_C( 2943809926112455484), UINT64_C(14376207713691955997), UINT64_C(15835510494562497478) },
+      { UINT64_C( 3972218832127509910), UINT64_C(17618634617728553938), UINT64_C(12281243498635286761), UINT64_C( 7832171887759445488),
+        UINT64_C(13650401585209525308), UINT64_C( 7716241216942607179), UINT64_C(18266462709070647536), UINT64_C(16542430243320968016) },
+      { UINT64_C(10429330118694593917), UINT64_C( 9930991886801721044), UINT64_C(10469453964978691052), UINT64_C(10054090430817205450),
+        UINT64_C(16962583172743623788), UINT64_C(15008333652978371259), UINT64_C(  555640275701180914), UINT64_C( 1369520714940198310) } },
+    { { UINT64_C(12461614518031444296), UINT64_C(10377388245289600791), UINT64_C(16879180904116066099), UINT64_C(15971913367565635864),
+        UINT64_C( 7428970505263170572), UINT64_C(18246619529926927880), UINT64_C(11213537027305676314), UINT64_C( 6701642467036213134) },
+      { UINT64_C( 1981552027931120072), UINT64_C(11209737105985208010), UINT64_C(15689114258297048731), UINT64_C(16378744241255094173),
+        UINT64_C(14140312144767030799), UINT64_C(10886863845319966968), UINT64_C(17355307615838954934), UINT64_C(16394557111266105223) },
+      { UINT64_C(17509786419227623489), UINT64_C(17714207913178584641), UINT64_C( 9379540050908711911), UINT64_C( 8385888544755026088),
+        UINT64_C(16723746294873417001), UINT64_C(16949573193333899780), UINT64_C(12035113538036248199), UINT64_C(18230435860726425944) },
+      { UINT64_C(12465878853207006011), UINT64_C(10377483833835123594), UINT64_C(16881261606570661367), UINT64_C(15972064392618195606),
+        UINT64_C( 7430437635031132816), UINT64_C(18247553250598818967), UINT64_C(11214512617273156172), UINT64_C( 6703053196368163048) } },
+    { { UINT64_C( 6951084321035824873), UINT64_C( 2353372258659179960), UINT64_C( 8480743316472909322), UINT64_C( 4801117963245639121),
+        UINT64_C(12639996625244242093), UINT64_C(17554772865611206118), UINT64_C(13435836279585260258), UINT64_C( 2530459447308744322) },
+      { UINT64_C( 2190321964104347583), UINT64_C(14447615660737352100), UINT64_C(12403825051081145471), UINT64_C( 4633260090823574195),
+        UINT64_C(12964556075737446548), UINT64_C( 5105605084520155436), UINT64_C(10598046205075235388), UINT64_C(15354469054123121492) },
+      { UINT64_C(10683255646790421632), UINT64_C( 9161025616683106837), UINT64_C(17912496471947989282), UINT64_C(15684317152256283027),
+        UINT64_C(17072209228844321520), UINT64_C( 3958639966699426606), UINT64_C( 7014301226602386875), UINT64_C(17893045447484056606) },
+      { UINT64_C( 6951334795099491594), UINT64_C( 2353382896769494824), UINT64_C( 8481083556570814775), UINT64_C( 4803317861612031874),
+        UINT64_C(12642527984093038883), UINT64_C(17557783371710130967), UINT64_C(13436361230349286248), UINT64_C( 2530551487193802101) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi64(test_vec[i].c);
+    simde__m512i r = simde_mm512_madd52hi_epu64(a, b, c);
+    simde_test_x86_assert_equal_u64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m512i a = simde_test_x86_random_u64x8();
+    simde__m512i b = simde_test_x86_random_u64x8();
+    simde__m512i c = simde_test_x86_random_u64x8();
+    simde__m512i r = simde_mm512_madd52hi_epu64(a, b, c);
+
+    simde_test_x86_write_u64x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_u64x8(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x8(2, c, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_mask_madd52hi_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint64_t a[8];
+    const simde__mmask8 k;
+    const uint64_t b[8];
+    const uint64_t c[8];
+    const uint64_t r[8];
+  } test_vec[] = {
+    { { UINT64_C(10658960826851965224), UINT64_C( 6492488205865301199), UINT64_C( 4392716210093511112), UINT64_C( 3617801213886802741),
+        UINT64_C(10499330821623743933), UINT64_C( 8343918502116374738), UINT64_C(14571677614000932318), UINT64_C(12350626021882981163) },
+      UINT8_C(193),
+      { UINT64_C( 4289419721717304728), UINT64_C( 5328702582336977032), UINT64_C( 1336910651026501475), UINT64_C(13884223993004737200),
+        UINT64_C(14787566378524488057), UINT64_C(15709634635411627510), UINT64_C( 4322833915346543044), UINT64_C( 2555184392274771596) },
+      { UINT64_C(16076538854850423560), UINT64_C(10936601179120598388), UINT64_C( 6504183904952583037), UINT64_C( 5281741878378589054),
+        UINT64_C( 3907069224540400496), UINT64_C(16869049811790320047), UINT64_C(11246109621270781418), UINT64_C( 1525331203455197600) },
+      { UINT64_C(10660373215441535752), UINT64_C( 6492488205865301199), UINT64_C( 4392716210093511112), UINT64_C( 3617801213886802741),
+        UINT64_C(10499330821623743933), UINT64_C( 8343918502116374738), UINT64_C(14572213187431802518), UINT64_C(12351762541360802959) } },
+    { { UINT64_C( 2626907500857705084), UINT64_C( 7480409153025250679), UINT64_C(10887225563183825245), UINT64_C( 7497831391841344338),
+        UINT64_C(11096898218874010727), UINT64_C(14165031833510520495), UINT64_C( 4007454785081946895), UINT64_C( 2559801316376254258) },
+      UINT8_C(185),
+      { UINT64_C(12030651718856081196), UINT64_C( 7588795952824918772), UINT64_C(  835847590117266961), UINT64_C( 7614437146787035061),
+        UINT64_C(17334255996443265002), UINT64_C( 9216197098518781127), UINT64_C( 8131390671319086553), UINT64_C( 8349126742734249783) },
+      { UINT64_C(18051249962697461397), UINT64_C( 1186238046815106185), UINT64_C( 1494832084137368722), UINT64_C(14218258953863242068),
+        UINT64_C( 2531825196660666101), UINT64_C( 9932003947073673614), UINT64_C(13537140327946105581), UINT64_C(14099338658261264054) },
+      { UINT64_C( 2627188279919888670), UINT64_C( 7480409153025250679), UINT64_C(10887225563183825245), UINT64_C( 7498125491656772564),
+        UINT64_C(11097682795992239413), UINT64_C(14165669263418830527), UINT64_C( 4007454785081946895), UINT64_C( 2562500064981979276) } },
+    { { UINT64_C( 7589989081617793431), UINT64_C(17088912087262851240), UINT64_C( 5392942442657349557), UINT64_C(17333469145004535803),
+        UINT64_C( 3395846643325761756), UINT64_C(  492852040902266600), UINT64_C( 2077840725548109302), UINT64_C(13524998936303306088) },
+      UINT8_C(234),
+      { UINT64_C(16155714313492984532), UINT64_C( 9249047778249743726), UINT64_C(13815845989348664665), UINT64_C(  216271936091552931),
+        UINT64_C( 9241531649807577549), UINT64_C(  149815784701784481), UINT64_C( 1702378749017044262), UINT64_C( 7403403876225531788) },
+      { UINT64_C( 3616397723584302494), UINT64_C( 8945233348339832439), UINT64_C( 1448748990766872720), UINT64_C( 1242023125895300924),
+        UINT64_C( 9178320682528866971), UINT64_C(10438150967716226312), UINT64_C( 8203216792216352827), UINT64_C(14950405074609154037) },
+      { UINT64_C( 7589989081617793431), UINT64_C(17089672486978678324), UINT64_C( 5392942442657349557), UINT64_C(17333546934700796959),
+        UINT64_C( 3395846643325761756), UINT64_C(  493731962701819425), UINT64_C( 2077849409260397573), UINT64_C(13527619316845220895) } },
+    { { UINT64_C( 3822530434927704964), UINT64_C(12254417110764399744), UINT64_C( 5137837872575784103), UINT64_C(11164187176289145835),
+        UINT64_C(14395812587082607461), UINT64_C( 8284469144762932447), UINT64_C(10778692434646689276), UINT64_C(15267102055315358766) },
+      UINT8_C(144),
+      { UINT64_C( 9878818600206624006), UINT64_C(14067493019126621925), UINT64_C( 6980017695184684820), UINT64_C(  570726804999774902),
+        UINT64_C( 4953493806075920647), UINT64_C(17140624148444287678), UINT64_C(  341564718963313729), UINT64_C( 3793801295914044573) },
+      { UINT64_C(18351648684903098123), UINT64_C( 3026694828531003193), UINT64_C(13085003214204935494), UINT64_C( 5491008627258226385),
+        UINT64_C(18167351310594514146), UINT64_C( 8838330986842241684), UINT64_C( 5078271980055900332), UINT64_C(12333239288421731995) },
+      { UINT64_C( 3822530434927704964), UINT64_C(12254417110764399744), UINT64_C( 5137837872575784103), UINT64_C(11164187176289145835),
+        UINT64_C(14399698355886277682), UINT64_C( 8284469144762932447), UINT64_C(10778692434646689276), UINT64_C(15268039036211200779) } },
+    { { UINT64_C(15624091308389096979), UINT64_C(11372995271573561894), UINT64_C( 2515782138664706350), UINT64_C(13338578688388509352),
+        UINT64_C(18095571970959599876), UINT64_C(11804543152379229764), UINT64_C(13164918974859064074), UINT64_C(15833606080189477214) },
+      UINT8_C( 45),
+      { UINT64_C(13399331783481369420), UINT64_C( 3352597850657531986), UINT64_C( 8909795487926458135), UINT64_C(12793932029843646747),
+        UINT64_C(16090890386186211153), UINT64_C( 7252450497764490363), UINT64_C(17239024922885153272), UINT64_C(  941776498724933626) },
+      { UINT64_C( 4672749342172541291), UINT64_C(  872954047352943468), UINT64_C( 1513503160663984445), UINT64_C(10908992821897023642),
+        UINT64_C( 7132972793776310008), UINT64_C( 5529074607540908955), UINT64_C( 3328827064821057794), UINT64_C( 2842589607051438254) },
+      { UINT64_C(15624718759803698434), UINT64_C(11372995271573561894), UINT64_C( 2515891395410782394), UINT64_C(13339628365027641276),
+        UINT64_C(18095571970959599876), UINT64_C(11805703685091469428), UINT64_C(13164918974859064074), UINT64_C(15833606080189477214) } },
+    { { UINT64_C(  380239067782316782), UINT64_C(11308661374306247061), UINT64_C( 6537796935409552888), UINT64_C( 1579258408550612627),
+        UINT64_C( 4978800513051709097), UINT64_C( 3735974739352079522), UINT64_C( 1165721455577501990), UINT64_C(12895138383647630007) },
+      UINT8_C(139),
+      { UINT64_C(12236421875017434606), UINT64_C( 8460038169157700713), UINT64_C(14557325492562836438), UINT64_C(14347489682396538324),
+        UINT64_C( 4670451440973862730), UINT64_C(11613915699759723730), UINT64_C(17678869481946881573), UINT64_C(17977141213111134939) },
+      { UINT64_C(  653286068474376697), UINT64_C(11678094952478315172), UINT64_C(15141532917864267787), UINT64_C( 4781136468599351217),
+        UINT64_C( 1203624846224948083), UINT64_C( 7913546242343269556), UINT64_C( 4204878301952017040), UINT64_C( 6335710233483796833) },
+      { UINT64_C(  380247377323103005), UINT64_C(11308793456744424036), UINT64_C( 6537796935409552888), UINT64_C( 1581463419617424810),
+        UINT64_C( 4978800513051709097), UINT64_C( 3735974739352079522), UINT64_C( 1165721455577501990), UINT64_C(12897792117859764648) } },
+    { { UINT64_C(15342837183279136369), UINT64_C(10158106439198207018), UINT64_C(12437937540937585113), UINT64_C(11495792290020341839),
+        UINT64_C( 7652856292515220288), UINT64_C(16815576864687274452), UINT64_C( 3276623672991510656), UINT64_C( 5903349472097783327) },
+      UINT8_C(116),
+      { UINT64_C( 2279982387560821352), UINT64_C( 4720925591093605397), UINT64_C(10838560971574693731), UINT64_C(  868060738984851629),
+        UINT64_C(17703791832906645674), UINT64_C( 6631126008776483060), UINT64_C( 2245626548015539660), UINT64_C( 8393233926448402889) },
+      { UINT64_C(14723874493391263617), UINT64_C(11018786338841382549), UINT64_C( 7804270458855788988), UINT64_C( 5072272289452131367),
+        UINT64_C(12992880662270142891), UINT64_C( 3723962831868190795), UINT64_C( 6326626397882342077), UINT64_C(12016075472611354293) },
+      { UINT64_C(15342837183279136369), UINT64_C(10158106439198207018), UINT64_C(12440536618432382306), UINT64_C(11495792290020341839),
+        UINT64_C( 7652997856110406208), UINT64_C(16817195639661389563), UINT64_C( 3278871716387088350), UINT64_C( 5903349472097783327) } },
+    { { UINT64_C(12747852596327835670), UINT64_C( 1585959043091278936), UINT64_C(14688281374104118607), UINT64_C(16323306525466959848),
+        UINT64_C( 9332865982463979888), UINT64_C( 1196642216627424300), UINT64_C( 4294578428831601080), UINT64_C( 6356169965860413575) },
+      UINT8_C( 87),
+      { UINT64_C(18408747920976326220), UINT64_C(12276480092116418131), UINT64_C(11912364911520197729), UINT64_C( 2761804824722646102),
+        UINT64_C( 3082693980978402324), UINT64_C(13415992772697032683), UINT64_C(13530454186289999194), UINT64_C( 5510447955615109753) },
+      { UINT64_C(14258638152659168735), UINT64_C( 4068292935442673762), UINT64_C( 5100359344509745319), UINT64_C( 7706805249081180015),
+        UINT64_C( 5088788182063909119), UINT64_C(  777001105711294897), UINT64_C(12502519494634578030), UINT64_C( 3193977022272838238) },
+      { UINT64_C(12747988730173964583), UINT64_C( 1587387637283734954), UINT64_C(14688455824734069231), UINT64_C(16323306525466959848),
+        UINT64_C( 9334959358423841761), UINT64_C( 1196642216627424300), UINT64_C( 4294770417672430336), UINT64_C( 6356169965860413575) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi64(test_vec[i].c);
+    simde__m512i r = simde_mm512_mask_madd52hi_epu64(a, test_vec[i].k, b, c);
+    simde_test_x86_assert_equal_u64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m512i a = simde_test_x86_random_u64x8();
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m512i b = simde_test_x86_random_u64x8();
+    simde__m512i c = simde_test_x86_random_u64x8();
+    simde__m512i r = simde_mm512_mask_madd52hi_epu64(a, k, b, c);
+
+    simde_test_x86_write_u64x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x8(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x8(2, c, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_maskz_madd52hi_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const uint64_t a[8];
+    const uint64_t b[8];
+    const uint64_t c[8];
+    const uint64_t r[8];
+  } test_vec[] = {
+    { UINT8_C( 82),
+      { UINT64_C(10243010353050224243), UINT64_C(11484738146943547004), UINT64_C( 4058175505254095891), UINT64_C(   34501082124466910),
+        UINT64_C(12090928234623250328), UINT64_C(14803045804978912593), UINT64_C(12965319982526253975), UINT64_C( 9068092295384617803) },
+      { UINT64_C( 4167948311945956612), UINT64_C(  273443512371474755), UINT64_C(16666317662040198082), UINT64_C( 9105600575625438714),
+        UINT64_C(16215075900472826085), UINT64_C( 5360878429910536438), UINT64_C(13886897579626667573), UINT64_C(17530539789510539088) },
+      { UINT64_C( 8184668331438110229), UINT64_C( 6028412378831615192), UINT64_C(  422736610478819927), UINT64_C(10400245828388093267),
+        UINT64_C(13185370784371250702), UINT64_C( 6898880247061925708), UINT64_C( 1154146077083754825), UINT64_C(18077950197034570966) },
+      { UINT64_C(                   0), UINT64_C(11486598643145143311), UINT64_C(                   0), UINT64_C(                   0),
+        UINT64_C(12092495939230595178), UINT64_C(                   0), UINT64_C(12965945355406552474), UINT64_C(                   0) } },
+    { UINT8_C(221),
+      { UINT64_C( 5713222401122862116), UINT64_C( 6021231824428577926), UINT64_C( 7377777527861841459), UINT64_C(13346221324596589715),
+        UINT64_C(16834455833683620561), UINT64_C(16246945310896551860), UINT64_C( 4415164442001377612), UINT64_C(13174100814066063236) },
+      { UINT64_C( 4399076242985814464), UINT64_C( 4985163701337406367), UINT64_C(17387106699208596580), UINT64_C( 8114322905464758784),
+        UINT64_C(16874601097528058471), UINT64_C(15067468120941105627), UINT64_C(12132463919279062530), UINT64_C(12551013500132878861) },
+      { UINT64_C( 4467515176528102090), UINT64_C(11428778630811104862), UINT64_C(12951064613974014827), UINT64_C( 4236937752856316118),
+        UINT64_C(10809006586384575330), UINT64_C(12448226726715135109), UINT64_C( 1211884160470207863), UINT64_C( 4930873016452006594) },
+      { UINT64_C( 5716741377472525655), UINT64_C(                   0), UINT64_C( 7380071076207858066), UINT64_C(13348857131986009494),
+        UINT64_C(16834791760269899346), UINT64_C(                   0), UINT64_C( 4415558743543142856), UINT64_C(13177582657368232424) } },
+    { UINT8_C(102),
+      { UINT64_C( 2202318535045023932), UINT64_C( 4470398162533593494), UINT64_C( 4253800447950202827), UINT64_C( 7212060325634194102),
+        UINT64_C( 9264748765895439722), UINT64_C(14438572278873780656), UINT64_C( 1618786094131566660), UINT64_C( 7015444901643392336) },
+      { UINT64_C( 8862073381350460050), UINT64_C( 8007395925571669850), UINT64_C(10541839595042778325), UINT64_C( 9444582715472548792),
+        UINT64_C(12246409230029940655), UINT64_C( 6964288556541972235), UINT64_C( 3323905519530693196), UINT64_C( 4497106525438716405) },
+      { UINT64_C( 8056564130518624469), UINT64_C( 4189838517211615033), UINT64_C(10538960364363103133), UINT64_C(16311721247366389394),
+        UINT64_C(17878119264490558792), UINT64_C(12235965781258387621), UINT64_C( 1282678716781860509), UINT64_C( 7713417267491455772) },
+      { UINT64_C(                   0), UINT64_C( 4471887631992918931), UINT64_C( 4254207999752077178), UINT64_C(                   0),
+        UINT64_C(                   0), UINT64_C(14440175487854644372), UINT64_C( 1618988250031043097), UINT64_C(                   0) } },
+    { UINT8_C(165),
+      { UINT64_C(17550067271154865939), UINT64_C( 9698969021214302490), UINT64_C(16392564567475344229), UINT64_C(14302714108330813255),
+        UINT64_C( 6534508928295756425), UINT64_C(13534707033627340382), UINT64_C( 3910985878391937475), UINT64_C( 5241499193634081860) },
+      { UINT64_C(  506289549442575469), UINT64_C( 1185336540693618017), UINT64_C( 8153970732329832706), UINT64_C( 3318068539619292678),
+        UINT64_C( 2612898962450550929), UINT64_C(14094947151479871294), UINT64_C(14879855545148575712), UINT64_C(11385837689695889171) },
+      { UINT64_C(18129270800486358192), UINT64_C(11760907174753498290), UINT64_C(15909018228210330673), UINT64_C(12304593919356721943),
+        UINT64_C( 7586232991406267278), UINT64_C( 2418454925401706026), UINT64_C( 9774186065322197247), UINT64_C(10800314729875854397) },
+      { UINT64_C(17551023242276530518), UINT64_C(                   0), UINT64_C(16393820918661011800), UINT64_C(                   0),
+        UINT64_C(                   0), UINT64_C(13534722534337770379), UINT64_C(                   0), UINT64_C( 5241611061656218252) } },
+    { UINT8_C(  9),
+      { UINT64_C(17789262683443290368), UINT64_C(11391863353864801541), UINT64_C(15655239653224538146), UINT64_C( 6752713732203248192),
+        UINT64_C(11778589362014615126), UINT64_C( 9637092299842018241), UINT64_C(11534786684768603060), UINT64_C(13762723833713652549) },
+      { UINT64_C(14464630742941700730), UINT64_C(   69142017512798221), UINT64_C(10335564653538213487), UINT64_C( 4208104505837993024),
+        UINT64_C( 6994388550964978243), UINT64_C(  852243131374106759), UINT64_C(11105394384434761028), UINT64_C(14051697583408172806) },
+      { UINT64_C(16861510418094117963), UINT64_C(15834252321111265558), UINT64_C(16758889146787469726), UINT64_C(14491088807701501399),
+        UINT64_C( 6580155177861916420), UINT64_C( 4371813945272307257), UINT64_C( 8444751354143249766), UINT64_C(10728954818431082653) },
+      { UINT64_C(17789289187433511880), UINT64_C(                   0), UINT64_C(                   0), UINT64_C( 6753877846886973200),
+        UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0) } },
+    { UINT8_C( 14),
+      { UINT64_C( 6552084677360089932), UINT64_C( 9146869570608872893), UINT64_C( 5318629565946148970), UINT64_C( 2040814318133046109),
+        UINT64_C( 1229129019338827112), UINT64_C(11989579726640056187), UINT64_C( 7887675485316480963), UINT64_C( 2773659631957987474) },
+      { UINT64_C( 9804311155833458346), UINT64_C(17929620893800901360), UINT64_C(16486724209182353998), UINT64_C( 3229015523312697068),
+        UINT64_C( 9486614444125104658), UINT64_C( 3535749994834236387), UINT64_C(13718066524073244203), UINT64_C( 9045822256506775258) },
+      { UINT64_C(15057578566279279585), UINT64_C( 5939115580000413270), UINT64_C( 3585198829136247600), UINT64_C( 4809024584052189654),
+        UINT64_C(17548186461192804810), UINT64_C(11227358879663550549), UINT64_C(11752811515569151634), UINT64_C( 9812395529490180233) },
+      { UINT64_C(                   0), UINT64_C( 9147461524755211667), UINT64_C( 5318892438780038456), UINT64_C( 2044444597165309253),
+        UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0) } },
+    { UINT8_C(251),
+      { UINT64_C( 4028340981468708835), UINT64_C(15051378715925832631), UINT64_C(10215080832593218267), UINT64_C(13673725454761831717),
+        UINT64_C(11174053982002698515), UINT64_C(14744163894954669210), UINT64_C(11675523194953284501), UINT64_C( 4183610022425088631) },
+      { UINT64_C( 3387593767850892932), UINT64_C( 5519047783534554586), UINT64_C(16137186262737395411), UINT64_C(  756675682845678368),
+        UINT64_C(10836354199801009566), UINT64_C(14584900753679277667), UINT64_C( 2008056760310050455), UINT64_C(17219480533187301223) },
+      { UINT64_C( 4956638967658277495), UINT64_C(13448530394049620706), UINT64_C( 3390252608302726389), UINT64_C(14475998915228102311),
+        UINT64_C( 7828598150871582334), UINT64_C(13820676211569132526), UINT64_C(14239462960697214628), UINT64_C( 5423074800912087082) },
+      { UINT64_C( 4028868604037690750), UINT64_C(15051749953240554856), UINT64_C(                   0), UINT64_C(13673747977105490380),
+        UINT64_C(11174260632490393922), UINT64_C(14745974816955482013), UINT64_C(11678671029233416837), UINT64_C( 4183975077530824989) } },
+    { UINT8_C(168),
+      { UINT64_C( 5976451862897011261), UINT64_C( 6084324402329813732), UINT64_C( 3490914750428273804), UINT64_C( 7799750973886164212),
+        UINT64_C(17551475592408232178), UINT64_C( 1694249060141084512), UINT64_C( 2500572211511817482), UINT64_C(16886799826803011774) },
+      { UINT64_C( 9613423947704682342), UINT64_C( 6994432547274106990), UINT64_C(   35069208360677420), UINT64_C(10387911162781840455),
+        UINT64_C( 9347625729346917646), UINT64_C(15010933673022942616), UINT64_C( 1386729131423184380), UINT64_C( 9265447538013645786) },
+      { UINT64_C(11845993193205373904), UINT64_C( 7588253576780308697), UINT64_C(18012399734339631129), UINT64_C(10809646011446610449),
+        UINT64_C(18293305178335131438), UINT64_C( 8040834457172341184), UINT64_C( 3844188571272822081), UINT64_C( 1870327460063106968) },
+      { UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C( 7800334606807494625),
+        UINT64_C(                   0), UINT64_C( 1694433933784871385), UINT64_C(                   0), UINT64_C(16887256773920548837) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi64(test_vec[i].c);
+    simde__m512i r = simde_mm512_maskz_madd52hi_epu64(test_vec[i].k, a, b, c);
+    simde_test_x86_assert_equal_u64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    simde__m512i a = simde_test_x86_random_u64x8();
+    simde__m512i b = simde_test_x86_random_u64x8();
+    simde__m512i c = simde_test_x86_random_u64x8();
+    simde__m512i r = simde_mm512_maskz_madd52hi_epu64(k, a, b, c);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_u64x8(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x8(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x8(2, c, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x8(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_madd52lo_avx_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint64_t a[2];
+    const uint64_t b[2];
+    const uint64_t c[2];
+    const uint64_t r[2];
+  } test_vec[] = {
+    { { UINT64_C( 1122294950039613299), UINT64_C( 1686829881179770530) },
+      { UINT64_C(11702833473465597200), UINT64_C( 5777262751864856872) },
+      { UINT64_C( 5963463755943018340), UINT64_C(16246370417597218696) },
+      { UINT64_C( 1124627334411073971), UINT64_C( 1687527236226024418) } },
+    { { UINT64_C(16653605254131477872), UINT64_C( 8559977377579015582) },
+      { UINT64_C(13017632923089220261), UINT64_C( 1557832766523110123) },
+      { UINT64_C(14923712212774204278), UINT64_C(16164287933934343626) },
+      { UINT64_C(16655922652758123646), UINT64_C( 8560349614002737676) } },
+    { { UINT64_C( 6100369142411787720), UINT64_C(13369690048552811215) },
+      { UINT64_C(10547722555046566497), UINT64_C( 9888430067547089694) },
+      { UINT64_C( 2088585342662570047), UINT64_C( 2151626312057425376) },
+      { UINT64_C( 6101499059946023847), UINT64_C(13369970792636676879) } },
+    { { UINT64_C(17406431058189076790), UINT64_C(   73893509975506875) },
+      { UINT64_C( 9898813751881729269), UINT64_C( 4867133409281765555) },
+      { UINT64_C(  438486655104531026), UINT64_C(15821860064282763472) },
+      { UINT64_C(17407824006153822640), UINT64_C(   75536460952613163) } },
+    { { UINT64_C(10754734322849037325), UINT64_C(14392817718866996589) },
+      { UINT64_C(11464477790345952969), UINT64_C( 3757061083344444770) },
+      { UINT64_C( 3203796283754758655), UINT64_C(15156129009389435160) },
+      { UINT64_C(10754944606868344644), UINT64_C(14393094349799948445) } },
+    { { UINT64_C(11947768625020420449), UINT64_C(13976658397264478109) },
+      { UINT64_C( 2755103520731619922), UINT64_C(11991971201845355154) },
+      { UINT64_C(17236301972879331915), UINT64_C( 9451272422183608485) },
+      { UINT64_C(11951471134742467431), UINT64_C(13979921509354588087) } },
+    { { UINT64_C( 8557350447261928333), UINT64_C(14672302628890769074) },
+      { UINT64_C(13767940679233336783), UINT64_C(18186186686691001518) },
+      { UINT64_C( 8679941464246449435), UINT64_C(15139428504723031758) },
+      { UINT64_C( 8561031207934382946), UINT64_C(14675638759553486518) } },
+    { { UINT64_C(12636262733503034499), UINT64_C(17309005537157743818) },
+      { UINT64_C(17519958187874176230), UINT64_C( 2720276029783577579) },
+      { UINT64_C( 9620007369601955280), UINT64_C(16603351259151273893) },
+      { UINT64_C(12636510257164291427), UINT64_C(17313151949351657537) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i c = simde_x_mm_loadu_epi64(test_vec[i].c);
+    simde__m128i r = simde_mm_madd52lo_avx_epu64(a, b, c);
+    simde_test_x86_assert_equal_u64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m128i a = simde_test_x86_random_u64x2();
+    simde__m128i b = simde_test_x86_random_u64x2();
+    simde__m128i c = simde_test_x86_random_u64x2();
+    simde__m128i r = simde_mm_madd52lo_avx_epu64(a, b, c);
+
+    simde_test_x86_write_u64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_u64x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x2(2, c, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_madd52lo_avx_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint64_t a[4];
+    const uint64_t b[4];
+    const uint64_t c[4];
+    const uint64_t r[4];
+  } test_vec[] = {
+    { { UINT64_C(12239013293872732609), UINT64_C( 5120690048380377928), UINT64_C(11118713431167456013), UINT64_C(14019562710624373929) },
+      { UINT64_C( 2179603503321194967), UINT64_C( 4349379030123403165), UINT64_C(13293307853755676140), UINT64_C(16438685154616184670) },
+      { UINT64_C(16647479378489035026), UINT64_C( 1584238105282220177), UINT64_C(12651861849603965133), UINT64_C(18082568127543965184) },
+      { UINT64_C(12240638722414709215), UINT64_C( 5123452528220965685), UINT64_C(11121093888091373833), UINT64_C(14021323597067083945) } },
+    { { UINT64_C(13198619108031294712), UINT64_C( 5420209137138476794), UINT64_C(11634131136093302643), UINT64_C(12363965040975315890) },
+      { UINT64_C( 6695472081073502221), UINT64_C( 5262939772489261631), UINT64_C(11468561503000342758), UINT64_C( 9539695449288070662) },
+      { UINT64_C(12179037871297483078), UINT64_C( 2388156005287887621), UINT64_C(13559160585591468960), UINT64_C( 8836863132920210855) },
+      { UINT64_C(13198982956193897862), UINT64_C( 5424687980253302581), UINT64_C(11634863746307035443), UINT64_C(12367870796957319068) } },
+    { { UINT64_C(   88990058394310953), UINT64_C(12828222144754000810), UINT64_C( 2856806640538070835), UINT64_C( 1980994437735848655) },
+      { UINT64_C( 8159937336519401280), UINT64_C( 5571899532944742798), UINT64_C(14750657661099282957), UINT64_C( 2307053437982865910) },
+      { UINT64_C( 3252613362279625708), UINT64_C(16436768475790080692), UINT64_C( 2701356238262850228), UINT64_C( 9592406183924092190) },
+      { UINT64_C(   91216801779869737), UINT64_C(12828793578559391618), UINT64_C( 2860197983433493079), UINT64_C( 1982522525191988131) } },
+    { { UINT64_C(14596266544019832005), UINT64_C( 3788007226356555477), UINT64_C( 5141811324415968006), UINT64_C( 4669780344302823855) },
+      { UINT64_C( 4017549942257288928), UINT64_C( 1460984931946879634), UINT64_C( 4460997462920407929), UINT64_C( 8343293872541412878) },
+      { UINT64_C( 3743946634601065563), UINT64_C(14458960877074110853), UINT64_C(11926467047865381559), UINT64_C(13440702121354594688) },
+      { UINT64_C(14596602148580126309), UINT64_C( 3788365596829888175), UINT64_C( 5145851179348818053), UINT64_C( 4674009915541352111) } },
+    { { UINT64_C(11616872627120369763), UINT64_C(13861758632514059334), UINT64_C(11171891472591341774), UINT64_C(10640374450122274962) },
+      { UINT64_C(15339487441171456548), UINT64_C(13840627018651800906), UINT64_C( 3694412540229785744), UINT64_C( 5416649646294692712) },
+      { UINT64_C(15732036191677825776), UINT64_C( 1527354165522447744), UINT64_C(17306495024640251737), UINT64_C( 1039121081015226616) },
+      { UINT64_C(11618732628862253603), UINT64_C(13862631445982921542), UINT64_C(11173519440043328222), UINT64_C(10643089818341508434) } },
+    { { UINT64_C(16348031883982796405), UINT64_C(11977189399861661085), UINT64_C(17606204797900355294), UINT64_C(  381538850902957342) },
+      { UINT64_C( 6177507918511528054), UINT64_C( 8352961890010730487), UINT64_C( 8616562949552180132), UINT64_C(11358920656268011532) },
+      { UINT64_C(10224069002254462166), UINT64_C(12486437812512643647), UINT64_C( 6564244189017350472), UINT64_C(11623397883632995465) },
+      { UINT64_C(16350316489904763161), UINT64_C(11981427370148745574), UINT64_C(17606773032484102398), UINT64_C(  385680836055489418) } },
+    { { UINT64_C( 3632737987536601926), UINT64_C( 4765740763533753453), UINT64_C(15716432752681382000), UINT64_C(17524588815028196296) },
+      { UINT64_C(16411745372496487324), UINT64_C( 9850353254412175735), UINT64_C( 6491765768110708460), UINT64_C( 1591495227266146933) },
+      { UINT64_C(11087132352787703427), UINT64_C(11516194299885270577), UINT64_C(17312105780603590739), UINT64_C(15071060093289311638) },
+      { UINT64_C( 3633894674377794586), UINT64_C( 4768742157284271668), UINT64_C(15720468999302774516), UINT64_C(17528560006491067734) } },
+    { { UINT64_C( 7406917483586374927), UINT64_C(16443065077209224414), UINT64_C(11025949891276443289), UINT64_C( 5789607396052178744) },
+      { UINT64_C(12194423754851427231), UINT64_C(  330007882478905887), UINT64_C(11679272452329332602), UINT64_C( 3514076070974963508) },
+      { UINT64_C(12616904245648836004), UINT64_C( 4150617635280605994), UINT64_C(   99021801337041235), UINT64_C(12487419677598189707) },
+      { UINT64_C( 7410851267500341739), UINT64_C(16445935280427191028), UINT64_C(11026021179288739111), UINT64_C( 5789955580766488692) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i c = simde_x_mm256_loadu_epi64(test_vec[i].c);
+    simde__m256i r = simde_mm256_madd52lo_avx_epu64(a, b, c);
+    simde_test_x86_assert_equal_u64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m256i a = simde_test_x86_random_u64x4();
+    simde__m256i b = simde_test_x86_random_u64x4();
+    simde__m256i c = simde_test_x86_random_u64x4();
+    simde__m256i r = simde_mm256_madd52lo_avx_epu64(a, b, c);
+
+    simde_test_x86_write_u64x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_u64x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x4(2, c, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_madd52hi_avx_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint64_t a[2];
+    const uint64_t b[2];
+    const uint64_t c[2];
+    const uint64_t r[2];
+  } test_vec[] = {
+    { { UINT64_C(13456814579444895872), UINT64_C( 7386440033379491720) },
+      { UINT64_C(10261595801585399705), UINT64_C(11007631022550081035) },
+      { UINT64_C(11281632604784811846), UINT64_C( 6918204985111273352) },
+      { UINT64_C(13456876044122424154), UINT64_C( 7386565140644360471) } },
+    { { UINT64_C(12983367181349103261), UINT64_C( 1566844537396647949) },
+      { UINT64_C( 6348805334650021739), UINT64_C(  253318022124798043) },
+      { UINT64_C( 9690288968706574877), UINT64_C( 4291484938557736107) },
+      { UINT64_C(12985554247131105551), UINT64_C( 1567850539306648898) } },
+    { { UINT64_C( 5906987641525140177), UINT64_C(  162121775037345493) },
+      { UINT64_C( 6936179724427780930), UINT64_C( 2995289955801689734) },
+      { UINT64_C(17738205732002221026), UINT64_C(15679688469262802610) },
+      { UINT64_C( 5907415796354164092), UINT64_C(  162355626884653879) } },
+    { { UINT64_C( 3056492392364728660), UINT64_C(10324522676202259654) },
+      { UINT64_C( 9832925711863059037), UINT64_C( 7827177093935900464) },
+      { UINT64_C(15197360713396204569), UINT64_C(15519184936789632803) },
+      { UINT64_C( 3057263643469584130), UINT64_C(10328731689357159282) } },
+    { { UINT64_C( 9847906015064213067), UINT64_C(11238150689589741937) },
+      { UINT64_C( 7926404932009749282), UINT64_C( 8428378027607388583) },
+      { UINT64_C( 9890819677311356259), UINT64_C(11684317106418127369) },
+      { UINT64_C( 9847920151668745268), UINT64_C(11239092755201368111) } },
+    { { UINT64_C( 7362208637320789875), UINT64_C( 7665265133987719618) },
+      { UINT64_C( 4641919525378717387), UINT64_C(17950770349185138427) },
+      { UINT64_C( 9410239261509611122), UINT64_C( 7403020153500081483) },
+      { UINT64_C( 7363791655901838436), UINT64_C( 7668408491401436956) } },
+    { { UINT64_C( 4989060721372946885), UINT64_C( 7832286395396785970) },
+      { UINT64_C(10740861131093272780), UINT64_C( 1320578666553900369) },
+      { UINT64_C( 9445537508706131077), UINT64_C( 9275143311910032721) },
+      { UINT64_C( 4990475753683499358), UINT64_C( 7832793808464066047) } },
+    { { UINT64_C(15723503947631842389), UINT64_C( 5041527723655634073) },
+      { UINT64_C(11640443081283863991), UINT64_C(  734830789512710143) },
+      { UINT64_C(17535855153912627192), UINT64_C(17510224310484673275) },
+      { UINT64_C(15725835140819783035), UINT64_C( 5041565550553033979) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i c = simde_x_mm_loadu_epi64(test_vec[i].c);
+    simde__m128i r = simde_mm_madd52hi_avx_epu64(a, b, c);
+    simde_test_x86_assert_equal_u64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m128i a = simde_test_x86_random_u64x2();
+    simde__m128i b = simde_test_x86_random_u64x2();
+    simde__m128i c = simde_test_x86_random_u64x2();
+    simde__m128i r = simde_mm_madd52hi_avx_epu64(a, b, c);
+
+    simde_test_x86_write_u64x2(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_u64x2(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x2(2, c, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x2(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_madd52hi_avx_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint64_t a[4];
+    const uint64_t b[4];
+    const uint64_t c[4];
+    const uint64_t r[4];
+  } test_vec[] = {
+    { { UINT64_C( 4451393982697248214), UINT64_C( 5696528335793861454), UINT64_C(10569714781169694817), UINT64_C( 3421977438350903373) },
+      { UINT64_C( 5683290944302250339), UINT64_C( 6013537995570991054), UINT64_C(13709449231386756376), UINT64_C( 4742226492606943047) },
+      { UINT64_C(  976651370614694974), UINT64_C( 6329992068000309138), UINT64_C(17157104510255425515), UINT64_C( 7419220960782213847) },
+      { UINT64_C( 4455051256088211695), UINT64_C( 5697194606635287342), UINT64_C(10570030865491015839), UINT64_C( 3423744375503508223) } },
+    { { UINT64_C( 3444745318613441154), UINT64_C(10567288221601103888), UINT64_C(14629953234029948019), UINT64_C( 8572451208508249706) },
+      { UINT64_C(16004955032750890064), UINT64_C(15005664507230802181), UINT64_C(11403099088639110272), UINT64_C( 9724440610381741961) },
+      { UINT64_C( 3922231967549238211), UINT64_C(17334109159400053858), UINT64_C(17662735574511221324), UINT64_C( 4044346220178787940) },
+      { UINT64_C( 3448082616132353221), UINT64_C(10571234545147849659), UINT64_C(14634060788864831308), UINT64_C( 8572480736234063837) } },
+    { { UINT64_C( 9798204574635955346), UINT64_C( 5274795971824770259), UINT64_C(11651630537818937424), UINT64_C( 2225723300577486134) },
+      { UINT64_C(13158916554129321200), UINT64_C(  720343641536193464), UINT64_C(16763374939654244805), UINT64_C( 2974477166295899805) },
+      { UINT64_C(13744102076965660963), UINT64_C(11998278669999257023), UINT64_C( 6761393707559700539), UINT64_C(  183749143658129449) },
+      { UINT64_C( 9801340707633367153), UINT64_C( 5275449681853953808), UINT64_C(11651953961379962216), UINT64_C( 2227405493695838276) } },
+    { { UINT64_C( 7474784232335264759), UINT64_C(15853060608491531897), UINT64_C( 2290536662407162539), UINT64_C( 1578808665954209543) },
+      { UINT64_C( 3452235298112729562), UINT64_C(15454537715236391163), UINT64_C(16738202927285486134), UINT64_C(13082033170840210522) },
+      { UINT64_C( 7461936178618867369), UINT64_C(15846052337316731367), UINT64_C(10270548236683324095), UINT64_C(13235395472900118045) },
+      { UINT64_C( 7476971475949022379), UINT64_C(15854486085060267952), UINT64_C( 2292006059593809234), UINT64_C( 1581844949765615636) } },
+    { { UINT64_C(16862501765215872049), UINT64_C( 4773223532546820029), UINT64_C(12885478673198760975), UINT64_C(11278799536864876737) },
+      { UINT64_C(18314517081291791420), UINT64_C( 2020319685557364547), UINT64_C( 1668920483868896226), UINT64_C( 7571232866087392267) },
+      { UINT64_C(14503512223691393544), UINT64_C( 2819984838429288442), UINT64_C(13903113108540260996), UINT64_C( 5418472757655951260) },
+      { UINT64_C(16863730918519691180), UINT64_C( 4773663210236236752), UINT64_C(12885766676559181040), UINT64_C(11278896803897240775) } },
+    { { UINT64_C(12169529584396852114), UINT64_C(10443232959450280577), UINT64_C(17278442957093636948), UINT64_C(15691361644384419635) },
+      { UINT64_C(12834648921467934406), UINT64_C(17429887808750341191), UINT64_C(15939580112961949170), UINT64_C(11304904598165449922) },
+      { UINT64_C(17460507065646699885), UINT64_C( 2488564458260384250), UINT64_C(  719620770244297589), UINT64_C(15274792005689102471) },
+      { UINT64_C(12169573944698552902), UINT64_C(10443780805551710861), UINT64_C(17279499568875388881), UINT64_C(15691957410642689826) } },
+    { { UINT64_C( 3704424245568277451), UINT64_C( 5394560106103483787), UINT64_C( 7360964124922692823), UINT64_C(18225995330842016437) },
+      { UINT64_C(12553179380264886729), UINT64_C( 3073222219085315975), UINT64_C( 3157708838841880716), UINT64_C( 2149965610183268010) },
+      { UINT64_C(12207380773092673687), UINT64_C(12020296635906380627), UINT64_C( 3629026673343731900), UINT64_C( 8208905274712171386) },
+      { UINT64_C( 3705384641540909229), UINT64_C( 5394634362685352969), UINT64_C( 7361516496716446928), UINT64_C(18227294756523922613) } },
+    { { UINT64_C(12823882696231750187), UINT64_C( 7289402180377312616), UINT64_C(11095729424808950593), UINT64_C( 1648971580432648086) },
+      { UINT64_C(  822852115690163804), UINT64_C( 3271503304085848920), UINT64_C( 9703552885525511665), UINT64_C(13761269155161903352) },
+      { UINT64_C( 1267170351422922215), UINT64_C(14609811166572192423), UINT64_C(11595788995092264566), UINT64_C(11796753424991904661) },
+      { UINT64_C(12825060273311323663), UINT64_C( 7289458404307617586), UINT64_C(11097919549268560850), UINT64_C( 1650095616970290654) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i c = simde_x_mm256_loadu_epi64(test_vec[i].c);
+    simde__m256i r = simde_mm256_madd52hi_avx_epu64(a, b, c);
+    simde_test_x86_assert_equal_u64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m256i a = simde_test_x86_random_u64x4();
+    simde__m256i b = simde_test_x86_random_u64x4();
+    simde__m256i c = simde_test_x86_random_u64x4();
+    simde__m256i r = simde_mm256_madd52hi_avx_epu64(a, b, c);
+
+    simde_test_x86_write_u64x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_u64x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x4(2, c, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u64x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_madd52lo_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_madd52lo_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_madd52lo_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_madd52lo_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_madd52lo_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_madd52lo_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_madd52lo_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_madd52lo_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_madd52lo_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_madd52hi_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_madd52hi_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_madd52hi_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_madd52hi_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_madd52hi_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_madd52hi_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_madd52hi_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_madd52hi_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_madd52hi_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_madd52lo_avx_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_madd52lo_avx_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_madd52hi_avx_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_madd52hi_avx_epu64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -1546,6 +1546,405 @@ test_simde_mm512_maskz_mul_pd(SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm_mul_ph (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float16 a[8];
+    const simde_float16 b[8];
+    const simde_float16 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(    -50.2), SIMDE_FLOAT16_VALUE(     71.7), SIMDE_FLOAT16_VALUE(   -34.47), SIMDE_FLOAT16_VALUE(     84.2),
+        SIMDE_FLOAT16_VALUE(   -1.749), SIMDE_FLOAT16_VALUE(   -33.28), SIMDE_FLOAT16_VALUE(   -95.56), SIMDE_FLOAT16_VALUE(   -57.38) },
+      { SIMDE_FLOAT16_VALUE(   -20.08), SIMDE_FLOAT16_VALUE(    38.62), SIMDE_FLOAT16_VALUE(    90.44), SIMDE_FLOAT16_VALUE(    40.72),
+        SIMDE_FLOAT16_VALUE(   -33.47), SIMDE_FLOAT16_VALUE(    -95.7), SIMDE_FLOAT16_VALUE(     44.5), SIMDE_FLOAT16_VALUE(     92.1) },
+      { SIMDE_FLOAT16_VALUE(   1007.5), SIMDE_FLOAT16_VALUE(   2768.0), SIMDE_FLOAT16_VALUE(  -3118.0), SIMDE_FLOAT16_VALUE(   3428.0),
+        SIMDE_FLOAT16_VALUE(    58.53), SIMDE_FLOAT16_VALUE(   3184.0), SIMDE_FLOAT16_VALUE(  -4252.0), SIMDE_FLOAT16_VALUE(  -5284.0) } },
+    { { SIMDE_FLOAT16_VALUE(     9.66), SIMDE_FLOAT16_VALUE(    85.56), SIMDE_FLOAT16_VALUE(     53.7), SIMDE_FLOAT16_VALUE(   -7.223),
+        SIMDE_FLOAT16_VALUE(    -83.2), SIMDE_FLOAT16_VALUE(    86.25), SIMDE_FLOAT16_VALUE(     34.4), SIMDE_FLOAT16_VALUE(     91.4) },
+      { SIMDE_FLOAT16_VALUE(    26.97), SIMDE_FLOAT16_VALUE(   -31.55), SIMDE_FLOAT16_VALUE(     35.4), SIMDE_FLOAT16_VALUE(     62.2),
+        SIMDE_FLOAT16_VALUE(    42.16), SIMDE_FLOAT16_VALUE(     4.66), SIMDE_FLOAT16_VALUE(   -40.28), SIMDE_FLOAT16_VALUE(   -86.25) },
+      { SIMDE_FLOAT16_VALUE(    260.5), SIMDE_FLOAT16_VALUE(  -2700.0), SIMDE_FLOAT16_VALUE(   1901.0), SIMDE_FLOAT16_VALUE(   -449.2),
+        SIMDE_FLOAT16_VALUE(  -3506.0), SIMDE_FLOAT16_VALUE(    402.0), SIMDE_FLOAT16_VALUE(  -1386.0), SIMDE_FLOAT16_VALUE(  -7880.0) } },
+    { { SIMDE_FLOAT16_VALUE(    -30.5), SIMDE_FLOAT16_VALUE(   -93.94), SIMDE_FLOAT16_VALUE(     51.5), SIMDE_FLOAT16_VALUE(    -66.4),
+        SIMDE_FLOAT16_VALUE(   12.086), SIMDE_FLOAT16_VALUE(    -75.8), SIMDE_FLOAT16_VALUE(    -61.2), SIMDE_FLOAT16_VALUE(   -10.02) },
+      { SIMDE_FLOAT16_VALUE(     62.9), SIMDE_FLOAT16_VALUE(    -62.1), SIMDE_FLOAT16_VALUE(   -54.34), SIMDE_FLOAT16_VALUE(    14.38),
+        SIMDE_FLOAT16_VALUE(   -34.34), SIMDE_FLOAT16_VALUE(   -21.44), SIMDE_FLOAT16_VALUE(    -63.1), SIMDE_FLOAT16_VALUE(     31.3) },
+      { SIMDE_FLOAT16_VALUE(  -1919.0), SIMDE_FLOAT16_VALUE(   5832.0), SIMDE_FLOAT16_VALUE(  -2798.0), SIMDE_FLOAT16_VALUE(   -954.5),
+        SIMDE_FLOAT16_VALUE(   -415.0), SIMDE_FLOAT16_VALUE(   1625.0), SIMDE_FLOAT16_VALUE(   3860.0), SIMDE_FLOAT16_VALUE(   -313.8) } },
+    { { SIMDE_FLOAT16_VALUE(    -99.6), SIMDE_FLOAT16_VALUE(    49.38), SIMDE_FLOAT16_VALUE(   -62.66), SIMDE_FLOAT16_VALUE(   -91.44),
+        SIMDE_FLOAT16_VALUE(   -56.38), SIMDE_FLOAT16_VALUE(   -21.14), SIMDE_FLOAT16_VALUE(      8.1), SIMDE_FLOAT16_VALUE(   -15.57) },
+      { SIMDE_FLOAT16_VALUE(     6.43), SIMDE_FLOAT16_VALUE(    51.94), SIMDE_FLOAT16_VALUE(   -15.16), SIMDE_FLOAT16_VALUE(     45.5),
+        SIMDE_FLOAT16_VALUE(    -84.5), SIMDE_FLOAT16_VALUE(    -54.3), SIMDE_FLOAT16_VALUE(   -66.25), SIMDE_FLOAT16_VALUE(    13.97) },
+      { SIMDE_FLOAT16_VALUE(   -640.5), SIMDE_FLOAT16_VALUE(   2564.0), SIMDE_FLOAT16_VALUE(    949.5), SIMDE_FLOAT16_VALUE(  -4160.0),
+        SIMDE_FLOAT16_VALUE(   4764.0), SIMDE_FLOAT16_VALUE(   1148.0), SIMDE_FLOAT16_VALUE(   -536.5), SIMDE_FLOAT16_VALUE(   -217.5) } },
+    { { SIMDE_FLOAT16_VALUE(   -95.25), SIMDE_FLOAT16_VALUE(     77.9), SIMDE_FLOAT16_VALUE(    42.88), SIMDE_FLOAT16_VALUE(    -57.5),
+        SIMDE_FLOAT16_VALUE(    29.94), SIMDE_FLOAT16_VALUE(     97.5), SIMDE_FLOAT16_VALUE(     94.1), SIMDE_FLOAT16_VALUE(    14.83) },
+      { SIMDE_FLOAT16_VALUE(   -29.72), SIMDE_FLOAT16_VALUE(    19.44), SIMDE_FLOAT16_VALUE(    -50.8), SIMDE_FLOAT16_VALUE(   -46.22),
+        SIMDE_FLOAT16_VALUE(    -97.2), SIMDE_FLOAT16_VALUE(     90.1), SIMDE_FLOAT16_VALUE(    -47.8), SIMDE_FLOAT16_VALUE(   -80.25) },
+      { SIMDE_FLOAT16_VALUE(   2830.0), SIMDE_FLOAT16_VALUE(   1514.0), SIMDE_FLOAT16_VALUE(  -2178.0), SIMDE_FLOAT16_VALUE(   2658.0),
+        SIMDE_FLOAT16_VALUE(  -2910.0), SIMDE_FLOAT16_VALUE(   8784.0), SIMDE_FLOAT16_VALUE(  -4500.0), SIMDE_FLOAT16_VALUE(  -1190.0) } },
+    { { SIMDE_FLOAT16_VALUE(    57.53), SIMDE_FLOAT16_VALUE(   -48.75), SIMDE_FLOAT16_VALUE(    -78.1), SIMDE_FLOAT16_VALUE(    74.25),
+        SIMDE_FLOAT16_VALUE(    28.33), SIMDE_FLOAT16_VALUE(    11.19), SIMDE_FLOAT16_VALUE(   -49.25), SIMDE_FLOAT16_VALUE(     92.6) },
+      { SIMDE_FLOAT16_VALUE(   -11.85), SIMDE_FLOAT16_VALUE(   -45.88), SIMDE_FLOAT16_VALUE(    -48.2), SIMDE_FLOAT16_VALUE(   -15.38),
+        SIMDE_FLOAT16_VALUE(    44.66), SIMDE_FLOAT16_VALUE(   -39.03), SIMDE_FLOAT16_VALUE(     13.2), SIMDE_FLOAT16_VALUE(     84.7) },
+      { SIMDE_FLOAT16_VALUE(   -682.0), SIMDE_FLOAT16_VALUE(   2236.0), SIMDE_FLOAT16_VALUE(   3764.0), SIMDE_FLOAT16_VALUE(  -1142.0),
+        SIMDE_FLOAT16_VALUE(   1265.0), SIMDE_FLOAT16_VALUE(   -436.8), SIMDE_FLOAT16_VALUE(   -650.5), SIMDE_FLOAT16_VALUE(   7844.0) } },
+    { { SIMDE_FLOAT16_VALUE(     91.4), SIMDE_FLOAT16_VALUE(    81.75), SIMDE_FLOAT16_VALUE(   -62.22), SIMDE_FLOAT16_VALUE(    24.42),
+        SIMDE_FLOAT16_VALUE(    -85.2), SIMDE_FLOAT16_VALUE(   -94.56), SIMDE_FLOAT16_VALUE(   -10.45), SIMDE_FLOAT16_VALUE(    49.53) },
+      { SIMDE_FLOAT16_VALUE(    98.44), SIMDE_FLOAT16_VALUE(     16.4), SIMDE_FLOAT16_VALUE(    -5.79), SIMDE_FLOAT16_VALUE(   -12.61),
+        SIMDE_FLOAT16_VALUE(     48.1), SIMDE_FLOAT16_VALUE(   -30.81), SIMDE_FLOAT16_VALUE(   -32.25), SIMDE_FLOAT16_VALUE(     97.3) },
+      { SIMDE_FLOAT16_VALUE(   8992.0), SIMDE_FLOAT16_VALUE(   1341.0), SIMDE_FLOAT16_VALUE(    360.2), SIMDE_FLOAT16_VALUE(   -308.0),
+        SIMDE_FLOAT16_VALUE(  -4096.0), SIMDE_FLOAT16_VALUE(   2914.0), SIMDE_FLOAT16_VALUE(    337.0), SIMDE_FLOAT16_VALUE(   4820.0) } },
+    { { SIMDE_FLOAT16_VALUE(    -93.8), SIMDE_FLOAT16_VALUE(    62.06), SIMDE_FLOAT16_VALUE(    45.66), SIMDE_FLOAT16_VALUE(    26.77),
+        SIMDE_FLOAT16_VALUE(   -8.125), SIMDE_FLOAT16_VALUE(    50.28), SIMDE_FLOAT16_VALUE(   -13.56), SIMDE_FLOAT16_VALUE(   -11.47) },
+      { SIMDE_FLOAT16_VALUE(    62.84), SIMDE_FLOAT16_VALUE(   -18.89), SIMDE_FLOAT16_VALUE(   -14.21), SIMDE_FLOAT16_VALUE(     5.77),
+        SIMDE_FLOAT16_VALUE(     45.6), SIMDE_FLOAT16_VALUE(    95.44), SIMDE_FLOAT16_VALUE(   -47.12), SIMDE_FLOAT16_VALUE(    49.38) },
+      { SIMDE_FLOAT16_VALUE(  -5896.0), SIMDE_FLOAT16_VALUE(  -1172.0), SIMDE_FLOAT16_VALUE(   -649.0), SIMDE_FLOAT16_VALUE(    154.4),
+        SIMDE_FLOAT16_VALUE(   -370.5), SIMDE_FLOAT16_VALUE(   4800.0), SIMDE_FLOAT16_VALUE(    639.0), SIMDE_FLOAT16_VALUE(   -566.5) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128h a = simde_mm_loadu_ph(test_vec[i].a);
+    simde__m128h b = simde_mm_loadu_ph(test_vec[i].b);
+    simde__m128h r = simde_mm_mul_ph(a, b);
+    simde_test_x86_assert_equal_f16x8(r, simde_mm_loadu_ph(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm256_mul_ph (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float16 a[16];
+    const simde_float16 b[16];
+    const simde_float16 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(     36.1), SIMDE_FLOAT16_VALUE(     91.1), SIMDE_FLOAT16_VALUE(    -91.7), SIMDE_FLOAT16_VALUE(   -11.34),
+        SIMDE_FLOAT16_VALUE(   -86.25), SIMDE_FLOAT16_VALUE(   -43.53), SIMDE_FLOAT16_VALUE(    -31.8), SIMDE_FLOAT16_VALUE(   -60.38),
+        SIMDE_FLOAT16_VALUE(    44.75), SIMDE_FLOAT16_VALUE(     59.8), SIMDE_FLOAT16_VALUE(    -43.2), SIMDE_FLOAT16_VALUE(   -62.44),
+        SIMDE_FLOAT16_VALUE(    21.39), SIMDE_FLOAT16_VALUE(   -49.38), SIMDE_FLOAT16_VALUE(     52.4), SIMDE_FLOAT16_VALUE(   -29.19) },
+      { SIMDE_FLOAT16_VALUE(    16.98), SIMDE_FLOAT16_VALUE(    21.78), SIMDE_FLOAT16_VALUE(   -97.06), SIMDE_FLOAT16_VALUE(    -66.9),
+        SIMDE_FLOAT16_VALUE(    -14.2), SIMDE_FLOAT16_VALUE(    67.75), SIMDE_FLOAT16_VALUE(     2.75), SIMDE_FLOAT16_VALUE(     37.4),
+        SIMDE_FLOAT16_VALUE(    -45.2), SIMDE_FLOAT16_VALUE(    -82.9), SIMDE_FLOAT16_VALUE(    -27.8), SIMDE_FLOAT16_VALUE(     7.08),
+        SIMDE_FLOAT16_VALUE(   -54.06), SIMDE_FLOAT16_VALUE(   -63.25), SIMDE_FLOAT16_VALUE(   -10.05), SIMDE_FLOAT16_VALUE(     51.7) },
+      { SIMDE_FLOAT16_VALUE(    613.0), SIMDE_FLOAT16_VALUE(   1985.0), SIMDE_FLOAT16_VALUE(   8896.0), SIMDE_FLOAT16_VALUE(    758.5),
+        SIMDE_FLOAT16_VALUE(   1225.0), SIMDE_FLOAT16_VALUE(  -2950.0), SIMDE_FLOAT16_VALUE(   -87.44), SIMDE_FLOAT16_VALUE(  -2258.0),
+        SIMDE_FLOAT16_VALUE(  -2022.0), SIMDE_FLOAT16_VALUE(  -4956.0), SIMDE_FLOAT16_VALUE(   1200.0), SIMDE_FLOAT16_VALUE(   -442.0),
+        SIMDE_FLOAT16_VALUE(  -1156.0), SIMDE_FLOAT16_VALUE(   3122.0), SIMDE_FLOAT16_VALUE(   -526.5), SIMDE_FLOAT16_VALUE(  -1509.0) } },
+    { { SIMDE_FLOAT16_VALUE(   -59.84), SIMDE_FLOAT16_VALUE(    28.64), SIMDE_FLOAT16_VALUE(    88.06), SIMDE_FLOAT16_VALUE(    86.06),
+        SIMDE_FLOAT16_VALUE(     66.5), SIMDE_FLOAT16_VALUE(    80.56), SIMDE_FLOAT16_VALUE(    13.64), SIMDE_FLOAT16_VALUE(   -42.75),
+        SIMDE_FLOAT16_VALUE(     68.5), SIMDE_FLOAT16_VALUE(    53.66), SIMDE_FLOAT16_VALUE(    36.34), SIMDE_FLOAT16_VALUE(   -1.304),
+        SIMDE_FLOAT16_VALUE(     48.7), SIMDE_FLOAT16_VALUE(   -53.84), SIMDE_FLOAT16_VALUE(   -5.254), SIMDE_FLOAT16_VALUE(   -94.56) },
+      { SIMDE_FLOAT16_VALUE(    -58.8), SIMDE_FLOAT16_VALUE(     97.3), SIMDE_FLOAT16_VALUE(    50.94), SIMDE_FLOAT16_VALUE(     85.5),
+        SIMDE_FLOAT16_VALUE(   -60.25), SIMDE_FLOAT16_VALUE(    -5.72), SIMDE_FLOAT16_VALUE(     39.9), SIMDE_FLOAT16_VALUE(    -76.4),
+        SIMDE_FLOAT16_VALUE(   -49.75), SIMDE_FLOAT16_VALUE(  -14.914), SIMDE_FLOAT16_VALUE(    63.94), SIMDE_FLOAT16_VALUE(    57.88),
+        SIMDE_FLOAT16_VALUE(    -66.3), SIMDE_FLOAT16_VALUE(   -41.88), SIMDE_FLOAT16_VALUE(     92.9), SIMDE_FLOAT16_VALUE(    -92.0) },
+      { SIMDE_FLOAT16_VALUE(   3520.0), SIMDE_FLOAT16_VALUE(   2788.0), SIMDE_FLOAT16_VALUE(   4484.0), SIMDE_FLOAT16_VALUE(   7360.0),
+        SIMDE_FLOAT16_VALUE(  -4006.0), SIMDE_FLOAT16_VALUE(   -460.8), SIMDE_FLOAT16_VALUE(    544.5), SIMDE_FLOAT16_VALUE(   3266.0),
+        SIMDE_FLOAT16_VALUE(  -3408.0), SIMDE_FLOAT16_VALUE(   -800.0), SIMDE_FLOAT16_VALUE(   2324.0), SIMDE_FLOAT16_VALUE(   -75.44),
+        SIMDE_FLOAT16_VALUE(  -3228.0), SIMDE_FLOAT16_VALUE(   2254.0), SIMDE_FLOAT16_VALUE(   -488.0), SIMDE_FLOAT16_VALUE(   8696.0) } },
+    { { SIMDE_FLOAT16_VALUE(   -64.06), SIMDE_FLOAT16_VALUE(   -27.73), SIMDE_FLOAT16_VALUE(    -36.0), SIMDE_FLOAT16_VALUE(     77.0),
+        SIMDE_FLOAT16_VALUE(    -66.4), SIMDE_FLOAT16_VALUE(    53.56), SIMDE_FLOAT16_VALUE(    41.62), SIMDE_FLOAT16_VALUE(   -48.66),
+        SIMDE_FLOAT16_VALUE(  -0.6567), SIMDE_FLOAT16_VALUE(     32.3), SIMDE_FLOAT16_VALUE(     68.1), SIMDE_FLOAT16_VALUE(   -46.84),
+        SIMDE_FLOAT16_VALUE(   -76.25), SIMDE_FLOAT16_VALUE(     83.0), SIMDE_FLOAT16_VALUE(   -17.11), SIMDE_FLOAT16_VALUE(    47.88) },
+      { SIMDE_FLOAT16_VALUE(    16.69), SIMDE_FLOAT16_VALUE(   -58.22), SIMDE_FLOAT16_VALUE(   -24.14), SIMDE_FLOAT16_VALUE(     90.6),
+        SIMDE_FLOAT16_VALUE(     85.3), SIMDE_FLOAT16_VALUE(    -64.4), SIMDE_FLOAT16_VALUE(    88.75), SIMDE_FLOAT16_VALUE(    30.95),
+        SIMDE_FLOAT16_VALUE(    -47.5), SIMDE_FLOAT16_VALUE(    -51.8), SIMDE_FLOAT16_VALUE(    -4.07), SIMDE_FLOAT16_VALUE(    80.75),
+        SIMDE_FLOAT16_VALUE(     70.6), SIMDE_FLOAT16_VALUE(    12.69), SIMDE_FLOAT16_VALUE(    42.25), SIMDE_FLOAT16_VALUE(    -45.9) },
+      { SIMDE_FLOAT16_VALUE(  -1069.0), SIMDE_FLOAT16_VALUE(   1615.0), SIMDE_FLOAT16_VALUE(    869.0), SIMDE_FLOAT16_VALUE(   6980.0),
+        SIMDE_FLOAT16_VALUE(  -5664.0), SIMDE_FLOAT16_VALUE(  -3448.0), SIMDE_FLOAT16_VALUE(   3694.0), SIMDE_FLOAT16_VALUE(  -1506.0),
+        SIMDE_FLOAT16_VALUE(    31.19), SIMDE_FLOAT16_VALUE(  -1674.0), SIMDE_FLOAT16_VALUE(   -277.2), SIMDE_FLOAT16_VALUE(  -3782.0),
+        SIMDE_FLOAT16_VALUE(  -5384.0), SIMDE_FLOAT16_VALUE(   1053.0), SIMDE_FLOAT16_VALUE(   -723.0), SIMDE_FLOAT16_VALUE(  -2198.0) } },
+    { { SIMDE_FLOAT16_VALUE(     76.2), SIMDE_FLOAT16_VALUE(   -14.54), SIMDE_FLOAT16_VALUE(    -71.6), SIMDE_FLOAT16_VALUE(   -61.47),
+        SIMDE_FLOAT16_VALUE(   -22.31), SIMDE_FLOAT16_VALUE(    -57.8), SIMDE_FLOAT16_VALUE(   -18.81), SIMDE_FLOAT16_VALUE(    85.06),
+        SIMDE_FLOAT16_VALUE(    73.56), SIMDE_FLOAT16_VALUE(   -10.63), SIMDE_FLOAT16_VALUE(    -30.3), SIMDE_FLOAT16_VALUE(    27.88),
+        SIMDE_FLOAT16_VALUE(    -98.4), SIMDE_FLOAT16_VALUE(   -38.12), SIMDE_FLOAT16_VALUE(    11.11), SIMDE_FLOAT16_VALUE(   -53.44) },
+      { SIMDE_FLOAT16_VALUE(   -70.06), SIMDE_FLOAT16_VALUE(    -11.4), SIMDE_FLOAT16_VALUE(   -4.434), SIMDE_FLOAT16_VALUE(    30.88),
+        SIMDE_FLOAT16_VALUE(    48.78), SIMDE_FLOAT16_VALUE(    -92.9), SIMDE_FLOAT16_VALUE(    52.03), SIMDE_FLOAT16_VALUE(    54.28),
+        SIMDE_FLOAT16_VALUE(    -73.0), SIMDE_FLOAT16_VALUE(   -47.25), SIMDE_FLOAT16_VALUE(   -31.02), SIMDE_FLOAT16_VALUE(   -45.38),
+        SIMDE_FLOAT16_VALUE(    15.32), SIMDE_FLOAT16_VALUE(    -84.0), SIMDE_FLOAT16_VALUE(     90.1), SIMDE_FLOAT16_VALUE(    -82.1) },
+      { SIMDE_FLOAT16_VALUE(  -5336.0), SIMDE_FLOAT16_VALUE(    165.8), SIMDE_FLOAT16_VALUE(    317.5), SIMDE_FLOAT16_VALUE(  -1898.0),
+        SIMDE_FLOAT16_VALUE(  -1088.0), SIMDE_FLOAT16_VALUE(   5368.0), SIMDE_FLOAT16_VALUE(   -979.0), SIMDE_FLOAT16_VALUE(   4616.0),
+        SIMDE_FLOAT16_VALUE(  -5372.0), SIMDE_FLOAT16_VALUE(    502.5), SIMDE_FLOAT16_VALUE(    939.5), SIMDE_FLOAT16_VALUE(  -1265.0),
+        SIMDE_FLOAT16_VALUE(  -1507.0), SIMDE_FLOAT16_VALUE(   3202.0), SIMDE_FLOAT16_VALUE(   1001.0), SIMDE_FLOAT16_VALUE(   4388.0) } },
+    { { SIMDE_FLOAT16_VALUE(   -47.62), SIMDE_FLOAT16_VALUE(     90.4), SIMDE_FLOAT16_VALUE(    34.12), SIMDE_FLOAT16_VALUE(     43.9),
+        SIMDE_FLOAT16_VALUE(     80.3), SIMDE_FLOAT16_VALUE(    -56.1), SIMDE_FLOAT16_VALUE(   -12.42), SIMDE_FLOAT16_VALUE(   -26.25),
+        SIMDE_FLOAT16_VALUE(     2.78), SIMDE_FLOAT16_VALUE(   -16.31), SIMDE_FLOAT16_VALUE(  -13.234), SIMDE_FLOAT16_VALUE(    87.56),
+        SIMDE_FLOAT16_VALUE(     99.8), SIMDE_FLOAT16_VALUE(    -92.9), SIMDE_FLOAT16_VALUE(   -61.97), SIMDE_FLOAT16_VALUE(    95.75) },
+      { SIMDE_FLOAT16_VALUE(     98.2), SIMDE_FLOAT16_VALUE(    -39.4), SIMDE_FLOAT16_VALUE(   -16.19), SIMDE_FLOAT16_VALUE(    -97.1),
+        SIMDE_FLOAT16_VALUE(   -58.34), SIMDE_FLOAT16_VALUE(     76.7), SIMDE_FLOAT16_VALUE(   -98.94), SIMDE_FLOAT16_VALUE(   -2.268),
+        SIMDE_FLOAT16_VALUE(    27.97), SIMDE_FLOAT16_VALUE(     66.9), SIMDE_FLOAT16_VALUE(    76.75), SIMDE_FLOAT16_VALUE(   -39.56),
+        SIMDE_FLOAT16_VALUE(    37.47), SIMDE_FLOAT16_VALUE(   -21.94), SIMDE_FLOAT16_VALUE(   -16.23), SIMDE_FLOAT16_VALUE(    -5.81) },
+      { SIMDE_FLOAT16_VALUE(  -4676.0), SIMDE_FLOAT16_VALUE(  -3562.0), SIMDE_FLOAT16_VALUE(   -552.5), SIMDE_FLOAT16_VALUE(  -4264.0),
+        SIMDE_FLOAT16_VALUE(  -4684.0), SIMDE_FLOAT16_VALUE(  -4300.0), SIMDE_FLOAT16_VALUE(   1229.0), SIMDE_FLOAT16_VALUE(    59.53),
+        SIMDE_FLOAT16_VALUE(    77.75), SIMDE_FLOAT16_VALUE(  -1091.0), SIMDE_FLOAT16_VALUE(  -1015.5), SIMDE_FLOAT16_VALUE(  -3464.0),
+        SIMDE_FLOAT16_VALUE(   3740.0), SIMDE_FLOAT16_VALUE(   2037.0), SIMDE_FLOAT16_VALUE(   1006.0), SIMDE_FLOAT16_VALUE(   -556.0) } },
+    { { SIMDE_FLOAT16_VALUE(    -70.8), SIMDE_FLOAT16_VALUE(   -56.16), SIMDE_FLOAT16_VALUE(    46.56), SIMDE_FLOAT16_VALUE(   -7.438),
+        SIMDE_FLOAT16_VALUE(   0.8467), SIMDE_FLOAT16_VALUE(    38.22), SIMDE_FLOAT16_VALUE(     71.2), SIMDE_FLOAT16_VALUE(     74.7),
+        SIMDE_FLOAT16_VALUE(     76.9), SIMDE_FLOAT16_VALUE(    49.97), SIMDE_FLOAT16_VALUE(    65.25), SIMDE_FLOAT16_VALUE(    46.88),
+        SIMDE_FLOAT16_VALUE(   -87.44), SIMDE_FLOAT16_VALUE(     98.0), SIMDE_FLOAT16_VALUE(   -39.28), SIMDE_FLOAT16_VALUE(   -1.505) },
+      { SIMDE_FLOAT16_VALUE(   -31.58), SIMDE_FLOAT16_VALUE(    14.52), SIMDE_FLOAT16_VALUE(    -21.8), SIMDE_FLOAT16_VALUE(   -22.08),
+        SIMDE_FLOAT16_VALUE(   -37.16), SIMDE_FLOAT16_VALUE(     89.5), SIMDE_FLOAT16_VALUE(    -74.2), SIMDE_FLOAT16_VALUE(    21.58),
+        SIMDE_FLOAT16_VALUE(    92.44), SIMDE_FLOAT16_VALUE(   -44.03), SIMDE_FLOAT16_VALUE(    -69.9), SIMDE_FLOAT16_VALUE(    4.066),
+        SIMDE_FLOAT16_VALUE(    29.44), SIMDE_FLOAT16_VALUE(     63.8), SIMDE_FLOAT16_VALUE(     88.3), SIMDE_FLOAT16_VALUE(    -82.8) },
+      { SIMDE_FLOAT16_VALUE(   2236.0), SIMDE_FLOAT16_VALUE(   -815.5), SIMDE_FLOAT16_VALUE(  -1015.0), SIMDE_FLOAT16_VALUE(    164.2),
+        SIMDE_FLOAT16_VALUE(   -31.45), SIMDE_FLOAT16_VALUE(   3420.0), SIMDE_FLOAT16_VALUE(  -5280.0), SIMDE_FLOAT16_VALUE(   1612.0),
+        SIMDE_FLOAT16_VALUE(   7108.0), SIMDE_FLOAT16_VALUE(  -2200.0), SIMDE_FLOAT16_VALUE(  -4560.0), SIMDE_FLOAT16_VALUE(    190.6),
+        SIMDE_FLOAT16_VALUE(  -2574.0), SIMDE_FLOAT16_VALUE(   6252.0), SIMDE_FLOAT16_VALUE(  -3470.0), SIMDE_FLOAT16_VALUE(    124.6) } },
+    { { SIMDE_FLOAT16_VALUE(   -12.35), SIMDE_FLOAT16_VALUE(   -48.12), SIMDE_FLOAT16_VALUE(   -92.56), SIMDE_FLOAT16_VALUE(    1.676),
+        SIMDE_FLOAT16_VALUE(   -96.44), SIMDE_FLOAT16_VALUE(    59.12), SIMDE_FLOAT16_VALUE(   -75.25), SIMDE_FLOAT16_VALUE(     32.9),
+        SIMDE_FLOAT16_VALUE(   -79.44), SIMDE_FLOAT16_VALUE(   -36.12), SIMDE_FLOAT16_VALUE(   -79.44), SIMDE_FLOAT16_VALUE(     54.7),
+        SIMDE_FLOAT16_VALUE(    -64.9), SIMDE_FLOAT16_VALUE(     80.2), SIMDE_FLOAT16_VALUE(    34.56), SIMDE_FLOAT16_VALUE(    -26.2) },
+      { SIMDE_FLOAT16_VALUE(  -0.3777), SIMDE_FLOAT16_VALUE(    49.94), SIMDE_FLOAT16_VALUE(     37.4), SIMDE_FLOAT16_VALUE(   -60.66),
+        SIMDE_FLOAT16_VALUE(   -83.06), SIMDE_FLOAT16_VALUE(    -5.72), SIMDE_FLOAT16_VALUE(    17.36), SIMDE_FLOAT16_VALUE(     6.28),
+        SIMDE_FLOAT16_VALUE(    27.56), SIMDE_FLOAT16_VALUE(     66.2), SIMDE_FLOAT16_VALUE(   -26.92), SIMDE_FLOAT16_VALUE(    -94.2),
+        SIMDE_FLOAT16_VALUE(   -26.16), SIMDE_FLOAT16_VALUE(    62.44), SIMDE_FLOAT16_VALUE(     16.3), SIMDE_FLOAT16_VALUE(    -26.9) },
+      { SIMDE_FLOAT16_VALUE(    4.664), SIMDE_FLOAT16_VALUE(  -2404.0), SIMDE_FLOAT16_VALUE(  -3462.0), SIMDE_FLOAT16_VALUE(   -101.6),
+        SIMDE_FLOAT16_VALUE(   8012.0), SIMDE_FLOAT16_VALUE(   -338.0), SIMDE_FLOAT16_VALUE(  -1306.0), SIMDE_FLOAT16_VALUE(    206.8),
+        SIMDE_FLOAT16_VALUE(  -2190.0), SIMDE_FLOAT16_VALUE(  -2392.0), SIMDE_FLOAT16_VALUE(   2138.0), SIMDE_FLOAT16_VALUE(  -5152.0),
+        SIMDE_FLOAT16_VALUE(   1697.0), SIMDE_FLOAT16_VALUE(   5008.0), SIMDE_FLOAT16_VALUE(    563.5), SIMDE_FLOAT16_VALUE(    705.0) } },
+    { { SIMDE_FLOAT16_VALUE(   -47.28), SIMDE_FLOAT16_VALUE(    44.06), SIMDE_FLOAT16_VALUE(   -59.28), SIMDE_FLOAT16_VALUE(    71.75),
+        SIMDE_FLOAT16_VALUE(    21.16), SIMDE_FLOAT16_VALUE(    81.06), SIMDE_FLOAT16_VALUE(    18.16), SIMDE_FLOAT16_VALUE(    -93.9),
+        SIMDE_FLOAT16_VALUE(    39.66), SIMDE_FLOAT16_VALUE(    2.422), SIMDE_FLOAT16_VALUE(    43.16), SIMDE_FLOAT16_VALUE(     72.0),
+        SIMDE_FLOAT16_VALUE(    50.25), SIMDE_FLOAT16_VALUE(   -19.45), SIMDE_FLOAT16_VALUE(     76.5), SIMDE_FLOAT16_VALUE(   -43.88) },
+      { SIMDE_FLOAT16_VALUE(     3.33), SIMDE_FLOAT16_VALUE(    -84.6), SIMDE_FLOAT16_VALUE(    86.94), SIMDE_FLOAT16_VALUE(   -6.676),
+        SIMDE_FLOAT16_VALUE(    63.06), SIMDE_FLOAT16_VALUE(   -83.75), SIMDE_FLOAT16_VALUE(   -82.06), SIMDE_FLOAT16_VALUE(     89.3),
+        SIMDE_FLOAT16_VALUE(   -85.25), SIMDE_FLOAT16_VALUE(     2.45), SIMDE_FLOAT16_VALUE(    52.06), SIMDE_FLOAT16_VALUE(    51.38),
+        SIMDE_FLOAT16_VALUE(    79.06), SIMDE_FLOAT16_VALUE(     79.6), SIMDE_FLOAT16_VALUE(   -41.84), SIMDE_FLOAT16_VALUE(    44.12) },
+      { SIMDE_FLOAT16_VALUE(   -157.5), SIMDE_FLOAT16_VALUE(  -3728.0), SIMDE_FLOAT16_VALUE(  -5152.0), SIMDE_FLOAT16_VALUE(   -479.0),
+        SIMDE_FLOAT16_VALUE(   1334.0), SIMDE_FLOAT16_VALUE(  -6788.0), SIMDE_FLOAT16_VALUE(  -1490.0), SIMDE_FLOAT16_VALUE(  -8384.0),
+        SIMDE_FLOAT16_VALUE(  -3380.0), SIMDE_FLOAT16_VALUE(    5.934), SIMDE_FLOAT16_VALUE(   2246.0), SIMDE_FLOAT16_VALUE(   3700.0),
+        SIMDE_FLOAT16_VALUE(   3972.0), SIMDE_FLOAT16_VALUE(  -1549.0), SIMDE_FLOAT16_VALUE(  -3202.0), SIMDE_FLOAT16_VALUE(  -1936.0) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256h a = simde_mm256_loadu_ph(test_vec[i].a);
+    simde__m256h b = simde_mm256_loadu_ph(test_vec[i].b);
+    simde__m256h r = simde_mm256_mul_ph(a, b);
+    simde_test_x86_assert_equal_f16x16(r, simde_mm256_loadu_ph(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm512_mul_ph (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float16 a[32];
+    const simde_float16 b[32];
+    const simde_float16 r[32];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(   -77.94), SIMDE_FLOAT16_VALUE(    96.25), SIMDE_FLOAT16_VALUE(     91.5), SIMDE_FLOAT16_VALUE(    48.22),
+        SIMDE_FLOAT16_VALUE(   -60.66), SIMDE_FLOAT16_VALUE(   -60.78), SIMDE_FLOAT16_VALUE(   -35.22), SIMDE_FLOAT16_VALUE(     41.6),
+        SIMDE_FLOAT16_VALUE(     4.76), SIMDE_FLOAT16_VALUE(    -98.7), SIMDE_FLOAT16_VALUE(   -57.03), SIMDE_FLOAT16_VALUE(    -68.0),
+        SIMDE_FLOAT16_VALUE(   -94.44), SIMDE_FLOAT16_VALUE(     87.3), SIMDE_FLOAT16_VALUE(    -93.9), SIMDE_FLOAT16_VALUE(    26.58),
+        SIMDE_FLOAT16_VALUE(    89.56), SIMDE_FLOAT16_VALUE(    -5.61), SIMDE_FLOAT16_VALUE(   -65.75), SIMDE_FLOAT16_VALUE(    39.75),
+        SIMDE_FLOAT16_VALUE(    67.75), SIMDE_FLOAT16_VALUE(     4.78), SIMDE_FLOAT16_VALUE(     6.78), SIMDE_FLOAT16_VALUE(     76.4),
+        SIMDE_FLOAT16_VALUE(     90.8), SIMDE_FLOAT16_VALUE(     72.3), SIMDE_FLOAT16_VALUE(     91.9), SIMDE_FLOAT16_VALUE(    94.56),
+        SIMDE_FLOAT16_VALUE(    20.28), SIMDE_FLOAT16_VALUE(    24.81), SIMDE_FLOAT16_VALUE(    23.38), SIMDE_FLOAT16_VALUE(   -51.72) },
+      { SIMDE_FLOAT16_VALUE(     73.3), SIMDE_FLOAT16_VALUE(    -25.2), SIMDE_FLOAT16_VALUE(    -39.6), SIMDE_FLOAT16_VALUE(    14.16),
+        SIMDE_FLOAT16_VALUE(     17.8), SIMDE_FLOAT16_VALUE(   -55.16), SIMDE_FLOAT16_VALUE(    -64.1), SIMDE_FLOAT16_VALUE(     71.7),
+        SIMDE_FLOAT16_VALUE(    -61.3), SIMDE_FLOAT16_VALUE(    39.28), SIMDE_FLOAT16_VALUE(    -13.3), SIMDE_FLOAT16_VALUE(    12.26),
+        SIMDE_FLOAT16_VALUE(    49.06), SIMDE_FLOAT16_VALUE(    20.56), SIMDE_FLOAT16_VALUE(    -90.6), SIMDE_FLOAT16_VALUE(   -46.12),
+        SIMDE_FLOAT16_VALUE(    48.88), SIMDE_FLOAT16_VALUE(   -30.34), SIMDE_FLOAT16_VALUE(    11.53), SIMDE_FLOAT16_VALUE(    18.45),
+        SIMDE_FLOAT16_VALUE(   -63.53), SIMDE_FLOAT16_VALUE(    99.94), SIMDE_FLOAT16_VALUE(    -98.5), SIMDE_FLOAT16_VALUE(   -53.34),
+        SIMDE_FLOAT16_VALUE(     81.8), SIMDE_FLOAT16_VALUE(    -88.4), SIMDE_FLOAT16_VALUE(    -70.6), SIMDE_FLOAT16_VALUE(    -78.9),
+        SIMDE_FLOAT16_VALUE(     41.3), SIMDE_FLOAT16_VALUE(    82.44), SIMDE_FLOAT16_VALUE(   -22.69), SIMDE_FLOAT16_VALUE(    57.53) },
+      { SIMDE_FLOAT16_VALUE(  -5712.0), SIMDE_FLOAT16_VALUE(  -2426.0), SIMDE_FLOAT16_VALUE(  -3622.0), SIMDE_FLOAT16_VALUE(    682.5),
+        SIMDE_FLOAT16_VALUE(  -1079.0), SIMDE_FLOAT16_VALUE(   3352.0), SIMDE_FLOAT16_VALUE(   2258.0), SIMDE_FLOAT16_VALUE(   2982.0),
+        SIMDE_FLOAT16_VALUE(   -292.0), SIMDE_FLOAT16_VALUE(  -3876.0), SIMDE_FLOAT16_VALUE(    758.5), SIMDE_FLOAT16_VALUE(   -833.5),
+        SIMDE_FLOAT16_VALUE(  -4632.0), SIMDE_FLOAT16_VALUE(   1795.0), SIMDE_FLOAT16_VALUE(   8504.0), SIMDE_FLOAT16_VALUE(  -1226.0),
+        SIMDE_FLOAT16_VALUE(   4376.0), SIMDE_FLOAT16_VALUE(    170.2), SIMDE_FLOAT16_VALUE(   -758.0), SIMDE_FLOAT16_VALUE(    733.5),
+        SIMDE_FLOAT16_VALUE(  -4304.0), SIMDE_FLOAT16_VALUE(    477.8), SIMDE_FLOAT16_VALUE(   -668.0), SIMDE_FLOAT16_VALUE(  -4074.0),
+        SIMDE_FLOAT16_VALUE(   7428.0), SIMDE_FLOAT16_VALUE(  -6392.0), SIMDE_FLOAT16_VALUE(  -6488.0), SIMDE_FLOAT16_VALUE(  -7460.0),
+        SIMDE_FLOAT16_VALUE(    838.0), SIMDE_FLOAT16_VALUE(   2045.0), SIMDE_FLOAT16_VALUE(   -530.5), SIMDE_FLOAT16_VALUE(  -2976.0) } },
+    { { SIMDE_FLOAT16_VALUE(    -55.0), SIMDE_FLOAT16_VALUE(     58.2), SIMDE_FLOAT16_VALUE(   -21.36), SIMDE_FLOAT16_VALUE(     76.0),
+        SIMDE_FLOAT16_VALUE(   -94.25), SIMDE_FLOAT16_VALUE(   -65.25), SIMDE_FLOAT16_VALUE(   -2.994), SIMDE_FLOAT16_VALUE(   -43.75),
+        SIMDE_FLOAT16_VALUE(   -83.44), SIMDE_FLOAT16_VALUE(     78.5), SIMDE_FLOAT16_VALUE(    -87.0), SIMDE_FLOAT16_VALUE(    37.12),
+        SIMDE_FLOAT16_VALUE(    -99.3), SIMDE_FLOAT16_VALUE(   -68.56), SIMDE_FLOAT16_VALUE(    -95.8), SIMDE_FLOAT16_VALUE(     7.11),
+        SIMDE_FLOAT16_VALUE(    52.47), SIMDE_FLOAT16_VALUE(   -46.12), SIMDE_FLOAT16_VALUE(    -42.8), SIMDE_FLOAT16_VALUE(   -47.28),
+        SIMDE_FLOAT16_VALUE(    87.94), SIMDE_FLOAT16_VALUE(    58.84), SIMDE_FLOAT16_VALUE(    45.38), SIMDE_FLOAT16_VALUE(   -89.75),
+        SIMDE_FLOAT16_VALUE(   -75.56), SIMDE_FLOAT16_VALUE(   -38.97), SIMDE_FLOAT16_VALUE(    2.719), SIMDE_FLOAT16_VALUE(     66.6),
+        SIMDE_FLOAT16_VALUE(     46.7), SIMDE_FLOAT16_VALUE(     18.2), SIMDE_FLOAT16_VALUE(   -39.78), SIMDE_FLOAT16_VALUE(    -60.9) },
+      { SIMDE_FLOAT16_VALUE(    30.81), SIMDE_FLOAT16_VALUE(     97.1), SIMDE_FLOAT16_VALUE(   -44.56), SIMDE_FLOAT16_VALUE(   -15.78),
+        SIMDE_FLOAT16_VALUE(    73.94), SIMDE_FLOAT16_VALUE(    99.06), SIMDE_FLOAT16_VALUE(   -26.03), SIMDE_FLOAT16_VALUE(   -56.66),
+        SIMDE_FLOAT16_VALUE(     82.6), SIMDE_FLOAT16_VALUE(    73.94), SIMDE_FLOAT16_VALUE(    8.195), SIMDE_FLOAT16_VALUE(   -40.72),
+        SIMDE_FLOAT16_VALUE(    36.28), SIMDE_FLOAT16_VALUE(    2.848), SIMDE_FLOAT16_VALUE(    -15.5), SIMDE_FLOAT16_VALUE(    -88.2),
+        SIMDE_FLOAT16_VALUE(   -45.94), SIMDE_FLOAT16_VALUE(   -60.06), SIMDE_FLOAT16_VALUE(     66.2), SIMDE_FLOAT16_VALUE(    42.47),
+        SIMDE_FLOAT16_VALUE(   -38.03), SIMDE_FLOAT16_VALUE(   -61.12), SIMDE_FLOAT16_VALUE(   -78.44), SIMDE_FLOAT16_VALUE(    15.63),
+        SIMDE_FLOAT16_VALUE(    -96.1), SIMDE_FLOAT16_VALUE(   -7.973), SIMDE_FLOAT16_VALUE(    -50.1), SIMDE_FLOAT16_VALUE(   -84.06),
+        SIMDE_FLOAT16_VALUE(   -41.72), SIMDE_FLOAT16_VALUE(    93.94), SIMDE_FLOAT16_VALUE(   -11.67), SIMDE_FLOAT16_VALUE(     65.7) },
+      { SIMDE_FLOAT16_VALUE(  -1695.0), SIMDE_FLOAT16_VALUE(   5652.0), SIMDE_FLOAT16_VALUE(    952.0), SIMDE_FLOAT16_VALUE(  -1199.0),
+        SIMDE_FLOAT16_VALUE(  -6968.0), SIMDE_FLOAT16_VALUE(  -6464.0), SIMDE_FLOAT16_VALUE(    77.94), SIMDE_FLOAT16_VALUE(   2478.0),
+        SIMDE_FLOAT16_VALUE(  -6896.0), SIMDE_FLOAT16_VALUE(   5804.0), SIMDE_FLOAT16_VALUE(   -713.0), SIMDE_FLOAT16_VALUE(  -1512.0),
+        SIMDE_FLOAT16_VALUE(  -3604.0), SIMDE_FLOAT16_VALUE(   -195.2), SIMDE_FLOAT16_VALUE(   1485.0), SIMDE_FLOAT16_VALUE(   -627.0),
+        SIMDE_FLOAT16_VALUE(  -2410.0), SIMDE_FLOAT16_VALUE(   2770.0), SIMDE_FLOAT16_VALUE(  -2834.0), SIMDE_FLOAT16_VALUE(  -2008.0),
+        SIMDE_FLOAT16_VALUE(  -3344.0), SIMDE_FLOAT16_VALUE(  -3596.0), SIMDE_FLOAT16_VALUE(  -3560.0), SIMDE_FLOAT16_VALUE(  -1403.0),
+        SIMDE_FLOAT16_VALUE(   7264.0), SIMDE_FLOAT16_VALUE(    310.8), SIMDE_FLOAT16_VALUE(   -136.2), SIMDE_FLOAT16_VALUE(  -5600.0),
+        SIMDE_FLOAT16_VALUE(  -1948.0), SIMDE_FLOAT16_VALUE(   1710.0), SIMDE_FLOAT16_VALUE(    464.2), SIMDE_FLOAT16_VALUE(  -4000.0) } },
+    { { SIMDE_FLOAT16_VALUE(    68.75), SIMDE_FLOAT16_VALUE(     63.0), SIMDE_FLOAT16_VALUE(    24.52), SIMDE_FLOAT16_VALUE(    48.62),
+        SIMDE_FLOAT16_VALUE(   -9.234), SIMDE_FLOAT16_VALUE(    27.22), SIMDE_FLOAT16_VALUE(   -59.25), SIMDE_FLOAT16_VALUE(   -47.38),
+        SIMDE_FLOAT16_VALUE(    14.11), SIMDE_FLOAT16_VALUE(  -0.3174), SIMDE_FLOAT16_VALUE(     49.4), SIMDE_FLOAT16_VALUE(   -40.12),
+        SIMDE_FLOAT16_VALUE(   -64.75), SIMDE_FLOAT16_VALUE(   -37.03), SIMDE_FLOAT16_VALUE(     26.2), SIMDE_FLOAT16_VALUE(    -79.3),
+        SIMDE_FLOAT16_VALUE(    46.84), SIMDE_FLOAT16_VALUE(     96.7), SIMDE_FLOAT16_VALUE(   -39.78), SIMDE_FLOAT16_VALUE(    5.598),
+        SIMDE_FLOAT16_VALUE(   -52.84), SIMDE_FLOAT16_VALUE(     68.8), SIMDE_FLOAT16_VALUE(    23.05), SIMDE_FLOAT16_VALUE(   -57.56),
+        SIMDE_FLOAT16_VALUE(     78.2), SIMDE_FLOAT16_VALUE(    -25.2), SIMDE_FLOAT16_VALUE(     77.6), SIMDE_FLOAT16_VALUE(   -31.52),
+        SIMDE_FLOAT16_VALUE(     99.1), SIMDE_FLOAT16_VALUE(    52.78), SIMDE_FLOAT16_VALUE(     97.1), SIMDE_FLOAT16_VALUE(   -66.44) },
+      { SIMDE_FLOAT16_VALUE(   -8.195), SIMDE_FLOAT16_VALUE(    18.55), SIMDE_FLOAT16_VALUE(    67.56), SIMDE_FLOAT16_VALUE(    6.023),
+        SIMDE_FLOAT16_VALUE(    -60.1), SIMDE_FLOAT16_VALUE(    36.53), SIMDE_FLOAT16_VALUE(    -54.4), SIMDE_FLOAT16_VALUE(    -88.2),
+        SIMDE_FLOAT16_VALUE(   -14.93), SIMDE_FLOAT16_VALUE(    15.16), SIMDE_FLOAT16_VALUE(  0.08105), SIMDE_FLOAT16_VALUE(   -11.52),
+        SIMDE_FLOAT16_VALUE(    10.88), SIMDE_FLOAT16_VALUE(     94.9), SIMDE_FLOAT16_VALUE(   -11.86), SIMDE_FLOAT16_VALUE(     87.3),
+        SIMDE_FLOAT16_VALUE(   -39.12), SIMDE_FLOAT16_VALUE(   -5.883), SIMDE_FLOAT16_VALUE(     98.3), SIMDE_FLOAT16_VALUE(    54.12),
+        SIMDE_FLOAT16_VALUE(    -55.9), SIMDE_FLOAT16_VALUE(    80.75), SIMDE_FLOAT16_VALUE(    -84.9), SIMDE_FLOAT16_VALUE(   -96.44),
+        SIMDE_FLOAT16_VALUE(   -24.53), SIMDE_FLOAT16_VALUE(     4.71), SIMDE_FLOAT16_VALUE(    62.25), SIMDE_FLOAT16_VALUE(     95.5),
+        SIMDE_FLOAT16_VALUE(    87.44), SIMDE_FLOAT16_VALUE(    46.34), SIMDE_FLOAT16_VALUE(   -80.56), SIMDE_FLOAT16_VALUE(     98.9) },
+      { SIMDE_FLOAT16_VALUE(   -563.5), SIMDE_FLOAT16_VALUE(   1168.0), SIMDE_FLOAT16_VALUE(   1656.0), SIMDE_FLOAT16_VALUE(    293.0),
+        SIMDE_FLOAT16_VALUE(    555.0), SIMDE_FLOAT16_VALUE(    994.5), SIMDE_FLOAT16_VALUE(   3224.0), SIMDE_FLOAT16_VALUE(   4176.0),
+        SIMDE_FLOAT16_VALUE(   -210.6), SIMDE_FLOAT16_VALUE(    -4.81), SIMDE_FLOAT16_VALUE(    4.004), SIMDE_FLOAT16_VALUE(    462.5),
+        SIMDE_FLOAT16_VALUE(   -704.5), SIMDE_FLOAT16_VALUE(  -3514.0), SIMDE_FLOAT16_VALUE(   -310.8), SIMDE_FLOAT16_VALUE(  -6924.0),
+        SIMDE_FLOAT16_VALUE(  -1833.0), SIMDE_FLOAT16_VALUE(   -569.0), SIMDE_FLOAT16_VALUE(  -3910.0), SIMDE_FLOAT16_VALUE(    303.0),
+        SIMDE_FLOAT16_VALUE(   2954.0), SIMDE_FLOAT16_VALUE(   5556.0), SIMDE_FLOAT16_VALUE(  -1956.0), SIMDE_FLOAT16_VALUE(   5552.0),
+        SIMDE_FLOAT16_VALUE(  -1918.0), SIMDE_FLOAT16_VALUE(  -118.75), SIMDE_FLOAT16_VALUE(   4832.0), SIMDE_FLOAT16_VALUE(  -3010.0),
+        SIMDE_FLOAT16_VALUE(   8664.0), SIMDE_FLOAT16_VALUE(   2446.0), SIMDE_FLOAT16_VALUE(  -7824.0), SIMDE_FLOAT16_VALUE(  -6568.0) } },
+    { { SIMDE_FLOAT16_VALUE(     80.8), SIMDE_FLOAT16_VALUE(   -14.77), SIMDE_FLOAT16_VALUE(     62.6), SIMDE_FLOAT16_VALUE(    -39.8),
+        SIMDE_FLOAT16_VALUE(    29.98), SIMDE_FLOAT16_VALUE(    11.41), SIMDE_FLOAT16_VALUE(   -73.06), SIMDE_FLOAT16_VALUE(   -3.371),
+        SIMDE_FLOAT16_VALUE(   -43.44), SIMDE_FLOAT16_VALUE(    -71.2), SIMDE_FLOAT16_VALUE(  -12.375), SIMDE_FLOAT16_VALUE(    -4.23),
+        SIMDE_FLOAT16_VALUE(   -49.34), SIMDE_FLOAT16_VALUE(   -7.875), SIMDE_FLOAT16_VALUE(    -83.7), SIMDE_FLOAT16_VALUE(    -91.1),
+        SIMDE_FLOAT16_VALUE(    -8.48), SIMDE_FLOAT16_VALUE(    5.836), SIMDE_FLOAT16_VALUE(   -40.66), SIMDE_FLOAT16_VALUE(    33.47),
+        SIMDE_FLOAT16_VALUE(    22.36), SIMDE_FLOAT16_VALUE(    -30.6), SIMDE_FLOAT16_VALUE(    14.67), SIMDE_FLOAT16_VALUE(    -88.4),
+        SIMDE_FLOAT16_VALUE(     88.6), SIMDE_FLOAT16_VALUE(   -7.156), SIMDE_FLOAT16_VALUE(   -42.97), SIMDE_FLOAT16_VALUE(    11.59),
+        SIMDE_FLOAT16_VALUE(    57.88), SIMDE_FLOAT16_VALUE(     27.5), SIMDE_FLOAT16_VALUE(    85.25), SIMDE_FLOAT16_VALUE(   -27.42) },
+      { SIMDE_FLOAT16_VALUE(   -23.11), SIMDE_FLOAT16_VALUE(   -75.44), SIMDE_FLOAT16_VALUE(     86.2), SIMDE_FLOAT16_VALUE(   -71.75),
+        SIMDE_FLOAT16_VALUE(    -97.9), SIMDE_FLOAT16_VALUE(    4.258), SIMDE_FLOAT16_VALUE(    -33.9), SIMDE_FLOAT16_VALUE(   -54.34),
+        SIMDE_FLOAT16_VALUE(    -88.2), SIMDE_FLOAT16_VALUE(    36.78), SIMDE_FLOAT16_VALUE(    -87.8), SIMDE_FLOAT16_VALUE(     73.5),
+        SIMDE_FLOAT16_VALUE(   -22.27), SIMDE_FLOAT16_VALUE(    -4.92), SIMDE_FLOAT16_VALUE(    59.88), SIMDE_FLOAT16_VALUE(    -38.3),
+        SIMDE_FLOAT16_VALUE(   -1.259), SIMDE_FLOAT16_VALUE(   -28.03), SIMDE_FLOAT16_VALUE(    53.97), SIMDE_FLOAT16_VALUE(     91.3),
+        SIMDE_FLOAT16_VALUE(   -12.62), SIMDE_FLOAT16_VALUE(   -52.84), SIMDE_FLOAT16_VALUE(    46.75), SIMDE_FLOAT16_VALUE(    45.47),
+        SIMDE_FLOAT16_VALUE(     81.8), SIMDE_FLOAT16_VALUE(    96.25), SIMDE_FLOAT16_VALUE(   -43.88), SIMDE_FLOAT16_VALUE(     90.3),
+        SIMDE_FLOAT16_VALUE(     36.9), SIMDE_FLOAT16_VALUE(    31.31), SIMDE_FLOAT16_VALUE(    39.12), SIMDE_FLOAT16_VALUE(    -82.4) },
+      { SIMDE_FLOAT16_VALUE(  -1868.0), SIMDE_FLOAT16_VALUE(   1114.0), SIMDE_FLOAT16_VALUE(   5396.0), SIMDE_FLOAT16_VALUE(   2856.0),
+        SIMDE_FLOAT16_VALUE(  -2934.0), SIMDE_FLOAT16_VALUE(    48.56), SIMDE_FLOAT16_VALUE(   2478.0), SIMDE_FLOAT16_VALUE(    183.2),
+        SIMDE_FLOAT16_VALUE(   3830.0), SIMDE_FLOAT16_VALUE(  -2618.0), SIMDE_FLOAT16_VALUE(   1087.0), SIMDE_FLOAT16_VALUE(   -311.0),
+        SIMDE_FLOAT16_VALUE(   1099.0), SIMDE_FLOAT16_VALUE(    38.75), SIMDE_FLOAT16_VALUE(  -5012.0), SIMDE_FLOAT16_VALUE(   3492.0),
+        SIMDE_FLOAT16_VALUE(    10.67), SIMDE_FLOAT16_VALUE(   -163.6), SIMDE_FLOAT16_VALUE(  -2194.0), SIMDE_FLOAT16_VALUE(   3056.0),
+        SIMDE_FLOAT16_VALUE(   -282.0), SIMDE_FLOAT16_VALUE(   1617.0), SIMDE_FLOAT16_VALUE(    686.0), SIMDE_FLOAT16_VALUE(  -4018.0),
+        SIMDE_FLOAT16_VALUE(   7252.0), SIMDE_FLOAT16_VALUE(   -689.0), SIMDE_FLOAT16_VALUE(   1885.0), SIMDE_FLOAT16_VALUE(   1047.0),
+        SIMDE_FLOAT16_VALUE(   2136.0), SIMDE_FLOAT16_VALUE(    861.0), SIMDE_FLOAT16_VALUE(   3336.0), SIMDE_FLOAT16_VALUE(   2258.0) } },
+    { { SIMDE_FLOAT16_VALUE(   -27.56), SIMDE_FLOAT16_VALUE(   -79.75), SIMDE_FLOAT16_VALUE(    -63.8), SIMDE_FLOAT16_VALUE(   -63.62),
+        SIMDE_FLOAT16_VALUE(   -36.56), SIMDE_FLOAT16_VALUE(   -43.88), SIMDE_FLOAT16_VALUE(    72.06), SIMDE_FLOAT16_VALUE(   -27.89),
+        SIMDE_FLOAT16_VALUE(   -98.44), SIMDE_FLOAT16_VALUE(    -90.8), SIMDE_FLOAT16_VALUE(    -8.39), SIMDE_FLOAT16_VALUE(    -88.3),
+        SIMDE_FLOAT16_VALUE(   -66.94), SIMDE_FLOAT16_VALUE(     49.6), SIMDE_FLOAT16_VALUE(    3.883), SIMDE_FLOAT16_VALUE(    36.84),
+        SIMDE_FLOAT16_VALUE(    24.83), SIMDE_FLOAT16_VALUE(    44.22), SIMDE_FLOAT16_VALUE(     48.8), SIMDE_FLOAT16_VALUE(   -23.06),
+        SIMDE_FLOAT16_VALUE(    -80.8), SIMDE_FLOAT16_VALUE(   -14.78), SIMDE_FLOAT16_VALUE(   -31.25), SIMDE_FLOAT16_VALUE(   -62.22),
+        SIMDE_FLOAT16_VALUE(   -46.72), SIMDE_FLOAT16_VALUE(    -92.6), SIMDE_FLOAT16_VALUE(   -78.75), SIMDE_FLOAT16_VALUE(     48.7),
+        SIMDE_FLOAT16_VALUE(   -15.46), SIMDE_FLOAT16_VALUE(   -53.44), SIMDE_FLOAT16_VALUE(    41.12), SIMDE_FLOAT16_VALUE(   10.164) },
+      { SIMDE_FLOAT16_VALUE(     48.0), SIMDE_FLOAT16_VALUE(    45.75), SIMDE_FLOAT16_VALUE(    -79.4), SIMDE_FLOAT16_VALUE(    -40.5),
+        SIMDE_FLOAT16_VALUE(     78.1), SIMDE_FLOAT16_VALUE(    47.84), SIMDE_FLOAT16_VALUE(    82.25), SIMDE_FLOAT16_VALUE(     60.1),
+        SIMDE_FLOAT16_VALUE(     90.2), SIMDE_FLOAT16_VALUE(    1.275), SIMDE_FLOAT16_VALUE(   -17.78), SIMDE_FLOAT16_VALUE(     69.4),
+        SIMDE_FLOAT16_VALUE(     69.0), SIMDE_FLOAT16_VALUE(     7.65), SIMDE_FLOAT16_VALUE(    48.78), SIMDE_FLOAT16_VALUE(    94.56),
+        SIMDE_FLOAT16_VALUE(    -82.6), SIMDE_FLOAT16_VALUE(   -80.25), SIMDE_FLOAT16_VALUE(    7.438), SIMDE_FLOAT16_VALUE(     73.3),
+        SIMDE_FLOAT16_VALUE(     80.1), SIMDE_FLOAT16_VALUE(   -16.88), SIMDE_FLOAT16_VALUE(     86.2), SIMDE_FLOAT16_VALUE(   -9.445),
+        SIMDE_FLOAT16_VALUE(     95.3), SIMDE_FLOAT16_VALUE(    -81.8), SIMDE_FLOAT16_VALUE(    2.023), SIMDE_FLOAT16_VALUE(    23.34),
+        SIMDE_FLOAT16_VALUE(    10.47), SIMDE_FLOAT16_VALUE(    -71.8), SIMDE_FLOAT16_VALUE(     31.0), SIMDE_FLOAT16_VALUE(    24.84) },
+      { SIMDE_FLOAT16_VALUE(  -1323.0), SIMDE_FLOAT16_VALUE(  -3648.0), SIMDE_FLOAT16_VALUE(   5064.0), SIMDE_FLOAT16_VALUE(   2576.0),
+        SIMDE_FLOAT16_VALUE(  -2856.0), SIMDE_FLOAT16_VALUE(  -2100.0), SIMDE_FLOAT16_VALUE(   5928.0), SIMDE_FLOAT16_VALUE(  -1676.0),
+        SIMDE_FLOAT16_VALUE(  -8880.0), SIMDE_FLOAT16_VALUE(   -115.8), SIMDE_FLOAT16_VALUE(    149.2), SIMDE_FLOAT16_VALUE(  -6128.0),
+        SIMDE_FLOAT16_VALUE(  -4620.0), SIMDE_FLOAT16_VALUE(    379.2), SIMDE_FLOAT16_VALUE(    189.4), SIMDE_FLOAT16_VALUE(   3484.0),
+        SIMDE_FLOAT16_VALUE(  -2052.0), SIMDE_FLOAT16_VALUE(  -3548.0), SIMDE_FLOAT16_VALUE(    363.0), SIMDE_FLOAT16_VALUE(  -1691.0),
+        SIMDE_FLOAT16_VALUE(  -6476.0), SIMDE_FLOAT16_VALUE(    249.4), SIMDE_FLOAT16_VALUE(  -2694.0), SIMDE_FLOAT16_VALUE(    587.5),
+        SIMDE_FLOAT16_VALUE(  -4452.0), SIMDE_FLOAT16_VALUE(   7576.0), SIMDE_FLOAT16_VALUE(   -159.4), SIMDE_FLOAT16_VALUE(   1137.0),
+        SIMDE_FLOAT16_VALUE(   -161.9), SIMDE_FLOAT16_VALUE(   3838.0), SIMDE_FLOAT16_VALUE(   1275.0), SIMDE_FLOAT16_VALUE(    252.5) } },
+    { { SIMDE_FLOAT16_VALUE(     67.4), SIMDE_FLOAT16_VALUE(     91.5), SIMDE_FLOAT16_VALUE(  -13.195), SIMDE_FLOAT16_VALUE(    29.22),
+        SIMDE_FLOAT16_VALUE(   -1.414), SIMDE_FLOAT16_VALUE(     68.9), SIMDE_FLOAT16_VALUE(   -47.44), SIMDE_FLOAT16_VALUE(    -81.7),
+        SIMDE_FLOAT16_VALUE(   -23.16), SIMDE_FLOAT16_VALUE(    48.16), SIMDE_FLOAT16_VALUE(     33.2), SIMDE_FLOAT16_VALUE(     92.7),
+        SIMDE_FLOAT16_VALUE(    79.44), SIMDE_FLOAT16_VALUE(    65.25), SIMDE_FLOAT16_VALUE(   -92.56), SIMDE_FLOAT16_VALUE(    99.75),
+        SIMDE_FLOAT16_VALUE(    -60.5), SIMDE_FLOAT16_VALUE(   -65.25), SIMDE_FLOAT16_VALUE(   -31.78), SIMDE_FLOAT16_VALUE(   -11.82),
+        SIMDE_FLOAT16_VALUE(   -1.221), SIMDE_FLOAT16_VALUE(      5.7), SIMDE_FLOAT16_VALUE(    56.88), SIMDE_FLOAT16_VALUE(   -42.16),
+        SIMDE_FLOAT16_VALUE(    1.303), SIMDE_FLOAT16_VALUE(    37.12), SIMDE_FLOAT16_VALUE(    1.142), SIMDE_FLOAT16_VALUE(     93.8),
+        SIMDE_FLOAT16_VALUE(    88.56), SIMDE_FLOAT16_VALUE(    6.324), SIMDE_FLOAT16_VALUE(     78.6), SIMDE_FLOAT16_VALUE(    39.56) },
+      { SIMDE_FLOAT16_VALUE(    43.22), SIMDE_FLOAT16_VALUE(    -94.2), SIMDE_FLOAT16_VALUE(     73.4), SIMDE_FLOAT16_VALUE(   -51.88),
+        SIMDE_FLOAT16_VALUE(   -21.19), SIMDE_FLOAT16_VALUE(     57.0), SIMDE_FLOAT16_VALUE(   -83.44), SIMDE_FLOAT16_VALUE(   -52.25),
+        SIMDE_FLOAT16_VALUE(    1.775), SIMDE_FLOAT16_VALUE(     77.7), SIMDE_FLOAT16_VALUE(   -36.66), SIMDE_FLOAT16_VALUE(    -79.5),
+        SIMDE_FLOAT16_VALUE(     34.4), SIMDE_FLOAT16_VALUE(   0.2334), SIMDE_FLOAT16_VALUE(    48.53), SIMDE_FLOAT16_VALUE(   -42.44),
+        SIMDE_FLOAT16_VALUE(   -74.25), SIMDE_FLOAT16_VALUE(   -6.836), SIMDE_FLOAT16_VALUE(    -54.5), SIMDE_FLOAT16_VALUE(   -6.312),
+        SIMDE_FLOAT16_VALUE(  -13.914), SIMDE_FLOAT16_VALUE(    31.92), SIMDE_FLOAT16_VALUE(    -94.3), SIMDE_FLOAT16_VALUE(    -97.7),
+        SIMDE_FLOAT16_VALUE(    -70.1), SIMDE_FLOAT16_VALUE(    60.66), SIMDE_FLOAT16_VALUE(   -8.266), SIMDE_FLOAT16_VALUE(    70.75),
+        SIMDE_FLOAT16_VALUE(    53.47), SIMDE_FLOAT16_VALUE(    21.23), SIMDE_FLOAT16_VALUE(    92.75), SIMDE_FLOAT16_VALUE(    34.97) },
+      { SIMDE_FLOAT16_VALUE(   2912.0), SIMDE_FLOAT16_VALUE(  -8616.0), SIMDE_FLOAT16_VALUE(   -968.0), SIMDE_FLOAT16_VALUE(  -1516.0),
+        SIMDE_FLOAT16_VALUE(    29.95), SIMDE_FLOAT16_VALUE(   3926.0), SIMDE_FLOAT16_VALUE(   3958.0), SIMDE_FLOAT16_VALUE(   4268.0),
+        SIMDE_FLOAT16_VALUE(   -41.12), SIMDE_FLOAT16_VALUE(   3742.0), SIMDE_FLOAT16_VALUE(  -1217.0), SIMDE_FLOAT16_VALUE(  -7368.0),
+        SIMDE_FLOAT16_VALUE(   2734.0), SIMDE_FLOAT16_VALUE(    15.23), SIMDE_FLOAT16_VALUE(  -4492.0), SIMDE_FLOAT16_VALUE(  -4232.0),
+        SIMDE_FLOAT16_VALUE(   4492.0), SIMDE_FLOAT16_VALUE(    446.0), SIMDE_FLOAT16_VALUE(   1732.0), SIMDE_FLOAT16_VALUE(     74.6),
+        SIMDE_FLOAT16_VALUE(    16.98), SIMDE_FLOAT16_VALUE(    181.9), SIMDE_FLOAT16_VALUE(  -5364.0), SIMDE_FLOAT16_VALUE(   4120.0),
+        SIMDE_FLOAT16_VALUE(    -91.4), SIMDE_FLOAT16_VALUE(   2252.0), SIMDE_FLOAT16_VALUE(    -9.44), SIMDE_FLOAT16_VALUE(   6636.0),
+        SIMDE_FLOAT16_VALUE(   4736.0), SIMDE_FLOAT16_VALUE(    134.2), SIMDE_FLOAT16_VALUE(   7292.0), SIMDE_FLOAT16_VALUE(   1383.0) } },
+    { { SIMDE_FLOAT16_VALUE(    -96.0), SIMDE_FLOAT16_VALUE(     88.4), SIMDE_FLOAT16_VALUE(  -0.3555), SIMDE_FLOAT16_VALUE(    7.742),
+        SIMDE_FLOAT16_VALUE(     83.5), SIMDE_FLOAT16_VALUE(    55.38), SIMDE_FLOAT16_VALUE(   -7.312), SIMDE_FLOAT16_VALUE(    89.94),
+        SIMDE_FLOAT16_VALUE(    6.434), SIMDE_FLOAT16_VALUE(     98.1), SIMDE_FLOAT16_VALUE(    -75.4), SIMDE_FLOAT16_VALUE(    2.566),
+        SIMDE_FLOAT16_VALUE(   -19.16), SIMDE_FLOAT16_VALUE(   -83.56), SIMDE_FLOAT16_VALUE(    96.75), SIMDE_FLOAT16_VALUE(    96.94),
+        SIMDE_FLOAT16_VALUE(    25.75), SIMDE_FLOAT16_VALUE(   -40.56), SIMDE_FLOAT16_VALUE(   -53.75), SIMDE_FLOAT16_VALUE(     70.0),
+        SIMDE_FLOAT16_VALUE(      2.8), SIMDE_FLOAT16_VALUE(     75.1), SIMDE_FLOAT16_VALUE(   -65.75), SIMDE_FLOAT16_VALUE(    -61.8),
+        SIMDE_FLOAT16_VALUE(    33.03), SIMDE_FLOAT16_VALUE(   -78.56), SIMDE_FLOAT16_VALUE(   -84.75), SIMDE_FLOAT16_VALUE(     99.9),
+        SIMDE_FLOAT16_VALUE(   -18.16), SIMDE_FLOAT16_VALUE(    49.75), SIMDE_FLOAT16_VALUE(     4.08), SIMDE_FLOAT16_VALUE(    62.16) },
+      { SIMDE_FLOAT16_VALUE(   -40.06), SIMDE_FLOAT16_VALUE(     71.4), SIMDE_FLOAT16_VALUE(   -29.25), SIMDE_FLOAT16_VALUE(   -32.56),
+        SIMDE_FLOAT16_VALUE(     68.9), SIMDE_FLOAT16_VALUE(     32.1), SIMDE_FLOAT16_VALUE(     69.4), SIMDE_FLOAT16_VALUE(    11.67),
+        SIMDE_FLOAT16_VALUE(    -87.3), SIMDE_FLOAT16_VALUE(    74.94), SIMDE_FLOAT16_VALUE(    -90.7), SIMDE_FLOAT16_VALUE(   -67.44),
+        SIMDE_FLOAT16_VALUE(     36.5), SIMDE_FLOAT16_VALUE(    -54.7), SIMDE_FLOAT16_VALUE(   -77.56), SIMDE_FLOAT16_VALUE(    -51.2),
+        SIMDE_FLOAT16_VALUE(     74.1), SIMDE_FLOAT16_VALUE(    52.28), SIMDE_FLOAT16_VALUE(    53.53), SIMDE_FLOAT16_VALUE(   -18.53),
+        SIMDE_FLOAT16_VALUE(     86.2), SIMDE_FLOAT16_VALUE(    13.06), SIMDE_FLOAT16_VALUE(     89.4), SIMDE_FLOAT16_VALUE(   -80.25),
+        SIMDE_FLOAT16_VALUE(     83.1), SIMDE_FLOAT16_VALUE(   -59.84), SIMDE_FLOAT16_VALUE(    30.84), SIMDE_FLOAT16_VALUE(   -37.72),
+        SIMDE_FLOAT16_VALUE(   -35.44), SIMDE_FLOAT16_VALUE(    -13.1), SIMDE_FLOAT16_VALUE(    -72.9), SIMDE_FLOAT16_VALUE(     37.6) },
+      { SIMDE_FLOAT16_VALUE(   3846.0), SIMDE_FLOAT16_VALUE(   6308.0), SIMDE_FLOAT16_VALUE(     10.4), SIMDE_FLOAT16_VALUE(   -252.1),
+        SIMDE_FLOAT16_VALUE(   5752.0), SIMDE_FLOAT16_VALUE(   1777.0), SIMDE_FLOAT16_VALUE(   -507.2), SIMDE_FLOAT16_VALUE(   1050.0),
+        SIMDE_FLOAT16_VALUE(   -561.5), SIMDE_FLOAT16_VALUE(   7352.0), SIMDE_FLOAT16_VALUE(   6836.0), SIMDE_FLOAT16_VALUE(   -173.1),
+        SIMDE_FLOAT16_VALUE(   -699.0), SIMDE_FLOAT16_VALUE(   4568.0), SIMDE_FLOAT16_VALUE(  -7504.0), SIMDE_FLOAT16_VALUE(  -4960.0),
+        SIMDE_FLOAT16_VALUE(   1909.0), SIMDE_FLOAT16_VALUE(  -2120.0), SIMDE_FLOAT16_VALUE(  -2878.0), SIMDE_FLOAT16_VALUE(  -1297.0),
+        SIMDE_FLOAT16_VALUE(    241.4), SIMDE_FLOAT16_VALUE(    981.5), SIMDE_FLOAT16_VALUE(  -5876.0), SIMDE_FLOAT16_VALUE(   4960.0),
+        SIMDE_FLOAT16_VALUE(   2746.0), SIMDE_FLOAT16_VALUE(   4700.0), SIMDE_FLOAT16_VALUE(  -2614.0), SIMDE_FLOAT16_VALUE(  -3768.0),
+        SIMDE_FLOAT16_VALUE(    643.5), SIMDE_FLOAT16_VALUE(   -652.0), SIMDE_FLOAT16_VALUE(   -297.2), SIMDE_FLOAT16_VALUE(   2336.0) } },
+    { { SIMDE_FLOAT16_VALUE(    34.53), SIMDE_FLOAT16_VALUE(   -43.53), SIMDE_FLOAT16_VALUE(     66.6), SIMDE_FLOAT16_VALUE(     3.57),
+        SIMDE_FLOAT16_VALUE(    22.33), SIMDE_FLOAT16_VALUE(    -88.2), SIMDE_FLOAT16_VALUE(   -33.62), SIMDE_FLOAT16_VALUE(   -16.17),
+        SIMDE_FLOAT16_VALUE(   -52.84), SIMDE_FLOAT16_VALUE(    16.94), SIMDE_FLOAT16_VALUE(   -17.52), SIMDE_FLOAT16_VALUE(    73.06),
+        SIMDE_FLOAT16_VALUE(     49.4), SIMDE_FLOAT16_VALUE(    7.633), SIMDE_FLOAT16_VALUE(     57.4), SIMDE_FLOAT16_VALUE(    -41.6),
+        SIMDE_FLOAT16_VALUE(    78.25), SIMDE_FLOAT16_VALUE(    38.28), SIMDE_FLOAT16_VALUE(  -11.836), SIMDE_FLOAT16_VALUE(    -57.2),
+        SIMDE_FLOAT16_VALUE(   -87.44), SIMDE_FLOAT16_VALUE(    21.86), SIMDE_FLOAT16_VALUE(   -5.484), SIMDE_FLOAT16_VALUE(    50.78),
+        SIMDE_FLOAT16_VALUE(   -92.44), SIMDE_FLOAT16_VALUE(    41.75), SIMDE_FLOAT16_VALUE(   -3.701), SIMDE_FLOAT16_VALUE(   -71.75),
+        SIMDE_FLOAT16_VALUE(    29.23), SIMDE_FLOAT16_VALUE(    13.36), SIMDE_FLOAT16_VALUE(    -74.0), SIMDE_FLOAT16_VALUE(     7.56) },
+      { SIMDE_FLOAT16_VALUE(   -45.53), SIMDE_FLOAT16_VALUE(     9.84), SIMDE_FLOAT16_VALUE(    51.44), SIMDE_FLOAT16_VALUE(    -78.3),
+        SIMDE_FLOAT16_VALUE(   -23.19), SIMDE_FLOAT16_VALUE(    34.62), SIMDE_FLOAT16_VALUE(    -62.1), SIMDE_FLOAT16_VALUE(    9.734),
+        SIMDE_FLOAT16_VALUE(     82.2), SIMDE_FLOAT16_VALUE(    23.23), SIMDE_FLOAT16_VALUE(    19.83), SIMDE_FLOAT16_VALUE(     55.4),
+        SIMDE_FLOAT16_VALUE(    -62.8), SIMDE_FLOAT16_VALUE(   -28.58), SIMDE_FLOAT16_VALUE(    34.72), SIMDE_FLOAT16_VALUE(     13.4),
+        SIMDE_FLOAT16_VALUE(    -41.6), SIMDE_FLOAT16_VALUE(    27.66), SIMDE_FLOAT16_VALUE(    -93.1), SIMDE_FLOAT16_VALUE(   -90.44),
+        SIMDE_FLOAT16_VALUE(   -94.44), SIMDE_FLOAT16_VALUE(    24.64), SIMDE_FLOAT16_VALUE(    60.28), SIMDE_FLOAT16_VALUE(    -96.8),
+        SIMDE_FLOAT16_VALUE(   -45.62), SIMDE_FLOAT16_VALUE(    45.38), SIMDE_FLOAT16_VALUE(    0.917), SIMDE_FLOAT16_VALUE(    -80.1),
+        SIMDE_FLOAT16_VALUE(    68.44), SIMDE_FLOAT16_VALUE(    2.795), SIMDE_FLOAT16_VALUE(    -6.55), SIMDE_FLOAT16_VALUE(    87.44) },
+      { SIMDE_FLOAT16_VALUE(  -1572.0), SIMDE_FLOAT16_VALUE(   -428.5), SIMDE_FLOAT16_VALUE(   3428.0), SIMDE_FLOAT16_VALUE(   -279.5),
+        SIMDE_FLOAT16_VALUE(   -517.5), SIMDE_FLOAT16_VALUE(  -3054.0), SIMDE_FLOAT16_VALUE(   2088.0), SIMDE_FLOAT16_VALUE(   -157.4),
+        SIMDE_FLOAT16_VALUE(  -4344.0), SIMDE_FLOAT16_VALUE(    393.5), SIMDE_FLOAT16_VALUE(   -347.2), SIMDE_FLOAT16_VALUE(   4048.0),
+        SIMDE_FLOAT16_VALUE(  -3104.0), SIMDE_FLOAT16_VALUE(   -218.1), SIMDE_FLOAT16_VALUE(   1993.0), SIMDE_FLOAT16_VALUE(   -557.5),
+        SIMDE_FLOAT16_VALUE(  -3254.0), SIMDE_FLOAT16_VALUE(   1059.0), SIMDE_FLOAT16_VALUE(   1102.0), SIMDE_FLOAT16_VALUE(   5172.0),
+        SIMDE_FLOAT16_VALUE(   8256.0), SIMDE_FLOAT16_VALUE(    538.5), SIMDE_FLOAT16_VALUE(   -330.5), SIMDE_FLOAT16_VALUE(  -4916.0),
+        SIMDE_FLOAT16_VALUE(   4216.0), SIMDE_FLOAT16_VALUE(   1894.0), SIMDE_FLOAT16_VALUE(   -3.395), SIMDE_FLOAT16_VALUE(   5748.0),
+        SIMDE_FLOAT16_VALUE(   2001.0), SIMDE_FLOAT16_VALUE(    37.34), SIMDE_FLOAT16_VALUE(    484.8), SIMDE_FLOAT16_VALUE(    661.0) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512h a = simde_mm512_loadu_ph(test_vec[i].a);
+    simde__m512h b = simde_mm512_loadu_ph(test_vec[i].b);
+    simde__m512h r = simde_mm512_mul_ph(a, b);
+    simde_test_x86_assert_equal_f16x32(r, simde_mm512_loadu_ph(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
 SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mul_epi32)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_mul_epi32)
@@ -1559,6 +1958,12 @@ SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mul_pd)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_mul_pd)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_mul_pd)
+
+  #if defined(SIMDE_FLOAT16_IS_SCALAR)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm_mul_ph)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mul_ph)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mul_ph)
+  #endif
 SIMDE_TEST_FUNC_LIST_END
 
 #include <test/x86/avx512/test-avx512-footer.h>
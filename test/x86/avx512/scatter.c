@@ -0,0 +1,2994 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN scatter
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/scatter.h>
+#include <simde/x86/avx512/loadu.h>
+
+static int
+test_simde_mm_mask_i32scatter_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t vindex[4];
+    const int32_t a[4];
+    const int32_t r[8];
+  } test_vec[] = {
+    { UINT8_C( 37),
+      {  INT32_C(           7),  INT32_C(           1),  INT32_C(           1),  INT32_C(           0) },
+      { -INT32_C(   913577287),  INT32_C(   580652286), -INT32_C(  2002571305), -INT32_C(  1766955233) },
+      {  INT32_C(           0), -INT32_C(  2002571305),  INT32_C(           2),  INT32_C(           3),  INT32_C(           4),  INT32_C(           5),  INT32_C(           6), -INT32_C(   913577287) } },
+    { UINT8_C(210),
+      {  INT32_C(           5),  INT32_C(           5),  INT32_C(           3),  INT32_C(           6) },
+      { -INT32_C(  1070159693),  INT32_C(  1956075845),  INT32_C(  1687363836),  INT32_C(   590752462) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           2),  INT32_C(           3),  INT32_C(           4),  INT32_C(  1956075845),  INT32_C(           6),  INT32_C(           7) } },
+    { UINT8_C(184),
+      {  INT32_C(           1),  INT32_C(           2),  INT32_C(           3),  INT32_C(           1) },
+      { -INT32_C(  1923217612), -INT32_C(  1081420897), -INT32_C(  1869746586), -INT32_C(  1119309788) },
+      {  INT32_C(           0), -INT32_C(  1119309788),  INT32_C(           2),  INT32_C(           3),  INT32_C(           4),  INT32_C(           5),  INT32_C(           6),  INT32_C(           7) } },
+    { UINT8_C(150),
+      {  INT32_C(           6),  INT32_C(           2),  INT32_C(           6),  INT32_C(           1) },
+      {  INT32_C(  1749589653),  INT32_C(   382666536),  INT32_C(  1144676244), -INT32_C(   421791576) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(   382666536),  INT32_C(           3),  INT32_C(           4),  INT32_C(           5),  INT32_C(  1144676244),  INT32_C(           7) } },
+    { UINT8_C(166),
+      {  INT32_C(           3),  INT32_C(           6),  INT32_C(           3),  INT32_C(           0) },
+      { -INT32_C(    98057997), -INT32_C(   292668017),  INT32_C(  1888932472),  INT32_C(   689339565) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           2),  INT32_C(  1888932472),  INT32_C(           4),  INT32_C(           5), -INT32_C(   292668017),  INT32_C(           7) } },
+    { UINT8_C(189),
+      {  INT32_C(           7),  INT32_C(           7),  INT32_C(           6),  INT32_C(           1) },
+      {  INT32_C(  1094237700),  INT32_C(   515450700),  INT32_C(   986458557),  INT32_C(   402126144) },
+      {  INT32_C(           0),  INT32_C(   402126144),  INT32_C(           2),  INT32_C(           3),  INT32_C(           4),  INT32_C(           5),  INT32_C(   986458557),  INT32_C(  1094237700) } },
+    { UINT8_C(178),
+      {  INT32_C(           2),  INT32_C(           4),  INT32_C(           6),  INT32_C(           1) },
+      { -INT32_C(  1314692726),  INT32_C(  1148109338), -INT32_C(  2088458098),  INT32_C(  1513462687) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           2),  INT32_C(           3),  INT32_C(  1148109338),  INT32_C(           5),  INT32_C(           6),  INT32_C(           7) } },
+    { UINT8_C(248),
+      {  INT32_C(           6),  INT32_C(           5),  INT32_C(           3),  INT32_C(           0) },
+      {  INT32_C(  1768626087),  INT32_C(   787984262), -INT32_C(   808551885), -INT32_C(   976803665) },
+      { -INT32_C(   976803665),  INT32_C(           1),  INT32_C(           2),  INT32_C(           3),  INT32_C(           4),  INT32_C(           5),  INT32_C(           6),  INT32_C(           7) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int32_t r[8];
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(int32_t, j); }
+    simde_mm_mask_i32scatter_epi32(r, test_vec[i].k, simde_mm_loadu_epi32(test_vec[i].vindex), simde_mm_loadu_epi32(test_vec[i].a), 4);
+    simde_assert_equal_vi32(8, r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    int32_t vindex[4];
+    int32_t a[4], r[8];
+    for (size_t j = 0 ; j < (sizeof(vindex) / sizeof(vindex[0])) ; j++) { vindex[j] = simde_test_codegen_random_i32() & 7; }
+    for (size_t j = 0 ; j < (sizeof(a) / sizeof(a[0])) ; j++) { a[j] = simde_test_codegen_random_i32(); }
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(int32_t, j); }
+    simde_mm_mask_i32scatter_epi32(r, k, simde_mm_loadu_epi32(vindex), simde_mm_loadu_epi32(a), 4);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_vi32(2, 4, vindex, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi32(2, 4, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi32(2, 8, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_mask_i32scatter_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t vindex[4];
+    const int64_t a[2];
+    const int64_t r[4];
+  } test_vec[] = {
+    { UINT8_C( 96),
+      {  INT32_C(           3),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0) },
+      { -INT64_C( 2282928748313809042), -INT64_C( 3260793152980705226) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   2),  INT64_C(                   3) } },
+    { UINT8_C(145),
+      {  INT32_C(           0),  INT32_C(           2),  INT32_C(           1),  INT32_C(           2) },
+      { -INT64_C(  839211234373631045), -INT64_C( 3099974665102444524) },
+      { -INT64_C(  839211234373631045),  INT64_C(                   1),  INT64_C(                   2),  INT64_C(                   3) } },
+    { UINT8_C( 78),
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           2),  INT32_C(           2) },
+      { -INT64_C( 5162430292070652222),  INT64_C( 4338097563295073592) },
+      {  INT64_C(                   0),  INT64_C( 4338097563295073592),  INT64_C(                   2),  INT64_C(                   3) } },
+    { UINT8_C(228),
+      {  INT32_C(           1),  INT32_C(           1),  INT32_C(           2),  INT32_C(           3) },
+      {  INT64_C( 7278632426533635181), -INT64_C( 7350331868024870891) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   2),  INT64_C(                   3) } },
+    { UINT8_C( 92),
+      {  INT32_C(           3),  INT32_C(           0),  INT32_C(           2),  INT32_C(           1) },
+      {  INT64_C(  120763870043510706), -INT64_C( 1086292454772193745) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   2),  INT64_C(                   3) } },
+    { UINT8_C( 70),
+      {  INT32_C(           1),  INT32_C(           2),  INT32_C(           3),  INT32_C(           2) },
+      {  INT64_C( 9028482188267162129), -INT64_C( 4560401744797705542) },
+      {  INT64_C(                   0),  INT64_C(                   1), -INT64_C( 4560401744797705542),  INT64_C(                   3) } },
+    { UINT8_C(140),
+      {  INT32_C(           1),  INT32_C(           3),  INT32_C(           2),  INT32_C(           3) },
+      {  INT64_C( 4134121245993865992),  INT64_C( 5717811787626172315) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   2),  INT64_C(                   3) } },
+    { UINT8_C(228),
+      {  INT32_C(           3),  INT32_C(           3),  INT32_C(           1),  INT32_C(           2) },
+      { -INT64_C(   99680422771502936), -INT64_C( 8394476864025629987) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   2),  INT64_C(                   3) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int64_t r[4];
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(int64_t, j); }
+    simde_mm_mask_i32scatter_epi64(r, test_vec[i].k, simde_mm_loadu_epi32(test_vec[i].vindex), simde_mm_loadu_epi64(test_vec[i].a), 8);
+    simde_assert_equal_vi64(4, r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    int32_t vindex[4];
+    int64_t a[2], r[4];
+    for (size_t j = 0 ; j < (sizeof(vindex) / sizeof(vindex[0])) ; j++) { vindex[j] = simde_test_codegen_random_i32() & 3; }
+    for (size_t j = 0 ; j < (sizeof(a) / sizeof(a[0])) ; j++) { a[j] = simde_test_codegen_random_i64(); }
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(int64_t, j); }
+    simde_mm_mask_i32scatter_epi64(r, k, simde_mm_loadu_epi32(vindex), simde_mm_loadu_epi64(a), 8);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_vi32(2, 4, vindex, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi64(2, 2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi64(2, 4, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_mask_i32scatter_pd (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t vindex[4];
+    const simde_float64 a[2];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    { UINT8_C(207),
+      {  INT32_C(           0),  INT32_C(           3),  INT32_C(           1),  INT32_C(           3) },
+      { SIMDE_FLOAT64_C(   395.88), SIMDE_FLOAT64_C(   -68.98) },
+      { SIMDE_FLOAT64_C(   395.88), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(   -68.98) } },
+    { UINT8_C(146),
+      {  INT32_C(           1),  INT32_C(           2),  INT32_C(           1),  INT32_C(           3) },
+      { SIMDE_FLOAT64_C(    52.66), SIMDE_FLOAT64_C(  -141.14) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(  -141.14), SIMDE_FLOAT64_C(     3.00) } },
+    { UINT8_C(138),
+      {  INT32_C(           2),  INT32_C(           0),  INT32_C(           1),  INT32_C(           3) },
+      { SIMDE_FLOAT64_C(   891.11), SIMDE_FLOAT64_C(  -355.79) },
+      { SIMDE_FLOAT64_C(  -355.79), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(     3.00) } },
+    { UINT8_C(159),
+      {  INT32_C(           1),  INT32_C(           3),  INT32_C(           1),  INT32_C(           2) },
+      { SIMDE_FLOAT64_C(   233.33), SIMDE_FLOAT64_C(  -601.47) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   233.33), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(  -601.47) } },
+    { UINT8_C( 52),
+      {  INT32_C(           3),  INT32_C(           1),  INT32_C(           2),  INT32_C(           0) },
+      { SIMDE_FLOAT64_C(  -401.31), SIMDE_FLOAT64_C(   -62.40) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(     3.00) } },
+    { UINT8_C( 76),
+      {  INT32_C(           2),  INT32_C(           3),  INT32_C(           0),  INT32_C(           3) },
+      { SIMDE_FLOAT64_C(    63.86), SIMDE_FLOAT64_C(  -720.88) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(     3.00) } },
+    { UINT8_C(138),
+      {  INT32_C(           2),  INT32_C(           1),  INT32_C(           2),  INT32_C(           2) },
+      { SIMDE_FLOAT64_C(   919.56), SIMDE_FLOAT64_C(   759.41) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   759.41), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(     3.00) } },
+    { UINT8_C(133),
+      {  INT32_C(           3),  INT32_C(           2),  INT32_C(           3),  INT32_C(           1) },
+      { SIMDE_FLOAT64_C(   905.38), SIMDE_FLOAT64_C(     9.79) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(   905.38) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64 r[4];
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(simde_float64, j); }
+    simde_mm_mask_i32scatter_pd(r, test_vec[i].k, simde_mm_loadu_epi32(test_vec[i].vindex), simde_mm_loadu_pd(test_vec[i].a), 8);
+    simde_assert_equal_vf64(4, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    int32_t vindex[4];
+    simde_float64 a[2], r[4];
+    for (size_t j = 0 ; j < (sizeof(vindex) / sizeof(vindex[0])) ; j++) { vindex[j] = simde_test_codegen_random_i32() & 3; }
+    simde_test_codegen_random_vf64(2, a, HEDLEY_STATIC_CAST(simde_float64, -1000.0), HEDLEY_STATIC_CAST(simde_float64, 1000.0));
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(simde_float64, j); }
+    simde_mm_mask_i32scatter_pd(r, k, simde_mm_loadu_epi32(vindex), simde_mm_loadu_pd(a), 8);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_vi32(2, 4, vindex, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vf64(2, 2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vf64(2, 4, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_mask_i32scatter_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t vindex[4];
+    const simde_float32 a[4];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { UINT8_C( 97),
+      {  INT32_C(           5),  INT32_C(           1),  INT32_C(           2),  INT32_C(           3) },
+      { SIMDE_FLOAT32_C(   614.18), SIMDE_FLOAT32_C(  -650.01), SIMDE_FLOAT32_C(  -269.25), SIMDE_FLOAT32_C(   159.12) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(   614.18), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     7.00) } },
+    { UINT8_C(224),
+      {  INT32_C(           1),  INT32_C(           0),  INT32_C(           6),  INT32_C(           2) },
+      { SIMDE_FLOAT32_C(  -921.10), SIMDE_FLOAT32_C(   196.57), SIMDE_FLOAT32_C(   843.19), SIMDE_FLOAT32_C(  -364.57) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     7.00) } },
+    { UINT8_C(252),
+      {  INT32_C(           2),  INT32_C(           2),  INT32_C(           3),  INT32_C(           3) },
+      { SIMDE_FLOAT32_C(  -643.49), SIMDE_FLOAT32_C(  -479.64), SIMDE_FLOAT32_C(   -58.23), SIMDE_FLOAT32_C(    38.32) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(    38.32),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     7.00) } },
+    { UINT8_C(232),
+      {  INT32_C(           7),  INT32_C(           5),  INT32_C(           2),  INT32_C(           4) },
+      { SIMDE_FLOAT32_C(    69.34), SIMDE_FLOAT32_C(  -588.44), SIMDE_FLOAT32_C(  -761.93), SIMDE_FLOAT32_C(   682.59) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(   682.59), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     7.00) } },
+    { UINT8_C(217),
+      {  INT32_C(           1),  INT32_C(           0),  INT32_C(           5),  INT32_C(           5) },
+      { SIMDE_FLOAT32_C(   874.77), SIMDE_FLOAT32_C(   901.33), SIMDE_FLOAT32_C(  -926.17), SIMDE_FLOAT32_C(  -489.14) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   874.77), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(  -489.14), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     7.00) } },
+    { UINT8_C(217),
+      {  INT32_C(           7),  INT32_C(           1),  INT32_C(           2),  INT32_C(           2) },
+      { SIMDE_FLOAT32_C(   344.59), SIMDE_FLOAT32_C(   168.50), SIMDE_FLOAT32_C(   -45.28), SIMDE_FLOAT32_C(  -935.78) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(  -935.78), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(   344.59) } },
+    { UINT8_C(104),
+      {  INT32_C(           4),  INT32_C(           5),  INT32_C(           4),  INT32_C(           5) },
+      { SIMDE_FLOAT32_C(   333.47), SIMDE_FLOAT32_C(  -297.81), SIMDE_FLOAT32_C(   138.43), SIMDE_FLOAT32_C(    10.48) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(    10.48), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     7.00) } },
+    { UINT8_C(204),
+      {  INT32_C(           0),  INT32_C(           3),  INT32_C(           3),  INT32_C(           6) },
+      { SIMDE_FLOAT32_C(  -460.83), SIMDE_FLOAT32_C(   394.89), SIMDE_FLOAT32_C(   724.44), SIMDE_FLOAT32_C(   596.36) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(   724.44),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(   596.36), SIMDE_FLOAT32_C(     7.00) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32 r[8];
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(simde_float32, j); }
+    simde_mm_mask_i32scatter_ps(r, test_vec[i].k, simde_mm_loadu_epi32(test_vec[i].vindex), simde_mm_loadu_ps(test_vec[i].a), 4);
+    simde_assert_equal_vf32(8, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    int32_t vindex[4];
+    simde_float32 a[4], r[8];
+    for (size_t j = 0 ; j < (sizeof(vindex) / sizeof(vindex[0])) ; j++) { vindex[j] = simde_test_codegen_random_i32() & 7; }
+    simde_test_codegen_random_vf32(4, a, HEDLEY_STATIC_CAST(simde_float32, -1000.0), HEDLEY_STATIC_CAST(simde_float32, 1000.0));
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(simde_float32, j); }
+    simde_mm_mask_i32scatter_ps(r, k, simde_mm_loadu_epi32(vindex), simde_mm_loadu_ps(a), 4);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_vi32(2, 4, vindex, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vf32(2, 4, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vf32(2, 8, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_mask_i64scatter_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t vindex[2];
+    const int32_t a[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { UINT8_C(158),
+      {  INT64_C(                   0),  INT64_C(                   3) },
+      { -INT32_C(   934710734),  INT32_C(  1113465428), -INT32_C(  1616781192), -INT32_C(   969061754) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           2),  INT32_C(  1113465428) } },
+    { UINT8_C( 17),
+      {  INT64_C(                   1),  INT64_C(                   1) },
+      { -INT32_C(   722418510),  INT32_C(    38548002),  INT32_C(   495512531), -INT32_C(   516993496) },
+      {  INT32_C(           0), -INT32_C(   722418510),  INT32_C(           2),  INT32_C(           3) } },
+    { UINT8_C(167),
+      {  INT64_C(                   3),  INT64_C(                   3) },
+      {  INT32_C(  1667828273),  INT32_C(  1110862934),  INT32_C(  1131042036), -INT32_C(  1091941245) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           2),  INT32_C(  1110862934) } },
+    { UINT8_C(238),
+      {  INT64_C(                   1),  INT64_C(                   0) },
+      { -INT32_C(  1715575251), -INT32_C(   242417507), -INT32_C(  1233858454), -INT32_C(   995806533) },
+      { -INT32_C(   242417507),  INT32_C(           1),  INT32_C(           2),  INT32_C(           3) } },
+    { UINT8_C(231),
+      {  INT64_C(                   2),  INT64_C(                   0) },
+      { -INT32_C(  1704699494), -INT32_C(  1224387097), -INT32_C(    76366903),  INT32_C(  1944270432) },
+      { -INT32_C(  1224387097),  INT32_C(           1), -INT32_C(  1704699494),  INT32_C(           3) } },
+    { UINT8_C(131),
+      {  INT64_C(                   1),  INT64_C(                   3) },
+      {  INT32_C(  1022693863), -INT32_C(   788091882),  INT32_C(  1429340447),  INT32_C(   567846372) },
+      {  INT32_C(           0),  INT32_C(  1022693863),  INT32_C(           2), -INT32_C(   788091882) } },
+    { UINT8_C( 20),
+      {  INT64_C(                   3),  INT64_C(                   1) },
+      {  INT32_C(  1783614398), -INT32_C(   745987887), -INT32_C(   138944686),  INT32_C(    51173815) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           2),  INT32_C(           3) } },
+    { UINT8_C(139),
+      {  INT64_C(                   0),  INT64_C(                   3) },
+      {  INT32_C(   813715472), -INT32_C(  1182575654), -INT32_C(   462390773), -INT32_C(  1552977018) },
+      {  INT32_C(   813715472),  INT32_C(           1),  INT32_C(           2), -INT32_C(  1182575654) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int32_t r[4];
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(int32_t, j); }
+    simde_mm_mask_i64scatter_epi32(r, test_vec[i].k, simde_mm_loadu_epi64(test_vec[i].vindex), simde_mm_loadu_epi32(test_vec[i].a), 4);
+    simde_assert_equal_vi32(4, r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    int64_t vindex[2];
+    int32_t a[4], r[4];
+    for (size_t j = 0 ; j < (sizeof(vindex) / sizeof(vindex[0])) ; j++) { vindex[j] = simde_test_codegen_random_i64() & 3; }
+    for (size_t j = 0 ; j < (sizeof(a) / sizeof(a[0])) ; j++) { a[j] = simde_test_codegen_random_i32(); }
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(int32_t, j); }
+    simde_mm_mask_i64scatter_epi32(r, k, simde_mm_loadu_epi64(vindex), simde_mm_loadu_epi32(a), 4);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_vi64(2, 2, vindex, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi32(2, 4, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi32(2, 4, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_mask_i64scatter_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t vindex[2];
+    const int64_t a[2];
+    const int64_t r[4];
+  } test_vec[] = {
+    { UINT8_C( 76),
+      {  INT64_C(                   0),  INT64_C(                   3) },
+      { -INT64_C( 2117816180440243138), -INT64_C(  274424977318969231) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   2),  INT64_C(                   3) } },
+    { UINT8_C( 53),
+      {  INT64_C(                   0),  INT64_C(                   1) },
+      { -INT64_C( 1208670662083816761),  INT64_C( 8978729945452715609) },
+      { -INT64_C( 1208670662083816761),  INT64_C(                   1),  INT64_C(                   2),  INT64_C(                   3) } },
+    { UINT8_C(135),
+      {  INT64_C(                   2),  INT64_C(                   0) },
+      { -INT64_C( 5891104618264897803), -INT64_C( 2028455753366461578) },
+      { -INT64_C( 2028455753366461578),  INT64_C(                   1), -INT64_C( 5891104618264897803),  INT64_C(                   3) } },
+    { UINT8_C(126),
+      {  INT64_C(                   0),  INT64_C(                   1) },
+      {  INT64_C( 5502700184990542415), -INT64_C( 6594557893745725566) },
+      {  INT64_C(                   0), -INT64_C( 6594557893745725566),  INT64_C(                   2),  INT64_C(                   3) } },
+    { UINT8_C( 44),
+      {  INT64_C(                   0),  INT64_C(                   1) },
+      {  INT64_C( 8001190922700481283), -INT64_C( 1724425104878271111) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   2),  INT64_C(                   3) } },
+    { UINT8_C(148),
+      {  INT64_C(                   3),  INT64_C(                   0) },
+      { -INT64_C( 3901534803852805263), -INT64_C( 1216478978088714258) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   2),  INT64_C(                   3) } },
+    { UINT8_C(237),
+      {  INT64_C(                   1),  INT64_C(                   2) },
+      {  INT64_C( 7952535260725237113),  INT64_C( 5439836001356670814) },
+      {  INT64_C(                   0),  INT64_C( 7952535260725237113),  INT64_C(                   2),  INT64_C(                   3) } },
+    { UINT8_C( 83),
+      {  INT64_C(                   1),  INT64_C(                   3) },
+      {  INT64_C( 5169753450329211467),  INT64_C( 7955494173837905894) },
+      {  INT64_C(                   0),  INT64_C( 5169753450329211467),  INT64_C(                   2),  INT64_C( 7955494173837905894) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int64_t r[4];
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(int64_t, j); }
+    simde_mm_mask_i64scatter_epi64(r, test_vec[i].k, simde_mm_loadu_epi64(test_vec[i].vindex), simde_mm_loadu_epi64(test_vec[i].a), 8);
+    simde_assert_equal_vi64(4, r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    int64_t vindex[2];
+    int64_t a[2], r[4];
+    for (size_t j = 0 ; j < (sizeof(vindex) / sizeof(vindex[0])) ; j++) { vindex[j] = simde_test_codegen_random_i64() & 3; }
+    for (size_t j = 0 ; j < (sizeof(a) / sizeof(a[0])) ; j++) { a[j] = simde_test_codegen_random_i64(); }
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(int64_t, j); }
+    simde_mm_mask_i64scatter_epi64(r, k, simde_mm_loadu_epi64(vindex), simde_mm_loadu_epi64(a), 8);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_vi64(2, 2, vindex, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi64(2, 2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi64(2, 4, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_mask_i64scatter_pd (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t vindex[2];
+    const simde_float64 a[2];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    { UINT8_C( 69),
+      {  INT64_C(                   3),  INT64_C(                   0) },
+      { SIMDE_FLOAT64_C(   964.33), SIMDE_FLOAT64_C(   654.91) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(   964.33) } },
+    { UINT8_C(204),
+      {  INT64_C(                   1),  INT64_C(                   3) },
+      { SIMDE_FLOAT64_C(   581.96), SIMDE_FLOAT64_C(  -555.60) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(     3.00) } },
+    { UINT8_C( 96),
+      {  INT64_C(                   1),  INT64_C(                   1) },
+      { SIMDE_FLOAT64_C(   -73.29), SIMDE_FLOAT64_C(  -431.67) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(     3.00) } },
+    { UINT8_C(193),
+      {  INT64_C(                   0),  INT64_C(                   3) },
+      { SIMDE_FLOAT64_C(   535.57), SIMDE_FLOAT64_C(    24.27) },
+      { SIMDE_FLOAT64_C(   535.57), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(     3.00) } },
+    { UINT8_C(173),
+      {  INT64_C(                   3),  INT64_C(                   0) },
+      { SIMDE_FLOAT64_C(   542.12), SIMDE_FLOAT64_C(  -149.91) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(   542.12) } },
+    { UINT8_C(182),
+      {  INT64_C(                   0),  INT64_C(                   0) },
+      { SIMDE_FLOAT64_C(  -959.14), SIMDE_FLOAT64_C(   584.69) },
+      { SIMDE_FLOAT64_C(   584.69), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(     3.00) } },
+    { UINT8_C(168),
+      {  INT64_C(                   2),  INT64_C(                   2) },
+      { SIMDE_FLOAT64_C(   963.10), SIMDE_FLOAT64_C(  -237.66) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(     3.00) } },
+    { UINT8_C(191),
+      {  INT64_C(                   1),  INT64_C(                   0) },
+      { SIMDE_FLOAT64_C(   745.52), SIMDE_FLOAT64_C(   771.32) },
+      { SIMDE_FLOAT64_C(   771.32), SIMDE_FLOAT64_C(   745.52), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(     3.00) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64 r[4];
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(simde_float64, j); }
+    simde_mm_mask_i64scatter_pd(r, test_vec[i].k, simde_mm_loadu_epi64(test_vec[i].vindex), simde_mm_loadu_pd(test_vec[i].a), 8);
+    simde_assert_equal_vf64(4, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    int64_t vindex[2];
+    simde_float64 a[2], r[4];
+    for (size_t j = 0 ; j < (sizeof(vindex) / sizeof(vindex[0])) ; j++) { vindex[j] = simde_test_codegen_random_i64() & 3; }
+    simde_test_codegen_random_vf64(2, a, HEDLEY_STATIC_CAST(simde_float64, -1000.0), HEDLEY_STATIC_CAST(simde_float64, 1000.0));
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(simde_float64, j); }
+    simde_mm_mask_i64scatter_pd(r, k, simde_mm_loadu_epi64(vindex), simde_mm_loadu_pd(a), 8);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_vi64(2, 2, vindex, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vf64(2, 2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vf64(2, 4, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_mask_i64scatter_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t vindex[2];
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { UINT8_C(156),
+      {  INT64_C(                   0),  INT64_C(                   0) },
+      { SIMDE_FLOAT32_C(   655.32), SIMDE_FLOAT32_C(  -844.98), SIMDE_FLOAT32_C(  -797.81), SIMDE_FLOAT32_C(  -517.13) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(     3.00) } },
+    { UINT8_C( 63),
+      {  INT64_C(                   2),  INT64_C(                   0) },
+      { SIMDE_FLOAT32_C(  -981.59), SIMDE_FLOAT32_C(   661.58), SIMDE_FLOAT32_C(   244.45), SIMDE_FLOAT32_C(   377.86) },
+      { SIMDE_FLOAT32_C(   661.58), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(  -981.59), SIMDE_FLOAT32_C(     3.00) } },
+    { UINT8_C(129),
+      {  INT64_C(                   0),  INT64_C(                   2) },
+      { SIMDE_FLOAT32_C(   857.76), SIMDE_FLOAT32_C(   640.72), SIMDE_FLOAT32_C(  -755.97), SIMDE_FLOAT32_C(   448.63) },
+      { SIMDE_FLOAT32_C(   857.76), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(     3.00) } },
+    { UINT8_C(194),
+      {  INT64_C(                   0),  INT64_C(                   1) },
+      { SIMDE_FLOAT32_C(  -946.39), SIMDE_FLOAT32_C(    64.96), SIMDE_FLOAT32_C(  -990.27), SIMDE_FLOAT32_C(   762.29) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    64.96), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(     3.00) } },
+    { UINT8_C( 98),
+      {  INT64_C(                   0),  INT64_C(                   2) },
+      { SIMDE_FLOAT32_C(  -532.59), SIMDE_FLOAT32_C(  -243.90), SIMDE_FLOAT32_C(   915.55), SIMDE_FLOAT32_C(   -54.73) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(  -243.90), SIMDE_FLOAT32_C(     3.00) } },
+    { UINT8_C(156),
+      {  INT64_C(                   3),  INT64_C(                   2) },
+      { SIMDE_FLOAT32_C(   320.45), SIMDE_FLOAT32_C(  -697.95), SIMDE_FLOAT32_C(  -501.97), SIMDE_FLOAT32_C(   741.98) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(     3.00) } },
+    { UINT8_C(236),
+      {  INT64_C(                   1),  INT64_C(                   2) },
+      { SIMDE_FLOAT32_C(   529.26), SIMDE_FLOAT32_C(  -177.82), SIMDE_FLOAT32_C(   -54.98), SIMDE_FLOAT32_C(  -483.87) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(     3.00) } },
+    { UINT8_C(243),
+      {  INT64_C(                   1),  INT64_C(                   2) },
+      { SIMDE_FLOAT32_C(  -228.62), SIMDE_FLOAT32_C(  -414.14), SIMDE_FLOAT32_C(   422.67), SIMDE_FLOAT32_C(  -506.34) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -228.62), SIMDE_FLOAT32_C(  -414.14), SIMDE_FLOAT32_C(     3.00) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32 r[4];
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(simde_float32, j); }
+    simde_mm_mask_i64scatter_ps(r, test_vec[i].k, simde_mm_loadu_epi64(test_vec[i].vindex), simde_mm_loadu_ps(test_vec[i].a), 4);
+    simde_assert_equal_vf32(4, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    int64_t vindex[2];
+    simde_float32 a[4], r[4];
+    for (size_t j = 0 ; j < (sizeof(vindex) / sizeof(vindex[0])) ; j++) { vindex[j] = simde_test_codegen_random_i64() & 3; }
+    simde_test_codegen_random_vf32(4, a, HEDLEY_STATIC_CAST(simde_float32, -1000.0), HEDLEY_STATIC_CAST(simde_float32, 1000.0));
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(simde_float32, j); }
+    simde_mm_mask_i64scatter_ps(r, k, simde_mm_loadu_epi64(vindex), simde_mm_loadu_ps(a), 4);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_vi64(2, 2, vindex, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vf32(2, 4, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vf32(2, 4, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_mask_i32scatter_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t vindex[8];
+    const int32_t a[8];
+    const int32_t r[16];
+  } test_vec[] = {
+    { UINT8_C( 38),
+      {  INT32_C(           1),  INT32_C(           4),  INT32_C(           7),  INT32_C(           3),  INT32_C(           1),  INT32_C(           4),  INT32_C(           4),  INT32_C(           4) },
+      {  INT32_C(  1913384030), -INT32_C(  1533448467), -INT32_C(   399905339), -INT32_C(  2097456447),  INT32_C(  2099064841),  INT32_C(  1319447146),  INT32_C(  1981968561), -INT32_C(   911532949) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           2),  INT32_C(           3),  INT32_C(  1319447146),  INT32_C(           5),  INT32_C(           6), -INT32_C(   399905339),
+         INT32_C(           8),  INT32_C(           9),  INT32_C(          10),  INT32_C(          11),  INT32_C(          12),  INT32_C(          13),  INT32_C(          14),  INT32_C(          15) } },
+    { UINT8_C(  8),
+      {  INT32_C(           6),  INT32_C(           4),  INT32_C(           3),  INT32_C(          14),  INT32_C(           2),  INT32_C(           9),  INT32_C(           9),  INT32_C(          15) },
+      { -INT32_C(    50662616),  INT32_C(  1354622349), -INT32_C(  2039595080),  INT32_C(  1720030532), -INT32_C(  2085425607),  INT32_C(  2134683558),  INT32_C(  1114988835),  INT32_C(  1998025294) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           2),  INT32_C(           3),  INT32_C(           4),  INT32_C(           5),  INT32_C(           6),  INT32_C(           7),
+         INT32_C(           8),  INT32_C(           9),  INT32_C(          10),  INT32_C(          11),  INT32_C(          12),  INT32_C(          13),  INT32_C(  1720030532),  INT32_C(          15) } },
+    { UINT8_C(101),
+      {  INT32_C(           2),  INT32_C(           1),  INT32_C(           1),  INT32_C(          11),  INT32_C(          12),  INT32_C(          15),  INT32_C(           4),  INT32_C(           8) },
+      {  INT32_C(   167841497),  INT32_C(    41594961), -INT32_C(  1589104666),  INT32_C(   373999689),  INT32_C(   160602826), -INT32_C(  1381420695),  INT32_C(   174299154), -INT32_C(   703234051) },
+      {  INT32_C(           0), -INT32_C(  1589104666),  INT32_C(   167841497),  INT32_C(           3),  INT32_C(   174299154),  INT32_C(           5),  INT32_C(           6),  INT32_C(           7),
+         INT32_C(           8),  INT32_C(           9),  INT32_C(          10),  INT32_C(          11),  INT32_C(          12),  INT32_C(          13),  INT32_C(          14), -INT32_C(  1381420695) } },
+    { UINT8_C(142),
+      {  INT32_C(           6),  INT32_C(          11),  INT32_C(          10),  INT32_C(           8),  INT32_C(          11),  INT32_C(           0),  INT32_C(          12),  INT32_C(          14) },
+      {  INT32_C(   398170556), -INT32_C(  1516148613),  INT32_C(  1335391670), -INT32_C(   629058210), -INT32_C(  1954144997),  INT32_C(   294864229), -INT32_C(   331507442),  INT32_C(   836826741) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           2),  INT32_C(           3),  INT32_C(           4),  INT32_C(           5),  INT32_C(           6),  INT32_C(           7),
+        -INT32_C(   629058210),  INT32_C(           9),  INT32_C(  1335391670), -INT32_C(  1516148613),  INT32_C(          12),  INT32_C(          13),  INT32_C(   836826741),  INT32_C(          15) } },
+    { UINT8_C(143),
+      {  INT32_C(          12),  INT32_C(          10),  INT32_C(           8),  INT32_C(          11),  INT32_C(          14),  INT32_C(           7),  INT32_C(          12),  INT32_C(          14) },
+      {  INT32_C(  1256123744), -INT32_C(   441804387),  INT32_C(   797075619),  INT32_C(   517421568),  INT32_C(  1451419006),  INT32_C(  1640428293), -INT32_C(  1883984815),  INT32_C(   594122691) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           2),  INT32_C(           3),  INT32_C(           4),  INT32_C(           5),  INT32_C(           6),  INT32_C(           7),
+         INT32_C(   797075619),  INT32_C(           9), -INT32_C(   441804387),  INT32_C(   517421568),  INT32_C(  1256123744),  INT32_C(          13),  INT32_C(   594122691),  INT32_C(          15) } },
+    { UINT8_C(132),
+      {  INT32_C(           7),  INT32_C(           7),  INT32_C(           8),  INT32_C(          11),  INT32_C(           0),  INT32_C(          13),  INT32_C(          11),  INT32_C(          12) },
+      {  INT32_C(  1954924381),  INT32_C(  1442056653),  INT32_C(  1209562045),  INT32_C(   834165009),  INT32_C(  1296379632), -INT32_C(  1873303291), -INT32_C(   105700451),  INT32_C(  1889360147) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           2),  INT32_C(           3),  INT32_C(           4),  INT32_C(           5),  INT32_C(           6),  INT32_C(           7),
+         INT32_C(  1209562045),  INT32_C(           9),  INT32_C(          10),  INT32_C(          11),  INT32_C(  1889360147),  INT32_C(          13),  INT32_C(          14),  INT32_C(          15) } },
+    { UINT8_C( 33),
+      {  INT32_C(           2),  INT32_C(           8),  INT32_C(          12),  INT32_C(           9),  INT32_C(           4),  INT32_C(           9),  INT32_C(           0),  INT32_C(           1) },
+      { -INT32_C(  1392457260),  INT32_C(  1777985805),  INT32_C(    52319770), -INT32_C(  1189362715), -INT32_C(    13158475),  INT32_C(  1147949540),  INT32_C(   402582629), -INT32_C(  1326720804) },
+      {  INT32_C(           0),  INT32_C(           1), -INT32_C(  1392457260),  INT32_C(           3),  INT32_C(           4),  INT32_C(           5),  INT32_C(           6),  INT32_C(           7),
+         INT32_C(           8),  INT32_C(  1147949540),  INT32_C(          10),  INT32_C(          11),  INT32_C(          12),  INT32_C(          13),  INT32_C(          14),  INT32_C(          15) } },
+    { UINT8_C(161),
+      {  INT32_C(          11),  INT32_C(           6),  INT32_C(           5),  INT32_C(          12),  INT32_C(           3),  INT32_C(           9),  INT32_C(          11),  INT32_C(          12) },
+      {  INT32_C(  1174115311), -INT32_C(   520951381), -INT32_C(   405174822),  INT32_C(  1412138961),  INT32_C(  1294488372),  INT32_C(   726819520), -INT32_C(   277924941), -INT32_C(  1290382140) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           2),  INT32_C(           3),  INT32_C(           4),  INT32_C(           5),  INT32_C(           6),  INT32_C(           7),
+         INT32_C(           8),  INT32_C(   726819520),  INT32_C(          10),  INT32_C(  1174115311), -INT32_C(  1290382140),  INT32_C(          13),  INT32_C(          14),  INT32_C(          15) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int32_t r[16];
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(int32_t, j); }
+    simde_mm256_mask_i32scatter_epi32(r, test_vec[i].k, simde_mm256_loadu_epi32(test_vec[i].vindex), simde_mm256_loadu_epi32(test_vec[i].a), 4);
+    simde_assert_equal_vi32(16, r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    int32_t vindex[8];
+    int32_t a[8], r[16];
+    for (size_t j = 0 ; j < (sizeof(vindex) / sizeof(vindex[0])) ; j++) { vindex[j] = simde_test_codegen_random_i32() & 15; }
+    for (size_t j = 0 ; j < (sizeof(a) / sizeof(a[0])) ; j++) { a[j] = simde_test_codegen_random_i32(); }
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(int32_t, j); }
+    simde_mm256_mask_i32scatter_epi32(r, k, simde_mm256_loadu_epi32(vindex), simde_mm256_loadu_epi32(a), 4);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_vi32(2, 8, vindex, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi32(2, 8, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi32(2, 16, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_mask_i32scatter_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t vindex[4];
+    const int64_t a[4];
+    const int64_t r[8];
+  } test_vec[] = {
+    { UINT8_C(231),
+      {  INT32_C(           1),  INT32_C(           3),  INT32_C(           4),  INT32_C(           7) },
+      { -INT64_C( 2750530977456761666), -INT64_C( 1454291203999808619),  INT64_C( 2496889572125205322),  INT64_C( 4294459860092053367) },
+      {  INT64_C(                   0), -INT64_C( 2750530977456761666),  INT64_C(                   2), -INT64_C( 1454291203999808619),
+         INT64_C( 2496889572125205322),  INT64_C(                   5),  INT64_C(                   6),  INT64_C(                   7) } },
+    { UINT8_C( 80),
+      {  INT32_C(           3),  INT32_C(           7),  INT32_C(           5),  INT32_C(           2) },
+      { -INT64_C( 3760392562213110370),  INT64_C( 6532897626680471132), -INT64_C( 2593681482248314914),  INT64_C( 2671939178158804637) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   2),  INT64_C(                   3),
+         INT64_C(                   4),  INT64_C(                   5),  INT64_C(                   6),  INT64_C(                   7) } },
+    { UINT8_C(223),
+      {  INT32_C(           0),  INT32_C(           7),  INT32_C(           6),  INT32_C(           4) },
+      {  INT64_C( 1491825374184293811), -INT64_C( 4025443528512676959),  INT64_C( 5263479206691988798), -INT64_C( 6706182078521520362) },
+      {  INT64_C( 1491825374184293811),  INT64_C(                   1),  INT64_C(                   2),  INT64_C(                   3),
+        -INT64_C( 6706182078521520362),  INT64_C(                   5),  INT64_C( 5263479206691988798), -INT64_C( 4025443528512676959) } },
+    { UINT8_C( 31),
+      {  INT32_C(           1),  INT32_C(           6),  INT32_C(           5),  INT32_C(           7) },
+      { -INT64_C(  269431286370623095),  INT64_C( 8963724991370261612),  INT64_C( 6592529087311235910),  INT64_C( 4798099116199622499) },
+      {  INT64_C(                   0), -INT64_C(  269431286370623095),  INT64_C(                   2),  INT64_C(                   3),
+         INT64_C(                   4),  INT64_C( 6592529087311235910),  INT64_C( 8963724991370261612),  INT64_C( 4798099116199622499) } },
+    { UINT8_C(230),
+      {  INT32_C(           6),  INT32_C(           0),  INT32_C(           1),  INT32_C(           7) },
+      {  INT64_C( 3774971400700887201), -INT64_C( 7295496578491617899),  INT64_C( 6662168428381099166), -INT64_C( 6768155973629313960) },
+      { -INT64_C( 7295496578491617899),  INT64_C( 6662168428381099166),  INT64_C(                   2),  INT64_C(                   3),
+         INT64_C(                   4),  INT64_C(                   5),  INT64_C(                   6),  INT64_C(                   7) } },
+    { UINT8_C(174),
+      {  INT32_C(           3),  INT32_C(           5),  INT32_C(           6),  INT32_C(           1) },
+      { -INT64_C( 2619048932383626359),  INT64_C( 2667395457870526375), -INT64_C( 2443279144555565024),  INT64_C( 2693286289622207658) },
+      {  INT64_C(                   0),  INT64_C( 2693286289622207658),  INT64_C(                   2),  INT64_C(                   3),
+         INT64_C(                   4),  INT64_C( 2667395457870526375), -INT64_C( 2443279144555565024),  INT64_C(                   7) } },
+    { UINT8_C(228),
+      {  INT32_C(           0),  INT32_C(           4),  INT32_C(           3),  INT32_C(           5) },
+      { -INT64_C( 2140286976617726233),  INT64_C( 5829526022474606473), -INT64_C( 4231112839485609448), -INT64_C( 8149588263225563749) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   2), -INT64_C( 4231112839485609448),
+         INT64_C(                   4),  INT64_C(                   5),  INT64_C(                   6),  INT64_C(                   7) } },
+    { UINT8_C( 23),
+      {  INT32_C(           4),  INT32_C(           4),  INT32_C(           4),  INT32_C(           2) },
+      {  INT64_C( 7712005371124432217),  INT64_C( 5204649427239906891), -INT64_C( 4435602575715620911),  INT64_C( 8272191229160234110) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   2),  INT64_C(                   3),
+        -INT64_C( 4435602575715620911),  INT64_C(                   5),  INT64_C(                   6),  INT64_C(                   7) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int64_t r[8];
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(int64_t, j); }
+    simde_mm256_mask_i32scatter_epi64(r, test_vec[i].k, simde_mm_loadu_epi32(test_vec[i].vindex), simde_mm256_loadu_epi64(test_vec[i].a), 8);
+    simde_assert_equal_vi64(8, r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    int32_t vindex[4];
+    int64_t a[4], r[8];
+    for (size_t j = 0 ; j < (sizeof(vindex) / sizeof(vindex[0])) ; j++) { vindex[j] = simde_test_codegen_random_i32() & 7; }
+    for (size_t j = 0 ; j < (sizeof(a) / sizeof(a[0])) ; j++) { a[j] = simde_test_codegen_random_i64(); }
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(int64_t, j); }
+    simde_mm256_mask_i32scatter_epi64(r, k, simde_mm_loadu_epi32(vindex), simde_mm256_loadu_epi64(a), 8);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_vi32(2, 4, vindex, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi64(2, 4, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi64(2, 8, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_mask_i32scatter_pd (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t vindex[4];
+    const simde_float64 a[4];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { UINT8_C(120),
+      {  INT32_C(           3),  INT32_C(           3),  INT32_C(           4),  INT32_C(           0) },
+      { SIMDE_FLOAT64_C(  -720.56), SIMDE_FLOAT64_C(   600.30), SIMDE_FLOAT64_C(  -455.75), SIMDE_FLOAT64_C(   554.29) },
+      { SIMDE_FLOAT64_C(   554.29), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(     3.00),
+        SIMDE_FLOAT64_C(     4.00), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(     7.00) } },
+    { UINT8_C( 46),
+      {  INT32_C(           6),  INT32_C(           0),  INT32_C(           5),  INT32_C(           1) },
+      { SIMDE_FLOAT64_C(   384.03), SIMDE_FLOAT64_C(   562.34), SIMDE_FLOAT64_C(   308.74), SIMDE_FLOAT64_C(   216.40) },
+      { SIMDE_FLOAT64_C(   562.34), SIMDE_FLOAT64_C(   216.40), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(     3.00),
+        SIMDE_FLOAT64_C(     4.00), SIMDE_FLOAT64_C(   308.74), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(     7.00) } },
+    { UINT8_C( 76),
+      {  INT32_C(           5),  INT32_C(           5),  INT32_C(           4),  INT32_C(           2) },
+      { SIMDE_FLOAT64_C(   978.50), SIMDE_FLOAT64_C(   517.30), SIMDE_FLOAT64_C(   955.02), SIMDE_FLOAT64_C(  -947.63) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(  -947.63), SIMDE_FLOAT64_C(     3.00),
+        SIMDE_FLOAT64_C(   955.02), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(     7.00) } },
+    { UINT8_C( 56),
+      {  INT32_C(           4),  INT32_C(           2),  INT32_C(           5),  INT32_C(           7) },
+      { SIMDE_FLOAT64_C(  -383.86), SIMDE_FLOAT64_C(  -154.25), SIMDE_FLOAT64_C(   582.87), SIMDE_FLOAT64_C(  -896.45) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(     3.00),
+        SIMDE_FLOAT64_C(     4.00), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(  -896.45) } },
+    { UINT8_C(146),
+      {  INT32_C(           2),  INT32_C(           2),  INT32_C(           4),  INT32_C(           7) },
+      { SIMDE_FLOAT64_C(  -109.85), SIMDE_FLOAT64_C(  -657.18), SIMDE_FLOAT64_C(   560.82), SIMDE_FLOAT64_C(   793.86) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(  -657.18), SIMDE_FLOAT64_C(     3.00),
+        SIMDE_FLOAT64_C(     4.00), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(     7.00) } },
+    { UINT8_C( 93),
+      {  INT32_C(           0),  INT32_C(           5),  INT32_C(           7),  INT32_C(           7) },
+      { SIMDE_FLOAT64_C(  -795.98), SIMDE_FLOAT64_C(   978.17), SIMDE_FLOAT64_C(   929.67), SIMDE_FLOAT64_C(   448.57) },
+      { SIMDE_FLOAT64_C(  -795.98), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(     3.00),
+        SIMDE_FLOAT64_C(     4.00), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(   448.57) } },
+    { UINT8_C(108),
+      {  INT32_C(           5),  INT32_C(           4),  INT32_C(           3),  INT32_C(           7) },
+      { SIMDE_FLOAT64_C(   -51.22), SIMDE_FLOAT64_C(  -135.11), SIMDE_FLOAT64_C(  -362.50), SIMDE_FLOAT64_C(   933.52) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(  -362.50),
+        SIMDE_FLOAT64_C(     4.00), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(   933.52) } },
+    { UINT8_C(254),
+      {  INT32_C(           6),  INT32_C(           4),  INT32_C(           6),  INT32_C(           2) },
+      { SIMDE_FLOAT64_C(    36.87), SIMDE_FLOAT64_C(  -210.54), SIMDE_FLOAT64_C(   311.82), SIMDE_FLOAT64_C(   944.53) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(   944.53), SIMDE_FLOAT64_C(     3.00),
+        SIMDE_FLOAT64_C(  -210.54), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(   311.82), SIMDE_FLOAT64_C(     7.00) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64 r[8];
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(simde_float64, j); }
+    simde_mm256_mask_i32scatter_pd(r, test_vec[i].k, simde_mm_loadu_epi32(test_vec[i].vindex), simde_mm256_loadu_pd(test_vec[i].a), 8);
+    simde_assert_equal_vf64(8, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    int32_t vindex[4];
+    simde_float64 a[4], r[8];
+    for (size_t j = 0 ; j < (sizeof(vindex) / sizeof(vindex[0])) ; j++) { vindex[j] = simde_test_codegen_random_i32() & 7; }
+    simde_test_codegen_random_vf64(4, a, HEDLEY_STATIC_CAST(simde_float64, -1000.0), HEDLEY_STATIC_CAST(simde_float64, 1000.0));
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(simde_float64, j); }
+    simde_mm256_mask_i32scatter_pd(r, k, simde_mm_loadu_epi32(vindex), simde_mm256_loadu_pd(a), 8);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_vi32(2, 4, vindex, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vf64(2, 4, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vf64(2, 8, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_mask_i32scatter_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t vindex[8];
+    const simde_float32 a[8];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { UINT8_C(176),
+      {  INT32_C(           3),  INT32_C(          10),  INT32_C(           4),  INT32_C(           3),  INT32_C(          15),  INT32_C(           0),  INT32_C(           3),  INT32_C(          10) },
+      { SIMDE_FLOAT32_C(   475.64), SIMDE_FLOAT32_C(    12.12), SIMDE_FLOAT32_C(   925.43), SIMDE_FLOAT32_C(  -754.36),
+        SIMDE_FLOAT32_C(   178.88), SIMDE_FLOAT32_C(   326.02), SIMDE_FLOAT32_C(   653.14), SIMDE_FLOAT32_C(   279.16) },
+      { SIMDE_FLOAT32_C(   326.02), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(   279.16), SIMDE_FLOAT32_C(    11.00),
+        SIMDE_FLOAT32_C(    12.00), SIMDE_FLOAT32_C(    13.00), SIMDE_FLOAT32_C(    14.00), SIMDE_FLOAT32_C(   178.88) } },
+    { UINT8_C(150),
+      {  INT32_C(          14),  INT32_C(           8),  INT32_C(           6),  INT32_C(           5),  INT32_C(          11),  INT32_C(          12),  INT32_C(           8),  INT32_C(           9) },
+      { SIMDE_FLOAT32_C(   350.06), SIMDE_FLOAT32_C(  -205.73), SIMDE_FLOAT32_C(  -802.81), SIMDE_FLOAT32_C(  -226.29),
+        SIMDE_FLOAT32_C(   364.07), SIMDE_FLOAT32_C(   153.90), SIMDE_FLOAT32_C(  -575.13), SIMDE_FLOAT32_C(  -599.00) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(  -802.81), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(  -205.73), SIMDE_FLOAT32_C(  -599.00), SIMDE_FLOAT32_C(    10.00), SIMDE_FLOAT32_C(   364.07),
+        SIMDE_FLOAT32_C(    12.00), SIMDE_FLOAT32_C(    13.00), SIMDE_FLOAT32_C(    14.00), SIMDE_FLOAT32_C(    15.00) } },
+    { UINT8_C(232),
+      {  INT32_C(           8),  INT32_C(           4),  INT32_C(          13),  INT32_C(           4),  INT32_C(          12),  INT32_C(          13),  INT32_C(           5),  INT32_C(          10) },
+      { SIMDE_FLOAT32_C(   811.92), SIMDE_FLOAT32_C(   209.21), SIMDE_FLOAT32_C(  -801.99), SIMDE_FLOAT32_C(    28.16),
+        SIMDE_FLOAT32_C(   481.15), SIMDE_FLOAT32_C(   700.24), SIMDE_FLOAT32_C(  -612.71), SIMDE_FLOAT32_C(  -521.70) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(    28.16), SIMDE_FLOAT32_C(  -612.71), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(  -521.70), SIMDE_FLOAT32_C(    11.00),
+        SIMDE_FLOAT32_C(    12.00), SIMDE_FLOAT32_C(   700.24), SIMDE_FLOAT32_C(    14.00), SIMDE_FLOAT32_C(    15.00) } },
+    { UINT8_C(240),
+      {  INT32_C(           7),  INT32_C(           7),  INT32_C(          14),  INT32_C(           1),  INT32_C(          11),  INT32_C(           9),  INT32_C(           4),  INT32_C(           6) },
+      { SIMDE_FLOAT32_C(   232.15), SIMDE_FLOAT32_C(  -135.90), SIMDE_FLOAT32_C(   316.85), SIMDE_FLOAT32_C(   975.01),
+        SIMDE_FLOAT32_C(  -937.30), SIMDE_FLOAT32_C(   618.97), SIMDE_FLOAT32_C(   236.72), SIMDE_FLOAT32_C(  -119.05) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(   236.72), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(  -119.05), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(   618.97), SIMDE_FLOAT32_C(    10.00), SIMDE_FLOAT32_C(  -937.30),
+        SIMDE_FLOAT32_C(    12.00), SIMDE_FLOAT32_C(    13.00), SIMDE_FLOAT32_C(    14.00), SIMDE_FLOAT32_C(    15.00) } },
+    { UINT8_C(215),
+      {  INT32_C(           9),  INT32_C(           7),  INT32_C(           2),  INT32_C(           7),  INT32_C(           6),  INT32_C(           1),  INT32_C(           4),  INT32_C(          14) },
+      { SIMDE_FLOAT32_C(  -238.01), SIMDE_FLOAT32_C(  -947.07), SIMDE_FLOAT32_C(   508.93), SIMDE_FLOAT32_C(   610.01),
+        SIMDE_FLOAT32_C(  -914.59), SIMDE_FLOAT32_C(  -166.94), SIMDE_FLOAT32_C(   -42.04), SIMDE_FLOAT32_C(   564.67) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(   508.93), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(   -42.04), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(  -914.59), SIMDE_FLOAT32_C(  -947.07),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(  -238.01), SIMDE_FLOAT32_C(    10.00), SIMDE_FLOAT32_C(    11.00),
+        SIMDE_FLOAT32_C(    12.00), SIMDE_FLOAT32_C(    13.00), SIMDE_FLOAT32_C(   564.67), SIMDE_FLOAT32_C(    15.00) } },
+    { UINT8_C(158),
+      {  INT32_C(          13),  INT32_C(           8),  INT32_C(          13),  INT32_C(           2),  INT32_C(           6),  INT32_C(           9),  INT32_C(           5),  INT32_C(           8) },
+      { SIMDE_FLOAT32_C(   -78.25), SIMDE_FLOAT32_C(   445.05), SIMDE_FLOAT32_C(   350.84), SIMDE_FLOAT32_C(   753.83),
+        SIMDE_FLOAT32_C(   577.92), SIMDE_FLOAT32_C(  -699.93), SIMDE_FLOAT32_C(  -727.70), SIMDE_FLOAT32_C(  -176.70) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(   753.83), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(   577.92), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(  -176.70), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(    10.00), SIMDE_FLOAT32_C(    11.00),
+        SIMDE_FLOAT32_C(    12.00), SIMDE_FLOAT32_C(   350.84), SIMDE_FLOAT32_C(    14.00), SIMDE_FLOAT32_C(    15.00) } },
+    { UINT8_C(  2),
+      {  INT32_C(           5),  INT32_C(           4),  INT32_C(          11),  INT32_C(          15),  INT32_C(           3),  INT32_C(           6),  INT32_C(           3),  INT32_C(           8) },
+      { SIMDE_FLOAT32_C(   955.13), SIMDE_FLOAT32_C(  -318.09), SIMDE_FLOAT32_C(  -667.44), SIMDE_FLOAT32_C(  -912.18),
+        SIMDE_FLOAT32_C(   352.73), SIMDE_FLOAT32_C(  -921.19), SIMDE_FLOAT32_C(   220.34), SIMDE_FLOAT32_C(    90.38) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(  -318.09), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(    10.00), SIMDE_FLOAT32_C(    11.00),
+        SIMDE_FLOAT32_C(    12.00), SIMDE_FLOAT32_C(    13.00), SIMDE_FLOAT32_C(    14.00), SIMDE_FLOAT32_C(    15.00) } },
+    { UINT8_C(249),
+      {  INT32_C(           6),  INT32_C(           1),  INT32_C(          12),  INT32_C(           4),  INT32_C(           5),  INT32_C(           1),  INT32_C(           1),  INT32_C(          15) },
+      { SIMDE_FLOAT32_C(   392.36), SIMDE_FLOAT32_C(   482.41), SIMDE_FLOAT32_C(  -696.38), SIMDE_FLOAT32_C(  -302.08),
+        SIMDE_FLOAT32_C(  -547.12), SIMDE_FLOAT32_C(   992.85), SIMDE_FLOAT32_C(  -176.99), SIMDE_FLOAT32_C(   471.50) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -176.99), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(  -302.08), SIMDE_FLOAT32_C(  -547.12), SIMDE_FLOAT32_C(   392.36), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(    10.00), SIMDE_FLOAT32_C(    11.00),
+        SIMDE_FLOAT32_C(    12.00), SIMDE_FLOAT32_C(    13.00), SIMDE_FLOAT32_C(    14.00), SIMDE_FLOAT32_C(   471.50) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32 r[16];
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(simde_float32, j); }
+    simde_mm256_mask_i32scatter_ps(r, test_vec[i].k, simde_mm256_loadu_epi32(test_vec[i].vindex), simde_mm256_loadu_ps(test_vec[i].a), 4);
+    simde_assert_equal_vf32(16, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    int32_t vindex[8];
+    simde_float32 a[8], r[16];
+    for (size_t j = 0 ; j < (sizeof(vindex) / sizeof(vindex[0])) ; j++) { vindex[j] = simde_test_codegen_random_i32() & 15; }
+    simde_test_codegen_random_vf32(8, a, HEDLEY_STATIC_CAST(simde_float32, -1000.0), HEDLEY_STATIC_CAST(simde_float32, 1000.0));
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(simde_float32, j); }
+    simde_mm256_mask_i32scatter_ps(r, k, simde_mm256_loadu_epi32(vindex), simde_mm256_loadu_ps(a), 4);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_vi32(2, 8, vindex, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vf32(2, 8, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vf32(2, 16, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_mask_i64scatter_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t vindex[4];
+    const int32_t a[4];
+    const int32_t r[8];
+  } test_vec[] = {
+    { UINT8_C( 10),
+      {  INT64_C(                   6),  INT64_C(                   7),  INT64_C(                   1),  INT64_C(                   3) },
+      {  INT32_C(  1617891553), -INT32_C(  1353226633),  INT32_C(  1638186827), -INT32_C(   823375339) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           2), -INT32_C(   823375339),  INT32_C(           4),  INT32_C(           5),  INT32_C(           6), -INT32_C(  1353226633) } },
+    { UINT8_C(129),
+      {  INT64_C(                   6),  INT64_C(                   6),  INT64_C(                   4),  INT64_C(                   5) },
+      { -INT32_C(   833217670), -INT32_C(   504099086),  INT32_C(   833917695),  INT32_C(   443836830) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           2),  INT32_C(           3),  INT32_C(           4),  INT32_C(           5), -INT32_C(   833217670),  INT32_C(           7) } },
+    { UINT8_C(126),
+      {  INT64_C(                   7),  INT64_C(                   5),  INT64_C(                   1),  INT64_C(                   1) },
+      {  INT32_C(   315902952), -INT32_C(  1228244383),  INT32_C(  1310391672),  INT32_C(  1514141953) },
+      {  INT32_C(           0),  INT32_C(  1514141953),  INT32_C(           2),  INT32_C(           3),  INT32_C(           4), -INT32_C(  1228244383),  INT32_C(           6),  INT32_C(           7) } },
+    { UINT8_C(165),
+      {  INT64_C(                   2),  INT64_C(                   1),  INT64_C(                   7),  INT64_C(                   1) },
+      {  INT32_C(  1047004437), -INT32_C(   956249986), -INT32_C(  1359163637), -INT32_C(  1164109350) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(  1047004437),  INT32_C(           3),  INT32_C(           4),  INT32_C(           5),  INT32_C(           6), -INT32_C(  1359163637) } },
+    { UINT8_C( 72),
+      {  INT64_C(                   5),  INT64_C(                   1),  INT64_C(                   7),  INT64_C(                   6) },
+      {  INT32_C(   894491215),  INT32_C(  1144743187), -INT32_C(  2100846444), -INT32_C(   696885113) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           2),  INT32_C(           3),  INT32_C(           4),  INT32_C(           5), -INT32_C(   696885113),  INT32_C(           7) } },
+    { UINT8_C( 55),
+      {  INT64_C(                   0),  INT64_C(                   7),  INT64_C(                   3),  INT64_C(                   0) },
+      {  INT32_C(   788061470), -INT32_C(   904965997),  INT32_C(   926703351),  INT32_C(    89193994) },
+      {  INT32_C(   788061470),  INT32_C(           1),  INT32_C(           2),  INT32_C(   926703351),  INT32_C(           4),  INT32_C(           5),  INT32_C(           6), -INT32_C(   904965997) } },
+    { UINT8_C(246),
+      {  INT64_C(                   5),  INT64_C(                   7),  INT64_C(                   5),  INT64_C(                   3) },
+      {  INT32_C(   298197430),  INT32_C(  1961028637),  INT32_C(   922526121), -INT32_C(  1012883146) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           2),  INT32_C(           3),  INT32_C(           4),  INT32_C(   922526121),  INT32_C(           6),  INT32_C(  1961028637) } },
+    { UINT8_C(117),
+      {  INT64_C(                   5),  INT64_C(                   3),  INT64_C(                   4),  INT64_C(                   0) },
+      { -INT32_C(  1880588774), -INT32_C(    99659753),  INT32_C(   456060089),  INT32_C(   496834977) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           2),  INT32_C(           3),  INT32_C(   456060089), -INT32_C(  1880588774),  INT32_C(           6),  INT32_C(           7) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int32_t r[8];
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(int32_t, j); }
+    simde_mm256_mask_i64scatter_epi32(r, test_vec[i].k, simde_mm256_loadu_epi64(test_vec[i].vindex), simde_mm_loadu_epi32(test_vec[i].a), 4);
+    simde_assert_equal_vi32(8, r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    int64_t vindex[4];
+    int32_t a[4], r[8];
+    for (size_t j = 0 ; j < (sizeof(vindex) / sizeof(vindex[0])) ; j++) { vindex[j] = simde_test_codegen_random_i64() & 7; }
+    for (size_t j = 0 ; j < (sizeof(a) / sizeof(a[0])) ; j++) { a[j] = simde_test_codegen_random_i32(); }
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(int32_t, j); }
+    simde_mm256_mask_i64scatter_epi32(r, k, simde_mm256_loadu_epi64(vindex), simde_mm_loadu_epi32(a), 4);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_vi64(2, 4, vindex, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi32(2, 4, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi32(2, 8, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_mask_i64scatter_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t vindex[4];
+    const int64_t a[4];
+    const int64_t r[8];
+  } test_vec[] = {
+    { UINT8_C( 20),
+      {  INT64_C(                   5),  INT64_C(                   0),  INT64_C(                   3),  INT64_C(                   2) },
+      { -INT64_C( 5476122557838779766),  INT64_C( 4895713031273957115), -INT64_C( 8648314752259931557),  INT64_C( 8251371770319922010) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   2), -INT64_C( 8648314752259931557),
+         INT64_C(                   4),  INT64_C(                   5),  INT64_C(                   6),  INT64_C(                   7) } },
+    { UINT8_C(220),
+      {  INT64_C(                   6),  INT64_C(                   1),  INT64_C(                   4),  INT64_C(                   2) },
+      {  INT64_C( 1607363562984409184), -INT64_C( 2628846094744241760),  INT64_C( 5695687718711059722), -INT64_C( 7884478921136904890) },
+      {  INT64_C(                   0),  INT64_C(                   1), -INT64_C( 7884478921136904890),  INT64_C(                   3),
+         INT64_C( 5695687718711059722),  INT64_C(                   5),  INT64_C(                   6),  INT64_C(                   7) } },
+    { UINT8_C( 61),
+      {  INT64_C(                   3),  INT64_C(                   0),  INT64_C(                   3),  INT64_C(                   0) },
+      {  INT64_C( 8270352613399391075), -INT64_C( 5829477005288424657), -INT64_C( 1656893852285907661), -INT64_C( 8339048951961990144) },
+      { -INT64_C( 8339048951961990144),  INT64_C(                   1),  INT64_C(                   2), -INT64_C( 1656893852285907661),
+         INT64_C(                   4),  INT64_C(                   5),  INT64_C(                   6),  INT64_C(                   7) } },
+    { UINT8_C(170),
+      {  INT64_C(                   2),  INT64_C(                   0),  INT64_C(                   2),  INT64_C(                   3) },
+      { -INT64_C( 9027919510835229980), -INT64_C( 8748883235821024866),  INT64_C( 8672958053379213525), -INT64_C(  978750002580164712) },
+      { -INT64_C( 8748883235821024866),  INT64_C(                   1),  INT64_C(                   2), -INT64_C(  978750002580164712),
+         INT64_C(                   4),  INT64_C(                   5),  INT64_C(                   6),  INT64_C(                   7) } },
+    { UINT8_C(210),
+      {  INT64_C(                   3),  INT64_C(                   1),  INT64_C(                   4),  INT64_C(                   6) },
+      { -INT64_C( 5563808313690524912),  INT64_C( 7438466278392428440),  INT64_C( 2706252329957225504),  INT64_C(  719876623199586899) },
+      {  INT64_C(                   0),  INT64_C( 7438466278392428440),  INT64_C(                   2),  INT64_C(                   3),
+         INT64_C(                   4),  INT64_C(                   5),  INT64_C(                   6),  INT64_C(                   7) } },
+    { UINT8_C(247),
+      {  INT64_C(                   2),  INT64_C(                   7),  INT64_C(                   0),  INT64_C(                   7) },
+      { -INT64_C( 1946898519656258929), -INT64_C( 3779631026198275917), -INT64_C( 5836784621793715311),  INT64_C( 4856406192845575463) },
+      { -INT64_C( 5836784621793715311),  INT64_C(                   1), -INT64_C( 1946898519656258929),  INT64_C(                   3),
+         INT64_C(                   4),  INT64_C(                   5),  INT64_C(                   6), -INT64_C( 3779631026198275917) } },
+    { UINT8_C( 13),
+      {  INT64_C(                   4),  INT64_C(                   6),  INT64_C(                   5),  INT64_C(                   6) },
+      { -INT64_C(  182267659172546097),  INT64_C(  650371284345156691), -INT64_C( 5255435915909030835), -INT64_C( 6842296237950447823) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   2),  INT64_C(                   3),
+        -INT64_C(  182267659172546097), -INT64_C( 5255435915909030835), -INT64_C( 6842296237950447823),  INT64_C(                   7) } },
+    { UINT8_C(192),
+      {  INT64_C(                   5),  INT64_C(                   6),  INT64_C(                   4),  INT64_C(                   7) },
+      {  INT64_C( 1914492001250119481), -INT64_C( 5408508280862051280), -INT64_C( 8641440352928464438), -INT64_C( 6235701594616270402) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   2),  INT64_C(                   3),
+         INT64_C(                   4),  INT64_C(                   5),  INT64_C(                   6),  INT64_C(                   7) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int64_t r[8];
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(int64_t, j); }
+    simde_mm256_mask_i64scatter_epi64(r, test_vec[i].k, simde_mm256_loadu_epi64(test_vec[i].vindex), simde_mm256_loadu_epi64(test_vec[i].a), 8);
+    simde_assert_equal_vi64(8, r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    int64_t vindex[4];
+    int64_t a[4], r[8];
+    for (size_t j = 0 ; j < (sizeof(vindex) / sizeof(vindex[0])) ; j++) { vindex[j] = simde_test_codegen_random_i64() & 7; }
+    for (size_t j = 0 ; j < (sizeof(a) / sizeof(a[0])) ; j++) { a[j] = simde_test_codegen_random_i64(); }
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(int64_t, j); }
+    simde_mm256_mask_i64scatter_epi64(r, k, simde_mm256_loadu_epi64(vindex), simde_mm256_loadu_epi64(a), 8);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_vi64(2, 4, vindex, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi64(2, 4, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi64(2, 8, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_mask_i64scatter_pd (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t vindex[4];
+    const simde_float64 a[4];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { UINT8_C(101),
+      {  INT64_C(                   5),  INT64_C(                   1),  INT64_C(                   6),  INT64_C(                   6) },
+      { SIMDE_FLOAT64_C(  -135.04), SIMDE_FLOAT64_C(   384.25), SIMDE_FLOAT64_C(  -267.34), SIMDE_FLOAT64_C(  -646.60) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(     3.00),
+        SIMDE_FLOAT64_C(     4.00), SIMDE_FLOAT64_C(  -135.04), SIMDE_FLOAT64_C(  -267.34), SIMDE_FLOAT64_C(     7.00) } },
+    {    UINT8_MAX,
+      {  INT64_C(                   2),  INT64_C(                   1),  INT64_C(                   2),  INT64_C(                   7) },
+      { SIMDE_FLOAT64_C(   895.59), SIMDE_FLOAT64_C(   326.10), SIMDE_FLOAT64_C(  -283.07), SIMDE_FLOAT64_C(  -856.10) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   326.10), SIMDE_FLOAT64_C(  -283.07), SIMDE_FLOAT64_C(     3.00),
+        SIMDE_FLOAT64_C(     4.00), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(  -856.10) } },
+    { UINT8_C(115),
+      {  INT64_C(                   2),  INT64_C(                   2),  INT64_C(                   1),  INT64_C(                   3) },
+      { SIMDE_FLOAT64_C(   809.39), SIMDE_FLOAT64_C(  -662.82), SIMDE_FLOAT64_C(  -117.07), SIMDE_FLOAT64_C(   779.87) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(  -662.82), SIMDE_FLOAT64_C(     3.00),
+        SIMDE_FLOAT64_C(     4.00), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(     7.00) } },
+    { UINT8_C( 43),
+      {  INT64_C(                   5),  INT64_C(                   4),  INT64_C(                   2),  INT64_C(                   6) },
+      { SIMDE_FLOAT64_C(  -967.93), SIMDE_FLOAT64_C(  -425.65), SIMDE_FLOAT64_C(   911.66), SIMDE_FLOAT64_C(  -963.70) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(     3.00),
+        SIMDE_FLOAT64_C(  -425.65), SIMDE_FLOAT64_C(  -967.93), SIMDE_FLOAT64_C(  -963.70), SIMDE_FLOAT64_C(     7.00) } },
+    { UINT8_C(143),
+      {  INT64_C(                   3),  INT64_C(                   3),  INT64_C(                   3),  INT64_C(                   4) },
+      { SIMDE_FLOAT64_C(  -958.04), SIMDE_FLOAT64_C(  -721.42), SIMDE_FLOAT64_C(   391.28), SIMDE_FLOAT64_C(  -103.39) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(   391.28),
+        SIMDE_FLOAT64_C(  -103.39), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(     7.00) } },
+    { UINT8_C( 21),
+      {  INT64_C(                   7),  INT64_C(                   0),  INT64_C(                   5),  INT64_C(                   1) },
+      { SIMDE_FLOAT64_C(  -746.99), SIMDE_FLOAT64_C(   443.77), SIMDE_FLOAT64_C(   399.84), SIMDE_FLOAT64_C(   716.75) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(     3.00),
+        SIMDE_FLOAT64_C(     4.00), SIMDE_FLOAT64_C(   399.84), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(  -746.99) } },
+    { UINT8_C(  5),
+      {  INT64_C(                   4),  INT64_C(                   4),  INT64_C(                   7),  INT64_C(                   5) },
+      { SIMDE_FLOAT64_C(   138.22), SIMDE_FLOAT64_C(  -522.60), SIMDE_FLOAT64_C(   106.48), SIMDE_FLOAT64_C(   710.49) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(     3.00),
+        SIMDE_FLOAT64_C(   138.22), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(   106.48) } },
+    { UINT8_C(185),
+      {  INT64_C(                   1),  INT64_C(                   4),  INT64_C(                   5),  INT64_C(                   3) },
+      { SIMDE_FLOAT64_C(   738.42), SIMDE_FLOAT64_C(   991.50), SIMDE_FLOAT64_C(   508.87), SIMDE_FLOAT64_C(   694.41) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   738.42), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(   694.41),
+        SIMDE_FLOAT64_C(     4.00), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(     7.00) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64 r[8];
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(simde_float64, j); }
+    simde_mm256_mask_i64scatter_pd(r, test_vec[i].k, simde_mm256_loadu_epi64(test_vec[i].vindex), simde_mm256_loadu_pd(test_vec[i].a), 8);
+    simde_assert_equal_vf64(8, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    int64_t vindex[4];
+    simde_float64 a[4], r[8];
+    for (size_t j = 0 ; j < (sizeof(vindex) / sizeof(vindex[0])) ; j++) { vindex[j] = simde_test_codegen_random_i64() & 7; }
+    simde_test_codegen_random_vf64(4, a, HEDLEY_STATIC_CAST(simde_float64, -1000.0), HEDLEY_STATIC_CAST(simde_float64, 1000.0));
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(simde_float64, j); }
+    simde_mm256_mask_i64scatter_pd(r, k, simde_mm256_loadu_epi64(vindex), simde_mm256_loadu_pd(a), 8);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_vi64(2, 4, vindex, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vf64(2, 4, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vf64(2, 8, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_mask_i64scatter_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t vindex[4];
+    const simde_float32 a[4];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { UINT8_C(133),
+      {  INT64_C(                   5),  INT64_C(                   0),  INT64_C(                   3),  INT64_C(                   1) },
+      { SIMDE_FLOAT32_C(  -139.86), SIMDE_FLOAT32_C(   588.40), SIMDE_FLOAT32_C(  -213.46), SIMDE_FLOAT32_C(  -167.59) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(  -213.46),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(  -139.86), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     7.00) } },
+    { UINT8_C(124),
+      {  INT64_C(                   1),  INT64_C(                   5),  INT64_C(                   2),  INT64_C(                   1) },
+      { SIMDE_FLOAT32_C(  -701.82), SIMDE_FLOAT32_C(  -929.14), SIMDE_FLOAT32_C(   509.92), SIMDE_FLOAT32_C(  -295.73) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -295.73), SIMDE_FLOAT32_C(   509.92), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     7.00) } },
+    { UINT8_C(159),
+      {  INT64_C(                   5),  INT64_C(                   6),  INT64_C(                   4),  INT64_C(                   5) },
+      { SIMDE_FLOAT32_C(   719.61), SIMDE_FLOAT32_C(  -713.55), SIMDE_FLOAT32_C(   255.10), SIMDE_FLOAT32_C(   889.59) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(   255.10), SIMDE_FLOAT32_C(   889.59), SIMDE_FLOAT32_C(  -713.55), SIMDE_FLOAT32_C(     7.00) } },
+    { UINT8_C(180),
+      {  INT64_C(                   5),  INT64_C(                   4),  INT64_C(                   5),  INT64_C(                   3) },
+      { SIMDE_FLOAT32_C(  -714.07), SIMDE_FLOAT32_C(   511.37), SIMDE_FLOAT32_C(    14.84), SIMDE_FLOAT32_C(   967.02) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(    14.84), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     7.00) } },
+    { UINT8_C( 57),
+      {  INT64_C(                   5),  INT64_C(                   5),  INT64_C(                   0),  INT64_C(                   5) },
+      { SIMDE_FLOAT32_C(   321.26), SIMDE_FLOAT32_C(   747.38), SIMDE_FLOAT32_C(   430.49), SIMDE_FLOAT32_C(  -100.04) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(  -100.04), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     7.00) } },
+    { UINT8_C(161),
+      {  INT64_C(                   2),  INT64_C(                   2),  INT64_C(                   0),  INT64_C(                   1) },
+      { SIMDE_FLOAT32_C(  -729.51), SIMDE_FLOAT32_C(  -402.48), SIMDE_FLOAT32_C(   489.64), SIMDE_FLOAT32_C(   111.56) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(  -729.51), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     7.00) } },
+    { UINT8_C(164),
+      {  INT64_C(                   7),  INT64_C(                   5),  INT64_C(                   6),  INT64_C(                   2) },
+      { SIMDE_FLOAT32_C(   376.39), SIMDE_FLOAT32_C(   283.47), SIMDE_FLOAT32_C(   930.89), SIMDE_FLOAT32_C(  -101.58) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(   930.89), SIMDE_FLOAT32_C(     7.00) } },
+    { UINT8_C( 74),
+      {  INT64_C(                   6),  INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   2) },
+      { SIMDE_FLOAT32_C(   533.34), SIMDE_FLOAT32_C(  -807.99), SIMDE_FLOAT32_C(  -535.01), SIMDE_FLOAT32_C(    31.02) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -807.99), SIMDE_FLOAT32_C(    31.02), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     7.00) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32 r[8];
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(simde_float32, j); }
+    simde_mm256_mask_i64scatter_ps(r, test_vec[i].k, simde_mm256_loadu_epi64(test_vec[i].vindex), simde_mm_loadu_ps(test_vec[i].a), 4);
+    simde_assert_equal_vf32(8, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    int64_t vindex[4];
+    simde_float32 a[4], r[8];
+    for (size_t j = 0 ; j < (sizeof(vindex) / sizeof(vindex[0])) ; j++) { vindex[j] = simde_test_codegen_random_i64() & 7; }
+    simde_test_codegen_random_vf32(4, a, HEDLEY_STATIC_CAST(simde_float32, -1000.0), HEDLEY_STATIC_CAST(simde_float32, 1000.0));
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(simde_float32, j); }
+    simde_mm256_mask_i64scatter_ps(r, k, simde_mm256_loadu_epi64(vindex), simde_mm_loadu_ps(a), 4);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_vi64(2, 4, vindex, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vf32(2, 4, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vf32(2, 8, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_mask_i32scatter_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t vindex[16];
+    const int32_t a[16];
+    const int32_t r[32];
+  } test_vec[] = {
+    { UINT16_C(48079),
+      {  INT32_C(          12),  INT32_C(          22),  INT32_C(           5),  INT32_C(           3),  INT32_C(          14),  INT32_C(          11),  INT32_C(          28),  INT32_C(          13),
+         INT32_C(          16),  INT32_C(           2),  INT32_C(           5),  INT32_C(          10),  INT32_C(           6),  INT32_C(          20),  INT32_C(          16),  INT32_C(           0) },
+      {  INT32_C(  2067250777), -INT32_C(  1524465536),  INT32_C(  1387187720), -INT32_C(   930434462),  INT32_C(   257579578), -INT32_C(  1627408082),  INT32_C(  1113376194),  INT32_C(  1976824604),
+         INT32_C(   854592434), -INT32_C(  1814556021),  INT32_C(  1122338528),  INT32_C(  1930063928), -INT32_C(   125672246), -INT32_C(   526941922),  INT32_C(  1663234887), -INT32_C(  1730611482) },
+      { -INT32_C(  1730611482),  INT32_C(           1), -INT32_C(  1814556021), -INT32_C(   930434462),  INT32_C(           4),  INT32_C(  1387187720), -INT32_C(   125672246),  INT32_C(           7),
+         INT32_C(           8),  INT32_C(           9),  INT32_C(  1930063928),  INT32_C(          11),  INT32_C(  2067250777),  INT32_C(  1976824604),  INT32_C(          14),  INT32_C(          15),
+         INT32_C(   854592434),  INT32_C(          17),  INT32_C(          18),  INT32_C(          19), -INT32_C(   526941922),  INT32_C(          21), -INT32_C(  1524465536),  INT32_C(          23),
+         INT32_C(          24),  INT32_C(          25),  INT32_C(          26),  INT32_C(          27),  INT32_C(  1113376194),  INT32_C(          29),  INT32_C(          30),  INT32_C(          31) } },
+    { UINT16_C(51201),
+      {  INT32_C(          11),  INT32_C(           0),  INT32_C(          28),  INT32_C(          20),  INT32_C(          24),  INT32_C(           9),  INT32_C(           2),  INT32_C(           1),
+         INT32_C(          15),  INT32_C(          22),  INT32_C(          25),  INT32_C(           9),  INT32_C(          12),  INT32_C(          27),  INT32_C(          27),  INT32_C(           5) },
+      {  INT32_C(   199448405),  INT32_C(  1757222703), -INT32_C(  1418299711),  INT32_C(  1187830681),  INT32_C(  1935392023), -INT32_C(   900662161), -INT32_C(   999913441),  INT32_C(   930615009),
+        -INT32_C(  1807590555),  INT32_C(   888995954),  INT32_C(   266302326),  INT32_C(  1716890446), -INT32_C(   656821912), -INT32_C(   861787731), -INT32_C(  1819276879),  INT32_C(  2110392343) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           2),  INT32_C(           3),  INT32_C(           4),  INT32_C(  2110392343),  INT32_C(           6),  INT32_C(           7),
+         INT32_C(           8),  INT32_C(  1716890446),  INT32_C(          10),  INT32_C(   199448405),  INT32_C(          12),  INT32_C(          13),  INT32_C(          14),  INT32_C(          15),
+         INT32_C(          16),  INT32_C(          17),  INT32_C(          18),  INT32_C(          19),  INT32_C(          20),  INT32_C(          21),  INT32_C(          22),  INT32_C(          23),
+         INT32_C(          24),  INT32_C(          25),  INT32_C(          26), -INT32_C(  1819276879),  INT32_C(          28),  INT32_C(          29),  INT32_C(          30),  INT32_C(          31) } },
+    { UINT16_C( 3171),
+      {  INT32_C(          17),  INT32_C(          10),  INT32_C(          18),  INT32_C(          22),  INT32_C(          21),  INT32_C(          18),  INT32_C(          29),  INT32_C(          21),
+         INT32_C(           5),  INT32_C(           3),  INT32_C(           7),  INT32_C(           9),  INT32_C(          27),  INT32_C(          17),  INT32_C(          14),  INT32_C(          11) },
+      {  INT32_C(  1300184938),  INT32_C(  2109888502),  INT32_C(   758849475),  INT32_C(  1332414740),  INT32_C(    10232079),  INT32_C(   644844888), -INT32_C(   737532631), -INT32_C(  1721494481),
+         INT32_C(  1239933779), -INT32_C(    37312198), -INT32_C(   601226552),  INT32_C(   439064075),  INT32_C(   253479095),  INT32_C(  2117503573), -INT32_C(   565034833), -INT32_C(  1485326764) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           2),  INT32_C(           3),  INT32_C(           4),  INT32_C(           5),  INT32_C(           6), -INT32_C(   601226552),
+         INT32_C(           8),  INT32_C(   439064075),  INT32_C(  2109888502),  INT32_C(          11),  INT32_C(          12),  INT32_C(          13),  INT32_C(          14),  INT32_C(          15),
+         INT32_C(          16),  INT32_C(  1300184938),  INT32_C(   644844888),  INT32_C(          19),  INT32_C(          20),  INT32_C(          21),  INT32_C(          22),  INT32_C(          23),
+         INT32_C(          24),  INT32_C(          25),  INT32_C(          26),  INT32_C(          27),  INT32_C(          28), -INT32_C(   737532631),  INT32_C(          30),  INT32_C(          31) } },
+    { UINT16_C(24217),
+      {  INT32_C(          16),  INT32_C(          16),  INT32_C(          13),  INT32_C(          30),  INT32_C(          24),  INT32_C(          19),  INT32_C(          16),  INT32_C(           9),
+         INT32_C(           7),  INT32_C(          30),  INT32_C(          11),  INT32_C(          12),  INT32_C(          26),  INT32_C(          23),  INT32_C(           2),  INT32_C(           3) },
+      { -INT32_C(  1589488413),  INT32_C(  1728968060), -INT32_C(   969846471),  INT32_C(   262861621), -INT32_C(  1336074951), -INT32_C(  1070043043), -INT32_C(  1578416130),  INT32_C(   523030588),
+        -INT32_C(  1598001628), -INT32_C(  1660433052),  INT32_C(  1415788574),  INT32_C(  1700990508), -INT32_C(  2011840469),  INT32_C(   793267504), -INT32_C(   791661420),  INT32_C(   686816260) },
+      {  INT32_C(           0),  INT32_C(           1), -INT32_C(   791661420),  INT32_C(           3),  INT32_C(           4),  INT32_C(           5),  INT32_C(           6),  INT32_C(           7),
+         INT32_C(           8),  INT32_C(   523030588),  INT32_C(          10),  INT32_C(  1415788574),  INT32_C(  1700990508),  INT32_C(          13),  INT32_C(          14),  INT32_C(          15),
+        -INT32_C(  1589488413),  INT32_C(          17),  INT32_C(          18),  INT32_C(          19),  INT32_C(          20),  INT32_C(          21),  INT32_C(          22),  INT32_C(          23),
+        -INT32_C(  1336074951),  INT32_C(          25), -INT32_C(  2011840469),  INT32_C(          27),  INT32_C(          28),  INT32_C(          29), -INT32_C(  1660433052),  INT32_C(          31) } },
+    { UINT16_C(45163),
+      {  INT32_C(           8),  INT32_C(          12),  INT32_C(          16),  INT32_C(          25),  INT32_C(          17),  INT32_C(          19),  INT32_C(           1),  INT32_C(          26),
+         INT32_C(          26),  INT32_C(          26),  INT32_C(          13),  INT32_C(          30),  INT32_C(          22),  INT32_C(           1),  INT32_C(           9),  INT32_C(          25) },
+      {  INT32_C(   733689617),  INT32_C(   506819088), -INT32_C(  1513843961), -INT32_C(  1160505084),  INT32_C(  1290067562),  INT32_C(   529420789),  INT32_C(  1501700607), -INT32_C(   970069835),
+         INT32_C(   804448287),  INT32_C(  1632446298), -INT32_C(  1090121030), -INT32_C(  1770399189), -INT32_C(  1360896584), -INT32_C(  1362267985),  INT32_C(  1191661458),  INT32_C(  1443705911) },
+      {  INT32_C(           0), -INT32_C(  1362267985),  INT32_C(           2),  INT32_C(           3),  INT32_C(           4),  INT32_C(           5),  INT32_C(           6),  INT32_C(           7),
+         INT32_C(   733689617),  INT32_C(           9),  INT32_C(          10),  INT32_C(          11),  INT32_C(   506819088),  INT32_C(          13),  INT32_C(          14),  INT32_C(          15),
+         INT32_C(          16),  INT32_C(          17),  INT32_C(          18),  INT32_C(   529420789),  INT32_C(          20),  INT32_C(          21), -INT32_C(  1360896584),  INT32_C(          23),
+         INT32_C(          24),  INT32_C(  1443705911),  INT32_C(          26),  INT32_C(          27),  INT32_C(          28),  INT32_C(          29),  INT32_C(          30),  INT32_C(          31) } },
+    { UINT16_C(65308),
+      {  INT32_C(           6),  INT32_C(          23),  INT32_C(           0),  INT32_C(           7),  INT32_C(          30),  INT32_C(          21),  INT32_C(          18),  INT32_C(           9),
+         INT32_C(           4),  INT32_C(           8),  INT32_C(          25),  INT32_C(           1),  INT32_C(           0),  INT32_C(          14),  INT32_C(          25),  INT32_C(          16) },
+      {  INT32_C(  1313895270), -INT32_C(  1797805701),  INT32_C(   995391930), -INT32_C(   723804781), -INT32_C(  1360435232),  INT32_C(  1716443949),  INT32_C(   258527198), -INT32_C(  1780238033),
+        -INT32_C(  1461439699), -INT32_C(  1774339108), -INT32_C(   925724364),  INT32_C(   261926191),  INT32_C(  1119716628),  INT32_C(  1067977569),  INT32_C(   156111322), -INT32_C(   140561718) },
+      {  INT32_C(  1119716628),  INT32_C(   261926191),  INT32_C(           2),  INT32_C(           3), -INT32_C(  1461439699),  INT32_C(           5),  INT32_C(           6), -INT32_C(   723804781),
+        -INT32_C(  1774339108),  INT32_C(           9),  INT32_C(          10),  INT32_C(          11),  INT32_C(          12),  INT32_C(          13),  INT32_C(  1067977569),  INT32_C(          15),
+        -INT32_C(   140561718),  INT32_C(          17),  INT32_C(          18),  INT32_C(          19),  INT32_C(          20),  INT32_C(          21),  INT32_C(          22),  INT32_C(          23),
+         INT32_C(          24),  INT32_C(   156111322),  INT32_C(          26),  INT32_C(          27),  INT32_C(          28),  INT32_C(          29), -INT32_C(  1360435232),  INT32_C(          31) } },
+    { UINT16_C(33637),
+      {  INT32_C(           0),  INT32_C(          24),  INT32_C(          26),  INT32_C(          12),  INT32_C(          14),  INT32_C(          28),  INT32_C(          25),  INT32_C(          10),
+         INT32_C(           4),  INT32_C(          11),  INT32_C(          19),  INT32_C(          12),  INT32_C(          21),  INT32_C(          13),  INT32_C(          12),  INT32_C(          28) },
+      {  INT32_C(  1042196242),  INT32_C(  1873069500),  INT32_C(   835707077), -INT32_C(   833906567),  INT32_C(  1663090134), -INT32_C(  1572160106), -INT32_C(   724031273), -INT32_C(  1795827582),
+         INT32_C(  1020400511), -INT32_C(  1649707304), -INT32_C(   791774633), -INT32_C(   392291822),  INT32_C(  1833746391),  INT32_C(  1410373244),  INT32_C(  1076422846),  INT32_C(  1087708609) },
+      {  INT32_C(  1042196242),  INT32_C(           1),  INT32_C(           2),  INT32_C(           3),  INT32_C(  1020400511),  INT32_C(           5),  INT32_C(           6),  INT32_C(           7),
+         INT32_C(           8),  INT32_C(           9),  INT32_C(          10), -INT32_C(  1649707304),  INT32_C(          12),  INT32_C(          13),  INT32_C(          14),  INT32_C(          15),
+         INT32_C(          16),  INT32_C(          17),  INT32_C(          18),  INT32_C(          19),  INT32_C(          20),  INT32_C(          21),  INT32_C(          22),  INT32_C(          23),
+         INT32_C(          24), -INT32_C(   724031273),  INT32_C(   835707077),  INT32_C(          27),  INT32_C(  1087708609),  INT32_C(          29),  INT32_C(          30),  INT32_C(          31) } },
+    { UINT16_C(42800),
+      {  INT32_C(          28),  INT32_C(           6),  INT32_C(           5),  INT32_C(          29),  INT32_C(          19),  INT32_C(          19),  INT32_C(          30),  INT32_C(          13),
+         INT32_C(          16),  INT32_C(          14),  INT32_C(           9),  INT32_C(          31),  INT32_C(          24),  INT32_C(          13),  INT32_C(          13),  INT32_C(           6) },
+      { -INT32_C(  2119330317),  INT32_C(  1918154921),  INT32_C(  1356335953), -INT32_C(   601741212),  INT32_C(    96983032),  INT32_C(  1704021336), -INT32_C(  1321242229),  INT32_C(  1070031435),
+        -INT32_C(  1597999881),  INT32_C(  2115114284), -INT32_C(  2066814176),  INT32_C(   190902547),  INT32_C(   537995208), -INT32_C(     8019340),  INT32_C(  1605420051),  INT32_C(   513701671) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           2),  INT32_C(           3),  INT32_C(           4),  INT32_C(           5),  INT32_C(   513701671),  INT32_C(           7),
+         INT32_C(           8), -INT32_C(  2066814176),  INT32_C(          10),  INT32_C(          11),  INT32_C(          12), -INT32_C(     8019340),  INT32_C(  2115114284),  INT32_C(          15),
+        -INT32_C(  1597999881),  INT32_C(          17),  INT32_C(          18),  INT32_C(  1704021336),  INT32_C(          20),  INT32_C(          21),  INT32_C(          22),  INT32_C(          23),
+         INT32_C(          24),  INT32_C(          25),  INT32_C(          26),  INT32_C(          27),  INT32_C(          28),  INT32_C(          29),  INT32_C(          30),  INT32_C(          31) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int32_t r[32];
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(int32_t, j); }
+    simde_mm512_mask_i32scatter_epi32(r, test_vec[i].k, simde_mm512_loadu_epi32(test_vec[i].vindex), simde_mm512_loadu_epi32(test_vec[i].a), 4);
+    simde_assert_equal_vi32(32, r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    int32_t vindex[16];
+    int32_t a[16], r[32];
+    for (size_t j = 0 ; j < (sizeof(vindex) / sizeof(vindex[0])) ; j++) { vindex[j] = simde_test_codegen_random_i32() & 31; }
+    for (size_t j = 0 ; j < (sizeof(a) / sizeof(a[0])) ; j++) { a[j] = simde_test_codegen_random_i32(); }
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(int32_t, j); }
+    simde_mm512_mask_i32scatter_epi32(r, k, simde_mm512_loadu_epi32(vindex), simde_mm512_loadu_epi32(a), 4);
+
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_vi32(2, 16, vindex, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi32(2, 16, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi32(2, 32, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_i32scatter_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int32_t vindex[16];
+    const int32_t a[16];
+    const int32_t r[32];
+  } test_vec[] = {
+    { {  INT32_C(          12),  INT32_C(          19),  INT32_C(          28),  INT32_C(          22),  INT32_C(          30),  INT32_C(          15),  INT32_C(           9),  INT32_C(          25),
+         INT32_C(          30),  INT32_C(          31),  INT32_C(          25),  INT32_C(          20),  INT32_C(          19),  INT32_C(          17),  INT32_C(          24),  INT32_C(           6) },
+      { -INT32_C(  1510624442), -INT32_C(  1061094777), -INT32_C(  1420841961),  INT32_C(   652082547), -INT32_C(  1704385815), -INT32_C(  1848357255), -INT32_C(  1159545292), -INT32_C(  1119987593),
+        -INT32_C(  1822280693),  INT32_C(  1163076142),  INT32_C(  1106289614), -INT32_C(  1989620064),  INT32_C(  1764020720),  INT32_C(  1408956447),  INT32_C(   772725943),  INT32_C(  1089162292) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           2),  INT32_C(           3),  INT32_C(           4),  INT32_C(           5),  INT32_C(  1089162292),  INT32_C(           7),
+         INT32_C(           8), -INT32_C(  1159545292),  INT32_C(          10),  INT32_C(          11), -INT32_C(  1510624442),  INT32_C(          13),  INT32_C(          14), -INT32_C(  1848357255),
+         INT32_C(          16),  INT32_C(  1408956447),  INT32_C(          18),  INT32_C(  1764020720), -INT32_C(  1989620064),  INT32_C(          21),  INT32_C(   652082547),  INT32_C(          23),
+         INT32_C(   772725943),  INT32_C(  1106289614),  INT32_C(          26),  INT32_C(          27), -INT32_C(  1420841961),  INT32_C(          29), -INT32_C(  1822280693),  INT32_C(  1163076142) } },
+    { {  INT32_C(           0),  INT32_C(          15),  INT32_C(           9),  INT32_C(          19),  INT32_C(          24),  INT32_C(          15),  INT32_C(           4),  INT32_C(           5),
+         INT32_C(          12),  INT32_C(          18),  INT32_C(          14),  INT32_C(           1),  INT32_C(          15),  INT32_C(          25),  INT32_C(          21),  INT32_C(          25) },
+      { -INT32_C(   872319622), -INT32_C(  1377314017),  INT32_C(  1995402293),  INT32_C(  1936708836), -INT32_C(  1089322810),  INT32_C(  1906145084),  INT32_C(   153916368),  INT32_C(  1534061793),
+        -INT32_C(  2128121758), -INT32_C(  2127687860),  INT32_C(  1626807675), -INT32_C(  1210882319), -INT32_C(   478681689),  INT32_C(   760550492), -INT32_C(  2009693785), -INT32_C(   807099027) },
+      { -INT32_C(   872319622), -INT32_C(  1210882319),  INT32_C(           2),  INT32_C(           3),  INT32_C(   153916368),  INT32_C(  1534061793),  INT32_C(           6),  INT32_C(           7),
+         INT32_C(           8),  INT32_C(  1995402293),  INT32_C(          10),  INT32_C(          11), -INT32_C(  2128121758),  INT32_C(          13),  INT32_C(  1626807675), -INT32_C(   478681689),
+         INT32_C(          16),  INT32_C(          17), -INT32_C(  2127687860),  INT32_C(  1936708836),  INT32_C(          20), -INT32_C(  2009693785),  INT32_C(          22),  INT32_C(          23),
+        -INT32_C(  1089322810), -INT32_C(   807099027),  INT32_C(          26),  INT32_C(          27),  INT32_C(          28),  INT32_C(          29),  INT32_C(          30),  INT32_C(          31) } },
+    { {  INT32_C(          22),  INT32_C(          26),  INT32_C(          28),  INT32_C(           0),  INT32_C(          15),  INT32_C(          16),  INT32_C(           1),  INT32_C(          20),
+         INT32_C(          15),  INT32_C(          13),  INT32_C(           9),  INT32_C(          31),  INT32_C(          26),  INT32_C(          28),  INT32_C(           1),  INT32_C(           6) },
+      { -INT32_C(   956330728),  INT32_C(  1175494652), -INT32_C(  1781471179), -INT32_C(   542949115), -INT32_C(   628441730), -INT32_C(   774329328), -INT32_C(   727194418), -INT32_C(   422991666),
+         INT32_C(   833407285), -INT32_C(  1636320152), -INT32_C(  1439479900),  INT32_C(   126473865), -INT32_C(  1528753260), -INT32_C(  1921664577),  INT32_C(  1801526685), -INT32_C(    95278139) },
+      { -INT32_C(   542949115),  INT32_C(  1801526685),  INT32_C(           2),  INT32_C(           3),  INT32_C(           4),  INT32_C(           5), -INT32_C(    95278139),  INT32_C(           7),
+         INT32_C(           8), -INT32_C(  1439479900),  INT32_C(          10),  INT32_C(          11),  INT32_C(          12), -INT32_C(  1636320152),  INT32_C(          14),  INT32_C(   833407285),
+        -INT32_C(   774329328),  INT32_C(          17),  INT32_C(          18),  INT32_C(          19), -INT32_C(   422991666),  INT32_C(          21), -INT32_C(   956330728),  INT32_C(          23),
+         INT32_C(          24),  INT32_C(          25), -INT32_C(  1528753260),  INT32_C(          27), -INT32_C(  1921664577),  INT32_C(          29),  INT32_C(          30),  INT32_C(   126473865) } },
+    { {  INT32_C(          20),  INT32_C(          27),  INT32_C(          10),  INT32_C(           4),  INT32_C(           6),  INT32_C(          21),  INT32_C(          14),  INT32_C(           0),
+         INT32_C(          15),  INT32_C(          28),  INT32_C(          24),  INT32_C(           6),  INT32_C(          16),  INT32_C(           2),  INT32_C(          27),  INT32_C(           8) },
+      { -INT32_C(  2038350038),  INT32_C(    63769098), -INT32_C(  1006663779),  INT32_C(  1284543675), -INT32_C(   420298140),  INT32_C(  1664568296), -INT32_C(  1436673086), -INT32_C(  1224618612),
+         INT32_C(   389906957),  INT32_C(   706349709),  INT32_C(  1307450001),  INT32_C(   312049326),  INT32_C(   704219968), -INT32_C(  1735642922), -INT32_C(   683414709), -INT32_C(   980532040) },
+      { -INT32_C(  1224618612),  INT32_C(           1), -INT32_C(  1735642922),  INT32_C(           3),  INT32_C(  1284543675),  INT32_C(           5),  INT32_C(   312049326),  INT32_C(           7),
+        -INT32_C(   980532040),  INT32_C(           9), -INT32_C(  1006663779),  INT32_C(          11),  INT32_C(          12),  INT32_C(          13), -INT32_C(  1436673086),  INT32_C(   389906957),
+         INT32_C(   704219968),  INT32_C(          17),  INT32_C(          18),  INT32_C(          19), -INT32_C(  2038350038),  INT32_C(  1664568296),  INT32_C(          22),  INT32_C(          23),
+         INT32_C(  1307450001),  INT32_C(          25),  INT32_C(          26), -INT32_C(   683414709),  INT32_C(   706349709),  INT32_C(          29),  INT32_C(          30),  INT32_C(          31) } },
+    { {  INT32_C(           7),  INT32_C(          22),  INT32_C(          17),  INT32_C(          10),  INT32_C(          25),  INT32_C(          27),  INT32_C(          11),  INT32_C(          15),
+         INT32_C(          24),  INT32_C(          30),  INT32_C(          21),  INT32_C(          25),  INT32_C(          12),  INT32_C(          31),  INT32_C(          19),  INT32_C(          22) },
+      { -INT32_C(    60988706), -INT32_C(  1607724085),  INT32_C(   945757055),  INT32_C(  1758153436), -INT32_C(  1477505912), -INT32_C(  1450001259),  INT32_C(  1032519846), -INT32_C(  1756691272),
+         INT32_C(   831760486),  INT32_C(  1003601852), -INT32_C(  1233964582),  INT32_C(    52313723), -INT32_C(   525660853),  INT32_C(  1888042441), -INT32_C(   156428995),  INT32_C(  2140010521) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           2),  INT32_C(           3),  INT32_C(           4),  INT32_C(           5),  INT32_C(           6), -INT32_C(    60988706),
+         INT32_C(           8),  INT32_C(           9),  INT32_C(  1758153436),  INT32_C(  1032519846), -INT32_C(   525660853),  INT32_C(          13),  INT32_C(          14), -INT32_C(  1756691272),
+         INT32_C(          16),  INT32_C(   945757055),  INT32_C(          18), -INT32_C(   156428995),  INT32_C(          20), -INT32_C(  1233964582),  INT32_C(  2140010521),  INT32_C(          23),
+         INT32_C(   831760486),  INT32_C(    52313723),  INT32_C(          26), -INT32_C(  1450001259),  INT32_C(          28),  INT32_C(          29),  INT32_C(  1003601852),  INT32_C(  1888042441) } },
+    { {  INT32_C(           1),  INT32_C(           0),  INT32_C(          19),  INT32_C(          10),  INT32_C(          29),  INT32_C(          26),  INT32_C(          20),  INT32_C(          28),
+         INT32_C(          27),  INT32_C(           0),  INT32_C(          29),  INT32_C(          22),  INT32_C(          17),  INT32_C(          17),  INT32_C(          19),  INT32_C(          10) },
+      { -INT32_C(  1673525572),  INT32_C(   909104664),  INT32_C(  1922953692), -INT32_C(  1230660891),  INT32_C(  2107719436), -INT32_C(  1576868689), -INT32_C(   569199500), -INT32_C(   834363886),
+        -INT32_C(  1117092699),  INT32_C(   938711642),  INT32_C(  1906938251),  INT32_C(   925323051),  INT32_C(  1035258254),  INT32_C(   568309421),  INT32_C(  2097148266),  INT32_C(   894124944) },
+      {  INT32_C(   938711642), -INT32_C(  1673525572),  INT32_C(           2),  INT32_C(           3),  INT32_C(           4),  INT32_C(           5),  INT32_C(           6),  INT32_C(           7),
+         INT32_C(           8),  INT32_C(           9),  INT32_C(   894124944),  INT32_C(          11),  INT32_C(          12),  INT32_C(          13),  INT32_C(          14),  INT32_C(          15),
+         INT32_C(          16),  INT32_C(   568309421),  INT32_C(          18),  INT32_C(  2097148266), -INT32_C(   569199500),  INT32_C(          21),  INT32_C(   925323051),  INT32_C(          23),
+         INT32_C(          24),  INT32_C(          25), -INT32_C(  1576868689), -INT32_C(  1117092699), -INT32_C(   834363886),  INT32_C(  1906938251),  INT32_C(          30),  INT32_C(          31) } },
+    { {  INT32_C(           8),  INT32_C(          15),  INT32_C(          23),  INT32_C(          18),  INT32_C(          28),  INT32_C(           3),  INT32_C(          14),  INT32_C(          13),
+         INT32_C(          10),  INT32_C(          11),  INT32_C(          20),  INT32_C(          20),  INT32_C(          10),  INT32_C(           0),  INT32_C(          14),  INT32_C(          24) },
+      {  INT32_C(   809298340),  INT32_C(   254972027),  INT32_C(  1173804849),  INT32_C(  1603648596), -INT32_C(  2136158304),  INT32_C(  1649321748),  INT32_C(  1677630155),  INT32_C(  1025945753),
+         INT32_C(   342712985),  INT32_C(   589603058), -INT32_C(   882369929),  INT32_C(  1982529238), -INT32_C(   503916595),  INT32_C(  1229210750),  INT32_C(  2007778014), -INT32_C(  1934241038) },
+      {  INT32_C(  1229210750),  INT32_C(           1),  INT32_C(           2),  INT32_C(  1649321748),  INT32_C(           4),  INT32_C(           5),  INT32_C(           6),  INT32_C(           7),
+         INT32_C(   809298340),  INT32_C(           9), -INT32_C(   503916595),  INT32_C(   589603058),  INT32_C(          12),  INT32_C(  1025945753),  INT32_C(  2007778014),  INT32_C(   254972027),
+         INT32_C(          16),  INT32_C(          17),  INT32_C(  1603648596),  INT32_C(          19),  INT32_C(  1982529238),  INT32_C(          21),  INT32_C(          22),  INT32_C(  1173804849),
+        -INT32_C(  1934241038),  INT32_C(          25),  INT32_C(          26),  INT32_C(          27), -INT32_C(  2136158304),  INT32_C(          29),  INT32_C(          30),  INT32_C(          31) } },
+    { {  INT32_C(          20),  INT32_C(           2),  INT32_C(          30),  INT32_C(          17),  INT32_C(           6),  INT32_C(           6),  INT32_C(           6),  INT32_C(          12),
+         INT32_C(          20),  INT32_C(          10),  INT32_C(           5),  INT32_C(           4),  INT32_C(          11),  INT32_C(          25),  INT32_C(          23),  INT32_C(           4) },
+      { -INT32_C(   848360445), -INT32_C(  1535770625),  INT32_C(  1492898708),  INT32_C(   119787612), -INT32_C(   568823035),  INT32_C(   664629136),  INT32_C(   101332610),  INT32_C(   908029747),
+         INT32_C(  2047053435),  INT32_C(   555710861), -INT32_C(  1468458420), -INT32_C(   273703446), -INT32_C(  1597126896), -INT32_C(  1194890698), -INT32_C(   725626464), -INT32_C(  1140138432) },
+      {  INT32_C(           0),  INT32_C(           1), -INT32_C(  1535770625),  INT32_C(           3), -INT32_C(  1140138432), -INT32_C(  1468458420),  INT32_C(   101332610),  INT32_C(           7),
+         INT32_C(           8),  INT32_C(           9),  INT32_C(   555710861), -INT32_C(  1597126896),  INT32_C(   908029747),  INT32_C(          13),  INT32_C(          14),  INT32_C(          15),
+         INT32_C(          16),  INT32_C(   119787612),  INT32_C(          18),  INT32_C(          19),  INT32_C(  2047053435),  INT32_C(          21),  INT32_C(          22), -INT32_C(   725626464),
+         INT32_C(          24), -INT32_C(  1194890698),  INT32_C(          26),  INT32_C(          27),  INT32_C(          28),  INT32_C(          29),  INT32_C(  1492898708),  INT32_C(          31) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int32_t r[32];
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(int32_t, j); }
+    simde_mm512_i32scatter_epi32(r, simde_mm512_loadu_epi32(test_vec[i].vindex), simde_mm512_loadu_epi32(test_vec[i].a), 4);
+    simde_assert_equal_vi32(32, r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int32_t vindex[16];
+    int32_t a[16], r[32];
+    for (size_t j = 0 ; j < (sizeof(vindex) / sizeof(vindex[0])) ; j++) { vindex[j] = simde_test_codegen_random_i32() & 31; }
+    for (size_t j = 0 ; j < (sizeof(a) / sizeof(a[0])) ; j++) { a[j] = simde_test_codegen_random_i32(); }
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(int32_t, j); }
+    simde_mm512_i32scatter_epi32(r, simde_mm512_loadu_epi32(vindex), simde_mm512_loadu_epi32(a), 4);
+
+    simde_test_codegen_write_vi32(2, 16, vindex, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_vi32(2, 16, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi32(2, 32, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_mask_i32scatter_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t vindex[8];
+    const int64_t a[8];
+    const int64_t r[16];
+  } test_vec[] = {
+    { UINT8_C(108),
+      {  INT32_C(          14),  INT32_C(           5),  INT32_C(           3),  INT32_C(          10),  INT32_C(           5),  INT32_C(           7),  INT32_C(          15),  INT32_C(          15) },
+      { -INT64_C( 8038529527823670612),  INT64_C( 2953518111954881250), -INT64_C( 6556457077581535775), -INT64_C( 2465425913259246659),
+        -INT64_C( 6450474334088700433),  INT64_C( 2185846970964392986), -INT64_C( 8898644712858583339), -INT64_C( 6957205245805878171) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   2), -INT64_C( 6556457077581535775),
+         INT64_C(                   4),  INT64_C(                   5),  INT64_C(                   6),  INT64_C( 2185846970964392986),
+         INT64_C(                   8),  INT64_C(                   9), -INT64_C( 2465425913259246659),  INT64_C(                  11),
+         INT64_C(                  12),  INT64_C(                  13),  INT64_C(                  14), -INT64_C( 8898644712858583339) } },
+    { UINT8_C(104),
+      {  INT32_C(           1),  INT32_C(           6),  INT32_C(           5),  INT32_C(          13),  INT32_C(           5),  INT32_C(           7),  INT32_C(           8),  INT32_C(          13) },
+      { -INT64_C( 4670503040354129946), -INT64_C( 7896217190130143246), -INT64_C( 4802572278053114138),  INT64_C( 6326372688731248063),
+         INT64_C( 1669274315956427313),  INT64_C(  433105461790056227),  INT64_C( 1861021669172479009),  INT64_C( 6740481457144554179) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   2),  INT64_C(                   3),
+         INT64_C(                   4),  INT64_C(                   5),  INT64_C(                   6),  INT64_C(  433105461790056227),
+         INT64_C( 1861021669172479009),  INT64_C(                   9),  INT64_C(                  10),  INT64_C(                  11),
+         INT64_C(                  12),  INT64_C( 6326372688731248063),  INT64_C(                  14),  INT64_C(                  15) } },
+    { UINT8_C( 27),
+      {  INT32_C(           0),  INT32_C(           3),  INT32_C(          15),  INT32_C(           9),  INT32_C(          12),  INT32_C(          12),  INT32_C(           5),  INT32_C(          12) },
+      {  INT64_C( 6275264394281640209),  INT64_C(  884144241816193038), -INT64_C( 3332590280291976027),  INT64_C(  341139920160009075),
+        -INT64_C( 3429174722879255719), -INT64_C( 3029519366615526553), -INT64_C( 1110534791182796040), -INT64_C( 4667459406280037055) },
+      {  INT64_C( 6275264394281640209),  INT64_C(                   1),  INT64_C(                   2),  INT64_C(  884144241816193038),
+         INT64_C(                   4),  INT64_C(                   5),  INT64_C(                   6),  INT64_C(                   7),
+         INT64_C(                   8),  INT64_C(  341139920160009075),  INT64_C(                  10),  INT64_C(                  11),
+        -INT64_C( 3429174722879255719),  INT64_C(                  13),  INT64_C(                  14),  INT64_C(                  15) } },
+    { UINT8_C(101),
+      {  INT32_C(           2),  INT32_C(          11),  INT32_C(          14),  INT32_C(           5),  INT32_C(           9),  INT32_C(          14),  INT32_C(          11),  INT32_C(          15) },
+      {  INT64_C( 8641241964715626850), -INT64_C( 2012891625677493877),  INT64_C( 2636758321568443437),  INT64_C( 6700253406548355291),
+         INT64_C( 8441405868401561318),  INT64_C( 4246530566257985358),  INT64_C( 1369091228089881122),  INT64_C( 7258492524226701669) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C( 8641241964715626850),  INT64_C(                   3),
+         INT64_C(                   4),  INT64_C(                   5),  INT64_C(                   6),  INT64_C(                   7),
+         INT64_C(                   8),  INT64_C(                   9),  INT64_C(                  10),  INT64_C( 1369091228089881122),
+         INT64_C(                  12),  INT64_C(                  13),  INT64_C( 4246530566257985358),  INT64_C(                  15) } },
+    { UINT8_C(103),
+      {  INT32_C(           4),  INT32_C(           8),  INT32_C(          11),  INT32_C(          15),  INT32_C(          13),  INT32_C(          13),  INT32_C(           6),  INT32_C(           9) },
+      {  INT64_C( 6283330637859858043), -INT64_C( 5539222454033465392), -INT64_C( 7459249048099370793),  INT64_C( 7161530346042261339),
+         INT64_C(  668582483366140420),  INT64_C( 5782859933829086727), -INT64_C( 1892990093354590816), -INT64_C( 6662428452288085441) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   2),  INT64_C(                   3),
+         INT64_C( 6283330637859858043),  INT64_C(                   5), -INT64_C( 1892990093354590816),  INT64_C(                   7),
+        -INT64_C( 5539222454033465392),  INT64_C(                   9),  INT64_C(                  10), -INT64_C( 7459249048099370793),
+         INT64_C(                  12),  INT64_C( 5782859933829086727),  INT64_C(                  14),  INT64_C(                  15) } },
+    { UINT8_C(166),
+      {  INT32_C(           0),  INT32_C(          10),  INT32_C(           0),  INT32_C(          14),  INT32_C(           6),  INT32_C(           4),  INT32_C(           4),  INT32_C(           5) },
+      { -INT64_C( 8286395795316537971),  INT64_C( 1865930000524710475), -INT64_C( 3962565598008882601), -INT64_C( 2433510253811640081),
+         INT64_C( 3597891107604011124),  INT64_C( 7486425212091364184),  INT64_C( 8631347186353988714), -INT64_C(  847532698158558964) },
+      { -INT64_C( 3962565598008882601),  INT64_C(                   1),  INT64_C(                   2),  INT64_C(                   3),
+         INT64_C( 7486425212091364184), -INT64_C(  847532698158558964),  INT64_C(                   6),  INT64_C(                   7),
+         INT64_C(                   8),  INT64_C(                   9),  INT64_C( 1865930000524710475),  INT64_C(                  11),
+         INT64_C(                  12),  INT64_C(                  13),  INT64_C(                  14),  INT64_C(                  15) } },
+    { UINT8_C( 13),
+      {  INT32_C(           2),  INT32_C(           3),  INT32_C(           0),  INT32_C(           3),  INT32_C(           0),  INT32_C(           2),  INT32_C(           2),  INT32_C(          11) },
+      {  INT64_C( 7856573589771249806),  INT64_C( 6638544431512112918),  INT64_C(  592383976139776194),  INT64_C( 4902983717631327505),
+         INT64_C( 5784908059001622989), -INT64_C( 3402653075008571794), -INT64_C( 2641222873569281991), -INT64_C(  291412166565213958) },
+      {  INT64_C(  592383976139776194),  INT64_C(                   1),  INT64_C( 7856573589771249806),  INT64_C( 4902983717631327505),
+         INT64_C(                   4),  INT64_C(                   5),  INT64_C(                   6),  INT64_C(                   7),
+         INT64_C(                   8),  INT64_C(                   9),  INT64_C(                  10),  INT64_C(                  11),
+         INT64_C(                  12),  INT64_C(                  13),  INT64_C(                  14),  INT64_C(                  15) } },
+    { UINT8_C(195),
+      {  INT32_C(          11),  INT32_C(          14),  INT32_C(           6),  INT32_C(           9),  INT32_C(           7),  INT32_C(           2),  INT32_C(          14),  INT32_C(           2) },
+      { -INT64_C( 7675155150544584439), -INT64_C( 8634088706204639646), -INT64_C( 1313807957024245512),  INT64_C( 4051181583329000456),
+        -INT64_C( 4533475147144691855),  INT64_C( 1176311521965017786),  INT64_C( 4728374136744365842), -INT64_C( 5912359639019910261) },
+      {  INT64_C(                   0),  INT64_C(                   1), -INT64_C( 5912359639019910261),  INT64_C(                   3),
+         INT64_C(                   4),  INT64_C(                   5),  INT64_C(                   6),  INT64_C(                   7),
+         INT64_C(                   8),  INT64_C(                   9),  INT64_C(                  10), -INT64_C( 7675155150544584439),
+         INT64_C(                  12),  INT64_C(                  13),  INT64_C( 4728374136744365842),  INT64_C(                  15) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int64_t r[16];
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(int64_t, j); }
+    simde_mm512_mask_i32scatter_epi64(r, test_vec[i].k, simde_mm256_loadu_epi32(test_vec[i].vindex), simde_mm512_loadu_epi64(test_vec[i].a), 8);
+    simde_assert_equal_vi64(16, r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    int32_t vindex[8];
+    int64_t a[8], r[16];
+    for (size_t j = 0 ; j < (sizeof(vindex) / sizeof(vindex[0])) ; j++) { vindex[j] = simde_test_codegen_random_i32() & 15; }
+    for (size_t j = 0 ; j < (sizeof(a) / sizeof(a[0])) ; j++) { a[j] = simde_test_codegen_random_i64(); }
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(int64_t, j); }
+    simde_mm512_mask_i32scatter_epi64(r, k, simde_mm256_loadu_epi32(vindex), simde_mm512_loadu_epi64(a), 8);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_vi32(2, 8, vindex, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi64(2, 8, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi64(2, 16, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_i32scatter_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int32_t vindex[8];
+    const int64_t a[8];
+    const int64_t r[16];
+  } test_vec[] = {
+    { {  INT32_C(           3),  INT32_C(          15),  INT32_C(          12),  INT32_C(           9),  INT32_C(           8),  INT32_C(          14),  INT32_C(           5),  INT32_C(           3) },
+      {  INT64_C( 5329444447573326812), -INT64_C( 8313043804237223139),  INT64_C( 6776494916775091938),  INT64_C(  341373245162757921),
+        -INT64_C( 6931596718340340472),  INT64_C(   67721250720906416), -INT64_C( 6715364567260491978),  INT64_C( 7135886930252107227) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   2),  INT64_C( 7135886930252107227),
+         INT64_C(                   4), -INT64_C( 6715364567260491978),  INT64_C(                   6),  INT64_C(                   7),
+        -INT64_C( 6931596718340340472),  INT64_C(  341373245162757921),  INT64_C(                  10),  INT64_C(                  11),
+         INT64_C( 6776494916775091938),  INT64_C(                  13),  INT64_C(   67721250720906416), -INT64_C( 8313043804237223139) } },
+    { {  INT32_C(           9),  INT32_C(          11),  INT32_C(           3),  INT32_C(           9),  INT32_C(          15),  INT32_C(          15),  INT32_C(          10),  INT32_C(          13) },
+      {  INT64_C(  946069666268357178),  INT64_C( 2352762956248207742), -INT64_C( 5976801503475645003), -INT64_C( 8538618942933816324),
+        -INT64_C( 3619766758600134051),  INT64_C(  712671915340505938),  INT64_C( 5949267571281572656), -INT64_C( 6120554284063092170) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   2), -INT64_C( 5976801503475645003),
+         INT64_C(                   4),  INT64_C(                   5),  INT64_C(                   6),  INT64_C(                   7),
+         INT64_C(                   8), -INT64_C( 8538618942933816324),  INT64_C( 5949267571281572656),  INT64_C( 2352762956248207742),
+         INT64_C(                  12), -INT64_C( 6120554284063092170),  INT64_C(                  14),  INT64_C(  712671915340505938) } },
+    { {  INT32_C(          15),  INT32_C(          15),  INT32_C(           9),  INT32_C(          11),  INT32_C(          10),  INT32_C(           0),  INT32_C(           1),  INT32_C(          10) },
+      {  INT64_C( 7861988233694445034),  INT64_C( 2408496744733810532),  INT64_C( 1976891094789614552),  INT64_C( 4743880675575946241),
+         INT64_C( 5059010099756629283),  INT64_C( 5439788094408015957),  INT64_C( 7242565982467919725), -INT64_C( 2902474631036269281) },
+      {  INT64_C( 5439788094408015957),  INT64_C( 7242565982467919725),  INT64_C(                   2),  INT64_C(                   3),
+         INT64_C(                   4),  INT64_C(                   5),  INT64_C(                   6),  INT64_C(                   7),
+         INT64_C(                   8),  INT64_C( 1976891094789614552), -INT64_C( 2902474631036269281),  INT64_C( 4743880675575946241),
+         INT64_C(                  12),  INT64_C(                  13),  INT64_C(                  14),  INT64_C( 2408496744733810532) } },
+    { {  INT32_C(           3),  INT32_C(           9),  INT32_C(           4),  INT32_C(           3),  INT32_C(           9),  INT32_C(          10),  INT32_C(           7),  INT32_C(           7) },
+      { -INT64_C( 8649889914861707123),  INT64_C( 3715156239669244411), -INT64_C( 2990969732844227191), -INT64_C( 4241825457734910335),
+        -INT64_C(  532179037827919326), -INT64_C( 7557017020885750782),  INT64_C( 8124222079308070666),  INT64_C( 7242908889830146182) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   2), -INT64_C( 4241825457734910335),
+        -INT64_C( 2990969732844227191),  INT64_C(                   5),  INT64_C(                   6),  INT64_C( 7242908889830146182),
+         INT64_C(                   8), -INT64_C(  532179037827919326), -INT64_C( 7557017020885750782),  INT64_C(                  11),
+         INT64_C(                  12),  INT64_C(                  13),  INT64_C(                  14),  INT64_C(                  15) } },
+    { {  INT32_C(          13),  INT32_C(           0),  INT32_C(           2),  INT32_C(          13),  INT32_C(          14),  INT32_C(          10),  INT32_C(           0),  INT32_C(           1) },
+      { -INT64_C( 8537970270944088031),  INT64_C( 2186147837737804305),  INT64_C( 5237099466553321267), -INT64_C( 3400127903070262176),
+         INT64_C( 8309323156164860033),  INT64_C( 2181704758390303303), -INT64_C( 2459395869996510625),  INT64_C( 5432607558570310117) },
+      { -INT64_C( 2459395869996510625),  INT64_C( 5432607558570310117),  INT64_C( 5237099466553321267),  INT64_C(                   3),
+         INT64_C(                   4),  INT64_C(                   5),  INT64_C(                   6),  INT64_C(                   7),
+         INT64_C(                   8),  INT64_C(                   9),  INT64_C( 2181704758390303303),  INT64_C(                  11),
+         INT64_C(                  12), -INT64_C( 3400127903070262176),  INT64_C( 8309323156164860033),  INT64_C(                  15) } },
+    { {  INT32_C(           8),  INT32_C(          12),  INT32_C(          13),  INT32_C(           7),  INT32_C(           4),  INT32_C(           9),  INT32_C(           4),  INT32_C(          12) },
+      { -INT64_C( 5990425086240310211), -INT64_C( 3460529941552793589), -INT64_C( 1822956937210218981), -INT64_C(  370158578007997173),
+        -INT64_C( 5587488677595714902),  INT64_C( 7990228321663556025),  INT64_C( 4282103218384904757),  INT64_C( 5463464077932343835) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   2),  INT64_C(                   3),
+         INT64_C( 4282103218384904757),  INT64_C(                   5),  INT64_C(                   6), -INT64_C(  370158578007997173),
+        -INT64_C( 5990425086240310211),  INT64_C( 7990228321663556025),  INT64_C(                  10),  INT64_C(                  11),
+         INT64_C( 5463464077932343835), -INT64_C( 1822956937210218981),  INT64_C(                  14),  INT64_C(                  15) } },
+    { {  INT32_C(           9),  INT32_C(           6),  INT32_C(           4),  INT32_C(           5),  INT32_C(           7),  INT32_C(          15),  INT32_C(           1),  INT32_C(           5) },
+      { -INT64_C( 1008892293986434214),  INT64_C( 3321492026795049240),  INT64_C(  752481332422392216),  INT64_C( 4756956691854836944),
+         INT64_C( 2025512642010043229),  INT64_C( 7847437502433101139),  INT64_C( 4016882559045799403),  INT64_C( 2505305162379995801) },
+      {  INT64_C(                   0),  INT64_C( 4016882559045799403),  INT64_C(                   2),  INT64_C(                   3),
+         INT64_C(  752481332422392216),  INT64_C( 2505305162379995801),  INT64_C( 3321492026795049240),  INT64_C( 2025512642010043229),
+         INT64_C(                   8), -INT64_C( 1008892293986434214),  INT64_C(                  10),  INT64_C(                  11),
+         INT64_C(                  12),  INT64_C(                  13),  INT64_C(                  14),  INT64_C( 7847437502433101139) } },
+    { {  INT32_C(           4),  INT32_C(           8),  INT32_C(          15),  INT32_C(           1),  INT32_C(           9),  INT32_C(           9),  INT32_C(           9),  INT32_C(           5) },
+      { -INT64_C(  557944942019568098), -INT64_C(  349332359663045257),  INT64_C( 5758929537233266560), -INT64_C( 3137373181640282121),
+         INT64_C( 7452925152944859245), -INT64_C( 7539757954824656303),  INT64_C( 8341630216589846925),  INT64_C( 9036090093427704283) },
+      {  INT64_C(                   0), -INT64_C( 3137373181640282121),  INT64_C(                   2),  INT64_C(                   3),
+        -INT64_C(  557944942019568098),  INT64_C( 9036090093427704283),  INT64_C(                   6),  INT64_C(                   7),
+        -INT64_C(  349332359663045257),  INT64_C( 8341630216589846925),  INT64_C(                  10),  INT64_C(                  11),
+         INT64_C(                  12),  INT64_C(                  13),  INT64_C(                  14),  INT64_C( 5758929537233266560) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int64_t r[16];
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(int64_t, j); }
+    simde_mm512_i32scatter_epi64(r, simde_mm256_loadu_epi32(test_vec[i].vindex), simde_mm512_loadu_epi64(test_vec[i].a), 8);
+    simde_assert_equal_vi64(16, r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int32_t vindex[8];
+    int64_t a[8], r[16];
+    for (size_t j = 0 ; j < (sizeof(vindex) / sizeof(vindex[0])) ; j++) { vindex[j] = simde_test_codegen_random_i32() & 15; }
+    for (size_t j = 0 ; j < (sizeof(a) / sizeof(a[0])) ; j++) { a[j] = simde_test_codegen_random_i64(); }
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(int64_t, j); }
+    simde_mm512_i32scatter_epi64(r, simde_mm256_loadu_epi32(vindex), simde_mm512_loadu_epi64(a), 8);
+
+    simde_test_codegen_write_vi32(2, 8, vindex, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_vi64(2, 8, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi64(2, 16, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_mask_i32scatter_pd (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t vindex[8];
+    const simde_float64 a[8];
+    const simde_float64 r[16];
+  } test_vec[] = {
+    { UINT8_C(204),
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           4),  INT32_C(          13),  INT32_C(           9),  INT32_C(          15),  INT32_C(           4),  INT32_C(           8) },
+      { SIMDE_FLOAT64_C(   -57.22), SIMDE_FLOAT64_C(  -695.16), SIMDE_FLOAT64_C(   474.28), SIMDE_FLOAT64_C(   -53.42),
+        SIMDE_FLOAT64_C(   767.02), SIMDE_FLOAT64_C(  -415.04), SIMDE_FLOAT64_C(  -607.06), SIMDE_FLOAT64_C(   728.07) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(     3.00),
+        SIMDE_FLOAT64_C(  -607.06), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(     7.00),
+        SIMDE_FLOAT64_C(   728.07), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(    10.00), SIMDE_FLOAT64_C(    11.00),
+        SIMDE_FLOAT64_C(    12.00), SIMDE_FLOAT64_C(   -53.42), SIMDE_FLOAT64_C(    14.00), SIMDE_FLOAT64_C(    15.00) } },
+    { UINT8_C( 81),
+      {  INT32_C(           0),  INT32_C(          13),  INT32_C(           6),  INT32_C(           8),  INT32_C(           8),  INT32_C(          12),  INT32_C(          15),  INT32_C(           7) },
+      { SIMDE_FLOAT64_C(   489.80), SIMDE_FLOAT64_C(  -225.79), SIMDE_FLOAT64_C(  -966.00), SIMDE_FLOAT64_C(   256.87),
+        SIMDE_FLOAT64_C(   869.54), SIMDE_FLOAT64_C(   675.51), SIMDE_FLOAT64_C(   207.84), SIMDE_FLOAT64_C(  -404.43) },
+      { SIMDE_FLOAT64_C(   489.80), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(     3.00),
+        SIMDE_FLOAT64_C(     4.00), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(     7.00),
+        SIMDE_FLOAT64_C(   869.54), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(    10.00), SIMDE_FLOAT64_C(    11.00),
+        SIMDE_FLOAT64_C(    12.00), SIMDE_FLOAT64_C(    13.00), SIMDE_FLOAT64_C(    14.00), SIMDE_FLOAT64_C(   207.84) } },
+    { UINT8_C(123),
+      {  INT32_C(           2),  INT32_C(           4),  INT32_C(           0),  INT32_C(           0),  INT32_C(           9),  INT32_C(          14),  INT32_C(           9),  INT32_C(           3) },
+      { SIMDE_FLOAT64_C(   706.02), SIMDE_FLOAT64_C(  -979.66), SIMDE_FLOAT64_C(   924.86), SIMDE_FLOAT64_C(  -361.25),
+        SIMDE_FLOAT64_C(   125.09), SIMDE_FLOAT64_C(  -552.52), SIMDE_FLOAT64_C(  -281.87), SIMDE_FLOAT64_C(   249.74) },
+      { SIMDE_FLOAT64_C(  -361.25), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(   706.02), SIMDE_FLOAT64_C(     3.00),
+        SIMDE_FLOAT64_C(  -979.66), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(     7.00),
+        SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(  -281.87), SIMDE_FLOAT64_C(    10.00), SIMDE_FLOAT64_C(    11.00),
+        SIMDE_FLOAT64_C(    12.00), SIMDE_FLOAT64_C(    13.00), SIMDE_FLOAT64_C(  -552.52), SIMDE_FLOAT64_C(    15.00) } },
+    { UINT8_C(219),
+      {  INT32_C(           8),  INT32_C(          15),  INT32_C(           6),  INT32_C(           8),  INT32_C(           9),  INT32_C(          10),  INT32_C(           9),  INT32_C(          12) },
+      { SIMDE_FLOAT64_C(  -518.40), SIMDE_FLOAT64_C(   333.80), SIMDE_FLOAT64_C(   434.08), SIMDE_FLOAT64_C(    30.04),
+        SIMDE_FLOAT64_C(  -451.45), SIMDE_FLOAT64_C(  -411.00), SIMDE_FLOAT64_C(  -188.21), SIMDE_FLOAT64_C(   683.34) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(     3.00),
+        SIMDE_FLOAT64_C(     4.00), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(     7.00),
+        SIMDE_FLOAT64_C(    30.04), SIMDE_FLOAT64_C(  -188.21), SIMDE_FLOAT64_C(    10.00), SIMDE_FLOAT64_C(    11.00),
+        SIMDE_FLOAT64_C(   683.34), SIMDE_FLOAT64_C(    13.00), SIMDE_FLOAT64_C(    14.00), SIMDE_FLOAT64_C(   333.80) } },
+    { UINT8_C(122),
+      {  INT32_C(          15),  INT32_C(           4),  INT32_C(           9),  INT32_C(          12),  INT32_C(           4),  INT32_C(           0),  INT32_C(          11),  INT32_C(           6) },
+      { SIMDE_FLOAT64_C(  -443.65), SIMDE_FLOAT64_C(   116.32), SIMDE_FLOAT64_C(   939.16), SIMDE_FLOAT64_C(  -244.87),
+        SIMDE_FLOAT64_C(  -499.17), SIMDE_FLOAT64_C(  -299.38), SIMDE_FLOAT64_C(  -955.97), SIMDE_FLOAT64_C(  -699.09) },
+      { SIMDE_FLOAT64_C(  -299.38), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(     3.00),
+        SIMDE_FLOAT64_C(  -499.17), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(     7.00),
+        SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(    10.00), SIMDE_FLOAT64_C(  -955.97),
+        SIMDE_FLOAT64_C(  -244.87), SIMDE_FLOAT64_C(    13.00), SIMDE_FLOAT64_C(    14.00), SIMDE_FLOAT64_C(    15.00) } },
+    { UINT8_C(211),
+      {  INT32_C(           3),  INT32_C(           1),  INT32_C(          12),  INT32_C(           0),  INT32_C(          10),  INT32_C(           7),  INT32_C(          10),  INT32_C(           5) },
+      { SIMDE_FLOAT64_C(   769.71), SIMDE_FLOAT64_C(   397.37), SIMDE_FLOAT64_C(  -838.17), SIMDE_FLOAT64_C(   414.22),
+        SIMDE_FLOAT64_C(  -577.69), SIMDE_FLOAT64_C(  -619.29), SIMDE_FLOAT64_C(   -25.41), SIMDE_FLOAT64_C(  -155.52) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   397.37), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(   769.71),
+        SIMDE_FLOAT64_C(     4.00), SIMDE_FLOAT64_C(  -155.52), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(     7.00),
+        SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(   -25.41), SIMDE_FLOAT64_C(    11.00),
+        SIMDE_FLOAT64_C(    12.00), SIMDE_FLOAT64_C(    13.00), SIMDE_FLOAT64_C(    14.00), SIMDE_FLOAT64_C(    15.00) } },
+    { UINT8_C(108),
+      {  INT32_C(          14),  INT32_C(           3),  INT32_C(           3),  INT32_C(           3),  INT32_C(          12),  INT32_C(          13),  INT32_C(           7),  INT32_C(           1) },
+      { SIMDE_FLOAT64_C(  -381.78), SIMDE_FLOAT64_C(  -834.50), SIMDE_FLOAT64_C(   441.37), SIMDE_FLOAT64_C(   414.17),
+        SIMDE_FLOAT64_C(   264.83), SIMDE_FLOAT64_C(  -741.49), SIMDE_FLOAT64_C(   762.49), SIMDE_FLOAT64_C(  -375.52) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(   414.17),
+        SIMDE_FLOAT64_C(     4.00), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(   762.49),
+        SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(    10.00), SIMDE_FLOAT64_C(    11.00),
+        SIMDE_FLOAT64_C(    12.00), SIMDE_FLOAT64_C(  -741.49), SIMDE_FLOAT64_C(    14.00), SIMDE_FLOAT64_C(    15.00) } },
+    { UINT8_C(156),
+      {  INT32_C(          12),  INT32_C(          12),  INT32_C(           3),  INT32_C(           8),  INT32_C(          14),  INT32_C(          14),  INT32_C(           4),  INT32_C(           2) },
+      { SIMDE_FLOAT64_C(   327.80), SIMDE_FLOAT64_C(  -788.80), SIMDE_FLOAT64_C(  -256.10), SIMDE_FLOAT64_C(  -857.69),
+        SIMDE_FLOAT64_C(   844.45), SIMDE_FLOAT64_C(  -732.00), SIMDE_FLOAT64_C(  -573.01), SIMDE_FLOAT64_C(  -482.39) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(  -482.39), SIMDE_FLOAT64_C(  -256.10),
+        SIMDE_FLOAT64_C(     4.00), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(     7.00),
+        SIMDE_FLOAT64_C(  -857.69), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(    10.00), SIMDE_FLOAT64_C(    11.00),
+        SIMDE_FLOAT64_C(    12.00), SIMDE_FLOAT64_C(    13.00), SIMDE_FLOAT64_C(   844.45), SIMDE_FLOAT64_C(    15.00) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64 r[16];
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(simde_float64, j); }
+    simde_mm512_mask_i32scatter_pd(r, test_vec[i].k, simde_mm256_loadu_epi32(test_vec[i].vindex), simde_mm512_loadu_pd(test_vec[i].a), 8);
+    simde_assert_equal_vf64(16, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    int32_t vindex[8];
+    simde_float64 a[8], r[16];
+    for (size_t j = 0 ; j < (sizeof(vindex) / sizeof(vindex[0])) ; j++) { vindex[j] = simde_test_codegen_random_i32() & 15; }
+    simde_test_codegen_random_vf64(8, a, HEDLEY_STATIC_CAST(simde_float64, -1000.0), HEDLEY_STATIC_CAST(simde_float64, 1000.0));
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(simde_float64, j); }
+    simde_mm512_mask_i32scatter_pd(r, k, simde_mm256_loadu_epi32(vindex), simde_mm512_loadu_pd(a), 8);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_vi32(2, 8, vindex, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vf64(2, 8, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vf64(2, 16, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_i32scatter_pd (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int32_t vindex[8];
+    const simde_float64 a[8];
+    const simde_float64 r[16];
+  } test_vec[] = {
+    { {  INT32_C(          11),  INT32_C(          11),  INT32_C(          12),  INT32_C(          11),  INT32_C(          15),  INT32_C(           6),  INT32_C(          11),  INT32_C(          12) },
+      { SIMDE_FLOAT64_C(  -769.65), SIMDE_FLOAT64_C(   688.36), SIMDE_FLOAT64_C(   794.65), SIMDE_FLOAT64_C(    13.28),
+        SIMDE_FLOAT64_C(   709.74), SIMDE_FLOAT64_C(  -175.20), SIMDE_FLOAT64_C(   687.15), SIMDE_FLOAT64_C(   104.28) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(     3.00),
+        SIMDE_FLOAT64_C(     4.00), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(  -175.20), SIMDE_FLOAT64_C(     7.00),
+        SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(    10.00), SIMDE_FLOAT64_C(   687.15),
+        SIMDE_FLOAT64_C(   104.28), SIMDE_FLOAT64_C(    13.00), SIMDE_FLOAT64_C(    14.00), SIMDE_FLOAT64_C(   709.74) } },
+    { {  INT32_C(           8),  INT32_C(           6),  INT32_C(           1),  INT32_C(           0),  INT32_C(           9),  INT32_C(           3),  INT32_C(          11),  INT32_C(          14) },
+      { SIMDE_FLOAT64_C(  -641.73), SIMDE_FLOAT64_C(   562.49), SIMDE_FLOAT64_C(  -687.09), SIMDE_FLOAT64_C(  -934.11),
+        SIMDE_FLOAT64_C(   956.35), SIMDE_FLOAT64_C(  -527.37), SIMDE_FLOAT64_C(   152.51), SIMDE_FLOAT64_C(   675.57) },
+      { SIMDE_FLOAT64_C(  -934.11), SIMDE_FLOAT64_C(  -687.09), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(  -527.37),
+        SIMDE_FLOAT64_C(     4.00), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(   562.49), SIMDE_FLOAT64_C(     7.00),
+        SIMDE_FLOAT64_C(  -641.73), SIMDE_FLOAT64_C(   956.35), SIMDE_FLOAT64_C(    10.00), SIMDE_FLOAT64_C(   152.51),
+        SIMDE_FLOAT64_C(    12.00), SIMDE_FLOAT64_C(    13.00), SIMDE_FLOAT64_C(   675.57), SIMDE_FLOAT64_C(    15.00) } },
+    { {  INT32_C(           4),  INT32_C(           1),  INT32_C(          15),  INT32_C(           6),  INT32_C(           6),  INT32_C(           5),  INT32_C(          15),  INT32_C(           1) },
+      { SIMDE_FLOAT64_C(   515.87), SIMDE_FLOAT64_C(  -734.05), SIMDE_FLOAT64_C(  -294.50), SIMDE_FLOAT64_C(  -847.19),
+        SIMDE_FLOAT64_C(   183.31), SIMDE_FLOAT64_C(  -114.22), SIMDE_FLOAT64_C(   666.48), SIMDE_FLOAT64_C(    93.36) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(    93.36), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(     3.00),
+        SIMDE_FLOAT64_C(   515.87), SIMDE_FLOAT64_C(  -114.22), SIMDE_FLOAT64_C(   183.31), SIMDE_FLOAT64_C(     7.00),
+        SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(    10.00), SIMDE_FLOAT64_C(    11.00),
+        SIMDE_FLOAT64_C(    12.00), SIMDE_FLOAT64_C(    13.00), SIMDE_FLOAT64_C(    14.00), SIMDE_FLOAT64_C(   666.48) } },
+    { {  INT32_C(          14),  INT32_C(           8),  INT32_C(           1),  INT32_C(           0),  INT32_C(           3),  INT32_C(           6),  INT32_C(          15),  INT32_C(           2) },
+      { SIMDE_FLOAT64_C(  -460.25), SIMDE_FLOAT64_C(  -508.52), SIMDE_FLOAT64_C(  -606.24), SIMDE_FLOAT64_C(   656.13),
+        SIMDE_FLOAT64_C(  -219.82), SIMDE_FLOAT64_C(  -290.63), SIMDE_FLOAT64_C(  -521.12), SIMDE_FLOAT64_C(   597.80) },
+      { SIMDE_FLOAT64_C(   656.13), SIMDE_FLOAT64_C(  -606.24), SIMDE_FLOAT64_C(   597.80), SIMDE_FLOAT64_C(  -219.82),
+        SIMDE_FLOAT64_C(     4.00), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(  -290.63), SIMDE_FLOAT64_C(     7.00),
+        SIMDE_FLOAT64_C(  -508.52), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(    10.00), SIMDE_FLOAT64_C(    11.00),
+        SIMDE_FLOAT64_C(    12.00), SIMDE_FLOAT64_C(    13.00), SIMDE_FLOAT64_C(  -460.25), SIMDE_FLOAT64_C(  -521.12) } },
+    { {  INT32_C(           9),  INT32_C(           2),  INT32_C(           1),  INT32_C(           3),  INT32_C(          12),  INT32_C(          15),  INT32_C(           3),  INT32_C(           0) },
+      { SIMDE_FLOAT64_C(  -312.57), SIMDE_FLOAT64_C(  -704.01), SIMDE_FLOAT64_C(  -360.06), SIMDE_FLOAT64_C(    42.27),
+        SIMDE_FLOAT64_C(   411.31), SIMDE_FLOAT64_C(  -887.99), SIMDE_FLOAT64_C(   642.74), SIMDE_FLOAT64_C(   650.71) },
+      { SIMDE_FLOAT64_C(   650.71), SIMDE_FLOAT64_C(  -360.06), SIMDE_FLOAT64_C(  -704.01), SIMDE_FLOAT64_C(   642.74),
+        SIMDE_FLOAT64_C(     4.00), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(     7.00),
+        SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(  -312.57), SIMDE_FLOAT64_C(    10.00), SIMDE_FLOAT64_C(    11.00),
+        SIMDE_FLOAT64_C(   411.31), SIMDE_FLOAT64_C(    13.00), SIMDE_FLOAT64_C(    14.00), SIMDE_FLOAT64_C(  -887.99) } },
+    { {  INT32_C(          13),  INT32_C(           8),  INT32_C(          15),  INT32_C(           9),  INT32_C(           4),  INT32_C(          12),  INT32_C(           0),  INT32_C(          15) },
+      { SIMDE_FLOAT64_C(  -248.27), SIMDE_FLOAT64_C(   204.42), SIMDE_FLOAT64_C(   141.27), SIMDE_FLOAT64_C(   839.45),
+        SIMDE_FLOAT64_C(  -523.99), SIMDE_FLOAT64_C(   180.54), SIMDE_FLOAT64_C(   638.21), SIMDE_FLOAT64_C(  -202.24) },
+      { SIMDE_FLOAT64_C(   638.21), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(     3.00),
+        SIMDE_FLOAT64_C(  -523.99), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(     7.00),
+        SIMDE_FLOAT64_C(   204.42), SIMDE_FLOAT64_C(   839.45), SIMDE_FLOAT64_C(    10.00), SIMDE_FLOAT64_C(    11.00),
+        SIMDE_FLOAT64_C(   180.54), SIMDE_FLOAT64_C(  -248.27), SIMDE_FLOAT64_C(    14.00), SIMDE_FLOAT64_C(  -202.24) } },
+    { {  INT32_C(           0),  INT32_C(           3),  INT32_C(          12),  INT32_C(          11),  INT32_C(          11),  INT32_C(           0),  INT32_C(          14),  INT32_C(           6) },
+      { SIMDE_FLOAT64_C(   -16.56), SIMDE_FLOAT64_C(  -592.57), SIMDE_FLOAT64_C(   346.82), SIMDE_FLOAT64_C(  -511.10),
+        SIMDE_FLOAT64_C(   170.65), SIMDE_FLOAT64_C(  -164.11), SIMDE_FLOAT64_C(   253.23), SIMDE_FLOAT64_C(   773.47) },
+      { SIMDE_FLOAT64_C(  -164.11), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(  -592.57),
+        SIMDE_FLOAT64_C(     4.00), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(   773.47), SIMDE_FLOAT64_C(     7.00),
+        SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(    10.00), SIMDE_FLOAT64_C(   170.65),
+        SIMDE_FLOAT64_C(   346.82), SIMDE_FLOAT64_C(    13.00), SIMDE_FLOAT64_C(   253.23), SIMDE_FLOAT64_C(    15.00) } },
+    { {  INT32_C(          14),  INT32_C(           5),  INT32_C(           9),  INT32_C(           1),  INT32_C(           6),  INT32_C(           2),  INT32_C(           4),  INT32_C(          11) },
+      { SIMDE_FLOAT64_C(  -393.81), SIMDE_FLOAT64_C(   138.81), SIMDE_FLOAT64_C(   738.86), SIMDE_FLOAT64_C(  -680.96),
+        SIMDE_FLOAT64_C(   130.59), SIMDE_FLOAT64_C(   705.69), SIMDE_FLOAT64_C(  -650.87), SIMDE_FLOAT64_C(  -532.44) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -680.96), SIMDE_FLOAT64_C(   705.69), SIMDE_FLOAT64_C(     3.00),
+        SIMDE_FLOAT64_C(  -650.87), SIMDE_FLOAT64_C(   138.81), SIMDE_FLOAT64_C(   130.59), SIMDE_FLOAT64_C(     7.00),
+        SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(   738.86), SIMDE_FLOAT64_C(    10.00), SIMDE_FLOAT64_C(  -532.44),
+        SIMDE_FLOAT64_C(    12.00), SIMDE_FLOAT64_C(    13.00), SIMDE_FLOAT64_C(  -393.81), SIMDE_FLOAT64_C(    15.00) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64 r[16];
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(simde_float64, j); }
+    simde_mm512_i32scatter_pd(r, simde_mm256_loadu_epi32(test_vec[i].vindex), simde_mm512_loadu_pd(test_vec[i].a), 8);
+    simde_assert_equal_vf64(16, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int32_t vindex[8];
+    simde_float64 a[8], r[16];
+    for (size_t j = 0 ; j < (sizeof(vindex) / sizeof(vindex[0])) ; j++) { vindex[j] = simde_test_codegen_random_i32() & 15; }
+    simde_test_codegen_random_vf64(8, a, HEDLEY_STATIC_CAST(simde_float64, -1000.0), HEDLEY_STATIC_CAST(simde_float64, 1000.0));
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(simde_float64, j); }
+    simde_mm512_i32scatter_pd(r, simde_mm256_loadu_epi32(vindex), simde_mm512_loadu_pd(a), 8);
+
+    simde_test_codegen_write_vi32(2, 8, vindex, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_vf64(2, 8, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vf64(2, 16, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_mask_i32scatter_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t vindex[16];
+    const simde_float32 a[16];
+    const simde_float32 r[32];
+  } test_vec[] = {
+    { UINT16_C(47344),
+      {  INT32_C(          31),  INT32_C(          18),  INT32_C(          13),  INT32_C(           6),  INT32_C(          27),  INT32_C(          24),  INT32_C(           6),  INT32_C(           8),
+         INT32_C(          21),  INT32_C(           7),  INT32_C(          17),  INT32_C(          14),  INT32_C(           8),  INT32_C(          21),  INT32_C(          23),  INT32_C(           3) },
+      { SIMDE_FLOAT32_C(    84.20), SIMDE_FLOAT32_C(    51.13), SIMDE_FLOAT32_C(   604.77), SIMDE_FLOAT32_C(   242.80),
+        SIMDE_FLOAT32_C(  -736.94), SIMDE_FLOAT32_C(  -989.23), SIMDE_FLOAT32_C(   730.39), SIMDE_FLOAT32_C(   884.41),
+        SIMDE_FLOAT32_C(  -550.86), SIMDE_FLOAT32_C(   758.22), SIMDE_FLOAT32_C(   778.67), SIMDE_FLOAT32_C(   963.20),
+        SIMDE_FLOAT32_C(   884.34), SIMDE_FLOAT32_C(  -701.72), SIMDE_FLOAT32_C(  -233.11), SIMDE_FLOAT32_C(   502.70) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(   502.70),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(   730.39), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(   884.34), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(    10.00), SIMDE_FLOAT32_C(    11.00),
+        SIMDE_FLOAT32_C(    12.00), SIMDE_FLOAT32_C(    13.00), SIMDE_FLOAT32_C(   963.20), SIMDE_FLOAT32_C(    15.00),
+        SIMDE_FLOAT32_C(    16.00), SIMDE_FLOAT32_C(    17.00), SIMDE_FLOAT32_C(    18.00), SIMDE_FLOAT32_C(    19.00),
+        SIMDE_FLOAT32_C(    20.00), SIMDE_FLOAT32_C(  -701.72), SIMDE_FLOAT32_C(    22.00), SIMDE_FLOAT32_C(    23.00),
+        SIMDE_FLOAT32_C(  -989.23), SIMDE_FLOAT32_C(    25.00), SIMDE_FLOAT32_C(    26.00), SIMDE_FLOAT32_C(  -736.94),
+        SIMDE_FLOAT32_C(    28.00), SIMDE_FLOAT32_C(    29.00), SIMDE_FLOAT32_C(    30.00), SIMDE_FLOAT32_C(    31.00) } },
+    { UINT16_C( 8013),
+      {  INT32_C(           6),  INT32_C(          30),  INT32_C(          25),  INT32_C(          30),  INT32_C(           3),  INT32_C(          20),  INT32_C(          25),  INT32_C(          23),
+         INT32_C(          11),  INT32_C(           6),  INT32_C(          24),  INT32_C(          10),  INT32_C(           0),  INT32_C(           1),  INT32_C(           4),  INT32_C(           2) },
+      { SIMDE_FLOAT32_C(  -225.94), SIMDE_FLOAT32_C(   209.01), SIMDE_FLOAT32_C(   348.21), SIMDE_FLOAT32_C(   914.10),
+        SIMDE_FLOAT32_C(   -49.59), SIMDE_FLOAT32_C(  -867.06), SIMDE_FLOAT32_C(  -501.08), SIMDE_FLOAT32_C(  -137.79),
+        SIMDE_FLOAT32_C(  -284.44), SIMDE_FLOAT32_C(   897.04), SIMDE_FLOAT32_C(   539.68), SIMDE_FLOAT32_C(  -819.73),
+        SIMDE_FLOAT32_C(   159.57), SIMDE_FLOAT32_C(  -412.42), SIMDE_FLOAT32_C(   769.88), SIMDE_FLOAT32_C(  -450.42) },
+      { SIMDE_FLOAT32_C(   159.57), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(   897.04), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(  -819.73), SIMDE_FLOAT32_C(  -284.44),
+        SIMDE_FLOAT32_C(    12.00), SIMDE_FLOAT32_C(    13.00), SIMDE_FLOAT32_C(    14.00), SIMDE_FLOAT32_C(    15.00),
+        SIMDE_FLOAT32_C(    16.00), SIMDE_FLOAT32_C(    17.00), SIMDE_FLOAT32_C(    18.00), SIMDE_FLOAT32_C(    19.00),
+        SIMDE_FLOAT32_C(    20.00), SIMDE_FLOAT32_C(    21.00), SIMDE_FLOAT32_C(    22.00), SIMDE_FLOAT32_C(    23.00),
+        SIMDE_FLOAT32_C(   539.68), SIMDE_FLOAT32_C(  -501.08), SIMDE_FLOAT32_C(    26.00), SIMDE_FLOAT32_C(    27.00),
+        SIMDE_FLOAT32_C(    28.00), SIMDE_FLOAT32_C(    29.00), SIMDE_FLOAT32_C(   914.10), SIMDE_FLOAT32_C(    31.00) } },
+    { UINT16_C(13486),
+      {  INT32_C(          28),  INT32_C(          10),  INT32_C(           5),  INT32_C(           4),  INT32_C(          18),  INT32_C(          23),  INT32_C(           2),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(          29),  INT32_C(           2),  INT32_C(           8),  INT32_C(          11),  INT32_C(          22),  INT32_C(          20),  INT32_C(          23) },
+      { SIMDE_FLOAT32_C(   -30.66), SIMDE_FLOAT32_C(   445.34), SIMDE_FLOAT32_C(   223.43), SIMDE_FLOAT32_C(  -528.84),
+        SIMDE_FLOAT32_C(  -276.58), SIMDE_FLOAT32_C(  -412.35), SIMDE_FLOAT32_C(  -640.80), SIMDE_FLOAT32_C(  -154.25),
+        SIMDE_FLOAT32_C(   -83.97), SIMDE_FLOAT32_C(  -102.00), SIMDE_FLOAT32_C(  -994.33), SIMDE_FLOAT32_C(   -17.39),
+        SIMDE_FLOAT32_C(   296.59), SIMDE_FLOAT32_C(   551.38), SIMDE_FLOAT32_C(  -298.50), SIMDE_FLOAT32_C(  -494.63) },
+      { SIMDE_FLOAT32_C(  -154.25), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(  -994.33), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(  -528.84), SIMDE_FLOAT32_C(   223.43), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(   445.34), SIMDE_FLOAT32_C(   296.59),
+        SIMDE_FLOAT32_C(    12.00), SIMDE_FLOAT32_C(    13.00), SIMDE_FLOAT32_C(    14.00), SIMDE_FLOAT32_C(    15.00),
+        SIMDE_FLOAT32_C(    16.00), SIMDE_FLOAT32_C(    17.00), SIMDE_FLOAT32_C(    18.00), SIMDE_FLOAT32_C(    19.00),
+        SIMDE_FLOAT32_C(    20.00), SIMDE_FLOAT32_C(    21.00), SIMDE_FLOAT32_C(   551.38), SIMDE_FLOAT32_C(  -412.35),
+        SIMDE_FLOAT32_C(    24.00), SIMDE_FLOAT32_C(    25.00), SIMDE_FLOAT32_C(    26.00), SIMDE_FLOAT32_C(    27.00),
+        SIMDE_FLOAT32_C(    28.00), SIMDE_FLOAT32_C(    29.00), SIMDE_FLOAT32_C(    30.00), SIMDE_FLOAT32_C(    31.00) } },
+    { UINT16_C( 7963),
+      {  INT32_C(           7),  INT32_C(          10),  INT32_C(           3),  INT32_C(           3),  INT32_C(          23),  INT32_C(           6),  INT32_C(          12),  INT32_C(          25),
+         INT32_C(          15),  INT32_C(          10),  INT32_C(          11),  INT32_C(          22),  INT32_C(          14),  INT32_C(          10),  INT32_C(           3),  INT32_C(          24) },
+      { SIMDE_FLOAT32_C(    52.24), SIMDE_FLOAT32_C(  -596.33), SIMDE_FLOAT32_C(  -456.73), SIMDE_FLOAT32_C(    25.14),
+        SIMDE_FLOAT32_C(   -35.03), SIMDE_FLOAT32_C(   890.91), SIMDE_FLOAT32_C(   497.87), SIMDE_FLOAT32_C(  -391.69),
+        SIMDE_FLOAT32_C(    61.06), SIMDE_FLOAT32_C(    62.96), SIMDE_FLOAT32_C(   135.48), SIMDE_FLOAT32_C(    23.06),
+        SIMDE_FLOAT32_C(   165.74), SIMDE_FLOAT32_C(   769.91), SIMDE_FLOAT32_C(  -751.93), SIMDE_FLOAT32_C(  -470.37) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(    25.14),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(    52.24),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(    62.96), SIMDE_FLOAT32_C(   135.48),
+        SIMDE_FLOAT32_C(    12.00), SIMDE_FLOAT32_C(    13.00), SIMDE_FLOAT32_C(   165.74), SIMDE_FLOAT32_C(    61.06),
+        SIMDE_FLOAT32_C(    16.00), SIMDE_FLOAT32_C(    17.00), SIMDE_FLOAT32_C(    18.00), SIMDE_FLOAT32_C(    19.00),
+        SIMDE_FLOAT32_C(    20.00), SIMDE_FLOAT32_C(    21.00), SIMDE_FLOAT32_C(    23.06), SIMDE_FLOAT32_C(   -35.03),
+        SIMDE_FLOAT32_C(    24.00), SIMDE_FLOAT32_C(    25.00), SIMDE_FLOAT32_C(    26.00), SIMDE_FLOAT32_C(    27.00),
+        SIMDE_FLOAT32_C(    28.00), SIMDE_FLOAT32_C(    29.00), SIMDE_FLOAT32_C(    30.00), SIMDE_FLOAT32_C(    31.00) } },
+    { UINT16_C(23439),
+      {  INT32_C(          12),  INT32_C(          17),  INT32_C(           9),  INT32_C(          31),  INT32_C(          12),  INT32_C(          14),  INT32_C(          19),  INT32_C(           4),
+         INT32_C(          20),  INT32_C(          11),  INT32_C(          11),  INT32_C(          28),  INT32_C(           1),  INT32_C(          29),  INT32_C(          12),  INT32_C(           8) },
+      { SIMDE_FLOAT32_C(   779.84), SIMDE_FLOAT32_C(   977.70), SIMDE_FLOAT32_C(   861.08), SIMDE_FLOAT32_C(   830.20),
+        SIMDE_FLOAT32_C(   824.09), SIMDE_FLOAT32_C(  -773.73), SIMDE_FLOAT32_C(    33.89), SIMDE_FLOAT32_C(    28.31),
+        SIMDE_FLOAT32_C(   689.27), SIMDE_FLOAT32_C(  -393.95), SIMDE_FLOAT32_C(  -688.45), SIMDE_FLOAT32_C(   302.32),
+        SIMDE_FLOAT32_C(   -49.66), SIMDE_FLOAT32_C(  -782.90), SIMDE_FLOAT32_C(  -909.45), SIMDE_FLOAT32_C(    31.72) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   -49.66), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(    28.31), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(   861.08), SIMDE_FLOAT32_C(    10.00), SIMDE_FLOAT32_C(  -393.95),
+        SIMDE_FLOAT32_C(  -909.45), SIMDE_FLOAT32_C(    13.00), SIMDE_FLOAT32_C(    14.00), SIMDE_FLOAT32_C(    15.00),
+        SIMDE_FLOAT32_C(    16.00), SIMDE_FLOAT32_C(   977.70), SIMDE_FLOAT32_C(    18.00), SIMDE_FLOAT32_C(    19.00),
+        SIMDE_FLOAT32_C(   689.27), SIMDE_FLOAT32_C(    21.00), SIMDE_FLOAT32_C(    22.00), SIMDE_FLOAT32_C(    23.00),
+        SIMDE_FLOAT32_C(    24.00), SIMDE_FLOAT32_C(    25.00), SIMDE_FLOAT32_C(    26.00), SIMDE_FLOAT32_C(    27.00),
+        SIMDE_FLOAT32_C(   302.32), SIMDE_FLOAT32_C(    29.00), SIMDE_FLOAT32_C(    30.00), SIMDE_FLOAT32_C(   830.20) } },
+    { UINT16_C( 7663),
+      {  INT32_C(          13),  INT32_C(          28),  INT32_C(          25),  INT32_C(           2),  INT32_C(           3),  INT32_C(          14),  INT32_C(           6),  INT32_C(          10),
+         INT32_C(          21),  INT32_C(          10),  INT32_C(          10),  INT32_C(          21),  INT32_C(           6),  INT32_C(          19),  INT32_C(          18),  INT32_C(           5) },
+      { SIMDE_FLOAT32_C(  -737.74), SIMDE_FLOAT32_C(   584.83), SIMDE_FLOAT32_C(  -732.71), SIMDE_FLOAT32_C(  -487.69),
+        SIMDE_FLOAT32_C(  -802.31), SIMDE_FLOAT32_C(  -894.15), SIMDE_FLOAT32_C(   141.00), SIMDE_FLOAT32_C(  -156.22),
+        SIMDE_FLOAT32_C(   975.84), SIMDE_FLOAT32_C(   110.56), SIMDE_FLOAT32_C(   421.24), SIMDE_FLOAT32_C(   657.09),
+        SIMDE_FLOAT32_C(  -601.30), SIMDE_FLOAT32_C(   791.12), SIMDE_FLOAT32_C(   -20.19), SIMDE_FLOAT32_C(  -170.51) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(  -487.69), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(  -601.30), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(   421.24), SIMDE_FLOAT32_C(    11.00),
+        SIMDE_FLOAT32_C(    12.00), SIMDE_FLOAT32_C(  -737.74), SIMDE_FLOAT32_C(  -894.15), SIMDE_FLOAT32_C(    15.00),
+        SIMDE_FLOAT32_C(    16.00), SIMDE_FLOAT32_C(    17.00), SIMDE_FLOAT32_C(    18.00), SIMDE_FLOAT32_C(    19.00),
+        SIMDE_FLOAT32_C(    20.00), SIMDE_FLOAT32_C(   657.09), SIMDE_FLOAT32_C(    22.00), SIMDE_FLOAT32_C(    23.00),
+        SIMDE_FLOAT32_C(    24.00), SIMDE_FLOAT32_C(  -732.71), SIMDE_FLOAT32_C(    26.00), SIMDE_FLOAT32_C(    27.00),
+        SIMDE_FLOAT32_C(   584.83), SIMDE_FLOAT32_C(    29.00), SIMDE_FLOAT32_C(    30.00), SIMDE_FLOAT32_C(    31.00) } },
+    { UINT16_C(15179),
+      {  INT32_C(          25),  INT32_C(          24),  INT32_C(          15),  INT32_C(          24),  INT32_C(          13),  INT32_C(           8),  INT32_C(          13),  INT32_C(          18),
+         INT32_C(          16),  INT32_C(           3),  INT32_C(          28),  INT32_C(          25),  INT32_C(          15),  INT32_C(          27),  INT32_C(           3),  INT32_C(          15) },
+      { SIMDE_FLOAT32_C(  -443.21), SIMDE_FLOAT32_C(   -85.62), SIMDE_FLOAT32_C(   265.25), SIMDE_FLOAT32_C(    48.99),
+        SIMDE_FLOAT32_C(   866.17), SIMDE_FLOAT32_C(  -426.17), SIMDE_FLOAT32_C(  -915.57), SIMDE_FLOAT32_C(  -763.25),
+        SIMDE_FLOAT32_C(  -666.30), SIMDE_FLOAT32_C(   159.77), SIMDE_FLOAT32_C(   109.82), SIMDE_FLOAT32_C(  -192.90),
+        SIMDE_FLOAT32_C(   859.83), SIMDE_FLOAT32_C(  -247.33), SIMDE_FLOAT32_C(  -493.66), SIMDE_FLOAT32_C(  -617.69) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(   159.77),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(    10.00), SIMDE_FLOAT32_C(    11.00),
+        SIMDE_FLOAT32_C(    12.00), SIMDE_FLOAT32_C(  -915.57), SIMDE_FLOAT32_C(    14.00), SIMDE_FLOAT32_C(   859.83),
+        SIMDE_FLOAT32_C(  -666.30), SIMDE_FLOAT32_C(    17.00), SIMDE_FLOAT32_C(    18.00), SIMDE_FLOAT32_C(    19.00),
+        SIMDE_FLOAT32_C(    20.00), SIMDE_FLOAT32_C(    21.00), SIMDE_FLOAT32_C(    22.00), SIMDE_FLOAT32_C(    23.00),
+        SIMDE_FLOAT32_C(    48.99), SIMDE_FLOAT32_C(  -192.90), SIMDE_FLOAT32_C(    26.00), SIMDE_FLOAT32_C(  -247.33),
+        SIMDE_FLOAT32_C(    28.00), SIMDE_FLOAT32_C(    29.00), SIMDE_FLOAT32_C(    30.00), SIMDE_FLOAT32_C(    31.00) } },
+    { UINT16_C(18189),
+      {  INT32_C(          29),  INT32_C(          17),  INT32_C(          22),  INT32_C(          31),  INT32_C(          17),  INT32_C(          11),  INT32_C(          13),  INT32_C(           2),
+         INT32_C(          11),  INT32_C(          18),  INT32_C(           5),  INT32_C(          22),  INT32_C(           7),  INT32_C(          13),  INT32_C(          11),  INT32_C(          13) },
+      { SIMDE_FLOAT32_C(  -478.84), SIMDE_FLOAT32_C(   276.05), SIMDE_FLOAT32_C(   410.94), SIMDE_FLOAT32_C(    -6.50),
+        SIMDE_FLOAT32_C(  -492.25), SIMDE_FLOAT32_C(  -468.20), SIMDE_FLOAT32_C(   126.50), SIMDE_FLOAT32_C(   -45.78),
+        SIMDE_FLOAT32_C(   372.33), SIMDE_FLOAT32_C(   182.18), SIMDE_FLOAT32_C(  -837.03), SIMDE_FLOAT32_C(  -510.66),
+        SIMDE_FLOAT32_C(  -925.07), SIMDE_FLOAT32_C(   399.26), SIMDE_FLOAT32_C(   -68.18), SIMDE_FLOAT32_C(   670.93) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(  -837.03), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(    10.00), SIMDE_FLOAT32_C(   -68.18),
+        SIMDE_FLOAT32_C(    12.00), SIMDE_FLOAT32_C(    13.00), SIMDE_FLOAT32_C(    14.00), SIMDE_FLOAT32_C(    15.00),
+        SIMDE_FLOAT32_C(    16.00), SIMDE_FLOAT32_C(    17.00), SIMDE_FLOAT32_C(   182.18), SIMDE_FLOAT32_C(    19.00),
+        SIMDE_FLOAT32_C(    20.00), SIMDE_FLOAT32_C(    21.00), SIMDE_FLOAT32_C(   410.94), SIMDE_FLOAT32_C(    23.00),
+        SIMDE_FLOAT32_C(    24.00), SIMDE_FLOAT32_C(    25.00), SIMDE_FLOAT32_C(    26.00), SIMDE_FLOAT32_C(    27.00),
+        SIMDE_FLOAT32_C(    28.00), SIMDE_FLOAT32_C(  -478.84), SIMDE_FLOAT32_C(    30.00), SIMDE_FLOAT32_C(    -6.50) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32 r[32];
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(simde_float32, j); }
+    simde_mm512_mask_i32scatter_ps(r, test_vec[i].k, simde_mm512_loadu_epi32(test_vec[i].vindex), simde_mm512_loadu_ps(test_vec[i].a), 4);
+    simde_assert_equal_vf32(32, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask16 k = simde_test_x86_random_mmask16();
+    int32_t vindex[16];
+    simde_float32 a[16], r[32];
+    for (size_t j = 0 ; j < (sizeof(vindex) / sizeof(vindex[0])) ; j++) { vindex[j] = simde_test_codegen_random_i32() & 31; }
+    simde_test_codegen_random_vf32(16, a, HEDLEY_STATIC_CAST(simde_float32, -1000.0), HEDLEY_STATIC_CAST(simde_float32, 1000.0));
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(simde_float32, j); }
+    simde_mm512_mask_i32scatter_ps(r, k, simde_mm512_loadu_epi32(vindex), simde_mm512_loadu_ps(a), 4);
+
+    simde_test_x86_write_mmask16(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_vi32(2, 16, vindex, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vf32(2, 16, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vf32(2, 32, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_i32scatter_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int32_t vindex[16];
+    const simde_float32 a[16];
+    const simde_float32 r[32];
+  } test_vec[] = {
+    { {  INT32_C(          24),  INT32_C(          23),  INT32_C(          10),  INT32_C(          10),  INT32_C(           0),  INT32_C(           4),  INT32_C(          29),  INT32_C(           0),
+         INT32_C(           4),  INT32_C(           6),  INT32_C(           9),  INT32_C(          13),  INT32_C(          31),  INT32_C(           2),  INT32_C(          12),  INT32_C(           3) },
+      { SIMDE_FLOAT32_C(   848.43), SIMDE_FLOAT32_C(  -453.83), SIMDE_FLOAT32_C(   277.21), SIMDE_FLOAT32_C(   289.50),
+        SIMDE_FLOAT32_C(  -615.23), SIMDE_FLOAT32_C(   881.12), SIMDE_FLOAT32_C(   -88.45), SIMDE_FLOAT32_C(   511.29),
+        SIMDE_FLOAT32_C(  -793.85), SIMDE_FLOAT32_C(  -823.53), SIMDE_FLOAT32_C(   510.07), SIMDE_FLOAT32_C(  -701.57),
+        SIMDE_FLOAT32_C(   260.87), SIMDE_FLOAT32_C(   -97.75), SIMDE_FLOAT32_C(   434.02), SIMDE_FLOAT32_C(   575.68) },
+      { SIMDE_FLOAT32_C(   511.29), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(   -97.75), SIMDE_FLOAT32_C(   575.68),
+        SIMDE_FLOAT32_C(  -793.85), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(  -823.53), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(   510.07), SIMDE_FLOAT32_C(   289.50), SIMDE_FLOAT32_C(    11.00),
+        SIMDE_FLOAT32_C(   434.02), SIMDE_FLOAT32_C(  -701.57), SIMDE_FLOAT32_C(    14.00), SIMDE_FLOAT32_C(    15.00),
+        SIMDE_FLOAT32_C(    16.00), SIMDE_FLOAT32_C(    17.00), SIMDE_FLOAT32_C(    18.00), SIMDE_FLOAT32_C(    19.00),
+        SIMDE_FLOAT32_C(    20.00), SIMDE_FLOAT32_C(    21.00), SIMDE_FLOAT32_C(    22.00), SIMDE_FLOAT32_C(  -453.83),
+        SIMDE_FLOAT32_C(   848.43), SIMDE_FLOAT32_C(    25.00), SIMDE_FLOAT32_C(    26.00), SIMDE_FLOAT32_C(    27.00),
+        SIMDE_FLOAT32_C(    28.00), SIMDE_FLOAT32_C(   -88.45), SIMDE_FLOAT32_C(    30.00), SIMDE_FLOAT32_C(   260.87) } },
+    { {  INT32_C(           1),  INT32_C(           8),  INT32_C(          29),  INT32_C(          21),  INT32_C(          10),  INT32_C(          14),  INT32_C(          21),  INT32_C(           5),
+         INT32_C(           5),  INT32_C(          13),  INT32_C(          24),  INT32_C(          10),  INT32_C(           1),  INT32_C(          20),  INT32_C(          14),  INT32_C(          13) },
+      { SIMDE_FLOAT32_C(  -584.09), SIMDE_FLOAT32_C(    57.29), SIMDE_FLOAT32_C(   173.85), SIMDE_FLOAT32_C(   915.98),
+        SIMDE_FLOAT32_C(  -138.51), SIMDE_FLOAT32_C(  -301.28), SIMDE_FLOAT32_C(   115.76), SIMDE_FLOAT32_C(   386.23),
+        SIMDE_FLOAT32_C(   324.01), SIMDE_FLOAT32_C(   406.43), SIMDE_FLOAT32_C(   831.58), SIMDE_FLOAT32_C(  -718.18),
+        SIMDE_FLOAT32_C(   519.05), SIMDE_FLOAT32_C(  -954.04), SIMDE_FLOAT32_C(  -881.67), SIMDE_FLOAT32_C(  -269.18) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   519.05), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(   324.01), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(    57.29), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(  -718.18), SIMDE_FLOAT32_C(    11.00),
+        SIMDE_FLOAT32_C(    12.00), SIMDE_FLOAT32_C(  -269.18), SIMDE_FLOAT32_C(  -881.67), SIMDE_FLOAT32_C(    15.00),
+        SIMDE_FLOAT32_C(    16.00), SIMDE_FLOAT32_C(    17.00), SIMDE_FLOAT32_C(    18.00), SIMDE_FLOAT32_C(    19.00),
+        SIMDE_FLOAT32_C(  -954.04), SIMDE_FLOAT32_C(   115.76), SIMDE_FLOAT32_C(    22.00), SIMDE_FLOAT32_C(    23.00),
+        SIMDE_FLOAT32_C(   831.58), SIMDE_FLOAT32_C(    25.00), SIMDE_FLOAT32_C(    26.00), SIMDE_FLOAT32_C(    27.00),
+        SIMDE_FLOAT32_C(    28.00), SIMDE_FLOAT32_C(   173.85), SIMDE_FLOAT32_C(    30.00), SIMDE_FLOAT32_C(    31.00) } },
+    { {  INT32_C(          25),  INT32_C(          28),  INT32_C(           6),  INT32_C(          19),  INT32_C(          28),  INT32_C(           6),  INT32_C(           0),  INT32_C(          21),
+         INT32_C(          30),  INT32_C(          18),  INT32_C(          18),  INT32_C(          27),  INT32_C(          23),  INT32_C(           8),  INT32_C(           5),  INT32_C(          28) },
+      { SIMDE_FLOAT32_C(  -640.92), SIMDE_FLOAT32_C(  -793.39), SIMDE_FLOAT32_C(   157.79), SIMDE_FLOAT32_C(   215.75),
+        SIMDE_FLOAT32_C(    35.53), SIMDE_FLOAT32_C(  -913.05), SIMDE_FLOAT32_C(   237.05), SIMDE_FLOAT32_C(  -387.10),
+        SIMDE_FLOAT32_C(   615.26), SIMDE_FLOAT32_C(  -794.81), SIMDE_FLOAT32_C(  -281.20), SIMDE_FLOAT32_C(   -42.26),
+        SIMDE_FLOAT32_C(   -58.12), SIMDE_FLOAT32_C(   769.15), SIMDE_FLOAT32_C(   171.68), SIMDE_FLOAT32_C(  -379.02) },
+      { SIMDE_FLOAT32_C(   237.05), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(   171.68), SIMDE_FLOAT32_C(  -913.05), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(   769.15), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(    10.00), SIMDE_FLOAT32_C(    11.00),
+        SIMDE_FLOAT32_C(    12.00), SIMDE_FLOAT32_C(    13.00), SIMDE_FLOAT32_C(    14.00), SIMDE_FLOAT32_C(    15.00),
+        SIMDE_FLOAT32_C(    16.00), SIMDE_FLOAT32_C(    17.00), SIMDE_FLOAT32_C(  -281.20), SIMDE_FLOAT32_C(   215.75),
+        SIMDE_FLOAT32_C(    20.00), SIMDE_FLOAT32_C(  -387.10), SIMDE_FLOAT32_C(    22.00), SIMDE_FLOAT32_C(   -58.12),
+        SIMDE_FLOAT32_C(    24.00), SIMDE_FLOAT32_C(  -640.92), SIMDE_FLOAT32_C(    26.00), SIMDE_FLOAT32_C(   -42.26),
+        SIMDE_FLOAT32_C(  -379.02), SIMDE_FLOAT32_C(    29.00), SIMDE_FLOAT32_C(   615.26), SIMDE_FLOAT32_C(    31.00) } },
+    { {  INT32_C(           3),  INT32_C(          11),  INT32_C(          10),  INT32_C(          13),  INT32_C(          24),  INT32_C(          16),  INT32_C(          12),  INT32_C(          20),
+         INT32_C(           6),  INT32_C(           5),  INT32_C(          24),  INT32_C(           1),  INT32_C(          13),  INT32_C(          13),  INT32_C(           5),  INT32_C(           3) },
+      { SIMDE_FLOAT32_C(   292.67), SIMDE_FLOAT32_C(  -966.83), SIMDE_FLOAT32_C(   546.04), SIMDE_FLOAT32_C(  -148.17),
+        SIMDE_FLOAT32_C(     3.58), SIMDE_FLOAT32_C(  -822.22), SIMDE_FLOAT32_C(  -830.14), SIMDE_FLOAT32_C(   -18.28),
+        SIMDE_FLOAT32_C(  -975.48), SIMDE_FLOAT32_C(  -855.63), SIMDE_FLOAT32_C(   771.31), SIMDE_FLOAT32_C(  -584.61),
+        SIMDE_FLOAT32_C(  -743.47), SIMDE_FLOAT32_C(   731.45), SIMDE_FLOAT32_C(   557.00), SIMDE_FLOAT32_C(   664.14) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -584.61), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(   664.14),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(   557.00), SIMDE_FLOAT32_C(  -975.48), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(   546.04), SIMDE_FLOAT32_C(  -966.83),
+        SIMDE_FLOAT32_C(  -830.14), SIMDE_FLOAT32_C(   731.45), SIMDE_FLOAT32_C(    14.00), SIMDE_FLOAT32_C(    15.00),
+        SIMDE_FLOAT32_C(  -822.22), SIMDE_FLOAT32_C(    17.00), SIMDE_FLOAT32_C(    18.00), SIMDE_FLOAT32_C(    19.00),
+        SIMDE_FLOAT32_C(   -18.28), SIMDE_FLOAT32_C(    21.00), SIMDE_FLOAT32_C(    22.00), SIMDE_FLOAT32_C(    23.00),
+        SIMDE_FLOAT32_C(   771.31), SIMDE_FLOAT32_C(    25.00), SIMDE_FLOAT32_C(    26.00), SIMDE_FLOAT32_C(    27.00),
+        SIMDE_FLOAT32_C(    28.00), SIMDE_FLOAT32_C(    29.00), SIMDE_FLOAT32_C(    30.00), SIMDE_FLOAT32_C(    31.00) } },
+    { {  INT32_C(          26),  INT32_C(          16),  INT32_C(          11),  INT32_C(          28),  INT32_C(          21),  INT32_C(          17),  INT32_C(          26),  INT32_C(          17),
+         INT32_C(           0),  INT32_C(           5),  INT32_C(           5),  INT32_C(          23),  INT32_C(           8),  INT32_C(          26),  INT32_C(           6),  INT32_C(          16) },
+      { SIMDE_FLOAT32_C(  -468.33), SIMDE_FLOAT32_C(   386.77), SIMDE_FLOAT32_C(   181.73), SIMDE_FLOAT32_C(   981.73),
+        SIMDE_FLOAT32_C(  -632.20), SIMDE_FLOAT32_C(   427.04), SIMDE_FLOAT32_C(   416.64), SIMDE_FLOAT32_C(   763.44),
+        SIMDE_FLOAT32_C(   261.52), SIMDE_FLOAT32_C(   706.53), SIMDE_FLOAT32_C(   533.77), SIMDE_FLOAT32_C(  -415.62),
+        SIMDE_FLOAT32_C(   967.16), SIMDE_FLOAT32_C(   -28.55), SIMDE_FLOAT32_C(   428.79), SIMDE_FLOAT32_C(   744.58) },
+      { SIMDE_FLOAT32_C(   261.52), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(   533.77), SIMDE_FLOAT32_C(   428.79), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(   967.16), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(    10.00), SIMDE_FLOAT32_C(   181.73),
+        SIMDE_FLOAT32_C(    12.00), SIMDE_FLOAT32_C(    13.00), SIMDE_FLOAT32_C(    14.00), SIMDE_FLOAT32_C(    15.00),
+        SIMDE_FLOAT32_C(   744.58), SIMDE_FLOAT32_C(   763.44), SIMDE_FLOAT32_C(    18.00), SIMDE_FLOAT32_C(    19.00),
+        SIMDE_FLOAT32_C(    20.00), SIMDE_FLOAT32_C(  -632.20), SIMDE_FLOAT32_C(    22.00), SIMDE_FLOAT32_C(  -415.62),
+        SIMDE_FLOAT32_C(    24.00), SIMDE_FLOAT32_C(    25.00), SIMDE_FLOAT32_C(   -28.55), SIMDE_FLOAT32_C(    27.00),
+        SIMDE_FLOAT32_C(   981.73), SIMDE_FLOAT32_C(    29.00), SIMDE_FLOAT32_C(    30.00), SIMDE_FLOAT32_C(    31.00) } },
+    { {  INT32_C(           6),  INT32_C(           5),  INT32_C(          22),  INT32_C(          25),  INT32_C(          31),  INT32_C(           1),  INT32_C(           0),  INT32_C(           1),
+         INT32_C(           8),  INT32_C(          31),  INT32_C(          10),  INT32_C(           3),  INT32_C(          11),  INT32_C(          22),  INT32_C(          20),  INT32_C(          26) },
+      { SIMDE_FLOAT32_C(  -852.74), SIMDE_FLOAT32_C(  -704.13), SIMDE_FLOAT32_C(   -11.50), SIMDE_FLOAT32_C(  -933.85),
+        SIMDE_FLOAT32_C(   120.50), SIMDE_FLOAT32_C(   117.97), SIMDE_FLOAT32_C(   718.22), SIMDE_FLOAT32_C(   568.09),
+        SIMDE_FLOAT32_C(  -759.07), SIMDE_FLOAT32_C(  -879.48), SIMDE_FLOAT32_C(   -37.94), SIMDE_FLOAT32_C(  -390.96),
+        SIMDE_FLOAT32_C(  -533.56), SIMDE_FLOAT32_C(   834.10), SIMDE_FLOAT32_C(   609.06), SIMDE_FLOAT32_C(   937.70) },
+      { SIMDE_FLOAT32_C(   718.22), SIMDE_FLOAT32_C(   568.09), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(  -390.96),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(  -704.13), SIMDE_FLOAT32_C(  -852.74), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(  -759.07), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(   -37.94), SIMDE_FLOAT32_C(  -533.56),
+        SIMDE_FLOAT32_C(    12.00), SIMDE_FLOAT32_C(    13.00), SIMDE_FLOAT32_C(    14.00), SIMDE_FLOAT32_C(    15.00),
+        SIMDE_FLOAT32_C(    16.00), SIMDE_FLOAT32_C(    17.00), SIMDE_FLOAT32_C(    18.00), SIMDE_FLOAT32_C(    19.00),
+        SIMDE_FLOAT32_C(   609.06), SIMDE_FLOAT32_C(    21.00), SIMDE_FLOAT32_C(   834.10), SIMDE_FLOAT32_C(    23.00),
+        SIMDE_FLOAT32_C(    24.00), SIMDE_FLOAT32_C(  -933.85), SIMDE_FLOAT32_C(   937.70), SIMDE_FLOAT32_C(    27.00),
+        SIMDE_FLOAT32_C(    28.00), SIMDE_FLOAT32_C(    29.00), SIMDE_FLOAT32_C(    30.00), SIMDE_FLOAT32_C(  -879.48) } },
+    { {  INT32_C(           7),  INT32_C(          31),  INT32_C(          16),  INT32_C(           9),  INT32_C(          14),  INT32_C(           4),  INT32_C(           3),  INT32_C(           0),
+         INT32_C(          17),  INT32_C(          15),  INT32_C(           6),  INT32_C(          20),  INT32_C(          19),  INT32_C(          29),  INT32_C(          19),  INT32_C(          10) },
+      { SIMDE_FLOAT32_C(   155.78), SIMDE_FLOAT32_C(  -509.41), SIMDE_FLOAT32_C(  -535.77), SIMDE_FLOAT32_C(   515.01),
+        SIMDE_FLOAT32_C(   261.21), SIMDE_FLOAT32_C(   227.69), SIMDE_FLOAT32_C(   909.00), SIMDE_FLOAT32_C(   538.51),
+        SIMDE_FLOAT32_C(   750.82), SIMDE_FLOAT32_C(  -599.35), SIMDE_FLOAT32_C(   958.50), SIMDE_FLOAT32_C(  -441.51),
+        SIMDE_FLOAT32_C(   678.30), SIMDE_FLOAT32_C(  -331.56), SIMDE_FLOAT32_C(   946.59), SIMDE_FLOAT32_C(  -269.55) },
+      { SIMDE_FLOAT32_C(   538.51), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(   909.00),
+        SIMDE_FLOAT32_C(   227.69), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(   958.50), SIMDE_FLOAT32_C(   155.78),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(   515.01), SIMDE_FLOAT32_C(  -269.55), SIMDE_FLOAT32_C(    11.00),
+        SIMDE_FLOAT32_C(    12.00), SIMDE_FLOAT32_C(    13.00), SIMDE_FLOAT32_C(   261.21), SIMDE_FLOAT32_C(  -599.35),
+        SIMDE_FLOAT32_C(  -535.77), SIMDE_FLOAT32_C(   750.82), SIMDE_FLOAT32_C(    18.00), SIMDE_FLOAT32_C(   946.59),
+        SIMDE_FLOAT32_C(  -441.51), SIMDE_FLOAT32_C(    21.00), SIMDE_FLOAT32_C(    22.00), SIMDE_FLOAT32_C(    23.00),
+        SIMDE_FLOAT32_C(    24.00), SIMDE_FLOAT32_C(    25.00), SIMDE_FLOAT32_C(    26.00), SIMDE_FLOAT32_C(    27.00),
+        SIMDE_FLOAT32_C(    28.00), SIMDE_FLOAT32_C(  -331.56), SIMDE_FLOAT32_C(    30.00), SIMDE_FLOAT32_C(  -509.41) } },
+    { {  INT32_C(          29),  INT32_C(           5),  INT32_C(          23),  INT32_C(          21),  INT32_C(           5),  INT32_C(          21),  INT32_C(           3),  INT32_C(          29),
+         INT32_C(          30),  INT32_C(          29),  INT32_C(          25),  INT32_C(          11),  INT32_C(          24),  INT32_C(          16),  INT32_C(           1),  INT32_C(          20) },
+      { SIMDE_FLOAT32_C(  -619.87), SIMDE_FLOAT32_C(   930.09), SIMDE_FLOAT32_C(   868.78), SIMDE_FLOAT32_C(    -0.57),
+        SIMDE_FLOAT32_C(  -810.99), SIMDE_FLOAT32_C(  -893.68), SIMDE_FLOAT32_C(  -807.74), SIMDE_FLOAT32_C(  -345.57),
+        SIMDE_FLOAT32_C(   -19.16), SIMDE_FLOAT32_C(  -869.41), SIMDE_FLOAT32_C(   921.83), SIMDE_FLOAT32_C(   377.66),
+        SIMDE_FLOAT32_C(   946.67), SIMDE_FLOAT32_C(   146.98), SIMDE_FLOAT32_C(   787.39), SIMDE_FLOAT32_C(  -895.27) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   787.39), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(  -807.74),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(  -810.99), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(    10.00), SIMDE_FLOAT32_C(   377.66),
+        SIMDE_FLOAT32_C(    12.00), SIMDE_FLOAT32_C(    13.00), SIMDE_FLOAT32_C(    14.00), SIMDE_FLOAT32_C(    15.00),
+        SIMDE_FLOAT32_C(   146.98), SIMDE_FLOAT32_C(    17.00), SIMDE_FLOAT32_C(    18.00), SIMDE_FLOAT32_C(    19.00),
+        SIMDE_FLOAT32_C(  -895.27), SIMDE_FLOAT32_C(  -893.68), SIMDE_FLOAT32_C(    22.00), SIMDE_FLOAT32_C(   868.78),
+        SIMDE_FLOAT32_C(   946.67), SIMDE_FLOAT32_C(   921.83), SIMDE_FLOAT32_C(    26.00), SIMDE_FLOAT32_C(    27.00),
+        SIMDE_FLOAT32_C(    28.00), SIMDE_FLOAT32_C(  -869.41), SIMDE_FLOAT32_C(   -19.16), SIMDE_FLOAT32_C(    31.00) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32 r[32];
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(simde_float32, j); }
+    simde_mm512_i32scatter_ps(r, simde_mm512_loadu_epi32(test_vec[i].vindex), simde_mm512_loadu_ps(test_vec[i].a), 4);
+    simde_assert_equal_vf32(32, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int32_t vindex[16];
+    simde_float32 a[16], r[32];
+    for (size_t j = 0 ; j < (sizeof(vindex) / sizeof(vindex[0])) ; j++) { vindex[j] = simde_test_codegen_random_i32() & 31; }
+    simde_test_codegen_random_vf32(16, a, HEDLEY_STATIC_CAST(simde_float32, -1000.0), HEDLEY_STATIC_CAST(simde_float32, 1000.0));
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(simde_float32, j); }
+    simde_mm512_i32scatter_ps(r, simde_mm512_loadu_epi32(vindex), simde_mm512_loadu_ps(a), 4);
+
+    simde_test_codegen_write_vi32(2, 16, vindex, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_vf32(2, 16, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vf32(2, 32, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_mask_i64scatter_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t vindex[8];
+    const int32_t a[8];
+    const int32_t r[16];
+  } test_vec[] = {
+    { UINT8_C( 42),
+      {  INT64_C(                   3),  INT64_C(                   1),  INT64_C(                   3),  INT64_C(                  11),
+         INT64_C(                   8),  INT64_C(                   1),  INT64_C(                  15),  INT64_C(                  11) },
+      {  INT32_C(  1440513775), -INT32_C(   337812326),  INT32_C(   713697656),  INT32_C(   839894547), -INT32_C(  1982769347),  INT32_C(   319853272),  INT32_C(   991742663), -INT32_C(   785951262) },
+      {  INT32_C(           0),  INT32_C(   319853272),  INT32_C(           2),  INT32_C(           3),  INT32_C(           4),  INT32_C(           5),  INT32_C(           6),  INT32_C(           7),
+         INT32_C(           8),  INT32_C(           9),  INT32_C(          10),  INT32_C(   839894547),  INT32_C(          12),  INT32_C(          13),  INT32_C(          14),  INT32_C(          15) } },
+    { UINT8_C(211),
+      {  INT64_C(                   3),  INT64_C(                   4),  INT64_C(                   3),  INT64_C(                   7),
+         INT64_C(                   6),  INT64_C(                   4),  INT64_C(                  13),  INT64_C(                   9) },
+      { -INT32_C(   694613649), -INT32_C(  1457393324), -INT32_C(  1844046200),  INT32_C(  1088418546), -INT32_C(  1794178538),  INT32_C(  1552624322), -INT32_C(  1141486221),  INT32_C(   506107055) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           2), -INT32_C(   694613649), -INT32_C(  1457393324),  INT32_C(           5), -INT32_C(  1794178538),  INT32_C(           7),
+         INT32_C(           8),  INT32_C(   506107055),  INT32_C(          10),  INT32_C(          11),  INT32_C(          12), -INT32_C(  1141486221),  INT32_C(          14),  INT32_C(          15) } },
+    { UINT8_C(157),
+      {  INT64_C(                   4),  INT64_C(                   1),  INT64_C(                  12),  INT64_C(                   5),
+         INT64_C(                   9),  INT64_C(                   5),  INT64_C(                   1),  INT64_C(                   6) },
+      { -INT32_C(  1751482093), -INT32_C(  1647590617), -INT32_C(  1346264310),  INT32_C(   398497077), -INT32_C(   204249123), -INT32_C(  1898989544),  INT32_C(   670303093),  INT32_C(  1120013614) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           2),  INT32_C(           3), -INT32_C(  1751482093),  INT32_C(   398497077),  INT32_C(  1120013614),  INT32_C(           7),
+         INT32_C(           8), -INT32_C(   204249123),  INT32_C(          10),  INT32_C(          11), -INT32_C(  1346264310),  INT32_C(          13),  INT32_C(          14),  INT32_C(          15) } },
+    { UINT8_C(142),
+      {  INT64_C(                  12),  INT64_C(                   4),  INT64_C(                   8),  INT64_C(                  12),
+         INT64_C(                   6),  INT64_C(                  15),  INT64_C(                  14),  INT64_C(                  15) },
+      {  INT32_C(   110937541), -INT32_C(   363192341), -INT32_C(  1283237857), -INT32_C(   609215011),  INT32_C(   740543953), -INT32_C(   299583617), -INT32_C(  1831025466),  INT32_C(  1660200604) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           2),  INT32_C(           3), -INT32_C(   363192341),  INT32_C(           5),  INT32_C(           6),  INT32_C(           7),
+        -INT32_C(  1283237857),  INT32_C(           9),  INT32_C(          10),  INT32_C(          11), -INT32_C(   609215011),  INT32_C(          13),  INT32_C(          14),  INT32_C(  1660200604) } },
+    { UINT8_C(107),
+      {  INT64_C(                   0),  INT64_C(                   4),  INT64_C(                   6),  INT64_C(                   9),
+         INT64_C(                  14),  INT64_C(                  10),  INT64_C(                   8),  INT64_C(                   4) },
+      { -INT32_C(   616844822),  INT32_C(  1133528761),  INT32_C(   570369866), -INT32_C(  1729185168), -INT32_C(  1698469389),  INT32_C(  1284158808),  INT32_C(   674851084), -INT32_C(  1905020509) },
+      { -INT32_C(   616844822),  INT32_C(           1),  INT32_C(           2),  INT32_C(           3),  INT32_C(  1133528761),  INT32_C(           5),  INT32_C(           6),  INT32_C(           7),
+         INT32_C(   674851084), -INT32_C(  1729185168),  INT32_C(  1284158808),  INT32_C(          11),  INT32_C(          12),  INT32_C(          13),  INT32_C(          14),  INT32_C(          15) } },
+    { UINT8_C( 98),
+      {  INT64_C(                  14),  INT64_C(                  13),  INT64_C(                  12),  INT64_C(                   5),
+         INT64_C(                   3),  INT64_C(                   9),  INT64_C(                   4),  INT64_C(                   9) },
+      {  INT32_C(  1634681920), -INT32_C(   119554706), -INT32_C(  1529908068),  INT32_C(  1469603347), -INT32_C(   137744643), -INT32_C(  1970875279),  INT32_C(   720132890),  INT32_C(   409748952) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           2),  INT32_C(           3),  INT32_C(   720132890),  INT32_C(           5),  INT32_C(           6),  INT32_C(           7),
+         INT32_C(           8), -INT32_C(  1970875279),  INT32_C(          10),  INT32_C(          11),  INT32_C(          12), -INT32_C(   119554706),  INT32_C(          14),  INT32_C(          15) } },
+    { UINT8_C(137),
+      {  INT64_C(                  12),  INT64_C(                  15),  INT64_C(                   1),  INT64_C(                   8),
+         INT64_C(                  12),  INT64_C(                  12),  INT64_C(                   9),  INT64_C(                   7) },
+      {  INT32_C(   127032520), -INT32_C(  1710943602),  INT32_C(   135930225), -INT32_C(  1583400360),  INT32_C(   998378605), -INT32_C(   527280535),  INT32_C(  2011084277), -INT32_C(   128631249) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           2),  INT32_C(           3),  INT32_C(           4),  INT32_C(           5),  INT32_C(           6), -INT32_C(   128631249),
+        -INT32_C(  1583400360),  INT32_C(           9),  INT32_C(          10),  INT32_C(          11),  INT32_C(   127032520),  INT32_C(          13),  INT32_C(          14),  INT32_C(          15) } },
+    { UINT8_C(154),
+      {  INT64_C(                   7),  INT64_C(                  12),  INT64_C(                   0),  INT64_C(                   6),
+         INT64_C(                  13),  INT64_C(                   4),  INT64_C(                   0),  INT64_C(                   4) },
+      { -INT32_C(   832782139),  INT32_C(   917746626),  INT32_C(  2025631878),  INT32_C(  1879662640),  INT32_C(   570593677), -INT32_C(   654468605),  INT32_C(  1734565225), -INT32_C(  1584230948) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           2),  INT32_C(           3), -INT32_C(  1584230948),  INT32_C(           5),  INT32_C(  1879662640),  INT32_C(           7),
+         INT32_C(           8),  INT32_C(           9),  INT32_C(          10),  INT32_C(          11),  INT32_C(   917746626),  INT32_C(   570593677),  INT32_C(          14),  INT32_C(          15) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int32_t r[16];
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(int32_t, j); }
+    simde_mm512_mask_i64scatter_epi32(r, test_vec[i].k, simde_mm512_loadu_epi64(test_vec[i].vindex), simde_mm256_loadu_epi32(test_vec[i].a), 4);
+    simde_assert_equal_vi32(16, r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    int64_t vindex[8];
+    int32_t a[8], r[16];
+    for (size_t j = 0 ; j < (sizeof(vindex) / sizeof(vindex[0])) ; j++) { vindex[j] = simde_test_codegen_random_i64() & 15; }
+    for (size_t j = 0 ; j < (sizeof(a) / sizeof(a[0])) ; j++) { a[j] = simde_test_codegen_random_i32(); }
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(int32_t, j); }
+    simde_mm512_mask_i64scatter_epi32(r, k, simde_mm512_loadu_epi64(vindex), simde_mm256_loadu_epi32(a), 4);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_vi64(2, 8, vindex, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi32(2, 8, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi32(2, 16, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_i64scatter_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int64_t vindex[8];
+    const int32_t a[8];
+    const int32_t r[16];
+  } test_vec[] = {
+    { {  INT64_C(                  13),  INT64_C(                   2),  INT64_C(                  10),  INT64_C(                  12),
+         INT64_C(                   1),  INT64_C(                  10),  INT64_C(                   9),  INT64_C(                  12) },
+      { -INT32_C(  1971766768), -INT32_C(  1915247645), -INT32_C(   493213842),  INT32_C(   613455339), -INT32_C(  1116897886), -INT32_C(    79417473), -INT32_C(   394390574), -INT32_C(   614574901) },
+      {  INT32_C(           0), -INT32_C(  1116897886), -INT32_C(  1915247645),  INT32_C(           3),  INT32_C(           4),  INT32_C(           5),  INT32_C(           6),  INT32_C(           7),
+         INT32_C(           8), -INT32_C(   394390574), -INT32_C(    79417473),  INT32_C(          11), -INT32_C(   614574901), -INT32_C(  1971766768),  INT32_C(          14),  INT32_C(          15) } },
+    { {  INT64_C(                  14),  INT64_C(                   4),  INT64_C(                   8),  INT64_C(                   4),
+         INT64_C(                   0),  INT64_C(                  14),  INT64_C(                   5),  INT64_C(                   0) },
+      {  INT32_C(  1469571370), -INT32_C(   991298810), -INT32_C(  1229927893),  INT32_C(  1394175262), -INT32_C(   728181320), -INT32_C(   992689948), -INT32_C(   842300238), -INT32_C(   370637121) },
+      { -INT32_C(   370637121),  INT32_C(           1),  INT32_C(           2),  INT32_C(           3),  INT32_C(  1394175262), -INT32_C(   842300238),  INT32_C(           6),  INT32_C(           7),
+        -INT32_C(  1229927893),  INT32_C(           9),  INT32_C(          10),  INT32_C(          11),  INT32_C(          12),  INT32_C(          13), -INT32_C(   992689948),  INT32_C(          15) } },
+    { {  INT64_C(                   7),  INT64_C(                   4),  INT64_C(                  10),  INT64_C(                   4),
+         INT64_C(                   5),  INT64_C(                  10),  INT64_C(                   2),  INT64_C(                   2) },
+      {  INT32_C(  1930152236),  INT32_C(  1018155282), -INT32_C(  1934164492),  INT32_C(  1668167345), -INT32_C(  1647018094),  INT32_C(  1172092547),  INT32_C(   441126613),  INT32_C(  1208286236) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(  1208286236),  INT32_C(           3),  INT32_C(  1668167345), -INT32_C(  1647018094),  INT32_C(           6),  INT32_C(  1930152236),
+         INT32_C(           8),  INT32_C(           9),  INT32_C(  1172092547),  INT32_C(          11),  INT32_C(          12),  INT32_C(          13),  INT32_C(          14),  INT32_C(          15) } },
+    { {  INT64_C(                   5),  INT64_C(                   8),  INT64_C(                  15),  INT64_C(                   9),
+         INT64_C(                  10),  INT64_C(                  11),  INT64_C(                   4),  INT64_C(                  13) },
+      {  INT32_C(  1471942833), -INT32_C(    60523487), -INT32_C(  1898476643),  INT32_C(   583877934), -INT32_C(  1944199197), -INT32_C(  1756433399), -INT32_C(  2004596799),  INT32_C(  1868208062) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           2),  INT32_C(           3), -INT32_C(  2004596799),  INT32_C(  1471942833),  INT32_C(           6),  INT32_C(           7),
+        -INT32_C(    60523487),  INT32_C(   583877934), -INT32_C(  1944199197), -INT32_C(  1756433399),  INT32_C(          12),  INT32_C(  1868208062),  INT32_C(          14), -INT32_C(  1898476643) } },
+    { {  INT64_C(                   7),  INT64_C(                   6),  INT64_C(                  11),  INT64_C(                   6),
+         INT64_C(                   1),  INT64_C(                   8),  INT64_C(                   8),  INT64_C(                  12) },
+      {  INT32_C(   168291077),  INT32_C(  1086692168), -INT32_C(   853908242), -INT32_C(   786908919),  INT32_C(   917559208), -INT32_C(     5609565),  INT32_C(  1367589503), -INT32_C(   202058003) },
+      {  INT32_C(           0),  INT32_C(   917559208),  INT32_C(           2),  INT32_C(           3),  INT32_C(           4),  INT32_C(           5), -INT32_C(   786908919),  INT32_C(   168291077),
+         INT32_C(  1367589503),  INT32_C(           9),  INT32_C(          10), -INT32_C(   853908242), -INT32_C(   202058003),  INT32_C(          13),  INT32_C(          14),  INT32_C(          15) } },
+    { {  INT64_C(                   2),  INT64_C(                   7),  INT64_C(                   2),  INT64_C(                   8),
+         INT64_C(                   9),  INT64_C(                   9),  INT64_C(                   7),  INT64_C(                   4) },
+      { -INT32_C(  1797428597),  INT32_C(  2009387710), -INT32_C(   867293670), -INT32_C(  1581192310), -INT32_C(  1009608316),  INT32_C(  2053807446), -INT32_C(   405051565),  INT32_C(   928267436) },
+      {  INT32_C(           0),  INT32_C(           1), -INT32_C(   867293670),  INT32_C(           3),  INT32_C(   928267436),  INT32_C(           5),  INT32_C(           6), -INT32_C(   405051565),
+        -INT32_C(  1581192310),  INT32_C(  2053807446),  INT32_C(          10),  INT32_C(          11),  INT32_C(          12),  INT32_C(          13),  INT32_C(          14),  INT32_C(          15) } },
+    { {  INT64_C(                   7),  INT64_C(                   5),  INT64_C(                   3),  INT64_C(                   0),
+         INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   6),  INT64_C(                   8) },
+      { -INT32_C(  2005213670),  INT32_C(   883732211), -INT32_C(  1769271347),  INT32_C(  1235385938), -INT32_C(   326088496), -INT32_C(  1439139326),  INT32_C(  1132355823), -INT32_C(  1213717092) },
+      { -INT32_C(  1439139326), -INT32_C(   326088496),  INT32_C(           2), -INT32_C(  1769271347),  INT32_C(           4),  INT32_C(   883732211),  INT32_C(  1132355823), -INT32_C(  2005213670),
+        -INT32_C(  1213717092),  INT32_C(           9),  INT32_C(          10),  INT32_C(          11),  INT32_C(          12),  INT32_C(          13),  INT32_C(          14),  INT32_C(          15) } },
+    { {  INT64_C(                   3),  INT64_C(                  10),  INT64_C(                  15),  INT64_C(                  10),
+         INT64_C(                  15),  INT64_C(                  11),  INT64_C(                  12),  INT64_C(                   2) },
+      {  INT32_C(  1419492940), -INT32_C(  1621644717),  INT32_C(   136292334), -INT32_C(  1723685491), -INT32_C(  1102668259),  INT32_C(   938050245),  INT32_C(   504969874), -INT32_C(  1253479063) },
+      {  INT32_C(           0),  INT32_C(           1), -INT32_C(  1253479063),  INT32_C(  1419492940),  INT32_C(           4),  INT32_C(           5),  INT32_C(           6),  INT32_C(           7),
+         INT32_C(           8),  INT32_C(           9), -INT32_C(  1723685491),  INT32_C(   938050245),  INT32_C(   504969874),  INT32_C(          13),  INT32_C(          14), -INT32_C(  1102668259) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int32_t r[16];
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(int32_t, j); }
+    simde_mm512_i64scatter_epi32(r, simde_mm512_loadu_epi64(test_vec[i].vindex), simde_mm256_loadu_epi32(test_vec[i].a), 4);
+    simde_assert_equal_vi32(16, r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int64_t vindex[8];
+    int32_t a[8], r[16];
+    for (size_t j = 0 ; j < (sizeof(vindex) / sizeof(vindex[0])) ; j++) { vindex[j] = simde_test_codegen_random_i64() & 15; }
+    for (size_t j = 0 ; j < (sizeof(a) / sizeof(a[0])) ; j++) { a[j] = simde_test_codegen_random_i32(); }
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(int32_t, j); }
+    simde_mm512_i64scatter_epi32(r, simde_mm512_loadu_epi64(vindex), simde_mm256_loadu_epi32(a), 4);
+
+    simde_test_codegen_write_vi64(2, 8, vindex, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_vi32(2, 8, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi32(2, 16, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_mask_i64scatter_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t vindex[8];
+    const int64_t a[8];
+    const int64_t r[16];
+  } test_vec[] = {
+    { UINT8_C( 44),
+      {  INT64_C(                   5),  INT64_C(                  14),  INT64_C(                   6),  INT64_C(                  12),
+         INT64_C(                  11),  INT64_C(                  11),  INT64_C(                   4),  INT64_C(                  15) },
+      {  INT64_C( 7053015209537048891),  INT64_C( 2400752361679468387),  INT64_C( 1208226050935225589),  INT64_C( 3946715655170053349),
+         INT64_C( 7130895849976342430), -INT64_C( 5806173759999996994),  INT64_C( 3067393648427387471), -INT64_C( 7055101018237144090) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   2),  INT64_C(                   3),
+         INT64_C(                   4),  INT64_C(                   5),  INT64_C( 1208226050935225589),  INT64_C(                   7),
+         INT64_C(                   8),  INT64_C(                   9),  INT64_C(                  10), -INT64_C( 5806173759999996994),
+         INT64_C( 3946715655170053349),  INT64_C(                  13),  INT64_C(                  14),  INT64_C(                  15) } },
+    { UINT8_C(230),
+      {  INT64_C(                  12),  INT64_C(                   8),  INT64_C(                  10),  INT64_C(                  13),
+         INT64_C(                  15),  INT64_C(                   8),  INT64_C(                   4),  INT64_C(                   1) },
+      { -INT64_C( 9078238314489545407),  INT64_C( 2476073994175095591), -INT64_C( 8673244772366653451), -INT64_C( 1786743065120875713),
+         INT64_C( 8975649133887403955), -INT64_C( 5774559500299603315), -INT64_C( 7032258256143323636), -INT64_C( 1887028920248108223) },
+      {  INT64_C(                   0), -INT64_C( 1887028920248108223),  INT64_C(                   2),  INT64_C(                   3),
+        -INT64_C( 7032258256143323636),  INT64_C(                   5),  INT64_C(                   6),  INT64_C(                   7),
+        -INT64_C( 5774559500299603315),  INT64_C(                   9), -INT64_C( 8673244772366653451),  INT64_C(                  11),
+         INT64_C(                  12),  INT64_C(                  13),  INT64_C(                  14),  INT64_C(                  15) } },
+    { UINT8_C(164),
+      {  INT64_C(                   5),  INT64_C(                  13),  INT64_C(                   2),  INT64_C(                   7),
+         INT64_C(                  12),  INT64_C(                   5),  INT64_C(                   3),  INT64_C(                   2) },
+      { -INT64_C( 3330122290546873282), -INT64_C( 8790795284688318490), -INT64_C(  480705283949959493),  INT64_C( 3764292360257382597),
+        -INT64_C( 9107225556426320801),  INT64_C( 2502351469121082865),  INT64_C( 3646449420518964362),  INT64_C( 5232218398273140083) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C( 5232218398273140083),  INT64_C(                   3),
+         INT64_C(                   4),  INT64_C( 2502351469121082865),  INT64_C(                   6),  INT64_C(                   7),
+         INT64_C(                   8),  INT64_C(                   9),  INT64_C(                  10),  INT64_C(                  11),
+         INT64_C(                  12),  INT64_C(                  13),  INT64_C(                  14),  INT64_C(                  15) } },
+    { UINT8_C( 38),
+      {  INT64_C(                   5),  INT64_C(                   7),  INT64_C(                   4),  INT64_C(                   9),
+         INT64_C(                  10),  INT64_C(                   9),  INT64_C(                   3),  INT64_C(                   7) },
+      {  INT64_C( 4942733487437238114),  INT64_C(  214510729604395463),  INT64_C( 5356376526024918332),  INT64_C( 6040386962622788113),
+        -INT64_C( 2899696865113148526), -INT64_C( 6122625624380647513), -INT64_C( 5029898834241585962), -INT64_C( 7949983647373247641) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   2),  INT64_C(                   3),
+         INT64_C( 5356376526024918332),  INT64_C(                   5),  INT64_C(                   6),  INT64_C(  214510729604395463),
+         INT64_C(                   8), -INT64_C( 6122625624380647513),  INT64_C(                  10),  INT64_C(                  11),
+         INT64_C(                  12),  INT64_C(                  13),  INT64_C(                  14),  INT64_C(                  15) } },
+    { UINT8_C(238),
+      {  INT64_C(                   8),  INT64_C(                  12),  INT64_C(                   3),  INT64_C(                   9),
+         INT64_C(                   7),  INT64_C(                   7),  INT64_C(                  12),  INT64_C(                  15) },
+      { -INT64_C( 3879284887261199023), -INT64_C( 6362445272616498854), -INT64_C( 7990928754283001059),  INT64_C( 3186016200094329261),
+        -INT64_C( 3097880083387090874),  INT64_C(   75012958413641384), -INT64_C( 4791870612744139701),  INT64_C(  651760547885007364) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   2), -INT64_C( 7990928754283001059),
+         INT64_C(                   4),  INT64_C(                   5),  INT64_C(                   6),  INT64_C(   75012958413641384),
+         INT64_C(                   8),  INT64_C( 3186016200094329261),  INT64_C(                  10),  INT64_C(                  11),
+        -INT64_C( 4791870612744139701),  INT64_C(                  13),  INT64_C(                  14),  INT64_C(  651760547885007364) } },
+    { UINT8_C(252),
+      {  INT64_C(                  15),  INT64_C(                   7),  INT64_C(                  15),  INT64_C(                   9),
+         INT64_C(                  14),  INT64_C(                   3),  INT64_C(                  10),  INT64_C(                   0) },
+      { -INT64_C( 6516280871911577791), -INT64_C( 9100946886853108992), -INT64_C( 1593954343906081210), -INT64_C( 6197124162916255537),
+        -INT64_C( 8231849437035034613),  INT64_C( 7384418090295439091), -INT64_C( 5394908943542795201), -INT64_C(  975015129591741594) },
+      { -INT64_C(  975015129591741594),  INT64_C(                   1),  INT64_C(                   2),  INT64_C( 7384418090295439091),
+         INT64_C(                   4),  INT64_C(                   5),  INT64_C(                   6),  INT64_C(                   7),
+         INT64_C(                   8), -INT64_C( 6197124162916255537), -INT64_C( 5394908943542795201),  INT64_C(                  11),
+         INT64_C(                  12),  INT64_C(                  13), -INT64_C( 8231849437035034613), -INT64_C( 1593954343906081210) } },
+    { UINT8_C( 20),
+      {  INT64_C(                  15),  INT64_C(                   6),  INT64_C(                   3),  INT64_C(                  11),
+         INT64_C(                   5),  INT64_C(                   1),  INT64_C(                  11),  INT64_C(                   1) },
+      { -INT64_C( 2294146344039333834), -INT64_C(  186686758318035593), -INT64_C(  462092473038967685), -INT64_C( 3423503611877322124),
+         INT64_C( 5292871759671149446), -INT64_C( 2262329400115616709), -INT64_C( 9199295977642280188), -INT64_C( 1583442548641358181) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   2), -INT64_C(  462092473038967685),
+         INT64_C(                   4),  INT64_C( 5292871759671149446),  INT64_C(                   6),  INT64_C(                   7),
+         INT64_C(                   8),  INT64_C(                   9),  INT64_C(                  10),  INT64_C(                  11),
+         INT64_C(                  12),  INT64_C(                  13),  INT64_C(                  14),  INT64_C(                  15) } },
+    { UINT8_C(191),
+      {  INT64_C(                  11),  INT64_C(                   9),  INT64_C(                  15),  INT64_C(                   1),
+         INT64_C(                   1),  INT64_C(                   9),  INT64_C(                   5),  INT64_C(                   8) },
+      { -INT64_C( 6372791877946554920), -INT64_C( 2726974423676710894), -INT64_C( 7455349985218465355),  INT64_C( 3235239660807518350),
+        -INT64_C( 4441697463298136793),  INT64_C( 1480451036341045115),  INT64_C( 3880102485970084240), -INT64_C( 8044074995530364964) },
+      {  INT64_C(                   0), -INT64_C( 4441697463298136793),  INT64_C(                   2),  INT64_C(                   3),
+         INT64_C(                   4),  INT64_C(                   5),  INT64_C(                   6),  INT64_C(                   7),
+        -INT64_C( 8044074995530364964),  INT64_C( 1480451036341045115),  INT64_C(                  10), -INT64_C( 6372791877946554920),
+         INT64_C(                  12),  INT64_C(                  13),  INT64_C(                  14), -INT64_C( 7455349985218465355) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int64_t r[16];
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(int64_t, j); }
+    simde_mm512_mask_i64scatter_epi64(r, test_vec[i].k, simde_mm512_loadu_epi64(test_vec[i].vindex), simde_mm512_loadu_epi64(test_vec[i].a), 8);
+    simde_assert_equal_vi64(16, r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    int64_t vindex[8];
+    int64_t a[8], r[16];
+    for (size_t j = 0 ; j < (sizeof(vindex) / sizeof(vindex[0])) ; j++) { vindex[j] = simde_test_codegen_random_i64() & 15; }
+    for (size_t j = 0 ; j < (sizeof(a) / sizeof(a[0])) ; j++) { a[j] = simde_test_codegen_random_i64(); }
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(int64_t, j); }
+    simde_mm512_mask_i64scatter_epi64(r, k, simde_mm512_loadu_epi64(vindex), simde_mm512_loadu_epi64(a), 8);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_vi64(2, 8, vindex, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi64(2, 8, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi64(2, 16, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_i64scatter_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int64_t vindex[8];
+    const int64_t a[8];
+    const int64_t r[16];
+  } test_vec[] = {
+    { {  INT64_C(                  10),  INT64_C(                   7),  INT64_C(                  12),  INT64_C(                   2),
+         INT64_C(                  13),  INT64_C(                   2),  INT64_C(                  15),  INT64_C(                  14) },
+      { -INT64_C( 8964684504123219440), -INT64_C( 2507341784125213284), -INT64_C(  712651862559014404),  INT64_C( 6980160853016400012),
+        -INT64_C( 3577625900488841243),  INT64_C( 3420919540963873197), -INT64_C( 3266114379764850482),  INT64_C( 3922609235305287358) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C( 3420919540963873197),  INT64_C(                   3),
+         INT64_C(                   4),  INT64_C(                   5),  INT64_C(                   6), -INT64_C( 2507341784125213284),
+         INT64_C(                   8),  INT64_C(                   9), -INT64_C( 8964684504123219440),  INT64_C(                  11),
+        -INT64_C(  712651862559014404), -INT64_C( 3577625900488841243),  INT64_C( 3922609235305287358), -INT64_C( 3266114379764850482) } },
+    { {  INT64_C(                  15),  INT64_C(                   7),  INT64_C(                  11),  INT64_C(                   3),
+         INT64_C(                   5),  INT64_C(                  14),  INT64_C(                   0),  INT64_C(                  12) },
+      {  INT64_C(   63315383465962383), -INT64_C( 1958878008685892058),  INT64_C( 3924761499780623321), -INT64_C( 7219062342635027213),
+         INT64_C( 3903204775379344936), -INT64_C( 6800598406732767770), -INT64_C( 5973947137240650729), -INT64_C( 3030169743075250358) },
+      { -INT64_C( 5973947137240650729),  INT64_C(                   1),  INT64_C(                   2), -INT64_C( 7219062342635027213),
+         INT64_C(                   4),  INT64_C( 3903204775379344936),  INT64_C(                   6), -INT64_C( 1958878008685892058),
+         INT64_C(                   8),  INT64_C(                   9),  INT64_C(                  10),  INT64_C( 3924761499780623321),
+        -INT64_C( 3030169743075250358),  INT64_C(                  13), -INT64_C( 6800598406732767770),  INT64_C(   63315383465962383) } },
+    { {  INT64_C(                  11),  INT64_C(                   6),  INT64_C(                  15),  INT64_C(                   8),
+         INT64_C(                   2),  INT64_C(                   3),  INT64_C(                   3),  INT64_C(                   5) },
+      { -INT64_C( 4747943018045316015),  INT64_C( 4157284208241881563),  INT64_C( 8312336622142258365), -INT64_C( 8798336899180102696),
+         INT64_C( 5162448353180025579), -INT64_C( 7056006053865570844), -INT64_C( 8640724673490954621),  INT64_C( 3471743443971489141) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C( 5162448353180025579), -INT64_C( 8640724673490954621),
+         INT64_C(                   4),  INT64_C( 3471743443971489141),  INT64_C( 4157284208241881563),  INT64_C(                   7),
+        -INT64_C( 8798336899180102696),  INT64_C(                   9),  INT64_C(                  10), -INT64_C( 4747943018045316015),
+         INT64_C(                  12),  INT64_C(                  13),  INT64_C(                  14),  INT64_C( 8312336622142258365) } },
+    { {  INT64_C(                  14),  INT64_C(                   8),  INT64_C(                   3),  INT64_C(                   8),
+         INT64_C(                   3),  INT64_C(                   2),  INT64_C(                  12),  INT64_C(                   7) },
+      {  INT64_C( 3687505133784676440), -INT64_C( 1258921974454457124), -INT64_C( 4682852632643370509),  INT64_C(  625355693499878327),
+        -INT64_C( 2701319756806465555), -INT64_C( 7820287857687644313),  INT64_C( 2583374502024594115), -INT64_C( 3476089644271784695) },
+      {  INT64_C(                   0),  INT64_C(                   1), -INT64_C( 7820287857687644313), -INT64_C( 2701319756806465555),
+         INT64_C(                   4),  INT64_C(                   5),  INT64_C(                   6), -INT64_C( 3476089644271784695),
+         INT64_C(  625355693499878327),  INT64_C(                   9),  INT64_C(                  10),  INT64_C(                  11),
+         INT64_C( 2583374502024594115),  INT64_C(                  13),  INT64_C( 3687505133784676440),  INT64_C(                  15) } },
+    { {  INT64_C(                   9),  INT64_C(                   7),  INT64_C(                   6),  INT64_C(                   2),
+         INT64_C(                   8),  INT64_C(                  11),  INT64_C(                   1),  INT64_C(                  13) },
+      { -INT64_C( 5330573473005077431), -INT64_C( 1994133034305042927),  INT64_C(  155824801342566896),  INT64_C( 3184637446284110783),
+        -INT64_C( 6054969189709866090), -INT64_C( 5536588867743622988), -INT64_C( 4963907988051041466), -INT64_C(  458987407607904109) },
+      {  INT64_C(                   0), -INT64_C( 4963907988051041466),  INT64_C( 3184637446284110783),  INT64_C(                   3),
+         INT64_C(                   4),  INT64_C(                   5),  INT64_C(  155824801342566896), -INT64_C( 1994133034305042927),
+        -INT64_C( 6054969189709866090), -INT64_C( 5330573473005077431),  INT64_C(                  10), -INT64_C( 5536588867743622988),
+         INT64_C(                  12), -INT64_C(  458987407607904109),  INT64_C(                  14),  INT64_C(                  15) } },
+    { {  INT64_C(                   4),  INT64_C(                  10),  INT64_C(                  15),  INT64_C(                   5),
+         INT64_C(                   9),  INT64_C(                  15),  INT64_C(                   4),  INT64_C(                   6) },
+      {  INT64_C( 1568791052934657022), -INT64_C( 6596247671578215836),  INT64_C( 5165788414494046258), -INT64_C( 6625060423318826350),
+        -INT64_C( 1910364613594052031),  INT64_C( 3428444372328419904),  INT64_C( 8482643025186869823), -INT64_C( 7150897780253700744) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   2),  INT64_C(                   3),
+         INT64_C( 8482643025186869823), -INT64_C( 6625060423318826350), -INT64_C( 7150897780253700744),  INT64_C(                   7),
+         INT64_C(                   8), -INT64_C( 1910364613594052031), -INT64_C( 6596247671578215836),  INT64_C(                  11),
+         INT64_C(                  12),  INT64_C(                  13),  INT64_C(                  14),  INT64_C( 3428444372328419904) } },
+    { {  INT64_C(                   3),  INT64_C(                   2),  INT64_C(                  14),  INT64_C(                   9),
+         INT64_C(                   5),  INT64_C(                   6),  INT64_C(                   8),  INT64_C(                  14) },
+      {  INT64_C( 1412230244797706814),  INT64_C( 6677988752346668924),  INT64_C( 7003892860243072109), -INT64_C( 8705781023909597719),
+         INT64_C( 2579439605969938637), -INT64_C( 2080288688064398751), -INT64_C( 8287800188641292504),  INT64_C( 3156578441499608062) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C( 6677988752346668924),  INT64_C( 1412230244797706814),
+         INT64_C(                   4),  INT64_C( 2579439605969938637), -INT64_C( 2080288688064398751),  INT64_C(                   7),
+        -INT64_C( 8287800188641292504), -INT64_C( 8705781023909597719),  INT64_C(                  10),  INT64_C(                  11),
+         INT64_C(                  12),  INT64_C(                  13),  INT64_C( 3156578441499608062),  INT64_C(                  15) } },
+    { {  INT64_C(                   3),  INT64_C(                  11),  INT64_C(                   1),  INT64_C(                  10),
+         INT64_C(                  14),  INT64_C(                   7),  INT64_C(                  10),  INT64_C(                   7) },
+      {  INT64_C( 8664740007787040546), -INT64_C( 5402321414866336821),  INT64_C( 8342744571986460966),  INT64_C( 4197826648241028840),
+        -INT64_C( 6460531468390792003), -INT64_C(   29151515475722345), -INT64_C(  855877388829414481), -INT64_C( 7142521131463265650) },
+      {  INT64_C(                   0),  INT64_C( 8342744571986460966),  INT64_C(                   2),  INT64_C( 8664740007787040546),
+         INT64_C(                   4),  INT64_C(                   5),  INT64_C(                   6), -INT64_C( 7142521131463265650),
+         INT64_C(                   8),  INT64_C(                   9), -INT64_C(  855877388829414481), -INT64_C( 5402321414866336821),
+         INT64_C(                  12),  INT64_C(                  13), -INT64_C( 6460531468390792003),  INT64_C(                  15) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int64_t r[16];
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(int64_t, j); }
+    simde_mm512_i64scatter_epi64(r, simde_mm512_loadu_epi64(test_vec[i].vindex), simde_mm512_loadu_epi64(test_vec[i].a), 8);
+    simde_assert_equal_vi64(16, r, test_vec[i].r);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int64_t vindex[8];
+    int64_t a[8], r[16];
+    for (size_t j = 0 ; j < (sizeof(vindex) / sizeof(vindex[0])) ; j++) { vindex[j] = simde_test_codegen_random_i64() & 15; }
+    for (size_t j = 0 ; j < (sizeof(a) / sizeof(a[0])) ; j++) { a[j] = simde_test_codegen_random_i64(); }
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(int64_t, j); }
+    simde_mm512_i64scatter_epi64(r, simde_mm512_loadu_epi64(vindex), simde_mm512_loadu_epi64(a), 8);
+
+    simde_test_codegen_write_vi64(2, 8, vindex, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_vi64(2, 8, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vi64(2, 16, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_mask_i64scatter_pd (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t vindex[8];
+    const simde_float64 a[8];
+    const simde_float64 r[16];
+  } test_vec[] = {
+    { UINT8_C( 47),
+      {  INT64_C(                   5),  INT64_C(                   8),  INT64_C(                   2),  INT64_C(                   0),
+         INT64_C(                   9),  INT64_C(                   8),  INT64_C(                  10),  INT64_C(                  10) },
+      { SIMDE_FLOAT64_C(   984.05), SIMDE_FLOAT64_C(   231.29), SIMDE_FLOAT64_C(   863.99), SIMDE_FLOAT64_C(   168.33),
+        SIMDE_FLOAT64_C(  -816.34), SIMDE_FLOAT64_C(  -812.79), SIMDE_FLOAT64_C(   419.49), SIMDE_FLOAT64_C(  -856.83) },
+      { SIMDE_FLOAT64_C(   168.33), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(   863.99), SIMDE_FLOAT64_C(     3.00),
+        SIMDE_FLOAT64_C(     4.00), SIMDE_FLOAT64_C(   984.05), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(     7.00),
+        SIMDE_FLOAT64_C(  -812.79), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(    10.00), SIMDE_FLOAT64_C(    11.00),
+        SIMDE_FLOAT64_C(    12.00), SIMDE_FLOAT64_C(    13.00), SIMDE_FLOAT64_C(    14.00), SIMDE_FLOAT64_C(    15.00) } },
+    { UINT8_C(211),
+      {  INT64_C(                   5),  INT64_C(                  10),  INT64_C(                   4),  INT64_C(                  11),
+         INT64_C(                   5),  INT64_C(                   3),  INT64_C(                   1),  INT64_C(                  12) },
+      { SIMDE_FLOAT64_C(   744.95), SIMDE_FLOAT64_C(    49.91), SIMDE_FLOAT64_C(  -191.87), SIMDE_FLOAT64_C(   507.84),
+        SIMDE_FLOAT64_C(   865.44), SIMDE_FLOAT64_C(   399.81), SIMDE_FLOAT64_C(   -39.51), SIMDE_FLOAT64_C(   675.61) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   -39.51), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(     3.00),
+        SIMDE_FLOAT64_C(     4.00), SIMDE_FLOAT64_C(   865.44), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(     7.00),
+        SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(    49.91), SIMDE_FLOAT64_C(    11.00),
+        SIMDE_FLOAT64_C(   675.61), SIMDE_FLOAT64_C(    13.00), SIMDE_FLOAT64_C(    14.00), SIMDE_FLOAT64_C(    15.00) } },
+    { UINT8_C( 46),
+      {  INT64_C(                  12),  INT64_C(                   4),  INT64_C(                  11),  INT64_C(                   1),
+         INT64_C(                   7),  INT64_C(                   5),  INT64_C(                   3),  INT64_C(                   7) },
+      { SIMDE_FLOAT64_C(  -896.57), SIMDE_FLOAT64_C(  -964.48), SIMDE_FLOAT64_C(   337.61), SIMDE_FLOAT64_C(  -304.64),
+        SIMDE_FLOAT64_C(  -554.15), SIMDE_FLOAT64_C(  -234.19), SIMDE_FLOAT64_C(  -916.78), SIMDE_FLOAT64_C(  -739.26) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -304.64), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(     3.00),
+        SIMDE_FLOAT64_C(  -964.48), SIMDE_FLOAT64_C(  -234.19), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(     7.00),
+        SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(    10.00), SIMDE_FLOAT64_C(   337.61),
+        SIMDE_FLOAT64_C(    12.00), SIMDE_FLOAT64_C(    13.00), SIMDE_FLOAT64_C(    14.00), SIMDE_FLOAT64_C(    15.00) } },
+    { UINT8_C(210),
+      {  INT64_C(                   0),  INT64_C(                   5),  INT64_C(                   6),  INT64_C(                  12),
+         INT64_C(                  15),  INT64_C(                  10),  INT64_C(                  10),  INT64_C(                   5) },
+      { SIMDE_FLOAT64_C(  -579.56), SIMDE_FLOAT64_C(  -664.07), SIMDE_FLOAT64_C(  -310.59), SIMDE_FLOAT64_C(  -509.66),
+        SIMDE_FLOAT64_C(   126.00), SIMDE_FLOAT64_C(  -445.10), SIMDE_FLOAT64_C(  -388.42), SIMDE_FLOAT64_C(  -141.39) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(     3.00),
+        SIMDE_FLOAT64_C(     4.00), SIMDE_FLOAT64_C(  -141.39), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(     7.00),
+        SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(  -388.42), SIMDE_FLOAT64_C(    11.00),
+        SIMDE_FLOAT64_C(    12.00), SIMDE_FLOAT64_C(    13.00), SIMDE_FLOAT64_C(    14.00), SIMDE_FLOAT64_C(   126.00) } },
+    { UINT8_C( 78),
+      {  INT64_C(                   0),  INT64_C(                   7),  INT64_C(                   6),  INT64_C(                   3),
+         INT64_C(                   3),  INT64_C(                   3),  INT64_C(                   8),  INT64_C(                  14) },
+      { SIMDE_FLOAT64_C(   100.80), SIMDE_FLOAT64_C(  -357.25), SIMDE_FLOAT64_C(   723.06), SIMDE_FLOAT64_C(  -843.78),
+        SIMDE_FLOAT64_C(  -812.75), SIMDE_FLOAT64_C(   369.49), SIMDE_FLOAT64_C(   471.82), SIMDE_FLOAT64_C(   419.68) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(  -843.78),
+        SIMDE_FLOAT64_C(     4.00), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(   723.06), SIMDE_FLOAT64_C(  -357.25),
+        SIMDE_FLOAT64_C(   471.82), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(    10.00), SIMDE_FLOAT64_C(    11.00),
+        SIMDE_FLOAT64_C(    12.00), SIMDE_FLOAT64_C(    13.00), SIMDE_FLOAT64_C(    14.00), SIMDE_FLOAT64_C(    15.00) } },
+    { UINT8_C( 99),
+      {  INT64_C(                  12),  INT64_C(                   6),  INT64_C(                   5),  INT64_C(                   1),
+         INT64_C(                   3),  INT64_C(                   8),  INT64_C(                  14),  INT64_C(                  11) },
+      { SIMDE_FLOAT64_C(   394.37), SIMDE_FLOAT64_C(   420.86), SIMDE_FLOAT64_C(   180.19), SIMDE_FLOAT64_C(   122.48),
+        SIMDE_FLOAT64_C(   667.06), SIMDE_FLOAT64_C(   103.61), SIMDE_FLOAT64_C(   962.55), SIMDE_FLOAT64_C(   -91.18) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(     3.00),
+        SIMDE_FLOAT64_C(     4.00), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(   420.86), SIMDE_FLOAT64_C(     7.00),
+        SIMDE_FLOAT64_C(   103.61), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(    10.00), SIMDE_FLOAT64_C(    11.00),
+        SIMDE_FLOAT64_C(   394.37), SIMDE_FLOAT64_C(    13.00), SIMDE_FLOAT64_C(   962.55), SIMDE_FLOAT64_C(    15.00) } },
+    { UINT8_C(181),
+      {  INT64_C(                   9),  INT64_C(                   3),  INT64_C(                   8),  INT64_C(                   7),
+         INT64_C(                   0),  INT64_C(                   3),  INT64_C(                   4),  INT64_C(                  13) },
+      { SIMDE_FLOAT64_C(   407.19), SIMDE_FLOAT64_C(  -104.33), SIMDE_FLOAT64_C(  -777.64), SIMDE_FLOAT64_C(  -646.53),
+        SIMDE_FLOAT64_C(   817.72), SIMDE_FLOAT64_C(   582.79), SIMDE_FLOAT64_C(   665.37), SIMDE_FLOAT64_C(   626.09) },
+      { SIMDE_FLOAT64_C(   817.72), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(   582.79),
+        SIMDE_FLOAT64_C(     4.00), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(     7.00),
+        SIMDE_FLOAT64_C(  -777.64), SIMDE_FLOAT64_C(   407.19), SIMDE_FLOAT64_C(    10.00), SIMDE_FLOAT64_C(    11.00),
+        SIMDE_FLOAT64_C(    12.00), SIMDE_FLOAT64_C(   626.09), SIMDE_FLOAT64_C(    14.00), SIMDE_FLOAT64_C(    15.00) } },
+    { UINT8_C( 46),
+      {  INT64_C(                   1),  INT64_C(                   1),  INT64_C(                  14),  INT64_C(                   4),
+         INT64_C(                  11),  INT64_C(                   7),  INT64_C(                   6),  INT64_C(                   1) },
+      { SIMDE_FLOAT64_C(  -271.07), SIMDE_FLOAT64_C(  -615.41), SIMDE_FLOAT64_C(   258.72), SIMDE_FLOAT64_C(   117.26),
+        SIMDE_FLOAT64_C(  -233.56), SIMDE_FLOAT64_C(   827.66), SIMDE_FLOAT64_C(  -132.69), SIMDE_FLOAT64_C(   869.36) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -615.41), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(     3.00),
+        SIMDE_FLOAT64_C(   117.26), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(   827.66),
+        SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(    10.00), SIMDE_FLOAT64_C(    11.00),
+        SIMDE_FLOAT64_C(    12.00), SIMDE_FLOAT64_C(    13.00), SIMDE_FLOAT64_C(   258.72), SIMDE_FLOAT64_C(    15.00) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64 r[16];
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(simde_float64, j); }
+    simde_mm512_mask_i64scatter_pd(r, test_vec[i].k, simde_mm512_loadu_epi64(test_vec[i].vindex), simde_mm512_loadu_pd(test_vec[i].a), 8);
+    simde_assert_equal_vf64(16, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    int64_t vindex[8];
+    simde_float64 a[8], r[16];
+    for (size_t j = 0 ; j < (sizeof(vindex) / sizeof(vindex[0])) ; j++) { vindex[j] = simde_test_codegen_random_i64() & 15; }
+    simde_test_codegen_random_vf64(8, a, HEDLEY_STATIC_CAST(simde_float64, -1000.0), HEDLEY_STATIC_CAST(simde_float64, 1000.0));
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(simde_float64, j); }
+    simde_mm512_mask_i64scatter_pd(r, k, simde_mm512_loadu_epi64(vindex), simde_mm512_loadu_pd(a), 8);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_vi64(2, 8, vindex, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vf64(2, 8, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vf64(2, 16, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_i64scatter_pd (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int64_t vindex[8];
+    const simde_float64 a[8];
+    const simde_float64 r[16];
+  } test_vec[] = {
+    { {  INT64_C(                   2),  INT64_C(                   4),  INT64_C(                   2),  INT64_C(                  10),
+         INT64_C(                   1),  INT64_C(                   2),  INT64_C(                   1),  INT64_C(                   5) },
+      { SIMDE_FLOAT64_C(   836.87), SIMDE_FLOAT64_C(   515.83), SIMDE_FLOAT64_C(  -361.16), SIMDE_FLOAT64_C(   312.37),
+        SIMDE_FLOAT64_C(  -543.00), SIMDE_FLOAT64_C(  -812.44), SIMDE_FLOAT64_C(  -944.06), SIMDE_FLOAT64_C(  -442.44) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -944.06), SIMDE_FLOAT64_C(  -812.44), SIMDE_FLOAT64_C(     3.00),
+        SIMDE_FLOAT64_C(   515.83), SIMDE_FLOAT64_C(  -442.44), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(     7.00),
+        SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(   312.37), SIMDE_FLOAT64_C(    11.00),
+        SIMDE_FLOAT64_C(    12.00), SIMDE_FLOAT64_C(    13.00), SIMDE_FLOAT64_C(    14.00), SIMDE_FLOAT64_C(    15.00) } },
+    { {  INT64_C(                  10),  INT64_C(                  12),  INT64_C(                   5),  INT64_C(                   4),
+         INT64_C(                   0),  INT64_C(                  15),  INT64_C(                  15),  INT64_C(                  11) },
+      { SIMDE_FLOAT64_C(   668.29), SIMDE_FLOAT64_C(   356.84), SIMDE_FLOAT64_C(  -688.37), SIMDE_FLOAT64_C(  -925.72),
+        SIMDE_FLOAT64_C(   448.73), SIMDE_FLOAT64_C(  -526.73), SIMDE_FLOAT64_C(  -980.76), SIMDE_FLOAT64_C(  -409.12) },
+      { SIMDE_FLOAT64_C(   448.73), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(     3.00),
+        SIMDE_FLOAT64_C(  -925.72), SIMDE_FLOAT64_C(  -688.37), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(     7.00),
+        SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(   668.29), SIMDE_FLOAT64_C(  -409.12),
+        SIMDE_FLOAT64_C(   356.84), SIMDE_FLOAT64_C(    13.00), SIMDE_FLOAT64_C(    14.00), SIMDE_FLOAT64_C(  -980.76) } },
+    { {  INT64_C(                   3),  INT64_C(                  10),  INT64_C(                  14),  INT64_C(                   8),
+         INT64_C(                   3),  INT64_C(                   9),  INT64_C(                   5),  INT64_C(                   5) },
+      { SIMDE_FLOAT64_C(  -910.43), SIMDE_FLOAT64_C(  -418.24), SIMDE_FLOAT64_C(   -57.71), SIMDE_FLOAT64_C(  -284.00),
+        SIMDE_FLOAT64_C(  -905.43), SIMDE_FLOAT64_C(   778.50), SIMDE_FLOAT64_C(  -172.10), SIMDE_FLOAT64_C(   869.66) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(  -905.43),
+        SIMDE_FLOAT64_C(     4.00), SIMDE_FLOAT64_C(   869.66), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(     7.00),
+        SIMDE_FLOAT64_C(  -284.00), SIMDE_FLOAT64_C(   778.50), SIMDE_FLOAT64_C(  -418.24), SIMDE_FLOAT64_C(    11.00),
+        SIMDE_FLOAT64_C(    12.00), SIMDE_FLOAT64_C(    13.00), SIMDE_FLOAT64_C(   -57.71), SIMDE_FLOAT64_C(    15.00) } },
+    { {  INT64_C(                   8),  INT64_C(                   9),  INT64_C(                  12),  INT64_C(                   2),
+         INT64_C(                  12),  INT64_C(                   9),  INT64_C(                  11),  INT64_C(                   0) },
+      { SIMDE_FLOAT64_C(   785.29), SIMDE_FLOAT64_C(   680.27), SIMDE_FLOAT64_C(   506.64), SIMDE_FLOAT64_C(  -121.54),
+        SIMDE_FLOAT64_C(  -942.97), SIMDE_FLOAT64_C(  -422.80), SIMDE_FLOAT64_C(   133.28), SIMDE_FLOAT64_C(   -58.04) },
+      { SIMDE_FLOAT64_C(   -58.04), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(  -121.54), SIMDE_FLOAT64_C(     3.00),
+        SIMDE_FLOAT64_C(     4.00), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(     7.00),
+        SIMDE_FLOAT64_C(   785.29), SIMDE_FLOAT64_C(  -422.80), SIMDE_FLOAT64_C(    10.00), SIMDE_FLOAT64_C(   133.28),
+        SIMDE_FLOAT64_C(  -942.97), SIMDE_FLOAT64_C(    13.00), SIMDE_FLOAT64_C(    14.00), SIMDE_FLOAT64_C(    15.00) } },
+    { {  INT64_C(                   8),  INT64_C(                   7),  INT64_C(                  12),  INT64_C(                   1),
+         INT64_C(                  11),  INT64_C(                  14),  INT64_C(                  12),  INT64_C(                  13) },
+      { SIMDE_FLOAT64_C(  -822.88), SIMDE_FLOAT64_C(   481.93), SIMDE_FLOAT64_C(  -582.02), SIMDE_FLOAT64_C(   349.44),
+        SIMDE_FLOAT64_C(  -565.72), SIMDE_FLOAT64_C(  -113.20), SIMDE_FLOAT64_C(   -94.15), SIMDE_FLOAT64_C(  -585.31) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   349.44), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(     3.00),
+        SIMDE_FLOAT64_C(     4.00), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(   481.93),
+        SIMDE_FLOAT64_C(  -822.88), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(    10.00), SIMDE_FLOAT64_C(  -565.72),
+        SIMDE_FLOAT64_C(   -94.15), SIMDE_FLOAT64_C(  -585.31), SIMDE_FLOAT64_C(  -113.20), SIMDE_FLOAT64_C(    15.00) } },
+    { {  INT64_C(                  10),  INT64_C(                   5),  INT64_C(                   5),  INT64_C(                   9),
+         INT64_C(                   5),  INT64_C(                  10),  INT64_C(                  15),  INT64_C(                   4) },
+      { SIMDE_FLOAT64_C(  -703.65), SIMDE_FLOAT64_C(  -124.54), SIMDE_FLOAT64_C(  -575.94), SIMDE_FLOAT64_C(   895.46),
+        SIMDE_FLOAT64_C(   -18.05), SIMDE_FLOAT64_C(     1.88), SIMDE_FLOAT64_C(   600.14), SIMDE_FLOAT64_C(  -990.65) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(     3.00),
+        SIMDE_FLOAT64_C(  -990.65), SIMDE_FLOAT64_C(   -18.05), SIMDE_FLOAT64_C(     6.00), SIMDE_FLOAT64_C(     7.00),
+        SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(   895.46), SIMDE_FLOAT64_C(     1.88), SIMDE_FLOAT64_C(    11.00),
+        SIMDE_FLOAT64_C(    12.00), SIMDE_FLOAT64_C(    13.00), SIMDE_FLOAT64_C(    14.00), SIMDE_FLOAT64_C(   600.14) } },
+    { {  INT64_C(                  10),  INT64_C(                   8),  INT64_C(                   0),  INT64_C(                  14),
+         INT64_C(                   0),  INT64_C(                   3),  INT64_C(                  11),  INT64_C(                   6) },
+      { SIMDE_FLOAT64_C(   853.21), SIMDE_FLOAT64_C(   906.17), SIMDE_FLOAT64_C(  -948.83), SIMDE_FLOAT64_C(   274.44),
+        SIMDE_FLOAT64_C(   799.29), SIMDE_FLOAT64_C(  -913.34), SIMDE_FLOAT64_C(  -875.28), SIMDE_FLOAT64_C(   808.23) },
+      { SIMDE_FLOAT64_C(   799.29), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(  -913.34),
+        SIMDE_FLOAT64_C(     4.00), SIMDE_FLOAT64_C(     5.00), SIMDE_FLOAT64_C(   808.23), SIMDE_FLOAT64_C(     7.00),
+        SIMDE_FLOAT64_C(   906.17), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(   853.21), SIMDE_FLOAT64_C(  -875.28),
+        SIMDE_FLOAT64_C(    12.00), SIMDE_FLOAT64_C(    13.00), SIMDE_FLOAT64_C(   274.44), SIMDE_FLOAT64_C(    15.00) } },
+    { {  INT64_C(                  14),  INT64_C(                   5),  INT64_C(                  13),  INT64_C(                   3),
+         INT64_C(                  11),  INT64_C(                   6),  INT64_C(                  12),  INT64_C(                  10) },
+      { SIMDE_FLOAT64_C(  -470.39), SIMDE_FLOAT64_C(   708.48), SIMDE_FLOAT64_C(  -377.62), SIMDE_FLOAT64_C(   191.66),
+        SIMDE_FLOAT64_C(   498.95), SIMDE_FLOAT64_C(  -855.44), SIMDE_FLOAT64_C(   433.85), SIMDE_FLOAT64_C(   590.12) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     2.00), SIMDE_FLOAT64_C(   191.66),
+        SIMDE_FLOAT64_C(     4.00), SIMDE_FLOAT64_C(   708.48), SIMDE_FLOAT64_C(  -855.44), SIMDE_FLOAT64_C(     7.00),
+        SIMDE_FLOAT64_C(     8.00), SIMDE_FLOAT64_C(     9.00), SIMDE_FLOAT64_C(   590.12), SIMDE_FLOAT64_C(   498.95),
+        SIMDE_FLOAT64_C(   433.85), SIMDE_FLOAT64_C(  -377.62), SIMDE_FLOAT64_C(  -470.39), SIMDE_FLOAT64_C(    15.00) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64 r[16];
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(simde_float64, j); }
+    simde_mm512_i64scatter_pd(r, simde_mm512_loadu_epi64(test_vec[i].vindex), simde_mm512_loadu_pd(test_vec[i].a), 8);
+    simde_assert_equal_vf64(16, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int64_t vindex[8];
+    simde_float64 a[8], r[16];
+    for (size_t j = 0 ; j < (sizeof(vindex) / sizeof(vindex[0])) ; j++) { vindex[j] = simde_test_codegen_random_i64() & 15; }
+    simde_test_codegen_random_vf64(8, a, HEDLEY_STATIC_CAST(simde_float64, -1000.0), HEDLEY_STATIC_CAST(simde_float64, 1000.0));
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(simde_float64, j); }
+    simde_mm512_i64scatter_pd(r, simde_mm512_loadu_epi64(vindex), simde_mm512_loadu_pd(a), 8);
+
+    simde_test_codegen_write_vi64(2, 8, vindex, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_vf64(2, 8, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vf64(2, 16, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_mask_i64scatter_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t vindex[8];
+    const simde_float32 a[8];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { UINT8_C( 69),
+      {  INT64_C(                  15),  INT64_C(                   6),  INT64_C(                   9),  INT64_C(                   0),
+         INT64_C(                  15),  INT64_C(                  13),  INT64_C(                   9),  INT64_C(                  14) },
+      { SIMDE_FLOAT32_C(   603.82), SIMDE_FLOAT32_C(  -433.20), SIMDE_FLOAT32_C(  -221.12), SIMDE_FLOAT32_C(   805.92),
+        SIMDE_FLOAT32_C(   197.37), SIMDE_FLOAT32_C(   -42.27), SIMDE_FLOAT32_C(  -259.16), SIMDE_FLOAT32_C(   435.15) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(  -259.16), SIMDE_FLOAT32_C(    10.00), SIMDE_FLOAT32_C(    11.00),
+        SIMDE_FLOAT32_C(    12.00), SIMDE_FLOAT32_C(    13.00), SIMDE_FLOAT32_C(    14.00), SIMDE_FLOAT32_C(   603.82) } },
+    { UINT8_C( 82),
+      {  INT64_C(                   7),  INT64_C(                  13),  INT64_C(                   5),  INT64_C(                   8),
+         INT64_C(                   5),  INT64_C(                  13),  INT64_C(                   5),  INT64_C(                   7) },
+      { SIMDE_FLOAT32_C(  -666.52), SIMDE_FLOAT32_C(    96.72), SIMDE_FLOAT32_C(   -93.46), SIMDE_FLOAT32_C(  -918.11),
+        SIMDE_FLOAT32_C(   487.01), SIMDE_FLOAT32_C(  -731.75), SIMDE_FLOAT32_C(  -579.99), SIMDE_FLOAT32_C(   813.76) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(  -579.99), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(    10.00), SIMDE_FLOAT32_C(    11.00),
+        SIMDE_FLOAT32_C(    12.00), SIMDE_FLOAT32_C(    96.72), SIMDE_FLOAT32_C(    14.00), SIMDE_FLOAT32_C(    15.00) } },
+    { UINT8_C(241),
+      {  INT64_C(                  11),  INT64_C(                   3),  INT64_C(                   0),  INT64_C(                  15),
+         INT64_C(                  12),  INT64_C(                  14),  INT64_C(                   7),  INT64_C(                   8) },
+      { SIMDE_FLOAT32_C(   717.62), SIMDE_FLOAT32_C(   247.88), SIMDE_FLOAT32_C(  -332.14), SIMDE_FLOAT32_C(   196.01),
+        SIMDE_FLOAT32_C(   829.59), SIMDE_FLOAT32_C(   878.29), SIMDE_FLOAT32_C(   789.24), SIMDE_FLOAT32_C(  -940.31) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(   789.24),
+        SIMDE_FLOAT32_C(  -940.31), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(    10.00), SIMDE_FLOAT32_C(   717.62),
+        SIMDE_FLOAT32_C(   829.59), SIMDE_FLOAT32_C(    13.00), SIMDE_FLOAT32_C(   878.29), SIMDE_FLOAT32_C(    15.00) } },
+    { UINT8_C( 89),
+      {  INT64_C(                   8),  INT64_C(                   1),  INT64_C(                   8),  INT64_C(                   9),
+         INT64_C(                   3),  INT64_C(                   2),  INT64_C(                  15),  INT64_C(                   2) },
+      { SIMDE_FLOAT32_C(   896.34), SIMDE_FLOAT32_C(   156.11), SIMDE_FLOAT32_C(   242.74), SIMDE_FLOAT32_C(   258.11),
+        SIMDE_FLOAT32_C(   701.48), SIMDE_FLOAT32_C(  -693.07), SIMDE_FLOAT32_C(  -750.04), SIMDE_FLOAT32_C(  -520.23) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(   701.48),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(   896.34), SIMDE_FLOAT32_C(   258.11), SIMDE_FLOAT32_C(    10.00), SIMDE_FLOAT32_C(    11.00),
+        SIMDE_FLOAT32_C(    12.00), SIMDE_FLOAT32_C(    13.00), SIMDE_FLOAT32_C(    14.00), SIMDE_FLOAT32_C(  -750.04) } },
+    { UINT8_C(120),
+      {  INT64_C(                   7),  INT64_C(                   7),  INT64_C(                  11),  INT64_C(                  15),
+         INT64_C(                   2),  INT64_C(                   6),  INT64_C(                  13),  INT64_C(                   8) },
+      { SIMDE_FLOAT32_C(    68.34), SIMDE_FLOAT32_C(  -174.55), SIMDE_FLOAT32_C(   740.57), SIMDE_FLOAT32_C(   653.59),
+        SIMDE_FLOAT32_C(   172.36), SIMDE_FLOAT32_C(    59.89), SIMDE_FLOAT32_C(  -904.87), SIMDE_FLOAT32_C(   659.25) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(   172.36), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(    59.89), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(    10.00), SIMDE_FLOAT32_C(    11.00),
+        SIMDE_FLOAT32_C(    12.00), SIMDE_FLOAT32_C(  -904.87), SIMDE_FLOAT32_C(    14.00), SIMDE_FLOAT32_C(   653.59) } },
+    { UINT8_C( 95),
+      {  INT64_C(                   6),  INT64_C(                  12),  INT64_C(                   7),  INT64_C(                   8),
+         INT64_C(                   4),  INT64_C(                  10),  INT64_C(                   2),  INT64_C(                   8) },
+      { SIMDE_FLOAT32_C(  -180.82), SIMDE_FLOAT32_C(   968.93), SIMDE_FLOAT32_C(  -580.22), SIMDE_FLOAT32_C(  -797.30),
+        SIMDE_FLOAT32_C(  -512.34), SIMDE_FLOAT32_C(   432.58), SIMDE_FLOAT32_C(  -143.20), SIMDE_FLOAT32_C(   595.78) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(  -143.20), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(  -512.34), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(  -180.82), SIMDE_FLOAT32_C(  -580.22),
+        SIMDE_FLOAT32_C(  -797.30), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(    10.00), SIMDE_FLOAT32_C(    11.00),
+        SIMDE_FLOAT32_C(   968.93), SIMDE_FLOAT32_C(    13.00), SIMDE_FLOAT32_C(    14.00), SIMDE_FLOAT32_C(    15.00) } },
+    { UINT8_C(207),
+      {  INT64_C(                   4),  INT64_C(                   0),  INT64_C(                  15),  INT64_C(                  14),
+         INT64_C(                  10),  INT64_C(                  10),  INT64_C(                  14),  INT64_C(                   4) },
+      { SIMDE_FLOAT32_C(   310.99), SIMDE_FLOAT32_C(  -340.28), SIMDE_FLOAT32_C(   402.32), SIMDE_FLOAT32_C(  -816.36),
+        SIMDE_FLOAT32_C(   -20.48), SIMDE_FLOAT32_C(  -960.47), SIMDE_FLOAT32_C(  -870.55), SIMDE_FLOAT32_C(  -104.55) },
+      { SIMDE_FLOAT32_C(  -340.28), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(  -104.55), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(    10.00), SIMDE_FLOAT32_C(    11.00),
+        SIMDE_FLOAT32_C(    12.00), SIMDE_FLOAT32_C(    13.00), SIMDE_FLOAT32_C(  -870.55), SIMDE_FLOAT32_C(   402.32) } },
+    { UINT8_C(153),
+      {  INT64_C(                   7),  INT64_C(                  10),  INT64_C(                   5),  INT64_C(                   3),
+         INT64_C(                  15),  INT64_C(                  11),  INT64_C(                   2),  INT64_C(                   6) },
+      { SIMDE_FLOAT32_C(    -7.69), SIMDE_FLOAT32_C(  -887.19), SIMDE_FLOAT32_C(  -733.11), SIMDE_FLOAT32_C(  -858.94),
+        SIMDE_FLOAT32_C(   365.31), SIMDE_FLOAT32_C(   628.60), SIMDE_FLOAT32_C(   296.87), SIMDE_FLOAT32_C(  -254.32) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(  -858.94),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(  -254.32), SIMDE_FLOAT32_C(    -7.69),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(    10.00), SIMDE_FLOAT32_C(    11.00),
+        SIMDE_FLOAT32_C(    12.00), SIMDE_FLOAT32_C(    13.00), SIMDE_FLOAT32_C(    14.00), SIMDE_FLOAT32_C(   365.31) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32 r[16];
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(simde_float32, j); }
+    simde_mm512_mask_i64scatter_ps(r, test_vec[i].k, simde_mm512_loadu_epi64(test_vec[i].vindex), simde_mm256_loadu_ps(test_vec[i].a), 4);
+    simde_assert_equal_vf32(16, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__mmask8 k = simde_test_x86_random_mmask8();
+    int64_t vindex[8];
+    simde_float32 a[8], r[16];
+    for (size_t j = 0 ; j < (sizeof(vindex) / sizeof(vindex[0])) ; j++) { vindex[j] = simde_test_codegen_random_i64() & 15; }
+    simde_test_codegen_random_vf32(8, a, HEDLEY_STATIC_CAST(simde_float32, -1000.0), HEDLEY_STATIC_CAST(simde_float32, 1000.0));
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(simde_float32, j); }
+    simde_mm512_mask_i64scatter_ps(r, k, simde_mm512_loadu_epi64(vindex), simde_mm256_loadu_ps(a), 4);
+
+    simde_test_x86_write_mmask8(2, k, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_vi64(2, 8, vindex, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vf32(2, 8, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vf32(2, 16, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm512_i64scatter_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const int64_t vindex[8];
+    const simde_float32 a[8];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { {  INT64_C(                   2),  INT64_C(                   2),  INT64_C(                  14),  INT64_C(                  12),
+         INT64_C(                  15),  INT64_C(                  15),  INT64_C(                   4),  INT64_C(                  14) },
+      { SIMDE_FLOAT32_C(   208.15), SIMDE_FLOAT32_C(  -891.53), SIMDE_FLOAT32_C(     0.64), SIMDE_FLOAT32_C(   331.81),
+        SIMDE_FLOAT32_C(    21.02), SIMDE_FLOAT32_C(    89.37), SIMDE_FLOAT32_C(  -652.71), SIMDE_FLOAT32_C(   -71.13) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(  -891.53), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(  -652.71), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(    10.00), SIMDE_FLOAT32_C(    11.00),
+        SIMDE_FLOAT32_C(   331.81), SIMDE_FLOAT32_C(    13.00), SIMDE_FLOAT32_C(   -71.13), SIMDE_FLOAT32_C(    89.37) } },
+    { {  INT64_C(                  10),  INT64_C(                   3),  INT64_C(                   3),  INT64_C(                   0),
+         INT64_C(                   1),  INT64_C(                  11),  INT64_C(                   1),  INT64_C(                  11) },
+      { SIMDE_FLOAT32_C(   746.11), SIMDE_FLOAT32_C(   424.56), SIMDE_FLOAT32_C(   353.06), SIMDE_FLOAT32_C(  -894.04),
+        SIMDE_FLOAT32_C(   595.90), SIMDE_FLOAT32_C(  -788.82), SIMDE_FLOAT32_C(  -137.01), SIMDE_FLOAT32_C(    96.80) },
+      { SIMDE_FLOAT32_C(  -894.04), SIMDE_FLOAT32_C(  -137.01), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(   353.06),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(   746.11), SIMDE_FLOAT32_C(    96.80),
+        SIMDE_FLOAT32_C(    12.00), SIMDE_FLOAT32_C(    13.00), SIMDE_FLOAT32_C(    14.00), SIMDE_FLOAT32_C(    15.00) } },
+    { {  INT64_C(                   9),  INT64_C(                   9),  INT64_C(                   3),  INT64_C(                   0),
+         INT64_C(                   9),  INT64_C(                   1),  INT64_C(                   5),  INT64_C(                   2) },
+      { SIMDE_FLOAT32_C(  -642.57), SIMDE_FLOAT32_C(   930.74), SIMDE_FLOAT32_C(   400.51), SIMDE_FLOAT32_C(   961.20),
+        SIMDE_FLOAT32_C(   281.09), SIMDE_FLOAT32_C(   683.55), SIMDE_FLOAT32_C(  -638.53), SIMDE_FLOAT32_C(   481.30) },
+      { SIMDE_FLOAT32_C(   961.20), SIMDE_FLOAT32_C(   683.55), SIMDE_FLOAT32_C(   481.30), SIMDE_FLOAT32_C(   400.51),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(  -638.53), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(     8.00), SIMDE_FLOAT32_C(   281.09), SIMDE_FLOAT32_C(    10.00), SIMDE_FLOAT32_C(    11.00),
+        SIMDE_FLOAT32_C(    12.00), SIMDE_FLOAT32_C(    13.00), SIMDE_FLOAT32_C(    14.00), SIMDE_FLOAT32_C(    15.00) } },
+    { {  INT64_C(                   2),  INT64_C(                   9),  INT64_C(                   4),  INT64_C(                   7),
+         INT64_C(                   1),  INT64_C(                  15),  INT64_C(                   8),  INT64_C(                   9) },
+      { SIMDE_FLOAT32_C(  -793.70), SIMDE_FLOAT32_C(  -287.78), SIMDE_FLOAT32_C(   108.46), SIMDE_FLOAT32_C(   144.34),
+        SIMDE_FLOAT32_C(   -37.27), SIMDE_FLOAT32_C(   458.59), SIMDE_FLOAT32_C(  -139.16), SIMDE_FLOAT32_C(   218.51) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   -37.27), SIMDE_FLOAT32_C(  -793.70), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(   108.46), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(   144.34),
+        SIMDE_FLOAT32_C(  -139.16), SIMDE_FLOAT32_C(   218.51), SIMDE_FLOAT32_C(    10.00), SIMDE_FLOAT32_C(    11.00),
+        SIMDE_FLOAT32_C(    12.00), SIMDE_FLOAT32_C(    13.00), SIMDE_FLOAT32_C(    14.00), SIMDE_FLOAT32_C(   458.59) } },
+    { {  INT64_C(                   8),  INT64_C(                   0),  INT64_C(                   3),  INT64_C(                   7),
+         INT64_C(                  13),  INT64_C(                  12),  INT64_C(                   3),  INT64_C(                   9) },
+      { SIMDE_FLOAT32_C(  -390.58), SIMDE_FLOAT32_C(  -689.57), SIMDE_FLOAT32_C(   106.59), SIMDE_FLOAT32_C(  -229.66),
+        SIMDE_FLOAT32_C(   853.48), SIMDE_FLOAT32_C(  -261.32), SIMDE_FLOAT32_C(   122.60), SIMDE_FLOAT32_C(  -765.39) },
+      { SIMDE_FLOAT32_C(  -689.57), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(   122.60),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(  -229.66),
+        SIMDE_FLOAT32_C(  -390.58), SIMDE_FLOAT32_C(  -765.39), SIMDE_FLOAT32_C(    10.00), SIMDE_FLOAT32_C(    11.00),
+        SIMDE_FLOAT32_C(  -261.32), SIMDE_FLOAT32_C(   853.48), SIMDE_FLOAT32_C(    14.00), SIMDE_FLOAT32_C(    15.00) } },
+    { {  INT64_C(                   6),  INT64_C(                  12),  INT64_C(                  13),  INT64_C(                   8),
+         INT64_C(                   4),  INT64_C(                  13),  INT64_C(                   1),  INT64_C(                   9) },
+      { SIMDE_FLOAT32_C(  -325.12), SIMDE_FLOAT32_C(   699.03), SIMDE_FLOAT32_C(   789.68), SIMDE_FLOAT32_C(   392.66),
+        SIMDE_FLOAT32_C(   474.74), SIMDE_FLOAT32_C(  -957.73), SIMDE_FLOAT32_C(  -824.56), SIMDE_FLOAT32_C(  -608.87) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -824.56), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(   474.74), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(  -325.12), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(   392.66), SIMDE_FLOAT32_C(  -608.87), SIMDE_FLOAT32_C(    10.00), SIMDE_FLOAT32_C(    11.00),
+        SIMDE_FLOAT32_C(   699.03), SIMDE_FLOAT32_C(  -957.73), SIMDE_FLOAT32_C(    14.00), SIMDE_FLOAT32_C(    15.00) } },
+    { {  INT64_C(                   9),  INT64_C(                  11),  INT64_C(                   3),  INT64_C(                  14),
+         INT64_C(                   8),  INT64_C(                   8),  INT64_C(                   0),  INT64_C(                   7) },
+      { SIMDE_FLOAT32_C(  -264.45), SIMDE_FLOAT32_C(     7.97), SIMDE_FLOAT32_C(  -121.52), SIMDE_FLOAT32_C(   428.83),
+        SIMDE_FLOAT32_C(   102.23), SIMDE_FLOAT32_C(   469.51), SIMDE_FLOAT32_C(  -403.05), SIMDE_FLOAT32_C(   422.97) },
+      { SIMDE_FLOAT32_C(  -403.05), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(  -121.52),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(     6.00), SIMDE_FLOAT32_C(   422.97),
+        SIMDE_FLOAT32_C(   469.51), SIMDE_FLOAT32_C(  -264.45), SIMDE_FLOAT32_C(    10.00), SIMDE_FLOAT32_C(     7.97),
+        SIMDE_FLOAT32_C(    12.00), SIMDE_FLOAT32_C(    13.00), SIMDE_FLOAT32_C(   428.83), SIMDE_FLOAT32_C(    15.00) } },
+    { {  INT64_C(                  15),  INT64_C(                  15),  INT64_C(                   6),  INT64_C(                  10),
+         INT64_C(                   9),  INT64_C(                  12),  INT64_C(                  10),  INT64_C(                   8) },
+      { SIMDE_FLOAT32_C(   342.30), SIMDE_FLOAT32_C(  -614.67), SIMDE_FLOAT32_C(   183.95), SIMDE_FLOAT32_C(    28.96),
+        SIMDE_FLOAT32_C(   409.76), SIMDE_FLOAT32_C(   334.61), SIMDE_FLOAT32_C(    68.23), SIMDE_FLOAT32_C(   475.69) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     2.00), SIMDE_FLOAT32_C(     3.00),
+        SIMDE_FLOAT32_C(     4.00), SIMDE_FLOAT32_C(     5.00), SIMDE_FLOAT32_C(   183.95), SIMDE_FLOAT32_C(     7.00),
+        SIMDE_FLOAT32_C(   475.69), SIMDE_FLOAT32_C(   409.76), SIMDE_FLOAT32_C(    68.23), SIMDE_FLOAT32_C(    11.00),
+        SIMDE_FLOAT32_C(   334.61), SIMDE_FLOAT32_C(    13.00), SIMDE_FLOAT32_C(    14.00), SIMDE_FLOAT32_C(  -614.67) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32 r[16];
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(simde_float32, j); }
+    simde_mm512_i64scatter_ps(r, simde_mm512_loadu_epi64(test_vec[i].vindex), simde_mm256_loadu_ps(test_vec[i].a), 4);
+    simde_assert_equal_vf32(16, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    int64_t vindex[8];
+    simde_float32 a[8], r[16];
+    for (size_t j = 0 ; j < (sizeof(vindex) / sizeof(vindex[0])) ; j++) { vindex[j] = simde_test_codegen_random_i64() & 15; }
+    simde_test_codegen_random_vf32(8, a, HEDLEY_STATIC_CAST(simde_float32, -1000.0), HEDLEY_STATIC_CAST(simde_float32, 1000.0));
+    for (size_t j = 0 ; j < (sizeof(r) / sizeof(r[0])) ; j++) { r[j] = HEDLEY_STATIC_CAST(simde_float32, j); }
+    simde_mm512_i64scatter_ps(r, simde_mm512_loadu_epi64(vindex), simde_mm256_loadu_ps(a), 4);
+
+    simde_test_codegen_write_vi64(2, 8, vindex, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_codegen_write_vf32(2, 8, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_codegen_write_vf32(2, 16, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_i32scatter_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_i32scatter_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_i32scatter_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_i32scatter_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_i64scatter_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_i64scatter_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_i64scatter_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_i64scatter_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_i32scatter_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_i32scatter_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_i32scatter_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_i32scatter_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_i64scatter_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_i64scatter_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_i64scatter_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_i64scatter_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i32scatter_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i32scatter_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i32scatter_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i32scatter_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i32scatter_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i32scatter_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i32scatter_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i32scatter_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i64scatter_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i64scatter_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i64scatter_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i64scatter_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i64scatter_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i64scatter_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i64scatter_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i64scatter_ps)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -388,11 +388,298 @@ test_simde_mm512_mask_sqrt_pd (SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm_sqrt_ph (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float16 a[8];
+    const simde_float16 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(    423.8), SIMDE_FLOAT16_VALUE(    576.0), SIMDE_FLOAT16_VALUE(    385.8), SIMDE_FLOAT16_VALUE(    444.0),
+        SIMDE_FLOAT16_VALUE(    642.5), SIMDE_FLOAT16_VALUE(    968.0), SIMDE_FLOAT16_VALUE(    852.0), SIMDE_FLOAT16_VALUE(    283.5) },
+      { SIMDE_FLOAT16_VALUE(    20.58), SIMDE_FLOAT16_VALUE(     24.0), SIMDE_FLOAT16_VALUE(    19.64), SIMDE_FLOAT16_VALUE(    21.08),
+        SIMDE_FLOAT16_VALUE(    25.34), SIMDE_FLOAT16_VALUE(    31.11), SIMDE_FLOAT16_VALUE(    29.19), SIMDE_FLOAT16_VALUE(    16.84) } },
+    { { SIMDE_FLOAT16_VALUE(    910.0), SIMDE_FLOAT16_VALUE(    795.5), SIMDE_FLOAT16_VALUE(    392.2), SIMDE_FLOAT16_VALUE(    705.5),
+        SIMDE_FLOAT16_VALUE(    467.8), SIMDE_FLOAT16_VALUE(    926.0), SIMDE_FLOAT16_VALUE(    632.5), SIMDE_FLOAT16_VALUE(    321.5) },
+      { SIMDE_FLOAT16_VALUE(    30.17), SIMDE_FLOAT16_VALUE(     28.2), SIMDE_FLOAT16_VALUE(    19.81), SIMDE_FLOAT16_VALUE(    26.56),
+        SIMDE_FLOAT16_VALUE(    21.62), SIMDE_FLOAT16_VALUE(    30.44), SIMDE_FLOAT16_VALUE(    25.16), SIMDE_FLOAT16_VALUE(    17.94) } },
+    { { SIMDE_FLOAT16_VALUE(    985.0), SIMDE_FLOAT16_VALUE(    215.4), SIMDE_FLOAT16_VALUE(    590.5), SIMDE_FLOAT16_VALUE(    588.5),
+        SIMDE_FLOAT16_VALUE(    584.0), SIMDE_FLOAT16_VALUE(    841.0), SIMDE_FLOAT16_VALUE(    230.6), SIMDE_FLOAT16_VALUE(    445.8) },
+      { SIMDE_FLOAT16_VALUE(    31.39), SIMDE_FLOAT16_VALUE(    14.67), SIMDE_FLOAT16_VALUE(     24.3), SIMDE_FLOAT16_VALUE(    24.27),
+        SIMDE_FLOAT16_VALUE(    24.17), SIMDE_FLOAT16_VALUE(     29.0), SIMDE_FLOAT16_VALUE(    15.19), SIMDE_FLOAT16_VALUE(    21.11) } },
+    { { SIMDE_FLOAT16_VALUE(    771.0), SIMDE_FLOAT16_VALUE(    228.9), SIMDE_FLOAT16_VALUE(    337.5), SIMDE_FLOAT16_VALUE(    769.5),
+        SIMDE_FLOAT16_VALUE(    144.6), SIMDE_FLOAT16_VALUE(    934.0), SIMDE_FLOAT16_VALUE(    785.5), SIMDE_FLOAT16_VALUE(    184.4) },
+      { SIMDE_FLOAT16_VALUE(    27.77), SIMDE_FLOAT16_VALUE(   15.125), SIMDE_FLOAT16_VALUE(    18.38), SIMDE_FLOAT16_VALUE(    27.73),
+        SIMDE_FLOAT16_VALUE(    12.02), SIMDE_FLOAT16_VALUE(    30.56), SIMDE_FLOAT16_VALUE(    28.03), SIMDE_FLOAT16_VALUE(    13.58) } },
+    { { SIMDE_FLOAT16_VALUE(    773.5), SIMDE_FLOAT16_VALUE(    399.0), SIMDE_FLOAT16_VALUE(    501.5), SIMDE_FLOAT16_VALUE(    475.8),
+        SIMDE_FLOAT16_VALUE(    987.5), SIMDE_FLOAT16_VALUE(    449.5), SIMDE_FLOAT16_VALUE(    417.2), SIMDE_FLOAT16_VALUE(    521.5) },
+      { SIMDE_FLOAT16_VALUE(    27.81), SIMDE_FLOAT16_VALUE(    19.97), SIMDE_FLOAT16_VALUE(    22.39), SIMDE_FLOAT16_VALUE(    21.81),
+        SIMDE_FLOAT16_VALUE(    31.42), SIMDE_FLOAT16_VALUE(     21.2), SIMDE_FLOAT16_VALUE(    20.42), SIMDE_FLOAT16_VALUE(    22.84) } },
+    { { SIMDE_FLOAT16_VALUE(    383.0), SIMDE_FLOAT16_VALUE(    825.5), SIMDE_FLOAT16_VALUE(    448.5), SIMDE_FLOAT16_VALUE(    468.8),
+        SIMDE_FLOAT16_VALUE(    813.5), SIMDE_FLOAT16_VALUE(    760.5), SIMDE_FLOAT16_VALUE(    622.0), SIMDE_FLOAT16_VALUE(    39.47) },
+      { SIMDE_FLOAT16_VALUE(    19.58), SIMDE_FLOAT16_VALUE(    28.73), SIMDE_FLOAT16_VALUE(    21.17), SIMDE_FLOAT16_VALUE(    21.66),
+        SIMDE_FLOAT16_VALUE(    28.52), SIMDE_FLOAT16_VALUE(    27.58), SIMDE_FLOAT16_VALUE(    24.94), SIMDE_FLOAT16_VALUE(     6.28) } },
+    { { SIMDE_FLOAT16_VALUE(    694.0), SIMDE_FLOAT16_VALUE(    116.4), SIMDE_FLOAT16_VALUE(    279.8), SIMDE_FLOAT16_VALUE(    897.5),
+        SIMDE_FLOAT16_VALUE(    794.0), SIMDE_FLOAT16_VALUE(    500.0), SIMDE_FLOAT16_VALUE(    811.0), SIMDE_FLOAT16_VALUE(    152.4) },
+      { SIMDE_FLOAT16_VALUE(    26.34), SIMDE_FLOAT16_VALUE(    10.79), SIMDE_FLOAT16_VALUE(    16.72), SIMDE_FLOAT16_VALUE(    29.95),
+        SIMDE_FLOAT16_VALUE(    28.17), SIMDE_FLOAT16_VALUE(    22.36), SIMDE_FLOAT16_VALUE(    28.48), SIMDE_FLOAT16_VALUE(    12.34) } },
+    { { SIMDE_FLOAT16_VALUE(    365.2), SIMDE_FLOAT16_VALUE(   105.44), SIMDE_FLOAT16_VALUE(    657.0), SIMDE_FLOAT16_VALUE(    876.0),
+        SIMDE_FLOAT16_VALUE(    934.0), SIMDE_FLOAT16_VALUE(     86.4), SIMDE_FLOAT16_VALUE(    771.5), SIMDE_FLOAT16_VALUE(     8.95) },
+      { SIMDE_FLOAT16_VALUE(    19.11), SIMDE_FLOAT16_VALUE(   10.266), SIMDE_FLOAT16_VALUE(    25.62), SIMDE_FLOAT16_VALUE(     29.6),
+        SIMDE_FLOAT16_VALUE(    30.56), SIMDE_FLOAT16_VALUE(      9.3), SIMDE_FLOAT16_VALUE(    27.78), SIMDE_FLOAT16_VALUE(    2.992) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128h a = simde_mm_loadu_ph(test_vec[i].a);
+    simde__m128h r = simde_mm_sqrt_ph(a);
+    simde_test_x86_assert_equal_f16x8(r, simde_mm_loadu_ph(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm256_sqrt_ph (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float16 a[16];
+    const simde_float16 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(    522.0), SIMDE_FLOAT16_VALUE(    868.0), SIMDE_FLOAT16_VALUE(    123.4), SIMDE_FLOAT16_VALUE(    978.0),
+        SIMDE_FLOAT16_VALUE(    901.5), SIMDE_FLOAT16_VALUE(    286.0), SIMDE_FLOAT16_VALUE(    369.2), SIMDE_FLOAT16_VALUE(    333.8),
+        SIMDE_FLOAT16_VALUE(    660.5), SIMDE_FLOAT16_VALUE(    776.5), SIMDE_FLOAT16_VALUE(    987.5), SIMDE_FLOAT16_VALUE(    957.0),
+        SIMDE_FLOAT16_VALUE(    358.8), SIMDE_FLOAT16_VALUE(    262.8), SIMDE_FLOAT16_VALUE(    834.0), SIMDE_FLOAT16_VALUE(    468.2) },
+      { SIMDE_FLOAT16_VALUE(    22.84), SIMDE_FLOAT16_VALUE(    29.47), SIMDE_FLOAT16_VALUE(    11.11), SIMDE_FLOAT16_VALUE(    31.27),
+        SIMDE_FLOAT16_VALUE(    30.03), SIMDE_FLOAT16_VALUE(     16.9), SIMDE_FLOAT16_VALUE(    19.22), SIMDE_FLOAT16_VALUE(    18.27),
+        SIMDE_FLOAT16_VALUE(     25.7), SIMDE_FLOAT16_VALUE(    27.86), SIMDE_FLOAT16_VALUE(    31.42), SIMDE_FLOAT16_VALUE(    30.94),
+        SIMDE_FLOAT16_VALUE(    18.94), SIMDE_FLOAT16_VALUE(     16.2), SIMDE_FLOAT16_VALUE(    28.88), SIMDE_FLOAT16_VALUE(    21.64) } },
+    { { SIMDE_FLOAT16_VALUE(    394.2), SIMDE_FLOAT16_VALUE(    66.25), SIMDE_FLOAT16_VALUE(    147.5), SIMDE_FLOAT16_VALUE(    147.5),
+        SIMDE_FLOAT16_VALUE(     46.8), SIMDE_FLOAT16_VALUE(    976.0), SIMDE_FLOAT16_VALUE(    731.0), SIMDE_FLOAT16_VALUE(    630.0),
+        SIMDE_FLOAT16_VALUE(    592.5), SIMDE_FLOAT16_VALUE(    824.5), SIMDE_FLOAT16_VALUE(    294.0), SIMDE_FLOAT16_VALUE(    544.5),
+        SIMDE_FLOAT16_VALUE(    940.5), SIMDE_FLOAT16_VALUE(    815.0), SIMDE_FLOAT16_VALUE(     33.0), SIMDE_FLOAT16_VALUE(    820.5) },
+      { SIMDE_FLOAT16_VALUE(    19.86), SIMDE_FLOAT16_VALUE(     8.14), SIMDE_FLOAT16_VALUE(    12.15), SIMDE_FLOAT16_VALUE(    12.15),
+        SIMDE_FLOAT16_VALUE(    6.844), SIMDE_FLOAT16_VALUE(    31.23), SIMDE_FLOAT16_VALUE(    27.03), SIMDE_FLOAT16_VALUE(     25.1),
+        SIMDE_FLOAT16_VALUE(    24.34), SIMDE_FLOAT16_VALUE(    28.72), SIMDE_FLOAT16_VALUE(    17.14), SIMDE_FLOAT16_VALUE(    23.33),
+        SIMDE_FLOAT16_VALUE(    30.67), SIMDE_FLOAT16_VALUE(    28.55), SIMDE_FLOAT16_VALUE(    5.746), SIMDE_FLOAT16_VALUE(    28.64) } },
+    { { SIMDE_FLOAT16_VALUE(    742.5), SIMDE_FLOAT16_VALUE(    939.0), SIMDE_FLOAT16_VALUE(    734.0), SIMDE_FLOAT16_VALUE(    664.0),
+        SIMDE_FLOAT16_VALUE(    142.2), SIMDE_FLOAT16_VALUE(    875.0), SIMDE_FLOAT16_VALUE(    405.0), SIMDE_FLOAT16_VALUE(    378.5),
+        SIMDE_FLOAT16_VALUE(    453.5), SIMDE_FLOAT16_VALUE(    472.0), SIMDE_FLOAT16_VALUE(    444.0), SIMDE_FLOAT16_VALUE(    362.8),
+        SIMDE_FLOAT16_VALUE(    780.5), SIMDE_FLOAT16_VALUE(    613.0), SIMDE_FLOAT16_VALUE(    775.5), SIMDE_FLOAT16_VALUE(    460.5) },
+      { SIMDE_FLOAT16_VALUE(    27.25), SIMDE_FLOAT16_VALUE(    30.64), SIMDE_FLOAT16_VALUE(     27.1), SIMDE_FLOAT16_VALUE(    25.77),
+        SIMDE_FLOAT16_VALUE(    11.93), SIMDE_FLOAT16_VALUE(    29.58), SIMDE_FLOAT16_VALUE(    20.12), SIMDE_FLOAT16_VALUE(    19.45),
+        SIMDE_FLOAT16_VALUE(     21.3), SIMDE_FLOAT16_VALUE(    21.72), SIMDE_FLOAT16_VALUE(    21.08), SIMDE_FLOAT16_VALUE(    19.05),
+        SIMDE_FLOAT16_VALUE(    27.94), SIMDE_FLOAT16_VALUE(    24.77), SIMDE_FLOAT16_VALUE(    27.84), SIMDE_FLOAT16_VALUE(    21.45) } },
+    { { SIMDE_FLOAT16_VALUE(    320.2), SIMDE_FLOAT16_VALUE(    429.5), SIMDE_FLOAT16_VALUE(    937.5), SIMDE_FLOAT16_VALUE(    3.922),
+        SIMDE_FLOAT16_VALUE(    953.0), SIMDE_FLOAT16_VALUE(    85.94), SIMDE_FLOAT16_VALUE(    136.9), SIMDE_FLOAT16_VALUE(    888.0),
+        SIMDE_FLOAT16_VALUE(    572.5), SIMDE_FLOAT16_VALUE(    830.0), SIMDE_FLOAT16_VALUE(    150.8), SIMDE_FLOAT16_VALUE(    483.0),
+        SIMDE_FLOAT16_VALUE(    776.0), SIMDE_FLOAT16_VALUE(    930.0), SIMDE_FLOAT16_VALUE(    514.0), SIMDE_FLOAT16_VALUE(    401.8) },
+      { SIMDE_FLOAT16_VALUE(    17.89), SIMDE_FLOAT16_VALUE(    20.72), SIMDE_FLOAT16_VALUE(    30.62), SIMDE_FLOAT16_VALUE(     1.98),
+        SIMDE_FLOAT16_VALUE(    30.88), SIMDE_FLOAT16_VALUE(     9.27), SIMDE_FLOAT16_VALUE(     11.7), SIMDE_FLOAT16_VALUE(     29.8),
+        SIMDE_FLOAT16_VALUE(    23.92), SIMDE_FLOAT16_VALUE(    28.81), SIMDE_FLOAT16_VALUE(    12.28), SIMDE_FLOAT16_VALUE(    21.98),
+        SIMDE_FLOAT16_VALUE(    27.86), SIMDE_FLOAT16_VALUE(     30.5), SIMDE_FLOAT16_VALUE(    22.67), SIMDE_FLOAT16_VALUE(    20.05) } },
+    { { SIMDE_FLOAT16_VALUE(    887.0), SIMDE_FLOAT16_VALUE(    200.2), SIMDE_FLOAT16_VALUE(    817.0), SIMDE_FLOAT16_VALUE(    226.8),
+        SIMDE_FLOAT16_VALUE(    845.5), SIMDE_FLOAT16_VALUE(    249.1), SIMDE_FLOAT16_VALUE(    167.0), SIMDE_FLOAT16_VALUE(    396.8),
+        SIMDE_FLOAT16_VALUE(    930.5), SIMDE_FLOAT16_VALUE(    46.12), SIMDE_FLOAT16_VALUE(    473.5), SIMDE_FLOAT16_VALUE(     99.8),
+        SIMDE_FLOAT16_VALUE(    572.0), SIMDE_FLOAT16_VALUE(    650.0), SIMDE_FLOAT16_VALUE(    696.0), SIMDE_FLOAT16_VALUE(    988.0) },
+      { SIMDE_FLOAT16_VALUE(    29.78), SIMDE_FLOAT16_VALUE(    14.15), SIMDE_FLOAT16_VALUE(    28.58), SIMDE_FLOAT16_VALUE(   15.055),
+        SIMDE_FLOAT16_VALUE(    29.08), SIMDE_FLOAT16_VALUE(    15.78), SIMDE_FLOAT16_VALUE(    12.92), SIMDE_FLOAT16_VALUE(    19.92),
+        SIMDE_FLOAT16_VALUE(     30.5), SIMDE_FLOAT16_VALUE(    6.793), SIMDE_FLOAT16_VALUE(    21.77), SIMDE_FLOAT16_VALUE(     9.99),
+        SIMDE_FLOAT16_VALUE(    23.92), SIMDE_FLOAT16_VALUE(     25.5), SIMDE_FLOAT16_VALUE(    26.38), SIMDE_FLOAT16_VALUE(    31.44) } },
+    { { SIMDE_FLOAT16_VALUE(    865.5), SIMDE_FLOAT16_VALUE(    157.0), SIMDE_FLOAT16_VALUE(    145.0), SIMDE_FLOAT16_VALUE(    335.0),
+        SIMDE_FLOAT16_VALUE(    583.5), SIMDE_FLOAT16_VALUE(    378.0), SIMDE_FLOAT16_VALUE(    877.5), SIMDE_FLOAT16_VALUE(    474.5),
+        SIMDE_FLOAT16_VALUE(    280.2), SIMDE_FLOAT16_VALUE(    717.5), SIMDE_FLOAT16_VALUE(    992.0), SIMDE_FLOAT16_VALUE(    47.88),
+        SIMDE_FLOAT16_VALUE(    312.2), SIMDE_FLOAT16_VALUE(    53.88), SIMDE_FLOAT16_VALUE(    294.5), SIMDE_FLOAT16_VALUE(    876.0) },
+      { SIMDE_FLOAT16_VALUE(    29.42), SIMDE_FLOAT16_VALUE(    12.53), SIMDE_FLOAT16_VALUE(    12.04), SIMDE_FLOAT16_VALUE(     18.3),
+        SIMDE_FLOAT16_VALUE(    24.16), SIMDE_FLOAT16_VALUE(    19.44), SIMDE_FLOAT16_VALUE(    29.62), SIMDE_FLOAT16_VALUE(    21.78),
+        SIMDE_FLOAT16_VALUE(    16.73), SIMDE_FLOAT16_VALUE(    26.78), SIMDE_FLOAT16_VALUE(     31.5), SIMDE_FLOAT16_VALUE(    6.918),
+        SIMDE_FLOAT16_VALUE(    17.67), SIMDE_FLOAT16_VALUE(     7.34), SIMDE_FLOAT16_VALUE(    17.16), SIMDE_FLOAT16_VALUE(     29.6) } },
+    { { SIMDE_FLOAT16_VALUE(    27.72), SIMDE_FLOAT16_VALUE(    171.1), SIMDE_FLOAT16_VALUE(    808.0), SIMDE_FLOAT16_VALUE(    787.0),
+        SIMDE_FLOAT16_VALUE(    521.5), SIMDE_FLOAT16_VALUE(    948.0), SIMDE_FLOAT16_VALUE(    616.0), SIMDE_FLOAT16_VALUE(    162.6),
+        SIMDE_FLOAT16_VALUE(     87.6), SIMDE_FLOAT16_VALUE(    761.0), SIMDE_FLOAT16_VALUE(    891.5), SIMDE_FLOAT16_VALUE(    714.5),
+        SIMDE_FLOAT16_VALUE(    954.0), SIMDE_FLOAT16_VALUE(    673.5), SIMDE_FLOAT16_VALUE(    247.2), SIMDE_FLOAT16_VALUE(    7.258) },
+      { SIMDE_FLOAT16_VALUE(    5.266), SIMDE_FLOAT16_VALUE(    13.08), SIMDE_FLOAT16_VALUE(    28.42), SIMDE_FLOAT16_VALUE(    28.05),
+        SIMDE_FLOAT16_VALUE(    22.84), SIMDE_FLOAT16_VALUE(     30.8), SIMDE_FLOAT16_VALUE(    24.81), SIMDE_FLOAT16_VALUE(    12.75),
+        SIMDE_FLOAT16_VALUE(     9.36), SIMDE_FLOAT16_VALUE(     27.6), SIMDE_FLOAT16_VALUE(    29.86), SIMDE_FLOAT16_VALUE(    26.73),
+        SIMDE_FLOAT16_VALUE(    30.89), SIMDE_FLOAT16_VALUE(    25.95), SIMDE_FLOAT16_VALUE(    15.73), SIMDE_FLOAT16_VALUE(    2.693) } },
+    { { SIMDE_FLOAT16_VALUE(    609.5), SIMDE_FLOAT16_VALUE(    867.0), SIMDE_FLOAT16_VALUE(    757.0), SIMDE_FLOAT16_VALUE(     96.4),
+        SIMDE_FLOAT16_VALUE(    340.2), SIMDE_FLOAT16_VALUE(    90.25), SIMDE_FLOAT16_VALUE(    32.44), SIMDE_FLOAT16_VALUE(    741.0),
+        SIMDE_FLOAT16_VALUE(    370.8), SIMDE_FLOAT16_VALUE(    782.0), SIMDE_FLOAT16_VALUE(    252.1), SIMDE_FLOAT16_VALUE(    323.0),
+        SIMDE_FLOAT16_VALUE(    453.8), SIMDE_FLOAT16_VALUE(    247.2), SIMDE_FLOAT16_VALUE(    278.5), SIMDE_FLOAT16_VALUE(    211.1) },
+      { SIMDE_FLOAT16_VALUE(    24.69), SIMDE_FLOAT16_VALUE(    29.44), SIMDE_FLOAT16_VALUE(    27.52), SIMDE_FLOAT16_VALUE(     9.82),
+        SIMDE_FLOAT16_VALUE(    18.45), SIMDE_FLOAT16_VALUE(      9.5), SIMDE_FLOAT16_VALUE(    5.695), SIMDE_FLOAT16_VALUE(    27.22),
+        SIMDE_FLOAT16_VALUE(    19.25), SIMDE_FLOAT16_VALUE(    27.97), SIMDE_FLOAT16_VALUE(   15.875), SIMDE_FLOAT16_VALUE(    17.97),
+        SIMDE_FLOAT16_VALUE(     21.3), SIMDE_FLOAT16_VALUE(    15.73), SIMDE_FLOAT16_VALUE(    16.69), SIMDE_FLOAT16_VALUE(    14.53) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256h a = simde_mm256_loadu_ph(test_vec[i].a);
+    simde__m256h r = simde_mm256_sqrt_ph(a);
+    simde_test_x86_assert_equal_f16x16(r, simde_mm256_loadu_ph(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm512_sqrt_ph (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float16 a[32];
+    const simde_float16 r[32];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(    864.0), SIMDE_FLOAT16_VALUE(    666.5), SIMDE_FLOAT16_VALUE(    255.9), SIMDE_FLOAT16_VALUE(    338.5),
+        SIMDE_FLOAT16_VALUE(    41.56), SIMDE_FLOAT16_VALUE(    177.4), SIMDE_FLOAT16_VALUE(    680.0), SIMDE_FLOAT16_VALUE(    140.0),
+        SIMDE_FLOAT16_VALUE(    121.4), SIMDE_FLOAT16_VALUE(    931.5), SIMDE_FLOAT16_VALUE(    396.8), SIMDE_FLOAT16_VALUE(    603.0),
+        SIMDE_FLOAT16_VALUE(     88.8), SIMDE_FLOAT16_VALUE(    555.0), SIMDE_FLOAT16_VALUE(    803.0), SIMDE_FLOAT16_VALUE(    312.0),
+        SIMDE_FLOAT16_VALUE(    857.0), SIMDE_FLOAT16_VALUE(    797.0), SIMDE_FLOAT16_VALUE(    455.2), SIMDE_FLOAT16_VALUE(    179.2),
+        SIMDE_FLOAT16_VALUE(    467.0), SIMDE_FLOAT16_VALUE(    855.0), SIMDE_FLOAT16_VALUE(    858.5), SIMDE_FLOAT16_VALUE(     55.7),
+        SIMDE_FLOAT16_VALUE(    722.0), SIMDE_FLOAT16_VALUE(    275.2), SIMDE_FLOAT16_VALUE(    694.0), SIMDE_FLOAT16_VALUE(    25.36),
+        SIMDE_FLOAT16_VALUE(    553.5), SIMDE_FLOAT16_VALUE(    762.5), SIMDE_FLOAT16_VALUE(    620.0), SIMDE_FLOAT16_VALUE(    804.0) },
+      { SIMDE_FLOAT16_VALUE(    29.39), SIMDE_FLOAT16_VALUE(    25.81), SIMDE_FLOAT16_VALUE(    15.99), SIMDE_FLOAT16_VALUE(    18.39),
+        SIMDE_FLOAT16_VALUE(    6.445), SIMDE_FLOAT16_VALUE(    13.32), SIMDE_FLOAT16_VALUE(    26.08), SIMDE_FLOAT16_VALUE(   11.836),
+        SIMDE_FLOAT16_VALUE(   11.016), SIMDE_FLOAT16_VALUE(    30.52), SIMDE_FLOAT16_VALUE(    19.92), SIMDE_FLOAT16_VALUE(    24.56),
+        SIMDE_FLOAT16_VALUE(     9.42), SIMDE_FLOAT16_VALUE(    23.56), SIMDE_FLOAT16_VALUE(    28.34), SIMDE_FLOAT16_VALUE(    17.66),
+        SIMDE_FLOAT16_VALUE(    29.28), SIMDE_FLOAT16_VALUE(    28.23), SIMDE_FLOAT16_VALUE(    21.34), SIMDE_FLOAT16_VALUE(    13.39),
+        SIMDE_FLOAT16_VALUE(    21.61), SIMDE_FLOAT16_VALUE(    29.23), SIMDE_FLOAT16_VALUE(     29.3), SIMDE_FLOAT16_VALUE(     7.46),
+        SIMDE_FLOAT16_VALUE(    26.88), SIMDE_FLOAT16_VALUE(     16.6), SIMDE_FLOAT16_VALUE(    26.34), SIMDE_FLOAT16_VALUE(    5.035),
+        SIMDE_FLOAT16_VALUE(    23.53), SIMDE_FLOAT16_VALUE(    27.61), SIMDE_FLOAT16_VALUE(     24.9), SIMDE_FLOAT16_VALUE(    28.36) } },
+    { { SIMDE_FLOAT16_VALUE(    44.62), SIMDE_FLOAT16_VALUE(    675.0), SIMDE_FLOAT16_VALUE(    210.5), SIMDE_FLOAT16_VALUE(    28.17),
+        SIMDE_FLOAT16_VALUE(    986.5), SIMDE_FLOAT16_VALUE(    423.0), SIMDE_FLOAT16_VALUE(    63.88), SIMDE_FLOAT16_VALUE(    501.0),
+        SIMDE_FLOAT16_VALUE(    23.58), SIMDE_FLOAT16_VALUE(    840.0), SIMDE_FLOAT16_VALUE(     3.83), SIMDE_FLOAT16_VALUE(    865.5),
+        SIMDE_FLOAT16_VALUE(    600.5), SIMDE_FLOAT16_VALUE(    278.0), SIMDE_FLOAT16_VALUE(    873.0), SIMDE_FLOAT16_VALUE(    673.5),
+        SIMDE_FLOAT16_VALUE(    308.0), SIMDE_FLOAT16_VALUE(    694.5), SIMDE_FLOAT16_VALUE(    352.5), SIMDE_FLOAT16_VALUE(    16.38),
+        SIMDE_FLOAT16_VALUE(    379.5), SIMDE_FLOAT16_VALUE(    260.0), SIMDE_FLOAT16_VALUE(    383.5), SIMDE_FLOAT16_VALUE(    153.0),
+        SIMDE_FLOAT16_VALUE(    926.0), SIMDE_FLOAT16_VALUE(    985.5), SIMDE_FLOAT16_VALUE(    698.5), SIMDE_FLOAT16_VALUE(    708.0),
+        SIMDE_FLOAT16_VALUE(    240.4), SIMDE_FLOAT16_VALUE(    719.5), SIMDE_FLOAT16_VALUE(    570.0), SIMDE_FLOAT16_VALUE(    244.0) },
+      { SIMDE_FLOAT16_VALUE(     6.68), SIMDE_FLOAT16_VALUE(    25.98), SIMDE_FLOAT16_VALUE(    14.51), SIMDE_FLOAT16_VALUE(     5.31),
+        SIMDE_FLOAT16_VALUE(     31.4), SIMDE_FLOAT16_VALUE(    20.56), SIMDE_FLOAT16_VALUE(    7.992), SIMDE_FLOAT16_VALUE(    22.39),
+        SIMDE_FLOAT16_VALUE(    4.855), SIMDE_FLOAT16_VALUE(    28.98), SIMDE_FLOAT16_VALUE(    1.957), SIMDE_FLOAT16_VALUE(    29.42),
+        SIMDE_FLOAT16_VALUE(     24.5), SIMDE_FLOAT16_VALUE(    16.67), SIMDE_FLOAT16_VALUE(    29.55), SIMDE_FLOAT16_VALUE(    25.95),
+        SIMDE_FLOAT16_VALUE(    17.55), SIMDE_FLOAT16_VALUE(    26.36), SIMDE_FLOAT16_VALUE(    18.78), SIMDE_FLOAT16_VALUE(    4.047),
+        SIMDE_FLOAT16_VALUE(    19.48), SIMDE_FLOAT16_VALUE(    16.12), SIMDE_FLOAT16_VALUE(    19.58), SIMDE_FLOAT16_VALUE(    12.37),
+        SIMDE_FLOAT16_VALUE(    30.44), SIMDE_FLOAT16_VALUE(    31.39), SIMDE_FLOAT16_VALUE(    26.42), SIMDE_FLOAT16_VALUE(    26.61),
+        SIMDE_FLOAT16_VALUE(    15.51), SIMDE_FLOAT16_VALUE(    26.83), SIMDE_FLOAT16_VALUE(    23.88), SIMDE_FLOAT16_VALUE(    15.62) } },
+    { { SIMDE_FLOAT16_VALUE(    168.9), SIMDE_FLOAT16_VALUE(    619.5), SIMDE_FLOAT16_VALUE(    13.45), SIMDE_FLOAT16_VALUE(    849.5),
+        SIMDE_FLOAT16_VALUE(    134.5), SIMDE_FLOAT16_VALUE(    783.0), SIMDE_FLOAT16_VALUE(    214.4), SIMDE_FLOAT16_VALUE(    319.2),
+        SIMDE_FLOAT16_VALUE(    677.0), SIMDE_FLOAT16_VALUE(    952.5), SIMDE_FLOAT16_VALUE(    469.8), SIMDE_FLOAT16_VALUE(     41.9),
+        SIMDE_FLOAT16_VALUE(    165.6), SIMDE_FLOAT16_VALUE(    874.5), SIMDE_FLOAT16_VALUE(     81.8), SIMDE_FLOAT16_VALUE(    556.0),
+        SIMDE_FLOAT16_VALUE(    760.0), SIMDE_FLOAT16_VALUE(    796.0), SIMDE_FLOAT16_VALUE(    504.0), SIMDE_FLOAT16_VALUE(    794.5),
+        SIMDE_FLOAT16_VALUE(    704.5), SIMDE_FLOAT16_VALUE(    702.0), SIMDE_FLOAT16_VALUE(    316.2), SIMDE_FLOAT16_VALUE(    793.5),
+        SIMDE_FLOAT16_VALUE(    256.0), SIMDE_FLOAT16_VALUE(    409.5), SIMDE_FLOAT16_VALUE(    877.5), SIMDE_FLOAT16_VALUE(    209.2),
+        SIMDE_FLOAT16_VALUE(     7.32), SIMDE_FLOAT16_VALUE(    180.0), SIMDE_FLOAT16_VALUE(    254.1), SIMDE_FLOAT16_VALUE(    349.0) },
+      { SIMDE_FLOAT16_VALUE(    12.99), SIMDE_FLOAT16_VALUE(    24.89), SIMDE_FLOAT16_VALUE(    3.668), SIMDE_FLOAT16_VALUE(    29.14),
+        SIMDE_FLOAT16_VALUE(    11.59), SIMDE_FLOAT16_VALUE(    27.98), SIMDE_FLOAT16_VALUE(    14.64), SIMDE_FLOAT16_VALUE(    17.88),
+        SIMDE_FLOAT16_VALUE(    26.02), SIMDE_FLOAT16_VALUE(    30.86), SIMDE_FLOAT16_VALUE(    21.67), SIMDE_FLOAT16_VALUE(    6.473),
+        SIMDE_FLOAT16_VALUE(    12.87), SIMDE_FLOAT16_VALUE(    29.58), SIMDE_FLOAT16_VALUE(     9.05), SIMDE_FLOAT16_VALUE(    23.58),
+        SIMDE_FLOAT16_VALUE(    27.56), SIMDE_FLOAT16_VALUE(    28.22), SIMDE_FLOAT16_VALUE(    22.45), SIMDE_FLOAT16_VALUE(    28.19),
+        SIMDE_FLOAT16_VALUE(    26.55), SIMDE_FLOAT16_VALUE(     26.5), SIMDE_FLOAT16_VALUE(    17.78), SIMDE_FLOAT16_VALUE(    28.17),
+        SIMDE_FLOAT16_VALUE(     16.0), SIMDE_FLOAT16_VALUE(    20.23), SIMDE_FLOAT16_VALUE(    29.62), SIMDE_FLOAT16_VALUE(    14.47),
+        SIMDE_FLOAT16_VALUE(    2.705), SIMDE_FLOAT16_VALUE(   13.414), SIMDE_FLOAT16_VALUE(    15.94), SIMDE_FLOAT16_VALUE(    18.69) } },
+    { { SIMDE_FLOAT16_VALUE(    219.0), SIMDE_FLOAT16_VALUE(    343.5), SIMDE_FLOAT16_VALUE(    357.5), SIMDE_FLOAT16_VALUE(    567.0),
+        SIMDE_FLOAT16_VALUE(    249.6), SIMDE_FLOAT16_VALUE(    738.0), SIMDE_FLOAT16_VALUE(    762.5), SIMDE_FLOAT16_VALUE(    484.8),
+        SIMDE_FLOAT16_VALUE(    87.06), SIMDE_FLOAT16_VALUE(    511.0), SIMDE_FLOAT16_VALUE(    814.5), SIMDE_FLOAT16_VALUE(    922.0),
+        SIMDE_FLOAT16_VALUE(    895.5), SIMDE_FLOAT16_VALUE(    576.5), SIMDE_FLOAT16_VALUE(    562.0), SIMDE_FLOAT16_VALUE(    730.5),
+        SIMDE_FLOAT16_VALUE(    950.0), SIMDE_FLOAT16_VALUE(    779.5), SIMDE_FLOAT16_VALUE(    714.5), SIMDE_FLOAT16_VALUE(    862.0),
+        SIMDE_FLOAT16_VALUE(    344.2), SIMDE_FLOAT16_VALUE(    684.5), SIMDE_FLOAT16_VALUE(    836.0), SIMDE_FLOAT16_VALUE(    651.0),
+        SIMDE_FLOAT16_VALUE(    516.5), SIMDE_FLOAT16_VALUE(    840.0), SIMDE_FLOAT16_VALUE(     45.9), SIMDE_FLOAT16_VALUE(    492.2),
+        SIMDE_FLOAT16_VALUE(    744.0), SIMDE_FLOAT16_VALUE(    581.5), SIMDE_FLOAT16_VALUE(    363.5), SIMDE_FLOAT16_VALUE(    723.5) },
+      { SIMDE_FLOAT16_VALUE(     14.8), SIMDE_FLOAT16_VALUE(    18.53), SIMDE_FLOAT16_VALUE(     18.9), SIMDE_FLOAT16_VALUE(    23.81),
+        SIMDE_FLOAT16_VALUE(     15.8), SIMDE_FLOAT16_VALUE(    27.17), SIMDE_FLOAT16_VALUE(    27.61), SIMDE_FLOAT16_VALUE(    22.02),
+        SIMDE_FLOAT16_VALUE(     9.33), SIMDE_FLOAT16_VALUE(    22.61), SIMDE_FLOAT16_VALUE(    28.55), SIMDE_FLOAT16_VALUE(    30.36),
+        SIMDE_FLOAT16_VALUE(    29.92), SIMDE_FLOAT16_VALUE(    24.02), SIMDE_FLOAT16_VALUE(     23.7), SIMDE_FLOAT16_VALUE(    27.03),
+        SIMDE_FLOAT16_VALUE(    30.83), SIMDE_FLOAT16_VALUE(    27.92), SIMDE_FLOAT16_VALUE(    26.73), SIMDE_FLOAT16_VALUE(    29.36),
+        SIMDE_FLOAT16_VALUE(    18.55), SIMDE_FLOAT16_VALUE(    26.16), SIMDE_FLOAT16_VALUE(     28.9), SIMDE_FLOAT16_VALUE(    25.52),
+        SIMDE_FLOAT16_VALUE(    22.73), SIMDE_FLOAT16_VALUE(    28.98), SIMDE_FLOAT16_VALUE(    6.777), SIMDE_FLOAT16_VALUE(    22.19),
+        SIMDE_FLOAT16_VALUE(    27.28), SIMDE_FLOAT16_VALUE(    24.11), SIMDE_FLOAT16_VALUE(    19.06), SIMDE_FLOAT16_VALUE(    26.89) } },
+    { { SIMDE_FLOAT16_VALUE(    588.5), SIMDE_FLOAT16_VALUE(    321.8), SIMDE_FLOAT16_VALUE(    176.8), SIMDE_FLOAT16_VALUE(    582.5),
+        SIMDE_FLOAT16_VALUE(    221.1), SIMDE_FLOAT16_VALUE(    879.5), SIMDE_FLOAT16_VALUE(    266.2), SIMDE_FLOAT16_VALUE(    994.5),
+        SIMDE_FLOAT16_VALUE(    622.0), SIMDE_FLOAT16_VALUE(    112.4), SIMDE_FLOAT16_VALUE(    914.0), SIMDE_FLOAT16_VALUE(    881.5),
+        SIMDE_FLOAT16_VALUE(    296.0), SIMDE_FLOAT16_VALUE(    662.5), SIMDE_FLOAT16_VALUE(    755.5), SIMDE_FLOAT16_VALUE(    572.5),
+        SIMDE_FLOAT16_VALUE(    722.0), SIMDE_FLOAT16_VALUE(    195.1), SIMDE_FLOAT16_VALUE(    667.5), SIMDE_FLOAT16_VALUE(    608.0),
+        SIMDE_FLOAT16_VALUE(    813.5), SIMDE_FLOAT16_VALUE(     94.5), SIMDE_FLOAT16_VALUE(    604.0), SIMDE_FLOAT16_VALUE(    983.0),
+        SIMDE_FLOAT16_VALUE(    175.5), SIMDE_FLOAT16_VALUE(     94.1), SIMDE_FLOAT16_VALUE(    954.5), SIMDE_FLOAT16_VALUE(    337.8),
+        SIMDE_FLOAT16_VALUE(    946.0), SIMDE_FLOAT16_VALUE(     9.72), SIMDE_FLOAT16_VALUE(    482.2), SIMDE_FLOAT16_VALUE(    655.5) },
+      { SIMDE_FLOAT16_VALUE(    24.27), SIMDE_FLOAT16_VALUE(    17.94), SIMDE_FLOAT16_VALUE(     13.3), SIMDE_FLOAT16_VALUE(    24.14),
+        SIMDE_FLOAT16_VALUE(    14.87), SIMDE_FLOAT16_VALUE(    29.66), SIMDE_FLOAT16_VALUE(    16.31), SIMDE_FLOAT16_VALUE(    31.53),
+        SIMDE_FLOAT16_VALUE(    24.94), SIMDE_FLOAT16_VALUE(     10.6), SIMDE_FLOAT16_VALUE(    30.23), SIMDE_FLOAT16_VALUE(    29.69),
+        SIMDE_FLOAT16_VALUE(     17.2), SIMDE_FLOAT16_VALUE(    25.73), SIMDE_FLOAT16_VALUE(    27.48), SIMDE_FLOAT16_VALUE(    23.92),
+        SIMDE_FLOAT16_VALUE(    26.88), SIMDE_FLOAT16_VALUE(    13.97), SIMDE_FLOAT16_VALUE(    25.84), SIMDE_FLOAT16_VALUE(    24.66),
+        SIMDE_FLOAT16_VALUE(    28.52), SIMDE_FLOAT16_VALUE(     9.72), SIMDE_FLOAT16_VALUE(    24.58), SIMDE_FLOAT16_VALUE(    31.36),
+        SIMDE_FLOAT16_VALUE(    13.25), SIMDE_FLOAT16_VALUE(      9.7), SIMDE_FLOAT16_VALUE(    30.89), SIMDE_FLOAT16_VALUE(    18.38),
+        SIMDE_FLOAT16_VALUE(    30.75), SIMDE_FLOAT16_VALUE(    3.117), SIMDE_FLOAT16_VALUE(    21.95), SIMDE_FLOAT16_VALUE(    25.61) } },
+    { { SIMDE_FLOAT16_VALUE(    77.25), SIMDE_FLOAT16_VALUE(    205.9), SIMDE_FLOAT16_VALUE(    170.5), SIMDE_FLOAT16_VALUE(    366.8),
+        SIMDE_FLOAT16_VALUE(    430.5), SIMDE_FLOAT16_VALUE(    499.8), SIMDE_FLOAT16_VALUE(    492.8), SIMDE_FLOAT16_VALUE(    138.1),
+        SIMDE_FLOAT16_VALUE(    207.0), SIMDE_FLOAT16_VALUE(    934.0), SIMDE_FLOAT16_VALUE(    11.37), SIMDE_FLOAT16_VALUE(    884.5),
+        SIMDE_FLOAT16_VALUE(    707.0), SIMDE_FLOAT16_VALUE(    854.0), SIMDE_FLOAT16_VALUE(    610.0), SIMDE_FLOAT16_VALUE(    482.8),
+        SIMDE_FLOAT16_VALUE(    565.0), SIMDE_FLOAT16_VALUE(    841.0), SIMDE_FLOAT16_VALUE(    123.2), SIMDE_FLOAT16_VALUE(    729.5),
+        SIMDE_FLOAT16_VALUE(    511.8), SIMDE_FLOAT16_VALUE(    961.5), SIMDE_FLOAT16_VALUE(    702.5), SIMDE_FLOAT16_VALUE(    702.0),
+        SIMDE_FLOAT16_VALUE(    255.9), SIMDE_FLOAT16_VALUE(    897.5), SIMDE_FLOAT16_VALUE(    305.8), SIMDE_FLOAT16_VALUE(    301.8),
+        SIMDE_FLOAT16_VALUE(    384.2), SIMDE_FLOAT16_VALUE(    594.5), SIMDE_FLOAT16_VALUE(    357.8), SIMDE_FLOAT16_VALUE(    329.0) },
+      { SIMDE_FLOAT16_VALUE(     8.79), SIMDE_FLOAT16_VALUE(    14.35), SIMDE_FLOAT16_VALUE(   13.055), SIMDE_FLOAT16_VALUE(    19.16),
+        SIMDE_FLOAT16_VALUE(    20.75), SIMDE_FLOAT16_VALUE(    22.36), SIMDE_FLOAT16_VALUE(     22.2), SIMDE_FLOAT16_VALUE(    11.75),
+        SIMDE_FLOAT16_VALUE(    14.39), SIMDE_FLOAT16_VALUE(    30.56), SIMDE_FLOAT16_VALUE(    3.371), SIMDE_FLOAT16_VALUE(    29.73),
+        SIMDE_FLOAT16_VALUE(     26.6), SIMDE_FLOAT16_VALUE(    29.22), SIMDE_FLOAT16_VALUE(     24.7), SIMDE_FLOAT16_VALUE(    21.97),
+        SIMDE_FLOAT16_VALUE(    23.77), SIMDE_FLOAT16_VALUE(     29.0), SIMDE_FLOAT16_VALUE(     11.1), SIMDE_FLOAT16_VALUE(    27.02),
+        SIMDE_FLOAT16_VALUE(    22.62), SIMDE_FLOAT16_VALUE(    31.02), SIMDE_FLOAT16_VALUE(     26.5), SIMDE_FLOAT16_VALUE(     26.5),
+        SIMDE_FLOAT16_VALUE(    15.99), SIMDE_FLOAT16_VALUE(    29.95), SIMDE_FLOAT16_VALUE(    17.48), SIMDE_FLOAT16_VALUE(    17.38),
+        SIMDE_FLOAT16_VALUE(    19.61), SIMDE_FLOAT16_VALUE(    24.38), SIMDE_FLOAT16_VALUE(    18.92), SIMDE_FLOAT16_VALUE(    18.14) } },
+    { { SIMDE_FLOAT16_VALUE(    731.0), SIMDE_FLOAT16_VALUE(    230.4), SIMDE_FLOAT16_VALUE(    925.0), SIMDE_FLOAT16_VALUE(    641.5),
+        SIMDE_FLOAT16_VALUE(    363.8), SIMDE_FLOAT16_VALUE(    291.2), SIMDE_FLOAT16_VALUE(    512.5), SIMDE_FLOAT16_VALUE(    898.0),
+        SIMDE_FLOAT16_VALUE(    999.0), SIMDE_FLOAT16_VALUE(    451.0), SIMDE_FLOAT16_VALUE(    273.2), SIMDE_FLOAT16_VALUE(    158.4),
+        SIMDE_FLOAT16_VALUE(    831.0), SIMDE_FLOAT16_VALUE(    875.0), SIMDE_FLOAT16_VALUE(    199.0), SIMDE_FLOAT16_VALUE(     89.7),
+        SIMDE_FLOAT16_VALUE(    83.94), SIMDE_FLOAT16_VALUE(    122.9), SIMDE_FLOAT16_VALUE(    996.0), SIMDE_FLOAT16_VALUE(    447.2),
+        SIMDE_FLOAT16_VALUE(    130.9), SIMDE_FLOAT16_VALUE(    574.5), SIMDE_FLOAT16_VALUE(    231.0), SIMDE_FLOAT16_VALUE(    799.0),
+        SIMDE_FLOAT16_VALUE(    512.5), SIMDE_FLOAT16_VALUE(    700.0), SIMDE_FLOAT16_VALUE(    745.0), SIMDE_FLOAT16_VALUE(    438.2),
+        SIMDE_FLOAT16_VALUE(    674.0), SIMDE_FLOAT16_VALUE(    316.2), SIMDE_FLOAT16_VALUE(    769.0), SIMDE_FLOAT16_VALUE(    149.1) },
+      { SIMDE_FLOAT16_VALUE(    27.03), SIMDE_FLOAT16_VALUE(    15.18), SIMDE_FLOAT16_VALUE(     30.4), SIMDE_FLOAT16_VALUE(    25.33),
+        SIMDE_FLOAT16_VALUE(    19.08), SIMDE_FLOAT16_VALUE(    17.06), SIMDE_FLOAT16_VALUE(    22.64), SIMDE_FLOAT16_VALUE(    29.97),
+        SIMDE_FLOAT16_VALUE(    31.61), SIMDE_FLOAT16_VALUE(    21.23), SIMDE_FLOAT16_VALUE(    16.53), SIMDE_FLOAT16_VALUE(   12.586),
+        SIMDE_FLOAT16_VALUE(    28.83), SIMDE_FLOAT16_VALUE(    29.58), SIMDE_FLOAT16_VALUE(    14.11), SIMDE_FLOAT16_VALUE(     9.47),
+        SIMDE_FLOAT16_VALUE(    9.164), SIMDE_FLOAT16_VALUE(   11.086), SIMDE_FLOAT16_VALUE(    31.56), SIMDE_FLOAT16_VALUE(    21.14),
+        SIMDE_FLOAT16_VALUE(    11.44), SIMDE_FLOAT16_VALUE(    23.97), SIMDE_FLOAT16_VALUE(   15.195), SIMDE_FLOAT16_VALUE(    28.27),
+        SIMDE_FLOAT16_VALUE(    22.64), SIMDE_FLOAT16_VALUE(    26.45), SIMDE_FLOAT16_VALUE(     27.3), SIMDE_FLOAT16_VALUE(    20.94),
+        SIMDE_FLOAT16_VALUE(    25.97), SIMDE_FLOAT16_VALUE(    17.78), SIMDE_FLOAT16_VALUE(    27.73), SIMDE_FLOAT16_VALUE(    12.21) } },
+    { { SIMDE_FLOAT16_VALUE(    519.5), SIMDE_FLOAT16_VALUE(    636.0), SIMDE_FLOAT16_VALUE(    387.5), SIMDE_FLOAT16_VALUE(    545.0),
+        SIMDE_FLOAT16_VALUE(    902.0), SIMDE_FLOAT16_VALUE(    274.0), SIMDE_FLOAT16_VALUE(    529.0), SIMDE_FLOAT16_VALUE(    844.5),
+        SIMDE_FLOAT16_VALUE(    758.0), SIMDE_FLOAT16_VALUE(    151.1), SIMDE_FLOAT16_VALUE(    328.8), SIMDE_FLOAT16_VALUE(    680.5),
+        SIMDE_FLOAT16_VALUE(    764.0), SIMDE_FLOAT16_VALUE(    975.0), SIMDE_FLOAT16_VALUE(    629.0), SIMDE_FLOAT16_VALUE(    22.36),
+        SIMDE_FLOAT16_VALUE(    238.9), SIMDE_FLOAT16_VALUE(    992.0), SIMDE_FLOAT16_VALUE(    632.0), SIMDE_FLOAT16_VALUE(    170.1),
+        SIMDE_FLOAT16_VALUE(    160.5), SIMDE_FLOAT16_VALUE(    917.0), SIMDE_FLOAT16_VALUE(    723.5), SIMDE_FLOAT16_VALUE(    772.5),
+        SIMDE_FLOAT16_VALUE(    437.8), SIMDE_FLOAT16_VALUE(    441.5), SIMDE_FLOAT16_VALUE(    532.5), SIMDE_FLOAT16_VALUE(    356.8),
+        SIMDE_FLOAT16_VALUE(    773.5), SIMDE_FLOAT16_VALUE(    481.2), SIMDE_FLOAT16_VALUE(    115.8), SIMDE_FLOAT16_VALUE(    365.8) },
+      { SIMDE_FLOAT16_VALUE(     22.8), SIMDE_FLOAT16_VALUE(    25.22), SIMDE_FLOAT16_VALUE(    19.69), SIMDE_FLOAT16_VALUE(    23.34),
+        SIMDE_FLOAT16_VALUE(    30.03), SIMDE_FLOAT16_VALUE(    16.55), SIMDE_FLOAT16_VALUE(     23.0), SIMDE_FLOAT16_VALUE(    29.06),
+        SIMDE_FLOAT16_VALUE(    27.53), SIMDE_FLOAT16_VALUE(     12.3), SIMDE_FLOAT16_VALUE(    18.12), SIMDE_FLOAT16_VALUE(     26.1),
+        SIMDE_FLOAT16_VALUE(    27.64), SIMDE_FLOAT16_VALUE(    31.22), SIMDE_FLOAT16_VALUE(    25.08), SIMDE_FLOAT16_VALUE(     4.73),
+        SIMDE_FLOAT16_VALUE(    15.45), SIMDE_FLOAT16_VALUE(     31.5), SIMDE_FLOAT16_VALUE(    25.14), SIMDE_FLOAT16_VALUE(    13.05),
+        SIMDE_FLOAT16_VALUE(    12.67), SIMDE_FLOAT16_VALUE(    30.28), SIMDE_FLOAT16_VALUE(    26.89), SIMDE_FLOAT16_VALUE(     27.8),
+        SIMDE_FLOAT16_VALUE(    20.92), SIMDE_FLOAT16_VALUE(    21.02), SIMDE_FLOAT16_VALUE(    23.08), SIMDE_FLOAT16_VALUE(    18.89),
+        SIMDE_FLOAT16_VALUE(    27.81), SIMDE_FLOAT16_VALUE(    21.94), SIMDE_FLOAT16_VALUE(    10.76), SIMDE_FLOAT16_VALUE(    19.12) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512h a = simde_mm512_loadu_ph(test_vec[i].a);
+    simde__m512h r = simde_mm512_sqrt_ph(a);
+    simde_test_x86_assert_equal_f16x32(r, simde_mm512_loadu_ph(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
 SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_sqrt_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_sqrt_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_sqrt_pd)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_sqrt_pd)
+
+  #if defined(SIMDE_FLOAT16_IS_SCALAR)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm_sqrt_ph)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm256_sqrt_ph)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm512_sqrt_ph)
+  #endif
 SIMDE_TEST_FUNC_LIST_END
 
 #include <test/x86/avx512/test-avx512-footer.h>
@@ -3151,6 +3151,405 @@ test_simde_mm512_maskz_sub_pd(SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm_sub_ph (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float16 a[8];
+    const simde_float16 b[8];
+    const simde_float16 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(     46.6), SIMDE_FLOAT16_VALUE(    55.44), SIMDE_FLOAT16_VALUE(     7.83), SIMDE_FLOAT16_VALUE(    39.94),
+        SIMDE_FLOAT16_VALUE(    22.81), SIMDE_FLOAT16_VALUE(    -66.8), SIMDE_FLOAT16_VALUE(   -47.03), SIMDE_FLOAT16_VALUE(   -12.67) },
+      { SIMDE_FLOAT16_VALUE(    -81.7), SIMDE_FLOAT16_VALUE(    -77.1), SIMDE_FLOAT16_VALUE(     88.9), SIMDE_FLOAT16_VALUE(    -53.8),
+        SIMDE_FLOAT16_VALUE(   -4.855), SIMDE_FLOAT16_VALUE(   -11.86), SIMDE_FLOAT16_VALUE(     64.4), SIMDE_FLOAT16_VALUE(    -96.6) },
+      { SIMDE_FLOAT16_VALUE(    128.2), SIMDE_FLOAT16_VALUE(    132.5), SIMDE_FLOAT16_VALUE(   -81.06), SIMDE_FLOAT16_VALUE(    93.75),
+        SIMDE_FLOAT16_VALUE(    27.67), SIMDE_FLOAT16_VALUE(   -54.94), SIMDE_FLOAT16_VALUE(   -111.4), SIMDE_FLOAT16_VALUE(    83.94) } },
+    { { SIMDE_FLOAT16_VALUE(    21.19), SIMDE_FLOAT16_VALUE(   -23.11), SIMDE_FLOAT16_VALUE(   -3.861), SIMDE_FLOAT16_VALUE(     99.1),
+        SIMDE_FLOAT16_VALUE(   -42.34), SIMDE_FLOAT16_VALUE(    1.429), SIMDE_FLOAT16_VALUE(     72.7), SIMDE_FLOAT16_VALUE(   -99.75) },
+      { SIMDE_FLOAT16_VALUE(   -77.06), SIMDE_FLOAT16_VALUE(     95.8), SIMDE_FLOAT16_VALUE(    25.44), SIMDE_FLOAT16_VALUE(    -88.6),
+        SIMDE_FLOAT16_VALUE(     3.77), SIMDE_FLOAT16_VALUE(   -85.56), SIMDE_FLOAT16_VALUE(   -31.88), SIMDE_FLOAT16_VALUE(    -95.4) },
+      { SIMDE_FLOAT16_VALUE(    98.25), SIMDE_FLOAT16_VALUE(  -118.94), SIMDE_FLOAT16_VALUE(    -29.3), SIMDE_FLOAT16_VALUE(    187.8),
+        SIMDE_FLOAT16_VALUE(   -46.12), SIMDE_FLOAT16_VALUE(     87.0), SIMDE_FLOAT16_VALUE(   104.56), SIMDE_FLOAT16_VALUE(   -4.375) } },
+    { { SIMDE_FLOAT16_VALUE(   -60.25), SIMDE_FLOAT16_VALUE(    -21.3), SIMDE_FLOAT16_VALUE(    26.89), SIMDE_FLOAT16_VALUE(   -62.88),
+        SIMDE_FLOAT16_VALUE(   -57.66), SIMDE_FLOAT16_VALUE(   -32.84), SIMDE_FLOAT16_VALUE(    76.56), SIMDE_FLOAT16_VALUE(     9.81) },
+      { SIMDE_FLOAT16_VALUE(   -6.883), SIMDE_FLOAT16_VALUE(     23.6), SIMDE_FLOAT16_VALUE(    49.72), SIMDE_FLOAT16_VALUE(    -87.7),
+        SIMDE_FLOAT16_VALUE(   -69.25), SIMDE_FLOAT16_VALUE(    78.75), SIMDE_FLOAT16_VALUE(    17.28), SIMDE_FLOAT16_VALUE(    46.53) },
+      { SIMDE_FLOAT16_VALUE(   -53.38), SIMDE_FLOAT16_VALUE(   -44.88), SIMDE_FLOAT16_VALUE(   -22.83), SIMDE_FLOAT16_VALUE(    24.81),
+        SIMDE_FLOAT16_VALUE(    11.59), SIMDE_FLOAT16_VALUE(   -111.6), SIMDE_FLOAT16_VALUE(    59.28), SIMDE_FLOAT16_VALUE(   -36.72) } },
+    { { SIMDE_FLOAT16_VALUE(    -61.5), SIMDE_FLOAT16_VALUE(     96.4), SIMDE_FLOAT16_VALUE(    -90.5), SIMDE_FLOAT16_VALUE(   -26.77),
+        SIMDE_FLOAT16_VALUE(    -68.3), SIMDE_FLOAT16_VALUE(    -41.1), SIMDE_FLOAT16_VALUE(   -83.06), SIMDE_FLOAT16_VALUE(    -52.1) },
+      { SIMDE_FLOAT16_VALUE(    60.28), SIMDE_FLOAT16_VALUE(     70.7), SIMDE_FLOAT16_VALUE(     54.0), SIMDE_FLOAT16_VALUE(    -85.5),
+        SIMDE_FLOAT16_VALUE(   -99.75), SIMDE_FLOAT16_VALUE(     74.0), SIMDE_FLOAT16_VALUE(    91.06), SIMDE_FLOAT16_VALUE(    57.38) },
+      { SIMDE_FLOAT16_VALUE(  -121.75), SIMDE_FLOAT16_VALUE(    25.69), SIMDE_FLOAT16_VALUE(   -144.5), SIMDE_FLOAT16_VALUE(    58.75),
+        SIMDE_FLOAT16_VALUE(    31.44), SIMDE_FLOAT16_VALUE(   -115.1), SIMDE_FLOAT16_VALUE(   -174.1), SIMDE_FLOAT16_VALUE(   -109.5) } },
+    { { SIMDE_FLOAT16_VALUE(   -28.77), SIMDE_FLOAT16_VALUE(    77.75), SIMDE_FLOAT16_VALUE(     38.5), SIMDE_FLOAT16_VALUE(   -62.97),
+        SIMDE_FLOAT16_VALUE(    46.06), SIMDE_FLOAT16_VALUE(   -40.56), SIMDE_FLOAT16_VALUE(   -20.83), SIMDE_FLOAT16_VALUE(    31.95) },
+      { SIMDE_FLOAT16_VALUE(    34.94), SIMDE_FLOAT16_VALUE(    -85.5), SIMDE_FLOAT16_VALUE(   11.055), SIMDE_FLOAT16_VALUE(   -77.44),
+        SIMDE_FLOAT16_VALUE(   -6.723), SIMDE_FLOAT16_VALUE(    85.25), SIMDE_FLOAT16_VALUE(    83.25), SIMDE_FLOAT16_VALUE(    42.62) },
+      { SIMDE_FLOAT16_VALUE(    -63.7), SIMDE_FLOAT16_VALUE(    163.2), SIMDE_FLOAT16_VALUE(    27.44), SIMDE_FLOAT16_VALUE(    14.47),
+        SIMDE_FLOAT16_VALUE(    52.78), SIMDE_FLOAT16_VALUE(   -125.8), SIMDE_FLOAT16_VALUE(  -104.06), SIMDE_FLOAT16_VALUE(   -10.67) } },
+    { { SIMDE_FLOAT16_VALUE(     61.6), SIMDE_FLOAT16_VALUE(    27.81), SIMDE_FLOAT16_VALUE(    39.88), SIMDE_FLOAT16_VALUE(    95.44),
+        SIMDE_FLOAT16_VALUE(   -21.61), SIMDE_FLOAT16_VALUE(     92.5), SIMDE_FLOAT16_VALUE(    -61.9), SIMDE_FLOAT16_VALUE(   -54.84) },
+      { SIMDE_FLOAT16_VALUE(    73.44), SIMDE_FLOAT16_VALUE(    10.26), SIMDE_FLOAT16_VALUE(   -62.88), SIMDE_FLOAT16_VALUE(    80.25),
+        SIMDE_FLOAT16_VALUE(    -77.5), SIMDE_FLOAT16_VALUE(   -41.56), SIMDE_FLOAT16_VALUE(    31.34), SIMDE_FLOAT16_VALUE(   -12.46) },
+      { SIMDE_FLOAT16_VALUE(   -11.84), SIMDE_FLOAT16_VALUE(    17.56), SIMDE_FLOAT16_VALUE(   102.75), SIMDE_FLOAT16_VALUE(    15.19),
+        SIMDE_FLOAT16_VALUE(    55.88), SIMDE_FLOAT16_VALUE(    134.0), SIMDE_FLOAT16_VALUE(   -93.25), SIMDE_FLOAT16_VALUE(   -42.38) } },
+    { { SIMDE_FLOAT16_VALUE(     69.5), SIMDE_FLOAT16_VALUE(   -46.62), SIMDE_FLOAT16_VALUE(    -75.3), SIMDE_FLOAT16_VALUE(   -53.66),
+        SIMDE_FLOAT16_VALUE(   -16.75), SIMDE_FLOAT16_VALUE(   -9.984), SIMDE_FLOAT16_VALUE(   -91.06), SIMDE_FLOAT16_VALUE(    -58.3) },
+      { SIMDE_FLOAT16_VALUE(   -23.02), SIMDE_FLOAT16_VALUE(    55.12), SIMDE_FLOAT16_VALUE(     87.5), SIMDE_FLOAT16_VALUE(    -49.8),
+        SIMDE_FLOAT16_VALUE(    29.73), SIMDE_FLOAT16_VALUE(    96.94), SIMDE_FLOAT16_VALUE(     79.3), SIMDE_FLOAT16_VALUE(     -9.7) },
+      { SIMDE_FLOAT16_VALUE(     92.5), SIMDE_FLOAT16_VALUE(  -101.75), SIMDE_FLOAT16_VALUE(   -162.8), SIMDE_FLOAT16_VALUE(   -3.844),
+        SIMDE_FLOAT16_VALUE(    -46.5), SIMDE_FLOAT16_VALUE(  -106.94), SIMDE_FLOAT16_VALUE(   -170.4), SIMDE_FLOAT16_VALUE(   -48.62) } },
+    { { SIMDE_FLOAT16_VALUE(   -76.44), SIMDE_FLOAT16_VALUE(    -51.5), SIMDE_FLOAT16_VALUE(     66.1), SIMDE_FLOAT16_VALUE(     96.4),
+        SIMDE_FLOAT16_VALUE(   -49.75), SIMDE_FLOAT16_VALUE(    92.56), SIMDE_FLOAT16_VALUE(    31.55), SIMDE_FLOAT16_VALUE(     95.2) },
+      { SIMDE_FLOAT16_VALUE(   -58.44), SIMDE_FLOAT16_VALUE(    37.84), SIMDE_FLOAT16_VALUE(    40.53), SIMDE_FLOAT16_VALUE(    -69.8),
+        SIMDE_FLOAT16_VALUE(   -46.97), SIMDE_FLOAT16_VALUE(    -46.9), SIMDE_FLOAT16_VALUE(   -3.121), SIMDE_FLOAT16_VALUE(    79.56) },
+      { SIMDE_FLOAT16_VALUE(    -18.0), SIMDE_FLOAT16_VALUE(    -89.4), SIMDE_FLOAT16_VALUE(     25.6), SIMDE_FLOAT16_VALUE(    166.2),
+        SIMDE_FLOAT16_VALUE(   -2.781), SIMDE_FLOAT16_VALUE(    139.5), SIMDE_FLOAT16_VALUE(    34.66), SIMDE_FLOAT16_VALUE(   15.625) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128h a = simde_mm_loadu_ph(test_vec[i].a);
+    simde__m128h b = simde_mm_loadu_ph(test_vec[i].b);
+    simde__m128h r = simde_mm_sub_ph(a, b);
+    simde_test_x86_assert_equal_f16x8(r, simde_mm_loadu_ph(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm256_sub_ph (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float16 a[16];
+    const simde_float16 b[16];
+    const simde_float16 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(     87.4), SIMDE_FLOAT16_VALUE(    94.44), SIMDE_FLOAT16_VALUE(   -43.97), SIMDE_FLOAT16_VALUE(    59.72),
+        SIMDE_FLOAT16_VALUE(    19.67), SIMDE_FLOAT16_VALUE(    21.89), SIMDE_FLOAT16_VALUE(    -90.2), SIMDE_FLOAT16_VALUE(    23.31),
+        SIMDE_FLOAT16_VALUE(     75.2), SIMDE_FLOAT16_VALUE(    94.75), SIMDE_FLOAT16_VALUE(    -97.6), SIMDE_FLOAT16_VALUE(    24.06),
+        SIMDE_FLOAT16_VALUE(   -2.205), SIMDE_FLOAT16_VALUE(   13.266), SIMDE_FLOAT16_VALUE(   -49.22), SIMDE_FLOAT16_VALUE(    -34.0) },
+      { SIMDE_FLOAT16_VALUE(     28.3), SIMDE_FLOAT16_VALUE(     99.0), SIMDE_FLOAT16_VALUE(     90.7), SIMDE_FLOAT16_VALUE(    -65.2),
+        SIMDE_FLOAT16_VALUE(   -29.95), SIMDE_FLOAT16_VALUE(   -33.34), SIMDE_FLOAT16_VALUE(   -83.56), SIMDE_FLOAT16_VALUE(   -92.75),
+        SIMDE_FLOAT16_VALUE(    7.805), SIMDE_FLOAT16_VALUE(    -84.3), SIMDE_FLOAT16_VALUE(    -9.63), SIMDE_FLOAT16_VALUE(    37.06),
+        SIMDE_FLOAT16_VALUE(    -78.3), SIMDE_FLOAT16_VALUE(     26.8), SIMDE_FLOAT16_VALUE(   -17.67), SIMDE_FLOAT16_VALUE(   -63.12) },
+      { SIMDE_FLOAT16_VALUE(    59.06), SIMDE_FLOAT16_VALUE(   -4.562), SIMDE_FLOAT16_VALUE(   -134.6), SIMDE_FLOAT16_VALUE(    124.9),
+        SIMDE_FLOAT16_VALUE(    49.62), SIMDE_FLOAT16_VALUE(    55.25), SIMDE_FLOAT16_VALUE(   -6.625), SIMDE_FLOAT16_VALUE(   116.06),
+        SIMDE_FLOAT16_VALUE(     67.4), SIMDE_FLOAT16_VALUE(    179.0), SIMDE_FLOAT16_VALUE(    -88.0), SIMDE_FLOAT16_VALUE(    -13.0),
+        SIMDE_FLOAT16_VALUE(     76.1), SIMDE_FLOAT16_VALUE(   -13.53), SIMDE_FLOAT16_VALUE(   -31.55), SIMDE_FLOAT16_VALUE(    29.12) } },
+    { { SIMDE_FLOAT16_VALUE(     27.7), SIMDE_FLOAT16_VALUE(    -93.0), SIMDE_FLOAT16_VALUE(   -26.67), SIMDE_FLOAT16_VALUE(     57.3),
+        SIMDE_FLOAT16_VALUE(    -98.4), SIMDE_FLOAT16_VALUE(     53.4), SIMDE_FLOAT16_VALUE(     76.0), SIMDE_FLOAT16_VALUE(    21.38),
+        SIMDE_FLOAT16_VALUE(     51.8), SIMDE_FLOAT16_VALUE(   -78.44), SIMDE_FLOAT16_VALUE(    55.84), SIMDE_FLOAT16_VALUE(     93.2),
+        SIMDE_FLOAT16_VALUE(   -47.78), SIMDE_FLOAT16_VALUE(     74.3), SIMDE_FLOAT16_VALUE(    77.25), SIMDE_FLOAT16_VALUE(    48.72) },
+      { SIMDE_FLOAT16_VALUE(   -60.22), SIMDE_FLOAT16_VALUE(    78.75), SIMDE_FLOAT16_VALUE(   -42.44), SIMDE_FLOAT16_VALUE(   -47.22),
+        SIMDE_FLOAT16_VALUE(   -76.25), SIMDE_FLOAT16_VALUE(    76.56), SIMDE_FLOAT16_VALUE(    59.75), SIMDE_FLOAT16_VALUE(     79.7),
+        SIMDE_FLOAT16_VALUE(     26.5), SIMDE_FLOAT16_VALUE(    88.25), SIMDE_FLOAT16_VALUE(    27.69), SIMDE_FLOAT16_VALUE(     69.3),
+        SIMDE_FLOAT16_VALUE(   -14.77), SIMDE_FLOAT16_VALUE(     57.6), SIMDE_FLOAT16_VALUE(    35.53), SIMDE_FLOAT16_VALUE(    6.117) },
+      { SIMDE_FLOAT16_VALUE(    87.94), SIMDE_FLOAT16_VALUE(   -171.8), SIMDE_FLOAT16_VALUE(   15.766), SIMDE_FLOAT16_VALUE(    104.5),
+        SIMDE_FLOAT16_VALUE(   -22.12), SIMDE_FLOAT16_VALUE(   -23.16), SIMDE_FLOAT16_VALUE(    16.25), SIMDE_FLOAT16_VALUE(    -58.3),
+        SIMDE_FLOAT16_VALUE(    25.31), SIMDE_FLOAT16_VALUE(   -166.8), SIMDE_FLOAT16_VALUE(    28.16), SIMDE_FLOAT16_VALUE(    23.88),
+        SIMDE_FLOAT16_VALUE(    -33.0), SIMDE_FLOAT16_VALUE(    16.72), SIMDE_FLOAT16_VALUE(    41.72), SIMDE_FLOAT16_VALUE(     42.6) } },
+    { { SIMDE_FLOAT16_VALUE(   -32.12), SIMDE_FLOAT16_VALUE(    13.72), SIMDE_FLOAT16_VALUE(     54.6), SIMDE_FLOAT16_VALUE(   -30.23),
+        SIMDE_FLOAT16_VALUE(    -90.1), SIMDE_FLOAT16_VALUE(    -41.6), SIMDE_FLOAT16_VALUE(   -8.555), SIMDE_FLOAT16_VALUE(    68.44),
+        SIMDE_FLOAT16_VALUE(    30.95), SIMDE_FLOAT16_VALUE(   -55.22), SIMDE_FLOAT16_VALUE(    69.25), SIMDE_FLOAT16_VALUE(     34.4),
+        SIMDE_FLOAT16_VALUE(    58.47), SIMDE_FLOAT16_VALUE(   -57.47), SIMDE_FLOAT16_VALUE(   -43.28), SIMDE_FLOAT16_VALUE(   -52.94) },
+      { SIMDE_FLOAT16_VALUE(    -72.4), SIMDE_FLOAT16_VALUE(    -5.29), SIMDE_FLOAT16_VALUE(    -89.9), SIMDE_FLOAT16_VALUE(    70.25),
+        SIMDE_FLOAT16_VALUE(     80.1), SIMDE_FLOAT16_VALUE(   -31.16), SIMDE_FLOAT16_VALUE(    -45.3), SIMDE_FLOAT16_VALUE(     8.69),
+        SIMDE_FLOAT16_VALUE(   -27.53), SIMDE_FLOAT16_VALUE(   -58.56), SIMDE_FLOAT16_VALUE(     36.0), SIMDE_FLOAT16_VALUE(   -26.81),
+        SIMDE_FLOAT16_VALUE(    -72.9), SIMDE_FLOAT16_VALUE(     72.5), SIMDE_FLOAT16_VALUE(     92.1), SIMDE_FLOAT16_VALUE(    60.53) },
+      { SIMDE_FLOAT16_VALUE(    40.25), SIMDE_FLOAT16_VALUE(     19.0), SIMDE_FLOAT16_VALUE(    144.5), SIMDE_FLOAT16_VALUE(   -100.5),
+        SIMDE_FLOAT16_VALUE(   -170.2), SIMDE_FLOAT16_VALUE(   -10.44), SIMDE_FLOAT16_VALUE(    36.75), SIMDE_FLOAT16_VALUE(    59.75),
+        SIMDE_FLOAT16_VALUE(     58.5), SIMDE_FLOAT16_VALUE(    3.344), SIMDE_FLOAT16_VALUE(    33.25), SIMDE_FLOAT16_VALUE(    61.22),
+        SIMDE_FLOAT16_VALUE(    131.4), SIMDE_FLOAT16_VALUE(   -130.0), SIMDE_FLOAT16_VALUE(   -135.4), SIMDE_FLOAT16_VALUE(   -113.5) } },
+    { { SIMDE_FLOAT16_VALUE(   -38.06), SIMDE_FLOAT16_VALUE(     29.2), SIMDE_FLOAT16_VALUE(   -38.66), SIMDE_FLOAT16_VALUE(    -60.8),
+        SIMDE_FLOAT16_VALUE(    -79.5), SIMDE_FLOAT16_VALUE(     85.9), SIMDE_FLOAT16_VALUE(    -22.3), SIMDE_FLOAT16_VALUE(   -13.52),
+        SIMDE_FLOAT16_VALUE(    20.64), SIMDE_FLOAT16_VALUE(    73.25), SIMDE_FLOAT16_VALUE(   -12.54), SIMDE_FLOAT16_VALUE(    -92.3),
+        SIMDE_FLOAT16_VALUE(     94.0), SIMDE_FLOAT16_VALUE(     8.36), SIMDE_FLOAT16_VALUE(    62.97), SIMDE_FLOAT16_VALUE(    7.793) },
+      { SIMDE_FLOAT16_VALUE(   -52.22), SIMDE_FLOAT16_VALUE(    36.38), SIMDE_FLOAT16_VALUE(    -13.4), SIMDE_FLOAT16_VALUE(     66.3),
+        SIMDE_FLOAT16_VALUE(   -55.97), SIMDE_FLOAT16_VALUE(    -99.9), SIMDE_FLOAT16_VALUE(   -69.94), SIMDE_FLOAT16_VALUE(     95.3),
+        SIMDE_FLOAT16_VALUE(    61.25), SIMDE_FLOAT16_VALUE(   -10.77), SIMDE_FLOAT16_VALUE(   -48.56), SIMDE_FLOAT16_VALUE(   -100.0),
+        SIMDE_FLOAT16_VALUE(    -47.1), SIMDE_FLOAT16_VALUE(   -40.75), SIMDE_FLOAT16_VALUE(   -27.62), SIMDE_FLOAT16_VALUE(    70.56) },
+      { SIMDE_FLOAT16_VALUE(    14.16), SIMDE_FLOAT16_VALUE(    -7.17), SIMDE_FLOAT16_VALUE(   -25.25), SIMDE_FLOAT16_VALUE(   -127.1),
+        SIMDE_FLOAT16_VALUE(   -23.53), SIMDE_FLOAT16_VALUE(    185.8), SIMDE_FLOAT16_VALUE(    47.62), SIMDE_FLOAT16_VALUE(   -108.8),
+        SIMDE_FLOAT16_VALUE(   -40.62), SIMDE_FLOAT16_VALUE(     84.0), SIMDE_FLOAT16_VALUE(    36.03), SIMDE_FLOAT16_VALUE(    7.688),
+        SIMDE_FLOAT16_VALUE(    141.1), SIMDE_FLOAT16_VALUE(    49.12), SIMDE_FLOAT16_VALUE(     90.6), SIMDE_FLOAT16_VALUE(   -62.78) } },
+    { { SIMDE_FLOAT16_VALUE(    45.03), SIMDE_FLOAT16_VALUE(    22.34), SIMDE_FLOAT16_VALUE(   -36.94), SIMDE_FLOAT16_VALUE(    46.66),
+        SIMDE_FLOAT16_VALUE(   -21.28), SIMDE_FLOAT16_VALUE(    87.94), SIMDE_FLOAT16_VALUE(   -40.44), SIMDE_FLOAT16_VALUE(    7.504),
+        SIMDE_FLOAT16_VALUE(    -97.5), SIMDE_FLOAT16_VALUE(   -85.44), SIMDE_FLOAT16_VALUE(    15.03), SIMDE_FLOAT16_VALUE(    44.06),
+        SIMDE_FLOAT16_VALUE(   -79.06), SIMDE_FLOAT16_VALUE(     92.5), SIMDE_FLOAT16_VALUE(     57.3), SIMDE_FLOAT16_VALUE(    -62.7) },
+      { SIMDE_FLOAT16_VALUE(    16.42), SIMDE_FLOAT16_VALUE(    30.17), SIMDE_FLOAT16_VALUE(   -8.945), SIMDE_FLOAT16_VALUE(    40.47),
+        SIMDE_FLOAT16_VALUE(     34.9), SIMDE_FLOAT16_VALUE(   -32.84), SIMDE_FLOAT16_VALUE(   -95.06), SIMDE_FLOAT16_VALUE(    -47.1),
+        SIMDE_FLOAT16_VALUE(   -27.66), SIMDE_FLOAT16_VALUE(    -17.1), SIMDE_FLOAT16_VALUE(   -2.322), SIMDE_FLOAT16_VALUE(   -3.545),
+        SIMDE_FLOAT16_VALUE(   -63.44), SIMDE_FLOAT16_VALUE(   -62.47), SIMDE_FLOAT16_VALUE(    38.97), SIMDE_FLOAT16_VALUE(    49.34) },
+      { SIMDE_FLOAT16_VALUE(    28.61), SIMDE_FLOAT16_VALUE(    -7.83), SIMDE_FLOAT16_VALUE(    -28.0), SIMDE_FLOAT16_VALUE(    6.188),
+        SIMDE_FLOAT16_VALUE(    -56.2), SIMDE_FLOAT16_VALUE(   120.75), SIMDE_FLOAT16_VALUE(    54.62), SIMDE_FLOAT16_VALUE(     54.6),
+        SIMDE_FLOAT16_VALUE(    -69.9), SIMDE_FLOAT16_VALUE(    -68.4), SIMDE_FLOAT16_VALUE(    17.36), SIMDE_FLOAT16_VALUE(     47.6),
+        SIMDE_FLOAT16_VALUE(  -15.625), SIMDE_FLOAT16_VALUE(    155.0), SIMDE_FLOAT16_VALUE(    18.34), SIMDE_FLOAT16_VALUE(   -112.0) } },
+    { { SIMDE_FLOAT16_VALUE(    -59.8), SIMDE_FLOAT16_VALUE(    84.44), SIMDE_FLOAT16_VALUE(    12.82), SIMDE_FLOAT16_VALUE(    17.75),
+        SIMDE_FLOAT16_VALUE(   -2.258), SIMDE_FLOAT16_VALUE(    -42.1), SIMDE_FLOAT16_VALUE(   -27.52), SIMDE_FLOAT16_VALUE(   -0.624),
+        SIMDE_FLOAT16_VALUE(    88.94), SIMDE_FLOAT16_VALUE(     65.4), SIMDE_FLOAT16_VALUE(     96.3), SIMDE_FLOAT16_VALUE(    40.22),
+        SIMDE_FLOAT16_VALUE(    75.25), SIMDE_FLOAT16_VALUE(    50.16), SIMDE_FLOAT16_VALUE(   -15.03), SIMDE_FLOAT16_VALUE(     73.8) },
+      { SIMDE_FLOAT16_VALUE(   -45.94), SIMDE_FLOAT16_VALUE(   -37.72), SIMDE_FLOAT16_VALUE(    6.145), SIMDE_FLOAT16_VALUE(    62.22),
+        SIMDE_FLOAT16_VALUE(    52.88), SIMDE_FLOAT16_VALUE(    -68.3), SIMDE_FLOAT16_VALUE(    -73.0), SIMDE_FLOAT16_VALUE(   -47.22),
+        SIMDE_FLOAT16_VALUE(    2.732), SIMDE_FLOAT16_VALUE(    15.37), SIMDE_FLOAT16_VALUE(     -8.2), SIMDE_FLOAT16_VALUE(    -88.9),
+        SIMDE_FLOAT16_VALUE(   -38.84), SIMDE_FLOAT16_VALUE(     76.7), SIMDE_FLOAT16_VALUE(    -6.47), SIMDE_FLOAT16_VALUE(    -45.8) },
+      { SIMDE_FLOAT16_VALUE(  -13.875), SIMDE_FLOAT16_VALUE(    122.1), SIMDE_FLOAT16_VALUE(    6.676), SIMDE_FLOAT16_VALUE(   -44.47),
+        SIMDE_FLOAT16_VALUE(   -55.12), SIMDE_FLOAT16_VALUE(    26.22), SIMDE_FLOAT16_VALUE(     45.5), SIMDE_FLOAT16_VALUE(     46.6),
+        SIMDE_FLOAT16_VALUE(     86.2), SIMDE_FLOAT16_VALUE(     50.0), SIMDE_FLOAT16_VALUE(    104.5), SIMDE_FLOAT16_VALUE(    129.1),
+        SIMDE_FLOAT16_VALUE(    114.1), SIMDE_FLOAT16_VALUE(   -26.53), SIMDE_FLOAT16_VALUE(    -8.56), SIMDE_FLOAT16_VALUE(    119.6) } },
+    { { SIMDE_FLOAT16_VALUE(   -85.94), SIMDE_FLOAT16_VALUE(   -97.06), SIMDE_FLOAT16_VALUE(    98.44), SIMDE_FLOAT16_VALUE(   -61.97),
+        SIMDE_FLOAT16_VALUE(     88.2), SIMDE_FLOAT16_VALUE(   -3.338), SIMDE_FLOAT16_VALUE(    -78.8), SIMDE_FLOAT16_VALUE(    -51.1),
+        SIMDE_FLOAT16_VALUE(    -40.8), SIMDE_FLOAT16_VALUE(    29.25), SIMDE_FLOAT16_VALUE(    -93.3), SIMDE_FLOAT16_VALUE(    18.81),
+        SIMDE_FLOAT16_VALUE(   -74.06), SIMDE_FLOAT16_VALUE(    -94.4), SIMDE_FLOAT16_VALUE(    -73.8), SIMDE_FLOAT16_VALUE(    65.94) },
+      { SIMDE_FLOAT16_VALUE(    19.31), SIMDE_FLOAT16_VALUE(    -69.6), SIMDE_FLOAT16_VALUE(    -46.3), SIMDE_FLOAT16_VALUE(     77.1),
+        SIMDE_FLOAT16_VALUE(   -16.94), SIMDE_FLOAT16_VALUE(    53.22), SIMDE_FLOAT16_VALUE(   -22.39), SIMDE_FLOAT16_VALUE(     77.4),
+        SIMDE_FLOAT16_VALUE(    -66.7), SIMDE_FLOAT16_VALUE(   -62.34), SIMDE_FLOAT16_VALUE(   -23.88), SIMDE_FLOAT16_VALUE(     98.0),
+        SIMDE_FLOAT16_VALUE(    -25.5), SIMDE_FLOAT16_VALUE(    -77.4), SIMDE_FLOAT16_VALUE(    17.48), SIMDE_FLOAT16_VALUE(    97.06) },
+      { SIMDE_FLOAT16_VALUE(  -105.25), SIMDE_FLOAT16_VALUE(   -27.44), SIMDE_FLOAT16_VALUE(    144.8), SIMDE_FLOAT16_VALUE(   -139.1),
+        SIMDE_FLOAT16_VALUE(    105.1), SIMDE_FLOAT16_VALUE(   -56.56), SIMDE_FLOAT16_VALUE(   -56.44), SIMDE_FLOAT16_VALUE(   -128.5),
+        SIMDE_FLOAT16_VALUE(    25.88), SIMDE_FLOAT16_VALUE(     91.6), SIMDE_FLOAT16_VALUE(   -69.44), SIMDE_FLOAT16_VALUE(    -79.2),
+        SIMDE_FLOAT16_VALUE(   -48.56), SIMDE_FLOAT16_VALUE(    -17.0), SIMDE_FLOAT16_VALUE(    -91.3), SIMDE_FLOAT16_VALUE(   -31.12) } },
+    { { SIMDE_FLOAT16_VALUE(   -5.676), SIMDE_FLOAT16_VALUE(    53.03), SIMDE_FLOAT16_VALUE(    93.25), SIMDE_FLOAT16_VALUE(    96.06),
+        SIMDE_FLOAT16_VALUE(     91.2), SIMDE_FLOAT16_VALUE(    25.28), SIMDE_FLOAT16_VALUE(    84.44), SIMDE_FLOAT16_VALUE(    18.45),
+        SIMDE_FLOAT16_VALUE(    -23.8), SIMDE_FLOAT16_VALUE(     56.0), SIMDE_FLOAT16_VALUE(    29.88), SIMDE_FLOAT16_VALUE(     69.9),
+        SIMDE_FLOAT16_VALUE(    32.03), SIMDE_FLOAT16_VALUE(    -67.8), SIMDE_FLOAT16_VALUE(   -91.75), SIMDE_FLOAT16_VALUE(     72.2) },
+      { SIMDE_FLOAT16_VALUE(    26.11), SIMDE_FLOAT16_VALUE(   -22.45), SIMDE_FLOAT16_VALUE(    97.56), SIMDE_FLOAT16_VALUE(   -73.25),
+        SIMDE_FLOAT16_VALUE(   -67.56), SIMDE_FLOAT16_VALUE(   -21.52), SIMDE_FLOAT16_VALUE(    -87.1), SIMDE_FLOAT16_VALUE(     14.9),
+        SIMDE_FLOAT16_VALUE(    99.25), SIMDE_FLOAT16_VALUE(    57.78), SIMDE_FLOAT16_VALUE(    -43.9), SIMDE_FLOAT16_VALUE(     73.7),
+        SIMDE_FLOAT16_VALUE(    45.94), SIMDE_FLOAT16_VALUE(    31.98), SIMDE_FLOAT16_VALUE(    62.44), SIMDE_FLOAT16_VALUE(    55.38) },
+      { SIMDE_FLOAT16_VALUE(   -31.78), SIMDE_FLOAT16_VALUE(     75.5), SIMDE_FLOAT16_VALUE(   -4.312), SIMDE_FLOAT16_VALUE(    169.2),
+        SIMDE_FLOAT16_VALUE(    158.8), SIMDE_FLOAT16_VALUE(     46.8), SIMDE_FLOAT16_VALUE(    171.5), SIMDE_FLOAT16_VALUE(    3.555),
+        SIMDE_FLOAT16_VALUE(  -123.06), SIMDE_FLOAT16_VALUE(   -1.781), SIMDE_FLOAT16_VALUE(    73.75), SIMDE_FLOAT16_VALUE(   -3.812),
+        SIMDE_FLOAT16_VALUE(   -13.91), SIMDE_FLOAT16_VALUE(    -99.8), SIMDE_FLOAT16_VALUE(   -154.2), SIMDE_FLOAT16_VALUE(    16.81) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256h a = simde_mm256_loadu_ph(test_vec[i].a);
+    simde__m256h b = simde_mm256_loadu_ph(test_vec[i].b);
+    simde__m256h r = simde_mm256_sub_ph(a, b);
+    simde_test_x86_assert_equal_f16x16(r, simde_mm256_loadu_ph(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
+#if defined(SIMDE_FLOAT16_IS_SCALAR)
+static int
+test_simde_mm512_sub_ph (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float16 a[32];
+    const simde_float16 b[32];
+    const simde_float16 r[32];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(    69.44), SIMDE_FLOAT16_VALUE(    55.03), SIMDE_FLOAT16_VALUE(     86.2), SIMDE_FLOAT16_VALUE(   -19.55),
+        SIMDE_FLOAT16_VALUE(   -49.47), SIMDE_FLOAT16_VALUE(   -33.72), SIMDE_FLOAT16_VALUE(   -28.11), SIMDE_FLOAT16_VALUE(     85.2),
+        SIMDE_FLOAT16_VALUE(     52.2), SIMDE_FLOAT16_VALUE(   -18.11), SIMDE_FLOAT16_VALUE(   -46.75), SIMDE_FLOAT16_VALUE(    46.88),
+        SIMDE_FLOAT16_VALUE(     67.0), SIMDE_FLOAT16_VALUE(   -32.22), SIMDE_FLOAT16_VALUE(    -27.4), SIMDE_FLOAT16_VALUE(    93.56),
+        SIMDE_FLOAT16_VALUE(    22.77), SIMDE_FLOAT16_VALUE(    78.06), SIMDE_FLOAT16_VALUE(    -72.0), SIMDE_FLOAT16_VALUE(  -14.125),
+        SIMDE_FLOAT16_VALUE(    46.28), SIMDE_FLOAT16_VALUE(    38.94), SIMDE_FLOAT16_VALUE(     6.51), SIMDE_FLOAT16_VALUE(   -72.75),
+        SIMDE_FLOAT16_VALUE(   -18.69), SIMDE_FLOAT16_VALUE(     8.72), SIMDE_FLOAT16_VALUE(    61.53), SIMDE_FLOAT16_VALUE(    68.56),
+        SIMDE_FLOAT16_VALUE(   -67.56), SIMDE_FLOAT16_VALUE(    -6.35), SIMDE_FLOAT16_VALUE(    27.66), SIMDE_FLOAT16_VALUE(    -83.5) },
+      { SIMDE_FLOAT16_VALUE(   -15.99), SIMDE_FLOAT16_VALUE(    58.88), SIMDE_FLOAT16_VALUE(    -30.9), SIMDE_FLOAT16_VALUE(     55.4),
+        SIMDE_FLOAT16_VALUE(    -67.7), SIMDE_FLOAT16_VALUE(     65.1), SIMDE_FLOAT16_VALUE(     57.2), SIMDE_FLOAT16_VALUE(    18.81),
+        SIMDE_FLOAT16_VALUE(    -4.12), SIMDE_FLOAT16_VALUE(   -95.94), SIMDE_FLOAT16_VALUE(   -27.06), SIMDE_FLOAT16_VALUE(    -7.93),
+        SIMDE_FLOAT16_VALUE(     22.5), SIMDE_FLOAT16_VALUE(     99.8), SIMDE_FLOAT16_VALUE(    89.56), SIMDE_FLOAT16_VALUE(    24.72),
+        SIMDE_FLOAT16_VALUE(    59.75), SIMDE_FLOAT16_VALUE(   -7.863), SIMDE_FLOAT16_VALUE(     23.0), SIMDE_FLOAT16_VALUE(   -2.613),
+        SIMDE_FLOAT16_VALUE(     2.92), SIMDE_FLOAT16_VALUE(   -60.03), SIMDE_FLOAT16_VALUE(   -27.02), SIMDE_FLOAT16_VALUE(    59.62),
+        SIMDE_FLOAT16_VALUE(    -88.3), SIMDE_FLOAT16_VALUE(     41.6), SIMDE_FLOAT16_VALUE(    -47.6), SIMDE_FLOAT16_VALUE(   -1.381),
+        SIMDE_FLOAT16_VALUE(    78.75), SIMDE_FLOAT16_VALUE(     78.0), SIMDE_FLOAT16_VALUE(    2.988), SIMDE_FLOAT16_VALUE(    -65.3) },
+      { SIMDE_FLOAT16_VALUE(    85.44), SIMDE_FLOAT16_VALUE(   -3.844), SIMDE_FLOAT16_VALUE(    117.1), SIMDE_FLOAT16_VALUE(   -74.94),
+        SIMDE_FLOAT16_VALUE(    18.22), SIMDE_FLOAT16_VALUE(    -98.9), SIMDE_FLOAT16_VALUE(    -85.3), SIMDE_FLOAT16_VALUE(     66.4),
+        SIMDE_FLOAT16_VALUE(     56.3), SIMDE_FLOAT16_VALUE(     77.8), SIMDE_FLOAT16_VALUE(   -19.69), SIMDE_FLOAT16_VALUE(     54.8),
+        SIMDE_FLOAT16_VALUE(     44.5), SIMDE_FLOAT16_VALUE(   -132.0), SIMDE_FLOAT16_VALUE(   -117.0), SIMDE_FLOAT16_VALUE(     68.9),
+        SIMDE_FLOAT16_VALUE(    -37.0), SIMDE_FLOAT16_VALUE(    85.94), SIMDE_FLOAT16_VALUE(    -95.0), SIMDE_FLOAT16_VALUE(  -11.516),
+        SIMDE_FLOAT16_VALUE(    43.38), SIMDE_FLOAT16_VALUE(     99.0), SIMDE_FLOAT16_VALUE(    33.53), SIMDE_FLOAT16_VALUE(   -132.4),
+        SIMDE_FLOAT16_VALUE(     69.6), SIMDE_FLOAT16_VALUE(   -32.88), SIMDE_FLOAT16_VALUE(    109.1), SIMDE_FLOAT16_VALUE(    69.94),
+        SIMDE_FLOAT16_VALUE(   -146.2), SIMDE_FLOAT16_VALUE(    -84.4), SIMDE_FLOAT16_VALUE(    24.67), SIMDE_FLOAT16_VALUE(   -18.19) } },
+    { { SIMDE_FLOAT16_VALUE(    25.17), SIMDE_FLOAT16_VALUE(    70.25), SIMDE_FLOAT16_VALUE(   -1.841), SIMDE_FLOAT16_VALUE(    25.95),
+        SIMDE_FLOAT16_VALUE(     49.8), SIMDE_FLOAT16_VALUE(    -83.4), SIMDE_FLOAT16_VALUE(    30.83), SIMDE_FLOAT16_VALUE(    -40.7),
+        SIMDE_FLOAT16_VALUE(     69.1), SIMDE_FLOAT16_VALUE(    -80.8), SIMDE_FLOAT16_VALUE(    -55.7), SIMDE_FLOAT16_VALUE(     46.4),
+        SIMDE_FLOAT16_VALUE(    -63.2), SIMDE_FLOAT16_VALUE(    21.47), SIMDE_FLOAT16_VALUE(   -10.98), SIMDE_FLOAT16_VALUE(   -38.88),
+        SIMDE_FLOAT16_VALUE(     40.2), SIMDE_FLOAT16_VALUE(   -30.02), SIMDE_FLOAT16_VALUE(   -32.03), SIMDE_FLOAT16_VALUE(   -23.19),
+        SIMDE_FLOAT16_VALUE(    -70.4), SIMDE_FLOAT16_VALUE(     67.0), SIMDE_FLOAT16_VALUE(   -17.47), SIMDE_FLOAT16_VALUE(    91.06),
+        SIMDE_FLOAT16_VALUE(    23.34), SIMDE_FLOAT16_VALUE(   -34.66), SIMDE_FLOAT16_VALUE(     65.5), SIMDE_FLOAT16_VALUE(     7.62),
+        SIMDE_FLOAT16_VALUE(   -56.44), SIMDE_FLOAT16_VALUE(    -70.4), SIMDE_FLOAT16_VALUE(    67.56), SIMDE_FLOAT16_VALUE(   -18.19) },
+      { SIMDE_FLOAT16_VALUE(     73.8), SIMDE_FLOAT16_VALUE(    25.08), SIMDE_FLOAT16_VALUE(     92.2), SIMDE_FLOAT16_VALUE(    2.463),
+        SIMDE_FLOAT16_VALUE(   -99.06), SIMDE_FLOAT16_VALUE(    -55.4), SIMDE_FLOAT16_VALUE(   -5.863), SIMDE_FLOAT16_VALUE(    22.22),
+        SIMDE_FLOAT16_VALUE(    -40.9), SIMDE_FLOAT16_VALUE(     92.8), SIMDE_FLOAT16_VALUE(     59.9), SIMDE_FLOAT16_VALUE(   -19.64),
+        SIMDE_FLOAT16_VALUE(    54.72), SIMDE_FLOAT16_VALUE(    77.25), SIMDE_FLOAT16_VALUE(   -93.44), SIMDE_FLOAT16_VALUE(    -8.29),
+        SIMDE_FLOAT16_VALUE(   -7.125), SIMDE_FLOAT16_VALUE(    24.42), SIMDE_FLOAT16_VALUE(    13.18), SIMDE_FLOAT16_VALUE(     99.9),
+        SIMDE_FLOAT16_VALUE(   -1.538), SIMDE_FLOAT16_VALUE(    70.94), SIMDE_FLOAT16_VALUE(    11.24), SIMDE_FLOAT16_VALUE(     78.7),
+        SIMDE_FLOAT16_VALUE(    -92.4), SIMDE_FLOAT16_VALUE(    -77.0), SIMDE_FLOAT16_VALUE(     56.6), SIMDE_FLOAT16_VALUE(   -22.58),
+        SIMDE_FLOAT16_VALUE(     5.09), SIMDE_FLOAT16_VALUE(    -99.0), SIMDE_FLOAT16_VALUE(     73.3), SIMDE_FLOAT16_VALUE(     86.5) },
+      { SIMDE_FLOAT16_VALUE(   -48.62), SIMDE_FLOAT16_VALUE(     45.2), SIMDE_FLOAT16_VALUE(    -94.0), SIMDE_FLOAT16_VALUE(    23.48),
+        SIMDE_FLOAT16_VALUE(    148.9), SIMDE_FLOAT16_VALUE(   -27.97), SIMDE_FLOAT16_VALUE(     36.7), SIMDE_FLOAT16_VALUE(    -62.9),
+        SIMDE_FLOAT16_VALUE(    110.0), SIMDE_FLOAT16_VALUE(   -173.6), SIMDE_FLOAT16_VALUE(   -115.6), SIMDE_FLOAT16_VALUE(    66.06),
+        SIMDE_FLOAT16_VALUE(   -117.9), SIMDE_FLOAT16_VALUE(   -55.78), SIMDE_FLOAT16_VALUE(    82.44), SIMDE_FLOAT16_VALUE(    -30.6),
+        SIMDE_FLOAT16_VALUE(     47.3), SIMDE_FLOAT16_VALUE(   -54.44), SIMDE_FLOAT16_VALUE(   -45.22), SIMDE_FLOAT16_VALUE(  -123.06),
+        SIMDE_FLOAT16_VALUE(    -68.8), SIMDE_FLOAT16_VALUE(   -3.938), SIMDE_FLOAT16_VALUE(   -28.72), SIMDE_FLOAT16_VALUE(   12.375),
+        SIMDE_FLOAT16_VALUE(   115.75), SIMDE_FLOAT16_VALUE(    42.34), SIMDE_FLOAT16_VALUE(     8.91), SIMDE_FLOAT16_VALUE(     30.2),
+        SIMDE_FLOAT16_VALUE(   -61.53), SIMDE_FLOAT16_VALUE(    28.62), SIMDE_FLOAT16_VALUE(    -5.75), SIMDE_FLOAT16_VALUE(   -104.7) } },
+    { { SIMDE_FLOAT16_VALUE(   -97.56), SIMDE_FLOAT16_VALUE(    -9.91), SIMDE_FLOAT16_VALUE(    15.14), SIMDE_FLOAT16_VALUE(   -45.53),
+        SIMDE_FLOAT16_VALUE(    -94.1), SIMDE_FLOAT16_VALUE(    89.56), SIMDE_FLOAT16_VALUE(    70.75), SIMDE_FLOAT16_VALUE(    -58.1),
+        SIMDE_FLOAT16_VALUE(    92.56), SIMDE_FLOAT16_VALUE(    26.25), SIMDE_FLOAT16_VALUE(     33.2), SIMDE_FLOAT16_VALUE(    -35.1),
+        SIMDE_FLOAT16_VALUE(     51.1), SIMDE_FLOAT16_VALUE(    -99.4), SIMDE_FLOAT16_VALUE(    92.56), SIMDE_FLOAT16_VALUE(   -80.44),
+        SIMDE_FLOAT16_VALUE(   -20.62), SIMDE_FLOAT16_VALUE(   -23.62), SIMDE_FLOAT16_VALUE(    -35.2), SIMDE_FLOAT16_VALUE(    49.62),
+        SIMDE_FLOAT16_VALUE(   12.484), SIMDE_FLOAT16_VALUE(    -66.2), SIMDE_FLOAT16_VALUE(    -86.7), SIMDE_FLOAT16_VALUE(    42.28),
+        SIMDE_FLOAT16_VALUE(   -52.34), SIMDE_FLOAT16_VALUE(    -81.7), SIMDE_FLOAT16_VALUE(    41.34), SIMDE_FLOAT16_VALUE(     49.6),
+        SIMDE_FLOAT16_VALUE(    85.56), SIMDE_FLOAT16_VALUE(   -1.039), SIMDE_FLOAT16_VALUE(     78.9), SIMDE_FLOAT16_VALUE(     45.6) },
+      { SIMDE_FLOAT16_VALUE(   -11.92), SIMDE_FLOAT16_VALUE(    -18.5), SIMDE_FLOAT16_VALUE(    17.61), SIMDE_FLOAT16_VALUE(     40.4),
+        SIMDE_FLOAT16_VALUE(     93.0), SIMDE_FLOAT16_VALUE(    61.53), SIMDE_FLOAT16_VALUE(   -2.012), SIMDE_FLOAT16_VALUE(     89.4),
+        SIMDE_FLOAT16_VALUE(     40.4), SIMDE_FLOAT16_VALUE(   -52.38), SIMDE_FLOAT16_VALUE(   -17.08), SIMDE_FLOAT16_VALUE(    -43.7),
+        SIMDE_FLOAT16_VALUE(    -87.4), SIMDE_FLOAT16_VALUE(   -62.06), SIMDE_FLOAT16_VALUE(    2.305), SIMDE_FLOAT16_VALUE(    1.348),
+        SIMDE_FLOAT16_VALUE(    3.725), SIMDE_FLOAT16_VALUE(     40.7), SIMDE_FLOAT16_VALUE(     45.0), SIMDE_FLOAT16_VALUE(   -35.38),
+        SIMDE_FLOAT16_VALUE(   -21.86), SIMDE_FLOAT16_VALUE(    90.94), SIMDE_FLOAT16_VALUE(    -59.6), SIMDE_FLOAT16_VALUE(   -22.95),
+        SIMDE_FLOAT16_VALUE(   -40.97), SIMDE_FLOAT16_VALUE(   -82.44), SIMDE_FLOAT16_VALUE(    -42.8), SIMDE_FLOAT16_VALUE(    36.12),
+        SIMDE_FLOAT16_VALUE(    36.22), SIMDE_FLOAT16_VALUE(   -25.28), SIMDE_FLOAT16_VALUE(   -17.25), SIMDE_FLOAT16_VALUE(   -20.55) },
+      { SIMDE_FLOAT16_VALUE(    -85.6), SIMDE_FLOAT16_VALUE(     8.59), SIMDE_FLOAT16_VALUE(   -2.469), SIMDE_FLOAT16_VALUE(   -85.94),
+        SIMDE_FLOAT16_VALUE(   -187.1), SIMDE_FLOAT16_VALUE(    28.03), SIMDE_FLOAT16_VALUE(    72.75), SIMDE_FLOAT16_VALUE(   -147.5),
+        SIMDE_FLOAT16_VALUE(    52.16), SIMDE_FLOAT16_VALUE(     78.6), SIMDE_FLOAT16_VALUE(    50.25), SIMDE_FLOAT16_VALUE(     8.59),
+        SIMDE_FLOAT16_VALUE(    138.5), SIMDE_FLOAT16_VALUE(    -37.3), SIMDE_FLOAT16_VALUE(    90.25), SIMDE_FLOAT16_VALUE(    -81.8),
+        SIMDE_FLOAT16_VALUE(   -24.34), SIMDE_FLOAT16_VALUE(    -64.3), SIMDE_FLOAT16_VALUE(    -80.2), SIMDE_FLOAT16_VALUE(     85.0),
+        SIMDE_FLOAT16_VALUE(    34.34), SIMDE_FLOAT16_VALUE(   -157.1), SIMDE_FLOAT16_VALUE(    -27.1), SIMDE_FLOAT16_VALUE(    65.25),
+        SIMDE_FLOAT16_VALUE(  -11.375), SIMDE_FLOAT16_VALUE(     0.75), SIMDE_FLOAT16_VALUE(     84.1), SIMDE_FLOAT16_VALUE(    13.47),
+        SIMDE_FLOAT16_VALUE(    49.34), SIMDE_FLOAT16_VALUE(    24.25), SIMDE_FLOAT16_VALUE(     96.1), SIMDE_FLOAT16_VALUE(     66.1) } },
+    { { SIMDE_FLOAT16_VALUE(   -13.65), SIMDE_FLOAT16_VALUE(    -59.3), SIMDE_FLOAT16_VALUE(     80.4), SIMDE_FLOAT16_VALUE(   -17.27),
+        SIMDE_FLOAT16_VALUE(    3.207), SIMDE_FLOAT16_VALUE(   -30.44), SIMDE_FLOAT16_VALUE(    -68.3), SIMDE_FLOAT16_VALUE(   -24.44),
+        SIMDE_FLOAT16_VALUE(    29.42), SIMDE_FLOAT16_VALUE(   -60.22), SIMDE_FLOAT16_VALUE(    -92.6), SIMDE_FLOAT16_VALUE(   -35.44),
+        SIMDE_FLOAT16_VALUE(    -33.3), SIMDE_FLOAT16_VALUE(   -47.75), SIMDE_FLOAT16_VALUE(     98.8), SIMDE_FLOAT16_VALUE(   -11.61),
+        SIMDE_FLOAT16_VALUE(   -27.69), SIMDE_FLOAT16_VALUE(   -78.25), SIMDE_FLOAT16_VALUE(     65.3), SIMDE_FLOAT16_VALUE(    -90.0),
+        SIMDE_FLOAT16_VALUE(   -53.97), SIMDE_FLOAT16_VALUE(     55.9), SIMDE_FLOAT16_VALUE(   -62.06), SIMDE_FLOAT16_VALUE(    19.34),
+        SIMDE_FLOAT16_VALUE(     87.5), SIMDE_FLOAT16_VALUE(   -35.47), SIMDE_FLOAT16_VALUE(     8.73), SIMDE_FLOAT16_VALUE(     53.8),
+        SIMDE_FLOAT16_VALUE(   -17.39), SIMDE_FLOAT16_VALUE(     65.1), SIMDE_FLOAT16_VALUE(    67.94), SIMDE_FLOAT16_VALUE(    24.89) },
+      { SIMDE_FLOAT16_VALUE(    -69.9), SIMDE_FLOAT16_VALUE(    16.16), SIMDE_FLOAT16_VALUE(   -43.56), SIMDE_FLOAT16_VALUE(    -87.3),
+        SIMDE_FLOAT16_VALUE(    28.25), SIMDE_FLOAT16_VALUE(     43.9), SIMDE_FLOAT16_VALUE(     67.0), SIMDE_FLOAT16_VALUE(    -55.0),
+        SIMDE_FLOAT16_VALUE(     59.1), SIMDE_FLOAT16_VALUE(    27.77), SIMDE_FLOAT16_VALUE(    -37.9), SIMDE_FLOAT16_VALUE(    10.73),
+        SIMDE_FLOAT16_VALUE(    5.285), SIMDE_FLOAT16_VALUE(    -27.5), SIMDE_FLOAT16_VALUE(     24.8), SIMDE_FLOAT16_VALUE(   -57.25),
+        SIMDE_FLOAT16_VALUE(   -29.84), SIMDE_FLOAT16_VALUE(    56.56), SIMDE_FLOAT16_VALUE(   -22.19), SIMDE_FLOAT16_VALUE(     56.7),
+        SIMDE_FLOAT16_VALUE(   -71.25), SIMDE_FLOAT16_VALUE(     4.65), SIMDE_FLOAT16_VALUE(    0.146), SIMDE_FLOAT16_VALUE(     18.9),
+        SIMDE_FLOAT16_VALUE(    39.72), SIMDE_FLOAT16_VALUE(    49.66), SIMDE_FLOAT16_VALUE(    -19.2), SIMDE_FLOAT16_VALUE(   -80.25),
+        SIMDE_FLOAT16_VALUE(    64.06), SIMDE_FLOAT16_VALUE(   -24.03), SIMDE_FLOAT16_VALUE(   -57.34), SIMDE_FLOAT16_VALUE(   -61.53) },
+      { SIMDE_FLOAT16_VALUE(    56.22), SIMDE_FLOAT16_VALUE(    -75.5), SIMDE_FLOAT16_VALUE(   123.94), SIMDE_FLOAT16_VALUE(    70.06),
+        SIMDE_FLOAT16_VALUE(   -25.05), SIMDE_FLOAT16_VALUE(    -74.4), SIMDE_FLOAT16_VALUE(   -135.2), SIMDE_FLOAT16_VALUE(    30.56),
+        SIMDE_FLOAT16_VALUE(   -29.67), SIMDE_FLOAT16_VALUE(    -88.0), SIMDE_FLOAT16_VALUE(   -54.72), SIMDE_FLOAT16_VALUE(   -46.16),
+        SIMDE_FLOAT16_VALUE(    -38.6), SIMDE_FLOAT16_VALUE(   -20.25), SIMDE_FLOAT16_VALUE(     74.0), SIMDE_FLOAT16_VALUE(    45.62),
+        SIMDE_FLOAT16_VALUE(    2.156), SIMDE_FLOAT16_VALUE(   -134.8), SIMDE_FLOAT16_VALUE(     87.5), SIMDE_FLOAT16_VALUE(   -146.8),
+        SIMDE_FLOAT16_VALUE(    17.28), SIMDE_FLOAT16_VALUE(    51.25), SIMDE_FLOAT16_VALUE(   -62.22), SIMDE_FLOAT16_VALUE(   0.4375),
+        SIMDE_FLOAT16_VALUE(    47.78), SIMDE_FLOAT16_VALUE(    -85.1), SIMDE_FLOAT16_VALUE(    27.94), SIMDE_FLOAT16_VALUE(    134.0),
+        SIMDE_FLOAT16_VALUE(   -81.44), SIMDE_FLOAT16_VALUE(     89.1), SIMDE_FLOAT16_VALUE(   125.25), SIMDE_FLOAT16_VALUE(    86.44) } },
+    { { SIMDE_FLOAT16_VALUE(   -44.12), SIMDE_FLOAT16_VALUE(     8.11), SIMDE_FLOAT16_VALUE(   -81.06), SIMDE_FLOAT16_VALUE(    63.84),
+        SIMDE_FLOAT16_VALUE(   12.336), SIMDE_FLOAT16_VALUE(     31.8), SIMDE_FLOAT16_VALUE(   -90.94), SIMDE_FLOAT16_VALUE(    -76.4),
+        SIMDE_FLOAT16_VALUE(    99.25), SIMDE_FLOAT16_VALUE(    75.06), SIMDE_FLOAT16_VALUE(    16.22), SIMDE_FLOAT16_VALUE(    -99.2),
+        SIMDE_FLOAT16_VALUE(    -97.0), SIMDE_FLOAT16_VALUE(     51.3), SIMDE_FLOAT16_VALUE(   -45.34), SIMDE_FLOAT16_VALUE(   -81.44),
+        SIMDE_FLOAT16_VALUE(     36.3), SIMDE_FLOAT16_VALUE(   -56.56), SIMDE_FLOAT16_VALUE(    -77.9), SIMDE_FLOAT16_VALUE(    38.75),
+        SIMDE_FLOAT16_VALUE(     9.82), SIMDE_FLOAT16_VALUE(    -65.7), SIMDE_FLOAT16_VALUE(    48.47), SIMDE_FLOAT16_VALUE(   -45.38),
+        SIMDE_FLOAT16_VALUE(   -30.22), SIMDE_FLOAT16_VALUE(     97.1), SIMDE_FLOAT16_VALUE(   -56.34), SIMDE_FLOAT16_VALUE(   -11.32),
+        SIMDE_FLOAT16_VALUE(    -44.4), SIMDE_FLOAT16_VALUE(   -54.28), SIMDE_FLOAT16_VALUE(    60.78), SIMDE_FLOAT16_VALUE(   -59.88) },
+      { SIMDE_FLOAT16_VALUE(   -84.75), SIMDE_FLOAT16_VALUE(    10.57), SIMDE_FLOAT16_VALUE(     49.4), SIMDE_FLOAT16_VALUE(  -0.5273),
+        SIMDE_FLOAT16_VALUE(    58.72), SIMDE_FLOAT16_VALUE(    51.53), SIMDE_FLOAT16_VALUE(     57.3), SIMDE_FLOAT16_VALUE(   -98.06),
+        SIMDE_FLOAT16_VALUE(    59.25), SIMDE_FLOAT16_VALUE(    5.734), SIMDE_FLOAT16_VALUE(   -0.566), SIMDE_FLOAT16_VALUE(     98.7),
+        SIMDE_FLOAT16_VALUE(    12.88), SIMDE_FLOAT16_VALUE(     76.0), SIMDE_FLOAT16_VALUE(    72.06), SIMDE_FLOAT16_VALUE(    -54.0),
+        SIMDE_FLOAT16_VALUE(    -98.9), SIMDE_FLOAT16_VALUE(     38.1), SIMDE_FLOAT16_VALUE(    -79.6), SIMDE_FLOAT16_VALUE(   -79.75),
+        SIMDE_FLOAT16_VALUE(     84.8), SIMDE_FLOAT16_VALUE(     89.3), SIMDE_FLOAT16_VALUE(    -9.84), SIMDE_FLOAT16_VALUE(    17.67),
+        SIMDE_FLOAT16_VALUE(   -36.25), SIMDE_FLOAT16_VALUE(     79.7), SIMDE_FLOAT16_VALUE(    24.19), SIMDE_FLOAT16_VALUE(     37.5),
+        SIMDE_FLOAT16_VALUE(    24.05), SIMDE_FLOAT16_VALUE(     48.3), SIMDE_FLOAT16_VALUE(    -81.7), SIMDE_FLOAT16_VALUE(   -33.97) },
+      { SIMDE_FLOAT16_VALUE(    40.62), SIMDE_FLOAT16_VALUE(    -2.46), SIMDE_FLOAT16_VALUE(   -130.5), SIMDE_FLOAT16_VALUE(     64.4),
+        SIMDE_FLOAT16_VALUE(   -46.38), SIMDE_FLOAT16_VALUE(   -19.73), SIMDE_FLOAT16_VALUE(   -148.2), SIMDE_FLOAT16_VALUE(    21.69),
+        SIMDE_FLOAT16_VALUE(     40.0), SIMDE_FLOAT16_VALUE(     69.3), SIMDE_FLOAT16_VALUE(    16.78), SIMDE_FLOAT16_VALUE(   -197.9),
+        SIMDE_FLOAT16_VALUE(   -109.9), SIMDE_FLOAT16_VALUE(   -24.69), SIMDE_FLOAT16_VALUE(   -117.4), SIMDE_FLOAT16_VALUE(   -27.44),
+        SIMDE_FLOAT16_VALUE(    135.2), SIMDE_FLOAT16_VALUE(    -94.6), SIMDE_FLOAT16_VALUE(     1.75), SIMDE_FLOAT16_VALUE(    118.5),
+        SIMDE_FLOAT16_VALUE(    -75.0), SIMDE_FLOAT16_VALUE(   -155.0), SIMDE_FLOAT16_VALUE(     58.3), SIMDE_FLOAT16_VALUE(   -63.06),
+        SIMDE_FLOAT16_VALUE(     6.03), SIMDE_FLOAT16_VALUE(    17.44), SIMDE_FLOAT16_VALUE(    -80.5), SIMDE_FLOAT16_VALUE(    -48.8),
+        SIMDE_FLOAT16_VALUE(   -68.44), SIMDE_FLOAT16_VALUE(   -102.6), SIMDE_FLOAT16_VALUE(    142.5), SIMDE_FLOAT16_VALUE(    -25.9) } },
+    { { SIMDE_FLOAT16_VALUE(   -25.44), SIMDE_FLOAT16_VALUE(   -64.94), SIMDE_FLOAT16_VALUE(    29.06), SIMDE_FLOAT16_VALUE(    13.15),
+        SIMDE_FLOAT16_VALUE(    41.34), SIMDE_FLOAT16_VALUE(    -89.7), SIMDE_FLOAT16_VALUE(     80.3), SIMDE_FLOAT16_VALUE(    -48.8),
+        SIMDE_FLOAT16_VALUE(    60.62), SIMDE_FLOAT16_VALUE(   0.1805), SIMDE_FLOAT16_VALUE(    17.75), SIMDE_FLOAT16_VALUE(     81.3),
+        SIMDE_FLOAT16_VALUE(    -81.5), SIMDE_FLOAT16_VALUE(     58.4), SIMDE_FLOAT16_VALUE(   -72.75), SIMDE_FLOAT16_VALUE(    -75.5),
+        SIMDE_FLOAT16_VALUE(   -63.16), SIMDE_FLOAT16_VALUE(  -0.2058), SIMDE_FLOAT16_VALUE(     34.3), SIMDE_FLOAT16_VALUE(    10.84),
+        SIMDE_FLOAT16_VALUE(   -40.75), SIMDE_FLOAT16_VALUE(     67.9), SIMDE_FLOAT16_VALUE(     69.3), SIMDE_FLOAT16_VALUE(     62.0),
+        SIMDE_FLOAT16_VALUE(    -67.5), SIMDE_FLOAT16_VALUE(    -58.6), SIMDE_FLOAT16_VALUE(    -58.3), SIMDE_FLOAT16_VALUE(    28.38),
+        SIMDE_FLOAT16_VALUE(    40.75), SIMDE_FLOAT16_VALUE(    61.47), SIMDE_FLOAT16_VALUE(     66.8), SIMDE_FLOAT16_VALUE(    10.25) },
+      { SIMDE_FLOAT16_VALUE(    -67.2), SIMDE_FLOAT16_VALUE(     67.3), SIMDE_FLOAT16_VALUE(    -4.77), SIMDE_FLOAT16_VALUE(   -32.34),
+        SIMDE_FLOAT16_VALUE(    -48.8), SIMDE_FLOAT16_VALUE(    70.25), SIMDE_FLOAT16_VALUE(   -91.94), SIMDE_FLOAT16_VALUE(   11.266),
+        SIMDE_FLOAT16_VALUE(   -58.16), SIMDE_FLOAT16_VALUE(     78.7), SIMDE_FLOAT16_VALUE(    -64.3), SIMDE_FLOAT16_VALUE(    67.06),
+        SIMDE_FLOAT16_VALUE(    -93.6), SIMDE_FLOAT16_VALUE(    99.44), SIMDE_FLOAT16_VALUE(    35.53), SIMDE_FLOAT16_VALUE(    -33.3),
+        SIMDE_FLOAT16_VALUE(   -11.09), SIMDE_FLOAT16_VALUE(   -32.38), SIMDE_FLOAT16_VALUE(   -39.16), SIMDE_FLOAT16_VALUE(    31.69),
+        SIMDE_FLOAT16_VALUE(   -0.216), SIMDE_FLOAT16_VALUE(   15.016), SIMDE_FLOAT16_VALUE(   -57.47), SIMDE_FLOAT16_VALUE(    53.28),
+        SIMDE_FLOAT16_VALUE(    13.91), SIMDE_FLOAT16_VALUE(    -86.6), SIMDE_FLOAT16_VALUE(    67.06), SIMDE_FLOAT16_VALUE(   -3.723),
+        SIMDE_FLOAT16_VALUE(    3.164), SIMDE_FLOAT16_VALUE(    51.66), SIMDE_FLOAT16_VALUE(     93.7), SIMDE_FLOAT16_VALUE(    -79.1) },
+      { SIMDE_FLOAT16_VALUE(    41.75), SIMDE_FLOAT16_VALUE(   -132.2), SIMDE_FLOAT16_VALUE(    33.84), SIMDE_FLOAT16_VALUE(     45.5),
+        SIMDE_FLOAT16_VALUE(     90.1), SIMDE_FLOAT16_VALUE(   -160.0), SIMDE_FLOAT16_VALUE(    172.2), SIMDE_FLOAT16_VALUE(   -60.06),
+        SIMDE_FLOAT16_VALUE(   118.75), SIMDE_FLOAT16_VALUE(    -78.5), SIMDE_FLOAT16_VALUE(    82.06), SIMDE_FLOAT16_VALUE(    14.25),
+        SIMDE_FLOAT16_VALUE(   12.125), SIMDE_FLOAT16_VALUE(   -41.03), SIMDE_FLOAT16_VALUE(  -108.25), SIMDE_FLOAT16_VALUE(    -42.2),
+        SIMDE_FLOAT16_VALUE(   -52.06), SIMDE_FLOAT16_VALUE(    32.16), SIMDE_FLOAT16_VALUE(     73.5), SIMDE_FLOAT16_VALUE(   -20.84),
+        SIMDE_FLOAT16_VALUE(   -40.53), SIMDE_FLOAT16_VALUE(    52.88), SIMDE_FLOAT16_VALUE(   126.75), SIMDE_FLOAT16_VALUE(     8.72),
+        SIMDE_FLOAT16_VALUE(    -81.4), SIMDE_FLOAT16_VALUE(    28.03), SIMDE_FLOAT16_VALUE(   -125.4), SIMDE_FLOAT16_VALUE(     32.1),
+        SIMDE_FLOAT16_VALUE(     37.6), SIMDE_FLOAT16_VALUE(     9.81), SIMDE_FLOAT16_VALUE(   -26.88), SIMDE_FLOAT16_VALUE(     89.4) } },
+    { { SIMDE_FLOAT16_VALUE(   -25.34), SIMDE_FLOAT16_VALUE(     68.2), SIMDE_FLOAT16_VALUE(   -27.44), SIMDE_FLOAT16_VALUE(   -26.94),
+        SIMDE_FLOAT16_VALUE(     81.2), SIMDE_FLOAT16_VALUE(   -67.75), SIMDE_FLOAT16_VALUE(    -64.6), SIMDE_FLOAT16_VALUE(    -97.8),
+        SIMDE_FLOAT16_VALUE(    -73.6), SIMDE_FLOAT16_VALUE(    7.375), SIMDE_FLOAT16_VALUE(    48.16), SIMDE_FLOAT16_VALUE(     9.32),
+        SIMDE_FLOAT16_VALUE(    51.28), SIMDE_FLOAT16_VALUE(    -60.3), SIMDE_FLOAT16_VALUE(    -71.6), SIMDE_FLOAT16_VALUE(   -70.06),
+        SIMDE_FLOAT16_VALUE(    -51.1), SIMDE_FLOAT16_VALUE(    -7.23), SIMDE_FLOAT16_VALUE(   -39.25), SIMDE_FLOAT16_VALUE(    36.97),
+        SIMDE_FLOAT16_VALUE(    36.28), SIMDE_FLOAT16_VALUE(    71.44), SIMDE_FLOAT16_VALUE(   -70.06), SIMDE_FLOAT16_VALUE(   -57.97),
+        SIMDE_FLOAT16_VALUE(    66.75), SIMDE_FLOAT16_VALUE(   -34.03), SIMDE_FLOAT16_VALUE(    82.56), SIMDE_FLOAT16_VALUE(   -48.16),
+        SIMDE_FLOAT16_VALUE(    29.72), SIMDE_FLOAT16_VALUE(    -85.7), SIMDE_FLOAT16_VALUE(   -16.56), SIMDE_FLOAT16_VALUE(    27.02) },
+      { SIMDE_FLOAT16_VALUE(     19.8), SIMDE_FLOAT16_VALUE(   -10.96), SIMDE_FLOAT16_VALUE(    35.78), SIMDE_FLOAT16_VALUE(   -32.84),
+        SIMDE_FLOAT16_VALUE(     48.9), SIMDE_FLOAT16_VALUE(    40.72), SIMDE_FLOAT16_VALUE(    26.98), SIMDE_FLOAT16_VALUE(   -30.19),
+        SIMDE_FLOAT16_VALUE(   -35.03), SIMDE_FLOAT16_VALUE(   -17.61), SIMDE_FLOAT16_VALUE(    74.25), SIMDE_FLOAT16_VALUE(    63.47),
+        SIMDE_FLOAT16_VALUE(     93.8), SIMDE_FLOAT16_VALUE(     27.7), SIMDE_FLOAT16_VALUE(   -70.75), SIMDE_FLOAT16_VALUE(     88.3),
+        SIMDE_FLOAT16_VALUE(   -33.94), SIMDE_FLOAT16_VALUE(    14.58), SIMDE_FLOAT16_VALUE(     99.9), SIMDE_FLOAT16_VALUE(    -79.5),
+        SIMDE_FLOAT16_VALUE(     65.3), SIMDE_FLOAT16_VALUE(     90.9), SIMDE_FLOAT16_VALUE(    -8.34), SIMDE_FLOAT16_VALUE(    -79.0),
+        SIMDE_FLOAT16_VALUE(   -62.22), SIMDE_FLOAT16_VALUE(    -68.5), SIMDE_FLOAT16_VALUE(     81.6), SIMDE_FLOAT16_VALUE(   -9.266),
+        SIMDE_FLOAT16_VALUE(    46.06), SIMDE_FLOAT16_VALUE(    5.934), SIMDE_FLOAT16_VALUE(   -14.59), SIMDE_FLOAT16_VALUE(     67.1) },
+      { SIMDE_FLOAT16_VALUE(   -45.12), SIMDE_FLOAT16_VALUE(     79.1), SIMDE_FLOAT16_VALUE(   -63.22), SIMDE_FLOAT16_VALUE(    5.906),
+        SIMDE_FLOAT16_VALUE(    32.28), SIMDE_FLOAT16_VALUE(   -108.5), SIMDE_FLOAT16_VALUE(    -91.6), SIMDE_FLOAT16_VALUE(    -67.6),
+        SIMDE_FLOAT16_VALUE(    -38.6), SIMDE_FLOAT16_VALUE(    24.98), SIMDE_FLOAT16_VALUE(    -26.1), SIMDE_FLOAT16_VALUE(   -54.16),
+        SIMDE_FLOAT16_VALUE(   -42.53), SIMDE_FLOAT16_VALUE(    -88.0), SIMDE_FLOAT16_VALUE(   -0.875), SIMDE_FLOAT16_VALUE(   -158.4),
+        SIMDE_FLOAT16_VALUE(   -17.16), SIMDE_FLOAT16_VALUE(   -21.81), SIMDE_FLOAT16_VALUE(   -139.1), SIMDE_FLOAT16_VALUE(    116.5),
+        SIMDE_FLOAT16_VALUE(   -29.03), SIMDE_FLOAT16_VALUE(   -19.44), SIMDE_FLOAT16_VALUE(   -61.72), SIMDE_FLOAT16_VALUE(    21.03),
+        SIMDE_FLOAT16_VALUE(    129.0), SIMDE_FLOAT16_VALUE(    34.47), SIMDE_FLOAT16_VALUE(   0.9375), SIMDE_FLOAT16_VALUE(   -38.88),
+        SIMDE_FLOAT16_VALUE(   -16.34), SIMDE_FLOAT16_VALUE(    -91.6), SIMDE_FLOAT16_VALUE(   -1.969), SIMDE_FLOAT16_VALUE(   -40.12) } },
+    { { SIMDE_FLOAT16_VALUE(   -27.94), SIMDE_FLOAT16_VALUE(   -52.38), SIMDE_FLOAT16_VALUE(    52.16), SIMDE_FLOAT16_VALUE(    50.16),
+        SIMDE_FLOAT16_VALUE(   -15.68), SIMDE_FLOAT16_VALUE(    -66.0), SIMDE_FLOAT16_VALUE(    -79.8), SIMDE_FLOAT16_VALUE(     73.9),
+        SIMDE_FLOAT16_VALUE(   -40.28), SIMDE_FLOAT16_VALUE(    -27.6), SIMDE_FLOAT16_VALUE(    -52.5), SIMDE_FLOAT16_VALUE(    33.56),
+        SIMDE_FLOAT16_VALUE(   -2.275), SIMDE_FLOAT16_VALUE(    99.06), SIMDE_FLOAT16_VALUE(     64.9), SIMDE_FLOAT16_VALUE(    -9.24),
+        SIMDE_FLOAT16_VALUE(  -0.2135), SIMDE_FLOAT16_VALUE(    -73.6), SIMDE_FLOAT16_VALUE(   -14.47), SIMDE_FLOAT16_VALUE(     6.36),
+        SIMDE_FLOAT16_VALUE(   -29.69), SIMDE_FLOAT16_VALUE(   -31.16), SIMDE_FLOAT16_VALUE(    1.993), SIMDE_FLOAT16_VALUE(    11.19),
+        SIMDE_FLOAT16_VALUE(   -21.72), SIMDE_FLOAT16_VALUE(   -61.22), SIMDE_FLOAT16_VALUE(     87.8), SIMDE_FLOAT16_VALUE(   -57.03),
+        SIMDE_FLOAT16_VALUE(   -48.06), SIMDE_FLOAT16_VALUE(    -84.6), SIMDE_FLOAT16_VALUE(    26.12), SIMDE_FLOAT16_VALUE(    25.45) },
+      { SIMDE_FLOAT16_VALUE(   -46.84), SIMDE_FLOAT16_VALUE(   -58.28), SIMDE_FLOAT16_VALUE(     82.4), SIMDE_FLOAT16_VALUE(    -8.82),
+        SIMDE_FLOAT16_VALUE(   -99.75), SIMDE_FLOAT16_VALUE(     34.7), SIMDE_FLOAT16_VALUE(   -5.207), SIMDE_FLOAT16_VALUE(   -12.13),
+        SIMDE_FLOAT16_VALUE(    62.44), SIMDE_FLOAT16_VALUE(    87.75), SIMDE_FLOAT16_VALUE(   -45.22), SIMDE_FLOAT16_VALUE(    -76.8),
+        SIMDE_FLOAT16_VALUE(   -23.75), SIMDE_FLOAT16_VALUE(     92.6), SIMDE_FLOAT16_VALUE(     91.4), SIMDE_FLOAT16_VALUE(   -45.84),
+        SIMDE_FLOAT16_VALUE(    53.34), SIMDE_FLOAT16_VALUE(     47.6), SIMDE_FLOAT16_VALUE(   -87.25), SIMDE_FLOAT16_VALUE(   -96.56),
+        SIMDE_FLOAT16_VALUE(    -47.4), SIMDE_FLOAT16_VALUE(    -6.07), SIMDE_FLOAT16_VALUE(    62.12), SIMDE_FLOAT16_VALUE(    -18.7),
+        SIMDE_FLOAT16_VALUE(    -99.9), SIMDE_FLOAT16_VALUE(   -33.12), SIMDE_FLOAT16_VALUE(     4.26), SIMDE_FLOAT16_VALUE(     99.2),
+        SIMDE_FLOAT16_VALUE(    87.94), SIMDE_FLOAT16_VALUE(   -72.06), SIMDE_FLOAT16_VALUE(    -92.4), SIMDE_FLOAT16_VALUE(    31.52) },
+      { SIMDE_FLOAT16_VALUE(     18.9), SIMDE_FLOAT16_VALUE(    5.906), SIMDE_FLOAT16_VALUE(   -30.22), SIMDE_FLOAT16_VALUE(    58.97),
+        SIMDE_FLOAT16_VALUE(    84.06), SIMDE_FLOAT16_VALUE(   -100.7), SIMDE_FLOAT16_VALUE(    -74.6), SIMDE_FLOAT16_VALUE(     86.0),
+        SIMDE_FLOAT16_VALUE(  -102.75), SIMDE_FLOAT16_VALUE(   -115.4), SIMDE_FLOAT16_VALUE(    -7.28), SIMDE_FLOAT16_VALUE(    110.4),
+        SIMDE_FLOAT16_VALUE(    21.47), SIMDE_FLOAT16_VALUE(    6.438), SIMDE_FLOAT16_VALUE(    -26.5), SIMDE_FLOAT16_VALUE(     36.6),
+        SIMDE_FLOAT16_VALUE(   -53.56), SIMDE_FLOAT16_VALUE(  -121.25), SIMDE_FLOAT16_VALUE(    72.75), SIMDE_FLOAT16_VALUE(   102.94),
+        SIMDE_FLOAT16_VALUE(    17.72), SIMDE_FLOAT16_VALUE(    -25.1), SIMDE_FLOAT16_VALUE(   -60.12), SIMDE_FLOAT16_VALUE(    29.89),
+        SIMDE_FLOAT16_VALUE(     78.1), SIMDE_FLOAT16_VALUE(    -28.1), SIMDE_FLOAT16_VALUE(    83.56), SIMDE_FLOAT16_VALUE(   -156.2),
+        SIMDE_FLOAT16_VALUE(   -136.0), SIMDE_FLOAT16_VALUE(   -12.56), SIMDE_FLOAT16_VALUE(    118.5), SIMDE_FLOAT16_VALUE(   -6.062) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512h a = simde_mm512_loadu_ph(test_vec[i].a);
+    simde__m512h b = simde_mm512_loadu_ph(test_vec[i].b);
+    simde__m512h r = simde_mm512_sub_ph(a, b);
+    simde_test_x86_assert_equal_f16x32(r, simde_mm512_loadu_ph(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+#endif
+
 SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_sub_epi8)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_sub_epi8)
@@ -3173,6 +3572,12 @@ SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_sub_pd)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_sub_pd)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_sub_pd)
+
+  #if defined(SIMDE_FLOAT16_IS_SCALAR)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm_sub_ph)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm256_sub_ph)
+    SIMDE_TEST_FUNC_LIST_ENTRY(mm512_sub_ph)
+  #endif
 SIMDE_TEST_FUNC_LIST_END
 
 #include <test/x86/avx512/test-avx512-footer.h>
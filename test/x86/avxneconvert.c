@@ -0,0 +1,452 @@
+/* MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#define SIMDE_TESTS_CURRENT_ISAX avxneconvert
+#include <simde/x86/avxneconvert.h>
+#include <test/x86/test-avx.h>
+
+static int
+test_simde_mm_bcstnebf16_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint16_t a;
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { UINT16_C(17203),
+      { SIMDE_FLOAT32_C(   179.00), SIMDE_FLOAT32_C(   179.00), SIMDE_FLOAT32_C(   179.00), SIMDE_FLOAT32_C(   179.00) } },
+    { UINT16_C(50238),
+      { SIMDE_FLOAT32_C(  -760.00), SIMDE_FLOAT32_C(  -760.00), SIMDE_FLOAT32_C(  -760.00), SIMDE_FLOAT32_C(  -760.00) } },
+    { UINT16_C(49972),
+      { SIMDE_FLOAT32_C(  -180.00), SIMDE_FLOAT32_C(  -180.00), SIMDE_FLOAT32_C(  -180.00), SIMDE_FLOAT32_C(  -180.00) } },
+    { UINT16_C(17378),
+      { SIMDE_FLOAT32_C(   452.00), SIMDE_FLOAT32_C(   452.00), SIMDE_FLOAT32_C(   452.00), SIMDE_FLOAT32_C(   452.00) } },
+    { UINT16_C(50293),
+      { SIMDE_FLOAT32_C(  -980.00), SIMDE_FLOAT32_C(  -980.00), SIMDE_FLOAT32_C(  -980.00), SIMDE_FLOAT32_C(  -980.00) } },
+    { UINT16_C(17433),
+      { SIMDE_FLOAT32_C(   612.00), SIMDE_FLOAT32_C(   612.00), SIMDE_FLOAT32_C(   612.00), SIMDE_FLOAT32_C(   612.00) } },
+    { UINT16_C(49853),
+      { SIMDE_FLOAT32_C(   -94.50), SIMDE_FLOAT32_C(   -94.50), SIMDE_FLOAT32_C(   -94.50), SIMDE_FLOAT32_C(   -94.50) } },
+    { UINT16_C(49950),
+      { SIMDE_FLOAT32_C(  -158.00), SIMDE_FLOAT32_C(  -158.00), SIMDE_FLOAT32_C(  -158.00), SIMDE_FLOAT32_C(  -158.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_bfloat16 a = simde_uint16_as_bfloat16(test_vec[i].a);
+    simde__m128 r = simde_mm_bcstnebf16_ps(&a);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_bfloat16 a = simde_mm_cvtness_sbh(simde_test_codegen_random_f32(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0)));
+    simde__m128 r = simde_mm_bcstnebf16_ps(&a);
+
+    simde_test_codegen_write_u16(2, simde_bfloat16_as_uint16(a), SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST, 1);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_bcstnebf16_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint16_t a;
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { UINT16_C(50055),
+      { SIMDE_FLOAT32_C(  -270.00), SIMDE_FLOAT32_C(  -270.00), SIMDE_FLOAT32_C(  -270.00), SIMDE_FLOAT32_C(  -270.00),
+        SIMDE_FLOAT32_C(  -270.00), SIMDE_FLOAT32_C(  -270.00), SIMDE_FLOAT32_C(  -270.00), SIMDE_FLOAT32_C(  -270.00) } },
+    { UINT16_C(50286),
+      { SIMDE_FLOAT32_C(  -952.00), SIMDE_FLOAT32_C(  -952.00), SIMDE_FLOAT32_C(  -952.00), SIMDE_FLOAT32_C(  -952.00),
+        SIMDE_FLOAT32_C(  -952.00), SIMDE_FLOAT32_C(  -952.00), SIMDE_FLOAT32_C(  -952.00), SIMDE_FLOAT32_C(  -952.00) } },
+    { UINT16_C(16903),
+      { SIMDE_FLOAT32_C(    33.75), SIMDE_FLOAT32_C(    33.75), SIMDE_FLOAT32_C(    33.75), SIMDE_FLOAT32_C(    33.75),
+        SIMDE_FLOAT32_C(    33.75), SIMDE_FLOAT32_C(    33.75), SIMDE_FLOAT32_C(    33.75), SIMDE_FLOAT32_C(    33.75) } },
+    { UINT16_C(50230),
+      { SIMDE_FLOAT32_C(  -728.00), SIMDE_FLOAT32_C(  -728.00), SIMDE_FLOAT32_C(  -728.00), SIMDE_FLOAT32_C(  -728.00),
+        SIMDE_FLOAT32_C(  -728.00), SIMDE_FLOAT32_C(  -728.00), SIMDE_FLOAT32_C(  -728.00), SIMDE_FLOAT32_C(  -728.00) } },
+    { UINT16_C(17415),
+      { SIMDE_FLOAT32_C(   540.00), SIMDE_FLOAT32_C(   540.00), SIMDE_FLOAT32_C(   540.00), SIMDE_FLOAT32_C(   540.00),
+        SIMDE_FLOAT32_C(   540.00), SIMDE_FLOAT32_C(   540.00), SIMDE_FLOAT32_C(   540.00), SIMDE_FLOAT32_C(   540.00) } },
+    { UINT16_C(17496),
+      { SIMDE_FLOAT32_C(   864.00), SIMDE_FLOAT32_C(   864.00), SIMDE_FLOAT32_C(   864.00), SIMDE_FLOAT32_C(   864.00),
+        SIMDE_FLOAT32_C(   864.00), SIMDE_FLOAT32_C(   864.00), SIMDE_FLOAT32_C(   864.00), SIMDE_FLOAT32_C(   864.00) } },
+    { UINT16_C(17193),
+      { SIMDE_FLOAT32_C(   169.00), SIMDE_FLOAT32_C(   169.00), SIMDE_FLOAT32_C(   169.00), SIMDE_FLOAT32_C(   169.00),
+        SIMDE_FLOAT32_C(   169.00), SIMDE_FLOAT32_C(   169.00), SIMDE_FLOAT32_C(   169.00), SIMDE_FLOAT32_C(   169.00) } },
+    { UINT16_C(17295),
+      { SIMDE_FLOAT32_C(   286.00), SIMDE_FLOAT32_C(   286.00), SIMDE_FLOAT32_C(   286.00), SIMDE_FLOAT32_C(   286.00),
+        SIMDE_FLOAT32_C(   286.00), SIMDE_FLOAT32_C(   286.00), SIMDE_FLOAT32_C(   286.00), SIMDE_FLOAT32_C(   286.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_bfloat16 a = simde_uint16_as_bfloat16(test_vec[i].a);
+    simde__m256 r = simde_mm256_bcstnebf16_ps(&a);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_bfloat16 a = simde_mm_cvtness_sbh(simde_test_codegen_random_f32(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0)));
+    simde__m256 r = simde_mm256_bcstnebf16_ps(&a);
+
+    simde_test_codegen_write_u16(2, simde_bfloat16_as_uint16(a), SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x8(2, r, SIMDE_TEST_VEC_POS_LAST, 1);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_cvtneebf16_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint16_t a[8];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { UINT16_C(50063), UINT16_C(17429), UINT16_C(17285), UINT16_C(49551), UINT16_C(50203), UINT16_C(50126), UINT16_C(17042), UINT16_C(17441) },
+      { SIMDE_FLOAT32_C(  -286.00), SIMDE_FLOAT32_C(   266.00), SIMDE_FLOAT32_C(  -620.00), SIMDE_FLOAT32_C(    73.00) } },
+    { { UINT16_C(50042), UINT16_C(17224), UINT16_C(49736), UINT16_C(50181), UINT16_C(50185), UINT16_C(17413), UINT16_C(17449), UINT16_C(49961) },
+      { SIMDE_FLOAT32_C(  -250.00), SIMDE_FLOAT32_C(   -50.00), SIMDE_FLOAT32_C(  -548.00), SIMDE_FLOAT32_C(   676.00) } },
+    { { UINT16_C(17304), UINT16_C(17437), UINT16_C(17039), UINT16_C(50271), UINT16_C(50032), UINT16_C(50192), UINT16_C(50186), UINT16_C(50189) },
+      { SIMDE_FLOAT32_C(   304.00), SIMDE_FLOAT32_C(    71.50), SIMDE_FLOAT32_C(  -240.00), SIMDE_FLOAT32_C(  -552.00) } },
+    { { UINT16_C(49957), UINT16_C(17502), UINT16_C(50196), UINT16_C(17168), UINT16_C(17433), UINT16_C(17405), UINT16_C(16760), UINT16_C(50173) },
+      { SIMDE_FLOAT32_C(  -165.00), SIMDE_FLOAT32_C(  -592.00), SIMDE_FLOAT32_C(   612.00), SIMDE_FLOAT32_C(    15.50) } },
+    { { UINT16_C(17495), UINT16_C(50069), UINT16_C(17507), UINT16_C(50193), UINT16_C(17426), UINT16_C(17360), UINT16_C(17514), UINT16_C(17178) },
+      { SIMDE_FLOAT32_C(   860.00), SIMDE_FLOAT32_C(   908.00), SIMDE_FLOAT32_C(   584.00), SIMDE_FLOAT32_C(   936.00) } },
+    { { UINT16_C(50050), UINT16_C(17429), UINT16_C(17384), UINT16_C(16761), UINT16_C(16677), UINT16_C(49974), UINT16_C(17341), UINT16_C(17318) },
+      { SIMDE_FLOAT32_C(  -260.00), SIMDE_FLOAT32_C(   464.00), SIMDE_FLOAT32_C(    10.31), SIMDE_FLOAT32_C(   378.00) } },
+    { { UINT16_C(17306), UINT16_C(50181), UINT16_C(50260), UINT16_C(50096), UINT16_C(17319), UINT16_C(50121), UINT16_C(49759), UINT16_C(49665) },
+      { SIMDE_FLOAT32_C(   308.00), SIMDE_FLOAT32_C(  -848.00), SIMDE_FLOAT32_C(   334.00), SIMDE_FLOAT32_C(   -55.75) } },
+    { { UINT16_C(17421), UINT16_C(50081), UINT16_C(50286), UINT16_C(49473), UINT16_C(50026), UINT16_C(17421), UINT16_C(17409), UINT16_C(50201) },
+      { SIMDE_FLOAT32_C(   564.00), SIMDE_FLOAT32_C(  -952.00), SIMDE_FLOAT32_C(  -234.00), SIMDE_FLOAT32_C(   516.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128bh a = simde_x_mm_castsi128_pbh(simde_mm_loadu_epi16(test_vec[i].a));
+    simde__m128 r = simde_mm_cvtneebf16_ps(&a);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m128bh a = simde_mm_cvtneps_pbh(simde_test_x86_random_f32x4(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0)));
+    simde__m128 r = simde_mm_cvtneebf16_ps(&a);
+
+    simde_test_x86_write_u16x8(2, simde_x_mm_castpbh_si128(a), SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST, 1);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_cvtneebf16_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint16_t a[16];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { { UINT16_C(17314), UINT16_C(50125), UINT16_C(17360), UINT16_C(17436), UINT16_C(17099), UINT16_C(49596), UINT16_C(17382), UINT16_C(50153),
+        UINT16_C(17529), UINT16_C(50009), UINT16_C(49520), UINT16_C(17325), UINT16_C(50253), UINT16_C(50185), UINT16_C(17481), UINT16_C(49838) },
+      { SIMDE_FLOAT32_C(   324.00), SIMDE_FLOAT32_C(   416.00), SIMDE_FLOAT32_C(   101.50), SIMDE_FLOAT32_C(   460.00),
+        SIMDE_FLOAT32_C(   996.00), SIMDE_FLOAT32_C(   -15.00), SIMDE_FLOAT32_C(  -820.00), SIMDE_FLOAT32_C(   804.00) } },
+    { { UINT16_C(50264), UINT16_C(17496), UINT16_C(17456), UINT16_C(17248), UINT16_C(49746), UINT16_C(17204), UINT16_C(50077), UINT16_C(17422),
+        UINT16_C(50051), UINT16_C(50234), UINT16_C(49852), UINT16_C(49885), UINT16_C(17192), UINT16_C(49974), UINT16_C(17446), UINT16_C(17255) },
+      { SIMDE_FLOAT32_C(  -864.00), SIMDE_FLOAT32_C(   704.00), SIMDE_FLOAT32_C(   -52.50), SIMDE_FLOAT32_C(  -314.00),
+        SIMDE_FLOAT32_C(  -262.00), SIMDE_FLOAT32_C(   -94.00), SIMDE_FLOAT32_C(   168.00), SIMDE_FLOAT32_C(   664.00) } },
+    { { UINT16_C(17467), UINT16_C(17390), UINT16_C(50121), UINT16_C(17496), UINT16_C(17415), UINT16_C(50082), UINT16_C(50291), UINT16_C(17473),
+        UINT16_C(50293), UINT16_C(17494), UINT16_C(16956), UINT16_C(17426), UINT16_C(50171), UINT16_C(50190), UINT16_C(50175), UINT16_C(17425) },
+      { SIMDE_FLOAT32_C(   748.00), SIMDE_FLOAT32_C(  -402.00), SIMDE_FLOAT32_C(   540.00), SIMDE_FLOAT32_C(  -972.00),
+        SIMDE_FLOAT32_C(  -980.00), SIMDE_FLOAT32_C(    47.00), SIMDE_FLOAT32_C(  -502.00), SIMDE_FLOAT32_C(  -510.00) } },
+    { { UINT16_C(50175), UINT16_C(17482), UINT16_C(50130), UINT16_C(50075), UINT16_C(49785), UINT16_C(50242), UINT16_C(50129), UINT16_C(50252),
+        UINT16_C(50242), UINT16_C(50258), UINT16_C(17467), UINT16_C(49982), UINT16_C(16775), UINT16_C(50146), UINT16_C(17354), UINT16_C(50171) },
+      { SIMDE_FLOAT32_C(  -510.00), SIMDE_FLOAT32_C(  -420.00), SIMDE_FLOAT32_C(   -62.25), SIMDE_FLOAT32_C(  -418.00),
+        SIMDE_FLOAT32_C(  -776.00), SIMDE_FLOAT32_C(   748.00), SIMDE_FLOAT32_C(    16.88), SIMDE_FLOAT32_C(   404.00) } },
+    { { UINT16_C(17428), UINT16_C(50024), UINT16_C(16669), UINT16_C(17198), UINT16_C(50073), UINT16_C(50251), UINT16_C(49688), UINT16_C(17430),
+        UINT16_C(17400), UINT16_C(50051), UINT16_C(17394), UINT16_C(50079), UINT16_C(50279), UINT16_C(17488), UINT16_C(50191), UINT16_C(17293) },
+      { SIMDE_FLOAT32_C(   592.00), SIMDE_FLOAT32_C(     9.81), SIMDE_FLOAT32_C(  -306.00), SIMDE_FLOAT32_C(   -38.00),
+        SIMDE_FLOAT32_C(   496.00), SIMDE_FLOAT32_C(   484.00), SIMDE_FLOAT32_C(  -924.00), SIMDE_FLOAT32_C(  -572.00) } },
+    { { UINT16_C(50216), UINT16_C(50053), UINT16_C(17356), UINT16_C(50171), UINT16_C(50272), UINT16_C(17255), UINT16_C(50167), UINT16_C(17470),
+        UINT16_C(17432), UINT16_C(16442), UINT16_C(50256), UINT16_C(17501), UINT16_C(50201), UINT16_C(50089), UINT16_C(17468), UINT16_C(17035) },
+      { SIMDE_FLOAT32_C(  -672.00), SIMDE_FLOAT32_C(   408.00), SIMDE_FLOAT32_C(  -896.00), SIMDE_FLOAT32_C(  -494.00),
+        SIMDE_FLOAT32_C(   608.00), SIMDE_FLOAT32_C(  -832.00), SIMDE_FLOAT32_C(  -612.00), SIMDE_FLOAT32_C(   752.00) } },
+    { { UINT16_C(50252), UINT16_C(50217), UINT16_C(49761), UINT16_C(17365), UINT16_C(17339), UINT16_C(50182), UINT16_C(50221), UINT16_C(49974),
+        UINT16_C(49995), UINT16_C(50056), UINT16_C(17323), UINT16_C(17170), UINT16_C(17489), UINT16_C(17312), UINT16_C(50263), UINT16_C(16906) },
+      { SIMDE_FLOAT32_C(  -816.00), SIMDE_FLOAT32_C(   -56.25), SIMDE_FLOAT32_C(   374.00), SIMDE_FLOAT32_C(  -692.00),
+        SIMDE_FLOAT32_C(  -203.00), SIMDE_FLOAT32_C(   342.00), SIMDE_FLOAT32_C(   836.00), SIMDE_FLOAT32_C(  -860.00) } },
+    { { UINT16_C(50193), UINT16_C(17411), UINT16_C(17287), UINT16_C(17450), UINT16_C(17457), UINT16_C(49826), UINT16_C(50070), UINT16_C(17404),
+        UINT16_C(50275), UINT16_C(17170), UINT16_C(17073), UINT16_C(16959), UINT16_C(50218), UINT16_C(17239), UINT16_C(17475), UINT16_C(17303) },
+      { SIMDE_FLOAT32_C(  -580.00), SIMDE_FLOAT32_C(   270.00), SIMDE_FLOAT32_C(   708.00), SIMDE_FLOAT32_C(  -300.00),
+        SIMDE_FLOAT32_C(  -908.00), SIMDE_FLOAT32_C(    88.50), SIMDE_FLOAT32_C(  -680.00), SIMDE_FLOAT32_C(   780.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256bh a = simde_x_mm256_castsi256_pbh(simde_mm256_loadu_epi16(test_vec[i].a));
+    simde__m256 r = simde_mm256_cvtneebf16_ps(&a);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m256bh a = simde_mm512_cvtneps_pbh(simde_test_x86_random_f32x16(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0)));
+    simde__m256 r = simde_mm256_cvtneebf16_ps(&a);
+
+    simde_test_x86_write_u16x16(2, simde_x_mm256_castpbh_si256(a), SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x8(2, r, SIMDE_TEST_VEC_POS_LAST, 1);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_cvtneobf16_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint16_t a[8];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { UINT16_C(17413), UINT16_C(17452), UINT16_C(49993), UINT16_C(17289), UINT16_C(17413), UINT16_C(49788), UINT16_C(50270), UINT16_C(50066) },
+      { SIMDE_FLOAT32_C(   688.00), SIMDE_FLOAT32_C(   274.00), SIMDE_FLOAT32_C(   -63.00), SIMDE_FLOAT32_C(  -292.00) } },
+    { { UINT16_C(17527), UINT16_C(17326), UINT16_C(17346), UINT16_C(50159), UINT16_C(17238), UINT16_C(50112), UINT16_C(50143), UINT16_C(49961) },
+      { SIMDE_FLOAT32_C(   348.00), SIMDE_FLOAT32_C(  -478.00), SIMDE_FLOAT32_C(  -384.00), SIMDE_FLOAT32_C(  -169.00) } },
+    { { UINT16_C(17396), UINT16_C(49992), UINT16_C(17477), UINT16_C(17329), UINT16_C(17179), UINT16_C(17356), UINT16_C(17284), UINT16_C(50266) },
+      { SIMDE_FLOAT32_C(  -200.00), SIMDE_FLOAT32_C(   354.00), SIMDE_FLOAT32_C(   408.00), SIMDE_FLOAT32_C(  -872.00) } },
+    { { UINT16_C(17298), UINT16_C(50172), UINT16_C(50024), UINT16_C(50054), UINT16_C(50282), UINT16_C(50187), UINT16_C(17485), UINT16_C(17491) },
+      { SIMDE_FLOAT32_C(  -504.00), SIMDE_FLOAT32_C(  -268.00), SIMDE_FLOAT32_C(  -556.00), SIMDE_FLOAT32_C(   844.00) } },
+    { { UINT16_C(17518), UINT16_C(17214), UINT16_C(17521), UINT16_C(17455), UINT16_C(49964), UINT16_C(16943), UINT16_C(17469), UINT16_C(50232) },
+      { SIMDE_FLOAT32_C(   190.00), SIMDE_FLOAT32_C(   700.00), SIMDE_FLOAT32_C(    43.75), SIMDE_FLOAT32_C(  -736.00) } },
+    { { UINT16_C(50154), UINT16_C(17289), UINT16_C(17479), UINT16_C(49904), UINT16_C(50126), UINT16_C(49995), UINT16_C(17438), UINT16_C(50237) },
+      { SIMDE_FLOAT32_C(   274.00), SIMDE_FLOAT32_C(  -120.00), SIMDE_FLOAT32_C(  -203.00), SIMDE_FLOAT32_C(  -756.00) } },
+    { { UINT16_C(17373), UINT16_C(49766), UINT16_C(17333), UINT16_C(17294), UINT16_C(17338), UINT16_C(50270), UINT16_C(50182), UINT16_C(17520) },
+      { SIMDE_FLOAT32_C(   -57.50), SIMDE_FLOAT32_C(   284.00), SIMDE_FLOAT32_C(  -888.00), SIMDE_FLOAT32_C(   960.00) } },
+    { { UINT16_C(50182), UINT16_C(50162), UINT16_C(17091), UINT16_C(50208), UINT16_C(50213), UINT16_C(16938), UINT16_C(50281), UINT16_C(17458) },
+      { SIMDE_FLOAT32_C(  -484.00), SIMDE_FLOAT32_C(  -640.00), SIMDE_FLOAT32_C(    42.50), SIMDE_FLOAT32_C(   712.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128bh a = simde_x_mm_castsi128_pbh(simde_mm_loadu_epi16(test_vec[i].a));
+    simde__m128 r = simde_mm_cvtneobf16_ps(&a);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m128bh a = simde_mm_cvtneps_pbh(simde_test_x86_random_f32x4(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0)));
+    simde__m128 r = simde_mm_cvtneobf16_ps(&a);
+
+    simde_test_x86_write_u16x8(2, simde_x_mm_castpbh_si128(a), SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x4(2, r, SIMDE_TEST_VEC_POS_LAST, 1);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_cvtneobf16_ps (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint16_t a[16];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { { UINT16_C(17438), UINT16_C(50210), UINT16_C(17474), UINT16_C(50218), UINT16_C(49851), UINT16_C(49666), UINT16_C(50280), UINT16_C(50089),
+        UINT16_C(17495), UINT16_C(17220), UINT16_C(50225), UINT16_C(17428), UINT16_C(50243), UINT16_C(49972), UINT16_C(50232), UINT16_C(50242) },
+      { SIMDE_FLOAT32_C(  -648.00), SIMDE_FLOAT32_C(  -680.00), SIMDE_FLOAT32_C(   -32.50), SIMDE_FLOAT32_C(  -338.00),
+        SIMDE_FLOAT32_C(   196.00), SIMDE_FLOAT32_C(   592.00), SIMDE_FLOAT32_C(  -180.00), SIMDE_FLOAT32_C(  -776.00) } },
+    { { UINT16_C(17351), UINT16_C(50085), UINT16_C(50204), UINT16_C(17353), UINT16_C(50226), UINT16_C(17486), UINT16_C(17525), UINT16_C(17407),
+        UINT16_C(17441), UINT16_C(50258), UINT16_C(17469), UINT16_C(50217), UINT16_C(16676), UINT16_C(17441), UINT16_C(17476), UINT16_C(17135) },
+      { SIMDE_FLOAT32_C(  -330.00), SIMDE_FLOAT32_C(   402.00), SIMDE_FLOAT32_C(   824.00), SIMDE_FLOAT32_C(   510.00),
+        SIMDE_FLOAT32_C(  -840.00), SIMDE_FLOAT32_C(  -676.00), SIMDE_FLOAT32_C(   644.00), SIMDE_FLOAT32_C(   119.50) } },
+    { { UINT16_C(17451), UINT16_C(17510), UINT16_C(50018), UINT16_C(17375), UINT16_C(50238), UINT16_C(50051), UINT16_C(50089), UINT16_C(50049),
+        UINT16_C(17350), UINT16_C(49798), UINT16_C(50227), UINT16_C(17520), UINT16_C(50277), UINT16_C(17404), UINT16_C(50112), UINT16_C(17309) },
+      { SIMDE_FLOAT32_C(   920.00), SIMDE_FLOAT32_C(   446.00), SIMDE_FLOAT32_C(  -262.00), SIMDE_FLOAT32_C(  -258.00),
+        SIMDE_FLOAT32_C(   -67.00), SIMDE_FLOAT32_C(   960.00), SIMDE_FLOAT32_C(   504.00), SIMDE_FLOAT32_C(   314.00) } },
+    { { UINT16_C(50069), UINT16_C(50269), UINT16_C(50258), UINT16_C(17511), UINT16_C(17367), UINT16_C(50215), UINT16_C(17362), UINT16_C(50227),
+        UINT16_C(50037), UINT16_C(50249), UINT16_C(50285), UINT16_C(17400), UINT16_C(50200), UINT16_C(17343), UINT16_C(49929), UINT16_C(17027) },
+      { SIMDE_FLOAT32_C(  -884.00), SIMDE_FLOAT32_C(   924.00), SIMDE_FLOAT32_C(  -668.00), SIMDE_FLOAT32_C(  -716.00),
+        SIMDE_FLOAT32_C(  -804.00), SIMDE_FLOAT32_C(   496.00), SIMDE_FLOAT32_C(   382.00), SIMDE_FLOAT32_C(    65.50) } },
+    { { UINT16_C(50292), UINT16_C(50224), UINT16_C(50187), UINT16_C(49990), UINT16_C(17476), UINT16_C(17493), UINT16_C(17350), UINT16_C(50219),
+        UINT16_C(17425), UINT16_C(17352), UINT16_C(17438), UINT16_C(50293), UINT16_C(17473), UINT16_C(50238), UINT16_C(17365), UINT16_C(17394) },
+      { SIMDE_FLOAT32_C(  -704.00), SIMDE_FLOAT32_C(  -198.00), SIMDE_FLOAT32_C(   852.00), SIMDE_FLOAT32_C(  -684.00),
+        SIMDE_FLOAT32_C(   400.00), SIMDE_FLOAT32_C(  -980.00), SIMDE_FLOAT32_C(  -760.00), SIMDE_FLOAT32_C(   484.00) } },
+    { { UINT16_C(17042), UINT16_C(17237), UINT16_C(50186), UINT16_C(17441), UINT16_C(50260), UINT16_C(50043), UINT16_C(16960), UINT16_C(16965),
+        UINT16_C(17506), UINT16_C(50072), UINT16_C(49893), UINT16_C(50203), UINT16_C(17515), UINT16_C(17465), UINT16_C(17310), UINT16_C(50162) },
+      { SIMDE_FLOAT32_C(   213.00), SIMDE_FLOAT32_C(   644.00), SIMDE_FLOAT32_C(  -251.00), SIMDE_FLOAT32_C(    49.25),
+        SIMDE_FLOAT32_C(  -304.00), SIMDE_FLOAT32_C(  -620.00), SIMDE_FLOAT32_C(   740.00), SIMDE_FLOAT32_C(  -484.00) } },
+    { { UINT16_C(17472), UINT16_C(50206), UINT16_C(50093), UINT16_C(50176), UINT16_C(50104), UINT16_C(17450), UINT16_C(50285), UINT16_C(17419),
+        UINT16_C(49789), UINT16_C(50110), UINT16_C(17457), UINT16_C(50168), UINT16_C(50071), UINT16_C(17511), UINT16_C(17249), UINT16_C(50271) },
+      { SIMDE_FLOAT32_C(  -632.00), SIMDE_FLOAT32_C(  -512.00), SIMDE_FLOAT32_C(   680.00), SIMDE_FLOAT32_C(   556.00),
+        SIMDE_FLOAT32_C(  -380.00), SIMDE_FLOAT32_C(  -496.00), SIMDE_FLOAT32_C(   924.00), SIMDE_FLOAT32_C(  -892.00) } },
+    { { UINT16_C(49883), UINT16_C(50250), UINT16_C(49796), UINT16_C(17216), UINT16_C(17437), UINT16_C(49770), UINT16_C(50242), UINT16_C(17359),
+        UINT16_C(50221), UINT16_C(17405), UINT16_C(50092), UINT16_C(49922), UINT16_C(17487), UINT16_C(17426), UINT16_C(49788), UINT16_C(50252) },
+      { SIMDE_FLOAT32_C(  -808.00), SIMDE_FLOAT32_C(   192.00), SIMDE_FLOAT32_C(   -58.50), SIMDE_FLOAT32_C(   414.00),
+        SIMDE_FLOAT32_C(   506.00), SIMDE_FLOAT32_C(  -130.00), SIMDE_FLOAT32_C(   584.00), SIMDE_FLOAT32_C(  -816.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256bh a = simde_x_mm256_castsi256_pbh(simde_mm256_loadu_epi16(test_vec[i].a));
+    simde__m256 r = simde_mm256_cvtneobf16_ps(&a);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m256bh a = simde_mm512_cvtneps_pbh(simde_test_x86_random_f32x16(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0)));
+    simde__m256 r = simde_mm256_cvtneobf16_ps(&a);
+
+    simde_test_x86_write_u16x16(2, simde_x_mm256_castpbh_si256(a), SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_f32x8(2, r, SIMDE_TEST_VEC_POS_LAST, 1);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_cvtneps_avx_pbh (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde_float32 a[4];
+    const uint16_t r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(1.00390625), SIMDE_FLOAT32_C(1.01171875),  SIMDE_FLOAT32_C(-1.0e-39) },
+      { UINT16_C(32704), UINT16_C(16256), UINT16_C(16258), UINT16_C(32768), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    #endif
+    { { SIMDE_FLOAT32_C(  -264.79), SIMDE_FLOAT32_C(   900.67), SIMDE_FLOAT32_C(   533.54), SIMDE_FLOAT32_C(    -1.12) },
+      { UINT16_C(50052), UINT16_C(17505), UINT16_C(17413), UINT16_C(49039), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { SIMDE_FLOAT32_C(  -296.03), SIMDE_FLOAT32_C(   954.11), SIMDE_FLOAT32_C(   723.37), SIMDE_FLOAT32_C(   810.91) },
+      { UINT16_C(50068), UINT16_C(17519), UINT16_C(17461), UINT16_C(17483), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { SIMDE_FLOAT32_C(   834.10), SIMDE_FLOAT32_C(    88.68), SIMDE_FLOAT32_C(  -656.10), SIMDE_FLOAT32_C(  -615.35) },
+      { UINT16_C(17489), UINT16_C(17073), UINT16_C(50212), UINT16_C(50202), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { SIMDE_FLOAT32_C(   344.45), SIMDE_FLOAT32_C(   786.03), SIMDE_FLOAT32_C(   192.22), SIMDE_FLOAT32_C(  -240.26) },
+      { UINT16_C(17324), UINT16_C(17477), UINT16_C(17216), UINT16_C(50032), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { SIMDE_FLOAT32_C(  -157.11), SIMDE_FLOAT32_C(   265.15), SIMDE_FLOAT32_C(   202.80), SIMDE_FLOAT32_C(  -835.53) },
+      { UINT16_C(49949), UINT16_C(17285), UINT16_C(17227), UINT16_C(50257), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { SIMDE_FLOAT32_C(   661.25), SIMDE_FLOAT32_C(  -487.68), SIMDE_FLOAT32_C(  -578.01), SIMDE_FLOAT32_C(  -902.50) },
+      { UINT16_C(17445), UINT16_C(50164), UINT16_C(50193), UINT16_C(50274), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { SIMDE_FLOAT32_C(  -771.90), SIMDE_FLOAT32_C(   793.67), SIMDE_FLOAT32_C(  -456.53), SIMDE_FLOAT32_C(   729.35) },
+      { UINT16_C(50241), UINT16_C(17478), UINT16_C(50148), UINT16_C(17462), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128bh r = simde_mm_cvtneps_avx_pbh(a);
+    simde_test_x86_assert_equal_u16x8(simde_x_mm_castpbh_si128(r), simde_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m128 a = simde_test_x86_random_f32x4(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__m128bh r = simde_mm_cvtneps_avx_pbh(a);
+
+    simde_test_x86_write_f32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_u16x8(2, simde_x_mm_castpbh_si128(r), SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm256_cvtneps_avx_pbh (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const simde_float32 a[8];
+    const uint16_t r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT32_C(1.00390625),            SIMDE_MATH_NANF,    SIMDE_FLOAT32_C(3.4e38),      -SIMDE_MATH_INFINITYF,
+        SIMDE_FLOAT32_C(1.01171875), SIMDE_FLOAT32_C(    -0.00),       SIMDE_MATH_INFINITYF,  SIMDE_FLOAT32_C(-1.0e-39) },
+      { UINT16_C(16256), UINT16_C(32704), UINT16_C(32640), UINT16_C(65408), UINT16_C(16258), UINT16_C(32768), UINT16_C(32640), UINT16_C(32768) } },
+    #endif
+    { { SIMDE_FLOAT32_C(   -16.71), SIMDE_FLOAT32_C(  -212.84), SIMDE_FLOAT32_C(   293.68), SIMDE_FLOAT32_C(   299.00),
+        SIMDE_FLOAT32_C(  -429.43), SIMDE_FLOAT32_C(   417.17), SIMDE_FLOAT32_C(  -837.20), SIMDE_FLOAT32_C(  -987.27) },
+      { UINT16_C(49542), UINT16_C(50005), UINT16_C(17299), UINT16_C(17302), UINT16_C(50135), UINT16_C(17361), UINT16_C(50257), UINT16_C(50295) } },
+    { { SIMDE_FLOAT32_C(  -908.20), SIMDE_FLOAT32_C(  -895.61), SIMDE_FLOAT32_C(  -488.49), SIMDE_FLOAT32_C(    77.40),
+        SIMDE_FLOAT32_C(  -972.19), SIMDE_FLOAT32_C(   890.52), SIMDE_FLOAT32_C(  -637.46), SIMDE_FLOAT32_C(   163.56) },
+      { UINT16_C(50275), UINT16_C(50272), UINT16_C(50164), UINT16_C(17051), UINT16_C(50291), UINT16_C(17503), UINT16_C(50207), UINT16_C(17188) } },
+    { { SIMDE_FLOAT32_C(  -270.78), SIMDE_FLOAT32_C(  -576.58), SIMDE_FLOAT32_C(  -221.95), SIMDE_FLOAT32_C(   391.40),
+        SIMDE_FLOAT32_C(   414.40), SIMDE_FLOAT32_C(  -289.12), SIMDE_FLOAT32_C(   526.15), SIMDE_FLOAT32_C(  -267.51) },
+      { UINT16_C(50055), UINT16_C(50192), UINT16_C(50014), UINT16_C(17348), UINT16_C(17359), UINT16_C(50065), UINT16_C(17412), UINT16_C(50054) } },
+    { { SIMDE_FLOAT32_C(    11.97), SIMDE_FLOAT32_C(   282.46), SIMDE_FLOAT32_C(   866.66), SIMDE_FLOAT32_C(   301.35),
+        SIMDE_FLOAT32_C(   689.39), SIMDE_FLOAT32_C(  -640.75), SIMDE_FLOAT32_C(  -209.33), SIMDE_FLOAT32_C(   100.11) },
+      { UINT16_C(16704), UINT16_C(17293), UINT16_C(17497), UINT16_C(17303), UINT16_C(17452), UINT16_C(50208), UINT16_C(50001), UINT16_C(17096) } },
+    { { SIMDE_FLOAT32_C(   763.29), SIMDE_FLOAT32_C(    24.40), SIMDE_FLOAT32_C(   961.07), SIMDE_FLOAT32_C(   972.22),
+        SIMDE_FLOAT32_C(  -163.40), SIMDE_FLOAT32_C(  -318.74), SIMDE_FLOAT32_C(  -497.02), SIMDE_FLOAT32_C(   -88.37) },
+      { UINT16_C(17471), UINT16_C(16835), UINT16_C(17520), UINT16_C(17523), UINT16_C(49955), UINT16_C(50079), UINT16_C(50169), UINT16_C(49841) } },
+    { { SIMDE_FLOAT32_C(  -710.95), SIMDE_FLOAT32_C(  -117.80), SIMDE_FLOAT32_C(   145.33), SIMDE_FLOAT32_C(  -117.10),
+        SIMDE_FLOAT32_C(  -866.52), SIMDE_FLOAT32_C(   802.26), SIMDE_FLOAT32_C(  -879.65), SIMDE_FLOAT32_C(  -739.26) },
+      { UINT16_C(50226), UINT16_C(49900), UINT16_C(17169), UINT16_C(49898), UINT16_C(50265), UINT16_C(17481), UINT16_C(50268), UINT16_C(50233) } },
+    { { SIMDE_FLOAT32_C(   -82.24), SIMDE_FLOAT32_C(   640.59), SIMDE_FLOAT32_C(   924.78), SIMDE_FLOAT32_C(  -124.53),
+        SIMDE_FLOAT32_C(   858.14), SIMDE_FLOAT32_C(    22.80), SIMDE_FLOAT32_C(  -196.47), SIMDE_FLOAT32_C(  -233.34) },
+      { UINT16_C(49828), UINT16_C(17440), UINT16_C(17511), UINT16_C(49913), UINT16_C(17495), UINT16_C(16822), UINT16_C(49988), UINT16_C(50025) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde__m128bh r = simde_mm256_cvtneps_avx_pbh(a);
+    simde_test_x86_assert_equal_u16x8(simde_x_mm_castpbh_si128(r), simde_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m256 a = simde_test_x86_random_f32x8(SIMDE_FLOAT32_C(-1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde__m128bh r = simde_mm256_cvtneps_avx_pbh(a);
+
+    simde_test_x86_write_f32x8(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_u16x8(2, simde_x_mm_castpbh_si128(r), SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_bcstnebf16_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_bcstnebf16_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cvtneebf16_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_cvtneebf16_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cvtneobf16_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_cvtneobf16_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cvtneps_avx_pbh)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_cvtneps_avx_pbh)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/test-x86-footer.h>
@@ -0,0 +1,487 @@
+/* MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#define SIMDE_TESTS_CURRENT_ISAX sha
+#include <simde/x86/sha.h>
+#include <test/x86/test-sse2.h>
+
+static int
+test_simde_mm_sha1msg1_epu32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint32_t a[4];
+    const uint32_t b[4];
+    const uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(1890096320), UINT32_C(1387546324), UINT32_C( 543335003), UINT32_C(1383115039) },
+      { UINT32_C(1234204098), UINT32_C(2001319137), UINT32_C( 460444312), UINT32_C(2372867789) },
+      { UINT32_C(1809401432), UINT32_C(3755692057), UINT32_C(1355429531), UINT32_C(  12906443) } },
+    { { UINT32_C(2130581418), UINT32_C(3117527645), UINT32_C(1943614292), UINT32_C(2680572381) },
+      { UINT32_C(2699581119), UINT32_C(2736206090), UINT32_C(3502147587), UINT32_C(1230843294) },
+      { UINT32_C(2923470761), UINT32_C(4035747779), UINT32_C( 220669182), UINT32_C( 639105920) } },
+    { { UINT32_C(2730974020), UINT32_C(1650169870), UINT32_C(2849387724), UINT32_C(1028168830) },
+      { UINT32_C(4242354418), UINT32_C(1688204385), UINT32_C( 439639420), UINT32_C(3479409034) },
+      { UINT32_C(3102934584), UINT32_C(2906130820), UINT32_C( 185692040), UINT32_C(1595081840) } },
+    { { UINT32_C(4218498029), UINT32_C(2405289155), UINT32_C(2117612288), UINT32_C(3250290895) },
+      { UINT32_C( 297703600), UINT32_C( 141909388), UINT32_C(1159965115), UINT32_C( 672433723) },
+      { UINT32_C(3193078358), UINT32_C(2806598392), UINT32_C(2236160237), UINT32_C(1323715596) } },
+    { { UINT32_C(1965262257), UINT32_C(1376026705), UINT32_C(2211462580), UINT32_C(1850051773) },
+      { UINT32_C(2977891108), UINT32_C( 465171808), UINT32_C(3647069342), UINT32_C( 335639907) },
+      { UINT32_C(2890029359), UINT32_C(1174795570), UINT32_C(4143167493), UINT32_C(1010896108) } },
+    { { UINT32_C(1284056315), UINT32_C(1503563429), UINT32_C(2296147915), UINT32_C( 536224251) },
+      { UINT32_C(2245031460), UINT32_C( 161516139), UINT32_C(3387097446), UINT32_C(1927210103) },
+      { UINT32_C(2238326173), UINT32_C( 725641938), UINT32_C(3293924144), UINT32_C(1181265758) } },
+    { { UINT32_C(2931713801), UINT32_C(3221708277), UINT32_C(3343508428), UINT32_C( 702955269) },
+      { UINT32_C( 548321205), UINT32_C(2804567873), UINT32_C(3346074960), UINT32_C(4198060017) },
+      { UINT32_C(1775200857), UINT32_C( 977146372), UINT32_C(1777829061), UINT32_C(3923862256) } },
+    { { UINT32_C(2896754870), UINT32_C( 560770901), UINT32_C(2565387667), UINT32_C(2864828149) },
+      { UINT32_C(3335221381), UINT32_C( 258930111), UINT32_C(4091010818), UINT32_C(3840806958) },
+      { UINT32_C(1602168756), UINT32_C(3313680251), UINT32_C( 876629285), UINT32_C(2343395744) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r = simde_mm_sha1msg1_epu32(a, b);
+    simde_test_x86_assert_equal_u32x4(r, simde_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m128i a = simde_test_x86_random_u32x4();
+    simde__m128i b = simde_test_x86_random_u32x4();
+    simde__m128i r = simde_mm_sha1msg1_epu32(a, b);
+
+    simde_test_x86_write_u32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_u32x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_sha1msg2_epu32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint32_t a[4];
+    const uint32_t b[4];
+    const uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(1569756680), UINT32_C(3648978246), UINT32_C(2809226930), UINT32_C(3125948981) },
+      { UINT32_C(1635851682), UINT32_C( 343011090), UINT32_C(4228335822), UINT32_C(1642132824) },
+      { UINT32_C(2725562365), UINT32_C(1912586697), UINT32_C(1711346497), UINT32_C(2360014326) } },
+    { { UINT32_C(3535696268), UINT32_C( 548093294), UINT32_C(3636993187), UINT32_C(4052949582) },
+      { UINT32_C(1230115895), UINT32_C(3512582915), UINT32_C(1691182091), UINT32_C(3871714650) },
+      { UINT32_C(4026866191), UINT32_C(3555873458), UINT32_C( 321634112), UINT32_C( 717028491) } },
+    { { UINT32_C(2360902430), UINT32_C(1689084864), UINT32_C(3443291519), UINT32_C(3334393743) },
+      { UINT32_C(3859747299), UINT32_C(3770117332), UINT32_C( 709133520), UINT32_C(1343228210) },
+      { UINT32_C(2862099266), UINT32_C(  88400967), UINT32_C(1528181590), UINT32_C(3656685247) } },
+    { { UINT32_C(1306380428), UINT32_C(2863761963), UINT32_C(2390289919), UINT32_C(2689873597) },
+      { UINT32_C( 478634823), UINT32_C(2684108495), UINT32_C(4123672771), UINT32_C(3578124873) },
+      { UINT32_C(3452061921), UINT32_C(1819136729), UINT32_C( 587834976), UINT32_C(2872896764) } },
+    { { UINT32_C(3458343587), UINT32_C(2876887980), UINT32_C(2117726657), UINT32_C(1864273191) },
+      { UINT32_C(3213600240), UINT32_C(2808055780), UINT32_C( 278669767), UINT32_C(2800083203) },
+      { UINT32_C(1649333958), UINT32_C( 702868664), UINT32_C(2999774283), UINT32_C(4278536640) } },
+    { { UINT32_C(2960459780), UINT32_C(2623336155), UINT32_C( 102405599), UINT32_C( 326449443) },
+      { UINT32_C(3268608222), UINT32_C(1315517063), UINT32_C(1583220059), UINT32_C(3942991079) },
+      { UINT32_C(1413931496), UINT32_C(3172981770), UINT32_C(2431078064), UINT32_C(2589358320) } },
+    { { UINT32_C( 664500812), UINT32_C(1204090728), UINT32_C(2957893261), UINT32_C(4140024599) },
+      { UINT32_C(1270388419), UINT32_C( 597238472), UINT32_C( 243464231), UINT32_C(2298054460) },
+      { UINT32_C(2922518619), UINT32_C( 418956118), UINT32_C( 665450635), UINT32_C(4035081825) } },
+    { { UINT32_C(1773114625), UINT32_C( 430994316), UINT32_C(1774845266), UINT32_C(2220854720) },
+      { UINT32_C(3972995107), UINT32_C(1628399674), UINT32_C(2624622944), UINT32_C( 421816600) },
+      { UINT32_C(3018020994), UINT32_C(3942569823), UINT32_C( 294464208), UINT32_C( 811481408) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r = simde_mm_sha1msg2_epu32(a, b);
+    simde_test_x86_assert_equal_u32x4(r, simde_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m128i a = simde_test_x86_random_u32x4();
+    simde__m128i b = simde_test_x86_random_u32x4();
+    simde__m128i r = simde_mm_sha1msg2_epu32(a, b);
+
+    simde_test_x86_write_u32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_u32x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_sha1nexte_epu32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint32_t a[4];
+    const uint32_t b[4];
+    const uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(2340607230), UINT32_C(2577674823), UINT32_C(4026756656), UINT32_C( 510943995) },
+      { UINT32_C(3020571514), UINT32_C( 202775212), UINT32_C(3299444395), UINT32_C(4007513583) },
+      { UINT32_C(3020571514), UINT32_C( 202775212), UINT32_C(3299444395), UINT32_C(3061507757) } },
+    { { UINT32_C(3917045921), UINT32_C(3263307154), UINT32_C(2259912075), UINT32_C(1654990824) },
+      { UINT32_C( 387428203), UINT32_C(1965239753), UINT32_C(2721696947), UINT32_C( 999298714) },
+      { UINT32_C( 387428203), UINT32_C(1965239753), UINT32_C(2721696947), UINT32_C(1413046420) } },
+    { { UINT32_C( 153356662), UINT32_C(2999691047), UINT32_C( 339312172), UINT32_C( 293068454) },
+      { UINT32_C(1462275725), UINT32_C(1858882491), UINT32_C(2987394328), UINT32_C(2465046811) },
+      { UINT32_C(1462275725), UINT32_C(1858882491), UINT32_C(2987394328), UINT32_C( 390830276) } },
+    { { UINT32_C(3516601002), UINT32_C(3850659513), UINT32_C(2348465637), UINT32_C( 681341339) },
+      { UINT32_C(3128935679), UINT32_C( 656952079), UINT32_C(1826175056), UINT32_C(2231289817) },
+      { UINT32_C(3128935679), UINT32_C( 656952079), UINT32_C(1826175056), UINT32_C(1327883327) } },
+    { { UINT32_C(2455083481), UINT32_C(3833059839), UINT32_C( 829387158), UINT32_C(3780774882) },
+      { UINT32_C(3751533007), UINT32_C(1963377445), UINT32_C(3588350204), UINT32_C(2153373607) },
+      { UINT32_C(3751533007), UINT32_C(1963377445), UINT32_C(3588350204), UINT32_C( 951083679) } },
+    { { UINT32_C(2014490488), UINT32_C( 526158216), UINT32_C(3713060091), UINT32_C(2814356183) },
+      { UINT32_C(2844154500), UINT32_C( 438209566), UINT32_C( 334430316), UINT32_C(1486047711) },
+      { UINT32_C(2844154500), UINT32_C( 438209566), UINT32_C( 334430316), UINT32_C(1115894932) } },
+    { { UINT32_C(2161157624), UINT32_C( 715074607), UINT32_C(3490181368), UINT32_C( 511166106) },
+      { UINT32_C(1070071073), UINT32_C(4133086857), UINT32_C(3305720038), UINT32_C(2300419473) },
+      { UINT32_C(1070071073), UINT32_C(4133086857), UINT32_C(3305720038), UINT32_C( 280727351) } },
+    { { UINT32_C(1896541506), UINT32_C( 312191258), UINT32_C( 887268249), UINT32_C(2320652649) },
+      { UINT32_C(3771275862), UINT32_C(3872793088), UINT32_C(4239122283), UINT32_C(3213281660) },
+      { UINT32_C(3771275862), UINT32_C(3872793088), UINT32_C(4239122283), UINT32_C( 572219350) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r = simde_mm_sha1nexte_epu32(a, b);
+    simde_test_x86_assert_equal_u32x4(r, simde_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m128i a = simde_test_x86_random_u32x4();
+    simde__m128i b = simde_test_x86_random_u32x4();
+    simde__m128i r = simde_mm_sha1nexte_epu32(a, b);
+
+    simde_test_x86_write_u32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_u32x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_sha1rnds4_epu32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint32_t a[4];
+    const uint32_t b[4];
+    const uint32_t r0[4];
+    const uint32_t r1[4];
+    const uint32_t r2[4];
+    const uint32_t r3[4];
+  } test_vec[] = {
+    { { UINT32_C(3492843702), UINT32_C(3554921529), UINT32_C(3624387951), UINT32_C(1969445151) },
+      { UINT32_C(1934961779), UINT32_C(3126405967), UINT32_C(2276853003), UINT32_C(2219195598) },
+      { UINT32_C(2530864067), UINT32_C(  91763096), UINT32_C(2719552378), UINT32_C(3822377218) },
+      { UINT32_C(1591212431), UINT32_C(2697964387), UINT32_C(3035846170), UINT32_C(2001555211) },
+      { UINT32_C(3824957557), UINT32_C(1998625194), UINT32_C(2364963574), UINT32_C(1964683232) },
+      { UINT32_C(3048877852), UINT32_C(2482541211), UINT32_C(1385865877), UINT32_C(2920211843) } },
+    { { UINT32_C( 106264524), UINT32_C(3000580163), UINT32_C( 478863613), UINT32_C(2912087353) },
+      { UINT32_C(1763763994), UINT32_C( 505641491), UINT32_C(1302714751), UINT32_C(3805408278) },
+      { UINT32_C(1084477705), UINT32_C(3320611327), UINT32_C(1759831023), UINT32_C(2420723688) },
+      { UINT32_C(2869169047), UINT32_C(2807111041), UINT32_C(1757121529), UINT32_C(2478035206) },
+      { UINT32_C( 248066109), UINT32_C(2077260090), UINT32_C(3011101933), UINT32_C( 500804184) },
+      { UINT32_C(3253092644), UINT32_C(2591687857), UINT32_C(  71357659), UINT32_C(3324765499) } },
+    { { UINT32_C(2800232035), UINT32_C(1549320542), UINT32_C(3682132641), UINT32_C(3934784208) },
+      { UINT32_C(  89368818), UINT32_C(2703455778), UINT32_C(1710147663), UINT32_C( 390643892) },
+      { UINT32_C( 266950187), UINT32_C( 884429272), UINT32_C( 782351831), UINT32_C(3587661004) },
+      { UINT32_C(3191538435), UINT32_C( 374363094), UINT32_C(1225802814), UINT32_C(3941377011) },
+      { UINT32_C( 897035908), UINT32_C( 900234656), UINT32_C(3618963238), UINT32_C( 949037524) },
+      { UINT32_C(3575462032), UINT32_C( 158939910), UINT32_C(2625983673), UINT32_C(2711294175) } },
+    { { UINT32_C(1170026726), UINT32_C(2476807666), UINT32_C(3362658808), UINT32_C( 380827172) },
+      { UINT32_C(3239773599), UINT32_C(3395501691), UINT32_C(3140505862), UINT32_C(4174542865) },
+      { UINT32_C(2883140104), UINT32_C( 919085556), UINT32_C( 836204157), UINT32_C( 406064997) },
+      { UINT32_C( 387930440), UINT32_C( 765402576), UINT32_C( 137856763), UINT32_C( 231795360) },
+      { UINT32_C(1207861976), UINT32_C(1753190488), UINT32_C(1151519974), UINT32_C( 480929674) },
+      { UINT32_C(1845595861), UINT32_C(1623721224), UINT32_C( 471505685), UINT32_C( 695851027) } },
+    { { UINT32_C(2587725992), UINT32_C(2637094565), UINT32_C( 459644151), UINT32_C( 842078099) },
+      { UINT32_C(2549304348), UINT32_C(2439141002), UINT32_C(3108803240), UINT32_C(2997952010) },
+      { UINT32_C(3139750317), UINT32_C(4091826366), UINT32_C(1241797614), UINT32_C(2229661800) },
+      { UINT32_C(3775476674), UINT32_C( 741418907), UINT32_C(1148247096), UINT32_C(4177792588) },
+      { UINT32_C(1221024380), UINT32_C(1998790017), UINT32_C( 366549179), UINT32_C(1972887035) },
+      { UINT32_C( 938174800), UINT32_C( 525995731), UINT32_C(2079582253), UINT32_C( 767267542) } },
+    { { UINT32_C(1414393518), UINT32_C(3304160204), UINT32_C(2866763543), UINT32_C(2346455406) },
+      { UINT32_C(3894595677), UINT32_C(3464070182), UINT32_C( 545834262), UINT32_C(2463316451) },
+      { UINT32_C(1332377406), UINT32_C( 349344274), UINT32_C( 971868146), UINT32_C(1326277149) },
+      { UINT32_C(2917451122), UINT32_C(2666235400), UINT32_C(2010887222), UINT32_C(2984833436) },
+      { UINT32_C(2559813895), UINT32_C( 103747982), UINT32_C( 487000112), UINT32_C(2609802524) },
+      { UINT32_C(3301374719), UINT32_C(3524554040), UINT32_C(3277822098), UINT32_C( 932234391) } },
+    { { UINT32_C(4108722216), UINT32_C(2998458267), UINT32_C(2640156718), UINT32_C( 103299497) },
+      { UINT32_C( 820922889), UINT32_C(3858655183), UINT32_C( 268863020), UINT32_C(3902986688) },
+      { UINT32_C(4265201184), UINT32_C(3434726817), UINT32_C(2544818163), UINT32_C(2613851783) },
+      { UINT32_C(3185695367), UINT32_C( 505337731), UINT32_C( 676785945), UINT32_C(3591244219) },
+      { UINT32_C(3161495289), UINT32_C(1554191846), UINT32_C(1528839646), UINT32_C(1005666228) },
+      { UINT32_C(3569618964), UINT32_C(1363656371), UINT32_C(3167126298), UINT32_C( 197769716) } },
+    { { UINT32_C(2497480953), UINT32_C(2386990431), UINT32_C(3593184045), UINT32_C(3873199069) },
+      { UINT32_C(1813433245), UINT32_C(1599214898), UINT32_C(1534023835), UINT32_C( 709038385) },
+      { UINT32_C(4190741528), UINT32_C( 655018781), UINT32_C(1060055976), UINT32_C( 463919003) },
+      { UINT32_C(1347833286), UINT32_C(2849453993), UINT32_C(2507355691), UINT32_C(2376068370) },
+      { UINT32_C(2328752849), UINT32_C( 860616261), UINT32_C(2624017101), UINT32_C(3344407500) },
+      { UINT32_C(2805498707), UINT32_C(2634030817), UINT32_C(3370831527), UINT32_C(1944991577) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r;
+
+    r = simde_mm_sha1rnds4_epu32(a, b, 0);
+    simde_test_x86_assert_equal_u32x4(r, simde_mm_loadu_epi32(test_vec[i].r0));
+    r = simde_mm_sha1rnds4_epu32(a, b, 1);
+    simde_test_x86_assert_equal_u32x4(r, simde_mm_loadu_epi32(test_vec[i].r1));
+    r = simde_mm_sha1rnds4_epu32(a, b, 2);
+    simde_test_x86_assert_equal_u32x4(r, simde_mm_loadu_epi32(test_vec[i].r2));
+    r = simde_mm_sha1rnds4_epu32(a, b, 3);
+    simde_test_x86_assert_equal_u32x4(r, simde_mm_loadu_epi32(test_vec[i].r3));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m128i a = simde_test_x86_random_u32x4();
+    simde__m128i b = simde_test_x86_random_u32x4();
+
+    simde_test_x86_write_u32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_u32x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u32x4(2, simde_mm_sha1rnds4_epu32(a, b, 0), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u32x4(2, simde_mm_sha1rnds4_epu32(a, b, 1), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u32x4(2, simde_mm_sha1rnds4_epu32(a, b, 2), SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u32x4(2, simde_mm_sha1rnds4_epu32(a, b, 3), SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_sha256msg1_epu32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint32_t a[4];
+    const uint32_t b[4];
+    const uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(4173209753), UINT32_C(3800433845), UINT32_C(2243473832), UINT32_C(2724959236) },
+      { UINT32_C(2450424415), UINT32_C( 854679703), UINT32_C(3918422200), UINT32_C( 169070961) },
+      { UINT32_C(4017542359), UINT32_C(1348225773), UINT32_C(2109816538), UINT32_C(2958933456) } },
+    { { UINT32_C(2785202673), UINT32_C(2122877398), UINT32_C(1057177658), UINT32_C( 887189205) },
+      { UINT32_C(2277961712), UINT32_C( 146454352), UINT32_C(2297579543), UINT32_C( 194118937) },
+      { UINT32_C( 660369788), UINT32_C( 572091165), UINT32_C( 910418553), UINT32_C(2129453221) } },
+    { { UINT32_C(2914096599), UINT32_C(1479227934), UINT32_C(1335307898), UINT32_C(2374269084) },
+      { UINT32_C(3088337512), UINT32_C( 432066050), UINT32_C( 815968790), UINT32_C(2403022008) },
+      { UINT32_C(2799975700), UINT32_C(2401145492), UINT32_C(2250494717), UINT32_C(1651312760) } },
+    { { UINT32_C(3879529673), UINT32_C(2705352486), UINT32_C( 837867413), UINT32_C(3099489360) },
+      { UINT32_C(3245396927), UINT32_C(3101307041), UINT32_C(2615704803), UINT32_C(2049582001) },
+      { UINT32_C( 668995907), UINT32_C(3136888391), UINT32_C(1566798818), UINT32_C( 201424860) } },
+    { { UINT32_C( 912418319), UINT32_C(1658299085), UINT32_C(3381905273), UINT32_C(4219556412) },
+      { UINT32_C(3334271269), UINT32_C(  92182050), UINT32_C(3298846227), UINT32_C(2571029129) },
+      { UINT32_C(3029232056), UINT32_C(2119618514), UINT32_C(4221295996), UINT32_C(1788143781) } },
+    { { UINT32_C(4258242608), UINT32_C(3160385090), UINT32_C(2844127853), UINT32_C(1772357444) },
+      { UINT32_C( 439378168), UINT32_C( 169848567), UINT32_C(2664349461), UINT32_C(3107392649) },
+      { UINT32_C(2033419459), UINT32_C(1868072458), UINT32_C( 767345916), UINT32_C(1425043862) } },
+    { { UINT32_C(4021683885), UINT32_C( 447419820), UINT32_C(1287860488), UINT32_C( 817260600) },
+      { UINT32_C(3209422536), UINT32_C(2848549524), UINT32_C(3007878954), UINT32_C(1366130596) },
+      { UINT32_C(2378250465), UINT32_C(4025420063), UINT32_C( 960290562), UINT32_C(2950442238) } },
+    { { UINT32_C( 843064198), UINT32_C(1095560249), UINT32_C(1435308061), UINT32_C(1082475384) },
+      { UINT32_C(3187724329), UINT32_C(1701300539), UINT32_C(  85503841), UINT32_C(3042346287) },
+      { UINT32_C(1944418194), UINT32_C(3043678585), UINT32_C(4259103461), UINT32_C(2973480861) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r = simde_mm_sha256msg1_epu32(a, b);
+    simde_test_x86_assert_equal_u32x4(r, simde_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m128i a = simde_test_x86_random_u32x4();
+    simde__m128i b = simde_test_x86_random_u32x4();
+    simde__m128i r = simde_mm_sha256msg1_epu32(a, b);
+
+    simde_test_x86_write_u32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_u32x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_sha256msg2_epu32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint32_t a[4];
+    const uint32_t b[4];
+    const uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(3806828201), UINT32_C(2669884546), UINT32_C(3170152516), UINT32_C( 503085812) },
+      { UINT32_C(2245786698), UINT32_C( 669664198), UINT32_C( 556532722), UINT32_C( 836141704) },
+      { UINT32_C(1685501532), UINT32_C( 809279475), UINT32_C(1257329500), UINT32_C(4194855986) } },
+    { { UINT32_C(2601762328), UINT32_C( 909784818), UINT32_C(3690082279), UINT32_C(4093177513) },
+      { UINT32_C(2977551595), UINT32_C( 165176087), UINT32_C(4012573798), UINT32_C(2652897670) },
+      { UINT32_C(2107121353), UINT32_C( 923683782), UINT32_C(3902089055), UINT32_C(3767471517) } },
+    { { UINT32_C(2973316287), UINT32_C(1374123114), UINT32_C(1278007715), UINT32_C(3007260104) },
+      { UINT32_C( 275036409), UINT32_C(2182691868), UINT32_C(3329311808), UINT32_C(  90477126) },
+      { UINT32_C(1003691110), UINT32_C( 760352676), UINT32_C( 970852343), UINT32_C(4184665416) } },
+    { { UINT32_C( 817340102), UINT32_C(3045236242), UINT32_C(1073852024), UINT32_C(3438493907) },
+      { UINT32_C( 366761977), UINT32_C(3549951635), UINT32_C(2157513018), UINT32_C(1636236699) },
+      { UINT32_C(3595687139), UINT32_C(1458133854), UINT32_C( 282702863), UINT32_C(1405394130) } },
+    { { UINT32_C(2911976859), UINT32_C(1398936539), UINT32_C(2509464514), UINT32_C(2640479908) },
+      { UINT32_C(1890729693), UINT32_C(1866680628), UINT32_C(3991919698), UINT32_C(1968076250) },
+      { UINT32_C(3274280536), UINT32_C(1202535278), UINT32_C(2355828564), UINT32_C(3626862353) } },
+    { { UINT32_C(2384715954), UINT32_C(3051455987), UINT32_C(2370532841), UINT32_C(3643452923) },
+      { UINT32_C( 541711595), UINT32_C(2022673701), UINT32_C(1130724969), UINT32_C(2797188340) },
+      { UINT32_C(2668441907), UINT32_C(2729373657), UINT32_C(3420714260), UINT32_C(2204761268) } },
+    { { UINT32_C(2268388500), UINT32_C(1245517409), UINT32_C(2262272139), UINT32_C( 543097141) },
+      { UINT32_C(  54569437), UINT32_C(2675691318), UINT32_C(1122230350), UINT32_C( 686333076) },
+      { UINT32_C( 326315625), UINT32_C(2819604911), UINT32_C(2044002215), UINT32_C( 958866475) } },
+    { { UINT32_C(3652197752), UINT32_C(3190091059), UINT32_C(2856647541), UINT32_C(3670713597) },
+      { UINT32_C(2212301645), UINT32_C( 673339610), UINT32_C(3446277433), UINT32_C( 435573665) },
+      { UINT32_C( 465085201), UINT32_C(2714222468), UINT32_C(4029758456), UINT32_C(  48585265) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r = simde_mm_sha256msg2_epu32(a, b);
+    simde_test_x86_assert_equal_u32x4(r, simde_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m128i a = simde_test_x86_random_u32x4();
+    simde__m128i b = simde_test_x86_random_u32x4();
+    simde__m128i r = simde_mm_sha256msg2_epu32(a, b);
+
+    simde_test_x86_write_u32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_u32x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mm_sha256rnds2_epu32 (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    const uint32_t a[4];
+    const uint32_t b[4];
+    const uint32_t c[4];
+    const uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(2750654064), UINT32_C( 140580755), UINT32_C( 263365906), UINT32_C(2531949641) },
+      { UINT32_C(1645856647), UINT32_C(1502231584), UINT32_C(3810981185), UINT32_C(3103530056) },
+      { UINT32_C(1432088514), UINT32_C( 425573382), UINT32_C(2871529313), UINT32_C( 323031692) },
+      { UINT32_C( 165563506), UINT32_C(3447020419), UINT32_C(3911583162), UINT32_C( 792270972) } },
+    { { UINT32_C(4201995226), UINT32_C(3629318295), UINT32_C(1035696629), UINT32_C(1492498582) },
+      { UINT32_C(2930659495), UINT32_C(1841761036), UINT32_C(2803429147), UINT32_C(3703200258) },
+      { UINT32_C(1289105589), UINT32_C( 623126832), UINT32_C( 946004130), UINT32_C(1066489752) },
+      { UINT32_C(4116458006), UINT32_C(2104626521), UINT32_C( 581575251), UINT32_C(1039241253) } },
+    { { UINT32_C(3018669991), UINT32_C(1696642122), UINT32_C(2785819044), UINT32_C(1216530323) },
+      { UINT32_C( 664033527), UINT32_C( 592230529), UINT32_C( 811380376), UINT32_C(2893081861) },
+      { UINT32_C(1985961260), UINT32_C(3067903762), UINT32_C(1264380088), UINT32_C(2794708655) },
+      { UINT32_C(3933343526), UINT32_C(3535235272), UINT32_C( 758911882), UINT32_C(2650904179) } },
+    { { UINT32_C(3083675446), UINT32_C(2027559392), UINT32_C(3433641671), UINT32_C(1333270819) },
+      { UINT32_C(2294732662), UINT32_C( 255763031), UINT32_C( 979081866), UINT32_C(2933976696) },
+      { UINT32_C(4133858838), UINT32_C(2406367431), UINT32_C(2589661046), UINT32_C(2817119280) },
+      { UINT32_C(2100223715), UINT32_C(2896389695), UINT32_C(3133337704), UINT32_C(3189969002) } },
+    { { UINT32_C(  36679595), UINT32_C(3692195409), UINT32_C(2165730568), UINT32_C(1898968667) },
+      { UINT32_C(1818727844), UINT32_C(1274795733), UINT32_C( 518346477), UINT32_C(3603287850) },
+      { UINT32_C(3503879294), UINT32_C(1806494306), UINT32_C(3018637911), UINT32_C(1562647480) },
+      { UINT32_C(2733688889), UINT32_C(2713888395), UINT32_C(1419485275), UINT32_C(1087739956) } },
+    { { UINT32_C(2244578480), UINT32_C(1339147362), UINT32_C(1164817946), UINT32_C(  68891269) },
+      { UINT32_C(2312434471), UINT32_C( 905216222), UINT32_C(4209565762), UINT32_C(2891386364) },
+      { UINT32_C(4214366361), UINT32_C(4283040740), UINT32_C(1061468345), UINT32_C( 289628138) },
+      { UINT32_C(2878352146), UINT32_C(1442481918), UINT32_C( 725936434), UINT32_C(3439912625) } },
+    { { UINT32_C( 815470418), UINT32_C(3647377303), UINT32_C(1825787504), UINT32_C(4095224667) },
+      { UINT32_C( 820988491), UINT32_C( 120535629), UINT32_C(3695604722), UINT32_C( 619612626) },
+      { UINT32_C( 928352672), UINT32_C(2282797848), UINT32_C(1710547721), UINT32_C(1515785486) },
+      { UINT32_C(2538929866), UINT32_C(3601828994), UINT32_C(2623383999), UINT32_C(1530102284) } },
+    { { UINT32_C(2777303383), UINT32_C(1974253955), UINT32_C(4266783276), UINT32_C( 455229307) },
+      { UINT32_C(3780278216), UINT32_C(1013539378), UINT32_C(1419861573), UINT32_C(3266247275) },
+      { UINT32_C(3328653379), UINT32_C( 490410993), UINT32_C(2149289221), UINT32_C(2509979084) },
+      { UINT32_C(2249171201), UINT32_C( 895222634), UINT32_C(1920741927), UINT32_C( 710033655) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i c = simde_mm_loadu_epi32(test_vec[i].c);
+    simde__m128i r = simde_mm_sha256rnds2_epu32(a, b, c);
+    simde_test_x86_assert_equal_u32x4(r, simde_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde__m128i a = simde_test_x86_random_u32x4();
+    simde__m128i b = simde_test_x86_random_u32x4();
+    simde__m128i c = simde_test_x86_random_u32x4();
+    simde__m128i r = simde_mm_sha256rnds2_epu32(a, b, c);
+
+    simde_test_x86_write_u32x4(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_x86_write_u32x4(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u32x4(2, c, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_x86_write_u32x4(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_sha1msg1_epu32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_sha1msg2_epu32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_sha1nexte_epu32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_sha1rnds4_epu32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_sha256msg1_epu32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_sha256msg2_epu32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_sha256rnds2_epu32)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/test-x86-footer.h>
@@ -25,6 +25,360 @@
 #include <test/x86/test-sse2.h>
 #include <simde/x86/sse4.2.h>
 
+static int
+test_simde_mm_cmpestri (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t a[16];
+    int la;
+    int8_t b[16];
+    int lb;
+    int r[8];
+  } test_vec[] = {
+    { {INT8_C(  44), INT8_C(  59), INT8_C(   9), INT8_C(  13), INT8_C(  10), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122)},
+      5,
+      {INT8_C(  97), INT8_C(  44), INT8_C(  98), INT8_C(  59), INT8_C(  99), INT8_C(   9), INT8_C( 100), INT8_C(  13), INT8_C(  10), INT8_C( 101), INT8_C(  44), INT8_C( 102), INT8_C(  59), INT8_C( 103), INT8_C(   9), INT8_C( 104)},
+      16,
+      { 1, 1, 14, 0, 16, 0, 8, 8 } },
+    { {INT8_C(  65), INT8_C(  90), INT8_C(  97), INT8_C( 122), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      4,
+      {INT8_C(  72), INT8_C( 101), INT8_C( 108), INT8_C( 108), INT8_C( 111), INT8_C(  32), INT8_C(  87), INT8_C( 111), INT8_C( 114), INT8_C( 108), INT8_C( 100), INT8_C(  32), INT8_C(  48), INT8_C(  49), INT8_C(  50), INT8_C(  51)},
+      11,
+      { 16, 0, 10, 0, 16, 0, 4, 8 } },
+    { {INT8_C( 110), INT8_C( 101), INT8_C( 101), INT8_C( 100), INT8_C( 108), INT8_C( 101), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120)},
+      6,
+      {INT8_C( 104), INT8_C(  97), INT8_C( 121), INT8_C( 115), INT8_C( 116), INT8_C(  97), INT8_C(  99), INT8_C( 107), INT8_C( 110), INT8_C( 101), INT8_C( 101), INT8_C( 100), INT8_C( 108), INT8_C( 101), INT8_C( 110), INT8_C( 101)},
+      16,
+      { 8, 16, 16, 0, 8, 0, 7, 7 } },
+    { {INT8_C( 110), INT8_C( 101), INT8_C( 101), INT8_C( 100), INT8_C( 108), INT8_C( 101), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120)},
+      6,
+      {INT8_C( 104), INT8_C(  97), INT8_C( 121), INT8_C( 115), INT8_C( 116), INT8_C(  97), INT8_C(  99), INT8_C( 107), INT8_C( 104), INT8_C(  97), INT8_C( 121), INT8_C( 115), INT8_C( 116), INT8_C( 110), INT8_C( 101), INT8_C( 101)},
+      16,
+      { 13, 16, 16, 0, 13, 0, 6, 8 } },
+    { {INT8_C(-128), INT8_C(  -1), INT8_C(   1), INT8_C( 127), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      -4,
+      {INT8_C(-127), INT8_C(   0), INT8_C( 127), INT8_C(-128), INT8_C(  -1), INT8_C(  16), INT8_C(  97), INT8_C(  98), INT8_C(  99), INT8_C( 100), INT8_C( 101), INT8_C( 102), INT8_C( 103), INT8_C( 104), INT8_C( 105), INT8_C( 106)},
+      -100,
+      { 2, 0, 15, 0, 16, 0, 7, 8 } },
+    { {INT8_C(  97), INT8_C(  98), INT8_C(  99), INT8_C( 100), INT8_C( 101), INT8_C( 102), INT8_C( 103), INT8_C( 104), INT8_C( 105), INT8_C( 106), INT8_C( 107), INT8_C( 108), INT8_C( 109), INT8_C( 110), INT8_C( 111), INT8_C( 112)},
+      20,
+      {INT8_C(  97), INT8_C(  98), INT8_C(  99), INT8_C( 100), INT8_C( 101), INT8_C( 102), INT8_C( 103), INT8_C( 104), INT8_C( 105), INT8_C( 106), INT8_C( 107), INT8_C( 108), INT8_C( 109), INT8_C( 110), INT8_C( 111), INT8_C( 122)},
+      9,
+      { 0, 0, 8, 9, 16, 7, 6, 8 } },
+    { {INT8_C(  48), INT8_C(   0), INT8_C(  57), INT8_C(   0), INT8_C(  97), INT8_C(   0), INT8_C( 102), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      4,
+      {INT8_C(  49), INT8_C(   0), INT8_C( 120), INT8_C(   0), INT8_C(  98), INT8_C(   0), INT8_C(  71), INT8_C(   0), INT8_C(  57), INT8_C(   0), INT8_C( 122), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      6,
+      { 1, 16, 16, 0, 16, 0, 4, 8 } },
+    { {INT8_C( 120), INT8_C( 121), INT8_C( 122), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      0,
+      {INT8_C( 120), INT8_C( 121), INT8_C( 122), INT8_C( 120), INT8_C( 121), INT8_C( 122), INT8_C( 120), INT8_C( 121), INT8_C( 122), INT8_C( 120), INT8_C( 121), INT8_C( 122), INT8_C( 120), INT8_C( 121), INT8_C( 122), INT8_C( 120)},
+      3,
+      { 16, 16, 16, 0, 0, 0, 8, 7 } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_si128(test_vec[i].b);
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY), test_vec[i].r[0]);
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_RANGES), test_vec[i].r[1]);
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[2]);
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_NEGATIVE_POLARITY), test_vec[i].r[3]);
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED), test_vec[i].r[4]);
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY), test_vec[i].r[5]);
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[6]);
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MASKED_POSITIVE_POLARITY | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[7]);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_cmpestra (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t a[16];
+    int la;
+    int8_t b[16];
+    int lb;
+    int r[8];
+  } test_vec[] = {
+    { {INT8_C(  44), INT8_C(  59), INT8_C(   9), INT8_C(  13), INT8_C(  10), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122)},
+      5,
+      {INT8_C(  97), INT8_C(  44), INT8_C(  98), INT8_C(  59), INT8_C(  99), INT8_C(   9), INT8_C( 100), INT8_C(  13), INT8_C(  10), INT8_C( 101), INT8_C(  44), INT8_C( 102), INT8_C(  59), INT8_C( 103), INT8_C(   9), INT8_C( 104)},
+      16,
+      { 0, 0, 0, 0, 1, 0, 1, 1 } },
+    { {INT8_C(  65), INT8_C(  90), INT8_C(  97), INT8_C( 122), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      4,
+      {INT8_C(  72), INT8_C( 101), INT8_C( 108), INT8_C( 108), INT8_C( 111), INT8_C(  32), INT8_C(  87), INT8_C( 111), INT8_C( 114), INT8_C( 108), INT8_C( 100), INT8_C(  32), INT8_C(  48), INT8_C(  49), INT8_C(  50), INT8_C(  51)},
+      11,
+      { 0, 0, 0, 0, 0, 0, 0, 1 } },
+    { {INT8_C( 110), INT8_C( 101), INT8_C( 101), INT8_C( 100), INT8_C( 108), INT8_C( 101), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120)},
+      6,
+      {INT8_C( 104), INT8_C(  97), INT8_C( 121), INT8_C( 115), INT8_C( 116), INT8_C(  97), INT8_C(  99), INT8_C( 107), INT8_C( 110), INT8_C( 101), INT8_C( 101), INT8_C( 100), INT8_C( 108), INT8_C( 101), INT8_C( 110), INT8_C( 101)},
+      16,
+      { 0, 1, 1, 0, 0, 0, 0, 0 } },
+    { {INT8_C( 110), INT8_C( 101), INT8_C( 101), INT8_C( 100), INT8_C( 108), INT8_C( 101), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120)},
+      6,
+      {INT8_C( 104), INT8_C(  97), INT8_C( 121), INT8_C( 115), INT8_C( 116), INT8_C(  97), INT8_C(  99), INT8_C( 107), INT8_C( 104), INT8_C(  97), INT8_C( 121), INT8_C( 115), INT8_C( 116), INT8_C( 110), INT8_C( 101), INT8_C( 101)},
+      16,
+      { 0, 1, 1, 0, 0, 0, 0, 1 } },
+    { {INT8_C(-128), INT8_C(  -1), INT8_C(   1), INT8_C( 127), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      -4,
+      {INT8_C(-127), INT8_C(   0), INT8_C( 127), INT8_C(-128), INT8_C(  -1), INT8_C(  16), INT8_C(  97), INT8_C(  98), INT8_C(  99), INT8_C( 100), INT8_C( 101), INT8_C( 102), INT8_C( 103), INT8_C( 104), INT8_C( 105), INT8_C( 106)},
+      -100,
+      { 0, 0, 0, 0, 1, 0, 0, 1 } },
+    { {INT8_C(  97), INT8_C(  98), INT8_C(  99), INT8_C( 100), INT8_C( 101), INT8_C( 102), INT8_C( 103), INT8_C( 104), INT8_C( 105), INT8_C( 106), INT8_C( 107), INT8_C( 108), INT8_C( 109), INT8_C( 110), INT8_C( 111), INT8_C( 112)},
+      20,
+      {INT8_C(  97), INT8_C(  98), INT8_C(  99), INT8_C( 100), INT8_C( 101), INT8_C( 102), INT8_C( 103), INT8_C( 104), INT8_C( 105), INT8_C( 106), INT8_C( 107), INT8_C( 108), INT8_C( 109), INT8_C( 110), INT8_C( 111), INT8_C( 122)},
+      9,
+      { 0, 0, 0, 0, 0, 0, 0, 1 } },
+    { {INT8_C(  48), INT8_C(   0), INT8_C(  57), INT8_C(   0), INT8_C(  97), INT8_C(   0), INT8_C( 102), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      4,
+      {INT8_C(  49), INT8_C(   0), INT8_C( 120), INT8_C(   0), INT8_C(  98), INT8_C(   0), INT8_C(  71), INT8_C(   0), INT8_C(  57), INT8_C(   0), INT8_C( 122), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      6,
+      { 0, 0, 0, 0, 0, 0, 0, 0 } },
+    { {INT8_C( 120), INT8_C( 121), INT8_C( 122), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      0,
+      {INT8_C( 120), INT8_C( 121), INT8_C( 122), INT8_C( 120), INT8_C( 121), INT8_C( 122), INT8_C( 120), INT8_C( 121), INT8_C( 122), INT8_C( 120), INT8_C( 121), INT8_C( 122), INT8_C( 120), INT8_C( 121), INT8_C( 122), INT8_C( 120)},
+      3,
+      { 0, 0, 0, 0, 0, 0, 0, 0 } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_si128(test_vec[i].b);
+    simde_assert_equal_i(simde_mm_cmpestra(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY), test_vec[i].r[0]);
+    simde_assert_equal_i(simde_mm_cmpestra(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_RANGES), test_vec[i].r[1]);
+    simde_assert_equal_i(simde_mm_cmpestra(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[2]);
+    simde_assert_equal_i(simde_mm_cmpestra(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_NEGATIVE_POLARITY), test_vec[i].r[3]);
+    simde_assert_equal_i(simde_mm_cmpestra(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED), test_vec[i].r[4]);
+    simde_assert_equal_i(simde_mm_cmpestra(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY), test_vec[i].r[5]);
+    simde_assert_equal_i(simde_mm_cmpestra(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[6]);
+    simde_assert_equal_i(simde_mm_cmpestra(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MASKED_POSITIVE_POLARITY | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[7]);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_cmpestrc (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t a[16];
+    int la;
+    int8_t b[16];
+    int lb;
+    int r[8];
+  } test_vec[] = {
+    { {INT8_C(  44), INT8_C(  59), INT8_C(   9), INT8_C(  13), INT8_C(  10), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122)},
+      5,
+      {INT8_C(  97), INT8_C(  44), INT8_C(  98), INT8_C(  59), INT8_C(  99), INT8_C(   9), INT8_C( 100), INT8_C(  13), INT8_C(  10), INT8_C( 101), INT8_C(  44), INT8_C( 102), INT8_C(  59), INT8_C( 103), INT8_C(   9), INT8_C( 104)},
+      16,
+      { 1, 1, 1, 1, 0, 1, 0, 0 } },
+    { {INT8_C(  65), INT8_C(  90), INT8_C(  97), INT8_C( 122), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      4,
+      {INT8_C(  72), INT8_C( 101), INT8_C( 108), INT8_C( 108), INT8_C( 111), INT8_C(  32), INT8_C(  87), INT8_C( 111), INT8_C( 114), INT8_C( 108), INT8_C( 100), INT8_C(  32), INT8_C(  48), INT8_C(  49), INT8_C(  50), INT8_C(  51)},
+      11,
+      { 0, 1, 1, 1, 0, 1, 1, 0 } },
+    { {INT8_C( 110), INT8_C( 101), INT8_C( 101), INT8_C( 100), INT8_C( 108), INT8_C( 101), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120)},
+      6,
+      {INT8_C( 104), INT8_C(  97), INT8_C( 121), INT8_C( 115), INT8_C( 116), INT8_C(  97), INT8_C(  99), INT8_C( 107), INT8_C( 110), INT8_C( 101), INT8_C( 101), INT8_C( 100), INT8_C( 108), INT8_C( 101), INT8_C( 110), INT8_C( 101)},
+      16,
+      { 1, 0, 0, 1, 1, 1, 1, 1 } },
+    { {INT8_C( 110), INT8_C( 101), INT8_C( 101), INT8_C( 100), INT8_C( 108), INT8_C( 101), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120)},
+      6,
+      {INT8_C( 104), INT8_C(  97), INT8_C( 121), INT8_C( 115), INT8_C( 116), INT8_C(  97), INT8_C(  99), INT8_C( 107), INT8_C( 104), INT8_C(  97), INT8_C( 121), INT8_C( 115), INT8_C( 116), INT8_C( 110), INT8_C( 101), INT8_C( 101)},
+      16,
+      { 1, 0, 0, 1, 1, 1, 1, 0 } },
+    { {INT8_C(-128), INT8_C(  -1), INT8_C(   1), INT8_C( 127), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      -4,
+      {INT8_C(-127), INT8_C(   0), INT8_C( 127), INT8_C(-128), INT8_C(  -1), INT8_C(  16), INT8_C(  97), INT8_C(  98), INT8_C(  99), INT8_C( 100), INT8_C( 101), INT8_C( 102), INT8_C( 103), INT8_C( 104), INT8_C( 105), INT8_C( 106)},
+      -100,
+      { 1, 1, 1, 1, 0, 1, 1, 0 } },
+    { {INT8_C(  97), INT8_C(  98), INT8_C(  99), INT8_C( 100), INT8_C( 101), INT8_C( 102), INT8_C( 103), INT8_C( 104), INT8_C( 105), INT8_C( 106), INT8_C( 107), INT8_C( 108), INT8_C( 109), INT8_C( 110), INT8_C( 111), INT8_C( 112)},
+      20,
+      {INT8_C(  97), INT8_C(  98), INT8_C(  99), INT8_C( 100), INT8_C( 101), INT8_C( 102), INT8_C( 103), INT8_C( 104), INT8_C( 105), INT8_C( 106), INT8_C( 107), INT8_C( 108), INT8_C( 109), INT8_C( 110), INT8_C( 111), INT8_C( 122)},
+      9,
+      { 1, 1, 1, 1, 0, 1, 1, 0 } },
+    { {INT8_C(  48), INT8_C(   0), INT8_C(  57), INT8_C(   0), INT8_C(  97), INT8_C(   0), INT8_C( 102), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      4,
+      {INT8_C(  49), INT8_C(   0), INT8_C( 120), INT8_C(   0), INT8_C(  98), INT8_C(   0), INT8_C(  71), INT8_C(   0), INT8_C(  57), INT8_C(   0), INT8_C( 122), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      6,
+      { 1, 0, 0, 1, 0, 1, 1, 0 } },
+    { {INT8_C( 120), INT8_C( 121), INT8_C( 122), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      0,
+      {INT8_C( 120), INT8_C( 121), INT8_C( 122), INT8_C( 120), INT8_C( 121), INT8_C( 122), INT8_C( 120), INT8_C( 121), INT8_C( 122), INT8_C( 120), INT8_C( 121), INT8_C( 122), INT8_C( 120), INT8_C( 121), INT8_C( 122), INT8_C( 120)},
+      3,
+      { 0, 0, 0, 1, 1, 1, 0, 1 } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_si128(test_vec[i].b);
+    simde_assert_equal_i(simde_mm_cmpestrc(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY), test_vec[i].r[0]);
+    simde_assert_equal_i(simde_mm_cmpestrc(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_RANGES), test_vec[i].r[1]);
+    simde_assert_equal_i(simde_mm_cmpestrc(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[2]);
+    simde_assert_equal_i(simde_mm_cmpestrc(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_NEGATIVE_POLARITY), test_vec[i].r[3]);
+    simde_assert_equal_i(simde_mm_cmpestrc(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED), test_vec[i].r[4]);
+    simde_assert_equal_i(simde_mm_cmpestrc(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY), test_vec[i].r[5]);
+    simde_assert_equal_i(simde_mm_cmpestrc(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[6]);
+    simde_assert_equal_i(simde_mm_cmpestrc(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MASKED_POSITIVE_POLARITY | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[7]);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_cmpestro (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t a[16];
+    int la;
+    int8_t b[16];
+    int lb;
+    int r[8];
+  } test_vec[] = {
+    { {INT8_C(  44), INT8_C(  59), INT8_C(   9), INT8_C(  13), INT8_C(  10), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122)},
+      5,
+      {INT8_C(  97), INT8_C(  44), INT8_C(  98), INT8_C(  59), INT8_C(  99), INT8_C(   9), INT8_C( 100), INT8_C(  13), INT8_C(  10), INT8_C( 101), INT8_C(  44), INT8_C( 102), INT8_C(  59), INT8_C( 103), INT8_C(   9), INT8_C( 104)},
+      16,
+      { 0, 0, 0, 1, 0, 1, 0, 0 } },
+    { {INT8_C(  65), INT8_C(  90), INT8_C(  97), INT8_C( 122), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      4,
+      {INT8_C(  72), INT8_C( 101), INT8_C( 108), INT8_C( 108), INT8_C( 111), INT8_C(  32), INT8_C(  87), INT8_C( 111), INT8_C( 114), INT8_C( 108), INT8_C( 100), INT8_C(  32), INT8_C(  48), INT8_C(  49), INT8_C(  50), INT8_C(  51)},
+      11,
+      { 0, 1, 1, 1, 0, 1, 1, 0 } },
+    { {INT8_C( 110), INT8_C( 101), INT8_C( 101), INT8_C( 100), INT8_C( 108), INT8_C( 101), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120)},
+      6,
+      {INT8_C( 104), INT8_C(  97), INT8_C( 121), INT8_C( 115), INT8_C( 116), INT8_C(  97), INT8_C(  99), INT8_C( 107), INT8_C( 110), INT8_C( 101), INT8_C( 101), INT8_C( 100), INT8_C( 108), INT8_C( 101), INT8_C( 110), INT8_C( 101)},
+      16,
+      { 0, 0, 0, 1, 0, 1, 0, 0 } },
+    { {INT8_C( 110), INT8_C( 101), INT8_C( 101), INT8_C( 100), INT8_C( 108), INT8_C( 101), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120)},
+      6,
+      {INT8_C( 104), INT8_C(  97), INT8_C( 121), INT8_C( 115), INT8_C( 116), INT8_C(  97), INT8_C(  99), INT8_C( 107), INT8_C( 104), INT8_C(  97), INT8_C( 121), INT8_C( 115), INT8_C( 116), INT8_C( 110), INT8_C( 101), INT8_C( 101)},
+      16,
+      { 0, 0, 0, 1, 0, 1, 0, 0 } },
+    { {INT8_C(-128), INT8_C(  -1), INT8_C(   1), INT8_C( 127), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      -4,
+      {INT8_C(-127), INT8_C(   0), INT8_C( 127), INT8_C(-128), INT8_C(  -1), INT8_C(  16), INT8_C(  97), INT8_C(  98), INT8_C(  99), INT8_C( 100), INT8_C( 101), INT8_C( 102), INT8_C( 103), INT8_C( 104), INT8_C( 105), INT8_C( 106)},
+      -100,
+      { 0, 1, 1, 1, 0, 1, 1, 0 } },
+    { {INT8_C(  97), INT8_C(  98), INT8_C(  99), INT8_C( 100), INT8_C( 101), INT8_C( 102), INT8_C( 103), INT8_C( 104), INT8_C( 105), INT8_C( 106), INT8_C( 107), INT8_C( 108), INT8_C( 109), INT8_C( 110), INT8_C( 111), INT8_C( 112)},
+      20,
+      {INT8_C(  97), INT8_C(  98), INT8_C(  99), INT8_C( 100), INT8_C( 101), INT8_C( 102), INT8_C( 103), INT8_C( 104), INT8_C( 105), INT8_C( 106), INT8_C( 107), INT8_C( 108), INT8_C( 109), INT8_C( 110), INT8_C( 111), INT8_C( 122)},
+      9,
+      { 1, 1, 1, 0, 0, 0, 1, 0 } },
+    { {INT8_C(  48), INT8_C(   0), INT8_C(  57), INT8_C(   0), INT8_C(  97), INT8_C(   0), INT8_C( 102), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      4,
+      {INT8_C(  49), INT8_C(   0), INT8_C( 120), INT8_C(   0), INT8_C(  98), INT8_C(   0), INT8_C(  71), INT8_C(   0), INT8_C(  57), INT8_C(   0), INT8_C( 122), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      6,
+      { 0, 0, 0, 1, 0, 1, 1, 0 } },
+    { {INT8_C( 120), INT8_C( 121), INT8_C( 122), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      0,
+      {INT8_C( 120), INT8_C( 121), INT8_C( 122), INT8_C( 120), INT8_C( 121), INT8_C( 122), INT8_C( 120), INT8_C( 121), INT8_C( 122), INT8_C( 120), INT8_C( 121), INT8_C( 122), INT8_C( 120), INT8_C( 121), INT8_C( 122), INT8_C( 120)},
+      3,
+      { 0, 0, 0, 1, 1, 1, 0, 1 } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_si128(test_vec[i].b);
+    simde_assert_equal_i(simde_mm_cmpestro(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY), test_vec[i].r[0]);
+    simde_assert_equal_i(simde_mm_cmpestro(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_RANGES), test_vec[i].r[1]);
+    simde_assert_equal_i(simde_mm_cmpestro(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[2]);
+    simde_assert_equal_i(simde_mm_cmpestro(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_NEGATIVE_POLARITY), test_vec[i].r[3]);
+    simde_assert_equal_i(simde_mm_cmpestro(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED), test_vec[i].r[4]);
+    simde_assert_equal_i(simde_mm_cmpestro(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY), test_vec[i].r[5]);
+    simde_assert_equal_i(simde_mm_cmpestro(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[6]);
+    simde_assert_equal_i(simde_mm_cmpestro(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MASKED_POSITIVE_POLARITY | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[7]);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_cmpestrm (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t a[16];
+    int la;
+    int8_t b[16];
+    int lb;
+    int8_t r[4][16];
+  } test_vec[] = {
+    { {INT8_C(  44), INT8_C(  59), INT8_C(   9), INT8_C(  13), INT8_C(  10), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122), INT8_C( 122)},
+      5,
+      {INT8_C(  97), INT8_C(  44), INT8_C(  98), INT8_C(  59), INT8_C(  99), INT8_C(   9), INT8_C( 100), INT8_C(  13), INT8_C(  10), INT8_C( 101), INT8_C(  44), INT8_C( 102), INT8_C(  59), INT8_C( 103), INT8_C(   9), INT8_C( 104)},
+      16,
+      { {INT8_C(   0), INT8_C(  -1), INT8_C(   0), INT8_C(  -1), INT8_C(   0), INT8_C(  -1), INT8_C(   0), INT8_C(  -1), INT8_C(  -1), INT8_C(   0), INT8_C(  -1), INT8_C(   0), INT8_C(  -1), INT8_C(   0), INT8_C(  -1), INT8_C(   0)},
+        {INT8_C( -86), INT8_C(  85), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1)} } },
+    { {INT8_C(  65), INT8_C(  90), INT8_C(  97), INT8_C( 122), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      4,
+      {INT8_C(  72), INT8_C( 101), INT8_C( 108), INT8_C( 108), INT8_C( 111), INT8_C(  32), INT8_C(  87), INT8_C( 111), INT8_C( 114), INT8_C( 108), INT8_C( 100), INT8_C(  32), INT8_C(  48), INT8_C(  49), INT8_C(  50), INT8_C(  51)},
+      11,
+      { {INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C( -33), INT8_C(   7), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1)} } },
+    { {INT8_C( 110), INT8_C( 101), INT8_C( 101), INT8_C( 100), INT8_C( 108), INT8_C( 101), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120)},
+      6,
+      {INT8_C( 104), INT8_C(  97), INT8_C( 121), INT8_C( 115), INT8_C( 116), INT8_C(  97), INT8_C(  99), INT8_C( 107), INT8_C( 110), INT8_C( 101), INT8_C( 101), INT8_C( 100), INT8_C( 108), INT8_C( 101), INT8_C( 110), INT8_C( 101)},
+      16,
+      { {INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1)},
+        {INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  -1), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  -1), INT8_C(   0)},
+        {INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1)} } },
+    { {INT8_C( 110), INT8_C( 101), INT8_C( 101), INT8_C( 100), INT8_C( 108), INT8_C( 101), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120), INT8_C( 120)},
+      6,
+      {INT8_C( 104), INT8_C(  97), INT8_C( 121), INT8_C( 115), INT8_C( 116), INT8_C(  97), INT8_C(  99), INT8_C( 107), INT8_C( 104), INT8_C(  97), INT8_C( 121), INT8_C( 115), INT8_C( 116), INT8_C( 110), INT8_C( 101), INT8_C( 101)},
+      16,
+      { {INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1)},
+        {INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  -1), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1)} } },
+    { {INT8_C(-128), INT8_C(  -1), INT8_C(   1), INT8_C( 127), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      -4,
+      {INT8_C(-127), INT8_C(   0), INT8_C( 127), INT8_C(-128), INT8_C(  -1), INT8_C(  16), INT8_C(  97), INT8_C(  98), INT8_C(  99), INT8_C( 100), INT8_C( 101), INT8_C( 102), INT8_C( 103), INT8_C( 104), INT8_C( 105), INT8_C( 106)},
+      -100,
+      { {INT8_C(   0), INT8_C(   0), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(  -3), INT8_C(  -1), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1)} } },
+    { {INT8_C(  97), INT8_C(  98), INT8_C(  99), INT8_C( 100), INT8_C( 101), INT8_C( 102), INT8_C( 103), INT8_C( 104), INT8_C( 105), INT8_C( 106), INT8_C( 107), INT8_C( 108), INT8_C( 109), INT8_C( 110), INT8_C( 111), INT8_C( 112)},
+      20,
+      {INT8_C(  97), INT8_C(  98), INT8_C(  99), INT8_C( 100), INT8_C( 101), INT8_C( 102), INT8_C( 103), INT8_C( 104), INT8_C( 105), INT8_C( 106), INT8_C( 107), INT8_C( 108), INT8_C( 109), INT8_C( 110), INT8_C( 111), INT8_C( 122)},
+      9,
+      { {INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(  -1), INT8_C(   1), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  -1), INT8_C(  -1)} } },
+    { {INT8_C(  48), INT8_C(   0), INT8_C(  57), INT8_C(   0), INT8_C(  97), INT8_C(   0), INT8_C( 102), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      4,
+      {INT8_C(  49), INT8_C(   0), INT8_C( 120), INT8_C(   0), INT8_C(  98), INT8_C(   0), INT8_C(  71), INT8_C(   0), INT8_C(  57), INT8_C(   0), INT8_C( 122), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      6,
+      { {INT8_C(   0), INT8_C(  -1), INT8_C(   0), INT8_C(  -1), INT8_C(   0), INT8_C(  -1), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)} } },
+    { {INT8_C( 120), INT8_C( 121), INT8_C( 122), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      0,
+      {INT8_C( 120), INT8_C( 121), INT8_C( 122), INT8_C( 120), INT8_C( 121), INT8_C( 122), INT8_C( 120), INT8_C( 121), INT8_C( 122), INT8_C( 120), INT8_C( 121), INT8_C( 122), INT8_C( 120), INT8_C( 121), INT8_C( 122), INT8_C( 120)},
+      3,
+      { {INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1)},
+        {INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)} } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_si128(test_vec[i].b);
+    simde_test_x86_assert_equal_i8x16(simde_mm_cmpestrm(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_UNIT_MASK), simde_mm_loadu_si128(test_vec[i].r[0]));
+    simde_test_x86_assert_equal_i8x16(simde_mm_cmpestrm(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_BIT_MASK), simde_mm_loadu_si128(test_vec[i].r[1]));
+    simde_test_x86_assert_equal_i8x16(simde_mm_cmpestrm(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_UNIT_MASK), simde_mm_loadu_si128(test_vec[i].r[2]));
+    simde_test_x86_assert_equal_i8x16(simde_mm_cmpestrm(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_NEGATIVE_POLARITY | SIMDE_SIDD_UNIT_MASK), simde_mm_loadu_si128(test_vec[i].r[3]));
+  }
+
+  return 0;
+}
 static int
 test_simde_mm_cmpestrs_8(SIMDE_MUNIT_TEST_ARGS) {
   const struct {
@@ -428,6 +782,271 @@ test_simde_mm_cmpgt_epi64(SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm_cmpistri (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t a[16];
+    int8_t b[16];
+    int r[8];
+  } test_vec[] = {
+    { {INT8_C(  34), INT8_C(  44), INT8_C(  58), INT8_C( 123), INT8_C( 125), INT8_C(  91), INT8_C(  93), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      {INT8_C( 123), INT8_C(  34), INT8_C( 107), INT8_C( 101), INT8_C( 121), INT8_C(  34), INT8_C(  58), INT8_C(  32), INT8_C(  91), INT8_C(  49), INT8_C(  44), INT8_C(  32), INT8_C(  50), INT8_C(  93), INT8_C( 125), INT8_C( 120)},
+      { 0, 0, 15, 0, 16, 0, 7, 8 } },
+    { {INT8_C(  97), INT8_C( 122), INT8_C(  65), INT8_C(  90), INT8_C(  48), INT8_C(  57), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      {INT8_C(  72), INT8_C( 101), INT8_C( 108), INT8_C( 108), INT8_C( 111), INT8_C(  44), INT8_C(  32), INT8_C(  87), INT8_C( 111), INT8_C( 114), INT8_C( 108), INT8_C( 100), INT8_C(  32), INT8_C(  52), INT8_C(  50), INT8_C(  33)},
+      { 16, 0, 14, 0, 16, 0, 8, 8 } },
+    { {INT8_C(  92), INT8_C(  34), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      {INT8_C(  97), INT8_C(  98), INT8_C(  99), INT8_C(  92), INT8_C(  34), INT8_C( 100), INT8_C( 101), INT8_C( 102), INT8_C(  34), INT8_C(   0), INT8_C( 103), INT8_C( 104), INT8_C( 105), INT8_C( 106), INT8_C( 107), INT8_C( 108)},
+      { 3, 16, 16, 0, 3, 0, 8, 8 } },
+    { {INT8_C( 107), INT8_C( 101), INT8_C( 121), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      {INT8_C(  97), INT8_C( 107), INT8_C( 101), INT8_C( 121), INT8_C(  61), INT8_C( 107), INT8_C( 101), INT8_C( 107), INT8_C( 101), INT8_C( 121), INT8_C(   0), INT8_C( 107), INT8_C( 101), INT8_C( 121), INT8_C( 122), INT8_C( 122)},
+      { 1, 16, 16, 0, 1, 0, 8, 8 } },
+    { {INT8_C(-128), INT8_C(  -1), INT8_C(   1), INT8_C( 127), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      {INT8_C(-127), INT8_C(   0), INT8_C( 127), INT8_C(-128), INT8_C(  -1), INT8_C(  16), INT8_C(  97), INT8_C(  98), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      { 16, 0, 0, 0, 16, 0, 3, 8 } },
+    { {INT8_C(  97), INT8_C(  98), INT8_C(  99), INT8_C( 100), INT8_C( 101), INT8_C( 102), INT8_C( 103), INT8_C( 104), INT8_C( 105), INT8_C( 106), INT8_C( 107), INT8_C( 108), INT8_C( 109), INT8_C( 110), INT8_C( 111), INT8_C( 112)},
+      {INT8_C(  97), INT8_C(  98), INT8_C(  99), INT8_C( 100), INT8_C( 101), INT8_C( 102), INT8_C( 103), INT8_C( 104), INT8_C( 105), INT8_C( 106), INT8_C( 107), INT8_C( 108), INT8_C( 109), INT8_C( 110), INT8_C( 111), INT8_C( 122)},
+      { 0, 0, 14, 15, 16, 7, 6, 8 } },
+    { {INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      {INT8_C( 110), INT8_C( 111), INT8_C( 116), INT8_C( 104), INT8_C( 105), INT8_C( 110), INT8_C( 103), INT8_C(  32), INT8_C( 116), INT8_C( 111), INT8_C(  32), INT8_C( 109), INT8_C(  97), INT8_C( 116), INT8_C(  99), INT8_C( 104)},
+      { 16, 16, 16, 0, 0, 0, 8, 7 } },
+    { {INT8_C(  48), INT8_C(   0), INT8_C(  57), INT8_C(   0), INT8_C(  97), INT8_C(   0), INT8_C( 102), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      {INT8_C(  49), INT8_C(   0), INT8_C( 120), INT8_C(   0), INT8_C(  98), INT8_C(   0), INT8_C(  71), INT8_C(   0), INT8_C(  57), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      { 16, 16, 16, 0, 16, 0, 4, 8 } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_si128(test_vec[i].b);
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY), test_vec[i].r[0]);
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_RANGES), test_vec[i].r[1]);
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[2]);
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_NEGATIVE_POLARITY), test_vec[i].r[3]);
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED), test_vec[i].r[4]);
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY), test_vec[i].r[5]);
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[6]);
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MASKED_POSITIVE_POLARITY | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[7]);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_cmpistra (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t a[16];
+    int8_t b[16];
+    int r[8];
+  } test_vec[] = {
+    { {INT8_C(  34), INT8_C(  44), INT8_C(  58), INT8_C( 123), INT8_C( 125), INT8_C(  91), INT8_C(  93), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      {INT8_C( 123), INT8_C(  34), INT8_C( 107), INT8_C( 101), INT8_C( 121), INT8_C(  34), INT8_C(  58), INT8_C(  32), INT8_C(  91), INT8_C(  49), INT8_C(  44), INT8_C(  32), INT8_C(  50), INT8_C(  93), INT8_C( 125), INT8_C( 120)},
+      { 0, 0, 0, 0, 1, 0, 0, 1 } },
+    { {INT8_C(  97), INT8_C( 122), INT8_C(  65), INT8_C(  90), INT8_C(  48), INT8_C(  57), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      {INT8_C(  72), INT8_C( 101), INT8_C( 108), INT8_C( 108), INT8_C( 111), INT8_C(  44), INT8_C(  32), INT8_C(  87), INT8_C( 111), INT8_C( 114), INT8_C( 108), INT8_C( 100), INT8_C(  32), INT8_C(  52), INT8_C(  50), INT8_C(  33)},
+      { 1, 0, 0, 0, 1, 0, 1, 1 } },
+    { {INT8_C(  92), INT8_C(  34), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      {INT8_C(  97), INT8_C(  98), INT8_C(  99), INT8_C(  92), INT8_C(  34), INT8_C( 100), INT8_C( 101), INT8_C( 102), INT8_C(  34), INT8_C(   0), INT8_C( 103), INT8_C( 104), INT8_C( 105), INT8_C( 106), INT8_C( 107), INT8_C( 108)},
+      { 0, 0, 0, 0, 0, 0, 1, 1 } },
+    { {INT8_C( 107), INT8_C( 101), INT8_C( 121), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      {INT8_C(  97), INT8_C( 107), INT8_C( 101), INT8_C( 121), INT8_C(  61), INT8_C( 107), INT8_C( 101), INT8_C( 107), INT8_C( 101), INT8_C( 121), INT8_C(   0), INT8_C( 107), INT8_C( 101), INT8_C( 121), INT8_C( 122), INT8_C( 122)},
+      { 0, 0, 0, 0, 0, 0, 1, 1 } },
+    { {INT8_C(-128), INT8_C(  -1), INT8_C(   1), INT8_C( 127), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      {INT8_C(-127), INT8_C(   0), INT8_C( 127), INT8_C(-128), INT8_C(  -1), INT8_C(  16), INT8_C(  97), INT8_C(  98), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      { 0, 0, 0, 0, 0, 0, 0, 0 } },
+    { {INT8_C(  97), INT8_C(  98), INT8_C(  99), INT8_C( 100), INT8_C( 101), INT8_C( 102), INT8_C( 103), INT8_C( 104), INT8_C( 105), INT8_C( 106), INT8_C( 107), INT8_C( 108), INT8_C( 109), INT8_C( 110), INT8_C( 111), INT8_C( 112)},
+      {INT8_C(  97), INT8_C(  98), INT8_C(  99), INT8_C( 100), INT8_C( 101), INT8_C( 102), INT8_C( 103), INT8_C( 104), INT8_C( 105), INT8_C( 106), INT8_C( 107), INT8_C( 108), INT8_C( 109), INT8_C( 110), INT8_C( 111), INT8_C( 122)},
+      { 0, 0, 0, 0, 1, 0, 0, 1 } },
+    { {INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      {INT8_C( 110), INT8_C( 111), INT8_C( 116), INT8_C( 104), INT8_C( 105), INT8_C( 110), INT8_C( 103), INT8_C(  32), INT8_C( 116), INT8_C( 111), INT8_C(  32), INT8_C( 109), INT8_C(  97), INT8_C( 116), INT8_C(  99), INT8_C( 104)},
+      { 1, 1, 1, 0, 0, 0, 1, 0 } },
+    { {INT8_C(  48), INT8_C(   0), INT8_C(  57), INT8_C(   0), INT8_C(  97), INT8_C(   0), INT8_C( 102), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      {INT8_C(  49), INT8_C(   0), INT8_C( 120), INT8_C(   0), INT8_C(  98), INT8_C(   0), INT8_C(  71), INT8_C(   0), INT8_C(  57), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      { 0, 0, 0, 0, 0, 0, 0, 0 } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_si128(test_vec[i].b);
+    simde_assert_equal_i(simde_mm_cmpistra(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY), test_vec[i].r[0]);
+    simde_assert_equal_i(simde_mm_cmpistra(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_RANGES), test_vec[i].r[1]);
+    simde_assert_equal_i(simde_mm_cmpistra(a, b, SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[2]);
+    simde_assert_equal_i(simde_mm_cmpistra(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_NEGATIVE_POLARITY), test_vec[i].r[3]);
+    simde_assert_equal_i(simde_mm_cmpistra(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED), test_vec[i].r[4]);
+    simde_assert_equal_i(simde_mm_cmpistra(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY), test_vec[i].r[5]);
+    simde_assert_equal_i(simde_mm_cmpistra(a, b, SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[6]);
+    simde_assert_equal_i(simde_mm_cmpistra(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MASKED_POSITIVE_POLARITY | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[7]);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_cmpistrc (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t a[16];
+    int8_t b[16];
+    int r[8];
+  } test_vec[] = {
+    { {INT8_C(  34), INT8_C(  44), INT8_C(  58), INT8_C( 123), INT8_C( 125), INT8_C(  91), INT8_C(  93), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      {INT8_C( 123), INT8_C(  34), INT8_C( 107), INT8_C( 101), INT8_C( 121), INT8_C(  34), INT8_C(  58), INT8_C(  32), INT8_C(  91), INT8_C(  49), INT8_C(  44), INT8_C(  32), INT8_C(  50), INT8_C(  93), INT8_C( 125), INT8_C( 120)},
+      { 1, 1, 1, 1, 0, 1, 1, 0 } },
+    { {INT8_C(  97), INT8_C( 122), INT8_C(  65), INT8_C(  90), INT8_C(  48), INT8_C(  57), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      {INT8_C(  72), INT8_C( 101), INT8_C( 108), INT8_C( 108), INT8_C( 111), INT8_C(  44), INT8_C(  32), INT8_C(  87), INT8_C( 111), INT8_C( 114), INT8_C( 108), INT8_C( 100), INT8_C(  32), INT8_C(  52), INT8_C(  50), INT8_C(  33)},
+      { 0, 1, 1, 1, 0, 1, 0, 0 } },
+    { {INT8_C(  92), INT8_C(  34), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      {INT8_C(  97), INT8_C(  98), INT8_C(  99), INT8_C(  92), INT8_C(  34), INT8_C( 100), INT8_C( 101), INT8_C( 102), INT8_C(  34), INT8_C(   0), INT8_C( 103), INT8_C( 104), INT8_C( 105), INT8_C( 106), INT8_C( 107), INT8_C( 108)},
+      { 1, 0, 0, 1, 1, 1, 0, 0 } },
+    { {INT8_C( 107), INT8_C( 101), INT8_C( 121), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      {INT8_C(  97), INT8_C( 107), INT8_C( 101), INT8_C( 121), INT8_C(  61), INT8_C( 107), INT8_C( 101), INT8_C( 107), INT8_C( 101), INT8_C( 121), INT8_C(   0), INT8_C( 107), INT8_C( 101), INT8_C( 121), INT8_C( 122), INT8_C( 122)},
+      { 1, 0, 0, 1, 1, 1, 0, 0 } },
+    { {INT8_C(-128), INT8_C(  -1), INT8_C(   1), INT8_C( 127), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      {INT8_C(-127), INT8_C(   0), INT8_C( 127), INT8_C(-128), INT8_C(  -1), INT8_C(  16), INT8_C(  97), INT8_C(  98), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      { 0, 1, 1, 1, 0, 1, 1, 0 } },
+    { {INT8_C(  97), INT8_C(  98), INT8_C(  99), INT8_C( 100), INT8_C( 101), INT8_C( 102), INT8_C( 103), INT8_C( 104), INT8_C( 105), INT8_C( 106), INT8_C( 107), INT8_C( 108), INT8_C( 109), INT8_C( 110), INT8_C( 111), INT8_C( 112)},
+      {INT8_C(  97), INT8_C(  98), INT8_C(  99), INT8_C( 100), INT8_C( 101), INT8_C( 102), INT8_C( 103), INT8_C( 104), INT8_C( 105), INT8_C( 106), INT8_C( 107), INT8_C( 108), INT8_C( 109), INT8_C( 110), INT8_C( 111), INT8_C( 122)},
+      { 1, 1, 1, 1, 0, 1, 1, 0 } },
+    { {INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      {INT8_C( 110), INT8_C( 111), INT8_C( 116), INT8_C( 104), INT8_C( 105), INT8_C( 110), INT8_C( 103), INT8_C(  32), INT8_C( 116), INT8_C( 111), INT8_C(  32), INT8_C( 109), INT8_C(  97), INT8_C( 116), INT8_C(  99), INT8_C( 104)},
+      { 0, 0, 0, 1, 1, 1, 0, 1 } },
+    { {INT8_C(  48), INT8_C(   0), INT8_C(  57), INT8_C(   0), INT8_C(  97), INT8_C(   0), INT8_C( 102), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      {INT8_C(  49), INT8_C(   0), INT8_C( 120), INT8_C(   0), INT8_C(  98), INT8_C(   0), INT8_C(  71), INT8_C(   0), INT8_C(  57), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      { 0, 0, 0, 1, 0, 1, 1, 0 } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_si128(test_vec[i].b);
+    simde_assert_equal_i(simde_mm_cmpistrc(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY), test_vec[i].r[0]);
+    simde_assert_equal_i(simde_mm_cmpistrc(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_RANGES), test_vec[i].r[1]);
+    simde_assert_equal_i(simde_mm_cmpistrc(a, b, SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[2]);
+    simde_assert_equal_i(simde_mm_cmpistrc(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_NEGATIVE_POLARITY), test_vec[i].r[3]);
+    simde_assert_equal_i(simde_mm_cmpistrc(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED), test_vec[i].r[4]);
+    simde_assert_equal_i(simde_mm_cmpistrc(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY), test_vec[i].r[5]);
+    simde_assert_equal_i(simde_mm_cmpistrc(a, b, SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[6]);
+    simde_assert_equal_i(simde_mm_cmpistrc(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MASKED_POSITIVE_POLARITY | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[7]);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_cmpistro (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t a[16];
+    int8_t b[16];
+    int r[8];
+  } test_vec[] = {
+    { {INT8_C(  34), INT8_C(  44), INT8_C(  58), INT8_C( 123), INT8_C( 125), INT8_C(  91), INT8_C(  93), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      {INT8_C( 123), INT8_C(  34), INT8_C( 107), INT8_C( 101), INT8_C( 121), INT8_C(  34), INT8_C(  58), INT8_C(  32), INT8_C(  91), INT8_C(  49), INT8_C(  44), INT8_C(  32), INT8_C(  50), INT8_C(  93), INT8_C( 125), INT8_C( 120)},
+      { 1, 1, 1, 1, 0, 1, 0, 0 } },
+    { {INT8_C(  97), INT8_C( 122), INT8_C(  65), INT8_C(  90), INT8_C(  48), INT8_C(  57), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      {INT8_C(  72), INT8_C( 101), INT8_C( 108), INT8_C( 108), INT8_C( 111), INT8_C(  44), INT8_C(  32), INT8_C(  87), INT8_C( 111), INT8_C( 114), INT8_C( 108), INT8_C( 100), INT8_C(  32), INT8_C(  52), INT8_C(  50), INT8_C(  33)},
+      { 0, 1, 1, 1, 0, 1, 0, 0 } },
+    { {INT8_C(  92), INT8_C(  34), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      {INT8_C(  97), INT8_C(  98), INT8_C(  99), INT8_C(  92), INT8_C(  34), INT8_C( 100), INT8_C( 101), INT8_C( 102), INT8_C(  34), INT8_C(   0), INT8_C( 103), INT8_C( 104), INT8_C( 105), INT8_C( 106), INT8_C( 107), INT8_C( 108)},
+      { 0, 0, 0, 1, 0, 1, 0, 0 } },
+    { {INT8_C( 107), INT8_C( 101), INT8_C( 121), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      {INT8_C(  97), INT8_C( 107), INT8_C( 101), INT8_C( 121), INT8_C(  61), INT8_C( 107), INT8_C( 101), INT8_C( 107), INT8_C( 101), INT8_C( 121), INT8_C(   0), INT8_C( 107), INT8_C( 101), INT8_C( 121), INT8_C( 122), INT8_C( 122)},
+      { 0, 0, 0, 1, 0, 1, 0, 0 } },
+    { {INT8_C(-128), INT8_C(  -1), INT8_C(   1), INT8_C( 127), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      {INT8_C(-127), INT8_C(   0), INT8_C( 127), INT8_C(-128), INT8_C(  -1), INT8_C(  16), INT8_C(  97), INT8_C(  98), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      { 0, 1, 1, 1, 0, 1, 1, 0 } },
+    { {INT8_C(  97), INT8_C(  98), INT8_C(  99), INT8_C( 100), INT8_C( 101), INT8_C( 102), INT8_C( 103), INT8_C( 104), INT8_C( 105), INT8_C( 106), INT8_C( 107), INT8_C( 108), INT8_C( 109), INT8_C( 110), INT8_C( 111), INT8_C( 112)},
+      {INT8_C(  97), INT8_C(  98), INT8_C(  99), INT8_C( 100), INT8_C( 101), INT8_C( 102), INT8_C( 103), INT8_C( 104), INT8_C( 105), INT8_C( 106), INT8_C( 107), INT8_C( 108), INT8_C( 109), INT8_C( 110), INT8_C( 111), INT8_C( 122)},
+      { 1, 1, 1, 0, 0, 0, 1, 0 } },
+    { {INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      {INT8_C( 110), INT8_C( 111), INT8_C( 116), INT8_C( 104), INT8_C( 105), INT8_C( 110), INT8_C( 103), INT8_C(  32), INT8_C( 116), INT8_C( 111), INT8_C(  32), INT8_C( 109), INT8_C(  97), INT8_C( 116), INT8_C(  99), INT8_C( 104)},
+      { 0, 0, 0, 1, 1, 1, 0, 1 } },
+    { {INT8_C(  48), INT8_C(   0), INT8_C(  57), INT8_C(   0), INT8_C(  97), INT8_C(   0), INT8_C( 102), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      {INT8_C(  49), INT8_C(   0), INT8_C( 120), INT8_C(   0), INT8_C(  98), INT8_C(   0), INT8_C(  71), INT8_C(   0), INT8_C(  57), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      { 0, 0, 0, 1, 0, 1, 1, 0 } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_si128(test_vec[i].b);
+    simde_assert_equal_i(simde_mm_cmpistro(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY), test_vec[i].r[0]);
+    simde_assert_equal_i(simde_mm_cmpistro(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_RANGES), test_vec[i].r[1]);
+    simde_assert_equal_i(simde_mm_cmpistro(a, b, SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[2]);
+    simde_assert_equal_i(simde_mm_cmpistro(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_NEGATIVE_POLARITY), test_vec[i].r[3]);
+    simde_assert_equal_i(simde_mm_cmpistro(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED), test_vec[i].r[4]);
+    simde_assert_equal_i(simde_mm_cmpistro(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY), test_vec[i].r[5]);
+    simde_assert_equal_i(simde_mm_cmpistro(a, b, SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[6]);
+    simde_assert_equal_i(simde_mm_cmpistro(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MASKED_POSITIVE_POLARITY | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[7]);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_cmpistrm (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t a[16];
+    int8_t b[16];
+    int8_t r[4][16];
+  } test_vec[] = {
+    { {INT8_C(  34), INT8_C(  44), INT8_C(  58), INT8_C( 123), INT8_C( 125), INT8_C(  91), INT8_C(  93), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      {INT8_C( 123), INT8_C(  34), INT8_C( 107), INT8_C( 101), INT8_C( 121), INT8_C(  34), INT8_C(  58), INT8_C(  32), INT8_C(  91), INT8_C(  49), INT8_C(  44), INT8_C(  32), INT8_C(  50), INT8_C(  93), INT8_C( 125), INT8_C( 120)},
+      { {INT8_C(  -1), INT8_C(  -1), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  -1), INT8_C(  -1), INT8_C(   0), INT8_C(  -1), INT8_C(   0), INT8_C(  -1), INT8_C(   0), INT8_C(   0), INT8_C(  -1), INT8_C(  -1), INT8_C(   0)},
+        {INT8_C( 127), INT8_C( -91), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1)} } },
+    { {INT8_C(  97), INT8_C( 122), INT8_C(  65), INT8_C(  90), INT8_C(  48), INT8_C(  57), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      {INT8_C(  72), INT8_C( 101), INT8_C( 108), INT8_C( 108), INT8_C( 111), INT8_C(  44), INT8_C(  32), INT8_C(  87), INT8_C( 111), INT8_C( 114), INT8_C( 108), INT8_C( 100), INT8_C(  32), INT8_C(  52), INT8_C(  50), INT8_C(  33)},
+      { {INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C( -97), INT8_C( 111), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1)} } },
+    { {INT8_C(  92), INT8_C(  34), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      {INT8_C(  97), INT8_C(  98), INT8_C(  99), INT8_C(  92), INT8_C(  34), INT8_C( 100), INT8_C( 101), INT8_C( 102), INT8_C(  34), INT8_C(   0), INT8_C( 103), INT8_C( 104), INT8_C( 105), INT8_C( 106), INT8_C( 107), INT8_C( 108)},
+      { {INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  -1), INT8_C(  -1), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  -1), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  -1), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1)} } },
+    { {INT8_C( 107), INT8_C( 101), INT8_C( 121), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      {INT8_C(  97), INT8_C( 107), INT8_C( 101), INT8_C( 121), INT8_C(  61), INT8_C( 107), INT8_C( 101), INT8_C( 107), INT8_C( 101), INT8_C( 121), INT8_C(   0), INT8_C( 107), INT8_C( 101), INT8_C( 121), INT8_C( 122), INT8_C( 122)},
+      { {INT8_C(   0), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(   0), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(   0), INT8_C(  -1), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  -1), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1)} } },
+    { {INT8_C(-128), INT8_C(  -1), INT8_C(   1), INT8_C( 127), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      {INT8_C(-127), INT8_C(   0), INT8_C( 127), INT8_C(-128), INT8_C(  -1), INT8_C(  16), INT8_C(  97), INT8_C(  98), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      { {INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(   1), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)} } },
+    { {INT8_C(  97), INT8_C(  98), INT8_C(  99), INT8_C( 100), INT8_C( 101), INT8_C( 102), INT8_C( 103), INT8_C( 104), INT8_C( 105), INT8_C( 106), INT8_C( 107), INT8_C( 108), INT8_C( 109), INT8_C( 110), INT8_C( 111), INT8_C( 112)},
+      {INT8_C(  97), INT8_C(  98), INT8_C(  99), INT8_C( 100), INT8_C( 101), INT8_C( 102), INT8_C( 103), INT8_C( 104), INT8_C( 105), INT8_C( 106), INT8_C( 107), INT8_C( 108), INT8_C( 109), INT8_C( 110), INT8_C( 111), INT8_C( 122)},
+      { {INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(   0)},
+        {INT8_C(  -1), INT8_C( 127), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(  -1), INT8_C(  -1)} } },
+    { {INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      {INT8_C( 110), INT8_C( 111), INT8_C( 116), INT8_C( 104), INT8_C( 105), INT8_C( 110), INT8_C( 103), INT8_C(  32), INT8_C( 116), INT8_C( 111), INT8_C(  32), INT8_C( 109), INT8_C(  97), INT8_C( 116), INT8_C(  99), INT8_C( 104)},
+      { {INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1)},
+        {INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1)} } },
+    { {INT8_C(  48), INT8_C(   0), INT8_C(  57), INT8_C(   0), INT8_C(  97), INT8_C(   0), INT8_C( 102), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      {INT8_C(  49), INT8_C(   0), INT8_C( 120), INT8_C(   0), INT8_C(  98), INT8_C(   0), INT8_C(  71), INT8_C(   0), INT8_C(  57), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+      { {INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)},
+        {INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(  -1), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0), INT8_C(   0)} } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128i b = simde_mm_loadu_si128(test_vec[i].b);
+    simde_test_x86_assert_equal_i8x16(simde_mm_cmpistrm(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_UNIT_MASK), simde_mm_loadu_si128(test_vec[i].r[0]));
+    simde_test_x86_assert_equal_i8x16(simde_mm_cmpistrm(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_BIT_MASK), simde_mm_loadu_si128(test_vec[i].r[1]));
+    simde_test_x86_assert_equal_i8x16(simde_mm_cmpistrm(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_UNIT_MASK), simde_mm_loadu_si128(test_vec[i].r[2]));
+    simde_test_x86_assert_equal_i8x16(simde_mm_cmpistrm(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_NEGATIVE_POLARITY | SIMDE_SIDD_UNIT_MASK), simde_mm_loadu_si128(test_vec[i].r[3]));
+  }
+
+  return 0;
+}
+
 static int
 test_simde_mm_cmpistrs_8(SIMDE_MUNIT_TEST_ARGS) {
   const struct {
@@ -1063,12 +1682,61 @@ test_simde_mm_crc32_u64 (SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_x_crc32c_buffer (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    size_t offset;
+    size_t len;
+    uint32_t crc;
+    uint32_t r;
+  } test_vec[] = {
+    {    0,    0, UINT32_C(0xffffffff), UINT32_C(0xffffffff) },
+    {    0,    1, UINT32_C(0xffffffff), UINT32_C(0x12aae07d) },
+    {    3,    7, UINT32_C(0x12345678), UINT32_C(0x4f3f0dc5) },
+    {    1,   63, UINT32_C(0xffffffff), UINT32_C(0x9cc3dddd) },
+    {    0,   64, UINT32_C(0x00000000), UINT32_C(0xfcc4018a) },
+    {    5,  100, UINT32_C(0xdeadbeef), UINT32_C(0x555e7096) },
+    {    7,  255, UINT32_C(0xffffffff), UINT32_C(0x3071b886) },
+    {   16,  512, UINT32_C(0x9e3779b9), UINT32_C(0x35b64955) },
+    {   13, 1000, UINT32_C(0xffffffff), UINT32_C(0xdd8167e1) },
+    {    0, 1024, UINT32_C(0xffffffff), UINT32_C(0x5ddd396b) },
+    /* Long enough to go around the 64-byte fold loop many times. */
+    {    0,  128, UINT32_C(0xffffffff), UINT32_C(0x34505e4e) },
+    {   64, 4096, UINT32_C(0x00000000), UINT32_C(0x8b6346e0) },
+    {    3, 4157, UINT32_C(0x12345678), UINT32_C(0xe0532f50) },
+    {    1, 4223, UINT32_C(0xffffffff), UINT32_C(0x48c0eb94) },
+  };
+  uint8_t data[4224];
+
+  for (size_t i = 0 ; i < sizeof(data) ; i++)
+    data[i] = HEDLEY_STATIC_CAST(uint8_t, (i * 167 + 13) ^ (i >> 3));
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_x_crc32c_buffer(test_vec[i].crc, data + test_vec[i].offset, test_vec[i].len);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  simde_assert_equal_u32(~simde_x_crc32c_buffer(~UINT32_C(0), "123456789", 9), UINT32_C(0xe3069283));
+
+  return 0;
+}
+
 SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpestri)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpestra)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpestrc)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpestro)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpestrm)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpestrs_8)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpestrs_16)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpestrz_8)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpestrz_16)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpgt_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpistri)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpistra)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpistrc)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpistro)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpistrm)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpistrs_8)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpistrs_16)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpistrz_8)
@@ -1077,6 +1745,7 @@ SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_crc32_u16)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_crc32_u32)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_crc32_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(x_crc32c_buffer)
 SIMDE_TEST_FUNC_LIST_END
 
 #include <test/x86/test-x86-footer.h>
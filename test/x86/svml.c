@@ -5895,7 +5895,11 @@ test_simde_mm_cbrt_ps (SIMDE_MUNIT_TEST_ARGS) {
     { { SIMDE_FLOAT32_C(   382.46), SIMDE_FLOAT32_C(   327.49), SIMDE_FLOAT32_C(  -186.96), SIMDE_FLOAT32_C(   913.54) },
       { SIMDE_FLOAT32_C(     7.26), SIMDE_FLOAT32_C(     6.89), SIMDE_FLOAT32_C(    -5.72), SIMDE_FLOAT32_C(     9.70) } },
     { { SIMDE_FLOAT32_C(   619.00), SIMDE_FLOAT32_C(   936.03), SIMDE_FLOAT32_C(    27.91), SIMDE_FLOAT32_C(  -614.95) },
-      { SIMDE_FLOAT32_C(     8.52), SIMDE_FLOAT32_C(     9.78), SIMDE_FLOAT32_C(     3.03), SIMDE_FLOAT32_C(    -8.50) } }
+      { SIMDE_FLOAT32_C(     8.52), SIMDE_FLOAT32_C(     9.78), SIMDE_FLOAT32_C(     3.03), SIMDE_FLOAT32_C(    -8.50) } },
+    { {      -SIMDE_MATH_INFINITYF,       SIMDE_MATH_INFINITYF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    -0.00) },
+      {      -SIMDE_MATH_INFINITYF,       SIMDE_MATH_INFINITYF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    -0.00) } },
+    { { SIMDE_FLOAT32_C(   -27.00), SIMDE_FLOAT32_C(    8e-30), SIMDE_FLOAT32_C(    1e-40), SIMDE_FLOAT32_C(    0.125) },
+      { SIMDE_FLOAT32_C(    -3.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.50) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -5928,7 +5932,11 @@ test_simde_mm_cbrt_pd (SIMDE_MUNIT_TEST_ARGS) {
     { { SIMDE_FLOAT64_C(  -774.56), SIMDE_FLOAT64_C(   892.85) },
       { SIMDE_FLOAT64_C(    -9.18), SIMDE_FLOAT64_C(     9.63) } },
     { { SIMDE_FLOAT64_C(   705.03), SIMDE_FLOAT64_C(  -332.78) },
-      { SIMDE_FLOAT64_C(     8.90), SIMDE_FLOAT64_C(    -6.93) } }
+      { SIMDE_FLOAT64_C(     8.90), SIMDE_FLOAT64_C(    -6.93) } },
+    { {       -SIMDE_MATH_INFINITY,             SIMDE_MATH_NAN },
+      {       -SIMDE_MATH_INFINITY,             SIMDE_MATH_NAN } },
+    { { SIMDE_FLOAT64_C(   -27.00), SIMDE_FLOAT64_C(   1e-310) },
+      { SIMDE_FLOAT64_C(    -3.00), SIMDE_FLOAT64_C(     0.00) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -13566,7 +13574,11 @@ test_simde_mm_exp_ps (SIMDE_MUNIT_TEST_ARGS) {
     { { SIMDE_FLOAT32_C(    -1.48), SIMDE_FLOAT32_C(     3.26), SIMDE_FLOAT32_C(     3.11), SIMDE_FLOAT32_C(     2.62) },
       { SIMDE_FLOAT32_C(     0.23), SIMDE_FLOAT32_C(    26.05), SIMDE_FLOAT32_C(    22.42), SIMDE_FLOAT32_C(    13.74) } },
     { { SIMDE_FLOAT32_C(     2.92), SIMDE_FLOAT32_C(     2.52), SIMDE_FLOAT32_C(    -1.27), SIMDE_FLOAT32_C(    -0.09) },
-      { SIMDE_FLOAT32_C(    18.54), SIMDE_FLOAT32_C(    12.43), SIMDE_FLOAT32_C(     0.28), SIMDE_FLOAT32_C(     0.91) } }
+      { SIMDE_FLOAT32_C(    18.54), SIMDE_FLOAT32_C(    12.43), SIMDE_FLOAT32_C(     0.28), SIMDE_FLOAT32_C(     0.91) } },
+    { {      -SIMDE_MATH_INFINITYF,       SIMDE_MATH_INFINITYF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   100.00) },
+      { SIMDE_FLOAT32_C(     0.00),       SIMDE_MATH_INFINITYF,            SIMDE_MATH_NANF,       SIMDE_MATH_INFINITYF } },
+    { { SIMDE_FLOAT32_C(  -200.00), SIMDE_FLOAT32_C(   -87.00), SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(     0.00) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     1.00) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -13599,7 +13611,13 @@ test_simde_mm_exp_pd (SIMDE_MUNIT_TEST_ARGS) {
     { { SIMDE_FLOAT64_C(     2.98), SIMDE_FLOAT64_C(    -3.59) },
       { SIMDE_FLOAT64_C(    19.69), SIMDE_FLOAT64_C(     0.03) } },
     { { SIMDE_FLOAT64_C(     1.60), SIMDE_FLOAT64_C(     3.03) },
-      { SIMDE_FLOAT64_C(     4.95), SIMDE_FLOAT64_C(    20.70) } }
+      { SIMDE_FLOAT64_C(     4.95), SIMDE_FLOAT64_C(    20.70) } },
+    { {       -SIMDE_MATH_INFINITY,        SIMDE_MATH_INFINITY },
+      { SIMDE_FLOAT64_C(     0.00),        SIMDE_MATH_INFINITY } },
+    { {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   710.00) },
+      {             SIMDE_MATH_NAN,        SIMDE_MATH_INFINITY } },
+    { { SIMDE_FLOAT64_C(  -800.00), SIMDE_FLOAT64_C(    -0.00) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     1.00) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -19836,7 +19854,13 @@ test_simde_mm_pow_ps (SIMDE_MUNIT_TEST_ARGS) {
       { SIMDE_FLOAT32_C(    15.98), SIMDE_FLOAT32_C(    66.36), SIMDE_FLOAT32_C(     0.25), SIMDE_FLOAT32_C(    13.85) } },
     { { SIMDE_FLOAT32_C(     2.31), SIMDE_FLOAT32_C(     3.31), SIMDE_FLOAT32_C(     4.59), SIMDE_FLOAT32_C(     3.78) },
       { SIMDE_FLOAT32_C(     1.69), SIMDE_FLOAT32_C(     2.88), SIMDE_FLOAT32_C(     3.45), SIMDE_FLOAT32_C(     4.50) },
-      { SIMDE_FLOAT32_C(     4.12), SIMDE_FLOAT32_C(    31.41), SIMDE_FLOAT32_C(   191.98), SIMDE_FLOAT32_C(   396.93) } }
+      { SIMDE_FLOAT32_C(     4.12), SIMDE_FLOAT32_C(    31.41), SIMDE_FLOAT32_C(   191.98), SIMDE_FLOAT32_C(   396.93) } },
+    { { SIMDE_FLOAT32_C(    -2.00), SIMDE_FLOAT32_C(    -8.00), SIMDE_FLOAT32_C(     0.00),            SIMDE_MATH_NANF },
+      { SIMDE_FLOAT32_C(     3.00), SIMDE_FLOAT32_C(     0.50), SIMDE_FLOAT32_C(    -1.00), SIMDE_FLOAT32_C(     0.00) },
+      { SIMDE_FLOAT32_C(    -8.00),            SIMDE_MATH_NANF,       SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(     1.00) } },
+    { { SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(    -1.00), SIMDE_FLOAT32_C(     2.00),      -SIMDE_MATH_INFINITYF },
+      {            SIMDE_MATH_NANF,       SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  1000.00), SIMDE_FLOAT32_C(     3.00) },
+      { SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(     1.00),       SIMDE_MATH_INFINITYF,      -SIMDE_MATH_INFINITYF } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -19879,7 +19903,16 @@ test_simde_mm_pow_pd (SIMDE_MUNIT_TEST_ARGS) {
       { SIMDE_FLOAT64_C(   110.59), SIMDE_FLOAT64_C(8587290.46) } },
     { { SIMDE_FLOAT64_C(     9.85), SIMDE_FLOAT64_C(     1.85) },
       { SIMDE_FLOAT64_C(     1.77), SIMDE_FLOAT64_C(     6.71) },
-      { SIMDE_FLOAT64_C(    57.33), SIMDE_FLOAT64_C(    62.05) } }
+      { SIMDE_FLOAT64_C(    57.33), SIMDE_FLOAT64_C(    62.05) } },
+    { { SIMDE_FLOAT64_C(    -2.00), SIMDE_FLOAT64_C(    -8.00) },
+      { SIMDE_FLOAT64_C(     3.00), SIMDE_FLOAT64_C(     0.50) },
+      { SIMDE_FLOAT64_C(    -8.00),             SIMDE_MATH_NAN } },
+    { {             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(     1.00) },
+      { SIMDE_FLOAT64_C(     0.00),             SIMDE_MATH_NAN },
+      { SIMDE_FLOAT64_C(     1.00), SIMDE_FLOAT64_C(     1.00) } },
+    { { SIMDE_FLOAT64_C(     0.00),       -SIMDE_MATH_INFINITY },
+      { SIMDE_FLOAT64_C(    -1.00), SIMDE_FLOAT64_C(     3.00) },
+      {        SIMDE_MATH_INFINITY,       -SIMDE_MATH_INFINITY } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {